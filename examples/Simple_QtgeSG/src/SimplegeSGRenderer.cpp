@@ -55,6 +55,7 @@ void fsg::SimplegeSGRenderer::onOGLContextCreated(QOpenGLContext* context)
    ge::gl::init();
    gl = make_shared<ge::gl::Context>();
    VT->gl = gl;
+   textureFactory = make_shared<ge::glsg::AsyncTextureFactory>(gl);
 
    //load shaders
    string shaderDir(APP_RESOURCES"/shaders/");
@@ -82,14 +83,16 @@ void fsg::SimplegeSGRenderer::setScene(std::shared_ptr<ge::sg::Scene>& loadedSce
 /**
  * Checks if there is new scene loaded and process it if need be.
  * Also sets up Visualization technique so we can render the scene later.
+ * Textures of the scene are uploaded progressively over several frames.
  */
 void fsg::SimplegeSGRenderer::update()
 {
    if(_needToProcessScene)
    {
-      glscene = ge::glsg::GLSceneProcessor::processScene(scene,gl);
+      glscene = ge::glsg::GLSceneProcessor::processScene(scene,gl,textureFactory);
       VT->setScene(glscene);
       VT->processScene();
       _needToProcessScene = false;
    }
+   textureFactory->pump();
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 namespace ge{
    namespace glsg{
       class GLScene;
+      class AsyncTextureFactory;
    }
 
    namespace gl{
@@ -41,6 +42,7 @@ namespace fsg
       std::shared_ptr<ge::gl::Context> gl;
       std::shared_ptr<ge::sg::Scene> scene;
       std::shared_ptr<ge::glsg::GLScene> glscene;
+      std::shared_ptr<ge::glsg::AsyncTextureFactory> textureFactory;
       std::shared_ptr<fsg::SimpleVT> VT;
       bool _needToProcessScene;
    };
@@ -8,6 +8,9 @@
 #include <geSG/Image.h>
 #include <geSG/DefaultImage.h>
 #include <geGL/Texture.h>
+#include <geGL/TextureUploader.h>
+#include <algorithm>
+#include <cstring>
 
 using namespace ge::glsg;
 using namespace ge::sg;
@@ -118,4 +121,59 @@ std::shared_ptr<ge::gl::Texture> DefaultTextureFactory::create(ge::sg::MaterialI
    context->glTextureParameteri(tex->getId(), GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
    return tex;
-}
\ No newline at end of file
+}
+
+/**
+ * Creates uploader with persistently mapped staging buffer, context needs to be active.
+ * \param context Context to create staging buffer with.
+ * \param stagingSize Size of staging buffer in bytes, larger images are uploaded synchronously.
+ * \param nofThreads Number of threads that copy image data into staging buffer.
+ */
+AsyncTextureFactory::AsyncTextureFactory(std::shared_ptr<ge::gl::Context> const& context, size_t stagingSize, size_t nofThreads)
+   : uploader(make_shared<TextureUploader>(context->getFunctionTable(), (GLsizeiptr)stagingSize, nofThreads))
+{
+}
+
+/**
+ * Creates texture (2D) like DefaultTextureFactory but only requests upload of its data.
+ * Mipmaps are generated when the upload is issued by pump().
+ * \param img Input image
+ * \param context Context to create texture with.
+ * \return Newly created texture.
+ */
+std::shared_ptr<ge::gl::Texture> AsyncTextureFactory::create(ge::sg::MaterialImageComponent* img, std::shared_ptr<ge::gl::Context>& context)
+{
+   auto const image = img->image;
+   if(image->getSizeInBytes() > (size_t)uploader->getStagingSize())
+      return DefaultTextureFactory().create(img, context);
+
+   GLsizei const w = (GLsizei)image->getWidth();
+   GLsizei const h = (GLsizei)image->getHeight();
+   GLsizei l = 1;
+   while((std::max(w, h) >> l) > 0) ++l;
+   shared_ptr<Texture> tex(make_shared<Texture>(context->getFunctionTable(), GL_TEXTURE_2D, GL_RGBA8, l, w, h));
+   tex->texParameteri(GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+   tex->texParameteri(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+   tex->texParameteri(GL_TEXTURE_MAX_LEVEL, 0);
+
+   auto const decoder = [image](void* pixels, size_t size)
+   {
+      std::memcpy(pixels, image->getBits(), std::min(size, image->getSizeInBytes()));
+   };
+   auto const done = [tex, l]()
+   {
+      tex->texParameteri(GL_TEXTURE_MAX_LEVEL, l - 1);
+      tex->generateMipmap();
+   };
+   uploader->upload(tex, 0, 0, 0, 0, w, h, 0, translateEnum(image->getFormat()), translateEnum(image->getDataType()), decoder, done);
+   return tex;
+}
+
+/**
+ * Issues uploads of images that were copied into staging buffer. Call it once per frame with active context.
+ * \return Number of uploaded textures.
+ */
+size_t AsyncTextureFactory::pump()
+{
+   return uploader->pump();
+}
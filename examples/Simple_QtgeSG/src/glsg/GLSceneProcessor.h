@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace ge
@@ -7,6 +8,7 @@ namespace ge
    namespace gl{
       class Texture;
       class Context;
+      class TextureUploader;
    }
 
    namespace sg
@@ -45,9 +47,26 @@ namespace ge
        */
       class DefaultTextureFactory : public TextureFactory
       {
+      public:
          virtual std::shared_ptr<ge::gl::Texture> create(ge::sg::MaterialImageComponent* img, std::shared_ptr<ge::gl::Context>& context);
       };
 
+      /**
+       * Texture factory that does not block the render thread. Texture storage is created immediately,
+       * image data are copied into staging memory by worker threads and uploaded by pump() which has to be
+       * called once per frame. Texture samples only level 0 until its upload is issued and mipmaps are generated,
+       * so textures become usable progressively.
+       */
+      class AsyncTextureFactory : public TextureFactory
+      {
+      public:
+         AsyncTextureFactory(std::shared_ptr<ge::gl::Context> const& context, size_t stagingSize = 64 * 1024 * 1024, size_t nofThreads = 2);
+         virtual std::shared_ptr<ge::gl::Texture> create(ge::sg::MaterialImageComponent* img, std::shared_ptr<ge::gl::Context>& context);
+         size_t pump();
+
+         std::shared_ptr<ge::gl::TextureUploader> uploader;
+      };
+
       /**
        * Class that creates and initializes the GLScene class. It creates ge::gl::Buffer for every AttributeDescriptor
        * And Texture for every MaterialImageComponent. OpenGL context needs to be <b>active</b> before you
@@ -1,6 +1,17 @@
 #!/usr/bin/python
 
 import os
+import argparse
+
+#python main.py
+#  generates function table with every function of gl.h and glext.h
+#python main.py --version 4.5 --extensions GL_ARB_bindless_texture,GL_NV_command_list
+#  generates function table restricted to core profile of selected version, whitelisted extensions
+#  and functions that are used by handwritten parts of geGL (see glExtensionFilter.py)
+parser = argparse.ArgumentParser()
+parser.add_argument("--version"   ,default=None,help="core profile version, e.g. 4.5")
+parser.add_argument("--extensions",default=""  ,help="comma separated list of extensions added to the profile")
+args = parser.parse_args()
 
 glHeader     = "/usr/include/GL/gl.h"
 glextHeader  = "/usr/include/GL/glext.h"
@@ -12,8 +23,9 @@ outputDir      = geGLIncludeDir+"Generated/"
 
 subscriptsDir = "subscripts/"
 
-allFormatedFunctions  = "allFormatedFunctions.txt"
-coreFormatedFunctions = "coreFormatedFunctions.txt"
+allFormatedFunctions     = "allFormatedFunctions.txt"
+coreFormatedFunctions    = "coreFormatedFunctions.txt"
+profileFormatedFunctions = "profileFormatedFunctions.txt"
 
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glHeader+" "+glextHeader+" |"+
@@ -25,6 +37,18 @@ os.system(
 "./"+subscriptsDir+"glFuncFormater.py >"+
 allFormatedFunctions)
 
+if args.version != None:
+  os.system(
+  "cat "+allFormatedFunctions+" |"+
+  "./"+subscriptsDir+"glExtensionFilter.py"+
+  " --version "+args.version+
+  " --core "+glcoreHeader+
+  " --header "+glextHeader+
+  " --extensions \""+args.extensions+"\""+
+  " --keep "+geGLSrcDir+" >"+
+  profileFormatedFunctions)
+  os.system("mv "+profileFormatedFunctions+" "+allFormatedFunctions)
+
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glcoreHeader+" |"+
 "./"+subscriptsDir+"decomment.py |"+
@@ -73,6 +97,11 @@ os.system(
 "./"+subscriptsDir+"generateContextCalls.py >"+
 outputDir+"ContextCalls.h")
 
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateDirectContextCalls.py >"+
+outputDir+"DirectContextCalls.h")
+
 os.system(
 "cat "+allFormatedFunctions+" |"+
 "./"+subscriptsDir+"generateNumberOfFunctions.py >"+
@@ -80,8 +109,8 @@ outputDir+"NumberOfFunctions.h")
 
 os.system(
 "cat "+allFormatedFunctions+" |"+
-"./"+subscriptsDir+"generateLoaderLoadingCalls.py >"+
-outputDir+"LoaderLoadingCalls.h")
+"./"+subscriptsDir+"generateLoaderTables.py >"+
+outputDir+"LoaderTables.h")
 
 os.system(
 "cat "+allFormatedFunctions+" |"+
@@ -98,6 +127,41 @@ os.system(
 "./"+subscriptsDir+"generateTrapImplementation.py >"+
 outputDir+"TrapImplementation.h")
 
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfilingCalls.py >"+
+outputDir+"ProfilingCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateProfilingImplementation.py >"+
+outputDir+"ProfilingImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateCaptureCalls.py >"+
+outputDir+"CaptureCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateCaptureImplementation.py >"+
+outputDir+"CaptureImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateReplayCalls.py >"+
+outputDir+"ReplayCalls.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateNullImplementation.py >"+
+outputDir+"NullImplementation.h")
+
+os.system(
+"cat "+allFormatedFunctions+" |"+
+"./"+subscriptsDir+"generateNullLoadingCalls.py >"+
+outputDir+"NullLoadingCalls.h")
+
 os.system(
 "./"+subscriptsDir+"printHEADER.py "+glHeader+" "+glextHeader+" |"+
 "./"+subscriptsDir+"extractConstants.py |"+
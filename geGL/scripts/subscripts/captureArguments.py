@@ -0,0 +1,142 @@
+#!/usr/bin/python
+
+import re
+
+# Helper module of generateCaptureImplementation.py and generateReplayCalls.py.
+# It decides how each argument of OpenGL function is written into capture stream.
+
+def getParameters(data):
+    params = data.split(",")
+    result = []
+    for t,n in zip(params[2::2],params[3::2]):
+        size = None
+        m = re.search(r"\[(.*)\]",n)
+        if m:
+            n = re.sub(r"\[.*\]","",n)
+            t = t+"*"
+            size = m.group(1)
+        result.append((t,n,size))
+    return params[0],params[1],result
+
+def normalize(t):
+    return t.replace(" ","")
+
+def isCallback(t):
+    return re.search(r"PROC(ARB|AMD|KHR|NV)?$",normalize(t)) is not None
+
+def isPointer(t):
+    return "*" in t
+
+def isConst(t):
+    return normalize(t).startswith("const")
+
+def elementType(t):
+    return normalize(t).replace("const","").replace("*","",1)
+
+def findParameter(params,regex):
+    for t,n,s in params:
+        if re.match(regex,n) and not isPointer(t):
+            return n
+    return None
+
+def getComponents(name,params):
+    m = re.search(r"Matrix(\d)(?:x(\d))?",name)
+    if m:
+        if m.group(2):
+            return int(m.group(1))*int(m.group(2))
+        return int(m.group(1))*int(m.group(1))
+    m = re.search(r"(\d)N?(?:i64|ui64|ui|ub|us|i|f|d|s|b|x|h)v(?:ARB|EXT|NV|OES)?$",name)
+    if m:
+        return int(m.group(1))
+    names = map(lambda x:x[1],params)
+    if re.search(r"Parameter(I?)(i|f|ui|iu|x)v",name) and "pname" in names:
+        return "this->m_parameterComponents(pname)"
+    if re.search(r"glClear(Named)?(Buffer|Framebuffer)(i|f|ui)v",name) and "buffer" in names:
+        return "this->m_clearComponents(buffer)"
+    return None
+
+def getImageSize(params,input):
+    names = map(lambda x:x[1],params)
+    if not ("format" in names and "type" in names):
+        return None
+    if "width" not in names:
+        return "getPixelSize(format,type)"
+    height = "height" if "height" in names else "1"
+    depth  = "depth"  if "depth"  in names else "1"
+    if input:
+        return "getImageSize(format,type,width,"+height+","+depth+",this->m_unpackAlignment())"
+    return "getImageSize(format,type,width,"+height+","+depth+",8)"
+
+def getDataSize(params,t,n,size,input):
+    names = map(lambda x:x[1],params)
+    if size:
+        return size+"*sizeof("+elementType(t)+")"
+    if normalize(t) in ["constvoid*","constGLvoid*","void*","GLvoid*"]:
+        if not input and "bufSize" in names:
+            return "(size_t)bufSize"
+        image = getImageSize(params,input)
+        if image:
+            if input:
+                return "this->m_clientPixels("+image+")"
+            return image
+        if "imageSize" in names:
+            if input:
+                return "this->m_clientPixels((size_t)imageSize)"
+            return "(size_t)imageSize"
+        for pt,pn,ps in params:
+            if pn == "size" and normalize(pt).startswith("GLsizeiptr"):
+                return "(size_t)size"
+        return None
+    return None
+
+def captureArgument(name,params,t,n,size):
+    if isCallback(t):
+        return "call.null();"
+    if not isPointer(t):
+        if normalize(t) == "GLsync":
+            return "call.sync("+n+");"
+        return "call.scalar("+n+");"
+    names = map(lambda x:x[1],params)
+    if not isConst(t):
+        s = getDataSize(params,t,n,size,False)
+        if s is None and "bufSize" in names:
+            s = "(size_t)bufSize*sizeof("+elementType(t)+")"
+        if s is None:
+            s = "0"
+        return "call.output("+n+","+s+");"
+    nt = normalize(t)
+    if nt in ["constGLchar*const*","constGLchar**","constGLcharARB**","constGLcharARB*const*"]:
+        count = findParameter(params,r"^(count|\w*[cC]ount)$")
+        if count is None:
+            return "call.pointer("+n+");"
+        length = "length" if "length" in names else "nullptr"
+        return "call.strings("+count+","+n+","+length+");"
+    if nt in ["constGLchar*","constGLcharARB*"]:
+        index = names.index(n)
+        if index > 0 and re.match(r"^(length|len|\w*len)$",params[index-1][1]):
+            return "call.string("+n+","+params[index-1][1]+");"
+        return "call.string("+n+",-1);"
+    s = getDataSize(params,t,n,size,True)
+    if s is not None:
+        return "call.array("+n+","+s+");"
+    if "void" in nt and not (nt.endswith("*const*") or nt.endswith("**")):
+        return "call.pointer("+n+");"
+    count = findParameter(params,r"^(n|count|num\w*|\w*[cC]ount)$")
+    components = getComponents(name,params)
+    if count is not None:
+        return "call.array("+n+",(size_t)"+count+"*"+str(components or 1)+"*sizeof("+elementType(t)+"));"
+    if components is not None:
+        return "call.array("+n+","+str(components)+"*sizeof("+elementType(t)+"));"
+    if re.search(r"gl(Load|Mult)(Transpose)?Matrix",name):
+        return "call.array("+n+",16*sizeof("+elementType(t)+"));"
+    return "call.pointer("+n+");"
+
+def replayArgument(t,n,size):
+    if isCallback(t):
+        return "call.null<"+t+">()"
+    if isPointer(t):
+        return "call.pointer<"+t+">()"
+    if normalize(t) == "GLsync":
+        return "call.sync()"
+    return "call.scalar<"+t+">()"
+
@@ -0,0 +1,24 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printCaptureCall(data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    print "this->m_orig_"+params[1]+" = this->m_ptr_"+params[1]+";"
+    print "if(this->m_ptr_"+params[1]+")this->m_ptr_"+params[1]+" = (FunctionTable::"+pfn+")&CaptureTableDecorator::m_"+params[1]+"_capture;"
+
+for x in data0:
+    printCaptureCall(x)
+
@@ -0,0 +1,36 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+from captureArguments import *
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def getReturn(type):
+    if type == "void" or type == "GLvoid":
+        return ""
+    return "return "
+
+def printCaptureImplementation(index,data):
+    ret,name,params = getParameters(data)
+    pfn = ("memberpfn"+name+"proc").upper()
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(data.split(",")[2::2],data.split(",")[3::2])))
+    call = "(this->*(this->m_orig_"+name+"))("+",".join(map(lambda x:x[1],params))+")"
+    record = "CaptureCall call(*this->m_writer,"+str(index)+",\""+name+"\");"+"".join(map(lambda x:captureArgument(name,params,x[0],x[1],x[2]),params))
+    print "FunctionTable::"+pfn+" m_orig_"+name+" = nullptr;"
+    if normalize(ret) == "GLsync":
+        print ret+" m_"+name+"_capture("+args+")const{CaptureScope const scope;auto const result = "+call+";if(scope.isOutermost()){"+record+"call.sync(result);this->m_writer->write(call);}return result;}"
+    else:
+        print ret+" m_"+name+"_capture("+args+")const{CaptureScope const scope;if(scope.isOutermost()){"+record+"this->m_writer->write(call);}"+getReturn(ret)+call+";}"
+
+for i,x in enumerate(data0):
+    printCaptureImplementation(i,x)
+
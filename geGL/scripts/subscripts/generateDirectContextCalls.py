@@ -0,0 +1,25 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printDirectContextCall(data,index):
+    params = data.split(",")
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],params[3::2])))
+    params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
+    pfn = ("pfn"+params[1]+"proc").upper()
+    call = "("+",".join(params2[3::2])+");"
+    print "inline "+params[0]+" "+params[1]+"("+args+")const{auto const direct_ = (FunctionTable::"+pfn+")this->m_functions["+str(index)+"];if(direct_)return direct_"+call+"return this->m_rawTable->"+params[1]+call+"}"
+
+for i,x in enumerate(data0):
+    printDirectContextCall(x,i)
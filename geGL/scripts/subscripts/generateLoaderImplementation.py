@@ -24,7 +24,16 @@ def printFunctionImplementation(data):
     params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
     print params[0]+" m_"+params[1]+"_impl("+args+")const{"+getReturn(params[0])+"this->m_"+params[1]+"("+",".join(params2[3::2])+");}"
 
+def printLazyImplementation(data,index):
+    params = data.split(",")
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],params[3::2])))
+    params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
+    print params[0]+" m_"+params[1]+"_lazy("+args+")const{if(!this->m_"+params[1]+")this->m_resolveOrThrow("+str(index)+");"+getReturn(params[0])+"this->m_"+params[1]+"("+",".join(params2[3::2])+");}"
+
 
 for x in data0:
     printFunctionImplementation(x)
 
+for i,x in enumerate(data0):
+    printLazyImplementation(x,i)
+
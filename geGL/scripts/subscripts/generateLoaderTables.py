@@ -0,0 +1,55 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+names = map(lambda x:x.split(",")[1],data0)
+
+print "static char const*const*m_functionNames(){"
+print "  static char const*const names[] = {"
+for name in names:
+    print "    \""+name+"\","
+print "  };"
+print "  return names;"
+print "}"
+
+#tables cast every member function to MEMBER_FUNCTION_POINTER, it is intended
+print "#if defined(__GNUC__)"
+print "#pragma GCC diagnostic push"
+print "#pragma GCC diagnostic ignored \"-Wpragmas\""
+print "#pragma GCC diagnostic ignored \"-Wunknown-warning-option\""
+print "#pragma GCC diagnostic ignored \"-Wcast-function-type\""
+print "#endif"
+
+print "static MEMBER_FUNCTION_POINTER const*m_implFunctions(){"
+print "  static MEMBER_FUNCTION_POINTER const functions[] = {"
+for name in names:
+    print "    (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_"+name+"_impl),"
+print "  };"
+print "  return functions;"
+print "}"
+
+print "static MEMBER_FUNCTION_POINTER const*m_lazyFunctions(){"
+print "  static MEMBER_FUNCTION_POINTER const functions[] = {"
+for name in names:
+    print "    (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_"+name+"_lazy),"
+print "  };"
+print "  return functions;"
+print "}"
+
+print "#if defined(__GNUC__)"
+print "#pragma GCC diagnostic pop"
+print "#endif"
+
+print "FUNCTION_POINTER*m_baseFunctions()const{return (FUNCTION_POINTER*)&this->FunctionTable::m_"+names[0]+";}"
+print "MEMBER_FUNCTION_POINTER*m_memberFunctions()const{return (MEMBER_FUNCTION_POINTER*)&this->FunctionTable::m_ptr_"+names[0]+";}"
@@ -0,0 +1,28 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printNullImplementation(data):
+    params = data.split(",")
+    i = 2;
+    while i<len(params):
+      if re.search("\[.*\]",params[i+1]):
+        params[i] = params[i]+"*"
+      i+=2;
+    print "static "+params[0]+" m_"+params[1]+"_null("+",".join(params[2::2])+"){return ("+params[0]+")0;}"
+
+
+for x in data0:
+    printNullImplementation(x)
+
@@ -0,0 +1,24 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+print "char const* functionNames[] = {"
+for line in data0:
+    print "  \""+line.split(",")[1]+"\","
+print "};"
+
+print "FUNCTION_POINTER const functionPointers[] = {"
+for line in data0:
+    print "  (FUNCTION_POINTER)(&NullFunctions::m_"+line.split(",")[1]+"_null),"
+print "};"
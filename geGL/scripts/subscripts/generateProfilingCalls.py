@@ -0,0 +1,25 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printProfilingCall(index,data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    print "this->m_names["+str(index)+"] = \""+params[1]+"\";"
+    print "this->m_orig_"+params[1]+" = this->m_ptr_"+params[1]+";"
+    print "if(this->m_ptr_"+params[1]+")this->m_ptr_"+params[1]+" = (FunctionTable::"+pfn+")&ProfilingTableDecorator::m_"+params[1]+"_profile;"
+
+for i,x in enumerate(data0):
+    printProfilingCall(i,x)
+
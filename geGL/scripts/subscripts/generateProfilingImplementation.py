@@ -0,0 +1,31 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def getReturn(type):
+    if type == "void" or type == "GLvoid":
+        return ""
+    return "return "
+
+def printProfilingImplementation(index,data):
+    params = data.split(",")
+    pfn = ("memberpfn"+params[1]+"proc").upper()
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],params[3::2])))
+    params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
+    print "FunctionTable::"+pfn+" m_orig_"+params[1]+" = nullptr;"
+    print params[0]+" m_"+params[1]+"_profile("+args+")const{ProfilingScope const scope(this,"+str(index)+");"+getReturn(params[0])+"(this->*(this->m_orig_"+params[1]+"))("+",".join(params2[3::2])+");}"
+
+for i,x in enumerate(data0):
+    printProfilingImplementation(i,x)
+
@@ -0,0 +1,29 @@
+#!/usr/bin/python
+
+import sys
+import re
+import os
+
+import fileinput
+from subprocess import Popen, PIPE
+from captureArguments import *
+
+data0=""
+for line in fileinput.input():
+    data0+=line
+
+data0=data0.split("\n")[:-1]
+
+def printReplayCall(data):
+    ret,name,params = getParameters(data)
+    reads = "".join(map(lambda x:"auto const a"+str(x[0])+" = "+replayArgument(x[1][0],x[1][1],x[1][2])+";",enumerate(params)))
+    call = "table."+name+"("+",".join(map(lambda x:"a"+str(x),range(len(params))))+")"
+    if normalize(ret) == "GLsync":
+        call = "call.mapSync("+call+")"
+    #functions without arguments do not read anything from call
+    callParam = "call" if "call." in reads+call else ""
+    print "{\""+name+"\",[](FunctionTable const&table,ReplayCall&"+callParam+"){"+reads+call+";}},"
+
+for x in data0:
+    printReplayCall(x)
+
@@ -26,7 +26,10 @@ def printContextCall(data):
 
 print "#include<geGL/StaticCalls.h>"
 print "#include<geGL/OpenGLContext.h>"
+print "#if !defined(GEGL_STATIC_DISPATCH)"
 
 for x in data0:
     printContextCall(x)
 
+print "#endif"
+
@@ -24,11 +24,28 @@ def printContextDeclaration(data):
     params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
     print "    GEGL_EXPORT "+params[0]+" "+params[1]+"("+args+");"
 
+def printStaticDispatchCall(data):
+    params = data.split(",")
+    args = ",".join(map(lambda x:x[0]+" "+x[1],zip(params[2::2],params[3::2])))
+    params2 = map(lambda x:re.sub(r"\[.*\]","",x),params);
+    print "    inline "+params[0]+" "+params[1]+"("+args+"){"+getReturn(params[0])+"ge::gl::getDefaultDirectContext()."+params[1]+"("+",".join(params2[3::2])+");}"
+
+print "#pragma once"
 print "#include<geGL/OpenGL.h>"
+print "#if defined(GEGL_STATIC_DISPATCH)"
+print "#include<geGL/DirectContext.h>"
+print "namespace ge{"
+print "  namespace gl{"
+for x in data0:
+    printStaticDispatchCall(x)
+print "  }"
+print "}"
+print "#else"
 print "namespace ge{"
 print "  namespace gl{"
 for x in data0:
     printContextDeclaration(x)
 print "  }"
 print "}"
+print "#endif"
 
@@ -3,20 +3,102 @@
 import sys
 import re
 import os
+import argparse
 
-import fileinput
-from subprocess import Popen, PIPE
+#Without arguments, it removes declarations of vendor extension functions.
+#
+#With --version, it filters formated functions (ret,name,type,param,...)
+#and keeps only functions of selected OpenGL profile:
+#  --version 4.5 --core glcorearb.h
+#    functions of GL_VERSION_x_y blocks of core header up to selected version
+#  --extensions GL_ARB_bindless_texture,GL_NV_command_list --header glext.h
+#    functions of whitelisted extension blocks
+#  --keep ../src/geGL/
+#    functions that are used by handwritten sources of geGL (decorators, objects, ...)
 
-data0=""
-for line in fileinput.input():
-    data0+=line
+parser = argparse.ArgumentParser()
+parser.add_argument("--version"   ,default=None)
+parser.add_argument("--core"      ,default=None)
+parser.add_argument("--header"    ,default=[],action="append")
+parser.add_argument("--extensions",default="")
+parser.add_argument("--keep"      ,default=[],action="append")
+args = parser.parse_args()
 
-#ext = re.compile(r"AMD|NV|ATI|IBM|HP|EXT|ARB|OES|SUN|SGI|MESA|INTEL|APPLE|3DFX|GREMEDY|OVR|PGI|INGR|KHR|\[")
-ext = re.compile(r"AMD|NV|ATI|IBM|HP|ARB|OES|SUN|SGI|MESA|INTEL|APPLE|3DFX|GREMEDY|OVR|PGI|INGR|KHR|\[")
+data0 = sys.stdin.read()
 
-for i in data0.split("\n"):
-    if ext.findall(i)!=[]:
+if args.version == None:
+    #ext = re.compile(r"AMD|NV|ATI|IBM|HP|EXT|ARB|OES|SUN|SGI|MESA|INTEL|APPLE|3DFX|GREMEDY|OVR|PGI|INGR|KHR|\[")
+    ext = re.compile(r"AMD|NV|ATI|IBM|HP|ARB|OES|SUN|SGI|MESA|INTEL|APPLE|3DFX|GREMEDY|OVR|PGI|INGR|KHR|\[")
+
+    for i in data0.split("\n"):
+        if ext.findall(i)!=[]:
+            continue
+        if i=="":
+            continue
+        print i
+    sys.exit(0)
+
+def getFunctionBlocks(fileName):
+    #returns function name -> name of enclosing #ifndef GL_... block
+    blocks = dict()
+    stack  = []
+    for line in open(fileName).read().split("\n"):
+        directive = re.match(r"\s*#\s*(\w+)\s*(\w*)",line)
+        if directive:
+            if directive.group(1) in ["if","ifdef","ifndef"]:
+                stack += [directive.group(2) if directive.group(1) == "ifndef" else ""]
+            if directive.group(1) == "endif" and stack != []:
+                stack = stack[:-1]
+            continue
+        block = filter(lambda x:re.match(r"GL_[A-Z0-9]+_\w+",x),stack)
+        if block == []:
+            continue
+        for name in re.findall(r"\b(gl[A-Z]\w*)\s*\(",line):
+            blocks[name] = block[-1]
+    return blocks
+
+def parseVersion(string):
+    return tuple(map(int,string.split(".")))
+
+def getReferencedFunctions(directory):
+    #names of OpenGL functions that are used by handwritten sources
+    #(Generated directory and StaticCalls are generated)
+    names = set()
+    for root,dirs,files in os.walk(directory):
+        if "Generated" in dirs:
+            dirs.remove("Generated")
+        for f in files:
+            if not re.search(r"\.(h|cpp)$",f) or f.startswith("StaticCalls."):
+                continue
+            source = open(os.path.join(root,f)).read()
+            names |= set(re.findall(r"\b(?:m_ptr_)?(gl[A-Z]\w*)",source))
+            #vendor variants of DSA functions are pasted by IMPLEMENTx(name,ven0,...) macros
+            for name,vendors in re.findall(r"IMPLEMENT\d\(\s*(gl\w+)\s*((?:,\s*\w+\s*)*)\)",source):
+                names |= set(map(lambda x:name+x.strip(),filter(lambda x:x.strip()!="",vendors.split(","))))
+    return names
+
+version    = parseVersion(args.version)
+extensions = set(filter(lambda x:x!="",args.extensions.split(",")))
+
+selected = set()
+if args.core != None:
+    for name,block in getFunctionBlocks(args.core).items():
+        v = re.match(r"GL_VERSION_(\d+)_(\d+)$",block)
+        if v and (int(v.group(1)),int(v.group(2))) <= version:
+            selected.add(name)
+
+for header in [args.core]+args.header:
+    if header == None:
         continue
+    for name,block in getFunctionBlocks(header).items():
+        if block in extensions:
+            selected.add(name)
+
+for directory in args.keep:
+    selected |= getReferencedFunctions(directory)
+
+for i in data0.split("\n"):
     if i=="":
         continue
-    print i
+    if i.split(",")[1] in selected:
+        print i
@@ -0,0 +1,281 @@
+#include <geGL/AsyncReadback.h>
+#include <geGL/OpenGLUtil.h>
+#include <geGL/Texture.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+namespace {
+/**
+ * @brief Binds buffer to GL_PIXEL_PACK_BUFFER with pack alignment 1,
+ * previous state is restored in destructor
+ */
+class PackState {
+ public:
+  PackState(Context const &gl, Buffer const &buffer) : gl(gl)
+  {
+    gl.glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &oldBinding);
+    gl.glGetIntegerv(GL_PACK_ALIGNMENT, &oldAlignment);
+    gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer.getId());
+    gl.glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  }
+  ~PackState()
+  {
+    gl.glPixelStorei(GL_PACK_ALIGNMENT, oldAlignment);
+    gl.glBindBuffer(GL_PIXEL_PACK_BUFFER, static_cast<GLuint>(oldBinding));
+  }
+
+ private:
+  Context const &gl;
+  GLint          oldBinding   = 0;
+  GLint          oldAlignment = 4;
+};
+}  // namespace
+
+/**
+ * @brief Constructor
+ */
+AsyncReadback::AsyncReadback() : AsyncReadback(nullptr) {}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ */
+AsyncReadback::AsyncReadback(FunctionTablePointer const &table) : gl(table) {}
+
+/**
+ * @brief Destructor, it waits for pending requests so their futures are
+ * fulfilled
+ */
+AsyncReadback::~AsyncReadback() { finish(); }
+
+/**
+ * @brief Reads range of buffer
+ *
+ * @param buffer source buffer
+ * @param size size of range in bytes, 0 means rest of buffer
+ * @param offset offset of range
+ *
+ * @return future with data
+ */
+AsyncReadback::Future AsyncReadback::read(Buffer const &buffer,
+                                          GLsizeiptr    size,
+                                          GLintptr      offset)
+{
+  assert(this != nullptr);
+  if (size == 0) size = buffer.getSize() - offset;
+  if (size < 0 || offset < 0 || offset + size > buffer.getSize())
+    throw std::invalid_argument(
+        "geGL: AsyncReadback::read - range is out of buffer");
+  auto const staging = acquire(size);
+  if (size > 0)
+    gl.glCopyNamedBufferSubData(buffer.getId(), staging->getId(), offset, 0,
+                                size);
+  return submit(staging, size);
+}
+
+/**
+ * @brief Reads mipmap level of texture, data are tightly packed (alignment 1).
+ * Cube map is read as 6 faces in order of GL_TEXTURE_CUBE_MAP_POSITIVE_X + i.
+ *
+ * @param texture source texture
+ * @param level mipmap level
+ * @param format format of pixels
+ * @param type type of pixels
+ *
+ * @return future with pixels
+ */
+AsyncReadback::Future AsyncReadback::readTexture(Texture const &texture,
+                                                 GLint          level,
+                                                 GLenum         format,
+                                                 GLenum         type)
+{
+  assert(this != nullptr);
+  auto const depth = texture.getTarget() == GL_TEXTURE_CUBE_MAP
+                         ? GLsizei(6)
+                         : std::max<GLsizei>(texture.getDepth(level), 1);
+  auto const size = static_cast<GLsizeiptr>(
+      getImageSize(format, type, texture.getWidth(level),
+                   std::max<GLsizei>(texture.getHeight(level), 1), depth, 1));
+  auto const staging = acquire(size);
+  {
+    PackState const state(gl, *staging);
+    gl.glGetTextureImage(texture.getId(), level, format, type,
+                         static_cast<GLsizei>(size), nullptr);
+  }
+  return submit(staging, size);
+}
+
+/**
+ * @brief Reads compressed mipmap level of texture
+ *
+ * @param texture source texture
+ * @param level mipmap level
+ *
+ * @return future with compressed data
+ */
+AsyncReadback::Future AsyncReadback::readCompressedTexture(
+    Texture const &texture,
+    GLint          level)
+{
+  assert(this != nullptr);
+  auto const size =
+      static_cast<GLsizeiptr>(texture.getCompressedImageSize(level));
+  auto const staging = acquire(size);
+  {
+    PackState const state(gl, *staging);
+    gl.glGetCompressedTextureImage(texture.getId(), level,
+                                   static_cast<GLsizei>(size), nullptr);
+  }
+  return submit(staging, size);
+}
+
+/**
+ * @brief Reads pixels of bound read framebuffer, data are tightly packed
+ * (alignment 1)
+ *
+ * @param x x coordinate of lower left corner
+ * @param y y coordinate of lower left corner
+ * @param width width of rectangle
+ * @param height height of rectangle
+ * @param format format of pixels
+ * @param type type of pixels
+ *
+ * @return future with pixels
+ */
+AsyncReadback::Future AsyncReadback::readPixels(GLint   x,
+                                                GLint   y,
+                                                GLsizei width,
+                                                GLsizei height,
+                                                GLenum  format,
+                                                GLenum  type)
+{
+  assert(this != nullptr);
+  auto const size = static_cast<GLsizeiptr>(
+      getImageSize(format, type, width, height, 1, 1));
+  auto const staging = acquire(size);
+  {
+    PackState const state(gl, *staging);
+    gl.glReadPixels(x, y, width, height, format, type, nullptr);
+  }
+  return submit(staging, size);
+}
+
+/**
+ * @brief Polls fences of pending requests without blocking, requests are
+ * completed in submission order
+ *
+ * @return number of fulfilled futures
+ */
+size_t AsyncReadback::pump()
+{
+  assert(this != nullptr);
+  size_t completed = 0;
+  while (!pending.empty() && pending.front().fence->isSignaled()) {
+    complete(pending.front());
+    pending.pop_front();
+    completed++;
+  }
+  return completed;
+}
+
+/**
+ * @brief Waits for all pending requests and fulfils their futures
+ */
+void AsyncReadback::finish()
+{
+  assert(this != nullptr);
+  while (!pending.empty()) {
+    pending.front().fence->wait();
+    complete(pending.front());
+    pending.pop_front();
+  }
+}
+
+size_t AsyncReadback::getNofPending() const { return pending.size(); }
+
+size_t AsyncReadback::getNofPooledBuffers() const { return pool.size(); }
+
+/**
+ * @brief Deletes free staging buffers, buffers of pending requests are kept
+ */
+void AsyncReadback::releasePool() { pool.clear(); }
+
+AsyncReadback::Statistics const &AsyncReadback::getStatistics() const
+{
+  return statistics;
+}
+
+/**
+ * @brief Gets staging buffer from pool or creates new one.
+ * The smallest pooled buffer that is large enough is chosen.
+ *
+ * @param size required size in bytes
+ *
+ * @return staging buffer
+ */
+std::shared_ptr<Buffer> AsyncReadback::acquire(GLsizeiptr size)
+{
+  auto best = pool.end();
+  for (auto it = pool.begin(); it != pool.end(); ++it) {
+    if ((*it)->getSize() < size) continue;
+    if (best == pool.end() || (*it)->getSize() < (*best)->getSize()) best = it;
+  }
+  if (best != pool.end()) {
+    auto const result = *best;
+    pool.erase(best);
+    statistics.stagingReuses++;
+    return result;
+  }
+  statistics.stagingAllocations++;
+  return std::make_shared<Buffer>(gl.getFunctionTable(),
+                                  std::max(size, GLsizeiptr(1)), nullptr,
+                                  GL_MAP_READ_BIT);
+}
+
+/**
+ * @brief Inserts fence after copy into staging buffer and enqueues request
+ *
+ * @param staging staging buffer
+ * @param size size of data in bytes
+ *
+ * @return future of request
+ */
+AsyncReadback::Future AsyncReadback::submit(
+    std::shared_ptr<Buffer> const &staging,
+    GLsizeiptr                     size)
+{
+  Request request;
+  request.staging = staging;
+  request.size    = size;
+  request.fence   = std::unique_ptr<Sync>(new Sync(gl.getFunctionTable()));
+  auto result     = request.promise.get_future();
+  pending.push_back(std::move(request));
+  statistics.requests++;
+  return result;
+}
+
+/**
+ * @brief Copies data of finished request to CPU, fulfils its future and
+ * returns staging buffer into pool
+ *
+ * @param request finished request
+ */
+void AsyncReadback::complete(Request &request)
+{
+  request.fence = nullptr;
+  Data data(static_cast<size_t>(request.size));
+  if (request.size > 0) {
+    auto const ptr = request.staging->map(0, request.size, GL_MAP_READ_BIT);
+    if (ptr) std::memcpy(data.data(), ptr, data.size());
+    request.staging->unmap();
+  }
+  pool.push_back(request.staging);
+  statistics.completed++;
+  statistics.bytesRead += request.size;
+  request.promise.set_value(std::move(data));
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <geGL/Sync.h>
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Non-blocking readback of buffers, textures and framebuffer pixels.
+ *
+ * Every request copies data on GPU into staging buffer (bound as
+ * GL_PIXEL_PACK_BUFFER for images), inserts fence and returns std::future.
+ * pump() has to be called regularly by thread of the context, it polls fences
+ * without blocking and fulfils futures of finished requests. Staging buffers
+ * are returned into pool and reused by later requests of similar size, so
+ * repeated per-frame readbacks do not allocate.
+ *
+ * @code
+ * AsyncReadback readback;
+ * auto result = readback.read(buffer);
+ * for(;;){
+ *   ...render...
+ *   readback.pump();
+ *   if(result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+ *     use(result.get());
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::AsyncReadback {
+ public:
+  using Data   = std::vector<uint8_t>;
+  using Future = std::future<Data>;
+  /**
+   * @brief Readback statistics
+   */
+  struct Statistics {
+    size_t     requests           = 0;  ///< number of requests
+    size_t     completed          = 0;  ///< number of fulfilled futures
+    size_t     stagingAllocations = 0;  ///< staging buffers created
+    size_t     stagingReuses      = 0;  ///< requests served from pool
+    GLsizeiptr bytesRead          = 0;  ///< bytes copied to CPU
+  };
+  AsyncReadback();
+  AsyncReadback(FunctionTablePointer const& table);
+  ~AsyncReadback();
+  AsyncReadback(AsyncReadback const&) = delete;
+  AsyncReadback& operator=(AsyncReadback const&) = delete;
+  Future read(Buffer const& buffer, GLsizeiptr size = 0, GLintptr offset = 0);
+  Future readTexture(Texture const& texture,
+                     GLint          level  = 0,
+                     GLenum         format = GL_RGBA,
+                     GLenum         type   = GL_UNSIGNED_BYTE);
+  Future readCompressedTexture(Texture const& texture, GLint level = 0);
+  Future readPixels(GLint   x,
+                    GLint   y,
+                    GLsizei width,
+                    GLsizei height,
+                    GLenum  format = GL_RGBA,
+                    GLenum  type   = GL_UNSIGNED_BYTE);
+  size_t pump();
+  void   finish();
+  size_t getNofPending() const;
+  size_t getNofPooledBuffers() const;
+  void   releasePool();
+  Statistics const& getStatistics() const;
+
+ protected:
+  struct Request {
+    std::shared_ptr<Buffer> staging;
+    GLsizeiptr              size;
+    std::unique_ptr<Sync>   fence;
+    std::promise<Data>      promise;
+  };
+  std::shared_ptr<Buffer> acquire(GLsizeiptr size);
+  Future                  submit(std::shared_ptr<Buffer> const& staging,
+                                 GLsizeiptr                     size);
+  void                    complete(Request& request);
+  Context                              gl;
+  std::deque<Request>                  pending;
+  std::vector<std::shared_ptr<Buffer>> pool;  ///< free staging buffers
+  Statistics                           statistics;
+};
@@ -0,0 +1,25 @@
+#pragma once
+
+#include<geGL/Generated/OpenGLTypes.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Interface of function tables that keep client-side copy of bindings
+     * Objects use it to save and restore bindings without glGet* round trips.
+     */
+    class BindingTrackerInterface{
+      public:
+        virtual ~BindingTrackerInterface(){}
+        /**
+         * @brief This function returns buffer bound to generic binding point.
+         * Binding is queried from driver only if it is not known yet.
+         *
+         * @param target buffer target (GL_PIXEL_UNPACK_BUFFER, ...)
+         *
+         * @return buffer id
+         */
+        virtual GLuint getBufferBinding(GLenum target)const = 0;
+    };
+  }
+}
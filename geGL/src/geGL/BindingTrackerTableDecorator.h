@@ -0,0 +1,354 @@
+#pragma once
+
+#include<map>
+#include<utility>
+#include<type_traits>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/StateCacheInterface.h>
+#include<geGL/BindingTrackerInterface.h>
+#include<geGL/OpenGLUtil.h>
+
+//function is resolved before it is wrapped,
+//lazily loaded missing functions have to stay nullptr, so DSATableDecorator emulates them
+#define TRACK_BINDING(name)\
+  this->m_tracked_##name = this->m_isAvailable(this->m_ptr_##name) ? this->m_ptr_##name : nullptr;\
+  if(this->m_tracked_##name)\
+    this->m_ptr_##name =\
+      (decltype(FunctionTable::m_ptr_##name))\
+        &BindingTrackerTableDecorator::m_##name##_track
+
+#define DECLARE_TRACKED(name)\
+  decltype(FunctionTable::m_ptr_##name)m_tracked_##name = nullptr
+
+#define CALL_TRACKED(name)\
+  (this->*(this->m_tracked_##name))
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator keeps client-side copy of bindings
+     * that are saved and restored by DSATableDecorator.
+     * Binding is queried from driver only if it is not known yet,
+     * every following change is recorded when it passes through the table.
+     *
+     * Tracked bindings:
+     * generic buffer bindings, vertex array, draw/read framebuffer,
+     * renderbuffer, program pipeline, active texture,
+     * per unit texture bindings, per unit sampler bindings.
+     */
+    template<typename T>
+      class BindingTrackerTableDecorator: public T, public virtual StateCacheInterface, public virtual BindingTrackerInterface{
+        public:
+          template<typename...ARGS>
+            BindingTrackerTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~BindingTrackerTableDecorator(){}
+          virtual void invalidate()const override{
+            assert(this!=nullptr);
+            this->m_vertexArray     = Binding{};
+            this->m_renderbuffer    = Binding{};
+            this->m_programPipeline = Binding{};
+            this->m_activeTexture   = Binding{};
+            this->m_buffers     .clear();
+            this->m_framebuffers.clear();
+            this->m_textures    .clear();
+            this->m_samplers    .clear();
+            this->m_invalidateBase(std::is_base_of<StateCacheInterface,T>{});
+          }
+          virtual GLuint getBufferBinding(GLenum target)const override{
+            assert(this!=nullptr);
+            return this->m_getBufferBinding(target);
+          }
+        protected:
+          void m_invalidateBase(std::true_type )const{T::invalidate();}
+          void m_invalidateBase(std::false_type)const{}
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            TRACK_BINDING(glBindBuffer            );
+            TRACK_BINDING(glBindBufferBase        );
+            TRACK_BINDING(glBindBufferRange       );
+            TRACK_BINDING(glDeleteBuffers         );
+            TRACK_BINDING(glBindVertexArray       );
+            TRACK_BINDING(glDeleteVertexArrays    );
+            TRACK_BINDING(glBindFramebuffer       );
+            TRACK_BINDING(glDeleteFramebuffers    );
+            TRACK_BINDING(glBindRenderbuffer      );
+            TRACK_BINDING(glDeleteRenderbuffers   );
+            TRACK_BINDING(glBindProgramPipeline   );
+            TRACK_BINDING(glDeleteProgramPipelines);
+            TRACK_BINDING(glActiveTexture         );
+            TRACK_BINDING(glBindTexture           );
+            TRACK_BINDING(glBindTextureUnit       );
+            TRACK_BINDING(glBindTextures          );
+            TRACK_BINDING(glDeleteTextures        );
+            TRACK_BINDING(glBindSampler           );
+            TRACK_BINDING(glBindSamplers          );
+            TRACK_BINDING(glDeleteSamplers        );
+            return true;
+          }
+
+          /**
+           * @brief This function returns buffer bound to generic binding point
+           *
+           * @param target buffer target (GL_COPY_WRITE_BUFFER, ...)
+           *
+           * @return buffer id
+           */
+          GLuint m_getBufferBinding(GLenum target)const{
+            auto const it = this->m_buffers.find(target);
+            if(it != this->m_buffers.end())return it->second;
+            return this->m_buffers[target] = this->m_queryBinding(ge::gl::bufferTarget2Binding(target));
+          }
+
+          GLuint m_getVertexArrayBinding()const{
+            return this->m_getBinding(this->m_vertexArray,GL_VERTEX_ARRAY_BINDING);
+          }
+
+          /**
+           * @brief This function returns framebuffer bound to target
+           *
+           * @param target GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER
+           *
+           * @return framebuffer id
+           */
+          GLuint m_getFramebufferBinding(GLenum target)const{
+            auto const it = this->m_framebuffers.find(target);
+            if(it != this->m_framebuffers.end())return it->second;
+            auto const binding = target == GL_READ_FRAMEBUFFER ? GL_READ_FRAMEBUFFER_BINDING : GL_DRAW_FRAMEBUFFER_BINDING;
+            return this->m_framebuffers[target] = this->m_queryBinding(binding);
+          }
+
+          GLuint m_getRenderbufferBinding()const{
+            return this->m_getBinding(this->m_renderbuffer,GL_RENDERBUFFER_BINDING);
+          }
+
+          GLuint m_getProgramPipelineBinding()const{
+            return this->m_getBinding(this->m_programPipeline,GL_PROGRAM_PIPELINE_BINDING);
+          }
+
+          /**
+           * @brief This function returns active texture
+           *
+           * @return GL_TEXTURE0 + active texture unit
+           */
+          GLenum m_getActiveTexture()const{
+            return this->m_getBinding(this->m_activeTexture,GL_ACTIVE_TEXTURE);
+          }
+
+          /**
+           * @brief This function returns texture bound to target of active texture unit
+           *
+           * @param target texture target (GL_TEXTURE_2D, ...)
+           *
+           * @return texture id
+           */
+          GLuint m_getTextureBinding(GLenum target)const{
+            auto const key = std::make_pair(this->m_getActiveTexture(),target);
+            auto const it  = this->m_textures.find(key);
+            if(it != this->m_textures.end())return it->second;
+            return this->m_textures[key] = this->m_queryBinding(ge::gl::textureTarget2Binding(target));
+          }
+
+          GLuint m_getSamplerBinding(GLuint unit)const{
+            auto const it = this->m_samplers.find(unit);
+            if(it != this->m_samplers.end())return it->second;
+            GLint id = 0;
+            this->glGetIntegeri_v(GL_SAMPLER_BINDING,unit,&id);
+            return this->m_samplers[unit] = static_cast<GLuint>(id);
+          }
+
+        private:
+          struct Binding{
+            bool   known = false;
+            GLuint id    = 0    ;
+          };
+          mutable Binding                                   m_vertexArray    ;
+          mutable Binding                                   m_renderbuffer   ;
+          mutable Binding                                   m_programPipeline;
+          mutable Binding                                   m_activeTexture  ;
+          mutable std::map<GLenum,GLuint>                   m_buffers        ;
+          mutable std::map<GLenum,GLuint>                   m_framebuffers   ;
+          mutable std::map<std::pair<GLenum,GLenum>,GLuint> m_textures       ;///<(active texture,target) -> texture
+          mutable std::map<GLuint,GLuint>                   m_samplers       ;
+
+          DECLARE_TRACKED(glBindBuffer            );
+          DECLARE_TRACKED(glBindBufferBase        );
+          DECLARE_TRACKED(glBindBufferRange       );
+          DECLARE_TRACKED(glDeleteBuffers         );
+          DECLARE_TRACKED(glBindVertexArray       );
+          DECLARE_TRACKED(glDeleteVertexArrays    );
+          DECLARE_TRACKED(glBindFramebuffer       );
+          DECLARE_TRACKED(glDeleteFramebuffers    );
+          DECLARE_TRACKED(glBindRenderbuffer      );
+          DECLARE_TRACKED(glDeleteRenderbuffers   );
+          DECLARE_TRACKED(glBindProgramPipeline   );
+          DECLARE_TRACKED(glDeleteProgramPipelines);
+          DECLARE_TRACKED(glActiveTexture         );
+          DECLARE_TRACKED(glBindTexture           );
+          DECLARE_TRACKED(glBindTextureUnit       );
+          DECLARE_TRACKED(glBindTextures          );
+          DECLARE_TRACKED(glDeleteTextures        );
+          DECLARE_TRACKED(glBindSampler           );
+          DECLARE_TRACKED(glBindSamplers          );
+          DECLARE_TRACKED(glDeleteSamplers        );
+
+          GLuint m_queryBinding(GLenum pname)const{
+            GLint id = 0;
+            this->glGetIntegerv(pname,&id);
+            return static_cast<GLuint>(id);
+          }
+
+          GLuint m_getBinding(Binding&binding,GLenum pname)const{
+            if(binding.known)return binding.id;
+            binding.id    = this->m_queryBinding(pname);
+            binding.known = true;
+            return binding.id;
+          }
+
+          static void m_set(Binding&binding,GLuint id){
+            binding.known = true;
+            binding.id    = id  ;
+          }
+
+          static void m_unbind(Binding&binding,GLsizei n,GLuint const*ids){
+            if(!binding.known)return;
+            for(GLsizei i=0;i<n;++i)
+              if(ids[i] == binding.id)binding.id = 0;
+          }
+
+          template<typename MAP>
+            static void m_unbind(MAP&map,GLsizei n,GLuint const*ids){
+              for(GLsizei i=0;i<n;++i)
+                for(auto&b:map)
+                  if(b.second == ids[i])b.second = 0;
+            }
+
+          template<typename MAP,typename PREDICATE>
+            static void m_eraseIf(MAP&map,PREDICATE const&predicate){
+              for(auto it = map.begin();it != map.end();){
+                if(predicate(*it))it = map.erase(it);
+                else ++it;
+              }
+            }
+
+          void m_forgetTextureUnits(GLuint first,GLsizei count)const{
+            auto const firstUnit = GL_TEXTURE0 + first;
+            auto const lastUnit  = firstUnit + static_cast<GLuint>(count);
+            m_eraseIf(this->m_textures,[&](auto const&v){return v.first.first >= firstUnit && v.first.first < lastUnit;});
+          }
+
+          void m_glBindBuffer_track(GLenum target,GLuint buffer)const{
+            CALL_TRACKED(glBindBuffer)(target,buffer);
+            this->m_buffers[target] = buffer;
+          }
+
+          void m_glBindBufferBase_track(GLenum target,GLuint index,GLuint buffer)const{
+            CALL_TRACKED(glBindBufferBase)(target,index,buffer);
+            this->m_buffers[target] = buffer;
+          }
+
+          void m_glBindBufferRange_track(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{
+            CALL_TRACKED(glBindBufferRange)(target,index,buffer,offset,size);
+            this->m_buffers[target] = buffer;
+          }
+
+          void m_glDeleteBuffers_track(GLsizei n,GLuint const*buffers)const{
+            CALL_TRACKED(glDeleteBuffers)(n,buffers);
+            m_unbind(this->m_buffers,n,buffers);
+          }
+
+          void m_glBindVertexArray_track(GLuint array)const{
+            CALL_TRACKED(glBindVertexArray)(array);
+            m_set(this->m_vertexArray,array);
+            //element array buffer binding is part of vertex array state
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+          }
+
+          void m_glDeleteVertexArrays_track(GLsizei n,GLuint const*arrays)const{
+            CALL_TRACKED(glDeleteVertexArrays)(n,arrays);
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+            m_unbind(this->m_vertexArray,n,arrays);
+          }
+
+          void m_glBindFramebuffer_track(GLenum target,GLuint framebuffer)const{
+            CALL_TRACKED(glBindFramebuffer)(target,framebuffer);
+            if(target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER)this->m_framebuffers[GL_DRAW_FRAMEBUFFER] = framebuffer;
+            if(target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER)this->m_framebuffers[GL_READ_FRAMEBUFFER] = framebuffer;
+          }
+
+          void m_glDeleteFramebuffers_track(GLsizei n,GLuint const*framebuffers)const{
+            CALL_TRACKED(glDeleteFramebuffers)(n,framebuffers);
+            m_unbind(this->m_framebuffers,n,framebuffers);
+          }
+
+          void m_glBindRenderbuffer_track(GLenum target,GLuint renderbuffer)const{
+            CALL_TRACKED(glBindRenderbuffer)(target,renderbuffer);
+            m_set(this->m_renderbuffer,renderbuffer);
+          }
+
+          void m_glDeleteRenderbuffers_track(GLsizei n,GLuint const*renderbuffers)const{
+            CALL_TRACKED(glDeleteRenderbuffers)(n,renderbuffers);
+            m_unbind(this->m_renderbuffer,n,renderbuffers);
+          }
+
+          void m_glBindProgramPipeline_track(GLuint pipeline)const{
+            CALL_TRACKED(glBindProgramPipeline)(pipeline);
+            m_set(this->m_programPipeline,pipeline);
+          }
+
+          void m_glDeleteProgramPipelines_track(GLsizei n,GLuint const*pipelines)const{
+            CALL_TRACKED(glDeleteProgramPipelines)(n,pipelines);
+            m_unbind(this->m_programPipeline,n,pipelines);
+          }
+
+          void m_glActiveTexture_track(GLenum texture)const{
+            CALL_TRACKED(glActiveTexture)(texture);
+            m_set(this->m_activeTexture,texture);
+          }
+
+          void m_glBindTexture_track(GLenum target,GLuint texture)const{
+            CALL_TRACKED(glBindTexture)(target,texture);
+            if(!this->m_activeTexture.known){
+              m_eraseIf(this->m_textures,[&](auto const&v){return v.first.second == target;});
+              return;
+            }
+            this->m_textures[std::make_pair(this->m_activeTexture.id,target)] = texture;
+          }
+
+          void m_glBindTextureUnit_track(GLuint unit,GLuint texture)const{
+            CALL_TRACKED(glBindTextureUnit)(unit,texture);
+            this->m_forgetTextureUnits(unit,1);
+          }
+
+          void m_glBindTextures_track(GLuint first,GLsizei count,GLuint const*textures)const{
+            CALL_TRACKED(glBindTextures)(first,count,textures);
+            this->m_forgetTextureUnits(first,count);
+          }
+
+          void m_glDeleteTextures_track(GLsizei n,GLuint const*textures)const{
+            CALL_TRACKED(glDeleteTextures)(n,textures);
+            m_unbind(this->m_textures,n,textures);
+          }
+
+          void m_glBindSampler_track(GLuint unit,GLuint sampler)const{
+            CALL_TRACKED(glBindSampler)(unit,sampler);
+            this->m_samplers[unit] = sampler;
+          }
+
+          void m_glBindSamplers_track(GLuint first,GLsizei count,GLuint const*samplers)const{
+            CALL_TRACKED(glBindSamplers)(first,count,samplers);
+            auto const last = first + static_cast<GLuint>(count);
+            m_eraseIf(this->m_samplers,[&](auto const&v){return v.first >= first && v.first < last;});
+          }
+
+          void m_glDeleteSamplers_track(GLsizei count,GLuint const*samplers)const{
+            CALL_TRACKED(glDeleteSamplers)(count,samplers);
+            m_unbind(this->m_samplers,count,samplers);
+          }
+      };
+  }
+}
+
+#undef TRACK_BINDING
+#undef DECLARE_TRACKED
+#undef CALL_TRACKED
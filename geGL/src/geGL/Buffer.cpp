@@ -4,11 +4,16 @@
 #include <geGL/OpenGLUtil.h>
 #include <geGL/VertexArray.h>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <vector>
 
 using namespace ge::gl;
 
+namespace {
+std::atomic<bool> driverVerification{false};
+}
+
 /**
  * @brief Empty constructor, it sets ID=0
  */
@@ -241,7 +246,7 @@ GLvoid *Buffer::map(GLbitfield access) const
   if (access == GL_READ_ONLY) a = GL_MAP_READ_BIT;
   if (access == GL_WRITE_ONLY) a = GL_MAP_WRITE_BIT;
   if (access == GL_READ_WRITE) a = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
-  return getContext().glMapNamedBufferRange(getId(), 0, getSize(), a);
+  return map(0, getSize(), a);
 }
 
 /**
@@ -255,13 +260,20 @@ GLvoid *Buffer::map(GLbitfield access) const
  */
 GLvoid *Buffer::map(GLintptr offset, GLsizeiptr size, GLbitfield access) const
 {
-  return getContext().glMapNamedBufferRange(getId(), offset, size, access);
+  auto const pointer =
+      getContext().glMapNamedBufferRange(getId(), offset, size, access);
+  impl->setMapping(pointer, offset, size, access);
+  return pointer;
 }
 
 /**
  * @brief unmaps buffer
  */
-void Buffer::unmap() const { getContext().glUnmapNamedBuffer(getId()); }
+void Buffer::unmap() const
+{
+  getContext().glUnmapNamedBuffer(getId());
+  impl->resetMapping();
+}
 
 /**
  * @brief uploads data into buffer
@@ -300,7 +312,8 @@ void Buffer::getData(GLvoid *data, GLsizeiptr size, GLintptr offset) const
  */
 GLsizeiptr Buffer::getSize() const
 {
-  return impl->getBufferParameter64(GL_BUFFER_SIZE);
+  impl->verify("GL_BUFFER_SIZE", GL_BUFFER_SIZE, impl->metadata.size);
+  return impl->metadata.size;
 }
 
 /**
@@ -310,7 +323,8 @@ GLsizeiptr Buffer::getSize() const
  */
 GLenum Buffer::getUsage() const
 {
-  return static_cast<GLenum>(impl->getBufferParameter(GL_BUFFER_USAGE));
+  impl->verify("GL_BUFFER_USAGE", GL_BUFFER_USAGE, impl->metadata.usage);
+  return impl->metadata.usage;
 }
 
 /**
@@ -320,7 +334,13 @@ GLenum Buffer::getUsage() const
  */
 GLbitfield Buffer::getAccess() const
 {
-  return static_cast<GLbitfield>(impl->getBufferParameter(GL_BUFFER_ACCESS));
+  GLenum access = GL_READ_WRITE;
+  auto const bits =
+      impl->metadata.accessFlags & (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT);
+  if (bits == GL_MAP_READ_BIT) access = GL_READ_ONLY;
+  if (bits == GL_MAP_WRITE_BIT) access = GL_WRITE_ONLY;
+  impl->verify("GL_BUFFER_ACCESS", GL_BUFFER_ACCESS, access);
+  return access;
 }
 
 /**
@@ -330,8 +350,9 @@ GLbitfield Buffer::getAccess() const
  */
 GLbitfield Buffer::getAccessFlags() const
 {
-  return static_cast<GLbitfield>(
-      impl->getBufferParameter(GL_BUFFER_ACCESS_FLAGS));
+  impl->verify("GL_BUFFER_ACCESS_FLAGS", GL_BUFFER_ACCESS_FLAGS,
+               impl->metadata.accessFlags);
+  return impl->metadata.accessFlags;
 }
 
 /**
@@ -341,7 +362,8 @@ GLbitfield Buffer::getAccessFlags() const
  */
 GLboolean Buffer::isMapped() const
 {
-  return static_cast<GLboolean>(impl->getBufferParameter(GL_BUFFER_MAPPED));
+  impl->verify("GL_BUFFER_MAPPED", GL_BUFFER_MAPPED, impl->metadata.mapped);
+  return impl->metadata.mapped;
 }
 
 /**
@@ -351,7 +373,9 @@ GLboolean Buffer::isMapped() const
  */
 GLintptr Buffer::getMapOffset() const
 {
-  return static_cast<GLintptr>(impl->getBufferParameter(GL_BUFFER_MAP_OFFSET));
+  impl->verify("GL_BUFFER_MAP_OFFSET", GL_BUFFER_MAP_OFFSET,
+               impl->metadata.mapOffset);
+  return impl->metadata.mapOffset;
 }
 
 /**
@@ -361,7 +385,9 @@ GLintptr Buffer::getMapOffset() const
  */
 GLsizeiptr Buffer::getMapSize() const
 {
-  return impl->getBufferParameter(GL_BUFFER_MAP_LENGTH);
+  impl->verify("GL_BUFFER_MAP_LENGTH", GL_BUFFER_MAP_LENGTH,
+               impl->metadata.mapSize);
+  return impl->metadata.mapSize;
 }
 
 /**
@@ -371,8 +397,9 @@ GLsizeiptr Buffer::getMapSize() const
  */
 GLboolean Buffer::isImmutable() const
 {
-  return static_cast<GLboolean>(
-      impl->getBufferParameter(GL_BUFFER_IMMUTABLE_STORAGE));
+  impl->verify("GL_BUFFER_IMMUTABLE_STORAGE", GL_BUFFER_IMMUTABLE_STORAGE,
+               impl->metadata.immutable);
+  return impl->metadata.immutable;
 }
 
 /**
@@ -382,5 +409,38 @@ GLboolean Buffer::isImmutable() const
  */
 GLvoid *Buffer::getMapPointer() const
 {
-  return impl->getBufferPointer(GL_BUFFER_MAP_POINTER);
+  impl->verifyPointer(impl->metadata.mapPointer);
+  return impl->metadata.mapPointer;
+}
+
+/**
+ * @brief gets storage flags of this buffer
+ *
+ * @return storage flags (GL_BUFFER_STORAGE_FLAGS)
+ */
+GLbitfield Buffer::getStorageFlags() const
+{
+  impl->verify("GL_BUFFER_STORAGE_FLAGS", GL_BUFFER_STORAGE_FLAGS,
+               impl->metadata.storageFlags);
+  return impl->metadata.storageFlags;
 }
+
+/**
+ * @brief Getters return parameters cached by alloc, realloc, map and unmap.
+ * If verification is enabled, every getter also queries driver and throws
+ * std::runtime_error if cached value differs (debugging of raw OpenGL calls
+ * on buffer ids).
+ *
+ * @param enabled true enables verification of all buffers
+ */
+void Buffer::setDriverVerification(bool enabled)
+{
+  driverVerification = enabled;
+}
+
+/**
+ * @brief is verification of cached parameters enabled
+ *
+ * @return true if getters compare cached parameters with driver
+ */
+bool Buffer::isDriverVerificationEnabled() { return driverVerification; }
@@ -67,6 +67,9 @@ class GEGL_EXPORT ge::gl::Buffer : public OpenGLObject {
   GLsizeiptr getMapSize() const;
   GLvoid*    getMapPointer() const;
   GLboolean  isImmutable() const;
+  GLbitfield getStorageFlags() const;
+  static void setDriverVerification(bool enabled);
+  static bool isDriverVerificationEnabled();
 
   template <typename T>
   Buffer(std::vector<T> const& data, GLbitfield flags = GL_STATIC_DRAW);
@@ -83,6 +86,7 @@ class GEGL_EXPORT ge::gl::Buffer : public OpenGLObject {
   BufferImpl* impl = nullptr;
   friend class VertexArray;
   friend class VertexArrayImpl;
+  friend class BufferImpl;
 };
 
 template <typename T>
@@ -0,0 +1,213 @@
+#include <geGL/BufferArena.h>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+/**
+ * @brief Constructor
+ *
+ * @param pageSize size of buffers that are shared by allocations
+ * @param flags storage flags of buffers (immutable storage)
+ */
+BufferArena::BufferArena(GLsizeiptr pageSize, GLbitfield flags)
+    : BufferArena(nullptr, pageSize, flags)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param pageSize size of buffers that are shared by allocations
+ * @param flags storage flags of buffers (immutable storage), allocate with data
+ * requires GL_DYNAMIC_STORAGE_BIT
+ */
+BufferArena::BufferArena(FunctionTablePointer const &table,
+                         GLsizeiptr                  pageSize,
+                         GLbitfield                  flags)
+    : table(table), pageSize(pageSize), flags(flags)
+{
+  if (pageSize <= 0)
+    throw std::invalid_argument(
+        "geGL: BufferArena - page size has to be positive");
+}
+
+BufferArena::~BufferArena() {}
+
+/**
+ * @brief Allocates range of one of the buffers
+ *
+ * @param size size of range in bytes
+ * @param alignment alignment of offset (e.g. size of vertex attribute)
+ * @param data optional data that are uploaded into range
+ *
+ * @return buffer, offset and size of range
+ */
+BufferSuballocation BufferArena::allocate(GLsizeiptr    size,
+                                          GLsizeiptr    alignment,
+                                          GLvoid const *data)
+{
+  assert(this != nullptr);
+  if (size <= 0)
+    throw std::invalid_argument(
+        "geGL: BufferArena::allocate - size has to be positive");
+  if (alignment <= 0) alignment = 1;
+
+  size_t offset = RangeAllocator::INVALID;
+  Page * page   = nullptr;
+  for (auto &p : pages) {
+    offset = p.allocator.allocate(static_cast<size_t>(size),
+                                  static_cast<size_t>(alignment));
+    if (offset == RangeAllocator::INVALID) continue;
+    page = &p;
+    break;
+  }
+  if (!page) {
+    auto const newSize = std::max(size, pageSize);
+    Page       p;
+    p.buffer = std::make_shared<Buffer>(table, newSize, nullptr, flags);
+    p.allocator = RangeAllocator(static_cast<size_t>(newSize));
+    pages.push_back(p);
+    page   = &pages.back();
+    offset = page->allocator.allocate(static_cast<size_t>(size),
+                                      static_cast<size_t>(alignment));
+  }
+
+  BufferSuballocation result;
+  result.buffer = page->buffer.get();
+  result.offset = static_cast<GLintptr>(offset);
+  result.size   = size;
+  if (data) result.buffer->setData(data, size, result.offset);
+  return result;
+}
+
+/**
+ * @brief Frees range, buffers are kept (see releaseEmptyBuffers)
+ *
+ * @param allocation range returned by allocate
+ */
+void BufferArena::free(BufferSuballocation const &allocation)
+{
+  assert(this != nullptr);
+  findPage(allocation.buffer)
+      .allocator.free(static_cast<size_t>(allocation.offset));
+}
+
+/**
+ * @brief Packs allocations of every buffer to its beginning.
+ * Data are copied on GPU, allocations stay in their buffers.
+ * Attribs of vertex arrays are not updated, callback has to rebind them.
+ *
+ * @param onMove callback that is called for every relocated range
+ *
+ * @return number of relocated ranges
+ */
+size_t BufferArena::defragment(MoveCallback const &onMove)
+{
+  assert(this != nullptr);
+  size_t moved = 0;
+  for (auto &page : pages) {
+    for (auto const &m : page.allocator.compact()) {
+      move(page, m);
+      moved++;
+      if (!onMove) continue;
+      BufferSuballocation from, to;
+      from.buffer = to.buffer = page.buffer.get();
+      from.size = to.size = static_cast<GLsizeiptr>(m.size);
+      from.offset         = static_cast<GLintptr>(m.from);
+      to.offset           = static_cast<GLintptr>(m.to);
+      onMove(from, to);
+    }
+  }
+  staging = nullptr;
+  return moved;
+}
+
+/**
+ * @brief Deletes buffers without allocations
+ *
+ * @return number of deleted buffers
+ */
+size_t BufferArena::releaseEmptyBuffers()
+{
+  assert(this != nullptr);
+  auto const oldSize = pages.size();
+  pages.erase(std::remove_if(pages.begin(), pages.end(),
+                             [](Page const &p) {
+                               return p.allocator.getNofAllocations() == 0;
+                             }),
+              pages.end());
+  return oldSize - pages.size();
+}
+
+size_t BufferArena::getNofBuffers() const { return pages.size(); }
+
+Buffer *BufferArena::getBuffer(size_t i) const
+{
+  return pages.at(i).buffer.get();
+}
+
+GLsizeiptr BufferArena::getPageSize() const { return pageSize; }
+
+/**
+ * @brief gets usage statistics of all buffers
+ *
+ * @return statistics
+ */
+BufferArena::Statistics BufferArena::getStatistics() const
+{
+  Statistics s;
+  s.nofBuffers = pages.size();
+  s.nofMoves   = nofMoves;
+  s.movedBytes = movedBytes;
+  for (auto const &p : pages) {
+    auto const a = p.allocator.getStatistics();
+    s.nofAllocations += a.nofAllocations;
+    s.nofFreeRanges += a.nofFreeRanges;
+    s.capacity += static_cast<GLsizeiptr>(a.capacity);
+    s.used += static_cast<GLsizeiptr>(a.used);
+    s.largestFreeRange =
+        std::max(s.largestFreeRange, static_cast<GLsizeiptr>(a.largestFreeRange));
+  }
+  auto const freeBytes = s.capacity - s.used;
+  if (freeBytes > 0)
+    s.fragmentation = 1.f - static_cast<float>(s.largestFreeRange) /
+                                static_cast<float>(freeBytes);
+  return s;
+}
+
+BufferArena::Page &BufferArena::findPage(Buffer const *buffer)
+{
+  for (auto &p : pages)
+    if (p.buffer.get() == buffer) return p;
+  throw std::invalid_argument(
+      "geGL: BufferArena - buffer does not belong to arena");
+}
+
+/**
+ * @brief Copies range inside buffer, overlapping ranges are copied through
+ * staging buffer
+ *
+ * @param page buffer
+ * @param m relocation
+ */
+void BufferArena::move(Page &page, RangeAllocator::Move const &m)
+{
+  auto const &gl     = page.buffer->getContext();
+  auto const  id     = page.buffer->getId();
+  auto const  size   = static_cast<GLsizeiptr>(m.size);
+  auto const  from   = static_cast<GLintptr>(m.from);
+  auto const  to     = static_cast<GLintptr>(m.to);
+  nofMoves++;
+  movedBytes += size;
+  if (to + size <= from) {
+    gl.glCopyNamedBufferSubData(id, id, from, to, size);
+    return;
+  }
+  if (!staging || staging->getSize() < size)
+    staging = std::make_shared<Buffer>(table, size, nullptr, 0);
+  gl.glCopyNamedBufferSubData(id, staging->getId(), from, 0, size);
+  gl.glCopyNamedBufferSubData(staging->getId(), id, 0, to, size);
+}
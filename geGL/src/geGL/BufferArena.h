@@ -0,0 +1,79 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <geGL/RangeAllocator.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Range of buffer handed out by BufferArena.
+ * It can be passed directly to VertexArray::addAttrib or used with bindRange.
+ */
+struct ge::gl::BufferSuballocation {
+  Buffer*    buffer = nullptr;  ///< buffer that contains the range
+  GLintptr   offset = 0;        ///< offset of range in bytes
+  GLsizeiptr size   = 0;        ///< size of range in bytes
+};
+
+/**
+ * @brief Sub-allocator that shares a few large immutable buffers among many
+ * small allocations (meshes, attributes, ...).
+ *
+ * Every buffer (page) is managed by RangeAllocator. If no page has enough
+ * space, new page is created, allocations larger than page size get their own
+ * page. defragment() packs every page and reports relocated ranges through
+ * callback, so users can update vertex arrays and their own handles.
+ */
+class GEGL_EXPORT ge::gl::BufferArena {
+ public:
+  using MoveCallback = std::function<void(BufferSuballocation const& from,
+                                          BufferSuballocation const& to)>;
+  /**
+   * @brief Usage statistics summed over all pages
+   */
+  struct Statistics {
+    size_t     nofBuffers       = 0;    ///< number of pages
+    size_t     nofAllocations   = 0;    ///< number of live allocations
+    size_t     nofFreeRanges    = 0;    ///< number of free ranges
+    GLsizeiptr capacity         = 0;    ///< size of all pages in bytes
+    GLsizeiptr used             = 0;    ///< allocated bytes
+    GLsizeiptr largestFreeRange = 0;    ///< largest free range of all pages
+    size_t     nofMoves         = 0;    ///< allocations moved by defragment
+    GLsizeiptr movedBytes       = 0;    ///< bytes copied by defragment
+    float      fragmentation    = 0.f;  ///< 1 - largestFreeRange / free bytes
+  };
+  BufferArena(GLsizeiptr pageSize = 64 * 1024 * 1024,
+              GLbitfield flags    = GL_DYNAMIC_STORAGE_BIT);
+  BufferArena(FunctionTablePointer const& table,
+              GLsizeiptr                  pageSize = 64 * 1024 * 1024,
+              GLbitfield                  flags    = GL_DYNAMIC_STORAGE_BIT);
+  ~BufferArena();
+  BufferArena(BufferArena const&) = delete;
+  BufferArena& operator=(BufferArena const&) = delete;
+  BufferSuballocation allocate(GLsizeiptr    size,
+                               GLsizeiptr    alignment = 1,
+                               GLvoid const* data      = nullptr);
+  void   free(BufferSuballocation const& allocation);
+  size_t defragment(MoveCallback const& onMove = nullptr);
+  size_t releaseEmptyBuffers();
+  size_t getNofBuffers() const;
+  Buffer* getBuffer(size_t i) const;
+  GLsizeiptr getPageSize() const;
+  Statistics getStatistics() const;
+
+ protected:
+  struct Page {
+    std::shared_ptr<Buffer> buffer;
+    RangeAllocator          allocator;
+  };
+  Page& findPage(Buffer const* buffer);
+  void  move(Page& page, RangeAllocator::Move const& m);
+  FunctionTablePointer    table;
+  GLsizeiptr              pageSize = 0;
+  GLbitfield              flags    = 0;
+  std::vector<Page>       pages;
+  std::shared_ptr<Buffer> staging;  ///< temporary storage of overlapping moves
+  size_t                  nofMoves   = 0;
+  GLsizeiptr              movedBytes = 0;
+};
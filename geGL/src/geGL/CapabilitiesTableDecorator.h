@@ -26,620 +26,620 @@ namespace ge{
             this->capabilities.opengl450 = false;
 
             this->capabilities.opengl200 = true;
-            if(!this->m_ptr_glBlendEquationSeparate)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glDrawBuffers)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glStencilOpSeparate)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glStencilFuncSeparate)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glStencilMaskSeparate)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glAttachShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glBindAttribLocation)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glCompileShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glCreateProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glCreateShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glDeleteProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glDeleteShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glDetachShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glDisableVertexAttribArray)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glEnableVertexAttribArray)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetActiveAttrib)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetActiveUniform)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetAttachedShaders)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetAttribLocation)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetProgramiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetProgramInfoLog)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetShaderiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetShaderInfoLog)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetShaderSource)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetUniformLocation)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetUniformfv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetUniformiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetVertexAttribdv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetVertexAttribfv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetVertexAttribiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glGetVertexAttribPointerv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glIsProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glIsShader)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glLinkProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glShaderSource)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUseProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform1f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform2f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform3f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform4f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform1i)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform2i)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform3i)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform4i)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform1fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform2fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform3fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform4fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform1iv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform2iv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform3iv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniform4iv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniformMatrix2fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniformMatrix3fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glUniformMatrix4fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glValidateProgram)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1d)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1dv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1s)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib1sv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2d)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2dv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2s)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib2sv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3d)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3dv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3s)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib3sv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nbv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Niv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nsv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nub)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nubv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nuiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4Nusv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4bv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4d)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4dv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4f)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4fv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4iv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4s)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4sv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4ubv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4uiv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttrib4usv)this->capabilities.opengl200 = false;
-            if(!this->m_ptr_glVertexAttribPointer)this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlendEquationSeparate))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawBuffers))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glStencilOpSeparate))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glStencilFuncSeparate))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glStencilMaskSeparate))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glAttachShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindAttribLocation))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCompileShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDetachShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDisableVertexAttribArray))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEnableVertexAttribArray))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveAttrib))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveUniform))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetAttachedShaders))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetAttribLocation))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramInfoLog))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetShaderiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetShaderInfoLog))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetShaderSource))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformLocation))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformfv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribdv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribfv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribPointerv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsShader))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glLinkProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glShaderSource))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUseProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1i))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2i))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3i))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4i))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1iv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2iv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3iv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4iv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glValidateProgram))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1d))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1dv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1s))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib1sv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2d))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2dv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2s))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib2sv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3d))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3dv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3s))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib3sv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nbv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Niv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nsv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nub))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nubv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nuiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4Nusv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4bv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4d))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4dv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4f))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4fv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4iv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4s))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4sv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4ubv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4uiv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttrib4usv))this->capabilities.opengl200 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribPointer))this->capabilities.opengl200 = false;
 
             this->capabilities.opengl210 = this->capabilities.opengl200;
-            if(!this->m_ptr_glUniformMatrix2x3fv)this->capabilities.opengl210 = false;
-            if(!this->m_ptr_glUniformMatrix3x2fv)this->capabilities.opengl210 = false;
-            if(!this->m_ptr_glUniformMatrix2x4fv)this->capabilities.opengl210 = false;
-            if(!this->m_ptr_glUniformMatrix4x2fv)this->capabilities.opengl210 = false;
-            if(!this->m_ptr_glUniformMatrix3x4fv)this->capabilities.opengl210 = false;
-            if(!this->m_ptr_glUniformMatrix4x3fv)this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2x3fv))this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3x2fv))this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2x4fv))this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4x2fv))this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3x4fv))this->capabilities.opengl210 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4x3fv))this->capabilities.opengl210 = false;
 
             this->capabilities.opengl300 = this->capabilities.opengl200;
-            if(!this->m_ptr_glColorMaski)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetBooleani_v)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetIntegeri_v)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glEnablei)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glDisablei)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glIsEnabledi)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBeginTransformFeedback)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glEndTransformFeedback)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindBufferRange)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindBufferBase)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glTransformFeedbackVaryings)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetTransformFeedbackVarying)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glClampColor)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBeginConditionalRender)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glEndConditionalRender)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribIPointer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetVertexAttribIiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetVertexAttribIuiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI1i)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI2i)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI3i)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4i)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI1ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI2ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI3ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI1iv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI2iv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI3iv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4iv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI1uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI2uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI3uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4bv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4sv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4ubv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glVertexAttribI4usv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetUniformuiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindFragDataLocation)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetFragDataLocation)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform1ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform2ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform3ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform4ui)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform1uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform2uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform3uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glUniform4uiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glTexParameterIiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glTexParameterIuiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetTexParameterIiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetTexParameterIuiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glClearBufferiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glClearBufferuiv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glClearBufferfv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glClearBufferfi)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetStringi)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glIsRenderbuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindRenderbuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glDeleteRenderbuffers)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGenRenderbuffers)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glRenderbufferStorage)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetRenderbufferParameteriv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glIsFramebuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindFramebuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glDeleteFramebuffers)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGenFramebuffers)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glCheckFramebufferStatus)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFramebufferTexture1D)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFramebufferTexture2D)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFramebufferTexture3D)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFramebufferRenderbuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGetFramebufferAttachmentParameteriv)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGenerateMipmap)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBlitFramebuffer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glRenderbufferStorageMultisample)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFramebufferTextureLayer)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glMapBufferRange)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glFlushMappedBufferRange)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glBindVertexArray)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glDeleteVertexArrays)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glGenVertexArrays)this->capabilities.opengl300 = false;
-            if(!this->m_ptr_glIsVertexArray)this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glColorMaski))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetBooleani_v))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetIntegeri_v))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEnablei))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDisablei))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsEnabledi))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBeginTransformFeedback))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEndTransformFeedback))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindBufferRange))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindBufferBase))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTransformFeedbackVaryings))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTransformFeedbackVarying))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClampColor))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBeginConditionalRender))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEndConditionalRender))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribIPointer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribIiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribIuiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI1i))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI2i))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI3i))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4i))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI1ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI2ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI3ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI1iv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI2iv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI3iv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4iv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI1uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI2uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI3uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4bv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4sv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4ubv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribI4usv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformuiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindFragDataLocation))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetFragDataLocation))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4ui))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4uiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexParameterIiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexParameterIuiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTexParameterIiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTexParameterIuiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferuiv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferfv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferfi))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetStringi))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsRenderbuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindRenderbuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteRenderbuffers))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenRenderbuffers))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glRenderbufferStorage))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetRenderbufferParameteriv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsFramebuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindFramebuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteFramebuffers))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenFramebuffers))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCheckFramebufferStatus))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferTexture1D))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferTexture2D))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferTexture3D))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferRenderbuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetFramebufferAttachmentParameteriv))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenerateMipmap))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlitFramebuffer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glRenderbufferStorageMultisample))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferTextureLayer))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMapBufferRange))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFlushMappedBufferRange))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindVertexArray))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteVertexArrays))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenVertexArrays))this->capabilities.opengl300 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsVertexArray))this->capabilities.opengl300 = false;
 
             this->capabilities.opengl310 = this->capabilities.opengl300;
-            if(!this->m_ptr_glDrawArraysInstanced)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glDrawElementsInstanced)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glTexBuffer)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glPrimitiveRestartIndex)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glCopyBufferSubData)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetUniformIndices)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetActiveUniformsiv)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetActiveUniformName)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetUniformBlockIndex)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetActiveUniformBlockiv)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glGetActiveUniformBlockName)this->capabilities.opengl310 = false;
-            if(!this->m_ptr_glUniformBlockBinding)this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawArraysInstanced))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsInstanced))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexBuffer))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPrimitiveRestartIndex))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyBufferSubData))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformIndices))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveUniformsiv))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveUniformName))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformBlockIndex))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveUniformBlockiv))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveUniformBlockName))this->capabilities.opengl310 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformBlockBinding))this->capabilities.opengl310 = false;
 
             this->capabilities.opengl320 = this->capabilities.opengl310;
-            if(!this->m_ptr_glDrawElementsBaseVertex)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glDrawRangeElementsBaseVertex)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glDrawElementsInstancedBaseVertex)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glMultiDrawElementsBaseVertex)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glProvokingVertex)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glFenceSync)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glIsSync)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glDeleteSync)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glClientWaitSync)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glWaitSync)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glGetInteger64v)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glGetSynciv)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glGetInteger64i_v)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glGetBufferParameteri64v)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glFramebufferTexture)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glTexImage2DMultisample)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glTexImage3DMultisample)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glGetMultisamplefv)this->capabilities.opengl320 = false;
-            if(!this->m_ptr_glSampleMaski)this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsBaseVertex))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawRangeElementsBaseVertex))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsInstancedBaseVertex))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiDrawElementsBaseVertex))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProvokingVertex))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFenceSync))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsSync))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteSync))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClientWaitSync))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glWaitSync))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetInteger64v))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSynciv))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetInteger64i_v))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetBufferParameteri64v))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferTexture))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexImage2DMultisample))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexImage3DMultisample))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetMultisamplefv))this->capabilities.opengl320 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSampleMaski))this->capabilities.opengl320 = false;
 
             this->capabilities.opengl330 = this->capabilities.opengl320;
-            if(!this->m_ptr_glBindFragDataLocationIndexed)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetFragDataIndex)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGenSamplers)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glDeleteSamplers)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glIsSampler)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glBindSampler)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameteri)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameteriv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameterf)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameterfv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameterIiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSamplerParameterIuiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetSamplerParameteriv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetSamplerParameterIiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetSamplerParameterfv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetSamplerParameterIuiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glQueryCounter)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetQueryObjecti64v)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glGetQueryObjectui64v)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribDivisor)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP1ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP1uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP2ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP2uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP4ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexAttribP4uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP2ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP2uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP4ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glVertexP4uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP1ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP1uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP2ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP2uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP4ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glTexCoordP4uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP1ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP1uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP2ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP2uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP4ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glMultiTexCoordP4uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glNormalP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glNormalP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glColorP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glColorP3uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glColorP4ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glColorP4uiv)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSecondaryColorP3ui)this->capabilities.opengl330 = false;
-            if(!this->m_ptr_glSecondaryColorP3uiv)this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindFragDataLocationIndexed))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetFragDataIndex))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenSamplers))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteSamplers))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsSampler))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindSampler))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameteri))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameteriv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameterf))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameterfv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameterIiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSamplerParameterIuiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSamplerParameteriv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSamplerParameterIiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSamplerParameterfv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSamplerParameterIuiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glQueryCounter))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryObjecti64v))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryObjectui64v))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribDivisor))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP1ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP1uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP2ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP2uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP4ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribP4uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP2ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP2uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP4ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexP4uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP1ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP1uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP2ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP2uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP4ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexCoordP4uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP1ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP1uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP2ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP2uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP4ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiTexCoordP4uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNormalP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNormalP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glColorP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glColorP3uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glColorP4ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glColorP4uiv))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSecondaryColorP3ui))this->capabilities.opengl330 = false;
+            if(!this->m_isAvailable(this->m_ptr_glSecondaryColorP3uiv))this->capabilities.opengl330 = false;
 
             this->capabilities.opengl400 = this->capabilities.opengl330;
-            if(!this->m_ptr_glMinSampleShading)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBlendEquationi)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBlendEquationSeparatei)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBlendFunci)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBlendFuncSeparatei)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glDrawArraysIndirect)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glDrawElementsIndirect)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform1d)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform2d)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform3d)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform4d)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform1dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform2dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform3dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniform4dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix2dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix3dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix4dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix2x3dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix2x4dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix3x2dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix3x4dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix4x2dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformMatrix4x3dv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetUniformdv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetSubroutineUniformLocation)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetSubroutineIndex)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetActiveSubroutineUniformiv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetActiveSubroutineUniformName)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetActiveSubroutineName)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glUniformSubroutinesuiv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetUniformSubroutineuiv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetProgramStageiv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glPatchParameteri)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glPatchParameterfv)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBindTransformFeedback)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glDeleteTransformFeedbacks)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGenTransformFeedbacks)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glIsTransformFeedback)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glPauseTransformFeedback)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glResumeTransformFeedback)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glDrawTransformFeedback)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glDrawTransformFeedbackStream)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glBeginQueryIndexed)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glEndQueryIndexed)this->capabilities.opengl400 = false;
-            if(!this->m_ptr_glGetQueryIndexediv)this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMinSampleShading))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlendEquationi))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlendEquationSeparatei))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlendFunci))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlendFuncSeparatei))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawArraysIndirect))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsIndirect))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1d))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2d))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3d))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4d))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform1dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform2dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform3dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniform4dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2x3dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix2x4dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3x2dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix3x4dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4x2dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformMatrix4x3dv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformdv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSubroutineUniformLocation))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetSubroutineIndex))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveSubroutineUniformiv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveSubroutineUniformName))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveSubroutineName))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUniformSubroutinesuiv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetUniformSubroutineuiv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramStageiv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPatchParameteri))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPatchParameterfv))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindTransformFeedback))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteTransformFeedbacks))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenTransformFeedbacks))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsTransformFeedback))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPauseTransformFeedback))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glResumeTransformFeedback))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawTransformFeedback))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawTransformFeedbackStream))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBeginQueryIndexed))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEndQueryIndexed))this->capabilities.opengl400 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryIndexediv))this->capabilities.opengl400 = false;
 
             this->capabilities.opengl410 = this->capabilities.opengl400;
-            if(!this->m_ptr_glReleaseShaderCompiler)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glShaderBinary)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetShaderPrecisionFormat)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glDepthRangef)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glClearDepthf)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetProgramBinary)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramBinary)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramParameteri)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glUseProgramStages)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glActiveShaderProgram)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glCreateShaderProgramv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glBindProgramPipeline)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glDeleteProgramPipelines)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGenProgramPipelines)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glIsProgramPipeline)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetProgramPipelineiv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1i)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1iv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1f)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1ui)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform1uiv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2i)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2iv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2f)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2ui)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform2uiv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3i)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3iv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3f)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3ui)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform3uiv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4i)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4iv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4f)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4ui)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniform4uiv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2x3fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3x2fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2x4fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4x2fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3x4fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4x3fv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2x3dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3x2dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix2x4dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4x2dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix3x4dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glProgramUniformMatrix4x3dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glValidateProgramPipeline)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetProgramPipelineInfoLog)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL1d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL2d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL3d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL4d)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL1dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL2dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL3dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribL4dv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glVertexAttribLPointer)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetVertexAttribLdv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glViewportArrayv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glViewportIndexedf)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glViewportIndexedfv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glScissorArrayv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glScissorIndexed)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glScissorIndexedv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glDepthRangeArrayv)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glDepthRangeIndexed)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetFloati_v)this->capabilities.opengl410 = false;
-            if(!this->m_ptr_glGetDoublei_v)this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glReleaseShaderCompiler))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glShaderBinary))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetShaderPrecisionFormat))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDepthRangef))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearDepthf))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramBinary))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramBinary))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramParameteri))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUseProgramStages))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glActiveShaderProgram))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateShaderProgramv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindProgramPipeline))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDeleteProgramPipelines))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenProgramPipelines))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glIsProgramPipeline))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramPipelineiv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1i))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1iv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1f))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1ui))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform1uiv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2i))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2iv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2f))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2ui))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform2uiv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3i))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3iv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3f))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3ui))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform3uiv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4i))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4iv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4f))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4ui))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniform4uiv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2x3fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3x2fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2x4fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4x2fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3x4fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4x3fv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2x3dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3x2dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix2x4dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4x2dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix3x4dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glProgramUniformMatrix4x3dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glValidateProgramPipeline))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramPipelineInfoLog))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL1d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL2d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL3d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL4d))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL1dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL2dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL3dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribL4dv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribLPointer))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexAttribLdv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glViewportArrayv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glViewportIndexedf))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glViewportIndexedfv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glScissorArrayv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glScissorIndexed))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glScissorIndexedv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDepthRangeArrayv))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDepthRangeIndexed))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetFloati_v))this->capabilities.opengl410 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetDoublei_v))this->capabilities.opengl410 = false;
 
             this->capabilities.opengl420 = this->capabilities.opengl410;
-            if(!this->m_ptr_glDrawArraysInstancedBaseInstance)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glDrawElementsInstancedBaseInstance)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glGetInternalformativ)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glGetActiveAtomicCounterBufferiv)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glBindImageTexture)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glMemoryBarrier)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glTexStorage1D)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glTexStorage2D)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glTexStorage3D)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glDrawTransformFeedbackInstanced)this->capabilities.opengl420 = false;
-            if(!this->m_ptr_glDrawTransformFeedbackStreamInstanced)this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawArraysInstancedBaseInstance))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsInstancedBaseInstance))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetInternalformativ))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetActiveAtomicCounterBufferiv))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindImageTexture))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMemoryBarrier))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexStorage1D))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexStorage2D))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexStorage3D))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawTransformFeedbackInstanced))this->capabilities.opengl420 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDrawTransformFeedbackStreamInstanced))this->capabilities.opengl420 = false;
 
             this->capabilities.opengl430 = this->capabilities.opengl420;
-            if(!this->m_ptr_glClearBufferData)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glClearBufferSubData)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glDispatchCompute)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glDispatchComputeIndirect)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glCopyImageSubData)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glFramebufferParameteri)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetFramebufferParameteriv)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetInternalformati64v)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateTexSubImage)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateTexImage)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateBufferSubData)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateBufferData)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateFramebuffer)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glInvalidateSubFramebuffer)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glMultiDrawArraysIndirect)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glMultiDrawElementsIndirect)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramInterfaceiv)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramResourceIndex)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramResourceName)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramResourceiv)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramResourceLocation)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetProgramResourceLocationIndex)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glShaderStorageBlockBinding)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glTexBufferRange)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glTexStorage2DMultisample)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glTexStorage3DMultisample)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glTextureView)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glBindVertexBuffer)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glVertexAttribFormat)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glVertexAttribIFormat)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glVertexAttribLFormat)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glVertexAttribBinding)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glVertexBindingDivisor)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glDebugMessageControl)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glDebugMessageInsert)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glDebugMessageCallback)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetDebugMessageLog)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glPushDebugGroup)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glPopDebugGroup)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glObjectLabel)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetObjectLabel)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glObjectPtrLabel)this->capabilities.opengl430 = false;
-            if(!this->m_ptr_glGetObjectPtrLabel)this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferData))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearBufferSubData))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDispatchCompute))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDispatchComputeIndirect))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyImageSubData))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFramebufferParameteri))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetFramebufferParameteriv))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetInternalformati64v))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateTexSubImage))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateTexImage))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateBufferSubData))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateBufferData))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateFramebuffer))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateSubFramebuffer))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiDrawArraysIndirect))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMultiDrawElementsIndirect))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramInterfaceiv))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramResourceIndex))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramResourceName))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramResourceiv))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramResourceLocation))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetProgramResourceLocationIndex))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glShaderStorageBlockBinding))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexBufferRange))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexStorage2DMultisample))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTexStorage3DMultisample))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureView))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindVertexBuffer))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribFormat))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribIFormat))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribLFormat))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexAttribBinding))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexBindingDivisor))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDebugMessageControl))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDebugMessageInsert))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDebugMessageCallback))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetDebugMessageLog))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPushDebugGroup))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glPopDebugGroup))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glObjectLabel))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetObjectLabel))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glObjectPtrLabel))this->capabilities.opengl430 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetObjectPtrLabel))this->capabilities.opengl430 = false;
 
             this->capabilities.opengl440 = this->capabilities.opengl430;
-            if(!this->m_ptr_glBufferStorage)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glClearTexImage)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glClearTexSubImage)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindBuffersBase)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindBuffersRange)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindTextures)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindSamplers)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindImageTextures)this->capabilities.opengl440 = false;
-            if(!this->m_ptr_glBindVertexBuffers)this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBufferStorage))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearTexImage))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearTexSubImage))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindBuffersBase))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindBuffersRange))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindTextures))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindSamplers))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindImageTextures))this->capabilities.opengl440 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindVertexBuffers))this->capabilities.opengl440 = false;
 
             this->capabilities.opengl450 = this->capabilities.opengl440;
-            if(!this->m_ptr_glClipControl)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateTransformFeedbacks)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTransformFeedbackBufferBase)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTransformFeedbackBufferRange)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTransformFeedbackiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTransformFeedbacki_v)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTransformFeedbacki64_v)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateBuffers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedBufferStorage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedBufferData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedBufferSubData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCopyNamedBufferSubData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedBufferData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedBufferSubData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glMapNamedBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glMapNamedBufferRange)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glUnmapNamedBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glFlushMappedNamedBufferRange)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedBufferParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedBufferParameteri64v)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedBufferPointerv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedBufferSubData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateFramebuffers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferRenderbuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferParameteri)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferTexture)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferTextureLayer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferDrawBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferDrawBuffers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedFramebufferReadBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glInvalidateNamedFramebufferData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glInvalidateNamedFramebufferSubData)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedFramebufferiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedFramebufferuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedFramebufferfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glClearNamedFramebufferfi)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glBlitNamedFramebuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCheckNamedFramebufferStatus)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedFramebufferParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedFramebufferAttachmentParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateRenderbuffers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedRenderbufferStorage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glNamedRenderbufferStorageMultisample)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetNamedRenderbufferParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateTextures)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureBufferRange)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureStorage1D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureStorage2D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureStorage3D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureStorage2DMultisample)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureStorage3DMultisample)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureSubImage1D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureSubImage2D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureSubImage3D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCompressedTextureSubImage1D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCompressedTextureSubImage2D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCompressedTextureSubImage3D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCopyTextureSubImage1D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCopyTextureSubImage2D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCopyTextureSubImage3D)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameterf)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameterfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameteri)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameterIiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameterIuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGenerateTextureMipmap)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glBindTextureUnit)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetCompressedTextureImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureLevelParameterfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureLevelParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureParameterfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureParameterIiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureParameterIuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureParameteriv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateVertexArrays)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glDisableVertexArrayAttrib)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glEnableVertexArrayAttrib)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayElementBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayVertexBuffer)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayVertexBuffers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayAttribBinding)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayAttribFormat)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayAttribIFormat)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayAttribLFormat)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glVertexArrayBindingDivisor)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetVertexArrayiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetVertexArrayIndexediv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetVertexArrayIndexed64iv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateSamplers)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateProgramPipelines)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glCreateQueries)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetQueryBufferObjecti64v)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetQueryBufferObjectiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetQueryBufferObjectui64v)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetQueryBufferObjectuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glMemoryBarrierByRegion)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetTextureSubImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetCompressedTextureSubImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetGraphicsResetStatus)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnCompressedTexImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnTexImage)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnUniformdv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnUniformfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnUniformiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnUniformuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glReadnPixels)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnMapdv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnMapfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnMapiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnPixelMapfv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnPixelMapuiv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnPixelMapusv)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnPolygonStipple)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnColorTable)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnConvolutionFilter)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnSeparableFilter)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnHistogram)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glGetnMinmax)this->capabilities.opengl450 = false;
-            if(!this->m_ptr_glTextureBarrier)this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClipControl))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateTransformFeedbacks))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTransformFeedbackBufferBase))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTransformFeedbackBufferRange))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTransformFeedbackiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTransformFeedbacki_v))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTransformFeedbacki64_v))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateBuffers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedBufferStorage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedBufferData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedBufferSubData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyNamedBufferSubData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedBufferData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedBufferSubData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMapNamedBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMapNamedBufferRange))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glUnmapNamedBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glFlushMappedNamedBufferRange))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedBufferParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedBufferParameteri64v))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedBufferPointerv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedBufferSubData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateFramebuffers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferRenderbuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferParameteri))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferTexture))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferTextureLayer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferDrawBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferDrawBuffers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedFramebufferReadBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateNamedFramebufferData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glInvalidateNamedFramebufferSubData))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedFramebufferiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedFramebufferuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedFramebufferfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glClearNamedFramebufferfi))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBlitNamedFramebuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCheckNamedFramebufferStatus))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedFramebufferParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateRenderbuffers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedRenderbufferStorage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glNamedRenderbufferStorageMultisample))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetNamedRenderbufferParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateTextures))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureBufferRange))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureStorage1D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureStorage2D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureStorage3D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureStorage2DMultisample))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureStorage3DMultisample))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureSubImage1D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureSubImage2D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureSubImage3D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCompressedTextureSubImage1D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCompressedTextureSubImage2D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCompressedTextureSubImage3D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyTextureSubImage1D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyTextureSubImage2D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCopyTextureSubImage3D))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameterf))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameterfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameteri))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameterIiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameterIuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGenerateTextureMipmap))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glBindTextureUnit))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetCompressedTextureImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureLevelParameterfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureLevelParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureParameterfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureParameterIiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureParameterIuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureParameteriv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateVertexArrays))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glDisableVertexArrayAttrib))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glEnableVertexArrayAttrib))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayElementBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayVertexBuffer))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayVertexBuffers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayAttribBinding))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayAttribFormat))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayAttribIFormat))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayAttribLFormat))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glVertexArrayBindingDivisor))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexArrayiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexArrayIndexediv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetVertexArrayIndexed64iv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateSamplers))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateProgramPipelines))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glCreateQueries))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryBufferObjecti64v))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryBufferObjectiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryBufferObjectui64v))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetQueryBufferObjectuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glMemoryBarrierByRegion))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetTextureSubImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetCompressedTextureSubImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetGraphicsResetStatus))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnCompressedTexImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnTexImage))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnUniformdv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnUniformfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnUniformiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnUniformuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glReadnPixels))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnMapdv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnMapfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnMapiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnPixelMapfv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnPixelMapuiv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnPixelMapusv))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnPolygonStipple))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnColorTable))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnConvolutionFilter))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnSeparableFilter))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnHistogram))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glGetnMinmax))this->capabilities.opengl450 = false;
+            if(!this->m_isAvailable(this->m_ptr_glTextureBarrier))this->capabilities.opengl450 = false;
             return true;
           }
       };
@@ -0,0 +1,374 @@
+#include<geGL/CaptureStream.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLUtil.h>
+#include<chrono>
+#include<deque>
+#include<fstream>
+#include<map>
+#include<stdexcept>
+
+using namespace ge::gl;
+
+/**
+ * @brief FNV-1a hash of blob data
+ *
+ * @param data data
+ * @param size size of data in bytes
+ *
+ * @return 64 bit hash
+ */
+uint64_t ge::gl::capture::hash(void const*data,size_t size){
+  uint64_t h = 14695981039346656037ull;
+  auto const d = (uint8_t const*)data;
+  for(size_t i=0;i<size;++i){
+    h ^= d[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+/**
+ * @brief Opens capture file
+ *
+ * @param fileName name of capture file
+ */
+CaptureWriter::CaptureWriter(std::string const&fileName):CaptureWriter(std::make_shared<std::ofstream>(fileName,std::ios::binary)){
+  if(!*m_stream)
+    throw std::runtime_error("CaptureWriter - cannot open file: "+fileName);
+}
+
+/**
+ * @brief Writes capture into stream
+ *
+ * @param stream binary output stream
+ */
+CaptureWriter::CaptureWriter(std::shared_ptr<std::ostream>const&stream):m_stream(stream),m_declaredFunctions(GE_GL_NOF_OPENGL_FUNCTIONS,false){
+  assert(this!=nullptr);
+  m_writeBytes(capture::MAGIC,capture::MAGIC_SIZE);
+}
+
+CaptureWriter::~CaptureWriter(){
+  flush();
+}
+
+/**
+ * @brief Marks end of frame
+ */
+void CaptureWriter::frame(){
+  assert(this!=nullptr);
+  std::lock_guard<std::mutex>lock(m_mutex);
+  m_writeValue(capture::FRAME);
+}
+
+void CaptureWriter::flush(){
+  assert(this!=nullptr);
+  std::lock_guard<std::mutex>lock(m_mutex);
+  m_stream->flush();
+}
+
+/**
+ * @brief Writes call record, function name is written before first call of function.
+ *
+ * @param call captured arguments
+ */
+void CaptureWriter::write(CaptureCall const&call){
+  assert(this!=nullptr);
+  std::lock_guard<std::mutex>lock(m_mutex);
+  if(!m_declaredFunctions[call.id]){
+    m_declaredFunctions[call.id] = true;
+    auto const length = (uint32_t)std::strlen(call.name);
+    m_writeValue(capture::FUNCTION);
+    m_writeValue(call.id);
+    m_writeValue(length);
+    m_writeBytes(call.name,length);
+  }
+  m_writeValue(capture::CALL);
+  m_writeValue(call.id);
+  m_writeValue((uint32_t)call.arguments.size());
+  m_writeBytes(call.arguments.data(),call.arguments.size());
+  m_nofCalls++;
+}
+
+/**
+ * @brief Writes payload if the same payload was not written yet
+ *
+ * @param data payload
+ * @param size size of payload
+ *
+ * @return hash that identifies payload together with its size
+ */
+uint64_t CaptureWriter::blob(void const*data,size_t size){
+  assert(this!=nullptr);
+  auto const h = capture::hash(data,size);
+  std::lock_guard<std::mutex>lock(m_mutex);
+  if(!m_blobs.insert(std::make_pair(h,(uint64_t)size)).second)return h;
+  m_writeValue(capture::BLOB);
+  m_writeValue(h);
+  m_writeValue((uint64_t)size);
+  m_writeBytes(data,size);
+  m_blobsSize += size;
+  return h;
+}
+
+size_t CaptureWriter::getNofBlobs()const{
+  std::lock_guard<std::mutex>lock(m_mutex);
+  return m_blobs.size();
+}
+
+size_t CaptureWriter::getBlobsSize()const{
+  std::lock_guard<std::mutex>lock(m_mutex);
+  return m_blobsSize;
+}
+
+size_t CaptureWriter::getNofCalls()const{
+  std::lock_guard<std::mutex>lock(m_mutex);
+  return m_nofCalls;
+}
+
+void CaptureWriter::m_writeBytes(void const*data,size_t size){
+  m_stream->write((char const*)data,size);
+}
+
+void CaptureCall::pointer(void const*value){
+  if(!value)return null();
+  kind(capture::VALUE);
+  scalar((uint64_t)(uintptr_t)value);
+}
+
+/**
+ * @brief Stores client memory out-of-line.
+ * Zero size means that pointer is offset into bound buffer.
+ */
+void CaptureCall::array(void const*data,size_t size){
+  if(!data)return null();
+  if(size == 0)return pointer(data);
+  kind(capture::BLOB_DATA);
+  scalar(writer.blob(data,size));
+  scalar((uint64_t)size);
+}
+
+void CaptureCall::output(void const*data,size_t size){
+  if(!data)return null();
+  kind(capture::OUTPUT);
+  scalar((uint64_t)size);
+}
+
+void CaptureCall::string(GLchar const*value,GLint length){
+  if(!value)return null();
+  auto const size = (uint32_t)(length < 0 ? std::strlen(value) : (size_t)length);
+  kind(capture::STRING);
+  scalar(size);
+  bytes(value,size);
+}
+
+void CaptureCall::strings(GLsizei count,GLchar const*const*values,GLint const*lengths){
+  if(!values)return null();
+  kind(capture::STRINGS);
+  scalar((uint32_t)count);
+  for(GLsizei i=0;i<count;++i){
+    auto const size = (uint32_t)(!lengths || lengths[i] < 0 ? std::strlen(values[i]) : (size_t)lengths[i]);
+    scalar(size);
+    bytes(values[i],size);
+  }
+}
+
+namespace{
+  using Blobs = std::map<std::pair<uint64_t,uint64_t>,std::vector<uint8_t>>;///<(hash,size) -> payload
+
+  /**
+   * @brief Decodes arguments of one call record.
+   * Memory of decoded pointers lives until next call.
+   */
+  class ReplayCall{
+    public:
+      ReplayCall(
+          Blobs                    const&blobs,
+          std::map<uint64_t,GLsync>     &syncs):blobs(blobs),syncs(syncs){}
+      void reset(uint8_t const*data,size_t size){
+        this->data = data;
+        this->end  = data+size;
+        strings     .clear();
+        stringArrays.clear();
+      }
+      template<typename T>
+        T scalar(){
+          T result;
+          read(&result,sizeof(T));
+          return result;
+        }
+      GLsync sync(){
+        auto const it = syncs.find(scalar<uint64_t>());
+        if(it == syncs.end())return nullptr;
+        return it->second;
+      }
+      void mapSync(GLsync value){
+        syncs[scalar<uint64_t>()] = value;
+      }
+      template<typename T>
+        T null(){
+          if(scalar<capture::ArgumentKind>() != capture::NULL_POINTER)
+            throw std::runtime_error("replayCapture - corrupted call arguments");
+          return nullptr;
+        }
+      template<typename T>
+        T pointer(){
+          return (T)(pointerValue());
+        }
+    protected:
+      void const*pointerValue(){
+        switch(scalar<capture::ArgumentKind>()){
+          case capture::NULL_POINTER:return nullptr;
+          case capture::VALUE       :return (void const*)(uintptr_t)scalar<uint64_t>();
+          case capture::BLOB_DATA   :{
+            auto const h    = scalar<uint64_t>();
+            auto const size = scalar<uint64_t>();
+            auto const it   = blobs.find(std::make_pair(h,size));
+            if(it == blobs.end())
+              throw std::runtime_error("replayCapture - missing blob");
+            return it->second.data();
+          }
+          case capture::STRING      :
+            strings.push_back(readString());
+            return strings.back().c_str();
+          case capture::STRINGS     :{
+            auto const count = scalar<uint32_t>();
+            stringArrays.emplace_back();
+            for(uint32_t i=0;i<count;++i){
+              strings.push_back(readString());
+              stringArrays.back().push_back(strings.back().c_str());
+            }
+            return stringArrays.back().data();
+          }
+          case capture::OUTPUT      :{
+            auto const size = (size_t)scalar<uint64_t>();
+            if(scratch.size() < size+minimalScratch)scratch.resize(size+minimalScratch);
+            return scratch.data();
+          }
+          default:
+            throw std::runtime_error("replayCapture - corrupted call arguments");
+        }
+      }
+      std::string readString(){
+        auto const size = scalar<uint32_t>();
+        std::string result(size,' ');
+        read(&result[0],size);
+        return result;
+      }
+      void read(void*out,size_t size){
+        if(data+size > end)
+          throw std::runtime_error("replayCapture - corrupted call arguments");
+        std::memcpy(out,data,size);
+        data += size;
+      }
+      static size_t const                          minimalScratch = 1<<16;
+      Blobs                                  const&blobs       ;
+      std::map<uint64_t,GLsync>                   &syncs       ;
+      uint8_t const*                               data = nullptr;
+      uint8_t const*                               end  = nullptr;
+      std::deque<std::string>                      strings     ;
+      std::deque<std::vector<char const*>>         stringArrays;
+      std::vector<uint8_t>                         scratch     ;
+  };
+
+  using ReplayFunction = void(*)(FunctionTable const&,ReplayCall&);
+
+  std::map<std::string,ReplayFunction>const&getReplayFunctions(){
+    static std::map<std::string,ReplayFunction>const functions = {
+#include<geGL/Generated/ReplayCalls.h>
+    };
+    return functions;
+  }
+
+  template<typename T>
+    T readValue(std::istream&stream){
+      T result;
+      if(!stream.read((char*)&result,sizeof(T)))
+        throw std::runtime_error("replayCapture - unexpected end of stream");
+      return result;
+    }
+
+  void readBytes(std::istream&stream,void*data,size_t size){
+    if(size == 0)return;
+    if(!stream.read((char*)data,size))
+      throw std::runtime_error("replayCapture - unexpected end of stream");
+  }
+}
+
+/**
+ * @brief This function replays captured OpenGL calls.
+ * Object names are not remapped, so capture has to be replayed in fresh context.
+ * Syncs are remapped.
+ *
+ * @param table function table that executes calls (it can be created using NullFunctionLoader)
+ * @param stream binary input stream with capture
+ * @param onFrame optional callback that is called after every replayed frame with its index
+ *
+ * @return statistics of replayed frames, calls after last frame marker form last frame
+ */
+std::vector<ReplayFrame>ge::gl::replayCapture(
+    FunctionTable           const&table  ,
+    std::istream                 &stream ,
+    std::function<void(size_t)>const&onFrame){
+  char magic[capture::MAGIC_SIZE];
+  readBytes(stream,magic,capture::MAGIC_SIZE);
+  if(std::memcmp(magic,capture::MAGIC,capture::MAGIC_SIZE) != 0)
+    throw std::runtime_error("replayCapture - stream is not geGL capture");
+
+  auto const&replayFunctions = getReplayFunctions();
+  std::map<uint32_t,ReplayFunction>       functions;
+  Blobs                                   blobs    ;
+  std::map<uint64_t,GLsync>               syncs    ;
+  std::vector<uint8_t>                    arguments;
+  ReplayCall                              call(blobs,syncs);
+  std::vector<ReplayFrame>                frames(1);
+
+  for(;;){
+    uint8_t tag;
+    if(!stream.read((char*)&tag,1))break;
+    switch(tag){
+      case capture::FUNCTION:{
+        auto const id     = readValue<uint32_t>(stream);
+        auto const length = readValue<uint32_t>(stream);
+        std::string name(length,' ');
+        readBytes(stream,&name[0],length);
+        auto const it = replayFunctions.find(name);
+        if(it == replayFunctions.end())
+          throw std::runtime_error("replayCapture - unknown function: "+name);
+        functions[id] = it->second;
+        break;
+      }
+      case capture::BLOB:{
+        auto const h    = readValue<uint64_t>(stream);
+        auto const size = readValue<uint64_t>(stream);
+        auto&data = blobs[std::make_pair(h,size)];
+        data.resize((size_t)size);
+        readBytes(stream,data.data(),(size_t)size);
+        break;
+      }
+      case capture::CALL:{
+        auto const id   = readValue<uint32_t>(stream);
+        auto const size = readValue<uint32_t>(stream);
+        arguments.resize(size);
+        readBytes(stream,arguments.data(),size);
+        auto const it = functions.find(id);
+        if(it == functions.end())
+          throw std::runtime_error("replayCapture - call of undeclared function");
+        call.reset(arguments.data(),arguments.size());
+        auto const start = std::chrono::steady_clock::now();
+        it->second(table,call);
+        auto const duration = std::chrono::steady_clock::now() - start;
+        frames.back().calls++;
+        frames.back().nanoseconds += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        break;
+      }
+      case capture::FRAME:
+        if(onFrame)onFrame(frames.size()-1);
+        frames.emplace_back();
+        break;
+      default:
+        throw std::runtime_error("replayCapture - corrupted stream");
+    }
+  }
+  if(frames.back().calls == 0)frames.pop_back();
+  return frames;
+}
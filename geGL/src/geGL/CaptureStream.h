@@ -0,0 +1,119 @@
+#pragma once
+
+#include<geGL/gegl_export.h>
+#include<geGL/OpenGL.h>
+#include<cstring>
+#include<functional>
+#include<iosfwd>
+#include<memory>
+#include<mutex>
+#include<set>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Binary stream of captured OpenGL calls.
+     * Stream starts with magic "geGLcap2" and continues with records.
+     * Every record starts with one byte tag:
+     * FUNCTION - uint32 id, uint32 length, name; it assigns id to function name
+     * BLOB     - uint64 hash, uint64 size, data; out-of-line payload, each distinct (hash,size) is written once
+     * CALL     - uint32 id, uint32 size, arguments
+     * FRAME    - end of frame
+     * Scalar arguments are stored as raw bytes, pointers are prefixed by ArgumentKind.
+     */
+    namespace capture{
+      enum Tag: uint8_t{
+        FUNCTION = 1,
+        BLOB     = 2,
+        CALL     = 3,
+        FRAME    = 4,
+      };
+      enum ArgumentKind: uint8_t{
+        NULL_POINTER = 0,///< nullptr
+        VALUE        = 1,///< uint64 value of pointer (buffer offsets, unknown pointers)
+        BLOB_DATA    = 2,///< uint64 hash, uint64 size of blob
+        STRING       = 3,///< uint32 length, characters
+        STRINGS      = 4,///< uint32 count, count x (uint32 length, characters)
+        OUTPUT       = 5,///< uint64 size of memory written by OpenGL, 0 if unknown
+      };
+      char const      MAGIC[] = "geGLcap2";
+      size_t const    MAGIC_SIZE = 8;
+      GEGL_EXPORT uint64_t hash(void const*data,size_t size);
+    }
+
+    class CaptureCall;
+
+    /**
+     * @brief This class writes captured OpenGL calls into stream.
+     * It is shared by CaptureTableDecorator and can be written from several threads.
+     */
+    class GEGL_EXPORT CaptureWriter{
+      public:
+        CaptureWriter(std::string const&fileName);
+        CaptureWriter(std::shared_ptr<std::ostream>const&stream);
+        ~CaptureWriter();
+        void     frame();
+        void     flush();
+        void     write(CaptureCall const&call);
+        uint64_t blob (void const*data,size_t size);
+        size_t   getNofBlobs  ()const;
+        size_t   getBlobsSize ()const;
+        size_t   getNofCalls  ()const;
+      protected:
+        void m_writeBytes(void const*data,size_t size);
+        template<typename T>
+          void m_writeValue(T const&value){m_writeBytes(&value,sizeof(T));}
+        std::shared_ptr<std::ostream>            m_stream           ;
+        mutable std::mutex                       m_mutex            ;
+        std::set<std::pair<uint64_t,uint64_t>>   m_blobs            ;
+        std::vector<bool>                        m_declaredFunctions;
+        size_t                                   m_blobsSize = 0    ;
+        size_t                                   m_nofCalls  = 0    ;
+    };
+
+    /**
+     * @brief Arguments of one captured call.
+     * Generated CaptureTableDecorator functions fill it and pass it to CaptureWriter.
+     */
+    class GEGL_EXPORT CaptureCall{
+      public:
+        CaptureCall(CaptureWriter&writer,uint32_t id,char const*name):writer(writer),id(id),name(name){}
+        template<typename T>
+          void scalar(T const&value){bytes(&value,sizeof(T));}
+        void sync(GLsync value){scalar((uint64_t)(uintptr_t)value);}
+        void null(){kind(capture::NULL_POINTER);}
+        void pointer(void const*value);
+        void array  (void const*data,size_t size);
+        void output (void const*data,size_t size);
+        void string (GLchar const*value,GLint length);
+        void strings(GLsizei count,GLchar const*const*values,GLint const*lengths);
+        CaptureWriter&      writer   ;
+        uint32_t            id       ;
+        char const*         name     ;
+        std::vector<uint8_t>arguments;
+      protected:
+        void kind(capture::ArgumentKind k){scalar(k);}
+        void bytes(void const*data,size_t size){
+          auto const offset = arguments.size();
+          arguments.resize(offset+size);
+          std::memcpy(arguments.data()+offset,data,size);
+        }
+    };
+
+    /**
+     * @brief Statistics of one replayed frame
+     */
+    struct ReplayFrame{
+      size_t   calls       = 0;///< number of replayed calls
+      uint64_t nanoseconds = 0;///< time spent inside of function table
+    };
+
+    GEGL_EXPORT std::vector<ReplayFrame>replayCapture(
+        FunctionTable           const&table                 ,
+        std::istream                 &stream                ,
+        std::function<void(size_t)>const&onFrame = nullptr);
+  }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include<memory>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLUtil.h>
+#include<geGL/CaptureStream.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator writes every OpenGL call and its arguments into CaptureWriter.
+     * Only calls made by application are captured,
+     * calls that decorators make internally (DSA emulation, ...) are executed but not captured.
+     * Client memory of buffer, texture, uniform, ... functions is stored out-of-line in blobs.
+     * Memory written through mapped pointers is not captured.
+     * It has to be placed on top of BindingTrackerTableDecorator,
+     * pixel unpack buffer binding is taken from it.
+     */
+    template<typename T>
+      class CaptureTableDecorator: public T{
+        public:
+          template<typename...ARGS>
+            CaptureTableDecorator(std::shared_ptr<CaptureWriter>const&writer,ARGS&&...args):T(args...),m_writer(writer){
+              assert(this!=nullptr);
+              assert(writer!=nullptr);
+            }
+          virtual ~CaptureTableDecorator(){}
+        protected:
+          std::shared_ptr<CaptureWriter>m_writer;
+          /**
+           * @brief Marks outermost call of calling thread.
+           */
+          class CaptureScope{
+            public:
+              CaptureScope():outermost(depth()++ == 0){}
+              ~CaptureScope(){depth()--;}
+              bool isOutermost()const{return outermost;}
+            protected:
+              static size_t&depth(){
+                static thread_local size_t d = 0;
+                return d;
+              }
+              bool outermost;
+          };
+          GLint m_getInteger(GLenum pname,GLint defaultValue)const{
+            GLint result = defaultValue;
+            if(this->m_orig_glGetIntegerv)(this->*(this->m_orig_glGetIntegerv))(pname,&result);
+            return result;
+          }
+          GLint m_unpackAlignment()const{
+            return this->m_getInteger(GL_UNPACK_ALIGNMENT,4);
+          }
+          /**
+           * @brief Returns size of client pixels, 0 if pixels are offset into pixel unpack buffer
+           */
+          size_t m_clientPixels(size_t size)const{
+            if(this->m_getBufferBinding(GL_PIXEL_UNPACK_BUFFER) != 0)return 0;
+            return size;
+          }
+          /**
+           * @brief Returns number of values read by gl*Parameter*v functions for parameter pname
+           * Parameters that are not vectors are read as single value.
+           */
+          static size_t m_parameterComponents(GLenum pname){
+            switch(pname){
+              case GL_TEXTURE_BORDER_COLOR     :
+              case GL_TEXTURE_SWIZZLE_RGBA     :
+              case GL_PATCH_DEFAULT_OUTER_LEVEL:
+              case GL_COLOR_TABLE_SCALE        :
+              case GL_COLOR_TABLE_BIAS         :
+              case GL_CONVOLUTION_BORDER_COLOR :
+              case GL_CONVOLUTION_FILTER_SCALE :
+              case GL_CONVOLUTION_FILTER_BIAS  :return 4;
+              case GL_POINT_DISTANCE_ATTENUATION:return 3;
+              case GL_PATCH_DEFAULT_INNER_LEVEL:return 2;
+              default                          :return 1;
+            }
+          }
+          /**
+           * @brief Returns number of values read by glClear*Buffer*v functions for buffer
+           * GL_COLOR reads four values, GL_DEPTH and GL_STENCIL read one.
+           */
+          static size_t m_clearComponents(GLenum buffer){
+            return buffer == GL_COLOR ? 4 : 1;
+          }
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+#include<geGL/Generated/CaptureCalls.h>
+            return true;
+          }
+#include<geGL/Generated/CaptureImplementation.h>
+      };
+  }
+}
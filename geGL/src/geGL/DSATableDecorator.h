@@ -10,10 +10,10 @@
       &DSATableDecorator::m_##name##_dsa
 
 #define IF_NOT_M_PTR_FCE(name)\
-  if(!this->m_ptr_##name)
+  if(!this->m_isAvailable(this->m_ptr_##name))
 
 #define IMPLEMENT_VENDOR(name,ven)\
-  if(this->m_ptr_##name##ven)this->m_ptr_##name = this->m_ptr_##name##ven;
+  if(this->m_isAvailable(this->m_ptr_##name##ven))this->m_ptr_##name = this->m_ptr_##name##ven;
 
 #define IMPLEMENT0(name)\
   IF_NOT_M_PTR_FCE(name)ASSIGN_DSA(name)
@@ -49,52 +49,44 @@
   }
 
 //toggle saving previous bindings
+//previous bindings are taken from BindingTrackerTableDecorator, driver is not queried
 #define SAVE_PREVIOUS_BINDING
 
 #ifdef  SAVE_PREVIOUS_BINDING
 #define PUSH_WRITE_BUFFER()\
-  GLuint oldWriteId;\
-this->glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING,(GLint*)&oldWriteId)
+  GLuint const oldWriteId = this->m_getBufferBinding(GL_COPY_WRITE_BUFFER)
 #define POP_WRITE_BUFFER()\
   this->glBindBuffer(GL_COPY_WRITE_BUFFER,oldWriteId)
 #define PUSH_READ_BUFFER()\
-  GLuint oldReadId;\
-this->glGetIntegerv(GL_COPY_WRITE_BUFFER_BINDING,(GLint*)&oldReadId)
+  GLuint const oldReadId = this->m_getBufferBinding(GL_COPY_READ_BUFFER)
 #define POP_READ_BUFFER()\
-  this->glBindBuffer(GL_COPY_WRITE_BUFFER,oldReadId)
+  this->glBindBuffer(GL_COPY_READ_BUFFER,oldReadId)
 #define PUSH_VAO()\
-  GLuint oldId;\
-this->glGetIntegerv(GL_VERTEX_ARRAY_BINDING,(GLint*)&oldId)
+  GLuint const oldId = this->m_getVertexArrayBinding()
 #define  POP_VAO()\
   this->glBindVertexArray(oldId)
 #define PUSH_SAMPLER()\
-  GLuint oldId;\
-this->glGetIntegeri_v(GL_SAMPLER_BINDING,0,(GLint*)&oldId)
+  GLuint const oldId = this->m_getSamplerBinding(0)
 #define POP_SAMPLER()\
   this->glBindSampler(0,oldId)
 #define PUSH_FRAMEBUFFER()\
-  GLuint oldId;\
-this->glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING,(GLint*)&oldId)
+  GLuint const oldId = this->m_getFramebufferBinding(GL_DRAW_FRAMEBUFFER)
 #define POP_FRAMEBUFFER()\
   this->glBindFramebuffer(GL_DRAW_FRAMEBUFFER,oldId)
 #define PUSH_RENDERBUFFER()\
-  GLuint oldId;\
-this->glGetIntegerv(GL_RENDERBUFFER_BINDING,(GLint*)&oldId)
+  GLuint const oldId = this->m_getRenderbufferBinding()
 #define POP_RENDERBUFFER()\
   this->glBindRenderbuffer(GL_RENDERBUFFER,oldId)
 #define PUSH_PIPELINE()\
-  GLuint oldId;\
-this->glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING,(GLint*)&oldId)
+  GLuint const oldId = this->m_getProgramPipelineBinding()
 #define POP_PIPELINE()\
   this->glBindProgramPipeline(oldId)
 #define PUSH_TEXTURE(x)\
-  GLuint oldId;\
-this->glGetIntegerv(ge::gl::textureTarget2Binding(x),(GLint*)&oldId)
+  GLuint const oldId = this->m_getTextureBinding(x)
 #define POP_TEXTURE(x)\
   this->glBindTexture(x,oldId)
 #define PUSH_ACTIVE_TEXTURE()\
-  GLenum oldTex;\
-this->glGetIntegerv(GL_ACTIVE_TEXTURE,(GLint*)&oldTex)
+  GLenum const oldTex = this->m_getActiveTexture()
 #define POP_ACTIVE_TEXTURE()\
   this->glActiveTexture(oldTex)
 #else //SAVE_PREVIOUS_BINDING
@@ -121,6 +113,10 @@ this->glGetIntegerv(GL_ACTIVE_TEXTURE,(GLint*)&oldTex)
 
 namespace ge{
   namespace gl{
+    /**
+     * @brief This decorator emulates missing direct state access functions.
+     * T has to contain BindingTrackerTableDecorator, it provides bindings that are restored.
+     */
     template<typename T>
       class DSATableDecorator: public T{
         public:
@@ -183,7 +179,8 @@ namespace ge{
 
             IMPLEMENT0(glCreateProgramPipelines);
 
-            if(!this->m_ptr_glCreateTextures){
+            if(!this->m_isAvailable(this->m_ptr_glCreateTextures)){
+              this->m_deleteTextures = this->m_ptr_glDeleteTextures;
               this->m_ptr_glCreateTextures =(decltype(FunctionTable::m_ptr_glCreateTextures))&DSATableDecorator::m_glCreateTextures_dsa;
               this->m_ptr_glDeleteTextures =(decltype(FunctionTable::m_ptr_glDeleteTextures))&DSATableDecorator::m_glDeleteTextures_dsa;
             }
@@ -564,6 +561,7 @@ namespace ge{
 
 
           std::map<GLuint,GLenum>m_texture2Target;
+          decltype(FunctionTable::m_ptr_glDeleteTextures)m_deleteTextures = nullptr;
 
           void m_glCreateTextures_dsa(GLenum target,GLsizei n,GLuint*ids){
             PUSH_TEXTURE(target);
@@ -576,7 +574,7 @@ namespace ge{
           }
 
           void m_glDeleteTextures_dsa(GLsizei n,const GLuint*ids){
-            this->m_glDeleteTextures(n,ids);
+            (this->*(this->m_deleteTextures))(n,ids);
             for(GLsizei i=0;i<n;++i)
               this->m_texture2Target.erase(ids[i]);
           }
@@ -664,10 +662,8 @@ namespace ge{
           void m_glBindTextureUnit_dsa(GLuint unit,GLuint texture){
             GLenum target=this->m_texture2Target[texture];
             PUSH_ACTIVE_TEXTURE();
-            PUSH_TEXTURE(target);
             this->glActiveTexture(GL_TEXTURE0+unit);
             this->glBindTexture(target,texture);
-            POP_TEXTURE(target);
             POP_ACTIVE_TEXTURE();
           }
 
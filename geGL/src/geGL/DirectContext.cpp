@@ -0,0 +1,79 @@
+#include<geGL/DirectContext.h>
+#include<cstdint>
+#include<utility>
+
+using namespace ge::gl;
+
+DirectContext::DirectContext(FunctionTablePointer const&table){
+  assert(this!=nullptr);
+  if(table == nullptr)this->setFunctionTable(ge::gl::getDefaultFunctionTable());
+  else this->setFunctionTable(table);
+}
+
+/**
+ * @brief Moves snapshot of other context, other context is left without function table
+ *
+ * @param other moved context
+ */
+DirectContext::DirectContext(DirectContext&&other){
+  assert(this!=nullptr);
+  *this = std::move(other);
+}
+
+/**
+ * @brief Moves snapshot of other context, other context is left without function table
+ * Moved context can be used again after setFunctionTable.
+ *
+ * @param other moved context
+ *
+ * @return this context
+ */
+DirectContext&DirectContext::operator=(DirectContext&&other){
+  assert(this!=nullptr);
+  if(this == &other)return *this;
+  auto const functions = other.m_functions;
+  auto const offset    = functions ? functions - other.m_storage.data() : 0;
+  this->m_table     = std::move(other.m_table);
+  this->m_rawTable  = other.m_rawTable;
+  this->m_storage   = std::move(other.m_storage);
+  this->m_functions = functions ? this->m_storage.data()+offset : nullptr;
+  other.m_table     = nullptr;
+  other.m_rawTable  = nullptr;
+  other.m_storage.clear();
+  other.m_functions = nullptr;
+  return *this;
+}
+
+/**
+ * @brief Sets function table and takes new snapshot of its direct functions
+ *
+ * @param table function table
+ */
+void DirectContext::setFunctionTable(FunctionTablePointer const&table){
+  assert(this!=nullptr);
+  assert(table!=nullptr);
+  if(this->m_functions == nullptr){
+    size_t const cacheLine = 64;
+    this->m_storage.resize(GE_GL_NOF_OPENGL_FUNCTIONS+cacheLine/sizeof(FUNCTION_POINTER),nullptr);
+    auto const address = (uintptr_t)this->m_storage.data();
+    this->m_functions = (FUNCTION_POINTER*)((address+cacheLine-1)/cacheLine*cacheLine);
+  }
+  this->m_table    = table;
+  this->m_rawTable = table.get();
+  for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+    this->m_functions[i] = table->getDirectFunction(i);
+}
+
+/**
+ * @brief Returns number of functions that are called directly
+ *
+ * @return number of functions that bypass function table
+ */
+size_t DirectContext::getNofDirectFunctions()const{
+  assert(this!=nullptr);
+  size_t counter = 0;
+  if(this->m_functions == nullptr)return counter;
+  for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+    if(this->m_functions[i])counter++;
+  return counter;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<cassert>
+#include<vector>
+
+/**
+ * @brief Context variant that calls driver functions directly.
+ * During construction and setFunctionTable it takes snapshot of raw function pointers
+ * of functions that are not decorated (their m_ptr_* calls loaded function).
+ * Snapshot is flat cache-aligned array, so call costs one load and one indirect call
+ * instead of shared_ptr dereference and member function pointer call.
+ * Decorated functions (DSA emulation, binding tracker, state cache, profiling, capture, ...)
+ * are still called through function table.
+ * Functions of lazily loaded table become direct after they are resolved and setFunctionTable is called again.
+ * Snapshot points into its own storage, so context cannot be copied, only moved.
+ */
+class GEGL_EXPORT ge::gl::DirectContext{
+  public:
+    DirectContext(FunctionTablePointer const&table = nullptr);
+    DirectContext(DirectContext const&) = delete;
+    DirectContext(DirectContext&&other);
+    DirectContext&operator=(DirectContext const&) = delete;
+    DirectContext&operator=(DirectContext&&other);
+    FunctionTablePointer const&getFunctionTable()const{
+      assert(this!=nullptr);
+      return this->m_table;
+    }
+    void   setFunctionTable(FunctionTablePointer const&table);
+    size_t getNofDirectFunctions()const;
+#include<geGL/Generated/DirectContextCalls.h>
+  protected:
+    using FUNCTION_POINTER = FunctionTable::FUNCTION_POINTER;
+    FunctionTablePointer         m_table     = nullptr;
+    FunctionTable const*         m_rawTable  = nullptr;
+    std::vector<FUNCTION_POINTER>m_storage            ;
+    FUNCTION_POINTER*            m_functions = nullptr;///< cache-aligned part of m_storage
+};
+
+#if defined(GEGL_STATIC_DISPATCH)
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Snapshot of default context of calling thread.
+     * Inline free functions of StaticCalls.h call through it.
+     * It is taken by setDefaultContext and setDefaultFunctionTable,
+     * function table that is set directly to default context is not seen until one of them is called.
+     */
+#if defined(_WIN32)
+    GEGL_EXPORT DirectContext const&getDefaultDirectContext();
+#else
+    extern GEGL_EXPORT thread_local DirectContext const*_defaultDirectContext;
+    inline DirectContext const&getDefaultDirectContext(){
+      assert(_defaultDirectContext!=nullptr);
+      return *_defaultDirectContext;
+    }
+#endif
+  }
+}
+#endif
@@ -0,0 +1,193 @@
+#include <geGL/DynamicBuffer.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+/**
+ * @brief gets number of reallocations that geometric growth saved
+ *
+ * @return exactReallocations - reallocations
+ */
+size_t DynamicBuffer::Statistics::getSavedReallocations() const
+{
+  if (exactReallocations < reallocations) return 0;
+  return exactReallocations - reallocations;
+}
+
+/**
+ * @brief gets number of copied bytes that geometric growth saved
+ *
+ * @return exactCopiedBytes - copiedBytes
+ */
+GLsizeiptr DynamicBuffer::Statistics::getSavedCopiedBytes() const
+{
+  return std::max(exactCopiedBytes - copiedBytes, GLsizeiptr(0));
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param capacity initial capacity in bytes
+ * @param usage usage of mutable buffer (GL_DYNAMIC_DRAW, GL_STREAM_DRAW, ...)
+ * @param growthFactor capacity multiplier of reallocation, it has to be > 1
+ */
+DynamicBuffer::DynamicBuffer(GLsizeiptr capacity,
+                             GLenum     usage,
+                             float      growthFactor)
+    : DynamicBuffer(nullptr, capacity, usage, growthFactor)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param capacity initial capacity in bytes
+ * @param usage usage of mutable buffer (GL_DYNAMIC_DRAW, GL_STREAM_DRAW, ...)
+ * @param growthFactor capacity multiplier of reallocation, it has to be > 1
+ */
+DynamicBuffer::DynamicBuffer(FunctionTablePointer const &table,
+                             GLsizeiptr                  capacity,
+                             GLenum                      usage,
+                             float                       growthFactor)
+    : capacity(capacity), exactCapacity(capacity), growthFactor(growthFactor)
+{
+  if (capacity < 0)
+    throw std::invalid_argument(
+        "geGL: DynamicBuffer - capacity has to be non-negative");
+  if (!(growthFactor > 1.f))
+    throw std::invalid_argument(
+        "geGL: DynamicBuffer - growth factor has to be greater than 1");
+  buffer = std::make_shared<Buffer>(table, capacity, nullptr, usage);
+}
+
+DynamicBuffer::~DynamicBuffer() {}
+
+/**
+ * @brief Ensures capacity, data are kept
+ *
+ * @param newCapacity minimal capacity in bytes
+ */
+void DynamicBuffer::reserve(GLsizeiptr newCapacity)
+{
+  assert(this != nullptr);
+  if (newCapacity <= capacity) return;
+  trackExactFit(newCapacity);
+  reallocate(newCapacity);
+}
+
+/**
+ * @brief Changes size, capacity grows geometrically, new bytes are undefined
+ *
+ * @param newSize new size in bytes
+ */
+void DynamicBuffer::resize(GLsizeiptr newSize)
+{
+  assert(this != nullptr);
+  if (newSize < 0)
+    throw std::invalid_argument(
+        "geGL: DynamicBuffer::resize - size has to be non-negative");
+  trackExactFit(newSize);
+  if (newSize > capacity) {
+    auto const grown = static_cast<GLsizeiptr>(
+        std::ceil(static_cast<double>(capacity) * growthFactor));
+    reallocate(std::max(newSize, grown));
+  }
+  size = newSize;
+}
+
+/**
+ * @brief Appends data to the end of buffer
+ *
+ * @param data data
+ * @param dataSize size of data in bytes
+ *
+ * @return offset of appended data
+ */
+GLintptr DynamicBuffer::append(GLvoid const *data, GLsizeiptr dataSize)
+{
+  assert(this != nullptr);
+  auto const offset = static_cast<GLintptr>(size);
+  if (dataSize <= 0) return offset;
+  resize(size + dataSize);
+  if (data) buffer->setData(data, dataSize, offset);
+  return offset;
+}
+
+/**
+ * @brief Sets size to zero, capacity is kept
+ */
+void DynamicBuffer::clear() { size = 0; }
+
+/**
+ * @brief Reallocates buffer so its capacity equals its size
+ */
+void DynamicBuffer::shrinkToFit()
+{
+  assert(this != nullptr);
+  if (size == capacity) return;
+  reallocate(size);
+  exactCapacity = size;
+}
+
+GLsizeiptr DynamicBuffer::getSize() const { return size; }
+
+GLsizeiptr DynamicBuffer::getCapacity() const { return capacity; }
+
+bool DynamicBuffer::empty() const { return size == 0; }
+
+/**
+ * @brief gets underlying buffer, its id changes during reallocation
+ *
+ * @return buffer
+ */
+Buffer *DynamicBuffer::getBuffer() const { return buffer.get(); }
+
+std::shared_ptr<Buffer> const &DynamicBuffer::getSharedBuffer() const
+{
+  return buffer;
+}
+
+/**
+ * @brief gets reallocation statistics
+ *
+ * @return statistics
+ */
+DynamicBuffer::Statistics const &DynamicBuffer::getStatistics() const
+{
+  return statistics;
+}
+
+/**
+ * @brief Reallocates buffer, used data are copied only if there are some
+ *
+ * @param newCapacity new capacity in bytes
+ */
+void DynamicBuffer::reallocate(GLsizeiptr newCapacity)
+{
+  if (size == 0)
+    buffer->realloc(newCapacity, Buffer::NEW_BUFFER);
+  else {
+    buffer->realloc(newCapacity, Buffer::KEEP_DATA);
+    statistics.copiedBytes += std::min(capacity, newCapacity);
+  }
+  statistics.reallocations++;
+  capacity = newCapacity;
+}
+
+/**
+ * @brief Accounts reallocation of policy that grows capacity exactly to
+ * required size
+ *
+ * @param required required capacity in bytes
+ */
+void DynamicBuffer::trackExactFit(GLsizeiptr required)
+{
+  if (required <= exactCapacity) return;
+  statistics.exactReallocations++;
+  if (size > 0) statistics.exactCopiedBytes += exactCapacity;
+  exactCapacity = required;
+}
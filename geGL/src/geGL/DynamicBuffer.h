@@ -0,0 +1,78 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Growable buffer with vector-like semantics (point clouds, instance
+ * lists, ...).
+ *
+ * Size (used bytes) is kept apart from capacity (size of GL buffer).
+ * If append does not fit, capacity grows geometrically using
+ * Buffer::realloc(KEEP_DATA), so n appends cost O(log n) reallocations and
+ * vertex arrays that use the buffer follow the new buffer id.
+ * Statistics compare the growth with exact-fit reallocation of every append.
+ */
+class GEGL_EXPORT ge::gl::DynamicBuffer {
+ public:
+  /**
+   * @brief Reallocation statistics
+   */
+  struct Statistics {
+    size_t     reallocations      = 0;  ///< reallocations of GL buffer
+    GLsizeiptr copiedBytes        = 0;  ///< bytes copied by reallocations
+    size_t     exactReallocations = 0;  ///< reallocations of exact-fit growth
+    GLsizeiptr exactCopiedBytes   = 0;  ///< bytes copied by exact-fit growth
+    size_t     getSavedReallocations() const;
+    GLsizeiptr getSavedCopiedBytes() const;
+  };
+  DynamicBuffer(GLsizeiptr capacity     = 0,
+                GLenum     usage        = GL_DYNAMIC_DRAW,
+                float      growthFactor = 2.f);
+  DynamicBuffer(FunctionTablePointer const& table,
+                GLsizeiptr                  capacity     = 0,
+                GLenum                      usage        = GL_DYNAMIC_DRAW,
+                float                       growthFactor = 2.f);
+  ~DynamicBuffer();
+  DynamicBuffer(DynamicBuffer const&) = delete;
+  DynamicBuffer& operator=(DynamicBuffer const&) = delete;
+  void     reserve(GLsizeiptr capacity);
+  void     resize(GLsizeiptr size);
+  GLintptr append(GLvoid const* data, GLsizeiptr size);
+  void     clear();
+  void     shrinkToFit();
+  GLsizeiptr getSize() const;
+  GLsizeiptr getCapacity() const;
+  bool       empty() const;
+  Buffer*    getBuffer() const;
+  std::shared_ptr<Buffer> const& getSharedBuffer() const;
+  Statistics const& getStatistics() const;
+
+  template <typename T>
+  GLintptr append(std::vector<T> const& data);
+  template <typename T>
+  GLintptr push_back(T const& value);
+
+ protected:
+  void                    reallocate(GLsizeiptr newCapacity);
+  void                    trackExactFit(GLsizeiptr required);
+  std::shared_ptr<Buffer> buffer;
+  GLsizeiptr              size          = 0;
+  GLsizeiptr              capacity      = 0;
+  GLsizeiptr              exactCapacity = 0;  ///< capacity of exact-fit growth
+  float                   growthFactor  = 2.f;
+  Statistics              statistics;
+};
+
+template <typename T>
+GLintptr ge::gl::DynamicBuffer::append(std::vector<T> const& data)
+{
+  return append(data.data(), data.size() * sizeof(T));
+}
+
+template <typename T>
+GLintptr ge::gl::DynamicBuffer::push_back(T const& value)
+{
+  return append(&value, sizeof(T));
+}
@@ -8,17 +8,37 @@ namespace ge{
     using FunctionTablePointer = std::shared_ptr<FunctionTable const>;
     class FunctionLoaderInterface;
     using FunctionLoaderInterfacePointer = std::shared_ptr<FunctionLoaderInterface>;
+    class ProfilingInterface;
+    class BindingTrackerInterface;
+    class CaptureWriter;
     class Context;
     using ContextPointer = std::shared_ptr<Context>;
+    class DirectContext;
     class OpenGLObject;
     class OpenGLObjectImpl;
     class Buffer;
     class BufferImpl;
+    class StreamingBuffer;
+    class DynamicBuffer;
+    class UploadBatch;
+    class AsyncReadback;
+    class Sync;
+    class Timeline;
+    class RangeAllocator;
+    class BufferArena;
+    struct BufferSuballocation;
     class Program;
     class ProgramImpl;
+    class ProgramBinaryCache;
+    class ProgramCompiler;
+    class UniformBlockBuilder;
     class Shader;
     class ShaderImpl;
     class Texture;
+    class TextureResidency;
+    class TextureStreamer;
+    class TextureUploader;
+    class MipmapGenerator;
     class VertexArray;
     class VertexArrayImpl;
     class AsynchronousQuery;
@@ -0,0 +1,5852 @@
+this->m_orig_glMultiDrawArraysIndirectBindlessCountNV = this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV)this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_capture;
+this->m_orig_glTextureParameterfv = this->m_ptr_glTextureParameterfv;
+if(this->m_ptr_glTextureParameterfv)this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&CaptureTableDecorator::m_glTextureParameterfv_capture;
+this->m_orig_glGetListParameterivSGIX = this->m_ptr_glGetListParameterivSGIX;
+if(this->m_ptr_glGetListParameterivSGIX)this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&CaptureTableDecorator::m_glGetListParameterivSGIX_capture;
+this->m_orig_glProgramUniform1i64ARB = this->m_ptr_glProgramUniform1i64ARB;
+if(this->m_ptr_glProgramUniform1i64ARB)this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&CaptureTableDecorator::m_glProgramUniform1i64ARB_capture;
+this->m_orig_glVertexArrayElementBuffer = this->m_ptr_glVertexArrayElementBuffer;
+if(this->m_ptr_glVertexArrayElementBuffer)this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&CaptureTableDecorator::m_glVertexArrayElementBuffer_capture;
+this->m_orig_glHintPGI = this->m_ptr_glHintPGI;
+if(this->m_ptr_glHintPGI)this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&CaptureTableDecorator::m_glHintPGI_capture;
+this->m_orig_glStencilMaskSeparate = this->m_ptr_glStencilMaskSeparate;
+if(this->m_ptr_glStencilMaskSeparate)this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&CaptureTableDecorator::m_glStencilMaskSeparate_capture;
+this->m_orig_glGetFramebufferAttachmentParameterivEXT = this->m_ptr_glGetFramebufferAttachmentParameterivEXT;
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT)this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_capture;
+this->m_orig_glTextureStorage3DMultisample = this->m_ptr_glTextureStorage3DMultisample;
+if(this->m_ptr_glTextureStorage3DMultisample)this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTextureStorage3DMultisample_capture;
+this->m_orig_glGetIntegerIndexedvEXT = this->m_ptr_glGetIntegerIndexedvEXT;
+if(this->m_ptr_glGetIntegerIndexedvEXT)this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&CaptureTableDecorator::m_glGetIntegerIndexedvEXT_capture;
+this->m_orig_glCopyTexImage1D = this->m_ptr_glCopyTexImage1D;
+if(this->m_ptr_glCopyTexImage1D)this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&CaptureTableDecorator::m_glCopyTexImage1D_capture;
+this->m_orig_glVertexAttrib4usv = this->m_ptr_glVertexAttrib4usv;
+if(this->m_ptr_glVertexAttrib4usv)this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&CaptureTableDecorator::m_glVertexAttrib4usv_capture;
+this->m_orig_glTexRenderbufferNV = this->m_ptr_glTexRenderbufferNV;
+if(this->m_ptr_glTexRenderbufferNV)this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&CaptureTableDecorator::m_glTexRenderbufferNV_capture;
+this->m_orig_glVertexAttrib3hvNV = this->m_ptr_glVertexAttrib3hvNV;
+if(this->m_ptr_glVertexAttrib3hvNV)this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&CaptureTableDecorator::m_glVertexAttrib3hvNV_capture;
+this->m_orig_glProgramUniform4ui64ARB = this->m_ptr_glProgramUniform4ui64ARB;
+if(this->m_ptr_glProgramUniform4ui64ARB)this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&CaptureTableDecorator::m_glProgramUniform4ui64ARB_capture;
+this->m_orig_glInstrumentsBufferSGIX = this->m_ptr_glInstrumentsBufferSGIX;
+if(this->m_ptr_glInstrumentsBufferSGIX)this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&CaptureTableDecorator::m_glInstrumentsBufferSGIX_capture;
+this->m_orig_glIndexi = this->m_ptr_glIndexi;
+if(this->m_ptr_glIndexi)this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&CaptureTableDecorator::m_glIndexi_capture;
+this->m_orig_glMultiTexCoord2sARB = this->m_ptr_glMultiTexCoord2sARB;
+if(this->m_ptr_glMultiTexCoord2sARB)this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2sARB_capture;
+this->m_orig_glProgramEnvParameter4fARB = this->m_ptr_glProgramEnvParameter4fARB;
+if(this->m_ptr_glProgramEnvParameter4fARB)this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&CaptureTableDecorator::m_glProgramEnvParameter4fARB_capture;
+this->m_orig_glCompressedTexSubImage3D = this->m_ptr_glCompressedTexSubImage3D;
+if(this->m_ptr_glCompressedTexSubImage3D)this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&CaptureTableDecorator::m_glCompressedTexSubImage3D_capture;
+this->m_orig_glEvalCoord2d = this->m_ptr_glEvalCoord2d;
+if(this->m_ptr_glEvalCoord2d)this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&CaptureTableDecorator::m_glEvalCoord2d_capture;
+this->m_orig_glEvalCoord2f = this->m_ptr_glEvalCoord2f;
+if(this->m_ptr_glEvalCoord2f)this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&CaptureTableDecorator::m_glEvalCoord2f_capture;
+this->m_orig_glIndexd = this->m_ptr_glIndexd;
+if(this->m_ptr_glIndexd)this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&CaptureTableDecorator::m_glIndexd_capture;
+this->m_orig_glSecondaryColor3hvNV = this->m_ptr_glSecondaryColor3hvNV;
+if(this->m_ptr_glSecondaryColor3hvNV)this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&CaptureTableDecorator::m_glSecondaryColor3hvNV_capture;
+this->m_orig_glIndexf = this->m_ptr_glIndexf;
+if(this->m_ptr_glIndexf)this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&CaptureTableDecorator::m_glIndexf_capture;
+this->m_orig_glFrustumxOES = this->m_ptr_glFrustumxOES;
+if(this->m_ptr_glFrustumxOES)this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&CaptureTableDecorator::m_glFrustumxOES_capture;
+this->m_orig_glTextureStorage3DEXT = this->m_ptr_glTextureStorage3DEXT;
+if(this->m_ptr_glTextureStorage3DEXT)this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&CaptureTableDecorator::m_glTextureStorage3DEXT_capture;
+this->m_orig_glDrawCommandsStatesNV = this->m_ptr_glDrawCommandsStatesNV;
+if(this->m_ptr_glDrawCommandsStatesNV)this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&CaptureTableDecorator::m_glDrawCommandsStatesNV_capture;
+this->m_orig_glUniform4uiEXT = this->m_ptr_glUniform4uiEXT;
+if(this->m_ptr_glUniform4uiEXT)this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&CaptureTableDecorator::m_glUniform4uiEXT_capture;
+this->m_orig_glProgramUniform3ui64ARB = this->m_ptr_glProgramUniform3ui64ARB;
+if(this->m_ptr_glProgramUniform3ui64ARB)this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&CaptureTableDecorator::m_glProgramUniform3ui64ARB_capture;
+this->m_orig_glIndexs = this->m_ptr_glIndexs;
+if(this->m_ptr_glIndexs)this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&CaptureTableDecorator::m_glIndexs_capture;
+this->m_orig_glVertexArrayBindVertexBufferEXT = this->m_ptr_glVertexArrayBindVertexBufferEXT;
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT)this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&CaptureTableDecorator::m_glVertexArrayBindVertexBufferEXT_capture;
+this->m_orig_glConvolutionParameteriEXT = this->m_ptr_glConvolutionParameteriEXT;
+if(this->m_ptr_glConvolutionParameteriEXT)this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&CaptureTableDecorator::m_glConvolutionParameteriEXT_capture;
+this->m_orig_glColor4ubVertex2fSUN = this->m_ptr_glColor4ubVertex2fSUN;
+if(this->m_ptr_glColor4ubVertex2fSUN)this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&CaptureTableDecorator::m_glColor4ubVertex2fSUN_capture;
+this->m_orig_glProgramUniform1ivEXT = this->m_ptr_glProgramUniform1ivEXT;
+if(this->m_ptr_glProgramUniform1ivEXT)this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&CaptureTableDecorator::m_glProgramUniform1ivEXT_capture;
+this->m_orig_glGetnMapfv = this->m_ptr_glGetnMapfv;
+if(this->m_ptr_glGetnMapfv)this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&CaptureTableDecorator::m_glGetnMapfv_capture;
+this->m_orig_glTransformFeedbackBufferRange = this->m_ptr_glTransformFeedbackBufferRange;
+if(this->m_ptr_glTransformFeedbackBufferRange)this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&CaptureTableDecorator::m_glTransformFeedbackBufferRange_capture;
+this->m_orig_glPathGlyphsNV = this->m_ptr_glPathGlyphsNV;
+if(this->m_ptr_glPathGlyphsNV)this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&CaptureTableDecorator::m_glPathGlyphsNV_capture;
+this->m_orig_glSecondaryColor3fv = this->m_ptr_glSecondaryColor3fv;
+if(this->m_ptr_glSecondaryColor3fv)this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&CaptureTableDecorator::m_glSecondaryColor3fv_capture;
+this->m_orig_glGetCombinerInputParameterivNV = this->m_ptr_glGetCombinerInputParameterivNV;
+if(this->m_ptr_glGetCombinerInputParameterivNV)this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetCombinerInputParameterivNV_capture;
+this->m_orig_glEndPerfMonitorAMD = this->m_ptr_glEndPerfMonitorAMD;
+if(this->m_ptr_glEndPerfMonitorAMD)this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&CaptureTableDecorator::m_glEndPerfMonitorAMD_capture;
+this->m_orig_glPointParameterfvARB = this->m_ptr_glPointParameterfvARB;
+if(this->m_ptr_glPointParameterfvARB)this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&CaptureTableDecorator::m_glPointParameterfvARB_capture;
+this->m_orig_glVertex2xOES = this->m_ptr_glVertex2xOES;
+if(this->m_ptr_glVertex2xOES)this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&CaptureTableDecorator::m_glVertex2xOES_capture;
+this->m_orig_glDrawElementsInstancedBaseInstance = this->m_ptr_glDrawElementsInstancedBaseInstance;
+if(this->m_ptr_glDrawElementsInstancedBaseInstance)this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&CaptureTableDecorator::m_glDrawElementsInstancedBaseInstance_capture;
+this->m_orig_glMultTransposeMatrixdARB = this->m_ptr_glMultTransposeMatrixdARB;
+if(this->m_ptr_glMultTransposeMatrixdARB)this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&CaptureTableDecorator::m_glMultTransposeMatrixdARB_capture;
+this->m_orig_glVertexAttribL4dEXT = this->m_ptr_glVertexAttribL4dEXT;
+if(this->m_ptr_glVertexAttribL4dEXT)this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&CaptureTableDecorator::m_glVertexAttribL4dEXT_capture;
+this->m_orig_glVertex4iv = this->m_ptr_glVertex4iv;
+if(this->m_ptr_glVertex4iv)this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&CaptureTableDecorator::m_glVertex4iv_capture;
+this->m_orig_glCoverStrokePathInstancedNV = this->m_ptr_glCoverStrokePathInstancedNV;
+if(this->m_ptr_glCoverStrokePathInstancedNV)this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glCoverStrokePathInstancedNV_capture;
+this->m_orig_glDeformSGIX = this->m_ptr_glDeformSGIX;
+if(this->m_ptr_glDeformSGIX)this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&CaptureTableDecorator::m_glDeformSGIX_capture;
+this->m_orig_glUniform2ui64NV = this->m_ptr_glUniform2ui64NV;
+if(this->m_ptr_glUniform2ui64NV)this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&CaptureTableDecorator::m_glUniform2ui64NV_capture;
+this->m_orig_glCopyPathNV = this->m_ptr_glCopyPathNV;
+if(this->m_ptr_glCopyPathNV)this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&CaptureTableDecorator::m_glCopyPathNV_capture;
+this->m_orig_glVertexAttribP4ui = this->m_ptr_glVertexAttribP4ui;
+if(this->m_ptr_glVertexAttribP4ui)this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&CaptureTableDecorator::m_glVertexAttribP4ui_capture;
+this->m_orig_glVertexAttribL2d = this->m_ptr_glVertexAttribL2d;
+if(this->m_ptr_glVertexAttribL2d)this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&CaptureTableDecorator::m_glVertexAttribL2d_capture;
+this->m_orig_glGetMultisamplefv = this->m_ptr_glGetMultisamplefv;
+if(this->m_ptr_glGetMultisamplefv)this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&CaptureTableDecorator::m_glGetMultisamplefv_capture;
+this->m_orig_glCompressedMultiTexSubImage3DEXT = this->m_ptr_glCompressedMultiTexSubImage3DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT)this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexSubImage3DEXT_capture;
+this->m_orig_glVDPAURegisterOutputSurfaceNV = this->m_ptr_glVDPAURegisterOutputSurfaceNV;
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV)this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&CaptureTableDecorator::m_glVDPAURegisterOutputSurfaceNV_capture;
+this->m_orig_glMinSampleShading = this->m_ptr_glMinSampleShading;
+if(this->m_ptr_glMinSampleShading)this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&CaptureTableDecorator::m_glMinSampleShading_capture;
+this->m_orig_glProgramUniform4fEXT = this->m_ptr_glProgramUniform4fEXT;
+if(this->m_ptr_glProgramUniform4fEXT)this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&CaptureTableDecorator::m_glProgramUniform4fEXT_capture;
+this->m_orig_glCoverStrokePathNV = this->m_ptr_glCoverStrokePathNV;
+if(this->m_ptr_glCoverStrokePathNV)this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&CaptureTableDecorator::m_glCoverStrokePathNV_capture;
+this->m_orig_glTextureImage2DMultisampleNV = this->m_ptr_glTextureImage2DMultisampleNV;
+if(this->m_ptr_glTextureImage2DMultisampleNV)this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&CaptureTableDecorator::m_glTextureImage2DMultisampleNV_capture;
+this->m_orig_glVertex3bOES = this->m_ptr_glVertex3bOES;
+if(this->m_ptr_glVertex3bOES)this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&CaptureTableDecorator::m_glVertex3bOES_capture;
+this->m_orig_glImportMemoryWin32HandleEXT = this->m_ptr_glImportMemoryWin32HandleEXT;
+if(this->m_ptr_glImportMemoryWin32HandleEXT)this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&CaptureTableDecorator::m_glImportMemoryWin32HandleEXT_capture;
+this->m_orig_glTessellationFactorAMD = this->m_ptr_glTessellationFactorAMD;
+if(this->m_ptr_glTessellationFactorAMD)this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&CaptureTableDecorator::m_glTessellationFactorAMD_capture;
+this->m_orig_glDebugMessageControl = this->m_ptr_glDebugMessageControl;
+if(this->m_ptr_glDebugMessageControl)this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&CaptureTableDecorator::m_glDebugMessageControl_capture;
+this->m_orig_glIsObjectBufferATI = this->m_ptr_glIsObjectBufferATI;
+if(this->m_ptr_glIsObjectBufferATI)this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glIsObjectBufferATI_capture;
+this->m_orig_glPopAttrib = this->m_ptr_glPopAttrib;
+if(this->m_ptr_glPopAttrib)this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&CaptureTableDecorator::m_glPopAttrib_capture;
+this->m_orig_glProgramUniform4iEXT = this->m_ptr_glProgramUniform4iEXT;
+if(this->m_ptr_glProgramUniform4iEXT)this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&CaptureTableDecorator::m_glProgramUniform4iEXT_capture;
+this->m_orig_glVertexAttrib4ubNV = this->m_ptr_glVertexAttrib4ubNV;
+if(this->m_ptr_glVertexAttrib4ubNV)this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&CaptureTableDecorator::m_glVertexAttrib4ubNV_capture;
+this->m_orig_glColorMaterial = this->m_ptr_glColorMaterial;
+if(this->m_ptr_glColorMaterial)this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&CaptureTableDecorator::m_glColorMaterial_capture;
+this->m_orig_glVertexAttrib2svARB = this->m_ptr_glVertexAttrib2svARB;
+if(this->m_ptr_glVertexAttrib2svARB)this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&CaptureTableDecorator::m_glVertexAttrib2svARB_capture;
+this->m_orig_glMinSampleShadingARB = this->m_ptr_glMinSampleShadingARB;
+if(this->m_ptr_glMinSampleShadingARB)this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&CaptureTableDecorator::m_glMinSampleShadingARB_capture;
+this->m_orig_glColor3b = this->m_ptr_glColor3b;
+if(this->m_ptr_glColor3b)this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&CaptureTableDecorator::m_glColor3b_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_capture;
+this->m_orig_glColor3f = this->m_ptr_glColor3f;
+if(this->m_ptr_glColor3f)this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&CaptureTableDecorator::m_glColor3f_capture;
+this->m_orig_glVDPAUGetSurfaceivNV = this->m_ptr_glVDPAUGetSurfaceivNV;
+if(this->m_ptr_glVDPAUGetSurfaceivNV)this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&CaptureTableDecorator::m_glVDPAUGetSurfaceivNV_capture;
+this->m_orig_glColor3d = this->m_ptr_glColor3d;
+if(this->m_ptr_glColor3d)this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&CaptureTableDecorator::m_glColor3d_capture;
+this->m_orig_glGetnMapiv = this->m_ptr_glGetnMapiv;
+if(this->m_ptr_glGetnMapiv)this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&CaptureTableDecorator::m_glGetnMapiv_capture;
+this->m_orig_glColor3i = this->m_ptr_glColor3i;
+if(this->m_ptr_glColor3i)this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&CaptureTableDecorator::m_glColor3i_capture;
+this->m_orig_glGetInternalformatSampleivNV = this->m_ptr_glGetInternalformatSampleivNV;
+if(this->m_ptr_glGetInternalformatSampleivNV)this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&CaptureTableDecorator::m_glGetInternalformatSampleivNV_capture;
+this->m_orig_glVertexAttrib4ubv = this->m_ptr_glVertexAttrib4ubv;
+if(this->m_ptr_glVertexAttrib4ubv)this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&CaptureTableDecorator::m_glVertexAttrib4ubv_capture;
+this->m_orig_glColor3s = this->m_ptr_glColor3s;
+if(this->m_ptr_glColor3s)this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&CaptureTableDecorator::m_glColor3s_capture;
+this->m_orig_glVertexAttribs4hvNV = this->m_ptr_glVertexAttribs4hvNV;
+if(this->m_ptr_glVertexAttribs4hvNV)this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&CaptureTableDecorator::m_glVertexAttribs4hvNV_capture;
+this->m_orig_glVertexAttrib4NubvARB = this->m_ptr_glVertexAttrib4NubvARB;
+if(this->m_ptr_glVertexAttrib4NubvARB)this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NubvARB_capture;
+this->m_orig_glMultiTexCoord3hvNV = this->m_ptr_glMultiTexCoord3hvNV;
+if(this->m_ptr_glMultiTexCoord3hvNV)this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&CaptureTableDecorator::m_glMultiTexCoord3hvNV_capture;
+this->m_orig_glMatrixPushEXT = this->m_ptr_glMatrixPushEXT;
+if(this->m_ptr_glMatrixPushEXT)this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&CaptureTableDecorator::m_glMatrixPushEXT_capture;
+this->m_orig_glProgramUniform2fEXT = this->m_ptr_glProgramUniform2fEXT;
+if(this->m_ptr_glProgramUniform2fEXT)this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&CaptureTableDecorator::m_glProgramUniform2fEXT_capture;
+this->m_orig_glGetVertexArrayIndexediv = this->m_ptr_glGetVertexArrayIndexediv;
+if(this->m_ptr_glGetVertexArrayIndexediv)this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&CaptureTableDecorator::m_glGetVertexArrayIndexediv_capture;
+this->m_orig_glBlitFramebuffer = this->m_ptr_glBlitFramebuffer;
+if(this->m_ptr_glBlitFramebuffer)this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&CaptureTableDecorator::m_glBlitFramebuffer_capture;
+this->m_orig_glMultiTexCoordP2ui = this->m_ptr_glMultiTexCoordP2ui;
+if(this->m_ptr_glMultiTexCoordP2ui)this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&CaptureTableDecorator::m_glMultiTexCoordP2ui_capture;
+this->m_orig_glColorPointerListIBM = this->m_ptr_glColorPointerListIBM;
+if(this->m_ptr_glColorPointerListIBM)this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glColorPointerListIBM_capture;
+this->m_orig_glVertexAttribL4d = this->m_ptr_glVertexAttribL4d;
+if(this->m_ptr_glVertexAttribL4d)this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&CaptureTableDecorator::m_glVertexAttribL4d_capture;
+this->m_orig_glGetFragmentMaterialfvSGIX = this->m_ptr_glGetFragmentMaterialfvSGIX;
+if(this->m_ptr_glGetFragmentMaterialfvSGIX)this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&CaptureTableDecorator::m_glGetFragmentMaterialfvSGIX_capture;
+this->m_orig_glVertex2iv = this->m_ptr_glVertex2iv;
+if(this->m_ptr_glVertex2iv)this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&CaptureTableDecorator::m_glVertex2iv_capture;
+this->m_orig_glGetTexEnvxvOES = this->m_ptr_glGetTexEnvxvOES;
+if(this->m_ptr_glGetTexEnvxvOES)this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&CaptureTableDecorator::m_glGetTexEnvxvOES_capture;
+this->m_orig_glUniformMatrix3dv = this->m_ptr_glUniformMatrix3dv;
+if(this->m_ptr_glUniformMatrix3dv)this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&CaptureTableDecorator::m_glUniformMatrix3dv_capture;
+this->m_orig_glGetVertexAttribLdvEXT = this->m_ptr_glGetVertexAttribLdvEXT;
+if(this->m_ptr_glGetVertexAttribLdvEXT)this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&CaptureTableDecorator::m_glGetVertexAttribLdvEXT_capture;
+this->m_orig_glTexCoordP3uiv = this->m_ptr_glTexCoordP3uiv;
+if(this->m_ptr_glTexCoordP3uiv)this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&CaptureTableDecorator::m_glTexCoordP3uiv_capture;
+this->m_orig_glDeformationMap3dSGIX = this->m_ptr_glDeformationMap3dSGIX;
+if(this->m_ptr_glDeformationMap3dSGIX)this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&CaptureTableDecorator::m_glDeformationMap3dSGIX_capture;
+this->m_orig_glResumeTransformFeedback = this->m_ptr_glResumeTransformFeedback;
+if(this->m_ptr_glResumeTransformFeedback)this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glResumeTransformFeedback_capture;
+this->m_orig_glInsertEventMarkerEXT = this->m_ptr_glInsertEventMarkerEXT;
+if(this->m_ptr_glInsertEventMarkerEXT)this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&CaptureTableDecorator::m_glInsertEventMarkerEXT_capture;
+this->m_orig_glTessellationModeAMD = this->m_ptr_glTessellationModeAMD;
+if(this->m_ptr_glTessellationModeAMD)this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&CaptureTableDecorator::m_glTessellationModeAMD_capture;
+this->m_orig_glDrawCommandsAddressNV = this->m_ptr_glDrawCommandsAddressNV;
+if(this->m_ptr_glDrawCommandsAddressNV)this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&CaptureTableDecorator::m_glDrawCommandsAddressNV_capture;
+this->m_orig_glFogi = this->m_ptr_glFogi;
+if(this->m_ptr_glFogi)this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&CaptureTableDecorator::m_glFogi_capture;
+this->m_orig_glGetTexParameterxvOES = this->m_ptr_glGetTexParameterxvOES;
+if(this->m_ptr_glGetTexParameterxvOES)this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&CaptureTableDecorator::m_glGetTexParameterxvOES_capture;
+this->m_orig_glVertexPointer = this->m_ptr_glVertexPointer;
+if(this->m_ptr_glVertexPointer)this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&CaptureTableDecorator::m_glVertexPointer_capture;
+this->m_orig_glGetPerfMonitorCounterDataAMD = this->m_ptr_glGetPerfMonitorCounterDataAMD;
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD)this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorCounterDataAMD_capture;
+this->m_orig_glFogf = this->m_ptr_glFogf;
+if(this->m_ptr_glFogf)this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&CaptureTableDecorator::m_glFogf_capture;
+this->m_orig_glMultiTexCoord1d = this->m_ptr_glMultiTexCoord1d;
+if(this->m_ptr_glMultiTexCoord1d)this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&CaptureTableDecorator::m_glMultiTexCoord1d_capture;
+this->m_orig_glMultiTexCoord1f = this->m_ptr_glMultiTexCoord1f;
+if(this->m_ptr_glMultiTexCoord1f)this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&CaptureTableDecorator::m_glMultiTexCoord1f_capture;
+this->m_orig_glGetMultiTexParameterivEXT = this->m_ptr_glGetMultiTexParameterivEXT;
+if(this->m_ptr_glGetMultiTexParameterivEXT)this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexParameterivEXT_capture;
+this->m_orig_glProgramUniformMatrix3x4fvEXT = this->m_ptr_glProgramUniformMatrix3x4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT)this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x4fvEXT_capture;
+this->m_orig_glVertexAttribI2i = this->m_ptr_glVertexAttribI2i;
+if(this->m_ptr_glVertexAttribI2i)this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&CaptureTableDecorator::m_glVertexAttribI2i_capture;
+this->m_orig_glMultiTexCoord1i = this->m_ptr_glMultiTexCoord1i;
+if(this->m_ptr_glMultiTexCoord1i)this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&CaptureTableDecorator::m_glMultiTexCoord1i_capture;
+this->m_orig_glDeleteSemaphoresEXT = this->m_ptr_glDeleteSemaphoresEXT;
+if(this->m_ptr_glDeleteSemaphoresEXT)this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&CaptureTableDecorator::m_glDeleteSemaphoresEXT_capture;
+this->m_orig_glLoadProgramNV = this->m_ptr_glLoadProgramNV;
+if(this->m_ptr_glLoadProgramNV)this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&CaptureTableDecorator::m_glLoadProgramNV_capture;
+this->m_orig_glWriteMaskEXT = this->m_ptr_glWriteMaskEXT;
+if(this->m_ptr_glWriteMaskEXT)this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&CaptureTableDecorator::m_glWriteMaskEXT_capture;
+this->m_orig_glGetGraphicsResetStatus = this->m_ptr_glGetGraphicsResetStatus;
+if(this->m_ptr_glGetGraphicsResetStatus)this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&CaptureTableDecorator::m_glGetGraphicsResetStatus_capture;
+this->m_orig_glVertexAttrib1fv = this->m_ptr_glVertexAttrib1fv;
+if(this->m_ptr_glVertexAttrib1fv)this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&CaptureTableDecorator::m_glVertexAttrib1fv_capture;
+this->m_orig_glMultiTexCoord1s = this->m_ptr_glMultiTexCoord1s;
+if(this->m_ptr_glMultiTexCoord1s)this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&CaptureTableDecorator::m_glMultiTexCoord1s_capture;
+this->m_orig_glImageTransformParameterfvHP = this->m_ptr_glImageTransformParameterfvHP;
+if(this->m_ptr_glImageTransformParameterfvHP)this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&CaptureTableDecorator::m_glImageTransformParameterfvHP_capture;
+this->m_orig_glFramebufferTexture2D = this->m_ptr_glFramebufferTexture2D;
+if(this->m_ptr_glFramebufferTexture2D)this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&CaptureTableDecorator::m_glFramebufferTexture2D_capture;
+this->m_orig_glGetFragmentLightfvSGIX = this->m_ptr_glGetFragmentLightfvSGIX;
+if(this->m_ptr_glGetFragmentLightfvSGIX)this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&CaptureTableDecorator::m_glGetFragmentLightfvSGIX_capture;
+this->m_orig_glListParameterfSGIX = this->m_ptr_glListParameterfSGIX;
+if(this->m_ptr_glListParameterfSGIX)this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&CaptureTableDecorator::m_glListParameterfSGIX_capture;
+this->m_orig_glTexCoord3sv = this->m_ptr_glTexCoord3sv;
+if(this->m_ptr_glTexCoord3sv)this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&CaptureTableDecorator::m_glTexCoord3sv_capture;
+this->m_orig_glNamedFramebufferRenderbufferEXT = this->m_ptr_glNamedFramebufferRenderbufferEXT;
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT)this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glNamedFramebufferRenderbufferEXT_capture;
+this->m_orig_glFragmentLightModelfSGIX = this->m_ptr_glFragmentLightModelfSGIX;
+if(this->m_ptr_glFragmentLightModelfSGIX)this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&CaptureTableDecorator::m_glFragmentLightModelfSGIX_capture;
+this->m_orig_glIndexPointerEXT = this->m_ptr_glIndexPointerEXT;
+if(this->m_ptr_glIndexPointerEXT)this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&CaptureTableDecorator::m_glIndexPointerEXT_capture;
+this->m_orig_glBlendEquationSeparateATI = this->m_ptr_glBlendEquationSeparateATI;
+if(this->m_ptr_glBlendEquationSeparateATI)this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&CaptureTableDecorator::m_glBlendEquationSeparateATI_capture;
+this->m_orig_glVertexArrayAttribIFormat = this->m_ptr_glVertexArrayAttribIFormat;
+if(this->m_ptr_glVertexArrayAttribIFormat)this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&CaptureTableDecorator::m_glVertexArrayAttribIFormat_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_capture;
+this->m_orig_glReplacementCodeubvSUN = this->m_ptr_glReplacementCodeubvSUN;
+if(this->m_ptr_glReplacementCodeubvSUN)this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeubvSUN_capture;
+this->m_orig_glGenFramebuffers = this->m_ptr_glGenFramebuffers;
+if(this->m_ptr_glGenFramebuffers)this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&CaptureTableDecorator::m_glGenFramebuffers_capture;
+this->m_orig_glPixelMapx = this->m_ptr_glPixelMapx;
+if(this->m_ptr_glPixelMapx)this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&CaptureTableDecorator::m_glPixelMapx_capture;
+this->m_orig_glTexSubImage3DEXT = this->m_ptr_glTexSubImage3DEXT;
+if(this->m_ptr_glTexSubImage3DEXT)this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glTexSubImage3DEXT_capture;
+this->m_orig_glGetAttachedShaders = this->m_ptr_glGetAttachedShaders;
+if(this->m_ptr_glGetAttachedShaders)this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&CaptureTableDecorator::m_glGetAttachedShaders_capture;
+this->m_orig_glGetPixelTexGenParameterfvSGIS = this->m_ptr_glGetPixelTexGenParameterfvSGIS;
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS)this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&CaptureTableDecorator::m_glGetPixelTexGenParameterfvSGIS_capture;
+this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_capture;
+this->m_orig_glGetDebugMessageLogAMD = this->m_ptr_glGetDebugMessageLogAMD;
+if(this->m_ptr_glGetDebugMessageLogAMD)this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&CaptureTableDecorator::m_glGetDebugMessageLogAMD_capture;
+this->m_orig_glVertexStream4sATI = this->m_ptr_glVertexStream4sATI;
+if(this->m_ptr_glVertexStream4sATI)this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&CaptureTableDecorator::m_glVertexStream4sATI_capture;
+this->m_orig_glVertexAttribs4dvNV = this->m_ptr_glVertexAttribs4dvNV;
+if(this->m_ptr_glVertexAttribs4dvNV)this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&CaptureTableDecorator::m_glVertexAttribs4dvNV_capture;
+this->m_orig_glGetnMapdvARB = this->m_ptr_glGetnMapdvARB;
+if(this->m_ptr_glGetnMapdvARB)this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&CaptureTableDecorator::m_glGetnMapdvARB_capture;
+this->m_orig_glOrthofOES = this->m_ptr_glOrthofOES;
+if(this->m_ptr_glOrthofOES)this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&CaptureTableDecorator::m_glOrthofOES_capture;
+this->m_orig_glViewportArrayv = this->m_ptr_glViewportArrayv;
+if(this->m_ptr_glViewportArrayv)this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&CaptureTableDecorator::m_glViewportArrayv_capture;
+this->m_orig_glDrawElementArrayATI = this->m_ptr_glDrawElementArrayATI;
+if(this->m_ptr_glDrawElementArrayATI)this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&CaptureTableDecorator::m_glDrawElementArrayATI_capture;
+this->m_orig_glBufferStorageMemEXT = this->m_ptr_glBufferStorageMemEXT;
+if(this->m_ptr_glBufferStorageMemEXT)this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&CaptureTableDecorator::m_glBufferStorageMemEXT_capture;
+this->m_orig_glGetPathColorGenfvNV = this->m_ptr_glGetPathColorGenfvNV;
+if(this->m_ptr_glGetPathColorGenfvNV)this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&CaptureTableDecorator::m_glGetPathColorGenfvNV_capture;
+this->m_orig_glWindowPos3iMESA = this->m_ptr_glWindowPos3iMESA;
+if(this->m_ptr_glWindowPos3iMESA)this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&CaptureTableDecorator::m_glWindowPos3iMESA_capture;
+this->m_orig_glMultiTexCoord2s = this->m_ptr_glMultiTexCoord2s;
+if(this->m_ptr_glMultiTexCoord2s)this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&CaptureTableDecorator::m_glMultiTexCoord2s_capture;
+this->m_orig_glVertex3dv = this->m_ptr_glVertex3dv;
+if(this->m_ptr_glVertex3dv)this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&CaptureTableDecorator::m_glVertex3dv_capture;
+this->m_orig_glVertexAttribI3uivEXT = this->m_ptr_glVertexAttribI3uivEXT;
+if(this->m_ptr_glVertexAttribI3uivEXT)this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI3uivEXT_capture;
+this->m_orig_glUniform3ui64ARB = this->m_ptr_glUniform3ui64ARB;
+if(this->m_ptr_glUniform3ui64ARB)this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&CaptureTableDecorator::m_glUniform3ui64ARB_capture;
+this->m_orig_glVertexAttrib2fvNV = this->m_ptr_glVertexAttrib2fvNV;
+if(this->m_ptr_glVertexAttrib2fvNV)this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&CaptureTableDecorator::m_glVertexAttrib2fvNV_capture;
+this->m_orig_glGetNamedBufferSubDataEXT = this->m_ptr_glGetNamedBufferSubDataEXT;
+if(this->m_ptr_glGetNamedBufferSubDataEXT)this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&CaptureTableDecorator::m_glGetNamedBufferSubDataEXT_capture;
+this->m_orig_glConvolutionFilter2D = this->m_ptr_glConvolutionFilter2D;
+if(this->m_ptr_glConvolutionFilter2D)this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&CaptureTableDecorator::m_glConvolutionFilter2D_capture;
+this->m_orig_glMemoryBarrierByRegion = this->m_ptr_glMemoryBarrierByRegion;
+if(this->m_ptr_glMemoryBarrierByRegion)this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&CaptureTableDecorator::m_glMemoryBarrierByRegion_capture;
+this->m_orig_glVertexArrayBindingDivisor = this->m_ptr_glVertexArrayBindingDivisor;
+if(this->m_ptr_glVertexArrayBindingDivisor)this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&CaptureTableDecorator::m_glVertexArrayBindingDivisor_capture;
+this->m_orig_glMatrixRotatedEXT = this->m_ptr_glMatrixRotatedEXT;
+if(this->m_ptr_glMatrixRotatedEXT)this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&CaptureTableDecorator::m_glMatrixRotatedEXT_capture;
+this->m_orig_glTexCoord2sv = this->m_ptr_glTexCoord2sv;
+if(this->m_ptr_glTexCoord2sv)this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&CaptureTableDecorator::m_glTexCoord2sv_capture;
+this->m_orig_glIsProgramNV = this->m_ptr_glIsProgramNV;
+if(this->m_ptr_glIsProgramNV)this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&CaptureTableDecorator::m_glIsProgramNV_capture;
+this->m_orig_glUniform2dv = this->m_ptr_glUniform2dv;
+if(this->m_ptr_glUniform2dv)this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&CaptureTableDecorator::m_glUniform2dv_capture;
+this->m_orig_glGetPixelMapuiv = this->m_ptr_glGetPixelMapuiv;
+if(this->m_ptr_glGetPixelMapuiv)this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&CaptureTableDecorator::m_glGetPixelMapuiv_capture;
+this->m_orig_glDepthBoundsEXT = this->m_ptr_glDepthBoundsEXT;
+if(this->m_ptr_glDepthBoundsEXT)this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&CaptureTableDecorator::m_glDepthBoundsEXT_capture;
+this->m_orig_glVertexAttrib4hvNV = this->m_ptr_glVertexAttrib4hvNV;
+if(this->m_ptr_glVertexAttrib4hvNV)this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&CaptureTableDecorator::m_glVertexAttrib4hvNV_capture;
+this->m_orig_glMultiTexParameteriEXT = this->m_ptr_glMultiTexParameteriEXT;
+if(this->m_ptr_glMultiTexParameteriEXT)this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&CaptureTableDecorator::m_glMultiTexParameteriEXT_capture;
+this->m_orig_glGetPointerv = this->m_ptr_glGetPointerv;
+if(this->m_ptr_glGetPointerv)this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&CaptureTableDecorator::m_glGetPointerv_capture;
+this->m_orig_glPathCommandsNV = this->m_ptr_glPathCommandsNV;
+if(this->m_ptr_glPathCommandsNV)this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&CaptureTableDecorator::m_glPathCommandsNV_capture;
+this->m_orig_glGetListParameterfvSGIX = this->m_ptr_glGetListParameterfvSGIX;
+if(this->m_ptr_glGetListParameterfvSGIX)this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&CaptureTableDecorator::m_glGetListParameterfvSGIX_capture;
+this->m_orig_glGetUniformuiv = this->m_ptr_glGetUniformuiv;
+if(this->m_ptr_glGetUniformuiv)this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&CaptureTableDecorator::m_glGetUniformuiv_capture;
+this->m_orig_glDebugMessageInsertAMD = this->m_ptr_glDebugMessageInsertAMD;
+if(this->m_ptr_glDebugMessageInsertAMD)this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&CaptureTableDecorator::m_glDebugMessageInsertAMD_capture;
+this->m_orig_glFrustum = this->m_ptr_glFrustum;
+if(this->m_ptr_glFrustum)this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&CaptureTableDecorator::m_glFrustum_capture;
+this->m_orig_glVertexAttribL1ui64vNV = this->m_ptr_glVertexAttribL1ui64vNV;
+if(this->m_ptr_glVertexAttribL1ui64vNV)this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL1ui64vNV_capture;
+this->m_orig_glClearColorxOES = this->m_ptr_glClearColorxOES;
+if(this->m_ptr_glClearColorxOES)this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&CaptureTableDecorator::m_glClearColorxOES_capture;
+this->m_orig_glProgramUniformMatrix3fv = this->m_ptr_glProgramUniformMatrix3fv;
+if(this->m_ptr_glProgramUniformMatrix3fv)this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3fv_capture;
+this->m_orig_glSampleMaskIndexedNV = this->m_ptr_glSampleMaskIndexedNV;
+if(this->m_ptr_glSampleMaskIndexedNV)this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&CaptureTableDecorator::m_glSampleMaskIndexedNV_capture;
+this->m_orig_glCompileShaderIncludeARB = this->m_ptr_glCompileShaderIncludeARB;
+if(this->m_ptr_glCompileShaderIncludeARB)this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&CaptureTableDecorator::m_glCompileShaderIncludeARB_capture;
+this->m_orig_glGetArrayObjectfvATI = this->m_ptr_glGetArrayObjectfvATI;
+if(this->m_ptr_glGetArrayObjectfvATI)this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&CaptureTableDecorator::m_glGetArrayObjectfvATI_capture;
+this->m_orig_glVertexStream4svATI = this->m_ptr_glVertexStream4svATI;
+if(this->m_ptr_glVertexStream4svATI)this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&CaptureTableDecorator::m_glVertexStream4svATI_capture;
+this->m_orig_glMultiTexCoord4iARB = this->m_ptr_glMultiTexCoord4iARB;
+if(this->m_ptr_glMultiTexCoord4iARB)this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4iARB_capture;
+this->m_orig_glVariantfvEXT = this->m_ptr_glVariantfvEXT;
+if(this->m_ptr_glVariantfvEXT)this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&CaptureTableDecorator::m_glVariantfvEXT_capture;
+this->m_orig_glMatrixLoadfEXT = this->m_ptr_glMatrixLoadfEXT;
+if(this->m_ptr_glMatrixLoadfEXT)this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&CaptureTableDecorator::m_glMatrixLoadfEXT_capture;
+this->m_orig_glLoadIdentityDeformationMapSGIX = this->m_ptr_glLoadIdentityDeformationMapSGIX;
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX)this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&CaptureTableDecorator::m_glLoadIdentityDeformationMapSGIX_capture;
+this->m_orig_glGetRenderbufferParameteriv = this->m_ptr_glGetRenderbufferParameteriv;
+if(this->m_ptr_glGetRenderbufferParameteriv)this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetRenderbufferParameteriv_capture;
+this->m_orig_glProgramUniform3fEXT = this->m_ptr_glProgramUniform3fEXT;
+if(this->m_ptr_glProgramUniform3fEXT)this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&CaptureTableDecorator::m_glProgramUniform3fEXT_capture;
+this->m_orig_glNamedRenderbufferStorage = this->m_ptr_glNamedRenderbufferStorage;
+if(this->m_ptr_glNamedRenderbufferStorage)this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&CaptureTableDecorator::m_glNamedRenderbufferStorage_capture;
+this->m_orig_glBindFragDataLocation = this->m_ptr_glBindFragDataLocation;
+if(this->m_ptr_glBindFragDataLocation)this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&CaptureTableDecorator::m_glBindFragDataLocation_capture;
+this->m_orig_glPolygonOffsetClamp = this->m_ptr_glPolygonOffsetClamp;
+if(this->m_ptr_glPolygonOffsetClamp)this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&CaptureTableDecorator::m_glPolygonOffsetClamp_capture;
+this->m_orig_glFogCoordPointerListIBM = this->m_ptr_glFogCoordPointerListIBM;
+if(this->m_ptr_glFogCoordPointerListIBM)this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glFogCoordPointerListIBM_capture;
+this->m_orig_glFenceSync = this->m_ptr_glFenceSync;
+if(this->m_ptr_glFenceSync)this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&CaptureTableDecorator::m_glFenceSync_capture;
+this->m_orig_glGetVertexAttribIivEXT = this->m_ptr_glGetVertexAttribIivEXT;
+if(this->m_ptr_glGetVertexAttribIivEXT)this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&CaptureTableDecorator::m_glGetVertexAttribIivEXT_capture;
+this->m_orig_glFramebufferDrawBuffersEXT = this->m_ptr_glFramebufferDrawBuffersEXT;
+if(this->m_ptr_glFramebufferDrawBuffersEXT)this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&CaptureTableDecorator::m_glFramebufferDrawBuffersEXT_capture;
+this->m_orig_glVertexAttribs4fvNV = this->m_ptr_glVertexAttribs4fvNV;
+if(this->m_ptr_glVertexAttribs4fvNV)this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&CaptureTableDecorator::m_glVertexAttribs4fvNV_capture;
+this->m_orig_glPauseTransformFeedbackNV = this->m_ptr_glPauseTransformFeedbackNV;
+if(this->m_ptr_glPauseTransformFeedbackNV)this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glPauseTransformFeedbackNV_capture;
+this->m_orig_glGetQueryObjecti64vEXT = this->m_ptr_glGetQueryObjecti64vEXT;
+if(this->m_ptr_glGetQueryObjecti64vEXT)this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&CaptureTableDecorator::m_glGetQueryObjecti64vEXT_capture;
+this->m_orig_glVDPAUSurfaceAccessNV = this->m_ptr_glVDPAUSurfaceAccessNV;
+if(this->m_ptr_glVDPAUSurfaceAccessNV)this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&CaptureTableDecorator::m_glVDPAUSurfaceAccessNV_capture;
+this->m_orig_glValidateProgramPipeline = this->m_ptr_glValidateProgramPipeline;
+if(this->m_ptr_glValidateProgramPipeline)this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&CaptureTableDecorator::m_glValidateProgramPipeline_capture;
+this->m_orig_glTexPageCommitmentARB = this->m_ptr_glTexPageCommitmentARB;
+if(this->m_ptr_glTexPageCommitmentARB)this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&CaptureTableDecorator::m_glTexPageCommitmentARB_capture;
+this->m_orig_glWindowPos3dvARB = this->m_ptr_glWindowPos3dvARB;
+if(this->m_ptr_glWindowPos3dvARB)this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&CaptureTableDecorator::m_glWindowPos3dvARB_capture;
+this->m_orig_glStencilStrokePathInstancedNV = this->m_ptr_glStencilStrokePathInstancedNV;
+if(this->m_ptr_glStencilStrokePathInstancedNV)this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glStencilStrokePathInstancedNV_capture;
+this->m_orig_glFogfv = this->m_ptr_glFogfv;
+if(this->m_ptr_glFogfv)this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&CaptureTableDecorator::m_glFogfv_capture;
+this->m_orig_glGenQueriesARB = this->m_ptr_glGenQueriesARB;
+if(this->m_ptr_glGenQueriesARB)this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&CaptureTableDecorator::m_glGenQueriesARB_capture;
+this->m_orig_glProgramUniform2i64NV = this->m_ptr_glProgramUniform2i64NV;
+if(this->m_ptr_glProgramUniform2i64NV)this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&CaptureTableDecorator::m_glProgramUniform2i64NV_capture;
+this->m_orig_glVertexP4ui = this->m_ptr_glVertexP4ui;
+if(this->m_ptr_glVertexP4ui)this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&CaptureTableDecorator::m_glVertexP4ui_capture;
+this->m_orig_glVertexStream1ivATI = this->m_ptr_glVertexStream1ivATI;
+if(this->m_ptr_glVertexStream1ivATI)this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&CaptureTableDecorator::m_glVertexStream1ivATI_capture;
+this->m_orig_glProgramEnvParameterI4iNV = this->m_ptr_glProgramEnvParameterI4iNV;
+if(this->m_ptr_glProgramEnvParameterI4iNV)this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&CaptureTableDecorator::m_glProgramEnvParameterI4iNV_capture;
+this->m_orig_glGenVertexArraysAPPLE = this->m_ptr_glGenVertexArraysAPPLE;
+if(this->m_ptr_glGenVertexArraysAPPLE)this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&CaptureTableDecorator::m_glGenVertexArraysAPPLE_capture;
+this->m_orig_glDrawTransformFeedbackInstanced = this->m_ptr_glDrawTransformFeedbackInstanced;
+if(this->m_ptr_glDrawTransformFeedbackInstanced)this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&CaptureTableDecorator::m_glDrawTransformFeedbackInstanced_capture;
+this->m_orig_glStencilThenCoverStrokePathNV = this->m_ptr_glStencilThenCoverStrokePathNV;
+if(this->m_ptr_glStencilThenCoverStrokePathNV)this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&CaptureTableDecorator::m_glStencilThenCoverStrokePathNV_capture;
+this->m_orig_glDeleteVertexArraysAPPLE = this->m_ptr_glDeleteVertexArraysAPPLE;
+if(this->m_ptr_glDeleteVertexArraysAPPLE)this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&CaptureTableDecorator::m_glDeleteVertexArraysAPPLE_capture;
+this->m_orig_glGetNamedBufferParameterui64vNV = this->m_ptr_glGetNamedBufferParameterui64vNV;
+if(this->m_ptr_glGetNamedBufferParameterui64vNV)this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&CaptureTableDecorator::m_glGetNamedBufferParameterui64vNV_capture;
+this->m_orig_glQueryMatrixxOES = this->m_ptr_glQueryMatrixxOES;
+if(this->m_ptr_glQueryMatrixxOES)this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&CaptureTableDecorator::m_glQueryMatrixxOES_capture;
+this->m_orig_glSecondaryColor3usv = this->m_ptr_glSecondaryColor3usv;
+if(this->m_ptr_glSecondaryColor3usv)this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&CaptureTableDecorator::m_glSecondaryColor3usv_capture;
+this->m_orig_glTranslatexOES = this->m_ptr_glTranslatexOES;
+if(this->m_ptr_glTranslatexOES)this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&CaptureTableDecorator::m_glTranslatexOES_capture;
+this->m_orig_glDrawTransformFeedback = this->m_ptr_glDrawTransformFeedback;
+if(this->m_ptr_glDrawTransformFeedback)this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glDrawTransformFeedback_capture;
+this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_capture;
+this->m_orig_glVDPAURegisterVideoSurfaceNV = this->m_ptr_glVDPAURegisterVideoSurfaceNV;
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV)this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&CaptureTableDecorator::m_glVDPAURegisterVideoSurfaceNV_capture;
+this->m_orig_glGetTexParameterIuiv = this->m_ptr_glGetTexParameterIuiv;
+if(this->m_ptr_glGetTexParameterIuiv)this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&CaptureTableDecorator::m_glGetTexParameterIuiv_capture;
+this->m_orig_glBindBufferBaseNV = this->m_ptr_glBindBufferBaseNV;
+if(this->m_ptr_glBindBufferBaseNV)this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&CaptureTableDecorator::m_glBindBufferBaseNV_capture;
+this->m_orig_glIndexPointer = this->m_ptr_glIndexPointer;
+if(this->m_ptr_glIndexPointer)this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&CaptureTableDecorator::m_glIndexPointer_capture;
+this->m_orig_glGenQueryResourceTagNV = this->m_ptr_glGenQueryResourceTagNV;
+if(this->m_ptr_glGenQueryResourceTagNV)this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&CaptureTableDecorator::m_glGenQueryResourceTagNV_capture;
+this->m_orig_glVertexAttrib4Nbv = this->m_ptr_glVertexAttrib4Nbv;
+if(this->m_ptr_glVertexAttrib4Nbv)this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&CaptureTableDecorator::m_glVertexAttrib4Nbv_capture;
+this->m_orig_glListParameteriSGIX = this->m_ptr_glListParameteriSGIX;
+if(this->m_ptr_glListParameteriSGIX)this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&CaptureTableDecorator::m_glListParameteriSGIX_capture;
+this->m_orig_glBlendColorxOES = this->m_ptr_glBlendColorxOES;
+if(this->m_ptr_glBlendColorxOES)this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&CaptureTableDecorator::m_glBlendColorxOES_capture;
+this->m_orig_glUniformui64vNV = this->m_ptr_glUniformui64vNV;
+if(this->m_ptr_glUniformui64vNV)this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&CaptureTableDecorator::m_glUniformui64vNV_capture;
+this->m_orig_glIsSync = this->m_ptr_glIsSync;
+if(this->m_ptr_glIsSync)this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&CaptureTableDecorator::m_glIsSync_capture;
+this->m_orig_glGetTextureParameterivEXT = this->m_ptr_glGetTextureParameterivEXT;
+if(this->m_ptr_glGetTextureParameterivEXT)this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetTextureParameterivEXT_capture;
+this->m_orig_glFogCoordhvNV = this->m_ptr_glFogCoordhvNV;
+if(this->m_ptr_glFogCoordhvNV)this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&CaptureTableDecorator::m_glFogCoordhvNV_capture;
+this->m_orig_glFramebufferTextureLayerEXT = this->m_ptr_glFramebufferTextureLayerEXT;
+if(this->m_ptr_glFramebufferTextureLayerEXT)this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&CaptureTableDecorator::m_glFramebufferTextureLayerEXT_capture;
+this->m_orig_glGetObjectPtrLabel = this->m_ptr_glGetObjectPtrLabel;
+if(this->m_ptr_glGetObjectPtrLabel)this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&CaptureTableDecorator::m_glGetObjectPtrLabel_capture;
+this->m_orig_glTextureParameteri = this->m_ptr_glTextureParameteri;
+if(this->m_ptr_glTextureParameteri)this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&CaptureTableDecorator::m_glTextureParameteri_capture;
+this->m_orig_glMultiTexCoord1fARB = this->m_ptr_glMultiTexCoord1fARB;
+if(this->m_ptr_glMultiTexCoord1fARB)this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1fARB_capture;
+this->m_orig_glUniformMatrix2x3dv = this->m_ptr_glUniformMatrix2x3dv;
+if(this->m_ptr_glUniformMatrix2x3dv)this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&CaptureTableDecorator::m_glUniformMatrix2x3dv_capture;
+this->m_orig_glFramebufferDrawBufferEXT = this->m_ptr_glFramebufferDrawBufferEXT;
+if(this->m_ptr_glFramebufferDrawBufferEXT)this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&CaptureTableDecorator::m_glFramebufferDrawBufferEXT_capture;
+this->m_orig_glCopyColorSubTable = this->m_ptr_glCopyColorSubTable;
+if(this->m_ptr_glCopyColorSubTable)this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&CaptureTableDecorator::m_glCopyColorSubTable_capture;
+this->m_orig_glGetNamedFramebufferParameterfvAMD = this->m_ptr_glGetNamedFramebufferParameterfvAMD;
+if(this->m_ptr_glGetNamedFramebufferParameterfvAMD)this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&CaptureTableDecorator::m_glGetNamedFramebufferParameterfvAMD_capture;
+this->m_orig_glVertexAttribL3d = this->m_ptr_glVertexAttribL3d;
+if(this->m_ptr_glVertexAttribL3d)this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&CaptureTableDecorator::m_glVertexAttribL3d_capture;
+this->m_orig_glFragmentMaterialfvSGIX = this->m_ptr_glFragmentMaterialfvSGIX;
+if(this->m_ptr_glFragmentMaterialfvSGIX)this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&CaptureTableDecorator::m_glFragmentMaterialfvSGIX_capture;
+this->m_orig_glMatrixLoadTranspose3x3fNV = this->m_ptr_glMatrixLoadTranspose3x3fNV;
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV)this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&CaptureTableDecorator::m_glMatrixLoadTranspose3x3fNV_capture;
+this->m_orig_glDeleteNamesAMD = this->m_ptr_glDeleteNamesAMD;
+if(this->m_ptr_glDeleteNamesAMD)this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&CaptureTableDecorator::m_glDeleteNamesAMD_capture;
+this->m_orig_glDrawRangeElementsEXT = this->m_ptr_glDrawRangeElementsEXT;
+if(this->m_ptr_glDrawRangeElementsEXT)this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&CaptureTableDecorator::m_glDrawRangeElementsEXT_capture;
+this->m_orig_glOrtho = this->m_ptr_glOrtho;
+if(this->m_ptr_glOrtho)this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&CaptureTableDecorator::m_glOrtho_capture;
+this->m_orig_glProgramUniform1dvEXT = this->m_ptr_glProgramUniform1dvEXT;
+if(this->m_ptr_glProgramUniform1dvEXT)this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&CaptureTableDecorator::m_glProgramUniform1dvEXT_capture;
+this->m_orig_glColor4xOES = this->m_ptr_glColor4xOES;
+if(this->m_ptr_glColor4xOES)this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&CaptureTableDecorator::m_glColor4xOES_capture;
+this->m_orig_glTexImage4DSGIS = this->m_ptr_glTexImage4DSGIS;
+if(this->m_ptr_glTexImage4DSGIS)this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&CaptureTableDecorator::m_glTexImage4DSGIS_capture;
+this->m_orig_glProgramUniform1ui = this->m_ptr_glProgramUniform1ui;
+if(this->m_ptr_glProgramUniform1ui)this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&CaptureTableDecorator::m_glProgramUniform1ui_capture;
+this->m_orig_glDeleteBuffersARB = this->m_ptr_glDeleteBuffersARB;
+if(this->m_ptr_glDeleteBuffersARB)this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&CaptureTableDecorator::m_glDeleteBuffersARB_capture;
+this->m_orig_glUnmapBufferARB = this->m_ptr_glUnmapBufferARB;
+if(this->m_ptr_glUnmapBufferARB)this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&CaptureTableDecorator::m_glUnmapBufferARB_capture;
+this->m_orig_glCopyTexImage2D = this->m_ptr_glCopyTexImage2D;
+if(this->m_ptr_glCopyTexImage2D)this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&CaptureTableDecorator::m_glCopyTexImage2D_capture;
+this->m_orig_glMaterialxOES = this->m_ptr_glMaterialxOES;
+if(this->m_ptr_glMaterialxOES)this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&CaptureTableDecorator::m_glMaterialxOES_capture;
+this->m_orig_glProgramUniformMatrix2x4fvEXT = this->m_ptr_glProgramUniformMatrix2x4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT)this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x4fvEXT_capture;
+this->m_orig_glTestObjectAPPLE = this->m_ptr_glTestObjectAPPLE;
+if(this->m_ptr_glTestObjectAPPLE)this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&CaptureTableDecorator::m_glTestObjectAPPLE_capture;
+this->m_orig_glRenderbufferStorageEXT = this->m_ptr_glRenderbufferStorageEXT;
+if(this->m_ptr_glRenderbufferStorageEXT)this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&CaptureTableDecorator::m_glRenderbufferStorageEXT_capture;
+this->m_orig_glVertexAttribL1ui64ARB = this->m_ptr_glVertexAttribL1ui64ARB;
+if(this->m_ptr_glVertexAttribL1ui64ARB)this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&CaptureTableDecorator::m_glVertexAttribL1ui64ARB_capture;
+this->m_orig_glEndFragmentShaderATI = this->m_ptr_glEndFragmentShaderATI;
+if(this->m_ptr_glEndFragmentShaderATI)this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&CaptureTableDecorator::m_glEndFragmentShaderATI_capture;
+this->m_orig_glPathParameterivNV = this->m_ptr_glPathParameterivNV;
+if(this->m_ptr_glPathParameterivNV)this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&CaptureTableDecorator::m_glPathParameterivNV_capture;
+this->m_orig_glUniform4uiv = this->m_ptr_glUniform4uiv;
+if(this->m_ptr_glUniform4uiv)this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&CaptureTableDecorator::m_glUniform4uiv_capture;
+this->m_orig_glFrameZoomSGIX = this->m_ptr_glFrameZoomSGIX;
+if(this->m_ptr_glFrameZoomSGIX)this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&CaptureTableDecorator::m_glFrameZoomSGIX_capture;
+this->m_orig_glSecondaryColor3fEXT = this->m_ptr_glSecondaryColor3fEXT;
+if(this->m_ptr_glSecondaryColor3fEXT)this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3fEXT_capture;
+this->m_orig_glLGPUInterlockNVX = this->m_ptr_glLGPUInterlockNVX;
+if(this->m_ptr_glLGPUInterlockNVX)this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&CaptureTableDecorator::m_glLGPUInterlockNVX_capture;
+this->m_orig_glVertexAttribL1dv = this->m_ptr_glVertexAttribL1dv;
+if(this->m_ptr_glVertexAttribL1dv)this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&CaptureTableDecorator::m_glVertexAttribL1dv_capture;
+this->m_orig_glNormalStream3svATI = this->m_ptr_glNormalStream3svATI;
+if(this->m_ptr_glNormalStream3svATI)this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&CaptureTableDecorator::m_glNormalStream3svATI_capture;
+this->m_orig_glPathStencilFuncNV = this->m_ptr_glPathStencilFuncNV;
+if(this->m_ptr_glPathStencilFuncNV)this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&CaptureTableDecorator::m_glPathStencilFuncNV_capture;
+this->m_orig_glSetInvariantEXT = this->m_ptr_glSetInvariantEXT;
+if(this->m_ptr_glSetInvariantEXT)this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&CaptureTableDecorator::m_glSetInvariantEXT_capture;
+this->m_orig_glGetTexBumpParameterivATI = this->m_ptr_glGetTexBumpParameterivATI;
+if(this->m_ptr_glGetTexBumpParameterivATI)this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&CaptureTableDecorator::m_glGetTexBumpParameterivATI_capture;
+this->m_orig_glBlendEquationSeparateEXT = this->m_ptr_glBlendEquationSeparateEXT;
+if(this->m_ptr_glBlendEquationSeparateEXT)this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&CaptureTableDecorator::m_glBlendEquationSeparateEXT_capture;
+this->m_orig_glEndOcclusionQueryNV = this->m_ptr_glEndOcclusionQueryNV;
+if(this->m_ptr_glEndOcclusionQueryNV)this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&CaptureTableDecorator::m_glEndOcclusionQueryNV_capture;
+this->m_orig_glScissorArrayv = this->m_ptr_glScissorArrayv;
+if(this->m_ptr_glScissorArrayv)this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&CaptureTableDecorator::m_glScissorArrayv_capture;
+this->m_orig_glCallList = this->m_ptr_glCallList;
+if(this->m_ptr_glCallList)this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&CaptureTableDecorator::m_glCallList_capture;
+this->m_orig_glMapTexture2DINTEL = this->m_ptr_glMapTexture2DINTEL;
+if(this->m_ptr_glMapTexture2DINTEL)this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&CaptureTableDecorator::m_glMapTexture2DINTEL_capture;
+this->m_orig_glGetVkProcAddrNV = this->m_ptr_glGetVkProcAddrNV;
+if(this->m_ptr_glGetVkProcAddrNV)this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&CaptureTableDecorator::m_glGetVkProcAddrNV_capture;
+this->m_orig_glPixelTransferxOES = this->m_ptr_glPixelTransferxOES;
+if(this->m_ptr_glPixelTransferxOES)this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&CaptureTableDecorator::m_glPixelTransferxOES_capture;
+this->m_orig_glDeleteRenderbuffersEXT = this->m_ptr_glDeleteRenderbuffersEXT;
+if(this->m_ptr_glDeleteRenderbuffersEXT)this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&CaptureTableDecorator::m_glDeleteRenderbuffersEXT_capture;
+this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&CaptureTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_capture;
+this->m_orig_glProgramUniformMatrix4dvEXT = this->m_ptr_glProgramUniformMatrix4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4dvEXT)this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4dvEXT_capture;
+this->m_orig_glGetnColorTable = this->m_ptr_glGetnColorTable;
+if(this->m_ptr_glGetnColorTable)this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&CaptureTableDecorator::m_glGetnColorTable_capture;
+this->m_orig_glFramebufferTextureLayerARB = this->m_ptr_glFramebufferTextureLayerARB;
+if(this->m_ptr_glFramebufferTextureLayerARB)this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&CaptureTableDecorator::m_glFramebufferTextureLayerARB_capture;
+this->m_orig_glVertexAttribL2dvEXT = this->m_ptr_glVertexAttribL2dvEXT;
+if(this->m_ptr_glVertexAttribL2dvEXT)this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&CaptureTableDecorator::m_glVertexAttribL2dvEXT_capture;
+this->m_orig_glGetCombinerStageParameterfvNV = this->m_ptr_glGetCombinerStageParameterfvNV;
+if(this->m_ptr_glGetCombinerStageParameterfvNV)this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetCombinerStageParameterfvNV_capture;
+this->m_orig_glMultiTexCoord1xvOES = this->m_ptr_glMultiTexCoord1xvOES;
+if(this->m_ptr_glMultiTexCoord1xvOES)this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord1xvOES_capture;
+this->m_orig_glMapBuffer = this->m_ptr_glMapBuffer;
+if(this->m_ptr_glMapBuffer)this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&CaptureTableDecorator::m_glMapBuffer_capture;
+this->m_orig_glSecondaryColor3d = this->m_ptr_glSecondaryColor3d;
+if(this->m_ptr_glSecondaryColor3d)this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&CaptureTableDecorator::m_glSecondaryColor3d_capture;
+this->m_orig_glSecondaryColor3f = this->m_ptr_glSecondaryColor3f;
+if(this->m_ptr_glSecondaryColor3f)this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&CaptureTableDecorator::m_glSecondaryColor3f_capture;
+this->m_orig_glVertexAttribLFormat = this->m_ptr_glVertexAttribLFormat;
+if(this->m_ptr_glVertexAttribLFormat)this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&CaptureTableDecorator::m_glVertexAttribLFormat_capture;
+this->m_orig_glElementPointerAPPLE = this->m_ptr_glElementPointerAPPLE;
+if(this->m_ptr_glElementPointerAPPLE)this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&CaptureTableDecorator::m_glElementPointerAPPLE_capture;
+this->m_orig_glVertexStream1fATI = this->m_ptr_glVertexStream1fATI;
+if(this->m_ptr_glVertexStream1fATI)this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&CaptureTableDecorator::m_glVertexStream1fATI_capture;
+this->m_orig_glCoverageModulationNV = this->m_ptr_glCoverageModulationNV;
+if(this->m_ptr_glCoverageModulationNV)this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&CaptureTableDecorator::m_glCoverageModulationNV_capture;
+this->m_orig_glSecondaryColor3i = this->m_ptr_glSecondaryColor3i;
+if(this->m_ptr_glSecondaryColor3i)this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&CaptureTableDecorator::m_glSecondaryColor3i_capture;
+this->m_orig_glDeleteSync = this->m_ptr_glDeleteSync;
+if(this->m_ptr_glDeleteSync)this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&CaptureTableDecorator::m_glDeleteSync_capture;
+this->m_orig_glGetProgramParameterfvNV = this->m_ptr_glGetProgramParameterfvNV;
+if(this->m_ptr_glGetProgramParameterfvNV)this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetProgramParameterfvNV_capture;
+this->m_orig_glMaxShaderCompilerThreadsARB = this->m_ptr_glMaxShaderCompilerThreadsARB;
+if(this->m_ptr_glMaxShaderCompilerThreadsARB)this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&CaptureTableDecorator::m_glMaxShaderCompilerThreadsARB_capture;
+this->m_orig_glUniformMatrix4x2dv = this->m_ptr_glUniformMatrix4x2dv;
+if(this->m_ptr_glUniformMatrix4x2dv)this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&CaptureTableDecorator::m_glUniformMatrix4x2dv_capture;
+this->m_orig_glVertexArrayVertexAttribLOffsetEXT = this->m_ptr_glVertexArrayVertexAttribLOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT)this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_capture;
+this->m_orig_glSecondaryColor3s = this->m_ptr_glSecondaryColor3s;
+if(this->m_ptr_glSecondaryColor3s)this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&CaptureTableDecorator::m_glSecondaryColor3s_capture;
+this->m_orig_glIsImageHandleResidentNV = this->m_ptr_glIsImageHandleResidentNV;
+if(this->m_ptr_glIsImageHandleResidentNV)this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&CaptureTableDecorator::m_glIsImageHandleResidentNV_capture;
+this->m_orig_glUniform3iv = this->m_ptr_glUniform3iv;
+if(this->m_ptr_glUniform3iv)this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&CaptureTableDecorator::m_glUniform3iv_capture;
+this->m_orig_glVertexAttribL3i64vNV = this->m_ptr_glVertexAttribL3i64vNV;
+if(this->m_ptr_glVertexAttribL3i64vNV)this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL3i64vNV_capture;
+this->m_orig_glPolygonMode = this->m_ptr_glPolygonMode;
+if(this->m_ptr_glPolygonMode)this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&CaptureTableDecorator::m_glPolygonMode_capture;
+this->m_orig_glFramebufferSamplePositionsfvAMD = this->m_ptr_glFramebufferSamplePositionsfvAMD;
+if(this->m_ptr_glFramebufferSamplePositionsfvAMD)this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&CaptureTableDecorator::m_glFramebufferSamplePositionsfvAMD_capture;
+this->m_orig_glConvolutionFilter1DEXT = this->m_ptr_glConvolutionFilter1DEXT;
+if(this->m_ptr_glConvolutionFilter1DEXT)this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&CaptureTableDecorator::m_glConvolutionFilter1DEXT_capture;
+this->m_orig_glVertexAttrib1dvARB = this->m_ptr_glVertexAttrib1dvARB;
+if(this->m_ptr_glVertexAttrib1dvARB)this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&CaptureTableDecorator::m_glVertexAttrib1dvARB_capture;
+this->m_orig_glTextureSubImage2DEXT = this->m_ptr_glTextureSubImage2DEXT;
+if(this->m_ptr_glTextureSubImage2DEXT)this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glTextureSubImage2DEXT_capture;
+this->m_orig_glIsVertexArrayAPPLE = this->m_ptr_glIsVertexArrayAPPLE;
+if(this->m_ptr_glIsVertexArrayAPPLE)this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&CaptureTableDecorator::m_glIsVertexArrayAPPLE_capture;
+this->m_orig_glUseProgram = this->m_ptr_glUseProgram;
+if(this->m_ptr_glUseProgram)this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&CaptureTableDecorator::m_glUseProgram_capture;
+this->m_orig_glLineStipple = this->m_ptr_glLineStipple;
+if(this->m_ptr_glLineStipple)this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&CaptureTableDecorator::m_glLineStipple_capture;
+this->m_orig_glMultiTexCoord4fvARB = this->m_ptr_glMultiTexCoord4fvARB;
+if(this->m_ptr_glMultiTexCoord4fvARB)this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4fvARB_capture;
+this->m_orig_glVideoCaptureNV = this->m_ptr_glVideoCaptureNV;
+if(this->m_ptr_glVideoCaptureNV)this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&CaptureTableDecorator::m_glVideoCaptureNV_capture;
+this->m_orig_glVertexArrayVertexAttribLFormatEXT = this->m_ptr_glVertexArrayVertexAttribLFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT)this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_capture;
+this->m_orig_glUniform3fvARB = this->m_ptr_glUniform3fvARB;
+if(this->m_ptr_glUniform3fvARB)this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&CaptureTableDecorator::m_glUniform3fvARB_capture;
+this->m_orig_glProgramUniformMatrix3x2fvEXT = this->m_ptr_glProgramUniformMatrix3x2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT)this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x2fvEXT_capture;
+this->m_orig_glCopyTextureSubImage3DEXT = this->m_ptr_glCopyTextureSubImage3DEXT;
+if(this->m_ptr_glCopyTextureSubImage3DEXT)this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCopyTextureSubImage3DEXT_capture;
+this->m_orig_glMultiTexCoord2bvOES = this->m_ptr_glMultiTexCoord2bvOES;
+if(this->m_ptr_glMultiTexCoord2bvOES)this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord2bvOES_capture;
+this->m_orig_glDeleteObjectARB = this->m_ptr_glDeleteObjectARB;
+if(this->m_ptr_glDeleteObjectARB)this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&CaptureTableDecorator::m_glDeleteObjectARB_capture;
+this->m_orig_glTextureLightEXT = this->m_ptr_glTextureLightEXT;
+if(this->m_ptr_glTextureLightEXT)this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&CaptureTableDecorator::m_glTextureLightEXT_capture;
+this->m_orig_glRasterPos3i = this->m_ptr_glRasterPos3i;
+if(this->m_ptr_glRasterPos3i)this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&CaptureTableDecorator::m_glRasterPos3i_capture;
+this->m_orig_glMultiTexCoord3dARB = this->m_ptr_glMultiTexCoord3dARB;
+if(this->m_ptr_glMultiTexCoord3dARB)this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3dARB_capture;
+this->m_orig_glNamedFramebufferTextureEXT = this->m_ptr_glNamedFramebufferTextureEXT;
+if(this->m_ptr_glNamedFramebufferTextureEXT)this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTextureEXT_capture;
+this->m_orig_glTextureParameteriEXT = this->m_ptr_glTextureParameteriEXT;
+if(this->m_ptr_glTextureParameteriEXT)this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&CaptureTableDecorator::m_glTextureParameteriEXT_capture;
+this->m_orig_glEvalCoord2xvOES = this->m_ptr_glEvalCoord2xvOES;
+if(this->m_ptr_glEvalCoord2xvOES)this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&CaptureTableDecorator::m_glEvalCoord2xvOES_capture;
+this->m_orig_glBindVideoCaptureStreamBufferNV = this->m_ptr_glBindVideoCaptureStreamBufferNV;
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV)this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&CaptureTableDecorator::m_glBindVideoCaptureStreamBufferNV_capture;
+this->m_orig_glTexImage2DMultisampleCoverageNV = this->m_ptr_glTexImage2DMultisampleCoverageNV;
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV)this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&CaptureTableDecorator::m_glTexImage2DMultisampleCoverageNV_capture;
+this->m_orig_glGetAttribLocationARB = this->m_ptr_glGetAttribLocationARB;
+if(this->m_ptr_glGetAttribLocationARB)this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&CaptureTableDecorator::m_glGetAttribLocationARB_capture;
+this->m_orig_glDeleteShader = this->m_ptr_glDeleteShader;
+if(this->m_ptr_glDeleteShader)this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&CaptureTableDecorator::m_glDeleteShader_capture;
+this->m_orig_glVertexAttrib1fARB = this->m_ptr_glVertexAttrib1fARB;
+if(this->m_ptr_glVertexAttrib1fARB)this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&CaptureTableDecorator::m_glVertexAttrib1fARB_capture;
+this->m_orig_glTexCoord2fColor4ubVertex3fSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_capture;
+this->m_orig_glTexCoord4fVertex4fSUN = this->m_ptr_glTexCoord4fVertex4fSUN;
+if(this->m_ptr_glTexCoord4fVertex4fSUN)this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&CaptureTableDecorator::m_glTexCoord4fVertex4fSUN_capture;
+this->m_orig_glGetMapdv = this->m_ptr_glGetMapdv;
+if(this->m_ptr_glGetMapdv)this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&CaptureTableDecorator::m_glGetMapdv_capture;
+this->m_orig_glMapParameterfvNV = this->m_ptr_glMapParameterfvNV;
+if(this->m_ptr_glMapParameterfvNV)this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&CaptureTableDecorator::m_glMapParameterfvNV_capture;
+this->m_orig_glTextureParameterIuiv = this->m_ptr_glTextureParameterIuiv;
+if(this->m_ptr_glTextureParameterIuiv)this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&CaptureTableDecorator::m_glTextureParameterIuiv_capture;
+this->m_orig_glTransformFeedbackAttribsNV = this->m_ptr_glTransformFeedbackAttribsNV;
+if(this->m_ptr_glTransformFeedbackAttribsNV)this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&CaptureTableDecorator::m_glTransformFeedbackAttribsNV_capture;
+this->m_orig_glFragmentLightfvSGIX = this->m_ptr_glFragmentLightfvSGIX;
+if(this->m_ptr_glFragmentLightfvSGIX)this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&CaptureTableDecorator::m_glFragmentLightfvSGIX_capture;
+this->m_orig_glWindowPos3sARB = this->m_ptr_glWindowPos3sARB;
+if(this->m_ptr_glWindowPos3sARB)this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&CaptureTableDecorator::m_glWindowPos3sARB_capture;
+this->m_orig_glGetConvolutionParameterfv = this->m_ptr_glGetConvolutionParameterfv;
+if(this->m_ptr_glGetConvolutionParameterfv)this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&CaptureTableDecorator::m_glGetConvolutionParameterfv_capture;
+this->m_orig_glCopyTexSubImage3D = this->m_ptr_glCopyTexSubImage3D;
+if(this->m_ptr_glCopyTexSubImage3D)this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&CaptureTableDecorator::m_glCopyTexSubImage3D_capture;
+this->m_orig_glVertexAttribI3i = this->m_ptr_glVertexAttribI3i;
+if(this->m_ptr_glVertexAttribI3i)this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&CaptureTableDecorator::m_glVertexAttribI3i_capture;
+this->m_orig_glCreateShaderObjectARB = this->m_ptr_glCreateShaderObjectARB;
+if(this->m_ptr_glCreateShaderObjectARB)this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&CaptureTableDecorator::m_glCreateShaderObjectARB_capture;
+this->m_orig_glVertexAttribFormat = this->m_ptr_glVertexAttribFormat;
+if(this->m_ptr_glVertexAttribFormat)this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&CaptureTableDecorator::m_glVertexAttribFormat_capture;
+this->m_orig_glGetProgramivARB = this->m_ptr_glGetProgramivARB;
+if(this->m_ptr_glGetProgramivARB)this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&CaptureTableDecorator::m_glGetProgramivARB_capture;
+this->m_orig_glVertexAttribI4usv = this->m_ptr_glVertexAttribI4usv;
+if(this->m_ptr_glVertexAttribI4usv)this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&CaptureTableDecorator::m_glVertexAttribI4usv_capture;
+this->m_orig_glTexParameterf = this->m_ptr_glTexParameterf;
+if(this->m_ptr_glTexParameterf)this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&CaptureTableDecorator::m_glTexParameterf_capture;
+this->m_orig_glVertexAttribBinding = this->m_ptr_glVertexAttribBinding;
+if(this->m_ptr_glVertexAttribBinding)this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&CaptureTableDecorator::m_glVertexAttribBinding_capture;
+this->m_orig_glGetHistogramParameteriv = this->m_ptr_glGetHistogramParameteriv;
+if(this->m_ptr_glGetHistogramParameteriv)this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&CaptureTableDecorator::m_glGetHistogramParameteriv_capture;
+this->m_orig_glTexParameteri = this->m_ptr_glTexParameteri;
+if(this->m_ptr_glTexParameteri)this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&CaptureTableDecorator::m_glTexParameteri_capture;
+this->m_orig_glGetShaderSource = this->m_ptr_glGetShaderSource;
+if(this->m_ptr_glGetShaderSource)this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&CaptureTableDecorator::m_glGetShaderSource_capture;
+this->m_orig_glVertexAttrib4s = this->m_ptr_glVertexAttrib4s;
+if(this->m_ptr_glVertexAttrib4s)this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&CaptureTableDecorator::m_glVertexAttrib4s_capture;
+this->m_orig_glVertexAttrib4dvNV = this->m_ptr_glVertexAttrib4dvNV;
+if(this->m_ptr_glVertexAttrib4dvNV)this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&CaptureTableDecorator::m_glVertexAttrib4dvNV_capture;
+this->m_orig_glVertexAttrib1dvNV = this->m_ptr_glVertexAttrib1dvNV;
+if(this->m_ptr_glVertexAttrib1dvNV)this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&CaptureTableDecorator::m_glVertexAttrib1dvNV_capture;
+this->m_orig_glPopName = this->m_ptr_glPopName;
+if(this->m_ptr_glPopName)this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&CaptureTableDecorator::m_glPopName_capture;
+this->m_orig_glTextureBufferEXT = this->m_ptr_glTextureBufferEXT;
+if(this->m_ptr_glTextureBufferEXT)this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&CaptureTableDecorator::m_glTextureBufferEXT_capture;
+this->m_orig_glGetMultiTexImageEXT = this->m_ptr_glGetMultiTexImageEXT;
+if(this->m_ptr_glGetMultiTexImageEXT)this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&CaptureTableDecorator::m_glGetMultiTexImageEXT_capture;
+this->m_orig_glGetPointerIndexedvEXT = this->m_ptr_glGetPointerIndexedvEXT;
+if(this->m_ptr_glGetPointerIndexedvEXT)this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&CaptureTableDecorator::m_glGetPointerIndexedvEXT_capture;
+this->m_orig_glIsNameAMD = this->m_ptr_glIsNameAMD;
+if(this->m_ptr_glIsNameAMD)this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&CaptureTableDecorator::m_glIsNameAMD_capture;
+this->m_orig_glColor4ub = this->m_ptr_glColor4ub;
+if(this->m_ptr_glColor4ub)this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&CaptureTableDecorator::m_glColor4ub_capture;
+this->m_orig_glBufferParameteriAPPLE = this->m_ptr_glBufferParameteriAPPLE;
+if(this->m_ptr_glBufferParameteriAPPLE)this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&CaptureTableDecorator::m_glBufferParameteriAPPLE_capture;
+this->m_orig_glColor4ui = this->m_ptr_glColor4ui;
+if(this->m_ptr_glColor4ui)this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&CaptureTableDecorator::m_glColor4ui_capture;
+this->m_orig_glGetInternalformativ = this->m_ptr_glGetInternalformativ;
+if(this->m_ptr_glGetInternalformativ)this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&CaptureTableDecorator::m_glGetInternalformativ_capture;
+this->m_orig_glColor4us = this->m_ptr_glColor4us;
+if(this->m_ptr_glColor4us)this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&CaptureTableDecorator::m_glColor4us_capture;
+this->m_orig_glVertexAttribP1uiv = this->m_ptr_glVertexAttribP1uiv;
+if(this->m_ptr_glVertexAttribP1uiv)this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&CaptureTableDecorator::m_glVertexAttribP1uiv_capture;
+this->m_orig_glLinkProgram = this->m_ptr_glLinkProgram;
+if(this->m_ptr_glLinkProgram)this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&CaptureTableDecorator::m_glLinkProgram_capture;
+this->m_orig_glTexCoord3s = this->m_ptr_glTexCoord3s;
+if(this->m_ptr_glTexCoord3s)this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&CaptureTableDecorator::m_glTexCoord3s_capture;
+this->m_orig_glTexCoord2dv = this->m_ptr_glTexCoord2dv;
+if(this->m_ptr_glTexCoord2dv)this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&CaptureTableDecorator::m_glTexCoord2dv_capture;
+this->m_orig_glGetObjectLabel = this->m_ptr_glGetObjectLabel;
+if(this->m_ptr_glGetObjectLabel)this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&CaptureTableDecorator::m_glGetObjectLabel_capture;
+this->m_orig_glVertexPointerEXT = this->m_ptr_glVertexPointerEXT;
+if(this->m_ptr_glVertexPointerEXT)this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&CaptureTableDecorator::m_glVertexPointerEXT_capture;
+this->m_orig_glDebugMessageCallbackARB = this->m_ptr_glDebugMessageCallbackARB;
+if(this->m_ptr_glDebugMessageCallbackARB)this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&CaptureTableDecorator::m_glDebugMessageCallbackARB_capture;
+this->m_orig_glGetString = this->m_ptr_glGetString;
+if(this->m_ptr_glGetString)this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&CaptureTableDecorator::m_glGetString_capture;
+this->m_orig_glGetPathParameterfvNV = this->m_ptr_glGetPathParameterfvNV;
+if(this->m_ptr_glGetPathParameterfvNV)this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetPathParameterfvNV_capture;
+this->m_orig_glLightxvOES = this->m_ptr_glLightxvOES;
+if(this->m_ptr_glLightxvOES)this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&CaptureTableDecorator::m_glLightxvOES_capture;
+this->m_orig_glEndQuery = this->m_ptr_glEndQuery;
+if(this->m_ptr_glEndQuery)this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&CaptureTableDecorator::m_glEndQuery_capture;
+this->m_orig_glSecondaryColor3uiv = this->m_ptr_glSecondaryColor3uiv;
+if(this->m_ptr_glSecondaryColor3uiv)this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&CaptureTableDecorator::m_glSecondaryColor3uiv_capture;
+this->m_orig_glPrioritizeTexturesxOES = this->m_ptr_glPrioritizeTexturesxOES;
+if(this->m_ptr_glPrioritizeTexturesxOES)this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&CaptureTableDecorator::m_glPrioritizeTexturesxOES_capture;
+this->m_orig_glEdgeFlagPointer = this->m_ptr_glEdgeFlagPointer;
+if(this->m_ptr_glEdgeFlagPointer)this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&CaptureTableDecorator::m_glEdgeFlagPointer_capture;
+this->m_orig_glFramebufferParameteri = this->m_ptr_glFramebufferParameteri;
+if(this->m_ptr_glFramebufferParameteri)this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&CaptureTableDecorator::m_glFramebufferParameteri_capture;
+this->m_orig_glTexCoord3hNV = this->m_ptr_glTexCoord3hNV;
+if(this->m_ptr_glTexCoord3hNV)this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&CaptureTableDecorator::m_glTexCoord3hNV_capture;
+this->m_orig_glMultiModeDrawElementsIBM = this->m_ptr_glMultiModeDrawElementsIBM;
+if(this->m_ptr_glMultiModeDrawElementsIBM)this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&CaptureTableDecorator::m_glMultiModeDrawElementsIBM_capture;
+this->m_orig_glCopyPixels = this->m_ptr_glCopyPixels;
+if(this->m_ptr_glCopyPixels)this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&CaptureTableDecorator::m_glCopyPixels_capture;
+this->m_orig_glVertexAttribI2ui = this->m_ptr_glVertexAttribI2ui;
+if(this->m_ptr_glVertexAttribI2ui)this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&CaptureTableDecorator::m_glVertexAttribI2ui_capture;
+this->m_orig_glClampColorARB = this->m_ptr_glClampColorARB;
+if(this->m_ptr_glClampColorARB)this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&CaptureTableDecorator::m_glClampColorARB_capture;
+this->m_orig_glColorPointervINTEL = this->m_ptr_glColorPointervINTEL;
+if(this->m_ptr_glColorPointervINTEL)this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&CaptureTableDecorator::m_glColorPointervINTEL_capture;
+this->m_orig_glDeleteTextures = this->m_ptr_glDeleteTextures;
+if(this->m_ptr_glDeleteTextures)this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&CaptureTableDecorator::m_glDeleteTextures_capture;
+this->m_orig_glGetMinmaxParameterfvEXT = this->m_ptr_glGetMinmaxParameterfvEXT;
+if(this->m_ptr_glGetMinmaxParameterfvEXT)this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetMinmaxParameterfvEXT_capture;
+this->m_orig_glWindowPos3sMESA = this->m_ptr_glWindowPos3sMESA;
+if(this->m_ptr_glWindowPos3sMESA)this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&CaptureTableDecorator::m_glWindowPos3sMESA_capture;
+this->m_orig_glVertexAttrib4f = this->m_ptr_glVertexAttrib4f;
+if(this->m_ptr_glVertexAttrib4f)this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&CaptureTableDecorator::m_glVertexAttrib4f_capture;
+this->m_orig_glNamedFramebufferParameteri = this->m_ptr_glNamedFramebufferParameteri;
+if(this->m_ptr_glNamedFramebufferParameteri)this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&CaptureTableDecorator::m_glNamedFramebufferParameteri_capture;
+this->m_orig_glTexCoord2fVertex3fvSUN = this->m_ptr_glTexCoord2fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fVertex3fvSUN)this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glTexCoord2fVertex3fvSUN_capture;
+this->m_orig_glReplacementCodeusSUN = this->m_ptr_glReplacementCodeusSUN;
+if(this->m_ptr_glReplacementCodeusSUN)this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&CaptureTableDecorator::m_glReplacementCodeusSUN_capture;
+this->m_orig_glGetNamedFramebufferParameteriv = this->m_ptr_glGetNamedFramebufferParameteriv;
+if(this->m_ptr_glGetNamedFramebufferParameteriv)this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetNamedFramebufferParameteriv_capture;
+this->m_orig_glVertexStream1fvATI = this->m_ptr_glVertexStream1fvATI;
+if(this->m_ptr_glVertexStream1fvATI)this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&CaptureTableDecorator::m_glVertexStream1fvATI_capture;
+this->m_orig_glCreateVertexArrays = this->m_ptr_glCreateVertexArrays;
+if(this->m_ptr_glCreateVertexArrays)this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&CaptureTableDecorator::m_glCreateVertexArrays_capture;
+this->m_orig_glBeginConditionalRender = this->m_ptr_glBeginConditionalRender;
+if(this->m_ptr_glBeginConditionalRender)this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&CaptureTableDecorator::m_glBeginConditionalRender_capture;
+this->m_orig_glGetUnsignedBytevEXT = this->m_ptr_glGetUnsignedBytevEXT;
+if(this->m_ptr_glGetUnsignedBytevEXT)this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&CaptureTableDecorator::m_glGetUnsignedBytevEXT_capture;
+this->m_orig_glConvolutionFilter1D = this->m_ptr_glConvolutionFilter1D;
+if(this->m_ptr_glConvolutionFilter1D)this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&CaptureTableDecorator::m_glConvolutionFilter1D_capture;
+this->m_orig_glMultiTexCoord3fARB = this->m_ptr_glMultiTexCoord3fARB;
+if(this->m_ptr_glMultiTexCoord3fARB)this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3fARB_capture;
+this->m_orig_glGetQueryObjectuivARB = this->m_ptr_glGetQueryObjectuivARB;
+if(this->m_ptr_glGetQueryObjectuivARB)this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&CaptureTableDecorator::m_glGetQueryObjectuivARB_capture;
+this->m_orig_glScalexOES = this->m_ptr_glScalexOES;
+if(this->m_ptr_glScalexOES)this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&CaptureTableDecorator::m_glScalexOES_capture;
+this->m_orig_glSamplerParameteri = this->m_ptr_glSamplerParameteri;
+if(this->m_ptr_glSamplerParameteri)this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&CaptureTableDecorator::m_glSamplerParameteri_capture;
+this->m_orig_glSamplerParameterf = this->m_ptr_glSamplerParameterf;
+if(this->m_ptr_glSamplerParameterf)this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&CaptureTableDecorator::m_glSamplerParameterf_capture;
+this->m_orig_glShaderOp1EXT = this->m_ptr_glShaderOp1EXT;
+if(this->m_ptr_glShaderOp1EXT)this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&CaptureTableDecorator::m_glShaderOp1EXT_capture;
+this->m_orig_glBeginVideoCaptureNV = this->m_ptr_glBeginVideoCaptureNV;
+if(this->m_ptr_glBeginVideoCaptureNV)this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&CaptureTableDecorator::m_glBeginVideoCaptureNV_capture;
+this->m_orig_glGetnHistogram = this->m_ptr_glGetnHistogram;
+if(this->m_ptr_glGetnHistogram)this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&CaptureTableDecorator::m_glGetnHistogram_capture;
+this->m_orig_glUniform1d = this->m_ptr_glUniform1d;
+if(this->m_ptr_glUniform1d)this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&CaptureTableDecorator::m_glUniform1d_capture;
+this->m_orig_glRenderMode = this->m_ptr_glRenderMode;
+if(this->m_ptr_glRenderMode)this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&CaptureTableDecorator::m_glRenderMode_capture;
+this->m_orig_glClearColorIiEXT = this->m_ptr_glClearColorIiEXT;
+if(this->m_ptr_glClearColorIiEXT)this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&CaptureTableDecorator::m_glClearColorIiEXT_capture;
+this->m_orig_glSignalSemaphoreEXT = this->m_ptr_glSignalSemaphoreEXT;
+if(this->m_ptr_glSignalSemaphoreEXT)this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&CaptureTableDecorator::m_glSignalSemaphoreEXT_capture;
+this->m_orig_glGetCompressedTexImage = this->m_ptr_glGetCompressedTexImage;
+if(this->m_ptr_glGetCompressedTexImage)this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&CaptureTableDecorator::m_glGetCompressedTexImage_capture;
+this->m_orig_glCompressedTextureImage1DEXT = this->m_ptr_glCompressedTextureImage1DEXT;
+if(this->m_ptr_glCompressedTextureImage1DEXT)this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureImage1DEXT_capture;
+this->m_orig_glGetActiveUniformBlockiv = this->m_ptr_glGetActiveUniformBlockiv;
+if(this->m_ptr_glGetActiveUniformBlockiv)this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&CaptureTableDecorator::m_glGetActiveUniformBlockiv_capture;
+this->m_orig_glUniform1i = this->m_ptr_glUniform1i;
+if(this->m_ptr_glUniform1i)this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&CaptureTableDecorator::m_glUniform1i_capture;
+this->m_orig_glMultiDrawArraysIndirectCount = this->m_ptr_glMultiDrawArraysIndirectCount;
+if(this->m_ptr_glMultiDrawArraysIndirectCount)this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirectCount_capture;
+this->m_orig_glGetTexEnvfv = this->m_ptr_glGetTexEnvfv;
+if(this->m_ptr_glGetTexEnvfv)this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&CaptureTableDecorator::m_glGetTexEnvfv_capture;
+this->m_orig_glColorTableParameterivSGI = this->m_ptr_glColorTableParameterivSGI;
+if(this->m_ptr_glColorTableParameterivSGI)this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&CaptureTableDecorator::m_glColorTableParameterivSGI_capture;
+this->m_orig_glCullFace = this->m_ptr_glCullFace;
+if(this->m_ptr_glCullFace)this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&CaptureTableDecorator::m_glCullFace_capture;
+this->m_orig_glDeleteFencesAPPLE = this->m_ptr_glDeleteFencesAPPLE;
+if(this->m_ptr_glDeleteFencesAPPLE)this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&CaptureTableDecorator::m_glDeleteFencesAPPLE_capture;
+this->m_orig_glProgramUniform4i = this->m_ptr_glProgramUniform4i;
+if(this->m_ptr_glProgramUniform4i)this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&CaptureTableDecorator::m_glProgramUniform4i_capture;
+this->m_orig_glUniformHandleui64ARB = this->m_ptr_glUniformHandleui64ARB;
+if(this->m_ptr_glUniformHandleui64ARB)this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&CaptureTableDecorator::m_glUniformHandleui64ARB_capture;
+this->m_orig_glProgramUniform4f = this->m_ptr_glProgramUniform4f;
+if(this->m_ptr_glProgramUniform4f)this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&CaptureTableDecorator::m_glProgramUniform4f_capture;
+this->m_orig_glViewportIndexedf = this->m_ptr_glViewportIndexedf;
+if(this->m_ptr_glViewportIndexedf)this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&CaptureTableDecorator::m_glViewportIndexedf_capture;
+this->m_orig_glProgramUniform4d = this->m_ptr_glProgramUniform4d;
+if(this->m_ptr_glProgramUniform4d)this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&CaptureTableDecorator::m_glProgramUniform4d_capture;
+this->m_orig_glTexCoord1xOES = this->m_ptr_glTexCoord1xOES;
+if(this->m_ptr_glTexCoord1xOES)this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&CaptureTableDecorator::m_glTexCoord1xOES_capture;
+this->m_orig_glVertexStream3ivATI = this->m_ptr_glVertexStream3ivATI;
+if(this->m_ptr_glVertexStream3ivATI)this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&CaptureTableDecorator::m_glVertexStream3ivATI_capture;
+this->m_orig_glPointAlongPathNV = this->m_ptr_glPointAlongPathNV;
+if(this->m_ptr_glPointAlongPathNV)this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&CaptureTableDecorator::m_glPointAlongPathNV_capture;
+this->m_orig_glEndQueryARB = this->m_ptr_glEndQueryARB;
+if(this->m_ptr_glEndQueryARB)this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&CaptureTableDecorator::m_glEndQueryARB_capture;
+this->m_orig_glVDPAUMapSurfacesNV = this->m_ptr_glVDPAUMapSurfacesNV;
+if(this->m_ptr_glVDPAUMapSurfacesNV)this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&CaptureTableDecorator::m_glVDPAUMapSurfacesNV_capture;
+this->m_orig_glVertex3i = this->m_ptr_glVertex3i;
+if(this->m_ptr_glVertex3i)this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&CaptureTableDecorator::m_glVertex3i_capture;
+this->m_orig_glVertexAttrib4uivARB = this->m_ptr_glVertexAttrib4uivARB;
+if(this->m_ptr_glVertexAttrib4uivARB)this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4uivARB_capture;
+this->m_orig_glTextureStorageMem3DEXT = this->m_ptr_glTextureStorageMem3DEXT;
+if(this->m_ptr_glTextureStorageMem3DEXT)this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&CaptureTableDecorator::m_glTextureStorageMem3DEXT_capture;
+this->m_orig_glAttachShader = this->m_ptr_glAttachShader;
+if(this->m_ptr_glAttachShader)this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&CaptureTableDecorator::m_glAttachShader_capture;
+this->m_orig_glColor4hNV = this->m_ptr_glColor4hNV;
+if(this->m_ptr_glColor4hNV)this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&CaptureTableDecorator::m_glColor4hNV_capture;
+this->m_orig_glGetFenceivNV = this->m_ptr_glGetFenceivNV;
+if(this->m_ptr_glGetFenceivNV)this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&CaptureTableDecorator::m_glGetFenceivNV_capture;
+this->m_orig_glTexCoord2fColor4ubVertex3fvSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_capture;
+this->m_orig_glGetColorTable = this->m_ptr_glGetColorTable;
+if(this->m_ptr_glGetColorTable)this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&CaptureTableDecorator::m_glGetColorTable_capture;
+this->m_orig_glFogCoordPointer = this->m_ptr_glFogCoordPointer;
+if(this->m_ptr_glFogCoordPointer)this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&CaptureTableDecorator::m_glFogCoordPointer_capture;
+this->m_orig_glTexStorageSparseAMD = this->m_ptr_glTexStorageSparseAMD;
+if(this->m_ptr_glTexStorageSparseAMD)this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&CaptureTableDecorator::m_glTexStorageSparseAMD_capture;
+this->m_orig_glUnmapNamedBuffer = this->m_ptr_glUnmapNamedBuffer;
+if(this->m_ptr_glUnmapNamedBuffer)this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&CaptureTableDecorator::m_glUnmapNamedBuffer_capture;
+this->m_orig_glTexCoord4bvOES = this->m_ptr_glTexCoord4bvOES;
+if(this->m_ptr_glTexCoord4bvOES)this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&CaptureTableDecorator::m_glTexCoord4bvOES_capture;
+this->m_orig_glVertexAttrib3fARB = this->m_ptr_glVertexAttrib3fARB;
+if(this->m_ptr_glVertexAttrib3fARB)this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&CaptureTableDecorator::m_glVertexAttrib3fARB_capture;
+this->m_orig_glRasterPos2xOES = this->m_ptr_glRasterPos2xOES;
+if(this->m_ptr_glRasterPos2xOES)this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&CaptureTableDecorator::m_glRasterPos2xOES_capture;
+this->m_orig_glCreateMemoryObjectsEXT = this->m_ptr_glCreateMemoryObjectsEXT;
+if(this->m_ptr_glCreateMemoryObjectsEXT)this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&CaptureTableDecorator::m_glCreateMemoryObjectsEXT_capture;
+this->m_orig_glColor4ubVertex2fvSUN = this->m_ptr_glColor4ubVertex2fvSUN;
+if(this->m_ptr_glColor4ubVertex2fvSUN)this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&CaptureTableDecorator::m_glColor4ubVertex2fvSUN_capture;
+this->m_orig_glSecondaryColor3dv = this->m_ptr_glSecondaryColor3dv;
+if(this->m_ptr_glSecondaryColor3dv)this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&CaptureTableDecorator::m_glSecondaryColor3dv_capture;
+this->m_orig_glVertexAttribI4sv = this->m_ptr_glVertexAttribI4sv;
+if(this->m_ptr_glVertexAttribI4sv)this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&CaptureTableDecorator::m_glVertexAttribI4sv_capture;
+this->m_orig_glDrawTransformFeedbackStreamInstanced = this->m_ptr_glDrawTransformFeedbackStreamInstanced;
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced)this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&CaptureTableDecorator::m_glDrawTransformFeedbackStreamInstanced_capture;
+this->m_orig_glMultiTexCoord4ivARB = this->m_ptr_glMultiTexCoord4ivARB;
+if(this->m_ptr_glMultiTexCoord4ivARB)this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4ivARB_capture;
+this->m_orig_glSpriteParameterfSGIX = this->m_ptr_glSpriteParameterfSGIX;
+if(this->m_ptr_glSpriteParameterfSGIX)this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&CaptureTableDecorator::m_glSpriteParameterfSGIX_capture;
+this->m_orig_glSecondaryColor3sv = this->m_ptr_glSecondaryColor3sv;
+if(this->m_ptr_glSecondaryColor3sv)this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&CaptureTableDecorator::m_glSecondaryColor3sv_capture;
+this->m_orig_glBindVideoCaptureStreamTextureNV = this->m_ptr_glBindVideoCaptureStreamTextureNV;
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV)this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&CaptureTableDecorator::m_glBindVideoCaptureStreamTextureNV_capture;
+this->m_orig_glTexParameterIuiv = this->m_ptr_glTexParameterIuiv;
+if(this->m_ptr_glTexParameterIuiv)this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&CaptureTableDecorator::m_glTexParameterIuiv_capture;
+this->m_orig_glFlushPixelDataRangeNV = this->m_ptr_glFlushPixelDataRangeNV;
+if(this->m_ptr_glFlushPixelDataRangeNV)this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&CaptureTableDecorator::m_glFlushPixelDataRangeNV_capture;
+this->m_orig_glWindowPos3fv = this->m_ptr_glWindowPos3fv;
+if(this->m_ptr_glWindowPos3fv)this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&CaptureTableDecorator::m_glWindowPos3fv_capture;
+this->m_orig_glVertexAttribLFormatNV = this->m_ptr_glVertexAttribLFormatNV;
+if(this->m_ptr_glVertexAttribLFormatNV)this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&CaptureTableDecorator::m_glVertexAttribLFormatNV_capture;
+this->m_orig_glLightModelfv = this->m_ptr_glLightModelfv;
+if(this->m_ptr_glLightModelfv)this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&CaptureTableDecorator::m_glLightModelfv_capture;
+this->m_orig_glGetColorTableSGI = this->m_ptr_glGetColorTableSGI;
+if(this->m_ptr_glGetColorTableSGI)this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&CaptureTableDecorator::m_glGetColorTableSGI_capture;
+this->m_orig_glGetCompressedTexImageARB = this->m_ptr_glGetCompressedTexImageARB;
+if(this->m_ptr_glGetCompressedTexImageARB)this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&CaptureTableDecorator::m_glGetCompressedTexImageARB_capture;
+this->m_orig_glConvolutionParameteri = this->m_ptr_glConvolutionParameteri;
+if(this->m_ptr_glConvolutionParameteri)this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&CaptureTableDecorator::m_glConvolutionParameteri_capture;
+this->m_orig_glVertexWeighthNV = this->m_ptr_glVertexWeighthNV;
+if(this->m_ptr_glVertexWeighthNV)this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&CaptureTableDecorator::m_glVertexWeighthNV_capture;
+this->m_orig_glColorMaskIndexedEXT = this->m_ptr_glColorMaskIndexedEXT;
+if(this->m_ptr_glColorMaskIndexedEXT)this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&CaptureTableDecorator::m_glColorMaskIndexedEXT_capture;
+this->m_orig_glColorMaski = this->m_ptr_glColorMaski;
+if(this->m_ptr_glColorMaski)this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&CaptureTableDecorator::m_glColorMaski_capture;
+this->m_orig_glColorFragmentOp1ATI = this->m_ptr_glColorFragmentOp1ATI;
+if(this->m_ptr_glColorFragmentOp1ATI)this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&CaptureTableDecorator::m_glColorFragmentOp1ATI_capture;
+this->m_orig_glVertexAttribI4ubvEXT = this->m_ptr_glVertexAttribI4ubvEXT;
+if(this->m_ptr_glVertexAttribI4ubvEXT)this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4ubvEXT_capture;
+this->m_orig_glVertexAttrib1dNV = this->m_ptr_glVertexAttrib1dNV;
+if(this->m_ptr_glVertexAttrib1dNV)this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&CaptureTableDecorator::m_glVertexAttrib1dNV_capture;
+this->m_orig_glUnmapObjectBufferATI = this->m_ptr_glUnmapObjectBufferATI;
+if(this->m_ptr_glUnmapObjectBufferATI)this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glUnmapObjectBufferATI_capture;
+this->m_orig_glNamedProgramLocalParameterI4uiEXT = this->m_ptr_glNamedProgramLocalParameterI4uiEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT)this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_capture;
+this->m_orig_glProgramUniform1iEXT = this->m_ptr_glProgramUniform1iEXT;
+if(this->m_ptr_glProgramUniform1iEXT)this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&CaptureTableDecorator::m_glProgramUniform1iEXT_capture;
+this->m_orig_glDeleteQueriesARB = this->m_ptr_glDeleteQueriesARB;
+if(this->m_ptr_glDeleteQueriesARB)this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&CaptureTableDecorator::m_glDeleteQueriesARB_capture;
+this->m_orig_glWindowPos3svARB = this->m_ptr_glWindowPos3svARB;
+if(this->m_ptr_glWindowPos3svARB)this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&CaptureTableDecorator::m_glWindowPos3svARB_capture;
+this->m_orig_glVertex4s = this->m_ptr_glVertex4s;
+if(this->m_ptr_glVertex4s)this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&CaptureTableDecorator::m_glVertex4s_capture;
+this->m_orig_glImportMemoryWin32NameEXT = this->m_ptr_glImportMemoryWin32NameEXT;
+if(this->m_ptr_glImportMemoryWin32NameEXT)this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&CaptureTableDecorator::m_glImportMemoryWin32NameEXT_capture;
+this->m_orig_glStringMarkerGREMEDY = this->m_ptr_glStringMarkerGREMEDY;
+if(this->m_ptr_glStringMarkerGREMEDY)this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&CaptureTableDecorator::m_glStringMarkerGREMEDY_capture;
+this->m_orig_glIsTransformFeedback = this->m_ptr_glIsTransformFeedback;
+if(this->m_ptr_glIsTransformFeedback)this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glIsTransformFeedback_capture;
+this->m_orig_glProgramUniformMatrix2x3dvEXT = this->m_ptr_glProgramUniformMatrix2x3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT)this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x3dvEXT_capture;
+this->m_orig_glGetObjectLabelEXT = this->m_ptr_glGetObjectLabelEXT;
+if(this->m_ptr_glGetObjectLabelEXT)this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&CaptureTableDecorator::m_glGetObjectLabelEXT_capture;
+this->m_orig_glUniformHandleui64vNV = this->m_ptr_glUniformHandleui64vNV;
+if(this->m_ptr_glUniformHandleui64vNV)this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&CaptureTableDecorator::m_glUniformHandleui64vNV_capture;
+this->m_orig_glRotated = this->m_ptr_glRotated;
+if(this->m_ptr_glRotated)this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&CaptureTableDecorator::m_glRotated_capture;
+this->m_orig_glIsProgramPipeline = this->m_ptr_glIsProgramPipeline;
+if(this->m_ptr_glIsProgramPipeline)this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&CaptureTableDecorator::m_glIsProgramPipeline_capture;
+this->m_orig_glRotatef = this->m_ptr_glRotatef;
+if(this->m_ptr_glRotatef)this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&CaptureTableDecorator::m_glRotatef_capture;
+this->m_orig_glVertex4i = this->m_ptr_glVertex4i;
+if(this->m_ptr_glVertex4i)this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&CaptureTableDecorator::m_glVertex4i_capture;
+this->m_orig_glGetActiveSubroutineUniformName = this->m_ptr_glGetActiveSubroutineUniformName;
+if(this->m_ptr_glGetActiveSubroutineUniformName)this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&CaptureTableDecorator::m_glGetActiveSubroutineUniformName_capture;
+this->m_orig_glVertexAttrib4sNV = this->m_ptr_glVertexAttrib4sNV;
+if(this->m_ptr_glVertexAttrib4sNV)this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&CaptureTableDecorator::m_glVertexAttrib4sNV_capture;
+this->m_orig_glProgramLocalParameter4dvARB = this->m_ptr_glProgramLocalParameter4dvARB;
+if(this->m_ptr_glProgramLocalParameter4dvARB)this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&CaptureTableDecorator::m_glProgramLocalParameter4dvARB_capture;
+this->m_orig_glReplacementCodeubSUN = this->m_ptr_glReplacementCodeubSUN;
+if(this->m_ptr_glReplacementCodeubSUN)this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&CaptureTableDecorator::m_glReplacementCodeubSUN_capture;
+this->m_orig_glMultiDrawElementsIndirectBindlessNV = this->m_ptr_glMultiDrawElementsIndirectBindlessNV;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV)this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_capture;
+this->m_orig_glImportSemaphoreWin32HandleEXT = this->m_ptr_glImportSemaphoreWin32HandleEXT;
+if(this->m_ptr_glImportSemaphoreWin32HandleEXT)this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&CaptureTableDecorator::m_glImportSemaphoreWin32HandleEXT_capture;
+this->m_orig_glUniformMatrix3fv = this->m_ptr_glUniformMatrix3fv;
+if(this->m_ptr_glUniformMatrix3fv)this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&CaptureTableDecorator::m_glUniformMatrix3fv_capture;
+this->m_orig_glGetnMapfvARB = this->m_ptr_glGetnMapfvARB;
+if(this->m_ptr_glGetnMapfvARB)this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&CaptureTableDecorator::m_glGetnMapfvARB_capture;
+this->m_orig_glGetnUniformfv = this->m_ptr_glGetnUniformfv;
+if(this->m_ptr_glGetnUniformfv)this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&CaptureTableDecorator::m_glGetnUniformfv_capture;
+this->m_orig_glVertexAttribL2dv = this->m_ptr_glVertexAttribL2dv;
+if(this->m_ptr_glVertexAttribL2dv)this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&CaptureTableDecorator::m_glVertexAttribL2dv_capture;
+this->m_orig_glVertexWeightPointerEXT = this->m_ptr_glVertexWeightPointerEXT;
+if(this->m_ptr_glVertexWeightPointerEXT)this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&CaptureTableDecorator::m_glVertexWeightPointerEXT_capture;
+this->m_orig_glTangent3sEXT = this->m_ptr_glTangent3sEXT;
+if(this->m_ptr_glTangent3sEXT)this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&CaptureTableDecorator::m_glTangent3sEXT_capture;
+this->m_orig_glSecondaryColorPointer = this->m_ptr_glSecondaryColorPointer;
+if(this->m_ptr_glSecondaryColorPointer)this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&CaptureTableDecorator::m_glSecondaryColorPointer_capture;
+this->m_orig_glAlphaFunc = this->m_ptr_glAlphaFunc;
+if(this->m_ptr_glAlphaFunc)this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&CaptureTableDecorator::m_glAlphaFunc_capture;
+this->m_orig_glGetNamedStringARB = this->m_ptr_glGetNamedStringARB;
+if(this->m_ptr_glGetNamedStringARB)this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&CaptureTableDecorator::m_glGetNamedStringARB_capture;
+this->m_orig_glTexCoord4d = this->m_ptr_glTexCoord4d;
+if(this->m_ptr_glTexCoord4d)this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&CaptureTableDecorator::m_glTexCoord4d_capture;
+this->m_orig_glBufferPageCommitmentARB = this->m_ptr_glBufferPageCommitmentARB;
+if(this->m_ptr_glBufferPageCommitmentARB)this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&CaptureTableDecorator::m_glBufferPageCommitmentARB_capture;
+this->m_orig_glProgramLocalParameters4fvEXT = this->m_ptr_glProgramLocalParameters4fvEXT;
+if(this->m_ptr_glProgramLocalParameters4fvEXT)this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&CaptureTableDecorator::m_glProgramLocalParameters4fvEXT_capture;
+this->m_orig_glStencilFunc = this->m_ptr_glStencilFunc;
+if(this->m_ptr_glStencilFunc)this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&CaptureTableDecorator::m_glStencilFunc_capture;
+this->m_orig_glSemaphoreParameterui64vEXT = this->m_ptr_glSemaphoreParameterui64vEXT;
+if(this->m_ptr_glSemaphoreParameterui64vEXT)this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&CaptureTableDecorator::m_glSemaphoreParameterui64vEXT_capture;
+this->m_orig_glGetVertexAttribdvNV = this->m_ptr_glGetVertexAttribdvNV;
+if(this->m_ptr_glGetVertexAttribdvNV)this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&CaptureTableDecorator::m_glGetVertexAttribdvNV_capture;
+this->m_orig_glTexCoord3dv = this->m_ptr_glTexCoord3dv;
+if(this->m_ptr_glTexCoord3dv)this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&CaptureTableDecorator::m_glTexCoord3dv_capture;
+this->m_orig_glGetQueryBufferObjectiv = this->m_ptr_glGetQueryBufferObjectiv;
+if(this->m_ptr_glGetQueryBufferObjectiv)this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&CaptureTableDecorator::m_glGetQueryBufferObjectiv_capture;
+this->m_orig_glTexGenxOES = this->m_ptr_glTexGenxOES;
+if(this->m_ptr_glTexGenxOES)this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&CaptureTableDecorator::m_glTexGenxOES_capture;
+this->m_orig_glMultiTexCoord1fvARB = this->m_ptr_glMultiTexCoord1fvARB;
+if(this->m_ptr_glMultiTexCoord1fvARB)this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1fvARB_capture;
+this->m_orig_glLightEnviSGIX = this->m_ptr_glLightEnviSGIX;
+if(this->m_ptr_glLightEnviSGIX)this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&CaptureTableDecorator::m_glLightEnviSGIX_capture;
+this->m_orig_glGetProgramPipelineiv = this->m_ptr_glGetProgramPipelineiv;
+if(this->m_ptr_glGetProgramPipelineiv)this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&CaptureTableDecorator::m_glGetProgramPipelineiv_capture;
+this->m_orig_glVertexStream2ivATI = this->m_ptr_glVertexStream2ivATI;
+if(this->m_ptr_glVertexStream2ivATI)this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&CaptureTableDecorator::m_glVertexStream2ivATI_capture;
+this->m_orig_glGetColorTableEXT = this->m_ptr_glGetColorTableEXT;
+if(this->m_ptr_glGetColorTableEXT)this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&CaptureTableDecorator::m_glGetColorTableEXT_capture;
+this->m_orig_glGetShaderInfoLog = this->m_ptr_glGetShaderInfoLog;
+if(this->m_ptr_glGetShaderInfoLog)this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&CaptureTableDecorator::m_glGetShaderInfoLog_capture;
+this->m_orig_glGetOcclusionQueryuivNV = this->m_ptr_glGetOcclusionQueryuivNV;
+if(this->m_ptr_glGetOcclusionQueryuivNV)this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&CaptureTableDecorator::m_glGetOcclusionQueryuivNV_capture;
+this->m_orig_glInvalidateNamedFramebufferSubData = this->m_ptr_glInvalidateNamedFramebufferSubData;
+if(this->m_ptr_glInvalidateNamedFramebufferSubData)this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glInvalidateNamedFramebufferSubData_capture;
+this->m_orig_glVertexAttribL1i64NV = this->m_ptr_glVertexAttribL1i64NV;
+if(this->m_ptr_glVertexAttribL1i64NV)this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&CaptureTableDecorator::m_glVertexAttribL1i64NV_capture;
+this->m_orig_glVDPAUInitNV = this->m_ptr_glVDPAUInitNV;
+if(this->m_ptr_glVDPAUInitNV)this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&CaptureTableDecorator::m_glVDPAUInitNV_capture;
+this->m_orig_glVertexAttrib1hvNV = this->m_ptr_glVertexAttrib1hvNV;
+if(this->m_ptr_glVertexAttrib1hvNV)this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&CaptureTableDecorator::m_glVertexAttrib1hvNV_capture;
+this->m_orig_glVertexAttribI4i = this->m_ptr_glVertexAttribI4i;
+if(this->m_ptr_glVertexAttribI4i)this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&CaptureTableDecorator::m_glVertexAttribI4i_capture;
+this->m_orig_glRasterPos2iv = this->m_ptr_glRasterPos2iv;
+if(this->m_ptr_glRasterPos2iv)this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&CaptureTableDecorator::m_glRasterPos2iv_capture;
+this->m_orig_glGetIntegerui64i_vNV = this->m_ptr_glGetIntegerui64i_vNV;
+if(this->m_ptr_glGetIntegerui64i_vNV)this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&CaptureTableDecorator::m_glGetIntegerui64i_vNV_capture;
+this->m_orig_glUniformHandleui64NV = this->m_ptr_glUniformHandleui64NV;
+if(this->m_ptr_glUniformHandleui64NV)this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&CaptureTableDecorator::m_glUniformHandleui64NV_capture;
+this->m_orig_glWindowPos3ivMESA = this->m_ptr_glWindowPos3ivMESA;
+if(this->m_ptr_glWindowPos3ivMESA)this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&CaptureTableDecorator::m_glWindowPos3ivMESA_capture;
+this->m_orig_glBlendEquationSeparate = this->m_ptr_glBlendEquationSeparate;
+if(this->m_ptr_glBlendEquationSeparate)this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&CaptureTableDecorator::m_glBlendEquationSeparate_capture;
+this->m_orig_glDrawElementsInstancedARB = this->m_ptr_glDrawElementsInstancedARB;
+if(this->m_ptr_glDrawElementsInstancedARB)this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&CaptureTableDecorator::m_glDrawElementsInstancedARB_capture;
+this->m_orig_glGetSubroutineIndex = this->m_ptr_glGetSubroutineIndex;
+if(this->m_ptr_glGetSubroutineIndex)this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&CaptureTableDecorator::m_glGetSubroutineIndex_capture;
+this->m_orig_glVertexAttrib2sv = this->m_ptr_glVertexAttrib2sv;
+if(this->m_ptr_glVertexAttrib2sv)this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&CaptureTableDecorator::m_glVertexAttrib2sv_capture;
+this->m_orig_glSamplePatternSGIS = this->m_ptr_glSamplePatternSGIS;
+if(this->m_ptr_glSamplePatternSGIS)this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&CaptureTableDecorator::m_glSamplePatternSGIS_capture;
+this->m_orig_glEGLImageTargetRenderbufferStorageOES = this->m_ptr_glEGLImageTargetRenderbufferStorageOES;
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES)this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&CaptureTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_capture;
+this->m_orig_glPushAttrib = this->m_ptr_glPushAttrib;
+if(this->m_ptr_glPushAttrib)this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&CaptureTableDecorator::m_glPushAttrib_capture;
+this->m_orig_glVertex3hNV = this->m_ptr_glVertex3hNV;
+if(this->m_ptr_glVertex3hNV)this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&CaptureTableDecorator::m_glVertex3hNV_capture;
+this->m_orig_glRasterPos3xvOES = this->m_ptr_glRasterPos3xvOES;
+if(this->m_ptr_glRasterPos3xvOES)this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&CaptureTableDecorator::m_glRasterPos3xvOES_capture;
+this->m_orig_glPathParameterfNV = this->m_ptr_glPathParameterfNV;
+if(this->m_ptr_glPathParameterfNV)this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&CaptureTableDecorator::m_glPathParameterfNV_capture;
+this->m_orig_glGetUniformi64vNV = this->m_ptr_glGetUniformi64vNV;
+if(this->m_ptr_glGetUniformi64vNV)this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&CaptureTableDecorator::m_glGetUniformi64vNV_capture;
+this->m_orig_glLightiv = this->m_ptr_glLightiv;
+if(this->m_ptr_glLightiv)this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&CaptureTableDecorator::m_glLightiv_capture;
+this->m_orig_glMaterialxvOES = this->m_ptr_glMaterialxvOES;
+if(this->m_ptr_glMaterialxvOES)this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&CaptureTableDecorator::m_glMaterialxvOES_capture;
+this->m_orig_glNamedProgramLocalParameter4fEXT = this->m_ptr_glNamedProgramLocalParameter4fEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT)this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameter4fEXT_capture;
+this->m_orig_glVertexAttribL1dEXT = this->m_ptr_glVertexAttribL1dEXT;
+if(this->m_ptr_glVertexAttribL1dEXT)this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&CaptureTableDecorator::m_glVertexAttribL1dEXT_capture;
+this->m_orig_glGetnUniformdvARB = this->m_ptr_glGetnUniformdvARB;
+if(this->m_ptr_glGetnUniformdvARB)this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&CaptureTableDecorator::m_glGetnUniformdvARB_capture;
+this->m_orig_glSecondaryColor3bEXT = this->m_ptr_glSecondaryColor3bEXT;
+if(this->m_ptr_glSecondaryColor3bEXT)this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3bEXT_capture;
+this->m_orig_glBeginPerfQueryINTEL = this->m_ptr_glBeginPerfQueryINTEL;
+if(this->m_ptr_glBeginPerfQueryINTEL)this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&CaptureTableDecorator::m_glBeginPerfQueryINTEL_capture;
+this->m_orig_glProgramUniform1uivEXT = this->m_ptr_glProgramUniform1uivEXT;
+if(this->m_ptr_glProgramUniform1uivEXT)this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&CaptureTableDecorator::m_glProgramUniform1uivEXT_capture;
+this->m_orig_glImageTransformParameterivHP = this->m_ptr_glImageTransformParameterivHP;
+if(this->m_ptr_glImageTransformParameterivHP)this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&CaptureTableDecorator::m_glImageTransformParameterivHP_capture;
+this->m_orig_glDeleteBuffers = this->m_ptr_glDeleteBuffers;
+if(this->m_ptr_glDeleteBuffers)this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&CaptureTableDecorator::m_glDeleteBuffers_capture;
+this->m_orig_glBindProgramPipeline = this->m_ptr_glBindProgramPipeline;
+if(this->m_ptr_glBindProgramPipeline)this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&CaptureTableDecorator::m_glBindProgramPipeline_capture;
+this->m_orig_glScissor = this->m_ptr_glScissor;
+if(this->m_ptr_glScissor)this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&CaptureTableDecorator::m_glScissor_capture;
+this->m_orig_glProgramUniform4fv = this->m_ptr_glProgramUniform4fv;
+if(this->m_ptr_glProgramUniform4fv)this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&CaptureTableDecorator::m_glProgramUniform4fv_capture;
+this->m_orig_glGetBooleanv = this->m_ptr_glGetBooleanv;
+if(this->m_ptr_glGetBooleanv)this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&CaptureTableDecorator::m_glGetBooleanv_capture;
+this->m_orig_glMaterialfv = this->m_ptr_glMaterialfv;
+if(this->m_ptr_glMaterialfv)this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&CaptureTableDecorator::m_glMaterialfv_capture;
+this->m_orig_glWindowPos4fvMESA = this->m_ptr_glWindowPos4fvMESA;
+if(this->m_ptr_glWindowPos4fvMESA)this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&CaptureTableDecorator::m_glWindowPos4fvMESA_capture;
+this->m_orig_glVertexAttribIPointerEXT = this->m_ptr_glVertexAttribIPointerEXT;
+if(this->m_ptr_glVertexAttribIPointerEXT)this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&CaptureTableDecorator::m_glVertexAttribIPointerEXT_capture;
+this->m_orig_glProgramBufferParametersfvNV = this->m_ptr_glProgramBufferParametersfvNV;
+if(this->m_ptr_glProgramBufferParametersfvNV)this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&CaptureTableDecorator::m_glProgramBufferParametersfvNV_capture;
+this->m_orig_glAlphaFuncxOES = this->m_ptr_glAlphaFuncxOES;
+if(this->m_ptr_glAlphaFuncxOES)this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&CaptureTableDecorator::m_glAlphaFuncxOES_capture;
+this->m_orig_glMultiDrawArraysIndirectAMD = this->m_ptr_glMultiDrawArraysIndirectAMD;
+if(this->m_ptr_glMultiDrawArraysIndirectAMD)this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirectAMD_capture;
+this->m_orig_glNormalStream3ivATI = this->m_ptr_glNormalStream3ivATI;
+if(this->m_ptr_glNormalStream3ivATI)this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&CaptureTableDecorator::m_glNormalStream3ivATI_capture;
+this->m_orig_glTextureImage3DMultisampleNV = this->m_ptr_glTextureImage3DMultisampleNV;
+if(this->m_ptr_glTextureImage3DMultisampleNV)this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&CaptureTableDecorator::m_glTextureImage3DMultisampleNV_capture;
+this->m_orig_glProgramUniform4uivEXT = this->m_ptr_glProgramUniform4uivEXT;
+if(this->m_ptr_glProgramUniform4uivEXT)this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&CaptureTableDecorator::m_glProgramUniform4uivEXT_capture;
+this->m_orig_glReplacementCodeusvSUN = this->m_ptr_glReplacementCodeusvSUN;
+if(this->m_ptr_glReplacementCodeusvSUN)this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeusvSUN_capture;
+this->m_orig_glPollInstrumentsSGIX = this->m_ptr_glPollInstrumentsSGIX;
+if(this->m_ptr_glPollInstrumentsSGIX)this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&CaptureTableDecorator::m_glPollInstrumentsSGIX_capture;
+this->m_orig_glGetTextureLevelParameteriv = this->m_ptr_glGetTextureLevelParameteriv;
+if(this->m_ptr_glGetTextureLevelParameteriv)this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&CaptureTableDecorator::m_glGetTextureLevelParameteriv_capture;
+this->m_orig_glVertexAttribI2uiv = this->m_ptr_glVertexAttribI2uiv;
+if(this->m_ptr_glVertexAttribI2uiv)this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&CaptureTableDecorator::m_glVertexAttribI2uiv_capture;
+this->m_orig_glMapControlPointsNV = this->m_ptr_glMapControlPointsNV;
+if(this->m_ptr_glMapControlPointsNV)this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&CaptureTableDecorator::m_glMapControlPointsNV_capture;
+this->m_orig_glColor4dv = this->m_ptr_glColor4dv;
+if(this->m_ptr_glColor4dv)this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&CaptureTableDecorator::m_glColor4dv_capture;
+this->m_orig_glInvalidateBufferSubData = this->m_ptr_glInvalidateBufferSubData;
+if(this->m_ptr_glInvalidateBufferSubData)this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glInvalidateBufferSubData_capture;
+this->m_orig_glMultiTexCoord1hNV = this->m_ptr_glMultiTexCoord1hNV;
+if(this->m_ptr_glMultiTexCoord1hNV)this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&CaptureTableDecorator::m_glMultiTexCoord1hNV_capture;
+this->m_orig_glPointParameterfv = this->m_ptr_glPointParameterfv;
+if(this->m_ptr_glPointParameterfv)this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&CaptureTableDecorator::m_glPointParameterfv_capture;
+this->m_orig_glUniformMatrix2fvARB = this->m_ptr_glUniformMatrix2fvARB;
+if(this->m_ptr_glUniformMatrix2fvARB)this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&CaptureTableDecorator::m_glUniformMatrix2fvARB_capture;
+this->m_orig_glUniform2fv = this->m_ptr_glUniform2fv;
+if(this->m_ptr_glUniform2fv)this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&CaptureTableDecorator::m_glUniform2fv_capture;
+this->m_orig_glVertexPointerListIBM = this->m_ptr_glVertexPointerListIBM;
+if(this->m_ptr_glVertexPointerListIBM)this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glVertexPointerListIBM_capture;
+this->m_orig_glGetMultiTexGenfvEXT = this->m_ptr_glGetMultiTexGenfvEXT;
+if(this->m_ptr_glGetMultiTexGenfvEXT)this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexGenfvEXT_capture;
+this->m_orig_glGetMinmaxEXT = this->m_ptr_glGetMinmaxEXT;
+if(this->m_ptr_glGetMinmaxEXT)this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&CaptureTableDecorator::m_glGetMinmaxEXT_capture;
+this->m_orig_glIsFenceNV = this->m_ptr_glIsFenceNV;
+if(this->m_ptr_glIsFenceNV)this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&CaptureTableDecorator::m_glIsFenceNV_capture;
+this->m_orig_glMatrixFrustumEXT = this->m_ptr_glMatrixFrustumEXT;
+if(this->m_ptr_glMatrixFrustumEXT)this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&CaptureTableDecorator::m_glMatrixFrustumEXT_capture;
+this->m_orig_glDispatchComputeIndirect = this->m_ptr_glDispatchComputeIndirect;
+if(this->m_ptr_glDispatchComputeIndirect)this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&CaptureTableDecorator::m_glDispatchComputeIndirect_capture;
+this->m_orig_glQueryResourceNV = this->m_ptr_glQueryResourceNV;
+if(this->m_ptr_glQueryResourceNV)this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&CaptureTableDecorator::m_glQueryResourceNV_capture;
+this->m_orig_glMultiTexCoord4bOES = this->m_ptr_glMultiTexCoord4bOES;
+if(this->m_ptr_glMultiTexCoord4bOES)this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&CaptureTableDecorator::m_glMultiTexCoord4bOES_capture;
+this->m_orig_glProgramEnvParameter4dARB = this->m_ptr_glProgramEnvParameter4dARB;
+if(this->m_ptr_glProgramEnvParameter4dARB)this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&CaptureTableDecorator::m_glProgramEnvParameter4dARB_capture;
+this->m_orig_glProgramUniform1uiEXT = this->m_ptr_glProgramUniform1uiEXT;
+if(this->m_ptr_glProgramUniform1uiEXT)this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&CaptureTableDecorator::m_glProgramUniform1uiEXT_capture;
+this->m_orig_glBindBufferRange = this->m_ptr_glBindBufferRange;
+if(this->m_ptr_glBindBufferRange)this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&CaptureTableDecorator::m_glBindBufferRange_capture;
+this->m_orig_glNormal3iv = this->m_ptr_glNormal3iv;
+if(this->m_ptr_glNormal3iv)this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&CaptureTableDecorator::m_glNormal3iv_capture;
+this->m_orig_glVertexAttribL3dv = this->m_ptr_glVertexAttribL3dv;
+if(this->m_ptr_glVertexAttribL3dv)this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&CaptureTableDecorator::m_glVertexAttribL3dv_capture;
+this->m_orig_glGetUniformdv = this->m_ptr_glGetUniformdv;
+if(this->m_ptr_glGetUniformdv)this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&CaptureTableDecorator::m_glGetUniformdv_capture;
+this->m_orig_glGetMultiTexLevelParameterfvEXT = this->m_ptr_glGetMultiTexLevelParameterfvEXT;
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT)this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexLevelParameterfvEXT_capture;
+this->m_orig_glFinalCombinerInputNV = this->m_ptr_glFinalCombinerInputNV;
+if(this->m_ptr_glFinalCombinerInputNV)this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&CaptureTableDecorator::m_glFinalCombinerInputNV_capture;
+this->m_orig_glCullParameterdvEXT = this->m_ptr_glCullParameterdvEXT;
+if(this->m_ptr_glCullParameterdvEXT)this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&CaptureTableDecorator::m_glCullParameterdvEXT_capture;
+this->m_orig_glMultiTexCoord4s = this->m_ptr_glMultiTexCoord4s;
+if(this->m_ptr_glMultiTexCoord4s)this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&CaptureTableDecorator::m_glMultiTexCoord4s_capture;
+this->m_orig_glMapVertexAttrib1fAPPLE = this->m_ptr_glMapVertexAttrib1fAPPLE;
+if(this->m_ptr_glMapVertexAttrib1fAPPLE)this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&CaptureTableDecorator::m_glMapVertexAttrib1fAPPLE_capture;
+this->m_orig_glConvolutionParameterfEXT = this->m_ptr_glConvolutionParameterfEXT;
+if(this->m_ptr_glConvolutionParameterfEXT)this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&CaptureTableDecorator::m_glConvolutionParameterfEXT_capture;
+this->m_orig_glTexCoord1iv = this->m_ptr_glTexCoord1iv;
+if(this->m_ptr_glTexCoord1iv)this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&CaptureTableDecorator::m_glTexCoord1iv_capture;
+this->m_orig_glProgramUniform3fvEXT = this->m_ptr_glProgramUniform3fvEXT;
+if(this->m_ptr_glProgramUniform3fvEXT)this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&CaptureTableDecorator::m_glProgramUniform3fvEXT_capture;
+this->m_orig_glColor3uiv = this->m_ptr_glColor3uiv;
+if(this->m_ptr_glColor3uiv)this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&CaptureTableDecorator::m_glColor3uiv_capture;
+this->m_orig_glRenderGpuMaskNV = this->m_ptr_glRenderGpuMaskNV;
+if(this->m_ptr_glRenderGpuMaskNV)this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&CaptureTableDecorator::m_glRenderGpuMaskNV_capture;
+this->m_orig_glListBase = this->m_ptr_glListBase;
+if(this->m_ptr_glListBase)this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&CaptureTableDecorator::m_glListBase_capture;
+this->m_orig_glTexCoord2bOES = this->m_ptr_glTexCoord2bOES;
+if(this->m_ptr_glTexCoord2bOES)this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&CaptureTableDecorator::m_glTexCoord2bOES_capture;
+this->m_orig_glBindMaterialParameterEXT = this->m_ptr_glBindMaterialParameterEXT;
+if(this->m_ptr_glBindMaterialParameterEXT)this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&CaptureTableDecorator::m_glBindMaterialParameterEXT_capture;
+this->m_orig_glGlobalAlphaFactorubSUN = this->m_ptr_glGlobalAlphaFactorubSUN;
+if(this->m_ptr_glGlobalAlphaFactorubSUN)this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactorubSUN_capture;
+this->m_orig_glVertexAttribL1ui64NV = this->m_ptr_glVertexAttribL1ui64NV;
+if(this->m_ptr_glVertexAttribL1ui64NV)this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&CaptureTableDecorator::m_glVertexAttribL1ui64NV_capture;
+this->m_orig_glPointParameterfSGIS = this->m_ptr_glPointParameterfSGIS;
+if(this->m_ptr_glPointParameterfSGIS)this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&CaptureTableDecorator::m_glPointParameterfSGIS_capture;
+this->m_orig_glGetImageTransformParameterivHP = this->m_ptr_glGetImageTransformParameterivHP;
+if(this->m_ptr_glGetImageTransformParameterivHP)this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&CaptureTableDecorator::m_glGetImageTransformParameterivHP_capture;
+this->m_orig_glColorSubTableEXT = this->m_ptr_glColorSubTableEXT;
+if(this->m_ptr_glColorSubTableEXT)this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&CaptureTableDecorator::m_glColorSubTableEXT_capture;
+this->m_orig_glPixelTexGenParameterfvSGIS = this->m_ptr_glPixelTexGenParameterfvSGIS;
+if(this->m_ptr_glPixelTexGenParameterfvSGIS)this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&CaptureTableDecorator::m_glPixelTexGenParameterfvSGIS_capture;
+this->m_orig_glClientWaitSync = this->m_ptr_glClientWaitSync;
+if(this->m_ptr_glClientWaitSync)this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&CaptureTableDecorator::m_glClientWaitSync_capture;
+this->m_orig_glQueryObjectParameteruiAMD = this->m_ptr_glQueryObjectParameteruiAMD;
+if(this->m_ptr_glQueryObjectParameteruiAMD)this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&CaptureTableDecorator::m_glQueryObjectParameteruiAMD_capture;
+this->m_orig_glVertexAttribs1fvNV = this->m_ptr_glVertexAttribs1fvNV;
+if(this->m_ptr_glVertexAttribs1fvNV)this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&CaptureTableDecorator::m_glVertexAttribs1fvNV_capture;
+this->m_orig_glVertexAttrib4NusvARB = this->m_ptr_glVertexAttrib4NusvARB;
+if(this->m_ptr_glVertexAttrib4NusvARB)this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NusvARB_capture;
+this->m_orig_glVariantPointerEXT = this->m_ptr_glVariantPointerEXT;
+if(this->m_ptr_glVariantPointerEXT)this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&CaptureTableDecorator::m_glVariantPointerEXT_capture;
+this->m_orig_glTextureBuffer = this->m_ptr_glTextureBuffer;
+if(this->m_ptr_glTextureBuffer)this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&CaptureTableDecorator::m_glTextureBuffer_capture;
+this->m_orig_glVertexAttribI1uiEXT = this->m_ptr_glVertexAttribI1uiEXT;
+if(this->m_ptr_glVertexAttribI1uiEXT)this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&CaptureTableDecorator::m_glVertexAttribI1uiEXT_capture;
+this->m_orig_glInvalidateTexImage = this->m_ptr_glInvalidateTexImage;
+if(this->m_ptr_glInvalidateTexImage)this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&CaptureTableDecorator::m_glInvalidateTexImage_capture;
+this->m_orig_glProgramEnvParametersI4ivNV = this->m_ptr_glProgramEnvParametersI4ivNV;
+if(this->m_ptr_glProgramEnvParametersI4ivNV)this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&CaptureTableDecorator::m_glProgramEnvParametersI4ivNV_capture;
+this->m_orig_glPathGlyphIndexArrayNV = this->m_ptr_glPathGlyphIndexArrayNV;
+if(this->m_ptr_glPathGlyphIndexArrayNV)this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&CaptureTableDecorator::m_glPathGlyphIndexArrayNV_capture;
+this->m_orig_glCopyImageSubData = this->m_ptr_glCopyImageSubData;
+if(this->m_ptr_glCopyImageSubData)this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&CaptureTableDecorator::m_glCopyImageSubData_capture;
+this->m_orig_glGetUniformSubroutineuiv = this->m_ptr_glGetUniformSubroutineuiv;
+if(this->m_ptr_glGetUniformSubroutineuiv)this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&CaptureTableDecorator::m_glGetUniformSubroutineuiv_capture;
+this->m_orig_glBindVertexBuffer = this->m_ptr_glBindVertexBuffer;
+if(this->m_ptr_glBindVertexBuffer)this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&CaptureTableDecorator::m_glBindVertexBuffer_capture;
+this->m_orig_glMultiTexCoord1iARB = this->m_ptr_glMultiTexCoord1iARB;
+if(this->m_ptr_glMultiTexCoord1iARB)this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1iARB_capture;
+this->m_orig_glDebugMessageInsert = this->m_ptr_glDebugMessageInsert;
+if(this->m_ptr_glDebugMessageInsert)this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&CaptureTableDecorator::m_glDebugMessageInsert_capture;
+this->m_orig_glBeginVertexShaderEXT = this->m_ptr_glBeginVertexShaderEXT;
+if(this->m_ptr_glBeginVertexShaderEXT)this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&CaptureTableDecorator::m_glBeginVertexShaderEXT_capture;
+this->m_orig_glIsVariantEnabledEXT = this->m_ptr_glIsVariantEnabledEXT;
+if(this->m_ptr_glIsVariantEnabledEXT)this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&CaptureTableDecorator::m_glIsVariantEnabledEXT_capture;
+this->m_orig_glPassThroughxOES = this->m_ptr_glPassThroughxOES;
+if(this->m_ptr_glPassThroughxOES)this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&CaptureTableDecorator::m_glPassThroughxOES_capture;
+this->m_orig_glIsSampler = this->m_ptr_glIsSampler;
+if(this->m_ptr_glIsSampler)this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&CaptureTableDecorator::m_glIsSampler_capture;
+this->m_orig_glConservativeRasterParameterfNV = this->m_ptr_glConservativeRasterParameterfNV;
+if(this->m_ptr_glConservativeRasterParameterfNV)this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&CaptureTableDecorator::m_glConservativeRasterParameterfNV_capture;
+this->m_orig_glMultiTexGenivEXT = this->m_ptr_glMultiTexGenivEXT;
+if(this->m_ptr_glMultiTexGenivEXT)this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&CaptureTableDecorator::m_glMultiTexGenivEXT_capture;
+this->m_orig_glNamedFramebufferTexture2DEXT = this->m_ptr_glNamedFramebufferTexture2DEXT;
+if(this->m_ptr_glNamedFramebufferTexture2DEXT)this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTexture2DEXT_capture;
+this->m_orig_glCopyTexSubImage1D = this->m_ptr_glCopyTexSubImage1D;
+if(this->m_ptr_glCopyTexSubImage1D)this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&CaptureTableDecorator::m_glCopyTexSubImage1D_capture;
+this->m_orig_glTexCoord1i = this->m_ptr_glTexCoord1i;
+if(this->m_ptr_glTexCoord1i)this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&CaptureTableDecorator::m_glTexCoord1i_capture;
+this->m_orig_glCheckFramebufferStatus = this->m_ptr_glCheckFramebufferStatus;
+if(this->m_ptr_glCheckFramebufferStatus)this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&CaptureTableDecorator::m_glCheckFramebufferStatus_capture;
+this->m_orig_glDrawElementArrayAPPLE = this->m_ptr_glDrawElementArrayAPPLE;
+if(this->m_ptr_glDrawElementArrayAPPLE)this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&CaptureTableDecorator::m_glDrawElementArrayAPPLE_capture;
+this->m_orig_glTexCoord1d = this->m_ptr_glTexCoord1d;
+if(this->m_ptr_glTexCoord1d)this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&CaptureTableDecorator::m_glTexCoord1d_capture;
+this->m_orig_glTexCoord1f = this->m_ptr_glTexCoord1f;
+if(this->m_ptr_glTexCoord1f)this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&CaptureTableDecorator::m_glTexCoord1f_capture;
+this->m_orig_glFragmentLightivSGIX = this->m_ptr_glFragmentLightivSGIX;
+if(this->m_ptr_glFragmentLightivSGIX)this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&CaptureTableDecorator::m_glFragmentLightivSGIX_capture;
+this->m_orig_glBindImageTexture = this->m_ptr_glBindImageTexture;
+if(this->m_ptr_glBindImageTexture)this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&CaptureTableDecorator::m_glBindImageTexture_capture;
+this->m_orig_glTransformFeedbackVaryings = this->m_ptr_glTransformFeedbackVaryings;
+if(this->m_ptr_glTransformFeedbackVaryings)this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&CaptureTableDecorator::m_glTransformFeedbackVaryings_capture;
+this->m_orig_glMulticastBufferSubDataNV = this->m_ptr_glMulticastBufferSubDataNV;
+if(this->m_ptr_glMulticastBufferSubDataNV)this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&CaptureTableDecorator::m_glMulticastBufferSubDataNV_capture;
+this->m_orig_glDrawRangeElements = this->m_ptr_glDrawRangeElements;
+if(this->m_ptr_glDrawRangeElements)this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&CaptureTableDecorator::m_glDrawRangeElements_capture;
+this->m_orig_glTexCoord1s = this->m_ptr_glTexCoord1s;
+if(this->m_ptr_glTexCoord1s)this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&CaptureTableDecorator::m_glTexCoord1s_capture;
+this->m_orig_glBindBufferBase = this->m_ptr_glBindBufferBase;
+if(this->m_ptr_glBindBufferBase)this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&CaptureTableDecorator::m_glBindBufferBase_capture;
+this->m_orig_glColor3bv = this->m_ptr_glColor3bv;
+if(this->m_ptr_glColor3bv)this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&CaptureTableDecorator::m_glColor3bv_capture;
+this->m_orig_glSyncTextureINTEL = this->m_ptr_glSyncTextureINTEL;
+if(this->m_ptr_glSyncTextureINTEL)this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&CaptureTableDecorator::m_glSyncTextureINTEL_capture;
+this->m_orig_glCreateSamplers = this->m_ptr_glCreateSamplers;
+if(this->m_ptr_glCreateSamplers)this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&CaptureTableDecorator::m_glCreateSamplers_capture;
+this->m_orig_glCombinerParameterfNV = this->m_ptr_glCombinerParameterfNV;
+if(this->m_ptr_glCombinerParameterfNV)this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&CaptureTableDecorator::m_glCombinerParameterfNV_capture;
+this->m_orig_glGetArrayObjectivATI = this->m_ptr_glGetArrayObjectivATI;
+if(this->m_ptr_glGetArrayObjectivATI)this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&CaptureTableDecorator::m_glGetArrayObjectivATI_capture;
+this->m_orig_glMultiDrawArrays = this->m_ptr_glMultiDrawArrays;
+if(this->m_ptr_glMultiDrawArrays)this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&CaptureTableDecorator::m_glMultiDrawArrays_capture;
+this->m_orig_glSampleMapATI = this->m_ptr_glSampleMapATI;
+if(this->m_ptr_glSampleMapATI)this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&CaptureTableDecorator::m_glSampleMapATI_capture;
+this->m_orig_glProgramUniform2i64ARB = this->m_ptr_glProgramUniform2i64ARB;
+if(this->m_ptr_glProgramUniform2i64ARB)this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&CaptureTableDecorator::m_glProgramUniform2i64ARB_capture;
+this->m_orig_glBinormal3ivEXT = this->m_ptr_glBinormal3ivEXT;
+if(this->m_ptr_glBinormal3ivEXT)this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&CaptureTableDecorator::m_glBinormal3ivEXT_capture;
+this->m_orig_glMultiDrawArraysIndirectCountARB = this->m_ptr_glMultiDrawArraysIndirectCountARB;
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB)this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirectCountARB_capture;
+this->m_orig_glTextureStorageMem1DEXT = this->m_ptr_glTextureStorageMem1DEXT;
+if(this->m_ptr_glTextureStorageMem1DEXT)this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&CaptureTableDecorator::m_glTextureStorageMem1DEXT_capture;
+this->m_orig_glWindowPos2ivMESA = this->m_ptr_glWindowPos2ivMESA;
+if(this->m_ptr_glWindowPos2ivMESA)this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&CaptureTableDecorator::m_glWindowPos2ivMESA_capture;
+this->m_orig_glTexCoordP4ui = this->m_ptr_glTexCoordP4ui;
+if(this->m_ptr_glTexCoordP4ui)this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&CaptureTableDecorator::m_glTexCoordP4ui_capture;
+this->m_orig_glMultiTexSubImage1DEXT = this->m_ptr_glMultiTexSubImage1DEXT;
+if(this->m_ptr_glMultiTexSubImage1DEXT)this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glMultiTexSubImage1DEXT_capture;
+this->m_orig_glProgramUniformMatrix2x3fvEXT = this->m_ptr_glProgramUniformMatrix2x3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT)this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x3fvEXT_capture;
+this->m_orig_glBufferDataARB = this->m_ptr_glBufferDataARB;
+if(this->m_ptr_glBufferDataARB)this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&CaptureTableDecorator::m_glBufferDataARB_capture;
+this->m_orig_glVertexAttribIFormat = this->m_ptr_glVertexAttribIFormat;
+if(this->m_ptr_glVertexAttribIFormat)this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&CaptureTableDecorator::m_glVertexAttribIFormat_capture;
+this->m_orig_glCreateFramebuffers = this->m_ptr_glCreateFramebuffers;
+if(this->m_ptr_glCreateFramebuffers)this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&CaptureTableDecorator::m_glCreateFramebuffers_capture;
+this->m_orig_glNormalStream3dvATI = this->m_ptr_glNormalStream3dvATI;
+if(this->m_ptr_glNormalStream3dvATI)this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&CaptureTableDecorator::m_glNormalStream3dvATI_capture;
+this->m_orig_glClearAccum = this->m_ptr_glClearAccum;
+if(this->m_ptr_glClearAccum)this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&CaptureTableDecorator::m_glClearAccum_capture;
+this->m_orig_glUniform3i64vNV = this->m_ptr_glUniform3i64vNV;
+if(this->m_ptr_glUniform3i64vNV)this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&CaptureTableDecorator::m_glUniform3i64vNV_capture;
+this->m_orig_glNormal3fVertex3fSUN = this->m_ptr_glNormal3fVertex3fSUN;
+if(this->m_ptr_glNormal3fVertex3fSUN)this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glNormal3fVertex3fSUN_capture;
+this->m_orig_glUniform2uivEXT = this->m_ptr_glUniform2uivEXT;
+if(this->m_ptr_glUniform2uivEXT)this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&CaptureTableDecorator::m_glUniform2uivEXT_capture;
+this->m_orig_glBeginQuery = this->m_ptr_glBeginQuery;
+if(this->m_ptr_glBeginQuery)this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&CaptureTableDecorator::m_glBeginQuery_capture;
+this->m_orig_glStencilThenCoverStrokePathInstancedNV = this->m_ptr_glStencilThenCoverStrokePathInstancedNV;
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV)this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_capture;
+this->m_orig_glBindBuffer = this->m_ptr_glBindBuffer;
+if(this->m_ptr_glBindBuffer)this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&CaptureTableDecorator::m_glBindBuffer_capture;
+this->m_orig_glMap2d = this->m_ptr_glMap2d;
+if(this->m_ptr_glMap2d)this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&CaptureTableDecorator::m_glMap2d_capture;
+this->m_orig_glMap2f = this->m_ptr_glMap2f;
+if(this->m_ptr_glMap2f)this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&CaptureTableDecorator::m_glMap2f_capture;
+this->m_orig_glMakeImageHandleResidentNV = this->m_ptr_glMakeImageHandleResidentNV;
+if(this->m_ptr_glMakeImageHandleResidentNV)this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&CaptureTableDecorator::m_glMakeImageHandleResidentNV_capture;
+this->m_orig_glUniformMatrix2x4fv = this->m_ptr_glUniformMatrix2x4fv;
+if(this->m_ptr_glUniformMatrix2x4fv)this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&CaptureTableDecorator::m_glUniformMatrix2x4fv_capture;
+this->m_orig_glGetMultiTexParameterfvEXT = this->m_ptr_glGetMultiTexParameterfvEXT;
+if(this->m_ptr_glGetMultiTexParameterfvEXT)this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexParameterfvEXT_capture;
+this->m_orig_glDepthRangeIndexed = this->m_ptr_glDepthRangeIndexed;
+if(this->m_ptr_glDepthRangeIndexed)this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&CaptureTableDecorator::m_glDepthRangeIndexed_capture;
+this->m_orig_glIsEnabled = this->m_ptr_glIsEnabled;
+if(this->m_ptr_glIsEnabled)this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&CaptureTableDecorator::m_glIsEnabled_capture;
+this->m_orig_glMatrixScalefEXT = this->m_ptr_glMatrixScalefEXT;
+if(this->m_ptr_glMatrixScalefEXT)this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&CaptureTableDecorator::m_glMatrixScalefEXT_capture;
+this->m_orig_glGetError = this->m_ptr_glGetError;
+if(this->m_ptr_glGetError)this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&CaptureTableDecorator::m_glGetError_capture;
+this->m_orig_glGetTexEnviv = this->m_ptr_glGetTexEnviv;
+if(this->m_ptr_glGetTexEnviv)this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&CaptureTableDecorator::m_glGetTexEnviv_capture;
+this->m_orig_glBindTextureUnitParameterEXT = this->m_ptr_glBindTextureUnitParameterEXT;
+if(this->m_ptr_glBindTextureUnitParameterEXT)this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&CaptureTableDecorator::m_glBindTextureUnitParameterEXT_capture;
+this->m_orig_glGetnUniformfvARB = this->m_ptr_glGetnUniformfvARB;
+if(this->m_ptr_glGetnUniformfvARB)this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&CaptureTableDecorator::m_glGetnUniformfvARB_capture;
+this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_capture;
+this->m_orig_glDeletePerfQueryINTEL = this->m_ptr_glDeletePerfQueryINTEL;
+if(this->m_ptr_glDeletePerfQueryINTEL)this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&CaptureTableDecorator::m_glDeletePerfQueryINTEL_capture;
+this->m_orig_glActiveVaryingNV = this->m_ptr_glActiveVaryingNV;
+if(this->m_ptr_glActiveVaryingNV)this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&CaptureTableDecorator::m_glActiveVaryingNV_capture;
+this->m_orig_glGetActiveUniformARB = this->m_ptr_glGetActiveUniformARB;
+if(this->m_ptr_glGetActiveUniformARB)this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&CaptureTableDecorator::m_glGetActiveUniformARB_capture;
+this->m_orig_glVertexAttribI3ivEXT = this->m_ptr_glVertexAttribI3ivEXT;
+if(this->m_ptr_glVertexAttribI3ivEXT)this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI3ivEXT_capture;
+this->m_orig_glEvalCoord1d = this->m_ptr_glEvalCoord1d;
+if(this->m_ptr_glEvalCoord1d)this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&CaptureTableDecorator::m_glEvalCoord1d_capture;
+this->m_orig_glNamedCopyBufferSubDataEXT = this->m_ptr_glNamedCopyBufferSubDataEXT;
+if(this->m_ptr_glNamedCopyBufferSubDataEXT)this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&CaptureTableDecorator::m_glNamedCopyBufferSubDataEXT_capture;
+this->m_orig_glEvalCoord1f = this->m_ptr_glEvalCoord1f;
+if(this->m_ptr_glEvalCoord1f)this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&CaptureTableDecorator::m_glEvalCoord1f_capture;
+this->m_orig_glPixelMapfv = this->m_ptr_glPixelMapfv;
+if(this->m_ptr_glPixelMapfv)this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&CaptureTableDecorator::m_glPixelMapfv_capture;
+this->m_orig_glVertexAttribI1ivEXT = this->m_ptr_glVertexAttribI1ivEXT;
+if(this->m_ptr_glVertexAttribI1ivEXT)this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI1ivEXT_capture;
+this->m_orig_glCreateSyncFromCLeventARB = this->m_ptr_glCreateSyncFromCLeventARB;
+if(this->m_ptr_glCreateSyncFromCLeventARB)this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&CaptureTableDecorator::m_glCreateSyncFromCLeventARB_capture;
+this->m_orig_glGetPixelMapusv = this->m_ptr_glGetPixelMapusv;
+if(this->m_ptr_glGetPixelMapusv)this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&CaptureTableDecorator::m_glGetPixelMapusv_capture;
+this->m_orig_glGetnColorTableARB = this->m_ptr_glGetnColorTableARB;
+if(this->m_ptr_glGetnColorTableARB)this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&CaptureTableDecorator::m_glGetnColorTableARB_capture;
+this->m_orig_glAccum = this->m_ptr_glAccum;
+if(this->m_ptr_glAccum)this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&CaptureTableDecorator::m_glAccum_capture;
+this->m_orig_glRasterPos3sv = this->m_ptr_glRasterPos3sv;
+if(this->m_ptr_glRasterPos3sv)this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&CaptureTableDecorator::m_glRasterPos3sv_capture;
+this->m_orig_glTexCoord2iv = this->m_ptr_glTexCoord2iv;
+if(this->m_ptr_glTexCoord2iv)this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&CaptureTableDecorator::m_glTexCoord2iv_capture;
+this->m_orig_glBlendFunciARB = this->m_ptr_glBlendFunciARB;
+if(this->m_ptr_glBlendFunciARB)this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&CaptureTableDecorator::m_glBlendFunciARB_capture;
+this->m_orig_glProgramUniform3i64vARB = this->m_ptr_glProgramUniform3i64vARB;
+if(this->m_ptr_glProgramUniform3i64vARB)this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&CaptureTableDecorator::m_glProgramUniform3i64vARB_capture;
+this->m_orig_glGetFramebufferAttachmentParameteriv = this->m_ptr_glGetFramebufferAttachmentParameteriv;
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv)this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&CaptureTableDecorator::m_glGetFramebufferAttachmentParameteriv_capture;
+this->m_orig_glProgramUniform4ui = this->m_ptr_glProgramUniform4ui;
+if(this->m_ptr_glProgramUniform4ui)this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&CaptureTableDecorator::m_glProgramUniform4ui_capture;
+this->m_orig_glStencilMask = this->m_ptr_glStencilMask;
+if(this->m_ptr_glStencilMask)this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&CaptureTableDecorator::m_glStencilMask_capture;
+this->m_orig_glResetHistogramEXT = this->m_ptr_glResetHistogramEXT;
+if(this->m_ptr_glResetHistogramEXT)this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&CaptureTableDecorator::m_glResetHistogramEXT_capture;
+this->m_orig_glLightxOES = this->m_ptr_glLightxOES;
+if(this->m_ptr_glLightxOES)this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&CaptureTableDecorator::m_glLightxOES_capture;
+this->m_orig_glNamedBufferData = this->m_ptr_glNamedBufferData;
+if(this->m_ptr_glNamedBufferData)this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&CaptureTableDecorator::m_glNamedBufferData_capture;
+this->m_orig_glVertexStream3sATI = this->m_ptr_glVertexStream3sATI;
+if(this->m_ptr_glVertexStream3sATI)this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&CaptureTableDecorator::m_glVertexStream3sATI_capture;
+this->m_orig_glVertexAttrib3fvARB = this->m_ptr_glVertexAttrib3fvARB;
+if(this->m_ptr_glVertexAttrib3fvARB)this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&CaptureTableDecorator::m_glVertexAttrib3fvARB_capture;
+this->m_orig_glClearNamedBufferSubData = this->m_ptr_glClearNamedBufferSubData;
+if(this->m_ptr_glClearNamedBufferSubData)this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glClearNamedBufferSubData_capture;
+this->m_orig_glProgramUniformHandleui64ARB = this->m_ptr_glProgramUniformHandleui64ARB;
+if(this->m_ptr_glProgramUniformHandleui64ARB)this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&CaptureTableDecorator::m_glProgramUniformHandleui64ARB_capture;
+this->m_orig_glUniform3iARB = this->m_ptr_glUniform3iARB;
+if(this->m_ptr_glUniform3iARB)this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&CaptureTableDecorator::m_glUniform3iARB_capture;
+this->m_orig_glCreateProgramObjectARB = this->m_ptr_glCreateProgramObjectARB;
+if(this->m_ptr_glCreateProgramObjectARB)this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&CaptureTableDecorator::m_glCreateProgramObjectARB_capture;
+this->m_orig_glMultiTexCoord1dvARB = this->m_ptr_glMultiTexCoord1dvARB;
+if(this->m_ptr_glMultiTexCoord1dvARB)this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1dvARB_capture;
+this->m_orig_glGetObjectParameterfvARB = this->m_ptr_glGetObjectParameterfvARB;
+if(this->m_ptr_glGetObjectParameterfvARB)this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&CaptureTableDecorator::m_glGetObjectParameterfvARB_capture;
+this->m_orig_glRectsv = this->m_ptr_glRectsv;
+if(this->m_ptr_glRectsv)this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&CaptureTableDecorator::m_glRectsv_capture;
+this->m_orig_glMultiTexImage2DEXT = this->m_ptr_glMultiTexImage2DEXT;
+if(this->m_ptr_glMultiTexImage2DEXT)this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&CaptureTableDecorator::m_glMultiTexImage2DEXT_capture;
+this->m_orig_glProgramUniform1i64NV = this->m_ptr_glProgramUniform1i64NV;
+if(this->m_ptr_glProgramUniform1i64NV)this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&CaptureTableDecorator::m_glProgramUniform1i64NV_capture;
+this->m_orig_glGetObjectBufferivATI = this->m_ptr_glGetObjectBufferivATI;
+if(this->m_ptr_glGetObjectBufferivATI)this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&CaptureTableDecorator::m_glGetObjectBufferivATI_capture;
+this->m_orig_glUniform4i64ARB = this->m_ptr_glUniform4i64ARB;
+if(this->m_ptr_glUniform4i64ARB)this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&CaptureTableDecorator::m_glUniform4i64ARB_capture;
+this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_capture;
+this->m_orig_glBlendFuncSeparateINGR = this->m_ptr_glBlendFuncSeparateINGR;
+if(this->m_ptr_glBlendFuncSeparateINGR)this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&CaptureTableDecorator::m_glBlendFuncSeparateINGR_capture;
+this->m_orig_glGetVideoCaptureStreamfvNV = this->m_ptr_glGetVideoCaptureStreamfvNV;
+if(this->m_ptr_glGetVideoCaptureStreamfvNV)this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&CaptureTableDecorator::m_glGetVideoCaptureStreamfvNV_capture;
+this->m_orig_glVertexAttrib2fARB = this->m_ptr_glVertexAttrib2fARB;
+if(this->m_ptr_glVertexAttrib2fARB)this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&CaptureTableDecorator::m_glVertexAttrib2fARB_capture;
+this->m_orig_glGetTexGeniv = this->m_ptr_glGetTexGeniv;
+if(this->m_ptr_glGetTexGeniv)this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&CaptureTableDecorator::m_glGetTexGeniv_capture;
+this->m_orig_glPixelStorei = this->m_ptr_glPixelStorei;
+if(this->m_ptr_glPixelStorei)this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&CaptureTableDecorator::m_glPixelStorei_capture;
+this->m_orig_glGetCompressedTextureSubImage = this->m_ptr_glGetCompressedTextureSubImage;
+if(this->m_ptr_glGetCompressedTextureSubImage)this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&CaptureTableDecorator::m_glGetCompressedTextureSubImage_capture;
+this->m_orig_glCopyImageSubDataNV = this->m_ptr_glCopyImageSubDataNV;
+if(this->m_ptr_glCopyImageSubDataNV)this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&CaptureTableDecorator::m_glCopyImageSubDataNV_capture;
+this->m_orig_glActiveShaderProgram = this->m_ptr_glActiveShaderProgram;
+if(this->m_ptr_glActiveShaderProgram)this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&CaptureTableDecorator::m_glActiveShaderProgram_capture;
+this->m_orig_glVertexStream1iATI = this->m_ptr_glVertexStream1iATI;
+if(this->m_ptr_glVertexStream1iATI)this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&CaptureTableDecorator::m_glVertexStream1iATI_capture;
+this->m_orig_glPatchParameterfv = this->m_ptr_glPatchParameterfv;
+if(this->m_ptr_glPatchParameterfv)this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&CaptureTableDecorator::m_glPatchParameterfv_capture;
+this->m_orig_glIsFramebufferEXT = this->m_ptr_glIsFramebufferEXT;
+if(this->m_ptr_glIsFramebufferEXT)this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&CaptureTableDecorator::m_glIsFramebufferEXT_capture;
+this->m_orig_glTextureStorage2D = this->m_ptr_glTextureStorage2D;
+if(this->m_ptr_glTextureStorage2D)this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&CaptureTableDecorator::m_glTextureStorage2D_capture;
+this->m_orig_glProgramUniform1ui64ARB = this->m_ptr_glProgramUniform1ui64ARB;
+if(this->m_ptr_glProgramUniform1ui64ARB)this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&CaptureTableDecorator::m_glProgramUniform1ui64ARB_capture;
+this->m_orig_glTexBufferRange = this->m_ptr_glTexBufferRange;
+if(this->m_ptr_glTexBufferRange)this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&CaptureTableDecorator::m_glTexBufferRange_capture;
+this->m_orig_glGetPixelTexGenParameterivSGIS = this->m_ptr_glGetPixelTexGenParameterivSGIS;
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS)this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&CaptureTableDecorator::m_glGetPixelTexGenParameterivSGIS_capture;
+this->m_orig_glTextureSubImage3DEXT = this->m_ptr_glTextureSubImage3DEXT;
+if(this->m_ptr_glTextureSubImage3DEXT)this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glTextureSubImage3DEXT_capture;
+this->m_orig_glClipControl = this->m_ptr_glClipControl;
+if(this->m_ptr_glClipControl)this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&CaptureTableDecorator::m_glClipControl_capture;
+this->m_orig_glGetProgramResourceiv = this->m_ptr_glGetProgramResourceiv;
+if(this->m_ptr_glGetProgramResourceiv)this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&CaptureTableDecorator::m_glGetProgramResourceiv_capture;
+this->m_orig_glMultiTexCoordP2uiv = this->m_ptr_glMultiTexCoordP2uiv;
+if(this->m_ptr_glMultiTexCoordP2uiv)this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&CaptureTableDecorator::m_glMultiTexCoordP2uiv_capture;
+this->m_orig_glVertexAttribI3ui = this->m_ptr_glVertexAttribI3ui;
+if(this->m_ptr_glVertexAttribI3ui)this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&CaptureTableDecorator::m_glVertexAttribI3ui_capture;
+this->m_orig_glSampleMaskSGIS = this->m_ptr_glSampleMaskSGIS;
+if(this->m_ptr_glSampleMaskSGIS)this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&CaptureTableDecorator::m_glSampleMaskSGIS_capture;
+this->m_orig_glVertexAttrib4NivARB = this->m_ptr_glVertexAttrib4NivARB;
+if(this->m_ptr_glVertexAttrib4NivARB)this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NivARB_capture;
+this->m_orig_glGlobalAlphaFactorfSUN = this->m_ptr_glGlobalAlphaFactorfSUN;
+if(this->m_ptr_glGlobalAlphaFactorfSUN)this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactorfSUN_capture;
+this->m_orig_glBlendEquationSeparateIndexedAMD = this->m_ptr_glBlendEquationSeparateIndexedAMD;
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD)this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&CaptureTableDecorator::m_glBlendEquationSeparateIndexedAMD_capture;
+this->m_orig_glGetPerfCounterInfoINTEL = this->m_ptr_glGetPerfCounterInfoINTEL;
+if(this->m_ptr_glGetPerfCounterInfoINTEL)this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&CaptureTableDecorator::m_glGetPerfCounterInfoINTEL_capture;
+this->m_orig_glDeleteProgramsNV = this->m_ptr_glDeleteProgramsNV;
+if(this->m_ptr_glDeleteProgramsNV)this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&CaptureTableDecorator::m_glDeleteProgramsNV_capture;
+this->m_orig_glPixelZoomxOES = this->m_ptr_glPixelZoomxOES;
+if(this->m_ptr_glPixelZoomxOES)this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&CaptureTableDecorator::m_glPixelZoomxOES_capture;
+this->m_orig_glGetCombinerOutputParameterivNV = this->m_ptr_glGetCombinerOutputParameterivNV;
+if(this->m_ptr_glGetCombinerOutputParameterivNV)this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetCombinerOutputParameterivNV_capture;
+this->m_orig_glRasterPos2xvOES = this->m_ptr_glRasterPos2xvOES;
+if(this->m_ptr_glRasterPos2xvOES)this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&CaptureTableDecorator::m_glRasterPos2xvOES_capture;
+this->m_orig_glGetTexImage = this->m_ptr_glGetTexImage;
+if(this->m_ptr_glGetTexImage)this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&CaptureTableDecorator::m_glGetTexImage_capture;
+this->m_orig_glVertexArrayVertexBuffers = this->m_ptr_glVertexArrayVertexBuffers;
+if(this->m_ptr_glVertexArrayVertexBuffers)this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&CaptureTableDecorator::m_glVertexArrayVertexBuffers_capture;
+this->m_orig_glUniform1ui64NV = this->m_ptr_glUniform1ui64NV;
+if(this->m_ptr_glUniform1ui64NV)this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&CaptureTableDecorator::m_glUniform1ui64NV_capture;
+this->m_orig_glProgramParameteri = this->m_ptr_glProgramParameteri;
+if(this->m_ptr_glProgramParameteri)this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&CaptureTableDecorator::m_glProgramParameteri_capture;
+this->m_orig_glNormal3xOES = this->m_ptr_glNormal3xOES;
+if(this->m_ptr_glNormal3xOES)this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&CaptureTableDecorator::m_glNormal3xOES_capture;
+this->m_orig_glGetMapfv = this->m_ptr_glGetMapfv;
+if(this->m_ptr_glGetMapfv)this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&CaptureTableDecorator::m_glGetMapfv_capture;
+this->m_orig_glVertexStream2dvATI = this->m_ptr_glVertexStream2dvATI;
+if(this->m_ptr_glVertexStream2dvATI)this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&CaptureTableDecorator::m_glVertexStream2dvATI_capture;
+this->m_orig_glPathStencilDepthOffsetNV = this->m_ptr_glPathStencilDepthOffsetNV;
+if(this->m_ptr_glPathStencilDepthOffsetNV)this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&CaptureTableDecorator::m_glPathStencilDepthOffsetNV_capture;
+this->m_orig_glIsStateNV = this->m_ptr_glIsStateNV;
+if(this->m_ptr_glIsStateNV)this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&CaptureTableDecorator::m_glIsStateNV_capture;
+this->m_orig_glGetIntegerui64vNV = this->m_ptr_glGetIntegerui64vNV;
+if(this->m_ptr_glGetIntegerui64vNV)this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&CaptureTableDecorator::m_glGetIntegerui64vNV_capture;
+this->m_orig_glGetImageTransformParameterfvHP = this->m_ptr_glGetImageTransformParameterfvHP;
+if(this->m_ptr_glGetImageTransformParameterfvHP)this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&CaptureTableDecorator::m_glGetImageTransformParameterfvHP_capture;
+this->m_orig_glRasterPos2fv = this->m_ptr_glRasterPos2fv;
+if(this->m_ptr_glRasterPos2fv)this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&CaptureTableDecorator::m_glRasterPos2fv_capture;
+this->m_orig_glVertex3xOES = this->m_ptr_glVertex3xOES;
+if(this->m_ptr_glVertex3xOES)this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&CaptureTableDecorator::m_glVertex3xOES_capture;
+this->m_orig_glIsMemoryObjectEXT = this->m_ptr_glIsMemoryObjectEXT;
+if(this->m_ptr_glIsMemoryObjectEXT)this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&CaptureTableDecorator::m_glIsMemoryObjectEXT_capture;
+this->m_orig_glWeightPointerARB = this->m_ptr_glWeightPointerARB;
+if(this->m_ptr_glWeightPointerARB)this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&CaptureTableDecorator::m_glWeightPointerARB_capture;
+this->m_orig_glFinishFenceNV = this->m_ptr_glFinishFenceNV;
+if(this->m_ptr_glFinishFenceNV)this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&CaptureTableDecorator::m_glFinishFenceNV_capture;
+this->m_orig_glDepthRangexOES = this->m_ptr_glDepthRangexOES;
+if(this->m_ptr_glDepthRangexOES)this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&CaptureTableDecorator::m_glDepthRangexOES_capture;
+this->m_orig_glEnableVertexArrayAttribEXT = this->m_ptr_glEnableVertexArrayAttribEXT;
+if(this->m_ptr_glEnableVertexArrayAttribEXT)this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&CaptureTableDecorator::m_glEnableVertexArrayAttribEXT_capture;
+this->m_orig_glProgramUniform2uivEXT = this->m_ptr_glProgramUniform2uivEXT;
+if(this->m_ptr_glProgramUniform2uivEXT)this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&CaptureTableDecorator::m_glProgramUniform2uivEXT_capture;
+this->m_orig_glGetDoubleIndexedvEXT = this->m_ptr_glGetDoubleIndexedvEXT;
+if(this->m_ptr_glGetDoubleIndexedvEXT)this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&CaptureTableDecorator::m_glGetDoubleIndexedvEXT_capture;
+this->m_orig_glWindowPos2fMESA = this->m_ptr_glWindowPos2fMESA;
+if(this->m_ptr_glWindowPos2fMESA)this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&CaptureTableDecorator::m_glWindowPos2fMESA_capture;
+this->m_orig_glSecondaryColor3b = this->m_ptr_glSecondaryColor3b;
+if(this->m_ptr_glSecondaryColor3b)this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&CaptureTableDecorator::m_glSecondaryColor3b_capture;
+this->m_orig_glCopyConvolutionFilter1DEXT = this->m_ptr_glCopyConvolutionFilter1DEXT;
+if(this->m_ptr_glCopyConvolutionFilter1DEXT)this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&CaptureTableDecorator::m_glCopyConvolutionFilter1DEXT_capture;
+this->m_orig_glWindowPos2sv = this->m_ptr_glWindowPos2sv;
+if(this->m_ptr_glWindowPos2sv)this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&CaptureTableDecorator::m_glWindowPos2sv_capture;
+this->m_orig_glBindFramebufferEXT = this->m_ptr_glBindFramebufferEXT;
+if(this->m_ptr_glBindFramebufferEXT)this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&CaptureTableDecorator::m_glBindFramebufferEXT_capture;
+this->m_orig_glCreateShader = this->m_ptr_glCreateShader;
+if(this->m_ptr_glCreateShader)this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&CaptureTableDecorator::m_glCreateShader_capture;
+this->m_orig_glGenPathsNV = this->m_ptr_glGenPathsNV;
+if(this->m_ptr_glGenPathsNV)this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&CaptureTableDecorator::m_glGenPathsNV_capture;
+this->m_orig_glGenRenderbuffers = this->m_ptr_glGenRenderbuffers;
+if(this->m_ptr_glGenRenderbuffers)this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&CaptureTableDecorator::m_glGenRenderbuffers_capture;
+this->m_orig_glCopyTexSubImage2D = this->m_ptr_glCopyTexSubImage2D;
+if(this->m_ptr_glCopyTexSubImage2D)this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&CaptureTableDecorator::m_glCopyTexSubImage2D_capture;
+this->m_orig_glVertexAttrib4ubvARB = this->m_ptr_glVertexAttrib4ubvARB;
+if(this->m_ptr_glVertexAttrib4ubvARB)this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4ubvARB_capture;
+this->m_orig_glDrawTextureNV = this->m_ptr_glDrawTextureNV;
+if(this->m_ptr_glDrawTextureNV)this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&CaptureTableDecorator::m_glDrawTextureNV_capture;
+this->m_orig_glVertexAttribs1svNV = this->m_ptr_glVertexAttribs1svNV;
+if(this->m_ptr_glVertexAttribs1svNV)this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&CaptureTableDecorator::m_glVertexAttribs1svNV_capture;
+this->m_orig_glClearNamedBufferSubDataEXT = this->m_ptr_glClearNamedBufferSubDataEXT;
+if(this->m_ptr_glClearNamedBufferSubDataEXT)this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&CaptureTableDecorator::m_glClearNamedBufferSubDataEXT_capture;
+this->m_orig_glBlendFuncSeparate = this->m_ptr_glBlendFuncSeparate;
+if(this->m_ptr_glBlendFuncSeparate)this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&CaptureTableDecorator::m_glBlendFuncSeparate_capture;
+this->m_orig_glPointParameterfARB = this->m_ptr_glPointParameterfARB;
+if(this->m_ptr_glPointParameterfARB)this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&CaptureTableDecorator::m_glPointParameterfARB_capture;
+this->m_orig_glTexCoord2fv = this->m_ptr_glTexCoord2fv;
+if(this->m_ptr_glTexCoord2fv)this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&CaptureTableDecorator::m_glTexCoord2fv_capture;
+this->m_orig_glGetVariantFloatvEXT = this->m_ptr_glGetVariantFloatvEXT;
+if(this->m_ptr_glGetVariantFloatvEXT)this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&CaptureTableDecorator::m_glGetVariantFloatvEXT_capture;
+this->m_orig_glVertexP2ui = this->m_ptr_glVertexP2ui;
+if(this->m_ptr_glVertexP2ui)this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&CaptureTableDecorator::m_glVertexP2ui_capture;
+this->m_orig_glWindowPos2dMESA = this->m_ptr_glWindowPos2dMESA;
+if(this->m_ptr_glWindowPos2dMESA)this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&CaptureTableDecorator::m_glWindowPos2dMESA_capture;
+this->m_orig_glTexCoord4fv = this->m_ptr_glTexCoord4fv;
+if(this->m_ptr_glTexCoord4fv)this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&CaptureTableDecorator::m_glTexCoord4fv_capture;
+this->m_orig_glBindFragDataLocationEXT = this->m_ptr_glBindFragDataLocationEXT;
+if(this->m_ptr_glBindFragDataLocationEXT)this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&CaptureTableDecorator::m_glBindFragDataLocationEXT_capture;
+this->m_orig_glCompressedTexSubImage1DARB = this->m_ptr_glCompressedTexSubImage1DARB;
+if(this->m_ptr_glCompressedTexSubImage1DARB)this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&CaptureTableDecorator::m_glCompressedTexSubImage1DARB_capture;
+this->m_orig_glGetTextureImageEXT = this->m_ptr_glGetTextureImageEXT;
+if(this->m_ptr_glGetTextureImageEXT)this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&CaptureTableDecorator::m_glGetTextureImageEXT_capture;
+this->m_orig_glFogCoordd = this->m_ptr_glFogCoordd;
+if(this->m_ptr_glFogCoordd)this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&CaptureTableDecorator::m_glFogCoordd_capture;
+this->m_orig_glPointSize = this->m_ptr_glPointSize;
+if(this->m_ptr_glPointSize)this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&CaptureTableDecorator::m_glPointSize_capture;
+this->m_orig_glBindTextureUnit = this->m_ptr_glBindTextureUnit;
+if(this->m_ptr_glBindTextureUnit)this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&CaptureTableDecorator::m_glBindTextureUnit_capture;
+this->m_orig_glProgramEnvParameterI4uiNV = this->m_ptr_glProgramEnvParameterI4uiNV;
+if(this->m_ptr_glProgramEnvParameterI4uiNV)this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&CaptureTableDecorator::m_glProgramEnvParameterI4uiNV_capture;
+this->m_orig_glGetProgramPipelineInfoLog = this->m_ptr_glGetProgramPipelineInfoLog;
+if(this->m_ptr_glGetProgramPipelineInfoLog)this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&CaptureTableDecorator::m_glGetProgramPipelineInfoLog_capture;
+this->m_orig_glProgramUniform4i64vARB = this->m_ptr_glProgramUniform4i64vARB;
+if(this->m_ptr_glProgramUniform4i64vARB)this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&CaptureTableDecorator::m_glProgramUniform4i64vARB_capture;
+this->m_orig_glVertexAttrib4Nuiv = this->m_ptr_glVertexAttrib4Nuiv;
+if(this->m_ptr_glVertexAttrib4Nuiv)this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&CaptureTableDecorator::m_glVertexAttrib4Nuiv_capture;
+this->m_orig_glGetUniformfvARB = this->m_ptr_glGetUniformfvARB;
+if(this->m_ptr_glGetUniformfvARB)this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&CaptureTableDecorator::m_glGetUniformfvARB_capture;
+this->m_orig_glWaitSync = this->m_ptr_glWaitSync;
+if(this->m_ptr_glWaitSync)this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&CaptureTableDecorator::m_glWaitSync_capture;
+this->m_orig_glUniform3i = this->m_ptr_glUniform3i;
+if(this->m_ptr_glUniform3i)this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&CaptureTableDecorator::m_glUniform3i_capture;
+this->m_orig_glBlendEquationSeparatei = this->m_ptr_glBlendEquationSeparatei;
+if(this->m_ptr_glBlendEquationSeparatei)this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&CaptureTableDecorator::m_glBlendEquationSeparatei_capture;
+this->m_orig_glVertexAttrib2hvNV = this->m_ptr_glVertexAttrib2hvNV;
+if(this->m_ptr_glVertexAttrib2hvNV)this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&CaptureTableDecorator::m_glVertexAttrib2hvNV_capture;
+this->m_orig_glTextureParameterivEXT = this->m_ptr_glTextureParameterivEXT;
+if(this->m_ptr_glTextureParameterivEXT)this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glTextureParameterivEXT_capture;
+this->m_orig_glUniform3d = this->m_ptr_glUniform3d;
+if(this->m_ptr_glUniform3d)this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&CaptureTableDecorator::m_glUniform3d_capture;
+this->m_orig_glUniform3f = this->m_ptr_glUniform3f;
+if(this->m_ptr_glUniform3f)this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&CaptureTableDecorator::m_glUniform3f_capture;
+this->m_orig_glActiveProgramEXT = this->m_ptr_glActiveProgramEXT;
+if(this->m_ptr_glActiveProgramEXT)this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&CaptureTableDecorator::m_glActiveProgramEXT_capture;
+this->m_orig_glProgramUniform3uiv = this->m_ptr_glProgramUniform3uiv;
+if(this->m_ptr_glProgramUniform3uiv)this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&CaptureTableDecorator::m_glProgramUniform3uiv_capture;
+this->m_orig_glUniform3ui64vARB = this->m_ptr_glUniform3ui64vARB;
+if(this->m_ptr_glUniform3ui64vARB)this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&CaptureTableDecorator::m_glUniform3ui64vARB_capture;
+this->m_orig_glProgramUniform1ui64vARB = this->m_ptr_glProgramUniform1ui64vARB;
+if(this->m_ptr_glProgramUniform1ui64vARB)this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&CaptureTableDecorator::m_glProgramUniform1ui64vARB_capture;
+this->m_orig_glTextureParameterfEXT = this->m_ptr_glTextureParameterfEXT;
+if(this->m_ptr_glTextureParameterfEXT)this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&CaptureTableDecorator::m_glTextureParameterfEXT_capture;
+this->m_orig_glSetFragmentShaderConstantATI = this->m_ptr_glSetFragmentShaderConstantATI;
+if(this->m_ptr_glSetFragmentShaderConstantATI)this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&CaptureTableDecorator::m_glSetFragmentShaderConstantATI_capture;
+this->m_orig_glColorSubTable = this->m_ptr_glColorSubTable;
+if(this->m_ptr_glColorSubTable)this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&CaptureTableDecorator::m_glColorSubTable_capture;
+this->m_orig_glReplacementCodeuiSUN = this->m_ptr_glReplacementCodeuiSUN;
+if(this->m_ptr_glReplacementCodeuiSUN)this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiSUN_capture;
+this->m_orig_glStateCaptureNV = this->m_ptr_glStateCaptureNV;
+if(this->m_ptr_glStateCaptureNV)this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&CaptureTableDecorator::m_glStateCaptureNV_capture;
+this->m_orig_glBindAttribLocation = this->m_ptr_glBindAttribLocation;
+if(this->m_ptr_glBindAttribLocation)this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&CaptureTableDecorator::m_glBindAttribLocation_capture;
+this->m_orig_glWeightusvARB = this->m_ptr_glWeightusvARB;
+if(this->m_ptr_glWeightusvARB)this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&CaptureTableDecorator::m_glWeightusvARB_capture;
+this->m_orig_glGetFragDataIndex = this->m_ptr_glGetFragDataIndex;
+if(this->m_ptr_glGetFragDataIndex)this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&CaptureTableDecorator::m_glGetFragDataIndex_capture;
+this->m_orig_glMultiTexCoord2xOES = this->m_ptr_glMultiTexCoord2xOES;
+if(this->m_ptr_glMultiTexCoord2xOES)this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&CaptureTableDecorator::m_glMultiTexCoord2xOES_capture;
+this->m_orig_glColor3sv = this->m_ptr_glColor3sv;
+if(this->m_ptr_glColor3sv)this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&CaptureTableDecorator::m_glColor3sv_capture;
+this->m_orig_glTexCoord2fVertex3fSUN = this->m_ptr_glTexCoord2fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fVertex3fSUN)this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glTexCoord2fVertex3fSUN_capture;
+this->m_orig_glGetMemoryObjectParameterivEXT = this->m_ptr_glGetMemoryObjectParameterivEXT;
+if(this->m_ptr_glGetMemoryObjectParameterivEXT)this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetMemoryObjectParameterivEXT_capture;
+this->m_orig_glPolygonOffsetEXT = this->m_ptr_glPolygonOffsetEXT;
+if(this->m_ptr_glPolygonOffsetEXT)this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&CaptureTableDecorator::m_glPolygonOffsetEXT_capture;
+this->m_orig_glWeightPathsNV = this->m_ptr_glWeightPathsNV;
+if(this->m_ptr_glWeightPathsNV)this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&CaptureTableDecorator::m_glWeightPathsNV_capture;
+this->m_orig_glCombinerStageParameterfvNV = this->m_ptr_glCombinerStageParameterfvNV;
+if(this->m_ptr_glCombinerStageParameterfvNV)this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&CaptureTableDecorator::m_glCombinerStageParameterfvNV_capture;
+this->m_orig_glPointParameterfEXT = this->m_ptr_glPointParameterfEXT;
+if(this->m_ptr_glPointParameterfEXT)this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&CaptureTableDecorator::m_glPointParameterfEXT_capture;
+this->m_orig_glCopyTexImage1DEXT = this->m_ptr_glCopyTexImage1DEXT;
+if(this->m_ptr_glCopyTexImage1DEXT)this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyTexImage1DEXT_capture;
+this->m_orig_glVertex4sv = this->m_ptr_glVertex4sv;
+if(this->m_ptr_glVertex4sv)this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&CaptureTableDecorator::m_glVertex4sv_capture;
+this->m_orig_glMatrixMultfEXT = this->m_ptr_glMatrixMultfEXT;
+if(this->m_ptr_glMatrixMultfEXT)this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&CaptureTableDecorator::m_glMatrixMultfEXT_capture;
+this->m_orig_glCompressedTextureSubImage3DEXT = this->m_ptr_glCompressedTextureSubImage3DEXT;
+if(this->m_ptr_glCompressedTextureSubImage3DEXT)this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage3DEXT_capture;
+this->m_orig_glGetTexLevelParameterxvOES = this->m_ptr_glGetTexLevelParameterxvOES;
+if(this->m_ptr_glGetTexLevelParameterxvOES)this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&CaptureTableDecorator::m_glGetTexLevelParameterxvOES_capture;
+this->m_orig_glVertexAttribL3dvEXT = this->m_ptr_glVertexAttribL3dvEXT;
+if(this->m_ptr_glVertexAttribL3dvEXT)this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&CaptureTableDecorator::m_glVertexAttribL3dvEXT_capture;
+this->m_orig_glMultiTexCoordP4ui = this->m_ptr_glMultiTexCoordP4ui;
+if(this->m_ptr_glMultiTexCoordP4ui)this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&CaptureTableDecorator::m_glMultiTexCoordP4ui_capture;
+this->m_orig_glGetTextureLevelParameterivEXT = this->m_ptr_glGetTextureLevelParameterivEXT;
+if(this->m_ptr_glGetTextureLevelParameterivEXT)this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetTextureLevelParameterivEXT_capture;
+this->m_orig_glAlphaFragmentOp2ATI = this->m_ptr_glAlphaFragmentOp2ATI;
+if(this->m_ptr_glAlphaFragmentOp2ATI)this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&CaptureTableDecorator::m_glAlphaFragmentOp2ATI_capture;
+this->m_orig_glDeleteFramebuffers = this->m_ptr_glDeleteFramebuffers;
+if(this->m_ptr_glDeleteFramebuffers)this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&CaptureTableDecorator::m_glDeleteFramebuffers_capture;
+this->m_orig_glDrawArrays = this->m_ptr_glDrawArrays;
+if(this->m_ptr_glDrawArrays)this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&CaptureTableDecorator::m_glDrawArrays_capture;
+this->m_orig_glGetTransformFeedbackiv = this->m_ptr_glGetTransformFeedbackiv;
+if(this->m_ptr_glGetTransformFeedbackiv)this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&CaptureTableDecorator::m_glGetTransformFeedbackiv_capture;
+this->m_orig_glGetnTexImageARB = this->m_ptr_glGetnTexImageARB;
+if(this->m_ptr_glGetnTexImageARB)this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&CaptureTableDecorator::m_glGetnTexImageARB_capture;
+this->m_orig_glClear = this->m_ptr_glClear;
+if(this->m_ptr_glClear)this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&CaptureTableDecorator::m_glClear_capture;
+this->m_orig_glVertexArrayParameteriAPPLE = this->m_ptr_glVertexArrayParameteriAPPLE;
+if(this->m_ptr_glVertexArrayParameteriAPPLE)this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&CaptureTableDecorator::m_glVertexArrayParameteriAPPLE_capture;
+this->m_orig_glMultiTexCoord2dvARB = this->m_ptr_glMultiTexCoord2dvARB;
+if(this->m_ptr_glMultiTexCoord2dvARB)this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2dvARB_capture;
+this->m_orig_glGetVideoCaptureStreamdvNV = this->m_ptr_glGetVideoCaptureStreamdvNV;
+if(this->m_ptr_glGetVideoCaptureStreamdvNV)this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&CaptureTableDecorator::m_glGetVideoCaptureStreamdvNV_capture;
+this->m_orig_glFragmentLightModelivSGIX = this->m_ptr_glFragmentLightModelivSGIX;
+if(this->m_ptr_glFragmentLightModelivSGIX)this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&CaptureTableDecorator::m_glFragmentLightModelivSGIX_capture;
+this->m_orig_glVertexAttribP2ui = this->m_ptr_glVertexAttribP2ui;
+if(this->m_ptr_glVertexAttribP2ui)this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&CaptureTableDecorator::m_glVertexAttribP2ui_capture;
+this->m_orig_glMultiTexCoordPointerEXT = this->m_ptr_glMultiTexCoordPointerEXT;
+if(this->m_ptr_glMultiTexCoordPointerEXT)this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&CaptureTableDecorator::m_glMultiTexCoordPointerEXT_capture;
+this->m_orig_glProgramUniform3iEXT = this->m_ptr_glProgramUniform3iEXT;
+if(this->m_ptr_glProgramUniform3iEXT)this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&CaptureTableDecorator::m_glProgramUniform3iEXT_capture;
+this->m_orig_glTranslatef = this->m_ptr_glTranslatef;
+if(this->m_ptr_glTranslatef)this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&CaptureTableDecorator::m_glTranslatef_capture;
+this->m_orig_glVertexAttrib4Nub = this->m_ptr_glVertexAttrib4Nub;
+if(this->m_ptr_glVertexAttrib4Nub)this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&CaptureTableDecorator::m_glVertexAttrib4Nub_capture;
+this->m_orig_glTranslated = this->m_ptr_glTranslated;
+if(this->m_ptr_glTranslated)this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&CaptureTableDecorator::m_glTranslated_capture;
+this->m_orig_glSamplerParameterIiv = this->m_ptr_glSamplerParameterIiv;
+if(this->m_ptr_glSamplerParameterIiv)this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&CaptureTableDecorator::m_glSamplerParameterIiv_capture;
+this->m_orig_glTexCoord4hNV = this->m_ptr_glTexCoord4hNV;
+if(this->m_ptr_glTexCoord4hNV)this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&CaptureTableDecorator::m_glTexCoord4hNV_capture;
+this->m_orig_glDrawElementsIndirect = this->m_ptr_glDrawElementsIndirect;
+if(this->m_ptr_glDrawElementsIndirect)this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&CaptureTableDecorator::m_glDrawElementsIndirect_capture;
+this->m_orig_glDeletePerfMonitorsAMD = this->m_ptr_glDeletePerfMonitorsAMD;
+if(this->m_ptr_glDeletePerfMonitorsAMD)this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&CaptureTableDecorator::m_glDeletePerfMonitorsAMD_capture;
+this->m_orig_glIsRenderbufferEXT = this->m_ptr_glIsRenderbufferEXT;
+if(this->m_ptr_glIsRenderbufferEXT)this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glIsRenderbufferEXT_capture;
+this->m_orig_glDrawCommandsNV = this->m_ptr_glDrawCommandsNV;
+if(this->m_ptr_glDrawCommandsNV)this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&CaptureTableDecorator::m_glDrawCommandsNV_capture;
+this->m_orig_glUniform3ivARB = this->m_ptr_glUniform3ivARB;
+if(this->m_ptr_glUniform3ivARB)this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&CaptureTableDecorator::m_glUniform3ivARB_capture;
+this->m_orig_glBufferSubData = this->m_ptr_glBufferSubData;
+if(this->m_ptr_glBufferSubData)this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glBufferSubData_capture;
+this->m_orig_glSecondaryColor3bv = this->m_ptr_glSecondaryColor3bv;
+if(this->m_ptr_glSecondaryColor3bv)this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&CaptureTableDecorator::m_glSecondaryColor3bv_capture;
+this->m_orig_glMatrixMultTransposedEXT = this->m_ptr_glMatrixMultTransposedEXT;
+if(this->m_ptr_glMatrixMultTransposedEXT)this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&CaptureTableDecorator::m_glMatrixMultTransposedEXT_capture;
+this->m_orig_glRequestResidentProgramsNV = this->m_ptr_glRequestResidentProgramsNV;
+if(this->m_ptr_glRequestResidentProgramsNV)this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&CaptureTableDecorator::m_glRequestResidentProgramsNV_capture;
+this->m_orig_glAlphaFragmentOp1ATI = this->m_ptr_glAlphaFragmentOp1ATI;
+if(this->m_ptr_glAlphaFragmentOp1ATI)this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&CaptureTableDecorator::m_glAlphaFragmentOp1ATI_capture;
+this->m_orig_glGetQueryObjecti64v = this->m_ptr_glGetQueryObjecti64v;
+if(this->m_ptr_glGetQueryObjecti64v)this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&CaptureTableDecorator::m_glGetQueryObjecti64v_capture;
+this->m_orig_glMatrixMult3x3fNV = this->m_ptr_glMatrixMult3x3fNV;
+if(this->m_ptr_glMatrixMult3x3fNV)this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&CaptureTableDecorator::m_glMatrixMult3x3fNV_capture;
+this->m_orig_glColorTableParameteriv = this->m_ptr_glColorTableParameteriv;
+if(this->m_ptr_glColorTableParameteriv)this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&CaptureTableDecorator::m_glColorTableParameteriv_capture;
+this->m_orig_glPathSubCommandsNV = this->m_ptr_glPathSubCommandsNV;
+if(this->m_ptr_glPathSubCommandsNV)this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&CaptureTableDecorator::m_glPathSubCommandsNV_capture;
+this->m_orig_glGetFinalCombinerInputParameterivNV = this->m_ptr_glGetFinalCombinerInputParameterivNV;
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV)this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetFinalCombinerInputParameterivNV_capture;
+this->m_orig_glIsRenderbuffer = this->m_ptr_glIsRenderbuffer;
+if(this->m_ptr_glIsRenderbuffer)this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&CaptureTableDecorator::m_glIsRenderbuffer_capture;
+this->m_orig_glVertex3iv = this->m_ptr_glVertex3iv;
+if(this->m_ptr_glVertex3iv)this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&CaptureTableDecorator::m_glVertex3iv_capture;
+this->m_orig_glTexGenfv = this->m_ptr_glTexGenfv;
+if(this->m_ptr_glTexGenfv)this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&CaptureTableDecorator::m_glTexGenfv_capture;
+this->m_orig_glFrustumfOES = this->m_ptr_glFrustumfOES;
+if(this->m_ptr_glFrustumfOES)this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&CaptureTableDecorator::m_glFrustumfOES_capture;
+this->m_orig_glBindVertexBuffers = this->m_ptr_glBindVertexBuffers;
+if(this->m_ptr_glBindVertexBuffers)this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&CaptureTableDecorator::m_glBindVertexBuffers_capture;
+this->m_orig_glMateriali = this->m_ptr_glMateriali;
+if(this->m_ptr_glMateriali)this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&CaptureTableDecorator::m_glMateriali_capture;
+this->m_orig_glMultiTexCoord2svARB = this->m_ptr_glMultiTexCoord2svARB;
+if(this->m_ptr_glMultiTexCoord2svARB)this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2svARB_capture;
+this->m_orig_glDisableVertexAttribArray = this->m_ptr_glDisableVertexAttribArray;
+if(this->m_ptr_glDisableVertexAttribArray)this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&CaptureTableDecorator::m_glDisableVertexAttribArray_capture;
+this->m_orig_glWindowPos3ivARB = this->m_ptr_glWindowPos3ivARB;
+if(this->m_ptr_glWindowPos3ivARB)this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&CaptureTableDecorator::m_glWindowPos3ivARB_capture;
+this->m_orig_glTexCoordFormatNV = this->m_ptr_glTexCoordFormatNV;
+if(this->m_ptr_glTexCoordFormatNV)this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&CaptureTableDecorator::m_glTexCoordFormatNV_capture;
+this->m_orig_glBlitNamedFramebuffer = this->m_ptr_glBlitNamedFramebuffer;
+if(this->m_ptr_glBlitNamedFramebuffer)this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&CaptureTableDecorator::m_glBlitNamedFramebuffer_capture;
+this->m_orig_glMatrixLoadTransposefEXT = this->m_ptr_glMatrixLoadTransposefEXT;
+if(this->m_ptr_glMatrixLoadTransposefEXT)this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&CaptureTableDecorator::m_glMatrixLoadTransposefEXT_capture;
+this->m_orig_glMultiTexGenfEXT = this->m_ptr_glMultiTexGenfEXT;
+if(this->m_ptr_glMultiTexGenfEXT)this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&CaptureTableDecorator::m_glMultiTexGenfEXT_capture;
+this->m_orig_glShaderStorageBlockBinding = this->m_ptr_glShaderStorageBlockBinding;
+if(this->m_ptr_glShaderStorageBlockBinding)this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&CaptureTableDecorator::m_glShaderStorageBlockBinding_capture;
+this->m_orig_glMaterialf = this->m_ptr_glMaterialf;
+if(this->m_ptr_glMaterialf)this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&CaptureTableDecorator::m_glMaterialf_capture;
+this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_capture;
+this->m_orig_glCheckNamedFramebufferStatusEXT = this->m_ptr_glCheckNamedFramebufferStatusEXT;
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT)this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&CaptureTableDecorator::m_glCheckNamedFramebufferStatusEXT_capture;
+this->m_orig_glVertexArrayVertexAttribFormatEXT = this->m_ptr_glVertexArrayVertexAttribFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT)this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribFormatEXT_capture;
+this->m_orig_glVertex2hNV = this->m_ptr_glVertex2hNV;
+if(this->m_ptr_glVertex2hNV)this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&CaptureTableDecorator::m_glVertex2hNV_capture;
+this->m_orig_glDeleteVertexShaderEXT = this->m_ptr_glDeleteVertexShaderEXT;
+if(this->m_ptr_glDeleteVertexShaderEXT)this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&CaptureTableDecorator::m_glDeleteVertexShaderEXT_capture;
+this->m_orig_glTexImage3DEXT = this->m_ptr_glTexImage3DEXT;
+if(this->m_ptr_glTexImage3DEXT)this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&CaptureTableDecorator::m_glTexImage3DEXT_capture;
+this->m_orig_glSignalVkFenceNV = this->m_ptr_glSignalVkFenceNV;
+if(this->m_ptr_glSignalVkFenceNV)this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&CaptureTableDecorator::m_glSignalVkFenceNV_capture;
+this->m_orig_glProgramLocalParameterI4ivNV = this->m_ptr_glProgramLocalParameterI4ivNV;
+if(this->m_ptr_glProgramLocalParameterI4ivNV)this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&CaptureTableDecorator::m_glProgramLocalParameterI4ivNV_capture;
+this->m_orig_glGlobalAlphaFactoriSUN = this->m_ptr_glGlobalAlphaFactoriSUN;
+if(this->m_ptr_glGlobalAlphaFactoriSUN)this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactoriSUN_capture;
+this->m_orig_glTextureStorage1D = this->m_ptr_glTextureStorage1D;
+if(this->m_ptr_glTextureStorage1D)this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&CaptureTableDecorator::m_glTextureStorage1D_capture;
+this->m_orig_glBinormal3sEXT = this->m_ptr_glBinormal3sEXT;
+if(this->m_ptr_glBinormal3sEXT)this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&CaptureTableDecorator::m_glBinormal3sEXT_capture;
+this->m_orig_glGetProgramInterfaceiv = this->m_ptr_glGetProgramInterfaceiv;
+if(this->m_ptr_glGetProgramInterfaceiv)this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&CaptureTableDecorator::m_glGetProgramInterfaceiv_capture;
+this->m_orig_glMatrixIndexPointerARB = this->m_ptr_glMatrixIndexPointerARB;
+if(this->m_ptr_glMatrixIndexPointerARB)this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&CaptureTableDecorator::m_glMatrixIndexPointerARB_capture;
+this->m_orig_glTexCoordPointerEXT = this->m_ptr_glTexCoordPointerEXT;
+if(this->m_ptr_glTexCoordPointerEXT)this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&CaptureTableDecorator::m_glTexCoordPointerEXT_capture;
+this->m_orig_glMultiTexGeniEXT = this->m_ptr_glMultiTexGeniEXT;
+if(this->m_ptr_glMultiTexGeniEXT)this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&CaptureTableDecorator::m_glMultiTexGeniEXT_capture;
+this->m_orig_glVertexAttrib2fNV = this->m_ptr_glVertexAttrib2fNV;
+if(this->m_ptr_glVertexAttrib2fNV)this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&CaptureTableDecorator::m_glVertexAttrib2fNV_capture;
+this->m_orig_glNamedProgramStringEXT = this->m_ptr_glNamedProgramStringEXT;
+if(this->m_ptr_glNamedProgramStringEXT)this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&CaptureTableDecorator::m_glNamedProgramStringEXT_capture;
+this->m_orig_glMapNamedBuffer = this->m_ptr_glMapNamedBuffer;
+if(this->m_ptr_glMapNamedBuffer)this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&CaptureTableDecorator::m_glMapNamedBuffer_capture;
+this->m_orig_glGetMinmaxParameteriv = this->m_ptr_glGetMinmaxParameteriv;
+if(this->m_ptr_glGetMinmaxParameteriv)this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&CaptureTableDecorator::m_glGetMinmaxParameteriv_capture;
+this->m_orig_glGetnUniformdv = this->m_ptr_glGetnUniformdv;
+if(this->m_ptr_glGetnUniformdv)this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&CaptureTableDecorator::m_glGetnUniformdv_capture;
+this->m_orig_glEndConditionalRenderNVX = this->m_ptr_glEndConditionalRenderNVX;
+if(this->m_ptr_glEndConditionalRenderNVX)this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&CaptureTableDecorator::m_glEndConditionalRenderNVX_capture;
+this->m_orig_glBinormal3fEXT = this->m_ptr_glBinormal3fEXT;
+if(this->m_ptr_glBinormal3fEXT)this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&CaptureTableDecorator::m_glBinormal3fEXT_capture;
+this->m_orig_glNormalStream3iATI = this->m_ptr_glNormalStream3iATI;
+if(this->m_ptr_glNormalStream3iATI)this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&CaptureTableDecorator::m_glNormalStream3iATI_capture;
+this->m_orig_glProgramBufferParametersIivNV = this->m_ptr_glProgramBufferParametersIivNV;
+if(this->m_ptr_glProgramBufferParametersIivNV)this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&CaptureTableDecorator::m_glProgramBufferParametersIivNV_capture;
+this->m_orig_glMapGrid1xOES = this->m_ptr_glMapGrid1xOES;
+if(this->m_ptr_glMapGrid1xOES)this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&CaptureTableDecorator::m_glMapGrid1xOES_capture;
+this->m_orig_glGetVertexAttribPointervARB = this->m_ptr_glGetVertexAttribPointervARB;
+if(this->m_ptr_glGetVertexAttribPointervARB)this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&CaptureTableDecorator::m_glGetVertexAttribPointervARB_capture;
+this->m_orig_glFlushMappedNamedBufferRangeEXT = this->m_ptr_glFlushMappedNamedBufferRangeEXT;
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT)this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&CaptureTableDecorator::m_glFlushMappedNamedBufferRangeEXT_capture;
+this->m_orig_glGetVertexAttribIiv = this->m_ptr_glGetVertexAttribIiv;
+if(this->m_ptr_glGetVertexAttribIiv)this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&CaptureTableDecorator::m_glGetVertexAttribIiv_capture;
+this->m_orig_glVertexP4uiv = this->m_ptr_glVertexP4uiv;
+if(this->m_ptr_glVertexP4uiv)this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&CaptureTableDecorator::m_glVertexP4uiv_capture;
+this->m_orig_glUniformui64NV = this->m_ptr_glUniformui64NV;
+if(this->m_ptr_glUniformui64NV)this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&CaptureTableDecorator::m_glUniformui64NV_capture;
+this->m_orig_glColor4fv = this->m_ptr_glColor4fv;
+if(this->m_ptr_glColor4fv)this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&CaptureTableDecorator::m_glColor4fv_capture;
+this->m_orig_glTexParameterxvOES = this->m_ptr_glTexParameterxvOES;
+if(this->m_ptr_glTexParameterxvOES)this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&CaptureTableDecorator::m_glTexParameterxvOES_capture;
+this->m_orig_glPatchParameteri = this->m_ptr_glPatchParameteri;
+if(this->m_ptr_glPatchParameteri)this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&CaptureTableDecorator::m_glPatchParameteri_capture;
+this->m_orig_glMap1d = this->m_ptr_glMap1d;
+if(this->m_ptr_glMap1d)this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&CaptureTableDecorator::m_glMap1d_capture;
+this->m_orig_glGetTexFilterFuncSGIS = this->m_ptr_glGetTexFilterFuncSGIS;
+if(this->m_ptr_glGetTexFilterFuncSGIS)this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&CaptureTableDecorator::m_glGetTexFilterFuncSGIS_capture;
+this->m_orig_glVertexStream3dATI = this->m_ptr_glVertexStream3dATI;
+if(this->m_ptr_glVertexStream3dATI)this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&CaptureTableDecorator::m_glVertexStream3dATI_capture;
+this->m_orig_glVertexArrayVertexBindingDivisorEXT = this->m_ptr_glVertexArrayVertexBindingDivisorEXT;
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT)this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_capture;
+this->m_orig_glMultiTexCoord3svARB = this->m_ptr_glMultiTexCoord3svARB;
+if(this->m_ptr_glMultiTexCoord3svARB)this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3svARB_capture;
+this->m_orig_glBindProgramNV = this->m_ptr_glBindProgramNV;
+if(this->m_ptr_glBindProgramNV)this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&CaptureTableDecorator::m_glBindProgramNV_capture;
+this->m_orig_glGetConvolutionParameteriv = this->m_ptr_glGetConvolutionParameteriv;
+if(this->m_ptr_glGetConvolutionParameteriv)this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&CaptureTableDecorator::m_glGetConvolutionParameteriv_capture;
+this->m_orig_glGetProgramLocalParameterfvARB = this->m_ptr_glGetProgramLocalParameterfvARB;
+if(this->m_ptr_glGetProgramLocalParameterfvARB)this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&CaptureTableDecorator::m_glGetProgramLocalParameterfvARB_capture;
+this->m_orig_glGenFragmentShadersATI = this->m_ptr_glGenFragmentShadersATI;
+if(this->m_ptr_glGenFragmentShadersATI)this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&CaptureTableDecorator::m_glGenFragmentShadersATI_capture;
+this->m_orig_glTexBumpParameterivATI = this->m_ptr_glTexBumpParameterivATI;
+if(this->m_ptr_glTexBumpParameterivATI)this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&CaptureTableDecorator::m_glTexBumpParameterivATI_capture;
+this->m_orig_glGetNamedFramebufferAttachmentParameteriv = this->m_ptr_glGetNamedFramebufferAttachmentParameteriv;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv)this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&CaptureTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_capture;
+this->m_orig_glGetnSeparableFilter = this->m_ptr_glGetnSeparableFilter;
+if(this->m_ptr_glGetnSeparableFilter)this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&CaptureTableDecorator::m_glGetnSeparableFilter_capture;
+this->m_orig_glNormal3xvOES = this->m_ptr_glNormal3xvOES;
+if(this->m_ptr_glNormal3xvOES)this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&CaptureTableDecorator::m_glNormal3xvOES_capture;
+this->m_orig_glPassTexCoordATI = this->m_ptr_glPassTexCoordATI;
+if(this->m_ptr_glPassTexCoordATI)this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&CaptureTableDecorator::m_glPassTexCoordATI_capture;
+this->m_orig_glFramebufferTextureFaceARB = this->m_ptr_glFramebufferTextureFaceARB;
+if(this->m_ptr_glFramebufferTextureFaceARB)this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&CaptureTableDecorator::m_glFramebufferTextureFaceARB_capture;
+this->m_orig_glProgramUniform1dv = this->m_ptr_glProgramUniform1dv;
+if(this->m_ptr_glProgramUniform1dv)this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&CaptureTableDecorator::m_glProgramUniform1dv_capture;
+this->m_orig_glTextureStorage2DEXT = this->m_ptr_glTextureStorage2DEXT;
+if(this->m_ptr_glTextureStorage2DEXT)this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&CaptureTableDecorator::m_glTextureStorage2DEXT_capture;
+this->m_orig_glVertexArrayFogCoordOffsetEXT = this->m_ptr_glVertexArrayFogCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT)this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayFogCoordOffsetEXT_capture;
+this->m_orig_glDeleteNamedStringARB = this->m_ptr_glDeleteNamedStringARB;
+if(this->m_ptr_glDeleteNamedStringARB)this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&CaptureTableDecorator::m_glDeleteNamedStringARB_capture;
+this->m_orig_glMulticastGetQueryObjecti64vNV = this->m_ptr_glMulticastGetQueryObjecti64vNV;
+if(this->m_ptr_glMulticastGetQueryObjecti64vNV)this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&CaptureTableDecorator::m_glMulticastGetQueryObjecti64vNV_capture;
+this->m_orig_glGenOcclusionQueriesNV = this->m_ptr_glGenOcclusionQueriesNV;
+if(this->m_ptr_glGenOcclusionQueriesNV)this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&CaptureTableDecorator::m_glGenOcclusionQueriesNV_capture;
+this->m_orig_glLighti = this->m_ptr_glLighti;
+if(this->m_ptr_glLighti)this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&CaptureTableDecorator::m_glLighti_capture;
+this->m_orig_glTexImage1D = this->m_ptr_glTexImage1D;
+if(this->m_ptr_glTexImage1D)this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&CaptureTableDecorator::m_glTexImage1D_capture;
+this->m_orig_glLightf = this->m_ptr_glLightf;
+if(this->m_ptr_glLightf)this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&CaptureTableDecorator::m_glLightf_capture;
+this->m_orig_glClientAttribDefaultEXT = this->m_ptr_glClientAttribDefaultEXT;
+if(this->m_ptr_glClientAttribDefaultEXT)this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&CaptureTableDecorator::m_glClientAttribDefaultEXT_capture;
+this->m_orig_glVertexAttrib4bvARB = this->m_ptr_glVertexAttrib4bvARB;
+if(this->m_ptr_glVertexAttrib4bvARB)this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4bvARB_capture;
+this->m_orig_glVertexAttribIFormatNV = this->m_ptr_glVertexAttribIFormatNV;
+if(this->m_ptr_glVertexAttribIFormatNV)this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&CaptureTableDecorator::m_glVertexAttribIFormatNV_capture;
+this->m_orig_glStencilFuncSeparate = this->m_ptr_glStencilFuncSeparate;
+if(this->m_ptr_glStencilFuncSeparate)this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&CaptureTableDecorator::m_glStencilFuncSeparate_capture;
+this->m_orig_glGetVertexAttribfvARB = this->m_ptr_glGetVertexAttribfvARB;
+if(this->m_ptr_glGetVertexAttribfvARB)this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&CaptureTableDecorator::m_glGetVertexAttribfvARB_capture;
+this->m_orig_glVertexAttrib2dNV = this->m_ptr_glVertexAttrib2dNV;
+if(this->m_ptr_glVertexAttrib2dNV)this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&CaptureTableDecorator::m_glVertexAttrib2dNV_capture;
+this->m_orig_glProgramUniform2iEXT = this->m_ptr_glProgramUniform2iEXT;
+if(this->m_ptr_glProgramUniform2iEXT)this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&CaptureTableDecorator::m_glProgramUniform2iEXT_capture;
+this->m_orig_glClientActiveVertexStreamATI = this->m_ptr_glClientActiveVertexStreamATI;
+if(this->m_ptr_glClientActiveVertexStreamATI)this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&CaptureTableDecorator::m_glClientActiveVertexStreamATI_capture;
+this->m_orig_glRasterPos3xOES = this->m_ptr_glRasterPos3xOES;
+if(this->m_ptr_glRasterPos3xOES)this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&CaptureTableDecorator::m_glRasterPos3xOES_capture;
+this->m_orig_glGetMapParameterivNV = this->m_ptr_glGetMapParameterivNV;
+if(this->m_ptr_glGetMapParameterivNV)this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetMapParameterivNV_capture;
+this->m_orig_glSampleCoverage = this->m_ptr_glSampleCoverage;
+if(this->m_ptr_glSampleCoverage)this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&CaptureTableDecorator::m_glSampleCoverage_capture;
+this->m_orig_glClearDepthxOES = this->m_ptr_glClearDepthxOES;
+if(this->m_ptr_glClearDepthxOES)this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&CaptureTableDecorator::m_glClearDepthxOES_capture;
+this->m_orig_glUniformBufferEXT = this->m_ptr_glUniformBufferEXT;
+if(this->m_ptr_glUniformBufferEXT)this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&CaptureTableDecorator::m_glUniformBufferEXT_capture;
+this->m_orig_glTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_capture;
+this->m_orig_glMulticastGetQueryObjectuivNV = this->m_ptr_glMulticastGetQueryObjectuivNV;
+if(this->m_ptr_glMulticastGetQueryObjectuivNV)this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&CaptureTableDecorator::m_glMulticastGetQueryObjectuivNV_capture;
+this->m_orig_glGetFirstPerfQueryIdINTEL = this->m_ptr_glGetFirstPerfQueryIdINTEL;
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL)this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&CaptureTableDecorator::m_glGetFirstPerfQueryIdINTEL_capture;
+this->m_orig_glUnmapNamedBufferEXT = this->m_ptr_glUnmapNamedBufferEXT;
+if(this->m_ptr_glUnmapNamedBufferEXT)this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&CaptureTableDecorator::m_glUnmapNamedBufferEXT_capture;
+this->m_orig_glGetTransformFeedbacki_v = this->m_ptr_glGetTransformFeedbacki_v;
+if(this->m_ptr_glGetTransformFeedbacki_v)this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&CaptureTableDecorator::m_glGetTransformFeedbacki_v_capture;
+this->m_orig_glUniform4fvARB = this->m_ptr_glUniform4fvARB;
+if(this->m_ptr_glUniform4fvARB)this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&CaptureTableDecorator::m_glUniform4fvARB_capture;
+this->m_orig_glRenderbufferStorageMultisampleCoverageNV = this->m_ptr_glRenderbufferStorageMultisampleCoverageNV;
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV)this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&CaptureTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_capture;
+this->m_orig_glGetFloati_vEXT = this->m_ptr_glGetFloati_vEXT;
+if(this->m_ptr_glGetFloati_vEXT)this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&CaptureTableDecorator::m_glGetFloati_vEXT_capture;
+this->m_orig_glBindAttribLocationARB = this->m_ptr_glBindAttribLocationARB;
+if(this->m_ptr_glBindAttribLocationARB)this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&CaptureTableDecorator::m_glBindAttribLocationARB_capture;
+this->m_orig_glBufferAddressRangeNV = this->m_ptr_glBufferAddressRangeNV;
+if(this->m_ptr_glBufferAddressRangeNV)this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&CaptureTableDecorator::m_glBufferAddressRangeNV_capture;
+this->m_orig_glGenProgramsARB = this->m_ptr_glGenProgramsARB;
+if(this->m_ptr_glGenProgramsARB)this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&CaptureTableDecorator::m_glGenProgramsARB_capture;
+this->m_orig_glMultiTexEnvivEXT = this->m_ptr_glMultiTexEnvivEXT;
+if(this->m_ptr_glMultiTexEnvivEXT)this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&CaptureTableDecorator::m_glMultiTexEnvivEXT_capture;
+this->m_orig_glSecondaryColor3uiEXT = this->m_ptr_glSecondaryColor3uiEXT;
+if(this->m_ptr_glSecondaryColor3uiEXT)this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3uiEXT_capture;
+this->m_orig_glCompressedTextureImage2DEXT = this->m_ptr_glCompressedTextureImage2DEXT;
+if(this->m_ptr_glCompressedTextureImage2DEXT)this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureImage2DEXT_capture;
+this->m_orig_glUniform2i = this->m_ptr_glUniform2i;
+if(this->m_ptr_glUniform2i)this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&CaptureTableDecorator::m_glUniform2i_capture;
+this->m_orig_glCopyTexImage2DEXT = this->m_ptr_glCopyTexImage2DEXT;
+if(this->m_ptr_glCopyTexImage2DEXT)this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyTexImage2DEXT_capture;
+this->m_orig_glUniform2d = this->m_ptr_glUniform2d;
+if(this->m_ptr_glUniform2d)this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&CaptureTableDecorator::m_glUniform2d_capture;
+this->m_orig_glVertexAttribL1d = this->m_ptr_glVertexAttribL1d;
+if(this->m_ptr_glVertexAttribL1d)this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&CaptureTableDecorator::m_glVertexAttribL1d_capture;
+this->m_orig_glFramebufferTextureFaceEXT = this->m_ptr_glFramebufferTextureFaceEXT;
+if(this->m_ptr_glFramebufferTextureFaceEXT)this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&CaptureTableDecorator::m_glFramebufferTextureFaceEXT_capture;
+this->m_orig_glFramebufferTextureLayer = this->m_ptr_glFramebufferTextureLayer;
+if(this->m_ptr_glFramebufferTextureLayer)this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&CaptureTableDecorator::m_glFramebufferTextureLayer_capture;
+this->m_orig_glMultiTexCoord4bvOES = this->m_ptr_glMultiTexCoord4bvOES;
+if(this->m_ptr_glMultiTexCoord4bvOES)this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord4bvOES_capture;
+this->m_orig_glGetVertexArrayPointeri_vEXT = this->m_ptr_glGetVertexArrayPointeri_vEXT;
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT)this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&CaptureTableDecorator::m_glGetVertexArrayPointeri_vEXT_capture;
+this->m_orig_glNamedProgramLocalParameter4dEXT = this->m_ptr_glNamedProgramLocalParameter4dEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT)this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameter4dEXT_capture;
+this->m_orig_glBinormal3bEXT = this->m_ptr_glBinormal3bEXT;
+if(this->m_ptr_glBinormal3bEXT)this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&CaptureTableDecorator::m_glBinormal3bEXT_capture;
+this->m_orig_glConvolutionFilter2DEXT = this->m_ptr_glConvolutionFilter2DEXT;
+if(this->m_ptr_glConvolutionFilter2DEXT)this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&CaptureTableDecorator::m_glConvolutionFilter2DEXT_capture;
+this->m_orig_glProgramUniform2fv = this->m_ptr_glProgramUniform2fv;
+if(this->m_ptr_glProgramUniform2fv)this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&CaptureTableDecorator::m_glProgramUniform2fv_capture;
+this->m_orig_glColor3fVertex3fSUN = this->m_ptr_glColor3fVertex3fSUN;
+if(this->m_ptr_glColor3fVertex3fSUN)this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glColor3fVertex3fSUN_capture;
+this->m_orig_glNormal3fVertex3fvSUN = this->m_ptr_glNormal3fVertex3fvSUN;
+if(this->m_ptr_glNormal3fVertex3fvSUN)this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glNormal3fVertex3fvSUN_capture;
+this->m_orig_glCopyMultiTexSubImage3DEXT = this->m_ptr_glCopyMultiTexSubImage3DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT)this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCopyMultiTexSubImage3DEXT_capture;
+this->m_orig_glProgramLocalParameterI4iNV = this->m_ptr_glProgramLocalParameterI4iNV;
+if(this->m_ptr_glProgramLocalParameterI4iNV)this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&CaptureTableDecorator::m_glProgramLocalParameterI4iNV_capture;
+this->m_orig_glProgramUniformMatrix2x4dv = this->m_ptr_glProgramUniformMatrix2x4dv;
+if(this->m_ptr_glProgramUniformMatrix2x4dv)this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x4dv_capture;
+this->m_orig_glPathMemoryGlyphIndexArrayNV = this->m_ptr_glPathMemoryGlyphIndexArrayNV;
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV)this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&CaptureTableDecorator::m_glPathMemoryGlyphIndexArrayNV_capture;
+this->m_orig_glDrawArraysEXT = this->m_ptr_glDrawArraysEXT;
+if(this->m_ptr_glDrawArraysEXT)this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&CaptureTableDecorator::m_glDrawArraysEXT_capture;
+this->m_orig_glBlendEquationEXT = this->m_ptr_glBlendEquationEXT;
+if(this->m_ptr_glBlendEquationEXT)this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&CaptureTableDecorator::m_glBlendEquationEXT_capture;
+this->m_orig_glStencilOp = this->m_ptr_glStencilOp;
+if(this->m_ptr_glStencilOp)this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&CaptureTableDecorator::m_glStencilOp_capture;
+this->m_orig_glCopyTextureSubImage2DEXT = this->m_ptr_glCopyTextureSubImage2DEXT;
+if(this->m_ptr_glCopyTextureSubImage2DEXT)this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyTextureSubImage2DEXT_capture;
+this->m_orig_glTexEnvf = this->m_ptr_glTexEnvf;
+if(this->m_ptr_glTexEnvf)this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&CaptureTableDecorator::m_glTexEnvf_capture;
+this->m_orig_glVertexAttrib2dvNV = this->m_ptr_glVertexAttrib2dvNV;
+if(this->m_ptr_glVertexAttrib2dvNV)this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&CaptureTableDecorator::m_glVertexAttrib2dvNV_capture;
+this->m_orig_glGenPerfMonitorsAMD = this->m_ptr_glGenPerfMonitorsAMD;
+if(this->m_ptr_glGenPerfMonitorsAMD)this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&CaptureTableDecorator::m_glGenPerfMonitorsAMD_capture;
+this->m_orig_glGetInteger64i_v = this->m_ptr_glGetInteger64i_v;
+if(this->m_ptr_glGetInteger64i_v)this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&CaptureTableDecorator::m_glGetInteger64i_v_capture;
+this->m_orig_glGetHistogramParameterfv = this->m_ptr_glGetHistogramParameterfv;
+if(this->m_ptr_glGetHistogramParameterfv)this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&CaptureTableDecorator::m_glGetHistogramParameterfv_capture;
+this->m_orig_glVertexFormatNV = this->m_ptr_glVertexFormatNV;
+if(this->m_ptr_glVertexFormatNV)this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&CaptureTableDecorator::m_glVertexFormatNV_capture;
+this->m_orig_glBlendFuncIndexedAMD = this->m_ptr_glBlendFuncIndexedAMD;
+if(this->m_ptr_glBlendFuncIndexedAMD)this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&CaptureTableDecorator::m_glBlendFuncIndexedAMD_capture;
+this->m_orig_glTexEnvi = this->m_ptr_glTexEnvi;
+if(this->m_ptr_glTexEnvi)this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&CaptureTableDecorator::m_glTexEnvi_capture;
+this->m_orig_glMultiTexCoord1iv = this->m_ptr_glMultiTexCoord1iv;
+if(this->m_ptr_glMultiTexCoord1iv)this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&CaptureTableDecorator::m_glMultiTexCoord1iv_capture;
+this->m_orig_glIsEnabledi = this->m_ptr_glIsEnabledi;
+if(this->m_ptr_glIsEnabledi)this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&CaptureTableDecorator::m_glIsEnabledi_capture;
+this->m_orig_glVertexAttribL2ui64vNV = this->m_ptr_glVertexAttribL2ui64vNV;
+if(this->m_ptr_glVertexAttribL2ui64vNV)this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL2ui64vNV_capture;
+this->m_orig_glVertexAttribL4i64NV = this->m_ptr_glVertexAttribL4i64NV;
+if(this->m_ptr_glVertexAttribL4i64NV)this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&CaptureTableDecorator::m_glVertexAttribL4i64NV_capture;
+this->m_orig_glMatrixTranslatedEXT = this->m_ptr_glMatrixTranslatedEXT;
+if(this->m_ptr_glMatrixTranslatedEXT)this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&CaptureTableDecorator::m_glMatrixTranslatedEXT_capture;
+this->m_orig_glMakeTextureHandleResidentARB = this->m_ptr_glMakeTextureHandleResidentARB;
+if(this->m_ptr_glMakeTextureHandleResidentARB)this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&CaptureTableDecorator::m_glMakeTextureHandleResidentARB_capture;
+this->m_orig_glMatrixMultdEXT = this->m_ptr_glMatrixMultdEXT;
+if(this->m_ptr_glMatrixMultdEXT)this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&CaptureTableDecorator::m_glMatrixMultdEXT_capture;
+this->m_orig_glBinormal3dvEXT = this->m_ptr_glBinormal3dvEXT;
+if(this->m_ptr_glBinormal3dvEXT)this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&CaptureTableDecorator::m_glBinormal3dvEXT_capture;
+this->m_orig_glImportSyncEXT = this->m_ptr_glImportSyncEXT;
+if(this->m_ptr_glImportSyncEXT)this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&CaptureTableDecorator::m_glImportSyncEXT_capture;
+this->m_orig_glGetMapiv = this->m_ptr_glGetMapiv;
+if(this->m_ptr_glGetMapiv)this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&CaptureTableDecorator::m_glGetMapiv_capture;
+this->m_orig_glImportSemaphoreFdEXT = this->m_ptr_glImportSemaphoreFdEXT;
+if(this->m_ptr_glImportSemaphoreFdEXT)this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&CaptureTableDecorator::m_glImportSemaphoreFdEXT_capture;
+this->m_orig_glMultiTexCoord4sv = this->m_ptr_glMultiTexCoord4sv;
+if(this->m_ptr_glMultiTexCoord4sv)this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&CaptureTableDecorator::m_glMultiTexCoord4sv_capture;
+this->m_orig_glPNTrianglesiATI = this->m_ptr_glPNTrianglesiATI;
+if(this->m_ptr_glPNTrianglesiATI)this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&CaptureTableDecorator::m_glPNTrianglesiATI_capture;
+this->m_orig_glBindVertexArrayAPPLE = this->m_ptr_glBindVertexArrayAPPLE;
+if(this->m_ptr_glBindVertexArrayAPPLE)this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&CaptureTableDecorator::m_glBindVertexArrayAPPLE_capture;
+this->m_orig_glObjectPtrLabel = this->m_ptr_glObjectPtrLabel;
+if(this->m_ptr_glObjectPtrLabel)this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&CaptureTableDecorator::m_glObjectPtrLabel_capture;
+this->m_orig_glGetDebugMessageLog = this->m_ptr_glGetDebugMessageLog;
+if(this->m_ptr_glGetDebugMessageLog)this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&CaptureTableDecorator::m_glGetDebugMessageLog_capture;
+this->m_orig_glTrackMatrixNV = this->m_ptr_glTrackMatrixNV;
+if(this->m_ptr_glTrackMatrixNV)this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&CaptureTableDecorator::m_glTrackMatrixNV_capture;
+this->m_orig_glProgramPathFragmentInputGenNV = this->m_ptr_glProgramPathFragmentInputGenNV;
+if(this->m_ptr_glProgramPathFragmentInputGenNV)this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&CaptureTableDecorator::m_glProgramPathFragmentInputGenNV_capture;
+this->m_orig_glTangent3ivEXT = this->m_ptr_glTangent3ivEXT;
+if(this->m_ptr_glTangent3ivEXT)this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&CaptureTableDecorator::m_glTangent3ivEXT_capture;
+this->m_orig_glGetUniformfv = this->m_ptr_glGetUniformfv;
+if(this->m_ptr_glGetUniformfv)this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&CaptureTableDecorator::m_glGetUniformfv_capture;
+this->m_orig_glSecondaryColor3ubv = this->m_ptr_glSecondaryColor3ubv;
+if(this->m_ptr_glSecondaryColor3ubv)this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&CaptureTableDecorator::m_glSecondaryColor3ubv_capture;
+this->m_orig_glMakeTextureHandleNonResidentNV = this->m_ptr_glMakeTextureHandleNonResidentNV;
+if(this->m_ptr_glMakeTextureHandleNonResidentNV)this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeTextureHandleNonResidentNV_capture;
+this->m_orig_glVertexAttribs4ubvNV = this->m_ptr_glVertexAttribs4ubvNV;
+if(this->m_ptr_glVertexAttribs4ubvNV)this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&CaptureTableDecorator::m_glVertexAttribs4ubvNV_capture;
+this->m_orig_glClipPlanexOES = this->m_ptr_glClipPlanexOES;
+if(this->m_ptr_glClipPlanexOES)this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&CaptureTableDecorator::m_glClipPlanexOES_capture;
+this->m_orig_glMultiTexCoord3iv = this->m_ptr_glMultiTexCoord3iv;
+if(this->m_ptr_glMultiTexCoord3iv)this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&CaptureTableDecorator::m_glMultiTexCoord3iv_capture;
+this->m_orig_glGetnPolygonStippleARB = this->m_ptr_glGetnPolygonStippleARB;
+if(this->m_ptr_glGetnPolygonStippleARB)this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&CaptureTableDecorator::m_glGetnPolygonStippleARB_capture;
+this->m_orig_glUniform2i64vNV = this->m_ptr_glUniform2i64vNV;
+if(this->m_ptr_glUniform2i64vNV)this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&CaptureTableDecorator::m_glUniform2i64vNV_capture;
+this->m_orig_glLightModelf = this->m_ptr_glLightModelf;
+if(this->m_ptr_glLightModelf)this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&CaptureTableDecorator::m_glLightModelf_capture;
+this->m_orig_glDeleteMemoryObjectsEXT = this->m_ptr_glDeleteMemoryObjectsEXT;
+if(this->m_ptr_glDeleteMemoryObjectsEXT)this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&CaptureTableDecorator::m_glDeleteMemoryObjectsEXT_capture;
+this->m_orig_glMultiTexSubImage2DEXT = this->m_ptr_glMultiTexSubImage2DEXT;
+if(this->m_ptr_glMultiTexSubImage2DEXT)this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glMultiTexSubImage2DEXT_capture;
+this->m_orig_glReplacementCodeuiColor3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_capture;
+this->m_orig_glTangent3dvEXT = this->m_ptr_glTangent3dvEXT;
+if(this->m_ptr_glTangent3dvEXT)this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&CaptureTableDecorator::m_glTangent3dvEXT_capture;
+this->m_orig_glLightModeli = this->m_ptr_glLightModeli;
+if(this->m_ptr_glLightModeli)this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&CaptureTableDecorator::m_glLightModeli_capture;
+this->m_orig_glVertexWeighthvNV = this->m_ptr_glVertexWeighthvNV;
+if(this->m_ptr_glVertexWeighthvNV)this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&CaptureTableDecorator::m_glVertexWeighthvNV_capture;
+this->m_orig_glWindowPos3iv = this->m_ptr_glWindowPos3iv;
+if(this->m_ptr_glWindowPos3iv)this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&CaptureTableDecorator::m_glWindowPos3iv_capture;
+this->m_orig_glMultiTexCoordP1uiv = this->m_ptr_glMultiTexCoordP1uiv;
+if(this->m_ptr_glMultiTexCoordP1uiv)this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&CaptureTableDecorator::m_glMultiTexCoordP1uiv_capture;
+this->m_orig_glTransformPathNV = this->m_ptr_glTransformPathNV;
+if(this->m_ptr_glTransformPathNV)this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&CaptureTableDecorator::m_glTransformPathNV_capture;
+this->m_orig_glProgramNamedParameter4dNV = this->m_ptr_glProgramNamedParameter4dNV;
+if(this->m_ptr_glProgramNamedParameter4dNV)this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&CaptureTableDecorator::m_glProgramNamedParameter4dNV_capture;
+this->m_orig_glMultiDrawElementsIndirect = this->m_ptr_glMultiDrawElementsIndirect;
+if(this->m_ptr_glMultiDrawElementsIndirect)this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirect_capture;
+this->m_orig_glProgramUniform1dEXT = this->m_ptr_glProgramUniform1dEXT;
+if(this->m_ptr_glProgramUniform1dEXT)this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&CaptureTableDecorator::m_glProgramUniform1dEXT_capture;
+this->m_orig_glCallLists = this->m_ptr_glCallLists;
+if(this->m_ptr_glCallLists)this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&CaptureTableDecorator::m_glCallLists_capture;
+this->m_orig_glNormal3hvNV = this->m_ptr_glNormal3hvNV;
+if(this->m_ptr_glNormal3hvNV)this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&CaptureTableDecorator::m_glNormal3hvNV_capture;
+this->m_orig_glGetCombinerOutputParameterfvNV = this->m_ptr_glGetCombinerOutputParameterfvNV;
+if(this->m_ptr_glGetCombinerOutputParameterfvNV)this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetCombinerOutputParameterfvNV_capture;
+this->m_orig_glVertexAttrib4sARB = this->m_ptr_glVertexAttrib4sARB;
+if(this->m_ptr_glVertexAttrib4sARB)this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&CaptureTableDecorator::m_glVertexAttrib4sARB_capture;
+this->m_orig_glTexCoord3i = this->m_ptr_glTexCoord3i;
+if(this->m_ptr_glTexCoord3i)this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&CaptureTableDecorator::m_glTexCoord3i_capture;
+this->m_orig_glVertexAttribI3uiv = this->m_ptr_glVertexAttribI3uiv;
+if(this->m_ptr_glVertexAttribI3uiv)this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&CaptureTableDecorator::m_glVertexAttribI3uiv_capture;
+this->m_orig_glPushDebugGroup = this->m_ptr_glPushDebugGroup;
+if(this->m_ptr_glPushDebugGroup)this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&CaptureTableDecorator::m_glPushDebugGroup_capture;
+this->m_orig_glTexCoord3f = this->m_ptr_glTexCoord3f;
+if(this->m_ptr_glTexCoord3f)this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&CaptureTableDecorator::m_glTexCoord3f_capture;
+this->m_orig_glTexCoord3d = this->m_ptr_glTexCoord3d;
+if(this->m_ptr_glTexCoord3d)this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&CaptureTableDecorator::m_glTexCoord3d_capture;
+this->m_orig_glTexCoord2xOES = this->m_ptr_glTexCoord2xOES;
+if(this->m_ptr_glTexCoord2xOES)this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&CaptureTableDecorator::m_glTexCoord2xOES_capture;
+this->m_orig_glGetStageIndexNV = this->m_ptr_glGetStageIndexNV;
+if(this->m_ptr_glGetStageIndexNV)this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&CaptureTableDecorator::m_glGetStageIndexNV_capture;
+this->m_orig_glProgramUniform4i64vNV = this->m_ptr_glProgramUniform4i64vNV;
+if(this->m_ptr_glProgramUniform4i64vNV)this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&CaptureTableDecorator::m_glProgramUniform4i64vNV_capture;
+this->m_orig_glGetNamedBufferPointervEXT = this->m_ptr_glGetNamedBufferPointervEXT;
+if(this->m_ptr_glGetNamedBufferPointervEXT)this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&CaptureTableDecorator::m_glGetNamedBufferPointervEXT_capture;
+this->m_orig_glTextureBarrierNV = this->m_ptr_glTextureBarrierNV;
+if(this->m_ptr_glTextureBarrierNV)this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&CaptureTableDecorator::m_glTextureBarrierNV_capture;
+this->m_orig_glColor4ubVertex3fvSUN = this->m_ptr_glColor4ubVertex3fvSUN;
+if(this->m_ptr_glColor4ubVertex3fvSUN)this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glColor4ubVertex3fvSUN_capture;
+this->m_orig_glGetCommandHeaderNV = this->m_ptr_glGetCommandHeaderNV;
+if(this->m_ptr_glGetCommandHeaderNV)this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&CaptureTableDecorator::m_glGetCommandHeaderNV_capture;
+this->m_orig_glGetPerfMonitorCounterInfoAMD = this->m_ptr_glGetPerfMonitorCounterInfoAMD;
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD)this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorCounterInfoAMD_capture;
+this->m_orig_glVertexAttrib1svARB = this->m_ptr_glVertexAttrib1svARB;
+if(this->m_ptr_glVertexAttrib1svARB)this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&CaptureTableDecorator::m_glVertexAttrib1svARB_capture;
+this->m_orig_glCombinerParameteriNV = this->m_ptr_glCombinerParameteriNV;
+if(this->m_ptr_glCombinerParameteriNV)this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&CaptureTableDecorator::m_glCombinerParameteriNV_capture;
+this->m_orig_glMatrixMultTransposefEXT = this->m_ptr_glMatrixMultTransposefEXT;
+if(this->m_ptr_glMatrixMultTransposefEXT)this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&CaptureTableDecorator::m_glMatrixMultTransposefEXT_capture;
+this->m_orig_glDetailTexFuncSGIS = this->m_ptr_glDetailTexFuncSGIS;
+if(this->m_ptr_glDetailTexFuncSGIS)this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&CaptureTableDecorator::m_glDetailTexFuncSGIS_capture;
+this->m_orig_glAreTexturesResident = this->m_ptr_glAreTexturesResident;
+if(this->m_ptr_glAreTexturesResident)this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&CaptureTableDecorator::m_glAreTexturesResident_capture;
+this->m_orig_glProgramUniform2d = this->m_ptr_glProgramUniform2d;
+if(this->m_ptr_glProgramUniform2d)this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&CaptureTableDecorator::m_glProgramUniform2d_capture;
+this->m_orig_glGetConvolutionParameterfvEXT = this->m_ptr_glGetConvolutionParameterfvEXT;
+if(this->m_ptr_glGetConvolutionParameterfvEXT)this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetConvolutionParameterfvEXT_capture;
+this->m_orig_glIndexPointerListIBM = this->m_ptr_glIndexPointerListIBM;
+if(this->m_ptr_glIndexPointerListIBM)this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glIndexPointerListIBM_capture;
+this->m_orig_glVertexAttribI4iEXT = this->m_ptr_glVertexAttribI4iEXT;
+if(this->m_ptr_glVertexAttribI4iEXT)this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4iEXT_capture;
+this->m_orig_glProgramUniform2f = this->m_ptr_glProgramUniform2f;
+if(this->m_ptr_glProgramUniform2f)this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&CaptureTableDecorator::m_glProgramUniform2f_capture;
+this->m_orig_glRasterPos4sv = this->m_ptr_glRasterPos4sv;
+if(this->m_ptr_glRasterPos4sv)this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&CaptureTableDecorator::m_glRasterPos4sv_capture;
+this->m_orig_glColor4s = this->m_ptr_glColor4s;
+if(this->m_ptr_glColor4s)this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&CaptureTableDecorator::m_glColor4s_capture;
+this->m_orig_glMulticastGetQueryObjectivNV = this->m_ptr_glMulticastGetQueryObjectivNV;
+if(this->m_ptr_glMulticastGetQueryObjectivNV)this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&CaptureTableDecorator::m_glMulticastGetQueryObjectivNV_capture;
+this->m_orig_glColorFragmentOp3ATI = this->m_ptr_glColorFragmentOp3ATI;
+if(this->m_ptr_glColorFragmentOp3ATI)this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&CaptureTableDecorator::m_glColorFragmentOp3ATI_capture;
+this->m_orig_glResizeBuffersMESA = this->m_ptr_glResizeBuffersMESA;
+if(this->m_ptr_glResizeBuffersMESA)this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&CaptureTableDecorator::m_glResizeBuffersMESA_capture;
+this->m_orig_glGetMinmaxParameterfv = this->m_ptr_glGetMinmaxParameterfv;
+if(this->m_ptr_glGetMinmaxParameterfv)this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&CaptureTableDecorator::m_glGetMinmaxParameterfv_capture;
+this->m_orig_glClientActiveTextureARB = this->m_ptr_glClientActiveTextureARB;
+if(this->m_ptr_glClientActiveTextureARB)this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&CaptureTableDecorator::m_glClientActiveTextureARB_capture;
+this->m_orig_glBindVertexArray = this->m_ptr_glBindVertexArray;
+if(this->m_ptr_glBindVertexArray)this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&CaptureTableDecorator::m_glBindVertexArray_capture;
+this->m_orig_glColor4b = this->m_ptr_glColor4b;
+if(this->m_ptr_glColor4b)this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&CaptureTableDecorator::m_glColor4b_capture;
+this->m_orig_glColor4f = this->m_ptr_glColor4f;
+if(this->m_ptr_glColor4f)this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&CaptureTableDecorator::m_glColor4f_capture;
+this->m_orig_glColor4d = this->m_ptr_glColor4d;
+if(this->m_ptr_glColor4d)this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&CaptureTableDecorator::m_glColor4d_capture;
+this->m_orig_glColor4i = this->m_ptr_glColor4i;
+if(this->m_ptr_glColor4i)this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&CaptureTableDecorator::m_glColor4i_capture;
+this->m_orig_glEdgeFlagFormatNV = this->m_ptr_glEdgeFlagFormatNV;
+if(this->m_ptr_glEdgeFlagFormatNV)this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&CaptureTableDecorator::m_glEdgeFlagFormatNV_capture;
+this->m_orig_glNamedBufferSubData = this->m_ptr_glNamedBufferSubData;
+if(this->m_ptr_glNamedBufferSubData)this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glNamedBufferSubData_capture;
+this->m_orig_glDrawElementsInstanced = this->m_ptr_glDrawElementsInstanced;
+if(this->m_ptr_glDrawElementsInstanced)this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&CaptureTableDecorator::m_glDrawElementsInstanced_capture;
+this->m_orig_glGetMultiTexParameterIivEXT = this->m_ptr_glGetMultiTexParameterIivEXT;
+if(this->m_ptr_glGetMultiTexParameterIivEXT)this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexParameterIivEXT_capture;
+this->m_orig_glVertex2dv = this->m_ptr_glVertex2dv;
+if(this->m_ptr_glVertex2dv)this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&CaptureTableDecorator::m_glVertex2dv_capture;
+this->m_orig_glDisableVertexArrayAttribEXT = this->m_ptr_glDisableVertexArrayAttribEXT;
+if(this->m_ptr_glDisableVertexArrayAttribEXT)this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&CaptureTableDecorator::m_glDisableVertexArrayAttribEXT_capture;
+this->m_orig_glObjectUnpurgeableAPPLE = this->m_ptr_glObjectUnpurgeableAPPLE;
+if(this->m_ptr_glObjectUnpurgeableAPPLE)this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&CaptureTableDecorator::m_glObjectUnpurgeableAPPLE_capture;
+this->m_orig_glVertexAttribs2dvNV = this->m_ptr_glVertexAttribs2dvNV;
+if(this->m_ptr_glVertexAttribs2dvNV)this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&CaptureTableDecorator::m_glVertexAttribs2dvNV_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_capture;
+this->m_orig_glGetMapParameterfvNV = this->m_ptr_glGetMapParameterfvNV;
+if(this->m_ptr_glGetMapParameterfvNV)this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetMapParameterfvNV_capture;
+this->m_orig_glProgramUniform4ivEXT = this->m_ptr_glProgramUniform4ivEXT;
+if(this->m_ptr_glProgramUniform4ivEXT)this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&CaptureTableDecorator::m_glProgramUniform4ivEXT_capture;
+this->m_orig_glProgramUniform3ui64vNV = this->m_ptr_glProgramUniform3ui64vNV;
+if(this->m_ptr_glProgramUniform3ui64vNV)this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&CaptureTableDecorator::m_glProgramUniform3ui64vNV_capture;
+this->m_orig_glRectfv = this->m_ptr_glRectfv;
+if(this->m_ptr_glRectfv)this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&CaptureTableDecorator::m_glRectfv_capture;
+this->m_orig_glTexFilterFuncSGIS = this->m_ptr_glTexFilterFuncSGIS;
+if(this->m_ptr_glTexFilterFuncSGIS)this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&CaptureTableDecorator::m_glTexFilterFuncSGIS_capture;
+this->m_orig_glSpriteParameterfvSGIX = this->m_ptr_glSpriteParameterfvSGIX;
+if(this->m_ptr_glSpriteParameterfvSGIX)this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&CaptureTableDecorator::m_glSpriteParameterfvSGIX_capture;
+this->m_orig_glCopyMultiTexImage1DEXT = this->m_ptr_glCopyMultiTexImage1DEXT;
+if(this->m_ptr_glCopyMultiTexImage1DEXT)this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyMultiTexImage1DEXT_capture;
+this->m_orig_glGetVertexAttribIuivEXT = this->m_ptr_glGetVertexAttribIuivEXT;
+if(this->m_ptr_glGetVertexAttribIuivEXT)this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&CaptureTableDecorator::m_glGetVertexAttribIuivEXT_capture;
+this->m_orig_glUniformMatrix2x4dv = this->m_ptr_glUniformMatrix2x4dv;
+if(this->m_ptr_glUniformMatrix2x4dv)this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&CaptureTableDecorator::m_glUniformMatrix2x4dv_capture;
+this->m_orig_glGetProgramResourceLocationIndex = this->m_ptr_glGetProgramResourceLocationIndex;
+if(this->m_ptr_glGetProgramResourceLocationIndex)this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&CaptureTableDecorator::m_glGetProgramResourceLocationIndex_capture;
+this->m_orig_glColor3hNV = this->m_ptr_glColor3hNV;
+if(this->m_ptr_glColor3hNV)this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&CaptureTableDecorator::m_glColor3hNV_capture;
+this->m_orig_glViewport = this->m_ptr_glViewport;
+if(this->m_ptr_glViewport)this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&CaptureTableDecorator::m_glViewport_capture;
+this->m_orig_glProgramNamedParameter4fNV = this->m_ptr_glProgramNamedParameter4fNV;
+if(this->m_ptr_glProgramNamedParameter4fNV)this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&CaptureTableDecorator::m_glProgramNamedParameter4fNV_capture;
+this->m_orig_glGetInvariantBooleanvEXT = this->m_ptr_glGetInvariantBooleanvEXT;
+if(this->m_ptr_glGetInvariantBooleanvEXT)this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&CaptureTableDecorator::m_glGetInvariantBooleanvEXT_capture;
+this->m_orig_glTexStorage2DMultisample = this->m_ptr_glTexStorage2DMultisample;
+if(this->m_ptr_glTexStorage2DMultisample)this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTexStorage2DMultisample_capture;
+this->m_orig_glPixelStorex = this->m_ptr_glPixelStorex;
+if(this->m_ptr_glPixelStorex)this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&CaptureTableDecorator::m_glPixelStorex_capture;
+this->m_orig_glVertexAttribL1dvEXT = this->m_ptr_glVertexAttribL1dvEXT;
+if(this->m_ptr_glVertexAttribL1dvEXT)this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&CaptureTableDecorator::m_glVertexAttribL1dvEXT_capture;
+this->m_orig_glGetActiveSubroutineUniformiv = this->m_ptr_glGetActiveSubroutineUniformiv;
+if(this->m_ptr_glGetActiveSubroutineUniformiv)this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&CaptureTableDecorator::m_glGetActiveSubroutineUniformiv_capture;
+this->m_orig_glVertexAttribPointerARB = this->m_ptr_glVertexAttribPointerARB;
+if(this->m_ptr_glVertexAttribPointerARB)this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&CaptureTableDecorator::m_glVertexAttribPointerARB_capture;
+this->m_orig_glCompressedTexSubImage2DARB = this->m_ptr_glCompressedTexSubImage2DARB;
+if(this->m_ptr_glCompressedTexSubImage2DARB)this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&CaptureTableDecorator::m_glCompressedTexSubImage2DARB_capture;
+this->m_orig_glTexStorageMem1DEXT = this->m_ptr_glTexStorageMem1DEXT;
+if(this->m_ptr_glTexStorageMem1DEXT)this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&CaptureTableDecorator::m_glTexStorageMem1DEXT_capture;
+this->m_orig_glVertex2hvNV = this->m_ptr_glVertex2hvNV;
+if(this->m_ptr_glVertex2hvNV)this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&CaptureTableDecorator::m_glVertex2hvNV_capture;
+this->m_orig_glTexBuffer = this->m_ptr_glTexBuffer;
+if(this->m_ptr_glTexBuffer)this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&CaptureTableDecorator::m_glTexBuffer_capture;
+this->m_orig_glArrayElement = this->m_ptr_glArrayElement;
+if(this->m_ptr_glArrayElement)this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&CaptureTableDecorator::m_glArrayElement_capture;
+this->m_orig_glValidateProgram = this->m_ptr_glValidateProgram;
+if(this->m_ptr_glValidateProgram)this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&CaptureTableDecorator::m_glValidateProgram_capture;
+this->m_orig_glPixelStoref = this->m_ptr_glPixelStoref;
+if(this->m_ptr_glPixelStoref)this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&CaptureTableDecorator::m_glPixelStoref_capture;
+this->m_orig_glWindowPos3dARB = this->m_ptr_glWindowPos3dARB;
+if(this->m_ptr_glWindowPos3dARB)this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&CaptureTableDecorator::m_glWindowPos3dARB_capture;
+this->m_orig_glEvalCoord1dv = this->m_ptr_glEvalCoord1dv;
+if(this->m_ptr_glEvalCoord1dv)this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&CaptureTableDecorator::m_glEvalCoord1dv_capture;
+this->m_orig_glVertexAttribs2fvNV = this->m_ptr_glVertexAttribs2fvNV;
+if(this->m_ptr_glVertexAttribs2fvNV)this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&CaptureTableDecorator::m_glVertexAttribs2fvNV_capture;
+this->m_orig_glRecti = this->m_ptr_glRecti;
+if(this->m_ptr_glRecti)this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&CaptureTableDecorator::m_glRecti_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_capture;
+this->m_orig_glTexCoord1bOES = this->m_ptr_glTexCoord1bOES;
+if(this->m_ptr_glTexCoord1bOES)this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&CaptureTableDecorator::m_glTexCoord1bOES_capture;
+this->m_orig_glProgramUniform2i64vARB = this->m_ptr_glProgramUniform2i64vARB;
+if(this->m_ptr_glProgramUniform2i64vARB)this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&CaptureTableDecorator::m_glProgramUniform2i64vARB_capture;
+this->m_orig_glWindowPos2dARB = this->m_ptr_glWindowPos2dARB;
+if(this->m_ptr_glWindowPos2dARB)this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&CaptureTableDecorator::m_glWindowPos2dARB_capture;
+this->m_orig_glGetProgramParameterdvNV = this->m_ptr_glGetProgramParameterdvNV;
+if(this->m_ptr_glGetProgramParameterdvNV)this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&CaptureTableDecorator::m_glGetProgramParameterdvNV_capture;
+this->m_orig_glRectf = this->m_ptr_glRectf;
+if(this->m_ptr_glRectf)this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&CaptureTableDecorator::m_glRectf_capture;
+this->m_orig_glRectd = this->m_ptr_glRectd;
+if(this->m_ptr_glRectd)this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&CaptureTableDecorator::m_glRectd_capture;
+this->m_orig_glMap1xOES = this->m_ptr_glMap1xOES;
+if(this->m_ptr_glMap1xOES)this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&CaptureTableDecorator::m_glMap1xOES_capture;
+this->m_orig_glVertexAttrib3fvNV = this->m_ptr_glVertexAttrib3fvNV;
+if(this->m_ptr_glVertexAttrib3fvNV)this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&CaptureTableDecorator::m_glVertexAttrib3fvNV_capture;
+this->m_orig_glReferencePlaneSGIX = this->m_ptr_glReferencePlaneSGIX;
+if(this->m_ptr_glReferencePlaneSGIX)this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&CaptureTableDecorator::m_glReferencePlaneSGIX_capture;
+this->m_orig_glMulticastBlitFramebufferNV = this->m_ptr_glMulticastBlitFramebufferNV;
+if(this->m_ptr_glMulticastBlitFramebufferNV)this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&CaptureTableDecorator::m_glMulticastBlitFramebufferNV_capture;
+this->m_orig_glGetCombinerInputParameterfvNV = this->m_ptr_glGetCombinerInputParameterfvNV;
+if(this->m_ptr_glGetCombinerInputParameterfvNV)this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetCombinerInputParameterfvNV_capture;
+this->m_orig_glGetTextureSamplerHandleARB = this->m_ptr_glGetTextureSamplerHandleARB;
+if(this->m_ptr_glGetTextureSamplerHandleARB)this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&CaptureTableDecorator::m_glGetTextureSamplerHandleARB_capture;
+this->m_orig_glBindTexture = this->m_ptr_glBindTexture;
+if(this->m_ptr_glBindTexture)this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&CaptureTableDecorator::m_glBindTexture_capture;
+this->m_orig_glRects = this->m_ptr_glRects;
+if(this->m_ptr_glRects)this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&CaptureTableDecorator::m_glRects_capture;
+this->m_orig_glGetActiveAttribARB = this->m_ptr_glGetActiveAttribARB;
+if(this->m_ptr_glGetActiveAttribARB)this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&CaptureTableDecorator::m_glGetActiveAttribARB_capture;
+this->m_orig_glHistogramEXT = this->m_ptr_glHistogramEXT;
+if(this->m_ptr_glHistogramEXT)this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&CaptureTableDecorator::m_glHistogramEXT_capture;
+this->m_orig_glGetTextureSamplerHandleNV = this->m_ptr_glGetTextureSamplerHandleNV;
+if(this->m_ptr_glGetTextureSamplerHandleNV)this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&CaptureTableDecorator::m_glGetTextureSamplerHandleNV_capture;
+this->m_orig_glDetachShader = this->m_ptr_glDetachShader;
+if(this->m_ptr_glDetachShader)this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&CaptureTableDecorator::m_glDetachShader_capture;
+this->m_orig_glFinishTextureSUNX = this->m_ptr_glFinishTextureSUNX;
+if(this->m_ptr_glFinishTextureSUNX)this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&CaptureTableDecorator::m_glFinishTextureSUNX_capture;
+this->m_orig_glUniformMatrix3x4dv = this->m_ptr_glUniformMatrix3x4dv;
+if(this->m_ptr_glUniformMatrix3x4dv)this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&CaptureTableDecorator::m_glUniformMatrix3x4dv_capture;
+this->m_orig_glVertexAttrib4fARB = this->m_ptr_glVertexAttrib4fARB;
+if(this->m_ptr_glVertexAttrib4fARB)this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&CaptureTableDecorator::m_glVertexAttrib4fARB_capture;
+this->m_orig_glGetPathColorGenivNV = this->m_ptr_glGetPathColorGenivNV;
+if(this->m_ptr_glGetPathColorGenivNV)this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&CaptureTableDecorator::m_glGetPathColorGenivNV_capture;
+this->m_orig_glGetProgramResourceLocation = this->m_ptr_glGetProgramResourceLocation;
+if(this->m_ptr_glGetProgramResourceLocation)this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&CaptureTableDecorator::m_glGetProgramResourceLocation_capture;
+this->m_orig_glVertexArrayAttribLFormat = this->m_ptr_glVertexArrayAttribLFormat;
+if(this->m_ptr_glVertexArrayAttribLFormat)this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&CaptureTableDecorator::m_glVertexArrayAttribLFormat_capture;
+this->m_orig_glGetTexLevelParameterfv = this->m_ptr_glGetTexLevelParameterfv;
+if(this->m_ptr_glGetTexLevelParameterfv)this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&CaptureTableDecorator::m_glGetTexLevelParameterfv_capture;
+this->m_orig_glVertexArrayVertexAttribOffsetEXT = this->m_ptr_glVertexArrayVertexAttribOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT)this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_capture;
+this->m_orig_glIndexFormatNV = this->m_ptr_glIndexFormatNV;
+if(this->m_ptr_glIndexFormatNV)this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&CaptureTableDecorator::m_glIndexFormatNV_capture;
+this->m_orig_glMultiTexCoord3i = this->m_ptr_glMultiTexCoord3i;
+if(this->m_ptr_glMultiTexCoord3i)this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&CaptureTableDecorator::m_glMultiTexCoord3i_capture;
+this->m_orig_glReplacementCodeuiVertex3fvSUN = this->m_ptr_glReplacementCodeuiVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN)this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiVertex3fvSUN_capture;
+this->m_orig_glViewportIndexedfv = this->m_ptr_glViewportIndexedfv;
+if(this->m_ptr_glViewportIndexedfv)this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&CaptureTableDecorator::m_glViewportIndexedfv_capture;
+this->m_orig_glBindBuffersBase = this->m_ptr_glBindBuffersBase;
+if(this->m_ptr_glBindBuffersBase)this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&CaptureTableDecorator::m_glBindBuffersBase_capture;
+this->m_orig_glTexBumpParameterfvATI = this->m_ptr_glTexBumpParameterfvATI;
+if(this->m_ptr_glTexBumpParameterfvATI)this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&CaptureTableDecorator::m_glTexBumpParameterfvATI_capture;
+this->m_orig_glMatrixIndexuivARB = this->m_ptr_glMatrixIndexuivARB;
+if(this->m_ptr_glMatrixIndexuivARB)this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&CaptureTableDecorator::m_glMatrixIndexuivARB_capture;
+this->m_orig_glVertexAttrib1hNV = this->m_ptr_glVertexAttrib1hNV;
+if(this->m_ptr_glVertexAttrib1hNV)this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&CaptureTableDecorator::m_glVertexAttrib1hNV_capture;
+this->m_orig_glWindowPos3svMESA = this->m_ptr_glWindowPos3svMESA;
+if(this->m_ptr_glWindowPos3svMESA)this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&CaptureTableDecorator::m_glWindowPos3svMESA_capture;
+this->m_orig_glStencilOpSeparateATI = this->m_ptr_glStencilOpSeparateATI;
+if(this->m_ptr_glStencilOpSeparateATI)this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&CaptureTableDecorator::m_glStencilOpSeparateATI_capture;
+this->m_orig_glDrawElementsBaseVertex = this->m_ptr_glDrawElementsBaseVertex;
+if(this->m_ptr_glDrawElementsBaseVertex)this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&CaptureTableDecorator::m_glDrawElementsBaseVertex_capture;
+this->m_orig_glBlendEquationSeparateiARB = this->m_ptr_glBlendEquationSeparateiARB;
+if(this->m_ptr_glBlendEquationSeparateiARB)this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&CaptureTableDecorator::m_glBlendEquationSeparateiARB_capture;
+this->m_orig_glVertexAttrib1fNV = this->m_ptr_glVertexAttrib1fNV;
+if(this->m_ptr_glVertexAttrib1fNV)this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&CaptureTableDecorator::m_glVertexAttrib1fNV_capture;
+this->m_orig_glMapVertexAttrib2fAPPLE = this->m_ptr_glMapVertexAttrib2fAPPLE;
+if(this->m_ptr_glMapVertexAttrib2fAPPLE)this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&CaptureTableDecorator::m_glMapVertexAttrib2fAPPLE_capture;
+this->m_orig_glCompressedTextureSubImage1DEXT = this->m_ptr_glCompressedTextureSubImage1DEXT;
+if(this->m_ptr_glCompressedTextureSubImage1DEXT)this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage1DEXT_capture;
+this->m_orig_glClearBufferSubData = this->m_ptr_glClearBufferSubData;
+if(this->m_ptr_glClearBufferSubData)this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glClearBufferSubData_capture;
+this->m_orig_glTexStorage1D = this->m_ptr_glTexStorage1D;
+if(this->m_ptr_glTexStorage1D)this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&CaptureTableDecorator::m_glTexStorage1D_capture;
+this->m_orig_glVertexAttribI3iEXT = this->m_ptr_glVertexAttribI3iEXT;
+if(this->m_ptr_glVertexAttribI3iEXT)this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&CaptureTableDecorator::m_glVertexAttribI3iEXT_capture;
+this->m_orig_glMakeTextureHandleNonResidentARB = this->m_ptr_glMakeTextureHandleNonResidentARB;
+if(this->m_ptr_glMakeTextureHandleNonResidentARB)this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&CaptureTableDecorator::m_glMakeTextureHandleNonResidentARB_capture;
+this->m_orig_glMultiDrawElementArrayAPPLE = this->m_ptr_glMultiDrawElementArrayAPPLE;
+if(this->m_ptr_glMultiDrawElementArrayAPPLE)this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&CaptureTableDecorator::m_glMultiDrawElementArrayAPPLE_capture;
+this->m_orig_glVertexStream4dATI = this->m_ptr_glVertexStream4dATI;
+if(this->m_ptr_glVertexStream4dATI)this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&CaptureTableDecorator::m_glVertexStream4dATI_capture;
+this->m_orig_glProgramUniformMatrix2dvEXT = this->m_ptr_glProgramUniformMatrix2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2dvEXT)this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2dvEXT_capture;
+this->m_orig_glVertexAttribs2hvNV = this->m_ptr_glVertexAttribs2hvNV;
+if(this->m_ptr_glVertexAttribs2hvNV)this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&CaptureTableDecorator::m_glVertexAttribs2hvNV_capture;
+this->m_orig_glGetUniformiv = this->m_ptr_glGetUniformiv;
+if(this->m_ptr_glGetUniformiv)this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&CaptureTableDecorator::m_glGetUniformiv_capture;
+this->m_orig_glClipPlanefOES = this->m_ptr_glClipPlanefOES;
+if(this->m_ptr_glClipPlanefOES)this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&CaptureTableDecorator::m_glClipPlanefOES_capture;
+this->m_orig_glRenderbufferStorage = this->m_ptr_glRenderbufferStorage;
+if(this->m_ptr_glRenderbufferStorage)this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&CaptureTableDecorator::m_glRenderbufferStorage_capture;
+this->m_orig_glUniform4ui = this->m_ptr_glUniform4ui;
+if(this->m_ptr_glUniform4ui)this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&CaptureTableDecorator::m_glUniform4ui_capture;
+this->m_orig_glBindFramebuffer = this->m_ptr_glBindFramebuffer;
+if(this->m_ptr_glBindFramebuffer)this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&CaptureTableDecorator::m_glBindFramebuffer_capture;
+this->m_orig_glValidateProgramARB = this->m_ptr_glValidateProgramARB;
+if(this->m_ptr_glValidateProgramARB)this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&CaptureTableDecorator::m_glValidateProgramARB_capture;
+this->m_orig_glTexGenf = this->m_ptr_glTexGenf;
+if(this->m_ptr_glTexGenf)this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&CaptureTableDecorator::m_glTexGenf_capture;
+this->m_orig_glTexGend = this->m_ptr_glTexGend;
+if(this->m_ptr_glTexGend)this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&CaptureTableDecorator::m_glTexGend_capture;
+this->m_orig_glTexGeni = this->m_ptr_glTexGeni;
+if(this->m_ptr_glTexGeni)this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&CaptureTableDecorator::m_glTexGeni_capture;
+this->m_orig_glDeleteFramebuffersEXT = this->m_ptr_glDeleteFramebuffersEXT;
+if(this->m_ptr_glDeleteFramebuffersEXT)this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&CaptureTableDecorator::m_glDeleteFramebuffersEXT_capture;
+this->m_orig_glResetMinmaxEXT = this->m_ptr_glResetMinmaxEXT;
+if(this->m_ptr_glResetMinmaxEXT)this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&CaptureTableDecorator::m_glResetMinmaxEXT_capture;
+this->m_orig_glVertexAttrib1fvNV = this->m_ptr_glVertexAttrib1fvNV;
+if(this->m_ptr_glVertexAttrib1fvNV)this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&CaptureTableDecorator::m_glVertexAttrib1fvNV_capture;
+this->m_orig_glIsQueryARB = this->m_ptr_glIsQueryARB;
+if(this->m_ptr_glIsQueryARB)this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&CaptureTableDecorator::m_glIsQueryARB_capture;
+this->m_orig_glEnableVariantClientStateEXT = this->m_ptr_glEnableVariantClientStateEXT;
+if(this->m_ptr_glEnableVariantClientStateEXT)this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&CaptureTableDecorator::m_glEnableVariantClientStateEXT_capture;
+this->m_orig_glScissorIndexed = this->m_ptr_glScissorIndexed;
+if(this->m_ptr_glScissorIndexed)this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&CaptureTableDecorator::m_glScissorIndexed_capture;
+this->m_orig_glGetInvariantIntegervEXT = this->m_ptr_glGetInvariantIntegervEXT;
+if(this->m_ptr_glGetInvariantIntegervEXT)this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&CaptureTableDecorator::m_glGetInvariantIntegervEXT_capture;
+this->m_orig_glProgramLocalParameterI4uiNV = this->m_ptr_glProgramLocalParameterI4uiNV;
+if(this->m_ptr_glProgramLocalParameterI4uiNV)this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&CaptureTableDecorator::m_glProgramLocalParameterI4uiNV_capture;
+this->m_orig_glConvolutionParameterxvOES = this->m_ptr_glConvolutionParameterxvOES;
+if(this->m_ptr_glConvolutionParameterxvOES)this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&CaptureTableDecorator::m_glConvolutionParameterxvOES_capture;
+this->m_orig_glGenFramebuffersEXT = this->m_ptr_glGenFramebuffersEXT;
+if(this->m_ptr_glGenFramebuffersEXT)this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&CaptureTableDecorator::m_glGenFramebuffersEXT_capture;
+this->m_orig_glVertexArrayColorOffsetEXT = this->m_ptr_glVertexArrayColorOffsetEXT;
+if(this->m_ptr_glVertexArrayColorOffsetEXT)this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayColorOffsetEXT_capture;
+this->m_orig_glMultiTexCoord3ivARB = this->m_ptr_glMultiTexCoord3ivARB;
+if(this->m_ptr_glMultiTexCoord3ivARB)this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3ivARB_capture;
+this->m_orig_glVertexWeightfEXT = this->m_ptr_glVertexWeightfEXT;
+if(this->m_ptr_glVertexWeightfEXT)this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&CaptureTableDecorator::m_glVertexWeightfEXT_capture;
+this->m_orig_glRasterPos4dv = this->m_ptr_glRasterPos4dv;
+if(this->m_ptr_glRasterPos4dv)this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&CaptureTableDecorator::m_glRasterPos4dv_capture;
+this->m_orig_glIsTextureHandleResidentARB = this->m_ptr_glIsTextureHandleResidentARB;
+if(this->m_ptr_glIsTextureHandleResidentARB)this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&CaptureTableDecorator::m_glIsTextureHandleResidentARB_capture;
+this->m_orig_glRasterPos2dv = this->m_ptr_glRasterPos2dv;
+if(this->m_ptr_glRasterPos2dv)this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&CaptureTableDecorator::m_glRasterPos2dv_capture;
+this->m_orig_glWindowPos4ivMESA = this->m_ptr_glWindowPos4ivMESA;
+if(this->m_ptr_glWindowPos4ivMESA)this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&CaptureTableDecorator::m_glWindowPos4ivMESA_capture;
+this->m_orig_glGetVariantPointervEXT = this->m_ptr_glGetVariantPointervEXT;
+if(this->m_ptr_glGetVariantPointervEXT)this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&CaptureTableDecorator::m_glGetVariantPointervEXT_capture;
+this->m_orig_glMapNamedBufferRangeEXT = this->m_ptr_glMapNamedBufferRangeEXT;
+if(this->m_ptr_glMapNamedBufferRangeEXT)this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&CaptureTableDecorator::m_glMapNamedBufferRangeEXT_capture;
+this->m_orig_glGetnUniformui64vARB = this->m_ptr_glGetnUniformui64vARB;
+if(this->m_ptr_glGetnUniformui64vARB)this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&CaptureTableDecorator::m_glGetnUniformui64vARB_capture;
+this->m_orig_glCreateShaderProgramv = this->m_ptr_glCreateShaderProgramv;
+if(this->m_ptr_glCreateShaderProgramv)this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&CaptureTableDecorator::m_glCreateShaderProgramv_capture;
+this->m_orig_glGetQueryObjectiv = this->m_ptr_glGetQueryObjectiv;
+if(this->m_ptr_glGetQueryObjectiv)this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&CaptureTableDecorator::m_glGetQueryObjectiv_capture;
+this->m_orig_glMaxShaderCompilerThreadsKHR = this->m_ptr_glMaxShaderCompilerThreadsKHR;
+if(this->m_ptr_glMaxShaderCompilerThreadsKHR)this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&CaptureTableDecorator::m_glMaxShaderCompilerThreadsKHR_capture;
+this->m_orig_glPNTrianglesfATI = this->m_ptr_glPNTrianglesfATI;
+if(this->m_ptr_glPNTrianglesfATI)this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&CaptureTableDecorator::m_glPNTrianglesfATI_capture;
+this->m_orig_glGlobalAlphaFactorusSUN = this->m_ptr_glGlobalAlphaFactorusSUN;
+if(this->m_ptr_glGlobalAlphaFactorusSUN)this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactorusSUN_capture;
+this->m_orig_glVertexAttrib3dvNV = this->m_ptr_glVertexAttrib3dvNV;
+if(this->m_ptr_glVertexAttrib3dvNV)this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&CaptureTableDecorator::m_glVertexAttrib3dvNV_capture;
+this->m_orig_glMultiTexCoord3sARB = this->m_ptr_glMultiTexCoord3sARB;
+if(this->m_ptr_glMultiTexCoord3sARB)this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3sARB_capture;
+this->m_orig_glGenerateMipmap = this->m_ptr_glGenerateMipmap;
+if(this->m_ptr_glGenerateMipmap)this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&CaptureTableDecorator::m_glGenerateMipmap_capture;
+this->m_orig_glCompressedTextureSubImage2D = this->m_ptr_glCompressedTextureSubImage2D;
+if(this->m_ptr_glCompressedTextureSubImage2D)this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage2D_capture;
+this->m_orig_glNamedRenderbufferStorageMultisampleEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleEXT;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_capture;
+this->m_orig_glPolygonOffsetClampEXT = this->m_ptr_glPolygonOffsetClampEXT;
+if(this->m_ptr_glPolygonOffsetClampEXT)this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&CaptureTableDecorator::m_glPolygonOffsetClampEXT_capture;
+this->m_orig_glTextureRangeAPPLE = this->m_ptr_glTextureRangeAPPLE;
+if(this->m_ptr_glTextureRangeAPPLE)this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&CaptureTableDecorator::m_glTextureRangeAPPLE_capture;
+this->m_orig_glBlendEquationIndexedAMD = this->m_ptr_glBlendEquationIndexedAMD;
+if(this->m_ptr_glBlendEquationIndexedAMD)this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&CaptureTableDecorator::m_glBlendEquationIndexedAMD_capture;
+this->m_orig_glTexCoord2d = this->m_ptr_glTexCoord2d;
+if(this->m_ptr_glTexCoord2d)this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&CaptureTableDecorator::m_glTexCoord2d_capture;
+this->m_orig_glPointParameteri = this->m_ptr_glPointParameteri;
+if(this->m_ptr_glPointParameteri)this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&CaptureTableDecorator::m_glPointParameteri_capture;
+this->m_orig_glTexCoord2f = this->m_ptr_glTexCoord2f;
+if(this->m_ptr_glTexCoord2f)this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&CaptureTableDecorator::m_glTexCoord2f_capture;
+this->m_orig_glGetUnsignedBytei_vEXT = this->m_ptr_glGetUnsignedBytei_vEXT;
+if(this->m_ptr_glGetUnsignedBytei_vEXT)this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&CaptureTableDecorator::m_glGetUnsignedBytei_vEXT_capture;
+this->m_orig_glColor4iv = this->m_ptr_glColor4iv;
+if(this->m_ptr_glColor4iv)this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&CaptureTableDecorator::m_glColor4iv_capture;
+this->m_orig_glMapNamedBufferRange = this->m_ptr_glMapNamedBufferRange;
+if(this->m_ptr_glMapNamedBufferRange)this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&CaptureTableDecorator::m_glMapNamedBufferRange_capture;
+this->m_orig_glUnmapBuffer = this->m_ptr_glUnmapBuffer;
+if(this->m_ptr_glUnmapBuffer)this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&CaptureTableDecorator::m_glUnmapBuffer_capture;
+this->m_orig_glSampleMaskEXT = this->m_ptr_glSampleMaskEXT;
+if(this->m_ptr_glSampleMaskEXT)this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&CaptureTableDecorator::m_glSampleMaskEXT_capture;
+this->m_orig_glTexCoord2i = this->m_ptr_glTexCoord2i;
+if(this->m_ptr_glTexCoord2i)this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&CaptureTableDecorator::m_glTexCoord2i_capture;
+this->m_orig_glTexCoord1xvOES = this->m_ptr_glTexCoord1xvOES;
+if(this->m_ptr_glTexCoord1xvOES)this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&CaptureTableDecorator::m_glTexCoord1xvOES_capture;
+this->m_orig_glVertexAttrib1sARB = this->m_ptr_glVertexAttrib1sARB;
+if(this->m_ptr_glVertexAttrib1sARB)this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&CaptureTableDecorator::m_glVertexAttrib1sARB_capture;
+this->m_orig_glGetVertexArrayiv = this->m_ptr_glGetVertexArrayiv;
+if(this->m_ptr_glGetVertexArrayiv)this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&CaptureTableDecorator::m_glGetVertexArrayiv_capture;
+this->m_orig_glProgramParameter4dvNV = this->m_ptr_glProgramParameter4dvNV;
+if(this->m_ptr_glProgramParameter4dvNV)this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&CaptureTableDecorator::m_glProgramParameter4dvNV_capture;
+this->m_orig_glTexCoord2s = this->m_ptr_glTexCoord2s;
+if(this->m_ptr_glTexCoord2s)this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&CaptureTableDecorator::m_glTexCoord2s_capture;
+this->m_orig_glTextureParameterIuivEXT = this->m_ptr_glTextureParameterIuivEXT;
+if(this->m_ptr_glTextureParameterIuivEXT)this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glTextureParameterIuivEXT_capture;
+this->m_orig_glGetColorTableParameterfvSGI = this->m_ptr_glGetColorTableParameterfvSGI;
+if(this->m_ptr_glGetColorTableParameterfvSGI)this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&CaptureTableDecorator::m_glGetColorTableParameterfvSGI_capture;
+this->m_orig_glTexCoord4dv = this->m_ptr_glTexCoord4dv;
+if(this->m_ptr_glTexCoord4dv)this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&CaptureTableDecorator::m_glTexCoord4dv_capture;
+this->m_orig_glVertexAttrib1svNV = this->m_ptr_glVertexAttrib1svNV;
+if(this->m_ptr_glVertexAttrib1svNV)this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&CaptureTableDecorator::m_glVertexAttrib1svNV_capture;
+this->m_orig_glNamedFramebufferTextureFaceEXT = this->m_ptr_glNamedFramebufferTextureFaceEXT;
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT)this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTextureFaceEXT_capture;
+this->m_orig_glProgramUniform2ui64vNV = this->m_ptr_glProgramUniform2ui64vNV;
+if(this->m_ptr_glProgramUniform2ui64vNV)this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&CaptureTableDecorator::m_glProgramUniform2ui64vNV_capture;
+this->m_orig_glStencilFillPathNV = this->m_ptr_glStencilFillPathNV;
+if(this->m_ptr_glStencilFillPathNV)this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&CaptureTableDecorator::m_glStencilFillPathNV_capture;
+this->m_orig_glNormal3dv = this->m_ptr_glNormal3dv;
+if(this->m_ptr_glNormal3dv)this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&CaptureTableDecorator::m_glNormal3dv_capture;
+this->m_orig_glReleaseShaderCompiler = this->m_ptr_glReleaseShaderCompiler;
+if(this->m_ptr_glReleaseShaderCompiler)this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&CaptureTableDecorator::m_glReleaseShaderCompiler_capture;
+this->m_orig_glTexStorageMem3DEXT = this->m_ptr_glTexStorageMem3DEXT;
+if(this->m_ptr_glTexStorageMem3DEXT)this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&CaptureTableDecorator::m_glTexStorageMem3DEXT_capture;
+this->m_orig_glTexCoord3bvOES = this->m_ptr_glTexCoord3bvOES;
+if(this->m_ptr_glTexCoord3bvOES)this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&CaptureTableDecorator::m_glTexCoord3bvOES_capture;
+this->m_orig_glIsVertexAttribEnabledAPPLE = this->m_ptr_glIsVertexAttribEnabledAPPLE;
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE)this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&CaptureTableDecorator::m_glIsVertexAttribEnabledAPPLE_capture;
+this->m_orig_glTexCoord1dv = this->m_ptr_glTexCoord1dv;
+if(this->m_ptr_glTexCoord1dv)this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&CaptureTableDecorator::m_glTexCoord1dv_capture;
+this->m_orig_glReadPixels = this->m_ptr_glReadPixels;
+if(this->m_ptr_glReadPixels)this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&CaptureTableDecorator::m_glReadPixels_capture;
+this->m_orig_glVertexAttribI3iv = this->m_ptr_glVertexAttribI3iv;
+if(this->m_ptr_glVertexAttribI3iv)this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&CaptureTableDecorator::m_glVertexAttribI3iv_capture;
+this->m_orig_glSetFenceAPPLE = this->m_ptr_glSetFenceAPPLE;
+if(this->m_ptr_glSetFenceAPPLE)this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&CaptureTableDecorator::m_glSetFenceAPPLE_capture;
+this->m_orig_glWeightsvARB = this->m_ptr_glWeightsvARB;
+if(this->m_ptr_glWeightsvARB)this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&CaptureTableDecorator::m_glWeightsvARB_capture;
+this->m_orig_glShadeModel = this->m_ptr_glShadeModel;
+if(this->m_ptr_glShadeModel)this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&CaptureTableDecorator::m_glShadeModel_capture;
+this->m_orig_glTextureStorageMem3DMultisampleEXT = this->m_ptr_glTextureStorageMem3DMultisampleEXT;
+if(this->m_ptr_glTextureStorageMem3DMultisampleEXT)this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTextureStorageMem3DMultisampleEXT_capture;
+this->m_orig_glMapGrid1d = this->m_ptr_glMapGrid1d;
+if(this->m_ptr_glMapGrid1d)this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&CaptureTableDecorator::m_glMapGrid1d_capture;
+this->m_orig_glGetHistogramParameterivEXT = this->m_ptr_glGetHistogramParameterivEXT;
+if(this->m_ptr_glGetHistogramParameterivEXT)this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetHistogramParameterivEXT_capture;
+this->m_orig_glConservativeRasterParameteriNV = this->m_ptr_glConservativeRasterParameteriNV;
+if(this->m_ptr_glConservativeRasterParameteriNV)this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&CaptureTableDecorator::m_glConservativeRasterParameteriNV_capture;
+this->m_orig_glClearNamedBufferData = this->m_ptr_glClearNamedBufferData;
+if(this->m_ptr_glClearNamedBufferData)this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&CaptureTableDecorator::m_glClearNamedBufferData_capture;
+this->m_orig_glClearDepthf = this->m_ptr_glClearDepthf;
+if(this->m_ptr_glClearDepthf)this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&CaptureTableDecorator::m_glClearDepthf_capture;
+this->m_orig_glCreatePerfQueryINTEL = this->m_ptr_glCreatePerfQueryINTEL;
+if(this->m_ptr_glCreatePerfQueryINTEL)this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&CaptureTableDecorator::m_glCreatePerfQueryINTEL_capture;
+this->m_orig_glFogCoordfEXT = this->m_ptr_glFogCoordfEXT;
+if(this->m_ptr_glFogCoordfEXT)this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&CaptureTableDecorator::m_glFogCoordfEXT_capture;
+this->m_orig_glVertexAttrib2dARB = this->m_ptr_glVertexAttrib2dARB;
+if(this->m_ptr_glVertexAttrib2dARB)this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&CaptureTableDecorator::m_glVertexAttrib2dARB_capture;
+this->m_orig_glMultiTexCoord4dARB = this->m_ptr_glMultiTexCoord4dARB;
+if(this->m_ptr_glMultiTexCoord4dARB)this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4dARB_capture;
+this->m_orig_glReadnPixelsARB = this->m_ptr_glReadnPixelsARB;
+if(this->m_ptr_glReadnPixelsARB)this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&CaptureTableDecorator::m_glReadnPixelsARB_capture;
+this->m_orig_glMultiTexBufferEXT = this->m_ptr_glMultiTexBufferEXT;
+if(this->m_ptr_glMultiTexBufferEXT)this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&CaptureTableDecorator::m_glMultiTexBufferEXT_capture;
+this->m_orig_glWindowPos4dvMESA = this->m_ptr_glWindowPos4dvMESA;
+if(this->m_ptr_glWindowPos4dvMESA)this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&CaptureTableDecorator::m_glWindowPos4dvMESA_capture;
+this->m_orig_glInvalidateNamedFramebufferData = this->m_ptr_glInvalidateNamedFramebufferData;
+if(this->m_ptr_glInvalidateNamedFramebufferData)this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&CaptureTableDecorator::m_glInvalidateNamedFramebufferData_capture;
+this->m_orig_glSecondaryColorPointerListIBM = this->m_ptr_glSecondaryColorPointerListIBM;
+if(this->m_ptr_glSecondaryColorPointerListIBM)this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glSecondaryColorPointerListIBM_capture;
+this->m_orig_glRectiv = this->m_ptr_glRectiv;
+if(this->m_ptr_glRectiv)this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&CaptureTableDecorator::m_glRectiv_capture;
+this->m_orig_glColorP4ui = this->m_ptr_glColorP4ui;
+if(this->m_ptr_glColorP4ui)this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&CaptureTableDecorator::m_glColorP4ui_capture;
+this->m_orig_glUseProgramStages = this->m_ptr_glUseProgramStages;
+if(this->m_ptr_glUseProgramStages)this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&CaptureTableDecorator::m_glUseProgramStages_capture;
+this->m_orig_glRasterPos3dv = this->m_ptr_glRasterPos3dv;
+if(this->m_ptr_glRasterPos3dv)this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&CaptureTableDecorator::m_glRasterPos3dv_capture;
+this->m_orig_glPathTexGenNV = this->m_ptr_glPathTexGenNV;
+if(this->m_ptr_glPathTexGenNV)this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&CaptureTableDecorator::m_glPathTexGenNV_capture;
+this->m_orig_glVertexBlendEnviATI = this->m_ptr_glVertexBlendEnviATI;
+if(this->m_ptr_glVertexBlendEnviATI)this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&CaptureTableDecorator::m_glVertexBlendEnviATI_capture;
+this->m_orig_glUniform3i64ARB = this->m_ptr_glUniform3i64ARB;
+if(this->m_ptr_glUniform3i64ARB)this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&CaptureTableDecorator::m_glUniform3i64ARB_capture;
+this->m_orig_glLoadMatrixf = this->m_ptr_glLoadMatrixf;
+if(this->m_ptr_glLoadMatrixf)this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&CaptureTableDecorator::m_glLoadMatrixf_capture;
+this->m_orig_glProgramUniform2dEXT = this->m_ptr_glProgramUniform2dEXT;
+if(this->m_ptr_glProgramUniform2dEXT)this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&CaptureTableDecorator::m_glProgramUniform2dEXT_capture;
+this->m_orig_glVertexAttribI4iv = this->m_ptr_glVertexAttribI4iv;
+if(this->m_ptr_glVertexAttribI4iv)this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&CaptureTableDecorator::m_glVertexAttribI4iv_capture;
+this->m_orig_glNamedFramebufferDrawBuffer = this->m_ptr_glNamedFramebufferDrawBuffer;
+if(this->m_ptr_glNamedFramebufferDrawBuffer)this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&CaptureTableDecorator::m_glNamedFramebufferDrawBuffer_capture;
+this->m_orig_glColor4ubv = this->m_ptr_glColor4ubv;
+if(this->m_ptr_glColor4ubv)this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&CaptureTableDecorator::m_glColor4ubv_capture;
+this->m_orig_glColor3hvNV = this->m_ptr_glColor3hvNV;
+if(this->m_ptr_glColor3hvNV)this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&CaptureTableDecorator::m_glColor3hvNV_capture;
+this->m_orig_glGetMapAttribParameterfvNV = this->m_ptr_glGetMapAttribParameterfvNV;
+if(this->m_ptr_glGetMapAttribParameterfvNV)this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetMapAttribParameterfvNV_capture;
+this->m_orig_glGetBufferSubData = this->m_ptr_glGetBufferSubData;
+if(this->m_ptr_glGetBufferSubData)this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glGetBufferSubData_capture;
+this->m_orig_glGetVertexAttribLdv = this->m_ptr_glGetVertexAttribLdv;
+if(this->m_ptr_glGetVertexAttribLdv)this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&CaptureTableDecorator::m_glGetVertexAttribLdv_capture;
+this->m_orig_glGetnUniformuiv = this->m_ptr_glGetnUniformuiv;
+if(this->m_ptr_glGetnUniformuiv)this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&CaptureTableDecorator::m_glGetnUniformuiv_capture;
+this->m_orig_glGetUniformui64vNV = this->m_ptr_glGetUniformui64vNV;
+if(this->m_ptr_glGetUniformui64vNV)this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&CaptureTableDecorator::m_glGetUniformui64vNV_capture;
+this->m_orig_glNamedRenderbufferStorageEXT = this->m_ptr_glNamedRenderbufferStorageEXT;
+if(this->m_ptr_glNamedRenderbufferStorageEXT)this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&CaptureTableDecorator::m_glNamedRenderbufferStorageEXT_capture;
+this->m_orig_glVertexAttrib3dNV = this->m_ptr_glVertexAttrib3dNV;
+if(this->m_ptr_glVertexAttrib3dNV)this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&CaptureTableDecorator::m_glVertexAttrib3dNV_capture;
+this->m_orig_glTextureStorage1DEXT = this->m_ptr_glTextureStorage1DEXT;
+if(this->m_ptr_glTextureStorage1DEXT)this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&CaptureTableDecorator::m_glTextureStorage1DEXT_capture;
+this->m_orig_glPixelTexGenParameteriSGIS = this->m_ptr_glPixelTexGenParameteriSGIS;
+if(this->m_ptr_glPixelTexGenParameteriSGIS)this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&CaptureTableDecorator::m_glPixelTexGenParameteriSGIS_capture;
+this->m_orig_glColorTableEXT = this->m_ptr_glColorTableEXT;
+if(this->m_ptr_glColorTableEXT)this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&CaptureTableDecorator::m_glColorTableEXT_capture;
+this->m_orig_glGenBuffers = this->m_ptr_glGenBuffers;
+if(this->m_ptr_glGenBuffers)this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&CaptureTableDecorator::m_glGenBuffers_capture;
+this->m_orig_glMultiTexCoord3xvOES = this->m_ptr_glMultiTexCoord3xvOES;
+if(this->m_ptr_glMultiTexCoord3xvOES)this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord3xvOES_capture;
+this->m_orig_glExecuteProgramNV = this->m_ptr_glExecuteProgramNV;
+if(this->m_ptr_glExecuteProgramNV)this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&CaptureTableDecorator::m_glExecuteProgramNV_capture;
+this->m_orig_glVariantArrayObjectATI = this->m_ptr_glVariantArrayObjectATI;
+if(this->m_ptr_glVariantArrayObjectATI)this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&CaptureTableDecorator::m_glVariantArrayObjectATI_capture;
+this->m_orig_glColor3xvOES = this->m_ptr_glColor3xvOES;
+if(this->m_ptr_glColor3xvOES)this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&CaptureTableDecorator::m_glColor3xvOES_capture;
+this->m_orig_glGetnConvolutionFilterARB = this->m_ptr_glGetnConvolutionFilterARB;
+if(this->m_ptr_glGetnConvolutionFilterARB)this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&CaptureTableDecorator::m_glGetnConvolutionFilterARB_capture;
+this->m_orig_glNormalFormatNV = this->m_ptr_glNormalFormatNV;
+if(this->m_ptr_glNormalFormatNV)this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&CaptureTableDecorator::m_glNormalFormatNV_capture;
+this->m_orig_glGetInvariantFloatvEXT = this->m_ptr_glGetInvariantFloatvEXT;
+if(this->m_ptr_glGetInvariantFloatvEXT)this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&CaptureTableDecorator::m_glGetInvariantFloatvEXT_capture;
+this->m_orig_glClearNamedFramebufferiv = this->m_ptr_glClearNamedFramebufferiv;
+if(this->m_ptr_glClearNamedFramebufferiv)this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&CaptureTableDecorator::m_glClearNamedFramebufferiv_capture;
+this->m_orig_glTexImage3D = this->m_ptr_glTexImage3D;
+if(this->m_ptr_glTexImage3D)this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&CaptureTableDecorator::m_glTexImage3D_capture;
+this->m_orig_glGenSamplers = this->m_ptr_glGenSamplers;
+if(this->m_ptr_glGenSamplers)this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&CaptureTableDecorator::m_glGenSamplers_capture;
+this->m_orig_glIsFramebuffer = this->m_ptr_glIsFramebuffer;
+if(this->m_ptr_glIsFramebuffer)this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&CaptureTableDecorator::m_glIsFramebuffer_capture;
+this->m_orig_glProgramUniform3dvEXT = this->m_ptr_glProgramUniform3dvEXT;
+if(this->m_ptr_glProgramUniform3dvEXT)this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&CaptureTableDecorator::m_glProgramUniform3dvEXT_capture;
+this->m_orig_glGetVertexAttribfvNV = this->m_ptr_glGetVertexAttribfvNV;
+if(this->m_ptr_glGetVertexAttribfvNV)this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&CaptureTableDecorator::m_glGetVertexAttribfvNV_capture;
+this->m_orig_glDrawRangeElementArrayAPPLE = this->m_ptr_glDrawRangeElementArrayAPPLE;
+if(this->m_ptr_glDrawRangeElementArrayAPPLE)this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&CaptureTableDecorator::m_glDrawRangeElementArrayAPPLE_capture;
+this->m_orig_glUniform3i64NV = this->m_ptr_glUniform3i64NV;
+if(this->m_ptr_glUniform3i64NV)this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&CaptureTableDecorator::m_glUniform3i64NV_capture;
+this->m_orig_glMatrixPopEXT = this->m_ptr_glMatrixPopEXT;
+if(this->m_ptr_glMatrixPopEXT)this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&CaptureTableDecorator::m_glMatrixPopEXT_capture;
+this->m_orig_glVertexStream1sATI = this->m_ptr_glVertexStream1sATI;
+if(this->m_ptr_glVertexStream1sATI)this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&CaptureTableDecorator::m_glVertexStream1sATI_capture;
+this->m_orig_glGetnPixelMapuivARB = this->m_ptr_glGetnPixelMapuivARB;
+if(this->m_ptr_glGetnPixelMapuivARB)this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&CaptureTableDecorator::m_glGetnPixelMapuivARB_capture;
+this->m_orig_glMultiTexEnviEXT = this->m_ptr_glMultiTexEnviEXT;
+if(this->m_ptr_glMultiTexEnviEXT)this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&CaptureTableDecorator::m_glMultiTexEnviEXT_capture;
+this->m_orig_glVertexAttribI2iEXT = this->m_ptr_glVertexAttribI2iEXT;
+if(this->m_ptr_glVertexAttribI2iEXT)this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&CaptureTableDecorator::m_glVertexAttribI2iEXT_capture;
+this->m_orig_glProgramParameter4fvNV = this->m_ptr_glProgramParameter4fvNV;
+if(this->m_ptr_glProgramParameter4fvNV)this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&CaptureTableDecorator::m_glProgramParameter4fvNV_capture;
+this->m_orig_glWaitSemaphoreEXT = this->m_ptr_glWaitSemaphoreEXT;
+if(this->m_ptr_glWaitSemaphoreEXT)this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&CaptureTableDecorator::m_glWaitSemaphoreEXT_capture;
+this->m_orig_glNamedFramebufferSampleLocationsfvNV = this->m_ptr_glNamedFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV)this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&CaptureTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_capture;
+this->m_orig_glTexCoordP4uiv = this->m_ptr_glTexCoordP4uiv;
+if(this->m_ptr_glTexCoordP4uiv)this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&CaptureTableDecorator::m_glTexCoordP4uiv_capture;
+this->m_orig_glRectxvOES = this->m_ptr_glRectxvOES;
+if(this->m_ptr_glRectxvOES)this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&CaptureTableDecorator::m_glRectxvOES_capture;
+this->m_orig_glGetVariantIntegervEXT = this->m_ptr_glGetVariantIntegervEXT;
+if(this->m_ptr_glGetVariantIntegervEXT)this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&CaptureTableDecorator::m_glGetVariantIntegervEXT_capture;
+this->m_orig_glDeleteLists = this->m_ptr_glDeleteLists;
+if(this->m_ptr_glDeleteLists)this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&CaptureTableDecorator::m_glDeleteLists_capture;
+this->m_orig_glTexGendv = this->m_ptr_glTexGendv;
+if(this->m_ptr_glTexGendv)this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&CaptureTableDecorator::m_glTexGendv_capture;
+this->m_orig_glVertexP2uiv = this->m_ptr_glVertexP2uiv;
+if(this->m_ptr_glVertexP2uiv)this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&CaptureTableDecorator::m_glVertexP2uiv_capture;
+this->m_orig_glGetPerfMonitorGroupsAMD = this->m_ptr_glGetPerfMonitorGroupsAMD;
+if(this->m_ptr_glGetPerfMonitorGroupsAMD)this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorGroupsAMD_capture;
+this->m_orig_glMultTransposeMatrixfARB = this->m_ptr_glMultTransposeMatrixfARB;
+if(this->m_ptr_glMultTransposeMatrixfARB)this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&CaptureTableDecorator::m_glMultTransposeMatrixfARB_capture;
+this->m_orig_glVertexAttribI2ivEXT = this->m_ptr_glVertexAttribI2ivEXT;
+if(this->m_ptr_glVertexAttribI2ivEXT)this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI2ivEXT_capture;
+this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_capture;
+this->m_orig_glDeleteStatesNV = this->m_ptr_glDeleteStatesNV;
+if(this->m_ptr_glDeleteStatesNV)this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&CaptureTableDecorator::m_glDeleteStatesNV_capture;
+this->m_orig_glGetBufferParameteri64v = this->m_ptr_glGetBufferParameteri64v;
+if(this->m_ptr_glGetBufferParameteri64v)this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&CaptureTableDecorator::m_glGetBufferParameteri64v_capture;
+this->m_orig_glProgramUniform4dv = this->m_ptr_glProgramUniform4dv;
+if(this->m_ptr_glProgramUniform4dv)this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&CaptureTableDecorator::m_glProgramUniform4dv_capture;
+this->m_orig_glEdgeFlagPointerEXT = this->m_ptr_glEdgeFlagPointerEXT;
+if(this->m_ptr_glEdgeFlagPointerEXT)this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&CaptureTableDecorator::m_glEdgeFlagPointerEXT_capture;
+this->m_orig_glVideoCaptureStreamParameterivNV = this->m_ptr_glVideoCaptureStreamParameterivNV;
+if(this->m_ptr_glVideoCaptureStreamParameterivNV)this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&CaptureTableDecorator::m_glVideoCaptureStreamParameterivNV_capture;
+this->m_orig_glVertexStream4iATI = this->m_ptr_glVertexStream4iATI;
+if(this->m_ptr_glVertexStream4iATI)this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&CaptureTableDecorator::m_glVertexStream4iATI_capture;
+this->m_orig_glVDPAUFiniNV = this->m_ptr_glVDPAUFiniNV;
+if(this->m_ptr_glVDPAUFiniNV)this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&CaptureTableDecorator::m_glVDPAUFiniNV_capture;
+this->m_orig_glMakeBufferNonResidentNV = this->m_ptr_glMakeBufferNonResidentNV;
+if(this->m_ptr_glMakeBufferNonResidentNV)this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeBufferNonResidentNV_capture;
+this->m_orig_glUniform1ui64ARB = this->m_ptr_glUniform1ui64ARB;
+if(this->m_ptr_glUniform1ui64ARB)this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&CaptureTableDecorator::m_glUniform1ui64ARB_capture;
+this->m_orig_glStencilStrokePathNV = this->m_ptr_glStencilStrokePathNV;
+if(this->m_ptr_glStencilStrokePathNV)this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&CaptureTableDecorator::m_glStencilStrokePathNV_capture;
+this->m_orig_glVariantuivEXT = this->m_ptr_glVariantuivEXT;
+if(this->m_ptr_glVariantuivEXT)this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&CaptureTableDecorator::m_glVariantuivEXT_capture;
+this->m_orig_glCopyTexSubImage3DEXT = this->m_ptr_glCopyTexSubImage3DEXT;
+if(this->m_ptr_glCopyTexSubImage3DEXT)this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCopyTexSubImage3DEXT_capture;
+this->m_orig_glSpriteParameteriSGIX = this->m_ptr_glSpriteParameteriSGIX;
+if(this->m_ptr_glSpriteParameteriSGIX)this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&CaptureTableDecorator::m_glSpriteParameteriSGIX_capture;
+this->m_orig_glMultiTexCoord1sARB = this->m_ptr_glMultiTexCoord1sARB;
+if(this->m_ptr_glMultiTexCoord1sARB)this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1sARB_capture;
+this->m_orig_glConvolutionParameterfv = this->m_ptr_glConvolutionParameterfv;
+if(this->m_ptr_glConvolutionParameterfv)this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&CaptureTableDecorator::m_glConvolutionParameterfv_capture;
+this->m_orig_glMakeTextureHandleResidentNV = this->m_ptr_glMakeTextureHandleResidentNV;
+if(this->m_ptr_glMakeTextureHandleResidentNV)this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&CaptureTableDecorator::m_glMakeTextureHandleResidentNV_capture;
+this->m_orig_glMultMatrixxOES = this->m_ptr_glMultMatrixxOES;
+if(this->m_ptr_glMultMatrixxOES)this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&CaptureTableDecorator::m_glMultMatrixxOES_capture;
+this->m_orig_glTextureNormalEXT = this->m_ptr_glTextureNormalEXT;
+if(this->m_ptr_glTextureNormalEXT)this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&CaptureTableDecorator::m_glTextureNormalEXT_capture;
+this->m_orig_glGetQueryivARB = this->m_ptr_glGetQueryivARB;
+if(this->m_ptr_glGetQueryivARB)this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&CaptureTableDecorator::m_glGetQueryivARB_capture;
+this->m_orig_glCompressedMultiTexImage3DEXT = this->m_ptr_glCompressedMultiTexImage3DEXT;
+if(this->m_ptr_glCompressedMultiTexImage3DEXT)this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexImage3DEXT_capture;
+this->m_orig_glGetInstrumentsSGIX = this->m_ptr_glGetInstrumentsSGIX;
+if(this->m_ptr_glGetInstrumentsSGIX)this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&CaptureTableDecorator::m_glGetInstrumentsSGIX_capture;
+this->m_orig_glProgramUniformMatrix4x3fvEXT = this->m_ptr_glProgramUniformMatrix4x3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT)this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x3fvEXT_capture;
+this->m_orig_glPointParameterf = this->m_ptr_glPointParameterf;
+if(this->m_ptr_glPointParameterf)this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&CaptureTableDecorator::m_glPointParameterf_capture;
+this->m_orig_glProgramUniform3dEXT = this->m_ptr_glProgramUniform3dEXT;
+if(this->m_ptr_glProgramUniform3dEXT)this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&CaptureTableDecorator::m_glProgramUniform3dEXT_capture;
+this->m_orig_glMultiTexCoord2hNV = this->m_ptr_glMultiTexCoord2hNV;
+if(this->m_ptr_glMultiTexCoord2hNV)this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&CaptureTableDecorator::m_glMultiTexCoord2hNV_capture;
+this->m_orig_glGetConvolutionFilterEXT = this->m_ptr_glGetConvolutionFilterEXT;
+if(this->m_ptr_glGetConvolutionFilterEXT)this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&CaptureTableDecorator::m_glGetConvolutionFilterEXT_capture;
+this->m_orig_glVertexAttrib2hNV = this->m_ptr_glVertexAttrib2hNV;
+if(this->m_ptr_glVertexAttrib2hNV)this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&CaptureTableDecorator::m_glVertexAttrib2hNV_capture;
+this->m_orig_glCurrentPaletteMatrixARB = this->m_ptr_glCurrentPaletteMatrixARB;
+if(this->m_ptr_glCurrentPaletteMatrixARB)this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&CaptureTableDecorator::m_glCurrentPaletteMatrixARB_capture;
+this->m_orig_glFogxvOES = this->m_ptr_glFogxvOES;
+if(this->m_ptr_glFogxvOES)this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&CaptureTableDecorator::m_glFogxvOES_capture;
+this->m_orig_glCreateRenderbuffers = this->m_ptr_glCreateRenderbuffers;
+if(this->m_ptr_glCreateRenderbuffers)this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&CaptureTableDecorator::m_glCreateRenderbuffers_capture;
+this->m_orig_glVertexAttrib4Nusv = this->m_ptr_glVertexAttrib4Nusv;
+if(this->m_ptr_glVertexAttrib4Nusv)this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&CaptureTableDecorator::m_glVertexAttrib4Nusv_capture;
+this->m_orig_glCombinerInputNV = this->m_ptr_glCombinerInputNV;
+if(this->m_ptr_glCombinerInputNV)this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&CaptureTableDecorator::m_glCombinerInputNV_capture;
+this->m_orig_glDepthFunc = this->m_ptr_glDepthFunc;
+if(this->m_ptr_glDepthFunc)this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&CaptureTableDecorator::m_glDepthFunc_capture;
+this->m_orig_glWindowPos4fMESA = this->m_ptr_glWindowPos4fMESA;
+if(this->m_ptr_glWindowPos4fMESA)this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&CaptureTableDecorator::m_glWindowPos4fMESA_capture;
+this->m_orig_glEnableClientStateIndexedEXT = this->m_ptr_glEnableClientStateIndexedEXT;
+if(this->m_ptr_glEnableClientStateIndexedEXT)this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&CaptureTableDecorator::m_glEnableClientStateIndexedEXT_capture;
+this->m_orig_glTexCoord4iv = this->m_ptr_glTexCoord4iv;
+if(this->m_ptr_glTexCoord4iv)this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&CaptureTableDecorator::m_glTexCoord4iv_capture;
+this->m_orig_glProgramUniform4i64ARB = this->m_ptr_glProgramUniform4i64ARB;
+if(this->m_ptr_glProgramUniform4i64ARB)this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&CaptureTableDecorator::m_glProgramUniform4i64ARB_capture;
+this->m_orig_glBlendFunci = this->m_ptr_glBlendFunci;
+if(this->m_ptr_glBlendFunci)this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&CaptureTableDecorator::m_glBlendFunci_capture;
+this->m_orig_glResolveDepthValuesNV = this->m_ptr_glResolveDepthValuesNV;
+if(this->m_ptr_glResolveDepthValuesNV)this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&CaptureTableDecorator::m_glResolveDepthValuesNV_capture;
+this->m_orig_glTextureColorMaskSGIS = this->m_ptr_glTextureColorMaskSGIS;
+if(this->m_ptr_glTextureColorMaskSGIS)this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&CaptureTableDecorator::m_glTextureColorMaskSGIS_capture;
+this->m_orig_glCreateShaderProgramEXT = this->m_ptr_glCreateShaderProgramEXT;
+if(this->m_ptr_glCreateShaderProgramEXT)this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&CaptureTableDecorator::m_glCreateShaderProgramEXT_capture;
+this->m_orig_glBufferStorage = this->m_ptr_glBufferStorage;
+if(this->m_ptr_glBufferStorage)this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&CaptureTableDecorator::m_glBufferStorage_capture;
+this->m_orig_glMakeNamedBufferNonResidentNV = this->m_ptr_glMakeNamedBufferNonResidentNV;
+if(this->m_ptr_glMakeNamedBufferNonResidentNV)this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeNamedBufferNonResidentNV_capture;
+this->m_orig_glRenderbufferStorageMultisampleEXT = this->m_ptr_glRenderbufferStorageMultisampleEXT;
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT)this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glRenderbufferStorageMultisampleEXT_capture;
+this->m_orig_glGetFloati_v = this->m_ptr_glGetFloati_v;
+if(this->m_ptr_glGetFloati_v)this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&CaptureTableDecorator::m_glGetFloati_v_capture;
+this->m_orig_glUniform2ui64ARB = this->m_ptr_glUniform2ui64ARB;
+if(this->m_ptr_glUniform2ui64ARB)this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&CaptureTableDecorator::m_glUniform2ui64ARB_capture;
+this->m_orig_glVertex3fv = this->m_ptr_glVertex3fv;
+if(this->m_ptr_glVertex3fv)this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&CaptureTableDecorator::m_glVertex3fv_capture;
+this->m_orig_glGetUniformLocation = this->m_ptr_glGetUniformLocation;
+if(this->m_ptr_glGetUniformLocation)this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&CaptureTableDecorator::m_glGetUniformLocation_capture;
+this->m_orig_glVertexStream1svATI = this->m_ptr_glVertexStream1svATI;
+if(this->m_ptr_glVertexStream1svATI)this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&CaptureTableDecorator::m_glVertexStream1svATI_capture;
+this->m_orig_glVertexStream3fATI = this->m_ptr_glVertexStream3fATI;
+if(this->m_ptr_glVertexStream3fATI)this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&CaptureTableDecorator::m_glVertexStream3fATI_capture;
+this->m_orig_glNamedFramebufferDrawBuffers = this->m_ptr_glNamedFramebufferDrawBuffers;
+if(this->m_ptr_glNamedFramebufferDrawBuffers)this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&CaptureTableDecorator::m_glNamedFramebufferDrawBuffers_capture;
+this->m_orig_glUniform2ui64vNV = this->m_ptr_glUniform2ui64vNV;
+if(this->m_ptr_glUniform2ui64vNV)this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&CaptureTableDecorator::m_glUniform2ui64vNV_capture;
+this->m_orig_glTexCoordPointervINTEL = this->m_ptr_glTexCoordPointervINTEL;
+if(this->m_ptr_glTexCoordPointervINTEL)this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&CaptureTableDecorator::m_glTexCoordPointervINTEL_capture;
+this->m_orig_glUniform4fv = this->m_ptr_glUniform4fv;
+if(this->m_ptr_glUniform4fv)this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&CaptureTableDecorator::m_glUniform4fv_capture;
+this->m_orig_glNormalPointerEXT = this->m_ptr_glNormalPointerEXT;
+if(this->m_ptr_glNormalPointerEXT)this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&CaptureTableDecorator::m_glNormalPointerEXT_capture;
+this->m_orig_glVertexAttrib4hNV = this->m_ptr_glVertexAttrib4hNV;
+if(this->m_ptr_glVertexAttrib4hNV)this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&CaptureTableDecorator::m_glVertexAttrib4hNV_capture;
+this->m_orig_glNormal3f = this->m_ptr_glNormal3f;
+if(this->m_ptr_glNormal3f)this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&CaptureTableDecorator::m_glNormal3f_capture;
+this->m_orig_glVertexStream2iATI = this->m_ptr_glVertexStream2iATI;
+if(this->m_ptr_glVertexStream2iATI)this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&CaptureTableDecorator::m_glVertexStream2iATI_capture;
+this->m_orig_glVertexAttribP4uiv = this->m_ptr_glVertexAttribP4uiv;
+if(this->m_ptr_glVertexAttribP4uiv)this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&CaptureTableDecorator::m_glVertexAttribP4uiv_capture;
+this->m_orig_glCompressedTextureSubImage3D = this->m_ptr_glCompressedTextureSubImage3D;
+if(this->m_ptr_glCompressedTextureSubImage3D)this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage3D_capture;
+this->m_orig_glAsyncMarkerSGIX = this->m_ptr_glAsyncMarkerSGIX;
+if(this->m_ptr_glAsyncMarkerSGIX)this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&CaptureTableDecorator::m_glAsyncMarkerSGIX_capture;
+this->m_orig_glTextureStorageSparseAMD = this->m_ptr_glTextureStorageSparseAMD;
+if(this->m_ptr_glTextureStorageSparseAMD)this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&CaptureTableDecorator::m_glTextureStorageSparseAMD_capture;
+this->m_orig_glGetConvolutionParameterivEXT = this->m_ptr_glGetConvolutionParameterivEXT;
+if(this->m_ptr_glGetConvolutionParameterivEXT)this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetConvolutionParameterivEXT_capture;
+this->m_orig_glEndPerfQueryINTEL = this->m_ptr_glEndPerfQueryINTEL;
+if(this->m_ptr_glEndPerfQueryINTEL)this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&CaptureTableDecorator::m_glEndPerfQueryINTEL_capture;
+this->m_orig_glFragmentLightModeliSGIX = this->m_ptr_glFragmentLightModeliSGIX;
+if(this->m_ptr_glFragmentLightModeliSGIX)this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&CaptureTableDecorator::m_glFragmentLightModeliSGIX_capture;
+this->m_orig_glPrioritizeTexturesEXT = this->m_ptr_glPrioritizeTexturesEXT;
+if(this->m_ptr_glPrioritizeTexturesEXT)this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&CaptureTableDecorator::m_glPrioritizeTexturesEXT_capture;
+this->m_orig_glEndConditionalRender = this->m_ptr_glEndConditionalRender;
+if(this->m_ptr_glEndConditionalRender)this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&CaptureTableDecorator::m_glEndConditionalRender_capture;
+this->m_orig_glEnableClientState = this->m_ptr_glEnableClientState;
+if(this->m_ptr_glEnableClientState)this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&CaptureTableDecorator::m_glEnableClientState_capture;
+this->m_orig_glResetHistogram = this->m_ptr_glResetHistogram;
+if(this->m_ptr_glResetHistogram)this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&CaptureTableDecorator::m_glResetHistogram_capture;
+this->m_orig_glGetOcclusionQueryivNV = this->m_ptr_glGetOcclusionQueryivNV;
+if(this->m_ptr_glGetOcclusionQueryivNV)this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&CaptureTableDecorator::m_glGetOcclusionQueryivNV_capture;
+this->m_orig_glUniform1uiEXT = this->m_ptr_glUniform1uiEXT;
+if(this->m_ptr_glUniform1uiEXT)this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&CaptureTableDecorator::m_glUniform1uiEXT_capture;
+this->m_orig_glMultiTexCoord2sv = this->m_ptr_glMultiTexCoord2sv;
+if(this->m_ptr_glMultiTexCoord2sv)this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&CaptureTableDecorator::m_glMultiTexCoord2sv_capture;
+this->m_orig_glTexSubImage2DEXT = this->m_ptr_glTexSubImage2DEXT;
+if(this->m_ptr_glTexSubImage2DEXT)this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glTexSubImage2DEXT_capture;
+this->m_orig_glProgramUniform2uiv = this->m_ptr_glProgramUniform2uiv;
+if(this->m_ptr_glProgramUniform2uiv)this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&CaptureTableDecorator::m_glProgramUniform2uiv_capture;
+this->m_orig_glMultiTexCoord2iARB = this->m_ptr_glMultiTexCoord2iARB;
+if(this->m_ptr_glMultiTexCoord2iARB)this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2iARB_capture;
+this->m_orig_glGetQueryObjectuiv = this->m_ptr_glGetQueryObjectuiv;
+if(this->m_ptr_glGetQueryObjectuiv)this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&CaptureTableDecorator::m_glGetQueryObjectuiv_capture;
+this->m_orig_glGenerateMultiTexMipmapEXT = this->m_ptr_glGenerateMultiTexMipmapEXT;
+if(this->m_ptr_glGenerateMultiTexMipmapEXT)this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&CaptureTableDecorator::m_glGenerateMultiTexMipmapEXT_capture;
+this->m_orig_glVertexAttrib4iv = this->m_ptr_glVertexAttrib4iv;
+if(this->m_ptr_glVertexAttrib4iv)this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&CaptureTableDecorator::m_glVertexAttrib4iv_capture;
+this->m_orig_glWindowPos3dvMESA = this->m_ptr_glWindowPos3dvMESA;
+if(this->m_ptr_glWindowPos3dvMESA)this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&CaptureTableDecorator::m_glWindowPos3dvMESA_capture;
+this->m_orig_glLabelObjectEXT = this->m_ptr_glLabelObjectEXT;
+if(this->m_ptr_glLabelObjectEXT)this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&CaptureTableDecorator::m_glLabelObjectEXT_capture;
+this->m_orig_glProgramUniform1uiv = this->m_ptr_glProgramUniform1uiv;
+if(this->m_ptr_glProgramUniform1uiv)this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&CaptureTableDecorator::m_glProgramUniform1uiv_capture;
+this->m_orig_glFramebufferTexture = this->m_ptr_glFramebufferTexture;
+if(this->m_ptr_glFramebufferTexture)this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&CaptureTableDecorator::m_glFramebufferTexture_capture;
+this->m_orig_glMultiTexEnvfEXT = this->m_ptr_glMultiTexEnvfEXT;
+if(this->m_ptr_glMultiTexEnvfEXT)this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&CaptureTableDecorator::m_glMultiTexEnvfEXT_capture;
+this->m_orig_glGetTexGendv = this->m_ptr_glGetTexGendv;
+if(this->m_ptr_glGetTexGendv)this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&CaptureTableDecorator::m_glGetTexGendv_capture;
+this->m_orig_glVertex4xOES = this->m_ptr_glVertex4xOES;
+if(this->m_ptr_glVertex4xOES)this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&CaptureTableDecorator::m_glVertex4xOES_capture;
+this->m_orig_glVertexAttribI2uivEXT = this->m_ptr_glVertexAttribI2uivEXT;
+if(this->m_ptr_glVertexAttribI2uivEXT)this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI2uivEXT_capture;
+this->m_orig_glNamedProgramLocalParameter4fvEXT = this->m_ptr_glNamedProgramLocalParameter4fvEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT)this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameter4fvEXT_capture;
+this->m_orig_glColor3usv = this->m_ptr_glColor3usv;
+if(this->m_ptr_glColor3usv)this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&CaptureTableDecorator::m_glColor3usv_capture;
+this->m_orig_glGetPixelTransformParameterfvEXT = this->m_ptr_glGetPixelTransformParameterfvEXT;
+if(this->m_ptr_glGetPixelTransformParameterfvEXT)this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetPixelTransformParameterfvEXT_capture;
+this->m_orig_glIndexxvOES = this->m_ptr_glIndexxvOES;
+if(this->m_ptr_glIndexxvOES)this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&CaptureTableDecorator::m_glIndexxvOES_capture;
+this->m_orig_glDepthMask = this->m_ptr_glDepthMask;
+if(this->m_ptr_glDepthMask)this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&CaptureTableDecorator::m_glDepthMask_capture;
+this->m_orig_glProgramUniformMatrix2x4fv = this->m_ptr_glProgramUniformMatrix2x4fv;
+if(this->m_ptr_glProgramUniformMatrix2x4fv)this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x4fv_capture;
+this->m_orig_glAreProgramsResidentNV = this->m_ptr_glAreProgramsResidentNV;
+if(this->m_ptr_glAreProgramsResidentNV)this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&CaptureTableDecorator::m_glAreProgramsResidentNV_capture;
+this->m_orig_glColorTable = this->m_ptr_glColorTable;
+if(this->m_ptr_glColorTable)this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&CaptureTableDecorator::m_glColorTable_capture;
+this->m_orig_glBeginQueryIndexed = this->m_ptr_glBeginQueryIndexed;
+if(this->m_ptr_glBeginQueryIndexed)this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&CaptureTableDecorator::m_glBeginQueryIndexed_capture;
+this->m_orig_glVertexStream1dvATI = this->m_ptr_glVertexStream1dvATI;
+if(this->m_ptr_glVertexStream1dvATI)this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&CaptureTableDecorator::m_glVertexStream1dvATI_capture;
+this->m_orig_glGetMultiTexEnvfvEXT = this->m_ptr_glGetMultiTexEnvfvEXT;
+if(this->m_ptr_glGetMultiTexEnvfvEXT)this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexEnvfvEXT_capture;
+this->m_orig_glDeleteFencesNV = this->m_ptr_glDeleteFencesNV;
+if(this->m_ptr_glDeleteFencesNV)this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&CaptureTableDecorator::m_glDeleteFencesNV_capture;
+this->m_orig_glVertexAttribs1dvNV = this->m_ptr_glVertexAttribs1dvNV;
+if(this->m_ptr_glVertexAttribs1dvNV)this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&CaptureTableDecorator::m_glVertexAttribs1dvNV_capture;
+this->m_orig_glBufferStorageExternalEXT = this->m_ptr_glBufferStorageExternalEXT;
+if(this->m_ptr_glBufferStorageExternalEXT)this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&CaptureTableDecorator::m_glBufferStorageExternalEXT_capture;
+this->m_orig_glVertexStream2sATI = this->m_ptr_glVertexStream2sATI;
+if(this->m_ptr_glVertexStream2sATI)this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&CaptureTableDecorator::m_glVertexStream2sATI_capture;
+this->m_orig_glGetnSeparableFilterARB = this->m_ptr_glGetnSeparableFilterARB;
+if(this->m_ptr_glGetnSeparableFilterARB)this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&CaptureTableDecorator::m_glGetnSeparableFilterARB_capture;
+this->m_orig_glProgramUniform2dv = this->m_ptr_glProgramUniform2dv;
+if(this->m_ptr_glProgramUniform2dv)this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&CaptureTableDecorator::m_glProgramUniform2dv_capture;
+this->m_orig_glActiveStencilFaceEXT = this->m_ptr_glActiveStencilFaceEXT;
+if(this->m_ptr_glActiveStencilFaceEXT)this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&CaptureTableDecorator::m_glActiveStencilFaceEXT_capture;
+this->m_orig_glProgramUniform4dEXT = this->m_ptr_glProgramUniform4dEXT;
+if(this->m_ptr_glProgramUniform4dEXT)this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&CaptureTableDecorator::m_glProgramUniform4dEXT_capture;
+this->m_orig_glPointSizexOES = this->m_ptr_glPointSizexOES;
+if(this->m_ptr_glPointSizexOES)this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&CaptureTableDecorator::m_glPointSizexOES_capture;
+this->m_orig_glRasterPos2sv = this->m_ptr_glRasterPos2sv;
+if(this->m_ptr_glRasterPos2sv)this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&CaptureTableDecorator::m_glRasterPos2sv_capture;
+this->m_orig_glBindParameterEXT = this->m_ptr_glBindParameterEXT;
+if(this->m_ptr_glBindParameterEXT)this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&CaptureTableDecorator::m_glBindParameterEXT_capture;
+this->m_orig_glTexCoord1sv = this->m_ptr_glTexCoord1sv;
+if(this->m_ptr_glTexCoord1sv)this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&CaptureTableDecorator::m_glTexCoord1sv_capture;
+this->m_orig_glBlendParameteriNV = this->m_ptr_glBlendParameteriNV;
+if(this->m_ptr_glBlendParameteriNV)this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&CaptureTableDecorator::m_glBlendParameteriNV_capture;
+this->m_orig_glNamedProgramLocalParameter4dvEXT = this->m_ptr_glNamedProgramLocalParameter4dvEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT)this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameter4dvEXT_capture;
+this->m_orig_glProgramUniformHandleui64NV = this->m_ptr_glProgramUniformHandleui64NV;
+if(this->m_ptr_glProgramUniformHandleui64NV)this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&CaptureTableDecorator::m_glProgramUniformHandleui64NV_capture;
+this->m_orig_glGetTextureParameterfvEXT = this->m_ptr_glGetTextureParameterfvEXT;
+if(this->m_ptr_glGetTextureParameterfvEXT)this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetTextureParameterfvEXT_capture;
+this->m_orig_glGetPathMetricsNV = this->m_ptr_glGetPathMetricsNV;
+if(this->m_ptr_glGetPathMetricsNV)this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&CaptureTableDecorator::m_glGetPathMetricsNV_capture;
+this->m_orig_glVertex2i = this->m_ptr_glVertex2i;
+if(this->m_ptr_glVertex2i)this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&CaptureTableDecorator::m_glVertex2i_capture;
+this->m_orig_glNewList = this->m_ptr_glNewList;
+if(this->m_ptr_glNewList)this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&CaptureTableDecorator::m_glNewList_capture;
+this->m_orig_glMatrixLoad3x3fNV = this->m_ptr_glMatrixLoad3x3fNV;
+if(this->m_ptr_glMatrixLoad3x3fNV)this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&CaptureTableDecorator::m_glMatrixLoad3x3fNV_capture;
+this->m_orig_glMultiTexCoord2fARB = this->m_ptr_glMultiTexCoord2fARB;
+if(this->m_ptr_glMultiTexCoord2fARB)this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2fARB_capture;
+this->m_orig_glWeightdvARB = this->m_ptr_glWeightdvARB;
+if(this->m_ptr_glWeightdvARB)this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&CaptureTableDecorator::m_glWeightdvARB_capture;
+this->m_orig_glIsTransformFeedbackNV = this->m_ptr_glIsTransformFeedbackNV;
+if(this->m_ptr_glIsTransformFeedbackNV)this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glIsTransformFeedbackNV_capture;
+this->m_orig_glVertexAttribDivisorARB = this->m_ptr_glVertexAttribDivisorARB;
+if(this->m_ptr_glVertexAttribDivisorARB)this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&CaptureTableDecorator::m_glVertexAttribDivisorARB_capture;
+this->m_orig_glSecondaryColorP3uiv = this->m_ptr_glSecondaryColorP3uiv;
+if(this->m_ptr_glSecondaryColorP3uiv)this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&CaptureTableDecorator::m_glSecondaryColorP3uiv_capture;
+this->m_orig_glGetnCompressedTexImageARB = this->m_ptr_glGetnCompressedTexImageARB;
+if(this->m_ptr_glGetnCompressedTexImageARB)this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&CaptureTableDecorator::m_glGetnCompressedTexImageARB_capture;
+this->m_orig_glGetIntegerv = this->m_ptr_glGetIntegerv;
+if(this->m_ptr_glGetIntegerv)this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&CaptureTableDecorator::m_glGetIntegerv_capture;
+this->m_orig_glMatrixLoaddEXT = this->m_ptr_glMatrixLoaddEXT;
+if(this->m_ptr_glMatrixLoaddEXT)this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&CaptureTableDecorator::m_glMatrixLoaddEXT_capture;
+this->m_orig_glGetPathLengthNV = this->m_ptr_glGetPathLengthNV;
+if(this->m_ptr_glGetPathLengthNV)this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&CaptureTableDecorator::m_glGetPathLengthNV_capture;
+this->m_orig_glProgramUniformMatrix3dv = this->m_ptr_glProgramUniformMatrix3dv;
+if(this->m_ptr_glProgramUniformMatrix3dv)this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3dv_capture;
+this->m_orig_glUniform4i64NV = this->m_ptr_glUniform4i64NV;
+if(this->m_ptr_glUniform4i64NV)this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&CaptureTableDecorator::m_glUniform4i64NV_capture;
+this->m_orig_glGetHistogramEXT = this->m_ptr_glGetHistogramEXT;
+if(this->m_ptr_glGetHistogramEXT)this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&CaptureTableDecorator::m_glGetHistogramEXT_capture;
+this->m_orig_glVertexAttrib4NuivARB = this->m_ptr_glVertexAttrib4NuivARB;
+if(this->m_ptr_glVertexAttrib4NuivARB)this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NuivARB_capture;
+this->m_orig_glMapGrid2xOES = this->m_ptr_glMapGrid2xOES;
+if(this->m_ptr_glMapGrid2xOES)this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&CaptureTableDecorator::m_glMapGrid2xOES_capture;
+this->m_orig_glTexImage2D = this->m_ptr_glTexImage2D;
+if(this->m_ptr_glTexImage2D)this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&CaptureTableDecorator::m_glTexImage2D_capture;
+this->m_orig_glWindowPos2fvARB = this->m_ptr_glWindowPos2fvARB;
+if(this->m_ptr_glWindowPos2fvARB)this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&CaptureTableDecorator::m_glWindowPos2fvARB_capture;
+this->m_orig_glEnableIndexedEXT = this->m_ptr_glEnableIndexedEXT;
+if(this->m_ptr_glEnableIndexedEXT)this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&CaptureTableDecorator::m_glEnableIndexedEXT_capture;
+this->m_orig_glTexCoord1bvOES = this->m_ptr_glTexCoord1bvOES;
+if(this->m_ptr_glTexCoord1bvOES)this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&CaptureTableDecorator::m_glTexCoord1bvOES_capture;
+this->m_orig_glDrawPixels = this->m_ptr_glDrawPixels;
+if(this->m_ptr_glDrawPixels)this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&CaptureTableDecorator::m_glDrawPixels_capture;
+this->m_orig_glMultMatrixd = this->m_ptr_glMultMatrixd;
+if(this->m_ptr_glMultMatrixd)this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&CaptureTableDecorator::m_glMultMatrixd_capture;
+this->m_orig_glMultMatrixf = this->m_ptr_glMultMatrixf;
+if(this->m_ptr_glMultMatrixf)this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&CaptureTableDecorator::m_glMultMatrixf_capture;
+this->m_orig_glReplacementCodePointerSUN = this->m_ptr_glReplacementCodePointerSUN;
+if(this->m_ptr_glReplacementCodePointerSUN)this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&CaptureTableDecorator::m_glReplacementCodePointerSUN_capture;
+this->m_orig_glLoadTransposeMatrixdARB = this->m_ptr_glLoadTransposeMatrixdARB;
+if(this->m_ptr_glLoadTransposeMatrixdARB)this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&CaptureTableDecorator::m_glLoadTransposeMatrixdARB_capture;
+this->m_orig_glVertexAttrib4Nubv = this->m_ptr_glVertexAttrib4Nubv;
+if(this->m_ptr_glVertexAttrib4Nubv)this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&CaptureTableDecorator::m_glVertexAttrib4Nubv_capture;
+this->m_orig_glVertexArrayVertexAttribIOffsetEXT = this->m_ptr_glVertexArrayVertexAttribIOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT)this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_capture;
+this->m_orig_glCompileShaderARB = this->m_ptr_glCompileShaderARB;
+if(this->m_ptr_glCompileShaderARB)this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&CaptureTableDecorator::m_glCompileShaderARB_capture;
+this->m_orig_glWindowPos3dMESA = this->m_ptr_glWindowPos3dMESA;
+if(this->m_ptr_glWindowPos3dMESA)this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&CaptureTableDecorator::m_glWindowPos3dMESA_capture;
+this->m_orig_glNormalStream3fvATI = this->m_ptr_glNormalStream3fvATI;
+if(this->m_ptr_glNormalStream3fvATI)this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&CaptureTableDecorator::m_glNormalStream3fvATI_capture;
+this->m_orig_glColor4usv = this->m_ptr_glColor4usv;
+if(this->m_ptr_glColor4usv)this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&CaptureTableDecorator::m_glColor4usv_capture;
+this->m_orig_glMapGrid1f = this->m_ptr_glMapGrid1f;
+if(this->m_ptr_glMapGrid1f)this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&CaptureTableDecorator::m_glMapGrid1f_capture;
+this->m_orig_glPolygonStipple = this->m_ptr_glPolygonStipple;
+if(this->m_ptr_glPolygonStipple)this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&CaptureTableDecorator::m_glPolygonStipple_capture;
+this->m_orig_glUniform4ui64ARB = this->m_ptr_glUniform4ui64ARB;
+if(this->m_ptr_glUniform4ui64ARB)this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&CaptureTableDecorator::m_glUniform4ui64ARB_capture;
+this->m_orig_glTextureRenderbufferEXT = this->m_ptr_glTextureRenderbufferEXT;
+if(this->m_ptr_glTextureRenderbufferEXT)this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glTextureRenderbufferEXT_capture;
+this->m_orig_glGetSubroutineUniformLocation = this->m_ptr_glGetSubroutineUniformLocation;
+if(this->m_ptr_glGetSubroutineUniformLocation)this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&CaptureTableDecorator::m_glGetSubroutineUniformLocation_capture;
+this->m_orig_glGetFramebufferParameteriv = this->m_ptr_glGetFramebufferParameteriv;
+if(this->m_ptr_glGetFramebufferParameteriv)this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetFramebufferParameteriv_capture;
+this->m_orig_glPixelMapusv = this->m_ptr_glPixelMapusv;
+if(this->m_ptr_glPixelMapusv)this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&CaptureTableDecorator::m_glPixelMapusv_capture;
+this->m_orig_glGetSamplerParameteriv = this->m_ptr_glGetSamplerParameteriv;
+if(this->m_ptr_glGetSamplerParameteriv)this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetSamplerParameteriv_capture;
+this->m_orig_glVertexStream2fvATI = this->m_ptr_glVertexStream2fvATI;
+if(this->m_ptr_glVertexStream2fvATI)this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&CaptureTableDecorator::m_glVertexStream2fvATI_capture;
+this->m_orig_glProgramStringARB = this->m_ptr_glProgramStringARB;
+if(this->m_ptr_glProgramStringARB)this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&CaptureTableDecorator::m_glProgramStringARB_capture;
+this->m_orig_glProgramUniformMatrix3dvEXT = this->m_ptr_glProgramUniformMatrix3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3dvEXT)this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3dvEXT_capture;
+this->m_orig_glSeparableFilter2D = this->m_ptr_glSeparableFilter2D;
+if(this->m_ptr_glSeparableFilter2D)this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&CaptureTableDecorator::m_glSeparableFilter2D_capture;
+this->m_orig_glVertexAttribI1uiv = this->m_ptr_glVertexAttribI1uiv;
+if(this->m_ptr_glVertexAttribI1uiv)this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&CaptureTableDecorator::m_glVertexAttribI1uiv_capture;
+this->m_orig_glLGPUCopyImageSubDataNVX = this->m_ptr_glLGPUCopyImageSubDataNVX;
+if(this->m_ptr_glLGPUCopyImageSubDataNVX)this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&CaptureTableDecorator::m_glLGPUCopyImageSubDataNVX_capture;
+this->m_orig_glTexStorage2D = this->m_ptr_glTexStorage2D;
+if(this->m_ptr_glTexStorage2D)this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&CaptureTableDecorator::m_glTexStorage2D_capture;
+this->m_orig_glColor3fv = this->m_ptr_glColor3fv;
+if(this->m_ptr_glColor3fv)this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&CaptureTableDecorator::m_glColor3fv_capture;
+this->m_orig_glGetMultiTexGendvEXT = this->m_ptr_glGetMultiTexGendvEXT;
+if(this->m_ptr_glGetMultiTexGendvEXT)this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexGendvEXT_capture;
+this->m_orig_glVertexAttribL4dvEXT = this->m_ptr_glVertexAttribL4dvEXT;
+if(this->m_ptr_glVertexAttribL4dvEXT)this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&CaptureTableDecorator::m_glVertexAttribL4dvEXT_capture;
+this->m_orig_glGetActiveUniform = this->m_ptr_glGetActiveUniform;
+if(this->m_ptr_glGetActiveUniform)this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&CaptureTableDecorator::m_glGetActiveUniform_capture;
+this->m_orig_glUniform2ui64vARB = this->m_ptr_glUniform2ui64vARB;
+if(this->m_ptr_glUniform2ui64vARB)this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&CaptureTableDecorator::m_glUniform2ui64vARB_capture;
+this->m_orig_glMakeNamedBufferResidentNV = this->m_ptr_glMakeNamedBufferResidentNV;
+if(this->m_ptr_glMakeNamedBufferResidentNV)this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeNamedBufferResidentNV_capture;
+this->m_orig_glPathGlyphIndexRangeNV = this->m_ptr_glPathGlyphIndexRangeNV;
+if(this->m_ptr_glPathGlyphIndexRangeNV)this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&CaptureTableDecorator::m_glPathGlyphIndexRangeNV_capture;
+this->m_orig_glColorPointer = this->m_ptr_glColorPointer;
+if(this->m_ptr_glColorPointer)this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&CaptureTableDecorator::m_glColorPointer_capture;
+this->m_orig_glProgramEnvParameterI4ivNV = this->m_ptr_glProgramEnvParameterI4ivNV;
+if(this->m_ptr_glProgramEnvParameterI4ivNV)this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&CaptureTableDecorator::m_glProgramEnvParameterI4ivNV_capture;
+this->m_orig_glMulticastGetQueryObjectui64vNV = this->m_ptr_glMulticastGetQueryObjectui64vNV;
+if(this->m_ptr_glMulticastGetQueryObjectui64vNV)this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&CaptureTableDecorator::m_glMulticastGetQueryObjectui64vNV_capture;
+this->m_orig_glMultiTexParameterfEXT = this->m_ptr_glMultiTexParameterfEXT;
+if(this->m_ptr_glMultiTexParameterfEXT)this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&CaptureTableDecorator::m_glMultiTexParameterfEXT_capture;
+this->m_orig_glNamedFramebufferTextureLayer = this->m_ptr_glNamedFramebufferTextureLayer;
+if(this->m_ptr_glNamedFramebufferTextureLayer)this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&CaptureTableDecorator::m_glNamedFramebufferTextureLayer_capture;
+this->m_orig_glGetVertexArrayIntegervEXT = this->m_ptr_glGetVertexArrayIntegervEXT;
+if(this->m_ptr_glGetVertexArrayIntegervEXT)this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&CaptureTableDecorator::m_glGetVertexArrayIntegervEXT_capture;
+this->m_orig_glVertexAttrib3dARB = this->m_ptr_glVertexAttrib3dARB;
+if(this->m_ptr_glVertexAttrib3dARB)this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&CaptureTableDecorator::m_glVertexAttrib3dARB_capture;
+this->m_orig_glVDPAUIsSurfaceNV = this->m_ptr_glVDPAUIsSurfaceNV;
+if(this->m_ptr_glVDPAUIsSurfaceNV)this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&CaptureTableDecorator::m_glVDPAUIsSurfaceNV_capture;
+this->m_orig_glMultiTexImage1DEXT = this->m_ptr_glMultiTexImage1DEXT;
+if(this->m_ptr_glMultiTexImage1DEXT)this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&CaptureTableDecorator::m_glMultiTexImage1DEXT_capture;
+this->m_orig_glIsAsyncMarkerSGIX = this->m_ptr_glIsAsyncMarkerSGIX;
+if(this->m_ptr_glIsAsyncMarkerSGIX)this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&CaptureTableDecorator::m_glIsAsyncMarkerSGIX_capture;
+this->m_orig_glGetDoublei_vEXT = this->m_ptr_glGetDoublei_vEXT;
+if(this->m_ptr_glGetDoublei_vEXT)this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&CaptureTableDecorator::m_glGetDoublei_vEXT_capture;
+this->m_orig_glUniform2i64NV = this->m_ptr_glUniform2i64NV;
+if(this->m_ptr_glUniform2i64NV)this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&CaptureTableDecorator::m_glUniform2i64NV_capture;
+this->m_orig_glIsCommandListNV = this->m_ptr_glIsCommandListNV;
+if(this->m_ptr_glIsCommandListNV)this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&CaptureTableDecorator::m_glIsCommandListNV_capture;
+this->m_orig_glUniform3uiEXT = this->m_ptr_glUniform3uiEXT;
+if(this->m_ptr_glUniform3uiEXT)this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&CaptureTableDecorator::m_glUniform3uiEXT_capture;
+this->m_orig_glTexParameterIuivEXT = this->m_ptr_glTexParameterIuivEXT;
+if(this->m_ptr_glTexParameterIuivEXT)this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glTexParameterIuivEXT_capture;
+this->m_orig_glProgramUniformMatrix4fv = this->m_ptr_glProgramUniformMatrix4fv;
+if(this->m_ptr_glProgramUniformMatrix4fv)this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4fv_capture;
+this->m_orig_glVertex2fv = this->m_ptr_glVertex2fv;
+if(this->m_ptr_glVertex2fv)this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&CaptureTableDecorator::m_glVertex2fv_capture;
+this->m_orig_glVertexAttribL3dEXT = this->m_ptr_glVertexAttribL3dEXT;
+if(this->m_ptr_glVertexAttribL3dEXT)this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&CaptureTableDecorator::m_glVertexAttribL3dEXT_capture;
+this->m_orig_glFramebufferRenderbuffer = this->m_ptr_glFramebufferRenderbuffer;
+if(this->m_ptr_glFramebufferRenderbuffer)this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&CaptureTableDecorator::m_glFramebufferRenderbuffer_capture;
+this->m_orig_glGetUniformLocationARB = this->m_ptr_glGetUniformLocationARB;
+if(this->m_ptr_glGetUniformLocationARB)this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&CaptureTableDecorator::m_glGetUniformLocationARB_capture;
+this->m_orig_glPathParameterfvNV = this->m_ptr_glPathParameterfvNV;
+if(this->m_ptr_glPathParameterfvNV)this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&CaptureTableDecorator::m_glPathParameterfvNV_capture;
+this->m_orig_glVertexAttrib3sNV = this->m_ptr_glVertexAttrib3sNV;
+if(this->m_ptr_glVertexAttrib3sNV)this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&CaptureTableDecorator::m_glVertexAttrib3sNV_capture;
+this->m_orig_glGetDoublei_v = this->m_ptr_glGetDoublei_v;
+if(this->m_ptr_glGetDoublei_v)this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&CaptureTableDecorator::m_glGetDoublei_v_capture;
+this->m_orig_glVertexAttrib1sv = this->m_ptr_glVertexAttrib1sv;
+if(this->m_ptr_glVertexAttrib1sv)this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&CaptureTableDecorator::m_glVertexAttrib1sv_capture;
+this->m_orig_glBindSampler = this->m_ptr_glBindSampler;
+if(this->m_ptr_glBindSampler)this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&CaptureTableDecorator::m_glBindSampler_capture;
+this->m_orig_glLineWidth = this->m_ptr_glLineWidth;
+if(this->m_ptr_glLineWidth)this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&CaptureTableDecorator::m_glLineWidth_capture;
+this->m_orig_glVertexArrayRangeAPPLE = this->m_ptr_glVertexArrayRangeAPPLE;
+if(this->m_ptr_glVertexArrayRangeAPPLE)this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&CaptureTableDecorator::m_glVertexArrayRangeAPPLE_capture;
+this->m_orig_glBindBufferOffsetEXT = this->m_ptr_glBindBufferOffsetEXT;
+if(this->m_ptr_glBindBufferOffsetEXT)this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&CaptureTableDecorator::m_glBindBufferOffsetEXT_capture;
+this->m_orig_glWeightfvARB = this->m_ptr_glWeightfvARB;
+if(this->m_ptr_glWeightfvARB)this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&CaptureTableDecorator::m_glWeightfvARB_capture;
+this->m_orig_glGetIntegeri_v = this->m_ptr_glGetIntegeri_v;
+if(this->m_ptr_glGetIntegeri_v)this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&CaptureTableDecorator::m_glGetIntegeri_v_capture;
+this->m_orig_glGetTransformFeedbackVarying = this->m_ptr_glGetTransformFeedbackVarying;
+if(this->m_ptr_glGetTransformFeedbackVarying)this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&CaptureTableDecorator::m_glGetTransformFeedbackVarying_capture;
+this->m_orig_glProgramLocalParameter4fvARB = this->m_ptr_glProgramLocalParameter4fvARB;
+if(this->m_ptr_glProgramLocalParameter4fvARB)this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&CaptureTableDecorator::m_glProgramLocalParameter4fvARB_capture;
+this->m_orig_glGetTransformFeedbackVaryingNV = this->m_ptr_glGetTransformFeedbackVaryingNV;
+if(this->m_ptr_glGetTransformFeedbackVaryingNV)this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&CaptureTableDecorator::m_glGetTransformFeedbackVaryingNV_capture;
+this->m_orig_glWindowPos2iv = this->m_ptr_glWindowPos2iv;
+if(this->m_ptr_glWindowPos2iv)this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&CaptureTableDecorator::m_glWindowPos2iv_capture;
+this->m_orig_glVertexStream1dATI = this->m_ptr_glVertexStream1dATI;
+if(this->m_ptr_glVertexStream1dATI)this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&CaptureTableDecorator::m_glVertexStream1dATI_capture;
+this->m_orig_glColorFragmentOp2ATI = this->m_ptr_glColorFragmentOp2ATI;
+if(this->m_ptr_glColorFragmentOp2ATI)this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&CaptureTableDecorator::m_glColorFragmentOp2ATI_capture;
+this->m_orig_glFogiv = this->m_ptr_glFogiv;
+if(this->m_ptr_glFogiv)this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&CaptureTableDecorator::m_glFogiv_capture;
+this->m_orig_glGetTextureHandleNV = this->m_ptr_glGetTextureHandleNV;
+if(this->m_ptr_glGetTextureHandleNV)this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&CaptureTableDecorator::m_glGetTextureHandleNV_capture;
+this->m_orig_glLightModeliv = this->m_ptr_glLightModeliv;
+if(this->m_ptr_glLightModeliv)this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&CaptureTableDecorator::m_glLightModeliv_capture;
+this->m_orig_glDepthRangef = this->m_ptr_glDepthRangef;
+if(this->m_ptr_glDepthRangef)this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&CaptureTableDecorator::m_glDepthRangef_capture;
+this->m_orig_glGetFragmentMaterialivSGIX = this->m_ptr_glGetFragmentMaterialivSGIX;
+if(this->m_ptr_glGetFragmentMaterialivSGIX)this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&CaptureTableDecorator::m_glGetFragmentMaterialivSGIX_capture;
+this->m_orig_glVideoCaptureStreamParameterfvNV = this->m_ptr_glVideoCaptureStreamParameterfvNV;
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV)this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&CaptureTableDecorator::m_glVideoCaptureStreamParameterfvNV_capture;
+this->m_orig_glDeleteProgramsARB = this->m_ptr_glDeleteProgramsARB;
+if(this->m_ptr_glDeleteProgramsARB)this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&CaptureTableDecorator::m_glDeleteProgramsARB_capture;
+this->m_orig_glWindowPos3fvARB = this->m_ptr_glWindowPos3fvARB;
+if(this->m_ptr_glWindowPos3fvARB)this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&CaptureTableDecorator::m_glWindowPos3fvARB_capture;
+this->m_orig_glFeedbackBufferxOES = this->m_ptr_glFeedbackBufferxOES;
+if(this->m_ptr_glFeedbackBufferxOES)this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&CaptureTableDecorator::m_glFeedbackBufferxOES_capture;
+this->m_orig_glGetTexBumpParameterfvATI = this->m_ptr_glGetTexBumpParameterfvATI;
+if(this->m_ptr_glGetTexBumpParameterfvATI)this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&CaptureTableDecorator::m_glGetTexBumpParameterfvATI_capture;
+this->m_orig_glEnablei = this->m_ptr_glEnablei;
+if(this->m_ptr_glEnablei)this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&CaptureTableDecorator::m_glEnablei_capture;
+this->m_orig_glGetActiveSubroutineName = this->m_ptr_glGetActiveSubroutineName;
+if(this->m_ptr_glGetActiveSubroutineName)this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&CaptureTableDecorator::m_glGetActiveSubroutineName_capture;
+this->m_orig_glDrawBuffersARB = this->m_ptr_glDrawBuffersARB;
+if(this->m_ptr_glDrawBuffersARB)this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&CaptureTableDecorator::m_glDrawBuffersARB_capture;
+this->m_orig_glBindProgramARB = this->m_ptr_glBindProgramARB;
+if(this->m_ptr_glBindProgramARB)this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&CaptureTableDecorator::m_glBindProgramARB_capture;
+this->m_orig_glEvalCoord1fv = this->m_ptr_glEvalCoord1fv;
+if(this->m_ptr_glEvalCoord1fv)this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&CaptureTableDecorator::m_glEvalCoord1fv_capture;
+this->m_orig_glProgramUniform3ui64vARB = this->m_ptr_glProgramUniform3ui64vARB;
+if(this->m_ptr_glProgramUniform3ui64vARB)this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&CaptureTableDecorator::m_glProgramUniform3ui64vARB_capture;
+this->m_orig_glProgramUniformMatrix2dv = this->m_ptr_glProgramUniformMatrix2dv;
+if(this->m_ptr_glProgramUniformMatrix2dv)this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2dv_capture;
+this->m_orig_glMultiTexCoord2hvNV = this->m_ptr_glMultiTexCoord2hvNV;
+if(this->m_ptr_glMultiTexCoord2hvNV)this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&CaptureTableDecorator::m_glMultiTexCoord2hvNV_capture;
+this->m_orig_glGetFloatIndexedvEXT = this->m_ptr_glGetFloatIndexedvEXT;
+if(this->m_ptr_glGetFloatIndexedvEXT)this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&CaptureTableDecorator::m_glGetFloatIndexedvEXT_capture;
+this->m_orig_glSampleCoverageARB = this->m_ptr_glSampleCoverageARB;
+if(this->m_ptr_glSampleCoverageARB)this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&CaptureTableDecorator::m_glSampleCoverageARB_capture;
+this->m_orig_glProgramUniform2ui64vARB = this->m_ptr_glProgramUniform2ui64vARB;
+if(this->m_ptr_glProgramUniform2ui64vARB)this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&CaptureTableDecorator::m_glProgramUniform2ui64vARB_capture;
+this->m_orig_glPixelDataRangeNV = this->m_ptr_glPixelDataRangeNV;
+if(this->m_ptr_glPixelDataRangeNV)this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&CaptureTableDecorator::m_glPixelDataRangeNV_capture;
+this->m_orig_glVertexStream3svATI = this->m_ptr_glVertexStream3svATI;
+if(this->m_ptr_glVertexStream3svATI)this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&CaptureTableDecorator::m_glVertexStream3svATI_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_capture;
+this->m_orig_glTexCoord3hvNV = this->m_ptr_glTexCoord3hvNV;
+if(this->m_ptr_glTexCoord3hvNV)this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&CaptureTableDecorator::m_glTexCoord3hvNV_capture;
+this->m_orig_glSampleMaski = this->m_ptr_glSampleMaski;
+if(this->m_ptr_glSampleMaski)this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&CaptureTableDecorator::m_glSampleMaski_capture;
+this->m_orig_glIndexFuncEXT = this->m_ptr_glIndexFuncEXT;
+if(this->m_ptr_glIndexFuncEXT)this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&CaptureTableDecorator::m_glIndexFuncEXT_capture;
+this->m_orig_glPointParameteriNV = this->m_ptr_glPointParameteriNV;
+if(this->m_ptr_glPointParameteriNV)this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&CaptureTableDecorator::m_glPointParameteriNV_capture;
+this->m_orig_glUniformMatrix3x2fv = this->m_ptr_glUniformMatrix3x2fv;
+if(this->m_ptr_glUniformMatrix3x2fv)this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&CaptureTableDecorator::m_glUniformMatrix3x2fv_capture;
+this->m_orig_glGetFramebufferParameterivEXT = this->m_ptr_glGetFramebufferParameterivEXT;
+if(this->m_ptr_glGetFramebufferParameterivEXT)this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetFramebufferParameterivEXT_capture;
+this->m_orig_glUniform2i64ARB = this->m_ptr_glUniform2i64ARB;
+if(this->m_ptr_glUniform2i64ARB)this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&CaptureTableDecorator::m_glUniform2i64ARB_capture;
+this->m_orig_glNamedBufferStorageEXT = this->m_ptr_glNamedBufferStorageEXT;
+if(this->m_ptr_glNamedBufferStorageEXT)this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&CaptureTableDecorator::m_glNamedBufferStorageEXT_capture;
+this->m_orig_glNamedFramebufferTexture3DEXT = this->m_ptr_glNamedFramebufferTexture3DEXT;
+if(this->m_ptr_glNamedFramebufferTexture3DEXT)this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTexture3DEXT_capture;
+this->m_orig_glVertexAttrib2dv = this->m_ptr_glVertexAttrib2dv;
+if(this->m_ptr_glVertexAttrib2dv)this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&CaptureTableDecorator::m_glVertexAttrib2dv_capture;
+this->m_orig_glGetVertexArrayPointervEXT = this->m_ptr_glGetVertexArrayPointervEXT;
+if(this->m_ptr_glGetVertexArrayPointervEXT)this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&CaptureTableDecorator::m_glGetVertexArrayPointervEXT_capture;
+this->m_orig_glGetVertexAttribArrayObjectivATI = this->m_ptr_glGetVertexAttribArrayObjectivATI;
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI)this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&CaptureTableDecorator::m_glGetVertexAttribArrayObjectivATI_capture;
+this->m_orig_glProgramUniformMatrix3fvEXT = this->m_ptr_glProgramUniformMatrix3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3fvEXT)this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3fvEXT_capture;
+this->m_orig_glEnableVertexArrayEXT = this->m_ptr_glEnableVertexArrayEXT;
+if(this->m_ptr_glEnableVertexArrayEXT)this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&CaptureTableDecorator::m_glEnableVertexArrayEXT_capture;
+this->m_orig_glColorTableParameterfvSGI = this->m_ptr_glColorTableParameterfvSGI;
+if(this->m_ptr_glColorTableParameterfvSGI)this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&CaptureTableDecorator::m_glColorTableParameterfvSGI_capture;
+this->m_orig_glEdgeFlag = this->m_ptr_glEdgeFlag;
+if(this->m_ptr_glEdgeFlag)this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&CaptureTableDecorator::m_glEdgeFlag_capture;
+this->m_orig_glFogCoordf = this->m_ptr_glFogCoordf;
+if(this->m_ptr_glFogCoordf)this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&CaptureTableDecorator::m_glFogCoordf_capture;
+this->m_orig_glVertex3d = this->m_ptr_glVertex3d;
+if(this->m_ptr_glVertex3d)this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&CaptureTableDecorator::m_glVertex3d_capture;
+this->m_orig_glVertex3f = this->m_ptr_glVertex3f;
+if(this->m_ptr_glVertex3f)this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&CaptureTableDecorator::m_glVertex3f_capture;
+this->m_orig_glSpriteParameterivSGIX = this->m_ptr_glSpriteParameterivSGIX;
+if(this->m_ptr_glSpriteParameterivSGIX)this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&CaptureTableDecorator::m_glSpriteParameterivSGIX_capture;
+this->m_orig_glPathGlyphRangeNV = this->m_ptr_glPathGlyphRangeNV;
+if(this->m_ptr_glPathGlyphRangeNV)this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&CaptureTableDecorator::m_glPathGlyphRangeNV_capture;
+this->m_orig_glPrimitiveBoundingBoxARB = this->m_ptr_glPrimitiveBoundingBoxARB;
+if(this->m_ptr_glPrimitiveBoundingBoxARB)this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&CaptureTableDecorator::m_glPrimitiveBoundingBoxARB_capture;
+this->m_orig_glVertexAttribL3ui64vNV = this->m_ptr_glVertexAttribL3ui64vNV;
+if(this->m_ptr_glVertexAttribL3ui64vNV)this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL3ui64vNV_capture;
+this->m_orig_glVertex3s = this->m_ptr_glVertex3s;
+if(this->m_ptr_glVertex3s)this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&CaptureTableDecorator::m_glVertex3s_capture;
+this->m_orig_glTexCoordP2ui = this->m_ptr_glTexCoordP2ui;
+if(this->m_ptr_glTexCoordP2ui)this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&CaptureTableDecorator::m_glTexCoordP2ui_capture;
+this->m_orig_glProgramUniform2fvEXT = this->m_ptr_glProgramUniform2fvEXT;
+if(this->m_ptr_glProgramUniform2fvEXT)this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&CaptureTableDecorator::m_glProgramUniform2fvEXT_capture;
+this->m_orig_glDeletePathsNV = this->m_ptr_glDeletePathsNV;
+if(this->m_ptr_glDeletePathsNV)this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&CaptureTableDecorator::m_glDeletePathsNV_capture;
+this->m_orig_glPrimitiveRestartIndexNV = this->m_ptr_glPrimitiveRestartIndexNV;
+if(this->m_ptr_glPrimitiveRestartIndexNV)this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&CaptureTableDecorator::m_glPrimitiveRestartIndexNV_capture;
+this->m_orig_glTexCoord2fColor3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_capture;
+this->m_orig_glTexCoordPointerListIBM = this->m_ptr_glTexCoordPointerListIBM;
+if(this->m_ptr_glTexCoordPointerListIBM)this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glTexCoordPointerListIBM_capture;
+this->m_orig_glRectxOES = this->m_ptr_glRectxOES;
+if(this->m_ptr_glRectxOES)this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&CaptureTableDecorator::m_glRectxOES_capture;
+this->m_orig_glCopyNamedBufferSubData = this->m_ptr_glCopyNamedBufferSubData;
+if(this->m_ptr_glCopyNamedBufferSubData)this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glCopyNamedBufferSubData_capture;
+this->m_orig_glGenProgramsNV = this->m_ptr_glGenProgramsNV;
+if(this->m_ptr_glGenProgramsNV)this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&CaptureTableDecorator::m_glGenProgramsNV_capture;
+this->m_orig_glFragmentLightfSGIX = this->m_ptr_glFragmentLightfSGIX;
+if(this->m_ptr_glFragmentLightfSGIX)this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&CaptureTableDecorator::m_glFragmentLightfSGIX_capture;
+this->m_orig_glTexStorage3D = this->m_ptr_glTexStorage3D;
+if(this->m_ptr_glTexStorage3D)this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&CaptureTableDecorator::m_glTexStorage3D_capture;
+this->m_orig_glTextureParameteriv = this->m_ptr_glTextureParameteriv;
+if(this->m_ptr_glTextureParameteriv)this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&CaptureTableDecorator::m_glTextureParameteriv_capture;
+this->m_orig_glNamedBufferDataEXT = this->m_ptr_glNamedBufferDataEXT;
+if(this->m_ptr_glNamedBufferDataEXT)this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&CaptureTableDecorator::m_glNamedBufferDataEXT_capture;
+this->m_orig_glImportSemaphoreWin32NameEXT = this->m_ptr_glImportSemaphoreWin32NameEXT;
+if(this->m_ptr_glImportSemaphoreWin32NameEXT)this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&CaptureTableDecorator::m_glImportSemaphoreWin32NameEXT_capture;
+this->m_orig_glMultiTexCoord3fvARB = this->m_ptr_glMultiTexCoord3fvARB;
+if(this->m_ptr_glMultiTexCoord3fvARB)this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3fvARB_capture;
+this->m_orig_glUniformMatrix3x4fv = this->m_ptr_glUniformMatrix3x4fv;
+if(this->m_ptr_glUniformMatrix3x4fv)this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&CaptureTableDecorator::m_glUniformMatrix3x4fv_capture;
+this->m_orig_glSubpixelPrecisionBiasNV = this->m_ptr_glSubpixelPrecisionBiasNV;
+if(this->m_ptr_glSubpixelPrecisionBiasNV)this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&CaptureTableDecorator::m_glSubpixelPrecisionBiasNV_capture;
+this->m_orig_glNormalPointer = this->m_ptr_glNormalPointer;
+if(this->m_ptr_glNormalPointer)this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&CaptureTableDecorator::m_glNormalPointer_capture;
+this->m_orig_glNamedFramebufferTexture = this->m_ptr_glNamedFramebufferTexture;
+if(this->m_ptr_glNamedFramebufferTexture)this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&CaptureTableDecorator::m_glNamedFramebufferTexture_capture;
+this->m_orig_glVertexAttrib4NsvARB = this->m_ptr_glVertexAttrib4NsvARB;
+if(this->m_ptr_glVertexAttrib4NsvARB)this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NsvARB_capture;
+this->m_orig_glPassThrough = this->m_ptr_glPassThrough;
+if(this->m_ptr_glPassThrough)this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&CaptureTableDecorator::m_glPassThrough_capture;
+this->m_orig_glSecondaryColorP3ui = this->m_ptr_glSecondaryColorP3ui;
+if(this->m_ptr_glSecondaryColorP3ui)this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&CaptureTableDecorator::m_glSecondaryColorP3ui_capture;
+this->m_orig_glInvalidateTexSubImage = this->m_ptr_glInvalidateTexSubImage;
+if(this->m_ptr_glInvalidateTexSubImage)this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&CaptureTableDecorator::m_glInvalidateTexSubImage_capture;
+this->m_orig_glIsImageHandleResidentARB = this->m_ptr_glIsImageHandleResidentARB;
+if(this->m_ptr_glIsImageHandleResidentARB)this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&CaptureTableDecorator::m_glIsImageHandleResidentARB_capture;
+this->m_orig_glTangent3fvEXT = this->m_ptr_glTangent3fvEXT;
+if(this->m_ptr_glTangent3fvEXT)this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&CaptureTableDecorator::m_glTangent3fvEXT_capture;
+this->m_orig_glProgramUniformMatrix4x3fv = this->m_ptr_glProgramUniformMatrix4x3fv;
+if(this->m_ptr_glProgramUniformMatrix4x3fv)this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x3fv_capture;
+this->m_orig_glBegin = this->m_ptr_glBegin;
+if(this->m_ptr_glBegin)this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&CaptureTableDecorator::m_glBegin_capture;
+this->m_orig_glEvalCoord2dv = this->m_ptr_glEvalCoord2dv;
+if(this->m_ptr_glEvalCoord2dv)this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&CaptureTableDecorator::m_glEvalCoord2dv_capture;
+this->m_orig_glColor3ubv = this->m_ptr_glColor3ubv;
+if(this->m_ptr_glColor3ubv)this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&CaptureTableDecorator::m_glColor3ubv_capture;
+this->m_orig_glFogCoordfvEXT = this->m_ptr_glFogCoordfvEXT;
+if(this->m_ptr_glFogCoordfvEXT)this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&CaptureTableDecorator::m_glFogCoordfvEXT_capture;
+this->m_orig_glVertexP3ui = this->m_ptr_glVertexP3ui;
+if(this->m_ptr_glVertexP3ui)this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&CaptureTableDecorator::m_glVertexP3ui_capture;
+this->m_orig_glLightfv = this->m_ptr_glLightfv;
+if(this->m_ptr_glLightfv)this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&CaptureTableDecorator::m_glLightfv_capture;
+this->m_orig_glVertexAttribL3i64NV = this->m_ptr_glVertexAttribL3i64NV;
+if(this->m_ptr_glVertexAttribL3i64NV)this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&CaptureTableDecorator::m_glVertexAttribL3i64NV_capture;
+this->m_orig_glStencilClearTagEXT = this->m_ptr_glStencilClearTagEXT;
+if(this->m_ptr_glStencilClearTagEXT)this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&CaptureTableDecorator::m_glStencilClearTagEXT_capture;
+this->m_orig_glGetActiveUniformName = this->m_ptr_glGetActiveUniformName;
+if(this->m_ptr_glGetActiveUniformName)this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&CaptureTableDecorator::m_glGetActiveUniformName_capture;
+this->m_orig_glTangentPointerEXT = this->m_ptr_glTangentPointerEXT;
+if(this->m_ptr_glTangentPointerEXT)this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&CaptureTableDecorator::m_glTangentPointerEXT_capture;
+this->m_orig_glUniform4ui64vNV = this->m_ptr_glUniform4ui64vNV;
+if(this->m_ptr_glUniform4ui64vNV)this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&CaptureTableDecorator::m_glUniform4ui64vNV_capture;
+this->m_orig_glDebugMessageEnableAMD = this->m_ptr_glDebugMessageEnableAMD;
+if(this->m_ptr_glDebugMessageEnableAMD)this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&CaptureTableDecorator::m_glDebugMessageEnableAMD_capture;
+this->m_orig_glProgramUniform2ui = this->m_ptr_glProgramUniform2ui;
+if(this->m_ptr_glProgramUniform2ui)this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&CaptureTableDecorator::m_glProgramUniform2ui_capture;
+this->m_orig_glCopyTexSubImage2DEXT = this->m_ptr_glCopyTexSubImage2DEXT;
+if(this->m_ptr_glCopyTexSubImage2DEXT)this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyTexSubImage2DEXT_capture;
+this->m_orig_glGenRenderbuffersEXT = this->m_ptr_glGenRenderbuffersEXT;
+if(this->m_ptr_glGenRenderbuffersEXT)this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&CaptureTableDecorator::m_glGenRenderbuffersEXT_capture;
+this->m_orig_glNamedProgramLocalParameterI4ivEXT = this->m_ptr_glNamedProgramLocalParameterI4ivEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT)this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_capture;
+this->m_orig_glMultiTexCoord2f = this->m_ptr_glMultiTexCoord2f;
+if(this->m_ptr_glMultiTexCoord2f)this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&CaptureTableDecorator::m_glMultiTexCoord2f_capture;
+this->m_orig_glMapGrid2d = this->m_ptr_glMapGrid2d;
+if(this->m_ptr_glMapGrid2d)this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&CaptureTableDecorator::m_glMapGrid2d_capture;
+this->m_orig_glGetMultiTexParameterIuivEXT = this->m_ptr_glGetMultiTexParameterIuivEXT;
+if(this->m_ptr_glGetMultiTexParameterIuivEXT)this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexParameterIuivEXT_capture;
+this->m_orig_glBlendEquationiARB = this->m_ptr_glBlendEquationiARB;
+if(this->m_ptr_glBlendEquationiARB)this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&CaptureTableDecorator::m_glBlendEquationiARB_capture;
+this->m_orig_glTexParameteriv = this->m_ptr_glTexParameteriv;
+if(this->m_ptr_glTexParameteriv)this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&CaptureTableDecorator::m_glTexParameteriv_capture;
+this->m_orig_glUniform4ivARB = this->m_ptr_glUniform4ivARB;
+if(this->m_ptr_glUniform4ivARB)this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&CaptureTableDecorator::m_glUniform4ivARB_capture;
+this->m_orig_glMatrixOrthoEXT = this->m_ptr_glMatrixOrthoEXT;
+if(this->m_ptr_glMatrixOrthoEXT)this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&CaptureTableDecorator::m_glMatrixOrthoEXT_capture;
+this->m_orig_glVertexArrayVertexBuffer = this->m_ptr_glVertexArrayVertexBuffer;
+if(this->m_ptr_glVertexArrayVertexBuffer)this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&CaptureTableDecorator::m_glVertexArrayVertexBuffer_capture;
+this->m_orig_glProgramLocalParametersI4ivNV = this->m_ptr_glProgramLocalParametersI4ivNV;
+if(this->m_ptr_glProgramLocalParametersI4ivNV)this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&CaptureTableDecorator::m_glProgramLocalParametersI4ivNV_capture;
+this->m_orig_glProgramUniform4ui64vNV = this->m_ptr_glProgramUniform4ui64vNV;
+if(this->m_ptr_glProgramUniform4ui64vNV)this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&CaptureTableDecorator::m_glProgramUniform4ui64vNV_capture;
+this->m_orig_glGetNamedStringivARB = this->m_ptr_glGetNamedStringivARB;
+if(this->m_ptr_glGetNamedStringivARB)this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&CaptureTableDecorator::m_glGetNamedStringivARB_capture;
+this->m_orig_glVertexAttribL1i64vNV = this->m_ptr_glVertexAttribL1i64vNV;
+if(this->m_ptr_glVertexAttribL1i64vNV)this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL1i64vNV_capture;
+this->m_orig_glTransformFeedbackBufferBase = this->m_ptr_glTransformFeedbackBufferBase;
+if(this->m_ptr_glTransformFeedbackBufferBase)this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&CaptureTableDecorator::m_glTransformFeedbackBufferBase_capture;
+this->m_orig_glIndexsv = this->m_ptr_glIndexsv;
+if(this->m_ptr_glIndexsv)this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&CaptureTableDecorator::m_glIndexsv_capture;
+this->m_orig_glPointParameterivNV = this->m_ptr_glPointParameterivNV;
+if(this->m_ptr_glPointParameterivNV)this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&CaptureTableDecorator::m_glPointParameterivNV_capture;
+this->m_orig_glGetDetailTexFuncSGIS = this->m_ptr_glGetDetailTexFuncSGIS;
+if(this->m_ptr_glGetDetailTexFuncSGIS)this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&CaptureTableDecorator::m_glGetDetailTexFuncSGIS_capture;
+this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_capture;
+this->m_orig_glProgramLocalParameter4fARB = this->m_ptr_glProgramLocalParameter4fARB;
+if(this->m_ptr_glProgramLocalParameter4fARB)this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&CaptureTableDecorator::m_glProgramLocalParameter4fARB_capture;
+this->m_orig_glBitmap = this->m_ptr_glBitmap;
+if(this->m_ptr_glBitmap)this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&CaptureTableDecorator::m_glBitmap_capture;
+this->m_orig_glNamedFramebufferTextureLayerEXT = this->m_ptr_glNamedFramebufferTextureLayerEXT;
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT)this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTextureLayerEXT_capture;
+this->m_orig_glMultiTexGenfvEXT = this->m_ptr_glMultiTexGenfvEXT;
+if(this->m_ptr_glMultiTexGenfvEXT)this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&CaptureTableDecorator::m_glMultiTexGenfvEXT_capture;
+this->m_orig_glGetNamedBufferSubData = this->m_ptr_glGetNamedBufferSubData;
+if(this->m_ptr_glGetNamedBufferSubData)this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glGetNamedBufferSubData_capture;
+this->m_orig_glStencilFuncSeparateATI = this->m_ptr_glStencilFuncSeparateATI;
+if(this->m_ptr_glStencilFuncSeparateATI)this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&CaptureTableDecorator::m_glStencilFuncSeparateATI_capture;
+this->m_orig_glProgramUniform2iv = this->m_ptr_glProgramUniform2iv;
+if(this->m_ptr_glProgramUniform2iv)this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&CaptureTableDecorator::m_glProgramUniform2iv_capture;
+this->m_orig_glGetQueryiv = this->m_ptr_glGetQueryiv;
+if(this->m_ptr_glGetQueryiv)this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&CaptureTableDecorator::m_glGetQueryiv_capture;
+this->m_orig_glTexCoord4f = this->m_ptr_glTexCoord4f;
+if(this->m_ptr_glTexCoord4f)this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&CaptureTableDecorator::m_glTexCoord4f_capture;
+this->m_orig_glMapGrid2f = this->m_ptr_glMapGrid2f;
+if(this->m_ptr_glMapGrid2f)this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&CaptureTableDecorator::m_glMapGrid2f_capture;
+this->m_orig_glListParameterivSGIX = this->m_ptr_glListParameterivSGIX;
+if(this->m_ptr_glListParameterivSGIX)this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&CaptureTableDecorator::m_glListParameterivSGIX_capture;
+this->m_orig_glCreateQueries = this->m_ptr_glCreateQueries;
+if(this->m_ptr_glCreateQueries)this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&CaptureTableDecorator::m_glCreateQueries_capture;
+this->m_orig_glGetSamplerParameterfv = this->m_ptr_glGetSamplerParameterfv;
+if(this->m_ptr_glGetSamplerParameterfv)this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&CaptureTableDecorator::m_glGetSamplerParameterfv_capture;
+this->m_orig_glTexCoord4i = this->m_ptr_glTexCoord4i;
+if(this->m_ptr_glTexCoord4i)this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&CaptureTableDecorator::m_glTexCoord4i_capture;
+this->m_orig_glObjectLabel = this->m_ptr_glObjectLabel;
+if(this->m_ptr_glObjectLabel)this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&CaptureTableDecorator::m_glObjectLabel_capture;
+this->m_orig_glProgramUniform3i64NV = this->m_ptr_glProgramUniform3i64NV;
+if(this->m_ptr_glProgramUniform3i64NV)this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&CaptureTableDecorator::m_glProgramUniform3i64NV_capture;
+this->m_orig_glGetTextureHandleARB = this->m_ptr_glGetTextureHandleARB;
+if(this->m_ptr_glGetTextureHandleARB)this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&CaptureTableDecorator::m_glGetTextureHandleARB_capture;
+this->m_orig_glTexCoord4s = this->m_ptr_glTexCoord4s;
+if(this->m_ptr_glTexCoord4s)this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&CaptureTableDecorator::m_glTexCoord4s_capture;
+this->m_orig_glUniform4iARB = this->m_ptr_glUniform4iARB;
+if(this->m_ptr_glUniform4iARB)this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&CaptureTableDecorator::m_glUniform4iARB_capture;
+this->m_orig_glGetUniformIndices = this->m_ptr_glGetUniformIndices;
+if(this->m_ptr_glGetUniformIndices)this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&CaptureTableDecorator::m_glGetUniformIndices_capture;
+this->m_orig_glMultiTexImage3DEXT = this->m_ptr_glMultiTexImage3DEXT;
+if(this->m_ptr_glMultiTexImage3DEXT)this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&CaptureTableDecorator::m_glMultiTexImage3DEXT_capture;
+this->m_orig_glCoverageModulationTableNV = this->m_ptr_glCoverageModulationTableNV;
+if(this->m_ptr_glCoverageModulationTableNV)this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&CaptureTableDecorator::m_glCoverageModulationTableNV_capture;
+this->m_orig_glPointParameteriv = this->m_ptr_glPointParameteriv;
+if(this->m_ptr_glPointParameteriv)this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&CaptureTableDecorator::m_glPointParameteriv_capture;
+this->m_orig_glMultiTexCoord4svARB = this->m_ptr_glMultiTexCoord4svARB;
+if(this->m_ptr_glMultiTexCoord4svARB)this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4svARB_capture;
+this->m_orig_glNormal3fv = this->m_ptr_glNormal3fv;
+if(this->m_ptr_glNormal3fv)this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&CaptureTableDecorator::m_glNormal3fv_capture;
+this->m_orig_glProgramUniformMatrix3x4dvEXT = this->m_ptr_glProgramUniformMatrix3x4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT)this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x4dvEXT_capture;
+this->m_orig_glTexCoord1fv = this->m_ptr_glTexCoord1fv;
+if(this->m_ptr_glTexCoord1fv)this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&CaptureTableDecorator::m_glTexCoord1fv_capture;
+this->m_orig_glProgramUniformMatrix4x3dvEXT = this->m_ptr_glProgramUniformMatrix4x3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT)this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x3dvEXT_capture;
+this->m_orig_glGetActiveVaryingNV = this->m_ptr_glGetActiveVaryingNV;
+if(this->m_ptr_glGetActiveVaryingNV)this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&CaptureTableDecorator::m_glGetActiveVaryingNV_capture;
+this->m_orig_glUniform1i64vARB = this->m_ptr_glUniform1i64vARB;
+if(this->m_ptr_glUniform1i64vARB)this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&CaptureTableDecorator::m_glUniform1i64vARB_capture;
+this->m_orig_glMultiTexCoord1dv = this->m_ptr_glMultiTexCoord1dv;
+if(this->m_ptr_glMultiTexCoord1dv)this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&CaptureTableDecorator::m_glMultiTexCoord1dv_capture;
+this->m_orig_glTexCoord3fv = this->m_ptr_glTexCoord3fv;
+if(this->m_ptr_glTexCoord3fv)this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&CaptureTableDecorator::m_glTexCoord3fv_capture;
+this->m_orig_glMatrixTranslatefEXT = this->m_ptr_glMatrixTranslatefEXT;
+if(this->m_ptr_glMatrixTranslatefEXT)this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&CaptureTableDecorator::m_glMatrixTranslatefEXT_capture;
+this->m_orig_glProgramUniform1ui64vNV = this->m_ptr_glProgramUniform1ui64vNV;
+if(this->m_ptr_glProgramUniform1ui64vNV)this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&CaptureTableDecorator::m_glProgramUniform1ui64vNV_capture;
+this->m_orig_glTextureMaterialEXT = this->m_ptr_glTextureMaterialEXT;
+if(this->m_ptr_glTextureMaterialEXT)this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&CaptureTableDecorator::m_glTextureMaterialEXT_capture;
+this->m_orig_glMultiTexCoordP3uiv = this->m_ptr_glMultiTexCoordP3uiv;
+if(this->m_ptr_glMultiTexCoordP3uiv)this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&CaptureTableDecorator::m_glMultiTexCoordP3uiv_capture;
+this->m_orig_glVertexAttribP3ui = this->m_ptr_glVertexAttribP3ui;
+if(this->m_ptr_glVertexAttribP3ui)this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&CaptureTableDecorator::m_glVertexAttribP3ui_capture;
+this->m_orig_glInterpolatePathsNV = this->m_ptr_glInterpolatePathsNV;
+if(this->m_ptr_glInterpolatePathsNV)this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&CaptureTableDecorator::m_glInterpolatePathsNV_capture;
+this->m_orig_glTextureBufferRange = this->m_ptr_glTextureBufferRange;
+if(this->m_ptr_glTextureBufferRange)this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&CaptureTableDecorator::m_glTextureBufferRange_capture;
+this->m_orig_glVertexAttribL2dEXT = this->m_ptr_glVertexAttribL2dEXT;
+if(this->m_ptr_glVertexAttribL2dEXT)this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&CaptureTableDecorator::m_glVertexAttribL2dEXT_capture;
+this->m_orig_glGetPixelTransformParameterivEXT = this->m_ptr_glGetPixelTransformParameterivEXT;
+if(this->m_ptr_glGetPixelTransformParameterivEXT)this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetPixelTransformParameterivEXT_capture;
+this->m_orig_glTexCoord4xvOES = this->m_ptr_glTexCoord4xvOES;
+if(this->m_ptr_glTexCoord4xvOES)this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&CaptureTableDecorator::m_glTexCoord4xvOES_capture;
+this->m_orig_glGetVariantBooleanvEXT = this->m_ptr_glGetVariantBooleanvEXT;
+if(this->m_ptr_glGetVariantBooleanvEXT)this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&CaptureTableDecorator::m_glGetVariantBooleanvEXT_capture;
+this->m_orig_glDepthRange = this->m_ptr_glDepthRange;
+if(this->m_ptr_glDepthRange)this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&CaptureTableDecorator::m_glDepthRange_capture;
+this->m_orig_glGetVertexAttribdvARB = this->m_ptr_glGetVertexAttribdvARB;
+if(this->m_ptr_glGetVertexAttribdvARB)this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&CaptureTableDecorator::m_glGetVertexAttribdvARB_capture;
+this->m_orig_glGetColorTableParameterfv = this->m_ptr_glGetColorTableParameterfv;
+if(this->m_ptr_glGetColorTableParameterfv)this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&CaptureTableDecorator::m_glGetColorTableParameterfv_capture;
+this->m_orig_glDrawArraysInstancedEXT = this->m_ptr_glDrawArraysInstancedEXT;
+if(this->m_ptr_glDrawArraysInstancedEXT)this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&CaptureTableDecorator::m_glDrawArraysInstancedEXT_capture;
+this->m_orig_glDisableClientStateIndexedEXT = this->m_ptr_glDisableClientStateIndexedEXT;
+if(this->m_ptr_glDisableClientStateIndexedEXT)this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&CaptureTableDecorator::m_glDisableClientStateIndexedEXT_capture;
+this->m_orig_glDrawBuffer = this->m_ptr_glDrawBuffer;
+if(this->m_ptr_glDrawBuffer)this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&CaptureTableDecorator::m_glDrawBuffer_capture;
+this->m_orig_glMultiDrawArraysIndirectBindlessNV = this->m_ptr_glMultiDrawArraysIndirectBindlessNV;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV)this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_capture;
+this->m_orig_glGetnPixelMapusv = this->m_ptr_glGetnPixelMapusv;
+if(this->m_ptr_glGetnPixelMapusv)this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&CaptureTableDecorator::m_glGetnPixelMapusv_capture;
+this->m_orig_glRasterPos3fv = this->m_ptr_glRasterPos3fv;
+if(this->m_ptr_glRasterPos3fv)this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&CaptureTableDecorator::m_glRasterPos3fv_capture;
+this->m_orig_glClearBufferuiv = this->m_ptr_glClearBufferuiv;
+if(this->m_ptr_glClearBufferuiv)this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&CaptureTableDecorator::m_glClearBufferuiv_capture;
+this->m_orig_glGetInternalformati64v = this->m_ptr_glGetInternalformati64v;
+if(this->m_ptr_glGetInternalformati64v)this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&CaptureTableDecorator::m_glGetInternalformati64v_capture;
+this->m_orig_glShaderSourceARB = this->m_ptr_glShaderSourceARB;
+if(this->m_ptr_glShaderSourceARB)this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&CaptureTableDecorator::m_glShaderSourceARB_capture;
+this->m_orig_glShaderOp3EXT = this->m_ptr_glShaderOp3EXT;
+if(this->m_ptr_glShaderOp3EXT)this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&CaptureTableDecorator::m_glShaderOp3EXT_capture;
+this->m_orig_glWindowPos2dvMESA = this->m_ptr_glWindowPos2dvMESA;
+if(this->m_ptr_glWindowPos2dvMESA)this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&CaptureTableDecorator::m_glWindowPos2dvMESA_capture;
+this->m_orig_glClearIndex = this->m_ptr_glClearIndex;
+if(this->m_ptr_glClearIndex)this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&CaptureTableDecorator::m_glClearIndex_capture;
+this->m_orig_glProvokingVertexEXT = this->m_ptr_glProvokingVertexEXT;
+if(this->m_ptr_glProvokingVertexEXT)this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&CaptureTableDecorator::m_glProvokingVertexEXT_capture;
+this->m_orig_glVariantubvEXT = this->m_ptr_glVariantubvEXT;
+if(this->m_ptr_glVariantubvEXT)this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&CaptureTableDecorator::m_glVariantubvEXT_capture;
+this->m_orig_glFlush = this->m_ptr_glFlush;
+if(this->m_ptr_glFlush)this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&CaptureTableDecorator::m_glFlush_capture;
+this->m_orig_glFramebufferTexture2DEXT = this->m_ptr_glFramebufferTexture2DEXT;
+if(this->m_ptr_glFramebufferTexture2DEXT)this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&CaptureTableDecorator::m_glFramebufferTexture2DEXT_capture;
+this->m_orig_glGetColorTableParameterivEXT = this->m_ptr_glGetColorTableParameterivEXT;
+if(this->m_ptr_glGetColorTableParameterivEXT)this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetColorTableParameterivEXT_capture;
+this->m_orig_glPresentFrameDualFillNV = this->m_ptr_glPresentFrameDualFillNV;
+if(this->m_ptr_glPresentFrameDualFillNV)this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&CaptureTableDecorator::m_glPresentFrameDualFillNV_capture;
+this->m_orig_glGenVertexShadersEXT = this->m_ptr_glGenVertexShadersEXT;
+if(this->m_ptr_glGenVertexShadersEXT)this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&CaptureTableDecorator::m_glGenVertexShadersEXT_capture;
+this->m_orig_glSpecializeShaderARB = this->m_ptr_glSpecializeShaderARB;
+if(this->m_ptr_glSpecializeShaderARB)this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&CaptureTableDecorator::m_glSpecializeShaderARB_capture;
+this->m_orig_glProgramUniformHandleui64vARB = this->m_ptr_glProgramUniformHandleui64vARB;
+if(this->m_ptr_glProgramUniformHandleui64vARB)this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&CaptureTableDecorator::m_glProgramUniformHandleui64vARB_capture;
+this->m_orig_glDepthRangefOES = this->m_ptr_glDepthRangefOES;
+if(this->m_ptr_glDepthRangefOES)this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&CaptureTableDecorator::m_glDepthRangefOES_capture;
+this->m_orig_glDeleteVertexArrays = this->m_ptr_glDeleteVertexArrays;
+if(this->m_ptr_glDeleteVertexArrays)this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&CaptureTableDecorator::m_glDeleteVertexArrays_capture;
+this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance = this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance;
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance)this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&CaptureTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_capture;
+this->m_orig_glGetTexLevelParameteriv = this->m_ptr_glGetTexLevelParameteriv;
+if(this->m_ptr_glGetTexLevelParameteriv)this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&CaptureTableDecorator::m_glGetTexLevelParameteriv_capture;
+this->m_orig_glDrawVkImageNV = this->m_ptr_glDrawVkImageNV;
+if(this->m_ptr_glDrawVkImageNV)this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&CaptureTableDecorator::m_glDrawVkImageNV_capture;
+this->m_orig_glWindowPos3iARB = this->m_ptr_glWindowPos3iARB;
+if(this->m_ptr_glWindowPos3iARB)this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&CaptureTableDecorator::m_glWindowPos3iARB_capture;
+this->m_orig_glPrioritizeTextures = this->m_ptr_glPrioritizeTextures;
+if(this->m_ptr_glPrioritizeTextures)this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&CaptureTableDecorator::m_glPrioritizeTextures_capture;
+this->m_orig_glWindowPos3fvMESA = this->m_ptr_glWindowPos3fvMESA;
+if(this->m_ptr_glWindowPos3fvMESA)this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&CaptureTableDecorator::m_glWindowPos3fvMESA_capture;
+this->m_orig_glProgramUniformMatrix3x2dvEXT = this->m_ptr_glProgramUniformMatrix3x2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT)this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x2dvEXT_capture;
+this->m_orig_glVertex4xvOES = this->m_ptr_glVertex4xvOES;
+if(this->m_ptr_glVertex4xvOES)this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&CaptureTableDecorator::m_glVertex4xvOES_capture;
+this->m_orig_glTexStorage3DMultisample = this->m_ptr_glTexStorage3DMultisample;
+if(this->m_ptr_glTexStorage3DMultisample)this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTexStorage3DMultisample_capture;
+this->m_orig_glWindowPos2sARB = this->m_ptr_glWindowPos2sARB;
+if(this->m_ptr_glWindowPos2sARB)this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&CaptureTableDecorator::m_glWindowPos2sARB_capture;
+this->m_orig_glStencilOpValueAMD = this->m_ptr_glStencilOpValueAMD;
+if(this->m_ptr_glStencilOpValueAMD)this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&CaptureTableDecorator::m_glStencilOpValueAMD_capture;
+this->m_orig_glProgramVertexLimitNV = this->m_ptr_glProgramVertexLimitNV;
+if(this->m_ptr_glProgramVertexLimitNV)this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&CaptureTableDecorator::m_glProgramVertexLimitNV_capture;
+this->m_orig_glGetTexParameterPointervAPPLE = this->m_ptr_glGetTexParameterPointervAPPLE;
+if(this->m_ptr_glGetTexParameterPointervAPPLE)this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&CaptureTableDecorator::m_glGetTexParameterPointervAPPLE_capture;
+this->m_orig_glProgramUniform3uivEXT = this->m_ptr_glProgramUniform3uivEXT;
+if(this->m_ptr_glProgramUniform3uivEXT)this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&CaptureTableDecorator::m_glProgramUniform3uivEXT_capture;
+this->m_orig_glClampColor = this->m_ptr_glClampColor;
+if(this->m_ptr_glClampColor)this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&CaptureTableDecorator::m_glClampColor_capture;
+this->m_orig_glClearStencil = this->m_ptr_glClearStencil;
+if(this->m_ptr_glClearStencil)this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&CaptureTableDecorator::m_glClearStencil_capture;
+this->m_orig_glTexCoordP1uiv = this->m_ptr_glTexCoordP1uiv;
+if(this->m_ptr_glTexCoordP1uiv)this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&CaptureTableDecorator::m_glTexCoordP1uiv_capture;
+this->m_orig_glVertexAttribs3svNV = this->m_ptr_glVertexAttribs3svNV;
+if(this->m_ptr_glVertexAttribs3svNV)this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&CaptureTableDecorator::m_glVertexAttribs3svNV_capture;
+this->m_orig_glMultiTexCoord3fv = this->m_ptr_glMultiTexCoord3fv;
+if(this->m_ptr_glMultiTexCoord3fv)this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&CaptureTableDecorator::m_glMultiTexCoord3fv_capture;
+this->m_orig_glVertexBlendEnvfATI = this->m_ptr_glVertexBlendEnvfATI;
+if(this->m_ptr_glVertexBlendEnvfATI)this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&CaptureTableDecorator::m_glVertexBlendEnvfATI_capture;
+this->m_orig_glIsFenceAPPLE = this->m_ptr_glIsFenceAPPLE;
+if(this->m_ptr_glIsFenceAPPLE)this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&CaptureTableDecorator::m_glIsFenceAPPLE_capture;
+this->m_orig_glGetBufferParameterui64vNV = this->m_ptr_glGetBufferParameterui64vNV;
+if(this->m_ptr_glGetBufferParameterui64vNV)this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&CaptureTableDecorator::m_glGetBufferParameterui64vNV_capture;
+this->m_orig_glVertexAttribI4bvEXT = this->m_ptr_glVertexAttribI4bvEXT;
+if(this->m_ptr_glVertexAttribI4bvEXT)this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4bvEXT_capture;
+this->m_orig_glUniform2fARB = this->m_ptr_glUniform2fARB;
+if(this->m_ptr_glUniform2fARB)this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&CaptureTableDecorator::m_glUniform2fARB_capture;
+this->m_orig_glStopInstrumentsSGIX = this->m_ptr_glStopInstrumentsSGIX;
+if(this->m_ptr_glStopInstrumentsSGIX)this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&CaptureTableDecorator::m_glStopInstrumentsSGIX_capture;
+this->m_orig_glVertexAttrib3fNV = this->m_ptr_glVertexAttrib3fNV;
+if(this->m_ptr_glVertexAttrib3fNV)this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&CaptureTableDecorator::m_glVertexAttrib3fNV_capture;
+this->m_orig_glMapVertexAttrib2dAPPLE = this->m_ptr_glMapVertexAttrib2dAPPLE;
+if(this->m_ptr_glMapVertexAttrib2dAPPLE)this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&CaptureTableDecorator::m_glMapVertexAttrib2dAPPLE_capture;
+this->m_orig_glVertex2f = this->m_ptr_glVertex2f;
+if(this->m_ptr_glVertex2f)this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&CaptureTableDecorator::m_glVertex2f_capture;
+this->m_orig_glCopyTextureImage2DEXT = this->m_ptr_glCopyTextureImage2DEXT;
+if(this->m_ptr_glCopyTextureImage2DEXT)this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyTextureImage2DEXT_capture;
+this->m_orig_glVertex2d = this->m_ptr_glVertex2d;
+if(this->m_ptr_glVertex2d)this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&CaptureTableDecorator::m_glVertex2d_capture;
+this->m_orig_glSecondaryColor3bvEXT = this->m_ptr_glSecondaryColor3bvEXT;
+if(this->m_ptr_glSecondaryColor3bvEXT)this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3bvEXT_capture;
+this->m_orig_glMultiTexCoord4fARB = this->m_ptr_glMultiTexCoord4fARB;
+if(this->m_ptr_glMultiTexCoord4fARB)this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4fARB_capture;
+this->m_orig_glPolygonOffset = this->m_ptr_glPolygonOffset;
+if(this->m_ptr_glPolygonOffset)this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&CaptureTableDecorator::m_glPolygonOffset_capture;
+this->m_orig_glTangent3bvEXT = this->m_ptr_glTangent3bvEXT;
+if(this->m_ptr_glTangent3bvEXT)this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&CaptureTableDecorator::m_glTangent3bvEXT_capture;
+this->m_orig_glHistogram = this->m_ptr_glHistogram;
+if(this->m_ptr_glHistogram)this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&CaptureTableDecorator::m_glHistogram_capture;
+this->m_orig_glGetProgramiv = this->m_ptr_glGetProgramiv;
+if(this->m_ptr_glGetProgramiv)this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&CaptureTableDecorator::m_glGetProgramiv_capture;
+this->m_orig_glMatrixIndexubvARB = this->m_ptr_glMatrixIndexubvARB;
+if(this->m_ptr_glMatrixIndexubvARB)this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&CaptureTableDecorator::m_glMatrixIndexubvARB_capture;
+this->m_orig_glVertex2s = this->m_ptr_glVertex2s;
+if(this->m_ptr_glVertex2s)this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&CaptureTableDecorator::m_glVertex2s_capture;
+this->m_orig_glGetVertexAttribLui64vNV = this->m_ptr_glGetVertexAttribLui64vNV;
+if(this->m_ptr_glGetVertexAttribLui64vNV)this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&CaptureTableDecorator::m_glGetVertexAttribLui64vNV_capture;
+this->m_orig_glGetProgramStringARB = this->m_ptr_glGetProgramStringARB;
+if(this->m_ptr_glGetProgramStringARB)this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&CaptureTableDecorator::m_glGetProgramStringARB_capture;
+this->m_orig_glFlushMappedBufferRange = this->m_ptr_glFlushMappedBufferRange;
+if(this->m_ptr_glFlushMappedBufferRange)this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&CaptureTableDecorator::m_glFlushMappedBufferRange_capture;
+this->m_orig_glVertexAttribI3uiEXT = this->m_ptr_glVertexAttribI3uiEXT;
+if(this->m_ptr_glVertexAttribI3uiEXT)this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&CaptureTableDecorator::m_glVertexAttribI3uiEXT_capture;
+this->m_orig_glLineWidthxOES = this->m_ptr_glLineWidthxOES;
+if(this->m_ptr_glLineWidthxOES)this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&CaptureTableDecorator::m_glLineWidthxOES_capture;
+this->m_orig_glProgramUniformMatrix2fvEXT = this->m_ptr_glProgramUniformMatrix2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2fvEXT)this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2fvEXT_capture;
+this->m_orig_glGetTextureParameterIuivEXT = this->m_ptr_glGetTextureParameterIuivEXT;
+if(this->m_ptr_glGetTextureParameterIuivEXT)this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glGetTextureParameterIuivEXT_capture;
+this->m_orig_glGetMultiTexEnvivEXT = this->m_ptr_glGetMultiTexEnvivEXT;
+if(this->m_ptr_glGetMultiTexEnvivEXT)this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexEnvivEXT_capture;
+this->m_orig_glPixelTexGenParameterivSGIS = this->m_ptr_glPixelTexGenParameterivSGIS;
+if(this->m_ptr_glPixelTexGenParameterivSGIS)this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&CaptureTableDecorator::m_glPixelTexGenParameterivSGIS_capture;
+this->m_orig_glGenQueries = this->m_ptr_glGenQueries;
+if(this->m_ptr_glGenQueries)this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&CaptureTableDecorator::m_glGenQueries_capture;
+this->m_orig_glGetPixelMapfv = this->m_ptr_glGetPixelMapfv;
+if(this->m_ptr_glGetPixelMapfv)this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&CaptureTableDecorator::m_glGetPixelMapfv_capture;
+this->m_orig_glBlendColorEXT = this->m_ptr_glBlendColorEXT;
+if(this->m_ptr_glBlendColorEXT)this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&CaptureTableDecorator::m_glBlendColorEXT_capture;
+this->m_orig_glResetMinmax = this->m_ptr_glResetMinmax;
+if(this->m_ptr_glResetMinmax)this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&CaptureTableDecorator::m_glResetMinmax_capture;
+this->m_orig_glGetnUniformivARB = this->m_ptr_glGetnUniformivARB;
+if(this->m_ptr_glGetnUniformivARB)this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&CaptureTableDecorator::m_glGetnUniformivARB_capture;
+this->m_orig_glVertexBlendARB = this->m_ptr_glVertexBlendARB;
+if(this->m_ptr_glVertexBlendARB)this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&CaptureTableDecorator::m_glVertexBlendARB_capture;
+this->m_orig_glVertexAttrib4d = this->m_ptr_glVertexAttrib4d;
+if(this->m_ptr_glVertexAttrib4d)this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&CaptureTableDecorator::m_glVertexAttrib4d_capture;
+this->m_orig_glGetVaryingLocationNV = this->m_ptr_glGetVaryingLocationNV;
+if(this->m_ptr_glGetVaryingLocationNV)this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&CaptureTableDecorator::m_glGetVaryingLocationNV_capture;
+this->m_orig_glGetMapAttribParameterivNV = this->m_ptr_glGetMapAttribParameterivNV;
+if(this->m_ptr_glGetMapAttribParameterivNV)this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetMapAttribParameterivNV_capture;
+this->m_orig_glTexSubImage3D = this->m_ptr_glTexSubImage3D;
+if(this->m_ptr_glTexSubImage3D)this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&CaptureTableDecorator::m_glTexSubImage3D_capture;
+this->m_orig_glDeleteSamplers = this->m_ptr_glDeleteSamplers;
+if(this->m_ptr_glDeleteSamplers)this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&CaptureTableDecorator::m_glDeleteSamplers_capture;
+this->m_orig_glGetLightxOES = this->m_ptr_glGetLightxOES;
+if(this->m_ptr_glGetLightxOES)this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&CaptureTableDecorator::m_glGetLightxOES_capture;
+this->m_orig_glGetVertexAttribArrayObjectfvATI = this->m_ptr_glGetVertexAttribArrayObjectfvATI;
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI)this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&CaptureTableDecorator::m_glGetVertexAttribArrayObjectfvATI_capture;
+this->m_orig_glVertexArrayNormalOffsetEXT = this->m_ptr_glVertexArrayNormalOffsetEXT;
+if(this->m_ptr_glVertexArrayNormalOffsetEXT)this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayNormalOffsetEXT_capture;
+this->m_orig_glGetBufferParameterivARB = this->m_ptr_glGetBufferParameterivARB;
+if(this->m_ptr_glGetBufferParameterivARB)this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&CaptureTableDecorator::m_glGetBufferParameterivARB_capture;
+this->m_orig_glGetTextureParameterfv = this->m_ptr_glGetTextureParameterfv;
+if(this->m_ptr_glGetTextureParameterfv)this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&CaptureTableDecorator::m_glGetTextureParameterfv_capture;
+this->m_orig_glDrawMeshArraysSUN = this->m_ptr_glDrawMeshArraysSUN;
+if(this->m_ptr_glDrawMeshArraysSUN)this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&CaptureTableDecorator::m_glDrawMeshArraysSUN_capture;
+this->m_orig_glVertexAttrib4dNV = this->m_ptr_glVertexAttrib4dNV;
+if(this->m_ptr_glVertexAttrib4dNV)this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&CaptureTableDecorator::m_glVertexAttrib4dNV_capture;
+this->m_orig_glGetMultisamplefvNV = this->m_ptr_glGetMultisamplefvNV;
+if(this->m_ptr_glGetMultisamplefvNV)this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&CaptureTableDecorator::m_glGetMultisamplefvNV_capture;
+this->m_orig_glMapObjectBufferATI = this->m_ptr_glMapObjectBufferATI;
+if(this->m_ptr_glMapObjectBufferATI)this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glMapObjectBufferATI_capture;
+this->m_orig_glGetPathCommandsNV = this->m_ptr_glGetPathCommandsNV;
+if(this->m_ptr_glGetPathCommandsNV)this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&CaptureTableDecorator::m_glGetPathCommandsNV_capture;
+this->m_orig_glVertexArrayTexCoordOffsetEXT = this->m_ptr_glVertexArrayTexCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT)this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayTexCoordOffsetEXT_capture;
+this->m_orig_glGetHistogram = this->m_ptr_glGetHistogram;
+if(this->m_ptr_glGetHistogram)this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&CaptureTableDecorator::m_glGetHistogram_capture;
+this->m_orig_glMatrixMode = this->m_ptr_glMatrixMode;
+if(this->m_ptr_glMatrixMode)this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&CaptureTableDecorator::m_glMatrixMode_capture;
+this->m_orig_glColorFormatNV = this->m_ptr_glColorFormatNV;
+if(this->m_ptr_glColorFormatNV)this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&CaptureTableDecorator::m_glColorFormatNV_capture;
+this->m_orig_glProgramUniformui64NV = this->m_ptr_glProgramUniformui64NV;
+if(this->m_ptr_glProgramUniformui64NV)this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&CaptureTableDecorator::m_glProgramUniformui64NV_capture;
+this->m_orig_glProgramUniformMatrix4x2fvEXT = this->m_ptr_glProgramUniformMatrix4x2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT)this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x2fvEXT_capture;
+this->m_orig_glLoadMatrixxOES = this->m_ptr_glLoadMatrixxOES;
+if(this->m_ptr_glLoadMatrixxOES)this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&CaptureTableDecorator::m_glLoadMatrixxOES_capture;
+this->m_orig_glGetColorTableParameterfvEXT = this->m_ptr_glGetColorTableParameterfvEXT;
+if(this->m_ptr_glGetColorTableParameterfvEXT)this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetColorTableParameterfvEXT_capture;
+this->m_orig_glRasterPos4i = this->m_ptr_glRasterPos4i;
+if(this->m_ptr_glRasterPos4i)this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&CaptureTableDecorator::m_glRasterPos4i_capture;
+this->m_orig_glVertexAttribL2i64NV = this->m_ptr_glVertexAttribL2i64NV;
+if(this->m_ptr_glVertexAttribL2i64NV)this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&CaptureTableDecorator::m_glVertexAttribL2i64NV_capture;
+this->m_orig_glBindTextures = this->m_ptr_glBindTextures;
+if(this->m_ptr_glBindTextures)this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&CaptureTableDecorator::m_glBindTextures_capture;
+this->m_orig_glMatrixRotatefEXT = this->m_ptr_glMatrixRotatefEXT;
+if(this->m_ptr_glMatrixRotatefEXT)this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&CaptureTableDecorator::m_glMatrixRotatefEXT_capture;
+this->m_orig_glGetClipPlanexOES = this->m_ptr_glGetClipPlanexOES;
+if(this->m_ptr_glGetClipPlanexOES)this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&CaptureTableDecorator::m_glGetClipPlanexOES_capture;
+this->m_orig_glSecondaryColor3uivEXT = this->m_ptr_glSecondaryColor3uivEXT;
+if(this->m_ptr_glSecondaryColor3uivEXT)this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3uivEXT_capture;
+this->m_orig_glGetPerfQueryInfoINTEL = this->m_ptr_glGetPerfQueryInfoINTEL;
+if(this->m_ptr_glGetPerfQueryInfoINTEL)this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&CaptureTableDecorator::m_glGetPerfQueryInfoINTEL_capture;
+this->m_orig_glGetDoublev = this->m_ptr_glGetDoublev;
+if(this->m_ptr_glGetDoublev)this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&CaptureTableDecorator::m_glGetDoublev_capture;
+this->m_orig_glBindBufferRangeEXT = this->m_ptr_glBindBufferRangeEXT;
+if(this->m_ptr_glBindBufferRangeEXT)this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&CaptureTableDecorator::m_glBindBufferRangeEXT_capture;
+this->m_orig_glCompressedTexImage2D = this->m_ptr_glCompressedTexImage2D;
+if(this->m_ptr_glCompressedTexImage2D)this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&CaptureTableDecorator::m_glCompressedTexImage2D_capture;
+this->m_orig_glMapBufferARB = this->m_ptr_glMapBufferARB;
+if(this->m_ptr_glMapBufferARB)this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&CaptureTableDecorator::m_glMapBufferARB_capture;
+this->m_orig_glGetPathSpacingNV = this->m_ptr_glGetPathSpacingNV;
+if(this->m_ptr_glGetPathSpacingNV)this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&CaptureTableDecorator::m_glGetPathSpacingNV_capture;
+this->m_orig_glUniform4dv = this->m_ptr_glUniform4dv;
+if(this->m_ptr_glUniform4dv)this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&CaptureTableDecorator::m_glUniform4dv_capture;
+this->m_orig_glGlobalAlphaFactordSUN = this->m_ptr_glGlobalAlphaFactordSUN;
+if(this->m_ptr_glGlobalAlphaFactordSUN)this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactordSUN_capture;
+this->m_orig_glProgramUniform3dv = this->m_ptr_glProgramUniform3dv;
+if(this->m_ptr_glProgramUniform3dv)this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&CaptureTableDecorator::m_glProgramUniform3dv_capture;
+this->m_orig_glGetShaderSourceARB = this->m_ptr_glGetShaderSourceARB;
+if(this->m_ptr_glGetShaderSourceARB)this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&CaptureTableDecorator::m_glGetShaderSourceARB_capture;
+this->m_orig_glVertexAttrib3dvARB = this->m_ptr_glVertexAttrib3dvARB;
+if(this->m_ptr_glVertexAttrib3dvARB)this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&CaptureTableDecorator::m_glVertexAttrib3dvARB_capture;
+this->m_orig_glInvalidateBufferData = this->m_ptr_glInvalidateBufferData;
+if(this->m_ptr_glInvalidateBufferData)this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&CaptureTableDecorator::m_glInvalidateBufferData_capture;
+this->m_orig_glMatrixLoad3x2fNV = this->m_ptr_glMatrixLoad3x2fNV;
+if(this->m_ptr_glMatrixLoad3x2fNV)this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&CaptureTableDecorator::m_glMatrixLoad3x2fNV_capture;
+this->m_orig_glCompressedTextureSubImage1D = this->m_ptr_glCompressedTextureSubImage1D;
+if(this->m_ptr_glCompressedTextureSubImage1D)this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage1D_capture;
+this->m_orig_glTexCoord3xvOES = this->m_ptr_glTexCoord3xvOES;
+if(this->m_ptr_glTexCoord3xvOES)this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&CaptureTableDecorator::m_glTexCoord3xvOES_capture;
+this->m_orig_glGenTexturesEXT = this->m_ptr_glGenTexturesEXT;
+if(this->m_ptr_glGenTexturesEXT)this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&CaptureTableDecorator::m_glGenTexturesEXT_capture;
+this->m_orig_glTangent3iEXT = this->m_ptr_glTangent3iEXT;
+if(this->m_ptr_glTangent3iEXT)this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&CaptureTableDecorator::m_glTangent3iEXT_capture;
+this->m_orig_glClearTexImage = this->m_ptr_glClearTexImage;
+if(this->m_ptr_glClearTexImage)this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&CaptureTableDecorator::m_glClearTexImage_capture;
+this->m_orig_glBinormal3bvEXT = this->m_ptr_glBinormal3bvEXT;
+if(this->m_ptr_glBinormal3bvEXT)this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&CaptureTableDecorator::m_glBinormal3bvEXT_capture;
+this->m_orig_glUniform3fv = this->m_ptr_glUniform3fv;
+if(this->m_ptr_glUniform3fv)this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&CaptureTableDecorator::m_glUniform3fv_capture;
+this->m_orig_glGetnPixelMapusvARB = this->m_ptr_glGetnPixelMapusvARB;
+if(this->m_ptr_glGetnPixelMapusvARB)this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&CaptureTableDecorator::m_glGetnPixelMapusvARB_capture;
+this->m_orig_glMemoryObjectParameterivEXT = this->m_ptr_glMemoryObjectParameterivEXT;
+if(this->m_ptr_glMemoryObjectParameterivEXT)this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glMemoryObjectParameterivEXT_capture;
+this->m_orig_glGenSemaphoresEXT = this->m_ptr_glGenSemaphoresEXT;
+if(this->m_ptr_glGenSemaphoresEXT)this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&CaptureTableDecorator::m_glGenSemaphoresEXT_capture;
+this->m_orig_glMultiTexCoordP1ui = this->m_ptr_glMultiTexCoordP1ui;
+if(this->m_ptr_glMultiTexCoordP1ui)this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&CaptureTableDecorator::m_glMultiTexCoordP1ui_capture;
+this->m_orig_glClearNamedBufferDataEXT = this->m_ptr_glClearNamedBufferDataEXT;
+if(this->m_ptr_glClearNamedBufferDataEXT)this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&CaptureTableDecorator::m_glClearNamedBufferDataEXT_capture;
+this->m_orig_glUniformMatrix4dv = this->m_ptr_glUniformMatrix4dv;
+if(this->m_ptr_glUniformMatrix4dv)this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&CaptureTableDecorator::m_glUniformMatrix4dv_capture;
+this->m_orig_glWindowPos3fMESA = this->m_ptr_glWindowPos3fMESA;
+if(this->m_ptr_glWindowPos3fMESA)this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&CaptureTableDecorator::m_glWindowPos3fMESA_capture;
+this->m_orig_glDeleteRenderbuffers = this->m_ptr_glDeleteRenderbuffers;
+if(this->m_ptr_glDeleteRenderbuffers)this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&CaptureTableDecorator::m_glDeleteRenderbuffers_capture;
+this->m_orig_glGetTextureLevelParameterfvEXT = this->m_ptr_glGetTextureLevelParameterfvEXT;
+if(this->m_ptr_glGetTextureLevelParameterfvEXT)this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetTextureLevelParameterfvEXT_capture;
+this->m_orig_glGetHistogramParameterxvOES = this->m_ptr_glGetHistogramParameterxvOES;
+if(this->m_ptr_glGetHistogramParameterxvOES)this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&CaptureTableDecorator::m_glGetHistogramParameterxvOES_capture;
+this->m_orig_glMultiDrawElements = this->m_ptr_glMultiDrawElements;
+if(this->m_ptr_glMultiDrawElements)this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&CaptureTableDecorator::m_glMultiDrawElements_capture;
+this->m_orig_glMakeImageHandleNonResidentNV = this->m_ptr_glMakeImageHandleNonResidentNV;
+if(this->m_ptr_glMakeImageHandleNonResidentNV)this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeImageHandleNonResidentNV_capture;
+this->m_orig_glTexSubImage1DEXT = this->m_ptr_glTexSubImage1DEXT;
+if(this->m_ptr_glTexSubImage1DEXT)this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glTexSubImage1DEXT_capture;
+this->m_orig_glNormalStream3dATI = this->m_ptr_glNormalStream3dATI;
+if(this->m_ptr_glNormalStream3dATI)this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&CaptureTableDecorator::m_glNormalStream3dATI_capture;
+this->m_orig_glVertexAttribL4i64vNV = this->m_ptr_glVertexAttribL4i64vNV;
+if(this->m_ptr_glVertexAttribL4i64vNV)this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL4i64vNV_capture;
+this->m_orig_glDrawBuffers = this->m_ptr_glDrawBuffers;
+if(this->m_ptr_glDrawBuffers)this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&CaptureTableDecorator::m_glDrawBuffers_capture;
+this->m_orig_glCopyTextureSubImage1DEXT = this->m_ptr_glCopyTextureSubImage1DEXT;
+if(this->m_ptr_glCopyTextureSubImage1DEXT)this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyTextureSubImage1DEXT_capture;
+this->m_orig_glWindowRectanglesEXT = this->m_ptr_glWindowRectanglesEXT;
+if(this->m_ptr_glWindowRectanglesEXT)this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&CaptureTableDecorator::m_glWindowRectanglesEXT_capture;
+this->m_orig_glNamedFramebufferReadBuffer = this->m_ptr_glNamedFramebufferReadBuffer;
+if(this->m_ptr_glNamedFramebufferReadBuffer)this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&CaptureTableDecorator::m_glNamedFramebufferReadBuffer_capture;
+this->m_orig_glUniform2i64vARB = this->m_ptr_glUniform2i64vARB;
+if(this->m_ptr_glUniform2i64vARB)this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&CaptureTableDecorator::m_glUniform2i64vARB_capture;
+this->m_orig_glVertexAttribI1uivEXT = this->m_ptr_glVertexAttribI1uivEXT;
+if(this->m_ptr_glVertexAttribI1uivEXT)this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI1uivEXT_capture;
+this->m_orig_glGetTexGenfv = this->m_ptr_glGetTexGenfv;
+if(this->m_ptr_glGetTexGenfv)this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&CaptureTableDecorator::m_glGetTexGenfv_capture;
+this->m_orig_glBeginQueryARB = this->m_ptr_glBeginQueryARB;
+if(this->m_ptr_glBeginQueryARB)this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&CaptureTableDecorator::m_glBeginQueryARB_capture;
+this->m_orig_glUniform1iARB = this->m_ptr_glUniform1iARB;
+if(this->m_ptr_glUniform1iARB)this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&CaptureTableDecorator::m_glUniform1iARB_capture;
+this->m_orig_glVertex4bvOES = this->m_ptr_glVertex4bvOES;
+if(this->m_ptr_glVertex4bvOES)this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&CaptureTableDecorator::m_glVertex4bvOES_capture;
+this->m_orig_glInvalidateSubFramebuffer = this->m_ptr_glInvalidateSubFramebuffer;
+if(this->m_ptr_glInvalidateSubFramebuffer)this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&CaptureTableDecorator::m_glInvalidateSubFramebuffer_capture;
+this->m_orig_glUniform1fvARB = this->m_ptr_glUniform1fvARB;
+if(this->m_ptr_glUniform1fvARB)this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&CaptureTableDecorator::m_glUniform1fvARB_capture;
+this->m_orig_glTestFenceNV = this->m_ptr_glTestFenceNV;
+if(this->m_ptr_glTestFenceNV)this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&CaptureTableDecorator::m_glTestFenceNV_capture;
+this->m_orig_glBindTransformFeedback = this->m_ptr_glBindTransformFeedback;
+if(this->m_ptr_glBindTransformFeedback)this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glBindTransformFeedback_capture;
+this->m_orig_glMultiTexCoord2iv = this->m_ptr_glMultiTexCoord2iv;
+if(this->m_ptr_glMultiTexCoord2iv)this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&CaptureTableDecorator::m_glMultiTexCoord2iv_capture;
+this->m_orig_glCopyMultiTexSubImage1DEXT = this->m_ptr_glCopyMultiTexSubImage1DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT)this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyMultiTexSubImage1DEXT_capture;
+this->m_orig_glVariantbvEXT = this->m_ptr_glVariantbvEXT;
+if(this->m_ptr_glVariantbvEXT)this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&CaptureTableDecorator::m_glVariantbvEXT_capture;
+this->m_orig_glTexCoord1hNV = this->m_ptr_glTexCoord1hNV;
+if(this->m_ptr_glTexCoord1hNV)this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&CaptureTableDecorator::m_glTexCoord1hNV_capture;
+this->m_orig_glGenFencesNV = this->m_ptr_glGenFencesNV;
+if(this->m_ptr_glGenFencesNV)this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&CaptureTableDecorator::m_glGenFencesNV_capture;
+this->m_orig_glRasterPos3iv = this->m_ptr_glRasterPos3iv;
+if(this->m_ptr_glRasterPos3iv)this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&CaptureTableDecorator::m_glRasterPos3iv_capture;
+this->m_orig_glVertexAttribL2ui64NV = this->m_ptr_glVertexAttribL2ui64NV;
+if(this->m_ptr_glVertexAttribL2ui64NV)this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&CaptureTableDecorator::m_glVertexAttribL2ui64NV_capture;
+this->m_orig_glMultiTexCoord1hvNV = this->m_ptr_glMultiTexCoord1hvNV;
+if(this->m_ptr_glMultiTexCoord1hvNV)this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&CaptureTableDecorator::m_glMultiTexCoord1hvNV_capture;
+this->m_orig_glGetnConvolutionFilter = this->m_ptr_glGetnConvolutionFilter;
+if(this->m_ptr_glGetnConvolutionFilter)this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&CaptureTableDecorator::m_glGetnConvolutionFilter_capture;
+this->m_orig_glNormal3bv = this->m_ptr_glNormal3bv;
+if(this->m_ptr_glNormal3bv)this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&CaptureTableDecorator::m_glNormal3bv_capture;
+this->m_orig_glWeightbvARB = this->m_ptr_glWeightbvARB;
+if(this->m_ptr_glWeightbvARB)this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&CaptureTableDecorator::m_glWeightbvARB_capture;
+this->m_orig_glTexCoord4sv = this->m_ptr_glTexCoord4sv;
+if(this->m_ptr_glTexCoord4sv)this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&CaptureTableDecorator::m_glTexCoord4sv_capture;
+this->m_orig_glUniform2uiv = this->m_ptr_glUniform2uiv;
+if(this->m_ptr_glUniform2uiv)this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&CaptureTableDecorator::m_glUniform2uiv_capture;
+this->m_orig_glBeginConditionalRenderNVX = this->m_ptr_glBeginConditionalRenderNVX;
+if(this->m_ptr_glBeginConditionalRenderNVX)this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&CaptureTableDecorator::m_glBeginConditionalRenderNVX_capture;
+this->m_orig_glFinish = this->m_ptr_glFinish;
+if(this->m_ptr_glFinish)this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&CaptureTableDecorator::m_glFinish_capture;
+this->m_orig_glColorTableParameterfv = this->m_ptr_glColorTableParameterfv;
+if(this->m_ptr_glColorTableParameterfv)this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&CaptureTableDecorator::m_glColorTableParameterfv_capture;
+this->m_orig_glFragmentCoverageColorNV = this->m_ptr_glFragmentCoverageColorNV;
+if(this->m_ptr_glFragmentCoverageColorNV)this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&CaptureTableDecorator::m_glFragmentCoverageColorNV_capture;
+this->m_orig_glProgramUniform3ivEXT = this->m_ptr_glProgramUniform3ivEXT;
+if(this->m_ptr_glProgramUniform3ivEXT)this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&CaptureTableDecorator::m_glProgramUniform3ivEXT_capture;
+this->m_orig_glVertexArrayVertexOffsetEXT = this->m_ptr_glVertexArrayVertexOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexOffsetEXT)this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexOffsetEXT_capture;
+this->m_orig_glViewportPositionWScaleNV = this->m_ptr_glViewportPositionWScaleNV;
+if(this->m_ptr_glViewportPositionWScaleNV)this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&CaptureTableDecorator::m_glViewportPositionWScaleNV_capture;
+this->m_orig_glGetProgramLocalParameterIuivNV = this->m_ptr_glGetProgramLocalParameterIuivNV;
+if(this->m_ptr_glGetProgramLocalParameterIuivNV)this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&CaptureTableDecorator::m_glGetProgramLocalParameterIuivNV_capture;
+this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_capture;
+this->m_orig_glUniform1uiv = this->m_ptr_glUniform1uiv;
+if(this->m_ptr_glUniform1uiv)this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&CaptureTableDecorator::m_glUniform1uiv_capture;
+this->m_orig_glUniformMatrix2dv = this->m_ptr_glUniformMatrix2dv;
+if(this->m_ptr_glUniformMatrix2dv)this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&CaptureTableDecorator::m_glUniformMatrix2dv_capture;
+this->m_orig_glIndexdv = this->m_ptr_glIndexdv;
+if(this->m_ptr_glIndexdv)this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&CaptureTableDecorator::m_glIndexdv_capture;
+this->m_orig_glSecondaryColor3ivEXT = this->m_ptr_glSecondaryColor3ivEXT;
+if(this->m_ptr_glSecondaryColor3ivEXT)this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3ivEXT_capture;
+this->m_orig_glTexCoord3iv = this->m_ptr_glTexCoord3iv;
+if(this->m_ptr_glTexCoord3iv)this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&CaptureTableDecorator::m_glTexCoord3iv_capture;
+this->m_orig_glVertexStream4fvATI = this->m_ptr_glVertexStream4fvATI;
+if(this->m_ptr_glVertexStream4fvATI)this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&CaptureTableDecorator::m_glVertexStream4fvATI_capture;
+this->m_orig_glDeformationMap3fSGIX = this->m_ptr_glDeformationMap3fSGIX;
+if(this->m_ptr_glDeformationMap3fSGIX)this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&CaptureTableDecorator::m_glDeformationMap3fSGIX_capture;
+this->m_orig_glClearDepth = this->m_ptr_glClearDepth;
+if(this->m_ptr_glClearDepth)this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&CaptureTableDecorator::m_glClearDepth_capture;
+this->m_orig_glGenAsyncMarkersSGIX = this->m_ptr_glGenAsyncMarkersSGIX;
+if(this->m_ptr_glGenAsyncMarkersSGIX)this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&CaptureTableDecorator::m_glGenAsyncMarkersSGIX_capture;
+this->m_orig_glDisableIndexedEXT = this->m_ptr_glDisableIndexedEXT;
+if(this->m_ptr_glDisableIndexedEXT)this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&CaptureTableDecorator::m_glDisableIndexedEXT_capture;
+this->m_orig_glVertexWeightfvEXT = this->m_ptr_glVertexWeightfvEXT;
+if(this->m_ptr_glVertexWeightfvEXT)this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&CaptureTableDecorator::m_glVertexWeightfvEXT_capture;
+this->m_orig_glGetProgramLocalParameterIivNV = this->m_ptr_glGetProgramLocalParameterIivNV;
+if(this->m_ptr_glGetProgramLocalParameterIivNV)this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&CaptureTableDecorator::m_glGetProgramLocalParameterIivNV_capture;
+this->m_orig_glCompressedTexImage3DARB = this->m_ptr_glCompressedTexImage3DARB;
+if(this->m_ptr_glCompressedTexImage3DARB)this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&CaptureTableDecorator::m_glCompressedTexImage3DARB_capture;
+this->m_orig_glProgramParameter4fNV = this->m_ptr_glProgramParameter4fNV;
+if(this->m_ptr_glProgramParameter4fNV)this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&CaptureTableDecorator::m_glProgramParameter4fNV_capture;
+this->m_orig_glConvolutionParameterxOES = this->m_ptr_glConvolutionParameterxOES;
+if(this->m_ptr_glConvolutionParameterxOES)this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&CaptureTableDecorator::m_glConvolutionParameterxOES_capture;
+this->m_orig_glInsertComponentEXT = this->m_ptr_glInsertComponentEXT;
+if(this->m_ptr_glInsertComponentEXT)this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&CaptureTableDecorator::m_glInsertComponentEXT_capture;
+this->m_orig_glCreateTextures = this->m_ptr_glCreateTextures;
+if(this->m_ptr_glCreateTextures)this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&CaptureTableDecorator::m_glCreateTextures_capture;
+this->m_orig_glSecondaryColor3iv = this->m_ptr_glSecondaryColor3iv;
+if(this->m_ptr_glSecondaryColor3iv)this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&CaptureTableDecorator::m_glSecondaryColor3iv_capture;
+this->m_orig_glCreateBuffers = this->m_ptr_glCreateBuffers;
+if(this->m_ptr_glCreateBuffers)this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&CaptureTableDecorator::m_glCreateBuffers_capture;
+this->m_orig_glMultiTexCoord2xvOES = this->m_ptr_glMultiTexCoord2xvOES;
+if(this->m_ptr_glMultiTexCoord2xvOES)this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord2xvOES_capture;
+this->m_orig_glTexGenxvOES = this->m_ptr_glTexGenxvOES;
+if(this->m_ptr_glTexGenxvOES)this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&CaptureTableDecorator::m_glTexGenxvOES_capture;
+this->m_orig_glMultTransposeMatrixf = this->m_ptr_glMultTransposeMatrixf;
+if(this->m_ptr_glMultTransposeMatrixf)this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&CaptureTableDecorator::m_glMultTransposeMatrixf_capture;
+this->m_orig_glBeginTransformFeedbackEXT = this->m_ptr_glBeginTransformFeedbackEXT;
+if(this->m_ptr_glBeginTransformFeedbackEXT)this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&CaptureTableDecorator::m_glBeginTransformFeedbackEXT_capture;
+this->m_orig_glTexCoord2fColor3fVertex3fSUN = this->m_ptr_glTexCoord2fColor3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN)this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_capture;
+this->m_orig_glNormal3sv = this->m_ptr_glNormal3sv;
+if(this->m_ptr_glNormal3sv)this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&CaptureTableDecorator::m_glNormal3sv_capture;
+this->m_orig_glFreeObjectBufferATI = this->m_ptr_glFreeObjectBufferATI;
+if(this->m_ptr_glFreeObjectBufferATI)this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glFreeObjectBufferATI_capture;
+this->m_orig_glBlendBarrierNV = this->m_ptr_glBlendBarrierNV;
+if(this->m_ptr_glBlendBarrierNV)this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&CaptureTableDecorator::m_glBlendBarrierNV_capture;
+this->m_orig_glUniform4i64vNV = this->m_ptr_glUniform4i64vNV;
+if(this->m_ptr_glUniform4i64vNV)this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&CaptureTableDecorator::m_glUniform4i64vNV_capture;
+this->m_orig_glGetnUniformuivARB = this->m_ptr_glGetnUniformuivARB;
+if(this->m_ptr_glGetnUniformuivARB)this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&CaptureTableDecorator::m_glGetnUniformuivARB_capture;
+this->m_orig_glAlphaFragmentOp3ATI = this->m_ptr_glAlphaFragmentOp3ATI;
+if(this->m_ptr_glAlphaFragmentOp3ATI)this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&CaptureTableDecorator::m_glAlphaFragmentOp3ATI_capture;
+this->m_orig_glProgramEnvParameters4fvEXT = this->m_ptr_glProgramEnvParameters4fvEXT;
+if(this->m_ptr_glProgramEnvParameters4fvEXT)this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&CaptureTableDecorator::m_glProgramEnvParameters4fvEXT_capture;
+this->m_orig_glBlendFuncSeparateEXT = this->m_ptr_glBlendFuncSeparateEXT;
+if(this->m_ptr_glBlendFuncSeparateEXT)this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&CaptureTableDecorator::m_glBlendFuncSeparateEXT_capture;
+this->m_orig_glConvolutionParameterivEXT = this->m_ptr_glConvolutionParameterivEXT;
+if(this->m_ptr_glConvolutionParameterivEXT)this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glConvolutionParameterivEXT_capture;
+this->m_orig_glPixelTexGenSGIX = this->m_ptr_glPixelTexGenSGIX;
+if(this->m_ptr_glPixelTexGenSGIX)this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&CaptureTableDecorator::m_glPixelTexGenSGIX_capture;
+this->m_orig_glDeleteProgram = this->m_ptr_glDeleteProgram;
+if(this->m_ptr_glDeleteProgram)this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&CaptureTableDecorator::m_glDeleteProgram_capture;
+this->m_orig_glUniformMatrix4x3dv = this->m_ptr_glUniformMatrix4x3dv;
+if(this->m_ptr_glUniformMatrix4x3dv)this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&CaptureTableDecorator::m_glUniformMatrix4x3dv_capture;
+this->m_orig_glGetVideoCaptureStreamivNV = this->m_ptr_glGetVideoCaptureStreamivNV;
+if(this->m_ptr_glGetVideoCaptureStreamivNV)this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&CaptureTableDecorator::m_glGetVideoCaptureStreamivNV_capture;
+this->m_orig_glProgramUniform4uiEXT = this->m_ptr_glProgramUniform4uiEXT;
+if(this->m_ptr_glProgramUniform4uiEXT)this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&CaptureTableDecorator::m_glProgramUniform4uiEXT_capture;
+this->m_orig_glMakeImageHandleNonResidentARB = this->m_ptr_glMakeImageHandleNonResidentARB;
+if(this->m_ptr_glMakeImageHandleNonResidentARB)this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&CaptureTableDecorator::m_glMakeImageHandleNonResidentARB_capture;
+this->m_orig_glSecondaryColor3dEXT = this->m_ptr_glSecondaryColor3dEXT;
+if(this->m_ptr_glSecondaryColor3dEXT)this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3dEXT_capture;
+this->m_orig_glDeleteQueries = this->m_ptr_glDeleteQueries;
+if(this->m_ptr_glDeleteQueries)this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&CaptureTableDecorator::m_glDeleteQueries_capture;
+this->m_orig_glNormalP3uiv = this->m_ptr_glNormalP3uiv;
+if(this->m_ptr_glNormalP3uiv)this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&CaptureTableDecorator::m_glNormalP3uiv_capture;
+this->m_orig_glRasterPos2d = this->m_ptr_glRasterPos2d;
+if(this->m_ptr_glRasterPos2d)this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&CaptureTableDecorator::m_glRasterPos2d_capture;
+this->m_orig_glInitNames = this->m_ptr_glInitNames;
+if(this->m_ptr_glInitNames)this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&CaptureTableDecorator::m_glInitNames_capture;
+this->m_orig_glBinormal3fvEXT = this->m_ptr_glBinormal3fvEXT;
+if(this->m_ptr_glBinormal3fvEXT)this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&CaptureTableDecorator::m_glBinormal3fvEXT_capture;
+this->m_orig_glColor3dv = this->m_ptr_glColor3dv;
+if(this->m_ptr_glColor3dv)this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&CaptureTableDecorator::m_glColor3dv_capture;
+this->m_orig_glVertexArrayVertexAttribDivisorEXT = this->m_ptr_glVertexArrayVertexAttribDivisorEXT;
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT)this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_capture;
+this->m_orig_glArrayElementEXT = this->m_ptr_glArrayElementEXT;
+if(this->m_ptr_glArrayElementEXT)this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&CaptureTableDecorator::m_glArrayElementEXT_capture;
+this->m_orig_glProgramParameter4dNV = this->m_ptr_glProgramParameter4dNV;
+if(this->m_ptr_glProgramParameter4dNV)this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&CaptureTableDecorator::m_glProgramParameter4dNV_capture;
+this->m_orig_glIndexxOES = this->m_ptr_glIndexxOES;
+if(this->m_ptr_glIndexxOES)this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&CaptureTableDecorator::m_glIndexxOES_capture;
+this->m_orig_glUniform3uivEXT = this->m_ptr_glUniform3uivEXT;
+if(this->m_ptr_glUniform3uivEXT)this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&CaptureTableDecorator::m_glUniform3uivEXT_capture;
+this->m_orig_glPopGroupMarkerEXT = this->m_ptr_glPopGroupMarkerEXT;
+if(this->m_ptr_glPopGroupMarkerEXT)this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&CaptureTableDecorator::m_glPopGroupMarkerEXT_capture;
+this->m_orig_glClearNamedFramebufferuiv = this->m_ptr_glClearNamedFramebufferuiv;
+if(this->m_ptr_glClearNamedFramebufferuiv)this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&CaptureTableDecorator::m_glClearNamedFramebufferuiv_capture;
+this->m_orig_glSetLocalConstantEXT = this->m_ptr_glSetLocalConstantEXT;
+if(this->m_ptr_glSetLocalConstantEXT)this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&CaptureTableDecorator::m_glSetLocalConstantEXT_capture;
+this->m_orig_glProgramUniform1ui64NV = this->m_ptr_glProgramUniform1ui64NV;
+if(this->m_ptr_glProgramUniform1ui64NV)this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&CaptureTableDecorator::m_glProgramUniform1ui64NV_capture;
+this->m_orig_glColor4hvNV = this->m_ptr_glColor4hvNV;
+if(this->m_ptr_glColor4hvNV)this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&CaptureTableDecorator::m_glColor4hvNV_capture;
+this->m_orig_glGetVertexAttribfv = this->m_ptr_glGetVertexAttribfv;
+if(this->m_ptr_glGetVertexAttribfv)this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&CaptureTableDecorator::m_glGetVertexAttribfv_capture;
+this->m_orig_glDispatchCompute = this->m_ptr_glDispatchCompute;
+if(this->m_ptr_glDispatchCompute)this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&CaptureTableDecorator::m_glDispatchCompute_capture;
+this->m_orig_glGetActiveAttrib = this->m_ptr_glGetActiveAttrib;
+if(this->m_ptr_glGetActiveAttrib)this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&CaptureTableDecorator::m_glGetActiveAttrib_capture;
+this->m_orig_glFragmentColorMaterialSGIX = this->m_ptr_glFragmentColorMaterialSGIX;
+if(this->m_ptr_glFragmentColorMaterialSGIX)this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&CaptureTableDecorator::m_glFragmentColorMaterialSGIX_capture;
+this->m_orig_glTexSubImage2D = this->m_ptr_glTexSubImage2D;
+if(this->m_ptr_glTexSubImage2D)this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&CaptureTableDecorator::m_glTexSubImage2D_capture;
+this->m_orig_glGetnMinmaxARB = this->m_ptr_glGetnMinmaxARB;
+if(this->m_ptr_glGetnMinmaxARB)this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&CaptureTableDecorator::m_glGetnMinmaxARB_capture;
+this->m_orig_glLogicOp = this->m_ptr_glLogicOp;
+if(this->m_ptr_glLogicOp)this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&CaptureTableDecorator::m_glLogicOp_capture;
+this->m_orig_glProgramUniformMatrix3x4fv = this->m_ptr_glProgramUniformMatrix3x4fv;
+if(this->m_ptr_glProgramUniformMatrix3x4fv)this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x4fv_capture;
+this->m_orig_glWindowPos4iMESA = this->m_ptr_glWindowPos4iMESA;
+if(this->m_ptr_glWindowPos4iMESA)this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&CaptureTableDecorator::m_glWindowPos4iMESA_capture;
+this->m_orig_glPixelTransferf = this->m_ptr_glPixelTransferf;
+if(this->m_ptr_glPixelTransferf)this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&CaptureTableDecorator::m_glPixelTransferf_capture;
+this->m_orig_glGetTextureParameterIuiv = this->m_ptr_glGetTextureParameterIuiv;
+if(this->m_ptr_glGetTextureParameterIuiv)this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&CaptureTableDecorator::m_glGetTextureParameterIuiv_capture;
+this->m_orig_glMultiTexCoord1xOES = this->m_ptr_glMultiTexCoord1xOES;
+if(this->m_ptr_glMultiTexCoord1xOES)this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&CaptureTableDecorator::m_glMultiTexCoord1xOES_capture;
+this->m_orig_glProgramUniformMatrix4dv = this->m_ptr_glProgramUniformMatrix4dv;
+if(this->m_ptr_glProgramUniformMatrix4dv)this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4dv_capture;
+this->m_orig_glGetnUniformiv = this->m_ptr_glGetnUniformiv;
+if(this->m_ptr_glGetnUniformiv)this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&CaptureTableDecorator::m_glGetnUniformiv_capture;
+this->m_orig_glFramebufferTexture1DEXT = this->m_ptr_glFramebufferTexture1DEXT;
+if(this->m_ptr_glFramebufferTexture1DEXT)this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&CaptureTableDecorator::m_glFramebufferTexture1DEXT_capture;
+this->m_orig_glVertexPointervINTEL = this->m_ptr_glVertexPointervINTEL;
+if(this->m_ptr_glVertexPointervINTEL)this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&CaptureTableDecorator::m_glVertexPointervINTEL_capture;
+this->m_orig_glTextureParameterIiv = this->m_ptr_glTextureParameterIiv;
+if(this->m_ptr_glTextureParameterIiv)this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&CaptureTableDecorator::m_glTextureParameterIiv_capture;
+this->m_orig_glGetSeparableFilterEXT = this->m_ptr_glGetSeparableFilterEXT;
+if(this->m_ptr_glGetSeparableFilterEXT)this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&CaptureTableDecorator::m_glGetSeparableFilterEXT_capture;
+this->m_orig_glMultiTexCoord3iARB = this->m_ptr_glMultiTexCoord3iARB;
+if(this->m_ptr_glMultiTexCoord3iARB)this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3iARB_capture;
+this->m_orig_glRasterPos4xvOES = this->m_ptr_glRasterPos4xvOES;
+if(this->m_ptr_glRasterPos4xvOES)this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&CaptureTableDecorator::m_glRasterPos4xvOES_capture;
+this->m_orig_glDrawTransformFeedbackStream = this->m_ptr_glDrawTransformFeedbackStream;
+if(this->m_ptr_glDrawTransformFeedbackStream)this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&CaptureTableDecorator::m_glDrawTransformFeedbackStream_capture;
+this->m_orig_glVertex3hvNV = this->m_ptr_glVertex3hvNV;
+if(this->m_ptr_glVertex3hvNV)this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&CaptureTableDecorator::m_glVertex3hvNV_capture;
+this->m_orig_glVertexArrayMultiTexCoordOffsetEXT = this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT)this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_capture;
+this->m_orig_glProvokingVertex = this->m_ptr_glProvokingVertex;
+if(this->m_ptr_glProvokingVertex)this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&CaptureTableDecorator::m_glProvokingVertex_capture;
+this->m_orig_glAccumxOES = this->m_ptr_glAccumxOES;
+if(this->m_ptr_glAccumxOES)this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&CaptureTableDecorator::m_glAccumxOES_capture;
+this->m_orig_glShaderBinary = this->m_ptr_glShaderBinary;
+if(this->m_ptr_glShaderBinary)this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&CaptureTableDecorator::m_glShaderBinary_capture;
+this->m_orig_glGetMultiTexGenivEXT = this->m_ptr_glGetMultiTexGenivEXT;
+if(this->m_ptr_glGetMultiTexGenivEXT)this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexGenivEXT_capture;
+this->m_orig_glPointParameterxvOES = this->m_ptr_glPointParameterxvOES;
+if(this->m_ptr_glPointParameterxvOES)this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&CaptureTableDecorator::m_glPointParameterxvOES_capture;
+this->m_orig_glCreateStatesNV = this->m_ptr_glCreateStatesNV;
+if(this->m_ptr_glCreateStatesNV)this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&CaptureTableDecorator::m_glCreateStatesNV_capture;
+this->m_orig_glClearDepthdNV = this->m_ptr_glClearDepthdNV;
+if(this->m_ptr_glClearDepthdNV)this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&CaptureTableDecorator::m_glClearDepthdNV_capture;
+this->m_orig_glClearColorIuiEXT = this->m_ptr_glClearColorIuiEXT;
+if(this->m_ptr_glClearColorIuiEXT)this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&CaptureTableDecorator::m_glClearColorIuiEXT_capture;
+this->m_orig_glBindMultiTextureEXT = this->m_ptr_glBindMultiTextureEXT;
+if(this->m_ptr_glBindMultiTextureEXT)this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&CaptureTableDecorator::m_glBindMultiTextureEXT_capture;
+this->m_orig_glTexGeniv = this->m_ptr_glTexGeniv;
+if(this->m_ptr_glTexGeniv)this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&CaptureTableDecorator::m_glTexGeniv_capture;
+this->m_orig_glDrawElements = this->m_ptr_glDrawElements;
+if(this->m_ptr_glDrawElements)this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&CaptureTableDecorator::m_glDrawElements_capture;
+this->m_orig_glProgramUniform4iv = this->m_ptr_glProgramUniform4iv;
+if(this->m_ptr_glProgramUniform4iv)this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&CaptureTableDecorator::m_glProgramUniform4iv_capture;
+this->m_orig_glDisableVertexArrayEXT = this->m_ptr_glDisableVertexArrayEXT;
+if(this->m_ptr_glDisableVertexArrayEXT)this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&CaptureTableDecorator::m_glDisableVertexArrayEXT_capture;
+this->m_orig_glProgramUniform3ui64NV = this->m_ptr_glProgramUniform3ui64NV;
+if(this->m_ptr_glProgramUniform3ui64NV)this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&CaptureTableDecorator::m_glProgramUniform3ui64NV_capture;
+this->m_orig_glClientActiveTexture = this->m_ptr_glClientActiveTexture;
+if(this->m_ptr_glClientActiveTexture)this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&CaptureTableDecorator::m_glClientActiveTexture_capture;
+this->m_orig_glMultiTexParameterIivEXT = this->m_ptr_glMultiTexParameterIivEXT;
+if(this->m_ptr_glMultiTexParameterIivEXT)this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glMultiTexParameterIivEXT_capture;
+this->m_orig_glUniform1i64ARB = this->m_ptr_glUniform1i64ARB;
+if(this->m_ptr_glUniform1i64ARB)this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&CaptureTableDecorator::m_glUniform1i64ARB_capture;
+this->m_orig_glUniform1iv = this->m_ptr_glUniform1iv;
+if(this->m_ptr_glUniform1iv)this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&CaptureTableDecorator::m_glUniform1iv_capture;
+this->m_orig_glMulticastBarrierNV = this->m_ptr_glMulticastBarrierNV;
+if(this->m_ptr_glMulticastBarrierNV)this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&CaptureTableDecorator::m_glMulticastBarrierNV_capture;
+this->m_orig_glVertexAttribArrayObjectATI = this->m_ptr_glVertexAttribArrayObjectATI;
+if(this->m_ptr_glVertexAttribArrayObjectATI)this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&CaptureTableDecorator::m_glVertexAttribArrayObjectATI_capture;
+this->m_orig_glUniform2iARB = this->m_ptr_glUniform2iARB;
+if(this->m_ptr_glUniform2iARB)this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&CaptureTableDecorator::m_glUniform2iARB_capture;
+this->m_orig_glDrawArraysInstanced = this->m_ptr_glDrawArraysInstanced;
+if(this->m_ptr_glDrawArraysInstanced)this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&CaptureTableDecorator::m_glDrawArraysInstanced_capture;
+this->m_orig_glVertexAttrib2sNV = this->m_ptr_glVertexAttrib2sNV;
+if(this->m_ptr_glVertexAttrib2sNV)this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&CaptureTableDecorator::m_glVertexAttrib2sNV_capture;
+this->m_orig_glTexBufferEXT = this->m_ptr_glTexBufferEXT;
+if(this->m_ptr_glTexBufferEXT)this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&CaptureTableDecorator::m_glTexBufferEXT_capture;
+this->m_orig_glVertexStream2fATI = this->m_ptr_glVertexStream2fATI;
+if(this->m_ptr_glVertexStream2fATI)this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&CaptureTableDecorator::m_glVertexStream2fATI_capture;
+this->m_orig_glDebugMessageCallbackAMD = this->m_ptr_glDebugMessageCallbackAMD;
+if(this->m_ptr_glDebugMessageCallbackAMD)this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&CaptureTableDecorator::m_glDebugMessageCallbackAMD_capture;
+this->m_orig_glSamplerParameteriv = this->m_ptr_glSamplerParameteriv;
+if(this->m_ptr_glSamplerParameteriv)this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&CaptureTableDecorator::m_glSamplerParameteriv_capture;
+this->m_orig_glVertexAttrib4uiv = this->m_ptr_glVertexAttrib4uiv;
+if(this->m_ptr_glVertexAttrib4uiv)this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&CaptureTableDecorator::m_glVertexAttrib4uiv_capture;
+this->m_orig_glEndQueryIndexed = this->m_ptr_glEndQueryIndexed;
+if(this->m_ptr_glEndQueryIndexed)this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&CaptureTableDecorator::m_glEndQueryIndexed_capture;
+this->m_orig_glNormalStream3sATI = this->m_ptr_glNormalStream3sATI;
+if(this->m_ptr_glNormalStream3sATI)this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&CaptureTableDecorator::m_glNormalStream3sATI_capture;
+this->m_orig_glProgramParameteriARB = this->m_ptr_glProgramParameteriARB;
+if(this->m_ptr_glProgramParameteriARB)this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&CaptureTableDecorator::m_glProgramParameteriARB_capture;
+this->m_orig_glTexEnvxOES = this->m_ptr_glTexEnvxOES;
+if(this->m_ptr_glTexEnvxOES)this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&CaptureTableDecorator::m_glTexEnvxOES_capture;
+this->m_orig_glProgramUniform1iv = this->m_ptr_glProgramUniform1iv;
+if(this->m_ptr_glProgramUniform1iv)this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&CaptureTableDecorator::m_glProgramUniform1iv_capture;
+this->m_orig_glDisableVertexAttribAPPLE = this->m_ptr_glDisableVertexAttribAPPLE;
+if(this->m_ptr_glDisableVertexAttribAPPLE)this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&CaptureTableDecorator::m_glDisableVertexAttribAPPLE_capture;
+this->m_orig_glBindRenderbuffer = this->m_ptr_glBindRenderbuffer;
+if(this->m_ptr_glBindRenderbuffer)this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&CaptureTableDecorator::m_glBindRenderbuffer_capture;
+this->m_orig_glMultiTexSubImage3DEXT = this->m_ptr_glMultiTexSubImage3DEXT;
+if(this->m_ptr_glMultiTexSubImage3DEXT)this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&CaptureTableDecorator::m_glMultiTexSubImage3DEXT_capture;
+this->m_orig_glIsProgram = this->m_ptr_glIsProgram;
+if(this->m_ptr_glIsProgram)this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&CaptureTableDecorator::m_glIsProgram_capture;
+this->m_orig_glMultiDrawElementsIndirectAMD = this->m_ptr_glMultiDrawElementsIndirectAMD;
+if(this->m_ptr_glMultiDrawElementsIndirectAMD)this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirectAMD_capture;
+this->m_orig_glGetProgramInfoLog = this->m_ptr_glGetProgramInfoLog;
+if(this->m_ptr_glGetProgramInfoLog)this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&CaptureTableDecorator::m_glGetProgramInfoLog_capture;
+this->m_orig_glGetLocalConstantBooleanvEXT = this->m_ptr_glGetLocalConstantBooleanvEXT;
+if(this->m_ptr_glGetLocalConstantBooleanvEXT)this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&CaptureTableDecorator::m_glGetLocalConstantBooleanvEXT_capture;
+this->m_orig_glPixelTransformParameteriEXT = this->m_ptr_glPixelTransformParameteriEXT;
+if(this->m_ptr_glPixelTransformParameteriEXT)this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&CaptureTableDecorator::m_glPixelTransformParameteriEXT_capture;
+this->m_orig_glTexCoord4bOES = this->m_ptr_glTexCoord4bOES;
+if(this->m_ptr_glTexCoord4bOES)this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&CaptureTableDecorator::m_glTexCoord4bOES_capture;
+this->m_orig_glVertexAttrib4fv = this->m_ptr_glVertexAttrib4fv;
+if(this->m_ptr_glVertexAttrib4fv)this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&CaptureTableDecorator::m_glVertexAttrib4fv_capture;
+this->m_orig_glProgramUniformMatrix2x3dv = this->m_ptr_glProgramUniformMatrix2x3dv;
+if(this->m_ptr_glProgramUniformMatrix2x3dv)this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x3dv_capture;
+this->m_orig_glProgramEnvParametersI4uivNV = this->m_ptr_glProgramEnvParametersI4uivNV;
+if(this->m_ptr_glProgramEnvParametersI4uivNV)this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&CaptureTableDecorator::m_glProgramEnvParametersI4uivNV_capture;
+this->m_orig_glTexCoord3xOES = this->m_ptr_glTexCoord3xOES;
+if(this->m_ptr_glTexCoord3xOES)this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&CaptureTableDecorator::m_glTexCoord3xOES_capture;
+this->m_orig_glLoadTransposeMatrixfARB = this->m_ptr_glLoadTransposeMatrixfARB;
+if(this->m_ptr_glLoadTransposeMatrixfARB)this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&CaptureTableDecorator::m_glLoadTransposeMatrixfARB_capture;
+this->m_orig_glImageTransformParameteriHP = this->m_ptr_glImageTransformParameteriHP;
+if(this->m_ptr_glImageTransformParameteriHP)this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&CaptureTableDecorator::m_glImageTransformParameteriHP_capture;
+this->m_orig_glMultiTexCoord4xOES = this->m_ptr_glMultiTexCoord4xOES;
+if(this->m_ptr_glMultiTexCoord4xOES)this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&CaptureTableDecorator::m_glMultiTexCoord4xOES_capture;
+this->m_orig_glVertexAttribs3fvNV = this->m_ptr_glVertexAttribs3fvNV;
+if(this->m_ptr_glVertexAttribs3fvNV)this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&CaptureTableDecorator::m_glVertexAttribs3fvNV_capture;
+this->m_orig_glVertexAttrib2fv = this->m_ptr_glVertexAttrib2fv;
+if(this->m_ptr_glVertexAttrib2fv)this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&CaptureTableDecorator::m_glVertexAttrib2fv_capture;
+this->m_orig_glUniform3ui64NV = this->m_ptr_glUniform3ui64NV;
+if(this->m_ptr_glUniform3ui64NV)this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&CaptureTableDecorator::m_glUniform3ui64NV_capture;
+this->m_orig_glCombinerParameterfvNV = this->m_ptr_glCombinerParameterfvNV;
+if(this->m_ptr_glCombinerParameterfvNV)this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&CaptureTableDecorator::m_glCombinerParameterfvNV_capture;
+this->m_orig_glFragmentMaterialiSGIX = this->m_ptr_glFragmentMaterialiSGIX;
+if(this->m_ptr_glFragmentMaterialiSGIX)this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&CaptureTableDecorator::m_glFragmentMaterialiSGIX_capture;
+this->m_orig_glGetBooleani_v = this->m_ptr_glGetBooleani_v;
+if(this->m_ptr_glGetBooleani_v)this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&CaptureTableDecorator::m_glGetBooleani_v_capture;
+this->m_orig_glGetProgramResourceIndex = this->m_ptr_glGetProgramResourceIndex;
+if(this->m_ptr_glGetProgramResourceIndex)this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&CaptureTableDecorator::m_glGetProgramResourceIndex_capture;
+this->m_orig_glBeginConditionalRenderNV = this->m_ptr_glBeginConditionalRenderNV;
+if(this->m_ptr_glBeginConditionalRenderNV)this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&CaptureTableDecorator::m_glBeginConditionalRenderNV_capture;
+this->m_orig_glDisableClientState = this->m_ptr_glDisableClientState;
+if(this->m_ptr_glDisableClientState)this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&CaptureTableDecorator::m_glDisableClientState_capture;
+this->m_orig_glPathFogGenNV = this->m_ptr_glPathFogGenNV;
+if(this->m_ptr_glPathFogGenNV)this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&CaptureTableDecorator::m_glPathFogGenNV_capture;
+this->m_orig_glStencilThenCoverFillPathNV = this->m_ptr_glStencilThenCoverFillPathNV;
+if(this->m_ptr_glStencilThenCoverFillPathNV)this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&CaptureTableDecorator::m_glStencilThenCoverFillPathNV_capture;
+this->m_orig_glVertexArrayIndexOffsetEXT = this->m_ptr_glVertexArrayIndexOffsetEXT;
+if(this->m_ptr_glVertexArrayIndexOffsetEXT)this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayIndexOffsetEXT_capture;
+this->m_orig_glProgramBufferParametersIuivNV = this->m_ptr_glProgramBufferParametersIuivNV;
+if(this->m_ptr_glProgramBufferParametersIuivNV)this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&CaptureTableDecorator::m_glProgramBufferParametersIuivNV_capture;
+this->m_orig_glPixelTransformParameterivEXT = this->m_ptr_glPixelTransformParameterivEXT;
+if(this->m_ptr_glPixelTransformParameterivEXT)this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glPixelTransformParameterivEXT_capture;
+this->m_orig_glDisableClientStateiEXT = this->m_ptr_glDisableClientStateiEXT;
+if(this->m_ptr_glDisableClientStateiEXT)this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&CaptureTableDecorator::m_glDisableClientStateiEXT_capture;
+this->m_orig_glTexBufferARB = this->m_ptr_glTexBufferARB;
+if(this->m_ptr_glTexBufferARB)this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&CaptureTableDecorator::m_glTexBufferARB_capture;
+this->m_orig_glGetLocalConstantIntegervEXT = this->m_ptr_glGetLocalConstantIntegervEXT;
+if(this->m_ptr_glGetLocalConstantIntegervEXT)this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&CaptureTableDecorator::m_glGetLocalConstantIntegervEXT_capture;
+this->m_orig_glColor4uiv = this->m_ptr_glColor4uiv;
+if(this->m_ptr_glColor4uiv)this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&CaptureTableDecorator::m_glColor4uiv_capture;
+this->m_orig_glProgramUniform3i = this->m_ptr_glProgramUniform3i;
+if(this->m_ptr_glProgramUniform3i)this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&CaptureTableDecorator::m_glProgramUniform3i_capture;
+this->m_orig_glMultiDrawElementsIndirectBindlessCountNV = this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV)this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_capture;
+this->m_orig_glGetBufferPointervARB = this->m_ptr_glGetBufferPointervARB;
+if(this->m_ptr_glGetBufferPointervARB)this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&CaptureTableDecorator::m_glGetBufferPointervARB_capture;
+this->m_orig_glMultiTexParameterIuivEXT = this->m_ptr_glMultiTexParameterIuivEXT;
+if(this->m_ptr_glMultiTexParameterIuivEXT)this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glMultiTexParameterIuivEXT_capture;
+this->m_orig_glEvalMesh2 = this->m_ptr_glEvalMesh2;
+if(this->m_ptr_glEvalMesh2)this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&CaptureTableDecorator::m_glEvalMesh2_capture;
+this->m_orig_glEvalMesh1 = this->m_ptr_glEvalMesh1;
+if(this->m_ptr_glEvalMesh1)this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&CaptureTableDecorator::m_glEvalMesh1_capture;
+this->m_orig_glProgramUniform3f = this->m_ptr_glProgramUniform3f;
+if(this->m_ptr_glProgramUniform3f)this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&CaptureTableDecorator::m_glProgramUniform3f_capture;
+this->m_orig_glStencilThenCoverFillPathInstancedNV = this->m_ptr_glStencilThenCoverFillPathInstancedNV;
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV)this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glStencilThenCoverFillPathInstancedNV_capture;
+this->m_orig_glProgramUniform3d = this->m_ptr_glProgramUniform3d;
+if(this->m_ptr_glProgramUniform3d)this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&CaptureTableDecorator::m_glProgramUniform3d_capture;
+this->m_orig_glMapVertexAttrib1dAPPLE = this->m_ptr_glMapVertexAttrib1dAPPLE;
+if(this->m_ptr_glMapVertexAttrib1dAPPLE)this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&CaptureTableDecorator::m_glMapVertexAttrib1dAPPLE_capture;
+this->m_orig_glEvalCoord2fv = this->m_ptr_glEvalCoord2fv;
+if(this->m_ptr_glEvalCoord2fv)this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&CaptureTableDecorator::m_glEvalCoord2fv_capture;
+this->m_orig_glGetUniformivARB = this->m_ptr_glGetUniformivARB;
+if(this->m_ptr_glGetUniformivARB)this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&CaptureTableDecorator::m_glGetUniformivARB_capture;
+this->m_orig_glLoadTransposeMatrixd = this->m_ptr_glLoadTransposeMatrixd;
+if(this->m_ptr_glLoadTransposeMatrixd)this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&CaptureTableDecorator::m_glLoadTransposeMatrixd_capture;
+this->m_orig_glLoadTransposeMatrixf = this->m_ptr_glLoadTransposeMatrixf;
+if(this->m_ptr_glLoadTransposeMatrixf)this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&CaptureTableDecorator::m_glLoadTransposeMatrixf_capture;
+this->m_orig_glGetPointervEXT = this->m_ptr_glGetPointervEXT;
+if(this->m_ptr_glGetPointervEXT)this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&CaptureTableDecorator::m_glGetPointervEXT_capture;
+this->m_orig_glSignalVkSemaphoreNV = this->m_ptr_glSignalVkSemaphoreNV;
+if(this->m_ptr_glSignalVkSemaphoreNV)this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&CaptureTableDecorator::m_glSignalVkSemaphoreNV_capture;
+this->m_orig_glEndConditionalRenderNV = this->m_ptr_glEndConditionalRenderNV;
+if(this->m_ptr_glEndConditionalRenderNV)this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&CaptureTableDecorator::m_glEndConditionalRenderNV_capture;
+this->m_orig_glTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_capture;
+this->m_orig_glUniform3i64vARB = this->m_ptr_glUniform3i64vARB;
+if(this->m_ptr_glUniform3i64vARB)this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&CaptureTableDecorator::m_glUniform3i64vARB_capture;
+this->m_orig_glProgramUniform2uiEXT = this->m_ptr_glProgramUniform2uiEXT;
+if(this->m_ptr_glProgramUniform2uiEXT)this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&CaptureTableDecorator::m_glProgramUniform2uiEXT_capture;
+this->m_orig_glVertexAttribI1ui = this->m_ptr_glVertexAttribI1ui;
+if(this->m_ptr_glVertexAttribI1ui)this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&CaptureTableDecorator::m_glVertexAttribI1ui_capture;
+this->m_orig_glProgramNamedParameter4dvNV = this->m_ptr_glProgramNamedParameter4dvNV;
+if(this->m_ptr_glProgramNamedParameter4dvNV)this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&CaptureTableDecorator::m_glProgramNamedParameter4dvNV_capture;
+this->m_orig_glCompileCommandListNV = this->m_ptr_glCompileCommandListNV;
+if(this->m_ptr_glCompileCommandListNV)this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&CaptureTableDecorator::m_glCompileCommandListNV_capture;
+this->m_orig_glGetRenderbufferParameterivEXT = this->m_ptr_glGetRenderbufferParameterivEXT;
+if(this->m_ptr_glGetRenderbufferParameterivEXT)this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetRenderbufferParameterivEXT_capture;
+this->m_orig_glGetnPolygonStipple = this->m_ptr_glGetnPolygonStipple;
+if(this->m_ptr_glGetnPolygonStipple)this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&CaptureTableDecorator::m_glGetnPolygonStipple_capture;
+this->m_orig_glIsBufferResidentNV = this->m_ptr_glIsBufferResidentNV;
+if(this->m_ptr_glIsBufferResidentNV)this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&CaptureTableDecorator::m_glIsBufferResidentNV_capture;
+this->m_orig_glSecondaryColor3ubvEXT = this->m_ptr_glSecondaryColor3ubvEXT;
+if(this->m_ptr_glSecondaryColor3ubvEXT)this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3ubvEXT_capture;
+this->m_orig_glGetNamedRenderbufferParameterivEXT = this->m_ptr_glGetNamedRenderbufferParameterivEXT;
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT)this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetNamedRenderbufferParameterivEXT_capture;
+this->m_orig_glNamedFramebufferSampleLocationsfvARB = this->m_ptr_glNamedFramebufferSampleLocationsfvARB;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB)this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&CaptureTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_capture;
+this->m_orig_glMultiTexGendvEXT = this->m_ptr_glMultiTexGendvEXT;
+if(this->m_ptr_glMultiTexGendvEXT)this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&CaptureTableDecorator::m_glMultiTexGendvEXT_capture;
+this->m_orig_glVertexArrayRangeNV = this->m_ptr_glVertexArrayRangeNV;
+if(this->m_ptr_glVertexArrayRangeNV)this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&CaptureTableDecorator::m_glVertexArrayRangeNV_capture;
+this->m_orig_glIsTextureHandleResidentNV = this->m_ptr_glIsTextureHandleResidentNV;
+if(this->m_ptr_glIsTextureHandleResidentNV)this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&CaptureTableDecorator::m_glIsTextureHandleResidentNV_capture;
+this->m_orig_glGetProgramEnvParameterdvARB = this->m_ptr_glGetProgramEnvParameterdvARB;
+if(this->m_ptr_glGetProgramEnvParameterdvARB)this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&CaptureTableDecorator::m_glGetProgramEnvParameterdvARB_capture;
+this->m_orig_glIsNamedStringARB = this->m_ptr_glIsNamedStringARB;
+if(this->m_ptr_glIsNamedStringARB)this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&CaptureTableDecorator::m_glIsNamedStringARB_capture;
+this->m_orig_glSecondaryColorFormatNV = this->m_ptr_glSecondaryColorFormatNV;
+if(this->m_ptr_glSecondaryColorFormatNV)this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&CaptureTableDecorator::m_glSecondaryColorFormatNV_capture;
+this->m_orig_glVertexAttrib4ubvNV = this->m_ptr_glVertexAttrib4ubvNV;
+if(this->m_ptr_glVertexAttrib4ubvNV)this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&CaptureTableDecorator::m_glVertexAttrib4ubvNV_capture;
+this->m_orig_glTagSampleBufferSGIX = this->m_ptr_glTagSampleBufferSGIX;
+if(this->m_ptr_glTagSampleBufferSGIX)this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&CaptureTableDecorator::m_glTagSampleBufferSGIX_capture;
+this->m_orig_glVDPAUUnregisterSurfaceNV = this->m_ptr_glVDPAUUnregisterSurfaceNV;
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV)this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&CaptureTableDecorator::m_glVDPAUUnregisterSurfaceNV_capture;
+this->m_orig_glGetPerfQueryIdByNameINTEL = this->m_ptr_glGetPerfQueryIdByNameINTEL;
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL)this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&CaptureTableDecorator::m_glGetPerfQueryIdByNameINTEL_capture;
+this->m_orig_glGetInteger64v = this->m_ptr_glGetInteger64v;
+if(this->m_ptr_glGetInteger64v)this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&CaptureTableDecorator::m_glGetInteger64v_capture;
+this->m_orig_glClipPlane = this->m_ptr_glClipPlane;
+if(this->m_ptr_glClipPlane)this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&CaptureTableDecorator::m_glClipPlane_capture;
+this->m_orig_glColor4ubVertex3fSUN = this->m_ptr_glColor4ubVertex3fSUN;
+if(this->m_ptr_glColor4ubVertex3fSUN)this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&CaptureTableDecorator::m_glColor4ubVertex3fSUN_capture;
+this->m_orig_glIndexub = this->m_ptr_glIndexub;
+if(this->m_ptr_glIndexub)this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&CaptureTableDecorator::m_glIndexub_capture;
+this->m_orig_glGetProgramEnvParameterfvARB = this->m_ptr_glGetProgramEnvParameterfvARB;
+if(this->m_ptr_glGetProgramEnvParameterfvARB)this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&CaptureTableDecorator::m_glGetProgramEnvParameterfvARB_capture;
+this->m_orig_glVertexAttrib4usvARB = this->m_ptr_glVertexAttrib4usvARB;
+if(this->m_ptr_glVertexAttrib4usvARB)this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4usvARB_capture;
+this->m_orig_glNamedFramebufferRenderbuffer = this->m_ptr_glNamedFramebufferRenderbuffer;
+if(this->m_ptr_glNamedFramebufferRenderbuffer)this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&CaptureTableDecorator::m_glNamedFramebufferRenderbuffer_capture;
+this->m_orig_glProgramUniformMatrix3x4dv = this->m_ptr_glProgramUniformMatrix3x4dv;
+if(this->m_ptr_glProgramUniformMatrix3x4dv)this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x4dv_capture;
+this->m_orig_glTestFenceAPPLE = this->m_ptr_glTestFenceAPPLE;
+if(this->m_ptr_glTestFenceAPPLE)this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&CaptureTableDecorator::m_glTestFenceAPPLE_capture;
+this->m_orig_glVertexAttrib4Niv = this->m_ptr_glVertexAttrib4Niv;
+if(this->m_ptr_glVertexAttrib4Niv)this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&CaptureTableDecorator::m_glVertexAttrib4Niv_capture;
+this->m_orig_glVertexAttribL2i64vNV = this->m_ptr_glVertexAttribL2i64vNV;
+if(this->m_ptr_glVertexAttribL2i64vNV)this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL2i64vNV_capture;
+this->m_orig_glColorP4uiv = this->m_ptr_glColorP4uiv;
+if(this->m_ptr_glColorP4uiv)this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&CaptureTableDecorator::m_glColorP4uiv_capture;
+this->m_orig_glUniformMatrix2x3fv = this->m_ptr_glUniformMatrix2x3fv;
+if(this->m_ptr_glUniformMatrix2x3fv)this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&CaptureTableDecorator::m_glUniformMatrix2x3fv_capture;
+this->m_orig_glCallCommandListNV = this->m_ptr_glCallCommandListNV;
+if(this->m_ptr_glCallCommandListNV)this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&CaptureTableDecorator::m_glCallCommandListNV_capture;
+this->m_orig_glClearBufferiv = this->m_ptr_glClearBufferiv;
+if(this->m_ptr_glClearBufferiv)this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&CaptureTableDecorator::m_glClearBufferiv_capture;
+this->m_orig_glNamedStringARB = this->m_ptr_glNamedStringARB;
+if(this->m_ptr_glNamedStringARB)this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&CaptureTableDecorator::m_glNamedStringARB_capture;
+this->m_orig_glMatrixMult3x2fNV = this->m_ptr_glMatrixMult3x2fNV;
+if(this->m_ptr_glMatrixMult3x2fNV)this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&CaptureTableDecorator::m_glMatrixMult3x2fNV_capture;
+this->m_orig_glGetNamedProgramStringEXT = this->m_ptr_glGetNamedProgramStringEXT;
+if(this->m_ptr_glGetNamedProgramStringEXT)this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramStringEXT_capture;
+this->m_orig_glGetnHistogramARB = this->m_ptr_glGetnHistogramARB;
+if(this->m_ptr_glGetnHistogramARB)this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&CaptureTableDecorator::m_glGetnHistogramARB_capture;
+this->m_orig_glGetTextureLevelParameterfv = this->m_ptr_glGetTextureLevelParameterfv;
+if(this->m_ptr_glGetTextureLevelParameterfv)this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&CaptureTableDecorator::m_glGetTextureLevelParameterfv_capture;
+this->m_orig_glMultiTexCoord1fv = this->m_ptr_glMultiTexCoord1fv;
+if(this->m_ptr_glMultiTexCoord1fv)this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&CaptureTableDecorator::m_glMultiTexCoord1fv_capture;
+this->m_orig_glBitmapxOES = this->m_ptr_glBitmapxOES;
+if(this->m_ptr_glBitmapxOES)this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&CaptureTableDecorator::m_glBitmapxOES_capture;
+this->m_orig_glGetSamplerParameterIuiv = this->m_ptr_glGetSamplerParameterIuiv;
+if(this->m_ptr_glGetSamplerParameterIuiv)this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&CaptureTableDecorator::m_glGetSamplerParameterIuiv_capture;
+this->m_orig_glTexCoordP3ui = this->m_ptr_glTexCoordP3ui;
+if(this->m_ptr_glTexCoordP3ui)this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&CaptureTableDecorator::m_glTexCoordP3ui_capture;
+this->m_orig_glTextureSubImage1D = this->m_ptr_glTextureSubImage1D;
+if(this->m_ptr_glTextureSubImage1D)this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&CaptureTableDecorator::m_glTextureSubImage1D_capture;
+this->m_orig_glVertexAttribLPointerEXT = this->m_ptr_glVertexAttribLPointerEXT;
+if(this->m_ptr_glVertexAttribLPointerEXT)this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&CaptureTableDecorator::m_glVertexAttribLPointerEXT_capture;
+this->m_orig_glFogCoordPointerEXT = this->m_ptr_glFogCoordPointerEXT;
+if(this->m_ptr_glFogCoordPointerEXT)this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&CaptureTableDecorator::m_glFogCoordPointerEXT_capture;
+this->m_orig_glWindowPos3s = this->m_ptr_glWindowPos3s;
+if(this->m_ptr_glWindowPos3s)this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&CaptureTableDecorator::m_glWindowPos3s_capture;
+this->m_orig_glVertexAttribs2svNV = this->m_ptr_glVertexAttribs2svNV;
+if(this->m_ptr_glVertexAttribs2svNV)this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&CaptureTableDecorator::m_glVertexAttribs2svNV_capture;
+this->m_orig_glTextureImage3DEXT = this->m_ptr_glTextureImage3DEXT;
+if(this->m_ptr_glTextureImage3DEXT)this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&CaptureTableDecorator::m_glTextureImage3DEXT_capture;
+this->m_orig_glWindowPos3i = this->m_ptr_glWindowPos3i;
+if(this->m_ptr_glWindowPos3i)this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&CaptureTableDecorator::m_glWindowPos3i_capture;
+this->m_orig_glWindowPos3d = this->m_ptr_glWindowPos3d;
+if(this->m_ptr_glWindowPos3d)this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&CaptureTableDecorator::m_glWindowPos3d_capture;
+this->m_orig_glWindowPos3f = this->m_ptr_glWindowPos3f;
+if(this->m_ptr_glWindowPos3f)this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&CaptureTableDecorator::m_glWindowPos3f_capture;
+this->m_orig_glIsEnabledIndexedEXT = this->m_ptr_glIsEnabledIndexedEXT;
+if(this->m_ptr_glIsEnabledIndexedEXT)this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&CaptureTableDecorator::m_glIsEnabledIndexedEXT_capture;
+this->m_orig_glGetNamedProgramivEXT = this->m_ptr_glGetNamedProgramivEXT;
+if(this->m_ptr_glGetNamedProgramivEXT)this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramivEXT_capture;
+this->m_orig_glVertex3xvOES = this->m_ptr_glVertex3xvOES;
+if(this->m_ptr_glVertex3xvOES)this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&CaptureTableDecorator::m_glVertex3xvOES_capture;
+this->m_orig_glColor3us = this->m_ptr_glColor3us;
+if(this->m_ptr_glColor3us)this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&CaptureTableDecorator::m_glColor3us_capture;
+this->m_orig_glBeginPerfMonitorAMD = this->m_ptr_glBeginPerfMonitorAMD;
+if(this->m_ptr_glBeginPerfMonitorAMD)this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&CaptureTableDecorator::m_glBeginPerfMonitorAMD_capture;
+this->m_orig_glProgramUniformMatrix4x3dv = this->m_ptr_glProgramUniformMatrix4x3dv;
+if(this->m_ptr_glProgramUniformMatrix4x3dv)this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x3dv_capture;
+this->m_orig_glGetNamedProgramLocalParameterIuivEXT = this->m_ptr_glGetNamedProgramLocalParameterIuivEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT)this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_capture;
+this->m_orig_glReadnPixels = this->m_ptr_glReadnPixels;
+if(this->m_ptr_glReadnPixels)this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&CaptureTableDecorator::m_glReadnPixels_capture;
+this->m_orig_glMultiTexCoord4f = this->m_ptr_glMultiTexCoord4f;
+if(this->m_ptr_glMultiTexCoord4f)this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&CaptureTableDecorator::m_glMultiTexCoord4f_capture;
+this->m_orig_glColor3ub = this->m_ptr_glColor3ub;
+if(this->m_ptr_glColor3ub)this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&CaptureTableDecorator::m_glColor3ub_capture;
+this->m_orig_glMultiTexCoord4d = this->m_ptr_glMultiTexCoord4d;
+if(this->m_ptr_glMultiTexCoord4d)this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&CaptureTableDecorator::m_glMultiTexCoord4d_capture;
+this->m_orig_glVertexAttribL3ui64NV = this->m_ptr_glVertexAttribL3ui64NV;
+if(this->m_ptr_glVertexAttribL3ui64NV)this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&CaptureTableDecorator::m_glVertexAttribL3ui64NV_capture;
+this->m_orig_glColor3ui = this->m_ptr_glColor3ui;
+if(this->m_ptr_glColor3ui)this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&CaptureTableDecorator::m_glColor3ui_capture;
+this->m_orig_glProgramUniform4fvEXT = this->m_ptr_glProgramUniform4fvEXT;
+if(this->m_ptr_glProgramUniform4fvEXT)this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&CaptureTableDecorator::m_glProgramUniform4fvEXT_capture;
+this->m_orig_glVertexAttrib2sARB = this->m_ptr_glVertexAttrib2sARB;
+if(this->m_ptr_glVertexAttrib2sARB)this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&CaptureTableDecorator::m_glVertexAttrib2sARB_capture;
+this->m_orig_glMultiTexCoord4i = this->m_ptr_glMultiTexCoord4i;
+if(this->m_ptr_glMultiTexCoord4i)this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&CaptureTableDecorator::m_glMultiTexCoord4i_capture;
+this->m_orig_glCheckFramebufferStatusEXT = this->m_ptr_glCheckFramebufferStatusEXT;
+if(this->m_ptr_glCheckFramebufferStatusEXT)this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&CaptureTableDecorator::m_glCheckFramebufferStatusEXT_capture;
+this->m_orig_glGetnMapivARB = this->m_ptr_glGetnMapivARB;
+if(this->m_ptr_glGetnMapivARB)this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&CaptureTableDecorator::m_glGetnMapivARB_capture;
+this->m_orig_glMultiTexCoord1ivARB = this->m_ptr_glMultiTexCoord1ivARB;
+if(this->m_ptr_glMultiTexCoord1ivARB)this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1ivARB_capture;
+this->m_orig_glDisableVertexAttribArrayARB = this->m_ptr_glDisableVertexAttribArrayARB;
+if(this->m_ptr_glDisableVertexAttribArrayARB)this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&CaptureTableDecorator::m_glDisableVertexAttribArrayARB_capture;
+this->m_orig_glGetPolygonStipple = this->m_ptr_glGetPolygonStipple;
+if(this->m_ptr_glGetPolygonStipple)this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&CaptureTableDecorator::m_glGetPolygonStipple_capture;
+this->m_orig_glVertexAttribI4ui = this->m_ptr_glVertexAttribI4ui;
+if(this->m_ptr_glVertexAttribI4ui)this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&CaptureTableDecorator::m_glVertexAttribI4ui_capture;
+this->m_orig_glGetPathDashArrayNV = this->m_ptr_glGetPathDashArrayNV;
+if(this->m_ptr_glGetPathDashArrayNV)this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&CaptureTableDecorator::m_glGetPathDashArrayNV_capture;
+this->m_orig_glMultiTexRenderbufferEXT = this->m_ptr_glMultiTexRenderbufferEXT;
+if(this->m_ptr_glMultiTexRenderbufferEXT)this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glMultiTexRenderbufferEXT_capture;
+this->m_orig_glCopyTextureSubImage1D = this->m_ptr_glCopyTextureSubImage1D;
+if(this->m_ptr_glCopyTextureSubImage1D)this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&CaptureTableDecorator::m_glCopyTextureSubImage1D_capture;
+this->m_orig_glDeleteOcclusionQueriesNV = this->m_ptr_glDeleteOcclusionQueriesNV;
+if(this->m_ptr_glDeleteOcclusionQueriesNV)this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&CaptureTableDecorator::m_glDeleteOcclusionQueriesNV_capture;
+this->m_orig_glVertex4hvNV = this->m_ptr_glVertex4hvNV;
+if(this->m_ptr_glVertex4hvNV)this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&CaptureTableDecorator::m_glVertex4hvNV_capture;
+this->m_orig_glGetnTexImage = this->m_ptr_glGetnTexImage;
+if(this->m_ptr_glGetnTexImage)this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&CaptureTableDecorator::m_glGetnTexImage_capture;
+this->m_orig_glProgramLocalParameter4dARB = this->m_ptr_glProgramLocalParameter4dARB;
+if(this->m_ptr_glProgramLocalParameter4dARB)this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&CaptureTableDecorator::m_glProgramLocalParameter4dARB_capture;
+this->m_orig_glBlendEquation = this->m_ptr_glBlendEquation;
+if(this->m_ptr_glBlendEquation)this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&CaptureTableDecorator::m_glBlendEquation_capture;
+this->m_orig_glUnlockArraysEXT = this->m_ptr_glUnlockArraysEXT;
+if(this->m_ptr_glUnlockArraysEXT)this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&CaptureTableDecorator::m_glUnlockArraysEXT_capture;
+this->m_orig_glGetQueryObjectui64vEXT = this->m_ptr_glGetQueryObjectui64vEXT;
+if(this->m_ptr_glGetQueryObjectui64vEXT)this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&CaptureTableDecorator::m_glGetQueryObjectui64vEXT_capture;
+this->m_orig_glVertexAttribI4uivEXT = this->m_ptr_glVertexAttribI4uivEXT;
+if(this->m_ptr_glVertexAttribI4uivEXT)this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4uivEXT_capture;
+this->m_orig_glUniform1i64vNV = this->m_ptr_glUniform1i64vNV;
+if(this->m_ptr_glUniform1i64vNV)this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&CaptureTableDecorator::m_glUniform1i64vNV_capture;
+this->m_orig_glMultiTexCoord3dv = this->m_ptr_glMultiTexCoord3dv;
+if(this->m_ptr_glMultiTexCoord3dv)this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&CaptureTableDecorator::m_glMultiTexCoord3dv_capture;
+this->m_orig_glColor4sv = this->m_ptr_glColor4sv;
+if(this->m_ptr_glColor4sv)this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&CaptureTableDecorator::m_glColor4sv_capture;
+this->m_orig_glVertexStream4ivATI = this->m_ptr_glVertexStream4ivATI;
+if(this->m_ptr_glVertexStream4ivATI)this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&CaptureTableDecorator::m_glVertexStream4ivATI_capture;
+this->m_orig_glPopClientAttrib = this->m_ptr_glPopClientAttrib;
+if(this->m_ptr_glPopClientAttrib)this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&CaptureTableDecorator::m_glPopClientAttrib_capture;
+this->m_orig_glClearBufferData = this->m_ptr_glClearBufferData;
+if(this->m_ptr_glClearBufferData)this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&CaptureTableDecorator::m_glClearBufferData_capture;
+this->m_orig_glGetProgramivNV = this->m_ptr_glGetProgramivNV;
+if(this->m_ptr_glGetProgramivNV)this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&CaptureTableDecorator::m_glGetProgramivNV_capture;
+this->m_orig_glBeginTransformFeedback = this->m_ptr_glBeginTransformFeedback;
+if(this->m_ptr_glBeginTransformFeedback)this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glBeginTransformFeedback_capture;
+this->m_orig_glFinishObjectAPPLE = this->m_ptr_glFinishObjectAPPLE;
+if(this->m_ptr_glFinishObjectAPPLE)this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&CaptureTableDecorator::m_glFinishObjectAPPLE_capture;
+this->m_orig_glGetMinmaxParameterivEXT = this->m_ptr_glGetMinmaxParameterivEXT;
+if(this->m_ptr_glGetMinmaxParameterivEXT)this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetMinmaxParameterivEXT_capture;
+this->m_orig_glColor3iv = this->m_ptr_glColor3iv;
+if(this->m_ptr_glColor3iv)this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&CaptureTableDecorator::m_glColor3iv_capture;
+this->m_orig_glVertexAttrib3sv = this->m_ptr_glVertexAttrib3sv;
+if(this->m_ptr_glVertexAttrib3sv)this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&CaptureTableDecorator::m_glVertexAttrib3sv_capture;
+this->m_orig_glCompressedTexImage1D = this->m_ptr_glCompressedTexImage1D;
+if(this->m_ptr_glCompressedTexImage1D)this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&CaptureTableDecorator::m_glCompressedTexImage1D_capture;
+this->m_orig_glDeleteTransformFeedbacks = this->m_ptr_glDeleteTransformFeedbacks;
+if(this->m_ptr_glDeleteTransformFeedbacks)this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&CaptureTableDecorator::m_glDeleteTransformFeedbacks_capture;
+this->m_orig_glGetVideoi64vNV = this->m_ptr_glGetVideoi64vNV;
+if(this->m_ptr_glGetVideoi64vNV)this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&CaptureTableDecorator::m_glGetVideoi64vNV_capture;
+this->m_orig_glDrawRangeElementsBaseVertex = this->m_ptr_glDrawRangeElementsBaseVertex;
+if(this->m_ptr_glDrawRangeElementsBaseVertex)this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&CaptureTableDecorator::m_glDrawRangeElementsBaseVertex_capture;
+this->m_orig_glUniform4i64vARB = this->m_ptr_glUniform4i64vARB;
+if(this->m_ptr_glUniform4i64vARB)this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&CaptureTableDecorator::m_glUniform4i64vARB_capture;
+this->m_orig_glTextureStorage3DMultisampleEXT = this->m_ptr_glTextureStorage3DMultisampleEXT;
+if(this->m_ptr_glTextureStorage3DMultisampleEXT)this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTextureStorage3DMultisampleEXT_capture;
+this->m_orig_glGetTexParameterfv = this->m_ptr_glGetTexParameterfv;
+if(this->m_ptr_glGetTexParameterfv)this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&CaptureTableDecorator::m_glGetTexParameterfv_capture;
+this->m_orig_glProgramUniformui64vNV = this->m_ptr_glProgramUniformui64vNV;
+if(this->m_ptr_glProgramUniformui64vNV)this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&CaptureTableDecorator::m_glProgramUniformui64vNV_capture;
+this->m_orig_glCompressedMultiTexImage1DEXT = this->m_ptr_glCompressedMultiTexImage1DEXT;
+if(this->m_ptr_glCompressedMultiTexImage1DEXT)this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexImage1DEXT_capture;
+this->m_orig_glProgramUniform2ivEXT = this->m_ptr_glProgramUniform2ivEXT;
+if(this->m_ptr_glProgramUniform2ivEXT)this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&CaptureTableDecorator::m_glProgramUniform2ivEXT_capture;
+this->m_orig_glPushGroupMarkerEXT = this->m_ptr_glPushGroupMarkerEXT;
+if(this->m_ptr_glPushGroupMarkerEXT)this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&CaptureTableDecorator::m_glPushGroupMarkerEXT_capture;
+this->m_orig_glVertexAttrib1dv = this->m_ptr_glVertexAttrib1dv;
+if(this->m_ptr_glVertexAttrib1dv)this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&CaptureTableDecorator::m_glVertexAttrib1dv_capture;
+this->m_orig_glMatrixLoadIdentityEXT = this->m_ptr_glMatrixLoadIdentityEXT;
+if(this->m_ptr_glMatrixLoadIdentityEXT)this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&CaptureTableDecorator::m_glMatrixLoadIdentityEXT_capture;
+this->m_orig_glMultTransposeMatrixxOES = this->m_ptr_glMultTransposeMatrixxOES;
+if(this->m_ptr_glMultTransposeMatrixxOES)this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&CaptureTableDecorator::m_glMultTransposeMatrixxOES_capture;
+this->m_orig_glGetPixelMapxv = this->m_ptr_glGetPixelMapxv;
+if(this->m_ptr_glGetPixelMapxv)this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&CaptureTableDecorator::m_glGetPixelMapxv_capture;
+this->m_orig_glFramebufferSampleLocationsfvARB = this->m_ptr_glFramebufferSampleLocationsfvARB;
+if(this->m_ptr_glFramebufferSampleLocationsfvARB)this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&CaptureTableDecorator::m_glFramebufferSampleLocationsfvARB_capture;
+this->m_orig_glGetLightiv = this->m_ptr_glGetLightiv;
+if(this->m_ptr_glGetLightiv)this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&CaptureTableDecorator::m_glGetLightiv_capture;
+this->m_orig_glBlendFuncSeparatei = this->m_ptr_glBlendFuncSeparatei;
+if(this->m_ptr_glBlendFuncSeparatei)this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&CaptureTableDecorator::m_glBlendFuncSeparatei_capture;
+this->m_orig_glAcquireKeyedMutexWin32EXT = this->m_ptr_glAcquireKeyedMutexWin32EXT;
+if(this->m_ptr_glAcquireKeyedMutexWin32EXT)this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&CaptureTableDecorator::m_glAcquireKeyedMutexWin32EXT_capture;
+this->m_orig_glGetBooleanIndexedvEXT = this->m_ptr_glGetBooleanIndexedvEXT;
+if(this->m_ptr_glGetBooleanIndexedvEXT)this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&CaptureTableDecorator::m_glGetBooleanIndexedvEXT_capture;
+this->m_orig_glGetProgramSubroutineParameteruivNV = this->m_ptr_glGetProgramSubroutineParameteruivNV;
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV)this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&CaptureTableDecorator::m_glGetProgramSubroutineParameteruivNV_capture;
+this->m_orig_glUniform2ui = this->m_ptr_glUniform2ui;
+if(this->m_ptr_glUniform2ui)this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&CaptureTableDecorator::m_glUniform2ui_capture;
+this->m_orig_glApplyFramebufferAttachmentCMAAINTEL = this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL;
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL)this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&CaptureTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_capture;
+this->m_orig_glWindowPos2fv = this->m_ptr_glWindowPos2fv;
+if(this->m_ptr_glWindowPos2fv)this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&CaptureTableDecorator::m_glWindowPos2fv_capture;
+this->m_orig_glWaitVkSemaphoreNV = this->m_ptr_glWaitVkSemaphoreNV;
+if(this->m_ptr_glWaitVkSemaphoreNV)this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&CaptureTableDecorator::m_glWaitVkSemaphoreNV_capture;
+this->m_orig_glDisablei = this->m_ptr_glDisablei;
+if(this->m_ptr_glDisablei)this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&CaptureTableDecorator::m_glDisablei_capture;
+this->m_orig_glSelectPerfMonitorCountersAMD = this->m_ptr_glSelectPerfMonitorCountersAMD;
+if(this->m_ptr_glSelectPerfMonitorCountersAMD)this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&CaptureTableDecorator::m_glSelectPerfMonitorCountersAMD_capture;
+this->m_orig_glGetVertexAttribLi64vNV = this->m_ptr_glGetVertexAttribLi64vNV;
+if(this->m_ptr_glGetVertexAttribLi64vNV)this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&CaptureTableDecorator::m_glGetVertexAttribLi64vNV_capture;
+this->m_orig_glBlendFuncSeparateiARB = this->m_ptr_glBlendFuncSeparateiARB;
+if(this->m_ptr_glBlendFuncSeparateiARB)this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&CaptureTableDecorator::m_glBlendFuncSeparateiARB_capture;
+this->m_orig_glWeightuivARB = this->m_ptr_glWeightuivARB;
+if(this->m_ptr_glWeightuivARB)this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&CaptureTableDecorator::m_glWeightuivARB_capture;
+this->m_orig_glWindowPos2iARB = this->m_ptr_glWindowPos2iARB;
+if(this->m_ptr_glWindowPos2iARB)this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&CaptureTableDecorator::m_glWindowPos2iARB_capture;
+this->m_orig_glGetProgramLocalParameterdvARB = this->m_ptr_glGetProgramLocalParameterdvARB;
+if(this->m_ptr_glGetProgramLocalParameterdvARB)this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&CaptureTableDecorator::m_glGetProgramLocalParameterdvARB_capture;
+this->m_orig_glGetUniformui64vARB = this->m_ptr_glGetUniformui64vARB;
+if(this->m_ptr_glGetUniformui64vARB)this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&CaptureTableDecorator::m_glGetUniformui64vARB_capture;
+this->m_orig_glSecondaryColor3us = this->m_ptr_glSecondaryColor3us;
+if(this->m_ptr_glSecondaryColor3us)this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&CaptureTableDecorator::m_glSecondaryColor3us_capture;
+this->m_orig_glGetSynciv = this->m_ptr_glGetSynciv;
+if(this->m_ptr_glGetSynciv)this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&CaptureTableDecorator::m_glGetSynciv_capture;
+this->m_orig_glMakeImageHandleResidentARB = this->m_ptr_glMakeImageHandleResidentARB;
+if(this->m_ptr_glMakeImageHandleResidentARB)this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&CaptureTableDecorator::m_glMakeImageHandleResidentARB_capture;
+this->m_orig_glGetProgramNamedParameterfvNV = this->m_ptr_glGetProgramNamedParameterfvNV;
+if(this->m_ptr_glGetProgramNamedParameterfvNV)this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetProgramNamedParameterfvNV_capture;
+this->m_orig_glTextureStorage3D = this->m_ptr_glTextureStorage3D;
+if(this->m_ptr_glTextureStorage3D)this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&CaptureTableDecorator::m_glTextureStorage3D_capture;
+this->m_orig_glVertexAttrib4svNV = this->m_ptr_glVertexAttrib4svNV;
+if(this->m_ptr_glVertexAttrib4svNV)this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&CaptureTableDecorator::m_glVertexAttrib4svNV_capture;
+this->m_orig_glProgramUniform2i = this->m_ptr_glProgramUniform2i;
+if(this->m_ptr_glProgramUniform2i)this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&CaptureTableDecorator::m_glProgramUniform2i_capture;
+this->m_orig_glListDrawCommandsStatesClientNV = this->m_ptr_glListDrawCommandsStatesClientNV;
+if(this->m_ptr_glListDrawCommandsStatesClientNV)this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&CaptureTableDecorator::m_glListDrawCommandsStatesClientNV_capture;
+this->m_orig_glProgramLocalParametersI4uivNV = this->m_ptr_glProgramLocalParametersI4uivNV;
+if(this->m_ptr_glProgramLocalParametersI4uivNV)this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&CaptureTableDecorator::m_glProgramLocalParametersI4uivNV_capture;
+this->m_orig_glBeginTransformFeedbackNV = this->m_ptr_glBeginTransformFeedbackNV;
+if(this->m_ptr_glBeginTransformFeedbackNV)this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glBeginTransformFeedbackNV_capture;
+this->m_orig_glGetProgramBinary = this->m_ptr_glGetProgramBinary;
+if(this->m_ptr_glGetProgramBinary)this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&CaptureTableDecorator::m_glGetProgramBinary_capture;
+this->m_orig_glBinormal3iEXT = this->m_ptr_glBinormal3iEXT;
+if(this->m_ptr_glBinormal3iEXT)this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&CaptureTableDecorator::m_glBinormal3iEXT_capture;
+this->m_orig_glEvalPoint1 = this->m_ptr_glEvalPoint1;
+if(this->m_ptr_glEvalPoint1)this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&CaptureTableDecorator::m_glEvalPoint1_capture;
+this->m_orig_glEvalPoint2 = this->m_ptr_glEvalPoint2;
+if(this->m_ptr_glEvalPoint2)this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&CaptureTableDecorator::m_glEvalPoint2_capture;
+this->m_orig_glPauseTransformFeedback = this->m_ptr_glPauseTransformFeedback;
+if(this->m_ptr_glPauseTransformFeedback)this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glPauseTransformFeedback_capture;
+this->m_orig_glWindowPos2sMESA = this->m_ptr_glWindowPos2sMESA;
+if(this->m_ptr_glWindowPos2sMESA)this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&CaptureTableDecorator::m_glWindowPos2sMESA_capture;
+this->m_orig_glGlobalAlphaFactorbSUN = this->m_ptr_glGlobalAlphaFactorbSUN;
+if(this->m_ptr_glGlobalAlphaFactorbSUN)this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactorbSUN_capture;
+this->m_orig_glCreateTransformFeedbacks = this->m_ptr_glCreateTransformFeedbacks;
+if(this->m_ptr_glCreateTransformFeedbacks)this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&CaptureTableDecorator::m_glCreateTransformFeedbacks_capture;
+this->m_orig_glTexturePageCommitmentEXT = this->m_ptr_glTexturePageCommitmentEXT;
+if(this->m_ptr_glTexturePageCommitmentEXT)this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&CaptureTableDecorator::m_glTexturePageCommitmentEXT_capture;
+this->m_orig_glTransformFeedbackVaryingsNV = this->m_ptr_glTransformFeedbackVaryingsNV;
+if(this->m_ptr_glTransformFeedbackVaryingsNV)this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&CaptureTableDecorator::m_glTransformFeedbackVaryingsNV_capture;
+this->m_orig_glTexSubImage1D = this->m_ptr_glTexSubImage1D;
+if(this->m_ptr_glTexSubImage1D)this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&CaptureTableDecorator::m_glTexSubImage1D_capture;
+this->m_orig_glConvolutionParameterfvEXT = this->m_ptr_glConvolutionParameterfvEXT;
+if(this->m_ptr_glConvolutionParameterfvEXT)this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glConvolutionParameterfvEXT_capture;
+this->m_orig_glBlitFramebufferEXT = this->m_ptr_glBlitFramebufferEXT;
+if(this->m_ptr_glBlitFramebufferEXT)this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&CaptureTableDecorator::m_glBlitFramebufferEXT_capture;
+this->m_orig_glUniformMatrix4fvARB = this->m_ptr_glUniformMatrix4fvARB;
+if(this->m_ptr_glUniformMatrix4fvARB)this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&CaptureTableDecorator::m_glUniformMatrix4fvARB_capture;
+this->m_orig_glProgramEnvParameter4dvARB = this->m_ptr_glProgramEnvParameter4dvARB;
+if(this->m_ptr_glProgramEnvParameter4dvARB)this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&CaptureTableDecorator::m_glProgramEnvParameter4dvARB_capture;
+this->m_orig_glTextureStorageMem2DEXT = this->m_ptr_glTextureStorageMem2DEXT;
+if(this->m_ptr_glTextureStorageMem2DEXT)this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&CaptureTableDecorator::m_glTextureStorageMem2DEXT_capture;
+this->m_orig_glVertexAttribP3uiv = this->m_ptr_glVertexAttribP3uiv;
+if(this->m_ptr_glVertexAttribP3uiv)this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&CaptureTableDecorator::m_glVertexAttribP3uiv_capture;
+this->m_orig_glFogCoordFormatNV = this->m_ptr_glFogCoordFormatNV;
+if(this->m_ptr_glFogCoordFormatNV)this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&CaptureTableDecorator::m_glFogCoordFormatNV_capture;
+this->m_orig_glGetMultiTexLevelParameterivEXT = this->m_ptr_glGetMultiTexLevelParameterivEXT;
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT)this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetMultiTexLevelParameterivEXT_capture;
+this->m_orig_glIsOcclusionQueryNV = this->m_ptr_glIsOcclusionQueryNV;
+if(this->m_ptr_glIsOcclusionQueryNV)this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&CaptureTableDecorator::m_glIsOcclusionQueryNV_capture;
+this->m_orig_glCompressedTexImage2DARB = this->m_ptr_glCompressedTexImage2DARB;
+if(this->m_ptr_glCompressedTexImage2DARB)this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&CaptureTableDecorator::m_glCompressedTexImage2DARB_capture;
+this->m_orig_glGetProgramEnvParameterIuivNV = this->m_ptr_glGetProgramEnvParameterIuivNV;
+if(this->m_ptr_glGetProgramEnvParameterIuivNV)this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&CaptureTableDecorator::m_glGetProgramEnvParameterIuivNV_capture;
+this->m_orig_glVertexAttrib4sv = this->m_ptr_glVertexAttrib4sv;
+if(this->m_ptr_glVertexAttrib4sv)this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&CaptureTableDecorator::m_glVertexAttrib4sv_capture;
+this->m_orig_glVertexAttrib4fvARB = this->m_ptr_glVertexAttrib4fvARB;
+if(this->m_ptr_glVertexAttrib4fvARB)this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4fvARB_capture;
+this->m_orig_glLoadName = this->m_ptr_glLoadName;
+if(this->m_ptr_glLoadName)this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&CaptureTableDecorator::m_glLoadName_capture;
+this->m_orig_glBindVertexShaderEXT = this->m_ptr_glBindVertexShaderEXT;
+if(this->m_ptr_glBindVertexShaderEXT)this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&CaptureTableDecorator::m_glBindVertexShaderEXT_capture;
+this->m_orig_glGetNamedProgramLocalParameterIivEXT = this->m_ptr_glGetNamedProgramLocalParameterIivEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT)this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_capture;
+this->m_orig_glProgramUniform3uiEXT = this->m_ptr_glProgramUniform3uiEXT;
+if(this->m_ptr_glProgramUniform3uiEXT)this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&CaptureTableDecorator::m_glProgramUniform3uiEXT_capture;
+this->m_orig_glProgramUniformMatrix4x2dvEXT = this->m_ptr_glProgramUniformMatrix4x2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT)this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x2dvEXT_capture;
+this->m_orig_glTexCoord1hvNV = this->m_ptr_glTexCoord1hvNV;
+if(this->m_ptr_glTexCoord1hvNV)this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&CaptureTableDecorator::m_glTexCoord1hvNV_capture;
+this->m_orig_glLoadMatrixd = this->m_ptr_glLoadMatrixd;
+if(this->m_ptr_glLoadMatrixd)this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&CaptureTableDecorator::m_glLoadMatrixd_capture;
+this->m_orig_glTexParameterfv = this->m_ptr_glTexParameterfv;
+if(this->m_ptr_glTexParameterfv)this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&CaptureTableDecorator::m_glTexParameterfv_capture;
+this->m_orig_glVariantdvEXT = this->m_ptr_glVariantdvEXT;
+if(this->m_ptr_glVariantdvEXT)this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&CaptureTableDecorator::m_glVariantdvEXT_capture;
+this->m_orig_glCullParameterfvEXT = this->m_ptr_glCullParameterfvEXT;
+if(this->m_ptr_glCullParameterfvEXT)this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glCullParameterfvEXT_capture;
+this->m_orig_glUniform3dv = this->m_ptr_glUniform3dv;
+if(this->m_ptr_glUniform3dv)this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&CaptureTableDecorator::m_glUniform3dv_capture;
+this->m_orig_glProgramUniform3fv = this->m_ptr_glProgramUniform3fv;
+if(this->m_ptr_glProgramUniform3fv)this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&CaptureTableDecorator::m_glProgramUniform3fv_capture;
+this->m_orig_glIsBufferARB = this->m_ptr_glIsBufferARB;
+if(this->m_ptr_glIsBufferARB)this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&CaptureTableDecorator::m_glIsBufferARB_capture;
+this->m_orig_glMultiTexCoord1bOES = this->m_ptr_glMultiTexCoord1bOES;
+if(this->m_ptr_glMultiTexCoord1bOES)this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&CaptureTableDecorator::m_glMultiTexCoord1bOES_capture;
+this->m_orig_glFogCoordhNV = this->m_ptr_glFogCoordhNV;
+if(this->m_ptr_glFogCoordhNV)this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&CaptureTableDecorator::m_glFogCoordhNV_capture;
+this->m_orig_glFramebufferSampleLocationsfvNV = this->m_ptr_glFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glFramebufferSampleLocationsfvNV)this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&CaptureTableDecorator::m_glFramebufferSampleLocationsfvNV_capture;
+this->m_orig_glGenSymbolsEXT = this->m_ptr_glGenSymbolsEXT;
+if(this->m_ptr_glGenSymbolsEXT)this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&CaptureTableDecorator::m_glGenSymbolsEXT_capture;
+this->m_orig_glGetConvolutionFilter = this->m_ptr_glGetConvolutionFilter;
+if(this->m_ptr_glGetConvolutionFilter)this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&CaptureTableDecorator::m_glGetConvolutionFilter_capture;
+this->m_orig_glProgramUniform1fvEXT = this->m_ptr_glProgramUniform1fvEXT;
+if(this->m_ptr_glProgramUniform1fvEXT)this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&CaptureTableDecorator::m_glProgramUniform1fvEXT_capture;
+this->m_orig_glGetNextPerfQueryIdINTEL = this->m_ptr_glGetNextPerfQueryIdINTEL;
+if(this->m_ptr_glGetNextPerfQueryIdINTEL)this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&CaptureTableDecorator::m_glGetNextPerfQueryIdINTEL_capture;
+this->m_orig_glCompressedTexImage1DARB = this->m_ptr_glCompressedTexImage1DARB;
+if(this->m_ptr_glCompressedTexImage1DARB)this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&CaptureTableDecorator::m_glCompressedTexImage1DARB_capture;
+this->m_orig_glBindSamplers = this->m_ptr_glBindSamplers;
+if(this->m_ptr_glBindSamplers)this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&CaptureTableDecorator::m_glBindSamplers_capture;
+this->m_orig_glGetProgramEnvParameterIivNV = this->m_ptr_glGetProgramEnvParameterIivNV;
+if(this->m_ptr_glGetProgramEnvParameterIivNV)this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&CaptureTableDecorator::m_glGetProgramEnvParameterIivNV_capture;
+this->m_orig_glGetQueryObjectui64v = this->m_ptr_glGetQueryObjectui64v;
+if(this->m_ptr_glGetQueryObjectui64v)this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&CaptureTableDecorator::m_glGetQueryObjectui64v_capture;
+this->m_orig_glVertexAttribL4ui64vNV = this->m_ptr_glVertexAttribL4ui64vNV;
+if(this->m_ptr_glVertexAttribL4ui64vNV)this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&CaptureTableDecorator::m_glVertexAttribL4ui64vNV_capture;
+this->m_orig_glGetVideoivNV = this->m_ptr_glGetVideoivNV;
+if(this->m_ptr_glGetVideoivNV)this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&CaptureTableDecorator::m_glGetVideoivNV_capture;
+this->m_orig_glGetTextureImage = this->m_ptr_glGetTextureImage;
+if(this->m_ptr_glGetTextureImage)this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&CaptureTableDecorator::m_glGetTextureImage_capture;
+this->m_orig_glProgramUniform1fv = this->m_ptr_glProgramUniform1fv;
+if(this->m_ptr_glProgramUniform1fv)this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&CaptureTableDecorator::m_glProgramUniform1fv_capture;
+this->m_orig_glUniformMatrix4fv = this->m_ptr_glUniformMatrix4fv;
+if(this->m_ptr_glUniformMatrix4fv)this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&CaptureTableDecorator::m_glUniformMatrix4fv_capture;
+this->m_orig_glColorMask = this->m_ptr_glColorMask;
+if(this->m_ptr_glColorMask)this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&CaptureTableDecorator::m_glColorMask_capture;
+this->m_orig_glBeginFragmentShaderATI = this->m_ptr_glBeginFragmentShaderATI;
+if(this->m_ptr_glBeginFragmentShaderATI)this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&CaptureTableDecorator::m_glBeginFragmentShaderATI_capture;
+this->m_orig_glMultiDrawArraysEXT = this->m_ptr_glMultiDrawArraysEXT;
+if(this->m_ptr_glMultiDrawArraysEXT)this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&CaptureTableDecorator::m_glMultiDrawArraysEXT_capture;
+this->m_orig_glGenNamesAMD = this->m_ptr_glGenNamesAMD;
+if(this->m_ptr_glGenNamesAMD)this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&CaptureTableDecorator::m_glGenNamesAMD_capture;
+this->m_orig_glPathParameteriNV = this->m_ptr_glPathParameteriNV;
+if(this->m_ptr_glPathParameteriNV)this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&CaptureTableDecorator::m_glPathParameteriNV_capture;
+this->m_orig_glCreateCommandListsNV = this->m_ptr_glCreateCommandListsNV;
+if(this->m_ptr_glCreateCommandListsNV)this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&CaptureTableDecorator::m_glCreateCommandListsNV_capture;
+this->m_orig_glDeleteProgramPipelines = this->m_ptr_glDeleteProgramPipelines;
+if(this->m_ptr_glDeleteProgramPipelines)this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&CaptureTableDecorator::m_glDeleteProgramPipelines_capture;
+this->m_orig_glCopyColorSubTableEXT = this->m_ptr_glCopyColorSubTableEXT;
+if(this->m_ptr_glCopyColorSubTableEXT)this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&CaptureTableDecorator::m_glCopyColorSubTableEXT_capture;
+this->m_orig_glVariantsvEXT = this->m_ptr_glVariantsvEXT;
+if(this->m_ptr_glVariantsvEXT)this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&CaptureTableDecorator::m_glVariantsvEXT_capture;
+this->m_orig_glGenProgramPipelines = this->m_ptr_glGenProgramPipelines;
+if(this->m_ptr_glGenProgramPipelines)this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&CaptureTableDecorator::m_glGenProgramPipelines_capture;
+this->m_orig_glVertexArrayEdgeFlagOffsetEXT = this->m_ptr_glVertexArrayEdgeFlagOffsetEXT;
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT)this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_capture;
+this->m_orig_glWindowPos2s = this->m_ptr_glWindowPos2s;
+if(this->m_ptr_glWindowPos2s)this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&CaptureTableDecorator::m_glWindowPos2s_capture;
+this->m_orig_glSecondaryColor3iEXT = this->m_ptr_glSecondaryColor3iEXT;
+if(this->m_ptr_glSecondaryColor3iEXT)this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3iEXT_capture;
+this->m_orig_glWindowPos2i = this->m_ptr_glWindowPos2i;
+if(this->m_ptr_glWindowPos2i)this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&CaptureTableDecorator::m_glWindowPos2i_capture;
+this->m_orig_glWindowPos2f = this->m_ptr_glWindowPos2f;
+if(this->m_ptr_glWindowPos2f)this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&CaptureTableDecorator::m_glWindowPos2f_capture;
+this->m_orig_glWindowPos2d = this->m_ptr_glWindowPos2d;
+if(this->m_ptr_glWindowPos2d)this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&CaptureTableDecorator::m_glWindowPos2d_capture;
+this->m_orig_glUniform4uivEXT = this->m_ptr_glUniform4uivEXT;
+if(this->m_ptr_glUniform4uivEXT)this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&CaptureTableDecorator::m_glUniform4uivEXT_capture;
+this->m_orig_glOrthoxOES = this->m_ptr_glOrthoxOES;
+if(this->m_ptr_glOrthoxOES)this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&CaptureTableDecorator::m_glOrthoxOES_capture;
+this->m_orig_glUniformSubroutinesuiv = this->m_ptr_glUniformSubroutinesuiv;
+if(this->m_ptr_glUniformSubroutinesuiv)this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&CaptureTableDecorator::m_glUniformSubroutinesuiv_capture;
+this->m_orig_glRectdv = this->m_ptr_glRectdv;
+if(this->m_ptr_glRectdv)this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&CaptureTableDecorator::m_glRectdv_capture;
+this->m_orig_glProgramUniform1i64vNV = this->m_ptr_glProgramUniform1i64vNV;
+if(this->m_ptr_glProgramUniform1i64vNV)this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&CaptureTableDecorator::m_glProgramUniform1i64vNV_capture;
+this->m_orig_glVertexAttribI4uiEXT = this->m_ptr_glVertexAttribI4uiEXT;
+if(this->m_ptr_glVertexAttribI4uiEXT)this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4uiEXT_capture;
+this->m_orig_glSecondaryColor3ubEXT = this->m_ptr_glSecondaryColor3ubEXT;
+if(this->m_ptr_glSecondaryColor3ubEXT)this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3ubEXT_capture;
+this->m_orig_glCompressedMultiTexSubImage1DEXT = this->m_ptr_glCompressedMultiTexSubImage1DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT)this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexSubImage1DEXT_capture;
+this->m_orig_glMultiTexGendEXT = this->m_ptr_glMultiTexGendEXT;
+if(this->m_ptr_glMultiTexGendEXT)this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&CaptureTableDecorator::m_glMultiTexGendEXT_capture;
+this->m_orig_glColorP3uiv = this->m_ptr_glColorP3uiv;
+if(this->m_ptr_glColorP3uiv)this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&CaptureTableDecorator::m_glColorP3uiv_capture;
+this->m_orig_glFogCoordfv = this->m_ptr_glFogCoordfv;
+if(this->m_ptr_glFogCoordfv)this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&CaptureTableDecorator::m_glFogCoordfv_capture;
+this->m_orig_glCompileShader = this->m_ptr_glCompileShader;
+if(this->m_ptr_glCompileShader)this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&CaptureTableDecorator::m_glCompileShader_capture;
+this->m_orig_glTexCoord2hNV = this->m_ptr_glTexCoord2hNV;
+if(this->m_ptr_glTexCoord2hNV)this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&CaptureTableDecorator::m_glTexCoord2hNV_capture;
+this->m_orig_glUniform1uivEXT = this->m_ptr_glUniform1uivEXT;
+if(this->m_ptr_glUniform1uivEXT)this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&CaptureTableDecorator::m_glUniform1uivEXT_capture;
+this->m_orig_glMatrixLoadTransposedEXT = this->m_ptr_glMatrixLoadTransposedEXT;
+if(this->m_ptr_glMatrixLoadTransposedEXT)this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&CaptureTableDecorator::m_glMatrixLoadTransposedEXT_capture;
+this->m_orig_glIndexfv = this->m_ptr_glIndexfv;
+if(this->m_ptr_glIndexfv)this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&CaptureTableDecorator::m_glIndexfv_capture;
+this->m_orig_glGetCompressedTextureImage = this->m_ptr_glGetCompressedTextureImage;
+if(this->m_ptr_glGetCompressedTextureImage)this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&CaptureTableDecorator::m_glGetCompressedTextureImage_capture;
+this->m_orig_glGetUniformuivEXT = this->m_ptr_glGetUniformuivEXT;
+if(this->m_ptr_glGetUniformuivEXT)this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&CaptureTableDecorator::m_glGetUniformuivEXT_capture;
+this->m_orig_glGetnPixelMapfvARB = this->m_ptr_glGetnPixelMapfvARB;
+if(this->m_ptr_glGetnPixelMapfvARB)this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&CaptureTableDecorator::m_glGetnPixelMapfvARB_capture;
+this->m_orig_glFramebufferTextureEXT = this->m_ptr_glFramebufferTextureEXT;
+if(this->m_ptr_glFramebufferTextureEXT)this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&CaptureTableDecorator::m_glFramebufferTextureEXT_capture;
+this->m_orig_glMultiDrawElementsIndirectCount = this->m_ptr_glMultiDrawElementsIndirectCount;
+if(this->m_ptr_glMultiDrawElementsIndirectCount)this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirectCount_capture;
+this->m_orig_glVertexAttribIPointer = this->m_ptr_glVertexAttribIPointer;
+if(this->m_ptr_glVertexAttribIPointer)this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&CaptureTableDecorator::m_glVertexAttribIPointer_capture;
+this->m_orig_glMultiTexCoordP3ui = this->m_ptr_glMultiTexCoordP3ui;
+if(this->m_ptr_glMultiTexCoordP3ui)this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&CaptureTableDecorator::m_glMultiTexCoordP3ui_capture;
+this->m_orig_glEvaluateDepthValuesARB = this->m_ptr_glEvaluateDepthValuesARB;
+if(this->m_ptr_glEvaluateDepthValuesARB)this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&CaptureTableDecorator::m_glEvaluateDepthValuesARB_capture;
+this->m_orig_glGetNamedBufferParameteriv = this->m_ptr_glGetNamedBufferParameteriv;
+if(this->m_ptr_glGetNamedBufferParameteriv)this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetNamedBufferParameteriv_capture;
+this->m_orig_glGetNamedProgramLocalParameterfvEXT = this->m_ptr_glGetNamedProgramLocalParameterfvEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT)this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_capture;
+this->m_orig_glColor4fNormal3fVertex3fvSUN = this->m_ptr_glColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN)this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glColor4fNormal3fVertex3fvSUN_capture;
+this->m_orig_glSeparableFilter2DEXT = this->m_ptr_glSeparableFilter2DEXT;
+if(this->m_ptr_glSeparableFilter2DEXT)this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&CaptureTableDecorator::m_glSeparableFilter2DEXT_capture;
+this->m_orig_glTexParameterxOES = this->m_ptr_glTexParameterxOES;
+if(this->m_ptr_glTexParameterxOES)this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&CaptureTableDecorator::m_glTexParameterxOES_capture;
+this->m_orig_glClearAccumxOES = this->m_ptr_glClearAccumxOES;
+if(this->m_ptr_glClearAccumxOES)this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&CaptureTableDecorator::m_glClearAccumxOES_capture;
+this->m_orig_glInvalidateFramebuffer = this->m_ptr_glInvalidateFramebuffer;
+if(this->m_ptr_glInvalidateFramebuffer)this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&CaptureTableDecorator::m_glInvalidateFramebuffer_capture;
+this->m_orig_glWeightubvARB = this->m_ptr_glWeightubvARB;
+if(this->m_ptr_glWeightubvARB)this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&CaptureTableDecorator::m_glWeightubvARB_capture;
+this->m_orig_glVertexAttrib1d = this->m_ptr_glVertexAttrib1d;
+if(this->m_ptr_glVertexAttrib1d)this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&CaptureTableDecorator::m_glVertexAttrib1d_capture;
+this->m_orig_glVertexAttrib1f = this->m_ptr_glVertexAttrib1f;
+if(this->m_ptr_glVertexAttrib1f)this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&CaptureTableDecorator::m_glVertexAttrib1f_capture;
+this->m_orig_glVertex4fv = this->m_ptr_glVertex4fv;
+if(this->m_ptr_glVertex4fv)this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&CaptureTableDecorator::m_glVertex4fv_capture;
+this->m_orig_glClearNamedFramebufferfi = this->m_ptr_glClearNamedFramebufferfi;
+if(this->m_ptr_glClearNamedFramebufferfi)this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&CaptureTableDecorator::m_glClearNamedFramebufferfi_capture;
+this->m_orig_glGetQueryBufferObjectuiv = this->m_ptr_glGetQueryBufferObjectuiv;
+if(this->m_ptr_glGetQueryBufferObjectuiv)this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&CaptureTableDecorator::m_glGetQueryBufferObjectuiv_capture;
+this->m_orig_glClearNamedFramebufferfv = this->m_ptr_glClearNamedFramebufferfv;
+if(this->m_ptr_glClearNamedFramebufferfv)this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&CaptureTableDecorator::m_glClearNamedFramebufferfv_capture;
+this->m_orig_glEndVertexShaderEXT = this->m_ptr_glEndVertexShaderEXT;
+if(this->m_ptr_glEndVertexShaderEXT)this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&CaptureTableDecorator::m_glEndVertexShaderEXT_capture;
+this->m_orig_glVertexAttrib1s = this->m_ptr_glVertexAttrib1s;
+if(this->m_ptr_glVertexAttrib1s)this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&CaptureTableDecorator::m_glVertexAttrib1s_capture;
+this->m_orig_glMultiTexCoord4dvARB = this->m_ptr_glMultiTexCoord4dvARB;
+if(this->m_ptr_glMultiTexCoord4dvARB)this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4dvARB_capture;
+this->m_orig_glMultiTexCoord1sv = this->m_ptr_glMultiTexCoord1sv;
+if(this->m_ptr_glMultiTexCoord1sv)this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&CaptureTableDecorator::m_glMultiTexCoord1sv_capture;
+this->m_orig_glUniform1ui64vNV = this->m_ptr_glUniform1ui64vNV;
+if(this->m_ptr_glUniform1ui64vNV)this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&CaptureTableDecorator::m_glUniform1ui64vNV_capture;
+this->m_orig_glGetClipPlanefOES = this->m_ptr_glGetClipPlanefOES;
+if(this->m_ptr_glGetClipPlanefOES)this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&CaptureTableDecorator::m_glGetClipPlanefOES_capture;
+this->m_orig_glRasterPos2s = this->m_ptr_glRasterPos2s;
+if(this->m_ptr_glRasterPos2s)this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&CaptureTableDecorator::m_glRasterPos2s_capture;
+this->m_orig_glWeightivARB = this->m_ptr_glWeightivARB;
+if(this->m_ptr_glWeightivARB)this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&CaptureTableDecorator::m_glWeightivARB_capture;
+this->m_orig_glMultiTexCoord4hvNV = this->m_ptr_glMultiTexCoord4hvNV;
+if(this->m_ptr_glMultiTexCoord4hvNV)this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&CaptureTableDecorator::m_glMultiTexCoord4hvNV_capture;
+this->m_orig_glNormal3hNV = this->m_ptr_glNormal3hNV;
+if(this->m_ptr_glNormal3hNV)this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&CaptureTableDecorator::m_glNormal3hNV_capture;
+this->m_orig_glGetSeparableFilter = this->m_ptr_glGetSeparableFilter;
+if(this->m_ptr_glGetSeparableFilter)this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&CaptureTableDecorator::m_glGetSeparableFilter_capture;
+this->m_orig_glGetPathTexGenivNV = this->m_ptr_glGetPathTexGenivNV;
+if(this->m_ptr_glGetPathTexGenivNV)this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&CaptureTableDecorator::m_glGetPathTexGenivNV_capture;
+this->m_orig_glColor4bv = this->m_ptr_glColor4bv;
+if(this->m_ptr_glColor4bv)this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&CaptureTableDecorator::m_glColor4bv_capture;
+this->m_orig_glRasterPos2f = this->m_ptr_glRasterPos2f;
+if(this->m_ptr_glRasterPos2f)this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&CaptureTableDecorator::m_glRasterPos2f_capture;
+this->m_orig_glNamedBufferPageCommitmentARB = this->m_ptr_glNamedBufferPageCommitmentARB;
+if(this->m_ptr_glNamedBufferPageCommitmentARB)this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&CaptureTableDecorator::m_glNamedBufferPageCommitmentARB_capture;
+this->m_orig_glLoadIdentity = this->m_ptr_glLoadIdentity;
+if(this->m_ptr_glLoadIdentity)this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&CaptureTableDecorator::m_glLoadIdentity_capture;
+this->m_orig_glRasterPos2i = this->m_ptr_glRasterPos2i;
+if(this->m_ptr_glRasterPos2i)this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&CaptureTableDecorator::m_glRasterPos2i_capture;
+this->m_orig_glRasterPos4iv = this->m_ptr_glRasterPos4iv;
+if(this->m_ptr_glRasterPos4iv)this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&CaptureTableDecorator::m_glRasterPos4iv_capture;
+this->m_orig_glMultiTexCoord2fvARB = this->m_ptr_glMultiTexCoord2fvARB;
+if(this->m_ptr_glMultiTexCoord2fvARB)this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2fvARB_capture;
+this->m_orig_glUniformMatrix4x3fv = this->m_ptr_glUniformMatrix4x3fv;
+if(this->m_ptr_glUniformMatrix4x3fv)this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&CaptureTableDecorator::m_glUniformMatrix4x3fv_capture;
+this->m_orig_glClearBufferfv = this->m_ptr_glClearBufferfv;
+if(this->m_ptr_glClearBufferfv)this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&CaptureTableDecorator::m_glClearBufferfv_capture;
+this->m_orig_glMultiTexCoord4hNV = this->m_ptr_glMultiTexCoord4hNV;
+if(this->m_ptr_glMultiTexCoord4hNV)this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&CaptureTableDecorator::m_glMultiTexCoord4hNV_capture;
+this->m_orig_glTextureBarrier = this->m_ptr_glTextureBarrier;
+if(this->m_ptr_glTextureBarrier)this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&CaptureTableDecorator::m_glTextureBarrier_capture;
+this->m_orig_glReplacementCodeuivSUN = this->m_ptr_glReplacementCodeuivSUN;
+if(this->m_ptr_glReplacementCodeuivSUN)this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuivSUN_capture;
+this->m_orig_glDeleteAsyncMarkersSGIX = this->m_ptr_glDeleteAsyncMarkersSGIX;
+if(this->m_ptr_glDeleteAsyncMarkersSGIX)this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&CaptureTableDecorator::m_glDeleteAsyncMarkersSGIX_capture;
+this->m_orig_glTexCoord2bvOES = this->m_ptr_glTexCoord2bvOES;
+if(this->m_ptr_glTexCoord2bvOES)this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&CaptureTableDecorator::m_glTexCoord2bvOES_capture;
+this->m_orig_glEvalCoord2xOES = this->m_ptr_glEvalCoord2xOES;
+if(this->m_ptr_glEvalCoord2xOES)this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&CaptureTableDecorator::m_glEvalCoord2xOES_capture;
+this->m_orig_glGetSharpenTexFuncSGIS = this->m_ptr_glGetSharpenTexFuncSGIS;
+if(this->m_ptr_glGetSharpenTexFuncSGIS)this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&CaptureTableDecorator::m_glGetSharpenTexFuncSGIS_capture;
+this->m_orig_glProgramUniformHandleui64vNV = this->m_ptr_glProgramUniformHandleui64vNV;
+if(this->m_ptr_glProgramUniformHandleui64vNV)this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&CaptureTableDecorator::m_glProgramUniformHandleui64vNV_capture;
+this->m_orig_glIglooInterfaceSGIX = this->m_ptr_glIglooInterfaceSGIX;
+if(this->m_ptr_glIglooInterfaceSGIX)this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&CaptureTableDecorator::m_glIglooInterfaceSGIX_capture;
+this->m_orig_glWindowPos2dvARB = this->m_ptr_glWindowPos2dvARB;
+if(this->m_ptr_glWindowPos2dvARB)this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&CaptureTableDecorator::m_glWindowPos2dvARB_capture;
+this->m_orig_glClearBufferfi = this->m_ptr_glClearBufferfi;
+if(this->m_ptr_glClearBufferfi)this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&CaptureTableDecorator::m_glClearBufferfi_capture;
+this->m_orig_glDrawArraysIndirect = this->m_ptr_glDrawArraysIndirect;
+if(this->m_ptr_glDrawArraysIndirect)this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&CaptureTableDecorator::m_glDrawArraysIndirect_capture;
+this->m_orig_glGenVertexArrays = this->m_ptr_glGenVertexArrays;
+if(this->m_ptr_glGenVertexArrays)this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&CaptureTableDecorator::m_glGenVertexArrays_capture;
+this->m_orig_glGetTransformFeedbacki64_v = this->m_ptr_glGetTransformFeedbacki64_v;
+if(this->m_ptr_glGetTransformFeedbacki64_v)this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&CaptureTableDecorator::m_glGetTransformFeedbacki64_v_capture;
+this->m_orig_glEnableVertexArrayAttrib = this->m_ptr_glEnableVertexArrayAttrib;
+if(this->m_ptr_glEnableVertexArrayAttrib)this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&CaptureTableDecorator::m_glEnableVertexArrayAttrib_capture;
+this->m_orig_glProgramUniformMatrix3x2dv = this->m_ptr_glProgramUniformMatrix3x2dv;
+if(this->m_ptr_glProgramUniformMatrix3x2dv)this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x2dv_capture;
+this->m_orig_glVertexStream4fATI = this->m_ptr_glVertexStream4fATI;
+if(this->m_ptr_glVertexStream4fATI)this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&CaptureTableDecorator::m_glVertexStream4fATI_capture;
+this->m_orig_glVertexBindingDivisor = this->m_ptr_glVertexBindingDivisor;
+if(this->m_ptr_glVertexBindingDivisor)this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&CaptureTableDecorator::m_glVertexBindingDivisor_capture;
+this->m_orig_glGetSamplerParameterIiv = this->m_ptr_glGetSamplerParameterIiv;
+if(this->m_ptr_glGetSamplerParameterIiv)this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&CaptureTableDecorator::m_glGetSamplerParameterIiv_capture;
+this->m_orig_glGetCoverageModulationTableNV = this->m_ptr_glGetCoverageModulationTableNV;
+if(this->m_ptr_glGetCoverageModulationTableNV)this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&CaptureTableDecorator::m_glGetCoverageModulationTableNV_capture;
+this->m_orig_glDepthRangedNV = this->m_ptr_glDepthRangedNV;
+if(this->m_ptr_glDepthRangedNV)this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&CaptureTableDecorator::m_glDepthRangedNV_capture;
+this->m_orig_glVertexAttrib3f = this->m_ptr_glVertexAttrib3f;
+if(this->m_ptr_glVertexAttrib3f)this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&CaptureTableDecorator::m_glVertexAttrib3f_capture;
+this->m_orig_glMultiDrawRangeElementArrayAPPLE = this->m_ptr_glMultiDrawRangeElementArrayAPPLE;
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE)this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&CaptureTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_capture;
+this->m_orig_glVertexAttribFormatNV = this->m_ptr_glVertexAttribFormatNV;
+if(this->m_ptr_glVertexAttribFormatNV)this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&CaptureTableDecorator::m_glVertexAttribFormatNV_capture;
+this->m_orig_glGetQueryBufferObjecti64v = this->m_ptr_glGetQueryBufferObjecti64v;
+if(this->m_ptr_glGetQueryBufferObjecti64v)this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&CaptureTableDecorator::m_glGetQueryBufferObjecti64v_capture;
+this->m_orig_glGetVertexAttribdv = this->m_ptr_glGetVertexAttribdv;
+if(this->m_ptr_glGetVertexAttribdv)this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&CaptureTableDecorator::m_glGetVertexAttribdv_capture;
+this->m_orig_glGetUniformi64vARB = this->m_ptr_glGetUniformi64vARB;
+if(this->m_ptr_glGetUniformi64vARB)this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&CaptureTableDecorator::m_glGetUniformi64vARB_capture;
+this->m_orig_glAreTexturesResidentEXT = this->m_ptr_glAreTexturesResidentEXT;
+if(this->m_ptr_glAreTexturesResidentEXT)this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&CaptureTableDecorator::m_glAreTexturesResidentEXT_capture;
+this->m_orig_glGetHandleARB = this->m_ptr_glGetHandleARB;
+if(this->m_ptr_glGetHandleARB)this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&CaptureTableDecorator::m_glGetHandleARB_capture;
+this->m_orig_glVideoCaptureStreamParameterdvNV = this->m_ptr_glVideoCaptureStreamParameterdvNV;
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV)this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&CaptureTableDecorator::m_glVideoCaptureStreamParameterdvNV_capture;
+this->m_orig_glMapParameterivNV = this->m_ptr_glMapParameterivNV;
+if(this->m_ptr_glMapParameterivNV)this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&CaptureTableDecorator::m_glMapParameterivNV_capture;
+this->m_orig_glIsVertexArray = this->m_ptr_glIsVertexArray;
+if(this->m_ptr_glIsVertexArray)this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&CaptureTableDecorator::m_glIsVertexArray_capture;
+this->m_orig_glSecondaryColor3sEXT = this->m_ptr_glSecondaryColor3sEXT;
+if(this->m_ptr_glSecondaryColor3sEXT)this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3sEXT_capture;
+this->m_orig_glGetTexParameterIivEXT = this->m_ptr_glGetTexParameterIivEXT;
+if(this->m_ptr_glGetTexParameterIivEXT)this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glGetTexParameterIivEXT_capture;
+this->m_orig_glFrameTerminatorGREMEDY = this->m_ptr_glFrameTerminatorGREMEDY;
+if(this->m_ptr_glFrameTerminatorGREMEDY)this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&CaptureTableDecorator::m_glFrameTerminatorGREMEDY_capture;
+this->m_orig_glBlendBarrierKHR = this->m_ptr_glBlendBarrierKHR;
+if(this->m_ptr_glBlendBarrierKHR)this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&CaptureTableDecorator::m_glBlendBarrierKHR_capture;
+this->m_orig_glVertexAttrib4NubARB = this->m_ptr_glVertexAttrib4NubARB;
+if(this->m_ptr_glVertexAttrib4NubARB)this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NubARB_capture;
+this->m_orig_glPrimitiveRestartNV = this->m_ptr_glPrimitiveRestartNV;
+if(this->m_ptr_glPrimitiveRestartNV)this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&CaptureTableDecorator::m_glPrimitiveRestartNV_capture;
+this->m_orig_glVertexAttribL1ui64vARB = this->m_ptr_glVertexAttribL1ui64vARB;
+if(this->m_ptr_glVertexAttribL1ui64vARB)this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&CaptureTableDecorator::m_glVertexAttribL1ui64vARB_capture;
+this->m_orig_glVertexAttribI4ivEXT = this->m_ptr_glVertexAttribI4ivEXT;
+if(this->m_ptr_glVertexAttribI4ivEXT)this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4ivEXT_capture;
+this->m_orig_glVertexAttribs4svNV = this->m_ptr_glVertexAttribs4svNV;
+if(this->m_ptr_glVertexAttribs4svNV)this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&CaptureTableDecorator::m_glVertexAttribs4svNV_capture;
+this->m_orig_glUniform1ui = this->m_ptr_glUniform1ui;
+if(this->m_ptr_glUniform1ui)this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&CaptureTableDecorator::m_glUniform1ui_capture;
+this->m_orig_glVertexAttrib2fvARB = this->m_ptr_glVertexAttrib2fvARB;
+if(this->m_ptr_glVertexAttrib2fvARB)this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&CaptureTableDecorator::m_glVertexAttrib2fvARB_capture;
+this->m_orig_glVertexAttribI4svEXT = this->m_ptr_glVertexAttribI4svEXT;
+if(this->m_ptr_glVertexAttribI4svEXT)this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4svEXT_capture;
+this->m_orig_glTextureImage3DMultisampleCoverageNV = this->m_ptr_glTextureImage3DMultisampleCoverageNV;
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV)this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&CaptureTableDecorator::m_glTextureImage3DMultisampleCoverageNV_capture;
+this->m_orig_glMemoryBarrier = this->m_ptr_glMemoryBarrier;
+if(this->m_ptr_glMemoryBarrier)this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&CaptureTableDecorator::m_glMemoryBarrier_capture;
+this->m_orig_glGetVariantArrayObjectfvATI = this->m_ptr_glGetVariantArrayObjectfvATI;
+if(this->m_ptr_glGetVariantArrayObjectfvATI)this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&CaptureTableDecorator::m_glGetVariantArrayObjectfvATI_capture;
+this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&CaptureTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_capture;
+this->m_orig_glIsProgramARB = this->m_ptr_glIsProgramARB;
+if(this->m_ptr_glIsProgramARB)this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&CaptureTableDecorator::m_glIsProgramARB_capture;
+this->m_orig_glBindImageTextureEXT = this->m_ptr_glBindImageTextureEXT;
+if(this->m_ptr_glBindImageTextureEXT)this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&CaptureTableDecorator::m_glBindImageTextureEXT_capture;
+this->m_orig_glGetFragDataLocation = this->m_ptr_glGetFragDataLocation;
+if(this->m_ptr_glGetFragDataLocation)this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&CaptureTableDecorator::m_glGetFragDataLocation_capture;
+this->m_orig_glMultiTexCoord1svARB = this->m_ptr_glMultiTexCoord1svARB;
+if(this->m_ptr_glMultiTexCoord1svARB)this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1svARB_capture;
+this->m_orig_glGetMapxvOES = this->m_ptr_glGetMapxvOES;
+if(this->m_ptr_glGetMapxvOES)this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&CaptureTableDecorator::m_glGetMapxvOES_capture;
+this->m_orig_glTextureStorage2DMultisampleEXT = this->m_ptr_glTextureStorage2DMultisampleEXT;
+if(this->m_ptr_glTextureStorage2DMultisampleEXT)this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTextureStorage2DMultisampleEXT_capture;
+this->m_orig_glGetMaterialfv = this->m_ptr_glGetMaterialfv;
+if(this->m_ptr_glGetMaterialfv)this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&CaptureTableDecorator::m_glGetMaterialfv_capture;
+this->m_orig_glVertexAttrib4NbvARB = this->m_ptr_glVertexAttrib4NbvARB;
+if(this->m_ptr_glVertexAttrib4NbvARB)this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4NbvARB_capture;
+this->m_orig_glPixelMapuiv = this->m_ptr_glPixelMapuiv;
+if(this->m_ptr_glPixelMapuiv)this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&CaptureTableDecorator::m_glPixelMapuiv_capture;
+this->m_orig_glColorPointerEXT = this->m_ptr_glColorPointerEXT;
+if(this->m_ptr_glColorPointerEXT)this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&CaptureTableDecorator::m_glColorPointerEXT_capture;
+this->m_orig_glEnableClientStateiEXT = this->m_ptr_glEnableClientStateiEXT;
+if(this->m_ptr_glEnableClientStateiEXT)this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&CaptureTableDecorator::m_glEnableClientStateiEXT_capture;
+this->m_orig_glClearTexSubImage = this->m_ptr_glClearTexSubImage;
+if(this->m_ptr_glClearTexSubImage)this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&CaptureTableDecorator::m_glClearTexSubImage_capture;
+this->m_orig_glEvalCoord1xvOES = this->m_ptr_glEvalCoord1xvOES;
+if(this->m_ptr_glEvalCoord1xvOES)this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&CaptureTableDecorator::m_glEvalCoord1xvOES_capture;
+this->m_orig_glDetachObjectARB = this->m_ptr_glDetachObjectARB;
+if(this->m_ptr_glDetachObjectARB)this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&CaptureTableDecorator::m_glDetachObjectARB_capture;
+this->m_orig_glGetTextureParameterIiv = this->m_ptr_glGetTextureParameterIiv;
+if(this->m_ptr_glGetTextureParameterIiv)this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&CaptureTableDecorator::m_glGetTextureParameterIiv_capture;
+this->m_orig_glVariantusvEXT = this->m_ptr_glVariantusvEXT;
+if(this->m_ptr_glVariantusvEXT)this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&CaptureTableDecorator::m_glVariantusvEXT_capture;
+this->m_orig_glCompressedTextureImage3DEXT = this->m_ptr_glCompressedTextureImage3DEXT;
+if(this->m_ptr_glCompressedTextureImage3DEXT)this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureImage3DEXT_capture;
+this->m_orig_glMultiTexCoord1dARB = this->m_ptr_glMultiTexCoord1dARB;
+if(this->m_ptr_glMultiTexCoord1dARB)this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&CaptureTableDecorator::m_glMultiTexCoord1dARB_capture;
+this->m_orig_glGetVertexArrayIntegeri_vEXT = this->m_ptr_glGetVertexArrayIntegeri_vEXT;
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT)this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&CaptureTableDecorator::m_glGetVertexArrayIntegeri_vEXT_capture;
+this->m_orig_glVertexAttribI4ubv = this->m_ptr_glVertexAttribI4ubv;
+if(this->m_ptr_glVertexAttribI4ubv)this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&CaptureTableDecorator::m_glVertexAttribI4ubv_capture;
+this->m_orig_glPixelTexGenParameterfSGIS = this->m_ptr_glPixelTexGenParameterfSGIS;
+if(this->m_ptr_glPixelTexGenParameterfSGIS)this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&CaptureTableDecorator::m_glPixelTexGenParameterfSGIS_capture;
+this->m_orig_glProgramUniformMatrix4x2dv = this->m_ptr_glProgramUniformMatrix4x2dv;
+if(this->m_ptr_glProgramUniformMatrix4x2dv)this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x2dv_capture;
+this->m_orig_glUniform3fARB = this->m_ptr_glUniform3fARB;
+if(this->m_ptr_glUniform3fARB)this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&CaptureTableDecorator::m_glUniform3fARB_capture;
+this->m_orig_glIsShader = this->m_ptr_glIsShader;
+if(this->m_ptr_glIsShader)this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&CaptureTableDecorator::m_glIsShader_capture;
+this->m_orig_glConvolutionParameteriv = this->m_ptr_glConvolutionParameteriv;
+if(this->m_ptr_glConvolutionParameteriv)this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&CaptureTableDecorator::m_glConvolutionParameteriv_capture;
+this->m_orig_glCopyMultiTexSubImage2DEXT = this->m_ptr_glCopyMultiTexSubImage2DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT)this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyMultiTexSubImage2DEXT_capture;
+this->m_orig_glEnableVertexAttribArrayARB = this->m_ptr_glEnableVertexAttribArrayARB;
+if(this->m_ptr_glEnableVertexAttribArrayARB)this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&CaptureTableDecorator::m_glEnableVertexAttribArrayARB_capture;
+this->m_orig_glMulticastCopyBufferSubDataNV = this->m_ptr_glMulticastCopyBufferSubDataNV;
+if(this->m_ptr_glMulticastCopyBufferSubDataNV)this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&CaptureTableDecorator::m_glMulticastCopyBufferSubDataNV_capture;
+this->m_orig_glEnable = this->m_ptr_glEnable;
+if(this->m_ptr_glEnable)this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&CaptureTableDecorator::m_glEnable_capture;
+this->m_orig_glGetActiveUniformsiv = this->m_ptr_glGetActiveUniformsiv;
+if(this->m_ptr_glGetActiveUniformsiv)this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&CaptureTableDecorator::m_glGetActiveUniformsiv_capture;
+this->m_orig_glGetVertexAttribivARB = this->m_ptr_glGetVertexAttribivARB;
+if(this->m_ptr_glGetVertexAttribivARB)this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&CaptureTableDecorator::m_glGetVertexAttribivARB_capture;
+this->m_orig_glTexCoord4hvNV = this->m_ptr_glTexCoord4hvNV;
+if(this->m_ptr_glTexCoord4hvNV)this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&CaptureTableDecorator::m_glTexCoord4hvNV_capture;
+this->m_orig_glUseProgramObjectARB = this->m_ptr_glUseProgramObjectARB;
+if(this->m_ptr_glUseProgramObjectARB)this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&CaptureTableDecorator::m_glUseProgramObjectARB_capture;
+this->m_orig_glGetAttribLocation = this->m_ptr_glGetAttribLocation;
+if(this->m_ptr_glGetAttribLocation)this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&CaptureTableDecorator::m_glGetAttribLocation_capture;
+this->m_orig_glVertexAttrib4dv = this->m_ptr_glVertexAttrib4dv;
+if(this->m_ptr_glVertexAttrib4dv)this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&CaptureTableDecorator::m_glVertexAttrib4dv_capture;
+this->m_orig_glGetTextureParameteriv = this->m_ptr_glGetTextureParameteriv;
+if(this->m_ptr_glGetTextureParameteriv)this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&CaptureTableDecorator::m_glGetTextureParameteriv_capture;
+this->m_orig_glNamedBufferStorageMemEXT = this->m_ptr_glNamedBufferStorageMemEXT;
+if(this->m_ptr_glNamedBufferStorageMemEXT)this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&CaptureTableDecorator::m_glNamedBufferStorageMemEXT_capture;
+this->m_orig_glPathSubCoordsNV = this->m_ptr_glPathSubCoordsNV;
+if(this->m_ptr_glPathSubCoordsNV)this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&CaptureTableDecorator::m_glPathSubCoordsNV_capture;
+this->m_orig_glMatrixIndexusvARB = this->m_ptr_glMatrixIndexusvARB;
+if(this->m_ptr_glMatrixIndexusvARB)this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&CaptureTableDecorator::m_glMatrixIndexusvARB_capture;
+this->m_orig_glGetVideouivNV = this->m_ptr_glGetVideouivNV;
+if(this->m_ptr_glGetVideouivNV)this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&CaptureTableDecorator::m_glGetVideouivNV_capture;
+this->m_orig_glGetVideoCaptureivNV = this->m_ptr_glGetVideoCaptureivNV;
+if(this->m_ptr_glGetVideoCaptureivNV)this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&CaptureTableDecorator::m_glGetVideoCaptureivNV_capture;
+this->m_orig_glProgramUniform3ui = this->m_ptr_glProgramUniform3ui;
+if(this->m_ptr_glProgramUniform3ui)this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&CaptureTableDecorator::m_glProgramUniform3ui_capture;
+this->m_orig_glVertexAttrib3svARB = this->m_ptr_glVertexAttrib3svARB;
+if(this->m_ptr_glVertexAttrib3svARB)this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&CaptureTableDecorator::m_glVertexAttrib3svARB_capture;
+this->m_orig_glGetNamedBufferParameterivEXT = this->m_ptr_glGetNamedBufferParameterivEXT;
+if(this->m_ptr_glGetNamedBufferParameterivEXT)this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetNamedBufferParameterivEXT_capture;
+this->m_orig_glMatrixScaledEXT = this->m_ptr_glMatrixScaledEXT;
+if(this->m_ptr_glMatrixScaledEXT)this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&CaptureTableDecorator::m_glMatrixScaledEXT_capture;
+this->m_orig_glProgramUniformMatrix2x3fv = this->m_ptr_glProgramUniformMatrix2x3fv;
+if(this->m_ptr_glProgramUniformMatrix2x3fv)this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x3fv_capture;
+this->m_orig_glGetFragmentLightivSGIX = this->m_ptr_glGetFragmentLightivSGIX;
+if(this->m_ptr_glGetFragmentLightivSGIX)this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&CaptureTableDecorator::m_glGetFragmentLightivSGIX_capture;
+this->m_orig_glGetStringi = this->m_ptr_glGetStringi;
+if(this->m_ptr_glGetStringi)this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&CaptureTableDecorator::m_glGetStringi_capture;
+this->m_orig_glWindowPos2svARB = this->m_ptr_glWindowPos2svARB;
+if(this->m_ptr_glWindowPos2svARB)this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&CaptureTableDecorator::m_glWindowPos2svARB_capture;
+this->m_orig_glVertexAttrib2svNV = this->m_ptr_glVertexAttrib2svNV;
+if(this->m_ptr_glVertexAttrib2svNV)this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&CaptureTableDecorator::m_glVertexAttrib2svNV_capture;
+this->m_orig_glWindowPos2ivARB = this->m_ptr_glWindowPos2ivARB;
+if(this->m_ptr_glWindowPos2ivARB)this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&CaptureTableDecorator::m_glWindowPos2ivARB_capture;
+this->m_orig_glGetVertexAttribPointervNV = this->m_ptr_glGetVertexAttribPointervNV;
+if(this->m_ptr_glGetVertexAttribPointervNV)this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&CaptureTableDecorator::m_glGetVertexAttribPointervNV_capture;
+this->m_orig_glPushMatrix = this->m_ptr_glPushMatrix;
+if(this->m_ptr_glPushMatrix)this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&CaptureTableDecorator::m_glPushMatrix_capture;
+this->m_orig_glEdgeFlagPointerListIBM = this->m_ptr_glEdgeFlagPointerListIBM;
+if(this->m_ptr_glEdgeFlagPointerListIBM)this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glEdgeFlagPointerListIBM_capture;
+this->m_orig_glGenerateMipmapEXT = this->m_ptr_glGenerateMipmapEXT;
+if(this->m_ptr_glGenerateMipmapEXT)this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&CaptureTableDecorator::m_glGenerateMipmapEXT_capture;
+this->m_orig_glWindowPos3sv = this->m_ptr_glWindowPos3sv;
+if(this->m_ptr_glWindowPos3sv)this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&CaptureTableDecorator::m_glWindowPos3sv_capture;
+this->m_orig_glPathCoordsNV = this->m_ptr_glPathCoordsNV;
+if(this->m_ptr_glPathCoordsNV)this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&CaptureTableDecorator::m_glPathCoordsNV_capture;
+this->m_orig_glProgramUniform1i = this->m_ptr_glProgramUniform1i;
+if(this->m_ptr_glProgramUniform1i)this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&CaptureTableDecorator::m_glProgramUniform1i_capture;
+this->m_orig_glProgramUniform1d = this->m_ptr_glProgramUniform1d;
+if(this->m_ptr_glProgramUniform1d)this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&CaptureTableDecorator::m_glProgramUniform1d_capture;
+this->m_orig_glProgramUniform1f = this->m_ptr_glProgramUniform1f;
+if(this->m_ptr_glProgramUniform1f)this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&CaptureTableDecorator::m_glProgramUniform1f_capture;
+this->m_orig_glProgramParameteriEXT = this->m_ptr_glProgramParameteriEXT;
+if(this->m_ptr_glProgramParameteriEXT)this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&CaptureTableDecorator::m_glProgramParameteriEXT_capture;
+this->m_orig_glCompressedMultiTexImage2DEXT = this->m_ptr_glCompressedMultiTexImage2DEXT;
+if(this->m_ptr_glCompressedMultiTexImage2DEXT)this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexImage2DEXT_capture;
+this->m_orig_glProgramUniform3iv = this->m_ptr_glProgramUniform3iv;
+if(this->m_ptr_glProgramUniform3iv)this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&CaptureTableDecorator::m_glProgramUniform3iv_capture;
+this->m_orig_glIndexiv = this->m_ptr_glIndexiv;
+if(this->m_ptr_glIndexiv)this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&CaptureTableDecorator::m_glIndexiv_capture;
+this->m_orig_glMultiTexCoord4xvOES = this->m_ptr_glMultiTexCoord4xvOES;
+if(this->m_ptr_glMultiTexCoord4xvOES)this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord4xvOES_capture;
+this->m_orig_glEGLImageTargetTexture2DOES = this->m_ptr_glEGLImageTargetTexture2DOES;
+if(this->m_ptr_glEGLImageTargetTexture2DOES)this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&CaptureTableDecorator::m_glEGLImageTargetTexture2DOES_capture;
+this->m_orig_glPixelZoom = this->m_ptr_glPixelZoom;
+if(this->m_ptr_glPixelZoom)this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&CaptureTableDecorator::m_glPixelZoom_capture;
+this->m_orig_glVertex3bvOES = this->m_ptr_glVertex3bvOES;
+if(this->m_ptr_glVertex3bvOES)this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&CaptureTableDecorator::m_glVertex3bvOES_capture;
+this->m_orig_glFramebufferReadBufferEXT = this->m_ptr_glFramebufferReadBufferEXT;
+if(this->m_ptr_glFramebufferReadBufferEXT)this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&CaptureTableDecorator::m_glFramebufferReadBufferEXT_capture;
+this->m_orig_glExtractComponentEXT = this->m_ptr_glExtractComponentEXT;
+if(this->m_ptr_glExtractComponentEXT)this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&CaptureTableDecorator::m_glExtractComponentEXT_capture;
+this->m_orig_glCombinerParameterivNV = this->m_ptr_glCombinerParameterivNV;
+if(this->m_ptr_glCombinerParameterivNV)this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&CaptureTableDecorator::m_glCombinerParameterivNV_capture;
+this->m_orig_glMinmax = this->m_ptr_glMinmax;
+if(this->m_ptr_glMinmax)this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&CaptureTableDecorator::m_glMinmax_capture;
+this->m_orig_glColorP3ui = this->m_ptr_glColorP3ui;
+if(this->m_ptr_glColorP3ui)this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&CaptureTableDecorator::m_glColorP3ui_capture;
+this->m_orig_glPointParameterfvSGIS = this->m_ptr_glPointParameterfvSGIS;
+if(this->m_ptr_glPointParameterfvSGIS)this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&CaptureTableDecorator::m_glPointParameterfvSGIS_capture;
+this->m_orig_glBlendEquationi = this->m_ptr_glBlendEquationi;
+if(this->m_ptr_glBlendEquationi)this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&CaptureTableDecorator::m_glBlendEquationi_capture;
+this->m_orig_glGetFogFuncSGIS = this->m_ptr_glGetFogFuncSGIS;
+if(this->m_ptr_glGetFogFuncSGIS)this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&CaptureTableDecorator::m_glGetFogFuncSGIS_capture;
+this->m_orig_glVertexAttrib4fvNV = this->m_ptr_glVertexAttrib4fvNV;
+if(this->m_ptr_glVertexAttrib4fvNV)this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&CaptureTableDecorator::m_glVertexAttrib4fvNV_capture;
+this->m_orig_glGetnMinmax = this->m_ptr_glGetnMinmax;
+if(this->m_ptr_glGetnMinmax)this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&CaptureTableDecorator::m_glGetnMinmax_capture;
+this->m_orig_glFragmentLightiSGIX = this->m_ptr_glFragmentLightiSGIX;
+if(this->m_ptr_glFragmentLightiSGIX)this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&CaptureTableDecorator::m_glFragmentLightiSGIX_capture;
+this->m_orig_glMultiTexCoord1bvOES = this->m_ptr_glMultiTexCoord1bvOES;
+if(this->m_ptr_glMultiTexCoord1bvOES)this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord1bvOES_capture;
+this->m_orig_glSecondaryColorPointerEXT = this->m_ptr_glSecondaryColorPointerEXT;
+if(this->m_ptr_glSecondaryColorPointerEXT)this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&CaptureTableDecorator::m_glSecondaryColorPointerEXT_capture;
+this->m_orig_glMultiTexCoordP4uiv = this->m_ptr_glMultiTexCoordP4uiv;
+if(this->m_ptr_glMultiTexCoordP4uiv)this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&CaptureTableDecorator::m_glMultiTexCoordP4uiv_capture;
+this->m_orig_glGetBufferSubDataARB = this->m_ptr_glGetBufferSubDataARB;
+if(this->m_ptr_glGetBufferSubDataARB)this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&CaptureTableDecorator::m_glGetBufferSubDataARB_capture;
+this->m_orig_glSecondaryColor3hNV = this->m_ptr_glSecondaryColor3hNV;
+if(this->m_ptr_glSecondaryColor3hNV)this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&CaptureTableDecorator::m_glSecondaryColor3hNV_capture;
+this->m_orig_glGetPathParameterivNV = this->m_ptr_glGetPathParameterivNV;
+if(this->m_ptr_glGetPathParameterivNV)this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&CaptureTableDecorator::m_glGetPathParameterivNV_capture;
+this->m_orig_glFlushRasterSGIX = this->m_ptr_glFlushRasterSGIX;
+if(this->m_ptr_glFlushRasterSGIX)this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&CaptureTableDecorator::m_glFlushRasterSGIX_capture;
+this->m_orig_glElementPointerATI = this->m_ptr_glElementPointerATI;
+if(this->m_ptr_glElementPointerATI)this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&CaptureTableDecorator::m_glElementPointerATI_capture;
+this->m_orig_glGetAttachedObjectsARB = this->m_ptr_glGetAttachedObjectsARB;
+if(this->m_ptr_glGetAttachedObjectsARB)this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&CaptureTableDecorator::m_glGetAttachedObjectsARB_capture;
+this->m_orig_glUniform4iv = this->m_ptr_glUniform4iv;
+if(this->m_ptr_glUniform4iv)this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&CaptureTableDecorator::m_glUniform4iv_capture;
+this->m_orig_glFogxOES = this->m_ptr_glFogxOES;
+if(this->m_ptr_glFogxOES)this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&CaptureTableDecorator::m_glFogxOES_capture;
+this->m_orig_glSharpenTexFuncSGIS = this->m_ptr_glSharpenTexFuncSGIS;
+if(this->m_ptr_glSharpenTexFuncSGIS)this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&CaptureTableDecorator::m_glSharpenTexFuncSGIS_capture;
+this->m_orig_glClearDepthfOES = this->m_ptr_glClearDepthfOES;
+if(this->m_ptr_glClearDepthfOES)this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&CaptureTableDecorator::m_glClearDepthfOES_capture;
+this->m_orig_glDeleteCommandListsNV = this->m_ptr_glDeleteCommandListsNV;
+if(this->m_ptr_glDeleteCommandListsNV)this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&CaptureTableDecorator::m_glDeleteCommandListsNV_capture;
+this->m_orig_glSpecializeShader = this->m_ptr_glSpecializeShader;
+if(this->m_ptr_glSpecializeShader)this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&CaptureTableDecorator::m_glSpecializeShader_capture;
+this->m_orig_glVertex4hNV = this->m_ptr_glVertex4hNV;
+if(this->m_ptr_glVertex4hNV)this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&CaptureTableDecorator::m_glVertex4hNV_capture;
+this->m_orig_glSecondaryColor3dvEXT = this->m_ptr_glSecondaryColor3dvEXT;
+if(this->m_ptr_glSecondaryColor3dvEXT)this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3dvEXT_capture;
+this->m_orig_glGenTextures = this->m_ptr_glGenTextures;
+if(this->m_ptr_glGenTextures)this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&CaptureTableDecorator::m_glGenTextures_capture;
+this->m_orig_glTextureStorage2DMultisample = this->m_ptr_glTextureStorage2DMultisample;
+if(this->m_ptr_glTextureStorage2DMultisample)this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTextureStorage2DMultisample_capture;
+this->m_orig_glUniform3ui64vNV = this->m_ptr_glUniform3ui64vNV;
+if(this->m_ptr_glUniform3ui64vNV)this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&CaptureTableDecorator::m_glUniform3ui64vNV_capture;
+this->m_orig_glBlendFuncSeparateIndexedAMD = this->m_ptr_glBlendFuncSeparateIndexedAMD;
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD)this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&CaptureTableDecorator::m_glBlendFuncSeparateIndexedAMD_capture;
+this->m_orig_glMakeBufferResidentNV = this->m_ptr_glMakeBufferResidentNV;
+if(this->m_ptr_glMakeBufferResidentNV)this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&CaptureTableDecorator::m_glMakeBufferResidentNV_capture;
+this->m_orig_glShaderOp2EXT = this->m_ptr_glShaderOp2EXT;
+if(this->m_ptr_glShaderOp2EXT)this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&CaptureTableDecorator::m_glShaderOp2EXT_capture;
+this->m_orig_glGetVertexAttribivNV = this->m_ptr_glGetVertexAttribivNV;
+if(this->m_ptr_glGetVertexAttribivNV)this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&CaptureTableDecorator::m_glGetVertexAttribivNV_capture;
+this->m_orig_glTexParameterIivEXT = this->m_ptr_glTexParameterIivEXT;
+if(this->m_ptr_glTexParameterIivEXT)this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glTexParameterIivEXT_capture;
+this->m_orig_glGetPerfQueryDataINTEL = this->m_ptr_glGetPerfQueryDataINTEL;
+if(this->m_ptr_glGetPerfQueryDataINTEL)this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&CaptureTableDecorator::m_glGetPerfQueryDataINTEL_capture;
+this->m_orig_glVertexAttrib4dvARB = this->m_ptr_glVertexAttrib4dvARB;
+if(this->m_ptr_glVertexAttrib4dvARB)this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4dvARB_capture;
+this->m_orig_glTextureSubImage1DEXT = this->m_ptr_glTextureSubImage1DEXT;
+if(this->m_ptr_glTextureSubImage1DEXT)this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glTextureSubImage1DEXT_capture;
+this->m_orig_glGetActiveUniformBlockName = this->m_ptr_glGetActiveUniformBlockName;
+if(this->m_ptr_glGetActiveUniformBlockName)this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&CaptureTableDecorator::m_glGetActiveUniformBlockName_capture;
+this->m_orig_glVertexAttrib2dvARB = this->m_ptr_glVertexAttrib2dvARB;
+if(this->m_ptr_glVertexAttrib2dvARB)this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&CaptureTableDecorator::m_glVertexAttrib2dvARB_capture;
+this->m_orig_glVertexAttribPointer = this->m_ptr_glVertexAttribPointer;
+if(this->m_ptr_glVertexAttribPointer)this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&CaptureTableDecorator::m_glVertexAttribPointer_capture;
+this->m_orig_glDepthBoundsdNV = this->m_ptr_glDepthBoundsdNV;
+if(this->m_ptr_glDepthBoundsdNV)this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&CaptureTableDecorator::m_glDepthBoundsdNV_capture;
+this->m_orig_glDeleteTexturesEXT = this->m_ptr_glDeleteTexturesEXT;
+if(this->m_ptr_glDeleteTexturesEXT)this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&CaptureTableDecorator::m_glDeleteTexturesEXT_capture;
+this->m_orig_glDrawBuffersATI = this->m_ptr_glDrawBuffersATI;
+if(this->m_ptr_glDrawBuffersATI)this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&CaptureTableDecorator::m_glDrawBuffersATI_capture;
+this->m_orig_glLightModelxvOES = this->m_ptr_glLightModelxvOES;
+if(this->m_ptr_glLightModelxvOES)this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&CaptureTableDecorator::m_glLightModelxvOES_capture;
+this->m_orig_glApplyTextureEXT = this->m_ptr_glApplyTextureEXT;
+if(this->m_ptr_glApplyTextureEXT)this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&CaptureTableDecorator::m_glApplyTextureEXT_capture;
+this->m_orig_glGetImageHandleNV = this->m_ptr_glGetImageHandleNV;
+if(this->m_ptr_glGetImageHandleNV)this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&CaptureTableDecorator::m_glGetImageHandleNV_capture;
+this->m_orig_glGetMinmax = this->m_ptr_glGetMinmax;
+if(this->m_ptr_glGetMinmax)this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&CaptureTableDecorator::m_glGetMinmax_capture;
+this->m_orig_glGetFixedvOES = this->m_ptr_glGetFixedvOES;
+if(this->m_ptr_glGetFixedvOES)this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&CaptureTableDecorator::m_glGetFixedvOES_capture;
+this->m_orig_glSamplePatternEXT = this->m_ptr_glSamplePatternEXT;
+if(this->m_ptr_glSamplePatternEXT)this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&CaptureTableDecorator::m_glSamplePatternEXT_capture;
+this->m_orig_glUniform1f = this->m_ptr_glUniform1f;
+if(this->m_ptr_glUniform1f)this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&CaptureTableDecorator::m_glUniform1f_capture;
+this->m_orig_glColor4fNormal3fVertex3fSUN = this->m_ptr_glColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN)this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glColor4fNormal3fVertex3fSUN_capture;
+this->m_orig_glFogCoorddvEXT = this->m_ptr_glFogCoorddvEXT;
+if(this->m_ptr_glFogCoorddvEXT)this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&CaptureTableDecorator::m_glFogCoorddvEXT_capture;
+this->m_orig_glCopyTextureImage1DEXT = this->m_ptr_glCopyTextureImage1DEXT;
+if(this->m_ptr_glCopyTextureImage1DEXT)this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyTextureImage1DEXT_capture;
+this->m_orig_glFlushMappedBufferRangeAPPLE = this->m_ptr_glFlushMappedBufferRangeAPPLE;
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE)this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&CaptureTableDecorator::m_glFlushMappedBufferRangeAPPLE_capture;
+this->m_orig_glVertex3sv = this->m_ptr_glVertex3sv;
+if(this->m_ptr_glVertex3sv)this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&CaptureTableDecorator::m_glVertex3sv_capture;
+this->m_orig_glFlushStaticDataIBM = this->m_ptr_glFlushStaticDataIBM;
+if(this->m_ptr_glFlushStaticDataIBM)this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&CaptureTableDecorator::m_glFlushStaticDataIBM_capture;
+this->m_orig_glProgramUniform4ui64NV = this->m_ptr_glProgramUniform4ui64NV;
+if(this->m_ptr_glProgramUniform4ui64NV)this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&CaptureTableDecorator::m_glProgramUniform4ui64NV_capture;
+this->m_orig_glRasterPos4xOES = this->m_ptr_glRasterPos4xOES;
+if(this->m_ptr_glRasterPos4xOES)this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&CaptureTableDecorator::m_glRasterPos4xOES_capture;
+this->m_orig_glVertexAttribP1ui = this->m_ptr_glVertexAttribP1ui;
+if(this->m_ptr_glVertexAttribP1ui)this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&CaptureTableDecorator::m_glVertexAttribP1ui_capture;
+this->m_orig_glProgramUniform4dvEXT = this->m_ptr_glProgramUniform4dvEXT;
+if(this->m_ptr_glProgramUniform4dvEXT)this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&CaptureTableDecorator::m_glProgramUniform4dvEXT_capture;
+this->m_orig_glEndTransformFeedbackEXT = this->m_ptr_glEndTransformFeedbackEXT;
+if(this->m_ptr_glEndTransformFeedbackEXT)this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&CaptureTableDecorator::m_glEndTransformFeedbackEXT_capture;
+this->m_orig_glBinormal3dEXT = this->m_ptr_glBinormal3dEXT;
+if(this->m_ptr_glBinormal3dEXT)this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&CaptureTableDecorator::m_glBinormal3dEXT_capture;
+this->m_orig_glGetTextureSubImage = this->m_ptr_glGetTextureSubImage;
+if(this->m_ptr_glGetTextureSubImage)this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&CaptureTableDecorator::m_glGetTextureSubImage_capture;
+this->m_orig_glGetNamedRenderbufferParameteriv = this->m_ptr_glGetNamedRenderbufferParameteriv;
+if(this->m_ptr_glGetNamedRenderbufferParameteriv)this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetNamedRenderbufferParameteriv_capture;
+this->m_orig_glBindBuffersRange = this->m_ptr_glBindBuffersRange;
+if(this->m_ptr_glBindBuffersRange)this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&CaptureTableDecorator::m_glBindBuffersRange_capture;
+this->m_orig_glFinishAsyncSGIX = this->m_ptr_glFinishAsyncSGIX;
+if(this->m_ptr_glFinishAsyncSGIX)this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&CaptureTableDecorator::m_glFinishAsyncSGIX_capture;
+this->m_orig_glBindFragDataLocationIndexed = this->m_ptr_glBindFragDataLocationIndexed;
+if(this->m_ptr_glBindFragDataLocationIndexed)this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&CaptureTableDecorator::m_glBindFragDataLocationIndexed_capture;
+this->m_orig_glMultiTexCoord2dv = this->m_ptr_glMultiTexCoord2dv;
+if(this->m_ptr_glMultiTexCoord2dv)this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&CaptureTableDecorator::m_glMultiTexCoord2dv_capture;
+this->m_orig_glUniform2iv = this->m_ptr_glUniform2iv;
+if(this->m_ptr_glUniform2iv)this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&CaptureTableDecorator::m_glUniform2iv_capture;
+this->m_orig_glProgramUniform2i64vNV = this->m_ptr_glProgramUniform2i64vNV;
+if(this->m_ptr_glProgramUniform2i64vNV)this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&CaptureTableDecorator::m_glProgramUniform2i64vNV_capture;
+this->m_orig_glFlushVertexArrayRangeAPPLE = this->m_ptr_glFlushVertexArrayRangeAPPLE;
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE)this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&CaptureTableDecorator::m_glFlushVertexArrayRangeAPPLE_capture;
+this->m_orig_glTextureParameterf = this->m_ptr_glTextureParameterf;
+if(this->m_ptr_glTextureParameterf)this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&CaptureTableDecorator::m_glTextureParameterf_capture;
+this->m_orig_glMultiTexCoord3dvARB = this->m_ptr_glMultiTexCoord3dvARB;
+if(this->m_ptr_glMultiTexCoord3dvARB)this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord3dvARB_capture;
+this->m_orig_glFeedbackBuffer = this->m_ptr_glFeedbackBuffer;
+if(this->m_ptr_glFeedbackBuffer)this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&CaptureTableDecorator::m_glFeedbackBuffer_capture;
+this->m_orig_glDebugMessageInsertARB = this->m_ptr_glDebugMessageInsertARB;
+if(this->m_ptr_glDebugMessageInsertARB)this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&CaptureTableDecorator::m_glDebugMessageInsertARB_capture;
+this->m_orig_glMultiTexCoord2i = this->m_ptr_glMultiTexCoord2i;
+if(this->m_ptr_glMultiTexCoord2i)this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&CaptureTableDecorator::m_glMultiTexCoord2i_capture;
+this->m_orig_glTextureSubImage3D = this->m_ptr_glTextureSubImage3D;
+if(this->m_ptr_glTextureSubImage3D)this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&CaptureTableDecorator::m_glTextureSubImage3D_capture;
+this->m_orig_glFramebufferTexture1D = this->m_ptr_glFramebufferTexture1D;
+if(this->m_ptr_glFramebufferTexture1D)this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&CaptureTableDecorator::m_glFramebufferTexture1D_capture;
+this->m_orig_glGetShaderiv = this->m_ptr_glGetShaderiv;
+if(this->m_ptr_glGetShaderiv)this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&CaptureTableDecorator::m_glGetShaderiv_capture;
+this->m_orig_glMultiTexCoord2d = this->m_ptr_glMultiTexCoord2d;
+if(this->m_ptr_glMultiTexCoord2d)this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&CaptureTableDecorator::m_glMultiTexCoord2d_capture;
+this->m_orig_glArrayObjectATI = this->m_ptr_glArrayObjectATI;
+if(this->m_ptr_glArrayObjectATI)this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&CaptureTableDecorator::m_glArrayObjectATI_capture;
+this->m_orig_glGetPointeri_vEXT = this->m_ptr_glGetPointeri_vEXT;
+if(this->m_ptr_glGetPointeri_vEXT)this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&CaptureTableDecorator::m_glGetPointeri_vEXT_capture;
+this->m_orig_glGetPerfMonitorCountersAMD = this->m_ptr_glGetPerfMonitorCountersAMD;
+if(this->m_ptr_glGetPerfMonitorCountersAMD)this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorCountersAMD_capture;
+this->m_orig_glNamedBufferStorage = this->m_ptr_glNamedBufferStorage;
+if(this->m_ptr_glNamedBufferStorage)this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&CaptureTableDecorator::m_glNamedBufferStorage_capture;
+this->m_orig_glTexEnvxvOES = this->m_ptr_glTexEnvxvOES;
+if(this->m_ptr_glTexEnvxvOES)this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&CaptureTableDecorator::m_glTexEnvxvOES_capture;
+this->m_orig_glProgramUniform2ui64NV = this->m_ptr_glProgramUniform2ui64NV;
+if(this->m_ptr_glProgramUniform2ui64NV)this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&CaptureTableDecorator::m_glProgramUniform2ui64NV_capture;
+this->m_orig_glMultiTexCoord3bOES = this->m_ptr_glMultiTexCoord3bOES;
+if(this->m_ptr_glMultiTexCoord3bOES)this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&CaptureTableDecorator::m_glMultiTexCoord3bOES_capture;
+this->m_orig_glUniform1dv = this->m_ptr_glUniform1dv;
+if(this->m_ptr_glUniform1dv)this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&CaptureTableDecorator::m_glUniform1dv_capture;
+this->m_orig_glPixelTransferi = this->m_ptr_glPixelTransferi;
+if(this->m_ptr_glPixelTransferi)this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&CaptureTableDecorator::m_glPixelTransferi_capture;
+this->m_orig_glSecondaryColor3usvEXT = this->m_ptr_glSecondaryColor3usvEXT;
+if(this->m_ptr_glSecondaryColor3usvEXT)this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3usvEXT_capture;
+this->m_orig_glProgramEnvParameterI4uivNV = this->m_ptr_glProgramEnvParameterI4uivNV;
+if(this->m_ptr_glProgramEnvParameterI4uivNV)this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&CaptureTableDecorator::m_glProgramEnvParameterI4uivNV_capture;
+this->m_orig_glVertex2sv = this->m_ptr_glVertex2sv;
+if(this->m_ptr_glVertex2sv)this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&CaptureTableDecorator::m_glVertex2sv_capture;
+this->m_orig_glWindowPos4dMESA = this->m_ptr_glWindowPos4dMESA;
+if(this->m_ptr_glWindowPos4dMESA)this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&CaptureTableDecorator::m_glWindowPos4dMESA_capture;
+this->m_orig_glDebugMessageControlARB = this->m_ptr_glDebugMessageControlARB;
+if(this->m_ptr_glDebugMessageControlARB)this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&CaptureTableDecorator::m_glDebugMessageControlARB_capture;
+this->m_orig_glIsTextureEXT = this->m_ptr_glIsTextureEXT;
+if(this->m_ptr_glIsTextureEXT)this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&CaptureTableDecorator::m_glIsTextureEXT_capture;
+this->m_orig_glFragmentMaterialivSGIX = this->m_ptr_glFragmentMaterialivSGIX;
+if(this->m_ptr_glFragmentMaterialivSGIX)this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&CaptureTableDecorator::m_glFragmentMaterialivSGIX_capture;
+this->m_orig_glLinkProgramARB = this->m_ptr_glLinkProgramARB;
+if(this->m_ptr_glLinkProgramARB)this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&CaptureTableDecorator::m_glLinkProgramARB_capture;
+this->m_orig_glFinishFenceAPPLE = this->m_ptr_glFinishFenceAPPLE;
+if(this->m_ptr_glFinishFenceAPPLE)this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&CaptureTableDecorator::m_glFinishFenceAPPLE_capture;
+this->m_orig_glVertexArrayVertexAttribBindingEXT = this->m_ptr_glVertexArrayVertexAttribBindingEXT;
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT)this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribBindingEXT_capture;
+this->m_orig_glTexStorageMem3DMultisampleEXT = this->m_ptr_glTexStorageMem3DMultisampleEXT;
+if(this->m_ptr_glTexStorageMem3DMultisampleEXT)this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTexStorageMem3DMultisampleEXT_capture;
+this->m_orig_glUniform1ui64vARB = this->m_ptr_glUniform1ui64vARB;
+if(this->m_ptr_glUniform1ui64vARB)this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&CaptureTableDecorator::m_glUniform1ui64vARB_capture;
+this->m_orig_glMultiTexCoord4fv = this->m_ptr_glMultiTexCoord4fv;
+if(this->m_ptr_glMultiTexCoord4fv)this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&CaptureTableDecorator::m_glMultiTexCoord4fv_capture;
+this->m_orig_glMulticastFramebufferSampleLocationsfvNV = this->m_ptr_glMulticastFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glMulticastFramebufferSampleLocationsfvNV)this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&CaptureTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_capture;
+this->m_orig_glRasterPos3d = this->m_ptr_glRasterPos3d;
+if(this->m_ptr_glRasterPos3d)this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&CaptureTableDecorator::m_glRasterPos3d_capture;
+this->m_orig_glPollAsyncSGIX = this->m_ptr_glPollAsyncSGIX;
+if(this->m_ptr_glPollAsyncSGIX)this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&CaptureTableDecorator::m_glPollAsyncSGIX_capture;
+this->m_orig_glRasterPos3f = this->m_ptr_glRasterPos3f;
+if(this->m_ptr_glRasterPos3f)this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&CaptureTableDecorator::m_glRasterPos3f_capture;
+this->m_orig_glCompressedTexImage3D = this->m_ptr_glCompressedTexImage3D;
+if(this->m_ptr_glCompressedTexImage3D)this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&CaptureTableDecorator::m_glCompressedTexImage3D_capture;
+this->m_orig_glVariantivEXT = this->m_ptr_glVariantivEXT;
+if(this->m_ptr_glVariantivEXT)this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&CaptureTableDecorator::m_glVariantivEXT_capture;
+this->m_orig_glUnmapTexture2DINTEL = this->m_ptr_glUnmapTexture2DINTEL;
+if(this->m_ptr_glUnmapTexture2DINTEL)this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&CaptureTableDecorator::m_glUnmapTexture2DINTEL_capture;
+this->m_orig_glMulticastWaitSyncNV = this->m_ptr_glMulticastWaitSyncNV;
+if(this->m_ptr_glMulticastWaitSyncNV)this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&CaptureTableDecorator::m_glMulticastWaitSyncNV_capture;
+this->m_orig_glGetVertexAttribiv = this->m_ptr_glGetVertexAttribiv;
+if(this->m_ptr_glGetVertexAttribiv)this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&CaptureTableDecorator::m_glGetVertexAttribiv_capture;
+this->m_orig_glGetPathCoordsNV = this->m_ptr_glGetPathCoordsNV;
+if(this->m_ptr_glGetPathCoordsNV)this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&CaptureTableDecorator::m_glGetPathCoordsNV_capture;
+this->m_orig_glColor4xvOES = this->m_ptr_glColor4xvOES;
+if(this->m_ptr_glColor4xvOES)this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&CaptureTableDecorator::m_glColor4xvOES_capture;
+this->m_orig_glVertexAttrib3fv = this->m_ptr_glVertexAttrib3fv;
+if(this->m_ptr_glVertexAttrib3fv)this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&CaptureTableDecorator::m_glVertexAttrib3fv_capture;
+this->m_orig_glRasterPos3s = this->m_ptr_glRasterPos3s;
+if(this->m_ptr_glRasterPos3s)this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&CaptureTableDecorator::m_glRasterPos3s_capture;
+this->m_orig_glVertex4bOES = this->m_ptr_glVertex4bOES;
+if(this->m_ptr_glVertex4bOES)this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&CaptureTableDecorator::m_glVertex4bOES_capture;
+this->m_orig_glTransformFeedbackVaryingsEXT = this->m_ptr_glTransformFeedbackVaryingsEXT;
+if(this->m_ptr_glTransformFeedbackVaryingsEXT)this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&CaptureTableDecorator::m_glTransformFeedbackVaryingsEXT_capture;
+this->m_orig_glCombinerOutputNV = this->m_ptr_glCombinerOutputNV;
+if(this->m_ptr_glCombinerOutputNV)this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&CaptureTableDecorator::m_glCombinerOutputNV_capture;
+this->m_orig_glWindowPos4sMESA = this->m_ptr_glWindowPos4sMESA;
+if(this->m_ptr_glWindowPos4sMESA)this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&CaptureTableDecorator::m_glWindowPos4sMESA_capture;
+this->m_orig_glVertexAttrib4svARB = this->m_ptr_glVertexAttrib4svARB;
+if(this->m_ptr_glVertexAttrib4svARB)this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4svARB_capture;
+this->m_orig_glIsList = this->m_ptr_glIsList;
+if(this->m_ptr_glIsList)this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&CaptureTableDecorator::m_glIsList_capture;
+this->m_orig_glGetInfoLogARB = this->m_ptr_glGetInfoLogARB;
+if(this->m_ptr_glGetInfoLogARB)this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&CaptureTableDecorator::m_glGetInfoLogARB_capture;
+this->m_orig_glUniformMatrix2fv = this->m_ptr_glUniformMatrix2fv;
+if(this->m_ptr_glUniformMatrix2fv)this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&CaptureTableDecorator::m_glUniformMatrix2fv_capture;
+this->m_orig_glVertexAttribs3dvNV = this->m_ptr_glVertexAttribs3dvNV;
+if(this->m_ptr_glVertexAttribs3dvNV)this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&CaptureTableDecorator::m_glVertexAttribs3dvNV_capture;
+this->m_orig_glGlobalAlphaFactorsSUN = this->m_ptr_glGlobalAlphaFactorsSUN;
+if(this->m_ptr_glGlobalAlphaFactorsSUN)this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactorsSUN_capture;
+this->m_orig_glGetTrackMatrixivNV = this->m_ptr_glGetTrackMatrixivNV;
+if(this->m_ptr_glGetTrackMatrixivNV)this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&CaptureTableDecorator::m_glGetTrackMatrixivNV_capture;
+this->m_orig_glTextureParameterfvEXT = this->m_ptr_glTextureParameterfvEXT;
+if(this->m_ptr_glTextureParameterfvEXT)this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glTextureParameterfvEXT_capture;
+this->m_orig_glIsNamedBufferResidentNV = this->m_ptr_glIsNamedBufferResidentNV;
+if(this->m_ptr_glIsNamedBufferResidentNV)this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&CaptureTableDecorator::m_glIsNamedBufferResidentNV_capture;
+this->m_orig_glProgramUniform4ui64vARB = this->m_ptr_glProgramUniform4ui64vARB;
+if(this->m_ptr_glProgramUniform4ui64vARB)this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&CaptureTableDecorator::m_glProgramUniform4ui64vARB_capture;
+this->m_orig_glTbufferMask3DFX = this->m_ptr_glTbufferMask3DFX;
+if(this->m_ptr_glTbufferMask3DFX)this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&CaptureTableDecorator::m_glTbufferMask3DFX_capture;
+this->m_orig_glCoverFillPathNV = this->m_ptr_glCoverFillPathNV;
+if(this->m_ptr_glCoverFillPathNV)this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&CaptureTableDecorator::m_glCoverFillPathNV_capture;
+this->m_orig_glVertexAttrib1fvARB = this->m_ptr_glVertexAttrib1fvARB;
+if(this->m_ptr_glVertexAttrib1fvARB)this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&CaptureTableDecorator::m_glVertexAttrib1fvARB_capture;
+this->m_orig_glGenerateTextureMipmap = this->m_ptr_glGenerateTextureMipmap;
+if(this->m_ptr_glGenerateTextureMipmap)this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&CaptureTableDecorator::m_glGenerateTextureMipmap_capture;
+this->m_orig_glNamedProgramLocalParameterI4uivEXT = this->m_ptr_glNamedProgramLocalParameterI4uivEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT)this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_capture;
+this->m_orig_glMultiDrawElementsBaseVertex = this->m_ptr_glMultiDrawElementsBaseVertex;
+if(this->m_ptr_glMultiDrawElementsBaseVertex)this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&CaptureTableDecorator::m_glMultiDrawElementsBaseVertex_capture;
+this->m_orig_glProgramSubroutineParametersuivNV = this->m_ptr_glProgramSubroutineParametersuivNV;
+if(this->m_ptr_glProgramSubroutineParametersuivNV)this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&CaptureTableDecorator::m_glProgramSubroutineParametersuivNV_capture;
+this->m_orig_glProgramUniformMatrix2x4dvEXT = this->m_ptr_glProgramUniformMatrix2x4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT)this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2x4dvEXT_capture;
+this->m_orig_glRotatexOES = this->m_ptr_glRotatexOES;
+if(this->m_ptr_glRotatexOES)this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&CaptureTableDecorator::m_glRotatexOES_capture;
+this->m_orig_glMemoryBarrierEXT = this->m_ptr_glMemoryBarrierEXT;
+if(this->m_ptr_glMemoryBarrierEXT)this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&CaptureTableDecorator::m_glMemoryBarrierEXT_capture;
+this->m_orig_glVertexAttrib3svNV = this->m_ptr_glVertexAttrib3svNV;
+if(this->m_ptr_glVertexAttrib3svNV)this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&CaptureTableDecorator::m_glVertexAttrib3svNV_capture;
+this->m_orig_glVertexStream3iATI = this->m_ptr_glVertexStream3iATI;
+if(this->m_ptr_glVertexStream3iATI)this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&CaptureTableDecorator::m_glVertexStream3iATI_capture;
+this->m_orig_glCompressedTexSubImage1D = this->m_ptr_glCompressedTexSubImage1D;
+if(this->m_ptr_glCompressedTexSubImage1D)this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&CaptureTableDecorator::m_glCompressedTexSubImage1D_capture;
+this->m_orig_glSetFenceNV = this->m_ptr_glSetFenceNV;
+if(this->m_ptr_glSetFenceNV)this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&CaptureTableDecorator::m_glSetFenceNV_capture;
+this->m_orig_glAttachObjectARB = this->m_ptr_glAttachObjectARB;
+if(this->m_ptr_glAttachObjectARB)this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&CaptureTableDecorator::m_glAttachObjectARB_capture;
+this->m_orig_glCopyConvolutionFilter1D = this->m_ptr_glCopyConvolutionFilter1D;
+if(this->m_ptr_glCopyConvolutionFilter1D)this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&CaptureTableDecorator::m_glCopyConvolutionFilter1D_capture;
+this->m_orig_glTexStorageMem2DMultisampleEXT = this->m_ptr_glTexStorageMem2DMultisampleEXT;
+if(this->m_ptr_glTexStorageMem2DMultisampleEXT)this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTexStorageMem2DMultisampleEXT_capture;
+this->m_orig_glProgramParameters4fvNV = this->m_ptr_glProgramParameters4fvNV;
+if(this->m_ptr_glProgramParameters4fvNV)this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&CaptureTableDecorator::m_glProgramParameters4fvNV_capture;
+this->m_orig_glNamedFramebufferParameteriEXT = this->m_ptr_glNamedFramebufferParameteriEXT;
+if(this->m_ptr_glNamedFramebufferParameteriEXT)this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferParameteriEXT_capture;
+this->m_orig_glVertexAttrib4Nsv = this->m_ptr_glVertexAttrib4Nsv;
+if(this->m_ptr_glVertexAttrib4Nsv)this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&CaptureTableDecorator::m_glVertexAttrib4Nsv_capture;
+this->m_orig_glVertexAttribI4usvEXT = this->m_ptr_glVertexAttribI4usvEXT;
+if(this->m_ptr_glVertexAttribI4usvEXT)this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&CaptureTableDecorator::m_glVertexAttribI4usvEXT_capture;
+this->m_orig_glTextureBufferRangeEXT = this->m_ptr_glTextureBufferRangeEXT;
+if(this->m_ptr_glTextureBufferRangeEXT)this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&CaptureTableDecorator::m_glTextureBufferRangeEXT_capture;
+this->m_orig_glVertexP3uiv = this->m_ptr_glVertexP3uiv;
+if(this->m_ptr_glVertexP3uiv)this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&CaptureTableDecorator::m_glVertexP3uiv_capture;
+this->m_orig_glIsPathNV = this->m_ptr_glIsPathNV;
+if(this->m_ptr_glIsPathNV)this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&CaptureTableDecorator::m_glIsPathNV_capture;
+this->m_orig_glGetnUniformi64vARB = this->m_ptr_glGetnUniformi64vARB;
+if(this->m_ptr_glGetnUniformi64vARB)this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&CaptureTableDecorator::m_glGetnUniformi64vARB_capture;
+this->m_orig_glFramebufferTextureMultiviewOVR = this->m_ptr_glFramebufferTextureMultiviewOVR;
+if(this->m_ptr_glFramebufferTextureMultiviewOVR)this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&CaptureTableDecorator::m_glFramebufferTextureMultiviewOVR_capture;
+this->m_orig_glCompressedMultiTexSubImage2DEXT = this->m_ptr_glCompressedMultiTexSubImage2DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT)this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCompressedMultiTexSubImage2DEXT_capture;
+this->m_orig_glGetnMapdv = this->m_ptr_glGetnMapdv;
+if(this->m_ptr_glGetnMapdv)this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&CaptureTableDecorator::m_glGetnMapdv_capture;
+this->m_orig_glDebugMessageCallback = this->m_ptr_glDebugMessageCallback;
+if(this->m_ptr_glDebugMessageCallback)this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&CaptureTableDecorator::m_glDebugMessageCallback_capture;
+this->m_orig_glTangent3svEXT = this->m_ptr_glTangent3svEXT;
+if(this->m_ptr_glTangent3svEXT)this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&CaptureTableDecorator::m_glTangent3svEXT_capture;
+this->m_orig_glVertexAttribParameteriAMD = this->m_ptr_glVertexAttribParameteriAMD;
+if(this->m_ptr_glVertexAttribParameteriAMD)this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&CaptureTableDecorator::m_glVertexAttribParameteriAMD_capture;
+this->m_orig_glBufferSubDataARB = this->m_ptr_glBufferSubDataARB;
+if(this->m_ptr_glBufferSubDataARB)this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&CaptureTableDecorator::m_glBufferSubDataARB_capture;
+this->m_orig_glGetVertexAttribLui64vARB = this->m_ptr_glGetVertexAttribLui64vARB;
+if(this->m_ptr_glGetVertexAttribLui64vARB)this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&CaptureTableDecorator::m_glGetVertexAttribLui64vARB_capture;
+this->m_orig_glVertexAttribL4ui64NV = this->m_ptr_glVertexAttribL4ui64NV;
+if(this->m_ptr_glVertexAttribL4ui64NV)this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&CaptureTableDecorator::m_glVertexAttribL4ui64NV_capture;
+this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_capture;
+this->m_orig_glImageTransformParameterfHP = this->m_ptr_glImageTransformParameterfHP;
+if(this->m_ptr_glImageTransformParameterfHP)this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&CaptureTableDecorator::m_glImageTransformParameterfHP_capture;
+this->m_orig_glMap1f = this->m_ptr_glMap1f;
+if(this->m_ptr_glMap1f)this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&CaptureTableDecorator::m_glMap1f_capture;
+this->m_orig_glRasterPos4fv = this->m_ptr_glRasterPos4fv;
+if(this->m_ptr_glRasterPos4fv)this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&CaptureTableDecorator::m_glRasterPos4fv_capture;
+this->m_orig_glVertex2bvOES = this->m_ptr_glVertex2bvOES;
+if(this->m_ptr_glVertex2bvOES)this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&CaptureTableDecorator::m_glVertex2bvOES_capture;
+this->m_orig_glGetMapControlPointsNV = this->m_ptr_glGetMapControlPointsNV;
+if(this->m_ptr_glGetMapControlPointsNV)this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&CaptureTableDecorator::m_glGetMapControlPointsNV_capture;
+this->m_orig_glNamedProgramLocalParametersI4ivEXT = this->m_ptr_glNamedProgramLocalParametersI4ivEXT;
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT)this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_capture;
+this->m_orig_glBindBufferRangeNV = this->m_ptr_glBindBufferRangeNV;
+if(this->m_ptr_glBindBufferRangeNV)this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&CaptureTableDecorator::m_glBindBufferRangeNV_capture;
+this->m_orig_glVertexStream3dvATI = this->m_ptr_glVertexStream3dvATI;
+if(this->m_ptr_glVertexStream3dvATI)this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&CaptureTableDecorator::m_glVertexStream3dvATI_capture;
+this->m_orig_glNormalPointerListIBM = this->m_ptr_glNormalPointerListIBM;
+if(this->m_ptr_glNormalPointerListIBM)this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&CaptureTableDecorator::m_glNormalPointerListIBM_capture;
+this->m_orig_glFogFuncSGIS = this->m_ptr_glFogFuncSGIS;
+if(this->m_ptr_glFogFuncSGIS)this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&CaptureTableDecorator::m_glFogFuncSGIS_capture;
+this->m_orig_glMultiModeDrawArraysIBM = this->m_ptr_glMultiModeDrawArraysIBM;
+if(this->m_ptr_glMultiModeDrawArraysIBM)this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&CaptureTableDecorator::m_glMultiModeDrawArraysIBM_capture;
+this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT = this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT)this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_capture;
+this->m_orig_glGetFloatv = this->m_ptr_glGetFloatv;
+if(this->m_ptr_glGetFloatv)this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&CaptureTableDecorator::m_glGetFloatv_capture;
+this->m_orig_glVertexArrayVertexAttribIFormatEXT = this->m_ptr_glVertexArrayVertexAttribIFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT)this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&CaptureTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_capture;
+this->m_orig_glHint = this->m_ptr_glHint;
+if(this->m_ptr_glHint)this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&CaptureTableDecorator::m_glHint_capture;
+this->m_orig_glVertexStream2svATI = this->m_ptr_glVertexStream2svATI;
+if(this->m_ptr_glVertexStream2svATI)this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&CaptureTableDecorator::m_glVertexStream2svATI_capture;
+this->m_orig_glMultiDrawArraysIndirect = this->m_ptr_glMultiDrawArraysIndirect;
+if(this->m_ptr_glMultiDrawArraysIndirect)this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&CaptureTableDecorator::m_glMultiDrawArraysIndirect_capture;
+this->m_orig_glMultiTexEnvfvEXT = this->m_ptr_glMultiTexEnvfvEXT;
+if(this->m_ptr_glMultiTexEnvfvEXT)this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&CaptureTableDecorator::m_glMultiTexEnvfvEXT_capture;
+this->m_orig_glVertexAttribP2uiv = this->m_ptr_glVertexAttribP2uiv;
+if(this->m_ptr_glVertexAttribP2uiv)this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&CaptureTableDecorator::m_glVertexAttribP2uiv_capture;
+this->m_orig_glProgramUniform1i64vARB = this->m_ptr_glProgramUniform1i64vARB;
+if(this->m_ptr_glProgramUniform1i64vARB)this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&CaptureTableDecorator::m_glProgramUniform1i64vARB_capture;
+this->m_orig_glFramebufferTextureARB = this->m_ptr_glFramebufferTextureARB;
+if(this->m_ptr_glFramebufferTextureARB)this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&CaptureTableDecorator::m_glFramebufferTextureARB_capture;
+this->m_orig_glPushClientAttribDefaultEXT = this->m_ptr_glPushClientAttribDefaultEXT;
+if(this->m_ptr_glPushClientAttribDefaultEXT)this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&CaptureTableDecorator::m_glPushClientAttribDefaultEXT_capture;
+this->m_orig_glScalef = this->m_ptr_glScalef;
+if(this->m_ptr_glScalef)this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&CaptureTableDecorator::m_glScalef_capture;
+this->m_orig_glScaled = this->m_ptr_glScaled;
+if(this->m_ptr_glScaled)this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&CaptureTableDecorator::m_glScaled_capture;
+this->m_orig_glGetConvolutionParameterxvOES = this->m_ptr_glGetConvolutionParameterxvOES;
+if(this->m_ptr_glGetConvolutionParameterxvOES)this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&CaptureTableDecorator::m_glGetConvolutionParameterxvOES_capture;
+this->m_orig_glGetProgramResourceName = this->m_ptr_glGetProgramResourceName;
+if(this->m_ptr_glGetProgramResourceName)this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&CaptureTableDecorator::m_glGetProgramResourceName_capture;
+this->m_orig_glCopyColorTable = this->m_ptr_glCopyColorTable;
+if(this->m_ptr_glCopyColorTable)this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&CaptureTableDecorator::m_glCopyColorTable_capture;
+this->m_orig_glDepthRangeArrayv = this->m_ptr_glDepthRangeArrayv;
+if(this->m_ptr_glDepthRangeArrayv)this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&CaptureTableDecorator::m_glDepthRangeArrayv_capture;
+this->m_orig_glCoverFillPathInstancedNV = this->m_ptr_glCoverFillPathInstancedNV;
+if(this->m_ptr_glCoverFillPathInstancedNV)this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glCoverFillPathInstancedNV_capture;
+this->m_orig_glMultiTexParameterivEXT = this->m_ptr_glMultiTexParameterivEXT;
+if(this->m_ptr_glMultiTexParameterivEXT)this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glMultiTexParameterivEXT_capture;
+this->m_orig_glGetActiveAtomicCounterBufferiv = this->m_ptr_glGetActiveAtomicCounterBufferiv;
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv)this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&CaptureTableDecorator::m_glGetActiveAtomicCounterBufferiv_capture;
+this->m_orig_glStencilOpSeparate = this->m_ptr_glStencilOpSeparate;
+if(this->m_ptr_glStencilOpSeparate)this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&CaptureTableDecorator::m_glStencilOpSeparate_capture;
+this->m_orig_glVertexAttrib4fNV = this->m_ptr_glVertexAttrib4fNV;
+if(this->m_ptr_glVertexAttrib4fNV)this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&CaptureTableDecorator::m_glVertexAttrib4fNV_capture;
+this->m_orig_glGetColorTableParameterivSGI = this->m_ptr_glGetColorTableParameterivSGI;
+if(this->m_ptr_glGetColorTableParameterivSGI)this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&CaptureTableDecorator::m_glGetColorTableParameterivSGI_capture;
+this->m_orig_glVertexArrayAttribBinding = this->m_ptr_glVertexArrayAttribBinding;
+if(this->m_ptr_glVertexArrayAttribBinding)this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&CaptureTableDecorator::m_glVertexArrayAttribBinding_capture;
+this->m_orig_glIsSemaphoreEXT = this->m_ptr_glIsSemaphoreEXT;
+if(this->m_ptr_glIsSemaphoreEXT)this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&CaptureTableDecorator::m_glIsSemaphoreEXT_capture;
+this->m_orig_glProgramParameters4dvNV = this->m_ptr_glProgramParameters4dvNV;
+if(this->m_ptr_glProgramParameters4dvNV)this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&CaptureTableDecorator::m_glProgramParameters4dvNV_capture;
+this->m_orig_glVertexAttribL4dv = this->m_ptr_glVertexAttribL4dv;
+if(this->m_ptr_glVertexAttribL4dv)this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&CaptureTableDecorator::m_glVertexAttribL4dv_capture;
+this->m_orig_glGetTexParameteriv = this->m_ptr_glGetTexParameteriv;
+if(this->m_ptr_glGetTexParameteriv)this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&CaptureTableDecorator::m_glGetTexParameteriv_capture;
+this->m_orig_glGetUniformOffsetEXT = this->m_ptr_glGetUniformOffsetEXT;
+if(this->m_ptr_glGetUniformOffsetEXT)this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&CaptureTableDecorator::m_glGetUniformOffsetEXT_capture;
+this->m_orig_glGetVertexAttribPointerv = this->m_ptr_glGetVertexAttribPointerv;
+if(this->m_ptr_glGetVertexAttribPointerv)this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&CaptureTableDecorator::m_glGetVertexAttribPointerv_capture;
+this->m_orig_glResumeTransformFeedbackNV = this->m_ptr_glResumeTransformFeedbackNV;
+if(this->m_ptr_glResumeTransformFeedbackNV)this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glResumeTransformFeedbackNV_capture;
+this->m_orig_glProgramUniform3i64vNV = this->m_ptr_glProgramUniform3i64vNV;
+if(this->m_ptr_glProgramUniform3i64vNV)this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&CaptureTableDecorator::m_glProgramUniform3i64vNV_capture;
+this->m_orig_glTangent3fEXT = this->m_ptr_glTangent3fEXT;
+if(this->m_ptr_glTangent3fEXT)this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&CaptureTableDecorator::m_glTangent3fEXT_capture;
+this->m_orig_glGetPathMetricRangeNV = this->m_ptr_glGetPathMetricRangeNV;
+if(this->m_ptr_glGetPathMetricRangeNV)this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&CaptureTableDecorator::m_glGetPathMetricRangeNV_capture;
+this->m_orig_glWindowPos2iMESA = this->m_ptr_glWindowPos2iMESA;
+if(this->m_ptr_glWindowPos2iMESA)this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&CaptureTableDecorator::m_glWindowPos2iMESA_capture;
+this->m_orig_glVertex2xvOES = this->m_ptr_glVertex2xvOES;
+if(this->m_ptr_glVertex2xvOES)this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&CaptureTableDecorator::m_glVertex2xvOES_capture;
+this->m_orig_glGetnCompressedTexImage = this->m_ptr_glGetnCompressedTexImage;
+if(this->m_ptr_glGetnCompressedTexImage)this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&CaptureTableDecorator::m_glGetnCompressedTexImage_capture;
+this->m_orig_glWindowPos2dv = this->m_ptr_glWindowPos2dv;
+if(this->m_ptr_glWindowPos2dv)this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&CaptureTableDecorator::m_glWindowPos2dv_capture;
+this->m_orig_glReplacementCodeuiVertex3fSUN = this->m_ptr_glReplacementCodeuiVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN)this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&CaptureTableDecorator::m_glReplacementCodeuiVertex3fSUN_capture;
+this->m_orig_glGetTransformFeedbackVaryingEXT = this->m_ptr_glGetTransformFeedbackVaryingEXT;
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT)this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&CaptureTableDecorator::m_glGetTransformFeedbackVaryingEXT_capture;
+this->m_orig_glWindowPos3fARB = this->m_ptr_glWindowPos3fARB;
+if(this->m_ptr_glWindowPos3fARB)this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&CaptureTableDecorator::m_glWindowPos3fARB_capture;
+this->m_orig_glMapNamedBufferEXT = this->m_ptr_glMapNamedBufferEXT;
+if(this->m_ptr_glMapNamedBufferEXT)this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&CaptureTableDecorator::m_glMapNamedBufferEXT_capture;
+this->m_orig_glDisable = this->m_ptr_glDisable;
+if(this->m_ptr_glDisable)this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&CaptureTableDecorator::m_glDisable_capture;
+this->m_orig_glIsPointInFillPathNV = this->m_ptr_glIsPointInFillPathNV;
+if(this->m_ptr_glIsPointInFillPathNV)this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&CaptureTableDecorator::m_glIsPointInFillPathNV_capture;
+this->m_orig_glVertexAttribI2uiEXT = this->m_ptr_glVertexAttribI2uiEXT;
+if(this->m_ptr_glVertexAttribI2uiEXT)this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&CaptureTableDecorator::m_glVertexAttribI2uiEXT_capture;
+this->m_orig_glProgramUniform4uiv = this->m_ptr_glProgramUniform4uiv;
+if(this->m_ptr_glProgramUniform4uiv)this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&CaptureTableDecorator::m_glProgramUniform4uiv_capture;
+this->m_orig_glQueryCounter = this->m_ptr_glQueryCounter;
+if(this->m_ptr_glQueryCounter)this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&CaptureTableDecorator::m_glQueryCounter_capture;
+this->m_orig_glFramebufferRenderbufferEXT = this->m_ptr_glFramebufferRenderbufferEXT;
+if(this->m_ptr_glFramebufferRenderbufferEXT)this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glFramebufferRenderbufferEXT_capture;
+this->m_orig_glBinormal3svEXT = this->m_ptr_glBinormal3svEXT;
+if(this->m_ptr_glBinormal3svEXT)this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&CaptureTableDecorator::m_glBinormal3svEXT_capture;
+this->m_orig_glBindBufferOffsetNV = this->m_ptr_glBindBufferOffsetNV;
+if(this->m_ptr_glBindBufferOffsetNV)this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&CaptureTableDecorator::m_glBindBufferOffsetNV_capture;
+this->m_orig_glCopyTextureSubImage2D = this->m_ptr_glCopyTextureSubImage2D;
+if(this->m_ptr_glCopyTextureSubImage2D)this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&CaptureTableDecorator::m_glCopyTextureSubImage2D_capture;
+this->m_orig_glGetProgramResourcefvNV = this->m_ptr_glGetProgramResourcefvNV;
+if(this->m_ptr_glGetProgramResourcefvNV)this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&CaptureTableDecorator::m_glGetProgramResourcefvNV_capture;
+this->m_orig_glBinormalPointerEXT = this->m_ptr_glBinormalPointerEXT;
+if(this->m_ptr_glBinormalPointerEXT)this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&CaptureTableDecorator::m_glBinormalPointerEXT_capture;
+this->m_orig_glGetLightfv = this->m_ptr_glGetLightfv;
+if(this->m_ptr_glGetLightfv)this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&CaptureTableDecorator::m_glGetLightfv_capture;
+this->m_orig_glMulticastCopyImageSubDataNV = this->m_ptr_glMulticastCopyImageSubDataNV;
+if(this->m_ptr_glMulticastCopyImageSubDataNV)this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&CaptureTableDecorator::m_glMulticastCopyImageSubDataNV_capture;
+this->m_orig_glVertex2bOES = this->m_ptr_glVertex2bOES;
+if(this->m_ptr_glVertex2bOES)this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&CaptureTableDecorator::m_glVertex2bOES_capture;
+this->m_orig_glUniform2ivARB = this->m_ptr_glUniform2ivARB;
+if(this->m_ptr_glUniform2ivARB)this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&CaptureTableDecorator::m_glUniform2ivARB_capture;
+this->m_orig_glMultiTexCoord3s = this->m_ptr_glMultiTexCoord3s;
+if(this->m_ptr_glMultiTexCoord3s)this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&CaptureTableDecorator::m_glMultiTexCoord3s_capture;
+this->m_orig_glGetHistogramParameterfvEXT = this->m_ptr_glGetHistogramParameterfvEXT;
+if(this->m_ptr_glGetHistogramParameterfvEXT)this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glGetHistogramParameterfvEXT_capture;
+this->m_orig_glGetProgramStringNV = this->m_ptr_glGetProgramStringNV;
+if(this->m_ptr_glGetProgramStringNV)this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&CaptureTableDecorator::m_glGetProgramStringNV_capture;
+this->m_orig_glGetTexGenxvOES = this->m_ptr_glGetTexGenxvOES;
+if(this->m_ptr_glGetTexGenxvOES)this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&CaptureTableDecorator::m_glGetTexGenxvOES_capture;
+this->m_orig_glTextureSubImage2D = this->m_ptr_glTextureSubImage2D;
+if(this->m_ptr_glTextureSubImage2D)this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&CaptureTableDecorator::m_glTextureSubImage2D_capture;
+this->m_orig_glObjectPurgeableAPPLE = this->m_ptr_glObjectPurgeableAPPLE;
+if(this->m_ptr_glObjectPurgeableAPPLE)this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&CaptureTableDecorator::m_glObjectPurgeableAPPLE_capture;
+this->m_orig_glColorTableSGI = this->m_ptr_glColorTableSGI;
+if(this->m_ptr_glColorTableSGI)this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&CaptureTableDecorator::m_glColorTableSGI_capture;
+this->m_orig_glCopyConvolutionFilter2DEXT = this->m_ptr_glCopyConvolutionFilter2DEXT;
+if(this->m_ptr_glCopyConvolutionFilter2DEXT)this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&CaptureTableDecorator::m_glCopyConvolutionFilter2DEXT_capture;
+this->m_orig_glMultiTexCoord3f = this->m_ptr_glMultiTexCoord3f;
+if(this->m_ptr_glMultiTexCoord3f)this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&CaptureTableDecorator::m_glMultiTexCoord3f_capture;
+this->m_orig_glMultiTexCoord3d = this->m_ptr_glMultiTexCoord3d;
+if(this->m_ptr_glMultiTexCoord3d)this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&CaptureTableDecorator::m_glMultiTexCoord3d_capture;
+this->m_orig_glFogCoorddv = this->m_ptr_glFogCoorddv;
+if(this->m_ptr_glFogCoorddv)this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&CaptureTableDecorator::m_glFogCoorddv_capture;
+this->m_orig_glGetBufferPointerv = this->m_ptr_glGetBufferPointerv;
+if(this->m_ptr_glGetBufferPointerv)this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&CaptureTableDecorator::m_glGetBufferPointerv_capture;
+this->m_orig_glProgramUniform1fEXT = this->m_ptr_glProgramUniform1fEXT;
+if(this->m_ptr_glProgramUniform1fEXT)this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&CaptureTableDecorator::m_glProgramUniform1fEXT_capture;
+this->m_orig_glWindowPos2fvMESA = this->m_ptr_glWindowPos2fvMESA;
+if(this->m_ptr_glWindowPos2fvMESA)this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&CaptureTableDecorator::m_glWindowPos2fvMESA_capture;
+this->m_orig_glAlphaToCoverageDitherControlNV = this->m_ptr_glAlphaToCoverageDitherControlNV;
+if(this->m_ptr_glAlphaToCoverageDitherControlNV)this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&CaptureTableDecorator::m_glAlphaToCoverageDitherControlNV_capture;
+this->m_orig_glPolygonOffsetxOES = this->m_ptr_glPolygonOffsetxOES;
+if(this->m_ptr_glPolygonOffsetxOES)this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&CaptureTableDecorator::m_glPolygonOffsetxOES_capture;
+this->m_orig_glVertexAttrib4dARB = this->m_ptr_glVertexAttrib4dARB;
+if(this->m_ptr_glVertexAttrib4dARB)this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&CaptureTableDecorator::m_glVertexAttrib4dARB_capture;
+this->m_orig_glUniformHandleui64vARB = this->m_ptr_glUniformHandleui64vARB;
+if(this->m_ptr_glUniformHandleui64vARB)this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&CaptureTableDecorator::m_glUniformHandleui64vARB_capture;
+this->m_orig_glFragmentLightModelfvSGIX = this->m_ptr_glFragmentLightModelfvSGIX;
+if(this->m_ptr_glFragmentLightModelfvSGIX)this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&CaptureTableDecorator::m_glFragmentLightModelfvSGIX_capture;
+this->m_orig_glSwizzleEXT = this->m_ptr_glSwizzleEXT;
+if(this->m_ptr_glSwizzleEXT)this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&CaptureTableDecorator::m_glSwizzleEXT_capture;
+this->m_orig_glBindFragmentShaderATI = this->m_ptr_glBindFragmentShaderATI;
+if(this->m_ptr_glBindFragmentShaderATI)this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&CaptureTableDecorator::m_glBindFragmentShaderATI_capture;
+this->m_orig_glVertexAttribs3hvNV = this->m_ptr_glVertexAttribs3hvNV;
+if(this->m_ptr_glVertexAttribs3hvNV)this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&CaptureTableDecorator::m_glVertexAttribs3hvNV_capture;
+this->m_orig_glGenBuffersARB = this->m_ptr_glGenBuffersARB;
+if(this->m_ptr_glGenBuffersARB)this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&CaptureTableDecorator::m_glGenBuffersARB_capture;
+this->m_orig_glTextureStorageMem2DMultisampleEXT = this->m_ptr_glTextureStorageMem2DMultisampleEXT;
+if(this->m_ptr_glTextureStorageMem2DMultisampleEXT)this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&CaptureTableDecorator::m_glTextureStorageMem2DMultisampleEXT_capture;
+this->m_orig_glListParameterfvSGIX = this->m_ptr_glListParameterfvSGIX;
+if(this->m_ptr_glListParameterfvSGIX)this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&CaptureTableDecorator::m_glListParameterfvSGIX_capture;
+this->m_orig_glNamedRenderbufferStorageMultisample = this->m_ptr_glNamedRenderbufferStorageMultisample;
+if(this->m_ptr_glNamedRenderbufferStorageMultisample)this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&CaptureTableDecorator::m_glNamedRenderbufferStorageMultisample_capture;
+this->m_orig_glVertexAttribI1iEXT = this->m_ptr_glVertexAttribI1iEXT;
+if(this->m_ptr_glVertexAttribI1iEXT)this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&CaptureTableDecorator::m_glVertexAttribI1iEXT_capture;
+this->m_orig_glMultiTexCoord2ivARB = this->m_ptr_glMultiTexCoord2ivARB;
+if(this->m_ptr_glMultiTexCoord2ivARB)this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2ivARB_capture;
+this->m_orig_glLightModelxOES = this->m_ptr_glLightModelxOES;
+if(this->m_ptr_glLightModelxOES)this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&CaptureTableDecorator::m_glLightModelxOES_capture;
+this->m_orig_glColor3xOES = this->m_ptr_glColor3xOES;
+if(this->m_ptr_glColor3xOES)this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&CaptureTableDecorator::m_glColor3xOES_capture;
+this->m_orig_glReadBuffer = this->m_ptr_glReadBuffer;
+if(this->m_ptr_glReadBuffer)this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&CaptureTableDecorator::m_glReadBuffer_capture;
+this->m_orig_glStencilFillPathInstancedNV = this->m_ptr_glStencilFillPathInstancedNV;
+if(this->m_ptr_glStencilFillPathInstancedNV)this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&CaptureTableDecorator::m_glStencilFillPathInstancedNV_capture;
+this->m_orig_glVDPAUUnmapSurfacesNV = this->m_ptr_glVDPAUUnmapSurfacesNV;
+if(this->m_ptr_glVDPAUUnmapSurfacesNV)this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&CaptureTableDecorator::m_glVDPAUUnmapSurfacesNV_capture;
+this->m_orig_glProgramUniform4i64NV = this->m_ptr_glProgramUniform4i64NV;
+if(this->m_ptr_glProgramUniform4i64NV)this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&CaptureTableDecorator::m_glProgramUniform4i64NV_capture;
+this->m_orig_glVertexStream4dvATI = this->m_ptr_glVertexStream4dvATI;
+if(this->m_ptr_glVertexStream4dvATI)this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&CaptureTableDecorator::m_glVertexStream4dvATI_capture;
+this->m_orig_glIsQuery = this->m_ptr_glIsQuery;
+if(this->m_ptr_glIsQuery)this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&CaptureTableDecorator::m_glIsQuery_capture;
+this->m_orig_glProgramUniformMatrix4fvEXT = this->m_ptr_glProgramUniformMatrix4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4fvEXT)this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4fvEXT_capture;
+this->m_orig_glVertexAttrib3hNV = this->m_ptr_glVertexAttrib3hNV;
+if(this->m_ptr_glVertexAttrib3hNV)this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&CaptureTableDecorator::m_glVertexAttrib3hNV_capture;
+this->m_orig_glFlushMappedNamedBufferRange = this->m_ptr_glFlushMappedNamedBufferRange;
+if(this->m_ptr_glFlushMappedNamedBufferRange)this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&CaptureTableDecorator::m_glFlushMappedNamedBufferRange_capture;
+this->m_orig_glPushName = this->m_ptr_glPushName;
+if(this->m_ptr_glPushName)this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&CaptureTableDecorator::m_glPushName_capture;
+this->m_orig_glGetClipPlane = this->m_ptr_glGetClipPlane;
+if(this->m_ptr_glGetClipPlane)this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&CaptureTableDecorator::m_glGetClipPlane_capture;
+this->m_orig_glVertex4dv = this->m_ptr_glVertex4dv;
+if(this->m_ptr_glVertex4dv)this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&CaptureTableDecorator::m_glVertex4dv_capture;
+this->m_orig_glVertexAttrib3d = this->m_ptr_glVertexAttrib3d;
+if(this->m_ptr_glVertexAttrib3d)this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&CaptureTableDecorator::m_glVertexAttrib3d_capture;
+this->m_orig_glBlendColor = this->m_ptr_glBlendColor;
+if(this->m_ptr_glBlendColor)this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&CaptureTableDecorator::m_glBlendColor_capture;
+this->m_orig_glBindTransformFeedbackNV = this->m_ptr_glBindTransformFeedbackNV;
+if(this->m_ptr_glBindTransformFeedbackNV)this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glBindTransformFeedbackNV_capture;
+this->m_orig_glSamplerParameterIuiv = this->m_ptr_glSamplerParameterIuiv;
+if(this->m_ptr_glSamplerParameterIuiv)this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&CaptureTableDecorator::m_glSamplerParameterIuiv_capture;
+this->m_orig_glIndexubv = this->m_ptr_glIndexubv;
+if(this->m_ptr_glIndexubv)this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&CaptureTableDecorator::m_glIndexubv_capture;
+this->m_orig_glNamedBufferPageCommitmentEXT = this->m_ptr_glNamedBufferPageCommitmentEXT;
+if(this->m_ptr_glNamedBufferPageCommitmentEXT)this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&CaptureTableDecorator::m_glNamedBufferPageCommitmentEXT_capture;
+this->m_orig_glCheckNamedFramebufferStatus = this->m_ptr_glCheckNamedFramebufferStatus;
+if(this->m_ptr_glCheckNamedFramebufferStatus)this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&CaptureTableDecorator::m_glCheckNamedFramebufferStatus_capture;
+this->m_orig_glGetObjectBufferfvATI = this->m_ptr_glGetObjectBufferfvATI;
+if(this->m_ptr_glGetObjectBufferfvATI)this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&CaptureTableDecorator::m_glGetObjectBufferfvATI_capture;
+this->m_orig_glRasterPos4d = this->m_ptr_glRasterPos4d;
+if(this->m_ptr_glRasterPos4d)this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&CaptureTableDecorator::m_glRasterPos4d_capture;
+this->m_orig_glRasterPos4f = this->m_ptr_glRasterPos4f;
+if(this->m_ptr_glRasterPos4f)this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&CaptureTableDecorator::m_glRasterPos4f_capture;
+this->m_orig_glGetPerfMonitorCounterStringAMD = this->m_ptr_glGetPerfMonitorCounterStringAMD;
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD)this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorCounterStringAMD_capture;
+this->m_orig_glVertexAttrib3s = this->m_ptr_glVertexAttrib3s;
+if(this->m_ptr_glVertexAttrib3s)this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&CaptureTableDecorator::m_glVertexAttrib3s_capture;
+this->m_orig_glDrawElementsInstancedEXT = this->m_ptr_glDrawElementsInstancedEXT;
+if(this->m_ptr_glDrawElementsInstancedEXT)this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&CaptureTableDecorator::m_glDrawElementsInstancedEXT_capture;
+this->m_orig_glNamedProgramLocalParameterI4iEXT = this->m_ptr_glNamedProgramLocalParameterI4iEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT)this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameterI4iEXT_capture;
+this->m_orig_glRasterPos4s = this->m_ptr_glRasterPos4s;
+if(this->m_ptr_glRasterPos4s)this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&CaptureTableDecorator::m_glRasterPos4s_capture;
+this->m_orig_glGetProgramStageiv = this->m_ptr_glGetProgramStageiv;
+if(this->m_ptr_glGetProgramStageiv)this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&CaptureTableDecorator::m_glGetProgramStageiv_capture;
+this->m_orig_glGetMaterialxOES = this->m_ptr_glGetMaterialxOES;
+if(this->m_ptr_glGetMaterialxOES)this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&CaptureTableDecorator::m_glGetMaterialxOES_capture;
+this->m_orig_glPopMatrix = this->m_ptr_glPopMatrix;
+if(this->m_ptr_glPopMatrix)this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&CaptureTableDecorator::m_glPopMatrix_capture;
+this->m_orig_glGetVideoui64vNV = this->m_ptr_glGetVideoui64vNV;
+if(this->m_ptr_glGetVideoui64vNV)this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&CaptureTableDecorator::m_glGetVideoui64vNV_capture;
+this->m_orig_glTangent3bEXT = this->m_ptr_glTangent3bEXT;
+if(this->m_ptr_glTangent3bEXT)this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&CaptureTableDecorator::m_glTangent3bEXT_capture;
+this->m_orig_glGetGraphicsResetStatusARB = this->m_ptr_glGetGraphicsResetStatusARB;
+if(this->m_ptr_glGetGraphicsResetStatusARB)this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&CaptureTableDecorator::m_glGetGraphicsResetStatusARB_capture;
+this->m_orig_glUniform4i = this->m_ptr_glUniform4i;
+if(this->m_ptr_glUniform4i)this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&CaptureTableDecorator::m_glUniform4i_capture;
+this->m_orig_glActiveTexture = this->m_ptr_glActiveTexture;
+if(this->m_ptr_glActiveTexture)this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&CaptureTableDecorator::m_glActiveTexture_capture;
+this->m_orig_glEnableVertexAttribArray = this->m_ptr_glEnableVertexAttribArray;
+if(this->m_ptr_glEnableVertexAttribArray)this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&CaptureTableDecorator::m_glEnableVertexAttribArray_capture;
+this->m_orig_glTexCoord4fVertex4fvSUN = this->m_ptr_glTexCoord4fVertex4fvSUN;
+if(this->m_ptr_glTexCoord4fVertex4fvSUN)this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&CaptureTableDecorator::m_glTexCoord4fVertex4fvSUN_capture;
+this->m_orig_glUniform4d = this->m_ptr_glUniform4d;
+if(this->m_ptr_glUniform4d)this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&CaptureTableDecorator::m_glUniform4d_capture;
+this->m_orig_glUniform4f = this->m_ptr_glUniform4f;
+if(this->m_ptr_glUniform4f)this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&CaptureTableDecorator::m_glUniform4f_capture;
+this->m_orig_glRenderbufferStorageMultisample = this->m_ptr_glRenderbufferStorageMultisample;
+if(this->m_ptr_glRenderbufferStorageMultisample)this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&CaptureTableDecorator::m_glRenderbufferStorageMultisample_capture;
+this->m_orig_glCreateProgramPipelines = this->m_ptr_glCreateProgramPipelines;
+if(this->m_ptr_glCreateProgramPipelines)this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&CaptureTableDecorator::m_glCreateProgramPipelines_capture;
+this->m_orig_glVertexAttribLPointer = this->m_ptr_glVertexAttribLPointer;
+if(this->m_ptr_glVertexAttribLPointer)this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&CaptureTableDecorator::m_glVertexAttribLPointer_capture;
+this->m_orig_glUniform2uiEXT = this->m_ptr_glUniform2uiEXT;
+if(this->m_ptr_glUniform2uiEXT)this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&CaptureTableDecorator::m_glUniform2uiEXT_capture;
+this->m_orig_glMultiTexCoord3sv = this->m_ptr_glMultiTexCoord3sv;
+if(this->m_ptr_glMultiTexCoord3sv)this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&CaptureTableDecorator::m_glMultiTexCoord3sv_capture;
+this->m_orig_glDrawElementsInstancedBaseVertex = this->m_ptr_glDrawElementsInstancedBaseVertex;
+if(this->m_ptr_glDrawElementsInstancedBaseVertex)this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&CaptureTableDecorator::m_glDrawElementsInstancedBaseVertex_capture;
+this->m_orig_glPixelTransformParameterfvEXT = this->m_ptr_glPixelTransformParameterfvEXT;
+if(this->m_ptr_glPixelTransformParameterfvEXT)this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glPixelTransformParameterfvEXT_capture;
+this->m_orig_glDrawTransformFeedbackNV = this->m_ptr_glDrawTransformFeedbackNV;
+if(this->m_ptr_glDrawTransformFeedbackNV)this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glDrawTransformFeedbackNV_capture;
+this->m_orig_glTextureImage2DMultisampleCoverageNV = this->m_ptr_glTextureImage2DMultisampleCoverageNV;
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV)this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&CaptureTableDecorator::m_glTextureImage2DMultisampleCoverageNV_capture;
+this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&CaptureTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_capture;
+this->m_orig_glIsTexture = this->m_ptr_glIsTexture;
+if(this->m_ptr_glIsTexture)this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&CaptureTableDecorator::m_glIsTexture_capture;
+this->m_orig_glMultiTexCoord4iv = this->m_ptr_glMultiTexCoord4iv;
+if(this->m_ptr_glMultiTexCoord4iv)this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&CaptureTableDecorator::m_glMultiTexCoord4iv_capture;
+this->m_orig_glTexEnvfv = this->m_ptr_glTexEnvfv;
+if(this->m_ptr_glTexEnvfv)this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&CaptureTableDecorator::m_glTexEnvfv_capture;
+this->m_orig_glPopDebugGroup = this->m_ptr_glPopDebugGroup;
+if(this->m_ptr_glPopDebugGroup)this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&CaptureTableDecorator::m_glPopDebugGroup_capture;
+this->m_orig_glUniformBlockBinding = this->m_ptr_glUniformBlockBinding;
+if(this->m_ptr_glUniformBlockBinding)this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&CaptureTableDecorator::m_glUniformBlockBinding_capture;
+this->m_orig_glWindowPos2svMESA = this->m_ptr_glWindowPos2svMESA;
+if(this->m_ptr_glWindowPos2svMESA)this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&CaptureTableDecorator::m_glWindowPos2svMESA_capture;
+this->m_orig_glGenerateTextureMipmapEXT = this->m_ptr_glGenerateTextureMipmapEXT;
+if(this->m_ptr_glGenerateTextureMipmapEXT)this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&CaptureTableDecorator::m_glGenerateTextureMipmapEXT_capture;
+this->m_orig_glBindLightParameterEXT = this->m_ptr_glBindLightParameterEXT;
+if(this->m_ptr_glBindLightParameterEXT)this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&CaptureTableDecorator::m_glBindLightParameterEXT_capture;
+this->m_orig_glTexCoord3bOES = this->m_ptr_glTexCoord3bOES;
+if(this->m_ptr_glTexCoord3bOES)this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&CaptureTableDecorator::m_glTexCoord3bOES_capture;
+this->m_orig_glTexCoordPointer = this->m_ptr_glTexCoordPointer;
+if(this->m_ptr_glTexCoordPointer)this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&CaptureTableDecorator::m_glTexCoordPointer_capture;
+this->m_orig_glProgramUniformMatrix3x2fv = this->m_ptr_glProgramUniformMatrix3x2fv;
+if(this->m_ptr_glProgramUniformMatrix3x2fv)this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix3x2fv_capture;
+this->m_orig_glUniform2fvARB = this->m_ptr_glUniform2fvARB;
+if(this->m_ptr_glUniform2fvARB)this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&CaptureTableDecorator::m_glUniform2fvARB_capture;
+this->m_orig_glProgramLocalParameterI4uivNV = this->m_ptr_glProgramLocalParameterI4uivNV;
+if(this->m_ptr_glProgramLocalParameterI4uivNV)this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&CaptureTableDecorator::m_glProgramLocalParameterI4uivNV_capture;
+this->m_orig_glFlushVertexArrayRangeNV = this->m_ptr_glFlushVertexArrayRangeNV;
+if(this->m_ptr_glFlushVertexArrayRangeNV)this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&CaptureTableDecorator::m_glFlushVertexArrayRangeNV_capture;
+this->m_orig_glSecondaryColor3svEXT = this->m_ptr_glSecondaryColor3svEXT;
+if(this->m_ptr_glSecondaryColor3svEXT)this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3svEXT_capture;
+this->m_orig_glGetBufferParameteriv = this->m_ptr_glGetBufferParameteriv;
+if(this->m_ptr_glGetBufferParameteriv)this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&CaptureTableDecorator::m_glGetBufferParameteriv_capture;
+this->m_orig_glGetQueryIndexediv = this->m_ptr_glGetQueryIndexediv;
+if(this->m_ptr_glGetQueryIndexediv)this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&CaptureTableDecorator::m_glGetQueryIndexediv_capture;
+this->m_orig_glFramebufferTexture3DEXT = this->m_ptr_glFramebufferTexture3DEXT;
+if(this->m_ptr_glFramebufferTexture3DEXT)this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&CaptureTableDecorator::m_glFramebufferTexture3DEXT_capture;
+this->m_orig_glLoadTransposeMatrixxOES = this->m_ptr_glLoadTransposeMatrixxOES;
+if(this->m_ptr_glLoadTransposeMatrixxOES)this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&CaptureTableDecorator::m_glLoadTransposeMatrixxOES_capture;
+this->m_orig_glDeleteTransformFeedbacksNV = this->m_ptr_glDeleteTransformFeedbacksNV;
+if(this->m_ptr_glDeleteTransformFeedbacksNV)this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&CaptureTableDecorator::m_glDeleteTransformFeedbacksNV_capture;
+this->m_orig_glGetCompressedTextureImageEXT = this->m_ptr_glGetCompressedTextureImageEXT;
+if(this->m_ptr_glGetCompressedTextureImageEXT)this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&CaptureTableDecorator::m_glGetCompressedTextureImageEXT_capture;
+this->m_orig_glIndexMaterialEXT = this->m_ptr_glIndexMaterialEXT;
+if(this->m_ptr_glIndexMaterialEXT)this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&CaptureTableDecorator::m_glIndexMaterialEXT_capture;
+this->m_orig_glFogCoorddEXT = this->m_ptr_glFogCoorddEXT;
+if(this->m_ptr_glFogCoorddEXT)this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&CaptureTableDecorator::m_glFogCoorddEXT_capture;
+this->m_orig_glTexCoord2hvNV = this->m_ptr_glTexCoord2hvNV;
+if(this->m_ptr_glTexCoord2hvNV)this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&CaptureTableDecorator::m_glTexCoord2hvNV_capture;
+this->m_orig_glGetFramebufferParameterfvAMD = this->m_ptr_glGetFramebufferParameterfvAMD;
+if(this->m_ptr_glGetFramebufferParameterfvAMD)this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&CaptureTableDecorator::m_glGetFramebufferParameterfvAMD_capture;
+this->m_orig_glTexEnviv = this->m_ptr_glTexEnviv;
+if(this->m_ptr_glTexEnviv)this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&CaptureTableDecorator::m_glTexEnviv_capture;
+this->m_orig_glEndTransformFeedbackNV = this->m_ptr_glEndTransformFeedbackNV;
+if(this->m_ptr_glEndTransformFeedbackNV)this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&CaptureTableDecorator::m_glEndTransformFeedbackNV_capture;
+this->m_orig_glGlobalAlphaFactoruiSUN = this->m_ptr_glGlobalAlphaFactoruiSUN;
+if(this->m_ptr_glGlobalAlphaFactoruiSUN)this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&CaptureTableDecorator::m_glGlobalAlphaFactoruiSUN_capture;
+this->m_orig_glSelectBuffer = this->m_ptr_glSelectBuffer;
+if(this->m_ptr_glSelectBuffer)this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&CaptureTableDecorator::m_glSelectBuffer_capture;
+this->m_orig_glNamedBufferSubDataEXT = this->m_ptr_glNamedBufferSubDataEXT;
+if(this->m_ptr_glNamedBufferSubDataEXT)this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&CaptureTableDecorator::m_glNamedBufferSubDataEXT_capture;
+this->m_orig_glDisableVertexArrayAttrib = this->m_ptr_glDisableVertexArrayAttrib;
+if(this->m_ptr_glDisableVertexArrayAttrib)this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&CaptureTableDecorator::m_glDisableVertexArrayAttrib_capture;
+this->m_orig_glBlendFunc = this->m_ptr_glBlendFunc;
+if(this->m_ptr_glBlendFunc)this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&CaptureTableDecorator::m_glBlendFunc_capture;
+this->m_orig_glCreateProgram = this->m_ptr_glCreateProgram;
+if(this->m_ptr_glCreateProgram)this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&CaptureTableDecorator::m_glCreateProgram_capture;
+this->m_orig_glVertexStream2dATI = this->m_ptr_glVertexStream2dATI;
+if(this->m_ptr_glVertexStream2dATI)this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&CaptureTableDecorator::m_glVertexStream2dATI_capture;
+this->m_orig_glUniform4ui64vARB = this->m_ptr_glUniform4ui64vARB;
+if(this->m_ptr_glUniform4ui64vARB)this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&CaptureTableDecorator::m_glUniform4ui64vARB_capture;
+this->m_orig_glGetSemaphoreParameterui64vEXT = this->m_ptr_glGetSemaphoreParameterui64vEXT;
+if(this->m_ptr_glGetSemaphoreParameterui64vEXT)this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&CaptureTableDecorator::m_glGetSemaphoreParameterui64vEXT_capture;
+this->m_orig_glPrimitiveRestartIndex = this->m_ptr_glPrimitiveRestartIndex;
+if(this->m_ptr_glPrimitiveRestartIndex)this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&CaptureTableDecorator::m_glPrimitiveRestartIndex_capture;
+this->m_orig_glNormalStream3fATI = this->m_ptr_glNormalStream3fATI;
+if(this->m_ptr_glNormalStream3fATI)this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&CaptureTableDecorator::m_glNormalStream3fATI_capture;
+this->m_orig_glProgramUniformMatrix2fv = this->m_ptr_glProgramUniformMatrix2fv;
+if(this->m_ptr_glProgramUniformMatrix2fv)this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix2fv_capture;
+this->m_orig_glVertexAttribs1hvNV = this->m_ptr_glVertexAttribs1hvNV;
+if(this->m_ptr_glVertexAttribs1hvNV)this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&CaptureTableDecorator::m_glVertexAttribs1hvNV_capture;
+this->m_orig_glWindowPos4svMESA = this->m_ptr_glWindowPos4svMESA;
+if(this->m_ptr_glWindowPos4svMESA)this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&CaptureTableDecorator::m_glWindowPos4svMESA_capture;
+this->m_orig_glDeleteFragmentShaderATI = this->m_ptr_glDeleteFragmentShaderATI;
+if(this->m_ptr_glDeleteFragmentShaderATI)this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&CaptureTableDecorator::m_glDeleteFragmentShaderATI_capture;
+this->m_orig_glBindImageTextures = this->m_ptr_glBindImageTextures;
+if(this->m_ptr_glBindImageTextures)this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&CaptureTableDecorator::m_glBindImageTextures_capture;
+this->m_orig_glMap2xOES = this->m_ptr_glMap2xOES;
+if(this->m_ptr_glMap2xOES)this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&CaptureTableDecorator::m_glMap2xOES_capture;
+this->m_orig_glEnd = this->m_ptr_glEnd;
+if(this->m_ptr_glEnd)this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&CaptureTableDecorator::m_glEnd_capture;
+this->m_orig_glMultiTexCoord2dARB = this->m_ptr_glMultiTexCoord2dARB;
+if(this->m_ptr_glMultiTexCoord2dARB)this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&CaptureTableDecorator::m_glMultiTexCoord2dARB_capture;
+this->m_orig_glUniform1i64NV = this->m_ptr_glUniform1i64NV;
+if(this->m_ptr_glUniform1i64NV)this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&CaptureTableDecorator::m_glUniform1i64NV_capture;
+this->m_orig_glPathStringNV = this->m_ptr_glPathStringNV;
+if(this->m_ptr_glPathStringNV)this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&CaptureTableDecorator::m_glPathStringNV_capture;
+this->m_orig_glGetNamedFramebufferParameterivEXT = this->m_ptr_glGetNamedFramebufferParameterivEXT;
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT)this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&CaptureTableDecorator::m_glGetNamedFramebufferParameterivEXT_capture;
+this->m_orig_glGetProgramNamedParameterdvNV = this->m_ptr_glGetProgramNamedParameterdvNV;
+if(this->m_ptr_glGetProgramNamedParameterdvNV)this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&CaptureTableDecorator::m_glGetProgramNamedParameterdvNV_capture;
+this->m_orig_glPathDashArrayNV = this->m_ptr_glPathDashArrayNV;
+if(this->m_ptr_glPathDashArrayNV)this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&CaptureTableDecorator::m_glPathDashArrayNV_capture;
+this->m_orig_glUniform3uiv = this->m_ptr_glUniform3uiv;
+if(this->m_ptr_glUniform3uiv)this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&CaptureTableDecorator::m_glUniform3uiv_capture;
+this->m_orig_glColor3fVertex3fvSUN = this->m_ptr_glColor3fVertex3fvSUN;
+if(this->m_ptr_glColor3fVertex3fvSUN)this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&CaptureTableDecorator::m_glColor3fVertex3fvSUN_capture;
+this->m_orig_glMultTransposeMatrixd = this->m_ptr_glMultTransposeMatrixd;
+if(this->m_ptr_glMultTransposeMatrixd)this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&CaptureTableDecorator::m_glMultTransposeMatrixd_capture;
+this->m_orig_glClearColor = this->m_ptr_glClearColor;
+if(this->m_ptr_glClearColor)this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&CaptureTableDecorator::m_glClearColor_capture;
+this->m_orig_glGetImageHandleARB = this->m_ptr_glGetImageHandleARB;
+if(this->m_ptr_glGetImageHandleARB)this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&CaptureTableDecorator::m_glGetImageHandleARB_capture;
+this->m_orig_glTangent3dEXT = this->m_ptr_glTangent3dEXT;
+if(this->m_ptr_glTangent3dEXT)this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&CaptureTableDecorator::m_glTangent3dEXT_capture;
+this->m_orig_glGetQueryObjectivARB = this->m_ptr_glGetQueryObjectivARB;
+if(this->m_ptr_glGetQueryObjectivARB)this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&CaptureTableDecorator::m_glGetQueryObjectivARB_capture;
+this->m_orig_glGetLocalConstantFloatvEXT = this->m_ptr_glGetLocalConstantFloatvEXT;
+if(this->m_ptr_glGetLocalConstantFloatvEXT)this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&CaptureTableDecorator::m_glGetLocalConstantFloatvEXT_capture;
+this->m_orig_glUseShaderProgramEXT = this->m_ptr_glUseShaderProgramEXT;
+if(this->m_ptr_glUseShaderProgramEXT)this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&CaptureTableDecorator::m_glUseShaderProgramEXT_capture;
+this->m_orig_glBindRenderbufferEXT = this->m_ptr_glBindRenderbufferEXT;
+if(this->m_ptr_glBindRenderbufferEXT)this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&CaptureTableDecorator::m_glBindRenderbufferEXT_capture;
+this->m_orig_glInterleavedArrays = this->m_ptr_glInterleavedArrays;
+if(this->m_ptr_glInterleavedArrays)this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&CaptureTableDecorator::m_glInterleavedArrays_capture;
+this->m_orig_glGetPerfMonitorGroupStringAMD = this->m_ptr_glGetPerfMonitorGroupStringAMD;
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD)this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&CaptureTableDecorator::m_glGetPerfMonitorGroupStringAMD_capture;
+this->m_orig_glUniform3ui = this->m_ptr_glUniform3ui;
+if(this->m_ptr_glUniform3ui)this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&CaptureTableDecorator::m_glUniform3ui_capture;
+this->m_orig_glGetNamedProgramLocalParameterdvEXT = this->m_ptr_glGetNamedProgramLocalParameterdvEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT)this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&CaptureTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_capture;
+this->m_orig_glDeleteQueryResourceTagNV = this->m_ptr_glDeleteQueryResourceTagNV;
+if(this->m_ptr_glDeleteQueryResourceTagNV)this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&CaptureTableDecorator::m_glDeleteQueryResourceTagNV_capture;
+this->m_orig_glVertexAttribI4uiv = this->m_ptr_glVertexAttribI4uiv;
+if(this->m_ptr_glVertexAttribI4uiv)this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&CaptureTableDecorator::m_glVertexAttribI4uiv_capture;
+this->m_orig_glVertexAttrib4bv = this->m_ptr_glVertexAttrib4bv;
+if(this->m_ptr_glVertexAttrib4bv)this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&CaptureTableDecorator::m_glVertexAttrib4bv_capture;
+this->m_orig_glMultiTexCoord3xOES = this->m_ptr_glMultiTexCoord3xOES;
+if(this->m_ptr_glMultiTexCoord3xOES)this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&CaptureTableDecorator::m_glMultiTexCoord3xOES_capture;
+this->m_orig_glSecondaryColor3ub = this->m_ptr_glSecondaryColor3ub;
+if(this->m_ptr_glSecondaryColor3ub)this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&CaptureTableDecorator::m_glSecondaryColor3ub_capture;
+this->m_orig_glFragmentMaterialfSGIX = this->m_ptr_glFragmentMaterialfSGIX;
+if(this->m_ptr_glFragmentMaterialfSGIX)this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&CaptureTableDecorator::m_glFragmentMaterialfSGIX_capture;
+this->m_orig_glGetVariantArrayObjectivATI = this->m_ptr_glGetVariantArrayObjectivATI;
+if(this->m_ptr_glGetVariantArrayObjectivATI)this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&CaptureTableDecorator::m_glGetVariantArrayObjectivATI_capture;
+this->m_orig_glSecondaryColor3ui = this->m_ptr_glSecondaryColor3ui;
+if(this->m_ptr_glSecondaryColor3ui)this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&CaptureTableDecorator::m_glSecondaryColor3ui_capture;
+this->m_orig_glVertexAttrib1dARB = this->m_ptr_glVertexAttrib1dARB;
+if(this->m_ptr_glVertexAttrib1dARB)this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&CaptureTableDecorator::m_glVertexAttrib1dARB_capture;
+this->m_orig_glGetNamedBufferPointerv = this->m_ptr_glGetNamedBufferPointerv;
+if(this->m_ptr_glGetNamedBufferPointerv)this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&CaptureTableDecorator::m_glGetNamedBufferPointerv_capture;
+this->m_orig_glLockArraysEXT = this->m_ptr_glLockArraysEXT;
+if(this->m_ptr_glLockArraysEXT)this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&CaptureTableDecorator::m_glLockArraysEXT_capture;
+this->m_orig_glVertexAttribPointerNV = this->m_ptr_glVertexAttribPointerNV;
+if(this->m_ptr_glVertexAttribPointerNV)this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&CaptureTableDecorator::m_glVertexAttribPointerNV_capture;
+this->m_orig_glConvolutionParameterf = this->m_ptr_glConvolutionParameterf;
+if(this->m_ptr_glConvolutionParameterf)this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&CaptureTableDecorator::m_glConvolutionParameterf_capture;
+this->m_orig_glBindBufferBaseEXT = this->m_ptr_glBindBufferBaseEXT;
+if(this->m_ptr_glBindBufferBaseEXT)this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&CaptureTableDecorator::m_glBindBufferBaseEXT_capture;
+this->m_orig_glTexCoord2xvOES = this->m_ptr_glTexCoord2xvOES;
+if(this->m_ptr_glTexCoord2xvOES)this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&CaptureTableDecorator::m_glTexCoord2xvOES_capture;
+this->m_orig_glGetQueryBufferObjectui64v = this->m_ptr_glGetQueryBufferObjectui64v;
+if(this->m_ptr_glGetQueryBufferObjectui64v)this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&CaptureTableDecorator::m_glGetQueryBufferObjectui64v_capture;
+this->m_orig_glSetMultisamplefvAMD = this->m_ptr_glSetMultisamplefvAMD;
+if(this->m_ptr_glSetMultisamplefvAMD)this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&CaptureTableDecorator::m_glSetMultisamplefvAMD_capture;
+this->m_orig_glPathColorGenNV = this->m_ptr_glPathColorGenNV;
+if(this->m_ptr_glPathColorGenNV)this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&CaptureTableDecorator::m_glPathColorGenNV_capture;
+this->m_orig_glVertexAttrib3sARB = this->m_ptr_glVertexAttrib3sARB;
+if(this->m_ptr_glVertexAttrib3sARB)this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&CaptureTableDecorator::m_glVertexAttrib3sARB_capture;
+this->m_orig_glVertexAttrib4ivARB = this->m_ptr_glVertexAttrib4ivARB;
+if(this->m_ptr_glVertexAttrib4ivARB)this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&CaptureTableDecorator::m_glVertexAttrib4ivARB_capture;
+this->m_orig_glGenTransformFeedbacks = this->m_ptr_glGenTransformFeedbacks;
+if(this->m_ptr_glGenTransformFeedbacks)this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&CaptureTableDecorator::m_glGenTransformFeedbacks_capture;
+this->m_orig_glGetVertexAttribIuiv = this->m_ptr_glGetVertexAttribIuiv;
+if(this->m_ptr_glGetVertexAttribIuiv)this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&CaptureTableDecorator::m_glGetVertexAttribIuiv_capture;
+this->m_orig_glPixelTransformParameterfEXT = this->m_ptr_glPixelTransformParameterfEXT;
+if(this->m_ptr_glPixelTransformParameterfEXT)this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&CaptureTableDecorator::m_glPixelTransformParameterfEXT_capture;
+this->m_orig_glGetTexParameterIuivEXT = this->m_ptr_glGetTexParameterIuivEXT;
+if(this->m_ptr_glGetTexParameterIuivEXT)this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&CaptureTableDecorator::m_glGetTexParameterIuivEXT_capture;
+this->m_orig_glGetObjectParameterivARB = this->m_ptr_glGetObjectParameterivARB;
+if(this->m_ptr_glGetObjectParameterivARB)this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&CaptureTableDecorator::m_glGetObjectParameterivARB_capture;
+this->m_orig_glVertexArraySecondaryColorOffsetEXT = this->m_ptr_glVertexArraySecondaryColorOffsetEXT;
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT)this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&CaptureTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_capture;
+this->m_orig_glWindowPos2fARB = this->m_ptr_glWindowPos2fARB;
+if(this->m_ptr_glWindowPos2fARB)this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&CaptureTableDecorator::m_glWindowPos2fARB_capture;
+this->m_orig_glCompressedTexSubImage2D = this->m_ptr_glCompressedTexSubImage2D;
+if(this->m_ptr_glCompressedTexSubImage2D)this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&CaptureTableDecorator::m_glCompressedTexSubImage2D_capture;
+this->m_orig_glCompressedTexSubImage3DARB = this->m_ptr_glCompressedTexSubImage3DARB;
+if(this->m_ptr_glCompressedTexSubImage3DARB)this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&CaptureTableDecorator::m_glCompressedTexSubImage3DARB_capture;
+this->m_orig_glProgramBinary = this->m_ptr_glProgramBinary;
+if(this->m_ptr_glProgramBinary)this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&CaptureTableDecorator::m_glProgramBinary_capture;
+this->m_orig_glPresentFrameKeyedNV = this->m_ptr_glPresentFrameKeyedNV;
+if(this->m_ptr_glPresentFrameKeyedNV)this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&CaptureTableDecorator::m_glPresentFrameKeyedNV_capture;
+this->m_orig_glVertexAttribI4bv = this->m_ptr_glVertexAttribI4bv;
+if(this->m_ptr_glVertexAttribI4bv)this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&CaptureTableDecorator::m_glVertexAttribI4bv_capture;
+this->m_orig_glPathCoverDepthFuncNV = this->m_ptr_glPathCoverDepthFuncNV;
+if(this->m_ptr_glPathCoverDepthFuncNV)this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&CaptureTableDecorator::m_glPathCoverDepthFuncNV_capture;
+this->m_orig_glTransformFeedbackStreamAttribsNV = this->m_ptr_glTransformFeedbackStreamAttribsNV;
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV)this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&CaptureTableDecorator::m_glTransformFeedbackStreamAttribsNV_capture;
+this->m_orig_glSecondaryColor3usEXT = this->m_ptr_glSecondaryColor3usEXT;
+if(this->m_ptr_glSecondaryColor3usEXT)this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3usEXT_capture;
+this->m_orig_glCopyColorTableSGI = this->m_ptr_glCopyColorTableSGI;
+if(this->m_ptr_glCopyColorTableSGI)this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&CaptureTableDecorator::m_glCopyColorTableSGI_capture;
+this->m_orig_glProgramEnvParameter4fvARB = this->m_ptr_glProgramEnvParameter4fvARB;
+if(this->m_ptr_glProgramEnvParameter4fvARB)this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&CaptureTableDecorator::m_glProgramEnvParameter4fvARB_capture;
+this->m_orig_glMultiTexCoord4sARB = this->m_ptr_glMultiTexCoord4sARB;
+if(this->m_ptr_glMultiTexCoord4sARB)this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&CaptureTableDecorator::m_glMultiTexCoord4sARB_capture;
+this->m_orig_glGetVertexArrayIndexed64iv = this->m_ptr_glGetVertexArrayIndexed64iv;
+if(this->m_ptr_glGetVertexArrayIndexed64iv)this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&CaptureTableDecorator::m_glGetVertexArrayIndexed64iv_capture;
+this->m_orig_glMatrixMultTranspose3x3fNV = this->m_ptr_glMatrixMultTranspose3x3fNV;
+if(this->m_ptr_glMatrixMultTranspose3x3fNV)this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&CaptureTableDecorator::m_glMatrixMultTranspose3x3fNV_capture;
+this->m_orig_glTexParameterIiv = this->m_ptr_glTexParameterIiv;
+if(this->m_ptr_glTexParameterIiv)this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&CaptureTableDecorator::m_glTexParameterIiv_capture;
+this->m_orig_glVertexArrayAttribFormat = this->m_ptr_glVertexArrayAttribFormat;
+if(this->m_ptr_glVertexArrayAttribFormat)this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&CaptureTableDecorator::m_glVertexArrayAttribFormat_capture;
+this->m_orig_glEndTransformFeedback = this->m_ptr_glEndTransformFeedback;
+if(this->m_ptr_glEndTransformFeedback)this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&CaptureTableDecorator::m_glEndTransformFeedback_capture;
+this->m_orig_glDrawCommandsStatesAddressNV = this->m_ptr_glDrawCommandsStatesAddressNV;
+if(this->m_ptr_glDrawCommandsStatesAddressNV)this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&CaptureTableDecorator::m_glDrawCommandsStatesAddressNV_capture;
+this->m_orig_glUniform4ui64NV = this->m_ptr_glUniform4ui64NV;
+if(this->m_ptr_glUniform4ui64NV)this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&CaptureTableDecorator::m_glUniform4ui64NV_capture;
+this->m_orig_glMaterialiv = this->m_ptr_glMaterialiv;
+if(this->m_ptr_glMaterialiv)this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&CaptureTableDecorator::m_glMaterialiv_capture;
+this->m_orig_glTexImage2DMultisample = this->m_ptr_glTexImage2DMultisample;
+if(this->m_ptr_glTexImage2DMultisample)this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTexImage2DMultisample_capture;
+this->m_orig_glBindTextureEXT = this->m_ptr_glBindTextureEXT;
+if(this->m_ptr_glBindTextureEXT)this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&CaptureTableDecorator::m_glBindTextureEXT_capture;
+this->m_orig_glIsBuffer = this->m_ptr_glIsBuffer;
+if(this->m_ptr_glIsBuffer)this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&CaptureTableDecorator::m_glIsBuffer_capture;
+this->m_orig_glVertexAttribI1iv = this->m_ptr_glVertexAttribI1iv;
+if(this->m_ptr_glVertexAttribI1iv)this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&CaptureTableDecorator::m_glVertexAttribI1iv_capture;
+this->m_orig_glGetFinalCombinerInputParameterfvNV = this->m_ptr_glGetFinalCombinerInputParameterfvNV;
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV)this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&CaptureTableDecorator::m_glGetFinalCombinerInputParameterfvNV_capture;
+this->m_orig_glMultiTexCoord3bvOES = this->m_ptr_glMultiTexCoord3bvOES;
+if(this->m_ptr_glMultiTexCoord3bvOES)this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&CaptureTableDecorator::m_glMultiTexCoord3bvOES_capture;
+this->m_orig_glVertexAttribDivisor = this->m_ptr_glVertexAttribDivisor;
+if(this->m_ptr_glVertexAttribDivisor)this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&CaptureTableDecorator::m_glVertexAttribDivisor_capture;
+this->m_orig_glCopyBufferSubData = this->m_ptr_glCopyBufferSubData;
+if(this->m_ptr_glCopyBufferSubData)this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&CaptureTableDecorator::m_glCopyBufferSubData_capture;
+this->m_orig_glBindTexGenParameterEXT = this->m_ptr_glBindTexGenParameterEXT;
+if(this->m_ptr_glBindTexGenParameterEXT)this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&CaptureTableDecorator::m_glBindTexGenParameterEXT_capture;
+this->m_orig_glNormalStream3bATI = this->m_ptr_glNormalStream3bATI;
+if(this->m_ptr_glNormalStream3bATI)this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&CaptureTableDecorator::m_glNormalStream3bATI_capture;
+this->m_orig_glTexStorageMem2DEXT = this->m_ptr_glTexStorageMem2DEXT;
+if(this->m_ptr_glTexStorageMem2DEXT)this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&CaptureTableDecorator::m_glTexStorageMem2DEXT_capture;
+this->m_orig_glTextureImage2DEXT = this->m_ptr_glTextureImage2DEXT;
+if(this->m_ptr_glTextureImage2DEXT)this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&CaptureTableDecorator::m_glTextureImage2DEXT_capture;
+this->m_orig_glGetColorTableParameteriv = this->m_ptr_glGetColorTableParameteriv;
+if(this->m_ptr_glGetColorTableParameteriv)this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&CaptureTableDecorator::m_glGetColorTableParameteriv_capture;
+this->m_orig_glActiveTextureARB = this->m_ptr_glActiveTextureARB;
+if(this->m_ptr_glActiveTextureARB)this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&CaptureTableDecorator::m_glActiveTextureARB_capture;
+this->m_orig_glTexCoord4xOES = this->m_ptr_glTexCoord4xOES;
+if(this->m_ptr_glTexCoord4xOES)this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&CaptureTableDecorator::m_glTexCoord4xOES_capture;
+this->m_orig_glNamedBufferStorageExternalEXT = this->m_ptr_glNamedBufferStorageExternalEXT;
+if(this->m_ptr_glNamedBufferStorageExternalEXT)this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&CaptureTableDecorator::m_glNamedBufferStorageExternalEXT_capture;
+this->m_orig_glSecondaryColor3fvEXT = this->m_ptr_glSecondaryColor3fvEXT;
+if(this->m_ptr_glSecondaryColor3fvEXT)this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&CaptureTableDecorator::m_glSecondaryColor3fvEXT_capture;
+this->m_orig_glUniformMatrix4x2fv = this->m_ptr_glUniformMatrix4x2fv;
+if(this->m_ptr_glUniformMatrix4x2fv)this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&CaptureTableDecorator::m_glUniformMatrix4x2fv_capture;
+this->m_orig_glStartInstrumentsSGIX = this->m_ptr_glStartInstrumentsSGIX;
+if(this->m_ptr_glStartInstrumentsSGIX)this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&CaptureTableDecorator::m_glStartInstrumentsSGIX_capture;
+this->m_orig_glProgramNamedParameter4fvNV = this->m_ptr_glProgramNamedParameter4fvNV;
+if(this->m_ptr_glProgramNamedParameter4fvNV)this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&CaptureTableDecorator::m_glProgramNamedParameter4fvNV_capture;
+this->m_orig_glEndVideoCaptureNV = this->m_ptr_glEndVideoCaptureNV;
+if(this->m_ptr_glEndVideoCaptureNV)this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&CaptureTableDecorator::m_glEndVideoCaptureNV_capture;
+this->m_orig_glGenLists = this->m_ptr_glGenLists;
+if(this->m_ptr_glGenLists)this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&CaptureTableDecorator::m_glGenLists_capture;
+this->m_orig_glUniform1fARB = this->m_ptr_glUniform1fARB;
+if(this->m_ptr_glUniform1fARB)this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&CaptureTableDecorator::m_glUniform1fARB_capture;
+this->m_orig_glNamedFramebufferTexture1DEXT = this->m_ptr_glNamedFramebufferTexture1DEXT;
+if(this->m_ptr_glNamedFramebufferTexture1DEXT)this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&CaptureTableDecorator::m_glNamedFramebufferTexture1DEXT_capture;
+this->m_orig_glMapBufferRange = this->m_ptr_glMapBufferRange;
+if(this->m_ptr_glMapBufferRange)this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&CaptureTableDecorator::m_glMapBufferRange_capture;
+this->m_orig_glMultiDrawElementsIndirectCountARB = this->m_ptr_glMultiDrawElementsIndirectCountARB;
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB)this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&CaptureTableDecorator::m_glMultiDrawElementsIndirectCountARB_capture;
+this->m_orig_glProgramUniformMatrix4x2fv = this->m_ptr_glProgramUniformMatrix4x2fv;
+if(this->m_ptr_glProgramUniformMatrix4x2fv)this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&CaptureTableDecorator::m_glProgramUniformMatrix4x2fv_capture;
+this->m_orig_glGetTextureParameterIivEXT = this->m_ptr_glGetTextureParameterIivEXT;
+if(this->m_ptr_glGetTextureParameterIivEXT)this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glGetTextureParameterIivEXT_capture;
+this->m_orig_glMultiTexCoord3hNV = this->m_ptr_glMultiTexCoord3hNV;
+if(this->m_ptr_glMultiTexCoord3hNV)this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&CaptureTableDecorator::m_glMultiTexCoord3hNV_capture;
+this->m_orig_glNamedProgramLocalParametersI4uivEXT = this->m_ptr_glNamedProgramLocalParametersI4uivEXT;
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT)this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_capture;
+this->m_orig_glEndList = this->m_ptr_glEndList;
+if(this->m_ptr_glEndList)this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&CaptureTableDecorator::m_glEndList_capture;
+this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&CaptureTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_capture;
+this->m_orig_glGenTransformFeedbacksNV = this->m_ptr_glGenTransformFeedbacksNV;
+if(this->m_ptr_glGenTransformFeedbacksNV)this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&CaptureTableDecorator::m_glGenTransformFeedbacksNV_capture;
+this->m_orig_glEdgeFlagv = this->m_ptr_glEdgeFlagv;
+if(this->m_ptr_glEdgeFlagv)this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&CaptureTableDecorator::m_glEdgeFlagv_capture;
+this->m_orig_glVertexAttribI2iv = this->m_ptr_glVertexAttribI2iv;
+if(this->m_ptr_glVertexAttribI2iv)this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&CaptureTableDecorator::m_glVertexAttribI2iv_capture;
+this->m_orig_glCopyMultiTexImage2DEXT = this->m_ptr_glCopyMultiTexImage2DEXT;
+if(this->m_ptr_glCopyMultiTexImage2DEXT)this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCopyMultiTexImage2DEXT_capture;
+this->m_orig_glUniformMatrix3x2dv = this->m_ptr_glUniformMatrix3x2dv;
+if(this->m_ptr_glUniformMatrix3x2dv)this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&CaptureTableDecorator::m_glUniformMatrix3x2dv_capture;
+this->m_orig_glTexImage3DMultisampleCoverageNV = this->m_ptr_glTexImage3DMultisampleCoverageNV;
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV)this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&CaptureTableDecorator::m_glTexImage3DMultisampleCoverageNV_capture;
+this->m_orig_glGetShaderPrecisionFormat = this->m_ptr_glGetShaderPrecisionFormat;
+if(this->m_ptr_glGetShaderPrecisionFormat)this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&CaptureTableDecorator::m_glGetShaderPrecisionFormat_capture;
+this->m_orig_glTexSubImage4DSGIS = this->m_ptr_glTexSubImage4DSGIS;
+if(this->m_ptr_glTexSubImage4DSGIS)this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&CaptureTableDecorator::m_glTexSubImage4DSGIS_capture;
+this->m_orig_glRasterSamplesEXT = this->m_ptr_glRasterSamplesEXT;
+if(this->m_ptr_glRasterSamplesEXT)this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&CaptureTableDecorator::m_glRasterSamplesEXT_capture;
+this->m_orig_glTextureView = this->m_ptr_glTextureView;
+if(this->m_ptr_glTextureView)this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&CaptureTableDecorator::m_glTextureView_capture;
+this->m_orig_glEvalMapsNV = this->m_ptr_glEvalMapsNV;
+if(this->m_ptr_glEvalMapsNV)this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&CaptureTableDecorator::m_glEvalMapsNV_capture;
+this->m_orig_glGetFragDataLocationEXT = this->m_ptr_glGetFragDataLocationEXT;
+if(this->m_ptr_glGetFragDataLocationEXT)this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&CaptureTableDecorator::m_glGetFragDataLocationEXT_capture;
+this->m_orig_glGetCompressedMultiTexImageEXT = this->m_ptr_glGetCompressedMultiTexImageEXT;
+if(this->m_ptr_glGetCompressedMultiTexImageEXT)this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&CaptureTableDecorator::m_glGetCompressedMultiTexImageEXT_capture;
+this->m_orig_glIndexMask = this->m_ptr_glIndexMask;
+if(this->m_ptr_glIndexMask)this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&CaptureTableDecorator::m_glIndexMask_capture;
+this->m_orig_glPushClientAttrib = this->m_ptr_glPushClientAttrib;
+if(this->m_ptr_glPushClientAttrib)this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&CaptureTableDecorator::m_glPushClientAttrib_capture;
+this->m_orig_glShaderSource = this->m_ptr_glShaderSource;
+if(this->m_ptr_glShaderSource)this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&CaptureTableDecorator::m_glShaderSource_capture;
+this->m_orig_glDispatchComputeGroupSizeARB = this->m_ptr_glDispatchComputeGroupSizeARB;
+if(this->m_ptr_glDispatchComputeGroupSizeARB)this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&CaptureTableDecorator::m_glDispatchComputeGroupSizeARB_capture;
+this->m_orig_glLGPUNamedBufferSubDataNVX = this->m_ptr_glLGPUNamedBufferSubDataNVX;
+if(this->m_ptr_glLGPUNamedBufferSubDataNVX)this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&CaptureTableDecorator::m_glLGPUNamedBufferSubDataNVX_capture;
+this->m_orig_glGetnPixelMapfv = this->m_ptr_glGetnPixelMapfv;
+if(this->m_ptr_glGetnPixelMapfv)this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&CaptureTableDecorator::m_glGetnPixelMapfv_capture;
+this->m_orig_glTexCoordP2uiv = this->m_ptr_glTexCoordP2uiv;
+if(this->m_ptr_glTexCoordP2uiv)this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&CaptureTableDecorator::m_glTexCoordP2uiv_capture;
+this->m_orig_glUniform2f = this->m_ptr_glUniform2f;
+if(this->m_ptr_glUniform2f)this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&CaptureTableDecorator::m_glUniform2f_capture;
+this->m_orig_glGetNamedBufferParameteri64v = this->m_ptr_glGetNamedBufferParameteri64v;
+if(this->m_ptr_glGetNamedBufferParameteri64v)this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&CaptureTableDecorator::m_glGetNamedBufferParameteri64v_capture;
+this->m_orig_glCommandListSegmentsNV = this->m_ptr_glCommandListSegmentsNV;
+if(this->m_ptr_glCommandListSegmentsNV)this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&CaptureTableDecorator::m_glCommandListSegmentsNV_capture;
+this->m_orig_glTextureParameterIivEXT = this->m_ptr_glTextureParameterIivEXT;
+if(this->m_ptr_glTextureParameterIivEXT)this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&CaptureTableDecorator::m_glTextureParameterIivEXT_capture;
+this->m_orig_glMultiTexParameterfvEXT = this->m_ptr_glMultiTexParameterfvEXT;
+if(this->m_ptr_glMultiTexParameterfvEXT)this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glMultiTexParameterfvEXT_capture;
+this->m_orig_glProgramUniform2ui64ARB = this->m_ptr_glProgramUniform2ui64ARB;
+if(this->m_ptr_glProgramUniform2ui64ARB)this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&CaptureTableDecorator::m_glProgramUniform2ui64ARB_capture;
+this->m_orig_glVertex4d = this->m_ptr_glVertex4d;
+if(this->m_ptr_glVertex4d)this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&CaptureTableDecorator::m_glVertex4d_capture;
+this->m_orig_glNewObjectBufferATI = this->m_ptr_glNewObjectBufferATI;
+if(this->m_ptr_glNewObjectBufferATI)this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glNewObjectBufferATI_capture;
+this->m_orig_glViewportSwizzleNV = this->m_ptr_glViewportSwizzleNV;
+if(this->m_ptr_glViewportSwizzleNV)this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&CaptureTableDecorator::m_glViewportSwizzleNV_capture;
+this->m_orig_glBufferData = this->m_ptr_glBufferData;
+if(this->m_ptr_glBufferData)this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&CaptureTableDecorator::m_glBufferData_capture;
+this->m_orig_glTextureImage1DEXT = this->m_ptr_glTextureImage1DEXT;
+if(this->m_ptr_glTextureImage1DEXT)this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&CaptureTableDecorator::m_glTextureImage1DEXT_capture;
+this->m_orig_glGetTexParameterIiv = this->m_ptr_glGetTexParameterIiv;
+if(this->m_ptr_glGetTexParameterIiv)this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&CaptureTableDecorator::m_glGetTexParameterIiv_capture;
+this->m_orig_glCopyTexSubImage1DEXT = this->m_ptr_glCopyTexSubImage1DEXT;
+if(this->m_ptr_glCopyTexSubImage1DEXT)this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&CaptureTableDecorator::m_glCopyTexSubImage1DEXT_capture;
+this->m_orig_glVertex4f = this->m_ptr_glVertex4f;
+if(this->m_ptr_glVertex4f)this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&CaptureTableDecorator::m_glVertex4f_capture;
+this->m_orig_glUniformMatrix3fvARB = this->m_ptr_glUniformMatrix3fvARB;
+if(this->m_ptr_glUniformMatrix3fvARB)this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&CaptureTableDecorator::m_glUniformMatrix3fvARB_capture;
+this->m_orig_glTexCoordP1ui = this->m_ptr_glTexCoordP1ui;
+if(this->m_ptr_glTexCoordP1ui)this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&CaptureTableDecorator::m_glTexCoordP1ui_capture;
+this->m_orig_glPointParameterfvEXT = this->m_ptr_glPointParameterfvEXT;
+if(this->m_ptr_glPointParameterfvEXT)this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&CaptureTableDecorator::m_glPointParameterfvEXT_capture;
+this->m_orig_glUniform4fARB = this->m_ptr_glUniform4fARB;
+if(this->m_ptr_glUniform4fARB)this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&CaptureTableDecorator::m_glUniform4fARB_capture;
+this->m_orig_glImportMemoryFdEXT = this->m_ptr_glImportMemoryFdEXT;
+if(this->m_ptr_glImportMemoryFdEXT)this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&CaptureTableDecorator::m_glImportMemoryFdEXT_capture;
+this->m_orig_glCopyTextureSubImage3D = this->m_ptr_glCopyTextureSubImage3D;
+if(this->m_ptr_glCopyTextureSubImage3D)this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&CaptureTableDecorator::m_glCopyTextureSubImage3D_capture;
+this->m_orig_glMultiTexCoord2fv = this->m_ptr_glMultiTexCoord2fv;
+if(this->m_ptr_glMultiTexCoord2fv)this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&CaptureTableDecorator::m_glMultiTexCoord2fv_capture;
+this->m_orig_glNamedFramebufferSamplePositionsfvAMD = this->m_ptr_glNamedFramebufferSamplePositionsfvAMD;
+if(this->m_ptr_glNamedFramebufferSamplePositionsfvAMD)this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&CaptureTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_capture;
+this->m_orig_glNormalP3ui = this->m_ptr_glNormalP3ui;
+if(this->m_ptr_glNormalP3ui)this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&CaptureTableDecorator::m_glNormalP3ui_capture;
+this->m_orig_glDrawRangeElementArrayATI = this->m_ptr_glDrawRangeElementArrayATI;
+if(this->m_ptr_glDrawRangeElementArrayATI)this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&CaptureTableDecorator::m_glDrawRangeElementArrayATI_capture;
+this->m_orig_glVertexAttribI1i = this->m_ptr_glVertexAttribI1i;
+if(this->m_ptr_glVertexAttribI1i)this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&CaptureTableDecorator::m_glVertexAttribI1i_capture;
+this->m_orig_glDrawArraysInstancedARB = this->m_ptr_glDrawArraysInstancedARB;
+if(this->m_ptr_glDrawArraysInstancedARB)this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&CaptureTableDecorator::m_glDrawArraysInstancedARB_capture;
+this->m_orig_glEnableVertexAttribAPPLE = this->m_ptr_glEnableVertexAttribAPPLE;
+if(this->m_ptr_glEnableVertexAttribAPPLE)this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&CaptureTableDecorator::m_glEnableVertexAttribAPPLE_capture;
+this->m_orig_glGetDebugMessageLogARB = this->m_ptr_glGetDebugMessageLogARB;
+if(this->m_ptr_glGetDebugMessageLogARB)this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&CaptureTableDecorator::m_glGetDebugMessageLogARB_capture;
+this->m_orig_glGetPathTexGenfvNV = this->m_ptr_glGetPathTexGenfvNV;
+if(this->m_ptr_glGetPathTexGenfvNV)this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&CaptureTableDecorator::m_glGetPathTexGenfvNV_capture;
+this->m_orig_glNamedProgramLocalParameters4fvEXT = this->m_ptr_glNamedProgramLocalParameters4fvEXT;
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT)this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&CaptureTableDecorator::m_glNamedProgramLocalParameters4fvEXT_capture;
+this->m_orig_glQueryResourceTagNV = this->m_ptr_glQueryResourceTagNV;
+if(this->m_ptr_glQueryResourceTagNV)this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&CaptureTableDecorator::m_glQueryResourceTagNV_capture;
+this->m_orig_glVertexStream3fvATI = this->m_ptr_glVertexStream3fvATI;
+if(this->m_ptr_glVertexStream3fvATI)this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&CaptureTableDecorator::m_glVertexStream3fvATI_capture;
+this->m_orig_glFramebufferTexture3D = this->m_ptr_glFramebufferTexture3D;
+if(this->m_ptr_glFramebufferTexture3D)this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&CaptureTableDecorator::m_glFramebufferTexture3D_capture;
+this->m_orig_glCompressedTextureSubImage2DEXT = this->m_ptr_glCompressedTextureSubImage2DEXT;
+if(this->m_ptr_glCompressedTextureSubImage2DEXT)this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&CaptureTableDecorator::m_glCompressedTextureSubImage2DEXT_capture;
+this->m_orig_glWindowPos3dv = this->m_ptr_glWindowPos3dv;
+if(this->m_ptr_glWindowPos3dv)this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&CaptureTableDecorator::m_glWindowPos3dv_capture;
+this->m_orig_glCopyConvolutionFilter2D = this->m_ptr_glCopyConvolutionFilter2D;
+if(this->m_ptr_glCopyConvolutionFilter2D)this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&CaptureTableDecorator::m_glCopyConvolutionFilter2D_capture;
+this->m_orig_glReadInstrumentsSGIX = this->m_ptr_glReadInstrumentsSGIX;
+if(this->m_ptr_glReadInstrumentsSGIX)this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&CaptureTableDecorator::m_glReadInstrumentsSGIX_capture;
+this->m_orig_glProgramUniform2dvEXT = this->m_ptr_glProgramUniform2dvEXT;
+if(this->m_ptr_glProgramUniform2dvEXT)this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&CaptureTableDecorator::m_glProgramUniform2dvEXT_capture;
+this->m_orig_glSamplerParameterfv = this->m_ptr_glSamplerParameterfv;
+if(this->m_ptr_glSamplerParameterfv)this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&CaptureTableDecorator::m_glSamplerParameterfv_capture;
+this->m_orig_glBindBufferARB = this->m_ptr_glBindBufferARB;
+if(this->m_ptr_glBindBufferARB)this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&CaptureTableDecorator::m_glBindBufferARB_capture;
+this->m_orig_glVertexAttrib1sNV = this->m_ptr_glVertexAttrib1sNV;
+if(this->m_ptr_glVertexAttrib1sNV)this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&CaptureTableDecorator::m_glVertexAttrib1sNV_capture;
+this->m_orig_glGetMaterialiv = this->m_ptr_glGetMaterialiv;
+if(this->m_ptr_glGetMaterialiv)this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&CaptureTableDecorator::m_glGetMaterialiv_capture;
+this->m_orig_glUniform1fv = this->m_ptr_glUniform1fv;
+if(this->m_ptr_glUniform1fv)this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&CaptureTableDecorator::m_glUniform1fv_capture;
+this->m_orig_glBeginOcclusionQueryNV = this->m_ptr_glBeginOcclusionQueryNV;
+if(this->m_ptr_glBeginOcclusionQueryNV)this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&CaptureTableDecorator::m_glBeginOcclusionQueryNV_capture;
+this->m_orig_glGenFencesAPPLE = this->m_ptr_glGenFencesAPPLE;
+if(this->m_ptr_glGenFencesAPPLE)this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&CaptureTableDecorator::m_glGenFencesAPPLE_capture;
+this->m_orig_glScissorIndexedv = this->m_ptr_glScissorIndexedv;
+if(this->m_ptr_glScissorIndexedv)this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&CaptureTableDecorator::m_glScissorIndexedv_capture;
+this->m_orig_glDisableVariantClientStateEXT = this->m_ptr_glDisableVariantClientStateEXT;
+if(this->m_ptr_glDisableVariantClientStateEXT)this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&CaptureTableDecorator::m_glDisableVariantClientStateEXT_capture;
+this->m_orig_glMinmaxEXT = this->m_ptr_glMinmaxEXT;
+if(this->m_ptr_glMinmaxEXT)this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&CaptureTableDecorator::m_glMinmaxEXT_capture;
+this->m_orig_glNormalPointervINTEL = this->m_ptr_glNormalPointervINTEL;
+if(this->m_ptr_glNormalPointervINTEL)this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&CaptureTableDecorator::m_glNormalPointervINTEL_capture;
+this->m_orig_glNormal3s = this->m_ptr_glNormal3s;
+if(this->m_ptr_glNormal3s)this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&CaptureTableDecorator::m_glNormal3s_capture;
+this->m_orig_glGetnPixelMapuiv = this->m_ptr_glGetnPixelMapuiv;
+if(this->m_ptr_glGetnPixelMapuiv)this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&CaptureTableDecorator::m_glGetnPixelMapuiv_capture;
+this->m_orig_glNormalStream3bvATI = this->m_ptr_glNormalStream3bvATI;
+if(this->m_ptr_glNormalStream3bvATI)this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&CaptureTableDecorator::m_glNormalStream3bvATI_capture;
+this->m_orig_glGetObjectParameterivAPPLE = this->m_ptr_glGetObjectParameterivAPPLE;
+if(this->m_ptr_glGetObjectParameterivAPPLE)this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&CaptureTableDecorator::m_glGetObjectParameterivAPPLE_capture;
+this->m_orig_glNormal3i = this->m_ptr_glNormal3i;
+if(this->m_ptr_glNormal3i)this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&CaptureTableDecorator::m_glNormal3i_capture;
+this->m_orig_glUniform1ivARB = this->m_ptr_glUniform1ivARB;
+if(this->m_ptr_glUniform1ivARB)this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&CaptureTableDecorator::m_glUniform1ivARB_capture;
+this->m_orig_glNormal3d = this->m_ptr_glNormal3d;
+if(this->m_ptr_glNormal3d)this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&CaptureTableDecorator::m_glNormal3d_capture;
+this->m_orig_glUpdateObjectBufferATI = this->m_ptr_glUpdateObjectBufferATI;
+if(this->m_ptr_glUpdateObjectBufferATI)this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&CaptureTableDecorator::m_glUpdateObjectBufferATI_capture;
+this->m_orig_glNormal3b = this->m_ptr_glNormal3b;
+if(this->m_ptr_glNormal3b)this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&CaptureTableDecorator::m_glNormal3b_capture;
+this->m_orig_glGetUniformBufferSizeEXT = this->m_ptr_glGetUniformBufferSizeEXT;
+if(this->m_ptr_glGetUniformBufferSizeEXT)this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&CaptureTableDecorator::m_glGetUniformBufferSizeEXT_capture;
+this->m_orig_glMultiTexCoord4dv = this->m_ptr_glMultiTexCoord4dv;
+if(this->m_ptr_glMultiTexCoord4dv)this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&CaptureTableDecorator::m_glMultiTexCoord4dv_capture;
+this->m_orig_glProgramUniform3i64ARB = this->m_ptr_glProgramUniform3i64ARB;
+if(this->m_ptr_glProgramUniform3i64ARB)this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&CaptureTableDecorator::m_glProgramUniform3i64ARB_capture;
+this->m_orig_glVertexAttrib2d = this->m_ptr_glVertexAttrib2d;
+if(this->m_ptr_glVertexAttrib2d)this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&CaptureTableDecorator::m_glVertexAttrib2d_capture;
+this->m_orig_glVertexAttrib2f = this->m_ptr_glVertexAttrib2f;
+if(this->m_ptr_glVertexAttrib2f)this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&CaptureTableDecorator::m_glVertexAttrib2f_capture;
+this->m_orig_glMultiDrawElementsEXT = this->m_ptr_glMultiDrawElementsEXT;
+if(this->m_ptr_glMultiDrawElementsEXT)this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&CaptureTableDecorator::m_glMultiDrawElementsEXT_capture;
+this->m_orig_glVertexAttrib3dv = this->m_ptr_glVertexAttrib3dv;
+if(this->m_ptr_glVertexAttrib3dv)this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&CaptureTableDecorator::m_glVertexAttrib3dv_capture;
+this->m_orig_glMultiTexCoord2bOES = this->m_ptr_glMultiTexCoord2bOES;
+if(this->m_ptr_glMultiTexCoord2bOES)this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&CaptureTableDecorator::m_glMultiTexCoord2bOES_capture;
+this->m_orig_glVertexAttrib2s = this->m_ptr_glVertexAttrib2s;
+if(this->m_ptr_glVertexAttrib2s)this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&CaptureTableDecorator::m_glVertexAttrib2s_capture;
+this->m_orig_glTexImage3DMultisample = this->m_ptr_glTexImage3DMultisample;
+if(this->m_ptr_glTexImage3DMultisample)this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&CaptureTableDecorator::m_glTexImage3DMultisample_capture;
+this->m_orig_glGetUniformBlockIndex = this->m_ptr_glGetUniformBlockIndex;
+if(this->m_ptr_glGetUniformBlockIndex)this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&CaptureTableDecorator::m_glGetUniformBlockIndex_capture;
+this->m_orig_glReleaseKeyedMutexWin32EXT = this->m_ptr_glReleaseKeyedMutexWin32EXT;
+if(this->m_ptr_glReleaseKeyedMutexWin32EXT)this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&CaptureTableDecorator::m_glReleaseKeyedMutexWin32EXT_capture;
+this->m_orig_glFrontFace = this->m_ptr_glFrontFace;
+if(this->m_ptr_glFrontFace)this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&CaptureTableDecorator::m_glFrontFace_capture;
+this->m_orig_glEvalCoord1xOES = this->m_ptr_glEvalCoord1xOES;
+if(this->m_ptr_glEvalCoord1xOES)this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&CaptureTableDecorator::m_glEvalCoord1xOES_capture;
+this->m_orig_glDrawArraysInstancedBaseInstance = this->m_ptr_glDrawArraysInstancedBaseInstance;
+if(this->m_ptr_glDrawArraysInstancedBaseInstance)this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&CaptureTableDecorator::m_glDrawArraysInstancedBaseInstance_capture;
+this->m_orig_glIsPointInStrokePathNV = this->m_ptr_glIsPointInStrokePathNV;
+if(this->m_ptr_glIsPointInStrokePathNV)this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&CaptureTableDecorator::m_glIsPointInStrokePathNV_capture;
@@ -0,0 +1,2926 @@
+inline void glMultiDrawArraysIndirectBindlessCountNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)this->m_functions[0];if(direct_)return direct_(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);return this->m_rawTable->glMultiDrawArraysIndirectBindlessCountNV(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+inline void glTextureParameterfv(GLuint texture,GLenum pname,const GLfloat* param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERFVPROC)this->m_functions[1];if(direct_)return direct_(texture,pname,param);return this->m_rawTable->glTextureParameterfv(texture,pname,param);}
+inline void glGetListParameterivSGIX(GLuint list,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETLISTPARAMETERIVSGIXPROC)this->m_functions[2];if(direct_)return direct_(list,pname,params);return this->m_rawTable->glGetListParameterivSGIX(list,pname,params);}
+inline void glProgramUniform1i64ARB(GLuint program,GLint location,GLint64 x)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1I64ARBPROC)this->m_functions[3];if(direct_)return direct_(program,location,x);return this->m_rawTable->glProgramUniform1i64ARB(program,location,x);}
+inline void glVertexArrayElementBuffer(GLuint vaobj,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYELEMENTBUFFERPROC)this->m_functions[4];if(direct_)return direct_(vaobj,buffer);return this->m_rawTable->glVertexArrayElementBuffer(vaobj,buffer);}
+inline void glHintPGI(GLenum target,GLint mode)const{auto const direct_ = (FunctionTable::PFNGLHINTPGIPROC)this->m_functions[5];if(direct_)return direct_(target,mode);return this->m_rawTable->glHintPGI(target,mode);}
+inline void glStencilMaskSeparate(GLenum face,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILMASKSEPARATEPROC)this->m_functions[6];if(direct_)return direct_(face,mask);return this->m_rawTable->glStencilMaskSeparate(face,mask);}
+inline void glGetFramebufferAttachmentParameterivEXT(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)this->m_functions[7];if(direct_)return direct_(target,attachment,pname,params);return this->m_rawTable->glGetFramebufferAttachmentParameterivEXT(target,attachment,pname,params);}
+inline void glTextureStorage3DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)this->m_functions[8];if(direct_)return direct_(texture,samples,internalformat,width,height,depth,fixedsamplelocations);return this->m_rawTable->glTextureStorage3DMultisample(texture,samples,internalformat,width,height,depth,fixedsamplelocations);}
+inline void glGetIntegerIndexedvEXT(GLenum target,GLuint index,GLint* data)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGERINDEXEDVEXTPROC)this->m_functions[9];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetIntegerIndexedvEXT(target,index,data);}
+inline void glCopyTexImage1D(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXIMAGE1DPROC)this->m_functions[10];if(direct_)return direct_(target,level,internalformat,x,y,width,border);return this->m_rawTable->glCopyTexImage1D(target,level,internalformat,x,y,width,border);}
+inline void glVertexAttrib4usv(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4USVPROC)this->m_functions[11];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4usv(index,v);}
+inline void glTexRenderbufferNV(GLenum target,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLTEXRENDERBUFFERNVPROC)this->m_functions[12];if(direct_)return direct_(target,renderbuffer);return this->m_rawTable->glTexRenderbufferNV(target,renderbuffer);}
+inline void glVertexAttrib3hvNV(GLuint index,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3HVNVPROC)this->m_functions[13];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3hvNV(index,v);}
+inline void glProgramUniform4ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UI64ARBPROC)this->m_functions[14];if(direct_)return direct_(program,location,x,y,z,w);return this->m_rawTable->glProgramUniform4ui64ARB(program,location,x,y,z,w);}
+inline void glInstrumentsBufferSGIX(GLsizei size,GLint* buffer)const{auto const direct_ = (FunctionTable::PFNGLINSTRUMENTSBUFFERSGIXPROC)this->m_functions[15];if(direct_)return direct_(size,buffer);return this->m_rawTable->glInstrumentsBufferSGIX(size,buffer);}
+inline void glIndexi(GLint c)const{auto const direct_ = (FunctionTable::PFNGLINDEXIPROC)this->m_functions[16];if(direct_)return direct_(c);return this->m_rawTable->glIndexi(c);}
+inline void glMultiTexCoord2sARB(GLenum target,GLshort s,GLshort t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2SARBPROC)this->m_functions[17];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2sARB(target,s,t);}
+inline void glProgramEnvParameter4fARB(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETER4FARBPROC)this->m_functions[18];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramEnvParameter4fARB(target,index,x,y,z,w);}
+inline void glCompressedTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)this->m_functions[19];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+inline void glEvalCoord2d(GLdouble u,GLdouble v)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2DPROC)this->m_functions[20];if(direct_)return direct_(u,v);return this->m_rawTable->glEvalCoord2d(u,v);}
+inline void glEvalCoord2f(GLfloat u,GLfloat v)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2FPROC)this->m_functions[21];if(direct_)return direct_(u,v);return this->m_rawTable->glEvalCoord2f(u,v);}
+inline void glIndexd(GLdouble c)const{auto const direct_ = (FunctionTable::PFNGLINDEXDPROC)this->m_functions[22];if(direct_)return direct_(c);return this->m_rawTable->glIndexd(c);}
+inline void glSecondaryColor3hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3HVNVPROC)this->m_functions[23];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3hvNV(v);}
+inline void glIndexf(GLfloat c)const{auto const direct_ = (FunctionTable::PFNGLINDEXFPROC)this->m_functions[24];if(direct_)return direct_(c);return this->m_rawTable->glIndexf(c);}
+inline void glFrustumxOES(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{auto const direct_ = (FunctionTable::PFNGLFRUSTUMXOESPROC)this->m_functions[25];if(direct_)return direct_(l,r,b,t,n,f);return this->m_rawTable->glFrustumxOES(l,r,b,t,n,f);}
+inline void glTextureStorage3DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE3DEXTPROC)this->m_functions[26];if(direct_)return direct_(texture,target,levels,internalformat,width,height,depth);return this->m_rawTable->glTextureStorage3DEXT(texture,target,levels,internalformat,width,height,depth);}
+inline void glDrawCommandsStatesNV(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const direct_ = (FunctionTable::PFNGLDRAWCOMMANDSSTATESNVPROC)this->m_functions[27];if(direct_)return direct_(buffer,indirects,sizes,states,fbos,count);return this->m_rawTable->glDrawCommandsStatesNV(buffer,indirects,sizes,states,fbos,count);}
+inline void glUniform4uiEXT(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UIEXTPROC)this->m_functions[28];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4uiEXT(location,v0,v1,v2,v3);}
+inline void glProgramUniform3ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UI64ARBPROC)this->m_functions[29];if(direct_)return direct_(program,location,x,y,z);return this->m_rawTable->glProgramUniform3ui64ARB(program,location,x,y,z);}
+inline void glIndexs(GLshort c)const{auto const direct_ = (FunctionTable::PFNGLINDEXSPROC)this->m_functions[30];if(direct_)return direct_(c);return this->m_rawTable->glIndexs(c);}
+inline void glVertexArrayBindVertexBufferEXT(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)this->m_functions[31];if(direct_)return direct_(vaobj,bindingindex,buffer,offset,stride);return this->m_rawTable->glVertexArrayBindVertexBufferEXT(vaobj,bindingindex,buffer,offset,stride);}
+inline void glConvolutionParameteriEXT(GLenum target,GLenum pname,GLint params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERIEXTPROC)this->m_functions[32];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameteriEXT(target,pname,params);}
+inline void glColor4ubVertex2fSUN(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBVERTEX2FSUNPROC)this->m_functions[33];if(direct_)return direct_(r,g,b,a,x,y);return this->m_rawTable->glColor4ubVertex2fSUN(r,g,b,a,x,y);}
+inline void glProgramUniform1ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1IVEXTPROC)this->m_functions[34];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1ivEXT(program,location,count,value);}
+inline void glGetnMapfv(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPFVPROC)this->m_functions[35];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapfv(target,query,bufSize,v);}
+inline void glTransformFeedbackBufferRange(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)this->m_functions[36];if(direct_)return direct_(xfb,index,buffer,offset,size);return this->m_rawTable->glTransformFeedbackBufferRange(xfb,index,buffer,offset,size);}
+inline void glPathGlyphsNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const direct_ = (FunctionTable::PFNGLPATHGLYPHSNVPROC)this->m_functions[37];if(direct_)return direct_(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);return this->m_rawTable->glPathGlyphsNV(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);}
+inline void glSecondaryColor3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3FVPROC)this->m_functions[38];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3fv(v);}
+inline void glGetCombinerInputParameterivNV(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)this->m_functions[39];if(direct_)return direct_(stage,portion,variable,pname,params);return this->m_rawTable->glGetCombinerInputParameterivNV(stage,portion,variable,pname,params);}
+inline void glEndPerfMonitorAMD(GLuint monitor)const{auto const direct_ = (FunctionTable::PFNGLENDPERFMONITORAMDPROC)this->m_functions[40];if(direct_)return direct_(monitor);return this->m_rawTable->glEndPerfMonitorAMD(monitor);}
+inline void glPointParameterfvARB(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFVARBPROC)this->m_functions[41];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterfvARB(pname,params);}
+inline void glVertex2xOES(GLfixed x)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2XOESPROC)this->m_functions[42];if(direct_)return direct_(x);return this->m_rawTable->glVertex2xOES(x);}
+inline void glDrawElementsInstancedBaseInstance(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)this->m_functions[43];if(direct_)return direct_(mode,count,type,indices,instancecount,baseinstance);return this->m_rawTable->glDrawElementsInstancedBaseInstance(mode,count,type,indices,instancecount,baseinstance);}
+inline void glMultTransposeMatrixdARB(const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMULTTRANSPOSEMATRIXDARBPROC)this->m_functions[44];if(direct_)return direct_(m);return this->m_rawTable->glMultTransposeMatrixdARB(m);}
+inline void glVertexAttribL4dEXT(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4DEXTPROC)this->m_functions[45];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribL4dEXT(index,x,y,z,w);}
+inline void glVertex4iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4IVPROC)this->m_functions[46];if(direct_)return direct_(v);return this->m_rawTable->glVertex4iv(v);}
+inline void glCoverStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLCOVERSTROKEPATHINSTANCEDNVPROC)this->m_functions[47];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);return this->m_rawTable->glCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+inline void glDeformSGIX(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLDEFORMSGIXPROC)this->m_functions[48];if(direct_)return direct_(mask);return this->m_rawTable->glDeformSGIX(mask);}
+inline void glUniform2ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UI64NVPROC)this->m_functions[49];if(direct_)return direct_(location,x,y);return this->m_rawTable->glUniform2ui64NV(location,x,y);}
+inline void glCopyPathNV(GLuint resultPath,GLuint srcPath)const{auto const direct_ = (FunctionTable::PFNGLCOPYPATHNVPROC)this->m_functions[50];if(direct_)return direct_(resultPath,srcPath);return this->m_rawTable->glCopyPathNV(resultPath,srcPath);}
+inline void glVertexAttribP4ui(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP4UIPROC)this->m_functions[51];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP4ui(index,type,normalized,value);}
+inline void glVertexAttribL2d(GLuint index,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2DPROC)this->m_functions[52];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribL2d(index,x,y);}
+inline void glGetMultisamplefv(GLenum pname,GLuint index,GLfloat* val)const{auto const direct_ = (FunctionTable::PFNGLGETMULTISAMPLEFVPROC)this->m_functions[53];if(direct_)return direct_(pname,index,val);return this->m_rawTable->glGetMultisamplefv(pname,index,val);}
+inline void glCompressedMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)this->m_functions[54];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);return this->m_rawTable->glCompressedMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+inline GLvdpauSurfaceNV glVDPAURegisterOutputSurfaceNV(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{auto const direct_ = (FunctionTable::PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)this->m_functions[55];if(direct_)return direct_(vdpSurface,target,numTextureNames,textureNames);return this->m_rawTable->glVDPAURegisterOutputSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+inline void glMinSampleShading(GLfloat value)const{auto const direct_ = (FunctionTable::PFNGLMINSAMPLESHADINGPROC)this->m_functions[56];if(direct_)return direct_(value);return this->m_rawTable->glMinSampleShading(value);}
+inline void glProgramUniform4fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4FEXTPROC)this->m_functions[57];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4fEXT(program,location,v0,v1,v2,v3);}
+inline void glCoverStrokePathNV(GLuint path,GLenum coverMode)const{auto const direct_ = (FunctionTable::PFNGLCOVERSTROKEPATHNVPROC)this->m_functions[58];if(direct_)return direct_(path,coverMode);return this->m_rawTable->glCoverStrokePathNV(path,coverMode);}
+inline void glTextureImage2DMultisampleNV(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)this->m_functions[59];if(direct_)return direct_(texture,target,samples,internalFormat,width,height,fixedSampleLocations);return this->m_rawTable->glTextureImage2DMultisampleNV(texture,target,samples,internalFormat,width,height,fixedSampleLocations);}
+inline void glVertex3bOES(GLbyte x,GLbyte y,GLbyte z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3BOESPROC)this->m_functions[60];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3bOES(x,y,z);}
+inline void glImportMemoryWin32HandleEXT(GLuint memory,GLuint64 size,GLenum handleType,void* handle)const{auto const direct_ = (FunctionTable::PFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)this->m_functions[61];if(direct_)return direct_(memory,size,handleType,handle);return this->m_rawTable->glImportMemoryWin32HandleEXT(memory,size,handleType,handle);}
+inline void glTessellationFactorAMD(GLfloat factor)const{auto const direct_ = (FunctionTable::PFNGLTESSELLATIONFACTORAMDPROC)this->m_functions[62];if(direct_)return direct_(factor);return this->m_rawTable->glTessellationFactorAMD(factor);}
+inline void glDebugMessageControl(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGECONTROLPROC)this->m_functions[63];if(direct_)return direct_(source,type,severity,count,ids,enabled);return this->m_rawTable->glDebugMessageControl(source,type,severity,count,ids,enabled);}
+inline GLboolean glIsObjectBufferATI(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLISOBJECTBUFFERATIPROC)this->m_functions[64];if(direct_)return direct_(buffer);return this->m_rawTable->glIsObjectBufferATI(buffer);}
+inline void glPopAttrib()const{auto const direct_ = (FunctionTable::PFNGLPOPATTRIBPROC)this->m_functions[65];if(direct_)return direct_();return this->m_rawTable->glPopAttrib();}
+inline void glProgramUniform4iEXT(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4IEXTPROC)this->m_functions[66];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4iEXT(program,location,v0,v1,v2,v3);}
+inline void glVertexAttrib4ubNV(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UBNVPROC)this->m_functions[67];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4ubNV(index,x,y,z,w);}
+inline void glColorMaterial(GLenum face,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLCOLORMATERIALPROC)this->m_functions[68];if(direct_)return direct_(face,mode);return this->m_rawTable->glColorMaterial(face,mode);}
+inline void glVertexAttrib2svARB(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SVARBPROC)this->m_functions[69];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2svARB(index,v);}
+inline void glMinSampleShadingARB(GLfloat value)const{auto const direct_ = (FunctionTable::PFNGLMINSAMPLESHADINGARBPROC)this->m_functions[70];if(direct_)return direct_(value);return this->m_rawTable->glMinSampleShadingARB(value);}
+inline void glColor3b(GLbyte red,GLbyte green,GLbyte blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3BPROC)this->m_functions[71];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3b(red,green,blue);}
+inline void glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)this->m_functions[72];if(direct_)return direct_(rc,s,t,nx,ny,nz,x,y,z);return this->m_rawTable->glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc,s,t,nx,ny,nz,x,y,z);}
+inline void glColor3f(GLfloat red,GLfloat green,GLfloat blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3FPROC)this->m_functions[73];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3f(red,green,blue);}
+inline void glVDPAUGetSurfaceivNV(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{auto const direct_ = (FunctionTable::PFNGLVDPAUGETSURFACEIVNVPROC)this->m_functions[74];if(direct_)return direct_(surface,pname,bufSize,length,values);return this->m_rawTable->glVDPAUGetSurfaceivNV(surface,pname,bufSize,length,values);}
+inline void glColor3d(GLdouble red,GLdouble green,GLdouble blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3DPROC)this->m_functions[75];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3d(red,green,blue);}
+inline void glGetnMapiv(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPIVPROC)this->m_functions[76];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapiv(target,query,bufSize,v);}
+inline void glColor3i(GLint red,GLint green,GLint blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3IPROC)this->m_functions[77];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3i(red,green,blue);}
+inline void glGetInternalformatSampleivNV(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETINTERNALFORMATSAMPLEIVNVPROC)this->m_functions[78];if(direct_)return direct_(target,internalformat,samples,pname,bufSize,params);return this->m_rawTable->glGetInternalformatSampleivNV(target,internalformat,samples,pname,bufSize,params);}
+inline void glVertexAttrib4ubv(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UBVPROC)this->m_functions[79];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4ubv(index,v);}
+inline void glColor3s(GLshort red,GLshort green,GLshort blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3SPROC)this->m_functions[80];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3s(red,green,blue);}
+inline void glVertexAttribs4hvNV(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS4HVNVPROC)this->m_functions[81];if(direct_)return direct_(index,n,v);return this->m_rawTable->glVertexAttribs4hvNV(index,n,v);}
+inline void glVertexAttrib4NubvARB(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUBVARBPROC)this->m_functions[82];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NubvARB(index,v);}
+inline void glMultiTexCoord3hvNV(GLenum target,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3HVNVPROC)this->m_functions[83];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3hvNV(target,v);}
+inline void glMatrixPushEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLMATRIXPUSHEXTPROC)this->m_functions[84];if(direct_)return direct_(mode);return this->m_rawTable->glMatrixPushEXT(mode);}
+inline void glProgramUniform2fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2FEXTPROC)this->m_functions[85];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2fEXT(program,location,v0,v1);}
+inline void glGetVertexArrayIndexediv(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYINDEXEDIVPROC)this->m_functions[86];if(direct_)return direct_(vaobj,index,pname,param);return this->m_rawTable->glGetVertexArrayIndexediv(vaobj,index,pname,param);}
+inline void glBlitFramebuffer(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const direct_ = (FunctionTable::PFNGLBLITFRAMEBUFFERPROC)this->m_functions[87];if(direct_)return direct_(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);return this->m_rawTable->glBlitFramebuffer(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+inline void glMultiTexCoordP2ui(GLenum texture,GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP2UIPROC)this->m_functions[88];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP2ui(texture,type,coords);}
+inline void glColorPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLCOLORPOINTERLISTIBMPROC)this->m_functions[89];if(direct_)return direct_(size,type,stride,pointer,ptrstride);return this->m_rawTable->glColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+inline void glVertexAttribL4d(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4DPROC)this->m_functions[90];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribL4d(index,x,y,z,w);}
+inline void glGetFragmentMaterialfvSGIX(GLenum face,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGMENTMATERIALFVSGIXPROC)this->m_functions[91];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glGetFragmentMaterialfvSGIX(face,pname,params);}
+inline void glVertex2iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2IVPROC)this->m_functions[92];if(direct_)return direct_(v);return this->m_rawTable->glVertex2iv(v);}
+inline void glGetTexEnvxvOES(GLenum target,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXENVXVOESPROC)this->m_functions[93];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexEnvxvOES(target,pname,params);}
+inline void glUniformMatrix3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3DVPROC)this->m_functions[94];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3dv(location,count,transpose,value);}
+inline void glGetVertexAttribLdvEXT(GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBLDVEXTPROC)this->m_functions[95];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribLdvEXT(index,pname,params);}
+inline void glTexCoordP3uiv(GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP3UIVPROC)this->m_functions[96];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP3uiv(type,coords);}
+inline void glDeformationMap3dSGIX(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points)const{auto const direct_ = (FunctionTable::PFNGLDEFORMATIONMAP3DSGIXPROC)this->m_functions[97];if(direct_)return direct_(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);return this->m_rawTable->glDeformationMap3dSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+inline void glResumeTransformFeedback()const{auto const direct_ = (FunctionTable::PFNGLRESUMETRANSFORMFEEDBACKPROC)this->m_functions[98];if(direct_)return direct_();return this->m_rawTable->glResumeTransformFeedback();}
+inline void glInsertEventMarkerEXT(GLsizei length,const GLchar* marker)const{auto const direct_ = (FunctionTable::PFNGLINSERTEVENTMARKEREXTPROC)this->m_functions[99];if(direct_)return direct_(length,marker);return this->m_rawTable->glInsertEventMarkerEXT(length,marker);}
+inline void glTessellationModeAMD(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLTESSELLATIONMODEAMDPROC)this->m_functions[100];if(direct_)return direct_(mode);return this->m_rawTable->glTessellationModeAMD(mode);}
+inline void glDrawCommandsAddressNV(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count)const{auto const direct_ = (FunctionTable::PFNGLDRAWCOMMANDSADDRESSNVPROC)this->m_functions[101];if(direct_)return direct_(primitiveMode,indirects,sizes,count);return this->m_rawTable->glDrawCommandsAddressNV(primitiveMode,indirects,sizes,count);}
+inline void glFogi(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLFOGIPROC)this->m_functions[102];if(direct_)return direct_(pname,param);return this->m_rawTable->glFogi(pname,param);}
+inline void glGetTexParameterxvOES(GLenum target,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERXVOESPROC)this->m_functions[103];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterxvOES(target,pname,params);}
+inline void glVertexPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLVERTEXPOINTERPROC)this->m_functions[104];if(direct_)return direct_(size,type,stride,ptr);return this->m_rawTable->glVertexPointer(size,type,stride,ptr);}
+inline void glGetPerfMonitorCounterDataAMD(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORCOUNTERDATAAMDPROC)this->m_functions[105];if(direct_)return direct_(monitor,pname,dataSize,data,bytesWritten);return this->m_rawTable->glGetPerfMonitorCounterDataAMD(monitor,pname,dataSize,data,bytesWritten);}
+inline void glFogf(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLFOGFPROC)this->m_functions[106];if(direct_)return direct_(pname,param);return this->m_rawTable->glFogf(pname,param);}
+inline void glMultiTexCoord1d(GLenum target,GLdouble s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1DPROC)this->m_functions[107];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1d(target,s);}
+inline void glMultiTexCoord1f(GLenum target,GLfloat s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1FPROC)this->m_functions[108];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1f(target,s);}
+inline void glGetMultiTexParameterivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXPARAMETERIVEXTPROC)this->m_functions[109];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexParameterivEXT(texunit,target,pname,params);}
+inline void glProgramUniformMatrix3x4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)this->m_functions[110];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x4fvEXT(program,location,count,transpose,value);}
+inline void glVertexAttribI2i(GLuint index,GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2IPROC)this->m_functions[111];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribI2i(index,x,y);}
+inline void glMultiTexCoord1i(GLenum target,GLint s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1IPROC)this->m_functions[112];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1i(target,s);}
+inline void glDeleteSemaphoresEXT(GLsizei n,const GLuint* semaphores)const{auto const direct_ = (FunctionTable::PFNGLDELETESEMAPHORESEXTPROC)this->m_functions[113];if(direct_)return direct_(n,semaphores);return this->m_rawTable->glDeleteSemaphoresEXT(n,semaphores);}
+inline void glLoadProgramNV(GLenum target,GLuint id,GLsizei len,const GLubyte* program)const{auto const direct_ = (FunctionTable::PFNGLLOADPROGRAMNVPROC)this->m_functions[114];if(direct_)return direct_(target,id,len,program);return this->m_rawTable->glLoadProgramNV(target,id,len,program);}
+inline void glWriteMaskEXT(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{auto const direct_ = (FunctionTable::PFNGLWRITEMASKEXTPROC)this->m_functions[115];if(direct_)return direct_(res,in,outX,outY,outZ,outW);return this->m_rawTable->glWriteMaskEXT(res,in,outX,outY,outZ,outW);}
+inline GLenum glGetGraphicsResetStatus()const{auto const direct_ = (FunctionTable::PFNGLGETGRAPHICSRESETSTATUSPROC)this->m_functions[116];if(direct_)return direct_();return this->m_rawTable->glGetGraphicsResetStatus();}
+inline void glVertexAttrib1fv(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FVPROC)this->m_functions[117];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1fv(index,v);}
+inline void glMultiTexCoord1s(GLenum target,GLshort s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1SPROC)this->m_functions[118];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1s(target,s);}
+inline void glImageTransformParameterfvHP(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLIMAGETRANSFORMPARAMETERFVHPPROC)this->m_functions[119];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glImageTransformParameterfvHP(target,pname,params);}
+inline void glFramebufferTexture2D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE2DPROC)this->m_functions[120];if(direct_)return direct_(target,attachment,textarget,texture,level);return this->m_rawTable->glFramebufferTexture2D(target,attachment,textarget,texture,level);}
+inline void glGetFragmentLightfvSGIX(GLenum light,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGMENTLIGHTFVSGIXPROC)this->m_functions[121];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glGetFragmentLightfvSGIX(light,pname,params);}
+inline void glListParameterfSGIX(GLuint list,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLLISTPARAMETERFSGIXPROC)this->m_functions[122];if(direct_)return direct_(list,pname,param);return this->m_rawTable->glListParameterfSGIX(list,pname,param);}
+inline void glTexCoord3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3SVPROC)this->m_functions[123];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord3sv(v);}
+inline void glNamedFramebufferRenderbufferEXT(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)this->m_functions[124];if(direct_)return direct_(framebuffer,attachment,renderbuffertarget,renderbuffer);return this->m_rawTable->glNamedFramebufferRenderbufferEXT(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+inline void glFragmentLightModelfSGIX(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTMODELFSGIXPROC)this->m_functions[125];if(direct_)return direct_(pname,param);return this->m_rawTable->glFragmentLightModelfSGIX(pname,param);}
+inline void glIndexPointerEXT(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLINDEXPOINTEREXTPROC)this->m_functions[126];if(direct_)return direct_(type,stride,count,pointer);return this->m_rawTable->glIndexPointerEXT(type,stride,count,pointer);}
+inline void glBlendEquationSeparateATI(GLenum modeRGB,GLenum modeA)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEATIPROC)this->m_functions[127];if(direct_)return direct_(modeRGB,modeA);return this->m_rawTable->glBlendEquationSeparateATI(modeRGB,modeA);}
+inline void glVertexArrayAttribIFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYATTRIBIFORMATPROC)this->m_functions[128];if(direct_)return direct_(vaobj,attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexArrayAttribIFormat(vaobj,attribindex,size,type,relativeoffset);}
+inline void glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_functions[129];if(direct_)return direct_(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);return this->m_rawTable->glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+inline void glReplacementCodeubvSUN(const GLubyte* code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUBVSUNPROC)this->m_functions[130];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeubvSUN(code);}
+inline void glGenFramebuffers(GLsizei n,GLuint* framebuffers)const{auto const direct_ = (FunctionTable::PFNGLGENFRAMEBUFFERSPROC)this->m_functions[131];if(direct_)return direct_(n,framebuffers);return this->m_rawTable->glGenFramebuffers(n,framebuffers);}
+inline void glPixelMapx(GLenum map,GLint size,const GLfixed* values)const{auto const direct_ = (FunctionTable::PFNGLPIXELMAPXPROC)this->m_functions[132];if(direct_)return direct_(map,size,values);return this->m_rawTable->glPixelMapx(map,size,values);}
+inline void glTexSubImage3DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE3DEXTPROC)this->m_functions[133];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);return this->m_rawTable->glTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+inline void glGetAttachedShaders(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders)const{auto const direct_ = (FunctionTable::PFNGLGETATTACHEDSHADERSPROC)this->m_functions[134];if(direct_)return direct_(program,maxCount,count,shaders);return this->m_rawTable->glGetAttachedShaders(program,maxCount,count,shaders);}
+inline void glGetPixelTexGenParameterfvSGIS(GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)this->m_functions[135];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetPixelTexGenParameterfvSGIS(pname,params);}
+inline void glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)this->m_functions[136];if(direct_)return direct_(rc,nx,ny,nz,x,y,z);return this->m_rawTable->glReplacementCodeuiNormal3fVertex3fSUN(rc,nx,ny,nz,x,y,z);}
+inline GLuint glGetDebugMessageLogAMD(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message)const{auto const direct_ = (FunctionTable::PFNGLGETDEBUGMESSAGELOGAMDPROC)this->m_functions[137];if(direct_)return direct_(count,bufsize,categories,severities,ids,lengths,message);return this->m_rawTable->glGetDebugMessageLogAMD(count,bufsize,categories,severities,ids,lengths,message);}
+inline void glVertexStream4sATI(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4SATIPROC)this->m_functions[138];if(direct_)return direct_(stream,x,y,z,w);return this->m_rawTable->glVertexStream4sATI(stream,x,y,z,w);}
+inline void glVertexAttribs4dvNV(GLuint index,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS4DVNVPROC)this->m_functions[139];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs4dvNV(index,count,v);}
+inline void glGetnMapdvARB(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPDVARBPROC)this->m_functions[140];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapdvARB(target,query,bufSize,v);}
+inline void glOrthofOES(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{auto const direct_ = (FunctionTable::PFNGLORTHOFOESPROC)this->m_functions[141];if(direct_)return direct_(l,r,b,t,n,f);return this->m_rawTable->glOrthofOES(l,r,b,t,n,f);}
+inline void glViewportArrayv(GLuint first,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTARRAYVPROC)this->m_functions[142];if(direct_)return direct_(first,count,v);return this->m_rawTable->glViewportArrayv(first,count,v);}
+inline void glDrawElementArrayATI(GLenum mode,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTARRAYATIPROC)this->m_functions[143];if(direct_)return direct_(mode,count);return this->m_rawTable->glDrawElementArrayATI(mode,count);}
+inline void glBufferStorageMemEXT(GLenum target,GLsizeiptr size,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLBUFFERSTORAGEMEMEXTPROC)this->m_functions[144];if(direct_)return direct_(target,size,memory,offset);return this->m_rawTable->glBufferStorageMemEXT(target,size,memory,offset);}
+inline void glGetPathColorGenfvNV(GLenum color,GLenum pname,GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHCOLORGENFVNVPROC)this->m_functions[145];if(direct_)return direct_(color,pname,value);return this->m_rawTable->glGetPathColorGenfvNV(color,pname,value);}
+inline void glWindowPos3iMESA(GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IMESAPROC)this->m_functions[146];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3iMESA(x,y,z);}
+inline void glMultiTexCoord2s(GLenum target,GLshort s,GLshort t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2SPROC)this->m_functions[147];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2s(target,s,t);}
+inline void glVertex3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3DVPROC)this->m_functions[148];if(direct_)return direct_(v);return this->m_rawTable->glVertex3dv(v);}
+inline void glVertexAttribI3uivEXT(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3UIVEXTPROC)this->m_functions[149];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI3uivEXT(index,v);}
+inline void glUniform3ui64ARB(GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UI64ARBPROC)this->m_functions[150];if(direct_)return direct_(location,x,y,z);return this->m_rawTable->glUniform3ui64ARB(location,x,y,z);}
+inline void glVertexAttrib2fvNV(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FVNVPROC)this->m_functions[151];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2fvNV(index,v);}
+inline void glGetNamedBufferSubDataEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERSUBDATAEXTPROC)this->m_functions[152];if(direct_)return direct_(buffer,offset,size,data);return this->m_rawTable->glGetNamedBufferSubDataEXT(buffer,offset,size,data);}
+inline void glConvolutionFilter2D(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONFILTER2DPROC)this->m_functions[153];if(direct_)return direct_(target,internalformat,width,height,format,type,image);return this->m_rawTable->glConvolutionFilter2D(target,internalformat,width,height,format,type,image);}
+inline void glMemoryBarrierByRegion(GLbitfield barriers)const{auto const direct_ = (FunctionTable::PFNGLMEMORYBARRIERBYREGIONPROC)this->m_functions[154];if(direct_)return direct_(barriers);return this->m_rawTable->glMemoryBarrierByRegion(barriers);}
+inline void glVertexArrayBindingDivisor(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYBINDINGDIVISORPROC)this->m_functions[155];if(direct_)return direct_(vaobj,bindingindex,divisor);return this->m_rawTable->glVertexArrayBindingDivisor(vaobj,bindingindex,divisor);}
+inline void glMatrixRotatedEXT(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXROTATEDEXTPROC)this->m_functions[156];if(direct_)return direct_(mode,angle,x,y,z);return this->m_rawTable->glMatrixRotatedEXT(mode,angle,x,y,z);}
+inline void glTexCoord2sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2SVPROC)this->m_functions[157];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord2sv(v);}
+inline GLboolean glIsProgramNV(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISPROGRAMNVPROC)this->m_functions[158];if(direct_)return direct_(id);return this->m_rawTable->glIsProgramNV(id);}
+inline void glUniform2dv(GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2DVPROC)this->m_functions[159];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2dv(location,count,value);}
+inline void glGetPixelMapuiv(GLenum map,GLuint* values)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELMAPUIVPROC)this->m_functions[160];if(direct_)return direct_(map,values);return this->m_rawTable->glGetPixelMapuiv(map,values);}
+inline void glDepthBoundsEXT(GLclampd zmin,GLclampd zmax)const{auto const direct_ = (FunctionTable::PFNGLDEPTHBOUNDSEXTPROC)this->m_functions[161];if(direct_)return direct_(zmin,zmax);return this->m_rawTable->glDepthBoundsEXT(zmin,zmax);}
+inline void glVertexAttrib4hvNV(GLuint index,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4HVNVPROC)this->m_functions[162];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4hvNV(index,v);}
+inline void glMultiTexParameteriEXT(GLenum texunit,GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERIEXTPROC)this->m_functions[163];if(direct_)return direct_(texunit,target,pname,param);return this->m_rawTable->glMultiTexParameteriEXT(texunit,target,pname,param);}
+inline void glGetPointerv(GLenum pname,GLvoid** params)const{auto const direct_ = (FunctionTable::PFNGLGETPOINTERVPROC)this->m_functions[164];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetPointerv(pname,params);}
+inline void glPathCommandsNV(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const direct_ = (FunctionTable::PFNGLPATHCOMMANDSNVPROC)this->m_functions[165];if(direct_)return direct_(path,numCommands,commands,numCoords,coordType,coords);return this->m_rawTable->glPathCommandsNV(path,numCommands,commands,numCoords,coordType,coords);}
+inline void glGetListParameterfvSGIX(GLuint list,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETLISTPARAMETERFVSGIXPROC)this->m_functions[166];if(direct_)return direct_(list,pname,params);return this->m_rawTable->glGetListParameterfvSGIX(list,pname,params);}
+inline void glGetUniformuiv(GLuint program,GLint location,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMUIVPROC)this->m_functions[167];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformuiv(program,location,params);}
+inline void glDebugMessageInsertAMD(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGEINSERTAMDPROC)this->m_functions[168];if(direct_)return direct_(category,severity,id,length,buf);return this->m_rawTable->glDebugMessageInsertAMD(category,severity,id,length,buf);}
+inline void glFrustum(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{auto const direct_ = (FunctionTable::PFNGLFRUSTUMPROC)this->m_functions[169];if(direct_)return direct_(left,right,bottom,top,near_val,far_val);return this->m_rawTable->glFrustum(left,right,bottom,top,near_val,far_val);}
+inline void glVertexAttribL1ui64vNV(GLuint index,const GLuint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1UI64VNVPROC)this->m_functions[170];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL1ui64vNV(index,v);}
+inline void glClearColorxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARCOLORXOESPROC)this->m_functions[171];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearColorxOES(red,green,blue,alpha);}
+inline void glProgramUniformMatrix3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3FVPROC)this->m_functions[172];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3fv(program,location,count,transpose,value);}
+inline void glSampleMaskIndexedNV(GLuint index,GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEMASKINDEXEDNVPROC)this->m_functions[173];if(direct_)return direct_(index,mask);return this->m_rawTable->glSampleMaskIndexedNV(index,mask);}
+inline void glCompileShaderIncludeARB(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length)const{auto const direct_ = (FunctionTable::PFNGLCOMPILESHADERINCLUDEARBPROC)this->m_functions[174];if(direct_)return direct_(shader,count,path,length);return this->m_rawTable->glCompileShaderIncludeARB(shader,count,path,length);}
+inline void glGetArrayObjectfvATI(GLenum array,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETARRAYOBJECTFVATIPROC)this->m_functions[175];if(direct_)return direct_(array,pname,params);return this->m_rawTable->glGetArrayObjectfvATI(array,pname,params);}
+inline void glVertexStream4svATI(GLenum stream,const GLshort* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4SVATIPROC)this->m_functions[176];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream4svATI(stream,coords);}
+inline void glMultiTexCoord4iARB(GLenum target,GLint s,GLint t,GLint r,GLint q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4IARBPROC)this->m_functions[177];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4iARB(target,s,t,r,q);}
+inline void glVariantfvEXT(GLuint id,const GLfloat* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTFVEXTPROC)this->m_functions[178];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantfvEXT(id,addr);}
+inline void glMatrixLoadfEXT(GLenum mode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADFEXTPROC)this->m_functions[179];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixLoadfEXT(mode,m);}
+inline void glLoadIdentityDeformationMapSGIX(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)this->m_functions[180];if(direct_)return direct_(mask);return this->m_rawTable->glLoadIdentityDeformationMapSGIX(mask);}
+inline void glGetRenderbufferParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETRENDERBUFFERPARAMETERIVPROC)this->m_functions[181];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetRenderbufferParameteriv(target,pname,params);}
+inline void glProgramUniform3fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3FEXTPROC)this->m_functions[182];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3fEXT(program,location,v0,v1,v2);}
+inline void glNamedRenderbufferStorage(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLNAMEDRENDERBUFFERSTORAGEPROC)this->m_functions[183];if(direct_)return direct_(renderbuffer,internalformat,width,height);return this->m_rawTable->glNamedRenderbufferStorage(renderbuffer,internalformat,width,height);}
+inline void glBindFragDataLocation(GLuint program,GLuint color,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAGDATALOCATIONPROC)this->m_functions[184];if(direct_)return direct_(program,color,name);return this->m_rawTable->glBindFragDataLocation(program,color,name);}
+inline void glPolygonOffsetClamp(GLfloat factor,GLfloat units,GLfloat clamp)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONOFFSETCLAMPPROC)this->m_functions[185];if(direct_)return direct_(factor,units,clamp);return this->m_rawTable->glPolygonOffsetClamp(factor,units,clamp);}
+inline void glFogCoordPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDPOINTERLISTIBMPROC)this->m_functions[186];if(direct_)return direct_(type,stride,pointer,ptrstride);return this->m_rawTable->glFogCoordPointerListIBM(type,stride,pointer,ptrstride);}
+inline GLsync glFenceSync(GLenum condition,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLFENCESYNCPROC)this->m_functions[187];if(direct_)return direct_(condition,flags);return this->m_rawTable->glFenceSync(condition,flags);}
+inline void glGetVertexAttribIivEXT(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIIVEXTPROC)this->m_functions[188];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribIivEXT(index,pname,params);}
+inline void glFramebufferDrawBuffersEXT(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)this->m_functions[189];if(direct_)return direct_(framebuffer,n,bufs);return this->m_rawTable->glFramebufferDrawBuffersEXT(framebuffer,n,bufs);}
+inline void glVertexAttribs4fvNV(GLuint index,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS4FVNVPROC)this->m_functions[190];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs4fvNV(index,count,v);}
+inline void glPauseTransformFeedbackNV()const{auto const direct_ = (FunctionTable::PFNGLPAUSETRANSFORMFEEDBACKNVPROC)this->m_functions[191];if(direct_)return direct_();return this->m_rawTable->glPauseTransformFeedbackNV();}
+inline void glGetQueryObjecti64vEXT(GLuint id,GLenum pname,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTI64VEXTPROC)this->m_functions[192];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjecti64vEXT(id,pname,params);}
+inline void glVDPAUSurfaceAccessNV(GLvdpauSurfaceNV surface,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLVDPAUSURFACEACCESSNVPROC)this->m_functions[193];if(direct_)return direct_(surface,access);return this->m_rawTable->glVDPAUSurfaceAccessNV(surface,access);}
+inline void glValidateProgramPipeline(GLuint pipeline)const{auto const direct_ = (FunctionTable::PFNGLVALIDATEPROGRAMPIPELINEPROC)this->m_functions[194];if(direct_)return direct_(pipeline);return this->m_rawTable->glValidateProgramPipeline(pipeline);}
+inline void glTexPageCommitmentARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{auto const direct_ = (FunctionTable::PFNGLTEXPAGECOMMITMENTARBPROC)this->m_functions[195];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);return this->m_rawTable->glTexPageCommitmentARB(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+inline void glWindowPos3dvARB(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DVARBPROC)this->m_functions[196];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3dvARB(v);}
+inline void glStencilStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)this->m_functions[197];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);return this->m_rawTable->glStencilStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);}
+inline void glFogfv(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLFOGFVPROC)this->m_functions[198];if(direct_)return direct_(pname,params);return this->m_rawTable->glFogfv(pname,params);}
+inline void glGenQueriesARB(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLGENQUERIESARBPROC)this->m_functions[199];if(direct_)return direct_(n,ids);return this->m_rawTable->glGenQueriesARB(n,ids);}
+inline void glProgramUniform2i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2I64NVPROC)this->m_functions[200];if(direct_)return direct_(program,location,x,y);return this->m_rawTable->glProgramUniform2i64NV(program,location,x,y);}
+inline void glVertexP4ui(GLenum type,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP4UIPROC)this->m_functions[201];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP4ui(type,value);}
+inline void glVertexStream1ivATI(GLenum stream,const GLint* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1IVATIPROC)this->m_functions[202];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream1ivATI(stream,coords);}
+inline void glProgramEnvParameterI4iNV(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERI4INVPROC)this->m_functions[203];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramEnvParameterI4iNV(target,index,x,y,z,w);}
+inline void glGenVertexArraysAPPLE(GLsizei n,GLuint* arrays)const{auto const direct_ = (FunctionTable::PFNGLGENVERTEXARRAYSAPPLEPROC)this->m_functions[204];if(direct_)return direct_(n,arrays);return this->m_rawTable->glGenVertexArraysAPPLE(n,arrays);}
+inline void glDrawTransformFeedbackInstanced(GLenum mode,GLuint id,GLsizei instancecount)const{auto const direct_ = (FunctionTable::PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)this->m_functions[205];if(direct_)return direct_(mode,id,instancecount);return this->m_rawTable->glDrawTransformFeedbackInstanced(mode,id,instancecount);}
+inline void glStencilThenCoverStrokePathNV(GLuint path,GLint reference,GLuint mask,GLenum coverMode)const{auto const direct_ = (FunctionTable::PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)this->m_functions[206];if(direct_)return direct_(path,reference,mask,coverMode);return this->m_rawTable->glStencilThenCoverStrokePathNV(path,reference,mask,coverMode);}
+inline void glDeleteVertexArraysAPPLE(GLsizei n,const GLuint* arrays)const{auto const direct_ = (FunctionTable::PFNGLDELETEVERTEXARRAYSAPPLEPROC)this->m_functions[207];if(direct_)return direct_(n,arrays);return this->m_rawTable->glDeleteVertexArraysAPPLE(n,arrays);}
+inline void glGetNamedBufferParameterui64vNV(GLuint buffer,GLenum pname,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)this->m_functions[208];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferParameterui64vNV(buffer,pname,params);}
+inline GLbitfield glQueryMatrixxOES(GLfixed* mantissa,GLint* exponent)const{auto const direct_ = (FunctionTable::PFNGLQUERYMATRIXXOESPROC)this->m_functions[209];if(direct_)return direct_(mantissa,exponent);return this->m_rawTable->glQueryMatrixxOES(mantissa,exponent);}
+inline void glSecondaryColor3usv(const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3USVPROC)this->m_functions[210];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3usv(v);}
+inline void glTranslatexOES(GLfixed x,GLfixed y,GLfixed z)const{auto const direct_ = (FunctionTable::PFNGLTRANSLATEXOESPROC)this->m_functions[211];if(direct_)return direct_(x,y,z);return this->m_rawTable->glTranslatexOES(x,y,z);}
+inline void glDrawTransformFeedback(GLenum mode,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLDRAWTRANSFORMFEEDBACKPROC)this->m_functions[212];if(direct_)return direct_(mode,id);return this->m_rawTable->glDrawTransformFeedback(mode,id);}
+inline void glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[213];if(direct_)return direct_(tc,c,n,v);return this->m_rawTable->glTexCoord2fColor4fNormal3fVertex3fvSUN(tc,c,n,v);}
+inline GLvdpauSurfaceNV glVDPAURegisterVideoSurfaceNV(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{auto const direct_ = (FunctionTable::PFNGLVDPAUREGISTERVIDEOSURFACENVPROC)this->m_functions[214];if(direct_)return direct_(vdpSurface,target,numTextureNames,textureNames);return this->m_rawTable->glVDPAURegisterVideoSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+inline void glGetTexParameterIuiv(GLenum target,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERIUIVPROC)this->m_functions[215];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterIuiv(target,pname,params);}
+inline void glBindBufferBaseNV(GLenum target,GLuint index,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERBASENVPROC)this->m_functions[216];if(direct_)return direct_(target,index,buffer);return this->m_rawTable->glBindBufferBaseNV(target,index,buffer);}
+inline void glIndexPointer(GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLINDEXPOINTERPROC)this->m_functions[217];if(direct_)return direct_(type,stride,ptr);return this->m_rawTable->glIndexPointer(type,stride,ptr);}
+inline void glGenQueryResourceTagNV(GLsizei n,GLint* tagIds)const{auto const direct_ = (FunctionTable::PFNGLGENQUERYRESOURCETAGNVPROC)this->m_functions[218];if(direct_)return direct_(n,tagIds);return this->m_rawTable->glGenQueryResourceTagNV(n,tagIds);}
+inline void glVertexAttrib4Nbv(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NBVPROC)this->m_functions[219];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Nbv(index,v);}
+inline void glListParameteriSGIX(GLuint list,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLLISTPARAMETERISGIXPROC)this->m_functions[220];if(direct_)return direct_(list,pname,param);return this->m_rawTable->glListParameteriSGIX(list,pname,param);}
+inline void glBlendColorxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDCOLORXOESPROC)this->m_functions[221];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glBlendColorxOES(red,green,blue,alpha);}
+inline void glUniformui64vNV(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMUI64VNVPROC)this->m_functions[222];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniformui64vNV(location,count,value);}
+inline GLboolean glIsSync(GLsync sync)const{auto const direct_ = (FunctionTable::PFNGLISSYNCPROC)this->m_functions[223];if(direct_)return direct_(sync);return this->m_rawTable->glIsSync(sync);}
+inline void glGetTextureParameterivEXT(GLuint texture,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIVEXTPROC)this->m_functions[224];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glGetTextureParameterivEXT(texture,target,pname,params);}
+inline void glFogCoordhvNV(const GLhalfNV* fog)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDHVNVPROC)this->m_functions[225];if(direct_)return direct_(fog);return this->m_rawTable->glFogCoordhvNV(fog);}
+inline void glFramebufferTextureLayerEXT(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)this->m_functions[226];if(direct_)return direct_(target,attachment,texture,level,layer);return this->m_rawTable->glFramebufferTextureLayerEXT(target,attachment,texture,level,layer);}
+inline void glGetObjectPtrLabel(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTPTRLABELPROC)this->m_functions[227];if(direct_)return direct_(ptr,bufSize,length,label);return this->m_rawTable->glGetObjectPtrLabel(ptr,bufSize,length,label);}
+inline void glTextureParameteri(GLuint texture,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIPROC)this->m_functions[228];if(direct_)return direct_(texture,pname,param);return this->m_rawTable->glTextureParameteri(texture,pname,param);}
+inline void glMultiTexCoord1fARB(GLenum target,GLfloat s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1FARBPROC)this->m_functions[229];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1fARB(target,s);}
+inline void glUniformMatrix2x3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2X3DVPROC)this->m_functions[230];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2x3dv(location,count,transpose,value);}
+inline void glFramebufferDrawBufferEXT(GLuint framebuffer,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)this->m_functions[231];if(direct_)return direct_(framebuffer,mode);return this->m_rawTable->glFramebufferDrawBufferEXT(framebuffer,mode);}
+inline void glCopyColorSubTable(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCOLORSUBTABLEPROC)this->m_functions[232];if(direct_)return direct_(target,start,x,y,width);return this->m_rawTable->glCopyColorSubTable(target,start,x,y,width);}
+inline void glGetNamedFramebufferParameterfvAMD(GLuint framebuffer,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)this->m_functions[233];if(direct_)return direct_(framebuffer,pname,numsamples,pixelindex,size,values);return this->m_rawTable->glGetNamedFramebufferParameterfvAMD(framebuffer,pname,numsamples,pixelindex,size,values);}
+inline void glVertexAttribL3d(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3DPROC)this->m_functions[234];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribL3d(index,x,y,z);}
+inline void glFragmentMaterialfvSGIX(GLenum face,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTMATERIALFVSGIXPROC)this->m_functions[235];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glFragmentMaterialfvSGIX(face,pname,params);}
+inline void glMatrixLoadTranspose3x3fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)this->m_functions[236];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixLoadTranspose3x3fNV(matrixMode,m);}
+inline void glDeleteNamesAMD(GLenum identifier,GLuint num,const GLuint* names)const{auto const direct_ = (FunctionTable::PFNGLDELETENAMESAMDPROC)this->m_functions[237];if(direct_)return direct_(identifier,num,names);return this->m_rawTable->glDeleteNamesAMD(identifier,num,names);}
+inline void glDrawRangeElementsEXT(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices)const{auto const direct_ = (FunctionTable::PFNGLDRAWRANGEELEMENTSEXTPROC)this->m_functions[238];if(direct_)return direct_(mode,start,end,count,type,indices);return this->m_rawTable->glDrawRangeElementsEXT(mode,start,end,count,type,indices);}
+inline void glOrtho(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{auto const direct_ = (FunctionTable::PFNGLORTHOPROC)this->m_functions[239];if(direct_)return direct_(left,right,bottom,top,near_val,far_val);return this->m_rawTable->glOrtho(left,right,bottom,top,near_val,far_val);}
+inline void glProgramUniform1dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1DVEXTPROC)this->m_functions[240];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1dvEXT(program,location,count,value);}
+inline void glColor4xOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4XOESPROC)this->m_functions[241];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4xOES(red,green,blue,alpha);}
+inline void glTexImage4DSGIS(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE4DSGISPROC)this->m_functions[242];if(direct_)return direct_(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);return this->m_rawTable->glTexImage4DSGIS(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);}
+inline void glProgramUniform1ui(GLuint program,GLint location,GLuint v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UIPROC)this->m_functions[243];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1ui(program,location,v0);}
+inline void glDeleteBuffersARB(GLsizei n,const GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLDELETEBUFFERSARBPROC)this->m_functions[244];if(direct_)return direct_(n,buffers);return this->m_rawTable->glDeleteBuffersARB(n,buffers);}
+inline GLboolean glUnmapBufferARB(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLUNMAPBUFFERARBPROC)this->m_functions[245];if(direct_)return direct_(target);return this->m_rawTable->glUnmapBufferARB(target);}
+inline void glCopyTexImage2D(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXIMAGE2DPROC)this->m_functions[246];if(direct_)return direct_(target,level,internalformat,x,y,width,height,border);return this->m_rawTable->glCopyTexImage2D(target,level,internalformat,x,y,width,height,border);}
+inline void glMaterialxOES(GLenum face,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLMATERIALXOESPROC)this->m_functions[247];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glMaterialxOES(face,pname,param);}
+inline void glProgramUniformMatrix2x4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)this->m_functions[248];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x4fvEXT(program,location,count,transpose,value);}
+inline GLboolean glTestObjectAPPLE(GLenum object,GLuint name)const{auto const direct_ = (FunctionTable::PFNGLTESTOBJECTAPPLEPROC)this->m_functions[249];if(direct_)return direct_(object,name);return this->m_rawTable->glTestObjectAPPLE(object,name);}
+inline void glRenderbufferStorageEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLRENDERBUFFERSTORAGEEXTPROC)this->m_functions[250];if(direct_)return direct_(target,internalformat,width,height);return this->m_rawTable->glRenderbufferStorageEXT(target,internalformat,width,height);}
+inline void glVertexAttribL1ui64ARB(GLuint index,GLuint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1UI64ARBPROC)this->m_functions[251];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribL1ui64ARB(index,x);}
+inline void glEndFragmentShaderATI()const{auto const direct_ = (FunctionTable::PFNGLENDFRAGMENTSHADERATIPROC)this->m_functions[252];if(direct_)return direct_();return this->m_rawTable->glEndFragmentShaderATI();}
+inline void glPathParameterivNV(GLuint path,GLenum pname,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPATHPARAMETERIVNVPROC)this->m_functions[253];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glPathParameterivNV(path,pname,value);}
+inline void glUniform4uiv(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UIVPROC)this->m_functions[254];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4uiv(location,count,value);}
+inline void glFrameZoomSGIX(GLint factor)const{auto const direct_ = (FunctionTable::PFNGLFRAMEZOOMSGIXPROC)this->m_functions[255];if(direct_)return direct_(factor);return this->m_rawTable->glFrameZoomSGIX(factor);}
+inline void glSecondaryColor3fEXT(GLfloat red,GLfloat green,GLfloat blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3FEXTPROC)this->m_functions[256];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3fEXT(red,green,blue);}
+inline void glLGPUInterlockNVX()const{auto const direct_ = (FunctionTable::PFNGLLGPUINTERLOCKNVXPROC)this->m_functions[257];if(direct_)return direct_();return this->m_rawTable->glLGPUInterlockNVX();}
+inline void glVertexAttribL1dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1DVPROC)this->m_functions[258];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL1dv(index,v);}
+inline void glNormalStream3svATI(GLenum stream,const GLshort* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3SVATIPROC)this->m_functions[259];if(direct_)return direct_(stream,coords);return this->m_rawTable->glNormalStream3svATI(stream,coords);}
+inline void glPathStencilFuncNV(GLenum func,GLint ref,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLPATHSTENCILFUNCNVPROC)this->m_functions[260];if(direct_)return direct_(func,ref,mask);return this->m_rawTable->glPathStencilFuncNV(func,ref,mask);}
+inline void glSetInvariantEXT(GLuint id,GLenum type,const void* addr)const{auto const direct_ = (FunctionTable::PFNGLSETINVARIANTEXTPROC)this->m_functions[261];if(direct_)return direct_(id,type,addr);return this->m_rawTable->glSetInvariantEXT(id,type,addr);}
+inline void glGetTexBumpParameterivATI(GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETTEXBUMPPARAMETERIVATIPROC)this->m_functions[262];if(direct_)return direct_(pname,param);return this->m_rawTable->glGetTexBumpParameterivATI(pname,param);}
+inline void glBlendEquationSeparateEXT(GLenum modeRGB,GLenum modeAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEEXTPROC)this->m_functions[263];if(direct_)return direct_(modeRGB,modeAlpha);return this->m_rawTable->glBlendEquationSeparateEXT(modeRGB,modeAlpha);}
+inline void glEndOcclusionQueryNV()const{auto const direct_ = (FunctionTable::PFNGLENDOCCLUSIONQUERYNVPROC)this->m_functions[264];if(direct_)return direct_();return this->m_rawTable->glEndOcclusionQueryNV();}
+inline void glScissorArrayv(GLuint first,GLsizei count,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLSCISSORARRAYVPROC)this->m_functions[265];if(direct_)return direct_(first,count,v);return this->m_rawTable->glScissorArrayv(first,count,v);}
+inline void glCallList(GLuint list)const{auto const direct_ = (FunctionTable::PFNGLCALLLISTPROC)this->m_functions[266];if(direct_)return direct_(list);return this->m_rawTable->glCallList(list);}
+inline void* glMapTexture2DINTEL(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout)const{auto const direct_ = (FunctionTable::PFNGLMAPTEXTURE2DINTELPROC)this->m_functions[267];if(direct_)return direct_(texture,level,access,stride,layout);return this->m_rawTable->glMapTexture2DINTEL(texture,level,access,stride,layout);}
+inline GLVULKANPROCNV glGetVkProcAddrNV(const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETVKPROCADDRNVPROC)this->m_functions[268];if(direct_)return direct_(name);return this->m_rawTable->glGetVkProcAddrNV(name);}
+inline void glPixelTransferxOES(GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFERXOESPROC)this->m_functions[269];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelTransferxOES(pname,param);}
+inline void glDeleteRenderbuffersEXT(GLsizei n,const GLuint* renderbuffers)const{auto const direct_ = (FunctionTable::PFNGLDELETERENDERBUFFERSEXTPROC)this->m_functions[270];if(direct_)return direct_(n,renderbuffers);return this->m_rawTable->glDeleteRenderbuffersEXT(n,renderbuffers);}
+inline void glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)this->m_functions[271];if(direct_)return direct_(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);return this->m_rawTable->glTexCoord4fColor4fNormal3fVertex4fSUN(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);}
+inline void glProgramUniformMatrix4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)this->m_functions[272];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4dvEXT(program,location,count,transpose,value);}
+inline void glGetnColorTable(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{auto const direct_ = (FunctionTable::PFNGLGETNCOLORTABLEPROC)this->m_functions[273];if(direct_)return direct_(target,format,type,bufSize,table);return this->m_rawTable->glGetnColorTable(target,format,type,bufSize,table);}
+inline void glFramebufferTextureLayerARB(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURELAYERARBPROC)this->m_functions[274];if(direct_)return direct_(target,attachment,texture,level,layer);return this->m_rawTable->glFramebufferTextureLayerARB(target,attachment,texture,level,layer);}
+inline void glVertexAttribL2dvEXT(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2DVEXTPROC)this->m_functions[275];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL2dvEXT(index,v);}
+inline void glGetCombinerStageParameterfvNV(GLenum stage,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)this->m_functions[276];if(direct_)return direct_(stage,pname,params);return this->m_rawTable->glGetCombinerStageParameterfvNV(stage,pname,params);}
+inline void glMultiTexCoord1xvOES(GLenum texture,const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1XVOESPROC)this->m_functions[277];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord1xvOES(texture,coords);}
+inline void* glMapBuffer(GLenum target,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAPBUFFERPROC)this->m_functions[278];if(direct_)return direct_(target,access);return this->m_rawTable->glMapBuffer(target,access);}
+inline void glSecondaryColor3d(GLdouble red,GLdouble green,GLdouble blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3DPROC)this->m_functions[279];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3d(red,green,blue);}
+inline void glSecondaryColor3f(GLfloat red,GLfloat green,GLfloat blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3FPROC)this->m_functions[280];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3f(red,green,blue);}
+inline void glVertexAttribLFormat(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBLFORMATPROC)this->m_functions[281];if(direct_)return direct_(attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexAttribLFormat(attribindex,size,type,relativeoffset);}
+inline void glElementPointerAPPLE(GLenum type,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLELEMENTPOINTERAPPLEPROC)this->m_functions[282];if(direct_)return direct_(type,pointer);return this->m_rawTable->glElementPointerAPPLE(type,pointer);}
+inline void glVertexStream1fATI(GLenum stream,GLfloat x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1FATIPROC)this->m_functions[283];if(direct_)return direct_(stream,x);return this->m_rawTable->glVertexStream1fATI(stream,x);}
+inline void glCoverageModulationNV(GLenum components)const{auto const direct_ = (FunctionTable::PFNGLCOVERAGEMODULATIONNVPROC)this->m_functions[284];if(direct_)return direct_(components);return this->m_rawTable->glCoverageModulationNV(components);}
+inline void glSecondaryColor3i(GLint red,GLint green,GLint blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3IPROC)this->m_functions[285];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3i(red,green,blue);}
+inline void glDeleteSync(GLsync sync)const{auto const direct_ = (FunctionTable::PFNGLDELETESYNCPROC)this->m_functions[286];if(direct_)return direct_(sync);return this->m_rawTable->glDeleteSync(sync);}
+inline void glGetProgramParameterfvNV(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMPARAMETERFVNVPROC)this->m_functions[287];if(direct_)return direct_(target,index,pname,params);return this->m_rawTable->glGetProgramParameterfvNV(target,index,pname,params);}
+inline void glMaxShaderCompilerThreadsARB(GLuint count)const{auto const direct_ = (FunctionTable::PFNGLMAXSHADERCOMPILERTHREADSARBPROC)this->m_functions[288];if(direct_)return direct_(count);return this->m_rawTable->glMaxShaderCompilerThreadsARB(count);}
+inline void glUniformMatrix4x2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4X2DVPROC)this->m_functions[289];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4x2dv(location,count,transpose,value);}
+inline void glVertexArrayVertexAttribLOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)this->m_functions[290];if(direct_)return direct_(vaobj,buffer,index,size,type,stride,offset);return this->m_rawTable->glVertexArrayVertexAttribLOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+inline void glSecondaryColor3s(GLshort red,GLshort green,GLshort blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3SPROC)this->m_functions[291];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3s(red,green,blue);}
+inline GLboolean glIsImageHandleResidentNV(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLISIMAGEHANDLERESIDENTNVPROC)this->m_functions[292];if(direct_)return direct_(handle);return this->m_rawTable->glIsImageHandleResidentNV(handle);}
+inline void glUniform3iv(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3IVPROC)this->m_functions[293];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3iv(location,count,value);}
+inline void glVertexAttribL3i64vNV(GLuint index,const GLint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3I64VNVPROC)this->m_functions[294];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL3i64vNV(index,v);}
+inline void glPolygonMode(GLenum face,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONMODEPROC)this->m_functions[295];if(direct_)return direct_(face,mode);return this->m_rawTable->glPolygonMode(face,mode);}
+inline void glFramebufferSamplePositionsfvAMD(GLenum target,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)this->m_functions[296];if(direct_)return direct_(target,numsamples,pixelindex,values);return this->m_rawTable->glFramebufferSamplePositionsfvAMD(target,numsamples,pixelindex,values);}
+inline void glConvolutionFilter1DEXT(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONFILTER1DEXTPROC)this->m_functions[297];if(direct_)return direct_(target,internalformat,width,format,type,image);return this->m_rawTable->glConvolutionFilter1DEXT(target,internalformat,width,format,type,image);}
+inline void glVertexAttrib1dvARB(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DVARBPROC)this->m_functions[298];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1dvARB(index,v);}
+inline void glTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE2DEXTPROC)this->m_functions[299];if(direct_)return direct_(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);return this->m_rawTable->glTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+inline GLboolean glIsVertexArrayAPPLE(GLuint array)const{auto const direct_ = (FunctionTable::PFNGLISVERTEXARRAYAPPLEPROC)this->m_functions[300];if(direct_)return direct_(array);return this->m_rawTable->glIsVertexArrayAPPLE(array);}
+inline void glUseProgram(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLUSEPROGRAMPROC)this->m_functions[301];if(direct_)return direct_(program);return this->m_rawTable->glUseProgram(program);}
+inline void glLineStipple(GLint factor,GLushort pattern)const{auto const direct_ = (FunctionTable::PFNGLLINESTIPPLEPROC)this->m_functions[302];if(direct_)return direct_(factor,pattern);return this->m_rawTable->glLineStipple(factor,pattern);}
+inline void glMultiTexCoord4fvARB(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4FVARBPROC)this->m_functions[303];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4fvARB(target,v);}
+inline GLenum glVideoCaptureNV(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time)const{auto const direct_ = (FunctionTable::PFNGLVIDEOCAPTURENVPROC)this->m_functions[304];if(direct_)return direct_(video_capture_slot,sequence_num,capture_time);return this->m_rawTable->glVideoCaptureNV(video_capture_slot,sequence_num,capture_time);}
+inline void glVertexArrayVertexAttribLFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)this->m_functions[305];if(direct_)return direct_(vaobj,attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexArrayVertexAttribLFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+inline void glUniform3fvARB(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3FVARBPROC)this->m_functions[306];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3fvARB(location,count,value);}
+inline void glProgramUniformMatrix3x2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)this->m_functions[307];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x2fvEXT(program,location,count,transpose,value);}
+inline void glCopyTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)this->m_functions[308];if(direct_)return direct_(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);return this->m_rawTable->glCopyTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+inline void glMultiTexCoord2bvOES(GLenum texture,const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2BVOESPROC)this->m_functions[309];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord2bvOES(texture,coords);}
+inline void glDeleteObjectARB(GLhandleARB obj)const{auto const direct_ = (FunctionTable::PFNGLDELETEOBJECTARBPROC)this->m_functions[310];if(direct_)return direct_(obj);return this->m_rawTable->glDeleteObjectARB(obj);}
+inline void glTextureLightEXT(GLenum pname)const{auto const direct_ = (FunctionTable::PFNGLTEXTURELIGHTEXTPROC)this->m_functions[311];if(direct_)return direct_(pname);return this->m_rawTable->glTextureLightEXT(pname);}
+inline void glRasterPos3i(GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3IPROC)this->m_functions[312];if(direct_)return direct_(x,y,z);return this->m_rawTable->glRasterPos3i(x,y,z);}
+inline void glMultiTexCoord3dARB(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3DARBPROC)this->m_functions[313];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3dARB(target,s,t,r);}
+inline void glNamedFramebufferTextureEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)this->m_functions[314];if(direct_)return direct_(framebuffer,attachment,texture,level);return this->m_rawTable->glNamedFramebufferTextureEXT(framebuffer,attachment,texture,level);}
+inline void glTextureParameteriEXT(GLuint texture,GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIEXTPROC)this->m_functions[315];if(direct_)return direct_(texture,target,pname,param);return this->m_rawTable->glTextureParameteriEXT(texture,target,pname,param);}
+inline void glEvalCoord2xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2XVOESPROC)this->m_functions[316];if(direct_)return direct_(coords);return this->m_rawTable->glEvalCoord2xvOES(coords);}
+inline void glBindVideoCaptureStreamBufferNV(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset)const{auto const direct_ = (FunctionTable::PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)this->m_functions[317];if(direct_)return direct_(video_capture_slot,stream,frame_region,offset);return this->m_rawTable->glBindVideoCaptureStreamBufferNV(video_capture_slot,stream,frame_region,offset);}
+inline void glTexImage2DMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)this->m_functions[318];if(direct_)return direct_(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);return this->m_rawTable->glTexImage2DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+inline GLint glGetAttribLocationARB(GLhandleARB programObj,const GLcharARB* name)const{auto const direct_ = (FunctionTable::PFNGLGETATTRIBLOCATIONARBPROC)this->m_functions[319];if(direct_)return direct_(programObj,name);return this->m_rawTable->glGetAttribLocationARB(programObj,name);}
+inline void glDeleteShader(GLuint shader)const{auto const direct_ = (FunctionTable::PFNGLDELETESHADERPROC)this->m_functions[320];if(direct_)return direct_(shader);return this->m_rawTable->glDeleteShader(shader);}
+inline void glVertexAttrib1fARB(GLuint index,GLfloat x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FARBPROC)this->m_functions[321];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1fARB(index,x);}
+inline void glTexCoord2fColor4ubVertex3fSUN(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)this->m_functions[322];if(direct_)return direct_(s,t,r,g,b,a,x,y,z);return this->m_rawTable->glTexCoord2fColor4ubVertex3fSUN(s,t,r,g,b,a,x,y,z);}
+inline void glTexCoord4fVertex4fSUN(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FVERTEX4FSUNPROC)this->m_functions[323];if(direct_)return direct_(s,t,p,q,x,y,z,w);return this->m_rawTable->glTexCoord4fVertex4fSUN(s,t,p,q,x,y,z,w);}
+inline void glGetMapdv(GLenum target,GLenum query,GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLGETMAPDVPROC)this->m_functions[324];if(direct_)return direct_(target,query,v);return this->m_rawTable->glGetMapdv(target,query,v);}
+inline void glMapParameterfvNV(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLMAPPARAMETERFVNVPROC)this->m_functions[325];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glMapParameterfvNV(target,pname,params);}
+inline void glTextureParameterIuiv(GLuint texture,GLenum pname,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIUIVPROC)this->m_functions[326];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glTextureParameterIuiv(texture,pname,params);}
+inline void glTransformFeedbackAttribsNV(GLsizei count,const GLint* attribs,GLenum bufferMode)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)this->m_functions[327];if(direct_)return direct_(count,attribs,bufferMode);return this->m_rawTable->glTransformFeedbackAttribsNV(count,attribs,bufferMode);}
+inline void glFragmentLightfvSGIX(GLenum light,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTFVSGIXPROC)this->m_functions[328];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glFragmentLightfvSGIX(light,pname,params);}
+inline void glWindowPos3sARB(GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SARBPROC)this->m_functions[329];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3sARB(x,y,z);}
+inline void glGetConvolutionParameterfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONPARAMETERFVPROC)this->m_functions[330];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetConvolutionParameterfv(target,pname,params);}
+inline void glCopyTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE3DPROC)this->m_functions[331];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,x,y,width,height);return this->m_rawTable->glCopyTexSubImage3D(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+inline void glVertexAttribI3i(GLuint index,GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3IPROC)this->m_functions[332];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribI3i(index,x,y,z);}
+inline GLhandleARB glCreateShaderObjectARB(GLenum shaderType)const{auto const direct_ = (FunctionTable::PFNGLCREATESHADEROBJECTARBPROC)this->m_functions[333];if(direct_)return direct_(shaderType);return this->m_rawTable->glCreateShaderObjectARB(shaderType);}
+inline void glVertexAttribFormat(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBFORMATPROC)this->m_functions[334];if(direct_)return direct_(attribindex,size,type,normalized,relativeoffset);return this->m_rawTable->glVertexAttribFormat(attribindex,size,type,normalized,relativeoffset);}
+inline void glGetProgramivARB(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMIVARBPROC)this->m_functions[335];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetProgramivARB(target,pname,params);}
+inline void glVertexAttribI4usv(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4USVPROC)this->m_functions[336];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4usv(index,v);}
+inline void glTexParameterf(GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERFPROC)this->m_functions[337];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexParameterf(target,pname,param);}
+inline void glVertexAttribBinding(GLuint attribindex,GLuint bindingindex)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBBINDINGPROC)this->m_functions[338];if(direct_)return direct_(attribindex,bindingindex);return this->m_rawTable->glVertexAttribBinding(attribindex,bindingindex);}
+inline void glGetHistogramParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPARAMETERIVPROC)this->m_functions[339];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetHistogramParameteriv(target,pname,params);}
+inline void glTexParameteri(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIPROC)this->m_functions[340];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexParameteri(target,pname,param);}
+inline void glGetShaderSource(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source)const{auto const direct_ = (FunctionTable::PFNGLGETSHADERSOURCEPROC)this->m_functions[341];if(direct_)return direct_(shader,bufSize,length,source);return this->m_rawTable->glGetShaderSource(shader,bufSize,length,source);}
+inline void glVertexAttrib4s(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SPROC)this->m_functions[342];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4s(index,x,y,z,w);}
+inline void glVertexAttrib4dvNV(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DVNVPROC)this->m_functions[343];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4dvNV(index,v);}
+inline void glVertexAttrib1dvNV(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DVNVPROC)this->m_functions[344];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1dvNV(index,v);}
+inline void glPopName()const{auto const direct_ = (FunctionTable::PFNGLPOPNAMEPROC)this->m_functions[345];if(direct_)return direct_();return this->m_rawTable->glPopName();}
+inline void glTextureBufferEXT(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBUFFEREXTPROC)this->m_functions[346];if(direct_)return direct_(texture,target,internalformat,buffer);return this->m_rawTable->glTextureBufferEXT(texture,target,internalformat,buffer);}
+inline void glGetMultiTexImageEXT(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXIMAGEEXTPROC)this->m_functions[347];if(direct_)return direct_(texunit,target,level,format,type,pixels);return this->m_rawTable->glGetMultiTexImageEXT(texunit,target,level,format,type,pixels);}
+inline void glGetPointerIndexedvEXT(GLenum target,GLuint index,void** data)const{auto const direct_ = (FunctionTable::PFNGLGETPOINTERINDEXEDVEXTPROC)this->m_functions[348];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetPointerIndexedvEXT(target,index,data);}
+inline GLboolean glIsNameAMD(GLenum identifier,GLuint name)const{auto const direct_ = (FunctionTable::PFNGLISNAMEAMDPROC)this->m_functions[349];if(direct_)return direct_(identifier,name);return this->m_rawTable->glIsNameAMD(identifier,name);}
+inline void glColor4ub(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBPROC)this->m_functions[350];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4ub(red,green,blue,alpha);}
+inline void glBufferParameteriAPPLE(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLBUFFERPARAMETERIAPPLEPROC)this->m_functions[351];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glBufferParameteriAPPLE(target,pname,param);}
+inline void glColor4ui(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UIPROC)this->m_functions[352];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4ui(red,green,blue,alpha);}
+inline void glGetInternalformativ(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETINTERNALFORMATIVPROC)this->m_functions[353];if(direct_)return direct_(target,internalformat,pname,bufSize,params);return this->m_rawTable->glGetInternalformativ(target,internalformat,pname,bufSize,params);}
+inline void glColor4us(GLushort red,GLushort green,GLushort blue,GLushort alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4USPROC)this->m_functions[354];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4us(red,green,blue,alpha);}
+inline void glVertexAttribP1uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP1UIVPROC)this->m_functions[355];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP1uiv(index,type,normalized,value);}
+inline void glLinkProgram(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLLINKPROGRAMPROC)this->m_functions[356];if(direct_)return direct_(program);return this->m_rawTable->glLinkProgram(program);}
+inline void glTexCoord3s(GLshort s,GLshort t,GLshort r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3SPROC)this->m_functions[357];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3s(s,t,r);}
+inline void glTexCoord2dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2DVPROC)this->m_functions[358];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord2dv(v);}
+inline void glGetObjectLabel(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTLABELPROC)this->m_functions[359];if(direct_)return direct_(identifier,name,bufSize,length,label);return this->m_rawTable->glGetObjectLabel(identifier,name,bufSize,length,label);}
+inline void glVertexPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXPOINTEREXTPROC)this->m_functions[360];if(direct_)return direct_(size,type,stride,count,pointer);return this->m_rawTable->glVertexPointerEXT(size,type,stride,count,pointer);}
+inline void glDebugMessageCallbackARB(GLDEBUGPROCARB callback,const void* userParam)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGECALLBACKARBPROC)this->m_functions[361];if(direct_)return direct_(callback,userParam);return this->m_rawTable->glDebugMessageCallbackARB(callback,userParam);}
+inline const GLubyte* glGetString(GLenum name)const{auto const direct_ = (FunctionTable::PFNGLGETSTRINGPROC)this->m_functions[362];if(direct_)return direct_(name);return this->m_rawTable->glGetString(name);}
+inline void glGetPathParameterfvNV(GLuint path,GLenum pname,GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHPARAMETERFVNVPROC)this->m_functions[363];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glGetPathParameterfvNV(path,pname,value);}
+inline void glLightxvOES(GLenum light,GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLLIGHTXVOESPROC)this->m_functions[364];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glLightxvOES(light,pname,params);}
+inline void glEndQuery(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLENDQUERYPROC)this->m_functions[365];if(direct_)return direct_(target);return this->m_rawTable->glEndQuery(target);}
+inline void glSecondaryColor3uiv(const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UIVPROC)this->m_functions[366];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3uiv(v);}
+inline void glPrioritizeTexturesxOES(GLsizei n,const GLuint* textures,const GLfixed* priorities)const{auto const direct_ = (FunctionTable::PFNGLPRIORITIZETEXTURESXOESPROC)this->m_functions[367];if(direct_)return direct_(n,textures,priorities);return this->m_rawTable->glPrioritizeTexturesxOES(n,textures,priorities);}
+inline void glEdgeFlagPointer(GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGPOINTERPROC)this->m_functions[368];if(direct_)return direct_(stride,ptr);return this->m_rawTable->glEdgeFlagPointer(stride,ptr);}
+inline void glFramebufferParameteri(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERPARAMETERIPROC)this->m_functions[369];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glFramebufferParameteri(target,pname,param);}
+inline void glTexCoord3hNV(GLhalfNV s,GLhalfNV t,GLhalfNV r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3HNVPROC)this->m_functions[370];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3hNV(s,t,r);}
+inline void glMultiModeDrawElementsIBM(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride)const{auto const direct_ = (FunctionTable::PFNGLMULTIMODEDRAWELEMENTSIBMPROC)this->m_functions[371];if(direct_)return direct_(mode,count,type,indices,primcount,modestride);return this->m_rawTable->glMultiModeDrawElementsIBM(mode,count,type,indices,primcount,modestride);}
+inline void glCopyPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type)const{auto const direct_ = (FunctionTable::PFNGLCOPYPIXELSPROC)this->m_functions[372];if(direct_)return direct_(x,y,width,height,type);return this->m_rawTable->glCopyPixels(x,y,width,height,type);}
+inline void glVertexAttribI2ui(GLuint index,GLuint x,GLuint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2UIPROC)this->m_functions[373];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribI2ui(index,x,y);}
+inline void glClampColorARB(GLenum target,GLenum clamp)const{auto const direct_ = (FunctionTable::PFNGLCLAMPCOLORARBPROC)this->m_functions[374];if(direct_)return direct_(target,clamp);return this->m_rawTable->glClampColorARB(target,clamp);}
+inline void glColorPointervINTEL(GLint size,GLenum type,const void** pointer)const{auto const direct_ = (FunctionTable::PFNGLCOLORPOINTERVINTELPROC)this->m_functions[375];if(direct_)return direct_(size,type,pointer);return this->m_rawTable->glColorPointervINTEL(size,type,pointer);}
+inline void glDeleteTextures(GLsizei n,const GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLDELETETEXTURESPROC)this->m_functions[376];if(direct_)return direct_(n,textures);return this->m_rawTable->glDeleteTextures(n,textures);}
+inline void glGetMinmaxParameterfvEXT(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXPARAMETERFVEXTPROC)this->m_functions[377];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMinmaxParameterfvEXT(target,pname,params);}
+inline void glWindowPos3sMESA(GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SMESAPROC)this->m_functions[378];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3sMESA(x,y,z);}
+inline void glVertexAttrib4f(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FPROC)this->m_functions[379];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4f(index,x,y,z,w);}
+inline void glNamedFramebufferParameteri(GLuint framebuffer,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)this->m_functions[380];if(direct_)return direct_(framebuffer,pname,param);return this->m_rawTable->glNamedFramebufferParameteri(framebuffer,pname,param);}
+inline void glTexCoord2fVertex3fvSUN(const GLfloat* tc,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FVERTEX3FVSUNPROC)this->m_functions[381];if(direct_)return direct_(tc,v);return this->m_rawTable->glTexCoord2fVertex3fvSUN(tc,v);}
+inline void glReplacementCodeusSUN(GLushort code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUSSUNPROC)this->m_functions[382];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeusSUN(code);}
+inline void glGetNamedFramebufferParameteriv(GLuint framebuffer,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)this->m_functions[383];if(direct_)return direct_(framebuffer,pname,param);return this->m_rawTable->glGetNamedFramebufferParameteriv(framebuffer,pname,param);}
+inline void glVertexStream1fvATI(GLenum stream,const GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1FVATIPROC)this->m_functions[384];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream1fvATI(stream,coords);}
+inline void glCreateVertexArrays(GLsizei n,GLuint* arrays)const{auto const direct_ = (FunctionTable::PFNGLCREATEVERTEXARRAYSPROC)this->m_functions[385];if(direct_)return direct_(n,arrays);return this->m_rawTable->glCreateVertexArrays(n,arrays);}
+inline void glBeginConditionalRender(GLuint id,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBEGINCONDITIONALRENDERPROC)this->m_functions[386];if(direct_)return direct_(id,mode);return this->m_rawTable->glBeginConditionalRender(id,mode);}
+inline void glGetUnsignedBytevEXT(GLenum pname,GLubyte* data)const{auto const direct_ = (FunctionTable::PFNGLGETUNSIGNEDBYTEVEXTPROC)this->m_functions[387];if(direct_)return direct_(pname,data);return this->m_rawTable->glGetUnsignedBytevEXT(pname,data);}
+inline void glConvolutionFilter1D(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONFILTER1DPROC)this->m_functions[388];if(direct_)return direct_(target,internalformat,width,format,type,image);return this->m_rawTable->glConvolutionFilter1D(target,internalformat,width,format,type,image);}
+inline void glMultiTexCoord3fARB(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3FARBPROC)this->m_functions[389];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3fARB(target,s,t,r);}
+inline void glGetQueryObjectuivARB(GLuint id,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTUIVARBPROC)this->m_functions[390];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectuivARB(id,pname,params);}
+inline void glScalexOES(GLfixed x,GLfixed y,GLfixed z)const{auto const direct_ = (FunctionTable::PFNGLSCALEXOESPROC)this->m_functions[391];if(direct_)return direct_(x,y,z);return this->m_rawTable->glScalexOES(x,y,z);}
+inline void glSamplerParameteri(GLuint sampler,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERIPROC)this->m_functions[392];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameteri(sampler,pname,param);}
+inline void glSamplerParameterf(GLuint sampler,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERFPROC)this->m_functions[393];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameterf(sampler,pname,param);}
+inline void glShaderOp1EXT(GLenum op,GLuint res,GLuint arg1)const{auto const direct_ = (FunctionTable::PFNGLSHADEROP1EXTPROC)this->m_functions[394];if(direct_)return direct_(op,res,arg1);return this->m_rawTable->glShaderOp1EXT(op,res,arg1);}
+inline void glBeginVideoCaptureNV(GLuint video_capture_slot)const{auto const direct_ = (FunctionTable::PFNGLBEGINVIDEOCAPTURENVPROC)this->m_functions[395];if(direct_)return direct_(video_capture_slot);return this->m_rawTable->glBeginVideoCaptureNV(video_capture_slot);}
+inline void glGetnHistogram(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETNHISTOGRAMPROC)this->m_functions[396];if(direct_)return direct_(target,reset,format,type,bufSize,values);return this->m_rawTable->glGetnHistogram(target,reset,format,type,bufSize,values);}
+inline void glUniform1d(GLint location,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1DPROC)this->m_functions[397];if(direct_)return direct_(location,x);return this->m_rawTable->glUniform1d(location,x);}
+inline GLint glRenderMode(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLRENDERMODEPROC)this->m_functions[398];if(direct_)return direct_(mode);return this->m_rawTable->glRenderMode(mode);}
+inline void glClearColorIiEXT(GLint red,GLint green,GLint blue,GLint alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARCOLORIIEXTPROC)this->m_functions[399];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearColorIiEXT(red,green,blue,alpha);}
+inline void glSignalSemaphoreEXT(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* dstLayouts)const{auto const direct_ = (FunctionTable::PFNGLSIGNALSEMAPHOREEXTPROC)this->m_functions[400];if(direct_)return direct_(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);return this->m_rawTable->glSignalSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);}
+inline void glGetCompressedTexImage(GLenum target,GLint lod,GLvoid* img)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDTEXIMAGEPROC)this->m_functions[401];if(direct_)return direct_(target,lod,img);return this->m_rawTable->glGetCompressedTexImage(target,lod,img);}
+inline void glCompressedTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)this->m_functions[402];if(direct_)return direct_(texture,target,level,internalformat,width,border,imageSize,bits);return this->m_rawTable->glCompressedTextureImage1DEXT(texture,target,level,internalformat,width,border,imageSize,bits);}
+inline void glGetActiveUniformBlockiv(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMBLOCKIVPROC)this->m_functions[403];if(direct_)return direct_(program,uniformBlockIndex,pname,params);return this->m_rawTable->glGetActiveUniformBlockiv(program,uniformBlockIndex,pname,params);}
+inline void glUniform1i(GLint location,GLint v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1IPROC)this->m_functions[404];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1i(location,v0);}
+inline void glMultiDrawArraysIndirectCount(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)this->m_functions[405];if(direct_)return direct_(mode,indirect,drawcount,maxdrawcount,stride);return this->m_rawTable->glMultiDrawArraysIndirectCount(mode,indirect,drawcount,maxdrawcount,stride);}
+inline void glGetTexEnvfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXENVFVPROC)this->m_functions[406];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexEnvfv(target,pname,params);}
+inline void glColorTableParameterivSGI(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEPARAMETERIVSGIPROC)this->m_functions[407];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glColorTableParameterivSGI(target,pname,params);}
+inline void glCullFace(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLCULLFACEPROC)this->m_functions[408];if(direct_)return direct_(mode);return this->m_rawTable->glCullFace(mode);}
+inline void glDeleteFencesAPPLE(GLsizei n,const GLuint* fences)const{auto const direct_ = (FunctionTable::PFNGLDELETEFENCESAPPLEPROC)this->m_functions[409];if(direct_)return direct_(n,fences);return this->m_rawTable->glDeleteFencesAPPLE(n,fences);}
+inline void glProgramUniform4i(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4IPROC)this->m_functions[410];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4i(program,location,v0,v1,v2,v3);}
+inline void glUniformHandleui64ARB(GLint location,GLuint64 value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMHANDLEUI64ARBPROC)this->m_functions[411];if(direct_)return direct_(location,value);return this->m_rawTable->glUniformHandleui64ARB(location,value);}
+inline void glProgramUniform4f(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4FPROC)this->m_functions[412];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4f(program,location,v0,v1,v2,v3);}
+inline void glViewportIndexedf(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTINDEXEDFPROC)this->m_functions[413];if(direct_)return direct_(index,x,y,w,h);return this->m_rawTable->glViewportIndexedf(index,x,y,w,h);}
+inline void glProgramUniform4d(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4DPROC)this->m_functions[414];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4d(program,location,v0,v1,v2,v3);}
+inline void glTexCoord1xOES(GLfixed s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1XOESPROC)this->m_functions[415];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1xOES(s);}
+inline void glVertexStream3ivATI(GLenum stream,const GLint* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3IVATIPROC)this->m_functions[416];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream3ivATI(stream,coords);}
+inline GLboolean glPointAlongPathNV(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY)const{auto const direct_ = (FunctionTable::PFNGLPOINTALONGPATHNVPROC)this->m_functions[417];if(direct_)return direct_(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);return this->m_rawTable->glPointAlongPathNV(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);}
+inline void glEndQueryARB(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLENDQUERYARBPROC)this->m_functions[418];if(direct_)return direct_(target);return this->m_rawTable->glEndQueryARB(target);}
+inline void glVDPAUMapSurfacesNV(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces)const{auto const direct_ = (FunctionTable::PFNGLVDPAUMAPSURFACESNVPROC)this->m_functions[419];if(direct_)return direct_(numSurfaces,surfaces);return this->m_rawTable->glVDPAUMapSurfacesNV(numSurfaces,surfaces);}
+inline void glVertex3i(GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3IPROC)this->m_functions[420];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3i(x,y,z);}
+inline void glVertexAttrib4uivARB(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UIVARBPROC)this->m_functions[421];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4uivARB(index,v);}
+inline void glTextureStorageMem3DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGEMEM3DEXTPROC)this->m_functions[422];if(direct_)return direct_(texture,levels,internalFormat,width,height,depth,memory,offset);return this->m_rawTable->glTextureStorageMem3DEXT(texture,levels,internalFormat,width,height,depth,memory,offset);}
+inline void glAttachShader(GLuint program,GLuint shader)const{auto const direct_ = (FunctionTable::PFNGLATTACHSHADERPROC)this->m_functions[423];if(direct_)return direct_(program,shader);return this->m_rawTable->glAttachShader(program,shader);}
+inline void glColor4hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4HNVPROC)this->m_functions[424];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4hNV(red,green,blue,alpha);}
+inline void glGetFenceivNV(GLuint fence,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFENCEIVNVPROC)this->m_functions[425];if(direct_)return direct_(fence,pname,params);return this->m_rawTable->glGetFenceivNV(fence,pname,params);}
+inline void glTexCoord2fColor4ubVertex3fvSUN(const GLfloat* tc,const GLubyte* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)this->m_functions[426];if(direct_)return direct_(tc,c,v);return this->m_rawTable->glTexCoord2fColor4ubVertex3fvSUN(tc,c,v);}
+inline void glGetColorTable(GLenum target,GLenum format,GLenum type,GLvoid* table)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPROC)this->m_functions[427];if(direct_)return direct_(target,format,type,table);return this->m_rawTable->glGetColorTable(target,format,type,table);}
+inline void glFogCoordPointer(GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDPOINTERPROC)this->m_functions[428];if(direct_)return direct_(type,stride,pointer);return this->m_rawTable->glFogCoordPointer(type,stride,pointer);}
+inline void glTexStorageSparseAMD(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGESPARSEAMDPROC)this->m_functions[429];if(direct_)return direct_(target,internalFormat,width,height,depth,layers,flags);return this->m_rawTable->glTexStorageSparseAMD(target,internalFormat,width,height,depth,layers,flags);}
+inline GLboolean glUnmapNamedBuffer(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLUNMAPNAMEDBUFFERPROC)this->m_functions[430];if(direct_)return direct_(buffer);return this->m_rawTable->glUnmapNamedBuffer(buffer);}
+inline void glTexCoord4bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4BVOESPROC)this->m_functions[431];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord4bvOES(coords);}
+inline void glVertexAttrib3fARB(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FARBPROC)this->m_functions[432];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3fARB(index,x,y,z);}
+inline void glRasterPos2xOES(GLfixed x,GLfixed y)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2XOESPROC)this->m_functions[433];if(direct_)return direct_(x,y);return this->m_rawTable->glRasterPos2xOES(x,y);}
+inline void glCreateMemoryObjectsEXT(GLsizei n,GLuint* memoryObjects)const{auto const direct_ = (FunctionTable::PFNGLCREATEMEMORYOBJECTSEXTPROC)this->m_functions[434];if(direct_)return direct_(n,memoryObjects);return this->m_rawTable->glCreateMemoryObjectsEXT(n,memoryObjects);}
+inline void glColor4ubVertex2fvSUN(const GLubyte* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBVERTEX2FVSUNPROC)this->m_functions[435];if(direct_)return direct_(c,v);return this->m_rawTable->glColor4ubVertex2fvSUN(c,v);}
+inline void glSecondaryColor3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3DVPROC)this->m_functions[436];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3dv(v);}
+inline void glVertexAttribI4sv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4SVPROC)this->m_functions[437];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4sv(index,v);}
+inline void glDrawTransformFeedbackStreamInstanced(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount)const{auto const direct_ = (FunctionTable::PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)this->m_functions[438];if(direct_)return direct_(mode,id,stream,instancecount);return this->m_rawTable->glDrawTransformFeedbackStreamInstanced(mode,id,stream,instancecount);}
+inline void glMultiTexCoord4ivARB(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4IVARBPROC)this->m_functions[439];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4ivARB(target,v);}
+inline void glSpriteParameterfSGIX(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLSPRITEPARAMETERFSGIXPROC)this->m_functions[440];if(direct_)return direct_(pname,param);return this->m_rawTable->glSpriteParameterfSGIX(pname,param);}
+inline void glSecondaryColor3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3SVPROC)this->m_functions[441];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3sv(v);}
+inline void glBindVideoCaptureStreamTextureNV(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)this->m_functions[442];if(direct_)return direct_(video_capture_slot,stream,frame_region,target,texture);return this->m_rawTable->glBindVideoCaptureStreamTextureNV(video_capture_slot,stream,frame_region,target,texture);}
+inline void glTexParameterIuiv(GLenum target,GLenum pname,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIUIVPROC)this->m_functions[443];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterIuiv(target,pname,params);}
+inline void glFlushPixelDataRangeNV(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLFLUSHPIXELDATARANGENVPROC)this->m_functions[444];if(direct_)return direct_(target);return this->m_rawTable->glFlushPixelDataRangeNV(target);}
+inline void glWindowPos3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FVPROC)this->m_functions[445];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3fv(v);}
+inline void glVertexAttribLFormatNV(GLuint index,GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBLFORMATNVPROC)this->m_functions[446];if(direct_)return direct_(index,size,type,stride);return this->m_rawTable->glVertexAttribLFormatNV(index,size,type,stride);}
+inline void glLightModelfv(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELFVPROC)this->m_functions[447];if(direct_)return direct_(pname,params);return this->m_rawTable->glLightModelfv(pname,params);}
+inline void glGetColorTableSGI(GLenum target,GLenum format,GLenum type,void* table)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLESGIPROC)this->m_functions[448];if(direct_)return direct_(target,format,type,table);return this->m_rawTable->glGetColorTableSGI(target,format,type,table);}
+inline void glGetCompressedTexImageARB(GLenum target,GLint level,void* img)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)this->m_functions[449];if(direct_)return direct_(target,level,img);return this->m_rawTable->glGetCompressedTexImageARB(target,level,img);}
+inline void glConvolutionParameteri(GLenum target,GLenum pname,GLint params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERIPROC)this->m_functions[450];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameteri(target,pname,params);}
+inline void glVertexWeighthNV(GLhalfNV weight)const{auto const direct_ = (FunctionTable::PFNGLVERTEXWEIGHTHNVPROC)this->m_functions[451];if(direct_)return direct_(weight);return this->m_rawTable->glVertexWeighthNV(weight);}
+inline void glColorMaskIndexedEXT(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{auto const direct_ = (FunctionTable::PFNGLCOLORMASKINDEXEDEXTPROC)this->m_functions[452];if(direct_)return direct_(index,r,g,b,a);return this->m_rawTable->glColorMaskIndexedEXT(index,r,g,b,a);}
+inline void glColorMaski(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{auto const direct_ = (FunctionTable::PFNGLCOLORMASKIPROC)this->m_functions[453];if(direct_)return direct_(index,r,g,b,a);return this->m_rawTable->glColorMaski(index,r,g,b,a);}
+inline void glColorFragmentOp1ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{auto const direct_ = (FunctionTable::PFNGLCOLORFRAGMENTOP1ATIPROC)this->m_functions[454];if(direct_)return direct_(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);return this->m_rawTable->glColorFragmentOp1ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);}
+inline void glVertexAttribI4ubvEXT(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UBVEXTPROC)this->m_functions[455];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4ubvEXT(index,v);}
+inline void glVertexAttrib1dNV(GLuint index,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DNVPROC)this->m_functions[456];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1dNV(index,x);}
+inline void glUnmapObjectBufferATI(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLUNMAPOBJECTBUFFERATIPROC)this->m_functions[457];if(direct_)return direct_(buffer);return this->m_rawTable->glUnmapObjectBufferATI(buffer);}
+inline void glNamedProgramLocalParameterI4uiEXT(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)this->m_functions[458];if(direct_)return direct_(program,target,index,x,y,z,w);return this->m_rawTable->glNamedProgramLocalParameterI4uiEXT(program,target,index,x,y,z,w);}
+inline void glProgramUniform1iEXT(GLuint program,GLint location,GLint v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1IEXTPROC)this->m_functions[459];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1iEXT(program,location,v0);}
+inline void glDeleteQueriesARB(GLsizei n,const GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLDELETEQUERIESARBPROC)this->m_functions[460];if(direct_)return direct_(n,ids);return this->m_rawTable->glDeleteQueriesARB(n,ids);}
+inline void glWindowPos3svARB(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SVARBPROC)this->m_functions[461];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3svARB(v);}
+inline void glVertex4s(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4SPROC)this->m_functions[462];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4s(x,y,z,w);}
+inline void glImportMemoryWin32NameEXT(GLuint memory,GLuint64 size,GLenum handleType,const void* name)const{auto const direct_ = (FunctionTable::PFNGLIMPORTMEMORYWIN32NAMEEXTPROC)this->m_functions[463];if(direct_)return direct_(memory,size,handleType,name);return this->m_rawTable->glImportMemoryWin32NameEXT(memory,size,handleType,name);}
+inline void glStringMarkerGREMEDY(GLsizei len,const void* string)const{auto const direct_ = (FunctionTable::PFNGLSTRINGMARKERGREMEDYPROC)this->m_functions[464];if(direct_)return direct_(len,string);return this->m_rawTable->glStringMarkerGREMEDY(len,string);}
+inline GLboolean glIsTransformFeedback(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISTRANSFORMFEEDBACKPROC)this->m_functions[465];if(direct_)return direct_(id);return this->m_rawTable->glIsTransformFeedback(id);}
+inline void glProgramUniformMatrix2x3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)this->m_functions[466];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x3dvEXT(program,location,count,transpose,value);}
+inline void glGetObjectLabelEXT(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTLABELEXTPROC)this->m_functions[467];if(direct_)return direct_(type,object,bufSize,length,label);return this->m_rawTable->glGetObjectLabelEXT(type,object,bufSize,length,label);}
+inline void glUniformHandleui64vNV(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMHANDLEUI64VNVPROC)this->m_functions[468];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniformHandleui64vNV(location,count,value);}
+inline void glRotated(GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLROTATEDPROC)this->m_functions[469];if(direct_)return direct_(angle,x,y,z);return this->m_rawTable->glRotated(angle,x,y,z);}
+inline GLboolean glIsProgramPipeline(GLuint pipeline)const{auto const direct_ = (FunctionTable::PFNGLISPROGRAMPIPELINEPROC)this->m_functions[470];if(direct_)return direct_(pipeline);return this->m_rawTable->glIsProgramPipeline(pipeline);}
+inline void glRotatef(GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLROTATEFPROC)this->m_functions[471];if(direct_)return direct_(angle,x,y,z);return this->m_rawTable->glRotatef(angle,x,y,z);}
+inline void glVertex4i(GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4IPROC)this->m_functions[472];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4i(x,y,z,w);}
+inline void glGetActiveSubroutineUniformName(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)this->m_functions[473];if(direct_)return direct_(program,shadertype,index,bufsize,length,name);return this->m_rawTable->glGetActiveSubroutineUniformName(program,shadertype,index,bufsize,length,name);}
+inline void glVertexAttrib4sNV(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SNVPROC)this->m_functions[474];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4sNV(index,x,y,z,w);}
+inline void glProgramLocalParameter4dvARB(GLenum target,GLuint index,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETER4DVARBPROC)this->m_functions[475];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramLocalParameter4dvARB(target,index,params);}
+inline void glReplacementCodeubSUN(GLubyte code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUBSUNPROC)this->m_functions[476];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeubSUN(code);}
+inline void glMultiDrawElementsIndirectBindlessNV(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)this->m_functions[477];if(direct_)return direct_(mode,type,indirect,drawCount,stride,vertexBufferCount);return this->m_rawTable->glMultiDrawElementsIndirectBindlessNV(mode,type,indirect,drawCount,stride,vertexBufferCount);}
+inline void glImportSemaphoreWin32HandleEXT(GLuint semaphore,GLenum handleType,void* handle)const{auto const direct_ = (FunctionTable::PFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)this->m_functions[478];if(direct_)return direct_(semaphore,handleType,handle);return this->m_rawTable->glImportSemaphoreWin32HandleEXT(semaphore,handleType,handle);}
+inline void glUniformMatrix3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3FVPROC)this->m_functions[479];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3fv(location,count,transpose,value);}
+inline void glGetnMapfvARB(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPFVARBPROC)this->m_functions[480];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapfvARB(target,query,bufSize,v);}
+inline void glGetnUniformfv(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMFVPROC)this->m_functions[481];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformfv(program,location,bufSize,params);}
+inline void glVertexAttribL2dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2DVPROC)this->m_functions[482];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL2dv(index,v);}
+inline void glVertexWeightPointerEXT(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXWEIGHTPOINTEREXTPROC)this->m_functions[483];if(direct_)return direct_(size,type,stride,pointer);return this->m_rawTable->glVertexWeightPointerEXT(size,type,stride,pointer);}
+inline void glTangent3sEXT(GLshort tx,GLshort ty,GLshort tz)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3SEXTPROC)this->m_functions[484];if(direct_)return direct_(tx,ty,tz);return this->m_rawTable->glTangent3sEXT(tx,ty,tz);}
+inline void glSecondaryColorPointer(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORPOINTERPROC)this->m_functions[485];if(direct_)return direct_(size,type,stride,pointer);return this->m_rawTable->glSecondaryColorPointer(size,type,stride,pointer);}
+inline void glAlphaFunc(GLenum func,GLclampf ref)const{auto const direct_ = (FunctionTable::PFNGLALPHAFUNCPROC)this->m_functions[486];if(direct_)return direct_(func,ref);return this->m_rawTable->glAlphaFunc(func,ref);}
+inline void glGetNamedStringARB(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDSTRINGARBPROC)this->m_functions[487];if(direct_)return direct_(namelen,name,bufSize,stringlen,string);return this->m_rawTable->glGetNamedStringARB(namelen,name,bufSize,stringlen,string);}
+inline void glTexCoord4d(GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4DPROC)this->m_functions[488];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4d(s,t,r,q);}
+inline void glBufferPageCommitmentARB(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const direct_ = (FunctionTable::PFNGLBUFFERPAGECOMMITMENTARBPROC)this->m_functions[489];if(direct_)return direct_(target,offset,size,commit);return this->m_rawTable->glBufferPageCommitmentARB(target,offset,size,commit);}
+inline void glProgramLocalParameters4fvEXT(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)this->m_functions[490];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramLocalParameters4fvEXT(target,index,count,params);}
+inline void glStencilFunc(GLenum func,GLint ref,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILFUNCPROC)this->m_functions[491];if(direct_)return direct_(func,ref,mask);return this->m_rawTable->glStencilFunc(func,ref,mask);}
+inline void glSemaphoreParameterui64vEXT(GLuint semaphore,GLenum pname,const GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLSEMAPHOREPARAMETERUI64VEXTPROC)this->m_functions[492];if(direct_)return direct_(semaphore,pname,params);return this->m_rawTable->glSemaphoreParameterui64vEXT(semaphore,pname,params);}
+inline void glGetVertexAttribdvNV(GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBDVNVPROC)this->m_functions[493];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribdvNV(index,pname,params);}
+inline void glTexCoord3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3DVPROC)this->m_functions[494];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord3dv(v);}
+inline void glGetQueryBufferObjectiv(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYBUFFEROBJECTIVPROC)this->m_functions[495];if(direct_)return direct_(id,buffer,pname,offset);return this->m_rawTable->glGetQueryBufferObjectiv(id,buffer,pname,offset);}
+inline void glTexGenxOES(GLenum coord,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLTEXGENXOESPROC)this->m_functions[496];if(direct_)return direct_(coord,pname,param);return this->m_rawTable->glTexGenxOES(coord,pname,param);}
+inline void glMultiTexCoord1fvARB(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1FVARBPROC)this->m_functions[497];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1fvARB(target,v);}
+inline void glLightEnviSGIX(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTENVISGIXPROC)this->m_functions[498];if(direct_)return direct_(pname,param);return this->m_rawTable->glLightEnviSGIX(pname,param);}
+inline void glGetProgramPipelineiv(GLuint pipeline,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMPIPELINEIVPROC)this->m_functions[499];if(direct_)return direct_(pipeline,pname,params);return this->m_rawTable->glGetProgramPipelineiv(pipeline,pname,params);}
+inline void glVertexStream2ivATI(GLenum stream,const GLint* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2IVATIPROC)this->m_functions[500];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream2ivATI(stream,coords);}
+inline void glGetColorTableEXT(GLenum target,GLenum format,GLenum type,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEEXTPROC)this->m_functions[501];if(direct_)return direct_(target,format,type,data);return this->m_rawTable->glGetColorTableEXT(target,format,type,data);}
+inline void glGetShaderInfoLog(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const direct_ = (FunctionTable::PFNGLGETSHADERINFOLOGPROC)this->m_functions[502];if(direct_)return direct_(shader,bufSize,length,infoLog);return this->m_rawTable->glGetShaderInfoLog(shader,bufSize,length,infoLog);}
+inline void glGetOcclusionQueryuivNV(GLuint id,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETOCCLUSIONQUERYUIVNVPROC)this->m_functions[503];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetOcclusionQueryuivNV(id,pname,params);}
+inline void glInvalidateNamedFramebufferSubData(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)this->m_functions[504];if(direct_)return direct_(framebuffer,numAttachments,attachments,x,y,width,height);return this->m_rawTable->glInvalidateNamedFramebufferSubData(framebuffer,numAttachments,attachments,x,y,width,height);}
+inline void glVertexAttribL1i64NV(GLuint index,GLint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1I64NVPROC)this->m_functions[505];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribL1i64NV(index,x);}
+inline void glVDPAUInitNV(const void* vdpDevice,const void* getProcAddress)const{auto const direct_ = (FunctionTable::PFNGLVDPAUINITNVPROC)this->m_functions[506];if(direct_)return direct_(vdpDevice,getProcAddress);return this->m_rawTable->glVDPAUInitNV(vdpDevice,getProcAddress);}
+inline void glVertexAttrib1hvNV(GLuint index,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1HVNVPROC)this->m_functions[507];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1hvNV(index,v);}
+inline void glVertexAttribI4i(GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4IPROC)this->m_functions[508];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribI4i(index,x,y,z,w);}
+inline void glRasterPos2iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2IVPROC)this->m_functions[509];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos2iv(v);}
+inline void glGetIntegerui64i_vNV(GLenum value,GLuint index,GLuint64EXT* result)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGERUI64I_VNVPROC)this->m_functions[510];if(direct_)return direct_(value,index,result);return this->m_rawTable->glGetIntegerui64i_vNV(value,index,result);}
+inline void glUniformHandleui64NV(GLint location,GLuint64 value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMHANDLEUI64NVPROC)this->m_functions[511];if(direct_)return direct_(location,value);return this->m_rawTable->glUniformHandleui64NV(location,value);}
+inline void glWindowPos3ivMESA(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IVMESAPROC)this->m_functions[512];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3ivMESA(v);}
+inline void glBlendEquationSeparate(GLenum modeRGB,GLenum modeAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEPROC)this->m_functions[513];if(direct_)return direct_(modeRGB,modeAlpha);return this->m_rawTable->glBlendEquationSeparate(modeRGB,modeAlpha);}
+inline void glDrawElementsInstancedARB(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDARBPROC)this->m_functions[514];if(direct_)return direct_(mode,count,type,indices,primcount);return this->m_rawTable->glDrawElementsInstancedARB(mode,count,type,indices,primcount);}
+inline GLuint glGetSubroutineIndex(GLuint program,GLenum shadertype,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETSUBROUTINEINDEXPROC)this->m_functions[515];if(direct_)return direct_(program,shadertype,name);return this->m_rawTable->glGetSubroutineIndex(program,shadertype,name);}
+inline void glVertexAttrib2sv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SVPROC)this->m_functions[516];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2sv(index,v);}
+inline void glSamplePatternSGIS(GLenum pattern)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEPATTERNSGISPROC)this->m_functions[517];if(direct_)return direct_(pattern);return this->m_rawTable->glSamplePatternSGIS(pattern);}
+inline void glEGLImageTargetRenderbufferStorageOES(GLenum target,GLeglImageOES image)const{auto const direct_ = (FunctionTable::PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)this->m_functions[518];if(direct_)return direct_(target,image);return this->m_rawTable->glEGLImageTargetRenderbufferStorageOES(target,image);}
+inline void glPushAttrib(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLPUSHATTRIBPROC)this->m_functions[519];if(direct_)return direct_(mask);return this->m_rawTable->glPushAttrib(mask);}
+inline void glVertex3hNV(GLhalfNV x,GLhalfNV y,GLhalfNV z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3HNVPROC)this->m_functions[520];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3hNV(x,y,z);}
+inline void glRasterPos3xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3XVOESPROC)this->m_functions[521];if(direct_)return direct_(coords);return this->m_rawTable->glRasterPos3xvOES(coords);}
+inline void glPathParameterfNV(GLuint path,GLenum pname,GLfloat value)const{auto const direct_ = (FunctionTable::PFNGLPATHPARAMETERFNVPROC)this->m_functions[522];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glPathParameterfNV(path,pname,value);}
+inline void glGetUniformi64vNV(GLuint program,GLint location,GLint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMI64VNVPROC)this->m_functions[523];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformi64vNV(program,location,params);}
+inline void glLightiv(GLenum light,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLLIGHTIVPROC)this->m_functions[524];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glLightiv(light,pname,params);}
+inline void glMaterialxvOES(GLenum face,GLenum pname,const GLfixed* param)const{auto const direct_ = (FunctionTable::PFNGLMATERIALXVOESPROC)this->m_functions[525];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glMaterialxvOES(face,pname,param);}
+inline void glNamedProgramLocalParameter4fEXT(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)this->m_functions[526];if(direct_)return direct_(program,target,index,x,y,z,w);return this->m_rawTable->glNamedProgramLocalParameter4fEXT(program,target,index,x,y,z,w);}
+inline void glVertexAttribL1dEXT(GLuint index,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1DEXTPROC)this->m_functions[527];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribL1dEXT(index,x);}
+inline void glGetnUniformdvARB(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMDVARBPROC)this->m_functions[528];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformdvARB(program,location,bufSize,params);}
+inline void glSecondaryColor3bEXT(GLbyte red,GLbyte green,GLbyte blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3BEXTPROC)this->m_functions[529];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3bEXT(red,green,blue);}
+inline void glBeginPerfQueryINTEL(GLuint queryHandle)const{auto const direct_ = (FunctionTable::PFNGLBEGINPERFQUERYINTELPROC)this->m_functions[530];if(direct_)return direct_(queryHandle);return this->m_rawTable->glBeginPerfQueryINTEL(queryHandle);}
+inline void glProgramUniform1uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UIVEXTPROC)this->m_functions[531];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1uivEXT(program,location,count,value);}
+inline void glImageTransformParameterivHP(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLIMAGETRANSFORMPARAMETERIVHPPROC)this->m_functions[532];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glImageTransformParameterivHP(target,pname,params);}
+inline void glDeleteBuffers(GLsizei n,const GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLDELETEBUFFERSPROC)this->m_functions[533];if(direct_)return direct_(n,buffers);return this->m_rawTable->glDeleteBuffers(n,buffers);}
+inline void glBindProgramPipeline(GLuint pipeline)const{auto const direct_ = (FunctionTable::PFNGLBINDPROGRAMPIPELINEPROC)this->m_functions[534];if(direct_)return direct_(pipeline);return this->m_rawTable->glBindProgramPipeline(pipeline);}
+inline void glScissor(GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLSCISSORPROC)this->m_functions[535];if(direct_)return direct_(x,y,width,height);return this->m_rawTable->glScissor(x,y,width,height);}
+inline void glProgramUniform4fv(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4FVPROC)this->m_functions[536];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4fv(program,location,count,value);}
+inline void glGetBooleanv(GLenum pname,GLboolean* params)const{auto const direct_ = (FunctionTable::PFNGLGETBOOLEANVPROC)this->m_functions[537];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetBooleanv(pname,params);}
+inline void glMaterialfv(GLenum face,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLMATERIALFVPROC)this->m_functions[538];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glMaterialfv(face,pname,params);}
+inline void glWindowPos4fvMESA(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4FVMESAPROC)this->m_functions[539];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos4fvMESA(v);}
+inline void glVertexAttribIPointerEXT(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBIPOINTEREXTPROC)this->m_functions[540];if(direct_)return direct_(index,size,type,stride,pointer);return this->m_rawTable->glVertexAttribIPointerEXT(index,size,type,stride,pointer);}
+inline void glProgramBufferParametersfvNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)this->m_functions[541];if(direct_)return direct_(target,bindingIndex,wordIndex,count,params);return this->m_rawTable->glProgramBufferParametersfvNV(target,bindingIndex,wordIndex,count,params);}
+inline void glAlphaFuncxOES(GLenum func,GLfixed ref)const{auto const direct_ = (FunctionTable::PFNGLALPHAFUNCXOESPROC)this->m_functions[542];if(direct_)return direct_(func,ref);return this->m_rawTable->glAlphaFuncxOES(func,ref);}
+inline void glMultiDrawArraysIndirectAMD(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)this->m_functions[543];if(direct_)return direct_(mode,indirect,primcount,stride);return this->m_rawTable->glMultiDrawArraysIndirectAMD(mode,indirect,primcount,stride);}
+inline void glNormalStream3ivATI(GLenum stream,const GLint* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3IVATIPROC)this->m_functions[544];if(direct_)return direct_(stream,coords);return this->m_rawTable->glNormalStream3ivATI(stream,coords);}
+inline void glTextureImage3DMultisampleNV(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)this->m_functions[545];if(direct_)return direct_(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);return this->m_rawTable->glTextureImage3DMultisampleNV(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);}
+inline void glProgramUniform4uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UIVEXTPROC)this->m_functions[546];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4uivEXT(program,location,count,value);}
+inline void glReplacementCodeusvSUN(const GLushort* code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUSVSUNPROC)this->m_functions[547];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeusvSUN(code);}
+inline GLint glPollInstrumentsSGIX(GLint* marker_p)const{auto const direct_ = (FunctionTable::PFNGLPOLLINSTRUMENTSSGIXPROC)this->m_functions[548];if(direct_)return direct_(marker_p);return this->m_rawTable->glPollInstrumentsSGIX(marker_p);}
+inline void glGetTextureLevelParameteriv(GLuint texture,GLint level,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURELEVELPARAMETERIVPROC)this->m_functions[549];if(direct_)return direct_(texture,level,pname,params);return this->m_rawTable->glGetTextureLevelParameteriv(texture,level,pname,params);}
+inline void glVertexAttribI2uiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2UIVPROC)this->m_functions[550];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI2uiv(index,v);}
+inline void glMapControlPointsNV(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points)const{auto const direct_ = (FunctionTable::PFNGLMAPCONTROLPOINTSNVPROC)this->m_functions[551];if(direct_)return direct_(target,index,type,ustride,vstride,uorder,vorder,packed,points);return this->m_rawTable->glMapControlPointsNV(target,index,type,ustride,vstride,uorder,vorder,packed,points);}
+inline void glColor4dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4DVPROC)this->m_functions[552];if(direct_)return direct_(v);return this->m_rawTable->glColor4dv(v);}
+inline void glInvalidateBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATEBUFFERSUBDATAPROC)this->m_functions[553];if(direct_)return direct_(buffer,offset,length);return this->m_rawTable->glInvalidateBufferSubData(buffer,offset,length);}
+inline void glMultiTexCoord1hNV(GLenum target,GLhalfNV s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1HNVPROC)this->m_functions[554];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1hNV(target,s);}
+inline void glPointParameterfv(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFVPROC)this->m_functions[555];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterfv(pname,params);}
+inline void glUniformMatrix2fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2FVARBPROC)this->m_functions[556];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2fvARB(location,count,transpose,value);}
+inline void glUniform2fv(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2FVPROC)this->m_functions[557];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2fv(location,count,value);}
+inline void glVertexPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXPOINTERLISTIBMPROC)this->m_functions[558];if(direct_)return direct_(size,type,stride,pointer,ptrstride);return this->m_rawTable->glVertexPointerListIBM(size,type,stride,pointer,ptrstride);}
+inline void glGetMultiTexGenfvEXT(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXGENFVEXTPROC)this->m_functions[559];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glGetMultiTexGenfvEXT(texunit,coord,pname,params);}
+inline void glGetMinmaxEXT(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXEXTPROC)this->m_functions[560];if(direct_)return direct_(target,reset,format,type,values);return this->m_rawTable->glGetMinmaxEXT(target,reset,format,type,values);}
+inline GLboolean glIsFenceNV(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLISFENCENVPROC)this->m_functions[561];if(direct_)return direct_(fence);return this->m_rawTable->glIsFenceNV(fence);}
+inline void glMatrixFrustumEXT(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{auto const direct_ = (FunctionTable::PFNGLMATRIXFRUSTUMEXTPROC)this->m_functions[562];if(direct_)return direct_(mode,left,right,bottom,top,zNear,zFar);return this->m_rawTable->glMatrixFrustumEXT(mode,left,right,bottom,top,zNear,zFar);}
+inline void glDispatchComputeIndirect(GLintptr indirect)const{auto const direct_ = (FunctionTable::PFNGLDISPATCHCOMPUTEINDIRECTPROC)this->m_functions[563];if(direct_)return direct_(indirect);return this->m_rawTable->glDispatchComputeIndirect(indirect);}
+inline GLint glQueryResourceNV(GLenum queryType,GLint tagId,GLuint bufSize,GLint* buffer)const{auto const direct_ = (FunctionTable::PFNGLQUERYRESOURCENVPROC)this->m_functions[564];if(direct_)return direct_(queryType,tagId,bufSize,buffer);return this->m_rawTable->glQueryResourceNV(queryType,tagId,bufSize,buffer);}
+inline void glMultiTexCoord4bOES(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4BOESPROC)this->m_functions[565];if(direct_)return direct_(texture,s,t,r,q);return this->m_rawTable->glMultiTexCoord4bOES(texture,s,t,r,q);}
+inline void glProgramEnvParameter4dARB(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETER4DARBPROC)this->m_functions[566];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramEnvParameter4dARB(target,index,x,y,z,w);}
+inline void glProgramUniform1uiEXT(GLuint program,GLint location,GLuint v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UIEXTPROC)this->m_functions[567];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1uiEXT(program,location,v0);}
+inline void glBindBufferRange(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERRANGEPROC)this->m_functions[568];if(direct_)return direct_(target,index,buffer,offset,size);return this->m_rawTable->glBindBufferRange(target,index,buffer,offset,size);}
+inline void glNormal3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3IVPROC)this->m_functions[569];if(direct_)return direct_(v);return this->m_rawTable->glNormal3iv(v);}
+inline void glVertexAttribL3dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3DVPROC)this->m_functions[570];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL3dv(index,v);}
+inline void glGetUniformdv(GLuint program,GLint location,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMDVPROC)this->m_functions[571];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformdv(program,location,params);}
+inline void glGetMultiTexLevelParameterfvEXT(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)this->m_functions[572];if(direct_)return direct_(texunit,target,level,pname,params);return this->m_rawTable->glGetMultiTexLevelParameterfvEXT(texunit,target,level,pname,params);}
+inline void glFinalCombinerInputNV(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{auto const direct_ = (FunctionTable::PFNGLFINALCOMBINERINPUTNVPROC)this->m_functions[573];if(direct_)return direct_(variable,input,mapping,componentUsage);return this->m_rawTable->glFinalCombinerInputNV(variable,input,mapping,componentUsage);}
+inline void glCullParameterdvEXT(GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLCULLPARAMETERDVEXTPROC)this->m_functions[574];if(direct_)return direct_(pname,params);return this->m_rawTable->glCullParameterdvEXT(pname,params);}
+inline void glMultiTexCoord4s(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4SPROC)this->m_functions[575];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4s(target,s,t,r,q);}
+inline void glMapVertexAttrib1fAPPLE(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLMAPVERTEXATTRIB1FAPPLEPROC)this->m_functions[576];if(direct_)return direct_(index,size,u1,u2,stride,order,points);return this->m_rawTable->glMapVertexAttrib1fAPPLE(index,size,u1,u2,stride,order,points);}
+inline void glConvolutionParameterfEXT(GLenum target,GLenum pname,GLfloat params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERFEXTPROC)this->m_functions[577];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterfEXT(target,pname,params);}
+inline void glTexCoord1iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1IVPROC)this->m_functions[578];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord1iv(v);}
+inline void glProgramUniform3fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3FVEXTPROC)this->m_functions[579];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3fvEXT(program,location,count,value);}
+inline void glColor3uiv(const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3UIVPROC)this->m_functions[580];if(direct_)return direct_(v);return this->m_rawTable->glColor3uiv(v);}
+inline void glRenderGpuMaskNV(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLRENDERGPUMASKNVPROC)this->m_functions[581];if(direct_)return direct_(mask);return this->m_rawTable->glRenderGpuMaskNV(mask);}
+inline void glListBase(GLuint base)const{auto const direct_ = (FunctionTable::PFNGLLISTBASEPROC)this->m_functions[582];if(direct_)return direct_(base);return this->m_rawTable->glListBase(base);}
+inline void glTexCoord2bOES(GLbyte s,GLbyte t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2BOESPROC)this->m_functions[583];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2bOES(s,t);}
+inline GLuint glBindMaterialParameterEXT(GLenum face,GLenum value)const{auto const direct_ = (FunctionTable::PFNGLBINDMATERIALPARAMETEREXTPROC)this->m_functions[584];if(direct_)return direct_(face,value);return this->m_rawTable->glBindMaterialParameterEXT(face,value);}
+inline void glGlobalAlphaFactorubSUN(GLubyte factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORUBSUNPROC)this->m_functions[585];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactorubSUN(factor);}
+inline void glVertexAttribL1ui64NV(GLuint index,GLuint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1UI64NVPROC)this->m_functions[586];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribL1ui64NV(index,x);}
+inline void glPointParameterfSGIS(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFSGISPROC)this->m_functions[587];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameterfSGIS(pname,param);}
+inline void glGetImageTransformParameterivHP(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)this->m_functions[588];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetImageTransformParameterivHP(target,pname,params);}
+inline void glColorSubTableEXT(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOLORSUBTABLEEXTPROC)this->m_functions[589];if(direct_)return direct_(target,start,count,format,type,data);return this->m_rawTable->glColorSubTableEXT(target,start,count,format,type,data);}
+inline void glPixelTexGenParameterfvSGIS(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPIXELTEXGENPARAMETERFVSGISPROC)this->m_functions[590];if(direct_)return direct_(pname,params);return this->m_rawTable->glPixelTexGenParameterfvSGIS(pname,params);}
+inline GLenum glClientWaitSync(GLsync sync,GLbitfield flags,GLuint64 timeout)const{auto const direct_ = (FunctionTable::PFNGLCLIENTWAITSYNCPROC)this->m_functions[591];if(direct_)return direct_(sync,flags,timeout);return this->m_rawTable->glClientWaitSync(sync,flags,timeout);}
+inline void glQueryObjectParameteruiAMD(GLenum target,GLuint id,GLenum pname,GLuint param)const{auto const direct_ = (FunctionTable::PFNGLQUERYOBJECTPARAMETERUIAMDPROC)this->m_functions[592];if(direct_)return direct_(target,id,pname,param);return this->m_rawTable->glQueryObjectParameteruiAMD(target,id,pname,param);}
+inline void glVertexAttribs1fvNV(GLuint index,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS1FVNVPROC)this->m_functions[593];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs1fvNV(index,count,v);}
+inline void glVertexAttrib4NusvARB(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUSVARBPROC)this->m_functions[594];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NusvARB(index,v);}
+inline void glVariantPointerEXT(GLuint id,GLenum type,GLuint stride,const void* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTPOINTEREXTPROC)this->m_functions[595];if(direct_)return direct_(id,type,stride,addr);return this->m_rawTable->glVariantPointerEXT(id,type,stride,addr);}
+inline void glTextureBuffer(GLuint texture,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBUFFERPROC)this->m_functions[596];if(direct_)return direct_(texture,internalformat,buffer);return this->m_rawTable->glTextureBuffer(texture,internalformat,buffer);}
+inline void glVertexAttribI1uiEXT(GLuint index,GLuint x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1UIEXTPROC)this->m_functions[597];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribI1uiEXT(index,x);}
+inline void glInvalidateTexImage(GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATETEXIMAGEPROC)this->m_functions[598];if(direct_)return direct_(texture,level);return this->m_rawTable->glInvalidateTexImage(texture,level);}
+inline void glProgramEnvParametersI4ivNV(GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERSI4IVNVPROC)this->m_functions[599];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramEnvParametersI4ivNV(target,index,count,params);}
+inline GLenum glPathGlyphIndexArrayNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const direct_ = (FunctionTable::PFNGLPATHGLYPHINDEXARRAYNVPROC)this->m_functions[600];if(direct_)return direct_(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);return this->m_rawTable->glPathGlyphIndexArrayNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+inline void glCopyImageSubData(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{auto const direct_ = (FunctionTable::PFNGLCOPYIMAGESUBDATAPROC)this->m_functions[601];if(direct_)return direct_(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);return this->m_rawTable->glCopyImageSubData(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+inline void glGetUniformSubroutineuiv(GLenum shadertype,GLint location,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMSUBROUTINEUIVPROC)this->m_functions[602];if(direct_)return direct_(shadertype,location,params);return this->m_rawTable->glGetUniformSubroutineuiv(shadertype,location,params);}
+inline void glBindVertexBuffer(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLBINDVERTEXBUFFERPROC)this->m_functions[603];if(direct_)return direct_(bindingindex,buffer,offset,stride);return this->m_rawTable->glBindVertexBuffer(bindingindex,buffer,offset,stride);}
+inline void glMultiTexCoord1iARB(GLenum target,GLint s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1IARBPROC)this->m_functions[604];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1iARB(target,s);}
+inline void glDebugMessageInsert(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGEINSERTPROC)this->m_functions[605];if(direct_)return direct_(source,type,id,severity,length,buf);return this->m_rawTable->glDebugMessageInsert(source,type,id,severity,length,buf);}
+inline void glBeginVertexShaderEXT()const{auto const direct_ = (FunctionTable::PFNGLBEGINVERTEXSHADEREXTPROC)this->m_functions[606];if(direct_)return direct_();return this->m_rawTable->glBeginVertexShaderEXT();}
+inline GLboolean glIsVariantEnabledEXT(GLuint id,GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLISVARIANTENABLEDEXTPROC)this->m_functions[607];if(direct_)return direct_(id,cap);return this->m_rawTable->glIsVariantEnabledEXT(id,cap);}
+inline void glPassThroughxOES(GLfixed token)const{auto const direct_ = (FunctionTable::PFNGLPASSTHROUGHXOESPROC)this->m_functions[608];if(direct_)return direct_(token);return this->m_rawTable->glPassThroughxOES(token);}
+inline GLboolean glIsSampler(GLuint sampler)const{auto const direct_ = (FunctionTable::PFNGLISSAMPLERPROC)this->m_functions[609];if(direct_)return direct_(sampler);return this->m_rawTable->glIsSampler(sampler);}
+inline void glConservativeRasterParameterfNV(GLenum pname,GLfloat value)const{auto const direct_ = (FunctionTable::PFNGLCONSERVATIVERASTERPARAMETERFNVPROC)this->m_functions[610];if(direct_)return direct_(pname,value);return this->m_rawTable->glConservativeRasterParameterfNV(pname,value);}
+inline void glMultiTexGenivEXT(GLenum texunit,GLenum coord,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENIVEXTPROC)this->m_functions[611];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glMultiTexGenivEXT(texunit,coord,pname,params);}
+inline void glNamedFramebufferTexture2DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)this->m_functions[612];if(direct_)return direct_(framebuffer,attachment,textarget,texture,level);return this->m_rawTable->glNamedFramebufferTexture2DEXT(framebuffer,attachment,textarget,texture,level);}
+inline void glCopyTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE1DPROC)this->m_functions[613];if(direct_)return direct_(target,level,xoffset,x,y,width);return this->m_rawTable->glCopyTexSubImage1D(target,level,xoffset,x,y,width);}
+inline void glTexCoord1i(GLint s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1IPROC)this->m_functions[614];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1i(s);}
+inline GLenum glCheckFramebufferStatus(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLCHECKFRAMEBUFFERSTATUSPROC)this->m_functions[615];if(direct_)return direct_(target);return this->m_rawTable->glCheckFramebufferStatus(target);}
+inline void glDrawElementArrayAPPLE(GLenum mode,GLint first,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTARRAYAPPLEPROC)this->m_functions[616];if(direct_)return direct_(mode,first,count);return this->m_rawTable->glDrawElementArrayAPPLE(mode,first,count);}
+inline void glTexCoord1d(GLdouble s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1DPROC)this->m_functions[617];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1d(s);}
+inline void glTexCoord1f(GLfloat s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1FPROC)this->m_functions[618];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1f(s);}
+inline void glFragmentLightivSGIX(GLenum light,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTIVSGIXPROC)this->m_functions[619];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glFragmentLightivSGIX(light,pname,params);}
+inline void glBindImageTexture(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format)const{auto const direct_ = (FunctionTable::PFNGLBINDIMAGETEXTUREPROC)this->m_functions[620];if(direct_)return direct_(unit,texture,level,layered,layer,access,format);return this->m_rawTable->glBindImageTexture(unit,texture,level,layered,layer,access,format);}
+inline void glTransformFeedbackVaryings(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKVARYINGSPROC)this->m_functions[621];if(direct_)return direct_(program,count,varyings,bufferMode);return this->m_rawTable->glTransformFeedbackVaryings(program,count,varyings,bufferMode);}
+inline void glMulticastBufferSubDataNV(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTBUFFERSUBDATANVPROC)this->m_functions[622];if(direct_)return direct_(gpuMask,buffer,offset,size,data);return this->m_rawTable->glMulticastBufferSubDataNV(gpuMask,buffer,offset,size,data);}
+inline void glDrawRangeElements(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices)const{auto const direct_ = (FunctionTable::PFNGLDRAWRANGEELEMENTSPROC)this->m_functions[623];if(direct_)return direct_(mode,start,end,count,type,indices);return this->m_rawTable->glDrawRangeElements(mode,start,end,count,type,indices);}
+inline void glTexCoord1s(GLshort s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1SPROC)this->m_functions[624];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1s(s);}
+inline void glBindBufferBase(GLenum target,GLuint index,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERBASEPROC)this->m_functions[625];if(direct_)return direct_(target,index,buffer);return this->m_rawTable->glBindBufferBase(target,index,buffer);}
+inline void glColor3bv(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3BVPROC)this->m_functions[626];if(direct_)return direct_(v);return this->m_rawTable->glColor3bv(v);}
+inline void glSyncTextureINTEL(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLSYNCTEXTUREINTELPROC)this->m_functions[627];if(direct_)return direct_(texture);return this->m_rawTable->glSyncTextureINTEL(texture);}
+inline void glCreateSamplers(GLsizei n,GLuint* samplers)const{auto const direct_ = (FunctionTable::PFNGLCREATESAMPLERSPROC)this->m_functions[628];if(direct_)return direct_(n,samplers);return this->m_rawTable->glCreateSamplers(n,samplers);}
+inline void glCombinerParameterfNV(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERPARAMETERFNVPROC)this->m_functions[629];if(direct_)return direct_(pname,param);return this->m_rawTable->glCombinerParameterfNV(pname,param);}
+inline void glGetArrayObjectivATI(GLenum array,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETARRAYOBJECTIVATIPROC)this->m_functions[630];if(direct_)return direct_(array,pname,params);return this->m_rawTable->glGetArrayObjectivATI(array,pname,params);}
+inline void glMultiDrawArrays(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSPROC)this->m_functions[631];if(direct_)return direct_(mode,first,count,drawcount);return this->m_rawTable->glMultiDrawArrays(mode,first,count,drawcount);}
+inline void glSampleMapATI(GLuint dst,GLuint interp,GLenum swizzle)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEMAPATIPROC)this->m_functions[632];if(direct_)return direct_(dst,interp,swizzle);return this->m_rawTable->glSampleMapATI(dst,interp,swizzle);}
+inline void glProgramUniform2i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2I64ARBPROC)this->m_functions[633];if(direct_)return direct_(program,location,x,y);return this->m_rawTable->glProgramUniform2i64ARB(program,location,x,y);}
+inline void glBinormal3ivEXT(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3IVEXTPROC)this->m_functions[634];if(direct_)return direct_(v);return this->m_rawTable->glBinormal3ivEXT(v);}
+inline void glMultiDrawArraysIndirectCountARB(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)this->m_functions[635];if(direct_)return direct_(mode,indirect,drawcount,maxdrawcount,stride);return this->m_rawTable->glMultiDrawArraysIndirectCountARB(mode,indirect,drawcount,maxdrawcount,stride);}
+inline void glTextureStorageMem1DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGEMEM1DEXTPROC)this->m_functions[636];if(direct_)return direct_(texture,levels,internalFormat,width,memory,offset);return this->m_rawTable->glTextureStorageMem1DEXT(texture,levels,internalFormat,width,memory,offset);}
+inline void glWindowPos2ivMESA(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IVMESAPROC)this->m_functions[637];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2ivMESA(v);}
+inline void glTexCoordP4ui(GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP4UIPROC)this->m_functions[638];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP4ui(type,coords);}
+inline void glMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXSUBIMAGE1DEXTPROC)this->m_functions[639];if(direct_)return direct_(texunit,target,level,xoffset,width,format,type,pixels);return this->m_rawTable->glMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,type,pixels);}
+inline void glProgramUniformMatrix2x3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)this->m_functions[640];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x3fvEXT(program,location,count,transpose,value);}
+inline void glBufferDataARB(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage)const{auto const direct_ = (FunctionTable::PFNGLBUFFERDATAARBPROC)this->m_functions[641];if(direct_)return direct_(target,size,data,usage);return this->m_rawTable->glBufferDataARB(target,size,data,usage);}
+inline void glVertexAttribIFormat(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBIFORMATPROC)this->m_functions[642];if(direct_)return direct_(attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexAttribIFormat(attribindex,size,type,relativeoffset);}
+inline void glCreateFramebuffers(GLsizei n,GLuint* framebuffers)const{auto const direct_ = (FunctionTable::PFNGLCREATEFRAMEBUFFERSPROC)this->m_functions[643];if(direct_)return direct_(n,framebuffers);return this->m_rawTable->glCreateFramebuffers(n,framebuffers);}
+inline void glNormalStream3dvATI(GLenum stream,const GLdouble* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3DVATIPROC)this->m_functions[644];if(direct_)return direct_(stream,coords);return this->m_rawTable->glNormalStream3dvATI(stream,coords);}
+inline void glClearAccum(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARACCUMPROC)this->m_functions[645];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearAccum(red,green,blue,alpha);}
+inline void glUniform3i64vNV(GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3I64VNVPROC)this->m_functions[646];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3i64vNV(location,count,value);}
+inline void glNormal3fVertex3fSUN(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3FVERTEX3FSUNPROC)this->m_functions[647];if(direct_)return direct_(nx,ny,nz,x,y,z);return this->m_rawTable->glNormal3fVertex3fSUN(nx,ny,nz,x,y,z);}
+inline void glUniform2uivEXT(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UIVEXTPROC)this->m_functions[648];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2uivEXT(location,count,value);}
+inline void glBeginQuery(GLenum target,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBEGINQUERYPROC)this->m_functions[649];if(direct_)return direct_(target,id);return this->m_rawTable->glBeginQuery(target,id);}
+inline void glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)this->m_functions[650];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);return this->m_rawTable->glStencilThenCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);}
+inline void glBindBuffer(GLenum target,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERPROC)this->m_functions[651];if(direct_)return direct_(target,buffer);return this->m_rawTable->glBindBuffer(target,buffer);}
+inline void glMap2d(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{auto const direct_ = (FunctionTable::PFNGLMAP2DPROC)this->m_functions[652];if(direct_)return direct_(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);return this->m_rawTable->glMap2d(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+inline void glMap2f(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLMAP2FPROC)this->m_functions[653];if(direct_)return direct_(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);return this->m_rawTable->glMap2f(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+inline void glMakeImageHandleResidentNV(GLuint64 handle,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAKEIMAGEHANDLERESIDENTNVPROC)this->m_functions[654];if(direct_)return direct_(handle,access);return this->m_rawTable->glMakeImageHandleResidentNV(handle,access);}
+inline void glUniformMatrix2x4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2X4FVPROC)this->m_functions[655];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2x4fv(location,count,transpose,value);}
+inline void glGetMultiTexParameterfvEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXPARAMETERFVEXTPROC)this->m_functions[656];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexParameterfvEXT(texunit,target,pname,params);}
+inline void glDepthRangeIndexed(GLuint index,GLdouble n,GLdouble f)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEINDEXEDPROC)this->m_functions[657];if(direct_)return direct_(index,n,f);return this->m_rawTable->glDepthRangeIndexed(index,n,f);}
+inline GLboolean glIsEnabled(GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLISENABLEDPROC)this->m_functions[658];if(direct_)return direct_(cap);return this->m_rawTable->glIsEnabled(cap);}
+inline void glMatrixScalefEXT(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXSCALEFEXTPROC)this->m_functions[659];if(direct_)return direct_(mode,x,y,z);return this->m_rawTable->glMatrixScalefEXT(mode,x,y,z);}
+inline GLenum glGetError()const{auto const direct_ = (FunctionTable::PFNGLGETERRORPROC)this->m_functions[660];if(direct_)return direct_();return this->m_rawTable->glGetError();}
+inline void glGetTexEnviv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXENVIVPROC)this->m_functions[661];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexEnviv(target,pname,params);}
+inline GLuint glBindTextureUnitParameterEXT(GLenum unit,GLenum value)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXTUREUNITPARAMETEREXTPROC)this->m_functions[662];if(direct_)return direct_(unit,value);return this->m_rawTable->glBindTextureUnitParameterEXT(unit,value);}
+inline void glGetnUniformfvARB(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMFVARBPROC)this->m_functions[663];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformfvARB(program,location,bufSize,params);}
+inline void glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)this->m_functions[664];if(direct_)return direct_(rc,n,v);return this->m_rawTable->glReplacementCodeuiNormal3fVertex3fvSUN(rc,n,v);}
+inline void glDeletePerfQueryINTEL(GLuint queryHandle)const{auto const direct_ = (FunctionTable::PFNGLDELETEPERFQUERYINTELPROC)this->m_functions[665];if(direct_)return direct_(queryHandle);return this->m_rawTable->glDeletePerfQueryINTEL(queryHandle);}
+inline void glActiveVaryingNV(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLACTIVEVARYINGNVPROC)this->m_functions[666];if(direct_)return direct_(program,name);return this->m_rawTable->glActiveVaryingNV(program,name);}
+inline void glGetActiveUniformARB(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMARBPROC)this->m_functions[667];if(direct_)return direct_(programObj,index,maxLength,length,size,type,name);return this->m_rawTable->glGetActiveUniformARB(programObj,index,maxLength,length,size,type,name);}
+inline void glVertexAttribI3ivEXT(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3IVEXTPROC)this->m_functions[668];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI3ivEXT(index,v);}
+inline void glEvalCoord1d(GLdouble u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1DPROC)this->m_functions[669];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord1d(u);}
+inline void glNamedCopyBufferSubDataEXT(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)this->m_functions[670];if(direct_)return direct_(readBuffer,writeBuffer,readOffset,writeOffset,size);return this->m_rawTable->glNamedCopyBufferSubDataEXT(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+inline void glEvalCoord1f(GLfloat u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1FPROC)this->m_functions[671];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord1f(u);}
+inline void glPixelMapfv(GLenum map,GLsizei mapsize,const GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLPIXELMAPFVPROC)this->m_functions[672];if(direct_)return direct_(map,mapsize,values);return this->m_rawTable->glPixelMapfv(map,mapsize,values);}
+inline void glVertexAttribI1ivEXT(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1IVEXTPROC)this->m_functions[673];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI1ivEXT(index,v);}
+inline GLsync glCreateSyncFromCLeventARB(struct _cl_context* context,struct _cl_event* event,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLCREATESYNCFROMCLEVENTARBPROC)this->m_functions[674];if(direct_)return direct_(context,event,flags);return this->m_rawTable->glCreateSyncFromCLeventARB(context,event,flags);}
+inline void glGetPixelMapusv(GLenum map,GLushort* values)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELMAPUSVPROC)this->m_functions[675];if(direct_)return direct_(map,values);return this->m_rawTable->glGetPixelMapusv(map,values);}
+inline void glGetnColorTableARB(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{auto const direct_ = (FunctionTable::PFNGLGETNCOLORTABLEARBPROC)this->m_functions[676];if(direct_)return direct_(target,format,type,bufSize,table);return this->m_rawTable->glGetnColorTableARB(target,format,type,bufSize,table);}
+inline void glAccum(GLenum op,GLfloat value)const{auto const direct_ = (FunctionTable::PFNGLACCUMPROC)this->m_functions[677];if(direct_)return direct_(op,value);return this->m_rawTable->glAccum(op,value);}
+inline void glRasterPos3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3SVPROC)this->m_functions[678];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos3sv(v);}
+inline void glTexCoord2iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2IVPROC)this->m_functions[679];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord2iv(v);}
+inline void glBlendFunciARB(GLuint buf,GLenum src,GLenum dst)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCIARBPROC)this->m_functions[680];if(direct_)return direct_(buf,src,dst);return this->m_rawTable->glBlendFunciARB(buf,src,dst);}
+inline void glProgramUniform3i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3I64VARBPROC)this->m_functions[681];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3i64vARB(program,location,count,value);}
+inline void glGetFramebufferAttachmentParameteriv(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)this->m_functions[682];if(direct_)return direct_(target,attachment,pname,params);return this->m_rawTable->glGetFramebufferAttachmentParameteriv(target,attachment,pname,params);}
+inline void glProgramUniform4ui(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UIPROC)this->m_functions[683];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4ui(program,location,v0,v1,v2,v3);}
+inline void glStencilMask(GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILMASKPROC)this->m_functions[684];if(direct_)return direct_(mask);return this->m_rawTable->glStencilMask(mask);}
+inline void glResetHistogramEXT(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLRESETHISTOGRAMEXTPROC)this->m_functions[685];if(direct_)return direct_(target);return this->m_rawTable->glResetHistogramEXT(target);}
+inline void glLightxOES(GLenum light,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTXOESPROC)this->m_functions[686];if(direct_)return direct_(light,pname,param);return this->m_rawTable->glLightxOES(light,pname,param);}
+inline void glNamedBufferData(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERDATAPROC)this->m_functions[687];if(direct_)return direct_(buffer,size,data,usage);return this->m_rawTable->glNamedBufferData(buffer,size,data,usage);}
+inline void glVertexStream3sATI(GLenum stream,GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3SATIPROC)this->m_functions[688];if(direct_)return direct_(stream,x,y,z);return this->m_rawTable->glVertexStream3sATI(stream,x,y,z);}
+inline void glVertexAttrib3fvARB(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FVARBPROC)this->m_functions[689];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3fvARB(index,v);}
+inline void glClearNamedBufferSubData(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDBUFFERSUBDATAPROC)this->m_functions[690];if(direct_)return direct_(buffer,internalformat,offset,size,format,type,data);return this->m_rawTable->glClearNamedBufferSubData(buffer,internalformat,offset,size,format,type,data);}
+inline void glProgramUniformHandleui64ARB(GLuint program,GLint location,GLuint64 value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)this->m_functions[691];if(direct_)return direct_(program,location,value);return this->m_rawTable->glProgramUniformHandleui64ARB(program,location,value);}
+inline void glUniform3iARB(GLint location,GLint v0,GLint v1,GLint v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3IARBPROC)this->m_functions[692];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3iARB(location,v0,v1,v2);}
+inline GLhandleARB glCreateProgramObjectARB()const{auto const direct_ = (FunctionTable::PFNGLCREATEPROGRAMOBJECTARBPROC)this->m_functions[693];if(direct_)return direct_();return this->m_rawTable->glCreateProgramObjectARB();}
+inline void glMultiTexCoord1dvARB(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1DVARBPROC)this->m_functions[694];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1dvARB(target,v);}
+inline void glGetObjectParameterfvARB(GLhandleARB obj,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTPARAMETERFVARBPROC)this->m_functions[695];if(direct_)return direct_(obj,pname,params);return this->m_rawTable->glGetObjectParameterfvARB(obj,pname,params);}
+inline void glRectsv(const GLshort* v1,const GLshort* v2)const{auto const direct_ = (FunctionTable::PFNGLRECTSVPROC)this->m_functions[696];if(direct_)return direct_(v1,v2);return this->m_rawTable->glRectsv(v1,v2);}
+inline void glMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXIMAGE2DEXTPROC)this->m_functions[697];if(direct_)return direct_(texunit,target,level,internalformat,width,height,border,format,type,pixels);return this->m_rawTable->glMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,format,type,pixels);}
+inline void glProgramUniform1i64NV(GLuint program,GLint location,GLint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1I64NVPROC)this->m_functions[698];if(direct_)return direct_(program,location,x);return this->m_rawTable->glProgramUniform1i64NV(program,location,x);}
+inline void glGetObjectBufferivATI(GLuint buffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTBUFFERIVATIPROC)this->m_functions[699];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetObjectBufferivATI(buffer,pname,params);}
+inline void glUniform4i64ARB(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4I64ARBPROC)this->m_functions[700];if(direct_)return direct_(location,x,y,z,w);return this->m_rawTable->glUniform4i64ARB(location,x,y,z,w);}
+inline void glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint* rc,const GLubyte* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)this->m_functions[701];if(direct_)return direct_(rc,c,v);return this->m_rawTable->glReplacementCodeuiColor4ubVertex3fvSUN(rc,c,v);}
+inline void glBlendFuncSeparateINGR(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEINGRPROC)this->m_functions[702];if(direct_)return direct_(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);return this->m_rawTable->glBlendFuncSeparateINGR(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+inline void glGetVideoCaptureStreamfvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOCAPTURESTREAMFVNVPROC)this->m_functions[703];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glGetVideoCaptureStreamfvNV(video_capture_slot,stream,pname,params);}
+inline void glVertexAttrib2fARB(GLuint index,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FARBPROC)this->m_functions[704];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2fARB(index,x,y);}
+inline void glGetTexGeniv(GLenum coord,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXGENIVPROC)this->m_functions[705];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glGetTexGeniv(coord,pname,params);}
+inline void glPixelStorei(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPIXELSTOREIPROC)this->m_functions[706];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelStorei(pname,param);}
+inline void glGetCompressedTextureSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)this->m_functions[707];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);return this->m_rawTable->glGetCompressedTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);}
+inline void glCopyImageSubDataNV(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLCOPYIMAGESUBDATANVPROC)this->m_functions[708];if(direct_)return direct_(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);return this->m_rawTable->glCopyImageSubDataNV(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+inline void glActiveShaderProgram(GLuint pipeline,GLuint program)const{auto const direct_ = (FunctionTable::PFNGLACTIVESHADERPROGRAMPROC)this->m_functions[709];if(direct_)return direct_(pipeline,program);return this->m_rawTable->glActiveShaderProgram(pipeline,program);}
+inline void glVertexStream1iATI(GLenum stream,GLint x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1IATIPROC)this->m_functions[710];if(direct_)return direct_(stream,x);return this->m_rawTable->glVertexStream1iATI(stream,x);}
+inline void glPatchParameterfv(GLenum pname,const GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLPATCHPARAMETERFVPROC)this->m_functions[711];if(direct_)return direct_(pname,values);return this->m_rawTable->glPatchParameterfv(pname,values);}
+inline GLboolean glIsFramebufferEXT(GLuint framebuffer)const{auto const direct_ = (FunctionTable::PFNGLISFRAMEBUFFEREXTPROC)this->m_functions[712];if(direct_)return direct_(framebuffer);return this->m_rawTable->glIsFramebufferEXT(framebuffer);}
+inline void glTextureStorage2D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE2DPROC)this->m_functions[713];if(direct_)return direct_(texture,levels,internalformat,width,height);return this->m_rawTable->glTextureStorage2D(texture,levels,internalformat,width,height);}
+inline void glProgramUniform1ui64ARB(GLuint program,GLint location,GLuint64 x)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UI64ARBPROC)this->m_functions[714];if(direct_)return direct_(program,location,x);return this->m_rawTable->glProgramUniform1ui64ARB(program,location,x);}
+inline void glTexBufferRange(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLTEXBUFFERRANGEPROC)this->m_functions[715];if(direct_)return direct_(target,internalformat,buffer,offset,size);return this->m_rawTable->glTexBufferRange(target,internalformat,buffer,offset,size);}
+inline void glGetPixelTexGenParameterivSGIS(GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)this->m_functions[716];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetPixelTexGenParameterivSGIS(pname,params);}
+inline void glTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE3DEXTPROC)this->m_functions[717];if(direct_)return direct_(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);return this->m_rawTable->glTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+inline void glClipControl(GLenum origin,GLenum depth)const{auto const direct_ = (FunctionTable::PFNGLCLIPCONTROLPROC)this->m_functions[718];if(direct_)return direct_(origin,depth);return this->m_rawTable->glClipControl(origin,depth);}
+inline void glGetProgramResourceiv(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCEIVPROC)this->m_functions[719];if(direct_)return direct_(program,programInterface,index,propCount,props,bufSize,length,params);return this->m_rawTable->glGetProgramResourceiv(program,programInterface,index,propCount,props,bufSize,length,params);}
+inline void glMultiTexCoordP2uiv(GLenum texture,GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP2UIVPROC)this->m_functions[720];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP2uiv(texture,type,coords);}
+inline void glVertexAttribI3ui(GLuint index,GLuint x,GLuint y,GLuint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3UIPROC)this->m_functions[721];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribI3ui(index,x,y,z);}
+inline void glSampleMaskSGIS(GLclampf value,GLboolean invert)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEMASKSGISPROC)this->m_functions[722];if(direct_)return direct_(value,invert);return this->m_rawTable->glSampleMaskSGIS(value,invert);}
+inline void glVertexAttrib4NivARB(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NIVARBPROC)this->m_functions[723];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NivARB(index,v);}
+inline void glGlobalAlphaFactorfSUN(GLfloat factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORFSUNPROC)this->m_functions[724];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactorfSUN(factor);}
+inline void glBlendEquationSeparateIndexedAMD(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)this->m_functions[725];if(direct_)return direct_(buf,modeRGB,modeAlpha);return this->m_rawTable->glBlendEquationSeparateIndexedAMD(buf,modeRGB,modeAlpha);}
+inline void glGetPerfCounterInfoINTEL(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue)const{auto const direct_ = (FunctionTable::PFNGLGETPERFCOUNTERINFOINTELPROC)this->m_functions[726];if(direct_)return direct_(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);return this->m_rawTable->glGetPerfCounterInfoINTEL(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);}
+inline void glDeleteProgramsNV(GLsizei n,const GLuint* programs)const{auto const direct_ = (FunctionTable::PFNGLDELETEPROGRAMSNVPROC)this->m_functions[727];if(direct_)return direct_(n,programs);return this->m_rawTable->glDeleteProgramsNV(n,programs);}
+inline void glPixelZoomxOES(GLfixed xfactor,GLfixed yfactor)const{auto const direct_ = (FunctionTable::PFNGLPIXELZOOMXOESPROC)this->m_functions[728];if(direct_)return direct_(xfactor,yfactor);return this->m_rawTable->glPixelZoomxOES(xfactor,yfactor);}
+inline void glGetCombinerOutputParameterivNV(GLenum stage,GLenum portion,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)this->m_functions[729];if(direct_)return direct_(stage,portion,pname,params);return this->m_rawTable->glGetCombinerOutputParameterivNV(stage,portion,pname,params);}
+inline void glRasterPos2xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2XVOESPROC)this->m_functions[730];if(direct_)return direct_(coords);return this->m_rawTable->glRasterPos2xvOES(coords);}
+inline void glGetTexImage(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETTEXIMAGEPROC)this->m_functions[731];if(direct_)return direct_(target,level,format,type,pixels);return this->m_rawTable->glGetTexImage(target,level,format,type,pixels);}
+inline void glVertexArrayVertexBuffers(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXBUFFERSPROC)this->m_functions[732];if(direct_)return direct_(vaobj,first,count,buffers,offsets,strides);return this->m_rawTable->glVertexArrayVertexBuffers(vaobj,first,count,buffers,offsets,strides);}
+inline void glUniform1ui64NV(GLint location,GLuint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UI64NVPROC)this->m_functions[733];if(direct_)return direct_(location,x);return this->m_rawTable->glUniform1ui64NV(location,x);}
+inline void glProgramParameteri(GLuint program,GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETERIPROC)this->m_functions[734];if(direct_)return direct_(program,pname,value);return this->m_rawTable->glProgramParameteri(program,pname,value);}
+inline void glNormal3xOES(GLfixed nx,GLfixed ny,GLfixed nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3XOESPROC)this->m_functions[735];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3xOES(nx,ny,nz);}
+inline void glGetMapfv(GLenum target,GLenum query,GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLGETMAPFVPROC)this->m_functions[736];if(direct_)return direct_(target,query,v);return this->m_rawTable->glGetMapfv(target,query,v);}
+inline void glVertexStream2dvATI(GLenum stream,const GLdouble* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2DVATIPROC)this->m_functions[737];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream2dvATI(stream,coords);}
+inline void glPathStencilDepthOffsetNV(GLfloat factor,GLfloat units)const{auto const direct_ = (FunctionTable::PFNGLPATHSTENCILDEPTHOFFSETNVPROC)this->m_functions[738];if(direct_)return direct_(factor,units);return this->m_rawTable->glPathStencilDepthOffsetNV(factor,units);}
+inline GLboolean glIsStateNV(GLuint state)const{auto const direct_ = (FunctionTable::PFNGLISSTATENVPROC)this->m_functions[739];if(direct_)return direct_(state);return this->m_rawTable->glIsStateNV(state);}
+inline void glGetIntegerui64vNV(GLenum value,GLuint64EXT* result)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGERUI64VNVPROC)this->m_functions[740];if(direct_)return direct_(value,result);return this->m_rawTable->glGetIntegerui64vNV(value,result);}
+inline void glGetImageTransformParameterfvHP(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)this->m_functions[741];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetImageTransformParameterfvHP(target,pname,params);}
+inline void glRasterPos2fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2FVPROC)this->m_functions[742];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos2fv(v);}
+inline void glVertex3xOES(GLfixed x,GLfixed y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3XOESPROC)this->m_functions[743];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex3xOES(x,y);}
+inline GLboolean glIsMemoryObjectEXT(GLuint memoryObject)const{auto const direct_ = (FunctionTable::PFNGLISMEMORYOBJECTEXTPROC)this->m_functions[744];if(direct_)return direct_(memoryObject);return this->m_rawTable->glIsMemoryObjectEXT(memoryObject);}
+inline void glWeightPointerARB(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTPOINTERARBPROC)this->m_functions[745];if(direct_)return direct_(size,type,stride,pointer);return this->m_rawTable->glWeightPointerARB(size,type,stride,pointer);}
+inline void glFinishFenceNV(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLFINISHFENCENVPROC)this->m_functions[746];if(direct_)return direct_(fence);return this->m_rawTable->glFinishFenceNV(fence);}
+inline void glDepthRangexOES(GLfixed n,GLfixed f)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEXOESPROC)this->m_functions[747];if(direct_)return direct_(n,f);return this->m_rawTable->glDepthRangexOES(n,f);}
+inline void glEnableVertexArrayAttribEXT(GLuint vaobj,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXARRAYATTRIBEXTPROC)this->m_functions[748];if(direct_)return direct_(vaobj,index);return this->m_rawTable->glEnableVertexArrayAttribEXT(vaobj,index);}
+inline void glProgramUniform2uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UIVEXTPROC)this->m_functions[749];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2uivEXT(program,location,count,value);}
+inline void glGetDoubleIndexedvEXT(GLenum target,GLuint index,GLdouble* data)const{auto const direct_ = (FunctionTable::PFNGLGETDOUBLEINDEXEDVEXTPROC)this->m_functions[750];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetDoubleIndexedvEXT(target,index,data);}
+inline void glWindowPos2fMESA(GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FMESAPROC)this->m_functions[751];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2fMESA(x,y);}
+inline void glSecondaryColor3b(GLbyte red,GLbyte green,GLbyte blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3BPROC)this->m_functions[752];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3b(red,green,blue);}
+inline void glCopyConvolutionFilter1DEXT(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)this->m_functions[753];if(direct_)return direct_(target,internalformat,x,y,width);return this->m_rawTable->glCopyConvolutionFilter1DEXT(target,internalformat,x,y,width);}
+inline void glWindowPos2sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SVPROC)this->m_functions[754];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2sv(v);}
+inline void glBindFramebufferEXT(GLenum target,GLuint framebuffer)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAMEBUFFEREXTPROC)this->m_functions[755];if(direct_)return direct_(target,framebuffer);return this->m_rawTable->glBindFramebufferEXT(target,framebuffer);}
+inline GLuint glCreateShader(GLenum type)const{auto const direct_ = (FunctionTable::PFNGLCREATESHADERPROC)this->m_functions[756];if(direct_)return direct_(type);return this->m_rawTable->glCreateShader(type);}
+inline GLuint glGenPathsNV(GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLGENPATHSNVPROC)this->m_functions[757];if(direct_)return direct_(range);return this->m_rawTable->glGenPathsNV(range);}
+inline void glGenRenderbuffers(GLsizei n,GLuint* renderbuffers)const{auto const direct_ = (FunctionTable::PFNGLGENRENDERBUFFERSPROC)this->m_functions[758];if(direct_)return direct_(n,renderbuffers);return this->m_rawTable->glGenRenderbuffers(n,renderbuffers);}
+inline void glCopyTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE2DPROC)this->m_functions[759];if(direct_)return direct_(target,level,xoffset,yoffset,x,y,width,height);return this->m_rawTable->glCopyTexSubImage2D(target,level,xoffset,yoffset,x,y,width,height);}
+inline void glVertexAttrib4ubvARB(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UBVARBPROC)this->m_functions[760];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4ubvARB(index,v);}
+inline void glDrawTextureNV(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{auto const direct_ = (FunctionTable::PFNGLDRAWTEXTURENVPROC)this->m_functions[761];if(direct_)return direct_(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);return this->m_rawTable->glDrawTextureNV(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+inline void glVertexAttribs1svNV(GLuint index,GLsizei count,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS1SVNVPROC)this->m_functions[762];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs1svNV(index,count,v);}
+inline void glClearNamedBufferSubDataEXT(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)this->m_functions[763];if(direct_)return direct_(buffer,internalformat,offset,size,format,type,data);return this->m_rawTable->glClearNamedBufferSubDataEXT(buffer,internalformat,offset,size,format,type,data);}
+inline void glBlendFuncSeparate(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEPROC)this->m_functions[764];if(direct_)return direct_(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);return this->m_rawTable->glBlendFuncSeparate(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+inline void glPointParameterfARB(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFARBPROC)this->m_functions[765];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameterfARB(pname,param);}
+inline void glTexCoord2fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FVPROC)this->m_functions[766];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord2fv(v);}
+inline void glGetVariantFloatvEXT(GLuint id,GLenum value,GLfloat* data)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTFLOATVEXTPROC)this->m_functions[767];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetVariantFloatvEXT(id,value,data);}
+inline void glVertexP2ui(GLenum type,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP2UIPROC)this->m_functions[768];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP2ui(type,value);}
+inline void glWindowPos2dMESA(GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DMESAPROC)this->m_functions[769];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2dMESA(x,y);}
+inline void glTexCoord4fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FVPROC)this->m_functions[770];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord4fv(v);}
+inline void glBindFragDataLocationEXT(GLuint program,GLuint color,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAGDATALOCATIONEXTPROC)this->m_functions[771];if(direct_)return direct_(program,color,name);return this->m_rawTable->glBindFragDataLocationEXT(program,color,name);}
+inline void glCompressedTexSubImage1DARB(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)this->m_functions[772];if(direct_)return direct_(target,level,xoffset,width,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage1DARB(target,level,xoffset,width,format,imageSize,data);}
+inline void glGetTextureImageEXT(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREIMAGEEXTPROC)this->m_functions[773];if(direct_)return direct_(texture,target,level,format,type,pixels);return this->m_rawTable->glGetTextureImageEXT(texture,target,level,format,type,pixels);}
+inline void glFogCoordd(GLdouble coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDDPROC)this->m_functions[774];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoordd(coord);}
+inline void glPointSize(GLfloat size)const{auto const direct_ = (FunctionTable::PFNGLPOINTSIZEPROC)this->m_functions[775];if(direct_)return direct_(size);return this->m_rawTable->glPointSize(size);}
+inline void glBindTextureUnit(GLuint unit,GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXTUREUNITPROC)this->m_functions[776];if(direct_)return direct_(unit,texture);return this->m_rawTable->glBindTextureUnit(unit,texture);}
+inline void glProgramEnvParameterI4uiNV(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERI4UINVPROC)this->m_functions[777];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramEnvParameterI4uiNV(target,index,x,y,z,w);}
+inline void glGetProgramPipelineInfoLog(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMPIPELINEINFOLOGPROC)this->m_functions[778];if(direct_)return direct_(pipeline,bufSize,length,infoLog);return this->m_rawTable->glGetProgramPipelineInfoLog(pipeline,bufSize,length,infoLog);}
+inline void glProgramUniform4i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4I64VARBPROC)this->m_functions[779];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4i64vARB(program,location,count,value);}
+inline void glVertexAttrib4Nuiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUIVPROC)this->m_functions[780];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Nuiv(index,v);}
+inline void glGetUniformfvARB(GLhandleARB programObj,GLint location,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMFVARBPROC)this->m_functions[781];if(direct_)return direct_(programObj,location,params);return this->m_rawTable->glGetUniformfvARB(programObj,location,params);}
+inline void glWaitSync(GLsync sync,GLbitfield flags,GLuint64 timeout)const{auto const direct_ = (FunctionTable::PFNGLWAITSYNCPROC)this->m_functions[782];if(direct_)return direct_(sync,flags,timeout);return this->m_rawTable->glWaitSync(sync,flags,timeout);}
+inline void glUniform3i(GLint location,GLint v0,GLint v1,GLint v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3IPROC)this->m_functions[783];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3i(location,v0,v1,v2);}
+inline void glBlendEquationSeparatei(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEIPROC)this->m_functions[784];if(direct_)return direct_(buf,modeRGB,modeAlpha);return this->m_rawTable->glBlendEquationSeparatei(buf,modeRGB,modeAlpha);}
+inline void glVertexAttrib2hvNV(GLuint index,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2HVNVPROC)this->m_functions[785];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2hvNV(index,v);}
+inline void glTextureParameterivEXT(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIVEXTPROC)this->m_functions[786];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glTextureParameterivEXT(texture,target,pname,params);}
+inline void glUniform3d(GLint location,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3DPROC)this->m_functions[787];if(direct_)return direct_(location,x,y,z);return this->m_rawTable->glUniform3d(location,x,y,z);}
+inline void glUniform3f(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3FPROC)this->m_functions[788];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3f(location,v0,v1,v2);}
+inline void glActiveProgramEXT(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLACTIVEPROGRAMEXTPROC)this->m_functions[789];if(direct_)return direct_(program);return this->m_rawTable->glActiveProgramEXT(program);}
+inline void glProgramUniform3uiv(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UIVPROC)this->m_functions[790];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3uiv(program,location,count,value);}
+inline void glUniform3ui64vARB(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UI64VARBPROC)this->m_functions[791];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3ui64vARB(location,count,value);}
+inline void glProgramUniform1ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UI64VARBPROC)this->m_functions[792];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1ui64vARB(program,location,count,value);}
+inline void glTextureParameterfEXT(GLuint texture,GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERFEXTPROC)this->m_functions[793];if(direct_)return direct_(texture,target,pname,param);return this->m_rawTable->glTextureParameterfEXT(texture,target,pname,param);}
+inline void glSetFragmentShaderConstantATI(GLuint dst,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLSETFRAGMENTSHADERCONSTANTATIPROC)this->m_functions[794];if(direct_)return direct_(dst,value);return this->m_rawTable->glSetFragmentShaderConstantATI(dst,value);}
+inline void glColorSubTable(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOLORSUBTABLEPROC)this->m_functions[795];if(direct_)return direct_(target,start,count,format,type,data);return this->m_rawTable->glColorSubTable(target,start,count,format,type,data);}
+inline void glReplacementCodeuiSUN(GLuint code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUISUNPROC)this->m_functions[796];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeuiSUN(code);}
+inline void glStateCaptureNV(GLuint state,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLSTATECAPTURENVPROC)this->m_functions[797];if(direct_)return direct_(state,mode);return this->m_rawTable->glStateCaptureNV(state,mode);}
+inline void glBindAttribLocation(GLuint program,GLuint index,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLBINDATTRIBLOCATIONPROC)this->m_functions[798];if(direct_)return direct_(program,index,name);return this->m_rawTable->glBindAttribLocation(program,index,name);}
+inline void glWeightusvARB(GLint size,const GLushort* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTUSVARBPROC)this->m_functions[799];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightusvARB(size,weights);}
+inline GLint glGetFragDataIndex(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGDATAINDEXPROC)this->m_functions[800];if(direct_)return direct_(program,name);return this->m_rawTable->glGetFragDataIndex(program,name);}
+inline void glMultiTexCoord2xOES(GLenum texture,GLfixed s,GLfixed t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2XOESPROC)this->m_functions[801];if(direct_)return direct_(texture,s,t);return this->m_rawTable->glMultiTexCoord2xOES(texture,s,t);}
+inline void glColor3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3SVPROC)this->m_functions[802];if(direct_)return direct_(v);return this->m_rawTable->glColor3sv(v);}
+inline void glTexCoord2fVertex3fSUN(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FVERTEX3FSUNPROC)this->m_functions[803];if(direct_)return direct_(s,t,x,y,z);return this->m_rawTable->glTexCoord2fVertex3fSUN(s,t,x,y,z);}
+inline void glGetMemoryObjectParameterivEXT(GLuint memoryObject,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)this->m_functions[804];if(direct_)return direct_(memoryObject,pname,params);return this->m_rawTable->glGetMemoryObjectParameterivEXT(memoryObject,pname,params);}
+inline void glPolygonOffsetEXT(GLfloat factor,GLfloat bias)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONOFFSETEXTPROC)this->m_functions[805];if(direct_)return direct_(factor,bias);return this->m_rawTable->glPolygonOffsetEXT(factor,bias);}
+inline void glWeightPathsNV(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTPATHSNVPROC)this->m_functions[806];if(direct_)return direct_(resultPath,numPaths,paths,weights);return this->m_rawTable->glWeightPathsNV(resultPath,numPaths,paths,weights);}
+inline void glCombinerStageParameterfvNV(GLenum stage,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERSTAGEPARAMETERFVNVPROC)this->m_functions[807];if(direct_)return direct_(stage,pname,params);return this->m_rawTable->glCombinerStageParameterfvNV(stage,pname,params);}
+inline void glPointParameterfEXT(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFEXTPROC)this->m_functions[808];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameterfEXT(pname,param);}
+inline void glCopyTexImage1DEXT(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXIMAGE1DEXTPROC)this->m_functions[809];if(direct_)return direct_(target,level,internalformat,x,y,width,border);return this->m_rawTable->glCopyTexImage1DEXT(target,level,internalformat,x,y,width,border);}
+inline void glVertex4sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4SVPROC)this->m_functions[810];if(direct_)return direct_(v);return this->m_rawTable->glVertex4sv(v);}
+inline void glMatrixMultfEXT(GLenum mode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULTFEXTPROC)this->m_functions[811];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixMultfEXT(mode,m);}
+inline void glCompressedTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)this->m_functions[812];if(direct_)return direct_(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);return this->m_rawTable->glCompressedTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+inline void glGetTexLevelParameterxvOES(GLenum target,GLint level,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXLEVELPARAMETERXVOESPROC)this->m_functions[813];if(direct_)return direct_(target,level,pname,params);return this->m_rawTable->glGetTexLevelParameterxvOES(target,level,pname,params);}
+inline void glVertexAttribL3dvEXT(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3DVEXTPROC)this->m_functions[814];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL3dvEXT(index,v);}
+inline void glMultiTexCoordP4ui(GLenum texture,GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP4UIPROC)this->m_functions[815];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP4ui(texture,type,coords);}
+inline void glGetTextureLevelParameterivEXT(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)this->m_functions[816];if(direct_)return direct_(texture,target,level,pname,params);return this->m_rawTable->glGetTextureLevelParameterivEXT(texture,target,level,pname,params);}
+inline void glAlphaFragmentOp2ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{auto const direct_ = (FunctionTable::PFNGLALPHAFRAGMENTOP2ATIPROC)this->m_functions[817];if(direct_)return direct_(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);return this->m_rawTable->glAlphaFragmentOp2ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+inline void glDeleteFramebuffers(GLsizei n,const GLuint* framebuffers)const{auto const direct_ = (FunctionTable::PFNGLDELETEFRAMEBUFFERSPROC)this->m_functions[818];if(direct_)return direct_(n,framebuffers);return this->m_rawTable->glDeleteFramebuffers(n,framebuffers);}
+inline void glDrawArrays(GLenum mode,GLint first,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSPROC)this->m_functions[819];if(direct_)return direct_(mode,first,count);return this->m_rawTable->glDrawArrays(mode,first,count);}
+inline void glGetTransformFeedbackiv(GLuint xfb,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKIVPROC)this->m_functions[820];if(direct_)return direct_(xfb,pname,param);return this->m_rawTable->glGetTransformFeedbackiv(xfb,pname,param);}
+inline void glGetnTexImageARB(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img)const{auto const direct_ = (FunctionTable::PFNGLGETNTEXIMAGEARBPROC)this->m_functions[821];if(direct_)return direct_(target,level,format,type,bufSize,img);return this->m_rawTable->glGetnTexImageARB(target,level,format,type,bufSize,img);}
+inline void glClear(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLCLEARPROC)this->m_functions[822];if(direct_)return direct_(mask);return this->m_rawTable->glClear(mask);}
+inline void glVertexArrayParameteriAPPLE(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYPARAMETERIAPPLEPROC)this->m_functions[823];if(direct_)return direct_(pname,param);return this->m_rawTable->glVertexArrayParameteriAPPLE(pname,param);}
+inline void glMultiTexCoord2dvARB(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2DVARBPROC)this->m_functions[824];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2dvARB(target,v);}
+inline void glGetVideoCaptureStreamdvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOCAPTURESTREAMDVNVPROC)this->m_functions[825];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glGetVideoCaptureStreamdvNV(video_capture_slot,stream,pname,params);}
+inline void glFragmentLightModelivSGIX(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTMODELIVSGIXPROC)this->m_functions[826];if(direct_)return direct_(pname,params);return this->m_rawTable->glFragmentLightModelivSGIX(pname,params);}
+inline void glVertexAttribP2ui(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP2UIPROC)this->m_functions[827];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP2ui(index,type,normalized,value);}
+inline void glMultiTexCoordPointerEXT(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDPOINTEREXTPROC)this->m_functions[828];if(direct_)return direct_(texunit,size,type,stride,pointer);return this->m_rawTable->glMultiTexCoordPointerEXT(texunit,size,type,stride,pointer);}
+inline void glProgramUniform3iEXT(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3IEXTPROC)this->m_functions[829];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3iEXT(program,location,v0,v1,v2);}
+inline void glTranslatef(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTRANSLATEFPROC)this->m_functions[830];if(direct_)return direct_(x,y,z);return this->m_rawTable->glTranslatef(x,y,z);}
+inline void glVertexAttrib4Nub(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUBPROC)this->m_functions[831];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4Nub(index,x,y,z,w);}
+inline void glTranslated(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLTRANSLATEDPROC)this->m_functions[832];if(direct_)return direct_(x,y,z);return this->m_rawTable->glTranslated(x,y,z);}
+inline void glSamplerParameterIiv(GLuint sampler,GLenum pname,const GLint* param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERIIVPROC)this->m_functions[833];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameterIiv(sampler,pname,param);}
+inline void glTexCoord4hNV(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4HNVPROC)this->m_functions[834];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4hNV(s,t,r,q);}
+inline void glDrawElementsIndirect(GLenum mode,GLenum type,const void* indirect)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINDIRECTPROC)this->m_functions[835];if(direct_)return direct_(mode,type,indirect);return this->m_rawTable->glDrawElementsIndirect(mode,type,indirect);}
+inline void glDeletePerfMonitorsAMD(GLsizei n,GLuint* monitors)const{auto const direct_ = (FunctionTable::PFNGLDELETEPERFMONITORSAMDPROC)this->m_functions[836];if(direct_)return direct_(n,monitors);return this->m_rawTable->glDeletePerfMonitorsAMD(n,monitors);}
+inline GLboolean glIsRenderbufferEXT(GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLISRENDERBUFFEREXTPROC)this->m_functions[837];if(direct_)return direct_(renderbuffer);return this->m_rawTable->glIsRenderbufferEXT(renderbuffer);}
+inline void glDrawCommandsNV(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count)const{auto const direct_ = (FunctionTable::PFNGLDRAWCOMMANDSNVPROC)this->m_functions[838];if(direct_)return direct_(primitiveMode,buffer,indirects,sizes,count);return this->m_rawTable->glDrawCommandsNV(primitiveMode,buffer,indirects,sizes,count);}
+inline void glUniform3ivARB(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3IVARBPROC)this->m_functions[839];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3ivARB(location,count,value);}
+inline void glBufferSubData(GLenum target,GLintptr offset,GLsizeiptr size,const void* data)const{auto const direct_ = (FunctionTable::PFNGLBUFFERSUBDATAPROC)this->m_functions[840];if(direct_)return direct_(target,offset,size,data);return this->m_rawTable->glBufferSubData(target,offset,size,data);}
+inline void glSecondaryColor3bv(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3BVPROC)this->m_functions[841];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3bv(v);}
+inline void glMatrixMultTransposedEXT(GLenum mode,const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULTTRANSPOSEDEXTPROC)this->m_functions[842];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixMultTransposedEXT(mode,m);}
+inline void glRequestResidentProgramsNV(GLsizei n,const GLuint* programs)const{auto const direct_ = (FunctionTable::PFNGLREQUESTRESIDENTPROGRAMSNVPROC)this->m_functions[843];if(direct_)return direct_(n,programs);return this->m_rawTable->glRequestResidentProgramsNV(n,programs);}
+inline void glAlphaFragmentOp1ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{auto const direct_ = (FunctionTable::PFNGLALPHAFRAGMENTOP1ATIPROC)this->m_functions[844];if(direct_)return direct_(op,dst,dstMod,arg1,arg1Rep,arg1Mod);return this->m_rawTable->glAlphaFragmentOp1ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod);}
+inline void glGetQueryObjecti64v(GLuint id,GLenum pname,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTI64VPROC)this->m_functions[845];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjecti64v(id,pname,params);}
+inline void glMatrixMult3x3fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULT3X3FNVPROC)this->m_functions[846];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixMult3x3fNV(matrixMode,m);}
+inline void glColorTableParameteriv(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEPARAMETERIVPROC)this->m_functions[847];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glColorTableParameteriv(target,pname,params);}
+inline void glPathSubCommandsNV(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const direct_ = (FunctionTable::PFNGLPATHSUBCOMMANDSNVPROC)this->m_functions[848];if(direct_)return direct_(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);return this->m_rawTable->glPathSubCommandsNV(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);}
+inline void glGetFinalCombinerInputParameterivNV(GLenum variable,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)this->m_functions[849];if(direct_)return direct_(variable,pname,params);return this->m_rawTable->glGetFinalCombinerInputParameterivNV(variable,pname,params);}
+inline GLboolean glIsRenderbuffer(GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLISRENDERBUFFERPROC)this->m_functions[850];if(direct_)return direct_(renderbuffer);return this->m_rawTable->glIsRenderbuffer(renderbuffer);}
+inline void glVertex3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3IVPROC)this->m_functions[851];if(direct_)return direct_(v);return this->m_rawTable->glVertex3iv(v);}
+inline void glTexGenfv(GLenum coord,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLTEXGENFVPROC)this->m_functions[852];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glTexGenfv(coord,pname,params);}
+inline void glFrustumfOES(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{auto const direct_ = (FunctionTable::PFNGLFRUSTUMFOESPROC)this->m_functions[853];if(direct_)return direct_(l,r,b,t,n,f);return this->m_rawTable->glFrustumfOES(l,r,b,t,n,f);}
+inline void glBindVertexBuffers(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{auto const direct_ = (FunctionTable::PFNGLBINDVERTEXBUFFERSPROC)this->m_functions[854];if(direct_)return direct_(first,count,buffers,offsets,strides);return this->m_rawTable->glBindVertexBuffers(first,count,buffers,offsets,strides);}
+inline void glMateriali(GLenum face,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLMATERIALIPROC)this->m_functions[855];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glMateriali(face,pname,param);}
+inline void glMultiTexCoord2svARB(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2SVARBPROC)this->m_functions[856];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2svARB(target,v);}
+inline void glDisableVertexAttribArray(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXATTRIBARRAYPROC)this->m_functions[857];if(direct_)return direct_(index);return this->m_rawTable->glDisableVertexAttribArray(index);}
+inline void glWindowPos3ivARB(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IVARBPROC)this->m_functions[858];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3ivARB(v);}
+inline void glTexCoordFormatNV(GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDFORMATNVPROC)this->m_functions[859];if(direct_)return direct_(size,type,stride);return this->m_rawTable->glTexCoordFormatNV(size,type,stride);}
+inline void glBlitNamedFramebuffer(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const direct_ = (FunctionTable::PFNGLBLITNAMEDFRAMEBUFFERPROC)this->m_functions[860];if(direct_)return direct_(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);return this->m_rawTable->glBlitNamedFramebuffer(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+inline void glMatrixLoadTransposefEXT(GLenum mode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADTRANSPOSEFEXTPROC)this->m_functions[861];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixLoadTransposefEXT(mode,m);}
+inline void glMultiTexGenfEXT(GLenum texunit,GLenum coord,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENFEXTPROC)this->m_functions[862];if(direct_)return direct_(texunit,coord,pname,param);return this->m_rawTable->glMultiTexGenfEXT(texunit,coord,pname,param);}
+inline void glShaderStorageBlockBinding(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding)const{auto const direct_ = (FunctionTable::PFNGLSHADERSTORAGEBLOCKBINDINGPROC)this->m_functions[863];if(direct_)return direct_(program,storageBlockIndex,storageBlockBinding);return this->m_rawTable->glShaderStorageBlockBinding(program,storageBlockIndex,storageBlockBinding);}
+inline void glMaterialf(GLenum face,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLMATERIALFPROC)this->m_functions[864];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glMaterialf(face,pname,param);}
+inline void glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_functions[865];if(direct_)return direct_(rc,r,g,b,a,nx,ny,nz,x,y,z);return this->m_rawTable->glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc,r,g,b,a,nx,ny,nz,x,y,z);}
+inline GLenum glCheckNamedFramebufferStatusEXT(GLuint framebuffer,GLenum target)const{auto const direct_ = (FunctionTable::PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)this->m_functions[866];if(direct_)return direct_(framebuffer,target);return this->m_rawTable->glCheckNamedFramebufferStatusEXT(framebuffer,target);}
+inline void glVertexArrayVertexAttribFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)this->m_functions[867];if(direct_)return direct_(vaobj,attribindex,size,type,normalized,relativeoffset);return this->m_rawTable->glVertexArrayVertexAttribFormatEXT(vaobj,attribindex,size,type,normalized,relativeoffset);}
+inline void glVertex2hNV(GLhalfNV x,GLhalfNV y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2HNVPROC)this->m_functions[868];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2hNV(x,y);}
+inline void glDeleteVertexShaderEXT(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLDELETEVERTEXSHADEREXTPROC)this->m_functions[869];if(direct_)return direct_(id);return this->m_rawTable->glDeleteVertexShaderEXT(id);}
+inline void glTexImage3DEXT(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE3DEXTPROC)this->m_functions[870];if(direct_)return direct_(target,level,internalformat,width,height,depth,border,format,type,pixels);return this->m_rawTable->glTexImage3DEXT(target,level,internalformat,width,height,depth,border,format,type,pixels);}
+inline void glSignalVkFenceNV(GLuint64 vkFence)const{auto const direct_ = (FunctionTable::PFNGLSIGNALVKFENCENVPROC)this->m_functions[871];if(direct_)return direct_(vkFence);return this->m_rawTable->glSignalVkFenceNV(vkFence);}
+inline void glProgramLocalParameterI4ivNV(GLenum target,GLuint index,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)this->m_functions[872];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramLocalParameterI4ivNV(target,index,params);}
+inline void glGlobalAlphaFactoriSUN(GLint factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORISUNPROC)this->m_functions[873];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactoriSUN(factor);}
+inline void glTextureStorage1D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE1DPROC)this->m_functions[874];if(direct_)return direct_(texture,levels,internalformat,width);return this->m_rawTable->glTextureStorage1D(texture,levels,internalformat,width);}
+inline void glBinormal3sEXT(GLshort bx,GLshort by,GLshort bz)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3SEXTPROC)this->m_functions[875];if(direct_)return direct_(bx,by,bz);return this->m_rawTable->glBinormal3sEXT(bx,by,bz);}
+inline void glGetProgramInterfaceiv(GLuint program,GLenum programInterface,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMINTERFACEIVPROC)this->m_functions[876];if(direct_)return direct_(program,programInterface,pname,params);return this->m_rawTable->glGetProgramInterfaceiv(program,programInterface,pname,params);}
+inline void glMatrixIndexPointerARB(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLMATRIXINDEXPOINTERARBPROC)this->m_functions[877];if(direct_)return direct_(size,type,stride,pointer);return this->m_rawTable->glMatrixIndexPointerARB(size,type,stride,pointer);}
+inline void glTexCoordPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDPOINTEREXTPROC)this->m_functions[878];if(direct_)return direct_(size,type,stride,count,pointer);return this->m_rawTable->glTexCoordPointerEXT(size,type,stride,count,pointer);}
+inline void glMultiTexGeniEXT(GLenum texunit,GLenum coord,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENIEXTPROC)this->m_functions[879];if(direct_)return direct_(texunit,coord,pname,param);return this->m_rawTable->glMultiTexGeniEXT(texunit,coord,pname,param);}
+inline void glVertexAttrib2fNV(GLuint index,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FNVPROC)this->m_functions[880];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2fNV(index,x,y);}
+inline void glNamedProgramStringEXT(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMSTRINGEXTPROC)this->m_functions[881];if(direct_)return direct_(program,target,format,len,string);return this->m_rawTable->glNamedProgramStringEXT(program,target,format,len,string);}
+inline void* glMapNamedBuffer(GLuint buffer,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAPNAMEDBUFFERPROC)this->m_functions[882];if(direct_)return direct_(buffer,access);return this->m_rawTable->glMapNamedBuffer(buffer,access);}
+inline void glGetMinmaxParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXPARAMETERIVPROC)this->m_functions[883];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMinmaxParameteriv(target,pname,params);}
+inline void glGetnUniformdv(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMDVPROC)this->m_functions[884];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformdv(program,location,bufSize,params);}
+inline void glEndConditionalRenderNVX()const{auto const direct_ = (FunctionTable::PFNGLENDCONDITIONALRENDERNVXPROC)this->m_functions[885];if(direct_)return direct_();return this->m_rawTable->glEndConditionalRenderNVX();}
+inline void glBinormal3fEXT(GLfloat bx,GLfloat by,GLfloat bz)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3FEXTPROC)this->m_functions[886];if(direct_)return direct_(bx,by,bz);return this->m_rawTable->glBinormal3fEXT(bx,by,bz);}
+inline void glNormalStream3iATI(GLenum stream,GLint nx,GLint ny,GLint nz)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3IATIPROC)this->m_functions[887];if(direct_)return direct_(stream,nx,ny,nz);return this->m_rawTable->glNormalStream3iATI(stream,nx,ny,nz);}
+inline void glProgramBufferParametersIivNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)this->m_functions[888];if(direct_)return direct_(target,bindingIndex,wordIndex,count,params);return this->m_rawTable->glProgramBufferParametersIivNV(target,bindingIndex,wordIndex,count,params);}
+inline void glMapGrid1xOES(GLint n,GLfixed u1,GLfixed u2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID1XOESPROC)this->m_functions[889];if(direct_)return direct_(n,u1,u2);return this->m_rawTable->glMapGrid1xOES(n,u1,u2);}
+inline void glGetVertexAttribPointervARB(GLuint index,GLenum pname,void** pointer)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBPOINTERVARBPROC)this->m_functions[890];if(direct_)return direct_(index,pname,pointer);return this->m_rawTable->glGetVertexAttribPointervARB(index,pname,pointer);}
+inline void glFlushMappedNamedBufferRangeEXT(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const direct_ = (FunctionTable::PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)this->m_functions[891];if(direct_)return direct_(buffer,offset,length);return this->m_rawTable->glFlushMappedNamedBufferRangeEXT(buffer,offset,length);}
+inline void glGetVertexAttribIiv(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIIVPROC)this->m_functions[892];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribIiv(index,pname,params);}
+inline void glVertexP4uiv(GLenum type,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP4UIVPROC)this->m_functions[893];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP4uiv(type,value);}
+inline void glUniformui64NV(GLint location,GLuint64EXT value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMUI64NVPROC)this->m_functions[894];if(direct_)return direct_(location,value);return this->m_rawTable->glUniformui64NV(location,value);}
+inline void glColor4fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4FVPROC)this->m_functions[895];if(direct_)return direct_(v);return this->m_rawTable->glColor4fv(v);}
+inline void glTexParameterxvOES(GLenum target,GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERXVOESPROC)this->m_functions[896];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterxvOES(target,pname,params);}
+inline void glPatchParameteri(GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLPATCHPARAMETERIPROC)this->m_functions[897];if(direct_)return direct_(pname,value);return this->m_rawTable->glPatchParameteri(pname,value);}
+inline void glMap1d(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{auto const direct_ = (FunctionTable::PFNGLMAP1DPROC)this->m_functions[898];if(direct_)return direct_(target,u1,u2,stride,order,points);return this->m_rawTable->glMap1d(target,u1,u2,stride,order,points);}
+inline void glGetTexFilterFuncSGIS(GLenum target,GLenum filter,GLfloat* weights)const{auto const direct_ = (FunctionTable::PFNGLGETTEXFILTERFUNCSGISPROC)this->m_functions[899];if(direct_)return direct_(target,filter,weights);return this->m_rawTable->glGetTexFilterFuncSGIS(target,filter,weights);}
+inline void glVertexStream3dATI(GLenum stream,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3DATIPROC)this->m_functions[900];if(direct_)return direct_(stream,x,y,z);return this->m_rawTable->glVertexStream3dATI(stream,x,y,z);}
+inline void glVertexArrayVertexBindingDivisorEXT(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)this->m_functions[901];if(direct_)return direct_(vaobj,bindingindex,divisor);return this->m_rawTable->glVertexArrayVertexBindingDivisorEXT(vaobj,bindingindex,divisor);}
+inline void glMultiTexCoord3svARB(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3SVARBPROC)this->m_functions[902];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3svARB(target,v);}
+inline void glBindProgramNV(GLenum target,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBINDPROGRAMNVPROC)this->m_functions[903];if(direct_)return direct_(target,id);return this->m_rawTable->glBindProgramNV(target,id);}
+inline void glGetConvolutionParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONPARAMETERIVPROC)this->m_functions[904];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetConvolutionParameteriv(target,pname,params);}
+inline void glGetProgramLocalParameterfvARB(GLenum target,GLuint index,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)this->m_functions[905];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramLocalParameterfvARB(target,index,params);}
+inline GLuint glGenFragmentShadersATI(GLuint range)const{auto const direct_ = (FunctionTable::PFNGLGENFRAGMENTSHADERSATIPROC)this->m_functions[906];if(direct_)return direct_(range);return this->m_rawTable->glGenFragmentShadersATI(range);}
+inline void glTexBumpParameterivATI(GLenum pname,const GLint* param)const{auto const direct_ = (FunctionTable::PFNGLTEXBUMPPARAMETERIVATIPROC)this->m_functions[907];if(direct_)return direct_(pname,param);return this->m_rawTable->glTexBumpParameterivATI(pname,param);}
+inline void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)this->m_functions[908];if(direct_)return direct_(framebuffer,attachment,pname,params);return this->m_rawTable->glGetNamedFramebufferAttachmentParameteriv(framebuffer,attachment,pname,params);}
+inline void glGetnSeparableFilter(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{auto const direct_ = (FunctionTable::PFNGLGETNSEPARABLEFILTERPROC)this->m_functions[909];if(direct_)return direct_(target,format,type,rowBufSize,row,columnBufSize,column,span);return this->m_rawTable->glGetnSeparableFilter(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+inline void glNormal3xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3XVOESPROC)this->m_functions[910];if(direct_)return direct_(coords);return this->m_rawTable->glNormal3xvOES(coords);}
+inline void glPassTexCoordATI(GLuint dst,GLuint coord,GLenum swizzle)const{auto const direct_ = (FunctionTable::PFNGLPASSTEXCOORDATIPROC)this->m_functions[911];if(direct_)return direct_(dst,coord,swizzle);return this->m_rawTable->glPassTexCoordATI(dst,coord,swizzle);}
+inline void glFramebufferTextureFaceARB(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREFACEARBPROC)this->m_functions[912];if(direct_)return direct_(target,attachment,texture,level,face);return this->m_rawTable->glFramebufferTextureFaceARB(target,attachment,texture,level,face);}
+inline void glProgramUniform1dv(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1DVPROC)this->m_functions[913];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1dv(program,location,count,value);}
+inline void glTextureStorage2DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE2DEXTPROC)this->m_functions[914];if(direct_)return direct_(texture,target,levels,internalformat,width,height);return this->m_rawTable->glTextureStorage2DEXT(texture,target,levels,internalformat,width,height);}
+inline void glVertexArrayFogCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)this->m_functions[915];if(direct_)return direct_(vaobj,buffer,type,stride,offset);return this->m_rawTable->glVertexArrayFogCoordOffsetEXT(vaobj,buffer,type,stride,offset);}
+inline void glDeleteNamedStringARB(GLint namelen,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLDELETENAMEDSTRINGARBPROC)this->m_functions[916];if(direct_)return direct_(namelen,name);return this->m_rawTable->glDeleteNamedStringARB(namelen,name);}
+inline void glMulticastGetQueryObjecti64vNV(GLuint gpu,GLuint id,GLenum pname,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)this->m_functions[917];if(direct_)return direct_(gpu,id,pname,params);return this->m_rawTable->glMulticastGetQueryObjecti64vNV(gpu,id,pname,params);}
+inline void glGenOcclusionQueriesNV(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLGENOCCLUSIONQUERIESNVPROC)this->m_functions[918];if(direct_)return direct_(n,ids);return this->m_rawTable->glGenOcclusionQueriesNV(n,ids);}
+inline void glLighti(GLenum light,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTIPROC)this->m_functions[919];if(direct_)return direct_(light,pname,param);return this->m_rawTable->glLighti(light,pname,param);}
+inline void glTexImage1D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE1DPROC)this->m_functions[920];if(direct_)return direct_(target,level,internalFormat,width,border,format,type,pixels);return this->m_rawTable->glTexImage1D(target,level,internalFormat,width,border,format,type,pixels);}
+inline void glLightf(GLenum light,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTFPROC)this->m_functions[921];if(direct_)return direct_(light,pname,param);return this->m_rawTable->glLightf(light,pname,param);}
+inline void glClientAttribDefaultEXT(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLCLIENTATTRIBDEFAULTEXTPROC)this->m_functions[922];if(direct_)return direct_(mask);return this->m_rawTable->glClientAttribDefaultEXT(mask);}
+inline void glVertexAttrib4bvARB(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4BVARBPROC)this->m_functions[923];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4bvARB(index,v);}
+inline void glVertexAttribIFormatNV(GLuint index,GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBIFORMATNVPROC)this->m_functions[924];if(direct_)return direct_(index,size,type,stride);return this->m_rawTable->glVertexAttribIFormatNV(index,size,type,stride);}
+inline void glStencilFuncSeparate(GLenum face,GLenum func,GLint ref,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILFUNCSEPARATEPROC)this->m_functions[925];if(direct_)return direct_(face,func,ref,mask);return this->m_rawTable->glStencilFuncSeparate(face,func,ref,mask);}
+inline void glGetVertexAttribfvARB(GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBFVARBPROC)this->m_functions[926];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribfvARB(index,pname,params);}
+inline void glVertexAttrib2dNV(GLuint index,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DNVPROC)this->m_functions[927];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2dNV(index,x,y);}
+inline void glProgramUniform2iEXT(GLuint program,GLint location,GLint v0,GLint v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2IEXTPROC)this->m_functions[928];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2iEXT(program,location,v0,v1);}
+inline void glClientActiveVertexStreamATI(GLenum stream)const{auto const direct_ = (FunctionTable::PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)this->m_functions[929];if(direct_)return direct_(stream);return this->m_rawTable->glClientActiveVertexStreamATI(stream);}
+inline void glRasterPos3xOES(GLfixed x,GLfixed y,GLfixed z)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3XOESPROC)this->m_functions[930];if(direct_)return direct_(x,y,z);return this->m_rawTable->glRasterPos3xOES(x,y,z);}
+inline void glGetMapParameterivNV(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMAPPARAMETERIVNVPROC)this->m_functions[931];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMapParameterivNV(target,pname,params);}
+inline void glSampleCoverage(GLclampf value,GLboolean invert)const{auto const direct_ = (FunctionTable::PFNGLSAMPLECOVERAGEPROC)this->m_functions[932];if(direct_)return direct_(value,invert);return this->m_rawTable->glSampleCoverage(value,invert);}
+inline void glClearDepthxOES(GLfixed depth)const{auto const direct_ = (FunctionTable::PFNGLCLEARDEPTHXOESPROC)this->m_functions[933];if(direct_)return direct_(depth);return this->m_rawTable->glClearDepthxOES(depth);}
+inline void glUniformBufferEXT(GLuint program,GLint location,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMBUFFEREXTPROC)this->m_functions[934];if(direct_)return direct_(program,location,buffer);return this->m_rawTable->glUniformBufferEXT(program,location,buffer);}
+inline void glTexCoord2fNormal3fVertex3fvSUN(const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[935];if(direct_)return direct_(tc,n,v);return this->m_rawTable->glTexCoord2fNormal3fVertex3fvSUN(tc,n,v);}
+inline void glMulticastGetQueryObjectuivNV(GLuint gpu,GLuint id,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)this->m_functions[936];if(direct_)return direct_(gpu,id,pname,params);return this->m_rawTable->glMulticastGetQueryObjectuivNV(gpu,id,pname,params);}
+inline void glGetFirstPerfQueryIdINTEL(GLuint* queryId)const{auto const direct_ = (FunctionTable::PFNGLGETFIRSTPERFQUERYIDINTELPROC)this->m_functions[937];if(direct_)return direct_(queryId);return this->m_rawTable->glGetFirstPerfQueryIdINTEL(queryId);}
+inline GLboolean glUnmapNamedBufferEXT(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLUNMAPNAMEDBUFFEREXTPROC)this->m_functions[938];if(direct_)return direct_(buffer);return this->m_rawTable->glUnmapNamedBufferEXT(buffer);}
+inline void glGetTransformFeedbacki_v(GLuint xfb,GLenum pname,GLuint index,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKI_VPROC)this->m_functions[939];if(direct_)return direct_(xfb,pname,index,param);return this->m_rawTable->glGetTransformFeedbacki_v(xfb,pname,index,param);}
+inline void glUniform4fvARB(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4FVARBPROC)this->m_functions[940];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4fvARB(location,count,value);}
+inline void glRenderbufferStorageMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)this->m_functions[941];if(direct_)return direct_(target,coverageSamples,colorSamples,internalformat,width,height);return this->m_rawTable->glRenderbufferStorageMultisampleCoverageNV(target,coverageSamples,colorSamples,internalformat,width,height);}
+inline void glGetFloati_vEXT(GLenum pname,GLuint index,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETFLOATI_VEXTPROC)this->m_functions[942];if(direct_)return direct_(pname,index,params);return this->m_rawTable->glGetFloati_vEXT(pname,index,params);}
+inline void glBindAttribLocationARB(GLhandleARB programObj,GLuint index,const GLcharARB* name)const{auto const direct_ = (FunctionTable::PFNGLBINDATTRIBLOCATIONARBPROC)this->m_functions[943];if(direct_)return direct_(programObj,index,name);return this->m_rawTable->glBindAttribLocationARB(programObj,index,name);}
+inline void glBufferAddressRangeNV(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length)const{auto const direct_ = (FunctionTable::PFNGLBUFFERADDRESSRANGENVPROC)this->m_functions[944];if(direct_)return direct_(pname,index,address,length);return this->m_rawTable->glBufferAddressRangeNV(pname,index,address,length);}
+inline void glGenProgramsARB(GLsizei n,GLuint* programs)const{auto const direct_ = (FunctionTable::PFNGLGENPROGRAMSARBPROC)this->m_functions[945];if(direct_)return direct_(n,programs);return this->m_rawTable->glGenProgramsARB(n,programs);}
+inline void glMultiTexEnvivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXENVIVEXTPROC)this->m_functions[946];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexEnvivEXT(texunit,target,pname,params);}
+inline void glSecondaryColor3uiEXT(GLuint red,GLuint green,GLuint blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UIEXTPROC)this->m_functions[947];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3uiEXT(red,green,blue);}
+inline void glCompressedTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)this->m_functions[948];if(direct_)return direct_(texture,target,level,internalformat,width,height,border,imageSize,bits);return this->m_rawTable->glCompressedTextureImage2DEXT(texture,target,level,internalformat,width,height,border,imageSize,bits);}
+inline void glUniform2i(GLint location,GLint v0,GLint v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2IPROC)this->m_functions[949];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2i(location,v0,v1);}
+inline void glCopyTexImage2DEXT(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXIMAGE2DEXTPROC)this->m_functions[950];if(direct_)return direct_(target,level,internalformat,x,y,width,height,border);return this->m_rawTable->glCopyTexImage2DEXT(target,level,internalformat,x,y,width,height,border);}
+inline void glUniform2d(GLint location,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2DPROC)this->m_functions[951];if(direct_)return direct_(location,x,y);return this->m_rawTable->glUniform2d(location,x,y);}
+inline void glVertexAttribL1d(GLuint index,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1DPROC)this->m_functions[952];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribL1d(index,x);}
+inline void glFramebufferTextureFaceEXT(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)this->m_functions[953];if(direct_)return direct_(target,attachment,texture,level,face);return this->m_rawTable->glFramebufferTextureFaceEXT(target,attachment,texture,level,face);}
+inline void glFramebufferTextureLayer(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURELAYERPROC)this->m_functions[954];if(direct_)return direct_(target,attachment,texture,level,layer);return this->m_rawTable->glFramebufferTextureLayer(target,attachment,texture,level,layer);}
+inline void glMultiTexCoord4bvOES(GLenum texture,const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4BVOESPROC)this->m_functions[955];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord4bvOES(texture,coords);}
+inline void glGetVertexArrayPointeri_vEXT(GLuint vaobj,GLuint index,GLenum pname,void** param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)this->m_functions[956];if(direct_)return direct_(vaobj,index,pname,param);return this->m_rawTable->glGetVertexArrayPointeri_vEXT(vaobj,index,pname,param);}
+inline void glNamedProgramLocalParameter4dEXT(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)this->m_functions[957];if(direct_)return direct_(program,target,index,x,y,z,w);return this->m_rawTable->glNamedProgramLocalParameter4dEXT(program,target,index,x,y,z,w);}
+inline void glBinormal3bEXT(GLbyte bx,GLbyte by,GLbyte bz)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3BEXTPROC)this->m_functions[958];if(direct_)return direct_(bx,by,bz);return this->m_rawTable->glBinormal3bEXT(bx,by,bz);}
+inline void glConvolutionFilter2DEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONFILTER2DEXTPROC)this->m_functions[959];if(direct_)return direct_(target,internalformat,width,height,format,type,image);return this->m_rawTable->glConvolutionFilter2DEXT(target,internalformat,width,height,format,type,image);}
+inline void glProgramUniform2fv(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2FVPROC)this->m_functions[960];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2fv(program,location,count,value);}
+inline void glColor3fVertex3fSUN(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3FVERTEX3FSUNPROC)this->m_functions[961];if(direct_)return direct_(r,g,b,x,y,z);return this->m_rawTable->glColor3fVertex3fSUN(r,g,b,x,y,z);}
+inline void glNormal3fVertex3fvSUN(const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3FVERTEX3FVSUNPROC)this->m_functions[962];if(direct_)return direct_(n,v);return this->m_rawTable->glNormal3fVertex3fvSUN(n,v);}
+inline void glCopyMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)this->m_functions[963];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);return this->m_rawTable->glCopyMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+inline void glProgramLocalParameterI4iNV(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERI4INVPROC)this->m_functions[964];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramLocalParameterI4iNV(target,index,x,y,z,w);}
+inline void glProgramUniformMatrix2x4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)this->m_functions[965];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x4dv(program,location,count,transpose,value);}
+inline GLenum glPathMemoryGlyphIndexArrayNV(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const direct_ = (FunctionTable::PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)this->m_functions[966];if(direct_)return direct_(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);return this->m_rawTable->glPathMemoryGlyphIndexArrayNV(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+inline void glDrawArraysEXT(GLenum mode,GLint first,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSEXTPROC)this->m_functions[967];if(direct_)return direct_(mode,first,count);return this->m_rawTable->glDrawArraysEXT(mode,first,count);}
+inline void glBlendEquationEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONEXTPROC)this->m_functions[968];if(direct_)return direct_(mode);return this->m_rawTable->glBlendEquationEXT(mode);}
+inline void glStencilOp(GLenum fail,GLenum zfail,GLenum zpass)const{auto const direct_ = (FunctionTable::PFNGLSTENCILOPPROC)this->m_functions[969];if(direct_)return direct_(fail,zfail,zpass);return this->m_rawTable->glStencilOp(fail,zfail,zpass);}
+inline void glCopyTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)this->m_functions[970];if(direct_)return direct_(texture,target,level,xoffset,yoffset,x,y,width,height);return this->m_rawTable->glCopyTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,x,y,width,height);}
+inline void glTexEnvf(GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLTEXENVFPROC)this->m_functions[971];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexEnvf(target,pname,param);}
+inline void glVertexAttrib2dvNV(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DVNVPROC)this->m_functions[972];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2dvNV(index,v);}
+inline void glGenPerfMonitorsAMD(GLsizei n,GLuint* monitors)const{auto const direct_ = (FunctionTable::PFNGLGENPERFMONITORSAMDPROC)this->m_functions[973];if(direct_)return direct_(n,monitors);return this->m_rawTable->glGenPerfMonitorsAMD(n,monitors);}
+inline void glGetInteger64i_v(GLenum target,GLuint index,GLint64* data)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGER64I_VPROC)this->m_functions[974];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetInteger64i_v(target,index,data);}
+inline void glGetHistogramParameterfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPARAMETERFVPROC)this->m_functions[975];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetHistogramParameterfv(target,pname,params);}
+inline void glVertexFormatNV(GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXFORMATNVPROC)this->m_functions[976];if(direct_)return direct_(size,type,stride);return this->m_rawTable->glVertexFormatNV(size,type,stride);}
+inline void glBlendFuncIndexedAMD(GLuint buf,GLenum src,GLenum dst)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCINDEXEDAMDPROC)this->m_functions[977];if(direct_)return direct_(buf,src,dst);return this->m_rawTable->glBlendFuncIndexedAMD(buf,src,dst);}
+inline void glTexEnvi(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLTEXENVIPROC)this->m_functions[978];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexEnvi(target,pname,param);}
+inline void glMultiTexCoord1iv(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1IVPROC)this->m_functions[979];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1iv(target,v);}
+inline GLboolean glIsEnabledi(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLISENABLEDIPROC)this->m_functions[980];if(direct_)return direct_(target,index);return this->m_rawTable->glIsEnabledi(target,index);}
+inline void glVertexAttribL2ui64vNV(GLuint index,const GLuint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2UI64VNVPROC)this->m_functions[981];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL2ui64vNV(index,v);}
+inline void glVertexAttribL4i64NV(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4I64NVPROC)this->m_functions[982];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribL4i64NV(index,x,y,z,w);}
+inline void glMatrixTranslatedEXT(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXTRANSLATEDEXTPROC)this->m_functions[983];if(direct_)return direct_(mode,x,y,z);return this->m_rawTable->glMatrixTranslatedEXT(mode,x,y,z);}
+inline void glMakeTextureHandleResidentARB(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)this->m_functions[984];if(direct_)return direct_(handle);return this->m_rawTable->glMakeTextureHandleResidentARB(handle);}
+inline void glMatrixMultdEXT(GLenum mode,const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULTDEXTPROC)this->m_functions[985];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixMultdEXT(mode,m);}
+inline void glBinormal3dvEXT(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3DVEXTPROC)this->m_functions[986];if(direct_)return direct_(v);return this->m_rawTable->glBinormal3dvEXT(v);}
+inline GLsync glImportSyncEXT(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLIMPORTSYNCEXTPROC)this->m_functions[987];if(direct_)return direct_(external_sync_type,external_sync,flags);return this->m_rawTable->glImportSyncEXT(external_sync_type,external_sync,flags);}
+inline void glGetMapiv(GLenum target,GLenum query,GLint* v)const{auto const direct_ = (FunctionTable::PFNGLGETMAPIVPROC)this->m_functions[988];if(direct_)return direct_(target,query,v);return this->m_rawTable->glGetMapiv(target,query,v);}
+inline void glImportSemaphoreFdEXT(GLuint semaphore,GLenum handleType,GLint fd)const{auto const direct_ = (FunctionTable::PFNGLIMPORTSEMAPHOREFDEXTPROC)this->m_functions[989];if(direct_)return direct_(semaphore,handleType,fd);return this->m_rawTable->glImportSemaphoreFdEXT(semaphore,handleType,fd);}
+inline void glMultiTexCoord4sv(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4SVPROC)this->m_functions[990];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4sv(target,v);}
+inline void glPNTrianglesiATI(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPNTRIANGLESIATIPROC)this->m_functions[991];if(direct_)return direct_(pname,param);return this->m_rawTable->glPNTrianglesiATI(pname,param);}
+inline void glBindVertexArrayAPPLE(GLuint array)const{auto const direct_ = (FunctionTable::PFNGLBINDVERTEXARRAYAPPLEPROC)this->m_functions[992];if(direct_)return direct_(array);return this->m_rawTable->glBindVertexArrayAPPLE(array);}
+inline void glObjectPtrLabel(const void* ptr,GLsizei length,const GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLOBJECTPTRLABELPROC)this->m_functions[993];if(direct_)return direct_(ptr,length,label);return this->m_rawTable->glObjectPtrLabel(ptr,length,label);}
+inline GLuint glGetDebugMessageLog(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{auto const direct_ = (FunctionTable::PFNGLGETDEBUGMESSAGELOGPROC)this->m_functions[994];if(direct_)return direct_(count,bufSize,sources,types,ids,severities,lengths,messageLog);return this->m_rawTable->glGetDebugMessageLog(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+inline void glTrackMatrixNV(GLenum target,GLuint address,GLenum matrix,GLenum transform)const{auto const direct_ = (FunctionTable::PFNGLTRACKMATRIXNVPROC)this->m_functions[995];if(direct_)return direct_(target,address,matrix,transform);return this->m_rawTable->glTrackMatrixNV(target,address,matrix,transform);}
+inline void glProgramPathFragmentInputGenNV(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)this->m_functions[996];if(direct_)return direct_(program,location,genMode,components,coeffs);return this->m_rawTable->glProgramPathFragmentInputGenNV(program,location,genMode,components,coeffs);}
+inline void glTangent3ivEXT(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3IVEXTPROC)this->m_functions[997];if(direct_)return direct_(v);return this->m_rawTable->glTangent3ivEXT(v);}
+inline void glGetUniformfv(GLuint program,GLint location,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMFVPROC)this->m_functions[998];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformfv(program,location,params);}
+inline void glSecondaryColor3ubv(const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UBVPROC)this->m_functions[999];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3ubv(v);}
+inline void glMakeTextureHandleNonResidentNV(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)this->m_functions[1000];if(direct_)return direct_(handle);return this->m_rawTable->glMakeTextureHandleNonResidentNV(handle);}
+inline void glVertexAttribs4ubvNV(GLuint index,GLsizei count,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS4UBVNVPROC)this->m_functions[1001];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs4ubvNV(index,count,v);}
+inline void glClipPlanexOES(GLenum plane,const GLfixed* equation)const{auto const direct_ = (FunctionTable::PFNGLCLIPPLANEXOESPROC)this->m_functions[1002];if(direct_)return direct_(plane,equation);return this->m_rawTable->glClipPlanexOES(plane,equation);}
+inline void glMultiTexCoord3iv(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3IVPROC)this->m_functions[1003];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3iv(target,v);}
+inline void glGetnPolygonStippleARB(GLsizei bufSize,GLubyte* pattern)const{auto const direct_ = (FunctionTable::PFNGLGETNPOLYGONSTIPPLEARBPROC)this->m_functions[1004];if(direct_)return direct_(bufSize,pattern);return this->m_rawTable->glGetnPolygonStippleARB(bufSize,pattern);}
+inline void glUniform2i64vNV(GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2I64VNVPROC)this->m_functions[1005];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2i64vNV(location,count,value);}
+inline void glLightModelf(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELFPROC)this->m_functions[1006];if(direct_)return direct_(pname,param);return this->m_rawTable->glLightModelf(pname,param);}
+inline void glDeleteMemoryObjectsEXT(GLsizei n,const GLuint* memoryObjects)const{auto const direct_ = (FunctionTable::PFNGLDELETEMEMORYOBJECTSEXTPROC)this->m_functions[1007];if(direct_)return direct_(n,memoryObjects);return this->m_rawTable->glDeleteMemoryObjectsEXT(n,memoryObjects);}
+inline void glMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXSUBIMAGE2DEXTPROC)this->m_functions[1008];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);return this->m_rawTable->glMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+inline void glReplacementCodeuiColor3fVertex3fSUN(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)this->m_functions[1009];if(direct_)return direct_(rc,r,g,b,x,y,z);return this->m_rawTable->glReplacementCodeuiColor3fVertex3fSUN(rc,r,g,b,x,y,z);}
+inline void glTangent3dvEXT(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3DVEXTPROC)this->m_functions[1010];if(direct_)return direct_(v);return this->m_rawTable->glTangent3dvEXT(v);}
+inline void glLightModeli(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELIPROC)this->m_functions[1011];if(direct_)return direct_(pname,param);return this->m_rawTable->glLightModeli(pname,param);}
+inline void glVertexWeighthvNV(const GLhalfNV* weight)const{auto const direct_ = (FunctionTable::PFNGLVERTEXWEIGHTHVNVPROC)this->m_functions[1012];if(direct_)return direct_(weight);return this->m_rawTable->glVertexWeighthvNV(weight);}
+inline void glWindowPos3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IVPROC)this->m_functions[1013];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3iv(v);}
+inline void glMultiTexCoordP1uiv(GLenum texture,GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP1UIVPROC)this->m_functions[1014];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP1uiv(texture,type,coords);}
+inline void glTransformPathNV(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMPATHNVPROC)this->m_functions[1015];if(direct_)return direct_(resultPath,srcPath,transformType,transformValues);return this->m_rawTable->glTransformPathNV(resultPath,srcPath,transformType,transformValues);}
+inline void glProgramNamedParameter4dNV(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMNAMEDPARAMETER4DNVPROC)this->m_functions[1016];if(direct_)return direct_(id,len,name,x,y,z,w);return this->m_rawTable->glProgramNamedParameter4dNV(id,len,name,x,y,z,w);}
+inline void glMultiDrawElementsIndirect(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTPROC)this->m_functions[1017];if(direct_)return direct_(mode,type,indirect,drawcount,stride);return this->m_rawTable->glMultiDrawElementsIndirect(mode,type,indirect,drawcount,stride);}
+inline void glProgramUniform1dEXT(GLuint program,GLint location,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1DEXTPROC)this->m_functions[1018];if(direct_)return direct_(program,location,x);return this->m_rawTable->glProgramUniform1dEXT(program,location,x);}
+inline void glCallLists(GLsizei n,GLenum type,const GLvoid* lists)const{auto const direct_ = (FunctionTable::PFNGLCALLLISTSPROC)this->m_functions[1019];if(direct_)return direct_(n,type,lists);return this->m_rawTable->glCallLists(n,type,lists);}
+inline void glNormal3hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3HVNVPROC)this->m_functions[1020];if(direct_)return direct_(v);return this->m_rawTable->glNormal3hvNV(v);}
+inline void glGetCombinerOutputParameterfvNV(GLenum stage,GLenum portion,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)this->m_functions[1021];if(direct_)return direct_(stage,portion,pname,params);return this->m_rawTable->glGetCombinerOutputParameterfvNV(stage,portion,pname,params);}
+inline void glVertexAttrib4sARB(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SARBPROC)this->m_functions[1022];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4sARB(index,x,y,z,w);}
+inline void glTexCoord3i(GLint s,GLint t,GLint r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3IPROC)this->m_functions[1023];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3i(s,t,r);}
+inline void glVertexAttribI3uiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3UIVPROC)this->m_functions[1024];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI3uiv(index,v);}
+inline void glPushDebugGroup(GLenum source,GLuint id,GLsizei length,const GLchar* message)const{auto const direct_ = (FunctionTable::PFNGLPUSHDEBUGGROUPPROC)this->m_functions[1025];if(direct_)return direct_(source,id,length,message);return this->m_rawTable->glPushDebugGroup(source,id,length,message);}
+inline void glTexCoord3f(GLfloat s,GLfloat t,GLfloat r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3FPROC)this->m_functions[1026];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3f(s,t,r);}
+inline void glTexCoord3d(GLdouble s,GLdouble t,GLdouble r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3DPROC)this->m_functions[1027];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3d(s,t,r);}
+inline void glTexCoord2xOES(GLfixed s,GLfixed t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2XOESPROC)this->m_functions[1028];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2xOES(s,t);}
+inline GLushort glGetStageIndexNV(GLenum shadertype)const{auto const direct_ = (FunctionTable::PFNGLGETSTAGEINDEXNVPROC)this->m_functions[1029];if(direct_)return direct_(shadertype);return this->m_rawTable->glGetStageIndexNV(shadertype);}
+inline void glProgramUniform4i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4I64VNVPROC)this->m_functions[1030];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4i64vNV(program,location,count,value);}
+inline void glGetNamedBufferPointervEXT(GLuint buffer,GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPOINTERVEXTPROC)this->m_functions[1031];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferPointervEXT(buffer,pname,params);}
+inline void glTextureBarrierNV()const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBARRIERNVPROC)this->m_functions[1032];if(direct_)return direct_();return this->m_rawTable->glTextureBarrierNV();}
+inline void glColor4ubVertex3fvSUN(const GLubyte* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBVERTEX3FVSUNPROC)this->m_functions[1033];if(direct_)return direct_(c,v);return this->m_rawTable->glColor4ubVertex3fvSUN(c,v);}
+inline GLuint glGetCommandHeaderNV(GLenum tokenID,GLuint size)const{auto const direct_ = (FunctionTable::PFNGLGETCOMMANDHEADERNVPROC)this->m_functions[1034];if(direct_)return direct_(tokenID,size);return this->m_rawTable->glGetCommandHeaderNV(tokenID,size);}
+inline void glGetPerfMonitorCounterInfoAMD(GLuint group,GLuint counter,GLenum pname,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORCOUNTERINFOAMDPROC)this->m_functions[1035];if(direct_)return direct_(group,counter,pname,data);return this->m_rawTable->glGetPerfMonitorCounterInfoAMD(group,counter,pname,data);}
+inline void glVertexAttrib1svARB(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SVARBPROC)this->m_functions[1036];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1svARB(index,v);}
+inline void glCombinerParameteriNV(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERPARAMETERINVPROC)this->m_functions[1037];if(direct_)return direct_(pname,param);return this->m_rawTable->glCombinerParameteriNV(pname,param);}
+inline void glMatrixMultTransposefEXT(GLenum mode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULTTRANSPOSEFEXTPROC)this->m_functions[1038];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixMultTransposefEXT(mode,m);}
+inline void glDetailTexFuncSGIS(GLenum target,GLsizei n,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLDETAILTEXFUNCSGISPROC)this->m_functions[1039];if(direct_)return direct_(target,n,points);return this->m_rawTable->glDetailTexFuncSGIS(target,n,points);}
+inline GLboolean glAreTexturesResident(GLsizei n,const GLuint* textures,GLboolean* residences)const{auto const direct_ = (FunctionTable::PFNGLARETEXTURESRESIDENTPROC)this->m_functions[1040];if(direct_)return direct_(n,textures,residences);return this->m_rawTable->glAreTexturesResident(n,textures,residences);}
+inline void glProgramUniform2d(GLuint program,GLint location,GLdouble v0,GLdouble v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2DPROC)this->m_functions[1041];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2d(program,location,v0,v1);}
+inline void glGetConvolutionParameterfvEXT(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)this->m_functions[1042];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetConvolutionParameterfvEXT(target,pname,params);}
+inline void glIndexPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLINDEXPOINTERLISTIBMPROC)this->m_functions[1043];if(direct_)return direct_(type,stride,pointer,ptrstride);return this->m_rawTable->glIndexPointerListIBM(type,stride,pointer,ptrstride);}
+inline void glVertexAttribI4iEXT(GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4IEXTPROC)this->m_functions[1044];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribI4iEXT(index,x,y,z,w);}
+inline void glProgramUniform2f(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2FPROC)this->m_functions[1045];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2f(program,location,v0,v1);}
+inline void glRasterPos4sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4SVPROC)this->m_functions[1046];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos4sv(v);}
+inline void glColor4s(GLshort red,GLshort green,GLshort blue,GLshort alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4SPROC)this->m_functions[1047];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4s(red,green,blue,alpha);}
+inline void glMulticastGetQueryObjectivNV(GLuint gpu,GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTGETQUERYOBJECTIVNVPROC)this->m_functions[1048];if(direct_)return direct_(gpu,id,pname,params);return this->m_rawTable->glMulticastGetQueryObjectivNV(gpu,id,pname,params);}
+inline void glColorFragmentOp3ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{auto const direct_ = (FunctionTable::PFNGLCOLORFRAGMENTOP3ATIPROC)this->m_functions[1049];if(direct_)return direct_(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);return this->m_rawTable->glColorFragmentOp3ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+inline void glResizeBuffersMESA()const{auto const direct_ = (FunctionTable::PFNGLRESIZEBUFFERSMESAPROC)this->m_functions[1050];if(direct_)return direct_();return this->m_rawTable->glResizeBuffersMESA();}
+inline void glGetMinmaxParameterfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXPARAMETERFVPROC)this->m_functions[1051];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMinmaxParameterfv(target,pname,params);}
+inline void glClientActiveTextureARB(GLenum texture)const{auto const direct_ = (FunctionTable::PFNGLCLIENTACTIVETEXTUREARBPROC)this->m_functions[1052];if(direct_)return direct_(texture);return this->m_rawTable->glClientActiveTextureARB(texture);}
+inline void glBindVertexArray(GLuint array)const{auto const direct_ = (FunctionTable::PFNGLBINDVERTEXARRAYPROC)this->m_functions[1053];if(direct_)return direct_(array);return this->m_rawTable->glBindVertexArray(array);}
+inline void glColor4b(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4BPROC)this->m_functions[1054];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4b(red,green,blue,alpha);}
+inline void glColor4f(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4FPROC)this->m_functions[1055];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4f(red,green,blue,alpha);}
+inline void glColor4d(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4DPROC)this->m_functions[1056];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4d(red,green,blue,alpha);}
+inline void glColor4i(GLint red,GLint green,GLint blue,GLint alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4IPROC)this->m_functions[1057];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColor4i(red,green,blue,alpha);}
+inline void glEdgeFlagFormatNV(GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGFORMATNVPROC)this->m_functions[1058];if(direct_)return direct_(stride);return this->m_rawTable->glEdgeFlagFormatNV(stride);}
+inline void glNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSUBDATAPROC)this->m_functions[1059];if(direct_)return direct_(buffer,offset,size,data);return this->m_rawTable->glNamedBufferSubData(buffer,offset,size,data);}
+inline void glDrawElementsInstanced(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDPROC)this->m_functions[1060];if(direct_)return direct_(mode,count,type,indices,instancecount);return this->m_rawTable->glDrawElementsInstanced(mode,count,type,indices,instancecount);}
+inline void glGetMultiTexParameterIivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXPARAMETERIIVEXTPROC)this->m_functions[1061];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexParameterIivEXT(texunit,target,pname,params);}
+inline void glVertex2dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2DVPROC)this->m_functions[1062];if(direct_)return direct_(v);return this->m_rawTable->glVertex2dv(v);}
+inline void glDisableVertexArrayAttribEXT(GLuint vaobj,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)this->m_functions[1063];if(direct_)return direct_(vaobj,index);return this->m_rawTable->glDisableVertexArrayAttribEXT(vaobj,index);}
+inline GLenum glObjectUnpurgeableAPPLE(GLenum objectType,GLuint name,GLenum option)const{auto const direct_ = (FunctionTable::PFNGLOBJECTUNPURGEABLEAPPLEPROC)this->m_functions[1064];if(direct_)return direct_(objectType,name,option);return this->m_rawTable->glObjectUnpurgeableAPPLE(objectType,name,option);}
+inline void glVertexAttribs2dvNV(GLuint index,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS2DVNVPROC)this->m_functions[1065];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs2dvNV(index,count,v);}
+inline void glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)this->m_functions[1066];if(direct_)return direct_(rc,s,t,x,y,z);return this->m_rawTable->glReplacementCodeuiTexCoord2fVertex3fSUN(rc,s,t,x,y,z);}
+inline void glGetMapParameterfvNV(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMAPPARAMETERFVNVPROC)this->m_functions[1067];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMapParameterfvNV(target,pname,params);}
+inline void glProgramUniform4ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4IVEXTPROC)this->m_functions[1068];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4ivEXT(program,location,count,value);}
+inline void glProgramUniform3ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UI64VNVPROC)this->m_functions[1069];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3ui64vNV(program,location,count,value);}
+inline void glRectfv(const GLfloat* v1,const GLfloat* v2)const{auto const direct_ = (FunctionTable::PFNGLRECTFVPROC)this->m_functions[1070];if(direct_)return direct_(v1,v2);return this->m_rawTable->glRectfv(v1,v2);}
+inline void glTexFilterFuncSGIS(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights)const{auto const direct_ = (FunctionTable::PFNGLTEXFILTERFUNCSGISPROC)this->m_functions[1071];if(direct_)return direct_(target,filter,n,weights);return this->m_rawTable->glTexFilterFuncSGIS(target,filter,n,weights);}
+inline void glSpriteParameterfvSGIX(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLSPRITEPARAMETERFVSGIXPROC)this->m_functions[1072];if(direct_)return direct_(pname,params);return this->m_rawTable->glSpriteParameterfvSGIX(pname,params);}
+inline void glCopyMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYMULTITEXIMAGE1DEXTPROC)this->m_functions[1073];if(direct_)return direct_(texunit,target,level,internalformat,x,y,width,border);return this->m_rawTable->glCopyMultiTexImage1DEXT(texunit,target,level,internalformat,x,y,width,border);}
+inline void glGetVertexAttribIuivEXT(GLuint index,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIUIVEXTPROC)this->m_functions[1074];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribIuivEXT(index,pname,params);}
+inline void glUniformMatrix2x4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2X4DVPROC)this->m_functions[1075];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2x4dv(location,count,transpose,value);}
+inline GLint glGetProgramResourceLocationIndex(GLuint program,GLenum programInterface,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)this->m_functions[1076];if(direct_)return direct_(program,programInterface,name);return this->m_rawTable->glGetProgramResourceLocationIndex(program,programInterface,name);}
+inline void glColor3hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3HNVPROC)this->m_functions[1077];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3hNV(red,green,blue);}
+inline void glViewport(GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTPROC)this->m_functions[1078];if(direct_)return direct_(x,y,width,height);return this->m_rawTable->glViewport(x,y,width,height);}
+inline void glProgramNamedParameter4fNV(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMNAMEDPARAMETER4FNVPROC)this->m_functions[1079];if(direct_)return direct_(id,len,name,x,y,z,w);return this->m_rawTable->glProgramNamedParameter4fNV(id,len,name,x,y,z,w);}
+inline void glGetInvariantBooleanvEXT(GLuint id,GLenum value,GLboolean* data)const{auto const direct_ = (FunctionTable::PFNGLGETINVARIANTBOOLEANVEXTPROC)this->m_functions[1080];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetInvariantBooleanvEXT(id,value,data);}
+inline void glTexStorage2DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGE2DMULTISAMPLEPROC)this->m_functions[1081];if(direct_)return direct_(target,samples,internalformat,width,height,fixedsamplelocations);return this->m_rawTable->glTexStorage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+inline void glPixelStorex(GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLPIXELSTOREXPROC)this->m_functions[1082];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelStorex(pname,param);}
+inline void glVertexAttribL1dvEXT(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1DVEXTPROC)this->m_functions[1083];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL1dvEXT(index,v);}
+inline void glGetActiveSubroutineUniformiv(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)this->m_functions[1084];if(direct_)return direct_(program,shadertype,index,pname,values);return this->m_rawTable->glGetActiveSubroutineUniformiv(program,shadertype,index,pname,values);}
+inline void glVertexAttribPointerARB(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBPOINTERARBPROC)this->m_functions[1085];if(direct_)return direct_(index,size,type,normalized,stride,pointer);return this->m_rawTable->glVertexAttribPointerARB(index,size,type,normalized,stride,pointer);}
+inline void glCompressedTexSubImage2DARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)this->m_functions[1086];if(direct_)return direct_(target,level,xoffset,yoffset,width,height,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage2DARB(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+inline void glTexStorageMem1DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGEMEM1DEXTPROC)this->m_functions[1087];if(direct_)return direct_(target,levels,internalFormat,width,memory,offset);return this->m_rawTable->glTexStorageMem1DEXT(target,levels,internalFormat,width,memory,offset);}
+inline void glVertex2hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2HVNVPROC)this->m_functions[1088];if(direct_)return direct_(v);return this->m_rawTable->glVertex2hvNV(v);}
+inline void glTexBuffer(GLenum target,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTEXBUFFERPROC)this->m_functions[1089];if(direct_)return direct_(target,internalformat,buffer);return this->m_rawTable->glTexBuffer(target,internalformat,buffer);}
+inline void glArrayElement(GLint i)const{auto const direct_ = (FunctionTable::PFNGLARRAYELEMENTPROC)this->m_functions[1090];if(direct_)return direct_(i);return this->m_rawTable->glArrayElement(i);}
+inline void glValidateProgram(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLVALIDATEPROGRAMPROC)this->m_functions[1091];if(direct_)return direct_(program);return this->m_rawTable->glValidateProgram(program);}
+inline void glPixelStoref(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPIXELSTOREFPROC)this->m_functions[1092];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelStoref(pname,param);}
+inline void glWindowPos3dARB(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DARBPROC)this->m_functions[1093];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3dARB(x,y,z);}
+inline void glEvalCoord1dv(const GLdouble* u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1DVPROC)this->m_functions[1094];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord1dv(u);}
+inline void glVertexAttribs2fvNV(GLuint index,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS2FVNVPROC)this->m_functions[1095];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs2fvNV(index,count,v);}
+inline void glRecti(GLint x1,GLint y1,GLint x2,GLint y2)const{auto const direct_ = (FunctionTable::PFNGLRECTIPROC)this->m_functions[1096];if(direct_)return direct_(x1,y1,x2,y2);return this->m_rawTable->glRecti(x1,y1,x2,y2);}
+inline void glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[1097];if(direct_)return direct_(rc,tc,c,n,v);return this->m_rawTable->glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc,tc,c,n,v);}
+inline void glTexCoord1bOES(GLbyte s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1BOESPROC)this->m_functions[1098];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1bOES(s);}
+inline void glProgramUniform2i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2I64VARBPROC)this->m_functions[1099];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2i64vARB(program,location,count,value);}
+inline void glWindowPos2dARB(GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DARBPROC)this->m_functions[1100];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2dARB(x,y);}
+inline void glGetProgramParameterdvNV(GLenum target,GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMPARAMETERDVNVPROC)this->m_functions[1101];if(direct_)return direct_(target,index,pname,params);return this->m_rawTable->glGetProgramParameterdvNV(target,index,pname,params);}
+inline void glRectf(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2)const{auto const direct_ = (FunctionTable::PFNGLRECTFPROC)this->m_functions[1102];if(direct_)return direct_(x1,y1,x2,y2);return this->m_rawTable->glRectf(x1,y1,x2,y2);}
+inline void glRectd(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2)const{auto const direct_ = (FunctionTable::PFNGLRECTDPROC)this->m_functions[1103];if(direct_)return direct_(x1,y1,x2,y2);return this->m_rawTable->glRectd(x1,y1,x2,y2);}
+inline void glMap1xOES(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points)const{auto const direct_ = (FunctionTable::PFNGLMAP1XOESPROC)this->m_functions[1104];if(direct_)return direct_(target,u1,u2,stride,order,points);return this->m_rawTable->glMap1xOES(target,u1,u2,stride,order,points);}
+inline void glVertexAttrib3fvNV(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FVNVPROC)this->m_functions[1105];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3fvNV(index,v);}
+inline void glReferencePlaneSGIX(const GLdouble* equation)const{auto const direct_ = (FunctionTable::PFNGLREFERENCEPLANESGIXPROC)this->m_functions[1106];if(direct_)return direct_(equation);return this->m_rawTable->glReferencePlaneSGIX(equation);}
+inline void glMulticastBlitFramebufferNV(GLuint srcGpu,GLuint dstGpu,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTBLITFRAMEBUFFERNVPROC)this->m_functions[1107];if(direct_)return direct_(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);return this->m_rawTable->glMulticastBlitFramebufferNV(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+inline void glGetCombinerInputParameterfvNV(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)this->m_functions[1108];if(direct_)return direct_(stage,portion,variable,pname,params);return this->m_rawTable->glGetCombinerInputParameterfvNV(stage,portion,variable,pname,params);}
+inline GLuint64 glGetTextureSamplerHandleARB(GLuint texture,GLuint sampler)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURESAMPLERHANDLEARBPROC)this->m_functions[1109];if(direct_)return direct_(texture,sampler);return this->m_rawTable->glGetTextureSamplerHandleARB(texture,sampler);}
+inline void glBindTexture(GLenum target,GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXTUREPROC)this->m_functions[1110];if(direct_)return direct_(target,texture);return this->m_rawTable->glBindTexture(target,texture);}
+inline void glRects(GLshort x1,GLshort y1,GLshort x2,GLshort y2)const{auto const direct_ = (FunctionTable::PFNGLRECTSPROC)this->m_functions[1111];if(direct_)return direct_(x1,y1,x2,y2);return this->m_rawTable->glRects(x1,y1,x2,y2);}
+inline void glGetActiveAttribARB(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEATTRIBARBPROC)this->m_functions[1112];if(direct_)return direct_(programObj,index,maxLength,length,size,type,name);return this->m_rawTable->glGetActiveAttribARB(programObj,index,maxLength,length,size,type,name);}
+inline void glHistogramEXT(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{auto const direct_ = (FunctionTable::PFNGLHISTOGRAMEXTPROC)this->m_functions[1113];if(direct_)return direct_(target,width,internalformat,sink);return this->m_rawTable->glHistogramEXT(target,width,internalformat,sink);}
+inline GLuint64 glGetTextureSamplerHandleNV(GLuint texture,GLuint sampler)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURESAMPLERHANDLENVPROC)this->m_functions[1114];if(direct_)return direct_(texture,sampler);return this->m_rawTable->glGetTextureSamplerHandleNV(texture,sampler);}
+inline void glDetachShader(GLuint program,GLuint shader)const{auto const direct_ = (FunctionTable::PFNGLDETACHSHADERPROC)this->m_functions[1115];if(direct_)return direct_(program,shader);return this->m_rawTable->glDetachShader(program,shader);}
+inline void glFinishTextureSUNX()const{auto const direct_ = (FunctionTable::PFNGLFINISHTEXTURESUNXPROC)this->m_functions[1116];if(direct_)return direct_();return this->m_rawTable->glFinishTextureSUNX();}
+inline void glUniformMatrix3x4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3X4DVPROC)this->m_functions[1117];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3x4dv(location,count,transpose,value);}
+inline void glVertexAttrib4fARB(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FARBPROC)this->m_functions[1118];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4fARB(index,x,y,z,w);}
+inline void glGetPathColorGenivNV(GLenum color,GLenum pname,GLint* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHCOLORGENIVNVPROC)this->m_functions[1119];if(direct_)return direct_(color,pname,value);return this->m_rawTable->glGetPathColorGenivNV(color,pname,value);}
+inline GLint glGetProgramResourceLocation(GLuint program,GLenum programInterface,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCELOCATIONPROC)this->m_functions[1120];if(direct_)return direct_(program,programInterface,name);return this->m_rawTable->glGetProgramResourceLocation(program,programInterface,name);}
+inline void glVertexArrayAttribLFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYATTRIBLFORMATPROC)this->m_functions[1121];if(direct_)return direct_(vaobj,attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexArrayAttribLFormat(vaobj,attribindex,size,type,relativeoffset);}
+inline void glGetTexLevelParameterfv(GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXLEVELPARAMETERFVPROC)this->m_functions[1122];if(direct_)return direct_(target,level,pname,params);return this->m_rawTable->glGetTexLevelParameterfv(target,level,pname,params);}
+inline void glVertexArrayVertexAttribOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)this->m_functions[1123];if(direct_)return direct_(vaobj,buffer,index,size,type,normalized,stride,offset);return this->m_rawTable->glVertexArrayVertexAttribOffsetEXT(vaobj,buffer,index,size,type,normalized,stride,offset);}
+inline void glIndexFormatNV(GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLINDEXFORMATNVPROC)this->m_functions[1124];if(direct_)return direct_(type,stride);return this->m_rawTable->glIndexFormatNV(type,stride);}
+inline void glMultiTexCoord3i(GLenum target,GLint s,GLint t,GLint r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3IPROC)this->m_functions[1125];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3i(target,s,t,r);}
+inline void glReplacementCodeuiVertex3fvSUN(const GLuint* rc,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)this->m_functions[1126];if(direct_)return direct_(rc,v);return this->m_rawTable->glReplacementCodeuiVertex3fvSUN(rc,v);}
+inline void glViewportIndexedfv(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTINDEXEDFVPROC)this->m_functions[1127];if(direct_)return direct_(index,v);return this->m_rawTable->glViewportIndexedfv(index,v);}
+inline void glBindBuffersBase(GLenum target,GLuint first,GLsizei count,const GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERSBASEPROC)this->m_functions[1128];if(direct_)return direct_(target,first,count,buffers);return this->m_rawTable->glBindBuffersBase(target,first,count,buffers);}
+inline void glTexBumpParameterfvATI(GLenum pname,const GLfloat* param)const{auto const direct_ = (FunctionTable::PFNGLTEXBUMPPARAMETERFVATIPROC)this->m_functions[1129];if(direct_)return direct_(pname,param);return this->m_rawTable->glTexBumpParameterfvATI(pname,param);}
+inline void glMatrixIndexuivARB(GLint size,const GLuint* indices)const{auto const direct_ = (FunctionTable::PFNGLMATRIXINDEXUIVARBPROC)this->m_functions[1130];if(direct_)return direct_(size,indices);return this->m_rawTable->glMatrixIndexuivARB(size,indices);}
+inline void glVertexAttrib1hNV(GLuint index,GLhalfNV x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1HNVPROC)this->m_functions[1131];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1hNV(index,x);}
+inline void glWindowPos3svMESA(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SVMESAPROC)this->m_functions[1132];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3svMESA(v);}
+inline void glStencilOpSeparateATI(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{auto const direct_ = (FunctionTable::PFNGLSTENCILOPSEPARATEATIPROC)this->m_functions[1133];if(direct_)return direct_(face,sfail,dpfail,dppass);return this->m_rawTable->glStencilOpSeparateATI(face,sfail,dpfail,dppass);}
+inline void glDrawElementsBaseVertex(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSBASEVERTEXPROC)this->m_functions[1134];if(direct_)return direct_(mode,count,type,indices,basevertex);return this->m_rawTable->glDrawElementsBaseVertex(mode,count,type,indices,basevertex);}
+inline void glBlendEquationSeparateiARB(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONSEPARATEIARBPROC)this->m_functions[1135];if(direct_)return direct_(buf,modeRGB,modeAlpha);return this->m_rawTable->glBlendEquationSeparateiARB(buf,modeRGB,modeAlpha);}
+inline void glVertexAttrib1fNV(GLuint index,GLfloat x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FNVPROC)this->m_functions[1136];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1fNV(index,x);}
+inline void glMapVertexAttrib2fAPPLE(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLMAPVERTEXATTRIB2FAPPLEPROC)this->m_functions[1137];if(direct_)return direct_(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);return this->m_rawTable->glMapVertexAttrib2fAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+inline void glCompressedTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)this->m_functions[1138];if(direct_)return direct_(texture,target,level,xoffset,width,format,imageSize,bits);return this->m_rawTable->glCompressedTextureSubImage1DEXT(texture,target,level,xoffset,width,format,imageSize,bits);}
+inline void glClearBufferSubData(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERSUBDATAPROC)this->m_functions[1139];if(direct_)return direct_(target,internalformat,offset,size,format,type,data);return this->m_rawTable->glClearBufferSubData(target,internalformat,offset,size,format,type,data);}
+inline void glTexStorage1D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGE1DPROC)this->m_functions[1140];if(direct_)return direct_(target,levels,internalformat,width);return this->m_rawTable->glTexStorage1D(target,levels,internalformat,width);}
+inline void glVertexAttribI3iEXT(GLuint index,GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3IEXTPROC)this->m_functions[1141];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribI3iEXT(index,x,y,z);}
+inline void glMakeTextureHandleNonResidentARB(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)this->m_functions[1142];if(direct_)return direct_(handle);return this->m_rawTable->glMakeTextureHandleNonResidentARB(handle);}
+inline void glMultiDrawElementArrayAPPLE(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)this->m_functions[1143];if(direct_)return direct_(mode,first,count,primcount);return this->m_rawTable->glMultiDrawElementArrayAPPLE(mode,first,count,primcount);}
+inline void glVertexStream4dATI(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4DATIPROC)this->m_functions[1144];if(direct_)return direct_(stream,x,y,z,w);return this->m_rawTable->glVertexStream4dATI(stream,x,y,z,w);}
+inline void glProgramUniformMatrix2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)this->m_functions[1145];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2dvEXT(program,location,count,transpose,value);}
+inline void glVertexAttribs2hvNV(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS2HVNVPROC)this->m_functions[1146];if(direct_)return direct_(index,n,v);return this->m_rawTable->glVertexAttribs2hvNV(index,n,v);}
+inline void glGetUniformiv(GLuint program,GLint location,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMIVPROC)this->m_functions[1147];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformiv(program,location,params);}
+inline void glClipPlanefOES(GLenum plane,const GLfloat* equation)const{auto const direct_ = (FunctionTable::PFNGLCLIPPLANEFOESPROC)this->m_functions[1148];if(direct_)return direct_(plane,equation);return this->m_rawTable->glClipPlanefOES(plane,equation);}
+inline void glRenderbufferStorage(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLRENDERBUFFERSTORAGEPROC)this->m_functions[1149];if(direct_)return direct_(target,internalformat,width,height);return this->m_rawTable->glRenderbufferStorage(target,internalformat,width,height);}
+inline void glUniform4ui(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UIPROC)this->m_functions[1150];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4ui(location,v0,v1,v2,v3);}
+inline void glBindFramebuffer(GLenum target,GLuint framebuffer)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAMEBUFFERPROC)this->m_functions[1151];if(direct_)return direct_(target,framebuffer);return this->m_rawTable->glBindFramebuffer(target,framebuffer);}
+inline void glValidateProgramARB(GLhandleARB programObj)const{auto const direct_ = (FunctionTable::PFNGLVALIDATEPROGRAMARBPROC)this->m_functions[1152];if(direct_)return direct_(programObj);return this->m_rawTable->glValidateProgramARB(programObj);}
+inline void glTexGenf(GLenum coord,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLTEXGENFPROC)this->m_functions[1153];if(direct_)return direct_(coord,pname,param);return this->m_rawTable->glTexGenf(coord,pname,param);}
+inline void glTexGend(GLenum coord,GLenum pname,GLdouble param)const{auto const direct_ = (FunctionTable::PFNGLTEXGENDPROC)this->m_functions[1154];if(direct_)return direct_(coord,pname,param);return this->m_rawTable->glTexGend(coord,pname,param);}
+inline void glTexGeni(GLenum coord,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLTEXGENIPROC)this->m_functions[1155];if(direct_)return direct_(coord,pname,param);return this->m_rawTable->glTexGeni(coord,pname,param);}
+inline void glDeleteFramebuffersEXT(GLsizei n,const GLuint* framebuffers)const{auto const direct_ = (FunctionTable::PFNGLDELETEFRAMEBUFFERSEXTPROC)this->m_functions[1156];if(direct_)return direct_(n,framebuffers);return this->m_rawTable->glDeleteFramebuffersEXT(n,framebuffers);}
+inline void glResetMinmaxEXT(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLRESETMINMAXEXTPROC)this->m_functions[1157];if(direct_)return direct_(target);return this->m_rawTable->glResetMinmaxEXT(target);}
+inline void glVertexAttrib1fvNV(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FVNVPROC)this->m_functions[1158];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1fvNV(index,v);}
+inline GLboolean glIsQueryARB(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISQUERYARBPROC)this->m_functions[1159];if(direct_)return direct_(id);return this->m_rawTable->glIsQueryARB(id);}
+inline void glEnableVariantClientStateEXT(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLENABLEVARIANTCLIENTSTATEEXTPROC)this->m_functions[1160];if(direct_)return direct_(id);return this->m_rawTable->glEnableVariantClientStateEXT(id);}
+inline void glScissorIndexed(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLSCISSORINDEXEDPROC)this->m_functions[1161];if(direct_)return direct_(index,left,bottom,width,height);return this->m_rawTable->glScissorIndexed(index,left,bottom,width,height);}
+inline void glGetInvariantIntegervEXT(GLuint id,GLenum value,GLint* data)const{auto const direct_ = (FunctionTable::PFNGLGETINVARIANTINTEGERVEXTPROC)this->m_functions[1162];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetInvariantIntegervEXT(id,value,data);}
+inline void glProgramLocalParameterI4uiNV(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERI4UINVPROC)this->m_functions[1163];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramLocalParameterI4uiNV(target,index,x,y,z,w);}
+inline void glConvolutionParameterxvOES(GLenum target,GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERXVOESPROC)this->m_functions[1164];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterxvOES(target,pname,params);}
+inline void glGenFramebuffersEXT(GLsizei n,GLuint* framebuffers)const{auto const direct_ = (FunctionTable::PFNGLGENFRAMEBUFFERSEXTPROC)this->m_functions[1165];if(direct_)return direct_(n,framebuffers);return this->m_rawTable->glGenFramebuffersEXT(n,framebuffers);}
+inline void glVertexArrayColorOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYCOLOROFFSETEXTPROC)this->m_functions[1166];if(direct_)return direct_(vaobj,buffer,size,type,stride,offset);return this->m_rawTable->glVertexArrayColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+inline void glMultiTexCoord3ivARB(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3IVARBPROC)this->m_functions[1167];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3ivARB(target,v);}
+inline void glVertexWeightfEXT(GLfloat weight)const{auto const direct_ = (FunctionTable::PFNGLVERTEXWEIGHTFEXTPROC)this->m_functions[1168];if(direct_)return direct_(weight);return this->m_rawTable->glVertexWeightfEXT(weight);}
+inline void glRasterPos4dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4DVPROC)this->m_functions[1169];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos4dv(v);}
+inline GLboolean glIsTextureHandleResidentARB(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLISTEXTUREHANDLERESIDENTARBPROC)this->m_functions[1170];if(direct_)return direct_(handle);return this->m_rawTable->glIsTextureHandleResidentARB(handle);}
+inline void glRasterPos2dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2DVPROC)this->m_functions[1171];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos2dv(v);}
+inline void glWindowPos4ivMESA(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4IVMESAPROC)this->m_functions[1172];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos4ivMESA(v);}
+inline void glGetVariantPointervEXT(GLuint id,GLenum value,void** data)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTPOINTERVEXTPROC)this->m_functions[1173];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetVariantPointervEXT(id,value,data);}
+inline void* glMapNamedBufferRangeEXT(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const direct_ = (FunctionTable::PFNGLMAPNAMEDBUFFERRANGEEXTPROC)this->m_functions[1174];if(direct_)return direct_(buffer,offset,length,access);return this->m_rawTable->glMapNamedBufferRangeEXT(buffer,offset,length,access);}
+inline void glGetnUniformui64vARB(GLuint program,GLint location,GLsizei bufSize,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMUI64VARBPROC)this->m_functions[1175];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformui64vARB(program,location,bufSize,params);}
+inline GLuint glCreateShaderProgramv(GLenum type,GLsizei count,const GLchar*const* strings)const{auto const direct_ = (FunctionTable::PFNGLCREATESHADERPROGRAMVPROC)this->m_functions[1176];if(direct_)return direct_(type,count,strings);return this->m_rawTable->glCreateShaderProgramv(type,count,strings);}
+inline void glGetQueryObjectiv(GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTIVPROC)this->m_functions[1177];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectiv(id,pname,params);}
+inline void glMaxShaderCompilerThreadsKHR(GLuint count)const{auto const direct_ = (FunctionTable::PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)this->m_functions[1178];if(direct_)return direct_(count);return this->m_rawTable->glMaxShaderCompilerThreadsKHR(count);}
+inline void glPNTrianglesfATI(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPNTRIANGLESFATIPROC)this->m_functions[1179];if(direct_)return direct_(pname,param);return this->m_rawTable->glPNTrianglesfATI(pname,param);}
+inline void glGlobalAlphaFactorusSUN(GLushort factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORUSSUNPROC)this->m_functions[1180];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactorusSUN(factor);}
+inline void glVertexAttrib3dvNV(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DVNVPROC)this->m_functions[1181];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3dvNV(index,v);}
+inline void glMultiTexCoord3sARB(GLenum target,GLshort s,GLshort t,GLshort r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3SARBPROC)this->m_functions[1182];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3sARB(target,s,t,r);}
+inline void glGenerateMipmap(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLGENERATEMIPMAPPROC)this->m_functions[1183];if(direct_)return direct_(target);return this->m_rawTable->glGenerateMipmap(target);}
+inline void glCompressedTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)this->m_functions[1184];if(direct_)return direct_(texture,level,xoffset,yoffset,width,height,format,imageSize,data);return this->m_rawTable->glCompressedTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,imageSize,data);}
+inline void glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)this->m_functions[1185];if(direct_)return direct_(renderbuffer,samples,internalformat,width,height);return this->m_rawTable->glNamedRenderbufferStorageMultisampleEXT(renderbuffer,samples,internalformat,width,height);}
+inline void glPolygonOffsetClampEXT(GLfloat factor,GLfloat units,GLfloat clamp)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONOFFSETCLAMPEXTPROC)this->m_functions[1186];if(direct_)return direct_(factor,units,clamp);return this->m_rawTable->glPolygonOffsetClampEXT(factor,units,clamp);}
+inline void glTextureRangeAPPLE(GLenum target,GLsizei length,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLTEXTURERANGEAPPLEPROC)this->m_functions[1187];if(direct_)return direct_(target,length,pointer);return this->m_rawTable->glTextureRangeAPPLE(target,length,pointer);}
+inline void glBlendEquationIndexedAMD(GLuint buf,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONINDEXEDAMDPROC)this->m_functions[1188];if(direct_)return direct_(buf,mode);return this->m_rawTable->glBlendEquationIndexedAMD(buf,mode);}
+inline void glTexCoord2d(GLdouble s,GLdouble t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2DPROC)this->m_functions[1189];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2d(s,t);}
+inline void glPointParameteri(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERIPROC)this->m_functions[1190];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameteri(pname,param);}
+inline void glTexCoord2f(GLfloat s,GLfloat t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FPROC)this->m_functions[1191];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2f(s,t);}
+inline void glGetUnsignedBytei_vEXT(GLenum target,GLuint index,GLubyte* data)const{auto const direct_ = (FunctionTable::PFNGLGETUNSIGNEDBYTEI_VEXTPROC)this->m_functions[1192];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetUnsignedBytei_vEXT(target,index,data);}
+inline void glColor4iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4IVPROC)this->m_functions[1193];if(direct_)return direct_(v);return this->m_rawTable->glColor4iv(v);}
+inline void* glMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const direct_ = (FunctionTable::PFNGLMAPNAMEDBUFFERRANGEPROC)this->m_functions[1194];if(direct_)return direct_(buffer,offset,length,access);return this->m_rawTable->glMapNamedBufferRange(buffer,offset,length,access);}
+inline GLboolean glUnmapBuffer(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLUNMAPBUFFERPROC)this->m_functions[1195];if(direct_)return direct_(target);return this->m_rawTable->glUnmapBuffer(target);}
+inline void glSampleMaskEXT(GLclampf value,GLboolean invert)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEMASKEXTPROC)this->m_functions[1196];if(direct_)return direct_(value,invert);return this->m_rawTable->glSampleMaskEXT(value,invert);}
+inline void glTexCoord2i(GLint s,GLint t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2IPROC)this->m_functions[1197];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2i(s,t);}
+inline void glTexCoord1xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1XVOESPROC)this->m_functions[1198];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord1xvOES(coords);}
+inline void glVertexAttrib1sARB(GLuint index,GLshort x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SARBPROC)this->m_functions[1199];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1sARB(index,x);}
+inline void glGetVertexArrayiv(GLuint vaobj,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYIVPROC)this->m_functions[1200];if(direct_)return direct_(vaobj,pname,param);return this->m_rawTable->glGetVertexArrayiv(vaobj,pname,param);}
+inline void glProgramParameter4dvNV(GLenum target,GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETER4DVNVPROC)this->m_functions[1201];if(direct_)return direct_(target,index,v);return this->m_rawTable->glProgramParameter4dvNV(target,index,v);}
+inline void glTexCoord2s(GLshort s,GLshort t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2SPROC)this->m_functions[1202];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2s(s,t);}
+inline void glTextureParameterIuivEXT(GLuint texture,GLenum target,GLenum pname,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIUIVEXTPROC)this->m_functions[1203];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glTextureParameterIuivEXT(texture,target,pname,params);}
+inline void glGetColorTableParameterfvSGI(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERFVSGIPROC)this->m_functions[1204];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameterfvSGI(target,pname,params);}
+inline void glTexCoord4dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4DVPROC)this->m_functions[1205];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord4dv(v);}
+inline void glVertexAttrib1svNV(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SVNVPROC)this->m_functions[1206];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1svNV(index,v);}
+inline void glNamedFramebufferTextureFaceEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)this->m_functions[1207];if(direct_)return direct_(framebuffer,attachment,texture,level,face);return this->m_rawTable->glNamedFramebufferTextureFaceEXT(framebuffer,attachment,texture,level,face);}
+inline void glProgramUniform2ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UI64VNVPROC)this->m_functions[1208];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2ui64vNV(program,location,count,value);}
+inline void glStencilFillPathNV(GLuint path,GLenum fillMode,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILFILLPATHNVPROC)this->m_functions[1209];if(direct_)return direct_(path,fillMode,mask);return this->m_rawTable->glStencilFillPathNV(path,fillMode,mask);}
+inline void glNormal3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3DVPROC)this->m_functions[1210];if(direct_)return direct_(v);return this->m_rawTable->glNormal3dv(v);}
+inline void glReleaseShaderCompiler()const{auto const direct_ = (FunctionTable::PFNGLRELEASESHADERCOMPILERPROC)this->m_functions[1211];if(direct_)return direct_();return this->m_rawTable->glReleaseShaderCompiler();}
+inline void glTexStorageMem3DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGEMEM3DEXTPROC)this->m_functions[1212];if(direct_)return direct_(target,levels,internalFormat,width,height,depth,memory,offset);return this->m_rawTable->glTexStorageMem3DEXT(target,levels,internalFormat,width,height,depth,memory,offset);}
+inline void glTexCoord3bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3BVOESPROC)this->m_functions[1213];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord3bvOES(coords);}
+inline GLboolean glIsVertexAttribEnabledAPPLE(GLuint index,GLenum pname)const{auto const direct_ = (FunctionTable::PFNGLISVERTEXATTRIBENABLEDAPPLEPROC)this->m_functions[1214];if(direct_)return direct_(index,pname);return this->m_rawTable->glIsVertexAttribEnabledAPPLE(index,pname);}
+inline void glTexCoord1dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1DVPROC)this->m_functions[1215];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord1dv(v);}
+inline void glReadPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLREADPIXELSPROC)this->m_functions[1216];if(direct_)return direct_(x,y,width,height,format,type,pixels);return this->m_rawTable->glReadPixels(x,y,width,height,format,type,pixels);}
+inline void glVertexAttribI3iv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3IVPROC)this->m_functions[1217];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI3iv(index,v);}
+inline void glSetFenceAPPLE(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLSETFENCEAPPLEPROC)this->m_functions[1218];if(direct_)return direct_(fence);return this->m_rawTable->glSetFenceAPPLE(fence);}
+inline void glWeightsvARB(GLint size,const GLshort* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTSVARBPROC)this->m_functions[1219];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightsvARB(size,weights);}
+inline void glShadeModel(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLSHADEMODELPROC)this->m_functions[1220];if(direct_)return direct_(mode);return this->m_rawTable->glShadeModel(mode);}
+inline void glTextureStorageMem3DMultisampleEXT(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)this->m_functions[1221];if(direct_)return direct_(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);return this->m_rawTable->glTextureStorageMem3DMultisampleEXT(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+inline void glMapGrid1d(GLint un,GLdouble u1,GLdouble u2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID1DPROC)this->m_functions[1222];if(direct_)return direct_(un,u1,u2);return this->m_rawTable->glMapGrid1d(un,u1,u2);}
+inline void glGetHistogramParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPARAMETERIVEXTPROC)this->m_functions[1223];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetHistogramParameterivEXT(target,pname,params);}
+inline void glConservativeRasterParameteriNV(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLCONSERVATIVERASTERPARAMETERINVPROC)this->m_functions[1224];if(direct_)return direct_(pname,param);return this->m_rawTable->glConservativeRasterParameteriNV(pname,param);}
+inline void glClearNamedBufferData(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDBUFFERDATAPROC)this->m_functions[1225];if(direct_)return direct_(buffer,internalformat,format,type,data);return this->m_rawTable->glClearNamedBufferData(buffer,internalformat,format,type,data);}
+inline void glClearDepthf(GLfloat d)const{auto const direct_ = (FunctionTable::PFNGLCLEARDEPTHFPROC)this->m_functions[1226];if(direct_)return direct_(d);return this->m_rawTable->glClearDepthf(d);}
+inline void glCreatePerfQueryINTEL(GLuint queryId,GLuint* queryHandle)const{auto const direct_ = (FunctionTable::PFNGLCREATEPERFQUERYINTELPROC)this->m_functions[1227];if(direct_)return direct_(queryId,queryHandle);return this->m_rawTable->glCreatePerfQueryINTEL(queryId,queryHandle);}
+inline void glFogCoordfEXT(GLfloat coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDFEXTPROC)this->m_functions[1228];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoordfEXT(coord);}
+inline void glVertexAttrib2dARB(GLuint index,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DARBPROC)this->m_functions[1229];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2dARB(index,x,y);}
+inline void glMultiTexCoord4dARB(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4DARBPROC)this->m_functions[1230];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4dARB(target,s,t,r,q);}
+inline void glReadnPixelsARB(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{auto const direct_ = (FunctionTable::PFNGLREADNPIXELSARBPROC)this->m_functions[1231];if(direct_)return direct_(x,y,width,height,format,type,bufSize,data);return this->m_rawTable->glReadnPixelsARB(x,y,width,height,format,type,bufSize,data);}
+inline void glMultiTexBufferEXT(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXBUFFEREXTPROC)this->m_functions[1232];if(direct_)return direct_(texunit,target,internalformat,buffer);return this->m_rawTable->glMultiTexBufferEXT(texunit,target,internalformat,buffer);}
+inline void glWindowPos4dvMESA(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4DVMESAPROC)this->m_functions[1233];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos4dvMESA(v);}
+inline void glInvalidateNamedFramebufferData(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)this->m_functions[1234];if(direct_)return direct_(framebuffer,numAttachments,attachments);return this->m_rawTable->glInvalidateNamedFramebufferData(framebuffer,numAttachments,attachments);}
+inline void glSecondaryColorPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORPOINTERLISTIBMPROC)this->m_functions[1235];if(direct_)return direct_(size,type,stride,pointer,ptrstride);return this->m_rawTable->glSecondaryColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+inline void glRectiv(const GLint* v1,const GLint* v2)const{auto const direct_ = (FunctionTable::PFNGLRECTIVPROC)this->m_functions[1236];if(direct_)return direct_(v1,v2);return this->m_rawTable->glRectiv(v1,v2);}
+inline void glColorP4ui(GLenum type,GLuint color)const{auto const direct_ = (FunctionTable::PFNGLCOLORP4UIPROC)this->m_functions[1237];if(direct_)return direct_(type,color);return this->m_rawTable->glColorP4ui(type,color);}
+inline void glUseProgramStages(GLuint pipeline,GLbitfield stages,GLuint program)const{auto const direct_ = (FunctionTable::PFNGLUSEPROGRAMSTAGESPROC)this->m_functions[1238];if(direct_)return direct_(pipeline,stages,program);return this->m_rawTable->glUseProgramStages(pipeline,stages,program);}
+inline void glRasterPos3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3DVPROC)this->m_functions[1239];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos3dv(v);}
+inline void glPathTexGenNV(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs)const{auto const direct_ = (FunctionTable::PFNGLPATHTEXGENNVPROC)this->m_functions[1240];if(direct_)return direct_(texCoordSet,genMode,components,coeffs);return this->m_rawTable->glPathTexGenNV(texCoordSet,genMode,components,coeffs);}
+inline void glVertexBlendEnviATI(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLVERTEXBLENDENVIATIPROC)this->m_functions[1241];if(direct_)return direct_(pname,param);return this->m_rawTable->glVertexBlendEnviATI(pname,param);}
+inline void glUniform3i64ARB(GLint location,GLint64 x,GLint64 y,GLint64 z)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3I64ARBPROC)this->m_functions[1242];if(direct_)return direct_(location,x,y,z);return this->m_rawTable->glUniform3i64ARB(location,x,y,z);}
+inline void glLoadMatrixf(const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLLOADMATRIXFPROC)this->m_functions[1243];if(direct_)return direct_(m);return this->m_rawTable->glLoadMatrixf(m);}
+inline void glProgramUniform2dEXT(GLuint program,GLint location,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2DEXTPROC)this->m_functions[1244];if(direct_)return direct_(program,location,x,y);return this->m_rawTable->glProgramUniform2dEXT(program,location,x,y);}
+inline void glVertexAttribI4iv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4IVPROC)this->m_functions[1245];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4iv(index,v);}
+inline void glNamedFramebufferDrawBuffer(GLuint framebuffer,GLenum buf)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)this->m_functions[1246];if(direct_)return direct_(framebuffer,buf);return this->m_rawTable->glNamedFramebufferDrawBuffer(framebuffer,buf);}
+inline void glColor4ubv(const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBVPROC)this->m_functions[1247];if(direct_)return direct_(v);return this->m_rawTable->glColor4ubv(v);}
+inline void glColor3hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3HVNVPROC)this->m_functions[1248];if(direct_)return direct_(v);return this->m_rawTable->glColor3hvNV(v);}
+inline void glGetMapAttribParameterfvNV(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMAPATTRIBPARAMETERFVNVPROC)this->m_functions[1249];if(direct_)return direct_(target,index,pname,params);return this->m_rawTable->glGetMapAttribParameterfvNV(target,index,pname,params);}
+inline void glGetBufferSubData(GLenum target,GLintptr offset,GLsizeiptr size,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERSUBDATAPROC)this->m_functions[1250];if(direct_)return direct_(target,offset,size,data);return this->m_rawTable->glGetBufferSubData(target,offset,size,data);}
+inline void glGetVertexAttribLdv(GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBLDVPROC)this->m_functions[1251];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribLdv(index,pname,params);}
+inline void glGetnUniformuiv(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMUIVPROC)this->m_functions[1252];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformuiv(program,location,bufSize,params);}
+inline void glGetUniformui64vNV(GLuint program,GLint location,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMUI64VNVPROC)this->m_functions[1253];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformui64vNV(program,location,params);}
+inline void glNamedRenderbufferStorageEXT(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)this->m_functions[1254];if(direct_)return direct_(renderbuffer,internalformat,width,height);return this->m_rawTable->glNamedRenderbufferStorageEXT(renderbuffer,internalformat,width,height);}
+inline void glVertexAttrib3dNV(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DNVPROC)this->m_functions[1255];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3dNV(index,x,y,z);}
+inline void glTextureStorage1DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE1DEXTPROC)this->m_functions[1256];if(direct_)return direct_(texture,target,levels,internalformat,width);return this->m_rawTable->glTextureStorage1DEXT(texture,target,levels,internalformat,width);}
+inline void glPixelTexGenParameteriSGIS(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTEXGENPARAMETERISGISPROC)this->m_functions[1257];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelTexGenParameteriSGIS(pname,param);}
+inline void glColorTableEXT(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEEXTPROC)this->m_functions[1258];if(direct_)return direct_(target,internalFormat,width,format,type,table);return this->m_rawTable->glColorTableEXT(target,internalFormat,width,format,type,table);}
+inline void glGenBuffers(GLsizei n,GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLGENBUFFERSPROC)this->m_functions[1259];if(direct_)return direct_(n,buffers);return this->m_rawTable->glGenBuffers(n,buffers);}
+inline void glMultiTexCoord3xvOES(GLenum texture,const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3XVOESPROC)this->m_functions[1260];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord3xvOES(texture,coords);}
+inline void glExecuteProgramNV(GLenum target,GLuint id,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLEXECUTEPROGRAMNVPROC)this->m_functions[1261];if(direct_)return direct_(target,id,params);return this->m_rawTable->glExecuteProgramNV(target,id,params);}
+inline void glVariantArrayObjectATI(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{auto const direct_ = (FunctionTable::PFNGLVARIANTARRAYOBJECTATIPROC)this->m_functions[1262];if(direct_)return direct_(id,type,stride,buffer,offset);return this->m_rawTable->glVariantArrayObjectATI(id,type,stride,buffer,offset);}
+inline void glColor3xvOES(const GLfixed* components)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3XVOESPROC)this->m_functions[1263];if(direct_)return direct_(components);return this->m_rawTable->glColor3xvOES(components);}
+inline void glGetnConvolutionFilterARB(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{auto const direct_ = (FunctionTable::PFNGLGETNCONVOLUTIONFILTERARBPROC)this->m_functions[1264];if(direct_)return direct_(target,format,type,bufSize,image);return this->m_rawTable->glGetnConvolutionFilterARB(target,format,type,bufSize,image);}
+inline void glNormalFormatNV(GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLNORMALFORMATNVPROC)this->m_functions[1265];if(direct_)return direct_(type,stride);return this->m_rawTable->glNormalFormatNV(type,stride);}
+inline void glGetInvariantFloatvEXT(GLuint id,GLenum value,GLfloat* data)const{auto const direct_ = (FunctionTable::PFNGLGETINVARIANTFLOATVEXTPROC)this->m_functions[1266];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetInvariantFloatvEXT(id,value,data);}
+inline void glClearNamedFramebufferiv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)this->m_functions[1267];if(direct_)return direct_(framebuffer,buffer,drawbuffer,value);return this->m_rawTable->glClearNamedFramebufferiv(framebuffer,buffer,drawbuffer,value);}
+inline void glTexImage3D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE3DPROC)this->m_functions[1268];if(direct_)return direct_(target,level,internalFormat,width,height,depth,border,format,type,pixels);return this->m_rawTable->glTexImage3D(target,level,internalFormat,width,height,depth,border,format,type,pixels);}
+inline void glGenSamplers(GLsizei count,GLuint* samplers)const{auto const direct_ = (FunctionTable::PFNGLGENSAMPLERSPROC)this->m_functions[1269];if(direct_)return direct_(count,samplers);return this->m_rawTable->glGenSamplers(count,samplers);}
+inline GLboolean glIsFramebuffer(GLuint framebuffer)const{auto const direct_ = (FunctionTable::PFNGLISFRAMEBUFFERPROC)this->m_functions[1270];if(direct_)return direct_(framebuffer);return this->m_rawTable->glIsFramebuffer(framebuffer);}
+inline void glProgramUniform3dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3DVEXTPROC)this->m_functions[1271];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3dvEXT(program,location,count,value);}
+inline void glGetVertexAttribfvNV(GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBFVNVPROC)this->m_functions[1272];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribfvNV(index,pname,params);}
+inline void glDrawRangeElementArrayAPPLE(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)this->m_functions[1273];if(direct_)return direct_(mode,start,end,first,count);return this->m_rawTable->glDrawRangeElementArrayAPPLE(mode,start,end,first,count);}
+inline void glUniform3i64NV(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3I64NVPROC)this->m_functions[1274];if(direct_)return direct_(location,x,y,z);return this->m_rawTable->glUniform3i64NV(location,x,y,z);}
+inline void glMatrixPopEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLMATRIXPOPEXTPROC)this->m_functions[1275];if(direct_)return direct_(mode);return this->m_rawTable->glMatrixPopEXT(mode);}
+inline void glVertexStream1sATI(GLenum stream,GLshort x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1SATIPROC)this->m_functions[1276];if(direct_)return direct_(stream,x);return this->m_rawTable->glVertexStream1sATI(stream,x);}
+inline void glGetnPixelMapuivARB(GLenum map,GLsizei bufSize,GLuint* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPUIVARBPROC)this->m_functions[1277];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapuivARB(map,bufSize,values);}
+inline void glMultiTexEnviEXT(GLenum texunit,GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXENVIEXTPROC)this->m_functions[1278];if(direct_)return direct_(texunit,target,pname,param);return this->m_rawTable->glMultiTexEnviEXT(texunit,target,pname,param);}
+inline void glVertexAttribI2iEXT(GLuint index,GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2IEXTPROC)this->m_functions[1279];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribI2iEXT(index,x,y);}
+inline void glProgramParameter4fvNV(GLenum target,GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETER4FVNVPROC)this->m_functions[1280];if(direct_)return direct_(target,index,v);return this->m_rawTable->glProgramParameter4fvNV(target,index,v);}
+inline void glWaitSemaphoreEXT(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* srcLayouts)const{auto const direct_ = (FunctionTable::PFNGLWAITSEMAPHOREEXTPROC)this->m_functions[1281];if(direct_)return direct_(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);return this->m_rawTable->glWaitSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);}
+inline void glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)this->m_functions[1282];if(direct_)return direct_(framebuffer,start,count,v);return this->m_rawTable->glNamedFramebufferSampleLocationsfvNV(framebuffer,start,count,v);}
+inline void glTexCoordP4uiv(GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP4UIVPROC)this->m_functions[1283];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP4uiv(type,coords);}
+inline void glRectxvOES(const GLfixed* v1,const GLfixed* v2)const{auto const direct_ = (FunctionTable::PFNGLRECTXVOESPROC)this->m_functions[1284];if(direct_)return direct_(v1,v2);return this->m_rawTable->glRectxvOES(v1,v2);}
+inline void glGetVariantIntegervEXT(GLuint id,GLenum value,GLint* data)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTINTEGERVEXTPROC)this->m_functions[1285];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetVariantIntegervEXT(id,value,data);}
+inline void glDeleteLists(GLuint list,GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLDELETELISTSPROC)this->m_functions[1286];if(direct_)return direct_(list,range);return this->m_rawTable->glDeleteLists(list,range);}
+inline void glTexGendv(GLenum coord,GLenum pname,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLTEXGENDVPROC)this->m_functions[1287];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glTexGendv(coord,pname,params);}
+inline void glVertexP2uiv(GLenum type,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP2UIVPROC)this->m_functions[1288];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP2uiv(type,value);}
+inline void glGetPerfMonitorGroupsAMD(GLint* numGroups,GLsizei groupsSize,GLuint* groups)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORGROUPSAMDPROC)this->m_functions[1289];if(direct_)return direct_(numGroups,groupsSize,groups);return this->m_rawTable->glGetPerfMonitorGroupsAMD(numGroups,groupsSize,groups);}
+inline void glMultTransposeMatrixfARB(const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMULTTRANSPOSEMATRIXFARBPROC)this->m_functions[1290];if(direct_)return direct_(m);return this->m_rawTable->glMultTransposeMatrixfARB(m);}
+inline void glVertexAttribI2ivEXT(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2IVEXTPROC)this->m_functions[1291];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI2ivEXT(index,v);}
+inline void glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[1292];if(direct_)return direct_(rc,c,n,v);return this->m_rawTable->glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc,c,n,v);}
+inline void glDeleteStatesNV(GLsizei n,const GLuint* states)const{auto const direct_ = (FunctionTable::PFNGLDELETESTATESNVPROC)this->m_functions[1293];if(direct_)return direct_(n,states);return this->m_rawTable->glDeleteStatesNV(n,states);}
+inline void glGetBufferParameteri64v(GLenum target,GLenum pname,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPARAMETERI64VPROC)this->m_functions[1294];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferParameteri64v(target,pname,params);}
+inline void glProgramUniform4dv(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4DVPROC)this->m_functions[1295];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4dv(program,location,count,value);}
+inline void glEdgeFlagPointerEXT(GLsizei stride,GLsizei count,const GLboolean* pointer)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGPOINTEREXTPROC)this->m_functions[1296];if(direct_)return direct_(stride,count,pointer);return this->m_rawTable->glEdgeFlagPointerEXT(stride,count,pointer);}
+inline void glVideoCaptureStreamParameterivNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)this->m_functions[1297];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glVideoCaptureStreamParameterivNV(video_capture_slot,stream,pname,params);}
+inline void glVertexStream4iATI(GLenum stream,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4IATIPROC)this->m_functions[1298];if(direct_)return direct_(stream,x,y,z,w);return this->m_rawTable->glVertexStream4iATI(stream,x,y,z,w);}
+inline void glVDPAUFiniNV()const{auto const direct_ = (FunctionTable::PFNGLVDPAUFININVPROC)this->m_functions[1299];if(direct_)return direct_();return this->m_rawTable->glVDPAUFiniNV();}
+inline void glMakeBufferNonResidentNV(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLMAKEBUFFERNONRESIDENTNVPROC)this->m_functions[1300];if(direct_)return direct_(target);return this->m_rawTable->glMakeBufferNonResidentNV(target);}
+inline void glUniform1ui64ARB(GLint location,GLuint64 x)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UI64ARBPROC)this->m_functions[1301];if(direct_)return direct_(location,x);return this->m_rawTable->glUniform1ui64ARB(location,x);}
+inline void glStencilStrokePathNV(GLuint path,GLint reference,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILSTROKEPATHNVPROC)this->m_functions[1302];if(direct_)return direct_(path,reference,mask);return this->m_rawTable->glStencilStrokePathNV(path,reference,mask);}
+inline void glVariantuivEXT(GLuint id,const GLuint* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTUIVEXTPROC)this->m_functions[1303];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantuivEXT(id,addr);}
+inline void glCopyTexSubImage3DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE3DEXTPROC)this->m_functions[1304];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,x,y,width,height);return this->m_rawTable->glCopyTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+inline void glSpriteParameteriSGIX(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLSPRITEPARAMETERISGIXPROC)this->m_functions[1305];if(direct_)return direct_(pname,param);return this->m_rawTable->glSpriteParameteriSGIX(pname,param);}
+inline void glMultiTexCoord1sARB(GLenum target,GLshort s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1SARBPROC)this->m_functions[1306];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1sARB(target,s);}
+inline void glConvolutionParameterfv(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERFVPROC)this->m_functions[1307];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterfv(target,pname,params);}
+inline void glMakeTextureHandleResidentNV(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKETEXTUREHANDLERESIDENTNVPROC)this->m_functions[1308];if(direct_)return direct_(handle);return this->m_rawTable->glMakeTextureHandleResidentNV(handle);}
+inline void glMultMatrixxOES(const GLfixed* m)const{auto const direct_ = (FunctionTable::PFNGLMULTMATRIXXOESPROC)this->m_functions[1309];if(direct_)return direct_(m);return this->m_rawTable->glMultMatrixxOES(m);}
+inline void glTextureNormalEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLTEXTURENORMALEXTPROC)this->m_functions[1310];if(direct_)return direct_(mode);return this->m_rawTable->glTextureNormalEXT(mode);}
+inline void glGetQueryivARB(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYIVARBPROC)this->m_functions[1311];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetQueryivARB(target,pname,params);}
+inline void glCompressedMultiTexImage3DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)this->m_functions[1312];if(direct_)return direct_(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);return this->m_rawTable->glCompressedMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+inline GLint glGetInstrumentsSGIX()const{auto const direct_ = (FunctionTable::PFNGLGETINSTRUMENTSSGIXPROC)this->m_functions[1313];if(direct_)return direct_();return this->m_rawTable->glGetInstrumentsSGIX();}
+inline void glProgramUniformMatrix4x3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)this->m_functions[1314];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x3fvEXT(program,location,count,transpose,value);}
+inline void glPointParameterf(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFPROC)this->m_functions[1315];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameterf(pname,param);}
+inline void glProgramUniform3dEXT(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3DEXTPROC)this->m_functions[1316];if(direct_)return direct_(program,location,x,y,z);return this->m_rawTable->glProgramUniform3dEXT(program,location,x,y,z);}
+inline void glMultiTexCoord2hNV(GLenum target,GLhalfNV s,GLhalfNV t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2HNVPROC)this->m_functions[1317];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2hNV(target,s,t);}
+inline void glGetConvolutionFilterEXT(GLenum target,GLenum format,GLenum type,void* image)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONFILTEREXTPROC)this->m_functions[1318];if(direct_)return direct_(target,format,type,image);return this->m_rawTable->glGetConvolutionFilterEXT(target,format,type,image);}
+inline void glVertexAttrib2hNV(GLuint index,GLhalfNV x,GLhalfNV y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2HNVPROC)this->m_functions[1319];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2hNV(index,x,y);}
+inline void glCurrentPaletteMatrixARB(GLint index)const{auto const direct_ = (FunctionTable::PFNGLCURRENTPALETTEMATRIXARBPROC)this->m_functions[1320];if(direct_)return direct_(index);return this->m_rawTable->glCurrentPaletteMatrixARB(index);}
+inline void glFogxvOES(GLenum pname,const GLfixed* param)const{auto const direct_ = (FunctionTable::PFNGLFOGXVOESPROC)this->m_functions[1321];if(direct_)return direct_(pname,param);return this->m_rawTable->glFogxvOES(pname,param);}
+inline void glCreateRenderbuffers(GLsizei n,GLuint* renderbuffers)const{auto const direct_ = (FunctionTable::PFNGLCREATERENDERBUFFERSPROC)this->m_functions[1322];if(direct_)return direct_(n,renderbuffers);return this->m_rawTable->glCreateRenderbuffers(n,renderbuffers);}
+inline void glVertexAttrib4Nusv(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUSVPROC)this->m_functions[1323];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Nusv(index,v);}
+inline void glCombinerInputNV(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERINPUTNVPROC)this->m_functions[1324];if(direct_)return direct_(stage,portion,variable,input,mapping,componentUsage);return this->m_rawTable->glCombinerInputNV(stage,portion,variable,input,mapping,componentUsage);}
+inline void glDepthFunc(GLenum func)const{auto const direct_ = (FunctionTable::PFNGLDEPTHFUNCPROC)this->m_functions[1325];if(direct_)return direct_(func);return this->m_rawTable->glDepthFunc(func);}
+inline void glWindowPos4fMESA(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4FMESAPROC)this->m_functions[1326];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glWindowPos4fMESA(x,y,z,w);}
+inline void glEnableClientStateIndexedEXT(GLenum array,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLECLIENTSTATEINDEXEDEXTPROC)this->m_functions[1327];if(direct_)return direct_(array,index);return this->m_rawTable->glEnableClientStateIndexedEXT(array,index);}
+inline void glTexCoord4iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4IVPROC)this->m_functions[1328];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord4iv(v);}
+inline void glProgramUniform4i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4I64ARBPROC)this->m_functions[1329];if(direct_)return direct_(program,location,x,y,z,w);return this->m_rawTable->glProgramUniform4i64ARB(program,location,x,y,z,w);}
+inline void glBlendFunci(GLuint buf,GLenum src,GLenum dst)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCIPROC)this->m_functions[1330];if(direct_)return direct_(buf,src,dst);return this->m_rawTable->glBlendFunci(buf,src,dst);}
+inline void glResolveDepthValuesNV()const{auto const direct_ = (FunctionTable::PFNGLRESOLVEDEPTHVALUESNVPROC)this->m_functions[1331];if(direct_)return direct_();return this->m_rawTable->glResolveDepthValuesNV();}
+inline void glTextureColorMaskSGIS(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{auto const direct_ = (FunctionTable::PFNGLTEXTURECOLORMASKSGISPROC)this->m_functions[1332];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glTextureColorMaskSGIS(red,green,blue,alpha);}
+inline GLuint glCreateShaderProgramEXT(GLenum type,const GLchar* string)const{auto const direct_ = (FunctionTable::PFNGLCREATESHADERPROGRAMEXTPROC)this->m_functions[1333];if(direct_)return direct_(type,string);return this->m_rawTable->glCreateShaderProgramEXT(type,string);}
+inline void glBufferStorage(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLBUFFERSTORAGEPROC)this->m_functions[1334];if(direct_)return direct_(target,size,data,flags);return this->m_rawTable->glBufferStorage(target,size,data,flags);}
+inline void glMakeNamedBufferNonResidentNV(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)this->m_functions[1335];if(direct_)return direct_(buffer);return this->m_rawTable->glMakeNamedBufferNonResidentNV(buffer);}
+inline void glRenderbufferStorageMultisampleEXT(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)this->m_functions[1336];if(direct_)return direct_(target,samples,internalformat,width,height);return this->m_rawTable->glRenderbufferStorageMultisampleEXT(target,samples,internalformat,width,height);}
+inline void glGetFloati_v(GLenum target,GLuint index,GLfloat* data)const{auto const direct_ = (FunctionTable::PFNGLGETFLOATI_VPROC)this->m_functions[1337];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetFloati_v(target,index,data);}
+inline void glUniform2ui64ARB(GLint location,GLuint64 x,GLuint64 y)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UI64ARBPROC)this->m_functions[1338];if(direct_)return direct_(location,x,y);return this->m_rawTable->glUniform2ui64ARB(location,x,y);}
+inline void glVertex3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3FVPROC)this->m_functions[1339];if(direct_)return direct_(v);return this->m_rawTable->glVertex3fv(v);}
+inline GLint glGetUniformLocation(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMLOCATIONPROC)this->m_functions[1340];if(direct_)return direct_(program,name);return this->m_rawTable->glGetUniformLocation(program,name);}
+inline void glVertexStream1svATI(GLenum stream,const GLshort* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1SVATIPROC)this->m_functions[1341];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream1svATI(stream,coords);}
+inline void glVertexStream3fATI(GLenum stream,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3FATIPROC)this->m_functions[1342];if(direct_)return direct_(stream,x,y,z);return this->m_rawTable->glVertexStream3fATI(stream,x,y,z);}
+inline void glNamedFramebufferDrawBuffers(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)this->m_functions[1343];if(direct_)return direct_(framebuffer,n,bufs);return this->m_rawTable->glNamedFramebufferDrawBuffers(framebuffer,n,bufs);}
+inline void glUniform2ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UI64VNVPROC)this->m_functions[1344];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2ui64vNV(location,count,value);}
+inline void glTexCoordPointervINTEL(GLint size,GLenum type,const void** pointer)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDPOINTERVINTELPROC)this->m_functions[1345];if(direct_)return direct_(size,type,pointer);return this->m_rawTable->glTexCoordPointervINTEL(size,type,pointer);}
+inline void glUniform4fv(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4FVPROC)this->m_functions[1346];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4fv(location,count,value);}
+inline void glNormalPointerEXT(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLNORMALPOINTEREXTPROC)this->m_functions[1347];if(direct_)return direct_(type,stride,count,pointer);return this->m_rawTable->glNormalPointerEXT(type,stride,count,pointer);}
+inline void glVertexAttrib4hNV(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4HNVPROC)this->m_functions[1348];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4hNV(index,x,y,z,w);}
+inline void glNormal3f(GLfloat nx,GLfloat ny,GLfloat nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3FPROC)this->m_functions[1349];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3f(nx,ny,nz);}
+inline void glVertexStream2iATI(GLenum stream,GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2IATIPROC)this->m_functions[1350];if(direct_)return direct_(stream,x,y);return this->m_rawTable->glVertexStream2iATI(stream,x,y);}
+inline void glVertexAttribP4uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP4UIVPROC)this->m_functions[1351];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP4uiv(index,type,normalized,value);}
+inline void glCompressedTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)this->m_functions[1352];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);return this->m_rawTable->glCompressedTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+inline void glAsyncMarkerSGIX(GLuint marker)const{auto const direct_ = (FunctionTable::PFNGLASYNCMARKERSGIXPROC)this->m_functions[1353];if(direct_)return direct_(marker);return this->m_rawTable->glAsyncMarkerSGIX(marker);}
+inline void glTextureStorageSparseAMD(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGESPARSEAMDPROC)this->m_functions[1354];if(direct_)return direct_(texture,target,internalFormat,width,height,depth,layers,flags);return this->m_rawTable->glTextureStorageSparseAMD(texture,target,internalFormat,width,height,depth,layers,flags);}
+inline void glGetConvolutionParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)this->m_functions[1355];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetConvolutionParameterivEXT(target,pname,params);}
+inline void glEndPerfQueryINTEL(GLuint queryHandle)const{auto const direct_ = (FunctionTable::PFNGLENDPERFQUERYINTELPROC)this->m_functions[1356];if(direct_)return direct_(queryHandle);return this->m_rawTable->glEndPerfQueryINTEL(queryHandle);}
+inline void glFragmentLightModeliSGIX(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTMODELISGIXPROC)this->m_functions[1357];if(direct_)return direct_(pname,param);return this->m_rawTable->glFragmentLightModeliSGIX(pname,param);}
+inline void glPrioritizeTexturesEXT(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{auto const direct_ = (FunctionTable::PFNGLPRIORITIZETEXTURESEXTPROC)this->m_functions[1358];if(direct_)return direct_(n,textures,priorities);return this->m_rawTable->glPrioritizeTexturesEXT(n,textures,priorities);}
+inline void glEndConditionalRender()const{auto const direct_ = (FunctionTable::PFNGLENDCONDITIONALRENDERPROC)this->m_functions[1359];if(direct_)return direct_();return this->m_rawTable->glEndConditionalRender();}
+inline void glEnableClientState(GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLENABLECLIENTSTATEPROC)this->m_functions[1360];if(direct_)return direct_(cap);return this->m_rawTable->glEnableClientState(cap);}
+inline void glResetHistogram(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLRESETHISTOGRAMPROC)this->m_functions[1361];if(direct_)return direct_(target);return this->m_rawTable->glResetHistogram(target);}
+inline void glGetOcclusionQueryivNV(GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETOCCLUSIONQUERYIVNVPROC)this->m_functions[1362];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetOcclusionQueryivNV(id,pname,params);}
+inline void glUniform1uiEXT(GLint location,GLuint v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UIEXTPROC)this->m_functions[1363];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1uiEXT(location,v0);}
+inline void glMultiTexCoord2sv(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2SVPROC)this->m_functions[1364];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2sv(target,v);}
+inline void glTexSubImage2DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE2DEXTPROC)this->m_functions[1365];if(direct_)return direct_(target,level,xoffset,yoffset,width,height,format,type,pixels);return this->m_rawTable->glTexSubImage2DEXT(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+inline void glProgramUniform2uiv(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UIVPROC)this->m_functions[1366];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2uiv(program,location,count,value);}
+inline void glMultiTexCoord2iARB(GLenum target,GLint s,GLint t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2IARBPROC)this->m_functions[1367];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2iARB(target,s,t);}
+inline void glGetQueryObjectuiv(GLuint id,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTUIVPROC)this->m_functions[1368];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectuiv(id,pname,params);}
+inline void glGenerateMultiTexMipmapEXT(GLenum texunit,GLenum target)const{auto const direct_ = (FunctionTable::PFNGLGENERATEMULTITEXMIPMAPEXTPROC)this->m_functions[1369];if(direct_)return direct_(texunit,target);return this->m_rawTable->glGenerateMultiTexMipmapEXT(texunit,target);}
+inline void glVertexAttrib4iv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4IVPROC)this->m_functions[1370];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4iv(index,v);}
+inline void glWindowPos3dvMESA(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DVMESAPROC)this->m_functions[1371];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3dvMESA(v);}
+inline void glLabelObjectEXT(GLenum type,GLuint object,GLsizei length,const GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLLABELOBJECTEXTPROC)this->m_functions[1372];if(direct_)return direct_(type,object,length,label);return this->m_rawTable->glLabelObjectEXT(type,object,length,label);}
+inline void glProgramUniform1uiv(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UIVPROC)this->m_functions[1373];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1uiv(program,location,count,value);}
+inline void glFramebufferTexture(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREPROC)this->m_functions[1374];if(direct_)return direct_(target,attachment,texture,level);return this->m_rawTable->glFramebufferTexture(target,attachment,texture,level);}
+inline void glMultiTexEnvfEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXENVFEXTPROC)this->m_functions[1375];if(direct_)return direct_(texunit,target,pname,param);return this->m_rawTable->glMultiTexEnvfEXT(texunit,target,pname,param);}
+inline void glGetTexGendv(GLenum coord,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXGENDVPROC)this->m_functions[1376];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glGetTexGendv(coord,pname,params);}
+inline void glVertex4xOES(GLfixed x,GLfixed y,GLfixed z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4XOESPROC)this->m_functions[1377];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex4xOES(x,y,z);}
+inline void glVertexAttribI2uivEXT(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2UIVEXTPROC)this->m_functions[1378];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI2uivEXT(index,v);}
+inline void glNamedProgramLocalParameter4fvEXT(GLuint program,GLenum target,GLuint index,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)this->m_functions[1379];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glNamedProgramLocalParameter4fvEXT(program,target,index,params);}
+inline void glColor3usv(const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3USVPROC)this->m_functions[1380];if(direct_)return direct_(v);return this->m_rawTable->glColor3usv(v);}
+inline void glGetPixelTransformParameterfvEXT(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)this->m_functions[1381];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetPixelTransformParameterfvEXT(target,pname,params);}
+inline void glIndexxvOES(const GLfixed* component)const{auto const direct_ = (FunctionTable::PFNGLINDEXXVOESPROC)this->m_functions[1382];if(direct_)return direct_(component);return this->m_rawTable->glIndexxvOES(component);}
+inline void glDepthMask(GLboolean flag)const{auto const direct_ = (FunctionTable::PFNGLDEPTHMASKPROC)this->m_functions[1383];if(direct_)return direct_(flag);return this->m_rawTable->glDepthMask(flag);}
+inline void glProgramUniformMatrix2x4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)this->m_functions[1384];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x4fv(program,location,count,transpose,value);}
+inline GLboolean glAreProgramsResidentNV(GLsizei n,const GLuint* programs,GLboolean* residences)const{auto const direct_ = (FunctionTable::PFNGLAREPROGRAMSRESIDENTNVPROC)this->m_functions[1385];if(direct_)return direct_(n,programs,residences);return this->m_rawTable->glAreProgramsResidentNV(n,programs,residences);}
+inline void glColorTable(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEPROC)this->m_functions[1386];if(direct_)return direct_(target,internalformat,width,format,type,table);return this->m_rawTable->glColorTable(target,internalformat,width,format,type,table);}
+inline void glBeginQueryIndexed(GLenum target,GLuint index,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBEGINQUERYINDEXEDPROC)this->m_functions[1387];if(direct_)return direct_(target,index,id);return this->m_rawTable->glBeginQueryIndexed(target,index,id);}
+inline void glVertexStream1dvATI(GLenum stream,const GLdouble* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1DVATIPROC)this->m_functions[1388];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream1dvATI(stream,coords);}
+inline void glGetMultiTexEnvfvEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXENVFVEXTPROC)this->m_functions[1389];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexEnvfvEXT(texunit,target,pname,params);}
+inline void glDeleteFencesNV(GLsizei n,const GLuint* fences)const{auto const direct_ = (FunctionTable::PFNGLDELETEFENCESNVPROC)this->m_functions[1390];if(direct_)return direct_(n,fences);return this->m_rawTable->glDeleteFencesNV(n,fences);}
+inline void glVertexAttribs1dvNV(GLuint index,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS1DVNVPROC)this->m_functions[1391];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs1dvNV(index,count,v);}
+inline void glBufferStorageExternalEXT(GLenum target,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLBUFFERSTORAGEEXTERNALEXTPROC)this->m_functions[1392];if(direct_)return direct_(target,offset,size,clientBuffer,flags);return this->m_rawTable->glBufferStorageExternalEXT(target,offset,size,clientBuffer,flags);}
+inline void glVertexStream2sATI(GLenum stream,GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2SATIPROC)this->m_functions[1393];if(direct_)return direct_(stream,x,y);return this->m_rawTable->glVertexStream2sATI(stream,x,y);}
+inline void glGetnSeparableFilterARB(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{auto const direct_ = (FunctionTable::PFNGLGETNSEPARABLEFILTERARBPROC)this->m_functions[1394];if(direct_)return direct_(target,format,type,rowBufSize,row,columnBufSize,column,span);return this->m_rawTable->glGetnSeparableFilterARB(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+inline void glProgramUniform2dv(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2DVPROC)this->m_functions[1395];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2dv(program,location,count,value);}
+inline void glActiveStencilFaceEXT(GLenum face)const{auto const direct_ = (FunctionTable::PFNGLACTIVESTENCILFACEEXTPROC)this->m_functions[1396];if(direct_)return direct_(face);return this->m_rawTable->glActiveStencilFaceEXT(face);}
+inline void glProgramUniform4dEXT(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4DEXTPROC)this->m_functions[1397];if(direct_)return direct_(program,location,x,y,z,w);return this->m_rawTable->glProgramUniform4dEXT(program,location,x,y,z,w);}
+inline void glPointSizexOES(GLfixed size)const{auto const direct_ = (FunctionTable::PFNGLPOINTSIZEXOESPROC)this->m_functions[1398];if(direct_)return direct_(size);return this->m_rawTable->glPointSizexOES(size);}
+inline void glRasterPos2sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2SVPROC)this->m_functions[1399];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos2sv(v);}
+inline GLuint glBindParameterEXT(GLenum value)const{auto const direct_ = (FunctionTable::PFNGLBINDPARAMETEREXTPROC)this->m_functions[1400];if(direct_)return direct_(value);return this->m_rawTable->glBindParameterEXT(value);}
+inline void glTexCoord1sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1SVPROC)this->m_functions[1401];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord1sv(v);}
+inline void glBlendParameteriNV(GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLBLENDPARAMETERINVPROC)this->m_functions[1402];if(direct_)return direct_(pname,value);return this->m_rawTable->glBlendParameteriNV(pname,value);}
+inline void glNamedProgramLocalParameter4dvEXT(GLuint program,GLenum target,GLuint index,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)this->m_functions[1403];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glNamedProgramLocalParameter4dvEXT(program,target,index,params);}
+inline void glProgramUniformHandleui64NV(GLuint program,GLint location,GLuint64 value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)this->m_functions[1404];if(direct_)return direct_(program,location,value);return this->m_rawTable->glProgramUniformHandleui64NV(program,location,value);}
+inline void glGetTextureParameterfvEXT(GLuint texture,GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERFVEXTPROC)this->m_functions[1405];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glGetTextureParameterfvEXT(texture,target,pname,params);}
+inline void glGetPathMetricsNV(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics)const{auto const direct_ = (FunctionTable::PFNGLGETPATHMETRICSNVPROC)this->m_functions[1406];if(direct_)return direct_(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);return this->m_rawTable->glGetPathMetricsNV(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);}
+inline void glVertex2i(GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2IPROC)this->m_functions[1407];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2i(x,y);}
+inline void glNewList(GLuint list,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLNEWLISTPROC)this->m_functions[1408];if(direct_)return direct_(list,mode);return this->m_rawTable->glNewList(list,mode);}
+inline void glMatrixLoad3x3fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOAD3X3FNVPROC)this->m_functions[1409];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixLoad3x3fNV(matrixMode,m);}
+inline void glMultiTexCoord2fARB(GLenum target,GLfloat s,GLfloat t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2FARBPROC)this->m_functions[1410];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2fARB(target,s,t);}
+inline void glWeightdvARB(GLint size,const GLdouble* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTDVARBPROC)this->m_functions[1411];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightdvARB(size,weights);}
+inline GLboolean glIsTransformFeedbackNV(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISTRANSFORMFEEDBACKNVPROC)this->m_functions[1412];if(direct_)return direct_(id);return this->m_rawTable->glIsTransformFeedbackNV(id);}
+inline void glVertexAttribDivisorARB(GLuint index,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBDIVISORARBPROC)this->m_functions[1413];if(direct_)return direct_(index,divisor);return this->m_rawTable->glVertexAttribDivisorARB(index,divisor);}
+inline void glSecondaryColorP3uiv(GLenum type,const GLuint* color)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORP3UIVPROC)this->m_functions[1414];if(direct_)return direct_(type,color);return this->m_rawTable->glSecondaryColorP3uiv(type,color);}
+inline void glGetnCompressedTexImageARB(GLenum target,GLint lod,GLsizei bufSize,void* img)const{auto const direct_ = (FunctionTable::PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)this->m_functions[1415];if(direct_)return direct_(target,lod,bufSize,img);return this->m_rawTable->glGetnCompressedTexImageARB(target,lod,bufSize,img);}
+inline void glGetIntegerv(GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGERVPROC)this->m_functions[1416];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetIntegerv(pname,params);}
+inline void glMatrixLoaddEXT(GLenum mode,const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADDEXTPROC)this->m_functions[1417];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixLoaddEXT(mode,m);}
+inline GLfloat glGetPathLengthNV(GLuint path,GLsizei startSegment,GLsizei numSegments)const{auto const direct_ = (FunctionTable::PFNGLGETPATHLENGTHNVPROC)this->m_functions[1418];if(direct_)return direct_(path,startSegment,numSegments);return this->m_rawTable->glGetPathLengthNV(path,startSegment,numSegments);}
+inline void glProgramUniformMatrix3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3DVPROC)this->m_functions[1419];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3dv(program,location,count,transpose,value);}
+inline void glUniform4i64NV(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4I64NVPROC)this->m_functions[1420];if(direct_)return direct_(location,x,y,z,w);return this->m_rawTable->glUniform4i64NV(location,x,y,z,w);}
+inline void glGetHistogramEXT(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMEXTPROC)this->m_functions[1421];if(direct_)return direct_(target,reset,format,type,values);return this->m_rawTable->glGetHistogramEXT(target,reset,format,type,values);}
+inline void glVertexAttrib4NuivARB(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUIVARBPROC)this->m_functions[1422];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NuivARB(index,v);}
+inline void glMapGrid2xOES(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID2XOESPROC)this->m_functions[1423];if(direct_)return direct_(n,u1,u2,v1,v2);return this->m_rawTable->glMapGrid2xOES(n,u1,u2,v1,v2);}
+inline void glTexImage2D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE2DPROC)this->m_functions[1424];if(direct_)return direct_(target,level,internalFormat,width,height,border,format,type,pixels);return this->m_rawTable->glTexImage2D(target,level,internalFormat,width,height,border,format,type,pixels);}
+inline void glWindowPos2fvARB(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FVARBPROC)this->m_functions[1425];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2fvARB(v);}
+inline void glEnableIndexedEXT(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEINDEXEDEXTPROC)this->m_functions[1426];if(direct_)return direct_(target,index);return this->m_rawTable->glEnableIndexedEXT(target,index);}
+inline void glTexCoord1bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1BVOESPROC)this->m_functions[1427];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord1bvOES(coords);}
+inline void glDrawPixels(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLDRAWPIXELSPROC)this->m_functions[1428];if(direct_)return direct_(width,height,format,type,pixels);return this->m_rawTable->glDrawPixels(width,height,format,type,pixels);}
+inline void glMultMatrixd(const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMULTMATRIXDPROC)this->m_functions[1429];if(direct_)return direct_(m);return this->m_rawTable->glMultMatrixd(m);}
+inline void glMultMatrixf(const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMULTMATRIXFPROC)this->m_functions[1430];if(direct_)return direct_(m);return this->m_rawTable->glMultMatrixf(m);}
+inline void glReplacementCodePointerSUN(GLenum type,GLsizei stride,const void** pointer)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEPOINTERSUNPROC)this->m_functions[1431];if(direct_)return direct_(type,stride,pointer);return this->m_rawTable->glReplacementCodePointerSUN(type,stride,pointer);}
+inline void glLoadTransposeMatrixdARB(const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLLOADTRANSPOSEMATRIXDARBPROC)this->m_functions[1432];if(direct_)return direct_(m);return this->m_rawTable->glLoadTransposeMatrixdARB(m);}
+inline void glVertexAttrib4Nubv(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUBVPROC)this->m_functions[1433];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Nubv(index,v);}
+inline void glVertexArrayVertexAttribIOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)this->m_functions[1434];if(direct_)return direct_(vaobj,buffer,index,size,type,stride,offset);return this->m_rawTable->glVertexArrayVertexAttribIOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+inline void glCompileShaderARB(GLhandleARB shaderObj)const{auto const direct_ = (FunctionTable::PFNGLCOMPILESHADERARBPROC)this->m_functions[1435];if(direct_)return direct_(shaderObj);return this->m_rawTable->glCompileShaderARB(shaderObj);}
+inline void glWindowPos3dMESA(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DMESAPROC)this->m_functions[1436];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3dMESA(x,y,z);}
+inline void glNormalStream3fvATI(GLenum stream,const GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3FVATIPROC)this->m_functions[1437];if(direct_)return direct_(stream,coords);return this->m_rawTable->glNormalStream3fvATI(stream,coords);}
+inline void glColor4usv(const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4USVPROC)this->m_functions[1438];if(direct_)return direct_(v);return this->m_rawTable->glColor4usv(v);}
+inline void glMapGrid1f(GLint un,GLfloat u1,GLfloat u2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID1FPROC)this->m_functions[1439];if(direct_)return direct_(un,u1,u2);return this->m_rawTable->glMapGrid1f(un,u1,u2);}
+inline void glPolygonStipple(const GLubyte* mask)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONSTIPPLEPROC)this->m_functions[1440];if(direct_)return direct_(mask);return this->m_rawTable->glPolygonStipple(mask);}
+inline void glUniform4ui64ARB(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UI64ARBPROC)this->m_functions[1441];if(direct_)return direct_(location,x,y,z,w);return this->m_rawTable->glUniform4ui64ARB(location,x,y,z,w);}
+inline void glTextureRenderbufferEXT(GLuint texture,GLenum target,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLTEXTURERENDERBUFFEREXTPROC)this->m_functions[1442];if(direct_)return direct_(texture,target,renderbuffer);return this->m_rawTable->glTextureRenderbufferEXT(texture,target,renderbuffer);}
+inline GLint glGetSubroutineUniformLocation(GLuint program,GLenum shadertype,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)this->m_functions[1443];if(direct_)return direct_(program,shadertype,name);return this->m_rawTable->glGetSubroutineUniformLocation(program,shadertype,name);}
+inline void glGetFramebufferParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAMEBUFFERPARAMETERIVPROC)this->m_functions[1444];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetFramebufferParameteriv(target,pname,params);}
+inline void glPixelMapusv(GLenum map,GLsizei mapsize,const GLushort* values)const{auto const direct_ = (FunctionTable::PFNGLPIXELMAPUSVPROC)this->m_functions[1445];if(direct_)return direct_(map,mapsize,values);return this->m_rawTable->glPixelMapusv(map,mapsize,values);}
+inline void glGetSamplerParameteriv(GLuint sampler,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETSAMPLERPARAMETERIVPROC)this->m_functions[1446];if(direct_)return direct_(sampler,pname,params);return this->m_rawTable->glGetSamplerParameteriv(sampler,pname,params);}
+inline void glVertexStream2fvATI(GLenum stream,const GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2FVATIPROC)this->m_functions[1447];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream2fvATI(stream,coords);}
+inline void glProgramStringARB(GLenum target,GLenum format,GLsizei len,const void* string)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMSTRINGARBPROC)this->m_functions[1448];if(direct_)return direct_(target,format,len,string);return this->m_rawTable->glProgramStringARB(target,format,len,string);}
+inline void glProgramUniformMatrix3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)this->m_functions[1449];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3dvEXT(program,location,count,transpose,value);}
+inline void glSeparableFilter2D(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column)const{auto const direct_ = (FunctionTable::PFNGLSEPARABLEFILTER2DPROC)this->m_functions[1450];if(direct_)return direct_(target,internalformat,width,height,format,type,row,column);return this->m_rawTable->glSeparableFilter2D(target,internalformat,width,height,format,type,row,column);}
+inline void glVertexAttribI1uiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1UIVPROC)this->m_functions[1451];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI1uiv(index,v);}
+inline void glLGPUCopyImageSubDataNVX(GLuint sourceGpu,GLbitfield destinationGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srxY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLLGPUCOPYIMAGESUBDATANVXPROC)this->m_functions[1452];if(direct_)return direct_(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);return this->m_rawTable->glLGPUCopyImageSubDataNVX(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+inline void glTexStorage2D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGE2DPROC)this->m_functions[1453];if(direct_)return direct_(target,levels,internalformat,width,height);return this->m_rawTable->glTexStorage2D(target,levels,internalformat,width,height);}
+inline void glColor3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3FVPROC)this->m_functions[1454];if(direct_)return direct_(v);return this->m_rawTable->glColor3fv(v);}
+inline void glGetMultiTexGendvEXT(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXGENDVEXTPROC)this->m_functions[1455];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glGetMultiTexGendvEXT(texunit,coord,pname,params);}
+inline void glVertexAttribL4dvEXT(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4DVEXTPROC)this->m_functions[1456];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL4dvEXT(index,v);}
+inline void glGetActiveUniform(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMPROC)this->m_functions[1457];if(direct_)return direct_(program,index,bufSize,length,size,type,name);return this->m_rawTable->glGetActiveUniform(program,index,bufSize,length,size,type,name);}
+inline void glUniform2ui64vARB(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UI64VARBPROC)this->m_functions[1458];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2ui64vARB(location,count,value);}
+inline void glMakeNamedBufferResidentNV(GLuint buffer,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAKENAMEDBUFFERRESIDENTNVPROC)this->m_functions[1459];if(direct_)return direct_(buffer,access);return this->m_rawTable->glMakeNamedBufferResidentNV(buffer,access);}
+inline GLenum glPathGlyphIndexRangeNV(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint baseAndCount[2])const{auto const direct_ = (FunctionTable::PFNGLPATHGLYPHINDEXRANGENVPROC)this->m_functions[1460];if(direct_)return direct_(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);return this->m_rawTable->glPathGlyphIndexRangeNV(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);}
+inline void glColorPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLCOLORPOINTERPROC)this->m_functions[1461];if(direct_)return direct_(size,type,stride,ptr);return this->m_rawTable->glColorPointer(size,type,stride,ptr);}
+inline void glProgramEnvParameterI4ivNV(GLenum target,GLuint index,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERI4IVNVPROC)this->m_functions[1462];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramEnvParameterI4ivNV(target,index,params);}
+inline void glMulticastGetQueryObjectui64vNV(GLuint gpu,GLuint id,GLenum pname,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)this->m_functions[1463];if(direct_)return direct_(gpu,id,pname,params);return this->m_rawTable->glMulticastGetQueryObjectui64vNV(gpu,id,pname,params);}
+inline void glMultiTexParameterfEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERFEXTPROC)this->m_functions[1464];if(direct_)return direct_(texunit,target,pname,param);return this->m_rawTable->glMultiTexParameterfEXT(texunit,target,pname,param);}
+inline void glNamedFramebufferTextureLayer(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)this->m_functions[1465];if(direct_)return direct_(framebuffer,attachment,texture,level,layer);return this->m_rawTable->glNamedFramebufferTextureLayer(framebuffer,attachment,texture,level,layer);}
+inline void glGetVertexArrayIntegervEXT(GLuint vaobj,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYINTEGERVEXTPROC)this->m_functions[1466];if(direct_)return direct_(vaobj,pname,param);return this->m_rawTable->glGetVertexArrayIntegervEXT(vaobj,pname,param);}
+inline void glVertexAttrib3dARB(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DARBPROC)this->m_functions[1467];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3dARB(index,x,y,z);}
+inline GLboolean glVDPAUIsSurfaceNV(GLvdpauSurfaceNV surface)const{auto const direct_ = (FunctionTable::PFNGLVDPAUISSURFACENVPROC)this->m_functions[1468];if(direct_)return direct_(surface);return this->m_rawTable->glVDPAUIsSurfaceNV(surface);}
+inline void glMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXIMAGE1DEXTPROC)this->m_functions[1469];if(direct_)return direct_(texunit,target,level,internalformat,width,border,format,type,pixels);return this->m_rawTable->glMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,format,type,pixels);}
+inline GLboolean glIsAsyncMarkerSGIX(GLuint marker)const{auto const direct_ = (FunctionTable::PFNGLISASYNCMARKERSGIXPROC)this->m_functions[1470];if(direct_)return direct_(marker);return this->m_rawTable->glIsAsyncMarkerSGIX(marker);}
+inline void glGetDoublei_vEXT(GLenum pname,GLuint index,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETDOUBLEI_VEXTPROC)this->m_functions[1471];if(direct_)return direct_(pname,index,params);return this->m_rawTable->glGetDoublei_vEXT(pname,index,params);}
+inline void glUniform2i64NV(GLint location,GLint64EXT x,GLint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2I64NVPROC)this->m_functions[1472];if(direct_)return direct_(location,x,y);return this->m_rawTable->glUniform2i64NV(location,x,y);}
+inline GLboolean glIsCommandListNV(GLuint list)const{auto const direct_ = (FunctionTable::PFNGLISCOMMANDLISTNVPROC)this->m_functions[1473];if(direct_)return direct_(list);return this->m_rawTable->glIsCommandListNV(list);}
+inline void glUniform3uiEXT(GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UIEXTPROC)this->m_functions[1474];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3uiEXT(location,v0,v1,v2);}
+inline void glTexParameterIuivEXT(GLenum target,GLenum pname,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIUIVEXTPROC)this->m_functions[1475];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterIuivEXT(target,pname,params);}
+inline void glProgramUniformMatrix4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4FVPROC)this->m_functions[1476];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4fv(program,location,count,transpose,value);}
+inline void glVertex2fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2FVPROC)this->m_functions[1477];if(direct_)return direct_(v);return this->m_rawTable->glVertex2fv(v);}
+inline void glVertexAttribL3dEXT(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3DEXTPROC)this->m_functions[1478];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribL3dEXT(index,x,y,z);}
+inline void glFramebufferRenderbuffer(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERRENDERBUFFERPROC)this->m_functions[1479];if(direct_)return direct_(target,attachment,renderbuffertarget,renderbuffer);return this->m_rawTable->glFramebufferRenderbuffer(target,attachment,renderbuffertarget,renderbuffer);}
+inline GLint glGetUniformLocationARB(GLhandleARB programObj,const GLcharARB* name)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMLOCATIONARBPROC)this->m_functions[1480];if(direct_)return direct_(programObj,name);return this->m_rawTable->glGetUniformLocationARB(programObj,name);}
+inline void glPathParameterfvNV(GLuint path,GLenum pname,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPATHPARAMETERFVNVPROC)this->m_functions[1481];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glPathParameterfvNV(path,pname,value);}
+inline void glVertexAttrib3sNV(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SNVPROC)this->m_functions[1482];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3sNV(index,x,y,z);}
+inline void glGetDoublei_v(GLenum target,GLuint index,GLdouble* data)const{auto const direct_ = (FunctionTable::PFNGLGETDOUBLEI_VPROC)this->m_functions[1483];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetDoublei_v(target,index,data);}
+inline void glVertexAttrib1sv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SVPROC)this->m_functions[1484];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1sv(index,v);}
+inline void glBindSampler(GLuint unit,GLuint sampler)const{auto const direct_ = (FunctionTable::PFNGLBINDSAMPLERPROC)this->m_functions[1485];if(direct_)return direct_(unit,sampler);return this->m_rawTable->glBindSampler(unit,sampler);}
+inline void glLineWidth(GLfloat width)const{auto const direct_ = (FunctionTable::PFNGLLINEWIDTHPROC)this->m_functions[1486];if(direct_)return direct_(width);return this->m_rawTable->glLineWidth(width);}
+inline void glVertexArrayRangeAPPLE(GLsizei length,void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYRANGEAPPLEPROC)this->m_functions[1487];if(direct_)return direct_(length,pointer);return this->m_rawTable->glVertexArrayRangeAPPLE(length,pointer);}
+inline void glBindBufferOffsetEXT(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFEROFFSETEXTPROC)this->m_functions[1488];if(direct_)return direct_(target,index,buffer,offset);return this->m_rawTable->glBindBufferOffsetEXT(target,index,buffer,offset);}
+inline void glWeightfvARB(GLint size,const GLfloat* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTFVARBPROC)this->m_functions[1489];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightfvARB(size,weights);}
+inline void glGetIntegeri_v(GLenum target,GLuint index,GLint* data)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGERI_VPROC)this->m_functions[1490];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetIntegeri_v(target,index,data);}
+inline void glGetTransformFeedbackVarying(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)this->m_functions[1491];if(direct_)return direct_(program,index,bufSize,length,size,type,name);return this->m_rawTable->glGetTransformFeedbackVarying(program,index,bufSize,length,size,type,name);}
+inline void glProgramLocalParameter4fvARB(GLenum target,GLuint index,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)this->m_functions[1492];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramLocalParameter4fvARB(target,index,params);}
+inline void glGetTransformFeedbackVaryingNV(GLuint program,GLuint index,GLint* location)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)this->m_functions[1493];if(direct_)return direct_(program,index,location);return this->m_rawTable->glGetTransformFeedbackVaryingNV(program,index,location);}
+inline void glWindowPos2iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IVPROC)this->m_functions[1494];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2iv(v);}
+inline void glVertexStream1dATI(GLenum stream,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM1DATIPROC)this->m_functions[1495];if(direct_)return direct_(stream,x);return this->m_rawTable->glVertexStream1dATI(stream,x);}
+inline void glColorFragmentOp2ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{auto const direct_ = (FunctionTable::PFNGLCOLORFRAGMENTOP2ATIPROC)this->m_functions[1496];if(direct_)return direct_(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);return this->m_rawTable->glColorFragmentOp2ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+inline void glFogiv(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLFOGIVPROC)this->m_functions[1497];if(direct_)return direct_(pname,params);return this->m_rawTable->glFogiv(pname,params);}
+inline GLuint64 glGetTextureHandleNV(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREHANDLENVPROC)this->m_functions[1498];if(direct_)return direct_(texture);return this->m_rawTable->glGetTextureHandleNV(texture);}
+inline void glLightModeliv(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELIVPROC)this->m_functions[1499];if(direct_)return direct_(pname,params);return this->m_rawTable->glLightModeliv(pname,params);}
+inline void glDepthRangef(GLfloat n,GLfloat f)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEFPROC)this->m_functions[1500];if(direct_)return direct_(n,f);return this->m_rawTable->glDepthRangef(n,f);}
+inline void glGetFragmentMaterialivSGIX(GLenum face,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGMENTMATERIALIVSGIXPROC)this->m_functions[1501];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glGetFragmentMaterialivSGIX(face,pname,params);}
+inline void glVideoCaptureStreamParameterfvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)this->m_functions[1502];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glVideoCaptureStreamParameterfvNV(video_capture_slot,stream,pname,params);}
+inline void glDeleteProgramsARB(GLsizei n,const GLuint* programs)const{auto const direct_ = (FunctionTable::PFNGLDELETEPROGRAMSARBPROC)this->m_functions[1503];if(direct_)return direct_(n,programs);return this->m_rawTable->glDeleteProgramsARB(n,programs);}
+inline void glWindowPos3fvARB(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FVARBPROC)this->m_functions[1504];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3fvARB(v);}
+inline void glFeedbackBufferxOES(GLsizei n,GLenum type,const GLfixed* buffer)const{auto const direct_ = (FunctionTable::PFNGLFEEDBACKBUFFERXOESPROC)this->m_functions[1505];if(direct_)return direct_(n,type,buffer);return this->m_rawTable->glFeedbackBufferxOES(n,type,buffer);}
+inline void glGetTexBumpParameterfvATI(GLenum pname,GLfloat* param)const{auto const direct_ = (FunctionTable::PFNGLGETTEXBUMPPARAMETERFVATIPROC)this->m_functions[1506];if(direct_)return direct_(pname,param);return this->m_rawTable->glGetTexBumpParameterfvATI(pname,param);}
+inline void glEnablei(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEIPROC)this->m_functions[1507];if(direct_)return direct_(target,index);return this->m_rawTable->glEnablei(target,index);}
+inline void glGetActiveSubroutineName(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVESUBROUTINENAMEPROC)this->m_functions[1508];if(direct_)return direct_(program,shadertype,index,bufsize,length,name);return this->m_rawTable->glGetActiveSubroutineName(program,shadertype,index,bufsize,length,name);}
+inline void glDrawBuffersARB(GLsizei n,const GLenum* bufs)const{auto const direct_ = (FunctionTable::PFNGLDRAWBUFFERSARBPROC)this->m_functions[1509];if(direct_)return direct_(n,bufs);return this->m_rawTable->glDrawBuffersARB(n,bufs);}
+inline void glBindProgramARB(GLenum target,GLuint program)const{auto const direct_ = (FunctionTable::PFNGLBINDPROGRAMARBPROC)this->m_functions[1510];if(direct_)return direct_(target,program);return this->m_rawTable->glBindProgramARB(target,program);}
+inline void glEvalCoord1fv(const GLfloat* u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1FVPROC)this->m_functions[1511];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord1fv(u);}
+inline void glProgramUniform3ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UI64VARBPROC)this->m_functions[1512];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3ui64vARB(program,location,count,value);}
+inline void glProgramUniformMatrix2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2DVPROC)this->m_functions[1513];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2dv(program,location,count,transpose,value);}
+inline void glMultiTexCoord2hvNV(GLenum target,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2HVNVPROC)this->m_functions[1514];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2hvNV(target,v);}
+inline void glGetFloatIndexedvEXT(GLenum target,GLuint index,GLfloat* data)const{auto const direct_ = (FunctionTable::PFNGLGETFLOATINDEXEDVEXTPROC)this->m_functions[1515];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetFloatIndexedvEXT(target,index,data);}
+inline void glSampleCoverageARB(GLfloat value,GLboolean invert)const{auto const direct_ = (FunctionTable::PFNGLSAMPLECOVERAGEARBPROC)this->m_functions[1516];if(direct_)return direct_(value,invert);return this->m_rawTable->glSampleCoverageARB(value,invert);}
+inline void glProgramUniform2ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UI64VARBPROC)this->m_functions[1517];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2ui64vARB(program,location,count,value);}
+inline void glPixelDataRangeNV(GLenum target,GLsizei length,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLPIXELDATARANGENVPROC)this->m_functions[1518];if(direct_)return direct_(target,length,pointer);return this->m_rawTable->glPixelDataRangeNV(target,length,pointer);}
+inline void glVertexStream3svATI(GLenum stream,const GLshort* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3SVATIPROC)this->m_functions[1519];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream3svATI(stream,coords);}
+inline void glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[1520];if(direct_)return direct_(rc,tc,n,v);return this->m_rawTable->glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc,tc,n,v);}
+inline void glTexCoord3hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3HVNVPROC)this->m_functions[1521];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord3hvNV(v);}
+inline void glSampleMaski(GLuint maskNumber,GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEMASKIPROC)this->m_functions[1522];if(direct_)return direct_(maskNumber,mask);return this->m_rawTable->glSampleMaski(maskNumber,mask);}
+inline void glIndexFuncEXT(GLenum func,GLclampf ref)const{auto const direct_ = (FunctionTable::PFNGLINDEXFUNCEXTPROC)this->m_functions[1523];if(direct_)return direct_(func,ref);return this->m_rawTable->glIndexFuncEXT(func,ref);}
+inline void glPointParameteriNV(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERINVPROC)this->m_functions[1524];if(direct_)return direct_(pname,param);return this->m_rawTable->glPointParameteriNV(pname,param);}
+inline void glUniformMatrix3x2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3X2FVPROC)this->m_functions[1525];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3x2fv(location,count,transpose,value);}
+inline void glGetFramebufferParameterivEXT(GLuint framebuffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)this->m_functions[1526];if(direct_)return direct_(framebuffer,pname,params);return this->m_rawTable->glGetFramebufferParameterivEXT(framebuffer,pname,params);}
+inline void glUniform2i64ARB(GLint location,GLint64 x,GLint64 y)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2I64ARBPROC)this->m_functions[1527];if(direct_)return direct_(location,x,y);return this->m_rawTable->glUniform2i64ARB(location,x,y);}
+inline void glNamedBufferStorageEXT(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSTORAGEEXTPROC)this->m_functions[1528];if(direct_)return direct_(buffer,size,data,flags);return this->m_rawTable->glNamedBufferStorageEXT(buffer,size,data,flags);}
+inline void glNamedFramebufferTexture3DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)this->m_functions[1529];if(direct_)return direct_(framebuffer,attachment,textarget,texture,level,zoffset);return this->m_rawTable->glNamedFramebufferTexture3DEXT(framebuffer,attachment,textarget,texture,level,zoffset);}
+inline void glVertexAttrib2dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DVPROC)this->m_functions[1530];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2dv(index,v);}
+inline void glGetVertexArrayPointervEXT(GLuint vaobj,GLenum pname,void** param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYPOINTERVEXTPROC)this->m_functions[1531];if(direct_)return direct_(vaobj,pname,param);return this->m_rawTable->glGetVertexArrayPointervEXT(vaobj,pname,param);}
+inline void glGetVertexAttribArrayObjectivATI(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)this->m_functions[1532];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribArrayObjectivATI(index,pname,params);}
+inline void glProgramUniformMatrix3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)this->m_functions[1533];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3fvEXT(program,location,count,transpose,value);}
+inline void glEnableVertexArrayEXT(GLuint vaobj,GLenum array)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXARRAYEXTPROC)this->m_functions[1534];if(direct_)return direct_(vaobj,array);return this->m_rawTable->glEnableVertexArrayEXT(vaobj,array);}
+inline void glColorTableParameterfvSGI(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEPARAMETERFVSGIPROC)this->m_functions[1535];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glColorTableParameterfvSGI(target,pname,params);}
+inline void glEdgeFlag(GLboolean flag)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGPROC)this->m_functions[1536];if(direct_)return direct_(flag);return this->m_rawTable->glEdgeFlag(flag);}
+inline void glFogCoordf(GLfloat coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDFPROC)this->m_functions[1537];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoordf(coord);}
+inline void glVertex3d(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3DPROC)this->m_functions[1538];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3d(x,y,z);}
+inline void glVertex3f(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3FPROC)this->m_functions[1539];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3f(x,y,z);}
+inline void glSpriteParameterivSGIX(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLSPRITEPARAMETERIVSGIXPROC)this->m_functions[1540];if(direct_)return direct_(pname,params);return this->m_rawTable->glSpriteParameterivSGIX(pname,params);}
+inline void glPathGlyphRangeNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{auto const direct_ = (FunctionTable::PFNGLPATHGLYPHRANGENVPROC)this->m_functions[1541];if(direct_)return direct_(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);return this->m_rawTable->glPathGlyphRangeNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);}
+inline void glPrimitiveBoundingBoxARB(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW)const{auto const direct_ = (FunctionTable::PFNGLPRIMITIVEBOUNDINGBOXARBPROC)this->m_functions[1542];if(direct_)return direct_(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);return this->m_rawTable->glPrimitiveBoundingBoxARB(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);}
+inline void glVertexAttribL3ui64vNV(GLuint index,const GLuint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3UI64VNVPROC)this->m_functions[1543];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL3ui64vNV(index,v);}
+inline void glVertex3s(GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3SPROC)this->m_functions[1544];if(direct_)return direct_(x,y,z);return this->m_rawTable->glVertex3s(x,y,z);}
+inline void glTexCoordP2ui(GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP2UIPROC)this->m_functions[1545];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP2ui(type,coords);}
+inline void glProgramUniform2fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2FVEXTPROC)this->m_functions[1546];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2fvEXT(program,location,count,value);}
+inline void glDeletePathsNV(GLuint path,GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLDELETEPATHSNVPROC)this->m_functions[1547];if(direct_)return direct_(path,range);return this->m_rawTable->glDeletePathsNV(path,range);}
+inline void glPrimitiveRestartIndexNV(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLPRIMITIVERESTARTINDEXNVPROC)this->m_functions[1548];if(direct_)return direct_(index);return this->m_rawTable->glPrimitiveRestartIndexNV(index);}
+inline void glTexCoord2fColor3fVertex3fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)this->m_functions[1549];if(direct_)return direct_(tc,c,v);return this->m_rawTable->glTexCoord2fColor3fVertex3fvSUN(tc,c,v);}
+inline void glTexCoordPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDPOINTERLISTIBMPROC)this->m_functions[1550];if(direct_)return direct_(size,type,stride,pointer,ptrstride);return this->m_rawTable->glTexCoordPointerListIBM(size,type,stride,pointer,ptrstride);}
+inline void glRectxOES(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2)const{auto const direct_ = (FunctionTable::PFNGLRECTXOESPROC)this->m_functions[1551];if(direct_)return direct_(x1,y1,x2,y2);return this->m_rawTable->glRectxOES(x1,y1,x2,y2);}
+inline void glCopyNamedBufferSubData(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLCOPYNAMEDBUFFERSUBDATAPROC)this->m_functions[1552];if(direct_)return direct_(readBuffer,writeBuffer,readOffset,writeOffset,size);return this->m_rawTable->glCopyNamedBufferSubData(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+inline void glGenProgramsNV(GLsizei n,GLuint* programs)const{auto const direct_ = (FunctionTable::PFNGLGENPROGRAMSNVPROC)this->m_functions[1553];if(direct_)return direct_(n,programs);return this->m_rawTable->glGenProgramsNV(n,programs);}
+inline void glFragmentLightfSGIX(GLenum light,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTFSGIXPROC)this->m_functions[1554];if(direct_)return direct_(light,pname,param);return this->m_rawTable->glFragmentLightfSGIX(light,pname,param);}
+inline void glTexStorage3D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGE3DPROC)this->m_functions[1555];if(direct_)return direct_(target,levels,internalformat,width,height,depth);return this->m_rawTable->glTexStorage3D(target,levels,internalformat,width,height,depth);}
+inline void glTextureParameteriv(GLuint texture,GLenum pname,const GLint* param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIVPROC)this->m_functions[1556];if(direct_)return direct_(texture,pname,param);return this->m_rawTable->glTextureParameteriv(texture,pname,param);}
+inline void glNamedBufferDataEXT(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERDATAEXTPROC)this->m_functions[1557];if(direct_)return direct_(buffer,size,data,usage);return this->m_rawTable->glNamedBufferDataEXT(buffer,size,data,usage);}
+inline void glImportSemaphoreWin32NameEXT(GLuint semaphore,GLenum handleType,const void* name)const{auto const direct_ = (FunctionTable::PFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)this->m_functions[1558];if(direct_)return direct_(semaphore,handleType,name);return this->m_rawTable->glImportSemaphoreWin32NameEXT(semaphore,handleType,name);}
+inline void glMultiTexCoord3fvARB(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3FVARBPROC)this->m_functions[1559];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3fvARB(target,v);}
+inline void glUniformMatrix3x4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3X4FVPROC)this->m_functions[1560];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3x4fv(location,count,transpose,value);}
+inline void glSubpixelPrecisionBiasNV(GLuint xbits,GLuint ybits)const{auto const direct_ = (FunctionTable::PFNGLSUBPIXELPRECISIONBIASNVPROC)this->m_functions[1561];if(direct_)return direct_(xbits,ybits);return this->m_rawTable->glSubpixelPrecisionBiasNV(xbits,ybits);}
+inline void glNormalPointer(GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLNORMALPOINTERPROC)this->m_functions[1562];if(direct_)return direct_(type,stride,ptr);return this->m_rawTable->glNormalPointer(type,stride,ptr);}
+inline void glNamedFramebufferTexture(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)this->m_functions[1563];if(direct_)return direct_(framebuffer,attachment,texture,level);return this->m_rawTable->glNamedFramebufferTexture(framebuffer,attachment,texture,level);}
+inline void glVertexAttrib4NsvARB(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NSVARBPROC)this->m_functions[1564];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NsvARB(index,v);}
+inline void glPassThrough(GLfloat token)const{auto const direct_ = (FunctionTable::PFNGLPASSTHROUGHPROC)this->m_functions[1565];if(direct_)return direct_(token);return this->m_rawTable->glPassThrough(token);}
+inline void glSecondaryColorP3ui(GLenum type,GLuint color)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORP3UIPROC)this->m_functions[1566];if(direct_)return direct_(type,color);return this->m_rawTable->glSecondaryColorP3ui(type,color);}
+inline void glInvalidateTexSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATETEXSUBIMAGEPROC)this->m_functions[1567];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth);return this->m_rawTable->glInvalidateTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth);}
+inline GLboolean glIsImageHandleResidentARB(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLISIMAGEHANDLERESIDENTARBPROC)this->m_functions[1568];if(direct_)return direct_(handle);return this->m_rawTable->glIsImageHandleResidentARB(handle);}
+inline void glTangent3fvEXT(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3FVEXTPROC)this->m_functions[1569];if(direct_)return direct_(v);return this->m_rawTable->glTangent3fvEXT(v);}
+inline void glProgramUniformMatrix4x3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)this->m_functions[1570];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x3fv(program,location,count,transpose,value);}
+inline void glBegin(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBEGINPROC)this->m_functions[1571];if(direct_)return direct_(mode);return this->m_rawTable->glBegin(mode);}
+inline void glEvalCoord2dv(const GLdouble* u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2DVPROC)this->m_functions[1572];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord2dv(u);}
+inline void glColor3ubv(const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3UBVPROC)this->m_functions[1573];if(direct_)return direct_(v);return this->m_rawTable->glColor3ubv(v);}
+inline void glFogCoordfvEXT(const GLfloat* coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDFVEXTPROC)this->m_functions[1574];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoordfvEXT(coord);}
+inline void glVertexP3ui(GLenum type,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP3UIPROC)this->m_functions[1575];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP3ui(type,value);}
+inline void glLightfv(GLenum light,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLLIGHTFVPROC)this->m_functions[1576];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glLightfv(light,pname,params);}
+inline void glVertexAttribL3i64NV(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3I64NVPROC)this->m_functions[1577];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribL3i64NV(index,x,y,z);}
+inline void glStencilClearTagEXT(GLsizei stencilTagBits,GLuint stencilClearTag)const{auto const direct_ = (FunctionTable::PFNGLSTENCILCLEARTAGEXTPROC)this->m_functions[1578];if(direct_)return direct_(stencilTagBits,stencilClearTag);return this->m_rawTable->glStencilClearTagEXT(stencilTagBits,stencilClearTag);}
+inline void glGetActiveUniformName(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMNAMEPROC)this->m_functions[1579];if(direct_)return direct_(program,uniformIndex,bufSize,length,uniformName);return this->m_rawTable->glGetActiveUniformName(program,uniformIndex,bufSize,length,uniformName);}
+inline void glTangentPointerEXT(GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLTANGENTPOINTEREXTPROC)this->m_functions[1580];if(direct_)return direct_(type,stride,pointer);return this->m_rawTable->glTangentPointerEXT(type,stride,pointer);}
+inline void glUniform4ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UI64VNVPROC)this->m_functions[1581];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4ui64vNV(location,count,value);}
+inline void glDebugMessageEnableAMD(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGEENABLEAMDPROC)this->m_functions[1582];if(direct_)return direct_(category,severity,count,ids,enabled);return this->m_rawTable->glDebugMessageEnableAMD(category,severity,count,ids,enabled);}
+inline void glProgramUniform2ui(GLuint program,GLint location,GLuint v0,GLuint v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UIPROC)this->m_functions[1583];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2ui(program,location,v0,v1);}
+inline void glCopyTexSubImage2DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE2DEXTPROC)this->m_functions[1584];if(direct_)return direct_(target,level,xoffset,yoffset,x,y,width,height);return this->m_rawTable->glCopyTexSubImage2DEXT(target,level,xoffset,yoffset,x,y,width,height);}
+inline void glGenRenderbuffersEXT(GLsizei n,GLuint* renderbuffers)const{auto const direct_ = (FunctionTable::PFNGLGENRENDERBUFFERSEXTPROC)this->m_functions[1585];if(direct_)return direct_(n,renderbuffers);return this->m_rawTable->glGenRenderbuffersEXT(n,renderbuffers);}
+inline void glNamedProgramLocalParameterI4ivEXT(GLuint program,GLenum target,GLuint index,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)this->m_functions[1586];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glNamedProgramLocalParameterI4ivEXT(program,target,index,params);}
+inline void glMultiTexCoord2f(GLenum target,GLfloat s,GLfloat t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2FPROC)this->m_functions[1587];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2f(target,s,t);}
+inline void glMapGrid2d(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID2DPROC)this->m_functions[1588];if(direct_)return direct_(un,u1,u2,vn,v1,v2);return this->m_rawTable->glMapGrid2d(un,u1,u2,vn,v1,v2);}
+inline void glGetMultiTexParameterIuivEXT(GLenum texunit,GLenum target,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXPARAMETERIUIVEXTPROC)this->m_functions[1589];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexParameterIuivEXT(texunit,target,pname,params);}
+inline void glBlendEquationiARB(GLuint buf,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONIARBPROC)this->m_functions[1590];if(direct_)return direct_(buf,mode);return this->m_rawTable->glBlendEquationiARB(buf,mode);}
+inline void glTexParameteriv(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIVPROC)this->m_functions[1591];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameteriv(target,pname,params);}
+inline void glUniform4ivARB(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4IVARBPROC)this->m_functions[1592];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4ivARB(location,count,value);}
+inline void glMatrixOrthoEXT(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{auto const direct_ = (FunctionTable::PFNGLMATRIXORTHOEXTPROC)this->m_functions[1593];if(direct_)return direct_(mode,left,right,bottom,top,zNear,zFar);return this->m_rawTable->glMatrixOrthoEXT(mode,left,right,bottom,top,zNear,zFar);}
+inline void glVertexArrayVertexBuffer(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXBUFFERPROC)this->m_functions[1594];if(direct_)return direct_(vaobj,bindingindex,buffer,offset,stride);return this->m_rawTable->glVertexArrayVertexBuffer(vaobj,bindingindex,buffer,offset,stride);}
+inline void glProgramLocalParametersI4ivNV(GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)this->m_functions[1595];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramLocalParametersI4ivNV(target,index,count,params);}
+inline void glProgramUniform4ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UI64VNVPROC)this->m_functions[1596];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4ui64vNV(program,location,count,value);}
+inline void glGetNamedStringivARB(GLint namelen,const GLchar* name,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDSTRINGIVARBPROC)this->m_functions[1597];if(direct_)return direct_(namelen,name,pname,params);return this->m_rawTable->glGetNamedStringivARB(namelen,name,pname,params);}
+inline void glVertexAttribL1i64vNV(GLuint index,const GLint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1I64VNVPROC)this->m_functions[1598];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL1i64vNV(index,v);}
+inline void glTransformFeedbackBufferBase(GLuint xfb,GLuint index,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)this->m_functions[1599];if(direct_)return direct_(xfb,index,buffer);return this->m_rawTable->glTransformFeedbackBufferBase(xfb,index,buffer);}
+inline void glIndexsv(const GLshort* c)const{auto const direct_ = (FunctionTable::PFNGLINDEXSVPROC)this->m_functions[1600];if(direct_)return direct_(c);return this->m_rawTable->glIndexsv(c);}
+inline void glPointParameterivNV(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERIVNVPROC)this->m_functions[1601];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterivNV(pname,params);}
+inline void glGetDetailTexFuncSGIS(GLenum target,GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLGETDETAILTEXFUNCSGISPROC)this->m_functions[1602];if(direct_)return direct_(target,points);return this->m_rawTable->glGetDetailTexFuncSGIS(target,points);}
+inline void glReplacementCodeuiColor3fVertex3fvSUN(const GLuint* rc,const GLfloat* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)this->m_functions[1603];if(direct_)return direct_(rc,c,v);return this->m_rawTable->glReplacementCodeuiColor3fVertex3fvSUN(rc,c,v);}
+inline void glProgramLocalParameter4fARB(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETER4FARBPROC)this->m_functions[1604];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramLocalParameter4fARB(target,index,x,y,z,w);}
+inline void glBitmap(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap)const{auto const direct_ = (FunctionTable::PFNGLBITMAPPROC)this->m_functions[1605];if(direct_)return direct_(width,height,xorig,yorig,xmove,ymove,bitmap);return this->m_rawTable->glBitmap(width,height,xorig,yorig,xmove,ymove,bitmap);}
+inline void glNamedFramebufferTextureLayerEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)this->m_functions[1606];if(direct_)return direct_(framebuffer,attachment,texture,level,layer);return this->m_rawTable->glNamedFramebufferTextureLayerEXT(framebuffer,attachment,texture,level,layer);}
+inline void glMultiTexGenfvEXT(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENFVEXTPROC)this->m_functions[1607];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glMultiTexGenfvEXT(texunit,coord,pname,params);}
+inline void glGetNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERSUBDATAPROC)this->m_functions[1608];if(direct_)return direct_(buffer,offset,size,data);return this->m_rawTable->glGetNamedBufferSubData(buffer,offset,size,data);}
+inline void glStencilFuncSeparateATI(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLSTENCILFUNCSEPARATEATIPROC)this->m_functions[1609];if(direct_)return direct_(frontfunc,backfunc,ref,mask);return this->m_rawTable->glStencilFuncSeparateATI(frontfunc,backfunc,ref,mask);}
+inline void glProgramUniform2iv(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2IVPROC)this->m_functions[1610];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2iv(program,location,count,value);}
+inline void glGetQueryiv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYIVPROC)this->m_functions[1611];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetQueryiv(target,pname,params);}
+inline void glTexCoord4f(GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FPROC)this->m_functions[1612];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4f(s,t,r,q);}
+inline void glMapGrid2f(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2)const{auto const direct_ = (FunctionTable::PFNGLMAPGRID2FPROC)this->m_functions[1613];if(direct_)return direct_(un,u1,u2,vn,v1,v2);return this->m_rawTable->glMapGrid2f(un,u1,u2,vn,v1,v2);}
+inline void glListParameterivSGIX(GLuint list,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLLISTPARAMETERIVSGIXPROC)this->m_functions[1614];if(direct_)return direct_(list,pname,params);return this->m_rawTable->glListParameterivSGIX(list,pname,params);}
+inline void glCreateQueries(GLenum target,GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLCREATEQUERIESPROC)this->m_functions[1615];if(direct_)return direct_(target,n,ids);return this->m_rawTable->glCreateQueries(target,n,ids);}
+inline void glGetSamplerParameterfv(GLuint sampler,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETSAMPLERPARAMETERFVPROC)this->m_functions[1616];if(direct_)return direct_(sampler,pname,params);return this->m_rawTable->glGetSamplerParameterfv(sampler,pname,params);}
+inline void glTexCoord4i(GLint s,GLint t,GLint r,GLint q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4IPROC)this->m_functions[1617];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4i(s,t,r,q);}
+inline void glObjectLabel(GLenum identifier,GLuint name,GLsizei length,const GLchar* label)const{auto const direct_ = (FunctionTable::PFNGLOBJECTLABELPROC)this->m_functions[1618];if(direct_)return direct_(identifier,name,length,label);return this->m_rawTable->glObjectLabel(identifier,name,length,label);}
+inline void glProgramUniform3i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3I64NVPROC)this->m_functions[1619];if(direct_)return direct_(program,location,x,y,z);return this->m_rawTable->glProgramUniform3i64NV(program,location,x,y,z);}
+inline GLuint64 glGetTextureHandleARB(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREHANDLEARBPROC)this->m_functions[1620];if(direct_)return direct_(texture);return this->m_rawTable->glGetTextureHandleARB(texture);}
+inline void glTexCoord4s(GLshort s,GLshort t,GLshort r,GLshort q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4SPROC)this->m_functions[1621];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4s(s,t,r,q);}
+inline void glUniform4iARB(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4IARBPROC)this->m_functions[1622];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4iARB(location,v0,v1,v2,v3);}
+inline void glGetUniformIndices(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMINDICESPROC)this->m_functions[1623];if(direct_)return direct_(program,uniformCount,uniformNames,uniformIndices);return this->m_rawTable->glGetUniformIndices(program,uniformCount,uniformNames,uniformIndices);}
+inline void glMultiTexImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXIMAGE3DEXTPROC)this->m_functions[1624];if(direct_)return direct_(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);return this->m_rawTable->glMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+inline void glCoverageModulationTableNV(GLsizei n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOVERAGEMODULATIONTABLENVPROC)this->m_functions[1625];if(direct_)return direct_(n,v);return this->m_rawTable->glCoverageModulationTableNV(n,v);}
+inline void glPointParameteriv(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERIVPROC)this->m_functions[1626];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameteriv(pname,params);}
+inline void glMultiTexCoord4svARB(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4SVARBPROC)this->m_functions[1627];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4svARB(target,v);}
+inline void glNormal3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3FVPROC)this->m_functions[1628];if(direct_)return direct_(v);return this->m_rawTable->glNormal3fv(v);}
+inline void glProgramUniformMatrix3x4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)this->m_functions[1629];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x4dvEXT(program,location,count,transpose,value);}
+inline void glTexCoord1fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1FVPROC)this->m_functions[1630];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord1fv(v);}
+inline void glProgramUniformMatrix4x3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)this->m_functions[1631];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x3dvEXT(program,location,count,transpose,value);}
+inline void glGetActiveVaryingNV(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEVARYINGNVPROC)this->m_functions[1632];if(direct_)return direct_(program,index,bufSize,length,size,type,name);return this->m_rawTable->glGetActiveVaryingNV(program,index,bufSize,length,size,type,name);}
+inline void glUniform1i64vARB(GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1I64VARBPROC)this->m_functions[1633];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1i64vARB(location,count,value);}
+inline void glMultiTexCoord1dv(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1DVPROC)this->m_functions[1634];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1dv(target,v);}
+inline void glTexCoord3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3FVPROC)this->m_functions[1635];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord3fv(v);}
+inline void glMatrixTranslatefEXT(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXTRANSLATEFEXTPROC)this->m_functions[1636];if(direct_)return direct_(mode,x,y,z);return this->m_rawTable->glMatrixTranslatefEXT(mode,x,y,z);}
+inline void glProgramUniform1ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UI64VNVPROC)this->m_functions[1637];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1ui64vNV(program,location,count,value);}
+inline void glTextureMaterialEXT(GLenum face,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREMATERIALEXTPROC)this->m_functions[1638];if(direct_)return direct_(face,mode);return this->m_rawTable->glTextureMaterialEXT(face,mode);}
+inline void glMultiTexCoordP3uiv(GLenum texture,GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP3UIVPROC)this->m_functions[1639];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP3uiv(texture,type,coords);}
+inline void glVertexAttribP3ui(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP3UIPROC)this->m_functions[1640];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP3ui(index,type,normalized,value);}
+inline void glInterpolatePathsNV(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight)const{auto const direct_ = (FunctionTable::PFNGLINTERPOLATEPATHSNVPROC)this->m_functions[1641];if(direct_)return direct_(resultPath,pathA,pathB,weight);return this->m_rawTable->glInterpolatePathsNV(resultPath,pathA,pathB,weight);}
+inline void glTextureBufferRange(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBUFFERRANGEPROC)this->m_functions[1642];if(direct_)return direct_(texture,internalformat,buffer,offset,size);return this->m_rawTable->glTextureBufferRange(texture,internalformat,buffer,offset,size);}
+inline void glVertexAttribL2dEXT(GLuint index,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2DEXTPROC)this->m_functions[1643];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribL2dEXT(index,x,y);}
+inline void glGetPixelTransformParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)this->m_functions[1644];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetPixelTransformParameterivEXT(target,pname,params);}
+inline void glTexCoord4xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4XVOESPROC)this->m_functions[1645];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord4xvOES(coords);}
+inline void glGetVariantBooleanvEXT(GLuint id,GLenum value,GLboolean* data)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTBOOLEANVEXTPROC)this->m_functions[1646];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetVariantBooleanvEXT(id,value,data);}
+inline void glDepthRange(GLclampd near_val,GLclampd far_val)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEPROC)this->m_functions[1647];if(direct_)return direct_(near_val,far_val);return this->m_rawTable->glDepthRange(near_val,far_val);}
+inline void glGetVertexAttribdvARB(GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBDVARBPROC)this->m_functions[1648];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribdvARB(index,pname,params);}
+inline void glGetColorTableParameterfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERFVPROC)this->m_functions[1649];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameterfv(target,pname,params);}
+inline void glDrawArraysInstancedEXT(GLenum mode,GLint start,GLsizei count,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSINSTANCEDEXTPROC)this->m_functions[1650];if(direct_)return direct_(mode,start,count,primcount);return this->m_rawTable->glDrawArraysInstancedEXT(mode,start,count,primcount);}
+inline void glDisableClientStateIndexedEXT(GLenum array,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)this->m_functions[1651];if(direct_)return direct_(array,index);return this->m_rawTable->glDisableClientStateIndexedEXT(array,index);}
+inline void glDrawBuffer(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLDRAWBUFFERPROC)this->m_functions[1652];if(direct_)return direct_(mode);return this->m_rawTable->glDrawBuffer(mode);}
+inline void glMultiDrawArraysIndirectBindlessNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)this->m_functions[1653];if(direct_)return direct_(mode,indirect,drawCount,stride,vertexBufferCount);return this->m_rawTable->glMultiDrawArraysIndirectBindlessNV(mode,indirect,drawCount,stride,vertexBufferCount);}
+inline void glGetnPixelMapusv(GLenum map,GLsizei bufSize,GLushort* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPUSVPROC)this->m_functions[1654];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapusv(map,bufSize,values);}
+inline void glRasterPos3fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3FVPROC)this->m_functions[1655];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos3fv(v);}
+inline void glClearBufferuiv(GLenum buffer,GLint drawbuffer,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERUIVPROC)this->m_functions[1656];if(direct_)return direct_(buffer,drawbuffer,value);return this->m_rawTable->glClearBufferuiv(buffer,drawbuffer,value);}
+inline void glGetInternalformati64v(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETINTERNALFORMATI64VPROC)this->m_functions[1657];if(direct_)return direct_(target,internalformat,pname,bufSize,params);return this->m_rawTable->glGetInternalformati64v(target,internalformat,pname,bufSize,params);}
+inline void glShaderSourceARB(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length)const{auto const direct_ = (FunctionTable::PFNGLSHADERSOURCEARBPROC)this->m_functions[1658];if(direct_)return direct_(shaderObj,count,string,length);return this->m_rawTable->glShaderSourceARB(shaderObj,count,string,length);}
+inline void glShaderOp3EXT(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3)const{auto const direct_ = (FunctionTable::PFNGLSHADEROP3EXTPROC)this->m_functions[1659];if(direct_)return direct_(op,res,arg1,arg2,arg3);return this->m_rawTable->glShaderOp3EXT(op,res,arg1,arg2,arg3);}
+inline void glWindowPos2dvMESA(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DVMESAPROC)this->m_functions[1660];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2dvMESA(v);}
+inline void glClearIndex(GLfloat c)const{auto const direct_ = (FunctionTable::PFNGLCLEARINDEXPROC)this->m_functions[1661];if(direct_)return direct_(c);return this->m_rawTable->glClearIndex(c);}
+inline void glProvokingVertexEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLPROVOKINGVERTEXEXTPROC)this->m_functions[1662];if(direct_)return direct_(mode);return this->m_rawTable->glProvokingVertexEXT(mode);}
+inline void glVariantubvEXT(GLuint id,const GLubyte* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTUBVEXTPROC)this->m_functions[1663];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantubvEXT(id,addr);}
+inline void glFlush()const{auto const direct_ = (FunctionTable::PFNGLFLUSHPROC)this->m_functions[1664];if(direct_)return direct_();return this->m_rawTable->glFlush();}
+inline void glFramebufferTexture2DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)this->m_functions[1665];if(direct_)return direct_(target,attachment,textarget,texture,level);return this->m_rawTable->glFramebufferTexture2DEXT(target,attachment,textarget,texture,level);}
+inline void glGetColorTableParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERIVEXTPROC)this->m_functions[1666];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameterivEXT(target,pname,params);}
+inline void glPresentFrameDualFillNV(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3)const{auto const direct_ = (FunctionTable::PFNGLPRESENTFRAMEDUALFILLNVPROC)this->m_functions[1667];if(direct_)return direct_(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);return this->m_rawTable->glPresentFrameDualFillNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);}
+inline GLuint glGenVertexShadersEXT(GLuint range)const{auto const direct_ = (FunctionTable::PFNGLGENVERTEXSHADERSEXTPROC)this->m_functions[1668];if(direct_)return direct_(range);return this->m_rawTable->glGenVertexShadersEXT(range);}
+inline void glSpecializeShaderARB(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{auto const direct_ = (FunctionTable::PFNGLSPECIALIZESHADERARBPROC)this->m_functions[1669];if(direct_)return direct_(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);return this->m_rawTable->glSpecializeShaderARB(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+inline void glProgramUniformHandleui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)this->m_functions[1670];if(direct_)return direct_(program,location,count,values);return this->m_rawTable->glProgramUniformHandleui64vARB(program,location,count,values);}
+inline void glDepthRangefOES(GLclampf n,GLclampf f)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEFOESPROC)this->m_functions[1671];if(direct_)return direct_(n,f);return this->m_rawTable->glDepthRangefOES(n,f);}
+inline void glDeleteVertexArrays(GLsizei n,const GLuint* arrays)const{auto const direct_ = (FunctionTable::PFNGLDELETEVERTEXARRAYSPROC)this->m_functions[1672];if(direct_)return direct_(n,arrays);return this->m_rawTable->glDeleteVertexArrays(n,arrays);}
+inline void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)this->m_functions[1673];if(direct_)return direct_(mode,count,type,indices,instancecount,basevertex,baseinstance);return this->m_rawTable->glDrawElementsInstancedBaseVertexBaseInstance(mode,count,type,indices,instancecount,basevertex,baseinstance);}
+inline void glGetTexLevelParameteriv(GLenum target,GLint level,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXLEVELPARAMETERIVPROC)this->m_functions[1674];if(direct_)return direct_(target,level,pname,params);return this->m_rawTable->glGetTexLevelParameteriv(target,level,pname,params);}
+inline void glDrawVkImageNV(GLuint64 vkImage,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{auto const direct_ = (FunctionTable::PFNGLDRAWVKIMAGENVPROC)this->m_functions[1675];if(direct_)return direct_(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);return this->m_rawTable->glDrawVkImageNV(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+inline void glWindowPos3iARB(GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IARBPROC)this->m_functions[1676];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3iARB(x,y,z);}
+inline void glPrioritizeTextures(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{auto const direct_ = (FunctionTable::PFNGLPRIORITIZETEXTURESPROC)this->m_functions[1677];if(direct_)return direct_(n,textures,priorities);return this->m_rawTable->glPrioritizeTextures(n,textures,priorities);}
+inline void glWindowPos3fvMESA(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FVMESAPROC)this->m_functions[1678];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3fvMESA(v);}
+inline void glProgramUniformMatrix3x2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)this->m_functions[1679];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x2dvEXT(program,location,count,transpose,value);}
+inline void glVertex4xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4XVOESPROC)this->m_functions[1680];if(direct_)return direct_(coords);return this->m_rawTable->glVertex4xvOES(coords);}
+inline void glTexStorage3DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGE3DMULTISAMPLEPROC)this->m_functions[1681];if(direct_)return direct_(target,samples,internalformat,width,height,depth,fixedsamplelocations);return this->m_rawTable->glTexStorage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+inline void glWindowPos2sARB(GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SARBPROC)this->m_functions[1682];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2sARB(x,y);}
+inline void glStencilOpValueAMD(GLenum face,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLSTENCILOPVALUEAMDPROC)this->m_functions[1683];if(direct_)return direct_(face,value);return this->m_rawTable->glStencilOpValueAMD(face,value);}
+inline void glProgramVertexLimitNV(GLenum target,GLint limit)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMVERTEXLIMITNVPROC)this->m_functions[1684];if(direct_)return direct_(target,limit);return this->m_rawTable->glProgramVertexLimitNV(target,limit);}
+inline void glGetTexParameterPointervAPPLE(GLenum target,GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)this->m_functions[1685];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterPointervAPPLE(target,pname,params);}
+inline void glProgramUniform3uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UIVEXTPROC)this->m_functions[1686];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3uivEXT(program,location,count,value);}
+inline void glClampColor(GLenum target,GLenum clamp)const{auto const direct_ = (FunctionTable::PFNGLCLAMPCOLORPROC)this->m_functions[1687];if(direct_)return direct_(target,clamp);return this->m_rawTable->glClampColor(target,clamp);}
+inline void glClearStencil(GLint s)const{auto const direct_ = (FunctionTable::PFNGLCLEARSTENCILPROC)this->m_functions[1688];if(direct_)return direct_(s);return this->m_rawTable->glClearStencil(s);}
+inline void glTexCoordP1uiv(GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP1UIVPROC)this->m_functions[1689];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP1uiv(type,coords);}
+inline void glVertexAttribs3svNV(GLuint index,GLsizei count,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS3SVNVPROC)this->m_functions[1690];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs3svNV(index,count,v);}
+inline void glMultiTexCoord3fv(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3FVPROC)this->m_functions[1691];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3fv(target,v);}
+inline void glVertexBlendEnvfATI(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLVERTEXBLENDENVFATIPROC)this->m_functions[1692];if(direct_)return direct_(pname,param);return this->m_rawTable->glVertexBlendEnvfATI(pname,param);}
+inline GLboolean glIsFenceAPPLE(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLISFENCEAPPLEPROC)this->m_functions[1693];if(direct_)return direct_(fence);return this->m_rawTable->glIsFenceAPPLE(fence);}
+inline void glGetBufferParameterui64vNV(GLenum target,GLenum pname,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPARAMETERUI64VNVPROC)this->m_functions[1694];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferParameterui64vNV(target,pname,params);}
+inline void glVertexAttribI4bvEXT(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4BVEXTPROC)this->m_functions[1695];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4bvEXT(index,v);}
+inline void glUniform2fARB(GLint location,GLfloat v0,GLfloat v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2FARBPROC)this->m_functions[1696];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2fARB(location,v0,v1);}
+inline void glStopInstrumentsSGIX(GLint marker)const{auto const direct_ = (FunctionTable::PFNGLSTOPINSTRUMENTSSGIXPROC)this->m_functions[1697];if(direct_)return direct_(marker);return this->m_rawTable->glStopInstrumentsSGIX(marker);}
+inline void glVertexAttrib3fNV(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FNVPROC)this->m_functions[1698];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3fNV(index,x,y,z);}
+inline void glMapVertexAttrib2dAPPLE(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{auto const direct_ = (FunctionTable::PFNGLMAPVERTEXATTRIB2DAPPLEPROC)this->m_functions[1699];if(direct_)return direct_(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);return this->m_rawTable->glMapVertexAttrib2dAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+inline void glVertex2f(GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2FPROC)this->m_functions[1700];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2f(x,y);}
+inline void glCopyTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTUREIMAGE2DEXTPROC)this->m_functions[1701];if(direct_)return direct_(texture,target,level,internalformat,x,y,width,height,border);return this->m_rawTable->glCopyTextureImage2DEXT(texture,target,level,internalformat,x,y,width,height,border);}
+inline void glVertex2d(GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2DPROC)this->m_functions[1702];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2d(x,y);}
+inline void glSecondaryColor3bvEXT(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3BVEXTPROC)this->m_functions[1703];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3bvEXT(v);}
+inline void glMultiTexCoord4fARB(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4FARBPROC)this->m_functions[1704];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4fARB(target,s,t,r,q);}
+inline void glPolygonOffset(GLfloat factor,GLfloat units)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONOFFSETPROC)this->m_functions[1705];if(direct_)return direct_(factor,units);return this->m_rawTable->glPolygonOffset(factor,units);}
+inline void glTangent3bvEXT(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3BVEXTPROC)this->m_functions[1706];if(direct_)return direct_(v);return this->m_rawTable->glTangent3bvEXT(v);}
+inline void glHistogram(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{auto const direct_ = (FunctionTable::PFNGLHISTOGRAMPROC)this->m_functions[1707];if(direct_)return direct_(target,width,internalformat,sink);return this->m_rawTable->glHistogram(target,width,internalformat,sink);}
+inline void glGetProgramiv(GLuint program,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMIVPROC)this->m_functions[1708];if(direct_)return direct_(program,pname,params);return this->m_rawTable->glGetProgramiv(program,pname,params);}
+inline void glMatrixIndexubvARB(GLint size,const GLubyte* indices)const{auto const direct_ = (FunctionTable::PFNGLMATRIXINDEXUBVARBPROC)this->m_functions[1709];if(direct_)return direct_(size,indices);return this->m_rawTable->glMatrixIndexubvARB(size,indices);}
+inline void glVertex2s(GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2SPROC)this->m_functions[1710];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2s(x,y);}
+inline void glGetVertexAttribLui64vNV(GLuint index,GLenum pname,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBLUI64VNVPROC)this->m_functions[1711];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribLui64vNV(index,pname,params);}
+inline void glGetProgramStringARB(GLenum target,GLenum pname,void* string)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMSTRINGARBPROC)this->m_functions[1712];if(direct_)return direct_(target,pname,string);return this->m_rawTable->glGetProgramStringARB(target,pname,string);}
+inline void glFlushMappedBufferRange(GLenum target,GLintptr offset,GLsizeiptr length)const{auto const direct_ = (FunctionTable::PFNGLFLUSHMAPPEDBUFFERRANGEPROC)this->m_functions[1713];if(direct_)return direct_(target,offset,length);return this->m_rawTable->glFlushMappedBufferRange(target,offset,length);}
+inline void glVertexAttribI3uiEXT(GLuint index,GLuint x,GLuint y,GLuint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI3UIEXTPROC)this->m_functions[1714];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribI3uiEXT(index,x,y,z);}
+inline void glLineWidthxOES(GLfixed width)const{auto const direct_ = (FunctionTable::PFNGLLINEWIDTHXOESPROC)this->m_functions[1715];if(direct_)return direct_(width);return this->m_rawTable->glLineWidthxOES(width);}
+inline void glProgramUniformMatrix2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)this->m_functions[1716];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2fvEXT(program,location,count,transpose,value);}
+inline void glGetTextureParameterIuivEXT(GLuint texture,GLenum target,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIUIVEXTPROC)this->m_functions[1717];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glGetTextureParameterIuivEXT(texture,target,pname,params);}
+inline void glGetMultiTexEnvivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXENVIVEXTPROC)this->m_functions[1718];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glGetMultiTexEnvivEXT(texunit,target,pname,params);}
+inline void glPixelTexGenParameterivSGIS(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPIXELTEXGENPARAMETERIVSGISPROC)this->m_functions[1719];if(direct_)return direct_(pname,params);return this->m_rawTable->glPixelTexGenParameterivSGIS(pname,params);}
+inline void glGenQueries(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLGENQUERIESPROC)this->m_functions[1720];if(direct_)return direct_(n,ids);return this->m_rawTable->glGenQueries(n,ids);}
+inline void glGetPixelMapfv(GLenum map,GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELMAPFVPROC)this->m_functions[1721];if(direct_)return direct_(map,values);return this->m_rawTable->glGetPixelMapfv(map,values);}
+inline void glBlendColorEXT(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDCOLOREXTPROC)this->m_functions[1722];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glBlendColorEXT(red,green,blue,alpha);}
+inline void glResetMinmax(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLRESETMINMAXPROC)this->m_functions[1723];if(direct_)return direct_(target);return this->m_rawTable->glResetMinmax(target);}
+inline void glGetnUniformivARB(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMIVARBPROC)this->m_functions[1724];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformivARB(program,location,bufSize,params);}
+inline void glVertexBlendARB(GLint count)const{auto const direct_ = (FunctionTable::PFNGLVERTEXBLENDARBPROC)this->m_functions[1725];if(direct_)return direct_(count);return this->m_rawTable->glVertexBlendARB(count);}
+inline void glVertexAttrib4d(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DPROC)this->m_functions[1726];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4d(index,x,y,z,w);}
+inline GLint glGetVaryingLocationNV(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETVARYINGLOCATIONNVPROC)this->m_functions[1727];if(direct_)return direct_(program,name);return this->m_rawTable->glGetVaryingLocationNV(program,name);}
+inline void glGetMapAttribParameterivNV(GLenum target,GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMAPATTRIBPARAMETERIVNVPROC)this->m_functions[1728];if(direct_)return direct_(target,index,pname,params);return this->m_rawTable->glGetMapAttribParameterivNV(target,index,pname,params);}
+inline void glTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE3DPROC)this->m_functions[1729];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);return this->m_rawTable->glTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+inline void glDeleteSamplers(GLsizei count,const GLuint* samplers)const{auto const direct_ = (FunctionTable::PFNGLDELETESAMPLERSPROC)this->m_functions[1730];if(direct_)return direct_(count,samplers);return this->m_rawTable->glDeleteSamplers(count,samplers);}
+inline void glGetLightxOES(GLenum light,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETLIGHTXOESPROC)this->m_functions[1731];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glGetLightxOES(light,pname,params);}
+inline void glGetVertexAttribArrayObjectfvATI(GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)this->m_functions[1732];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribArrayObjectfvATI(index,pname,params);}
+inline void glVertexArrayNormalOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYNORMALOFFSETEXTPROC)this->m_functions[1733];if(direct_)return direct_(vaobj,buffer,type,stride,offset);return this->m_rawTable->glVertexArrayNormalOffsetEXT(vaobj,buffer,type,stride,offset);}
+inline void glGetBufferParameterivARB(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPARAMETERIVARBPROC)this->m_functions[1734];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferParameterivARB(target,pname,params);}
+inline void glGetTextureParameterfv(GLuint texture,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERFVPROC)this->m_functions[1735];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glGetTextureParameterfv(texture,pname,params);}
+inline void glDrawMeshArraysSUN(GLenum mode,GLint first,GLsizei count,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLDRAWMESHARRAYSSUNPROC)this->m_functions[1736];if(direct_)return direct_(mode,first,count,width);return this->m_rawTable->glDrawMeshArraysSUN(mode,first,count,width);}
+inline void glVertexAttrib4dNV(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DNVPROC)this->m_functions[1737];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4dNV(index,x,y,z,w);}
+inline void glGetMultisamplefvNV(GLenum pname,GLuint index,GLfloat* val)const{auto const direct_ = (FunctionTable::PFNGLGETMULTISAMPLEFVNVPROC)this->m_functions[1738];if(direct_)return direct_(pname,index,val);return this->m_rawTable->glGetMultisamplefvNV(pname,index,val);}
+inline void* glMapObjectBufferATI(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLMAPOBJECTBUFFERATIPROC)this->m_functions[1739];if(direct_)return direct_(buffer);return this->m_rawTable->glMapObjectBufferATI(buffer);}
+inline void glGetPathCommandsNV(GLuint path,GLubyte* commands)const{auto const direct_ = (FunctionTable::PFNGLGETPATHCOMMANDSNVPROC)this->m_functions[1740];if(direct_)return direct_(path,commands);return this->m_rawTable->glGetPathCommandsNV(path,commands);}
+inline void glVertexArrayTexCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)this->m_functions[1741];if(direct_)return direct_(vaobj,buffer,size,type,stride,offset);return this->m_rawTable->glVertexArrayTexCoordOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+inline void glGetHistogram(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPROC)this->m_functions[1742];if(direct_)return direct_(target,reset,format,type,values);return this->m_rawTable->glGetHistogram(target,reset,format,type,values);}
+inline void glMatrixMode(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMODEPROC)this->m_functions[1743];if(direct_)return direct_(mode);return this->m_rawTable->glMatrixMode(mode);}
+inline void glColorFormatNV(GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLCOLORFORMATNVPROC)this->m_functions[1744];if(direct_)return direct_(size,type,stride);return this->m_rawTable->glColorFormatNV(size,type,stride);}
+inline void glProgramUniformui64NV(GLuint program,GLint location,GLuint64EXT value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMUI64NVPROC)this->m_functions[1745];if(direct_)return direct_(program,location,value);return this->m_rawTable->glProgramUniformui64NV(program,location,value);}
+inline void glProgramUniformMatrix4x2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)this->m_functions[1746];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x2fvEXT(program,location,count,transpose,value);}
+inline void glLoadMatrixxOES(const GLfixed* m)const{auto const direct_ = (FunctionTable::PFNGLLOADMATRIXXOESPROC)this->m_functions[1747];if(direct_)return direct_(m);return this->m_rawTable->glLoadMatrixxOES(m);}
+inline void glGetColorTableParameterfvEXT(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERFVEXTPROC)this->m_functions[1748];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameterfvEXT(target,pname,params);}
+inline void glRasterPos4i(GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4IPROC)this->m_functions[1749];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glRasterPos4i(x,y,z,w);}
+inline void glVertexAttribL2i64NV(GLuint index,GLint64EXT x,GLint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2I64NVPROC)this->m_functions[1750];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribL2i64NV(index,x,y);}
+inline void glBindTextures(GLuint first,GLsizei count,const GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXTURESPROC)this->m_functions[1751];if(direct_)return direct_(first,count,textures);return this->m_rawTable->glBindTextures(first,count,textures);}
+inline void glMatrixRotatefEXT(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXROTATEFEXTPROC)this->m_functions[1752];if(direct_)return direct_(mode,angle,x,y,z);return this->m_rawTable->glMatrixRotatefEXT(mode,angle,x,y,z);}
+inline void glGetClipPlanexOES(GLenum plane,GLfixed* equation)const{auto const direct_ = (FunctionTable::PFNGLGETCLIPPLANEXOESPROC)this->m_functions[1753];if(direct_)return direct_(plane,equation);return this->m_rawTable->glGetClipPlanexOES(plane,equation);}
+inline void glSecondaryColor3uivEXT(const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UIVEXTPROC)this->m_functions[1754];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3uivEXT(v);}
+inline void glGetPerfQueryInfoINTEL(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask)const{auto const direct_ = (FunctionTable::PFNGLGETPERFQUERYINFOINTELPROC)this->m_functions[1755];if(direct_)return direct_(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);return this->m_rawTable->glGetPerfQueryInfoINTEL(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);}
+inline void glGetDoublev(GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETDOUBLEVPROC)this->m_functions[1756];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetDoublev(pname,params);}
+inline void glBindBufferRangeEXT(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERRANGEEXTPROC)this->m_functions[1757];if(direct_)return direct_(target,index,buffer,offset,size);return this->m_rawTable->glBindBufferRangeEXT(target,index,buffer,offset,size);}
+inline void glCompressedTexImage2D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE2DPROC)this->m_functions[1758];if(direct_)return direct_(target,level,internalformat,width,height,border,imageSize,data);return this->m_rawTable->glCompressedTexImage2D(target,level,internalformat,width,height,border,imageSize,data);}
+inline void* glMapBufferARB(GLenum target,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAPBUFFERARBPROC)this->m_functions[1759];if(direct_)return direct_(target,access);return this->m_rawTable->glMapBufferARB(target,access);}
+inline void glGetPathSpacingNV(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing)const{auto const direct_ = (FunctionTable::PFNGLGETPATHSPACINGNVPROC)this->m_functions[1760];if(direct_)return direct_(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);return this->m_rawTable->glGetPathSpacingNV(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);}
+inline void glUniform4dv(GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4DVPROC)this->m_functions[1761];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4dv(location,count,value);}
+inline void glGlobalAlphaFactordSUN(GLdouble factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORDSUNPROC)this->m_functions[1762];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactordSUN(factor);}
+inline void glProgramUniform3dv(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3DVPROC)this->m_functions[1763];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3dv(program,location,count,value);}
+inline void glGetShaderSourceARB(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source)const{auto const direct_ = (FunctionTable::PFNGLGETSHADERSOURCEARBPROC)this->m_functions[1764];if(direct_)return direct_(obj,maxLength,length,source);return this->m_rawTable->glGetShaderSourceARB(obj,maxLength,length,source);}
+inline void glVertexAttrib3dvARB(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DVARBPROC)this->m_functions[1765];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3dvARB(index,v);}
+inline void glInvalidateBufferData(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATEBUFFERDATAPROC)this->m_functions[1766];if(direct_)return direct_(buffer);return this->m_rawTable->glInvalidateBufferData(buffer);}
+inline void glMatrixLoad3x2fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOAD3X2FNVPROC)this->m_functions[1767];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixLoad3x2fNV(matrixMode,m);}
+inline void glCompressedTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)this->m_functions[1768];if(direct_)return direct_(texture,level,xoffset,width,format,imageSize,data);return this->m_rawTable->glCompressedTextureSubImage1D(texture,level,xoffset,width,format,imageSize,data);}
+inline void glTexCoord3xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3XVOESPROC)this->m_functions[1769];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord3xvOES(coords);}
+inline void glGenTexturesEXT(GLsizei n,GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLGENTEXTURESEXTPROC)this->m_functions[1770];if(direct_)return direct_(n,textures);return this->m_rawTable->glGenTexturesEXT(n,textures);}
+inline void glTangent3iEXT(GLint tx,GLint ty,GLint tz)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3IEXTPROC)this->m_functions[1771];if(direct_)return direct_(tx,ty,tz);return this->m_rawTable->glTangent3iEXT(tx,ty,tz);}
+inline void glClearTexImage(GLuint texture,GLint level,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARTEXIMAGEPROC)this->m_functions[1772];if(direct_)return direct_(texture,level,format,type,data);return this->m_rawTable->glClearTexImage(texture,level,format,type,data);}
+inline void glBinormal3bvEXT(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3BVEXTPROC)this->m_functions[1773];if(direct_)return direct_(v);return this->m_rawTable->glBinormal3bvEXT(v);}
+inline void glUniform3fv(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3FVPROC)this->m_functions[1774];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3fv(location,count,value);}
+inline void glGetnPixelMapusvARB(GLenum map,GLsizei bufSize,GLushort* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPUSVARBPROC)this->m_functions[1775];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapusvARB(map,bufSize,values);}
+inline void glMemoryObjectParameterivEXT(GLuint memoryObject,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMEMORYOBJECTPARAMETERIVEXTPROC)this->m_functions[1776];if(direct_)return direct_(memoryObject,pname,params);return this->m_rawTable->glMemoryObjectParameterivEXT(memoryObject,pname,params);}
+inline void glGenSemaphoresEXT(GLsizei n,GLuint* semaphores)const{auto const direct_ = (FunctionTable::PFNGLGENSEMAPHORESEXTPROC)this->m_functions[1777];if(direct_)return direct_(n,semaphores);return this->m_rawTable->glGenSemaphoresEXT(n,semaphores);}
+inline void glMultiTexCoordP1ui(GLenum texture,GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP1UIPROC)this->m_functions[1778];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP1ui(texture,type,coords);}
+inline void glClearNamedBufferDataEXT(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDBUFFERDATAEXTPROC)this->m_functions[1779];if(direct_)return direct_(buffer,internalformat,format,type,data);return this->m_rawTable->glClearNamedBufferDataEXT(buffer,internalformat,format,type,data);}
+inline void glUniformMatrix4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4DVPROC)this->m_functions[1780];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4dv(location,count,transpose,value);}
+inline void glWindowPos3fMESA(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FMESAPROC)this->m_functions[1781];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3fMESA(x,y,z);}
+inline void glDeleteRenderbuffers(GLsizei n,const GLuint* renderbuffers)const{auto const direct_ = (FunctionTable::PFNGLDELETERENDERBUFFERSPROC)this->m_functions[1782];if(direct_)return direct_(n,renderbuffers);return this->m_rawTable->glDeleteRenderbuffers(n,renderbuffers);}
+inline void glGetTextureLevelParameterfvEXT(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)this->m_functions[1783];if(direct_)return direct_(texture,target,level,pname,params);return this->m_rawTable->glGetTextureLevelParameterfvEXT(texture,target,level,pname,params);}
+inline void glGetHistogramParameterxvOES(GLenum target,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPARAMETERXVOESPROC)this->m_functions[1784];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetHistogramParameterxvOES(target,pname,params);}
+inline void glMultiDrawElements(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSPROC)this->m_functions[1785];if(direct_)return direct_(mode,count,type,indices,drawcount);return this->m_rawTable->glMultiDrawElements(mode,count,type,indices,drawcount);}
+inline void glMakeImageHandleNonResidentNV(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)this->m_functions[1786];if(direct_)return direct_(handle);return this->m_rawTable->glMakeImageHandleNonResidentNV(handle);}
+inline void glTexSubImage1DEXT(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE1DEXTPROC)this->m_functions[1787];if(direct_)return direct_(target,level,xoffset,width,format,type,pixels);return this->m_rawTable->glTexSubImage1DEXT(target,level,xoffset,width,format,type,pixels);}
+inline void glNormalStream3dATI(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3DATIPROC)this->m_functions[1788];if(direct_)return direct_(stream,nx,ny,nz);return this->m_rawTable->glNormalStream3dATI(stream,nx,ny,nz);}
+inline void glVertexAttribL4i64vNV(GLuint index,const GLint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4I64VNVPROC)this->m_functions[1789];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL4i64vNV(index,v);}
+inline void glDrawBuffers(GLsizei n,const GLenum* bufs)const{auto const direct_ = (FunctionTable::PFNGLDRAWBUFFERSPROC)this->m_functions[1790];if(direct_)return direct_(n,bufs);return this->m_rawTable->glDrawBuffers(n,bufs);}
+inline void glCopyTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)this->m_functions[1791];if(direct_)return direct_(texture,target,level,xoffset,x,y,width);return this->m_rawTable->glCopyTextureSubImage1DEXT(texture,target,level,xoffset,x,y,width);}
+inline void glWindowRectanglesEXT(GLenum mode,GLsizei count,const GLint* box)const{auto const direct_ = (FunctionTable::PFNGLWINDOWRECTANGLESEXTPROC)this->m_functions[1792];if(direct_)return direct_(mode,count,box);return this->m_rawTable->glWindowRectanglesEXT(mode,count,box);}
+inline void glNamedFramebufferReadBuffer(GLuint framebuffer,GLenum src)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)this->m_functions[1793];if(direct_)return direct_(framebuffer,src);return this->m_rawTable->glNamedFramebufferReadBuffer(framebuffer,src);}
+inline void glUniform2i64vARB(GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2I64VARBPROC)this->m_functions[1794];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2i64vARB(location,count,value);}
+inline void glVertexAttribI1uivEXT(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1UIVEXTPROC)this->m_functions[1795];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI1uivEXT(index,v);}
+inline void glGetTexGenfv(GLenum coord,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXGENFVPROC)this->m_functions[1796];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glGetTexGenfv(coord,pname,params);}
+inline void glBeginQueryARB(GLenum target,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBEGINQUERYARBPROC)this->m_functions[1797];if(direct_)return direct_(target,id);return this->m_rawTable->glBeginQueryARB(target,id);}
+inline void glUniform1iARB(GLint location,GLint v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1IARBPROC)this->m_functions[1798];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1iARB(location,v0);}
+inline void glVertex4bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4BVOESPROC)this->m_functions[1799];if(direct_)return direct_(coords);return this->m_rawTable->glVertex4bvOES(coords);}
+inline void glInvalidateSubFramebuffer(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATESUBFRAMEBUFFERPROC)this->m_functions[1800];if(direct_)return direct_(target,numAttachments,attachments,x,y,width,height);return this->m_rawTable->glInvalidateSubFramebuffer(target,numAttachments,attachments,x,y,width,height);}
+inline void glUniform1fvARB(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1FVARBPROC)this->m_functions[1801];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1fvARB(location,count,value);}
+inline GLboolean glTestFenceNV(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLTESTFENCENVPROC)this->m_functions[1802];if(direct_)return direct_(fence);return this->m_rawTable->glTestFenceNV(fence);}
+inline void glBindTransformFeedback(GLenum target,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBINDTRANSFORMFEEDBACKPROC)this->m_functions[1803];if(direct_)return direct_(target,id);return this->m_rawTable->glBindTransformFeedback(target,id);}
+inline void glMultiTexCoord2iv(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2IVPROC)this->m_functions[1804];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2iv(target,v);}
+inline void glCopyMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)this->m_functions[1805];if(direct_)return direct_(texunit,target,level,xoffset,x,y,width);return this->m_rawTable->glCopyMultiTexSubImage1DEXT(texunit,target,level,xoffset,x,y,width);}
+inline void glVariantbvEXT(GLuint id,const GLbyte* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTBVEXTPROC)this->m_functions[1806];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantbvEXT(id,addr);}
+inline void glTexCoord1hNV(GLhalfNV s)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1HNVPROC)this->m_functions[1807];if(direct_)return direct_(s);return this->m_rawTable->glTexCoord1hNV(s);}
+inline void glGenFencesNV(GLsizei n,GLuint* fences)const{auto const direct_ = (FunctionTable::PFNGLGENFENCESNVPROC)this->m_functions[1808];if(direct_)return direct_(n,fences);return this->m_rawTable->glGenFencesNV(n,fences);}
+inline void glRasterPos3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3IVPROC)this->m_functions[1809];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos3iv(v);}
+inline void glVertexAttribL2ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2UI64NVPROC)this->m_functions[1810];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribL2ui64NV(index,x,y);}
+inline void glMultiTexCoord1hvNV(GLenum target,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1HVNVPROC)this->m_functions[1811];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1hvNV(target,v);}
+inline void glGetnConvolutionFilter(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{auto const direct_ = (FunctionTable::PFNGLGETNCONVOLUTIONFILTERPROC)this->m_functions[1812];if(direct_)return direct_(target,format,type,bufSize,image);return this->m_rawTable->glGetnConvolutionFilter(target,format,type,bufSize,image);}
+inline void glNormal3bv(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3BVPROC)this->m_functions[1813];if(direct_)return direct_(v);return this->m_rawTable->glNormal3bv(v);}
+inline void glWeightbvARB(GLint size,const GLbyte* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTBVARBPROC)this->m_functions[1814];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightbvARB(size,weights);}
+inline void glTexCoord4sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4SVPROC)this->m_functions[1815];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord4sv(v);}
+inline void glUniform2uiv(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UIVPROC)this->m_functions[1816];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2uiv(location,count,value);}
+inline void glBeginConditionalRenderNVX(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBEGINCONDITIONALRENDERNVXPROC)this->m_functions[1817];if(direct_)return direct_(id);return this->m_rawTable->glBeginConditionalRenderNVX(id);}
+inline void glFinish()const{auto const direct_ = (FunctionTable::PFNGLFINISHPROC)this->m_functions[1818];if(direct_)return direct_();return this->m_rawTable->glFinish();}
+inline void glColorTableParameterfv(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLEPARAMETERFVPROC)this->m_functions[1819];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glColorTableParameterfv(target,pname,params);}
+inline void glFragmentCoverageColorNV(GLuint color)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTCOVERAGECOLORNVPROC)this->m_functions[1820];if(direct_)return direct_(color);return this->m_rawTable->glFragmentCoverageColorNV(color);}
+inline void glProgramUniform3ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3IVEXTPROC)this->m_functions[1821];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3ivEXT(program,location,count,value);}
+inline void glVertexArrayVertexOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)this->m_functions[1822];if(direct_)return direct_(vaobj,buffer,size,type,stride,offset);return this->m_rawTable->glVertexArrayVertexOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+inline void glViewportPositionWScaleNV(GLuint index,GLfloat xcoeff,GLfloat ycoeff)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTPOSITIONWSCALENVPROC)this->m_functions[1823];if(direct_)return direct_(index,xcoeff,ycoeff);return this->m_rawTable->glViewportPositionWScaleNV(index,xcoeff,ycoeff);}
+inline void glGetProgramLocalParameterIuivNV(GLenum target,GLuint index,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)this->m_functions[1824];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramLocalParameterIuivNV(target,index,params);}
+inline void glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)this->m_functions[1825];if(direct_)return direct_(rc,tc,v);return this->m_rawTable->glReplacementCodeuiTexCoord2fVertex3fvSUN(rc,tc,v);}
+inline void glUniform1uiv(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UIVPROC)this->m_functions[1826];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1uiv(location,count,value);}
+inline void glUniformMatrix2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2DVPROC)this->m_functions[1827];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2dv(location,count,transpose,value);}
+inline void glIndexdv(const GLdouble* c)const{auto const direct_ = (FunctionTable::PFNGLINDEXDVPROC)this->m_functions[1828];if(direct_)return direct_(c);return this->m_rawTable->glIndexdv(c);}
+inline void glSecondaryColor3ivEXT(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3IVEXTPROC)this->m_functions[1829];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3ivEXT(v);}
+inline void glTexCoord3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3IVPROC)this->m_functions[1830];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord3iv(v);}
+inline void glVertexStream4fvATI(GLenum stream,const GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4FVATIPROC)this->m_functions[1831];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream4fvATI(stream,coords);}
+inline void glDeformationMap3fSGIX(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLDEFORMATIONMAP3FSGIXPROC)this->m_functions[1832];if(direct_)return direct_(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);return this->m_rawTable->glDeformationMap3fSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+inline void glClearDepth(GLclampd depth)const{auto const direct_ = (FunctionTable::PFNGLCLEARDEPTHPROC)this->m_functions[1833];if(direct_)return direct_(depth);return this->m_rawTable->glClearDepth(depth);}
+inline GLuint glGenAsyncMarkersSGIX(GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLGENASYNCMARKERSSGIXPROC)this->m_functions[1834];if(direct_)return direct_(range);return this->m_rawTable->glGenAsyncMarkersSGIX(range);}
+inline void glDisableIndexedEXT(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEINDEXEDEXTPROC)this->m_functions[1835];if(direct_)return direct_(target,index);return this->m_rawTable->glDisableIndexedEXT(target,index);}
+inline void glVertexWeightfvEXT(const GLfloat* weight)const{auto const direct_ = (FunctionTable::PFNGLVERTEXWEIGHTFVEXTPROC)this->m_functions[1836];if(direct_)return direct_(weight);return this->m_rawTable->glVertexWeightfvEXT(weight);}
+inline void glGetProgramLocalParameterIivNV(GLenum target,GLuint index,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)this->m_functions[1837];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramLocalParameterIivNV(target,index,params);}
+inline void glCompressedTexImage3DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE3DARBPROC)this->m_functions[1838];if(direct_)return direct_(target,level,internalformat,width,height,depth,border,imageSize,data);return this->m_rawTable->glCompressedTexImage3DARB(target,level,internalformat,width,height,depth,border,imageSize,data);}
+inline void glProgramParameter4fNV(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETER4FNVPROC)this->m_functions[1839];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramParameter4fNV(target,index,x,y,z,w);}
+inline void glConvolutionParameterxOES(GLenum target,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERXOESPROC)this->m_functions[1840];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glConvolutionParameterxOES(target,pname,param);}
+inline void glInsertComponentEXT(GLuint res,GLuint src,GLuint num)const{auto const direct_ = (FunctionTable::PFNGLINSERTCOMPONENTEXTPROC)this->m_functions[1841];if(direct_)return direct_(res,src,num);return this->m_rawTable->glInsertComponentEXT(res,src,num);}
+inline void glCreateTextures(GLenum target,GLsizei n,GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLCREATETEXTURESPROC)this->m_functions[1842];if(direct_)return direct_(target,n,textures);return this->m_rawTable->glCreateTextures(target,n,textures);}
+inline void glSecondaryColor3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3IVPROC)this->m_functions[1843];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3iv(v);}
+inline void glCreateBuffers(GLsizei n,GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLCREATEBUFFERSPROC)this->m_functions[1844];if(direct_)return direct_(n,buffers);return this->m_rawTable->glCreateBuffers(n,buffers);}
+inline void glMultiTexCoord2xvOES(GLenum texture,const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2XVOESPROC)this->m_functions[1845];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord2xvOES(texture,coords);}
+inline void glTexGenxvOES(GLenum coord,GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLTEXGENXVOESPROC)this->m_functions[1846];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glTexGenxvOES(coord,pname,params);}
+inline void glMultTransposeMatrixf(const GLfloat m[16])const{auto const direct_ = (FunctionTable::PFNGLMULTTRANSPOSEMATRIXFPROC)this->m_functions[1847];if(direct_)return direct_(m);return this->m_rawTable->glMultTransposeMatrixf(m);}
+inline void glBeginTransformFeedbackEXT(GLenum primitiveMode)const{auto const direct_ = (FunctionTable::PFNGLBEGINTRANSFORMFEEDBACKEXTPROC)this->m_functions[1848];if(direct_)return direct_(primitiveMode);return this->m_rawTable->glBeginTransformFeedbackEXT(primitiveMode);}
+inline void glTexCoord2fColor3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)this->m_functions[1849];if(direct_)return direct_(s,t,r,g,b,x,y,z);return this->m_rawTable->glTexCoord2fColor3fVertex3fSUN(s,t,r,g,b,x,y,z);}
+inline void glNormal3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3SVPROC)this->m_functions[1850];if(direct_)return direct_(v);return this->m_rawTable->glNormal3sv(v);}
+inline void glFreeObjectBufferATI(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLFREEOBJECTBUFFERATIPROC)this->m_functions[1851];if(direct_)return direct_(buffer);return this->m_rawTable->glFreeObjectBufferATI(buffer);}
+inline void glBlendBarrierNV()const{auto const direct_ = (FunctionTable::PFNGLBLENDBARRIERNVPROC)this->m_functions[1852];if(direct_)return direct_();return this->m_rawTable->glBlendBarrierNV();}
+inline void glUniform4i64vNV(GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4I64VNVPROC)this->m_functions[1853];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4i64vNV(location,count,value);}
+inline void glGetnUniformuivARB(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMUIVARBPROC)this->m_functions[1854];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformuivARB(program,location,bufSize,params);}
+inline void glAlphaFragmentOp3ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{auto const direct_ = (FunctionTable::PFNGLALPHAFRAGMENTOP3ATIPROC)this->m_functions[1855];if(direct_)return direct_(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);return this->m_rawTable->glAlphaFragmentOp3ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+inline void glProgramEnvParameters4fvEXT(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERS4FVEXTPROC)this->m_functions[1856];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramEnvParameters4fvEXT(target,index,count,params);}
+inline void glBlendFuncSeparateEXT(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEEXTPROC)this->m_functions[1857];if(direct_)return direct_(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);return this->m_rawTable->glBlendFuncSeparateEXT(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+inline void glConvolutionParameterivEXT(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERIVEXTPROC)this->m_functions[1858];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterivEXT(target,pname,params);}
+inline void glPixelTexGenSGIX(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLPIXELTEXGENSGIXPROC)this->m_functions[1859];if(direct_)return direct_(mode);return this->m_rawTable->glPixelTexGenSGIX(mode);}
+inline void glDeleteProgram(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLDELETEPROGRAMPROC)this->m_functions[1860];if(direct_)return direct_(program);return this->m_rawTable->glDeleteProgram(program);}
+inline void glUniformMatrix4x3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4X3DVPROC)this->m_functions[1861];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4x3dv(location,count,transpose,value);}
+inline void glGetVideoCaptureStreamivNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOCAPTURESTREAMIVNVPROC)this->m_functions[1862];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glGetVideoCaptureStreamivNV(video_capture_slot,stream,pname,params);}
+inline void glProgramUniform4uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UIEXTPROC)this->m_functions[1863];if(direct_)return direct_(program,location,v0,v1,v2,v3);return this->m_rawTable->glProgramUniform4uiEXT(program,location,v0,v1,v2,v3);}
+inline void glMakeImageHandleNonResidentARB(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)this->m_functions[1864];if(direct_)return direct_(handle);return this->m_rawTable->glMakeImageHandleNonResidentARB(handle);}
+inline void glSecondaryColor3dEXT(GLdouble red,GLdouble green,GLdouble blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3DEXTPROC)this->m_functions[1865];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3dEXT(red,green,blue);}
+inline void glDeleteQueries(GLsizei n,const GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLDELETEQUERIESPROC)this->m_functions[1866];if(direct_)return direct_(n,ids);return this->m_rawTable->glDeleteQueries(n,ids);}
+inline void glNormalP3uiv(GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALP3UIVPROC)this->m_functions[1867];if(direct_)return direct_(type,coords);return this->m_rawTable->glNormalP3uiv(type,coords);}
+inline void glRasterPos2d(GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2DPROC)this->m_functions[1868];if(direct_)return direct_(x,y);return this->m_rawTable->glRasterPos2d(x,y);}
+inline void glInitNames()const{auto const direct_ = (FunctionTable::PFNGLINITNAMESPROC)this->m_functions[1869];if(direct_)return direct_();return this->m_rawTable->glInitNames();}
+inline void glBinormal3fvEXT(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3FVEXTPROC)this->m_functions[1870];if(direct_)return direct_(v);return this->m_rawTable->glBinormal3fvEXT(v);}
+inline void glColor3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3DVPROC)this->m_functions[1871];if(direct_)return direct_(v);return this->m_rawTable->glColor3dv(v);}
+inline void glVertexArrayVertexAttribDivisorEXT(GLuint vaobj,GLuint index,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)this->m_functions[1872];if(direct_)return direct_(vaobj,index,divisor);return this->m_rawTable->glVertexArrayVertexAttribDivisorEXT(vaobj,index,divisor);}
+inline void glArrayElementEXT(GLint i)const{auto const direct_ = (FunctionTable::PFNGLARRAYELEMENTEXTPROC)this->m_functions[1873];if(direct_)return direct_(i);return this->m_rawTable->glArrayElementEXT(i);}
+inline void glProgramParameter4dNV(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETER4DNVPROC)this->m_functions[1874];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramParameter4dNV(target,index,x,y,z,w);}
+inline void glIndexxOES(GLfixed component)const{auto const direct_ = (FunctionTable::PFNGLINDEXXOESPROC)this->m_functions[1875];if(direct_)return direct_(component);return this->m_rawTable->glIndexxOES(component);}
+inline void glUniform3uivEXT(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UIVEXTPROC)this->m_functions[1876];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3uivEXT(location,count,value);}
+inline void glPopGroupMarkerEXT()const{auto const direct_ = (FunctionTable::PFNGLPOPGROUPMARKEREXTPROC)this->m_functions[1877];if(direct_)return direct_();return this->m_rawTable->glPopGroupMarkerEXT();}
+inline void glClearNamedFramebufferuiv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)this->m_functions[1878];if(direct_)return direct_(framebuffer,buffer,drawbuffer,value);return this->m_rawTable->glClearNamedFramebufferuiv(framebuffer,buffer,drawbuffer,value);}
+inline void glSetLocalConstantEXT(GLuint id,GLenum type,const void* addr)const{auto const direct_ = (FunctionTable::PFNGLSETLOCALCONSTANTEXTPROC)this->m_functions[1879];if(direct_)return direct_(id,type,addr);return this->m_rawTable->glSetLocalConstantEXT(id,type,addr);}
+inline void glProgramUniform1ui64NV(GLuint program,GLint location,GLuint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1UI64NVPROC)this->m_functions[1880];if(direct_)return direct_(program,location,x);return this->m_rawTable->glProgramUniform1ui64NV(program,location,x);}
+inline void glColor4hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4HVNVPROC)this->m_functions[1881];if(direct_)return direct_(v);return this->m_rawTable->glColor4hvNV(v);}
+inline void glGetVertexAttribfv(GLuint index,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBFVPROC)this->m_functions[1882];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribfv(index,pname,params);}
+inline void glDispatchCompute(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z)const{auto const direct_ = (FunctionTable::PFNGLDISPATCHCOMPUTEPROC)this->m_functions[1883];if(direct_)return direct_(num_groups_x,num_groups_y,num_groups_z);return this->m_rawTable->glDispatchCompute(num_groups_x,num_groups_y,num_groups_z);}
+inline void glGetActiveAttrib(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEATTRIBPROC)this->m_functions[1884];if(direct_)return direct_(program,index,bufSize,length,size,type,name);return this->m_rawTable->glGetActiveAttrib(program,index,bufSize,length,size,type,name);}
+inline void glFragmentColorMaterialSGIX(GLenum face,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTCOLORMATERIALSGIXPROC)this->m_functions[1885];if(direct_)return direct_(face,mode);return this->m_rawTable->glFragmentColorMaterialSGIX(face,mode);}
+inline void glTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE2DPROC)this->m_functions[1886];if(direct_)return direct_(target,level,xoffset,yoffset,width,height,format,type,pixels);return this->m_rawTable->glTexSubImage2D(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+inline void glGetnMinmaxARB(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETNMINMAXARBPROC)this->m_functions[1887];if(direct_)return direct_(target,reset,format,type,bufSize,values);return this->m_rawTable->glGetnMinmaxARB(target,reset,format,type,bufSize,values);}
+inline void glLogicOp(GLenum opcode)const{auto const direct_ = (FunctionTable::PFNGLLOGICOPPROC)this->m_functions[1888];if(direct_)return direct_(opcode);return this->m_rawTable->glLogicOp(opcode);}
+inline void glProgramUniformMatrix3x4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)this->m_functions[1889];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x4fv(program,location,count,transpose,value);}
+inline void glWindowPos4iMESA(GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4IMESAPROC)this->m_functions[1890];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glWindowPos4iMESA(x,y,z,w);}
+inline void glPixelTransferf(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFERFPROC)this->m_functions[1891];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelTransferf(pname,param);}
+inline void glGetTextureParameterIuiv(GLuint texture,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIUIVPROC)this->m_functions[1892];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glGetTextureParameterIuiv(texture,pname,params);}
+inline void glMultiTexCoord1xOES(GLenum texture,GLfixed s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1XOESPROC)this->m_functions[1893];if(direct_)return direct_(texture,s);return this->m_rawTable->glMultiTexCoord1xOES(texture,s);}
+inline void glProgramUniformMatrix4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4DVPROC)this->m_functions[1894];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4dv(program,location,count,transpose,value);}
+inline void glGetnUniformiv(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMIVPROC)this->m_functions[1895];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformiv(program,location,bufSize,params);}
+inline void glFramebufferTexture1DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE1DEXTPROC)this->m_functions[1896];if(direct_)return direct_(target,attachment,textarget,texture,level);return this->m_rawTable->glFramebufferTexture1DEXT(target,attachment,textarget,texture,level);}
+inline void glVertexPointervINTEL(GLint size,GLenum type,const void** pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXPOINTERVINTELPROC)this->m_functions[1897];if(direct_)return direct_(size,type,pointer);return this->m_rawTable->glVertexPointervINTEL(size,type,pointer);}
+inline void glTextureParameterIiv(GLuint texture,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIIVPROC)this->m_functions[1898];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glTextureParameterIiv(texture,pname,params);}
+inline void glGetSeparableFilterEXT(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span)const{auto const direct_ = (FunctionTable::PFNGLGETSEPARABLEFILTEREXTPROC)this->m_functions[1899];if(direct_)return direct_(target,format,type,row,column,span);return this->m_rawTable->glGetSeparableFilterEXT(target,format,type,row,column,span);}
+inline void glMultiTexCoord3iARB(GLenum target,GLint s,GLint t,GLint r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3IARBPROC)this->m_functions[1900];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3iARB(target,s,t,r);}
+inline void glRasterPos4xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4XVOESPROC)this->m_functions[1901];if(direct_)return direct_(coords);return this->m_rawTable->glRasterPos4xvOES(coords);}
+inline void glDrawTransformFeedbackStream(GLenum mode,GLuint id,GLuint stream)const{auto const direct_ = (FunctionTable::PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)this->m_functions[1902];if(direct_)return direct_(mode,id,stream);return this->m_rawTable->glDrawTransformFeedbackStream(mode,id,stream);}
+inline void glVertex3hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3HVNVPROC)this->m_functions[1903];if(direct_)return direct_(v);return this->m_rawTable->glVertex3hvNV(v);}
+inline void glVertexArrayMultiTexCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)this->m_functions[1904];if(direct_)return direct_(vaobj,buffer,texunit,size,type,stride,offset);return this->m_rawTable->glVertexArrayMultiTexCoordOffsetEXT(vaobj,buffer,texunit,size,type,stride,offset);}
+inline void glProvokingVertex(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLPROVOKINGVERTEXPROC)this->m_functions[1905];if(direct_)return direct_(mode);return this->m_rawTable->glProvokingVertex(mode);}
+inline void glAccumxOES(GLenum op,GLfixed value)const{auto const direct_ = (FunctionTable::PFNGLACCUMXOESPROC)this->m_functions[1906];if(direct_)return direct_(op,value);return this->m_rawTable->glAccumxOES(op,value);}
+inline void glShaderBinary(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length)const{auto const direct_ = (FunctionTable::PFNGLSHADERBINARYPROC)this->m_functions[1907];if(direct_)return direct_(count,shaders,binaryformat,binary,length);return this->m_rawTable->glShaderBinary(count,shaders,binaryformat,binary,length);}
+inline void glGetMultiTexGenivEXT(GLenum texunit,GLenum coord,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXGENIVEXTPROC)this->m_functions[1908];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glGetMultiTexGenivEXT(texunit,coord,pname,params);}
+inline void glPointParameterxvOES(GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERXVOESPROC)this->m_functions[1909];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterxvOES(pname,params);}
+inline void glCreateStatesNV(GLsizei n,GLuint* states)const{auto const direct_ = (FunctionTable::PFNGLCREATESTATESNVPROC)this->m_functions[1910];if(direct_)return direct_(n,states);return this->m_rawTable->glCreateStatesNV(n,states);}
+inline void glClearDepthdNV(GLdouble depth)const{auto const direct_ = (FunctionTable::PFNGLCLEARDEPTHDNVPROC)this->m_functions[1911];if(direct_)return direct_(depth);return this->m_rawTable->glClearDepthdNV(depth);}
+inline void glClearColorIuiEXT(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARCOLORIUIEXTPROC)this->m_functions[1912];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearColorIuiEXT(red,green,blue,alpha);}
+inline void glBindMultiTextureEXT(GLenum texunit,GLenum target,GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLBINDMULTITEXTUREEXTPROC)this->m_functions[1913];if(direct_)return direct_(texunit,target,texture);return this->m_rawTable->glBindMultiTextureEXT(texunit,target,texture);}
+inline void glTexGeniv(GLenum coord,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXGENIVPROC)this->m_functions[1914];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glTexGeniv(coord,pname,params);}
+inline void glDrawElements(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSPROC)this->m_functions[1915];if(direct_)return direct_(mode,count,type,indices);return this->m_rawTable->glDrawElements(mode,count,type,indices);}
+inline void glProgramUniform4iv(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4IVPROC)this->m_functions[1916];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4iv(program,location,count,value);}
+inline void glDisableVertexArrayEXT(GLuint vaobj,GLenum array)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXARRAYEXTPROC)this->m_functions[1917];if(direct_)return direct_(vaobj,array);return this->m_rawTable->glDisableVertexArrayEXT(vaobj,array);}
+inline void glProgramUniform3ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UI64NVPROC)this->m_functions[1918];if(direct_)return direct_(program,location,x,y,z);return this->m_rawTable->glProgramUniform3ui64NV(program,location,x,y,z);}
+inline void glClientActiveTexture(GLenum texture)const{auto const direct_ = (FunctionTable::PFNGLCLIENTACTIVETEXTUREPROC)this->m_functions[1919];if(direct_)return direct_(texture);return this->m_rawTable->glClientActiveTexture(texture);}
+inline void glMultiTexParameterIivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERIIVEXTPROC)this->m_functions[1920];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexParameterIivEXT(texunit,target,pname,params);}
+inline void glUniform1i64ARB(GLint location,GLint64 x)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1I64ARBPROC)this->m_functions[1921];if(direct_)return direct_(location,x);return this->m_rawTable->glUniform1i64ARB(location,x);}
+inline void glUniform1iv(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1IVPROC)this->m_functions[1922];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1iv(location,count,value);}
+inline void glMulticastBarrierNV()const{auto const direct_ = (FunctionTable::PFNGLMULTICASTBARRIERNVPROC)this->m_functions[1923];if(direct_)return direct_();return this->m_rawTable->glMulticastBarrierNV();}
+inline void glVertexAttribArrayObjectATI(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBARRAYOBJECTATIPROC)this->m_functions[1924];if(direct_)return direct_(index,size,type,normalized,stride,buffer,offset);return this->m_rawTable->glVertexAttribArrayObjectATI(index,size,type,normalized,stride,buffer,offset);}
+inline void glUniform2iARB(GLint location,GLint v0,GLint v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2IARBPROC)this->m_functions[1925];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2iARB(location,v0,v1);}
+inline void glDrawArraysInstanced(GLenum mode,GLint first,GLsizei count,GLsizei instancecount)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSINSTANCEDPROC)this->m_functions[1926];if(direct_)return direct_(mode,first,count,instancecount);return this->m_rawTable->glDrawArraysInstanced(mode,first,count,instancecount);}
+inline void glVertexAttrib2sNV(GLuint index,GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SNVPROC)this->m_functions[1927];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2sNV(index,x,y);}
+inline void glTexBufferEXT(GLenum target,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTEXBUFFEREXTPROC)this->m_functions[1928];if(direct_)return direct_(target,internalformat,buffer);return this->m_rawTable->glTexBufferEXT(target,internalformat,buffer);}
+inline void glVertexStream2fATI(GLenum stream,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2FATIPROC)this->m_functions[1929];if(direct_)return direct_(stream,x,y);return this->m_rawTable->glVertexStream2fATI(stream,x,y);}
+inline void glDebugMessageCallbackAMD(GLDEBUGPROCAMD callback,void* userParam)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGECALLBACKAMDPROC)this->m_functions[1930];if(direct_)return direct_(callback,userParam);return this->m_rawTable->glDebugMessageCallbackAMD(callback,userParam);}
+inline void glSamplerParameteriv(GLuint sampler,GLenum pname,const GLint* param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERIVPROC)this->m_functions[1931];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameteriv(sampler,pname,param);}
+inline void glVertexAttrib4uiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UIVPROC)this->m_functions[1932];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4uiv(index,v);}
+inline void glEndQueryIndexed(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENDQUERYINDEXEDPROC)this->m_functions[1933];if(direct_)return direct_(target,index);return this->m_rawTable->glEndQueryIndexed(target,index);}
+inline void glNormalStream3sATI(GLenum stream,GLshort nx,GLshort ny,GLshort nz)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3SATIPROC)this->m_functions[1934];if(direct_)return direct_(stream,nx,ny,nz);return this->m_rawTable->glNormalStream3sATI(stream,nx,ny,nz);}
+inline void glProgramParameteriARB(GLuint program,GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETERIARBPROC)this->m_functions[1935];if(direct_)return direct_(program,pname,value);return this->m_rawTable->glProgramParameteriARB(program,pname,value);}
+inline void glTexEnvxOES(GLenum target,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLTEXENVXOESPROC)this->m_functions[1936];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexEnvxOES(target,pname,param);}
+inline void glProgramUniform1iv(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1IVPROC)this->m_functions[1937];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1iv(program,location,count,value);}
+inline void glDisableVertexAttribAPPLE(GLuint index,GLenum pname)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXATTRIBAPPLEPROC)this->m_functions[1938];if(direct_)return direct_(index,pname);return this->m_rawTable->glDisableVertexAttribAPPLE(index,pname);}
+inline void glBindRenderbuffer(GLenum target,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLBINDRENDERBUFFERPROC)this->m_functions[1939];if(direct_)return direct_(target,renderbuffer);return this->m_rawTable->glBindRenderbuffer(target,renderbuffer);}
+inline void glMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXSUBIMAGE3DEXTPROC)this->m_functions[1940];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);return this->m_rawTable->glMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+inline GLboolean glIsProgram(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLISPROGRAMPROC)this->m_functions[1941];if(direct_)return direct_(program);return this->m_rawTable->glIsProgram(program);}
+inline void glMultiDrawElementsIndirectAMD(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)this->m_functions[1942];if(direct_)return direct_(mode,type,indirect,primcount,stride);return this->m_rawTable->glMultiDrawElementsIndirectAMD(mode,type,indirect,primcount,stride);}
+inline void glGetProgramInfoLog(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMINFOLOGPROC)this->m_functions[1943];if(direct_)return direct_(program,bufSize,length,infoLog);return this->m_rawTable->glGetProgramInfoLog(program,bufSize,length,infoLog);}
+inline void glGetLocalConstantBooleanvEXT(GLuint id,GLenum value,GLboolean* data)const{auto const direct_ = (FunctionTable::PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)this->m_functions[1944];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetLocalConstantBooleanvEXT(id,value,data);}
+inline void glPixelTransformParameteriEXT(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFORMPARAMETERIEXTPROC)this->m_functions[1945];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glPixelTransformParameteriEXT(target,pname,param);}
+inline void glTexCoord4bOES(GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4BOESPROC)this->m_functions[1946];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4bOES(s,t,r,q);}
+inline void glVertexAttrib4fv(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FVPROC)this->m_functions[1947];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4fv(index,v);}
+inline void glProgramUniformMatrix2x3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)this->m_functions[1948];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x3dv(program,location,count,transpose,value);}
+inline void glProgramEnvParametersI4uivNV(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)this->m_functions[1949];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramEnvParametersI4uivNV(target,index,count,params);}
+inline void glTexCoord3xOES(GLfixed s,GLfixed t,GLfixed r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3XOESPROC)this->m_functions[1950];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3xOES(s,t,r);}
+inline void glLoadTransposeMatrixfARB(const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLLOADTRANSPOSEMATRIXFARBPROC)this->m_functions[1951];if(direct_)return direct_(m);return this->m_rawTable->glLoadTransposeMatrixfARB(m);}
+inline void glImageTransformParameteriHP(GLenum target,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLIMAGETRANSFORMPARAMETERIHPPROC)this->m_functions[1952];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glImageTransformParameteriHP(target,pname,param);}
+inline void glMultiTexCoord4xOES(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4XOESPROC)this->m_functions[1953];if(direct_)return direct_(texture,s,t,r,q);return this->m_rawTable->glMultiTexCoord4xOES(texture,s,t,r,q);}
+inline void glVertexAttribs3fvNV(GLuint index,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS3FVNVPROC)this->m_functions[1954];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs3fvNV(index,count,v);}
+inline void glVertexAttrib2fv(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FVPROC)this->m_functions[1955];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2fv(index,v);}
+inline void glUniform3ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UI64NVPROC)this->m_functions[1956];if(direct_)return direct_(location,x,y,z);return this->m_rawTable->glUniform3ui64NV(location,x,y,z);}
+inline void glCombinerParameterfvNV(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERPARAMETERFVNVPROC)this->m_functions[1957];if(direct_)return direct_(pname,params);return this->m_rawTable->glCombinerParameterfvNV(pname,params);}
+inline void glFragmentMaterialiSGIX(GLenum face,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTMATERIALISGIXPROC)this->m_functions[1958];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glFragmentMaterialiSGIX(face,pname,param);}
+inline void glGetBooleani_v(GLenum target,GLuint index,GLboolean* data)const{auto const direct_ = (FunctionTable::PFNGLGETBOOLEANI_VPROC)this->m_functions[1959];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetBooleani_v(target,index,data);}
+inline GLuint glGetProgramResourceIndex(GLuint program,GLenum programInterface,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCEINDEXPROC)this->m_functions[1960];if(direct_)return direct_(program,programInterface,name);return this->m_rawTable->glGetProgramResourceIndex(program,programInterface,name);}
+inline void glBeginConditionalRenderNV(GLuint id,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBEGINCONDITIONALRENDERNVPROC)this->m_functions[1961];if(direct_)return direct_(id,mode);return this->m_rawTable->glBeginConditionalRenderNV(id,mode);}
+inline void glDisableClientState(GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLDISABLECLIENTSTATEPROC)this->m_functions[1962];if(direct_)return direct_(cap);return this->m_rawTable->glDisableClientState(cap);}
+inline void glPathFogGenNV(GLenum genMode)const{auto const direct_ = (FunctionTable::PFNGLPATHFOGGENNVPROC)this->m_functions[1963];if(direct_)return direct_(genMode);return this->m_rawTable->glPathFogGenNV(genMode);}
+inline void glStencilThenCoverFillPathNV(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode)const{auto const direct_ = (FunctionTable::PFNGLSTENCILTHENCOVERFILLPATHNVPROC)this->m_functions[1964];if(direct_)return direct_(path,fillMode,mask,coverMode);return this->m_rawTable->glStencilThenCoverFillPathNV(path,fillMode,mask,coverMode);}
+inline void glVertexArrayIndexOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYINDEXOFFSETEXTPROC)this->m_functions[1965];if(direct_)return direct_(vaobj,buffer,type,stride,offset);return this->m_rawTable->glVertexArrayIndexOffsetEXT(vaobj,buffer,type,stride,offset);}
+inline void glProgramBufferParametersIuivNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)this->m_functions[1966];if(direct_)return direct_(target,bindingIndex,wordIndex,count,params);return this->m_rawTable->glProgramBufferParametersIuivNV(target,bindingIndex,wordIndex,count,params);}
+inline void glPixelTransformParameterivEXT(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)this->m_functions[1967];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glPixelTransformParameterivEXT(target,pname,params);}
+inline void glDisableClientStateiEXT(GLenum array,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLECLIENTSTATEIEXTPROC)this->m_functions[1968];if(direct_)return direct_(array,index);return this->m_rawTable->glDisableClientStateiEXT(array,index);}
+inline void glTexBufferARB(GLenum target,GLenum internalformat,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLTEXBUFFERARBPROC)this->m_functions[1969];if(direct_)return direct_(target,internalformat,buffer);return this->m_rawTable->glTexBufferARB(target,internalformat,buffer);}
+inline void glGetLocalConstantIntegervEXT(GLuint id,GLenum value,GLint* data)const{auto const direct_ = (FunctionTable::PFNGLGETLOCALCONSTANTINTEGERVEXTPROC)this->m_functions[1970];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetLocalConstantIntegervEXT(id,value,data);}
+inline void glColor4uiv(const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UIVPROC)this->m_functions[1971];if(direct_)return direct_(v);return this->m_rawTable->glColor4uiv(v);}
+inline void glProgramUniform3i(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3IPROC)this->m_functions[1972];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3i(program,location,v0,v1,v2);}
+inline void glMultiDrawElementsIndirectBindlessCountNV(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)this->m_functions[1973];if(direct_)return direct_(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);return this->m_rawTable->glMultiDrawElementsIndirectBindlessCountNV(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+inline void glGetBufferPointervARB(GLenum target,GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPOINTERVARBPROC)this->m_functions[1974];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferPointervARB(target,pname,params);}
+inline void glMultiTexParameterIuivEXT(GLenum texunit,GLenum target,GLenum pname,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERIUIVEXTPROC)this->m_functions[1975];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexParameterIuivEXT(texunit,target,pname,params);}
+inline void glEvalMesh2(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2)const{auto const direct_ = (FunctionTable::PFNGLEVALMESH2PROC)this->m_functions[1976];if(direct_)return direct_(mode,i1,i2,j1,j2);return this->m_rawTable->glEvalMesh2(mode,i1,i2,j1,j2);}
+inline void glEvalMesh1(GLenum mode,GLint i1,GLint i2)const{auto const direct_ = (FunctionTable::PFNGLEVALMESH1PROC)this->m_functions[1977];if(direct_)return direct_(mode,i1,i2);return this->m_rawTable->glEvalMesh1(mode,i1,i2);}
+inline void glProgramUniform3f(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3FPROC)this->m_functions[1978];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3f(program,location,v0,v1,v2);}
+inline void glStencilThenCoverFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)this->m_functions[1979];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);return this->m_rawTable->glStencilThenCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);}
+inline void glProgramUniform3d(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3DPROC)this->m_functions[1980];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3d(program,location,v0,v1,v2);}
+inline void glMapVertexAttrib1dAPPLE(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{auto const direct_ = (FunctionTable::PFNGLMAPVERTEXATTRIB1DAPPLEPROC)this->m_functions[1981];if(direct_)return direct_(index,size,u1,u2,stride,order,points);return this->m_rawTable->glMapVertexAttrib1dAPPLE(index,size,u1,u2,stride,order,points);}
+inline void glEvalCoord2fv(const GLfloat* u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2FVPROC)this->m_functions[1982];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord2fv(u);}
+inline void glGetUniformivARB(GLhandleARB programObj,GLint location,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMIVARBPROC)this->m_functions[1983];if(direct_)return direct_(programObj,location,params);return this->m_rawTable->glGetUniformivARB(programObj,location,params);}
+inline void glLoadTransposeMatrixd(const GLdouble m[16])const{auto const direct_ = (FunctionTable::PFNGLLOADTRANSPOSEMATRIXDPROC)this->m_functions[1984];if(direct_)return direct_(m);return this->m_rawTable->glLoadTransposeMatrixd(m);}
+inline void glLoadTransposeMatrixf(const GLfloat m[16])const{auto const direct_ = (FunctionTable::PFNGLLOADTRANSPOSEMATRIXFPROC)this->m_functions[1985];if(direct_)return direct_(m);return this->m_rawTable->glLoadTransposeMatrixf(m);}
+inline void glGetPointervEXT(GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETPOINTERVEXTPROC)this->m_functions[1986];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetPointervEXT(pname,params);}
+inline void glSignalVkSemaphoreNV(GLuint64 vkSemaphore)const{auto const direct_ = (FunctionTable::PFNGLSIGNALVKSEMAPHORENVPROC)this->m_functions[1987];if(direct_)return direct_(vkSemaphore);return this->m_rawTable->glSignalVkSemaphoreNV(vkSemaphore);}
+inline void glEndConditionalRenderNV()const{auto const direct_ = (FunctionTable::PFNGLENDCONDITIONALRENDERNVPROC)this->m_functions[1988];if(direct_)return direct_();return this->m_rawTable->glEndConditionalRenderNV();}
+inline void glTexCoord2fNormal3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)this->m_functions[1989];if(direct_)return direct_(s,t,nx,ny,nz,x,y,z);return this->m_rawTable->glTexCoord2fNormal3fVertex3fSUN(s,t,nx,ny,nz,x,y,z);}
+inline void glUniform3i64vARB(GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3I64VARBPROC)this->m_functions[1990];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3i64vARB(location,count,value);}
+inline void glProgramUniform2uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UIEXTPROC)this->m_functions[1991];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2uiEXT(program,location,v0,v1);}
+inline void glVertexAttribI1ui(GLuint index,GLuint x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1UIPROC)this->m_functions[1992];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribI1ui(index,x);}
+inline void glProgramNamedParameter4dvNV(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)this->m_functions[1993];if(direct_)return direct_(id,len,name,v);return this->m_rawTable->glProgramNamedParameter4dvNV(id,len,name,v);}
+inline void glCompileCommandListNV(GLuint list)const{auto const direct_ = (FunctionTable::PFNGLCOMPILECOMMANDLISTNVPROC)this->m_functions[1994];if(direct_)return direct_(list);return this->m_rawTable->glCompileCommandListNV(list);}
+inline void glGetRenderbufferParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)this->m_functions[1995];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetRenderbufferParameterivEXT(target,pname,params);}
+inline void glGetnPolygonStipple(GLsizei bufSize,GLubyte* pattern)const{auto const direct_ = (FunctionTable::PFNGLGETNPOLYGONSTIPPLEPROC)this->m_functions[1996];if(direct_)return direct_(bufSize,pattern);return this->m_rawTable->glGetnPolygonStipple(bufSize,pattern);}
+inline GLboolean glIsBufferResidentNV(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLISBUFFERRESIDENTNVPROC)this->m_functions[1997];if(direct_)return direct_(target);return this->m_rawTable->glIsBufferResidentNV(target);}
+inline void glSecondaryColor3ubvEXT(const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UBVEXTPROC)this->m_functions[1998];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3ubvEXT(v);}
+inline void glGetNamedRenderbufferParameterivEXT(GLuint renderbuffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)this->m_functions[1999];if(direct_)return direct_(renderbuffer,pname,params);return this->m_rawTable->glGetNamedRenderbufferParameterivEXT(renderbuffer,pname,params);}
+inline void glNamedFramebufferSampleLocationsfvARB(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)this->m_functions[2000];if(direct_)return direct_(framebuffer,start,count,v);return this->m_rawTable->glNamedFramebufferSampleLocationsfvARB(framebuffer,start,count,v);}
+inline void glMultiTexGendvEXT(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENDVEXTPROC)this->m_functions[2001];if(direct_)return direct_(texunit,coord,pname,params);return this->m_rawTable->glMultiTexGendvEXT(texunit,coord,pname,params);}
+inline void glVertexArrayRangeNV(GLsizei length,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYRANGENVPROC)this->m_functions[2002];if(direct_)return direct_(length,pointer);return this->m_rawTable->glVertexArrayRangeNV(length,pointer);}
+inline GLboolean glIsTextureHandleResidentNV(GLuint64 handle)const{auto const direct_ = (FunctionTable::PFNGLISTEXTUREHANDLERESIDENTNVPROC)this->m_functions[2003];if(direct_)return direct_(handle);return this->m_rawTable->glIsTextureHandleResidentNV(handle);}
+inline void glGetProgramEnvParameterdvARB(GLenum target,GLuint index,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMENVPARAMETERDVARBPROC)this->m_functions[2004];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramEnvParameterdvARB(target,index,params);}
+inline GLboolean glIsNamedStringARB(GLint namelen,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLISNAMEDSTRINGARBPROC)this->m_functions[2005];if(direct_)return direct_(namelen,name);return this->m_rawTable->glIsNamedStringARB(namelen,name);}
+inline void glSecondaryColorFormatNV(GLint size,GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORFORMATNVPROC)this->m_functions[2006];if(direct_)return direct_(size,type,stride);return this->m_rawTable->glSecondaryColorFormatNV(size,type,stride);}
+inline void glVertexAttrib4ubvNV(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4UBVNVPROC)this->m_functions[2007];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4ubvNV(index,v);}
+inline void glTagSampleBufferSGIX()const{auto const direct_ = (FunctionTable::PFNGLTAGSAMPLEBUFFERSGIXPROC)this->m_functions[2008];if(direct_)return direct_();return this->m_rawTable->glTagSampleBufferSGIX();}
+inline void glVDPAUUnregisterSurfaceNV(GLvdpauSurfaceNV surface)const{auto const direct_ = (FunctionTable::PFNGLVDPAUUNREGISTERSURFACENVPROC)this->m_functions[2009];if(direct_)return direct_(surface);return this->m_rawTable->glVDPAUUnregisterSurfaceNV(surface);}
+inline void glGetPerfQueryIdByNameINTEL(GLchar* queryName,GLuint* queryId)const{auto const direct_ = (FunctionTable::PFNGLGETPERFQUERYIDBYNAMEINTELPROC)this->m_functions[2010];if(direct_)return direct_(queryName,queryId);return this->m_rawTable->glGetPerfQueryIdByNameINTEL(queryName,queryId);}
+inline void glGetInteger64v(GLenum pname,GLint64* data)const{auto const direct_ = (FunctionTable::PFNGLGETINTEGER64VPROC)this->m_functions[2011];if(direct_)return direct_(pname,data);return this->m_rawTable->glGetInteger64v(pname,data);}
+inline void glClipPlane(GLenum plane,const GLdouble* equation)const{auto const direct_ = (FunctionTable::PFNGLCLIPPLANEPROC)this->m_functions[2012];if(direct_)return direct_(plane,equation);return this->m_rawTable->glClipPlane(plane,equation);}
+inline void glColor4ubVertex3fSUN(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4UBVERTEX3FSUNPROC)this->m_functions[2013];if(direct_)return direct_(r,g,b,a,x,y,z);return this->m_rawTable->glColor4ubVertex3fSUN(r,g,b,a,x,y,z);}
+inline void glIndexub(GLubyte c)const{auto const direct_ = (FunctionTable::PFNGLINDEXUBPROC)this->m_functions[2014];if(direct_)return direct_(c);return this->m_rawTable->glIndexub(c);}
+inline void glGetProgramEnvParameterfvARB(GLenum target,GLuint index,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMENVPARAMETERFVARBPROC)this->m_functions[2015];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramEnvParameterfvARB(target,index,params);}
+inline void glVertexAttrib4usvARB(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4USVARBPROC)this->m_functions[2016];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4usvARB(index,v);}
+inline void glNamedFramebufferRenderbuffer(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)this->m_functions[2017];if(direct_)return direct_(framebuffer,attachment,renderbuffertarget,renderbuffer);return this->m_rawTable->glNamedFramebufferRenderbuffer(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+inline void glProgramUniformMatrix3x4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)this->m_functions[2018];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x4dv(program,location,count,transpose,value);}
+inline GLboolean glTestFenceAPPLE(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLTESTFENCEAPPLEPROC)this->m_functions[2019];if(direct_)return direct_(fence);return this->m_rawTable->glTestFenceAPPLE(fence);}
+inline void glVertexAttrib4Niv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NIVPROC)this->m_functions[2020];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Niv(index,v);}
+inline void glVertexAttribL2i64vNV(GLuint index,const GLint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL2I64VNVPROC)this->m_functions[2021];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL2i64vNV(index,v);}
+inline void glColorP4uiv(GLenum type,const GLuint* color)const{auto const direct_ = (FunctionTable::PFNGLCOLORP4UIVPROC)this->m_functions[2022];if(direct_)return direct_(type,color);return this->m_rawTable->glColorP4uiv(type,color);}
+inline void glUniformMatrix2x3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2X3FVPROC)this->m_functions[2023];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2x3fv(location,count,transpose,value);}
+inline void glCallCommandListNV(GLuint list)const{auto const direct_ = (FunctionTable::PFNGLCALLCOMMANDLISTNVPROC)this->m_functions[2024];if(direct_)return direct_(list);return this->m_rawTable->glCallCommandListNV(list);}
+inline void glClearBufferiv(GLenum buffer,GLint drawbuffer,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERIVPROC)this->m_functions[2025];if(direct_)return direct_(buffer,drawbuffer,value);return this->m_rawTable->glClearBufferiv(buffer,drawbuffer,value);}
+inline void glNamedStringARB(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string)const{auto const direct_ = (FunctionTable::PFNGLNAMEDSTRINGARBPROC)this->m_functions[2026];if(direct_)return direct_(type,namelen,name,stringlen,string);return this->m_rawTable->glNamedStringARB(type,namelen,name,stringlen,string);}
+inline void glMatrixMult3x2fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULT3X2FNVPROC)this->m_functions[2027];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixMult3x2fNV(matrixMode,m);}
+inline void glGetNamedProgramStringEXT(GLuint program,GLenum target,GLenum pname,void* string)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMSTRINGEXTPROC)this->m_functions[2028];if(direct_)return direct_(program,target,pname,string);return this->m_rawTable->glGetNamedProgramStringEXT(program,target,pname,string);}
+inline void glGetnHistogramARB(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETNHISTOGRAMARBPROC)this->m_functions[2029];if(direct_)return direct_(target,reset,format,type,bufSize,values);return this->m_rawTable->glGetnHistogramARB(target,reset,format,type,bufSize,values);}
+inline void glGetTextureLevelParameterfv(GLuint texture,GLint level,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURELEVELPARAMETERFVPROC)this->m_functions[2030];if(direct_)return direct_(texture,level,pname,params);return this->m_rawTable->glGetTextureLevelParameterfv(texture,level,pname,params);}
+inline void glMultiTexCoord1fv(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1FVPROC)this->m_functions[2031];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1fv(target,v);}
+inline void glBitmapxOES(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap)const{auto const direct_ = (FunctionTable::PFNGLBITMAPXOESPROC)this->m_functions[2032];if(direct_)return direct_(width,height,xorig,yorig,xmove,ymove,bitmap);return this->m_rawTable->glBitmapxOES(width,height,xorig,yorig,xmove,ymove,bitmap);}
+inline void glGetSamplerParameterIuiv(GLuint sampler,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETSAMPLERPARAMETERIUIVPROC)this->m_functions[2033];if(direct_)return direct_(sampler,pname,params);return this->m_rawTable->glGetSamplerParameterIuiv(sampler,pname,params);}
+inline void glTexCoordP3ui(GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP3UIPROC)this->m_functions[2034];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP3ui(type,coords);}
+inline void glTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE1DPROC)this->m_functions[2035];if(direct_)return direct_(texture,level,xoffset,width,format,type,pixels);return this->m_rawTable->glTextureSubImage1D(texture,level,xoffset,width,format,type,pixels);}
+inline void glVertexAttribLPointerEXT(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBLPOINTEREXTPROC)this->m_functions[2036];if(direct_)return direct_(index,size,type,stride,pointer);return this->m_rawTable->glVertexAttribLPointerEXT(index,size,type,stride,pointer);}
+inline void glFogCoordPointerEXT(GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDPOINTEREXTPROC)this->m_functions[2037];if(direct_)return direct_(type,stride,pointer);return this->m_rawTable->glFogCoordPointerEXT(type,stride,pointer);}
+inline void glWindowPos3s(GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SPROC)this->m_functions[2038];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3s(x,y,z);}
+inline void glVertexAttribs2svNV(GLuint index,GLsizei count,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS2SVNVPROC)this->m_functions[2039];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs2svNV(index,count,v);}
+inline void glTextureImage3DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE3DEXTPROC)this->m_functions[2040];if(direct_)return direct_(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);return this->m_rawTable->glTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+inline void glWindowPos3i(GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3IPROC)this->m_functions[2041];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3i(x,y,z);}
+inline void glWindowPos3d(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DPROC)this->m_functions[2042];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3d(x,y,z);}
+inline void glWindowPos3f(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FPROC)this->m_functions[2043];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3f(x,y,z);}
+inline GLboolean glIsEnabledIndexedEXT(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLISENABLEDINDEXEDEXTPROC)this->m_functions[2044];if(direct_)return direct_(target,index);return this->m_rawTable->glIsEnabledIndexedEXT(target,index);}
+inline void glGetNamedProgramivEXT(GLuint program,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMIVEXTPROC)this->m_functions[2045];if(direct_)return direct_(program,target,pname,params);return this->m_rawTable->glGetNamedProgramivEXT(program,target,pname,params);}
+inline void glVertex3xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3XVOESPROC)this->m_functions[2046];if(direct_)return direct_(coords);return this->m_rawTable->glVertex3xvOES(coords);}
+inline void glColor3us(GLushort red,GLushort green,GLushort blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3USPROC)this->m_functions[2047];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3us(red,green,blue);}
+inline void glBeginPerfMonitorAMD(GLuint monitor)const{auto const direct_ = (FunctionTable::PFNGLBEGINPERFMONITORAMDPROC)this->m_functions[2048];if(direct_)return direct_(monitor);return this->m_rawTable->glBeginPerfMonitorAMD(monitor);}
+inline void glProgramUniformMatrix4x3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)this->m_functions[2049];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x3dv(program,location,count,transpose,value);}
+inline void glGetNamedProgramLocalParameterIuivEXT(GLuint program,GLenum target,GLuint index,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)this->m_functions[2050];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glGetNamedProgramLocalParameterIuivEXT(program,target,index,params);}
+inline void glReadnPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{auto const direct_ = (FunctionTable::PFNGLREADNPIXELSPROC)this->m_functions[2051];if(direct_)return direct_(x,y,width,height,format,type,bufSize,data);return this->m_rawTable->glReadnPixels(x,y,width,height,format,type,bufSize,data);}
+inline void glMultiTexCoord4f(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4FPROC)this->m_functions[2052];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4f(target,s,t,r,q);}
+inline void glColor3ub(GLubyte red,GLubyte green,GLubyte blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3UBPROC)this->m_functions[2053];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3ub(red,green,blue);}
+inline void glMultiTexCoord4d(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4DPROC)this->m_functions[2054];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4d(target,s,t,r,q);}
+inline void glVertexAttribL3ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL3UI64NVPROC)this->m_functions[2055];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttribL3ui64NV(index,x,y,z);}
+inline void glColor3ui(GLuint red,GLuint green,GLuint blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3UIPROC)this->m_functions[2056];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3ui(red,green,blue);}
+inline void glProgramUniform4fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4FVEXTPROC)this->m_functions[2057];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4fvEXT(program,location,count,value);}
+inline void glVertexAttrib2sARB(GLuint index,GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SARBPROC)this->m_functions[2058];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2sARB(index,x,y);}
+inline void glMultiTexCoord4i(GLenum target,GLint s,GLint t,GLint r,GLint q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4IPROC)this->m_functions[2059];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4i(target,s,t,r,q);}
+inline GLenum glCheckFramebufferStatusEXT(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)this->m_functions[2060];if(direct_)return direct_(target);return this->m_rawTable->glCheckFramebufferStatusEXT(target);}
+inline void glGetnMapivARB(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPIVARBPROC)this->m_functions[2061];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapivARB(target,query,bufSize,v);}
+inline void glMultiTexCoord1ivARB(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1IVARBPROC)this->m_functions[2062];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1ivARB(target,v);}
+inline void glDisableVertexAttribArrayARB(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)this->m_functions[2063];if(direct_)return direct_(index);return this->m_rawTable->glDisableVertexAttribArrayARB(index);}
+inline void glGetPolygonStipple(GLubyte* mask)const{auto const direct_ = (FunctionTable::PFNGLGETPOLYGONSTIPPLEPROC)this->m_functions[2064];if(direct_)return direct_(mask);return this->m_rawTable->glGetPolygonStipple(mask);}
+inline void glVertexAttribI4ui(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UIPROC)this->m_functions[2065];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribI4ui(index,x,y,z,w);}
+inline void glGetPathDashArrayNV(GLuint path,GLfloat* dashArray)const{auto const direct_ = (FunctionTable::PFNGLGETPATHDASHARRAYNVPROC)this->m_functions[2066];if(direct_)return direct_(path,dashArray);return this->m_rawTable->glGetPathDashArrayNV(path,dashArray);}
+inline void glMultiTexRenderbufferEXT(GLenum texunit,GLenum target,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXRENDERBUFFEREXTPROC)this->m_functions[2067];if(direct_)return direct_(texunit,target,renderbuffer);return this->m_rawTable->glMultiTexRenderbufferEXT(texunit,target,renderbuffer);}
+inline void glCopyTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE1DPROC)this->m_functions[2068];if(direct_)return direct_(texture,level,xoffset,x,y,width);return this->m_rawTable->glCopyTextureSubImage1D(texture,level,xoffset,x,y,width);}
+inline void glDeleteOcclusionQueriesNV(GLsizei n,const GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLDELETEOCCLUSIONQUERIESNVPROC)this->m_functions[2069];if(direct_)return direct_(n,ids);return this->m_rawTable->glDeleteOcclusionQueriesNV(n,ids);}
+inline void glVertex4hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4HVNVPROC)this->m_functions[2070];if(direct_)return direct_(v);return this->m_rawTable->glVertex4hvNV(v);}
+inline void glGetnTexImage(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETNTEXIMAGEPROC)this->m_functions[2071];if(direct_)return direct_(target,level,format,type,bufSize,pixels);return this->m_rawTable->glGetnTexImage(target,level,format,type,bufSize,pixels);}
+inline void glProgramLocalParameter4dARB(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETER4DARBPROC)this->m_functions[2072];if(direct_)return direct_(target,index,x,y,z,w);return this->m_rawTable->glProgramLocalParameter4dARB(target,index,x,y,z,w);}
+inline void glBlendEquation(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONPROC)this->m_functions[2073];if(direct_)return direct_(mode);return this->m_rawTable->glBlendEquation(mode);}
+inline void glUnlockArraysEXT()const{auto const direct_ = (FunctionTable::PFNGLUNLOCKARRAYSEXTPROC)this->m_functions[2074];if(direct_)return direct_();return this->m_rawTable->glUnlockArraysEXT();}
+inline void glGetQueryObjectui64vEXT(GLuint id,GLenum pname,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTUI64VEXTPROC)this->m_functions[2075];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectui64vEXT(id,pname,params);}
+inline void glVertexAttribI4uivEXT(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UIVEXTPROC)this->m_functions[2076];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4uivEXT(index,v);}
+inline void glUniform1i64vNV(GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1I64VNVPROC)this->m_functions[2077];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1i64vNV(location,count,value);}
+inline void glMultiTexCoord3dv(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3DVPROC)this->m_functions[2078];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3dv(target,v);}
+inline void glColor4sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4SVPROC)this->m_functions[2079];if(direct_)return direct_(v);return this->m_rawTable->glColor4sv(v);}
+inline void glVertexStream4ivATI(GLenum stream,const GLint* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4IVATIPROC)this->m_functions[2080];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream4ivATI(stream,coords);}
+inline void glPopClientAttrib()const{auto const direct_ = (FunctionTable::PFNGLPOPCLIENTATTRIBPROC)this->m_functions[2081];if(direct_)return direct_();return this->m_rawTable->glPopClientAttrib();}
+inline void glClearBufferData(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERDATAPROC)this->m_functions[2082];if(direct_)return direct_(target,internalformat,format,type,data);return this->m_rawTable->glClearBufferData(target,internalformat,format,type,data);}
+inline void glGetProgramivNV(GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMIVNVPROC)this->m_functions[2083];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetProgramivNV(id,pname,params);}
+inline void glBeginTransformFeedback(GLenum primitiveMode)const{auto const direct_ = (FunctionTable::PFNGLBEGINTRANSFORMFEEDBACKPROC)this->m_functions[2084];if(direct_)return direct_(primitiveMode);return this->m_rawTable->glBeginTransformFeedback(primitiveMode);}
+inline void glFinishObjectAPPLE(GLenum object,GLint name)const{auto const direct_ = (FunctionTable::PFNGLFINISHOBJECTAPPLEPROC)this->m_functions[2085];if(direct_)return direct_(object,name);return this->m_rawTable->glFinishObjectAPPLE(object,name);}
+inline void glGetMinmaxParameterivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXPARAMETERIVEXTPROC)this->m_functions[2086];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetMinmaxParameterivEXT(target,pname,params);}
+inline void glColor3iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3IVPROC)this->m_functions[2087];if(direct_)return direct_(v);return this->m_rawTable->glColor3iv(v);}
+inline void glVertexAttrib3sv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SVPROC)this->m_functions[2088];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3sv(index,v);}
+inline void glCompressedTexImage1D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE1DPROC)this->m_functions[2089];if(direct_)return direct_(target,level,internalformat,width,border,imageSize,data);return this->m_rawTable->glCompressedTexImage1D(target,level,internalformat,width,border,imageSize,data);}
+inline void glDeleteTransformFeedbacks(GLsizei n,const GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLDELETETRANSFORMFEEDBACKSPROC)this->m_functions[2090];if(direct_)return direct_(n,ids);return this->m_rawTable->glDeleteTransformFeedbacks(n,ids);}
+inline void glGetVideoi64vNV(GLuint video_slot,GLenum pname,GLint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOI64VNVPROC)this->m_functions[2091];if(direct_)return direct_(video_slot,pname,params);return this->m_rawTable->glGetVideoi64vNV(video_slot,pname,params);}
+inline void glDrawRangeElementsBaseVertex(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{auto const direct_ = (FunctionTable::PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)this->m_functions[2092];if(direct_)return direct_(mode,start,end,count,type,indices,basevertex);return this->m_rawTable->glDrawRangeElementsBaseVertex(mode,start,end,count,type,indices,basevertex);}
+inline void glUniform4i64vARB(GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4I64VARBPROC)this->m_functions[2093];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4i64vARB(location,count,value);}
+inline void glTextureStorage3DMultisampleEXT(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)this->m_functions[2094];if(direct_)return direct_(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);return this->m_rawTable->glTextureStorage3DMultisampleEXT(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+inline void glGetTexParameterfv(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERFVPROC)this->m_functions[2095];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterfv(target,pname,params);}
+inline void glProgramUniformui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMUI64VNVPROC)this->m_functions[2096];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniformui64vNV(program,location,count,value);}
+inline void glCompressedMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)this->m_functions[2097];if(direct_)return direct_(texunit,target,level,internalformat,width,border,imageSize,bits);return this->m_rawTable->glCompressedMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,imageSize,bits);}
+inline void glProgramUniform2ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2IVEXTPROC)this->m_functions[2098];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2ivEXT(program,location,count,value);}
+inline void glPushGroupMarkerEXT(GLsizei length,const GLchar* marker)const{auto const direct_ = (FunctionTable::PFNGLPUSHGROUPMARKEREXTPROC)this->m_functions[2099];if(direct_)return direct_(length,marker);return this->m_rawTable->glPushGroupMarkerEXT(length,marker);}
+inline void glVertexAttrib1dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DVPROC)this->m_functions[2100];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1dv(index,v);}
+inline void glMatrixLoadIdentityEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADIDENTITYEXTPROC)this->m_functions[2101];if(direct_)return direct_(mode);return this->m_rawTable->glMatrixLoadIdentityEXT(mode);}
+inline void glMultTransposeMatrixxOES(const GLfixed* m)const{auto const direct_ = (FunctionTable::PFNGLMULTTRANSPOSEMATRIXXOESPROC)this->m_functions[2102];if(direct_)return direct_(m);return this->m_rawTable->glMultTransposeMatrixxOES(m);}
+inline void glGetPixelMapxv(GLenum map,GLint size,GLfixed* values)const{auto const direct_ = (FunctionTable::PFNGLGETPIXELMAPXVPROC)this->m_functions[2103];if(direct_)return direct_(map,size,values);return this->m_rawTable->glGetPixelMapxv(map,size,values);}
+inline void glFramebufferSampleLocationsfvARB(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)this->m_functions[2104];if(direct_)return direct_(target,start,count,v);return this->m_rawTable->glFramebufferSampleLocationsfvARB(target,start,count,v);}
+inline void glGetLightiv(GLenum light,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETLIGHTIVPROC)this->m_functions[2105];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glGetLightiv(light,pname,params);}
+inline void glBlendFuncSeparatei(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEIPROC)this->m_functions[2106];if(direct_)return direct_(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);return this->m_rawTable->glBlendFuncSeparatei(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+inline GLboolean glAcquireKeyedMutexWin32EXT(GLuint memory,GLuint64 key,GLuint timeout)const{auto const direct_ = (FunctionTable::PFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)this->m_functions[2107];if(direct_)return direct_(memory,key,timeout);return this->m_rawTable->glAcquireKeyedMutexWin32EXT(memory,key,timeout);}
+inline void glGetBooleanIndexedvEXT(GLenum target,GLuint index,GLboolean* data)const{auto const direct_ = (FunctionTable::PFNGLGETBOOLEANINDEXEDVEXTPROC)this->m_functions[2108];if(direct_)return direct_(target,index,data);return this->m_rawTable->glGetBooleanIndexedvEXT(target,index,data);}
+inline void glGetProgramSubroutineParameteruivNV(GLenum target,GLuint index,GLuint* param)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)this->m_functions[2109];if(direct_)return direct_(target,index,param);return this->m_rawTable->glGetProgramSubroutineParameteruivNV(target,index,param);}
+inline void glUniform2ui(GLint location,GLuint v0,GLuint v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UIPROC)this->m_functions[2110];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2ui(location,v0,v1);}
+inline void glApplyFramebufferAttachmentCMAAINTEL()const{auto const direct_ = (FunctionTable::PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)this->m_functions[2111];if(direct_)return direct_();return this->m_rawTable->glApplyFramebufferAttachmentCMAAINTEL();}
+inline void glWindowPos2fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FVPROC)this->m_functions[2112];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2fv(v);}
+inline void glWaitVkSemaphoreNV(GLuint64 vkSemaphore)const{auto const direct_ = (FunctionTable::PFNGLWAITVKSEMAPHORENVPROC)this->m_functions[2113];if(direct_)return direct_(vkSemaphore);return this->m_rawTable->glWaitVkSemaphoreNV(vkSemaphore);}
+inline void glDisablei(GLenum target,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEIPROC)this->m_functions[2114];if(direct_)return direct_(target,index);return this->m_rawTable->glDisablei(target,index);}
+inline void glSelectPerfMonitorCountersAMD(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList)const{auto const direct_ = (FunctionTable::PFNGLSELECTPERFMONITORCOUNTERSAMDPROC)this->m_functions[2115];if(direct_)return direct_(monitor,enable,group,numCounters,counterList);return this->m_rawTable->glSelectPerfMonitorCountersAMD(monitor,enable,group,numCounters,counterList);}
+inline void glGetVertexAttribLi64vNV(GLuint index,GLenum pname,GLint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBLI64VNVPROC)this->m_functions[2116];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribLi64vNV(index,pname,params);}
+inline void glBlendFuncSeparateiARB(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEIARBPROC)this->m_functions[2117];if(direct_)return direct_(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);return this->m_rawTable->glBlendFuncSeparateiARB(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+inline void glWeightuivARB(GLint size,const GLuint* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTUIVARBPROC)this->m_functions[2118];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightuivARB(size,weights);}
+inline void glWindowPos2iARB(GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IARBPROC)this->m_functions[2119];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2iARB(x,y);}
+inline void glGetProgramLocalParameterdvARB(GLenum target,GLuint index,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)this->m_functions[2120];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramLocalParameterdvARB(target,index,params);}
+inline void glGetUniformui64vARB(GLuint program,GLint location,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMUI64VARBPROC)this->m_functions[2121];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformui64vARB(program,location,params);}
+inline void glSecondaryColor3us(GLushort red,GLushort green,GLushort blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3USPROC)this->m_functions[2122];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3us(red,green,blue);}
+inline void glGetSynciv(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{auto const direct_ = (FunctionTable::PFNGLGETSYNCIVPROC)this->m_functions[2123];if(direct_)return direct_(sync,pname,bufSize,length,values);return this->m_rawTable->glGetSynciv(sync,pname,bufSize,length,values);}
+inline void glMakeImageHandleResidentARB(GLuint64 handle,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAKEIMAGEHANDLERESIDENTARBPROC)this->m_functions[2124];if(direct_)return direct_(handle,access);return this->m_rawTable->glMakeImageHandleResidentARB(handle,access);}
+inline void glGetProgramNamedParameterfvNV(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)this->m_functions[2125];if(direct_)return direct_(id,len,name,params);return this->m_rawTable->glGetProgramNamedParameterfvNV(id,len,name,params);}
+inline void glTextureStorage3D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE3DPROC)this->m_functions[2126];if(direct_)return direct_(texture,levels,internalformat,width,height,depth);return this->m_rawTable->glTextureStorage3D(texture,levels,internalformat,width,height,depth);}
+inline void glVertexAttrib4svNV(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SVNVPROC)this->m_functions[2127];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4svNV(index,v);}
+inline void glProgramUniform2i(GLuint program,GLint location,GLint v0,GLint v1)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2IPROC)this->m_functions[2128];if(direct_)return direct_(program,location,v0,v1);return this->m_rawTable->glProgramUniform2i(program,location,v0,v1);}
+inline void glListDrawCommandsStatesClientNV(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const direct_ = (FunctionTable::PFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)this->m_functions[2129];if(direct_)return direct_(list,segment,indirects,sizes,states,fbos,count);return this->m_rawTable->glListDrawCommandsStatesClientNV(list,segment,indirects,sizes,states,fbos,count);}
+inline void glProgramLocalParametersI4uivNV(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)this->m_functions[2130];if(direct_)return direct_(target,index,count,params);return this->m_rawTable->glProgramLocalParametersI4uivNV(target,index,count,params);}
+inline void glBeginTransformFeedbackNV(GLenum primitiveMode)const{auto const direct_ = (FunctionTable::PFNGLBEGINTRANSFORMFEEDBACKNVPROC)this->m_functions[2131];if(direct_)return direct_(primitiveMode);return this->m_rawTable->glBeginTransformFeedbackNV(primitiveMode);}
+inline void glGetProgramBinary(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMBINARYPROC)this->m_functions[2132];if(direct_)return direct_(program,bufSize,length,binaryFormat,binary);return this->m_rawTable->glGetProgramBinary(program,bufSize,length,binaryFormat,binary);}
+inline void glBinormal3iEXT(GLint bx,GLint by,GLint bz)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3IEXTPROC)this->m_functions[2133];if(direct_)return direct_(bx,by,bz);return this->m_rawTable->glBinormal3iEXT(bx,by,bz);}
+inline void glEvalPoint1(GLint i)const{auto const direct_ = (FunctionTable::PFNGLEVALPOINT1PROC)this->m_functions[2134];if(direct_)return direct_(i);return this->m_rawTable->glEvalPoint1(i);}
+inline void glEvalPoint2(GLint i,GLint j)const{auto const direct_ = (FunctionTable::PFNGLEVALPOINT2PROC)this->m_functions[2135];if(direct_)return direct_(i,j);return this->m_rawTable->glEvalPoint2(i,j);}
+inline void glPauseTransformFeedback()const{auto const direct_ = (FunctionTable::PFNGLPAUSETRANSFORMFEEDBACKPROC)this->m_functions[2136];if(direct_)return direct_();return this->m_rawTable->glPauseTransformFeedback();}
+inline void glWindowPos2sMESA(GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SMESAPROC)this->m_functions[2137];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2sMESA(x,y);}
+inline void glGlobalAlphaFactorbSUN(GLbyte factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORBSUNPROC)this->m_functions[2138];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactorbSUN(factor);}
+inline void glCreateTransformFeedbacks(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLCREATETRANSFORMFEEDBACKSPROC)this->m_functions[2139];if(direct_)return direct_(n,ids);return this->m_rawTable->glCreateTransformFeedbacks(n,ids);}
+inline void glTexturePageCommitmentEXT(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPAGECOMMITMENTEXTPROC)this->m_functions[2140];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);return this->m_rawTable->glTexturePageCommitmentEXT(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+inline void glTransformFeedbackVaryingsNV(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)this->m_functions[2141];if(direct_)return direct_(program,count,locations,bufferMode);return this->m_rawTable->glTransformFeedbackVaryingsNV(program,count,locations,bufferMode);}
+inline void glTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE1DPROC)this->m_functions[2142];if(direct_)return direct_(target,level,xoffset,width,format,type,pixels);return this->m_rawTable->glTexSubImage1D(target,level,xoffset,width,format,type,pixels);}
+inline void glConvolutionParameterfvEXT(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERFVEXTPROC)this->m_functions[2143];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterfvEXT(target,pname,params);}
+inline void glBlitFramebufferEXT(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{auto const direct_ = (FunctionTable::PFNGLBLITFRAMEBUFFEREXTPROC)this->m_functions[2144];if(direct_)return direct_(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);return this->m_rawTable->glBlitFramebufferEXT(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+inline void glUniformMatrix4fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4FVARBPROC)this->m_functions[2145];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4fvARB(location,count,transpose,value);}
+inline void glProgramEnvParameter4dvARB(GLenum target,GLuint index,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETER4DVARBPROC)this->m_functions[2146];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramEnvParameter4dvARB(target,index,params);}
+inline void glTextureStorageMem2DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGEMEM2DEXTPROC)this->m_functions[2147];if(direct_)return direct_(texture,levels,internalFormat,width,height,memory,offset);return this->m_rawTable->glTextureStorageMem2DEXT(texture,levels,internalFormat,width,height,memory,offset);}
+inline void glVertexAttribP3uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP3UIVPROC)this->m_functions[2148];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP3uiv(index,type,normalized,value);}
+inline void glFogCoordFormatNV(GLenum type,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDFORMATNVPROC)this->m_functions[2149];if(direct_)return direct_(type,stride);return this->m_rawTable->glFogCoordFormatNV(type,stride);}
+inline void glGetMultiTexLevelParameterivEXT(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)this->m_functions[2150];if(direct_)return direct_(texunit,target,level,pname,params);return this->m_rawTable->glGetMultiTexLevelParameterivEXT(texunit,target,level,pname,params);}
+inline GLboolean glIsOcclusionQueryNV(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISOCCLUSIONQUERYNVPROC)this->m_functions[2151];if(direct_)return direct_(id);return this->m_rawTable->glIsOcclusionQueryNV(id);}
+inline void glCompressedTexImage2DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)this->m_functions[2152];if(direct_)return direct_(target,level,internalformat,width,height,border,imageSize,data);return this->m_rawTable->glCompressedTexImage2DARB(target,level,internalformat,width,height,border,imageSize,data);}
+inline void glGetProgramEnvParameterIuivNV(GLenum target,GLuint index,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)this->m_functions[2153];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramEnvParameterIuivNV(target,index,params);}
+inline void glVertexAttrib4sv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SVPROC)this->m_functions[2154];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4sv(index,v);}
+inline void glVertexAttrib4fvARB(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FVARBPROC)this->m_functions[2155];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4fvARB(index,v);}
+inline void glLoadName(GLuint name)const{auto const direct_ = (FunctionTable::PFNGLLOADNAMEPROC)this->m_functions[2156];if(direct_)return direct_(name);return this->m_rawTable->glLoadName(name);}
+inline void glBindVertexShaderEXT(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBINDVERTEXSHADEREXTPROC)this->m_functions[2157];if(direct_)return direct_(id);return this->m_rawTable->glBindVertexShaderEXT(id);}
+inline void glGetNamedProgramLocalParameterIivEXT(GLuint program,GLenum target,GLuint index,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)this->m_functions[2158];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glGetNamedProgramLocalParameterIivEXT(program,target,index,params);}
+inline void glProgramUniform3uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UIEXTPROC)this->m_functions[2159];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3uiEXT(program,location,v0,v1,v2);}
+inline void glProgramUniformMatrix4x2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)this->m_functions[2160];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x2dvEXT(program,location,count,transpose,value);}
+inline void glTexCoord1hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD1HVNVPROC)this->m_functions[2161];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord1hvNV(v);}
+inline void glLoadMatrixd(const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLLOADMATRIXDPROC)this->m_functions[2162];if(direct_)return direct_(m);return this->m_rawTable->glLoadMatrixd(m);}
+inline void glTexParameterfv(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERFVPROC)this->m_functions[2163];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterfv(target,pname,params);}
+inline void glVariantdvEXT(GLuint id,const GLdouble* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTDVEXTPROC)this->m_functions[2164];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantdvEXT(id,addr);}
+inline void glCullParameterfvEXT(GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLCULLPARAMETERFVEXTPROC)this->m_functions[2165];if(direct_)return direct_(pname,params);return this->m_rawTable->glCullParameterfvEXT(pname,params);}
+inline void glUniform3dv(GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3DVPROC)this->m_functions[2166];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3dv(location,count,value);}
+inline void glProgramUniform3fv(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3FVPROC)this->m_functions[2167];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3fv(program,location,count,value);}
+inline GLboolean glIsBufferARB(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLISBUFFERARBPROC)this->m_functions[2168];if(direct_)return direct_(buffer);return this->m_rawTable->glIsBufferARB(buffer);}
+inline void glMultiTexCoord1bOES(GLenum texture,GLbyte s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1BOESPROC)this->m_functions[2169];if(direct_)return direct_(texture,s);return this->m_rawTable->glMultiTexCoord1bOES(texture,s);}
+inline void glFogCoordhNV(GLhalfNV fog)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDHNVPROC)this->m_functions[2170];if(direct_)return direct_(fog);return this->m_rawTable->glFogCoordhNV(fog);}
+inline void glFramebufferSampleLocationsfvNV(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)this->m_functions[2171];if(direct_)return direct_(target,start,count,v);return this->m_rawTable->glFramebufferSampleLocationsfvNV(target,start,count,v);}
+inline GLuint glGenSymbolsEXT(GLenum datatype,GLenum storagetype,GLenum range,GLuint components)const{auto const direct_ = (FunctionTable::PFNGLGENSYMBOLSEXTPROC)this->m_functions[2172];if(direct_)return direct_(datatype,storagetype,range,components);return this->m_rawTable->glGenSymbolsEXT(datatype,storagetype,range,components);}
+inline void glGetConvolutionFilter(GLenum target,GLenum format,GLenum type,GLvoid* image)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONFILTERPROC)this->m_functions[2173];if(direct_)return direct_(target,format,type,image);return this->m_rawTable->glGetConvolutionFilter(target,format,type,image);}
+inline void glProgramUniform1fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1FVEXTPROC)this->m_functions[2174];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1fvEXT(program,location,count,value);}
+inline void glGetNextPerfQueryIdINTEL(GLuint queryId,GLuint* nextQueryId)const{auto const direct_ = (FunctionTable::PFNGLGETNEXTPERFQUERYIDINTELPROC)this->m_functions[2175];if(direct_)return direct_(queryId,nextQueryId);return this->m_rawTable->glGetNextPerfQueryIdINTEL(queryId,nextQueryId);}
+inline void glCompressedTexImage1DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE1DARBPROC)this->m_functions[2176];if(direct_)return direct_(target,level,internalformat,width,border,imageSize,data);return this->m_rawTable->glCompressedTexImage1DARB(target,level,internalformat,width,border,imageSize,data);}
+inline void glBindSamplers(GLuint first,GLsizei count,const GLuint* samplers)const{auto const direct_ = (FunctionTable::PFNGLBINDSAMPLERSPROC)this->m_functions[2177];if(direct_)return direct_(first,count,samplers);return this->m_rawTable->glBindSamplers(first,count,samplers);}
+inline void glGetProgramEnvParameterIivNV(GLenum target,GLuint index,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMENVPARAMETERIIVNVPROC)this->m_functions[2178];if(direct_)return direct_(target,index,params);return this->m_rawTable->glGetProgramEnvParameterIivNV(target,index,params);}
+inline void glGetQueryObjectui64v(GLuint id,GLenum pname,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTUI64VPROC)this->m_functions[2179];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectui64v(id,pname,params);}
+inline void glVertexAttribL4ui64vNV(GLuint index,const GLuint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4UI64VNVPROC)this->m_functions[2180];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL4ui64vNV(index,v);}
+inline void glGetVideoivNV(GLuint video_slot,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOIVNVPROC)this->m_functions[2181];if(direct_)return direct_(video_slot,pname,params);return this->m_rawTable->glGetVideoivNV(video_slot,pname,params);}
+inline void glGetTextureImage(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREIMAGEPROC)this->m_functions[2182];if(direct_)return direct_(texture,level,format,type,bufSize,pixels);return this->m_rawTable->glGetTextureImage(texture,level,format,type,bufSize,pixels);}
+inline void glProgramUniform1fv(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1FVPROC)this->m_functions[2183];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1fv(program,location,count,value);}
+inline void glUniformMatrix4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4FVPROC)this->m_functions[2184];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4fv(location,count,transpose,value);}
+inline void glColorMask(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{auto const direct_ = (FunctionTable::PFNGLCOLORMASKPROC)this->m_functions[2185];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glColorMask(red,green,blue,alpha);}
+inline void glBeginFragmentShaderATI()const{auto const direct_ = (FunctionTable::PFNGLBEGINFRAGMENTSHADERATIPROC)this->m_functions[2186];if(direct_)return direct_();return this->m_rawTable->glBeginFragmentShaderATI();}
+inline void glMultiDrawArraysEXT(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSEXTPROC)this->m_functions[2187];if(direct_)return direct_(mode,first,count,primcount);return this->m_rawTable->glMultiDrawArraysEXT(mode,first,count,primcount);}
+inline void glGenNamesAMD(GLenum identifier,GLuint num,GLuint* names)const{auto const direct_ = (FunctionTable::PFNGLGENNAMESAMDPROC)this->m_functions[2188];if(direct_)return direct_(identifier,num,names);return this->m_rawTable->glGenNamesAMD(identifier,num,names);}
+inline void glPathParameteriNV(GLuint path,GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLPATHPARAMETERINVPROC)this->m_functions[2189];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glPathParameteriNV(path,pname,value);}
+inline void glCreateCommandListsNV(GLsizei n,GLuint* lists)const{auto const direct_ = (FunctionTable::PFNGLCREATECOMMANDLISTSNVPROC)this->m_functions[2190];if(direct_)return direct_(n,lists);return this->m_rawTable->glCreateCommandListsNV(n,lists);}
+inline void glDeleteProgramPipelines(GLsizei n,const GLuint* pipelines)const{auto const direct_ = (FunctionTable::PFNGLDELETEPROGRAMPIPELINESPROC)this->m_functions[2191];if(direct_)return direct_(n,pipelines);return this->m_rawTable->glDeleteProgramPipelines(n,pipelines);}
+inline void glCopyColorSubTableEXT(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCOLORSUBTABLEEXTPROC)this->m_functions[2192];if(direct_)return direct_(target,start,x,y,width);return this->m_rawTable->glCopyColorSubTableEXT(target,start,x,y,width);}
+inline void glVariantsvEXT(GLuint id,const GLshort* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTSVEXTPROC)this->m_functions[2193];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantsvEXT(id,addr);}
+inline void glGenProgramPipelines(GLsizei n,GLuint* pipelines)const{auto const direct_ = (FunctionTable::PFNGLGENPROGRAMPIPELINESPROC)this->m_functions[2194];if(direct_)return direct_(n,pipelines);return this->m_rawTable->glGenProgramPipelines(n,pipelines);}
+inline void glVertexArrayEdgeFlagOffsetEXT(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)this->m_functions[2195];if(direct_)return direct_(vaobj,buffer,stride,offset);return this->m_rawTable->glVertexArrayEdgeFlagOffsetEXT(vaobj,buffer,stride,offset);}
+inline void glWindowPos2s(GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SPROC)this->m_functions[2196];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2s(x,y);}
+inline void glSecondaryColor3iEXT(GLint red,GLint green,GLint blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3IEXTPROC)this->m_functions[2197];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3iEXT(red,green,blue);}
+inline void glWindowPos2i(GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IPROC)this->m_functions[2198];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2i(x,y);}
+inline void glWindowPos2f(GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FPROC)this->m_functions[2199];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2f(x,y);}
+inline void glWindowPos2d(GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DPROC)this->m_functions[2200];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2d(x,y);}
+inline void glUniform4uivEXT(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UIVEXTPROC)this->m_functions[2201];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4uivEXT(location,count,value);}
+inline void glOrthoxOES(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{auto const direct_ = (FunctionTable::PFNGLORTHOXOESPROC)this->m_functions[2202];if(direct_)return direct_(l,r,b,t,n,f);return this->m_rawTable->glOrthoxOES(l,r,b,t,n,f);}
+inline void glUniformSubroutinesuiv(GLenum shadertype,GLsizei count,const GLuint* indices)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMSUBROUTINESUIVPROC)this->m_functions[2203];if(direct_)return direct_(shadertype,count,indices);return this->m_rawTable->glUniformSubroutinesuiv(shadertype,count,indices);}
+inline void glRectdv(const GLdouble* v1,const GLdouble* v2)const{auto const direct_ = (FunctionTable::PFNGLRECTDVPROC)this->m_functions[2204];if(direct_)return direct_(v1,v2);return this->m_rawTable->glRectdv(v1,v2);}
+inline void glProgramUniform1i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1I64VNVPROC)this->m_functions[2205];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1i64vNV(program,location,count,value);}
+inline void glVertexAttribI4uiEXT(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UIEXTPROC)this->m_functions[2206];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribI4uiEXT(index,x,y,z,w);}
+inline void glSecondaryColor3ubEXT(GLubyte red,GLubyte green,GLubyte blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UBEXTPROC)this->m_functions[2207];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3ubEXT(red,green,blue);}
+inline void glCompressedMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)this->m_functions[2208];if(direct_)return direct_(texunit,target,level,xoffset,width,format,imageSize,bits);return this->m_rawTable->glCompressedMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,imageSize,bits);}
+inline void glMultiTexGendEXT(GLenum texunit,GLenum coord,GLenum pname,GLdouble param)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXGENDEXTPROC)this->m_functions[2209];if(direct_)return direct_(texunit,coord,pname,param);return this->m_rawTable->glMultiTexGendEXT(texunit,coord,pname,param);}
+inline void glColorP3uiv(GLenum type,const GLuint* color)const{auto const direct_ = (FunctionTable::PFNGLCOLORP3UIVPROC)this->m_functions[2210];if(direct_)return direct_(type,color);return this->m_rawTable->glColorP3uiv(type,color);}
+inline void glFogCoordfv(const GLfloat* coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDFVPROC)this->m_functions[2211];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoordfv(coord);}
+inline void glCompileShader(GLuint shader)const{auto const direct_ = (FunctionTable::PFNGLCOMPILESHADERPROC)this->m_functions[2212];if(direct_)return direct_(shader);return this->m_rawTable->glCompileShader(shader);}
+inline void glTexCoord2hNV(GLhalfNV s,GLhalfNV t)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2HNVPROC)this->m_functions[2213];if(direct_)return direct_(s,t);return this->m_rawTable->glTexCoord2hNV(s,t);}
+inline void glUniform1uivEXT(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UIVEXTPROC)this->m_functions[2214];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1uivEXT(location,count,value);}
+inline void glMatrixLoadTransposedEXT(GLenum mode,const GLdouble* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXLOADTRANSPOSEDEXTPROC)this->m_functions[2215];if(direct_)return direct_(mode,m);return this->m_rawTable->glMatrixLoadTransposedEXT(mode,m);}
+inline void glIndexfv(const GLfloat* c)const{auto const direct_ = (FunctionTable::PFNGLINDEXFVPROC)this->m_functions[2216];if(direct_)return direct_(c);return this->m_rawTable->glIndexfv(c);}
+inline void glGetCompressedTextureImage(GLuint texture,GLint level,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)this->m_functions[2217];if(direct_)return direct_(texture,level,bufSize,pixels);return this->m_rawTable->glGetCompressedTextureImage(texture,level,bufSize,pixels);}
+inline void glGetUniformuivEXT(GLuint program,GLint location,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMUIVEXTPROC)this->m_functions[2218];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformuivEXT(program,location,params);}
+inline void glGetnPixelMapfvARB(GLenum map,GLsizei bufSize,GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPFVARBPROC)this->m_functions[2219];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapfvARB(map,bufSize,values);}
+inline void glFramebufferTextureEXT(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREEXTPROC)this->m_functions[2220];if(direct_)return direct_(target,attachment,texture,level);return this->m_rawTable->glFramebufferTextureEXT(target,attachment,texture,level);}
+inline void glMultiDrawElementsIndirectCount(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)this->m_functions[2221];if(direct_)return direct_(mode,type,indirect,drawcount,maxdrawcount,stride);return this->m_rawTable->glMultiDrawElementsIndirectCount(mode,type,indirect,drawcount,maxdrawcount,stride);}
+inline void glVertexAttribIPointer(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBIPOINTERPROC)this->m_functions[2222];if(direct_)return direct_(index,size,type,stride,pointer);return this->m_rawTable->glVertexAttribIPointer(index,size,type,stride,pointer);}
+inline void glMultiTexCoordP3ui(GLenum texture,GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP3UIPROC)this->m_functions[2223];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP3ui(texture,type,coords);}
+inline void glEvaluateDepthValuesARB()const{auto const direct_ = (FunctionTable::PFNGLEVALUATEDEPTHVALUESARBPROC)this->m_functions[2224];if(direct_)return direct_();return this->m_rawTable->glEvaluateDepthValuesARB();}
+inline void glGetNamedBufferParameteriv(GLuint buffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPARAMETERIVPROC)this->m_functions[2225];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferParameteriv(buffer,pname,params);}
+inline void glGetNamedProgramLocalParameterfvEXT(GLuint program,GLenum target,GLuint index,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)this->m_functions[2226];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glGetNamedProgramLocalParameterfvEXT(program,target,index,params);}
+inline void glColor4fNormal3fVertex3fvSUN(const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)this->m_functions[2227];if(direct_)return direct_(c,n,v);return this->m_rawTable->glColor4fNormal3fVertex3fvSUN(c,n,v);}
+inline void glSeparableFilter2DEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column)const{auto const direct_ = (FunctionTable::PFNGLSEPARABLEFILTER2DEXTPROC)this->m_functions[2228];if(direct_)return direct_(target,internalformat,width,height,format,type,row,column);return this->m_rawTable->glSeparableFilter2DEXT(target,internalformat,width,height,format,type,row,column);}
+inline void glTexParameterxOES(GLenum target,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERXOESPROC)this->m_functions[2229];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glTexParameterxOES(target,pname,param);}
+inline void glClearAccumxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARACCUMXOESPROC)this->m_functions[2230];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearAccumxOES(red,green,blue,alpha);}
+inline void glInvalidateFramebuffer(GLenum target,GLsizei numAttachments,const GLenum* attachments)const{auto const direct_ = (FunctionTable::PFNGLINVALIDATEFRAMEBUFFERPROC)this->m_functions[2231];if(direct_)return direct_(target,numAttachments,attachments);return this->m_rawTable->glInvalidateFramebuffer(target,numAttachments,attachments);}
+inline void glWeightubvARB(GLint size,const GLubyte* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTUBVARBPROC)this->m_functions[2232];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightubvARB(size,weights);}
+inline void glVertexAttrib1d(GLuint index,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DPROC)this->m_functions[2233];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1d(index,x);}
+inline void glVertexAttrib1f(GLuint index,GLfloat x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FPROC)this->m_functions[2234];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1f(index,x);}
+inline void glVertex4fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4FVPROC)this->m_functions[2235];if(direct_)return direct_(v);return this->m_rawTable->glVertex4fv(v);}
+inline void glClearNamedFramebufferfi(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)this->m_functions[2236];if(direct_)return direct_(framebuffer,buffer,drawbuffer,depth,stencil);return this->m_rawTable->glClearNamedFramebufferfi(framebuffer,buffer,drawbuffer,depth,stencil);}
+inline void glGetQueryBufferObjectuiv(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYBUFFEROBJECTUIVPROC)this->m_functions[2237];if(direct_)return direct_(id,buffer,pname,offset);return this->m_rawTable->glGetQueryBufferObjectuiv(id,buffer,pname,offset);}
+inline void glClearNamedFramebufferfv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)this->m_functions[2238];if(direct_)return direct_(framebuffer,buffer,drawbuffer,value);return this->m_rawTable->glClearNamedFramebufferfv(framebuffer,buffer,drawbuffer,value);}
+inline void glEndVertexShaderEXT()const{auto const direct_ = (FunctionTable::PFNGLENDVERTEXSHADEREXTPROC)this->m_functions[2239];if(direct_)return direct_();return this->m_rawTable->glEndVertexShaderEXT();}
+inline void glVertexAttrib1s(GLuint index,GLshort x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SPROC)this->m_functions[2240];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1s(index,x);}
+inline void glMultiTexCoord4dvARB(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4DVARBPROC)this->m_functions[2241];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4dvARB(target,v);}
+inline void glMultiTexCoord1sv(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1SVPROC)this->m_functions[2242];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1sv(target,v);}
+inline void glUniform1ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UI64VNVPROC)this->m_functions[2243];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1ui64vNV(location,count,value);}
+inline void glGetClipPlanefOES(GLenum plane,GLfloat* equation)const{auto const direct_ = (FunctionTable::PFNGLGETCLIPPLANEFOESPROC)this->m_functions[2244];if(direct_)return direct_(plane,equation);return this->m_rawTable->glGetClipPlanefOES(plane,equation);}
+inline void glRasterPos2s(GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2SPROC)this->m_functions[2245];if(direct_)return direct_(x,y);return this->m_rawTable->glRasterPos2s(x,y);}
+inline void glWeightivARB(GLint size,const GLint* weights)const{auto const direct_ = (FunctionTable::PFNGLWEIGHTIVARBPROC)this->m_functions[2246];if(direct_)return direct_(size,weights);return this->m_rawTable->glWeightivARB(size,weights);}
+inline void glMultiTexCoord4hvNV(GLenum target,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4HVNVPROC)this->m_functions[2247];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4hvNV(target,v);}
+inline void glNormal3hNV(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3HNVPROC)this->m_functions[2248];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3hNV(nx,ny,nz);}
+inline void glGetSeparableFilter(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span)const{auto const direct_ = (FunctionTable::PFNGLGETSEPARABLEFILTERPROC)this->m_functions[2249];if(direct_)return direct_(target,format,type,row,column,span);return this->m_rawTable->glGetSeparableFilter(target,format,type,row,column,span);}
+inline void glGetPathTexGenivNV(GLenum texCoordSet,GLenum pname,GLint* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHTEXGENIVNVPROC)this->m_functions[2250];if(direct_)return direct_(texCoordSet,pname,value);return this->m_rawTable->glGetPathTexGenivNV(texCoordSet,pname,value);}
+inline void glColor4bv(const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4BVPROC)this->m_functions[2251];if(direct_)return direct_(v);return this->m_rawTable->glColor4bv(v);}
+inline void glRasterPos2f(GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2FPROC)this->m_functions[2252];if(direct_)return direct_(x,y);return this->m_rawTable->glRasterPos2f(x,y);}
+inline void glNamedBufferPageCommitmentARB(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)this->m_functions[2253];if(direct_)return direct_(buffer,offset,size,commit);return this->m_rawTable->glNamedBufferPageCommitmentARB(buffer,offset,size,commit);}
+inline void glLoadIdentity()const{auto const direct_ = (FunctionTable::PFNGLLOADIDENTITYPROC)this->m_functions[2254];if(direct_)return direct_();return this->m_rawTable->glLoadIdentity();}
+inline void glRasterPos2i(GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS2IPROC)this->m_functions[2255];if(direct_)return direct_(x,y);return this->m_rawTable->glRasterPos2i(x,y);}
+inline void glRasterPos4iv(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4IVPROC)this->m_functions[2256];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos4iv(v);}
+inline void glMultiTexCoord2fvARB(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2FVARBPROC)this->m_functions[2257];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2fvARB(target,v);}
+inline void glUniformMatrix4x3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4X3FVPROC)this->m_functions[2258];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4x3fv(location,count,transpose,value);}
+inline void glClearBufferfv(GLenum buffer,GLint drawbuffer,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERFVPROC)this->m_functions[2259];if(direct_)return direct_(buffer,drawbuffer,value);return this->m_rawTable->glClearBufferfv(buffer,drawbuffer,value);}
+inline void glMultiTexCoord4hNV(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4HNVPROC)this->m_functions[2260];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4hNV(target,s,t,r,q);}
+inline void glTextureBarrier()const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBARRIERPROC)this->m_functions[2261];if(direct_)return direct_();return this->m_rawTable->glTextureBarrier();}
+inline void glReplacementCodeuivSUN(const GLuint* code)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUIVSUNPROC)this->m_functions[2262];if(direct_)return direct_(code);return this->m_rawTable->glReplacementCodeuivSUN(code);}
+inline void glDeleteAsyncMarkersSGIX(GLuint marker,GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLDELETEASYNCMARKERSSGIXPROC)this->m_functions[2263];if(direct_)return direct_(marker,range);return this->m_rawTable->glDeleteAsyncMarkersSGIX(marker,range);}
+inline void glTexCoord2bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2BVOESPROC)this->m_functions[2264];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord2bvOES(coords);}
+inline void glEvalCoord2xOES(GLfixed u,GLfixed v)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD2XOESPROC)this->m_functions[2265];if(direct_)return direct_(u,v);return this->m_rawTable->glEvalCoord2xOES(u,v);}
+inline void glGetSharpenTexFuncSGIS(GLenum target,GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLGETSHARPENTEXFUNCSGISPROC)this->m_functions[2266];if(direct_)return direct_(target,points);return this->m_rawTable->glGetSharpenTexFuncSGIS(target,points);}
+inline void glProgramUniformHandleui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)this->m_functions[2267];if(direct_)return direct_(program,location,count,values);return this->m_rawTable->glProgramUniformHandleui64vNV(program,location,count,values);}
+inline void glIglooInterfaceSGIX(GLenum pname,const void* params)const{auto const direct_ = (FunctionTable::PFNGLIGLOOINTERFACESGIXPROC)this->m_functions[2268];if(direct_)return direct_(pname,params);return this->m_rawTable->glIglooInterfaceSGIX(pname,params);}
+inline void glWindowPos2dvARB(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DVARBPROC)this->m_functions[2269];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2dvARB(v);}
+inline void glClearBufferfi(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{auto const direct_ = (FunctionTable::PFNGLCLEARBUFFERFIPROC)this->m_functions[2270];if(direct_)return direct_(buffer,drawbuffer,depth,stencil);return this->m_rawTable->glClearBufferfi(buffer,drawbuffer,depth,stencil);}
+inline void glDrawArraysIndirect(GLenum mode,const void* indirect)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSINDIRECTPROC)this->m_functions[2271];if(direct_)return direct_(mode,indirect);return this->m_rawTable->glDrawArraysIndirect(mode,indirect);}
+inline void glGenVertexArrays(GLsizei n,GLuint* arrays)const{auto const direct_ = (FunctionTable::PFNGLGENVERTEXARRAYSPROC)this->m_functions[2272];if(direct_)return direct_(n,arrays);return this->m_rawTable->glGenVertexArrays(n,arrays);}
+inline void glGetTransformFeedbacki64_v(GLuint xfb,GLenum pname,GLuint index,GLint64* param)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKI64_VPROC)this->m_functions[2273];if(direct_)return direct_(xfb,pname,index,param);return this->m_rawTable->glGetTransformFeedbacki64_v(xfb,pname,index,param);}
+inline void glEnableVertexArrayAttrib(GLuint vaobj,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXARRAYATTRIBPROC)this->m_functions[2274];if(direct_)return direct_(vaobj,index);return this->m_rawTable->glEnableVertexArrayAttrib(vaobj,index);}
+inline void glProgramUniformMatrix3x2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)this->m_functions[2275];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x2dv(program,location,count,transpose,value);}
+inline void glVertexStream4fATI(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4FATIPROC)this->m_functions[2276];if(direct_)return direct_(stream,x,y,z,w);return this->m_rawTable->glVertexStream4fATI(stream,x,y,z,w);}
+inline void glVertexBindingDivisor(GLuint bindingindex,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXBINDINGDIVISORPROC)this->m_functions[2277];if(direct_)return direct_(bindingindex,divisor);return this->m_rawTable->glVertexBindingDivisor(bindingindex,divisor);}
+inline void glGetSamplerParameterIiv(GLuint sampler,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETSAMPLERPARAMETERIIVPROC)this->m_functions[2278];if(direct_)return direct_(sampler,pname,params);return this->m_rawTable->glGetSamplerParameterIiv(sampler,pname,params);}
+inline void glGetCoverageModulationTableNV(GLsizei bufsize,GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLGETCOVERAGEMODULATIONTABLENVPROC)this->m_functions[2279];if(direct_)return direct_(bufsize,v);return this->m_rawTable->glGetCoverageModulationTableNV(bufsize,v);}
+inline void glDepthRangedNV(GLdouble zNear,GLdouble zFar)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEDNVPROC)this->m_functions[2280];if(direct_)return direct_(zNear,zFar);return this->m_rawTable->glDepthRangedNV(zNear,zFar);}
+inline void glVertexAttrib3f(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FPROC)this->m_functions[2281];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3f(index,x,y,z);}
+inline void glMultiDrawRangeElementArrayAPPLE(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)this->m_functions[2282];if(direct_)return direct_(mode,start,end,first,count,primcount);return this->m_rawTable->glMultiDrawRangeElementArrayAPPLE(mode,start,end,first,count,primcount);}
+inline void glVertexAttribFormatNV(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBFORMATNVPROC)this->m_functions[2283];if(direct_)return direct_(index,size,type,normalized,stride);return this->m_rawTable->glVertexAttribFormatNV(index,size,type,normalized,stride);}
+inline void glGetQueryBufferObjecti64v(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYBUFFEROBJECTI64VPROC)this->m_functions[2284];if(direct_)return direct_(id,buffer,pname,offset);return this->m_rawTable->glGetQueryBufferObjecti64v(id,buffer,pname,offset);}
+inline void glGetVertexAttribdv(GLuint index,GLenum pname,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBDVPROC)this->m_functions[2285];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribdv(index,pname,params);}
+inline void glGetUniformi64vARB(GLuint program,GLint location,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMI64VARBPROC)this->m_functions[2286];if(direct_)return direct_(program,location,params);return this->m_rawTable->glGetUniformi64vARB(program,location,params);}
+inline GLboolean glAreTexturesResidentEXT(GLsizei n,const GLuint* textures,GLboolean* residences)const{auto const direct_ = (FunctionTable::PFNGLARETEXTURESRESIDENTEXTPROC)this->m_functions[2287];if(direct_)return direct_(n,textures,residences);return this->m_rawTable->glAreTexturesResidentEXT(n,textures,residences);}
+inline GLhandleARB glGetHandleARB(GLenum pname)const{auto const direct_ = (FunctionTable::PFNGLGETHANDLEARBPROC)this->m_functions[2288];if(direct_)return direct_(pname);return this->m_rawTable->glGetHandleARB(pname);}
+inline void glVideoCaptureStreamParameterdvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)this->m_functions[2289];if(direct_)return direct_(video_capture_slot,stream,pname,params);return this->m_rawTable->glVideoCaptureStreamParameterdvNV(video_capture_slot,stream,pname,params);}
+inline void glMapParameterivNV(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMAPPARAMETERIVNVPROC)this->m_functions[2290];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glMapParameterivNV(target,pname,params);}
+inline GLboolean glIsVertexArray(GLuint array)const{auto const direct_ = (FunctionTable::PFNGLISVERTEXARRAYPROC)this->m_functions[2291];if(direct_)return direct_(array);return this->m_rawTable->glIsVertexArray(array);}
+inline void glSecondaryColor3sEXT(GLshort red,GLshort green,GLshort blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3SEXTPROC)this->m_functions[2292];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3sEXT(red,green,blue);}
+inline void glGetTexParameterIivEXT(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERIIVEXTPROC)this->m_functions[2293];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterIivEXT(target,pname,params);}
+inline void glFrameTerminatorGREMEDY()const{auto const direct_ = (FunctionTable::PFNGLFRAMETERMINATORGREMEDYPROC)this->m_functions[2294];if(direct_)return direct_();return this->m_rawTable->glFrameTerminatorGREMEDY();}
+inline void glBlendBarrierKHR()const{auto const direct_ = (FunctionTable::PFNGLBLENDBARRIERKHRPROC)this->m_functions[2295];if(direct_)return direct_();return this->m_rawTable->glBlendBarrierKHR();}
+inline void glVertexAttrib4NubARB(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NUBARBPROC)this->m_functions[2296];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4NubARB(index,x,y,z,w);}
+inline void glPrimitiveRestartNV()const{auto const direct_ = (FunctionTable::PFNGLPRIMITIVERESTARTNVPROC)this->m_functions[2297];if(direct_)return direct_();return this->m_rawTable->glPrimitiveRestartNV();}
+inline void glVertexAttribL1ui64vARB(GLuint index,const GLuint64EXT* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL1UI64VARBPROC)this->m_functions[2298];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL1ui64vARB(index,v);}
+inline void glVertexAttribI4ivEXT(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4IVEXTPROC)this->m_functions[2299];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4ivEXT(index,v);}
+inline void glVertexAttribs4svNV(GLuint index,GLsizei count,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS4SVNVPROC)this->m_functions[2300];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs4svNV(index,count,v);}
+inline void glUniform1ui(GLint location,GLuint v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UIPROC)this->m_functions[2301];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1ui(location,v0);}
+inline void glVertexAttrib2fvARB(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FVARBPROC)this->m_functions[2302];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2fvARB(index,v);}
+inline void glVertexAttribI4svEXT(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4SVEXTPROC)this->m_functions[2303];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4svEXT(index,v);}
+inline void glTextureImage3DMultisampleCoverageNV(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)this->m_functions[2304];if(direct_)return direct_(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);return this->m_rawTable->glTextureImage3DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+inline void glMemoryBarrier(GLbitfield barriers)const{auto const direct_ = (FunctionTable::PFNGLMEMORYBARRIERPROC)this->m_functions[2305];if(direct_)return direct_(barriers);return this->m_rawTable->glMemoryBarrier(barriers);}
+inline void glGetVariantArrayObjectfvATI(GLuint id,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTARRAYOBJECTFVATIPROC)this->m_functions[2306];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetVariantArrayObjectfvATI(id,pname,params);}
+inline void glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)this->m_functions[2307];if(direct_)return direct_(tc,c,n,v);return this->m_rawTable->glTexCoord4fColor4fNormal3fVertex4fvSUN(tc,c,n,v);}
+inline GLboolean glIsProgramARB(GLuint program)const{auto const direct_ = (FunctionTable::PFNGLISPROGRAMARBPROC)this->m_functions[2308];if(direct_)return direct_(program);return this->m_rawTable->glIsProgramARB(program);}
+inline void glBindImageTextureEXT(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format)const{auto const direct_ = (FunctionTable::PFNGLBINDIMAGETEXTUREEXTPROC)this->m_functions[2309];if(direct_)return direct_(index,texture,level,layered,layer,access,format);return this->m_rawTable->glBindImageTextureEXT(index,texture,level,layered,layer,access,format);}
+inline GLint glGetFragDataLocation(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGDATALOCATIONPROC)this->m_functions[2310];if(direct_)return direct_(program,name);return this->m_rawTable->glGetFragDataLocation(program,name);}
+inline void glMultiTexCoord1svARB(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1SVARBPROC)this->m_functions[2311];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord1svARB(target,v);}
+inline void glGetMapxvOES(GLenum target,GLenum query,GLfixed* v)const{auto const direct_ = (FunctionTable::PFNGLGETMAPXVOESPROC)this->m_functions[2312];if(direct_)return direct_(target,query,v);return this->m_rawTable->glGetMapxvOES(target,query,v);}
+inline void glTextureStorage2DMultisampleEXT(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)this->m_functions[2313];if(direct_)return direct_(texture,target,samples,internalformat,width,height,fixedsamplelocations);return this->m_rawTable->glTextureStorage2DMultisampleEXT(texture,target,samples,internalformat,width,height,fixedsamplelocations);}
+inline void glGetMaterialfv(GLenum face,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETMATERIALFVPROC)this->m_functions[2314];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glGetMaterialfv(face,pname,params);}
+inline void glVertexAttrib4NbvARB(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NBVARBPROC)this->m_functions[2315];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4NbvARB(index,v);}
+inline void glPixelMapuiv(GLenum map,GLsizei mapsize,const GLuint* values)const{auto const direct_ = (FunctionTable::PFNGLPIXELMAPUIVPROC)this->m_functions[2316];if(direct_)return direct_(map,mapsize,values);return this->m_rawTable->glPixelMapuiv(map,mapsize,values);}
+inline void glColorPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLCOLORPOINTEREXTPROC)this->m_functions[2317];if(direct_)return direct_(size,type,stride,count,pointer);return this->m_rawTable->glColorPointerEXT(size,type,stride,count,pointer);}
+inline void glEnableClientStateiEXT(GLenum array,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLECLIENTSTATEIEXTPROC)this->m_functions[2318];if(direct_)return direct_(array,index);return this->m_rawTable->glEnableClientStateiEXT(array,index);}
+inline void glClearTexSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCLEARTEXSUBIMAGEPROC)this->m_functions[2319];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);return this->m_rawTable->glClearTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);}
+inline void glEvalCoord1xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1XVOESPROC)this->m_functions[2320];if(direct_)return direct_(coords);return this->m_rawTable->glEvalCoord1xvOES(coords);}
+inline void glDetachObjectARB(GLhandleARB containerObj,GLhandleARB attachedObj)const{auto const direct_ = (FunctionTable::PFNGLDETACHOBJECTARBPROC)this->m_functions[2321];if(direct_)return direct_(containerObj,attachedObj);return this->m_rawTable->glDetachObjectARB(containerObj,attachedObj);}
+inline void glGetTextureParameterIiv(GLuint texture,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIIVPROC)this->m_functions[2322];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glGetTextureParameterIiv(texture,pname,params);}
+inline void glVariantusvEXT(GLuint id,const GLushort* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTUSVEXTPROC)this->m_functions[2323];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantusvEXT(id,addr);}
+inline void glCompressedTextureImage3DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)this->m_functions[2324];if(direct_)return direct_(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);return this->m_rawTable->glCompressedTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+inline void glMultiTexCoord1dARB(GLenum target,GLdouble s)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1DARBPROC)this->m_functions[2325];if(direct_)return direct_(target,s);return this->m_rawTable->glMultiTexCoord1dARB(target,s);}
+inline void glGetVertexArrayIntegeri_vEXT(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)this->m_functions[2326];if(direct_)return direct_(vaobj,index,pname,param);return this->m_rawTable->glGetVertexArrayIntegeri_vEXT(vaobj,index,pname,param);}
+inline void glVertexAttribI4ubv(GLuint index,const GLubyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UBVPROC)this->m_functions[2327];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4ubv(index,v);}
+inline void glPixelTexGenParameterfSGIS(GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTEXGENPARAMETERFSGISPROC)this->m_functions[2328];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelTexGenParameterfSGIS(pname,param);}
+inline void glProgramUniformMatrix4x2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)this->m_functions[2329];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x2dv(program,location,count,transpose,value);}
+inline void glUniform3fARB(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3FARBPROC)this->m_functions[2330];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3fARB(location,v0,v1,v2);}
+inline GLboolean glIsShader(GLuint shader)const{auto const direct_ = (FunctionTable::PFNGLISSHADERPROC)this->m_functions[2331];if(direct_)return direct_(shader);return this->m_rawTable->glIsShader(shader);}
+inline void glConvolutionParameteriv(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERIVPROC)this->m_functions[2332];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameteriv(target,pname,params);}
+inline void glCopyMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)this->m_functions[2333];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,x,y,width,height);return this->m_rawTable->glCopyMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,x,y,width,height);}
+inline void glEnableVertexAttribArrayARB(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXATTRIBARRAYARBPROC)this->m_functions[2334];if(direct_)return direct_(index);return this->m_rawTable->glEnableVertexAttribArrayARB(index);}
+inline void glMulticastCopyBufferSubDataNV(GLuint readGpu,GLbitfield writeGpuMask,GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)this->m_functions[2335];if(direct_)return direct_(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);return this->m_rawTable->glMulticastCopyBufferSubDataNV(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);}
+inline void glEnable(GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLENABLEPROC)this->m_functions[2336];if(direct_)return direct_(cap);return this->m_rawTable->glEnable(cap);}
+inline void glGetActiveUniformsiv(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMSIVPROC)this->m_functions[2337];if(direct_)return direct_(program,uniformCount,uniformIndices,pname,params);return this->m_rawTable->glGetActiveUniformsiv(program,uniformCount,uniformIndices,pname,params);}
+inline void glGetVertexAttribivARB(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIVARBPROC)this->m_functions[2338];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribivARB(index,pname,params);}
+inline void glTexCoord4hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4HVNVPROC)this->m_functions[2339];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord4hvNV(v);}
+inline void glUseProgramObjectARB(GLhandleARB programObj)const{auto const direct_ = (FunctionTable::PFNGLUSEPROGRAMOBJECTARBPROC)this->m_functions[2340];if(direct_)return direct_(programObj);return this->m_rawTable->glUseProgramObjectARB(programObj);}
+inline GLint glGetAttribLocation(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETATTRIBLOCATIONPROC)this->m_functions[2341];if(direct_)return direct_(program,name);return this->m_rawTable->glGetAttribLocation(program,name);}
+inline void glVertexAttrib4dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DVPROC)this->m_functions[2342];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4dv(index,v);}
+inline void glGetTextureParameteriv(GLuint texture,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIVPROC)this->m_functions[2343];if(direct_)return direct_(texture,pname,params);return this->m_rawTable->glGetTextureParameteriv(texture,pname,params);}
+inline void glNamedBufferStorageMemEXT(GLuint buffer,GLsizeiptr size,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)this->m_functions[2344];if(direct_)return direct_(buffer,size,memory,offset);return this->m_rawTable->glNamedBufferStorageMemEXT(buffer,size,memory,offset);}
+inline void glPathSubCoordsNV(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const direct_ = (FunctionTable::PFNGLPATHSUBCOORDSNVPROC)this->m_functions[2345];if(direct_)return direct_(path,coordStart,numCoords,coordType,coords);return this->m_rawTable->glPathSubCoordsNV(path,coordStart,numCoords,coordType,coords);}
+inline void glMatrixIndexusvARB(GLint size,const GLushort* indices)const{auto const direct_ = (FunctionTable::PFNGLMATRIXINDEXUSVARBPROC)this->m_functions[2346];if(direct_)return direct_(size,indices);return this->m_rawTable->glMatrixIndexusvARB(size,indices);}
+inline void glGetVideouivNV(GLuint video_slot,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOUIVNVPROC)this->m_functions[2347];if(direct_)return direct_(video_slot,pname,params);return this->m_rawTable->glGetVideouivNV(video_slot,pname,params);}
+inline void glGetVideoCaptureivNV(GLuint video_capture_slot,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOCAPTUREIVNVPROC)this->m_functions[2348];if(direct_)return direct_(video_capture_slot,pname,params);return this->m_rawTable->glGetVideoCaptureivNV(video_capture_slot,pname,params);}
+inline void glProgramUniform3ui(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3UIPROC)this->m_functions[2349];if(direct_)return direct_(program,location,v0,v1,v2);return this->m_rawTable->glProgramUniform3ui(program,location,v0,v1,v2);}
+inline void glVertexAttrib3svARB(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SVARBPROC)this->m_functions[2350];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3svARB(index,v);}
+inline void glGetNamedBufferParameterivEXT(GLuint buffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)this->m_functions[2351];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferParameterivEXT(buffer,pname,params);}
+inline void glMatrixScaledEXT(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLMATRIXSCALEDEXTPROC)this->m_functions[2352];if(direct_)return direct_(mode,x,y,z);return this->m_rawTable->glMatrixScaledEXT(mode,x,y,z);}
+inline void glProgramUniformMatrix2x3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)this->m_functions[2353];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x3fv(program,location,count,transpose,value);}
+inline void glGetFragmentLightivSGIX(GLenum light,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGMENTLIGHTIVSGIXPROC)this->m_functions[2354];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glGetFragmentLightivSGIX(light,pname,params);}
+inline const GLubyte* glGetStringi(GLenum name,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLGETSTRINGIPROC)this->m_functions[2355];if(direct_)return direct_(name,index);return this->m_rawTable->glGetStringi(name,index);}
+inline void glWindowPos2svARB(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SVARBPROC)this->m_functions[2356];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2svARB(v);}
+inline void glVertexAttrib2svNV(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SVNVPROC)this->m_functions[2357];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2svNV(index,v);}
+inline void glWindowPos2ivARB(const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IVARBPROC)this->m_functions[2358];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2ivARB(v);}
+inline void glGetVertexAttribPointervNV(GLuint index,GLenum pname,void** pointer)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBPOINTERVNVPROC)this->m_functions[2359];if(direct_)return direct_(index,pname,pointer);return this->m_rawTable->glGetVertexAttribPointervNV(index,pname,pointer);}
+inline void glPushMatrix()const{auto const direct_ = (FunctionTable::PFNGLPUSHMATRIXPROC)this->m_functions[2360];if(direct_)return direct_();return this->m_rawTable->glPushMatrix();}
+inline void glEdgeFlagPointerListIBM(GLint stride,const GLboolean** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGPOINTERLISTIBMPROC)this->m_functions[2361];if(direct_)return direct_(stride,pointer,ptrstride);return this->m_rawTable->glEdgeFlagPointerListIBM(stride,pointer,ptrstride);}
+inline void glGenerateMipmapEXT(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLGENERATEMIPMAPEXTPROC)this->m_functions[2362];if(direct_)return direct_(target);return this->m_rawTable->glGenerateMipmapEXT(target);}
+inline void glWindowPos3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3SVPROC)this->m_functions[2363];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3sv(v);}
+inline void glPathCoordsNV(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords)const{auto const direct_ = (FunctionTable::PFNGLPATHCOORDSNVPROC)this->m_functions[2364];if(direct_)return direct_(path,numCoords,coordType,coords);return this->m_rawTable->glPathCoordsNV(path,numCoords,coordType,coords);}
+inline void glProgramUniform1i(GLuint program,GLint location,GLint v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1IPROC)this->m_functions[2365];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1i(program,location,v0);}
+inline void glProgramUniform1d(GLuint program,GLint location,GLdouble v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1DPROC)this->m_functions[2366];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1d(program,location,v0);}
+inline void glProgramUniform1f(GLuint program,GLint location,GLfloat v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1FPROC)this->m_functions[2367];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1f(program,location,v0);}
+inline void glProgramParameteriEXT(GLuint program,GLenum pname,GLint value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETERIEXTPROC)this->m_functions[2368];if(direct_)return direct_(program,pname,value);return this->m_rawTable->glProgramParameteriEXT(program,pname,value);}
+inline void glCompressedMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)this->m_functions[2369];if(direct_)return direct_(texunit,target,level,internalformat,width,height,border,imageSize,bits);return this->m_rawTable->glCompressedMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,imageSize,bits);}
+inline void glProgramUniform3iv(GLuint program,GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3IVPROC)this->m_functions[2370];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3iv(program,location,count,value);}
+inline void glIndexiv(const GLint* c)const{auto const direct_ = (FunctionTable::PFNGLINDEXIVPROC)this->m_functions[2371];if(direct_)return direct_(c);return this->m_rawTable->glIndexiv(c);}
+inline void glMultiTexCoord4xvOES(GLenum texture,const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4XVOESPROC)this->m_functions[2372];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord4xvOES(texture,coords);}
+inline void glEGLImageTargetTexture2DOES(GLenum target,GLeglImageOES image)const{auto const direct_ = (FunctionTable::PFNGLEGLIMAGETARGETTEXTURE2DOESPROC)this->m_functions[2373];if(direct_)return direct_(target,image);return this->m_rawTable->glEGLImageTargetTexture2DOES(target,image);}
+inline void glPixelZoom(GLfloat xfactor,GLfloat yfactor)const{auto const direct_ = (FunctionTable::PFNGLPIXELZOOMPROC)this->m_functions[2374];if(direct_)return direct_(xfactor,yfactor);return this->m_rawTable->glPixelZoom(xfactor,yfactor);}
+inline void glVertex3bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3BVOESPROC)this->m_functions[2375];if(direct_)return direct_(coords);return this->m_rawTable->glVertex3bvOES(coords);}
+inline void glFramebufferReadBufferEXT(GLuint framebuffer,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERREADBUFFEREXTPROC)this->m_functions[2376];if(direct_)return direct_(framebuffer,mode);return this->m_rawTable->glFramebufferReadBufferEXT(framebuffer,mode);}
+inline void glExtractComponentEXT(GLuint res,GLuint src,GLuint num)const{auto const direct_ = (FunctionTable::PFNGLEXTRACTCOMPONENTEXTPROC)this->m_functions[2377];if(direct_)return direct_(res,src,num);return this->m_rawTable->glExtractComponentEXT(res,src,num);}
+inline void glCombinerParameterivNV(GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLCOMBINERPARAMETERIVNVPROC)this->m_functions[2378];if(direct_)return direct_(pname,params);return this->m_rawTable->glCombinerParameterivNV(pname,params);}
+inline void glMinmax(GLenum target,GLenum internalformat,GLboolean sink)const{auto const direct_ = (FunctionTable::PFNGLMINMAXPROC)this->m_functions[2379];if(direct_)return direct_(target,internalformat,sink);return this->m_rawTable->glMinmax(target,internalformat,sink);}
+inline void glColorP3ui(GLenum type,GLuint color)const{auto const direct_ = (FunctionTable::PFNGLCOLORP3UIPROC)this->m_functions[2380];if(direct_)return direct_(type,color);return this->m_rawTable->glColorP3ui(type,color);}
+inline void glPointParameterfvSGIS(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFVSGISPROC)this->m_functions[2381];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterfvSGIS(pname,params);}
+inline void glBlendEquationi(GLuint buf,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLBLENDEQUATIONIPROC)this->m_functions[2382];if(direct_)return direct_(buf,mode);return this->m_rawTable->glBlendEquationi(buf,mode);}
+inline void glGetFogFuncSGIS(GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLGETFOGFUNCSGISPROC)this->m_functions[2383];if(direct_)return direct_(points);return this->m_rawTable->glGetFogFuncSGIS(points);}
+inline void glVertexAttrib4fvNV(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FVNVPROC)this->m_functions[2384];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4fvNV(index,v);}
+inline void glGetnMinmax(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{auto const direct_ = (FunctionTable::PFNGLGETNMINMAXPROC)this->m_functions[2385];if(direct_)return direct_(target,reset,format,type,bufSize,values);return this->m_rawTable->glGetnMinmax(target,reset,format,type,bufSize,values);}
+inline void glFragmentLightiSGIX(GLenum light,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTISGIXPROC)this->m_functions[2386];if(direct_)return direct_(light,pname,param);return this->m_rawTable->glFragmentLightiSGIX(light,pname,param);}
+inline void glMultiTexCoord1bvOES(GLenum texture,const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD1BVOESPROC)this->m_functions[2387];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord1bvOES(texture,coords);}
+inline void glSecondaryColorPointerEXT(GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLORPOINTEREXTPROC)this->m_functions[2388];if(direct_)return direct_(size,type,stride,pointer);return this->m_rawTable->glSecondaryColorPointerEXT(size,type,stride,pointer);}
+inline void glMultiTexCoordP4uiv(GLenum texture,GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORDP4UIVPROC)this->m_functions[2389];if(direct_)return direct_(texture,type,coords);return this->m_rawTable->glMultiTexCoordP4uiv(texture,type,coords);}
+inline void glGetBufferSubDataARB(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERSUBDATAARBPROC)this->m_functions[2390];if(direct_)return direct_(target,offset,size,data);return this->m_rawTable->glGetBufferSubDataARB(target,offset,size,data);}
+inline void glSecondaryColor3hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3HNVPROC)this->m_functions[2391];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3hNV(red,green,blue);}
+inline void glGetPathParameterivNV(GLuint path,GLenum pname,GLint* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHPARAMETERIVNVPROC)this->m_functions[2392];if(direct_)return direct_(path,pname,value);return this->m_rawTable->glGetPathParameterivNV(path,pname,value);}
+inline void glFlushRasterSGIX()const{auto const direct_ = (FunctionTable::PFNGLFLUSHRASTERSGIXPROC)this->m_functions[2393];if(direct_)return direct_();return this->m_rawTable->glFlushRasterSGIX();}
+inline void glElementPointerATI(GLenum type,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLELEMENTPOINTERATIPROC)this->m_functions[2394];if(direct_)return direct_(type,pointer);return this->m_rawTable->glElementPointerATI(type,pointer);}
+inline void glGetAttachedObjectsARB(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj)const{auto const direct_ = (FunctionTable::PFNGLGETATTACHEDOBJECTSARBPROC)this->m_functions[2395];if(direct_)return direct_(containerObj,maxCount,count,obj);return this->m_rawTable->glGetAttachedObjectsARB(containerObj,maxCount,count,obj);}
+inline void glUniform4iv(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4IVPROC)this->m_functions[2396];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4iv(location,count,value);}
+inline void glFogxOES(GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLFOGXOESPROC)this->m_functions[2397];if(direct_)return direct_(pname,param);return this->m_rawTable->glFogxOES(pname,param);}
+inline void glSharpenTexFuncSGIS(GLenum target,GLsizei n,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLSHARPENTEXFUNCSGISPROC)this->m_functions[2398];if(direct_)return direct_(target,n,points);return this->m_rawTable->glSharpenTexFuncSGIS(target,n,points);}
+inline void glClearDepthfOES(GLclampf depth)const{auto const direct_ = (FunctionTable::PFNGLCLEARDEPTHFOESPROC)this->m_functions[2399];if(direct_)return direct_(depth);return this->m_rawTable->glClearDepthfOES(depth);}
+inline void glDeleteCommandListsNV(GLsizei n,const GLuint* lists)const{auto const direct_ = (FunctionTable::PFNGLDELETECOMMANDLISTSNVPROC)this->m_functions[2400];if(direct_)return direct_(n,lists);return this->m_rawTable->glDeleteCommandListsNV(n,lists);}
+inline void glSpecializeShader(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{auto const direct_ = (FunctionTable::PFNGLSPECIALIZESHADERPROC)this->m_functions[2401];if(direct_)return direct_(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);return this->m_rawTable->glSpecializeShader(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+inline void glVertex4hNV(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4HNVPROC)this->m_functions[2402];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4hNV(x,y,z,w);}
+inline void glSecondaryColor3dvEXT(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3DVEXTPROC)this->m_functions[2403];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3dvEXT(v);}
+inline void glGenTextures(GLsizei n,GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLGENTEXTURESPROC)this->m_functions[2404];if(direct_)return direct_(n,textures);return this->m_rawTable->glGenTextures(n,textures);}
+inline void glTextureStorage2DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)this->m_functions[2405];if(direct_)return direct_(texture,samples,internalformat,width,height,fixedsamplelocations);return this->m_rawTable->glTextureStorage2DMultisample(texture,samples,internalformat,width,height,fixedsamplelocations);}
+inline void glUniform3ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UI64VNVPROC)this->m_functions[2406];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3ui64vNV(location,count,value);}
+inline void glBlendFuncSeparateIndexedAMD(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)this->m_functions[2407];if(direct_)return direct_(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);return this->m_rawTable->glBlendFuncSeparateIndexedAMD(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+inline void glMakeBufferResidentNV(GLenum target,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAKEBUFFERRESIDENTNVPROC)this->m_functions[2408];if(direct_)return direct_(target,access);return this->m_rawTable->glMakeBufferResidentNV(target,access);}
+inline void glShaderOp2EXT(GLenum op,GLuint res,GLuint arg1,GLuint arg2)const{auto const direct_ = (FunctionTable::PFNGLSHADEROP2EXTPROC)this->m_functions[2409];if(direct_)return direct_(op,res,arg1,arg2);return this->m_rawTable->glShaderOp2EXT(op,res,arg1,arg2);}
+inline void glGetVertexAttribivNV(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIVNVPROC)this->m_functions[2410];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribivNV(index,pname,params);}
+inline void glTexParameterIivEXT(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIIVEXTPROC)this->m_functions[2411];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterIivEXT(target,pname,params);}
+inline void glGetPerfQueryDataINTEL(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten)const{auto const direct_ = (FunctionTable::PFNGLGETPERFQUERYDATAINTELPROC)this->m_functions[2412];if(direct_)return direct_(queryHandle,flags,dataSize,data,bytesWritten);return this->m_rawTable->glGetPerfQueryDataINTEL(queryHandle,flags,dataSize,data,bytesWritten);}
+inline void glVertexAttrib4dvARB(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DVARBPROC)this->m_functions[2413];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4dvARB(index,v);}
+inline void glTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE1DEXTPROC)this->m_functions[2414];if(direct_)return direct_(texture,target,level,xoffset,width,format,type,pixels);return this->m_rawTable->glTextureSubImage1DEXT(texture,target,level,xoffset,width,format,type,pixels);}
+inline void glGetActiveUniformBlockName(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)this->m_functions[2415];if(direct_)return direct_(program,uniformBlockIndex,bufSize,length,uniformBlockName);return this->m_rawTable->glGetActiveUniformBlockName(program,uniformBlockIndex,bufSize,length,uniformBlockName);}
+inline void glVertexAttrib2dvARB(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DVARBPROC)this->m_functions[2416];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib2dvARB(index,v);}
+inline void glVertexAttribPointer(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBPOINTERPROC)this->m_functions[2417];if(direct_)return direct_(index,size,type,normalized,stride,pointer);return this->m_rawTable->glVertexAttribPointer(index,size,type,normalized,stride,pointer);}
+inline void glDepthBoundsdNV(GLdouble zmin,GLdouble zmax)const{auto const direct_ = (FunctionTable::PFNGLDEPTHBOUNDSDNVPROC)this->m_functions[2418];if(direct_)return direct_(zmin,zmax);return this->m_rawTable->glDepthBoundsdNV(zmin,zmax);}
+inline void glDeleteTexturesEXT(GLsizei n,const GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLDELETETEXTURESEXTPROC)this->m_functions[2419];if(direct_)return direct_(n,textures);return this->m_rawTable->glDeleteTexturesEXT(n,textures);}
+inline void glDrawBuffersATI(GLsizei n,const GLenum* bufs)const{auto const direct_ = (FunctionTable::PFNGLDRAWBUFFERSATIPROC)this->m_functions[2420];if(direct_)return direct_(n,bufs);return this->m_rawTable->glDrawBuffersATI(n,bufs);}
+inline void glLightModelxvOES(GLenum pname,const GLfixed* param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELXVOESPROC)this->m_functions[2421];if(direct_)return direct_(pname,param);return this->m_rawTable->glLightModelxvOES(pname,param);}
+inline void glApplyTextureEXT(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLAPPLYTEXTUREEXTPROC)this->m_functions[2422];if(direct_)return direct_(mode);return this->m_rawTable->glApplyTextureEXT(mode);}
+inline GLuint64 glGetImageHandleNV(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{auto const direct_ = (FunctionTable::PFNGLGETIMAGEHANDLENVPROC)this->m_functions[2423];if(direct_)return direct_(texture,level,layered,layer,format);return this->m_rawTable->glGetImageHandleNV(texture,level,layered,layer,format);}
+inline void glGetMinmax(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values)const{auto const direct_ = (FunctionTable::PFNGLGETMINMAXPROC)this->m_functions[2424];if(direct_)return direct_(target,reset,format,types,values);return this->m_rawTable->glGetMinmax(target,reset,format,types,values);}
+inline void glGetFixedvOES(GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETFIXEDVOESPROC)this->m_functions[2425];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetFixedvOES(pname,params);}
+inline void glSamplePatternEXT(GLenum pattern)const{auto const direct_ = (FunctionTable::PFNGLSAMPLEPATTERNEXTPROC)this->m_functions[2426];if(direct_)return direct_(pattern);return this->m_rawTable->glSamplePatternEXT(pattern);}
+inline void glUniform1f(GLint location,GLfloat v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1FPROC)this->m_functions[2427];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1f(location,v0);}
+inline void glColor4fNormal3fVertex3fSUN(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_functions[2428];if(direct_)return direct_(r,g,b,a,nx,ny,nz,x,y,z);return this->m_rawTable->glColor4fNormal3fVertex3fSUN(r,g,b,a,nx,ny,nz,x,y,z);}
+inline void glFogCoorddvEXT(const GLdouble* coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDDVEXTPROC)this->m_functions[2429];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoorddvEXT(coord);}
+inline void glCopyTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTUREIMAGE1DEXTPROC)this->m_functions[2430];if(direct_)return direct_(texture,target,level,internalformat,x,y,width,border);return this->m_rawTable->glCopyTextureImage1DEXT(texture,target,level,internalformat,x,y,width,border);}
+inline void glFlushMappedBufferRangeAPPLE(GLenum target,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)this->m_functions[2431];if(direct_)return direct_(target,offset,size);return this->m_rawTable->glFlushMappedBufferRangeAPPLE(target,offset,size);}
+inline void glVertex3sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX3SVPROC)this->m_functions[2432];if(direct_)return direct_(v);return this->m_rawTable->glVertex3sv(v);}
+inline void glFlushStaticDataIBM(GLenum target)const{auto const direct_ = (FunctionTable::PFNGLFLUSHSTATICDATAIBMPROC)this->m_functions[2433];if(direct_)return direct_(target);return this->m_rawTable->glFlushStaticDataIBM(target);}
+inline void glProgramUniform4ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UI64NVPROC)this->m_functions[2434];if(direct_)return direct_(program,location,x,y,z,w);return this->m_rawTable->glProgramUniform4ui64NV(program,location,x,y,z,w);}
+inline void glRasterPos4xOES(GLfixed x,GLfixed y,GLfixed z,GLfixed w)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4XOESPROC)this->m_functions[2435];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glRasterPos4xOES(x,y,z,w);}
+inline void glVertexAttribP1ui(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP1UIPROC)this->m_functions[2436];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP1ui(index,type,normalized,value);}
+inline void glProgramUniform4dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4DVEXTPROC)this->m_functions[2437];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4dvEXT(program,location,count,value);}
+inline void glEndTransformFeedbackEXT()const{auto const direct_ = (FunctionTable::PFNGLENDTRANSFORMFEEDBACKEXTPROC)this->m_functions[2438];if(direct_)return direct_();return this->m_rawTable->glEndTransformFeedbackEXT();}
+inline void glBinormal3dEXT(GLdouble bx,GLdouble by,GLdouble bz)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3DEXTPROC)this->m_functions[2439];if(direct_)return direct_(bx,by,bz);return this->m_rawTable->glBinormal3dEXT(bx,by,bz);}
+inline void glGetTextureSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTURESUBIMAGEPROC)this->m_functions[2440];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);return this->m_rawTable->glGetTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);}
+inline void glGetNamedRenderbufferParameteriv(GLuint renderbuffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)this->m_functions[2441];if(direct_)return direct_(renderbuffer,pname,params);return this->m_rawTable->glGetNamedRenderbufferParameteriv(renderbuffer,pname,params);}
+inline void glBindBuffersRange(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERSRANGEPROC)this->m_functions[2442];if(direct_)return direct_(target,first,count,buffers,offsets,sizes);return this->m_rawTable->glBindBuffersRange(target,first,count,buffers,offsets,sizes);}
+inline GLint glFinishAsyncSGIX(GLuint* markerp)const{auto const direct_ = (FunctionTable::PFNGLFINISHASYNCSGIXPROC)this->m_functions[2443];if(direct_)return direct_(markerp);return this->m_rawTable->glFinishAsyncSGIX(markerp);}
+inline void glBindFragDataLocationIndexed(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)this->m_functions[2444];if(direct_)return direct_(program,colorNumber,index,name);return this->m_rawTable->glBindFragDataLocationIndexed(program,colorNumber,index,name);}
+inline void glMultiTexCoord2dv(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2DVPROC)this->m_functions[2445];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2dv(target,v);}
+inline void glUniform2iv(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2IVPROC)this->m_functions[2446];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2iv(location,count,value);}
+inline void glProgramUniform2i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2I64VNVPROC)this->m_functions[2447];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2i64vNV(program,location,count,value);}
+inline void glFlushVertexArrayRangeAPPLE(GLsizei length,void* pointer)const{auto const direct_ = (FunctionTable::PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)this->m_functions[2448];if(direct_)return direct_(length,pointer);return this->m_rawTable->glFlushVertexArrayRangeAPPLE(length,pointer);}
+inline void glTextureParameterf(GLuint texture,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERFPROC)this->m_functions[2449];if(direct_)return direct_(texture,pname,param);return this->m_rawTable->glTextureParameterf(texture,pname,param);}
+inline void glMultiTexCoord3dvARB(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3DVARBPROC)this->m_functions[2450];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3dvARB(target,v);}
+inline void glFeedbackBuffer(GLsizei size,GLenum type,GLfloat* buffer)const{auto const direct_ = (FunctionTable::PFNGLFEEDBACKBUFFERPROC)this->m_functions[2451];if(direct_)return direct_(size,type,buffer);return this->m_rawTable->glFeedbackBuffer(size,type,buffer);}
+inline void glDebugMessageInsertARB(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGEINSERTARBPROC)this->m_functions[2452];if(direct_)return direct_(source,type,id,severity,length,buf);return this->m_rawTable->glDebugMessageInsertARB(source,type,id,severity,length,buf);}
+inline void glMultiTexCoord2i(GLenum target,GLint s,GLint t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2IPROC)this->m_functions[2453];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2i(target,s,t);}
+inline void glTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE3DPROC)this->m_functions[2454];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);return this->m_rawTable->glTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+inline void glFramebufferTexture1D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE1DPROC)this->m_functions[2455];if(direct_)return direct_(target,attachment,textarget,texture,level);return this->m_rawTable->glFramebufferTexture1D(target,attachment,textarget,texture,level);}
+inline void glGetShaderiv(GLuint shader,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETSHADERIVPROC)this->m_functions[2456];if(direct_)return direct_(shader,pname,params);return this->m_rawTable->glGetShaderiv(shader,pname,params);}
+inline void glMultiTexCoord2d(GLenum target,GLdouble s,GLdouble t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2DPROC)this->m_functions[2457];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2d(target,s,t);}
+inline void glArrayObjectATI(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{auto const direct_ = (FunctionTable::PFNGLARRAYOBJECTATIPROC)this->m_functions[2458];if(direct_)return direct_(array,size,type,stride,buffer,offset);return this->m_rawTable->glArrayObjectATI(array,size,type,stride,buffer,offset);}
+inline void glGetPointeri_vEXT(GLenum pname,GLuint index,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETPOINTERI_VEXTPROC)this->m_functions[2459];if(direct_)return direct_(pname,index,params);return this->m_rawTable->glGetPointeri_vEXT(pname,index,params);}
+inline void glGetPerfMonitorCountersAMD(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORCOUNTERSAMDPROC)this->m_functions[2460];if(direct_)return direct_(group,numCounters,maxActiveCounters,counterSize,counters);return this->m_rawTable->glGetPerfMonitorCountersAMD(group,numCounters,maxActiveCounters,counterSize,counters);}
+inline void glNamedBufferStorage(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSTORAGEPROC)this->m_functions[2461];if(direct_)return direct_(buffer,size,data,flags);return this->m_rawTable->glNamedBufferStorage(buffer,size,data,flags);}
+inline void glTexEnvxvOES(GLenum target,GLenum pname,const GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLTEXENVXVOESPROC)this->m_functions[2462];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexEnvxvOES(target,pname,params);}
+inline void glProgramUniform2ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UI64NVPROC)this->m_functions[2463];if(direct_)return direct_(program,location,x,y);return this->m_rawTable->glProgramUniform2ui64NV(program,location,x,y);}
+inline void glMultiTexCoord3bOES(GLenum texture,GLbyte s,GLbyte t,GLbyte r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3BOESPROC)this->m_functions[2464];if(direct_)return direct_(texture,s,t,r);return this->m_rawTable->glMultiTexCoord3bOES(texture,s,t,r);}
+inline void glUniform1dv(GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1DVPROC)this->m_functions[2465];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1dv(location,count,value);}
+inline void glPixelTransferi(GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFERIPROC)this->m_functions[2466];if(direct_)return direct_(pname,param);return this->m_rawTable->glPixelTransferi(pname,param);}
+inline void glSecondaryColor3usvEXT(const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3USVEXTPROC)this->m_functions[2467];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3usvEXT(v);}
+inline void glProgramEnvParameterI4uivNV(GLenum target,GLuint index,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETERI4UIVNVPROC)this->m_functions[2468];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramEnvParameterI4uivNV(target,index,params);}
+inline void glVertex2sv(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2SVPROC)this->m_functions[2469];if(direct_)return direct_(v);return this->m_rawTable->glVertex2sv(v);}
+inline void glWindowPos4dMESA(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4DMESAPROC)this->m_functions[2470];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glWindowPos4dMESA(x,y,z,w);}
+inline void glDebugMessageControlARB(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGECONTROLARBPROC)this->m_functions[2471];if(direct_)return direct_(source,type,severity,count,ids,enabled);return this->m_rawTable->glDebugMessageControlARB(source,type,severity,count,ids,enabled);}
+inline GLboolean glIsTextureEXT(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLISTEXTUREEXTPROC)this->m_functions[2472];if(direct_)return direct_(texture);return this->m_rawTable->glIsTextureEXT(texture);}
+inline void glFragmentMaterialivSGIX(GLenum face,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTMATERIALIVSGIXPROC)this->m_functions[2473];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glFragmentMaterialivSGIX(face,pname,params);}
+inline void glLinkProgramARB(GLhandleARB programObj)const{auto const direct_ = (FunctionTable::PFNGLLINKPROGRAMARBPROC)this->m_functions[2474];if(direct_)return direct_(programObj);return this->m_rawTable->glLinkProgramARB(programObj);}
+inline void glFinishFenceAPPLE(GLuint fence)const{auto const direct_ = (FunctionTable::PFNGLFINISHFENCEAPPLEPROC)this->m_functions[2475];if(direct_)return direct_(fence);return this->m_rawTable->glFinishFenceAPPLE(fence);}
+inline void glVertexArrayVertexAttribBindingEXT(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)this->m_functions[2476];if(direct_)return direct_(vaobj,attribindex,bindingindex);return this->m_rawTable->glVertexArrayVertexAttribBindingEXT(vaobj,attribindex,bindingindex);}
+inline void glTexStorageMem3DMultisampleEXT(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)this->m_functions[2477];if(direct_)return direct_(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);return this->m_rawTable->glTexStorageMem3DMultisampleEXT(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+inline void glUniform1ui64vARB(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1UI64VARBPROC)this->m_functions[2478];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1ui64vARB(location,count,value);}
+inline void glMultiTexCoord4fv(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4FVPROC)this->m_functions[2479];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4fv(target,v);}
+inline void glMulticastFramebufferSampleLocationsfvNV(GLuint gpu,GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)this->m_functions[2480];if(direct_)return direct_(gpu,framebuffer,start,count,v);return this->m_rawTable->glMulticastFramebufferSampleLocationsfvNV(gpu,framebuffer,start,count,v);}
+inline void glRasterPos3d(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3DPROC)this->m_functions[2481];if(direct_)return direct_(x,y,z);return this->m_rawTable->glRasterPos3d(x,y,z);}
+inline GLint glPollAsyncSGIX(GLuint* markerp)const{auto const direct_ = (FunctionTable::PFNGLPOLLASYNCSGIXPROC)this->m_functions[2482];if(direct_)return direct_(markerp);return this->m_rawTable->glPollAsyncSGIX(markerp);}
+inline void glRasterPos3f(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3FPROC)this->m_functions[2483];if(direct_)return direct_(x,y,z);return this->m_rawTable->glRasterPos3f(x,y,z);}
+inline void glCompressedTexImage3D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXIMAGE3DPROC)this->m_functions[2484];if(direct_)return direct_(target,level,internalformat,width,height,depth,border,imageSize,data);return this->m_rawTable->glCompressedTexImage3D(target,level,internalformat,width,height,depth,border,imageSize,data);}
+inline void glVariantivEXT(GLuint id,const GLint* addr)const{auto const direct_ = (FunctionTable::PFNGLVARIANTIVEXTPROC)this->m_functions[2485];if(direct_)return direct_(id,addr);return this->m_rawTable->glVariantivEXT(id,addr);}
+inline void glUnmapTexture2DINTEL(GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLUNMAPTEXTURE2DINTELPROC)this->m_functions[2486];if(direct_)return direct_(texture,level);return this->m_rawTable->glUnmapTexture2DINTEL(texture,level);}
+inline void glMulticastWaitSyncNV(GLuint signalGpu,GLbitfield waitGpuMask)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTWAITSYNCNVPROC)this->m_functions[2487];if(direct_)return direct_(signalGpu,waitGpuMask);return this->m_rawTable->glMulticastWaitSyncNV(signalGpu,waitGpuMask);}
+inline void glGetVertexAttribiv(GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIVPROC)this->m_functions[2488];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribiv(index,pname,params);}
+inline void glGetPathCoordsNV(GLuint path,GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLGETPATHCOORDSNVPROC)this->m_functions[2489];if(direct_)return direct_(path,coords);return this->m_rawTable->glGetPathCoordsNV(path,coords);}
+inline void glColor4xvOES(const GLfixed* components)const{auto const direct_ = (FunctionTable::PFNGLCOLOR4XVOESPROC)this->m_functions[2490];if(direct_)return direct_(components);return this->m_rawTable->glColor4xvOES(components);}
+inline void glVertexAttrib3fv(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3FVPROC)this->m_functions[2491];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3fv(index,v);}
+inline void glRasterPos3s(GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS3SPROC)this->m_functions[2492];if(direct_)return direct_(x,y,z);return this->m_rawTable->glRasterPos3s(x,y,z);}
+inline void glVertex4bOES(GLbyte x,GLbyte y,GLbyte z,GLbyte w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4BOESPROC)this->m_functions[2493];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4bOES(x,y,z,w);}
+inline void glTransformFeedbackVaryingsEXT(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)this->m_functions[2494];if(direct_)return direct_(program,count,varyings,bufferMode);return this->m_rawTable->glTransformFeedbackVaryingsEXT(program,count,varyings,bufferMode);}
+inline void glCombinerOutputNV(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum)const{auto const direct_ = (FunctionTable::PFNGLCOMBINEROUTPUTNVPROC)this->m_functions[2495];if(direct_)return direct_(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);return this->m_rawTable->glCombinerOutputNV(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);}
+inline void glWindowPos4sMESA(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4SMESAPROC)this->m_functions[2496];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glWindowPos4sMESA(x,y,z,w);}
+inline void glVertexAttrib4svARB(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4SVARBPROC)this->m_functions[2497];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4svARB(index,v);}
+inline GLboolean glIsList(GLuint list)const{auto const direct_ = (FunctionTable::PFNGLISLISTPROC)this->m_functions[2498];if(direct_)return direct_(list);return this->m_rawTable->glIsList(list);}
+inline void glGetInfoLogARB(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog)const{auto const direct_ = (FunctionTable::PFNGLGETINFOLOGARBPROC)this->m_functions[2499];if(direct_)return direct_(obj,maxLength,length,infoLog);return this->m_rawTable->glGetInfoLogARB(obj,maxLength,length,infoLog);}
+inline void glUniformMatrix2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX2FVPROC)this->m_functions[2500];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix2fv(location,count,transpose,value);}
+inline void glVertexAttribs3dvNV(GLuint index,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS3DVNVPROC)this->m_functions[2501];if(direct_)return direct_(index,count,v);return this->m_rawTable->glVertexAttribs3dvNV(index,count,v);}
+inline void glGlobalAlphaFactorsSUN(GLshort factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORSSUNPROC)this->m_functions[2502];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactorsSUN(factor);}
+inline void glGetTrackMatrixivNV(GLenum target,GLuint address,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTRACKMATRIXIVNVPROC)this->m_functions[2503];if(direct_)return direct_(target,address,pname,params);return this->m_rawTable->glGetTrackMatrixivNV(target,address,pname,params);}
+inline void glTextureParameterfvEXT(GLuint texture,GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERFVEXTPROC)this->m_functions[2504];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glTextureParameterfvEXT(texture,target,pname,params);}
+inline GLboolean glIsNamedBufferResidentNV(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLISNAMEDBUFFERRESIDENTNVPROC)this->m_functions[2505];if(direct_)return direct_(buffer);return this->m_rawTable->glIsNamedBufferResidentNV(buffer);}
+inline void glProgramUniform4ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UI64VARBPROC)this->m_functions[2506];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4ui64vARB(program,location,count,value);}
+inline void glTbufferMask3DFX(GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLTBUFFERMASK3DFXPROC)this->m_functions[2507];if(direct_)return direct_(mask);return this->m_rawTable->glTbufferMask3DFX(mask);}
+inline void glCoverFillPathNV(GLuint path,GLenum coverMode)const{auto const direct_ = (FunctionTable::PFNGLCOVERFILLPATHNVPROC)this->m_functions[2508];if(direct_)return direct_(path,coverMode);return this->m_rawTable->glCoverFillPathNV(path,coverMode);}
+inline void glVertexAttrib1fvARB(GLuint index,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1FVARBPROC)this->m_functions[2509];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib1fvARB(index,v);}
+inline void glGenerateTextureMipmap(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLGENERATETEXTUREMIPMAPPROC)this->m_functions[2510];if(direct_)return direct_(texture);return this->m_rawTable->glGenerateTextureMipmap(texture);}
+inline void glNamedProgramLocalParameterI4uivEXT(GLuint program,GLenum target,GLuint index,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)this->m_functions[2511];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glNamedProgramLocalParameterI4uivEXT(program,target,index,params);}
+inline void glMultiDrawElementsBaseVertex(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)this->m_functions[2512];if(direct_)return direct_(mode,count,type,indices,drawcount,basevertex);return this->m_rawTable->glMultiDrawElementsBaseVertex(mode,count,type,indices,drawcount,basevertex);}
+inline void glProgramSubroutineParametersuivNV(GLenum target,GLsizei count,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)this->m_functions[2513];if(direct_)return direct_(target,count,params);return this->m_rawTable->glProgramSubroutineParametersuivNV(target,count,params);}
+inline void glProgramUniformMatrix2x4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)this->m_functions[2514];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2x4dvEXT(program,location,count,transpose,value);}
+inline void glRotatexOES(GLfixed angle,GLfixed x,GLfixed y,GLfixed z)const{auto const direct_ = (FunctionTable::PFNGLROTATEXOESPROC)this->m_functions[2515];if(direct_)return direct_(angle,x,y,z);return this->m_rawTable->glRotatexOES(angle,x,y,z);}
+inline void glMemoryBarrierEXT(GLbitfield barriers)const{auto const direct_ = (FunctionTable::PFNGLMEMORYBARRIEREXTPROC)this->m_functions[2516];if(direct_)return direct_(barriers);return this->m_rawTable->glMemoryBarrierEXT(barriers);}
+inline void glVertexAttrib3svNV(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SVNVPROC)this->m_functions[2517];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3svNV(index,v);}
+inline void glVertexStream3iATI(GLenum stream,GLint x,GLint y,GLint z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3IATIPROC)this->m_functions[2518];if(direct_)return direct_(stream,x,y,z);return this->m_rawTable->glVertexStream3iATI(stream,x,y,z);}
+inline void glCompressedTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)this->m_functions[2519];if(direct_)return direct_(target,level,xoffset,width,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage1D(target,level,xoffset,width,format,imageSize,data);}
+inline void glSetFenceNV(GLuint fence,GLenum condition)const{auto const direct_ = (FunctionTable::PFNGLSETFENCENVPROC)this->m_functions[2520];if(direct_)return direct_(fence,condition);return this->m_rawTable->glSetFenceNV(fence,condition);}
+inline void glAttachObjectARB(GLhandleARB containerObj,GLhandleARB obj)const{auto const direct_ = (FunctionTable::PFNGLATTACHOBJECTARBPROC)this->m_functions[2521];if(direct_)return direct_(containerObj,obj);return this->m_rawTable->glAttachObjectARB(containerObj,obj);}
+inline void glCopyConvolutionFilter1D(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCONVOLUTIONFILTER1DPROC)this->m_functions[2522];if(direct_)return direct_(target,internalformat,x,y,width);return this->m_rawTable->glCopyConvolutionFilter1D(target,internalformat,x,y,width);}
+inline void glTexStorageMem2DMultisampleEXT(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)this->m_functions[2523];if(direct_)return direct_(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);return this->m_rawTable->glTexStorageMem2DMultisampleEXT(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+inline void glProgramParameters4fvNV(GLenum target,GLuint index,GLsizei count,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETERS4FVNVPROC)this->m_functions[2524];if(direct_)return direct_(target,index,count,v);return this->m_rawTable->glProgramParameters4fvNV(target,index,count,v);}
+inline void glNamedFramebufferParameteriEXT(GLuint framebuffer,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)this->m_functions[2525];if(direct_)return direct_(framebuffer,pname,param);return this->m_rawTable->glNamedFramebufferParameteriEXT(framebuffer,pname,param);}
+inline void glVertexAttrib4Nsv(GLuint index,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4NSVPROC)this->m_functions[2526];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4Nsv(index,v);}
+inline void glVertexAttribI4usvEXT(GLuint index,const GLushort* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4USVEXTPROC)this->m_functions[2527];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4usvEXT(index,v);}
+inline void glTextureBufferRangeEXT(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREBUFFERRANGEEXTPROC)this->m_functions[2528];if(direct_)return direct_(texture,target,internalformat,buffer,offset,size);return this->m_rawTable->glTextureBufferRangeEXT(texture,target,internalformat,buffer,offset,size);}
+inline void glVertexP3uiv(GLenum type,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXP3UIVPROC)this->m_functions[2529];if(direct_)return direct_(type,value);return this->m_rawTable->glVertexP3uiv(type,value);}
+inline GLboolean glIsPathNV(GLuint path)const{auto const direct_ = (FunctionTable::PFNGLISPATHNVPROC)this->m_functions[2530];if(direct_)return direct_(path);return this->m_rawTable->glIsPathNV(path);}
+inline void glGetnUniformi64vARB(GLuint program,GLint location,GLsizei bufSize,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETNUNIFORMI64VARBPROC)this->m_functions[2531];if(direct_)return direct_(program,location,bufSize,params);return this->m_rawTable->glGetnUniformi64vARB(program,location,bufSize,params);}
+inline void glFramebufferTextureMultiviewOVR(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)this->m_functions[2532];if(direct_)return direct_(target,attachment,texture,level,baseViewIndex,numViews);return this->m_rawTable->glFramebufferTextureMultiviewOVR(target,attachment,texture,level,baseViewIndex,numViews);}
+inline void glCompressedMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)this->m_functions[2533];if(direct_)return direct_(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);return this->m_rawTable->glCompressedMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+inline void glGetnMapdv(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLGETNMAPDVPROC)this->m_functions[2534];if(direct_)return direct_(target,query,bufSize,v);return this->m_rawTable->glGetnMapdv(target,query,bufSize,v);}
+inline void glDebugMessageCallback(GLDEBUGPROC callback,const void* userParam)const{auto const direct_ = (FunctionTable::PFNGLDEBUGMESSAGECALLBACKPROC)this->m_functions[2535];if(direct_)return direct_(callback,userParam);return this->m_rawTable->glDebugMessageCallback(callback,userParam);}
+inline void glTangent3svEXT(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3SVEXTPROC)this->m_functions[2536];if(direct_)return direct_(v);return this->m_rawTable->glTangent3svEXT(v);}
+inline void glVertexAttribParameteriAMD(GLuint index,GLenum pname,GLint param)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBPARAMETERIAMDPROC)this->m_functions[2537];if(direct_)return direct_(index,pname,param);return this->m_rawTable->glVertexAttribParameteriAMD(index,pname,param);}
+inline void glBufferSubDataARB(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data)const{auto const direct_ = (FunctionTable::PFNGLBUFFERSUBDATAARBPROC)this->m_functions[2538];if(direct_)return direct_(target,offset,size,data);return this->m_rawTable->glBufferSubDataARB(target,offset,size,data);}
+inline void glGetVertexAttribLui64vARB(GLuint index,GLenum pname,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBLUI64VARBPROC)this->m_functions[2539];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribLui64vARB(index,pname,params);}
+inline void glVertexAttribL4ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4UI64NVPROC)this->m_functions[2540];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttribL4ui64NV(index,x,y,z,w);}
+inline void glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)this->m_functions[2541];if(direct_)return direct_(rc,r,g,b,a,x,y,z);return this->m_rawTable->glReplacementCodeuiColor4ubVertex3fSUN(rc,r,g,b,a,x,y,z);}
+inline void glImageTransformParameterfHP(GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLIMAGETRANSFORMPARAMETERFHPPROC)this->m_functions[2542];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glImageTransformParameterfHP(target,pname,param);}
+inline void glMap1f(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLMAP1FPROC)this->m_functions[2543];if(direct_)return direct_(target,u1,u2,stride,order,points);return this->m_rawTable->glMap1f(target,u1,u2,stride,order,points);}
+inline void glRasterPos4fv(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4FVPROC)this->m_functions[2544];if(direct_)return direct_(v);return this->m_rawTable->glRasterPos4fv(v);}
+inline void glVertex2bvOES(const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2BVOESPROC)this->m_functions[2545];if(direct_)return direct_(coords);return this->m_rawTable->glVertex2bvOES(coords);}
+inline void glGetMapControlPointsNV(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points)const{auto const direct_ = (FunctionTable::PFNGLGETMAPCONTROLPOINTSNVPROC)this->m_functions[2546];if(direct_)return direct_(target,index,type,ustride,vstride,packed,points);return this->m_rawTable->glGetMapControlPointsNV(target,index,type,ustride,vstride,packed,points);}
+inline void glNamedProgramLocalParametersI4ivEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)this->m_functions[2547];if(direct_)return direct_(program,target,index,count,params);return this->m_rawTable->glNamedProgramLocalParametersI4ivEXT(program,target,index,count,params);}
+inline void glBindBufferRangeNV(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERRANGENVPROC)this->m_functions[2548];if(direct_)return direct_(target,index,buffer,offset,size);return this->m_rawTable->glBindBufferRangeNV(target,index,buffer,offset,size);}
+inline void glVertexStream3dvATI(GLenum stream,const GLdouble* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3DVATIPROC)this->m_functions[2549];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream3dvATI(stream,coords);}
+inline void glNormalPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{auto const direct_ = (FunctionTable::PFNGLNORMALPOINTERLISTIBMPROC)this->m_functions[2550];if(direct_)return direct_(type,stride,pointer,ptrstride);return this->m_rawTable->glNormalPointerListIBM(type,stride,pointer,ptrstride);}
+inline void glFogFuncSGIS(GLsizei n,const GLfloat* points)const{auto const direct_ = (FunctionTable::PFNGLFOGFUNCSGISPROC)this->m_functions[2551];if(direct_)return direct_(n,points);return this->m_rawTable->glFogFuncSGIS(n,points);}
+inline void glMultiModeDrawArraysIBM(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride)const{auto const direct_ = (FunctionTable::PFNGLMULTIMODEDRAWARRAYSIBMPROC)this->m_functions[2552];if(direct_)return direct_(mode,first,count,primcount,modestride);return this->m_rawTable->glMultiModeDrawArraysIBM(mode,first,count,primcount,modestride);}
+inline void glGetNamedFramebufferAttachmentParameterivEXT(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)this->m_functions[2553];if(direct_)return direct_(framebuffer,attachment,pname,params);return this->m_rawTable->glGetNamedFramebufferAttachmentParameterivEXT(framebuffer,attachment,pname,params);}
+inline void glGetFloatv(GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETFLOATVPROC)this->m_functions[2554];if(direct_)return direct_(pname,params);return this->m_rawTable->glGetFloatv(pname,params);}
+inline void glVertexArrayVertexAttribIFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)this->m_functions[2555];if(direct_)return direct_(vaobj,attribindex,size,type,relativeoffset);return this->m_rawTable->glVertexArrayVertexAttribIFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+inline void glHint(GLenum target,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLHINTPROC)this->m_functions[2556];if(direct_)return direct_(target,mode);return this->m_rawTable->glHint(target,mode);}
+inline void glVertexStream2svATI(GLenum stream,const GLshort* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2SVATIPROC)this->m_functions[2557];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream2svATI(stream,coords);}
+inline void glMultiDrawArraysIndirect(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWARRAYSINDIRECTPROC)this->m_functions[2558];if(direct_)return direct_(mode,indirect,drawcount,stride);return this->m_rawTable->glMultiDrawArraysIndirect(mode,indirect,drawcount,stride);}
+inline void glMultiTexEnvfvEXT(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXENVFVEXTPROC)this->m_functions[2559];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexEnvfvEXT(texunit,target,pname,params);}
+inline void glVertexAttribP2uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBP2UIVPROC)this->m_functions[2560];if(direct_)return direct_(index,type,normalized,value);return this->m_rawTable->glVertexAttribP2uiv(index,type,normalized,value);}
+inline void glProgramUniform1i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1I64VARBPROC)this->m_functions[2561];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform1i64vARB(program,location,count,value);}
+inline void glFramebufferTextureARB(GLenum target,GLenum attachment,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTUREARBPROC)this->m_functions[2562];if(direct_)return direct_(target,attachment,texture,level);return this->m_rawTable->glFramebufferTextureARB(target,attachment,texture,level);}
+inline void glPushClientAttribDefaultEXT(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)this->m_functions[2563];if(direct_)return direct_(mask);return this->m_rawTable->glPushClientAttribDefaultEXT(mask);}
+inline void glScalef(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLSCALEFPROC)this->m_functions[2564];if(direct_)return direct_(x,y,z);return this->m_rawTable->glScalef(x,y,z);}
+inline void glScaled(GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLSCALEDPROC)this->m_functions[2565];if(direct_)return direct_(x,y,z);return this->m_rawTable->glScaled(x,y,z);}
+inline void glGetConvolutionParameterxvOES(GLenum target,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETCONVOLUTIONPARAMETERXVOESPROC)this->m_functions[2566];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetConvolutionParameterxvOES(target,pname,params);}
+inline void glGetProgramResourceName(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCENAMEPROC)this->m_functions[2567];if(direct_)return direct_(program,programInterface,index,bufSize,length,name);return this->m_rawTable->glGetProgramResourceName(program,programInterface,index,bufSize,length,name);}
+inline void glCopyColorTable(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCOLORTABLEPROC)this->m_functions[2568];if(direct_)return direct_(target,internalformat,x,y,width);return this->m_rawTable->glCopyColorTable(target,internalformat,x,y,width);}
+inline void glDepthRangeArrayv(GLuint first,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLDEPTHRANGEARRAYVPROC)this->m_functions[2569];if(direct_)return direct_(first,count,v);return this->m_rawTable->glDepthRangeArrayv(first,count,v);}
+inline void glCoverFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLCOVERFILLPATHINSTANCEDNVPROC)this->m_functions[2570];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);return this->m_rawTable->glCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+inline void glMultiTexParameterivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERIVEXTPROC)this->m_functions[2571];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexParameterivEXT(texunit,target,pname,params);}
+inline void glGetActiveAtomicCounterBufferiv(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)this->m_functions[2572];if(direct_)return direct_(program,bufferIndex,pname,params);return this->m_rawTable->glGetActiveAtomicCounterBufferiv(program,bufferIndex,pname,params);}
+inline void glStencilOpSeparate(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{auto const direct_ = (FunctionTable::PFNGLSTENCILOPSEPARATEPROC)this->m_functions[2573];if(direct_)return direct_(face,sfail,dpfail,dppass);return this->m_rawTable->glStencilOpSeparate(face,sfail,dpfail,dppass);}
+inline void glVertexAttrib4fNV(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4FNVPROC)this->m_functions[2574];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4fNV(index,x,y,z,w);}
+inline void glGetColorTableParameterivSGI(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERIVSGIPROC)this->m_functions[2575];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameterivSGI(target,pname,params);}
+inline void glVertexArrayAttribBinding(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYATTRIBBINDINGPROC)this->m_functions[2576];if(direct_)return direct_(vaobj,attribindex,bindingindex);return this->m_rawTable->glVertexArrayAttribBinding(vaobj,attribindex,bindingindex);}
+inline GLboolean glIsSemaphoreEXT(GLuint semaphore)const{auto const direct_ = (FunctionTable::PFNGLISSEMAPHOREEXTPROC)this->m_functions[2577];if(direct_)return direct_(semaphore);return this->m_rawTable->glIsSemaphoreEXT(semaphore);}
+inline void glProgramParameters4dvNV(GLenum target,GLuint index,GLsizei count,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMPARAMETERS4DVNVPROC)this->m_functions[2578];if(direct_)return direct_(target,index,count,v);return this->m_rawTable->glProgramParameters4dvNV(target,index,count,v);}
+inline void glVertexAttribL4dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBL4DVPROC)this->m_functions[2579];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribL4dv(index,v);}
+inline void glGetTexParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERIVPROC)this->m_functions[2580];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameteriv(target,pname,params);}
+inline GLintptr glGetUniformOffsetEXT(GLuint program,GLint location)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMOFFSETEXTPROC)this->m_functions[2581];if(direct_)return direct_(program,location);return this->m_rawTable->glGetUniformOffsetEXT(program,location);}
+inline void glGetVertexAttribPointerv(GLuint index,GLenum pname,void** pointer)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBPOINTERVPROC)this->m_functions[2582];if(direct_)return direct_(index,pname,pointer);return this->m_rawTable->glGetVertexAttribPointerv(index,pname,pointer);}
+inline void glResumeTransformFeedbackNV()const{auto const direct_ = (FunctionTable::PFNGLRESUMETRANSFORMFEEDBACKNVPROC)this->m_functions[2583];if(direct_)return direct_();return this->m_rawTable->glResumeTransformFeedbackNV();}
+inline void glProgramUniform3i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3I64VNVPROC)this->m_functions[2584];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform3i64vNV(program,location,count,value);}
+inline void glTangent3fEXT(GLfloat tx,GLfloat ty,GLfloat tz)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3FEXTPROC)this->m_functions[2585];if(direct_)return direct_(tx,ty,tz);return this->m_rawTable->glTangent3fEXT(tx,ty,tz);}
+inline void glGetPathMetricRangeNV(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics)const{auto const direct_ = (FunctionTable::PFNGLGETPATHMETRICRANGENVPROC)this->m_functions[2586];if(direct_)return direct_(metricQueryMask,firstPathName,numPaths,stride,metrics);return this->m_rawTable->glGetPathMetricRangeNV(metricQueryMask,firstPathName,numPaths,stride,metrics);}
+inline void glWindowPos2iMESA(GLint x,GLint y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2IMESAPROC)this->m_functions[2587];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2iMESA(x,y);}
+inline void glVertex2xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2XVOESPROC)this->m_functions[2588];if(direct_)return direct_(coords);return this->m_rawTable->glVertex2xvOES(coords);}
+inline void glGetnCompressedTexImage(GLenum target,GLint lod,GLsizei bufSize,void* pixels)const{auto const direct_ = (FunctionTable::PFNGLGETNCOMPRESSEDTEXIMAGEPROC)this->m_functions[2589];if(direct_)return direct_(target,lod,bufSize,pixels);return this->m_rawTable->glGetnCompressedTexImage(target,lod,bufSize,pixels);}
+inline void glWindowPos2dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2DVPROC)this->m_functions[2590];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2dv(v);}
+inline void glReplacementCodeuiVertex3fSUN(GLuint rc,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)this->m_functions[2591];if(direct_)return direct_(rc,x,y,z);return this->m_rawTable->glReplacementCodeuiVertex3fSUN(rc,x,y,z);}
+inline void glGetTransformFeedbackVaryingEXT(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)this->m_functions[2592];if(direct_)return direct_(program,index,bufSize,length,size,type,name);return this->m_rawTable->glGetTransformFeedbackVaryingEXT(program,index,bufSize,length,size,type,name);}
+inline void glWindowPos3fARB(GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3FARBPROC)this->m_functions[2593];if(direct_)return direct_(x,y,z);return this->m_rawTable->glWindowPos3fARB(x,y,z);}
+inline void* glMapNamedBufferEXT(GLuint buffer,GLenum access)const{auto const direct_ = (FunctionTable::PFNGLMAPNAMEDBUFFEREXTPROC)this->m_functions[2594];if(direct_)return direct_(buffer,access);return this->m_rawTable->glMapNamedBufferEXT(buffer,access);}
+inline void glDisable(GLenum cap)const{auto const direct_ = (FunctionTable::PFNGLDISABLEPROC)this->m_functions[2595];if(direct_)return direct_(cap);return this->m_rawTable->glDisable(cap);}
+inline GLboolean glIsPointInFillPathNV(GLuint path,GLuint mask,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLISPOINTINFILLPATHNVPROC)this->m_functions[2596];if(direct_)return direct_(path,mask,x,y);return this->m_rawTable->glIsPointInFillPathNV(path,mask,x,y);}
+inline void glVertexAttribI2uiEXT(GLuint index,GLuint x,GLuint y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2UIEXTPROC)this->m_functions[2597];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttribI2uiEXT(index,x,y);}
+inline void glProgramUniform4uiv(GLuint program,GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4UIVPROC)this->m_functions[2598];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform4uiv(program,location,count,value);}
+inline void glQueryCounter(GLuint id,GLenum target)const{auto const direct_ = (FunctionTable::PFNGLQUERYCOUNTERPROC)this->m_functions[2599];if(direct_)return direct_(id,target);return this->m_rawTable->glQueryCounter(id,target);}
+inline void glFramebufferRenderbufferEXT(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)this->m_functions[2600];if(direct_)return direct_(target,attachment,renderbuffertarget,renderbuffer);return this->m_rawTable->glFramebufferRenderbufferEXT(target,attachment,renderbuffertarget,renderbuffer);}
+inline void glBinormal3svEXT(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLBINORMAL3SVEXTPROC)this->m_functions[2601];if(direct_)return direct_(v);return this->m_rawTable->glBinormal3svEXT(v);}
+inline void glBindBufferOffsetNV(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFEROFFSETNVPROC)this->m_functions[2602];if(direct_)return direct_(target,index,buffer,offset);return this->m_rawTable->glBindBufferOffsetNV(target,index,buffer,offset);}
+inline void glCopyTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE2DPROC)this->m_functions[2603];if(direct_)return direct_(texture,level,xoffset,yoffset,x,y,width,height);return this->m_rawTable->glCopyTextureSubImage2D(texture,level,xoffset,yoffset,x,y,width,height);}
+inline void glGetProgramResourcefvNV(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMRESOURCEFVNVPROC)this->m_functions[2604];if(direct_)return direct_(program,programInterface,index,propCount,props,bufSize,length,params);return this->m_rawTable->glGetProgramResourcefvNV(program,programInterface,index,propCount,props,bufSize,length,params);}
+inline void glBinormalPointerEXT(GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLBINORMALPOINTEREXTPROC)this->m_functions[2605];if(direct_)return direct_(type,stride,pointer);return this->m_rawTable->glBinormalPointerEXT(type,stride,pointer);}
+inline void glGetLightfv(GLenum light,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETLIGHTFVPROC)this->m_functions[2606];if(direct_)return direct_(light,pname,params);return this->m_rawTable->glGetLightfv(light,pname,params);}
+inline void glMulticastCopyImageSubDataNV(GLuint srcGpu,GLbitfield dstGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{auto const direct_ = (FunctionTable::PFNGLMULTICASTCOPYIMAGESUBDATANVPROC)this->m_functions[2607];if(direct_)return direct_(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);return this->m_rawTable->glMulticastCopyImageSubDataNV(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+inline void glVertex2bOES(GLbyte x,GLbyte y)const{auto const direct_ = (FunctionTable::PFNGLVERTEX2BOESPROC)this->m_functions[2608];if(direct_)return direct_(x,y);return this->m_rawTable->glVertex2bOES(x,y);}
+inline void glUniform2ivARB(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2IVARBPROC)this->m_functions[2609];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2ivARB(location,count,value);}
+inline void glMultiTexCoord3s(GLenum target,GLshort s,GLshort t,GLshort r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3SPROC)this->m_functions[2610];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3s(target,s,t,r);}
+inline void glGetHistogramParameterfvEXT(GLenum target,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETHISTOGRAMPARAMETERFVEXTPROC)this->m_functions[2611];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetHistogramParameterfvEXT(target,pname,params);}
+inline void glGetProgramStringNV(GLuint id,GLenum pname,GLubyte* program)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMSTRINGNVPROC)this->m_functions[2612];if(direct_)return direct_(id,pname,program);return this->m_rawTable->glGetProgramStringNV(id,pname,program);}
+inline void glGetTexGenxvOES(GLenum coord,GLenum pname,GLfixed* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXGENXVOESPROC)this->m_functions[2613];if(direct_)return direct_(coord,pname,params);return this->m_rawTable->glGetTexGenxvOES(coord,pname,params);}
+inline void glTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESUBIMAGE2DPROC)this->m_functions[2614];if(direct_)return direct_(texture,level,xoffset,yoffset,width,height,format,type,pixels);return this->m_rawTable->glTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,type,pixels);}
+inline GLenum glObjectPurgeableAPPLE(GLenum objectType,GLuint name,GLenum option)const{auto const direct_ = (FunctionTable::PFNGLOBJECTPURGEABLEAPPLEPROC)this->m_functions[2615];if(direct_)return direct_(objectType,name,option);return this->m_rawTable->glObjectPurgeableAPPLE(objectType,name,option);}
+inline void glColorTableSGI(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table)const{auto const direct_ = (FunctionTable::PFNGLCOLORTABLESGIPROC)this->m_functions[2616];if(direct_)return direct_(target,internalformat,width,format,type,table);return this->m_rawTable->glColorTableSGI(target,internalformat,width,format,type,table);}
+inline void glCopyConvolutionFilter2DEXT(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)this->m_functions[2617];if(direct_)return direct_(target,internalformat,x,y,width,height);return this->m_rawTable->glCopyConvolutionFilter2DEXT(target,internalformat,x,y,width,height);}
+inline void glMultiTexCoord3f(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3FPROC)this->m_functions[2618];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3f(target,s,t,r);}
+inline void glMultiTexCoord3d(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3DPROC)this->m_functions[2619];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3d(target,s,t,r);}
+inline void glFogCoorddv(const GLdouble* coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDDVPROC)this->m_functions[2620];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoorddv(coord);}
+inline void glGetBufferPointerv(GLenum target,GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPOINTERVPROC)this->m_functions[2621];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferPointerv(target,pname,params);}
+inline void glProgramUniform1fEXT(GLuint program,GLint location,GLfloat v0)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM1FEXTPROC)this->m_functions[2622];if(direct_)return direct_(program,location,v0);return this->m_rawTable->glProgramUniform1fEXT(program,location,v0);}
+inline void glWindowPos2fvMESA(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FVMESAPROC)this->m_functions[2623];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2fvMESA(v);}
+inline void glAlphaToCoverageDitherControlNV(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)this->m_functions[2624];if(direct_)return direct_(mode);return this->m_rawTable->glAlphaToCoverageDitherControlNV(mode);}
+inline void glPolygonOffsetxOES(GLfixed factor,GLfixed units)const{auto const direct_ = (FunctionTable::PFNGLPOLYGONOFFSETXOESPROC)this->m_functions[2625];if(direct_)return direct_(factor,units);return this->m_rawTable->glPolygonOffsetxOES(factor,units);}
+inline void glVertexAttrib4dARB(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4DARBPROC)this->m_functions[2626];if(direct_)return direct_(index,x,y,z,w);return this->m_rawTable->glVertexAttrib4dARB(index,x,y,z,w);}
+inline void glUniformHandleui64vARB(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMHANDLEUI64VARBPROC)this->m_functions[2627];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniformHandleui64vARB(location,count,value);}
+inline void glFragmentLightModelfvSGIX(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTLIGHTMODELFVSGIXPROC)this->m_functions[2628];if(direct_)return direct_(pname,params);return this->m_rawTable->glFragmentLightModelfvSGIX(pname,params);}
+inline void glSwizzleEXT(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{auto const direct_ = (FunctionTable::PFNGLSWIZZLEEXTPROC)this->m_functions[2629];if(direct_)return direct_(res,in,outX,outY,outZ,outW);return this->m_rawTable->glSwizzleEXT(res,in,outX,outY,outZ,outW);}
+inline void glBindFragmentShaderATI(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBINDFRAGMENTSHADERATIPROC)this->m_functions[2630];if(direct_)return direct_(id);return this->m_rawTable->glBindFragmentShaderATI(id);}
+inline void glVertexAttribs3hvNV(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS3HVNVPROC)this->m_functions[2631];if(direct_)return direct_(index,n,v);return this->m_rawTable->glVertexAttribs3hvNV(index,n,v);}
+inline void glGenBuffersARB(GLsizei n,GLuint* buffers)const{auto const direct_ = (FunctionTable::PFNGLGENBUFFERSARBPROC)this->m_functions[2632];if(direct_)return direct_(n,buffers);return this->m_rawTable->glGenBuffersARB(n,buffers);}
+inline void glTextureStorageMem2DMultisampleEXT(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)this->m_functions[2633];if(direct_)return direct_(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);return this->m_rawTable->glTextureStorageMem2DMultisampleEXT(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+inline void glListParameterfvSGIX(GLuint list,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLLISTPARAMETERFVSGIXPROC)this->m_functions[2634];if(direct_)return direct_(list,pname,params);return this->m_rawTable->glListParameterfvSGIX(list,pname,params);}
+inline void glNamedRenderbufferStorageMultisample(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)this->m_functions[2635];if(direct_)return direct_(renderbuffer,samples,internalformat,width,height);return this->m_rawTable->glNamedRenderbufferStorageMultisample(renderbuffer,samples,internalformat,width,height);}
+inline void glVertexAttribI1iEXT(GLuint index,GLint x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1IEXTPROC)this->m_functions[2636];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribI1iEXT(index,x);}
+inline void glMultiTexCoord2ivARB(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2IVARBPROC)this->m_functions[2637];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2ivARB(target,v);}
+inline void glLightModelxOES(GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLLIGHTMODELXOESPROC)this->m_functions[2638];if(direct_)return direct_(pname,param);return this->m_rawTable->glLightModelxOES(pname,param);}
+inline void glColor3xOES(GLfixed red,GLfixed green,GLfixed blue)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3XOESPROC)this->m_functions[2639];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glColor3xOES(red,green,blue);}
+inline void glReadBuffer(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLREADBUFFERPROC)this->m_functions[2640];if(direct_)return direct_(mode);return this->m_rawTable->glReadBuffer(mode);}
+inline void glStencilFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{auto const direct_ = (FunctionTable::PFNGLSTENCILFILLPATHINSTANCEDNVPROC)this->m_functions[2641];if(direct_)return direct_(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);return this->m_rawTable->glStencilFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);}
+inline void glVDPAUUnmapSurfacesNV(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces)const{auto const direct_ = (FunctionTable::PFNGLVDPAUUNMAPSURFACESNVPROC)this->m_functions[2642];if(direct_)return direct_(numSurface,surfaces);return this->m_rawTable->glVDPAUUnmapSurfacesNV(numSurface,surfaces);}
+inline void glProgramUniform4i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM4I64NVPROC)this->m_functions[2643];if(direct_)return direct_(program,location,x,y,z,w);return this->m_rawTable->glProgramUniform4i64NV(program,location,x,y,z,w);}
+inline void glVertexStream4dvATI(GLenum stream,const GLdouble* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM4DVATIPROC)this->m_functions[2644];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream4dvATI(stream,coords);}
+inline GLboolean glIsQuery(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLISQUERYPROC)this->m_functions[2645];if(direct_)return direct_(id);return this->m_rawTable->glIsQuery(id);}
+inline void glProgramUniformMatrix4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)this->m_functions[2646];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4fvEXT(program,location,count,transpose,value);}
+inline void glVertexAttrib3hNV(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3HNVPROC)this->m_functions[2647];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3hNV(index,x,y,z);}
+inline void glFlushMappedNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length)const{auto const direct_ = (FunctionTable::PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)this->m_functions[2648];if(direct_)return direct_(buffer,offset,length);return this->m_rawTable->glFlushMappedNamedBufferRange(buffer,offset,length);}
+inline void glPushName(GLuint name)const{auto const direct_ = (FunctionTable::PFNGLPUSHNAMEPROC)this->m_functions[2649];if(direct_)return direct_(name);return this->m_rawTable->glPushName(name);}
+inline void glGetClipPlane(GLenum plane,GLdouble* equation)const{auto const direct_ = (FunctionTable::PFNGLGETCLIPPLANEPROC)this->m_functions[2650];if(direct_)return direct_(plane,equation);return this->m_rawTable->glGetClipPlane(plane,equation);}
+inline void glVertex4dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4DVPROC)this->m_functions[2651];if(direct_)return direct_(v);return this->m_rawTable->glVertex4dv(v);}
+inline void glVertexAttrib3d(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DPROC)this->m_functions[2652];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3d(index,x,y,z);}
+inline void glBlendColor(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{auto const direct_ = (FunctionTable::PFNGLBLENDCOLORPROC)this->m_functions[2653];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glBlendColor(red,green,blue,alpha);}
+inline void glBindTransformFeedbackNV(GLenum target,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBINDTRANSFORMFEEDBACKNVPROC)this->m_functions[2654];if(direct_)return direct_(target,id);return this->m_rawTable->glBindTransformFeedbackNV(target,id);}
+inline void glSamplerParameterIuiv(GLuint sampler,GLenum pname,const GLuint* param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERIUIVPROC)this->m_functions[2655];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameterIuiv(sampler,pname,param);}
+inline void glIndexubv(const GLubyte* c)const{auto const direct_ = (FunctionTable::PFNGLINDEXUBVPROC)this->m_functions[2656];if(direct_)return direct_(c);return this->m_rawTable->glIndexubv(c);}
+inline void glNamedBufferPageCommitmentEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)this->m_functions[2657];if(direct_)return direct_(buffer,offset,size,commit);return this->m_rawTable->glNamedBufferPageCommitmentEXT(buffer,offset,size,commit);}
+inline GLenum glCheckNamedFramebufferStatus(GLuint framebuffer,GLenum target)const{auto const direct_ = (FunctionTable::PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)this->m_functions[2658];if(direct_)return direct_(framebuffer,target);return this->m_rawTable->glCheckNamedFramebufferStatus(framebuffer,target);}
+inline void glGetObjectBufferfvATI(GLuint buffer,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTBUFFERFVATIPROC)this->m_functions[2659];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetObjectBufferfvATI(buffer,pname,params);}
+inline void glRasterPos4d(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4DPROC)this->m_functions[2660];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glRasterPos4d(x,y,z,w);}
+inline void glRasterPos4f(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4FPROC)this->m_functions[2661];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glRasterPos4f(x,y,z,w);}
+inline void glGetPerfMonitorCounterStringAMD(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)this->m_functions[2662];if(direct_)return direct_(group,counter,bufSize,length,counterString);return this->m_rawTable->glGetPerfMonitorCounterStringAMD(group,counter,bufSize,length,counterString);}
+inline void glVertexAttrib3s(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SPROC)this->m_functions[2663];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3s(index,x,y,z);}
+inline void glDrawElementsInstancedEXT(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDEXTPROC)this->m_functions[2664];if(direct_)return direct_(mode,count,type,indices,primcount);return this->m_rawTable->glDrawElementsInstancedEXT(mode,count,type,indices,primcount);}
+inline void glNamedProgramLocalParameterI4iEXT(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)this->m_functions[2665];if(direct_)return direct_(program,target,index,x,y,z,w);return this->m_rawTable->glNamedProgramLocalParameterI4iEXT(program,target,index,x,y,z,w);}
+inline void glRasterPos4s(GLshort x,GLshort y,GLshort z,GLshort w)const{auto const direct_ = (FunctionTable::PFNGLRASTERPOS4SPROC)this->m_functions[2666];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glRasterPos4s(x,y,z,w);}
+inline void glGetProgramStageiv(GLuint program,GLenum shadertype,GLenum pname,GLint* values)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMSTAGEIVPROC)this->m_functions[2667];if(direct_)return direct_(program,shadertype,pname,values);return this->m_rawTable->glGetProgramStageiv(program,shadertype,pname,values);}
+inline void glGetMaterialxOES(GLenum face,GLenum pname,GLfixed param)const{auto const direct_ = (FunctionTable::PFNGLGETMATERIALXOESPROC)this->m_functions[2668];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glGetMaterialxOES(face,pname,param);}
+inline void glPopMatrix()const{auto const direct_ = (FunctionTable::PFNGLPOPMATRIXPROC)this->m_functions[2669];if(direct_)return direct_();return this->m_rawTable->glPopMatrix();}
+inline void glGetVideoui64vNV(GLuint video_slot,GLenum pname,GLuint64EXT* params)const{auto const direct_ = (FunctionTable::PFNGLGETVIDEOUI64VNVPROC)this->m_functions[2670];if(direct_)return direct_(video_slot,pname,params);return this->m_rawTable->glGetVideoui64vNV(video_slot,pname,params);}
+inline void glTangent3bEXT(GLbyte tx,GLbyte ty,GLbyte tz)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3BEXTPROC)this->m_functions[2671];if(direct_)return direct_(tx,ty,tz);return this->m_rawTable->glTangent3bEXT(tx,ty,tz);}
+inline GLenum glGetGraphicsResetStatusARB()const{auto const direct_ = (FunctionTable::PFNGLGETGRAPHICSRESETSTATUSARBPROC)this->m_functions[2672];if(direct_)return direct_();return this->m_rawTable->glGetGraphicsResetStatusARB();}
+inline void glUniform4i(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4IPROC)this->m_functions[2673];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4i(location,v0,v1,v2,v3);}
+inline void glActiveTexture(GLenum texture)const{auto const direct_ = (FunctionTable::PFNGLACTIVETEXTUREPROC)this->m_functions[2674];if(direct_)return direct_(texture);return this->m_rawTable->glActiveTexture(texture);}
+inline void glEnableVertexAttribArray(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXATTRIBARRAYPROC)this->m_functions[2675];if(direct_)return direct_(index);return this->m_rawTable->glEnableVertexAttribArray(index);}
+inline void glTexCoord4fVertex4fvSUN(const GLfloat* tc,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4FVERTEX4FVSUNPROC)this->m_functions[2676];if(direct_)return direct_(tc,v);return this->m_rawTable->glTexCoord4fVertex4fvSUN(tc,v);}
+inline void glUniform4d(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4DPROC)this->m_functions[2677];if(direct_)return direct_(location,x,y,z,w);return this->m_rawTable->glUniform4d(location,x,y,z,w);}
+inline void glUniform4f(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4FPROC)this->m_functions[2678];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4f(location,v0,v1,v2,v3);}
+inline void glRenderbufferStorageMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)this->m_functions[2679];if(direct_)return direct_(target,samples,internalformat,width,height);return this->m_rawTable->glRenderbufferStorageMultisample(target,samples,internalformat,width,height);}
+inline void glCreateProgramPipelines(GLsizei n,GLuint* pipelines)const{auto const direct_ = (FunctionTable::PFNGLCREATEPROGRAMPIPELINESPROC)this->m_functions[2680];if(direct_)return direct_(n,pipelines);return this->m_rawTable->glCreateProgramPipelines(n,pipelines);}
+inline void glVertexAttribLPointer(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBLPOINTERPROC)this->m_functions[2681];if(direct_)return direct_(index,size,type,stride,pointer);return this->m_rawTable->glVertexAttribLPointer(index,size,type,stride,pointer);}
+inline void glUniform2uiEXT(GLint location,GLuint v0,GLuint v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2UIEXTPROC)this->m_functions[2682];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2uiEXT(location,v0,v1);}
+inline void glMultiTexCoord3sv(GLenum target,const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3SVPROC)this->m_functions[2683];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord3sv(target,v);}
+inline void glDrawElementsInstancedBaseVertex(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex)const{auto const direct_ = (FunctionTable::PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)this->m_functions[2684];if(direct_)return direct_(mode,count,type,indices,instancecount,basevertex);return this->m_rawTable->glDrawElementsInstancedBaseVertex(mode,count,type,indices,instancecount,basevertex);}
+inline void glPixelTransformParameterfvEXT(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)this->m_functions[2685];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glPixelTransformParameterfvEXT(target,pname,params);}
+inline void glDrawTransformFeedbackNV(GLenum mode,GLuint id)const{auto const direct_ = (FunctionTable::PFNGLDRAWTRANSFORMFEEDBACKNVPROC)this->m_functions[2686];if(direct_)return direct_(mode,id);return this->m_rawTable->glDrawTransformFeedbackNV(mode,id);}
+inline void glTextureImage2DMultisampleCoverageNV(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)this->m_functions[2687];if(direct_)return direct_(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);return this->m_rawTable->glTextureImage2DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+inline void glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)this->m_functions[2688];if(direct_)return direct_(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);return this->m_rawTable->glNamedRenderbufferStorageMultisampleCoverageEXT(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);}
+inline GLboolean glIsTexture(GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLISTEXTUREPROC)this->m_functions[2689];if(direct_)return direct_(texture);return this->m_rawTable->glIsTexture(texture);}
+inline void glMultiTexCoord4iv(GLenum target,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4IVPROC)this->m_functions[2690];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4iv(target,v);}
+inline void glTexEnvfv(GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLTEXENVFVPROC)this->m_functions[2691];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexEnvfv(target,pname,params);}
+inline void glPopDebugGroup()const{auto const direct_ = (FunctionTable::PFNGLPOPDEBUGGROUPPROC)this->m_functions[2692];if(direct_)return direct_();return this->m_rawTable->glPopDebugGroup();}
+inline void glUniformBlockBinding(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMBLOCKBINDINGPROC)this->m_functions[2693];if(direct_)return direct_(program,uniformBlockIndex,uniformBlockBinding);return this->m_rawTable->glUniformBlockBinding(program,uniformBlockIndex,uniformBlockBinding);}
+inline void glWindowPos2svMESA(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2SVMESAPROC)this->m_functions[2694];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos2svMESA(v);}
+inline void glGenerateTextureMipmapEXT(GLuint texture,GLenum target)const{auto const direct_ = (FunctionTable::PFNGLGENERATETEXTUREMIPMAPEXTPROC)this->m_functions[2695];if(direct_)return direct_(texture,target);return this->m_rawTable->glGenerateTextureMipmapEXT(texture,target);}
+inline GLuint glBindLightParameterEXT(GLenum light,GLenum value)const{auto const direct_ = (FunctionTable::PFNGLBINDLIGHTPARAMETEREXTPROC)this->m_functions[2696];if(direct_)return direct_(light,value);return this->m_rawTable->glBindLightParameterEXT(light,value);}
+inline void glTexCoord3bOES(GLbyte s,GLbyte t,GLbyte r)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD3BOESPROC)this->m_functions[2697];if(direct_)return direct_(s,t,r);return this->m_rawTable->glTexCoord3bOES(s,t,r);}
+inline void glTexCoordPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDPOINTERPROC)this->m_functions[2698];if(direct_)return direct_(size,type,stride,ptr);return this->m_rawTable->glTexCoordPointer(size,type,stride,ptr);}
+inline void glProgramUniformMatrix3x2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)this->m_functions[2699];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix3x2fv(program,location,count,transpose,value);}
+inline void glUniform2fvARB(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2FVARBPROC)this->m_functions[2700];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform2fvARB(location,count,value);}
+inline void glProgramLocalParameterI4uivNV(GLenum target,GLuint index,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)this->m_functions[2701];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramLocalParameterI4uivNV(target,index,params);}
+inline void glFlushVertexArrayRangeNV()const{auto const direct_ = (FunctionTable::PFNGLFLUSHVERTEXARRAYRANGENVPROC)this->m_functions[2702];if(direct_)return direct_();return this->m_rawTable->glFlushVertexArrayRangeNV();}
+inline void glSecondaryColor3svEXT(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3SVEXTPROC)this->m_functions[2703];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3svEXT(v);}
+inline void glGetBufferParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETBUFFERPARAMETERIVPROC)this->m_functions[2704];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetBufferParameteriv(target,pname,params);}
+inline void glGetQueryIndexediv(GLenum target,GLuint index,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYINDEXEDIVPROC)this->m_functions[2705];if(direct_)return direct_(target,index,pname,params);return this->m_rawTable->glGetQueryIndexediv(target,index,pname,params);}
+inline void glFramebufferTexture3DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE3DEXTPROC)this->m_functions[2706];if(direct_)return direct_(target,attachment,textarget,texture,level,zoffset);return this->m_rawTable->glFramebufferTexture3DEXT(target,attachment,textarget,texture,level,zoffset);}
+inline void glLoadTransposeMatrixxOES(const GLfixed* m)const{auto const direct_ = (FunctionTable::PFNGLLOADTRANSPOSEMATRIXXOESPROC)this->m_functions[2707];if(direct_)return direct_(m);return this->m_rawTable->glLoadTransposeMatrixxOES(m);}
+inline void glDeleteTransformFeedbacksNV(GLsizei n,const GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLDELETETRANSFORMFEEDBACKSNVPROC)this->m_functions[2708];if(direct_)return direct_(n,ids);return this->m_rawTable->glDeleteTransformFeedbacksNV(n,ids);}
+inline void glGetCompressedTextureImageEXT(GLuint texture,GLenum target,GLint lod,void* img)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)this->m_functions[2709];if(direct_)return direct_(texture,target,lod,img);return this->m_rawTable->glGetCompressedTextureImageEXT(texture,target,lod,img);}
+inline void glIndexMaterialEXT(GLenum face,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLINDEXMATERIALEXTPROC)this->m_functions[2710];if(direct_)return direct_(face,mode);return this->m_rawTable->glIndexMaterialEXT(face,mode);}
+inline void glFogCoorddEXT(GLdouble coord)const{auto const direct_ = (FunctionTable::PFNGLFOGCOORDDEXTPROC)this->m_functions[2711];if(direct_)return direct_(coord);return this->m_rawTable->glFogCoorddEXT(coord);}
+inline void glTexCoord2hvNV(const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2HVNVPROC)this->m_functions[2712];if(direct_)return direct_(v);return this->m_rawTable->glTexCoord2hvNV(v);}
+inline void glGetFramebufferParameterfvAMD(GLenum target,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)this->m_functions[2713];if(direct_)return direct_(target,pname,numsamples,pixelindex,size,values);return this->m_rawTable->glGetFramebufferParameterfvAMD(target,pname,numsamples,pixelindex,size,values);}
+inline void glTexEnviv(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXENVIVPROC)this->m_functions[2714];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexEnviv(target,pname,params);}
+inline void glEndTransformFeedbackNV()const{auto const direct_ = (FunctionTable::PFNGLENDTRANSFORMFEEDBACKNVPROC)this->m_functions[2715];if(direct_)return direct_();return this->m_rawTable->glEndTransformFeedbackNV();}
+inline void glGlobalAlphaFactoruiSUN(GLuint factor)const{auto const direct_ = (FunctionTable::PFNGLGLOBALALPHAFACTORUISUNPROC)this->m_functions[2716];if(direct_)return direct_(factor);return this->m_rawTable->glGlobalAlphaFactoruiSUN(factor);}
+inline void glSelectBuffer(GLsizei size,GLuint* buffer)const{auto const direct_ = (FunctionTable::PFNGLSELECTBUFFERPROC)this->m_functions[2717];if(direct_)return direct_(size,buffer);return this->m_rawTable->glSelectBuffer(size,buffer);}
+inline void glNamedBufferSubDataEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSUBDATAEXTPROC)this->m_functions[2718];if(direct_)return direct_(buffer,offset,size,data);return this->m_rawTable->glNamedBufferSubDataEXT(buffer,offset,size,data);}
+inline void glDisableVertexArrayAttrib(GLuint vaobj,GLuint index)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVERTEXARRAYATTRIBPROC)this->m_functions[2719];if(direct_)return direct_(vaobj,index);return this->m_rawTable->glDisableVertexArrayAttrib(vaobj,index);}
+inline void glBlendFunc(GLenum sfactor,GLenum dfactor)const{auto const direct_ = (FunctionTable::PFNGLBLENDFUNCPROC)this->m_functions[2720];if(direct_)return direct_(sfactor,dfactor);return this->m_rawTable->glBlendFunc(sfactor,dfactor);}
+inline GLuint glCreateProgram()const{auto const direct_ = (FunctionTable::PFNGLCREATEPROGRAMPROC)this->m_functions[2721];if(direct_)return direct_();return this->m_rawTable->glCreateProgram();}
+inline void glVertexStream2dATI(GLenum stream,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM2DATIPROC)this->m_functions[2722];if(direct_)return direct_(stream,x,y);return this->m_rawTable->glVertexStream2dATI(stream,x,y);}
+inline void glUniform4ui64vARB(GLint location,GLsizei count,const GLuint64* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UI64VARBPROC)this->m_functions[2723];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform4ui64vARB(location,count,value);}
+inline void glGetSemaphoreParameterui64vEXT(GLuint semaphore,GLenum pname,GLuint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)this->m_functions[2724];if(direct_)return direct_(semaphore,pname,params);return this->m_rawTable->glGetSemaphoreParameterui64vEXT(semaphore,pname,params);}
+inline void glPrimitiveRestartIndex(GLuint index)const{auto const direct_ = (FunctionTable::PFNGLPRIMITIVERESTARTINDEXPROC)this->m_functions[2725];if(direct_)return direct_(index);return this->m_rawTable->glPrimitiveRestartIndex(index);}
+inline void glNormalStream3fATI(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3FATIPROC)this->m_functions[2726];if(direct_)return direct_(stream,nx,ny,nz);return this->m_rawTable->glNormalStream3fATI(stream,nx,ny,nz);}
+inline void glProgramUniformMatrix2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX2FVPROC)this->m_functions[2727];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix2fv(program,location,count,transpose,value);}
+inline void glVertexAttribs1hvNV(GLuint index,GLsizei n,const GLhalfNV* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBS1HVNVPROC)this->m_functions[2728];if(direct_)return direct_(index,n,v);return this->m_rawTable->glVertexAttribs1hvNV(index,n,v);}
+inline void glWindowPos4svMESA(const GLshort* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS4SVMESAPROC)this->m_functions[2729];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos4svMESA(v);}
+inline void glDeleteFragmentShaderATI(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLDELETEFRAGMENTSHADERATIPROC)this->m_functions[2730];if(direct_)return direct_(id);return this->m_rawTable->glDeleteFragmentShaderATI(id);}
+inline void glBindImageTextures(GLuint first,GLsizei count,const GLuint* textures)const{auto const direct_ = (FunctionTable::PFNGLBINDIMAGETEXTURESPROC)this->m_functions[2731];if(direct_)return direct_(first,count,textures);return this->m_rawTable->glBindImageTextures(first,count,textures);}
+inline void glMap2xOES(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points)const{auto const direct_ = (FunctionTable::PFNGLMAP2XOESPROC)this->m_functions[2732];if(direct_)return direct_(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);return this->m_rawTable->glMap2xOES(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+inline void glEnd()const{auto const direct_ = (FunctionTable::PFNGLENDPROC)this->m_functions[2733];if(direct_)return direct_();return this->m_rawTable->glEnd();}
+inline void glMultiTexCoord2dARB(GLenum target,GLdouble s,GLdouble t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2DARBPROC)this->m_functions[2734];if(direct_)return direct_(target,s,t);return this->m_rawTable->glMultiTexCoord2dARB(target,s,t);}
+inline void glUniform1i64NV(GLint location,GLint64EXT x)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1I64NVPROC)this->m_functions[2735];if(direct_)return direct_(location,x);return this->m_rawTable->glUniform1i64NV(location,x);}
+inline void glPathStringNV(GLuint path,GLenum format,GLsizei length,const void* pathString)const{auto const direct_ = (FunctionTable::PFNGLPATHSTRINGNVPROC)this->m_functions[2736];if(direct_)return direct_(path,format,length,pathString);return this->m_rawTable->glPathStringNV(path,format,length,pathString);}
+inline void glGetNamedFramebufferParameterivEXT(GLuint framebuffer,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)this->m_functions[2737];if(direct_)return direct_(framebuffer,pname,params);return this->m_rawTable->glGetNamedFramebufferParameterivEXT(framebuffer,pname,params);}
+inline void glGetProgramNamedParameterdvNV(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)this->m_functions[2738];if(direct_)return direct_(id,len,name,params);return this->m_rawTable->glGetProgramNamedParameterdvNV(id,len,name,params);}
+inline void glPathDashArrayNV(GLuint path,GLsizei dashCount,const GLfloat* dashArray)const{auto const direct_ = (FunctionTable::PFNGLPATHDASHARRAYNVPROC)this->m_functions[2739];if(direct_)return direct_(path,dashCount,dashArray);return this->m_rawTable->glPathDashArrayNV(path,dashCount,dashArray);}
+inline void glUniform3uiv(GLint location,GLsizei count,const GLuint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UIVPROC)this->m_functions[2740];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform3uiv(location,count,value);}
+inline void glColor3fVertex3fvSUN(const GLfloat* c,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLCOLOR3FVERTEX3FVSUNPROC)this->m_functions[2741];if(direct_)return direct_(c,v);return this->m_rawTable->glColor3fVertex3fvSUN(c,v);}
+inline void glMultTransposeMatrixd(const GLdouble m[16])const{auto const direct_ = (FunctionTable::PFNGLMULTTRANSPOSEMATRIXDPROC)this->m_functions[2742];if(direct_)return direct_(m);return this->m_rawTable->glMultTransposeMatrixd(m);}
+inline void glClearColor(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha)const{auto const direct_ = (FunctionTable::PFNGLCLEARCOLORPROC)this->m_functions[2743];if(direct_)return direct_(red,green,blue,alpha);return this->m_rawTable->glClearColor(red,green,blue,alpha);}
+inline GLuint64 glGetImageHandleARB(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{auto const direct_ = (FunctionTable::PFNGLGETIMAGEHANDLEARBPROC)this->m_functions[2744];if(direct_)return direct_(texture,level,layered,layer,format);return this->m_rawTable->glGetImageHandleARB(texture,level,layered,layer,format);}
+inline void glTangent3dEXT(GLdouble tx,GLdouble ty,GLdouble tz)const{auto const direct_ = (FunctionTable::PFNGLTANGENT3DEXTPROC)this->m_functions[2745];if(direct_)return direct_(tx,ty,tz);return this->m_rawTable->glTangent3dEXT(tx,ty,tz);}
+inline void glGetQueryObjectivARB(GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYOBJECTIVARBPROC)this->m_functions[2746];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetQueryObjectivARB(id,pname,params);}
+inline void glGetLocalConstantFloatvEXT(GLuint id,GLenum value,GLfloat* data)const{auto const direct_ = (FunctionTable::PFNGLGETLOCALCONSTANTFLOATVEXTPROC)this->m_functions[2747];if(direct_)return direct_(id,value,data);return this->m_rawTable->glGetLocalConstantFloatvEXT(id,value,data);}
+inline void glUseShaderProgramEXT(GLenum type,GLuint program)const{auto const direct_ = (FunctionTable::PFNGLUSESHADERPROGRAMEXTPROC)this->m_functions[2748];if(direct_)return direct_(type,program);return this->m_rawTable->glUseShaderProgramEXT(type,program);}
+inline void glBindRenderbufferEXT(GLenum target,GLuint renderbuffer)const{auto const direct_ = (FunctionTable::PFNGLBINDRENDERBUFFEREXTPROC)this->m_functions[2749];if(direct_)return direct_(target,renderbuffer);return this->m_rawTable->glBindRenderbufferEXT(target,renderbuffer);}
+inline void glInterleavedArrays(GLenum format,GLsizei stride,const GLvoid* pointer)const{auto const direct_ = (FunctionTable::PFNGLINTERLEAVEDARRAYSPROC)this->m_functions[2750];if(direct_)return direct_(format,stride,pointer);return this->m_rawTable->glInterleavedArrays(format,stride,pointer);}
+inline void glGetPerfMonitorGroupStringAMD(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString)const{auto const direct_ = (FunctionTable::PFNGLGETPERFMONITORGROUPSTRINGAMDPROC)this->m_functions[2751];if(direct_)return direct_(group,bufSize,length,groupString);return this->m_rawTable->glGetPerfMonitorGroupStringAMD(group,bufSize,length,groupString);}
+inline void glUniform3ui(GLint location,GLuint v0,GLuint v1,GLuint v2)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM3UIPROC)this->m_functions[2752];if(direct_)return direct_(location,v0,v1,v2);return this->m_rawTable->glUniform3ui(location,v0,v1,v2);}
+inline void glGetNamedProgramLocalParameterdvEXT(GLuint program,GLenum target,GLuint index,GLdouble* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)this->m_functions[2753];if(direct_)return direct_(program,target,index,params);return this->m_rawTable->glGetNamedProgramLocalParameterdvEXT(program,target,index,params);}
+inline void glDeleteQueryResourceTagNV(GLsizei n,const GLint* tagIds)const{auto const direct_ = (FunctionTable::PFNGLDELETEQUERYRESOURCETAGNVPROC)this->m_functions[2754];if(direct_)return direct_(n,tagIds);return this->m_rawTable->glDeleteQueryResourceTagNV(n,tagIds);}
+inline void glVertexAttribI4uiv(GLuint index,const GLuint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4UIVPROC)this->m_functions[2755];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4uiv(index,v);}
+inline void glVertexAttrib4bv(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4BVPROC)this->m_functions[2756];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4bv(index,v);}
+inline void glMultiTexCoord3xOES(GLenum texture,GLfixed s,GLfixed t,GLfixed r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3XOESPROC)this->m_functions[2757];if(direct_)return direct_(texture,s,t,r);return this->m_rawTable->glMultiTexCoord3xOES(texture,s,t,r);}
+inline void glSecondaryColor3ub(GLubyte red,GLubyte green,GLubyte blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UBPROC)this->m_functions[2758];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3ub(red,green,blue);}
+inline void glFragmentMaterialfSGIX(GLenum face,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLFRAGMENTMATERIALFSGIXPROC)this->m_functions[2759];if(direct_)return direct_(face,pname,param);return this->m_rawTable->glFragmentMaterialfSGIX(face,pname,param);}
+inline void glGetVariantArrayObjectivATI(GLuint id,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVARIANTARRAYOBJECTIVATIPROC)this->m_functions[2760];if(direct_)return direct_(id,pname,params);return this->m_rawTable->glGetVariantArrayObjectivATI(id,pname,params);}
+inline void glSecondaryColor3ui(GLuint red,GLuint green,GLuint blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3UIPROC)this->m_functions[2761];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3ui(red,green,blue);}
+inline void glVertexAttrib1dARB(GLuint index,GLdouble x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1DARBPROC)this->m_functions[2762];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1dARB(index,x);}
+inline void glGetNamedBufferPointerv(GLuint buffer,GLenum pname,void** params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPOINTERVPROC)this->m_functions[2763];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferPointerv(buffer,pname,params);}
+inline void glLockArraysEXT(GLint first,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLLOCKARRAYSEXTPROC)this->m_functions[2764];if(direct_)return direct_(first,count);return this->m_rawTable->glLockArraysEXT(first,count);}
+inline void glVertexAttribPointerNV(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBPOINTERNVPROC)this->m_functions[2765];if(direct_)return direct_(index,fsize,type,stride,pointer);return this->m_rawTable->glVertexAttribPointerNV(index,fsize,type,stride,pointer);}
+inline void glConvolutionParameterf(GLenum target,GLenum pname,GLfloat params)const{auto const direct_ = (FunctionTable::PFNGLCONVOLUTIONPARAMETERFPROC)this->m_functions[2766];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glConvolutionParameterf(target,pname,params);}
+inline void glBindBufferBaseEXT(GLenum target,GLuint index,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERBASEEXTPROC)this->m_functions[2767];if(direct_)return direct_(target,index,buffer);return this->m_rawTable->glBindBufferBaseEXT(target,index,buffer);}
+inline void glTexCoord2xvOES(const GLfixed* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2XVOESPROC)this->m_functions[2768];if(direct_)return direct_(coords);return this->m_rawTable->glTexCoord2xvOES(coords);}
+inline void glGetQueryBufferObjectui64v(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLGETQUERYBUFFEROBJECTUI64VPROC)this->m_functions[2769];if(direct_)return direct_(id,buffer,pname,offset);return this->m_rawTable->glGetQueryBufferObjectui64v(id,buffer,pname,offset);}
+inline void glSetMultisamplefvAMD(GLenum pname,GLuint index,const GLfloat* val)const{auto const direct_ = (FunctionTable::PFNGLSETMULTISAMPLEFVAMDPROC)this->m_functions[2770];if(direct_)return direct_(pname,index,val);return this->m_rawTable->glSetMultisamplefvAMD(pname,index,val);}
+inline void glPathColorGenNV(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs)const{auto const direct_ = (FunctionTable::PFNGLPATHCOLORGENNVPROC)this->m_functions[2771];if(direct_)return direct_(color,genMode,colorFormat,coeffs);return this->m_rawTable->glPathColorGenNV(color,genMode,colorFormat,coeffs);}
+inline void glVertexAttrib3sARB(GLuint index,GLshort x,GLshort y,GLshort z)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3SARBPROC)this->m_functions[2772];if(direct_)return direct_(index,x,y,z);return this->m_rawTable->glVertexAttrib3sARB(index,x,y,z);}
+inline void glVertexAttrib4ivARB(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB4IVARBPROC)this->m_functions[2773];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib4ivARB(index,v);}
+inline void glGenTransformFeedbacks(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLGENTRANSFORMFEEDBACKSPROC)this->m_functions[2774];if(direct_)return direct_(n,ids);return this->m_rawTable->glGenTransformFeedbacks(n,ids);}
+inline void glGetVertexAttribIuiv(GLuint index,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXATTRIBIUIVPROC)this->m_functions[2775];if(direct_)return direct_(index,pname,params);return this->m_rawTable->glGetVertexAttribIuiv(index,pname,params);}
+inline void glPixelTransformParameterfEXT(GLenum target,GLenum pname,GLfloat param)const{auto const direct_ = (FunctionTable::PFNGLPIXELTRANSFORMPARAMETERFEXTPROC)this->m_functions[2776];if(direct_)return direct_(target,pname,param);return this->m_rawTable->glPixelTransformParameterfEXT(target,pname,param);}
+inline void glGetTexParameterIuivEXT(GLenum target,GLenum pname,GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERIUIVEXTPROC)this->m_functions[2777];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterIuivEXT(target,pname,params);}
+inline void glGetObjectParameterivARB(GLhandleARB obj,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTPARAMETERIVARBPROC)this->m_functions[2778];if(direct_)return direct_(obj,pname,params);return this->m_rawTable->glGetObjectParameterivARB(obj,pname,params);}
+inline void glVertexArraySecondaryColorOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)this->m_functions[2779];if(direct_)return direct_(vaobj,buffer,size,type,stride,offset);return this->m_rawTable->glVertexArraySecondaryColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+inline void glWindowPos2fARB(GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS2FARBPROC)this->m_functions[2780];if(direct_)return direct_(x,y);return this->m_rawTable->glWindowPos2fARB(x,y);}
+inline void glCompressedTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)this->m_functions[2781];if(direct_)return direct_(target,level,xoffset,yoffset,width,height,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage2D(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+inline void glCompressedTexSubImage3DARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)this->m_functions[2782];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);return this->m_rawTable->glCompressedTexSubImage3DARB(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+inline void glProgramBinary(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMBINARYPROC)this->m_functions[2783];if(direct_)return direct_(program,binaryFormat,binary,length);return this->m_rawTable->glProgramBinary(program,binaryFormat,binary,length);}
+inline void glPresentFrameKeyedNV(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1)const{auto const direct_ = (FunctionTable::PFNGLPRESENTFRAMEKEYEDNVPROC)this->m_functions[2784];if(direct_)return direct_(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);return this->m_rawTable->glPresentFrameKeyedNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);}
+inline void glVertexAttribI4bv(GLuint index,const GLbyte* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI4BVPROC)this->m_functions[2785];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI4bv(index,v);}
+inline void glPathCoverDepthFuncNV(GLenum func)const{auto const direct_ = (FunctionTable::PFNGLPATHCOVERDEPTHFUNCNVPROC)this->m_functions[2786];if(direct_)return direct_(func);return this->m_rawTable->glPathCoverDepthFuncNV(func);}
+inline void glTransformFeedbackStreamAttribsNV(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode)const{auto const direct_ = (FunctionTable::PFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)this->m_functions[2787];if(direct_)return direct_(count,attribs,nbuffers,bufstreams,bufferMode);return this->m_rawTable->glTransformFeedbackStreamAttribsNV(count,attribs,nbuffers,bufstreams,bufferMode);}
+inline void glSecondaryColor3usEXT(GLushort red,GLushort green,GLushort blue)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3USEXTPROC)this->m_functions[2788];if(direct_)return direct_(red,green,blue);return this->m_rawTable->glSecondaryColor3usEXT(red,green,blue);}
+inline void glCopyColorTableSGI(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYCOLORTABLESGIPROC)this->m_functions[2789];if(direct_)return direct_(target,internalformat,x,y,width);return this->m_rawTable->glCopyColorTableSGI(target,internalformat,x,y,width);}
+inline void glProgramEnvParameter4fvARB(GLenum target,GLuint index,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMENVPARAMETER4FVARBPROC)this->m_functions[2790];if(direct_)return direct_(target,index,params);return this->m_rawTable->glProgramEnvParameter4fvARB(target,index,params);}
+inline void glMultiTexCoord4sARB(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4SARBPROC)this->m_functions[2791];if(direct_)return direct_(target,s,t,r,q);return this->m_rawTable->glMultiTexCoord4sARB(target,s,t,r,q);}
+inline void glGetVertexArrayIndexed64iv(GLuint vaobj,GLuint index,GLenum pname,GLint64* param)const{auto const direct_ = (FunctionTable::PFNGLGETVERTEXARRAYINDEXED64IVPROC)this->m_functions[2792];if(direct_)return direct_(vaobj,index,pname,param);return this->m_rawTable->glGetVertexArrayIndexed64iv(vaobj,index,pname,param);}
+inline void glMatrixMultTranspose3x3fNV(GLenum matrixMode,const GLfloat* m)const{auto const direct_ = (FunctionTable::PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)this->m_functions[2793];if(direct_)return direct_(matrixMode,m);return this->m_rawTable->glMatrixMultTranspose3x3fNV(matrixMode,m);}
+inline void glTexParameterIiv(GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXPARAMETERIIVPROC)this->m_functions[2794];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glTexParameterIiv(target,pname,params);}
+inline void glVertexArrayAttribFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{auto const direct_ = (FunctionTable::PFNGLVERTEXARRAYATTRIBFORMATPROC)this->m_functions[2795];if(direct_)return direct_(vaobj,attribindex,size,type,normalized,relativeoffset);return this->m_rawTable->glVertexArrayAttribFormat(vaobj,attribindex,size,type,normalized,relativeoffset);}
+inline void glEndTransformFeedback()const{auto const direct_ = (FunctionTable::PFNGLENDTRANSFORMFEEDBACKPROC)this->m_functions[2796];if(direct_)return direct_();return this->m_rawTable->glEndTransformFeedback();}
+inline void glDrawCommandsStatesAddressNV(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{auto const direct_ = (FunctionTable::PFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)this->m_functions[2797];if(direct_)return direct_(indirects,sizes,states,fbos,count);return this->m_rawTable->glDrawCommandsStatesAddressNV(indirects,sizes,states,fbos,count);}
+inline void glUniform4ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4UI64NVPROC)this->m_functions[2798];if(direct_)return direct_(location,x,y,z,w);return this->m_rawTable->glUniform4ui64NV(location,x,y,z,w);}
+inline void glMaterialiv(GLenum face,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLMATERIALIVPROC)this->m_functions[2799];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glMaterialiv(face,pname,params);}
+inline void glTexImage2DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE2DMULTISAMPLEPROC)this->m_functions[2800];if(direct_)return direct_(target,samples,internalformat,width,height,fixedsamplelocations);return this->m_rawTable->glTexImage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+inline void glBindTextureEXT(GLenum target,GLuint texture)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXTUREEXTPROC)this->m_functions[2801];if(direct_)return direct_(target,texture);return this->m_rawTable->glBindTextureEXT(target,texture);}
+inline GLboolean glIsBuffer(GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLISBUFFERPROC)this->m_functions[2802];if(direct_)return direct_(buffer);return this->m_rawTable->glIsBuffer(buffer);}
+inline void glVertexAttribI1iv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1IVPROC)this->m_functions[2803];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI1iv(index,v);}
+inline void glGetFinalCombinerInputParameterfvNV(GLenum variable,GLenum pname,GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)this->m_functions[2804];if(direct_)return direct_(variable,pname,params);return this->m_rawTable->glGetFinalCombinerInputParameterfvNV(variable,pname,params);}
+inline void glMultiTexCoord3bvOES(GLenum texture,const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3BVOESPROC)this->m_functions[2805];if(direct_)return direct_(texture,coords);return this->m_rawTable->glMultiTexCoord3bvOES(texture,coords);}
+inline void glVertexAttribDivisor(GLuint index,GLuint divisor)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBDIVISORPROC)this->m_functions[2806];if(direct_)return direct_(index,divisor);return this->m_rawTable->glVertexAttribDivisor(index,divisor);}
+inline void glCopyBufferSubData(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{auto const direct_ = (FunctionTable::PFNGLCOPYBUFFERSUBDATAPROC)this->m_functions[2807];if(direct_)return direct_(readTarget,writeTarget,readOffset,writeOffset,size);return this->m_rawTable->glCopyBufferSubData(readTarget,writeTarget,readOffset,writeOffset,size);}
+inline GLuint glBindTexGenParameterEXT(GLenum unit,GLenum coord,GLenum value)const{auto const direct_ = (FunctionTable::PFNGLBINDTEXGENPARAMETEREXTPROC)this->m_functions[2808];if(direct_)return direct_(unit,coord,value);return this->m_rawTable->glBindTexGenParameterEXT(unit,coord,value);}
+inline void glNormalStream3bATI(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3BATIPROC)this->m_functions[2809];if(direct_)return direct_(stream,nx,ny,nz);return this->m_rawTable->glNormalStream3bATI(stream,nx,ny,nz);}
+inline void glTexStorageMem2DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{auto const direct_ = (FunctionTable::PFNGLTEXSTORAGEMEM2DEXTPROC)this->m_functions[2810];if(direct_)return direct_(target,levels,internalFormat,width,height,memory,offset);return this->m_rawTable->glTexStorageMem2DEXT(target,levels,internalFormat,width,height,memory,offset);}
+inline void glTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE2DEXTPROC)this->m_functions[2811];if(direct_)return direct_(texture,target,level,internalformat,width,height,border,format,type,pixels);return this->m_rawTable->glTextureImage2DEXT(texture,target,level,internalformat,width,height,border,format,type,pixels);}
+inline void glGetColorTableParameteriv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETCOLORTABLEPARAMETERIVPROC)this->m_functions[2812];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetColorTableParameteriv(target,pname,params);}
+inline void glActiveTextureARB(GLenum texture)const{auto const direct_ = (FunctionTable::PFNGLACTIVETEXTUREARBPROC)this->m_functions[2813];if(direct_)return direct_(texture);return this->m_rawTable->glActiveTextureARB(texture);}
+inline void glTexCoord4xOES(GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD4XOESPROC)this->m_functions[2814];if(direct_)return direct_(s,t,r,q);return this->m_rawTable->glTexCoord4xOES(s,t,r,q);}
+inline void glNamedBufferStorageExternalEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{auto const direct_ = (FunctionTable::PFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)this->m_functions[2815];if(direct_)return direct_(buffer,offset,size,clientBuffer,flags);return this->m_rawTable->glNamedBufferStorageExternalEXT(buffer,offset,size,clientBuffer,flags);}
+inline void glSecondaryColor3fvEXT(const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLSECONDARYCOLOR3FVEXTPROC)this->m_functions[2816];if(direct_)return direct_(v);return this->m_rawTable->glSecondaryColor3fvEXT(v);}
+inline void glUniformMatrix4x2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX4X2FVPROC)this->m_functions[2817];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix4x2fv(location,count,transpose,value);}
+inline void glStartInstrumentsSGIX()const{auto const direct_ = (FunctionTable::PFNGLSTARTINSTRUMENTSSGIXPROC)this->m_functions[2818];if(direct_)return direct_();return this->m_rawTable->glStartInstrumentsSGIX();}
+inline void glProgramNamedParameter4fvNV(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)this->m_functions[2819];if(direct_)return direct_(id,len,name,v);return this->m_rawTable->glProgramNamedParameter4fvNV(id,len,name,v);}
+inline void glEndVideoCaptureNV(GLuint video_capture_slot)const{auto const direct_ = (FunctionTable::PFNGLENDVIDEOCAPTURENVPROC)this->m_functions[2820];if(direct_)return direct_(video_capture_slot);return this->m_rawTable->glEndVideoCaptureNV(video_capture_slot);}
+inline GLuint glGenLists(GLsizei range)const{auto const direct_ = (FunctionTable::PFNGLGENLISTSPROC)this->m_functions[2821];if(direct_)return direct_(range);return this->m_rawTable->glGenLists(range);}
+inline void glUniform1fARB(GLint location,GLfloat v0)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1FARBPROC)this->m_functions[2822];if(direct_)return direct_(location,v0);return this->m_rawTable->glUniform1fARB(location,v0);}
+inline void glNamedFramebufferTexture1DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)this->m_functions[2823];if(direct_)return direct_(framebuffer,attachment,textarget,texture,level);return this->m_rawTable->glNamedFramebufferTexture1DEXT(framebuffer,attachment,textarget,texture,level);}
+inline void* glMapBufferRange(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access)const{auto const direct_ = (FunctionTable::PFNGLMAPBUFFERRANGEPROC)this->m_functions[2824];if(direct_)return direct_(target,offset,length,access);return this->m_rawTable->glMapBufferRange(target,offset,length,access);}
+inline void glMultiDrawElementsIndirectCountARB(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)this->m_functions[2825];if(direct_)return direct_(mode,type,indirect,drawcount,maxdrawcount,stride);return this->m_rawTable->glMultiDrawElementsIndirectCountARB(mode,type,indirect,drawcount,maxdrawcount,stride);}
+inline void glProgramUniformMatrix4x2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)this->m_functions[2826];if(direct_)return direct_(program,location,count,transpose,value);return this->m_rawTable->glProgramUniformMatrix4x2fv(program,location,count,transpose,value);}
+inline void glGetTextureParameterIivEXT(GLuint texture,GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXTUREPARAMETERIIVEXTPROC)this->m_functions[2827];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glGetTextureParameterIivEXT(texture,target,pname,params);}
+inline void glMultiTexCoord3hNV(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD3HNVPROC)this->m_functions[2828];if(direct_)return direct_(target,s,t,r);return this->m_rawTable->glMultiTexCoord3hNV(target,s,t,r);}
+inline void glNamedProgramLocalParametersI4uivEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)this->m_functions[2829];if(direct_)return direct_(program,target,index,count,params);return this->m_rawTable->glNamedProgramLocalParametersI4uivEXT(program,target,index,count,params);}
+inline void glEndList()const{auto const direct_ = (FunctionTable::PFNGLENDLISTPROC)this->m_functions[2830];if(direct_)return direct_();return this->m_rawTable->glEndList();}
+inline void glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)this->m_functions[2831];if(direct_)return direct_(s,t,r,g,b,a,nx,ny,nz,x,y,z);return this->m_rawTable->glTexCoord2fColor4fNormal3fVertex3fSUN(s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+inline void glGenTransformFeedbacksNV(GLsizei n,GLuint* ids)const{auto const direct_ = (FunctionTable::PFNGLGENTRANSFORMFEEDBACKSNVPROC)this->m_functions[2832];if(direct_)return direct_(n,ids);return this->m_rawTable->glGenTransformFeedbacksNV(n,ids);}
+inline void glEdgeFlagv(const GLboolean* flag)const{auto const direct_ = (FunctionTable::PFNGLEDGEFLAGVPROC)this->m_functions[2833];if(direct_)return direct_(flag);return this->m_rawTable->glEdgeFlagv(flag);}
+inline void glVertexAttribI2iv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI2IVPROC)this->m_functions[2834];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttribI2iv(index,v);}
+inline void glCopyMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{auto const direct_ = (FunctionTable::PFNGLCOPYMULTITEXIMAGE2DEXTPROC)this->m_functions[2835];if(direct_)return direct_(texunit,target,level,internalformat,x,y,width,height,border);return this->m_rawTable->glCopyMultiTexImage2DEXT(texunit,target,level,internalformat,x,y,width,height,border);}
+inline void glUniformMatrix3x2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3X2DVPROC)this->m_functions[2836];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3x2dv(location,count,transpose,value);}
+inline void glTexImage3DMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)this->m_functions[2837];if(direct_)return direct_(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);return this->m_rawTable->glTexImage3DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+inline void glGetShaderPrecisionFormat(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision)const{auto const direct_ = (FunctionTable::PFNGLGETSHADERPRECISIONFORMATPROC)this->m_functions[2838];if(direct_)return direct_(shadertype,precisiontype,range,precision);return this->m_rawTable->glGetShaderPrecisionFormat(shadertype,precisiontype,range,precision);}
+inline void glTexSubImage4DSGIS(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXSUBIMAGE4DSGISPROC)this->m_functions[2839];if(direct_)return direct_(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);return this->m_rawTable->glTexSubImage4DSGIS(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);}
+inline void glRasterSamplesEXT(GLuint samples,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLRASTERSAMPLESEXTPROC)this->m_functions[2840];if(direct_)return direct_(samples,fixedsamplelocations);return this->m_rawTable->glRasterSamplesEXT(samples,fixedsamplelocations);}
+inline void glTextureView(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREVIEWPROC)this->m_functions[2841];if(direct_)return direct_(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);return this->m_rawTable->glTextureView(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);}
+inline void glEvalMapsNV(GLenum target,GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLEVALMAPSNVPROC)this->m_functions[2842];if(direct_)return direct_(target,mode);return this->m_rawTable->glEvalMapsNV(target,mode);}
+inline GLint glGetFragDataLocationEXT(GLuint program,const GLchar* name)const{auto const direct_ = (FunctionTable::PFNGLGETFRAGDATALOCATIONEXTPROC)this->m_functions[2843];if(direct_)return direct_(program,name);return this->m_rawTable->glGetFragDataLocationEXT(program,name);}
+inline void glGetCompressedMultiTexImageEXT(GLenum texunit,GLenum target,GLint lod,void* img)const{auto const direct_ = (FunctionTable::PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)this->m_functions[2844];if(direct_)return direct_(texunit,target,lod,img);return this->m_rawTable->glGetCompressedMultiTexImageEXT(texunit,target,lod,img);}
+inline void glIndexMask(GLuint mask)const{auto const direct_ = (FunctionTable::PFNGLINDEXMASKPROC)this->m_functions[2845];if(direct_)return direct_(mask);return this->m_rawTable->glIndexMask(mask);}
+inline void glPushClientAttrib(GLbitfield mask)const{auto const direct_ = (FunctionTable::PFNGLPUSHCLIENTATTRIBPROC)this->m_functions[2846];if(direct_)return direct_(mask);return this->m_rawTable->glPushClientAttrib(mask);}
+inline void glShaderSource(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length)const{auto const direct_ = (FunctionTable::PFNGLSHADERSOURCEPROC)this->m_functions[2847];if(direct_)return direct_(shader,count,string,length);return this->m_rawTable->glShaderSource(shader,count,string,length);}
+inline void glDispatchComputeGroupSizeARB(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z)const{auto const direct_ = (FunctionTable::PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)this->m_functions[2848];if(direct_)return direct_(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);return this->m_rawTable->glDispatchComputeGroupSizeARB(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);}
+inline void glLGPUNamedBufferSubDataNVX(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{auto const direct_ = (FunctionTable::PFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)this->m_functions[2849];if(direct_)return direct_(gpuMask,buffer,offset,size,data);return this->m_rawTable->glLGPUNamedBufferSubDataNVX(gpuMask,buffer,offset,size,data);}
+inline void glGetnPixelMapfv(GLenum map,GLsizei bufSize,GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPFVPROC)this->m_functions[2850];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapfv(map,bufSize,values);}
+inline void glTexCoordP2uiv(GLenum type,const GLuint* coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP2UIVPROC)this->m_functions[2851];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP2uiv(type,coords);}
+inline void glUniform2f(GLint location,GLfloat v0,GLfloat v1)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM2FPROC)this->m_functions[2852];if(direct_)return direct_(location,v0,v1);return this->m_rawTable->glUniform2f(location,v0,v1);}
+inline void glGetNamedBufferParameteri64v(GLuint buffer,GLenum pname,GLint64* params)const{auto const direct_ = (FunctionTable::PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)this->m_functions[2853];if(direct_)return direct_(buffer,pname,params);return this->m_rawTable->glGetNamedBufferParameteri64v(buffer,pname,params);}
+inline void glCommandListSegmentsNV(GLuint list,GLuint segments)const{auto const direct_ = (FunctionTable::PFNGLCOMMANDLISTSEGMENTSNVPROC)this->m_functions[2854];if(direct_)return direct_(list,segments);return this->m_rawTable->glCommandListSegmentsNV(list,segments);}
+inline void glTextureParameterIivEXT(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREPARAMETERIIVEXTPROC)this->m_functions[2855];if(direct_)return direct_(texture,target,pname,params);return this->m_rawTable->glTextureParameterIivEXT(texture,target,pname,params);}
+inline void glMultiTexParameterfvEXT(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXPARAMETERFVEXTPROC)this->m_functions[2856];if(direct_)return direct_(texunit,target,pname,params);return this->m_rawTable->glMultiTexParameterfvEXT(texunit,target,pname,params);}
+inline void glProgramUniform2ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2UI64ARBPROC)this->m_functions[2857];if(direct_)return direct_(program,location,x,y);return this->m_rawTable->glProgramUniform2ui64ARB(program,location,x,y);}
+inline void glVertex4d(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4DPROC)this->m_functions[2858];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4d(x,y,z,w);}
+inline GLuint glNewObjectBufferATI(GLsizei size,const void* pointer,GLenum usage)const{auto const direct_ = (FunctionTable::PFNGLNEWOBJECTBUFFERATIPROC)this->m_functions[2859];if(direct_)return direct_(size,pointer,usage);return this->m_rawTable->glNewObjectBufferATI(size,pointer,usage);}
+inline void glViewportSwizzleNV(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew)const{auto const direct_ = (FunctionTable::PFNGLVIEWPORTSWIZZLENVPROC)this->m_functions[2860];if(direct_)return direct_(index,swizzlex,swizzley,swizzlez,swizzlew);return this->m_rawTable->glViewportSwizzleNV(index,swizzlex,swizzley,swizzlez,swizzlew);}
+inline void glBufferData(GLenum target,GLsizeiptr size,const void* data,GLenum usage)const{auto const direct_ = (FunctionTable::PFNGLBUFFERDATAPROC)this->m_functions[2861];if(direct_)return direct_(target,size,data,usage);return this->m_rawTable->glBufferData(target,size,data,usage);}
+inline void glTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{auto const direct_ = (FunctionTable::PFNGLTEXTUREIMAGE1DEXTPROC)this->m_functions[2862];if(direct_)return direct_(texture,target,level,internalformat,width,border,format,type,pixels);return this->m_rawTable->glTextureImage1DEXT(texture,target,level,internalformat,width,border,format,type,pixels);}
+inline void glGetTexParameterIiv(GLenum target,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETTEXPARAMETERIIVPROC)this->m_functions[2863];if(direct_)return direct_(target,pname,params);return this->m_rawTable->glGetTexParameterIiv(target,pname,params);}
+inline void glCopyTexSubImage1DEXT(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXSUBIMAGE1DEXTPROC)this->m_functions[2864];if(direct_)return direct_(target,level,xoffset,x,y,width);return this->m_rawTable->glCopyTexSubImage1DEXT(target,level,xoffset,x,y,width);}
+inline void glVertex4f(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{auto const direct_ = (FunctionTable::PFNGLVERTEX4FPROC)this->m_functions[2865];if(direct_)return direct_(x,y,z,w);return this->m_rawTable->glVertex4f(x,y,z,w);}
+inline void glUniformMatrix3fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORMMATRIX3FVARBPROC)this->m_functions[2866];if(direct_)return direct_(location,count,transpose,value);return this->m_rawTable->glUniformMatrix3fvARB(location,count,transpose,value);}
+inline void glTexCoordP1ui(GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLTEXCOORDP1UIPROC)this->m_functions[2867];if(direct_)return direct_(type,coords);return this->m_rawTable->glTexCoordP1ui(type,coords);}
+inline void glPointParameterfvEXT(GLenum pname,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLPOINTPARAMETERFVEXTPROC)this->m_functions[2868];if(direct_)return direct_(pname,params);return this->m_rawTable->glPointParameterfvEXT(pname,params);}
+inline void glUniform4fARB(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM4FARBPROC)this->m_functions[2869];if(direct_)return direct_(location,v0,v1,v2,v3);return this->m_rawTable->glUniform4fARB(location,v0,v1,v2,v3);}
+inline void glImportMemoryFdEXT(GLuint memory,GLuint64 size,GLenum handleType,GLint fd)const{auto const direct_ = (FunctionTable::PFNGLIMPORTMEMORYFDEXTPROC)this->m_functions[2870];if(direct_)return direct_(memory,size,handleType,fd);return this->m_rawTable->glImportMemoryFdEXT(memory,size,handleType,fd);}
+inline void glCopyTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYTEXTURESUBIMAGE3DPROC)this->m_functions[2871];if(direct_)return direct_(texture,level,xoffset,yoffset,zoffset,x,y,width,height);return this->m_rawTable->glCopyTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,x,y,width,height);}
+inline void glMultiTexCoord2fv(GLenum target,const GLfloat* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2FVPROC)this->m_functions[2872];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord2fv(target,v);}
+inline void glNamedFramebufferSamplePositionsfvAMD(GLuint framebuffer,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{auto const direct_ = (FunctionTable::PFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)this->m_functions[2873];if(direct_)return direct_(framebuffer,numsamples,pixelindex,values);return this->m_rawTable->glNamedFramebufferSamplePositionsfvAMD(framebuffer,numsamples,pixelindex,values);}
+inline void glNormalP3ui(GLenum type,GLuint coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALP3UIPROC)this->m_functions[2874];if(direct_)return direct_(type,coords);return this->m_rawTable->glNormalP3ui(type,coords);}
+inline void glDrawRangeElementArrayATI(GLenum mode,GLuint start,GLuint end,GLsizei count)const{auto const direct_ = (FunctionTable::PFNGLDRAWRANGEELEMENTARRAYATIPROC)this->m_functions[2875];if(direct_)return direct_(mode,start,end,count);return this->m_rawTable->glDrawRangeElementArrayATI(mode,start,end,count);}
+inline void glVertexAttribI1i(GLuint index,GLint x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIBI1IPROC)this->m_functions[2876];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttribI1i(index,x);}
+inline void glDrawArraysInstancedARB(GLenum mode,GLint first,GLsizei count,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSINSTANCEDARBPROC)this->m_functions[2877];if(direct_)return direct_(mode,first,count,primcount);return this->m_rawTable->glDrawArraysInstancedARB(mode,first,count,primcount);}
+inline void glEnableVertexAttribAPPLE(GLuint index,GLenum pname)const{auto const direct_ = (FunctionTable::PFNGLENABLEVERTEXATTRIBAPPLEPROC)this->m_functions[2878];if(direct_)return direct_(index,pname);return this->m_rawTable->glEnableVertexAttribAPPLE(index,pname);}
+inline GLuint glGetDebugMessageLogARB(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{auto const direct_ = (FunctionTable::PFNGLGETDEBUGMESSAGELOGARBPROC)this->m_functions[2879];if(direct_)return direct_(count,bufSize,sources,types,ids,severities,lengths,messageLog);return this->m_rawTable->glGetDebugMessageLogARB(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+inline void glGetPathTexGenfvNV(GLenum texCoordSet,GLenum pname,GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLGETPATHTEXGENFVNVPROC)this->m_functions[2880];if(direct_)return direct_(texCoordSet,pname,value);return this->m_rawTable->glGetPathTexGenfvNV(texCoordSet,pname,value);}
+inline void glNamedProgramLocalParameters4fvEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{auto const direct_ = (FunctionTable::PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)this->m_functions[2881];if(direct_)return direct_(program,target,index,count,params);return this->m_rawTable->glNamedProgramLocalParameters4fvEXT(program,target,index,count,params);}
+inline void glQueryResourceTagNV(GLint tagId,const GLchar* tagString)const{auto const direct_ = (FunctionTable::PFNGLQUERYRESOURCETAGNVPROC)this->m_functions[2882];if(direct_)return direct_(tagId,tagString);return this->m_rawTable->glQueryResourceTagNV(tagId,tagString);}
+inline void glVertexStream3fvATI(GLenum stream,const GLfloat* coords)const{auto const direct_ = (FunctionTable::PFNGLVERTEXSTREAM3FVATIPROC)this->m_functions[2883];if(direct_)return direct_(stream,coords);return this->m_rawTable->glVertexStream3fvATI(stream,coords);}
+inline void glFramebufferTexture3D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{auto const direct_ = (FunctionTable::PFNGLFRAMEBUFFERTEXTURE3DPROC)this->m_functions[2884];if(direct_)return direct_(target,attachment,textarget,texture,level,zoffset);return this->m_rawTable->glFramebufferTexture3D(target,attachment,textarget,texture,level,zoffset);}
+inline void glCompressedTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{auto const direct_ = (FunctionTable::PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)this->m_functions[2885];if(direct_)return direct_(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);return this->m_rawTable->glCompressedTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+inline void glWindowPos3dv(const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLWINDOWPOS3DVPROC)this->m_functions[2886];if(direct_)return direct_(v);return this->m_rawTable->glWindowPos3dv(v);}
+inline void glCopyConvolutionFilter2D(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{auto const direct_ = (FunctionTable::PFNGLCOPYCONVOLUTIONFILTER2DPROC)this->m_functions[2887];if(direct_)return direct_(target,internalformat,x,y,width,height);return this->m_rawTable->glCopyConvolutionFilter2D(target,internalformat,x,y,width,height);}
+inline void glReadInstrumentsSGIX(GLint marker)const{auto const direct_ = (FunctionTable::PFNGLREADINSTRUMENTSSGIXPROC)this->m_functions[2888];if(direct_)return direct_(marker);return this->m_rawTable->glReadInstrumentsSGIX(marker);}
+inline void glProgramUniform2dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM2DVEXTPROC)this->m_functions[2889];if(direct_)return direct_(program,location,count,value);return this->m_rawTable->glProgramUniform2dvEXT(program,location,count,value);}
+inline void glSamplerParameterfv(GLuint sampler,GLenum pname,const GLfloat* param)const{auto const direct_ = (FunctionTable::PFNGLSAMPLERPARAMETERFVPROC)this->m_functions[2890];if(direct_)return direct_(sampler,pname,param);return this->m_rawTable->glSamplerParameterfv(sampler,pname,param);}
+inline void glBindBufferARB(GLenum target,GLuint buffer)const{auto const direct_ = (FunctionTable::PFNGLBINDBUFFERARBPROC)this->m_functions[2891];if(direct_)return direct_(target,buffer);return this->m_rawTable->glBindBufferARB(target,buffer);}
+inline void glVertexAttrib1sNV(GLuint index,GLshort x)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB1SNVPROC)this->m_functions[2892];if(direct_)return direct_(index,x);return this->m_rawTable->glVertexAttrib1sNV(index,x);}
+inline void glGetMaterialiv(GLenum face,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETMATERIALIVPROC)this->m_functions[2893];if(direct_)return direct_(face,pname,params);return this->m_rawTable->glGetMaterialiv(face,pname,params);}
+inline void glUniform1fv(GLint location,GLsizei count,const GLfloat* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1FVPROC)this->m_functions[2894];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1fv(location,count,value);}
+inline void glBeginOcclusionQueryNV(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLBEGINOCCLUSIONQUERYNVPROC)this->m_functions[2895];if(direct_)return direct_(id);return this->m_rawTable->glBeginOcclusionQueryNV(id);}
+inline void glGenFencesAPPLE(GLsizei n,GLuint* fences)const{auto const direct_ = (FunctionTable::PFNGLGENFENCESAPPLEPROC)this->m_functions[2896];if(direct_)return direct_(n,fences);return this->m_rawTable->glGenFencesAPPLE(n,fences);}
+inline void glScissorIndexedv(GLuint index,const GLint* v)const{auto const direct_ = (FunctionTable::PFNGLSCISSORINDEXEDVPROC)this->m_functions[2897];if(direct_)return direct_(index,v);return this->m_rawTable->glScissorIndexedv(index,v);}
+inline void glDisableVariantClientStateEXT(GLuint id)const{auto const direct_ = (FunctionTable::PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)this->m_functions[2898];if(direct_)return direct_(id);return this->m_rawTable->glDisableVariantClientStateEXT(id);}
+inline void glMinmaxEXT(GLenum target,GLenum internalformat,GLboolean sink)const{auto const direct_ = (FunctionTable::PFNGLMINMAXEXTPROC)this->m_functions[2899];if(direct_)return direct_(target,internalformat,sink);return this->m_rawTable->glMinmaxEXT(target,internalformat,sink);}
+inline void glNormalPointervINTEL(GLenum type,const void** pointer)const{auto const direct_ = (FunctionTable::PFNGLNORMALPOINTERVINTELPROC)this->m_functions[2900];if(direct_)return direct_(type,pointer);return this->m_rawTable->glNormalPointervINTEL(type,pointer);}
+inline void glNormal3s(GLshort nx,GLshort ny,GLshort nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3SPROC)this->m_functions[2901];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3s(nx,ny,nz);}
+inline void glGetnPixelMapuiv(GLenum map,GLsizei bufSize,GLuint* values)const{auto const direct_ = (FunctionTable::PFNGLGETNPIXELMAPUIVPROC)this->m_functions[2902];if(direct_)return direct_(map,bufSize,values);return this->m_rawTable->glGetnPixelMapuiv(map,bufSize,values);}
+inline void glNormalStream3bvATI(GLenum stream,const GLbyte* coords)const{auto const direct_ = (FunctionTable::PFNGLNORMALSTREAM3BVATIPROC)this->m_functions[2903];if(direct_)return direct_(stream,coords);return this->m_rawTable->glNormalStream3bvATI(stream,coords);}
+inline void glGetObjectParameterivAPPLE(GLenum objectType,GLuint name,GLenum pname,GLint* params)const{auto const direct_ = (FunctionTable::PFNGLGETOBJECTPARAMETERIVAPPLEPROC)this->m_functions[2904];if(direct_)return direct_(objectType,name,pname,params);return this->m_rawTable->glGetObjectParameterivAPPLE(objectType,name,pname,params);}
+inline void glNormal3i(GLint nx,GLint ny,GLint nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3IPROC)this->m_functions[2905];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3i(nx,ny,nz);}
+inline void glUniform1ivARB(GLint location,GLsizei count,const GLint* value)const{auto const direct_ = (FunctionTable::PFNGLUNIFORM1IVARBPROC)this->m_functions[2906];if(direct_)return direct_(location,count,value);return this->m_rawTable->glUniform1ivARB(location,count,value);}
+inline void glNormal3d(GLdouble nx,GLdouble ny,GLdouble nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3DPROC)this->m_functions[2907];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3d(nx,ny,nz);}
+inline void glUpdateObjectBufferATI(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve)const{auto const direct_ = (FunctionTable::PFNGLUPDATEOBJECTBUFFERATIPROC)this->m_functions[2908];if(direct_)return direct_(buffer,offset,size,pointer,preserve);return this->m_rawTable->glUpdateObjectBufferATI(buffer,offset,size,pointer,preserve);}
+inline void glNormal3b(GLbyte nx,GLbyte ny,GLbyte nz)const{auto const direct_ = (FunctionTable::PFNGLNORMAL3BPROC)this->m_functions[2909];if(direct_)return direct_(nx,ny,nz);return this->m_rawTable->glNormal3b(nx,ny,nz);}
+inline GLint glGetUniformBufferSizeEXT(GLuint program,GLint location)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMBUFFERSIZEEXTPROC)this->m_functions[2910];if(direct_)return direct_(program,location);return this->m_rawTable->glGetUniformBufferSizeEXT(program,location);}
+inline void glMultiTexCoord4dv(GLenum target,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD4DVPROC)this->m_functions[2911];if(direct_)return direct_(target,v);return this->m_rawTable->glMultiTexCoord4dv(target,v);}
+inline void glProgramUniform3i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z)const{auto const direct_ = (FunctionTable::PFNGLPROGRAMUNIFORM3I64ARBPROC)this->m_functions[2912];if(direct_)return direct_(program,location,x,y,z);return this->m_rawTable->glProgramUniform3i64ARB(program,location,x,y,z);}
+inline void glVertexAttrib2d(GLuint index,GLdouble x,GLdouble y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2DPROC)this->m_functions[2913];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2d(index,x,y);}
+inline void glVertexAttrib2f(GLuint index,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2FPROC)this->m_functions[2914];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2f(index,x,y);}
+inline void glMultiDrawElementsEXT(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount)const{auto const direct_ = (FunctionTable::PFNGLMULTIDRAWELEMENTSEXTPROC)this->m_functions[2915];if(direct_)return direct_(mode,count,type,indices,primcount);return this->m_rawTable->glMultiDrawElementsEXT(mode,count,type,indices,primcount);}
+inline void glVertexAttrib3dv(GLuint index,const GLdouble* v)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB3DVPROC)this->m_functions[2916];if(direct_)return direct_(index,v);return this->m_rawTable->glVertexAttrib3dv(index,v);}
+inline void glMultiTexCoord2bOES(GLenum texture,GLbyte s,GLbyte t)const{auto const direct_ = (FunctionTable::PFNGLMULTITEXCOORD2BOESPROC)this->m_functions[2917];if(direct_)return direct_(texture,s,t);return this->m_rawTable->glMultiTexCoord2bOES(texture,s,t);}
+inline void glVertexAttrib2s(GLuint index,GLshort x,GLshort y)const{auto const direct_ = (FunctionTable::PFNGLVERTEXATTRIB2SPROC)this->m_functions[2918];if(direct_)return direct_(index,x,y);return this->m_rawTable->glVertexAttrib2s(index,x,y);}
+inline void glTexImage3DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{auto const direct_ = (FunctionTable::PFNGLTEXIMAGE3DMULTISAMPLEPROC)this->m_functions[2919];if(direct_)return direct_(target,samples,internalformat,width,height,depth,fixedsamplelocations);return this->m_rawTable->glTexImage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+inline GLuint glGetUniformBlockIndex(GLuint program,const GLchar* uniformBlockName)const{auto const direct_ = (FunctionTable::PFNGLGETUNIFORMBLOCKINDEXPROC)this->m_functions[2920];if(direct_)return direct_(program,uniformBlockName);return this->m_rawTable->glGetUniformBlockIndex(program,uniformBlockName);}
+inline GLboolean glReleaseKeyedMutexWin32EXT(GLuint memory,GLuint64 key)const{auto const direct_ = (FunctionTable::PFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)this->m_functions[2921];if(direct_)return direct_(memory,key);return this->m_rawTable->glReleaseKeyedMutexWin32EXT(memory,key);}
+inline void glFrontFace(GLenum mode)const{auto const direct_ = (FunctionTable::PFNGLFRONTFACEPROC)this->m_functions[2922];if(direct_)return direct_(mode);return this->m_rawTable->glFrontFace(mode);}
+inline void glEvalCoord1xOES(GLfixed u)const{auto const direct_ = (FunctionTable::PFNGLEVALCOORD1XOESPROC)this->m_functions[2923];if(direct_)return direct_(u);return this->m_rawTable->glEvalCoord1xOES(u);}
+inline void glDrawArraysInstancedBaseInstance(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{auto const direct_ = (FunctionTable::PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)this->m_functions[2924];if(direct_)return direct_(mode,first,count,instancecount,baseinstance);return this->m_rawTable->glDrawArraysInstancedBaseInstance(mode,first,count,instancecount,baseinstance);}
+inline GLboolean glIsPointInStrokePathNV(GLuint path,GLfloat x,GLfloat y)const{auto const direct_ = (FunctionTable::PFNGLISPOINTINSTROKEPATHNVPROC)this->m_functions[2925];if(direct_)return direct_(path,x,y);return this->m_rawTable->glIsPointInStrokePathNV(path,x,y);}
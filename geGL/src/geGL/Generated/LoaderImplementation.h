@@ -2924,3 +2924,2929 @@ void m_glFrontFace_impl(GLenum mode)const{this->m_glFrontFace(mode);}
 void m_glEvalCoord1xOES_impl(GLfixed u)const{this->m_glEvalCoord1xOES(u);}
 void m_glDrawArraysInstancedBaseInstance_impl(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{this->m_glDrawArraysInstancedBaseInstance(mode,first,count,instancecount,baseinstance);}
 GLboolean m_glIsPointInStrokePathNV_impl(GLuint path,GLfloat x,GLfloat y)const{return this->m_glIsPointInStrokePathNV(path,x,y);}
+void m_glMultiDrawArraysIndirectBindlessCountNV_lazy(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{if(!this->m_glMultiDrawArraysIndirectBindlessCountNV)this->m_resolveOrThrow(0);this->m_glMultiDrawArraysIndirectBindlessCountNV(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+void m_glTextureParameterfv_lazy(GLuint texture,GLenum pname,const GLfloat* param)const{if(!this->m_glTextureParameterfv)this->m_resolveOrThrow(1);this->m_glTextureParameterfv(texture,pname,param);}
+void m_glGetListParameterivSGIX_lazy(GLuint list,GLenum pname,GLint* params)const{if(!this->m_glGetListParameterivSGIX)this->m_resolveOrThrow(2);this->m_glGetListParameterivSGIX(list,pname,params);}
+void m_glProgramUniform1i64ARB_lazy(GLuint program,GLint location,GLint64 x)const{if(!this->m_glProgramUniform1i64ARB)this->m_resolveOrThrow(3);this->m_glProgramUniform1i64ARB(program,location,x);}
+void m_glVertexArrayElementBuffer_lazy(GLuint vaobj,GLuint buffer)const{if(!this->m_glVertexArrayElementBuffer)this->m_resolveOrThrow(4);this->m_glVertexArrayElementBuffer(vaobj,buffer);}
+void m_glHintPGI_lazy(GLenum target,GLint mode)const{if(!this->m_glHintPGI)this->m_resolveOrThrow(5);this->m_glHintPGI(target,mode);}
+void m_glStencilMaskSeparate_lazy(GLenum face,GLuint mask)const{if(!this->m_glStencilMaskSeparate)this->m_resolveOrThrow(6);this->m_glStencilMaskSeparate(face,mask);}
+void m_glGetFramebufferAttachmentParameterivEXT_lazy(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{if(!this->m_glGetFramebufferAttachmentParameterivEXT)this->m_resolveOrThrow(7);this->m_glGetFramebufferAttachmentParameterivEXT(target,attachment,pname,params);}
+void m_glTextureStorage3DMultisample_lazy(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{if(!this->m_glTextureStorage3DMultisample)this->m_resolveOrThrow(8);this->m_glTextureStorage3DMultisample(texture,samples,internalformat,width,height,depth,fixedsamplelocations);}
+void m_glGetIntegerIndexedvEXT_lazy(GLenum target,GLuint index,GLint* data)const{if(!this->m_glGetIntegerIndexedvEXT)this->m_resolveOrThrow(9);this->m_glGetIntegerIndexedvEXT(target,index,data);}
+void m_glCopyTexImage1D_lazy(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{if(!this->m_glCopyTexImage1D)this->m_resolveOrThrow(10);this->m_glCopyTexImage1D(target,level,internalformat,x,y,width,border);}
+void m_glVertexAttrib4usv_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttrib4usv)this->m_resolveOrThrow(11);this->m_glVertexAttrib4usv(index,v);}
+void m_glTexRenderbufferNV_lazy(GLenum target,GLuint renderbuffer)const{if(!this->m_glTexRenderbufferNV)this->m_resolveOrThrow(12);this->m_glTexRenderbufferNV(target,renderbuffer);}
+void m_glVertexAttrib3hvNV_lazy(GLuint index,const GLhalfNV* v)const{if(!this->m_glVertexAttrib3hvNV)this->m_resolveOrThrow(13);this->m_glVertexAttrib3hvNV(index,v);}
+void m_glProgramUniform4ui64ARB_lazy(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{if(!this->m_glProgramUniform4ui64ARB)this->m_resolveOrThrow(14);this->m_glProgramUniform4ui64ARB(program,location,x,y,z,w);}
+void m_glInstrumentsBufferSGIX_lazy(GLsizei size,GLint* buffer)const{if(!this->m_glInstrumentsBufferSGIX)this->m_resolveOrThrow(15);this->m_glInstrumentsBufferSGIX(size,buffer);}
+void m_glIndexi_lazy(GLint c)const{if(!this->m_glIndexi)this->m_resolveOrThrow(16);this->m_glIndexi(c);}
+void m_glMultiTexCoord2sARB_lazy(GLenum target,GLshort s,GLshort t)const{if(!this->m_glMultiTexCoord2sARB)this->m_resolveOrThrow(17);this->m_glMultiTexCoord2sARB(target,s,t);}
+void m_glProgramEnvParameter4fARB_lazy(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glProgramEnvParameter4fARB)this->m_resolveOrThrow(18);this->m_glProgramEnvParameter4fARB(target,index,x,y,z,w);}
+void m_glCompressedTexSubImage3D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexSubImage3D)this->m_resolveOrThrow(19);this->m_glCompressedTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+void m_glEvalCoord2d_lazy(GLdouble u,GLdouble v)const{if(!this->m_glEvalCoord2d)this->m_resolveOrThrow(20);this->m_glEvalCoord2d(u,v);}
+void m_glEvalCoord2f_lazy(GLfloat u,GLfloat v)const{if(!this->m_glEvalCoord2f)this->m_resolveOrThrow(21);this->m_glEvalCoord2f(u,v);}
+void m_glIndexd_lazy(GLdouble c)const{if(!this->m_glIndexd)this->m_resolveOrThrow(22);this->m_glIndexd(c);}
+void m_glSecondaryColor3hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glSecondaryColor3hvNV)this->m_resolveOrThrow(23);this->m_glSecondaryColor3hvNV(v);}
+void m_glIndexf_lazy(GLfloat c)const{if(!this->m_glIndexf)this->m_resolveOrThrow(24);this->m_glIndexf(c);}
+void m_glFrustumxOES_lazy(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{if(!this->m_glFrustumxOES)this->m_resolveOrThrow(25);this->m_glFrustumxOES(l,r,b,t,n,f);}
+void m_glTextureStorage3DEXT_lazy(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glTextureStorage3DEXT)this->m_resolveOrThrow(26);this->m_glTextureStorage3DEXT(texture,target,levels,internalformat,width,height,depth);}
+void m_glDrawCommandsStatesNV_lazy(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{if(!this->m_glDrawCommandsStatesNV)this->m_resolveOrThrow(27);this->m_glDrawCommandsStatesNV(buffer,indirects,sizes,states,fbos,count);}
+void m_glUniform4uiEXT_lazy(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{if(!this->m_glUniform4uiEXT)this->m_resolveOrThrow(28);this->m_glUniform4uiEXT(location,v0,v1,v2,v3);}
+void m_glProgramUniform3ui64ARB_lazy(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{if(!this->m_glProgramUniform3ui64ARB)this->m_resolveOrThrow(29);this->m_glProgramUniform3ui64ARB(program,location,x,y,z);}
+void m_glIndexs_lazy(GLshort c)const{if(!this->m_glIndexs)this->m_resolveOrThrow(30);this->m_glIndexs(c);}
+void m_glVertexArrayBindVertexBufferEXT_lazy(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{if(!this->m_glVertexArrayBindVertexBufferEXT)this->m_resolveOrThrow(31);this->m_glVertexArrayBindVertexBufferEXT(vaobj,bindingindex,buffer,offset,stride);}
+void m_glConvolutionParameteriEXT_lazy(GLenum target,GLenum pname,GLint params)const{if(!this->m_glConvolutionParameteriEXT)this->m_resolveOrThrow(32);this->m_glConvolutionParameteriEXT(target,pname,params);}
+void m_glColor4ubVertex2fSUN_lazy(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y)const{if(!this->m_glColor4ubVertex2fSUN)this->m_resolveOrThrow(33);this->m_glColor4ubVertex2fSUN(r,g,b,a,x,y);}
+void m_glProgramUniform1ivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform1ivEXT)this->m_resolveOrThrow(34);this->m_glProgramUniform1ivEXT(program,location,count,value);}
+void m_glGetnMapfv_lazy(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{if(!this->m_glGetnMapfv)this->m_resolveOrThrow(35);this->m_glGetnMapfv(target,query,bufSize,v);}
+void m_glTransformFeedbackBufferRange_lazy(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glTransformFeedbackBufferRange)this->m_resolveOrThrow(36);this->m_glTransformFeedbackBufferRange(xfb,index,buffer,offset,size);}
+void m_glPathGlyphsNV_lazy(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{if(!this->m_glPathGlyphsNV)this->m_resolveOrThrow(37);this->m_glPathGlyphsNV(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);}
+void m_glSecondaryColor3fv_lazy(const GLfloat* v)const{if(!this->m_glSecondaryColor3fv)this->m_resolveOrThrow(38);this->m_glSecondaryColor3fv(v);}
+void m_glGetCombinerInputParameterivNV_lazy(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params)const{if(!this->m_glGetCombinerInputParameterivNV)this->m_resolveOrThrow(39);this->m_glGetCombinerInputParameterivNV(stage,portion,variable,pname,params);}
+void m_glEndPerfMonitorAMD_lazy(GLuint monitor)const{if(!this->m_glEndPerfMonitorAMD)this->m_resolveOrThrow(40);this->m_glEndPerfMonitorAMD(monitor);}
+void m_glPointParameterfvARB_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glPointParameterfvARB)this->m_resolveOrThrow(41);this->m_glPointParameterfvARB(pname,params);}
+void m_glVertex2xOES_lazy(GLfixed x)const{if(!this->m_glVertex2xOES)this->m_resolveOrThrow(42);this->m_glVertex2xOES(x);}
+void m_glDrawElementsInstancedBaseInstance_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance)const{if(!this->m_glDrawElementsInstancedBaseInstance)this->m_resolveOrThrow(43);this->m_glDrawElementsInstancedBaseInstance(mode,count,type,indices,instancecount,baseinstance);}
+void m_glMultTransposeMatrixdARB_lazy(const GLdouble* m)const{if(!this->m_glMultTransposeMatrixdARB)this->m_resolveOrThrow(44);this->m_glMultTransposeMatrixdARB(m);}
+void m_glVertexAttribL4dEXT_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexAttribL4dEXT)this->m_resolveOrThrow(45);this->m_glVertexAttribL4dEXT(index,x,y,z,w);}
+void m_glVertex4iv_lazy(const GLint* v)const{if(!this->m_glVertex4iv)this->m_resolveOrThrow(46);this->m_glVertex4iv(v);}
+void m_glCoverStrokePathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glCoverStrokePathInstancedNV)this->m_resolveOrThrow(47);this->m_glCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+void m_glDeformSGIX_lazy(GLbitfield mask)const{if(!this->m_glDeformSGIX)this->m_resolveOrThrow(48);this->m_glDeformSGIX(mask);}
+void m_glUniform2ui64NV_lazy(GLint location,GLuint64EXT x,GLuint64EXT y)const{if(!this->m_glUniform2ui64NV)this->m_resolveOrThrow(49);this->m_glUniform2ui64NV(location,x,y);}
+void m_glCopyPathNV_lazy(GLuint resultPath,GLuint srcPath)const{if(!this->m_glCopyPathNV)this->m_resolveOrThrow(50);this->m_glCopyPathNV(resultPath,srcPath);}
+void m_glVertexAttribP4ui_lazy(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{if(!this->m_glVertexAttribP4ui)this->m_resolveOrThrow(51);this->m_glVertexAttribP4ui(index,type,normalized,value);}
+void m_glVertexAttribL2d_lazy(GLuint index,GLdouble x,GLdouble y)const{if(!this->m_glVertexAttribL2d)this->m_resolveOrThrow(52);this->m_glVertexAttribL2d(index,x,y);}
+void m_glGetMultisamplefv_lazy(GLenum pname,GLuint index,GLfloat* val)const{if(!this->m_glGetMultisamplefv)this->m_resolveOrThrow(53);this->m_glGetMultisamplefv(pname,index,val);}
+void m_glCompressedMultiTexSubImage3DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexSubImage3DEXT)this->m_resolveOrThrow(54);this->m_glCompressedMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_lazy(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{if(!this->m_glVDPAURegisterOutputSurfaceNV)this->m_resolveOrThrow(55);return this->m_glVDPAURegisterOutputSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+void m_glMinSampleShading_lazy(GLfloat value)const{if(!this->m_glMinSampleShading)this->m_resolveOrThrow(56);this->m_glMinSampleShading(value);}
+void m_glProgramUniform4fEXT_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{if(!this->m_glProgramUniform4fEXT)this->m_resolveOrThrow(57);this->m_glProgramUniform4fEXT(program,location,v0,v1,v2,v3);}
+void m_glCoverStrokePathNV_lazy(GLuint path,GLenum coverMode)const{if(!this->m_glCoverStrokePathNV)this->m_resolveOrThrow(58);this->m_glCoverStrokePathNV(path,coverMode);}
+void m_glTextureImage2DMultisampleNV_lazy(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{if(!this->m_glTextureImage2DMultisampleNV)this->m_resolveOrThrow(59);this->m_glTextureImage2DMultisampleNV(texture,target,samples,internalFormat,width,height,fixedSampleLocations);}
+void m_glVertex3bOES_lazy(GLbyte x,GLbyte y,GLbyte z)const{if(!this->m_glVertex3bOES)this->m_resolveOrThrow(60);this->m_glVertex3bOES(x,y,z);}
+void m_glImportMemoryWin32HandleEXT_lazy(GLuint memory,GLuint64 size,GLenum handleType,void* handle)const{if(!this->m_glImportMemoryWin32HandleEXT)this->m_resolveOrThrow(61);this->m_glImportMemoryWin32HandleEXT(memory,size,handleType,handle);}
+void m_glTessellationFactorAMD_lazy(GLfloat factor)const{if(!this->m_glTessellationFactorAMD)this->m_resolveOrThrow(62);this->m_glTessellationFactorAMD(factor);}
+void m_glDebugMessageControl_lazy(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{if(!this->m_glDebugMessageControl)this->m_resolveOrThrow(63);this->m_glDebugMessageControl(source,type,severity,count,ids,enabled);}
+GLboolean m_glIsObjectBufferATI_lazy(GLuint buffer)const{if(!this->m_glIsObjectBufferATI)this->m_resolveOrThrow(64);return this->m_glIsObjectBufferATI(buffer);}
+void m_glPopAttrib_lazy()const{if(!this->m_glPopAttrib)this->m_resolveOrThrow(65);this->m_glPopAttrib();}
+void m_glProgramUniform4iEXT_lazy(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{if(!this->m_glProgramUniform4iEXT)this->m_resolveOrThrow(66);this->m_glProgramUniform4iEXT(program,location,v0,v1,v2,v3);}
+void m_glVertexAttrib4ubNV_lazy(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{if(!this->m_glVertexAttrib4ubNV)this->m_resolveOrThrow(67);this->m_glVertexAttrib4ubNV(index,x,y,z,w);}
+void m_glColorMaterial_lazy(GLenum face,GLenum mode)const{if(!this->m_glColorMaterial)this->m_resolveOrThrow(68);this->m_glColorMaterial(face,mode);}
+void m_glVertexAttrib2svARB_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib2svARB)this->m_resolveOrThrow(69);this->m_glVertexAttrib2svARB(index,v);}
+void m_glMinSampleShadingARB_lazy(GLfloat value)const{if(!this->m_glMinSampleShadingARB)this->m_resolveOrThrow(70);this->m_glMinSampleShadingARB(value);}
+void m_glColor3b_lazy(GLbyte red,GLbyte green,GLbyte blue)const{if(!this->m_glColor3b)this->m_resolveOrThrow(71);this->m_glColor3b(red,green,blue);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_lazy(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)this->m_resolveOrThrow(72);this->m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc,s,t,nx,ny,nz,x,y,z);}
+void m_glColor3f_lazy(GLfloat red,GLfloat green,GLfloat blue)const{if(!this->m_glColor3f)this->m_resolveOrThrow(73);this->m_glColor3f(red,green,blue);}
+void m_glVDPAUGetSurfaceivNV_lazy(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{if(!this->m_glVDPAUGetSurfaceivNV)this->m_resolveOrThrow(74);this->m_glVDPAUGetSurfaceivNV(surface,pname,bufSize,length,values);}
+void m_glColor3d_lazy(GLdouble red,GLdouble green,GLdouble blue)const{if(!this->m_glColor3d)this->m_resolveOrThrow(75);this->m_glColor3d(red,green,blue);}
+void m_glGetnMapiv_lazy(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{if(!this->m_glGetnMapiv)this->m_resolveOrThrow(76);this->m_glGetnMapiv(target,query,bufSize,v);}
+void m_glColor3i_lazy(GLint red,GLint green,GLint blue)const{if(!this->m_glColor3i)this->m_resolveOrThrow(77);this->m_glColor3i(red,green,blue);}
+void m_glGetInternalformatSampleivNV_lazy(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params)const{if(!this->m_glGetInternalformatSampleivNV)this->m_resolveOrThrow(78);this->m_glGetInternalformatSampleivNV(target,internalformat,samples,pname,bufSize,params);}
+void m_glVertexAttrib4ubv_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttrib4ubv)this->m_resolveOrThrow(79);this->m_glVertexAttrib4ubv(index,v);}
+void m_glColor3s_lazy(GLshort red,GLshort green,GLshort blue)const{if(!this->m_glColor3s)this->m_resolveOrThrow(80);this->m_glColor3s(red,green,blue);}
+void m_glVertexAttribs4hvNV_lazy(GLuint index,GLsizei n,const GLhalfNV* v)const{if(!this->m_glVertexAttribs4hvNV)this->m_resolveOrThrow(81);this->m_glVertexAttribs4hvNV(index,n,v);}
+void m_glVertexAttrib4NubvARB_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttrib4NubvARB)this->m_resolveOrThrow(82);this->m_glVertexAttrib4NubvARB(index,v);}
+void m_glMultiTexCoord3hvNV_lazy(GLenum target,const GLhalfNV* v)const{if(!this->m_glMultiTexCoord3hvNV)this->m_resolveOrThrow(83);this->m_glMultiTexCoord3hvNV(target,v);}
+void m_glMatrixPushEXT_lazy(GLenum mode)const{if(!this->m_glMatrixPushEXT)this->m_resolveOrThrow(84);this->m_glMatrixPushEXT(mode);}
+void m_glProgramUniform2fEXT_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{if(!this->m_glProgramUniform2fEXT)this->m_resolveOrThrow(85);this->m_glProgramUniform2fEXT(program,location,v0,v1);}
+void m_glGetVertexArrayIndexediv_lazy(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{if(!this->m_glGetVertexArrayIndexediv)this->m_resolveOrThrow(86);this->m_glGetVertexArrayIndexediv(vaobj,index,pname,param);}
+void m_glBlitFramebuffer_lazy(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{if(!this->m_glBlitFramebuffer)this->m_resolveOrThrow(87);this->m_glBlitFramebuffer(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+void m_glMultiTexCoordP2ui_lazy(GLenum texture,GLenum type,GLuint coords)const{if(!this->m_glMultiTexCoordP2ui)this->m_resolveOrThrow(88);this->m_glMultiTexCoordP2ui(texture,type,coords);}
+void m_glColorPointerListIBM_lazy(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glColorPointerListIBM)this->m_resolveOrThrow(89);this->m_glColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+void m_glVertexAttribL4d_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexAttribL4d)this->m_resolveOrThrow(90);this->m_glVertexAttribL4d(index,x,y,z,w);}
+void m_glGetFragmentMaterialfvSGIX_lazy(GLenum face,GLenum pname,GLfloat* params)const{if(!this->m_glGetFragmentMaterialfvSGIX)this->m_resolveOrThrow(91);this->m_glGetFragmentMaterialfvSGIX(face,pname,params);}
+void m_glVertex2iv_lazy(const GLint* v)const{if(!this->m_glVertex2iv)this->m_resolveOrThrow(92);this->m_glVertex2iv(v);}
+void m_glGetTexEnvxvOES_lazy(GLenum target,GLenum pname,GLfixed* params)const{if(!this->m_glGetTexEnvxvOES)this->m_resolveOrThrow(93);this->m_glGetTexEnvxvOES(target,pname,params);}
+void m_glUniformMatrix3dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix3dv)this->m_resolveOrThrow(94);this->m_glUniformMatrix3dv(location,count,transpose,value);}
+void m_glGetVertexAttribLdvEXT_lazy(GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetVertexAttribLdvEXT)this->m_resolveOrThrow(95);this->m_glGetVertexAttribLdvEXT(index,pname,params);}
+void m_glTexCoordP3uiv_lazy(GLenum type,const GLuint* coords)const{if(!this->m_glTexCoordP3uiv)this->m_resolveOrThrow(96);this->m_glTexCoordP3uiv(type,coords);}
+void m_glDeformationMap3dSGIX_lazy(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points)const{if(!this->m_glDeformationMap3dSGIX)this->m_resolveOrThrow(97);this->m_glDeformationMap3dSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+void m_glResumeTransformFeedback_lazy()const{if(!this->m_glResumeTransformFeedback)this->m_resolveOrThrow(98);this->m_glResumeTransformFeedback();}
+void m_glInsertEventMarkerEXT_lazy(GLsizei length,const GLchar* marker)const{if(!this->m_glInsertEventMarkerEXT)this->m_resolveOrThrow(99);this->m_glInsertEventMarkerEXT(length,marker);}
+void m_glTessellationModeAMD_lazy(GLenum mode)const{if(!this->m_glTessellationModeAMD)this->m_resolveOrThrow(100);this->m_glTessellationModeAMD(mode);}
+void m_glDrawCommandsAddressNV_lazy(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count)const{if(!this->m_glDrawCommandsAddressNV)this->m_resolveOrThrow(101);this->m_glDrawCommandsAddressNV(primitiveMode,indirects,sizes,count);}
+void m_glFogi_lazy(GLenum pname,GLint param)const{if(!this->m_glFogi)this->m_resolveOrThrow(102);this->m_glFogi(pname,param);}
+void m_glGetTexParameterxvOES_lazy(GLenum target,GLenum pname,GLfixed* params)const{if(!this->m_glGetTexParameterxvOES)this->m_resolveOrThrow(103);this->m_glGetTexParameterxvOES(target,pname,params);}
+void m_glVertexPointer_lazy(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{if(!this->m_glVertexPointer)this->m_resolveOrThrow(104);this->m_glVertexPointer(size,type,stride,ptr);}
+void m_glGetPerfMonitorCounterDataAMD_lazy(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten)const{if(!this->m_glGetPerfMonitorCounterDataAMD)this->m_resolveOrThrow(105);this->m_glGetPerfMonitorCounterDataAMD(monitor,pname,dataSize,data,bytesWritten);}
+void m_glFogf_lazy(GLenum pname,GLfloat param)const{if(!this->m_glFogf)this->m_resolveOrThrow(106);this->m_glFogf(pname,param);}
+void m_glMultiTexCoord1d_lazy(GLenum target,GLdouble s)const{if(!this->m_glMultiTexCoord1d)this->m_resolveOrThrow(107);this->m_glMultiTexCoord1d(target,s);}
+void m_glMultiTexCoord1f_lazy(GLenum target,GLfloat s)const{if(!this->m_glMultiTexCoord1f)this->m_resolveOrThrow(108);this->m_glMultiTexCoord1f(target,s);}
+void m_glGetMultiTexParameterivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMultiTexParameterivEXT)this->m_resolveOrThrow(109);this->m_glGetMultiTexParameterivEXT(texunit,target,pname,params);}
+void m_glProgramUniformMatrix3x4fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3x4fvEXT)this->m_resolveOrThrow(110);this->m_glProgramUniformMatrix3x4fvEXT(program,location,count,transpose,value);}
+void m_glVertexAttribI2i_lazy(GLuint index,GLint x,GLint y)const{if(!this->m_glVertexAttribI2i)this->m_resolveOrThrow(111);this->m_glVertexAttribI2i(index,x,y);}
+void m_glMultiTexCoord1i_lazy(GLenum target,GLint s)const{if(!this->m_glMultiTexCoord1i)this->m_resolveOrThrow(112);this->m_glMultiTexCoord1i(target,s);}
+void m_glDeleteSemaphoresEXT_lazy(GLsizei n,const GLuint* semaphores)const{if(!this->m_glDeleteSemaphoresEXT)this->m_resolveOrThrow(113);this->m_glDeleteSemaphoresEXT(n,semaphores);}
+void m_glLoadProgramNV_lazy(GLenum target,GLuint id,GLsizei len,const GLubyte* program)const{if(!this->m_glLoadProgramNV)this->m_resolveOrThrow(114);this->m_glLoadProgramNV(target,id,len,program);}
+void m_glWriteMaskEXT_lazy(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{if(!this->m_glWriteMaskEXT)this->m_resolveOrThrow(115);this->m_glWriteMaskEXT(res,in,outX,outY,outZ,outW);}
+GLenum m_glGetGraphicsResetStatus_lazy()const{if(!this->m_glGetGraphicsResetStatus)this->m_resolveOrThrow(116);return this->m_glGetGraphicsResetStatus();}
+void m_glVertexAttrib1fv_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib1fv)this->m_resolveOrThrow(117);this->m_glVertexAttrib1fv(index,v);}
+void m_glMultiTexCoord1s_lazy(GLenum target,GLshort s)const{if(!this->m_glMultiTexCoord1s)this->m_resolveOrThrow(118);this->m_glMultiTexCoord1s(target,s);}
+void m_glImageTransformParameterfvHP_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glImageTransformParameterfvHP)this->m_resolveOrThrow(119);this->m_glImageTransformParameterfvHP(target,pname,params);}
+void m_glFramebufferTexture2D_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glFramebufferTexture2D)this->m_resolveOrThrow(120);this->m_glFramebufferTexture2D(target,attachment,textarget,texture,level);}
+void m_glGetFragmentLightfvSGIX_lazy(GLenum light,GLenum pname,GLfloat* params)const{if(!this->m_glGetFragmentLightfvSGIX)this->m_resolveOrThrow(121);this->m_glGetFragmentLightfvSGIX(light,pname,params);}
+void m_glListParameterfSGIX_lazy(GLuint list,GLenum pname,GLfloat param)const{if(!this->m_glListParameterfSGIX)this->m_resolveOrThrow(122);this->m_glListParameterfSGIX(list,pname,param);}
+void m_glTexCoord3sv_lazy(const GLshort* v)const{if(!this->m_glTexCoord3sv)this->m_resolveOrThrow(123);this->m_glTexCoord3sv(v);}
+void m_glNamedFramebufferRenderbufferEXT_lazy(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{if(!this->m_glNamedFramebufferRenderbufferEXT)this->m_resolveOrThrow(124);this->m_glNamedFramebufferRenderbufferEXT(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+void m_glFragmentLightModelfSGIX_lazy(GLenum pname,GLfloat param)const{if(!this->m_glFragmentLightModelfSGIX)this->m_resolveOrThrow(125);this->m_glFragmentLightModelfSGIX(pname,param);}
+void m_glIndexPointerEXT_lazy(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{if(!this->m_glIndexPointerEXT)this->m_resolveOrThrow(126);this->m_glIndexPointerEXT(type,stride,count,pointer);}
+void m_glBlendEquationSeparateATI_lazy(GLenum modeRGB,GLenum modeA)const{if(!this->m_glBlendEquationSeparateATI)this->m_resolveOrThrow(127);this->m_glBlendEquationSeparateATI(modeRGB,modeA);}
+void m_glVertexArrayAttribIFormat_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexArrayAttribIFormat)this->m_resolveOrThrow(128);this->m_glVertexArrayAttribIFormat(vaobj,attribindex,size,type,relativeoffset);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_lazy(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)this->m_resolveOrThrow(129);this->m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+void m_glReplacementCodeubvSUN_lazy(const GLubyte* code)const{if(!this->m_glReplacementCodeubvSUN)this->m_resolveOrThrow(130);this->m_glReplacementCodeubvSUN(code);}
+void m_glGenFramebuffers_lazy(GLsizei n,GLuint* framebuffers)const{if(!this->m_glGenFramebuffers)this->m_resolveOrThrow(131);this->m_glGenFramebuffers(n,framebuffers);}
+void m_glPixelMapx_lazy(GLenum map,GLint size,const GLfixed* values)const{if(!this->m_glPixelMapx)this->m_resolveOrThrow(132);this->m_glPixelMapx(map,size,values);}
+void m_glTexSubImage3DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexSubImage3DEXT)this->m_resolveOrThrow(133);this->m_glTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+void m_glGetAttachedShaders_lazy(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders)const{if(!this->m_glGetAttachedShaders)this->m_resolveOrThrow(134);this->m_glGetAttachedShaders(program,maxCount,count,shaders);}
+void m_glGetPixelTexGenParameterfvSGIS_lazy(GLenum pname,GLfloat* params)const{if(!this->m_glGetPixelTexGenParameterfvSGIS)this->m_resolveOrThrow(135);this->m_glGetPixelTexGenParameterfvSGIS(pname,params);}
+void m_glReplacementCodeuiNormal3fVertex3fSUN_lazy(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiNormal3fVertex3fSUN)this->m_resolveOrThrow(136);this->m_glReplacementCodeuiNormal3fVertex3fSUN(rc,nx,ny,nz,x,y,z);}
+GLuint m_glGetDebugMessageLogAMD_lazy(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message)const{if(!this->m_glGetDebugMessageLogAMD)this->m_resolveOrThrow(137);return this->m_glGetDebugMessageLogAMD(count,bufsize,categories,severities,ids,lengths,message);}
+void m_glVertexStream4sATI_lazy(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glVertexStream4sATI)this->m_resolveOrThrow(138);this->m_glVertexStream4sATI(stream,x,y,z,w);}
+void m_glVertexAttribs4dvNV_lazy(GLuint index,GLsizei count,const GLdouble* v)const{if(!this->m_glVertexAttribs4dvNV)this->m_resolveOrThrow(139);this->m_glVertexAttribs4dvNV(index,count,v);}
+void m_glGetnMapdvARB_lazy(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{if(!this->m_glGetnMapdvARB)this->m_resolveOrThrow(140);this->m_glGetnMapdvARB(target,query,bufSize,v);}
+void m_glOrthofOES_lazy(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{if(!this->m_glOrthofOES)this->m_resolveOrThrow(141);this->m_glOrthofOES(l,r,b,t,n,f);}
+void m_glViewportArrayv_lazy(GLuint first,GLsizei count,const GLfloat* v)const{if(!this->m_glViewportArrayv)this->m_resolveOrThrow(142);this->m_glViewportArrayv(first,count,v);}
+void m_glDrawElementArrayATI_lazy(GLenum mode,GLsizei count)const{if(!this->m_glDrawElementArrayATI)this->m_resolveOrThrow(143);this->m_glDrawElementArrayATI(mode,count);}
+void m_glBufferStorageMemEXT_lazy(GLenum target,GLsizeiptr size,GLuint memory,GLuint64 offset)const{if(!this->m_glBufferStorageMemEXT)this->m_resolveOrThrow(144);this->m_glBufferStorageMemEXT(target,size,memory,offset);}
+void m_glGetPathColorGenfvNV_lazy(GLenum color,GLenum pname,GLfloat* value)const{if(!this->m_glGetPathColorGenfvNV)this->m_resolveOrThrow(145);this->m_glGetPathColorGenfvNV(color,pname,value);}
+void m_glWindowPos3iMESA_lazy(GLint x,GLint y,GLint z)const{if(!this->m_glWindowPos3iMESA)this->m_resolveOrThrow(146);this->m_glWindowPos3iMESA(x,y,z);}
+void m_glMultiTexCoord2s_lazy(GLenum target,GLshort s,GLshort t)const{if(!this->m_glMultiTexCoord2s)this->m_resolveOrThrow(147);this->m_glMultiTexCoord2s(target,s,t);}
+void m_glVertex3dv_lazy(const GLdouble* v)const{if(!this->m_glVertex3dv)this->m_resolveOrThrow(148);this->m_glVertex3dv(v);}
+void m_glVertexAttribI3uivEXT_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI3uivEXT)this->m_resolveOrThrow(149);this->m_glVertexAttribI3uivEXT(index,v);}
+void m_glUniform3ui64ARB_lazy(GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{if(!this->m_glUniform3ui64ARB)this->m_resolveOrThrow(150);this->m_glUniform3ui64ARB(location,x,y,z);}
+void m_glVertexAttrib2fvNV_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib2fvNV)this->m_resolveOrThrow(151);this->m_glVertexAttrib2fvNV(index,v);}
+void m_glGetNamedBufferSubDataEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{if(!this->m_glGetNamedBufferSubDataEXT)this->m_resolveOrThrow(152);this->m_glGetNamedBufferSubDataEXT(buffer,offset,size,data);}
+void m_glConvolutionFilter2D_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image)const{if(!this->m_glConvolutionFilter2D)this->m_resolveOrThrow(153);this->m_glConvolutionFilter2D(target,internalformat,width,height,format,type,image);}
+void m_glMemoryBarrierByRegion_lazy(GLbitfield barriers)const{if(!this->m_glMemoryBarrierByRegion)this->m_resolveOrThrow(154);this->m_glMemoryBarrierByRegion(barriers);}
+void m_glVertexArrayBindingDivisor_lazy(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{if(!this->m_glVertexArrayBindingDivisor)this->m_resolveOrThrow(155);this->m_glVertexArrayBindingDivisor(vaobj,bindingindex,divisor);}
+void m_glMatrixRotatedEXT_lazy(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glMatrixRotatedEXT)this->m_resolveOrThrow(156);this->m_glMatrixRotatedEXT(mode,angle,x,y,z);}
+void m_glTexCoord2sv_lazy(const GLshort* v)const{if(!this->m_glTexCoord2sv)this->m_resolveOrThrow(157);this->m_glTexCoord2sv(v);}
+GLboolean m_glIsProgramNV_lazy(GLuint id)const{if(!this->m_glIsProgramNV)this->m_resolveOrThrow(158);return this->m_glIsProgramNV(id);}
+void m_glUniform2dv_lazy(GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glUniform2dv)this->m_resolveOrThrow(159);this->m_glUniform2dv(location,count,value);}
+void m_glGetPixelMapuiv_lazy(GLenum map,GLuint* values)const{if(!this->m_glGetPixelMapuiv)this->m_resolveOrThrow(160);this->m_glGetPixelMapuiv(map,values);}
+void m_glDepthBoundsEXT_lazy(GLclampd zmin,GLclampd zmax)const{if(!this->m_glDepthBoundsEXT)this->m_resolveOrThrow(161);this->m_glDepthBoundsEXT(zmin,zmax);}
+void m_glVertexAttrib4hvNV_lazy(GLuint index,const GLhalfNV* v)const{if(!this->m_glVertexAttrib4hvNV)this->m_resolveOrThrow(162);this->m_glVertexAttrib4hvNV(index,v);}
+void m_glMultiTexParameteriEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLint param)const{if(!this->m_glMultiTexParameteriEXT)this->m_resolveOrThrow(163);this->m_glMultiTexParameteriEXT(texunit,target,pname,param);}
+void m_glGetPointerv_lazy(GLenum pname,GLvoid** params)const{if(!this->m_glGetPointerv)this->m_resolveOrThrow(164);this->m_glGetPointerv(pname,params);}
+void m_glPathCommandsNV_lazy(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{if(!this->m_glPathCommandsNV)this->m_resolveOrThrow(165);this->m_glPathCommandsNV(path,numCommands,commands,numCoords,coordType,coords);}
+void m_glGetListParameterfvSGIX_lazy(GLuint list,GLenum pname,GLfloat* params)const{if(!this->m_glGetListParameterfvSGIX)this->m_resolveOrThrow(166);this->m_glGetListParameterfvSGIX(list,pname,params);}
+void m_glGetUniformuiv_lazy(GLuint program,GLint location,GLuint* params)const{if(!this->m_glGetUniformuiv)this->m_resolveOrThrow(167);this->m_glGetUniformuiv(program,location,params);}
+void m_glDebugMessageInsertAMD_lazy(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf)const{if(!this->m_glDebugMessageInsertAMD)this->m_resolveOrThrow(168);this->m_glDebugMessageInsertAMD(category,severity,id,length,buf);}
+void m_glFrustum_lazy(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{if(!this->m_glFrustum)this->m_resolveOrThrow(169);this->m_glFrustum(left,right,bottom,top,near_val,far_val);}
+void m_glVertexAttribL1ui64vNV_lazy(GLuint index,const GLuint64EXT* v)const{if(!this->m_glVertexAttribL1ui64vNV)this->m_resolveOrThrow(170);this->m_glVertexAttribL1ui64vNV(index,v);}
+void m_glClearColorxOES_lazy(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{if(!this->m_glClearColorxOES)this->m_resolveOrThrow(171);this->m_glClearColorxOES(red,green,blue,alpha);}
+void m_glProgramUniformMatrix3fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3fv)this->m_resolveOrThrow(172);this->m_glProgramUniformMatrix3fv(program,location,count,transpose,value);}
+void m_glSampleMaskIndexedNV_lazy(GLuint index,GLbitfield mask)const{if(!this->m_glSampleMaskIndexedNV)this->m_resolveOrThrow(173);this->m_glSampleMaskIndexedNV(index,mask);}
+void m_glCompileShaderIncludeARB_lazy(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length)const{if(!this->m_glCompileShaderIncludeARB)this->m_resolveOrThrow(174);this->m_glCompileShaderIncludeARB(shader,count,path,length);}
+void m_glGetArrayObjectfvATI_lazy(GLenum array,GLenum pname,GLfloat* params)const{if(!this->m_glGetArrayObjectfvATI)this->m_resolveOrThrow(175);this->m_glGetArrayObjectfvATI(array,pname,params);}
+void m_glVertexStream4svATI_lazy(GLenum stream,const GLshort* coords)const{if(!this->m_glVertexStream4svATI)this->m_resolveOrThrow(176);this->m_glVertexStream4svATI(stream,coords);}
+void m_glMultiTexCoord4iARB_lazy(GLenum target,GLint s,GLint t,GLint r,GLint q)const{if(!this->m_glMultiTexCoord4iARB)this->m_resolveOrThrow(177);this->m_glMultiTexCoord4iARB(target,s,t,r,q);}
+void m_glVariantfvEXT_lazy(GLuint id,const GLfloat* addr)const{if(!this->m_glVariantfvEXT)this->m_resolveOrThrow(178);this->m_glVariantfvEXT(id,addr);}
+void m_glMatrixLoadfEXT_lazy(GLenum mode,const GLfloat* m)const{if(!this->m_glMatrixLoadfEXT)this->m_resolveOrThrow(179);this->m_glMatrixLoadfEXT(mode,m);}
+void m_glLoadIdentityDeformationMapSGIX_lazy(GLbitfield mask)const{if(!this->m_glLoadIdentityDeformationMapSGIX)this->m_resolveOrThrow(180);this->m_glLoadIdentityDeformationMapSGIX(mask);}
+void m_glGetRenderbufferParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetRenderbufferParameteriv)this->m_resolveOrThrow(181);this->m_glGetRenderbufferParameteriv(target,pname,params);}
+void m_glProgramUniform3fEXT_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{if(!this->m_glProgramUniform3fEXT)this->m_resolveOrThrow(182);this->m_glProgramUniform3fEXT(program,location,v0,v1,v2);}
+void m_glNamedRenderbufferStorage_lazy(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glNamedRenderbufferStorage)this->m_resolveOrThrow(183);this->m_glNamedRenderbufferStorage(renderbuffer,internalformat,width,height);}
+void m_glBindFragDataLocation_lazy(GLuint program,GLuint color,const GLchar* name)const{if(!this->m_glBindFragDataLocation)this->m_resolveOrThrow(184);this->m_glBindFragDataLocation(program,color,name);}
+void m_glPolygonOffsetClamp_lazy(GLfloat factor,GLfloat units,GLfloat clamp)const{if(!this->m_glPolygonOffsetClamp)this->m_resolveOrThrow(185);this->m_glPolygonOffsetClamp(factor,units,clamp);}
+void m_glFogCoordPointerListIBM_lazy(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glFogCoordPointerListIBM)this->m_resolveOrThrow(186);this->m_glFogCoordPointerListIBM(type,stride,pointer,ptrstride);}
+GLsync m_glFenceSync_lazy(GLenum condition,GLbitfield flags)const{if(!this->m_glFenceSync)this->m_resolveOrThrow(187);return this->m_glFenceSync(condition,flags);}
+void m_glGetVertexAttribIivEXT_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribIivEXT)this->m_resolveOrThrow(188);this->m_glGetVertexAttribIivEXT(index,pname,params);}
+void m_glFramebufferDrawBuffersEXT_lazy(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{if(!this->m_glFramebufferDrawBuffersEXT)this->m_resolveOrThrow(189);this->m_glFramebufferDrawBuffersEXT(framebuffer,n,bufs);}
+void m_glVertexAttribs4fvNV_lazy(GLuint index,GLsizei count,const GLfloat* v)const{if(!this->m_glVertexAttribs4fvNV)this->m_resolveOrThrow(190);this->m_glVertexAttribs4fvNV(index,count,v);}
+void m_glPauseTransformFeedbackNV_lazy()const{if(!this->m_glPauseTransformFeedbackNV)this->m_resolveOrThrow(191);this->m_glPauseTransformFeedbackNV();}
+void m_glGetQueryObjecti64vEXT_lazy(GLuint id,GLenum pname,GLint64* params)const{if(!this->m_glGetQueryObjecti64vEXT)this->m_resolveOrThrow(192);this->m_glGetQueryObjecti64vEXT(id,pname,params);}
+void m_glVDPAUSurfaceAccessNV_lazy(GLvdpauSurfaceNV surface,GLenum access)const{if(!this->m_glVDPAUSurfaceAccessNV)this->m_resolveOrThrow(193);this->m_glVDPAUSurfaceAccessNV(surface,access);}
+void m_glValidateProgramPipeline_lazy(GLuint pipeline)const{if(!this->m_glValidateProgramPipeline)this->m_resolveOrThrow(194);this->m_glValidateProgramPipeline(pipeline);}
+void m_glTexPageCommitmentARB_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{if(!this->m_glTexPageCommitmentARB)this->m_resolveOrThrow(195);this->m_glTexPageCommitmentARB(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+void m_glWindowPos3dvARB_lazy(const GLdouble* v)const{if(!this->m_glWindowPos3dvARB)this->m_resolveOrThrow(196);this->m_glWindowPos3dvARB(v);}
+void m_glStencilStrokePathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glStencilStrokePathInstancedNV)this->m_resolveOrThrow(197);this->m_glStencilStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);}
+void m_glFogfv_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glFogfv)this->m_resolveOrThrow(198);this->m_glFogfv(pname,params);}
+void m_glGenQueriesARB_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glGenQueriesARB)this->m_resolveOrThrow(199);this->m_glGenQueriesARB(n,ids);}
+void m_glProgramUniform2i64NV_lazy(GLuint program,GLint location,GLint64EXT x,GLint64EXT y)const{if(!this->m_glProgramUniform2i64NV)this->m_resolveOrThrow(200);this->m_glProgramUniform2i64NV(program,location,x,y);}
+void m_glVertexP4ui_lazy(GLenum type,GLuint value)const{if(!this->m_glVertexP4ui)this->m_resolveOrThrow(201);this->m_glVertexP4ui(type,value);}
+void m_glVertexStream1ivATI_lazy(GLenum stream,const GLint* coords)const{if(!this->m_glVertexStream1ivATI)this->m_resolveOrThrow(202);this->m_glVertexStream1ivATI(stream,coords);}
+void m_glProgramEnvParameterI4iNV_lazy(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glProgramEnvParameterI4iNV)this->m_resolveOrThrow(203);this->m_glProgramEnvParameterI4iNV(target,index,x,y,z,w);}
+void m_glGenVertexArraysAPPLE_lazy(GLsizei n,GLuint* arrays)const{if(!this->m_glGenVertexArraysAPPLE)this->m_resolveOrThrow(204);this->m_glGenVertexArraysAPPLE(n,arrays);}
+void m_glDrawTransformFeedbackInstanced_lazy(GLenum mode,GLuint id,GLsizei instancecount)const{if(!this->m_glDrawTransformFeedbackInstanced)this->m_resolveOrThrow(205);this->m_glDrawTransformFeedbackInstanced(mode,id,instancecount);}
+void m_glStencilThenCoverStrokePathNV_lazy(GLuint path,GLint reference,GLuint mask,GLenum coverMode)const{if(!this->m_glStencilThenCoverStrokePathNV)this->m_resolveOrThrow(206);this->m_glStencilThenCoverStrokePathNV(path,reference,mask,coverMode);}
+void m_glDeleteVertexArraysAPPLE_lazy(GLsizei n,const GLuint* arrays)const{if(!this->m_glDeleteVertexArraysAPPLE)this->m_resolveOrThrow(207);this->m_glDeleteVertexArraysAPPLE(n,arrays);}
+void m_glGetNamedBufferParameterui64vNV_lazy(GLuint buffer,GLenum pname,GLuint64EXT* params)const{if(!this->m_glGetNamedBufferParameterui64vNV)this->m_resolveOrThrow(208);this->m_glGetNamedBufferParameterui64vNV(buffer,pname,params);}
+GLbitfield m_glQueryMatrixxOES_lazy(GLfixed* mantissa,GLint* exponent)const{if(!this->m_glQueryMatrixxOES)this->m_resolveOrThrow(209);return this->m_glQueryMatrixxOES(mantissa,exponent);}
+void m_glSecondaryColor3usv_lazy(const GLushort* v)const{if(!this->m_glSecondaryColor3usv)this->m_resolveOrThrow(210);this->m_glSecondaryColor3usv(v);}
+void m_glTranslatexOES_lazy(GLfixed x,GLfixed y,GLfixed z)const{if(!this->m_glTranslatexOES)this->m_resolveOrThrow(211);this->m_glTranslatexOES(x,y,z);}
+void m_glDrawTransformFeedback_lazy(GLenum mode,GLuint id)const{if(!this->m_glDrawTransformFeedback)this->m_resolveOrThrow(212);this->m_glDrawTransformFeedback(mode,id);}
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_lazy(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{if(!this->m_glTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_resolveOrThrow(213);this->m_glTexCoord2fColor4fNormal3fVertex3fvSUN(tc,c,n,v);}
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_lazy(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{if(!this->m_glVDPAURegisterVideoSurfaceNV)this->m_resolveOrThrow(214);return this->m_glVDPAURegisterVideoSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+void m_glGetTexParameterIuiv_lazy(GLenum target,GLenum pname,GLuint* params)const{if(!this->m_glGetTexParameterIuiv)this->m_resolveOrThrow(215);this->m_glGetTexParameterIuiv(target,pname,params);}
+void m_glBindBufferBaseNV_lazy(GLenum target,GLuint index,GLuint buffer)const{if(!this->m_glBindBufferBaseNV)this->m_resolveOrThrow(216);this->m_glBindBufferBaseNV(target,index,buffer);}
+void m_glIndexPointer_lazy(GLenum type,GLsizei stride,const GLvoid* ptr)const{if(!this->m_glIndexPointer)this->m_resolveOrThrow(217);this->m_glIndexPointer(type,stride,ptr);}
+void m_glGenQueryResourceTagNV_lazy(GLsizei n,GLint* tagIds)const{if(!this->m_glGenQueryResourceTagNV)this->m_resolveOrThrow(218);this->m_glGenQueryResourceTagNV(n,tagIds);}
+void m_glVertexAttrib4Nbv_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttrib4Nbv)this->m_resolveOrThrow(219);this->m_glVertexAttrib4Nbv(index,v);}
+void m_glListParameteriSGIX_lazy(GLuint list,GLenum pname,GLint param)const{if(!this->m_glListParameteriSGIX)this->m_resolveOrThrow(220);this->m_glListParameteriSGIX(list,pname,param);}
+void m_glBlendColorxOES_lazy(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{if(!this->m_glBlendColorxOES)this->m_resolveOrThrow(221);this->m_glBlendColorxOES(red,green,blue,alpha);}
+void m_glUniformui64vNV_lazy(GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glUniformui64vNV)this->m_resolveOrThrow(222);this->m_glUniformui64vNV(location,count,value);}
+GLboolean m_glIsSync_lazy(GLsync sync)const{if(!this->m_glIsSync)this->m_resolveOrThrow(223);return this->m_glIsSync(sync);}
+void m_glGetTextureParameterivEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTextureParameterivEXT)this->m_resolveOrThrow(224);this->m_glGetTextureParameterivEXT(texture,target,pname,params);}
+void m_glFogCoordhvNV_lazy(const GLhalfNV* fog)const{if(!this->m_glFogCoordhvNV)this->m_resolveOrThrow(225);this->m_glFogCoordhvNV(fog);}
+void m_glFramebufferTextureLayerEXT_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{if(!this->m_glFramebufferTextureLayerEXT)this->m_resolveOrThrow(226);this->m_glFramebufferTextureLayerEXT(target,attachment,texture,level,layer);}
+void m_glGetObjectPtrLabel_lazy(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label)const{if(!this->m_glGetObjectPtrLabel)this->m_resolveOrThrow(227);this->m_glGetObjectPtrLabel(ptr,bufSize,length,label);}
+void m_glTextureParameteri_lazy(GLuint texture,GLenum pname,GLint param)const{if(!this->m_glTextureParameteri)this->m_resolveOrThrow(228);this->m_glTextureParameteri(texture,pname,param);}
+void m_glMultiTexCoord1fARB_lazy(GLenum target,GLfloat s)const{if(!this->m_glMultiTexCoord1fARB)this->m_resolveOrThrow(229);this->m_glMultiTexCoord1fARB(target,s);}
+void m_glUniformMatrix2x3dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix2x3dv)this->m_resolveOrThrow(230);this->m_glUniformMatrix2x3dv(location,count,transpose,value);}
+void m_glFramebufferDrawBufferEXT_lazy(GLuint framebuffer,GLenum mode)const{if(!this->m_glFramebufferDrawBufferEXT)this->m_resolveOrThrow(231);this->m_glFramebufferDrawBufferEXT(framebuffer,mode);}
+void m_glCopyColorSubTable_lazy(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyColorSubTable)this->m_resolveOrThrow(232);this->m_glCopyColorSubTable(target,start,x,y,width);}
+void m_glGetNamedFramebufferParameterfvAMD_lazy(GLuint framebuffer,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{if(!this->m_glGetNamedFramebufferParameterfvAMD)this->m_resolveOrThrow(233);this->m_glGetNamedFramebufferParameterfvAMD(framebuffer,pname,numsamples,pixelindex,size,values);}
+void m_glVertexAttribL3d_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexAttribL3d)this->m_resolveOrThrow(234);this->m_glVertexAttribL3d(index,x,y,z);}
+void m_glFragmentMaterialfvSGIX_lazy(GLenum face,GLenum pname,const GLfloat* params)const{if(!this->m_glFragmentMaterialfvSGIX)this->m_resolveOrThrow(235);this->m_glFragmentMaterialfvSGIX(face,pname,params);}
+void m_glMatrixLoadTranspose3x3fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixLoadTranspose3x3fNV)this->m_resolveOrThrow(236);this->m_glMatrixLoadTranspose3x3fNV(matrixMode,m);}
+void m_glDeleteNamesAMD_lazy(GLenum identifier,GLuint num,const GLuint* names)const{if(!this->m_glDeleteNamesAMD)this->m_resolveOrThrow(237);this->m_glDeleteNamesAMD(identifier,num,names);}
+void m_glDrawRangeElementsEXT_lazy(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices)const{if(!this->m_glDrawRangeElementsEXT)this->m_resolveOrThrow(238);this->m_glDrawRangeElementsEXT(mode,start,end,count,type,indices);}
+void m_glOrtho_lazy(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{if(!this->m_glOrtho)this->m_resolveOrThrow(239);this->m_glOrtho(left,right,bottom,top,near_val,far_val);}
+void m_glProgramUniform1dvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform1dvEXT)this->m_resolveOrThrow(240);this->m_glProgramUniform1dvEXT(program,location,count,value);}
+void m_glColor4xOES_lazy(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{if(!this->m_glColor4xOES)this->m_resolveOrThrow(241);this->m_glColor4xOES(red,green,blue,alpha);}
+void m_glTexImage4DSGIS_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexImage4DSGIS)this->m_resolveOrThrow(242);this->m_glTexImage4DSGIS(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);}
+void m_glProgramUniform1ui_lazy(GLuint program,GLint location,GLuint v0)const{if(!this->m_glProgramUniform1ui)this->m_resolveOrThrow(243);this->m_glProgramUniform1ui(program,location,v0);}
+void m_glDeleteBuffersARB_lazy(GLsizei n,const GLuint* buffers)const{if(!this->m_glDeleteBuffersARB)this->m_resolveOrThrow(244);this->m_glDeleteBuffersARB(n,buffers);}
+GLboolean m_glUnmapBufferARB_lazy(GLenum target)const{if(!this->m_glUnmapBufferARB)this->m_resolveOrThrow(245);return this->m_glUnmapBufferARB(target);}
+void m_glCopyTexImage2D_lazy(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{if(!this->m_glCopyTexImage2D)this->m_resolveOrThrow(246);this->m_glCopyTexImage2D(target,level,internalformat,x,y,width,height,border);}
+void m_glMaterialxOES_lazy(GLenum face,GLenum pname,GLfixed param)const{if(!this->m_glMaterialxOES)this->m_resolveOrThrow(247);this->m_glMaterialxOES(face,pname,param);}
+void m_glProgramUniformMatrix2x4fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2x4fvEXT)this->m_resolveOrThrow(248);this->m_glProgramUniformMatrix2x4fvEXT(program,location,count,transpose,value);}
+GLboolean m_glTestObjectAPPLE_lazy(GLenum object,GLuint name)const{if(!this->m_glTestObjectAPPLE)this->m_resolveOrThrow(249);return this->m_glTestObjectAPPLE(object,name);}
+void m_glRenderbufferStorageEXT_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glRenderbufferStorageEXT)this->m_resolveOrThrow(250);this->m_glRenderbufferStorageEXT(target,internalformat,width,height);}
+void m_glVertexAttribL1ui64ARB_lazy(GLuint index,GLuint64EXT x)const{if(!this->m_glVertexAttribL1ui64ARB)this->m_resolveOrThrow(251);this->m_glVertexAttribL1ui64ARB(index,x);}
+void m_glEndFragmentShaderATI_lazy()const{if(!this->m_glEndFragmentShaderATI)this->m_resolveOrThrow(252);this->m_glEndFragmentShaderATI();}
+void m_glPathParameterivNV_lazy(GLuint path,GLenum pname,const GLint* value)const{if(!this->m_glPathParameterivNV)this->m_resolveOrThrow(253);this->m_glPathParameterivNV(path,pname,value);}
+void m_glUniform4uiv_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform4uiv)this->m_resolveOrThrow(254);this->m_glUniform4uiv(location,count,value);}
+void m_glFrameZoomSGIX_lazy(GLint factor)const{if(!this->m_glFrameZoomSGIX)this->m_resolveOrThrow(255);this->m_glFrameZoomSGIX(factor);}
+void m_glSecondaryColor3fEXT_lazy(GLfloat red,GLfloat green,GLfloat blue)const{if(!this->m_glSecondaryColor3fEXT)this->m_resolveOrThrow(256);this->m_glSecondaryColor3fEXT(red,green,blue);}
+void m_glLGPUInterlockNVX_lazy()const{if(!this->m_glLGPUInterlockNVX)this->m_resolveOrThrow(257);this->m_glLGPUInterlockNVX();}
+void m_glVertexAttribL1dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL1dv)this->m_resolveOrThrow(258);this->m_glVertexAttribL1dv(index,v);}
+void m_glNormalStream3svATI_lazy(GLenum stream,const GLshort* coords)const{if(!this->m_glNormalStream3svATI)this->m_resolveOrThrow(259);this->m_glNormalStream3svATI(stream,coords);}
+void m_glPathStencilFuncNV_lazy(GLenum func,GLint ref,GLuint mask)const{if(!this->m_glPathStencilFuncNV)this->m_resolveOrThrow(260);this->m_glPathStencilFuncNV(func,ref,mask);}
+void m_glSetInvariantEXT_lazy(GLuint id,GLenum type,const void* addr)const{if(!this->m_glSetInvariantEXT)this->m_resolveOrThrow(261);this->m_glSetInvariantEXT(id,type,addr);}
+void m_glGetTexBumpParameterivATI_lazy(GLenum pname,GLint* param)const{if(!this->m_glGetTexBumpParameterivATI)this->m_resolveOrThrow(262);this->m_glGetTexBumpParameterivATI(pname,param);}
+void m_glBlendEquationSeparateEXT_lazy(GLenum modeRGB,GLenum modeAlpha)const{if(!this->m_glBlendEquationSeparateEXT)this->m_resolveOrThrow(263);this->m_glBlendEquationSeparateEXT(modeRGB,modeAlpha);}
+void m_glEndOcclusionQueryNV_lazy()const{if(!this->m_glEndOcclusionQueryNV)this->m_resolveOrThrow(264);this->m_glEndOcclusionQueryNV();}
+void m_glScissorArrayv_lazy(GLuint first,GLsizei count,const GLint* v)const{if(!this->m_glScissorArrayv)this->m_resolveOrThrow(265);this->m_glScissorArrayv(first,count,v);}
+void m_glCallList_lazy(GLuint list)const{if(!this->m_glCallList)this->m_resolveOrThrow(266);this->m_glCallList(list);}
+void* m_glMapTexture2DINTEL_lazy(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout)const{if(!this->m_glMapTexture2DINTEL)this->m_resolveOrThrow(267);return this->m_glMapTexture2DINTEL(texture,level,access,stride,layout);}
+GLVULKANPROCNV m_glGetVkProcAddrNV_lazy(const GLchar* name)const{if(!this->m_glGetVkProcAddrNV)this->m_resolveOrThrow(268);return this->m_glGetVkProcAddrNV(name);}
+void m_glPixelTransferxOES_lazy(GLenum pname,GLfixed param)const{if(!this->m_glPixelTransferxOES)this->m_resolveOrThrow(269);this->m_glPixelTransferxOES(pname,param);}
+void m_glDeleteRenderbuffersEXT_lazy(GLsizei n,const GLuint* renderbuffers)const{if(!this->m_glDeleteRenderbuffersEXT)this->m_resolveOrThrow(270);this->m_glDeleteRenderbuffersEXT(n,renderbuffers);}
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_lazy(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glTexCoord4fColor4fNormal3fVertex4fSUN)this->m_resolveOrThrow(271);this->m_glTexCoord4fColor4fNormal3fVertex4fSUN(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);}
+void m_glProgramUniformMatrix4dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4dvEXT)this->m_resolveOrThrow(272);this->m_glProgramUniformMatrix4dvEXT(program,location,count,transpose,value);}
+void m_glGetnColorTable_lazy(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{if(!this->m_glGetnColorTable)this->m_resolveOrThrow(273);this->m_glGetnColorTable(target,format,type,bufSize,table);}
+void m_glFramebufferTextureLayerARB_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{if(!this->m_glFramebufferTextureLayerARB)this->m_resolveOrThrow(274);this->m_glFramebufferTextureLayerARB(target,attachment,texture,level,layer);}
+void m_glVertexAttribL2dvEXT_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL2dvEXT)this->m_resolveOrThrow(275);this->m_glVertexAttribL2dvEXT(index,v);}
+void m_glGetCombinerStageParameterfvNV_lazy(GLenum stage,GLenum pname,GLfloat* params)const{if(!this->m_glGetCombinerStageParameterfvNV)this->m_resolveOrThrow(276);this->m_glGetCombinerStageParameterfvNV(stage,pname,params);}
+void m_glMultiTexCoord1xvOES_lazy(GLenum texture,const GLfixed* coords)const{if(!this->m_glMultiTexCoord1xvOES)this->m_resolveOrThrow(277);this->m_glMultiTexCoord1xvOES(texture,coords);}
+void* m_glMapBuffer_lazy(GLenum target,GLenum access)const{if(!this->m_glMapBuffer)this->m_resolveOrThrow(278);return this->m_glMapBuffer(target,access);}
+void m_glSecondaryColor3d_lazy(GLdouble red,GLdouble green,GLdouble blue)const{if(!this->m_glSecondaryColor3d)this->m_resolveOrThrow(279);this->m_glSecondaryColor3d(red,green,blue);}
+void m_glSecondaryColor3f_lazy(GLfloat red,GLfloat green,GLfloat blue)const{if(!this->m_glSecondaryColor3f)this->m_resolveOrThrow(280);this->m_glSecondaryColor3f(red,green,blue);}
+void m_glVertexAttribLFormat_lazy(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexAttribLFormat)this->m_resolveOrThrow(281);this->m_glVertexAttribLFormat(attribindex,size,type,relativeoffset);}
+void m_glElementPointerAPPLE_lazy(GLenum type,const void* pointer)const{if(!this->m_glElementPointerAPPLE)this->m_resolveOrThrow(282);this->m_glElementPointerAPPLE(type,pointer);}
+void m_glVertexStream1fATI_lazy(GLenum stream,GLfloat x)const{if(!this->m_glVertexStream1fATI)this->m_resolveOrThrow(283);this->m_glVertexStream1fATI(stream,x);}
+void m_glCoverageModulationNV_lazy(GLenum components)const{if(!this->m_glCoverageModulationNV)this->m_resolveOrThrow(284);this->m_glCoverageModulationNV(components);}
+void m_glSecondaryColor3i_lazy(GLint red,GLint green,GLint blue)const{if(!this->m_glSecondaryColor3i)this->m_resolveOrThrow(285);this->m_glSecondaryColor3i(red,green,blue);}
+void m_glDeleteSync_lazy(GLsync sync)const{if(!this->m_glDeleteSync)this->m_resolveOrThrow(286);this->m_glDeleteSync(sync);}
+void m_glGetProgramParameterfvNV_lazy(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetProgramParameterfvNV)this->m_resolveOrThrow(287);this->m_glGetProgramParameterfvNV(target,index,pname,params);}
+void m_glMaxShaderCompilerThreadsARB_lazy(GLuint count)const{if(!this->m_glMaxShaderCompilerThreadsARB)this->m_resolveOrThrow(288);this->m_glMaxShaderCompilerThreadsARB(count);}
+void m_glUniformMatrix4x2dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix4x2dv)this->m_resolveOrThrow(289);this->m_glUniformMatrix4x2dv(location,count,transpose,value);}
+void m_glVertexArrayVertexAttribLOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayVertexAttribLOffsetEXT)this->m_resolveOrThrow(290);this->m_glVertexArrayVertexAttribLOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+void m_glSecondaryColor3s_lazy(GLshort red,GLshort green,GLshort blue)const{if(!this->m_glSecondaryColor3s)this->m_resolveOrThrow(291);this->m_glSecondaryColor3s(red,green,blue);}
+GLboolean m_glIsImageHandleResidentNV_lazy(GLuint64 handle)const{if(!this->m_glIsImageHandleResidentNV)this->m_resolveOrThrow(292);return this->m_glIsImageHandleResidentNV(handle);}
+void m_glUniform3iv_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform3iv)this->m_resolveOrThrow(293);this->m_glUniform3iv(location,count,value);}
+void m_glVertexAttribL3i64vNV_lazy(GLuint index,const GLint64EXT* v)const{if(!this->m_glVertexAttribL3i64vNV)this->m_resolveOrThrow(294);this->m_glVertexAttribL3i64vNV(index,v);}
+void m_glPolygonMode_lazy(GLenum face,GLenum mode)const{if(!this->m_glPolygonMode)this->m_resolveOrThrow(295);this->m_glPolygonMode(face,mode);}
+void m_glFramebufferSamplePositionsfvAMD_lazy(GLenum target,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{if(!this->m_glFramebufferSamplePositionsfvAMD)this->m_resolveOrThrow(296);this->m_glFramebufferSamplePositionsfvAMD(target,numsamples,pixelindex,values);}
+void m_glConvolutionFilter1DEXT_lazy(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image)const{if(!this->m_glConvolutionFilter1DEXT)this->m_resolveOrThrow(297);this->m_glConvolutionFilter1DEXT(target,internalformat,width,format,type,image);}
+void m_glVertexAttrib1dvARB_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib1dvARB)this->m_resolveOrThrow(298);this->m_glVertexAttrib1dvARB(index,v);}
+void m_glTextureSubImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage2DEXT)this->m_resolveOrThrow(299);this->m_glTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+GLboolean m_glIsVertexArrayAPPLE_lazy(GLuint array)const{if(!this->m_glIsVertexArrayAPPLE)this->m_resolveOrThrow(300);return this->m_glIsVertexArrayAPPLE(array);}
+void m_glUseProgram_lazy(GLuint program)const{if(!this->m_glUseProgram)this->m_resolveOrThrow(301);this->m_glUseProgram(program);}
+void m_glLineStipple_lazy(GLint factor,GLushort pattern)const{if(!this->m_glLineStipple)this->m_resolveOrThrow(302);this->m_glLineStipple(factor,pattern);}
+void m_glMultiTexCoord4fvARB_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord4fvARB)this->m_resolveOrThrow(303);this->m_glMultiTexCoord4fvARB(target,v);}
+GLenum m_glVideoCaptureNV_lazy(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time)const{if(!this->m_glVideoCaptureNV)this->m_resolveOrThrow(304);return this->m_glVideoCaptureNV(video_capture_slot,sequence_num,capture_time);}
+void m_glVertexArrayVertexAttribLFormatEXT_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexArrayVertexAttribLFormatEXT)this->m_resolveOrThrow(305);this->m_glVertexArrayVertexAttribLFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+void m_glUniform3fvARB_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform3fvARB)this->m_resolveOrThrow(306);this->m_glUniform3fvARB(location,count,value);}
+void m_glProgramUniformMatrix3x2fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3x2fvEXT)this->m_resolveOrThrow(307);this->m_glProgramUniformMatrix3x2fvEXT(program,location,count,transpose,value);}
+void m_glCopyTextureSubImage3DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTextureSubImage3DEXT)this->m_resolveOrThrow(308);this->m_glCopyTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+void m_glMultiTexCoord2bvOES_lazy(GLenum texture,const GLbyte* coords)const{if(!this->m_glMultiTexCoord2bvOES)this->m_resolveOrThrow(309);this->m_glMultiTexCoord2bvOES(texture,coords);}
+void m_glDeleteObjectARB_lazy(GLhandleARB obj)const{if(!this->m_glDeleteObjectARB)this->m_resolveOrThrow(310);this->m_glDeleteObjectARB(obj);}
+void m_glTextureLightEXT_lazy(GLenum pname)const{if(!this->m_glTextureLightEXT)this->m_resolveOrThrow(311);this->m_glTextureLightEXT(pname);}
+void m_glRasterPos3i_lazy(GLint x,GLint y,GLint z)const{if(!this->m_glRasterPos3i)this->m_resolveOrThrow(312);this->m_glRasterPos3i(x,y,z);}
+void m_glMultiTexCoord3dARB_lazy(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{if(!this->m_glMultiTexCoord3dARB)this->m_resolveOrThrow(313);this->m_glMultiTexCoord3dARB(target,s,t,r);}
+void m_glNamedFramebufferTextureEXT_lazy(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{if(!this->m_glNamedFramebufferTextureEXT)this->m_resolveOrThrow(314);this->m_glNamedFramebufferTextureEXT(framebuffer,attachment,texture,level);}
+void m_glTextureParameteriEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLint param)const{if(!this->m_glTextureParameteriEXT)this->m_resolveOrThrow(315);this->m_glTextureParameteriEXT(texture,target,pname,param);}
+void m_glEvalCoord2xvOES_lazy(const GLfixed* coords)const{if(!this->m_glEvalCoord2xvOES)this->m_resolveOrThrow(316);this->m_glEvalCoord2xvOES(coords);}
+void m_glBindVideoCaptureStreamBufferNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset)const{if(!this->m_glBindVideoCaptureStreamBufferNV)this->m_resolveOrThrow(317);this->m_glBindVideoCaptureStreamBufferNV(video_capture_slot,stream,frame_region,offset);}
+void m_glTexImage2DMultisampleCoverageNV_lazy(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{if(!this->m_glTexImage2DMultisampleCoverageNV)this->m_resolveOrThrow(318);this->m_glTexImage2DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+GLint m_glGetAttribLocationARB_lazy(GLhandleARB programObj,const GLcharARB* name)const{if(!this->m_glGetAttribLocationARB)this->m_resolveOrThrow(319);return this->m_glGetAttribLocationARB(programObj,name);}
+void m_glDeleteShader_lazy(GLuint shader)const{if(!this->m_glDeleteShader)this->m_resolveOrThrow(320);this->m_glDeleteShader(shader);}
+void m_glVertexAttrib1fARB_lazy(GLuint index,GLfloat x)const{if(!this->m_glVertexAttrib1fARB)this->m_resolveOrThrow(321);this->m_glVertexAttrib1fARB(index,x);}
+void m_glTexCoord2fColor4ubVertex3fSUN_lazy(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTexCoord2fColor4ubVertex3fSUN)this->m_resolveOrThrow(322);this->m_glTexCoord2fColor4ubVertex3fSUN(s,t,r,g,b,a,x,y,z);}
+void m_glTexCoord4fVertex4fSUN_lazy(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glTexCoord4fVertex4fSUN)this->m_resolveOrThrow(323);this->m_glTexCoord4fVertex4fSUN(s,t,p,q,x,y,z,w);}
+void m_glGetMapdv_lazy(GLenum target,GLenum query,GLdouble* v)const{if(!this->m_glGetMapdv)this->m_resolveOrThrow(324);this->m_glGetMapdv(target,query,v);}
+void m_glMapParameterfvNV_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glMapParameterfvNV)this->m_resolveOrThrow(325);this->m_glMapParameterfvNV(target,pname,params);}
+void m_glTextureParameterIuiv_lazy(GLuint texture,GLenum pname,const GLuint* params)const{if(!this->m_glTextureParameterIuiv)this->m_resolveOrThrow(326);this->m_glTextureParameterIuiv(texture,pname,params);}
+void m_glTransformFeedbackAttribsNV_lazy(GLsizei count,const GLint* attribs,GLenum bufferMode)const{if(!this->m_glTransformFeedbackAttribsNV)this->m_resolveOrThrow(327);this->m_glTransformFeedbackAttribsNV(count,attribs,bufferMode);}
+void m_glFragmentLightfvSGIX_lazy(GLenum light,GLenum pname,const GLfloat* params)const{if(!this->m_glFragmentLightfvSGIX)this->m_resolveOrThrow(328);this->m_glFragmentLightfvSGIX(light,pname,params);}
+void m_glWindowPos3sARB_lazy(GLshort x,GLshort y,GLshort z)const{if(!this->m_glWindowPos3sARB)this->m_resolveOrThrow(329);this->m_glWindowPos3sARB(x,y,z);}
+void m_glGetConvolutionParameterfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetConvolutionParameterfv)this->m_resolveOrThrow(330);this->m_glGetConvolutionParameterfv(target,pname,params);}
+void m_glCopyTexSubImage3D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTexSubImage3D)this->m_resolveOrThrow(331);this->m_glCopyTexSubImage3D(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+void m_glVertexAttribI3i_lazy(GLuint index,GLint x,GLint y,GLint z)const{if(!this->m_glVertexAttribI3i)this->m_resolveOrThrow(332);this->m_glVertexAttribI3i(index,x,y,z);}
+GLhandleARB m_glCreateShaderObjectARB_lazy(GLenum shaderType)const{if(!this->m_glCreateShaderObjectARB)this->m_resolveOrThrow(333);return this->m_glCreateShaderObjectARB(shaderType);}
+void m_glVertexAttribFormat_lazy(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{if(!this->m_glVertexAttribFormat)this->m_resolveOrThrow(334);this->m_glVertexAttribFormat(attribindex,size,type,normalized,relativeoffset);}
+void m_glGetProgramivARB_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetProgramivARB)this->m_resolveOrThrow(335);this->m_glGetProgramivARB(target,pname,params);}
+void m_glVertexAttribI4usv_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttribI4usv)this->m_resolveOrThrow(336);this->m_glVertexAttribI4usv(index,v);}
+void m_glTexParameterf_lazy(GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glTexParameterf)this->m_resolveOrThrow(337);this->m_glTexParameterf(target,pname,param);}
+void m_glVertexAttribBinding_lazy(GLuint attribindex,GLuint bindingindex)const{if(!this->m_glVertexAttribBinding)this->m_resolveOrThrow(338);this->m_glVertexAttribBinding(attribindex,bindingindex);}
+void m_glGetHistogramParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetHistogramParameteriv)this->m_resolveOrThrow(339);this->m_glGetHistogramParameteriv(target,pname,params);}
+void m_glTexParameteri_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glTexParameteri)this->m_resolveOrThrow(340);this->m_glTexParameteri(target,pname,param);}
+void m_glGetShaderSource_lazy(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source)const{if(!this->m_glGetShaderSource)this->m_resolveOrThrow(341);this->m_glGetShaderSource(shader,bufSize,length,source);}
+void m_glVertexAttrib4s_lazy(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glVertexAttrib4s)this->m_resolveOrThrow(342);this->m_glVertexAttrib4s(index,x,y,z,w);}
+void m_glVertexAttrib4dvNV_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib4dvNV)this->m_resolveOrThrow(343);this->m_glVertexAttrib4dvNV(index,v);}
+void m_glVertexAttrib1dvNV_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib1dvNV)this->m_resolveOrThrow(344);this->m_glVertexAttrib1dvNV(index,v);}
+void m_glPopName_lazy()const{if(!this->m_glPopName)this->m_resolveOrThrow(345);this->m_glPopName();}
+void m_glTextureBufferEXT_lazy(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer)const{if(!this->m_glTextureBufferEXT)this->m_resolveOrThrow(346);this->m_glTextureBufferEXT(texture,target,internalformat,buffer);}
+void m_glGetMultiTexImageEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{if(!this->m_glGetMultiTexImageEXT)this->m_resolveOrThrow(347);this->m_glGetMultiTexImageEXT(texunit,target,level,format,type,pixels);}
+void m_glGetPointerIndexedvEXT_lazy(GLenum target,GLuint index,void** data)const{if(!this->m_glGetPointerIndexedvEXT)this->m_resolveOrThrow(348);this->m_glGetPointerIndexedvEXT(target,index,data);}
+GLboolean m_glIsNameAMD_lazy(GLenum identifier,GLuint name)const{if(!this->m_glIsNameAMD)this->m_resolveOrThrow(349);return this->m_glIsNameAMD(identifier,name);}
+void m_glColor4ub_lazy(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha)const{if(!this->m_glColor4ub)this->m_resolveOrThrow(350);this->m_glColor4ub(red,green,blue,alpha);}
+void m_glBufferParameteriAPPLE_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glBufferParameteriAPPLE)this->m_resolveOrThrow(351);this->m_glBufferParameteriAPPLE(target,pname,param);}
+void m_glColor4ui_lazy(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{if(!this->m_glColor4ui)this->m_resolveOrThrow(352);this->m_glColor4ui(red,green,blue,alpha);}
+void m_glGetInternalformativ_lazy(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params)const{if(!this->m_glGetInternalformativ)this->m_resolveOrThrow(353);this->m_glGetInternalformativ(target,internalformat,pname,bufSize,params);}
+void m_glColor4us_lazy(GLushort red,GLushort green,GLushort blue,GLushort alpha)const{if(!this->m_glColor4us)this->m_resolveOrThrow(354);this->m_glColor4us(red,green,blue,alpha);}
+void m_glVertexAttribP1uiv_lazy(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{if(!this->m_glVertexAttribP1uiv)this->m_resolveOrThrow(355);this->m_glVertexAttribP1uiv(index,type,normalized,value);}
+void m_glLinkProgram_lazy(GLuint program)const{if(!this->m_glLinkProgram)this->m_resolveOrThrow(356);this->m_glLinkProgram(program);}
+void m_glTexCoord3s_lazy(GLshort s,GLshort t,GLshort r)const{if(!this->m_glTexCoord3s)this->m_resolveOrThrow(357);this->m_glTexCoord3s(s,t,r);}
+void m_glTexCoord2dv_lazy(const GLdouble* v)const{if(!this->m_glTexCoord2dv)this->m_resolveOrThrow(358);this->m_glTexCoord2dv(v);}
+void m_glGetObjectLabel_lazy(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label)const{if(!this->m_glGetObjectLabel)this->m_resolveOrThrow(359);this->m_glGetObjectLabel(identifier,name,bufSize,length,label);}
+void m_glVertexPointerEXT_lazy(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{if(!this->m_glVertexPointerEXT)this->m_resolveOrThrow(360);this->m_glVertexPointerEXT(size,type,stride,count,pointer);}
+void m_glDebugMessageCallbackARB_lazy(GLDEBUGPROCARB callback,const void* userParam)const{if(!this->m_glDebugMessageCallbackARB)this->m_resolveOrThrow(361);this->m_glDebugMessageCallbackARB(callback,userParam);}
+const GLubyte* m_glGetString_lazy(GLenum name)const{if(!this->m_glGetString)this->m_resolveOrThrow(362);return this->m_glGetString(name);}
+void m_glGetPathParameterfvNV_lazy(GLuint path,GLenum pname,GLfloat* value)const{if(!this->m_glGetPathParameterfvNV)this->m_resolveOrThrow(363);this->m_glGetPathParameterfvNV(path,pname,value);}
+void m_glLightxvOES_lazy(GLenum light,GLenum pname,const GLfixed* params)const{if(!this->m_glLightxvOES)this->m_resolveOrThrow(364);this->m_glLightxvOES(light,pname,params);}
+void m_glEndQuery_lazy(GLenum target)const{if(!this->m_glEndQuery)this->m_resolveOrThrow(365);this->m_glEndQuery(target);}
+void m_glSecondaryColor3uiv_lazy(const GLuint* v)const{if(!this->m_glSecondaryColor3uiv)this->m_resolveOrThrow(366);this->m_glSecondaryColor3uiv(v);}
+void m_glPrioritizeTexturesxOES_lazy(GLsizei n,const GLuint* textures,const GLfixed* priorities)const{if(!this->m_glPrioritizeTexturesxOES)this->m_resolveOrThrow(367);this->m_glPrioritizeTexturesxOES(n,textures,priorities);}
+void m_glEdgeFlagPointer_lazy(GLsizei stride,const GLvoid* ptr)const{if(!this->m_glEdgeFlagPointer)this->m_resolveOrThrow(368);this->m_glEdgeFlagPointer(stride,ptr);}
+void m_glFramebufferParameteri_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glFramebufferParameteri)this->m_resolveOrThrow(369);this->m_glFramebufferParameteri(target,pname,param);}
+void m_glTexCoord3hNV_lazy(GLhalfNV s,GLhalfNV t,GLhalfNV r)const{if(!this->m_glTexCoord3hNV)this->m_resolveOrThrow(370);this->m_glTexCoord3hNV(s,t,r);}
+void m_glMultiModeDrawElementsIBM_lazy(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride)const{if(!this->m_glMultiModeDrawElementsIBM)this->m_resolveOrThrow(371);this->m_glMultiModeDrawElementsIBM(mode,count,type,indices,primcount,modestride);}
+void m_glCopyPixels_lazy(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type)const{if(!this->m_glCopyPixels)this->m_resolveOrThrow(372);this->m_glCopyPixels(x,y,width,height,type);}
+void m_glVertexAttribI2ui_lazy(GLuint index,GLuint x,GLuint y)const{if(!this->m_glVertexAttribI2ui)this->m_resolveOrThrow(373);this->m_glVertexAttribI2ui(index,x,y);}
+void m_glClampColorARB_lazy(GLenum target,GLenum clamp)const{if(!this->m_glClampColorARB)this->m_resolveOrThrow(374);this->m_glClampColorARB(target,clamp);}
+void m_glColorPointervINTEL_lazy(GLint size,GLenum type,const void** pointer)const{if(!this->m_glColorPointervINTEL)this->m_resolveOrThrow(375);this->m_glColorPointervINTEL(size,type,pointer);}
+void m_glDeleteTextures_lazy(GLsizei n,const GLuint* textures)const{if(!this->m_glDeleteTextures)this->m_resolveOrThrow(376);this->m_glDeleteTextures(n,textures);}
+void m_glGetMinmaxParameterfvEXT_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetMinmaxParameterfvEXT)this->m_resolveOrThrow(377);this->m_glGetMinmaxParameterfvEXT(target,pname,params);}
+void m_glWindowPos3sMESA_lazy(GLshort x,GLshort y,GLshort z)const{if(!this->m_glWindowPos3sMESA)this->m_resolveOrThrow(378);this->m_glWindowPos3sMESA(x,y,z);}
+void m_glVertexAttrib4f_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glVertexAttrib4f)this->m_resolveOrThrow(379);this->m_glVertexAttrib4f(index,x,y,z,w);}
+void m_glNamedFramebufferParameteri_lazy(GLuint framebuffer,GLenum pname,GLint param)const{if(!this->m_glNamedFramebufferParameteri)this->m_resolveOrThrow(380);this->m_glNamedFramebufferParameteri(framebuffer,pname,param);}
+void m_glTexCoord2fVertex3fvSUN_lazy(const GLfloat* tc,const GLfloat* v)const{if(!this->m_glTexCoord2fVertex3fvSUN)this->m_resolveOrThrow(381);this->m_glTexCoord2fVertex3fvSUN(tc,v);}
+void m_glReplacementCodeusSUN_lazy(GLushort code)const{if(!this->m_glReplacementCodeusSUN)this->m_resolveOrThrow(382);this->m_glReplacementCodeusSUN(code);}
+void m_glGetNamedFramebufferParameteriv_lazy(GLuint framebuffer,GLenum pname,GLint* param)const{if(!this->m_glGetNamedFramebufferParameteriv)this->m_resolveOrThrow(383);this->m_glGetNamedFramebufferParameteriv(framebuffer,pname,param);}
+void m_glVertexStream1fvATI_lazy(GLenum stream,const GLfloat* coords)const{if(!this->m_glVertexStream1fvATI)this->m_resolveOrThrow(384);this->m_glVertexStream1fvATI(stream,coords);}
+void m_glCreateVertexArrays_lazy(GLsizei n,GLuint* arrays)const{if(!this->m_glCreateVertexArrays)this->m_resolveOrThrow(385);this->m_glCreateVertexArrays(n,arrays);}
+void m_glBeginConditionalRender_lazy(GLuint id,GLenum mode)const{if(!this->m_glBeginConditionalRender)this->m_resolveOrThrow(386);this->m_glBeginConditionalRender(id,mode);}
+void m_glGetUnsignedBytevEXT_lazy(GLenum pname,GLubyte* data)const{if(!this->m_glGetUnsignedBytevEXT)this->m_resolveOrThrow(387);this->m_glGetUnsignedBytevEXT(pname,data);}
+void m_glConvolutionFilter1D_lazy(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image)const{if(!this->m_glConvolutionFilter1D)this->m_resolveOrThrow(388);this->m_glConvolutionFilter1D(target,internalformat,width,format,type,image);}
+void m_glMultiTexCoord3fARB_lazy(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{if(!this->m_glMultiTexCoord3fARB)this->m_resolveOrThrow(389);this->m_glMultiTexCoord3fARB(target,s,t,r);}
+void m_glGetQueryObjectuivARB_lazy(GLuint id,GLenum pname,GLuint* params)const{if(!this->m_glGetQueryObjectuivARB)this->m_resolveOrThrow(390);this->m_glGetQueryObjectuivARB(id,pname,params);}
+void m_glScalexOES_lazy(GLfixed x,GLfixed y,GLfixed z)const{if(!this->m_glScalexOES)this->m_resolveOrThrow(391);this->m_glScalexOES(x,y,z);}
+void m_glSamplerParameteri_lazy(GLuint sampler,GLenum pname,GLint param)const{if(!this->m_glSamplerParameteri)this->m_resolveOrThrow(392);this->m_glSamplerParameteri(sampler,pname,param);}
+void m_glSamplerParameterf_lazy(GLuint sampler,GLenum pname,GLfloat param)const{if(!this->m_glSamplerParameterf)this->m_resolveOrThrow(393);this->m_glSamplerParameterf(sampler,pname,param);}
+void m_glShaderOp1EXT_lazy(GLenum op,GLuint res,GLuint arg1)const{if(!this->m_glShaderOp1EXT)this->m_resolveOrThrow(394);this->m_glShaderOp1EXT(op,res,arg1);}
+void m_glBeginVideoCaptureNV_lazy(GLuint video_capture_slot)const{if(!this->m_glBeginVideoCaptureNV)this->m_resolveOrThrow(395);this->m_glBeginVideoCaptureNV(video_capture_slot);}
+void m_glGetnHistogram_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{if(!this->m_glGetnHistogram)this->m_resolveOrThrow(396);this->m_glGetnHistogram(target,reset,format,type,bufSize,values);}
+void m_glUniform1d_lazy(GLint location,GLdouble x)const{if(!this->m_glUniform1d)this->m_resolveOrThrow(397);this->m_glUniform1d(location,x);}
+GLint m_glRenderMode_lazy(GLenum mode)const{if(!this->m_glRenderMode)this->m_resolveOrThrow(398);return this->m_glRenderMode(mode);}
+void m_glClearColorIiEXT_lazy(GLint red,GLint green,GLint blue,GLint alpha)const{if(!this->m_glClearColorIiEXT)this->m_resolveOrThrow(399);this->m_glClearColorIiEXT(red,green,blue,alpha);}
+void m_glSignalSemaphoreEXT_lazy(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* dstLayouts)const{if(!this->m_glSignalSemaphoreEXT)this->m_resolveOrThrow(400);this->m_glSignalSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);}
+void m_glGetCompressedTexImage_lazy(GLenum target,GLint lod,GLvoid* img)const{if(!this->m_glGetCompressedTexImage)this->m_resolveOrThrow(401);this->m_glGetCompressedTexImage(target,lod,img);}
+void m_glCompressedTextureImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureImage1DEXT)this->m_resolveOrThrow(402);this->m_glCompressedTextureImage1DEXT(texture,target,level,internalformat,width,border,imageSize,bits);}
+void m_glGetActiveUniformBlockiv_lazy(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params)const{if(!this->m_glGetActiveUniformBlockiv)this->m_resolveOrThrow(403);this->m_glGetActiveUniformBlockiv(program,uniformBlockIndex,pname,params);}
+void m_glUniform1i_lazy(GLint location,GLint v0)const{if(!this->m_glUniform1i)this->m_resolveOrThrow(404);this->m_glUniform1i(location,v0);}
+void m_glMultiDrawArraysIndirectCount_lazy(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{if(!this->m_glMultiDrawArraysIndirectCount)this->m_resolveOrThrow(405);this->m_glMultiDrawArraysIndirectCount(mode,indirect,drawcount,maxdrawcount,stride);}
+void m_glGetTexEnvfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetTexEnvfv)this->m_resolveOrThrow(406);this->m_glGetTexEnvfv(target,pname,params);}
+void m_glColorTableParameterivSGI_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glColorTableParameterivSGI)this->m_resolveOrThrow(407);this->m_glColorTableParameterivSGI(target,pname,params);}
+void m_glCullFace_lazy(GLenum mode)const{if(!this->m_glCullFace)this->m_resolveOrThrow(408);this->m_glCullFace(mode);}
+void m_glDeleteFencesAPPLE_lazy(GLsizei n,const GLuint* fences)const{if(!this->m_glDeleteFencesAPPLE)this->m_resolveOrThrow(409);this->m_glDeleteFencesAPPLE(n,fences);}
+void m_glProgramUniform4i_lazy(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{if(!this->m_glProgramUniform4i)this->m_resolveOrThrow(410);this->m_glProgramUniform4i(program,location,v0,v1,v2,v3);}
+void m_glUniformHandleui64ARB_lazy(GLint location,GLuint64 value)const{if(!this->m_glUniformHandleui64ARB)this->m_resolveOrThrow(411);this->m_glUniformHandleui64ARB(location,value);}
+void m_glProgramUniform4f_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{if(!this->m_glProgramUniform4f)this->m_resolveOrThrow(412);this->m_glProgramUniform4f(program,location,v0,v1,v2,v3);}
+void m_glViewportIndexedf_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h)const{if(!this->m_glViewportIndexedf)this->m_resolveOrThrow(413);this->m_glViewportIndexedf(index,x,y,w,h);}
+void m_glProgramUniform4d_lazy(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3)const{if(!this->m_glProgramUniform4d)this->m_resolveOrThrow(414);this->m_glProgramUniform4d(program,location,v0,v1,v2,v3);}
+void m_glTexCoord1xOES_lazy(GLfixed s)const{if(!this->m_glTexCoord1xOES)this->m_resolveOrThrow(415);this->m_glTexCoord1xOES(s);}
+void m_glVertexStream3ivATI_lazy(GLenum stream,const GLint* coords)const{if(!this->m_glVertexStream3ivATI)this->m_resolveOrThrow(416);this->m_glVertexStream3ivATI(stream,coords);}
+GLboolean m_glPointAlongPathNV_lazy(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY)const{if(!this->m_glPointAlongPathNV)this->m_resolveOrThrow(417);return this->m_glPointAlongPathNV(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);}
+void m_glEndQueryARB_lazy(GLenum target)const{if(!this->m_glEndQueryARB)this->m_resolveOrThrow(418);this->m_glEndQueryARB(target);}
+void m_glVDPAUMapSurfacesNV_lazy(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces)const{if(!this->m_glVDPAUMapSurfacesNV)this->m_resolveOrThrow(419);this->m_glVDPAUMapSurfacesNV(numSurfaces,surfaces);}
+void m_glVertex3i_lazy(GLint x,GLint y,GLint z)const{if(!this->m_glVertex3i)this->m_resolveOrThrow(420);this->m_glVertex3i(x,y,z);}
+void m_glVertexAttrib4uivARB_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttrib4uivARB)this->m_resolveOrThrow(421);this->m_glVertexAttrib4uivARB(index,v);}
+void m_glTextureStorageMem3DEXT_lazy(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{if(!this->m_glTextureStorageMem3DEXT)this->m_resolveOrThrow(422);this->m_glTextureStorageMem3DEXT(texture,levels,internalFormat,width,height,depth,memory,offset);}
+void m_glAttachShader_lazy(GLuint program,GLuint shader)const{if(!this->m_glAttachShader)this->m_resolveOrThrow(423);this->m_glAttachShader(program,shader);}
+void m_glColor4hNV_lazy(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha)const{if(!this->m_glColor4hNV)this->m_resolveOrThrow(424);this->m_glColor4hNV(red,green,blue,alpha);}
+void m_glGetFenceivNV_lazy(GLuint fence,GLenum pname,GLint* params)const{if(!this->m_glGetFenceivNV)this->m_resolveOrThrow(425);this->m_glGetFenceivNV(fence,pname,params);}
+void m_glTexCoord2fColor4ubVertex3fvSUN_lazy(const GLfloat* tc,const GLubyte* c,const GLfloat* v)const{if(!this->m_glTexCoord2fColor4ubVertex3fvSUN)this->m_resolveOrThrow(426);this->m_glTexCoord2fColor4ubVertex3fvSUN(tc,c,v);}
+void m_glGetColorTable_lazy(GLenum target,GLenum format,GLenum type,GLvoid* table)const{if(!this->m_glGetColorTable)this->m_resolveOrThrow(427);this->m_glGetColorTable(target,format,type,table);}
+void m_glFogCoordPointer_lazy(GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glFogCoordPointer)this->m_resolveOrThrow(428);this->m_glFogCoordPointer(type,stride,pointer);}
+void m_glTexStorageSparseAMD_lazy(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{if(!this->m_glTexStorageSparseAMD)this->m_resolveOrThrow(429);this->m_glTexStorageSparseAMD(target,internalFormat,width,height,depth,layers,flags);}
+GLboolean m_glUnmapNamedBuffer_lazy(GLuint buffer)const{if(!this->m_glUnmapNamedBuffer)this->m_resolveOrThrow(430);return this->m_glUnmapNamedBuffer(buffer);}
+void m_glTexCoord4bvOES_lazy(const GLbyte* coords)const{if(!this->m_glTexCoord4bvOES)this->m_resolveOrThrow(431);this->m_glTexCoord4bvOES(coords);}
+void m_glVertexAttrib3fARB_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glVertexAttrib3fARB)this->m_resolveOrThrow(432);this->m_glVertexAttrib3fARB(index,x,y,z);}
+void m_glRasterPos2xOES_lazy(GLfixed x,GLfixed y)const{if(!this->m_glRasterPos2xOES)this->m_resolveOrThrow(433);this->m_glRasterPos2xOES(x,y);}
+void m_glCreateMemoryObjectsEXT_lazy(GLsizei n,GLuint* memoryObjects)const{if(!this->m_glCreateMemoryObjectsEXT)this->m_resolveOrThrow(434);this->m_glCreateMemoryObjectsEXT(n,memoryObjects);}
+void m_glColor4ubVertex2fvSUN_lazy(const GLubyte* c,const GLfloat* v)const{if(!this->m_glColor4ubVertex2fvSUN)this->m_resolveOrThrow(435);this->m_glColor4ubVertex2fvSUN(c,v);}
+void m_glSecondaryColor3dv_lazy(const GLdouble* v)const{if(!this->m_glSecondaryColor3dv)this->m_resolveOrThrow(436);this->m_glSecondaryColor3dv(v);}
+void m_glVertexAttribI4sv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttribI4sv)this->m_resolveOrThrow(437);this->m_glVertexAttribI4sv(index,v);}
+void m_glDrawTransformFeedbackStreamInstanced_lazy(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount)const{if(!this->m_glDrawTransformFeedbackStreamInstanced)this->m_resolveOrThrow(438);this->m_glDrawTransformFeedbackStreamInstanced(mode,id,stream,instancecount);}
+void m_glMultiTexCoord4ivARB_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord4ivARB)this->m_resolveOrThrow(439);this->m_glMultiTexCoord4ivARB(target,v);}
+void m_glSpriteParameterfSGIX_lazy(GLenum pname,GLfloat param)const{if(!this->m_glSpriteParameterfSGIX)this->m_resolveOrThrow(440);this->m_glSpriteParameterfSGIX(pname,param);}
+void m_glSecondaryColor3sv_lazy(const GLshort* v)const{if(!this->m_glSecondaryColor3sv)this->m_resolveOrThrow(441);this->m_glSecondaryColor3sv(v);}
+void m_glBindVideoCaptureStreamTextureNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture)const{if(!this->m_glBindVideoCaptureStreamTextureNV)this->m_resolveOrThrow(442);this->m_glBindVideoCaptureStreamTextureNV(video_capture_slot,stream,frame_region,target,texture);}
+void m_glTexParameterIuiv_lazy(GLenum target,GLenum pname,const GLuint* params)const{if(!this->m_glTexParameterIuiv)this->m_resolveOrThrow(443);this->m_glTexParameterIuiv(target,pname,params);}
+void m_glFlushPixelDataRangeNV_lazy(GLenum target)const{if(!this->m_glFlushPixelDataRangeNV)this->m_resolveOrThrow(444);this->m_glFlushPixelDataRangeNV(target);}
+void m_glWindowPos3fv_lazy(const GLfloat* v)const{if(!this->m_glWindowPos3fv)this->m_resolveOrThrow(445);this->m_glWindowPos3fv(v);}
+void m_glVertexAttribLFormatNV_lazy(GLuint index,GLint size,GLenum type,GLsizei stride)const{if(!this->m_glVertexAttribLFormatNV)this->m_resolveOrThrow(446);this->m_glVertexAttribLFormatNV(index,size,type,stride);}
+void m_glLightModelfv_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glLightModelfv)this->m_resolveOrThrow(447);this->m_glLightModelfv(pname,params);}
+void m_glGetColorTableSGI_lazy(GLenum target,GLenum format,GLenum type,void* table)const{if(!this->m_glGetColorTableSGI)this->m_resolveOrThrow(448);this->m_glGetColorTableSGI(target,format,type,table);}
+void m_glGetCompressedTexImageARB_lazy(GLenum target,GLint level,void* img)const{if(!this->m_glGetCompressedTexImageARB)this->m_resolveOrThrow(449);this->m_glGetCompressedTexImageARB(target,level,img);}
+void m_glConvolutionParameteri_lazy(GLenum target,GLenum pname,GLint params)const{if(!this->m_glConvolutionParameteri)this->m_resolveOrThrow(450);this->m_glConvolutionParameteri(target,pname,params);}
+void m_glVertexWeighthNV_lazy(GLhalfNV weight)const{if(!this->m_glVertexWeighthNV)this->m_resolveOrThrow(451);this->m_glVertexWeighthNV(weight);}
+void m_glColorMaskIndexedEXT_lazy(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{if(!this->m_glColorMaskIndexedEXT)this->m_resolveOrThrow(452);this->m_glColorMaskIndexedEXT(index,r,g,b,a);}
+void m_glColorMaski_lazy(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{if(!this->m_glColorMaski)this->m_resolveOrThrow(453);this->m_glColorMaski(index,r,g,b,a);}
+void m_glColorFragmentOp1ATI_lazy(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{if(!this->m_glColorFragmentOp1ATI)this->m_resolveOrThrow(454);this->m_glColorFragmentOp1ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);}
+void m_glVertexAttribI4ubvEXT_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttribI4ubvEXT)this->m_resolveOrThrow(455);this->m_glVertexAttribI4ubvEXT(index,v);}
+void m_glVertexAttrib1dNV_lazy(GLuint index,GLdouble x)const{if(!this->m_glVertexAttrib1dNV)this->m_resolveOrThrow(456);this->m_glVertexAttrib1dNV(index,x);}
+void m_glUnmapObjectBufferATI_lazy(GLuint buffer)const{if(!this->m_glUnmapObjectBufferATI)this->m_resolveOrThrow(457);this->m_glUnmapObjectBufferATI(buffer);}
+void m_glNamedProgramLocalParameterI4uiEXT_lazy(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{if(!this->m_glNamedProgramLocalParameterI4uiEXT)this->m_resolveOrThrow(458);this->m_glNamedProgramLocalParameterI4uiEXT(program,target,index,x,y,z,w);}
+void m_glProgramUniform1iEXT_lazy(GLuint program,GLint location,GLint v0)const{if(!this->m_glProgramUniform1iEXT)this->m_resolveOrThrow(459);this->m_glProgramUniform1iEXT(program,location,v0);}
+void m_glDeleteQueriesARB_lazy(GLsizei n,const GLuint* ids)const{if(!this->m_glDeleteQueriesARB)this->m_resolveOrThrow(460);this->m_glDeleteQueriesARB(n,ids);}
+void m_glWindowPos3svARB_lazy(const GLshort* v)const{if(!this->m_glWindowPos3svARB)this->m_resolveOrThrow(461);this->m_glWindowPos3svARB(v);}
+void m_glVertex4s_lazy(GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glVertex4s)this->m_resolveOrThrow(462);this->m_glVertex4s(x,y,z,w);}
+void m_glImportMemoryWin32NameEXT_lazy(GLuint memory,GLuint64 size,GLenum handleType,const void* name)const{if(!this->m_glImportMemoryWin32NameEXT)this->m_resolveOrThrow(463);this->m_glImportMemoryWin32NameEXT(memory,size,handleType,name);}
+void m_glStringMarkerGREMEDY_lazy(GLsizei len,const void* string)const{if(!this->m_glStringMarkerGREMEDY)this->m_resolveOrThrow(464);this->m_glStringMarkerGREMEDY(len,string);}
+GLboolean m_glIsTransformFeedback_lazy(GLuint id)const{if(!this->m_glIsTransformFeedback)this->m_resolveOrThrow(465);return this->m_glIsTransformFeedback(id);}
+void m_glProgramUniformMatrix2x3dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2x3dvEXT)this->m_resolveOrThrow(466);this->m_glProgramUniformMatrix2x3dvEXT(program,location,count,transpose,value);}
+void m_glGetObjectLabelEXT_lazy(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label)const{if(!this->m_glGetObjectLabelEXT)this->m_resolveOrThrow(467);this->m_glGetObjectLabelEXT(type,object,bufSize,length,label);}
+void m_glUniformHandleui64vNV_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniformHandleui64vNV)this->m_resolveOrThrow(468);this->m_glUniformHandleui64vNV(location,count,value);}
+void m_glRotated_lazy(GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glRotated)this->m_resolveOrThrow(469);this->m_glRotated(angle,x,y,z);}
+GLboolean m_glIsProgramPipeline_lazy(GLuint pipeline)const{if(!this->m_glIsProgramPipeline)this->m_resolveOrThrow(470);return this->m_glIsProgramPipeline(pipeline);}
+void m_glRotatef_lazy(GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glRotatef)this->m_resolveOrThrow(471);this->m_glRotatef(angle,x,y,z);}
+void m_glVertex4i_lazy(GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glVertex4i)this->m_resolveOrThrow(472);this->m_glVertex4i(x,y,z,w);}
+void m_glGetActiveSubroutineUniformName_lazy(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{if(!this->m_glGetActiveSubroutineUniformName)this->m_resolveOrThrow(473);this->m_glGetActiveSubroutineUniformName(program,shadertype,index,bufsize,length,name);}
+void m_glVertexAttrib4sNV_lazy(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glVertexAttrib4sNV)this->m_resolveOrThrow(474);this->m_glVertexAttrib4sNV(index,x,y,z,w);}
+void m_glProgramLocalParameter4dvARB_lazy(GLenum target,GLuint index,const GLdouble* params)const{if(!this->m_glProgramLocalParameter4dvARB)this->m_resolveOrThrow(475);this->m_glProgramLocalParameter4dvARB(target,index,params);}
+void m_glReplacementCodeubSUN_lazy(GLubyte code)const{if(!this->m_glReplacementCodeubSUN)this->m_resolveOrThrow(476);this->m_glReplacementCodeubSUN(code);}
+void m_glMultiDrawElementsIndirectBindlessNV_lazy(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{if(!this->m_glMultiDrawElementsIndirectBindlessNV)this->m_resolveOrThrow(477);this->m_glMultiDrawElementsIndirectBindlessNV(mode,type,indirect,drawCount,stride,vertexBufferCount);}
+void m_glImportSemaphoreWin32HandleEXT_lazy(GLuint semaphore,GLenum handleType,void* handle)const{if(!this->m_glImportSemaphoreWin32HandleEXT)this->m_resolveOrThrow(478);this->m_glImportSemaphoreWin32HandleEXT(semaphore,handleType,handle);}
+void m_glUniformMatrix3fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix3fv)this->m_resolveOrThrow(479);this->m_glUniformMatrix3fv(location,count,transpose,value);}
+void m_glGetnMapfvARB_lazy(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{if(!this->m_glGetnMapfvARB)this->m_resolveOrThrow(480);this->m_glGetnMapfvARB(target,query,bufSize,v);}
+void m_glGetnUniformfv_lazy(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{if(!this->m_glGetnUniformfv)this->m_resolveOrThrow(481);this->m_glGetnUniformfv(program,location,bufSize,params);}
+void m_glVertexAttribL2dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL2dv)this->m_resolveOrThrow(482);this->m_glVertexAttribL2dv(index,v);}
+void m_glVertexWeightPointerEXT_lazy(GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexWeightPointerEXT)this->m_resolveOrThrow(483);this->m_glVertexWeightPointerEXT(size,type,stride,pointer);}
+void m_glTangent3sEXT_lazy(GLshort tx,GLshort ty,GLshort tz)const{if(!this->m_glTangent3sEXT)this->m_resolveOrThrow(484);this->m_glTangent3sEXT(tx,ty,tz);}
+void m_glSecondaryColorPointer_lazy(GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glSecondaryColorPointer)this->m_resolveOrThrow(485);this->m_glSecondaryColorPointer(size,type,stride,pointer);}
+void m_glAlphaFunc_lazy(GLenum func,GLclampf ref)const{if(!this->m_glAlphaFunc)this->m_resolveOrThrow(486);this->m_glAlphaFunc(func,ref);}
+void m_glGetNamedStringARB_lazy(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string)const{if(!this->m_glGetNamedStringARB)this->m_resolveOrThrow(487);this->m_glGetNamedStringARB(namelen,name,bufSize,stringlen,string);}
+void m_glTexCoord4d_lazy(GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{if(!this->m_glTexCoord4d)this->m_resolveOrThrow(488);this->m_glTexCoord4d(s,t,r,q);}
+void m_glBufferPageCommitmentARB_lazy(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit)const{if(!this->m_glBufferPageCommitmentARB)this->m_resolveOrThrow(489);this->m_glBufferPageCommitmentARB(target,offset,size,commit);}
+void m_glProgramLocalParameters4fvEXT_lazy(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{if(!this->m_glProgramLocalParameters4fvEXT)this->m_resolveOrThrow(490);this->m_glProgramLocalParameters4fvEXT(target,index,count,params);}
+void m_glStencilFunc_lazy(GLenum func,GLint ref,GLuint mask)const{if(!this->m_glStencilFunc)this->m_resolveOrThrow(491);this->m_glStencilFunc(func,ref,mask);}
+void m_glSemaphoreParameterui64vEXT_lazy(GLuint semaphore,GLenum pname,const GLuint64* params)const{if(!this->m_glSemaphoreParameterui64vEXT)this->m_resolveOrThrow(492);this->m_glSemaphoreParameterui64vEXT(semaphore,pname,params);}
+void m_glGetVertexAttribdvNV_lazy(GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetVertexAttribdvNV)this->m_resolveOrThrow(493);this->m_glGetVertexAttribdvNV(index,pname,params);}
+void m_glTexCoord3dv_lazy(const GLdouble* v)const{if(!this->m_glTexCoord3dv)this->m_resolveOrThrow(494);this->m_glTexCoord3dv(v);}
+void m_glGetQueryBufferObjectiv_lazy(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{if(!this->m_glGetQueryBufferObjectiv)this->m_resolveOrThrow(495);this->m_glGetQueryBufferObjectiv(id,buffer,pname,offset);}
+void m_glTexGenxOES_lazy(GLenum coord,GLenum pname,GLfixed param)const{if(!this->m_glTexGenxOES)this->m_resolveOrThrow(496);this->m_glTexGenxOES(coord,pname,param);}
+void m_glMultiTexCoord1fvARB_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord1fvARB)this->m_resolveOrThrow(497);this->m_glMultiTexCoord1fvARB(target,v);}
+void m_glLightEnviSGIX_lazy(GLenum pname,GLint param)const{if(!this->m_glLightEnviSGIX)this->m_resolveOrThrow(498);this->m_glLightEnviSGIX(pname,param);}
+void m_glGetProgramPipelineiv_lazy(GLuint pipeline,GLenum pname,GLint* params)const{if(!this->m_glGetProgramPipelineiv)this->m_resolveOrThrow(499);this->m_glGetProgramPipelineiv(pipeline,pname,params);}
+void m_glVertexStream2ivATI_lazy(GLenum stream,const GLint* coords)const{if(!this->m_glVertexStream2ivATI)this->m_resolveOrThrow(500);this->m_glVertexStream2ivATI(stream,coords);}
+void m_glGetColorTableEXT_lazy(GLenum target,GLenum format,GLenum type,void* data)const{if(!this->m_glGetColorTableEXT)this->m_resolveOrThrow(501);this->m_glGetColorTableEXT(target,format,type,data);}
+void m_glGetShaderInfoLog_lazy(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{if(!this->m_glGetShaderInfoLog)this->m_resolveOrThrow(502);this->m_glGetShaderInfoLog(shader,bufSize,length,infoLog);}
+void m_glGetOcclusionQueryuivNV_lazy(GLuint id,GLenum pname,GLuint* params)const{if(!this->m_glGetOcclusionQueryuivNV)this->m_resolveOrThrow(503);this->m_glGetOcclusionQueryuivNV(id,pname,params);}
+void m_glInvalidateNamedFramebufferSubData_lazy(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glInvalidateNamedFramebufferSubData)this->m_resolveOrThrow(504);this->m_glInvalidateNamedFramebufferSubData(framebuffer,numAttachments,attachments,x,y,width,height);}
+void m_glVertexAttribL1i64NV_lazy(GLuint index,GLint64EXT x)const{if(!this->m_glVertexAttribL1i64NV)this->m_resolveOrThrow(505);this->m_glVertexAttribL1i64NV(index,x);}
+void m_glVDPAUInitNV_lazy(const void* vdpDevice,const void* getProcAddress)const{if(!this->m_glVDPAUInitNV)this->m_resolveOrThrow(506);this->m_glVDPAUInitNV(vdpDevice,getProcAddress);}
+void m_glVertexAttrib1hvNV_lazy(GLuint index,const GLhalfNV* v)const{if(!this->m_glVertexAttrib1hvNV)this->m_resolveOrThrow(507);this->m_glVertexAttrib1hvNV(index,v);}
+void m_glVertexAttribI4i_lazy(GLuint index,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glVertexAttribI4i)this->m_resolveOrThrow(508);this->m_glVertexAttribI4i(index,x,y,z,w);}
+void m_glRasterPos2iv_lazy(const GLint* v)const{if(!this->m_glRasterPos2iv)this->m_resolveOrThrow(509);this->m_glRasterPos2iv(v);}
+void m_glGetIntegerui64i_vNV_lazy(GLenum value,GLuint index,GLuint64EXT* result)const{if(!this->m_glGetIntegerui64i_vNV)this->m_resolveOrThrow(510);this->m_glGetIntegerui64i_vNV(value,index,result);}
+void m_glUniformHandleui64NV_lazy(GLint location,GLuint64 value)const{if(!this->m_glUniformHandleui64NV)this->m_resolveOrThrow(511);this->m_glUniformHandleui64NV(location,value);}
+void m_glWindowPos3ivMESA_lazy(const GLint* v)const{if(!this->m_glWindowPos3ivMESA)this->m_resolveOrThrow(512);this->m_glWindowPos3ivMESA(v);}
+void m_glBlendEquationSeparate_lazy(GLenum modeRGB,GLenum modeAlpha)const{if(!this->m_glBlendEquationSeparate)this->m_resolveOrThrow(513);this->m_glBlendEquationSeparate(modeRGB,modeAlpha);}
+void m_glDrawElementsInstancedARB_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{if(!this->m_glDrawElementsInstancedARB)this->m_resolveOrThrow(514);this->m_glDrawElementsInstancedARB(mode,count,type,indices,primcount);}
+GLuint m_glGetSubroutineIndex_lazy(GLuint program,GLenum shadertype,const GLchar* name)const{if(!this->m_glGetSubroutineIndex)this->m_resolveOrThrow(515);return this->m_glGetSubroutineIndex(program,shadertype,name);}
+void m_glVertexAttrib2sv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib2sv)this->m_resolveOrThrow(516);this->m_glVertexAttrib2sv(index,v);}
+void m_glSamplePatternSGIS_lazy(GLenum pattern)const{if(!this->m_glSamplePatternSGIS)this->m_resolveOrThrow(517);this->m_glSamplePatternSGIS(pattern);}
+void m_glEGLImageTargetRenderbufferStorageOES_lazy(GLenum target,GLeglImageOES image)const{if(!this->m_glEGLImageTargetRenderbufferStorageOES)this->m_resolveOrThrow(518);this->m_glEGLImageTargetRenderbufferStorageOES(target,image);}
+void m_glPushAttrib_lazy(GLbitfield mask)const{if(!this->m_glPushAttrib)this->m_resolveOrThrow(519);this->m_glPushAttrib(mask);}
+void m_glVertex3hNV_lazy(GLhalfNV x,GLhalfNV y,GLhalfNV z)const{if(!this->m_glVertex3hNV)this->m_resolveOrThrow(520);this->m_glVertex3hNV(x,y,z);}
+void m_glRasterPos3xvOES_lazy(const GLfixed* coords)const{if(!this->m_glRasterPos3xvOES)this->m_resolveOrThrow(521);this->m_glRasterPos3xvOES(coords);}
+void m_glPathParameterfNV_lazy(GLuint path,GLenum pname,GLfloat value)const{if(!this->m_glPathParameterfNV)this->m_resolveOrThrow(522);this->m_glPathParameterfNV(path,pname,value);}
+void m_glGetUniformi64vNV_lazy(GLuint program,GLint location,GLint64EXT* params)const{if(!this->m_glGetUniformi64vNV)this->m_resolveOrThrow(523);this->m_glGetUniformi64vNV(program,location,params);}
+void m_glLightiv_lazy(GLenum light,GLenum pname,const GLint* params)const{if(!this->m_glLightiv)this->m_resolveOrThrow(524);this->m_glLightiv(light,pname,params);}
+void m_glMaterialxvOES_lazy(GLenum face,GLenum pname,const GLfixed* param)const{if(!this->m_glMaterialxvOES)this->m_resolveOrThrow(525);this->m_glMaterialxvOES(face,pname,param);}
+void m_glNamedProgramLocalParameter4fEXT_lazy(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glNamedProgramLocalParameter4fEXT)this->m_resolveOrThrow(526);this->m_glNamedProgramLocalParameter4fEXT(program,target,index,x,y,z,w);}
+void m_glVertexAttribL1dEXT_lazy(GLuint index,GLdouble x)const{if(!this->m_glVertexAttribL1dEXT)this->m_resolveOrThrow(527);this->m_glVertexAttribL1dEXT(index,x);}
+void m_glGetnUniformdvARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{if(!this->m_glGetnUniformdvARB)this->m_resolveOrThrow(528);this->m_glGetnUniformdvARB(program,location,bufSize,params);}
+void m_glSecondaryColor3bEXT_lazy(GLbyte red,GLbyte green,GLbyte blue)const{if(!this->m_glSecondaryColor3bEXT)this->m_resolveOrThrow(529);this->m_glSecondaryColor3bEXT(red,green,blue);}
+void m_glBeginPerfQueryINTEL_lazy(GLuint queryHandle)const{if(!this->m_glBeginPerfQueryINTEL)this->m_resolveOrThrow(530);this->m_glBeginPerfQueryINTEL(queryHandle);}
+void m_glProgramUniform1uivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform1uivEXT)this->m_resolveOrThrow(531);this->m_glProgramUniform1uivEXT(program,location,count,value);}
+void m_glImageTransformParameterivHP_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glImageTransformParameterivHP)this->m_resolveOrThrow(532);this->m_glImageTransformParameterivHP(target,pname,params);}
+void m_glDeleteBuffers_lazy(GLsizei n,const GLuint* buffers)const{if(!this->m_glDeleteBuffers)this->m_resolveOrThrow(533);this->m_glDeleteBuffers(n,buffers);}
+void m_glBindProgramPipeline_lazy(GLuint pipeline)const{if(!this->m_glBindProgramPipeline)this->m_resolveOrThrow(534);this->m_glBindProgramPipeline(pipeline);}
+void m_glScissor_lazy(GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glScissor)this->m_resolveOrThrow(535);this->m_glScissor(x,y,width,height);}
+void m_glProgramUniform4fv_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform4fv)this->m_resolveOrThrow(536);this->m_glProgramUniform4fv(program,location,count,value);}
+void m_glGetBooleanv_lazy(GLenum pname,GLboolean* params)const{if(!this->m_glGetBooleanv)this->m_resolveOrThrow(537);this->m_glGetBooleanv(pname,params);}
+void m_glMaterialfv_lazy(GLenum face,GLenum pname,const GLfloat* params)const{if(!this->m_glMaterialfv)this->m_resolveOrThrow(538);this->m_glMaterialfv(face,pname,params);}
+void m_glWindowPos4fvMESA_lazy(const GLfloat* v)const{if(!this->m_glWindowPos4fvMESA)this->m_resolveOrThrow(539);this->m_glWindowPos4fvMESA(v);}
+void m_glVertexAttribIPointerEXT_lazy(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribIPointerEXT)this->m_resolveOrThrow(540);this->m_glVertexAttribIPointerEXT(index,size,type,stride,pointer);}
+void m_glProgramBufferParametersfvNV_lazy(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params)const{if(!this->m_glProgramBufferParametersfvNV)this->m_resolveOrThrow(541);this->m_glProgramBufferParametersfvNV(target,bindingIndex,wordIndex,count,params);}
+void m_glAlphaFuncxOES_lazy(GLenum func,GLfixed ref)const{if(!this->m_glAlphaFuncxOES)this->m_resolveOrThrow(542);this->m_glAlphaFuncxOES(func,ref);}
+void m_glMultiDrawArraysIndirectAMD_lazy(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride)const{if(!this->m_glMultiDrawArraysIndirectAMD)this->m_resolveOrThrow(543);this->m_glMultiDrawArraysIndirectAMD(mode,indirect,primcount,stride);}
+void m_glNormalStream3ivATI_lazy(GLenum stream,const GLint* coords)const{if(!this->m_glNormalStream3ivATI)this->m_resolveOrThrow(544);this->m_glNormalStream3ivATI(stream,coords);}
+void m_glTextureImage3DMultisampleNV_lazy(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{if(!this->m_glTextureImage3DMultisampleNV)this->m_resolveOrThrow(545);this->m_glTextureImage3DMultisampleNV(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);}
+void m_glProgramUniform4uivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform4uivEXT)this->m_resolveOrThrow(546);this->m_glProgramUniform4uivEXT(program,location,count,value);}
+void m_glReplacementCodeusvSUN_lazy(const GLushort* code)const{if(!this->m_glReplacementCodeusvSUN)this->m_resolveOrThrow(547);this->m_glReplacementCodeusvSUN(code);}
+GLint m_glPollInstrumentsSGIX_lazy(GLint* marker_p)const{if(!this->m_glPollInstrumentsSGIX)this->m_resolveOrThrow(548);return this->m_glPollInstrumentsSGIX(marker_p);}
+void m_glGetTextureLevelParameteriv_lazy(GLuint texture,GLint level,GLenum pname,GLint* params)const{if(!this->m_glGetTextureLevelParameteriv)this->m_resolveOrThrow(549);this->m_glGetTextureLevelParameteriv(texture,level,pname,params);}
+void m_glVertexAttribI2uiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI2uiv)this->m_resolveOrThrow(550);this->m_glVertexAttribI2uiv(index,v);}
+void m_glMapControlPointsNV_lazy(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points)const{if(!this->m_glMapControlPointsNV)this->m_resolveOrThrow(551);this->m_glMapControlPointsNV(target,index,type,ustride,vstride,uorder,vorder,packed,points);}
+void m_glColor4dv_lazy(const GLdouble* v)const{if(!this->m_glColor4dv)this->m_resolveOrThrow(552);this->m_glColor4dv(v);}
+void m_glInvalidateBufferSubData_lazy(GLuint buffer,GLintptr offset,GLsizeiptr length)const{if(!this->m_glInvalidateBufferSubData)this->m_resolveOrThrow(553);this->m_glInvalidateBufferSubData(buffer,offset,length);}
+void m_glMultiTexCoord1hNV_lazy(GLenum target,GLhalfNV s)const{if(!this->m_glMultiTexCoord1hNV)this->m_resolveOrThrow(554);this->m_glMultiTexCoord1hNV(target,s);}
+void m_glPointParameterfv_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glPointParameterfv)this->m_resolveOrThrow(555);this->m_glPointParameterfv(pname,params);}
+void m_glUniformMatrix2fvARB_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix2fvARB)this->m_resolveOrThrow(556);this->m_glUniformMatrix2fvARB(location,count,transpose,value);}
+void m_glUniform2fv_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform2fv)this->m_resolveOrThrow(557);this->m_glUniform2fv(location,count,value);}
+void m_glVertexPointerListIBM_lazy(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glVertexPointerListIBM)this->m_resolveOrThrow(558);this->m_glVertexPointerListIBM(size,type,stride,pointer,ptrstride);}
+void m_glGetMultiTexGenfvEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params)const{if(!this->m_glGetMultiTexGenfvEXT)this->m_resolveOrThrow(559);this->m_glGetMultiTexGenfvEXT(texunit,coord,pname,params);}
+void m_glGetMinmaxEXT_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{if(!this->m_glGetMinmaxEXT)this->m_resolveOrThrow(560);this->m_glGetMinmaxEXT(target,reset,format,type,values);}
+GLboolean m_glIsFenceNV_lazy(GLuint fence)const{if(!this->m_glIsFenceNV)this->m_resolveOrThrow(561);return this->m_glIsFenceNV(fence);}
+void m_glMatrixFrustumEXT_lazy(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{if(!this->m_glMatrixFrustumEXT)this->m_resolveOrThrow(562);this->m_glMatrixFrustumEXT(mode,left,right,bottom,top,zNear,zFar);}
+void m_glDispatchComputeIndirect_lazy(GLintptr indirect)const{if(!this->m_glDispatchComputeIndirect)this->m_resolveOrThrow(563);this->m_glDispatchComputeIndirect(indirect);}
+GLint m_glQueryResourceNV_lazy(GLenum queryType,GLint tagId,GLuint bufSize,GLint* buffer)const{if(!this->m_glQueryResourceNV)this->m_resolveOrThrow(564);return this->m_glQueryResourceNV(queryType,tagId,bufSize,buffer);}
+void m_glMultiTexCoord4bOES_lazy(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{if(!this->m_glMultiTexCoord4bOES)this->m_resolveOrThrow(565);this->m_glMultiTexCoord4bOES(texture,s,t,r,q);}
+void m_glProgramEnvParameter4dARB_lazy(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glProgramEnvParameter4dARB)this->m_resolveOrThrow(566);this->m_glProgramEnvParameter4dARB(target,index,x,y,z,w);}
+void m_glProgramUniform1uiEXT_lazy(GLuint program,GLint location,GLuint v0)const{if(!this->m_glProgramUniform1uiEXT)this->m_resolveOrThrow(567);this->m_glProgramUniform1uiEXT(program,location,v0);}
+void m_glBindBufferRange_lazy(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glBindBufferRange)this->m_resolveOrThrow(568);this->m_glBindBufferRange(target,index,buffer,offset,size);}
+void m_glNormal3iv_lazy(const GLint* v)const{if(!this->m_glNormal3iv)this->m_resolveOrThrow(569);this->m_glNormal3iv(v);}
+void m_glVertexAttribL3dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL3dv)this->m_resolveOrThrow(570);this->m_glVertexAttribL3dv(index,v);}
+void m_glGetUniformdv_lazy(GLuint program,GLint location,GLdouble* params)const{if(!this->m_glGetUniformdv)this->m_resolveOrThrow(571);this->m_glGetUniformdv(program,location,params);}
+void m_glGetMultiTexLevelParameterfvEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params)const{if(!this->m_glGetMultiTexLevelParameterfvEXT)this->m_resolveOrThrow(572);this->m_glGetMultiTexLevelParameterfvEXT(texunit,target,level,pname,params);}
+void m_glFinalCombinerInputNV_lazy(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{if(!this->m_glFinalCombinerInputNV)this->m_resolveOrThrow(573);this->m_glFinalCombinerInputNV(variable,input,mapping,componentUsage);}
+void m_glCullParameterdvEXT_lazy(GLenum pname,GLdouble* params)const{if(!this->m_glCullParameterdvEXT)this->m_resolveOrThrow(574);this->m_glCullParameterdvEXT(pname,params);}
+void m_glMultiTexCoord4s_lazy(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{if(!this->m_glMultiTexCoord4s)this->m_resolveOrThrow(575);this->m_glMultiTexCoord4s(target,s,t,r,q);}
+void m_glMapVertexAttrib1fAPPLE_lazy(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{if(!this->m_glMapVertexAttrib1fAPPLE)this->m_resolveOrThrow(576);this->m_glMapVertexAttrib1fAPPLE(index,size,u1,u2,stride,order,points);}
+void m_glConvolutionParameterfEXT_lazy(GLenum target,GLenum pname,GLfloat params)const{if(!this->m_glConvolutionParameterfEXT)this->m_resolveOrThrow(577);this->m_glConvolutionParameterfEXT(target,pname,params);}
+void m_glTexCoord1iv_lazy(const GLint* v)const{if(!this->m_glTexCoord1iv)this->m_resolveOrThrow(578);this->m_glTexCoord1iv(v);}
+void m_glProgramUniform3fvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform3fvEXT)this->m_resolveOrThrow(579);this->m_glProgramUniform3fvEXT(program,location,count,value);}
+void m_glColor3uiv_lazy(const GLuint* v)const{if(!this->m_glColor3uiv)this->m_resolveOrThrow(580);this->m_glColor3uiv(v);}
+void m_glRenderGpuMaskNV_lazy(GLbitfield mask)const{if(!this->m_glRenderGpuMaskNV)this->m_resolveOrThrow(581);this->m_glRenderGpuMaskNV(mask);}
+void m_glListBase_lazy(GLuint base)const{if(!this->m_glListBase)this->m_resolveOrThrow(582);this->m_glListBase(base);}
+void m_glTexCoord2bOES_lazy(GLbyte s,GLbyte t)const{if(!this->m_glTexCoord2bOES)this->m_resolveOrThrow(583);this->m_glTexCoord2bOES(s,t);}
+GLuint m_glBindMaterialParameterEXT_lazy(GLenum face,GLenum value)const{if(!this->m_glBindMaterialParameterEXT)this->m_resolveOrThrow(584);return this->m_glBindMaterialParameterEXT(face,value);}
+void m_glGlobalAlphaFactorubSUN_lazy(GLubyte factor)const{if(!this->m_glGlobalAlphaFactorubSUN)this->m_resolveOrThrow(585);this->m_glGlobalAlphaFactorubSUN(factor);}
+void m_glVertexAttribL1ui64NV_lazy(GLuint index,GLuint64EXT x)const{if(!this->m_glVertexAttribL1ui64NV)this->m_resolveOrThrow(586);this->m_glVertexAttribL1ui64NV(index,x);}
+void m_glPointParameterfSGIS_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPointParameterfSGIS)this->m_resolveOrThrow(587);this->m_glPointParameterfSGIS(pname,param);}
+void m_glGetImageTransformParameterivHP_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetImageTransformParameterivHP)this->m_resolveOrThrow(588);this->m_glGetImageTransformParameterivHP(target,pname,params);}
+void m_glColorSubTableEXT_lazy(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data)const{if(!this->m_glColorSubTableEXT)this->m_resolveOrThrow(589);this->m_glColorSubTableEXT(target,start,count,format,type,data);}
+void m_glPixelTexGenParameterfvSGIS_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glPixelTexGenParameterfvSGIS)this->m_resolveOrThrow(590);this->m_glPixelTexGenParameterfvSGIS(pname,params);}
+GLenum m_glClientWaitSync_lazy(GLsync sync,GLbitfield flags,GLuint64 timeout)const{if(!this->m_glClientWaitSync)this->m_resolveOrThrow(591);return this->m_glClientWaitSync(sync,flags,timeout);}
+void m_glQueryObjectParameteruiAMD_lazy(GLenum target,GLuint id,GLenum pname,GLuint param)const{if(!this->m_glQueryObjectParameteruiAMD)this->m_resolveOrThrow(592);this->m_glQueryObjectParameteruiAMD(target,id,pname,param);}
+void m_glVertexAttribs1fvNV_lazy(GLuint index,GLsizei count,const GLfloat* v)const{if(!this->m_glVertexAttribs1fvNV)this->m_resolveOrThrow(593);this->m_glVertexAttribs1fvNV(index,count,v);}
+void m_glVertexAttrib4NusvARB_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttrib4NusvARB)this->m_resolveOrThrow(594);this->m_glVertexAttrib4NusvARB(index,v);}
+void m_glVariantPointerEXT_lazy(GLuint id,GLenum type,GLuint stride,const void* addr)const{if(!this->m_glVariantPointerEXT)this->m_resolveOrThrow(595);this->m_glVariantPointerEXT(id,type,stride,addr);}
+void m_glTextureBuffer_lazy(GLuint texture,GLenum internalformat,GLuint buffer)const{if(!this->m_glTextureBuffer)this->m_resolveOrThrow(596);this->m_glTextureBuffer(texture,internalformat,buffer);}
+void m_glVertexAttribI1uiEXT_lazy(GLuint index,GLuint x)const{if(!this->m_glVertexAttribI1uiEXT)this->m_resolveOrThrow(597);this->m_glVertexAttribI1uiEXT(index,x);}
+void m_glInvalidateTexImage_lazy(GLuint texture,GLint level)const{if(!this->m_glInvalidateTexImage)this->m_resolveOrThrow(598);this->m_glInvalidateTexImage(texture,level);}
+void m_glProgramEnvParametersI4ivNV_lazy(GLenum target,GLuint index,GLsizei count,const GLint* params)const{if(!this->m_glProgramEnvParametersI4ivNV)this->m_resolveOrThrow(599);this->m_glProgramEnvParametersI4ivNV(target,index,count,params);}
+GLenum m_glPathGlyphIndexArrayNV_lazy(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{if(!this->m_glPathGlyphIndexArrayNV)this->m_resolveOrThrow(600);return this->m_glPathGlyphIndexArrayNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+void m_glCopyImageSubData_lazy(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{if(!this->m_glCopyImageSubData)this->m_resolveOrThrow(601);this->m_glCopyImageSubData(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+void m_glGetUniformSubroutineuiv_lazy(GLenum shadertype,GLint location,GLuint* params)const{if(!this->m_glGetUniformSubroutineuiv)this->m_resolveOrThrow(602);this->m_glGetUniformSubroutineuiv(shadertype,location,params);}
+void m_glBindVertexBuffer_lazy(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{if(!this->m_glBindVertexBuffer)this->m_resolveOrThrow(603);this->m_glBindVertexBuffer(bindingindex,buffer,offset,stride);}
+void m_glMultiTexCoord1iARB_lazy(GLenum target,GLint s)const{if(!this->m_glMultiTexCoord1iARB)this->m_resolveOrThrow(604);this->m_glMultiTexCoord1iARB(target,s);}
+void m_glDebugMessageInsert_lazy(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{if(!this->m_glDebugMessageInsert)this->m_resolveOrThrow(605);this->m_glDebugMessageInsert(source,type,id,severity,length,buf);}
+void m_glBeginVertexShaderEXT_lazy()const{if(!this->m_glBeginVertexShaderEXT)this->m_resolveOrThrow(606);this->m_glBeginVertexShaderEXT();}
+GLboolean m_glIsVariantEnabledEXT_lazy(GLuint id,GLenum cap)const{if(!this->m_glIsVariantEnabledEXT)this->m_resolveOrThrow(607);return this->m_glIsVariantEnabledEXT(id,cap);}
+void m_glPassThroughxOES_lazy(GLfixed token)const{if(!this->m_glPassThroughxOES)this->m_resolveOrThrow(608);this->m_glPassThroughxOES(token);}
+GLboolean m_glIsSampler_lazy(GLuint sampler)const{if(!this->m_glIsSampler)this->m_resolveOrThrow(609);return this->m_glIsSampler(sampler);}
+void m_glConservativeRasterParameterfNV_lazy(GLenum pname,GLfloat value)const{if(!this->m_glConservativeRasterParameterfNV)this->m_resolveOrThrow(610);this->m_glConservativeRasterParameterfNV(pname,value);}
+void m_glMultiTexGenivEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,const GLint* params)const{if(!this->m_glMultiTexGenivEXT)this->m_resolveOrThrow(611);this->m_glMultiTexGenivEXT(texunit,coord,pname,params);}
+void m_glNamedFramebufferTexture2DEXT_lazy(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glNamedFramebufferTexture2DEXT)this->m_resolveOrThrow(612);this->m_glNamedFramebufferTexture2DEXT(framebuffer,attachment,textarget,texture,level);}
+void m_glCopyTexSubImage1D_lazy(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyTexSubImage1D)this->m_resolveOrThrow(613);this->m_glCopyTexSubImage1D(target,level,xoffset,x,y,width);}
+void m_glTexCoord1i_lazy(GLint s)const{if(!this->m_glTexCoord1i)this->m_resolveOrThrow(614);this->m_glTexCoord1i(s);}
+GLenum m_glCheckFramebufferStatus_lazy(GLenum target)const{if(!this->m_glCheckFramebufferStatus)this->m_resolveOrThrow(615);return this->m_glCheckFramebufferStatus(target);}
+void m_glDrawElementArrayAPPLE_lazy(GLenum mode,GLint first,GLsizei count)const{if(!this->m_glDrawElementArrayAPPLE)this->m_resolveOrThrow(616);this->m_glDrawElementArrayAPPLE(mode,first,count);}
+void m_glTexCoord1d_lazy(GLdouble s)const{if(!this->m_glTexCoord1d)this->m_resolveOrThrow(617);this->m_glTexCoord1d(s);}
+void m_glTexCoord1f_lazy(GLfloat s)const{if(!this->m_glTexCoord1f)this->m_resolveOrThrow(618);this->m_glTexCoord1f(s);}
+void m_glFragmentLightivSGIX_lazy(GLenum light,GLenum pname,const GLint* params)const{if(!this->m_glFragmentLightivSGIX)this->m_resolveOrThrow(619);this->m_glFragmentLightivSGIX(light,pname,params);}
+void m_glBindImageTexture_lazy(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format)const{if(!this->m_glBindImageTexture)this->m_resolveOrThrow(620);this->m_glBindImageTexture(unit,texture,level,layered,layer,access,format);}
+void m_glTransformFeedbackVaryings_lazy(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{if(!this->m_glTransformFeedbackVaryings)this->m_resolveOrThrow(621);this->m_glTransformFeedbackVaryings(program,count,varyings,bufferMode);}
+void m_glMulticastBufferSubDataNV_lazy(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const GLvoid* data)const{if(!this->m_glMulticastBufferSubDataNV)this->m_resolveOrThrow(622);this->m_glMulticastBufferSubDataNV(gpuMask,buffer,offset,size,data);}
+void m_glDrawRangeElements_lazy(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices)const{if(!this->m_glDrawRangeElements)this->m_resolveOrThrow(623);this->m_glDrawRangeElements(mode,start,end,count,type,indices);}
+void m_glTexCoord1s_lazy(GLshort s)const{if(!this->m_glTexCoord1s)this->m_resolveOrThrow(624);this->m_glTexCoord1s(s);}
+void m_glBindBufferBase_lazy(GLenum target,GLuint index,GLuint buffer)const{if(!this->m_glBindBufferBase)this->m_resolveOrThrow(625);this->m_glBindBufferBase(target,index,buffer);}
+void m_glColor3bv_lazy(const GLbyte* v)const{if(!this->m_glColor3bv)this->m_resolveOrThrow(626);this->m_glColor3bv(v);}
+void m_glSyncTextureINTEL_lazy(GLuint texture)const{if(!this->m_glSyncTextureINTEL)this->m_resolveOrThrow(627);this->m_glSyncTextureINTEL(texture);}
+void m_glCreateSamplers_lazy(GLsizei n,GLuint* samplers)const{if(!this->m_glCreateSamplers)this->m_resolveOrThrow(628);this->m_glCreateSamplers(n,samplers);}
+void m_glCombinerParameterfNV_lazy(GLenum pname,GLfloat param)const{if(!this->m_glCombinerParameterfNV)this->m_resolveOrThrow(629);this->m_glCombinerParameterfNV(pname,param);}
+void m_glGetArrayObjectivATI_lazy(GLenum array,GLenum pname,GLint* params)const{if(!this->m_glGetArrayObjectivATI)this->m_resolveOrThrow(630);this->m_glGetArrayObjectivATI(array,pname,params);}
+void m_glMultiDrawArrays_lazy(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount)const{if(!this->m_glMultiDrawArrays)this->m_resolveOrThrow(631);this->m_glMultiDrawArrays(mode,first,count,drawcount);}
+void m_glSampleMapATI_lazy(GLuint dst,GLuint interp,GLenum swizzle)const{if(!this->m_glSampleMapATI)this->m_resolveOrThrow(632);this->m_glSampleMapATI(dst,interp,swizzle);}
+void m_glProgramUniform2i64ARB_lazy(GLuint program,GLint location,GLint64 x,GLint64 y)const{if(!this->m_glProgramUniform2i64ARB)this->m_resolveOrThrow(633);this->m_glProgramUniform2i64ARB(program,location,x,y);}
+void m_glBinormal3ivEXT_lazy(const GLint* v)const{if(!this->m_glBinormal3ivEXT)this->m_resolveOrThrow(634);this->m_glBinormal3ivEXT(v);}
+void m_glMultiDrawArraysIndirectCountARB_lazy(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{if(!this->m_glMultiDrawArraysIndirectCountARB)this->m_resolveOrThrow(635);this->m_glMultiDrawArraysIndirectCountARB(mode,indirect,drawcount,maxdrawcount,stride);}
+void m_glTextureStorageMem1DEXT_lazy(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{if(!this->m_glTextureStorageMem1DEXT)this->m_resolveOrThrow(636);this->m_glTextureStorageMem1DEXT(texture,levels,internalFormat,width,memory,offset);}
+void m_glWindowPos2ivMESA_lazy(const GLint* v)const{if(!this->m_glWindowPos2ivMESA)this->m_resolveOrThrow(637);this->m_glWindowPos2ivMESA(v);}
+void m_glTexCoordP4ui_lazy(GLenum type,GLuint coords)const{if(!this->m_glTexCoordP4ui)this->m_resolveOrThrow(638);this->m_glTexCoordP4ui(type,coords);}
+void m_glMultiTexSubImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexSubImage1DEXT)this->m_resolveOrThrow(639);this->m_glMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,type,pixels);}
+void m_glProgramUniformMatrix2x3fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2x3fvEXT)this->m_resolveOrThrow(640);this->m_glProgramUniformMatrix2x3fvEXT(program,location,count,transpose,value);}
+void m_glBufferDataARB_lazy(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage)const{if(!this->m_glBufferDataARB)this->m_resolveOrThrow(641);this->m_glBufferDataARB(target,size,data,usage);}
+void m_glVertexAttribIFormat_lazy(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexAttribIFormat)this->m_resolveOrThrow(642);this->m_glVertexAttribIFormat(attribindex,size,type,relativeoffset);}
+void m_glCreateFramebuffers_lazy(GLsizei n,GLuint* framebuffers)const{if(!this->m_glCreateFramebuffers)this->m_resolveOrThrow(643);this->m_glCreateFramebuffers(n,framebuffers);}
+void m_glNormalStream3dvATI_lazy(GLenum stream,const GLdouble* coords)const{if(!this->m_glNormalStream3dvATI)this->m_resolveOrThrow(644);this->m_glNormalStream3dvATI(stream,coords);}
+void m_glClearAccum_lazy(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{if(!this->m_glClearAccum)this->m_resolveOrThrow(645);this->m_glClearAccum(red,green,blue,alpha);}
+void m_glUniform3i64vNV_lazy(GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glUniform3i64vNV)this->m_resolveOrThrow(646);this->m_glUniform3i64vNV(location,count,value);}
+void m_glNormal3fVertex3fSUN_lazy(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glNormal3fVertex3fSUN)this->m_resolveOrThrow(647);this->m_glNormal3fVertex3fSUN(nx,ny,nz,x,y,z);}
+void m_glUniform2uivEXT_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform2uivEXT)this->m_resolveOrThrow(648);this->m_glUniform2uivEXT(location,count,value);}
+void m_glBeginQuery_lazy(GLenum target,GLuint id)const{if(!this->m_glBeginQuery)this->m_resolveOrThrow(649);this->m_glBeginQuery(target,id);}
+void m_glStencilThenCoverStrokePathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glStencilThenCoverStrokePathInstancedNV)this->m_resolveOrThrow(650);this->m_glStencilThenCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);}
+void m_glBindBuffer_lazy(GLenum target,GLuint buffer)const{if(!this->m_glBindBuffer)this->m_resolveOrThrow(651);this->m_glBindBuffer(target,buffer);}
+void m_glMap2d_lazy(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{if(!this->m_glMap2d)this->m_resolveOrThrow(652);this->m_glMap2d(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+void m_glMap2f_lazy(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{if(!this->m_glMap2f)this->m_resolveOrThrow(653);this->m_glMap2f(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+void m_glMakeImageHandleResidentNV_lazy(GLuint64 handle,GLenum access)const{if(!this->m_glMakeImageHandleResidentNV)this->m_resolveOrThrow(654);this->m_glMakeImageHandleResidentNV(handle,access);}
+void m_glUniformMatrix2x4fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix2x4fv)this->m_resolveOrThrow(655);this->m_glUniformMatrix2x4fv(location,count,transpose,value);}
+void m_glGetMultiTexParameterfvEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetMultiTexParameterfvEXT)this->m_resolveOrThrow(656);this->m_glGetMultiTexParameterfvEXT(texunit,target,pname,params);}
+void m_glDepthRangeIndexed_lazy(GLuint index,GLdouble n,GLdouble f)const{if(!this->m_glDepthRangeIndexed)this->m_resolveOrThrow(657);this->m_glDepthRangeIndexed(index,n,f);}
+GLboolean m_glIsEnabled_lazy(GLenum cap)const{if(!this->m_glIsEnabled)this->m_resolveOrThrow(658);return this->m_glIsEnabled(cap);}
+void m_glMatrixScalefEXT_lazy(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glMatrixScalefEXT)this->m_resolveOrThrow(659);this->m_glMatrixScalefEXT(mode,x,y,z);}
+GLenum m_glGetError_lazy()const{if(!this->m_glGetError)this->m_resolveOrThrow(660);return this->m_glGetError();}
+void m_glGetTexEnviv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTexEnviv)this->m_resolveOrThrow(661);this->m_glGetTexEnviv(target,pname,params);}
+GLuint m_glBindTextureUnitParameterEXT_lazy(GLenum unit,GLenum value)const{if(!this->m_glBindTextureUnitParameterEXT)this->m_resolveOrThrow(662);return this->m_glBindTextureUnitParameterEXT(unit,value);}
+void m_glGetnUniformfvARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{if(!this->m_glGetnUniformfvARB)this->m_resolveOrThrow(663);this->m_glGetnUniformfvARB(program,location,bufSize,params);}
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* n,const GLfloat* v)const{if(!this->m_glReplacementCodeuiNormal3fVertex3fvSUN)this->m_resolveOrThrow(664);this->m_glReplacementCodeuiNormal3fVertex3fvSUN(rc,n,v);}
+void m_glDeletePerfQueryINTEL_lazy(GLuint queryHandle)const{if(!this->m_glDeletePerfQueryINTEL)this->m_resolveOrThrow(665);this->m_glDeletePerfQueryINTEL(queryHandle);}
+void m_glActiveVaryingNV_lazy(GLuint program,const GLchar* name)const{if(!this->m_glActiveVaryingNV)this->m_resolveOrThrow(666);this->m_glActiveVaryingNV(program,name);}
+void m_glGetActiveUniformARB_lazy(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{if(!this->m_glGetActiveUniformARB)this->m_resolveOrThrow(667);this->m_glGetActiveUniformARB(programObj,index,maxLength,length,size,type,name);}
+void m_glVertexAttribI3ivEXT_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI3ivEXT)this->m_resolveOrThrow(668);this->m_glVertexAttribI3ivEXT(index,v);}
+void m_glEvalCoord1d_lazy(GLdouble u)const{if(!this->m_glEvalCoord1d)this->m_resolveOrThrow(669);this->m_glEvalCoord1d(u);}
+void m_glNamedCopyBufferSubDataEXT_lazy(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{if(!this->m_glNamedCopyBufferSubDataEXT)this->m_resolveOrThrow(670);this->m_glNamedCopyBufferSubDataEXT(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+void m_glEvalCoord1f_lazy(GLfloat u)const{if(!this->m_glEvalCoord1f)this->m_resolveOrThrow(671);this->m_glEvalCoord1f(u);}
+void m_glPixelMapfv_lazy(GLenum map,GLsizei mapsize,const GLfloat* values)const{if(!this->m_glPixelMapfv)this->m_resolveOrThrow(672);this->m_glPixelMapfv(map,mapsize,values);}
+void m_glVertexAttribI1ivEXT_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI1ivEXT)this->m_resolveOrThrow(673);this->m_glVertexAttribI1ivEXT(index,v);}
+GLsync m_glCreateSyncFromCLeventARB_lazy(struct _cl_context* context,struct _cl_event* event,GLbitfield flags)const{if(!this->m_glCreateSyncFromCLeventARB)this->m_resolveOrThrow(674);return this->m_glCreateSyncFromCLeventARB(context,event,flags);}
+void m_glGetPixelMapusv_lazy(GLenum map,GLushort* values)const{if(!this->m_glGetPixelMapusv)this->m_resolveOrThrow(675);this->m_glGetPixelMapusv(map,values);}
+void m_glGetnColorTableARB_lazy(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{if(!this->m_glGetnColorTableARB)this->m_resolveOrThrow(676);this->m_glGetnColorTableARB(target,format,type,bufSize,table);}
+void m_glAccum_lazy(GLenum op,GLfloat value)const{if(!this->m_glAccum)this->m_resolveOrThrow(677);this->m_glAccum(op,value);}
+void m_glRasterPos3sv_lazy(const GLshort* v)const{if(!this->m_glRasterPos3sv)this->m_resolveOrThrow(678);this->m_glRasterPos3sv(v);}
+void m_glTexCoord2iv_lazy(const GLint* v)const{if(!this->m_glTexCoord2iv)this->m_resolveOrThrow(679);this->m_glTexCoord2iv(v);}
+void m_glBlendFunciARB_lazy(GLuint buf,GLenum src,GLenum dst)const{if(!this->m_glBlendFunciARB)this->m_resolveOrThrow(680);this->m_glBlendFunciARB(buf,src,dst);}
+void m_glProgramUniform3i64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glProgramUniform3i64vARB)this->m_resolveOrThrow(681);this->m_glProgramUniform3i64vARB(program,location,count,value);}
+void m_glGetFramebufferAttachmentParameteriv_lazy(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{if(!this->m_glGetFramebufferAttachmentParameteriv)this->m_resolveOrThrow(682);this->m_glGetFramebufferAttachmentParameteriv(target,attachment,pname,params);}
+void m_glProgramUniform4ui_lazy(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{if(!this->m_glProgramUniform4ui)this->m_resolveOrThrow(683);this->m_glProgramUniform4ui(program,location,v0,v1,v2,v3);}
+void m_glStencilMask_lazy(GLuint mask)const{if(!this->m_glStencilMask)this->m_resolveOrThrow(684);this->m_glStencilMask(mask);}
+void m_glResetHistogramEXT_lazy(GLenum target)const{if(!this->m_glResetHistogramEXT)this->m_resolveOrThrow(685);this->m_glResetHistogramEXT(target);}
+void m_glLightxOES_lazy(GLenum light,GLenum pname,GLfixed param)const{if(!this->m_glLightxOES)this->m_resolveOrThrow(686);this->m_glLightxOES(light,pname,param);}
+void m_glNamedBufferData_lazy(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{if(!this->m_glNamedBufferData)this->m_resolveOrThrow(687);this->m_glNamedBufferData(buffer,size,data,usage);}
+void m_glVertexStream3sATI_lazy(GLenum stream,GLshort x,GLshort y,GLshort z)const{if(!this->m_glVertexStream3sATI)this->m_resolveOrThrow(688);this->m_glVertexStream3sATI(stream,x,y,z);}
+void m_glVertexAttrib3fvARB_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib3fvARB)this->m_resolveOrThrow(689);this->m_glVertexAttrib3fvARB(index,v);}
+void m_glClearNamedBufferSubData_lazy(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearNamedBufferSubData)this->m_resolveOrThrow(690);this->m_glClearNamedBufferSubData(buffer,internalformat,offset,size,format,type,data);}
+void m_glProgramUniformHandleui64ARB_lazy(GLuint program,GLint location,GLuint64 value)const{if(!this->m_glProgramUniformHandleui64ARB)this->m_resolveOrThrow(691);this->m_glProgramUniformHandleui64ARB(program,location,value);}
+void m_glUniform3iARB_lazy(GLint location,GLint v0,GLint v1,GLint v2)const{if(!this->m_glUniform3iARB)this->m_resolveOrThrow(692);this->m_glUniform3iARB(location,v0,v1,v2);}
+GLhandleARB m_glCreateProgramObjectARB_lazy()const{if(!this->m_glCreateProgramObjectARB)this->m_resolveOrThrow(693);return this->m_glCreateProgramObjectARB();}
+void m_glMultiTexCoord1dvARB_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord1dvARB)this->m_resolveOrThrow(694);this->m_glMultiTexCoord1dvARB(target,v);}
+void m_glGetObjectParameterfvARB_lazy(GLhandleARB obj,GLenum pname,GLfloat* params)const{if(!this->m_glGetObjectParameterfvARB)this->m_resolveOrThrow(695);this->m_glGetObjectParameterfvARB(obj,pname,params);}
+void m_glRectsv_lazy(const GLshort* v1,const GLshort* v2)const{if(!this->m_glRectsv)this->m_resolveOrThrow(696);this->m_glRectsv(v1,v2);}
+void m_glMultiTexImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexImage2DEXT)this->m_resolveOrThrow(697);this->m_glMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,format,type,pixels);}
+void m_glProgramUniform1i64NV_lazy(GLuint program,GLint location,GLint64EXT x)const{if(!this->m_glProgramUniform1i64NV)this->m_resolveOrThrow(698);this->m_glProgramUniform1i64NV(program,location,x);}
+void m_glGetObjectBufferivATI_lazy(GLuint buffer,GLenum pname,GLint* params)const{if(!this->m_glGetObjectBufferivATI)this->m_resolveOrThrow(699);this->m_glGetObjectBufferivATI(buffer,pname,params);}
+void m_glUniform4i64ARB_lazy(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{if(!this->m_glUniform4i64ARB)this->m_resolveOrThrow(700);this->m_glUniform4i64ARB(location,x,y,z,w);}
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_lazy(const GLuint* rc,const GLubyte* c,const GLfloat* v)const{if(!this->m_glReplacementCodeuiColor4ubVertex3fvSUN)this->m_resolveOrThrow(701);this->m_glReplacementCodeuiColor4ubVertex3fvSUN(rc,c,v);}
+void m_glBlendFuncSeparateINGR_lazy(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{if(!this->m_glBlendFuncSeparateINGR)this->m_resolveOrThrow(702);this->m_glBlendFuncSeparateINGR(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+void m_glGetVideoCaptureStreamfvNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params)const{if(!this->m_glGetVideoCaptureStreamfvNV)this->m_resolveOrThrow(703);this->m_glGetVideoCaptureStreamfvNV(video_capture_slot,stream,pname,params);}
+void m_glVertexAttrib2fARB_lazy(GLuint index,GLfloat x,GLfloat y)const{if(!this->m_glVertexAttrib2fARB)this->m_resolveOrThrow(704);this->m_glVertexAttrib2fARB(index,x,y);}
+void m_glGetTexGeniv_lazy(GLenum coord,GLenum pname,GLint* params)const{if(!this->m_glGetTexGeniv)this->m_resolveOrThrow(705);this->m_glGetTexGeniv(coord,pname,params);}
+void m_glPixelStorei_lazy(GLenum pname,GLint param)const{if(!this->m_glPixelStorei)this->m_resolveOrThrow(706);this->m_glPixelStorei(pname,param);}
+void m_glGetCompressedTextureSubImage_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels)const{if(!this->m_glGetCompressedTextureSubImage)this->m_resolveOrThrow(707);this->m_glGetCompressedTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);}
+void m_glCopyImageSubDataNV_lazy(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glCopyImageSubDataNV)this->m_resolveOrThrow(708);this->m_glCopyImageSubDataNV(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+void m_glActiveShaderProgram_lazy(GLuint pipeline,GLuint program)const{if(!this->m_glActiveShaderProgram)this->m_resolveOrThrow(709);this->m_glActiveShaderProgram(pipeline,program);}
+void m_glVertexStream1iATI_lazy(GLenum stream,GLint x)const{if(!this->m_glVertexStream1iATI)this->m_resolveOrThrow(710);this->m_glVertexStream1iATI(stream,x);}
+void m_glPatchParameterfv_lazy(GLenum pname,const GLfloat* values)const{if(!this->m_glPatchParameterfv)this->m_resolveOrThrow(711);this->m_glPatchParameterfv(pname,values);}
+GLboolean m_glIsFramebufferEXT_lazy(GLuint framebuffer)const{if(!this->m_glIsFramebufferEXT)this->m_resolveOrThrow(712);return this->m_glIsFramebufferEXT(framebuffer);}
+void m_glTextureStorage2D_lazy(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glTextureStorage2D)this->m_resolveOrThrow(713);this->m_glTextureStorage2D(texture,levels,internalformat,width,height);}
+void m_glProgramUniform1ui64ARB_lazy(GLuint program,GLint location,GLuint64 x)const{if(!this->m_glProgramUniform1ui64ARB)this->m_resolveOrThrow(714);this->m_glProgramUniform1ui64ARB(program,location,x);}
+void m_glTexBufferRange_lazy(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glTexBufferRange)this->m_resolveOrThrow(715);this->m_glTexBufferRange(target,internalformat,buffer,offset,size);}
+void m_glGetPixelTexGenParameterivSGIS_lazy(GLenum pname,GLint* params)const{if(!this->m_glGetPixelTexGenParameterivSGIS)this->m_resolveOrThrow(716);this->m_glGetPixelTexGenParameterivSGIS(pname,params);}
+void m_glTextureSubImage3DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage3DEXT)this->m_resolveOrThrow(717);this->m_glTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+void m_glClipControl_lazy(GLenum origin,GLenum depth)const{if(!this->m_glClipControl)this->m_resolveOrThrow(718);this->m_glClipControl(origin,depth);}
+void m_glGetProgramResourceiv_lazy(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params)const{if(!this->m_glGetProgramResourceiv)this->m_resolveOrThrow(719);this->m_glGetProgramResourceiv(program,programInterface,index,propCount,props,bufSize,length,params);}
+void m_glMultiTexCoordP2uiv_lazy(GLenum texture,GLenum type,const GLuint* coords)const{if(!this->m_glMultiTexCoordP2uiv)this->m_resolveOrThrow(720);this->m_glMultiTexCoordP2uiv(texture,type,coords);}
+void m_glVertexAttribI3ui_lazy(GLuint index,GLuint x,GLuint y,GLuint z)const{if(!this->m_glVertexAttribI3ui)this->m_resolveOrThrow(721);this->m_glVertexAttribI3ui(index,x,y,z);}
+void m_glSampleMaskSGIS_lazy(GLclampf value,GLboolean invert)const{if(!this->m_glSampleMaskSGIS)this->m_resolveOrThrow(722);this->m_glSampleMaskSGIS(value,invert);}
+void m_glVertexAttrib4NivARB_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttrib4NivARB)this->m_resolveOrThrow(723);this->m_glVertexAttrib4NivARB(index,v);}
+void m_glGlobalAlphaFactorfSUN_lazy(GLfloat factor)const{if(!this->m_glGlobalAlphaFactorfSUN)this->m_resolveOrThrow(724);this->m_glGlobalAlphaFactorfSUN(factor);}
+void m_glBlendEquationSeparateIndexedAMD_lazy(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{if(!this->m_glBlendEquationSeparateIndexedAMD)this->m_resolveOrThrow(725);this->m_glBlendEquationSeparateIndexedAMD(buf,modeRGB,modeAlpha);}
+void m_glGetPerfCounterInfoINTEL_lazy(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue)const{if(!this->m_glGetPerfCounterInfoINTEL)this->m_resolveOrThrow(726);this->m_glGetPerfCounterInfoINTEL(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);}
+void m_glDeleteProgramsNV_lazy(GLsizei n,const GLuint* programs)const{if(!this->m_glDeleteProgramsNV)this->m_resolveOrThrow(727);this->m_glDeleteProgramsNV(n,programs);}
+void m_glPixelZoomxOES_lazy(GLfixed xfactor,GLfixed yfactor)const{if(!this->m_glPixelZoomxOES)this->m_resolveOrThrow(728);this->m_glPixelZoomxOES(xfactor,yfactor);}
+void m_glGetCombinerOutputParameterivNV_lazy(GLenum stage,GLenum portion,GLenum pname,GLint* params)const{if(!this->m_glGetCombinerOutputParameterivNV)this->m_resolveOrThrow(729);this->m_glGetCombinerOutputParameterivNV(stage,portion,pname,params);}
+void m_glRasterPos2xvOES_lazy(const GLfixed* coords)const{if(!this->m_glRasterPos2xvOES)this->m_resolveOrThrow(730);this->m_glRasterPos2xvOES(coords);}
+void m_glGetTexImage_lazy(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels)const{if(!this->m_glGetTexImage)this->m_resolveOrThrow(731);this->m_glGetTexImage(target,level,format,type,pixels);}
+void m_glVertexArrayVertexBuffers_lazy(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{if(!this->m_glVertexArrayVertexBuffers)this->m_resolveOrThrow(732);this->m_glVertexArrayVertexBuffers(vaobj,first,count,buffers,offsets,strides);}
+void m_glUniform1ui64NV_lazy(GLint location,GLuint64EXT x)const{if(!this->m_glUniform1ui64NV)this->m_resolveOrThrow(733);this->m_glUniform1ui64NV(location,x);}
+void m_glProgramParameteri_lazy(GLuint program,GLenum pname,GLint value)const{if(!this->m_glProgramParameteri)this->m_resolveOrThrow(734);this->m_glProgramParameteri(program,pname,value);}
+void m_glNormal3xOES_lazy(GLfixed nx,GLfixed ny,GLfixed nz)const{if(!this->m_glNormal3xOES)this->m_resolveOrThrow(735);this->m_glNormal3xOES(nx,ny,nz);}
+void m_glGetMapfv_lazy(GLenum target,GLenum query,GLfloat* v)const{if(!this->m_glGetMapfv)this->m_resolveOrThrow(736);this->m_glGetMapfv(target,query,v);}
+void m_glVertexStream2dvATI_lazy(GLenum stream,const GLdouble* coords)const{if(!this->m_glVertexStream2dvATI)this->m_resolveOrThrow(737);this->m_glVertexStream2dvATI(stream,coords);}
+void m_glPathStencilDepthOffsetNV_lazy(GLfloat factor,GLfloat units)const{if(!this->m_glPathStencilDepthOffsetNV)this->m_resolveOrThrow(738);this->m_glPathStencilDepthOffsetNV(factor,units);}
+GLboolean m_glIsStateNV_lazy(GLuint state)const{if(!this->m_glIsStateNV)this->m_resolveOrThrow(739);return this->m_glIsStateNV(state);}
+void m_glGetIntegerui64vNV_lazy(GLenum value,GLuint64EXT* result)const{if(!this->m_glGetIntegerui64vNV)this->m_resolveOrThrow(740);this->m_glGetIntegerui64vNV(value,result);}
+void m_glGetImageTransformParameterfvHP_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetImageTransformParameterfvHP)this->m_resolveOrThrow(741);this->m_glGetImageTransformParameterfvHP(target,pname,params);}
+void m_glRasterPos2fv_lazy(const GLfloat* v)const{if(!this->m_glRasterPos2fv)this->m_resolveOrThrow(742);this->m_glRasterPos2fv(v);}
+void m_glVertex3xOES_lazy(GLfixed x,GLfixed y)const{if(!this->m_glVertex3xOES)this->m_resolveOrThrow(743);this->m_glVertex3xOES(x,y);}
+GLboolean m_glIsMemoryObjectEXT_lazy(GLuint memoryObject)const{if(!this->m_glIsMemoryObjectEXT)this->m_resolveOrThrow(744);return this->m_glIsMemoryObjectEXT(memoryObject);}
+void m_glWeightPointerARB_lazy(GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glWeightPointerARB)this->m_resolveOrThrow(745);this->m_glWeightPointerARB(size,type,stride,pointer);}
+void m_glFinishFenceNV_lazy(GLuint fence)const{if(!this->m_glFinishFenceNV)this->m_resolveOrThrow(746);this->m_glFinishFenceNV(fence);}
+void m_glDepthRangexOES_lazy(GLfixed n,GLfixed f)const{if(!this->m_glDepthRangexOES)this->m_resolveOrThrow(747);this->m_glDepthRangexOES(n,f);}
+void m_glEnableVertexArrayAttribEXT_lazy(GLuint vaobj,GLuint index)const{if(!this->m_glEnableVertexArrayAttribEXT)this->m_resolveOrThrow(748);this->m_glEnableVertexArrayAttribEXT(vaobj,index);}
+void m_glProgramUniform2uivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform2uivEXT)this->m_resolveOrThrow(749);this->m_glProgramUniform2uivEXT(program,location,count,value);}
+void m_glGetDoubleIndexedvEXT_lazy(GLenum target,GLuint index,GLdouble* data)const{if(!this->m_glGetDoubleIndexedvEXT)this->m_resolveOrThrow(750);this->m_glGetDoubleIndexedvEXT(target,index,data);}
+void m_glWindowPos2fMESA_lazy(GLfloat x,GLfloat y)const{if(!this->m_glWindowPos2fMESA)this->m_resolveOrThrow(751);this->m_glWindowPos2fMESA(x,y);}
+void m_glSecondaryColor3b_lazy(GLbyte red,GLbyte green,GLbyte blue)const{if(!this->m_glSecondaryColor3b)this->m_resolveOrThrow(752);this->m_glSecondaryColor3b(red,green,blue);}
+void m_glCopyConvolutionFilter1DEXT_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyConvolutionFilter1DEXT)this->m_resolveOrThrow(753);this->m_glCopyConvolutionFilter1DEXT(target,internalformat,x,y,width);}
+void m_glWindowPos2sv_lazy(const GLshort* v)const{if(!this->m_glWindowPos2sv)this->m_resolveOrThrow(754);this->m_glWindowPos2sv(v);}
+void m_glBindFramebufferEXT_lazy(GLenum target,GLuint framebuffer)const{if(!this->m_glBindFramebufferEXT)this->m_resolveOrThrow(755);this->m_glBindFramebufferEXT(target,framebuffer);}
+GLuint m_glCreateShader_lazy(GLenum type)const{if(!this->m_glCreateShader)this->m_resolveOrThrow(756);return this->m_glCreateShader(type);}
+GLuint m_glGenPathsNV_lazy(GLsizei range)const{if(!this->m_glGenPathsNV)this->m_resolveOrThrow(757);return this->m_glGenPathsNV(range);}
+void m_glGenRenderbuffers_lazy(GLsizei n,GLuint* renderbuffers)const{if(!this->m_glGenRenderbuffers)this->m_resolveOrThrow(758);this->m_glGenRenderbuffers(n,renderbuffers);}
+void m_glCopyTexSubImage2D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTexSubImage2D)this->m_resolveOrThrow(759);this->m_glCopyTexSubImage2D(target,level,xoffset,yoffset,x,y,width,height);}
+void m_glVertexAttrib4ubvARB_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttrib4ubvARB)this->m_resolveOrThrow(760);this->m_glVertexAttrib4ubvARB(index,v);}
+void m_glDrawTextureNV_lazy(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{if(!this->m_glDrawTextureNV)this->m_resolveOrThrow(761);this->m_glDrawTextureNV(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+void m_glVertexAttribs1svNV_lazy(GLuint index,GLsizei count,const GLshort* v)const{if(!this->m_glVertexAttribs1svNV)this->m_resolveOrThrow(762);this->m_glVertexAttribs1svNV(index,count,v);}
+void m_glClearNamedBufferSubDataEXT_lazy(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearNamedBufferSubDataEXT)this->m_resolveOrThrow(763);this->m_glClearNamedBufferSubDataEXT(buffer,internalformat,offset,size,format,type,data);}
+void m_glBlendFuncSeparate_lazy(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{if(!this->m_glBlendFuncSeparate)this->m_resolveOrThrow(764);this->m_glBlendFuncSeparate(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+void m_glPointParameterfARB_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPointParameterfARB)this->m_resolveOrThrow(765);this->m_glPointParameterfARB(pname,param);}
+void m_glTexCoord2fv_lazy(const GLfloat* v)const{if(!this->m_glTexCoord2fv)this->m_resolveOrThrow(766);this->m_glTexCoord2fv(v);}
+void m_glGetVariantFloatvEXT_lazy(GLuint id,GLenum value,GLfloat* data)const{if(!this->m_glGetVariantFloatvEXT)this->m_resolveOrThrow(767);this->m_glGetVariantFloatvEXT(id,value,data);}
+void m_glVertexP2ui_lazy(GLenum type,GLuint value)const{if(!this->m_glVertexP2ui)this->m_resolveOrThrow(768);this->m_glVertexP2ui(type,value);}
+void m_glWindowPos2dMESA_lazy(GLdouble x,GLdouble y)const{if(!this->m_glWindowPos2dMESA)this->m_resolveOrThrow(769);this->m_glWindowPos2dMESA(x,y);}
+void m_glTexCoord4fv_lazy(const GLfloat* v)const{if(!this->m_glTexCoord4fv)this->m_resolveOrThrow(770);this->m_glTexCoord4fv(v);}
+void m_glBindFragDataLocationEXT_lazy(GLuint program,GLuint color,const GLchar* name)const{if(!this->m_glBindFragDataLocationEXT)this->m_resolveOrThrow(771);this->m_glBindFragDataLocationEXT(program,color,name);}
+void m_glCompressedTexSubImage1DARB_lazy(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexSubImage1DARB)this->m_resolveOrThrow(772);this->m_glCompressedTexSubImage1DARB(target,level,xoffset,width,format,imageSize,data);}
+void m_glGetTextureImageEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{if(!this->m_glGetTextureImageEXT)this->m_resolveOrThrow(773);this->m_glGetTextureImageEXT(texture,target,level,format,type,pixels);}
+void m_glFogCoordd_lazy(GLdouble coord)const{if(!this->m_glFogCoordd)this->m_resolveOrThrow(774);this->m_glFogCoordd(coord);}
+void m_glPointSize_lazy(GLfloat size)const{if(!this->m_glPointSize)this->m_resolveOrThrow(775);this->m_glPointSize(size);}
+void m_glBindTextureUnit_lazy(GLuint unit,GLuint texture)const{if(!this->m_glBindTextureUnit)this->m_resolveOrThrow(776);this->m_glBindTextureUnit(unit,texture);}
+void m_glProgramEnvParameterI4uiNV_lazy(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{if(!this->m_glProgramEnvParameterI4uiNV)this->m_resolveOrThrow(777);this->m_glProgramEnvParameterI4uiNV(target,index,x,y,z,w);}
+void m_glGetProgramPipelineInfoLog_lazy(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{if(!this->m_glGetProgramPipelineInfoLog)this->m_resolveOrThrow(778);this->m_glGetProgramPipelineInfoLog(pipeline,bufSize,length,infoLog);}
+void m_glProgramUniform4i64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glProgramUniform4i64vARB)this->m_resolveOrThrow(779);this->m_glProgramUniform4i64vARB(program,location,count,value);}
+void m_glVertexAttrib4Nuiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttrib4Nuiv)this->m_resolveOrThrow(780);this->m_glVertexAttrib4Nuiv(index,v);}
+void m_glGetUniformfvARB_lazy(GLhandleARB programObj,GLint location,GLfloat* params)const{if(!this->m_glGetUniformfvARB)this->m_resolveOrThrow(781);this->m_glGetUniformfvARB(programObj,location,params);}
+void m_glWaitSync_lazy(GLsync sync,GLbitfield flags,GLuint64 timeout)const{if(!this->m_glWaitSync)this->m_resolveOrThrow(782);this->m_glWaitSync(sync,flags,timeout);}
+void m_glUniform3i_lazy(GLint location,GLint v0,GLint v1,GLint v2)const{if(!this->m_glUniform3i)this->m_resolveOrThrow(783);this->m_glUniform3i(location,v0,v1,v2);}
+void m_glBlendEquationSeparatei_lazy(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{if(!this->m_glBlendEquationSeparatei)this->m_resolveOrThrow(784);this->m_glBlendEquationSeparatei(buf,modeRGB,modeAlpha);}
+void m_glVertexAttrib2hvNV_lazy(GLuint index,const GLhalfNV* v)const{if(!this->m_glVertexAttrib2hvNV)this->m_resolveOrThrow(785);this->m_glVertexAttrib2hvNV(index,v);}
+void m_glTextureParameterivEXT_lazy(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTextureParameterivEXT)this->m_resolveOrThrow(786);this->m_glTextureParameterivEXT(texture,target,pname,params);}
+void m_glUniform3d_lazy(GLint location,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glUniform3d)this->m_resolveOrThrow(787);this->m_glUniform3d(location,x,y,z);}
+void m_glUniform3f_lazy(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{if(!this->m_glUniform3f)this->m_resolveOrThrow(788);this->m_glUniform3f(location,v0,v1,v2);}
+void m_glActiveProgramEXT_lazy(GLuint program)const{if(!this->m_glActiveProgramEXT)this->m_resolveOrThrow(789);this->m_glActiveProgramEXT(program);}
+void m_glProgramUniform3uiv_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform3uiv)this->m_resolveOrThrow(790);this->m_glProgramUniform3uiv(program,location,count,value);}
+void m_glUniform3ui64vARB_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniform3ui64vARB)this->m_resolveOrThrow(791);this->m_glUniform3ui64vARB(location,count,value);}
+void m_glProgramUniform1ui64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glProgramUniform1ui64vARB)this->m_resolveOrThrow(792);this->m_glProgramUniform1ui64vARB(program,location,count,value);}
+void m_glTextureParameterfEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glTextureParameterfEXT)this->m_resolveOrThrow(793);this->m_glTextureParameterfEXT(texture,target,pname,param);}
+void m_glSetFragmentShaderConstantATI_lazy(GLuint dst,const GLfloat* value)const{if(!this->m_glSetFragmentShaderConstantATI)this->m_resolveOrThrow(794);this->m_glSetFragmentShaderConstantATI(dst,value);}
+void m_glColorSubTable_lazy(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data)const{if(!this->m_glColorSubTable)this->m_resolveOrThrow(795);this->m_glColorSubTable(target,start,count,format,type,data);}
+void m_glReplacementCodeuiSUN_lazy(GLuint code)const{if(!this->m_glReplacementCodeuiSUN)this->m_resolveOrThrow(796);this->m_glReplacementCodeuiSUN(code);}
+void m_glStateCaptureNV_lazy(GLuint state,GLenum mode)const{if(!this->m_glStateCaptureNV)this->m_resolveOrThrow(797);this->m_glStateCaptureNV(state,mode);}
+void m_glBindAttribLocation_lazy(GLuint program,GLuint index,const GLchar* name)const{if(!this->m_glBindAttribLocation)this->m_resolveOrThrow(798);this->m_glBindAttribLocation(program,index,name);}
+void m_glWeightusvARB_lazy(GLint size,const GLushort* weights)const{if(!this->m_glWeightusvARB)this->m_resolveOrThrow(799);this->m_glWeightusvARB(size,weights);}
+GLint m_glGetFragDataIndex_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetFragDataIndex)this->m_resolveOrThrow(800);return this->m_glGetFragDataIndex(program,name);}
+void m_glMultiTexCoord2xOES_lazy(GLenum texture,GLfixed s,GLfixed t)const{if(!this->m_glMultiTexCoord2xOES)this->m_resolveOrThrow(801);this->m_glMultiTexCoord2xOES(texture,s,t);}
+void m_glColor3sv_lazy(const GLshort* v)const{if(!this->m_glColor3sv)this->m_resolveOrThrow(802);this->m_glColor3sv(v);}
+void m_glTexCoord2fVertex3fSUN_lazy(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTexCoord2fVertex3fSUN)this->m_resolveOrThrow(803);this->m_glTexCoord2fVertex3fSUN(s,t,x,y,z);}
+void m_glGetMemoryObjectParameterivEXT_lazy(GLuint memoryObject,GLenum pname,GLint* params)const{if(!this->m_glGetMemoryObjectParameterivEXT)this->m_resolveOrThrow(804);this->m_glGetMemoryObjectParameterivEXT(memoryObject,pname,params);}
+void m_glPolygonOffsetEXT_lazy(GLfloat factor,GLfloat bias)const{if(!this->m_glPolygonOffsetEXT)this->m_resolveOrThrow(805);this->m_glPolygonOffsetEXT(factor,bias);}
+void m_glWeightPathsNV_lazy(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights)const{if(!this->m_glWeightPathsNV)this->m_resolveOrThrow(806);this->m_glWeightPathsNV(resultPath,numPaths,paths,weights);}
+void m_glCombinerStageParameterfvNV_lazy(GLenum stage,GLenum pname,const GLfloat* params)const{if(!this->m_glCombinerStageParameterfvNV)this->m_resolveOrThrow(807);this->m_glCombinerStageParameterfvNV(stage,pname,params);}
+void m_glPointParameterfEXT_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPointParameterfEXT)this->m_resolveOrThrow(808);this->m_glPointParameterfEXT(pname,param);}
+void m_glCopyTexImage1DEXT_lazy(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{if(!this->m_glCopyTexImage1DEXT)this->m_resolveOrThrow(809);this->m_glCopyTexImage1DEXT(target,level,internalformat,x,y,width,border);}
+void m_glVertex4sv_lazy(const GLshort* v)const{if(!this->m_glVertex4sv)this->m_resolveOrThrow(810);this->m_glVertex4sv(v);}
+void m_glMatrixMultfEXT_lazy(GLenum mode,const GLfloat* m)const{if(!this->m_glMatrixMultfEXT)this->m_resolveOrThrow(811);this->m_glMatrixMultfEXT(mode,m);}
+void m_glCompressedTextureSubImage3DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureSubImage3DEXT)this->m_resolveOrThrow(812);this->m_glCompressedTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+void m_glGetTexLevelParameterxvOES_lazy(GLenum target,GLint level,GLenum pname,GLfixed* params)const{if(!this->m_glGetTexLevelParameterxvOES)this->m_resolveOrThrow(813);this->m_glGetTexLevelParameterxvOES(target,level,pname,params);}
+void m_glVertexAttribL3dvEXT_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL3dvEXT)this->m_resolveOrThrow(814);this->m_glVertexAttribL3dvEXT(index,v);}
+void m_glMultiTexCoordP4ui_lazy(GLenum texture,GLenum type,GLuint coords)const{if(!this->m_glMultiTexCoordP4ui)this->m_resolveOrThrow(815);this->m_glMultiTexCoordP4ui(texture,type,coords);}
+void m_glGetTextureLevelParameterivEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params)const{if(!this->m_glGetTextureLevelParameterivEXT)this->m_resolveOrThrow(816);this->m_glGetTextureLevelParameterivEXT(texture,target,level,pname,params);}
+void m_glAlphaFragmentOp2ATI_lazy(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{if(!this->m_glAlphaFragmentOp2ATI)this->m_resolveOrThrow(817);this->m_glAlphaFragmentOp2ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+void m_glDeleteFramebuffers_lazy(GLsizei n,const GLuint* framebuffers)const{if(!this->m_glDeleteFramebuffers)this->m_resolveOrThrow(818);this->m_glDeleteFramebuffers(n,framebuffers);}
+void m_glDrawArrays_lazy(GLenum mode,GLint first,GLsizei count)const{if(!this->m_glDrawArrays)this->m_resolveOrThrow(819);this->m_glDrawArrays(mode,first,count);}
+void m_glGetTransformFeedbackiv_lazy(GLuint xfb,GLenum pname,GLint* param)const{if(!this->m_glGetTransformFeedbackiv)this->m_resolveOrThrow(820);this->m_glGetTransformFeedbackiv(xfb,pname,param);}
+void m_glGetnTexImageARB_lazy(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img)const{if(!this->m_glGetnTexImageARB)this->m_resolveOrThrow(821);this->m_glGetnTexImageARB(target,level,format,type,bufSize,img);}
+void m_glClear_lazy(GLbitfield mask)const{if(!this->m_glClear)this->m_resolveOrThrow(822);this->m_glClear(mask);}
+void m_glVertexArrayParameteriAPPLE_lazy(GLenum pname,GLint param)const{if(!this->m_glVertexArrayParameteriAPPLE)this->m_resolveOrThrow(823);this->m_glVertexArrayParameteriAPPLE(pname,param);}
+void m_glMultiTexCoord2dvARB_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord2dvARB)this->m_resolveOrThrow(824);this->m_glMultiTexCoord2dvARB(target,v);}
+void m_glGetVideoCaptureStreamdvNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params)const{if(!this->m_glGetVideoCaptureStreamdvNV)this->m_resolveOrThrow(825);this->m_glGetVideoCaptureStreamdvNV(video_capture_slot,stream,pname,params);}
+void m_glFragmentLightModelivSGIX_lazy(GLenum pname,const GLint* params)const{if(!this->m_glFragmentLightModelivSGIX)this->m_resolveOrThrow(826);this->m_glFragmentLightModelivSGIX(pname,params);}
+void m_glVertexAttribP2ui_lazy(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{if(!this->m_glVertexAttribP2ui)this->m_resolveOrThrow(827);this->m_glVertexAttribP2ui(index,type,normalized,value);}
+void m_glMultiTexCoordPointerEXT_lazy(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glMultiTexCoordPointerEXT)this->m_resolveOrThrow(828);this->m_glMultiTexCoordPointerEXT(texunit,size,type,stride,pointer);}
+void m_glProgramUniform3iEXT_lazy(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{if(!this->m_glProgramUniform3iEXT)this->m_resolveOrThrow(829);this->m_glProgramUniform3iEXT(program,location,v0,v1,v2);}
+void m_glTranslatef_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTranslatef)this->m_resolveOrThrow(830);this->m_glTranslatef(x,y,z);}
+void m_glVertexAttrib4Nub_lazy(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{if(!this->m_glVertexAttrib4Nub)this->m_resolveOrThrow(831);this->m_glVertexAttrib4Nub(index,x,y,z,w);}
+void m_glTranslated_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glTranslated)this->m_resolveOrThrow(832);this->m_glTranslated(x,y,z);}
+void m_glSamplerParameterIiv_lazy(GLuint sampler,GLenum pname,const GLint* param)const{if(!this->m_glSamplerParameterIiv)this->m_resolveOrThrow(833);this->m_glSamplerParameterIiv(sampler,pname,param);}
+void m_glTexCoord4hNV_lazy(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{if(!this->m_glTexCoord4hNV)this->m_resolveOrThrow(834);this->m_glTexCoord4hNV(s,t,r,q);}
+void m_glDrawElementsIndirect_lazy(GLenum mode,GLenum type,const void* indirect)const{if(!this->m_glDrawElementsIndirect)this->m_resolveOrThrow(835);this->m_glDrawElementsIndirect(mode,type,indirect);}
+void m_glDeletePerfMonitorsAMD_lazy(GLsizei n,GLuint* monitors)const{if(!this->m_glDeletePerfMonitorsAMD)this->m_resolveOrThrow(836);this->m_glDeletePerfMonitorsAMD(n,monitors);}
+GLboolean m_glIsRenderbufferEXT_lazy(GLuint renderbuffer)const{if(!this->m_glIsRenderbufferEXT)this->m_resolveOrThrow(837);return this->m_glIsRenderbufferEXT(renderbuffer);}
+void m_glDrawCommandsNV_lazy(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count)const{if(!this->m_glDrawCommandsNV)this->m_resolveOrThrow(838);this->m_glDrawCommandsNV(primitiveMode,buffer,indirects,sizes,count);}
+void m_glUniform3ivARB_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform3ivARB)this->m_resolveOrThrow(839);this->m_glUniform3ivARB(location,count,value);}
+void m_glBufferSubData_lazy(GLenum target,GLintptr offset,GLsizeiptr size,const void* data)const{if(!this->m_glBufferSubData)this->m_resolveOrThrow(840);this->m_glBufferSubData(target,offset,size,data);}
+void m_glSecondaryColor3bv_lazy(const GLbyte* v)const{if(!this->m_glSecondaryColor3bv)this->m_resolveOrThrow(841);this->m_glSecondaryColor3bv(v);}
+void m_glMatrixMultTransposedEXT_lazy(GLenum mode,const GLdouble* m)const{if(!this->m_glMatrixMultTransposedEXT)this->m_resolveOrThrow(842);this->m_glMatrixMultTransposedEXT(mode,m);}
+void m_glRequestResidentProgramsNV_lazy(GLsizei n,const GLuint* programs)const{if(!this->m_glRequestResidentProgramsNV)this->m_resolveOrThrow(843);this->m_glRequestResidentProgramsNV(n,programs);}
+void m_glAlphaFragmentOp1ATI_lazy(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{if(!this->m_glAlphaFragmentOp1ATI)this->m_resolveOrThrow(844);this->m_glAlphaFragmentOp1ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod);}
+void m_glGetQueryObjecti64v_lazy(GLuint id,GLenum pname,GLint64* params)const{if(!this->m_glGetQueryObjecti64v)this->m_resolveOrThrow(845);this->m_glGetQueryObjecti64v(id,pname,params);}
+void m_glMatrixMult3x3fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixMult3x3fNV)this->m_resolveOrThrow(846);this->m_glMatrixMult3x3fNV(matrixMode,m);}
+void m_glColorTableParameteriv_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glColorTableParameteriv)this->m_resolveOrThrow(847);this->m_glColorTableParameteriv(target,pname,params);}
+void m_glPathSubCommandsNV_lazy(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{if(!this->m_glPathSubCommandsNV)this->m_resolveOrThrow(848);this->m_glPathSubCommandsNV(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);}
+void m_glGetFinalCombinerInputParameterivNV_lazy(GLenum variable,GLenum pname,GLint* params)const{if(!this->m_glGetFinalCombinerInputParameterivNV)this->m_resolveOrThrow(849);this->m_glGetFinalCombinerInputParameterivNV(variable,pname,params);}
+GLboolean m_glIsRenderbuffer_lazy(GLuint renderbuffer)const{if(!this->m_glIsRenderbuffer)this->m_resolveOrThrow(850);return this->m_glIsRenderbuffer(renderbuffer);}
+void m_glVertex3iv_lazy(const GLint* v)const{if(!this->m_glVertex3iv)this->m_resolveOrThrow(851);this->m_glVertex3iv(v);}
+void m_glTexGenfv_lazy(GLenum coord,GLenum pname,const GLfloat* params)const{if(!this->m_glTexGenfv)this->m_resolveOrThrow(852);this->m_glTexGenfv(coord,pname,params);}
+void m_glFrustumfOES_lazy(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{if(!this->m_glFrustumfOES)this->m_resolveOrThrow(853);this->m_glFrustumfOES(l,r,b,t,n,f);}
+void m_glBindVertexBuffers_lazy(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{if(!this->m_glBindVertexBuffers)this->m_resolveOrThrow(854);this->m_glBindVertexBuffers(first,count,buffers,offsets,strides);}
+void m_glMateriali_lazy(GLenum face,GLenum pname,GLint param)const{if(!this->m_glMateriali)this->m_resolveOrThrow(855);this->m_glMateriali(face,pname,param);}
+void m_glMultiTexCoord2svARB_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord2svARB)this->m_resolveOrThrow(856);this->m_glMultiTexCoord2svARB(target,v);}
+void m_glDisableVertexAttribArray_lazy(GLuint index)const{if(!this->m_glDisableVertexAttribArray)this->m_resolveOrThrow(857);this->m_glDisableVertexAttribArray(index);}
+void m_glWindowPos3ivARB_lazy(const GLint* v)const{if(!this->m_glWindowPos3ivARB)this->m_resolveOrThrow(858);this->m_glWindowPos3ivARB(v);}
+void m_glTexCoordFormatNV_lazy(GLint size,GLenum type,GLsizei stride)const{if(!this->m_glTexCoordFormatNV)this->m_resolveOrThrow(859);this->m_glTexCoordFormatNV(size,type,stride);}
+void m_glBlitNamedFramebuffer_lazy(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{if(!this->m_glBlitNamedFramebuffer)this->m_resolveOrThrow(860);this->m_glBlitNamedFramebuffer(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+void m_glMatrixLoadTransposefEXT_lazy(GLenum mode,const GLfloat* m)const{if(!this->m_glMatrixLoadTransposefEXT)this->m_resolveOrThrow(861);this->m_glMatrixLoadTransposefEXT(mode,m);}
+void m_glMultiTexGenfEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLfloat param)const{if(!this->m_glMultiTexGenfEXT)this->m_resolveOrThrow(862);this->m_glMultiTexGenfEXT(texunit,coord,pname,param);}
+void m_glShaderStorageBlockBinding_lazy(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding)const{if(!this->m_glShaderStorageBlockBinding)this->m_resolveOrThrow(863);this->m_glShaderStorageBlockBinding(program,storageBlockIndex,storageBlockBinding);}
+void m_glMaterialf_lazy(GLenum face,GLenum pname,GLfloat param)const{if(!this->m_glMaterialf)this->m_resolveOrThrow(864);this->m_glMaterialf(face,pname,param);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_lazy(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiColor4fNormal3fVertex3fSUN)this->m_resolveOrThrow(865);this->m_glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc,r,g,b,a,nx,ny,nz,x,y,z);}
+GLenum m_glCheckNamedFramebufferStatusEXT_lazy(GLuint framebuffer,GLenum target)const{if(!this->m_glCheckNamedFramebufferStatusEXT)this->m_resolveOrThrow(866);return this->m_glCheckNamedFramebufferStatusEXT(framebuffer,target);}
+void m_glVertexArrayVertexAttribFormatEXT_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{if(!this->m_glVertexArrayVertexAttribFormatEXT)this->m_resolveOrThrow(867);this->m_glVertexArrayVertexAttribFormatEXT(vaobj,attribindex,size,type,normalized,relativeoffset);}
+void m_glVertex2hNV_lazy(GLhalfNV x,GLhalfNV y)const{if(!this->m_glVertex2hNV)this->m_resolveOrThrow(868);this->m_glVertex2hNV(x,y);}
+void m_glDeleteVertexShaderEXT_lazy(GLuint id)const{if(!this->m_glDeleteVertexShaderEXT)this->m_resolveOrThrow(869);this->m_glDeleteVertexShaderEXT(id);}
+void m_glTexImage3DEXT_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexImage3DEXT)this->m_resolveOrThrow(870);this->m_glTexImage3DEXT(target,level,internalformat,width,height,depth,border,format,type,pixels);}
+void m_glSignalVkFenceNV_lazy(GLuint64 vkFence)const{if(!this->m_glSignalVkFenceNV)this->m_resolveOrThrow(871);this->m_glSignalVkFenceNV(vkFence);}
+void m_glProgramLocalParameterI4ivNV_lazy(GLenum target,GLuint index,const GLint* params)const{if(!this->m_glProgramLocalParameterI4ivNV)this->m_resolveOrThrow(872);this->m_glProgramLocalParameterI4ivNV(target,index,params);}
+void m_glGlobalAlphaFactoriSUN_lazy(GLint factor)const{if(!this->m_glGlobalAlphaFactoriSUN)this->m_resolveOrThrow(873);this->m_glGlobalAlphaFactoriSUN(factor);}
+void m_glTextureStorage1D_lazy(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width)const{if(!this->m_glTextureStorage1D)this->m_resolveOrThrow(874);this->m_glTextureStorage1D(texture,levels,internalformat,width);}
+void m_glBinormal3sEXT_lazy(GLshort bx,GLshort by,GLshort bz)const{if(!this->m_glBinormal3sEXT)this->m_resolveOrThrow(875);this->m_glBinormal3sEXT(bx,by,bz);}
+void m_glGetProgramInterfaceiv_lazy(GLuint program,GLenum programInterface,GLenum pname,GLint* params)const{if(!this->m_glGetProgramInterfaceiv)this->m_resolveOrThrow(876);this->m_glGetProgramInterfaceiv(program,programInterface,pname,params);}
+void m_glMatrixIndexPointerARB_lazy(GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glMatrixIndexPointerARB)this->m_resolveOrThrow(877);this->m_glMatrixIndexPointerARB(size,type,stride,pointer);}
+void m_glTexCoordPointerEXT_lazy(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{if(!this->m_glTexCoordPointerEXT)this->m_resolveOrThrow(878);this->m_glTexCoordPointerEXT(size,type,stride,count,pointer);}
+void m_glMultiTexGeniEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLint param)const{if(!this->m_glMultiTexGeniEXT)this->m_resolveOrThrow(879);this->m_glMultiTexGeniEXT(texunit,coord,pname,param);}
+void m_glVertexAttrib2fNV_lazy(GLuint index,GLfloat x,GLfloat y)const{if(!this->m_glVertexAttrib2fNV)this->m_resolveOrThrow(880);this->m_glVertexAttrib2fNV(index,x,y);}
+void m_glNamedProgramStringEXT_lazy(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string)const{if(!this->m_glNamedProgramStringEXT)this->m_resolveOrThrow(881);this->m_glNamedProgramStringEXT(program,target,format,len,string);}
+void* m_glMapNamedBuffer_lazy(GLuint buffer,GLenum access)const{if(!this->m_glMapNamedBuffer)this->m_resolveOrThrow(882);return this->m_glMapNamedBuffer(buffer,access);}
+void m_glGetMinmaxParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMinmaxParameteriv)this->m_resolveOrThrow(883);this->m_glGetMinmaxParameteriv(target,pname,params);}
+void m_glGetnUniformdv_lazy(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{if(!this->m_glGetnUniformdv)this->m_resolveOrThrow(884);this->m_glGetnUniformdv(program,location,bufSize,params);}
+void m_glEndConditionalRenderNVX_lazy()const{if(!this->m_glEndConditionalRenderNVX)this->m_resolveOrThrow(885);this->m_glEndConditionalRenderNVX();}
+void m_glBinormal3fEXT_lazy(GLfloat bx,GLfloat by,GLfloat bz)const{if(!this->m_glBinormal3fEXT)this->m_resolveOrThrow(886);this->m_glBinormal3fEXT(bx,by,bz);}
+void m_glNormalStream3iATI_lazy(GLenum stream,GLint nx,GLint ny,GLint nz)const{if(!this->m_glNormalStream3iATI)this->m_resolveOrThrow(887);this->m_glNormalStream3iATI(stream,nx,ny,nz);}
+void m_glProgramBufferParametersIivNV_lazy(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params)const{if(!this->m_glProgramBufferParametersIivNV)this->m_resolveOrThrow(888);this->m_glProgramBufferParametersIivNV(target,bindingIndex,wordIndex,count,params);}
+void m_glMapGrid1xOES_lazy(GLint n,GLfixed u1,GLfixed u2)const{if(!this->m_glMapGrid1xOES)this->m_resolveOrThrow(889);this->m_glMapGrid1xOES(n,u1,u2);}
+void m_glGetVertexAttribPointervARB_lazy(GLuint index,GLenum pname,void** pointer)const{if(!this->m_glGetVertexAttribPointervARB)this->m_resolveOrThrow(890);this->m_glGetVertexAttribPointervARB(index,pname,pointer);}
+void m_glFlushMappedNamedBufferRangeEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr length)const{if(!this->m_glFlushMappedNamedBufferRangeEXT)this->m_resolveOrThrow(891);this->m_glFlushMappedNamedBufferRangeEXT(buffer,offset,length);}
+void m_glGetVertexAttribIiv_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribIiv)this->m_resolveOrThrow(892);this->m_glGetVertexAttribIiv(index,pname,params);}
+void m_glVertexP4uiv_lazy(GLenum type,const GLuint* value)const{if(!this->m_glVertexP4uiv)this->m_resolveOrThrow(893);this->m_glVertexP4uiv(type,value);}
+void m_glUniformui64NV_lazy(GLint location,GLuint64EXT value)const{if(!this->m_glUniformui64NV)this->m_resolveOrThrow(894);this->m_glUniformui64NV(location,value);}
+void m_glColor4fv_lazy(const GLfloat* v)const{if(!this->m_glColor4fv)this->m_resolveOrThrow(895);this->m_glColor4fv(v);}
+void m_glTexParameterxvOES_lazy(GLenum target,GLenum pname,const GLfixed* params)const{if(!this->m_glTexParameterxvOES)this->m_resolveOrThrow(896);this->m_glTexParameterxvOES(target,pname,params);}
+void m_glPatchParameteri_lazy(GLenum pname,GLint value)const{if(!this->m_glPatchParameteri)this->m_resolveOrThrow(897);this->m_glPatchParameteri(pname,value);}
+void m_glMap1d_lazy(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{if(!this->m_glMap1d)this->m_resolveOrThrow(898);this->m_glMap1d(target,u1,u2,stride,order,points);}
+void m_glGetTexFilterFuncSGIS_lazy(GLenum target,GLenum filter,GLfloat* weights)const{if(!this->m_glGetTexFilterFuncSGIS)this->m_resolveOrThrow(899);this->m_glGetTexFilterFuncSGIS(target,filter,weights);}
+void m_glVertexStream3dATI_lazy(GLenum stream,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexStream3dATI)this->m_resolveOrThrow(900);this->m_glVertexStream3dATI(stream,x,y,z);}
+void m_glVertexArrayVertexBindingDivisorEXT_lazy(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{if(!this->m_glVertexArrayVertexBindingDivisorEXT)this->m_resolveOrThrow(901);this->m_glVertexArrayVertexBindingDivisorEXT(vaobj,bindingindex,divisor);}
+void m_glMultiTexCoord3svARB_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord3svARB)this->m_resolveOrThrow(902);this->m_glMultiTexCoord3svARB(target,v);}
+void m_glBindProgramNV_lazy(GLenum target,GLuint id)const{if(!this->m_glBindProgramNV)this->m_resolveOrThrow(903);this->m_glBindProgramNV(target,id);}
+void m_glGetConvolutionParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetConvolutionParameteriv)this->m_resolveOrThrow(904);this->m_glGetConvolutionParameteriv(target,pname,params);}
+void m_glGetProgramLocalParameterfvARB_lazy(GLenum target,GLuint index,GLfloat* params)const{if(!this->m_glGetProgramLocalParameterfvARB)this->m_resolveOrThrow(905);this->m_glGetProgramLocalParameterfvARB(target,index,params);}
+GLuint m_glGenFragmentShadersATI_lazy(GLuint range)const{if(!this->m_glGenFragmentShadersATI)this->m_resolveOrThrow(906);return this->m_glGenFragmentShadersATI(range);}
+void m_glTexBumpParameterivATI_lazy(GLenum pname,const GLint* param)const{if(!this->m_glTexBumpParameterivATI)this->m_resolveOrThrow(907);this->m_glTexBumpParameterivATI(pname,param);}
+void m_glGetNamedFramebufferAttachmentParameteriv_lazy(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{if(!this->m_glGetNamedFramebufferAttachmentParameteriv)this->m_resolveOrThrow(908);this->m_glGetNamedFramebufferAttachmentParameteriv(framebuffer,attachment,pname,params);}
+void m_glGetnSeparableFilter_lazy(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{if(!this->m_glGetnSeparableFilter)this->m_resolveOrThrow(909);this->m_glGetnSeparableFilter(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+void m_glNormal3xvOES_lazy(const GLfixed* coords)const{if(!this->m_glNormal3xvOES)this->m_resolveOrThrow(910);this->m_glNormal3xvOES(coords);}
+void m_glPassTexCoordATI_lazy(GLuint dst,GLuint coord,GLenum swizzle)const{if(!this->m_glPassTexCoordATI)this->m_resolveOrThrow(911);this->m_glPassTexCoordATI(dst,coord,swizzle);}
+void m_glFramebufferTextureFaceARB_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{if(!this->m_glFramebufferTextureFaceARB)this->m_resolveOrThrow(912);this->m_glFramebufferTextureFaceARB(target,attachment,texture,level,face);}
+void m_glProgramUniform1dv_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform1dv)this->m_resolveOrThrow(913);this->m_glProgramUniform1dv(program,location,count,value);}
+void m_glTextureStorage2DEXT_lazy(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glTextureStorage2DEXT)this->m_resolveOrThrow(914);this->m_glTextureStorage2DEXT(texture,target,levels,internalformat,width,height);}
+void m_glVertexArrayFogCoordOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayFogCoordOffsetEXT)this->m_resolveOrThrow(915);this->m_glVertexArrayFogCoordOffsetEXT(vaobj,buffer,type,stride,offset);}
+void m_glDeleteNamedStringARB_lazy(GLint namelen,const GLchar* name)const{if(!this->m_glDeleteNamedStringARB)this->m_resolveOrThrow(916);this->m_glDeleteNamedStringARB(namelen,name);}
+void m_glMulticastGetQueryObjecti64vNV_lazy(GLuint gpu,GLuint id,GLenum pname,GLint64* params)const{if(!this->m_glMulticastGetQueryObjecti64vNV)this->m_resolveOrThrow(917);this->m_glMulticastGetQueryObjecti64vNV(gpu,id,pname,params);}
+void m_glGenOcclusionQueriesNV_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glGenOcclusionQueriesNV)this->m_resolveOrThrow(918);this->m_glGenOcclusionQueriesNV(n,ids);}
+void m_glLighti_lazy(GLenum light,GLenum pname,GLint param)const{if(!this->m_glLighti)this->m_resolveOrThrow(919);this->m_glLighti(light,pname,param);}
+void m_glTexImage1D_lazy(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexImage1D)this->m_resolveOrThrow(920);this->m_glTexImage1D(target,level,internalFormat,width,border,format,type,pixels);}
+void m_glLightf_lazy(GLenum light,GLenum pname,GLfloat param)const{if(!this->m_glLightf)this->m_resolveOrThrow(921);this->m_glLightf(light,pname,param);}
+void m_glClientAttribDefaultEXT_lazy(GLbitfield mask)const{if(!this->m_glClientAttribDefaultEXT)this->m_resolveOrThrow(922);this->m_glClientAttribDefaultEXT(mask);}
+void m_glVertexAttrib4bvARB_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttrib4bvARB)this->m_resolveOrThrow(923);this->m_glVertexAttrib4bvARB(index,v);}
+void m_glVertexAttribIFormatNV_lazy(GLuint index,GLint size,GLenum type,GLsizei stride)const{if(!this->m_glVertexAttribIFormatNV)this->m_resolveOrThrow(924);this->m_glVertexAttribIFormatNV(index,size,type,stride);}
+void m_glStencilFuncSeparate_lazy(GLenum face,GLenum func,GLint ref,GLuint mask)const{if(!this->m_glStencilFuncSeparate)this->m_resolveOrThrow(925);this->m_glStencilFuncSeparate(face,func,ref,mask);}
+void m_glGetVertexAttribfvARB_lazy(GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetVertexAttribfvARB)this->m_resolveOrThrow(926);this->m_glGetVertexAttribfvARB(index,pname,params);}
+void m_glVertexAttrib2dNV_lazy(GLuint index,GLdouble x,GLdouble y)const{if(!this->m_glVertexAttrib2dNV)this->m_resolveOrThrow(927);this->m_glVertexAttrib2dNV(index,x,y);}
+void m_glProgramUniform2iEXT_lazy(GLuint program,GLint location,GLint v0,GLint v1)const{if(!this->m_glProgramUniform2iEXT)this->m_resolveOrThrow(928);this->m_glProgramUniform2iEXT(program,location,v0,v1);}
+void m_glClientActiveVertexStreamATI_lazy(GLenum stream)const{if(!this->m_glClientActiveVertexStreamATI)this->m_resolveOrThrow(929);this->m_glClientActiveVertexStreamATI(stream);}
+void m_glRasterPos3xOES_lazy(GLfixed x,GLfixed y,GLfixed z)const{if(!this->m_glRasterPos3xOES)this->m_resolveOrThrow(930);this->m_glRasterPos3xOES(x,y,z);}
+void m_glGetMapParameterivNV_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMapParameterivNV)this->m_resolveOrThrow(931);this->m_glGetMapParameterivNV(target,pname,params);}
+void m_glSampleCoverage_lazy(GLclampf value,GLboolean invert)const{if(!this->m_glSampleCoverage)this->m_resolveOrThrow(932);this->m_glSampleCoverage(value,invert);}
+void m_glClearDepthxOES_lazy(GLfixed depth)const{if(!this->m_glClearDepthxOES)this->m_resolveOrThrow(933);this->m_glClearDepthxOES(depth);}
+void m_glUniformBufferEXT_lazy(GLuint program,GLint location,GLuint buffer)const{if(!this->m_glUniformBufferEXT)this->m_resolveOrThrow(934);this->m_glUniformBufferEXT(program,location,buffer);}
+void m_glTexCoord2fNormal3fVertex3fvSUN_lazy(const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{if(!this->m_glTexCoord2fNormal3fVertex3fvSUN)this->m_resolveOrThrow(935);this->m_glTexCoord2fNormal3fVertex3fvSUN(tc,n,v);}
+void m_glMulticastGetQueryObjectuivNV_lazy(GLuint gpu,GLuint id,GLenum pname,GLuint* params)const{if(!this->m_glMulticastGetQueryObjectuivNV)this->m_resolveOrThrow(936);this->m_glMulticastGetQueryObjectuivNV(gpu,id,pname,params);}
+void m_glGetFirstPerfQueryIdINTEL_lazy(GLuint* queryId)const{if(!this->m_glGetFirstPerfQueryIdINTEL)this->m_resolveOrThrow(937);this->m_glGetFirstPerfQueryIdINTEL(queryId);}
+GLboolean m_glUnmapNamedBufferEXT_lazy(GLuint buffer)const{if(!this->m_glUnmapNamedBufferEXT)this->m_resolveOrThrow(938);return this->m_glUnmapNamedBufferEXT(buffer);}
+void m_glGetTransformFeedbacki_v_lazy(GLuint xfb,GLenum pname,GLuint index,GLint* param)const{if(!this->m_glGetTransformFeedbacki_v)this->m_resolveOrThrow(939);this->m_glGetTransformFeedbacki_v(xfb,pname,index,param);}
+void m_glUniform4fvARB_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform4fvARB)this->m_resolveOrThrow(940);this->m_glUniform4fvARB(location,count,value);}
+void m_glRenderbufferStorageMultisampleCoverageNV_lazy(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glRenderbufferStorageMultisampleCoverageNV)this->m_resolveOrThrow(941);this->m_glRenderbufferStorageMultisampleCoverageNV(target,coverageSamples,colorSamples,internalformat,width,height);}
+void m_glGetFloati_vEXT_lazy(GLenum pname,GLuint index,GLfloat* params)const{if(!this->m_glGetFloati_vEXT)this->m_resolveOrThrow(942);this->m_glGetFloati_vEXT(pname,index,params);}
+void m_glBindAttribLocationARB_lazy(GLhandleARB programObj,GLuint index,const GLcharARB* name)const{if(!this->m_glBindAttribLocationARB)this->m_resolveOrThrow(943);this->m_glBindAttribLocationARB(programObj,index,name);}
+void m_glBufferAddressRangeNV_lazy(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length)const{if(!this->m_glBufferAddressRangeNV)this->m_resolveOrThrow(944);this->m_glBufferAddressRangeNV(pname,index,address,length);}
+void m_glGenProgramsARB_lazy(GLsizei n,GLuint* programs)const{if(!this->m_glGenProgramsARB)this->m_resolveOrThrow(945);this->m_glGenProgramsARB(n,programs);}
+void m_glMultiTexEnvivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glMultiTexEnvivEXT)this->m_resolveOrThrow(946);this->m_glMultiTexEnvivEXT(texunit,target,pname,params);}
+void m_glSecondaryColor3uiEXT_lazy(GLuint red,GLuint green,GLuint blue)const{if(!this->m_glSecondaryColor3uiEXT)this->m_resolveOrThrow(947);this->m_glSecondaryColor3uiEXT(red,green,blue);}
+void m_glCompressedTextureImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureImage2DEXT)this->m_resolveOrThrow(948);this->m_glCompressedTextureImage2DEXT(texture,target,level,internalformat,width,height,border,imageSize,bits);}
+void m_glUniform2i_lazy(GLint location,GLint v0,GLint v1)const{if(!this->m_glUniform2i)this->m_resolveOrThrow(949);this->m_glUniform2i(location,v0,v1);}
+void m_glCopyTexImage2DEXT_lazy(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{if(!this->m_glCopyTexImage2DEXT)this->m_resolveOrThrow(950);this->m_glCopyTexImage2DEXT(target,level,internalformat,x,y,width,height,border);}
+void m_glUniform2d_lazy(GLint location,GLdouble x,GLdouble y)const{if(!this->m_glUniform2d)this->m_resolveOrThrow(951);this->m_glUniform2d(location,x,y);}
+void m_glVertexAttribL1d_lazy(GLuint index,GLdouble x)const{if(!this->m_glVertexAttribL1d)this->m_resolveOrThrow(952);this->m_glVertexAttribL1d(index,x);}
+void m_glFramebufferTextureFaceEXT_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{if(!this->m_glFramebufferTextureFaceEXT)this->m_resolveOrThrow(953);this->m_glFramebufferTextureFaceEXT(target,attachment,texture,level,face);}
+void m_glFramebufferTextureLayer_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{if(!this->m_glFramebufferTextureLayer)this->m_resolveOrThrow(954);this->m_glFramebufferTextureLayer(target,attachment,texture,level,layer);}
+void m_glMultiTexCoord4bvOES_lazy(GLenum texture,const GLbyte* coords)const{if(!this->m_glMultiTexCoord4bvOES)this->m_resolveOrThrow(955);this->m_glMultiTexCoord4bvOES(texture,coords);}
+void m_glGetVertexArrayPointeri_vEXT_lazy(GLuint vaobj,GLuint index,GLenum pname,void** param)const{if(!this->m_glGetVertexArrayPointeri_vEXT)this->m_resolveOrThrow(956);this->m_glGetVertexArrayPointeri_vEXT(vaobj,index,pname,param);}
+void m_glNamedProgramLocalParameter4dEXT_lazy(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glNamedProgramLocalParameter4dEXT)this->m_resolveOrThrow(957);this->m_glNamedProgramLocalParameter4dEXT(program,target,index,x,y,z,w);}
+void m_glBinormal3bEXT_lazy(GLbyte bx,GLbyte by,GLbyte bz)const{if(!this->m_glBinormal3bEXT)this->m_resolveOrThrow(958);this->m_glBinormal3bEXT(bx,by,bz);}
+void m_glConvolutionFilter2DEXT_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image)const{if(!this->m_glConvolutionFilter2DEXT)this->m_resolveOrThrow(959);this->m_glConvolutionFilter2DEXT(target,internalformat,width,height,format,type,image);}
+void m_glProgramUniform2fv_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform2fv)this->m_resolveOrThrow(960);this->m_glProgramUniform2fv(program,location,count,value);}
+void m_glColor3fVertex3fSUN_lazy(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glColor3fVertex3fSUN)this->m_resolveOrThrow(961);this->m_glColor3fVertex3fSUN(r,g,b,x,y,z);}
+void m_glNormal3fVertex3fvSUN_lazy(const GLfloat* n,const GLfloat* v)const{if(!this->m_glNormal3fVertex3fvSUN)this->m_resolveOrThrow(962);this->m_glNormal3fVertex3fvSUN(n,v);}
+void m_glCopyMultiTexSubImage3DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyMultiTexSubImage3DEXT)this->m_resolveOrThrow(963);this->m_glCopyMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+void m_glProgramLocalParameterI4iNV_lazy(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glProgramLocalParameterI4iNV)this->m_resolveOrThrow(964);this->m_glProgramLocalParameterI4iNV(target,index,x,y,z,w);}
+void m_glProgramUniformMatrix2x4dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2x4dv)this->m_resolveOrThrow(965);this->m_glProgramUniformMatrix2x4dv(program,location,count,transpose,value);}
+GLenum m_glPathMemoryGlyphIndexArrayNV_lazy(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{if(!this->m_glPathMemoryGlyphIndexArrayNV)this->m_resolveOrThrow(966);return this->m_glPathMemoryGlyphIndexArrayNV(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+void m_glDrawArraysEXT_lazy(GLenum mode,GLint first,GLsizei count)const{if(!this->m_glDrawArraysEXT)this->m_resolveOrThrow(967);this->m_glDrawArraysEXT(mode,first,count);}
+void m_glBlendEquationEXT_lazy(GLenum mode)const{if(!this->m_glBlendEquationEXT)this->m_resolveOrThrow(968);this->m_glBlendEquationEXT(mode);}
+void m_glStencilOp_lazy(GLenum fail,GLenum zfail,GLenum zpass)const{if(!this->m_glStencilOp)this->m_resolveOrThrow(969);this->m_glStencilOp(fail,zfail,zpass);}
+void m_glCopyTextureSubImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTextureSubImage2DEXT)this->m_resolveOrThrow(970);this->m_glCopyTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,x,y,width,height);}
+void m_glTexEnvf_lazy(GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glTexEnvf)this->m_resolveOrThrow(971);this->m_glTexEnvf(target,pname,param);}
+void m_glVertexAttrib2dvNV_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib2dvNV)this->m_resolveOrThrow(972);this->m_glVertexAttrib2dvNV(index,v);}
+void m_glGenPerfMonitorsAMD_lazy(GLsizei n,GLuint* monitors)const{if(!this->m_glGenPerfMonitorsAMD)this->m_resolveOrThrow(973);this->m_glGenPerfMonitorsAMD(n,monitors);}
+void m_glGetInteger64i_v_lazy(GLenum target,GLuint index,GLint64* data)const{if(!this->m_glGetInteger64i_v)this->m_resolveOrThrow(974);this->m_glGetInteger64i_v(target,index,data);}
+void m_glGetHistogramParameterfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetHistogramParameterfv)this->m_resolveOrThrow(975);this->m_glGetHistogramParameterfv(target,pname,params);}
+void m_glVertexFormatNV_lazy(GLint size,GLenum type,GLsizei stride)const{if(!this->m_glVertexFormatNV)this->m_resolveOrThrow(976);this->m_glVertexFormatNV(size,type,stride);}
+void m_glBlendFuncIndexedAMD_lazy(GLuint buf,GLenum src,GLenum dst)const{if(!this->m_glBlendFuncIndexedAMD)this->m_resolveOrThrow(977);this->m_glBlendFuncIndexedAMD(buf,src,dst);}
+void m_glTexEnvi_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glTexEnvi)this->m_resolveOrThrow(978);this->m_glTexEnvi(target,pname,param);}
+void m_glMultiTexCoord1iv_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord1iv)this->m_resolveOrThrow(979);this->m_glMultiTexCoord1iv(target,v);}
+GLboolean m_glIsEnabledi_lazy(GLenum target,GLuint index)const{if(!this->m_glIsEnabledi)this->m_resolveOrThrow(980);return this->m_glIsEnabledi(target,index);}
+void m_glVertexAttribL2ui64vNV_lazy(GLuint index,const GLuint64EXT* v)const{if(!this->m_glVertexAttribL2ui64vNV)this->m_resolveOrThrow(981);this->m_glVertexAttribL2ui64vNV(index,v);}
+void m_glVertexAttribL4i64NV_lazy(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{if(!this->m_glVertexAttribL4i64NV)this->m_resolveOrThrow(982);this->m_glVertexAttribL4i64NV(index,x,y,z,w);}
+void m_glMatrixTranslatedEXT_lazy(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glMatrixTranslatedEXT)this->m_resolveOrThrow(983);this->m_glMatrixTranslatedEXT(mode,x,y,z);}
+void m_glMakeTextureHandleResidentARB_lazy(GLuint64 handle)const{if(!this->m_glMakeTextureHandleResidentARB)this->m_resolveOrThrow(984);this->m_glMakeTextureHandleResidentARB(handle);}
+void m_glMatrixMultdEXT_lazy(GLenum mode,const GLdouble* m)const{if(!this->m_glMatrixMultdEXT)this->m_resolveOrThrow(985);this->m_glMatrixMultdEXT(mode,m);}
+void m_glBinormal3dvEXT_lazy(const GLdouble* v)const{if(!this->m_glBinormal3dvEXT)this->m_resolveOrThrow(986);this->m_glBinormal3dvEXT(v);}
+GLsync m_glImportSyncEXT_lazy(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags)const{if(!this->m_glImportSyncEXT)this->m_resolveOrThrow(987);return this->m_glImportSyncEXT(external_sync_type,external_sync,flags);}
+void m_glGetMapiv_lazy(GLenum target,GLenum query,GLint* v)const{if(!this->m_glGetMapiv)this->m_resolveOrThrow(988);this->m_glGetMapiv(target,query,v);}
+void m_glImportSemaphoreFdEXT_lazy(GLuint semaphore,GLenum handleType,GLint fd)const{if(!this->m_glImportSemaphoreFdEXT)this->m_resolveOrThrow(989);this->m_glImportSemaphoreFdEXT(semaphore,handleType,fd);}
+void m_glMultiTexCoord4sv_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord4sv)this->m_resolveOrThrow(990);this->m_glMultiTexCoord4sv(target,v);}
+void m_glPNTrianglesiATI_lazy(GLenum pname,GLint param)const{if(!this->m_glPNTrianglesiATI)this->m_resolveOrThrow(991);this->m_glPNTrianglesiATI(pname,param);}
+void m_glBindVertexArrayAPPLE_lazy(GLuint array)const{if(!this->m_glBindVertexArrayAPPLE)this->m_resolveOrThrow(992);this->m_glBindVertexArrayAPPLE(array);}
+void m_glObjectPtrLabel_lazy(const void* ptr,GLsizei length,const GLchar* label)const{if(!this->m_glObjectPtrLabel)this->m_resolveOrThrow(993);this->m_glObjectPtrLabel(ptr,length,label);}
+GLuint m_glGetDebugMessageLog_lazy(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{if(!this->m_glGetDebugMessageLog)this->m_resolveOrThrow(994);return this->m_glGetDebugMessageLog(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+void m_glTrackMatrixNV_lazy(GLenum target,GLuint address,GLenum matrix,GLenum transform)const{if(!this->m_glTrackMatrixNV)this->m_resolveOrThrow(995);this->m_glTrackMatrixNV(target,address,matrix,transform);}
+void m_glProgramPathFragmentInputGenNV_lazy(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs)const{if(!this->m_glProgramPathFragmentInputGenNV)this->m_resolveOrThrow(996);this->m_glProgramPathFragmentInputGenNV(program,location,genMode,components,coeffs);}
+void m_glTangent3ivEXT_lazy(const GLint* v)const{if(!this->m_glTangent3ivEXT)this->m_resolveOrThrow(997);this->m_glTangent3ivEXT(v);}
+void m_glGetUniformfv_lazy(GLuint program,GLint location,GLfloat* params)const{if(!this->m_glGetUniformfv)this->m_resolveOrThrow(998);this->m_glGetUniformfv(program,location,params);}
+void m_glSecondaryColor3ubv_lazy(const GLubyte* v)const{if(!this->m_glSecondaryColor3ubv)this->m_resolveOrThrow(999);this->m_glSecondaryColor3ubv(v);}
+void m_glMakeTextureHandleNonResidentNV_lazy(GLuint64 handle)const{if(!this->m_glMakeTextureHandleNonResidentNV)this->m_resolveOrThrow(1000);this->m_glMakeTextureHandleNonResidentNV(handle);}
+void m_glVertexAttribs4ubvNV_lazy(GLuint index,GLsizei count,const GLubyte* v)const{if(!this->m_glVertexAttribs4ubvNV)this->m_resolveOrThrow(1001);this->m_glVertexAttribs4ubvNV(index,count,v);}
+void m_glClipPlanexOES_lazy(GLenum plane,const GLfixed* equation)const{if(!this->m_glClipPlanexOES)this->m_resolveOrThrow(1002);this->m_glClipPlanexOES(plane,equation);}
+void m_glMultiTexCoord3iv_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord3iv)this->m_resolveOrThrow(1003);this->m_glMultiTexCoord3iv(target,v);}
+void m_glGetnPolygonStippleARB_lazy(GLsizei bufSize,GLubyte* pattern)const{if(!this->m_glGetnPolygonStippleARB)this->m_resolveOrThrow(1004);this->m_glGetnPolygonStippleARB(bufSize,pattern);}
+void m_glUniform2i64vNV_lazy(GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glUniform2i64vNV)this->m_resolveOrThrow(1005);this->m_glUniform2i64vNV(location,count,value);}
+void m_glLightModelf_lazy(GLenum pname,GLfloat param)const{if(!this->m_glLightModelf)this->m_resolveOrThrow(1006);this->m_glLightModelf(pname,param);}
+void m_glDeleteMemoryObjectsEXT_lazy(GLsizei n,const GLuint* memoryObjects)const{if(!this->m_glDeleteMemoryObjectsEXT)this->m_resolveOrThrow(1007);this->m_glDeleteMemoryObjectsEXT(n,memoryObjects);}
+void m_glMultiTexSubImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexSubImage2DEXT)this->m_resolveOrThrow(1008);this->m_glMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+void m_glReplacementCodeuiColor3fVertex3fSUN_lazy(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiColor3fVertex3fSUN)this->m_resolveOrThrow(1009);this->m_glReplacementCodeuiColor3fVertex3fSUN(rc,r,g,b,x,y,z);}
+void m_glTangent3dvEXT_lazy(const GLdouble* v)const{if(!this->m_glTangent3dvEXT)this->m_resolveOrThrow(1010);this->m_glTangent3dvEXT(v);}
+void m_glLightModeli_lazy(GLenum pname,GLint param)const{if(!this->m_glLightModeli)this->m_resolveOrThrow(1011);this->m_glLightModeli(pname,param);}
+void m_glVertexWeighthvNV_lazy(const GLhalfNV* weight)const{if(!this->m_glVertexWeighthvNV)this->m_resolveOrThrow(1012);this->m_glVertexWeighthvNV(weight);}
+void m_glWindowPos3iv_lazy(const GLint* v)const{if(!this->m_glWindowPos3iv)this->m_resolveOrThrow(1013);this->m_glWindowPos3iv(v);}
+void m_glMultiTexCoordP1uiv_lazy(GLenum texture,GLenum type,const GLuint* coords)const{if(!this->m_glMultiTexCoordP1uiv)this->m_resolveOrThrow(1014);this->m_glMultiTexCoordP1uiv(texture,type,coords);}
+void m_glTransformPathNV_lazy(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glTransformPathNV)this->m_resolveOrThrow(1015);this->m_glTransformPathNV(resultPath,srcPath,transformType,transformValues);}
+void m_glProgramNamedParameter4dNV_lazy(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glProgramNamedParameter4dNV)this->m_resolveOrThrow(1016);this->m_glProgramNamedParameter4dNV(id,len,name,x,y,z,w);}
+void m_glMultiDrawElementsIndirect_lazy(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride)const{if(!this->m_glMultiDrawElementsIndirect)this->m_resolveOrThrow(1017);this->m_glMultiDrawElementsIndirect(mode,type,indirect,drawcount,stride);}
+void m_glProgramUniform1dEXT_lazy(GLuint program,GLint location,GLdouble x)const{if(!this->m_glProgramUniform1dEXT)this->m_resolveOrThrow(1018);this->m_glProgramUniform1dEXT(program,location,x);}
+void m_glCallLists_lazy(GLsizei n,GLenum type,const GLvoid* lists)const{if(!this->m_glCallLists)this->m_resolveOrThrow(1019);this->m_glCallLists(n,type,lists);}
+void m_glNormal3hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glNormal3hvNV)this->m_resolveOrThrow(1020);this->m_glNormal3hvNV(v);}
+void m_glGetCombinerOutputParameterfvNV_lazy(GLenum stage,GLenum portion,GLenum pname,GLfloat* params)const{if(!this->m_glGetCombinerOutputParameterfvNV)this->m_resolveOrThrow(1021);this->m_glGetCombinerOutputParameterfvNV(stage,portion,pname,params);}
+void m_glVertexAttrib4sARB_lazy(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glVertexAttrib4sARB)this->m_resolveOrThrow(1022);this->m_glVertexAttrib4sARB(index,x,y,z,w);}
+void m_glTexCoord3i_lazy(GLint s,GLint t,GLint r)const{if(!this->m_glTexCoord3i)this->m_resolveOrThrow(1023);this->m_glTexCoord3i(s,t,r);}
+void m_glVertexAttribI3uiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI3uiv)this->m_resolveOrThrow(1024);this->m_glVertexAttribI3uiv(index,v);}
+void m_glPushDebugGroup_lazy(GLenum source,GLuint id,GLsizei length,const GLchar* message)const{if(!this->m_glPushDebugGroup)this->m_resolveOrThrow(1025);this->m_glPushDebugGroup(source,id,length,message);}
+void m_glTexCoord3f_lazy(GLfloat s,GLfloat t,GLfloat r)const{if(!this->m_glTexCoord3f)this->m_resolveOrThrow(1026);this->m_glTexCoord3f(s,t,r);}
+void m_glTexCoord3d_lazy(GLdouble s,GLdouble t,GLdouble r)const{if(!this->m_glTexCoord3d)this->m_resolveOrThrow(1027);this->m_glTexCoord3d(s,t,r);}
+void m_glTexCoord2xOES_lazy(GLfixed s,GLfixed t)const{if(!this->m_glTexCoord2xOES)this->m_resolveOrThrow(1028);this->m_glTexCoord2xOES(s,t);}
+GLushort m_glGetStageIndexNV_lazy(GLenum shadertype)const{if(!this->m_glGetStageIndexNV)this->m_resolveOrThrow(1029);return this->m_glGetStageIndexNV(shadertype);}
+void m_glProgramUniform4i64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glProgramUniform4i64vNV)this->m_resolveOrThrow(1030);this->m_glProgramUniform4i64vNV(program,location,count,value);}
+void m_glGetNamedBufferPointervEXT_lazy(GLuint buffer,GLenum pname,void** params)const{if(!this->m_glGetNamedBufferPointervEXT)this->m_resolveOrThrow(1031);this->m_glGetNamedBufferPointervEXT(buffer,pname,params);}
+void m_glTextureBarrierNV_lazy()const{if(!this->m_glTextureBarrierNV)this->m_resolveOrThrow(1032);this->m_glTextureBarrierNV();}
+void m_glColor4ubVertex3fvSUN_lazy(const GLubyte* c,const GLfloat* v)const{if(!this->m_glColor4ubVertex3fvSUN)this->m_resolveOrThrow(1033);this->m_glColor4ubVertex3fvSUN(c,v);}
+GLuint m_glGetCommandHeaderNV_lazy(GLenum tokenID,GLuint size)const{if(!this->m_glGetCommandHeaderNV)this->m_resolveOrThrow(1034);return this->m_glGetCommandHeaderNV(tokenID,size);}
+void m_glGetPerfMonitorCounterInfoAMD_lazy(GLuint group,GLuint counter,GLenum pname,void* data)const{if(!this->m_glGetPerfMonitorCounterInfoAMD)this->m_resolveOrThrow(1035);this->m_glGetPerfMonitorCounterInfoAMD(group,counter,pname,data);}
+void m_glVertexAttrib1svARB_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib1svARB)this->m_resolveOrThrow(1036);this->m_glVertexAttrib1svARB(index,v);}
+void m_glCombinerParameteriNV_lazy(GLenum pname,GLint param)const{if(!this->m_glCombinerParameteriNV)this->m_resolveOrThrow(1037);this->m_glCombinerParameteriNV(pname,param);}
+void m_glMatrixMultTransposefEXT_lazy(GLenum mode,const GLfloat* m)const{if(!this->m_glMatrixMultTransposefEXT)this->m_resolveOrThrow(1038);this->m_glMatrixMultTransposefEXT(mode,m);}
+void m_glDetailTexFuncSGIS_lazy(GLenum target,GLsizei n,const GLfloat* points)const{if(!this->m_glDetailTexFuncSGIS)this->m_resolveOrThrow(1039);this->m_glDetailTexFuncSGIS(target,n,points);}
+GLboolean m_glAreTexturesResident_lazy(GLsizei n,const GLuint* textures,GLboolean* residences)const{if(!this->m_glAreTexturesResident)this->m_resolveOrThrow(1040);return this->m_glAreTexturesResident(n,textures,residences);}
+void m_glProgramUniform2d_lazy(GLuint program,GLint location,GLdouble v0,GLdouble v1)const{if(!this->m_glProgramUniform2d)this->m_resolveOrThrow(1041);this->m_glProgramUniform2d(program,location,v0,v1);}
+void m_glGetConvolutionParameterfvEXT_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetConvolutionParameterfvEXT)this->m_resolveOrThrow(1042);this->m_glGetConvolutionParameterfvEXT(target,pname,params);}
+void m_glIndexPointerListIBM_lazy(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glIndexPointerListIBM)this->m_resolveOrThrow(1043);this->m_glIndexPointerListIBM(type,stride,pointer,ptrstride);}
+void m_glVertexAttribI4iEXT_lazy(GLuint index,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glVertexAttribI4iEXT)this->m_resolveOrThrow(1044);this->m_glVertexAttribI4iEXT(index,x,y,z,w);}
+void m_glProgramUniform2f_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{if(!this->m_glProgramUniform2f)this->m_resolveOrThrow(1045);this->m_glProgramUniform2f(program,location,v0,v1);}
+void m_glRasterPos4sv_lazy(const GLshort* v)const{if(!this->m_glRasterPos4sv)this->m_resolveOrThrow(1046);this->m_glRasterPos4sv(v);}
+void m_glColor4s_lazy(GLshort red,GLshort green,GLshort blue,GLshort alpha)const{if(!this->m_glColor4s)this->m_resolveOrThrow(1047);this->m_glColor4s(red,green,blue,alpha);}
+void m_glMulticastGetQueryObjectivNV_lazy(GLuint gpu,GLuint id,GLenum pname,GLint* params)const{if(!this->m_glMulticastGetQueryObjectivNV)this->m_resolveOrThrow(1048);this->m_glMulticastGetQueryObjectivNV(gpu,id,pname,params);}
+void m_glColorFragmentOp3ATI_lazy(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{if(!this->m_glColorFragmentOp3ATI)this->m_resolveOrThrow(1049);this->m_glColorFragmentOp3ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+void m_glResizeBuffersMESA_lazy()const{if(!this->m_glResizeBuffersMESA)this->m_resolveOrThrow(1050);this->m_glResizeBuffersMESA();}
+void m_glGetMinmaxParameterfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetMinmaxParameterfv)this->m_resolveOrThrow(1051);this->m_glGetMinmaxParameterfv(target,pname,params);}
+void m_glClientActiveTextureARB_lazy(GLenum texture)const{if(!this->m_glClientActiveTextureARB)this->m_resolveOrThrow(1052);this->m_glClientActiveTextureARB(texture);}
+void m_glBindVertexArray_lazy(GLuint array)const{if(!this->m_glBindVertexArray)this->m_resolveOrThrow(1053);this->m_glBindVertexArray(array);}
+void m_glColor4b_lazy(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha)const{if(!this->m_glColor4b)this->m_resolveOrThrow(1054);this->m_glColor4b(red,green,blue,alpha);}
+void m_glColor4f_lazy(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{if(!this->m_glColor4f)this->m_resolveOrThrow(1055);this->m_glColor4f(red,green,blue,alpha);}
+void m_glColor4d_lazy(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha)const{if(!this->m_glColor4d)this->m_resolveOrThrow(1056);this->m_glColor4d(red,green,blue,alpha);}
+void m_glColor4i_lazy(GLint red,GLint green,GLint blue,GLint alpha)const{if(!this->m_glColor4i)this->m_resolveOrThrow(1057);this->m_glColor4i(red,green,blue,alpha);}
+void m_glEdgeFlagFormatNV_lazy(GLsizei stride)const{if(!this->m_glEdgeFlagFormatNV)this->m_resolveOrThrow(1058);this->m_glEdgeFlagFormatNV(stride);}
+void m_glNamedBufferSubData_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{if(!this->m_glNamedBufferSubData)this->m_resolveOrThrow(1059);this->m_glNamedBufferSubData(buffer,offset,size,data);}
+void m_glDrawElementsInstanced_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount)const{if(!this->m_glDrawElementsInstanced)this->m_resolveOrThrow(1060);this->m_glDrawElementsInstanced(mode,count,type,indices,instancecount);}
+void m_glGetMultiTexParameterIivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMultiTexParameterIivEXT)this->m_resolveOrThrow(1061);this->m_glGetMultiTexParameterIivEXT(texunit,target,pname,params);}
+void m_glVertex2dv_lazy(const GLdouble* v)const{if(!this->m_glVertex2dv)this->m_resolveOrThrow(1062);this->m_glVertex2dv(v);}
+void m_glDisableVertexArrayAttribEXT_lazy(GLuint vaobj,GLuint index)const{if(!this->m_glDisableVertexArrayAttribEXT)this->m_resolveOrThrow(1063);this->m_glDisableVertexArrayAttribEXT(vaobj,index);}
+GLenum m_glObjectUnpurgeableAPPLE_lazy(GLenum objectType,GLuint name,GLenum option)const{if(!this->m_glObjectUnpurgeableAPPLE)this->m_resolveOrThrow(1064);return this->m_glObjectUnpurgeableAPPLE(objectType,name,option);}
+void m_glVertexAttribs2dvNV_lazy(GLuint index,GLsizei count,const GLdouble* v)const{if(!this->m_glVertexAttribs2dvNV)this->m_resolveOrThrow(1065);this->m_glVertexAttribs2dvNV(index,count,v);}
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_lazy(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiTexCoord2fVertex3fSUN)this->m_resolveOrThrow(1066);this->m_glReplacementCodeuiTexCoord2fVertex3fSUN(rc,s,t,x,y,z);}
+void m_glGetMapParameterfvNV_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetMapParameterfvNV)this->m_resolveOrThrow(1067);this->m_glGetMapParameterfvNV(target,pname,params);}
+void m_glProgramUniform4ivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform4ivEXT)this->m_resolveOrThrow(1068);this->m_glProgramUniform4ivEXT(program,location,count,value);}
+void m_glProgramUniform3ui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glProgramUniform3ui64vNV)this->m_resolveOrThrow(1069);this->m_glProgramUniform3ui64vNV(program,location,count,value);}
+void m_glRectfv_lazy(const GLfloat* v1,const GLfloat* v2)const{if(!this->m_glRectfv)this->m_resolveOrThrow(1070);this->m_glRectfv(v1,v2);}
+void m_glTexFilterFuncSGIS_lazy(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights)const{if(!this->m_glTexFilterFuncSGIS)this->m_resolveOrThrow(1071);this->m_glTexFilterFuncSGIS(target,filter,n,weights);}
+void m_glSpriteParameterfvSGIX_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glSpriteParameterfvSGIX)this->m_resolveOrThrow(1072);this->m_glSpriteParameterfvSGIX(pname,params);}
+void m_glCopyMultiTexImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{if(!this->m_glCopyMultiTexImage1DEXT)this->m_resolveOrThrow(1073);this->m_glCopyMultiTexImage1DEXT(texunit,target,level,internalformat,x,y,width,border);}
+void m_glGetVertexAttribIuivEXT_lazy(GLuint index,GLenum pname,GLuint* params)const{if(!this->m_glGetVertexAttribIuivEXT)this->m_resolveOrThrow(1074);this->m_glGetVertexAttribIuivEXT(index,pname,params);}
+void m_glUniformMatrix2x4dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix2x4dv)this->m_resolveOrThrow(1075);this->m_glUniformMatrix2x4dv(location,count,transpose,value);}
+GLint m_glGetProgramResourceLocationIndex_lazy(GLuint program,GLenum programInterface,const GLchar* name)const{if(!this->m_glGetProgramResourceLocationIndex)this->m_resolveOrThrow(1076);return this->m_glGetProgramResourceLocationIndex(program,programInterface,name);}
+void m_glColor3hNV_lazy(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{if(!this->m_glColor3hNV)this->m_resolveOrThrow(1077);this->m_glColor3hNV(red,green,blue);}
+void m_glViewport_lazy(GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glViewport)this->m_resolveOrThrow(1078);this->m_glViewport(x,y,width,height);}
+void m_glProgramNamedParameter4fNV_lazy(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glProgramNamedParameter4fNV)this->m_resolveOrThrow(1079);this->m_glProgramNamedParameter4fNV(id,len,name,x,y,z,w);}
+void m_glGetInvariantBooleanvEXT_lazy(GLuint id,GLenum value,GLboolean* data)const{if(!this->m_glGetInvariantBooleanvEXT)this->m_resolveOrThrow(1080);this->m_glGetInvariantBooleanvEXT(id,value,data);}
+void m_glTexStorage2DMultisample_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{if(!this->m_glTexStorage2DMultisample)this->m_resolveOrThrow(1081);this->m_glTexStorage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+void m_glPixelStorex_lazy(GLenum pname,GLfixed param)const{if(!this->m_glPixelStorex)this->m_resolveOrThrow(1082);this->m_glPixelStorex(pname,param);}
+void m_glVertexAttribL1dvEXT_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL1dvEXT)this->m_resolveOrThrow(1083);this->m_glVertexAttribL1dvEXT(index,v);}
+void m_glGetActiveSubroutineUniformiv_lazy(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values)const{if(!this->m_glGetActiveSubroutineUniformiv)this->m_resolveOrThrow(1084);this->m_glGetActiveSubroutineUniformiv(program,shadertype,index,pname,values);}
+void m_glVertexAttribPointerARB_lazy(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribPointerARB)this->m_resolveOrThrow(1085);this->m_glVertexAttribPointerARB(index,size,type,normalized,stride,pointer);}
+void m_glCompressedTexSubImage2DARB_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexSubImage2DARB)this->m_resolveOrThrow(1086);this->m_glCompressedTexSubImage2DARB(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+void m_glTexStorageMem1DEXT_lazy(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{if(!this->m_glTexStorageMem1DEXT)this->m_resolveOrThrow(1087);this->m_glTexStorageMem1DEXT(target,levels,internalFormat,width,memory,offset);}
+void m_glVertex2hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glVertex2hvNV)this->m_resolveOrThrow(1088);this->m_glVertex2hvNV(v);}
+void m_glTexBuffer_lazy(GLenum target,GLenum internalformat,GLuint buffer)const{if(!this->m_glTexBuffer)this->m_resolveOrThrow(1089);this->m_glTexBuffer(target,internalformat,buffer);}
+void m_glArrayElement_lazy(GLint i)const{if(!this->m_glArrayElement)this->m_resolveOrThrow(1090);this->m_glArrayElement(i);}
+void m_glValidateProgram_lazy(GLuint program)const{if(!this->m_glValidateProgram)this->m_resolveOrThrow(1091);this->m_glValidateProgram(program);}
+void m_glPixelStoref_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPixelStoref)this->m_resolveOrThrow(1092);this->m_glPixelStoref(pname,param);}
+void m_glWindowPos3dARB_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glWindowPos3dARB)this->m_resolveOrThrow(1093);this->m_glWindowPos3dARB(x,y,z);}
+void m_glEvalCoord1dv_lazy(const GLdouble* u)const{if(!this->m_glEvalCoord1dv)this->m_resolveOrThrow(1094);this->m_glEvalCoord1dv(u);}
+void m_glVertexAttribs2fvNV_lazy(GLuint index,GLsizei count,const GLfloat* v)const{if(!this->m_glVertexAttribs2fvNV)this->m_resolveOrThrow(1095);this->m_glVertexAttribs2fvNV(index,count,v);}
+void m_glRecti_lazy(GLint x1,GLint y1,GLint x2,GLint y2)const{if(!this->m_glRecti)this->m_resolveOrThrow(1096);this->m_glRecti(x1,y1,x2,y2);}
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{if(!this->m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_resolveOrThrow(1097);this->m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc,tc,c,n,v);}
+void m_glTexCoord1bOES_lazy(GLbyte s)const{if(!this->m_glTexCoord1bOES)this->m_resolveOrThrow(1098);this->m_glTexCoord1bOES(s);}
+void m_glProgramUniform2i64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glProgramUniform2i64vARB)this->m_resolveOrThrow(1099);this->m_glProgramUniform2i64vARB(program,location,count,value);}
+void m_glWindowPos2dARB_lazy(GLdouble x,GLdouble y)const{if(!this->m_glWindowPos2dARB)this->m_resolveOrThrow(1100);this->m_glWindowPos2dARB(x,y);}
+void m_glGetProgramParameterdvNV_lazy(GLenum target,GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetProgramParameterdvNV)this->m_resolveOrThrow(1101);this->m_glGetProgramParameterdvNV(target,index,pname,params);}
+void m_glRectf_lazy(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2)const{if(!this->m_glRectf)this->m_resolveOrThrow(1102);this->m_glRectf(x1,y1,x2,y2);}
+void m_glRectd_lazy(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2)const{if(!this->m_glRectd)this->m_resolveOrThrow(1103);this->m_glRectd(x1,y1,x2,y2);}
+void m_glMap1xOES_lazy(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points)const{if(!this->m_glMap1xOES)this->m_resolveOrThrow(1104);this->m_glMap1xOES(target,u1,u2,stride,order,points);}
+void m_glVertexAttrib3fvNV_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib3fvNV)this->m_resolveOrThrow(1105);this->m_glVertexAttrib3fvNV(index,v);}
+void m_glReferencePlaneSGIX_lazy(const GLdouble* equation)const{if(!this->m_glReferencePlaneSGIX)this->m_resolveOrThrow(1106);this->m_glReferencePlaneSGIX(equation);}
+void m_glMulticastBlitFramebufferNV_lazy(GLuint srcGpu,GLuint dstGpu,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{if(!this->m_glMulticastBlitFramebufferNV)this->m_resolveOrThrow(1107);this->m_glMulticastBlitFramebufferNV(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+void m_glGetCombinerInputParameterfvNV_lazy(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params)const{if(!this->m_glGetCombinerInputParameterfvNV)this->m_resolveOrThrow(1108);this->m_glGetCombinerInputParameterfvNV(stage,portion,variable,pname,params);}
+GLuint64 m_glGetTextureSamplerHandleARB_lazy(GLuint texture,GLuint sampler)const{if(!this->m_glGetTextureSamplerHandleARB)this->m_resolveOrThrow(1109);return this->m_glGetTextureSamplerHandleARB(texture,sampler);}
+void m_glBindTexture_lazy(GLenum target,GLuint texture)const{if(!this->m_glBindTexture)this->m_resolveOrThrow(1110);this->m_glBindTexture(target,texture);}
+void m_glRects_lazy(GLshort x1,GLshort y1,GLshort x2,GLshort y2)const{if(!this->m_glRects)this->m_resolveOrThrow(1111);this->m_glRects(x1,y1,x2,y2);}
+void m_glGetActiveAttribARB_lazy(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{if(!this->m_glGetActiveAttribARB)this->m_resolveOrThrow(1112);this->m_glGetActiveAttribARB(programObj,index,maxLength,length,size,type,name);}
+void m_glHistogramEXT_lazy(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{if(!this->m_glHistogramEXT)this->m_resolveOrThrow(1113);this->m_glHistogramEXT(target,width,internalformat,sink);}
+GLuint64 m_glGetTextureSamplerHandleNV_lazy(GLuint texture,GLuint sampler)const{if(!this->m_glGetTextureSamplerHandleNV)this->m_resolveOrThrow(1114);return this->m_glGetTextureSamplerHandleNV(texture,sampler);}
+void m_glDetachShader_lazy(GLuint program,GLuint shader)const{if(!this->m_glDetachShader)this->m_resolveOrThrow(1115);this->m_glDetachShader(program,shader);}
+void m_glFinishTextureSUNX_lazy()const{if(!this->m_glFinishTextureSUNX)this->m_resolveOrThrow(1116);this->m_glFinishTextureSUNX();}
+void m_glUniformMatrix3x4dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix3x4dv)this->m_resolveOrThrow(1117);this->m_glUniformMatrix3x4dv(location,count,transpose,value);}
+void m_glVertexAttrib4fARB_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glVertexAttrib4fARB)this->m_resolveOrThrow(1118);this->m_glVertexAttrib4fARB(index,x,y,z,w);}
+void m_glGetPathColorGenivNV_lazy(GLenum color,GLenum pname,GLint* value)const{if(!this->m_glGetPathColorGenivNV)this->m_resolveOrThrow(1119);this->m_glGetPathColorGenivNV(color,pname,value);}
+GLint m_glGetProgramResourceLocation_lazy(GLuint program,GLenum programInterface,const GLchar* name)const{if(!this->m_glGetProgramResourceLocation)this->m_resolveOrThrow(1120);return this->m_glGetProgramResourceLocation(program,programInterface,name);}
+void m_glVertexArrayAttribLFormat_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexArrayAttribLFormat)this->m_resolveOrThrow(1121);this->m_glVertexArrayAttribLFormat(vaobj,attribindex,size,type,relativeoffset);}
+void m_glGetTexLevelParameterfv_lazy(GLenum target,GLint level,GLenum pname,GLfloat* params)const{if(!this->m_glGetTexLevelParameterfv)this->m_resolveOrThrow(1122);this->m_glGetTexLevelParameterfv(target,level,pname,params);}
+void m_glVertexArrayVertexAttribOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayVertexAttribOffsetEXT)this->m_resolveOrThrow(1123);this->m_glVertexArrayVertexAttribOffsetEXT(vaobj,buffer,index,size,type,normalized,stride,offset);}
+void m_glIndexFormatNV_lazy(GLenum type,GLsizei stride)const{if(!this->m_glIndexFormatNV)this->m_resolveOrThrow(1124);this->m_glIndexFormatNV(type,stride);}
+void m_glMultiTexCoord3i_lazy(GLenum target,GLint s,GLint t,GLint r)const{if(!this->m_glMultiTexCoord3i)this->m_resolveOrThrow(1125);this->m_glMultiTexCoord3i(target,s,t,r);}
+void m_glReplacementCodeuiVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* v)const{if(!this->m_glReplacementCodeuiVertex3fvSUN)this->m_resolveOrThrow(1126);this->m_glReplacementCodeuiVertex3fvSUN(rc,v);}
+void m_glViewportIndexedfv_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glViewportIndexedfv)this->m_resolveOrThrow(1127);this->m_glViewportIndexedfv(index,v);}
+void m_glBindBuffersBase_lazy(GLenum target,GLuint first,GLsizei count,const GLuint* buffers)const{if(!this->m_glBindBuffersBase)this->m_resolveOrThrow(1128);this->m_glBindBuffersBase(target,first,count,buffers);}
+void m_glTexBumpParameterfvATI_lazy(GLenum pname,const GLfloat* param)const{if(!this->m_glTexBumpParameterfvATI)this->m_resolveOrThrow(1129);this->m_glTexBumpParameterfvATI(pname,param);}
+void m_glMatrixIndexuivARB_lazy(GLint size,const GLuint* indices)const{if(!this->m_glMatrixIndexuivARB)this->m_resolveOrThrow(1130);this->m_glMatrixIndexuivARB(size,indices);}
+void m_glVertexAttrib1hNV_lazy(GLuint index,GLhalfNV x)const{if(!this->m_glVertexAttrib1hNV)this->m_resolveOrThrow(1131);this->m_glVertexAttrib1hNV(index,x);}
+void m_glWindowPos3svMESA_lazy(const GLshort* v)const{if(!this->m_glWindowPos3svMESA)this->m_resolveOrThrow(1132);this->m_glWindowPos3svMESA(v);}
+void m_glStencilOpSeparateATI_lazy(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{if(!this->m_glStencilOpSeparateATI)this->m_resolveOrThrow(1133);this->m_glStencilOpSeparateATI(face,sfail,dpfail,dppass);}
+void m_glDrawElementsBaseVertex_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{if(!this->m_glDrawElementsBaseVertex)this->m_resolveOrThrow(1134);this->m_glDrawElementsBaseVertex(mode,count,type,indices,basevertex);}
+void m_glBlendEquationSeparateiARB_lazy(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{if(!this->m_glBlendEquationSeparateiARB)this->m_resolveOrThrow(1135);this->m_glBlendEquationSeparateiARB(buf,modeRGB,modeAlpha);}
+void m_glVertexAttrib1fNV_lazy(GLuint index,GLfloat x)const{if(!this->m_glVertexAttrib1fNV)this->m_resolveOrThrow(1136);this->m_glVertexAttrib1fNV(index,x);}
+void m_glMapVertexAttrib2fAPPLE_lazy(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{if(!this->m_glMapVertexAttrib2fAPPLE)this->m_resolveOrThrow(1137);this->m_glMapVertexAttrib2fAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+void m_glCompressedTextureSubImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureSubImage1DEXT)this->m_resolveOrThrow(1138);this->m_glCompressedTextureSubImage1DEXT(texture,target,level,xoffset,width,format,imageSize,bits);}
+void m_glClearBufferSubData_lazy(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearBufferSubData)this->m_resolveOrThrow(1139);this->m_glClearBufferSubData(target,internalformat,offset,size,format,type,data);}
+void m_glTexStorage1D_lazy(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{if(!this->m_glTexStorage1D)this->m_resolveOrThrow(1140);this->m_glTexStorage1D(target,levels,internalformat,width);}
+void m_glVertexAttribI3iEXT_lazy(GLuint index,GLint x,GLint y,GLint z)const{if(!this->m_glVertexAttribI3iEXT)this->m_resolveOrThrow(1141);this->m_glVertexAttribI3iEXT(index,x,y,z);}
+void m_glMakeTextureHandleNonResidentARB_lazy(GLuint64 handle)const{if(!this->m_glMakeTextureHandleNonResidentARB)this->m_resolveOrThrow(1142);this->m_glMakeTextureHandleNonResidentARB(handle);}
+void m_glMultiDrawElementArrayAPPLE_lazy(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{if(!this->m_glMultiDrawElementArrayAPPLE)this->m_resolveOrThrow(1143);this->m_glMultiDrawElementArrayAPPLE(mode,first,count,primcount);}
+void m_glVertexStream4dATI_lazy(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexStream4dATI)this->m_resolveOrThrow(1144);this->m_glVertexStream4dATI(stream,x,y,z,w);}
+void m_glProgramUniformMatrix2dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2dvEXT)this->m_resolveOrThrow(1145);this->m_glProgramUniformMatrix2dvEXT(program,location,count,transpose,value);}
+void m_glVertexAttribs2hvNV_lazy(GLuint index,GLsizei n,const GLhalfNV* v)const{if(!this->m_glVertexAttribs2hvNV)this->m_resolveOrThrow(1146);this->m_glVertexAttribs2hvNV(index,n,v);}
+void m_glGetUniformiv_lazy(GLuint program,GLint location,GLint* params)const{if(!this->m_glGetUniformiv)this->m_resolveOrThrow(1147);this->m_glGetUniformiv(program,location,params);}
+void m_glClipPlanefOES_lazy(GLenum plane,const GLfloat* equation)const{if(!this->m_glClipPlanefOES)this->m_resolveOrThrow(1148);this->m_glClipPlanefOES(plane,equation);}
+void m_glRenderbufferStorage_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glRenderbufferStorage)this->m_resolveOrThrow(1149);this->m_glRenderbufferStorage(target,internalformat,width,height);}
+void m_glUniform4ui_lazy(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{if(!this->m_glUniform4ui)this->m_resolveOrThrow(1150);this->m_glUniform4ui(location,v0,v1,v2,v3);}
+void m_glBindFramebuffer_lazy(GLenum target,GLuint framebuffer)const{if(!this->m_glBindFramebuffer)this->m_resolveOrThrow(1151);this->m_glBindFramebuffer(target,framebuffer);}
+void m_glValidateProgramARB_lazy(GLhandleARB programObj)const{if(!this->m_glValidateProgramARB)this->m_resolveOrThrow(1152);this->m_glValidateProgramARB(programObj);}
+void m_glTexGenf_lazy(GLenum coord,GLenum pname,GLfloat param)const{if(!this->m_glTexGenf)this->m_resolveOrThrow(1153);this->m_glTexGenf(coord,pname,param);}
+void m_glTexGend_lazy(GLenum coord,GLenum pname,GLdouble param)const{if(!this->m_glTexGend)this->m_resolveOrThrow(1154);this->m_glTexGend(coord,pname,param);}
+void m_glTexGeni_lazy(GLenum coord,GLenum pname,GLint param)const{if(!this->m_glTexGeni)this->m_resolveOrThrow(1155);this->m_glTexGeni(coord,pname,param);}
+void m_glDeleteFramebuffersEXT_lazy(GLsizei n,const GLuint* framebuffers)const{if(!this->m_glDeleteFramebuffersEXT)this->m_resolveOrThrow(1156);this->m_glDeleteFramebuffersEXT(n,framebuffers);}
+void m_glResetMinmaxEXT_lazy(GLenum target)const{if(!this->m_glResetMinmaxEXT)this->m_resolveOrThrow(1157);this->m_glResetMinmaxEXT(target);}
+void m_glVertexAttrib1fvNV_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib1fvNV)this->m_resolveOrThrow(1158);this->m_glVertexAttrib1fvNV(index,v);}
+GLboolean m_glIsQueryARB_lazy(GLuint id)const{if(!this->m_glIsQueryARB)this->m_resolveOrThrow(1159);return this->m_glIsQueryARB(id);}
+void m_glEnableVariantClientStateEXT_lazy(GLuint id)const{if(!this->m_glEnableVariantClientStateEXT)this->m_resolveOrThrow(1160);this->m_glEnableVariantClientStateEXT(id);}
+void m_glScissorIndexed_lazy(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height)const{if(!this->m_glScissorIndexed)this->m_resolveOrThrow(1161);this->m_glScissorIndexed(index,left,bottom,width,height);}
+void m_glGetInvariantIntegervEXT_lazy(GLuint id,GLenum value,GLint* data)const{if(!this->m_glGetInvariantIntegervEXT)this->m_resolveOrThrow(1162);this->m_glGetInvariantIntegervEXT(id,value,data);}
+void m_glProgramLocalParameterI4uiNV_lazy(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{if(!this->m_glProgramLocalParameterI4uiNV)this->m_resolveOrThrow(1163);this->m_glProgramLocalParameterI4uiNV(target,index,x,y,z,w);}
+void m_glConvolutionParameterxvOES_lazy(GLenum target,GLenum pname,const GLfixed* params)const{if(!this->m_glConvolutionParameterxvOES)this->m_resolveOrThrow(1164);this->m_glConvolutionParameterxvOES(target,pname,params);}
+void m_glGenFramebuffersEXT_lazy(GLsizei n,GLuint* framebuffers)const{if(!this->m_glGenFramebuffersEXT)this->m_resolveOrThrow(1165);this->m_glGenFramebuffersEXT(n,framebuffers);}
+void m_glVertexArrayColorOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayColorOffsetEXT)this->m_resolveOrThrow(1166);this->m_glVertexArrayColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+void m_glMultiTexCoord3ivARB_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord3ivARB)this->m_resolveOrThrow(1167);this->m_glMultiTexCoord3ivARB(target,v);}
+void m_glVertexWeightfEXT_lazy(GLfloat weight)const{if(!this->m_glVertexWeightfEXT)this->m_resolveOrThrow(1168);this->m_glVertexWeightfEXT(weight);}
+void m_glRasterPos4dv_lazy(const GLdouble* v)const{if(!this->m_glRasterPos4dv)this->m_resolveOrThrow(1169);this->m_glRasterPos4dv(v);}
+GLboolean m_glIsTextureHandleResidentARB_lazy(GLuint64 handle)const{if(!this->m_glIsTextureHandleResidentARB)this->m_resolveOrThrow(1170);return this->m_glIsTextureHandleResidentARB(handle);}
+void m_glRasterPos2dv_lazy(const GLdouble* v)const{if(!this->m_glRasterPos2dv)this->m_resolveOrThrow(1171);this->m_glRasterPos2dv(v);}
+void m_glWindowPos4ivMESA_lazy(const GLint* v)const{if(!this->m_glWindowPos4ivMESA)this->m_resolveOrThrow(1172);this->m_glWindowPos4ivMESA(v);}
+void m_glGetVariantPointervEXT_lazy(GLuint id,GLenum value,void** data)const{if(!this->m_glGetVariantPointervEXT)this->m_resolveOrThrow(1173);this->m_glGetVariantPointervEXT(id,value,data);}
+void* m_glMapNamedBufferRangeEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{if(!this->m_glMapNamedBufferRangeEXT)this->m_resolveOrThrow(1174);return this->m_glMapNamedBufferRangeEXT(buffer,offset,length,access);}
+void m_glGetnUniformui64vARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLuint64* params)const{if(!this->m_glGetnUniformui64vARB)this->m_resolveOrThrow(1175);this->m_glGetnUniformui64vARB(program,location,bufSize,params);}
+GLuint m_glCreateShaderProgramv_lazy(GLenum type,GLsizei count,const GLchar*const* strings)const{if(!this->m_glCreateShaderProgramv)this->m_resolveOrThrow(1176);return this->m_glCreateShaderProgramv(type,count,strings);}
+void m_glGetQueryObjectiv_lazy(GLuint id,GLenum pname,GLint* params)const{if(!this->m_glGetQueryObjectiv)this->m_resolveOrThrow(1177);this->m_glGetQueryObjectiv(id,pname,params);}
+void m_glMaxShaderCompilerThreadsKHR_lazy(GLuint count)const{if(!this->m_glMaxShaderCompilerThreadsKHR)this->m_resolveOrThrow(1178);this->m_glMaxShaderCompilerThreadsKHR(count);}
+void m_glPNTrianglesfATI_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPNTrianglesfATI)this->m_resolveOrThrow(1179);this->m_glPNTrianglesfATI(pname,param);}
+void m_glGlobalAlphaFactorusSUN_lazy(GLushort factor)const{if(!this->m_glGlobalAlphaFactorusSUN)this->m_resolveOrThrow(1180);this->m_glGlobalAlphaFactorusSUN(factor);}
+void m_glVertexAttrib3dvNV_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib3dvNV)this->m_resolveOrThrow(1181);this->m_glVertexAttrib3dvNV(index,v);}
+void m_glMultiTexCoord3sARB_lazy(GLenum target,GLshort s,GLshort t,GLshort r)const{if(!this->m_glMultiTexCoord3sARB)this->m_resolveOrThrow(1182);this->m_glMultiTexCoord3sARB(target,s,t,r);}
+void m_glGenerateMipmap_lazy(GLenum target)const{if(!this->m_glGenerateMipmap)this->m_resolveOrThrow(1183);this->m_glGenerateMipmap(target);}
+void m_glCompressedTextureSubImage2D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTextureSubImage2D)this->m_resolveOrThrow(1184);this->m_glCompressedTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,imageSize,data);}
+void m_glNamedRenderbufferStorageMultisampleEXT_lazy(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glNamedRenderbufferStorageMultisampleEXT)this->m_resolveOrThrow(1185);this->m_glNamedRenderbufferStorageMultisampleEXT(renderbuffer,samples,internalformat,width,height);}
+void m_glPolygonOffsetClampEXT_lazy(GLfloat factor,GLfloat units,GLfloat clamp)const{if(!this->m_glPolygonOffsetClampEXT)this->m_resolveOrThrow(1186);this->m_glPolygonOffsetClampEXT(factor,units,clamp);}
+void m_glTextureRangeAPPLE_lazy(GLenum target,GLsizei length,const void* pointer)const{if(!this->m_glTextureRangeAPPLE)this->m_resolveOrThrow(1187);this->m_glTextureRangeAPPLE(target,length,pointer);}
+void m_glBlendEquationIndexedAMD_lazy(GLuint buf,GLenum mode)const{if(!this->m_glBlendEquationIndexedAMD)this->m_resolveOrThrow(1188);this->m_glBlendEquationIndexedAMD(buf,mode);}
+void m_glTexCoord2d_lazy(GLdouble s,GLdouble t)const{if(!this->m_glTexCoord2d)this->m_resolveOrThrow(1189);this->m_glTexCoord2d(s,t);}
+void m_glPointParameteri_lazy(GLenum pname,GLint param)const{if(!this->m_glPointParameteri)this->m_resolveOrThrow(1190);this->m_glPointParameteri(pname,param);}
+void m_glTexCoord2f_lazy(GLfloat s,GLfloat t)const{if(!this->m_glTexCoord2f)this->m_resolveOrThrow(1191);this->m_glTexCoord2f(s,t);}
+void m_glGetUnsignedBytei_vEXT_lazy(GLenum target,GLuint index,GLubyte* data)const{if(!this->m_glGetUnsignedBytei_vEXT)this->m_resolveOrThrow(1192);this->m_glGetUnsignedBytei_vEXT(target,index,data);}
+void m_glColor4iv_lazy(const GLint* v)const{if(!this->m_glColor4iv)this->m_resolveOrThrow(1193);this->m_glColor4iv(v);}
+void* m_glMapNamedBufferRange_lazy(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{if(!this->m_glMapNamedBufferRange)this->m_resolveOrThrow(1194);return this->m_glMapNamedBufferRange(buffer,offset,length,access);}
+GLboolean m_glUnmapBuffer_lazy(GLenum target)const{if(!this->m_glUnmapBuffer)this->m_resolveOrThrow(1195);return this->m_glUnmapBuffer(target);}
+void m_glSampleMaskEXT_lazy(GLclampf value,GLboolean invert)const{if(!this->m_glSampleMaskEXT)this->m_resolveOrThrow(1196);this->m_glSampleMaskEXT(value,invert);}
+void m_glTexCoord2i_lazy(GLint s,GLint t)const{if(!this->m_glTexCoord2i)this->m_resolveOrThrow(1197);this->m_glTexCoord2i(s,t);}
+void m_glTexCoord1xvOES_lazy(const GLfixed* coords)const{if(!this->m_glTexCoord1xvOES)this->m_resolveOrThrow(1198);this->m_glTexCoord1xvOES(coords);}
+void m_glVertexAttrib1sARB_lazy(GLuint index,GLshort x)const{if(!this->m_glVertexAttrib1sARB)this->m_resolveOrThrow(1199);this->m_glVertexAttrib1sARB(index,x);}
+void m_glGetVertexArrayiv_lazy(GLuint vaobj,GLenum pname,GLint* param)const{if(!this->m_glGetVertexArrayiv)this->m_resolveOrThrow(1200);this->m_glGetVertexArrayiv(vaobj,pname,param);}
+void m_glProgramParameter4dvNV_lazy(GLenum target,GLuint index,const GLdouble* v)const{if(!this->m_glProgramParameter4dvNV)this->m_resolveOrThrow(1201);this->m_glProgramParameter4dvNV(target,index,v);}
+void m_glTexCoord2s_lazy(GLshort s,GLshort t)const{if(!this->m_glTexCoord2s)this->m_resolveOrThrow(1202);this->m_glTexCoord2s(s,t);}
+void m_glTextureParameterIuivEXT_lazy(GLuint texture,GLenum target,GLenum pname,const GLuint* params)const{if(!this->m_glTextureParameterIuivEXT)this->m_resolveOrThrow(1203);this->m_glTextureParameterIuivEXT(texture,target,pname,params);}
+void m_glGetColorTableParameterfvSGI_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetColorTableParameterfvSGI)this->m_resolveOrThrow(1204);this->m_glGetColorTableParameterfvSGI(target,pname,params);}
+void m_glTexCoord4dv_lazy(const GLdouble* v)const{if(!this->m_glTexCoord4dv)this->m_resolveOrThrow(1205);this->m_glTexCoord4dv(v);}
+void m_glVertexAttrib1svNV_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib1svNV)this->m_resolveOrThrow(1206);this->m_glVertexAttrib1svNV(index,v);}
+void m_glNamedFramebufferTextureFaceEXT_lazy(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face)const{if(!this->m_glNamedFramebufferTextureFaceEXT)this->m_resolveOrThrow(1207);this->m_glNamedFramebufferTextureFaceEXT(framebuffer,attachment,texture,level,face);}
+void m_glProgramUniform2ui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glProgramUniform2ui64vNV)this->m_resolveOrThrow(1208);this->m_glProgramUniform2ui64vNV(program,location,count,value);}
+void m_glStencilFillPathNV_lazy(GLuint path,GLenum fillMode,GLuint mask)const{if(!this->m_glStencilFillPathNV)this->m_resolveOrThrow(1209);this->m_glStencilFillPathNV(path,fillMode,mask);}
+void m_glNormal3dv_lazy(const GLdouble* v)const{if(!this->m_glNormal3dv)this->m_resolveOrThrow(1210);this->m_glNormal3dv(v);}
+void m_glReleaseShaderCompiler_lazy()const{if(!this->m_glReleaseShaderCompiler)this->m_resolveOrThrow(1211);this->m_glReleaseShaderCompiler();}
+void m_glTexStorageMem3DEXT_lazy(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{if(!this->m_glTexStorageMem3DEXT)this->m_resolveOrThrow(1212);this->m_glTexStorageMem3DEXT(target,levels,internalFormat,width,height,depth,memory,offset);}
+void m_glTexCoord3bvOES_lazy(const GLbyte* coords)const{if(!this->m_glTexCoord3bvOES)this->m_resolveOrThrow(1213);this->m_glTexCoord3bvOES(coords);}
+GLboolean m_glIsVertexAttribEnabledAPPLE_lazy(GLuint index,GLenum pname)const{if(!this->m_glIsVertexAttribEnabledAPPLE)this->m_resolveOrThrow(1214);return this->m_glIsVertexAttribEnabledAPPLE(index,pname);}
+void m_glTexCoord1dv_lazy(const GLdouble* v)const{if(!this->m_glTexCoord1dv)this->m_resolveOrThrow(1215);this->m_glTexCoord1dv(v);}
+void m_glReadPixels_lazy(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels)const{if(!this->m_glReadPixels)this->m_resolveOrThrow(1216);this->m_glReadPixels(x,y,width,height,format,type,pixels);}
+void m_glVertexAttribI3iv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI3iv)this->m_resolveOrThrow(1217);this->m_glVertexAttribI3iv(index,v);}
+void m_glSetFenceAPPLE_lazy(GLuint fence)const{if(!this->m_glSetFenceAPPLE)this->m_resolveOrThrow(1218);this->m_glSetFenceAPPLE(fence);}
+void m_glWeightsvARB_lazy(GLint size,const GLshort* weights)const{if(!this->m_glWeightsvARB)this->m_resolveOrThrow(1219);this->m_glWeightsvARB(size,weights);}
+void m_glShadeModel_lazy(GLenum mode)const{if(!this->m_glShadeModel)this->m_resolveOrThrow(1220);this->m_glShadeModel(mode);}
+void m_glTextureStorageMem3DMultisampleEXT_lazy(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{if(!this->m_glTextureStorageMem3DMultisampleEXT)this->m_resolveOrThrow(1221);this->m_glTextureStorageMem3DMultisampleEXT(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+void m_glMapGrid1d_lazy(GLint un,GLdouble u1,GLdouble u2)const{if(!this->m_glMapGrid1d)this->m_resolveOrThrow(1222);this->m_glMapGrid1d(un,u1,u2);}
+void m_glGetHistogramParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetHistogramParameterivEXT)this->m_resolveOrThrow(1223);this->m_glGetHistogramParameterivEXT(target,pname,params);}
+void m_glConservativeRasterParameteriNV_lazy(GLenum pname,GLint param)const{if(!this->m_glConservativeRasterParameteriNV)this->m_resolveOrThrow(1224);this->m_glConservativeRasterParameteriNV(pname,param);}
+void m_glClearNamedBufferData_lazy(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearNamedBufferData)this->m_resolveOrThrow(1225);this->m_glClearNamedBufferData(buffer,internalformat,format,type,data);}
+void m_glClearDepthf_lazy(GLfloat d)const{if(!this->m_glClearDepthf)this->m_resolveOrThrow(1226);this->m_glClearDepthf(d);}
+void m_glCreatePerfQueryINTEL_lazy(GLuint queryId,GLuint* queryHandle)const{if(!this->m_glCreatePerfQueryINTEL)this->m_resolveOrThrow(1227);this->m_glCreatePerfQueryINTEL(queryId,queryHandle);}
+void m_glFogCoordfEXT_lazy(GLfloat coord)const{if(!this->m_glFogCoordfEXT)this->m_resolveOrThrow(1228);this->m_glFogCoordfEXT(coord);}
+void m_glVertexAttrib2dARB_lazy(GLuint index,GLdouble x,GLdouble y)const{if(!this->m_glVertexAttrib2dARB)this->m_resolveOrThrow(1229);this->m_glVertexAttrib2dARB(index,x,y);}
+void m_glMultiTexCoord4dARB_lazy(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{if(!this->m_glMultiTexCoord4dARB)this->m_resolveOrThrow(1230);this->m_glMultiTexCoord4dARB(target,s,t,r,q);}
+void m_glReadnPixelsARB_lazy(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{if(!this->m_glReadnPixelsARB)this->m_resolveOrThrow(1231);this->m_glReadnPixelsARB(x,y,width,height,format,type,bufSize,data);}
+void m_glMultiTexBufferEXT_lazy(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer)const{if(!this->m_glMultiTexBufferEXT)this->m_resolveOrThrow(1232);this->m_glMultiTexBufferEXT(texunit,target,internalformat,buffer);}
+void m_glWindowPos4dvMESA_lazy(const GLdouble* v)const{if(!this->m_glWindowPos4dvMESA)this->m_resolveOrThrow(1233);this->m_glWindowPos4dvMESA(v);}
+void m_glInvalidateNamedFramebufferData_lazy(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments)const{if(!this->m_glInvalidateNamedFramebufferData)this->m_resolveOrThrow(1234);this->m_glInvalidateNamedFramebufferData(framebuffer,numAttachments,attachments);}
+void m_glSecondaryColorPointerListIBM_lazy(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glSecondaryColorPointerListIBM)this->m_resolveOrThrow(1235);this->m_glSecondaryColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+void m_glRectiv_lazy(const GLint* v1,const GLint* v2)const{if(!this->m_glRectiv)this->m_resolveOrThrow(1236);this->m_glRectiv(v1,v2);}
+void m_glColorP4ui_lazy(GLenum type,GLuint color)const{if(!this->m_glColorP4ui)this->m_resolveOrThrow(1237);this->m_glColorP4ui(type,color);}
+void m_glUseProgramStages_lazy(GLuint pipeline,GLbitfield stages,GLuint program)const{if(!this->m_glUseProgramStages)this->m_resolveOrThrow(1238);this->m_glUseProgramStages(pipeline,stages,program);}
+void m_glRasterPos3dv_lazy(const GLdouble* v)const{if(!this->m_glRasterPos3dv)this->m_resolveOrThrow(1239);this->m_glRasterPos3dv(v);}
+void m_glPathTexGenNV_lazy(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs)const{if(!this->m_glPathTexGenNV)this->m_resolveOrThrow(1240);this->m_glPathTexGenNV(texCoordSet,genMode,components,coeffs);}
+void m_glVertexBlendEnviATI_lazy(GLenum pname,GLint param)const{if(!this->m_glVertexBlendEnviATI)this->m_resolveOrThrow(1241);this->m_glVertexBlendEnviATI(pname,param);}
+void m_glUniform3i64ARB_lazy(GLint location,GLint64 x,GLint64 y,GLint64 z)const{if(!this->m_glUniform3i64ARB)this->m_resolveOrThrow(1242);this->m_glUniform3i64ARB(location,x,y,z);}
+void m_glLoadMatrixf_lazy(const GLfloat* m)const{if(!this->m_glLoadMatrixf)this->m_resolveOrThrow(1243);this->m_glLoadMatrixf(m);}
+void m_glProgramUniform2dEXT_lazy(GLuint program,GLint location,GLdouble x,GLdouble y)const{if(!this->m_glProgramUniform2dEXT)this->m_resolveOrThrow(1244);this->m_glProgramUniform2dEXT(program,location,x,y);}
+void m_glVertexAttribI4iv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI4iv)this->m_resolveOrThrow(1245);this->m_glVertexAttribI4iv(index,v);}
+void m_glNamedFramebufferDrawBuffer_lazy(GLuint framebuffer,GLenum buf)const{if(!this->m_glNamedFramebufferDrawBuffer)this->m_resolveOrThrow(1246);this->m_glNamedFramebufferDrawBuffer(framebuffer,buf);}
+void m_glColor4ubv_lazy(const GLubyte* v)const{if(!this->m_glColor4ubv)this->m_resolveOrThrow(1247);this->m_glColor4ubv(v);}
+void m_glColor3hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glColor3hvNV)this->m_resolveOrThrow(1248);this->m_glColor3hvNV(v);}
+void m_glGetMapAttribParameterfvNV_lazy(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetMapAttribParameterfvNV)this->m_resolveOrThrow(1249);this->m_glGetMapAttribParameterfvNV(target,index,pname,params);}
+void m_glGetBufferSubData_lazy(GLenum target,GLintptr offset,GLsizeiptr size,void* data)const{if(!this->m_glGetBufferSubData)this->m_resolveOrThrow(1250);this->m_glGetBufferSubData(target,offset,size,data);}
+void m_glGetVertexAttribLdv_lazy(GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetVertexAttribLdv)this->m_resolveOrThrow(1251);this->m_glGetVertexAttribLdv(index,pname,params);}
+void m_glGetnUniformuiv_lazy(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{if(!this->m_glGetnUniformuiv)this->m_resolveOrThrow(1252);this->m_glGetnUniformuiv(program,location,bufSize,params);}
+void m_glGetUniformui64vNV_lazy(GLuint program,GLint location,GLuint64EXT* params)const{if(!this->m_glGetUniformui64vNV)this->m_resolveOrThrow(1253);this->m_glGetUniformui64vNV(program,location,params);}
+void m_glNamedRenderbufferStorageEXT_lazy(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glNamedRenderbufferStorageEXT)this->m_resolveOrThrow(1254);this->m_glNamedRenderbufferStorageEXT(renderbuffer,internalformat,width,height);}
+void m_glVertexAttrib3dNV_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexAttrib3dNV)this->m_resolveOrThrow(1255);this->m_glVertexAttrib3dNV(index,x,y,z);}
+void m_glTextureStorage1DEXT_lazy(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{if(!this->m_glTextureStorage1DEXT)this->m_resolveOrThrow(1256);this->m_glTextureStorage1DEXT(texture,target,levels,internalformat,width);}
+void m_glPixelTexGenParameteriSGIS_lazy(GLenum pname,GLint param)const{if(!this->m_glPixelTexGenParameteriSGIS)this->m_resolveOrThrow(1257);this->m_glPixelTexGenParameteriSGIS(pname,param);}
+void m_glColorTableEXT_lazy(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table)const{if(!this->m_glColorTableEXT)this->m_resolveOrThrow(1258);this->m_glColorTableEXT(target,internalFormat,width,format,type,table);}
+void m_glGenBuffers_lazy(GLsizei n,GLuint* buffers)const{if(!this->m_glGenBuffers)this->m_resolveOrThrow(1259);this->m_glGenBuffers(n,buffers);}
+void m_glMultiTexCoord3xvOES_lazy(GLenum texture,const GLfixed* coords)const{if(!this->m_glMultiTexCoord3xvOES)this->m_resolveOrThrow(1260);this->m_glMultiTexCoord3xvOES(texture,coords);}
+void m_glExecuteProgramNV_lazy(GLenum target,GLuint id,const GLfloat* params)const{if(!this->m_glExecuteProgramNV)this->m_resolveOrThrow(1261);this->m_glExecuteProgramNV(target,id,params);}
+void m_glVariantArrayObjectATI_lazy(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{if(!this->m_glVariantArrayObjectATI)this->m_resolveOrThrow(1262);this->m_glVariantArrayObjectATI(id,type,stride,buffer,offset);}
+void m_glColor3xvOES_lazy(const GLfixed* components)const{if(!this->m_glColor3xvOES)this->m_resolveOrThrow(1263);this->m_glColor3xvOES(components);}
+void m_glGetnConvolutionFilterARB_lazy(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{if(!this->m_glGetnConvolutionFilterARB)this->m_resolveOrThrow(1264);this->m_glGetnConvolutionFilterARB(target,format,type,bufSize,image);}
+void m_glNormalFormatNV_lazy(GLenum type,GLsizei stride)const{if(!this->m_glNormalFormatNV)this->m_resolveOrThrow(1265);this->m_glNormalFormatNV(type,stride);}
+void m_glGetInvariantFloatvEXT_lazy(GLuint id,GLenum value,GLfloat* data)const{if(!this->m_glGetInvariantFloatvEXT)this->m_resolveOrThrow(1266);this->m_glGetInvariantFloatvEXT(id,value,data);}
+void m_glClearNamedFramebufferiv_lazy(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value)const{if(!this->m_glClearNamedFramebufferiv)this->m_resolveOrThrow(1267);this->m_glClearNamedFramebufferiv(framebuffer,buffer,drawbuffer,value);}
+void m_glTexImage3D_lazy(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexImage3D)this->m_resolveOrThrow(1268);this->m_glTexImage3D(target,level,internalFormat,width,height,depth,border,format,type,pixels);}
+void m_glGenSamplers_lazy(GLsizei count,GLuint* samplers)const{if(!this->m_glGenSamplers)this->m_resolveOrThrow(1269);this->m_glGenSamplers(count,samplers);}
+GLboolean m_glIsFramebuffer_lazy(GLuint framebuffer)const{if(!this->m_glIsFramebuffer)this->m_resolveOrThrow(1270);return this->m_glIsFramebuffer(framebuffer);}
+void m_glProgramUniform3dvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform3dvEXT)this->m_resolveOrThrow(1271);this->m_glProgramUniform3dvEXT(program,location,count,value);}
+void m_glGetVertexAttribfvNV_lazy(GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetVertexAttribfvNV)this->m_resolveOrThrow(1272);this->m_glGetVertexAttribfvNV(index,pname,params);}
+void m_glDrawRangeElementArrayAPPLE_lazy(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count)const{if(!this->m_glDrawRangeElementArrayAPPLE)this->m_resolveOrThrow(1273);this->m_glDrawRangeElementArrayAPPLE(mode,start,end,first,count);}
+void m_glUniform3i64NV_lazy(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{if(!this->m_glUniform3i64NV)this->m_resolveOrThrow(1274);this->m_glUniform3i64NV(location,x,y,z);}
+void m_glMatrixPopEXT_lazy(GLenum mode)const{if(!this->m_glMatrixPopEXT)this->m_resolveOrThrow(1275);this->m_glMatrixPopEXT(mode);}
+void m_glVertexStream1sATI_lazy(GLenum stream,GLshort x)const{if(!this->m_glVertexStream1sATI)this->m_resolveOrThrow(1276);this->m_glVertexStream1sATI(stream,x);}
+void m_glGetnPixelMapuivARB_lazy(GLenum map,GLsizei bufSize,GLuint* values)const{if(!this->m_glGetnPixelMapuivARB)this->m_resolveOrThrow(1277);this->m_glGetnPixelMapuivARB(map,bufSize,values);}
+void m_glMultiTexEnviEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLint param)const{if(!this->m_glMultiTexEnviEXT)this->m_resolveOrThrow(1278);this->m_glMultiTexEnviEXT(texunit,target,pname,param);}
+void m_glVertexAttribI2iEXT_lazy(GLuint index,GLint x,GLint y)const{if(!this->m_glVertexAttribI2iEXT)this->m_resolveOrThrow(1279);this->m_glVertexAttribI2iEXT(index,x,y);}
+void m_glProgramParameter4fvNV_lazy(GLenum target,GLuint index,const GLfloat* v)const{if(!this->m_glProgramParameter4fvNV)this->m_resolveOrThrow(1280);this->m_glProgramParameter4fvNV(target,index,v);}
+void m_glWaitSemaphoreEXT_lazy(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* srcLayouts)const{if(!this->m_glWaitSemaphoreEXT)this->m_resolveOrThrow(1281);this->m_glWaitSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);}
+void m_glNamedFramebufferSampleLocationsfvNV_lazy(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{if(!this->m_glNamedFramebufferSampleLocationsfvNV)this->m_resolveOrThrow(1282);this->m_glNamedFramebufferSampleLocationsfvNV(framebuffer,start,count,v);}
+void m_glTexCoordP4uiv_lazy(GLenum type,const GLuint* coords)const{if(!this->m_glTexCoordP4uiv)this->m_resolveOrThrow(1283);this->m_glTexCoordP4uiv(type,coords);}
+void m_glRectxvOES_lazy(const GLfixed* v1,const GLfixed* v2)const{if(!this->m_glRectxvOES)this->m_resolveOrThrow(1284);this->m_glRectxvOES(v1,v2);}
+void m_glGetVariantIntegervEXT_lazy(GLuint id,GLenum value,GLint* data)const{if(!this->m_glGetVariantIntegervEXT)this->m_resolveOrThrow(1285);this->m_glGetVariantIntegervEXT(id,value,data);}
+void m_glDeleteLists_lazy(GLuint list,GLsizei range)const{if(!this->m_glDeleteLists)this->m_resolveOrThrow(1286);this->m_glDeleteLists(list,range);}
+void m_glTexGendv_lazy(GLenum coord,GLenum pname,const GLdouble* params)const{if(!this->m_glTexGendv)this->m_resolveOrThrow(1287);this->m_glTexGendv(coord,pname,params);}
+void m_glVertexP2uiv_lazy(GLenum type,const GLuint* value)const{if(!this->m_glVertexP2uiv)this->m_resolveOrThrow(1288);this->m_glVertexP2uiv(type,value);}
+void m_glGetPerfMonitorGroupsAMD_lazy(GLint* numGroups,GLsizei groupsSize,GLuint* groups)const{if(!this->m_glGetPerfMonitorGroupsAMD)this->m_resolveOrThrow(1289);this->m_glGetPerfMonitorGroupsAMD(numGroups,groupsSize,groups);}
+void m_glMultTransposeMatrixfARB_lazy(const GLfloat* m)const{if(!this->m_glMultTransposeMatrixfARB)this->m_resolveOrThrow(1290);this->m_glMultTransposeMatrixfARB(m);}
+void m_glVertexAttribI2ivEXT_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI2ivEXT)this->m_resolveOrThrow(1291);this->m_glVertexAttribI2ivEXT(index,v);}
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{if(!this->m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)this->m_resolveOrThrow(1292);this->m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc,c,n,v);}
+void m_glDeleteStatesNV_lazy(GLsizei n,const GLuint* states)const{if(!this->m_glDeleteStatesNV)this->m_resolveOrThrow(1293);this->m_glDeleteStatesNV(n,states);}
+void m_glGetBufferParameteri64v_lazy(GLenum target,GLenum pname,GLint64* params)const{if(!this->m_glGetBufferParameteri64v)this->m_resolveOrThrow(1294);this->m_glGetBufferParameteri64v(target,pname,params);}
+void m_glProgramUniform4dv_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform4dv)this->m_resolveOrThrow(1295);this->m_glProgramUniform4dv(program,location,count,value);}
+void m_glEdgeFlagPointerEXT_lazy(GLsizei stride,GLsizei count,const GLboolean* pointer)const{if(!this->m_glEdgeFlagPointerEXT)this->m_resolveOrThrow(1296);this->m_glEdgeFlagPointerEXT(stride,count,pointer);}
+void m_glVideoCaptureStreamParameterivNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params)const{if(!this->m_glVideoCaptureStreamParameterivNV)this->m_resolveOrThrow(1297);this->m_glVideoCaptureStreamParameterivNV(video_capture_slot,stream,pname,params);}
+void m_glVertexStream4iATI_lazy(GLenum stream,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glVertexStream4iATI)this->m_resolveOrThrow(1298);this->m_glVertexStream4iATI(stream,x,y,z,w);}
+void m_glVDPAUFiniNV_lazy()const{if(!this->m_glVDPAUFiniNV)this->m_resolveOrThrow(1299);this->m_glVDPAUFiniNV();}
+void m_glMakeBufferNonResidentNV_lazy(GLenum target)const{if(!this->m_glMakeBufferNonResidentNV)this->m_resolveOrThrow(1300);this->m_glMakeBufferNonResidentNV(target);}
+void m_glUniform1ui64ARB_lazy(GLint location,GLuint64 x)const{if(!this->m_glUniform1ui64ARB)this->m_resolveOrThrow(1301);this->m_glUniform1ui64ARB(location,x);}
+void m_glStencilStrokePathNV_lazy(GLuint path,GLint reference,GLuint mask)const{if(!this->m_glStencilStrokePathNV)this->m_resolveOrThrow(1302);this->m_glStencilStrokePathNV(path,reference,mask);}
+void m_glVariantuivEXT_lazy(GLuint id,const GLuint* addr)const{if(!this->m_glVariantuivEXT)this->m_resolveOrThrow(1303);this->m_glVariantuivEXT(id,addr);}
+void m_glCopyTexSubImage3DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTexSubImage3DEXT)this->m_resolveOrThrow(1304);this->m_glCopyTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+void m_glSpriteParameteriSGIX_lazy(GLenum pname,GLint param)const{if(!this->m_glSpriteParameteriSGIX)this->m_resolveOrThrow(1305);this->m_glSpriteParameteriSGIX(pname,param);}
+void m_glMultiTexCoord1sARB_lazy(GLenum target,GLshort s)const{if(!this->m_glMultiTexCoord1sARB)this->m_resolveOrThrow(1306);this->m_glMultiTexCoord1sARB(target,s);}
+void m_glConvolutionParameterfv_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glConvolutionParameterfv)this->m_resolveOrThrow(1307);this->m_glConvolutionParameterfv(target,pname,params);}
+void m_glMakeTextureHandleResidentNV_lazy(GLuint64 handle)const{if(!this->m_glMakeTextureHandleResidentNV)this->m_resolveOrThrow(1308);this->m_glMakeTextureHandleResidentNV(handle);}
+void m_glMultMatrixxOES_lazy(const GLfixed* m)const{if(!this->m_glMultMatrixxOES)this->m_resolveOrThrow(1309);this->m_glMultMatrixxOES(m);}
+void m_glTextureNormalEXT_lazy(GLenum mode)const{if(!this->m_glTextureNormalEXT)this->m_resolveOrThrow(1310);this->m_glTextureNormalEXT(mode);}
+void m_glGetQueryivARB_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetQueryivARB)this->m_resolveOrThrow(1311);this->m_glGetQueryivARB(target,pname,params);}
+void m_glCompressedMultiTexImage3DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexImage3DEXT)this->m_resolveOrThrow(1312);this->m_glCompressedMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+GLint m_glGetInstrumentsSGIX_lazy()const{if(!this->m_glGetInstrumentsSGIX)this->m_resolveOrThrow(1313);return this->m_glGetInstrumentsSGIX();}
+void m_glProgramUniformMatrix4x3fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4x3fvEXT)this->m_resolveOrThrow(1314);this->m_glProgramUniformMatrix4x3fvEXT(program,location,count,transpose,value);}
+void m_glPointParameterf_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPointParameterf)this->m_resolveOrThrow(1315);this->m_glPointParameterf(pname,param);}
+void m_glProgramUniform3dEXT_lazy(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glProgramUniform3dEXT)this->m_resolveOrThrow(1316);this->m_glProgramUniform3dEXT(program,location,x,y,z);}
+void m_glMultiTexCoord2hNV_lazy(GLenum target,GLhalfNV s,GLhalfNV t)const{if(!this->m_glMultiTexCoord2hNV)this->m_resolveOrThrow(1317);this->m_glMultiTexCoord2hNV(target,s,t);}
+void m_glGetConvolutionFilterEXT_lazy(GLenum target,GLenum format,GLenum type,void* image)const{if(!this->m_glGetConvolutionFilterEXT)this->m_resolveOrThrow(1318);this->m_glGetConvolutionFilterEXT(target,format,type,image);}
+void m_glVertexAttrib2hNV_lazy(GLuint index,GLhalfNV x,GLhalfNV y)const{if(!this->m_glVertexAttrib2hNV)this->m_resolveOrThrow(1319);this->m_glVertexAttrib2hNV(index,x,y);}
+void m_glCurrentPaletteMatrixARB_lazy(GLint index)const{if(!this->m_glCurrentPaletteMatrixARB)this->m_resolveOrThrow(1320);this->m_glCurrentPaletteMatrixARB(index);}
+void m_glFogxvOES_lazy(GLenum pname,const GLfixed* param)const{if(!this->m_glFogxvOES)this->m_resolveOrThrow(1321);this->m_glFogxvOES(pname,param);}
+void m_glCreateRenderbuffers_lazy(GLsizei n,GLuint* renderbuffers)const{if(!this->m_glCreateRenderbuffers)this->m_resolveOrThrow(1322);this->m_glCreateRenderbuffers(n,renderbuffers);}
+void m_glVertexAttrib4Nusv_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttrib4Nusv)this->m_resolveOrThrow(1323);this->m_glVertexAttrib4Nusv(index,v);}
+void m_glCombinerInputNV_lazy(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{if(!this->m_glCombinerInputNV)this->m_resolveOrThrow(1324);this->m_glCombinerInputNV(stage,portion,variable,input,mapping,componentUsage);}
+void m_glDepthFunc_lazy(GLenum func)const{if(!this->m_glDepthFunc)this->m_resolveOrThrow(1325);this->m_glDepthFunc(func);}
+void m_glWindowPos4fMESA_lazy(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glWindowPos4fMESA)this->m_resolveOrThrow(1326);this->m_glWindowPos4fMESA(x,y,z,w);}
+void m_glEnableClientStateIndexedEXT_lazy(GLenum array,GLuint index)const{if(!this->m_glEnableClientStateIndexedEXT)this->m_resolveOrThrow(1327);this->m_glEnableClientStateIndexedEXT(array,index);}
+void m_glTexCoord4iv_lazy(const GLint* v)const{if(!this->m_glTexCoord4iv)this->m_resolveOrThrow(1328);this->m_glTexCoord4iv(v);}
+void m_glProgramUniform4i64ARB_lazy(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{if(!this->m_glProgramUniform4i64ARB)this->m_resolveOrThrow(1329);this->m_glProgramUniform4i64ARB(program,location,x,y,z,w);}
+void m_glBlendFunci_lazy(GLuint buf,GLenum src,GLenum dst)const{if(!this->m_glBlendFunci)this->m_resolveOrThrow(1330);this->m_glBlendFunci(buf,src,dst);}
+void m_glResolveDepthValuesNV_lazy()const{if(!this->m_glResolveDepthValuesNV)this->m_resolveOrThrow(1331);this->m_glResolveDepthValuesNV();}
+void m_glTextureColorMaskSGIS_lazy(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{if(!this->m_glTextureColorMaskSGIS)this->m_resolveOrThrow(1332);this->m_glTextureColorMaskSGIS(red,green,blue,alpha);}
+GLuint m_glCreateShaderProgramEXT_lazy(GLenum type,const GLchar* string)const{if(!this->m_glCreateShaderProgramEXT)this->m_resolveOrThrow(1333);return this->m_glCreateShaderProgramEXT(type,string);}
+void m_glBufferStorage_lazy(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags)const{if(!this->m_glBufferStorage)this->m_resolveOrThrow(1334);this->m_glBufferStorage(target,size,data,flags);}
+void m_glMakeNamedBufferNonResidentNV_lazy(GLuint buffer)const{if(!this->m_glMakeNamedBufferNonResidentNV)this->m_resolveOrThrow(1335);this->m_glMakeNamedBufferNonResidentNV(buffer);}
+void m_glRenderbufferStorageMultisampleEXT_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glRenderbufferStorageMultisampleEXT)this->m_resolveOrThrow(1336);this->m_glRenderbufferStorageMultisampleEXT(target,samples,internalformat,width,height);}
+void m_glGetFloati_v_lazy(GLenum target,GLuint index,GLfloat* data)const{if(!this->m_glGetFloati_v)this->m_resolveOrThrow(1337);this->m_glGetFloati_v(target,index,data);}
+void m_glUniform2ui64ARB_lazy(GLint location,GLuint64 x,GLuint64 y)const{if(!this->m_glUniform2ui64ARB)this->m_resolveOrThrow(1338);this->m_glUniform2ui64ARB(location,x,y);}
+void m_glVertex3fv_lazy(const GLfloat* v)const{if(!this->m_glVertex3fv)this->m_resolveOrThrow(1339);this->m_glVertex3fv(v);}
+GLint m_glGetUniformLocation_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetUniformLocation)this->m_resolveOrThrow(1340);return this->m_glGetUniformLocation(program,name);}
+void m_glVertexStream1svATI_lazy(GLenum stream,const GLshort* coords)const{if(!this->m_glVertexStream1svATI)this->m_resolveOrThrow(1341);this->m_glVertexStream1svATI(stream,coords);}
+void m_glVertexStream3fATI_lazy(GLenum stream,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glVertexStream3fATI)this->m_resolveOrThrow(1342);this->m_glVertexStream3fATI(stream,x,y,z);}
+void m_glNamedFramebufferDrawBuffers_lazy(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{if(!this->m_glNamedFramebufferDrawBuffers)this->m_resolveOrThrow(1343);this->m_glNamedFramebufferDrawBuffers(framebuffer,n,bufs);}
+void m_glUniform2ui64vNV_lazy(GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glUniform2ui64vNV)this->m_resolveOrThrow(1344);this->m_glUniform2ui64vNV(location,count,value);}
+void m_glTexCoordPointervINTEL_lazy(GLint size,GLenum type,const void** pointer)const{if(!this->m_glTexCoordPointervINTEL)this->m_resolveOrThrow(1345);this->m_glTexCoordPointervINTEL(size,type,pointer);}
+void m_glUniform4fv_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform4fv)this->m_resolveOrThrow(1346);this->m_glUniform4fv(location,count,value);}
+void m_glNormalPointerEXT_lazy(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{if(!this->m_glNormalPointerEXT)this->m_resolveOrThrow(1347);this->m_glNormalPointerEXT(type,stride,count,pointer);}
+void m_glVertexAttrib4hNV_lazy(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{if(!this->m_glVertexAttrib4hNV)this->m_resolveOrThrow(1348);this->m_glVertexAttrib4hNV(index,x,y,z,w);}
+void m_glNormal3f_lazy(GLfloat nx,GLfloat ny,GLfloat nz)const{if(!this->m_glNormal3f)this->m_resolveOrThrow(1349);this->m_glNormal3f(nx,ny,nz);}
+void m_glVertexStream2iATI_lazy(GLenum stream,GLint x,GLint y)const{if(!this->m_glVertexStream2iATI)this->m_resolveOrThrow(1350);this->m_glVertexStream2iATI(stream,x,y);}
+void m_glVertexAttribP4uiv_lazy(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{if(!this->m_glVertexAttribP4uiv)this->m_resolveOrThrow(1351);this->m_glVertexAttribP4uiv(index,type,normalized,value);}
+void m_glCompressedTextureSubImage3D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTextureSubImage3D)this->m_resolveOrThrow(1352);this->m_glCompressedTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+void m_glAsyncMarkerSGIX_lazy(GLuint marker)const{if(!this->m_glAsyncMarkerSGIX)this->m_resolveOrThrow(1353);this->m_glAsyncMarkerSGIX(marker);}
+void m_glTextureStorageSparseAMD_lazy(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{if(!this->m_glTextureStorageSparseAMD)this->m_resolveOrThrow(1354);this->m_glTextureStorageSparseAMD(texture,target,internalFormat,width,height,depth,layers,flags);}
+void m_glGetConvolutionParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetConvolutionParameterivEXT)this->m_resolveOrThrow(1355);this->m_glGetConvolutionParameterivEXT(target,pname,params);}
+void m_glEndPerfQueryINTEL_lazy(GLuint queryHandle)const{if(!this->m_glEndPerfQueryINTEL)this->m_resolveOrThrow(1356);this->m_glEndPerfQueryINTEL(queryHandle);}
+void m_glFragmentLightModeliSGIX_lazy(GLenum pname,GLint param)const{if(!this->m_glFragmentLightModeliSGIX)this->m_resolveOrThrow(1357);this->m_glFragmentLightModeliSGIX(pname,param);}
+void m_glPrioritizeTexturesEXT_lazy(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{if(!this->m_glPrioritizeTexturesEXT)this->m_resolveOrThrow(1358);this->m_glPrioritizeTexturesEXT(n,textures,priorities);}
+void m_glEndConditionalRender_lazy()const{if(!this->m_glEndConditionalRender)this->m_resolveOrThrow(1359);this->m_glEndConditionalRender();}
+void m_glEnableClientState_lazy(GLenum cap)const{if(!this->m_glEnableClientState)this->m_resolveOrThrow(1360);this->m_glEnableClientState(cap);}
+void m_glResetHistogram_lazy(GLenum target)const{if(!this->m_glResetHistogram)this->m_resolveOrThrow(1361);this->m_glResetHistogram(target);}
+void m_glGetOcclusionQueryivNV_lazy(GLuint id,GLenum pname,GLint* params)const{if(!this->m_glGetOcclusionQueryivNV)this->m_resolveOrThrow(1362);this->m_glGetOcclusionQueryivNV(id,pname,params);}
+void m_glUniform1uiEXT_lazy(GLint location,GLuint v0)const{if(!this->m_glUniform1uiEXT)this->m_resolveOrThrow(1363);this->m_glUniform1uiEXT(location,v0);}
+void m_glMultiTexCoord2sv_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord2sv)this->m_resolveOrThrow(1364);this->m_glMultiTexCoord2sv(target,v);}
+void m_glTexSubImage2DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexSubImage2DEXT)this->m_resolveOrThrow(1365);this->m_glTexSubImage2DEXT(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+void m_glProgramUniform2uiv_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform2uiv)this->m_resolveOrThrow(1366);this->m_glProgramUniform2uiv(program,location,count,value);}
+void m_glMultiTexCoord2iARB_lazy(GLenum target,GLint s,GLint t)const{if(!this->m_glMultiTexCoord2iARB)this->m_resolveOrThrow(1367);this->m_glMultiTexCoord2iARB(target,s,t);}
+void m_glGetQueryObjectuiv_lazy(GLuint id,GLenum pname,GLuint* params)const{if(!this->m_glGetQueryObjectuiv)this->m_resolveOrThrow(1368);this->m_glGetQueryObjectuiv(id,pname,params);}
+void m_glGenerateMultiTexMipmapEXT_lazy(GLenum texunit,GLenum target)const{if(!this->m_glGenerateMultiTexMipmapEXT)this->m_resolveOrThrow(1369);this->m_glGenerateMultiTexMipmapEXT(texunit,target);}
+void m_glVertexAttrib4iv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttrib4iv)this->m_resolveOrThrow(1370);this->m_glVertexAttrib4iv(index,v);}
+void m_glWindowPos3dvMESA_lazy(const GLdouble* v)const{if(!this->m_glWindowPos3dvMESA)this->m_resolveOrThrow(1371);this->m_glWindowPos3dvMESA(v);}
+void m_glLabelObjectEXT_lazy(GLenum type,GLuint object,GLsizei length,const GLchar* label)const{if(!this->m_glLabelObjectEXT)this->m_resolveOrThrow(1372);this->m_glLabelObjectEXT(type,object,length,label);}
+void m_glProgramUniform1uiv_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform1uiv)this->m_resolveOrThrow(1373);this->m_glProgramUniform1uiv(program,location,count,value);}
+void m_glFramebufferTexture_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level)const{if(!this->m_glFramebufferTexture)this->m_resolveOrThrow(1374);this->m_glFramebufferTexture(target,attachment,texture,level);}
+void m_glMultiTexEnvfEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glMultiTexEnvfEXT)this->m_resolveOrThrow(1375);this->m_glMultiTexEnvfEXT(texunit,target,pname,param);}
+void m_glGetTexGendv_lazy(GLenum coord,GLenum pname,GLdouble* params)const{if(!this->m_glGetTexGendv)this->m_resolveOrThrow(1376);this->m_glGetTexGendv(coord,pname,params);}
+void m_glVertex4xOES_lazy(GLfixed x,GLfixed y,GLfixed z)const{if(!this->m_glVertex4xOES)this->m_resolveOrThrow(1377);this->m_glVertex4xOES(x,y,z);}
+void m_glVertexAttribI2uivEXT_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI2uivEXT)this->m_resolveOrThrow(1378);this->m_glVertexAttribI2uivEXT(index,v);}
+void m_glNamedProgramLocalParameter4fvEXT_lazy(GLuint program,GLenum target,GLuint index,const GLfloat* params)const{if(!this->m_glNamedProgramLocalParameter4fvEXT)this->m_resolveOrThrow(1379);this->m_glNamedProgramLocalParameter4fvEXT(program,target,index,params);}
+void m_glColor3usv_lazy(const GLushort* v)const{if(!this->m_glColor3usv)this->m_resolveOrThrow(1380);this->m_glColor3usv(v);}
+void m_glGetPixelTransformParameterfvEXT_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetPixelTransformParameterfvEXT)this->m_resolveOrThrow(1381);this->m_glGetPixelTransformParameterfvEXT(target,pname,params);}
+void m_glIndexxvOES_lazy(const GLfixed* component)const{if(!this->m_glIndexxvOES)this->m_resolveOrThrow(1382);this->m_glIndexxvOES(component);}
+void m_glDepthMask_lazy(GLboolean flag)const{if(!this->m_glDepthMask)this->m_resolveOrThrow(1383);this->m_glDepthMask(flag);}
+void m_glProgramUniformMatrix2x4fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2x4fv)this->m_resolveOrThrow(1384);this->m_glProgramUniformMatrix2x4fv(program,location,count,transpose,value);}
+GLboolean m_glAreProgramsResidentNV_lazy(GLsizei n,const GLuint* programs,GLboolean* residences)const{if(!this->m_glAreProgramsResidentNV)this->m_resolveOrThrow(1385);return this->m_glAreProgramsResidentNV(n,programs,residences);}
+void m_glColorTable_lazy(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table)const{if(!this->m_glColorTable)this->m_resolveOrThrow(1386);this->m_glColorTable(target,internalformat,width,format,type,table);}
+void m_glBeginQueryIndexed_lazy(GLenum target,GLuint index,GLuint id)const{if(!this->m_glBeginQueryIndexed)this->m_resolveOrThrow(1387);this->m_glBeginQueryIndexed(target,index,id);}
+void m_glVertexStream1dvATI_lazy(GLenum stream,const GLdouble* coords)const{if(!this->m_glVertexStream1dvATI)this->m_resolveOrThrow(1388);this->m_glVertexStream1dvATI(stream,coords);}
+void m_glGetMultiTexEnvfvEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetMultiTexEnvfvEXT)this->m_resolveOrThrow(1389);this->m_glGetMultiTexEnvfvEXT(texunit,target,pname,params);}
+void m_glDeleteFencesNV_lazy(GLsizei n,const GLuint* fences)const{if(!this->m_glDeleteFencesNV)this->m_resolveOrThrow(1390);this->m_glDeleteFencesNV(n,fences);}
+void m_glVertexAttribs1dvNV_lazy(GLuint index,GLsizei count,const GLdouble* v)const{if(!this->m_glVertexAttribs1dvNV)this->m_resolveOrThrow(1391);this->m_glVertexAttribs1dvNV(index,count,v);}
+void m_glBufferStorageExternalEXT_lazy(GLenum target,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{if(!this->m_glBufferStorageExternalEXT)this->m_resolveOrThrow(1392);this->m_glBufferStorageExternalEXT(target,offset,size,clientBuffer,flags);}
+void m_glVertexStream2sATI_lazy(GLenum stream,GLshort x,GLshort y)const{if(!this->m_glVertexStream2sATI)this->m_resolveOrThrow(1393);this->m_glVertexStream2sATI(stream,x,y);}
+void m_glGetnSeparableFilterARB_lazy(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{if(!this->m_glGetnSeparableFilterARB)this->m_resolveOrThrow(1394);this->m_glGetnSeparableFilterARB(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+void m_glProgramUniform2dv_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform2dv)this->m_resolveOrThrow(1395);this->m_glProgramUniform2dv(program,location,count,value);}
+void m_glActiveStencilFaceEXT_lazy(GLenum face)const{if(!this->m_glActiveStencilFaceEXT)this->m_resolveOrThrow(1396);this->m_glActiveStencilFaceEXT(face);}
+void m_glProgramUniform4dEXT_lazy(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glProgramUniform4dEXT)this->m_resolveOrThrow(1397);this->m_glProgramUniform4dEXT(program,location,x,y,z,w);}
+void m_glPointSizexOES_lazy(GLfixed size)const{if(!this->m_glPointSizexOES)this->m_resolveOrThrow(1398);this->m_glPointSizexOES(size);}
+void m_glRasterPos2sv_lazy(const GLshort* v)const{if(!this->m_glRasterPos2sv)this->m_resolveOrThrow(1399);this->m_glRasterPos2sv(v);}
+GLuint m_glBindParameterEXT_lazy(GLenum value)const{if(!this->m_glBindParameterEXT)this->m_resolveOrThrow(1400);return this->m_glBindParameterEXT(value);}
+void m_glTexCoord1sv_lazy(const GLshort* v)const{if(!this->m_glTexCoord1sv)this->m_resolveOrThrow(1401);this->m_glTexCoord1sv(v);}
+void m_glBlendParameteriNV_lazy(GLenum pname,GLint value)const{if(!this->m_glBlendParameteriNV)this->m_resolveOrThrow(1402);this->m_glBlendParameteriNV(pname,value);}
+void m_glNamedProgramLocalParameter4dvEXT_lazy(GLuint program,GLenum target,GLuint index,const GLdouble* params)const{if(!this->m_glNamedProgramLocalParameter4dvEXT)this->m_resolveOrThrow(1403);this->m_glNamedProgramLocalParameter4dvEXT(program,target,index,params);}
+void m_glProgramUniformHandleui64NV_lazy(GLuint program,GLint location,GLuint64 value)const{if(!this->m_glProgramUniformHandleui64NV)this->m_resolveOrThrow(1404);this->m_glProgramUniformHandleui64NV(program,location,value);}
+void m_glGetTextureParameterfvEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetTextureParameterfvEXT)this->m_resolveOrThrow(1405);this->m_glGetTextureParameterfvEXT(texture,target,pname,params);}
+void m_glGetPathMetricsNV_lazy(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics)const{if(!this->m_glGetPathMetricsNV)this->m_resolveOrThrow(1406);this->m_glGetPathMetricsNV(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);}
+void m_glVertex2i_lazy(GLint x,GLint y)const{if(!this->m_glVertex2i)this->m_resolveOrThrow(1407);this->m_glVertex2i(x,y);}
+void m_glNewList_lazy(GLuint list,GLenum mode)const{if(!this->m_glNewList)this->m_resolveOrThrow(1408);this->m_glNewList(list,mode);}
+void m_glMatrixLoad3x3fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixLoad3x3fNV)this->m_resolveOrThrow(1409);this->m_glMatrixLoad3x3fNV(matrixMode,m);}
+void m_glMultiTexCoord2fARB_lazy(GLenum target,GLfloat s,GLfloat t)const{if(!this->m_glMultiTexCoord2fARB)this->m_resolveOrThrow(1410);this->m_glMultiTexCoord2fARB(target,s,t);}
+void m_glWeightdvARB_lazy(GLint size,const GLdouble* weights)const{if(!this->m_glWeightdvARB)this->m_resolveOrThrow(1411);this->m_glWeightdvARB(size,weights);}
+GLboolean m_glIsTransformFeedbackNV_lazy(GLuint id)const{if(!this->m_glIsTransformFeedbackNV)this->m_resolveOrThrow(1412);return this->m_glIsTransformFeedbackNV(id);}
+void m_glVertexAttribDivisorARB_lazy(GLuint index,GLuint divisor)const{if(!this->m_glVertexAttribDivisorARB)this->m_resolveOrThrow(1413);this->m_glVertexAttribDivisorARB(index,divisor);}
+void m_glSecondaryColorP3uiv_lazy(GLenum type,const GLuint* color)const{if(!this->m_glSecondaryColorP3uiv)this->m_resolveOrThrow(1414);this->m_glSecondaryColorP3uiv(type,color);}
+void m_glGetnCompressedTexImageARB_lazy(GLenum target,GLint lod,GLsizei bufSize,void* img)const{if(!this->m_glGetnCompressedTexImageARB)this->m_resolveOrThrow(1415);this->m_glGetnCompressedTexImageARB(target,lod,bufSize,img);}
+void m_glGetIntegerv_lazy(GLenum pname,GLint* params)const{if(!this->m_glGetIntegerv)this->m_resolveOrThrow(1416);this->m_glGetIntegerv(pname,params);}
+void m_glMatrixLoaddEXT_lazy(GLenum mode,const GLdouble* m)const{if(!this->m_glMatrixLoaddEXT)this->m_resolveOrThrow(1417);this->m_glMatrixLoaddEXT(mode,m);}
+GLfloat m_glGetPathLengthNV_lazy(GLuint path,GLsizei startSegment,GLsizei numSegments)const{if(!this->m_glGetPathLengthNV)this->m_resolveOrThrow(1418);return this->m_glGetPathLengthNV(path,startSegment,numSegments);}
+void m_glProgramUniformMatrix3dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3dv)this->m_resolveOrThrow(1419);this->m_glProgramUniformMatrix3dv(program,location,count,transpose,value);}
+void m_glUniform4i64NV_lazy(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{if(!this->m_glUniform4i64NV)this->m_resolveOrThrow(1420);this->m_glUniform4i64NV(location,x,y,z,w);}
+void m_glGetHistogramEXT_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{if(!this->m_glGetHistogramEXT)this->m_resolveOrThrow(1421);this->m_glGetHistogramEXT(target,reset,format,type,values);}
+void m_glVertexAttrib4NuivARB_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttrib4NuivARB)this->m_resolveOrThrow(1422);this->m_glVertexAttrib4NuivARB(index,v);}
+void m_glMapGrid2xOES_lazy(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2)const{if(!this->m_glMapGrid2xOES)this->m_resolveOrThrow(1423);this->m_glMapGrid2xOES(n,u1,u2,v1,v2);}
+void m_glTexImage2D_lazy(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexImage2D)this->m_resolveOrThrow(1424);this->m_glTexImage2D(target,level,internalFormat,width,height,border,format,type,pixels);}
+void m_glWindowPos2fvARB_lazy(const GLfloat* v)const{if(!this->m_glWindowPos2fvARB)this->m_resolveOrThrow(1425);this->m_glWindowPos2fvARB(v);}
+void m_glEnableIndexedEXT_lazy(GLenum target,GLuint index)const{if(!this->m_glEnableIndexedEXT)this->m_resolveOrThrow(1426);this->m_glEnableIndexedEXT(target,index);}
+void m_glTexCoord1bvOES_lazy(const GLbyte* coords)const{if(!this->m_glTexCoord1bvOES)this->m_resolveOrThrow(1427);this->m_glTexCoord1bvOES(coords);}
+void m_glDrawPixels_lazy(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glDrawPixels)this->m_resolveOrThrow(1428);this->m_glDrawPixels(width,height,format,type,pixels);}
+void m_glMultMatrixd_lazy(const GLdouble* m)const{if(!this->m_glMultMatrixd)this->m_resolveOrThrow(1429);this->m_glMultMatrixd(m);}
+void m_glMultMatrixf_lazy(const GLfloat* m)const{if(!this->m_glMultMatrixf)this->m_resolveOrThrow(1430);this->m_glMultMatrixf(m);}
+void m_glReplacementCodePointerSUN_lazy(GLenum type,GLsizei stride,const void** pointer)const{if(!this->m_glReplacementCodePointerSUN)this->m_resolveOrThrow(1431);this->m_glReplacementCodePointerSUN(type,stride,pointer);}
+void m_glLoadTransposeMatrixdARB_lazy(const GLdouble* m)const{if(!this->m_glLoadTransposeMatrixdARB)this->m_resolveOrThrow(1432);this->m_glLoadTransposeMatrixdARB(m);}
+void m_glVertexAttrib4Nubv_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttrib4Nubv)this->m_resolveOrThrow(1433);this->m_glVertexAttrib4Nubv(index,v);}
+void m_glVertexArrayVertexAttribIOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayVertexAttribIOffsetEXT)this->m_resolveOrThrow(1434);this->m_glVertexArrayVertexAttribIOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+void m_glCompileShaderARB_lazy(GLhandleARB shaderObj)const{if(!this->m_glCompileShaderARB)this->m_resolveOrThrow(1435);this->m_glCompileShaderARB(shaderObj);}
+void m_glWindowPos3dMESA_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glWindowPos3dMESA)this->m_resolveOrThrow(1436);this->m_glWindowPos3dMESA(x,y,z);}
+void m_glNormalStream3fvATI_lazy(GLenum stream,const GLfloat* coords)const{if(!this->m_glNormalStream3fvATI)this->m_resolveOrThrow(1437);this->m_glNormalStream3fvATI(stream,coords);}
+void m_glColor4usv_lazy(const GLushort* v)const{if(!this->m_glColor4usv)this->m_resolveOrThrow(1438);this->m_glColor4usv(v);}
+void m_glMapGrid1f_lazy(GLint un,GLfloat u1,GLfloat u2)const{if(!this->m_glMapGrid1f)this->m_resolveOrThrow(1439);this->m_glMapGrid1f(un,u1,u2);}
+void m_glPolygonStipple_lazy(const GLubyte* mask)const{if(!this->m_glPolygonStipple)this->m_resolveOrThrow(1440);this->m_glPolygonStipple(mask);}
+void m_glUniform4ui64ARB_lazy(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{if(!this->m_glUniform4ui64ARB)this->m_resolveOrThrow(1441);this->m_glUniform4ui64ARB(location,x,y,z,w);}
+void m_glTextureRenderbufferEXT_lazy(GLuint texture,GLenum target,GLuint renderbuffer)const{if(!this->m_glTextureRenderbufferEXT)this->m_resolveOrThrow(1442);this->m_glTextureRenderbufferEXT(texture,target,renderbuffer);}
+GLint m_glGetSubroutineUniformLocation_lazy(GLuint program,GLenum shadertype,const GLchar* name)const{if(!this->m_glGetSubroutineUniformLocation)this->m_resolveOrThrow(1443);return this->m_glGetSubroutineUniformLocation(program,shadertype,name);}
+void m_glGetFramebufferParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetFramebufferParameteriv)this->m_resolveOrThrow(1444);this->m_glGetFramebufferParameteriv(target,pname,params);}
+void m_glPixelMapusv_lazy(GLenum map,GLsizei mapsize,const GLushort* values)const{if(!this->m_glPixelMapusv)this->m_resolveOrThrow(1445);this->m_glPixelMapusv(map,mapsize,values);}
+void m_glGetSamplerParameteriv_lazy(GLuint sampler,GLenum pname,GLint* params)const{if(!this->m_glGetSamplerParameteriv)this->m_resolveOrThrow(1446);this->m_glGetSamplerParameteriv(sampler,pname,params);}
+void m_glVertexStream2fvATI_lazy(GLenum stream,const GLfloat* coords)const{if(!this->m_glVertexStream2fvATI)this->m_resolveOrThrow(1447);this->m_glVertexStream2fvATI(stream,coords);}
+void m_glProgramStringARB_lazy(GLenum target,GLenum format,GLsizei len,const void* string)const{if(!this->m_glProgramStringARB)this->m_resolveOrThrow(1448);this->m_glProgramStringARB(target,format,len,string);}
+void m_glProgramUniformMatrix3dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3dvEXT)this->m_resolveOrThrow(1449);this->m_glProgramUniformMatrix3dvEXT(program,location,count,transpose,value);}
+void m_glSeparableFilter2D_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column)const{if(!this->m_glSeparableFilter2D)this->m_resolveOrThrow(1450);this->m_glSeparableFilter2D(target,internalformat,width,height,format,type,row,column);}
+void m_glVertexAttribI1uiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI1uiv)this->m_resolveOrThrow(1451);this->m_glVertexAttribI1uiv(index,v);}
+void m_glLGPUCopyImageSubDataNVX_lazy(GLuint sourceGpu,GLbitfield destinationGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srxY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glLGPUCopyImageSubDataNVX)this->m_resolveOrThrow(1452);this->m_glLGPUCopyImageSubDataNVX(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+void m_glTexStorage2D_lazy(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glTexStorage2D)this->m_resolveOrThrow(1453);this->m_glTexStorage2D(target,levels,internalformat,width,height);}
+void m_glColor3fv_lazy(const GLfloat* v)const{if(!this->m_glColor3fv)this->m_resolveOrThrow(1454);this->m_glColor3fv(v);}
+void m_glGetMultiTexGendvEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params)const{if(!this->m_glGetMultiTexGendvEXT)this->m_resolveOrThrow(1455);this->m_glGetMultiTexGendvEXT(texunit,coord,pname,params);}
+void m_glVertexAttribL4dvEXT_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL4dvEXT)this->m_resolveOrThrow(1456);this->m_glVertexAttribL4dvEXT(index,v);}
+void m_glGetActiveUniform_lazy(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{if(!this->m_glGetActiveUniform)this->m_resolveOrThrow(1457);this->m_glGetActiveUniform(program,index,bufSize,length,size,type,name);}
+void m_glUniform2ui64vARB_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniform2ui64vARB)this->m_resolveOrThrow(1458);this->m_glUniform2ui64vARB(location,count,value);}
+void m_glMakeNamedBufferResidentNV_lazy(GLuint buffer,GLenum access)const{if(!this->m_glMakeNamedBufferResidentNV)this->m_resolveOrThrow(1459);this->m_glMakeNamedBufferResidentNV(buffer,access);}
+GLenum m_glPathGlyphIndexRangeNV_lazy(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint baseAndCount[2])const{if(!this->m_glPathGlyphIndexRangeNV)this->m_resolveOrThrow(1460);return this->m_glPathGlyphIndexRangeNV(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);}
+void m_glColorPointer_lazy(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{if(!this->m_glColorPointer)this->m_resolveOrThrow(1461);this->m_glColorPointer(size,type,stride,ptr);}
+void m_glProgramEnvParameterI4ivNV_lazy(GLenum target,GLuint index,const GLint* params)const{if(!this->m_glProgramEnvParameterI4ivNV)this->m_resolveOrThrow(1462);this->m_glProgramEnvParameterI4ivNV(target,index,params);}
+void m_glMulticastGetQueryObjectui64vNV_lazy(GLuint gpu,GLuint id,GLenum pname,GLuint64* params)const{if(!this->m_glMulticastGetQueryObjectui64vNV)this->m_resolveOrThrow(1463);this->m_glMulticastGetQueryObjectui64vNV(gpu,id,pname,params);}
+void m_glMultiTexParameterfEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glMultiTexParameterfEXT)this->m_resolveOrThrow(1464);this->m_glMultiTexParameterfEXT(texunit,target,pname,param);}
+void m_glNamedFramebufferTextureLayer_lazy(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{if(!this->m_glNamedFramebufferTextureLayer)this->m_resolveOrThrow(1465);this->m_glNamedFramebufferTextureLayer(framebuffer,attachment,texture,level,layer);}
+void m_glGetVertexArrayIntegervEXT_lazy(GLuint vaobj,GLenum pname,GLint* param)const{if(!this->m_glGetVertexArrayIntegervEXT)this->m_resolveOrThrow(1466);this->m_glGetVertexArrayIntegervEXT(vaobj,pname,param);}
+void m_glVertexAttrib3dARB_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexAttrib3dARB)this->m_resolveOrThrow(1467);this->m_glVertexAttrib3dARB(index,x,y,z);}
+GLboolean m_glVDPAUIsSurfaceNV_lazy(GLvdpauSurfaceNV surface)const{if(!this->m_glVDPAUIsSurfaceNV)this->m_resolveOrThrow(1468);return this->m_glVDPAUIsSurfaceNV(surface);}
+void m_glMultiTexImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexImage1DEXT)this->m_resolveOrThrow(1469);this->m_glMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,format,type,pixels);}
+GLboolean m_glIsAsyncMarkerSGIX_lazy(GLuint marker)const{if(!this->m_glIsAsyncMarkerSGIX)this->m_resolveOrThrow(1470);return this->m_glIsAsyncMarkerSGIX(marker);}
+void m_glGetDoublei_vEXT_lazy(GLenum pname,GLuint index,GLdouble* params)const{if(!this->m_glGetDoublei_vEXT)this->m_resolveOrThrow(1471);this->m_glGetDoublei_vEXT(pname,index,params);}
+void m_glUniform2i64NV_lazy(GLint location,GLint64EXT x,GLint64EXT y)const{if(!this->m_glUniform2i64NV)this->m_resolveOrThrow(1472);this->m_glUniform2i64NV(location,x,y);}
+GLboolean m_glIsCommandListNV_lazy(GLuint list)const{if(!this->m_glIsCommandListNV)this->m_resolveOrThrow(1473);return this->m_glIsCommandListNV(list);}
+void m_glUniform3uiEXT_lazy(GLint location,GLuint v0,GLuint v1,GLuint v2)const{if(!this->m_glUniform3uiEXT)this->m_resolveOrThrow(1474);this->m_glUniform3uiEXT(location,v0,v1,v2);}
+void m_glTexParameterIuivEXT_lazy(GLenum target,GLenum pname,const GLuint* params)const{if(!this->m_glTexParameterIuivEXT)this->m_resolveOrThrow(1475);this->m_glTexParameterIuivEXT(target,pname,params);}
+void m_glProgramUniformMatrix4fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4fv)this->m_resolveOrThrow(1476);this->m_glProgramUniformMatrix4fv(program,location,count,transpose,value);}
+void m_glVertex2fv_lazy(const GLfloat* v)const{if(!this->m_glVertex2fv)this->m_resolveOrThrow(1477);this->m_glVertex2fv(v);}
+void m_glVertexAttribL3dEXT_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexAttribL3dEXT)this->m_resolveOrThrow(1478);this->m_glVertexAttribL3dEXT(index,x,y,z);}
+void m_glFramebufferRenderbuffer_lazy(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{if(!this->m_glFramebufferRenderbuffer)this->m_resolveOrThrow(1479);this->m_glFramebufferRenderbuffer(target,attachment,renderbuffertarget,renderbuffer);}
+GLint m_glGetUniformLocationARB_lazy(GLhandleARB programObj,const GLcharARB* name)const{if(!this->m_glGetUniformLocationARB)this->m_resolveOrThrow(1480);return this->m_glGetUniformLocationARB(programObj,name);}
+void m_glPathParameterfvNV_lazy(GLuint path,GLenum pname,const GLfloat* value)const{if(!this->m_glPathParameterfvNV)this->m_resolveOrThrow(1481);this->m_glPathParameterfvNV(path,pname,value);}
+void m_glVertexAttrib3sNV_lazy(GLuint index,GLshort x,GLshort y,GLshort z)const{if(!this->m_glVertexAttrib3sNV)this->m_resolveOrThrow(1482);this->m_glVertexAttrib3sNV(index,x,y,z);}
+void m_glGetDoublei_v_lazy(GLenum target,GLuint index,GLdouble* data)const{if(!this->m_glGetDoublei_v)this->m_resolveOrThrow(1483);this->m_glGetDoublei_v(target,index,data);}
+void m_glVertexAttrib1sv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib1sv)this->m_resolveOrThrow(1484);this->m_glVertexAttrib1sv(index,v);}
+void m_glBindSampler_lazy(GLuint unit,GLuint sampler)const{if(!this->m_glBindSampler)this->m_resolveOrThrow(1485);this->m_glBindSampler(unit,sampler);}
+void m_glLineWidth_lazy(GLfloat width)const{if(!this->m_glLineWidth)this->m_resolveOrThrow(1486);this->m_glLineWidth(width);}
+void m_glVertexArrayRangeAPPLE_lazy(GLsizei length,void* pointer)const{if(!this->m_glVertexArrayRangeAPPLE)this->m_resolveOrThrow(1487);this->m_glVertexArrayRangeAPPLE(length,pointer);}
+void m_glBindBufferOffsetEXT_lazy(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{if(!this->m_glBindBufferOffsetEXT)this->m_resolveOrThrow(1488);this->m_glBindBufferOffsetEXT(target,index,buffer,offset);}
+void m_glWeightfvARB_lazy(GLint size,const GLfloat* weights)const{if(!this->m_glWeightfvARB)this->m_resolveOrThrow(1489);this->m_glWeightfvARB(size,weights);}
+void m_glGetIntegeri_v_lazy(GLenum target,GLuint index,GLint* data)const{if(!this->m_glGetIntegeri_v)this->m_resolveOrThrow(1490);this->m_glGetIntegeri_v(target,index,data);}
+void m_glGetTransformFeedbackVarying_lazy(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{if(!this->m_glGetTransformFeedbackVarying)this->m_resolveOrThrow(1491);this->m_glGetTransformFeedbackVarying(program,index,bufSize,length,size,type,name);}
+void m_glProgramLocalParameter4fvARB_lazy(GLenum target,GLuint index,const GLfloat* params)const{if(!this->m_glProgramLocalParameter4fvARB)this->m_resolveOrThrow(1492);this->m_glProgramLocalParameter4fvARB(target,index,params);}
+void m_glGetTransformFeedbackVaryingNV_lazy(GLuint program,GLuint index,GLint* location)const{if(!this->m_glGetTransformFeedbackVaryingNV)this->m_resolveOrThrow(1493);this->m_glGetTransformFeedbackVaryingNV(program,index,location);}
+void m_glWindowPos2iv_lazy(const GLint* v)const{if(!this->m_glWindowPos2iv)this->m_resolveOrThrow(1494);this->m_glWindowPos2iv(v);}
+void m_glVertexStream1dATI_lazy(GLenum stream,GLdouble x)const{if(!this->m_glVertexStream1dATI)this->m_resolveOrThrow(1495);this->m_glVertexStream1dATI(stream,x);}
+void m_glColorFragmentOp2ATI_lazy(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{if(!this->m_glColorFragmentOp2ATI)this->m_resolveOrThrow(1496);this->m_glColorFragmentOp2ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+void m_glFogiv_lazy(GLenum pname,const GLint* params)const{if(!this->m_glFogiv)this->m_resolveOrThrow(1497);this->m_glFogiv(pname,params);}
+GLuint64 m_glGetTextureHandleNV_lazy(GLuint texture)const{if(!this->m_glGetTextureHandleNV)this->m_resolveOrThrow(1498);return this->m_glGetTextureHandleNV(texture);}
+void m_glLightModeliv_lazy(GLenum pname,const GLint* params)const{if(!this->m_glLightModeliv)this->m_resolveOrThrow(1499);this->m_glLightModeliv(pname,params);}
+void m_glDepthRangef_lazy(GLfloat n,GLfloat f)const{if(!this->m_glDepthRangef)this->m_resolveOrThrow(1500);this->m_glDepthRangef(n,f);}
+void m_glGetFragmentMaterialivSGIX_lazy(GLenum face,GLenum pname,GLint* params)const{if(!this->m_glGetFragmentMaterialivSGIX)this->m_resolveOrThrow(1501);this->m_glGetFragmentMaterialivSGIX(face,pname,params);}
+void m_glVideoCaptureStreamParameterfvNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params)const{if(!this->m_glVideoCaptureStreamParameterfvNV)this->m_resolveOrThrow(1502);this->m_glVideoCaptureStreamParameterfvNV(video_capture_slot,stream,pname,params);}
+void m_glDeleteProgramsARB_lazy(GLsizei n,const GLuint* programs)const{if(!this->m_glDeleteProgramsARB)this->m_resolveOrThrow(1503);this->m_glDeleteProgramsARB(n,programs);}
+void m_glWindowPos3fvARB_lazy(const GLfloat* v)const{if(!this->m_glWindowPos3fvARB)this->m_resolveOrThrow(1504);this->m_glWindowPos3fvARB(v);}
+void m_glFeedbackBufferxOES_lazy(GLsizei n,GLenum type,const GLfixed* buffer)const{if(!this->m_glFeedbackBufferxOES)this->m_resolveOrThrow(1505);this->m_glFeedbackBufferxOES(n,type,buffer);}
+void m_glGetTexBumpParameterfvATI_lazy(GLenum pname,GLfloat* param)const{if(!this->m_glGetTexBumpParameterfvATI)this->m_resolveOrThrow(1506);this->m_glGetTexBumpParameterfvATI(pname,param);}
+void m_glEnablei_lazy(GLenum target,GLuint index)const{if(!this->m_glEnablei)this->m_resolveOrThrow(1507);this->m_glEnablei(target,index);}
+void m_glGetActiveSubroutineName_lazy(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{if(!this->m_glGetActiveSubroutineName)this->m_resolveOrThrow(1508);this->m_glGetActiveSubroutineName(program,shadertype,index,bufsize,length,name);}
+void m_glDrawBuffersARB_lazy(GLsizei n,const GLenum* bufs)const{if(!this->m_glDrawBuffersARB)this->m_resolveOrThrow(1509);this->m_glDrawBuffersARB(n,bufs);}
+void m_glBindProgramARB_lazy(GLenum target,GLuint program)const{if(!this->m_glBindProgramARB)this->m_resolveOrThrow(1510);this->m_glBindProgramARB(target,program);}
+void m_glEvalCoord1fv_lazy(const GLfloat* u)const{if(!this->m_glEvalCoord1fv)this->m_resolveOrThrow(1511);this->m_glEvalCoord1fv(u);}
+void m_glProgramUniform3ui64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glProgramUniform3ui64vARB)this->m_resolveOrThrow(1512);this->m_glProgramUniform3ui64vARB(program,location,count,value);}
+void m_glProgramUniformMatrix2dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2dv)this->m_resolveOrThrow(1513);this->m_glProgramUniformMatrix2dv(program,location,count,transpose,value);}
+void m_glMultiTexCoord2hvNV_lazy(GLenum target,const GLhalfNV* v)const{if(!this->m_glMultiTexCoord2hvNV)this->m_resolveOrThrow(1514);this->m_glMultiTexCoord2hvNV(target,v);}
+void m_glGetFloatIndexedvEXT_lazy(GLenum target,GLuint index,GLfloat* data)const{if(!this->m_glGetFloatIndexedvEXT)this->m_resolveOrThrow(1515);this->m_glGetFloatIndexedvEXT(target,index,data);}
+void m_glSampleCoverageARB_lazy(GLfloat value,GLboolean invert)const{if(!this->m_glSampleCoverageARB)this->m_resolveOrThrow(1516);this->m_glSampleCoverageARB(value,invert);}
+void m_glProgramUniform2ui64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glProgramUniform2ui64vARB)this->m_resolveOrThrow(1517);this->m_glProgramUniform2ui64vARB(program,location,count,value);}
+void m_glPixelDataRangeNV_lazy(GLenum target,GLsizei length,const void* pointer)const{if(!this->m_glPixelDataRangeNV)this->m_resolveOrThrow(1518);this->m_glPixelDataRangeNV(target,length,pointer);}
+void m_glVertexStream3svATI_lazy(GLenum stream,const GLshort* coords)const{if(!this->m_glVertexStream3svATI)this->m_resolveOrThrow(1519);this->m_glVertexStream3svATI(stream,coords);}
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{if(!this->m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)this->m_resolveOrThrow(1520);this->m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc,tc,n,v);}
+void m_glTexCoord3hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glTexCoord3hvNV)this->m_resolveOrThrow(1521);this->m_glTexCoord3hvNV(v);}
+void m_glSampleMaski_lazy(GLuint maskNumber,GLbitfield mask)const{if(!this->m_glSampleMaski)this->m_resolveOrThrow(1522);this->m_glSampleMaski(maskNumber,mask);}
+void m_glIndexFuncEXT_lazy(GLenum func,GLclampf ref)const{if(!this->m_glIndexFuncEXT)this->m_resolveOrThrow(1523);this->m_glIndexFuncEXT(func,ref);}
+void m_glPointParameteriNV_lazy(GLenum pname,GLint param)const{if(!this->m_glPointParameteriNV)this->m_resolveOrThrow(1524);this->m_glPointParameteriNV(pname,param);}
+void m_glUniformMatrix3x2fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix3x2fv)this->m_resolveOrThrow(1525);this->m_glUniformMatrix3x2fv(location,count,transpose,value);}
+void m_glGetFramebufferParameterivEXT_lazy(GLuint framebuffer,GLenum pname,GLint* params)const{if(!this->m_glGetFramebufferParameterivEXT)this->m_resolveOrThrow(1526);this->m_glGetFramebufferParameterivEXT(framebuffer,pname,params);}
+void m_glUniform2i64ARB_lazy(GLint location,GLint64 x,GLint64 y)const{if(!this->m_glUniform2i64ARB)this->m_resolveOrThrow(1527);this->m_glUniform2i64ARB(location,x,y);}
+void m_glNamedBufferStorageEXT_lazy(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{if(!this->m_glNamedBufferStorageEXT)this->m_resolveOrThrow(1528);this->m_glNamedBufferStorageEXT(buffer,size,data,flags);}
+void m_glNamedFramebufferTexture3DEXT_lazy(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{if(!this->m_glNamedFramebufferTexture3DEXT)this->m_resolveOrThrow(1529);this->m_glNamedFramebufferTexture3DEXT(framebuffer,attachment,textarget,texture,level,zoffset);}
+void m_glVertexAttrib2dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib2dv)this->m_resolveOrThrow(1530);this->m_glVertexAttrib2dv(index,v);}
+void m_glGetVertexArrayPointervEXT_lazy(GLuint vaobj,GLenum pname,void** param)const{if(!this->m_glGetVertexArrayPointervEXT)this->m_resolveOrThrow(1531);this->m_glGetVertexArrayPointervEXT(vaobj,pname,param);}
+void m_glGetVertexAttribArrayObjectivATI_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribArrayObjectivATI)this->m_resolveOrThrow(1532);this->m_glGetVertexAttribArrayObjectivATI(index,pname,params);}
+void m_glProgramUniformMatrix3fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3fvEXT)this->m_resolveOrThrow(1533);this->m_glProgramUniformMatrix3fvEXT(program,location,count,transpose,value);}
+void m_glEnableVertexArrayEXT_lazy(GLuint vaobj,GLenum array)const{if(!this->m_glEnableVertexArrayEXT)this->m_resolveOrThrow(1534);this->m_glEnableVertexArrayEXT(vaobj,array);}
+void m_glColorTableParameterfvSGI_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glColorTableParameterfvSGI)this->m_resolveOrThrow(1535);this->m_glColorTableParameterfvSGI(target,pname,params);}
+void m_glEdgeFlag_lazy(GLboolean flag)const{if(!this->m_glEdgeFlag)this->m_resolveOrThrow(1536);this->m_glEdgeFlag(flag);}
+void m_glFogCoordf_lazy(GLfloat coord)const{if(!this->m_glFogCoordf)this->m_resolveOrThrow(1537);this->m_glFogCoordf(coord);}
+void m_glVertex3d_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertex3d)this->m_resolveOrThrow(1538);this->m_glVertex3d(x,y,z);}
+void m_glVertex3f_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glVertex3f)this->m_resolveOrThrow(1539);this->m_glVertex3f(x,y,z);}
+void m_glSpriteParameterivSGIX_lazy(GLenum pname,const GLint* params)const{if(!this->m_glSpriteParameterivSGIX)this->m_resolveOrThrow(1540);this->m_glSpriteParameterivSGIX(pname,params);}
+void m_glPathGlyphRangeNV_lazy(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{if(!this->m_glPathGlyphRangeNV)this->m_resolveOrThrow(1541);this->m_glPathGlyphRangeNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);}
+void m_glPrimitiveBoundingBoxARB_lazy(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW)const{if(!this->m_glPrimitiveBoundingBoxARB)this->m_resolveOrThrow(1542);this->m_glPrimitiveBoundingBoxARB(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);}
+void m_glVertexAttribL3ui64vNV_lazy(GLuint index,const GLuint64EXT* v)const{if(!this->m_glVertexAttribL3ui64vNV)this->m_resolveOrThrow(1543);this->m_glVertexAttribL3ui64vNV(index,v);}
+void m_glVertex3s_lazy(GLshort x,GLshort y,GLshort z)const{if(!this->m_glVertex3s)this->m_resolveOrThrow(1544);this->m_glVertex3s(x,y,z);}
+void m_glTexCoordP2ui_lazy(GLenum type,GLuint coords)const{if(!this->m_glTexCoordP2ui)this->m_resolveOrThrow(1545);this->m_glTexCoordP2ui(type,coords);}
+void m_glProgramUniform2fvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform2fvEXT)this->m_resolveOrThrow(1546);this->m_glProgramUniform2fvEXT(program,location,count,value);}
+void m_glDeletePathsNV_lazy(GLuint path,GLsizei range)const{if(!this->m_glDeletePathsNV)this->m_resolveOrThrow(1547);this->m_glDeletePathsNV(path,range);}
+void m_glPrimitiveRestartIndexNV_lazy(GLuint index)const{if(!this->m_glPrimitiveRestartIndexNV)this->m_resolveOrThrow(1548);this->m_glPrimitiveRestartIndexNV(index);}
+void m_glTexCoord2fColor3fVertex3fvSUN_lazy(const GLfloat* tc,const GLfloat* c,const GLfloat* v)const{if(!this->m_glTexCoord2fColor3fVertex3fvSUN)this->m_resolveOrThrow(1549);this->m_glTexCoord2fColor3fVertex3fvSUN(tc,c,v);}
+void m_glTexCoordPointerListIBM_lazy(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glTexCoordPointerListIBM)this->m_resolveOrThrow(1550);this->m_glTexCoordPointerListIBM(size,type,stride,pointer,ptrstride);}
+void m_glRectxOES_lazy(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2)const{if(!this->m_glRectxOES)this->m_resolveOrThrow(1551);this->m_glRectxOES(x1,y1,x2,y2);}
+void m_glCopyNamedBufferSubData_lazy(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{if(!this->m_glCopyNamedBufferSubData)this->m_resolveOrThrow(1552);this->m_glCopyNamedBufferSubData(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+void m_glGenProgramsNV_lazy(GLsizei n,GLuint* programs)const{if(!this->m_glGenProgramsNV)this->m_resolveOrThrow(1553);this->m_glGenProgramsNV(n,programs);}
+void m_glFragmentLightfSGIX_lazy(GLenum light,GLenum pname,GLfloat param)const{if(!this->m_glFragmentLightfSGIX)this->m_resolveOrThrow(1554);this->m_glFragmentLightfSGIX(light,pname,param);}
+void m_glTexStorage3D_lazy(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glTexStorage3D)this->m_resolveOrThrow(1555);this->m_glTexStorage3D(target,levels,internalformat,width,height,depth);}
+void m_glTextureParameteriv_lazy(GLuint texture,GLenum pname,const GLint* param)const{if(!this->m_glTextureParameteriv)this->m_resolveOrThrow(1556);this->m_glTextureParameteriv(texture,pname,param);}
+void m_glNamedBufferDataEXT_lazy(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{if(!this->m_glNamedBufferDataEXT)this->m_resolveOrThrow(1557);this->m_glNamedBufferDataEXT(buffer,size,data,usage);}
+void m_glImportSemaphoreWin32NameEXT_lazy(GLuint semaphore,GLenum handleType,const void* name)const{if(!this->m_glImportSemaphoreWin32NameEXT)this->m_resolveOrThrow(1558);this->m_glImportSemaphoreWin32NameEXT(semaphore,handleType,name);}
+void m_glMultiTexCoord3fvARB_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord3fvARB)this->m_resolveOrThrow(1559);this->m_glMultiTexCoord3fvARB(target,v);}
+void m_glUniformMatrix3x4fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix3x4fv)this->m_resolveOrThrow(1560);this->m_glUniformMatrix3x4fv(location,count,transpose,value);}
+void m_glSubpixelPrecisionBiasNV_lazy(GLuint xbits,GLuint ybits)const{if(!this->m_glSubpixelPrecisionBiasNV)this->m_resolveOrThrow(1561);this->m_glSubpixelPrecisionBiasNV(xbits,ybits);}
+void m_glNormalPointer_lazy(GLenum type,GLsizei stride,const GLvoid* ptr)const{if(!this->m_glNormalPointer)this->m_resolveOrThrow(1562);this->m_glNormalPointer(type,stride,ptr);}
+void m_glNamedFramebufferTexture_lazy(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{if(!this->m_glNamedFramebufferTexture)this->m_resolveOrThrow(1563);this->m_glNamedFramebufferTexture(framebuffer,attachment,texture,level);}
+void m_glVertexAttrib4NsvARB_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib4NsvARB)this->m_resolveOrThrow(1564);this->m_glVertexAttrib4NsvARB(index,v);}
+void m_glPassThrough_lazy(GLfloat token)const{if(!this->m_glPassThrough)this->m_resolveOrThrow(1565);this->m_glPassThrough(token);}
+void m_glSecondaryColorP3ui_lazy(GLenum type,GLuint color)const{if(!this->m_glSecondaryColorP3ui)this->m_resolveOrThrow(1566);this->m_glSecondaryColorP3ui(type,color);}
+void m_glInvalidateTexSubImage_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glInvalidateTexSubImage)this->m_resolveOrThrow(1567);this->m_glInvalidateTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth);}
+GLboolean m_glIsImageHandleResidentARB_lazy(GLuint64 handle)const{if(!this->m_glIsImageHandleResidentARB)this->m_resolveOrThrow(1568);return this->m_glIsImageHandleResidentARB(handle);}
+void m_glTangent3fvEXT_lazy(const GLfloat* v)const{if(!this->m_glTangent3fvEXT)this->m_resolveOrThrow(1569);this->m_glTangent3fvEXT(v);}
+void m_glProgramUniformMatrix4x3fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4x3fv)this->m_resolveOrThrow(1570);this->m_glProgramUniformMatrix4x3fv(program,location,count,transpose,value);}
+void m_glBegin_lazy(GLenum mode)const{if(!this->m_glBegin)this->m_resolveOrThrow(1571);this->m_glBegin(mode);}
+void m_glEvalCoord2dv_lazy(const GLdouble* u)const{if(!this->m_glEvalCoord2dv)this->m_resolveOrThrow(1572);this->m_glEvalCoord2dv(u);}
+void m_glColor3ubv_lazy(const GLubyte* v)const{if(!this->m_glColor3ubv)this->m_resolveOrThrow(1573);this->m_glColor3ubv(v);}
+void m_glFogCoordfvEXT_lazy(const GLfloat* coord)const{if(!this->m_glFogCoordfvEXT)this->m_resolveOrThrow(1574);this->m_glFogCoordfvEXT(coord);}
+void m_glVertexP3ui_lazy(GLenum type,GLuint value)const{if(!this->m_glVertexP3ui)this->m_resolveOrThrow(1575);this->m_glVertexP3ui(type,value);}
+void m_glLightfv_lazy(GLenum light,GLenum pname,const GLfloat* params)const{if(!this->m_glLightfv)this->m_resolveOrThrow(1576);this->m_glLightfv(light,pname,params);}
+void m_glVertexAttribL3i64NV_lazy(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{if(!this->m_glVertexAttribL3i64NV)this->m_resolveOrThrow(1577);this->m_glVertexAttribL3i64NV(index,x,y,z);}
+void m_glStencilClearTagEXT_lazy(GLsizei stencilTagBits,GLuint stencilClearTag)const{if(!this->m_glStencilClearTagEXT)this->m_resolveOrThrow(1578);this->m_glStencilClearTagEXT(stencilTagBits,stencilClearTag);}
+void m_glGetActiveUniformName_lazy(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName)const{if(!this->m_glGetActiveUniformName)this->m_resolveOrThrow(1579);this->m_glGetActiveUniformName(program,uniformIndex,bufSize,length,uniformName);}
+void m_glTangentPointerEXT_lazy(GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glTangentPointerEXT)this->m_resolveOrThrow(1580);this->m_glTangentPointerEXT(type,stride,pointer);}
+void m_glUniform4ui64vNV_lazy(GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glUniform4ui64vNV)this->m_resolveOrThrow(1581);this->m_glUniform4ui64vNV(location,count,value);}
+void m_glDebugMessageEnableAMD_lazy(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{if(!this->m_glDebugMessageEnableAMD)this->m_resolveOrThrow(1582);this->m_glDebugMessageEnableAMD(category,severity,count,ids,enabled);}
+void m_glProgramUniform2ui_lazy(GLuint program,GLint location,GLuint v0,GLuint v1)const{if(!this->m_glProgramUniform2ui)this->m_resolveOrThrow(1583);this->m_glProgramUniform2ui(program,location,v0,v1);}
+void m_glCopyTexSubImage2DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTexSubImage2DEXT)this->m_resolveOrThrow(1584);this->m_glCopyTexSubImage2DEXT(target,level,xoffset,yoffset,x,y,width,height);}
+void m_glGenRenderbuffersEXT_lazy(GLsizei n,GLuint* renderbuffers)const{if(!this->m_glGenRenderbuffersEXT)this->m_resolveOrThrow(1585);this->m_glGenRenderbuffersEXT(n,renderbuffers);}
+void m_glNamedProgramLocalParameterI4ivEXT_lazy(GLuint program,GLenum target,GLuint index,const GLint* params)const{if(!this->m_glNamedProgramLocalParameterI4ivEXT)this->m_resolveOrThrow(1586);this->m_glNamedProgramLocalParameterI4ivEXT(program,target,index,params);}
+void m_glMultiTexCoord2f_lazy(GLenum target,GLfloat s,GLfloat t)const{if(!this->m_glMultiTexCoord2f)this->m_resolveOrThrow(1587);this->m_glMultiTexCoord2f(target,s,t);}
+void m_glMapGrid2d_lazy(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2)const{if(!this->m_glMapGrid2d)this->m_resolveOrThrow(1588);this->m_glMapGrid2d(un,u1,u2,vn,v1,v2);}
+void m_glGetMultiTexParameterIuivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLuint* params)const{if(!this->m_glGetMultiTexParameterIuivEXT)this->m_resolveOrThrow(1589);this->m_glGetMultiTexParameterIuivEXT(texunit,target,pname,params);}
+void m_glBlendEquationiARB_lazy(GLuint buf,GLenum mode)const{if(!this->m_glBlendEquationiARB)this->m_resolveOrThrow(1590);this->m_glBlendEquationiARB(buf,mode);}
+void m_glTexParameteriv_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTexParameteriv)this->m_resolveOrThrow(1591);this->m_glTexParameteriv(target,pname,params);}
+void m_glUniform4ivARB_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform4ivARB)this->m_resolveOrThrow(1592);this->m_glUniform4ivARB(location,count,value);}
+void m_glMatrixOrthoEXT_lazy(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{if(!this->m_glMatrixOrthoEXT)this->m_resolveOrThrow(1593);this->m_glMatrixOrthoEXT(mode,left,right,bottom,top,zNear,zFar);}
+void m_glVertexArrayVertexBuffer_lazy(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{if(!this->m_glVertexArrayVertexBuffer)this->m_resolveOrThrow(1594);this->m_glVertexArrayVertexBuffer(vaobj,bindingindex,buffer,offset,stride);}
+void m_glProgramLocalParametersI4ivNV_lazy(GLenum target,GLuint index,GLsizei count,const GLint* params)const{if(!this->m_glProgramLocalParametersI4ivNV)this->m_resolveOrThrow(1595);this->m_glProgramLocalParametersI4ivNV(target,index,count,params);}
+void m_glProgramUniform4ui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glProgramUniform4ui64vNV)this->m_resolveOrThrow(1596);this->m_glProgramUniform4ui64vNV(program,location,count,value);}
+void m_glGetNamedStringivARB_lazy(GLint namelen,const GLchar* name,GLenum pname,GLint* params)const{if(!this->m_glGetNamedStringivARB)this->m_resolveOrThrow(1597);this->m_glGetNamedStringivARB(namelen,name,pname,params);}
+void m_glVertexAttribL1i64vNV_lazy(GLuint index,const GLint64EXT* v)const{if(!this->m_glVertexAttribL1i64vNV)this->m_resolveOrThrow(1598);this->m_glVertexAttribL1i64vNV(index,v);}
+void m_glTransformFeedbackBufferBase_lazy(GLuint xfb,GLuint index,GLuint buffer)const{if(!this->m_glTransformFeedbackBufferBase)this->m_resolveOrThrow(1599);this->m_glTransformFeedbackBufferBase(xfb,index,buffer);}
+void m_glIndexsv_lazy(const GLshort* c)const{if(!this->m_glIndexsv)this->m_resolveOrThrow(1600);this->m_glIndexsv(c);}
+void m_glPointParameterivNV_lazy(GLenum pname,const GLint* params)const{if(!this->m_glPointParameterivNV)this->m_resolveOrThrow(1601);this->m_glPointParameterivNV(pname,params);}
+void m_glGetDetailTexFuncSGIS_lazy(GLenum target,GLfloat* points)const{if(!this->m_glGetDetailTexFuncSGIS)this->m_resolveOrThrow(1602);this->m_glGetDetailTexFuncSGIS(target,points);}
+void m_glReplacementCodeuiColor3fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* c,const GLfloat* v)const{if(!this->m_glReplacementCodeuiColor3fVertex3fvSUN)this->m_resolveOrThrow(1603);this->m_glReplacementCodeuiColor3fVertex3fvSUN(rc,c,v);}
+void m_glProgramLocalParameter4fARB_lazy(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glProgramLocalParameter4fARB)this->m_resolveOrThrow(1604);this->m_glProgramLocalParameter4fARB(target,index,x,y,z,w);}
+void m_glBitmap_lazy(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap)const{if(!this->m_glBitmap)this->m_resolveOrThrow(1605);this->m_glBitmap(width,height,xorig,yorig,xmove,ymove,bitmap);}
+void m_glNamedFramebufferTextureLayerEXT_lazy(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{if(!this->m_glNamedFramebufferTextureLayerEXT)this->m_resolveOrThrow(1606);this->m_glNamedFramebufferTextureLayerEXT(framebuffer,attachment,texture,level,layer);}
+void m_glMultiTexGenfvEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params)const{if(!this->m_glMultiTexGenfvEXT)this->m_resolveOrThrow(1607);this->m_glMultiTexGenfvEXT(texunit,coord,pname,params);}
+void m_glGetNamedBufferSubData_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{if(!this->m_glGetNamedBufferSubData)this->m_resolveOrThrow(1608);this->m_glGetNamedBufferSubData(buffer,offset,size,data);}
+void m_glStencilFuncSeparateATI_lazy(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask)const{if(!this->m_glStencilFuncSeparateATI)this->m_resolveOrThrow(1609);this->m_glStencilFuncSeparateATI(frontfunc,backfunc,ref,mask);}
+void m_glProgramUniform2iv_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform2iv)this->m_resolveOrThrow(1610);this->m_glProgramUniform2iv(program,location,count,value);}
+void m_glGetQueryiv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetQueryiv)this->m_resolveOrThrow(1611);this->m_glGetQueryiv(target,pname,params);}
+void m_glTexCoord4f_lazy(GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{if(!this->m_glTexCoord4f)this->m_resolveOrThrow(1612);this->m_glTexCoord4f(s,t,r,q);}
+void m_glMapGrid2f_lazy(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2)const{if(!this->m_glMapGrid2f)this->m_resolveOrThrow(1613);this->m_glMapGrid2f(un,u1,u2,vn,v1,v2);}
+void m_glListParameterivSGIX_lazy(GLuint list,GLenum pname,const GLint* params)const{if(!this->m_glListParameterivSGIX)this->m_resolveOrThrow(1614);this->m_glListParameterivSGIX(list,pname,params);}
+void m_glCreateQueries_lazy(GLenum target,GLsizei n,GLuint* ids)const{if(!this->m_glCreateQueries)this->m_resolveOrThrow(1615);this->m_glCreateQueries(target,n,ids);}
+void m_glGetSamplerParameterfv_lazy(GLuint sampler,GLenum pname,GLfloat* params)const{if(!this->m_glGetSamplerParameterfv)this->m_resolveOrThrow(1616);this->m_glGetSamplerParameterfv(sampler,pname,params);}
+void m_glTexCoord4i_lazy(GLint s,GLint t,GLint r,GLint q)const{if(!this->m_glTexCoord4i)this->m_resolveOrThrow(1617);this->m_glTexCoord4i(s,t,r,q);}
+void m_glObjectLabel_lazy(GLenum identifier,GLuint name,GLsizei length,const GLchar* label)const{if(!this->m_glObjectLabel)this->m_resolveOrThrow(1618);this->m_glObjectLabel(identifier,name,length,label);}
+void m_glProgramUniform3i64NV_lazy(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{if(!this->m_glProgramUniform3i64NV)this->m_resolveOrThrow(1619);this->m_glProgramUniform3i64NV(program,location,x,y,z);}
+GLuint64 m_glGetTextureHandleARB_lazy(GLuint texture)const{if(!this->m_glGetTextureHandleARB)this->m_resolveOrThrow(1620);return this->m_glGetTextureHandleARB(texture);}
+void m_glTexCoord4s_lazy(GLshort s,GLshort t,GLshort r,GLshort q)const{if(!this->m_glTexCoord4s)this->m_resolveOrThrow(1621);this->m_glTexCoord4s(s,t,r,q);}
+void m_glUniform4iARB_lazy(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{if(!this->m_glUniform4iARB)this->m_resolveOrThrow(1622);this->m_glUniform4iARB(location,v0,v1,v2,v3);}
+void m_glGetUniformIndices_lazy(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices)const{if(!this->m_glGetUniformIndices)this->m_resolveOrThrow(1623);this->m_glGetUniformIndices(program,uniformCount,uniformNames,uniformIndices);}
+void m_glMultiTexImage3DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexImage3DEXT)this->m_resolveOrThrow(1624);this->m_glMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+void m_glCoverageModulationTableNV_lazy(GLsizei n,const GLfloat* v)const{if(!this->m_glCoverageModulationTableNV)this->m_resolveOrThrow(1625);this->m_glCoverageModulationTableNV(n,v);}
+void m_glPointParameteriv_lazy(GLenum pname,const GLint* params)const{if(!this->m_glPointParameteriv)this->m_resolveOrThrow(1626);this->m_glPointParameteriv(pname,params);}
+void m_glMultiTexCoord4svARB_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord4svARB)this->m_resolveOrThrow(1627);this->m_glMultiTexCoord4svARB(target,v);}
+void m_glNormal3fv_lazy(const GLfloat* v)const{if(!this->m_glNormal3fv)this->m_resolveOrThrow(1628);this->m_glNormal3fv(v);}
+void m_glProgramUniformMatrix3x4dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3x4dvEXT)this->m_resolveOrThrow(1629);this->m_glProgramUniformMatrix3x4dvEXT(program,location,count,transpose,value);}
+void m_glTexCoord1fv_lazy(const GLfloat* v)const{if(!this->m_glTexCoord1fv)this->m_resolveOrThrow(1630);this->m_glTexCoord1fv(v);}
+void m_glProgramUniformMatrix4x3dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4x3dvEXT)this->m_resolveOrThrow(1631);this->m_glProgramUniformMatrix4x3dvEXT(program,location,count,transpose,value);}
+void m_glGetActiveVaryingNV_lazy(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{if(!this->m_glGetActiveVaryingNV)this->m_resolveOrThrow(1632);this->m_glGetActiveVaryingNV(program,index,bufSize,length,size,type,name);}
+void m_glUniform1i64vARB_lazy(GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glUniform1i64vARB)this->m_resolveOrThrow(1633);this->m_glUniform1i64vARB(location,count,value);}
+void m_glMultiTexCoord1dv_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord1dv)this->m_resolveOrThrow(1634);this->m_glMultiTexCoord1dv(target,v);}
+void m_glTexCoord3fv_lazy(const GLfloat* v)const{if(!this->m_glTexCoord3fv)this->m_resolveOrThrow(1635);this->m_glTexCoord3fv(v);}
+void m_glMatrixTranslatefEXT_lazy(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glMatrixTranslatefEXT)this->m_resolveOrThrow(1636);this->m_glMatrixTranslatefEXT(mode,x,y,z);}
+void m_glProgramUniform1ui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glProgramUniform1ui64vNV)this->m_resolveOrThrow(1637);this->m_glProgramUniform1ui64vNV(program,location,count,value);}
+void m_glTextureMaterialEXT_lazy(GLenum face,GLenum mode)const{if(!this->m_glTextureMaterialEXT)this->m_resolveOrThrow(1638);this->m_glTextureMaterialEXT(face,mode);}
+void m_glMultiTexCoordP3uiv_lazy(GLenum texture,GLenum type,const GLuint* coords)const{if(!this->m_glMultiTexCoordP3uiv)this->m_resolveOrThrow(1639);this->m_glMultiTexCoordP3uiv(texture,type,coords);}
+void m_glVertexAttribP3ui_lazy(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{if(!this->m_glVertexAttribP3ui)this->m_resolveOrThrow(1640);this->m_glVertexAttribP3ui(index,type,normalized,value);}
+void m_glInterpolatePathsNV_lazy(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight)const{if(!this->m_glInterpolatePathsNV)this->m_resolveOrThrow(1641);this->m_glInterpolatePathsNV(resultPath,pathA,pathB,weight);}
+void m_glTextureBufferRange_lazy(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glTextureBufferRange)this->m_resolveOrThrow(1642);this->m_glTextureBufferRange(texture,internalformat,buffer,offset,size);}
+void m_glVertexAttribL2dEXT_lazy(GLuint index,GLdouble x,GLdouble y)const{if(!this->m_glVertexAttribL2dEXT)this->m_resolveOrThrow(1643);this->m_glVertexAttribL2dEXT(index,x,y);}
+void m_glGetPixelTransformParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetPixelTransformParameterivEXT)this->m_resolveOrThrow(1644);this->m_glGetPixelTransformParameterivEXT(target,pname,params);}
+void m_glTexCoord4xvOES_lazy(const GLfixed* coords)const{if(!this->m_glTexCoord4xvOES)this->m_resolveOrThrow(1645);this->m_glTexCoord4xvOES(coords);}
+void m_glGetVariantBooleanvEXT_lazy(GLuint id,GLenum value,GLboolean* data)const{if(!this->m_glGetVariantBooleanvEXT)this->m_resolveOrThrow(1646);this->m_glGetVariantBooleanvEXT(id,value,data);}
+void m_glDepthRange_lazy(GLclampd near_val,GLclampd far_val)const{if(!this->m_glDepthRange)this->m_resolveOrThrow(1647);this->m_glDepthRange(near_val,far_val);}
+void m_glGetVertexAttribdvARB_lazy(GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetVertexAttribdvARB)this->m_resolveOrThrow(1648);this->m_glGetVertexAttribdvARB(index,pname,params);}
+void m_glGetColorTableParameterfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetColorTableParameterfv)this->m_resolveOrThrow(1649);this->m_glGetColorTableParameterfv(target,pname,params);}
+void m_glDrawArraysInstancedEXT_lazy(GLenum mode,GLint start,GLsizei count,GLsizei primcount)const{if(!this->m_glDrawArraysInstancedEXT)this->m_resolveOrThrow(1650);this->m_glDrawArraysInstancedEXT(mode,start,count,primcount);}
+void m_glDisableClientStateIndexedEXT_lazy(GLenum array,GLuint index)const{if(!this->m_glDisableClientStateIndexedEXT)this->m_resolveOrThrow(1651);this->m_glDisableClientStateIndexedEXT(array,index);}
+void m_glDrawBuffer_lazy(GLenum mode)const{if(!this->m_glDrawBuffer)this->m_resolveOrThrow(1652);this->m_glDrawBuffer(mode);}
+void m_glMultiDrawArraysIndirectBindlessNV_lazy(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{if(!this->m_glMultiDrawArraysIndirectBindlessNV)this->m_resolveOrThrow(1653);this->m_glMultiDrawArraysIndirectBindlessNV(mode,indirect,drawCount,stride,vertexBufferCount);}
+void m_glGetnPixelMapusv_lazy(GLenum map,GLsizei bufSize,GLushort* values)const{if(!this->m_glGetnPixelMapusv)this->m_resolveOrThrow(1654);this->m_glGetnPixelMapusv(map,bufSize,values);}
+void m_glRasterPos3fv_lazy(const GLfloat* v)const{if(!this->m_glRasterPos3fv)this->m_resolveOrThrow(1655);this->m_glRasterPos3fv(v);}
+void m_glClearBufferuiv_lazy(GLenum buffer,GLint drawbuffer,const GLuint* value)const{if(!this->m_glClearBufferuiv)this->m_resolveOrThrow(1656);this->m_glClearBufferuiv(buffer,drawbuffer,value);}
+void m_glGetInternalformati64v_lazy(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params)const{if(!this->m_glGetInternalformati64v)this->m_resolveOrThrow(1657);this->m_glGetInternalformati64v(target,internalformat,pname,bufSize,params);}
+void m_glShaderSourceARB_lazy(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length)const{if(!this->m_glShaderSourceARB)this->m_resolveOrThrow(1658);this->m_glShaderSourceARB(shaderObj,count,string,length);}
+void m_glShaderOp3EXT_lazy(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3)const{if(!this->m_glShaderOp3EXT)this->m_resolveOrThrow(1659);this->m_glShaderOp3EXT(op,res,arg1,arg2,arg3);}
+void m_glWindowPos2dvMESA_lazy(const GLdouble* v)const{if(!this->m_glWindowPos2dvMESA)this->m_resolveOrThrow(1660);this->m_glWindowPos2dvMESA(v);}
+void m_glClearIndex_lazy(GLfloat c)const{if(!this->m_glClearIndex)this->m_resolveOrThrow(1661);this->m_glClearIndex(c);}
+void m_glProvokingVertexEXT_lazy(GLenum mode)const{if(!this->m_glProvokingVertexEXT)this->m_resolveOrThrow(1662);this->m_glProvokingVertexEXT(mode);}
+void m_glVariantubvEXT_lazy(GLuint id,const GLubyte* addr)const{if(!this->m_glVariantubvEXT)this->m_resolveOrThrow(1663);this->m_glVariantubvEXT(id,addr);}
+void m_glFlush_lazy()const{if(!this->m_glFlush)this->m_resolveOrThrow(1664);this->m_glFlush();}
+void m_glFramebufferTexture2DEXT_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glFramebufferTexture2DEXT)this->m_resolveOrThrow(1665);this->m_glFramebufferTexture2DEXT(target,attachment,textarget,texture,level);}
+void m_glGetColorTableParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetColorTableParameterivEXT)this->m_resolveOrThrow(1666);this->m_glGetColorTableParameterivEXT(target,pname,params);}
+void m_glPresentFrameDualFillNV_lazy(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3)const{if(!this->m_glPresentFrameDualFillNV)this->m_resolveOrThrow(1667);this->m_glPresentFrameDualFillNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);}
+GLuint m_glGenVertexShadersEXT_lazy(GLuint range)const{if(!this->m_glGenVertexShadersEXT)this->m_resolveOrThrow(1668);return this->m_glGenVertexShadersEXT(range);}
+void m_glSpecializeShaderARB_lazy(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{if(!this->m_glSpecializeShaderARB)this->m_resolveOrThrow(1669);this->m_glSpecializeShaderARB(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+void m_glProgramUniformHandleui64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{if(!this->m_glProgramUniformHandleui64vARB)this->m_resolveOrThrow(1670);this->m_glProgramUniformHandleui64vARB(program,location,count,values);}
+void m_glDepthRangefOES_lazy(GLclampf n,GLclampf f)const{if(!this->m_glDepthRangefOES)this->m_resolveOrThrow(1671);this->m_glDepthRangefOES(n,f);}
+void m_glDeleteVertexArrays_lazy(GLsizei n,const GLuint* arrays)const{if(!this->m_glDeleteVertexArrays)this->m_resolveOrThrow(1672);this->m_glDeleteVertexArrays(n,arrays);}
+void m_glDrawElementsInstancedBaseVertexBaseInstance_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance)const{if(!this->m_glDrawElementsInstancedBaseVertexBaseInstance)this->m_resolveOrThrow(1673);this->m_glDrawElementsInstancedBaseVertexBaseInstance(mode,count,type,indices,instancecount,basevertex,baseinstance);}
+void m_glGetTexLevelParameteriv_lazy(GLenum target,GLint level,GLenum pname,GLint* params)const{if(!this->m_glGetTexLevelParameteriv)this->m_resolveOrThrow(1674);this->m_glGetTexLevelParameteriv(target,level,pname,params);}
+void m_glDrawVkImageNV_lazy(GLuint64 vkImage,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{if(!this->m_glDrawVkImageNV)this->m_resolveOrThrow(1675);this->m_glDrawVkImageNV(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+void m_glWindowPos3iARB_lazy(GLint x,GLint y,GLint z)const{if(!this->m_glWindowPos3iARB)this->m_resolveOrThrow(1676);this->m_glWindowPos3iARB(x,y,z);}
+void m_glPrioritizeTextures_lazy(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{if(!this->m_glPrioritizeTextures)this->m_resolveOrThrow(1677);this->m_glPrioritizeTextures(n,textures,priorities);}
+void m_glWindowPos3fvMESA_lazy(const GLfloat* v)const{if(!this->m_glWindowPos3fvMESA)this->m_resolveOrThrow(1678);this->m_glWindowPos3fvMESA(v);}
+void m_glProgramUniformMatrix3x2dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3x2dvEXT)this->m_resolveOrThrow(1679);this->m_glProgramUniformMatrix3x2dvEXT(program,location,count,transpose,value);}
+void m_glVertex4xvOES_lazy(const GLfixed* coords)const{if(!this->m_glVertex4xvOES)this->m_resolveOrThrow(1680);this->m_glVertex4xvOES(coords);}
+void m_glTexStorage3DMultisample_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{if(!this->m_glTexStorage3DMultisample)this->m_resolveOrThrow(1681);this->m_glTexStorage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+void m_glWindowPos2sARB_lazy(GLshort x,GLshort y)const{if(!this->m_glWindowPos2sARB)this->m_resolveOrThrow(1682);this->m_glWindowPos2sARB(x,y);}
+void m_glStencilOpValueAMD_lazy(GLenum face,GLuint value)const{if(!this->m_glStencilOpValueAMD)this->m_resolveOrThrow(1683);this->m_glStencilOpValueAMD(face,value);}
+void m_glProgramVertexLimitNV_lazy(GLenum target,GLint limit)const{if(!this->m_glProgramVertexLimitNV)this->m_resolveOrThrow(1684);this->m_glProgramVertexLimitNV(target,limit);}
+void m_glGetTexParameterPointervAPPLE_lazy(GLenum target,GLenum pname,void** params)const{if(!this->m_glGetTexParameterPointervAPPLE)this->m_resolveOrThrow(1685);this->m_glGetTexParameterPointervAPPLE(target,pname,params);}
+void m_glProgramUniform3uivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform3uivEXT)this->m_resolveOrThrow(1686);this->m_glProgramUniform3uivEXT(program,location,count,value);}
+void m_glClampColor_lazy(GLenum target,GLenum clamp)const{if(!this->m_glClampColor)this->m_resolveOrThrow(1687);this->m_glClampColor(target,clamp);}
+void m_glClearStencil_lazy(GLint s)const{if(!this->m_glClearStencil)this->m_resolveOrThrow(1688);this->m_glClearStencil(s);}
+void m_glTexCoordP1uiv_lazy(GLenum type,const GLuint* coords)const{if(!this->m_glTexCoordP1uiv)this->m_resolveOrThrow(1689);this->m_glTexCoordP1uiv(type,coords);}
+void m_glVertexAttribs3svNV_lazy(GLuint index,GLsizei count,const GLshort* v)const{if(!this->m_glVertexAttribs3svNV)this->m_resolveOrThrow(1690);this->m_glVertexAttribs3svNV(index,count,v);}
+void m_glMultiTexCoord3fv_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord3fv)this->m_resolveOrThrow(1691);this->m_glMultiTexCoord3fv(target,v);}
+void m_glVertexBlendEnvfATI_lazy(GLenum pname,GLfloat param)const{if(!this->m_glVertexBlendEnvfATI)this->m_resolveOrThrow(1692);this->m_glVertexBlendEnvfATI(pname,param);}
+GLboolean m_glIsFenceAPPLE_lazy(GLuint fence)const{if(!this->m_glIsFenceAPPLE)this->m_resolveOrThrow(1693);return this->m_glIsFenceAPPLE(fence);}
+void m_glGetBufferParameterui64vNV_lazy(GLenum target,GLenum pname,GLuint64EXT* params)const{if(!this->m_glGetBufferParameterui64vNV)this->m_resolveOrThrow(1694);this->m_glGetBufferParameterui64vNV(target,pname,params);}
+void m_glVertexAttribI4bvEXT_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttribI4bvEXT)this->m_resolveOrThrow(1695);this->m_glVertexAttribI4bvEXT(index,v);}
+void m_glUniform2fARB_lazy(GLint location,GLfloat v0,GLfloat v1)const{if(!this->m_glUniform2fARB)this->m_resolveOrThrow(1696);this->m_glUniform2fARB(location,v0,v1);}
+void m_glStopInstrumentsSGIX_lazy(GLint marker)const{if(!this->m_glStopInstrumentsSGIX)this->m_resolveOrThrow(1697);this->m_glStopInstrumentsSGIX(marker);}
+void m_glVertexAttrib3fNV_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glVertexAttrib3fNV)this->m_resolveOrThrow(1698);this->m_glVertexAttrib3fNV(index,x,y,z);}
+void m_glMapVertexAttrib2dAPPLE_lazy(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{if(!this->m_glMapVertexAttrib2dAPPLE)this->m_resolveOrThrow(1699);this->m_glMapVertexAttrib2dAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+void m_glVertex2f_lazy(GLfloat x,GLfloat y)const{if(!this->m_glVertex2f)this->m_resolveOrThrow(1700);this->m_glVertex2f(x,y);}
+void m_glCopyTextureImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{if(!this->m_glCopyTextureImage2DEXT)this->m_resolveOrThrow(1701);this->m_glCopyTextureImage2DEXT(texture,target,level,internalformat,x,y,width,height,border);}
+void m_glVertex2d_lazy(GLdouble x,GLdouble y)const{if(!this->m_glVertex2d)this->m_resolveOrThrow(1702);this->m_glVertex2d(x,y);}
+void m_glSecondaryColor3bvEXT_lazy(const GLbyte* v)const{if(!this->m_glSecondaryColor3bvEXT)this->m_resolveOrThrow(1703);this->m_glSecondaryColor3bvEXT(v);}
+void m_glMultiTexCoord4fARB_lazy(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{if(!this->m_glMultiTexCoord4fARB)this->m_resolveOrThrow(1704);this->m_glMultiTexCoord4fARB(target,s,t,r,q);}
+void m_glPolygonOffset_lazy(GLfloat factor,GLfloat units)const{if(!this->m_glPolygonOffset)this->m_resolveOrThrow(1705);this->m_glPolygonOffset(factor,units);}
+void m_glTangent3bvEXT_lazy(const GLbyte* v)const{if(!this->m_glTangent3bvEXT)this->m_resolveOrThrow(1706);this->m_glTangent3bvEXT(v);}
+void m_glHistogram_lazy(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{if(!this->m_glHistogram)this->m_resolveOrThrow(1707);this->m_glHistogram(target,width,internalformat,sink);}
+void m_glGetProgramiv_lazy(GLuint program,GLenum pname,GLint* params)const{if(!this->m_glGetProgramiv)this->m_resolveOrThrow(1708);this->m_glGetProgramiv(program,pname,params);}
+void m_glMatrixIndexubvARB_lazy(GLint size,const GLubyte* indices)const{if(!this->m_glMatrixIndexubvARB)this->m_resolveOrThrow(1709);this->m_glMatrixIndexubvARB(size,indices);}
+void m_glVertex2s_lazy(GLshort x,GLshort y)const{if(!this->m_glVertex2s)this->m_resolveOrThrow(1710);this->m_glVertex2s(x,y);}
+void m_glGetVertexAttribLui64vNV_lazy(GLuint index,GLenum pname,GLuint64EXT* params)const{if(!this->m_glGetVertexAttribLui64vNV)this->m_resolveOrThrow(1711);this->m_glGetVertexAttribLui64vNV(index,pname,params);}
+void m_glGetProgramStringARB_lazy(GLenum target,GLenum pname,void* string)const{if(!this->m_glGetProgramStringARB)this->m_resolveOrThrow(1712);this->m_glGetProgramStringARB(target,pname,string);}
+void m_glFlushMappedBufferRange_lazy(GLenum target,GLintptr offset,GLsizeiptr length)const{if(!this->m_glFlushMappedBufferRange)this->m_resolveOrThrow(1713);this->m_glFlushMappedBufferRange(target,offset,length);}
+void m_glVertexAttribI3uiEXT_lazy(GLuint index,GLuint x,GLuint y,GLuint z)const{if(!this->m_glVertexAttribI3uiEXT)this->m_resolveOrThrow(1714);this->m_glVertexAttribI3uiEXT(index,x,y,z);}
+void m_glLineWidthxOES_lazy(GLfixed width)const{if(!this->m_glLineWidthxOES)this->m_resolveOrThrow(1715);this->m_glLineWidthxOES(width);}
+void m_glProgramUniformMatrix2fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2fvEXT)this->m_resolveOrThrow(1716);this->m_glProgramUniformMatrix2fvEXT(program,location,count,transpose,value);}
+void m_glGetTextureParameterIuivEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLuint* params)const{if(!this->m_glGetTextureParameterIuivEXT)this->m_resolveOrThrow(1717);this->m_glGetTextureParameterIuivEXT(texture,target,pname,params);}
+void m_glGetMultiTexEnvivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMultiTexEnvivEXT)this->m_resolveOrThrow(1718);this->m_glGetMultiTexEnvivEXT(texunit,target,pname,params);}
+void m_glPixelTexGenParameterivSGIS_lazy(GLenum pname,const GLint* params)const{if(!this->m_glPixelTexGenParameterivSGIS)this->m_resolveOrThrow(1719);this->m_glPixelTexGenParameterivSGIS(pname,params);}
+void m_glGenQueries_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glGenQueries)this->m_resolveOrThrow(1720);this->m_glGenQueries(n,ids);}
+void m_glGetPixelMapfv_lazy(GLenum map,GLfloat* values)const{if(!this->m_glGetPixelMapfv)this->m_resolveOrThrow(1721);this->m_glGetPixelMapfv(map,values);}
+void m_glBlendColorEXT_lazy(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{if(!this->m_glBlendColorEXT)this->m_resolveOrThrow(1722);this->m_glBlendColorEXT(red,green,blue,alpha);}
+void m_glResetMinmax_lazy(GLenum target)const{if(!this->m_glResetMinmax)this->m_resolveOrThrow(1723);this->m_glResetMinmax(target);}
+void m_glGetnUniformivARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{if(!this->m_glGetnUniformivARB)this->m_resolveOrThrow(1724);this->m_glGetnUniformivARB(program,location,bufSize,params);}
+void m_glVertexBlendARB_lazy(GLint count)const{if(!this->m_glVertexBlendARB)this->m_resolveOrThrow(1725);this->m_glVertexBlendARB(count);}
+void m_glVertexAttrib4d_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexAttrib4d)this->m_resolveOrThrow(1726);this->m_glVertexAttrib4d(index,x,y,z,w);}
+GLint m_glGetVaryingLocationNV_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetVaryingLocationNV)this->m_resolveOrThrow(1727);return this->m_glGetVaryingLocationNV(program,name);}
+void m_glGetMapAttribParameterivNV_lazy(GLenum target,GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetMapAttribParameterivNV)this->m_resolveOrThrow(1728);this->m_glGetMapAttribParameterivNV(target,index,pname,params);}
+void m_glTexSubImage3D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexSubImage3D)this->m_resolveOrThrow(1729);this->m_glTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+void m_glDeleteSamplers_lazy(GLsizei count,const GLuint* samplers)const{if(!this->m_glDeleteSamplers)this->m_resolveOrThrow(1730);this->m_glDeleteSamplers(count,samplers);}
+void m_glGetLightxOES_lazy(GLenum light,GLenum pname,GLfixed* params)const{if(!this->m_glGetLightxOES)this->m_resolveOrThrow(1731);this->m_glGetLightxOES(light,pname,params);}
+void m_glGetVertexAttribArrayObjectfvATI_lazy(GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetVertexAttribArrayObjectfvATI)this->m_resolveOrThrow(1732);this->m_glGetVertexAttribArrayObjectfvATI(index,pname,params);}
+void m_glVertexArrayNormalOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayNormalOffsetEXT)this->m_resolveOrThrow(1733);this->m_glVertexArrayNormalOffsetEXT(vaobj,buffer,type,stride,offset);}
+void m_glGetBufferParameterivARB_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetBufferParameterivARB)this->m_resolveOrThrow(1734);this->m_glGetBufferParameterivARB(target,pname,params);}
+void m_glGetTextureParameterfv_lazy(GLuint texture,GLenum pname,GLfloat* params)const{if(!this->m_glGetTextureParameterfv)this->m_resolveOrThrow(1735);this->m_glGetTextureParameterfv(texture,pname,params);}
+void m_glDrawMeshArraysSUN_lazy(GLenum mode,GLint first,GLsizei count,GLsizei width)const{if(!this->m_glDrawMeshArraysSUN)this->m_resolveOrThrow(1736);this->m_glDrawMeshArraysSUN(mode,first,count,width);}
+void m_glVertexAttrib4dNV_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexAttrib4dNV)this->m_resolveOrThrow(1737);this->m_glVertexAttrib4dNV(index,x,y,z,w);}
+void m_glGetMultisamplefvNV_lazy(GLenum pname,GLuint index,GLfloat* val)const{if(!this->m_glGetMultisamplefvNV)this->m_resolveOrThrow(1738);this->m_glGetMultisamplefvNV(pname,index,val);}
+void* m_glMapObjectBufferATI_lazy(GLuint buffer)const{if(!this->m_glMapObjectBufferATI)this->m_resolveOrThrow(1739);return this->m_glMapObjectBufferATI(buffer);}
+void m_glGetPathCommandsNV_lazy(GLuint path,GLubyte* commands)const{if(!this->m_glGetPathCommandsNV)this->m_resolveOrThrow(1740);this->m_glGetPathCommandsNV(path,commands);}
+void m_glVertexArrayTexCoordOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayTexCoordOffsetEXT)this->m_resolveOrThrow(1741);this->m_glVertexArrayTexCoordOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+void m_glGetHistogram_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values)const{if(!this->m_glGetHistogram)this->m_resolveOrThrow(1742);this->m_glGetHistogram(target,reset,format,type,values);}
+void m_glMatrixMode_lazy(GLenum mode)const{if(!this->m_glMatrixMode)this->m_resolveOrThrow(1743);this->m_glMatrixMode(mode);}
+void m_glColorFormatNV_lazy(GLint size,GLenum type,GLsizei stride)const{if(!this->m_glColorFormatNV)this->m_resolveOrThrow(1744);this->m_glColorFormatNV(size,type,stride);}
+void m_glProgramUniformui64NV_lazy(GLuint program,GLint location,GLuint64EXT value)const{if(!this->m_glProgramUniformui64NV)this->m_resolveOrThrow(1745);this->m_glProgramUniformui64NV(program,location,value);}
+void m_glProgramUniformMatrix4x2fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4x2fvEXT)this->m_resolveOrThrow(1746);this->m_glProgramUniformMatrix4x2fvEXT(program,location,count,transpose,value);}
+void m_glLoadMatrixxOES_lazy(const GLfixed* m)const{if(!this->m_glLoadMatrixxOES)this->m_resolveOrThrow(1747);this->m_glLoadMatrixxOES(m);}
+void m_glGetColorTableParameterfvEXT_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetColorTableParameterfvEXT)this->m_resolveOrThrow(1748);this->m_glGetColorTableParameterfvEXT(target,pname,params);}
+void m_glRasterPos4i_lazy(GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glRasterPos4i)this->m_resolveOrThrow(1749);this->m_glRasterPos4i(x,y,z,w);}
+void m_glVertexAttribL2i64NV_lazy(GLuint index,GLint64EXT x,GLint64EXT y)const{if(!this->m_glVertexAttribL2i64NV)this->m_resolveOrThrow(1750);this->m_glVertexAttribL2i64NV(index,x,y);}
+void m_glBindTextures_lazy(GLuint first,GLsizei count,const GLuint* textures)const{if(!this->m_glBindTextures)this->m_resolveOrThrow(1751);this->m_glBindTextures(first,count,textures);}
+void m_glMatrixRotatefEXT_lazy(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glMatrixRotatefEXT)this->m_resolveOrThrow(1752);this->m_glMatrixRotatefEXT(mode,angle,x,y,z);}
+void m_glGetClipPlanexOES_lazy(GLenum plane,GLfixed* equation)const{if(!this->m_glGetClipPlanexOES)this->m_resolveOrThrow(1753);this->m_glGetClipPlanexOES(plane,equation);}
+void m_glSecondaryColor3uivEXT_lazy(const GLuint* v)const{if(!this->m_glSecondaryColor3uivEXT)this->m_resolveOrThrow(1754);this->m_glSecondaryColor3uivEXT(v);}
+void m_glGetPerfQueryInfoINTEL_lazy(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask)const{if(!this->m_glGetPerfQueryInfoINTEL)this->m_resolveOrThrow(1755);this->m_glGetPerfQueryInfoINTEL(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);}
+void m_glGetDoublev_lazy(GLenum pname,GLdouble* params)const{if(!this->m_glGetDoublev)this->m_resolveOrThrow(1756);this->m_glGetDoublev(pname,params);}
+void m_glBindBufferRangeEXT_lazy(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glBindBufferRangeEXT)this->m_resolveOrThrow(1757);this->m_glBindBufferRangeEXT(target,index,buffer,offset,size);}
+void m_glCompressedTexImage2D_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexImage2D)this->m_resolveOrThrow(1758);this->m_glCompressedTexImage2D(target,level,internalformat,width,height,border,imageSize,data);}
+void* m_glMapBufferARB_lazy(GLenum target,GLenum access)const{if(!this->m_glMapBufferARB)this->m_resolveOrThrow(1759);return this->m_glMapBufferARB(target,access);}
+void m_glGetPathSpacingNV_lazy(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing)const{if(!this->m_glGetPathSpacingNV)this->m_resolveOrThrow(1760);this->m_glGetPathSpacingNV(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);}
+void m_glUniform4dv_lazy(GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glUniform4dv)this->m_resolveOrThrow(1761);this->m_glUniform4dv(location,count,value);}
+void m_glGlobalAlphaFactordSUN_lazy(GLdouble factor)const{if(!this->m_glGlobalAlphaFactordSUN)this->m_resolveOrThrow(1762);this->m_glGlobalAlphaFactordSUN(factor);}
+void m_glProgramUniform3dv_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform3dv)this->m_resolveOrThrow(1763);this->m_glProgramUniform3dv(program,location,count,value);}
+void m_glGetShaderSourceARB_lazy(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source)const{if(!this->m_glGetShaderSourceARB)this->m_resolveOrThrow(1764);this->m_glGetShaderSourceARB(obj,maxLength,length,source);}
+void m_glVertexAttrib3dvARB_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib3dvARB)this->m_resolveOrThrow(1765);this->m_glVertexAttrib3dvARB(index,v);}
+void m_glInvalidateBufferData_lazy(GLuint buffer)const{if(!this->m_glInvalidateBufferData)this->m_resolveOrThrow(1766);this->m_glInvalidateBufferData(buffer);}
+void m_glMatrixLoad3x2fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixLoad3x2fNV)this->m_resolveOrThrow(1767);this->m_glMatrixLoad3x2fNV(matrixMode,m);}
+void m_glCompressedTextureSubImage1D_lazy(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTextureSubImage1D)this->m_resolveOrThrow(1768);this->m_glCompressedTextureSubImage1D(texture,level,xoffset,width,format,imageSize,data);}
+void m_glTexCoord3xvOES_lazy(const GLfixed* coords)const{if(!this->m_glTexCoord3xvOES)this->m_resolveOrThrow(1769);this->m_glTexCoord3xvOES(coords);}
+void m_glGenTexturesEXT_lazy(GLsizei n,GLuint* textures)const{if(!this->m_glGenTexturesEXT)this->m_resolveOrThrow(1770);this->m_glGenTexturesEXT(n,textures);}
+void m_glTangent3iEXT_lazy(GLint tx,GLint ty,GLint tz)const{if(!this->m_glTangent3iEXT)this->m_resolveOrThrow(1771);this->m_glTangent3iEXT(tx,ty,tz);}
+void m_glClearTexImage_lazy(GLuint texture,GLint level,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearTexImage)this->m_resolveOrThrow(1772);this->m_glClearTexImage(texture,level,format,type,data);}
+void m_glBinormal3bvEXT_lazy(const GLbyte* v)const{if(!this->m_glBinormal3bvEXT)this->m_resolveOrThrow(1773);this->m_glBinormal3bvEXT(v);}
+void m_glUniform3fv_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform3fv)this->m_resolveOrThrow(1774);this->m_glUniform3fv(location,count,value);}
+void m_glGetnPixelMapusvARB_lazy(GLenum map,GLsizei bufSize,GLushort* values)const{if(!this->m_glGetnPixelMapusvARB)this->m_resolveOrThrow(1775);this->m_glGetnPixelMapusvARB(map,bufSize,values);}
+void m_glMemoryObjectParameterivEXT_lazy(GLuint memoryObject,GLenum pname,const GLint* params)const{if(!this->m_glMemoryObjectParameterivEXT)this->m_resolveOrThrow(1776);this->m_glMemoryObjectParameterivEXT(memoryObject,pname,params);}
+void m_glGenSemaphoresEXT_lazy(GLsizei n,GLuint* semaphores)const{if(!this->m_glGenSemaphoresEXT)this->m_resolveOrThrow(1777);this->m_glGenSemaphoresEXT(n,semaphores);}
+void m_glMultiTexCoordP1ui_lazy(GLenum texture,GLenum type,GLuint coords)const{if(!this->m_glMultiTexCoordP1ui)this->m_resolveOrThrow(1778);this->m_glMultiTexCoordP1ui(texture,type,coords);}
+void m_glClearNamedBufferDataEXT_lazy(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearNamedBufferDataEXT)this->m_resolveOrThrow(1779);this->m_glClearNamedBufferDataEXT(buffer,internalformat,format,type,data);}
+void m_glUniformMatrix4dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix4dv)this->m_resolveOrThrow(1780);this->m_glUniformMatrix4dv(location,count,transpose,value);}
+void m_glWindowPos3fMESA_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glWindowPos3fMESA)this->m_resolveOrThrow(1781);this->m_glWindowPos3fMESA(x,y,z);}
+void m_glDeleteRenderbuffers_lazy(GLsizei n,const GLuint* renderbuffers)const{if(!this->m_glDeleteRenderbuffers)this->m_resolveOrThrow(1782);this->m_glDeleteRenderbuffers(n,renderbuffers);}
+void m_glGetTextureLevelParameterfvEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params)const{if(!this->m_glGetTextureLevelParameterfvEXT)this->m_resolveOrThrow(1783);this->m_glGetTextureLevelParameterfvEXT(texture,target,level,pname,params);}
+void m_glGetHistogramParameterxvOES_lazy(GLenum target,GLenum pname,GLfixed* params)const{if(!this->m_glGetHistogramParameterxvOES)this->m_resolveOrThrow(1784);this->m_glGetHistogramParameterxvOES(target,pname,params);}
+void m_glMultiDrawElements_lazy(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount)const{if(!this->m_glMultiDrawElements)this->m_resolveOrThrow(1785);this->m_glMultiDrawElements(mode,count,type,indices,drawcount);}
+void m_glMakeImageHandleNonResidentNV_lazy(GLuint64 handle)const{if(!this->m_glMakeImageHandleNonResidentNV)this->m_resolveOrThrow(1786);this->m_glMakeImageHandleNonResidentNV(handle);}
+void m_glTexSubImage1DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexSubImage1DEXT)this->m_resolveOrThrow(1787);this->m_glTexSubImage1DEXT(target,level,xoffset,width,format,type,pixels);}
+void m_glNormalStream3dATI_lazy(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz)const{if(!this->m_glNormalStream3dATI)this->m_resolveOrThrow(1788);this->m_glNormalStream3dATI(stream,nx,ny,nz);}
+void m_glVertexAttribL4i64vNV_lazy(GLuint index,const GLint64EXT* v)const{if(!this->m_glVertexAttribL4i64vNV)this->m_resolveOrThrow(1789);this->m_glVertexAttribL4i64vNV(index,v);}
+void m_glDrawBuffers_lazy(GLsizei n,const GLenum* bufs)const{if(!this->m_glDrawBuffers)this->m_resolveOrThrow(1790);this->m_glDrawBuffers(n,bufs);}
+void m_glCopyTextureSubImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyTextureSubImage1DEXT)this->m_resolveOrThrow(1791);this->m_glCopyTextureSubImage1DEXT(texture,target,level,xoffset,x,y,width);}
+void m_glWindowRectanglesEXT_lazy(GLenum mode,GLsizei count,const GLint* box)const{if(!this->m_glWindowRectanglesEXT)this->m_resolveOrThrow(1792);this->m_glWindowRectanglesEXT(mode,count,box);}
+void m_glNamedFramebufferReadBuffer_lazy(GLuint framebuffer,GLenum src)const{if(!this->m_glNamedFramebufferReadBuffer)this->m_resolveOrThrow(1793);this->m_glNamedFramebufferReadBuffer(framebuffer,src);}
+void m_glUniform2i64vARB_lazy(GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glUniform2i64vARB)this->m_resolveOrThrow(1794);this->m_glUniform2i64vARB(location,count,value);}
+void m_glVertexAttribI1uivEXT_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI1uivEXT)this->m_resolveOrThrow(1795);this->m_glVertexAttribI1uivEXT(index,v);}
+void m_glGetTexGenfv_lazy(GLenum coord,GLenum pname,GLfloat* params)const{if(!this->m_glGetTexGenfv)this->m_resolveOrThrow(1796);this->m_glGetTexGenfv(coord,pname,params);}
+void m_glBeginQueryARB_lazy(GLenum target,GLuint id)const{if(!this->m_glBeginQueryARB)this->m_resolveOrThrow(1797);this->m_glBeginQueryARB(target,id);}
+void m_glUniform1iARB_lazy(GLint location,GLint v0)const{if(!this->m_glUniform1iARB)this->m_resolveOrThrow(1798);this->m_glUniform1iARB(location,v0);}
+void m_glVertex4bvOES_lazy(const GLbyte* coords)const{if(!this->m_glVertex4bvOES)this->m_resolveOrThrow(1799);this->m_glVertex4bvOES(coords);}
+void m_glInvalidateSubFramebuffer_lazy(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glInvalidateSubFramebuffer)this->m_resolveOrThrow(1800);this->m_glInvalidateSubFramebuffer(target,numAttachments,attachments,x,y,width,height);}
+void m_glUniform1fvARB_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform1fvARB)this->m_resolveOrThrow(1801);this->m_glUniform1fvARB(location,count,value);}
+GLboolean m_glTestFenceNV_lazy(GLuint fence)const{if(!this->m_glTestFenceNV)this->m_resolveOrThrow(1802);return this->m_glTestFenceNV(fence);}
+void m_glBindTransformFeedback_lazy(GLenum target,GLuint id)const{if(!this->m_glBindTransformFeedback)this->m_resolveOrThrow(1803);this->m_glBindTransformFeedback(target,id);}
+void m_glMultiTexCoord2iv_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord2iv)this->m_resolveOrThrow(1804);this->m_glMultiTexCoord2iv(target,v);}
+void m_glCopyMultiTexSubImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyMultiTexSubImage1DEXT)this->m_resolveOrThrow(1805);this->m_glCopyMultiTexSubImage1DEXT(texunit,target,level,xoffset,x,y,width);}
+void m_glVariantbvEXT_lazy(GLuint id,const GLbyte* addr)const{if(!this->m_glVariantbvEXT)this->m_resolveOrThrow(1806);this->m_glVariantbvEXT(id,addr);}
+void m_glTexCoord1hNV_lazy(GLhalfNV s)const{if(!this->m_glTexCoord1hNV)this->m_resolveOrThrow(1807);this->m_glTexCoord1hNV(s);}
+void m_glGenFencesNV_lazy(GLsizei n,GLuint* fences)const{if(!this->m_glGenFencesNV)this->m_resolveOrThrow(1808);this->m_glGenFencesNV(n,fences);}
+void m_glRasterPos3iv_lazy(const GLint* v)const{if(!this->m_glRasterPos3iv)this->m_resolveOrThrow(1809);this->m_glRasterPos3iv(v);}
+void m_glVertexAttribL2ui64NV_lazy(GLuint index,GLuint64EXT x,GLuint64EXT y)const{if(!this->m_glVertexAttribL2ui64NV)this->m_resolveOrThrow(1810);this->m_glVertexAttribL2ui64NV(index,x,y);}
+void m_glMultiTexCoord1hvNV_lazy(GLenum target,const GLhalfNV* v)const{if(!this->m_glMultiTexCoord1hvNV)this->m_resolveOrThrow(1811);this->m_glMultiTexCoord1hvNV(target,v);}
+void m_glGetnConvolutionFilter_lazy(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{if(!this->m_glGetnConvolutionFilter)this->m_resolveOrThrow(1812);this->m_glGetnConvolutionFilter(target,format,type,bufSize,image);}
+void m_glNormal3bv_lazy(const GLbyte* v)const{if(!this->m_glNormal3bv)this->m_resolveOrThrow(1813);this->m_glNormal3bv(v);}
+void m_glWeightbvARB_lazy(GLint size,const GLbyte* weights)const{if(!this->m_glWeightbvARB)this->m_resolveOrThrow(1814);this->m_glWeightbvARB(size,weights);}
+void m_glTexCoord4sv_lazy(const GLshort* v)const{if(!this->m_glTexCoord4sv)this->m_resolveOrThrow(1815);this->m_glTexCoord4sv(v);}
+void m_glUniform2uiv_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform2uiv)this->m_resolveOrThrow(1816);this->m_glUniform2uiv(location,count,value);}
+void m_glBeginConditionalRenderNVX_lazy(GLuint id)const{if(!this->m_glBeginConditionalRenderNVX)this->m_resolveOrThrow(1817);this->m_glBeginConditionalRenderNVX(id);}
+void m_glFinish_lazy()const{if(!this->m_glFinish)this->m_resolveOrThrow(1818);this->m_glFinish();}
+void m_glColorTableParameterfv_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glColorTableParameterfv)this->m_resolveOrThrow(1819);this->m_glColorTableParameterfv(target,pname,params);}
+void m_glFragmentCoverageColorNV_lazy(GLuint color)const{if(!this->m_glFragmentCoverageColorNV)this->m_resolveOrThrow(1820);this->m_glFragmentCoverageColorNV(color);}
+void m_glProgramUniform3ivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform3ivEXT)this->m_resolveOrThrow(1821);this->m_glProgramUniform3ivEXT(program,location,count,value);}
+void m_glVertexArrayVertexOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayVertexOffsetEXT)this->m_resolveOrThrow(1822);this->m_glVertexArrayVertexOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+void m_glViewportPositionWScaleNV_lazy(GLuint index,GLfloat xcoeff,GLfloat ycoeff)const{if(!this->m_glViewportPositionWScaleNV)this->m_resolveOrThrow(1823);this->m_glViewportPositionWScaleNV(index,xcoeff,ycoeff);}
+void m_glGetProgramLocalParameterIuivNV_lazy(GLenum target,GLuint index,GLuint* params)const{if(!this->m_glGetProgramLocalParameterIuivNV)this->m_resolveOrThrow(1824);this->m_glGetProgramLocalParameterIuivNV(target,index,params);}
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_lazy(const GLuint* rc,const GLfloat* tc,const GLfloat* v)const{if(!this->m_glReplacementCodeuiTexCoord2fVertex3fvSUN)this->m_resolveOrThrow(1825);this->m_glReplacementCodeuiTexCoord2fVertex3fvSUN(rc,tc,v);}
+void m_glUniform1uiv_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform1uiv)this->m_resolveOrThrow(1826);this->m_glUniform1uiv(location,count,value);}
+void m_glUniformMatrix2dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix2dv)this->m_resolveOrThrow(1827);this->m_glUniformMatrix2dv(location,count,transpose,value);}
+void m_glIndexdv_lazy(const GLdouble* c)const{if(!this->m_glIndexdv)this->m_resolveOrThrow(1828);this->m_glIndexdv(c);}
+void m_glSecondaryColor3ivEXT_lazy(const GLint* v)const{if(!this->m_glSecondaryColor3ivEXT)this->m_resolveOrThrow(1829);this->m_glSecondaryColor3ivEXT(v);}
+void m_glTexCoord3iv_lazy(const GLint* v)const{if(!this->m_glTexCoord3iv)this->m_resolveOrThrow(1830);this->m_glTexCoord3iv(v);}
+void m_glVertexStream4fvATI_lazy(GLenum stream,const GLfloat* coords)const{if(!this->m_glVertexStream4fvATI)this->m_resolveOrThrow(1831);this->m_glVertexStream4fvATI(stream,coords);}
+void m_glDeformationMap3fSGIX_lazy(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points)const{if(!this->m_glDeformationMap3fSGIX)this->m_resolveOrThrow(1832);this->m_glDeformationMap3fSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+void m_glClearDepth_lazy(GLclampd depth)const{if(!this->m_glClearDepth)this->m_resolveOrThrow(1833);this->m_glClearDepth(depth);}
+GLuint m_glGenAsyncMarkersSGIX_lazy(GLsizei range)const{if(!this->m_glGenAsyncMarkersSGIX)this->m_resolveOrThrow(1834);return this->m_glGenAsyncMarkersSGIX(range);}
+void m_glDisableIndexedEXT_lazy(GLenum target,GLuint index)const{if(!this->m_glDisableIndexedEXT)this->m_resolveOrThrow(1835);this->m_glDisableIndexedEXT(target,index);}
+void m_glVertexWeightfvEXT_lazy(const GLfloat* weight)const{if(!this->m_glVertexWeightfvEXT)this->m_resolveOrThrow(1836);this->m_glVertexWeightfvEXT(weight);}
+void m_glGetProgramLocalParameterIivNV_lazy(GLenum target,GLuint index,GLint* params)const{if(!this->m_glGetProgramLocalParameterIivNV)this->m_resolveOrThrow(1837);this->m_glGetProgramLocalParameterIivNV(target,index,params);}
+void m_glCompressedTexImage3DARB_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexImage3DARB)this->m_resolveOrThrow(1838);this->m_glCompressedTexImage3DARB(target,level,internalformat,width,height,depth,border,imageSize,data);}
+void m_glProgramParameter4fNV_lazy(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glProgramParameter4fNV)this->m_resolveOrThrow(1839);this->m_glProgramParameter4fNV(target,index,x,y,z,w);}
+void m_glConvolutionParameterxOES_lazy(GLenum target,GLenum pname,GLfixed param)const{if(!this->m_glConvolutionParameterxOES)this->m_resolveOrThrow(1840);this->m_glConvolutionParameterxOES(target,pname,param);}
+void m_glInsertComponentEXT_lazy(GLuint res,GLuint src,GLuint num)const{if(!this->m_glInsertComponentEXT)this->m_resolveOrThrow(1841);this->m_glInsertComponentEXT(res,src,num);}
+void m_glCreateTextures_lazy(GLenum target,GLsizei n,GLuint* textures)const{if(!this->m_glCreateTextures)this->m_resolveOrThrow(1842);this->m_glCreateTextures(target,n,textures);}
+void m_glSecondaryColor3iv_lazy(const GLint* v)const{if(!this->m_glSecondaryColor3iv)this->m_resolveOrThrow(1843);this->m_glSecondaryColor3iv(v);}
+void m_glCreateBuffers_lazy(GLsizei n,GLuint* buffers)const{if(!this->m_glCreateBuffers)this->m_resolveOrThrow(1844);this->m_glCreateBuffers(n,buffers);}
+void m_glMultiTexCoord2xvOES_lazy(GLenum texture,const GLfixed* coords)const{if(!this->m_glMultiTexCoord2xvOES)this->m_resolveOrThrow(1845);this->m_glMultiTexCoord2xvOES(texture,coords);}
+void m_glTexGenxvOES_lazy(GLenum coord,GLenum pname,const GLfixed* params)const{if(!this->m_glTexGenxvOES)this->m_resolveOrThrow(1846);this->m_glTexGenxvOES(coord,pname,params);}
+void m_glMultTransposeMatrixf_lazy(const GLfloat m[16])const{if(!this->m_glMultTransposeMatrixf)this->m_resolveOrThrow(1847);this->m_glMultTransposeMatrixf(m);}
+void m_glBeginTransformFeedbackEXT_lazy(GLenum primitiveMode)const{if(!this->m_glBeginTransformFeedbackEXT)this->m_resolveOrThrow(1848);this->m_glBeginTransformFeedbackEXT(primitiveMode);}
+void m_glTexCoord2fColor3fVertex3fSUN_lazy(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTexCoord2fColor3fVertex3fSUN)this->m_resolveOrThrow(1849);this->m_glTexCoord2fColor3fVertex3fSUN(s,t,r,g,b,x,y,z);}
+void m_glNormal3sv_lazy(const GLshort* v)const{if(!this->m_glNormal3sv)this->m_resolveOrThrow(1850);this->m_glNormal3sv(v);}
+void m_glFreeObjectBufferATI_lazy(GLuint buffer)const{if(!this->m_glFreeObjectBufferATI)this->m_resolveOrThrow(1851);this->m_glFreeObjectBufferATI(buffer);}
+void m_glBlendBarrierNV_lazy()const{if(!this->m_glBlendBarrierNV)this->m_resolveOrThrow(1852);this->m_glBlendBarrierNV();}
+void m_glUniform4i64vNV_lazy(GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glUniform4i64vNV)this->m_resolveOrThrow(1853);this->m_glUniform4i64vNV(location,count,value);}
+void m_glGetnUniformuivARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{if(!this->m_glGetnUniformuivARB)this->m_resolveOrThrow(1854);this->m_glGetnUniformuivARB(program,location,bufSize,params);}
+void m_glAlphaFragmentOp3ATI_lazy(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{if(!this->m_glAlphaFragmentOp3ATI)this->m_resolveOrThrow(1855);this->m_glAlphaFragmentOp3ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+void m_glProgramEnvParameters4fvEXT_lazy(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{if(!this->m_glProgramEnvParameters4fvEXT)this->m_resolveOrThrow(1856);this->m_glProgramEnvParameters4fvEXT(target,index,count,params);}
+void m_glBlendFuncSeparateEXT_lazy(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{if(!this->m_glBlendFuncSeparateEXT)this->m_resolveOrThrow(1857);this->m_glBlendFuncSeparateEXT(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+void m_glConvolutionParameterivEXT_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glConvolutionParameterivEXT)this->m_resolveOrThrow(1858);this->m_glConvolutionParameterivEXT(target,pname,params);}
+void m_glPixelTexGenSGIX_lazy(GLenum mode)const{if(!this->m_glPixelTexGenSGIX)this->m_resolveOrThrow(1859);this->m_glPixelTexGenSGIX(mode);}
+void m_glDeleteProgram_lazy(GLuint program)const{if(!this->m_glDeleteProgram)this->m_resolveOrThrow(1860);this->m_glDeleteProgram(program);}
+void m_glUniformMatrix4x3dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix4x3dv)this->m_resolveOrThrow(1861);this->m_glUniformMatrix4x3dv(location,count,transpose,value);}
+void m_glGetVideoCaptureStreamivNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params)const{if(!this->m_glGetVideoCaptureStreamivNV)this->m_resolveOrThrow(1862);this->m_glGetVideoCaptureStreamivNV(video_capture_slot,stream,pname,params);}
+void m_glProgramUniform4uiEXT_lazy(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{if(!this->m_glProgramUniform4uiEXT)this->m_resolveOrThrow(1863);this->m_glProgramUniform4uiEXT(program,location,v0,v1,v2,v3);}
+void m_glMakeImageHandleNonResidentARB_lazy(GLuint64 handle)const{if(!this->m_glMakeImageHandleNonResidentARB)this->m_resolveOrThrow(1864);this->m_glMakeImageHandleNonResidentARB(handle);}
+void m_glSecondaryColor3dEXT_lazy(GLdouble red,GLdouble green,GLdouble blue)const{if(!this->m_glSecondaryColor3dEXT)this->m_resolveOrThrow(1865);this->m_glSecondaryColor3dEXT(red,green,blue);}
+void m_glDeleteQueries_lazy(GLsizei n,const GLuint* ids)const{if(!this->m_glDeleteQueries)this->m_resolveOrThrow(1866);this->m_glDeleteQueries(n,ids);}
+void m_glNormalP3uiv_lazy(GLenum type,const GLuint* coords)const{if(!this->m_glNormalP3uiv)this->m_resolveOrThrow(1867);this->m_glNormalP3uiv(type,coords);}
+void m_glRasterPos2d_lazy(GLdouble x,GLdouble y)const{if(!this->m_glRasterPos2d)this->m_resolveOrThrow(1868);this->m_glRasterPos2d(x,y);}
+void m_glInitNames_lazy()const{if(!this->m_glInitNames)this->m_resolveOrThrow(1869);this->m_glInitNames();}
+void m_glBinormal3fvEXT_lazy(const GLfloat* v)const{if(!this->m_glBinormal3fvEXT)this->m_resolveOrThrow(1870);this->m_glBinormal3fvEXT(v);}
+void m_glColor3dv_lazy(const GLdouble* v)const{if(!this->m_glColor3dv)this->m_resolveOrThrow(1871);this->m_glColor3dv(v);}
+void m_glVertexArrayVertexAttribDivisorEXT_lazy(GLuint vaobj,GLuint index,GLuint divisor)const{if(!this->m_glVertexArrayVertexAttribDivisorEXT)this->m_resolveOrThrow(1872);this->m_glVertexArrayVertexAttribDivisorEXT(vaobj,index,divisor);}
+void m_glArrayElementEXT_lazy(GLint i)const{if(!this->m_glArrayElementEXT)this->m_resolveOrThrow(1873);this->m_glArrayElementEXT(i);}
+void m_glProgramParameter4dNV_lazy(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glProgramParameter4dNV)this->m_resolveOrThrow(1874);this->m_glProgramParameter4dNV(target,index,x,y,z,w);}
+void m_glIndexxOES_lazy(GLfixed component)const{if(!this->m_glIndexxOES)this->m_resolveOrThrow(1875);this->m_glIndexxOES(component);}
+void m_glUniform3uivEXT_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform3uivEXT)this->m_resolveOrThrow(1876);this->m_glUniform3uivEXT(location,count,value);}
+void m_glPopGroupMarkerEXT_lazy()const{if(!this->m_glPopGroupMarkerEXT)this->m_resolveOrThrow(1877);this->m_glPopGroupMarkerEXT();}
+void m_glClearNamedFramebufferuiv_lazy(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value)const{if(!this->m_glClearNamedFramebufferuiv)this->m_resolveOrThrow(1878);this->m_glClearNamedFramebufferuiv(framebuffer,buffer,drawbuffer,value);}
+void m_glSetLocalConstantEXT_lazy(GLuint id,GLenum type,const void* addr)const{if(!this->m_glSetLocalConstantEXT)this->m_resolveOrThrow(1879);this->m_glSetLocalConstantEXT(id,type,addr);}
+void m_glProgramUniform1ui64NV_lazy(GLuint program,GLint location,GLuint64EXT x)const{if(!this->m_glProgramUniform1ui64NV)this->m_resolveOrThrow(1880);this->m_glProgramUniform1ui64NV(program,location,x);}
+void m_glColor4hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glColor4hvNV)this->m_resolveOrThrow(1881);this->m_glColor4hvNV(v);}
+void m_glGetVertexAttribfv_lazy(GLuint index,GLenum pname,GLfloat* params)const{if(!this->m_glGetVertexAttribfv)this->m_resolveOrThrow(1882);this->m_glGetVertexAttribfv(index,pname,params);}
+void m_glDispatchCompute_lazy(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z)const{if(!this->m_glDispatchCompute)this->m_resolveOrThrow(1883);this->m_glDispatchCompute(num_groups_x,num_groups_y,num_groups_z);}
+void m_glGetActiveAttrib_lazy(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{if(!this->m_glGetActiveAttrib)this->m_resolveOrThrow(1884);this->m_glGetActiveAttrib(program,index,bufSize,length,size,type,name);}
+void m_glFragmentColorMaterialSGIX_lazy(GLenum face,GLenum mode)const{if(!this->m_glFragmentColorMaterialSGIX)this->m_resolveOrThrow(1885);this->m_glFragmentColorMaterialSGIX(face,mode);}
+void m_glTexSubImage2D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexSubImage2D)this->m_resolveOrThrow(1886);this->m_glTexSubImage2D(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+void m_glGetnMinmaxARB_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{if(!this->m_glGetnMinmaxARB)this->m_resolveOrThrow(1887);this->m_glGetnMinmaxARB(target,reset,format,type,bufSize,values);}
+void m_glLogicOp_lazy(GLenum opcode)const{if(!this->m_glLogicOp)this->m_resolveOrThrow(1888);this->m_glLogicOp(opcode);}
+void m_glProgramUniformMatrix3x4fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3x4fv)this->m_resolveOrThrow(1889);this->m_glProgramUniformMatrix3x4fv(program,location,count,transpose,value);}
+void m_glWindowPos4iMESA_lazy(GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glWindowPos4iMESA)this->m_resolveOrThrow(1890);this->m_glWindowPos4iMESA(x,y,z,w);}
+void m_glPixelTransferf_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPixelTransferf)this->m_resolveOrThrow(1891);this->m_glPixelTransferf(pname,param);}
+void m_glGetTextureParameterIuiv_lazy(GLuint texture,GLenum pname,GLuint* params)const{if(!this->m_glGetTextureParameterIuiv)this->m_resolveOrThrow(1892);this->m_glGetTextureParameterIuiv(texture,pname,params);}
+void m_glMultiTexCoord1xOES_lazy(GLenum texture,GLfixed s)const{if(!this->m_glMultiTexCoord1xOES)this->m_resolveOrThrow(1893);this->m_glMultiTexCoord1xOES(texture,s);}
+void m_glProgramUniformMatrix4dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4dv)this->m_resolveOrThrow(1894);this->m_glProgramUniformMatrix4dv(program,location,count,transpose,value);}
+void m_glGetnUniformiv_lazy(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{if(!this->m_glGetnUniformiv)this->m_resolveOrThrow(1895);this->m_glGetnUniformiv(program,location,bufSize,params);}
+void m_glFramebufferTexture1DEXT_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glFramebufferTexture1DEXT)this->m_resolveOrThrow(1896);this->m_glFramebufferTexture1DEXT(target,attachment,textarget,texture,level);}
+void m_glVertexPointervINTEL_lazy(GLint size,GLenum type,const void** pointer)const{if(!this->m_glVertexPointervINTEL)this->m_resolveOrThrow(1897);this->m_glVertexPointervINTEL(size,type,pointer);}
+void m_glTextureParameterIiv_lazy(GLuint texture,GLenum pname,const GLint* params)const{if(!this->m_glTextureParameterIiv)this->m_resolveOrThrow(1898);this->m_glTextureParameterIiv(texture,pname,params);}
+void m_glGetSeparableFilterEXT_lazy(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span)const{if(!this->m_glGetSeparableFilterEXT)this->m_resolveOrThrow(1899);this->m_glGetSeparableFilterEXT(target,format,type,row,column,span);}
+void m_glMultiTexCoord3iARB_lazy(GLenum target,GLint s,GLint t,GLint r)const{if(!this->m_glMultiTexCoord3iARB)this->m_resolveOrThrow(1900);this->m_glMultiTexCoord3iARB(target,s,t,r);}
+void m_glRasterPos4xvOES_lazy(const GLfixed* coords)const{if(!this->m_glRasterPos4xvOES)this->m_resolveOrThrow(1901);this->m_glRasterPos4xvOES(coords);}
+void m_glDrawTransformFeedbackStream_lazy(GLenum mode,GLuint id,GLuint stream)const{if(!this->m_glDrawTransformFeedbackStream)this->m_resolveOrThrow(1902);this->m_glDrawTransformFeedbackStream(mode,id,stream);}
+void m_glVertex3hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glVertex3hvNV)this->m_resolveOrThrow(1903);this->m_glVertex3hvNV(v);}
+void m_glVertexArrayMultiTexCoordOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayMultiTexCoordOffsetEXT)this->m_resolveOrThrow(1904);this->m_glVertexArrayMultiTexCoordOffsetEXT(vaobj,buffer,texunit,size,type,stride,offset);}
+void m_glProvokingVertex_lazy(GLenum mode)const{if(!this->m_glProvokingVertex)this->m_resolveOrThrow(1905);this->m_glProvokingVertex(mode);}
+void m_glAccumxOES_lazy(GLenum op,GLfixed value)const{if(!this->m_glAccumxOES)this->m_resolveOrThrow(1906);this->m_glAccumxOES(op,value);}
+void m_glShaderBinary_lazy(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length)const{if(!this->m_glShaderBinary)this->m_resolveOrThrow(1907);this->m_glShaderBinary(count,shaders,binaryformat,binary,length);}
+void m_glGetMultiTexGenivEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLint* params)const{if(!this->m_glGetMultiTexGenivEXT)this->m_resolveOrThrow(1908);this->m_glGetMultiTexGenivEXT(texunit,coord,pname,params);}
+void m_glPointParameterxvOES_lazy(GLenum pname,const GLfixed* params)const{if(!this->m_glPointParameterxvOES)this->m_resolveOrThrow(1909);this->m_glPointParameterxvOES(pname,params);}
+void m_glCreateStatesNV_lazy(GLsizei n,GLuint* states)const{if(!this->m_glCreateStatesNV)this->m_resolveOrThrow(1910);this->m_glCreateStatesNV(n,states);}
+void m_glClearDepthdNV_lazy(GLdouble depth)const{if(!this->m_glClearDepthdNV)this->m_resolveOrThrow(1911);this->m_glClearDepthdNV(depth);}
+void m_glClearColorIuiEXT_lazy(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{if(!this->m_glClearColorIuiEXT)this->m_resolveOrThrow(1912);this->m_glClearColorIuiEXT(red,green,blue,alpha);}
+void m_glBindMultiTextureEXT_lazy(GLenum texunit,GLenum target,GLuint texture)const{if(!this->m_glBindMultiTextureEXT)this->m_resolveOrThrow(1913);this->m_glBindMultiTextureEXT(texunit,target,texture);}
+void m_glTexGeniv_lazy(GLenum coord,GLenum pname,const GLint* params)const{if(!this->m_glTexGeniv)this->m_resolveOrThrow(1914);this->m_glTexGeniv(coord,pname,params);}
+void m_glDrawElements_lazy(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices)const{if(!this->m_glDrawElements)this->m_resolveOrThrow(1915);this->m_glDrawElements(mode,count,type,indices);}
+void m_glProgramUniform4iv_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform4iv)this->m_resolveOrThrow(1916);this->m_glProgramUniform4iv(program,location,count,value);}
+void m_glDisableVertexArrayEXT_lazy(GLuint vaobj,GLenum array)const{if(!this->m_glDisableVertexArrayEXT)this->m_resolveOrThrow(1917);this->m_glDisableVertexArrayEXT(vaobj,array);}
+void m_glProgramUniform3ui64NV_lazy(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{if(!this->m_glProgramUniform3ui64NV)this->m_resolveOrThrow(1918);this->m_glProgramUniform3ui64NV(program,location,x,y,z);}
+void m_glClientActiveTexture_lazy(GLenum texture)const{if(!this->m_glClientActiveTexture)this->m_resolveOrThrow(1919);this->m_glClientActiveTexture(texture);}
+void m_glMultiTexParameterIivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glMultiTexParameterIivEXT)this->m_resolveOrThrow(1920);this->m_glMultiTexParameterIivEXT(texunit,target,pname,params);}
+void m_glUniform1i64ARB_lazy(GLint location,GLint64 x)const{if(!this->m_glUniform1i64ARB)this->m_resolveOrThrow(1921);this->m_glUniform1i64ARB(location,x);}
+void m_glUniform1iv_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform1iv)this->m_resolveOrThrow(1922);this->m_glUniform1iv(location,count,value);}
+void m_glMulticastBarrierNV_lazy()const{if(!this->m_glMulticastBarrierNV)this->m_resolveOrThrow(1923);this->m_glMulticastBarrierNV();}
+void m_glVertexAttribArrayObjectATI_lazy(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset)const{if(!this->m_glVertexAttribArrayObjectATI)this->m_resolveOrThrow(1924);this->m_glVertexAttribArrayObjectATI(index,size,type,normalized,stride,buffer,offset);}
+void m_glUniform2iARB_lazy(GLint location,GLint v0,GLint v1)const{if(!this->m_glUniform2iARB)this->m_resolveOrThrow(1925);this->m_glUniform2iARB(location,v0,v1);}
+void m_glDrawArraysInstanced_lazy(GLenum mode,GLint first,GLsizei count,GLsizei instancecount)const{if(!this->m_glDrawArraysInstanced)this->m_resolveOrThrow(1926);this->m_glDrawArraysInstanced(mode,first,count,instancecount);}
+void m_glVertexAttrib2sNV_lazy(GLuint index,GLshort x,GLshort y)const{if(!this->m_glVertexAttrib2sNV)this->m_resolveOrThrow(1927);this->m_glVertexAttrib2sNV(index,x,y);}
+void m_glTexBufferEXT_lazy(GLenum target,GLenum internalformat,GLuint buffer)const{if(!this->m_glTexBufferEXT)this->m_resolveOrThrow(1928);this->m_glTexBufferEXT(target,internalformat,buffer);}
+void m_glVertexStream2fATI_lazy(GLenum stream,GLfloat x,GLfloat y)const{if(!this->m_glVertexStream2fATI)this->m_resolveOrThrow(1929);this->m_glVertexStream2fATI(stream,x,y);}
+void m_glDebugMessageCallbackAMD_lazy(GLDEBUGPROCAMD callback,void* userParam)const{if(!this->m_glDebugMessageCallbackAMD)this->m_resolveOrThrow(1930);this->m_glDebugMessageCallbackAMD(callback,userParam);}
+void m_glSamplerParameteriv_lazy(GLuint sampler,GLenum pname,const GLint* param)const{if(!this->m_glSamplerParameteriv)this->m_resolveOrThrow(1931);this->m_glSamplerParameteriv(sampler,pname,param);}
+void m_glVertexAttrib4uiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttrib4uiv)this->m_resolveOrThrow(1932);this->m_glVertexAttrib4uiv(index,v);}
+void m_glEndQueryIndexed_lazy(GLenum target,GLuint index)const{if(!this->m_glEndQueryIndexed)this->m_resolveOrThrow(1933);this->m_glEndQueryIndexed(target,index);}
+void m_glNormalStream3sATI_lazy(GLenum stream,GLshort nx,GLshort ny,GLshort nz)const{if(!this->m_glNormalStream3sATI)this->m_resolveOrThrow(1934);this->m_glNormalStream3sATI(stream,nx,ny,nz);}
+void m_glProgramParameteriARB_lazy(GLuint program,GLenum pname,GLint value)const{if(!this->m_glProgramParameteriARB)this->m_resolveOrThrow(1935);this->m_glProgramParameteriARB(program,pname,value);}
+void m_glTexEnvxOES_lazy(GLenum target,GLenum pname,GLfixed param)const{if(!this->m_glTexEnvxOES)this->m_resolveOrThrow(1936);this->m_glTexEnvxOES(target,pname,param);}
+void m_glProgramUniform1iv_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform1iv)this->m_resolveOrThrow(1937);this->m_glProgramUniform1iv(program,location,count,value);}
+void m_glDisableVertexAttribAPPLE_lazy(GLuint index,GLenum pname)const{if(!this->m_glDisableVertexAttribAPPLE)this->m_resolveOrThrow(1938);this->m_glDisableVertexAttribAPPLE(index,pname);}
+void m_glBindRenderbuffer_lazy(GLenum target,GLuint renderbuffer)const{if(!this->m_glBindRenderbuffer)this->m_resolveOrThrow(1939);this->m_glBindRenderbuffer(target,renderbuffer);}
+void m_glMultiTexSubImage3DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glMultiTexSubImage3DEXT)this->m_resolveOrThrow(1940);this->m_glMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+GLboolean m_glIsProgram_lazy(GLuint program)const{if(!this->m_glIsProgram)this->m_resolveOrThrow(1941);return this->m_glIsProgram(program);}
+void m_glMultiDrawElementsIndirectAMD_lazy(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride)const{if(!this->m_glMultiDrawElementsIndirectAMD)this->m_resolveOrThrow(1942);this->m_glMultiDrawElementsIndirectAMD(mode,type,indirect,primcount,stride);}
+void m_glGetProgramInfoLog_lazy(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{if(!this->m_glGetProgramInfoLog)this->m_resolveOrThrow(1943);this->m_glGetProgramInfoLog(program,bufSize,length,infoLog);}
+void m_glGetLocalConstantBooleanvEXT_lazy(GLuint id,GLenum value,GLboolean* data)const{if(!this->m_glGetLocalConstantBooleanvEXT)this->m_resolveOrThrow(1944);this->m_glGetLocalConstantBooleanvEXT(id,value,data);}
+void m_glPixelTransformParameteriEXT_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glPixelTransformParameteriEXT)this->m_resolveOrThrow(1945);this->m_glPixelTransformParameteriEXT(target,pname,param);}
+void m_glTexCoord4bOES_lazy(GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{if(!this->m_glTexCoord4bOES)this->m_resolveOrThrow(1946);this->m_glTexCoord4bOES(s,t,r,q);}
+void m_glVertexAttrib4fv_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib4fv)this->m_resolveOrThrow(1947);this->m_glVertexAttrib4fv(index,v);}
+void m_glProgramUniformMatrix2x3dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2x3dv)this->m_resolveOrThrow(1948);this->m_glProgramUniformMatrix2x3dv(program,location,count,transpose,value);}
+void m_glProgramEnvParametersI4uivNV_lazy(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{if(!this->m_glProgramEnvParametersI4uivNV)this->m_resolveOrThrow(1949);this->m_glProgramEnvParametersI4uivNV(target,index,count,params);}
+void m_glTexCoord3xOES_lazy(GLfixed s,GLfixed t,GLfixed r)const{if(!this->m_glTexCoord3xOES)this->m_resolveOrThrow(1950);this->m_glTexCoord3xOES(s,t,r);}
+void m_glLoadTransposeMatrixfARB_lazy(const GLfloat* m)const{if(!this->m_glLoadTransposeMatrixfARB)this->m_resolveOrThrow(1951);this->m_glLoadTransposeMatrixfARB(m);}
+void m_glImageTransformParameteriHP_lazy(GLenum target,GLenum pname,GLint param)const{if(!this->m_glImageTransformParameteriHP)this->m_resolveOrThrow(1952);this->m_glImageTransformParameteriHP(target,pname,param);}
+void m_glMultiTexCoord4xOES_lazy(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{if(!this->m_glMultiTexCoord4xOES)this->m_resolveOrThrow(1953);this->m_glMultiTexCoord4xOES(texture,s,t,r,q);}
+void m_glVertexAttribs3fvNV_lazy(GLuint index,GLsizei count,const GLfloat* v)const{if(!this->m_glVertexAttribs3fvNV)this->m_resolveOrThrow(1954);this->m_glVertexAttribs3fvNV(index,count,v);}
+void m_glVertexAttrib2fv_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib2fv)this->m_resolveOrThrow(1955);this->m_glVertexAttrib2fv(index,v);}
+void m_glUniform3ui64NV_lazy(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{if(!this->m_glUniform3ui64NV)this->m_resolveOrThrow(1956);this->m_glUniform3ui64NV(location,x,y,z);}
+void m_glCombinerParameterfvNV_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glCombinerParameterfvNV)this->m_resolveOrThrow(1957);this->m_glCombinerParameterfvNV(pname,params);}
+void m_glFragmentMaterialiSGIX_lazy(GLenum face,GLenum pname,GLint param)const{if(!this->m_glFragmentMaterialiSGIX)this->m_resolveOrThrow(1958);this->m_glFragmentMaterialiSGIX(face,pname,param);}
+void m_glGetBooleani_v_lazy(GLenum target,GLuint index,GLboolean* data)const{if(!this->m_glGetBooleani_v)this->m_resolveOrThrow(1959);this->m_glGetBooleani_v(target,index,data);}
+GLuint m_glGetProgramResourceIndex_lazy(GLuint program,GLenum programInterface,const GLchar* name)const{if(!this->m_glGetProgramResourceIndex)this->m_resolveOrThrow(1960);return this->m_glGetProgramResourceIndex(program,programInterface,name);}
+void m_glBeginConditionalRenderNV_lazy(GLuint id,GLenum mode)const{if(!this->m_glBeginConditionalRenderNV)this->m_resolveOrThrow(1961);this->m_glBeginConditionalRenderNV(id,mode);}
+void m_glDisableClientState_lazy(GLenum cap)const{if(!this->m_glDisableClientState)this->m_resolveOrThrow(1962);this->m_glDisableClientState(cap);}
+void m_glPathFogGenNV_lazy(GLenum genMode)const{if(!this->m_glPathFogGenNV)this->m_resolveOrThrow(1963);this->m_glPathFogGenNV(genMode);}
+void m_glStencilThenCoverFillPathNV_lazy(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode)const{if(!this->m_glStencilThenCoverFillPathNV)this->m_resolveOrThrow(1964);this->m_glStencilThenCoverFillPathNV(path,fillMode,mask,coverMode);}
+void m_glVertexArrayIndexOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayIndexOffsetEXT)this->m_resolveOrThrow(1965);this->m_glVertexArrayIndexOffsetEXT(vaobj,buffer,type,stride,offset);}
+void m_glProgramBufferParametersIuivNV_lazy(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params)const{if(!this->m_glProgramBufferParametersIuivNV)this->m_resolveOrThrow(1966);this->m_glProgramBufferParametersIuivNV(target,bindingIndex,wordIndex,count,params);}
+void m_glPixelTransformParameterivEXT_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glPixelTransformParameterivEXT)this->m_resolveOrThrow(1967);this->m_glPixelTransformParameterivEXT(target,pname,params);}
+void m_glDisableClientStateiEXT_lazy(GLenum array,GLuint index)const{if(!this->m_glDisableClientStateiEXT)this->m_resolveOrThrow(1968);this->m_glDisableClientStateiEXT(array,index);}
+void m_glTexBufferARB_lazy(GLenum target,GLenum internalformat,GLuint buffer)const{if(!this->m_glTexBufferARB)this->m_resolveOrThrow(1969);this->m_glTexBufferARB(target,internalformat,buffer);}
+void m_glGetLocalConstantIntegervEXT_lazy(GLuint id,GLenum value,GLint* data)const{if(!this->m_glGetLocalConstantIntegervEXT)this->m_resolveOrThrow(1970);this->m_glGetLocalConstantIntegervEXT(id,value,data);}
+void m_glColor4uiv_lazy(const GLuint* v)const{if(!this->m_glColor4uiv)this->m_resolveOrThrow(1971);this->m_glColor4uiv(v);}
+void m_glProgramUniform3i_lazy(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{if(!this->m_glProgramUniform3i)this->m_resolveOrThrow(1972);this->m_glProgramUniform3i(program,location,v0,v1,v2);}
+void m_glMultiDrawElementsIndirectBindlessCountNV_lazy(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{if(!this->m_glMultiDrawElementsIndirectBindlessCountNV)this->m_resolveOrThrow(1973);this->m_glMultiDrawElementsIndirectBindlessCountNV(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+void m_glGetBufferPointervARB_lazy(GLenum target,GLenum pname,void** params)const{if(!this->m_glGetBufferPointervARB)this->m_resolveOrThrow(1974);this->m_glGetBufferPointervARB(target,pname,params);}
+void m_glMultiTexParameterIuivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLuint* params)const{if(!this->m_glMultiTexParameterIuivEXT)this->m_resolveOrThrow(1975);this->m_glMultiTexParameterIuivEXT(texunit,target,pname,params);}
+void m_glEvalMesh2_lazy(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2)const{if(!this->m_glEvalMesh2)this->m_resolveOrThrow(1976);this->m_glEvalMesh2(mode,i1,i2,j1,j2);}
+void m_glEvalMesh1_lazy(GLenum mode,GLint i1,GLint i2)const{if(!this->m_glEvalMesh1)this->m_resolveOrThrow(1977);this->m_glEvalMesh1(mode,i1,i2);}
+void m_glProgramUniform3f_lazy(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{if(!this->m_glProgramUniform3f)this->m_resolveOrThrow(1978);this->m_glProgramUniform3f(program,location,v0,v1,v2);}
+void m_glStencilThenCoverFillPathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glStencilThenCoverFillPathInstancedNV)this->m_resolveOrThrow(1979);this->m_glStencilThenCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);}
+void m_glProgramUniform3d_lazy(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2)const{if(!this->m_glProgramUniform3d)this->m_resolveOrThrow(1980);this->m_glProgramUniform3d(program,location,v0,v1,v2);}
+void m_glMapVertexAttrib1dAPPLE_lazy(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{if(!this->m_glMapVertexAttrib1dAPPLE)this->m_resolveOrThrow(1981);this->m_glMapVertexAttrib1dAPPLE(index,size,u1,u2,stride,order,points);}
+void m_glEvalCoord2fv_lazy(const GLfloat* u)const{if(!this->m_glEvalCoord2fv)this->m_resolveOrThrow(1982);this->m_glEvalCoord2fv(u);}
+void m_glGetUniformivARB_lazy(GLhandleARB programObj,GLint location,GLint* params)const{if(!this->m_glGetUniformivARB)this->m_resolveOrThrow(1983);this->m_glGetUniformivARB(programObj,location,params);}
+void m_glLoadTransposeMatrixd_lazy(const GLdouble m[16])const{if(!this->m_glLoadTransposeMatrixd)this->m_resolveOrThrow(1984);this->m_glLoadTransposeMatrixd(m);}
+void m_glLoadTransposeMatrixf_lazy(const GLfloat m[16])const{if(!this->m_glLoadTransposeMatrixf)this->m_resolveOrThrow(1985);this->m_glLoadTransposeMatrixf(m);}
+void m_glGetPointervEXT_lazy(GLenum pname,void** params)const{if(!this->m_glGetPointervEXT)this->m_resolveOrThrow(1986);this->m_glGetPointervEXT(pname,params);}
+void m_glSignalVkSemaphoreNV_lazy(GLuint64 vkSemaphore)const{if(!this->m_glSignalVkSemaphoreNV)this->m_resolveOrThrow(1987);this->m_glSignalVkSemaphoreNV(vkSemaphore);}
+void m_glEndConditionalRenderNV_lazy()const{if(!this->m_glEndConditionalRenderNV)this->m_resolveOrThrow(1988);this->m_glEndConditionalRenderNV();}
+void m_glTexCoord2fNormal3fVertex3fSUN_lazy(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTexCoord2fNormal3fVertex3fSUN)this->m_resolveOrThrow(1989);this->m_glTexCoord2fNormal3fVertex3fSUN(s,t,nx,ny,nz,x,y,z);}
+void m_glUniform3i64vARB_lazy(GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glUniform3i64vARB)this->m_resolveOrThrow(1990);this->m_glUniform3i64vARB(location,count,value);}
+void m_glProgramUniform2uiEXT_lazy(GLuint program,GLint location,GLuint v0,GLuint v1)const{if(!this->m_glProgramUniform2uiEXT)this->m_resolveOrThrow(1991);this->m_glProgramUniform2uiEXT(program,location,v0,v1);}
+void m_glVertexAttribI1ui_lazy(GLuint index,GLuint x)const{if(!this->m_glVertexAttribI1ui)this->m_resolveOrThrow(1992);this->m_glVertexAttribI1ui(index,x);}
+void m_glProgramNamedParameter4dvNV_lazy(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v)const{if(!this->m_glProgramNamedParameter4dvNV)this->m_resolveOrThrow(1993);this->m_glProgramNamedParameter4dvNV(id,len,name,v);}
+void m_glCompileCommandListNV_lazy(GLuint list)const{if(!this->m_glCompileCommandListNV)this->m_resolveOrThrow(1994);this->m_glCompileCommandListNV(list);}
+void m_glGetRenderbufferParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetRenderbufferParameterivEXT)this->m_resolveOrThrow(1995);this->m_glGetRenderbufferParameterivEXT(target,pname,params);}
+void m_glGetnPolygonStipple_lazy(GLsizei bufSize,GLubyte* pattern)const{if(!this->m_glGetnPolygonStipple)this->m_resolveOrThrow(1996);this->m_glGetnPolygonStipple(bufSize,pattern);}
+GLboolean m_glIsBufferResidentNV_lazy(GLenum target)const{if(!this->m_glIsBufferResidentNV)this->m_resolveOrThrow(1997);return this->m_glIsBufferResidentNV(target);}
+void m_glSecondaryColor3ubvEXT_lazy(const GLubyte* v)const{if(!this->m_glSecondaryColor3ubvEXT)this->m_resolveOrThrow(1998);this->m_glSecondaryColor3ubvEXT(v);}
+void m_glGetNamedRenderbufferParameterivEXT_lazy(GLuint renderbuffer,GLenum pname,GLint* params)const{if(!this->m_glGetNamedRenderbufferParameterivEXT)this->m_resolveOrThrow(1999);this->m_glGetNamedRenderbufferParameterivEXT(renderbuffer,pname,params);}
+void m_glNamedFramebufferSampleLocationsfvARB_lazy(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{if(!this->m_glNamedFramebufferSampleLocationsfvARB)this->m_resolveOrThrow(2000);this->m_glNamedFramebufferSampleLocationsfvARB(framebuffer,start,count,v);}
+void m_glMultiTexGendvEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params)const{if(!this->m_glMultiTexGendvEXT)this->m_resolveOrThrow(2001);this->m_glMultiTexGendvEXT(texunit,coord,pname,params);}
+void m_glVertexArrayRangeNV_lazy(GLsizei length,const void* pointer)const{if(!this->m_glVertexArrayRangeNV)this->m_resolveOrThrow(2002);this->m_glVertexArrayRangeNV(length,pointer);}
+GLboolean m_glIsTextureHandleResidentNV_lazy(GLuint64 handle)const{if(!this->m_glIsTextureHandleResidentNV)this->m_resolveOrThrow(2003);return this->m_glIsTextureHandleResidentNV(handle);}
+void m_glGetProgramEnvParameterdvARB_lazy(GLenum target,GLuint index,GLdouble* params)const{if(!this->m_glGetProgramEnvParameterdvARB)this->m_resolveOrThrow(2004);this->m_glGetProgramEnvParameterdvARB(target,index,params);}
+GLboolean m_glIsNamedStringARB_lazy(GLint namelen,const GLchar* name)const{if(!this->m_glIsNamedStringARB)this->m_resolveOrThrow(2005);return this->m_glIsNamedStringARB(namelen,name);}
+void m_glSecondaryColorFormatNV_lazy(GLint size,GLenum type,GLsizei stride)const{if(!this->m_glSecondaryColorFormatNV)this->m_resolveOrThrow(2006);this->m_glSecondaryColorFormatNV(size,type,stride);}
+void m_glVertexAttrib4ubvNV_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttrib4ubvNV)this->m_resolveOrThrow(2007);this->m_glVertexAttrib4ubvNV(index,v);}
+void m_glTagSampleBufferSGIX_lazy()const{if(!this->m_glTagSampleBufferSGIX)this->m_resolveOrThrow(2008);this->m_glTagSampleBufferSGIX();}
+void m_glVDPAUUnregisterSurfaceNV_lazy(GLvdpauSurfaceNV surface)const{if(!this->m_glVDPAUUnregisterSurfaceNV)this->m_resolveOrThrow(2009);this->m_glVDPAUUnregisterSurfaceNV(surface);}
+void m_glGetPerfQueryIdByNameINTEL_lazy(GLchar* queryName,GLuint* queryId)const{if(!this->m_glGetPerfQueryIdByNameINTEL)this->m_resolveOrThrow(2010);this->m_glGetPerfQueryIdByNameINTEL(queryName,queryId);}
+void m_glGetInteger64v_lazy(GLenum pname,GLint64* data)const{if(!this->m_glGetInteger64v)this->m_resolveOrThrow(2011);this->m_glGetInteger64v(pname,data);}
+void m_glClipPlane_lazy(GLenum plane,const GLdouble* equation)const{if(!this->m_glClipPlane)this->m_resolveOrThrow(2012);this->m_glClipPlane(plane,equation);}
+void m_glColor4ubVertex3fSUN_lazy(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glColor4ubVertex3fSUN)this->m_resolveOrThrow(2013);this->m_glColor4ubVertex3fSUN(r,g,b,a,x,y,z);}
+void m_glIndexub_lazy(GLubyte c)const{if(!this->m_glIndexub)this->m_resolveOrThrow(2014);this->m_glIndexub(c);}
+void m_glGetProgramEnvParameterfvARB_lazy(GLenum target,GLuint index,GLfloat* params)const{if(!this->m_glGetProgramEnvParameterfvARB)this->m_resolveOrThrow(2015);this->m_glGetProgramEnvParameterfvARB(target,index,params);}
+void m_glVertexAttrib4usvARB_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttrib4usvARB)this->m_resolveOrThrow(2016);this->m_glVertexAttrib4usvARB(index,v);}
+void m_glNamedFramebufferRenderbuffer_lazy(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{if(!this->m_glNamedFramebufferRenderbuffer)this->m_resolveOrThrow(2017);this->m_glNamedFramebufferRenderbuffer(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+void m_glProgramUniformMatrix3x4dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3x4dv)this->m_resolveOrThrow(2018);this->m_glProgramUniformMatrix3x4dv(program,location,count,transpose,value);}
+GLboolean m_glTestFenceAPPLE_lazy(GLuint fence)const{if(!this->m_glTestFenceAPPLE)this->m_resolveOrThrow(2019);return this->m_glTestFenceAPPLE(fence);}
+void m_glVertexAttrib4Niv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttrib4Niv)this->m_resolveOrThrow(2020);this->m_glVertexAttrib4Niv(index,v);}
+void m_glVertexAttribL2i64vNV_lazy(GLuint index,const GLint64EXT* v)const{if(!this->m_glVertexAttribL2i64vNV)this->m_resolveOrThrow(2021);this->m_glVertexAttribL2i64vNV(index,v);}
+void m_glColorP4uiv_lazy(GLenum type,const GLuint* color)const{if(!this->m_glColorP4uiv)this->m_resolveOrThrow(2022);this->m_glColorP4uiv(type,color);}
+void m_glUniformMatrix2x3fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix2x3fv)this->m_resolveOrThrow(2023);this->m_glUniformMatrix2x3fv(location,count,transpose,value);}
+void m_glCallCommandListNV_lazy(GLuint list)const{if(!this->m_glCallCommandListNV)this->m_resolveOrThrow(2024);this->m_glCallCommandListNV(list);}
+void m_glClearBufferiv_lazy(GLenum buffer,GLint drawbuffer,const GLint* value)const{if(!this->m_glClearBufferiv)this->m_resolveOrThrow(2025);this->m_glClearBufferiv(buffer,drawbuffer,value);}
+void m_glNamedStringARB_lazy(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string)const{if(!this->m_glNamedStringARB)this->m_resolveOrThrow(2026);this->m_glNamedStringARB(type,namelen,name,stringlen,string);}
+void m_glMatrixMult3x2fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixMult3x2fNV)this->m_resolveOrThrow(2027);this->m_glMatrixMult3x2fNV(matrixMode,m);}
+void m_glGetNamedProgramStringEXT_lazy(GLuint program,GLenum target,GLenum pname,void* string)const{if(!this->m_glGetNamedProgramStringEXT)this->m_resolveOrThrow(2028);this->m_glGetNamedProgramStringEXT(program,target,pname,string);}
+void m_glGetnHistogramARB_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{if(!this->m_glGetnHistogramARB)this->m_resolveOrThrow(2029);this->m_glGetnHistogramARB(target,reset,format,type,bufSize,values);}
+void m_glGetTextureLevelParameterfv_lazy(GLuint texture,GLint level,GLenum pname,GLfloat* params)const{if(!this->m_glGetTextureLevelParameterfv)this->m_resolveOrThrow(2030);this->m_glGetTextureLevelParameterfv(texture,level,pname,params);}
+void m_glMultiTexCoord1fv_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord1fv)this->m_resolveOrThrow(2031);this->m_glMultiTexCoord1fv(target,v);}
+void m_glBitmapxOES_lazy(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap)const{if(!this->m_glBitmapxOES)this->m_resolveOrThrow(2032);this->m_glBitmapxOES(width,height,xorig,yorig,xmove,ymove,bitmap);}
+void m_glGetSamplerParameterIuiv_lazy(GLuint sampler,GLenum pname,GLuint* params)const{if(!this->m_glGetSamplerParameterIuiv)this->m_resolveOrThrow(2033);this->m_glGetSamplerParameterIuiv(sampler,pname,params);}
+void m_glTexCoordP3ui_lazy(GLenum type,GLuint coords)const{if(!this->m_glTexCoordP3ui)this->m_resolveOrThrow(2034);this->m_glTexCoordP3ui(type,coords);}
+void m_glTextureSubImage1D_lazy(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage1D)this->m_resolveOrThrow(2035);this->m_glTextureSubImage1D(texture,level,xoffset,width,format,type,pixels);}
+void m_glVertexAttribLPointerEXT_lazy(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribLPointerEXT)this->m_resolveOrThrow(2036);this->m_glVertexAttribLPointerEXT(index,size,type,stride,pointer);}
+void m_glFogCoordPointerEXT_lazy(GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glFogCoordPointerEXT)this->m_resolveOrThrow(2037);this->m_glFogCoordPointerEXT(type,stride,pointer);}
+void m_glWindowPos3s_lazy(GLshort x,GLshort y,GLshort z)const{if(!this->m_glWindowPos3s)this->m_resolveOrThrow(2038);this->m_glWindowPos3s(x,y,z);}
+void m_glVertexAttribs2svNV_lazy(GLuint index,GLsizei count,const GLshort* v)const{if(!this->m_glVertexAttribs2svNV)this->m_resolveOrThrow(2039);this->m_glVertexAttribs2svNV(index,count,v);}
+void m_glTextureImage3DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureImage3DEXT)this->m_resolveOrThrow(2040);this->m_glTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+void m_glWindowPos3i_lazy(GLint x,GLint y,GLint z)const{if(!this->m_glWindowPos3i)this->m_resolveOrThrow(2041);this->m_glWindowPos3i(x,y,z);}
+void m_glWindowPos3d_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glWindowPos3d)this->m_resolveOrThrow(2042);this->m_glWindowPos3d(x,y,z);}
+void m_glWindowPos3f_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glWindowPos3f)this->m_resolveOrThrow(2043);this->m_glWindowPos3f(x,y,z);}
+GLboolean m_glIsEnabledIndexedEXT_lazy(GLenum target,GLuint index)const{if(!this->m_glIsEnabledIndexedEXT)this->m_resolveOrThrow(2044);return this->m_glIsEnabledIndexedEXT(target,index);}
+void m_glGetNamedProgramivEXT_lazy(GLuint program,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetNamedProgramivEXT)this->m_resolveOrThrow(2045);this->m_glGetNamedProgramivEXT(program,target,pname,params);}
+void m_glVertex3xvOES_lazy(const GLfixed* coords)const{if(!this->m_glVertex3xvOES)this->m_resolveOrThrow(2046);this->m_glVertex3xvOES(coords);}
+void m_glColor3us_lazy(GLushort red,GLushort green,GLushort blue)const{if(!this->m_glColor3us)this->m_resolveOrThrow(2047);this->m_glColor3us(red,green,blue);}
+void m_glBeginPerfMonitorAMD_lazy(GLuint monitor)const{if(!this->m_glBeginPerfMonitorAMD)this->m_resolveOrThrow(2048);this->m_glBeginPerfMonitorAMD(monitor);}
+void m_glProgramUniformMatrix4x3dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4x3dv)this->m_resolveOrThrow(2049);this->m_glProgramUniformMatrix4x3dv(program,location,count,transpose,value);}
+void m_glGetNamedProgramLocalParameterIuivEXT_lazy(GLuint program,GLenum target,GLuint index,GLuint* params)const{if(!this->m_glGetNamedProgramLocalParameterIuivEXT)this->m_resolveOrThrow(2050);this->m_glGetNamedProgramLocalParameterIuivEXT(program,target,index,params);}
+void m_glReadnPixels_lazy(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{if(!this->m_glReadnPixels)this->m_resolveOrThrow(2051);this->m_glReadnPixels(x,y,width,height,format,type,bufSize,data);}
+void m_glMultiTexCoord4f_lazy(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{if(!this->m_glMultiTexCoord4f)this->m_resolveOrThrow(2052);this->m_glMultiTexCoord4f(target,s,t,r,q);}
+void m_glColor3ub_lazy(GLubyte red,GLubyte green,GLubyte blue)const{if(!this->m_glColor3ub)this->m_resolveOrThrow(2053);this->m_glColor3ub(red,green,blue);}
+void m_glMultiTexCoord4d_lazy(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{if(!this->m_glMultiTexCoord4d)this->m_resolveOrThrow(2054);this->m_glMultiTexCoord4d(target,s,t,r,q);}
+void m_glVertexAttribL3ui64NV_lazy(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{if(!this->m_glVertexAttribL3ui64NV)this->m_resolveOrThrow(2055);this->m_glVertexAttribL3ui64NV(index,x,y,z);}
+void m_glColor3ui_lazy(GLuint red,GLuint green,GLuint blue)const{if(!this->m_glColor3ui)this->m_resolveOrThrow(2056);this->m_glColor3ui(red,green,blue);}
+void m_glProgramUniform4fvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform4fvEXT)this->m_resolveOrThrow(2057);this->m_glProgramUniform4fvEXT(program,location,count,value);}
+void m_glVertexAttrib2sARB_lazy(GLuint index,GLshort x,GLshort y)const{if(!this->m_glVertexAttrib2sARB)this->m_resolveOrThrow(2058);this->m_glVertexAttrib2sARB(index,x,y);}
+void m_glMultiTexCoord4i_lazy(GLenum target,GLint s,GLint t,GLint r,GLint q)const{if(!this->m_glMultiTexCoord4i)this->m_resolveOrThrow(2059);this->m_glMultiTexCoord4i(target,s,t,r,q);}
+GLenum m_glCheckFramebufferStatusEXT_lazy(GLenum target)const{if(!this->m_glCheckFramebufferStatusEXT)this->m_resolveOrThrow(2060);return this->m_glCheckFramebufferStatusEXT(target);}
+void m_glGetnMapivARB_lazy(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{if(!this->m_glGetnMapivARB)this->m_resolveOrThrow(2061);this->m_glGetnMapivARB(target,query,bufSize,v);}
+void m_glMultiTexCoord1ivARB_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord1ivARB)this->m_resolveOrThrow(2062);this->m_glMultiTexCoord1ivARB(target,v);}
+void m_glDisableVertexAttribArrayARB_lazy(GLuint index)const{if(!this->m_glDisableVertexAttribArrayARB)this->m_resolveOrThrow(2063);this->m_glDisableVertexAttribArrayARB(index);}
+void m_glGetPolygonStipple_lazy(GLubyte* mask)const{if(!this->m_glGetPolygonStipple)this->m_resolveOrThrow(2064);this->m_glGetPolygonStipple(mask);}
+void m_glVertexAttribI4ui_lazy(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{if(!this->m_glVertexAttribI4ui)this->m_resolveOrThrow(2065);this->m_glVertexAttribI4ui(index,x,y,z,w);}
+void m_glGetPathDashArrayNV_lazy(GLuint path,GLfloat* dashArray)const{if(!this->m_glGetPathDashArrayNV)this->m_resolveOrThrow(2066);this->m_glGetPathDashArrayNV(path,dashArray);}
+void m_glMultiTexRenderbufferEXT_lazy(GLenum texunit,GLenum target,GLuint renderbuffer)const{if(!this->m_glMultiTexRenderbufferEXT)this->m_resolveOrThrow(2067);this->m_glMultiTexRenderbufferEXT(texunit,target,renderbuffer);}
+void m_glCopyTextureSubImage1D_lazy(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyTextureSubImage1D)this->m_resolveOrThrow(2068);this->m_glCopyTextureSubImage1D(texture,level,xoffset,x,y,width);}
+void m_glDeleteOcclusionQueriesNV_lazy(GLsizei n,const GLuint* ids)const{if(!this->m_glDeleteOcclusionQueriesNV)this->m_resolveOrThrow(2069);this->m_glDeleteOcclusionQueriesNV(n,ids);}
+void m_glVertex4hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glVertex4hvNV)this->m_resolveOrThrow(2070);this->m_glVertex4hvNV(v);}
+void m_glGetnTexImage_lazy(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{if(!this->m_glGetnTexImage)this->m_resolveOrThrow(2071);this->m_glGetnTexImage(target,level,format,type,bufSize,pixels);}
+void m_glProgramLocalParameter4dARB_lazy(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glProgramLocalParameter4dARB)this->m_resolveOrThrow(2072);this->m_glProgramLocalParameter4dARB(target,index,x,y,z,w);}
+void m_glBlendEquation_lazy(GLenum mode)const{if(!this->m_glBlendEquation)this->m_resolveOrThrow(2073);this->m_glBlendEquation(mode);}
+void m_glUnlockArraysEXT_lazy()const{if(!this->m_glUnlockArraysEXT)this->m_resolveOrThrow(2074);this->m_glUnlockArraysEXT();}
+void m_glGetQueryObjectui64vEXT_lazy(GLuint id,GLenum pname,GLuint64* params)const{if(!this->m_glGetQueryObjectui64vEXT)this->m_resolveOrThrow(2075);this->m_glGetQueryObjectui64vEXT(id,pname,params);}
+void m_glVertexAttribI4uivEXT_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI4uivEXT)this->m_resolveOrThrow(2076);this->m_glVertexAttribI4uivEXT(index,v);}
+void m_glUniform1i64vNV_lazy(GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glUniform1i64vNV)this->m_resolveOrThrow(2077);this->m_glUniform1i64vNV(location,count,value);}
+void m_glMultiTexCoord3dv_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord3dv)this->m_resolveOrThrow(2078);this->m_glMultiTexCoord3dv(target,v);}
+void m_glColor4sv_lazy(const GLshort* v)const{if(!this->m_glColor4sv)this->m_resolveOrThrow(2079);this->m_glColor4sv(v);}
+void m_glVertexStream4ivATI_lazy(GLenum stream,const GLint* coords)const{if(!this->m_glVertexStream4ivATI)this->m_resolveOrThrow(2080);this->m_glVertexStream4ivATI(stream,coords);}
+void m_glPopClientAttrib_lazy()const{if(!this->m_glPopClientAttrib)this->m_resolveOrThrow(2081);this->m_glPopClientAttrib();}
+void m_glClearBufferData_lazy(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearBufferData)this->m_resolveOrThrow(2082);this->m_glClearBufferData(target,internalformat,format,type,data);}
+void m_glGetProgramivNV_lazy(GLuint id,GLenum pname,GLint* params)const{if(!this->m_glGetProgramivNV)this->m_resolveOrThrow(2083);this->m_glGetProgramivNV(id,pname,params);}
+void m_glBeginTransformFeedback_lazy(GLenum primitiveMode)const{if(!this->m_glBeginTransformFeedback)this->m_resolveOrThrow(2084);this->m_glBeginTransformFeedback(primitiveMode);}
+void m_glFinishObjectAPPLE_lazy(GLenum object,GLint name)const{if(!this->m_glFinishObjectAPPLE)this->m_resolveOrThrow(2085);this->m_glFinishObjectAPPLE(object,name);}
+void m_glGetMinmaxParameterivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetMinmaxParameterivEXT)this->m_resolveOrThrow(2086);this->m_glGetMinmaxParameterivEXT(target,pname,params);}
+void m_glColor3iv_lazy(const GLint* v)const{if(!this->m_glColor3iv)this->m_resolveOrThrow(2087);this->m_glColor3iv(v);}
+void m_glVertexAttrib3sv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib3sv)this->m_resolveOrThrow(2088);this->m_glVertexAttrib3sv(index,v);}
+void m_glCompressedTexImage1D_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexImage1D)this->m_resolveOrThrow(2089);this->m_glCompressedTexImage1D(target,level,internalformat,width,border,imageSize,data);}
+void m_glDeleteTransformFeedbacks_lazy(GLsizei n,const GLuint* ids)const{if(!this->m_glDeleteTransformFeedbacks)this->m_resolveOrThrow(2090);this->m_glDeleteTransformFeedbacks(n,ids);}
+void m_glGetVideoi64vNV_lazy(GLuint video_slot,GLenum pname,GLint64EXT* params)const{if(!this->m_glGetVideoi64vNV)this->m_resolveOrThrow(2091);this->m_glGetVideoi64vNV(video_slot,pname,params);}
+void m_glDrawRangeElementsBaseVertex_lazy(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{if(!this->m_glDrawRangeElementsBaseVertex)this->m_resolveOrThrow(2092);this->m_glDrawRangeElementsBaseVertex(mode,start,end,count,type,indices,basevertex);}
+void m_glUniform4i64vARB_lazy(GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glUniform4i64vARB)this->m_resolveOrThrow(2093);this->m_glUniform4i64vARB(location,count,value);}
+void m_glTextureStorage3DMultisampleEXT_lazy(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{if(!this->m_glTextureStorage3DMultisampleEXT)this->m_resolveOrThrow(2094);this->m_glTextureStorage3DMultisampleEXT(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+void m_glGetTexParameterfv_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetTexParameterfv)this->m_resolveOrThrow(2095);this->m_glGetTexParameterfv(target,pname,params);}
+void m_glProgramUniformui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glProgramUniformui64vNV)this->m_resolveOrThrow(2096);this->m_glProgramUniformui64vNV(program,location,count,value);}
+void m_glCompressedMultiTexImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexImage1DEXT)this->m_resolveOrThrow(2097);this->m_glCompressedMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,imageSize,bits);}
+void m_glProgramUniform2ivEXT_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform2ivEXT)this->m_resolveOrThrow(2098);this->m_glProgramUniform2ivEXT(program,location,count,value);}
+void m_glPushGroupMarkerEXT_lazy(GLsizei length,const GLchar* marker)const{if(!this->m_glPushGroupMarkerEXT)this->m_resolveOrThrow(2099);this->m_glPushGroupMarkerEXT(length,marker);}
+void m_glVertexAttrib1dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib1dv)this->m_resolveOrThrow(2100);this->m_glVertexAttrib1dv(index,v);}
+void m_glMatrixLoadIdentityEXT_lazy(GLenum mode)const{if(!this->m_glMatrixLoadIdentityEXT)this->m_resolveOrThrow(2101);this->m_glMatrixLoadIdentityEXT(mode);}
+void m_glMultTransposeMatrixxOES_lazy(const GLfixed* m)const{if(!this->m_glMultTransposeMatrixxOES)this->m_resolveOrThrow(2102);this->m_glMultTransposeMatrixxOES(m);}
+void m_glGetPixelMapxv_lazy(GLenum map,GLint size,GLfixed* values)const{if(!this->m_glGetPixelMapxv)this->m_resolveOrThrow(2103);this->m_glGetPixelMapxv(map,size,values);}
+void m_glFramebufferSampleLocationsfvARB_lazy(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{if(!this->m_glFramebufferSampleLocationsfvARB)this->m_resolveOrThrow(2104);this->m_glFramebufferSampleLocationsfvARB(target,start,count,v);}
+void m_glGetLightiv_lazy(GLenum light,GLenum pname,GLint* params)const{if(!this->m_glGetLightiv)this->m_resolveOrThrow(2105);this->m_glGetLightiv(light,pname,params);}
+void m_glBlendFuncSeparatei_lazy(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{if(!this->m_glBlendFuncSeparatei)this->m_resolveOrThrow(2106);this->m_glBlendFuncSeparatei(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+GLboolean m_glAcquireKeyedMutexWin32EXT_lazy(GLuint memory,GLuint64 key,GLuint timeout)const{if(!this->m_glAcquireKeyedMutexWin32EXT)this->m_resolveOrThrow(2107);return this->m_glAcquireKeyedMutexWin32EXT(memory,key,timeout);}
+void m_glGetBooleanIndexedvEXT_lazy(GLenum target,GLuint index,GLboolean* data)const{if(!this->m_glGetBooleanIndexedvEXT)this->m_resolveOrThrow(2108);this->m_glGetBooleanIndexedvEXT(target,index,data);}
+void m_glGetProgramSubroutineParameteruivNV_lazy(GLenum target,GLuint index,GLuint* param)const{if(!this->m_glGetProgramSubroutineParameteruivNV)this->m_resolveOrThrow(2109);this->m_glGetProgramSubroutineParameteruivNV(target,index,param);}
+void m_glUniform2ui_lazy(GLint location,GLuint v0,GLuint v1)const{if(!this->m_glUniform2ui)this->m_resolveOrThrow(2110);this->m_glUniform2ui(location,v0,v1);}
+void m_glApplyFramebufferAttachmentCMAAINTEL_lazy()const{if(!this->m_glApplyFramebufferAttachmentCMAAINTEL)this->m_resolveOrThrow(2111);this->m_glApplyFramebufferAttachmentCMAAINTEL();}
+void m_glWindowPos2fv_lazy(const GLfloat* v)const{if(!this->m_glWindowPos2fv)this->m_resolveOrThrow(2112);this->m_glWindowPos2fv(v);}
+void m_glWaitVkSemaphoreNV_lazy(GLuint64 vkSemaphore)const{if(!this->m_glWaitVkSemaphoreNV)this->m_resolveOrThrow(2113);this->m_glWaitVkSemaphoreNV(vkSemaphore);}
+void m_glDisablei_lazy(GLenum target,GLuint index)const{if(!this->m_glDisablei)this->m_resolveOrThrow(2114);this->m_glDisablei(target,index);}
+void m_glSelectPerfMonitorCountersAMD_lazy(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList)const{if(!this->m_glSelectPerfMonitorCountersAMD)this->m_resolveOrThrow(2115);this->m_glSelectPerfMonitorCountersAMD(monitor,enable,group,numCounters,counterList);}
+void m_glGetVertexAttribLi64vNV_lazy(GLuint index,GLenum pname,GLint64EXT* params)const{if(!this->m_glGetVertexAttribLi64vNV)this->m_resolveOrThrow(2116);this->m_glGetVertexAttribLi64vNV(index,pname,params);}
+void m_glBlendFuncSeparateiARB_lazy(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{if(!this->m_glBlendFuncSeparateiARB)this->m_resolveOrThrow(2117);this->m_glBlendFuncSeparateiARB(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+void m_glWeightuivARB_lazy(GLint size,const GLuint* weights)const{if(!this->m_glWeightuivARB)this->m_resolveOrThrow(2118);this->m_glWeightuivARB(size,weights);}
+void m_glWindowPos2iARB_lazy(GLint x,GLint y)const{if(!this->m_glWindowPos2iARB)this->m_resolveOrThrow(2119);this->m_glWindowPos2iARB(x,y);}
+void m_glGetProgramLocalParameterdvARB_lazy(GLenum target,GLuint index,GLdouble* params)const{if(!this->m_glGetProgramLocalParameterdvARB)this->m_resolveOrThrow(2120);this->m_glGetProgramLocalParameterdvARB(target,index,params);}
+void m_glGetUniformui64vARB_lazy(GLuint program,GLint location,GLuint64* params)const{if(!this->m_glGetUniformui64vARB)this->m_resolveOrThrow(2121);this->m_glGetUniformui64vARB(program,location,params);}
+void m_glSecondaryColor3us_lazy(GLushort red,GLushort green,GLushort blue)const{if(!this->m_glSecondaryColor3us)this->m_resolveOrThrow(2122);this->m_glSecondaryColor3us(red,green,blue);}
+void m_glGetSynciv_lazy(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{if(!this->m_glGetSynciv)this->m_resolveOrThrow(2123);this->m_glGetSynciv(sync,pname,bufSize,length,values);}
+void m_glMakeImageHandleResidentARB_lazy(GLuint64 handle,GLenum access)const{if(!this->m_glMakeImageHandleResidentARB)this->m_resolveOrThrow(2124);this->m_glMakeImageHandleResidentARB(handle,access);}
+void m_glGetProgramNamedParameterfvNV_lazy(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params)const{if(!this->m_glGetProgramNamedParameterfvNV)this->m_resolveOrThrow(2125);this->m_glGetProgramNamedParameterfvNV(id,len,name,params);}
+void m_glTextureStorage3D_lazy(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{if(!this->m_glTextureStorage3D)this->m_resolveOrThrow(2126);this->m_glTextureStorage3D(texture,levels,internalformat,width,height,depth);}
+void m_glVertexAttrib4svNV_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib4svNV)this->m_resolveOrThrow(2127);this->m_glVertexAttrib4svNV(index,v);}
+void m_glProgramUniform2i_lazy(GLuint program,GLint location,GLint v0,GLint v1)const{if(!this->m_glProgramUniform2i)this->m_resolveOrThrow(2128);this->m_glProgramUniform2i(program,location,v0,v1);}
+void m_glListDrawCommandsStatesClientNV_lazy(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{if(!this->m_glListDrawCommandsStatesClientNV)this->m_resolveOrThrow(2129);this->m_glListDrawCommandsStatesClientNV(list,segment,indirects,sizes,states,fbos,count);}
+void m_glProgramLocalParametersI4uivNV_lazy(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{if(!this->m_glProgramLocalParametersI4uivNV)this->m_resolveOrThrow(2130);this->m_glProgramLocalParametersI4uivNV(target,index,count,params);}
+void m_glBeginTransformFeedbackNV_lazy(GLenum primitiveMode)const{if(!this->m_glBeginTransformFeedbackNV)this->m_resolveOrThrow(2131);this->m_glBeginTransformFeedbackNV(primitiveMode);}
+void m_glGetProgramBinary_lazy(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary)const{if(!this->m_glGetProgramBinary)this->m_resolveOrThrow(2132);this->m_glGetProgramBinary(program,bufSize,length,binaryFormat,binary);}
+void m_glBinormal3iEXT_lazy(GLint bx,GLint by,GLint bz)const{if(!this->m_glBinormal3iEXT)this->m_resolveOrThrow(2133);this->m_glBinormal3iEXT(bx,by,bz);}
+void m_glEvalPoint1_lazy(GLint i)const{if(!this->m_glEvalPoint1)this->m_resolveOrThrow(2134);this->m_glEvalPoint1(i);}
+void m_glEvalPoint2_lazy(GLint i,GLint j)const{if(!this->m_glEvalPoint2)this->m_resolveOrThrow(2135);this->m_glEvalPoint2(i,j);}
+void m_glPauseTransformFeedback_lazy()const{if(!this->m_glPauseTransformFeedback)this->m_resolveOrThrow(2136);this->m_glPauseTransformFeedback();}
+void m_glWindowPos2sMESA_lazy(GLshort x,GLshort y)const{if(!this->m_glWindowPos2sMESA)this->m_resolveOrThrow(2137);this->m_glWindowPos2sMESA(x,y);}
+void m_glGlobalAlphaFactorbSUN_lazy(GLbyte factor)const{if(!this->m_glGlobalAlphaFactorbSUN)this->m_resolveOrThrow(2138);this->m_glGlobalAlphaFactorbSUN(factor);}
+void m_glCreateTransformFeedbacks_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glCreateTransformFeedbacks)this->m_resolveOrThrow(2139);this->m_glCreateTransformFeedbacks(n,ids);}
+void m_glTexturePageCommitmentEXT_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{if(!this->m_glTexturePageCommitmentEXT)this->m_resolveOrThrow(2140);this->m_glTexturePageCommitmentEXT(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+void m_glTransformFeedbackVaryingsNV_lazy(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode)const{if(!this->m_glTransformFeedbackVaryingsNV)this->m_resolveOrThrow(2141);this->m_glTransformFeedbackVaryingsNV(program,count,locations,bufferMode);}
+void m_glTexSubImage1D_lazy(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels)const{if(!this->m_glTexSubImage1D)this->m_resolveOrThrow(2142);this->m_glTexSubImage1D(target,level,xoffset,width,format,type,pixels);}
+void m_glConvolutionParameterfvEXT_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glConvolutionParameterfvEXT)this->m_resolveOrThrow(2143);this->m_glConvolutionParameterfvEXT(target,pname,params);}
+void m_glBlitFramebufferEXT_lazy(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{if(!this->m_glBlitFramebufferEXT)this->m_resolveOrThrow(2144);this->m_glBlitFramebufferEXT(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+void m_glUniformMatrix4fvARB_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix4fvARB)this->m_resolveOrThrow(2145);this->m_glUniformMatrix4fvARB(location,count,transpose,value);}
+void m_glProgramEnvParameter4dvARB_lazy(GLenum target,GLuint index,const GLdouble* params)const{if(!this->m_glProgramEnvParameter4dvARB)this->m_resolveOrThrow(2146);this->m_glProgramEnvParameter4dvARB(target,index,params);}
+void m_glTextureStorageMem2DEXT_lazy(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{if(!this->m_glTextureStorageMem2DEXT)this->m_resolveOrThrow(2147);this->m_glTextureStorageMem2DEXT(texture,levels,internalFormat,width,height,memory,offset);}
+void m_glVertexAttribP3uiv_lazy(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{if(!this->m_glVertexAttribP3uiv)this->m_resolveOrThrow(2148);this->m_glVertexAttribP3uiv(index,type,normalized,value);}
+void m_glFogCoordFormatNV_lazy(GLenum type,GLsizei stride)const{if(!this->m_glFogCoordFormatNV)this->m_resolveOrThrow(2149);this->m_glFogCoordFormatNV(type,stride);}
+void m_glGetMultiTexLevelParameterivEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params)const{if(!this->m_glGetMultiTexLevelParameterivEXT)this->m_resolveOrThrow(2150);this->m_glGetMultiTexLevelParameterivEXT(texunit,target,level,pname,params);}
+GLboolean m_glIsOcclusionQueryNV_lazy(GLuint id)const{if(!this->m_glIsOcclusionQueryNV)this->m_resolveOrThrow(2151);return this->m_glIsOcclusionQueryNV(id);}
+void m_glCompressedTexImage2DARB_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexImage2DARB)this->m_resolveOrThrow(2152);this->m_glCompressedTexImage2DARB(target,level,internalformat,width,height,border,imageSize,data);}
+void m_glGetProgramEnvParameterIuivNV_lazy(GLenum target,GLuint index,GLuint* params)const{if(!this->m_glGetProgramEnvParameterIuivNV)this->m_resolveOrThrow(2153);this->m_glGetProgramEnvParameterIuivNV(target,index,params);}
+void m_glVertexAttrib4sv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib4sv)this->m_resolveOrThrow(2154);this->m_glVertexAttrib4sv(index,v);}
+void m_glVertexAttrib4fvARB_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib4fvARB)this->m_resolveOrThrow(2155);this->m_glVertexAttrib4fvARB(index,v);}
+void m_glLoadName_lazy(GLuint name)const{if(!this->m_glLoadName)this->m_resolveOrThrow(2156);this->m_glLoadName(name);}
+void m_glBindVertexShaderEXT_lazy(GLuint id)const{if(!this->m_glBindVertexShaderEXT)this->m_resolveOrThrow(2157);this->m_glBindVertexShaderEXT(id);}
+void m_glGetNamedProgramLocalParameterIivEXT_lazy(GLuint program,GLenum target,GLuint index,GLint* params)const{if(!this->m_glGetNamedProgramLocalParameterIivEXT)this->m_resolveOrThrow(2158);this->m_glGetNamedProgramLocalParameterIivEXT(program,target,index,params);}
+void m_glProgramUniform3uiEXT_lazy(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{if(!this->m_glProgramUniform3uiEXT)this->m_resolveOrThrow(2159);this->m_glProgramUniform3uiEXT(program,location,v0,v1,v2);}
+void m_glProgramUniformMatrix4x2dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4x2dvEXT)this->m_resolveOrThrow(2160);this->m_glProgramUniformMatrix4x2dvEXT(program,location,count,transpose,value);}
+void m_glTexCoord1hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glTexCoord1hvNV)this->m_resolveOrThrow(2161);this->m_glTexCoord1hvNV(v);}
+void m_glLoadMatrixd_lazy(const GLdouble* m)const{if(!this->m_glLoadMatrixd)this->m_resolveOrThrow(2162);this->m_glLoadMatrixd(m);}
+void m_glTexParameterfv_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glTexParameterfv)this->m_resolveOrThrow(2163);this->m_glTexParameterfv(target,pname,params);}
+void m_glVariantdvEXT_lazy(GLuint id,const GLdouble* addr)const{if(!this->m_glVariantdvEXT)this->m_resolveOrThrow(2164);this->m_glVariantdvEXT(id,addr);}
+void m_glCullParameterfvEXT_lazy(GLenum pname,GLfloat* params)const{if(!this->m_glCullParameterfvEXT)this->m_resolveOrThrow(2165);this->m_glCullParameterfvEXT(pname,params);}
+void m_glUniform3dv_lazy(GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glUniform3dv)this->m_resolveOrThrow(2166);this->m_glUniform3dv(location,count,value);}
+void m_glProgramUniform3fv_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform3fv)this->m_resolveOrThrow(2167);this->m_glProgramUniform3fv(program,location,count,value);}
+GLboolean m_glIsBufferARB_lazy(GLuint buffer)const{if(!this->m_glIsBufferARB)this->m_resolveOrThrow(2168);return this->m_glIsBufferARB(buffer);}
+void m_glMultiTexCoord1bOES_lazy(GLenum texture,GLbyte s)const{if(!this->m_glMultiTexCoord1bOES)this->m_resolveOrThrow(2169);this->m_glMultiTexCoord1bOES(texture,s);}
+void m_glFogCoordhNV_lazy(GLhalfNV fog)const{if(!this->m_glFogCoordhNV)this->m_resolveOrThrow(2170);this->m_glFogCoordhNV(fog);}
+void m_glFramebufferSampleLocationsfvNV_lazy(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{if(!this->m_glFramebufferSampleLocationsfvNV)this->m_resolveOrThrow(2171);this->m_glFramebufferSampleLocationsfvNV(target,start,count,v);}
+GLuint m_glGenSymbolsEXT_lazy(GLenum datatype,GLenum storagetype,GLenum range,GLuint components)const{if(!this->m_glGenSymbolsEXT)this->m_resolveOrThrow(2172);return this->m_glGenSymbolsEXT(datatype,storagetype,range,components);}
+void m_glGetConvolutionFilter_lazy(GLenum target,GLenum format,GLenum type,GLvoid* image)const{if(!this->m_glGetConvolutionFilter)this->m_resolveOrThrow(2173);this->m_glGetConvolutionFilter(target,format,type,image);}
+void m_glProgramUniform1fvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform1fvEXT)this->m_resolveOrThrow(2174);this->m_glProgramUniform1fvEXT(program,location,count,value);}
+void m_glGetNextPerfQueryIdINTEL_lazy(GLuint queryId,GLuint* nextQueryId)const{if(!this->m_glGetNextPerfQueryIdINTEL)this->m_resolveOrThrow(2175);this->m_glGetNextPerfQueryIdINTEL(queryId,nextQueryId);}
+void m_glCompressedTexImage1DARB_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexImage1DARB)this->m_resolveOrThrow(2176);this->m_glCompressedTexImage1DARB(target,level,internalformat,width,border,imageSize,data);}
+void m_glBindSamplers_lazy(GLuint first,GLsizei count,const GLuint* samplers)const{if(!this->m_glBindSamplers)this->m_resolveOrThrow(2177);this->m_glBindSamplers(first,count,samplers);}
+void m_glGetProgramEnvParameterIivNV_lazy(GLenum target,GLuint index,GLint* params)const{if(!this->m_glGetProgramEnvParameterIivNV)this->m_resolveOrThrow(2178);this->m_glGetProgramEnvParameterIivNV(target,index,params);}
+void m_glGetQueryObjectui64v_lazy(GLuint id,GLenum pname,GLuint64* params)const{if(!this->m_glGetQueryObjectui64v)this->m_resolveOrThrow(2179);this->m_glGetQueryObjectui64v(id,pname,params);}
+void m_glVertexAttribL4ui64vNV_lazy(GLuint index,const GLuint64EXT* v)const{if(!this->m_glVertexAttribL4ui64vNV)this->m_resolveOrThrow(2180);this->m_glVertexAttribL4ui64vNV(index,v);}
+void m_glGetVideoivNV_lazy(GLuint video_slot,GLenum pname,GLint* params)const{if(!this->m_glGetVideoivNV)this->m_resolveOrThrow(2181);this->m_glGetVideoivNV(video_slot,pname,params);}
+void m_glGetTextureImage_lazy(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{if(!this->m_glGetTextureImage)this->m_resolveOrThrow(2182);this->m_glGetTextureImage(texture,level,format,type,bufSize,pixels);}
+void m_glProgramUniform1fv_lazy(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glProgramUniform1fv)this->m_resolveOrThrow(2183);this->m_glProgramUniform1fv(program,location,count,value);}
+void m_glUniformMatrix4fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix4fv)this->m_resolveOrThrow(2184);this->m_glUniformMatrix4fv(location,count,transpose,value);}
+void m_glColorMask_lazy(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{if(!this->m_glColorMask)this->m_resolveOrThrow(2185);this->m_glColorMask(red,green,blue,alpha);}
+void m_glBeginFragmentShaderATI_lazy()const{if(!this->m_glBeginFragmentShaderATI)this->m_resolveOrThrow(2186);this->m_glBeginFragmentShaderATI();}
+void m_glMultiDrawArraysEXT_lazy(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{if(!this->m_glMultiDrawArraysEXT)this->m_resolveOrThrow(2187);this->m_glMultiDrawArraysEXT(mode,first,count,primcount);}
+void m_glGenNamesAMD_lazy(GLenum identifier,GLuint num,GLuint* names)const{if(!this->m_glGenNamesAMD)this->m_resolveOrThrow(2188);this->m_glGenNamesAMD(identifier,num,names);}
+void m_glPathParameteriNV_lazy(GLuint path,GLenum pname,GLint value)const{if(!this->m_glPathParameteriNV)this->m_resolveOrThrow(2189);this->m_glPathParameteriNV(path,pname,value);}
+void m_glCreateCommandListsNV_lazy(GLsizei n,GLuint* lists)const{if(!this->m_glCreateCommandListsNV)this->m_resolveOrThrow(2190);this->m_glCreateCommandListsNV(n,lists);}
+void m_glDeleteProgramPipelines_lazy(GLsizei n,const GLuint* pipelines)const{if(!this->m_glDeleteProgramPipelines)this->m_resolveOrThrow(2191);this->m_glDeleteProgramPipelines(n,pipelines);}
+void m_glCopyColorSubTableEXT_lazy(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyColorSubTableEXT)this->m_resolveOrThrow(2192);this->m_glCopyColorSubTableEXT(target,start,x,y,width);}
+void m_glVariantsvEXT_lazy(GLuint id,const GLshort* addr)const{if(!this->m_glVariantsvEXT)this->m_resolveOrThrow(2193);this->m_glVariantsvEXT(id,addr);}
+void m_glGenProgramPipelines_lazy(GLsizei n,GLuint* pipelines)const{if(!this->m_glGenProgramPipelines)this->m_resolveOrThrow(2194);this->m_glGenProgramPipelines(n,pipelines);}
+void m_glVertexArrayEdgeFlagOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArrayEdgeFlagOffsetEXT)this->m_resolveOrThrow(2195);this->m_glVertexArrayEdgeFlagOffsetEXT(vaobj,buffer,stride,offset);}
+void m_glWindowPos2s_lazy(GLshort x,GLshort y)const{if(!this->m_glWindowPos2s)this->m_resolveOrThrow(2196);this->m_glWindowPos2s(x,y);}
+void m_glSecondaryColor3iEXT_lazy(GLint red,GLint green,GLint blue)const{if(!this->m_glSecondaryColor3iEXT)this->m_resolveOrThrow(2197);this->m_glSecondaryColor3iEXT(red,green,blue);}
+void m_glWindowPos2i_lazy(GLint x,GLint y)const{if(!this->m_glWindowPos2i)this->m_resolveOrThrow(2198);this->m_glWindowPos2i(x,y);}
+void m_glWindowPos2f_lazy(GLfloat x,GLfloat y)const{if(!this->m_glWindowPos2f)this->m_resolveOrThrow(2199);this->m_glWindowPos2f(x,y);}
+void m_glWindowPos2d_lazy(GLdouble x,GLdouble y)const{if(!this->m_glWindowPos2d)this->m_resolveOrThrow(2200);this->m_glWindowPos2d(x,y);}
+void m_glUniform4uivEXT_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform4uivEXT)this->m_resolveOrThrow(2201);this->m_glUniform4uivEXT(location,count,value);}
+void m_glOrthoxOES_lazy(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{if(!this->m_glOrthoxOES)this->m_resolveOrThrow(2202);this->m_glOrthoxOES(l,r,b,t,n,f);}
+void m_glUniformSubroutinesuiv_lazy(GLenum shadertype,GLsizei count,const GLuint* indices)const{if(!this->m_glUniformSubroutinesuiv)this->m_resolveOrThrow(2203);this->m_glUniformSubroutinesuiv(shadertype,count,indices);}
+void m_glRectdv_lazy(const GLdouble* v1,const GLdouble* v2)const{if(!this->m_glRectdv)this->m_resolveOrThrow(2204);this->m_glRectdv(v1,v2);}
+void m_glProgramUniform1i64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glProgramUniform1i64vNV)this->m_resolveOrThrow(2205);this->m_glProgramUniform1i64vNV(program,location,count,value);}
+void m_glVertexAttribI4uiEXT_lazy(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{if(!this->m_glVertexAttribI4uiEXT)this->m_resolveOrThrow(2206);this->m_glVertexAttribI4uiEXT(index,x,y,z,w);}
+void m_glSecondaryColor3ubEXT_lazy(GLubyte red,GLubyte green,GLubyte blue)const{if(!this->m_glSecondaryColor3ubEXT)this->m_resolveOrThrow(2207);this->m_glSecondaryColor3ubEXT(red,green,blue);}
+void m_glCompressedMultiTexSubImage1DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexSubImage1DEXT)this->m_resolveOrThrow(2208);this->m_glCompressedMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,imageSize,bits);}
+void m_glMultiTexGendEXT_lazy(GLenum texunit,GLenum coord,GLenum pname,GLdouble param)const{if(!this->m_glMultiTexGendEXT)this->m_resolveOrThrow(2209);this->m_glMultiTexGendEXT(texunit,coord,pname,param);}
+void m_glColorP3uiv_lazy(GLenum type,const GLuint* color)const{if(!this->m_glColorP3uiv)this->m_resolveOrThrow(2210);this->m_glColorP3uiv(type,color);}
+void m_glFogCoordfv_lazy(const GLfloat* coord)const{if(!this->m_glFogCoordfv)this->m_resolveOrThrow(2211);this->m_glFogCoordfv(coord);}
+void m_glCompileShader_lazy(GLuint shader)const{if(!this->m_glCompileShader)this->m_resolveOrThrow(2212);this->m_glCompileShader(shader);}
+void m_glTexCoord2hNV_lazy(GLhalfNV s,GLhalfNV t)const{if(!this->m_glTexCoord2hNV)this->m_resolveOrThrow(2213);this->m_glTexCoord2hNV(s,t);}
+void m_glUniform1uivEXT_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform1uivEXT)this->m_resolveOrThrow(2214);this->m_glUniform1uivEXT(location,count,value);}
+void m_glMatrixLoadTransposedEXT_lazy(GLenum mode,const GLdouble* m)const{if(!this->m_glMatrixLoadTransposedEXT)this->m_resolveOrThrow(2215);this->m_glMatrixLoadTransposedEXT(mode,m);}
+void m_glIndexfv_lazy(const GLfloat* c)const{if(!this->m_glIndexfv)this->m_resolveOrThrow(2216);this->m_glIndexfv(c);}
+void m_glGetCompressedTextureImage_lazy(GLuint texture,GLint level,GLsizei bufSize,void* pixels)const{if(!this->m_glGetCompressedTextureImage)this->m_resolveOrThrow(2217);this->m_glGetCompressedTextureImage(texture,level,bufSize,pixels);}
+void m_glGetUniformuivEXT_lazy(GLuint program,GLint location,GLuint* params)const{if(!this->m_glGetUniformuivEXT)this->m_resolveOrThrow(2218);this->m_glGetUniformuivEXT(program,location,params);}
+void m_glGetnPixelMapfvARB_lazy(GLenum map,GLsizei bufSize,GLfloat* values)const{if(!this->m_glGetnPixelMapfvARB)this->m_resolveOrThrow(2219);this->m_glGetnPixelMapfvARB(map,bufSize,values);}
+void m_glFramebufferTextureEXT_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level)const{if(!this->m_glFramebufferTextureEXT)this->m_resolveOrThrow(2220);this->m_glFramebufferTextureEXT(target,attachment,texture,level);}
+void m_glMultiDrawElementsIndirectCount_lazy(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{if(!this->m_glMultiDrawElementsIndirectCount)this->m_resolveOrThrow(2221);this->m_glMultiDrawElementsIndirectCount(mode,type,indirect,drawcount,maxdrawcount,stride);}
+void m_glVertexAttribIPointer_lazy(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribIPointer)this->m_resolveOrThrow(2222);this->m_glVertexAttribIPointer(index,size,type,stride,pointer);}
+void m_glMultiTexCoordP3ui_lazy(GLenum texture,GLenum type,GLuint coords)const{if(!this->m_glMultiTexCoordP3ui)this->m_resolveOrThrow(2223);this->m_glMultiTexCoordP3ui(texture,type,coords);}
+void m_glEvaluateDepthValuesARB_lazy()const{if(!this->m_glEvaluateDepthValuesARB)this->m_resolveOrThrow(2224);this->m_glEvaluateDepthValuesARB();}
+void m_glGetNamedBufferParameteriv_lazy(GLuint buffer,GLenum pname,GLint* params)const{if(!this->m_glGetNamedBufferParameteriv)this->m_resolveOrThrow(2225);this->m_glGetNamedBufferParameteriv(buffer,pname,params);}
+void m_glGetNamedProgramLocalParameterfvEXT_lazy(GLuint program,GLenum target,GLuint index,GLfloat* params)const{if(!this->m_glGetNamedProgramLocalParameterfvEXT)this->m_resolveOrThrow(2226);this->m_glGetNamedProgramLocalParameterfvEXT(program,target,index,params);}
+void m_glColor4fNormal3fVertex3fvSUN_lazy(const GLfloat* c,const GLfloat* n,const GLfloat* v)const{if(!this->m_glColor4fNormal3fVertex3fvSUN)this->m_resolveOrThrow(2227);this->m_glColor4fNormal3fVertex3fvSUN(c,n,v);}
+void m_glSeparableFilter2DEXT_lazy(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column)const{if(!this->m_glSeparableFilter2DEXT)this->m_resolveOrThrow(2228);this->m_glSeparableFilter2DEXT(target,internalformat,width,height,format,type,row,column);}
+void m_glTexParameterxOES_lazy(GLenum target,GLenum pname,GLfixed param)const{if(!this->m_glTexParameterxOES)this->m_resolveOrThrow(2229);this->m_glTexParameterxOES(target,pname,param);}
+void m_glClearAccumxOES_lazy(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{if(!this->m_glClearAccumxOES)this->m_resolveOrThrow(2230);this->m_glClearAccumxOES(red,green,blue,alpha);}
+void m_glInvalidateFramebuffer_lazy(GLenum target,GLsizei numAttachments,const GLenum* attachments)const{if(!this->m_glInvalidateFramebuffer)this->m_resolveOrThrow(2231);this->m_glInvalidateFramebuffer(target,numAttachments,attachments);}
+void m_glWeightubvARB_lazy(GLint size,const GLubyte* weights)const{if(!this->m_glWeightubvARB)this->m_resolveOrThrow(2232);this->m_glWeightubvARB(size,weights);}
+void m_glVertexAttrib1d_lazy(GLuint index,GLdouble x)const{if(!this->m_glVertexAttrib1d)this->m_resolveOrThrow(2233);this->m_glVertexAttrib1d(index,x);}
+void m_glVertexAttrib1f_lazy(GLuint index,GLfloat x)const{if(!this->m_glVertexAttrib1f)this->m_resolveOrThrow(2234);this->m_glVertexAttrib1f(index,x);}
+void m_glVertex4fv_lazy(const GLfloat* v)const{if(!this->m_glVertex4fv)this->m_resolveOrThrow(2235);this->m_glVertex4fv(v);}
+void m_glClearNamedFramebufferfi_lazy(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{if(!this->m_glClearNamedFramebufferfi)this->m_resolveOrThrow(2236);this->m_glClearNamedFramebufferfi(framebuffer,buffer,drawbuffer,depth,stencil);}
+void m_glGetQueryBufferObjectuiv_lazy(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{if(!this->m_glGetQueryBufferObjectuiv)this->m_resolveOrThrow(2237);this->m_glGetQueryBufferObjectuiv(id,buffer,pname,offset);}
+void m_glClearNamedFramebufferfv_lazy(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value)const{if(!this->m_glClearNamedFramebufferfv)this->m_resolveOrThrow(2238);this->m_glClearNamedFramebufferfv(framebuffer,buffer,drawbuffer,value);}
+void m_glEndVertexShaderEXT_lazy()const{if(!this->m_glEndVertexShaderEXT)this->m_resolveOrThrow(2239);this->m_glEndVertexShaderEXT();}
+void m_glVertexAttrib1s_lazy(GLuint index,GLshort x)const{if(!this->m_glVertexAttrib1s)this->m_resolveOrThrow(2240);this->m_glVertexAttrib1s(index,x);}
+void m_glMultiTexCoord4dvARB_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord4dvARB)this->m_resolveOrThrow(2241);this->m_glMultiTexCoord4dvARB(target,v);}
+void m_glMultiTexCoord1sv_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord1sv)this->m_resolveOrThrow(2242);this->m_glMultiTexCoord1sv(target,v);}
+void m_glUniform1ui64vNV_lazy(GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glUniform1ui64vNV)this->m_resolveOrThrow(2243);this->m_glUniform1ui64vNV(location,count,value);}
+void m_glGetClipPlanefOES_lazy(GLenum plane,GLfloat* equation)const{if(!this->m_glGetClipPlanefOES)this->m_resolveOrThrow(2244);this->m_glGetClipPlanefOES(plane,equation);}
+void m_glRasterPos2s_lazy(GLshort x,GLshort y)const{if(!this->m_glRasterPos2s)this->m_resolveOrThrow(2245);this->m_glRasterPos2s(x,y);}
+void m_glWeightivARB_lazy(GLint size,const GLint* weights)const{if(!this->m_glWeightivARB)this->m_resolveOrThrow(2246);this->m_glWeightivARB(size,weights);}
+void m_glMultiTexCoord4hvNV_lazy(GLenum target,const GLhalfNV* v)const{if(!this->m_glMultiTexCoord4hvNV)this->m_resolveOrThrow(2247);this->m_glMultiTexCoord4hvNV(target,v);}
+void m_glNormal3hNV_lazy(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz)const{if(!this->m_glNormal3hNV)this->m_resolveOrThrow(2248);this->m_glNormal3hNV(nx,ny,nz);}
+void m_glGetSeparableFilter_lazy(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span)const{if(!this->m_glGetSeparableFilter)this->m_resolveOrThrow(2249);this->m_glGetSeparableFilter(target,format,type,row,column,span);}
+void m_glGetPathTexGenivNV_lazy(GLenum texCoordSet,GLenum pname,GLint* value)const{if(!this->m_glGetPathTexGenivNV)this->m_resolveOrThrow(2250);this->m_glGetPathTexGenivNV(texCoordSet,pname,value);}
+void m_glColor4bv_lazy(const GLbyte* v)const{if(!this->m_glColor4bv)this->m_resolveOrThrow(2251);this->m_glColor4bv(v);}
+void m_glRasterPos2f_lazy(GLfloat x,GLfloat y)const{if(!this->m_glRasterPos2f)this->m_resolveOrThrow(2252);this->m_glRasterPos2f(x,y);}
+void m_glNamedBufferPageCommitmentARB_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{if(!this->m_glNamedBufferPageCommitmentARB)this->m_resolveOrThrow(2253);this->m_glNamedBufferPageCommitmentARB(buffer,offset,size,commit);}
+void m_glLoadIdentity_lazy()const{if(!this->m_glLoadIdentity)this->m_resolveOrThrow(2254);this->m_glLoadIdentity();}
+void m_glRasterPos2i_lazy(GLint x,GLint y)const{if(!this->m_glRasterPos2i)this->m_resolveOrThrow(2255);this->m_glRasterPos2i(x,y);}
+void m_glRasterPos4iv_lazy(const GLint* v)const{if(!this->m_glRasterPos4iv)this->m_resolveOrThrow(2256);this->m_glRasterPos4iv(v);}
+void m_glMultiTexCoord2fvARB_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord2fvARB)this->m_resolveOrThrow(2257);this->m_glMultiTexCoord2fvARB(target,v);}
+void m_glUniformMatrix4x3fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix4x3fv)this->m_resolveOrThrow(2258);this->m_glUniformMatrix4x3fv(location,count,transpose,value);}
+void m_glClearBufferfv_lazy(GLenum buffer,GLint drawbuffer,const GLfloat* value)const{if(!this->m_glClearBufferfv)this->m_resolveOrThrow(2259);this->m_glClearBufferfv(buffer,drawbuffer,value);}
+void m_glMultiTexCoord4hNV_lazy(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{if(!this->m_glMultiTexCoord4hNV)this->m_resolveOrThrow(2260);this->m_glMultiTexCoord4hNV(target,s,t,r,q);}
+void m_glTextureBarrier_lazy()const{if(!this->m_glTextureBarrier)this->m_resolveOrThrow(2261);this->m_glTextureBarrier();}
+void m_glReplacementCodeuivSUN_lazy(const GLuint* code)const{if(!this->m_glReplacementCodeuivSUN)this->m_resolveOrThrow(2262);this->m_glReplacementCodeuivSUN(code);}
+void m_glDeleteAsyncMarkersSGIX_lazy(GLuint marker,GLsizei range)const{if(!this->m_glDeleteAsyncMarkersSGIX)this->m_resolveOrThrow(2263);this->m_glDeleteAsyncMarkersSGIX(marker,range);}
+void m_glTexCoord2bvOES_lazy(const GLbyte* coords)const{if(!this->m_glTexCoord2bvOES)this->m_resolveOrThrow(2264);this->m_glTexCoord2bvOES(coords);}
+void m_glEvalCoord2xOES_lazy(GLfixed u,GLfixed v)const{if(!this->m_glEvalCoord2xOES)this->m_resolveOrThrow(2265);this->m_glEvalCoord2xOES(u,v);}
+void m_glGetSharpenTexFuncSGIS_lazy(GLenum target,GLfloat* points)const{if(!this->m_glGetSharpenTexFuncSGIS)this->m_resolveOrThrow(2266);this->m_glGetSharpenTexFuncSGIS(target,points);}
+void m_glProgramUniformHandleui64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{if(!this->m_glProgramUniformHandleui64vNV)this->m_resolveOrThrow(2267);this->m_glProgramUniformHandleui64vNV(program,location,count,values);}
+void m_glIglooInterfaceSGIX_lazy(GLenum pname,const void* params)const{if(!this->m_glIglooInterfaceSGIX)this->m_resolveOrThrow(2268);this->m_glIglooInterfaceSGIX(pname,params);}
+void m_glWindowPos2dvARB_lazy(const GLdouble* v)const{if(!this->m_glWindowPos2dvARB)this->m_resolveOrThrow(2269);this->m_glWindowPos2dvARB(v);}
+void m_glClearBufferfi_lazy(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{if(!this->m_glClearBufferfi)this->m_resolveOrThrow(2270);this->m_glClearBufferfi(buffer,drawbuffer,depth,stencil);}
+void m_glDrawArraysIndirect_lazy(GLenum mode,const void* indirect)const{if(!this->m_glDrawArraysIndirect)this->m_resolveOrThrow(2271);this->m_glDrawArraysIndirect(mode,indirect);}
+void m_glGenVertexArrays_lazy(GLsizei n,GLuint* arrays)const{if(!this->m_glGenVertexArrays)this->m_resolveOrThrow(2272);this->m_glGenVertexArrays(n,arrays);}
+void m_glGetTransformFeedbacki64_v_lazy(GLuint xfb,GLenum pname,GLuint index,GLint64* param)const{if(!this->m_glGetTransformFeedbacki64_v)this->m_resolveOrThrow(2273);this->m_glGetTransformFeedbacki64_v(xfb,pname,index,param);}
+void m_glEnableVertexArrayAttrib_lazy(GLuint vaobj,GLuint index)const{if(!this->m_glEnableVertexArrayAttrib)this->m_resolveOrThrow(2274);this->m_glEnableVertexArrayAttrib(vaobj,index);}
+void m_glProgramUniformMatrix3x2dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix3x2dv)this->m_resolveOrThrow(2275);this->m_glProgramUniformMatrix3x2dv(program,location,count,transpose,value);}
+void m_glVertexStream4fATI_lazy(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glVertexStream4fATI)this->m_resolveOrThrow(2276);this->m_glVertexStream4fATI(stream,x,y,z,w);}
+void m_glVertexBindingDivisor_lazy(GLuint bindingindex,GLuint divisor)const{if(!this->m_glVertexBindingDivisor)this->m_resolveOrThrow(2277);this->m_glVertexBindingDivisor(bindingindex,divisor);}
+void m_glGetSamplerParameterIiv_lazy(GLuint sampler,GLenum pname,GLint* params)const{if(!this->m_glGetSamplerParameterIiv)this->m_resolveOrThrow(2278);this->m_glGetSamplerParameterIiv(sampler,pname,params);}
+void m_glGetCoverageModulationTableNV_lazy(GLsizei bufsize,GLfloat* v)const{if(!this->m_glGetCoverageModulationTableNV)this->m_resolveOrThrow(2279);this->m_glGetCoverageModulationTableNV(bufsize,v);}
+void m_glDepthRangedNV_lazy(GLdouble zNear,GLdouble zFar)const{if(!this->m_glDepthRangedNV)this->m_resolveOrThrow(2280);this->m_glDepthRangedNV(zNear,zFar);}
+void m_glVertexAttrib3f_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glVertexAttrib3f)this->m_resolveOrThrow(2281);this->m_glVertexAttrib3f(index,x,y,z);}
+void m_glMultiDrawRangeElementArrayAPPLE_lazy(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount)const{if(!this->m_glMultiDrawRangeElementArrayAPPLE)this->m_resolveOrThrow(2282);this->m_glMultiDrawRangeElementArrayAPPLE(mode,start,end,first,count,primcount);}
+void m_glVertexAttribFormatNV_lazy(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride)const{if(!this->m_glVertexAttribFormatNV)this->m_resolveOrThrow(2283);this->m_glVertexAttribFormatNV(index,size,type,normalized,stride);}
+void m_glGetQueryBufferObjecti64v_lazy(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{if(!this->m_glGetQueryBufferObjecti64v)this->m_resolveOrThrow(2284);this->m_glGetQueryBufferObjecti64v(id,buffer,pname,offset);}
+void m_glGetVertexAttribdv_lazy(GLuint index,GLenum pname,GLdouble* params)const{if(!this->m_glGetVertexAttribdv)this->m_resolveOrThrow(2285);this->m_glGetVertexAttribdv(index,pname,params);}
+void m_glGetUniformi64vARB_lazy(GLuint program,GLint location,GLint64* params)const{if(!this->m_glGetUniformi64vARB)this->m_resolveOrThrow(2286);this->m_glGetUniformi64vARB(program,location,params);}
+GLboolean m_glAreTexturesResidentEXT_lazy(GLsizei n,const GLuint* textures,GLboolean* residences)const{if(!this->m_glAreTexturesResidentEXT)this->m_resolveOrThrow(2287);return this->m_glAreTexturesResidentEXT(n,textures,residences);}
+GLhandleARB m_glGetHandleARB_lazy(GLenum pname)const{if(!this->m_glGetHandleARB)this->m_resolveOrThrow(2288);return this->m_glGetHandleARB(pname);}
+void m_glVideoCaptureStreamParameterdvNV_lazy(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params)const{if(!this->m_glVideoCaptureStreamParameterdvNV)this->m_resolveOrThrow(2289);this->m_glVideoCaptureStreamParameterdvNV(video_capture_slot,stream,pname,params);}
+void m_glMapParameterivNV_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glMapParameterivNV)this->m_resolveOrThrow(2290);this->m_glMapParameterivNV(target,pname,params);}
+GLboolean m_glIsVertexArray_lazy(GLuint array)const{if(!this->m_glIsVertexArray)this->m_resolveOrThrow(2291);return this->m_glIsVertexArray(array);}
+void m_glSecondaryColor3sEXT_lazy(GLshort red,GLshort green,GLshort blue)const{if(!this->m_glSecondaryColor3sEXT)this->m_resolveOrThrow(2292);this->m_glSecondaryColor3sEXT(red,green,blue);}
+void m_glGetTexParameterIivEXT_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTexParameterIivEXT)this->m_resolveOrThrow(2293);this->m_glGetTexParameterIivEXT(target,pname,params);}
+void m_glFrameTerminatorGREMEDY_lazy()const{if(!this->m_glFrameTerminatorGREMEDY)this->m_resolveOrThrow(2294);this->m_glFrameTerminatorGREMEDY();}
+void m_glBlendBarrierKHR_lazy()const{if(!this->m_glBlendBarrierKHR)this->m_resolveOrThrow(2295);this->m_glBlendBarrierKHR();}
+void m_glVertexAttrib4NubARB_lazy(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{if(!this->m_glVertexAttrib4NubARB)this->m_resolveOrThrow(2296);this->m_glVertexAttrib4NubARB(index,x,y,z,w);}
+void m_glPrimitiveRestartNV_lazy()const{if(!this->m_glPrimitiveRestartNV)this->m_resolveOrThrow(2297);this->m_glPrimitiveRestartNV();}
+void m_glVertexAttribL1ui64vARB_lazy(GLuint index,const GLuint64EXT* v)const{if(!this->m_glVertexAttribL1ui64vARB)this->m_resolveOrThrow(2298);this->m_glVertexAttribL1ui64vARB(index,v);}
+void m_glVertexAttribI4ivEXT_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI4ivEXT)this->m_resolveOrThrow(2299);this->m_glVertexAttribI4ivEXT(index,v);}
+void m_glVertexAttribs4svNV_lazy(GLuint index,GLsizei count,const GLshort* v)const{if(!this->m_glVertexAttribs4svNV)this->m_resolveOrThrow(2300);this->m_glVertexAttribs4svNV(index,count,v);}
+void m_glUniform1ui_lazy(GLint location,GLuint v0)const{if(!this->m_glUniform1ui)this->m_resolveOrThrow(2301);this->m_glUniform1ui(location,v0);}
+void m_glVertexAttrib2fvARB_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib2fvARB)this->m_resolveOrThrow(2302);this->m_glVertexAttrib2fvARB(index,v);}
+void m_glVertexAttribI4svEXT_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttribI4svEXT)this->m_resolveOrThrow(2303);this->m_glVertexAttribI4svEXT(index,v);}
+void m_glTextureImage3DMultisampleCoverageNV_lazy(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{if(!this->m_glTextureImage3DMultisampleCoverageNV)this->m_resolveOrThrow(2304);this->m_glTextureImage3DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+void m_glMemoryBarrier_lazy(GLbitfield barriers)const{if(!this->m_glMemoryBarrier)this->m_resolveOrThrow(2305);this->m_glMemoryBarrier(barriers);}
+void m_glGetVariantArrayObjectfvATI_lazy(GLuint id,GLenum pname,GLfloat* params)const{if(!this->m_glGetVariantArrayObjectfvATI)this->m_resolveOrThrow(2306);this->m_glGetVariantArrayObjectfvATI(id,pname,params);}
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_lazy(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{if(!this->m_glTexCoord4fColor4fNormal3fVertex4fvSUN)this->m_resolveOrThrow(2307);this->m_glTexCoord4fColor4fNormal3fVertex4fvSUN(tc,c,n,v);}
+GLboolean m_glIsProgramARB_lazy(GLuint program)const{if(!this->m_glIsProgramARB)this->m_resolveOrThrow(2308);return this->m_glIsProgramARB(program);}
+void m_glBindImageTextureEXT_lazy(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format)const{if(!this->m_glBindImageTextureEXT)this->m_resolveOrThrow(2309);this->m_glBindImageTextureEXT(index,texture,level,layered,layer,access,format);}
+GLint m_glGetFragDataLocation_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetFragDataLocation)this->m_resolveOrThrow(2310);return this->m_glGetFragDataLocation(program,name);}
+void m_glMultiTexCoord1svARB_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord1svARB)this->m_resolveOrThrow(2311);this->m_glMultiTexCoord1svARB(target,v);}
+void m_glGetMapxvOES_lazy(GLenum target,GLenum query,GLfixed* v)const{if(!this->m_glGetMapxvOES)this->m_resolveOrThrow(2312);this->m_glGetMapxvOES(target,query,v);}
+void m_glTextureStorage2DMultisampleEXT_lazy(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{if(!this->m_glTextureStorage2DMultisampleEXT)this->m_resolveOrThrow(2313);this->m_glTextureStorage2DMultisampleEXT(texture,target,samples,internalformat,width,height,fixedsamplelocations);}
+void m_glGetMaterialfv_lazy(GLenum face,GLenum pname,GLfloat* params)const{if(!this->m_glGetMaterialfv)this->m_resolveOrThrow(2314);this->m_glGetMaterialfv(face,pname,params);}
+void m_glVertexAttrib4NbvARB_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttrib4NbvARB)this->m_resolveOrThrow(2315);this->m_glVertexAttrib4NbvARB(index,v);}
+void m_glPixelMapuiv_lazy(GLenum map,GLsizei mapsize,const GLuint* values)const{if(!this->m_glPixelMapuiv)this->m_resolveOrThrow(2316);this->m_glPixelMapuiv(map,mapsize,values);}
+void m_glColorPointerEXT_lazy(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{if(!this->m_glColorPointerEXT)this->m_resolveOrThrow(2317);this->m_glColorPointerEXT(size,type,stride,count,pointer);}
+void m_glEnableClientStateiEXT_lazy(GLenum array,GLuint index)const{if(!this->m_glEnableClientStateiEXT)this->m_resolveOrThrow(2318);this->m_glEnableClientStateiEXT(array,index);}
+void m_glClearTexSubImage_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data)const{if(!this->m_glClearTexSubImage)this->m_resolveOrThrow(2319);this->m_glClearTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);}
+void m_glEvalCoord1xvOES_lazy(const GLfixed* coords)const{if(!this->m_glEvalCoord1xvOES)this->m_resolveOrThrow(2320);this->m_glEvalCoord1xvOES(coords);}
+void m_glDetachObjectARB_lazy(GLhandleARB containerObj,GLhandleARB attachedObj)const{if(!this->m_glDetachObjectARB)this->m_resolveOrThrow(2321);this->m_glDetachObjectARB(containerObj,attachedObj);}
+void m_glGetTextureParameterIiv_lazy(GLuint texture,GLenum pname,GLint* params)const{if(!this->m_glGetTextureParameterIiv)this->m_resolveOrThrow(2322);this->m_glGetTextureParameterIiv(texture,pname,params);}
+void m_glVariantusvEXT_lazy(GLuint id,const GLushort* addr)const{if(!this->m_glVariantusvEXT)this->m_resolveOrThrow(2323);this->m_glVariantusvEXT(id,addr);}
+void m_glCompressedTextureImage3DEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureImage3DEXT)this->m_resolveOrThrow(2324);this->m_glCompressedTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+void m_glMultiTexCoord1dARB_lazy(GLenum target,GLdouble s)const{if(!this->m_glMultiTexCoord1dARB)this->m_resolveOrThrow(2325);this->m_glMultiTexCoord1dARB(target,s);}
+void m_glGetVertexArrayIntegeri_vEXT_lazy(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{if(!this->m_glGetVertexArrayIntegeri_vEXT)this->m_resolveOrThrow(2326);this->m_glGetVertexArrayIntegeri_vEXT(vaobj,index,pname,param);}
+void m_glVertexAttribI4ubv_lazy(GLuint index,const GLubyte* v)const{if(!this->m_glVertexAttribI4ubv)this->m_resolveOrThrow(2327);this->m_glVertexAttribI4ubv(index,v);}
+void m_glPixelTexGenParameterfSGIS_lazy(GLenum pname,GLfloat param)const{if(!this->m_glPixelTexGenParameterfSGIS)this->m_resolveOrThrow(2328);this->m_glPixelTexGenParameterfSGIS(pname,param);}
+void m_glProgramUniformMatrix4x2dv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix4x2dv)this->m_resolveOrThrow(2329);this->m_glProgramUniformMatrix4x2dv(program,location,count,transpose,value);}
+void m_glUniform3fARB_lazy(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{if(!this->m_glUniform3fARB)this->m_resolveOrThrow(2330);this->m_glUniform3fARB(location,v0,v1,v2);}
+GLboolean m_glIsShader_lazy(GLuint shader)const{if(!this->m_glIsShader)this->m_resolveOrThrow(2331);return this->m_glIsShader(shader);}
+void m_glConvolutionParameteriv_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glConvolutionParameteriv)this->m_resolveOrThrow(2332);this->m_glConvolutionParameteriv(target,pname,params);}
+void m_glCopyMultiTexSubImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyMultiTexSubImage2DEXT)this->m_resolveOrThrow(2333);this->m_glCopyMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,x,y,width,height);}
+void m_glEnableVertexAttribArrayARB_lazy(GLuint index)const{if(!this->m_glEnableVertexAttribArrayARB)this->m_resolveOrThrow(2334);this->m_glEnableVertexAttribArrayARB(index);}
+void m_glMulticastCopyBufferSubDataNV_lazy(GLuint readGpu,GLbitfield writeGpuMask,GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{if(!this->m_glMulticastCopyBufferSubDataNV)this->m_resolveOrThrow(2335);this->m_glMulticastCopyBufferSubDataNV(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);}
+void m_glEnable_lazy(GLenum cap)const{if(!this->m_glEnable)this->m_resolveOrThrow(2336);this->m_glEnable(cap);}
+void m_glGetActiveUniformsiv_lazy(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params)const{if(!this->m_glGetActiveUniformsiv)this->m_resolveOrThrow(2337);this->m_glGetActiveUniformsiv(program,uniformCount,uniformIndices,pname,params);}
+void m_glGetVertexAttribivARB_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribivARB)this->m_resolveOrThrow(2338);this->m_glGetVertexAttribivARB(index,pname,params);}
+void m_glTexCoord4hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glTexCoord4hvNV)this->m_resolveOrThrow(2339);this->m_glTexCoord4hvNV(v);}
+void m_glUseProgramObjectARB_lazy(GLhandleARB programObj)const{if(!this->m_glUseProgramObjectARB)this->m_resolveOrThrow(2340);this->m_glUseProgramObjectARB(programObj);}
+GLint m_glGetAttribLocation_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetAttribLocation)this->m_resolveOrThrow(2341);return this->m_glGetAttribLocation(program,name);}
+void m_glVertexAttrib4dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib4dv)this->m_resolveOrThrow(2342);this->m_glVertexAttrib4dv(index,v);}
+void m_glGetTextureParameteriv_lazy(GLuint texture,GLenum pname,GLint* params)const{if(!this->m_glGetTextureParameteriv)this->m_resolveOrThrow(2343);this->m_glGetTextureParameteriv(texture,pname,params);}
+void m_glNamedBufferStorageMemEXT_lazy(GLuint buffer,GLsizeiptr size,GLuint memory,GLuint64 offset)const{if(!this->m_glNamedBufferStorageMemEXT)this->m_resolveOrThrow(2344);this->m_glNamedBufferStorageMemEXT(buffer,size,memory,offset);}
+void m_glPathSubCoordsNV_lazy(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords)const{if(!this->m_glPathSubCoordsNV)this->m_resolveOrThrow(2345);this->m_glPathSubCoordsNV(path,coordStart,numCoords,coordType,coords);}
+void m_glMatrixIndexusvARB_lazy(GLint size,const GLushort* indices)const{if(!this->m_glMatrixIndexusvARB)this->m_resolveOrThrow(2346);this->m_glMatrixIndexusvARB(size,indices);}
+void m_glGetVideouivNV_lazy(GLuint video_slot,GLenum pname,GLuint* params)const{if(!this->m_glGetVideouivNV)this->m_resolveOrThrow(2347);this->m_glGetVideouivNV(video_slot,pname,params);}
+void m_glGetVideoCaptureivNV_lazy(GLuint video_capture_slot,GLenum pname,GLint* params)const{if(!this->m_glGetVideoCaptureivNV)this->m_resolveOrThrow(2348);this->m_glGetVideoCaptureivNV(video_capture_slot,pname,params);}
+void m_glProgramUniform3ui_lazy(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{if(!this->m_glProgramUniform3ui)this->m_resolveOrThrow(2349);this->m_glProgramUniform3ui(program,location,v0,v1,v2);}
+void m_glVertexAttrib3svARB_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib3svARB)this->m_resolveOrThrow(2350);this->m_glVertexAttrib3svARB(index,v);}
+void m_glGetNamedBufferParameterivEXT_lazy(GLuint buffer,GLenum pname,GLint* params)const{if(!this->m_glGetNamedBufferParameterivEXT)this->m_resolveOrThrow(2351);this->m_glGetNamedBufferParameterivEXT(buffer,pname,params);}
+void m_glMatrixScaledEXT_lazy(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glMatrixScaledEXT)this->m_resolveOrThrow(2352);this->m_glMatrixScaledEXT(mode,x,y,z);}
+void m_glProgramUniformMatrix2x3fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2x3fv)this->m_resolveOrThrow(2353);this->m_glProgramUniformMatrix2x3fv(program,location,count,transpose,value);}
+void m_glGetFragmentLightivSGIX_lazy(GLenum light,GLenum pname,GLint* params)const{if(!this->m_glGetFragmentLightivSGIX)this->m_resolveOrThrow(2354);this->m_glGetFragmentLightivSGIX(light,pname,params);}
+const GLubyte* m_glGetStringi_lazy(GLenum name,GLuint index)const{if(!this->m_glGetStringi)this->m_resolveOrThrow(2355);return this->m_glGetStringi(name,index);}
+void m_glWindowPos2svARB_lazy(const GLshort* v)const{if(!this->m_glWindowPos2svARB)this->m_resolveOrThrow(2356);this->m_glWindowPos2svARB(v);}
+void m_glVertexAttrib2svNV_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib2svNV)this->m_resolveOrThrow(2357);this->m_glVertexAttrib2svNV(index,v);}
+void m_glWindowPos2ivARB_lazy(const GLint* v)const{if(!this->m_glWindowPos2ivARB)this->m_resolveOrThrow(2358);this->m_glWindowPos2ivARB(v);}
+void m_glGetVertexAttribPointervNV_lazy(GLuint index,GLenum pname,void** pointer)const{if(!this->m_glGetVertexAttribPointervNV)this->m_resolveOrThrow(2359);this->m_glGetVertexAttribPointervNV(index,pname,pointer);}
+void m_glPushMatrix_lazy()const{if(!this->m_glPushMatrix)this->m_resolveOrThrow(2360);this->m_glPushMatrix();}
+void m_glEdgeFlagPointerListIBM_lazy(GLint stride,const GLboolean** pointer,GLint ptrstride)const{if(!this->m_glEdgeFlagPointerListIBM)this->m_resolveOrThrow(2361);this->m_glEdgeFlagPointerListIBM(stride,pointer,ptrstride);}
+void m_glGenerateMipmapEXT_lazy(GLenum target)const{if(!this->m_glGenerateMipmapEXT)this->m_resolveOrThrow(2362);this->m_glGenerateMipmapEXT(target);}
+void m_glWindowPos3sv_lazy(const GLshort* v)const{if(!this->m_glWindowPos3sv)this->m_resolveOrThrow(2363);this->m_glWindowPos3sv(v);}
+void m_glPathCoordsNV_lazy(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords)const{if(!this->m_glPathCoordsNV)this->m_resolveOrThrow(2364);this->m_glPathCoordsNV(path,numCoords,coordType,coords);}
+void m_glProgramUniform1i_lazy(GLuint program,GLint location,GLint v0)const{if(!this->m_glProgramUniform1i)this->m_resolveOrThrow(2365);this->m_glProgramUniform1i(program,location,v0);}
+void m_glProgramUniform1d_lazy(GLuint program,GLint location,GLdouble v0)const{if(!this->m_glProgramUniform1d)this->m_resolveOrThrow(2366);this->m_glProgramUniform1d(program,location,v0);}
+void m_glProgramUniform1f_lazy(GLuint program,GLint location,GLfloat v0)const{if(!this->m_glProgramUniform1f)this->m_resolveOrThrow(2367);this->m_glProgramUniform1f(program,location,v0);}
+void m_glProgramParameteriEXT_lazy(GLuint program,GLenum pname,GLint value)const{if(!this->m_glProgramParameteriEXT)this->m_resolveOrThrow(2368);this->m_glProgramParameteriEXT(program,pname,value);}
+void m_glCompressedMultiTexImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexImage2DEXT)this->m_resolveOrThrow(2369);this->m_glCompressedMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,imageSize,bits);}
+void m_glProgramUniform3iv_lazy(GLuint program,GLint location,GLsizei count,const GLint* value)const{if(!this->m_glProgramUniform3iv)this->m_resolveOrThrow(2370);this->m_glProgramUniform3iv(program,location,count,value);}
+void m_glIndexiv_lazy(const GLint* c)const{if(!this->m_glIndexiv)this->m_resolveOrThrow(2371);this->m_glIndexiv(c);}
+void m_glMultiTexCoord4xvOES_lazy(GLenum texture,const GLfixed* coords)const{if(!this->m_glMultiTexCoord4xvOES)this->m_resolveOrThrow(2372);this->m_glMultiTexCoord4xvOES(texture,coords);}
+void m_glEGLImageTargetTexture2DOES_lazy(GLenum target,GLeglImageOES image)const{if(!this->m_glEGLImageTargetTexture2DOES)this->m_resolveOrThrow(2373);this->m_glEGLImageTargetTexture2DOES(target,image);}
+void m_glPixelZoom_lazy(GLfloat xfactor,GLfloat yfactor)const{if(!this->m_glPixelZoom)this->m_resolveOrThrow(2374);this->m_glPixelZoom(xfactor,yfactor);}
+void m_glVertex3bvOES_lazy(const GLbyte* coords)const{if(!this->m_glVertex3bvOES)this->m_resolveOrThrow(2375);this->m_glVertex3bvOES(coords);}
+void m_glFramebufferReadBufferEXT_lazy(GLuint framebuffer,GLenum mode)const{if(!this->m_glFramebufferReadBufferEXT)this->m_resolveOrThrow(2376);this->m_glFramebufferReadBufferEXT(framebuffer,mode);}
+void m_glExtractComponentEXT_lazy(GLuint res,GLuint src,GLuint num)const{if(!this->m_glExtractComponentEXT)this->m_resolveOrThrow(2377);this->m_glExtractComponentEXT(res,src,num);}
+void m_glCombinerParameterivNV_lazy(GLenum pname,const GLint* params)const{if(!this->m_glCombinerParameterivNV)this->m_resolveOrThrow(2378);this->m_glCombinerParameterivNV(pname,params);}
+void m_glMinmax_lazy(GLenum target,GLenum internalformat,GLboolean sink)const{if(!this->m_glMinmax)this->m_resolveOrThrow(2379);this->m_glMinmax(target,internalformat,sink);}
+void m_glColorP3ui_lazy(GLenum type,GLuint color)const{if(!this->m_glColorP3ui)this->m_resolveOrThrow(2380);this->m_glColorP3ui(type,color);}
+void m_glPointParameterfvSGIS_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glPointParameterfvSGIS)this->m_resolveOrThrow(2381);this->m_glPointParameterfvSGIS(pname,params);}
+void m_glBlendEquationi_lazy(GLuint buf,GLenum mode)const{if(!this->m_glBlendEquationi)this->m_resolveOrThrow(2382);this->m_glBlendEquationi(buf,mode);}
+void m_glGetFogFuncSGIS_lazy(GLfloat* points)const{if(!this->m_glGetFogFuncSGIS)this->m_resolveOrThrow(2383);this->m_glGetFogFuncSGIS(points);}
+void m_glVertexAttrib4fvNV_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib4fvNV)this->m_resolveOrThrow(2384);this->m_glVertexAttrib4fvNV(index,v);}
+void m_glGetnMinmax_lazy(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{if(!this->m_glGetnMinmax)this->m_resolveOrThrow(2385);this->m_glGetnMinmax(target,reset,format,type,bufSize,values);}
+void m_glFragmentLightiSGIX_lazy(GLenum light,GLenum pname,GLint param)const{if(!this->m_glFragmentLightiSGIX)this->m_resolveOrThrow(2386);this->m_glFragmentLightiSGIX(light,pname,param);}
+void m_glMultiTexCoord1bvOES_lazy(GLenum texture,const GLbyte* coords)const{if(!this->m_glMultiTexCoord1bvOES)this->m_resolveOrThrow(2387);this->m_glMultiTexCoord1bvOES(texture,coords);}
+void m_glSecondaryColorPointerEXT_lazy(GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glSecondaryColorPointerEXT)this->m_resolveOrThrow(2388);this->m_glSecondaryColorPointerEXT(size,type,stride,pointer);}
+void m_glMultiTexCoordP4uiv_lazy(GLenum texture,GLenum type,const GLuint* coords)const{if(!this->m_glMultiTexCoordP4uiv)this->m_resolveOrThrow(2389);this->m_glMultiTexCoordP4uiv(texture,type,coords);}
+void m_glGetBufferSubDataARB_lazy(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data)const{if(!this->m_glGetBufferSubDataARB)this->m_resolveOrThrow(2390);this->m_glGetBufferSubDataARB(target,offset,size,data);}
+void m_glSecondaryColor3hNV_lazy(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{if(!this->m_glSecondaryColor3hNV)this->m_resolveOrThrow(2391);this->m_glSecondaryColor3hNV(red,green,blue);}
+void m_glGetPathParameterivNV_lazy(GLuint path,GLenum pname,GLint* value)const{if(!this->m_glGetPathParameterivNV)this->m_resolveOrThrow(2392);this->m_glGetPathParameterivNV(path,pname,value);}
+void m_glFlushRasterSGIX_lazy()const{if(!this->m_glFlushRasterSGIX)this->m_resolveOrThrow(2393);this->m_glFlushRasterSGIX();}
+void m_glElementPointerATI_lazy(GLenum type,const void* pointer)const{if(!this->m_glElementPointerATI)this->m_resolveOrThrow(2394);this->m_glElementPointerATI(type,pointer);}
+void m_glGetAttachedObjectsARB_lazy(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj)const{if(!this->m_glGetAttachedObjectsARB)this->m_resolveOrThrow(2395);this->m_glGetAttachedObjectsARB(containerObj,maxCount,count,obj);}
+void m_glUniform4iv_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform4iv)this->m_resolveOrThrow(2396);this->m_glUniform4iv(location,count,value);}
+void m_glFogxOES_lazy(GLenum pname,GLfixed param)const{if(!this->m_glFogxOES)this->m_resolveOrThrow(2397);this->m_glFogxOES(pname,param);}
+void m_glSharpenTexFuncSGIS_lazy(GLenum target,GLsizei n,const GLfloat* points)const{if(!this->m_glSharpenTexFuncSGIS)this->m_resolveOrThrow(2398);this->m_glSharpenTexFuncSGIS(target,n,points);}
+void m_glClearDepthfOES_lazy(GLclampf depth)const{if(!this->m_glClearDepthfOES)this->m_resolveOrThrow(2399);this->m_glClearDepthfOES(depth);}
+void m_glDeleteCommandListsNV_lazy(GLsizei n,const GLuint* lists)const{if(!this->m_glDeleteCommandListsNV)this->m_resolveOrThrow(2400);this->m_glDeleteCommandListsNV(n,lists);}
+void m_glSpecializeShader_lazy(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{if(!this->m_glSpecializeShader)this->m_resolveOrThrow(2401);this->m_glSpecializeShader(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+void m_glVertex4hNV_lazy(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{if(!this->m_glVertex4hNV)this->m_resolveOrThrow(2402);this->m_glVertex4hNV(x,y,z,w);}
+void m_glSecondaryColor3dvEXT_lazy(const GLdouble* v)const{if(!this->m_glSecondaryColor3dvEXT)this->m_resolveOrThrow(2403);this->m_glSecondaryColor3dvEXT(v);}
+void m_glGenTextures_lazy(GLsizei n,GLuint* textures)const{if(!this->m_glGenTextures)this->m_resolveOrThrow(2404);this->m_glGenTextures(n,textures);}
+void m_glTextureStorage2DMultisample_lazy(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{if(!this->m_glTextureStorage2DMultisample)this->m_resolveOrThrow(2405);this->m_glTextureStorage2DMultisample(texture,samples,internalformat,width,height,fixedsamplelocations);}
+void m_glUniform3ui64vNV_lazy(GLint location,GLsizei count,const GLuint64EXT* value)const{if(!this->m_glUniform3ui64vNV)this->m_resolveOrThrow(2406);this->m_glUniform3ui64vNV(location,count,value);}
+void m_glBlendFuncSeparateIndexedAMD_lazy(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{if(!this->m_glBlendFuncSeparateIndexedAMD)this->m_resolveOrThrow(2407);this->m_glBlendFuncSeparateIndexedAMD(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+void m_glMakeBufferResidentNV_lazy(GLenum target,GLenum access)const{if(!this->m_glMakeBufferResidentNV)this->m_resolveOrThrow(2408);this->m_glMakeBufferResidentNV(target,access);}
+void m_glShaderOp2EXT_lazy(GLenum op,GLuint res,GLuint arg1,GLuint arg2)const{if(!this->m_glShaderOp2EXT)this->m_resolveOrThrow(2409);this->m_glShaderOp2EXT(op,res,arg1,arg2);}
+void m_glGetVertexAttribivNV_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribivNV)this->m_resolveOrThrow(2410);this->m_glGetVertexAttribivNV(index,pname,params);}
+void m_glTexParameterIivEXT_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTexParameterIivEXT)this->m_resolveOrThrow(2411);this->m_glTexParameterIivEXT(target,pname,params);}
+void m_glGetPerfQueryDataINTEL_lazy(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten)const{if(!this->m_glGetPerfQueryDataINTEL)this->m_resolveOrThrow(2412);this->m_glGetPerfQueryDataINTEL(queryHandle,flags,dataSize,data,bytesWritten);}
+void m_glVertexAttrib4dvARB_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib4dvARB)this->m_resolveOrThrow(2413);this->m_glVertexAttrib4dvARB(index,v);}
+void m_glTextureSubImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage1DEXT)this->m_resolveOrThrow(2414);this->m_glTextureSubImage1DEXT(texture,target,level,xoffset,width,format,type,pixels);}
+void m_glGetActiveUniformBlockName_lazy(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName)const{if(!this->m_glGetActiveUniformBlockName)this->m_resolveOrThrow(2415);this->m_glGetActiveUniformBlockName(program,uniformBlockIndex,bufSize,length,uniformBlockName);}
+void m_glVertexAttrib2dvARB_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib2dvARB)this->m_resolveOrThrow(2416);this->m_glVertexAttrib2dvARB(index,v);}
+void m_glVertexAttribPointer_lazy(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribPointer)this->m_resolveOrThrow(2417);this->m_glVertexAttribPointer(index,size,type,normalized,stride,pointer);}
+void m_glDepthBoundsdNV_lazy(GLdouble zmin,GLdouble zmax)const{if(!this->m_glDepthBoundsdNV)this->m_resolveOrThrow(2418);this->m_glDepthBoundsdNV(zmin,zmax);}
+void m_glDeleteTexturesEXT_lazy(GLsizei n,const GLuint* textures)const{if(!this->m_glDeleteTexturesEXT)this->m_resolveOrThrow(2419);this->m_glDeleteTexturesEXT(n,textures);}
+void m_glDrawBuffersATI_lazy(GLsizei n,const GLenum* bufs)const{if(!this->m_glDrawBuffersATI)this->m_resolveOrThrow(2420);this->m_glDrawBuffersATI(n,bufs);}
+void m_glLightModelxvOES_lazy(GLenum pname,const GLfixed* param)const{if(!this->m_glLightModelxvOES)this->m_resolveOrThrow(2421);this->m_glLightModelxvOES(pname,param);}
+void m_glApplyTextureEXT_lazy(GLenum mode)const{if(!this->m_glApplyTextureEXT)this->m_resolveOrThrow(2422);this->m_glApplyTextureEXT(mode);}
+GLuint64 m_glGetImageHandleNV_lazy(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{if(!this->m_glGetImageHandleNV)this->m_resolveOrThrow(2423);return this->m_glGetImageHandleNV(texture,level,layered,layer,format);}
+void m_glGetMinmax_lazy(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values)const{if(!this->m_glGetMinmax)this->m_resolveOrThrow(2424);this->m_glGetMinmax(target,reset,format,types,values);}
+void m_glGetFixedvOES_lazy(GLenum pname,GLfixed* params)const{if(!this->m_glGetFixedvOES)this->m_resolveOrThrow(2425);this->m_glGetFixedvOES(pname,params);}
+void m_glSamplePatternEXT_lazy(GLenum pattern)const{if(!this->m_glSamplePatternEXT)this->m_resolveOrThrow(2426);this->m_glSamplePatternEXT(pattern);}
+void m_glUniform1f_lazy(GLint location,GLfloat v0)const{if(!this->m_glUniform1f)this->m_resolveOrThrow(2427);this->m_glUniform1f(location,v0);}
+void m_glColor4fNormal3fVertex3fSUN_lazy(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glColor4fNormal3fVertex3fSUN)this->m_resolveOrThrow(2428);this->m_glColor4fNormal3fVertex3fSUN(r,g,b,a,nx,ny,nz,x,y,z);}
+void m_glFogCoorddvEXT_lazy(const GLdouble* coord)const{if(!this->m_glFogCoorddvEXT)this->m_resolveOrThrow(2429);this->m_glFogCoorddvEXT(coord);}
+void m_glCopyTextureImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{if(!this->m_glCopyTextureImage1DEXT)this->m_resolveOrThrow(2430);this->m_glCopyTextureImage1DEXT(texture,target,level,internalformat,x,y,width,border);}
+void m_glFlushMappedBufferRangeAPPLE_lazy(GLenum target,GLintptr offset,GLsizeiptr size)const{if(!this->m_glFlushMappedBufferRangeAPPLE)this->m_resolveOrThrow(2431);this->m_glFlushMappedBufferRangeAPPLE(target,offset,size);}
+void m_glVertex3sv_lazy(const GLshort* v)const{if(!this->m_glVertex3sv)this->m_resolveOrThrow(2432);this->m_glVertex3sv(v);}
+void m_glFlushStaticDataIBM_lazy(GLenum target)const{if(!this->m_glFlushStaticDataIBM)this->m_resolveOrThrow(2433);this->m_glFlushStaticDataIBM(target);}
+void m_glProgramUniform4ui64NV_lazy(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{if(!this->m_glProgramUniform4ui64NV)this->m_resolveOrThrow(2434);this->m_glProgramUniform4ui64NV(program,location,x,y,z,w);}
+void m_glRasterPos4xOES_lazy(GLfixed x,GLfixed y,GLfixed z,GLfixed w)const{if(!this->m_glRasterPos4xOES)this->m_resolveOrThrow(2435);this->m_glRasterPos4xOES(x,y,z,w);}
+void m_glVertexAttribP1ui_lazy(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{if(!this->m_glVertexAttribP1ui)this->m_resolveOrThrow(2436);this->m_glVertexAttribP1ui(index,type,normalized,value);}
+void m_glProgramUniform4dvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform4dvEXT)this->m_resolveOrThrow(2437);this->m_glProgramUniform4dvEXT(program,location,count,value);}
+void m_glEndTransformFeedbackEXT_lazy()const{if(!this->m_glEndTransformFeedbackEXT)this->m_resolveOrThrow(2438);this->m_glEndTransformFeedbackEXT();}
+void m_glBinormal3dEXT_lazy(GLdouble bx,GLdouble by,GLdouble bz)const{if(!this->m_glBinormal3dEXT)this->m_resolveOrThrow(2439);this->m_glBinormal3dEXT(bx,by,bz);}
+void m_glGetTextureSubImage_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{if(!this->m_glGetTextureSubImage)this->m_resolveOrThrow(2440);this->m_glGetTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);}
+void m_glGetNamedRenderbufferParameteriv_lazy(GLuint renderbuffer,GLenum pname,GLint* params)const{if(!this->m_glGetNamedRenderbufferParameteriv)this->m_resolveOrThrow(2441);this->m_glGetNamedRenderbufferParameteriv(renderbuffer,pname,params);}
+void m_glBindBuffersRange_lazy(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes)const{if(!this->m_glBindBuffersRange)this->m_resolveOrThrow(2442);this->m_glBindBuffersRange(target,first,count,buffers,offsets,sizes);}
+GLint m_glFinishAsyncSGIX_lazy(GLuint* markerp)const{if(!this->m_glFinishAsyncSGIX)this->m_resolveOrThrow(2443);return this->m_glFinishAsyncSGIX(markerp);}
+void m_glBindFragDataLocationIndexed_lazy(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name)const{if(!this->m_glBindFragDataLocationIndexed)this->m_resolveOrThrow(2444);this->m_glBindFragDataLocationIndexed(program,colorNumber,index,name);}
+void m_glMultiTexCoord2dv_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord2dv)this->m_resolveOrThrow(2445);this->m_glMultiTexCoord2dv(target,v);}
+void m_glUniform2iv_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform2iv)this->m_resolveOrThrow(2446);this->m_glUniform2iv(location,count,value);}
+void m_glProgramUniform2i64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glProgramUniform2i64vNV)this->m_resolveOrThrow(2447);this->m_glProgramUniform2i64vNV(program,location,count,value);}
+void m_glFlushVertexArrayRangeAPPLE_lazy(GLsizei length,void* pointer)const{if(!this->m_glFlushVertexArrayRangeAPPLE)this->m_resolveOrThrow(2448);this->m_glFlushVertexArrayRangeAPPLE(length,pointer);}
+void m_glTextureParameterf_lazy(GLuint texture,GLenum pname,GLfloat param)const{if(!this->m_glTextureParameterf)this->m_resolveOrThrow(2449);this->m_glTextureParameterf(texture,pname,param);}
+void m_glMultiTexCoord3dvARB_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord3dvARB)this->m_resolveOrThrow(2450);this->m_glMultiTexCoord3dvARB(target,v);}
+void m_glFeedbackBuffer_lazy(GLsizei size,GLenum type,GLfloat* buffer)const{if(!this->m_glFeedbackBuffer)this->m_resolveOrThrow(2451);this->m_glFeedbackBuffer(size,type,buffer);}
+void m_glDebugMessageInsertARB_lazy(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{if(!this->m_glDebugMessageInsertARB)this->m_resolveOrThrow(2452);this->m_glDebugMessageInsertARB(source,type,id,severity,length,buf);}
+void m_glMultiTexCoord2i_lazy(GLenum target,GLint s,GLint t)const{if(!this->m_glMultiTexCoord2i)this->m_resolveOrThrow(2453);this->m_glMultiTexCoord2i(target,s,t);}
+void m_glTextureSubImage3D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage3D)this->m_resolveOrThrow(2454);this->m_glTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+void m_glFramebufferTexture1D_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glFramebufferTexture1D)this->m_resolveOrThrow(2455);this->m_glFramebufferTexture1D(target,attachment,textarget,texture,level);}
+void m_glGetShaderiv_lazy(GLuint shader,GLenum pname,GLint* params)const{if(!this->m_glGetShaderiv)this->m_resolveOrThrow(2456);this->m_glGetShaderiv(shader,pname,params);}
+void m_glMultiTexCoord2d_lazy(GLenum target,GLdouble s,GLdouble t)const{if(!this->m_glMultiTexCoord2d)this->m_resolveOrThrow(2457);this->m_glMultiTexCoord2d(target,s,t);}
+void m_glArrayObjectATI_lazy(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{if(!this->m_glArrayObjectATI)this->m_resolveOrThrow(2458);this->m_glArrayObjectATI(array,size,type,stride,buffer,offset);}
+void m_glGetPointeri_vEXT_lazy(GLenum pname,GLuint index,void** params)const{if(!this->m_glGetPointeri_vEXT)this->m_resolveOrThrow(2459);this->m_glGetPointeri_vEXT(pname,index,params);}
+void m_glGetPerfMonitorCountersAMD_lazy(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters)const{if(!this->m_glGetPerfMonitorCountersAMD)this->m_resolveOrThrow(2460);this->m_glGetPerfMonitorCountersAMD(group,numCounters,maxActiveCounters,counterSize,counters);}
+void m_glNamedBufferStorage_lazy(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{if(!this->m_glNamedBufferStorage)this->m_resolveOrThrow(2461);this->m_glNamedBufferStorage(buffer,size,data,flags);}
+void m_glTexEnvxvOES_lazy(GLenum target,GLenum pname,const GLfixed* params)const{if(!this->m_glTexEnvxvOES)this->m_resolveOrThrow(2462);this->m_glTexEnvxvOES(target,pname,params);}
+void m_glProgramUniform2ui64NV_lazy(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y)const{if(!this->m_glProgramUniform2ui64NV)this->m_resolveOrThrow(2463);this->m_glProgramUniform2ui64NV(program,location,x,y);}
+void m_glMultiTexCoord3bOES_lazy(GLenum texture,GLbyte s,GLbyte t,GLbyte r)const{if(!this->m_glMultiTexCoord3bOES)this->m_resolveOrThrow(2464);this->m_glMultiTexCoord3bOES(texture,s,t,r);}
+void m_glUniform1dv_lazy(GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glUniform1dv)this->m_resolveOrThrow(2465);this->m_glUniform1dv(location,count,value);}
+void m_glPixelTransferi_lazy(GLenum pname,GLint param)const{if(!this->m_glPixelTransferi)this->m_resolveOrThrow(2466);this->m_glPixelTransferi(pname,param);}
+void m_glSecondaryColor3usvEXT_lazy(const GLushort* v)const{if(!this->m_glSecondaryColor3usvEXT)this->m_resolveOrThrow(2467);this->m_glSecondaryColor3usvEXT(v);}
+void m_glProgramEnvParameterI4uivNV_lazy(GLenum target,GLuint index,const GLuint* params)const{if(!this->m_glProgramEnvParameterI4uivNV)this->m_resolveOrThrow(2468);this->m_glProgramEnvParameterI4uivNV(target,index,params);}
+void m_glVertex2sv_lazy(const GLshort* v)const{if(!this->m_glVertex2sv)this->m_resolveOrThrow(2469);this->m_glVertex2sv(v);}
+void m_glWindowPos4dMESA_lazy(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glWindowPos4dMESA)this->m_resolveOrThrow(2470);this->m_glWindowPos4dMESA(x,y,z,w);}
+void m_glDebugMessageControlARB_lazy(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{if(!this->m_glDebugMessageControlARB)this->m_resolveOrThrow(2471);this->m_glDebugMessageControlARB(source,type,severity,count,ids,enabled);}
+GLboolean m_glIsTextureEXT_lazy(GLuint texture)const{if(!this->m_glIsTextureEXT)this->m_resolveOrThrow(2472);return this->m_glIsTextureEXT(texture);}
+void m_glFragmentMaterialivSGIX_lazy(GLenum face,GLenum pname,const GLint* params)const{if(!this->m_glFragmentMaterialivSGIX)this->m_resolveOrThrow(2473);this->m_glFragmentMaterialivSGIX(face,pname,params);}
+void m_glLinkProgramARB_lazy(GLhandleARB programObj)const{if(!this->m_glLinkProgramARB)this->m_resolveOrThrow(2474);this->m_glLinkProgramARB(programObj);}
+void m_glFinishFenceAPPLE_lazy(GLuint fence)const{if(!this->m_glFinishFenceAPPLE)this->m_resolveOrThrow(2475);this->m_glFinishFenceAPPLE(fence);}
+void m_glVertexArrayVertexAttribBindingEXT_lazy(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{if(!this->m_glVertexArrayVertexAttribBindingEXT)this->m_resolveOrThrow(2476);this->m_glVertexArrayVertexAttribBindingEXT(vaobj,attribindex,bindingindex);}
+void m_glTexStorageMem3DMultisampleEXT_lazy(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{if(!this->m_glTexStorageMem3DMultisampleEXT)this->m_resolveOrThrow(2477);this->m_glTexStorageMem3DMultisampleEXT(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+void m_glUniform1ui64vARB_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniform1ui64vARB)this->m_resolveOrThrow(2478);this->m_glUniform1ui64vARB(location,count,value);}
+void m_glMultiTexCoord4fv_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord4fv)this->m_resolveOrThrow(2479);this->m_glMultiTexCoord4fv(target,v);}
+void m_glMulticastFramebufferSampleLocationsfvNV_lazy(GLuint gpu,GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{if(!this->m_glMulticastFramebufferSampleLocationsfvNV)this->m_resolveOrThrow(2480);this->m_glMulticastFramebufferSampleLocationsfvNV(gpu,framebuffer,start,count,v);}
+void m_glRasterPos3d_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glRasterPos3d)this->m_resolveOrThrow(2481);this->m_glRasterPos3d(x,y,z);}
+GLint m_glPollAsyncSGIX_lazy(GLuint* markerp)const{if(!this->m_glPollAsyncSGIX)this->m_resolveOrThrow(2482);return this->m_glPollAsyncSGIX(markerp);}
+void m_glRasterPos3f_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glRasterPos3f)this->m_resolveOrThrow(2483);this->m_glRasterPos3f(x,y,z);}
+void m_glCompressedTexImage3D_lazy(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexImage3D)this->m_resolveOrThrow(2484);this->m_glCompressedTexImage3D(target,level,internalformat,width,height,depth,border,imageSize,data);}
+void m_glVariantivEXT_lazy(GLuint id,const GLint* addr)const{if(!this->m_glVariantivEXT)this->m_resolveOrThrow(2485);this->m_glVariantivEXT(id,addr);}
+void m_glUnmapTexture2DINTEL_lazy(GLuint texture,GLint level)const{if(!this->m_glUnmapTexture2DINTEL)this->m_resolveOrThrow(2486);this->m_glUnmapTexture2DINTEL(texture,level);}
+void m_glMulticastWaitSyncNV_lazy(GLuint signalGpu,GLbitfield waitGpuMask)const{if(!this->m_glMulticastWaitSyncNV)this->m_resolveOrThrow(2487);this->m_glMulticastWaitSyncNV(signalGpu,waitGpuMask);}
+void m_glGetVertexAttribiv_lazy(GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetVertexAttribiv)this->m_resolveOrThrow(2488);this->m_glGetVertexAttribiv(index,pname,params);}
+void m_glGetPathCoordsNV_lazy(GLuint path,GLfloat* coords)const{if(!this->m_glGetPathCoordsNV)this->m_resolveOrThrow(2489);this->m_glGetPathCoordsNV(path,coords);}
+void m_glColor4xvOES_lazy(const GLfixed* components)const{if(!this->m_glColor4xvOES)this->m_resolveOrThrow(2490);this->m_glColor4xvOES(components);}
+void m_glVertexAttrib3fv_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib3fv)this->m_resolveOrThrow(2491);this->m_glVertexAttrib3fv(index,v);}
+void m_glRasterPos3s_lazy(GLshort x,GLshort y,GLshort z)const{if(!this->m_glRasterPos3s)this->m_resolveOrThrow(2492);this->m_glRasterPos3s(x,y,z);}
+void m_glVertex4bOES_lazy(GLbyte x,GLbyte y,GLbyte z,GLbyte w)const{if(!this->m_glVertex4bOES)this->m_resolveOrThrow(2493);this->m_glVertex4bOES(x,y,z,w);}
+void m_glTransformFeedbackVaryingsEXT_lazy(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{if(!this->m_glTransformFeedbackVaryingsEXT)this->m_resolveOrThrow(2494);this->m_glTransformFeedbackVaryingsEXT(program,count,varyings,bufferMode);}
+void m_glCombinerOutputNV_lazy(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum)const{if(!this->m_glCombinerOutputNV)this->m_resolveOrThrow(2495);this->m_glCombinerOutputNV(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);}
+void m_glWindowPos4sMESA_lazy(GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glWindowPos4sMESA)this->m_resolveOrThrow(2496);this->m_glWindowPos4sMESA(x,y,z,w);}
+void m_glVertexAttrib4svARB_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib4svARB)this->m_resolveOrThrow(2497);this->m_glVertexAttrib4svARB(index,v);}
+GLboolean m_glIsList_lazy(GLuint list)const{if(!this->m_glIsList)this->m_resolveOrThrow(2498);return this->m_glIsList(list);}
+void m_glGetInfoLogARB_lazy(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog)const{if(!this->m_glGetInfoLogARB)this->m_resolveOrThrow(2499);this->m_glGetInfoLogARB(obj,maxLength,length,infoLog);}
+void m_glUniformMatrix2fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix2fv)this->m_resolveOrThrow(2500);this->m_glUniformMatrix2fv(location,count,transpose,value);}
+void m_glVertexAttribs3dvNV_lazy(GLuint index,GLsizei count,const GLdouble* v)const{if(!this->m_glVertexAttribs3dvNV)this->m_resolveOrThrow(2501);this->m_glVertexAttribs3dvNV(index,count,v);}
+void m_glGlobalAlphaFactorsSUN_lazy(GLshort factor)const{if(!this->m_glGlobalAlphaFactorsSUN)this->m_resolveOrThrow(2502);this->m_glGlobalAlphaFactorsSUN(factor);}
+void m_glGetTrackMatrixivNV_lazy(GLenum target,GLuint address,GLenum pname,GLint* params)const{if(!this->m_glGetTrackMatrixivNV)this->m_resolveOrThrow(2503);this->m_glGetTrackMatrixivNV(target,address,pname,params);}
+void m_glTextureParameterfvEXT_lazy(GLuint texture,GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glTextureParameterfvEXT)this->m_resolveOrThrow(2504);this->m_glTextureParameterfvEXT(texture,target,pname,params);}
+GLboolean m_glIsNamedBufferResidentNV_lazy(GLuint buffer)const{if(!this->m_glIsNamedBufferResidentNV)this->m_resolveOrThrow(2505);return this->m_glIsNamedBufferResidentNV(buffer);}
+void m_glProgramUniform4ui64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glProgramUniform4ui64vARB)this->m_resolveOrThrow(2506);this->m_glProgramUniform4ui64vARB(program,location,count,value);}
+void m_glTbufferMask3DFX_lazy(GLuint mask)const{if(!this->m_glTbufferMask3DFX)this->m_resolveOrThrow(2507);this->m_glTbufferMask3DFX(mask);}
+void m_glCoverFillPathNV_lazy(GLuint path,GLenum coverMode)const{if(!this->m_glCoverFillPathNV)this->m_resolveOrThrow(2508);this->m_glCoverFillPathNV(path,coverMode);}
+void m_glVertexAttrib1fvARB_lazy(GLuint index,const GLfloat* v)const{if(!this->m_glVertexAttrib1fvARB)this->m_resolveOrThrow(2509);this->m_glVertexAttrib1fvARB(index,v);}
+void m_glGenerateTextureMipmap_lazy(GLuint texture)const{if(!this->m_glGenerateTextureMipmap)this->m_resolveOrThrow(2510);this->m_glGenerateTextureMipmap(texture);}
+void m_glNamedProgramLocalParameterI4uivEXT_lazy(GLuint program,GLenum target,GLuint index,const GLuint* params)const{if(!this->m_glNamedProgramLocalParameterI4uivEXT)this->m_resolveOrThrow(2511);this->m_glNamedProgramLocalParameterI4uivEXT(program,target,index,params);}
+void m_glMultiDrawElementsBaseVertex_lazy(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex)const{if(!this->m_glMultiDrawElementsBaseVertex)this->m_resolveOrThrow(2512);this->m_glMultiDrawElementsBaseVertex(mode,count,type,indices,drawcount,basevertex);}
+void m_glProgramSubroutineParametersuivNV_lazy(GLenum target,GLsizei count,const GLuint* params)const{if(!this->m_glProgramSubroutineParametersuivNV)this->m_resolveOrThrow(2513);this->m_glProgramSubroutineParametersuivNV(target,count,params);}
+void m_glProgramUniformMatrix2x4dvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glProgramUniformMatrix2x4dvEXT)this->m_resolveOrThrow(2514);this->m_glProgramUniformMatrix2x4dvEXT(program,location,count,transpose,value);}
+void m_glRotatexOES_lazy(GLfixed angle,GLfixed x,GLfixed y,GLfixed z)const{if(!this->m_glRotatexOES)this->m_resolveOrThrow(2515);this->m_glRotatexOES(angle,x,y,z);}
+void m_glMemoryBarrierEXT_lazy(GLbitfield barriers)const{if(!this->m_glMemoryBarrierEXT)this->m_resolveOrThrow(2516);this->m_glMemoryBarrierEXT(barriers);}
+void m_glVertexAttrib3svNV_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib3svNV)this->m_resolveOrThrow(2517);this->m_glVertexAttrib3svNV(index,v);}
+void m_glVertexStream3iATI_lazy(GLenum stream,GLint x,GLint y,GLint z)const{if(!this->m_glVertexStream3iATI)this->m_resolveOrThrow(2518);this->m_glVertexStream3iATI(stream,x,y,z);}
+void m_glCompressedTexSubImage1D_lazy(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexSubImage1D)this->m_resolveOrThrow(2519);this->m_glCompressedTexSubImage1D(target,level,xoffset,width,format,imageSize,data);}
+void m_glSetFenceNV_lazy(GLuint fence,GLenum condition)const{if(!this->m_glSetFenceNV)this->m_resolveOrThrow(2520);this->m_glSetFenceNV(fence,condition);}
+void m_glAttachObjectARB_lazy(GLhandleARB containerObj,GLhandleARB obj)const{if(!this->m_glAttachObjectARB)this->m_resolveOrThrow(2521);this->m_glAttachObjectARB(containerObj,obj);}
+void m_glCopyConvolutionFilter1D_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyConvolutionFilter1D)this->m_resolveOrThrow(2522);this->m_glCopyConvolutionFilter1D(target,internalformat,x,y,width);}
+void m_glTexStorageMem2DMultisampleEXT_lazy(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{if(!this->m_glTexStorageMem2DMultisampleEXT)this->m_resolveOrThrow(2523);this->m_glTexStorageMem2DMultisampleEXT(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+void m_glProgramParameters4fvNV_lazy(GLenum target,GLuint index,GLsizei count,const GLfloat* v)const{if(!this->m_glProgramParameters4fvNV)this->m_resolveOrThrow(2524);this->m_glProgramParameters4fvNV(target,index,count,v);}
+void m_glNamedFramebufferParameteriEXT_lazy(GLuint framebuffer,GLenum pname,GLint param)const{if(!this->m_glNamedFramebufferParameteriEXT)this->m_resolveOrThrow(2525);this->m_glNamedFramebufferParameteriEXT(framebuffer,pname,param);}
+void m_glVertexAttrib4Nsv_lazy(GLuint index,const GLshort* v)const{if(!this->m_glVertexAttrib4Nsv)this->m_resolveOrThrow(2526);this->m_glVertexAttrib4Nsv(index,v);}
+void m_glVertexAttribI4usvEXT_lazy(GLuint index,const GLushort* v)const{if(!this->m_glVertexAttribI4usvEXT)this->m_resolveOrThrow(2527);this->m_glVertexAttribI4usvEXT(index,v);}
+void m_glTextureBufferRangeEXT_lazy(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glTextureBufferRangeEXT)this->m_resolveOrThrow(2528);this->m_glTextureBufferRangeEXT(texture,target,internalformat,buffer,offset,size);}
+void m_glVertexP3uiv_lazy(GLenum type,const GLuint* value)const{if(!this->m_glVertexP3uiv)this->m_resolveOrThrow(2529);this->m_glVertexP3uiv(type,value);}
+GLboolean m_glIsPathNV_lazy(GLuint path)const{if(!this->m_glIsPathNV)this->m_resolveOrThrow(2530);return this->m_glIsPathNV(path);}
+void m_glGetnUniformi64vARB_lazy(GLuint program,GLint location,GLsizei bufSize,GLint64* params)const{if(!this->m_glGetnUniformi64vARB)this->m_resolveOrThrow(2531);this->m_glGetnUniformi64vARB(program,location,bufSize,params);}
+void m_glFramebufferTextureMultiviewOVR_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews)const{if(!this->m_glFramebufferTextureMultiviewOVR)this->m_resolveOrThrow(2532);this->m_glFramebufferTextureMultiviewOVR(target,attachment,texture,level,baseViewIndex,numViews);}
+void m_glCompressedMultiTexSubImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedMultiTexSubImage2DEXT)this->m_resolveOrThrow(2533);this->m_glCompressedMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+void m_glGetnMapdv_lazy(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{if(!this->m_glGetnMapdv)this->m_resolveOrThrow(2534);this->m_glGetnMapdv(target,query,bufSize,v);}
+void m_glDebugMessageCallback_lazy(GLDEBUGPROC callback,const void* userParam)const{if(!this->m_glDebugMessageCallback)this->m_resolveOrThrow(2535);this->m_glDebugMessageCallback(callback,userParam);}
+void m_glTangent3svEXT_lazy(const GLshort* v)const{if(!this->m_glTangent3svEXT)this->m_resolveOrThrow(2536);this->m_glTangent3svEXT(v);}
+void m_glVertexAttribParameteriAMD_lazy(GLuint index,GLenum pname,GLint param)const{if(!this->m_glVertexAttribParameteriAMD)this->m_resolveOrThrow(2537);this->m_glVertexAttribParameteriAMD(index,pname,param);}
+void m_glBufferSubDataARB_lazy(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data)const{if(!this->m_glBufferSubDataARB)this->m_resolveOrThrow(2538);this->m_glBufferSubDataARB(target,offset,size,data);}
+void m_glGetVertexAttribLui64vARB_lazy(GLuint index,GLenum pname,GLuint64EXT* params)const{if(!this->m_glGetVertexAttribLui64vARB)this->m_resolveOrThrow(2539);this->m_glGetVertexAttribLui64vARB(index,pname,params);}
+void m_glVertexAttribL4ui64NV_lazy(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{if(!this->m_glVertexAttribL4ui64NV)this->m_resolveOrThrow(2540);this->m_glVertexAttribL4ui64NV(index,x,y,z,w);}
+void m_glReplacementCodeuiColor4ubVertex3fSUN_lazy(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiColor4ubVertex3fSUN)this->m_resolveOrThrow(2541);this->m_glReplacementCodeuiColor4ubVertex3fSUN(rc,r,g,b,a,x,y,z);}
+void m_glImageTransformParameterfHP_lazy(GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glImageTransformParameterfHP)this->m_resolveOrThrow(2542);this->m_glImageTransformParameterfHP(target,pname,param);}
+void m_glMap1f_lazy(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{if(!this->m_glMap1f)this->m_resolveOrThrow(2543);this->m_glMap1f(target,u1,u2,stride,order,points);}
+void m_glRasterPos4fv_lazy(const GLfloat* v)const{if(!this->m_glRasterPos4fv)this->m_resolveOrThrow(2544);this->m_glRasterPos4fv(v);}
+void m_glVertex2bvOES_lazy(const GLbyte* coords)const{if(!this->m_glVertex2bvOES)this->m_resolveOrThrow(2545);this->m_glVertex2bvOES(coords);}
+void m_glGetMapControlPointsNV_lazy(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points)const{if(!this->m_glGetMapControlPointsNV)this->m_resolveOrThrow(2546);this->m_glGetMapControlPointsNV(target,index,type,ustride,vstride,packed,points);}
+void m_glNamedProgramLocalParametersI4ivEXT_lazy(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params)const{if(!this->m_glNamedProgramLocalParametersI4ivEXT)this->m_resolveOrThrow(2547);this->m_glNamedProgramLocalParametersI4ivEXT(program,target,index,count,params);}
+void m_glBindBufferRangeNV_lazy(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{if(!this->m_glBindBufferRangeNV)this->m_resolveOrThrow(2548);this->m_glBindBufferRangeNV(target,index,buffer,offset,size);}
+void m_glVertexStream3dvATI_lazy(GLenum stream,const GLdouble* coords)const{if(!this->m_glVertexStream3dvATI)this->m_resolveOrThrow(2549);this->m_glVertexStream3dvATI(stream,coords);}
+void m_glNormalPointerListIBM_lazy(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{if(!this->m_glNormalPointerListIBM)this->m_resolveOrThrow(2550);this->m_glNormalPointerListIBM(type,stride,pointer,ptrstride);}
+void m_glFogFuncSGIS_lazy(GLsizei n,const GLfloat* points)const{if(!this->m_glFogFuncSGIS)this->m_resolveOrThrow(2551);this->m_glFogFuncSGIS(n,points);}
+void m_glMultiModeDrawArraysIBM_lazy(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride)const{if(!this->m_glMultiModeDrawArraysIBM)this->m_resolveOrThrow(2552);this->m_glMultiModeDrawArraysIBM(mode,first,count,primcount,modestride);}
+void m_glGetNamedFramebufferAttachmentParameterivEXT_lazy(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{if(!this->m_glGetNamedFramebufferAttachmentParameterivEXT)this->m_resolveOrThrow(2553);this->m_glGetNamedFramebufferAttachmentParameterivEXT(framebuffer,attachment,pname,params);}
+void m_glGetFloatv_lazy(GLenum pname,GLfloat* params)const{if(!this->m_glGetFloatv)this->m_resolveOrThrow(2554);this->m_glGetFloatv(pname,params);}
+void m_glVertexArrayVertexAttribIFormatEXT_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{if(!this->m_glVertexArrayVertexAttribIFormatEXT)this->m_resolveOrThrow(2555);this->m_glVertexArrayVertexAttribIFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+void m_glHint_lazy(GLenum target,GLenum mode)const{if(!this->m_glHint)this->m_resolveOrThrow(2556);this->m_glHint(target,mode);}
+void m_glVertexStream2svATI_lazy(GLenum stream,const GLshort* coords)const{if(!this->m_glVertexStream2svATI)this->m_resolveOrThrow(2557);this->m_glVertexStream2svATI(stream,coords);}
+void m_glMultiDrawArraysIndirect_lazy(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride)const{if(!this->m_glMultiDrawArraysIndirect)this->m_resolveOrThrow(2558);this->m_glMultiDrawArraysIndirect(mode,indirect,drawcount,stride);}
+void m_glMultiTexEnvfvEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glMultiTexEnvfvEXT)this->m_resolveOrThrow(2559);this->m_glMultiTexEnvfvEXT(texunit,target,pname,params);}
+void m_glVertexAttribP2uiv_lazy(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{if(!this->m_glVertexAttribP2uiv)this->m_resolveOrThrow(2560);this->m_glVertexAttribP2uiv(index,type,normalized,value);}
+void m_glProgramUniform1i64vARB_lazy(GLuint program,GLint location,GLsizei count,const GLint64* value)const{if(!this->m_glProgramUniform1i64vARB)this->m_resolveOrThrow(2561);this->m_glProgramUniform1i64vARB(program,location,count,value);}
+void m_glFramebufferTextureARB_lazy(GLenum target,GLenum attachment,GLuint texture,GLint level)const{if(!this->m_glFramebufferTextureARB)this->m_resolveOrThrow(2562);this->m_glFramebufferTextureARB(target,attachment,texture,level);}
+void m_glPushClientAttribDefaultEXT_lazy(GLbitfield mask)const{if(!this->m_glPushClientAttribDefaultEXT)this->m_resolveOrThrow(2563);this->m_glPushClientAttribDefaultEXT(mask);}
+void m_glScalef_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glScalef)this->m_resolveOrThrow(2564);this->m_glScalef(x,y,z);}
+void m_glScaled_lazy(GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glScaled)this->m_resolveOrThrow(2565);this->m_glScaled(x,y,z);}
+void m_glGetConvolutionParameterxvOES_lazy(GLenum target,GLenum pname,GLfixed* params)const{if(!this->m_glGetConvolutionParameterxvOES)this->m_resolveOrThrow(2566);this->m_glGetConvolutionParameterxvOES(target,pname,params);}
+void m_glGetProgramResourceName_lazy(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name)const{if(!this->m_glGetProgramResourceName)this->m_resolveOrThrow(2567);this->m_glGetProgramResourceName(program,programInterface,index,bufSize,length,name);}
+void m_glCopyColorTable_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyColorTable)this->m_resolveOrThrow(2568);this->m_glCopyColorTable(target,internalformat,x,y,width);}
+void m_glDepthRangeArrayv_lazy(GLuint first,GLsizei count,const GLdouble* v)const{if(!this->m_glDepthRangeArrayv)this->m_resolveOrThrow(2569);this->m_glDepthRangeArrayv(first,count,v);}
+void m_glCoverFillPathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glCoverFillPathInstancedNV)this->m_resolveOrThrow(2570);this->m_glCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+void m_glMultiTexParameterivEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glMultiTexParameterivEXT)this->m_resolveOrThrow(2571);this->m_glMultiTexParameterivEXT(texunit,target,pname,params);}
+void m_glGetActiveAtomicCounterBufferiv_lazy(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params)const{if(!this->m_glGetActiveAtomicCounterBufferiv)this->m_resolveOrThrow(2572);this->m_glGetActiveAtomicCounterBufferiv(program,bufferIndex,pname,params);}
+void m_glStencilOpSeparate_lazy(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{if(!this->m_glStencilOpSeparate)this->m_resolveOrThrow(2573);this->m_glStencilOpSeparate(face,sfail,dpfail,dppass);}
+void m_glVertexAttrib4fNV_lazy(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glVertexAttrib4fNV)this->m_resolveOrThrow(2574);this->m_glVertexAttrib4fNV(index,x,y,z,w);}
+void m_glGetColorTableParameterivSGI_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetColorTableParameterivSGI)this->m_resolveOrThrow(2575);this->m_glGetColorTableParameterivSGI(target,pname,params);}
+void m_glVertexArrayAttribBinding_lazy(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{if(!this->m_glVertexArrayAttribBinding)this->m_resolveOrThrow(2576);this->m_glVertexArrayAttribBinding(vaobj,attribindex,bindingindex);}
+GLboolean m_glIsSemaphoreEXT_lazy(GLuint semaphore)const{if(!this->m_glIsSemaphoreEXT)this->m_resolveOrThrow(2577);return this->m_glIsSemaphoreEXT(semaphore);}
+void m_glProgramParameters4dvNV_lazy(GLenum target,GLuint index,GLsizei count,const GLdouble* v)const{if(!this->m_glProgramParameters4dvNV)this->m_resolveOrThrow(2578);this->m_glProgramParameters4dvNV(target,index,count,v);}
+void m_glVertexAttribL4dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttribL4dv)this->m_resolveOrThrow(2579);this->m_glVertexAttribL4dv(index,v);}
+void m_glGetTexParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTexParameteriv)this->m_resolveOrThrow(2580);this->m_glGetTexParameteriv(target,pname,params);}
+GLintptr m_glGetUniformOffsetEXT_lazy(GLuint program,GLint location)const{if(!this->m_glGetUniformOffsetEXT)this->m_resolveOrThrow(2581);return this->m_glGetUniformOffsetEXT(program,location);}
+void m_glGetVertexAttribPointerv_lazy(GLuint index,GLenum pname,void** pointer)const{if(!this->m_glGetVertexAttribPointerv)this->m_resolveOrThrow(2582);this->m_glGetVertexAttribPointerv(index,pname,pointer);}
+void m_glResumeTransformFeedbackNV_lazy()const{if(!this->m_glResumeTransformFeedbackNV)this->m_resolveOrThrow(2583);this->m_glResumeTransformFeedbackNV();}
+void m_glProgramUniform3i64vNV_lazy(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{if(!this->m_glProgramUniform3i64vNV)this->m_resolveOrThrow(2584);this->m_glProgramUniform3i64vNV(program,location,count,value);}
+void m_glTangent3fEXT_lazy(GLfloat tx,GLfloat ty,GLfloat tz)const{if(!this->m_glTangent3fEXT)this->m_resolveOrThrow(2585);this->m_glTangent3fEXT(tx,ty,tz);}
+void m_glGetPathMetricRangeNV_lazy(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics)const{if(!this->m_glGetPathMetricRangeNV)this->m_resolveOrThrow(2586);this->m_glGetPathMetricRangeNV(metricQueryMask,firstPathName,numPaths,stride,metrics);}
+void m_glWindowPos2iMESA_lazy(GLint x,GLint y)const{if(!this->m_glWindowPos2iMESA)this->m_resolveOrThrow(2587);this->m_glWindowPos2iMESA(x,y);}
+void m_glVertex2xvOES_lazy(const GLfixed* coords)const{if(!this->m_glVertex2xvOES)this->m_resolveOrThrow(2588);this->m_glVertex2xvOES(coords);}
+void m_glGetnCompressedTexImage_lazy(GLenum target,GLint lod,GLsizei bufSize,void* pixels)const{if(!this->m_glGetnCompressedTexImage)this->m_resolveOrThrow(2589);this->m_glGetnCompressedTexImage(target,lod,bufSize,pixels);}
+void m_glWindowPos2dv_lazy(const GLdouble* v)const{if(!this->m_glWindowPos2dv)this->m_resolveOrThrow(2590);this->m_glWindowPos2dv(v);}
+void m_glReplacementCodeuiVertex3fSUN_lazy(GLuint rc,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glReplacementCodeuiVertex3fSUN)this->m_resolveOrThrow(2591);this->m_glReplacementCodeuiVertex3fSUN(rc,x,y,z);}
+void m_glGetTransformFeedbackVaryingEXT_lazy(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{if(!this->m_glGetTransformFeedbackVaryingEXT)this->m_resolveOrThrow(2592);this->m_glGetTransformFeedbackVaryingEXT(program,index,bufSize,length,size,type,name);}
+void m_glWindowPos3fARB_lazy(GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glWindowPos3fARB)this->m_resolveOrThrow(2593);this->m_glWindowPos3fARB(x,y,z);}
+void* m_glMapNamedBufferEXT_lazy(GLuint buffer,GLenum access)const{if(!this->m_glMapNamedBufferEXT)this->m_resolveOrThrow(2594);return this->m_glMapNamedBufferEXT(buffer,access);}
+void m_glDisable_lazy(GLenum cap)const{if(!this->m_glDisable)this->m_resolveOrThrow(2595);this->m_glDisable(cap);}
+GLboolean m_glIsPointInFillPathNV_lazy(GLuint path,GLuint mask,GLfloat x,GLfloat y)const{if(!this->m_glIsPointInFillPathNV)this->m_resolveOrThrow(2596);return this->m_glIsPointInFillPathNV(path,mask,x,y);}
+void m_glVertexAttribI2uiEXT_lazy(GLuint index,GLuint x,GLuint y)const{if(!this->m_glVertexAttribI2uiEXT)this->m_resolveOrThrow(2597);this->m_glVertexAttribI2uiEXT(index,x,y);}
+void m_glProgramUniform4uiv_lazy(GLuint program,GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glProgramUniform4uiv)this->m_resolveOrThrow(2598);this->m_glProgramUniform4uiv(program,location,count,value);}
+void m_glQueryCounter_lazy(GLuint id,GLenum target)const{if(!this->m_glQueryCounter)this->m_resolveOrThrow(2599);this->m_glQueryCounter(id,target);}
+void m_glFramebufferRenderbufferEXT_lazy(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{if(!this->m_glFramebufferRenderbufferEXT)this->m_resolveOrThrow(2600);this->m_glFramebufferRenderbufferEXT(target,attachment,renderbuffertarget,renderbuffer);}
+void m_glBinormal3svEXT_lazy(const GLshort* v)const{if(!this->m_glBinormal3svEXT)this->m_resolveOrThrow(2601);this->m_glBinormal3svEXT(v);}
+void m_glBindBufferOffsetNV_lazy(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{if(!this->m_glBindBufferOffsetNV)this->m_resolveOrThrow(2602);this->m_glBindBufferOffsetNV(target,index,buffer,offset);}
+void m_glCopyTextureSubImage2D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTextureSubImage2D)this->m_resolveOrThrow(2603);this->m_glCopyTextureSubImage2D(texture,level,xoffset,yoffset,x,y,width,height);}
+void m_glGetProgramResourcefvNV_lazy(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params)const{if(!this->m_glGetProgramResourcefvNV)this->m_resolveOrThrow(2604);this->m_glGetProgramResourcefvNV(program,programInterface,index,propCount,props,bufSize,length,params);}
+void m_glBinormalPointerEXT_lazy(GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glBinormalPointerEXT)this->m_resolveOrThrow(2605);this->m_glBinormalPointerEXT(type,stride,pointer);}
+void m_glGetLightfv_lazy(GLenum light,GLenum pname,GLfloat* params)const{if(!this->m_glGetLightfv)this->m_resolveOrThrow(2606);this->m_glGetLightfv(light,pname,params);}
+void m_glMulticastCopyImageSubDataNV_lazy(GLuint srcGpu,GLbitfield dstGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{if(!this->m_glMulticastCopyImageSubDataNV)this->m_resolveOrThrow(2607);this->m_glMulticastCopyImageSubDataNV(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+void m_glVertex2bOES_lazy(GLbyte x,GLbyte y)const{if(!this->m_glVertex2bOES)this->m_resolveOrThrow(2608);this->m_glVertex2bOES(x,y);}
+void m_glUniform2ivARB_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform2ivARB)this->m_resolveOrThrow(2609);this->m_glUniform2ivARB(location,count,value);}
+void m_glMultiTexCoord3s_lazy(GLenum target,GLshort s,GLshort t,GLshort r)const{if(!this->m_glMultiTexCoord3s)this->m_resolveOrThrow(2610);this->m_glMultiTexCoord3s(target,s,t,r);}
+void m_glGetHistogramParameterfvEXT_lazy(GLenum target,GLenum pname,GLfloat* params)const{if(!this->m_glGetHistogramParameterfvEXT)this->m_resolveOrThrow(2611);this->m_glGetHistogramParameterfvEXT(target,pname,params);}
+void m_glGetProgramStringNV_lazy(GLuint id,GLenum pname,GLubyte* program)const{if(!this->m_glGetProgramStringNV)this->m_resolveOrThrow(2612);this->m_glGetProgramStringNV(id,pname,program);}
+void m_glGetTexGenxvOES_lazy(GLenum coord,GLenum pname,GLfixed* params)const{if(!this->m_glGetTexGenxvOES)this->m_resolveOrThrow(2613);this->m_glGetTexGenxvOES(coord,pname,params);}
+void m_glTextureSubImage2D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureSubImage2D)this->m_resolveOrThrow(2614);this->m_glTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,type,pixels);}
+GLenum m_glObjectPurgeableAPPLE_lazy(GLenum objectType,GLuint name,GLenum option)const{if(!this->m_glObjectPurgeableAPPLE)this->m_resolveOrThrow(2615);return this->m_glObjectPurgeableAPPLE(objectType,name,option);}
+void m_glColorTableSGI_lazy(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table)const{if(!this->m_glColorTableSGI)this->m_resolveOrThrow(2616);this->m_glColorTableSGI(target,internalformat,width,format,type,table);}
+void m_glCopyConvolutionFilter2DEXT_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyConvolutionFilter2DEXT)this->m_resolveOrThrow(2617);this->m_glCopyConvolutionFilter2DEXT(target,internalformat,x,y,width,height);}
+void m_glMultiTexCoord3f_lazy(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{if(!this->m_glMultiTexCoord3f)this->m_resolveOrThrow(2618);this->m_glMultiTexCoord3f(target,s,t,r);}
+void m_glMultiTexCoord3d_lazy(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{if(!this->m_glMultiTexCoord3d)this->m_resolveOrThrow(2619);this->m_glMultiTexCoord3d(target,s,t,r);}
+void m_glFogCoorddv_lazy(const GLdouble* coord)const{if(!this->m_glFogCoorddv)this->m_resolveOrThrow(2620);this->m_glFogCoorddv(coord);}
+void m_glGetBufferPointerv_lazy(GLenum target,GLenum pname,void** params)const{if(!this->m_glGetBufferPointerv)this->m_resolveOrThrow(2621);this->m_glGetBufferPointerv(target,pname,params);}
+void m_glProgramUniform1fEXT_lazy(GLuint program,GLint location,GLfloat v0)const{if(!this->m_glProgramUniform1fEXT)this->m_resolveOrThrow(2622);this->m_glProgramUniform1fEXT(program,location,v0);}
+void m_glWindowPos2fvMESA_lazy(const GLfloat* v)const{if(!this->m_glWindowPos2fvMESA)this->m_resolveOrThrow(2623);this->m_glWindowPos2fvMESA(v);}
+void m_glAlphaToCoverageDitherControlNV_lazy(GLenum mode)const{if(!this->m_glAlphaToCoverageDitherControlNV)this->m_resolveOrThrow(2624);this->m_glAlphaToCoverageDitherControlNV(mode);}
+void m_glPolygonOffsetxOES_lazy(GLfixed factor,GLfixed units)const{if(!this->m_glPolygonOffsetxOES)this->m_resolveOrThrow(2625);this->m_glPolygonOffsetxOES(factor,units);}
+void m_glVertexAttrib4dARB_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertexAttrib4dARB)this->m_resolveOrThrow(2626);this->m_glVertexAttrib4dARB(index,x,y,z,w);}
+void m_glUniformHandleui64vARB_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniformHandleui64vARB)this->m_resolveOrThrow(2627);this->m_glUniformHandleui64vARB(location,count,value);}
+void m_glFragmentLightModelfvSGIX_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glFragmentLightModelfvSGIX)this->m_resolveOrThrow(2628);this->m_glFragmentLightModelfvSGIX(pname,params);}
+void m_glSwizzleEXT_lazy(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{if(!this->m_glSwizzleEXT)this->m_resolveOrThrow(2629);this->m_glSwizzleEXT(res,in,outX,outY,outZ,outW);}
+void m_glBindFragmentShaderATI_lazy(GLuint id)const{if(!this->m_glBindFragmentShaderATI)this->m_resolveOrThrow(2630);this->m_glBindFragmentShaderATI(id);}
+void m_glVertexAttribs3hvNV_lazy(GLuint index,GLsizei n,const GLhalfNV* v)const{if(!this->m_glVertexAttribs3hvNV)this->m_resolveOrThrow(2631);this->m_glVertexAttribs3hvNV(index,n,v);}
+void m_glGenBuffersARB_lazy(GLsizei n,GLuint* buffers)const{if(!this->m_glGenBuffersARB)this->m_resolveOrThrow(2632);this->m_glGenBuffersARB(n,buffers);}
+void m_glTextureStorageMem2DMultisampleEXT_lazy(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{if(!this->m_glTextureStorageMem2DMultisampleEXT)this->m_resolveOrThrow(2633);this->m_glTextureStorageMem2DMultisampleEXT(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+void m_glListParameterfvSGIX_lazy(GLuint list,GLenum pname,const GLfloat* params)const{if(!this->m_glListParameterfvSGIX)this->m_resolveOrThrow(2634);this->m_glListParameterfvSGIX(list,pname,params);}
+void m_glNamedRenderbufferStorageMultisample_lazy(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glNamedRenderbufferStorageMultisample)this->m_resolveOrThrow(2635);this->m_glNamedRenderbufferStorageMultisample(renderbuffer,samples,internalformat,width,height);}
+void m_glVertexAttribI1iEXT_lazy(GLuint index,GLint x)const{if(!this->m_glVertexAttribI1iEXT)this->m_resolveOrThrow(2636);this->m_glVertexAttribI1iEXT(index,x);}
+void m_glMultiTexCoord2ivARB_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord2ivARB)this->m_resolveOrThrow(2637);this->m_glMultiTexCoord2ivARB(target,v);}
+void m_glLightModelxOES_lazy(GLenum pname,GLfixed param)const{if(!this->m_glLightModelxOES)this->m_resolveOrThrow(2638);this->m_glLightModelxOES(pname,param);}
+void m_glColor3xOES_lazy(GLfixed red,GLfixed green,GLfixed blue)const{if(!this->m_glColor3xOES)this->m_resolveOrThrow(2639);this->m_glColor3xOES(red,green,blue);}
+void m_glReadBuffer_lazy(GLenum mode)const{if(!this->m_glReadBuffer)this->m_resolveOrThrow(2640);this->m_glReadBuffer(mode);}
+void m_glStencilFillPathInstancedNV_lazy(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{if(!this->m_glStencilFillPathInstancedNV)this->m_resolveOrThrow(2641);this->m_glStencilFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);}
+void m_glVDPAUUnmapSurfacesNV_lazy(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces)const{if(!this->m_glVDPAUUnmapSurfacesNV)this->m_resolveOrThrow(2642);this->m_glVDPAUUnmapSurfacesNV(numSurface,surfaces);}
+void m_glProgramUniform4i64NV_lazy(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{if(!this->m_glProgramUniform4i64NV)this->m_resolveOrThrow(2643);this->m_glProgramUniform4i64NV(program,location,x,y,z,w);}
+void m_glVertexStream4dvATI_lazy(GLenum stream,const GLdouble* coords)const{if(!this->m_glVertexStream4dvATI)this->m_resolveOrThrow(2644);this->m_glVertexStream4dvATI(stream,coords);}
+GLboolean m_glIsQuery_lazy(GLuint id)const{if(!this->m_glIsQuery)this->m_resolveOrThrow(2645);return this->m_glIsQuery(id);}
+void m_glProgramUniformMatrix4fvEXT_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4fvEXT)this->m_resolveOrThrow(2646);this->m_glProgramUniformMatrix4fvEXT(program,location,count,transpose,value);}
+void m_glVertexAttrib3hNV_lazy(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z)const{if(!this->m_glVertexAttrib3hNV)this->m_resolveOrThrow(2647);this->m_glVertexAttrib3hNV(index,x,y,z);}
+void m_glFlushMappedNamedBufferRange_lazy(GLuint buffer,GLintptr offset,GLsizeiptr length)const{if(!this->m_glFlushMappedNamedBufferRange)this->m_resolveOrThrow(2648);this->m_glFlushMappedNamedBufferRange(buffer,offset,length);}
+void m_glPushName_lazy(GLuint name)const{if(!this->m_glPushName)this->m_resolveOrThrow(2649);this->m_glPushName(name);}
+void m_glGetClipPlane_lazy(GLenum plane,GLdouble* equation)const{if(!this->m_glGetClipPlane)this->m_resolveOrThrow(2650);this->m_glGetClipPlane(plane,equation);}
+void m_glVertex4dv_lazy(const GLdouble* v)const{if(!this->m_glVertex4dv)this->m_resolveOrThrow(2651);this->m_glVertex4dv(v);}
+void m_glVertexAttrib3d_lazy(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{if(!this->m_glVertexAttrib3d)this->m_resolveOrThrow(2652);this->m_glVertexAttrib3d(index,x,y,z);}
+void m_glBlendColor_lazy(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{if(!this->m_glBlendColor)this->m_resolveOrThrow(2653);this->m_glBlendColor(red,green,blue,alpha);}
+void m_glBindTransformFeedbackNV_lazy(GLenum target,GLuint id)const{if(!this->m_glBindTransformFeedbackNV)this->m_resolveOrThrow(2654);this->m_glBindTransformFeedbackNV(target,id);}
+void m_glSamplerParameterIuiv_lazy(GLuint sampler,GLenum pname,const GLuint* param)const{if(!this->m_glSamplerParameterIuiv)this->m_resolveOrThrow(2655);this->m_glSamplerParameterIuiv(sampler,pname,param);}
+void m_glIndexubv_lazy(const GLubyte* c)const{if(!this->m_glIndexubv)this->m_resolveOrThrow(2656);this->m_glIndexubv(c);}
+void m_glNamedBufferPageCommitmentEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{if(!this->m_glNamedBufferPageCommitmentEXT)this->m_resolveOrThrow(2657);this->m_glNamedBufferPageCommitmentEXT(buffer,offset,size,commit);}
+GLenum m_glCheckNamedFramebufferStatus_lazy(GLuint framebuffer,GLenum target)const{if(!this->m_glCheckNamedFramebufferStatus)this->m_resolveOrThrow(2658);return this->m_glCheckNamedFramebufferStatus(framebuffer,target);}
+void m_glGetObjectBufferfvATI_lazy(GLuint buffer,GLenum pname,GLfloat* params)const{if(!this->m_glGetObjectBufferfvATI)this->m_resolveOrThrow(2659);this->m_glGetObjectBufferfvATI(buffer,pname,params);}
+void m_glRasterPos4d_lazy(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glRasterPos4d)this->m_resolveOrThrow(2660);this->m_glRasterPos4d(x,y,z,w);}
+void m_glRasterPos4f_lazy(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glRasterPos4f)this->m_resolveOrThrow(2661);this->m_glRasterPos4f(x,y,z,w);}
+void m_glGetPerfMonitorCounterStringAMD_lazy(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString)const{if(!this->m_glGetPerfMonitorCounterStringAMD)this->m_resolveOrThrow(2662);this->m_glGetPerfMonitorCounterStringAMD(group,counter,bufSize,length,counterString);}
+void m_glVertexAttrib3s_lazy(GLuint index,GLshort x,GLshort y,GLshort z)const{if(!this->m_glVertexAttrib3s)this->m_resolveOrThrow(2663);this->m_glVertexAttrib3s(index,x,y,z);}
+void m_glDrawElementsInstancedEXT_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{if(!this->m_glDrawElementsInstancedEXT)this->m_resolveOrThrow(2664);this->m_glDrawElementsInstancedEXT(mode,count,type,indices,primcount);}
+void m_glNamedProgramLocalParameterI4iEXT_lazy(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{if(!this->m_glNamedProgramLocalParameterI4iEXT)this->m_resolveOrThrow(2665);this->m_glNamedProgramLocalParameterI4iEXT(program,target,index,x,y,z,w);}
+void m_glRasterPos4s_lazy(GLshort x,GLshort y,GLshort z,GLshort w)const{if(!this->m_glRasterPos4s)this->m_resolveOrThrow(2666);this->m_glRasterPos4s(x,y,z,w);}
+void m_glGetProgramStageiv_lazy(GLuint program,GLenum shadertype,GLenum pname,GLint* values)const{if(!this->m_glGetProgramStageiv)this->m_resolveOrThrow(2667);this->m_glGetProgramStageiv(program,shadertype,pname,values);}
+void m_glGetMaterialxOES_lazy(GLenum face,GLenum pname,GLfixed param)const{if(!this->m_glGetMaterialxOES)this->m_resolveOrThrow(2668);this->m_glGetMaterialxOES(face,pname,param);}
+void m_glPopMatrix_lazy()const{if(!this->m_glPopMatrix)this->m_resolveOrThrow(2669);this->m_glPopMatrix();}
+void m_glGetVideoui64vNV_lazy(GLuint video_slot,GLenum pname,GLuint64EXT* params)const{if(!this->m_glGetVideoui64vNV)this->m_resolveOrThrow(2670);this->m_glGetVideoui64vNV(video_slot,pname,params);}
+void m_glTangent3bEXT_lazy(GLbyte tx,GLbyte ty,GLbyte tz)const{if(!this->m_glTangent3bEXT)this->m_resolveOrThrow(2671);this->m_glTangent3bEXT(tx,ty,tz);}
+GLenum m_glGetGraphicsResetStatusARB_lazy()const{if(!this->m_glGetGraphicsResetStatusARB)this->m_resolveOrThrow(2672);return this->m_glGetGraphicsResetStatusARB();}
+void m_glUniform4i_lazy(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{if(!this->m_glUniform4i)this->m_resolveOrThrow(2673);this->m_glUniform4i(location,v0,v1,v2,v3);}
+void m_glActiveTexture_lazy(GLenum texture)const{if(!this->m_glActiveTexture)this->m_resolveOrThrow(2674);this->m_glActiveTexture(texture);}
+void m_glEnableVertexAttribArray_lazy(GLuint index)const{if(!this->m_glEnableVertexAttribArray)this->m_resolveOrThrow(2675);this->m_glEnableVertexAttribArray(index);}
+void m_glTexCoord4fVertex4fvSUN_lazy(const GLfloat* tc,const GLfloat* v)const{if(!this->m_glTexCoord4fVertex4fvSUN)this->m_resolveOrThrow(2676);this->m_glTexCoord4fVertex4fvSUN(tc,v);}
+void m_glUniform4d_lazy(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glUniform4d)this->m_resolveOrThrow(2677);this->m_glUniform4d(location,x,y,z,w);}
+void m_glUniform4f_lazy(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{if(!this->m_glUniform4f)this->m_resolveOrThrow(2678);this->m_glUniform4f(location,v0,v1,v2,v3);}
+void m_glRenderbufferStorageMultisample_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glRenderbufferStorageMultisample)this->m_resolveOrThrow(2679);this->m_glRenderbufferStorageMultisample(target,samples,internalformat,width,height);}
+void m_glCreateProgramPipelines_lazy(GLsizei n,GLuint* pipelines)const{if(!this->m_glCreateProgramPipelines)this->m_resolveOrThrow(2680);this->m_glCreateProgramPipelines(n,pipelines);}
+void m_glVertexAttribLPointer_lazy(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribLPointer)this->m_resolveOrThrow(2681);this->m_glVertexAttribLPointer(index,size,type,stride,pointer);}
+void m_glUniform2uiEXT_lazy(GLint location,GLuint v0,GLuint v1)const{if(!this->m_glUniform2uiEXT)this->m_resolveOrThrow(2682);this->m_glUniform2uiEXT(location,v0,v1);}
+void m_glMultiTexCoord3sv_lazy(GLenum target,const GLshort* v)const{if(!this->m_glMultiTexCoord3sv)this->m_resolveOrThrow(2683);this->m_glMultiTexCoord3sv(target,v);}
+void m_glDrawElementsInstancedBaseVertex_lazy(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex)const{if(!this->m_glDrawElementsInstancedBaseVertex)this->m_resolveOrThrow(2684);this->m_glDrawElementsInstancedBaseVertex(mode,count,type,indices,instancecount,basevertex);}
+void m_glPixelTransformParameterfvEXT_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glPixelTransformParameterfvEXT)this->m_resolveOrThrow(2685);this->m_glPixelTransformParameterfvEXT(target,pname,params);}
+void m_glDrawTransformFeedbackNV_lazy(GLenum mode,GLuint id)const{if(!this->m_glDrawTransformFeedbackNV)this->m_resolveOrThrow(2686);this->m_glDrawTransformFeedbackNV(mode,id);}
+void m_glTextureImage2DMultisampleCoverageNV_lazy(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{if(!this->m_glTextureImage2DMultisampleCoverageNV)this->m_resolveOrThrow(2687);this->m_glTextureImage2DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_lazy(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{if(!this->m_glNamedRenderbufferStorageMultisampleCoverageEXT)this->m_resolveOrThrow(2688);this->m_glNamedRenderbufferStorageMultisampleCoverageEXT(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);}
+GLboolean m_glIsTexture_lazy(GLuint texture)const{if(!this->m_glIsTexture)this->m_resolveOrThrow(2689);return this->m_glIsTexture(texture);}
+void m_glMultiTexCoord4iv_lazy(GLenum target,const GLint* v)const{if(!this->m_glMultiTexCoord4iv)this->m_resolveOrThrow(2690);this->m_glMultiTexCoord4iv(target,v);}
+void m_glTexEnvfv_lazy(GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glTexEnvfv)this->m_resolveOrThrow(2691);this->m_glTexEnvfv(target,pname,params);}
+void m_glPopDebugGroup_lazy()const{if(!this->m_glPopDebugGroup)this->m_resolveOrThrow(2692);this->m_glPopDebugGroup();}
+void m_glUniformBlockBinding_lazy(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding)const{if(!this->m_glUniformBlockBinding)this->m_resolveOrThrow(2693);this->m_glUniformBlockBinding(program,uniformBlockIndex,uniformBlockBinding);}
+void m_glWindowPos2svMESA_lazy(const GLshort* v)const{if(!this->m_glWindowPos2svMESA)this->m_resolveOrThrow(2694);this->m_glWindowPos2svMESA(v);}
+void m_glGenerateTextureMipmapEXT_lazy(GLuint texture,GLenum target)const{if(!this->m_glGenerateTextureMipmapEXT)this->m_resolveOrThrow(2695);this->m_glGenerateTextureMipmapEXT(texture,target);}
+GLuint m_glBindLightParameterEXT_lazy(GLenum light,GLenum value)const{if(!this->m_glBindLightParameterEXT)this->m_resolveOrThrow(2696);return this->m_glBindLightParameterEXT(light,value);}
+void m_glTexCoord3bOES_lazy(GLbyte s,GLbyte t,GLbyte r)const{if(!this->m_glTexCoord3bOES)this->m_resolveOrThrow(2697);this->m_glTexCoord3bOES(s,t,r);}
+void m_glTexCoordPointer_lazy(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{if(!this->m_glTexCoordPointer)this->m_resolveOrThrow(2698);this->m_glTexCoordPointer(size,type,stride,ptr);}
+void m_glProgramUniformMatrix3x2fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix3x2fv)this->m_resolveOrThrow(2699);this->m_glProgramUniformMatrix3x2fv(program,location,count,transpose,value);}
+void m_glUniform2fvARB_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform2fvARB)this->m_resolveOrThrow(2700);this->m_glUniform2fvARB(location,count,value);}
+void m_glProgramLocalParameterI4uivNV_lazy(GLenum target,GLuint index,const GLuint* params)const{if(!this->m_glProgramLocalParameterI4uivNV)this->m_resolveOrThrow(2701);this->m_glProgramLocalParameterI4uivNV(target,index,params);}
+void m_glFlushVertexArrayRangeNV_lazy()const{if(!this->m_glFlushVertexArrayRangeNV)this->m_resolveOrThrow(2702);this->m_glFlushVertexArrayRangeNV();}
+void m_glSecondaryColor3svEXT_lazy(const GLshort* v)const{if(!this->m_glSecondaryColor3svEXT)this->m_resolveOrThrow(2703);this->m_glSecondaryColor3svEXT(v);}
+void m_glGetBufferParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetBufferParameteriv)this->m_resolveOrThrow(2704);this->m_glGetBufferParameteriv(target,pname,params);}
+void m_glGetQueryIndexediv_lazy(GLenum target,GLuint index,GLenum pname,GLint* params)const{if(!this->m_glGetQueryIndexediv)this->m_resolveOrThrow(2705);this->m_glGetQueryIndexediv(target,index,pname,params);}
+void m_glFramebufferTexture3DEXT_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{if(!this->m_glFramebufferTexture3DEXT)this->m_resolveOrThrow(2706);this->m_glFramebufferTexture3DEXT(target,attachment,textarget,texture,level,zoffset);}
+void m_glLoadTransposeMatrixxOES_lazy(const GLfixed* m)const{if(!this->m_glLoadTransposeMatrixxOES)this->m_resolveOrThrow(2707);this->m_glLoadTransposeMatrixxOES(m);}
+void m_glDeleteTransformFeedbacksNV_lazy(GLsizei n,const GLuint* ids)const{if(!this->m_glDeleteTransformFeedbacksNV)this->m_resolveOrThrow(2708);this->m_glDeleteTransformFeedbacksNV(n,ids);}
+void m_glGetCompressedTextureImageEXT_lazy(GLuint texture,GLenum target,GLint lod,void* img)const{if(!this->m_glGetCompressedTextureImageEXT)this->m_resolveOrThrow(2709);this->m_glGetCompressedTextureImageEXT(texture,target,lod,img);}
+void m_glIndexMaterialEXT_lazy(GLenum face,GLenum mode)const{if(!this->m_glIndexMaterialEXT)this->m_resolveOrThrow(2710);this->m_glIndexMaterialEXT(face,mode);}
+void m_glFogCoorddEXT_lazy(GLdouble coord)const{if(!this->m_glFogCoorddEXT)this->m_resolveOrThrow(2711);this->m_glFogCoorddEXT(coord);}
+void m_glTexCoord2hvNV_lazy(const GLhalfNV* v)const{if(!this->m_glTexCoord2hvNV)this->m_resolveOrThrow(2712);this->m_glTexCoord2hvNV(v);}
+void m_glGetFramebufferParameterfvAMD_lazy(GLenum target,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{if(!this->m_glGetFramebufferParameterfvAMD)this->m_resolveOrThrow(2713);this->m_glGetFramebufferParameterfvAMD(target,pname,numsamples,pixelindex,size,values);}
+void m_glTexEnviv_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTexEnviv)this->m_resolveOrThrow(2714);this->m_glTexEnviv(target,pname,params);}
+void m_glEndTransformFeedbackNV_lazy()const{if(!this->m_glEndTransformFeedbackNV)this->m_resolveOrThrow(2715);this->m_glEndTransformFeedbackNV();}
+void m_glGlobalAlphaFactoruiSUN_lazy(GLuint factor)const{if(!this->m_glGlobalAlphaFactoruiSUN)this->m_resolveOrThrow(2716);this->m_glGlobalAlphaFactoruiSUN(factor);}
+void m_glSelectBuffer_lazy(GLsizei size,GLuint* buffer)const{if(!this->m_glSelectBuffer)this->m_resolveOrThrow(2717);this->m_glSelectBuffer(size,buffer);}
+void m_glNamedBufferSubDataEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{if(!this->m_glNamedBufferSubDataEXT)this->m_resolveOrThrow(2718);this->m_glNamedBufferSubDataEXT(buffer,offset,size,data);}
+void m_glDisableVertexArrayAttrib_lazy(GLuint vaobj,GLuint index)const{if(!this->m_glDisableVertexArrayAttrib)this->m_resolveOrThrow(2719);this->m_glDisableVertexArrayAttrib(vaobj,index);}
+void m_glBlendFunc_lazy(GLenum sfactor,GLenum dfactor)const{if(!this->m_glBlendFunc)this->m_resolveOrThrow(2720);this->m_glBlendFunc(sfactor,dfactor);}
+GLuint m_glCreateProgram_lazy()const{if(!this->m_glCreateProgram)this->m_resolveOrThrow(2721);return this->m_glCreateProgram();}
+void m_glVertexStream2dATI_lazy(GLenum stream,GLdouble x,GLdouble y)const{if(!this->m_glVertexStream2dATI)this->m_resolveOrThrow(2722);this->m_glVertexStream2dATI(stream,x,y);}
+void m_glUniform4ui64vARB_lazy(GLint location,GLsizei count,const GLuint64* value)const{if(!this->m_glUniform4ui64vARB)this->m_resolveOrThrow(2723);this->m_glUniform4ui64vARB(location,count,value);}
+void m_glGetSemaphoreParameterui64vEXT_lazy(GLuint semaphore,GLenum pname,GLuint64* params)const{if(!this->m_glGetSemaphoreParameterui64vEXT)this->m_resolveOrThrow(2724);this->m_glGetSemaphoreParameterui64vEXT(semaphore,pname,params);}
+void m_glPrimitiveRestartIndex_lazy(GLuint index)const{if(!this->m_glPrimitiveRestartIndex)this->m_resolveOrThrow(2725);this->m_glPrimitiveRestartIndex(index);}
+void m_glNormalStream3fATI_lazy(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz)const{if(!this->m_glNormalStream3fATI)this->m_resolveOrThrow(2726);this->m_glNormalStream3fATI(stream,nx,ny,nz);}
+void m_glProgramUniformMatrix2fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix2fv)this->m_resolveOrThrow(2727);this->m_glProgramUniformMatrix2fv(program,location,count,transpose,value);}
+void m_glVertexAttribs1hvNV_lazy(GLuint index,GLsizei n,const GLhalfNV* v)const{if(!this->m_glVertexAttribs1hvNV)this->m_resolveOrThrow(2728);this->m_glVertexAttribs1hvNV(index,n,v);}
+void m_glWindowPos4svMESA_lazy(const GLshort* v)const{if(!this->m_glWindowPos4svMESA)this->m_resolveOrThrow(2729);this->m_glWindowPos4svMESA(v);}
+void m_glDeleteFragmentShaderATI_lazy(GLuint id)const{if(!this->m_glDeleteFragmentShaderATI)this->m_resolveOrThrow(2730);this->m_glDeleteFragmentShaderATI(id);}
+void m_glBindImageTextures_lazy(GLuint first,GLsizei count,const GLuint* textures)const{if(!this->m_glBindImageTextures)this->m_resolveOrThrow(2731);this->m_glBindImageTextures(first,count,textures);}
+void m_glMap2xOES_lazy(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points)const{if(!this->m_glMap2xOES)this->m_resolveOrThrow(2732);this->m_glMap2xOES(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+void m_glEnd_lazy()const{if(!this->m_glEnd)this->m_resolveOrThrow(2733);this->m_glEnd();}
+void m_glMultiTexCoord2dARB_lazy(GLenum target,GLdouble s,GLdouble t)const{if(!this->m_glMultiTexCoord2dARB)this->m_resolveOrThrow(2734);this->m_glMultiTexCoord2dARB(target,s,t);}
+void m_glUniform1i64NV_lazy(GLint location,GLint64EXT x)const{if(!this->m_glUniform1i64NV)this->m_resolveOrThrow(2735);this->m_glUniform1i64NV(location,x);}
+void m_glPathStringNV_lazy(GLuint path,GLenum format,GLsizei length,const void* pathString)const{if(!this->m_glPathStringNV)this->m_resolveOrThrow(2736);this->m_glPathStringNV(path,format,length,pathString);}
+void m_glGetNamedFramebufferParameterivEXT_lazy(GLuint framebuffer,GLenum pname,GLint* params)const{if(!this->m_glGetNamedFramebufferParameterivEXT)this->m_resolveOrThrow(2737);this->m_glGetNamedFramebufferParameterivEXT(framebuffer,pname,params);}
+void m_glGetProgramNamedParameterdvNV_lazy(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params)const{if(!this->m_glGetProgramNamedParameterdvNV)this->m_resolveOrThrow(2738);this->m_glGetProgramNamedParameterdvNV(id,len,name,params);}
+void m_glPathDashArrayNV_lazy(GLuint path,GLsizei dashCount,const GLfloat* dashArray)const{if(!this->m_glPathDashArrayNV)this->m_resolveOrThrow(2739);this->m_glPathDashArrayNV(path,dashCount,dashArray);}
+void m_glUniform3uiv_lazy(GLint location,GLsizei count,const GLuint* value)const{if(!this->m_glUniform3uiv)this->m_resolveOrThrow(2740);this->m_glUniform3uiv(location,count,value);}
+void m_glColor3fVertex3fvSUN_lazy(const GLfloat* c,const GLfloat* v)const{if(!this->m_glColor3fVertex3fvSUN)this->m_resolveOrThrow(2741);this->m_glColor3fVertex3fvSUN(c,v);}
+void m_glMultTransposeMatrixd_lazy(const GLdouble m[16])const{if(!this->m_glMultTransposeMatrixd)this->m_resolveOrThrow(2742);this->m_glMultTransposeMatrixd(m);}
+void m_glClearColor_lazy(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha)const{if(!this->m_glClearColor)this->m_resolveOrThrow(2743);this->m_glClearColor(red,green,blue,alpha);}
+GLuint64 m_glGetImageHandleARB_lazy(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{if(!this->m_glGetImageHandleARB)this->m_resolveOrThrow(2744);return this->m_glGetImageHandleARB(texture,level,layered,layer,format);}
+void m_glTangent3dEXT_lazy(GLdouble tx,GLdouble ty,GLdouble tz)const{if(!this->m_glTangent3dEXT)this->m_resolveOrThrow(2745);this->m_glTangent3dEXT(tx,ty,tz);}
+void m_glGetQueryObjectivARB_lazy(GLuint id,GLenum pname,GLint* params)const{if(!this->m_glGetQueryObjectivARB)this->m_resolveOrThrow(2746);this->m_glGetQueryObjectivARB(id,pname,params);}
+void m_glGetLocalConstantFloatvEXT_lazy(GLuint id,GLenum value,GLfloat* data)const{if(!this->m_glGetLocalConstantFloatvEXT)this->m_resolveOrThrow(2747);this->m_glGetLocalConstantFloatvEXT(id,value,data);}
+void m_glUseShaderProgramEXT_lazy(GLenum type,GLuint program)const{if(!this->m_glUseShaderProgramEXT)this->m_resolveOrThrow(2748);this->m_glUseShaderProgramEXT(type,program);}
+void m_glBindRenderbufferEXT_lazy(GLenum target,GLuint renderbuffer)const{if(!this->m_glBindRenderbufferEXT)this->m_resolveOrThrow(2749);this->m_glBindRenderbufferEXT(target,renderbuffer);}
+void m_glInterleavedArrays_lazy(GLenum format,GLsizei stride,const GLvoid* pointer)const{if(!this->m_glInterleavedArrays)this->m_resolveOrThrow(2750);this->m_glInterleavedArrays(format,stride,pointer);}
+void m_glGetPerfMonitorGroupStringAMD_lazy(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString)const{if(!this->m_glGetPerfMonitorGroupStringAMD)this->m_resolveOrThrow(2751);this->m_glGetPerfMonitorGroupStringAMD(group,bufSize,length,groupString);}
+void m_glUniform3ui_lazy(GLint location,GLuint v0,GLuint v1,GLuint v2)const{if(!this->m_glUniform3ui)this->m_resolveOrThrow(2752);this->m_glUniform3ui(location,v0,v1,v2);}
+void m_glGetNamedProgramLocalParameterdvEXT_lazy(GLuint program,GLenum target,GLuint index,GLdouble* params)const{if(!this->m_glGetNamedProgramLocalParameterdvEXT)this->m_resolveOrThrow(2753);this->m_glGetNamedProgramLocalParameterdvEXT(program,target,index,params);}
+void m_glDeleteQueryResourceTagNV_lazy(GLsizei n,const GLint* tagIds)const{if(!this->m_glDeleteQueryResourceTagNV)this->m_resolveOrThrow(2754);this->m_glDeleteQueryResourceTagNV(n,tagIds);}
+void m_glVertexAttribI4uiv_lazy(GLuint index,const GLuint* v)const{if(!this->m_glVertexAttribI4uiv)this->m_resolveOrThrow(2755);this->m_glVertexAttribI4uiv(index,v);}
+void m_glVertexAttrib4bv_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttrib4bv)this->m_resolveOrThrow(2756);this->m_glVertexAttrib4bv(index,v);}
+void m_glMultiTexCoord3xOES_lazy(GLenum texture,GLfixed s,GLfixed t,GLfixed r)const{if(!this->m_glMultiTexCoord3xOES)this->m_resolveOrThrow(2757);this->m_glMultiTexCoord3xOES(texture,s,t,r);}
+void m_glSecondaryColor3ub_lazy(GLubyte red,GLubyte green,GLubyte blue)const{if(!this->m_glSecondaryColor3ub)this->m_resolveOrThrow(2758);this->m_glSecondaryColor3ub(red,green,blue);}
+void m_glFragmentMaterialfSGIX_lazy(GLenum face,GLenum pname,GLfloat param)const{if(!this->m_glFragmentMaterialfSGIX)this->m_resolveOrThrow(2759);this->m_glFragmentMaterialfSGIX(face,pname,param);}
+void m_glGetVariantArrayObjectivATI_lazy(GLuint id,GLenum pname,GLint* params)const{if(!this->m_glGetVariantArrayObjectivATI)this->m_resolveOrThrow(2760);this->m_glGetVariantArrayObjectivATI(id,pname,params);}
+void m_glSecondaryColor3ui_lazy(GLuint red,GLuint green,GLuint blue)const{if(!this->m_glSecondaryColor3ui)this->m_resolveOrThrow(2761);this->m_glSecondaryColor3ui(red,green,blue);}
+void m_glVertexAttrib1dARB_lazy(GLuint index,GLdouble x)const{if(!this->m_glVertexAttrib1dARB)this->m_resolveOrThrow(2762);this->m_glVertexAttrib1dARB(index,x);}
+void m_glGetNamedBufferPointerv_lazy(GLuint buffer,GLenum pname,void** params)const{if(!this->m_glGetNamedBufferPointerv)this->m_resolveOrThrow(2763);this->m_glGetNamedBufferPointerv(buffer,pname,params);}
+void m_glLockArraysEXT_lazy(GLint first,GLsizei count)const{if(!this->m_glLockArraysEXT)this->m_resolveOrThrow(2764);this->m_glLockArraysEXT(first,count);}
+void m_glVertexAttribPointerNV_lazy(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer)const{if(!this->m_glVertexAttribPointerNV)this->m_resolveOrThrow(2765);this->m_glVertexAttribPointerNV(index,fsize,type,stride,pointer);}
+void m_glConvolutionParameterf_lazy(GLenum target,GLenum pname,GLfloat params)const{if(!this->m_glConvolutionParameterf)this->m_resolveOrThrow(2766);this->m_glConvolutionParameterf(target,pname,params);}
+void m_glBindBufferBaseEXT_lazy(GLenum target,GLuint index,GLuint buffer)const{if(!this->m_glBindBufferBaseEXT)this->m_resolveOrThrow(2767);this->m_glBindBufferBaseEXT(target,index,buffer);}
+void m_glTexCoord2xvOES_lazy(const GLfixed* coords)const{if(!this->m_glTexCoord2xvOES)this->m_resolveOrThrow(2768);this->m_glTexCoord2xvOES(coords);}
+void m_glGetQueryBufferObjectui64v_lazy(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{if(!this->m_glGetQueryBufferObjectui64v)this->m_resolveOrThrow(2769);this->m_glGetQueryBufferObjectui64v(id,buffer,pname,offset);}
+void m_glSetMultisamplefvAMD_lazy(GLenum pname,GLuint index,const GLfloat* val)const{if(!this->m_glSetMultisamplefvAMD)this->m_resolveOrThrow(2770);this->m_glSetMultisamplefvAMD(pname,index,val);}
+void m_glPathColorGenNV_lazy(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs)const{if(!this->m_glPathColorGenNV)this->m_resolveOrThrow(2771);this->m_glPathColorGenNV(color,genMode,colorFormat,coeffs);}
+void m_glVertexAttrib3sARB_lazy(GLuint index,GLshort x,GLshort y,GLshort z)const{if(!this->m_glVertexAttrib3sARB)this->m_resolveOrThrow(2772);this->m_glVertexAttrib3sARB(index,x,y,z);}
+void m_glVertexAttrib4ivARB_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttrib4ivARB)this->m_resolveOrThrow(2773);this->m_glVertexAttrib4ivARB(index,v);}
+void m_glGenTransformFeedbacks_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glGenTransformFeedbacks)this->m_resolveOrThrow(2774);this->m_glGenTransformFeedbacks(n,ids);}
+void m_glGetVertexAttribIuiv_lazy(GLuint index,GLenum pname,GLuint* params)const{if(!this->m_glGetVertexAttribIuiv)this->m_resolveOrThrow(2775);this->m_glGetVertexAttribIuiv(index,pname,params);}
+void m_glPixelTransformParameterfEXT_lazy(GLenum target,GLenum pname,GLfloat param)const{if(!this->m_glPixelTransformParameterfEXT)this->m_resolveOrThrow(2776);this->m_glPixelTransformParameterfEXT(target,pname,param);}
+void m_glGetTexParameterIuivEXT_lazy(GLenum target,GLenum pname,GLuint* params)const{if(!this->m_glGetTexParameterIuivEXT)this->m_resolveOrThrow(2777);this->m_glGetTexParameterIuivEXT(target,pname,params);}
+void m_glGetObjectParameterivARB_lazy(GLhandleARB obj,GLenum pname,GLint* params)const{if(!this->m_glGetObjectParameterivARB)this->m_resolveOrThrow(2778);this->m_glGetObjectParameterivARB(obj,pname,params);}
+void m_glVertexArraySecondaryColorOffsetEXT_lazy(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{if(!this->m_glVertexArraySecondaryColorOffsetEXT)this->m_resolveOrThrow(2779);this->m_glVertexArraySecondaryColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+void m_glWindowPos2fARB_lazy(GLfloat x,GLfloat y)const{if(!this->m_glWindowPos2fARB)this->m_resolveOrThrow(2780);this->m_glWindowPos2fARB(x,y);}
+void m_glCompressedTexSubImage2D_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data)const{if(!this->m_glCompressedTexSubImage2D)this->m_resolveOrThrow(2781);this->m_glCompressedTexSubImage2D(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+void m_glCompressedTexSubImage3DARB_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{if(!this->m_glCompressedTexSubImage3DARB)this->m_resolveOrThrow(2782);this->m_glCompressedTexSubImage3DARB(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+void m_glProgramBinary_lazy(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length)const{if(!this->m_glProgramBinary)this->m_resolveOrThrow(2783);this->m_glProgramBinary(program,binaryFormat,binary,length);}
+void m_glPresentFrameKeyedNV_lazy(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1)const{if(!this->m_glPresentFrameKeyedNV)this->m_resolveOrThrow(2784);this->m_glPresentFrameKeyedNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);}
+void m_glVertexAttribI4bv_lazy(GLuint index,const GLbyte* v)const{if(!this->m_glVertexAttribI4bv)this->m_resolveOrThrow(2785);this->m_glVertexAttribI4bv(index,v);}
+void m_glPathCoverDepthFuncNV_lazy(GLenum func)const{if(!this->m_glPathCoverDepthFuncNV)this->m_resolveOrThrow(2786);this->m_glPathCoverDepthFuncNV(func);}
+void m_glTransformFeedbackStreamAttribsNV_lazy(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode)const{if(!this->m_glTransformFeedbackStreamAttribsNV)this->m_resolveOrThrow(2787);this->m_glTransformFeedbackStreamAttribsNV(count,attribs,nbuffers,bufstreams,bufferMode);}
+void m_glSecondaryColor3usEXT_lazy(GLushort red,GLushort green,GLushort blue)const{if(!this->m_glSecondaryColor3usEXT)this->m_resolveOrThrow(2788);this->m_glSecondaryColor3usEXT(red,green,blue);}
+void m_glCopyColorTableSGI_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyColorTableSGI)this->m_resolveOrThrow(2789);this->m_glCopyColorTableSGI(target,internalformat,x,y,width);}
+void m_glProgramEnvParameter4fvARB_lazy(GLenum target,GLuint index,const GLfloat* params)const{if(!this->m_glProgramEnvParameter4fvARB)this->m_resolveOrThrow(2790);this->m_glProgramEnvParameter4fvARB(target,index,params);}
+void m_glMultiTexCoord4sARB_lazy(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{if(!this->m_glMultiTexCoord4sARB)this->m_resolveOrThrow(2791);this->m_glMultiTexCoord4sARB(target,s,t,r,q);}
+void m_glGetVertexArrayIndexed64iv_lazy(GLuint vaobj,GLuint index,GLenum pname,GLint64* param)const{if(!this->m_glGetVertexArrayIndexed64iv)this->m_resolveOrThrow(2792);this->m_glGetVertexArrayIndexed64iv(vaobj,index,pname,param);}
+void m_glMatrixMultTranspose3x3fNV_lazy(GLenum matrixMode,const GLfloat* m)const{if(!this->m_glMatrixMultTranspose3x3fNV)this->m_resolveOrThrow(2793);this->m_glMatrixMultTranspose3x3fNV(matrixMode,m);}
+void m_glTexParameterIiv_lazy(GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTexParameterIiv)this->m_resolveOrThrow(2794);this->m_glTexParameterIiv(target,pname,params);}
+void m_glVertexArrayAttribFormat_lazy(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{if(!this->m_glVertexArrayAttribFormat)this->m_resolveOrThrow(2795);this->m_glVertexArrayAttribFormat(vaobj,attribindex,size,type,normalized,relativeoffset);}
+void m_glEndTransformFeedback_lazy()const{if(!this->m_glEndTransformFeedback)this->m_resolveOrThrow(2796);this->m_glEndTransformFeedback();}
+void m_glDrawCommandsStatesAddressNV_lazy(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{if(!this->m_glDrawCommandsStatesAddressNV)this->m_resolveOrThrow(2797);this->m_glDrawCommandsStatesAddressNV(indirects,sizes,states,fbos,count);}
+void m_glUniform4ui64NV_lazy(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{if(!this->m_glUniform4ui64NV)this->m_resolveOrThrow(2798);this->m_glUniform4ui64NV(location,x,y,z,w);}
+void m_glMaterialiv_lazy(GLenum face,GLenum pname,const GLint* params)const{if(!this->m_glMaterialiv)this->m_resolveOrThrow(2799);this->m_glMaterialiv(face,pname,params);}
+void m_glTexImage2DMultisample_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{if(!this->m_glTexImage2DMultisample)this->m_resolveOrThrow(2800);this->m_glTexImage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+void m_glBindTextureEXT_lazy(GLenum target,GLuint texture)const{if(!this->m_glBindTextureEXT)this->m_resolveOrThrow(2801);this->m_glBindTextureEXT(target,texture);}
+GLboolean m_glIsBuffer_lazy(GLuint buffer)const{if(!this->m_glIsBuffer)this->m_resolveOrThrow(2802);return this->m_glIsBuffer(buffer);}
+void m_glVertexAttribI1iv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI1iv)this->m_resolveOrThrow(2803);this->m_glVertexAttribI1iv(index,v);}
+void m_glGetFinalCombinerInputParameterfvNV_lazy(GLenum variable,GLenum pname,GLfloat* params)const{if(!this->m_glGetFinalCombinerInputParameterfvNV)this->m_resolveOrThrow(2804);this->m_glGetFinalCombinerInputParameterfvNV(variable,pname,params);}
+void m_glMultiTexCoord3bvOES_lazy(GLenum texture,const GLbyte* coords)const{if(!this->m_glMultiTexCoord3bvOES)this->m_resolveOrThrow(2805);this->m_glMultiTexCoord3bvOES(texture,coords);}
+void m_glVertexAttribDivisor_lazy(GLuint index,GLuint divisor)const{if(!this->m_glVertexAttribDivisor)this->m_resolveOrThrow(2806);this->m_glVertexAttribDivisor(index,divisor);}
+void m_glCopyBufferSubData_lazy(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{if(!this->m_glCopyBufferSubData)this->m_resolveOrThrow(2807);this->m_glCopyBufferSubData(readTarget,writeTarget,readOffset,writeOffset,size);}
+GLuint m_glBindTexGenParameterEXT_lazy(GLenum unit,GLenum coord,GLenum value)const{if(!this->m_glBindTexGenParameterEXT)this->m_resolveOrThrow(2808);return this->m_glBindTexGenParameterEXT(unit,coord,value);}
+void m_glNormalStream3bATI_lazy(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz)const{if(!this->m_glNormalStream3bATI)this->m_resolveOrThrow(2809);this->m_glNormalStream3bATI(stream,nx,ny,nz);}
+void m_glTexStorageMem2DEXT_lazy(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{if(!this->m_glTexStorageMem2DEXT)this->m_resolveOrThrow(2810);this->m_glTexStorageMem2DEXT(target,levels,internalFormat,width,height,memory,offset);}
+void m_glTextureImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureImage2DEXT)this->m_resolveOrThrow(2811);this->m_glTextureImage2DEXT(texture,target,level,internalformat,width,height,border,format,type,pixels);}
+void m_glGetColorTableParameteriv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetColorTableParameteriv)this->m_resolveOrThrow(2812);this->m_glGetColorTableParameteriv(target,pname,params);}
+void m_glActiveTextureARB_lazy(GLenum texture)const{if(!this->m_glActiveTextureARB)this->m_resolveOrThrow(2813);this->m_glActiveTextureARB(texture);}
+void m_glTexCoord4xOES_lazy(GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{if(!this->m_glTexCoord4xOES)this->m_resolveOrThrow(2814);this->m_glTexCoord4xOES(s,t,r,q);}
+void m_glNamedBufferStorageExternalEXT_lazy(GLuint buffer,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{if(!this->m_glNamedBufferStorageExternalEXT)this->m_resolveOrThrow(2815);this->m_glNamedBufferStorageExternalEXT(buffer,offset,size,clientBuffer,flags);}
+void m_glSecondaryColor3fvEXT_lazy(const GLfloat* v)const{if(!this->m_glSecondaryColor3fvEXT)this->m_resolveOrThrow(2816);this->m_glSecondaryColor3fvEXT(v);}
+void m_glUniformMatrix4x2fv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix4x2fv)this->m_resolveOrThrow(2817);this->m_glUniformMatrix4x2fv(location,count,transpose,value);}
+void m_glStartInstrumentsSGIX_lazy()const{if(!this->m_glStartInstrumentsSGIX)this->m_resolveOrThrow(2818);this->m_glStartInstrumentsSGIX();}
+void m_glProgramNamedParameter4fvNV_lazy(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v)const{if(!this->m_glProgramNamedParameter4fvNV)this->m_resolveOrThrow(2819);this->m_glProgramNamedParameter4fvNV(id,len,name,v);}
+void m_glEndVideoCaptureNV_lazy(GLuint video_capture_slot)const{if(!this->m_glEndVideoCaptureNV)this->m_resolveOrThrow(2820);this->m_glEndVideoCaptureNV(video_capture_slot);}
+GLuint m_glGenLists_lazy(GLsizei range)const{if(!this->m_glGenLists)this->m_resolveOrThrow(2821);return this->m_glGenLists(range);}
+void m_glUniform1fARB_lazy(GLint location,GLfloat v0)const{if(!this->m_glUniform1fARB)this->m_resolveOrThrow(2822);this->m_glUniform1fARB(location,v0);}
+void m_glNamedFramebufferTexture1DEXT_lazy(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{if(!this->m_glNamedFramebufferTexture1DEXT)this->m_resolveOrThrow(2823);this->m_glNamedFramebufferTexture1DEXT(framebuffer,attachment,textarget,texture,level);}
+void* m_glMapBufferRange_lazy(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access)const{if(!this->m_glMapBufferRange)this->m_resolveOrThrow(2824);return this->m_glMapBufferRange(target,offset,length,access);}
+void m_glMultiDrawElementsIndirectCountARB_lazy(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{if(!this->m_glMultiDrawElementsIndirectCountARB)this->m_resolveOrThrow(2825);this->m_glMultiDrawElementsIndirectCountARB(mode,type,indirect,drawcount,maxdrawcount,stride);}
+void m_glProgramUniformMatrix4x2fv_lazy(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glProgramUniformMatrix4x2fv)this->m_resolveOrThrow(2826);this->m_glProgramUniformMatrix4x2fv(program,location,count,transpose,value);}
+void m_glGetTextureParameterIivEXT_lazy(GLuint texture,GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTextureParameterIivEXT)this->m_resolveOrThrow(2827);this->m_glGetTextureParameterIivEXT(texture,target,pname,params);}
+void m_glMultiTexCoord3hNV_lazy(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r)const{if(!this->m_glMultiTexCoord3hNV)this->m_resolveOrThrow(2828);this->m_glMultiTexCoord3hNV(target,s,t,r);}
+void m_glNamedProgramLocalParametersI4uivEXT_lazy(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params)const{if(!this->m_glNamedProgramLocalParametersI4uivEXT)this->m_resolveOrThrow(2829);this->m_glNamedProgramLocalParametersI4uivEXT(program,target,index,count,params);}
+void m_glEndList_lazy()const{if(!this->m_glEndList)this->m_resolveOrThrow(2830);this->m_glEndList();}
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_lazy(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{if(!this->m_glTexCoord2fColor4fNormal3fVertex3fSUN)this->m_resolveOrThrow(2831);this->m_glTexCoord2fColor4fNormal3fVertex3fSUN(s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+void m_glGenTransformFeedbacksNV_lazy(GLsizei n,GLuint* ids)const{if(!this->m_glGenTransformFeedbacksNV)this->m_resolveOrThrow(2832);this->m_glGenTransformFeedbacksNV(n,ids);}
+void m_glEdgeFlagv_lazy(const GLboolean* flag)const{if(!this->m_glEdgeFlagv)this->m_resolveOrThrow(2833);this->m_glEdgeFlagv(flag);}
+void m_glVertexAttribI2iv_lazy(GLuint index,const GLint* v)const{if(!this->m_glVertexAttribI2iv)this->m_resolveOrThrow(2834);this->m_glVertexAttribI2iv(index,v);}
+void m_glCopyMultiTexImage2DEXT_lazy(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{if(!this->m_glCopyMultiTexImage2DEXT)this->m_resolveOrThrow(2835);this->m_glCopyMultiTexImage2DEXT(texunit,target,level,internalformat,x,y,width,height,border);}
+void m_glUniformMatrix3x2dv_lazy(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{if(!this->m_glUniformMatrix3x2dv)this->m_resolveOrThrow(2836);this->m_glUniformMatrix3x2dv(location,count,transpose,value);}
+void m_glTexImage3DMultisampleCoverageNV_lazy(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{if(!this->m_glTexImage3DMultisampleCoverageNV)this->m_resolveOrThrow(2837);this->m_glTexImage3DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+void m_glGetShaderPrecisionFormat_lazy(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision)const{if(!this->m_glGetShaderPrecisionFormat)this->m_resolveOrThrow(2838);this->m_glGetShaderPrecisionFormat(shadertype,precisiontype,range,precision);}
+void m_glTexSubImage4DSGIS_lazy(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTexSubImage4DSGIS)this->m_resolveOrThrow(2839);this->m_glTexSubImage4DSGIS(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);}
+void m_glRasterSamplesEXT_lazy(GLuint samples,GLboolean fixedsamplelocations)const{if(!this->m_glRasterSamplesEXT)this->m_resolveOrThrow(2840);this->m_glRasterSamplesEXT(samples,fixedsamplelocations);}
+void m_glTextureView_lazy(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers)const{if(!this->m_glTextureView)this->m_resolveOrThrow(2841);this->m_glTextureView(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);}
+void m_glEvalMapsNV_lazy(GLenum target,GLenum mode)const{if(!this->m_glEvalMapsNV)this->m_resolveOrThrow(2842);this->m_glEvalMapsNV(target,mode);}
+GLint m_glGetFragDataLocationEXT_lazy(GLuint program,const GLchar* name)const{if(!this->m_glGetFragDataLocationEXT)this->m_resolveOrThrow(2843);return this->m_glGetFragDataLocationEXT(program,name);}
+void m_glGetCompressedMultiTexImageEXT_lazy(GLenum texunit,GLenum target,GLint lod,void* img)const{if(!this->m_glGetCompressedMultiTexImageEXT)this->m_resolveOrThrow(2844);this->m_glGetCompressedMultiTexImageEXT(texunit,target,lod,img);}
+void m_glIndexMask_lazy(GLuint mask)const{if(!this->m_glIndexMask)this->m_resolveOrThrow(2845);this->m_glIndexMask(mask);}
+void m_glPushClientAttrib_lazy(GLbitfield mask)const{if(!this->m_glPushClientAttrib)this->m_resolveOrThrow(2846);this->m_glPushClientAttrib(mask);}
+void m_glShaderSource_lazy(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length)const{if(!this->m_glShaderSource)this->m_resolveOrThrow(2847);this->m_glShaderSource(shader,count,string,length);}
+void m_glDispatchComputeGroupSizeARB_lazy(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z)const{if(!this->m_glDispatchComputeGroupSizeARB)this->m_resolveOrThrow(2848);this->m_glDispatchComputeGroupSizeARB(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);}
+void m_glLGPUNamedBufferSubDataNVX_lazy(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{if(!this->m_glLGPUNamedBufferSubDataNVX)this->m_resolveOrThrow(2849);this->m_glLGPUNamedBufferSubDataNVX(gpuMask,buffer,offset,size,data);}
+void m_glGetnPixelMapfv_lazy(GLenum map,GLsizei bufSize,GLfloat* values)const{if(!this->m_glGetnPixelMapfv)this->m_resolveOrThrow(2850);this->m_glGetnPixelMapfv(map,bufSize,values);}
+void m_glTexCoordP2uiv_lazy(GLenum type,const GLuint* coords)const{if(!this->m_glTexCoordP2uiv)this->m_resolveOrThrow(2851);this->m_glTexCoordP2uiv(type,coords);}
+void m_glUniform2f_lazy(GLint location,GLfloat v0,GLfloat v1)const{if(!this->m_glUniform2f)this->m_resolveOrThrow(2852);this->m_glUniform2f(location,v0,v1);}
+void m_glGetNamedBufferParameteri64v_lazy(GLuint buffer,GLenum pname,GLint64* params)const{if(!this->m_glGetNamedBufferParameteri64v)this->m_resolveOrThrow(2853);this->m_glGetNamedBufferParameteri64v(buffer,pname,params);}
+void m_glCommandListSegmentsNV_lazy(GLuint list,GLuint segments)const{if(!this->m_glCommandListSegmentsNV)this->m_resolveOrThrow(2854);this->m_glCommandListSegmentsNV(list,segments);}
+void m_glTextureParameterIivEXT_lazy(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{if(!this->m_glTextureParameterIivEXT)this->m_resolveOrThrow(2855);this->m_glTextureParameterIivEXT(texture,target,pname,params);}
+void m_glMultiTexParameterfvEXT_lazy(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{if(!this->m_glMultiTexParameterfvEXT)this->m_resolveOrThrow(2856);this->m_glMultiTexParameterfvEXT(texunit,target,pname,params);}
+void m_glProgramUniform2ui64ARB_lazy(GLuint program,GLint location,GLuint64 x,GLuint64 y)const{if(!this->m_glProgramUniform2ui64ARB)this->m_resolveOrThrow(2857);this->m_glProgramUniform2ui64ARB(program,location,x,y);}
+void m_glVertex4d_lazy(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{if(!this->m_glVertex4d)this->m_resolveOrThrow(2858);this->m_glVertex4d(x,y,z,w);}
+GLuint m_glNewObjectBufferATI_lazy(GLsizei size,const void* pointer,GLenum usage)const{if(!this->m_glNewObjectBufferATI)this->m_resolveOrThrow(2859);return this->m_glNewObjectBufferATI(size,pointer,usage);}
+void m_glViewportSwizzleNV_lazy(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew)const{if(!this->m_glViewportSwizzleNV)this->m_resolveOrThrow(2860);this->m_glViewportSwizzleNV(index,swizzlex,swizzley,swizzlez,swizzlew);}
+void m_glBufferData_lazy(GLenum target,GLsizeiptr size,const void* data,GLenum usage)const{if(!this->m_glBufferData)this->m_resolveOrThrow(2861);this->m_glBufferData(target,size,data,usage);}
+void m_glTextureImage1DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{if(!this->m_glTextureImage1DEXT)this->m_resolveOrThrow(2862);this->m_glTextureImage1DEXT(texture,target,level,internalformat,width,border,format,type,pixels);}
+void m_glGetTexParameterIiv_lazy(GLenum target,GLenum pname,GLint* params)const{if(!this->m_glGetTexParameterIiv)this->m_resolveOrThrow(2863);this->m_glGetTexParameterIiv(target,pname,params);}
+void m_glCopyTexSubImage1DEXT_lazy(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{if(!this->m_glCopyTexSubImage1DEXT)this->m_resolveOrThrow(2864);this->m_glCopyTexSubImage1DEXT(target,level,xoffset,x,y,width);}
+void m_glVertex4f_lazy(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{if(!this->m_glVertex4f)this->m_resolveOrThrow(2865);this->m_glVertex4f(x,y,z,w);}
+void m_glUniformMatrix3fvARB_lazy(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{if(!this->m_glUniformMatrix3fvARB)this->m_resolveOrThrow(2866);this->m_glUniformMatrix3fvARB(location,count,transpose,value);}
+void m_glTexCoordP1ui_lazy(GLenum type,GLuint coords)const{if(!this->m_glTexCoordP1ui)this->m_resolveOrThrow(2867);this->m_glTexCoordP1ui(type,coords);}
+void m_glPointParameterfvEXT_lazy(GLenum pname,const GLfloat* params)const{if(!this->m_glPointParameterfvEXT)this->m_resolveOrThrow(2868);this->m_glPointParameterfvEXT(pname,params);}
+void m_glUniform4fARB_lazy(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{if(!this->m_glUniform4fARB)this->m_resolveOrThrow(2869);this->m_glUniform4fARB(location,v0,v1,v2,v3);}
+void m_glImportMemoryFdEXT_lazy(GLuint memory,GLuint64 size,GLenum handleType,GLint fd)const{if(!this->m_glImportMemoryFdEXT)this->m_resolveOrThrow(2870);this->m_glImportMemoryFdEXT(memory,size,handleType,fd);}
+void m_glCopyTextureSubImage3D_lazy(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyTextureSubImage3D)this->m_resolveOrThrow(2871);this->m_glCopyTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,x,y,width,height);}
+void m_glMultiTexCoord2fv_lazy(GLenum target,const GLfloat* v)const{if(!this->m_glMultiTexCoord2fv)this->m_resolveOrThrow(2872);this->m_glMultiTexCoord2fv(target,v);}
+void m_glNamedFramebufferSamplePositionsfvAMD_lazy(GLuint framebuffer,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{if(!this->m_glNamedFramebufferSamplePositionsfvAMD)this->m_resolveOrThrow(2873);this->m_glNamedFramebufferSamplePositionsfvAMD(framebuffer,numsamples,pixelindex,values);}
+void m_glNormalP3ui_lazy(GLenum type,GLuint coords)const{if(!this->m_glNormalP3ui)this->m_resolveOrThrow(2874);this->m_glNormalP3ui(type,coords);}
+void m_glDrawRangeElementArrayATI_lazy(GLenum mode,GLuint start,GLuint end,GLsizei count)const{if(!this->m_glDrawRangeElementArrayATI)this->m_resolveOrThrow(2875);this->m_glDrawRangeElementArrayATI(mode,start,end,count);}
+void m_glVertexAttribI1i_lazy(GLuint index,GLint x)const{if(!this->m_glVertexAttribI1i)this->m_resolveOrThrow(2876);this->m_glVertexAttribI1i(index,x);}
+void m_glDrawArraysInstancedARB_lazy(GLenum mode,GLint first,GLsizei count,GLsizei primcount)const{if(!this->m_glDrawArraysInstancedARB)this->m_resolveOrThrow(2877);this->m_glDrawArraysInstancedARB(mode,first,count,primcount);}
+void m_glEnableVertexAttribAPPLE_lazy(GLuint index,GLenum pname)const{if(!this->m_glEnableVertexAttribAPPLE)this->m_resolveOrThrow(2878);this->m_glEnableVertexAttribAPPLE(index,pname);}
+GLuint m_glGetDebugMessageLogARB_lazy(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{if(!this->m_glGetDebugMessageLogARB)this->m_resolveOrThrow(2879);return this->m_glGetDebugMessageLogARB(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+void m_glGetPathTexGenfvNV_lazy(GLenum texCoordSet,GLenum pname,GLfloat* value)const{if(!this->m_glGetPathTexGenfvNV)this->m_resolveOrThrow(2880);this->m_glGetPathTexGenfvNV(texCoordSet,pname,value);}
+void m_glNamedProgramLocalParameters4fvEXT_lazy(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{if(!this->m_glNamedProgramLocalParameters4fvEXT)this->m_resolveOrThrow(2881);this->m_glNamedProgramLocalParameters4fvEXT(program,target,index,count,params);}
+void m_glQueryResourceTagNV_lazy(GLint tagId,const GLchar* tagString)const{if(!this->m_glQueryResourceTagNV)this->m_resolveOrThrow(2882);this->m_glQueryResourceTagNV(tagId,tagString);}
+void m_glVertexStream3fvATI_lazy(GLenum stream,const GLfloat* coords)const{if(!this->m_glVertexStream3fvATI)this->m_resolveOrThrow(2883);this->m_glVertexStream3fvATI(stream,coords);}
+void m_glFramebufferTexture3D_lazy(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{if(!this->m_glFramebufferTexture3D)this->m_resolveOrThrow(2884);this->m_glFramebufferTexture3D(target,attachment,textarget,texture,level,zoffset);}
+void m_glCompressedTextureSubImage2DEXT_lazy(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{if(!this->m_glCompressedTextureSubImage2DEXT)this->m_resolveOrThrow(2885);this->m_glCompressedTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+void m_glWindowPos3dv_lazy(const GLdouble* v)const{if(!this->m_glWindowPos3dv)this->m_resolveOrThrow(2886);this->m_glWindowPos3dv(v);}
+void m_glCopyConvolutionFilter2D_lazy(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{if(!this->m_glCopyConvolutionFilter2D)this->m_resolveOrThrow(2887);this->m_glCopyConvolutionFilter2D(target,internalformat,x,y,width,height);}
+void m_glReadInstrumentsSGIX_lazy(GLint marker)const{if(!this->m_glReadInstrumentsSGIX)this->m_resolveOrThrow(2888);this->m_glReadInstrumentsSGIX(marker);}
+void m_glProgramUniform2dvEXT_lazy(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{if(!this->m_glProgramUniform2dvEXT)this->m_resolveOrThrow(2889);this->m_glProgramUniform2dvEXT(program,location,count,value);}
+void m_glSamplerParameterfv_lazy(GLuint sampler,GLenum pname,const GLfloat* param)const{if(!this->m_glSamplerParameterfv)this->m_resolveOrThrow(2890);this->m_glSamplerParameterfv(sampler,pname,param);}
+void m_glBindBufferARB_lazy(GLenum target,GLuint buffer)const{if(!this->m_glBindBufferARB)this->m_resolveOrThrow(2891);this->m_glBindBufferARB(target,buffer);}
+void m_glVertexAttrib1sNV_lazy(GLuint index,GLshort x)const{if(!this->m_glVertexAttrib1sNV)this->m_resolveOrThrow(2892);this->m_glVertexAttrib1sNV(index,x);}
+void m_glGetMaterialiv_lazy(GLenum face,GLenum pname,GLint* params)const{if(!this->m_glGetMaterialiv)this->m_resolveOrThrow(2893);this->m_glGetMaterialiv(face,pname,params);}
+void m_glUniform1fv_lazy(GLint location,GLsizei count,const GLfloat* value)const{if(!this->m_glUniform1fv)this->m_resolveOrThrow(2894);this->m_glUniform1fv(location,count,value);}
+void m_glBeginOcclusionQueryNV_lazy(GLuint id)const{if(!this->m_glBeginOcclusionQueryNV)this->m_resolveOrThrow(2895);this->m_glBeginOcclusionQueryNV(id);}
+void m_glGenFencesAPPLE_lazy(GLsizei n,GLuint* fences)const{if(!this->m_glGenFencesAPPLE)this->m_resolveOrThrow(2896);this->m_glGenFencesAPPLE(n,fences);}
+void m_glScissorIndexedv_lazy(GLuint index,const GLint* v)const{if(!this->m_glScissorIndexedv)this->m_resolveOrThrow(2897);this->m_glScissorIndexedv(index,v);}
+void m_glDisableVariantClientStateEXT_lazy(GLuint id)const{if(!this->m_glDisableVariantClientStateEXT)this->m_resolveOrThrow(2898);this->m_glDisableVariantClientStateEXT(id);}
+void m_glMinmaxEXT_lazy(GLenum target,GLenum internalformat,GLboolean sink)const{if(!this->m_glMinmaxEXT)this->m_resolveOrThrow(2899);this->m_glMinmaxEXT(target,internalformat,sink);}
+void m_glNormalPointervINTEL_lazy(GLenum type,const void** pointer)const{if(!this->m_glNormalPointervINTEL)this->m_resolveOrThrow(2900);this->m_glNormalPointervINTEL(type,pointer);}
+void m_glNormal3s_lazy(GLshort nx,GLshort ny,GLshort nz)const{if(!this->m_glNormal3s)this->m_resolveOrThrow(2901);this->m_glNormal3s(nx,ny,nz);}
+void m_glGetnPixelMapuiv_lazy(GLenum map,GLsizei bufSize,GLuint* values)const{if(!this->m_glGetnPixelMapuiv)this->m_resolveOrThrow(2902);this->m_glGetnPixelMapuiv(map,bufSize,values);}
+void m_glNormalStream3bvATI_lazy(GLenum stream,const GLbyte* coords)const{if(!this->m_glNormalStream3bvATI)this->m_resolveOrThrow(2903);this->m_glNormalStream3bvATI(stream,coords);}
+void m_glGetObjectParameterivAPPLE_lazy(GLenum objectType,GLuint name,GLenum pname,GLint* params)const{if(!this->m_glGetObjectParameterivAPPLE)this->m_resolveOrThrow(2904);this->m_glGetObjectParameterivAPPLE(objectType,name,pname,params);}
+void m_glNormal3i_lazy(GLint nx,GLint ny,GLint nz)const{if(!this->m_glNormal3i)this->m_resolveOrThrow(2905);this->m_glNormal3i(nx,ny,nz);}
+void m_glUniform1ivARB_lazy(GLint location,GLsizei count,const GLint* value)const{if(!this->m_glUniform1ivARB)this->m_resolveOrThrow(2906);this->m_glUniform1ivARB(location,count,value);}
+void m_glNormal3d_lazy(GLdouble nx,GLdouble ny,GLdouble nz)const{if(!this->m_glNormal3d)this->m_resolveOrThrow(2907);this->m_glNormal3d(nx,ny,nz);}
+void m_glUpdateObjectBufferATI_lazy(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve)const{if(!this->m_glUpdateObjectBufferATI)this->m_resolveOrThrow(2908);this->m_glUpdateObjectBufferATI(buffer,offset,size,pointer,preserve);}
+void m_glNormal3b_lazy(GLbyte nx,GLbyte ny,GLbyte nz)const{if(!this->m_glNormal3b)this->m_resolveOrThrow(2909);this->m_glNormal3b(nx,ny,nz);}
+GLint m_glGetUniformBufferSizeEXT_lazy(GLuint program,GLint location)const{if(!this->m_glGetUniformBufferSizeEXT)this->m_resolveOrThrow(2910);return this->m_glGetUniformBufferSizeEXT(program,location);}
+void m_glMultiTexCoord4dv_lazy(GLenum target,const GLdouble* v)const{if(!this->m_glMultiTexCoord4dv)this->m_resolveOrThrow(2911);this->m_glMultiTexCoord4dv(target,v);}
+void m_glProgramUniform3i64ARB_lazy(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z)const{if(!this->m_glProgramUniform3i64ARB)this->m_resolveOrThrow(2912);this->m_glProgramUniform3i64ARB(program,location,x,y,z);}
+void m_glVertexAttrib2d_lazy(GLuint index,GLdouble x,GLdouble y)const{if(!this->m_glVertexAttrib2d)this->m_resolveOrThrow(2913);this->m_glVertexAttrib2d(index,x,y);}
+void m_glVertexAttrib2f_lazy(GLuint index,GLfloat x,GLfloat y)const{if(!this->m_glVertexAttrib2f)this->m_resolveOrThrow(2914);this->m_glVertexAttrib2f(index,x,y);}
+void m_glMultiDrawElementsEXT_lazy(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount)const{if(!this->m_glMultiDrawElementsEXT)this->m_resolveOrThrow(2915);this->m_glMultiDrawElementsEXT(mode,count,type,indices,primcount);}
+void m_glVertexAttrib3dv_lazy(GLuint index,const GLdouble* v)const{if(!this->m_glVertexAttrib3dv)this->m_resolveOrThrow(2916);this->m_glVertexAttrib3dv(index,v);}
+void m_glMultiTexCoord2bOES_lazy(GLenum texture,GLbyte s,GLbyte t)const{if(!this->m_glMultiTexCoord2bOES)this->m_resolveOrThrow(2917);this->m_glMultiTexCoord2bOES(texture,s,t);}
+void m_glVertexAttrib2s_lazy(GLuint index,GLshort x,GLshort y)const{if(!this->m_glVertexAttrib2s)this->m_resolveOrThrow(2918);this->m_glVertexAttrib2s(index,x,y);}
+void m_glTexImage3DMultisample_lazy(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{if(!this->m_glTexImage3DMultisample)this->m_resolveOrThrow(2919);this->m_glTexImage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+GLuint m_glGetUniformBlockIndex_lazy(GLuint program,const GLchar* uniformBlockName)const{if(!this->m_glGetUniformBlockIndex)this->m_resolveOrThrow(2920);return this->m_glGetUniformBlockIndex(program,uniformBlockName);}
+GLboolean m_glReleaseKeyedMutexWin32EXT_lazy(GLuint memory,GLuint64 key)const{if(!this->m_glReleaseKeyedMutexWin32EXT)this->m_resolveOrThrow(2921);return this->m_glReleaseKeyedMutexWin32EXT(memory,key);}
+void m_glFrontFace_lazy(GLenum mode)const{if(!this->m_glFrontFace)this->m_resolveOrThrow(2922);this->m_glFrontFace(mode);}
+void m_glEvalCoord1xOES_lazy(GLfixed u)const{if(!this->m_glEvalCoord1xOES)this->m_resolveOrThrow(2923);this->m_glEvalCoord1xOES(u);}
+void m_glDrawArraysInstancedBaseInstance_lazy(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{if(!this->m_glDrawArraysInstancedBaseInstance)this->m_resolveOrThrow(2924);this->m_glDrawArraysInstancedBaseInstance(mode,first,count,instancecount,baseinstance);}
+GLboolean m_glIsPointInStrokePathNV_lazy(GLuint path,GLfloat x,GLfloat y)const{if(!this->m_glIsPointInStrokePathNV)this->m_resolveOrThrow(2925);return this->m_glIsPointInStrokePathNV(path,x,y);}
@@ -1,5864 +0,0 @@
-using MEMBER_FUNCTION_POINTER = void(FunctionTable::*)();
-char const* functionNames[] = {
-  "glMultiDrawArraysIndirectBindlessCountNV",
-  "glTextureParameterfv",
-  "glGetListParameterivSGIX",
-  "glProgramUniform1i64ARB",
-  "glVertexArrayElementBuffer",
-  "glHintPGI",
-  "glStencilMaskSeparate",
-  "glGetFramebufferAttachmentParameterivEXT",
-  "glTextureStorage3DMultisample",
-  "glGetIntegerIndexedvEXT",
-  "glCopyTexImage1D",
-  "glVertexAttrib4usv",
-  "glTexRenderbufferNV",
-  "glVertexAttrib3hvNV",
-  "glProgramUniform4ui64ARB",
-  "glInstrumentsBufferSGIX",
-  "glIndexi",
-  "glMultiTexCoord2sARB",
-  "glProgramEnvParameter4fARB",
-  "glCompressedTexSubImage3D",
-  "glEvalCoord2d",
-  "glEvalCoord2f",
-  "glIndexd",
-  "glSecondaryColor3hvNV",
-  "glIndexf",
-  "glFrustumxOES",
-  "glTextureStorage3DEXT",
-  "glDrawCommandsStatesNV",
-  "glUniform4uiEXT",
-  "glProgramUniform3ui64ARB",
-  "glIndexs",
-  "glVertexArrayBindVertexBufferEXT",
-  "glConvolutionParameteriEXT",
-  "glColor4ubVertex2fSUN",
-  "glProgramUniform1ivEXT",
-  "glGetnMapfv",
-  "glTransformFeedbackBufferRange",
-  "glPathGlyphsNV",
-  "glSecondaryColor3fv",
-  "glGetCombinerInputParameterivNV",
-  "glEndPerfMonitorAMD",
-  "glPointParameterfvARB",
-  "glVertex2xOES",
-  "glDrawElementsInstancedBaseInstance",
-  "glMultTransposeMatrixdARB",
-  "glVertexAttribL4dEXT",
-  "glVertex4iv",
-  "glCoverStrokePathInstancedNV",
-  "glDeformSGIX",
-  "glUniform2ui64NV",
-  "glCopyPathNV",
-  "glVertexAttribP4ui",
-  "glVertexAttribL2d",
-  "glGetMultisamplefv",
-  "glCompressedMultiTexSubImage3DEXT",
-  "glVDPAURegisterOutputSurfaceNV",
-  "glMinSampleShading",
-  "glProgramUniform4fEXT",
-  "glCoverStrokePathNV",
-  "glTextureImage2DMultisampleNV",
-  "glVertex3bOES",
-  "glImportMemoryWin32HandleEXT",
-  "glTessellationFactorAMD",
-  "glDebugMessageControl",
-  "glIsObjectBufferATI",
-  "glPopAttrib",
-  "glProgramUniform4iEXT",
-  "glVertexAttrib4ubNV",
-  "glColorMaterial",
-  "glVertexAttrib2svARB",
-  "glMinSampleShadingARB",
-  "glColor3b",
-  "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
-  "glColor3f",
-  "glVDPAUGetSurfaceivNV",
-  "glColor3d",
-  "glGetnMapiv",
-  "glColor3i",
-  "glGetInternalformatSampleivNV",
-  "glVertexAttrib4ubv",
-  "glColor3s",
-  "glVertexAttribs4hvNV",
-  "glVertexAttrib4NubvARB",
-  "glMultiTexCoord3hvNV",
-  "glMatrixPushEXT",
-  "glProgramUniform2fEXT",
-  "glGetVertexArrayIndexediv",
-  "glBlitFramebuffer",
-  "glMultiTexCoordP2ui",
-  "glColorPointerListIBM",
-  "glVertexAttribL4d",
-  "glGetFragmentMaterialfvSGIX",
-  "glVertex2iv",
-  "glGetTexEnvxvOES",
-  "glUniformMatrix3dv",
-  "glGetVertexAttribLdvEXT",
-  "glTexCoordP3uiv",
-  "glDeformationMap3dSGIX",
-  "glResumeTransformFeedback",
-  "glInsertEventMarkerEXT",
-  "glTessellationModeAMD",
-  "glDrawCommandsAddressNV",
-  "glFogi",
-  "glGetTexParameterxvOES",
-  "glVertexPointer",
-  "glGetPerfMonitorCounterDataAMD",
-  "glFogf",
-  "glMultiTexCoord1d",
-  "glMultiTexCoord1f",
-  "glGetMultiTexParameterivEXT",
-  "glProgramUniformMatrix3x4fvEXT",
-  "glVertexAttribI2i",
-  "glMultiTexCoord1i",
-  "glDeleteSemaphoresEXT",
-  "glLoadProgramNV",
-  "glWriteMaskEXT",
-  "glGetGraphicsResetStatus",
-  "glVertexAttrib1fv",
-  "glMultiTexCoord1s",
-  "glImageTransformParameterfvHP",
-  "glFramebufferTexture2D",
-  "glGetFragmentLightfvSGIX",
-  "glListParameterfSGIX",
-  "glTexCoord3sv",
-  "glNamedFramebufferRenderbufferEXT",
-  "glFragmentLightModelfSGIX",
-  "glIndexPointerEXT",
-  "glBlendEquationSeparateATI",
-  "glVertexArrayAttribIFormat",
-  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
-  "glReplacementCodeubvSUN",
-  "glGenFramebuffers",
-  "glPixelMapx",
-  "glTexSubImage3DEXT",
-  "glGetAttachedShaders",
-  "glGetPixelTexGenParameterfvSGIS",
-  "glReplacementCodeuiNormal3fVertex3fSUN",
-  "glGetDebugMessageLogAMD",
-  "glVertexStream4sATI",
-  "glVertexAttribs4dvNV",
-  "glGetnMapdvARB",
-  "glOrthofOES",
-  "glViewportArrayv",
-  "glDrawElementArrayATI",
-  "glBufferStorageMemEXT",
-  "glGetPathColorGenfvNV",
-  "glWindowPos3iMESA",
-  "glMultiTexCoord2s",
-  "glVertex3dv",
-  "glVertexAttribI3uivEXT",
-  "glUniform3ui64ARB",
-  "glVertexAttrib2fvNV",
-  "glGetNamedBufferSubDataEXT",
-  "glConvolutionFilter2D",
-  "glMemoryBarrierByRegion",
-  "glVertexArrayBindingDivisor",
-  "glMatrixRotatedEXT",
-  "glTexCoord2sv",
-  "glIsProgramNV",
-  "glUniform2dv",
-  "glGetPixelMapuiv",
-  "glDepthBoundsEXT",
-  "glVertexAttrib4hvNV",
-  "glMultiTexParameteriEXT",
-  "glGetPointerv",
-  "glPathCommandsNV",
-  "glGetListParameterfvSGIX",
-  "glGetUniformuiv",
-  "glDebugMessageInsertAMD",
-  "glFrustum",
-  "glVertexAttribL1ui64vNV",
-  "glClearColorxOES",
-  "glProgramUniformMatrix3fv",
-  "glSampleMaskIndexedNV",
-  "glCompileShaderIncludeARB",
-  "glGetArrayObjectfvATI",
-  "glVertexStream4svATI",
-  "glMultiTexCoord4iARB",
-  "glVariantfvEXT",
-  "glMatrixLoadfEXT",
-  "glLoadIdentityDeformationMapSGIX",
-  "glGetRenderbufferParameteriv",
-  "glProgramUniform3fEXT",
-  "glNamedRenderbufferStorage",
-  "glBindFragDataLocation",
-  "glPolygonOffsetClamp",
-  "glFogCoordPointerListIBM",
-  "glFenceSync",
-  "glGetVertexAttribIivEXT",
-  "glFramebufferDrawBuffersEXT",
-  "glVertexAttribs4fvNV",
-  "glPauseTransformFeedbackNV",
-  "glGetQueryObjecti64vEXT",
-  "glVDPAUSurfaceAccessNV",
-  "glValidateProgramPipeline",
-  "glTexPageCommitmentARB",
-  "glWindowPos3dvARB",
-  "glStencilStrokePathInstancedNV",
-  "glFogfv",
-  "glGenQueriesARB",
-  "glProgramUniform2i64NV",
-  "glVertexP4ui",
-  "glVertexStream1ivATI",
-  "glProgramEnvParameterI4iNV",
-  "glGenVertexArraysAPPLE",
-  "glDrawTransformFeedbackInstanced",
-  "glStencilThenCoverStrokePathNV",
-  "glDeleteVertexArraysAPPLE",
-  "glGetNamedBufferParameterui64vNV",
-  "glQueryMatrixxOES",
-  "glSecondaryColor3usv",
-  "glTranslatexOES",
-  "glDrawTransformFeedback",
-  "glTexCoord2fColor4fNormal3fVertex3fvSUN",
-  "glVDPAURegisterVideoSurfaceNV",
-  "glGetTexParameterIuiv",
-  "glBindBufferBaseNV",
-  "glIndexPointer",
-  "glGenQueryResourceTagNV",
-  "glVertexAttrib4Nbv",
-  "glListParameteriSGIX",
-  "glBlendColorxOES",
-  "glUniformui64vNV",
-  "glIsSync",
-  "glGetTextureParameterivEXT",
-  "glFogCoordhvNV",
-  "glFramebufferTextureLayerEXT",
-  "glGetObjectPtrLabel",
-  "glTextureParameteri",
-  "glMultiTexCoord1fARB",
-  "glUniformMatrix2x3dv",
-  "glFramebufferDrawBufferEXT",
-  "glCopyColorSubTable",
-  "glGetNamedFramebufferParameterfvAMD",
-  "glVertexAttribL3d",
-  "glFragmentMaterialfvSGIX",
-  "glMatrixLoadTranspose3x3fNV",
-  "glDeleteNamesAMD",
-  "glDrawRangeElementsEXT",
-  "glOrtho",
-  "glProgramUniform1dvEXT",
-  "glColor4xOES",
-  "glTexImage4DSGIS",
-  "glProgramUniform1ui",
-  "glDeleteBuffersARB",
-  "glUnmapBufferARB",
-  "glCopyTexImage2D",
-  "glMaterialxOES",
-  "glProgramUniformMatrix2x4fvEXT",
-  "glTestObjectAPPLE",
-  "glRenderbufferStorageEXT",
-  "glVertexAttribL1ui64ARB",
-  "glEndFragmentShaderATI",
-  "glPathParameterivNV",
-  "glUniform4uiv",
-  "glFrameZoomSGIX",
-  "glSecondaryColor3fEXT",
-  "glLGPUInterlockNVX",
-  "glVertexAttribL1dv",
-  "glNormalStream3svATI",
-  "glPathStencilFuncNV",
-  "glSetInvariantEXT",
-  "glGetTexBumpParameterivATI",
-  "glBlendEquationSeparateEXT",
-  "glEndOcclusionQueryNV",
-  "glScissorArrayv",
-  "glCallList",
-  "glMapTexture2DINTEL",
-  "glGetVkProcAddrNV",
-  "glPixelTransferxOES",
-  "glDeleteRenderbuffersEXT",
-  "glTexCoord4fColor4fNormal3fVertex4fSUN",
-  "glProgramUniformMatrix4dvEXT",
-  "glGetnColorTable",
-  "glFramebufferTextureLayerARB",
-  "glVertexAttribL2dvEXT",
-  "glGetCombinerStageParameterfvNV",
-  "glMultiTexCoord1xvOES",
-  "glMapBuffer",
-  "glSecondaryColor3d",
-  "glSecondaryColor3f",
-  "glVertexAttribLFormat",
-  "glElementPointerAPPLE",
-  "glVertexStream1fATI",
-  "glCoverageModulationNV",
-  "glSecondaryColor3i",
-  "glDeleteSync",
-  "glGetProgramParameterfvNV",
-  "glMaxShaderCompilerThreadsARB",
-  "glUniformMatrix4x2dv",
-  "glVertexArrayVertexAttribLOffsetEXT",
-  "glSecondaryColor3s",
-  "glIsImageHandleResidentNV",
-  "glUniform3iv",
-  "glVertexAttribL3i64vNV",
-  "glPolygonMode",
-  "glFramebufferSamplePositionsfvAMD",
-  "glConvolutionFilter1DEXT",
-  "glVertexAttrib1dvARB",
-  "glTextureSubImage2DEXT",
-  "glIsVertexArrayAPPLE",
-  "glUseProgram",
-  "glLineStipple",
-  "glMultiTexCoord4fvARB",
-  "glVideoCaptureNV",
-  "glVertexArrayVertexAttribLFormatEXT",
-  "glUniform3fvARB",
-  "glProgramUniformMatrix3x2fvEXT",
-  "glCopyTextureSubImage3DEXT",
-  "glMultiTexCoord2bvOES",
-  "glDeleteObjectARB",
-  "glTextureLightEXT",
-  "glRasterPos3i",
-  "glMultiTexCoord3dARB",
-  "glNamedFramebufferTextureEXT",
-  "glTextureParameteriEXT",
-  "glEvalCoord2xvOES",
-  "glBindVideoCaptureStreamBufferNV",
-  "glTexImage2DMultisampleCoverageNV",
-  "glGetAttribLocationARB",
-  "glDeleteShader",
-  "glVertexAttrib1fARB",
-  "glTexCoord2fColor4ubVertex3fSUN",
-  "glTexCoord4fVertex4fSUN",
-  "glGetMapdv",
-  "glMapParameterfvNV",
-  "glTextureParameterIuiv",
-  "glTransformFeedbackAttribsNV",
-  "glFragmentLightfvSGIX",
-  "glWindowPos3sARB",
-  "glGetConvolutionParameterfv",
-  "glCopyTexSubImage3D",
-  "glVertexAttribI3i",
-  "glCreateShaderObjectARB",
-  "glVertexAttribFormat",
-  "glGetProgramivARB",
-  "glVertexAttribI4usv",
-  "glTexParameterf",
-  "glVertexAttribBinding",
-  "glGetHistogramParameteriv",
-  "glTexParameteri",
-  "glGetShaderSource",
-  "glVertexAttrib4s",
-  "glVertexAttrib4dvNV",
-  "glVertexAttrib1dvNV",
-  "glPopName",
-  "glTextureBufferEXT",
-  "glGetMultiTexImageEXT",
-  "glGetPointerIndexedvEXT",
-  "glIsNameAMD",
-  "glColor4ub",
-  "glBufferParameteriAPPLE",
-  "glColor4ui",
-  "glGetInternalformativ",
-  "glColor4us",
-  "glVertexAttribP1uiv",
-  "glLinkProgram",
-  "glTexCoord3s",
-  "glTexCoord2dv",
-  "glGetObjectLabel",
-  "glVertexPointerEXT",
-  "glDebugMessageCallbackARB",
-  "glGetString",
-  "glGetPathParameterfvNV",
-  "glLightxvOES",
-  "glEndQuery",
-  "glSecondaryColor3uiv",
-  "glPrioritizeTexturesxOES",
-  "glEdgeFlagPointer",
-  "glFramebufferParameteri",
-  "glTexCoord3hNV",
-  "glMultiModeDrawElementsIBM",
-  "glCopyPixels",
-  "glVertexAttribI2ui",
-  "glClampColorARB",
-  "glColorPointervINTEL",
-  "glDeleteTextures",
-  "glGetMinmaxParameterfvEXT",
-  "glWindowPos3sMESA",
-  "glVertexAttrib4f",
-  "glNamedFramebufferParameteri",
-  "glTexCoord2fVertex3fvSUN",
-  "glReplacementCodeusSUN",
-  "glGetNamedFramebufferParameteriv",
-  "glVertexStream1fvATI",
-  "glCreateVertexArrays",
-  "glBeginConditionalRender",
-  "glGetUnsignedBytevEXT",
-  "glConvolutionFilter1D",
-  "glMultiTexCoord3fARB",
-  "glGetQueryObjectuivARB",
-  "glScalexOES",
-  "glSamplerParameteri",
-  "glSamplerParameterf",
-  "glShaderOp1EXT",
-  "glBeginVideoCaptureNV",
-  "glGetnHistogram",
-  "glUniform1d",
-  "glRenderMode",
-  "glClearColorIiEXT",
-  "glSignalSemaphoreEXT",
-  "glGetCompressedTexImage",
-  "glCompressedTextureImage1DEXT",
-  "glGetActiveUniformBlockiv",
-  "glUniform1i",
-  "glMultiDrawArraysIndirectCount",
-  "glGetTexEnvfv",
-  "glColorTableParameterivSGI",
-  "glCullFace",
-  "glDeleteFencesAPPLE",
-  "glProgramUniform4i",
-  "glUniformHandleui64ARB",
-  "glProgramUniform4f",
-  "glViewportIndexedf",
-  "glProgramUniform4d",
-  "glTexCoord1xOES",
-  "glVertexStream3ivATI",
-  "glPointAlongPathNV",
-  "glEndQueryARB",
-  "glVDPAUMapSurfacesNV",
-  "glVertex3i",
-  "glVertexAttrib4uivARB",
-  "glTextureStorageMem3DEXT",
-  "glAttachShader",
-  "glColor4hNV",
-  "glGetFenceivNV",
-  "glTexCoord2fColor4ubVertex3fvSUN",
-  "glGetColorTable",
-  "glFogCoordPointer",
-  "glTexStorageSparseAMD",
-  "glUnmapNamedBuffer",
-  "glTexCoord4bvOES",
-  "glVertexAttrib3fARB",
-  "glRasterPos2xOES",
-  "glCreateMemoryObjectsEXT",
-  "glColor4ubVertex2fvSUN",
-  "glSecondaryColor3dv",
-  "glVertexAttribI4sv",
-  "glDrawTransformFeedbackStreamInstanced",
-  "glMultiTexCoord4ivARB",
-  "glSpriteParameterfSGIX",
-  "glSecondaryColor3sv",
-  "glBindVideoCaptureStreamTextureNV",
-  "glTexParameterIuiv",
-  "glFlushPixelDataRangeNV",
-  "glWindowPos3fv",
-  "glVertexAttribLFormatNV",
-  "glLightModelfv",
-  "glGetColorTableSGI",
-  "glGetCompressedTexImageARB",
-  "glConvolutionParameteri",
-  "glVertexWeighthNV",
-  "glColorMaskIndexedEXT",
-  "glColorMaski",
-  "glColorFragmentOp1ATI",
-  "glVertexAttribI4ubvEXT",
-  "glVertexAttrib1dNV",
-  "glUnmapObjectBufferATI",
-  "glNamedProgramLocalParameterI4uiEXT",
-  "glProgramUniform1iEXT",
-  "glDeleteQueriesARB",
-  "glWindowPos3svARB",
-  "glVertex4s",
-  "glImportMemoryWin32NameEXT",
-  "glStringMarkerGREMEDY",
-  "glIsTransformFeedback",
-  "glProgramUniformMatrix2x3dvEXT",
-  "glGetObjectLabelEXT",
-  "glUniformHandleui64vNV",
-  "glRotated",
-  "glIsProgramPipeline",
-  "glRotatef",
-  "glVertex4i",
-  "glGetActiveSubroutineUniformName",
-  "glVertexAttrib4sNV",
-  "glProgramLocalParameter4dvARB",
-  "glReplacementCodeubSUN",
-  "glMultiDrawElementsIndirectBindlessNV",
-  "glImportSemaphoreWin32HandleEXT",
-  "glUniformMatrix3fv",
-  "glGetnMapfvARB",
-  "glGetnUniformfv",
-  "glVertexAttribL2dv",
-  "glVertexWeightPointerEXT",
-  "glTangent3sEXT",
-  "glSecondaryColorPointer",
-  "glAlphaFunc",
-  "glGetNamedStringARB",
-  "glTexCoord4d",
-  "glBufferPageCommitmentARB",
-  "glProgramLocalParameters4fvEXT",
-  "glStencilFunc",
-  "glSemaphoreParameterui64vEXT",
-  "glGetVertexAttribdvNV",
-  "glTexCoord3dv",
-  "glGetQueryBufferObjectiv",
-  "glTexGenxOES",
-  "glMultiTexCoord1fvARB",
-  "glLightEnviSGIX",
-  "glGetProgramPipelineiv",
-  "glVertexStream2ivATI",
-  "glGetColorTableEXT",
-  "glGetShaderInfoLog",
-  "glGetOcclusionQueryuivNV",
-  "glInvalidateNamedFramebufferSubData",
-  "glVertexAttribL1i64NV",
-  "glVDPAUInitNV",
-  "glVertexAttrib1hvNV",
-  "glVertexAttribI4i",
-  "glRasterPos2iv",
-  "glGetIntegerui64i_vNV",
-  "glUniformHandleui64NV",
-  "glWindowPos3ivMESA",
-  "glBlendEquationSeparate",
-  "glDrawElementsInstancedARB",
-  "glGetSubroutineIndex",
-  "glVertexAttrib2sv",
-  "glSamplePatternSGIS",
-  "glEGLImageTargetRenderbufferStorageOES",
-  "glPushAttrib",
-  "glVertex3hNV",
-  "glRasterPos3xvOES",
-  "glPathParameterfNV",
-  "glGetUniformi64vNV",
-  "glLightiv",
-  "glMaterialxvOES",
-  "glNamedProgramLocalParameter4fEXT",
-  "glVertexAttribL1dEXT",
-  "glGetnUniformdvARB",
-  "glSecondaryColor3bEXT",
-  "glBeginPerfQueryINTEL",
-  "glProgramUniform1uivEXT",
-  "glImageTransformParameterivHP",
-  "glDeleteBuffers",
-  "glBindProgramPipeline",
-  "glScissor",
-  "glProgramUniform4fv",
-  "glGetBooleanv",
-  "glMaterialfv",
-  "glWindowPos4fvMESA",
-  "glVertexAttribIPointerEXT",
-  "glProgramBufferParametersfvNV",
-  "glAlphaFuncxOES",
-  "glMultiDrawArraysIndirectAMD",
-  "glNormalStream3ivATI",
-  "glTextureImage3DMultisampleNV",
-  "glProgramUniform4uivEXT",
-  "glReplacementCodeusvSUN",
-  "glPollInstrumentsSGIX",
-  "glGetTextureLevelParameteriv",
-  "glVertexAttribI2uiv",
-  "glMapControlPointsNV",
-  "glColor4dv",
-  "glInvalidateBufferSubData",
-  "glMultiTexCoord1hNV",
-  "glPointParameterfv",
-  "glUniformMatrix2fvARB",
-  "glUniform2fv",
-  "glVertexPointerListIBM",
-  "glGetMultiTexGenfvEXT",
-  "glGetMinmaxEXT",
-  "glIsFenceNV",
-  "glMatrixFrustumEXT",
-  "glDispatchComputeIndirect",
-  "glQueryResourceNV",
-  "glMultiTexCoord4bOES",
-  "glProgramEnvParameter4dARB",
-  "glProgramUniform1uiEXT",
-  "glBindBufferRange",
-  "glNormal3iv",
-  "glVertexAttribL3dv",
-  "glGetUniformdv",
-  "glGetMultiTexLevelParameterfvEXT",
-  "glFinalCombinerInputNV",
-  "glCullParameterdvEXT",
-  "glMultiTexCoord4s",
-  "glMapVertexAttrib1fAPPLE",
-  "glConvolutionParameterfEXT",
-  "glTexCoord1iv",
-  "glProgramUniform3fvEXT",
-  "glColor3uiv",
-  "glRenderGpuMaskNV",
-  "glListBase",
-  "glTexCoord2bOES",
-  "glBindMaterialParameterEXT",
-  "glGlobalAlphaFactorubSUN",
-  "glVertexAttribL1ui64NV",
-  "glPointParameterfSGIS",
-  "glGetImageTransformParameterivHP",
-  "glColorSubTableEXT",
-  "glPixelTexGenParameterfvSGIS",
-  "glClientWaitSync",
-  "glQueryObjectParameteruiAMD",
-  "glVertexAttribs1fvNV",
-  "glVertexAttrib4NusvARB",
-  "glVariantPointerEXT",
-  "glTextureBuffer",
-  "glVertexAttribI1uiEXT",
-  "glInvalidateTexImage",
-  "glProgramEnvParametersI4ivNV",
-  "glPathGlyphIndexArrayNV",
-  "glCopyImageSubData",
-  "glGetUniformSubroutineuiv",
-  "glBindVertexBuffer",
-  "glMultiTexCoord1iARB",
-  "glDebugMessageInsert",
-  "glBeginVertexShaderEXT",
-  "glIsVariantEnabledEXT",
-  "glPassThroughxOES",
-  "glIsSampler",
-  "glConservativeRasterParameterfNV",
-  "glMultiTexGenivEXT",
-  "glNamedFramebufferTexture2DEXT",
-  "glCopyTexSubImage1D",
-  "glTexCoord1i",
-  "glCheckFramebufferStatus",
-  "glDrawElementArrayAPPLE",
-  "glTexCoord1d",
-  "glTexCoord1f",
-  "glFragmentLightivSGIX",
-  "glBindImageTexture",
-  "glTransformFeedbackVaryings",
-  "glMulticastBufferSubDataNV",
-  "glDrawRangeElements",
-  "glTexCoord1s",
-  "glBindBufferBase",
-  "glColor3bv",
-  "glSyncTextureINTEL",
-  "glCreateSamplers",
-  "glCombinerParameterfNV",
-  "glGetArrayObjectivATI",
-  "glMultiDrawArrays",
-  "glSampleMapATI",
-  "glProgramUniform2i64ARB",
-  "glBinormal3ivEXT",
-  "glMultiDrawArraysIndirectCountARB",
-  "glTextureStorageMem1DEXT",
-  "glWindowPos2ivMESA",
-  "glTexCoordP4ui",
-  "glMultiTexSubImage1DEXT",
-  "glProgramUniformMatrix2x3fvEXT",
-  "glBufferDataARB",
-  "glVertexAttribIFormat",
-  "glCreateFramebuffers",
-  "glNormalStream3dvATI",
-  "glClearAccum",
-  "glUniform3i64vNV",
-  "glNormal3fVertex3fSUN",
-  "glUniform2uivEXT",
-  "glBeginQuery",
-  "glStencilThenCoverStrokePathInstancedNV",
-  "glBindBuffer",
-  "glMap2d",
-  "glMap2f",
-  "glMakeImageHandleResidentNV",
-  "glUniformMatrix2x4fv",
-  "glGetMultiTexParameterfvEXT",
-  "glDepthRangeIndexed",
-  "glIsEnabled",
-  "glMatrixScalefEXT",
-  "glGetError",
-  "glGetTexEnviv",
-  "glBindTextureUnitParameterEXT",
-  "glGetnUniformfvARB",
-  "glReplacementCodeuiNormal3fVertex3fvSUN",
-  "glDeletePerfQueryINTEL",
-  "glActiveVaryingNV",
-  "glGetActiveUniformARB",
-  "glVertexAttribI3ivEXT",
-  "glEvalCoord1d",
-  "glNamedCopyBufferSubDataEXT",
-  "glEvalCoord1f",
-  "glPixelMapfv",
-  "glVertexAttribI1ivEXT",
-  "glCreateSyncFromCLeventARB",
-  "glGetPixelMapusv",
-  "glGetnColorTableARB",
-  "glAccum",
-  "glRasterPos3sv",
-  "glTexCoord2iv",
-  "glBlendFunciARB",
-  "glProgramUniform3i64vARB",
-  "glGetFramebufferAttachmentParameteriv",
-  "glProgramUniform4ui",
-  "glStencilMask",
-  "glResetHistogramEXT",
-  "glLightxOES",
-  "glNamedBufferData",
-  "glVertexStream3sATI",
-  "glVertexAttrib3fvARB",
-  "glClearNamedBufferSubData",
-  "glProgramUniformHandleui64ARB",
-  "glUniform3iARB",
-  "glCreateProgramObjectARB",
-  "glMultiTexCoord1dvARB",
-  "glGetObjectParameterfvARB",
-  "glRectsv",
-  "glMultiTexImage2DEXT",
-  "glProgramUniform1i64NV",
-  "glGetObjectBufferivATI",
-  "glUniform4i64ARB",
-  "glReplacementCodeuiColor4ubVertex3fvSUN",
-  "glBlendFuncSeparateINGR",
-  "glGetVideoCaptureStreamfvNV",
-  "glVertexAttrib2fARB",
-  "glGetTexGeniv",
-  "glPixelStorei",
-  "glGetCompressedTextureSubImage",
-  "glCopyImageSubDataNV",
-  "glActiveShaderProgram",
-  "glVertexStream1iATI",
-  "glPatchParameterfv",
-  "glIsFramebufferEXT",
-  "glTextureStorage2D",
-  "glProgramUniform1ui64ARB",
-  "glTexBufferRange",
-  "glGetPixelTexGenParameterivSGIS",
-  "glTextureSubImage3DEXT",
-  "glClipControl",
-  "glGetProgramResourceiv",
-  "glMultiTexCoordP2uiv",
-  "glVertexAttribI3ui",
-  "glSampleMaskSGIS",
-  "glVertexAttrib4NivARB",
-  "glGlobalAlphaFactorfSUN",
-  "glBlendEquationSeparateIndexedAMD",
-  "glGetPerfCounterInfoINTEL",
-  "glDeleteProgramsNV",
-  "glPixelZoomxOES",
-  "glGetCombinerOutputParameterivNV",
-  "glRasterPos2xvOES",
-  "glGetTexImage",
-  "glVertexArrayVertexBuffers",
-  "glUniform1ui64NV",
-  "glProgramParameteri",
-  "glNormal3xOES",
-  "glGetMapfv",
-  "glVertexStream2dvATI",
-  "glPathStencilDepthOffsetNV",
-  "glIsStateNV",
-  "glGetIntegerui64vNV",
-  "glGetImageTransformParameterfvHP",
-  "glRasterPos2fv",
-  "glVertex3xOES",
-  "glIsMemoryObjectEXT",
-  "glWeightPointerARB",
-  "glFinishFenceNV",
-  "glDepthRangexOES",
-  "glEnableVertexArrayAttribEXT",
-  "glProgramUniform2uivEXT",
-  "glGetDoubleIndexedvEXT",
-  "glWindowPos2fMESA",
-  "glSecondaryColor3b",
-  "glCopyConvolutionFilter1DEXT",
-  "glWindowPos2sv",
-  "glBindFramebufferEXT",
-  "glCreateShader",
-  "glGenPathsNV",
-  "glGenRenderbuffers",
-  "glCopyTexSubImage2D",
-  "glVertexAttrib4ubvARB",
-  "glDrawTextureNV",
-  "glVertexAttribs1svNV",
-  "glClearNamedBufferSubDataEXT",
-  "glBlendFuncSeparate",
-  "glPointParameterfARB",
-  "glTexCoord2fv",
-  "glGetVariantFloatvEXT",
-  "glVertexP2ui",
-  "glWindowPos2dMESA",
-  "glTexCoord4fv",
-  "glBindFragDataLocationEXT",
-  "glCompressedTexSubImage1DARB",
-  "glGetTextureImageEXT",
-  "glFogCoordd",
-  "glPointSize",
-  "glBindTextureUnit",
-  "glProgramEnvParameterI4uiNV",
-  "glGetProgramPipelineInfoLog",
-  "glProgramUniform4i64vARB",
-  "glVertexAttrib4Nuiv",
-  "glGetUniformfvARB",
-  "glWaitSync",
-  "glUniform3i",
-  "glBlendEquationSeparatei",
-  "glVertexAttrib2hvNV",
-  "glTextureParameterivEXT",
-  "glUniform3d",
-  "glUniform3f",
-  "glActiveProgramEXT",
-  "glProgramUniform3uiv",
-  "glUniform3ui64vARB",
-  "glProgramUniform1ui64vARB",
-  "glTextureParameterfEXT",
-  "glSetFragmentShaderConstantATI",
-  "glColorSubTable",
-  "glReplacementCodeuiSUN",
-  "glStateCaptureNV",
-  "glBindAttribLocation",
-  "glWeightusvARB",
-  "glGetFragDataIndex",
-  "glMultiTexCoord2xOES",
-  "glColor3sv",
-  "glTexCoord2fVertex3fSUN",
-  "glGetMemoryObjectParameterivEXT",
-  "glPolygonOffsetEXT",
-  "glWeightPathsNV",
-  "glCombinerStageParameterfvNV",
-  "glPointParameterfEXT",
-  "glCopyTexImage1DEXT",
-  "glVertex4sv",
-  "glMatrixMultfEXT",
-  "glCompressedTextureSubImage3DEXT",
-  "glGetTexLevelParameterxvOES",
-  "glVertexAttribL3dvEXT",
-  "glMultiTexCoordP4ui",
-  "glGetTextureLevelParameterivEXT",
-  "glAlphaFragmentOp2ATI",
-  "glDeleteFramebuffers",
-  "glDrawArrays",
-  "glGetTransformFeedbackiv",
-  "glGetnTexImageARB",
-  "glClear",
-  "glVertexArrayParameteriAPPLE",
-  "glMultiTexCoord2dvARB",
-  "glGetVideoCaptureStreamdvNV",
-  "glFragmentLightModelivSGIX",
-  "glVertexAttribP2ui",
-  "glMultiTexCoordPointerEXT",
-  "glProgramUniform3iEXT",
-  "glTranslatef",
-  "glVertexAttrib4Nub",
-  "glTranslated",
-  "glSamplerParameterIiv",
-  "glTexCoord4hNV",
-  "glDrawElementsIndirect",
-  "glDeletePerfMonitorsAMD",
-  "glIsRenderbufferEXT",
-  "glDrawCommandsNV",
-  "glUniform3ivARB",
-  "glBufferSubData",
-  "glSecondaryColor3bv",
-  "glMatrixMultTransposedEXT",
-  "glRequestResidentProgramsNV",
-  "glAlphaFragmentOp1ATI",
-  "glGetQueryObjecti64v",
-  "glMatrixMult3x3fNV",
-  "glColorTableParameteriv",
-  "glPathSubCommandsNV",
-  "glGetFinalCombinerInputParameterivNV",
-  "glIsRenderbuffer",
-  "glVertex3iv",
-  "glTexGenfv",
-  "glFrustumfOES",
-  "glBindVertexBuffers",
-  "glMateriali",
-  "glMultiTexCoord2svARB",
-  "glDisableVertexAttribArray",
-  "glWindowPos3ivARB",
-  "glTexCoordFormatNV",
-  "glBlitNamedFramebuffer",
-  "glMatrixLoadTransposefEXT",
-  "glMultiTexGenfEXT",
-  "glShaderStorageBlockBinding",
-  "glMaterialf",
-  "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
-  "glCheckNamedFramebufferStatusEXT",
-  "glVertexArrayVertexAttribFormatEXT",
-  "glVertex2hNV",
-  "glDeleteVertexShaderEXT",
-  "glTexImage3DEXT",
-  "glSignalVkFenceNV",
-  "glProgramLocalParameterI4ivNV",
-  "glGlobalAlphaFactoriSUN",
-  "glTextureStorage1D",
-  "glBinormal3sEXT",
-  "glGetProgramInterfaceiv",
-  "glMatrixIndexPointerARB",
-  "glTexCoordPointerEXT",
-  "glMultiTexGeniEXT",
-  "glVertexAttrib2fNV",
-  "glNamedProgramStringEXT",
-  "glMapNamedBuffer",
-  "glGetMinmaxParameteriv",
-  "glGetnUniformdv",
-  "glEndConditionalRenderNVX",
-  "glBinormal3fEXT",
-  "glNormalStream3iATI",
-  "glProgramBufferParametersIivNV",
-  "glMapGrid1xOES",
-  "glGetVertexAttribPointervARB",
-  "glFlushMappedNamedBufferRangeEXT",
-  "glGetVertexAttribIiv",
-  "glVertexP4uiv",
-  "glUniformui64NV",
-  "glColor4fv",
-  "glTexParameterxvOES",
-  "glPatchParameteri",
-  "glMap1d",
-  "glGetTexFilterFuncSGIS",
-  "glVertexStream3dATI",
-  "glVertexArrayVertexBindingDivisorEXT",
-  "glMultiTexCoord3svARB",
-  "glBindProgramNV",
-  "glGetConvolutionParameteriv",
-  "glGetProgramLocalParameterfvARB",
-  "glGenFragmentShadersATI",
-  "glTexBumpParameterivATI",
-  "glGetNamedFramebufferAttachmentParameteriv",
-  "glGetnSeparableFilter",
-  "glNormal3xvOES",
-  "glPassTexCoordATI",
-  "glFramebufferTextureFaceARB",
-  "glProgramUniform1dv",
-  "glTextureStorage2DEXT",
-  "glVertexArrayFogCoordOffsetEXT",
-  "glDeleteNamedStringARB",
-  "glMulticastGetQueryObjecti64vNV",
-  "glGenOcclusionQueriesNV",
-  "glLighti",
-  "glTexImage1D",
-  "glLightf",
-  "glClientAttribDefaultEXT",
-  "glVertexAttrib4bvARB",
-  "glVertexAttribIFormatNV",
-  "glStencilFuncSeparate",
-  "glGetVertexAttribfvARB",
-  "glVertexAttrib2dNV",
-  "glProgramUniform2iEXT",
-  "glClientActiveVertexStreamATI",
-  "glRasterPos3xOES",
-  "glGetMapParameterivNV",
-  "glSampleCoverage",
-  "glClearDepthxOES",
-  "glUniformBufferEXT",
-  "glTexCoord2fNormal3fVertex3fvSUN",
-  "glMulticastGetQueryObjectuivNV",
-  "glGetFirstPerfQueryIdINTEL",
-  "glUnmapNamedBufferEXT",
-  "glGetTransformFeedbacki_v",
-  "glUniform4fvARB",
-  "glRenderbufferStorageMultisampleCoverageNV",
-  "glGetFloati_vEXT",
-  "glBindAttribLocationARB",
-  "glBufferAddressRangeNV",
-  "glGenProgramsARB",
-  "glMultiTexEnvivEXT",
-  "glSecondaryColor3uiEXT",
-  "glCompressedTextureImage2DEXT",
-  "glUniform2i",
-  "glCopyTexImage2DEXT",
-  "glUniform2d",
-  "glVertexAttribL1d",
-  "glFramebufferTextureFaceEXT",
-  "glFramebufferTextureLayer",
-  "glMultiTexCoord4bvOES",
-  "glGetVertexArrayPointeri_vEXT",
-  "glNamedProgramLocalParameter4dEXT",
-  "glBinormal3bEXT",
-  "glConvolutionFilter2DEXT",
-  "glProgramUniform2fv",
-  "glColor3fVertex3fSUN",
-  "glNormal3fVertex3fvSUN",
-  "glCopyMultiTexSubImage3DEXT",
-  "glProgramLocalParameterI4iNV",
-  "glProgramUniformMatrix2x4dv",
-  "glPathMemoryGlyphIndexArrayNV",
-  "glDrawArraysEXT",
-  "glBlendEquationEXT",
-  "glStencilOp",
-  "glCopyTextureSubImage2DEXT",
-  "glTexEnvf",
-  "glVertexAttrib2dvNV",
-  "glGenPerfMonitorsAMD",
-  "glGetInteger64i_v",
-  "glGetHistogramParameterfv",
-  "glVertexFormatNV",
-  "glBlendFuncIndexedAMD",
-  "glTexEnvi",
-  "glMultiTexCoord1iv",
-  "glIsEnabledi",
-  "glVertexAttribL2ui64vNV",
-  "glVertexAttribL4i64NV",
-  "glMatrixTranslatedEXT",
-  "glMakeTextureHandleResidentARB",
-  "glMatrixMultdEXT",
-  "glBinormal3dvEXT",
-  "glImportSyncEXT",
-  "glGetMapiv",
-  "glImportSemaphoreFdEXT",
-  "glMultiTexCoord4sv",
-  "glPNTrianglesiATI",
-  "glBindVertexArrayAPPLE",
-  "glObjectPtrLabel",
-  "glGetDebugMessageLog",
-  "glTrackMatrixNV",
-  "glProgramPathFragmentInputGenNV",
-  "glTangent3ivEXT",
-  "glGetUniformfv",
-  "glSecondaryColor3ubv",
-  "glMakeTextureHandleNonResidentNV",
-  "glVertexAttribs4ubvNV",
-  "glClipPlanexOES",
-  "glMultiTexCoord3iv",
-  "glGetnPolygonStippleARB",
-  "glUniform2i64vNV",
-  "glLightModelf",
-  "glDeleteMemoryObjectsEXT",
-  "glMultiTexSubImage2DEXT",
-  "glReplacementCodeuiColor3fVertex3fSUN",
-  "glTangent3dvEXT",
-  "glLightModeli",
-  "glVertexWeighthvNV",
-  "glWindowPos3iv",
-  "glMultiTexCoordP1uiv",
-  "glTransformPathNV",
-  "glProgramNamedParameter4dNV",
-  "glMultiDrawElementsIndirect",
-  "glProgramUniform1dEXT",
-  "glCallLists",
-  "glNormal3hvNV",
-  "glGetCombinerOutputParameterfvNV",
-  "glVertexAttrib4sARB",
-  "glTexCoord3i",
-  "glVertexAttribI3uiv",
-  "glPushDebugGroup",
-  "glTexCoord3f",
-  "glTexCoord3d",
-  "glTexCoord2xOES",
-  "glGetStageIndexNV",
-  "glProgramUniform4i64vNV",
-  "glGetNamedBufferPointervEXT",
-  "glTextureBarrierNV",
-  "glColor4ubVertex3fvSUN",
-  "glGetCommandHeaderNV",
-  "glGetPerfMonitorCounterInfoAMD",
-  "glVertexAttrib1svARB",
-  "glCombinerParameteriNV",
-  "glMatrixMultTransposefEXT",
-  "glDetailTexFuncSGIS",
-  "glAreTexturesResident",
-  "glProgramUniform2d",
-  "glGetConvolutionParameterfvEXT",
-  "glIndexPointerListIBM",
-  "glVertexAttribI4iEXT",
-  "glProgramUniform2f",
-  "glRasterPos4sv",
-  "glColor4s",
-  "glMulticastGetQueryObjectivNV",
-  "glColorFragmentOp3ATI",
-  "glResizeBuffersMESA",
-  "glGetMinmaxParameterfv",
-  "glClientActiveTextureARB",
-  "glBindVertexArray",
-  "glColor4b",
-  "glColor4f",
-  "glColor4d",
-  "glColor4i",
-  "glEdgeFlagFormatNV",
-  "glNamedBufferSubData",
-  "glDrawElementsInstanced",
-  "glGetMultiTexParameterIivEXT",
-  "glVertex2dv",
-  "glDisableVertexArrayAttribEXT",
-  "glObjectUnpurgeableAPPLE",
-  "glVertexAttribs2dvNV",
-  "glReplacementCodeuiTexCoord2fVertex3fSUN",
-  "glGetMapParameterfvNV",
-  "glProgramUniform4ivEXT",
-  "glProgramUniform3ui64vNV",
-  "glRectfv",
-  "glTexFilterFuncSGIS",
-  "glSpriteParameterfvSGIX",
-  "glCopyMultiTexImage1DEXT",
-  "glGetVertexAttribIuivEXT",
-  "glUniformMatrix2x4dv",
-  "glGetProgramResourceLocationIndex",
-  "glColor3hNV",
-  "glViewport",
-  "glProgramNamedParameter4fNV",
-  "glGetInvariantBooleanvEXT",
-  "glTexStorage2DMultisample",
-  "glPixelStorex",
-  "glVertexAttribL1dvEXT",
-  "glGetActiveSubroutineUniformiv",
-  "glVertexAttribPointerARB",
-  "glCompressedTexSubImage2DARB",
-  "glTexStorageMem1DEXT",
-  "glVertex2hvNV",
-  "glTexBuffer",
-  "glArrayElement",
-  "glValidateProgram",
-  "glPixelStoref",
-  "glWindowPos3dARB",
-  "glEvalCoord1dv",
-  "glVertexAttribs2fvNV",
-  "glRecti",
-  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
-  "glTexCoord1bOES",
-  "glProgramUniform2i64vARB",
-  "glWindowPos2dARB",
-  "glGetProgramParameterdvNV",
-  "glRectf",
-  "glRectd",
-  "glMap1xOES",
-  "glVertexAttrib3fvNV",
-  "glReferencePlaneSGIX",
-  "glMulticastBlitFramebufferNV",
-  "glGetCombinerInputParameterfvNV",
-  "glGetTextureSamplerHandleARB",
-  "glBindTexture",
-  "glRects",
-  "glGetActiveAttribARB",
-  "glHistogramEXT",
-  "glGetTextureSamplerHandleNV",
-  "glDetachShader",
-  "glFinishTextureSUNX",
-  "glUniformMatrix3x4dv",
-  "glVertexAttrib4fARB",
-  "glGetPathColorGenivNV",
-  "glGetProgramResourceLocation",
-  "glVertexArrayAttribLFormat",
-  "glGetTexLevelParameterfv",
-  "glVertexArrayVertexAttribOffsetEXT",
-  "glIndexFormatNV",
-  "glMultiTexCoord3i",
-  "glReplacementCodeuiVertex3fvSUN",
-  "glViewportIndexedfv",
-  "glBindBuffersBase",
-  "glTexBumpParameterfvATI",
-  "glMatrixIndexuivARB",
-  "glVertexAttrib1hNV",
-  "glWindowPos3svMESA",
-  "glStencilOpSeparateATI",
-  "glDrawElementsBaseVertex",
-  "glBlendEquationSeparateiARB",
-  "glVertexAttrib1fNV",
-  "glMapVertexAttrib2fAPPLE",
-  "glCompressedTextureSubImage1DEXT",
-  "glClearBufferSubData",
-  "glTexStorage1D",
-  "glVertexAttribI3iEXT",
-  "glMakeTextureHandleNonResidentARB",
-  "glMultiDrawElementArrayAPPLE",
-  "glVertexStream4dATI",
-  "glProgramUniformMatrix2dvEXT",
-  "glVertexAttribs2hvNV",
-  "glGetUniformiv",
-  "glClipPlanefOES",
-  "glRenderbufferStorage",
-  "glUniform4ui",
-  "glBindFramebuffer",
-  "glValidateProgramARB",
-  "glTexGenf",
-  "glTexGend",
-  "glTexGeni",
-  "glDeleteFramebuffersEXT",
-  "glResetMinmaxEXT",
-  "glVertexAttrib1fvNV",
-  "glIsQueryARB",
-  "glEnableVariantClientStateEXT",
-  "glScissorIndexed",
-  "glGetInvariantIntegervEXT",
-  "glProgramLocalParameterI4uiNV",
-  "glConvolutionParameterxvOES",
-  "glGenFramebuffersEXT",
-  "glVertexArrayColorOffsetEXT",
-  "glMultiTexCoord3ivARB",
-  "glVertexWeightfEXT",
-  "glRasterPos4dv",
-  "glIsTextureHandleResidentARB",
-  "glRasterPos2dv",
-  "glWindowPos4ivMESA",
-  "glGetVariantPointervEXT",
-  "glMapNamedBufferRangeEXT",
-  "glGetnUniformui64vARB",
-  "glCreateShaderProgramv",
-  "glGetQueryObjectiv",
-  "glMaxShaderCompilerThreadsKHR",
-  "glPNTrianglesfATI",
-  "glGlobalAlphaFactorusSUN",
-  "glVertexAttrib3dvNV",
-  "glMultiTexCoord3sARB",
-  "glGenerateMipmap",
-  "glCompressedTextureSubImage2D",
-  "glNamedRenderbufferStorageMultisampleEXT",
-  "glPolygonOffsetClampEXT",
-  "glTextureRangeAPPLE",
-  "glBlendEquationIndexedAMD",
-  "glTexCoord2d",
-  "glPointParameteri",
-  "glTexCoord2f",
-  "glGetUnsignedBytei_vEXT",
-  "glColor4iv",
-  "glMapNamedBufferRange",
-  "glUnmapBuffer",
-  "glSampleMaskEXT",
-  "glTexCoord2i",
-  "glTexCoord1xvOES",
-  "glVertexAttrib1sARB",
-  "glGetVertexArrayiv",
-  "glProgramParameter4dvNV",
-  "glTexCoord2s",
-  "glTextureParameterIuivEXT",
-  "glGetColorTableParameterfvSGI",
-  "glTexCoord4dv",
-  "glVertexAttrib1svNV",
-  "glNamedFramebufferTextureFaceEXT",
-  "glProgramUniform2ui64vNV",
-  "glStencilFillPathNV",
-  "glNormal3dv",
-  "glReleaseShaderCompiler",
-  "glTexStorageMem3DEXT",
-  "glTexCoord3bvOES",
-  "glIsVertexAttribEnabledAPPLE",
-  "glTexCoord1dv",
-  "glReadPixels",
-  "glVertexAttribI3iv",
-  "glSetFenceAPPLE",
-  "glWeightsvARB",
-  "glShadeModel",
-  "glTextureStorageMem3DMultisampleEXT",
-  "glMapGrid1d",
-  "glGetHistogramParameterivEXT",
-  "glConservativeRasterParameteriNV",
-  "glClearNamedBufferData",
-  "glClearDepthf",
-  "glCreatePerfQueryINTEL",
-  "glFogCoordfEXT",
-  "glVertexAttrib2dARB",
-  "glMultiTexCoord4dARB",
-  "glReadnPixelsARB",
-  "glMultiTexBufferEXT",
-  "glWindowPos4dvMESA",
-  "glInvalidateNamedFramebufferData",
-  "glSecondaryColorPointerListIBM",
-  "glRectiv",
-  "glColorP4ui",
-  "glUseProgramStages",
-  "glRasterPos3dv",
-  "glPathTexGenNV",
-  "glVertexBlendEnviATI",
-  "glUniform3i64ARB",
-  "glLoadMatrixf",
-  "glProgramUniform2dEXT",
-  "glVertexAttribI4iv",
-  "glNamedFramebufferDrawBuffer",
-  "glColor4ubv",
-  "glColor3hvNV",
-  "glGetMapAttribParameterfvNV",
-  "glGetBufferSubData",
-  "glGetVertexAttribLdv",
-  "glGetnUniformuiv",
-  "glGetUniformui64vNV",
-  "glNamedRenderbufferStorageEXT",
-  "glVertexAttrib3dNV",
-  "glTextureStorage1DEXT",
-  "glPixelTexGenParameteriSGIS",
-  "glColorTableEXT",
-  "glGenBuffers",
-  "glMultiTexCoord3xvOES",
-  "glExecuteProgramNV",
-  "glVariantArrayObjectATI",
-  "glColor3xvOES",
-  "glGetnConvolutionFilterARB",
-  "glNormalFormatNV",
-  "glGetInvariantFloatvEXT",
-  "glClearNamedFramebufferiv",
-  "glTexImage3D",
-  "glGenSamplers",
-  "glIsFramebuffer",
-  "glProgramUniform3dvEXT",
-  "glGetVertexAttribfvNV",
-  "glDrawRangeElementArrayAPPLE",
-  "glUniform3i64NV",
-  "glMatrixPopEXT",
-  "glVertexStream1sATI",
-  "glGetnPixelMapuivARB",
-  "glMultiTexEnviEXT",
-  "glVertexAttribI2iEXT",
-  "glProgramParameter4fvNV",
-  "glWaitSemaphoreEXT",
-  "glNamedFramebufferSampleLocationsfvNV",
-  "glTexCoordP4uiv",
-  "glRectxvOES",
-  "glGetVariantIntegervEXT",
-  "glDeleteLists",
-  "glTexGendv",
-  "glVertexP2uiv",
-  "glGetPerfMonitorGroupsAMD",
-  "glMultTransposeMatrixfARB",
-  "glVertexAttribI2ivEXT",
-  "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
-  "glDeleteStatesNV",
-  "glGetBufferParameteri64v",
-  "glProgramUniform4dv",
-  "glEdgeFlagPointerEXT",
-  "glVideoCaptureStreamParameterivNV",
-  "glVertexStream4iATI",
-  "glVDPAUFiniNV",
-  "glMakeBufferNonResidentNV",
-  "glUniform1ui64ARB",
-  "glStencilStrokePathNV",
-  "glVariantuivEXT",
-  "glCopyTexSubImage3DEXT",
-  "glSpriteParameteriSGIX",
-  "glMultiTexCoord1sARB",
-  "glConvolutionParameterfv",
-  "glMakeTextureHandleResidentNV",
-  "glMultMatrixxOES",
-  "glTextureNormalEXT",
-  "glGetQueryivARB",
-  "glCompressedMultiTexImage3DEXT",
-  "glGetInstrumentsSGIX",
-  "glProgramUniformMatrix4x3fvEXT",
-  "glPointParameterf",
-  "glProgramUniform3dEXT",
-  "glMultiTexCoord2hNV",
-  "glGetConvolutionFilterEXT",
-  "glVertexAttrib2hNV",
-  "glCurrentPaletteMatrixARB",
-  "glFogxvOES",
-  "glCreateRenderbuffers",
-  "glVertexAttrib4Nusv",
-  "glCombinerInputNV",
-  "glDepthFunc",
-  "glWindowPos4fMESA",
-  "glEnableClientStateIndexedEXT",
-  "glTexCoord4iv",
-  "glProgramUniform4i64ARB",
-  "glBlendFunci",
-  "glResolveDepthValuesNV",
-  "glTextureColorMaskSGIS",
-  "glCreateShaderProgramEXT",
-  "glBufferStorage",
-  "glMakeNamedBufferNonResidentNV",
-  "glRenderbufferStorageMultisampleEXT",
-  "glGetFloati_v",
-  "glUniform2ui64ARB",
-  "glVertex3fv",
-  "glGetUniformLocation",
-  "glVertexStream1svATI",
-  "glVertexStream3fATI",
-  "glNamedFramebufferDrawBuffers",
-  "glUniform2ui64vNV",
-  "glTexCoordPointervINTEL",
-  "glUniform4fv",
-  "glNormalPointerEXT",
-  "glVertexAttrib4hNV",
-  "glNormal3f",
-  "glVertexStream2iATI",
-  "glVertexAttribP4uiv",
-  "glCompressedTextureSubImage3D",
-  "glAsyncMarkerSGIX",
-  "glTextureStorageSparseAMD",
-  "glGetConvolutionParameterivEXT",
-  "glEndPerfQueryINTEL",
-  "glFragmentLightModeliSGIX",
-  "glPrioritizeTexturesEXT",
-  "glEndConditionalRender",
-  "glEnableClientState",
-  "glResetHistogram",
-  "glGetOcclusionQueryivNV",
-  "glUniform1uiEXT",
-  "glMultiTexCoord2sv",
-  "glTexSubImage2DEXT",
-  "glProgramUniform2uiv",
-  "glMultiTexCoord2iARB",
-  "glGetQueryObjectuiv",
-  "glGenerateMultiTexMipmapEXT",
-  "glVertexAttrib4iv",
-  "glWindowPos3dvMESA",
-  "glLabelObjectEXT",
-  "glProgramUniform1uiv",
-  "glFramebufferTexture",
-  "glMultiTexEnvfEXT",
-  "glGetTexGendv",
-  "glVertex4xOES",
-  "glVertexAttribI2uivEXT",
-  "glNamedProgramLocalParameter4fvEXT",
-  "glColor3usv",
-  "glGetPixelTransformParameterfvEXT",
-  "glIndexxvOES",
-  "glDepthMask",
-  "glProgramUniformMatrix2x4fv",
-  "glAreProgramsResidentNV",
-  "glColorTable",
-  "glBeginQueryIndexed",
-  "glVertexStream1dvATI",
-  "glGetMultiTexEnvfvEXT",
-  "glDeleteFencesNV",
-  "glVertexAttribs1dvNV",
-  "glBufferStorageExternalEXT",
-  "glVertexStream2sATI",
-  "glGetnSeparableFilterARB",
-  "glProgramUniform2dv",
-  "glActiveStencilFaceEXT",
-  "glProgramUniform4dEXT",
-  "glPointSizexOES",
-  "glRasterPos2sv",
-  "glBindParameterEXT",
-  "glTexCoord1sv",
-  "glBlendParameteriNV",
-  "glNamedProgramLocalParameter4dvEXT",
-  "glProgramUniformHandleui64NV",
-  "glGetTextureParameterfvEXT",
-  "glGetPathMetricsNV",
-  "glVertex2i",
-  "glNewList",
-  "glMatrixLoad3x3fNV",
-  "glMultiTexCoord2fARB",
-  "glWeightdvARB",
-  "glIsTransformFeedbackNV",
-  "glVertexAttribDivisorARB",
-  "glSecondaryColorP3uiv",
-  "glGetnCompressedTexImageARB",
-  "glGetIntegerv",
-  "glMatrixLoaddEXT",
-  "glGetPathLengthNV",
-  "glProgramUniformMatrix3dv",
-  "glUniform4i64NV",
-  "glGetHistogramEXT",
-  "glVertexAttrib4NuivARB",
-  "glMapGrid2xOES",
-  "glTexImage2D",
-  "glWindowPos2fvARB",
-  "glEnableIndexedEXT",
-  "glTexCoord1bvOES",
-  "glDrawPixels",
-  "glMultMatrixd",
-  "glMultMatrixf",
-  "glReplacementCodePointerSUN",
-  "glLoadTransposeMatrixdARB",
-  "glVertexAttrib4Nubv",
-  "glVertexArrayVertexAttribIOffsetEXT",
-  "glCompileShaderARB",
-  "glWindowPos3dMESA",
-  "glNormalStream3fvATI",
-  "glColor4usv",
-  "glMapGrid1f",
-  "glPolygonStipple",
-  "glUniform4ui64ARB",
-  "glTextureRenderbufferEXT",
-  "glGetSubroutineUniformLocation",
-  "glGetFramebufferParameteriv",
-  "glPixelMapusv",
-  "glGetSamplerParameteriv",
-  "glVertexStream2fvATI",
-  "glProgramStringARB",
-  "glProgramUniformMatrix3dvEXT",
-  "glSeparableFilter2D",
-  "glVertexAttribI1uiv",
-  "glLGPUCopyImageSubDataNVX",
-  "glTexStorage2D",
-  "glColor3fv",
-  "glGetMultiTexGendvEXT",
-  "glVertexAttribL4dvEXT",
-  "glGetActiveUniform",
-  "glUniform2ui64vARB",
-  "glMakeNamedBufferResidentNV",
-  "glPathGlyphIndexRangeNV",
-  "glColorPointer",
-  "glProgramEnvParameterI4ivNV",
-  "glMulticastGetQueryObjectui64vNV",
-  "glMultiTexParameterfEXT",
-  "glNamedFramebufferTextureLayer",
-  "glGetVertexArrayIntegervEXT",
-  "glVertexAttrib3dARB",
-  "glVDPAUIsSurfaceNV",
-  "glMultiTexImage1DEXT",
-  "glIsAsyncMarkerSGIX",
-  "glGetDoublei_vEXT",
-  "glUniform2i64NV",
-  "glIsCommandListNV",
-  "glUniform3uiEXT",
-  "glTexParameterIuivEXT",
-  "glProgramUniformMatrix4fv",
-  "glVertex2fv",
-  "glVertexAttribL3dEXT",
-  "glFramebufferRenderbuffer",
-  "glGetUniformLocationARB",
-  "glPathParameterfvNV",
-  "glVertexAttrib3sNV",
-  "glGetDoublei_v",
-  "glVertexAttrib1sv",
-  "glBindSampler",
-  "glLineWidth",
-  "glVertexArrayRangeAPPLE",
-  "glBindBufferOffsetEXT",
-  "glWeightfvARB",
-  "glGetIntegeri_v",
-  "glGetTransformFeedbackVarying",
-  "glProgramLocalParameter4fvARB",
-  "glGetTransformFeedbackVaryingNV",
-  "glWindowPos2iv",
-  "glVertexStream1dATI",
-  "glColorFragmentOp2ATI",
-  "glFogiv",
-  "glGetTextureHandleNV",
-  "glLightModeliv",
-  "glDepthRangef",
-  "glGetFragmentMaterialivSGIX",
-  "glVideoCaptureStreamParameterfvNV",
-  "glDeleteProgramsARB",
-  "glWindowPos3fvARB",
-  "glFeedbackBufferxOES",
-  "glGetTexBumpParameterfvATI",
-  "glEnablei",
-  "glGetActiveSubroutineName",
-  "glDrawBuffersARB",
-  "glBindProgramARB",
-  "glEvalCoord1fv",
-  "glProgramUniform3ui64vARB",
-  "glProgramUniformMatrix2dv",
-  "glMultiTexCoord2hvNV",
-  "glGetFloatIndexedvEXT",
-  "glSampleCoverageARB",
-  "glProgramUniform2ui64vARB",
-  "glPixelDataRangeNV",
-  "glVertexStream3svATI",
-  "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
-  "glTexCoord3hvNV",
-  "glSampleMaski",
-  "glIndexFuncEXT",
-  "glPointParameteriNV",
-  "glUniformMatrix3x2fv",
-  "glGetFramebufferParameterivEXT",
-  "glUniform2i64ARB",
-  "glNamedBufferStorageEXT",
-  "glNamedFramebufferTexture3DEXT",
-  "glVertexAttrib2dv",
-  "glGetVertexArrayPointervEXT",
-  "glGetVertexAttribArrayObjectivATI",
-  "glProgramUniformMatrix3fvEXT",
-  "glEnableVertexArrayEXT",
-  "glColorTableParameterfvSGI",
-  "glEdgeFlag",
-  "glFogCoordf",
-  "glVertex3d",
-  "glVertex3f",
-  "glSpriteParameterivSGIX",
-  "glPathGlyphRangeNV",
-  "glPrimitiveBoundingBoxARB",
-  "glVertexAttribL3ui64vNV",
-  "glVertex3s",
-  "glTexCoordP2ui",
-  "glProgramUniform2fvEXT",
-  "glDeletePathsNV",
-  "glPrimitiveRestartIndexNV",
-  "glTexCoord2fColor3fVertex3fvSUN",
-  "glTexCoordPointerListIBM",
-  "glRectxOES",
-  "glCopyNamedBufferSubData",
-  "glGenProgramsNV",
-  "glFragmentLightfSGIX",
-  "glTexStorage3D",
-  "glTextureParameteriv",
-  "glNamedBufferDataEXT",
-  "glImportSemaphoreWin32NameEXT",
-  "glMultiTexCoord3fvARB",
-  "glUniformMatrix3x4fv",
-  "glSubpixelPrecisionBiasNV",
-  "glNormalPointer",
-  "glNamedFramebufferTexture",
-  "glVertexAttrib4NsvARB",
-  "glPassThrough",
-  "glSecondaryColorP3ui",
-  "glInvalidateTexSubImage",
-  "glIsImageHandleResidentARB",
-  "glTangent3fvEXT",
-  "glProgramUniformMatrix4x3fv",
-  "glBegin",
-  "glEvalCoord2dv",
-  "glColor3ubv",
-  "glFogCoordfvEXT",
-  "glVertexP3ui",
-  "glLightfv",
-  "glVertexAttribL3i64NV",
-  "glStencilClearTagEXT",
-  "glGetActiveUniformName",
-  "glTangentPointerEXT",
-  "glUniform4ui64vNV",
-  "glDebugMessageEnableAMD",
-  "glProgramUniform2ui",
-  "glCopyTexSubImage2DEXT",
-  "glGenRenderbuffersEXT",
-  "glNamedProgramLocalParameterI4ivEXT",
-  "glMultiTexCoord2f",
-  "glMapGrid2d",
-  "glGetMultiTexParameterIuivEXT",
-  "glBlendEquationiARB",
-  "glTexParameteriv",
-  "glUniform4ivARB",
-  "glMatrixOrthoEXT",
-  "glVertexArrayVertexBuffer",
-  "glProgramLocalParametersI4ivNV",
-  "glProgramUniform4ui64vNV",
-  "glGetNamedStringivARB",
-  "glVertexAttribL1i64vNV",
-  "glTransformFeedbackBufferBase",
-  "glIndexsv",
-  "glPointParameterivNV",
-  "glGetDetailTexFuncSGIS",
-  "glReplacementCodeuiColor3fVertex3fvSUN",
-  "glProgramLocalParameter4fARB",
-  "glBitmap",
-  "glNamedFramebufferTextureLayerEXT",
-  "glMultiTexGenfvEXT",
-  "glGetNamedBufferSubData",
-  "glStencilFuncSeparateATI",
-  "glProgramUniform2iv",
-  "glGetQueryiv",
-  "glTexCoord4f",
-  "glMapGrid2f",
-  "glListParameterivSGIX",
-  "glCreateQueries",
-  "glGetSamplerParameterfv",
-  "glTexCoord4i",
-  "glObjectLabel",
-  "glProgramUniform3i64NV",
-  "glGetTextureHandleARB",
-  "glTexCoord4s",
-  "glUniform4iARB",
-  "glGetUniformIndices",
-  "glMultiTexImage3DEXT",
-  "glCoverageModulationTableNV",
-  "glPointParameteriv",
-  "glMultiTexCoord4svARB",
-  "glNormal3fv",
-  "glProgramUniformMatrix3x4dvEXT",
-  "glTexCoord1fv",
-  "glProgramUniformMatrix4x3dvEXT",
-  "glGetActiveVaryingNV",
-  "glUniform1i64vARB",
-  "glMultiTexCoord1dv",
-  "glTexCoord3fv",
-  "glMatrixTranslatefEXT",
-  "glProgramUniform1ui64vNV",
-  "glTextureMaterialEXT",
-  "glMultiTexCoordP3uiv",
-  "glVertexAttribP3ui",
-  "glInterpolatePathsNV",
-  "glTextureBufferRange",
-  "glVertexAttribL2dEXT",
-  "glGetPixelTransformParameterivEXT",
-  "glTexCoord4xvOES",
-  "glGetVariantBooleanvEXT",
-  "glDepthRange",
-  "glGetVertexAttribdvARB",
-  "glGetColorTableParameterfv",
-  "glDrawArraysInstancedEXT",
-  "glDisableClientStateIndexedEXT",
-  "glDrawBuffer",
-  "glMultiDrawArraysIndirectBindlessNV",
-  "glGetnPixelMapusv",
-  "glRasterPos3fv",
-  "glClearBufferuiv",
-  "glGetInternalformati64v",
-  "glShaderSourceARB",
-  "glShaderOp3EXT",
-  "glWindowPos2dvMESA",
-  "glClearIndex",
-  "glProvokingVertexEXT",
-  "glVariantubvEXT",
-  "glFlush",
-  "glFramebufferTexture2DEXT",
-  "glGetColorTableParameterivEXT",
-  "glPresentFrameDualFillNV",
-  "glGenVertexShadersEXT",
-  "glSpecializeShaderARB",
-  "glProgramUniformHandleui64vARB",
-  "glDepthRangefOES",
-  "glDeleteVertexArrays",
-  "glDrawElementsInstancedBaseVertexBaseInstance",
-  "glGetTexLevelParameteriv",
-  "glDrawVkImageNV",
-  "glWindowPos3iARB",
-  "glPrioritizeTextures",
-  "glWindowPos3fvMESA",
-  "glProgramUniformMatrix3x2dvEXT",
-  "glVertex4xvOES",
-  "glTexStorage3DMultisample",
-  "glWindowPos2sARB",
-  "glStencilOpValueAMD",
-  "glProgramVertexLimitNV",
-  "glGetTexParameterPointervAPPLE",
-  "glProgramUniform3uivEXT",
-  "glClampColor",
-  "glClearStencil",
-  "glTexCoordP1uiv",
-  "glVertexAttribs3svNV",
-  "glMultiTexCoord3fv",
-  "glVertexBlendEnvfATI",
-  "glIsFenceAPPLE",
-  "glGetBufferParameterui64vNV",
-  "glVertexAttribI4bvEXT",
-  "glUniform2fARB",
-  "glStopInstrumentsSGIX",
-  "glVertexAttrib3fNV",
-  "glMapVertexAttrib2dAPPLE",
-  "glVertex2f",
-  "glCopyTextureImage2DEXT",
-  "glVertex2d",
-  "glSecondaryColor3bvEXT",
-  "glMultiTexCoord4fARB",
-  "glPolygonOffset",
-  "glTangent3bvEXT",
-  "glHistogram",
-  "glGetProgramiv",
-  "glMatrixIndexubvARB",
-  "glVertex2s",
-  "glGetVertexAttribLui64vNV",
-  "glGetProgramStringARB",
-  "glFlushMappedBufferRange",
-  "glVertexAttribI3uiEXT",
-  "glLineWidthxOES",
-  "glProgramUniformMatrix2fvEXT",
-  "glGetTextureParameterIuivEXT",
-  "glGetMultiTexEnvivEXT",
-  "glPixelTexGenParameterivSGIS",
-  "glGenQueries",
-  "glGetPixelMapfv",
-  "glBlendColorEXT",
-  "glResetMinmax",
-  "glGetnUniformivARB",
-  "glVertexBlendARB",
-  "glVertexAttrib4d",
-  "glGetVaryingLocationNV",
-  "glGetMapAttribParameterivNV",
-  "glTexSubImage3D",
-  "glDeleteSamplers",
-  "glGetLightxOES",
-  "glGetVertexAttribArrayObjectfvATI",
-  "glVertexArrayNormalOffsetEXT",
-  "glGetBufferParameterivARB",
-  "glGetTextureParameterfv",
-  "glDrawMeshArraysSUN",
-  "glVertexAttrib4dNV",
-  "glGetMultisamplefvNV",
-  "glMapObjectBufferATI",
-  "glGetPathCommandsNV",
-  "glVertexArrayTexCoordOffsetEXT",
-  "glGetHistogram",
-  "glMatrixMode",
-  "glColorFormatNV",
-  "glProgramUniformui64NV",
-  "glProgramUniformMatrix4x2fvEXT",
-  "glLoadMatrixxOES",
-  "glGetColorTableParameterfvEXT",
-  "glRasterPos4i",
-  "glVertexAttribL2i64NV",
-  "glBindTextures",
-  "glMatrixRotatefEXT",
-  "glGetClipPlanexOES",
-  "glSecondaryColor3uivEXT",
-  "glGetPerfQueryInfoINTEL",
-  "glGetDoublev",
-  "glBindBufferRangeEXT",
-  "glCompressedTexImage2D",
-  "glMapBufferARB",
-  "glGetPathSpacingNV",
-  "glUniform4dv",
-  "glGlobalAlphaFactordSUN",
-  "glProgramUniform3dv",
-  "glGetShaderSourceARB",
-  "glVertexAttrib3dvARB",
-  "glInvalidateBufferData",
-  "glMatrixLoad3x2fNV",
-  "glCompressedTextureSubImage1D",
-  "glTexCoord3xvOES",
-  "glGenTexturesEXT",
-  "glTangent3iEXT",
-  "glClearTexImage",
-  "glBinormal3bvEXT",
-  "glUniform3fv",
-  "glGetnPixelMapusvARB",
-  "glMemoryObjectParameterivEXT",
-  "glGenSemaphoresEXT",
-  "glMultiTexCoordP1ui",
-  "glClearNamedBufferDataEXT",
-  "glUniformMatrix4dv",
-  "glWindowPos3fMESA",
-  "glDeleteRenderbuffers",
-  "glGetTextureLevelParameterfvEXT",
-  "glGetHistogramParameterxvOES",
-  "glMultiDrawElements",
-  "glMakeImageHandleNonResidentNV",
-  "glTexSubImage1DEXT",
-  "glNormalStream3dATI",
-  "glVertexAttribL4i64vNV",
-  "glDrawBuffers",
-  "glCopyTextureSubImage1DEXT",
-  "glWindowRectanglesEXT",
-  "glNamedFramebufferReadBuffer",
-  "glUniform2i64vARB",
-  "glVertexAttribI1uivEXT",
-  "glGetTexGenfv",
-  "glBeginQueryARB",
-  "glUniform1iARB",
-  "glVertex4bvOES",
-  "glInvalidateSubFramebuffer",
-  "glUniform1fvARB",
-  "glTestFenceNV",
-  "glBindTransformFeedback",
-  "glMultiTexCoord2iv",
-  "glCopyMultiTexSubImage1DEXT",
-  "glVariantbvEXT",
-  "glTexCoord1hNV",
-  "glGenFencesNV",
-  "glRasterPos3iv",
-  "glVertexAttribL2ui64NV",
-  "glMultiTexCoord1hvNV",
-  "glGetnConvolutionFilter",
-  "glNormal3bv",
-  "glWeightbvARB",
-  "glTexCoord4sv",
-  "glUniform2uiv",
-  "glBeginConditionalRenderNVX",
-  "glFinish",
-  "glColorTableParameterfv",
-  "glFragmentCoverageColorNV",
-  "glProgramUniform3ivEXT",
-  "glVertexArrayVertexOffsetEXT",
-  "glViewportPositionWScaleNV",
-  "glGetProgramLocalParameterIuivNV",
-  "glReplacementCodeuiTexCoord2fVertex3fvSUN",
-  "glUniform1uiv",
-  "glUniformMatrix2dv",
-  "glIndexdv",
-  "glSecondaryColor3ivEXT",
-  "glTexCoord3iv",
-  "glVertexStream4fvATI",
-  "glDeformationMap3fSGIX",
-  "glClearDepth",
-  "glGenAsyncMarkersSGIX",
-  "glDisableIndexedEXT",
-  "glVertexWeightfvEXT",
-  "glGetProgramLocalParameterIivNV",
-  "glCompressedTexImage3DARB",
-  "glProgramParameter4fNV",
-  "glConvolutionParameterxOES",
-  "glInsertComponentEXT",
-  "glCreateTextures",
-  "glSecondaryColor3iv",
-  "glCreateBuffers",
-  "glMultiTexCoord2xvOES",
-  "glTexGenxvOES",
-  "glMultTransposeMatrixf",
-  "glBeginTransformFeedbackEXT",
-  "glTexCoord2fColor3fVertex3fSUN",
-  "glNormal3sv",
-  "glFreeObjectBufferATI",
-  "glBlendBarrierNV",
-  "glUniform4i64vNV",
-  "glGetnUniformuivARB",
-  "glAlphaFragmentOp3ATI",
-  "glProgramEnvParameters4fvEXT",
-  "glBlendFuncSeparateEXT",
-  "glConvolutionParameterivEXT",
-  "glPixelTexGenSGIX",
-  "glDeleteProgram",
-  "glUniformMatrix4x3dv",
-  "glGetVideoCaptureStreamivNV",
-  "glProgramUniform4uiEXT",
-  "glMakeImageHandleNonResidentARB",
-  "glSecondaryColor3dEXT",
-  "glDeleteQueries",
-  "glNormalP3uiv",
-  "glRasterPos2d",
-  "glInitNames",
-  "glBinormal3fvEXT",
-  "glColor3dv",
-  "glVertexArrayVertexAttribDivisorEXT",
-  "glArrayElementEXT",
-  "glProgramParameter4dNV",
-  "glIndexxOES",
-  "glUniform3uivEXT",
-  "glPopGroupMarkerEXT",
-  "glClearNamedFramebufferuiv",
-  "glSetLocalConstantEXT",
-  "glProgramUniform1ui64NV",
-  "glColor4hvNV",
-  "glGetVertexAttribfv",
-  "glDispatchCompute",
-  "glGetActiveAttrib",
-  "glFragmentColorMaterialSGIX",
-  "glTexSubImage2D",
-  "glGetnMinmaxARB",
-  "glLogicOp",
-  "glProgramUniformMatrix3x4fv",
-  "glWindowPos4iMESA",
-  "glPixelTransferf",
-  "glGetTextureParameterIuiv",
-  "glMultiTexCoord1xOES",
-  "glProgramUniformMatrix4dv",
-  "glGetnUniformiv",
-  "glFramebufferTexture1DEXT",
-  "glVertexPointervINTEL",
-  "glTextureParameterIiv",
-  "glGetSeparableFilterEXT",
-  "glMultiTexCoord3iARB",
-  "glRasterPos4xvOES",
-  "glDrawTransformFeedbackStream",
-  "glVertex3hvNV",
-  "glVertexArrayMultiTexCoordOffsetEXT",
-  "glProvokingVertex",
-  "glAccumxOES",
-  "glShaderBinary",
-  "glGetMultiTexGenivEXT",
-  "glPointParameterxvOES",
-  "glCreateStatesNV",
-  "glClearDepthdNV",
-  "glClearColorIuiEXT",
-  "glBindMultiTextureEXT",
-  "glTexGeniv",
-  "glDrawElements",
-  "glProgramUniform4iv",
-  "glDisableVertexArrayEXT",
-  "glProgramUniform3ui64NV",
-  "glClientActiveTexture",
-  "glMultiTexParameterIivEXT",
-  "glUniform1i64ARB",
-  "glUniform1iv",
-  "glMulticastBarrierNV",
-  "glVertexAttribArrayObjectATI",
-  "glUniform2iARB",
-  "glDrawArraysInstanced",
-  "glVertexAttrib2sNV",
-  "glTexBufferEXT",
-  "glVertexStream2fATI",
-  "glDebugMessageCallbackAMD",
-  "glSamplerParameteriv",
-  "glVertexAttrib4uiv",
-  "glEndQueryIndexed",
-  "glNormalStream3sATI",
-  "glProgramParameteriARB",
-  "glTexEnvxOES",
-  "glProgramUniform1iv",
-  "glDisableVertexAttribAPPLE",
-  "glBindRenderbuffer",
-  "glMultiTexSubImage3DEXT",
-  "glIsProgram",
-  "glMultiDrawElementsIndirectAMD",
-  "glGetProgramInfoLog",
-  "glGetLocalConstantBooleanvEXT",
-  "glPixelTransformParameteriEXT",
-  "glTexCoord4bOES",
-  "glVertexAttrib4fv",
-  "glProgramUniformMatrix2x3dv",
-  "glProgramEnvParametersI4uivNV",
-  "glTexCoord3xOES",
-  "glLoadTransposeMatrixfARB",
-  "glImageTransformParameteriHP",
-  "glMultiTexCoord4xOES",
-  "glVertexAttribs3fvNV",
-  "glVertexAttrib2fv",
-  "glUniform3ui64NV",
-  "glCombinerParameterfvNV",
-  "glFragmentMaterialiSGIX",
-  "glGetBooleani_v",
-  "glGetProgramResourceIndex",
-  "glBeginConditionalRenderNV",
-  "glDisableClientState",
-  "glPathFogGenNV",
-  "glStencilThenCoverFillPathNV",
-  "glVertexArrayIndexOffsetEXT",
-  "glProgramBufferParametersIuivNV",
-  "glPixelTransformParameterivEXT",
-  "glDisableClientStateiEXT",
-  "glTexBufferARB",
-  "glGetLocalConstantIntegervEXT",
-  "glColor4uiv",
-  "glProgramUniform3i",
-  "glMultiDrawElementsIndirectBindlessCountNV",
-  "glGetBufferPointervARB",
-  "glMultiTexParameterIuivEXT",
-  "glEvalMesh2",
-  "glEvalMesh1",
-  "glProgramUniform3f",
-  "glStencilThenCoverFillPathInstancedNV",
-  "glProgramUniform3d",
-  "glMapVertexAttrib1dAPPLE",
-  "glEvalCoord2fv",
-  "glGetUniformivARB",
-  "glLoadTransposeMatrixd",
-  "glLoadTransposeMatrixf",
-  "glGetPointervEXT",
-  "glSignalVkSemaphoreNV",
-  "glEndConditionalRenderNV",
-  "glTexCoord2fNormal3fVertex3fSUN",
-  "glUniform3i64vARB",
-  "glProgramUniform2uiEXT",
-  "glVertexAttribI1ui",
-  "glProgramNamedParameter4dvNV",
-  "glCompileCommandListNV",
-  "glGetRenderbufferParameterivEXT",
-  "glGetnPolygonStipple",
-  "glIsBufferResidentNV",
-  "glSecondaryColor3ubvEXT",
-  "glGetNamedRenderbufferParameterivEXT",
-  "glNamedFramebufferSampleLocationsfvARB",
-  "glMultiTexGendvEXT",
-  "glVertexArrayRangeNV",
-  "glIsTextureHandleResidentNV",
-  "glGetProgramEnvParameterdvARB",
-  "glIsNamedStringARB",
-  "glSecondaryColorFormatNV",
-  "glVertexAttrib4ubvNV",
-  "glTagSampleBufferSGIX",
-  "glVDPAUUnregisterSurfaceNV",
-  "glGetPerfQueryIdByNameINTEL",
-  "glGetInteger64v",
-  "glClipPlane",
-  "glColor4ubVertex3fSUN",
-  "glIndexub",
-  "glGetProgramEnvParameterfvARB",
-  "glVertexAttrib4usvARB",
-  "glNamedFramebufferRenderbuffer",
-  "glProgramUniformMatrix3x4dv",
-  "glTestFenceAPPLE",
-  "glVertexAttrib4Niv",
-  "glVertexAttribL2i64vNV",
-  "glColorP4uiv",
-  "glUniformMatrix2x3fv",
-  "glCallCommandListNV",
-  "glClearBufferiv",
-  "glNamedStringARB",
-  "glMatrixMult3x2fNV",
-  "glGetNamedProgramStringEXT",
-  "glGetnHistogramARB",
-  "glGetTextureLevelParameterfv",
-  "glMultiTexCoord1fv",
-  "glBitmapxOES",
-  "glGetSamplerParameterIuiv",
-  "glTexCoordP3ui",
-  "glTextureSubImage1D",
-  "glVertexAttribLPointerEXT",
-  "glFogCoordPointerEXT",
-  "glWindowPos3s",
-  "glVertexAttribs2svNV",
-  "glTextureImage3DEXT",
-  "glWindowPos3i",
-  "glWindowPos3d",
-  "glWindowPos3f",
-  "glIsEnabledIndexedEXT",
-  "glGetNamedProgramivEXT",
-  "glVertex3xvOES",
-  "glColor3us",
-  "glBeginPerfMonitorAMD",
-  "glProgramUniformMatrix4x3dv",
-  "glGetNamedProgramLocalParameterIuivEXT",
-  "glReadnPixels",
-  "glMultiTexCoord4f",
-  "glColor3ub",
-  "glMultiTexCoord4d",
-  "glVertexAttribL3ui64NV",
-  "glColor3ui",
-  "glProgramUniform4fvEXT",
-  "glVertexAttrib2sARB",
-  "glMultiTexCoord4i",
-  "glCheckFramebufferStatusEXT",
-  "glGetnMapivARB",
-  "glMultiTexCoord1ivARB",
-  "glDisableVertexAttribArrayARB",
-  "glGetPolygonStipple",
-  "glVertexAttribI4ui",
-  "glGetPathDashArrayNV",
-  "glMultiTexRenderbufferEXT",
-  "glCopyTextureSubImage1D",
-  "glDeleteOcclusionQueriesNV",
-  "glVertex4hvNV",
-  "glGetnTexImage",
-  "glProgramLocalParameter4dARB",
-  "glBlendEquation",
-  "glUnlockArraysEXT",
-  "glGetQueryObjectui64vEXT",
-  "glVertexAttribI4uivEXT",
-  "glUniform1i64vNV",
-  "glMultiTexCoord3dv",
-  "glColor4sv",
-  "glVertexStream4ivATI",
-  "glPopClientAttrib",
-  "glClearBufferData",
-  "glGetProgramivNV",
-  "glBeginTransformFeedback",
-  "glFinishObjectAPPLE",
-  "glGetMinmaxParameterivEXT",
-  "glColor3iv",
-  "glVertexAttrib3sv",
-  "glCompressedTexImage1D",
-  "glDeleteTransformFeedbacks",
-  "glGetVideoi64vNV",
-  "glDrawRangeElementsBaseVertex",
-  "glUniform4i64vARB",
-  "glTextureStorage3DMultisampleEXT",
-  "glGetTexParameterfv",
-  "glProgramUniformui64vNV",
-  "glCompressedMultiTexImage1DEXT",
-  "glProgramUniform2ivEXT",
-  "glPushGroupMarkerEXT",
-  "glVertexAttrib1dv",
-  "glMatrixLoadIdentityEXT",
-  "glMultTransposeMatrixxOES",
-  "glGetPixelMapxv",
-  "glFramebufferSampleLocationsfvARB",
-  "glGetLightiv",
-  "glBlendFuncSeparatei",
-  "glAcquireKeyedMutexWin32EXT",
-  "glGetBooleanIndexedvEXT",
-  "glGetProgramSubroutineParameteruivNV",
-  "glUniform2ui",
-  "glApplyFramebufferAttachmentCMAAINTEL",
-  "glWindowPos2fv",
-  "glWaitVkSemaphoreNV",
-  "glDisablei",
-  "glSelectPerfMonitorCountersAMD",
-  "glGetVertexAttribLi64vNV",
-  "glBlendFuncSeparateiARB",
-  "glWeightuivARB",
-  "glWindowPos2iARB",
-  "glGetProgramLocalParameterdvARB",
-  "glGetUniformui64vARB",
-  "glSecondaryColor3us",
-  "glGetSynciv",
-  "glMakeImageHandleResidentARB",
-  "glGetProgramNamedParameterfvNV",
-  "glTextureStorage3D",
-  "glVertexAttrib4svNV",
-  "glProgramUniform2i",
-  "glListDrawCommandsStatesClientNV",
-  "glProgramLocalParametersI4uivNV",
-  "glBeginTransformFeedbackNV",
-  "glGetProgramBinary",
-  "glBinormal3iEXT",
-  "glEvalPoint1",
-  "glEvalPoint2",
-  "glPauseTransformFeedback",
-  "glWindowPos2sMESA",
-  "glGlobalAlphaFactorbSUN",
-  "glCreateTransformFeedbacks",
-  "glTexturePageCommitmentEXT",
-  "glTransformFeedbackVaryingsNV",
-  "glTexSubImage1D",
-  "glConvolutionParameterfvEXT",
-  "glBlitFramebufferEXT",
-  "glUniformMatrix4fvARB",
-  "glProgramEnvParameter4dvARB",
-  "glTextureStorageMem2DEXT",
-  "glVertexAttribP3uiv",
-  "glFogCoordFormatNV",
-  "glGetMultiTexLevelParameterivEXT",
-  "glIsOcclusionQueryNV",
-  "glCompressedTexImage2DARB",
-  "glGetProgramEnvParameterIuivNV",
-  "glVertexAttrib4sv",
-  "glVertexAttrib4fvARB",
-  "glLoadName",
-  "glBindVertexShaderEXT",
-  "glGetNamedProgramLocalParameterIivEXT",
-  "glProgramUniform3uiEXT",
-  "glProgramUniformMatrix4x2dvEXT",
-  "glTexCoord1hvNV",
-  "glLoadMatrixd",
-  "glTexParameterfv",
-  "glVariantdvEXT",
-  "glCullParameterfvEXT",
-  "glUniform3dv",
-  "glProgramUniform3fv",
-  "glIsBufferARB",
-  "glMultiTexCoord1bOES",
-  "glFogCoordhNV",
-  "glFramebufferSampleLocationsfvNV",
-  "glGenSymbolsEXT",
-  "glGetConvolutionFilter",
-  "glProgramUniform1fvEXT",
-  "glGetNextPerfQueryIdINTEL",
-  "glCompressedTexImage1DARB",
-  "glBindSamplers",
-  "glGetProgramEnvParameterIivNV",
-  "glGetQueryObjectui64v",
-  "glVertexAttribL4ui64vNV",
-  "glGetVideoivNV",
-  "glGetTextureImage",
-  "glProgramUniform1fv",
-  "glUniformMatrix4fv",
-  "glColorMask",
-  "glBeginFragmentShaderATI",
-  "glMultiDrawArraysEXT",
-  "glGenNamesAMD",
-  "glPathParameteriNV",
-  "glCreateCommandListsNV",
-  "glDeleteProgramPipelines",
-  "glCopyColorSubTableEXT",
-  "glVariantsvEXT",
-  "glGenProgramPipelines",
-  "glVertexArrayEdgeFlagOffsetEXT",
-  "glWindowPos2s",
-  "glSecondaryColor3iEXT",
-  "glWindowPos2i",
-  "glWindowPos2f",
-  "glWindowPos2d",
-  "glUniform4uivEXT",
-  "glOrthoxOES",
-  "glUniformSubroutinesuiv",
-  "glRectdv",
-  "glProgramUniform1i64vNV",
-  "glVertexAttribI4uiEXT",
-  "glSecondaryColor3ubEXT",
-  "glCompressedMultiTexSubImage1DEXT",
-  "glMultiTexGendEXT",
-  "glColorP3uiv",
-  "glFogCoordfv",
-  "glCompileShader",
-  "glTexCoord2hNV",
-  "glUniform1uivEXT",
-  "glMatrixLoadTransposedEXT",
-  "glIndexfv",
-  "glGetCompressedTextureImage",
-  "glGetUniformuivEXT",
-  "glGetnPixelMapfvARB",
-  "glFramebufferTextureEXT",
-  "glMultiDrawElementsIndirectCount",
-  "glVertexAttribIPointer",
-  "glMultiTexCoordP3ui",
-  "glEvaluateDepthValuesARB",
-  "glGetNamedBufferParameteriv",
-  "glGetNamedProgramLocalParameterfvEXT",
-  "glColor4fNormal3fVertex3fvSUN",
-  "glSeparableFilter2DEXT",
-  "glTexParameterxOES",
-  "glClearAccumxOES",
-  "glInvalidateFramebuffer",
-  "glWeightubvARB",
-  "glVertexAttrib1d",
-  "glVertexAttrib1f",
-  "glVertex4fv",
-  "glClearNamedFramebufferfi",
-  "glGetQueryBufferObjectuiv",
-  "glClearNamedFramebufferfv",
-  "glEndVertexShaderEXT",
-  "glVertexAttrib1s",
-  "glMultiTexCoord4dvARB",
-  "glMultiTexCoord1sv",
-  "glUniform1ui64vNV",
-  "glGetClipPlanefOES",
-  "glRasterPos2s",
-  "glWeightivARB",
-  "glMultiTexCoord4hvNV",
-  "glNormal3hNV",
-  "glGetSeparableFilter",
-  "glGetPathTexGenivNV",
-  "glColor4bv",
-  "glRasterPos2f",
-  "glNamedBufferPageCommitmentARB",
-  "glLoadIdentity",
-  "glRasterPos2i",
-  "glRasterPos4iv",
-  "glMultiTexCoord2fvARB",
-  "glUniformMatrix4x3fv",
-  "glClearBufferfv",
-  "glMultiTexCoord4hNV",
-  "glTextureBarrier",
-  "glReplacementCodeuivSUN",
-  "glDeleteAsyncMarkersSGIX",
-  "glTexCoord2bvOES",
-  "glEvalCoord2xOES",
-  "glGetSharpenTexFuncSGIS",
-  "glProgramUniformHandleui64vNV",
-  "glIglooInterfaceSGIX",
-  "glWindowPos2dvARB",
-  "glClearBufferfi",
-  "glDrawArraysIndirect",
-  "glGenVertexArrays",
-  "glGetTransformFeedbacki64_v",
-  "glEnableVertexArrayAttrib",
-  "glProgramUniformMatrix3x2dv",
-  "glVertexStream4fATI",
-  "glVertexBindingDivisor",
-  "glGetSamplerParameterIiv",
-  "glGetCoverageModulationTableNV",
-  "glDepthRangedNV",
-  "glVertexAttrib3f",
-  "glMultiDrawRangeElementArrayAPPLE",
-  "glVertexAttribFormatNV",
-  "glGetQueryBufferObjecti64v",
-  "glGetVertexAttribdv",
-  "glGetUniformi64vARB",
-  "glAreTexturesResidentEXT",
-  "glGetHandleARB",
-  "glVideoCaptureStreamParameterdvNV",
-  "glMapParameterivNV",
-  "glIsVertexArray",
-  "glSecondaryColor3sEXT",
-  "glGetTexParameterIivEXT",
-  "glFrameTerminatorGREMEDY",
-  "glBlendBarrierKHR",
-  "glVertexAttrib4NubARB",
-  "glPrimitiveRestartNV",
-  "glVertexAttribL1ui64vARB",
-  "glVertexAttribI4ivEXT",
-  "glVertexAttribs4svNV",
-  "glUniform1ui",
-  "glVertexAttrib2fvARB",
-  "glVertexAttribI4svEXT",
-  "glTextureImage3DMultisampleCoverageNV",
-  "glMemoryBarrier",
-  "glGetVariantArrayObjectfvATI",
-  "glTexCoord4fColor4fNormal3fVertex4fvSUN",
-  "glIsProgramARB",
-  "glBindImageTextureEXT",
-  "glGetFragDataLocation",
-  "glMultiTexCoord1svARB",
-  "glGetMapxvOES",
-  "glTextureStorage2DMultisampleEXT",
-  "glGetMaterialfv",
-  "glVertexAttrib4NbvARB",
-  "glPixelMapuiv",
-  "glColorPointerEXT",
-  "glEnableClientStateiEXT",
-  "glClearTexSubImage",
-  "glEvalCoord1xvOES",
-  "glDetachObjectARB",
-  "glGetTextureParameterIiv",
-  "glVariantusvEXT",
-  "glCompressedTextureImage3DEXT",
-  "glMultiTexCoord1dARB",
-  "glGetVertexArrayIntegeri_vEXT",
-  "glVertexAttribI4ubv",
-  "glPixelTexGenParameterfSGIS",
-  "glProgramUniformMatrix4x2dv",
-  "glUniform3fARB",
-  "glIsShader",
-  "glConvolutionParameteriv",
-  "glCopyMultiTexSubImage2DEXT",
-  "glEnableVertexAttribArrayARB",
-  "glMulticastCopyBufferSubDataNV",
-  "glEnable",
-  "glGetActiveUniformsiv",
-  "glGetVertexAttribivARB",
-  "glTexCoord4hvNV",
-  "glUseProgramObjectARB",
-  "glGetAttribLocation",
-  "glVertexAttrib4dv",
-  "glGetTextureParameteriv",
-  "glNamedBufferStorageMemEXT",
-  "glPathSubCoordsNV",
-  "glMatrixIndexusvARB",
-  "glGetVideouivNV",
-  "glGetVideoCaptureivNV",
-  "glProgramUniform3ui",
-  "glVertexAttrib3svARB",
-  "glGetNamedBufferParameterivEXT",
-  "glMatrixScaledEXT",
-  "glProgramUniformMatrix2x3fv",
-  "glGetFragmentLightivSGIX",
-  "glGetStringi",
-  "glWindowPos2svARB",
-  "glVertexAttrib2svNV",
-  "glWindowPos2ivARB",
-  "glGetVertexAttribPointervNV",
-  "glPushMatrix",
-  "glEdgeFlagPointerListIBM",
-  "glGenerateMipmapEXT",
-  "glWindowPos3sv",
-  "glPathCoordsNV",
-  "glProgramUniform1i",
-  "glProgramUniform1d",
-  "glProgramUniform1f",
-  "glProgramParameteriEXT",
-  "glCompressedMultiTexImage2DEXT",
-  "glProgramUniform3iv",
-  "glIndexiv",
-  "glMultiTexCoord4xvOES",
-  "glEGLImageTargetTexture2DOES",
-  "glPixelZoom",
-  "glVertex3bvOES",
-  "glFramebufferReadBufferEXT",
-  "glExtractComponentEXT",
-  "glCombinerParameterivNV",
-  "glMinmax",
-  "glColorP3ui",
-  "glPointParameterfvSGIS",
-  "glBlendEquationi",
-  "glGetFogFuncSGIS",
-  "glVertexAttrib4fvNV",
-  "glGetnMinmax",
-  "glFragmentLightiSGIX",
-  "glMultiTexCoord1bvOES",
-  "glSecondaryColorPointerEXT",
-  "glMultiTexCoordP4uiv",
-  "glGetBufferSubDataARB",
-  "glSecondaryColor3hNV",
-  "glGetPathParameterivNV",
-  "glFlushRasterSGIX",
-  "glElementPointerATI",
-  "glGetAttachedObjectsARB",
-  "glUniform4iv",
-  "glFogxOES",
-  "glSharpenTexFuncSGIS",
-  "glClearDepthfOES",
-  "glDeleteCommandListsNV",
-  "glSpecializeShader",
-  "glVertex4hNV",
-  "glSecondaryColor3dvEXT",
-  "glGenTextures",
-  "glTextureStorage2DMultisample",
-  "glUniform3ui64vNV",
-  "glBlendFuncSeparateIndexedAMD",
-  "glMakeBufferResidentNV",
-  "glShaderOp2EXT",
-  "glGetVertexAttribivNV",
-  "glTexParameterIivEXT",
-  "glGetPerfQueryDataINTEL",
-  "glVertexAttrib4dvARB",
-  "glTextureSubImage1DEXT",
-  "glGetActiveUniformBlockName",
-  "glVertexAttrib2dvARB",
-  "glVertexAttribPointer",
-  "glDepthBoundsdNV",
-  "glDeleteTexturesEXT",
-  "glDrawBuffersATI",
-  "glLightModelxvOES",
-  "glApplyTextureEXT",
-  "glGetImageHandleNV",
-  "glGetMinmax",
-  "glGetFixedvOES",
-  "glSamplePatternEXT",
-  "glUniform1f",
-  "glColor4fNormal3fVertex3fSUN",
-  "glFogCoorddvEXT",
-  "glCopyTextureImage1DEXT",
-  "glFlushMappedBufferRangeAPPLE",
-  "glVertex3sv",
-  "glFlushStaticDataIBM",
-  "glProgramUniform4ui64NV",
-  "glRasterPos4xOES",
-  "glVertexAttribP1ui",
-  "glProgramUniform4dvEXT",
-  "glEndTransformFeedbackEXT",
-  "glBinormal3dEXT",
-  "glGetTextureSubImage",
-  "glGetNamedRenderbufferParameteriv",
-  "glBindBuffersRange",
-  "glFinishAsyncSGIX",
-  "glBindFragDataLocationIndexed",
-  "glMultiTexCoord2dv",
-  "glUniform2iv",
-  "glProgramUniform2i64vNV",
-  "glFlushVertexArrayRangeAPPLE",
-  "glTextureParameterf",
-  "glMultiTexCoord3dvARB",
-  "glFeedbackBuffer",
-  "glDebugMessageInsertARB",
-  "glMultiTexCoord2i",
-  "glTextureSubImage3D",
-  "glFramebufferTexture1D",
-  "glGetShaderiv",
-  "glMultiTexCoord2d",
-  "glArrayObjectATI",
-  "glGetPointeri_vEXT",
-  "glGetPerfMonitorCountersAMD",
-  "glNamedBufferStorage",
-  "glTexEnvxvOES",
-  "glProgramUniform2ui64NV",
-  "glMultiTexCoord3bOES",
-  "glUniform1dv",
-  "glPixelTransferi",
-  "glSecondaryColor3usvEXT",
-  "glProgramEnvParameterI4uivNV",
-  "glVertex2sv",
-  "glWindowPos4dMESA",
-  "glDebugMessageControlARB",
-  "glIsTextureEXT",
-  "glFragmentMaterialivSGIX",
-  "glLinkProgramARB",
-  "glFinishFenceAPPLE",
-  "glVertexArrayVertexAttribBindingEXT",
-  "glTexStorageMem3DMultisampleEXT",
-  "glUniform1ui64vARB",
-  "glMultiTexCoord4fv",
-  "glMulticastFramebufferSampleLocationsfvNV",
-  "glRasterPos3d",
-  "glPollAsyncSGIX",
-  "glRasterPos3f",
-  "glCompressedTexImage3D",
-  "glVariantivEXT",
-  "glUnmapTexture2DINTEL",
-  "glMulticastWaitSyncNV",
-  "glGetVertexAttribiv",
-  "glGetPathCoordsNV",
-  "glColor4xvOES",
-  "glVertexAttrib3fv",
-  "glRasterPos3s",
-  "glVertex4bOES",
-  "glTransformFeedbackVaryingsEXT",
-  "glCombinerOutputNV",
-  "glWindowPos4sMESA",
-  "glVertexAttrib4svARB",
-  "glIsList",
-  "glGetInfoLogARB",
-  "glUniformMatrix2fv",
-  "glVertexAttribs3dvNV",
-  "glGlobalAlphaFactorsSUN",
-  "glGetTrackMatrixivNV",
-  "glTextureParameterfvEXT",
-  "glIsNamedBufferResidentNV",
-  "glProgramUniform4ui64vARB",
-  "glTbufferMask3DFX",
-  "glCoverFillPathNV",
-  "glVertexAttrib1fvARB",
-  "glGenerateTextureMipmap",
-  "glNamedProgramLocalParameterI4uivEXT",
-  "glMultiDrawElementsBaseVertex",
-  "glProgramSubroutineParametersuivNV",
-  "glProgramUniformMatrix2x4dvEXT",
-  "glRotatexOES",
-  "glMemoryBarrierEXT",
-  "glVertexAttrib3svNV",
-  "glVertexStream3iATI",
-  "glCompressedTexSubImage1D",
-  "glSetFenceNV",
-  "glAttachObjectARB",
-  "glCopyConvolutionFilter1D",
-  "glTexStorageMem2DMultisampleEXT",
-  "glProgramParameters4fvNV",
-  "glNamedFramebufferParameteriEXT",
-  "glVertexAttrib4Nsv",
-  "glVertexAttribI4usvEXT",
-  "glTextureBufferRangeEXT",
-  "glVertexP3uiv",
-  "glIsPathNV",
-  "glGetnUniformi64vARB",
-  "glFramebufferTextureMultiviewOVR",
-  "glCompressedMultiTexSubImage2DEXT",
-  "glGetnMapdv",
-  "glDebugMessageCallback",
-  "glTangent3svEXT",
-  "glVertexAttribParameteriAMD",
-  "glBufferSubDataARB",
-  "glGetVertexAttribLui64vARB",
-  "glVertexAttribL4ui64NV",
-  "glReplacementCodeuiColor4ubVertex3fSUN",
-  "glImageTransformParameterfHP",
-  "glMap1f",
-  "glRasterPos4fv",
-  "glVertex2bvOES",
-  "glGetMapControlPointsNV",
-  "glNamedProgramLocalParametersI4ivEXT",
-  "glBindBufferRangeNV",
-  "glVertexStream3dvATI",
-  "glNormalPointerListIBM",
-  "glFogFuncSGIS",
-  "glMultiModeDrawArraysIBM",
-  "glGetNamedFramebufferAttachmentParameterivEXT",
-  "glGetFloatv",
-  "glVertexArrayVertexAttribIFormatEXT",
-  "glHint",
-  "glVertexStream2svATI",
-  "glMultiDrawArraysIndirect",
-  "glMultiTexEnvfvEXT",
-  "glVertexAttribP2uiv",
-  "glProgramUniform1i64vARB",
-  "glFramebufferTextureARB",
-  "glPushClientAttribDefaultEXT",
-  "glScalef",
-  "glScaled",
-  "glGetConvolutionParameterxvOES",
-  "glGetProgramResourceName",
-  "glCopyColorTable",
-  "glDepthRangeArrayv",
-  "glCoverFillPathInstancedNV",
-  "glMultiTexParameterivEXT",
-  "glGetActiveAtomicCounterBufferiv",
-  "glStencilOpSeparate",
-  "glVertexAttrib4fNV",
-  "glGetColorTableParameterivSGI",
-  "glVertexArrayAttribBinding",
-  "glIsSemaphoreEXT",
-  "glProgramParameters4dvNV",
-  "glVertexAttribL4dv",
-  "glGetTexParameteriv",
-  "glGetUniformOffsetEXT",
-  "glGetVertexAttribPointerv",
-  "glResumeTransformFeedbackNV",
-  "glProgramUniform3i64vNV",
-  "glTangent3fEXT",
-  "glGetPathMetricRangeNV",
-  "glWindowPos2iMESA",
-  "glVertex2xvOES",
-  "glGetnCompressedTexImage",
-  "glWindowPos2dv",
-  "glReplacementCodeuiVertex3fSUN",
-  "glGetTransformFeedbackVaryingEXT",
-  "glWindowPos3fARB",
-  "glMapNamedBufferEXT",
-  "glDisable",
-  "glIsPointInFillPathNV",
-  "glVertexAttribI2uiEXT",
-  "glProgramUniform4uiv",
-  "glQueryCounter",
-  "glFramebufferRenderbufferEXT",
-  "glBinormal3svEXT",
-  "glBindBufferOffsetNV",
-  "glCopyTextureSubImage2D",
-  "glGetProgramResourcefvNV",
-  "glBinormalPointerEXT",
-  "glGetLightfv",
-  "glMulticastCopyImageSubDataNV",
-  "glVertex2bOES",
-  "glUniform2ivARB",
-  "glMultiTexCoord3s",
-  "glGetHistogramParameterfvEXT",
-  "glGetProgramStringNV",
-  "glGetTexGenxvOES",
-  "glTextureSubImage2D",
-  "glObjectPurgeableAPPLE",
-  "glColorTableSGI",
-  "glCopyConvolutionFilter2DEXT",
-  "glMultiTexCoord3f",
-  "glMultiTexCoord3d",
-  "glFogCoorddv",
-  "glGetBufferPointerv",
-  "glProgramUniform1fEXT",
-  "glWindowPos2fvMESA",
-  "glAlphaToCoverageDitherControlNV",
-  "glPolygonOffsetxOES",
-  "glVertexAttrib4dARB",
-  "glUniformHandleui64vARB",
-  "glFragmentLightModelfvSGIX",
-  "glSwizzleEXT",
-  "glBindFragmentShaderATI",
-  "glVertexAttribs3hvNV",
-  "glGenBuffersARB",
-  "glTextureStorageMem2DMultisampleEXT",
-  "glListParameterfvSGIX",
-  "glNamedRenderbufferStorageMultisample",
-  "glVertexAttribI1iEXT",
-  "glMultiTexCoord2ivARB",
-  "glLightModelxOES",
-  "glColor3xOES",
-  "glReadBuffer",
-  "glStencilFillPathInstancedNV",
-  "glVDPAUUnmapSurfacesNV",
-  "glProgramUniform4i64NV",
-  "glVertexStream4dvATI",
-  "glIsQuery",
-  "glProgramUniformMatrix4fvEXT",
-  "glVertexAttrib3hNV",
-  "glFlushMappedNamedBufferRange",
-  "glPushName",
-  "glGetClipPlane",
-  "glVertex4dv",
-  "glVertexAttrib3d",
-  "glBlendColor",
-  "glBindTransformFeedbackNV",
-  "glSamplerParameterIuiv",
-  "glIndexubv",
-  "glNamedBufferPageCommitmentEXT",
-  "glCheckNamedFramebufferStatus",
-  "glGetObjectBufferfvATI",
-  "glRasterPos4d",
-  "glRasterPos4f",
-  "glGetPerfMonitorCounterStringAMD",
-  "glVertexAttrib3s",
-  "glDrawElementsInstancedEXT",
-  "glNamedProgramLocalParameterI4iEXT",
-  "glRasterPos4s",
-  "glGetProgramStageiv",
-  "glGetMaterialxOES",
-  "glPopMatrix",
-  "glGetVideoui64vNV",
-  "glTangent3bEXT",
-  "glGetGraphicsResetStatusARB",
-  "glUniform4i",
-  "glActiveTexture",
-  "glEnableVertexAttribArray",
-  "glTexCoord4fVertex4fvSUN",
-  "glUniform4d",
-  "glUniform4f",
-  "glRenderbufferStorageMultisample",
-  "glCreateProgramPipelines",
-  "glVertexAttribLPointer",
-  "glUniform2uiEXT",
-  "glMultiTexCoord3sv",
-  "glDrawElementsInstancedBaseVertex",
-  "glPixelTransformParameterfvEXT",
-  "glDrawTransformFeedbackNV",
-  "glTextureImage2DMultisampleCoverageNV",
-  "glNamedRenderbufferStorageMultisampleCoverageEXT",
-  "glIsTexture",
-  "glMultiTexCoord4iv",
-  "glTexEnvfv",
-  "glPopDebugGroup",
-  "glUniformBlockBinding",
-  "glWindowPos2svMESA",
-  "glGenerateTextureMipmapEXT",
-  "glBindLightParameterEXT",
-  "glTexCoord3bOES",
-  "glTexCoordPointer",
-  "glProgramUniformMatrix3x2fv",
-  "glUniform2fvARB",
-  "glProgramLocalParameterI4uivNV",
-  "glFlushVertexArrayRangeNV",
-  "glSecondaryColor3svEXT",
-  "glGetBufferParameteriv",
-  "glGetQueryIndexediv",
-  "glFramebufferTexture3DEXT",
-  "glLoadTransposeMatrixxOES",
-  "glDeleteTransformFeedbacksNV",
-  "glGetCompressedTextureImageEXT",
-  "glIndexMaterialEXT",
-  "glFogCoorddEXT",
-  "glTexCoord2hvNV",
-  "glGetFramebufferParameterfvAMD",
-  "glTexEnviv",
-  "glEndTransformFeedbackNV",
-  "glGlobalAlphaFactoruiSUN",
-  "glSelectBuffer",
-  "glNamedBufferSubDataEXT",
-  "glDisableVertexArrayAttrib",
-  "glBlendFunc",
-  "glCreateProgram",
-  "glVertexStream2dATI",
-  "glUniform4ui64vARB",
-  "glGetSemaphoreParameterui64vEXT",
-  "glPrimitiveRestartIndex",
-  "glNormalStream3fATI",
-  "glProgramUniformMatrix2fv",
-  "glVertexAttribs1hvNV",
-  "glWindowPos4svMESA",
-  "glDeleteFragmentShaderATI",
-  "glBindImageTextures",
-  "glMap2xOES",
-  "glEnd",
-  "glMultiTexCoord2dARB",
-  "glUniform1i64NV",
-  "glPathStringNV",
-  "glGetNamedFramebufferParameterivEXT",
-  "glGetProgramNamedParameterdvNV",
-  "glPathDashArrayNV",
-  "glUniform3uiv",
-  "glColor3fVertex3fvSUN",
-  "glMultTransposeMatrixd",
-  "glClearColor",
-  "glGetImageHandleARB",
-  "glTangent3dEXT",
-  "glGetQueryObjectivARB",
-  "glGetLocalConstantFloatvEXT",
-  "glUseShaderProgramEXT",
-  "glBindRenderbufferEXT",
-  "glInterleavedArrays",
-  "glGetPerfMonitorGroupStringAMD",
-  "glUniform3ui",
-  "glGetNamedProgramLocalParameterdvEXT",
-  "glDeleteQueryResourceTagNV",
-  "glVertexAttribI4uiv",
-  "glVertexAttrib4bv",
-  "glMultiTexCoord3xOES",
-  "glSecondaryColor3ub",
-  "glFragmentMaterialfSGIX",
-  "glGetVariantArrayObjectivATI",
-  "glSecondaryColor3ui",
-  "glVertexAttrib1dARB",
-  "glGetNamedBufferPointerv",
-  "glLockArraysEXT",
-  "glVertexAttribPointerNV",
-  "glConvolutionParameterf",
-  "glBindBufferBaseEXT",
-  "glTexCoord2xvOES",
-  "glGetQueryBufferObjectui64v",
-  "glSetMultisamplefvAMD",
-  "glPathColorGenNV",
-  "glVertexAttrib3sARB",
-  "glVertexAttrib4ivARB",
-  "glGenTransformFeedbacks",
-  "glGetVertexAttribIuiv",
-  "glPixelTransformParameterfEXT",
-  "glGetTexParameterIuivEXT",
-  "glGetObjectParameterivARB",
-  "glVertexArraySecondaryColorOffsetEXT",
-  "glWindowPos2fARB",
-  "glCompressedTexSubImage2D",
-  "glCompressedTexSubImage3DARB",
-  "glProgramBinary",
-  "glPresentFrameKeyedNV",
-  "glVertexAttribI4bv",
-  "glPathCoverDepthFuncNV",
-  "glTransformFeedbackStreamAttribsNV",
-  "glSecondaryColor3usEXT",
-  "glCopyColorTableSGI",
-  "glProgramEnvParameter4fvARB",
-  "glMultiTexCoord4sARB",
-  "glGetVertexArrayIndexed64iv",
-  "glMatrixMultTranspose3x3fNV",
-  "glTexParameterIiv",
-  "glVertexArrayAttribFormat",
-  "glEndTransformFeedback",
-  "glDrawCommandsStatesAddressNV",
-  "glUniform4ui64NV",
-  "glMaterialiv",
-  "glTexImage2DMultisample",
-  "glBindTextureEXT",
-  "glIsBuffer",
-  "glVertexAttribI1iv",
-  "glGetFinalCombinerInputParameterfvNV",
-  "glMultiTexCoord3bvOES",
-  "glVertexAttribDivisor",
-  "glCopyBufferSubData",
-  "glBindTexGenParameterEXT",
-  "glNormalStream3bATI",
-  "glTexStorageMem2DEXT",
-  "glTextureImage2DEXT",
-  "glGetColorTableParameteriv",
-  "glActiveTextureARB",
-  "glTexCoord4xOES",
-  "glNamedBufferStorageExternalEXT",
-  "glSecondaryColor3fvEXT",
-  "glUniformMatrix4x2fv",
-  "glStartInstrumentsSGIX",
-  "glProgramNamedParameter4fvNV",
-  "glEndVideoCaptureNV",
-  "glGenLists",
-  "glUniform1fARB",
-  "glNamedFramebufferTexture1DEXT",
-  "glMapBufferRange",
-  "glMultiDrawElementsIndirectCountARB",
-  "glProgramUniformMatrix4x2fv",
-  "glGetTextureParameterIivEXT",
-  "glMultiTexCoord3hNV",
-  "glNamedProgramLocalParametersI4uivEXT",
-  "glEndList",
-  "glTexCoord2fColor4fNormal3fVertex3fSUN",
-  "glGenTransformFeedbacksNV",
-  "glEdgeFlagv",
-  "glVertexAttribI2iv",
-  "glCopyMultiTexImage2DEXT",
-  "glUniformMatrix3x2dv",
-  "glTexImage3DMultisampleCoverageNV",
-  "glGetShaderPrecisionFormat",
-  "glTexSubImage4DSGIS",
-  "glRasterSamplesEXT",
-  "glTextureView",
-  "glEvalMapsNV",
-  "glGetFragDataLocationEXT",
-  "glGetCompressedMultiTexImageEXT",
-  "glIndexMask",
-  "glPushClientAttrib",
-  "glShaderSource",
-  "glDispatchComputeGroupSizeARB",
-  "glLGPUNamedBufferSubDataNVX",
-  "glGetnPixelMapfv",
-  "glTexCoordP2uiv",
-  "glUniform2f",
-  "glGetNamedBufferParameteri64v",
-  "glCommandListSegmentsNV",
-  "glTextureParameterIivEXT",
-  "glMultiTexParameterfvEXT",
-  "glProgramUniform2ui64ARB",
-  "glVertex4d",
-  "glNewObjectBufferATI",
-  "glViewportSwizzleNV",
-  "glBufferData",
-  "glTextureImage1DEXT",
-  "glGetTexParameterIiv",
-  "glCopyTexSubImage1DEXT",
-  "glVertex4f",
-  "glUniformMatrix3fvARB",
-  "glTexCoordP1ui",
-  "glPointParameterfvEXT",
-  "glUniform4fARB",
-  "glImportMemoryFdEXT",
-  "glCopyTextureSubImage3D",
-  "glMultiTexCoord2fv",
-  "glNamedFramebufferSamplePositionsfvAMD",
-  "glNormalP3ui",
-  "glDrawRangeElementArrayATI",
-  "glVertexAttribI1i",
-  "glDrawArraysInstancedARB",
-  "glEnableVertexAttribAPPLE",
-  "glGetDebugMessageLogARB",
-  "glGetPathTexGenfvNV",
-  "glNamedProgramLocalParameters4fvEXT",
-  "glQueryResourceTagNV",
-  "glVertexStream3fvATI",
-  "glFramebufferTexture3D",
-  "glCompressedTextureSubImage2DEXT",
-  "glWindowPos3dv",
-  "glCopyConvolutionFilter2D",
-  "glReadInstrumentsSGIX",
-  "glProgramUniform2dvEXT",
-  "glSamplerParameterfv",
-  "glBindBufferARB",
-  "glVertexAttrib1sNV",
-  "glGetMaterialiv",
-  "glUniform1fv",
-  "glBeginOcclusionQueryNV",
-  "glGenFencesAPPLE",
-  "glScissorIndexedv",
-  "glDisableVariantClientStateEXT",
-  "glMinmaxEXT",
-  "glNormalPointervINTEL",
-  "glNormal3s",
-  "glGetnPixelMapuiv",
-  "glNormalStream3bvATI",
-  "glGetObjectParameterivAPPLE",
-  "glNormal3i",
-  "glUniform1ivARB",
-  "glNormal3d",
-  "glUpdateObjectBufferATI",
-  "glNormal3b",
-  "glGetUniformBufferSizeEXT",
-  "glMultiTexCoord4dv",
-  "glProgramUniform3i64ARB",
-  "glVertexAttrib2d",
-  "glVertexAttrib2f",
-  "glMultiDrawElementsEXT",
-  "glVertexAttrib3dv",
-  "glMultiTexCoord2bOES",
-  "glVertexAttrib2s",
-  "glTexImage3DMultisample",
-  "glGetUniformBlockIndex",
-  "glReleaseKeyedMutexWin32EXT",
-  "glFrontFace",
-  "glEvalCoord1xOES",
-  "glDrawArraysInstancedBaseInstance",
-  "glIsPointInStrokePathNV",
-};
-MEMBER_FUNCTION_POINTER const functionPointers[] = {
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetListParameterivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayElementBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glHintPGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilMaskSeparate_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage3DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetIntegerIndexedvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4usv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexRenderbufferNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInstrumentsBufferSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameter4fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrustumxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawCommandsStatesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexs_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayBindVertexBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ubVertex2fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathGlyphsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCombinerInputParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndPerfMonitorAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstancedBaseInstance_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultTransposeMatrixdARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverStrokePathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeformSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultisamplefv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAURegisterOutputSurfaceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMinSampleShading_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverStrokePathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage2DMultisampleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportMemoryWin32HandleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTessellationFactorAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageControl_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4ubNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorMaterial_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMinSampleShadingARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3b_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUGetSurfaceivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInternalformatSampleivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4ubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NubvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixPushEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayIndexediv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlitFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragmentMaterialfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexEnvxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribLdvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeformationMap3dSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResumeTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInsertEventMarkerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTessellationModeAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawCommandsAddressNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorCounterDataAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteSemaphoresEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadProgramNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWriteMaskEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetGraphicsResetStatus_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImageTransformParameterfvHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragmentLightfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListParameterfSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightModelfSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparateATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayAttribIFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeubvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenFramebuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelMapx_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetAttachedShaders_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelTexGenParameterfvSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDebugMessageLogAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4sATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs4dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glOrthofOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewportArrayv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementArrayATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferStorageMemEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathColorGenfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3iMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferSubDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionFilter2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMemoryBarrierByRegion_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayBindingDivisor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixRotatedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsProgramNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelMapuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthBoundsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPointerv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathCommandsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetListParameterfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageInsertAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrustum_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearColorxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleMaskIndexedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompileShaderIncludeARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetArrayObjectfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4svATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoadfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadIdentityDeformationMapSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetRenderbufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedRenderbufferStorage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFragDataLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonOffsetClamp_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFenceSync_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferDrawBuffersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs4fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPauseTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjecti64vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUSurfaceAccessNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glValidateProgramPipeline_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexPageCommitmentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilStrokePathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenQueriesARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1ivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameterI4iNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenVertexArraysAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTransformFeedbackInstanced_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilThenCoverStrokePathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteVertexArraysAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferParameterui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glQueryMatrixxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3usv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTranslatexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAURegisterVideoSurfaceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferBaseNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenQueryResourceTagNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nbv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListParameteriSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendColorxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsSync_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordhvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureLayerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectPtrLabel_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2x3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferDrawBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyColorSubTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedFramebufferParameterfvAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentMaterialfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoadTranspose3x3fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteNamesAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawRangeElementsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glOrtho_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage4DSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteBuffersARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapBufferARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaterialxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTestObjectAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderbufferStorageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndFragmentShaderATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrameZoomSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLGPUInterlockNVX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3svATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathStencilFuncNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetInvariantEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexBumpParameterivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparateEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndOcclusionQueryNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScissorArrayv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCallList_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapTexture2DINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVkProcAddrNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransferxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteRenderbuffersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnColorTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureLayerARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCombinerStageParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribLFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glElementPointerAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1fATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverageModulationNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteSync_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaxShaderCompilerThreadsARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4x2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsImageHandleResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonMode_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferSamplePositionsfvAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionFilter1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsVertexArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUseProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLineStipple_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVideoCaptureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x2fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureLightEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVideoCaptureStreamBufferNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage2DMultisampleCoverageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetAttribLocationARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4fVertex4fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackAttribsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateShaderObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4usv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribBinding_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetShaderSource_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexImageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPointerIndexedvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsNameAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ub_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferParameteriAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInternalformativ_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4us_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLinkProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectLabel_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageCallbackARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetString_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndQuery_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrioritizeTexturesxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlagPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiModeDrawElementsIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyPixels_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClampColorARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorPointervINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmaxParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3sMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeusSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedFramebufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1fvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateVertexArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginConditionalRender_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUnsignedBytevEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionFilter1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScalexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameterf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderOp1EXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginVideoCaptureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnHistogram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderMode_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearColorIiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSignalSemaphoreEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniformBlockiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirectCount_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexEnvfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableParameterivSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCullFace_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteFencesAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformHandleui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewportIndexedf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3ivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointAlongPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndQueryARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUMapSurfacesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4uivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageMem3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAttachShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFenceivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageSparseAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapNamedBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateMemoryObjectsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ubVertex2fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTransformFeedbackStreamInstanced_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpriteParameterfSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVideoCaptureStreamTextureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushPixelDataRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribLFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModelfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedTexImageARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexWeighthNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorMaskIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorMaski_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorFragmentOp1ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4ubvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteQueriesARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportMemoryWin32NameEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStringMarkerGREMEDY_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectLabelEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformHandleui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRotated_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsProgramPipeline_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRotatef_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveSubroutineUniformName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4sNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameter4dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeubSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportSemaphoreWin32HandleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexWeightPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3sEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaFunc_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferPageCommitmentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameters4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilFunc_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSemaphoreParameterui64vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribdvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryBufferObjectiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGenxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightEnviSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramPipelineiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2ivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetShaderInfoLog_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetOcclusionQueryuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateNamedFramebufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUInitNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetIntegerui64i_vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformHandleui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3ivMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparate_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstancedARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSubroutineIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplePatternSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathParameterfNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformi64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaterialxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameter4fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3bEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginPerfQueryINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImageTransformParameterivHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindProgramPipeline_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScissor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBooleanv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaterialfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4fvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribIPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramBufferParametersfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaFuncxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirectAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3ivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage3DMultisampleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeusvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPollInstrumentsSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureLevelParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapControlPointsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexGenfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmaxEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsFenceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixFrustumEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDispatchComputeIndirect_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glQueryResourceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameter4dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexLevelParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinalCombinerInputNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCullParameterdvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapVertexAttrib1fAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderGpuMaskNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListBase_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindMaterialParameterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactorubSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetImageTransformParameterivHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorSubTableEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTexGenParameterfvSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClientWaitSync_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glQueryObjectParameteruiAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs1fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NusvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParametersI4ivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathGlyphIndexArrayNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyImageSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformSubroutineuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVertexBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageInsert_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginVertexShaderEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsVariantEnabledEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPassThroughxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsSampler_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConservativeRasterParameterfNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGenivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTexture2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCheckFramebufferStatus_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindImageTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackVaryings_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastBufferSubDataNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawRangeElements_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferBase_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSyncTextureINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateSamplers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerParameterfNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetArrayObjectivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleMapATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirectCountARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageMem1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2ivMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferDataARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribIFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateFramebuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3dvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearAccum_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginQuery_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeImageHandleResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2x4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangeIndexed_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsEnabled_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixScalefEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetError_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexEnviv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTextureUnitParameterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeletePerfQueryINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveVaryingNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniformARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedCopyBufferSubDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelMapfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateSyncFromCLeventARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelMapusv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnColorTableARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAccum_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFunciARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFramebufferAttachmentParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilMask_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResetHistogramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3sATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformHandleui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateProgramObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectParameterfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectsv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectBufferivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparateINGR_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoCaptureStreamfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexGeniv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelStorei_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedTextureSubImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyImageSubDataNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveShaderProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1iATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPatchParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsFramebufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelTexGenParameterivSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClipControl_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourceiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleMaskSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactorfSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparateIndexedAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfCounterInfoINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteProgramsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelZoomxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCombinerOutputParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2dvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathStencilDepthOffsetNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsStateNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetIntegerui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetImageTransformParameterfvHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsMemoryObjectEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightPointerARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinishFenceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexArrayAttribEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDoubleIndexedvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2fMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3b_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyConvolutionFilter1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFramebufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenPathsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenRenderbuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4ubvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTextureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs1svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedBufferSubDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparate_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantFloatvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2dMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFragDataLocationEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage1DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureImageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointSize_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTextureUnit_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameterI4uiNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramPipelineInfoLog_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWaitSync_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparatei_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveProgramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetFragmentShaderConstantATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorSubTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStateCaptureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindAttribLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightusvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragDataIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMemoryObjectParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightPathsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerStageParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMultfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexLevelParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureLevelParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaFragmentOp2ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteFramebuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbackiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnTexImageARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClear_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayParameteriAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoCaptureStreamdvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightModelivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTranslatef_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nub_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTranslated_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsIndirect_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeletePerfMonitorsAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawCommandsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMultTransposedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRequestResidentProgramsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaFragmentOp1ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjecti64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMult3x3fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathSubCommandsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFinalCombinerInputParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsRenderbuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGenfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrustumfOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVertexBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMateriali_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexAttribArray_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlitNamedFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoadTransposefEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGenfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderStorageBlockBinding_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaterialf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCheckNamedFramebufferStatusEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribFormatEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteVertexShaderEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSignalVkFenceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameterI4ivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactoriSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3sEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramInterfaceiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixIndexPointerARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGeniEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramStringEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapNamedBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmaxParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndConditionalRenderNVX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3iATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramBufferParametersIivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid1xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribPointervARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushMappedNamedBufferRangeEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPatchParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexFilterFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3dATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindProgramNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramLocalParameterfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenFragmentShadersATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBumpParameterivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnSeparableFilter_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPassTexCoordATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureFaceARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayFogCoordOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteNamedStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastGetQueryObjecti64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenOcclusionQueriesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLighti_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClientAttribDefaultEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4bvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribIFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilFuncSeparate_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClientActiveVertexStreamATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleCoverage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearDepthxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastGetQueryObjectuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFirstPerfQueryIdINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapNamedBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbacki_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFloati_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindAttribLocationARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferAddressRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenProgramsARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexEnvivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureFaceEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureLayer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayPointeri_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameter4dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3bEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionFilter2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyMultiTexSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameterI4iNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathMemoryGlyphIndexArrayNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilOp_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnvf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenPerfMonitorsAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInteger64i_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncIndexedAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnvi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsEnabledi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixTranslatedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeTextureHandleResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMultdEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportSyncEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportSemaphoreFdEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPNTrianglesiATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVertexArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glObjectPtrLabel_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDebugMessageLog_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTrackMatrixNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramPathFragmentInputGenNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeTextureHandleNonResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs4ubvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClipPlanexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPolygonStippleARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModelf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteMemoryObjectsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModeli_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexWeighthvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramNamedParameter4dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirect_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCallLists_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCombinerOutputParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushDebugGroup_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetStageIndexNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferPointervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBarrierNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ubVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCommandHeaderNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorCounterInfoAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerParameteriNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMultTransposefEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDetailTexFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAreTexturesResident_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastGetQueryObjectivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorFragmentOp3ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResizeBuffersMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmaxParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClientActiveTextureARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVertexArray_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4b_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlagFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstanced_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexArrayAttribEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glObjectUnpurgeableAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs2dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexFilterFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpriteParameterfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyMultiTexImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2x4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourceLocationIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewport_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramNamedParameter4fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInvariantBooleanvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorage2DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelStorex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveSubroutineUniformiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribPointerARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage2DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageMem1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glArrayElement_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glValidateProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelStoref_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs2fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRecti_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramParameterdvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap1xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReferencePlaneSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastBlitFramebufferNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCombinerInputParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureSamplerHandleARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRects_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveAttribARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glHistogramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureSamplerHandleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDetachShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinishTextureSUNX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3x4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathColorGenivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourceLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayAttribLFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexLevelParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewportIndexedfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBuffersBase_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBumpParameterfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixIndexuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3svMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilOpSeparateATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsBaseVertex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationSeparateiARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapVertexAttrib2fAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeTextureHandleNonResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4dATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs2hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClipPlanefOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderbufferStorage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glValidateProgramARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGenf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGend_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGeni_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteFramebuffersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResetMinmaxEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsQueryARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVariantClientStateEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScissorIndexed_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInvariantIntegervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameterI4uiNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenFramebuffersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayColorOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexWeightfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTextureHandleResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4ivMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantPointervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapNamedBufferRangeEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateShaderProgramv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaxShaderCompilerThreadsKHR_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPNTrianglesfATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactorusSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenerateMipmap_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonOffsetClampEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureRangeAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationIndexedAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameteri_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUnsignedBytei_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapNamedBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleMaskEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameter4dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameterfvSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTextureFaceEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilFillPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReleaseShaderCompiler_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageMem3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsVertexAttribEnabledAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReadPixels_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetFenceAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightsvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShadeModel_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageMem3DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConservativeRasterParameteriNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedBufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearDepthf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreatePerfQueryINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReadnPixelsARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4dvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateNamedFramebufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorP4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUseProgramStages_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathTexGenNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexBlendEnviATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadMatrixf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferDrawBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapAttribParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribLdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedRenderbufferStorageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTexGenParameteriSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glExecuteProgramNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantArrayObjectATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnConvolutionFilterARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInvariantFloatvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedFramebufferiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenSamplers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawRangeElementArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixPopEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1sATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexEnviEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameter4fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWaitSemaphoreEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantIntegervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteLists_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGendv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorGroupsAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultTransposeMatrixfARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteStatesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferParameteri64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlagPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVideoCaptureStreamParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4iATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUFiniNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeBufferNonResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilStrokePathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpriteParameteriSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeTextureHandleResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultMatrixxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureNormalEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInstrumentsSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionFilterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCurrentPaletteMatrixARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateRenderbuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nusv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerInputNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthFunc_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4fMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableClientStateIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFunci_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResolveDepthValuesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureColorMaskSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateShaderProgramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferStorage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeNamedBufferNonResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderbufferStorageMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFloati_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1svATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3fATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferDrawBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordPointervINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2iATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAsyncMarkerSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageSparseAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndPerfQueryINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightModeliSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrioritizeTexturesEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndConditionalRender_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableClientState_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResetHistogram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetOcclusionQueryivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenerateMultiTexMipmapEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3dvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLabelObjectEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexEnvfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexGendv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameter4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3usv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelTransformParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthMask_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAreProgramsResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginQueryIndexed_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1dvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexEnvfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteFencesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs1dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferStorageExternalEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2sATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnSeparableFilterARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveStencilFaceEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointSizexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindParameterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendParameteriNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameter4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformHandleui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathMetricsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNewList_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoad3x3fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribDivisorARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnCompressedTexImageARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetIntegerv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoaddEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathLengthNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawPixels_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultMatrixd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultMatrixf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodePointerSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadTransposeMatrixdARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompileShaderARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3dMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3fvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4usv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonStipple_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSubroutineUniformLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFramebufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelMapusv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSamplerParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2fvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSeparableFilter2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLGPUCopyImageSubDataNVX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexGendvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniform_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeNamedBufferResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathGlyphIndexRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameterI4ivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastGetQueryObjectui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameterfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTextureLayer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayIntegervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUIsSurfaceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsAsyncMarkerSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDoublei_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsCommandListNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferRenderbuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformLocationARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3sNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDoublei_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindSampler_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLineWidth_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayRangeAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetIntegeri_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbackVarying_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameter4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbackVaryingNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream1dATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorFragmentOp2ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureHandleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModeliv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangef_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragmentMaterialivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVideoCaptureStreamParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteProgramsARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFeedbackBufferxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexBumpParameterfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnablei_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveSubroutineName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawBuffersARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindProgramARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFloatIndexedvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleCoverageARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelDataRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3svATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSampleMaski_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexFuncEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameteriNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3x2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFramebufferParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferStorageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTexture3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayPointervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribArrayObjectivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexArrayEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableParameterfvSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlag_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpriteParameterivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathGlyphRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrimitiveBoundingBoxARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeletePathsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrimitiveRestartIndexNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyNamedBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenProgramsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightfSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportSemaphoreWin32NameEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3x4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSubpixelPrecisionBiasNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NsvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPassThrough_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateTexSubImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsImageHandleResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBegin_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3ubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilClearTagEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniformName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangentPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageEnableAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenRenderbuffersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationiARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixOrthoEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParametersI4ivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedStringivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackBufferBase_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexsv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDetailTexFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameter4fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBitmap_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTextureLayerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGenfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilFuncSeparateATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapGrid2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListParameterivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateQueries_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSamplerParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glObjectLabel_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureHandleARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformIndices_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverageModulationTableNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveVaryingNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixTranslatefEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureMaterialEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInterpolatePathsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelTransformParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantBooleanvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysInstancedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableClientStateIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapusv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInternalformati64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderSourceARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderOp3EXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2dvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProvokingVertexEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantubvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlush_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPresentFrameDualFillNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenVertexShadersEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpecializeShaderARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformHandleui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangefOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteVertexArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexLevelParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawVkImageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrioritizeTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3fvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x2dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorage3DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilOpValueAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramVertexLimitNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterPointervAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClampColor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearStencil_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs3svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexBlendEnvfATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsFenceAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferParameterui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4bvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStopInstrumentsSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapVertexAttrib2dAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3bvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonOffset_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3bvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glHistogram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixIndexubvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribLui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushMappedBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI3uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLineWidthxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexEnvivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTexGenParameterivSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenQueries_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelMapfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendColorEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResetMinmax_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexBlendARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVaryingLocationNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapAttribParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteSamplers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLightxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribArrayObjectfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayNormalOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferParameterivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawMeshArraysSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultisamplefvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathCommandsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayTexCoordOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMode_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x2fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadMatrixxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixRotatefEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetClipPlanexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfQueryInfoINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDoublev_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferRangeEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapBufferARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathSpacingNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactordSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetShaderSourceARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateBufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoad3x2fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenTexturesEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3bvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapusvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMemoryObjectParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenSemaphoresEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedBufferDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3fMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteRenderbuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureLevelParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElements_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeImageHandleNonResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3dATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowRectanglesEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferReadBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexGenfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginQueryARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateSubFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTestFenceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyMultiTexSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantbvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenFencesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnConvolutionFilter_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightbvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginConditionalRenderNVX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinish_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentCoverageColorNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewportPositionWScaleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramLocalParameterIuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4fvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeformationMap3fSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearDepth_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenAsyncMarkersSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexWeightfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramLocalParameterIivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage3DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameter4fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInsertComponentEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateBuffers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGenxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultTransposeMatrixf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginTransformFeedbackEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFreeObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendBarrierNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaFragmentOp3ATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameters4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparateEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTexGenSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4x3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoCaptureStreamivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeImageHandleNonResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteQueries_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInitNames_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glArrayElementEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameter4dNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopGroupMarkerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedFramebufferuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetLocalConstantEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDispatchCompute_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentColorMaterialSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMinmaxARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLogicOp_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4iMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransferf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexPointervINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSeparableFilterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTransformFeedbackStream_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProvokingVertex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAccumxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderBinary_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexGenivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateStatesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearDepthdNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearColorIuiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindMultiTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexGeniv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElements_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexArrayEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClientActiveTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastBarrierNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribArrayObjectATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysInstanced_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2sNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2fATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageCallbackAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndQueryIndexed_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3sATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameteriARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnvxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexAttribAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindRenderbuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexSubImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirectAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramInfoLog_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLocalConstantBooleanvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransformParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParametersI4uivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadTransposeMatrixfARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImageTransformParameteriHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs3fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentMaterialiSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBooleani_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourceIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginConditionalRenderNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableClientState_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathFogGenNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilThenCoverFillPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayIndexOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramBufferParametersIuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransformParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableClientStateiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexBufferARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLocalConstantIntegervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferPointervARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalMesh2_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalMesh1_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilThenCoverFillPathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapVertexAttrib1dAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadTransposeMatrixd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadTransposeMatrixf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPointervEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSignalVkSemaphoreNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndConditionalRenderNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramNamedParameter4dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompileCommandListNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetRenderbufferParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPolygonStipple_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsBufferResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ubvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedRenderbufferParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGendvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTextureHandleResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramEnvParameterdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsNamedStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4ubvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTagSampleBufferSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUUnregisterSurfaceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfQueryIdByNameINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInteger64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClipPlane_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4ubVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexub_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramEnvParameterfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4usvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferRenderbuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTestFenceAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Niv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL2i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorP4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2x3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCallCommandListNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedStringARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMult3x2fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramStringEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnHistogramARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureLevelParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBitmapxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSamplerParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribLPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs2svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsEnabledIndexedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3us_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginPerfMonitorAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReadnPixels_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3ub_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL3ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCheckFramebufferStatusEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexAttribArrayARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPolygonStipple_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathDashArrayNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteOcclusionQueriesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameter4dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnlockArraysEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectui64vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4ivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopClientAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinishObjectAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmaxParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteTransformFeedbacks_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoi64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawRangeElementsBaseVertex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage3DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushGroupMarkerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoadIdentityEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultTransposeMatrixxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPixelMapxv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferSampleLocationsfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLightiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparatei_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAcquireKeyedMutexWin32EXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBooleanIndexedvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramSubroutineParameteruivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWaitVkSemaphoreNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisablei_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSelectPerfMonitorCountersAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribLi64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparateiARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightuivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2iARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramLocalParameterdvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3us_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSynciv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeImageHandleResidentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramNamedParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListDrawCommandsStatesClientNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParametersI4uivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramBinary_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalPoint1_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalPoint2_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPauseTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2sMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactorbSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateTransformFeedbacks_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexturePageCommitmentEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackVaryingsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlitFramebufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameter4dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageMem2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMultiTexLevelParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsOcclusionQueryNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage2DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramEnvParameterIuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindVertexShaderEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x2dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord1hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadMatrixd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantdvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCullParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsBufferARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordhNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferSampleLocationsfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenSymbolsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionFilter_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNextPerfQueryIdINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage1DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindSamplers_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramEnvParameterIivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectui64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorMask_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginFragmentShaderATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenNamesAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathParameteriNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateCommandListsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteProgramPipelines_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyColorSubTableEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantsvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenProgramPipelines_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glOrthoxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformSubroutinesuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRectdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ubEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexGendEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoordfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompileShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixLoadTransposedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedTextureImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapfvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirectCount_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribIPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvaluateDepthValuesARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4fNormal3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSeparableFilter2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearAccumxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInvalidateFramebuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightubvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedFramebufferfi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryBufferObjectuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearNamedFramebufferfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndVertexShaderEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetClipPlanefOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWeightivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSeparableFilter_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathTexGenivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferPageCommitmentARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadIdentity_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4x3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBarrier_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuivSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteAsyncMarkersSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSharpenTexFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformHandleui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIglooInterfaceSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearBufferfi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysIndirect_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenVertexArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbacki64_v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexArrayAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4fATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexBindingDivisor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSamplerParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCoverageModulationTableNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribFormatNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryBufferObjecti64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformi64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAreTexturesResidentEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHandleARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVideoCaptureStreamParameterdvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsVertexArray_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3sEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrameTerminatorGREMEDY_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendBarrierKHR_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NubARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrimitiveRestartNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL1ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs4svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4svEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage3DMultisampleCoverageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMemoryBarrier_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantArrayObjectfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsProgramARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindImageTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragDataLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage2DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMaterialfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4NbvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelMapuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableClientStateiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearTexSubImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDetachObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantusvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureImage3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayIntegeri_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4ubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTexGenParameterfSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyMultiTexSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexAttribArrayARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastCopyBufferSubDataNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniformsiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUseProgramObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetAttribLocation_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferStorageMemEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathSubCoordsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixIndexusvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideouivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoCaptureivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixScaledEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragmentLightivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetStringi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribPointervNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushMatrix_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlagPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenerateMipmapEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathCoordsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEGLImageTargetTexture2DOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelZoom_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferReadBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glExtractComponentEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMinmax_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfvSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendEquationi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFogFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMinmax_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightiSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord1bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColorPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoordP4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferSubDataARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathParameterivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushRasterSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glElementPointerATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetAttachedObjectsARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSharpenTexFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearDepthfOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteCommandListsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSpecializeShader_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorage2DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFuncSeparateIndexedAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMakeBufferResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderOp2EXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfQueryDataINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveUniformBlockName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthBoundsdNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteTexturesEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawBuffersATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModelxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glApplyTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetImageHandleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMinmax_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFixedvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplePatternEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoorddvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushMappedBufferRangeAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushStaticDataIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndTransformFeedbackEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureSubImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedRenderbufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBuffersRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinishAsyncSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFragDataLocationIndexed_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushVertexArrayRangeAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3dvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFeedbackBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageInsertARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetShaderiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glArrayObjectATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPointeri_vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorCountersAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferStorage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnvxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransferi_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3usvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameterI4uivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4dMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageControlARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentMaterialivSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLinkProgramARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFinishFenceAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribBindingEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageMem3DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPollAsyncSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVariantivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUnmapTexture2DINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastWaitSyncNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathCoordsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor4xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackVaryingsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCombinerOutputNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4sMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4svARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsList_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetInfoLogARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs3dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactorsSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTrackMatrixivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsNamedBufferResidentNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTbufferMask3DFX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverFillPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenerateTextureMipmap_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsBaseVertex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramSubroutineParametersuivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2x4dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRotatexOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMemoryBarrierEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3svNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3iATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetFenceNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAttachObjectARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyConvolutionFilter1D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageMem2DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameters4fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferParameteriEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4Nsv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4usvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureBufferRangeEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexP3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnUniformi64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureMultiviewOVR_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedMultiTexSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnMapdv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDebugMessageCallback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3svEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribParameteriAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferSubDataARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribLui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImageTransformParameterfHP_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap1f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMapControlPointsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3dvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalPointerListIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogFuncSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiModeDrawArraysIBM_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFloatv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glHint_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2svATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawArraysIndirect_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexEnvfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribP2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1i64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTextureARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushClientAttribDefaultEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScalef_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScaled_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetConvolutionParameterxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourceName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyColorTable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDepthRangeArrayv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCoverFillPathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetActiveAtomicCounterBufferiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilOpSeparate_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameterivSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayAttribBinding_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsSemaphoreEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramParameters4dvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribL4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribPointerv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glResumeTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3i64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathMetricRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2iMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnCompressedTexImage_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReplacementCodeuiVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTransformFeedbackVaryingEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapNamedBufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisable_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsPointInFillPathNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glQueryCounter_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormal3svEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferOffsetNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramResourcefvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBinormalPointerEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLightfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMulticastCopyImageSubDataNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex2bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetHistogramParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramStringNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexGenxvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glObjectPurgeableAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColorTableSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyConvolutionFilter2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoorddv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferPointerv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform1fEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2fvMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glAlphaToCoverageDitherControlNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPolygonOffsetxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformHandleui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentLightModelfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSwizzleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindFragmentShaderATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs3hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenBuffersARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureStorageMem2DMultisampleEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glListParameterfvSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedRenderbufferStorageMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLightModelxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReadBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStencilFillPathInstancedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVDPAUUnmapSurfacesNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform4i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream4dvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsQuery_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushMappedNamedBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushName_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetClipPlane_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendColor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameterIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexubv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferPageCommitmentEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCheckNamedFramebufferStatus_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectBufferfvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorCounterStringAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstancedEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameterI4iEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterPos4s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramStageiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMaterialxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopMatrix_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVideoui64vNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3bEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetGraphicsResetStatusARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexAttribArray_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4fVertex4fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRenderbufferStorageMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateProgramPipelines_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribLPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2uiEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3sv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawElementsInstancedBaseVertex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransformParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage2DMultisampleCoverageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsTexture_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnvfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPopDebugGroup_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformBlockBinding_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2svMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenerateTextureMipmapEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindLightParameterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord3bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordPointer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix3x2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramLocalParameterI4uivNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFlushVertexArrayRangeNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3svEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetBufferParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryIndexediv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture3DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLoadTransposeMatrixxOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteTransformFeedbacksNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedTextureImageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexMaterialEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFogCoorddEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFramebufferParameterfvAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexEnviv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndTransformFeedbackNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGlobalAlphaFactoruiSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSelectBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferSubDataEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVertexArrayAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBlendFunc_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCreateProgram_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream2dATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ui64vARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetSemaphoreParameterui64vEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPrimitiveRestartIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3fATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribs1hvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos4svMESA_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteFragmentShaderATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindImageTextures_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMap2xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1i64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathStringNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedFramebufferParameterivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetProgramNamedParameterdvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathDashArrayNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glColor3fVertex3fvSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultTransposeMatrixd_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glClearColor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetImageHandleARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTangent3dEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryObjectivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetLocalConstantFloatvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUseShaderProgramEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindRenderbufferEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glInterleavedArrays_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPerfMonitorGroupStringAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDeleteQueryResourceTagNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ub_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFragmentMaterialfSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVariantArrayObjectivATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1dARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferPointerv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLockArraysEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribPointerNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glConvolutionParameterf_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferBaseEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2xvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetQueryBufferObjectui64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSetMultisamplefvAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathColorGenNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib4ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenTransformFeedbacks_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexAttribIuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPixelTransformParameterfEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterIuivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectParameterivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos2fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTexSubImage3DARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramBinary_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPresentFrameKeyedNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI4bv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPathCoverDepthFuncNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTransformFeedbackStreamAttribsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3usEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyColorTableSGI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramEnvParameter4fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4sARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetVertexArrayIndexed64iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMatrixMultTranspose3x3fNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexArrayAttribFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndTransformFeedback_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawCommandsStatesAddressNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4ui64NV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMaterialiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage2DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTextureEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsBuffer_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFinalCombinerInputParameterfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3bvOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribDivisor_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyBufferSubData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindTexGenParameterEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3bATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexStorageMem2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetColorTableParameteriv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glActiveTextureARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord4xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedBufferStorageExternalEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSecondaryColor3fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix4x2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glStartInstrumentsSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramNamedParameter4fvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndVideoCaptureNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenLists_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferTexture1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMapBufferRange_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsIndirectCountARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniformMatrix4x2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTextureParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord3hNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEndList_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenTransformFeedbacksNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEdgeFlagv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI2iv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyMultiTexImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3x2dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage3DMultisampleCoverageNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetShaderPrecisionFormat_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexSubImage4DSGIS_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glRasterSamplesEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureView_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalMapsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetFragDataLocationEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetCompressedMultiTexImageEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIndexMask_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPushClientAttrib_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glShaderSource_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDispatchComputeGroupSizeARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glLGPUNamedBufferSubDataNVX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP2uiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetNamedBufferParameteri64v_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCommandListSegmentsNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureParameterIivEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2ui64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNewObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glViewportSwizzleNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBufferData_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTextureImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetTexParameterIiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTexSubImage1DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertex4f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniformMatrix3fvARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexCoordP1ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glPointParameterfvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform4fARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glImportMemoryFdEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyTextureSubImage3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalP3ui_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawRangeElementArrayATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttribI1i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysInstancedARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEnableVertexAttribAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetDebugMessageLogARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetPathTexGenfvNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNamedProgramLocalParameters4fvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glQueryResourceTagNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexStream3fvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFramebufferTexture3D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCompressedTextureSubImage2DEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glWindowPos3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glCopyConvolutionFilter2D_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReadInstrumentsSGIX_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform2dvEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glSamplerParameterfv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBindBufferARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib1sNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetMaterialiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1fv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glBeginOcclusionQueryNV_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGenFencesAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glScissorIndexedv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDisableVariantClientStateEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMinmaxEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalPointervINTEL_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetnPixelMapuiv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormalStream3bvATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetObjectParameterivAPPLE_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3i_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUniform1ivARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glUpdateObjectBufferATI_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glNormal3b_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformBufferSizeEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord4dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glProgramUniform3i64ARB_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2d_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2f_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiDrawElementsEXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib3dv_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glMultiTexCoord2bOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glVertexAttrib2s_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glTexImage3DMultisample_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glGetUniformBlockIndex_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glReleaseKeyedMutexWin32EXT_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glFrontFace_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glEvalCoord1xOES_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glDrawArraysInstancedBaseInstance_impl),
-  (MEMBER_FUNCTION_POINTER)(&LoaderTableDecorator::m_glIsPointInStrokePathNV_impl),
-};
-FUNCTION_POINTER *baseFunctions = (FUNCTION_POINTER*)&this->FunctionTable::m_glMultiDrawArraysIndirectBindlessCountNV;
-for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
-  baseFunctions[i] = this->m_functionLoader->load(functionNames[i]);
-MEMBER_FUNCTION_POINTER *memberFunctions = (MEMBER_FUNCTION_POINTER*)&this->FunctionTable::m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
-for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
-  if(baseFunctions[i])memberFunctions[i] = functionPointers[i];
-  else memberFunctions[i] = nullptr;
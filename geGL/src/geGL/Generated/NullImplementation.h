@@ -0,0 +1,2926 @@
+static void m_glMultiDrawArraysIndirectBindlessCountNV_null(GLenum,const void*,GLsizei,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glTextureParameterfv_null(GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glGetListParameterivSGIX_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniform1i64ARB_null(GLuint,GLint,GLint64){return (void)0;}
+static void m_glVertexArrayElementBuffer_null(GLuint,GLuint){return (void)0;}
+static void m_glHintPGI_null(GLenum,GLint){return (void)0;}
+static void m_glStencilMaskSeparate_null(GLenum,GLuint){return (void)0;}
+static void m_glGetFramebufferAttachmentParameterivEXT_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glTextureStorage3DMultisample_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glGetIntegerIndexedvEXT_null(GLenum,GLuint,GLint*){return (void)0;}
+static void m_glCopyTexImage1D_null(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){return (void)0;}
+static void m_glVertexAttrib4usv_null(GLuint,const GLushort*){return (void)0;}
+static void m_glTexRenderbufferNV_null(GLenum,GLuint){return (void)0;}
+static void m_glVertexAttrib3hvNV_null(GLuint,const GLhalfNV*){return (void)0;}
+static void m_glProgramUniform4ui64ARB_null(GLuint,GLint,GLuint64,GLuint64,GLuint64,GLuint64){return (void)0;}
+static void m_glInstrumentsBufferSGIX_null(GLsizei,GLint*){return (void)0;}
+static void m_glIndexi_null(GLint){return (void)0;}
+static void m_glMultiTexCoord2sARB_null(GLenum,GLshort,GLshort){return (void)0;}
+static void m_glProgramEnvParameter4fARB_null(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glCompressedTexSubImage3D_null(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glEvalCoord2d_null(GLdouble,GLdouble){return (void)0;}
+static void m_glEvalCoord2f_null(GLfloat,GLfloat){return (void)0;}
+static void m_glIndexd_null(GLdouble){return (void)0;}
+static void m_glSecondaryColor3hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glIndexf_null(GLfloat){return (void)0;}
+static void m_glFrustumxOES_null(GLfixed,GLfixed,GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glTextureStorage3DEXT_null(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glDrawCommandsStatesNV_null(GLuint,const GLintptr*,const GLsizei*,const GLuint*,const GLuint*,GLuint){return (void)0;}
+static void m_glUniform4uiEXT_null(GLint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramUniform3ui64ARB_null(GLuint,GLint,GLuint64,GLuint64,GLuint64){return (void)0;}
+static void m_glIndexs_null(GLshort){return (void)0;}
+static void m_glVertexArrayBindVertexBufferEXT_null(GLuint,GLuint,GLuint,GLintptr,GLsizei){return (void)0;}
+static void m_glConvolutionParameteriEXT_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glColor4ubVertex2fSUN_null(GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat){return (void)0;}
+static void m_glProgramUniform1ivEXT_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glGetnMapfv_null(GLenum,GLenum,GLsizei,GLfloat*){return (void)0;}
+static void m_glTransformFeedbackBufferRange_null(GLuint,GLuint,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glPathGlyphsNV_null(GLuint,GLenum,const void*,GLbitfield,GLsizei,GLenum,const void*,GLenum,GLuint,GLfloat){return (void)0;}
+static void m_glSecondaryColor3fv_null(const GLfloat*){return (void)0;}
+static void m_glGetCombinerInputParameterivNV_null(GLenum,GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glEndPerfMonitorAMD_null(GLuint){return (void)0;}
+static void m_glPointParameterfvARB_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glVertex2xOES_null(GLfixed){return (void)0;}
+static void m_glDrawElementsInstancedBaseInstance_null(GLenum,GLsizei,GLenum,const void*,GLsizei,GLuint){return (void)0;}
+static void m_glMultTransposeMatrixdARB_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttribL4dEXT_null(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertex4iv_null(const GLint*){return (void)0;}
+static void m_glCoverStrokePathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glDeformSGIX_null(GLbitfield){return (void)0;}
+static void m_glUniform2ui64NV_null(GLint,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glCopyPathNV_null(GLuint,GLuint){return (void)0;}
+static void m_glVertexAttribP4ui_null(GLuint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glVertexAttribL2d_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static void m_glGetMultisamplefv_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glCompressedMultiTexSubImage3DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_null(const void*,GLenum,GLsizei,const GLuint*){return (GLvdpauSurfaceNV)0;}
+static void m_glMinSampleShading_null(GLfloat){return (void)0;}
+static void m_glProgramUniform4fEXT_null(GLuint,GLint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glCoverStrokePathNV_null(GLuint,GLenum){return (void)0;}
+static void m_glTextureImage2DMultisampleNV_null(GLuint,GLenum,GLsizei,GLint,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glVertex3bOES_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glImportMemoryWin32HandleEXT_null(GLuint,GLuint64,GLenum,void*){return (void)0;}
+static void m_glTessellationFactorAMD_null(GLfloat){return (void)0;}
+static void m_glDebugMessageControl_null(GLenum,GLenum,GLenum,GLsizei,const GLuint*,GLboolean){return (void)0;}
+static GLboolean m_glIsObjectBufferATI_null(GLuint){return (GLboolean)0;}
+static void m_glPopAttrib_null(){return (void)0;}
+static void m_glProgramUniform4iEXT_null(GLuint,GLint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glVertexAttrib4ubNV_null(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glColorMaterial_null(GLenum,GLenum){return (void)0;}
+static void m_glVertexAttrib2svARB_null(GLuint,const GLshort*){return (void)0;}
+static void m_glMinSampleShadingARB_null(GLfloat){return (void)0;}
+static void m_glColor3b_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glColor3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVDPAUGetSurfaceivNV_null(GLvdpauSurfaceNV,GLenum,GLsizei,GLsizei*,GLint*){return (void)0;}
+static void m_glColor3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetnMapiv_null(GLenum,GLenum,GLsizei,GLint*){return (void)0;}
+static void m_glColor3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glGetInternalformatSampleivNV_null(GLenum,GLenum,GLsizei,GLenum,GLsizei,GLint*){return (void)0;}
+static void m_glVertexAttrib4ubv_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glColor3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttribs4hvNV_null(GLuint,GLsizei,const GLhalfNV*){return (void)0;}
+static void m_glVertexAttrib4NubvARB_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glMultiTexCoord3hvNV_null(GLenum,const GLhalfNV*){return (void)0;}
+static void m_glMatrixPushEXT_null(GLenum){return (void)0;}
+static void m_glProgramUniform2fEXT_null(GLuint,GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glGetVertexArrayIndexediv_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glBlitFramebuffer_null(GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){return (void)0;}
+static void m_glMultiTexCoordP2ui_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glColorPointerListIBM_null(GLint,GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glVertexAttribL4d_null(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetFragmentMaterialfvSGIX_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertex2iv_null(const GLint*){return (void)0;}
+static void m_glGetTexEnvxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glUniformMatrix3dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetVertexAttribLdvEXT_null(GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glTexCoordP3uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glDeformationMap3dSGIX_null(GLenum,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){return (void)0;}
+static void m_glResumeTransformFeedback_null(){return (void)0;}
+static void m_glInsertEventMarkerEXT_null(GLsizei,const GLchar*){return (void)0;}
+static void m_glTessellationModeAMD_null(GLenum){return (void)0;}
+static void m_glDrawCommandsAddressNV_null(GLenum,const GLuint64*,const GLsizei*,GLuint){return (void)0;}
+static void m_glFogi_null(GLenum,GLint){return (void)0;}
+static void m_glGetTexParameterxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glVertexPointer_null(GLint,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glGetPerfMonitorCounterDataAMD_null(GLuint,GLenum,GLsizei,GLuint*,GLint*){return (void)0;}
+static void m_glFogf_null(GLenum,GLfloat){return (void)0;}
+static void m_glMultiTexCoord1d_null(GLenum,GLdouble){return (void)0;}
+static void m_glMultiTexCoord1f_null(GLenum,GLfloat){return (void)0;}
+static void m_glGetMultiTexParameterivEXT_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniformMatrix3x4fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glVertexAttribI2i_null(GLuint,GLint,GLint){return (void)0;}
+static void m_glMultiTexCoord1i_null(GLenum,GLint){return (void)0;}
+static void m_glDeleteSemaphoresEXT_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glLoadProgramNV_null(GLenum,GLuint,GLsizei,const GLubyte*){return (void)0;}
+static void m_glWriteMaskEXT_null(GLuint,GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static GLenum m_glGetGraphicsResetStatus_null(){return (GLenum)0;}
+static void m_glVertexAttrib1fv_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glMultiTexCoord1s_null(GLenum,GLshort){return (void)0;}
+static void m_glImageTransformParameterfvHP_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glFramebufferTexture2D_null(GLenum,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glGetFragmentLightfvSGIX_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glListParameterfSGIX_null(GLuint,GLenum,GLfloat){return (void)0;}
+static void m_glTexCoord3sv_null(const GLshort*){return (void)0;}
+static void m_glNamedFramebufferRenderbufferEXT_null(GLuint,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glFragmentLightModelfSGIX_null(GLenum,GLfloat){return (void)0;}
+static void m_glIndexPointerEXT_null(GLenum,GLsizei,GLsizei,const void*){return (void)0;}
+static void m_glBlendEquationSeparateATI_null(GLenum,GLenum){return (void)0;}
+static void m_glVertexArrayAttribIFormat_null(GLuint,GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glReplacementCodeubvSUN_null(const GLubyte*){return (void)0;}
+static void m_glGenFramebuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glPixelMapx_null(GLenum,GLint,const GLfixed*){return (void)0;}
+static void m_glTexSubImage3DEXT_null(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGetAttachedShaders_null(GLuint,GLsizei,GLsizei*,GLuint*){return (void)0;}
+static void m_glGetPixelTexGenParameterfvSGIS_null(GLenum,GLfloat*){return (void)0;}
+static void m_glReplacementCodeuiNormal3fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static GLuint m_glGetDebugMessageLogAMD_null(GLuint,GLsizei,GLenum*,GLuint*,GLuint*,GLsizei*,GLchar*){return (GLuint)0;}
+static void m_glVertexStream4sATI_null(GLenum,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttribs4dvNV_null(GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGetnMapdvARB_null(GLenum,GLenum,GLsizei,GLdouble*){return (void)0;}
+static void m_glOrthofOES_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glViewportArrayv_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glDrawElementArrayATI_null(GLenum,GLsizei){return (void)0;}
+static void m_glBufferStorageMemEXT_null(GLenum,GLsizeiptr,GLuint,GLuint64){return (void)0;}
+static void m_glGetPathColorGenfvNV_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glWindowPos3iMESA_null(GLint,GLint,GLint){return (void)0;}
+static void m_glMultiTexCoord2s_null(GLenum,GLshort,GLshort){return (void)0;}
+static void m_glVertex3dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttribI3uivEXT_null(GLuint,const GLuint*){return (void)0;}
+static void m_glUniform3ui64ARB_null(GLint,GLuint64,GLuint64,GLuint64){return (void)0;}
+static void m_glVertexAttrib2fvNV_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glGetNamedBufferSubDataEXT_null(GLuint,GLintptr,GLsizeiptr,void*){return (void)0;}
+static void m_glConvolutionFilter2D_null(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glMemoryBarrierByRegion_null(GLbitfield){return (void)0;}
+static void m_glVertexArrayBindingDivisor_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glMatrixRotatedEXT_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glTexCoord2sv_null(const GLshort*){return (void)0;}
+static GLboolean m_glIsProgramNV_null(GLuint){return (GLboolean)0;}
+static void m_glUniform2dv_null(GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGetPixelMapuiv_null(GLenum,GLuint*){return (void)0;}
+static void m_glDepthBoundsEXT_null(GLclampd,GLclampd){return (void)0;}
+static void m_glVertexAttrib4hvNV_null(GLuint,const GLhalfNV*){return (void)0;}
+static void m_glMultiTexParameteriEXT_null(GLenum,GLenum,GLenum,GLint){return (void)0;}
+static void m_glGetPointerv_null(GLenum,GLvoid**){return (void)0;}
+static void m_glPathCommandsNV_null(GLuint,GLsizei,const GLubyte*,GLsizei,GLenum,const void*){return (void)0;}
+static void m_glGetListParameterfvSGIX_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glGetUniformuiv_null(GLuint,GLint,GLuint*){return (void)0;}
+static void m_glDebugMessageInsertAMD_null(GLenum,GLenum,GLuint,GLsizei,const GLchar*){return (void)0;}
+static void m_glFrustum_null(GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttribL1ui64vNV_null(GLuint,const GLuint64EXT*){return (void)0;}
+static void m_glClearColorxOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glProgramUniformMatrix3fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glSampleMaskIndexedNV_null(GLuint,GLbitfield){return (void)0;}
+static void m_glCompileShaderIncludeARB_null(GLuint,GLsizei,const GLchar*const*,const GLint*){return (void)0;}
+static void m_glGetArrayObjectfvATI_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexStream4svATI_null(GLenum,const GLshort*){return (void)0;}
+static void m_glMultiTexCoord4iARB_null(GLenum,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glVariantfvEXT_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glMatrixLoadfEXT_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glLoadIdentityDeformationMapSGIX_null(GLbitfield){return (void)0;}
+static void m_glGetRenderbufferParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniform3fEXT_null(GLuint,GLint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNamedRenderbufferStorage_null(GLuint,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glBindFragDataLocation_null(GLuint,GLuint,const GLchar*){return (void)0;}
+static void m_glPolygonOffsetClamp_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glFogCoordPointerListIBM_null(GLenum,GLint,const void**,GLint){return (void)0;}
+static GLsync m_glFenceSync_null(GLenum,GLbitfield){return (GLsync)0;}
+static void m_glGetVertexAttribIivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glFramebufferDrawBuffersEXT_null(GLuint,GLsizei,const GLenum*){return (void)0;}
+static void m_glVertexAttribs4fvNV_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glPauseTransformFeedbackNV_null(){return (void)0;}
+static void m_glGetQueryObjecti64vEXT_null(GLuint,GLenum,GLint64*){return (void)0;}
+static void m_glVDPAUSurfaceAccessNV_null(GLvdpauSurfaceNV,GLenum){return (void)0;}
+static void m_glValidateProgramPipeline_null(GLuint){return (void)0;}
+static void m_glTexPageCommitmentARB_null(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glWindowPos3dvARB_null(const GLdouble*){return (void)0;}
+static void m_glStencilStrokePathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLint,GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glFogfv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glGenQueriesARB_null(GLsizei,GLuint*){return (void)0;}
+static void m_glProgramUniform2i64NV_null(GLuint,GLint,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glVertexP4ui_null(GLenum,GLuint){return (void)0;}
+static void m_glVertexStream1ivATI_null(GLenum,const GLint*){return (void)0;}
+static void m_glProgramEnvParameterI4iNV_null(GLenum,GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glGenVertexArraysAPPLE_null(GLsizei,GLuint*){return (void)0;}
+static void m_glDrawTransformFeedbackInstanced_null(GLenum,GLuint,GLsizei){return (void)0;}
+static void m_glStencilThenCoverStrokePathNV_null(GLuint,GLint,GLuint,GLenum){return (void)0;}
+static void m_glDeleteVertexArraysAPPLE_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetNamedBufferParameterui64vNV_null(GLuint,GLenum,GLuint64EXT*){return (void)0;}
+static GLbitfield m_glQueryMatrixxOES_null(GLfixed*,GLint*){return (GLbitfield)0;}
+static void m_glSecondaryColor3usv_null(const GLushort*){return (void)0;}
+static void m_glTranslatexOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glDrawTransformFeedback_null(GLenum,GLuint){return (void)0;}
+static void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_null(const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_null(const void*,GLenum,GLsizei,const GLuint*){return (GLvdpauSurfaceNV)0;}
+static void m_glGetTexParameterIuiv_null(GLenum,GLenum,GLuint*){return (void)0;}
+static void m_glBindBufferBaseNV_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glIndexPointer_null(GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glGenQueryResourceTagNV_null(GLsizei,GLint*){return (void)0;}
+static void m_glVertexAttrib4Nbv_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glListParameteriSGIX_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glBlendColorxOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glUniformui64vNV_null(GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static GLboolean m_glIsSync_null(GLsync){return (GLboolean)0;}
+static void m_glGetTextureParameterivEXT_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glFogCoordhvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glFramebufferTextureLayerEXT_null(GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glGetObjectPtrLabel_null(const void*,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glTextureParameteri_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord1fARB_null(GLenum,GLfloat){return (void)0;}
+static void m_glUniformMatrix2x3dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glFramebufferDrawBufferEXT_null(GLuint,GLenum){return (void)0;}
+static void m_glCopyColorSubTable_null(GLenum,GLsizei,GLint,GLint,GLsizei){return (void)0;}
+static void m_glGetNamedFramebufferParameterfvAMD_null(GLuint,GLenum,GLuint,GLuint,GLsizei,GLfloat*){return (void)0;}
+static void m_glVertexAttribL3d_null(GLuint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glFragmentMaterialfvSGIX_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glMatrixLoadTranspose3x3fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glDeleteNamesAMD_null(GLenum,GLuint,const GLuint*){return (void)0;}
+static void m_glDrawRangeElementsEXT_null(GLenum,GLuint,GLuint,GLsizei,GLenum,const void*){return (void)0;}
+static void m_glOrtho_null(GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glProgramUniform1dvEXT_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glColor4xOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glTexImage4DSGIS_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform1ui_null(GLuint,GLint,GLuint){return (void)0;}
+static void m_glDeleteBuffersARB_null(GLsizei,const GLuint*){return (void)0;}
+static GLboolean m_glUnmapBufferARB_null(GLenum){return (GLboolean)0;}
+static void m_glCopyTexImage2D_null(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glMaterialxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glProgramUniformMatrix2x4fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static GLboolean m_glTestObjectAPPLE_null(GLenum,GLuint){return (GLboolean)0;}
+static void m_glRenderbufferStorageEXT_null(GLenum,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttribL1ui64ARB_null(GLuint,GLuint64EXT){return (void)0;}
+static void m_glEndFragmentShaderATI_null(){return (void)0;}
+static void m_glPathParameterivNV_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glUniform4uiv_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glFrameZoomSGIX_null(GLint){return (void)0;}
+static void m_glSecondaryColor3fEXT_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glLGPUInterlockNVX_null(){return (void)0;}
+static void m_glVertexAttribL1dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glNormalStream3svATI_null(GLenum,const GLshort*){return (void)0;}
+static void m_glPathStencilFuncNV_null(GLenum,GLint,GLuint){return (void)0;}
+static void m_glSetInvariantEXT_null(GLuint,GLenum,const void*){return (void)0;}
+static void m_glGetTexBumpParameterivATI_null(GLenum,GLint*){return (void)0;}
+static void m_glBlendEquationSeparateEXT_null(GLenum,GLenum){return (void)0;}
+static void m_glEndOcclusionQueryNV_null(){return (void)0;}
+static void m_glScissorArrayv_null(GLuint,GLsizei,const GLint*){return (void)0;}
+static void m_glCallList_null(GLuint){return (void)0;}
+static void* m_glMapTexture2DINTEL_null(GLuint,GLint,GLbitfield,GLint*,GLenum*){return (void*)0;}
+static GLVULKANPROCNV m_glGetVkProcAddrNV_null(const GLchar*){return (GLVULKANPROCNV)0;}
+static void m_glPixelTransferxOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glDeleteRenderbuffersEXT_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glTexCoord4fColor4fNormal3fVertex4fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glProgramUniformMatrix4dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetnColorTable_null(GLenum,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glFramebufferTextureLayerARB_null(GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glVertexAttribL2dvEXT_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetCombinerStageParameterfvNV_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glMultiTexCoord1xvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void* m_glMapBuffer_null(GLenum,GLenum){return (void*)0;}
+static void m_glSecondaryColor3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glSecondaryColor3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexAttribLFormat_null(GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glElementPointerAPPLE_null(GLenum,const void*){return (void)0;}
+static void m_glVertexStream1fATI_null(GLenum,GLfloat){return (void)0;}
+static void m_glCoverageModulationNV_null(GLenum){return (void)0;}
+static void m_glSecondaryColor3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glDeleteSync_null(GLsync){return (void)0;}
+static void m_glGetProgramParameterfvNV_null(GLenum,GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glMaxShaderCompilerThreadsARB_null(GLuint){return (void)0;}
+static void m_glUniformMatrix4x2dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glVertexArrayVertexAttribLOffsetEXT_null(GLuint,GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glSecondaryColor3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static GLboolean m_glIsImageHandleResidentNV_null(GLuint64){return (GLboolean)0;}
+static void m_glUniform3iv_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glVertexAttribL3i64vNV_null(GLuint,const GLint64EXT*){return (void)0;}
+static void m_glPolygonMode_null(GLenum,GLenum){return (void)0;}
+static void m_glFramebufferSamplePositionsfvAMD_null(GLenum,GLuint,GLuint,const GLfloat*){return (void)0;}
+static void m_glConvolutionFilter1DEXT_null(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glVertexAttrib1dvARB_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glTextureSubImage2DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static GLboolean m_glIsVertexArrayAPPLE_null(GLuint){return (GLboolean)0;}
+static void m_glUseProgram_null(GLuint){return (void)0;}
+static void m_glLineStipple_null(GLint,GLushort){return (void)0;}
+static void m_glMultiTexCoord4fvARB_null(GLenum,const GLfloat*){return (void)0;}
+static GLenum m_glVideoCaptureNV_null(GLuint,GLuint*,GLuint64EXT*){return (GLenum)0;}
+static void m_glVertexArrayVertexAttribLFormatEXT_null(GLuint,GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glUniform3fvARB_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix3x2fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glCopyTextureSubImage3DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glMultiTexCoord2bvOES_null(GLenum,const GLbyte*){return (void)0;}
+static void m_glDeleteObjectARB_null(GLhandleARB){return (void)0;}
+static void m_glTextureLightEXT_null(GLenum){return (void)0;}
+static void m_glRasterPos3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glMultiTexCoord3dARB_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glNamedFramebufferTextureEXT_null(GLuint,GLenum,GLuint,GLint){return (void)0;}
+static void m_glTextureParameteriEXT_null(GLuint,GLenum,GLenum,GLint){return (void)0;}
+static void m_glEvalCoord2xvOES_null(const GLfixed*){return (void)0;}
+static void m_glBindVideoCaptureStreamBufferNV_null(GLuint,GLuint,GLenum,GLintptrARB){return (void)0;}
+static void m_glTexImage2DMultisampleCoverageNV_null(GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLboolean){return (void)0;}
+static GLint m_glGetAttribLocationARB_null(GLhandleARB,const GLcharARB*){return (GLint)0;}
+static void m_glDeleteShader_null(GLuint){return (void)0;}
+static void m_glVertexAttrib1fARB_null(GLuint,GLfloat){return (void)0;}
+static void m_glTexCoord2fColor4ubVertex3fSUN_null(GLfloat,GLfloat,GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glTexCoord4fVertex4fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetMapdv_null(GLenum,GLenum,GLdouble*){return (void)0;}
+static void m_glMapParameterfvNV_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glTextureParameterIuiv_null(GLuint,GLenum,const GLuint*){return (void)0;}
+static void m_glTransformFeedbackAttribsNV_null(GLsizei,const GLint*,GLenum){return (void)0;}
+static void m_glFragmentLightfvSGIX_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glWindowPos3sARB_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetConvolutionParameterfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glCopyTexSubImage3D_null(GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttribI3i_null(GLuint,GLint,GLint,GLint){return (void)0;}
+static GLhandleARB m_glCreateShaderObjectARB_null(GLenum){return (GLhandleARB)0;}
+static void m_glVertexAttribFormat_null(GLuint,GLint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glGetProgramivARB_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttribI4usv_null(GLuint,const GLushort*){return (void)0;}
+static void m_glTexParameterf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glVertexAttribBinding_null(GLuint,GLuint){return (void)0;}
+static void m_glGetHistogramParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glTexParameteri_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glGetShaderSource_null(GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glVertexAttrib4s_null(GLuint,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttrib4dvNV_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glVertexAttrib1dvNV_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glPopName_null(){return (void)0;}
+static void m_glTextureBufferEXT_null(GLuint,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glGetMultiTexImageEXT_null(GLenum,GLenum,GLint,GLenum,GLenum,void*){return (void)0;}
+static void m_glGetPointerIndexedvEXT_null(GLenum,GLuint,void**){return (void)0;}
+static GLboolean m_glIsNameAMD_null(GLenum,GLuint){return (GLboolean)0;}
+static void m_glColor4ub_null(GLubyte,GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glBufferParameteriAPPLE_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glColor4ui_null(GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetInternalformativ_null(GLenum,GLenum,GLenum,GLsizei,GLint*){return (void)0;}
+static void m_glColor4us_null(GLushort,GLushort,GLushort,GLushort){return (void)0;}
+static void m_glVertexAttribP1uiv_null(GLuint,GLenum,GLboolean,const GLuint*){return (void)0;}
+static void m_glLinkProgram_null(GLuint){return (void)0;}
+static void m_glTexCoord3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glTexCoord2dv_null(const GLdouble*){return (void)0;}
+static void m_glGetObjectLabel_null(GLenum,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glVertexPointerEXT_null(GLint,GLenum,GLsizei,GLsizei,const void*){return (void)0;}
+static void m_glDebugMessageCallbackARB_null(GLDEBUGPROCARB,const void*){return (void)0;}
+static const GLubyte* m_glGetString_null(GLenum){return (const GLubyte*)0;}
+static void m_glGetPathParameterfvNV_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glLightxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glEndQuery_null(GLenum){return (void)0;}
+static void m_glSecondaryColor3uiv_null(const GLuint*){return (void)0;}
+static void m_glPrioritizeTexturesxOES_null(GLsizei,const GLuint*,const GLfixed*){return (void)0;}
+static void m_glEdgeFlagPointer_null(GLsizei,const GLvoid*){return (void)0;}
+static void m_glFramebufferParameteri_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glTexCoord3hNV_null(GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glMultiModeDrawElementsIBM_null(const GLenum*,const GLsizei*,GLenum,const void*const*,GLsizei,GLint){return (void)0;}
+static void m_glCopyPixels_null(GLint,GLint,GLsizei,GLsizei,GLenum){return (void)0;}
+static void m_glVertexAttribI2ui_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glClampColorARB_null(GLenum,GLenum){return (void)0;}
+static void m_glColorPointervINTEL_null(GLint,GLenum,const void**){return (void)0;}
+static void m_glDeleteTextures_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetMinmaxParameterfvEXT_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glWindowPos3sMESA_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttrib4f_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNamedFramebufferParameteri_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glTexCoord2fVertex3fvSUN_null(const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glReplacementCodeusSUN_null(GLushort){return (void)0;}
+static void m_glGetNamedFramebufferParameteriv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexStream1fvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glCreateVertexArrays_null(GLsizei,GLuint*){return (void)0;}
+static void m_glBeginConditionalRender_null(GLuint,GLenum){return (void)0;}
+static void m_glGetUnsignedBytevEXT_null(GLenum,GLubyte*){return (void)0;}
+static void m_glConvolutionFilter1D_null(GLenum,GLenum,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glMultiTexCoord3fARB_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetQueryObjectuivARB_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glScalexOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glSamplerParameteri_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glSamplerParameterf_null(GLuint,GLenum,GLfloat){return (void)0;}
+static void m_glShaderOp1EXT_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glBeginVideoCaptureNV_null(GLuint){return (void)0;}
+static void m_glGetnHistogram_null(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glUniform1d_null(GLint,GLdouble){return (void)0;}
+static GLint m_glRenderMode_null(GLenum){return (GLint)0;}
+static void m_glClearColorIiEXT_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glSignalSemaphoreEXT_null(GLuint,GLuint,const GLuint*,GLuint,const GLuint*,const GLenum*){return (void)0;}
+static void m_glGetCompressedTexImage_null(GLenum,GLint,GLvoid*){return (void)0;}
+static void m_glCompressedTextureImage1DEXT_null(GLuint,GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glGetActiveUniformBlockiv_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glUniform1i_null(GLint,GLint){return (void)0;}
+static void m_glMultiDrawArraysIndirectCount_null(GLenum,const void*,GLintptr,GLsizei,GLsizei){return (void)0;}
+static void m_glGetTexEnvfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glColorTableParameterivSGI_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glCullFace_null(GLenum){return (void)0;}
+static void m_glDeleteFencesAPPLE_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glProgramUniform4i_null(GLuint,GLint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glUniformHandleui64ARB_null(GLint,GLuint64){return (void)0;}
+static void m_glProgramUniform4f_null(GLuint,GLint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glViewportIndexedf_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glProgramUniform4d_null(GLuint,GLint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glTexCoord1xOES_null(GLfixed){return (void)0;}
+static void m_glVertexStream3ivATI_null(GLenum,const GLint*){return (void)0;}
+static GLboolean m_glPointAlongPathNV_null(GLuint,GLsizei,GLsizei,GLfloat,GLfloat*,GLfloat*,GLfloat*,GLfloat*){return (GLboolean)0;}
+static void m_glEndQueryARB_null(GLenum){return (void)0;}
+static void m_glVDPAUMapSurfacesNV_null(GLsizei,const GLvdpauSurfaceNV*){return (void)0;}
+static void m_glVertex3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glVertexAttrib4uivARB_null(GLuint,const GLuint*){return (void)0;}
+static void m_glTextureStorageMem3DEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glAttachShader_null(GLuint,GLuint){return (void)0;}
+static void m_glColor4hNV_null(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glGetFenceivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glTexCoord2fColor4ubVertex3fvSUN_null(const GLfloat*,const GLubyte*,const GLfloat*){return (void)0;}
+static void m_glGetColorTable_null(GLenum,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glFogCoordPointer_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glTexStorageSparseAMD_null(GLenum,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLbitfield){return (void)0;}
+static GLboolean m_glUnmapNamedBuffer_null(GLuint){return (GLboolean)0;}
+static void m_glTexCoord4bvOES_null(const GLbyte*){return (void)0;}
+static void m_glVertexAttrib3fARB_null(GLuint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glRasterPos2xOES_null(GLfixed,GLfixed){return (void)0;}
+static void m_glCreateMemoryObjectsEXT_null(GLsizei,GLuint*){return (void)0;}
+static void m_glColor4ubVertex2fvSUN_null(const GLubyte*,const GLfloat*){return (void)0;}
+static void m_glSecondaryColor3dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttribI4sv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glDrawTransformFeedbackStreamInstanced_null(GLenum,GLuint,GLuint,GLsizei){return (void)0;}
+static void m_glMultiTexCoord4ivARB_null(GLenum,const GLint*){return (void)0;}
+static void m_glSpriteParameterfSGIX_null(GLenum,GLfloat){return (void)0;}
+static void m_glSecondaryColor3sv_null(const GLshort*){return (void)0;}
+static void m_glBindVideoCaptureStreamTextureNV_null(GLuint,GLuint,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glTexParameterIuiv_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glFlushPixelDataRangeNV_null(GLenum){return (void)0;}
+static void m_glWindowPos3fv_null(const GLfloat*){return (void)0;}
+static void m_glVertexAttribLFormatNV_null(GLuint,GLint,GLenum,GLsizei){return (void)0;}
+static void m_glLightModelfv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glGetColorTableSGI_null(GLenum,GLenum,GLenum,void*){return (void)0;}
+static void m_glGetCompressedTexImageARB_null(GLenum,GLint,void*){return (void)0;}
+static void m_glConvolutionParameteri_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glVertexWeighthNV_null(GLhalfNV){return (void)0;}
+static void m_glColorMaskIndexedEXT_null(GLuint,GLboolean,GLboolean,GLboolean,GLboolean){return (void)0;}
+static void m_glColorMaski_null(GLuint,GLboolean,GLboolean,GLboolean,GLboolean){return (void)0;}
+static void m_glColorFragmentOp1ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glVertexAttribI4ubvEXT_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glVertexAttrib1dNV_null(GLuint,GLdouble){return (void)0;}
+static void m_glUnmapObjectBufferATI_null(GLuint){return (void)0;}
+static void m_glNamedProgramLocalParameterI4uiEXT_null(GLuint,GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramUniform1iEXT_null(GLuint,GLint,GLint){return (void)0;}
+static void m_glDeleteQueriesARB_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glWindowPos3svARB_null(const GLshort*){return (void)0;}
+static void m_glVertex4s_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glImportMemoryWin32NameEXT_null(GLuint,GLuint64,GLenum,const void*){return (void)0;}
+static void m_glStringMarkerGREMEDY_null(GLsizei,const void*){return (void)0;}
+static GLboolean m_glIsTransformFeedback_null(GLuint){return (GLboolean)0;}
+static void m_glProgramUniformMatrix2x3dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetObjectLabelEXT_null(GLenum,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glUniformHandleui64vNV_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glRotated_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static GLboolean m_glIsProgramPipeline_null(GLuint){return (GLboolean)0;}
+static void m_glRotatef_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertex4i_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glGetActiveSubroutineUniformName_null(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glVertexAttrib4sNV_null(GLuint,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glProgramLocalParameter4dvARB_null(GLenum,GLuint,const GLdouble*){return (void)0;}
+static void m_glReplacementCodeubSUN_null(GLubyte){return (void)0;}
+static void m_glMultiDrawElementsIndirectBindlessNV_null(GLenum,GLenum,const void*,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glImportSemaphoreWin32HandleEXT_null(GLuint,GLenum,void*){return (void)0;}
+static void m_glUniformMatrix3fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetnMapfvARB_null(GLenum,GLenum,GLsizei,GLfloat*){return (void)0;}
+static void m_glGetnUniformfv_null(GLuint,GLint,GLsizei,GLfloat*){return (void)0;}
+static void m_glVertexAttribL2dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glVertexWeightPointerEXT_null(GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glTangent3sEXT_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glSecondaryColorPointer_null(GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glAlphaFunc_null(GLenum,GLclampf){return (void)0;}
+static void m_glGetNamedStringARB_null(GLint,const GLchar*,GLsizei,GLint*,GLchar*){return (void)0;}
+static void m_glTexCoord4d_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glBufferPageCommitmentARB_null(GLenum,GLintptr,GLsizeiptr,GLboolean){return (void)0;}
+static void m_glProgramLocalParameters4fvEXT_null(GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glStencilFunc_null(GLenum,GLint,GLuint){return (void)0;}
+static void m_glSemaphoreParameterui64vEXT_null(GLuint,GLenum,const GLuint64*){return (void)0;}
+static void m_glGetVertexAttribdvNV_null(GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glTexCoord3dv_null(const GLdouble*){return (void)0;}
+static void m_glGetQueryBufferObjectiv_null(GLuint,GLuint,GLenum,GLintptr){return (void)0;}
+static void m_glTexGenxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glMultiTexCoord1fvARB_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glLightEnviSGIX_null(GLenum,GLint){return (void)0;}
+static void m_glGetProgramPipelineiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexStream2ivATI_null(GLenum,const GLint*){return (void)0;}
+static void m_glGetColorTableEXT_null(GLenum,GLenum,GLenum,void*){return (void)0;}
+static void m_glGetShaderInfoLog_null(GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glGetOcclusionQueryuivNV_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glInvalidateNamedFramebufferSubData_null(GLuint,GLsizei,const GLenum*,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttribL1i64NV_null(GLuint,GLint64EXT){return (void)0;}
+static void m_glVDPAUInitNV_null(const void*,const void*){return (void)0;}
+static void m_glVertexAttrib1hvNV_null(GLuint,const GLhalfNV*){return (void)0;}
+static void m_glVertexAttribI4i_null(GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glRasterPos2iv_null(const GLint*){return (void)0;}
+static void m_glGetIntegerui64i_vNV_null(GLenum,GLuint,GLuint64EXT*){return (void)0;}
+static void m_glUniformHandleui64NV_null(GLint,GLuint64){return (void)0;}
+static void m_glWindowPos3ivMESA_null(const GLint*){return (void)0;}
+static void m_glBlendEquationSeparate_null(GLenum,GLenum){return (void)0;}
+static void m_glDrawElementsInstancedARB_null(GLenum,GLsizei,GLenum,const void*,GLsizei){return (void)0;}
+static GLuint m_glGetSubroutineIndex_null(GLuint,GLenum,const GLchar*){return (GLuint)0;}
+static void m_glVertexAttrib2sv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glSamplePatternSGIS_null(GLenum){return (void)0;}
+static void m_glEGLImageTargetRenderbufferStorageOES_null(GLenum,GLeglImageOES){return (void)0;}
+static void m_glPushAttrib_null(GLbitfield){return (void)0;}
+static void m_glVertex3hNV_null(GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glRasterPos3xvOES_null(const GLfixed*){return (void)0;}
+static void m_glPathParameterfNV_null(GLuint,GLenum,GLfloat){return (void)0;}
+static void m_glGetUniformi64vNV_null(GLuint,GLint,GLint64EXT*){return (void)0;}
+static void m_glLightiv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glMaterialxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glNamedProgramLocalParameter4fEXT_null(GLuint,GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexAttribL1dEXT_null(GLuint,GLdouble){return (void)0;}
+static void m_glGetnUniformdvARB_null(GLuint,GLint,GLsizei,GLdouble*){return (void)0;}
+static void m_glSecondaryColor3bEXT_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glBeginPerfQueryINTEL_null(GLuint){return (void)0;}
+static void m_glProgramUniform1uivEXT_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glImageTransformParameterivHP_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glDeleteBuffers_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glBindProgramPipeline_null(GLuint){return (void)0;}
+static void m_glScissor_null(GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramUniform4fv_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glGetBooleanv_null(GLenum,GLboolean*){return (void)0;}
+static void m_glMaterialfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glWindowPos4fvMESA_null(const GLfloat*){return (void)0;}
+static void m_glVertexAttribIPointerEXT_null(GLuint,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glProgramBufferParametersfvNV_null(GLenum,GLuint,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glAlphaFuncxOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glMultiDrawArraysIndirectAMD_null(GLenum,const void*,GLsizei,GLsizei){return (void)0;}
+static void m_glNormalStream3ivATI_null(GLenum,const GLint*){return (void)0;}
+static void m_glTextureImage3DMultisampleNV_null(GLuint,GLenum,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glProgramUniform4uivEXT_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glReplacementCodeusvSUN_null(const GLushort*){return (void)0;}
+static GLint m_glPollInstrumentsSGIX_null(GLint*){return (GLint)0;}
+static void m_glGetTextureLevelParameteriv_null(GLuint,GLint,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttribI2uiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glMapControlPointsNV_null(GLenum,GLuint,GLenum,GLsizei,GLsizei,GLint,GLint,GLboolean,const void*){return (void)0;}
+static void m_glColor4dv_null(const GLdouble*){return (void)0;}
+static void m_glInvalidateBufferSubData_null(GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glMultiTexCoord1hNV_null(GLenum,GLhalfNV){return (void)0;}
+static void m_glPointParameterfv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glUniformMatrix2fvARB_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glUniform2fv_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glVertexPointerListIBM_null(GLint,GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glGetMultiTexGenfvEXT_null(GLenum,GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glGetMinmaxEXT_null(GLenum,GLboolean,GLenum,GLenum,void*){return (void)0;}
+static GLboolean m_glIsFenceNV_null(GLuint){return (GLboolean)0;}
+static void m_glMatrixFrustumEXT_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glDispatchComputeIndirect_null(GLintptr){return (void)0;}
+static GLint m_glQueryResourceNV_null(GLenum,GLint,GLuint,GLint*){return (GLint)0;}
+static void m_glMultiTexCoord4bOES_null(GLenum,GLbyte,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glProgramEnvParameter4dARB_null(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glProgramUniform1uiEXT_null(GLuint,GLint,GLuint){return (void)0;}
+static void m_glBindBufferRange_null(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glNormal3iv_null(const GLint*){return (void)0;}
+static void m_glVertexAttribL3dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetUniformdv_null(GLuint,GLint,GLdouble*){return (void)0;}
+static void m_glGetMultiTexLevelParameterfvEXT_null(GLenum,GLenum,GLint,GLenum,GLfloat*){return (void)0;}
+static void m_glFinalCombinerInputNV_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glCullParameterdvEXT_null(GLenum,GLdouble*){return (void)0;}
+static void m_glMultiTexCoord4s_null(GLenum,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glMapVertexAttrib1fAPPLE_null(GLuint,GLuint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){return (void)0;}
+static void m_glConvolutionParameterfEXT_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glTexCoord1iv_null(const GLint*){return (void)0;}
+static void m_glProgramUniform3fvEXT_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glColor3uiv_null(const GLuint*){return (void)0;}
+static void m_glRenderGpuMaskNV_null(GLbitfield){return (void)0;}
+static void m_glListBase_null(GLuint){return (void)0;}
+static void m_glTexCoord2bOES_null(GLbyte,GLbyte){return (void)0;}
+static GLuint m_glBindMaterialParameterEXT_null(GLenum,GLenum){return (GLuint)0;}
+static void m_glGlobalAlphaFactorubSUN_null(GLubyte){return (void)0;}
+static void m_glVertexAttribL1ui64NV_null(GLuint,GLuint64EXT){return (void)0;}
+static void m_glPointParameterfSGIS_null(GLenum,GLfloat){return (void)0;}
+static void m_glGetImageTransformParameterivHP_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glColorSubTableEXT_null(GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glPixelTexGenParameterfvSGIS_null(GLenum,const GLfloat*){return (void)0;}
+static GLenum m_glClientWaitSync_null(GLsync,GLbitfield,GLuint64){return (GLenum)0;}
+static void m_glQueryObjectParameteruiAMD_null(GLenum,GLuint,GLenum,GLuint){return (void)0;}
+static void m_glVertexAttribs1fvNV_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib4NusvARB_null(GLuint,const GLushort*){return (void)0;}
+static void m_glVariantPointerEXT_null(GLuint,GLenum,GLuint,const void*){return (void)0;}
+static void m_glTextureBuffer_null(GLuint,GLenum,GLuint){return (void)0;}
+static void m_glVertexAttribI1uiEXT_null(GLuint,GLuint){return (void)0;}
+static void m_glInvalidateTexImage_null(GLuint,GLint){return (void)0;}
+static void m_glProgramEnvParametersI4ivNV_null(GLenum,GLuint,GLsizei,const GLint*){return (void)0;}
+static GLenum m_glPathGlyphIndexArrayNV_null(GLuint,GLenum,const void*,GLbitfield,GLuint,GLsizei,GLuint,GLfloat){return (GLenum)0;}
+static void m_glCopyImageSubData_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glGetUniformSubroutineuiv_null(GLenum,GLint,GLuint*){return (void)0;}
+static void m_glBindVertexBuffer_null(GLuint,GLuint,GLintptr,GLsizei){return (void)0;}
+static void m_glMultiTexCoord1iARB_null(GLenum,GLint){return (void)0;}
+static void m_glDebugMessageInsert_null(GLenum,GLenum,GLuint,GLenum,GLsizei,const GLchar*){return (void)0;}
+static void m_glBeginVertexShaderEXT_null(){return (void)0;}
+static GLboolean m_glIsVariantEnabledEXT_null(GLuint,GLenum){return (GLboolean)0;}
+static void m_glPassThroughxOES_null(GLfixed){return (void)0;}
+static GLboolean m_glIsSampler_null(GLuint){return (GLboolean)0;}
+static void m_glConservativeRasterParameterfNV_null(GLenum,GLfloat){return (void)0;}
+static void m_glMultiTexGenivEXT_null(GLenum,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glNamedFramebufferTexture2DEXT_null(GLuint,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glCopyTexSubImage1D_null(GLenum,GLint,GLint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glTexCoord1i_null(GLint){return (void)0;}
+static GLenum m_glCheckFramebufferStatus_null(GLenum){return (GLenum)0;}
+static void m_glDrawElementArrayAPPLE_null(GLenum,GLint,GLsizei){return (void)0;}
+static void m_glTexCoord1d_null(GLdouble){return (void)0;}
+static void m_glTexCoord1f_null(GLfloat){return (void)0;}
+static void m_glFragmentLightivSGIX_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glBindImageTexture_null(GLuint,GLuint,GLint,GLboolean,GLint,GLenum,GLenum){return (void)0;}
+static void m_glTransformFeedbackVaryings_null(GLuint,GLsizei,const GLchar*const*,GLenum){return (void)0;}
+static void m_glMulticastBufferSubDataNV_null(GLbitfield,GLuint,GLintptr,GLsizeiptr,const GLvoid*){return (void)0;}
+static void m_glDrawRangeElements_null(GLenum,GLuint,GLuint,GLsizei,GLenum,const GLvoid*){return (void)0;}
+static void m_glTexCoord1s_null(GLshort){return (void)0;}
+static void m_glBindBufferBase_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glColor3bv_null(const GLbyte*){return (void)0;}
+static void m_glSyncTextureINTEL_null(GLuint){return (void)0;}
+static void m_glCreateSamplers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glCombinerParameterfNV_null(GLenum,GLfloat){return (void)0;}
+static void m_glGetArrayObjectivATI_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glMultiDrawArrays_null(GLenum,const GLint*,const GLsizei*,GLsizei){return (void)0;}
+static void m_glSampleMapATI_null(GLuint,GLuint,GLenum){return (void)0;}
+static void m_glProgramUniform2i64ARB_null(GLuint,GLint,GLint64,GLint64){return (void)0;}
+static void m_glBinormal3ivEXT_null(const GLint*){return (void)0;}
+static void m_glMultiDrawArraysIndirectCountARB_null(GLenum,const void*,GLintptr,GLsizei,GLsizei){return (void)0;}
+static void m_glTextureStorageMem1DEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glWindowPos2ivMESA_null(const GLint*){return (void)0;}
+static void m_glTexCoordP4ui_null(GLenum,GLuint){return (void)0;}
+static void m_glMultiTexSubImage1DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniformMatrix2x3fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glBufferDataARB_null(GLenum,GLsizeiptrARB,const void*,GLenum){return (void)0;}
+static void m_glVertexAttribIFormat_null(GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glCreateFramebuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glNormalStream3dvATI_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glClearAccum_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glUniform3i64vNV_null(GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glNormal3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glUniform2uivEXT_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glBeginQuery_null(GLenum,GLuint){return (void)0;}
+static void m_glStencilThenCoverStrokePathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLint,GLuint,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glBindBuffer_null(GLenum,GLuint){return (void)0;}
+static void m_glMap2d_null(GLenum,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){return (void)0;}
+static void m_glMap2f_null(GLenum,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){return (void)0;}
+static void m_glMakeImageHandleResidentNV_null(GLuint64,GLenum){return (void)0;}
+static void m_glUniformMatrix2x4fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetMultiTexParameterfvEXT_null(GLenum,GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glDepthRangeIndexed_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static GLboolean m_glIsEnabled_null(GLenum){return (GLboolean)0;}
+static void m_glMatrixScalefEXT_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static GLenum m_glGetError_null(){return (GLenum)0;}
+static void m_glGetTexEnviv_null(GLenum,GLenum,GLint*){return (void)0;}
+static GLuint m_glBindTextureUnitParameterEXT_null(GLenum,GLenum){return (GLuint)0;}
+static void m_glGetnUniformfvARB_null(GLuint,GLint,GLsizei,GLfloat*){return (void)0;}
+static void m_glReplacementCodeuiNormal3fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glDeletePerfQueryINTEL_null(GLuint){return (void)0;}
+static void m_glActiveVaryingNV_null(GLuint,const GLchar*){return (void)0;}
+static void m_glGetActiveUniformARB_null(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*){return (void)0;}
+static void m_glVertexAttribI3ivEXT_null(GLuint,const GLint*){return (void)0;}
+static void m_glEvalCoord1d_null(GLdouble){return (void)0;}
+static void m_glNamedCopyBufferSubDataEXT_null(GLuint,GLuint,GLintptr,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glEvalCoord1f_null(GLfloat){return (void)0;}
+static void m_glPixelMapfv_null(GLenum,GLsizei,const GLfloat*){return (void)0;}
+static void m_glVertexAttribI1ivEXT_null(GLuint,const GLint*){return (void)0;}
+static GLsync m_glCreateSyncFromCLeventARB_null(struct _cl_context*,struct _cl_event*,GLbitfield){return (GLsync)0;}
+static void m_glGetPixelMapusv_null(GLenum,GLushort*){return (void)0;}
+static void m_glGetnColorTableARB_null(GLenum,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glAccum_null(GLenum,GLfloat){return (void)0;}
+static void m_glRasterPos3sv_null(const GLshort*){return (void)0;}
+static void m_glTexCoord2iv_null(const GLint*){return (void)0;}
+static void m_glBlendFunciARB_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glProgramUniform3i64vARB_null(GLuint,GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glGetFramebufferAttachmentParameteriv_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniform4ui_null(GLuint,GLint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glStencilMask_null(GLuint){return (void)0;}
+static void m_glResetHistogramEXT_null(GLenum){return (void)0;}
+static void m_glLightxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glNamedBufferData_null(GLuint,GLsizeiptr,const void*,GLenum){return (void)0;}
+static void m_glVertexStream3sATI_null(GLenum,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttrib3fvARB_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glClearNamedBufferSubData_null(GLuint,GLenum,GLintptr,GLsizeiptr,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniformHandleui64ARB_null(GLuint,GLint,GLuint64){return (void)0;}
+static void m_glUniform3iARB_null(GLint,GLint,GLint,GLint){return (void)0;}
+static GLhandleARB m_glCreateProgramObjectARB_null(){return (GLhandleARB)0;}
+static void m_glMultiTexCoord1dvARB_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glGetObjectParameterfvARB_null(GLhandleARB,GLenum,GLfloat*){return (void)0;}
+static void m_glRectsv_null(const GLshort*,const GLshort*){return (void)0;}
+static void m_glMultiTexImage2DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform1i64NV_null(GLuint,GLint,GLint64EXT){return (void)0;}
+static void m_glGetObjectBufferivATI_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glUniform4i64ARB_null(GLint,GLint64,GLint64,GLint64,GLint64){return (void)0;}
+static void m_glReplacementCodeuiColor4ubVertex3fvSUN_null(const GLuint*,const GLubyte*,const GLfloat*){return (void)0;}
+static void m_glBlendFuncSeparateINGR_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glGetVideoCaptureStreamfvNV_null(GLuint,GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexAttrib2fARB_null(GLuint,GLfloat,GLfloat){return (void)0;}
+static void m_glGetTexGeniv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glPixelStorei_null(GLenum,GLint){return (void)0;}
+static void m_glGetCompressedTextureSubImage_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLsizei,void*){return (void)0;}
+static void m_glCopyImageSubDataNV_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glActiveShaderProgram_null(GLuint,GLuint){return (void)0;}
+static void m_glVertexStream1iATI_null(GLenum,GLint){return (void)0;}
+static void m_glPatchParameterfv_null(GLenum,const GLfloat*){return (void)0;}
+static GLboolean m_glIsFramebufferEXT_null(GLuint){return (GLboolean)0;}
+static void m_glTextureStorage2D_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramUniform1ui64ARB_null(GLuint,GLint,GLuint64){return (void)0;}
+static void m_glTexBufferRange_null(GLenum,GLenum,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glGetPixelTexGenParameterivSGIS_null(GLenum,GLint*){return (void)0;}
+static void m_glTextureSubImage3DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glClipControl_null(GLenum,GLenum){return (void)0;}
+static void m_glGetProgramResourceiv_null(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLint*){return (void)0;}
+static void m_glMultiTexCoordP2uiv_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glVertexAttribI3ui_null(GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glSampleMaskSGIS_null(GLclampf,GLboolean){return (void)0;}
+static void m_glVertexAttrib4NivARB_null(GLuint,const GLint*){return (void)0;}
+static void m_glGlobalAlphaFactorfSUN_null(GLfloat){return (void)0;}
+static void m_glBlendEquationSeparateIndexedAMD_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glGetPerfCounterInfoINTEL_null(GLuint,GLuint,GLuint,GLchar*,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*,GLuint64*){return (void)0;}
+static void m_glDeleteProgramsNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glPixelZoomxOES_null(GLfixed,GLfixed){return (void)0;}
+static void m_glGetCombinerOutputParameterivNV_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glRasterPos2xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGetTexImage_null(GLenum,GLint,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glVertexArrayVertexBuffers_null(GLuint,GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizei*){return (void)0;}
+static void m_glUniform1ui64NV_null(GLint,GLuint64EXT){return (void)0;}
+static void m_glProgramParameteri_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glNormal3xOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glGetMapfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexStream2dvATI_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glPathStencilDepthOffsetNV_null(GLfloat,GLfloat){return (void)0;}
+static GLboolean m_glIsStateNV_null(GLuint){return (GLboolean)0;}
+static void m_glGetIntegerui64vNV_null(GLenum,GLuint64EXT*){return (void)0;}
+static void m_glGetImageTransformParameterfvHP_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glRasterPos2fv_null(const GLfloat*){return (void)0;}
+static void m_glVertex3xOES_null(GLfixed,GLfixed){return (void)0;}
+static GLboolean m_glIsMemoryObjectEXT_null(GLuint){return (GLboolean)0;}
+static void m_glWeightPointerARB_null(GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glFinishFenceNV_null(GLuint){return (void)0;}
+static void m_glDepthRangexOES_null(GLfixed,GLfixed){return (void)0;}
+static void m_glEnableVertexArrayAttribEXT_null(GLuint,GLuint){return (void)0;}
+static void m_glProgramUniform2uivEXT_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glGetDoubleIndexedvEXT_null(GLenum,GLuint,GLdouble*){return (void)0;}
+static void m_glWindowPos2fMESA_null(GLfloat,GLfloat){return (void)0;}
+static void m_glSecondaryColor3b_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glCopyConvolutionFilter1DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei){return (void)0;}
+static void m_glWindowPos2sv_null(const GLshort*){return (void)0;}
+static void m_glBindFramebufferEXT_null(GLenum,GLuint){return (void)0;}
+static GLuint m_glCreateShader_null(GLenum){return (GLuint)0;}
+static GLuint m_glGenPathsNV_null(GLsizei){return (GLuint)0;}
+static void m_glGenRenderbuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glCopyTexSubImage2D_null(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttrib4ubvARB_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glDrawTextureNV_null(GLuint,GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexAttribs1svNV_null(GLuint,GLsizei,const GLshort*){return (void)0;}
+static void m_glClearNamedBufferSubDataEXT_null(GLuint,GLenum,GLsizeiptr,GLsizeiptr,GLenum,GLenum,const void*){return (void)0;}
+static void m_glBlendFuncSeparate_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glPointParameterfARB_null(GLenum,GLfloat){return (void)0;}
+static void m_glTexCoord2fv_null(const GLfloat*){return (void)0;}
+static void m_glGetVariantFloatvEXT_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexP2ui_null(GLenum,GLuint){return (void)0;}
+static void m_glWindowPos2dMESA_null(GLdouble,GLdouble){return (void)0;}
+static void m_glTexCoord4fv_null(const GLfloat*){return (void)0;}
+static void m_glBindFragDataLocationEXT_null(GLuint,GLuint,const GLchar*){return (void)0;}
+static void m_glCompressedTexSubImage1DARB_null(GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glGetTextureImageEXT_null(GLuint,GLenum,GLint,GLenum,GLenum,void*){return (void)0;}
+static void m_glFogCoordd_null(GLdouble){return (void)0;}
+static void m_glPointSize_null(GLfloat){return (void)0;}
+static void m_glBindTextureUnit_null(GLuint,GLuint){return (void)0;}
+static void m_glProgramEnvParameterI4uiNV_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetProgramPipelineInfoLog_null(GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glProgramUniform4i64vARB_null(GLuint,GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glVertexAttrib4Nuiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glGetUniformfvARB_null(GLhandleARB,GLint,GLfloat*){return (void)0;}
+static void m_glWaitSync_null(GLsync,GLbitfield,GLuint64){return (void)0;}
+static void m_glUniform3i_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glBlendEquationSeparatei_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glVertexAttrib2hvNV_null(GLuint,const GLhalfNV*){return (void)0;}
+static void m_glTextureParameterivEXT_null(GLuint,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glUniform3d_null(GLint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glUniform3f_null(GLint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glActiveProgramEXT_null(GLuint){return (void)0;}
+static void m_glProgramUniform3uiv_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glUniform3ui64vARB_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glProgramUniform1ui64vARB_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glTextureParameterfEXT_null(GLuint,GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glSetFragmentShaderConstantATI_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glColorSubTable_null(GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glReplacementCodeuiSUN_null(GLuint){return (void)0;}
+static void m_glStateCaptureNV_null(GLuint,GLenum){return (void)0;}
+static void m_glBindAttribLocation_null(GLuint,GLuint,const GLchar*){return (void)0;}
+static void m_glWeightusvARB_null(GLint,const GLushort*){return (void)0;}
+static GLint m_glGetFragDataIndex_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glMultiTexCoord2xOES_null(GLenum,GLfixed,GLfixed){return (void)0;}
+static void m_glColor3sv_null(const GLshort*){return (void)0;}
+static void m_glTexCoord2fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetMemoryObjectParameterivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glPolygonOffsetEXT_null(GLfloat,GLfloat){return (void)0;}
+static void m_glWeightPathsNV_null(GLuint,GLsizei,const GLuint*,const GLfloat*){return (void)0;}
+static void m_glCombinerStageParameterfvNV_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glPointParameterfEXT_null(GLenum,GLfloat){return (void)0;}
+static void m_glCopyTexImage1DEXT_null(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){return (void)0;}
+static void m_glVertex4sv_null(const GLshort*){return (void)0;}
+static void m_glMatrixMultfEXT_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glCompressedTextureSubImage3DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glGetTexLevelParameterxvOES_null(GLenum,GLint,GLenum,GLfixed*){return (void)0;}
+static void m_glVertexAttribL3dvEXT_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glMultiTexCoordP4ui_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glGetTextureLevelParameterivEXT_null(GLuint,GLenum,GLint,GLenum,GLint*){return (void)0;}
+static void m_glAlphaFragmentOp2ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glDeleteFramebuffers_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glDrawArrays_null(GLenum,GLint,GLsizei){return (void)0;}
+static void m_glGetTransformFeedbackiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetnTexImageARB_null(GLenum,GLint,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glClear_null(GLbitfield){return (void)0;}
+static void m_glVertexArrayParameteriAPPLE_null(GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord2dvARB_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glGetVideoCaptureStreamdvNV_null(GLuint,GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glFragmentLightModelivSGIX_null(GLenum,const GLint*){return (void)0;}
+static void m_glVertexAttribP2ui_null(GLuint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glMultiTexCoordPointerEXT_null(GLenum,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glProgramUniform3iEXT_null(GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glTranslatef_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexAttrib4Nub_null(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glTranslated_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glSamplerParameterIiv_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glTexCoord4hNV_null(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glDrawElementsIndirect_null(GLenum,GLenum,const void*){return (void)0;}
+static void m_glDeletePerfMonitorsAMD_null(GLsizei,GLuint*){return (void)0;}
+static GLboolean m_glIsRenderbufferEXT_null(GLuint){return (GLboolean)0;}
+static void m_glDrawCommandsNV_null(GLenum,GLuint,const GLintptr*,const GLsizei*,GLuint){return (void)0;}
+static void m_glUniform3ivARB_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glBufferSubData_null(GLenum,GLintptr,GLsizeiptr,const void*){return (void)0;}
+static void m_glSecondaryColor3bv_null(const GLbyte*){return (void)0;}
+static void m_glMatrixMultTransposedEXT_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glRequestResidentProgramsNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glAlphaFragmentOp1ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetQueryObjecti64v_null(GLuint,GLenum,GLint64*){return (void)0;}
+static void m_glMatrixMult3x3fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glColorTableParameteriv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glPathSubCommandsNV_null(GLuint,GLsizei,GLsizei,GLsizei,const GLubyte*,GLsizei,GLenum,const void*){return (void)0;}
+static void m_glGetFinalCombinerInputParameterivNV_null(GLenum,GLenum,GLint*){return (void)0;}
+static GLboolean m_glIsRenderbuffer_null(GLuint){return (GLboolean)0;}
+static void m_glVertex3iv_null(const GLint*){return (void)0;}
+static void m_glTexGenfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glFrustumfOES_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glBindVertexBuffers_null(GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizei*){return (void)0;}
+static void m_glMateriali_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord2svARB_null(GLenum,const GLshort*){return (void)0;}
+static void m_glDisableVertexAttribArray_null(GLuint){return (void)0;}
+static void m_glWindowPos3ivARB_null(const GLint*){return (void)0;}
+static void m_glTexCoordFormatNV_null(GLint,GLenum,GLsizei){return (void)0;}
+static void m_glBlitNamedFramebuffer_null(GLuint,GLuint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){return (void)0;}
+static void m_glMatrixLoadTransposefEXT_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glMultiTexGenfEXT_null(GLenum,GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glShaderStorageBlockBinding_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glMaterialf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static GLenum m_glCheckNamedFramebufferStatusEXT_null(GLuint,GLenum){return (GLenum)0;}
+static void m_glVertexArrayVertexAttribFormatEXT_null(GLuint,GLuint,GLint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glVertex2hNV_null(GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glDeleteVertexShaderEXT_null(GLuint){return (void)0;}
+static void m_glTexImage3DEXT_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glSignalVkFenceNV_null(GLuint64){return (void)0;}
+static void m_glProgramLocalParameterI4ivNV_null(GLenum,GLuint,const GLint*){return (void)0;}
+static void m_glGlobalAlphaFactoriSUN_null(GLint){return (void)0;}
+static void m_glTextureStorage1D_null(GLuint,GLsizei,GLenum,GLsizei){return (void)0;}
+static void m_glBinormal3sEXT_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetProgramInterfaceiv_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glMatrixIndexPointerARB_null(GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glTexCoordPointerEXT_null(GLint,GLenum,GLsizei,GLsizei,const void*){return (void)0;}
+static void m_glMultiTexGeniEXT_null(GLenum,GLenum,GLenum,GLint){return (void)0;}
+static void m_glVertexAttrib2fNV_null(GLuint,GLfloat,GLfloat){return (void)0;}
+static void m_glNamedProgramStringEXT_null(GLuint,GLenum,GLenum,GLsizei,const void*){return (void)0;}
+static void* m_glMapNamedBuffer_null(GLuint,GLenum){return (void*)0;}
+static void m_glGetMinmaxParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetnUniformdv_null(GLuint,GLint,GLsizei,GLdouble*){return (void)0;}
+static void m_glEndConditionalRenderNVX_null(){return (void)0;}
+static void m_glBinormal3fEXT_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNormalStream3iATI_null(GLenum,GLint,GLint,GLint){return (void)0;}
+static void m_glProgramBufferParametersIivNV_null(GLenum,GLuint,GLuint,GLsizei,const GLint*){return (void)0;}
+static void m_glMapGrid1xOES_null(GLint,GLfixed,GLfixed){return (void)0;}
+static void m_glGetVertexAttribPointervARB_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glFlushMappedNamedBufferRangeEXT_null(GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glGetVertexAttribIiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexP4uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glUniformui64NV_null(GLint,GLuint64EXT){return (void)0;}
+static void m_glColor4fv_null(const GLfloat*){return (void)0;}
+static void m_glTexParameterxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glPatchParameteri_null(GLenum,GLint){return (void)0;}
+static void m_glMap1d_null(GLenum,GLdouble,GLdouble,GLint,GLint,const GLdouble*){return (void)0;}
+static void m_glGetTexFilterFuncSGIS_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexStream3dATI_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexArrayVertexBindingDivisorEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glMultiTexCoord3svARB_null(GLenum,const GLshort*){return (void)0;}
+static void m_glBindProgramNV_null(GLenum,GLuint){return (void)0;}
+static void m_glGetConvolutionParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetProgramLocalParameterfvARB_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static GLuint m_glGenFragmentShadersATI_null(GLuint){return (GLuint)0;}
+static void m_glTexBumpParameterivATI_null(GLenum,const GLint*){return (void)0;}
+static void m_glGetNamedFramebufferAttachmentParameteriv_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetnSeparableFilter_null(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*){return (void)0;}
+static void m_glNormal3xvOES_null(const GLfixed*){return (void)0;}
+static void m_glPassTexCoordATI_null(GLuint,GLuint,GLenum){return (void)0;}
+static void m_glFramebufferTextureFaceARB_null(GLenum,GLenum,GLuint,GLint,GLenum){return (void)0;}
+static void m_glProgramUniform1dv_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glTextureStorage2DEXT_null(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexArrayFogCoordOffsetEXT_null(GLuint,GLuint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glDeleteNamedStringARB_null(GLint,const GLchar*){return (void)0;}
+static void m_glMulticastGetQueryObjecti64vNV_null(GLuint,GLuint,GLenum,GLint64*){return (void)0;}
+static void m_glGenOcclusionQueriesNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glLighti_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glTexImage1D_null(GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glLightf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glClientAttribDefaultEXT_null(GLbitfield){return (void)0;}
+static void m_glVertexAttrib4bvARB_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glVertexAttribIFormatNV_null(GLuint,GLint,GLenum,GLsizei){return (void)0;}
+static void m_glStencilFuncSeparate_null(GLenum,GLenum,GLint,GLuint){return (void)0;}
+static void m_glGetVertexAttribfvARB_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexAttrib2dNV_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static void m_glProgramUniform2iEXT_null(GLuint,GLint,GLint,GLint){return (void)0;}
+static void m_glClientActiveVertexStreamATI_null(GLenum){return (void)0;}
+static void m_glRasterPos3xOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glGetMapParameterivNV_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glSampleCoverage_null(GLclampf,GLboolean){return (void)0;}
+static void m_glClearDepthxOES_null(GLfixed){return (void)0;}
+static void m_glUniformBufferEXT_null(GLuint,GLint,GLuint){return (void)0;}
+static void m_glTexCoord2fNormal3fVertex3fvSUN_null(const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glMulticastGetQueryObjectuivNV_null(GLuint,GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glGetFirstPerfQueryIdINTEL_null(GLuint*){return (void)0;}
+static GLboolean m_glUnmapNamedBufferEXT_null(GLuint){return (GLboolean)0;}
+static void m_glGetTransformFeedbacki_v_null(GLuint,GLenum,GLuint,GLint*){return (void)0;}
+static void m_glUniform4fvARB_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glRenderbufferStorageMultisampleCoverageNV_null(GLenum,GLsizei,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glGetFloati_vEXT_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glBindAttribLocationARB_null(GLhandleARB,GLuint,const GLcharARB*){return (void)0;}
+static void m_glBufferAddressRangeNV_null(GLenum,GLuint,GLuint64EXT,GLsizeiptr){return (void)0;}
+static void m_glGenProgramsARB_null(GLsizei,GLuint*){return (void)0;}
+static void m_glMultiTexEnvivEXT_null(GLenum,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glSecondaryColor3uiEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glCompressedTextureImage2DEXT_null(GLuint,GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glUniform2i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glCopyTexImage2DEXT_null(GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glUniform2d_null(GLint,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttribL1d_null(GLuint,GLdouble){return (void)0;}
+static void m_glFramebufferTextureFaceEXT_null(GLenum,GLenum,GLuint,GLint,GLenum){return (void)0;}
+static void m_glFramebufferTextureLayer_null(GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glMultiTexCoord4bvOES_null(GLenum,const GLbyte*){return (void)0;}
+static void m_glGetVertexArrayPointeri_vEXT_null(GLuint,GLuint,GLenum,void**){return (void)0;}
+static void m_glNamedProgramLocalParameter4dEXT_null(GLuint,GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glBinormal3bEXT_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glConvolutionFilter2DEXT_null(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform2fv_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glColor3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNormal3fVertex3fvSUN_null(const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glCopyMultiTexSubImage3DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramLocalParameterI4iNV_null(GLenum,GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glProgramUniformMatrix2x4dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static GLenum m_glPathMemoryGlyphIndexArrayNV_null(GLuint,GLenum,GLsizeiptr,const void*,GLsizei,GLuint,GLsizei,GLuint,GLfloat){return (GLenum)0;}
+static void m_glDrawArraysEXT_null(GLenum,GLint,GLsizei){return (void)0;}
+static void m_glBlendEquationEXT_null(GLenum){return (void)0;}
+static void m_glStencilOp_null(GLenum,GLenum,GLenum){return (void)0;}
+static void m_glCopyTextureSubImage2DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glTexEnvf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glVertexAttrib2dvNV_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGenPerfMonitorsAMD_null(GLsizei,GLuint*){return (void)0;}
+static void m_glGetInteger64i_v_null(GLenum,GLuint,GLint64*){return (void)0;}
+static void m_glGetHistogramParameterfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexFormatNV_null(GLint,GLenum,GLsizei){return (void)0;}
+static void m_glBlendFuncIndexedAMD_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glTexEnvi_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord1iv_null(GLenum,const GLint*){return (void)0;}
+static GLboolean m_glIsEnabledi_null(GLenum,GLuint){return (GLboolean)0;}
+static void m_glVertexAttribL2ui64vNV_null(GLuint,const GLuint64EXT*){return (void)0;}
+static void m_glVertexAttribL4i64NV_null(GLuint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glMatrixTranslatedEXT_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glMakeTextureHandleResidentARB_null(GLuint64){return (void)0;}
+static void m_glMatrixMultdEXT_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glBinormal3dvEXT_null(const GLdouble*){return (void)0;}
+static GLsync m_glImportSyncEXT_null(GLenum,GLintptr,GLbitfield){return (GLsync)0;}
+static void m_glGetMapiv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glImportSemaphoreFdEXT_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord4sv_null(GLenum,const GLshort*){return (void)0;}
+static void m_glPNTrianglesiATI_null(GLenum,GLint){return (void)0;}
+static void m_glBindVertexArrayAPPLE_null(GLuint){return (void)0;}
+static void m_glObjectPtrLabel_null(const void*,GLsizei,const GLchar*){return (void)0;}
+static GLuint m_glGetDebugMessageLog_null(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*){return (GLuint)0;}
+static void m_glTrackMatrixNV_null(GLenum,GLuint,GLenum,GLenum){return (void)0;}
+static void m_glProgramPathFragmentInputGenNV_null(GLuint,GLint,GLenum,GLint,const GLfloat*){return (void)0;}
+static void m_glTangent3ivEXT_null(const GLint*){return (void)0;}
+static void m_glGetUniformfv_null(GLuint,GLint,GLfloat*){return (void)0;}
+static void m_glSecondaryColor3ubv_null(const GLubyte*){return (void)0;}
+static void m_glMakeTextureHandleNonResidentNV_null(GLuint64){return (void)0;}
+static void m_glVertexAttribs4ubvNV_null(GLuint,GLsizei,const GLubyte*){return (void)0;}
+static void m_glClipPlanexOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glMultiTexCoord3iv_null(GLenum,const GLint*){return (void)0;}
+static void m_glGetnPolygonStippleARB_null(GLsizei,GLubyte*){return (void)0;}
+static void m_glUniform2i64vNV_null(GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glLightModelf_null(GLenum,GLfloat){return (void)0;}
+static void m_glDeleteMemoryObjectsEXT_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glMultiTexSubImage2DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glReplacementCodeuiColor3fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glTangent3dvEXT_null(const GLdouble*){return (void)0;}
+static void m_glLightModeli_null(GLenum,GLint){return (void)0;}
+static void m_glVertexWeighthvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glWindowPos3iv_null(const GLint*){return (void)0;}
+static void m_glMultiTexCoordP1uiv_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glTransformPathNV_null(GLuint,GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glProgramNamedParameter4dNV_null(GLuint,GLsizei,const GLubyte*,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glMultiDrawElementsIndirect_null(GLenum,GLenum,const void*,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramUniform1dEXT_null(GLuint,GLint,GLdouble){return (void)0;}
+static void m_glCallLists_null(GLsizei,GLenum,const GLvoid*){return (void)0;}
+static void m_glNormal3hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glGetCombinerOutputParameterfvNV_null(GLenum,GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexAttrib4sARB_null(GLuint,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glTexCoord3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glVertexAttribI3uiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glPushDebugGroup_null(GLenum,GLuint,GLsizei,const GLchar*){return (void)0;}
+static void m_glTexCoord3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glTexCoord3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glTexCoord2xOES_null(GLfixed,GLfixed){return (void)0;}
+static GLushort m_glGetStageIndexNV_null(GLenum){return (GLushort)0;}
+static void m_glProgramUniform4i64vNV_null(GLuint,GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glGetNamedBufferPointervEXT_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glTextureBarrierNV_null(){return (void)0;}
+static void m_glColor4ubVertex3fvSUN_null(const GLubyte*,const GLfloat*){return (void)0;}
+static GLuint m_glGetCommandHeaderNV_null(GLenum,GLuint){return (GLuint)0;}
+static void m_glGetPerfMonitorCounterInfoAMD_null(GLuint,GLuint,GLenum,void*){return (void)0;}
+static void m_glVertexAttrib1svARB_null(GLuint,const GLshort*){return (void)0;}
+static void m_glCombinerParameteriNV_null(GLenum,GLint){return (void)0;}
+static void m_glMatrixMultTransposefEXT_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glDetailTexFuncSGIS_null(GLenum,GLsizei,const GLfloat*){return (void)0;}
+static GLboolean m_glAreTexturesResident_null(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static void m_glProgramUniform2d_null(GLuint,GLint,GLdouble,GLdouble){return (void)0;}
+static void m_glGetConvolutionParameterfvEXT_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glIndexPointerListIBM_null(GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glVertexAttribI4iEXT_null(GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glProgramUniform2f_null(GLuint,GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glRasterPos4sv_null(const GLshort*){return (void)0;}
+static void m_glColor4s_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glMulticastGetQueryObjectivNV_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glColorFragmentOp3ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glResizeBuffersMESA_null(){return (void)0;}
+static void m_glGetMinmaxParameterfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glClientActiveTextureARB_null(GLenum){return (void)0;}
+static void m_glBindVertexArray_null(GLuint){return (void)0;}
+static void m_glColor4b_null(GLbyte,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glColor4f_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glColor4d_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glColor4i_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glEdgeFlagFormatNV_null(GLsizei){return (void)0;}
+static void m_glNamedBufferSubData_null(GLuint,GLintptr,GLsizeiptr,const void*){return (void)0;}
+static void m_glDrawElementsInstanced_null(GLenum,GLsizei,GLenum,const void*,GLsizei){return (void)0;}
+static void m_glGetMultiTexParameterIivEXT_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glVertex2dv_null(const GLdouble*){return (void)0;}
+static void m_glDisableVertexArrayAttribEXT_null(GLuint,GLuint){return (void)0;}
+static GLenum m_glObjectUnpurgeableAPPLE_null(GLenum,GLuint,GLenum){return (GLenum)0;}
+static void m_glVertexAttribs2dvNV_null(GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetMapParameterfvNV_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glProgramUniform4ivEXT_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glProgramUniform3ui64vNV_null(GLuint,GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glRectfv_null(const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glTexFilterFuncSGIS_null(GLenum,GLenum,GLsizei,const GLfloat*){return (void)0;}
+static void m_glSpriteParameterfvSGIX_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glCopyMultiTexImage1DEXT_null(GLenum,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){return (void)0;}
+static void m_glGetVertexAttribIuivEXT_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glUniformMatrix2x4dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static GLint m_glGetProgramResourceLocationIndex_null(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void m_glColor3hNV_null(GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glViewport_null(GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramNamedParameter4fNV_null(GLuint,GLsizei,const GLubyte*,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetInvariantBooleanvEXT_null(GLuint,GLenum,GLboolean*){return (void)0;}
+static void m_glTexStorage2DMultisample_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glPixelStorex_null(GLenum,GLfixed){return (void)0;}
+static void m_glVertexAttribL1dvEXT_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetActiveSubroutineUniformiv_null(GLuint,GLenum,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttribPointerARB_null(GLuint,GLint,GLenum,GLboolean,GLsizei,const void*){return (void)0;}
+static void m_glCompressedTexSubImage2DARB_null(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glTexStorageMem1DEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glVertex2hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glTexBuffer_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glArrayElement_null(GLint){return (void)0;}
+static void m_glValidateProgram_null(GLuint){return (void)0;}
+static void m_glPixelStoref_null(GLenum,GLfloat){return (void)0;}
+static void m_glWindowPos3dARB_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glEvalCoord1dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttribs2fvNV_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glRecti_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glTexCoord1bOES_null(GLbyte){return (void)0;}
+static void m_glProgramUniform2i64vARB_null(GLuint,GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glWindowPos2dARB_null(GLdouble,GLdouble){return (void)0;}
+static void m_glGetProgramParameterdvNV_null(GLenum,GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glRectf_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glRectd_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glMap1xOES_null(GLenum,GLfixed,GLfixed,GLint,GLint,GLfixed){return (void)0;}
+static void m_glVertexAttrib3fvNV_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glReferencePlaneSGIX_null(const GLdouble*){return (void)0;}
+static void m_glMulticastBlitFramebufferNV_null(GLuint,GLuint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){return (void)0;}
+static void m_glGetCombinerInputParameterfvNV_null(GLenum,GLenum,GLenum,GLenum,GLfloat*){return (void)0;}
+static GLuint64 m_glGetTextureSamplerHandleARB_null(GLuint,GLuint){return (GLuint64)0;}
+static void m_glBindTexture_null(GLenum,GLuint){return (void)0;}
+static void m_glRects_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetActiveAttribARB_null(GLhandleARB,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLcharARB*){return (void)0;}
+static void m_glHistogramEXT_null(GLenum,GLsizei,GLenum,GLboolean){return (void)0;}
+static GLuint64 m_glGetTextureSamplerHandleNV_null(GLuint,GLuint){return (GLuint64)0;}
+static void m_glDetachShader_null(GLuint,GLuint){return (void)0;}
+static void m_glFinishTextureSUNX_null(){return (void)0;}
+static void m_glUniformMatrix3x4dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glVertexAttrib4fARB_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetPathColorGenivNV_null(GLenum,GLenum,GLint*){return (void)0;}
+static GLint m_glGetProgramResourceLocation_null(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void m_glVertexArrayAttribLFormat_null(GLuint,GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glGetTexLevelParameterfv_null(GLenum,GLint,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexArrayVertexAttribOffsetEXT_null(GLuint,GLuint,GLuint,GLint,GLenum,GLboolean,GLsizei,GLintptr){return (void)0;}
+static void m_glIndexFormatNV_null(GLenum,GLsizei){return (void)0;}
+static void m_glMultiTexCoord3i_null(GLenum,GLint,GLint,GLint){return (void)0;}
+static void m_glReplacementCodeuiVertex3fvSUN_null(const GLuint*,const GLfloat*){return (void)0;}
+static void m_glViewportIndexedfv_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glBindBuffersBase_null(GLenum,GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glTexBumpParameterfvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glMatrixIndexuivARB_null(GLint,const GLuint*){return (void)0;}
+static void m_glVertexAttrib1hNV_null(GLuint,GLhalfNV){return (void)0;}
+static void m_glWindowPos3svMESA_null(const GLshort*){return (void)0;}
+static void m_glStencilOpSeparateATI_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glDrawElementsBaseVertex_null(GLenum,GLsizei,GLenum,const void*,GLint){return (void)0;}
+static void m_glBlendEquationSeparateiARB_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glVertexAttrib1fNV_null(GLuint,GLfloat){return (void)0;}
+static void m_glMapVertexAttrib2fAPPLE_null(GLuint,GLuint,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){return (void)0;}
+static void m_glCompressedTextureSubImage1DEXT_null(GLuint,GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glClearBufferSubData_null(GLenum,GLenum,GLintptr,GLsizeiptr,GLenum,GLenum,const void*){return (void)0;}
+static void m_glTexStorage1D_null(GLenum,GLsizei,GLenum,GLsizei){return (void)0;}
+static void m_glVertexAttribI3iEXT_null(GLuint,GLint,GLint,GLint){return (void)0;}
+static void m_glMakeTextureHandleNonResidentARB_null(GLuint64){return (void)0;}
+static void m_glMultiDrawElementArrayAPPLE_null(GLenum,const GLint*,const GLsizei*,GLsizei){return (void)0;}
+static void m_glVertexStream4dATI_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glProgramUniformMatrix2dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glVertexAttribs2hvNV_null(GLuint,GLsizei,const GLhalfNV*){return (void)0;}
+static void m_glGetUniformiv_null(GLuint,GLint,GLint*){return (void)0;}
+static void m_glClipPlanefOES_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glRenderbufferStorage_null(GLenum,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glUniform4ui_null(GLint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glBindFramebuffer_null(GLenum,GLuint){return (void)0;}
+static void m_glValidateProgramARB_null(GLhandleARB){return (void)0;}
+static void m_glTexGenf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glTexGend_null(GLenum,GLenum,GLdouble){return (void)0;}
+static void m_glTexGeni_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glDeleteFramebuffersEXT_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glResetMinmaxEXT_null(GLenum){return (void)0;}
+static void m_glVertexAttrib1fvNV_null(GLuint,const GLfloat*){return (void)0;}
+static GLboolean m_glIsQueryARB_null(GLuint){return (GLboolean)0;}
+static void m_glEnableVariantClientStateEXT_null(GLuint){return (void)0;}
+static void m_glScissorIndexed_null(GLuint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glGetInvariantIntegervEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramLocalParameterI4uiNV_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glConvolutionParameterxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glGenFramebuffersEXT_null(GLsizei,GLuint*){return (void)0;}
+static void m_glVertexArrayColorOffsetEXT_null(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glMultiTexCoord3ivARB_null(GLenum,const GLint*){return (void)0;}
+static void m_glVertexWeightfEXT_null(GLfloat){return (void)0;}
+static void m_glRasterPos4dv_null(const GLdouble*){return (void)0;}
+static GLboolean m_glIsTextureHandleResidentARB_null(GLuint64){return (GLboolean)0;}
+static void m_glRasterPos2dv_null(const GLdouble*){return (void)0;}
+static void m_glWindowPos4ivMESA_null(const GLint*){return (void)0;}
+static void m_glGetVariantPointervEXT_null(GLuint,GLenum,void**){return (void)0;}
+static void* m_glMapNamedBufferRangeEXT_null(GLuint,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static void m_glGetnUniformui64vARB_null(GLuint,GLint,GLsizei,GLuint64*){return (void)0;}
+static GLuint m_glCreateShaderProgramv_null(GLenum,GLsizei,const GLchar*const*){return (GLuint)0;}
+static void m_glGetQueryObjectiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glMaxShaderCompilerThreadsKHR_null(GLuint){return (void)0;}
+static void m_glPNTrianglesfATI_null(GLenum,GLfloat){return (void)0;}
+static void m_glGlobalAlphaFactorusSUN_null(GLushort){return (void)0;}
+static void m_glVertexAttrib3dvNV_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glMultiTexCoord3sARB_null(GLenum,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGenerateMipmap_null(GLenum){return (void)0;}
+static void m_glCompressedTextureSubImage2D_null(GLuint,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glNamedRenderbufferStorageMultisampleEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glPolygonOffsetClampEXT_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glTextureRangeAPPLE_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glBlendEquationIndexedAMD_null(GLuint,GLenum){return (void)0;}
+static void m_glTexCoord2d_null(GLdouble,GLdouble){return (void)0;}
+static void m_glPointParameteri_null(GLenum,GLint){return (void)0;}
+static void m_glTexCoord2f_null(GLfloat,GLfloat){return (void)0;}
+static void m_glGetUnsignedBytei_vEXT_null(GLenum,GLuint,GLubyte*){return (void)0;}
+static void m_glColor4iv_null(const GLint*){return (void)0;}
+static void* m_glMapNamedBufferRange_null(GLuint,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static GLboolean m_glUnmapBuffer_null(GLenum){return (GLboolean)0;}
+static void m_glSampleMaskEXT_null(GLclampf,GLboolean){return (void)0;}
+static void m_glTexCoord2i_null(GLint,GLint){return (void)0;}
+static void m_glTexCoord1xvOES_null(const GLfixed*){return (void)0;}
+static void m_glVertexAttrib1sARB_null(GLuint,GLshort){return (void)0;}
+static void m_glGetVertexArrayiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramParameter4dvNV_null(GLenum,GLuint,const GLdouble*){return (void)0;}
+static void m_glTexCoord2s_null(GLshort,GLshort){return (void)0;}
+static void m_glTextureParameterIuivEXT_null(GLuint,GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glGetColorTableParameterfvSGI_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glTexCoord4dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttrib1svNV_null(GLuint,const GLshort*){return (void)0;}
+static void m_glNamedFramebufferTextureFaceEXT_null(GLuint,GLenum,GLuint,GLint,GLenum){return (void)0;}
+static void m_glProgramUniform2ui64vNV_null(GLuint,GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glStencilFillPathNV_null(GLuint,GLenum,GLuint){return (void)0;}
+static void m_glNormal3dv_null(const GLdouble*){return (void)0;}
+static void m_glReleaseShaderCompiler_null(){return (void)0;}
+static void m_glTexStorageMem3DEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glTexCoord3bvOES_null(const GLbyte*){return (void)0;}
+static GLboolean m_glIsVertexAttribEnabledAPPLE_null(GLuint,GLenum){return (GLboolean)0;}
+static void m_glTexCoord1dv_null(const GLdouble*){return (void)0;}
+static void m_glReadPixels_null(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glVertexAttribI3iv_null(GLuint,const GLint*){return (void)0;}
+static void m_glSetFenceAPPLE_null(GLuint){return (void)0;}
+static void m_glWeightsvARB_null(GLint,const GLshort*){return (void)0;}
+static void m_glShadeModel_null(GLenum){return (void)0;}
+static void m_glTextureStorageMem3DMultisampleEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean,GLuint,GLuint64){return (void)0;}
+static void m_glMapGrid1d_null(GLint,GLdouble,GLdouble){return (void)0;}
+static void m_glGetHistogramParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glConservativeRasterParameteriNV_null(GLenum,GLint){return (void)0;}
+static void m_glClearNamedBufferData_null(GLuint,GLenum,GLenum,GLenum,const void*){return (void)0;}
+static void m_glClearDepthf_null(GLfloat){return (void)0;}
+static void m_glCreatePerfQueryINTEL_null(GLuint,GLuint*){return (void)0;}
+static void m_glFogCoordfEXT_null(GLfloat){return (void)0;}
+static void m_glVertexAttrib2dARB_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static void m_glMultiTexCoord4dARB_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glReadnPixelsARB_null(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glMultiTexBufferEXT_null(GLenum,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glWindowPos4dvMESA_null(const GLdouble*){return (void)0;}
+static void m_glInvalidateNamedFramebufferData_null(GLuint,GLsizei,const GLenum*){return (void)0;}
+static void m_glSecondaryColorPointerListIBM_null(GLint,GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glRectiv_null(const GLint*,const GLint*){return (void)0;}
+static void m_glColorP4ui_null(GLenum,GLuint){return (void)0;}
+static void m_glUseProgramStages_null(GLuint,GLbitfield,GLuint){return (void)0;}
+static void m_glRasterPos3dv_null(const GLdouble*){return (void)0;}
+static void m_glPathTexGenNV_null(GLenum,GLenum,GLint,const GLfloat*){return (void)0;}
+static void m_glVertexBlendEnviATI_null(GLenum,GLint){return (void)0;}
+static void m_glUniform3i64ARB_null(GLint,GLint64,GLint64,GLint64){return (void)0;}
+static void m_glLoadMatrixf_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniform2dEXT_null(GLuint,GLint,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttribI4iv_null(GLuint,const GLint*){return (void)0;}
+static void m_glNamedFramebufferDrawBuffer_null(GLuint,GLenum){return (void)0;}
+static void m_glColor4ubv_null(const GLubyte*){return (void)0;}
+static void m_glColor3hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glGetMapAttribParameterfvNV_null(GLenum,GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glGetBufferSubData_null(GLenum,GLintptr,GLsizeiptr,void*){return (void)0;}
+static void m_glGetVertexAttribLdv_null(GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glGetnUniformuiv_null(GLuint,GLint,GLsizei,GLuint*){return (void)0;}
+static void m_glGetUniformui64vNV_null(GLuint,GLint,GLuint64EXT*){return (void)0;}
+static void m_glNamedRenderbufferStorageEXT_null(GLuint,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttrib3dNV_null(GLuint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glTextureStorage1DEXT_null(GLuint,GLenum,GLsizei,GLenum,GLsizei){return (void)0;}
+static void m_glPixelTexGenParameteriSGIS_null(GLenum,GLint){return (void)0;}
+static void m_glColorTableEXT_null(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGenBuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glMultiTexCoord3xvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glExecuteProgramNV_null(GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glVariantArrayObjectATI_null(GLuint,GLenum,GLsizei,GLuint,GLuint){return (void)0;}
+static void m_glColor3xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGetnConvolutionFilterARB_null(GLenum,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glNormalFormatNV_null(GLenum,GLsizei){return (void)0;}
+static void m_glGetInvariantFloatvEXT_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glClearNamedFramebufferiv_null(GLuint,GLenum,GLint,const GLint*){return (void)0;}
+static void m_glTexImage3D_null(GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glGenSamplers_null(GLsizei,GLuint*){return (void)0;}
+static GLboolean m_glIsFramebuffer_null(GLuint){return (GLboolean)0;}
+static void m_glProgramUniform3dvEXT_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGetVertexAttribfvNV_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glDrawRangeElementArrayAPPLE_null(GLenum,GLuint,GLuint,GLint,GLsizei){return (void)0;}
+static void m_glUniform3i64NV_null(GLint,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glMatrixPopEXT_null(GLenum){return (void)0;}
+static void m_glVertexStream1sATI_null(GLenum,GLshort){return (void)0;}
+static void m_glGetnPixelMapuivARB_null(GLenum,GLsizei,GLuint*){return (void)0;}
+static void m_glMultiTexEnviEXT_null(GLenum,GLenum,GLenum,GLint){return (void)0;}
+static void m_glVertexAttribI2iEXT_null(GLuint,GLint,GLint){return (void)0;}
+static void m_glProgramParameter4fvNV_null(GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glWaitSemaphoreEXT_null(GLuint,GLuint,const GLuint*,GLuint,const GLuint*,const GLenum*){return (void)0;}
+static void m_glNamedFramebufferSampleLocationsfvNV_null(GLuint,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glTexCoordP4uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glRectxvOES_null(const GLfixed*,const GLfixed*){return (void)0;}
+static void m_glGetVariantIntegervEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glDeleteLists_null(GLuint,GLsizei){return (void)0;}
+static void m_glTexGendv_null(GLenum,GLenum,const GLdouble*){return (void)0;}
+static void m_glVertexP2uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glGetPerfMonitorGroupsAMD_null(GLint*,GLsizei,GLuint*){return (void)0;}
+static void m_glMultTransposeMatrixfARB_null(const GLfloat*){return (void)0;}
+static void m_glVertexAttribI2ivEXT_null(GLuint,const GLint*){return (void)0;}
+static void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glDeleteStatesNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetBufferParameteri64v_null(GLenum,GLenum,GLint64*){return (void)0;}
+static void m_glProgramUniform4dv_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glEdgeFlagPointerEXT_null(GLsizei,GLsizei,const GLboolean*){return (void)0;}
+static void m_glVideoCaptureStreamParameterivNV_null(GLuint,GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glVertexStream4iATI_null(GLenum,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glVDPAUFiniNV_null(){return (void)0;}
+static void m_glMakeBufferNonResidentNV_null(GLenum){return (void)0;}
+static void m_glUniform1ui64ARB_null(GLint,GLuint64){return (void)0;}
+static void m_glStencilStrokePathNV_null(GLuint,GLint,GLuint){return (void)0;}
+static void m_glVariantuivEXT_null(GLuint,const GLuint*){return (void)0;}
+static void m_glCopyTexSubImage3DEXT_null(GLenum,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glSpriteParameteriSGIX_null(GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord1sARB_null(GLenum,GLshort){return (void)0;}
+static void m_glConvolutionParameterfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glMakeTextureHandleResidentNV_null(GLuint64){return (void)0;}
+static void m_glMultMatrixxOES_null(const GLfixed*){return (void)0;}
+static void m_glTextureNormalEXT_null(GLenum){return (void)0;}
+static void m_glGetQueryivARB_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glCompressedMultiTexImage3DEXT_null(GLenum,GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static GLint m_glGetInstrumentsSGIX_null(){return (GLint)0;}
+static void m_glProgramUniformMatrix4x3fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glPointParameterf_null(GLenum,GLfloat){return (void)0;}
+static void m_glProgramUniform3dEXT_null(GLuint,GLint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glMultiTexCoord2hNV_null(GLenum,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glGetConvolutionFilterEXT_null(GLenum,GLenum,GLenum,void*){return (void)0;}
+static void m_glVertexAttrib2hNV_null(GLuint,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glCurrentPaletteMatrixARB_null(GLint){return (void)0;}
+static void m_glFogxvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glCreateRenderbuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glVertexAttrib4Nusv_null(GLuint,const GLushort*){return (void)0;}
+static void m_glCombinerInputNV_null(GLenum,GLenum,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glDepthFunc_null(GLenum){return (void)0;}
+static void m_glWindowPos4fMESA_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glEnableClientStateIndexedEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glTexCoord4iv_null(const GLint*){return (void)0;}
+static void m_glProgramUniform4i64ARB_null(GLuint,GLint,GLint64,GLint64,GLint64,GLint64){return (void)0;}
+static void m_glBlendFunci_null(GLuint,GLenum,GLenum){return (void)0;}
+static void m_glResolveDepthValuesNV_null(){return (void)0;}
+static void m_glTextureColorMaskSGIS_null(GLboolean,GLboolean,GLboolean,GLboolean){return (void)0;}
+static GLuint m_glCreateShaderProgramEXT_null(GLenum,const GLchar*){return (GLuint)0;}
+static void m_glBufferStorage_null(GLenum,GLsizeiptr,const void*,GLbitfield){return (void)0;}
+static void m_glMakeNamedBufferNonResidentNV_null(GLuint){return (void)0;}
+static void m_glRenderbufferStorageMultisampleEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glGetFloati_v_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glUniform2ui64ARB_null(GLint,GLuint64,GLuint64){return (void)0;}
+static void m_glVertex3fv_null(const GLfloat*){return (void)0;}
+static GLint m_glGetUniformLocation_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glVertexStream1svATI_null(GLenum,const GLshort*){return (void)0;}
+static void m_glVertexStream3fATI_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNamedFramebufferDrawBuffers_null(GLuint,GLsizei,const GLenum*){return (void)0;}
+static void m_glUniform2ui64vNV_null(GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glTexCoordPointervINTEL_null(GLint,GLenum,const void**){return (void)0;}
+static void m_glUniform4fv_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glNormalPointerEXT_null(GLenum,GLsizei,GLsizei,const void*){return (void)0;}
+static void m_glVertexAttrib4hNV_null(GLuint,GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glNormal3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexStream2iATI_null(GLenum,GLint,GLint){return (void)0;}
+static void m_glVertexAttribP4uiv_null(GLuint,GLenum,GLboolean,const GLuint*){return (void)0;}
+static void m_glCompressedTextureSubImage3D_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glAsyncMarkerSGIX_null(GLuint){return (void)0;}
+static void m_glTextureStorageSparseAMD_null(GLuint,GLenum,GLenum,GLsizei,GLsizei,GLsizei,GLsizei,GLbitfield){return (void)0;}
+static void m_glGetConvolutionParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glEndPerfQueryINTEL_null(GLuint){return (void)0;}
+static void m_glFragmentLightModeliSGIX_null(GLenum,GLint){return (void)0;}
+static void m_glPrioritizeTexturesEXT_null(GLsizei,const GLuint*,const GLclampf*){return (void)0;}
+static void m_glEndConditionalRender_null(){return (void)0;}
+static void m_glEnableClientState_null(GLenum){return (void)0;}
+static void m_glResetHistogram_null(GLenum){return (void)0;}
+static void m_glGetOcclusionQueryivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glUniform1uiEXT_null(GLint,GLuint){return (void)0;}
+static void m_glMultiTexCoord2sv_null(GLenum,const GLshort*){return (void)0;}
+static void m_glTexSubImage2DEXT_null(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform2uiv_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glMultiTexCoord2iARB_null(GLenum,GLint,GLint){return (void)0;}
+static void m_glGetQueryObjectuiv_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glGenerateMultiTexMipmapEXT_null(GLenum,GLenum){return (void)0;}
+static void m_glVertexAttrib4iv_null(GLuint,const GLint*){return (void)0;}
+static void m_glWindowPos3dvMESA_null(const GLdouble*){return (void)0;}
+static void m_glLabelObjectEXT_null(GLenum,GLuint,GLsizei,const GLchar*){return (void)0;}
+static void m_glProgramUniform1uiv_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glFramebufferTexture_null(GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glMultiTexEnvfEXT_null(GLenum,GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glGetTexGendv_null(GLenum,GLenum,GLdouble*){return (void)0;}
+static void m_glVertex4xOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glVertexAttribI2uivEXT_null(GLuint,const GLuint*){return (void)0;}
+static void m_glNamedProgramLocalParameter4fvEXT_null(GLuint,GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glColor3usv_null(const GLushort*){return (void)0;}
+static void m_glGetPixelTransformParameterfvEXT_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glIndexxvOES_null(const GLfixed*){return (void)0;}
+static void m_glDepthMask_null(GLboolean){return (void)0;}
+static void m_glProgramUniformMatrix2x4fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static GLboolean m_glAreProgramsResidentNV_null(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static void m_glColorTable_null(GLenum,GLenum,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glBeginQueryIndexed_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glVertexStream1dvATI_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glGetMultiTexEnvfvEXT_null(GLenum,GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glDeleteFencesNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glVertexAttribs1dvNV_null(GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glBufferStorageExternalEXT_null(GLenum,GLintptr,GLsizeiptr,GLeglClientBufferEXT,GLbitfield){return (void)0;}
+static void m_glVertexStream2sATI_null(GLenum,GLshort,GLshort){return (void)0;}
+static void m_glGetnSeparableFilterARB_null(GLenum,GLenum,GLenum,GLsizei,void*,GLsizei,void*,void*){return (void)0;}
+static void m_glProgramUniform2dv_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glActiveStencilFaceEXT_null(GLenum){return (void)0;}
+static void m_glProgramUniform4dEXT_null(GLuint,GLint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glPointSizexOES_null(GLfixed){return (void)0;}
+static void m_glRasterPos2sv_null(const GLshort*){return (void)0;}
+static GLuint m_glBindParameterEXT_null(GLenum){return (GLuint)0;}
+static void m_glTexCoord1sv_null(const GLshort*){return (void)0;}
+static void m_glBlendParameteriNV_null(GLenum,GLint){return (void)0;}
+static void m_glNamedProgramLocalParameter4dvEXT_null(GLuint,GLenum,GLuint,const GLdouble*){return (void)0;}
+static void m_glProgramUniformHandleui64NV_null(GLuint,GLint,GLuint64){return (void)0;}
+static void m_glGetTextureParameterfvEXT_null(GLuint,GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glGetPathMetricsNV_null(GLbitfield,GLsizei,GLenum,const void*,GLuint,GLsizei,GLfloat*){return (void)0;}
+static void m_glVertex2i_null(GLint,GLint){return (void)0;}
+static void m_glNewList_null(GLuint,GLenum){return (void)0;}
+static void m_glMatrixLoad3x3fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glMultiTexCoord2fARB_null(GLenum,GLfloat,GLfloat){return (void)0;}
+static void m_glWeightdvARB_null(GLint,const GLdouble*){return (void)0;}
+static GLboolean m_glIsTransformFeedbackNV_null(GLuint){return (GLboolean)0;}
+static void m_glVertexAttribDivisorARB_null(GLuint,GLuint){return (void)0;}
+static void m_glSecondaryColorP3uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glGetnCompressedTexImageARB_null(GLenum,GLint,GLsizei,void*){return (void)0;}
+static void m_glGetIntegerv_null(GLenum,GLint*){return (void)0;}
+static void m_glMatrixLoaddEXT_null(GLenum,const GLdouble*){return (void)0;}
+static GLfloat m_glGetPathLengthNV_null(GLuint,GLsizei,GLsizei){return (GLfloat)0;}
+static void m_glProgramUniformMatrix3dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glUniform4i64NV_null(GLint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glGetHistogramEXT_null(GLenum,GLboolean,GLenum,GLenum,void*){return (void)0;}
+static void m_glVertexAttrib4NuivARB_null(GLuint,const GLuint*){return (void)0;}
+static void m_glMapGrid2xOES_null(GLint,GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glTexImage2D_null(GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glWindowPos2fvARB_null(const GLfloat*){return (void)0;}
+static void m_glEnableIndexedEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glTexCoord1bvOES_null(const GLbyte*){return (void)0;}
+static void m_glDrawPixels_null(GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glMultMatrixd_null(const GLdouble*){return (void)0;}
+static void m_glMultMatrixf_null(const GLfloat*){return (void)0;}
+static void m_glReplacementCodePointerSUN_null(GLenum,GLsizei,const void**){return (void)0;}
+static void m_glLoadTransposeMatrixdARB_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttrib4Nubv_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glVertexArrayVertexAttribIOffsetEXT_null(GLuint,GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glCompileShaderARB_null(GLhandleARB){return (void)0;}
+static void m_glWindowPos3dMESA_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glNormalStream3fvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glColor4usv_null(const GLushort*){return (void)0;}
+static void m_glMapGrid1f_null(GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glPolygonStipple_null(const GLubyte*){return (void)0;}
+static void m_glUniform4ui64ARB_null(GLint,GLuint64,GLuint64,GLuint64,GLuint64){return (void)0;}
+static void m_glTextureRenderbufferEXT_null(GLuint,GLenum,GLuint){return (void)0;}
+static GLint m_glGetSubroutineUniformLocation_null(GLuint,GLenum,const GLchar*){return (GLint)0;}
+static void m_glGetFramebufferParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glPixelMapusv_null(GLenum,GLsizei,const GLushort*){return (void)0;}
+static void m_glGetSamplerParameteriv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexStream2fvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glProgramStringARB_null(GLenum,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glProgramUniformMatrix3dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glSeparableFilter2D_null(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*,const GLvoid*){return (void)0;}
+static void m_glVertexAttribI1uiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glLGPUCopyImageSubDataNVX_null(GLuint,GLbitfield,GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glTexStorage2D_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glColor3fv_null(const GLfloat*){return (void)0;}
+static void m_glGetMultiTexGendvEXT_null(GLenum,GLenum,GLenum,GLdouble*){return (void)0;}
+static void m_glVertexAttribL4dvEXT_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetActiveUniform_null(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*){return (void)0;}
+static void m_glUniform2ui64vARB_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glMakeNamedBufferResidentNV_null(GLuint,GLenum){return (void)0;}
+static GLenum m_glPathGlyphIndexRangeNV_null(GLenum,const void*,GLbitfield,GLuint,GLfloat,GLuint*){return (GLenum)0;}
+static void m_glColorPointer_null(GLint,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glProgramEnvParameterI4ivNV_null(GLenum,GLuint,const GLint*){return (void)0;}
+static void m_glMulticastGetQueryObjectui64vNV_null(GLuint,GLuint,GLenum,GLuint64*){return (void)0;}
+static void m_glMultiTexParameterfEXT_null(GLenum,GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glNamedFramebufferTextureLayer_null(GLuint,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glGetVertexArrayIntegervEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttrib3dARB_null(GLuint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static GLboolean m_glVDPAUIsSurfaceNV_null(GLvdpauSurfaceNV){return (GLboolean)0;}
+static void m_glMultiTexImage1DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static GLboolean m_glIsAsyncMarkerSGIX_null(GLuint){return (GLboolean)0;}
+static void m_glGetDoublei_vEXT_null(GLenum,GLuint,GLdouble*){return (void)0;}
+static void m_glUniform2i64NV_null(GLint,GLint64EXT,GLint64EXT){return (void)0;}
+static GLboolean m_glIsCommandListNV_null(GLuint){return (GLboolean)0;}
+static void m_glUniform3uiEXT_null(GLint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glTexParameterIuivEXT_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glProgramUniformMatrix4fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glVertex2fv_null(const GLfloat*){return (void)0;}
+static void m_glVertexAttribL3dEXT_null(GLuint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glFramebufferRenderbuffer_null(GLenum,GLenum,GLenum,GLuint){return (void)0;}
+static GLint m_glGetUniformLocationARB_null(GLhandleARB,const GLcharARB*){return (GLint)0;}
+static void m_glPathParameterfvNV_null(GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib3sNV_null(GLuint,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetDoublei_v_null(GLenum,GLuint,GLdouble*){return (void)0;}
+static void m_glVertexAttrib1sv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glBindSampler_null(GLuint,GLuint){return (void)0;}
+static void m_glLineWidth_null(GLfloat){return (void)0;}
+static void m_glVertexArrayRangeAPPLE_null(GLsizei,void*){return (void)0;}
+static void m_glBindBufferOffsetEXT_null(GLenum,GLuint,GLuint,GLintptr){return (void)0;}
+static void m_glWeightfvARB_null(GLint,const GLfloat*){return (void)0;}
+static void m_glGetIntegeri_v_null(GLenum,GLuint,GLint*){return (void)0;}
+static void m_glGetTransformFeedbackVarying_null(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){return (void)0;}
+static void m_glProgramLocalParameter4fvARB_null(GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glGetTransformFeedbackVaryingNV_null(GLuint,GLuint,GLint*){return (void)0;}
+static void m_glWindowPos2iv_null(const GLint*){return (void)0;}
+static void m_glVertexStream1dATI_null(GLenum,GLdouble){return (void)0;}
+static void m_glColorFragmentOp2ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glFogiv_null(GLenum,const GLint*){return (void)0;}
+static GLuint64 m_glGetTextureHandleNV_null(GLuint){return (GLuint64)0;}
+static void m_glLightModeliv_null(GLenum,const GLint*){return (void)0;}
+static void m_glDepthRangef_null(GLfloat,GLfloat){return (void)0;}
+static void m_glGetFragmentMaterialivSGIX_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glVideoCaptureStreamParameterfvNV_null(GLuint,GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glDeleteProgramsARB_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glWindowPos3fvARB_null(const GLfloat*){return (void)0;}
+static void m_glFeedbackBufferxOES_null(GLsizei,GLenum,const GLfixed*){return (void)0;}
+static void m_glGetTexBumpParameterfvATI_null(GLenum,GLfloat*){return (void)0;}
+static void m_glEnablei_null(GLenum,GLuint){return (void)0;}
+static void m_glGetActiveSubroutineName_null(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glDrawBuffersARB_null(GLsizei,const GLenum*){return (void)0;}
+static void m_glBindProgramARB_null(GLenum,GLuint){return (void)0;}
+static void m_glEvalCoord1fv_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniform3ui64vARB_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glProgramUniformMatrix2dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glMultiTexCoord2hvNV_null(GLenum,const GLhalfNV*){return (void)0;}
+static void m_glGetFloatIndexedvEXT_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glSampleCoverageARB_null(GLfloat,GLboolean){return (void)0;}
+static void m_glProgramUniform2ui64vARB_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glPixelDataRangeNV_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glVertexStream3svATI_null(GLenum,const GLshort*){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glTexCoord3hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glSampleMaski_null(GLuint,GLbitfield){return (void)0;}
+static void m_glIndexFuncEXT_null(GLenum,GLclampf){return (void)0;}
+static void m_glPointParameteriNV_null(GLenum,GLint){return (void)0;}
+static void m_glUniformMatrix3x2fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetFramebufferParameterivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glUniform2i64ARB_null(GLint,GLint64,GLint64){return (void)0;}
+static void m_glNamedBufferStorageEXT_null(GLuint,GLsizeiptr,const void*,GLbitfield){return (void)0;}
+static void m_glNamedFramebufferTexture3DEXT_null(GLuint,GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glVertexAttrib2dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetVertexArrayPointervEXT_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glGetVertexAttribArrayObjectivATI_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniformMatrix3fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glEnableVertexArrayEXT_null(GLuint,GLenum){return (void)0;}
+static void m_glColorTableParameterfvSGI_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glEdgeFlag_null(GLboolean){return (void)0;}
+static void m_glFogCoordf_null(GLfloat){return (void)0;}
+static void m_glVertex3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertex3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glSpriteParameterivSGIX_null(GLenum,const GLint*){return (void)0;}
+static void m_glPathGlyphRangeNV_null(GLuint,GLenum,const void*,GLbitfield,GLuint,GLsizei,GLenum,GLuint,GLfloat){return (void)0;}
+static void m_glPrimitiveBoundingBoxARB_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexAttribL3ui64vNV_null(GLuint,const GLuint64EXT*){return (void)0;}
+static void m_glVertex3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glTexCoordP2ui_null(GLenum,GLuint){return (void)0;}
+static void m_glProgramUniform2fvEXT_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glDeletePathsNV_null(GLuint,GLsizei){return (void)0;}
+static void m_glPrimitiveRestartIndexNV_null(GLuint){return (void)0;}
+static void m_glTexCoord2fColor3fVertex3fvSUN_null(const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glTexCoordPointerListIBM_null(GLint,GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glRectxOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glCopyNamedBufferSubData_null(GLuint,GLuint,GLintptr,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glGenProgramsNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glFragmentLightfSGIX_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glTexStorage3D_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glTextureParameteriv_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glNamedBufferDataEXT_null(GLuint,GLsizeiptr,const void*,GLenum){return (void)0;}
+static void m_glImportSemaphoreWin32NameEXT_null(GLuint,GLenum,const void*){return (void)0;}
+static void m_glMultiTexCoord3fvARB_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glUniformMatrix3x4fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glSubpixelPrecisionBiasNV_null(GLuint,GLuint){return (void)0;}
+static void m_glNormalPointer_null(GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glNamedFramebufferTexture_null(GLuint,GLenum,GLuint,GLint){return (void)0;}
+static void m_glVertexAttrib4NsvARB_null(GLuint,const GLshort*){return (void)0;}
+static void m_glPassThrough_null(GLfloat){return (void)0;}
+static void m_glSecondaryColorP3ui_null(GLenum,GLuint){return (void)0;}
+static void m_glInvalidateTexSubImage_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){return (void)0;}
+static GLboolean m_glIsImageHandleResidentARB_null(GLuint64){return (GLboolean)0;}
+static void m_glTangent3fvEXT_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix4x3fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glBegin_null(GLenum){return (void)0;}
+static void m_glEvalCoord2dv_null(const GLdouble*){return (void)0;}
+static void m_glColor3ubv_null(const GLubyte*){return (void)0;}
+static void m_glFogCoordfvEXT_null(const GLfloat*){return (void)0;}
+static void m_glVertexP3ui_null(GLenum,GLuint){return (void)0;}
+static void m_glLightfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glVertexAttribL3i64NV_null(GLuint,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glStencilClearTagEXT_null(GLsizei,GLuint){return (void)0;}
+static void m_glGetActiveUniformName_null(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glTangentPointerEXT_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glUniform4ui64vNV_null(GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glDebugMessageEnableAMD_null(GLenum,GLenum,GLsizei,const GLuint*,GLboolean){return (void)0;}
+static void m_glProgramUniform2ui_null(GLuint,GLint,GLuint,GLuint){return (void)0;}
+static void m_glCopyTexSubImage2DEXT_null(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glGenRenderbuffersEXT_null(GLsizei,GLuint*){return (void)0;}
+static void m_glNamedProgramLocalParameterI4ivEXT_null(GLuint,GLenum,GLuint,const GLint*){return (void)0;}
+static void m_glMultiTexCoord2f_null(GLenum,GLfloat,GLfloat){return (void)0;}
+static void m_glMapGrid2d_null(GLint,GLdouble,GLdouble,GLint,GLdouble,GLdouble){return (void)0;}
+static void m_glGetMultiTexParameterIuivEXT_null(GLenum,GLenum,GLenum,GLuint*){return (void)0;}
+static void m_glBlendEquationiARB_null(GLuint,GLenum){return (void)0;}
+static void m_glTexParameteriv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glUniform4ivARB_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glMatrixOrthoEXT_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexArrayVertexBuffer_null(GLuint,GLuint,GLuint,GLintptr,GLsizei){return (void)0;}
+static void m_glProgramLocalParametersI4ivNV_null(GLenum,GLuint,GLsizei,const GLint*){return (void)0;}
+static void m_glProgramUniform4ui64vNV_null(GLuint,GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glGetNamedStringivARB_null(GLint,const GLchar*,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttribL1i64vNV_null(GLuint,const GLint64EXT*){return (void)0;}
+static void m_glTransformFeedbackBufferBase_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glIndexsv_null(const GLshort*){return (void)0;}
+static void m_glPointParameterivNV_null(GLenum,const GLint*){return (void)0;}
+static void m_glGetDetailTexFuncSGIS_null(GLenum,GLfloat*){return (void)0;}
+static void m_glReplacementCodeuiColor3fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glProgramLocalParameter4fARB_null(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glBitmap_null(GLsizei,GLsizei,GLfloat,GLfloat,GLfloat,GLfloat,const GLubyte*){return (void)0;}
+static void m_glNamedFramebufferTextureLayerEXT_null(GLuint,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glMultiTexGenfvEXT_null(GLenum,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glGetNamedBufferSubData_null(GLuint,GLintptr,GLsizeiptr,void*){return (void)0;}
+static void m_glStencilFuncSeparateATI_null(GLenum,GLenum,GLint,GLuint){return (void)0;}
+static void m_glProgramUniform2iv_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glGetQueryiv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glTexCoord4f_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glMapGrid2f_null(GLint,GLfloat,GLfloat,GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glListParameterivSGIX_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glCreateQueries_null(GLenum,GLsizei,GLuint*){return (void)0;}
+static void m_glGetSamplerParameterfv_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glTexCoord4i_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glObjectLabel_null(GLenum,GLuint,GLsizei,const GLchar*){return (void)0;}
+static void m_glProgramUniform3i64NV_null(GLuint,GLint,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static GLuint64 m_glGetTextureHandleARB_null(GLuint){return (GLuint64)0;}
+static void m_glTexCoord4s_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glUniform4iARB_null(GLint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glGetUniformIndices_null(GLuint,GLsizei,const GLchar*const*,GLuint*){return (void)0;}
+static void m_glMultiTexImage3DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glCoverageModulationTableNV_null(GLsizei,const GLfloat*){return (void)0;}
+static void m_glPointParameteriv_null(GLenum,const GLint*){return (void)0;}
+static void m_glMultiTexCoord4svARB_null(GLenum,const GLshort*){return (void)0;}
+static void m_glNormal3fv_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix3x4dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glTexCoord1fv_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix4x3dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetActiveVaryingNV_null(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){return (void)0;}
+static void m_glUniform1i64vARB_null(GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glMultiTexCoord1dv_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glTexCoord3fv_null(const GLfloat*){return (void)0;}
+static void m_glMatrixTranslatefEXT_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glProgramUniform1ui64vNV_null(GLuint,GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glTextureMaterialEXT_null(GLenum,GLenum){return (void)0;}
+static void m_glMultiTexCoordP3uiv_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glVertexAttribP3ui_null(GLuint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glInterpolatePathsNV_null(GLuint,GLuint,GLuint,GLfloat){return (void)0;}
+static void m_glTextureBufferRange_null(GLuint,GLenum,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glVertexAttribL2dEXT_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static void m_glGetPixelTransformParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glTexCoord4xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGetVariantBooleanvEXT_null(GLuint,GLenum,GLboolean*){return (void)0;}
+static void m_glDepthRange_null(GLclampd,GLclampd){return (void)0;}
+static void m_glGetVertexAttribdvARB_null(GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glGetColorTableParameterfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glDrawArraysInstancedEXT_null(GLenum,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glDisableClientStateIndexedEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glDrawBuffer_null(GLenum){return (void)0;}
+static void m_glMultiDrawArraysIndirectBindlessNV_null(GLenum,const void*,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glGetnPixelMapusv_null(GLenum,GLsizei,GLushort*){return (void)0;}
+static void m_glRasterPos3fv_null(const GLfloat*){return (void)0;}
+static void m_glClearBufferuiv_null(GLenum,GLint,const GLuint*){return (void)0;}
+static void m_glGetInternalformati64v_null(GLenum,GLenum,GLenum,GLsizei,GLint64*){return (void)0;}
+static void m_glShaderSourceARB_null(GLhandleARB,GLsizei,const GLcharARB**,const GLint*){return (void)0;}
+static void m_glShaderOp3EXT_null(GLenum,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glWindowPos2dvMESA_null(const GLdouble*){return (void)0;}
+static void m_glClearIndex_null(GLfloat){return (void)0;}
+static void m_glProvokingVertexEXT_null(GLenum){return (void)0;}
+static void m_glVariantubvEXT_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glFlush_null(){return (void)0;}
+static void m_glFramebufferTexture2DEXT_null(GLenum,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glGetColorTableParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glPresentFrameDualFillNV_null(GLuint,GLuint64EXT,GLuint,GLuint,GLenum,GLenum,GLuint,GLenum,GLuint,GLenum,GLuint,GLenum,GLuint){return (void)0;}
+static GLuint m_glGenVertexShadersEXT_null(GLuint){return (GLuint)0;}
+static void m_glSpecializeShaderARB_null(GLuint,const GLchar*,GLuint,const GLuint*,const GLuint*){return (void)0;}
+static void m_glProgramUniformHandleui64vARB_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glDepthRangefOES_null(GLclampf,GLclampf){return (void)0;}
+static void m_glDeleteVertexArrays_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glDrawElementsInstancedBaseVertexBaseInstance_null(GLenum,GLsizei,GLenum,const void*,GLsizei,GLint,GLuint){return (void)0;}
+static void m_glGetTexLevelParameteriv_null(GLenum,GLint,GLenum,GLint*){return (void)0;}
+static void m_glDrawVkImageNV_null(GLuint64,GLuint,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glWindowPos3iARB_null(GLint,GLint,GLint){return (void)0;}
+static void m_glPrioritizeTextures_null(GLsizei,const GLuint*,const GLclampf*){return (void)0;}
+static void m_glWindowPos3fvMESA_null(const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix3x2dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glVertex4xvOES_null(const GLfixed*){return (void)0;}
+static void m_glTexStorage3DMultisample_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glWindowPos2sARB_null(GLshort,GLshort){return (void)0;}
+static void m_glStencilOpValueAMD_null(GLenum,GLuint){return (void)0;}
+static void m_glProgramVertexLimitNV_null(GLenum,GLint){return (void)0;}
+static void m_glGetTexParameterPointervAPPLE_null(GLenum,GLenum,void**){return (void)0;}
+static void m_glProgramUniform3uivEXT_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glClampColor_null(GLenum,GLenum){return (void)0;}
+static void m_glClearStencil_null(GLint){return (void)0;}
+static void m_glTexCoordP1uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glVertexAttribs3svNV_null(GLuint,GLsizei,const GLshort*){return (void)0;}
+static void m_glMultiTexCoord3fv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glVertexBlendEnvfATI_null(GLenum,GLfloat){return (void)0;}
+static GLboolean m_glIsFenceAPPLE_null(GLuint){return (GLboolean)0;}
+static void m_glGetBufferParameterui64vNV_null(GLenum,GLenum,GLuint64EXT*){return (void)0;}
+static void m_glVertexAttribI4bvEXT_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glUniform2fARB_null(GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glStopInstrumentsSGIX_null(GLint){return (void)0;}
+static void m_glVertexAttrib3fNV_null(GLuint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glMapVertexAttrib2dAPPLE_null(GLuint,GLuint,GLdouble,GLdouble,GLint,GLint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){return (void)0;}
+static void m_glVertex2f_null(GLfloat,GLfloat){return (void)0;}
+static void m_glCopyTextureImage2DEXT_null(GLuint,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glVertex2d_null(GLdouble,GLdouble){return (void)0;}
+static void m_glSecondaryColor3bvEXT_null(const GLbyte*){return (void)0;}
+static void m_glMultiTexCoord4fARB_null(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glPolygonOffset_null(GLfloat,GLfloat){return (void)0;}
+static void m_glTangent3bvEXT_null(const GLbyte*){return (void)0;}
+static void m_glHistogram_null(GLenum,GLsizei,GLenum,GLboolean){return (void)0;}
+static void m_glGetProgramiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glMatrixIndexubvARB_null(GLint,const GLubyte*){return (void)0;}
+static void m_glVertex2s_null(GLshort,GLshort){return (void)0;}
+static void m_glGetVertexAttribLui64vNV_null(GLuint,GLenum,GLuint64EXT*){return (void)0;}
+static void m_glGetProgramStringARB_null(GLenum,GLenum,void*){return (void)0;}
+static void m_glFlushMappedBufferRange_null(GLenum,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glVertexAttribI3uiEXT_null(GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glLineWidthxOES_null(GLfixed){return (void)0;}
+static void m_glProgramUniformMatrix2fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetTextureParameterIuivEXT_null(GLuint,GLenum,GLenum,GLuint*){return (void)0;}
+static void m_glGetMultiTexEnvivEXT_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glPixelTexGenParameterivSGIS_null(GLenum,const GLint*){return (void)0;}
+static void m_glGenQueries_null(GLsizei,GLuint*){return (void)0;}
+static void m_glGetPixelMapfv_null(GLenum,GLfloat*){return (void)0;}
+static void m_glBlendColorEXT_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glResetMinmax_null(GLenum){return (void)0;}
+static void m_glGetnUniformivARB_null(GLuint,GLint,GLsizei,GLint*){return (void)0;}
+static void m_glVertexBlendARB_null(GLint){return (void)0;}
+static void m_glVertexAttrib4d_null(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static GLint m_glGetVaryingLocationNV_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glGetMapAttribParameterivNV_null(GLenum,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glTexSubImage3D_null(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glDeleteSamplers_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetLightxOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glGetVertexAttribArrayObjectfvATI_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexArrayNormalOffsetEXT_null(GLuint,GLuint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glGetBufferParameterivARB_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetTextureParameterfv_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glDrawMeshArraysSUN_null(GLenum,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttrib4dNV_null(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetMultisamplefvNV_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void* m_glMapObjectBufferATI_null(GLuint){return (void*)0;}
+static void m_glGetPathCommandsNV_null(GLuint,GLubyte*){return (void)0;}
+static void m_glVertexArrayTexCoordOffsetEXT_null(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glGetHistogram_null(GLenum,GLboolean,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glMatrixMode_null(GLenum){return (void)0;}
+static void m_glColorFormatNV_null(GLint,GLenum,GLsizei){return (void)0;}
+static void m_glProgramUniformui64NV_null(GLuint,GLint,GLuint64EXT){return (void)0;}
+static void m_glProgramUniformMatrix4x2fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glLoadMatrixxOES_null(const GLfixed*){return (void)0;}
+static void m_glGetColorTableParameterfvEXT_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glRasterPos4i_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glVertexAttribL2i64NV_null(GLuint,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glBindTextures_null(GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glMatrixRotatefEXT_null(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetClipPlanexOES_null(GLenum,GLfixed*){return (void)0;}
+static void m_glSecondaryColor3uivEXT_null(const GLuint*){return (void)0;}
+static void m_glGetPerfQueryInfoINTEL_null(GLuint,GLuint,GLchar*,GLuint*,GLuint*,GLuint*,GLuint*){return (void)0;}
+static void m_glGetDoublev_null(GLenum,GLdouble*){return (void)0;}
+static void m_glBindBufferRangeEXT_null(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glCompressedTexImage2D_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const GLvoid*){return (void)0;}
+static void* m_glMapBufferARB_null(GLenum,GLenum){return (void*)0;}
+static void m_glGetPathSpacingNV_null(GLenum,GLsizei,GLenum,const void*,GLuint,GLfloat,GLfloat,GLenum,GLfloat*){return (void)0;}
+static void m_glUniform4dv_null(GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGlobalAlphaFactordSUN_null(GLdouble){return (void)0;}
+static void m_glProgramUniform3dv_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGetShaderSourceARB_null(GLhandleARB,GLsizei,GLsizei*,GLcharARB*){return (void)0;}
+static void m_glVertexAttrib3dvARB_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glInvalidateBufferData_null(GLuint){return (void)0;}
+static void m_glMatrixLoad3x2fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glCompressedTextureSubImage1D_null(GLuint,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glTexCoord3xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGenTexturesEXT_null(GLsizei,GLuint*){return (void)0;}
+static void m_glTangent3iEXT_null(GLint,GLint,GLint){return (void)0;}
+static void m_glClearTexImage_null(GLuint,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glBinormal3bvEXT_null(const GLbyte*){return (void)0;}
+static void m_glUniform3fv_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glGetnPixelMapusvARB_null(GLenum,GLsizei,GLushort*){return (void)0;}
+static void m_glMemoryObjectParameterivEXT_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glGenSemaphoresEXT_null(GLsizei,GLuint*){return (void)0;}
+static void m_glMultiTexCoordP1ui_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glClearNamedBufferDataEXT_null(GLuint,GLenum,GLenum,GLenum,const void*){return (void)0;}
+static void m_glUniformMatrix4dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glWindowPos3fMESA_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glDeleteRenderbuffers_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetTextureLevelParameterfvEXT_null(GLuint,GLenum,GLint,GLenum,GLfloat*){return (void)0;}
+static void m_glGetHistogramParameterxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glMultiDrawElements_null(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei){return (void)0;}
+static void m_glMakeImageHandleNonResidentNV_null(GLuint64){return (void)0;}
+static void m_glTexSubImage1DEXT_null(GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glNormalStream3dATI_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttribL4i64vNV_null(GLuint,const GLint64EXT*){return (void)0;}
+static void m_glDrawBuffers_null(GLsizei,const GLenum*){return (void)0;}
+static void m_glCopyTextureSubImage1DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glWindowRectanglesEXT_null(GLenum,GLsizei,const GLint*){return (void)0;}
+static void m_glNamedFramebufferReadBuffer_null(GLuint,GLenum){return (void)0;}
+static void m_glUniform2i64vARB_null(GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glVertexAttribI1uivEXT_null(GLuint,const GLuint*){return (void)0;}
+static void m_glGetTexGenfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glBeginQueryARB_null(GLenum,GLuint){return (void)0;}
+static void m_glUniform1iARB_null(GLint,GLint){return (void)0;}
+static void m_glVertex4bvOES_null(const GLbyte*){return (void)0;}
+static void m_glInvalidateSubFramebuffer_null(GLenum,GLsizei,const GLenum*,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glUniform1fvARB_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static GLboolean m_glTestFenceNV_null(GLuint){return (GLboolean)0;}
+static void m_glBindTransformFeedback_null(GLenum,GLuint){return (void)0;}
+static void m_glMultiTexCoord2iv_null(GLenum,const GLint*){return (void)0;}
+static void m_glCopyMultiTexSubImage1DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glVariantbvEXT_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glTexCoord1hNV_null(GLhalfNV){return (void)0;}
+static void m_glGenFencesNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glRasterPos3iv_null(const GLint*){return (void)0;}
+static void m_glVertexAttribL2ui64NV_null(GLuint,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glMultiTexCoord1hvNV_null(GLenum,const GLhalfNV*){return (void)0;}
+static void m_glGetnConvolutionFilter_null(GLenum,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glNormal3bv_null(const GLbyte*){return (void)0;}
+static void m_glWeightbvARB_null(GLint,const GLbyte*){return (void)0;}
+static void m_glTexCoord4sv_null(const GLshort*){return (void)0;}
+static void m_glUniform2uiv_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glBeginConditionalRenderNVX_null(GLuint){return (void)0;}
+static void m_glFinish_null(){return (void)0;}
+static void m_glColorTableParameterfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glFragmentCoverageColorNV_null(GLuint){return (void)0;}
+static void m_glProgramUniform3ivEXT_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glVertexArrayVertexOffsetEXT_null(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glViewportPositionWScaleNV_null(GLuint,GLfloat,GLfloat){return (void)0;}
+static void m_glGetProgramLocalParameterIuivNV_null(GLenum,GLuint,GLuint*){return (void)0;}
+static void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_null(const GLuint*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glUniform1uiv_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glUniformMatrix2dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glIndexdv_null(const GLdouble*){return (void)0;}
+static void m_glSecondaryColor3ivEXT_null(const GLint*){return (void)0;}
+static void m_glTexCoord3iv_null(const GLint*){return (void)0;}
+static void m_glVertexStream4fvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glDeformationMap3fSGIX_null(GLenum,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,GLfloat,GLfloat,GLint,GLint,const GLfloat*){return (void)0;}
+static void m_glClearDepth_null(GLclampd){return (void)0;}
+static GLuint m_glGenAsyncMarkersSGIX_null(GLsizei){return (GLuint)0;}
+static void m_glDisableIndexedEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glVertexWeightfvEXT_null(const GLfloat*){return (void)0;}
+static void m_glGetProgramLocalParameterIivNV_null(GLenum,GLuint,GLint*){return (void)0;}
+static void m_glCompressedTexImage3DARB_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glProgramParameter4fNV_null(GLenum,GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glConvolutionParameterxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glInsertComponentEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glCreateTextures_null(GLenum,GLsizei,GLuint*){return (void)0;}
+static void m_glSecondaryColor3iv_null(const GLint*){return (void)0;}
+static void m_glCreateBuffers_null(GLsizei,GLuint*){return (void)0;}
+static void m_glMultiTexCoord2xvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glTexGenxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glMultTransposeMatrixf_null(const GLfloat*){return (void)0;}
+static void m_glBeginTransformFeedbackEXT_null(GLenum){return (void)0;}
+static void m_glTexCoord2fColor3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glNormal3sv_null(const GLshort*){return (void)0;}
+static void m_glFreeObjectBufferATI_null(GLuint){return (void)0;}
+static void m_glBlendBarrierNV_null(){return (void)0;}
+static void m_glUniform4i64vNV_null(GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glGetnUniformuivARB_null(GLuint,GLint,GLsizei,GLuint*){return (void)0;}
+static void m_glAlphaFragmentOp3ATI_null(GLenum,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramEnvParameters4fvEXT_null(GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glBlendFuncSeparateEXT_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glConvolutionParameterivEXT_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glPixelTexGenSGIX_null(GLenum){return (void)0;}
+static void m_glDeleteProgram_null(GLuint){return (void)0;}
+static void m_glUniformMatrix4x3dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetVideoCaptureStreamivNV_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniform4uiEXT_null(GLuint,GLint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glMakeImageHandleNonResidentARB_null(GLuint64){return (void)0;}
+static void m_glSecondaryColor3dEXT_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glDeleteQueries_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glNormalP3uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glRasterPos2d_null(GLdouble,GLdouble){return (void)0;}
+static void m_glInitNames_null(){return (void)0;}
+static void m_glBinormal3fvEXT_null(const GLfloat*){return (void)0;}
+static void m_glColor3dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexArrayVertexAttribDivisorEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glArrayElementEXT_null(GLint){return (void)0;}
+static void m_glProgramParameter4dNV_null(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glIndexxOES_null(GLfixed){return (void)0;}
+static void m_glUniform3uivEXT_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glPopGroupMarkerEXT_null(){return (void)0;}
+static void m_glClearNamedFramebufferuiv_null(GLuint,GLenum,GLint,const GLuint*){return (void)0;}
+static void m_glSetLocalConstantEXT_null(GLuint,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform1ui64NV_null(GLuint,GLint,GLuint64EXT){return (void)0;}
+static void m_glColor4hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glGetVertexAttribfv_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glDispatchCompute_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetActiveAttrib_null(GLuint,GLuint,GLsizei,GLsizei*,GLint*,GLenum*,GLchar*){return (void)0;}
+static void m_glFragmentColorMaterialSGIX_null(GLenum,GLenum){return (void)0;}
+static void m_glTexSubImage2D_null(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glGetnMinmaxARB_null(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glLogicOp_null(GLenum){return (void)0;}
+static void m_glProgramUniformMatrix3x4fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glWindowPos4iMESA_null(GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glPixelTransferf_null(GLenum,GLfloat){return (void)0;}
+static void m_glGetTextureParameterIuiv_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glMultiTexCoord1xOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glProgramUniformMatrix4dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetnUniformiv_null(GLuint,GLint,GLsizei,GLint*){return (void)0;}
+static void m_glFramebufferTexture1DEXT_null(GLenum,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glVertexPointervINTEL_null(GLint,GLenum,const void**){return (void)0;}
+static void m_glTextureParameterIiv_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glGetSeparableFilterEXT_null(GLenum,GLenum,GLenum,void*,void*,void*){return (void)0;}
+static void m_glMultiTexCoord3iARB_null(GLenum,GLint,GLint,GLint){return (void)0;}
+static void m_glRasterPos4xvOES_null(const GLfixed*){return (void)0;}
+static void m_glDrawTransformFeedbackStream_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glVertex3hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glVertexArrayMultiTexCoordOffsetEXT_null(GLuint,GLuint,GLenum,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glProvokingVertex_null(GLenum){return (void)0;}
+static void m_glAccumxOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glShaderBinary_null(GLsizei,const GLuint*,GLenum,const void*,GLsizei){return (void)0;}
+static void m_glGetMultiTexGenivEXT_null(GLenum,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glPointParameterxvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glCreateStatesNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glClearDepthdNV_null(GLdouble){return (void)0;}
+static void m_glClearColorIuiEXT_null(GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glBindMultiTextureEXT_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glTexGeniv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glDrawElements_null(GLenum,GLsizei,GLenum,const GLvoid*){return (void)0;}
+static void m_glProgramUniform4iv_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glDisableVertexArrayEXT_null(GLuint,GLenum){return (void)0;}
+static void m_glProgramUniform3ui64NV_null(GLuint,GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glClientActiveTexture_null(GLenum){return (void)0;}
+static void m_glMultiTexParameterIivEXT_null(GLenum,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glUniform1i64ARB_null(GLint,GLint64){return (void)0;}
+static void m_glUniform1iv_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glMulticastBarrierNV_null(){return (void)0;}
+static void m_glVertexAttribArrayObjectATI_null(GLuint,GLint,GLenum,GLboolean,GLsizei,GLuint,GLuint){return (void)0;}
+static void m_glUniform2iARB_null(GLint,GLint,GLint){return (void)0;}
+static void m_glDrawArraysInstanced_null(GLenum,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttrib2sNV_null(GLuint,GLshort,GLshort){return (void)0;}
+static void m_glTexBufferEXT_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glVertexStream2fATI_null(GLenum,GLfloat,GLfloat){return (void)0;}
+static void m_glDebugMessageCallbackAMD_null(GLDEBUGPROCAMD,void*){return (void)0;}
+static void m_glSamplerParameteriv_null(GLuint,GLenum,const GLint*){return (void)0;}
+static void m_glVertexAttrib4uiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glEndQueryIndexed_null(GLenum,GLuint){return (void)0;}
+static void m_glNormalStream3sATI_null(GLenum,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glProgramParameteriARB_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glTexEnvxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glProgramUniform1iv_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glDisableVertexAttribAPPLE_null(GLuint,GLenum){return (void)0;}
+static void m_glBindRenderbuffer_null(GLenum,GLuint){return (void)0;}
+static void m_glMultiTexSubImage3DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static GLboolean m_glIsProgram_null(GLuint){return (GLboolean)0;}
+static void m_glMultiDrawElementsIndirectAMD_null(GLenum,GLenum,const void*,GLsizei,GLsizei){return (void)0;}
+static void m_glGetProgramInfoLog_null(GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glGetLocalConstantBooleanvEXT_null(GLuint,GLenum,GLboolean*){return (void)0;}
+static void m_glPixelTransformParameteriEXT_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glTexCoord4bOES_null(GLbyte,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glVertexAttrib4fv_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glProgramUniformMatrix2x3dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glProgramEnvParametersI4uivNV_null(GLenum,GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glTexCoord3xOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glLoadTransposeMatrixfARB_null(const GLfloat*){return (void)0;}
+static void m_glImageTransformParameteriHP_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord4xOES_null(GLenum,GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glVertexAttribs3fvNV_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib2fv_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glUniform3ui64NV_null(GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glCombinerParameterfvNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glFragmentMaterialiSGIX_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glGetBooleani_v_null(GLenum,GLuint,GLboolean*){return (void)0;}
+static GLuint m_glGetProgramResourceIndex_null(GLuint,GLenum,const GLchar*){return (GLuint)0;}
+static void m_glBeginConditionalRenderNV_null(GLuint,GLenum){return (void)0;}
+static void m_glDisableClientState_null(GLenum){return (void)0;}
+static void m_glPathFogGenNV_null(GLenum){return (void)0;}
+static void m_glStencilThenCoverFillPathNV_null(GLuint,GLenum,GLuint,GLenum){return (void)0;}
+static void m_glVertexArrayIndexOffsetEXT_null(GLuint,GLuint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glProgramBufferParametersIuivNV_null(GLenum,GLuint,GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glPixelTransformParameterivEXT_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glDisableClientStateiEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glTexBufferARB_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glGetLocalConstantIntegervEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glColor4uiv_null(const GLuint*){return (void)0;}
+static void m_glProgramUniform3i_null(GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glMultiDrawElementsIndirectBindlessCountNV_null(GLenum,GLenum,const void*,GLsizei,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glGetBufferPointervARB_null(GLenum,GLenum,void**){return (void)0;}
+static void m_glMultiTexParameterIuivEXT_null(GLenum,GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glEvalMesh2_null(GLenum,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glEvalMesh1_null(GLenum,GLint,GLint){return (void)0;}
+static void m_glProgramUniform3f_null(GLuint,GLint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glStencilThenCoverFillPathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLenum,GLuint,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glProgramUniform3d_null(GLuint,GLint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glMapVertexAttrib1dAPPLE_null(GLuint,GLuint,GLdouble,GLdouble,GLint,GLint,const GLdouble*){return (void)0;}
+static void m_glEvalCoord2fv_null(const GLfloat*){return (void)0;}
+static void m_glGetUniformivARB_null(GLhandleARB,GLint,GLint*){return (void)0;}
+static void m_glLoadTransposeMatrixd_null(const GLdouble*){return (void)0;}
+static void m_glLoadTransposeMatrixf_null(const GLfloat*){return (void)0;}
+static void m_glGetPointervEXT_null(GLenum,void**){return (void)0;}
+static void m_glSignalVkSemaphoreNV_null(GLuint64){return (void)0;}
+static void m_glEndConditionalRenderNV_null(){return (void)0;}
+static void m_glTexCoord2fNormal3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glUniform3i64vARB_null(GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glProgramUniform2uiEXT_null(GLuint,GLint,GLuint,GLuint){return (void)0;}
+static void m_glVertexAttribI1ui_null(GLuint,GLuint){return (void)0;}
+static void m_glProgramNamedParameter4dvNV_null(GLuint,GLsizei,const GLubyte*,const GLdouble*){return (void)0;}
+static void m_glCompileCommandListNV_null(GLuint){return (void)0;}
+static void m_glGetRenderbufferParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetnPolygonStipple_null(GLsizei,GLubyte*){return (void)0;}
+static GLboolean m_glIsBufferResidentNV_null(GLenum){return (GLboolean)0;}
+static void m_glSecondaryColor3ubvEXT_null(const GLubyte*){return (void)0;}
+static void m_glGetNamedRenderbufferParameterivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glNamedFramebufferSampleLocationsfvARB_null(GLuint,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glMultiTexGendvEXT_null(GLenum,GLenum,GLenum,const GLdouble*){return (void)0;}
+static void m_glVertexArrayRangeNV_null(GLsizei,const void*){return (void)0;}
+static GLboolean m_glIsTextureHandleResidentNV_null(GLuint64){return (GLboolean)0;}
+static void m_glGetProgramEnvParameterdvARB_null(GLenum,GLuint,GLdouble*){return (void)0;}
+static GLboolean m_glIsNamedStringARB_null(GLint,const GLchar*){return (GLboolean)0;}
+static void m_glSecondaryColorFormatNV_null(GLint,GLenum,GLsizei){return (void)0;}
+static void m_glVertexAttrib4ubvNV_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glTagSampleBufferSGIX_null(){return (void)0;}
+static void m_glVDPAUUnregisterSurfaceNV_null(GLvdpauSurfaceNV){return (void)0;}
+static void m_glGetPerfQueryIdByNameINTEL_null(GLchar*,GLuint*){return (void)0;}
+static void m_glGetInteger64v_null(GLenum,GLint64*){return (void)0;}
+static void m_glClipPlane_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glColor4ubVertex3fSUN_null(GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glIndexub_null(GLubyte){return (void)0;}
+static void m_glGetProgramEnvParameterfvARB_null(GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glVertexAttrib4usvARB_null(GLuint,const GLushort*){return (void)0;}
+static void m_glNamedFramebufferRenderbuffer_null(GLuint,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glProgramUniformMatrix3x4dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static GLboolean m_glTestFenceAPPLE_null(GLuint){return (GLboolean)0;}
+static void m_glVertexAttrib4Niv_null(GLuint,const GLint*){return (void)0;}
+static void m_glVertexAttribL2i64vNV_null(GLuint,const GLint64EXT*){return (void)0;}
+static void m_glColorP4uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glUniformMatrix2x3fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glCallCommandListNV_null(GLuint){return (void)0;}
+static void m_glClearBufferiv_null(GLenum,GLint,const GLint*){return (void)0;}
+static void m_glNamedStringARB_null(GLenum,GLint,const GLchar*,GLint,const GLchar*){return (void)0;}
+static void m_glMatrixMult3x2fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glGetNamedProgramStringEXT_null(GLuint,GLenum,GLenum,void*){return (void)0;}
+static void m_glGetnHistogramARB_null(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glGetTextureLevelParameterfv_null(GLuint,GLint,GLenum,GLfloat*){return (void)0;}
+static void m_glMultiTexCoord1fv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glBitmapxOES_null(GLsizei,GLsizei,GLfixed,GLfixed,GLfixed,GLfixed,const GLubyte*){return (void)0;}
+static void m_glGetSamplerParameterIuiv_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glTexCoordP3ui_null(GLenum,GLuint){return (void)0;}
+static void m_glTextureSubImage1D_null(GLuint,GLint,GLint,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glVertexAttribLPointerEXT_null(GLuint,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glFogCoordPointerEXT_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glWindowPos3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttribs2svNV_null(GLuint,GLsizei,const GLshort*){return (void)0;}
+static void m_glTextureImage3DEXT_null(GLuint,GLenum,GLint,GLint,GLsizei,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glWindowPos3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glWindowPos3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glWindowPos3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static GLboolean m_glIsEnabledIndexedEXT_null(GLenum,GLuint){return (GLboolean)0;}
+static void m_glGetNamedProgramivEXT_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glVertex3xvOES_null(const GLfixed*){return (void)0;}
+static void m_glColor3us_null(GLushort,GLushort,GLushort){return (void)0;}
+static void m_glBeginPerfMonitorAMD_null(GLuint){return (void)0;}
+static void m_glProgramUniformMatrix4x3dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glGetNamedProgramLocalParameterIuivEXT_null(GLuint,GLenum,GLuint,GLuint*){return (void)0;}
+static void m_glReadnPixels_null(GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glMultiTexCoord4f_null(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glColor3ub_null(GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glMultiTexCoord4d_null(GLenum,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttribL3ui64NV_null(GLuint,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glColor3ui_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramUniform4fvEXT_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib2sARB_null(GLuint,GLshort,GLshort){return (void)0;}
+static void m_glMultiTexCoord4i_null(GLenum,GLint,GLint,GLint,GLint){return (void)0;}
+static GLenum m_glCheckFramebufferStatusEXT_null(GLenum){return (GLenum)0;}
+static void m_glGetnMapivARB_null(GLenum,GLenum,GLsizei,GLint*){return (void)0;}
+static void m_glMultiTexCoord1ivARB_null(GLenum,const GLint*){return (void)0;}
+static void m_glDisableVertexAttribArrayARB_null(GLuint){return (void)0;}
+static void m_glGetPolygonStipple_null(GLubyte*){return (void)0;}
+static void m_glVertexAttribI4ui_null(GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetPathDashArrayNV_null(GLuint,GLfloat*){return (void)0;}
+static void m_glMultiTexRenderbufferEXT_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glCopyTextureSubImage1D_null(GLuint,GLint,GLint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glDeleteOcclusionQueriesNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glVertex4hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glGetnTexImage_null(GLenum,GLint,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glProgramLocalParameter4dARB_null(GLenum,GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glBlendEquation_null(GLenum){return (void)0;}
+static void m_glUnlockArraysEXT_null(){return (void)0;}
+static void m_glGetQueryObjectui64vEXT_null(GLuint,GLenum,GLuint64*){return (void)0;}
+static void m_glVertexAttribI4uivEXT_null(GLuint,const GLuint*){return (void)0;}
+static void m_glUniform1i64vNV_null(GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glMultiTexCoord3dv_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glColor4sv_null(const GLshort*){return (void)0;}
+static void m_glVertexStream4ivATI_null(GLenum,const GLint*){return (void)0;}
+static void m_glPopClientAttrib_null(){return (void)0;}
+static void m_glClearBufferData_null(GLenum,GLenum,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGetProgramivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glBeginTransformFeedback_null(GLenum){return (void)0;}
+static void m_glFinishObjectAPPLE_null(GLenum,GLint){return (void)0;}
+static void m_glGetMinmaxParameterivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glColor3iv_null(const GLint*){return (void)0;}
+static void m_glVertexAttrib3sv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glCompressedTexImage1D_null(GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const GLvoid*){return (void)0;}
+static void m_glDeleteTransformFeedbacks_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetVideoi64vNV_null(GLuint,GLenum,GLint64EXT*){return (void)0;}
+static void m_glDrawRangeElementsBaseVertex_null(GLenum,GLuint,GLuint,GLsizei,GLenum,const void*,GLint){return (void)0;}
+static void m_glUniform4i64vARB_null(GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glTextureStorage3DMultisampleEXT_null(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glGetTexParameterfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glProgramUniformui64vNV_null(GLuint,GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glCompressedMultiTexImage1DEXT_null(GLenum,GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glProgramUniform2ivEXT_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glPushGroupMarkerEXT_null(GLsizei,const GLchar*){return (void)0;}
+static void m_glVertexAttrib1dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glMatrixLoadIdentityEXT_null(GLenum){return (void)0;}
+static void m_glMultTransposeMatrixxOES_null(const GLfixed*){return (void)0;}
+static void m_glGetPixelMapxv_null(GLenum,GLint,GLfixed*){return (void)0;}
+static void m_glFramebufferSampleLocationsfvARB_null(GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glGetLightiv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glBlendFuncSeparatei_null(GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static GLboolean m_glAcquireKeyedMutexWin32EXT_null(GLuint,GLuint64,GLuint){return (GLboolean)0;}
+static void m_glGetBooleanIndexedvEXT_null(GLenum,GLuint,GLboolean*){return (void)0;}
+static void m_glGetProgramSubroutineParameteruivNV_null(GLenum,GLuint,GLuint*){return (void)0;}
+static void m_glUniform2ui_null(GLint,GLuint,GLuint){return (void)0;}
+static void m_glApplyFramebufferAttachmentCMAAINTEL_null(){return (void)0;}
+static void m_glWindowPos2fv_null(const GLfloat*){return (void)0;}
+static void m_glWaitVkSemaphoreNV_null(GLuint64){return (void)0;}
+static void m_glDisablei_null(GLenum,GLuint){return (void)0;}
+static void m_glSelectPerfMonitorCountersAMD_null(GLuint,GLboolean,GLuint,GLint,GLuint*){return (void)0;}
+static void m_glGetVertexAttribLi64vNV_null(GLuint,GLenum,GLint64EXT*){return (void)0;}
+static void m_glBlendFuncSeparateiARB_null(GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glWeightuivARB_null(GLint,const GLuint*){return (void)0;}
+static void m_glWindowPos2iARB_null(GLint,GLint){return (void)0;}
+static void m_glGetProgramLocalParameterdvARB_null(GLenum,GLuint,GLdouble*){return (void)0;}
+static void m_glGetUniformui64vARB_null(GLuint,GLint,GLuint64*){return (void)0;}
+static void m_glSecondaryColor3us_null(GLushort,GLushort,GLushort){return (void)0;}
+static void m_glGetSynciv_null(GLsync,GLenum,GLsizei,GLsizei*,GLint*){return (void)0;}
+static void m_glMakeImageHandleResidentARB_null(GLuint64,GLenum){return (void)0;}
+static void m_glGetProgramNamedParameterfvNV_null(GLuint,GLsizei,const GLubyte*,GLfloat*){return (void)0;}
+static void m_glTextureStorage3D_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttrib4svNV_null(GLuint,const GLshort*){return (void)0;}
+static void m_glProgramUniform2i_null(GLuint,GLint,GLint,GLint){return (void)0;}
+static void m_glListDrawCommandsStatesClientNV_null(GLuint,GLuint,const void**,const GLsizei*,const GLuint*,const GLuint*,GLuint){return (void)0;}
+static void m_glProgramLocalParametersI4uivNV_null(GLenum,GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glBeginTransformFeedbackNV_null(GLenum){return (void)0;}
+static void m_glGetProgramBinary_null(GLuint,GLsizei,GLsizei*,GLenum*,void*){return (void)0;}
+static void m_glBinormal3iEXT_null(GLint,GLint,GLint){return (void)0;}
+static void m_glEvalPoint1_null(GLint){return (void)0;}
+static void m_glEvalPoint2_null(GLint,GLint){return (void)0;}
+static void m_glPauseTransformFeedback_null(){return (void)0;}
+static void m_glWindowPos2sMESA_null(GLshort,GLshort){return (void)0;}
+static void m_glGlobalAlphaFactorbSUN_null(GLbyte){return (void)0;}
+static void m_glCreateTransformFeedbacks_null(GLsizei,GLuint*){return (void)0;}
+static void m_glTexturePageCommitmentEXT_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glTransformFeedbackVaryingsNV_null(GLuint,GLsizei,const GLint*,GLenum){return (void)0;}
+static void m_glTexSubImage1D_null(GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const GLvoid*){return (void)0;}
+static void m_glConvolutionParameterfvEXT_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glBlitFramebufferEXT_null(GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLint,GLbitfield,GLenum){return (void)0;}
+static void m_glUniformMatrix4fvARB_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glProgramEnvParameter4dvARB_null(GLenum,GLuint,const GLdouble*){return (void)0;}
+static void m_glTextureStorageMem2DEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glVertexAttribP3uiv_null(GLuint,GLenum,GLboolean,const GLuint*){return (void)0;}
+static void m_glFogCoordFormatNV_null(GLenum,GLsizei){return (void)0;}
+static void m_glGetMultiTexLevelParameterivEXT_null(GLenum,GLenum,GLint,GLenum,GLint*){return (void)0;}
+static GLboolean m_glIsOcclusionQueryNV_null(GLuint){return (GLboolean)0;}
+static void m_glCompressedTexImage2DARB_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glGetProgramEnvParameterIuivNV_null(GLenum,GLuint,GLuint*){return (void)0;}
+static void m_glVertexAttrib4sv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glVertexAttrib4fvARB_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glLoadName_null(GLuint){return (void)0;}
+static void m_glBindVertexShaderEXT_null(GLuint){return (void)0;}
+static void m_glGetNamedProgramLocalParameterIivEXT_null(GLuint,GLenum,GLuint,GLint*){return (void)0;}
+static void m_glProgramUniform3uiEXT_null(GLuint,GLint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramUniformMatrix4x2dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glTexCoord1hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glLoadMatrixd_null(const GLdouble*){return (void)0;}
+static void m_glTexParameterfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glVariantdvEXT_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glCullParameterfvEXT_null(GLenum,GLfloat*){return (void)0;}
+static void m_glUniform3dv_null(GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glProgramUniform3fv_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static GLboolean m_glIsBufferARB_null(GLuint){return (GLboolean)0;}
+static void m_glMultiTexCoord1bOES_null(GLenum,GLbyte){return (void)0;}
+static void m_glFogCoordhNV_null(GLhalfNV){return (void)0;}
+static void m_glFramebufferSampleLocationsfvNV_null(GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static GLuint m_glGenSymbolsEXT_null(GLenum,GLenum,GLenum,GLuint){return (GLuint)0;}
+static void m_glGetConvolutionFilter_null(GLenum,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glProgramUniform1fvEXT_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glGetNextPerfQueryIdINTEL_null(GLuint,GLuint*){return (void)0;}
+static void m_glCompressedTexImage1DARB_null(GLenum,GLint,GLenum,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glBindSamplers_null(GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glGetProgramEnvParameterIivNV_null(GLenum,GLuint,GLint*){return (void)0;}
+static void m_glGetQueryObjectui64v_null(GLuint,GLenum,GLuint64*){return (void)0;}
+static void m_glVertexAttribL4ui64vNV_null(GLuint,const GLuint64EXT*){return (void)0;}
+static void m_glGetVideoivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetTextureImage_null(GLuint,GLint,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glProgramUniform1fv_null(GLuint,GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glUniformMatrix4fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glColorMask_null(GLboolean,GLboolean,GLboolean,GLboolean){return (void)0;}
+static void m_glBeginFragmentShaderATI_null(){return (void)0;}
+static void m_glMultiDrawArraysEXT_null(GLenum,const GLint*,const GLsizei*,GLsizei){return (void)0;}
+static void m_glGenNamesAMD_null(GLenum,GLuint,GLuint*){return (void)0;}
+static void m_glPathParameteriNV_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glCreateCommandListsNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glDeleteProgramPipelines_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glCopyColorSubTableEXT_null(GLenum,GLsizei,GLint,GLint,GLsizei){return (void)0;}
+static void m_glVariantsvEXT_null(GLuint,const GLshort*){return (void)0;}
+static void m_glGenProgramPipelines_null(GLsizei,GLuint*){return (void)0;}
+static void m_glVertexArrayEdgeFlagOffsetEXT_null(GLuint,GLuint,GLsizei,GLintptr){return (void)0;}
+static void m_glWindowPos2s_null(GLshort,GLshort){return (void)0;}
+static void m_glSecondaryColor3iEXT_null(GLint,GLint,GLint){return (void)0;}
+static void m_glWindowPos2i_null(GLint,GLint){return (void)0;}
+static void m_glWindowPos2f_null(GLfloat,GLfloat){return (void)0;}
+static void m_glWindowPos2d_null(GLdouble,GLdouble){return (void)0;}
+static void m_glUniform4uivEXT_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glOrthoxOES_null(GLfixed,GLfixed,GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glUniformSubroutinesuiv_null(GLenum,GLsizei,const GLuint*){return (void)0;}
+static void m_glRectdv_null(const GLdouble*,const GLdouble*){return (void)0;}
+static void m_glProgramUniform1i64vNV_null(GLuint,GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glVertexAttribI4uiEXT_null(GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glSecondaryColor3ubEXT_null(GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glCompressedMultiTexSubImage1DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glMultiTexGendEXT_null(GLenum,GLenum,GLenum,GLdouble){return (void)0;}
+static void m_glColorP3uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glFogCoordfv_null(const GLfloat*){return (void)0;}
+static void m_glCompileShader_null(GLuint){return (void)0;}
+static void m_glTexCoord2hNV_null(GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glUniform1uivEXT_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glMatrixLoadTransposedEXT_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glIndexfv_null(const GLfloat*){return (void)0;}
+static void m_glGetCompressedTextureImage_null(GLuint,GLint,GLsizei,void*){return (void)0;}
+static void m_glGetUniformuivEXT_null(GLuint,GLint,GLuint*){return (void)0;}
+static void m_glGetnPixelMapfvARB_null(GLenum,GLsizei,GLfloat*){return (void)0;}
+static void m_glFramebufferTextureEXT_null(GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glMultiDrawElementsIndirectCount_null(GLenum,GLenum,const void*,GLintptr,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttribIPointer_null(GLuint,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glMultiTexCoordP3ui_null(GLenum,GLenum,GLuint){return (void)0;}
+static void m_glEvaluateDepthValuesARB_null(){return (void)0;}
+static void m_glGetNamedBufferParameteriv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetNamedProgramLocalParameterfvEXT_null(GLuint,GLenum,GLuint,GLfloat*){return (void)0;}
+static void m_glColor4fNormal3fVertex3fvSUN_null(const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glSeparableFilter2DEXT_null(GLenum,GLenum,GLsizei,GLsizei,GLenum,GLenum,const void*,const void*){return (void)0;}
+static void m_glTexParameterxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glClearAccumxOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glInvalidateFramebuffer_null(GLenum,GLsizei,const GLenum*){return (void)0;}
+static void m_glWeightubvARB_null(GLint,const GLubyte*){return (void)0;}
+static void m_glVertexAttrib1d_null(GLuint,GLdouble){return (void)0;}
+static void m_glVertexAttrib1f_null(GLuint,GLfloat){return (void)0;}
+static void m_glVertex4fv_null(const GLfloat*){return (void)0;}
+static void m_glClearNamedFramebufferfi_null(GLuint,GLenum,GLint,GLfloat,GLint){return (void)0;}
+static void m_glGetQueryBufferObjectuiv_null(GLuint,GLuint,GLenum,GLintptr){return (void)0;}
+static void m_glClearNamedFramebufferfv_null(GLuint,GLenum,GLint,const GLfloat*){return (void)0;}
+static void m_glEndVertexShaderEXT_null(){return (void)0;}
+static void m_glVertexAttrib1s_null(GLuint,GLshort){return (void)0;}
+static void m_glMultiTexCoord4dvARB_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glMultiTexCoord1sv_null(GLenum,const GLshort*){return (void)0;}
+static void m_glUniform1ui64vNV_null(GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glGetClipPlanefOES_null(GLenum,GLfloat*){return (void)0;}
+static void m_glRasterPos2s_null(GLshort,GLshort){return (void)0;}
+static void m_glWeightivARB_null(GLint,const GLint*){return (void)0;}
+static void m_glMultiTexCoord4hvNV_null(GLenum,const GLhalfNV*){return (void)0;}
+static void m_glNormal3hNV_null(GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glGetSeparableFilter_null(GLenum,GLenum,GLenum,GLvoid*,GLvoid*,GLvoid*){return (void)0;}
+static void m_glGetPathTexGenivNV_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glColor4bv_null(const GLbyte*){return (void)0;}
+static void m_glRasterPos2f_null(GLfloat,GLfloat){return (void)0;}
+static void m_glNamedBufferPageCommitmentARB_null(GLuint,GLintptr,GLsizeiptr,GLboolean){return (void)0;}
+static void m_glLoadIdentity_null(){return (void)0;}
+static void m_glRasterPos2i_null(GLint,GLint){return (void)0;}
+static void m_glRasterPos4iv_null(const GLint*){return (void)0;}
+static void m_glMultiTexCoord2fvARB_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glUniformMatrix4x3fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glClearBufferfv_null(GLenum,GLint,const GLfloat*){return (void)0;}
+static void m_glMultiTexCoord4hNV_null(GLenum,GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glTextureBarrier_null(){return (void)0;}
+static void m_glReplacementCodeuivSUN_null(const GLuint*){return (void)0;}
+static void m_glDeleteAsyncMarkersSGIX_null(GLuint,GLsizei){return (void)0;}
+static void m_glTexCoord2bvOES_null(const GLbyte*){return (void)0;}
+static void m_glEvalCoord2xOES_null(GLfixed,GLfixed){return (void)0;}
+static void m_glGetSharpenTexFuncSGIS_null(GLenum,GLfloat*){return (void)0;}
+static void m_glProgramUniformHandleui64vNV_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glIglooInterfaceSGIX_null(GLenum,const void*){return (void)0;}
+static void m_glWindowPos2dvARB_null(const GLdouble*){return (void)0;}
+static void m_glClearBufferfi_null(GLenum,GLint,GLfloat,GLint){return (void)0;}
+static void m_glDrawArraysIndirect_null(GLenum,const void*){return (void)0;}
+static void m_glGenVertexArrays_null(GLsizei,GLuint*){return (void)0;}
+static void m_glGetTransformFeedbacki64_v_null(GLuint,GLenum,GLuint,GLint64*){return (void)0;}
+static void m_glEnableVertexArrayAttrib_null(GLuint,GLuint){return (void)0;}
+static void m_glProgramUniformMatrix3x2dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glVertexStream4fATI_null(GLenum,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glVertexBindingDivisor_null(GLuint,GLuint){return (void)0;}
+static void m_glGetSamplerParameterIiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetCoverageModulationTableNV_null(GLsizei,GLfloat*){return (void)0;}
+static void m_glDepthRangedNV_null(GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttrib3f_null(GLuint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glMultiDrawRangeElementArrayAPPLE_null(GLenum,GLuint,GLuint,const GLint*,const GLsizei*,GLsizei){return (void)0;}
+static void m_glVertexAttribFormatNV_null(GLuint,GLint,GLenum,GLboolean,GLsizei){return (void)0;}
+static void m_glGetQueryBufferObjecti64v_null(GLuint,GLuint,GLenum,GLintptr){return (void)0;}
+static void m_glGetVertexAttribdv_null(GLuint,GLenum,GLdouble*){return (void)0;}
+static void m_glGetUniformi64vARB_null(GLuint,GLint,GLint64*){return (void)0;}
+static GLboolean m_glAreTexturesResidentEXT_null(GLsizei,const GLuint*,GLboolean*){return (GLboolean)0;}
+static GLhandleARB m_glGetHandleARB_null(GLenum){return (GLhandleARB)0;}
+static void m_glVideoCaptureStreamParameterdvNV_null(GLuint,GLuint,GLenum,const GLdouble*){return (void)0;}
+static void m_glMapParameterivNV_null(GLenum,GLenum,const GLint*){return (void)0;}
+static GLboolean m_glIsVertexArray_null(GLuint){return (GLboolean)0;}
+static void m_glSecondaryColor3sEXT_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetTexParameterIivEXT_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glFrameTerminatorGREMEDY_null(){return (void)0;}
+static void m_glBlendBarrierKHR_null(){return (void)0;}
+static void m_glVertexAttrib4NubARB_null(GLuint,GLubyte,GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glPrimitiveRestartNV_null(){return (void)0;}
+static void m_glVertexAttribL1ui64vARB_null(GLuint,const GLuint64EXT*){return (void)0;}
+static void m_glVertexAttribI4ivEXT_null(GLuint,const GLint*){return (void)0;}
+static void m_glVertexAttribs4svNV_null(GLuint,GLsizei,const GLshort*){return (void)0;}
+static void m_glUniform1ui_null(GLint,GLuint){return (void)0;}
+static void m_glVertexAttrib2fvARB_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glVertexAttribI4svEXT_null(GLuint,const GLshort*){return (void)0;}
+static void m_glTextureImage3DMultisampleCoverageNV_null(GLuint,GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glMemoryBarrier_null(GLbitfield){return (void)0;}
+static void m_glGetVariantArrayObjectfvATI_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_null(const GLfloat*,const GLfloat*,const GLfloat*,const GLfloat*){return (void)0;}
+static GLboolean m_glIsProgramARB_null(GLuint){return (GLboolean)0;}
+static void m_glBindImageTextureEXT_null(GLuint,GLuint,GLint,GLboolean,GLint,GLenum,GLint){return (void)0;}
+static GLint m_glGetFragDataLocation_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glMultiTexCoord1svARB_null(GLenum,const GLshort*){return (void)0;}
+static void m_glGetMapxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glTextureStorage2DMultisampleEXT_null(GLuint,GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glGetMaterialfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glVertexAttrib4NbvARB_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glPixelMapuiv_null(GLenum,GLsizei,const GLuint*){return (void)0;}
+static void m_glColorPointerEXT_null(GLint,GLenum,GLsizei,GLsizei,const void*){return (void)0;}
+static void m_glEnableClientStateiEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glClearTexSubImage_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glEvalCoord1xvOES_null(const GLfixed*){return (void)0;}
+static void m_glDetachObjectARB_null(GLhandleARB,GLhandleARB){return (void)0;}
+static void m_glGetTextureParameterIiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVariantusvEXT_null(GLuint,const GLushort*){return (void)0;}
+static void m_glCompressedTextureImage3DEXT_null(GLuint,GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glMultiTexCoord1dARB_null(GLenum,GLdouble){return (void)0;}
+static void m_glGetVertexArrayIntegeri_vEXT_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glVertexAttribI4ubv_null(GLuint,const GLubyte*){return (void)0;}
+static void m_glPixelTexGenParameterfSGIS_null(GLenum,GLfloat){return (void)0;}
+static void m_glProgramUniformMatrix4x2dv_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glUniform3fARB_null(GLint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static GLboolean m_glIsShader_null(GLuint){return (GLboolean)0;}
+static void m_glConvolutionParameteriv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glCopyMultiTexSubImage2DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glEnableVertexAttribArrayARB_null(GLuint){return (void)0;}
+static void m_glMulticastCopyBufferSubDataNV_null(GLuint,GLbitfield,GLuint,GLuint,GLintptr,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glEnable_null(GLenum){return (void)0;}
+static void m_glGetActiveUniformsiv_null(GLuint,GLsizei,const GLuint*,GLenum,GLint*){return (void)0;}
+static void m_glGetVertexAttribivARB_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glTexCoord4hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glUseProgramObjectARB_null(GLhandleARB){return (void)0;}
+static GLint m_glGetAttribLocation_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glVertexAttrib4dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetTextureParameteriv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glNamedBufferStorageMemEXT_null(GLuint,GLsizeiptr,GLuint,GLuint64){return (void)0;}
+static void m_glPathSubCoordsNV_null(GLuint,GLsizei,GLsizei,GLenum,const void*){return (void)0;}
+static void m_glMatrixIndexusvARB_null(GLint,const GLushort*){return (void)0;}
+static void m_glGetVideouivNV_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glGetVideoCaptureivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glProgramUniform3ui_null(GLuint,GLint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glVertexAttrib3svARB_null(GLuint,const GLshort*){return (void)0;}
+static void m_glGetNamedBufferParameterivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glMatrixScaledEXT_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glProgramUniformMatrix2x3fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetFragmentLightivSGIX_null(GLenum,GLenum,GLint*){return (void)0;}
+static const GLubyte* m_glGetStringi_null(GLenum,GLuint){return (const GLubyte*)0;}
+static void m_glWindowPos2svARB_null(const GLshort*){return (void)0;}
+static void m_glVertexAttrib2svNV_null(GLuint,const GLshort*){return (void)0;}
+static void m_glWindowPos2ivARB_null(const GLint*){return (void)0;}
+static void m_glGetVertexAttribPointervNV_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glPushMatrix_null(){return (void)0;}
+static void m_glEdgeFlagPointerListIBM_null(GLint,const GLboolean**,GLint){return (void)0;}
+static void m_glGenerateMipmapEXT_null(GLenum){return (void)0;}
+static void m_glWindowPos3sv_null(const GLshort*){return (void)0;}
+static void m_glPathCoordsNV_null(GLuint,GLsizei,GLenum,const void*){return (void)0;}
+static void m_glProgramUniform1i_null(GLuint,GLint,GLint){return (void)0;}
+static void m_glProgramUniform1d_null(GLuint,GLint,GLdouble){return (void)0;}
+static void m_glProgramUniform1f_null(GLuint,GLint,GLfloat){return (void)0;}
+static void m_glProgramParameteriEXT_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glCompressedMultiTexImage2DEXT_null(GLenum,GLenum,GLint,GLenum,GLsizei,GLsizei,GLint,GLsizei,const void*){return (void)0;}
+static void m_glProgramUniform3iv_null(GLuint,GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glIndexiv_null(const GLint*){return (void)0;}
+static void m_glMultiTexCoord4xvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glEGLImageTargetTexture2DOES_null(GLenum,GLeglImageOES){return (void)0;}
+static void m_glPixelZoom_null(GLfloat,GLfloat){return (void)0;}
+static void m_glVertex3bvOES_null(const GLbyte*){return (void)0;}
+static void m_glFramebufferReadBufferEXT_null(GLuint,GLenum){return (void)0;}
+static void m_glExtractComponentEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glCombinerParameterivNV_null(GLenum,const GLint*){return (void)0;}
+static void m_glMinmax_null(GLenum,GLenum,GLboolean){return (void)0;}
+static void m_glColorP3ui_null(GLenum,GLuint){return (void)0;}
+static void m_glPointParameterfvSGIS_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glBlendEquationi_null(GLuint,GLenum){return (void)0;}
+static void m_glGetFogFuncSGIS_null(GLfloat*){return (void)0;}
+static void m_glVertexAttrib4fvNV_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glGetnMinmax_null(GLenum,GLboolean,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glFragmentLightiSGIX_null(GLenum,GLenum,GLint){return (void)0;}
+static void m_glMultiTexCoord1bvOES_null(GLenum,const GLbyte*){return (void)0;}
+static void m_glSecondaryColorPointerEXT_null(GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glMultiTexCoordP4uiv_null(GLenum,GLenum,const GLuint*){return (void)0;}
+static void m_glGetBufferSubDataARB_null(GLenum,GLintptrARB,GLsizeiptrARB,void*){return (void)0;}
+static void m_glSecondaryColor3hNV_null(GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glGetPathParameterivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glFlushRasterSGIX_null(){return (void)0;}
+static void m_glElementPointerATI_null(GLenum,const void*){return (void)0;}
+static void m_glGetAttachedObjectsARB_null(GLhandleARB,GLsizei,GLsizei*,GLhandleARB*){return (void)0;}
+static void m_glUniform4iv_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glFogxOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glSharpenTexFuncSGIS_null(GLenum,GLsizei,const GLfloat*){return (void)0;}
+static void m_glClearDepthfOES_null(GLclampf){return (void)0;}
+static void m_glDeleteCommandListsNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glSpecializeShader_null(GLuint,const GLchar*,GLuint,const GLuint*,const GLuint*){return (void)0;}
+static void m_glVertex4hNV_null(GLhalfNV,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glSecondaryColor3dvEXT_null(const GLdouble*){return (void)0;}
+static void m_glGenTextures_null(GLsizei,GLuint*){return (void)0;}
+static void m_glTextureStorage2DMultisample_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glUniform3ui64vNV_null(GLint,GLsizei,const GLuint64EXT*){return (void)0;}
+static void m_glBlendFuncSeparateIndexedAMD_null(GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glMakeBufferResidentNV_null(GLenum,GLenum){return (void)0;}
+static void m_glShaderOp2EXT_null(GLenum,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetVertexAttribivNV_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glTexParameterIivEXT_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glGetPerfQueryDataINTEL_null(GLuint,GLuint,GLsizei,GLvoid*,GLuint*){return (void)0;}
+static void m_glVertexAttrib4dvARB_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glTextureSubImage1DEXT_null(GLuint,GLenum,GLint,GLint,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGetActiveUniformBlockName_null(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glVertexAttrib2dvARB_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glVertexAttribPointer_null(GLuint,GLint,GLenum,GLboolean,GLsizei,const void*){return (void)0;}
+static void m_glDepthBoundsdNV_null(GLdouble,GLdouble){return (void)0;}
+static void m_glDeleteTexturesEXT_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glDrawBuffersATI_null(GLsizei,const GLenum*){return (void)0;}
+static void m_glLightModelxvOES_null(GLenum,const GLfixed*){return (void)0;}
+static void m_glApplyTextureEXT_null(GLenum){return (void)0;}
+static GLuint64 m_glGetImageHandleNV_null(GLuint,GLint,GLboolean,GLint,GLenum){return (GLuint64)0;}
+static void m_glGetMinmax_null(GLenum,GLboolean,GLenum,GLenum,GLvoid*){return (void)0;}
+static void m_glGetFixedvOES_null(GLenum,GLfixed*){return (void)0;}
+static void m_glSamplePatternEXT_null(GLenum){return (void)0;}
+static void m_glUniform1f_null(GLint,GLfloat){return (void)0;}
+static void m_glColor4fNormal3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glFogCoorddvEXT_null(const GLdouble*){return (void)0;}
+static void m_glCopyTextureImage1DEXT_null(GLuint,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLint){return (void)0;}
+static void m_glFlushMappedBufferRangeAPPLE_null(GLenum,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glVertex3sv_null(const GLshort*){return (void)0;}
+static void m_glFlushStaticDataIBM_null(GLenum){return (void)0;}
+static void m_glProgramUniform4ui64NV_null(GLuint,GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glRasterPos4xOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glVertexAttribP1ui_null(GLuint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glProgramUniform4dvEXT_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glEndTransformFeedbackEXT_null(){return (void)0;}
+static void m_glBinormal3dEXT_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetTextureSubImage_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,GLsizei,void*){return (void)0;}
+static void m_glGetNamedRenderbufferParameteriv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glBindBuffersRange_null(GLenum,GLuint,GLsizei,const GLuint*,const GLintptr*,const GLsizeiptr*){return (void)0;}
+static GLint m_glFinishAsyncSGIX_null(GLuint*){return (GLint)0;}
+static void m_glBindFragDataLocationIndexed_null(GLuint,GLuint,GLuint,const GLchar*){return (void)0;}
+static void m_glMultiTexCoord2dv_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glUniform2iv_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glProgramUniform2i64vNV_null(GLuint,GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glFlushVertexArrayRangeAPPLE_null(GLsizei,void*){return (void)0;}
+static void m_glTextureParameterf_null(GLuint,GLenum,GLfloat){return (void)0;}
+static void m_glMultiTexCoord3dvARB_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glFeedbackBuffer_null(GLsizei,GLenum,GLfloat*){return (void)0;}
+static void m_glDebugMessageInsertARB_null(GLenum,GLenum,GLuint,GLenum,GLsizei,const GLchar*){return (void)0;}
+static void m_glMultiTexCoord2i_null(GLenum,GLint,GLint){return (void)0;}
+static void m_glTextureSubImage3D_null(GLuint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glFramebufferTexture1D_null(GLenum,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glGetShaderiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glMultiTexCoord2d_null(GLenum,GLdouble,GLdouble){return (void)0;}
+static void m_glArrayObjectATI_null(GLenum,GLint,GLenum,GLsizei,GLuint,GLuint){return (void)0;}
+static void m_glGetPointeri_vEXT_null(GLenum,GLuint,void**){return (void)0;}
+static void m_glGetPerfMonitorCountersAMD_null(GLuint,GLint*,GLint*,GLsizei,GLuint*){return (void)0;}
+static void m_glNamedBufferStorage_null(GLuint,GLsizeiptr,const void*,GLbitfield){return (void)0;}
+static void m_glTexEnvxvOES_null(GLenum,GLenum,const GLfixed*){return (void)0;}
+static void m_glProgramUniform2ui64NV_null(GLuint,GLint,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glMultiTexCoord3bOES_null(GLenum,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glUniform1dv_null(GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glPixelTransferi_null(GLenum,GLint){return (void)0;}
+static void m_glSecondaryColor3usvEXT_null(const GLushort*){return (void)0;}
+static void m_glProgramEnvParameterI4uivNV_null(GLenum,GLuint,const GLuint*){return (void)0;}
+static void m_glVertex2sv_null(const GLshort*){return (void)0;}
+static void m_glWindowPos4dMESA_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glDebugMessageControlARB_null(GLenum,GLenum,GLenum,GLsizei,const GLuint*,GLboolean){return (void)0;}
+static GLboolean m_glIsTextureEXT_null(GLuint){return (GLboolean)0;}
+static void m_glFragmentMaterialivSGIX_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glLinkProgramARB_null(GLhandleARB){return (void)0;}
+static void m_glFinishFenceAPPLE_null(GLuint){return (void)0;}
+static void m_glVertexArrayVertexAttribBindingEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glTexStorageMem3DMultisampleEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean,GLuint,GLuint64){return (void)0;}
+static void m_glUniform1ui64vARB_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glMultiTexCoord4fv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glMulticastFramebufferSampleLocationsfvNV_null(GLuint,GLuint,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glRasterPos3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static GLint m_glPollAsyncSGIX_null(GLuint*){return (GLint)0;}
+static void m_glRasterPos3f_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glCompressedTexImage3D_null(GLenum,GLint,GLenum,GLsizei,GLsizei,GLsizei,GLint,GLsizei,const GLvoid*){return (void)0;}
+static void m_glVariantivEXT_null(GLuint,const GLint*){return (void)0;}
+static void m_glUnmapTexture2DINTEL_null(GLuint,GLint){return (void)0;}
+static void m_glMulticastWaitSyncNV_null(GLuint,GLbitfield){return (void)0;}
+static void m_glGetVertexAttribiv_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetPathCoordsNV_null(GLuint,GLfloat*){return (void)0;}
+static void m_glColor4xvOES_null(const GLfixed*){return (void)0;}
+static void m_glVertexAttrib3fv_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glRasterPos3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertex4bOES_null(GLbyte,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glTransformFeedbackVaryingsEXT_null(GLuint,GLsizei,const GLchar*const*,GLenum){return (void)0;}
+static void m_glCombinerOutputNV_null(GLenum,GLenum,GLenum,GLenum,GLenum,GLenum,GLenum,GLboolean,GLboolean,GLboolean){return (void)0;}
+static void m_glWindowPos4sMESA_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttrib4svARB_null(GLuint,const GLshort*){return (void)0;}
+static GLboolean m_glIsList_null(GLuint){return (GLboolean)0;}
+static void m_glGetInfoLogARB_null(GLhandleARB,GLsizei,GLsizei*,GLcharARB*){return (void)0;}
+static void m_glUniformMatrix2fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glVertexAttribs3dvNV_null(GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glGlobalAlphaFactorsSUN_null(GLshort){return (void)0;}
+static void m_glGetTrackMatrixivNV_null(GLenum,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glTextureParameterfvEXT_null(GLuint,GLenum,GLenum,const GLfloat*){return (void)0;}
+static GLboolean m_glIsNamedBufferResidentNV_null(GLuint){return (GLboolean)0;}
+static void m_glProgramUniform4ui64vARB_null(GLuint,GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glTbufferMask3DFX_null(GLuint){return (void)0;}
+static void m_glCoverFillPathNV_null(GLuint,GLenum){return (void)0;}
+static void m_glVertexAttrib1fvARB_null(GLuint,const GLfloat*){return (void)0;}
+static void m_glGenerateTextureMipmap_null(GLuint){return (void)0;}
+static void m_glNamedProgramLocalParameterI4uivEXT_null(GLuint,GLenum,GLuint,const GLuint*){return (void)0;}
+static void m_glMultiDrawElementsBaseVertex_null(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei,const GLint*){return (void)0;}
+static void m_glProgramSubroutineParametersuivNV_null(GLenum,GLsizei,const GLuint*){return (void)0;}
+static void m_glProgramUniformMatrix2x4dvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glRotatexOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glMemoryBarrierEXT_null(GLbitfield){return (void)0;}
+static void m_glVertexAttrib3svNV_null(GLuint,const GLshort*){return (void)0;}
+static void m_glVertexStream3iATI_null(GLenum,GLint,GLint,GLint){return (void)0;}
+static void m_glCompressedTexSubImage1D_null(GLenum,GLint,GLint,GLsizei,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glSetFenceNV_null(GLuint,GLenum){return (void)0;}
+static void m_glAttachObjectARB_null(GLhandleARB,GLhandleARB){return (void)0;}
+static void m_glCopyConvolutionFilter1D_null(GLenum,GLenum,GLint,GLint,GLsizei){return (void)0;}
+static void m_glTexStorageMem2DMultisampleEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean,GLuint,GLuint64){return (void)0;}
+static void m_glProgramParameters4fvNV_null(GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glNamedFramebufferParameteriEXT_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glVertexAttrib4Nsv_null(GLuint,const GLshort*){return (void)0;}
+static void m_glVertexAttribI4usvEXT_null(GLuint,const GLushort*){return (void)0;}
+static void m_glTextureBufferRangeEXT_null(GLuint,GLenum,GLenum,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glVertexP3uiv_null(GLenum,const GLuint*){return (void)0;}
+static GLboolean m_glIsPathNV_null(GLuint){return (GLboolean)0;}
+static void m_glGetnUniformi64vARB_null(GLuint,GLint,GLsizei,GLint64*){return (void)0;}
+static void m_glFramebufferTextureMultiviewOVR_null(GLenum,GLenum,GLuint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glCompressedMultiTexSubImage2DEXT_null(GLenum,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glGetnMapdv_null(GLenum,GLenum,GLsizei,GLdouble*){return (void)0;}
+static void m_glDebugMessageCallback_null(GLDEBUGPROC,const void*){return (void)0;}
+static void m_glTangent3svEXT_null(const GLshort*){return (void)0;}
+static void m_glVertexAttribParameteriAMD_null(GLuint,GLenum,GLint){return (void)0;}
+static void m_glBufferSubDataARB_null(GLenum,GLintptrARB,GLsizeiptrARB,const void*){return (void)0;}
+static void m_glGetVertexAttribLui64vARB_null(GLuint,GLenum,GLuint64EXT*){return (void)0;}
+static void m_glVertexAttribL4ui64NV_null(GLuint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glReplacementCodeuiColor4ubVertex3fSUN_null(GLuint,GLubyte,GLubyte,GLubyte,GLubyte,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glImageTransformParameterfHP_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glMap1f_null(GLenum,GLfloat,GLfloat,GLint,GLint,const GLfloat*){return (void)0;}
+static void m_glRasterPos4fv_null(const GLfloat*){return (void)0;}
+static void m_glVertex2bvOES_null(const GLbyte*){return (void)0;}
+static void m_glGetMapControlPointsNV_null(GLenum,GLuint,GLenum,GLsizei,GLsizei,GLboolean,void*){return (void)0;}
+static void m_glNamedProgramLocalParametersI4ivEXT_null(GLuint,GLenum,GLuint,GLsizei,const GLint*){return (void)0;}
+static void m_glBindBufferRangeNV_null(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glVertexStream3dvATI_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glNormalPointerListIBM_null(GLenum,GLint,const void**,GLint){return (void)0;}
+static void m_glFogFuncSGIS_null(GLsizei,const GLfloat*){return (void)0;}
+static void m_glMultiModeDrawArraysIBM_null(const GLenum*,const GLint*,const GLsizei*,GLsizei,GLint){return (void)0;}
+static void m_glGetNamedFramebufferAttachmentParameterivEXT_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetFloatv_null(GLenum,GLfloat*){return (void)0;}
+static void m_glVertexArrayVertexAttribIFormatEXT_null(GLuint,GLuint,GLint,GLenum,GLuint){return (void)0;}
+static void m_glHint_null(GLenum,GLenum){return (void)0;}
+static void m_glVertexStream2svATI_null(GLenum,const GLshort*){return (void)0;}
+static void m_glMultiDrawArraysIndirect_null(GLenum,const void*,GLsizei,GLsizei){return (void)0;}
+static void m_glMultiTexEnvfvEXT_null(GLenum,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glVertexAttribP2uiv_null(GLuint,GLenum,GLboolean,const GLuint*){return (void)0;}
+static void m_glProgramUniform1i64vARB_null(GLuint,GLint,GLsizei,const GLint64*){return (void)0;}
+static void m_glFramebufferTextureARB_null(GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void m_glPushClientAttribDefaultEXT_null(GLbitfield){return (void)0;}
+static void m_glScalef_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glScaled_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetConvolutionParameterxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glGetProgramResourceName_null(GLuint,GLenum,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glCopyColorTable_null(GLenum,GLenum,GLint,GLint,GLsizei){return (void)0;}
+static void m_glDepthRangeArrayv_null(GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glCoverFillPathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glMultiTexParameterivEXT_null(GLenum,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glGetActiveAtomicCounterBufferiv_null(GLuint,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glStencilOpSeparate_null(GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glVertexAttrib4fNV_null(GLuint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetColorTableParameterivSGI_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glVertexArrayAttribBinding_null(GLuint,GLuint,GLuint){return (void)0;}
+static GLboolean m_glIsSemaphoreEXT_null(GLuint){return (GLboolean)0;}
+static void m_glProgramParameters4dvNV_null(GLenum,GLuint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glVertexAttribL4dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glGetTexParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static GLintptr m_glGetUniformOffsetEXT_null(GLuint,GLint){return (GLintptr)0;}
+static void m_glGetVertexAttribPointerv_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glResumeTransformFeedbackNV_null(){return (void)0;}
+static void m_glProgramUniform3i64vNV_null(GLuint,GLint,GLsizei,const GLint64EXT*){return (void)0;}
+static void m_glTangent3fEXT_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetPathMetricRangeNV_null(GLbitfield,GLuint,GLsizei,GLsizei,GLfloat*){return (void)0;}
+static void m_glWindowPos2iMESA_null(GLint,GLint){return (void)0;}
+static void m_glVertex2xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGetnCompressedTexImage_null(GLenum,GLint,GLsizei,void*){return (void)0;}
+static void m_glWindowPos2dv_null(const GLdouble*){return (void)0;}
+static void m_glReplacementCodeuiVertex3fSUN_null(GLuint,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetTransformFeedbackVaryingEXT_null(GLuint,GLuint,GLsizei,GLsizei*,GLsizei*,GLenum*,GLchar*){return (void)0;}
+static void m_glWindowPos3fARB_null(GLfloat,GLfloat,GLfloat){return (void)0;}
+static void* m_glMapNamedBufferEXT_null(GLuint,GLenum){return (void*)0;}
+static void m_glDisable_null(GLenum){return (void)0;}
+static GLboolean m_glIsPointInFillPathNV_null(GLuint,GLuint,GLfloat,GLfloat){return (GLboolean)0;}
+static void m_glVertexAttribI2uiEXT_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glProgramUniform4uiv_null(GLuint,GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glQueryCounter_null(GLuint,GLenum){return (void)0;}
+static void m_glFramebufferRenderbufferEXT_null(GLenum,GLenum,GLenum,GLuint){return (void)0;}
+static void m_glBinormal3svEXT_null(const GLshort*){return (void)0;}
+static void m_glBindBufferOffsetNV_null(GLenum,GLuint,GLuint,GLintptr){return (void)0;}
+static void m_glCopyTextureSubImage2D_null(GLuint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glGetProgramResourcefvNV_null(GLuint,GLenum,GLuint,GLsizei,const GLenum*,GLsizei,GLsizei*,GLfloat*){return (void)0;}
+static void m_glBinormalPointerEXT_null(GLenum,GLsizei,const void*){return (void)0;}
+static void m_glGetLightfv_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glMulticastCopyImageSubDataNV_null(GLuint,GLbitfield,GLuint,GLenum,GLint,GLint,GLint,GLint,GLuint,GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei){return (void)0;}
+static void m_glVertex2bOES_null(GLbyte,GLbyte){return (void)0;}
+static void m_glUniform2ivARB_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glMultiTexCoord3s_null(GLenum,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetHistogramParameterfvEXT_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glGetProgramStringNV_null(GLuint,GLenum,GLubyte*){return (void)0;}
+static void m_glGetTexGenxvOES_null(GLenum,GLenum,GLfixed*){return (void)0;}
+static void m_glTextureSubImage2D_null(GLuint,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static GLenum m_glObjectPurgeableAPPLE_null(GLenum,GLuint,GLenum){return (GLenum)0;}
+static void m_glColorTableSGI_null(GLenum,GLenum,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glCopyConvolutionFilter2DEXT_null(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glMultiTexCoord3f_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glMultiTexCoord3d_null(GLenum,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glFogCoorddv_null(const GLdouble*){return (void)0;}
+static void m_glGetBufferPointerv_null(GLenum,GLenum,void**){return (void)0;}
+static void m_glProgramUniform1fEXT_null(GLuint,GLint,GLfloat){return (void)0;}
+static void m_glWindowPos2fvMESA_null(const GLfloat*){return (void)0;}
+static void m_glAlphaToCoverageDitherControlNV_null(GLenum){return (void)0;}
+static void m_glPolygonOffsetxOES_null(GLfixed,GLfixed){return (void)0;}
+static void m_glVertexAttrib4dARB_null(GLuint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glUniformHandleui64vARB_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glFragmentLightModelfvSGIX_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glSwizzleEXT_null(GLuint,GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glBindFragmentShaderATI_null(GLuint){return (void)0;}
+static void m_glVertexAttribs3hvNV_null(GLuint,GLsizei,const GLhalfNV*){return (void)0;}
+static void m_glGenBuffersARB_null(GLsizei,GLuint*){return (void)0;}
+static void m_glTextureStorageMem2DMultisampleEXT_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei,GLboolean,GLuint,GLuint64){return (void)0;}
+static void m_glListParameterfvSGIX_null(GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glNamedRenderbufferStorageMultisample_null(GLuint,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glVertexAttribI1iEXT_null(GLuint,GLint){return (void)0;}
+static void m_glMultiTexCoord2ivARB_null(GLenum,const GLint*){return (void)0;}
+static void m_glLightModelxOES_null(GLenum,GLfixed){return (void)0;}
+static void m_glColor3xOES_null(GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glReadBuffer_null(GLenum){return (void)0;}
+static void m_glStencilFillPathInstancedNV_null(GLsizei,GLenum,const void*,GLuint,GLenum,GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glVDPAUUnmapSurfacesNV_null(GLsizei,const GLvdpauSurfaceNV*){return (void)0;}
+static void m_glProgramUniform4i64NV_null(GLuint,GLint,GLint64EXT,GLint64EXT,GLint64EXT,GLint64EXT){return (void)0;}
+static void m_glVertexStream4dvATI_null(GLenum,const GLdouble*){return (void)0;}
+static GLboolean m_glIsQuery_null(GLuint){return (GLboolean)0;}
+static void m_glProgramUniformMatrix4fvEXT_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib3hNV_null(GLuint,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glFlushMappedNamedBufferRange_null(GLuint,GLintptr,GLsizeiptr){return (void)0;}
+static void m_glPushName_null(GLuint){return (void)0;}
+static void m_glGetClipPlane_null(GLenum,GLdouble*){return (void)0;}
+static void m_glVertex4dv_null(const GLdouble*){return (void)0;}
+static void m_glVertexAttrib3d_null(GLuint,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glBlendColor_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glBindTransformFeedbackNV_null(GLenum,GLuint){return (void)0;}
+static void m_glSamplerParameterIuiv_null(GLuint,GLenum,const GLuint*){return (void)0;}
+static void m_glIndexubv_null(const GLubyte*){return (void)0;}
+static void m_glNamedBufferPageCommitmentEXT_null(GLuint,GLintptr,GLsizeiptr,GLboolean){return (void)0;}
+static GLenum m_glCheckNamedFramebufferStatus_null(GLuint,GLenum){return (GLenum)0;}
+static void m_glGetObjectBufferfvATI_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glRasterPos4d_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glRasterPos4f_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGetPerfMonitorCounterStringAMD_null(GLuint,GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glVertexAttrib3s_null(GLuint,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glDrawElementsInstancedEXT_null(GLenum,GLsizei,GLenum,const void*,GLsizei){return (void)0;}
+static void m_glNamedProgramLocalParameterI4iEXT_null(GLuint,GLenum,GLuint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glRasterPos4s_null(GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetProgramStageiv_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetMaterialxOES_null(GLenum,GLenum,GLfixed){return (void)0;}
+static void m_glPopMatrix_null(){return (void)0;}
+static void m_glGetVideoui64vNV_null(GLuint,GLenum,GLuint64EXT*){return (void)0;}
+static void m_glTangent3bEXT_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static GLenum m_glGetGraphicsResetStatusARB_null(){return (GLenum)0;}
+static void m_glUniform4i_null(GLint,GLint,GLint,GLint,GLint){return (void)0;}
+static void m_glActiveTexture_null(GLenum){return (void)0;}
+static void m_glEnableVertexAttribArray_null(GLuint){return (void)0;}
+static void m_glTexCoord4fVertex4fvSUN_null(const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glUniform4d_null(GLint,GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glUniform4f_null(GLint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glRenderbufferStorageMultisample_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static void m_glCreateProgramPipelines_null(GLsizei,GLuint*){return (void)0;}
+static void m_glVertexAttribLPointer_null(GLuint,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glUniform2uiEXT_null(GLint,GLuint,GLuint){return (void)0;}
+static void m_glMultiTexCoord3sv_null(GLenum,const GLshort*){return (void)0;}
+static void m_glDrawElementsInstancedBaseVertex_null(GLenum,GLsizei,GLenum,const void*,GLsizei,GLint){return (void)0;}
+static void m_glPixelTransformParameterfvEXT_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glDrawTransformFeedbackNV_null(GLenum,GLuint){return (void)0;}
+static void m_glTextureImage2DMultisampleCoverageNV_null(GLuint,GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glNamedRenderbufferStorageMultisampleCoverageEXT_null(GLuint,GLsizei,GLsizei,GLenum,GLsizei,GLsizei){return (void)0;}
+static GLboolean m_glIsTexture_null(GLuint){return (GLboolean)0;}
+static void m_glMultiTexCoord4iv_null(GLenum,const GLint*){return (void)0;}
+static void m_glTexEnvfv_null(GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glPopDebugGroup_null(){return (void)0;}
+static void m_glUniformBlockBinding_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glWindowPos2svMESA_null(const GLshort*){return (void)0;}
+static void m_glGenerateTextureMipmapEXT_null(GLuint,GLenum){return (void)0;}
+static GLuint m_glBindLightParameterEXT_null(GLenum,GLenum){return (GLuint)0;}
+static void m_glTexCoord3bOES_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glTexCoordPointer_null(GLint,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glProgramUniformMatrix3x2fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glUniform2fvARB_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glProgramLocalParameterI4uivNV_null(GLenum,GLuint,const GLuint*){return (void)0;}
+static void m_glFlushVertexArrayRangeNV_null(){return (void)0;}
+static void m_glSecondaryColor3svEXT_null(const GLshort*){return (void)0;}
+static void m_glGetBufferParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glGetQueryIndexediv_null(GLenum,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glFramebufferTexture3DEXT_null(GLenum,GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glLoadTransposeMatrixxOES_null(const GLfixed*){return (void)0;}
+static void m_glDeleteTransformFeedbacksNV_null(GLsizei,const GLuint*){return (void)0;}
+static void m_glGetCompressedTextureImageEXT_null(GLuint,GLenum,GLint,void*){return (void)0;}
+static void m_glIndexMaterialEXT_null(GLenum,GLenum){return (void)0;}
+static void m_glFogCoorddEXT_null(GLdouble){return (void)0;}
+static void m_glTexCoord2hvNV_null(const GLhalfNV*){return (void)0;}
+static void m_glGetFramebufferParameterfvAMD_null(GLenum,GLenum,GLuint,GLuint,GLsizei,GLfloat*){return (void)0;}
+static void m_glTexEnviv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glEndTransformFeedbackNV_null(){return (void)0;}
+static void m_glGlobalAlphaFactoruiSUN_null(GLuint){return (void)0;}
+static void m_glSelectBuffer_null(GLsizei,GLuint*){return (void)0;}
+static void m_glNamedBufferSubDataEXT_null(GLuint,GLintptr,GLsizeiptr,const void*){return (void)0;}
+static void m_glDisableVertexArrayAttrib_null(GLuint,GLuint){return (void)0;}
+static void m_glBlendFunc_null(GLenum,GLenum){return (void)0;}
+static GLuint m_glCreateProgram_null(){return (GLuint)0;}
+static void m_glVertexStream2dATI_null(GLenum,GLdouble,GLdouble){return (void)0;}
+static void m_glUniform4ui64vARB_null(GLint,GLsizei,const GLuint64*){return (void)0;}
+static void m_glGetSemaphoreParameterui64vEXT_null(GLuint,GLenum,GLuint64*){return (void)0;}
+static void m_glPrimitiveRestartIndex_null(GLuint){return (void)0;}
+static void m_glNormalStream3fATI_null(GLenum,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glProgramUniformMatrix2fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glVertexAttribs1hvNV_null(GLuint,GLsizei,const GLhalfNV*){return (void)0;}
+static void m_glWindowPos4svMESA_null(const GLshort*){return (void)0;}
+static void m_glDeleteFragmentShaderATI_null(GLuint){return (void)0;}
+static void m_glBindImageTextures_null(GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glMap2xOES_null(GLenum,GLfixed,GLfixed,GLint,GLint,GLfixed,GLfixed,GLint,GLint,GLfixed){return (void)0;}
+static void m_glEnd_null(){return (void)0;}
+static void m_glMultiTexCoord2dARB_null(GLenum,GLdouble,GLdouble){return (void)0;}
+static void m_glUniform1i64NV_null(GLint,GLint64EXT){return (void)0;}
+static void m_glPathStringNV_null(GLuint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glGetNamedFramebufferParameterivEXT_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetProgramNamedParameterdvNV_null(GLuint,GLsizei,const GLubyte*,GLdouble*){return (void)0;}
+static void m_glPathDashArrayNV_null(GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glUniform3uiv_null(GLint,GLsizei,const GLuint*){return (void)0;}
+static void m_glColor3fVertex3fvSUN_null(const GLfloat*,const GLfloat*){return (void)0;}
+static void m_glMultTransposeMatrixd_null(const GLdouble*){return (void)0;}
+static void m_glClearColor_null(GLclampf,GLclampf,GLclampf,GLclampf){return (void)0;}
+static GLuint64 m_glGetImageHandleARB_null(GLuint,GLint,GLboolean,GLint,GLenum){return (GLuint64)0;}
+static void m_glTangent3dEXT_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glGetQueryObjectivARB_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glGetLocalConstantFloatvEXT_null(GLuint,GLenum,GLfloat*){return (void)0;}
+static void m_glUseShaderProgramEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glBindRenderbufferEXT_null(GLenum,GLuint){return (void)0;}
+static void m_glInterleavedArrays_null(GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glGetPerfMonitorGroupStringAMD_null(GLuint,GLsizei,GLsizei*,GLchar*){return (void)0;}
+static void m_glUniform3ui_null(GLint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glGetNamedProgramLocalParameterdvEXT_null(GLuint,GLenum,GLuint,GLdouble*){return (void)0;}
+static void m_glDeleteQueryResourceTagNV_null(GLsizei,const GLint*){return (void)0;}
+static void m_glVertexAttribI4uiv_null(GLuint,const GLuint*){return (void)0;}
+static void m_glVertexAttrib4bv_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glMultiTexCoord3xOES_null(GLenum,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glSecondaryColor3ub_null(GLubyte,GLubyte,GLubyte){return (void)0;}
+static void m_glFragmentMaterialfSGIX_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glGetVariantArrayObjectivATI_null(GLuint,GLenum,GLint*){return (void)0;}
+static void m_glSecondaryColor3ui_null(GLuint,GLuint,GLuint){return (void)0;}
+static void m_glVertexAttrib1dARB_null(GLuint,GLdouble){return (void)0;}
+static void m_glGetNamedBufferPointerv_null(GLuint,GLenum,void**){return (void)0;}
+static void m_glLockArraysEXT_null(GLint,GLsizei){return (void)0;}
+static void m_glVertexAttribPointerNV_null(GLuint,GLint,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glConvolutionParameterf_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glBindBufferBaseEXT_null(GLenum,GLuint,GLuint){return (void)0;}
+static void m_glTexCoord2xvOES_null(const GLfixed*){return (void)0;}
+static void m_glGetQueryBufferObjectui64v_null(GLuint,GLuint,GLenum,GLintptr){return (void)0;}
+static void m_glSetMultisamplefvAMD_null(GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glPathColorGenNV_null(GLenum,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glVertexAttrib3sARB_null(GLuint,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glVertexAttrib4ivARB_null(GLuint,const GLint*){return (void)0;}
+static void m_glGenTransformFeedbacks_null(GLsizei,GLuint*){return (void)0;}
+static void m_glGetVertexAttribIuiv_null(GLuint,GLenum,GLuint*){return (void)0;}
+static void m_glPixelTransformParameterfEXT_null(GLenum,GLenum,GLfloat){return (void)0;}
+static void m_glGetTexParameterIuivEXT_null(GLenum,GLenum,GLuint*){return (void)0;}
+static void m_glGetObjectParameterivARB_null(GLhandleARB,GLenum,GLint*){return (void)0;}
+static void m_glVertexArraySecondaryColorOffsetEXT_null(GLuint,GLuint,GLint,GLenum,GLsizei,GLintptr){return (void)0;}
+static void m_glWindowPos2fARB_null(GLfloat,GLfloat){return (void)0;}
+static void m_glCompressedTexSubImage2D_null(GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const GLvoid*){return (void)0;}
+static void m_glCompressedTexSubImage3DARB_null(GLenum,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glProgramBinary_null(GLuint,GLenum,const void*,GLsizei){return (void)0;}
+static void m_glPresentFrameKeyedNV_null(GLuint,GLuint64EXT,GLuint,GLuint,GLenum,GLenum,GLuint,GLuint,GLenum,GLuint,GLuint){return (void)0;}
+static void m_glVertexAttribI4bv_null(GLuint,const GLbyte*){return (void)0;}
+static void m_glPathCoverDepthFuncNV_null(GLenum){return (void)0;}
+static void m_glTransformFeedbackStreamAttribsNV_null(GLsizei,const GLint*,GLsizei,const GLint*,GLenum){return (void)0;}
+static void m_glSecondaryColor3usEXT_null(GLushort,GLushort,GLushort){return (void)0;}
+static void m_glCopyColorTableSGI_null(GLenum,GLenum,GLint,GLint,GLsizei){return (void)0;}
+static void m_glProgramEnvParameter4fvARB_null(GLenum,GLuint,const GLfloat*){return (void)0;}
+static void m_glMultiTexCoord4sARB_null(GLenum,GLshort,GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetVertexArrayIndexed64iv_null(GLuint,GLuint,GLenum,GLint64*){return (void)0;}
+static void m_glMatrixMultTranspose3x3fNV_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glTexParameterIiv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glVertexArrayAttribFormat_null(GLuint,GLuint,GLint,GLenum,GLboolean,GLuint){return (void)0;}
+static void m_glEndTransformFeedback_null(){return (void)0;}
+static void m_glDrawCommandsStatesAddressNV_null(const GLuint64*,const GLsizei*,const GLuint*,const GLuint*,GLuint){return (void)0;}
+static void m_glUniform4ui64NV_null(GLint,GLuint64EXT,GLuint64EXT,GLuint64EXT,GLuint64EXT){return (void)0;}
+static void m_glMaterialiv_null(GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glTexImage2DMultisample_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glBindTextureEXT_null(GLenum,GLuint){return (void)0;}
+static GLboolean m_glIsBuffer_null(GLuint){return (GLboolean)0;}
+static void m_glVertexAttribI1iv_null(GLuint,const GLint*){return (void)0;}
+static void m_glGetFinalCombinerInputParameterfvNV_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glMultiTexCoord3bvOES_null(GLenum,const GLbyte*){return (void)0;}
+static void m_glVertexAttribDivisor_null(GLuint,GLuint){return (void)0;}
+static void m_glCopyBufferSubData_null(GLenum,GLenum,GLintptr,GLintptr,GLsizeiptr){return (void)0;}
+static GLuint m_glBindTexGenParameterEXT_null(GLenum,GLenum,GLenum){return (GLuint)0;}
+static void m_glNormalStream3bATI_null(GLenum,GLbyte,GLbyte,GLbyte){return (void)0;}
+static void m_glTexStorageMem2DEXT_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLuint,GLuint64){return (void)0;}
+static void m_glTextureImage2DEXT_null(GLuint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGetColorTableParameteriv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glActiveTextureARB_null(GLenum){return (void)0;}
+static void m_glTexCoord4xOES_null(GLfixed,GLfixed,GLfixed,GLfixed){return (void)0;}
+static void m_glNamedBufferStorageExternalEXT_null(GLuint,GLintptr,GLsizeiptr,GLeglClientBufferEXT,GLbitfield){return (void)0;}
+static void m_glSecondaryColor3fvEXT_null(const GLfloat*){return (void)0;}
+static void m_glUniformMatrix4x2fv_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glStartInstrumentsSGIX_null(){return (void)0;}
+static void m_glProgramNamedParameter4fvNV_null(GLuint,GLsizei,const GLubyte*,const GLfloat*){return (void)0;}
+static void m_glEndVideoCaptureNV_null(GLuint){return (void)0;}
+static GLuint m_glGenLists_null(GLsizei){return (GLuint)0;}
+static void m_glUniform1fARB_null(GLint,GLfloat){return (void)0;}
+static void m_glNamedFramebufferTexture1DEXT_null(GLuint,GLenum,GLenum,GLuint,GLint){return (void)0;}
+static void* m_glMapBufferRange_null(GLenum,GLintptr,GLsizeiptr,GLbitfield){return (void*)0;}
+static void m_glMultiDrawElementsIndirectCountARB_null(GLenum,GLenum,const void*,GLintptr,GLsizei,GLsizei){return (void)0;}
+static void m_glProgramUniformMatrix4x2fv_null(GLuint,GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glGetTextureParameterIivEXT_null(GLuint,GLenum,GLenum,GLint*){return (void)0;}
+static void m_glMultiTexCoord3hNV_null(GLenum,GLhalfNV,GLhalfNV,GLhalfNV){return (void)0;}
+static void m_glNamedProgramLocalParametersI4uivEXT_null(GLuint,GLenum,GLuint,GLsizei,const GLuint*){return (void)0;}
+static void m_glEndList_null(){return (void)0;}
+static void m_glTexCoord2fColor4fNormal3fVertex3fSUN_null(GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glGenTransformFeedbacksNV_null(GLsizei,GLuint*){return (void)0;}
+static void m_glEdgeFlagv_null(const GLboolean*){return (void)0;}
+static void m_glVertexAttribI2iv_null(GLuint,const GLint*){return (void)0;}
+static void m_glCopyMultiTexImage2DEXT_null(GLenum,GLenum,GLint,GLenum,GLint,GLint,GLsizei,GLsizei,GLint){return (void)0;}
+static void m_glUniformMatrix3x2dv_null(GLint,GLsizei,GLboolean,const GLdouble*){return (void)0;}
+static void m_glTexImage3DMultisampleCoverageNV_null(GLenum,GLsizei,GLsizei,GLint,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static void m_glGetShaderPrecisionFormat_null(GLenum,GLenum,GLint*,GLint*){return (void)0;}
+static void m_glTexSubImage4DSGIS_null(GLenum,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLsizei,GLenum,GLenum,const void*){return (void)0;}
+static void m_glRasterSamplesEXT_null(GLuint,GLboolean){return (void)0;}
+static void m_glTextureView_null(GLuint,GLenum,GLuint,GLenum,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glEvalMapsNV_null(GLenum,GLenum){return (void)0;}
+static GLint m_glGetFragDataLocationEXT_null(GLuint,const GLchar*){return (GLint)0;}
+static void m_glGetCompressedMultiTexImageEXT_null(GLenum,GLenum,GLint,void*){return (void)0;}
+static void m_glIndexMask_null(GLuint){return (void)0;}
+static void m_glPushClientAttrib_null(GLbitfield){return (void)0;}
+static void m_glShaderSource_null(GLuint,GLsizei,const GLchar*const*,const GLint*){return (void)0;}
+static void m_glDispatchComputeGroupSizeARB_null(GLuint,GLuint,GLuint,GLuint,GLuint,GLuint){return (void)0;}
+static void m_glLGPUNamedBufferSubDataNVX_null(GLbitfield,GLuint,GLintptr,GLsizeiptr,const void*){return (void)0;}
+static void m_glGetnPixelMapfv_null(GLenum,GLsizei,GLfloat*){return (void)0;}
+static void m_glTexCoordP2uiv_null(GLenum,const GLuint*){return (void)0;}
+static void m_glUniform2f_null(GLint,GLfloat,GLfloat){return (void)0;}
+static void m_glGetNamedBufferParameteri64v_null(GLuint,GLenum,GLint64*){return (void)0;}
+static void m_glCommandListSegmentsNV_null(GLuint,GLuint){return (void)0;}
+static void m_glTextureParameterIivEXT_null(GLuint,GLenum,GLenum,const GLint*){return (void)0;}
+static void m_glMultiTexParameterfvEXT_null(GLenum,GLenum,GLenum,const GLfloat*){return (void)0;}
+static void m_glProgramUniform2ui64ARB_null(GLuint,GLint,GLuint64,GLuint64){return (void)0;}
+static void m_glVertex4d_null(GLdouble,GLdouble,GLdouble,GLdouble){return (void)0;}
+static GLuint m_glNewObjectBufferATI_null(GLsizei,const void*,GLenum){return (GLuint)0;}
+static void m_glViewportSwizzleNV_null(GLuint,GLenum,GLenum,GLenum,GLenum){return (void)0;}
+static void m_glBufferData_null(GLenum,GLsizeiptr,const void*,GLenum){return (void)0;}
+static void m_glTextureImage1DEXT_null(GLuint,GLenum,GLint,GLint,GLsizei,GLint,GLenum,GLenum,const void*){return (void)0;}
+static void m_glGetTexParameterIiv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glCopyTexSubImage1DEXT_null(GLenum,GLint,GLint,GLint,GLint,GLsizei){return (void)0;}
+static void m_glVertex4f_null(GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glUniformMatrix3fvARB_null(GLint,GLsizei,GLboolean,const GLfloat*){return (void)0;}
+static void m_glTexCoordP1ui_null(GLenum,GLuint){return (void)0;}
+static void m_glPointParameterfvEXT_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glUniform4fARB_null(GLint,GLfloat,GLfloat,GLfloat,GLfloat){return (void)0;}
+static void m_glImportMemoryFdEXT_null(GLuint,GLuint64,GLenum,GLint){return (void)0;}
+static void m_glCopyTextureSubImage3D_null(GLuint,GLint,GLint,GLint,GLint,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glMultiTexCoord2fv_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glNamedFramebufferSamplePositionsfvAMD_null(GLuint,GLuint,GLuint,const GLfloat*){return (void)0;}
+static void m_glNormalP3ui_null(GLenum,GLuint){return (void)0;}
+static void m_glDrawRangeElementArrayATI_null(GLenum,GLuint,GLuint,GLsizei){return (void)0;}
+static void m_glVertexAttribI1i_null(GLuint,GLint){return (void)0;}
+static void m_glDrawArraysInstancedARB_null(GLenum,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glEnableVertexAttribAPPLE_null(GLuint,GLenum){return (void)0;}
+static GLuint m_glGetDebugMessageLogARB_null(GLuint,GLsizei,GLenum*,GLenum*,GLuint*,GLenum*,GLsizei*,GLchar*){return (GLuint)0;}
+static void m_glGetPathTexGenfvNV_null(GLenum,GLenum,GLfloat*){return (void)0;}
+static void m_glNamedProgramLocalParameters4fvEXT_null(GLuint,GLenum,GLuint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glQueryResourceTagNV_null(GLint,const GLchar*){return (void)0;}
+static void m_glVertexStream3fvATI_null(GLenum,const GLfloat*){return (void)0;}
+static void m_glFramebufferTexture3D_null(GLenum,GLenum,GLenum,GLuint,GLint,GLint){return (void)0;}
+static void m_glCompressedTextureSubImage2DEXT_null(GLuint,GLenum,GLint,GLint,GLint,GLsizei,GLsizei,GLenum,GLsizei,const void*){return (void)0;}
+static void m_glWindowPos3dv_null(const GLdouble*){return (void)0;}
+static void m_glCopyConvolutionFilter2D_null(GLenum,GLenum,GLint,GLint,GLsizei,GLsizei){return (void)0;}
+static void m_glReadInstrumentsSGIX_null(GLint){return (void)0;}
+static void m_glProgramUniform2dvEXT_null(GLuint,GLint,GLsizei,const GLdouble*){return (void)0;}
+static void m_glSamplerParameterfv_null(GLuint,GLenum,const GLfloat*){return (void)0;}
+static void m_glBindBufferARB_null(GLenum,GLuint){return (void)0;}
+static void m_glVertexAttrib1sNV_null(GLuint,GLshort){return (void)0;}
+static void m_glGetMaterialiv_null(GLenum,GLenum,GLint*){return (void)0;}
+static void m_glUniform1fv_null(GLint,GLsizei,const GLfloat*){return (void)0;}
+static void m_glBeginOcclusionQueryNV_null(GLuint){return (void)0;}
+static void m_glGenFencesAPPLE_null(GLsizei,GLuint*){return (void)0;}
+static void m_glScissorIndexedv_null(GLuint,const GLint*){return (void)0;}
+static void m_glDisableVariantClientStateEXT_null(GLuint){return (void)0;}
+static void m_glMinmaxEXT_null(GLenum,GLenum,GLboolean){return (void)0;}
+static void m_glNormalPointervINTEL_null(GLenum,const void**){return (void)0;}
+static void m_glNormal3s_null(GLshort,GLshort,GLshort){return (void)0;}
+static void m_glGetnPixelMapuiv_null(GLenum,GLsizei,GLuint*){return (void)0;}
+static void m_glNormalStream3bvATI_null(GLenum,const GLbyte*){return (void)0;}
+static void m_glGetObjectParameterivAPPLE_null(GLenum,GLuint,GLenum,GLint*){return (void)0;}
+static void m_glNormal3i_null(GLint,GLint,GLint){return (void)0;}
+static void m_glUniform1ivARB_null(GLint,GLsizei,const GLint*){return (void)0;}
+static void m_glNormal3d_null(GLdouble,GLdouble,GLdouble){return (void)0;}
+static void m_glUpdateObjectBufferATI_null(GLuint,GLuint,GLsizei,const void*,GLenum){return (void)0;}
+static void m_glNormal3b_null(GLbyte,GLbyte,GLbyte){return (void)0;}
+static GLint m_glGetUniformBufferSizeEXT_null(GLuint,GLint){return (GLint)0;}
+static void m_glMultiTexCoord4dv_null(GLenum,const GLdouble*){return (void)0;}
+static void m_glProgramUniform3i64ARB_null(GLuint,GLint,GLint64,GLint64,GLint64){return (void)0;}
+static void m_glVertexAttrib2d_null(GLuint,GLdouble,GLdouble){return (void)0;}
+static void m_glVertexAttrib2f_null(GLuint,GLfloat,GLfloat){return (void)0;}
+static void m_glMultiDrawElementsEXT_null(GLenum,const GLsizei*,GLenum,const void*const*,GLsizei){return (void)0;}
+static void m_glVertexAttrib3dv_null(GLuint,const GLdouble*){return (void)0;}
+static void m_glMultiTexCoord2bOES_null(GLenum,GLbyte,GLbyte){return (void)0;}
+static void m_glVertexAttrib2s_null(GLuint,GLshort,GLshort){return (void)0;}
+static void m_glTexImage3DMultisample_null(GLenum,GLsizei,GLenum,GLsizei,GLsizei,GLsizei,GLboolean){return (void)0;}
+static GLuint m_glGetUniformBlockIndex_null(GLuint,const GLchar*){return (GLuint)0;}
+static GLboolean m_glReleaseKeyedMutexWin32EXT_null(GLuint,GLuint64){return (GLboolean)0;}
+static void m_glFrontFace_null(GLenum){return (void)0;}
+static void m_glEvalCoord1xOES_null(GLfixed){return (void)0;}
+static void m_glDrawArraysInstancedBaseInstance_null(GLenum,GLint,GLsizei,GLsizei,GLuint){return (void)0;}
+static GLboolean m_glIsPointInStrokePathNV_null(GLuint,GLfloat,GLfloat){return (GLboolean)0;}
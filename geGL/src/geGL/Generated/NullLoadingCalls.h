@@ -0,0 +1,5856 @@
+char const* functionNames[] = {
+  "glMultiDrawArraysIndirectBindlessCountNV",
+  "glTextureParameterfv",
+  "glGetListParameterivSGIX",
+  "glProgramUniform1i64ARB",
+  "glVertexArrayElementBuffer",
+  "glHintPGI",
+  "glStencilMaskSeparate",
+  "glGetFramebufferAttachmentParameterivEXT",
+  "glTextureStorage3DMultisample",
+  "glGetIntegerIndexedvEXT",
+  "glCopyTexImage1D",
+  "glVertexAttrib4usv",
+  "glTexRenderbufferNV",
+  "glVertexAttrib3hvNV",
+  "glProgramUniform4ui64ARB",
+  "glInstrumentsBufferSGIX",
+  "glIndexi",
+  "glMultiTexCoord2sARB",
+  "glProgramEnvParameter4fARB",
+  "glCompressedTexSubImage3D",
+  "glEvalCoord2d",
+  "glEvalCoord2f",
+  "glIndexd",
+  "glSecondaryColor3hvNV",
+  "glIndexf",
+  "glFrustumxOES",
+  "glTextureStorage3DEXT",
+  "glDrawCommandsStatesNV",
+  "glUniform4uiEXT",
+  "glProgramUniform3ui64ARB",
+  "glIndexs",
+  "glVertexArrayBindVertexBufferEXT",
+  "glConvolutionParameteriEXT",
+  "glColor4ubVertex2fSUN",
+  "glProgramUniform1ivEXT",
+  "glGetnMapfv",
+  "glTransformFeedbackBufferRange",
+  "glPathGlyphsNV",
+  "glSecondaryColor3fv",
+  "glGetCombinerInputParameterivNV",
+  "glEndPerfMonitorAMD",
+  "glPointParameterfvARB",
+  "glVertex2xOES",
+  "glDrawElementsInstancedBaseInstance",
+  "glMultTransposeMatrixdARB",
+  "glVertexAttribL4dEXT",
+  "glVertex4iv",
+  "glCoverStrokePathInstancedNV",
+  "glDeformSGIX",
+  "glUniform2ui64NV",
+  "glCopyPathNV",
+  "glVertexAttribP4ui",
+  "glVertexAttribL2d",
+  "glGetMultisamplefv",
+  "glCompressedMultiTexSubImage3DEXT",
+  "glVDPAURegisterOutputSurfaceNV",
+  "glMinSampleShading",
+  "glProgramUniform4fEXT",
+  "glCoverStrokePathNV",
+  "glTextureImage2DMultisampleNV",
+  "glVertex3bOES",
+  "glImportMemoryWin32HandleEXT",
+  "glTessellationFactorAMD",
+  "glDebugMessageControl",
+  "glIsObjectBufferATI",
+  "glPopAttrib",
+  "glProgramUniform4iEXT",
+  "glVertexAttrib4ubNV",
+  "glColorMaterial",
+  "glVertexAttrib2svARB",
+  "glMinSampleShadingARB",
+  "glColor3b",
+  "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",
+  "glColor3f",
+  "glVDPAUGetSurfaceivNV",
+  "glColor3d",
+  "glGetnMapiv",
+  "glColor3i",
+  "glGetInternalformatSampleivNV",
+  "glVertexAttrib4ubv",
+  "glColor3s",
+  "glVertexAttribs4hvNV",
+  "glVertexAttrib4NubvARB",
+  "glMultiTexCoord3hvNV",
+  "glMatrixPushEXT",
+  "glProgramUniform2fEXT",
+  "glGetVertexArrayIndexediv",
+  "glBlitFramebuffer",
+  "glMultiTexCoordP2ui",
+  "glColorPointerListIBM",
+  "glVertexAttribL4d",
+  "glGetFragmentMaterialfvSGIX",
+  "glVertex2iv",
+  "glGetTexEnvxvOES",
+  "glUniformMatrix3dv",
+  "glGetVertexAttribLdvEXT",
+  "glTexCoordP3uiv",
+  "glDeformationMap3dSGIX",
+  "glResumeTransformFeedback",
+  "glInsertEventMarkerEXT",
+  "glTessellationModeAMD",
+  "glDrawCommandsAddressNV",
+  "glFogi",
+  "glGetTexParameterxvOES",
+  "glVertexPointer",
+  "glGetPerfMonitorCounterDataAMD",
+  "glFogf",
+  "glMultiTexCoord1d",
+  "glMultiTexCoord1f",
+  "glGetMultiTexParameterivEXT",
+  "glProgramUniformMatrix3x4fvEXT",
+  "glVertexAttribI2i",
+  "glMultiTexCoord1i",
+  "glDeleteSemaphoresEXT",
+  "glLoadProgramNV",
+  "glWriteMaskEXT",
+  "glGetGraphicsResetStatus",
+  "glVertexAttrib1fv",
+  "glMultiTexCoord1s",
+  "glImageTransformParameterfvHP",
+  "glFramebufferTexture2D",
+  "glGetFragmentLightfvSGIX",
+  "glListParameterfSGIX",
+  "glTexCoord3sv",
+  "glNamedFramebufferRenderbufferEXT",
+  "glFragmentLightModelfSGIX",
+  "glIndexPointerEXT",
+  "glBlendEquationSeparateATI",
+  "glVertexArrayAttribIFormat",
+  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",
+  "glReplacementCodeubvSUN",
+  "glGenFramebuffers",
+  "glPixelMapx",
+  "glTexSubImage3DEXT",
+  "glGetAttachedShaders",
+  "glGetPixelTexGenParameterfvSGIS",
+  "glReplacementCodeuiNormal3fVertex3fSUN",
+  "glGetDebugMessageLogAMD",
+  "glVertexStream4sATI",
+  "glVertexAttribs4dvNV",
+  "glGetnMapdvARB",
+  "glOrthofOES",
+  "glViewportArrayv",
+  "glDrawElementArrayATI",
+  "glBufferStorageMemEXT",
+  "glGetPathColorGenfvNV",
+  "glWindowPos3iMESA",
+  "glMultiTexCoord2s",
+  "glVertex3dv",
+  "glVertexAttribI3uivEXT",
+  "glUniform3ui64ARB",
+  "glVertexAttrib2fvNV",
+  "glGetNamedBufferSubDataEXT",
+  "glConvolutionFilter2D",
+  "glMemoryBarrierByRegion",
+  "glVertexArrayBindingDivisor",
+  "glMatrixRotatedEXT",
+  "glTexCoord2sv",
+  "glIsProgramNV",
+  "glUniform2dv",
+  "glGetPixelMapuiv",
+  "glDepthBoundsEXT",
+  "glVertexAttrib4hvNV",
+  "glMultiTexParameteriEXT",
+  "glGetPointerv",
+  "glPathCommandsNV",
+  "glGetListParameterfvSGIX",
+  "glGetUniformuiv",
+  "glDebugMessageInsertAMD",
+  "glFrustum",
+  "glVertexAttribL1ui64vNV",
+  "glClearColorxOES",
+  "glProgramUniformMatrix3fv",
+  "glSampleMaskIndexedNV",
+  "glCompileShaderIncludeARB",
+  "glGetArrayObjectfvATI",
+  "glVertexStream4svATI",
+  "glMultiTexCoord4iARB",
+  "glVariantfvEXT",
+  "glMatrixLoadfEXT",
+  "glLoadIdentityDeformationMapSGIX",
+  "glGetRenderbufferParameteriv",
+  "glProgramUniform3fEXT",
+  "glNamedRenderbufferStorage",
+  "glBindFragDataLocation",
+  "glPolygonOffsetClamp",
+  "glFogCoordPointerListIBM",
+  "glFenceSync",
+  "glGetVertexAttribIivEXT",
+  "glFramebufferDrawBuffersEXT",
+  "glVertexAttribs4fvNV",
+  "glPauseTransformFeedbackNV",
+  "glGetQueryObjecti64vEXT",
+  "glVDPAUSurfaceAccessNV",
+  "glValidateProgramPipeline",
+  "glTexPageCommitmentARB",
+  "glWindowPos3dvARB",
+  "glStencilStrokePathInstancedNV",
+  "glFogfv",
+  "glGenQueriesARB",
+  "glProgramUniform2i64NV",
+  "glVertexP4ui",
+  "glVertexStream1ivATI",
+  "glProgramEnvParameterI4iNV",
+  "glGenVertexArraysAPPLE",
+  "glDrawTransformFeedbackInstanced",
+  "glStencilThenCoverStrokePathNV",
+  "glDeleteVertexArraysAPPLE",
+  "glGetNamedBufferParameterui64vNV",
+  "glQueryMatrixxOES",
+  "glSecondaryColor3usv",
+  "glTranslatexOES",
+  "glDrawTransformFeedback",
+  "glTexCoord2fColor4fNormal3fVertex3fvSUN",
+  "glVDPAURegisterVideoSurfaceNV",
+  "glGetTexParameterIuiv",
+  "glBindBufferBaseNV",
+  "glIndexPointer",
+  "glGenQueryResourceTagNV",
+  "glVertexAttrib4Nbv",
+  "glListParameteriSGIX",
+  "glBlendColorxOES",
+  "glUniformui64vNV",
+  "glIsSync",
+  "glGetTextureParameterivEXT",
+  "glFogCoordhvNV",
+  "glFramebufferTextureLayerEXT",
+  "glGetObjectPtrLabel",
+  "glTextureParameteri",
+  "glMultiTexCoord1fARB",
+  "glUniformMatrix2x3dv",
+  "glFramebufferDrawBufferEXT",
+  "glCopyColorSubTable",
+  "glGetNamedFramebufferParameterfvAMD",
+  "glVertexAttribL3d",
+  "glFragmentMaterialfvSGIX",
+  "glMatrixLoadTranspose3x3fNV",
+  "glDeleteNamesAMD",
+  "glDrawRangeElementsEXT",
+  "glOrtho",
+  "glProgramUniform1dvEXT",
+  "glColor4xOES",
+  "glTexImage4DSGIS",
+  "glProgramUniform1ui",
+  "glDeleteBuffersARB",
+  "glUnmapBufferARB",
+  "glCopyTexImage2D",
+  "glMaterialxOES",
+  "glProgramUniformMatrix2x4fvEXT",
+  "glTestObjectAPPLE",
+  "glRenderbufferStorageEXT",
+  "glVertexAttribL1ui64ARB",
+  "glEndFragmentShaderATI",
+  "glPathParameterivNV",
+  "glUniform4uiv",
+  "glFrameZoomSGIX",
+  "glSecondaryColor3fEXT",
+  "glLGPUInterlockNVX",
+  "glVertexAttribL1dv",
+  "glNormalStream3svATI",
+  "glPathStencilFuncNV",
+  "glSetInvariantEXT",
+  "glGetTexBumpParameterivATI",
+  "glBlendEquationSeparateEXT",
+  "glEndOcclusionQueryNV",
+  "glScissorArrayv",
+  "glCallList",
+  "glMapTexture2DINTEL",
+  "glGetVkProcAddrNV",
+  "glPixelTransferxOES",
+  "glDeleteRenderbuffersEXT",
+  "glTexCoord4fColor4fNormal3fVertex4fSUN",
+  "glProgramUniformMatrix4dvEXT",
+  "glGetnColorTable",
+  "glFramebufferTextureLayerARB",
+  "glVertexAttribL2dvEXT",
+  "glGetCombinerStageParameterfvNV",
+  "glMultiTexCoord1xvOES",
+  "glMapBuffer",
+  "glSecondaryColor3d",
+  "glSecondaryColor3f",
+  "glVertexAttribLFormat",
+  "glElementPointerAPPLE",
+  "glVertexStream1fATI",
+  "glCoverageModulationNV",
+  "glSecondaryColor3i",
+  "glDeleteSync",
+  "glGetProgramParameterfvNV",
+  "glMaxShaderCompilerThreadsARB",
+  "glUniformMatrix4x2dv",
+  "glVertexArrayVertexAttribLOffsetEXT",
+  "glSecondaryColor3s",
+  "glIsImageHandleResidentNV",
+  "glUniform3iv",
+  "glVertexAttribL3i64vNV",
+  "glPolygonMode",
+  "glFramebufferSamplePositionsfvAMD",
+  "glConvolutionFilter1DEXT",
+  "glVertexAttrib1dvARB",
+  "glTextureSubImage2DEXT",
+  "glIsVertexArrayAPPLE",
+  "glUseProgram",
+  "glLineStipple",
+  "glMultiTexCoord4fvARB",
+  "glVideoCaptureNV",
+  "glVertexArrayVertexAttribLFormatEXT",
+  "glUniform3fvARB",
+  "glProgramUniformMatrix3x2fvEXT",
+  "glCopyTextureSubImage3DEXT",
+  "glMultiTexCoord2bvOES",
+  "glDeleteObjectARB",
+  "glTextureLightEXT",
+  "glRasterPos3i",
+  "glMultiTexCoord3dARB",
+  "glNamedFramebufferTextureEXT",
+  "glTextureParameteriEXT",
+  "glEvalCoord2xvOES",
+  "glBindVideoCaptureStreamBufferNV",
+  "glTexImage2DMultisampleCoverageNV",
+  "glGetAttribLocationARB",
+  "glDeleteShader",
+  "glVertexAttrib1fARB",
+  "glTexCoord2fColor4ubVertex3fSUN",
+  "glTexCoord4fVertex4fSUN",
+  "glGetMapdv",
+  "glMapParameterfvNV",
+  "glTextureParameterIuiv",
+  "glTransformFeedbackAttribsNV",
+  "glFragmentLightfvSGIX",
+  "glWindowPos3sARB",
+  "glGetConvolutionParameterfv",
+  "glCopyTexSubImage3D",
+  "glVertexAttribI3i",
+  "glCreateShaderObjectARB",
+  "glVertexAttribFormat",
+  "glGetProgramivARB",
+  "glVertexAttribI4usv",
+  "glTexParameterf",
+  "glVertexAttribBinding",
+  "glGetHistogramParameteriv",
+  "glTexParameteri",
+  "glGetShaderSource",
+  "glVertexAttrib4s",
+  "glVertexAttrib4dvNV",
+  "glVertexAttrib1dvNV",
+  "glPopName",
+  "glTextureBufferEXT",
+  "glGetMultiTexImageEXT",
+  "glGetPointerIndexedvEXT",
+  "glIsNameAMD",
+  "glColor4ub",
+  "glBufferParameteriAPPLE",
+  "glColor4ui",
+  "glGetInternalformativ",
+  "glColor4us",
+  "glVertexAttribP1uiv",
+  "glLinkProgram",
+  "glTexCoord3s",
+  "glTexCoord2dv",
+  "glGetObjectLabel",
+  "glVertexPointerEXT",
+  "glDebugMessageCallbackARB",
+  "glGetString",
+  "glGetPathParameterfvNV",
+  "glLightxvOES",
+  "glEndQuery",
+  "glSecondaryColor3uiv",
+  "glPrioritizeTexturesxOES",
+  "glEdgeFlagPointer",
+  "glFramebufferParameteri",
+  "glTexCoord3hNV",
+  "glMultiModeDrawElementsIBM",
+  "glCopyPixels",
+  "glVertexAttribI2ui",
+  "glClampColorARB",
+  "glColorPointervINTEL",
+  "glDeleteTextures",
+  "glGetMinmaxParameterfvEXT",
+  "glWindowPos3sMESA",
+  "glVertexAttrib4f",
+  "glNamedFramebufferParameteri",
+  "glTexCoord2fVertex3fvSUN",
+  "glReplacementCodeusSUN",
+  "glGetNamedFramebufferParameteriv",
+  "glVertexStream1fvATI",
+  "glCreateVertexArrays",
+  "glBeginConditionalRender",
+  "glGetUnsignedBytevEXT",
+  "glConvolutionFilter1D",
+  "glMultiTexCoord3fARB",
+  "glGetQueryObjectuivARB",
+  "glScalexOES",
+  "glSamplerParameteri",
+  "glSamplerParameterf",
+  "glShaderOp1EXT",
+  "glBeginVideoCaptureNV",
+  "glGetnHistogram",
+  "glUniform1d",
+  "glRenderMode",
+  "glClearColorIiEXT",
+  "glSignalSemaphoreEXT",
+  "glGetCompressedTexImage",
+  "glCompressedTextureImage1DEXT",
+  "glGetActiveUniformBlockiv",
+  "glUniform1i",
+  "glMultiDrawArraysIndirectCount",
+  "glGetTexEnvfv",
+  "glColorTableParameterivSGI",
+  "glCullFace",
+  "glDeleteFencesAPPLE",
+  "glProgramUniform4i",
+  "glUniformHandleui64ARB",
+  "glProgramUniform4f",
+  "glViewportIndexedf",
+  "glProgramUniform4d",
+  "glTexCoord1xOES",
+  "glVertexStream3ivATI",
+  "glPointAlongPathNV",
+  "glEndQueryARB",
+  "glVDPAUMapSurfacesNV",
+  "glVertex3i",
+  "glVertexAttrib4uivARB",
+  "glTextureStorageMem3DEXT",
+  "glAttachShader",
+  "glColor4hNV",
+  "glGetFenceivNV",
+  "glTexCoord2fColor4ubVertex3fvSUN",
+  "glGetColorTable",
+  "glFogCoordPointer",
+  "glTexStorageSparseAMD",
+  "glUnmapNamedBuffer",
+  "glTexCoord4bvOES",
+  "glVertexAttrib3fARB",
+  "glRasterPos2xOES",
+  "glCreateMemoryObjectsEXT",
+  "glColor4ubVertex2fvSUN",
+  "glSecondaryColor3dv",
+  "glVertexAttribI4sv",
+  "glDrawTransformFeedbackStreamInstanced",
+  "glMultiTexCoord4ivARB",
+  "glSpriteParameterfSGIX",
+  "glSecondaryColor3sv",
+  "glBindVideoCaptureStreamTextureNV",
+  "glTexParameterIuiv",
+  "glFlushPixelDataRangeNV",
+  "glWindowPos3fv",
+  "glVertexAttribLFormatNV",
+  "glLightModelfv",
+  "glGetColorTableSGI",
+  "glGetCompressedTexImageARB",
+  "glConvolutionParameteri",
+  "glVertexWeighthNV",
+  "glColorMaskIndexedEXT",
+  "glColorMaski",
+  "glColorFragmentOp1ATI",
+  "glVertexAttribI4ubvEXT",
+  "glVertexAttrib1dNV",
+  "glUnmapObjectBufferATI",
+  "glNamedProgramLocalParameterI4uiEXT",
+  "glProgramUniform1iEXT",
+  "glDeleteQueriesARB",
+  "glWindowPos3svARB",
+  "glVertex4s",
+  "glImportMemoryWin32NameEXT",
+  "glStringMarkerGREMEDY",
+  "glIsTransformFeedback",
+  "glProgramUniformMatrix2x3dvEXT",
+  "glGetObjectLabelEXT",
+  "glUniformHandleui64vNV",
+  "glRotated",
+  "glIsProgramPipeline",
+  "glRotatef",
+  "glVertex4i",
+  "glGetActiveSubroutineUniformName",
+  "glVertexAttrib4sNV",
+  "glProgramLocalParameter4dvARB",
+  "glReplacementCodeubSUN",
+  "glMultiDrawElementsIndirectBindlessNV",
+  "glImportSemaphoreWin32HandleEXT",
+  "glUniformMatrix3fv",
+  "glGetnMapfvARB",
+  "glGetnUniformfv",
+  "glVertexAttribL2dv",
+  "glVertexWeightPointerEXT",
+  "glTangent3sEXT",
+  "glSecondaryColorPointer",
+  "glAlphaFunc",
+  "glGetNamedStringARB",
+  "glTexCoord4d",
+  "glBufferPageCommitmentARB",
+  "glProgramLocalParameters4fvEXT",
+  "glStencilFunc",
+  "glSemaphoreParameterui64vEXT",
+  "glGetVertexAttribdvNV",
+  "glTexCoord3dv",
+  "glGetQueryBufferObjectiv",
+  "glTexGenxOES",
+  "glMultiTexCoord1fvARB",
+  "glLightEnviSGIX",
+  "glGetProgramPipelineiv",
+  "glVertexStream2ivATI",
+  "glGetColorTableEXT",
+  "glGetShaderInfoLog",
+  "glGetOcclusionQueryuivNV",
+  "glInvalidateNamedFramebufferSubData",
+  "glVertexAttribL1i64NV",
+  "glVDPAUInitNV",
+  "glVertexAttrib1hvNV",
+  "glVertexAttribI4i",
+  "glRasterPos2iv",
+  "glGetIntegerui64i_vNV",
+  "glUniformHandleui64NV",
+  "glWindowPos3ivMESA",
+  "glBlendEquationSeparate",
+  "glDrawElementsInstancedARB",
+  "glGetSubroutineIndex",
+  "glVertexAttrib2sv",
+  "glSamplePatternSGIS",
+  "glEGLImageTargetRenderbufferStorageOES",
+  "glPushAttrib",
+  "glVertex3hNV",
+  "glRasterPos3xvOES",
+  "glPathParameterfNV",
+  "glGetUniformi64vNV",
+  "glLightiv",
+  "glMaterialxvOES",
+  "glNamedProgramLocalParameter4fEXT",
+  "glVertexAttribL1dEXT",
+  "glGetnUniformdvARB",
+  "glSecondaryColor3bEXT",
+  "glBeginPerfQueryINTEL",
+  "glProgramUniform1uivEXT",
+  "glImageTransformParameterivHP",
+  "glDeleteBuffers",
+  "glBindProgramPipeline",
+  "glScissor",
+  "glProgramUniform4fv",
+  "glGetBooleanv",
+  "glMaterialfv",
+  "glWindowPos4fvMESA",
+  "glVertexAttribIPointerEXT",
+  "glProgramBufferParametersfvNV",
+  "glAlphaFuncxOES",
+  "glMultiDrawArraysIndirectAMD",
+  "glNormalStream3ivATI",
+  "glTextureImage3DMultisampleNV",
+  "glProgramUniform4uivEXT",
+  "glReplacementCodeusvSUN",
+  "glPollInstrumentsSGIX",
+  "glGetTextureLevelParameteriv",
+  "glVertexAttribI2uiv",
+  "glMapControlPointsNV",
+  "glColor4dv",
+  "glInvalidateBufferSubData",
+  "glMultiTexCoord1hNV",
+  "glPointParameterfv",
+  "glUniformMatrix2fvARB",
+  "glUniform2fv",
+  "glVertexPointerListIBM",
+  "glGetMultiTexGenfvEXT",
+  "glGetMinmaxEXT",
+  "glIsFenceNV",
+  "glMatrixFrustumEXT",
+  "glDispatchComputeIndirect",
+  "glQueryResourceNV",
+  "glMultiTexCoord4bOES",
+  "glProgramEnvParameter4dARB",
+  "glProgramUniform1uiEXT",
+  "glBindBufferRange",
+  "glNormal3iv",
+  "glVertexAttribL3dv",
+  "glGetUniformdv",
+  "glGetMultiTexLevelParameterfvEXT",
+  "glFinalCombinerInputNV",
+  "glCullParameterdvEXT",
+  "glMultiTexCoord4s",
+  "glMapVertexAttrib1fAPPLE",
+  "glConvolutionParameterfEXT",
+  "glTexCoord1iv",
+  "glProgramUniform3fvEXT",
+  "glColor3uiv",
+  "glRenderGpuMaskNV",
+  "glListBase",
+  "glTexCoord2bOES",
+  "glBindMaterialParameterEXT",
+  "glGlobalAlphaFactorubSUN",
+  "glVertexAttribL1ui64NV",
+  "glPointParameterfSGIS",
+  "glGetImageTransformParameterivHP",
+  "glColorSubTableEXT",
+  "glPixelTexGenParameterfvSGIS",
+  "glClientWaitSync",
+  "glQueryObjectParameteruiAMD",
+  "glVertexAttribs1fvNV",
+  "glVertexAttrib4NusvARB",
+  "glVariantPointerEXT",
+  "glTextureBuffer",
+  "glVertexAttribI1uiEXT",
+  "glInvalidateTexImage",
+  "glProgramEnvParametersI4ivNV",
+  "glPathGlyphIndexArrayNV",
+  "glCopyImageSubData",
+  "glGetUniformSubroutineuiv",
+  "glBindVertexBuffer",
+  "glMultiTexCoord1iARB",
+  "glDebugMessageInsert",
+  "glBeginVertexShaderEXT",
+  "glIsVariantEnabledEXT",
+  "glPassThroughxOES",
+  "glIsSampler",
+  "glConservativeRasterParameterfNV",
+  "glMultiTexGenivEXT",
+  "glNamedFramebufferTexture2DEXT",
+  "glCopyTexSubImage1D",
+  "glTexCoord1i",
+  "glCheckFramebufferStatus",
+  "glDrawElementArrayAPPLE",
+  "glTexCoord1d",
+  "glTexCoord1f",
+  "glFragmentLightivSGIX",
+  "glBindImageTexture",
+  "glTransformFeedbackVaryings",
+  "glMulticastBufferSubDataNV",
+  "glDrawRangeElements",
+  "glTexCoord1s",
+  "glBindBufferBase",
+  "glColor3bv",
+  "glSyncTextureINTEL",
+  "glCreateSamplers",
+  "glCombinerParameterfNV",
+  "glGetArrayObjectivATI",
+  "glMultiDrawArrays",
+  "glSampleMapATI",
+  "glProgramUniform2i64ARB",
+  "glBinormal3ivEXT",
+  "glMultiDrawArraysIndirectCountARB",
+  "glTextureStorageMem1DEXT",
+  "glWindowPos2ivMESA",
+  "glTexCoordP4ui",
+  "glMultiTexSubImage1DEXT",
+  "glProgramUniformMatrix2x3fvEXT",
+  "glBufferDataARB",
+  "glVertexAttribIFormat",
+  "glCreateFramebuffers",
+  "glNormalStream3dvATI",
+  "glClearAccum",
+  "glUniform3i64vNV",
+  "glNormal3fVertex3fSUN",
+  "glUniform2uivEXT",
+  "glBeginQuery",
+  "glStencilThenCoverStrokePathInstancedNV",
+  "glBindBuffer",
+  "glMap2d",
+  "glMap2f",
+  "glMakeImageHandleResidentNV",
+  "glUniformMatrix2x4fv",
+  "glGetMultiTexParameterfvEXT",
+  "glDepthRangeIndexed",
+  "glIsEnabled",
+  "glMatrixScalefEXT",
+  "glGetError",
+  "glGetTexEnviv",
+  "glBindTextureUnitParameterEXT",
+  "glGetnUniformfvARB",
+  "glReplacementCodeuiNormal3fVertex3fvSUN",
+  "glDeletePerfQueryINTEL",
+  "glActiveVaryingNV",
+  "glGetActiveUniformARB",
+  "glVertexAttribI3ivEXT",
+  "glEvalCoord1d",
+  "glNamedCopyBufferSubDataEXT",
+  "glEvalCoord1f",
+  "glPixelMapfv",
+  "glVertexAttribI1ivEXT",
+  "glCreateSyncFromCLeventARB",
+  "glGetPixelMapusv",
+  "glGetnColorTableARB",
+  "glAccum",
+  "glRasterPos3sv",
+  "glTexCoord2iv",
+  "glBlendFunciARB",
+  "glProgramUniform3i64vARB",
+  "glGetFramebufferAttachmentParameteriv",
+  "glProgramUniform4ui",
+  "glStencilMask",
+  "glResetHistogramEXT",
+  "glLightxOES",
+  "glNamedBufferData",
+  "glVertexStream3sATI",
+  "glVertexAttrib3fvARB",
+  "glClearNamedBufferSubData",
+  "glProgramUniformHandleui64ARB",
+  "glUniform3iARB",
+  "glCreateProgramObjectARB",
+  "glMultiTexCoord1dvARB",
+  "glGetObjectParameterfvARB",
+  "glRectsv",
+  "glMultiTexImage2DEXT",
+  "glProgramUniform1i64NV",
+  "glGetObjectBufferivATI",
+  "glUniform4i64ARB",
+  "glReplacementCodeuiColor4ubVertex3fvSUN",
+  "glBlendFuncSeparateINGR",
+  "glGetVideoCaptureStreamfvNV",
+  "glVertexAttrib2fARB",
+  "glGetTexGeniv",
+  "glPixelStorei",
+  "glGetCompressedTextureSubImage",
+  "glCopyImageSubDataNV",
+  "glActiveShaderProgram",
+  "glVertexStream1iATI",
+  "glPatchParameterfv",
+  "glIsFramebufferEXT",
+  "glTextureStorage2D",
+  "glProgramUniform1ui64ARB",
+  "glTexBufferRange",
+  "glGetPixelTexGenParameterivSGIS",
+  "glTextureSubImage3DEXT",
+  "glClipControl",
+  "glGetProgramResourceiv",
+  "glMultiTexCoordP2uiv",
+  "glVertexAttribI3ui",
+  "glSampleMaskSGIS",
+  "glVertexAttrib4NivARB",
+  "glGlobalAlphaFactorfSUN",
+  "glBlendEquationSeparateIndexedAMD",
+  "glGetPerfCounterInfoINTEL",
+  "glDeleteProgramsNV",
+  "glPixelZoomxOES",
+  "glGetCombinerOutputParameterivNV",
+  "glRasterPos2xvOES",
+  "glGetTexImage",
+  "glVertexArrayVertexBuffers",
+  "glUniform1ui64NV",
+  "glProgramParameteri",
+  "glNormal3xOES",
+  "glGetMapfv",
+  "glVertexStream2dvATI",
+  "glPathStencilDepthOffsetNV",
+  "glIsStateNV",
+  "glGetIntegerui64vNV",
+  "glGetImageTransformParameterfvHP",
+  "glRasterPos2fv",
+  "glVertex3xOES",
+  "glIsMemoryObjectEXT",
+  "glWeightPointerARB",
+  "glFinishFenceNV",
+  "glDepthRangexOES",
+  "glEnableVertexArrayAttribEXT",
+  "glProgramUniform2uivEXT",
+  "glGetDoubleIndexedvEXT",
+  "glWindowPos2fMESA",
+  "glSecondaryColor3b",
+  "glCopyConvolutionFilter1DEXT",
+  "glWindowPos2sv",
+  "glBindFramebufferEXT",
+  "glCreateShader",
+  "glGenPathsNV",
+  "glGenRenderbuffers",
+  "glCopyTexSubImage2D",
+  "glVertexAttrib4ubvARB",
+  "glDrawTextureNV",
+  "glVertexAttribs1svNV",
+  "glClearNamedBufferSubDataEXT",
+  "glBlendFuncSeparate",
+  "glPointParameterfARB",
+  "glTexCoord2fv",
+  "glGetVariantFloatvEXT",
+  "glVertexP2ui",
+  "glWindowPos2dMESA",
+  "glTexCoord4fv",
+  "glBindFragDataLocationEXT",
+  "glCompressedTexSubImage1DARB",
+  "glGetTextureImageEXT",
+  "glFogCoordd",
+  "glPointSize",
+  "glBindTextureUnit",
+  "glProgramEnvParameterI4uiNV",
+  "glGetProgramPipelineInfoLog",
+  "glProgramUniform4i64vARB",
+  "glVertexAttrib4Nuiv",
+  "glGetUniformfvARB",
+  "glWaitSync",
+  "glUniform3i",
+  "glBlendEquationSeparatei",
+  "glVertexAttrib2hvNV",
+  "glTextureParameterivEXT",
+  "glUniform3d",
+  "glUniform3f",
+  "glActiveProgramEXT",
+  "glProgramUniform3uiv",
+  "glUniform3ui64vARB",
+  "glProgramUniform1ui64vARB",
+  "glTextureParameterfEXT",
+  "glSetFragmentShaderConstantATI",
+  "glColorSubTable",
+  "glReplacementCodeuiSUN",
+  "glStateCaptureNV",
+  "glBindAttribLocation",
+  "glWeightusvARB",
+  "glGetFragDataIndex",
+  "glMultiTexCoord2xOES",
+  "glColor3sv",
+  "glTexCoord2fVertex3fSUN",
+  "glGetMemoryObjectParameterivEXT",
+  "glPolygonOffsetEXT",
+  "glWeightPathsNV",
+  "glCombinerStageParameterfvNV",
+  "glPointParameterfEXT",
+  "glCopyTexImage1DEXT",
+  "glVertex4sv",
+  "glMatrixMultfEXT",
+  "glCompressedTextureSubImage3DEXT",
+  "glGetTexLevelParameterxvOES",
+  "glVertexAttribL3dvEXT",
+  "glMultiTexCoordP4ui",
+  "glGetTextureLevelParameterivEXT",
+  "glAlphaFragmentOp2ATI",
+  "glDeleteFramebuffers",
+  "glDrawArrays",
+  "glGetTransformFeedbackiv",
+  "glGetnTexImageARB",
+  "glClear",
+  "glVertexArrayParameteriAPPLE",
+  "glMultiTexCoord2dvARB",
+  "glGetVideoCaptureStreamdvNV",
+  "glFragmentLightModelivSGIX",
+  "glVertexAttribP2ui",
+  "glMultiTexCoordPointerEXT",
+  "glProgramUniform3iEXT",
+  "glTranslatef",
+  "glVertexAttrib4Nub",
+  "glTranslated",
+  "glSamplerParameterIiv",
+  "glTexCoord4hNV",
+  "glDrawElementsIndirect",
+  "glDeletePerfMonitorsAMD",
+  "glIsRenderbufferEXT",
+  "glDrawCommandsNV",
+  "glUniform3ivARB",
+  "glBufferSubData",
+  "glSecondaryColor3bv",
+  "glMatrixMultTransposedEXT",
+  "glRequestResidentProgramsNV",
+  "glAlphaFragmentOp1ATI",
+  "glGetQueryObjecti64v",
+  "glMatrixMult3x3fNV",
+  "glColorTableParameteriv",
+  "glPathSubCommandsNV",
+  "glGetFinalCombinerInputParameterivNV",
+  "glIsRenderbuffer",
+  "glVertex3iv",
+  "glTexGenfv",
+  "glFrustumfOES",
+  "glBindVertexBuffers",
+  "glMateriali",
+  "glMultiTexCoord2svARB",
+  "glDisableVertexAttribArray",
+  "glWindowPos3ivARB",
+  "glTexCoordFormatNV",
+  "glBlitNamedFramebuffer",
+  "glMatrixLoadTransposefEXT",
+  "glMultiTexGenfEXT",
+  "glShaderStorageBlockBinding",
+  "glMaterialf",
+  "glReplacementCodeuiColor4fNormal3fVertex3fSUN",
+  "glCheckNamedFramebufferStatusEXT",
+  "glVertexArrayVertexAttribFormatEXT",
+  "glVertex2hNV",
+  "glDeleteVertexShaderEXT",
+  "glTexImage3DEXT",
+  "glSignalVkFenceNV",
+  "glProgramLocalParameterI4ivNV",
+  "glGlobalAlphaFactoriSUN",
+  "glTextureStorage1D",
+  "glBinormal3sEXT",
+  "glGetProgramInterfaceiv",
+  "glMatrixIndexPointerARB",
+  "glTexCoordPointerEXT",
+  "glMultiTexGeniEXT",
+  "glVertexAttrib2fNV",
+  "glNamedProgramStringEXT",
+  "glMapNamedBuffer",
+  "glGetMinmaxParameteriv",
+  "glGetnUniformdv",
+  "glEndConditionalRenderNVX",
+  "glBinormal3fEXT",
+  "glNormalStream3iATI",
+  "glProgramBufferParametersIivNV",
+  "glMapGrid1xOES",
+  "glGetVertexAttribPointervARB",
+  "glFlushMappedNamedBufferRangeEXT",
+  "glGetVertexAttribIiv",
+  "glVertexP4uiv",
+  "glUniformui64NV",
+  "glColor4fv",
+  "glTexParameterxvOES",
+  "glPatchParameteri",
+  "glMap1d",
+  "glGetTexFilterFuncSGIS",
+  "glVertexStream3dATI",
+  "glVertexArrayVertexBindingDivisorEXT",
+  "glMultiTexCoord3svARB",
+  "glBindProgramNV",
+  "glGetConvolutionParameteriv",
+  "glGetProgramLocalParameterfvARB",
+  "glGenFragmentShadersATI",
+  "glTexBumpParameterivATI",
+  "glGetNamedFramebufferAttachmentParameteriv",
+  "glGetnSeparableFilter",
+  "glNormal3xvOES",
+  "glPassTexCoordATI",
+  "glFramebufferTextureFaceARB",
+  "glProgramUniform1dv",
+  "glTextureStorage2DEXT",
+  "glVertexArrayFogCoordOffsetEXT",
+  "glDeleteNamedStringARB",
+  "glMulticastGetQueryObjecti64vNV",
+  "glGenOcclusionQueriesNV",
+  "glLighti",
+  "glTexImage1D",
+  "glLightf",
+  "glClientAttribDefaultEXT",
+  "glVertexAttrib4bvARB",
+  "glVertexAttribIFormatNV",
+  "glStencilFuncSeparate",
+  "glGetVertexAttribfvARB",
+  "glVertexAttrib2dNV",
+  "glProgramUniform2iEXT",
+  "glClientActiveVertexStreamATI",
+  "glRasterPos3xOES",
+  "glGetMapParameterivNV",
+  "glSampleCoverage",
+  "glClearDepthxOES",
+  "glUniformBufferEXT",
+  "glTexCoord2fNormal3fVertex3fvSUN",
+  "glMulticastGetQueryObjectuivNV",
+  "glGetFirstPerfQueryIdINTEL",
+  "glUnmapNamedBufferEXT",
+  "glGetTransformFeedbacki_v",
+  "glUniform4fvARB",
+  "glRenderbufferStorageMultisampleCoverageNV",
+  "glGetFloati_vEXT",
+  "glBindAttribLocationARB",
+  "glBufferAddressRangeNV",
+  "glGenProgramsARB",
+  "glMultiTexEnvivEXT",
+  "glSecondaryColor3uiEXT",
+  "glCompressedTextureImage2DEXT",
+  "glUniform2i",
+  "glCopyTexImage2DEXT",
+  "glUniform2d",
+  "glVertexAttribL1d",
+  "glFramebufferTextureFaceEXT",
+  "glFramebufferTextureLayer",
+  "glMultiTexCoord4bvOES",
+  "glGetVertexArrayPointeri_vEXT",
+  "glNamedProgramLocalParameter4dEXT",
+  "glBinormal3bEXT",
+  "glConvolutionFilter2DEXT",
+  "glProgramUniform2fv",
+  "glColor3fVertex3fSUN",
+  "glNormal3fVertex3fvSUN",
+  "glCopyMultiTexSubImage3DEXT",
+  "glProgramLocalParameterI4iNV",
+  "glProgramUniformMatrix2x4dv",
+  "glPathMemoryGlyphIndexArrayNV",
+  "glDrawArraysEXT",
+  "glBlendEquationEXT",
+  "glStencilOp",
+  "glCopyTextureSubImage2DEXT",
+  "glTexEnvf",
+  "glVertexAttrib2dvNV",
+  "glGenPerfMonitorsAMD",
+  "glGetInteger64i_v",
+  "glGetHistogramParameterfv",
+  "glVertexFormatNV",
+  "glBlendFuncIndexedAMD",
+  "glTexEnvi",
+  "glMultiTexCoord1iv",
+  "glIsEnabledi",
+  "glVertexAttribL2ui64vNV",
+  "glVertexAttribL4i64NV",
+  "glMatrixTranslatedEXT",
+  "glMakeTextureHandleResidentARB",
+  "glMatrixMultdEXT",
+  "glBinormal3dvEXT",
+  "glImportSyncEXT",
+  "glGetMapiv",
+  "glImportSemaphoreFdEXT",
+  "glMultiTexCoord4sv",
+  "glPNTrianglesiATI",
+  "glBindVertexArrayAPPLE",
+  "glObjectPtrLabel",
+  "glGetDebugMessageLog",
+  "glTrackMatrixNV",
+  "glProgramPathFragmentInputGenNV",
+  "glTangent3ivEXT",
+  "glGetUniformfv",
+  "glSecondaryColor3ubv",
+  "glMakeTextureHandleNonResidentNV",
+  "glVertexAttribs4ubvNV",
+  "glClipPlanexOES",
+  "glMultiTexCoord3iv",
+  "glGetnPolygonStippleARB",
+  "glUniform2i64vNV",
+  "glLightModelf",
+  "glDeleteMemoryObjectsEXT",
+  "glMultiTexSubImage2DEXT",
+  "glReplacementCodeuiColor3fVertex3fSUN",
+  "glTangent3dvEXT",
+  "glLightModeli",
+  "glVertexWeighthvNV",
+  "glWindowPos3iv",
+  "glMultiTexCoordP1uiv",
+  "glTransformPathNV",
+  "glProgramNamedParameter4dNV",
+  "glMultiDrawElementsIndirect",
+  "glProgramUniform1dEXT",
+  "glCallLists",
+  "glNormal3hvNV",
+  "glGetCombinerOutputParameterfvNV",
+  "glVertexAttrib4sARB",
+  "glTexCoord3i",
+  "glVertexAttribI3uiv",
+  "glPushDebugGroup",
+  "glTexCoord3f",
+  "glTexCoord3d",
+  "glTexCoord2xOES",
+  "glGetStageIndexNV",
+  "glProgramUniform4i64vNV",
+  "glGetNamedBufferPointervEXT",
+  "glTextureBarrierNV",
+  "glColor4ubVertex3fvSUN",
+  "glGetCommandHeaderNV",
+  "glGetPerfMonitorCounterInfoAMD",
+  "glVertexAttrib1svARB",
+  "glCombinerParameteriNV",
+  "glMatrixMultTransposefEXT",
+  "glDetailTexFuncSGIS",
+  "glAreTexturesResident",
+  "glProgramUniform2d",
+  "glGetConvolutionParameterfvEXT",
+  "glIndexPointerListIBM",
+  "glVertexAttribI4iEXT",
+  "glProgramUniform2f",
+  "glRasterPos4sv",
+  "glColor4s",
+  "glMulticastGetQueryObjectivNV",
+  "glColorFragmentOp3ATI",
+  "glResizeBuffersMESA",
+  "glGetMinmaxParameterfv",
+  "glClientActiveTextureARB",
+  "glBindVertexArray",
+  "glColor4b",
+  "glColor4f",
+  "glColor4d",
+  "glColor4i",
+  "glEdgeFlagFormatNV",
+  "glNamedBufferSubData",
+  "glDrawElementsInstanced",
+  "glGetMultiTexParameterIivEXT",
+  "glVertex2dv",
+  "glDisableVertexArrayAttribEXT",
+  "glObjectUnpurgeableAPPLE",
+  "glVertexAttribs2dvNV",
+  "glReplacementCodeuiTexCoord2fVertex3fSUN",
+  "glGetMapParameterfvNV",
+  "glProgramUniform4ivEXT",
+  "glProgramUniform3ui64vNV",
+  "glRectfv",
+  "glTexFilterFuncSGIS",
+  "glSpriteParameterfvSGIX",
+  "glCopyMultiTexImage1DEXT",
+  "glGetVertexAttribIuivEXT",
+  "glUniformMatrix2x4dv",
+  "glGetProgramResourceLocationIndex",
+  "glColor3hNV",
+  "glViewport",
+  "glProgramNamedParameter4fNV",
+  "glGetInvariantBooleanvEXT",
+  "glTexStorage2DMultisample",
+  "glPixelStorex",
+  "glVertexAttribL1dvEXT",
+  "glGetActiveSubroutineUniformiv",
+  "glVertexAttribPointerARB",
+  "glCompressedTexSubImage2DARB",
+  "glTexStorageMem1DEXT",
+  "glVertex2hvNV",
+  "glTexBuffer",
+  "glArrayElement",
+  "glValidateProgram",
+  "glPixelStoref",
+  "glWindowPos3dARB",
+  "glEvalCoord1dv",
+  "glVertexAttribs2fvNV",
+  "glRecti",
+  "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",
+  "glTexCoord1bOES",
+  "glProgramUniform2i64vARB",
+  "glWindowPos2dARB",
+  "glGetProgramParameterdvNV",
+  "glRectf",
+  "glRectd",
+  "glMap1xOES",
+  "glVertexAttrib3fvNV",
+  "glReferencePlaneSGIX",
+  "glMulticastBlitFramebufferNV",
+  "glGetCombinerInputParameterfvNV",
+  "glGetTextureSamplerHandleARB",
+  "glBindTexture",
+  "glRects",
+  "glGetActiveAttribARB",
+  "glHistogramEXT",
+  "glGetTextureSamplerHandleNV",
+  "glDetachShader",
+  "glFinishTextureSUNX",
+  "glUniformMatrix3x4dv",
+  "glVertexAttrib4fARB",
+  "glGetPathColorGenivNV",
+  "glGetProgramResourceLocation",
+  "glVertexArrayAttribLFormat",
+  "glGetTexLevelParameterfv",
+  "glVertexArrayVertexAttribOffsetEXT",
+  "glIndexFormatNV",
+  "glMultiTexCoord3i",
+  "glReplacementCodeuiVertex3fvSUN",
+  "glViewportIndexedfv",
+  "glBindBuffersBase",
+  "glTexBumpParameterfvATI",
+  "glMatrixIndexuivARB",
+  "glVertexAttrib1hNV",
+  "glWindowPos3svMESA",
+  "glStencilOpSeparateATI",
+  "glDrawElementsBaseVertex",
+  "glBlendEquationSeparateiARB",
+  "glVertexAttrib1fNV",
+  "glMapVertexAttrib2fAPPLE",
+  "glCompressedTextureSubImage1DEXT",
+  "glClearBufferSubData",
+  "glTexStorage1D",
+  "glVertexAttribI3iEXT",
+  "glMakeTextureHandleNonResidentARB",
+  "glMultiDrawElementArrayAPPLE",
+  "glVertexStream4dATI",
+  "glProgramUniformMatrix2dvEXT",
+  "glVertexAttribs2hvNV",
+  "glGetUniformiv",
+  "glClipPlanefOES",
+  "glRenderbufferStorage",
+  "glUniform4ui",
+  "glBindFramebuffer",
+  "glValidateProgramARB",
+  "glTexGenf",
+  "glTexGend",
+  "glTexGeni",
+  "glDeleteFramebuffersEXT",
+  "glResetMinmaxEXT",
+  "glVertexAttrib1fvNV",
+  "glIsQueryARB",
+  "glEnableVariantClientStateEXT",
+  "glScissorIndexed",
+  "glGetInvariantIntegervEXT",
+  "glProgramLocalParameterI4uiNV",
+  "glConvolutionParameterxvOES",
+  "glGenFramebuffersEXT",
+  "glVertexArrayColorOffsetEXT",
+  "glMultiTexCoord3ivARB",
+  "glVertexWeightfEXT",
+  "glRasterPos4dv",
+  "glIsTextureHandleResidentARB",
+  "glRasterPos2dv",
+  "glWindowPos4ivMESA",
+  "glGetVariantPointervEXT",
+  "glMapNamedBufferRangeEXT",
+  "glGetnUniformui64vARB",
+  "glCreateShaderProgramv",
+  "glGetQueryObjectiv",
+  "glMaxShaderCompilerThreadsKHR",
+  "glPNTrianglesfATI",
+  "glGlobalAlphaFactorusSUN",
+  "glVertexAttrib3dvNV",
+  "glMultiTexCoord3sARB",
+  "glGenerateMipmap",
+  "glCompressedTextureSubImage2D",
+  "glNamedRenderbufferStorageMultisampleEXT",
+  "glPolygonOffsetClampEXT",
+  "glTextureRangeAPPLE",
+  "glBlendEquationIndexedAMD",
+  "glTexCoord2d",
+  "glPointParameteri",
+  "glTexCoord2f",
+  "glGetUnsignedBytei_vEXT",
+  "glColor4iv",
+  "glMapNamedBufferRange",
+  "glUnmapBuffer",
+  "glSampleMaskEXT",
+  "glTexCoord2i",
+  "glTexCoord1xvOES",
+  "glVertexAttrib1sARB",
+  "glGetVertexArrayiv",
+  "glProgramParameter4dvNV",
+  "glTexCoord2s",
+  "glTextureParameterIuivEXT",
+  "glGetColorTableParameterfvSGI",
+  "glTexCoord4dv",
+  "glVertexAttrib1svNV",
+  "glNamedFramebufferTextureFaceEXT",
+  "glProgramUniform2ui64vNV",
+  "glStencilFillPathNV",
+  "glNormal3dv",
+  "glReleaseShaderCompiler",
+  "glTexStorageMem3DEXT",
+  "glTexCoord3bvOES",
+  "glIsVertexAttribEnabledAPPLE",
+  "glTexCoord1dv",
+  "glReadPixels",
+  "glVertexAttribI3iv",
+  "glSetFenceAPPLE",
+  "glWeightsvARB",
+  "glShadeModel",
+  "glTextureStorageMem3DMultisampleEXT",
+  "glMapGrid1d",
+  "glGetHistogramParameterivEXT",
+  "glConservativeRasterParameteriNV",
+  "glClearNamedBufferData",
+  "glClearDepthf",
+  "glCreatePerfQueryINTEL",
+  "glFogCoordfEXT",
+  "glVertexAttrib2dARB",
+  "glMultiTexCoord4dARB",
+  "glReadnPixelsARB",
+  "glMultiTexBufferEXT",
+  "glWindowPos4dvMESA",
+  "glInvalidateNamedFramebufferData",
+  "glSecondaryColorPointerListIBM",
+  "glRectiv",
+  "glColorP4ui",
+  "glUseProgramStages",
+  "glRasterPos3dv",
+  "glPathTexGenNV",
+  "glVertexBlendEnviATI",
+  "glUniform3i64ARB",
+  "glLoadMatrixf",
+  "glProgramUniform2dEXT",
+  "glVertexAttribI4iv",
+  "glNamedFramebufferDrawBuffer",
+  "glColor4ubv",
+  "glColor3hvNV",
+  "glGetMapAttribParameterfvNV",
+  "glGetBufferSubData",
+  "glGetVertexAttribLdv",
+  "glGetnUniformuiv",
+  "glGetUniformui64vNV",
+  "glNamedRenderbufferStorageEXT",
+  "glVertexAttrib3dNV",
+  "glTextureStorage1DEXT",
+  "glPixelTexGenParameteriSGIS",
+  "glColorTableEXT",
+  "glGenBuffers",
+  "glMultiTexCoord3xvOES",
+  "glExecuteProgramNV",
+  "glVariantArrayObjectATI",
+  "glColor3xvOES",
+  "glGetnConvolutionFilterARB",
+  "glNormalFormatNV",
+  "glGetInvariantFloatvEXT",
+  "glClearNamedFramebufferiv",
+  "glTexImage3D",
+  "glGenSamplers",
+  "glIsFramebuffer",
+  "glProgramUniform3dvEXT",
+  "glGetVertexAttribfvNV",
+  "glDrawRangeElementArrayAPPLE",
+  "glUniform3i64NV",
+  "glMatrixPopEXT",
+  "glVertexStream1sATI",
+  "glGetnPixelMapuivARB",
+  "glMultiTexEnviEXT",
+  "glVertexAttribI2iEXT",
+  "glProgramParameter4fvNV",
+  "glWaitSemaphoreEXT",
+  "glNamedFramebufferSampleLocationsfvNV",
+  "glTexCoordP4uiv",
+  "glRectxvOES",
+  "glGetVariantIntegervEXT",
+  "glDeleteLists",
+  "glTexGendv",
+  "glVertexP2uiv",
+  "glGetPerfMonitorGroupsAMD",
+  "glMultTransposeMatrixfARB",
+  "glVertexAttribI2ivEXT",
+  "glReplacementCodeuiColor4fNormal3fVertex3fvSUN",
+  "glDeleteStatesNV",
+  "glGetBufferParameteri64v",
+  "glProgramUniform4dv",
+  "glEdgeFlagPointerEXT",
+  "glVideoCaptureStreamParameterivNV",
+  "glVertexStream4iATI",
+  "glVDPAUFiniNV",
+  "glMakeBufferNonResidentNV",
+  "glUniform1ui64ARB",
+  "glStencilStrokePathNV",
+  "glVariantuivEXT",
+  "glCopyTexSubImage3DEXT",
+  "glSpriteParameteriSGIX",
+  "glMultiTexCoord1sARB",
+  "glConvolutionParameterfv",
+  "glMakeTextureHandleResidentNV",
+  "glMultMatrixxOES",
+  "glTextureNormalEXT",
+  "glGetQueryivARB",
+  "glCompressedMultiTexImage3DEXT",
+  "glGetInstrumentsSGIX",
+  "glProgramUniformMatrix4x3fvEXT",
+  "glPointParameterf",
+  "glProgramUniform3dEXT",
+  "glMultiTexCoord2hNV",
+  "glGetConvolutionFilterEXT",
+  "glVertexAttrib2hNV",
+  "glCurrentPaletteMatrixARB",
+  "glFogxvOES",
+  "glCreateRenderbuffers",
+  "glVertexAttrib4Nusv",
+  "glCombinerInputNV",
+  "glDepthFunc",
+  "glWindowPos4fMESA",
+  "glEnableClientStateIndexedEXT",
+  "glTexCoord4iv",
+  "glProgramUniform4i64ARB",
+  "glBlendFunci",
+  "glResolveDepthValuesNV",
+  "glTextureColorMaskSGIS",
+  "glCreateShaderProgramEXT",
+  "glBufferStorage",
+  "glMakeNamedBufferNonResidentNV",
+  "glRenderbufferStorageMultisampleEXT",
+  "glGetFloati_v",
+  "glUniform2ui64ARB",
+  "glVertex3fv",
+  "glGetUniformLocation",
+  "glVertexStream1svATI",
+  "glVertexStream3fATI",
+  "glNamedFramebufferDrawBuffers",
+  "glUniform2ui64vNV",
+  "glTexCoordPointervINTEL",
+  "glUniform4fv",
+  "glNormalPointerEXT",
+  "glVertexAttrib4hNV",
+  "glNormal3f",
+  "glVertexStream2iATI",
+  "glVertexAttribP4uiv",
+  "glCompressedTextureSubImage3D",
+  "glAsyncMarkerSGIX",
+  "glTextureStorageSparseAMD",
+  "glGetConvolutionParameterivEXT",
+  "glEndPerfQueryINTEL",
+  "glFragmentLightModeliSGIX",
+  "glPrioritizeTexturesEXT",
+  "glEndConditionalRender",
+  "glEnableClientState",
+  "glResetHistogram",
+  "glGetOcclusionQueryivNV",
+  "glUniform1uiEXT",
+  "glMultiTexCoord2sv",
+  "glTexSubImage2DEXT",
+  "glProgramUniform2uiv",
+  "glMultiTexCoord2iARB",
+  "glGetQueryObjectuiv",
+  "glGenerateMultiTexMipmapEXT",
+  "glVertexAttrib4iv",
+  "glWindowPos3dvMESA",
+  "glLabelObjectEXT",
+  "glProgramUniform1uiv",
+  "glFramebufferTexture",
+  "glMultiTexEnvfEXT",
+  "glGetTexGendv",
+  "glVertex4xOES",
+  "glVertexAttribI2uivEXT",
+  "glNamedProgramLocalParameter4fvEXT",
+  "glColor3usv",
+  "glGetPixelTransformParameterfvEXT",
+  "glIndexxvOES",
+  "glDepthMask",
+  "glProgramUniformMatrix2x4fv",
+  "glAreProgramsResidentNV",
+  "glColorTable",
+  "glBeginQueryIndexed",
+  "glVertexStream1dvATI",
+  "glGetMultiTexEnvfvEXT",
+  "glDeleteFencesNV",
+  "glVertexAttribs1dvNV",
+  "glBufferStorageExternalEXT",
+  "glVertexStream2sATI",
+  "glGetnSeparableFilterARB",
+  "glProgramUniform2dv",
+  "glActiveStencilFaceEXT",
+  "glProgramUniform4dEXT",
+  "glPointSizexOES",
+  "glRasterPos2sv",
+  "glBindParameterEXT",
+  "glTexCoord1sv",
+  "glBlendParameteriNV",
+  "glNamedProgramLocalParameter4dvEXT",
+  "glProgramUniformHandleui64NV",
+  "glGetTextureParameterfvEXT",
+  "glGetPathMetricsNV",
+  "glVertex2i",
+  "glNewList",
+  "glMatrixLoad3x3fNV",
+  "glMultiTexCoord2fARB",
+  "glWeightdvARB",
+  "glIsTransformFeedbackNV",
+  "glVertexAttribDivisorARB",
+  "glSecondaryColorP3uiv",
+  "glGetnCompressedTexImageARB",
+  "glGetIntegerv",
+  "glMatrixLoaddEXT",
+  "glGetPathLengthNV",
+  "glProgramUniformMatrix3dv",
+  "glUniform4i64NV",
+  "glGetHistogramEXT",
+  "glVertexAttrib4NuivARB",
+  "glMapGrid2xOES",
+  "glTexImage2D",
+  "glWindowPos2fvARB",
+  "glEnableIndexedEXT",
+  "glTexCoord1bvOES",
+  "glDrawPixels",
+  "glMultMatrixd",
+  "glMultMatrixf",
+  "glReplacementCodePointerSUN",
+  "glLoadTransposeMatrixdARB",
+  "glVertexAttrib4Nubv",
+  "glVertexArrayVertexAttribIOffsetEXT",
+  "glCompileShaderARB",
+  "glWindowPos3dMESA",
+  "glNormalStream3fvATI",
+  "glColor4usv",
+  "glMapGrid1f",
+  "glPolygonStipple",
+  "glUniform4ui64ARB",
+  "glTextureRenderbufferEXT",
+  "glGetSubroutineUniformLocation",
+  "glGetFramebufferParameteriv",
+  "glPixelMapusv",
+  "glGetSamplerParameteriv",
+  "glVertexStream2fvATI",
+  "glProgramStringARB",
+  "glProgramUniformMatrix3dvEXT",
+  "glSeparableFilter2D",
+  "glVertexAttribI1uiv",
+  "glLGPUCopyImageSubDataNVX",
+  "glTexStorage2D",
+  "glColor3fv",
+  "glGetMultiTexGendvEXT",
+  "glVertexAttribL4dvEXT",
+  "glGetActiveUniform",
+  "glUniform2ui64vARB",
+  "glMakeNamedBufferResidentNV",
+  "glPathGlyphIndexRangeNV",
+  "glColorPointer",
+  "glProgramEnvParameterI4ivNV",
+  "glMulticastGetQueryObjectui64vNV",
+  "glMultiTexParameterfEXT",
+  "glNamedFramebufferTextureLayer",
+  "glGetVertexArrayIntegervEXT",
+  "glVertexAttrib3dARB",
+  "glVDPAUIsSurfaceNV",
+  "glMultiTexImage1DEXT",
+  "glIsAsyncMarkerSGIX",
+  "glGetDoublei_vEXT",
+  "glUniform2i64NV",
+  "glIsCommandListNV",
+  "glUniform3uiEXT",
+  "glTexParameterIuivEXT",
+  "glProgramUniformMatrix4fv",
+  "glVertex2fv",
+  "glVertexAttribL3dEXT",
+  "glFramebufferRenderbuffer",
+  "glGetUniformLocationARB",
+  "glPathParameterfvNV",
+  "glVertexAttrib3sNV",
+  "glGetDoublei_v",
+  "glVertexAttrib1sv",
+  "glBindSampler",
+  "glLineWidth",
+  "glVertexArrayRangeAPPLE",
+  "glBindBufferOffsetEXT",
+  "glWeightfvARB",
+  "glGetIntegeri_v",
+  "glGetTransformFeedbackVarying",
+  "glProgramLocalParameter4fvARB",
+  "glGetTransformFeedbackVaryingNV",
+  "glWindowPos2iv",
+  "glVertexStream1dATI",
+  "glColorFragmentOp2ATI",
+  "glFogiv",
+  "glGetTextureHandleNV",
+  "glLightModeliv",
+  "glDepthRangef",
+  "glGetFragmentMaterialivSGIX",
+  "glVideoCaptureStreamParameterfvNV",
+  "glDeleteProgramsARB",
+  "glWindowPos3fvARB",
+  "glFeedbackBufferxOES",
+  "glGetTexBumpParameterfvATI",
+  "glEnablei",
+  "glGetActiveSubroutineName",
+  "glDrawBuffersARB",
+  "glBindProgramARB",
+  "glEvalCoord1fv",
+  "glProgramUniform3ui64vARB",
+  "glProgramUniformMatrix2dv",
+  "glMultiTexCoord2hvNV",
+  "glGetFloatIndexedvEXT",
+  "glSampleCoverageARB",
+  "glProgramUniform2ui64vARB",
+  "glPixelDataRangeNV",
+  "glVertexStream3svATI",
+  "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",
+  "glTexCoord3hvNV",
+  "glSampleMaski",
+  "glIndexFuncEXT",
+  "glPointParameteriNV",
+  "glUniformMatrix3x2fv",
+  "glGetFramebufferParameterivEXT",
+  "glUniform2i64ARB",
+  "glNamedBufferStorageEXT",
+  "glNamedFramebufferTexture3DEXT",
+  "glVertexAttrib2dv",
+  "glGetVertexArrayPointervEXT",
+  "glGetVertexAttribArrayObjectivATI",
+  "glProgramUniformMatrix3fvEXT",
+  "glEnableVertexArrayEXT",
+  "glColorTableParameterfvSGI",
+  "glEdgeFlag",
+  "glFogCoordf",
+  "glVertex3d",
+  "glVertex3f",
+  "glSpriteParameterivSGIX",
+  "glPathGlyphRangeNV",
+  "glPrimitiveBoundingBoxARB",
+  "glVertexAttribL3ui64vNV",
+  "glVertex3s",
+  "glTexCoordP2ui",
+  "glProgramUniform2fvEXT",
+  "glDeletePathsNV",
+  "glPrimitiveRestartIndexNV",
+  "glTexCoord2fColor3fVertex3fvSUN",
+  "glTexCoordPointerListIBM",
+  "glRectxOES",
+  "glCopyNamedBufferSubData",
+  "glGenProgramsNV",
+  "glFragmentLightfSGIX",
+  "glTexStorage3D",
+  "glTextureParameteriv",
+  "glNamedBufferDataEXT",
+  "glImportSemaphoreWin32NameEXT",
+  "glMultiTexCoord3fvARB",
+  "glUniformMatrix3x4fv",
+  "glSubpixelPrecisionBiasNV",
+  "glNormalPointer",
+  "glNamedFramebufferTexture",
+  "glVertexAttrib4NsvARB",
+  "glPassThrough",
+  "glSecondaryColorP3ui",
+  "glInvalidateTexSubImage",
+  "glIsImageHandleResidentARB",
+  "glTangent3fvEXT",
+  "glProgramUniformMatrix4x3fv",
+  "glBegin",
+  "glEvalCoord2dv",
+  "glColor3ubv",
+  "glFogCoordfvEXT",
+  "glVertexP3ui",
+  "glLightfv",
+  "glVertexAttribL3i64NV",
+  "glStencilClearTagEXT",
+  "glGetActiveUniformName",
+  "glTangentPointerEXT",
+  "glUniform4ui64vNV",
+  "glDebugMessageEnableAMD",
+  "glProgramUniform2ui",
+  "glCopyTexSubImage2DEXT",
+  "glGenRenderbuffersEXT",
+  "glNamedProgramLocalParameterI4ivEXT",
+  "glMultiTexCoord2f",
+  "glMapGrid2d",
+  "glGetMultiTexParameterIuivEXT",
+  "glBlendEquationiARB",
+  "glTexParameteriv",
+  "glUniform4ivARB",
+  "glMatrixOrthoEXT",
+  "glVertexArrayVertexBuffer",
+  "glProgramLocalParametersI4ivNV",
+  "glProgramUniform4ui64vNV",
+  "glGetNamedStringivARB",
+  "glVertexAttribL1i64vNV",
+  "glTransformFeedbackBufferBase",
+  "glIndexsv",
+  "glPointParameterivNV",
+  "glGetDetailTexFuncSGIS",
+  "glReplacementCodeuiColor3fVertex3fvSUN",
+  "glProgramLocalParameter4fARB",
+  "glBitmap",
+  "glNamedFramebufferTextureLayerEXT",
+  "glMultiTexGenfvEXT",
+  "glGetNamedBufferSubData",
+  "glStencilFuncSeparateATI",
+  "glProgramUniform2iv",
+  "glGetQueryiv",
+  "glTexCoord4f",
+  "glMapGrid2f",
+  "glListParameterivSGIX",
+  "glCreateQueries",
+  "glGetSamplerParameterfv",
+  "glTexCoord4i",
+  "glObjectLabel",
+  "glProgramUniform3i64NV",
+  "glGetTextureHandleARB",
+  "glTexCoord4s",
+  "glUniform4iARB",
+  "glGetUniformIndices",
+  "glMultiTexImage3DEXT",
+  "glCoverageModulationTableNV",
+  "glPointParameteriv",
+  "glMultiTexCoord4svARB",
+  "glNormal3fv",
+  "glProgramUniformMatrix3x4dvEXT",
+  "glTexCoord1fv",
+  "glProgramUniformMatrix4x3dvEXT",
+  "glGetActiveVaryingNV",
+  "glUniform1i64vARB",
+  "glMultiTexCoord1dv",
+  "glTexCoord3fv",
+  "glMatrixTranslatefEXT",
+  "glProgramUniform1ui64vNV",
+  "glTextureMaterialEXT",
+  "glMultiTexCoordP3uiv",
+  "glVertexAttribP3ui",
+  "glInterpolatePathsNV",
+  "glTextureBufferRange",
+  "glVertexAttribL2dEXT",
+  "glGetPixelTransformParameterivEXT",
+  "glTexCoord4xvOES",
+  "glGetVariantBooleanvEXT",
+  "glDepthRange",
+  "glGetVertexAttribdvARB",
+  "glGetColorTableParameterfv",
+  "glDrawArraysInstancedEXT",
+  "glDisableClientStateIndexedEXT",
+  "glDrawBuffer",
+  "glMultiDrawArraysIndirectBindlessNV",
+  "glGetnPixelMapusv",
+  "glRasterPos3fv",
+  "glClearBufferuiv",
+  "glGetInternalformati64v",
+  "glShaderSourceARB",
+  "glShaderOp3EXT",
+  "glWindowPos2dvMESA",
+  "glClearIndex",
+  "glProvokingVertexEXT",
+  "glVariantubvEXT",
+  "glFlush",
+  "glFramebufferTexture2DEXT",
+  "glGetColorTableParameterivEXT",
+  "glPresentFrameDualFillNV",
+  "glGenVertexShadersEXT",
+  "glSpecializeShaderARB",
+  "glProgramUniformHandleui64vARB",
+  "glDepthRangefOES",
+  "glDeleteVertexArrays",
+  "glDrawElementsInstancedBaseVertexBaseInstance",
+  "glGetTexLevelParameteriv",
+  "glDrawVkImageNV",
+  "glWindowPos3iARB",
+  "glPrioritizeTextures",
+  "glWindowPos3fvMESA",
+  "glProgramUniformMatrix3x2dvEXT",
+  "glVertex4xvOES",
+  "glTexStorage3DMultisample",
+  "glWindowPos2sARB",
+  "glStencilOpValueAMD",
+  "glProgramVertexLimitNV",
+  "glGetTexParameterPointervAPPLE",
+  "glProgramUniform3uivEXT",
+  "glClampColor",
+  "glClearStencil",
+  "glTexCoordP1uiv",
+  "glVertexAttribs3svNV",
+  "glMultiTexCoord3fv",
+  "glVertexBlendEnvfATI",
+  "glIsFenceAPPLE",
+  "glGetBufferParameterui64vNV",
+  "glVertexAttribI4bvEXT",
+  "glUniform2fARB",
+  "glStopInstrumentsSGIX",
+  "glVertexAttrib3fNV",
+  "glMapVertexAttrib2dAPPLE",
+  "glVertex2f",
+  "glCopyTextureImage2DEXT",
+  "glVertex2d",
+  "glSecondaryColor3bvEXT",
+  "glMultiTexCoord4fARB",
+  "glPolygonOffset",
+  "glTangent3bvEXT",
+  "glHistogram",
+  "glGetProgramiv",
+  "glMatrixIndexubvARB",
+  "glVertex2s",
+  "glGetVertexAttribLui64vNV",
+  "glGetProgramStringARB",
+  "glFlushMappedBufferRange",
+  "glVertexAttribI3uiEXT",
+  "glLineWidthxOES",
+  "glProgramUniformMatrix2fvEXT",
+  "glGetTextureParameterIuivEXT",
+  "glGetMultiTexEnvivEXT",
+  "glPixelTexGenParameterivSGIS",
+  "glGenQueries",
+  "glGetPixelMapfv",
+  "glBlendColorEXT",
+  "glResetMinmax",
+  "glGetnUniformivARB",
+  "glVertexBlendARB",
+  "glVertexAttrib4d",
+  "glGetVaryingLocationNV",
+  "glGetMapAttribParameterivNV",
+  "glTexSubImage3D",
+  "glDeleteSamplers",
+  "glGetLightxOES",
+  "glGetVertexAttribArrayObjectfvATI",
+  "glVertexArrayNormalOffsetEXT",
+  "glGetBufferParameterivARB",
+  "glGetTextureParameterfv",
+  "glDrawMeshArraysSUN",
+  "glVertexAttrib4dNV",
+  "glGetMultisamplefvNV",
+  "glMapObjectBufferATI",
+  "glGetPathCommandsNV",
+  "glVertexArrayTexCoordOffsetEXT",
+  "glGetHistogram",
+  "glMatrixMode",
+  "glColorFormatNV",
+  "glProgramUniformui64NV",
+  "glProgramUniformMatrix4x2fvEXT",
+  "glLoadMatrixxOES",
+  "glGetColorTableParameterfvEXT",
+  "glRasterPos4i",
+  "glVertexAttribL2i64NV",
+  "glBindTextures",
+  "glMatrixRotatefEXT",
+  "glGetClipPlanexOES",
+  "glSecondaryColor3uivEXT",
+  "glGetPerfQueryInfoINTEL",
+  "glGetDoublev",
+  "glBindBufferRangeEXT",
+  "glCompressedTexImage2D",
+  "glMapBufferARB",
+  "glGetPathSpacingNV",
+  "glUniform4dv",
+  "glGlobalAlphaFactordSUN",
+  "glProgramUniform3dv",
+  "glGetShaderSourceARB",
+  "glVertexAttrib3dvARB",
+  "glInvalidateBufferData",
+  "glMatrixLoad3x2fNV",
+  "glCompressedTextureSubImage1D",
+  "glTexCoord3xvOES",
+  "glGenTexturesEXT",
+  "glTangent3iEXT",
+  "glClearTexImage",
+  "glBinormal3bvEXT",
+  "glUniform3fv",
+  "glGetnPixelMapusvARB",
+  "glMemoryObjectParameterivEXT",
+  "glGenSemaphoresEXT",
+  "glMultiTexCoordP1ui",
+  "glClearNamedBufferDataEXT",
+  "glUniformMatrix4dv",
+  "glWindowPos3fMESA",
+  "glDeleteRenderbuffers",
+  "glGetTextureLevelParameterfvEXT",
+  "glGetHistogramParameterxvOES",
+  "glMultiDrawElements",
+  "glMakeImageHandleNonResidentNV",
+  "glTexSubImage1DEXT",
+  "glNormalStream3dATI",
+  "glVertexAttribL4i64vNV",
+  "glDrawBuffers",
+  "glCopyTextureSubImage1DEXT",
+  "glWindowRectanglesEXT",
+  "glNamedFramebufferReadBuffer",
+  "glUniform2i64vARB",
+  "glVertexAttribI1uivEXT",
+  "glGetTexGenfv",
+  "glBeginQueryARB",
+  "glUniform1iARB",
+  "glVertex4bvOES",
+  "glInvalidateSubFramebuffer",
+  "glUniform1fvARB",
+  "glTestFenceNV",
+  "glBindTransformFeedback",
+  "glMultiTexCoord2iv",
+  "glCopyMultiTexSubImage1DEXT",
+  "glVariantbvEXT",
+  "glTexCoord1hNV",
+  "glGenFencesNV",
+  "glRasterPos3iv",
+  "glVertexAttribL2ui64NV",
+  "glMultiTexCoord1hvNV",
+  "glGetnConvolutionFilter",
+  "glNormal3bv",
+  "glWeightbvARB",
+  "glTexCoord4sv",
+  "glUniform2uiv",
+  "glBeginConditionalRenderNVX",
+  "glFinish",
+  "glColorTableParameterfv",
+  "glFragmentCoverageColorNV",
+  "glProgramUniform3ivEXT",
+  "glVertexArrayVertexOffsetEXT",
+  "glViewportPositionWScaleNV",
+  "glGetProgramLocalParameterIuivNV",
+  "glReplacementCodeuiTexCoord2fVertex3fvSUN",
+  "glUniform1uiv",
+  "glUniformMatrix2dv",
+  "glIndexdv",
+  "glSecondaryColor3ivEXT",
+  "glTexCoord3iv",
+  "glVertexStream4fvATI",
+  "glDeformationMap3fSGIX",
+  "glClearDepth",
+  "glGenAsyncMarkersSGIX",
+  "glDisableIndexedEXT",
+  "glVertexWeightfvEXT",
+  "glGetProgramLocalParameterIivNV",
+  "glCompressedTexImage3DARB",
+  "glProgramParameter4fNV",
+  "glConvolutionParameterxOES",
+  "glInsertComponentEXT",
+  "glCreateTextures",
+  "glSecondaryColor3iv",
+  "glCreateBuffers",
+  "glMultiTexCoord2xvOES",
+  "glTexGenxvOES",
+  "glMultTransposeMatrixf",
+  "glBeginTransformFeedbackEXT",
+  "glTexCoord2fColor3fVertex3fSUN",
+  "glNormal3sv",
+  "glFreeObjectBufferATI",
+  "glBlendBarrierNV",
+  "glUniform4i64vNV",
+  "glGetnUniformuivARB",
+  "glAlphaFragmentOp3ATI",
+  "glProgramEnvParameters4fvEXT",
+  "glBlendFuncSeparateEXT",
+  "glConvolutionParameterivEXT",
+  "glPixelTexGenSGIX",
+  "glDeleteProgram",
+  "glUniformMatrix4x3dv",
+  "glGetVideoCaptureStreamivNV",
+  "glProgramUniform4uiEXT",
+  "glMakeImageHandleNonResidentARB",
+  "glSecondaryColor3dEXT",
+  "glDeleteQueries",
+  "glNormalP3uiv",
+  "glRasterPos2d",
+  "glInitNames",
+  "glBinormal3fvEXT",
+  "glColor3dv",
+  "glVertexArrayVertexAttribDivisorEXT",
+  "glArrayElementEXT",
+  "glProgramParameter4dNV",
+  "glIndexxOES",
+  "glUniform3uivEXT",
+  "glPopGroupMarkerEXT",
+  "glClearNamedFramebufferuiv",
+  "glSetLocalConstantEXT",
+  "glProgramUniform1ui64NV",
+  "glColor4hvNV",
+  "glGetVertexAttribfv",
+  "glDispatchCompute",
+  "glGetActiveAttrib",
+  "glFragmentColorMaterialSGIX",
+  "glTexSubImage2D",
+  "glGetnMinmaxARB",
+  "glLogicOp",
+  "glProgramUniformMatrix3x4fv",
+  "glWindowPos4iMESA",
+  "glPixelTransferf",
+  "glGetTextureParameterIuiv",
+  "glMultiTexCoord1xOES",
+  "glProgramUniformMatrix4dv",
+  "glGetnUniformiv",
+  "glFramebufferTexture1DEXT",
+  "glVertexPointervINTEL",
+  "glTextureParameterIiv",
+  "glGetSeparableFilterEXT",
+  "glMultiTexCoord3iARB",
+  "glRasterPos4xvOES",
+  "glDrawTransformFeedbackStream",
+  "glVertex3hvNV",
+  "glVertexArrayMultiTexCoordOffsetEXT",
+  "glProvokingVertex",
+  "glAccumxOES",
+  "glShaderBinary",
+  "glGetMultiTexGenivEXT",
+  "glPointParameterxvOES",
+  "glCreateStatesNV",
+  "glClearDepthdNV",
+  "glClearColorIuiEXT",
+  "glBindMultiTextureEXT",
+  "glTexGeniv",
+  "glDrawElements",
+  "glProgramUniform4iv",
+  "glDisableVertexArrayEXT",
+  "glProgramUniform3ui64NV",
+  "glClientActiveTexture",
+  "glMultiTexParameterIivEXT",
+  "glUniform1i64ARB",
+  "glUniform1iv",
+  "glMulticastBarrierNV",
+  "glVertexAttribArrayObjectATI",
+  "glUniform2iARB",
+  "glDrawArraysInstanced",
+  "glVertexAttrib2sNV",
+  "glTexBufferEXT",
+  "glVertexStream2fATI",
+  "glDebugMessageCallbackAMD",
+  "glSamplerParameteriv",
+  "glVertexAttrib4uiv",
+  "glEndQueryIndexed",
+  "glNormalStream3sATI",
+  "glProgramParameteriARB",
+  "glTexEnvxOES",
+  "glProgramUniform1iv",
+  "glDisableVertexAttribAPPLE",
+  "glBindRenderbuffer",
+  "glMultiTexSubImage3DEXT",
+  "glIsProgram",
+  "glMultiDrawElementsIndirectAMD",
+  "glGetProgramInfoLog",
+  "glGetLocalConstantBooleanvEXT",
+  "glPixelTransformParameteriEXT",
+  "glTexCoord4bOES",
+  "glVertexAttrib4fv",
+  "glProgramUniformMatrix2x3dv",
+  "glProgramEnvParametersI4uivNV",
+  "glTexCoord3xOES",
+  "glLoadTransposeMatrixfARB",
+  "glImageTransformParameteriHP",
+  "glMultiTexCoord4xOES",
+  "glVertexAttribs3fvNV",
+  "glVertexAttrib2fv",
+  "glUniform3ui64NV",
+  "glCombinerParameterfvNV",
+  "glFragmentMaterialiSGIX",
+  "glGetBooleani_v",
+  "glGetProgramResourceIndex",
+  "glBeginConditionalRenderNV",
+  "glDisableClientState",
+  "glPathFogGenNV",
+  "glStencilThenCoverFillPathNV",
+  "glVertexArrayIndexOffsetEXT",
+  "glProgramBufferParametersIuivNV",
+  "glPixelTransformParameterivEXT",
+  "glDisableClientStateiEXT",
+  "glTexBufferARB",
+  "glGetLocalConstantIntegervEXT",
+  "glColor4uiv",
+  "glProgramUniform3i",
+  "glMultiDrawElementsIndirectBindlessCountNV",
+  "glGetBufferPointervARB",
+  "glMultiTexParameterIuivEXT",
+  "glEvalMesh2",
+  "glEvalMesh1",
+  "glProgramUniform3f",
+  "glStencilThenCoverFillPathInstancedNV",
+  "glProgramUniform3d",
+  "glMapVertexAttrib1dAPPLE",
+  "glEvalCoord2fv",
+  "glGetUniformivARB",
+  "glLoadTransposeMatrixd",
+  "glLoadTransposeMatrixf",
+  "glGetPointervEXT",
+  "glSignalVkSemaphoreNV",
+  "glEndConditionalRenderNV",
+  "glTexCoord2fNormal3fVertex3fSUN",
+  "glUniform3i64vARB",
+  "glProgramUniform2uiEXT",
+  "glVertexAttribI1ui",
+  "glProgramNamedParameter4dvNV",
+  "glCompileCommandListNV",
+  "glGetRenderbufferParameterivEXT",
+  "glGetnPolygonStipple",
+  "glIsBufferResidentNV",
+  "glSecondaryColor3ubvEXT",
+  "glGetNamedRenderbufferParameterivEXT",
+  "glNamedFramebufferSampleLocationsfvARB",
+  "glMultiTexGendvEXT",
+  "glVertexArrayRangeNV",
+  "glIsTextureHandleResidentNV",
+  "glGetProgramEnvParameterdvARB",
+  "glIsNamedStringARB",
+  "glSecondaryColorFormatNV",
+  "glVertexAttrib4ubvNV",
+  "glTagSampleBufferSGIX",
+  "glVDPAUUnregisterSurfaceNV",
+  "glGetPerfQueryIdByNameINTEL",
+  "glGetInteger64v",
+  "glClipPlane",
+  "glColor4ubVertex3fSUN",
+  "glIndexub",
+  "glGetProgramEnvParameterfvARB",
+  "glVertexAttrib4usvARB",
+  "glNamedFramebufferRenderbuffer",
+  "glProgramUniformMatrix3x4dv",
+  "glTestFenceAPPLE",
+  "glVertexAttrib4Niv",
+  "glVertexAttribL2i64vNV",
+  "glColorP4uiv",
+  "glUniformMatrix2x3fv",
+  "glCallCommandListNV",
+  "glClearBufferiv",
+  "glNamedStringARB",
+  "glMatrixMult3x2fNV",
+  "glGetNamedProgramStringEXT",
+  "glGetnHistogramARB",
+  "glGetTextureLevelParameterfv",
+  "glMultiTexCoord1fv",
+  "glBitmapxOES",
+  "glGetSamplerParameterIuiv",
+  "glTexCoordP3ui",
+  "glTextureSubImage1D",
+  "glVertexAttribLPointerEXT",
+  "glFogCoordPointerEXT",
+  "glWindowPos3s",
+  "glVertexAttribs2svNV",
+  "glTextureImage3DEXT",
+  "glWindowPos3i",
+  "glWindowPos3d",
+  "glWindowPos3f",
+  "glIsEnabledIndexedEXT",
+  "glGetNamedProgramivEXT",
+  "glVertex3xvOES",
+  "glColor3us",
+  "glBeginPerfMonitorAMD",
+  "glProgramUniformMatrix4x3dv",
+  "glGetNamedProgramLocalParameterIuivEXT",
+  "glReadnPixels",
+  "glMultiTexCoord4f",
+  "glColor3ub",
+  "glMultiTexCoord4d",
+  "glVertexAttribL3ui64NV",
+  "glColor3ui",
+  "glProgramUniform4fvEXT",
+  "glVertexAttrib2sARB",
+  "glMultiTexCoord4i",
+  "glCheckFramebufferStatusEXT",
+  "glGetnMapivARB",
+  "glMultiTexCoord1ivARB",
+  "glDisableVertexAttribArrayARB",
+  "glGetPolygonStipple",
+  "glVertexAttribI4ui",
+  "glGetPathDashArrayNV",
+  "glMultiTexRenderbufferEXT",
+  "glCopyTextureSubImage1D",
+  "glDeleteOcclusionQueriesNV",
+  "glVertex4hvNV",
+  "glGetnTexImage",
+  "glProgramLocalParameter4dARB",
+  "glBlendEquation",
+  "glUnlockArraysEXT",
+  "glGetQueryObjectui64vEXT",
+  "glVertexAttribI4uivEXT",
+  "glUniform1i64vNV",
+  "glMultiTexCoord3dv",
+  "glColor4sv",
+  "glVertexStream4ivATI",
+  "glPopClientAttrib",
+  "glClearBufferData",
+  "glGetProgramivNV",
+  "glBeginTransformFeedback",
+  "glFinishObjectAPPLE",
+  "glGetMinmaxParameterivEXT",
+  "glColor3iv",
+  "glVertexAttrib3sv",
+  "glCompressedTexImage1D",
+  "glDeleteTransformFeedbacks",
+  "glGetVideoi64vNV",
+  "glDrawRangeElementsBaseVertex",
+  "glUniform4i64vARB",
+  "glTextureStorage3DMultisampleEXT",
+  "glGetTexParameterfv",
+  "glProgramUniformui64vNV",
+  "glCompressedMultiTexImage1DEXT",
+  "glProgramUniform2ivEXT",
+  "glPushGroupMarkerEXT",
+  "glVertexAttrib1dv",
+  "glMatrixLoadIdentityEXT",
+  "glMultTransposeMatrixxOES",
+  "glGetPixelMapxv",
+  "glFramebufferSampleLocationsfvARB",
+  "glGetLightiv",
+  "glBlendFuncSeparatei",
+  "glAcquireKeyedMutexWin32EXT",
+  "glGetBooleanIndexedvEXT",
+  "glGetProgramSubroutineParameteruivNV",
+  "glUniform2ui",
+  "glApplyFramebufferAttachmentCMAAINTEL",
+  "glWindowPos2fv",
+  "glWaitVkSemaphoreNV",
+  "glDisablei",
+  "glSelectPerfMonitorCountersAMD",
+  "glGetVertexAttribLi64vNV",
+  "glBlendFuncSeparateiARB",
+  "glWeightuivARB",
+  "glWindowPos2iARB",
+  "glGetProgramLocalParameterdvARB",
+  "glGetUniformui64vARB",
+  "glSecondaryColor3us",
+  "glGetSynciv",
+  "glMakeImageHandleResidentARB",
+  "glGetProgramNamedParameterfvNV",
+  "glTextureStorage3D",
+  "glVertexAttrib4svNV",
+  "glProgramUniform2i",
+  "glListDrawCommandsStatesClientNV",
+  "glProgramLocalParametersI4uivNV",
+  "glBeginTransformFeedbackNV",
+  "glGetProgramBinary",
+  "glBinormal3iEXT",
+  "glEvalPoint1",
+  "glEvalPoint2",
+  "glPauseTransformFeedback",
+  "glWindowPos2sMESA",
+  "glGlobalAlphaFactorbSUN",
+  "glCreateTransformFeedbacks",
+  "glTexturePageCommitmentEXT",
+  "glTransformFeedbackVaryingsNV",
+  "glTexSubImage1D",
+  "glConvolutionParameterfvEXT",
+  "glBlitFramebufferEXT",
+  "glUniformMatrix4fvARB",
+  "glProgramEnvParameter4dvARB",
+  "glTextureStorageMem2DEXT",
+  "glVertexAttribP3uiv",
+  "glFogCoordFormatNV",
+  "glGetMultiTexLevelParameterivEXT",
+  "glIsOcclusionQueryNV",
+  "glCompressedTexImage2DARB",
+  "glGetProgramEnvParameterIuivNV",
+  "glVertexAttrib4sv",
+  "glVertexAttrib4fvARB",
+  "glLoadName",
+  "glBindVertexShaderEXT",
+  "glGetNamedProgramLocalParameterIivEXT",
+  "glProgramUniform3uiEXT",
+  "glProgramUniformMatrix4x2dvEXT",
+  "glTexCoord1hvNV",
+  "glLoadMatrixd",
+  "glTexParameterfv",
+  "glVariantdvEXT",
+  "glCullParameterfvEXT",
+  "glUniform3dv",
+  "glProgramUniform3fv",
+  "glIsBufferARB",
+  "glMultiTexCoord1bOES",
+  "glFogCoordhNV",
+  "glFramebufferSampleLocationsfvNV",
+  "glGenSymbolsEXT",
+  "glGetConvolutionFilter",
+  "glProgramUniform1fvEXT",
+  "glGetNextPerfQueryIdINTEL",
+  "glCompressedTexImage1DARB",
+  "glBindSamplers",
+  "glGetProgramEnvParameterIivNV",
+  "glGetQueryObjectui64v",
+  "glVertexAttribL4ui64vNV",
+  "glGetVideoivNV",
+  "glGetTextureImage",
+  "glProgramUniform1fv",
+  "glUniformMatrix4fv",
+  "glColorMask",
+  "glBeginFragmentShaderATI",
+  "glMultiDrawArraysEXT",
+  "glGenNamesAMD",
+  "glPathParameteriNV",
+  "glCreateCommandListsNV",
+  "glDeleteProgramPipelines",
+  "glCopyColorSubTableEXT",
+  "glVariantsvEXT",
+  "glGenProgramPipelines",
+  "glVertexArrayEdgeFlagOffsetEXT",
+  "glWindowPos2s",
+  "glSecondaryColor3iEXT",
+  "glWindowPos2i",
+  "glWindowPos2f",
+  "glWindowPos2d",
+  "glUniform4uivEXT",
+  "glOrthoxOES",
+  "glUniformSubroutinesuiv",
+  "glRectdv",
+  "glProgramUniform1i64vNV",
+  "glVertexAttribI4uiEXT",
+  "glSecondaryColor3ubEXT",
+  "glCompressedMultiTexSubImage1DEXT",
+  "glMultiTexGendEXT",
+  "glColorP3uiv",
+  "glFogCoordfv",
+  "glCompileShader",
+  "glTexCoord2hNV",
+  "glUniform1uivEXT",
+  "glMatrixLoadTransposedEXT",
+  "glIndexfv",
+  "glGetCompressedTextureImage",
+  "glGetUniformuivEXT",
+  "glGetnPixelMapfvARB",
+  "glFramebufferTextureEXT",
+  "glMultiDrawElementsIndirectCount",
+  "glVertexAttribIPointer",
+  "glMultiTexCoordP3ui",
+  "glEvaluateDepthValuesARB",
+  "glGetNamedBufferParameteriv",
+  "glGetNamedProgramLocalParameterfvEXT",
+  "glColor4fNormal3fVertex3fvSUN",
+  "glSeparableFilter2DEXT",
+  "glTexParameterxOES",
+  "glClearAccumxOES",
+  "glInvalidateFramebuffer",
+  "glWeightubvARB",
+  "glVertexAttrib1d",
+  "glVertexAttrib1f",
+  "glVertex4fv",
+  "glClearNamedFramebufferfi",
+  "glGetQueryBufferObjectuiv",
+  "glClearNamedFramebufferfv",
+  "glEndVertexShaderEXT",
+  "glVertexAttrib1s",
+  "glMultiTexCoord4dvARB",
+  "glMultiTexCoord1sv",
+  "glUniform1ui64vNV",
+  "glGetClipPlanefOES",
+  "glRasterPos2s",
+  "glWeightivARB",
+  "glMultiTexCoord4hvNV",
+  "glNormal3hNV",
+  "glGetSeparableFilter",
+  "glGetPathTexGenivNV",
+  "glColor4bv",
+  "glRasterPos2f",
+  "glNamedBufferPageCommitmentARB",
+  "glLoadIdentity",
+  "glRasterPos2i",
+  "glRasterPos4iv",
+  "glMultiTexCoord2fvARB",
+  "glUniformMatrix4x3fv",
+  "glClearBufferfv",
+  "glMultiTexCoord4hNV",
+  "glTextureBarrier",
+  "glReplacementCodeuivSUN",
+  "glDeleteAsyncMarkersSGIX",
+  "glTexCoord2bvOES",
+  "glEvalCoord2xOES",
+  "glGetSharpenTexFuncSGIS",
+  "glProgramUniformHandleui64vNV",
+  "glIglooInterfaceSGIX",
+  "glWindowPos2dvARB",
+  "glClearBufferfi",
+  "glDrawArraysIndirect",
+  "glGenVertexArrays",
+  "glGetTransformFeedbacki64_v",
+  "glEnableVertexArrayAttrib",
+  "glProgramUniformMatrix3x2dv",
+  "glVertexStream4fATI",
+  "glVertexBindingDivisor",
+  "glGetSamplerParameterIiv",
+  "glGetCoverageModulationTableNV",
+  "glDepthRangedNV",
+  "glVertexAttrib3f",
+  "glMultiDrawRangeElementArrayAPPLE",
+  "glVertexAttribFormatNV",
+  "glGetQueryBufferObjecti64v",
+  "glGetVertexAttribdv",
+  "glGetUniformi64vARB",
+  "glAreTexturesResidentEXT",
+  "glGetHandleARB",
+  "glVideoCaptureStreamParameterdvNV",
+  "glMapParameterivNV",
+  "glIsVertexArray",
+  "glSecondaryColor3sEXT",
+  "glGetTexParameterIivEXT",
+  "glFrameTerminatorGREMEDY",
+  "glBlendBarrierKHR",
+  "glVertexAttrib4NubARB",
+  "glPrimitiveRestartNV",
+  "glVertexAttribL1ui64vARB",
+  "glVertexAttribI4ivEXT",
+  "glVertexAttribs4svNV",
+  "glUniform1ui",
+  "glVertexAttrib2fvARB",
+  "glVertexAttribI4svEXT",
+  "glTextureImage3DMultisampleCoverageNV",
+  "glMemoryBarrier",
+  "glGetVariantArrayObjectfvATI",
+  "glTexCoord4fColor4fNormal3fVertex4fvSUN",
+  "glIsProgramARB",
+  "glBindImageTextureEXT",
+  "glGetFragDataLocation",
+  "glMultiTexCoord1svARB",
+  "glGetMapxvOES",
+  "glTextureStorage2DMultisampleEXT",
+  "glGetMaterialfv",
+  "glVertexAttrib4NbvARB",
+  "glPixelMapuiv",
+  "glColorPointerEXT",
+  "glEnableClientStateiEXT",
+  "glClearTexSubImage",
+  "glEvalCoord1xvOES",
+  "glDetachObjectARB",
+  "glGetTextureParameterIiv",
+  "glVariantusvEXT",
+  "glCompressedTextureImage3DEXT",
+  "glMultiTexCoord1dARB",
+  "glGetVertexArrayIntegeri_vEXT",
+  "glVertexAttribI4ubv",
+  "glPixelTexGenParameterfSGIS",
+  "glProgramUniformMatrix4x2dv",
+  "glUniform3fARB",
+  "glIsShader",
+  "glConvolutionParameteriv",
+  "glCopyMultiTexSubImage2DEXT",
+  "glEnableVertexAttribArrayARB",
+  "glMulticastCopyBufferSubDataNV",
+  "glEnable",
+  "glGetActiveUniformsiv",
+  "glGetVertexAttribivARB",
+  "glTexCoord4hvNV",
+  "glUseProgramObjectARB",
+  "glGetAttribLocation",
+  "glVertexAttrib4dv",
+  "glGetTextureParameteriv",
+  "glNamedBufferStorageMemEXT",
+  "glPathSubCoordsNV",
+  "glMatrixIndexusvARB",
+  "glGetVideouivNV",
+  "glGetVideoCaptureivNV",
+  "glProgramUniform3ui",
+  "glVertexAttrib3svARB",
+  "glGetNamedBufferParameterivEXT",
+  "glMatrixScaledEXT",
+  "glProgramUniformMatrix2x3fv",
+  "glGetFragmentLightivSGIX",
+  "glGetStringi",
+  "glWindowPos2svARB",
+  "glVertexAttrib2svNV",
+  "glWindowPos2ivARB",
+  "glGetVertexAttribPointervNV",
+  "glPushMatrix",
+  "glEdgeFlagPointerListIBM",
+  "glGenerateMipmapEXT",
+  "glWindowPos3sv",
+  "glPathCoordsNV",
+  "glProgramUniform1i",
+  "glProgramUniform1d",
+  "glProgramUniform1f",
+  "glProgramParameteriEXT",
+  "glCompressedMultiTexImage2DEXT",
+  "glProgramUniform3iv",
+  "glIndexiv",
+  "glMultiTexCoord4xvOES",
+  "glEGLImageTargetTexture2DOES",
+  "glPixelZoom",
+  "glVertex3bvOES",
+  "glFramebufferReadBufferEXT",
+  "glExtractComponentEXT",
+  "glCombinerParameterivNV",
+  "glMinmax",
+  "glColorP3ui",
+  "glPointParameterfvSGIS",
+  "glBlendEquationi",
+  "glGetFogFuncSGIS",
+  "glVertexAttrib4fvNV",
+  "glGetnMinmax",
+  "glFragmentLightiSGIX",
+  "glMultiTexCoord1bvOES",
+  "glSecondaryColorPointerEXT",
+  "glMultiTexCoordP4uiv",
+  "glGetBufferSubDataARB",
+  "glSecondaryColor3hNV",
+  "glGetPathParameterivNV",
+  "glFlushRasterSGIX",
+  "glElementPointerATI",
+  "glGetAttachedObjectsARB",
+  "glUniform4iv",
+  "glFogxOES",
+  "glSharpenTexFuncSGIS",
+  "glClearDepthfOES",
+  "glDeleteCommandListsNV",
+  "glSpecializeShader",
+  "glVertex4hNV",
+  "glSecondaryColor3dvEXT",
+  "glGenTextures",
+  "glTextureStorage2DMultisample",
+  "glUniform3ui64vNV",
+  "glBlendFuncSeparateIndexedAMD",
+  "glMakeBufferResidentNV",
+  "glShaderOp2EXT",
+  "glGetVertexAttribivNV",
+  "glTexParameterIivEXT",
+  "glGetPerfQueryDataINTEL",
+  "glVertexAttrib4dvARB",
+  "glTextureSubImage1DEXT",
+  "glGetActiveUniformBlockName",
+  "glVertexAttrib2dvARB",
+  "glVertexAttribPointer",
+  "glDepthBoundsdNV",
+  "glDeleteTexturesEXT",
+  "glDrawBuffersATI",
+  "glLightModelxvOES",
+  "glApplyTextureEXT",
+  "glGetImageHandleNV",
+  "glGetMinmax",
+  "glGetFixedvOES",
+  "glSamplePatternEXT",
+  "glUniform1f",
+  "glColor4fNormal3fVertex3fSUN",
+  "glFogCoorddvEXT",
+  "glCopyTextureImage1DEXT",
+  "glFlushMappedBufferRangeAPPLE",
+  "glVertex3sv",
+  "glFlushStaticDataIBM",
+  "glProgramUniform4ui64NV",
+  "glRasterPos4xOES",
+  "glVertexAttribP1ui",
+  "glProgramUniform4dvEXT",
+  "glEndTransformFeedbackEXT",
+  "glBinormal3dEXT",
+  "glGetTextureSubImage",
+  "glGetNamedRenderbufferParameteriv",
+  "glBindBuffersRange",
+  "glFinishAsyncSGIX",
+  "glBindFragDataLocationIndexed",
+  "glMultiTexCoord2dv",
+  "glUniform2iv",
+  "glProgramUniform2i64vNV",
+  "glFlushVertexArrayRangeAPPLE",
+  "glTextureParameterf",
+  "glMultiTexCoord3dvARB",
+  "glFeedbackBuffer",
+  "glDebugMessageInsertARB",
+  "glMultiTexCoord2i",
+  "glTextureSubImage3D",
+  "glFramebufferTexture1D",
+  "glGetShaderiv",
+  "glMultiTexCoord2d",
+  "glArrayObjectATI",
+  "glGetPointeri_vEXT",
+  "glGetPerfMonitorCountersAMD",
+  "glNamedBufferStorage",
+  "glTexEnvxvOES",
+  "glProgramUniform2ui64NV",
+  "glMultiTexCoord3bOES",
+  "glUniform1dv",
+  "glPixelTransferi",
+  "glSecondaryColor3usvEXT",
+  "glProgramEnvParameterI4uivNV",
+  "glVertex2sv",
+  "glWindowPos4dMESA",
+  "glDebugMessageControlARB",
+  "glIsTextureEXT",
+  "glFragmentMaterialivSGIX",
+  "glLinkProgramARB",
+  "glFinishFenceAPPLE",
+  "glVertexArrayVertexAttribBindingEXT",
+  "glTexStorageMem3DMultisampleEXT",
+  "glUniform1ui64vARB",
+  "glMultiTexCoord4fv",
+  "glMulticastFramebufferSampleLocationsfvNV",
+  "glRasterPos3d",
+  "glPollAsyncSGIX",
+  "glRasterPos3f",
+  "glCompressedTexImage3D",
+  "glVariantivEXT",
+  "glUnmapTexture2DINTEL",
+  "glMulticastWaitSyncNV",
+  "glGetVertexAttribiv",
+  "glGetPathCoordsNV",
+  "glColor4xvOES",
+  "glVertexAttrib3fv",
+  "glRasterPos3s",
+  "glVertex4bOES",
+  "glTransformFeedbackVaryingsEXT",
+  "glCombinerOutputNV",
+  "glWindowPos4sMESA",
+  "glVertexAttrib4svARB",
+  "glIsList",
+  "glGetInfoLogARB",
+  "glUniformMatrix2fv",
+  "glVertexAttribs3dvNV",
+  "glGlobalAlphaFactorsSUN",
+  "glGetTrackMatrixivNV",
+  "glTextureParameterfvEXT",
+  "glIsNamedBufferResidentNV",
+  "glProgramUniform4ui64vARB",
+  "glTbufferMask3DFX",
+  "glCoverFillPathNV",
+  "glVertexAttrib1fvARB",
+  "glGenerateTextureMipmap",
+  "glNamedProgramLocalParameterI4uivEXT",
+  "glMultiDrawElementsBaseVertex",
+  "glProgramSubroutineParametersuivNV",
+  "glProgramUniformMatrix2x4dvEXT",
+  "glRotatexOES",
+  "glMemoryBarrierEXT",
+  "glVertexAttrib3svNV",
+  "glVertexStream3iATI",
+  "glCompressedTexSubImage1D",
+  "glSetFenceNV",
+  "glAttachObjectARB",
+  "glCopyConvolutionFilter1D",
+  "glTexStorageMem2DMultisampleEXT",
+  "glProgramParameters4fvNV",
+  "glNamedFramebufferParameteriEXT",
+  "glVertexAttrib4Nsv",
+  "glVertexAttribI4usvEXT",
+  "glTextureBufferRangeEXT",
+  "glVertexP3uiv",
+  "glIsPathNV",
+  "glGetnUniformi64vARB",
+  "glFramebufferTextureMultiviewOVR",
+  "glCompressedMultiTexSubImage2DEXT",
+  "glGetnMapdv",
+  "glDebugMessageCallback",
+  "glTangent3svEXT",
+  "glVertexAttribParameteriAMD",
+  "glBufferSubDataARB",
+  "glGetVertexAttribLui64vARB",
+  "glVertexAttribL4ui64NV",
+  "glReplacementCodeuiColor4ubVertex3fSUN",
+  "glImageTransformParameterfHP",
+  "glMap1f",
+  "glRasterPos4fv",
+  "glVertex2bvOES",
+  "glGetMapControlPointsNV",
+  "glNamedProgramLocalParametersI4ivEXT",
+  "glBindBufferRangeNV",
+  "glVertexStream3dvATI",
+  "glNormalPointerListIBM",
+  "glFogFuncSGIS",
+  "glMultiModeDrawArraysIBM",
+  "glGetNamedFramebufferAttachmentParameterivEXT",
+  "glGetFloatv",
+  "glVertexArrayVertexAttribIFormatEXT",
+  "glHint",
+  "glVertexStream2svATI",
+  "glMultiDrawArraysIndirect",
+  "glMultiTexEnvfvEXT",
+  "glVertexAttribP2uiv",
+  "glProgramUniform1i64vARB",
+  "glFramebufferTextureARB",
+  "glPushClientAttribDefaultEXT",
+  "glScalef",
+  "glScaled",
+  "glGetConvolutionParameterxvOES",
+  "glGetProgramResourceName",
+  "glCopyColorTable",
+  "glDepthRangeArrayv",
+  "glCoverFillPathInstancedNV",
+  "glMultiTexParameterivEXT",
+  "glGetActiveAtomicCounterBufferiv",
+  "glStencilOpSeparate",
+  "glVertexAttrib4fNV",
+  "glGetColorTableParameterivSGI",
+  "glVertexArrayAttribBinding",
+  "glIsSemaphoreEXT",
+  "glProgramParameters4dvNV",
+  "glVertexAttribL4dv",
+  "glGetTexParameteriv",
+  "glGetUniformOffsetEXT",
+  "glGetVertexAttribPointerv",
+  "glResumeTransformFeedbackNV",
+  "glProgramUniform3i64vNV",
+  "glTangent3fEXT",
+  "glGetPathMetricRangeNV",
+  "glWindowPos2iMESA",
+  "glVertex2xvOES",
+  "glGetnCompressedTexImage",
+  "glWindowPos2dv",
+  "glReplacementCodeuiVertex3fSUN",
+  "glGetTransformFeedbackVaryingEXT",
+  "glWindowPos3fARB",
+  "glMapNamedBufferEXT",
+  "glDisable",
+  "glIsPointInFillPathNV",
+  "glVertexAttribI2uiEXT",
+  "glProgramUniform4uiv",
+  "glQueryCounter",
+  "glFramebufferRenderbufferEXT",
+  "glBinormal3svEXT",
+  "glBindBufferOffsetNV",
+  "glCopyTextureSubImage2D",
+  "glGetProgramResourcefvNV",
+  "glBinormalPointerEXT",
+  "glGetLightfv",
+  "glMulticastCopyImageSubDataNV",
+  "glVertex2bOES",
+  "glUniform2ivARB",
+  "glMultiTexCoord3s",
+  "glGetHistogramParameterfvEXT",
+  "glGetProgramStringNV",
+  "glGetTexGenxvOES",
+  "glTextureSubImage2D",
+  "glObjectPurgeableAPPLE",
+  "glColorTableSGI",
+  "glCopyConvolutionFilter2DEXT",
+  "glMultiTexCoord3f",
+  "glMultiTexCoord3d",
+  "glFogCoorddv",
+  "glGetBufferPointerv",
+  "glProgramUniform1fEXT",
+  "glWindowPos2fvMESA",
+  "glAlphaToCoverageDitherControlNV",
+  "glPolygonOffsetxOES",
+  "glVertexAttrib4dARB",
+  "glUniformHandleui64vARB",
+  "glFragmentLightModelfvSGIX",
+  "glSwizzleEXT",
+  "glBindFragmentShaderATI",
+  "glVertexAttribs3hvNV",
+  "glGenBuffersARB",
+  "glTextureStorageMem2DMultisampleEXT",
+  "glListParameterfvSGIX",
+  "glNamedRenderbufferStorageMultisample",
+  "glVertexAttribI1iEXT",
+  "glMultiTexCoord2ivARB",
+  "glLightModelxOES",
+  "glColor3xOES",
+  "glReadBuffer",
+  "glStencilFillPathInstancedNV",
+  "glVDPAUUnmapSurfacesNV",
+  "glProgramUniform4i64NV",
+  "glVertexStream4dvATI",
+  "glIsQuery",
+  "glProgramUniformMatrix4fvEXT",
+  "glVertexAttrib3hNV",
+  "glFlushMappedNamedBufferRange",
+  "glPushName",
+  "glGetClipPlane",
+  "glVertex4dv",
+  "glVertexAttrib3d",
+  "glBlendColor",
+  "glBindTransformFeedbackNV",
+  "glSamplerParameterIuiv",
+  "glIndexubv",
+  "glNamedBufferPageCommitmentEXT",
+  "glCheckNamedFramebufferStatus",
+  "glGetObjectBufferfvATI",
+  "glRasterPos4d",
+  "glRasterPos4f",
+  "glGetPerfMonitorCounterStringAMD",
+  "glVertexAttrib3s",
+  "glDrawElementsInstancedEXT",
+  "glNamedProgramLocalParameterI4iEXT",
+  "glRasterPos4s",
+  "glGetProgramStageiv",
+  "glGetMaterialxOES",
+  "glPopMatrix",
+  "glGetVideoui64vNV",
+  "glTangent3bEXT",
+  "glGetGraphicsResetStatusARB",
+  "glUniform4i",
+  "glActiveTexture",
+  "glEnableVertexAttribArray",
+  "glTexCoord4fVertex4fvSUN",
+  "glUniform4d",
+  "glUniform4f",
+  "glRenderbufferStorageMultisample",
+  "glCreateProgramPipelines",
+  "glVertexAttribLPointer",
+  "glUniform2uiEXT",
+  "glMultiTexCoord3sv",
+  "glDrawElementsInstancedBaseVertex",
+  "glPixelTransformParameterfvEXT",
+  "glDrawTransformFeedbackNV",
+  "glTextureImage2DMultisampleCoverageNV",
+  "glNamedRenderbufferStorageMultisampleCoverageEXT",
+  "glIsTexture",
+  "glMultiTexCoord4iv",
+  "glTexEnvfv",
+  "glPopDebugGroup",
+  "glUniformBlockBinding",
+  "glWindowPos2svMESA",
+  "glGenerateTextureMipmapEXT",
+  "glBindLightParameterEXT",
+  "glTexCoord3bOES",
+  "glTexCoordPointer",
+  "glProgramUniformMatrix3x2fv",
+  "glUniform2fvARB",
+  "glProgramLocalParameterI4uivNV",
+  "glFlushVertexArrayRangeNV",
+  "glSecondaryColor3svEXT",
+  "glGetBufferParameteriv",
+  "glGetQueryIndexediv",
+  "glFramebufferTexture3DEXT",
+  "glLoadTransposeMatrixxOES",
+  "glDeleteTransformFeedbacksNV",
+  "glGetCompressedTextureImageEXT",
+  "glIndexMaterialEXT",
+  "glFogCoorddEXT",
+  "glTexCoord2hvNV",
+  "glGetFramebufferParameterfvAMD",
+  "glTexEnviv",
+  "glEndTransformFeedbackNV",
+  "glGlobalAlphaFactoruiSUN",
+  "glSelectBuffer",
+  "glNamedBufferSubDataEXT",
+  "glDisableVertexArrayAttrib",
+  "glBlendFunc",
+  "glCreateProgram",
+  "glVertexStream2dATI",
+  "glUniform4ui64vARB",
+  "glGetSemaphoreParameterui64vEXT",
+  "glPrimitiveRestartIndex",
+  "glNormalStream3fATI",
+  "glProgramUniformMatrix2fv",
+  "glVertexAttribs1hvNV",
+  "glWindowPos4svMESA",
+  "glDeleteFragmentShaderATI",
+  "glBindImageTextures",
+  "glMap2xOES",
+  "glEnd",
+  "glMultiTexCoord2dARB",
+  "glUniform1i64NV",
+  "glPathStringNV",
+  "glGetNamedFramebufferParameterivEXT",
+  "glGetProgramNamedParameterdvNV",
+  "glPathDashArrayNV",
+  "glUniform3uiv",
+  "glColor3fVertex3fvSUN",
+  "glMultTransposeMatrixd",
+  "glClearColor",
+  "glGetImageHandleARB",
+  "glTangent3dEXT",
+  "glGetQueryObjectivARB",
+  "glGetLocalConstantFloatvEXT",
+  "glUseShaderProgramEXT",
+  "glBindRenderbufferEXT",
+  "glInterleavedArrays",
+  "glGetPerfMonitorGroupStringAMD",
+  "glUniform3ui",
+  "glGetNamedProgramLocalParameterdvEXT",
+  "glDeleteQueryResourceTagNV",
+  "glVertexAttribI4uiv",
+  "glVertexAttrib4bv",
+  "glMultiTexCoord3xOES",
+  "glSecondaryColor3ub",
+  "glFragmentMaterialfSGIX",
+  "glGetVariantArrayObjectivATI",
+  "glSecondaryColor3ui",
+  "glVertexAttrib1dARB",
+  "glGetNamedBufferPointerv",
+  "glLockArraysEXT",
+  "glVertexAttribPointerNV",
+  "glConvolutionParameterf",
+  "glBindBufferBaseEXT",
+  "glTexCoord2xvOES",
+  "glGetQueryBufferObjectui64v",
+  "glSetMultisamplefvAMD",
+  "glPathColorGenNV",
+  "glVertexAttrib3sARB",
+  "glVertexAttrib4ivARB",
+  "glGenTransformFeedbacks",
+  "glGetVertexAttribIuiv",
+  "glPixelTransformParameterfEXT",
+  "glGetTexParameterIuivEXT",
+  "glGetObjectParameterivARB",
+  "glVertexArraySecondaryColorOffsetEXT",
+  "glWindowPos2fARB",
+  "glCompressedTexSubImage2D",
+  "glCompressedTexSubImage3DARB",
+  "glProgramBinary",
+  "glPresentFrameKeyedNV",
+  "glVertexAttribI4bv",
+  "glPathCoverDepthFuncNV",
+  "glTransformFeedbackStreamAttribsNV",
+  "glSecondaryColor3usEXT",
+  "glCopyColorTableSGI",
+  "glProgramEnvParameter4fvARB",
+  "glMultiTexCoord4sARB",
+  "glGetVertexArrayIndexed64iv",
+  "glMatrixMultTranspose3x3fNV",
+  "glTexParameterIiv",
+  "glVertexArrayAttribFormat",
+  "glEndTransformFeedback",
+  "glDrawCommandsStatesAddressNV",
+  "glUniform4ui64NV",
+  "glMaterialiv",
+  "glTexImage2DMultisample",
+  "glBindTextureEXT",
+  "glIsBuffer",
+  "glVertexAttribI1iv",
+  "glGetFinalCombinerInputParameterfvNV",
+  "glMultiTexCoord3bvOES",
+  "glVertexAttribDivisor",
+  "glCopyBufferSubData",
+  "glBindTexGenParameterEXT",
+  "glNormalStream3bATI",
+  "glTexStorageMem2DEXT",
+  "glTextureImage2DEXT",
+  "glGetColorTableParameteriv",
+  "glActiveTextureARB",
+  "glTexCoord4xOES",
+  "glNamedBufferStorageExternalEXT",
+  "glSecondaryColor3fvEXT",
+  "glUniformMatrix4x2fv",
+  "glStartInstrumentsSGIX",
+  "glProgramNamedParameter4fvNV",
+  "glEndVideoCaptureNV",
+  "glGenLists",
+  "glUniform1fARB",
+  "glNamedFramebufferTexture1DEXT",
+  "glMapBufferRange",
+  "glMultiDrawElementsIndirectCountARB",
+  "glProgramUniformMatrix4x2fv",
+  "glGetTextureParameterIivEXT",
+  "glMultiTexCoord3hNV",
+  "glNamedProgramLocalParametersI4uivEXT",
+  "glEndList",
+  "glTexCoord2fColor4fNormal3fVertex3fSUN",
+  "glGenTransformFeedbacksNV",
+  "glEdgeFlagv",
+  "glVertexAttribI2iv",
+  "glCopyMultiTexImage2DEXT",
+  "glUniformMatrix3x2dv",
+  "glTexImage3DMultisampleCoverageNV",
+  "glGetShaderPrecisionFormat",
+  "glTexSubImage4DSGIS",
+  "glRasterSamplesEXT",
+  "glTextureView",
+  "glEvalMapsNV",
+  "glGetFragDataLocationEXT",
+  "glGetCompressedMultiTexImageEXT",
+  "glIndexMask",
+  "glPushClientAttrib",
+  "glShaderSource",
+  "glDispatchComputeGroupSizeARB",
+  "glLGPUNamedBufferSubDataNVX",
+  "glGetnPixelMapfv",
+  "glTexCoordP2uiv",
+  "glUniform2f",
+  "glGetNamedBufferParameteri64v",
+  "glCommandListSegmentsNV",
+  "glTextureParameterIivEXT",
+  "glMultiTexParameterfvEXT",
+  "glProgramUniform2ui64ARB",
+  "glVertex4d",
+  "glNewObjectBufferATI",
+  "glViewportSwizzleNV",
+  "glBufferData",
+  "glTextureImage1DEXT",
+  "glGetTexParameterIiv",
+  "glCopyTexSubImage1DEXT",
+  "glVertex4f",
+  "glUniformMatrix3fvARB",
+  "glTexCoordP1ui",
+  "glPointParameterfvEXT",
+  "glUniform4fARB",
+  "glImportMemoryFdEXT",
+  "glCopyTextureSubImage3D",
+  "glMultiTexCoord2fv",
+  "glNamedFramebufferSamplePositionsfvAMD",
+  "glNormalP3ui",
+  "glDrawRangeElementArrayATI",
+  "glVertexAttribI1i",
+  "glDrawArraysInstancedARB",
+  "glEnableVertexAttribAPPLE",
+  "glGetDebugMessageLogARB",
+  "glGetPathTexGenfvNV",
+  "glNamedProgramLocalParameters4fvEXT",
+  "glQueryResourceTagNV",
+  "glVertexStream3fvATI",
+  "glFramebufferTexture3D",
+  "glCompressedTextureSubImage2DEXT",
+  "glWindowPos3dv",
+  "glCopyConvolutionFilter2D",
+  "glReadInstrumentsSGIX",
+  "glProgramUniform2dvEXT",
+  "glSamplerParameterfv",
+  "glBindBufferARB",
+  "glVertexAttrib1sNV",
+  "glGetMaterialiv",
+  "glUniform1fv",
+  "glBeginOcclusionQueryNV",
+  "glGenFencesAPPLE",
+  "glScissorIndexedv",
+  "glDisableVariantClientStateEXT",
+  "glMinmaxEXT",
+  "glNormalPointervINTEL",
+  "glNormal3s",
+  "glGetnPixelMapuiv",
+  "glNormalStream3bvATI",
+  "glGetObjectParameterivAPPLE",
+  "glNormal3i",
+  "glUniform1ivARB",
+  "glNormal3d",
+  "glUpdateObjectBufferATI",
+  "glNormal3b",
+  "glGetUniformBufferSizeEXT",
+  "glMultiTexCoord4dv",
+  "glProgramUniform3i64ARB",
+  "glVertexAttrib2d",
+  "glVertexAttrib2f",
+  "glMultiDrawElementsEXT",
+  "glVertexAttrib3dv",
+  "glMultiTexCoord2bOES",
+  "glVertexAttrib2s",
+  "glTexImage3DMultisample",
+  "glGetUniformBlockIndex",
+  "glReleaseKeyedMutexWin32EXT",
+  "glFrontFace",
+  "glEvalCoord1xOES",
+  "glDrawArraysInstancedBaseInstance",
+  "glIsPointInStrokePathNV",
+};
+FUNCTION_POINTER const functionPointers[] = {
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirectBindlessCountNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetListParameterivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayElementBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glHintPGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilMaskSeparate_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFramebufferAttachmentParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage3DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetIntegerIndexedvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4usv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexRenderbufferNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInstrumentsBufferSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameter4fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrustumxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawCommandsStatesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexs_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayBindVertexBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ubVertex2fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathGlyphsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCombinerInputParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndPerfMonitorAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstancedBaseInstance_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultTransposeMatrixdARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverStrokePathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeformSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultisamplefv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAURegisterOutputSurfaceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMinSampleShading_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverStrokePathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage2DMultisampleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportMemoryWin32HandleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTessellationFactorAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageControl_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4ubNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorMaterial_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMinSampleShadingARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3b_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUGetSurfaceivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInternalformatSampleivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4ubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NubvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixPushEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayIndexediv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlitFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragmentMaterialfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexEnvxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribLdvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeformationMap3dSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResumeTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInsertEventMarkerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTessellationModeAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawCommandsAddressNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorCounterDataAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteSemaphoresEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadProgramNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWriteMaskEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetGraphicsResetStatus_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImageTransformParameterfvHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragmentLightfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListParameterfSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightModelfSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparateATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayAttribIFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeubvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenFramebuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelMapx_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetAttachedShaders_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelTexGenParameterfvSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDebugMessageLogAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4sATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs4dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glOrthofOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewportArrayv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementArrayATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferStorageMemEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathColorGenfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3iMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferSubDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionFilter2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMemoryBarrierByRegion_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayBindingDivisor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixRotatedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsProgramNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelMapuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthBoundsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPointerv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathCommandsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetListParameterfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageInsertAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrustum_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearColorxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleMaskIndexedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompileShaderIncludeARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetArrayObjectfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4svATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoadfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadIdentityDeformationMapSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetRenderbufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedRenderbufferStorage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFragDataLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonOffsetClamp_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFenceSync_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferDrawBuffersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs4fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPauseTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjecti64vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUSurfaceAccessNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glValidateProgramPipeline_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexPageCommitmentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilStrokePathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenQueriesARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1ivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameterI4iNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenVertexArraysAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTransformFeedbackInstanced_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilThenCoverStrokePathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteVertexArraysAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferParameterui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glQueryMatrixxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3usv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTranslatexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAURegisterVideoSurfaceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferBaseNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenQueryResourceTagNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nbv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListParameteriSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendColorxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsSync_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordhvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureLayerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectPtrLabel_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2x3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferDrawBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyColorSubTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedFramebufferParameterfvAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentMaterialfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoadTranspose3x3fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteNamesAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawRangeElementsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glOrtho_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage4DSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteBuffersARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapBufferARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaterialxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTestObjectAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderbufferStorageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndFragmentShaderATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrameZoomSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLGPUInterlockNVX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3svATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathStencilFuncNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetInvariantEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexBumpParameterivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparateEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndOcclusionQueryNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScissorArrayv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCallList_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapTexture2DINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVkProcAddrNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransferxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteRenderbuffersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4fColor4fNormal3fVertex4fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnColorTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureLayerARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCombinerStageParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribLFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glElementPointerAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1fATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverageModulationNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteSync_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaxShaderCompilerThreadsARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4x2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribLOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsImageHandleResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonMode_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferSamplePositionsfvAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionFilter1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsVertexArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUseProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLineStipple_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVideoCaptureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribLFormatEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x2fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureLightEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVideoCaptureStreamBufferNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage2DMultisampleCoverageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetAttribLocationARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor4ubVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4fVertex4fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackAttribsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateShaderObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4usv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribBinding_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetShaderSource_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexImageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPointerIndexedvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsNameAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ub_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferParameteriAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInternalformativ_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4us_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLinkProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectLabel_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageCallbackARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetString_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndQuery_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrioritizeTexturesxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlagPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiModeDrawElementsIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyPixels_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClampColorARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorPointervINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmaxParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3sMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeusSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedFramebufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1fvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateVertexArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginConditionalRender_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUnsignedBytevEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionFilter1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScalexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameterf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderOp1EXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginVideoCaptureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnHistogram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderMode_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearColorIiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSignalSemaphoreEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniformBlockiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirectCount_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexEnvfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableParameterivSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCullFace_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteFencesAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformHandleui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewportIndexedf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3ivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointAlongPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndQueryARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUMapSurfacesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4uivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageMem3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAttachShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFenceivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor4ubVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageSparseAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapNamedBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateMemoryObjectsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ubVertex2fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTransformFeedbackStreamInstanced_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpriteParameterfSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVideoCaptureStreamTextureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushPixelDataRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribLFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModelfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedTexImageARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexWeighthNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorMaskIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorMaski_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorFragmentOp1ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4ubvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameterI4uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteQueriesARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportMemoryWin32NameEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStringMarkerGREMEDY_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectLabelEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformHandleui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRotated_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsProgramPipeline_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRotatef_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveSubroutineUniformName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4sNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameter4dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeubSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirectBindlessNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportSemaphoreWin32HandleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexWeightPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3sEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaFunc_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferPageCommitmentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameters4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilFunc_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSemaphoreParameterui64vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribdvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryBufferObjectiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGenxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightEnviSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramPipelineiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2ivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetShaderInfoLog_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetOcclusionQueryuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateNamedFramebufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUInitNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetIntegerui64i_vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformHandleui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3ivMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparate_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstancedARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSubroutineIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplePatternSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEGLImageTargetRenderbufferStorageOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathParameterfNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformi64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaterialxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameter4fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3bEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginPerfQueryINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImageTransformParameterivHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindProgramPipeline_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScissor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBooleanv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaterialfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4fvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribIPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramBufferParametersfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaFuncxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirectAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3ivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage3DMultisampleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeusvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPollInstrumentsSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureLevelParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapControlPointsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexGenfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmaxEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsFenceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixFrustumEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDispatchComputeIndirect_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glQueryResourceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameter4dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexLevelParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinalCombinerInputNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCullParameterdvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapVertexAttrib1fAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderGpuMaskNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListBase_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindMaterialParameterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactorubSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetImageTransformParameterivHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorSubTableEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTexGenParameterfvSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClientWaitSync_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glQueryObjectParameteruiAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs1fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NusvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParametersI4ivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathGlyphIndexArrayNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyImageSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformSubroutineuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVertexBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageInsert_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginVertexShaderEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsVariantEnabledEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPassThroughxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsSampler_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConservativeRasterParameterfNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGenivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTexture2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCheckFramebufferStatus_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindImageTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackVaryings_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastBufferSubDataNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawRangeElements_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferBase_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSyncTextureINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateSamplers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerParameterfNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetArrayObjectivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleMapATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirectCountARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageMem1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2ivMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferDataARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribIFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateFramebuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3dvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearAccum_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginQuery_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilThenCoverStrokePathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeImageHandleResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2x4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangeIndexed_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsEnabled_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixScalefEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetError_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexEnviv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTextureUnitParameterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeletePerfQueryINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveVaryingNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniformARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedCopyBufferSubDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelMapfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateSyncFromCLeventARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelMapusv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnColorTableARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAccum_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFunciARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFramebufferAttachmentParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilMask_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResetHistogramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3sATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformHandleui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateProgramObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectParameterfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectsv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectBufferivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor4ubVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparateINGR_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoCaptureStreamfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexGeniv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelStorei_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedTextureSubImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyImageSubDataNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveShaderProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1iATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPatchParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsFramebufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelTexGenParameterivSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClipControl_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourceiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleMaskSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactorfSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparateIndexedAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfCounterInfoINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteProgramsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelZoomxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCombinerOutputParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2dvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathStencilDepthOffsetNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsStateNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetIntegerui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetImageTransformParameterfvHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsMemoryObjectEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightPointerARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinishFenceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexArrayAttribEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDoubleIndexedvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2fMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3b_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyConvolutionFilter1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFramebufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenPathsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenRenderbuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4ubvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTextureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs1svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedBufferSubDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparate_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantFloatvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2dMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFragDataLocationEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage1DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureImageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointSize_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTextureUnit_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameterI4uiNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramPipelineInfoLog_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWaitSync_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparatei_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveProgramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetFragmentShaderConstantATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorSubTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStateCaptureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindAttribLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightusvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragDataIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMemoryObjectParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightPathsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerStageParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMultfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexLevelParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureLevelParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaFragmentOp2ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteFramebuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbackiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnTexImageARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClear_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayParameteriAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoCaptureStreamdvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightModelivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTranslatef_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nub_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTranslated_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsIndirect_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeletePerfMonitorsAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawCommandsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMultTransposedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRequestResidentProgramsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaFragmentOp1ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjecti64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMult3x3fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathSubCommandsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFinalCombinerInputParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsRenderbuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGenfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrustumfOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVertexBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMateriali_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexAttribArray_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlitNamedFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoadTransposefEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGenfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderStorageBlockBinding_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaterialf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCheckNamedFramebufferStatusEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribFormatEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteVertexShaderEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSignalVkFenceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameterI4ivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactoriSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3sEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramInterfaceiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixIndexPointerARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGeniEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramStringEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapNamedBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmaxParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndConditionalRenderNVX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3iATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramBufferParametersIivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid1xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribPointervARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushMappedNamedBufferRangeEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPatchParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexFilterFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3dATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexBindingDivisorEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindProgramNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramLocalParameterfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenFragmentShadersATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBumpParameterivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedFramebufferAttachmentParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnSeparableFilter_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPassTexCoordATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureFaceARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayFogCoordOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteNamedStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastGetQueryObjecti64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenOcclusionQueriesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLighti_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClientAttribDefaultEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4bvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribIFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilFuncSeparate_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClientActiveVertexStreamATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleCoverage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearDepthxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastGetQueryObjectuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFirstPerfQueryIdINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapNamedBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbacki_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderbufferStorageMultisampleCoverageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFloati_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindAttribLocationARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferAddressRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenProgramsARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexEnvivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureFaceEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureLayer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayPointeri_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameter4dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3bEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionFilter2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyMultiTexSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameterI4iNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathMemoryGlyphIndexArrayNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilOp_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnvf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenPerfMonitorsAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInteger64i_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncIndexedAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnvi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsEnabledi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixTranslatedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeTextureHandleResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMultdEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportSyncEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportSemaphoreFdEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPNTrianglesiATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVertexArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glObjectPtrLabel_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDebugMessageLog_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTrackMatrixNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramPathFragmentInputGenNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeTextureHandleNonResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs4ubvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClipPlanexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPolygonStippleARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModelf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteMemoryObjectsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModeli_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexWeighthvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramNamedParameter4dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirect_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCallLists_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCombinerOutputParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushDebugGroup_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetStageIndexNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferPointervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBarrierNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ubVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCommandHeaderNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorCounterInfoAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerParameteriNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMultTransposefEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDetailTexFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAreTexturesResident_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastGetQueryObjectivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorFragmentOp3ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResizeBuffersMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmaxParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClientActiveTextureARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVertexArray_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4b_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlagFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstanced_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexArrayAttribEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glObjectUnpurgeableAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs2dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexFilterFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpriteParameterfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyMultiTexImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2x4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourceLocationIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewport_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramNamedParameter4fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInvariantBooleanvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorage2DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelStorex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveSubroutineUniformiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribPointerARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage2DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageMem1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glArrayElement_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glValidateProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelStoref_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs2fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRecti_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramParameterdvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap1xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReferencePlaneSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastBlitFramebufferNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCombinerInputParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureSamplerHandleARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRects_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveAttribARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glHistogramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureSamplerHandleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDetachShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinishTextureSUNX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3x4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathColorGenivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourceLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayAttribLFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexLevelParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewportIndexedfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBuffersBase_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBumpParameterfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixIndexuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3svMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilOpSeparateATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsBaseVertex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationSeparateiARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapVertexAttrib2fAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeTextureHandleNonResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4dATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs2hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClipPlanefOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderbufferStorage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glValidateProgramARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGenf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGend_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGeni_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteFramebuffersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResetMinmaxEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsQueryARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVariantClientStateEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScissorIndexed_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInvariantIntegervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameterI4uiNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenFramebuffersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayColorOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexWeightfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTextureHandleResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4ivMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantPointervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapNamedBufferRangeEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateShaderProgramv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaxShaderCompilerThreadsKHR_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPNTrianglesfATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactorusSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenerateMipmap_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedRenderbufferStorageMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonOffsetClampEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureRangeAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationIndexedAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameteri_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUnsignedBytei_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapNamedBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleMaskEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameter4dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameterfvSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTextureFaceEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilFillPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReleaseShaderCompiler_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageMem3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsVertexAttribEnabledAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReadPixels_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetFenceAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightsvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShadeModel_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageMem3DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConservativeRasterParameteriNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedBufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearDepthf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreatePerfQueryINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReadnPixelsARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4dvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateNamedFramebufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorP4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUseProgramStages_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathTexGenNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexBlendEnviATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadMatrixf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferDrawBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapAttribParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribLdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedRenderbufferStorageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTexGenParameteriSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glExecuteProgramNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantArrayObjectATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnConvolutionFilterARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInvariantFloatvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedFramebufferiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenSamplers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawRangeElementArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixPopEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1sATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexEnviEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameter4fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWaitSemaphoreEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferSampleLocationsfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantIntegervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteLists_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGendv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorGroupsAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultTransposeMatrixfARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteStatesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferParameteri64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlagPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVideoCaptureStreamParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4iATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUFiniNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeBufferNonResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilStrokePathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpriteParameteriSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeTextureHandleResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultMatrixxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureNormalEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInstrumentsSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionFilterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCurrentPaletteMatrixARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateRenderbuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nusv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerInputNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthFunc_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4fMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableClientStateIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFunci_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResolveDepthValuesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureColorMaskSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateShaderProgramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferStorage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeNamedBufferNonResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderbufferStorageMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFloati_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1svATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3fATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferDrawBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordPointervINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2iATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAsyncMarkerSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageSparseAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndPerfQueryINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightModeliSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrioritizeTexturesEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndConditionalRender_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableClientState_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResetHistogram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetOcclusionQueryivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenerateMultiTexMipmapEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3dvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLabelObjectEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexEnvfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexGendv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameter4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3usv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelTransformParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthMask_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAreProgramsResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginQueryIndexed_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1dvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexEnvfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteFencesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs1dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferStorageExternalEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2sATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnSeparableFilterARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveStencilFaceEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointSizexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindParameterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendParameteriNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameter4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformHandleui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathMetricsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNewList_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoad3x3fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribDivisorARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnCompressedTexImageARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetIntegerv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoaddEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathLengthNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawPixels_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultMatrixd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultMatrixf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodePointerSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadTransposeMatrixdARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribIOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompileShaderARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3dMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3fvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4usv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonStipple_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSubroutineUniformLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFramebufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelMapusv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSamplerParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2fvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSeparableFilter2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLGPUCopyImageSubDataNVX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexGendvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniform_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeNamedBufferResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathGlyphIndexRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameterI4ivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastGetQueryObjectui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameterfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTextureLayer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayIntegervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUIsSurfaceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsAsyncMarkerSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDoublei_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsCommandListNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferRenderbuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformLocationARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3sNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDoublei_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindSampler_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLineWidth_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayRangeAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetIntegeri_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbackVarying_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameter4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbackVaryingNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream1dATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorFragmentOp2ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureHandleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModeliv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangef_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragmentMaterialivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVideoCaptureStreamParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteProgramsARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFeedbackBufferxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexBumpParameterfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnablei_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveSubroutineName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawBuffersARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindProgramARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFloatIndexedvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleCoverageARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelDataRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3svATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSampleMaski_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexFuncEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameteriNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3x2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFramebufferParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferStorageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTexture3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayPointervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribArrayObjectivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexArrayEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableParameterfvSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlag_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpriteParameterivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathGlyphRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrimitiveBoundingBoxARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeletePathsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrimitiveRestartIndexNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyNamedBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenProgramsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightfSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportSemaphoreWin32NameEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3x4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSubpixelPrecisionBiasNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NsvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPassThrough_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateTexSubImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsImageHandleResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBegin_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3ubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilClearTagEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniformName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangentPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageEnableAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenRenderbuffersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameterI4ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationiARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixOrthoEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParametersI4ivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedStringivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackBufferBase_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexsv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDetailTexFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameter4fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBitmap_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTextureLayerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGenfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilFuncSeparateATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapGrid2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListParameterivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateQueries_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSamplerParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glObjectLabel_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureHandleARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformIndices_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverageModulationTableNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveVaryingNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixTranslatefEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureMaterialEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInterpolatePathsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelTransformParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantBooleanvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysInstancedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableClientStateIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirectBindlessNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapusv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInternalformati64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderSourceARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderOp3EXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2dvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProvokingVertexEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantubvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlush_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPresentFrameDualFillNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenVertexShadersEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpecializeShaderARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformHandleui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangefOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteVertexArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstancedBaseVertexBaseInstance_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexLevelParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawVkImageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrioritizeTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3fvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x2dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorage3DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilOpValueAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramVertexLimitNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterPointervAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClampColor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearStencil_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs3svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexBlendEnvfATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsFenceAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferParameterui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4bvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStopInstrumentsSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapVertexAttrib2dAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3bvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonOffset_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3bvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glHistogram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixIndexubvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribLui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushMappedBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI3uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLineWidthxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexEnvivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTexGenParameterivSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenQueries_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelMapfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendColorEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResetMinmax_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexBlendARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVaryingLocationNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapAttribParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteSamplers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLightxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribArrayObjectfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayNormalOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferParameterivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawMeshArraysSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultisamplefvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathCommandsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayTexCoordOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMode_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x2fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadMatrixxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixRotatefEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetClipPlanexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfQueryInfoINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDoublev_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferRangeEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapBufferARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathSpacingNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactordSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetShaderSourceARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateBufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoad3x2fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenTexturesEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3bvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapusvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMemoryObjectParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenSemaphoresEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedBufferDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3fMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteRenderbuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureLevelParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElements_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeImageHandleNonResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3dATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowRectanglesEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferReadBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexGenfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginQueryARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateSubFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTestFenceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyMultiTexSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantbvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenFencesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnConvolutionFilter_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightbvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginConditionalRenderNVX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinish_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentCoverageColorNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewportPositionWScaleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramLocalParameterIuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4fvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeformationMap3fSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearDepth_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenAsyncMarkersSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexWeightfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramLocalParameterIivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage3DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameter4fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInsertComponentEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateBuffers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGenxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultTransposeMatrixf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginTransformFeedbackEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFreeObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendBarrierNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaFragmentOp3ATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameters4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparateEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTexGenSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4x3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoCaptureStreamivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeImageHandleNonResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteQueries_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInitNames_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribDivisorEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glArrayElementEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameter4dNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopGroupMarkerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedFramebufferuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetLocalConstantEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDispatchCompute_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentColorMaterialSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMinmaxARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLogicOp_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4iMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransferf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexPointervINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSeparableFilterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTransformFeedbackStream_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayMultiTexCoordOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProvokingVertex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAccumxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderBinary_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexGenivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateStatesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearDepthdNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearColorIuiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindMultiTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexGeniv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElements_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexArrayEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClientActiveTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastBarrierNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribArrayObjectATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysInstanced_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2sNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2fATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageCallbackAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndQueryIndexed_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3sATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameteriARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnvxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexAttribAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindRenderbuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexSubImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirectAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramInfoLog_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLocalConstantBooleanvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransformParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParametersI4uivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadTransposeMatrixfARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImageTransformParameteriHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs3fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentMaterialiSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBooleani_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourceIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginConditionalRenderNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableClientState_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathFogGenNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilThenCoverFillPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayIndexOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramBufferParametersIuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransformParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableClientStateiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexBufferARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLocalConstantIntegervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirectBindlessCountNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferPointervARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalMesh2_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalMesh1_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilThenCoverFillPathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapVertexAttrib1dAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadTransposeMatrixd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadTransposeMatrixf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPointervEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSignalVkSemaphoreNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndConditionalRenderNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramNamedParameter4dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompileCommandListNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetRenderbufferParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPolygonStipple_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsBufferResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ubvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedRenderbufferParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferSampleLocationsfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGendvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTextureHandleResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramEnvParameterdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsNamedStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4ubvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTagSampleBufferSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUUnregisterSurfaceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfQueryIdByNameINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInteger64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClipPlane_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4ubVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexub_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramEnvParameterfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4usvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferRenderbuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTestFenceAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Niv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL2i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorP4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2x3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCallCommandListNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedStringARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMult3x2fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramStringEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnHistogramARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureLevelParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBitmapxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSamplerParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribLPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs2svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsEnabledIndexedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3us_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginPerfMonitorAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramLocalParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReadnPixels_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3ub_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL3ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCheckFramebufferStatusEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexAttribArrayARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPolygonStipple_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathDashArrayNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteOcclusionQueriesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameter4dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnlockArraysEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectui64vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4ivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopClientAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinishObjectAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmaxParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteTransformFeedbacks_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoi64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawRangeElementsBaseVertex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage3DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushGroupMarkerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoadIdentityEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultTransposeMatrixxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPixelMapxv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferSampleLocationsfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLightiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparatei_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAcquireKeyedMutexWin32EXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBooleanIndexedvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramSubroutineParameteruivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glApplyFramebufferAttachmentCMAAINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWaitVkSemaphoreNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisablei_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSelectPerfMonitorCountersAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribLi64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparateiARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightuivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2iARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramLocalParameterdvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3us_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSynciv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeImageHandleResidentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramNamedParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListDrawCommandsStatesClientNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParametersI4uivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramBinary_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalPoint1_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalPoint2_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPauseTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2sMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactorbSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateTransformFeedbacks_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexturePageCommitmentEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackVaryingsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlitFramebufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameter4dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageMem2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMultiTexLevelParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsOcclusionQueryNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage2DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramEnvParameterIuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindVertexShaderEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramLocalParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x2dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord1hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadMatrixd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantdvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCullParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsBufferARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordhNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferSampleLocationsfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenSymbolsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionFilter_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNextPerfQueryIdINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage1DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindSamplers_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramEnvParameterIivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectui64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorMask_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginFragmentShaderATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenNamesAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathParameteriNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateCommandListsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteProgramPipelines_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyColorSubTableEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantsvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenProgramPipelines_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayEdgeFlagOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glOrthoxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformSubroutinesuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRectdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ubEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexGendEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoordfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompileShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixLoadTransposedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedTextureImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapfvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirectCount_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribIPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvaluateDepthValuesARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramLocalParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4fNormal3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSeparableFilter2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearAccumxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInvalidateFramebuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightubvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedFramebufferfi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryBufferObjectuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearNamedFramebufferfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndVertexShaderEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetClipPlanefOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWeightivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSeparableFilter_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathTexGenivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferPageCommitmentARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadIdentity_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4x3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBarrier_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuivSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteAsyncMarkersSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSharpenTexFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformHandleui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIglooInterfaceSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearBufferfi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysIndirect_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenVertexArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbacki64_v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexArrayAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4fATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexBindingDivisor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSamplerParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCoverageModulationTableNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawRangeElementArrayAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribFormatNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryBufferObjecti64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformi64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAreTexturesResidentEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHandleARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVideoCaptureStreamParameterdvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsVertexArray_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3sEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrameTerminatorGREMEDY_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendBarrierKHR_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NubARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrimitiveRestartNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL1ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs4svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4svEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage3DMultisampleCoverageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMemoryBarrier_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantArrayObjectfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsProgramARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindImageTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragDataLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage2DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMaterialfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4NbvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelMapuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableClientStateiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearTexSubImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDetachObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantusvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureImage3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayIntegeri_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4ubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTexGenParameterfSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyMultiTexSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexAttribArrayARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastCopyBufferSubDataNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniformsiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUseProgramObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetAttribLocation_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferStorageMemEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathSubCoordsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixIndexusvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideouivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoCaptureivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixScaledEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragmentLightivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetStringi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribPointervNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushMatrix_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlagPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenerateMipmapEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathCoordsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEGLImageTargetTexture2DOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelZoom_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferReadBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glExtractComponentEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMinmax_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfvSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendEquationi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFogFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMinmax_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightiSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord1bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColorPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoordP4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferSubDataARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathParameterivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushRasterSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glElementPointerATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetAttachedObjectsARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSharpenTexFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearDepthfOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteCommandListsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSpecializeShader_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorage2DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFuncSeparateIndexedAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMakeBufferResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderOp2EXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfQueryDataINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveUniformBlockName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthBoundsdNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteTexturesEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawBuffersATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModelxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glApplyTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetImageHandleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMinmax_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFixedvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplePatternEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoorddvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushMappedBufferRangeAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushStaticDataIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndTransformFeedbackEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureSubImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedRenderbufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBuffersRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinishAsyncSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFragDataLocationIndexed_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushVertexArrayRangeAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3dvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFeedbackBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageInsertARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetShaderiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glArrayObjectATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPointeri_vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorCountersAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferStorage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnvxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransferi_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3usvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameterI4uivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4dMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageControlARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentMaterialivSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLinkProgramARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFinishFenceAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribBindingEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageMem3DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastFramebufferSampleLocationsfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPollAsyncSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVariantivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUnmapTexture2DINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastWaitSyncNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathCoordsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor4xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackVaryingsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCombinerOutputNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4sMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4svARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsList_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetInfoLogARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs3dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactorsSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTrackMatrixivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsNamedBufferResidentNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTbufferMask3DFX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverFillPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenerateTextureMipmap_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameterI4uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsBaseVertex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramSubroutineParametersuivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2x4dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRotatexOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMemoryBarrierEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3svNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3iATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetFenceNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAttachObjectARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyConvolutionFilter1D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageMem2DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameters4fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferParameteriEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4Nsv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4usvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureBufferRangeEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexP3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnUniformi64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureMultiviewOVR_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedMultiTexSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnMapdv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDebugMessageCallback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3svEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribParameteriAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferSubDataARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribLui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiColor4ubVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImageTransformParameterfHP_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap1f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMapControlPointsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParametersI4ivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3dvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalPointerListIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogFuncSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiModeDrawArraysIBM_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedFramebufferAttachmentParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFloatv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayVertexAttribIFormatEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glHint_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2svATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawArraysIndirect_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexEnvfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribP2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1i64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTextureARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushClientAttribDefaultEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScalef_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScaled_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetConvolutionParameterxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourceName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyColorTable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDepthRangeArrayv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCoverFillPathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetActiveAtomicCounterBufferiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilOpSeparate_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameterivSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayAttribBinding_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsSemaphoreEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramParameters4dvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribL4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribPointerv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glResumeTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3i64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathMetricRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2iMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnCompressedTexImage_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReplacementCodeuiVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTransformFeedbackVaryingEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapNamedBufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisable_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsPointInFillPathNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glQueryCounter_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormal3svEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferOffsetNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramResourcefvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBinormalPointerEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLightfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMulticastCopyImageSubDataNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex2bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetHistogramParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramStringNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexGenxvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glObjectPurgeableAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColorTableSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyConvolutionFilter2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoorddv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferPointerv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform1fEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2fvMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glAlphaToCoverageDitherControlNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPolygonOffsetxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformHandleui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentLightModelfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSwizzleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindFragmentShaderATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs3hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenBuffersARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureStorageMem2DMultisampleEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glListParameterfvSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedRenderbufferStorageMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLightModelxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReadBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStencilFillPathInstancedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVDPAUUnmapSurfacesNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform4i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream4dvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsQuery_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushMappedNamedBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushName_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetClipPlane_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendColor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameterIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexubv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferPageCommitmentEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCheckNamedFramebufferStatus_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectBufferfvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorCounterStringAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstancedEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameterI4iEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterPos4s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramStageiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMaterialxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopMatrix_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVideoui64vNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3bEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetGraphicsResetStatusARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexAttribArray_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4fVertex4fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRenderbufferStorageMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateProgramPipelines_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribLPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2uiEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3sv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawElementsInstancedBaseVertex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransformParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage2DMultisampleCoverageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedRenderbufferStorageMultisampleCoverageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsTexture_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnvfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPopDebugGroup_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformBlockBinding_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2svMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenerateTextureMipmapEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindLightParameterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord3bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordPointer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix3x2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramLocalParameterI4uivNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFlushVertexArrayRangeNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3svEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetBufferParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryIndexediv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture3DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLoadTransposeMatrixxOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteTransformFeedbacksNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedTextureImageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexMaterialEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFogCoorddEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFramebufferParameterfvAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexEnviv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndTransformFeedbackNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGlobalAlphaFactoruiSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSelectBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferSubDataEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVertexArrayAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBlendFunc_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCreateProgram_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream2dATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ui64vARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetSemaphoreParameterui64vEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPrimitiveRestartIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3fATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribs1hvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos4svMESA_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteFragmentShaderATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindImageTextures_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMap2xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1i64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathStringNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedFramebufferParameterivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetProgramNamedParameterdvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathDashArrayNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glColor3fVertex3fvSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultTransposeMatrixd_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glClearColor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetImageHandleARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTangent3dEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryObjectivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetLocalConstantFloatvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUseShaderProgramEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindRenderbufferEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glInterleavedArrays_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPerfMonitorGroupStringAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedProgramLocalParameterdvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDeleteQueryResourceTagNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ub_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFragmentMaterialfSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVariantArrayObjectivATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1dARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferPointerv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLockArraysEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribPointerNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glConvolutionParameterf_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferBaseEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2xvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetQueryBufferObjectui64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSetMultisamplefvAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathColorGenNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib4ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenTransformFeedbacks_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexAttribIuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPixelTransformParameterfEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterIuivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectParameterivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArraySecondaryColorOffsetEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos2fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTexSubImage3DARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramBinary_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPresentFrameKeyedNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI4bv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPathCoverDepthFuncNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTransformFeedbackStreamAttribsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3usEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyColorTableSGI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramEnvParameter4fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4sARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetVertexArrayIndexed64iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMatrixMultTranspose3x3fNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexArrayAttribFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndTransformFeedback_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawCommandsStatesAddressNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4ui64NV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMaterialiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage2DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTextureEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsBuffer_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFinalCombinerInputParameterfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3bvOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribDivisor_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyBufferSubData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindTexGenParameterEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3bATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexStorageMem2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetColorTableParameteriv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glActiveTextureARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord4xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedBufferStorageExternalEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSecondaryColor3fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix4x2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glStartInstrumentsSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramNamedParameter4fvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndVideoCaptureNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenLists_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferTexture1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMapBufferRange_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsIndirectCountARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniformMatrix4x2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTextureParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord3hNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParametersI4uivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEndList_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoord2fColor4fNormal3fVertex3fSUN_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenTransformFeedbacksNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEdgeFlagv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI2iv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyMultiTexImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3x2dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage3DMultisampleCoverageNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetShaderPrecisionFormat_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexSubImage4DSGIS_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glRasterSamplesEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureView_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalMapsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetFragDataLocationEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetCompressedMultiTexImageEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIndexMask_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPushClientAttrib_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glShaderSource_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDispatchComputeGroupSizeARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glLGPUNamedBufferSubDataNVX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP2uiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetNamedBufferParameteri64v_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCommandListSegmentsNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureParameterIivEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2ui64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNewObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glViewportSwizzleNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBufferData_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTextureImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetTexParameterIiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTexSubImage1DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertex4f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniformMatrix3fvARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexCoordP1ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glPointParameterfvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform4fARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glImportMemoryFdEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyTextureSubImage3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedFramebufferSamplePositionsfvAMD_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalP3ui_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawRangeElementArrayATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttribI1i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysInstancedARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEnableVertexAttribAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetDebugMessageLogARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetPathTexGenfvNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNamedProgramLocalParameters4fvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glQueryResourceTagNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexStream3fvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFramebufferTexture3D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCompressedTextureSubImage2DEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glWindowPos3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glCopyConvolutionFilter2D_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReadInstrumentsSGIX_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform2dvEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glSamplerParameterfv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBindBufferARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib1sNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetMaterialiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1fv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glBeginOcclusionQueryNV_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGenFencesAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glScissorIndexedv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDisableVariantClientStateEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMinmaxEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalPointervINTEL_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetnPixelMapuiv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormalStream3bvATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetObjectParameterivAPPLE_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3i_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUniform1ivARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glUpdateObjectBufferATI_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glNormal3b_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformBufferSizeEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord4dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glProgramUniform3i64ARB_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2d_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2f_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiDrawElementsEXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib3dv_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glMultiTexCoord2bOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glVertexAttrib2s_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glTexImage3DMultisample_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glGetUniformBlockIndex_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glReleaseKeyedMutexWin32EXT_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glFrontFace_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glEvalCoord1xOES_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glDrawArraysInstancedBaseInstance_null),
+  (FUNCTION_POINTER)(&NullFunctions::m_glIsPointInStrokePathNV_null),
+};
@@ -0,0 +1,8778 @@
+this->m_names[0] = "glMultiDrawArraysIndirectBindlessCountNV";
+this->m_orig_glMultiDrawArraysIndirectBindlessCountNV = this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV)this->m_ptr_glMultiDrawArraysIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectBindlessCountNV_profile;
+this->m_names[1] = "glTextureParameterfv";
+this->m_orig_glTextureParameterfv = this->m_ptr_glTextureParameterfv;
+if(this->m_ptr_glTextureParameterfv)this->m_ptr_glTextureParameterfv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC)&ProfilingTableDecorator::m_glTextureParameterfv_profile;
+this->m_names[2] = "glGetListParameterivSGIX";
+this->m_orig_glGetListParameterivSGIX = this->m_ptr_glGetListParameterivSGIX;
+if(this->m_ptr_glGetListParameterivSGIX)this->m_ptr_glGetListParameterivSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glGetListParameterivSGIX_profile;
+this->m_names[3] = "glProgramUniform1i64ARB";
+this->m_orig_glProgramUniform1i64ARB = this->m_ptr_glProgramUniform1i64ARB;
+if(this->m_ptr_glProgramUniform1i64ARB)this->m_ptr_glProgramUniform1i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform1i64ARB_profile;
+this->m_names[4] = "glVertexArrayElementBuffer";
+this->m_orig_glVertexArrayElementBuffer = this->m_ptr_glVertexArrayElementBuffer;
+if(this->m_ptr_glVertexArrayElementBuffer)this->m_ptr_glVertexArrayElementBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC)&ProfilingTableDecorator::m_glVertexArrayElementBuffer_profile;
+this->m_names[5] = "glHintPGI";
+this->m_orig_glHintPGI = this->m_ptr_glHintPGI;
+if(this->m_ptr_glHintPGI)this->m_ptr_glHintPGI = (FunctionTable::MEMBERPFNGLHINTPGIPROC)&ProfilingTableDecorator::m_glHintPGI_profile;
+this->m_names[6] = "glStencilMaskSeparate";
+this->m_orig_glStencilMaskSeparate = this->m_ptr_glStencilMaskSeparate;
+if(this->m_ptr_glStencilMaskSeparate)this->m_ptr_glStencilMaskSeparate = (FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC)&ProfilingTableDecorator::m_glStencilMaskSeparate_profile;
+this->m_names[7] = "glGetFramebufferAttachmentParameterivEXT";
+this->m_orig_glGetFramebufferAttachmentParameterivEXT = this->m_ptr_glGetFramebufferAttachmentParameterivEXT;
+if(this->m_ptr_glGetFramebufferAttachmentParameterivEXT)this->m_ptr_glGetFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetFramebufferAttachmentParameterivEXT_profile;
+this->m_names[8] = "glTextureStorage3DMultisample";
+this->m_orig_glTextureStorage3DMultisample = this->m_ptr_glTextureStorage3DMultisample;
+if(this->m_ptr_glTextureStorage3DMultisample)this->m_ptr_glTextureStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTextureStorage3DMultisample_profile;
+this->m_names[9] = "glGetIntegerIndexedvEXT";
+this->m_orig_glGetIntegerIndexedvEXT = this->m_ptr_glGetIntegerIndexedvEXT;
+if(this->m_ptr_glGetIntegerIndexedvEXT)this->m_ptr_glGetIntegerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetIntegerIndexedvEXT_profile;
+this->m_names[10] = "glCopyTexImage1D";
+this->m_orig_glCopyTexImage1D = this->m_ptr_glCopyTexImage1D;
+if(this->m_ptr_glCopyTexImage1D)this->m_ptr_glCopyTexImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTexImage1D_profile;
+this->m_names[11] = "glVertexAttrib4usv";
+this->m_orig_glVertexAttrib4usv = this->m_ptr_glVertexAttrib4usv;
+if(this->m_ptr_glVertexAttrib4usv)this->m_ptr_glVertexAttrib4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC)&ProfilingTableDecorator::m_glVertexAttrib4usv_profile;
+this->m_names[12] = "glTexRenderbufferNV";
+this->m_orig_glTexRenderbufferNV = this->m_ptr_glTexRenderbufferNV;
+if(this->m_ptr_glTexRenderbufferNV)this->m_ptr_glTexRenderbufferNV = (FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC)&ProfilingTableDecorator::m_glTexRenderbufferNV_profile;
+this->m_names[13] = "glVertexAttrib3hvNV";
+this->m_orig_glVertexAttrib3hvNV = this->m_ptr_glVertexAttrib3hvNV;
+if(this->m_ptr_glVertexAttrib3hvNV)this->m_ptr_glVertexAttrib3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3hvNV_profile;
+this->m_names[14] = "glProgramUniform4ui64ARB";
+this->m_orig_glProgramUniform4ui64ARB = this->m_ptr_glProgramUniform4ui64ARB;
+if(this->m_ptr_glProgramUniform4ui64ARB)this->m_ptr_glProgramUniform4ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64ARB_profile;
+this->m_names[15] = "glInstrumentsBufferSGIX";
+this->m_orig_glInstrumentsBufferSGIX = this->m_ptr_glInstrumentsBufferSGIX;
+if(this->m_ptr_glInstrumentsBufferSGIX)this->m_ptr_glInstrumentsBufferSGIX = (FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC)&ProfilingTableDecorator::m_glInstrumentsBufferSGIX_profile;
+this->m_names[16] = "glIndexi";
+this->m_orig_glIndexi = this->m_ptr_glIndexi;
+if(this->m_ptr_glIndexi)this->m_ptr_glIndexi = (FunctionTable::MEMBERPFNGLINDEXIPROC)&ProfilingTableDecorator::m_glIndexi_profile;
+this->m_names[17] = "glMultiTexCoord2sARB";
+this->m_orig_glMultiTexCoord2sARB = this->m_ptr_glMultiTexCoord2sARB;
+if(this->m_ptr_glMultiTexCoord2sARB)this->m_ptr_glMultiTexCoord2sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2sARB_profile;
+this->m_names[18] = "glProgramEnvParameter4fARB";
+this->m_orig_glProgramEnvParameter4fARB = this->m_ptr_glProgramEnvParameter4fARB;
+if(this->m_ptr_glProgramEnvParameter4fARB)this->m_ptr_glProgramEnvParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4fARB_profile;
+this->m_names[19] = "glCompressedTexSubImage3D";
+this->m_orig_glCompressedTexSubImage3D = this->m_ptr_glCompressedTexSubImage3D;
+if(this->m_ptr_glCompressedTexSubImage3D)this->m_ptr_glCompressedTexSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage3D_profile;
+this->m_names[20] = "glEvalCoord2d";
+this->m_orig_glEvalCoord2d = this->m_ptr_glEvalCoord2d;
+if(this->m_ptr_glEvalCoord2d)this->m_ptr_glEvalCoord2d = (FunctionTable::MEMBERPFNGLEVALCOORD2DPROC)&ProfilingTableDecorator::m_glEvalCoord2d_profile;
+this->m_names[21] = "glEvalCoord2f";
+this->m_orig_glEvalCoord2f = this->m_ptr_glEvalCoord2f;
+if(this->m_ptr_glEvalCoord2f)this->m_ptr_glEvalCoord2f = (FunctionTable::MEMBERPFNGLEVALCOORD2FPROC)&ProfilingTableDecorator::m_glEvalCoord2f_profile;
+this->m_names[22] = "glIndexd";
+this->m_orig_glIndexd = this->m_ptr_glIndexd;
+if(this->m_ptr_glIndexd)this->m_ptr_glIndexd = (FunctionTable::MEMBERPFNGLINDEXDPROC)&ProfilingTableDecorator::m_glIndexd_profile;
+this->m_names[23] = "glSecondaryColor3hvNV";
+this->m_orig_glSecondaryColor3hvNV = this->m_ptr_glSecondaryColor3hvNV;
+if(this->m_ptr_glSecondaryColor3hvNV)this->m_ptr_glSecondaryColor3hvNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC)&ProfilingTableDecorator::m_glSecondaryColor3hvNV_profile;
+this->m_names[24] = "glIndexf";
+this->m_orig_glIndexf = this->m_ptr_glIndexf;
+if(this->m_ptr_glIndexf)this->m_ptr_glIndexf = (FunctionTable::MEMBERPFNGLINDEXFPROC)&ProfilingTableDecorator::m_glIndexf_profile;
+this->m_names[25] = "glFrustumxOES";
+this->m_orig_glFrustumxOES = this->m_ptr_glFrustumxOES;
+if(this->m_ptr_glFrustumxOES)this->m_ptr_glFrustumxOES = (FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC)&ProfilingTableDecorator::m_glFrustumxOES_profile;
+this->m_names[26] = "glTextureStorage3DEXT";
+this->m_orig_glTextureStorage3DEXT = this->m_ptr_glTextureStorage3DEXT;
+if(this->m_ptr_glTextureStorage3DEXT)this->m_ptr_glTextureStorage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage3DEXT_profile;
+this->m_names[27] = "glDrawCommandsStatesNV";
+this->m_orig_glDrawCommandsStatesNV = this->m_ptr_glDrawCommandsStatesNV;
+if(this->m_ptr_glDrawCommandsStatesNV)this->m_ptr_glDrawCommandsStatesNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC)&ProfilingTableDecorator::m_glDrawCommandsStatesNV_profile;
+this->m_names[28] = "glUniform4uiEXT";
+this->m_orig_glUniform4uiEXT = this->m_ptr_glUniform4uiEXT;
+if(this->m_ptr_glUniform4uiEXT)this->m_ptr_glUniform4uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC)&ProfilingTableDecorator::m_glUniform4uiEXT_profile;
+this->m_names[29] = "glProgramUniform3ui64ARB";
+this->m_orig_glProgramUniform3ui64ARB = this->m_ptr_glProgramUniform3ui64ARB;
+if(this->m_ptr_glProgramUniform3ui64ARB)this->m_ptr_glProgramUniform3ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64ARB_profile;
+this->m_names[30] = "glIndexs";
+this->m_orig_glIndexs = this->m_ptr_glIndexs;
+if(this->m_ptr_glIndexs)this->m_ptr_glIndexs = (FunctionTable::MEMBERPFNGLINDEXSPROC)&ProfilingTableDecorator::m_glIndexs_profile;
+this->m_names[31] = "glVertexArrayBindVertexBufferEXT";
+this->m_orig_glVertexArrayBindVertexBufferEXT = this->m_ptr_glVertexArrayBindVertexBufferEXT;
+if(this->m_ptr_glVertexArrayBindVertexBufferEXT)this->m_ptr_glVertexArrayBindVertexBufferEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glVertexArrayBindVertexBufferEXT_profile;
+this->m_names[32] = "glConvolutionParameteriEXT";
+this->m_orig_glConvolutionParameteriEXT = this->m_ptr_glConvolutionParameteriEXT;
+if(this->m_ptr_glConvolutionParameteriEXT)this->m_ptr_glConvolutionParameteriEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameteriEXT_profile;
+this->m_names[33] = "glColor4ubVertex2fSUN";
+this->m_orig_glColor4ubVertex2fSUN = this->m_ptr_glColor4ubVertex2fSUN;
+if(this->m_ptr_glColor4ubVertex2fSUN)this->m_ptr_glColor4ubVertex2fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex2fSUN_profile;
+this->m_names[34] = "glProgramUniform1ivEXT";
+this->m_orig_glProgramUniform1ivEXT = this->m_ptr_glProgramUniform1ivEXT;
+if(this->m_ptr_glProgramUniform1ivEXT)this->m_ptr_glProgramUniform1ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1ivEXT_profile;
+this->m_names[35] = "glGetnMapfv";
+this->m_orig_glGetnMapfv = this->m_ptr_glGetnMapfv;
+if(this->m_ptr_glGetnMapfv)this->m_ptr_glGetnMapfv = (FunctionTable::MEMBERPFNGLGETNMAPFVPROC)&ProfilingTableDecorator::m_glGetnMapfv_profile;
+this->m_names[36] = "glTransformFeedbackBufferRange";
+this->m_orig_glTransformFeedbackBufferRange = this->m_ptr_glTransformFeedbackBufferRange;
+if(this->m_ptr_glTransformFeedbackBufferRange)this->m_ptr_glTransformFeedbackBufferRange = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTransformFeedbackBufferRange_profile;
+this->m_names[37] = "glPathGlyphsNV";
+this->m_orig_glPathGlyphsNV = this->m_ptr_glPathGlyphsNV;
+if(this->m_ptr_glPathGlyphsNV)this->m_ptr_glPathGlyphsNV = (FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC)&ProfilingTableDecorator::m_glPathGlyphsNV_profile;
+this->m_names[38] = "glSecondaryColor3fv";
+this->m_orig_glSecondaryColor3fv = this->m_ptr_glSecondaryColor3fv;
+if(this->m_ptr_glSecondaryColor3fv)this->m_ptr_glSecondaryColor3fv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC)&ProfilingTableDecorator::m_glSecondaryColor3fv_profile;
+this->m_names[39] = "glGetCombinerInputParameterivNV";
+this->m_orig_glGetCombinerInputParameterivNV = this->m_ptr_glGetCombinerInputParameterivNV;
+if(this->m_ptr_glGetCombinerInputParameterivNV)this->m_ptr_glGetCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetCombinerInputParameterivNV_profile;
+this->m_names[40] = "glEndPerfMonitorAMD";
+this->m_orig_glEndPerfMonitorAMD = this->m_ptr_glEndPerfMonitorAMD;
+if(this->m_ptr_glEndPerfMonitorAMD)this->m_ptr_glEndPerfMonitorAMD = (FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC)&ProfilingTableDecorator::m_glEndPerfMonitorAMD_profile;
+this->m_names[41] = "glPointParameterfvARB";
+this->m_orig_glPointParameterfvARB = this->m_ptr_glPointParameterfvARB;
+if(this->m_ptr_glPointParameterfvARB)this->m_ptr_glPointParameterfvARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glPointParameterfvARB_profile;
+this->m_names[42] = "glVertex2xOES";
+this->m_orig_glVertex2xOES = this->m_ptr_glVertex2xOES;
+if(this->m_ptr_glVertex2xOES)this->m_ptr_glVertex2xOES = (FunctionTable::MEMBERPFNGLVERTEX2XOESPROC)&ProfilingTableDecorator::m_glVertex2xOES_profile;
+this->m_names[43] = "glDrawElementsInstancedBaseInstance";
+this->m_orig_glDrawElementsInstancedBaseInstance = this->m_ptr_glDrawElementsInstancedBaseInstance;
+if(this->m_ptr_glDrawElementsInstancedBaseInstance)this->m_ptr_glDrawElementsInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseInstance_profile;
+this->m_names[44] = "glMultTransposeMatrixdARB";
+this->m_orig_glMultTransposeMatrixdARB = this->m_ptr_glMultTransposeMatrixdARB;
+if(this->m_ptr_glMultTransposeMatrixdARB)this->m_ptr_glMultTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixdARB_profile;
+this->m_names[45] = "glVertexAttribL4dEXT";
+this->m_orig_glVertexAttribL4dEXT = this->m_ptr_glVertexAttribL4dEXT;
+if(this->m_ptr_glVertexAttribL4dEXT)this->m_ptr_glVertexAttribL4dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL4dEXT_profile;
+this->m_names[46] = "glVertex4iv";
+this->m_orig_glVertex4iv = this->m_ptr_glVertex4iv;
+if(this->m_ptr_glVertex4iv)this->m_ptr_glVertex4iv = (FunctionTable::MEMBERPFNGLVERTEX4IVPROC)&ProfilingTableDecorator::m_glVertex4iv_profile;
+this->m_names[47] = "glCoverStrokePathInstancedNV";
+this->m_orig_glCoverStrokePathInstancedNV = this->m_ptr_glCoverStrokePathInstancedNV;
+if(this->m_ptr_glCoverStrokePathInstancedNV)this->m_ptr_glCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glCoverStrokePathInstancedNV_profile;
+this->m_names[48] = "glDeformSGIX";
+this->m_orig_glDeformSGIX = this->m_ptr_glDeformSGIX;
+if(this->m_ptr_glDeformSGIX)this->m_ptr_glDeformSGIX = (FunctionTable::MEMBERPFNGLDEFORMSGIXPROC)&ProfilingTableDecorator::m_glDeformSGIX_profile;
+this->m_names[49] = "glUniform2ui64NV";
+this->m_orig_glUniform2ui64NV = this->m_ptr_glUniform2ui64NV;
+if(this->m_ptr_glUniform2ui64NV)this->m_ptr_glUniform2ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC)&ProfilingTableDecorator::m_glUniform2ui64NV_profile;
+this->m_names[50] = "glCopyPathNV";
+this->m_orig_glCopyPathNV = this->m_ptr_glCopyPathNV;
+if(this->m_ptr_glCopyPathNV)this->m_ptr_glCopyPathNV = (FunctionTable::MEMBERPFNGLCOPYPATHNVPROC)&ProfilingTableDecorator::m_glCopyPathNV_profile;
+this->m_names[51] = "glVertexAttribP4ui";
+this->m_orig_glVertexAttribP4ui = this->m_ptr_glVertexAttribP4ui;
+if(this->m_ptr_glVertexAttribP4ui)this->m_ptr_glVertexAttribP4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC)&ProfilingTableDecorator::m_glVertexAttribP4ui_profile;
+this->m_names[52] = "glVertexAttribL2d";
+this->m_orig_glVertexAttribL2d = this->m_ptr_glVertexAttribL2d;
+if(this->m_ptr_glVertexAttribL2d)this->m_ptr_glVertexAttribL2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC)&ProfilingTableDecorator::m_glVertexAttribL2d_profile;
+this->m_names[53] = "glGetMultisamplefv";
+this->m_orig_glGetMultisamplefv = this->m_ptr_glGetMultisamplefv;
+if(this->m_ptr_glGetMultisamplefv)this->m_ptr_glGetMultisamplefv = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC)&ProfilingTableDecorator::m_glGetMultisamplefv_profile;
+this->m_names[54] = "glCompressedMultiTexSubImage3DEXT";
+this->m_orig_glCompressedMultiTexSubImage3DEXT = this->m_ptr_glCompressedMultiTexSubImage3DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage3DEXT)this->m_ptr_glCompressedMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage3DEXT_profile;
+this->m_names[55] = "glVDPAURegisterOutputSurfaceNV";
+this->m_orig_glVDPAURegisterOutputSurfaceNV = this->m_ptr_glVDPAURegisterOutputSurfaceNV;
+if(this->m_ptr_glVDPAURegisterOutputSurfaceNV)this->m_ptr_glVDPAURegisterOutputSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAURegisterOutputSurfaceNV_profile;
+this->m_names[56] = "glMinSampleShading";
+this->m_orig_glMinSampleShading = this->m_ptr_glMinSampleShading;
+if(this->m_ptr_glMinSampleShading)this->m_ptr_glMinSampleShading = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC)&ProfilingTableDecorator::m_glMinSampleShading_profile;
+this->m_names[57] = "glProgramUniform4fEXT";
+this->m_orig_glProgramUniform4fEXT = this->m_ptr_glProgramUniform4fEXT;
+if(this->m_ptr_glProgramUniform4fEXT)this->m_ptr_glProgramUniform4fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4fEXT_profile;
+this->m_names[58] = "glCoverStrokePathNV";
+this->m_orig_glCoverStrokePathNV = this->m_ptr_glCoverStrokePathNV;
+if(this->m_ptr_glCoverStrokePathNV)this->m_ptr_glCoverStrokePathNV = (FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glCoverStrokePathNV_profile;
+this->m_names[59] = "glTextureImage2DMultisampleNV";
+this->m_orig_glTextureImage2DMultisampleNV = this->m_ptr_glTextureImage2DMultisampleNV;
+if(this->m_ptr_glTextureImage2DMultisampleNV)this->m_ptr_glTextureImage2DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)&ProfilingTableDecorator::m_glTextureImage2DMultisampleNV_profile;
+this->m_names[60] = "glVertex3bOES";
+this->m_orig_glVertex3bOES = this->m_ptr_glVertex3bOES;
+if(this->m_ptr_glVertex3bOES)this->m_ptr_glVertex3bOES = (FunctionTable::MEMBERPFNGLVERTEX3BOESPROC)&ProfilingTableDecorator::m_glVertex3bOES_profile;
+this->m_names[61] = "glImportMemoryWin32HandleEXT";
+this->m_orig_glImportMemoryWin32HandleEXT = this->m_ptr_glImportMemoryWin32HandleEXT;
+if(this->m_ptr_glImportMemoryWin32HandleEXT)this->m_ptr_glImportMemoryWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC)&ProfilingTableDecorator::m_glImportMemoryWin32HandleEXT_profile;
+this->m_names[62] = "glTessellationFactorAMD";
+this->m_orig_glTessellationFactorAMD = this->m_ptr_glTessellationFactorAMD;
+if(this->m_ptr_glTessellationFactorAMD)this->m_ptr_glTessellationFactorAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC)&ProfilingTableDecorator::m_glTessellationFactorAMD_profile;
+this->m_names[63] = "glDebugMessageControl";
+this->m_orig_glDebugMessageControl = this->m_ptr_glDebugMessageControl;
+if(this->m_ptr_glDebugMessageControl)this->m_ptr_glDebugMessageControl = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC)&ProfilingTableDecorator::m_glDebugMessageControl_profile;
+this->m_names[64] = "glIsObjectBufferATI";
+this->m_orig_glIsObjectBufferATI = this->m_ptr_glIsObjectBufferATI;
+if(this->m_ptr_glIsObjectBufferATI)this->m_ptr_glIsObjectBufferATI = (FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glIsObjectBufferATI_profile;
+this->m_names[65] = "glPopAttrib";
+this->m_orig_glPopAttrib = this->m_ptr_glPopAttrib;
+if(this->m_ptr_glPopAttrib)this->m_ptr_glPopAttrib = (FunctionTable::MEMBERPFNGLPOPATTRIBPROC)&ProfilingTableDecorator::m_glPopAttrib_profile;
+this->m_names[66] = "glProgramUniform4iEXT";
+this->m_orig_glProgramUniform4iEXT = this->m_ptr_glProgramUniform4iEXT;
+if(this->m_ptr_glProgramUniform4iEXT)this->m_ptr_glProgramUniform4iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4iEXT_profile;
+this->m_names[67] = "glVertexAttrib4ubNV";
+this->m_orig_glVertexAttrib4ubNV = this->m_ptr_glVertexAttrib4ubNV;
+if(this->m_ptr_glVertexAttrib4ubNV)this->m_ptr_glVertexAttrib4ubNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubNV_profile;
+this->m_names[68] = "glColorMaterial";
+this->m_orig_glColorMaterial = this->m_ptr_glColorMaterial;
+if(this->m_ptr_glColorMaterial)this->m_ptr_glColorMaterial = (FunctionTable::MEMBERPFNGLCOLORMATERIALPROC)&ProfilingTableDecorator::m_glColorMaterial_profile;
+this->m_names[69] = "glVertexAttrib2svARB";
+this->m_orig_glVertexAttrib2svARB = this->m_ptr_glVertexAttrib2svARB;
+if(this->m_ptr_glVertexAttrib2svARB)this->m_ptr_glVertexAttrib2svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2svARB_profile;
+this->m_names[70] = "glMinSampleShadingARB";
+this->m_orig_glMinSampleShadingARB = this->m_ptr_glMinSampleShadingARB;
+if(this->m_ptr_glMinSampleShadingARB)this->m_ptr_glMinSampleShadingARB = (FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC)&ProfilingTableDecorator::m_glMinSampleShadingARB_profile;
+this->m_names[71] = "glColor3b";
+this->m_orig_glColor3b = this->m_ptr_glColor3b;
+if(this->m_ptr_glColor3b)this->m_ptr_glColor3b = (FunctionTable::MEMBERPFNGLCOLOR3BPROC)&ProfilingTableDecorator::m_glColor3b_profile;
+this->m_names[72] = "glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profile;
+this->m_names[73] = "glColor3f";
+this->m_orig_glColor3f = this->m_ptr_glColor3f;
+if(this->m_ptr_glColor3f)this->m_ptr_glColor3f = (FunctionTable::MEMBERPFNGLCOLOR3FPROC)&ProfilingTableDecorator::m_glColor3f_profile;
+this->m_names[74] = "glVDPAUGetSurfaceivNV";
+this->m_orig_glVDPAUGetSurfaceivNV = this->m_ptr_glVDPAUGetSurfaceivNV;
+if(this->m_ptr_glVDPAUGetSurfaceivNV)this->m_ptr_glVDPAUGetSurfaceivNV = (FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC)&ProfilingTableDecorator::m_glVDPAUGetSurfaceivNV_profile;
+this->m_names[75] = "glColor3d";
+this->m_orig_glColor3d = this->m_ptr_glColor3d;
+if(this->m_ptr_glColor3d)this->m_ptr_glColor3d = (FunctionTable::MEMBERPFNGLCOLOR3DPROC)&ProfilingTableDecorator::m_glColor3d_profile;
+this->m_names[76] = "glGetnMapiv";
+this->m_orig_glGetnMapiv = this->m_ptr_glGetnMapiv;
+if(this->m_ptr_glGetnMapiv)this->m_ptr_glGetnMapiv = (FunctionTable::MEMBERPFNGLGETNMAPIVPROC)&ProfilingTableDecorator::m_glGetnMapiv_profile;
+this->m_names[77] = "glColor3i";
+this->m_orig_glColor3i = this->m_ptr_glColor3i;
+if(this->m_ptr_glColor3i)this->m_ptr_glColor3i = (FunctionTable::MEMBERPFNGLCOLOR3IPROC)&ProfilingTableDecorator::m_glColor3i_profile;
+this->m_names[78] = "glGetInternalformatSampleivNV";
+this->m_orig_glGetInternalformatSampleivNV = this->m_ptr_glGetInternalformatSampleivNV;
+if(this->m_ptr_glGetInternalformatSampleivNV)this->m_ptr_glGetInternalformatSampleivNV = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC)&ProfilingTableDecorator::m_glGetInternalformatSampleivNV_profile;
+this->m_names[79] = "glVertexAttrib4ubv";
+this->m_orig_glVertexAttrib4ubv = this->m_ptr_glVertexAttrib4ubv;
+if(this->m_ptr_glVertexAttrib4ubv)this->m_ptr_glVertexAttrib4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubv_profile;
+this->m_names[80] = "glColor3s";
+this->m_orig_glColor3s = this->m_ptr_glColor3s;
+if(this->m_ptr_glColor3s)this->m_ptr_glColor3s = (FunctionTable::MEMBERPFNGLCOLOR3SPROC)&ProfilingTableDecorator::m_glColor3s_profile;
+this->m_names[81] = "glVertexAttribs4hvNV";
+this->m_orig_glVertexAttribs4hvNV = this->m_ptr_glVertexAttribs4hvNV;
+if(this->m_ptr_glVertexAttribs4hvNV)this->m_ptr_glVertexAttribs4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4hvNV_profile;
+this->m_names[82] = "glVertexAttrib4NubvARB";
+this->m_orig_glVertexAttrib4NubvARB = this->m_ptr_glVertexAttrib4NubvARB;
+if(this->m_ptr_glVertexAttrib4NubvARB)this->m_ptr_glVertexAttrib4NubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NubvARB_profile;
+this->m_names[83] = "glMultiTexCoord3hvNV";
+this->m_orig_glMultiTexCoord3hvNV = this->m_ptr_glMultiTexCoord3hvNV;
+if(this->m_ptr_glMultiTexCoord3hvNV)this->m_ptr_glMultiTexCoord3hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3hvNV_profile;
+this->m_names[84] = "glMatrixPushEXT";
+this->m_orig_glMatrixPushEXT = this->m_ptr_glMatrixPushEXT;
+if(this->m_ptr_glMatrixPushEXT)this->m_ptr_glMatrixPushEXT = (FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC)&ProfilingTableDecorator::m_glMatrixPushEXT_profile;
+this->m_names[85] = "glProgramUniform2fEXT";
+this->m_orig_glProgramUniform2fEXT = this->m_ptr_glProgramUniform2fEXT;
+if(this->m_ptr_glProgramUniform2fEXT)this->m_ptr_glProgramUniform2fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2fEXT_profile;
+this->m_names[86] = "glGetVertexArrayIndexediv";
+this->m_orig_glGetVertexArrayIndexediv = this->m_ptr_glGetVertexArrayIndexediv;
+if(this->m_ptr_glGetVertexArrayIndexediv)this->m_ptr_glGetVertexArrayIndexediv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC)&ProfilingTableDecorator::m_glGetVertexArrayIndexediv_profile;
+this->m_names[87] = "glBlitFramebuffer";
+this->m_orig_glBlitFramebuffer = this->m_ptr_glBlitFramebuffer;
+if(this->m_ptr_glBlitFramebuffer)this->m_ptr_glBlitFramebuffer = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBlitFramebuffer_profile;
+this->m_names[88] = "glMultiTexCoordP2ui";
+this->m_orig_glMultiTexCoordP2ui = this->m_ptr_glMultiTexCoordP2ui;
+if(this->m_ptr_glMultiTexCoordP2ui)this->m_ptr_glMultiTexCoordP2ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP2ui_profile;
+this->m_names[89] = "glColorPointerListIBM";
+this->m_orig_glColorPointerListIBM = this->m_ptr_glColorPointerListIBM;
+if(this->m_ptr_glColorPointerListIBM)this->m_ptr_glColorPointerListIBM = (FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glColorPointerListIBM_profile;
+this->m_names[90] = "glVertexAttribL4d";
+this->m_orig_glVertexAttribL4d = this->m_ptr_glVertexAttribL4d;
+if(this->m_ptr_glVertexAttribL4d)this->m_ptr_glVertexAttribL4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC)&ProfilingTableDecorator::m_glVertexAttribL4d_profile;
+this->m_names[91] = "glGetFragmentMaterialfvSGIX";
+this->m_orig_glGetFragmentMaterialfvSGIX = this->m_ptr_glGetFragmentMaterialfvSGIX;
+if(this->m_ptr_glGetFragmentMaterialfvSGIX)this->m_ptr_glGetFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentMaterialfvSGIX_profile;
+this->m_names[92] = "glVertex2iv";
+this->m_orig_glVertex2iv = this->m_ptr_glVertex2iv;
+if(this->m_ptr_glVertex2iv)this->m_ptr_glVertex2iv = (FunctionTable::MEMBERPFNGLVERTEX2IVPROC)&ProfilingTableDecorator::m_glVertex2iv_profile;
+this->m_names[93] = "glGetTexEnvxvOES";
+this->m_orig_glGetTexEnvxvOES = this->m_ptr_glGetTexEnvxvOES;
+if(this->m_ptr_glGetTexEnvxvOES)this->m_ptr_glGetTexEnvxvOES = (FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC)&ProfilingTableDecorator::m_glGetTexEnvxvOES_profile;
+this->m_names[94] = "glUniformMatrix3dv";
+this->m_orig_glUniformMatrix3dv = this->m_ptr_glUniformMatrix3dv;
+if(this->m_ptr_glUniformMatrix3dv)this->m_ptr_glUniformMatrix3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3dv_profile;
+this->m_names[95] = "glGetVertexAttribLdvEXT";
+this->m_orig_glGetVertexAttribLdvEXT = this->m_ptr_glGetVertexAttribLdvEXT;
+if(this->m_ptr_glGetVertexAttribLdvEXT)this->m_ptr_glGetVertexAttribLdvEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribLdvEXT_profile;
+this->m_names[96] = "glTexCoordP3uiv";
+this->m_orig_glTexCoordP3uiv = this->m_ptr_glTexCoordP3uiv;
+if(this->m_ptr_glTexCoordP3uiv)this->m_ptr_glTexCoordP3uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC)&ProfilingTableDecorator::m_glTexCoordP3uiv_profile;
+this->m_names[97] = "glDeformationMap3dSGIX";
+this->m_orig_glDeformationMap3dSGIX = this->m_ptr_glDeformationMap3dSGIX;
+if(this->m_ptr_glDeformationMap3dSGIX)this->m_ptr_glDeformationMap3dSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC)&ProfilingTableDecorator::m_glDeformationMap3dSGIX_profile;
+this->m_names[98] = "glResumeTransformFeedback";
+this->m_orig_glResumeTransformFeedback = this->m_ptr_glResumeTransformFeedback;
+if(this->m_ptr_glResumeTransformFeedback)this->m_ptr_glResumeTransformFeedback = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glResumeTransformFeedback_profile;
+this->m_names[99] = "glInsertEventMarkerEXT";
+this->m_orig_glInsertEventMarkerEXT = this->m_ptr_glInsertEventMarkerEXT;
+if(this->m_ptr_glInsertEventMarkerEXT)this->m_ptr_glInsertEventMarkerEXT = (FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC)&ProfilingTableDecorator::m_glInsertEventMarkerEXT_profile;
+this->m_names[100] = "glTessellationModeAMD";
+this->m_orig_glTessellationModeAMD = this->m_ptr_glTessellationModeAMD;
+if(this->m_ptr_glTessellationModeAMD)this->m_ptr_glTessellationModeAMD = (FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC)&ProfilingTableDecorator::m_glTessellationModeAMD_profile;
+this->m_names[101] = "glDrawCommandsAddressNV";
+this->m_orig_glDrawCommandsAddressNV = this->m_ptr_glDrawCommandsAddressNV;
+if(this->m_ptr_glDrawCommandsAddressNV)this->m_ptr_glDrawCommandsAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsAddressNV_profile;
+this->m_names[102] = "glFogi";
+this->m_orig_glFogi = this->m_ptr_glFogi;
+if(this->m_ptr_glFogi)this->m_ptr_glFogi = (FunctionTable::MEMBERPFNGLFOGIPROC)&ProfilingTableDecorator::m_glFogi_profile;
+this->m_names[103] = "glGetTexParameterxvOES";
+this->m_orig_glGetTexParameterxvOES = this->m_ptr_glGetTexParameterxvOES;
+if(this->m_ptr_glGetTexParameterxvOES)this->m_ptr_glGetTexParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetTexParameterxvOES_profile;
+this->m_names[104] = "glVertexPointer";
+this->m_orig_glVertexPointer = this->m_ptr_glVertexPointer;
+if(this->m_ptr_glVertexPointer)this->m_ptr_glVertexPointer = (FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC)&ProfilingTableDecorator::m_glVertexPointer_profile;
+this->m_names[105] = "glGetPerfMonitorCounterDataAMD";
+this->m_orig_glGetPerfMonitorCounterDataAMD = this->m_ptr_glGetPerfMonitorCounterDataAMD;
+if(this->m_ptr_glGetPerfMonitorCounterDataAMD)this->m_ptr_glGetPerfMonitorCounterDataAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterDataAMD_profile;
+this->m_names[106] = "glFogf";
+this->m_orig_glFogf = this->m_ptr_glFogf;
+if(this->m_ptr_glFogf)this->m_ptr_glFogf = (FunctionTable::MEMBERPFNGLFOGFPROC)&ProfilingTableDecorator::m_glFogf_profile;
+this->m_names[107] = "glMultiTexCoord1d";
+this->m_orig_glMultiTexCoord1d = this->m_ptr_glMultiTexCoord1d;
+if(this->m_ptr_glMultiTexCoord1d)this->m_ptr_glMultiTexCoord1d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC)&ProfilingTableDecorator::m_glMultiTexCoord1d_profile;
+this->m_names[108] = "glMultiTexCoord1f";
+this->m_orig_glMultiTexCoord1f = this->m_ptr_glMultiTexCoord1f;
+if(this->m_ptr_glMultiTexCoord1f)this->m_ptr_glMultiTexCoord1f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC)&ProfilingTableDecorator::m_glMultiTexCoord1f_profile;
+this->m_names[109] = "glGetMultiTexParameterivEXT";
+this->m_orig_glGetMultiTexParameterivEXT = this->m_ptr_glGetMultiTexParameterivEXT;
+if(this->m_ptr_glGetMultiTexParameterivEXT)this->m_ptr_glGetMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterivEXT_profile;
+this->m_names[110] = "glProgramUniformMatrix3x4fvEXT";
+this->m_orig_glProgramUniformMatrix3x4fvEXT = this->m_ptr_glProgramUniformMatrix3x4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x4fvEXT)this->m_ptr_glProgramUniformMatrix3x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4fvEXT_profile;
+this->m_names[111] = "glVertexAttribI2i";
+this->m_orig_glVertexAttribI2i = this->m_ptr_glVertexAttribI2i;
+if(this->m_ptr_glVertexAttribI2i)this->m_ptr_glVertexAttribI2i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC)&ProfilingTableDecorator::m_glVertexAttribI2i_profile;
+this->m_names[112] = "glMultiTexCoord1i";
+this->m_orig_glMultiTexCoord1i = this->m_ptr_glMultiTexCoord1i;
+if(this->m_ptr_glMultiTexCoord1i)this->m_ptr_glMultiTexCoord1i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC)&ProfilingTableDecorator::m_glMultiTexCoord1i_profile;
+this->m_names[113] = "glDeleteSemaphoresEXT";
+this->m_orig_glDeleteSemaphoresEXT = this->m_ptr_glDeleteSemaphoresEXT;
+if(this->m_ptr_glDeleteSemaphoresEXT)this->m_ptr_glDeleteSemaphoresEXT = (FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC)&ProfilingTableDecorator::m_glDeleteSemaphoresEXT_profile;
+this->m_names[114] = "glLoadProgramNV";
+this->m_orig_glLoadProgramNV = this->m_ptr_glLoadProgramNV;
+if(this->m_ptr_glLoadProgramNV)this->m_ptr_glLoadProgramNV = (FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC)&ProfilingTableDecorator::m_glLoadProgramNV_profile;
+this->m_names[115] = "glWriteMaskEXT";
+this->m_orig_glWriteMaskEXT = this->m_ptr_glWriteMaskEXT;
+if(this->m_ptr_glWriteMaskEXT)this->m_ptr_glWriteMaskEXT = (FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC)&ProfilingTableDecorator::m_glWriteMaskEXT_profile;
+this->m_names[116] = "glGetGraphicsResetStatus";
+this->m_orig_glGetGraphicsResetStatus = this->m_ptr_glGetGraphicsResetStatus;
+if(this->m_ptr_glGetGraphicsResetStatus)this->m_ptr_glGetGraphicsResetStatus = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC)&ProfilingTableDecorator::m_glGetGraphicsResetStatus_profile;
+this->m_names[117] = "glVertexAttrib1fv";
+this->m_orig_glVertexAttrib1fv = this->m_ptr_glVertexAttrib1fv;
+if(this->m_ptr_glVertexAttrib1fv)this->m_ptr_glVertexAttrib1fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fv_profile;
+this->m_names[118] = "glMultiTexCoord1s";
+this->m_orig_glMultiTexCoord1s = this->m_ptr_glMultiTexCoord1s;
+if(this->m_ptr_glMultiTexCoord1s)this->m_ptr_glMultiTexCoord1s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC)&ProfilingTableDecorator::m_glMultiTexCoord1s_profile;
+this->m_names[119] = "glImageTransformParameterfvHP";
+this->m_orig_glImageTransformParameterfvHP = this->m_ptr_glImageTransformParameterfvHP;
+if(this->m_ptr_glImageTransformParameterfvHP)this->m_ptr_glImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterfvHP_profile;
+this->m_names[120] = "glFramebufferTexture2D";
+this->m_orig_glFramebufferTexture2D = this->m_ptr_glFramebufferTexture2D;
+if(this->m_ptr_glFramebufferTexture2D)this->m_ptr_glFramebufferTexture2D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC)&ProfilingTableDecorator::m_glFramebufferTexture2D_profile;
+this->m_names[121] = "glGetFragmentLightfvSGIX";
+this->m_orig_glGetFragmentLightfvSGIX = this->m_ptr_glGetFragmentLightfvSGIX;
+if(this->m_ptr_glGetFragmentLightfvSGIX)this->m_ptr_glGetFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentLightfvSGIX_profile;
+this->m_names[122] = "glListParameterfSGIX";
+this->m_orig_glListParameterfSGIX = this->m_ptr_glListParameterfSGIX;
+if(this->m_ptr_glListParameterfSGIX)this->m_ptr_glListParameterfSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC)&ProfilingTableDecorator::m_glListParameterfSGIX_profile;
+this->m_names[123] = "glTexCoord3sv";
+this->m_orig_glTexCoord3sv = this->m_ptr_glTexCoord3sv;
+if(this->m_ptr_glTexCoord3sv)this->m_ptr_glTexCoord3sv = (FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC)&ProfilingTableDecorator::m_glTexCoord3sv_profile;
+this->m_names[124] = "glNamedFramebufferRenderbufferEXT";
+this->m_orig_glNamedFramebufferRenderbufferEXT = this->m_ptr_glNamedFramebufferRenderbufferEXT;
+if(this->m_ptr_glNamedFramebufferRenderbufferEXT)this->m_ptr_glNamedFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferRenderbufferEXT_profile;
+this->m_names[125] = "glFragmentLightModelfSGIX";
+this->m_orig_glFragmentLightModelfSGIX = this->m_ptr_glFragmentLightModelfSGIX;
+if(this->m_ptr_glFragmentLightModelfSGIX)this->m_ptr_glFragmentLightModelfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelfSGIX_profile;
+this->m_names[126] = "glIndexPointerEXT";
+this->m_orig_glIndexPointerEXT = this->m_ptr_glIndexPointerEXT;
+if(this->m_ptr_glIndexPointerEXT)this->m_ptr_glIndexPointerEXT = (FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC)&ProfilingTableDecorator::m_glIndexPointerEXT_profile;
+this->m_names[127] = "glBlendEquationSeparateATI";
+this->m_orig_glBlendEquationSeparateATI = this->m_ptr_glBlendEquationSeparateATI;
+if(this->m_ptr_glBlendEquationSeparateATI)this->m_ptr_glBlendEquationSeparateATI = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateATI_profile;
+this->m_names[128] = "glVertexArrayAttribIFormat";
+this->m_orig_glVertexArrayAttribIFormat = this->m_ptr_glVertexArrayAttribIFormat;
+if(this->m_ptr_glVertexArrayAttribIFormat)this->m_ptr_glVertexArrayAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribIFormat_profile;
+this->m_names[129] = "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profile;
+this->m_names[130] = "glReplacementCodeubvSUN";
+this->m_orig_glReplacementCodeubvSUN = this->m_ptr_glReplacementCodeubvSUN;
+if(this->m_ptr_glReplacementCodeubvSUN)this->m_ptr_glReplacementCodeubvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeubvSUN_profile;
+this->m_names[131] = "glGenFramebuffers";
+this->m_orig_glGenFramebuffers = this->m_ptr_glGenFramebuffers;
+if(this->m_ptr_glGenFramebuffers)this->m_ptr_glGenFramebuffers = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glGenFramebuffers_profile;
+this->m_names[132] = "glPixelMapx";
+this->m_orig_glPixelMapx = this->m_ptr_glPixelMapx;
+if(this->m_ptr_glPixelMapx)this->m_ptr_glPixelMapx = (FunctionTable::MEMBERPFNGLPIXELMAPXPROC)&ProfilingTableDecorator::m_glPixelMapx_profile;
+this->m_names[133] = "glTexSubImage3DEXT";
+this->m_orig_glTexSubImage3DEXT = this->m_ptr_glTexSubImage3DEXT;
+if(this->m_ptr_glTexSubImage3DEXT)this->m_ptr_glTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage3DEXT_profile;
+this->m_names[134] = "glGetAttachedShaders";
+this->m_orig_glGetAttachedShaders = this->m_ptr_glGetAttachedShaders;
+if(this->m_ptr_glGetAttachedShaders)this->m_ptr_glGetAttachedShaders = (FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC)&ProfilingTableDecorator::m_glGetAttachedShaders_profile;
+this->m_names[135] = "glGetPixelTexGenParameterfvSGIS";
+this->m_orig_glGetPixelTexGenParameterfvSGIS = this->m_ptr_glGetPixelTexGenParameterfvSGIS;
+if(this->m_ptr_glGetPixelTexGenParameterfvSGIS)this->m_ptr_glGetPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glGetPixelTexGenParameterfvSGIS_profile;
+this->m_names[136] = "glReplacementCodeuiNormal3fVertex3fSUN";
+this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fSUN_profile;
+this->m_names[137] = "glGetDebugMessageLogAMD";
+this->m_orig_glGetDebugMessageLogAMD = this->m_ptr_glGetDebugMessageLogAMD;
+if(this->m_ptr_glGetDebugMessageLogAMD)this->m_ptr_glGetDebugMessageLogAMD = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC)&ProfilingTableDecorator::m_glGetDebugMessageLogAMD_profile;
+this->m_names[138] = "glVertexStream4sATI";
+this->m_orig_glVertexStream4sATI = this->m_ptr_glVertexStream4sATI;
+if(this->m_ptr_glVertexStream4sATI)this->m_ptr_glVertexStream4sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC)&ProfilingTableDecorator::m_glVertexStream4sATI_profile;
+this->m_names[139] = "glVertexAttribs4dvNV";
+this->m_orig_glVertexAttribs4dvNV = this->m_ptr_glVertexAttribs4dvNV;
+if(this->m_ptr_glVertexAttribs4dvNV)this->m_ptr_glVertexAttribs4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4dvNV_profile;
+this->m_names[140] = "glGetnMapdvARB";
+this->m_orig_glGetnMapdvARB = this->m_ptr_glGetnMapdvARB;
+if(this->m_ptr_glGetnMapdvARB)this->m_ptr_glGetnMapdvARB = (FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC)&ProfilingTableDecorator::m_glGetnMapdvARB_profile;
+this->m_names[141] = "glOrthofOES";
+this->m_orig_glOrthofOES = this->m_ptr_glOrthofOES;
+if(this->m_ptr_glOrthofOES)this->m_ptr_glOrthofOES = (FunctionTable::MEMBERPFNGLORTHOFOESPROC)&ProfilingTableDecorator::m_glOrthofOES_profile;
+this->m_names[142] = "glViewportArrayv";
+this->m_orig_glViewportArrayv = this->m_ptr_glViewportArrayv;
+if(this->m_ptr_glViewportArrayv)this->m_ptr_glViewportArrayv = (FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC)&ProfilingTableDecorator::m_glViewportArrayv_profile;
+this->m_names[143] = "glDrawElementArrayATI";
+this->m_orig_glDrawElementArrayATI = this->m_ptr_glDrawElementArrayATI;
+if(this->m_ptr_glDrawElementArrayATI)this->m_ptr_glDrawElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC)&ProfilingTableDecorator::m_glDrawElementArrayATI_profile;
+this->m_names[144] = "glBufferStorageMemEXT";
+this->m_orig_glBufferStorageMemEXT = this->m_ptr_glBufferStorageMemEXT;
+if(this->m_ptr_glBufferStorageMemEXT)this->m_ptr_glBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC)&ProfilingTableDecorator::m_glBufferStorageMemEXT_profile;
+this->m_names[145] = "glGetPathColorGenfvNV";
+this->m_orig_glGetPathColorGenfvNV = this->m_ptr_glGetPathColorGenfvNV;
+if(this->m_ptr_glGetPathColorGenfvNV)this->m_ptr_glGetPathColorGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC)&ProfilingTableDecorator::m_glGetPathColorGenfvNV_profile;
+this->m_names[146] = "glWindowPos3iMESA";
+this->m_orig_glWindowPos3iMESA = this->m_ptr_glWindowPos3iMESA;
+if(this->m_ptr_glWindowPos3iMESA)this->m_ptr_glWindowPos3iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC)&ProfilingTableDecorator::m_glWindowPos3iMESA_profile;
+this->m_names[147] = "glMultiTexCoord2s";
+this->m_orig_glMultiTexCoord2s = this->m_ptr_glMultiTexCoord2s;
+if(this->m_ptr_glMultiTexCoord2s)this->m_ptr_glMultiTexCoord2s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC)&ProfilingTableDecorator::m_glMultiTexCoord2s_profile;
+this->m_names[148] = "glVertex3dv";
+this->m_orig_glVertex3dv = this->m_ptr_glVertex3dv;
+if(this->m_ptr_glVertex3dv)this->m_ptr_glVertex3dv = (FunctionTable::MEMBERPFNGLVERTEX3DVPROC)&ProfilingTableDecorator::m_glVertex3dv_profile;
+this->m_names[149] = "glVertexAttribI3uivEXT";
+this->m_orig_glVertexAttribI3uivEXT = this->m_ptr_glVertexAttribI3uivEXT;
+if(this->m_ptr_glVertexAttribI3uivEXT)this->m_ptr_glVertexAttribI3uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3uivEXT_profile;
+this->m_names[150] = "glUniform3ui64ARB";
+this->m_orig_glUniform3ui64ARB = this->m_ptr_glUniform3ui64ARB;
+if(this->m_ptr_glUniform3ui64ARB)this->m_ptr_glUniform3ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC)&ProfilingTableDecorator::m_glUniform3ui64ARB_profile;
+this->m_names[151] = "glVertexAttrib2fvNV";
+this->m_orig_glVertexAttrib2fvNV = this->m_ptr_glVertexAttrib2fvNV;
+if(this->m_ptr_glVertexAttrib2fvNV)this->m_ptr_glVertexAttrib2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fvNV_profile;
+this->m_names[152] = "glGetNamedBufferSubDataEXT";
+this->m_orig_glGetNamedBufferSubDataEXT = this->m_ptr_glGetNamedBufferSubDataEXT;
+if(this->m_ptr_glGetNamedBufferSubDataEXT)this->m_ptr_glGetNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferSubDataEXT_profile;
+this->m_names[153] = "glConvolutionFilter2D";
+this->m_orig_glConvolutionFilter2D = this->m_ptr_glConvolutionFilter2D;
+if(this->m_ptr_glConvolutionFilter2D)this->m_ptr_glConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC)&ProfilingTableDecorator::m_glConvolutionFilter2D_profile;
+this->m_names[154] = "glMemoryBarrierByRegion";
+this->m_orig_glMemoryBarrierByRegion = this->m_ptr_glMemoryBarrierByRegion;
+if(this->m_ptr_glMemoryBarrierByRegion)this->m_ptr_glMemoryBarrierByRegion = (FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC)&ProfilingTableDecorator::m_glMemoryBarrierByRegion_profile;
+this->m_names[155] = "glVertexArrayBindingDivisor";
+this->m_orig_glVertexArrayBindingDivisor = this->m_ptr_glVertexArrayBindingDivisor;
+if(this->m_ptr_glVertexArrayBindingDivisor)this->m_ptr_glVertexArrayBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC)&ProfilingTableDecorator::m_glVertexArrayBindingDivisor_profile;
+this->m_names[156] = "glMatrixRotatedEXT";
+this->m_orig_glMatrixRotatedEXT = this->m_ptr_glMatrixRotatedEXT;
+if(this->m_ptr_glMatrixRotatedEXT)this->m_ptr_glMatrixRotatedEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC)&ProfilingTableDecorator::m_glMatrixRotatedEXT_profile;
+this->m_names[157] = "glTexCoord2sv";
+this->m_orig_glTexCoord2sv = this->m_ptr_glTexCoord2sv;
+if(this->m_ptr_glTexCoord2sv)this->m_ptr_glTexCoord2sv = (FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC)&ProfilingTableDecorator::m_glTexCoord2sv_profile;
+this->m_names[158] = "glIsProgramNV";
+this->m_orig_glIsProgramNV = this->m_ptr_glIsProgramNV;
+if(this->m_ptr_glIsProgramNV)this->m_ptr_glIsProgramNV = (FunctionTable::MEMBERPFNGLISPROGRAMNVPROC)&ProfilingTableDecorator::m_glIsProgramNV_profile;
+this->m_names[159] = "glUniform2dv";
+this->m_orig_glUniform2dv = this->m_ptr_glUniform2dv;
+if(this->m_ptr_glUniform2dv)this->m_ptr_glUniform2dv = (FunctionTable::MEMBERPFNGLUNIFORM2DVPROC)&ProfilingTableDecorator::m_glUniform2dv_profile;
+this->m_names[160] = "glGetPixelMapuiv";
+this->m_orig_glGetPixelMapuiv = this->m_ptr_glGetPixelMapuiv;
+if(this->m_ptr_glGetPixelMapuiv)this->m_ptr_glGetPixelMapuiv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glGetPixelMapuiv_profile;
+this->m_names[161] = "glDepthBoundsEXT";
+this->m_orig_glDepthBoundsEXT = this->m_ptr_glDepthBoundsEXT;
+if(this->m_ptr_glDepthBoundsEXT)this->m_ptr_glDepthBoundsEXT = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC)&ProfilingTableDecorator::m_glDepthBoundsEXT_profile;
+this->m_names[162] = "glVertexAttrib4hvNV";
+this->m_orig_glVertexAttrib4hvNV = this->m_ptr_glVertexAttrib4hvNV;
+if(this->m_ptr_glVertexAttrib4hvNV)this->m_ptr_glVertexAttrib4hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4hvNV_profile;
+this->m_names[163] = "glMultiTexParameteriEXT";
+this->m_orig_glMultiTexParameteriEXT = this->m_ptr_glMultiTexParameteriEXT;
+if(this->m_ptr_glMultiTexParameteriEXT)this->m_ptr_glMultiTexParameteriEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameteriEXT_profile;
+this->m_names[164] = "glGetPointerv";
+this->m_orig_glGetPointerv = this->m_ptr_glGetPointerv;
+if(this->m_ptr_glGetPointerv)this->m_ptr_glGetPointerv = (FunctionTable::MEMBERPFNGLGETPOINTERVPROC)&ProfilingTableDecorator::m_glGetPointerv_profile;
+this->m_names[165] = "glPathCommandsNV";
+this->m_orig_glPathCommandsNV = this->m_ptr_glPathCommandsNV;
+if(this->m_ptr_glPathCommandsNV)this->m_ptr_glPathCommandsNV = (FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC)&ProfilingTableDecorator::m_glPathCommandsNV_profile;
+this->m_names[166] = "glGetListParameterfvSGIX";
+this->m_orig_glGetListParameterfvSGIX = this->m_ptr_glGetListParameterfvSGIX;
+if(this->m_ptr_glGetListParameterfvSGIX)this->m_ptr_glGetListParameterfvSGIX = (FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glGetListParameterfvSGIX_profile;
+this->m_names[167] = "glGetUniformuiv";
+this->m_orig_glGetUniformuiv = this->m_ptr_glGetUniformuiv;
+if(this->m_ptr_glGetUniformuiv)this->m_ptr_glGetUniformuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC)&ProfilingTableDecorator::m_glGetUniformuiv_profile;
+this->m_names[168] = "glDebugMessageInsertAMD";
+this->m_orig_glDebugMessageInsertAMD = this->m_ptr_glDebugMessageInsertAMD;
+if(this->m_ptr_glDebugMessageInsertAMD)this->m_ptr_glDebugMessageInsertAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC)&ProfilingTableDecorator::m_glDebugMessageInsertAMD_profile;
+this->m_names[169] = "glFrustum";
+this->m_orig_glFrustum = this->m_ptr_glFrustum;
+if(this->m_ptr_glFrustum)this->m_ptr_glFrustum = (FunctionTable::MEMBERPFNGLFRUSTUMPROC)&ProfilingTableDecorator::m_glFrustum_profile;
+this->m_names[170] = "glVertexAttribL1ui64vNV";
+this->m_orig_glVertexAttribL1ui64vNV = this->m_ptr_glVertexAttribL1ui64vNV;
+if(this->m_ptr_glVertexAttribL1ui64vNV)this->m_ptr_glVertexAttribL1ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64vNV_profile;
+this->m_names[171] = "glClearColorxOES";
+this->m_orig_glClearColorxOES = this->m_ptr_glClearColorxOES;
+if(this->m_ptr_glClearColorxOES)this->m_ptr_glClearColorxOES = (FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC)&ProfilingTableDecorator::m_glClearColorxOES_profile;
+this->m_names[172] = "glProgramUniformMatrix3fv";
+this->m_orig_glProgramUniformMatrix3fv = this->m_ptr_glProgramUniformMatrix3fv;
+if(this->m_ptr_glProgramUniformMatrix3fv)this->m_ptr_glProgramUniformMatrix3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3fv_profile;
+this->m_names[173] = "glSampleMaskIndexedNV";
+this->m_orig_glSampleMaskIndexedNV = this->m_ptr_glSampleMaskIndexedNV;
+if(this->m_ptr_glSampleMaskIndexedNV)this->m_ptr_glSampleMaskIndexedNV = (FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC)&ProfilingTableDecorator::m_glSampleMaskIndexedNV_profile;
+this->m_names[174] = "glCompileShaderIncludeARB";
+this->m_orig_glCompileShaderIncludeARB = this->m_ptr_glCompileShaderIncludeARB;
+if(this->m_ptr_glCompileShaderIncludeARB)this->m_ptr_glCompileShaderIncludeARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC)&ProfilingTableDecorator::m_glCompileShaderIncludeARB_profile;
+this->m_names[175] = "glGetArrayObjectfvATI";
+this->m_orig_glGetArrayObjectfvATI = this->m_ptr_glGetArrayObjectfvATI;
+if(this->m_ptr_glGetArrayObjectfvATI)this->m_ptr_glGetArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetArrayObjectfvATI_profile;
+this->m_names[176] = "glVertexStream4svATI";
+this->m_orig_glVertexStream4svATI = this->m_ptr_glVertexStream4svATI;
+if(this->m_ptr_glVertexStream4svATI)this->m_ptr_glVertexStream4svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC)&ProfilingTableDecorator::m_glVertexStream4svATI_profile;
+this->m_names[177] = "glMultiTexCoord4iARB";
+this->m_orig_glMultiTexCoord4iARB = this->m_ptr_glMultiTexCoord4iARB;
+if(this->m_ptr_glMultiTexCoord4iARB)this->m_ptr_glMultiTexCoord4iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4iARB_profile;
+this->m_names[178] = "glVariantfvEXT";
+this->m_orig_glVariantfvEXT = this->m_ptr_glVariantfvEXT;
+if(this->m_ptr_glVariantfvEXT)this->m_ptr_glVariantfvEXT = (FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC)&ProfilingTableDecorator::m_glVariantfvEXT_profile;
+this->m_names[179] = "glMatrixLoadfEXT";
+this->m_orig_glMatrixLoadfEXT = this->m_ptr_glMatrixLoadfEXT;
+if(this->m_ptr_glMatrixLoadfEXT)this->m_ptr_glMatrixLoadfEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadfEXT_profile;
+this->m_names[180] = "glLoadIdentityDeformationMapSGIX";
+this->m_orig_glLoadIdentityDeformationMapSGIX = this->m_ptr_glLoadIdentityDeformationMapSGIX;
+if(this->m_ptr_glLoadIdentityDeformationMapSGIX)this->m_ptr_glLoadIdentityDeformationMapSGIX = (FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC)&ProfilingTableDecorator::m_glLoadIdentityDeformationMapSGIX_profile;
+this->m_names[181] = "glGetRenderbufferParameteriv";
+this->m_orig_glGetRenderbufferParameteriv = this->m_ptr_glGetRenderbufferParameteriv;
+if(this->m_ptr_glGetRenderbufferParameteriv)this->m_ptr_glGetRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetRenderbufferParameteriv_profile;
+this->m_names[182] = "glProgramUniform3fEXT";
+this->m_orig_glProgramUniform3fEXT = this->m_ptr_glProgramUniform3fEXT;
+if(this->m_ptr_glProgramUniform3fEXT)this->m_ptr_glProgramUniform3fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3fEXT_profile;
+this->m_names[183] = "glNamedRenderbufferStorage";
+this->m_orig_glNamedRenderbufferStorage = this->m_ptr_glNamedRenderbufferStorage;
+if(this->m_ptr_glNamedRenderbufferStorage)this->m_ptr_glNamedRenderbufferStorage = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorage_profile;
+this->m_names[184] = "glBindFragDataLocation";
+this->m_orig_glBindFragDataLocation = this->m_ptr_glBindFragDataLocation;
+if(this->m_ptr_glBindFragDataLocation)this->m_ptr_glBindFragDataLocation = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC)&ProfilingTableDecorator::m_glBindFragDataLocation_profile;
+this->m_names[185] = "glPolygonOffsetClamp";
+this->m_orig_glPolygonOffsetClamp = this->m_ptr_glPolygonOffsetClamp;
+if(this->m_ptr_glPolygonOffsetClamp)this->m_ptr_glPolygonOffsetClamp = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC)&ProfilingTableDecorator::m_glPolygonOffsetClamp_profile;
+this->m_names[186] = "glFogCoordPointerListIBM";
+this->m_orig_glFogCoordPointerListIBM = this->m_ptr_glFogCoordPointerListIBM;
+if(this->m_ptr_glFogCoordPointerListIBM)this->m_ptr_glFogCoordPointerListIBM = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glFogCoordPointerListIBM_profile;
+this->m_names[187] = "glFenceSync";
+this->m_orig_glFenceSync = this->m_ptr_glFenceSync;
+if(this->m_ptr_glFenceSync)this->m_ptr_glFenceSync = (FunctionTable::MEMBERPFNGLFENCESYNCPROC)&ProfilingTableDecorator::m_glFenceSync_profile;
+this->m_names[188] = "glGetVertexAttribIivEXT";
+this->m_orig_glGetVertexAttribIivEXT = this->m_ptr_glGetVertexAttribIivEXT;
+if(this->m_ptr_glGetVertexAttribIivEXT)this->m_ptr_glGetVertexAttribIivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribIivEXT_profile;
+this->m_names[189] = "glFramebufferDrawBuffersEXT";
+this->m_orig_glFramebufferDrawBuffersEXT = this->m_ptr_glFramebufferDrawBuffersEXT;
+if(this->m_ptr_glFramebufferDrawBuffersEXT)this->m_ptr_glFramebufferDrawBuffersEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)&ProfilingTableDecorator::m_glFramebufferDrawBuffersEXT_profile;
+this->m_names[190] = "glVertexAttribs4fvNV";
+this->m_orig_glVertexAttribs4fvNV = this->m_ptr_glVertexAttribs4fvNV;
+if(this->m_ptr_glVertexAttribs4fvNV)this->m_ptr_glVertexAttribs4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4fvNV_profile;
+this->m_names[191] = "glPauseTransformFeedbackNV";
+this->m_orig_glPauseTransformFeedbackNV = this->m_ptr_glPauseTransformFeedbackNV;
+if(this->m_ptr_glPauseTransformFeedbackNV)this->m_ptr_glPauseTransformFeedbackNV = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glPauseTransformFeedbackNV_profile;
+this->m_names[192] = "glGetQueryObjecti64vEXT";
+this->m_orig_glGetQueryObjecti64vEXT = this->m_ptr_glGetQueryObjecti64vEXT;
+if(this->m_ptr_glGetQueryObjecti64vEXT)this->m_ptr_glGetQueryObjecti64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC)&ProfilingTableDecorator::m_glGetQueryObjecti64vEXT_profile;
+this->m_names[193] = "glVDPAUSurfaceAccessNV";
+this->m_orig_glVDPAUSurfaceAccessNV = this->m_ptr_glVDPAUSurfaceAccessNV;
+if(this->m_ptr_glVDPAUSurfaceAccessNV)this->m_ptr_glVDPAUSurfaceAccessNV = (FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC)&ProfilingTableDecorator::m_glVDPAUSurfaceAccessNV_profile;
+this->m_names[194] = "glValidateProgramPipeline";
+this->m_orig_glValidateProgramPipeline = this->m_ptr_glValidateProgramPipeline;
+if(this->m_ptr_glValidateProgramPipeline)this->m_ptr_glValidateProgramPipeline = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glValidateProgramPipeline_profile;
+this->m_names[195] = "glTexPageCommitmentARB";
+this->m_orig_glTexPageCommitmentARB = this->m_ptr_glTexPageCommitmentARB;
+if(this->m_ptr_glTexPageCommitmentARB)this->m_ptr_glTexPageCommitmentARB = (FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glTexPageCommitmentARB_profile;
+this->m_names[196] = "glWindowPos3dvARB";
+this->m_orig_glWindowPos3dvARB = this->m_ptr_glWindowPos3dvARB;
+if(this->m_ptr_glWindowPos3dvARB)this->m_ptr_glWindowPos3dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC)&ProfilingTableDecorator::m_glWindowPos3dvARB_profile;
+this->m_names[197] = "glStencilStrokePathInstancedNV";
+this->m_orig_glStencilStrokePathInstancedNV = this->m_ptr_glStencilStrokePathInstancedNV;
+if(this->m_ptr_glStencilStrokePathInstancedNV)this->m_ptr_glStencilStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilStrokePathInstancedNV_profile;
+this->m_names[198] = "glFogfv";
+this->m_orig_glFogfv = this->m_ptr_glFogfv;
+if(this->m_ptr_glFogfv)this->m_ptr_glFogfv = (FunctionTable::MEMBERPFNGLFOGFVPROC)&ProfilingTableDecorator::m_glFogfv_profile;
+this->m_names[199] = "glGenQueriesARB";
+this->m_orig_glGenQueriesARB = this->m_ptr_glGenQueriesARB;
+if(this->m_ptr_glGenQueriesARB)this->m_ptr_glGenQueriesARB = (FunctionTable::MEMBERPFNGLGENQUERIESARBPROC)&ProfilingTableDecorator::m_glGenQueriesARB_profile;
+this->m_names[200] = "glProgramUniform2i64NV";
+this->m_orig_glProgramUniform2i64NV = this->m_ptr_glProgramUniform2i64NV;
+if(this->m_ptr_glProgramUniform2i64NV)this->m_ptr_glProgramUniform2i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform2i64NV_profile;
+this->m_names[201] = "glVertexP4ui";
+this->m_orig_glVertexP4ui = this->m_ptr_glVertexP4ui;
+if(this->m_ptr_glVertexP4ui)this->m_ptr_glVertexP4ui = (FunctionTable::MEMBERPFNGLVERTEXP4UIPROC)&ProfilingTableDecorator::m_glVertexP4ui_profile;
+this->m_names[202] = "glVertexStream1ivATI";
+this->m_orig_glVertexStream1ivATI = this->m_ptr_glVertexStream1ivATI;
+if(this->m_ptr_glVertexStream1ivATI)this->m_ptr_glVertexStream1ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC)&ProfilingTableDecorator::m_glVertexStream1ivATI_profile;
+this->m_names[203] = "glProgramEnvParameterI4iNV";
+this->m_orig_glProgramEnvParameterI4iNV = this->m_ptr_glProgramEnvParameterI4iNV;
+if(this->m_ptr_glProgramEnvParameterI4iNV)this->m_ptr_glProgramEnvParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4iNV_profile;
+this->m_names[204] = "glGenVertexArraysAPPLE";
+this->m_orig_glGenVertexArraysAPPLE = this->m_ptr_glGenVertexArraysAPPLE;
+if(this->m_ptr_glGenVertexArraysAPPLE)this->m_ptr_glGenVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC)&ProfilingTableDecorator::m_glGenVertexArraysAPPLE_profile;
+this->m_names[205] = "glDrawTransformFeedbackInstanced";
+this->m_orig_glDrawTransformFeedbackInstanced = this->m_ptr_glDrawTransformFeedbackInstanced;
+if(this->m_ptr_glDrawTransformFeedbackInstanced)this->m_ptr_glDrawTransformFeedbackInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackInstanced_profile;
+this->m_names[206] = "glStencilThenCoverStrokePathNV";
+this->m_orig_glStencilThenCoverStrokePathNV = this->m_ptr_glStencilThenCoverStrokePathNV;
+if(this->m_ptr_glStencilThenCoverStrokePathNV)this->m_ptr_glStencilThenCoverStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverStrokePathNV_profile;
+this->m_names[207] = "glDeleteVertexArraysAPPLE";
+this->m_orig_glDeleteVertexArraysAPPLE = this->m_ptr_glDeleteVertexArraysAPPLE;
+if(this->m_ptr_glDeleteVertexArraysAPPLE)this->m_ptr_glDeleteVertexArraysAPPLE = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC)&ProfilingTableDecorator::m_glDeleteVertexArraysAPPLE_profile;
+this->m_names[208] = "glGetNamedBufferParameterui64vNV";
+this->m_orig_glGetNamedBufferParameterui64vNV = this->m_ptr_glGetNamedBufferParameterui64vNV;
+if(this->m_ptr_glGetNamedBufferParameterui64vNV)this->m_ptr_glGetNamedBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameterui64vNV_profile;
+this->m_names[209] = "glQueryMatrixxOES";
+this->m_orig_glQueryMatrixxOES = this->m_ptr_glQueryMatrixxOES;
+if(this->m_ptr_glQueryMatrixxOES)this->m_ptr_glQueryMatrixxOES = (FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC)&ProfilingTableDecorator::m_glQueryMatrixxOES_profile;
+this->m_names[210] = "glSecondaryColor3usv";
+this->m_orig_glSecondaryColor3usv = this->m_ptr_glSecondaryColor3usv;
+if(this->m_ptr_glSecondaryColor3usv)this->m_ptr_glSecondaryColor3usv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC)&ProfilingTableDecorator::m_glSecondaryColor3usv_profile;
+this->m_names[211] = "glTranslatexOES";
+this->m_orig_glTranslatexOES = this->m_ptr_glTranslatexOES;
+if(this->m_ptr_glTranslatexOES)this->m_ptr_glTranslatexOES = (FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC)&ProfilingTableDecorator::m_glTranslatexOES_profile;
+this->m_names[212] = "glDrawTransformFeedback";
+this->m_orig_glDrawTransformFeedback = this->m_ptr_glDrawTransformFeedback;
+if(this->m_ptr_glDrawTransformFeedback)this->m_ptr_glDrawTransformFeedback = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glDrawTransformFeedback_profile;
+this->m_names[213] = "glTexCoord2fColor4fNormal3fVertex3fvSUN";
+this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profile;
+this->m_names[214] = "glVDPAURegisterVideoSurfaceNV";
+this->m_orig_glVDPAURegisterVideoSurfaceNV = this->m_ptr_glVDPAURegisterVideoSurfaceNV;
+if(this->m_ptr_glVDPAURegisterVideoSurfaceNV)this->m_ptr_glVDPAURegisterVideoSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAURegisterVideoSurfaceNV_profile;
+this->m_names[215] = "glGetTexParameterIuiv";
+this->m_orig_glGetTexParameterIuiv = this->m_ptr_glGetTexParameterIuiv;
+if(this->m_ptr_glGetTexParameterIuiv)this->m_ptr_glGetTexParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetTexParameterIuiv_profile;
+this->m_names[216] = "glBindBufferBaseNV";
+this->m_orig_glBindBufferBaseNV = this->m_ptr_glBindBufferBaseNV;
+if(this->m_ptr_glBindBufferBaseNV)this->m_ptr_glBindBufferBaseNV = (FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC)&ProfilingTableDecorator::m_glBindBufferBaseNV_profile;
+this->m_names[217] = "glIndexPointer";
+this->m_orig_glIndexPointer = this->m_ptr_glIndexPointer;
+if(this->m_ptr_glIndexPointer)this->m_ptr_glIndexPointer = (FunctionTable::MEMBERPFNGLINDEXPOINTERPROC)&ProfilingTableDecorator::m_glIndexPointer_profile;
+this->m_names[218] = "glGenQueryResourceTagNV";
+this->m_orig_glGenQueryResourceTagNV = this->m_ptr_glGenQueryResourceTagNV;
+if(this->m_ptr_glGenQueryResourceTagNV)this->m_ptr_glGenQueryResourceTagNV = (FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC)&ProfilingTableDecorator::m_glGenQueryResourceTagNV_profile;
+this->m_names[219] = "glVertexAttrib4Nbv";
+this->m_orig_glVertexAttrib4Nbv = this->m_ptr_glVertexAttrib4Nbv;
+if(this->m_ptr_glVertexAttrib4Nbv)this->m_ptr_glVertexAttrib4Nbv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nbv_profile;
+this->m_names[220] = "glListParameteriSGIX";
+this->m_orig_glListParameteriSGIX = this->m_ptr_glListParameteriSGIX;
+if(this->m_ptr_glListParameteriSGIX)this->m_ptr_glListParameteriSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC)&ProfilingTableDecorator::m_glListParameteriSGIX_profile;
+this->m_names[221] = "glBlendColorxOES";
+this->m_orig_glBlendColorxOES = this->m_ptr_glBlendColorxOES;
+if(this->m_ptr_glBlendColorxOES)this->m_ptr_glBlendColorxOES = (FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC)&ProfilingTableDecorator::m_glBlendColorxOES_profile;
+this->m_names[222] = "glUniformui64vNV";
+this->m_orig_glUniformui64vNV = this->m_ptr_glUniformui64vNV;
+if(this->m_ptr_glUniformui64vNV)this->m_ptr_glUniformui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glUniformui64vNV_profile;
+this->m_names[223] = "glIsSync";
+this->m_orig_glIsSync = this->m_ptr_glIsSync;
+if(this->m_ptr_glIsSync)this->m_ptr_glIsSync = (FunctionTable::MEMBERPFNGLISSYNCPROC)&ProfilingTableDecorator::m_glIsSync_profile;
+this->m_names[224] = "glGetTextureParameterivEXT";
+this->m_orig_glGetTextureParameterivEXT = this->m_ptr_glGetTextureParameterivEXT;
+if(this->m_ptr_glGetTextureParameterivEXT)this->m_ptr_glGetTextureParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterivEXT_profile;
+this->m_names[225] = "glFogCoordhvNV";
+this->m_orig_glFogCoordhvNV = this->m_ptr_glFogCoordhvNV;
+if(this->m_ptr_glFogCoordhvNV)this->m_ptr_glFogCoordhvNV = (FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC)&ProfilingTableDecorator::m_glFogCoordhvNV_profile;
+this->m_names[226] = "glFramebufferTextureLayerEXT";
+this->m_orig_glFramebufferTextureLayerEXT = this->m_ptr_glFramebufferTextureLayerEXT;
+if(this->m_ptr_glFramebufferTextureLayerEXT)this->m_ptr_glFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayerEXT_profile;
+this->m_names[227] = "glGetObjectPtrLabel";
+this->m_orig_glGetObjectPtrLabel = this->m_ptr_glGetObjectPtrLabel;
+if(this->m_ptr_glGetObjectPtrLabel)this->m_ptr_glGetObjectPtrLabel = (FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC)&ProfilingTableDecorator::m_glGetObjectPtrLabel_profile;
+this->m_names[228] = "glTextureParameteri";
+this->m_orig_glTextureParameteri = this->m_ptr_glTextureParameteri;
+if(this->m_ptr_glTextureParameteri)this->m_ptr_glTextureParameteri = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC)&ProfilingTableDecorator::m_glTextureParameteri_profile;
+this->m_names[229] = "glMultiTexCoord1fARB";
+this->m_orig_glMultiTexCoord1fARB = this->m_ptr_glMultiTexCoord1fARB;
+if(this->m_ptr_glMultiTexCoord1fARB)this->m_ptr_glMultiTexCoord1fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fARB_profile;
+this->m_names[230] = "glUniformMatrix2x3dv";
+this->m_orig_glUniformMatrix2x3dv = this->m_ptr_glUniformMatrix2x3dv;
+if(this->m_ptr_glUniformMatrix2x3dv)this->m_ptr_glUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x3dv_profile;
+this->m_names[231] = "glFramebufferDrawBufferEXT";
+this->m_orig_glFramebufferDrawBufferEXT = this->m_ptr_glFramebufferDrawBufferEXT;
+if(this->m_ptr_glFramebufferDrawBufferEXT)this->m_ptr_glFramebufferDrawBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferDrawBufferEXT_profile;
+this->m_names[232] = "glCopyColorSubTable";
+this->m_orig_glCopyColorSubTable = this->m_ptr_glCopyColorSubTable;
+if(this->m_ptr_glCopyColorSubTable)this->m_ptr_glCopyColorSubTable = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC)&ProfilingTableDecorator::m_glCopyColorSubTable_profile;
+this->m_names[233] = "glGetNamedFramebufferParameterfvAMD";
+this->m_orig_glGetNamedFramebufferParameterfvAMD = this->m_ptr_glGetNamedFramebufferParameterfvAMD;
+if(this->m_ptr_glGetNamedFramebufferParameterfvAMD)this->m_ptr_glGetNamedFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferParameterfvAMD_profile;
+this->m_names[234] = "glVertexAttribL3d";
+this->m_orig_glVertexAttribL3d = this->m_ptr_glVertexAttribL3d;
+if(this->m_ptr_glVertexAttribL3d)this->m_ptr_glVertexAttribL3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC)&ProfilingTableDecorator::m_glVertexAttribL3d_profile;
+this->m_names[235] = "glFragmentMaterialfvSGIX";
+this->m_orig_glFragmentMaterialfvSGIX = this->m_ptr_glFragmentMaterialfvSGIX;
+if(this->m_ptr_glFragmentMaterialfvSGIX)this->m_ptr_glFragmentMaterialfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialfvSGIX_profile;
+this->m_names[236] = "glMatrixLoadTranspose3x3fNV";
+this->m_orig_glMatrixLoadTranspose3x3fNV = this->m_ptr_glMatrixLoadTranspose3x3fNV;
+if(this->m_ptr_glMatrixLoadTranspose3x3fNV)this->m_ptr_glMatrixLoadTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixLoadTranspose3x3fNV_profile;
+this->m_names[237] = "glDeleteNamesAMD";
+this->m_orig_glDeleteNamesAMD = this->m_ptr_glDeleteNamesAMD;
+if(this->m_ptr_glDeleteNamesAMD)this->m_ptr_glDeleteNamesAMD = (FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC)&ProfilingTableDecorator::m_glDeleteNamesAMD_profile;
+this->m_names[238] = "glDrawRangeElementsEXT";
+this->m_orig_glDrawRangeElementsEXT = this->m_ptr_glDrawRangeElementsEXT;
+if(this->m_ptr_glDrawRangeElementsEXT)this->m_ptr_glDrawRangeElementsEXT = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC)&ProfilingTableDecorator::m_glDrawRangeElementsEXT_profile;
+this->m_names[239] = "glOrtho";
+this->m_orig_glOrtho = this->m_ptr_glOrtho;
+if(this->m_ptr_glOrtho)this->m_ptr_glOrtho = (FunctionTable::MEMBERPFNGLORTHOPROC)&ProfilingTableDecorator::m_glOrtho_profile;
+this->m_names[240] = "glProgramUniform1dvEXT";
+this->m_orig_glProgramUniform1dvEXT = this->m_ptr_glProgramUniform1dvEXT;
+if(this->m_ptr_glProgramUniform1dvEXT)this->m_ptr_glProgramUniform1dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1dvEXT_profile;
+this->m_names[241] = "glColor4xOES";
+this->m_orig_glColor4xOES = this->m_ptr_glColor4xOES;
+if(this->m_ptr_glColor4xOES)this->m_ptr_glColor4xOES = (FunctionTable::MEMBERPFNGLCOLOR4XOESPROC)&ProfilingTableDecorator::m_glColor4xOES_profile;
+this->m_names[242] = "glTexImage4DSGIS";
+this->m_orig_glTexImage4DSGIS = this->m_ptr_glTexImage4DSGIS;
+if(this->m_ptr_glTexImage4DSGIS)this->m_ptr_glTexImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC)&ProfilingTableDecorator::m_glTexImage4DSGIS_profile;
+this->m_names[243] = "glProgramUniform1ui";
+this->m_orig_glProgramUniform1ui = this->m_ptr_glProgramUniform1ui;
+if(this->m_ptr_glProgramUniform1ui)this->m_ptr_glProgramUniform1ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC)&ProfilingTableDecorator::m_glProgramUniform1ui_profile;
+this->m_names[244] = "glDeleteBuffersARB";
+this->m_orig_glDeleteBuffersARB = this->m_ptr_glDeleteBuffersARB;
+if(this->m_ptr_glDeleteBuffersARB)this->m_ptr_glDeleteBuffersARB = (FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC)&ProfilingTableDecorator::m_glDeleteBuffersARB_profile;
+this->m_names[245] = "glUnmapBufferARB";
+this->m_orig_glUnmapBufferARB = this->m_ptr_glUnmapBufferARB;
+if(this->m_ptr_glUnmapBufferARB)this->m_ptr_glUnmapBufferARB = (FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC)&ProfilingTableDecorator::m_glUnmapBufferARB_profile;
+this->m_names[246] = "glCopyTexImage2D";
+this->m_orig_glCopyTexImage2D = this->m_ptr_glCopyTexImage2D;
+if(this->m_ptr_glCopyTexImage2D)this->m_ptr_glCopyTexImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTexImage2D_profile;
+this->m_names[247] = "glMaterialxOES";
+this->m_orig_glMaterialxOES = this->m_ptr_glMaterialxOES;
+if(this->m_ptr_glMaterialxOES)this->m_ptr_glMaterialxOES = (FunctionTable::MEMBERPFNGLMATERIALXOESPROC)&ProfilingTableDecorator::m_glMaterialxOES_profile;
+this->m_names[248] = "glProgramUniformMatrix2x4fvEXT";
+this->m_orig_glProgramUniformMatrix2x4fvEXT = this->m_ptr_glProgramUniformMatrix2x4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x4fvEXT)this->m_ptr_glProgramUniformMatrix2x4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4fvEXT_profile;
+this->m_names[249] = "glTestObjectAPPLE";
+this->m_orig_glTestObjectAPPLE = this->m_ptr_glTestObjectAPPLE;
+if(this->m_ptr_glTestObjectAPPLE)this->m_ptr_glTestObjectAPPLE = (FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC)&ProfilingTableDecorator::m_glTestObjectAPPLE_profile;
+this->m_names[250] = "glRenderbufferStorageEXT";
+this->m_orig_glRenderbufferStorageEXT = this->m_ptr_glRenderbufferStorageEXT;
+if(this->m_ptr_glRenderbufferStorageEXT)this->m_ptr_glRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glRenderbufferStorageEXT_profile;
+this->m_names[251] = "glVertexAttribL1ui64ARB";
+this->m_orig_glVertexAttribL1ui64ARB = this->m_ptr_glVertexAttribL1ui64ARB;
+if(this->m_ptr_glVertexAttribL1ui64ARB)this->m_ptr_glVertexAttribL1ui64ARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64ARB_profile;
+this->m_names[252] = "glEndFragmentShaderATI";
+this->m_orig_glEndFragmentShaderATI = this->m_ptr_glEndFragmentShaderATI;
+if(this->m_ptr_glEndFragmentShaderATI)this->m_ptr_glEndFragmentShaderATI = (FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glEndFragmentShaderATI_profile;
+this->m_names[253] = "glPathParameterivNV";
+this->m_orig_glPathParameterivNV = this->m_ptr_glPathParameterivNV;
+if(this->m_ptr_glPathParameterivNV)this->m_ptr_glPathParameterivNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glPathParameterivNV_profile;
+this->m_names[254] = "glUniform4uiv";
+this->m_orig_glUniform4uiv = this->m_ptr_glUniform4uiv;
+if(this->m_ptr_glUniform4uiv)this->m_ptr_glUniform4uiv = (FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC)&ProfilingTableDecorator::m_glUniform4uiv_profile;
+this->m_names[255] = "glFrameZoomSGIX";
+this->m_orig_glFrameZoomSGIX = this->m_ptr_glFrameZoomSGIX;
+if(this->m_ptr_glFrameZoomSGIX)this->m_ptr_glFrameZoomSGIX = (FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC)&ProfilingTableDecorator::m_glFrameZoomSGIX_profile;
+this->m_names[256] = "glSecondaryColor3fEXT";
+this->m_orig_glSecondaryColor3fEXT = this->m_ptr_glSecondaryColor3fEXT;
+if(this->m_ptr_glSecondaryColor3fEXT)this->m_ptr_glSecondaryColor3fEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3fEXT_profile;
+this->m_names[257] = "glLGPUInterlockNVX";
+this->m_orig_glLGPUInterlockNVX = this->m_ptr_glLGPUInterlockNVX;
+if(this->m_ptr_glLGPUInterlockNVX)this->m_ptr_glLGPUInterlockNVX = (FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC)&ProfilingTableDecorator::m_glLGPUInterlockNVX_profile;
+this->m_names[258] = "glVertexAttribL1dv";
+this->m_orig_glVertexAttribL1dv = this->m_ptr_glVertexAttribL1dv;
+if(this->m_ptr_glVertexAttribL1dv)this->m_ptr_glVertexAttribL1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC)&ProfilingTableDecorator::m_glVertexAttribL1dv_profile;
+this->m_names[259] = "glNormalStream3svATI";
+this->m_orig_glNormalStream3svATI = this->m_ptr_glNormalStream3svATI;
+if(this->m_ptr_glNormalStream3svATI)this->m_ptr_glNormalStream3svATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC)&ProfilingTableDecorator::m_glNormalStream3svATI_profile;
+this->m_names[260] = "glPathStencilFuncNV";
+this->m_orig_glPathStencilFuncNV = this->m_ptr_glPathStencilFuncNV;
+if(this->m_ptr_glPathStencilFuncNV)this->m_ptr_glPathStencilFuncNV = (FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC)&ProfilingTableDecorator::m_glPathStencilFuncNV_profile;
+this->m_names[261] = "glSetInvariantEXT";
+this->m_orig_glSetInvariantEXT = this->m_ptr_glSetInvariantEXT;
+if(this->m_ptr_glSetInvariantEXT)this->m_ptr_glSetInvariantEXT = (FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC)&ProfilingTableDecorator::m_glSetInvariantEXT_profile;
+this->m_names[262] = "glGetTexBumpParameterivATI";
+this->m_orig_glGetTexBumpParameterivATI = this->m_ptr_glGetTexBumpParameterivATI;
+if(this->m_ptr_glGetTexBumpParameterivATI)this->m_ptr_glGetTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC)&ProfilingTableDecorator::m_glGetTexBumpParameterivATI_profile;
+this->m_names[263] = "glBlendEquationSeparateEXT";
+this->m_orig_glBlendEquationSeparateEXT = this->m_ptr_glBlendEquationSeparateEXT;
+if(this->m_ptr_glBlendEquationSeparateEXT)this->m_ptr_glBlendEquationSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateEXT_profile;
+this->m_names[264] = "glEndOcclusionQueryNV";
+this->m_orig_glEndOcclusionQueryNV = this->m_ptr_glEndOcclusionQueryNV;
+if(this->m_ptr_glEndOcclusionQueryNV)this->m_ptr_glEndOcclusionQueryNV = (FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glEndOcclusionQueryNV_profile;
+this->m_names[265] = "glScissorArrayv";
+this->m_orig_glScissorArrayv = this->m_ptr_glScissorArrayv;
+if(this->m_ptr_glScissorArrayv)this->m_ptr_glScissorArrayv = (FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC)&ProfilingTableDecorator::m_glScissorArrayv_profile;
+this->m_names[266] = "glCallList";
+this->m_orig_glCallList = this->m_ptr_glCallList;
+if(this->m_ptr_glCallList)this->m_ptr_glCallList = (FunctionTable::MEMBERPFNGLCALLLISTPROC)&ProfilingTableDecorator::m_glCallList_profile;
+this->m_names[267] = "glMapTexture2DINTEL";
+this->m_orig_glMapTexture2DINTEL = this->m_ptr_glMapTexture2DINTEL;
+if(this->m_ptr_glMapTexture2DINTEL)this->m_ptr_glMapTexture2DINTEL = (FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC)&ProfilingTableDecorator::m_glMapTexture2DINTEL_profile;
+this->m_names[268] = "glGetVkProcAddrNV";
+this->m_orig_glGetVkProcAddrNV = this->m_ptr_glGetVkProcAddrNV;
+if(this->m_ptr_glGetVkProcAddrNV)this->m_ptr_glGetVkProcAddrNV = (FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC)&ProfilingTableDecorator::m_glGetVkProcAddrNV_profile;
+this->m_names[269] = "glPixelTransferxOES";
+this->m_orig_glPixelTransferxOES = this->m_ptr_glPixelTransferxOES;
+if(this->m_ptr_glPixelTransferxOES)this->m_ptr_glPixelTransferxOES = (FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC)&ProfilingTableDecorator::m_glPixelTransferxOES_profile;
+this->m_names[270] = "glDeleteRenderbuffersEXT";
+this->m_orig_glDeleteRenderbuffersEXT = this->m_ptr_glDeleteRenderbuffersEXT;
+if(this->m_ptr_glDeleteRenderbuffersEXT)this->m_ptr_glDeleteRenderbuffersEXT = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC)&ProfilingTableDecorator::m_glDeleteRenderbuffersEXT_profile;
+this->m_names[271] = "glTexCoord4fColor4fNormal3fVertex4fSUN";
+this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fSUN_profile;
+this->m_names[272] = "glProgramUniformMatrix4dvEXT";
+this->m_orig_glProgramUniformMatrix4dvEXT = this->m_ptr_glProgramUniformMatrix4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4dvEXT)this->m_ptr_glProgramUniformMatrix4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4dvEXT_profile;
+this->m_names[273] = "glGetnColorTable";
+this->m_orig_glGetnColorTable = this->m_ptr_glGetnColorTable;
+if(this->m_ptr_glGetnColorTable)this->m_ptr_glGetnColorTable = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC)&ProfilingTableDecorator::m_glGetnColorTable_profile;
+this->m_names[274] = "glFramebufferTextureLayerARB";
+this->m_orig_glFramebufferTextureLayerARB = this->m_ptr_glFramebufferTextureLayerARB;
+if(this->m_ptr_glFramebufferTextureLayerARB)this->m_ptr_glFramebufferTextureLayerARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayerARB_profile;
+this->m_names[275] = "glVertexAttribL2dvEXT";
+this->m_orig_glVertexAttribL2dvEXT = this->m_ptr_glVertexAttribL2dvEXT;
+if(this->m_ptr_glVertexAttribL2dvEXT)this->m_ptr_glVertexAttribL2dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL2dvEXT_profile;
+this->m_names[276] = "glGetCombinerStageParameterfvNV";
+this->m_orig_glGetCombinerStageParameterfvNV = this->m_ptr_glGetCombinerStageParameterfvNV;
+if(this->m_ptr_glGetCombinerStageParameterfvNV)this->m_ptr_glGetCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerStageParameterfvNV_profile;
+this->m_names[277] = "glMultiTexCoord1xvOES";
+this->m_orig_glMultiTexCoord1xvOES = this->m_ptr_glMultiTexCoord1xvOES;
+if(this->m_ptr_glMultiTexCoord1xvOES)this->m_ptr_glMultiTexCoord1xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1xvOES_profile;
+this->m_names[278] = "glMapBuffer";
+this->m_orig_glMapBuffer = this->m_ptr_glMapBuffer;
+if(this->m_ptr_glMapBuffer)this->m_ptr_glMapBuffer = (FunctionTable::MEMBERPFNGLMAPBUFFERPROC)&ProfilingTableDecorator::m_glMapBuffer_profile;
+this->m_names[279] = "glSecondaryColor3d";
+this->m_orig_glSecondaryColor3d = this->m_ptr_glSecondaryColor3d;
+if(this->m_ptr_glSecondaryColor3d)this->m_ptr_glSecondaryColor3d = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC)&ProfilingTableDecorator::m_glSecondaryColor3d_profile;
+this->m_names[280] = "glSecondaryColor3f";
+this->m_orig_glSecondaryColor3f = this->m_ptr_glSecondaryColor3f;
+if(this->m_ptr_glSecondaryColor3f)this->m_ptr_glSecondaryColor3f = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC)&ProfilingTableDecorator::m_glSecondaryColor3f_profile;
+this->m_names[281] = "glVertexAttribLFormat";
+this->m_orig_glVertexAttribLFormat = this->m_ptr_glVertexAttribLFormat;
+if(this->m_ptr_glVertexAttribLFormat)this->m_ptr_glVertexAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribLFormat_profile;
+this->m_names[282] = "glElementPointerAPPLE";
+this->m_orig_glElementPointerAPPLE = this->m_ptr_glElementPointerAPPLE;
+if(this->m_ptr_glElementPointerAPPLE)this->m_ptr_glElementPointerAPPLE = (FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC)&ProfilingTableDecorator::m_glElementPointerAPPLE_profile;
+this->m_names[283] = "glVertexStream1fATI";
+this->m_orig_glVertexStream1fATI = this->m_ptr_glVertexStream1fATI;
+if(this->m_ptr_glVertexStream1fATI)this->m_ptr_glVertexStream1fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC)&ProfilingTableDecorator::m_glVertexStream1fATI_profile;
+this->m_names[284] = "glCoverageModulationNV";
+this->m_orig_glCoverageModulationNV = this->m_ptr_glCoverageModulationNV;
+if(this->m_ptr_glCoverageModulationNV)this->m_ptr_glCoverageModulationNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC)&ProfilingTableDecorator::m_glCoverageModulationNV_profile;
+this->m_names[285] = "glSecondaryColor3i";
+this->m_orig_glSecondaryColor3i = this->m_ptr_glSecondaryColor3i;
+if(this->m_ptr_glSecondaryColor3i)this->m_ptr_glSecondaryColor3i = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC)&ProfilingTableDecorator::m_glSecondaryColor3i_profile;
+this->m_names[286] = "glDeleteSync";
+this->m_orig_glDeleteSync = this->m_ptr_glDeleteSync;
+if(this->m_ptr_glDeleteSync)this->m_ptr_glDeleteSync = (FunctionTable::MEMBERPFNGLDELETESYNCPROC)&ProfilingTableDecorator::m_glDeleteSync_profile;
+this->m_names[287] = "glGetProgramParameterfvNV";
+this->m_orig_glGetProgramParameterfvNV = this->m_ptr_glGetProgramParameterfvNV;
+if(this->m_ptr_glGetProgramParameterfvNV)this->m_ptr_glGetProgramParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetProgramParameterfvNV_profile;
+this->m_names[288] = "glMaxShaderCompilerThreadsARB";
+this->m_orig_glMaxShaderCompilerThreadsARB = this->m_ptr_glMaxShaderCompilerThreadsARB;
+if(this->m_ptr_glMaxShaderCompilerThreadsARB)this->m_ptr_glMaxShaderCompilerThreadsARB = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC)&ProfilingTableDecorator::m_glMaxShaderCompilerThreadsARB_profile;
+this->m_names[289] = "glUniformMatrix4x2dv";
+this->m_orig_glUniformMatrix4x2dv = this->m_ptr_glUniformMatrix4x2dv;
+if(this->m_ptr_glUniformMatrix4x2dv)this->m_ptr_glUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x2dv_profile;
+this->m_names[290] = "glVertexArrayVertexAttribLOffsetEXT";
+this->m_orig_glVertexArrayVertexAttribLOffsetEXT = this->m_ptr_glVertexArrayVertexAttribLOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribLOffsetEXT)this->m_ptr_glVertexArrayVertexAttribLOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribLOffsetEXT_profile;
+this->m_names[291] = "glSecondaryColor3s";
+this->m_orig_glSecondaryColor3s = this->m_ptr_glSecondaryColor3s;
+if(this->m_ptr_glSecondaryColor3s)this->m_ptr_glSecondaryColor3s = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC)&ProfilingTableDecorator::m_glSecondaryColor3s_profile;
+this->m_names[292] = "glIsImageHandleResidentNV";
+this->m_orig_glIsImageHandleResidentNV = this->m_ptr_glIsImageHandleResidentNV;
+if(this->m_ptr_glIsImageHandleResidentNV)this->m_ptr_glIsImageHandleResidentNV = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glIsImageHandleResidentNV_profile;
+this->m_names[293] = "glUniform3iv";
+this->m_orig_glUniform3iv = this->m_ptr_glUniform3iv;
+if(this->m_ptr_glUniform3iv)this->m_ptr_glUniform3iv = (FunctionTable::MEMBERPFNGLUNIFORM3IVPROC)&ProfilingTableDecorator::m_glUniform3iv_profile;
+this->m_names[294] = "glVertexAttribL3i64vNV";
+this->m_orig_glVertexAttribL3i64vNV = this->m_ptr_glVertexAttribL3i64vNV;
+if(this->m_ptr_glVertexAttribL3i64vNV)this->m_ptr_glVertexAttribL3i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL3i64vNV_profile;
+this->m_names[295] = "glPolygonMode";
+this->m_orig_glPolygonMode = this->m_ptr_glPolygonMode;
+if(this->m_ptr_glPolygonMode)this->m_ptr_glPolygonMode = (FunctionTable::MEMBERPFNGLPOLYGONMODEPROC)&ProfilingTableDecorator::m_glPolygonMode_profile;
+this->m_names[296] = "glFramebufferSamplePositionsfvAMD";
+this->m_orig_glFramebufferSamplePositionsfvAMD = this->m_ptr_glFramebufferSamplePositionsfvAMD;
+if(this->m_ptr_glFramebufferSamplePositionsfvAMD)this->m_ptr_glFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ProfilingTableDecorator::m_glFramebufferSamplePositionsfvAMD_profile;
+this->m_names[297] = "glConvolutionFilter1DEXT";
+this->m_orig_glConvolutionFilter1DEXT = this->m_ptr_glConvolutionFilter1DEXT;
+if(this->m_ptr_glConvolutionFilter1DEXT)this->m_ptr_glConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC)&ProfilingTableDecorator::m_glConvolutionFilter1DEXT_profile;
+this->m_names[298] = "glVertexAttrib1dvARB";
+this->m_orig_glVertexAttrib1dvARB = this->m_ptr_glVertexAttrib1dvARB;
+if(this->m_ptr_glVertexAttrib1dvARB)this->m_ptr_glVertexAttrib1dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1dvARB_profile;
+this->m_names[299] = "glTextureSubImage2DEXT";
+this->m_orig_glTextureSubImage2DEXT = this->m_ptr_glTextureSubImage2DEXT;
+if(this->m_ptr_glTextureSubImage2DEXT)this->m_ptr_glTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage2DEXT_profile;
+this->m_names[300] = "glIsVertexArrayAPPLE";
+this->m_orig_glIsVertexArrayAPPLE = this->m_ptr_glIsVertexArrayAPPLE;
+if(this->m_ptr_glIsVertexArrayAPPLE)this->m_ptr_glIsVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC)&ProfilingTableDecorator::m_glIsVertexArrayAPPLE_profile;
+this->m_names[301] = "glUseProgram";
+this->m_orig_glUseProgram = this->m_ptr_glUseProgram;
+if(this->m_ptr_glUseProgram)this->m_ptr_glUseProgram = (FunctionTable::MEMBERPFNGLUSEPROGRAMPROC)&ProfilingTableDecorator::m_glUseProgram_profile;
+this->m_names[302] = "glLineStipple";
+this->m_orig_glLineStipple = this->m_ptr_glLineStipple;
+if(this->m_ptr_glLineStipple)this->m_ptr_glLineStipple = (FunctionTable::MEMBERPFNGLLINESTIPPLEPROC)&ProfilingTableDecorator::m_glLineStipple_profile;
+this->m_names[303] = "glMultiTexCoord4fvARB";
+this->m_orig_glMultiTexCoord4fvARB = this->m_ptr_glMultiTexCoord4fvARB;
+if(this->m_ptr_glMultiTexCoord4fvARB)this->m_ptr_glMultiTexCoord4fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fvARB_profile;
+this->m_names[304] = "glVideoCaptureNV";
+this->m_orig_glVideoCaptureNV = this->m_ptr_glVideoCaptureNV;
+if(this->m_ptr_glVideoCaptureNV)this->m_ptr_glVideoCaptureNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glVideoCaptureNV_profile;
+this->m_names[305] = "glVertexArrayVertexAttribLFormatEXT";
+this->m_orig_glVertexArrayVertexAttribLFormatEXT = this->m_ptr_glVertexArrayVertexAttribLFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribLFormatEXT)this->m_ptr_glVertexArrayVertexAttribLFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribLFormatEXT_profile;
+this->m_names[306] = "glUniform3fvARB";
+this->m_orig_glUniform3fvARB = this->m_ptr_glUniform3fvARB;
+if(this->m_ptr_glUniform3fvARB)this->m_ptr_glUniform3fvARB = (FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC)&ProfilingTableDecorator::m_glUniform3fvARB_profile;
+this->m_names[307] = "glProgramUniformMatrix3x2fvEXT";
+this->m_orig_glProgramUniformMatrix3x2fvEXT = this->m_ptr_glProgramUniformMatrix3x2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x2fvEXT)this->m_ptr_glProgramUniformMatrix3x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2fvEXT_profile;
+this->m_names[308] = "glCopyTextureSubImage3DEXT";
+this->m_orig_glCopyTextureSubImage3DEXT = this->m_ptr_glCopyTextureSubImage3DEXT;
+if(this->m_ptr_glCopyTextureSubImage3DEXT)this->m_ptr_glCopyTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage3DEXT_profile;
+this->m_names[309] = "glMultiTexCoord2bvOES";
+this->m_orig_glMultiTexCoord2bvOES = this->m_ptr_glMultiTexCoord2bvOES;
+if(this->m_ptr_glMultiTexCoord2bvOES)this->m_ptr_glMultiTexCoord2bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2bvOES_profile;
+this->m_names[310] = "glDeleteObjectARB";
+this->m_orig_glDeleteObjectARB = this->m_ptr_glDeleteObjectARB;
+if(this->m_ptr_glDeleteObjectARB)this->m_ptr_glDeleteObjectARB = (FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC)&ProfilingTableDecorator::m_glDeleteObjectARB_profile;
+this->m_names[311] = "glTextureLightEXT";
+this->m_orig_glTextureLightEXT = this->m_ptr_glTextureLightEXT;
+if(this->m_ptr_glTextureLightEXT)this->m_ptr_glTextureLightEXT = (FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC)&ProfilingTableDecorator::m_glTextureLightEXT_profile;
+this->m_names[312] = "glRasterPos3i";
+this->m_orig_glRasterPos3i = this->m_ptr_glRasterPos3i;
+if(this->m_ptr_glRasterPos3i)this->m_ptr_glRasterPos3i = (FunctionTable::MEMBERPFNGLRASTERPOS3IPROC)&ProfilingTableDecorator::m_glRasterPos3i_profile;
+this->m_names[313] = "glMultiTexCoord3dARB";
+this->m_orig_glMultiTexCoord3dARB = this->m_ptr_glMultiTexCoord3dARB;
+if(this->m_ptr_glMultiTexCoord3dARB)this->m_ptr_glMultiTexCoord3dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dARB_profile;
+this->m_names[314] = "glNamedFramebufferTextureEXT";
+this->m_orig_glNamedFramebufferTextureEXT = this->m_ptr_glNamedFramebufferTextureEXT;
+if(this->m_ptr_glNamedFramebufferTextureEXT)this->m_ptr_glNamedFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureEXT_profile;
+this->m_names[315] = "glTextureParameteriEXT";
+this->m_orig_glTextureParameteriEXT = this->m_ptr_glTextureParameteriEXT;
+if(this->m_ptr_glTextureParameteriEXT)this->m_ptr_glTextureParameteriEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glTextureParameteriEXT_profile;
+this->m_names[316] = "glEvalCoord2xvOES";
+this->m_orig_glEvalCoord2xvOES = this->m_ptr_glEvalCoord2xvOES;
+if(this->m_ptr_glEvalCoord2xvOES)this->m_ptr_glEvalCoord2xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC)&ProfilingTableDecorator::m_glEvalCoord2xvOES_profile;
+this->m_names[317] = "glBindVideoCaptureStreamBufferNV";
+this->m_orig_glBindVideoCaptureStreamBufferNV = this->m_ptr_glBindVideoCaptureStreamBufferNV;
+if(this->m_ptr_glBindVideoCaptureStreamBufferNV)this->m_ptr_glBindVideoCaptureStreamBufferNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)&ProfilingTableDecorator::m_glBindVideoCaptureStreamBufferNV_profile;
+this->m_names[318] = "glTexImage2DMultisampleCoverageNV";
+this->m_orig_glTexImage2DMultisampleCoverageNV = this->m_ptr_glTexImage2DMultisampleCoverageNV;
+if(this->m_ptr_glTexImage2DMultisampleCoverageNV)this->m_ptr_glTexImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTexImage2DMultisampleCoverageNV_profile;
+this->m_names[319] = "glGetAttribLocationARB";
+this->m_orig_glGetAttribLocationARB = this->m_ptr_glGetAttribLocationARB;
+if(this->m_ptr_glGetAttribLocationARB)this->m_ptr_glGetAttribLocationARB = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC)&ProfilingTableDecorator::m_glGetAttribLocationARB_profile;
+this->m_names[320] = "glDeleteShader";
+this->m_orig_glDeleteShader = this->m_ptr_glDeleteShader;
+if(this->m_ptr_glDeleteShader)this->m_ptr_glDeleteShader = (FunctionTable::MEMBERPFNGLDELETESHADERPROC)&ProfilingTableDecorator::m_glDeleteShader_profile;
+this->m_names[321] = "glVertexAttrib1fARB";
+this->m_orig_glVertexAttrib1fARB = this->m_ptr_glVertexAttrib1fARB;
+if(this->m_ptr_glVertexAttrib1fARB)this->m_ptr_glVertexAttrib1fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1fARB_profile;
+this->m_names[322] = "glTexCoord2fColor4ubVertex3fSUN";
+this->m_orig_glTexCoord2fColor4ubVertex3fSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4ubVertex3fSUN_profile;
+this->m_names[323] = "glTexCoord4fVertex4fSUN";
+this->m_orig_glTexCoord4fVertex4fSUN = this->m_ptr_glTexCoord4fVertex4fSUN;
+if(this->m_ptr_glTexCoord4fVertex4fSUN)this->m_ptr_glTexCoord4fVertex4fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fVertex4fSUN_profile;
+this->m_names[324] = "glGetMapdv";
+this->m_orig_glGetMapdv = this->m_ptr_glGetMapdv;
+if(this->m_ptr_glGetMapdv)this->m_ptr_glGetMapdv = (FunctionTable::MEMBERPFNGLGETMAPDVPROC)&ProfilingTableDecorator::m_glGetMapdv_profile;
+this->m_names[325] = "glMapParameterfvNV";
+this->m_orig_glMapParameterfvNV = this->m_ptr_glMapParameterfvNV;
+if(this->m_ptr_glMapParameterfvNV)this->m_ptr_glMapParameterfvNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glMapParameterfvNV_profile;
+this->m_names[326] = "glTextureParameterIuiv";
+this->m_orig_glTextureParameterIuiv = this->m_ptr_glTextureParameterIuiv;
+if(this->m_ptr_glTextureParameterIuiv)this->m_ptr_glTextureParameterIuiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glTextureParameterIuiv_profile;
+this->m_names[327] = "glTransformFeedbackAttribsNV";
+this->m_orig_glTransformFeedbackAttribsNV = this->m_ptr_glTransformFeedbackAttribsNV;
+if(this->m_ptr_glTransformFeedbackAttribsNV)this->m_ptr_glTransformFeedbackAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackAttribsNV_profile;
+this->m_names[328] = "glFragmentLightfvSGIX";
+this->m_orig_glFragmentLightfvSGIX = this->m_ptr_glFragmentLightfvSGIX;
+if(this->m_ptr_glFragmentLightfvSGIX)this->m_ptr_glFragmentLightfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightfvSGIX_profile;
+this->m_names[329] = "glWindowPos3sARB";
+this->m_orig_glWindowPos3sARB = this->m_ptr_glWindowPos3sARB;
+if(this->m_ptr_glWindowPos3sARB)this->m_ptr_glWindowPos3sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC)&ProfilingTableDecorator::m_glWindowPos3sARB_profile;
+this->m_names[330] = "glGetConvolutionParameterfv";
+this->m_orig_glGetConvolutionParameterfv = this->m_ptr_glGetConvolutionParameterfv;
+if(this->m_ptr_glGetConvolutionParameterfv)this->m_ptr_glGetConvolutionParameterfv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterfv_profile;
+this->m_names[331] = "glCopyTexSubImage3D";
+this->m_orig_glCopyTexSubImage3D = this->m_ptr_glCopyTexSubImage3D;
+if(this->m_ptr_glCopyTexSubImage3D)this->m_ptr_glCopyTexSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage3D_profile;
+this->m_names[332] = "glVertexAttribI3i";
+this->m_orig_glVertexAttribI3i = this->m_ptr_glVertexAttribI3i;
+if(this->m_ptr_glVertexAttribI3i)this->m_ptr_glVertexAttribI3i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC)&ProfilingTableDecorator::m_glVertexAttribI3i_profile;
+this->m_names[333] = "glCreateShaderObjectARB";
+this->m_orig_glCreateShaderObjectARB = this->m_ptr_glCreateShaderObjectARB;
+if(this->m_ptr_glCreateShaderObjectARB)this->m_ptr_glCreateShaderObjectARB = (FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC)&ProfilingTableDecorator::m_glCreateShaderObjectARB_profile;
+this->m_names[334] = "glVertexAttribFormat";
+this->m_orig_glVertexAttribFormat = this->m_ptr_glVertexAttribFormat;
+if(this->m_ptr_glVertexAttribFormat)this->m_ptr_glVertexAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribFormat_profile;
+this->m_names[335] = "glGetProgramivARB";
+this->m_orig_glGetProgramivARB = this->m_ptr_glGetProgramivARB;
+if(this->m_ptr_glGetProgramivARB)this->m_ptr_glGetProgramivARB = (FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC)&ProfilingTableDecorator::m_glGetProgramivARB_profile;
+this->m_names[336] = "glVertexAttribI4usv";
+this->m_orig_glVertexAttribI4usv = this->m_ptr_glVertexAttribI4usv;
+if(this->m_ptr_glVertexAttribI4usv)this->m_ptr_glVertexAttribI4usv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC)&ProfilingTableDecorator::m_glVertexAttribI4usv_profile;
+this->m_names[337] = "glTexParameterf";
+this->m_orig_glTexParameterf = this->m_ptr_glTexParameterf;
+if(this->m_ptr_glTexParameterf)this->m_ptr_glTexParameterf = (FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC)&ProfilingTableDecorator::m_glTexParameterf_profile;
+this->m_names[338] = "glVertexAttribBinding";
+this->m_orig_glVertexAttribBinding = this->m_ptr_glVertexAttribBinding;
+if(this->m_ptr_glVertexAttribBinding)this->m_ptr_glVertexAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC)&ProfilingTableDecorator::m_glVertexAttribBinding_profile;
+this->m_names[339] = "glGetHistogramParameteriv";
+this->m_orig_glGetHistogramParameteriv = this->m_ptr_glGetHistogramParameteriv;
+if(this->m_ptr_glGetHistogramParameteriv)this->m_ptr_glGetHistogramParameteriv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetHistogramParameteriv_profile;
+this->m_names[340] = "glTexParameteri";
+this->m_orig_glTexParameteri = this->m_ptr_glTexParameteri;
+if(this->m_ptr_glTexParameteri)this->m_ptr_glTexParameteri = (FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC)&ProfilingTableDecorator::m_glTexParameteri_profile;
+this->m_names[341] = "glGetShaderSource";
+this->m_orig_glGetShaderSource = this->m_ptr_glGetShaderSource;
+if(this->m_ptr_glGetShaderSource)this->m_ptr_glGetShaderSource = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC)&ProfilingTableDecorator::m_glGetShaderSource_profile;
+this->m_names[342] = "glVertexAttrib4s";
+this->m_orig_glVertexAttrib4s = this->m_ptr_glVertexAttrib4s;
+if(this->m_ptr_glVertexAttrib4s)this->m_ptr_glVertexAttrib4s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC)&ProfilingTableDecorator::m_glVertexAttrib4s_profile;
+this->m_names[343] = "glVertexAttrib4dvNV";
+this->m_orig_glVertexAttrib4dvNV = this->m_ptr_glVertexAttrib4dvNV;
+if(this->m_ptr_glVertexAttrib4dvNV)this->m_ptr_glVertexAttrib4dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dvNV_profile;
+this->m_names[344] = "glVertexAttrib1dvNV";
+this->m_orig_glVertexAttrib1dvNV = this->m_ptr_glVertexAttrib1dvNV;
+if(this->m_ptr_glVertexAttrib1dvNV)this->m_ptr_glVertexAttrib1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dvNV_profile;
+this->m_names[345] = "glPopName";
+this->m_orig_glPopName = this->m_ptr_glPopName;
+if(this->m_ptr_glPopName)this->m_ptr_glPopName = (FunctionTable::MEMBERPFNGLPOPNAMEPROC)&ProfilingTableDecorator::m_glPopName_profile;
+this->m_names[346] = "glTextureBufferEXT";
+this->m_orig_glTextureBufferEXT = this->m_ptr_glTextureBufferEXT;
+if(this->m_ptr_glTextureBufferEXT)this->m_ptr_glTextureBufferEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC)&ProfilingTableDecorator::m_glTextureBufferEXT_profile;
+this->m_names[347] = "glGetMultiTexImageEXT";
+this->m_orig_glGetMultiTexImageEXT = this->m_ptr_glGetMultiTexImageEXT;
+if(this->m_ptr_glGetMultiTexImageEXT)this->m_ptr_glGetMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexImageEXT_profile;
+this->m_names[348] = "glGetPointerIndexedvEXT";
+this->m_orig_glGetPointerIndexedvEXT = this->m_ptr_glGetPointerIndexedvEXT;
+if(this->m_ptr_glGetPointerIndexedvEXT)this->m_ptr_glGetPointerIndexedvEXT = (FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetPointerIndexedvEXT_profile;
+this->m_names[349] = "glIsNameAMD";
+this->m_orig_glIsNameAMD = this->m_ptr_glIsNameAMD;
+if(this->m_ptr_glIsNameAMD)this->m_ptr_glIsNameAMD = (FunctionTable::MEMBERPFNGLISNAMEAMDPROC)&ProfilingTableDecorator::m_glIsNameAMD_profile;
+this->m_names[350] = "glColor4ub";
+this->m_orig_glColor4ub = this->m_ptr_glColor4ub;
+if(this->m_ptr_glColor4ub)this->m_ptr_glColor4ub = (FunctionTable::MEMBERPFNGLCOLOR4UBPROC)&ProfilingTableDecorator::m_glColor4ub_profile;
+this->m_names[351] = "glBufferParameteriAPPLE";
+this->m_orig_glBufferParameteriAPPLE = this->m_ptr_glBufferParameteriAPPLE;
+if(this->m_ptr_glBufferParameteriAPPLE)this->m_ptr_glBufferParameteriAPPLE = (FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC)&ProfilingTableDecorator::m_glBufferParameteriAPPLE_profile;
+this->m_names[352] = "glColor4ui";
+this->m_orig_glColor4ui = this->m_ptr_glColor4ui;
+if(this->m_ptr_glColor4ui)this->m_ptr_glColor4ui = (FunctionTable::MEMBERPFNGLCOLOR4UIPROC)&ProfilingTableDecorator::m_glColor4ui_profile;
+this->m_names[353] = "glGetInternalformativ";
+this->m_orig_glGetInternalformativ = this->m_ptr_glGetInternalformativ;
+if(this->m_ptr_glGetInternalformativ)this->m_ptr_glGetInternalformativ = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC)&ProfilingTableDecorator::m_glGetInternalformativ_profile;
+this->m_names[354] = "glColor4us";
+this->m_orig_glColor4us = this->m_ptr_glColor4us;
+if(this->m_ptr_glColor4us)this->m_ptr_glColor4us = (FunctionTable::MEMBERPFNGLCOLOR4USPROC)&ProfilingTableDecorator::m_glColor4us_profile;
+this->m_names[355] = "glVertexAttribP1uiv";
+this->m_orig_glVertexAttribP1uiv = this->m_ptr_glVertexAttribP1uiv;
+if(this->m_ptr_glVertexAttribP1uiv)this->m_ptr_glVertexAttribP1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP1uiv_profile;
+this->m_names[356] = "glLinkProgram";
+this->m_orig_glLinkProgram = this->m_ptr_glLinkProgram;
+if(this->m_ptr_glLinkProgram)this->m_ptr_glLinkProgram = (FunctionTable::MEMBERPFNGLLINKPROGRAMPROC)&ProfilingTableDecorator::m_glLinkProgram_profile;
+this->m_names[357] = "glTexCoord3s";
+this->m_orig_glTexCoord3s = this->m_ptr_glTexCoord3s;
+if(this->m_ptr_glTexCoord3s)this->m_ptr_glTexCoord3s = (FunctionTable::MEMBERPFNGLTEXCOORD3SPROC)&ProfilingTableDecorator::m_glTexCoord3s_profile;
+this->m_names[358] = "glTexCoord2dv";
+this->m_orig_glTexCoord2dv = this->m_ptr_glTexCoord2dv;
+if(this->m_ptr_glTexCoord2dv)this->m_ptr_glTexCoord2dv = (FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC)&ProfilingTableDecorator::m_glTexCoord2dv_profile;
+this->m_names[359] = "glGetObjectLabel";
+this->m_orig_glGetObjectLabel = this->m_ptr_glGetObjectLabel;
+if(this->m_ptr_glGetObjectLabel)this->m_ptr_glGetObjectLabel = (FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC)&ProfilingTableDecorator::m_glGetObjectLabel_profile;
+this->m_names[360] = "glVertexPointerEXT";
+this->m_orig_glVertexPointerEXT = this->m_ptr_glVertexPointerEXT;
+if(this->m_ptr_glVertexPointerEXT)this->m_ptr_glVertexPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexPointerEXT_profile;
+this->m_names[361] = "glDebugMessageCallbackARB";
+this->m_orig_glDebugMessageCallbackARB = this->m_ptr_glDebugMessageCallbackARB;
+if(this->m_ptr_glDebugMessageCallbackARB)this->m_ptr_glDebugMessageCallbackARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC)&ProfilingTableDecorator::m_glDebugMessageCallbackARB_profile;
+this->m_names[362] = "glGetString";
+this->m_orig_glGetString = this->m_ptr_glGetString;
+if(this->m_ptr_glGetString)this->m_ptr_glGetString = (FunctionTable::MEMBERPFNGLGETSTRINGPROC)&ProfilingTableDecorator::m_glGetString_profile;
+this->m_names[363] = "glGetPathParameterfvNV";
+this->m_orig_glGetPathParameterfvNV = this->m_ptr_glGetPathParameterfvNV;
+if(this->m_ptr_glGetPathParameterfvNV)this->m_ptr_glGetPathParameterfvNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetPathParameterfvNV_profile;
+this->m_names[364] = "glLightxvOES";
+this->m_orig_glLightxvOES = this->m_ptr_glLightxvOES;
+if(this->m_ptr_glLightxvOES)this->m_ptr_glLightxvOES = (FunctionTable::MEMBERPFNGLLIGHTXVOESPROC)&ProfilingTableDecorator::m_glLightxvOES_profile;
+this->m_names[365] = "glEndQuery";
+this->m_orig_glEndQuery = this->m_ptr_glEndQuery;
+if(this->m_ptr_glEndQuery)this->m_ptr_glEndQuery = (FunctionTable::MEMBERPFNGLENDQUERYPROC)&ProfilingTableDecorator::m_glEndQuery_profile;
+this->m_names[366] = "glSecondaryColor3uiv";
+this->m_orig_glSecondaryColor3uiv = this->m_ptr_glSecondaryColor3uiv;
+if(this->m_ptr_glSecondaryColor3uiv)this->m_ptr_glSecondaryColor3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC)&ProfilingTableDecorator::m_glSecondaryColor3uiv_profile;
+this->m_names[367] = "glPrioritizeTexturesxOES";
+this->m_orig_glPrioritizeTexturesxOES = this->m_ptr_glPrioritizeTexturesxOES;
+if(this->m_ptr_glPrioritizeTexturesxOES)this->m_ptr_glPrioritizeTexturesxOES = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC)&ProfilingTableDecorator::m_glPrioritizeTexturesxOES_profile;
+this->m_names[368] = "glEdgeFlagPointer";
+this->m_orig_glEdgeFlagPointer = this->m_ptr_glEdgeFlagPointer;
+if(this->m_ptr_glEdgeFlagPointer)this->m_ptr_glEdgeFlagPointer = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC)&ProfilingTableDecorator::m_glEdgeFlagPointer_profile;
+this->m_names[369] = "glFramebufferParameteri";
+this->m_orig_glFramebufferParameteri = this->m_ptr_glFramebufferParameteri;
+if(this->m_ptr_glFramebufferParameteri)this->m_ptr_glFramebufferParameteri = (FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC)&ProfilingTableDecorator::m_glFramebufferParameteri_profile;
+this->m_names[370] = "glTexCoord3hNV";
+this->m_orig_glTexCoord3hNV = this->m_ptr_glTexCoord3hNV;
+if(this->m_ptr_glTexCoord3hNV)this->m_ptr_glTexCoord3hNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC)&ProfilingTableDecorator::m_glTexCoord3hNV_profile;
+this->m_names[371] = "glMultiModeDrawElementsIBM";
+this->m_orig_glMultiModeDrawElementsIBM = this->m_ptr_glMultiModeDrawElementsIBM;
+if(this->m_ptr_glMultiModeDrawElementsIBM)this->m_ptr_glMultiModeDrawElementsIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC)&ProfilingTableDecorator::m_glMultiModeDrawElementsIBM_profile;
+this->m_names[372] = "glCopyPixels";
+this->m_orig_glCopyPixels = this->m_ptr_glCopyPixels;
+if(this->m_ptr_glCopyPixels)this->m_ptr_glCopyPixels = (FunctionTable::MEMBERPFNGLCOPYPIXELSPROC)&ProfilingTableDecorator::m_glCopyPixels_profile;
+this->m_names[373] = "glVertexAttribI2ui";
+this->m_orig_glVertexAttribI2ui = this->m_ptr_glVertexAttribI2ui;
+if(this->m_ptr_glVertexAttribI2ui)this->m_ptr_glVertexAttribI2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC)&ProfilingTableDecorator::m_glVertexAttribI2ui_profile;
+this->m_names[374] = "glClampColorARB";
+this->m_orig_glClampColorARB = this->m_ptr_glClampColorARB;
+if(this->m_ptr_glClampColorARB)this->m_ptr_glClampColorARB = (FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC)&ProfilingTableDecorator::m_glClampColorARB_profile;
+this->m_names[375] = "glColorPointervINTEL";
+this->m_orig_glColorPointervINTEL = this->m_ptr_glColorPointervINTEL;
+if(this->m_ptr_glColorPointervINTEL)this->m_ptr_glColorPointervINTEL = (FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC)&ProfilingTableDecorator::m_glColorPointervINTEL_profile;
+this->m_names[376] = "glDeleteTextures";
+this->m_orig_glDeleteTextures = this->m_ptr_glDeleteTextures;
+if(this->m_ptr_glDeleteTextures)this->m_ptr_glDeleteTextures = (FunctionTable::MEMBERPFNGLDELETETEXTURESPROC)&ProfilingTableDecorator::m_glDeleteTextures_profile;
+this->m_names[377] = "glGetMinmaxParameterfvEXT";
+this->m_orig_glGetMinmaxParameterfvEXT = this->m_ptr_glGetMinmaxParameterfvEXT;
+if(this->m_ptr_glGetMinmaxParameterfvEXT)this->m_ptr_glGetMinmaxParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterfvEXT_profile;
+this->m_names[378] = "glWindowPos3sMESA";
+this->m_orig_glWindowPos3sMESA = this->m_ptr_glWindowPos3sMESA;
+if(this->m_ptr_glWindowPos3sMESA)this->m_ptr_glWindowPos3sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC)&ProfilingTableDecorator::m_glWindowPos3sMESA_profile;
+this->m_names[379] = "glVertexAttrib4f";
+this->m_orig_glVertexAttrib4f = this->m_ptr_glVertexAttrib4f;
+if(this->m_ptr_glVertexAttrib4f)this->m_ptr_glVertexAttrib4f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC)&ProfilingTableDecorator::m_glVertexAttrib4f_profile;
+this->m_names[380] = "glNamedFramebufferParameteri";
+this->m_orig_glNamedFramebufferParameteri = this->m_ptr_glNamedFramebufferParameteri;
+if(this->m_ptr_glNamedFramebufferParameteri)this->m_ptr_glNamedFramebufferParameteri = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)&ProfilingTableDecorator::m_glNamedFramebufferParameteri_profile;
+this->m_names[381] = "glTexCoord2fVertex3fvSUN";
+this->m_orig_glTexCoord2fVertex3fvSUN = this->m_ptr_glTexCoord2fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fVertex3fvSUN)this->m_ptr_glTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fVertex3fvSUN_profile;
+this->m_names[382] = "glReplacementCodeusSUN";
+this->m_orig_glReplacementCodeusSUN = this->m_ptr_glReplacementCodeusSUN;
+if(this->m_ptr_glReplacementCodeusSUN)this->m_ptr_glReplacementCodeusSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeusSUN_profile;
+this->m_names[383] = "glGetNamedFramebufferParameteriv";
+this->m_orig_glGetNamedFramebufferParameteriv = this->m_ptr_glGetNamedFramebufferParameteriv;
+if(this->m_ptr_glGetNamedFramebufferParameteriv)this->m_ptr_glGetNamedFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferParameteriv_profile;
+this->m_names[384] = "glVertexStream1fvATI";
+this->m_orig_glVertexStream1fvATI = this->m_ptr_glVertexStream1fvATI;
+if(this->m_ptr_glVertexStream1fvATI)this->m_ptr_glVertexStream1fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC)&ProfilingTableDecorator::m_glVertexStream1fvATI_profile;
+this->m_names[385] = "glCreateVertexArrays";
+this->m_orig_glCreateVertexArrays = this->m_ptr_glCreateVertexArrays;
+if(this->m_ptr_glCreateVertexArrays)this->m_ptr_glCreateVertexArrays = (FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glCreateVertexArrays_profile;
+this->m_names[386] = "glBeginConditionalRender";
+this->m_orig_glBeginConditionalRender = this->m_ptr_glBeginConditionalRender;
+if(this->m_ptr_glBeginConditionalRender)this->m_ptr_glBeginConditionalRender = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC)&ProfilingTableDecorator::m_glBeginConditionalRender_profile;
+this->m_names[387] = "glGetUnsignedBytevEXT";
+this->m_orig_glGetUnsignedBytevEXT = this->m_ptr_glGetUnsignedBytevEXT;
+if(this->m_ptr_glGetUnsignedBytevEXT)this->m_ptr_glGetUnsignedBytevEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC)&ProfilingTableDecorator::m_glGetUnsignedBytevEXT_profile;
+this->m_names[388] = "glConvolutionFilter1D";
+this->m_orig_glConvolutionFilter1D = this->m_ptr_glConvolutionFilter1D;
+if(this->m_ptr_glConvolutionFilter1D)this->m_ptr_glConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC)&ProfilingTableDecorator::m_glConvolutionFilter1D_profile;
+this->m_names[389] = "glMultiTexCoord3fARB";
+this->m_orig_glMultiTexCoord3fARB = this->m_ptr_glMultiTexCoord3fARB;
+if(this->m_ptr_glMultiTexCoord3fARB)this->m_ptr_glMultiTexCoord3fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fARB_profile;
+this->m_names[390] = "glGetQueryObjectuivARB";
+this->m_orig_glGetQueryObjectuivARB = this->m_ptr_glGetQueryObjectuivARB;
+if(this->m_ptr_glGetQueryObjectuivARB)this->m_ptr_glGetQueryObjectuivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC)&ProfilingTableDecorator::m_glGetQueryObjectuivARB_profile;
+this->m_names[391] = "glScalexOES";
+this->m_orig_glScalexOES = this->m_ptr_glScalexOES;
+if(this->m_ptr_glScalexOES)this->m_ptr_glScalexOES = (FunctionTable::MEMBERPFNGLSCALEXOESPROC)&ProfilingTableDecorator::m_glScalexOES_profile;
+this->m_names[392] = "glSamplerParameteri";
+this->m_orig_glSamplerParameteri = this->m_ptr_glSamplerParameteri;
+if(this->m_ptr_glSamplerParameteri)this->m_ptr_glSamplerParameteri = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC)&ProfilingTableDecorator::m_glSamplerParameteri_profile;
+this->m_names[393] = "glSamplerParameterf";
+this->m_orig_glSamplerParameterf = this->m_ptr_glSamplerParameterf;
+if(this->m_ptr_glSamplerParameterf)this->m_ptr_glSamplerParameterf = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC)&ProfilingTableDecorator::m_glSamplerParameterf_profile;
+this->m_names[394] = "glShaderOp1EXT";
+this->m_orig_glShaderOp1EXT = this->m_ptr_glShaderOp1EXT;
+if(this->m_ptr_glShaderOp1EXT)this->m_ptr_glShaderOp1EXT = (FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC)&ProfilingTableDecorator::m_glShaderOp1EXT_profile;
+this->m_names[395] = "glBeginVideoCaptureNV";
+this->m_orig_glBeginVideoCaptureNV = this->m_ptr_glBeginVideoCaptureNV;
+if(this->m_ptr_glBeginVideoCaptureNV)this->m_ptr_glBeginVideoCaptureNV = (FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glBeginVideoCaptureNV_profile;
+this->m_names[396] = "glGetnHistogram";
+this->m_orig_glGetnHistogram = this->m_ptr_glGetnHistogram;
+if(this->m_ptr_glGetnHistogram)this->m_ptr_glGetnHistogram = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC)&ProfilingTableDecorator::m_glGetnHistogram_profile;
+this->m_names[397] = "glUniform1d";
+this->m_orig_glUniform1d = this->m_ptr_glUniform1d;
+if(this->m_ptr_glUniform1d)this->m_ptr_glUniform1d = (FunctionTable::MEMBERPFNGLUNIFORM1DPROC)&ProfilingTableDecorator::m_glUniform1d_profile;
+this->m_names[398] = "glRenderMode";
+this->m_orig_glRenderMode = this->m_ptr_glRenderMode;
+if(this->m_ptr_glRenderMode)this->m_ptr_glRenderMode = (FunctionTable::MEMBERPFNGLRENDERMODEPROC)&ProfilingTableDecorator::m_glRenderMode_profile;
+this->m_names[399] = "glClearColorIiEXT";
+this->m_orig_glClearColorIiEXT = this->m_ptr_glClearColorIiEXT;
+if(this->m_ptr_glClearColorIiEXT)this->m_ptr_glClearColorIiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC)&ProfilingTableDecorator::m_glClearColorIiEXT_profile;
+this->m_names[400] = "glSignalSemaphoreEXT";
+this->m_orig_glSignalSemaphoreEXT = this->m_ptr_glSignalSemaphoreEXT;
+if(this->m_ptr_glSignalSemaphoreEXT)this->m_ptr_glSignalSemaphoreEXT = (FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC)&ProfilingTableDecorator::m_glSignalSemaphoreEXT_profile;
+this->m_names[401] = "glGetCompressedTexImage";
+this->m_orig_glGetCompressedTexImage = this->m_ptr_glGetCompressedTexImage;
+if(this->m_ptr_glGetCompressedTexImage)this->m_ptr_glGetCompressedTexImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTexImage_profile;
+this->m_names[402] = "glCompressedTextureImage1DEXT";
+this->m_orig_glCompressedTextureImage1DEXT = this->m_ptr_glCompressedTextureImage1DEXT;
+if(this->m_ptr_glCompressedTextureImage1DEXT)this->m_ptr_glCompressedTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage1DEXT_profile;
+this->m_names[403] = "glGetActiveUniformBlockiv";
+this->m_orig_glGetActiveUniformBlockiv = this->m_ptr_glGetActiveUniformBlockiv;
+if(this->m_ptr_glGetActiveUniformBlockiv)this->m_ptr_glGetActiveUniformBlockiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC)&ProfilingTableDecorator::m_glGetActiveUniformBlockiv_profile;
+this->m_names[404] = "glUniform1i";
+this->m_orig_glUniform1i = this->m_ptr_glUniform1i;
+if(this->m_ptr_glUniform1i)this->m_ptr_glUniform1i = (FunctionTable::MEMBERPFNGLUNIFORM1IPROC)&ProfilingTableDecorator::m_glUniform1i_profile;
+this->m_names[405] = "glMultiDrawArraysIndirectCount";
+this->m_orig_glMultiDrawArraysIndirectCount = this->m_ptr_glMultiDrawArraysIndirectCount;
+if(this->m_ptr_glMultiDrawArraysIndirectCount)this->m_ptr_glMultiDrawArraysIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectCount_profile;
+this->m_names[406] = "glGetTexEnvfv";
+this->m_orig_glGetTexEnvfv = this->m_ptr_glGetTexEnvfv;
+if(this->m_ptr_glGetTexEnvfv)this->m_ptr_glGetTexEnvfv = (FunctionTable::MEMBERPFNGLGETTEXENVFVPROC)&ProfilingTableDecorator::m_glGetTexEnvfv_profile;
+this->m_names[407] = "glColorTableParameterivSGI";
+this->m_orig_glColorTableParameterivSGI = this->m_ptr_glColorTableParameterivSGI;
+if(this->m_ptr_glColorTableParameterivSGI)this->m_ptr_glColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC)&ProfilingTableDecorator::m_glColorTableParameterivSGI_profile;
+this->m_names[408] = "glCullFace";
+this->m_orig_glCullFace = this->m_ptr_glCullFace;
+if(this->m_ptr_glCullFace)this->m_ptr_glCullFace = (FunctionTable::MEMBERPFNGLCULLFACEPROC)&ProfilingTableDecorator::m_glCullFace_profile;
+this->m_names[409] = "glDeleteFencesAPPLE";
+this->m_orig_glDeleteFencesAPPLE = this->m_ptr_glDeleteFencesAPPLE;
+if(this->m_ptr_glDeleteFencesAPPLE)this->m_ptr_glDeleteFencesAPPLE = (FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC)&ProfilingTableDecorator::m_glDeleteFencesAPPLE_profile;
+this->m_names[410] = "glProgramUniform4i";
+this->m_orig_glProgramUniform4i = this->m_ptr_glProgramUniform4i;
+if(this->m_ptr_glProgramUniform4i)this->m_ptr_glProgramUniform4i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC)&ProfilingTableDecorator::m_glProgramUniform4i_profile;
+this->m_names[411] = "glUniformHandleui64ARB";
+this->m_orig_glUniformHandleui64ARB = this->m_ptr_glUniformHandleui64ARB;
+if(this->m_ptr_glUniformHandleui64ARB)this->m_ptr_glUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC)&ProfilingTableDecorator::m_glUniformHandleui64ARB_profile;
+this->m_names[412] = "glProgramUniform4f";
+this->m_orig_glProgramUniform4f = this->m_ptr_glProgramUniform4f;
+if(this->m_ptr_glProgramUniform4f)this->m_ptr_glProgramUniform4f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC)&ProfilingTableDecorator::m_glProgramUniform4f_profile;
+this->m_names[413] = "glViewportIndexedf";
+this->m_orig_glViewportIndexedf = this->m_ptr_glViewportIndexedf;
+if(this->m_ptr_glViewportIndexedf)this->m_ptr_glViewportIndexedf = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC)&ProfilingTableDecorator::m_glViewportIndexedf_profile;
+this->m_names[414] = "glProgramUniform4d";
+this->m_orig_glProgramUniform4d = this->m_ptr_glProgramUniform4d;
+if(this->m_ptr_glProgramUniform4d)this->m_ptr_glProgramUniform4d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC)&ProfilingTableDecorator::m_glProgramUniform4d_profile;
+this->m_names[415] = "glTexCoord1xOES";
+this->m_orig_glTexCoord1xOES = this->m_ptr_glTexCoord1xOES;
+if(this->m_ptr_glTexCoord1xOES)this->m_ptr_glTexCoord1xOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC)&ProfilingTableDecorator::m_glTexCoord1xOES_profile;
+this->m_names[416] = "glVertexStream3ivATI";
+this->m_orig_glVertexStream3ivATI = this->m_ptr_glVertexStream3ivATI;
+if(this->m_ptr_glVertexStream3ivATI)this->m_ptr_glVertexStream3ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC)&ProfilingTableDecorator::m_glVertexStream3ivATI_profile;
+this->m_names[417] = "glPointAlongPathNV";
+this->m_orig_glPointAlongPathNV = this->m_ptr_glPointAlongPathNV;
+if(this->m_ptr_glPointAlongPathNV)this->m_ptr_glPointAlongPathNV = (FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC)&ProfilingTableDecorator::m_glPointAlongPathNV_profile;
+this->m_names[418] = "glEndQueryARB";
+this->m_orig_glEndQueryARB = this->m_ptr_glEndQueryARB;
+if(this->m_ptr_glEndQueryARB)this->m_ptr_glEndQueryARB = (FunctionTable::MEMBERPFNGLENDQUERYARBPROC)&ProfilingTableDecorator::m_glEndQueryARB_profile;
+this->m_names[419] = "glVDPAUMapSurfacesNV";
+this->m_orig_glVDPAUMapSurfacesNV = this->m_ptr_glVDPAUMapSurfacesNV;
+if(this->m_ptr_glVDPAUMapSurfacesNV)this->m_ptr_glVDPAUMapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC)&ProfilingTableDecorator::m_glVDPAUMapSurfacesNV_profile;
+this->m_names[420] = "glVertex3i";
+this->m_orig_glVertex3i = this->m_ptr_glVertex3i;
+if(this->m_ptr_glVertex3i)this->m_ptr_glVertex3i = (FunctionTable::MEMBERPFNGLVERTEX3IPROC)&ProfilingTableDecorator::m_glVertex3i_profile;
+this->m_names[421] = "glVertexAttrib4uivARB";
+this->m_orig_glVertexAttrib4uivARB = this->m_ptr_glVertexAttrib4uivARB;
+if(this->m_ptr_glVertexAttrib4uivARB)this->m_ptr_glVertexAttrib4uivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4uivARB_profile;
+this->m_names[422] = "glTextureStorageMem3DEXT";
+this->m_orig_glTextureStorageMem3DEXT = this->m_ptr_glTextureStorageMem3DEXT;
+if(this->m_ptr_glTextureStorageMem3DEXT)this->m_ptr_glTextureStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC)&ProfilingTableDecorator::m_glTextureStorageMem3DEXT_profile;
+this->m_names[423] = "glAttachShader";
+this->m_orig_glAttachShader = this->m_ptr_glAttachShader;
+if(this->m_ptr_glAttachShader)this->m_ptr_glAttachShader = (FunctionTable::MEMBERPFNGLATTACHSHADERPROC)&ProfilingTableDecorator::m_glAttachShader_profile;
+this->m_names[424] = "glColor4hNV";
+this->m_orig_glColor4hNV = this->m_ptr_glColor4hNV;
+if(this->m_ptr_glColor4hNV)this->m_ptr_glColor4hNV = (FunctionTable::MEMBERPFNGLCOLOR4HNVPROC)&ProfilingTableDecorator::m_glColor4hNV_profile;
+this->m_names[425] = "glGetFenceivNV";
+this->m_orig_glGetFenceivNV = this->m_ptr_glGetFenceivNV;
+if(this->m_ptr_glGetFenceivNV)this->m_ptr_glGetFenceivNV = (FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC)&ProfilingTableDecorator::m_glGetFenceivNV_profile;
+this->m_names[426] = "glTexCoord2fColor4ubVertex3fvSUN";
+this->m_orig_glTexCoord2fColor4ubVertex3fvSUN = this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN)this->m_ptr_glTexCoord2fColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4ubVertex3fvSUN_profile;
+this->m_names[427] = "glGetColorTable";
+this->m_orig_glGetColorTable = this->m_ptr_glGetColorTable;
+if(this->m_ptr_glGetColorTable)this->m_ptr_glGetColorTable = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC)&ProfilingTableDecorator::m_glGetColorTable_profile;
+this->m_names[428] = "glFogCoordPointer";
+this->m_orig_glFogCoordPointer = this->m_ptr_glFogCoordPointer;
+if(this->m_ptr_glFogCoordPointer)this->m_ptr_glFogCoordPointer = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC)&ProfilingTableDecorator::m_glFogCoordPointer_profile;
+this->m_names[429] = "glTexStorageSparseAMD";
+this->m_orig_glTexStorageSparseAMD = this->m_ptr_glTexStorageSparseAMD;
+if(this->m_ptr_glTexStorageSparseAMD)this->m_ptr_glTexStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC)&ProfilingTableDecorator::m_glTexStorageSparseAMD_profile;
+this->m_names[430] = "glUnmapNamedBuffer";
+this->m_orig_glUnmapNamedBuffer = this->m_ptr_glUnmapNamedBuffer;
+if(this->m_ptr_glUnmapNamedBuffer)this->m_ptr_glUnmapNamedBuffer = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC)&ProfilingTableDecorator::m_glUnmapNamedBuffer_profile;
+this->m_names[431] = "glTexCoord4bvOES";
+this->m_orig_glTexCoord4bvOES = this->m_ptr_glTexCoord4bvOES;
+if(this->m_ptr_glTexCoord4bvOES)this->m_ptr_glTexCoord4bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC)&ProfilingTableDecorator::m_glTexCoord4bvOES_profile;
+this->m_names[432] = "glVertexAttrib3fARB";
+this->m_orig_glVertexAttrib3fARB = this->m_ptr_glVertexAttrib3fARB;
+if(this->m_ptr_glVertexAttrib3fARB)this->m_ptr_glVertexAttrib3fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3fARB_profile;
+this->m_names[433] = "glRasterPos2xOES";
+this->m_orig_glRasterPos2xOES = this->m_ptr_glRasterPos2xOES;
+if(this->m_ptr_glRasterPos2xOES)this->m_ptr_glRasterPos2xOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC)&ProfilingTableDecorator::m_glRasterPos2xOES_profile;
+this->m_names[434] = "glCreateMemoryObjectsEXT";
+this->m_orig_glCreateMemoryObjectsEXT = this->m_ptr_glCreateMemoryObjectsEXT;
+if(this->m_ptr_glCreateMemoryObjectsEXT)this->m_ptr_glCreateMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC)&ProfilingTableDecorator::m_glCreateMemoryObjectsEXT_profile;
+this->m_names[435] = "glColor4ubVertex2fvSUN";
+this->m_orig_glColor4ubVertex2fvSUN = this->m_ptr_glColor4ubVertex2fvSUN;
+if(this->m_ptr_glColor4ubVertex2fvSUN)this->m_ptr_glColor4ubVertex2fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex2fvSUN_profile;
+this->m_names[436] = "glSecondaryColor3dv";
+this->m_orig_glSecondaryColor3dv = this->m_ptr_glSecondaryColor3dv;
+if(this->m_ptr_glSecondaryColor3dv)this->m_ptr_glSecondaryColor3dv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC)&ProfilingTableDecorator::m_glSecondaryColor3dv_profile;
+this->m_names[437] = "glVertexAttribI4sv";
+this->m_orig_glVertexAttribI4sv = this->m_ptr_glVertexAttribI4sv;
+if(this->m_ptr_glVertexAttribI4sv)this->m_ptr_glVertexAttribI4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC)&ProfilingTableDecorator::m_glVertexAttribI4sv_profile;
+this->m_names[438] = "glDrawTransformFeedbackStreamInstanced";
+this->m_orig_glDrawTransformFeedbackStreamInstanced = this->m_ptr_glDrawTransformFeedbackStreamInstanced;
+if(this->m_ptr_glDrawTransformFeedbackStreamInstanced)this->m_ptr_glDrawTransformFeedbackStreamInstanced = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackStreamInstanced_profile;
+this->m_names[439] = "glMultiTexCoord4ivARB";
+this->m_orig_glMultiTexCoord4ivARB = this->m_ptr_glMultiTexCoord4ivARB;
+if(this->m_ptr_glMultiTexCoord4ivARB)this->m_ptr_glMultiTexCoord4ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4ivARB_profile;
+this->m_names[440] = "glSpriteParameterfSGIX";
+this->m_orig_glSpriteParameterfSGIX = this->m_ptr_glSpriteParameterfSGIX;
+if(this->m_ptr_glSpriteParameterfSGIX)this->m_ptr_glSpriteParameterfSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterfSGIX_profile;
+this->m_names[441] = "glSecondaryColor3sv";
+this->m_orig_glSecondaryColor3sv = this->m_ptr_glSecondaryColor3sv;
+if(this->m_ptr_glSecondaryColor3sv)this->m_ptr_glSecondaryColor3sv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC)&ProfilingTableDecorator::m_glSecondaryColor3sv_profile;
+this->m_names[442] = "glBindVideoCaptureStreamTextureNV";
+this->m_orig_glBindVideoCaptureStreamTextureNV = this->m_ptr_glBindVideoCaptureStreamTextureNV;
+if(this->m_ptr_glBindVideoCaptureStreamTextureNV)this->m_ptr_glBindVideoCaptureStreamTextureNV = (FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)&ProfilingTableDecorator::m_glBindVideoCaptureStreamTextureNV_profile;
+this->m_names[443] = "glTexParameterIuiv";
+this->m_orig_glTexParameterIuiv = this->m_ptr_glTexParameterIuiv;
+if(this->m_ptr_glTexParameterIuiv)this->m_ptr_glTexParameterIuiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glTexParameterIuiv_profile;
+this->m_names[444] = "glFlushPixelDataRangeNV";
+this->m_orig_glFlushPixelDataRangeNV = this->m_ptr_glFlushPixelDataRangeNV;
+if(this->m_ptr_glFlushPixelDataRangeNV)this->m_ptr_glFlushPixelDataRangeNV = (FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC)&ProfilingTableDecorator::m_glFlushPixelDataRangeNV_profile;
+this->m_names[445] = "glWindowPos3fv";
+this->m_orig_glWindowPos3fv = this->m_ptr_glWindowPos3fv;
+if(this->m_ptr_glWindowPos3fv)this->m_ptr_glWindowPos3fv = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC)&ProfilingTableDecorator::m_glWindowPos3fv_profile;
+this->m_names[446] = "glVertexAttribLFormatNV";
+this->m_orig_glVertexAttribLFormatNV = this->m_ptr_glVertexAttribLFormatNV;
+if(this->m_ptr_glVertexAttribLFormatNV)this->m_ptr_glVertexAttribLFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribLFormatNV_profile;
+this->m_names[447] = "glLightModelfv";
+this->m_orig_glLightModelfv = this->m_ptr_glLightModelfv;
+if(this->m_ptr_glLightModelfv)this->m_ptr_glLightModelfv = (FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC)&ProfilingTableDecorator::m_glLightModelfv_profile;
+this->m_names[448] = "glGetColorTableSGI";
+this->m_orig_glGetColorTableSGI = this->m_ptr_glGetColorTableSGI;
+if(this->m_ptr_glGetColorTableSGI)this->m_ptr_glGetColorTableSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glGetColorTableSGI_profile;
+this->m_names[449] = "glGetCompressedTexImageARB";
+this->m_orig_glGetCompressedTexImageARB = this->m_ptr_glGetCompressedTexImageARB;
+if(this->m_ptr_glGetCompressedTexImageARB)this->m_ptr_glGetCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetCompressedTexImageARB_profile;
+this->m_names[450] = "glConvolutionParameteri";
+this->m_orig_glConvolutionParameteri = this->m_ptr_glConvolutionParameteri;
+if(this->m_ptr_glConvolutionParameteri)this->m_ptr_glConvolutionParameteri = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC)&ProfilingTableDecorator::m_glConvolutionParameteri_profile;
+this->m_names[451] = "glVertexWeighthNV";
+this->m_orig_glVertexWeighthNV = this->m_ptr_glVertexWeighthNV;
+if(this->m_ptr_glVertexWeighthNV)this->m_ptr_glVertexWeighthNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC)&ProfilingTableDecorator::m_glVertexWeighthNV_profile;
+this->m_names[452] = "glColorMaskIndexedEXT";
+this->m_orig_glColorMaskIndexedEXT = this->m_ptr_glColorMaskIndexedEXT;
+if(this->m_ptr_glColorMaskIndexedEXT)this->m_ptr_glColorMaskIndexedEXT = (FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC)&ProfilingTableDecorator::m_glColorMaskIndexedEXT_profile;
+this->m_names[453] = "glColorMaski";
+this->m_orig_glColorMaski = this->m_ptr_glColorMaski;
+if(this->m_ptr_glColorMaski)this->m_ptr_glColorMaski = (FunctionTable::MEMBERPFNGLCOLORMASKIPROC)&ProfilingTableDecorator::m_glColorMaski_profile;
+this->m_names[454] = "glColorFragmentOp1ATI";
+this->m_orig_glColorFragmentOp1ATI = this->m_ptr_glColorFragmentOp1ATI;
+if(this->m_ptr_glColorFragmentOp1ATI)this->m_ptr_glColorFragmentOp1ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp1ATI_profile;
+this->m_names[455] = "glVertexAttribI4ubvEXT";
+this->m_orig_glVertexAttribI4ubvEXT = this->m_ptr_glVertexAttribI4ubvEXT;
+if(this->m_ptr_glVertexAttribI4ubvEXT)this->m_ptr_glVertexAttribI4ubvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4ubvEXT_profile;
+this->m_names[456] = "glVertexAttrib1dNV";
+this->m_orig_glVertexAttrib1dNV = this->m_ptr_glVertexAttrib1dNV;
+if(this->m_ptr_glVertexAttrib1dNV)this->m_ptr_glVertexAttrib1dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dNV_profile;
+this->m_names[457] = "glUnmapObjectBufferATI";
+this->m_orig_glUnmapObjectBufferATI = this->m_ptr_glUnmapObjectBufferATI;
+if(this->m_ptr_glUnmapObjectBufferATI)this->m_ptr_glUnmapObjectBufferATI = (FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glUnmapObjectBufferATI_profile;
+this->m_names[458] = "glNamedProgramLocalParameterI4uiEXT";
+this->m_orig_glNamedProgramLocalParameterI4uiEXT = this->m_ptr_glNamedProgramLocalParameterI4uiEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4uiEXT)this->m_ptr_glNamedProgramLocalParameterI4uiEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4uiEXT_profile;
+this->m_names[459] = "glProgramUniform1iEXT";
+this->m_orig_glProgramUniform1iEXT = this->m_ptr_glProgramUniform1iEXT;
+if(this->m_ptr_glProgramUniform1iEXT)this->m_ptr_glProgramUniform1iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1iEXT_profile;
+this->m_names[460] = "glDeleteQueriesARB";
+this->m_orig_glDeleteQueriesARB = this->m_ptr_glDeleteQueriesARB;
+if(this->m_ptr_glDeleteQueriesARB)this->m_ptr_glDeleteQueriesARB = (FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC)&ProfilingTableDecorator::m_glDeleteQueriesARB_profile;
+this->m_names[461] = "glWindowPos3svARB";
+this->m_orig_glWindowPos3svARB = this->m_ptr_glWindowPos3svARB;
+if(this->m_ptr_glWindowPos3svARB)this->m_ptr_glWindowPos3svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC)&ProfilingTableDecorator::m_glWindowPos3svARB_profile;
+this->m_names[462] = "glVertex4s";
+this->m_orig_glVertex4s = this->m_ptr_glVertex4s;
+if(this->m_ptr_glVertex4s)this->m_ptr_glVertex4s = (FunctionTable::MEMBERPFNGLVERTEX4SPROC)&ProfilingTableDecorator::m_glVertex4s_profile;
+this->m_names[463] = "glImportMemoryWin32NameEXT";
+this->m_orig_glImportMemoryWin32NameEXT = this->m_ptr_glImportMemoryWin32NameEXT;
+if(this->m_ptr_glImportMemoryWin32NameEXT)this->m_ptr_glImportMemoryWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC)&ProfilingTableDecorator::m_glImportMemoryWin32NameEXT_profile;
+this->m_names[464] = "glStringMarkerGREMEDY";
+this->m_orig_glStringMarkerGREMEDY = this->m_ptr_glStringMarkerGREMEDY;
+if(this->m_ptr_glStringMarkerGREMEDY)this->m_ptr_glStringMarkerGREMEDY = (FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC)&ProfilingTableDecorator::m_glStringMarkerGREMEDY_profile;
+this->m_names[465] = "glIsTransformFeedback";
+this->m_orig_glIsTransformFeedback = this->m_ptr_glIsTransformFeedback;
+if(this->m_ptr_glIsTransformFeedback)this->m_ptr_glIsTransformFeedback = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glIsTransformFeedback_profile;
+this->m_names[466] = "glProgramUniformMatrix2x3dvEXT";
+this->m_orig_glProgramUniformMatrix2x3dvEXT = this->m_ptr_glProgramUniformMatrix2x3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x3dvEXT)this->m_ptr_glProgramUniformMatrix2x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3dvEXT_profile;
+this->m_names[467] = "glGetObjectLabelEXT";
+this->m_orig_glGetObjectLabelEXT = this->m_ptr_glGetObjectLabelEXT;
+if(this->m_ptr_glGetObjectLabelEXT)this->m_ptr_glGetObjectLabelEXT = (FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC)&ProfilingTableDecorator::m_glGetObjectLabelEXT_profile;
+this->m_names[468] = "glUniformHandleui64vNV";
+this->m_orig_glUniformHandleui64vNV = this->m_ptr_glUniformHandleui64vNV;
+if(this->m_ptr_glUniformHandleui64vNV)this->m_ptr_glUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC)&ProfilingTableDecorator::m_glUniformHandleui64vNV_profile;
+this->m_names[469] = "glRotated";
+this->m_orig_glRotated = this->m_ptr_glRotated;
+if(this->m_ptr_glRotated)this->m_ptr_glRotated = (FunctionTable::MEMBERPFNGLROTATEDPROC)&ProfilingTableDecorator::m_glRotated_profile;
+this->m_names[470] = "glIsProgramPipeline";
+this->m_orig_glIsProgramPipeline = this->m_ptr_glIsProgramPipeline;
+if(this->m_ptr_glIsProgramPipeline)this->m_ptr_glIsProgramPipeline = (FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glIsProgramPipeline_profile;
+this->m_names[471] = "glRotatef";
+this->m_orig_glRotatef = this->m_ptr_glRotatef;
+if(this->m_ptr_glRotatef)this->m_ptr_glRotatef = (FunctionTable::MEMBERPFNGLROTATEFPROC)&ProfilingTableDecorator::m_glRotatef_profile;
+this->m_names[472] = "glVertex4i";
+this->m_orig_glVertex4i = this->m_ptr_glVertex4i;
+if(this->m_ptr_glVertex4i)this->m_ptr_glVertex4i = (FunctionTable::MEMBERPFNGLVERTEX4IPROC)&ProfilingTableDecorator::m_glVertex4i_profile;
+this->m_names[473] = "glGetActiveSubroutineUniformName";
+this->m_orig_glGetActiveSubroutineUniformName = this->m_ptr_glGetActiveSubroutineUniformName;
+if(this->m_ptr_glGetActiveSubroutineUniformName)this->m_ptr_glGetActiveSubroutineUniformName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineUniformName_profile;
+this->m_names[474] = "glVertexAttrib4sNV";
+this->m_orig_glVertexAttrib4sNV = this->m_ptr_glVertexAttrib4sNV;
+if(this->m_ptr_glVertexAttrib4sNV)this->m_ptr_glVertexAttrib4sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4sNV_profile;
+this->m_names[475] = "glProgramLocalParameter4dvARB";
+this->m_orig_glProgramLocalParameter4dvARB = this->m_ptr_glProgramLocalParameter4dvARB;
+if(this->m_ptr_glProgramLocalParameter4dvARB)this->m_ptr_glProgramLocalParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4dvARB_profile;
+this->m_names[476] = "glReplacementCodeubSUN";
+this->m_orig_glReplacementCodeubSUN = this->m_ptr_glReplacementCodeubSUN;
+if(this->m_ptr_glReplacementCodeubSUN)this->m_ptr_glReplacementCodeubSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeubSUN_profile;
+this->m_names[477] = "glMultiDrawElementsIndirectBindlessNV";
+this->m_orig_glMultiDrawElementsIndirectBindlessNV = this->m_ptr_glMultiDrawElementsIndirectBindlessNV;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessNV)this->m_ptr_glMultiDrawElementsIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectBindlessNV_profile;
+this->m_names[478] = "glImportSemaphoreWin32HandleEXT";
+this->m_orig_glImportSemaphoreWin32HandleEXT = this->m_ptr_glImportSemaphoreWin32HandleEXT;
+if(this->m_ptr_glImportSemaphoreWin32HandleEXT)this->m_ptr_glImportSemaphoreWin32HandleEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC)&ProfilingTableDecorator::m_glImportSemaphoreWin32HandleEXT_profile;
+this->m_names[479] = "glUniformMatrix3fv";
+this->m_orig_glUniformMatrix3fv = this->m_ptr_glUniformMatrix3fv;
+if(this->m_ptr_glUniformMatrix3fv)this->m_ptr_glUniformMatrix3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3fv_profile;
+this->m_names[480] = "glGetnMapfvARB";
+this->m_orig_glGetnMapfvARB = this->m_ptr_glGetnMapfvARB;
+if(this->m_ptr_glGetnMapfvARB)this->m_ptr_glGetnMapfvARB = (FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC)&ProfilingTableDecorator::m_glGetnMapfvARB_profile;
+this->m_names[481] = "glGetnUniformfv";
+this->m_orig_glGetnUniformfv = this->m_ptr_glGetnUniformfv;
+if(this->m_ptr_glGetnUniformfv)this->m_ptr_glGetnUniformfv = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC)&ProfilingTableDecorator::m_glGetnUniformfv_profile;
+this->m_names[482] = "glVertexAttribL2dv";
+this->m_orig_glVertexAttribL2dv = this->m_ptr_glVertexAttribL2dv;
+if(this->m_ptr_glVertexAttribL2dv)this->m_ptr_glVertexAttribL2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC)&ProfilingTableDecorator::m_glVertexAttribL2dv_profile;
+this->m_names[483] = "glVertexWeightPointerEXT";
+this->m_orig_glVertexWeightPointerEXT = this->m_ptr_glVertexWeightPointerEXT;
+if(this->m_ptr_glVertexWeightPointerEXT)this->m_ptr_glVertexWeightPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexWeightPointerEXT_profile;
+this->m_names[484] = "glTangent3sEXT";
+this->m_orig_glTangent3sEXT = this->m_ptr_glTangent3sEXT;
+if(this->m_ptr_glTangent3sEXT)this->m_ptr_glTangent3sEXT = (FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC)&ProfilingTableDecorator::m_glTangent3sEXT_profile;
+this->m_names[485] = "glSecondaryColorPointer";
+this->m_orig_glSecondaryColorPointer = this->m_ptr_glSecondaryColorPointer;
+if(this->m_ptr_glSecondaryColorPointer)this->m_ptr_glSecondaryColorPointer = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC)&ProfilingTableDecorator::m_glSecondaryColorPointer_profile;
+this->m_names[486] = "glAlphaFunc";
+this->m_orig_glAlphaFunc = this->m_ptr_glAlphaFunc;
+if(this->m_ptr_glAlphaFunc)this->m_ptr_glAlphaFunc = (FunctionTable::MEMBERPFNGLALPHAFUNCPROC)&ProfilingTableDecorator::m_glAlphaFunc_profile;
+this->m_names[487] = "glGetNamedStringARB";
+this->m_orig_glGetNamedStringARB = this->m_ptr_glGetNamedStringARB;
+if(this->m_ptr_glGetNamedStringARB)this->m_ptr_glGetNamedStringARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glGetNamedStringARB_profile;
+this->m_names[488] = "glTexCoord4d";
+this->m_orig_glTexCoord4d = this->m_ptr_glTexCoord4d;
+if(this->m_ptr_glTexCoord4d)this->m_ptr_glTexCoord4d = (FunctionTable::MEMBERPFNGLTEXCOORD4DPROC)&ProfilingTableDecorator::m_glTexCoord4d_profile;
+this->m_names[489] = "glBufferPageCommitmentARB";
+this->m_orig_glBufferPageCommitmentARB = this->m_ptr_glBufferPageCommitmentARB;
+if(this->m_ptr_glBufferPageCommitmentARB)this->m_ptr_glBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glBufferPageCommitmentARB_profile;
+this->m_names[490] = "glProgramLocalParameters4fvEXT";
+this->m_orig_glProgramLocalParameters4fvEXT = this->m_ptr_glProgramLocalParameters4fvEXT;
+if(this->m_ptr_glProgramLocalParameters4fvEXT)this->m_ptr_glProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glProgramLocalParameters4fvEXT_profile;
+this->m_names[491] = "glStencilFunc";
+this->m_orig_glStencilFunc = this->m_ptr_glStencilFunc;
+if(this->m_ptr_glStencilFunc)this->m_ptr_glStencilFunc = (FunctionTable::MEMBERPFNGLSTENCILFUNCPROC)&ProfilingTableDecorator::m_glStencilFunc_profile;
+this->m_names[492] = "glSemaphoreParameterui64vEXT";
+this->m_orig_glSemaphoreParameterui64vEXT = this->m_ptr_glSemaphoreParameterui64vEXT;
+if(this->m_ptr_glSemaphoreParameterui64vEXT)this->m_ptr_glSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC)&ProfilingTableDecorator::m_glSemaphoreParameterui64vEXT_profile;
+this->m_names[493] = "glGetVertexAttribdvNV";
+this->m_orig_glGetVertexAttribdvNV = this->m_ptr_glGetVertexAttribdvNV;
+if(this->m_ptr_glGetVertexAttribdvNV)this->m_ptr_glGetVertexAttribdvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribdvNV_profile;
+this->m_names[494] = "glTexCoord3dv";
+this->m_orig_glTexCoord3dv = this->m_ptr_glTexCoord3dv;
+if(this->m_ptr_glTexCoord3dv)this->m_ptr_glTexCoord3dv = (FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC)&ProfilingTableDecorator::m_glTexCoord3dv_profile;
+this->m_names[495] = "glGetQueryBufferObjectiv";
+this->m_orig_glGetQueryBufferObjectiv = this->m_ptr_glGetQueryBufferObjectiv;
+if(this->m_ptr_glGetQueryBufferObjectiv)this->m_ptr_glGetQueryBufferObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectiv_profile;
+this->m_names[496] = "glTexGenxOES";
+this->m_orig_glTexGenxOES = this->m_ptr_glTexGenxOES;
+if(this->m_ptr_glTexGenxOES)this->m_ptr_glTexGenxOES = (FunctionTable::MEMBERPFNGLTEXGENXOESPROC)&ProfilingTableDecorator::m_glTexGenxOES_profile;
+this->m_names[497] = "glMultiTexCoord1fvARB";
+this->m_orig_glMultiTexCoord1fvARB = this->m_ptr_glMultiTexCoord1fvARB;
+if(this->m_ptr_glMultiTexCoord1fvARB)this->m_ptr_glMultiTexCoord1fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fvARB_profile;
+this->m_names[498] = "glLightEnviSGIX";
+this->m_orig_glLightEnviSGIX = this->m_ptr_glLightEnviSGIX;
+if(this->m_ptr_glLightEnviSGIX)this->m_ptr_glLightEnviSGIX = (FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC)&ProfilingTableDecorator::m_glLightEnviSGIX_profile;
+this->m_names[499] = "glGetProgramPipelineiv";
+this->m_orig_glGetProgramPipelineiv = this->m_ptr_glGetProgramPipelineiv;
+if(this->m_ptr_glGetProgramPipelineiv)this->m_ptr_glGetProgramPipelineiv = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC)&ProfilingTableDecorator::m_glGetProgramPipelineiv_profile;
+this->m_names[500] = "glVertexStream2ivATI";
+this->m_orig_glVertexStream2ivATI = this->m_ptr_glVertexStream2ivATI;
+if(this->m_ptr_glVertexStream2ivATI)this->m_ptr_glVertexStream2ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC)&ProfilingTableDecorator::m_glVertexStream2ivATI_profile;
+this->m_names[501] = "glGetColorTableEXT";
+this->m_orig_glGetColorTableEXT = this->m_ptr_glGetColorTableEXT;
+if(this->m_ptr_glGetColorTableEXT)this->m_ptr_glGetColorTableEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC)&ProfilingTableDecorator::m_glGetColorTableEXT_profile;
+this->m_names[502] = "glGetShaderInfoLog";
+this->m_orig_glGetShaderInfoLog = this->m_ptr_glGetShaderInfoLog;
+if(this->m_ptr_glGetShaderInfoLog)this->m_ptr_glGetShaderInfoLog = (FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC)&ProfilingTableDecorator::m_glGetShaderInfoLog_profile;
+this->m_names[503] = "glGetOcclusionQueryuivNV";
+this->m_orig_glGetOcclusionQueryuivNV = this->m_ptr_glGetOcclusionQueryuivNV;
+if(this->m_ptr_glGetOcclusionQueryuivNV)this->m_ptr_glGetOcclusionQueryuivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC)&ProfilingTableDecorator::m_glGetOcclusionQueryuivNV_profile;
+this->m_names[504] = "glInvalidateNamedFramebufferSubData";
+this->m_orig_glInvalidateNamedFramebufferSubData = this->m_ptr_glInvalidateNamedFramebufferSubData;
+if(this->m_ptr_glInvalidateNamedFramebufferSubData)this->m_ptr_glInvalidateNamedFramebufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glInvalidateNamedFramebufferSubData_profile;
+this->m_names[505] = "glVertexAttribL1i64NV";
+this->m_orig_glVertexAttribL1i64NV = this->m_ptr_glVertexAttribL1i64NV;
+if(this->m_ptr_glVertexAttribL1i64NV)this->m_ptr_glVertexAttribL1i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL1i64NV_profile;
+this->m_names[506] = "glVDPAUInitNV";
+this->m_orig_glVDPAUInitNV = this->m_ptr_glVDPAUInitNV;
+if(this->m_ptr_glVDPAUInitNV)this->m_ptr_glVDPAUInitNV = (FunctionTable::MEMBERPFNGLVDPAUINITNVPROC)&ProfilingTableDecorator::m_glVDPAUInitNV_profile;
+this->m_names[507] = "glVertexAttrib1hvNV";
+this->m_orig_glVertexAttrib1hvNV = this->m_ptr_glVertexAttrib1hvNV;
+if(this->m_ptr_glVertexAttrib1hvNV)this->m_ptr_glVertexAttrib1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1hvNV_profile;
+this->m_names[508] = "glVertexAttribI4i";
+this->m_orig_glVertexAttribI4i = this->m_ptr_glVertexAttribI4i;
+if(this->m_ptr_glVertexAttribI4i)this->m_ptr_glVertexAttribI4i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC)&ProfilingTableDecorator::m_glVertexAttribI4i_profile;
+this->m_names[509] = "glRasterPos2iv";
+this->m_orig_glRasterPos2iv = this->m_ptr_glRasterPos2iv;
+if(this->m_ptr_glRasterPos2iv)this->m_ptr_glRasterPos2iv = (FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC)&ProfilingTableDecorator::m_glRasterPos2iv_profile;
+this->m_names[510] = "glGetIntegerui64i_vNV";
+this->m_orig_glGetIntegerui64i_vNV = this->m_ptr_glGetIntegerui64i_vNV;
+if(this->m_ptr_glGetIntegerui64i_vNV)this->m_ptr_glGetIntegerui64i_vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC)&ProfilingTableDecorator::m_glGetIntegerui64i_vNV_profile;
+this->m_names[511] = "glUniformHandleui64NV";
+this->m_orig_glUniformHandleui64NV = this->m_ptr_glUniformHandleui64NV;
+if(this->m_ptr_glUniformHandleui64NV)this->m_ptr_glUniformHandleui64NV = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC)&ProfilingTableDecorator::m_glUniformHandleui64NV_profile;
+this->m_names[512] = "glWindowPos3ivMESA";
+this->m_orig_glWindowPos3ivMESA = this->m_ptr_glWindowPos3ivMESA;
+if(this->m_ptr_glWindowPos3ivMESA)this->m_ptr_glWindowPos3ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3ivMESA_profile;
+this->m_names[513] = "glBlendEquationSeparate";
+this->m_orig_glBlendEquationSeparate = this->m_ptr_glBlendEquationSeparate;
+if(this->m_ptr_glBlendEquationSeparate)this->m_ptr_glBlendEquationSeparate = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC)&ProfilingTableDecorator::m_glBlendEquationSeparate_profile;
+this->m_names[514] = "glDrawElementsInstancedARB";
+this->m_orig_glDrawElementsInstancedARB = this->m_ptr_glDrawElementsInstancedARB;
+if(this->m_ptr_glDrawElementsInstancedARB)this->m_ptr_glDrawElementsInstancedARB = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedARB_profile;
+this->m_names[515] = "glGetSubroutineIndex";
+this->m_orig_glGetSubroutineIndex = this->m_ptr_glGetSubroutineIndex;
+if(this->m_ptr_glGetSubroutineIndex)this->m_ptr_glGetSubroutineIndex = (FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC)&ProfilingTableDecorator::m_glGetSubroutineIndex_profile;
+this->m_names[516] = "glVertexAttrib2sv";
+this->m_orig_glVertexAttrib2sv = this->m_ptr_glVertexAttrib2sv;
+if(this->m_ptr_glVertexAttrib2sv)this->m_ptr_glVertexAttrib2sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC)&ProfilingTableDecorator::m_glVertexAttrib2sv_profile;
+this->m_names[517] = "glSamplePatternSGIS";
+this->m_orig_glSamplePatternSGIS = this->m_ptr_glSamplePatternSGIS;
+if(this->m_ptr_glSamplePatternSGIS)this->m_ptr_glSamplePatternSGIS = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC)&ProfilingTableDecorator::m_glSamplePatternSGIS_profile;
+this->m_names[518] = "glEGLImageTargetRenderbufferStorageOES";
+this->m_orig_glEGLImageTargetRenderbufferStorageOES = this->m_ptr_glEGLImageTargetRenderbufferStorageOES;
+if(this->m_ptr_glEGLImageTargetRenderbufferStorageOES)this->m_ptr_glEGLImageTargetRenderbufferStorageOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC)&ProfilingTableDecorator::m_glEGLImageTargetRenderbufferStorageOES_profile;
+this->m_names[519] = "glPushAttrib";
+this->m_orig_glPushAttrib = this->m_ptr_glPushAttrib;
+if(this->m_ptr_glPushAttrib)this->m_ptr_glPushAttrib = (FunctionTable::MEMBERPFNGLPUSHATTRIBPROC)&ProfilingTableDecorator::m_glPushAttrib_profile;
+this->m_names[520] = "glVertex3hNV";
+this->m_orig_glVertex3hNV = this->m_ptr_glVertex3hNV;
+if(this->m_ptr_glVertex3hNV)this->m_ptr_glVertex3hNV = (FunctionTable::MEMBERPFNGLVERTEX3HNVPROC)&ProfilingTableDecorator::m_glVertex3hNV_profile;
+this->m_names[521] = "glRasterPos3xvOES";
+this->m_orig_glRasterPos3xvOES = this->m_ptr_glRasterPos3xvOES;
+if(this->m_ptr_glRasterPos3xvOES)this->m_ptr_glRasterPos3xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC)&ProfilingTableDecorator::m_glRasterPos3xvOES_profile;
+this->m_names[522] = "glPathParameterfNV";
+this->m_orig_glPathParameterfNV = this->m_ptr_glPathParameterfNV;
+if(this->m_ptr_glPathParameterfNV)this->m_ptr_glPathParameterfNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC)&ProfilingTableDecorator::m_glPathParameterfNV_profile;
+this->m_names[523] = "glGetUniformi64vNV";
+this->m_orig_glGetUniformi64vNV = this->m_ptr_glGetUniformi64vNV;
+if(this->m_ptr_glGetUniformi64vNV)this->m_ptr_glGetUniformi64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC)&ProfilingTableDecorator::m_glGetUniformi64vNV_profile;
+this->m_names[524] = "glLightiv";
+this->m_orig_glLightiv = this->m_ptr_glLightiv;
+if(this->m_ptr_glLightiv)this->m_ptr_glLightiv = (FunctionTable::MEMBERPFNGLLIGHTIVPROC)&ProfilingTableDecorator::m_glLightiv_profile;
+this->m_names[525] = "glMaterialxvOES";
+this->m_orig_glMaterialxvOES = this->m_ptr_glMaterialxvOES;
+if(this->m_ptr_glMaterialxvOES)this->m_ptr_glMaterialxvOES = (FunctionTable::MEMBERPFNGLMATERIALXVOESPROC)&ProfilingTableDecorator::m_glMaterialxvOES_profile;
+this->m_names[526] = "glNamedProgramLocalParameter4fEXT";
+this->m_orig_glNamedProgramLocalParameter4fEXT = this->m_ptr_glNamedProgramLocalParameter4fEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4fEXT)this->m_ptr_glNamedProgramLocalParameter4fEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4fEXT_profile;
+this->m_names[527] = "glVertexAttribL1dEXT";
+this->m_orig_glVertexAttribL1dEXT = this->m_ptr_glVertexAttribL1dEXT;
+if(this->m_ptr_glVertexAttribL1dEXT)this->m_ptr_glVertexAttribL1dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL1dEXT_profile;
+this->m_names[528] = "glGetnUniformdvARB";
+this->m_orig_glGetnUniformdvARB = this->m_ptr_glGetnUniformdvARB;
+if(this->m_ptr_glGetnUniformdvARB)this->m_ptr_glGetnUniformdvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC)&ProfilingTableDecorator::m_glGetnUniformdvARB_profile;
+this->m_names[529] = "glSecondaryColor3bEXT";
+this->m_orig_glSecondaryColor3bEXT = this->m_ptr_glSecondaryColor3bEXT;
+if(this->m_ptr_glSecondaryColor3bEXT)this->m_ptr_glSecondaryColor3bEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3bEXT_profile;
+this->m_names[530] = "glBeginPerfQueryINTEL";
+this->m_orig_glBeginPerfQueryINTEL = this->m_ptr_glBeginPerfQueryINTEL;
+if(this->m_ptr_glBeginPerfQueryINTEL)this->m_ptr_glBeginPerfQueryINTEL = (FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glBeginPerfQueryINTEL_profile;
+this->m_names[531] = "glProgramUniform1uivEXT";
+this->m_orig_glProgramUniform1uivEXT = this->m_ptr_glProgramUniform1uivEXT;
+if(this->m_ptr_glProgramUniform1uivEXT)this->m_ptr_glProgramUniform1uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1uivEXT_profile;
+this->m_names[532] = "glImageTransformParameterivHP";
+this->m_orig_glImageTransformParameterivHP = this->m_ptr_glImageTransformParameterivHP;
+if(this->m_ptr_glImageTransformParameterivHP)this->m_ptr_glImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterivHP_profile;
+this->m_names[533] = "glDeleteBuffers";
+this->m_orig_glDeleteBuffers = this->m_ptr_glDeleteBuffers;
+if(this->m_ptr_glDeleteBuffers)this->m_ptr_glDeleteBuffers = (FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteBuffers_profile;
+this->m_names[534] = "glBindProgramPipeline";
+this->m_orig_glBindProgramPipeline = this->m_ptr_glBindProgramPipeline;
+if(this->m_ptr_glBindProgramPipeline)this->m_ptr_glBindProgramPipeline = (FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC)&ProfilingTableDecorator::m_glBindProgramPipeline_profile;
+this->m_names[535] = "glScissor";
+this->m_orig_glScissor = this->m_ptr_glScissor;
+if(this->m_ptr_glScissor)this->m_ptr_glScissor = (FunctionTable::MEMBERPFNGLSCISSORPROC)&ProfilingTableDecorator::m_glScissor_profile;
+this->m_names[536] = "glProgramUniform4fv";
+this->m_orig_glProgramUniform4fv = this->m_ptr_glProgramUniform4fv;
+if(this->m_ptr_glProgramUniform4fv)this->m_ptr_glProgramUniform4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC)&ProfilingTableDecorator::m_glProgramUniform4fv_profile;
+this->m_names[537] = "glGetBooleanv";
+this->m_orig_glGetBooleanv = this->m_ptr_glGetBooleanv;
+if(this->m_ptr_glGetBooleanv)this->m_ptr_glGetBooleanv = (FunctionTable::MEMBERPFNGLGETBOOLEANVPROC)&ProfilingTableDecorator::m_glGetBooleanv_profile;
+this->m_names[538] = "glMaterialfv";
+this->m_orig_glMaterialfv = this->m_ptr_glMaterialfv;
+if(this->m_ptr_glMaterialfv)this->m_ptr_glMaterialfv = (FunctionTable::MEMBERPFNGLMATERIALFVPROC)&ProfilingTableDecorator::m_glMaterialfv_profile;
+this->m_names[539] = "glWindowPos4fvMESA";
+this->m_orig_glWindowPos4fvMESA = this->m_ptr_glWindowPos4fvMESA;
+if(this->m_ptr_glWindowPos4fvMESA)this->m_ptr_glWindowPos4fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4fvMESA_profile;
+this->m_names[540] = "glVertexAttribIPointerEXT";
+this->m_orig_glVertexAttribIPointerEXT = this->m_ptr_glVertexAttribIPointerEXT;
+if(this->m_ptr_glVertexAttribIPointerEXT)this->m_ptr_glVertexAttribIPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexAttribIPointerEXT_profile;
+this->m_names[541] = "glProgramBufferParametersfvNV";
+this->m_orig_glProgramBufferParametersfvNV = this->m_ptr_glProgramBufferParametersfvNV;
+if(this->m_ptr_glProgramBufferParametersfvNV)this->m_ptr_glProgramBufferParametersfvNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersfvNV_profile;
+this->m_names[542] = "glAlphaFuncxOES";
+this->m_orig_glAlphaFuncxOES = this->m_ptr_glAlphaFuncxOES;
+if(this->m_ptr_glAlphaFuncxOES)this->m_ptr_glAlphaFuncxOES = (FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC)&ProfilingTableDecorator::m_glAlphaFuncxOES_profile;
+this->m_names[543] = "glMultiDrawArraysIndirectAMD";
+this->m_orig_glMultiDrawArraysIndirectAMD = this->m_ptr_glMultiDrawArraysIndirectAMD;
+if(this->m_ptr_glMultiDrawArraysIndirectAMD)this->m_ptr_glMultiDrawArraysIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectAMD_profile;
+this->m_names[544] = "glNormalStream3ivATI";
+this->m_orig_glNormalStream3ivATI = this->m_ptr_glNormalStream3ivATI;
+if(this->m_ptr_glNormalStream3ivATI)this->m_ptr_glNormalStream3ivATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC)&ProfilingTableDecorator::m_glNormalStream3ivATI_profile;
+this->m_names[545] = "glTextureImage3DMultisampleNV";
+this->m_orig_glTextureImage3DMultisampleNV = this->m_ptr_glTextureImage3DMultisampleNV;
+if(this->m_ptr_glTextureImage3DMultisampleNV)this->m_ptr_glTextureImage3DMultisampleNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)&ProfilingTableDecorator::m_glTextureImage3DMultisampleNV_profile;
+this->m_names[546] = "glProgramUniform4uivEXT";
+this->m_orig_glProgramUniform4uivEXT = this->m_ptr_glProgramUniform4uivEXT;
+if(this->m_ptr_glProgramUniform4uivEXT)this->m_ptr_glProgramUniform4uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4uivEXT_profile;
+this->m_names[547] = "glReplacementCodeusvSUN";
+this->m_orig_glReplacementCodeusvSUN = this->m_ptr_glReplacementCodeusvSUN;
+if(this->m_ptr_glReplacementCodeusvSUN)this->m_ptr_glReplacementCodeusvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeusvSUN_profile;
+this->m_names[548] = "glPollInstrumentsSGIX";
+this->m_orig_glPollInstrumentsSGIX = this->m_ptr_glPollInstrumentsSGIX;
+if(this->m_ptr_glPollInstrumentsSGIX)this->m_ptr_glPollInstrumentsSGIX = (FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glPollInstrumentsSGIX_profile;
+this->m_names[549] = "glGetTextureLevelParameteriv";
+this->m_orig_glGetTextureLevelParameteriv = this->m_ptr_glGetTextureLevelParameteriv;
+if(this->m_ptr_glGetTextureLevelParameteriv)this->m_ptr_glGetTextureLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameteriv_profile;
+this->m_names[550] = "glVertexAttribI2uiv";
+this->m_orig_glVertexAttribI2uiv = this->m_ptr_glVertexAttribI2uiv;
+if(this->m_ptr_glVertexAttribI2uiv)this->m_ptr_glVertexAttribI2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI2uiv_profile;
+this->m_names[551] = "glMapControlPointsNV";
+this->m_orig_glMapControlPointsNV = this->m_ptr_glMapControlPointsNV;
+if(this->m_ptr_glMapControlPointsNV)this->m_ptr_glMapControlPointsNV = (FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC)&ProfilingTableDecorator::m_glMapControlPointsNV_profile;
+this->m_names[552] = "glColor4dv";
+this->m_orig_glColor4dv = this->m_ptr_glColor4dv;
+if(this->m_ptr_glColor4dv)this->m_ptr_glColor4dv = (FunctionTable::MEMBERPFNGLCOLOR4DVPROC)&ProfilingTableDecorator::m_glColor4dv_profile;
+this->m_names[553] = "glInvalidateBufferSubData";
+this->m_orig_glInvalidateBufferSubData = this->m_ptr_glInvalidateBufferSubData;
+if(this->m_ptr_glInvalidateBufferSubData)this->m_ptr_glInvalidateBufferSubData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glInvalidateBufferSubData_profile;
+this->m_names[554] = "glMultiTexCoord1hNV";
+this->m_orig_glMultiTexCoord1hNV = this->m_ptr_glMultiTexCoord1hNV;
+if(this->m_ptr_glMultiTexCoord1hNV)this->m_ptr_glMultiTexCoord1hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1hNV_profile;
+this->m_names[555] = "glPointParameterfv";
+this->m_orig_glPointParameterfv = this->m_ptr_glPointParameterfv;
+if(this->m_ptr_glPointParameterfv)this->m_ptr_glPointParameterfv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC)&ProfilingTableDecorator::m_glPointParameterfv_profile;
+this->m_names[556] = "glUniformMatrix2fvARB";
+this->m_orig_glUniformMatrix2fvARB = this->m_ptr_glUniformMatrix2fvARB;
+if(this->m_ptr_glUniformMatrix2fvARB)this->m_ptr_glUniformMatrix2fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix2fvARB_profile;
+this->m_names[557] = "glUniform2fv";
+this->m_orig_glUniform2fv = this->m_ptr_glUniform2fv;
+if(this->m_ptr_glUniform2fv)this->m_ptr_glUniform2fv = (FunctionTable::MEMBERPFNGLUNIFORM2FVPROC)&ProfilingTableDecorator::m_glUniform2fv_profile;
+this->m_names[558] = "glVertexPointerListIBM";
+this->m_orig_glVertexPointerListIBM = this->m_ptr_glVertexPointerListIBM;
+if(this->m_ptr_glVertexPointerListIBM)this->m_ptr_glVertexPointerListIBM = (FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glVertexPointerListIBM_profile;
+this->m_names[559] = "glGetMultiTexGenfvEXT";
+this->m_orig_glGetMultiTexGenfvEXT = this->m_ptr_glGetMultiTexGenfvEXT;
+if(this->m_ptr_glGetMultiTexGenfvEXT)this->m_ptr_glGetMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGenfvEXT_profile;
+this->m_names[560] = "glGetMinmaxEXT";
+this->m_orig_glGetMinmaxEXT = this->m_ptr_glGetMinmaxEXT;
+if(this->m_ptr_glGetMinmaxEXT)this->m_ptr_glGetMinmaxEXT = (FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxEXT_profile;
+this->m_names[561] = "glIsFenceNV";
+this->m_orig_glIsFenceNV = this->m_ptr_glIsFenceNV;
+if(this->m_ptr_glIsFenceNV)this->m_ptr_glIsFenceNV = (FunctionTable::MEMBERPFNGLISFENCENVPROC)&ProfilingTableDecorator::m_glIsFenceNV_profile;
+this->m_names[562] = "glMatrixFrustumEXT";
+this->m_orig_glMatrixFrustumEXT = this->m_ptr_glMatrixFrustumEXT;
+if(this->m_ptr_glMatrixFrustumEXT)this->m_ptr_glMatrixFrustumEXT = (FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC)&ProfilingTableDecorator::m_glMatrixFrustumEXT_profile;
+this->m_names[563] = "glDispatchComputeIndirect";
+this->m_orig_glDispatchComputeIndirect = this->m_ptr_glDispatchComputeIndirect;
+if(this->m_ptr_glDispatchComputeIndirect)this->m_ptr_glDispatchComputeIndirect = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC)&ProfilingTableDecorator::m_glDispatchComputeIndirect_profile;
+this->m_names[564] = "glQueryResourceNV";
+this->m_orig_glQueryResourceNV = this->m_ptr_glQueryResourceNV;
+if(this->m_ptr_glQueryResourceNV)this->m_ptr_glQueryResourceNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC)&ProfilingTableDecorator::m_glQueryResourceNV_profile;
+this->m_names[565] = "glMultiTexCoord4bOES";
+this->m_orig_glMultiTexCoord4bOES = this->m_ptr_glMultiTexCoord4bOES;
+if(this->m_ptr_glMultiTexCoord4bOES)this->m_ptr_glMultiTexCoord4bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4bOES_profile;
+this->m_names[566] = "glProgramEnvParameter4dARB";
+this->m_orig_glProgramEnvParameter4dARB = this->m_ptr_glProgramEnvParameter4dARB;
+if(this->m_ptr_glProgramEnvParameter4dARB)this->m_ptr_glProgramEnvParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4dARB_profile;
+this->m_names[567] = "glProgramUniform1uiEXT";
+this->m_orig_glProgramUniform1uiEXT = this->m_ptr_glProgramUniform1uiEXT;
+if(this->m_ptr_glProgramUniform1uiEXT)this->m_ptr_glProgramUniform1uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1uiEXT_profile;
+this->m_names[568] = "glBindBufferRange";
+this->m_orig_glBindBufferRange = this->m_ptr_glBindBufferRange;
+if(this->m_ptr_glBindBufferRange)this->m_ptr_glBindBufferRange = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glBindBufferRange_profile;
+this->m_names[569] = "glNormal3iv";
+this->m_orig_glNormal3iv = this->m_ptr_glNormal3iv;
+if(this->m_ptr_glNormal3iv)this->m_ptr_glNormal3iv = (FunctionTable::MEMBERPFNGLNORMAL3IVPROC)&ProfilingTableDecorator::m_glNormal3iv_profile;
+this->m_names[570] = "glVertexAttribL3dv";
+this->m_orig_glVertexAttribL3dv = this->m_ptr_glVertexAttribL3dv;
+if(this->m_ptr_glVertexAttribL3dv)this->m_ptr_glVertexAttribL3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC)&ProfilingTableDecorator::m_glVertexAttribL3dv_profile;
+this->m_names[571] = "glGetUniformdv";
+this->m_orig_glGetUniformdv = this->m_ptr_glGetUniformdv;
+if(this->m_ptr_glGetUniformdv)this->m_ptr_glGetUniformdv = (FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC)&ProfilingTableDecorator::m_glGetUniformdv_profile;
+this->m_names[572] = "glGetMultiTexLevelParameterfvEXT";
+this->m_orig_glGetMultiTexLevelParameterfvEXT = this->m_ptr_glGetMultiTexLevelParameterfvEXT;
+if(this->m_ptr_glGetMultiTexLevelParameterfvEXT)this->m_ptr_glGetMultiTexLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexLevelParameterfvEXT_profile;
+this->m_names[573] = "glFinalCombinerInputNV";
+this->m_orig_glFinalCombinerInputNV = this->m_ptr_glFinalCombinerInputNV;
+if(this->m_ptr_glFinalCombinerInputNV)this->m_ptr_glFinalCombinerInputNV = (FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC)&ProfilingTableDecorator::m_glFinalCombinerInputNV_profile;
+this->m_names[574] = "glCullParameterdvEXT";
+this->m_orig_glCullParameterdvEXT = this->m_ptr_glCullParameterdvEXT;
+if(this->m_ptr_glCullParameterdvEXT)this->m_ptr_glCullParameterdvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC)&ProfilingTableDecorator::m_glCullParameterdvEXT_profile;
+this->m_names[575] = "glMultiTexCoord4s";
+this->m_orig_glMultiTexCoord4s = this->m_ptr_glMultiTexCoord4s;
+if(this->m_ptr_glMultiTexCoord4s)this->m_ptr_glMultiTexCoord4s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC)&ProfilingTableDecorator::m_glMultiTexCoord4s_profile;
+this->m_names[576] = "glMapVertexAttrib1fAPPLE";
+this->m_orig_glMapVertexAttrib1fAPPLE = this->m_ptr_glMapVertexAttrib1fAPPLE;
+if(this->m_ptr_glMapVertexAttrib1fAPPLE)this->m_ptr_glMapVertexAttrib1fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib1fAPPLE_profile;
+this->m_names[577] = "glConvolutionParameterfEXT";
+this->m_orig_glConvolutionParameterfEXT = this->m_ptr_glConvolutionParameterfEXT;
+if(this->m_ptr_glConvolutionParameterfEXT)this->m_ptr_glConvolutionParameterfEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterfEXT_profile;
+this->m_names[578] = "glTexCoord1iv";
+this->m_orig_glTexCoord1iv = this->m_ptr_glTexCoord1iv;
+if(this->m_ptr_glTexCoord1iv)this->m_ptr_glTexCoord1iv = (FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC)&ProfilingTableDecorator::m_glTexCoord1iv_profile;
+this->m_names[579] = "glProgramUniform3fvEXT";
+this->m_orig_glProgramUniform3fvEXT = this->m_ptr_glProgramUniform3fvEXT;
+if(this->m_ptr_glProgramUniform3fvEXT)this->m_ptr_glProgramUniform3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3fvEXT_profile;
+this->m_names[580] = "glColor3uiv";
+this->m_orig_glColor3uiv = this->m_ptr_glColor3uiv;
+if(this->m_ptr_glColor3uiv)this->m_ptr_glColor3uiv = (FunctionTable::MEMBERPFNGLCOLOR3UIVPROC)&ProfilingTableDecorator::m_glColor3uiv_profile;
+this->m_names[581] = "glRenderGpuMaskNV";
+this->m_orig_glRenderGpuMaskNV = this->m_ptr_glRenderGpuMaskNV;
+if(this->m_ptr_glRenderGpuMaskNV)this->m_ptr_glRenderGpuMaskNV = (FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC)&ProfilingTableDecorator::m_glRenderGpuMaskNV_profile;
+this->m_names[582] = "glListBase";
+this->m_orig_glListBase = this->m_ptr_glListBase;
+if(this->m_ptr_glListBase)this->m_ptr_glListBase = (FunctionTable::MEMBERPFNGLLISTBASEPROC)&ProfilingTableDecorator::m_glListBase_profile;
+this->m_names[583] = "glTexCoord2bOES";
+this->m_orig_glTexCoord2bOES = this->m_ptr_glTexCoord2bOES;
+if(this->m_ptr_glTexCoord2bOES)this->m_ptr_glTexCoord2bOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC)&ProfilingTableDecorator::m_glTexCoord2bOES_profile;
+this->m_names[584] = "glBindMaterialParameterEXT";
+this->m_orig_glBindMaterialParameterEXT = this->m_ptr_glBindMaterialParameterEXT;
+if(this->m_ptr_glBindMaterialParameterEXT)this->m_ptr_glBindMaterialParameterEXT = (FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindMaterialParameterEXT_profile;
+this->m_names[585] = "glGlobalAlphaFactorubSUN";
+this->m_orig_glGlobalAlphaFactorubSUN = this->m_ptr_glGlobalAlphaFactorubSUN;
+if(this->m_ptr_glGlobalAlphaFactorubSUN)this->m_ptr_glGlobalAlphaFactorubSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorubSUN_profile;
+this->m_names[586] = "glVertexAttribL1ui64NV";
+this->m_orig_glVertexAttribL1ui64NV = this->m_ptr_glVertexAttribL1ui64NV;
+if(this->m_ptr_glVertexAttribL1ui64NV)this->m_ptr_glVertexAttribL1ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64NV_profile;
+this->m_names[587] = "glPointParameterfSGIS";
+this->m_orig_glPointParameterfSGIS = this->m_ptr_glPointParameterfSGIS;
+if(this->m_ptr_glPointParameterfSGIS)this->m_ptr_glPointParameterfSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC)&ProfilingTableDecorator::m_glPointParameterfSGIS_profile;
+this->m_names[588] = "glGetImageTransformParameterivHP";
+this->m_orig_glGetImageTransformParameterivHP = this->m_ptr_glGetImageTransformParameterivHP;
+if(this->m_ptr_glGetImageTransformParameterivHP)this->m_ptr_glGetImageTransformParameterivHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)&ProfilingTableDecorator::m_glGetImageTransformParameterivHP_profile;
+this->m_names[589] = "glColorSubTableEXT";
+this->m_orig_glColorSubTableEXT = this->m_ptr_glColorSubTableEXT;
+if(this->m_ptr_glColorSubTableEXT)this->m_ptr_glColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC)&ProfilingTableDecorator::m_glColorSubTableEXT_profile;
+this->m_names[590] = "glPixelTexGenParameterfvSGIS";
+this->m_orig_glPixelTexGenParameterfvSGIS = this->m_ptr_glPixelTexGenParameterfvSGIS;
+if(this->m_ptr_glPixelTexGenParameterfvSGIS)this->m_ptr_glPixelTexGenParameterfvSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterfvSGIS_profile;
+this->m_names[591] = "glClientWaitSync";
+this->m_orig_glClientWaitSync = this->m_ptr_glClientWaitSync;
+if(this->m_ptr_glClientWaitSync)this->m_ptr_glClientWaitSync = (FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC)&ProfilingTableDecorator::m_glClientWaitSync_profile;
+this->m_names[592] = "glQueryObjectParameteruiAMD";
+this->m_orig_glQueryObjectParameteruiAMD = this->m_ptr_glQueryObjectParameteruiAMD;
+if(this->m_ptr_glQueryObjectParameteruiAMD)this->m_ptr_glQueryObjectParameteruiAMD = (FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC)&ProfilingTableDecorator::m_glQueryObjectParameteruiAMD_profile;
+this->m_names[593] = "glVertexAttribs1fvNV";
+this->m_orig_glVertexAttribs1fvNV = this->m_ptr_glVertexAttribs1fvNV;
+if(this->m_ptr_glVertexAttribs1fvNV)this->m_ptr_glVertexAttribs1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1fvNV_profile;
+this->m_names[594] = "glVertexAttrib4NusvARB";
+this->m_orig_glVertexAttrib4NusvARB = this->m_ptr_glVertexAttrib4NusvARB;
+if(this->m_ptr_glVertexAttrib4NusvARB)this->m_ptr_glVertexAttrib4NusvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NusvARB_profile;
+this->m_names[595] = "glVariantPointerEXT";
+this->m_orig_glVariantPointerEXT = this->m_ptr_glVariantPointerEXT;
+if(this->m_ptr_glVariantPointerEXT)this->m_ptr_glVariantPointerEXT = (FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC)&ProfilingTableDecorator::m_glVariantPointerEXT_profile;
+this->m_names[596] = "glTextureBuffer";
+this->m_orig_glTextureBuffer = this->m_ptr_glTextureBuffer;
+if(this->m_ptr_glTextureBuffer)this->m_ptr_glTextureBuffer = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC)&ProfilingTableDecorator::m_glTextureBuffer_profile;
+this->m_names[597] = "glVertexAttribI1uiEXT";
+this->m_orig_glVertexAttribI1uiEXT = this->m_ptr_glVertexAttribI1uiEXT;
+if(this->m_ptr_glVertexAttribI1uiEXT)this->m_ptr_glVertexAttribI1uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1uiEXT_profile;
+this->m_names[598] = "glInvalidateTexImage";
+this->m_orig_glInvalidateTexImage = this->m_ptr_glInvalidateTexImage;
+if(this->m_ptr_glInvalidateTexImage)this->m_ptr_glInvalidateTexImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC)&ProfilingTableDecorator::m_glInvalidateTexImage_profile;
+this->m_names[599] = "glProgramEnvParametersI4ivNV";
+this->m_orig_glProgramEnvParametersI4ivNV = this->m_ptr_glProgramEnvParametersI4ivNV;
+if(this->m_ptr_glProgramEnvParametersI4ivNV)this->m_ptr_glProgramEnvParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParametersI4ivNV_profile;
+this->m_names[600] = "glPathGlyphIndexArrayNV";
+this->m_orig_glPathGlyphIndexArrayNV = this->m_ptr_glPathGlyphIndexArrayNV;
+if(this->m_ptr_glPathGlyphIndexArrayNV)this->m_ptr_glPathGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC)&ProfilingTableDecorator::m_glPathGlyphIndexArrayNV_profile;
+this->m_names[601] = "glCopyImageSubData";
+this->m_orig_glCopyImageSubData = this->m_ptr_glCopyImageSubData;
+if(this->m_ptr_glCopyImageSubData)this->m_ptr_glCopyImageSubData = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC)&ProfilingTableDecorator::m_glCopyImageSubData_profile;
+this->m_names[602] = "glGetUniformSubroutineuiv";
+this->m_orig_glGetUniformSubroutineuiv = this->m_ptr_glGetUniformSubroutineuiv;
+if(this->m_ptr_glGetUniformSubroutineuiv)this->m_ptr_glGetUniformSubroutineuiv = (FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC)&ProfilingTableDecorator::m_glGetUniformSubroutineuiv_profile;
+this->m_names[603] = "glBindVertexBuffer";
+this->m_orig_glBindVertexBuffer = this->m_ptr_glBindVertexBuffer;
+if(this->m_ptr_glBindVertexBuffer)this->m_ptr_glBindVertexBuffer = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC)&ProfilingTableDecorator::m_glBindVertexBuffer_profile;
+this->m_names[604] = "glMultiTexCoord1iARB";
+this->m_orig_glMultiTexCoord1iARB = this->m_ptr_glMultiTexCoord1iARB;
+if(this->m_ptr_glMultiTexCoord1iARB)this->m_ptr_glMultiTexCoord1iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1iARB_profile;
+this->m_names[605] = "glDebugMessageInsert";
+this->m_orig_glDebugMessageInsert = this->m_ptr_glDebugMessageInsert;
+if(this->m_ptr_glDebugMessageInsert)this->m_ptr_glDebugMessageInsert = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC)&ProfilingTableDecorator::m_glDebugMessageInsert_profile;
+this->m_names[606] = "glBeginVertexShaderEXT";
+this->m_orig_glBeginVertexShaderEXT = this->m_ptr_glBeginVertexShaderEXT;
+if(this->m_ptr_glBeginVertexShaderEXT)this->m_ptr_glBeginVertexShaderEXT = (FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glBeginVertexShaderEXT_profile;
+this->m_names[607] = "glIsVariantEnabledEXT";
+this->m_orig_glIsVariantEnabledEXT = this->m_ptr_glIsVariantEnabledEXT;
+if(this->m_ptr_glIsVariantEnabledEXT)this->m_ptr_glIsVariantEnabledEXT = (FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC)&ProfilingTableDecorator::m_glIsVariantEnabledEXT_profile;
+this->m_names[608] = "glPassThroughxOES";
+this->m_orig_glPassThroughxOES = this->m_ptr_glPassThroughxOES;
+if(this->m_ptr_glPassThroughxOES)this->m_ptr_glPassThroughxOES = (FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC)&ProfilingTableDecorator::m_glPassThroughxOES_profile;
+this->m_names[609] = "glIsSampler";
+this->m_orig_glIsSampler = this->m_ptr_glIsSampler;
+if(this->m_ptr_glIsSampler)this->m_ptr_glIsSampler = (FunctionTable::MEMBERPFNGLISSAMPLERPROC)&ProfilingTableDecorator::m_glIsSampler_profile;
+this->m_names[610] = "glConservativeRasterParameterfNV";
+this->m_orig_glConservativeRasterParameterfNV = this->m_ptr_glConservativeRasterParameterfNV;
+if(this->m_ptr_glConservativeRasterParameterfNV)this->m_ptr_glConservativeRasterParameterfNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC)&ProfilingTableDecorator::m_glConservativeRasterParameterfNV_profile;
+this->m_names[611] = "glMultiTexGenivEXT";
+this->m_orig_glMultiTexGenivEXT = this->m_ptr_glMultiTexGenivEXT;
+if(this->m_ptr_glMultiTexGenivEXT)this->m_ptr_glMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenivEXT_profile;
+this->m_names[612] = "glNamedFramebufferTexture2DEXT";
+this->m_orig_glNamedFramebufferTexture2DEXT = this->m_ptr_glNamedFramebufferTexture2DEXT;
+if(this->m_ptr_glNamedFramebufferTexture2DEXT)this->m_ptr_glNamedFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture2DEXT_profile;
+this->m_names[613] = "glCopyTexSubImage1D";
+this->m_orig_glCopyTexSubImage1D = this->m_ptr_glCopyTexSubImage1D;
+if(this->m_ptr_glCopyTexSubImage1D)this->m_ptr_glCopyTexSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage1D_profile;
+this->m_names[614] = "glTexCoord1i";
+this->m_orig_glTexCoord1i = this->m_ptr_glTexCoord1i;
+if(this->m_ptr_glTexCoord1i)this->m_ptr_glTexCoord1i = (FunctionTable::MEMBERPFNGLTEXCOORD1IPROC)&ProfilingTableDecorator::m_glTexCoord1i_profile;
+this->m_names[615] = "glCheckFramebufferStatus";
+this->m_orig_glCheckFramebufferStatus = this->m_ptr_glCheckFramebufferStatus;
+if(this->m_ptr_glCheckFramebufferStatus)this->m_ptr_glCheckFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC)&ProfilingTableDecorator::m_glCheckFramebufferStatus_profile;
+this->m_names[616] = "glDrawElementArrayAPPLE";
+this->m_orig_glDrawElementArrayAPPLE = this->m_ptr_glDrawElementArrayAPPLE;
+if(this->m_ptr_glDrawElementArrayAPPLE)this->m_ptr_glDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glDrawElementArrayAPPLE_profile;
+this->m_names[617] = "glTexCoord1d";
+this->m_orig_glTexCoord1d = this->m_ptr_glTexCoord1d;
+if(this->m_ptr_glTexCoord1d)this->m_ptr_glTexCoord1d = (FunctionTable::MEMBERPFNGLTEXCOORD1DPROC)&ProfilingTableDecorator::m_glTexCoord1d_profile;
+this->m_names[618] = "glTexCoord1f";
+this->m_orig_glTexCoord1f = this->m_ptr_glTexCoord1f;
+if(this->m_ptr_glTexCoord1f)this->m_ptr_glTexCoord1f = (FunctionTable::MEMBERPFNGLTEXCOORD1FPROC)&ProfilingTableDecorator::m_glTexCoord1f_profile;
+this->m_names[619] = "glFragmentLightivSGIX";
+this->m_orig_glFragmentLightivSGIX = this->m_ptr_glFragmentLightivSGIX;
+if(this->m_ptr_glFragmentLightivSGIX)this->m_ptr_glFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightivSGIX_profile;
+this->m_names[620] = "glBindImageTexture";
+this->m_orig_glBindImageTexture = this->m_ptr_glBindImageTexture;
+if(this->m_ptr_glBindImageTexture)this->m_ptr_glBindImageTexture = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC)&ProfilingTableDecorator::m_glBindImageTexture_profile;
+this->m_names[621] = "glTransformFeedbackVaryings";
+this->m_orig_glTransformFeedbackVaryings = this->m_ptr_glTransformFeedbackVaryings;
+if(this->m_ptr_glTransformFeedbackVaryings)this->m_ptr_glTransformFeedbackVaryings = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryings_profile;
+this->m_names[622] = "glMulticastBufferSubDataNV";
+this->m_orig_glMulticastBufferSubDataNV = this->m_ptr_glMulticastBufferSubDataNV;
+if(this->m_ptr_glMulticastBufferSubDataNV)this->m_ptr_glMulticastBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC)&ProfilingTableDecorator::m_glMulticastBufferSubDataNV_profile;
+this->m_names[623] = "glDrawRangeElements";
+this->m_orig_glDrawRangeElements = this->m_ptr_glDrawRangeElements;
+if(this->m_ptr_glDrawRangeElements)this->m_ptr_glDrawRangeElements = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC)&ProfilingTableDecorator::m_glDrawRangeElements_profile;
+this->m_names[624] = "glTexCoord1s";
+this->m_orig_glTexCoord1s = this->m_ptr_glTexCoord1s;
+if(this->m_ptr_glTexCoord1s)this->m_ptr_glTexCoord1s = (FunctionTable::MEMBERPFNGLTEXCOORD1SPROC)&ProfilingTableDecorator::m_glTexCoord1s_profile;
+this->m_names[625] = "glBindBufferBase";
+this->m_orig_glBindBufferBase = this->m_ptr_glBindBufferBase;
+if(this->m_ptr_glBindBufferBase)this->m_ptr_glBindBufferBase = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC)&ProfilingTableDecorator::m_glBindBufferBase_profile;
+this->m_names[626] = "glColor3bv";
+this->m_orig_glColor3bv = this->m_ptr_glColor3bv;
+if(this->m_ptr_glColor3bv)this->m_ptr_glColor3bv = (FunctionTable::MEMBERPFNGLCOLOR3BVPROC)&ProfilingTableDecorator::m_glColor3bv_profile;
+this->m_names[627] = "glSyncTextureINTEL";
+this->m_orig_glSyncTextureINTEL = this->m_ptr_glSyncTextureINTEL;
+if(this->m_ptr_glSyncTextureINTEL)this->m_ptr_glSyncTextureINTEL = (FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC)&ProfilingTableDecorator::m_glSyncTextureINTEL_profile;
+this->m_names[628] = "glCreateSamplers";
+this->m_orig_glCreateSamplers = this->m_ptr_glCreateSamplers;
+if(this->m_ptr_glCreateSamplers)this->m_ptr_glCreateSamplers = (FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC)&ProfilingTableDecorator::m_glCreateSamplers_profile;
+this->m_names[629] = "glCombinerParameterfNV";
+this->m_orig_glCombinerParameterfNV = this->m_ptr_glCombinerParameterfNV;
+if(this->m_ptr_glCombinerParameterfNV)this->m_ptr_glCombinerParameterfNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC)&ProfilingTableDecorator::m_glCombinerParameterfNV_profile;
+this->m_names[630] = "glGetArrayObjectivATI";
+this->m_orig_glGetArrayObjectivATI = this->m_ptr_glGetArrayObjectivATI;
+if(this->m_ptr_glGetArrayObjectivATI)this->m_ptr_glGetArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetArrayObjectivATI_profile;
+this->m_names[631] = "glMultiDrawArrays";
+this->m_orig_glMultiDrawArrays = this->m_ptr_glMultiDrawArrays;
+if(this->m_ptr_glMultiDrawArrays)this->m_ptr_glMultiDrawArrays = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC)&ProfilingTableDecorator::m_glMultiDrawArrays_profile;
+this->m_names[632] = "glSampleMapATI";
+this->m_orig_glSampleMapATI = this->m_ptr_glSampleMapATI;
+if(this->m_ptr_glSampleMapATI)this->m_ptr_glSampleMapATI = (FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC)&ProfilingTableDecorator::m_glSampleMapATI_profile;
+this->m_names[633] = "glProgramUniform2i64ARB";
+this->m_orig_glProgramUniform2i64ARB = this->m_ptr_glProgramUniform2i64ARB;
+if(this->m_ptr_glProgramUniform2i64ARB)this->m_ptr_glProgramUniform2i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform2i64ARB_profile;
+this->m_names[634] = "glBinormal3ivEXT";
+this->m_orig_glBinormal3ivEXT = this->m_ptr_glBinormal3ivEXT;
+if(this->m_ptr_glBinormal3ivEXT)this->m_ptr_glBinormal3ivEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC)&ProfilingTableDecorator::m_glBinormal3ivEXT_profile;
+this->m_names[635] = "glMultiDrawArraysIndirectCountARB";
+this->m_orig_glMultiDrawArraysIndirectCountARB = this->m_ptr_glMultiDrawArraysIndirectCountARB;
+if(this->m_ptr_glMultiDrawArraysIndirectCountARB)this->m_ptr_glMultiDrawArraysIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectCountARB_profile;
+this->m_names[636] = "glTextureStorageMem1DEXT";
+this->m_orig_glTextureStorageMem1DEXT = this->m_ptr_glTextureStorageMem1DEXT;
+if(this->m_ptr_glTextureStorageMem1DEXT)this->m_ptr_glTextureStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC)&ProfilingTableDecorator::m_glTextureStorageMem1DEXT_profile;
+this->m_names[637] = "glWindowPos2ivMESA";
+this->m_orig_glWindowPos2ivMESA = this->m_ptr_glWindowPos2ivMESA;
+if(this->m_ptr_glWindowPos2ivMESA)this->m_ptr_glWindowPos2ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2ivMESA_profile;
+this->m_names[638] = "glTexCoordP4ui";
+this->m_orig_glTexCoordP4ui = this->m_ptr_glTexCoordP4ui;
+if(this->m_ptr_glTexCoordP4ui)this->m_ptr_glTexCoordP4ui = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC)&ProfilingTableDecorator::m_glTexCoordP4ui_profile;
+this->m_names[639] = "glMultiTexSubImage1DEXT";
+this->m_orig_glMultiTexSubImage1DEXT = this->m_ptr_glMultiTexSubImage1DEXT;
+if(this->m_ptr_glMultiTexSubImage1DEXT)this->m_ptr_glMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage1DEXT_profile;
+this->m_names[640] = "glProgramUniformMatrix2x3fvEXT";
+this->m_orig_glProgramUniformMatrix2x3fvEXT = this->m_ptr_glProgramUniformMatrix2x3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x3fvEXT)this->m_ptr_glProgramUniformMatrix2x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3fvEXT_profile;
+this->m_names[641] = "glBufferDataARB";
+this->m_orig_glBufferDataARB = this->m_ptr_glBufferDataARB;
+if(this->m_ptr_glBufferDataARB)this->m_ptr_glBufferDataARB = (FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC)&ProfilingTableDecorator::m_glBufferDataARB_profile;
+this->m_names[642] = "glVertexAttribIFormat";
+this->m_orig_glVertexAttribIFormat = this->m_ptr_glVertexAttribIFormat;
+if(this->m_ptr_glVertexAttribIFormat)this->m_ptr_glVertexAttribIFormat = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC)&ProfilingTableDecorator::m_glVertexAttribIFormat_profile;
+this->m_names[643] = "glCreateFramebuffers";
+this->m_orig_glCreateFramebuffers = this->m_ptr_glCreateFramebuffers;
+if(this->m_ptr_glCreateFramebuffers)this->m_ptr_glCreateFramebuffers = (FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glCreateFramebuffers_profile;
+this->m_names[644] = "glNormalStream3dvATI";
+this->m_orig_glNormalStream3dvATI = this->m_ptr_glNormalStream3dvATI;
+if(this->m_ptr_glNormalStream3dvATI)this->m_ptr_glNormalStream3dvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC)&ProfilingTableDecorator::m_glNormalStream3dvATI_profile;
+this->m_names[645] = "glClearAccum";
+this->m_orig_glClearAccum = this->m_ptr_glClearAccum;
+if(this->m_ptr_glClearAccum)this->m_ptr_glClearAccum = (FunctionTable::MEMBERPFNGLCLEARACCUMPROC)&ProfilingTableDecorator::m_glClearAccum_profile;
+this->m_names[646] = "glUniform3i64vNV";
+this->m_orig_glUniform3i64vNV = this->m_ptr_glUniform3i64vNV;
+if(this->m_ptr_glUniform3i64vNV)this->m_ptr_glUniform3i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC)&ProfilingTableDecorator::m_glUniform3i64vNV_profile;
+this->m_names[647] = "glNormal3fVertex3fSUN";
+this->m_orig_glNormal3fVertex3fSUN = this->m_ptr_glNormal3fVertex3fSUN;
+if(this->m_ptr_glNormal3fVertex3fSUN)this->m_ptr_glNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glNormal3fVertex3fSUN_profile;
+this->m_names[648] = "glUniform2uivEXT";
+this->m_orig_glUniform2uivEXT = this->m_ptr_glUniform2uivEXT;
+if(this->m_ptr_glUniform2uivEXT)this->m_ptr_glUniform2uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC)&ProfilingTableDecorator::m_glUniform2uivEXT_profile;
+this->m_names[649] = "glBeginQuery";
+this->m_orig_glBeginQuery = this->m_ptr_glBeginQuery;
+if(this->m_ptr_glBeginQuery)this->m_ptr_glBeginQuery = (FunctionTable::MEMBERPFNGLBEGINQUERYPROC)&ProfilingTableDecorator::m_glBeginQuery_profile;
+this->m_names[650] = "glStencilThenCoverStrokePathInstancedNV";
+this->m_orig_glStencilThenCoverStrokePathInstancedNV = this->m_ptr_glStencilThenCoverStrokePathInstancedNV;
+if(this->m_ptr_glStencilThenCoverStrokePathInstancedNV)this->m_ptr_glStencilThenCoverStrokePathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverStrokePathInstancedNV_profile;
+this->m_names[651] = "glBindBuffer";
+this->m_orig_glBindBuffer = this->m_ptr_glBindBuffer;
+if(this->m_ptr_glBindBuffer)this->m_ptr_glBindBuffer = (FunctionTable::MEMBERPFNGLBINDBUFFERPROC)&ProfilingTableDecorator::m_glBindBuffer_profile;
+this->m_names[652] = "glMap2d";
+this->m_orig_glMap2d = this->m_ptr_glMap2d;
+if(this->m_ptr_glMap2d)this->m_ptr_glMap2d = (FunctionTable::MEMBERPFNGLMAP2DPROC)&ProfilingTableDecorator::m_glMap2d_profile;
+this->m_names[653] = "glMap2f";
+this->m_orig_glMap2f = this->m_ptr_glMap2f;
+if(this->m_ptr_glMap2f)this->m_ptr_glMap2f = (FunctionTable::MEMBERPFNGLMAP2FPROC)&ProfilingTableDecorator::m_glMap2f_profile;
+this->m_names[654] = "glMakeImageHandleResidentNV";
+this->m_orig_glMakeImageHandleResidentNV = this->m_ptr_glMakeImageHandleResidentNV;
+if(this->m_ptr_glMakeImageHandleResidentNV)this->m_ptr_glMakeImageHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeImageHandleResidentNV_profile;
+this->m_names[655] = "glUniformMatrix2x4fv";
+this->m_orig_glUniformMatrix2x4fv = this->m_ptr_glUniformMatrix2x4fv;
+if(this->m_ptr_glUniformMatrix2x4fv)this->m_ptr_glUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x4fv_profile;
+this->m_names[656] = "glGetMultiTexParameterfvEXT";
+this->m_orig_glGetMultiTexParameterfvEXT = this->m_ptr_glGetMultiTexParameterfvEXT;
+if(this->m_ptr_glGetMultiTexParameterfvEXT)this->m_ptr_glGetMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterfvEXT_profile;
+this->m_names[657] = "glDepthRangeIndexed";
+this->m_orig_glDepthRangeIndexed = this->m_ptr_glDepthRangeIndexed;
+if(this->m_ptr_glDepthRangeIndexed)this->m_ptr_glDepthRangeIndexed = (FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC)&ProfilingTableDecorator::m_glDepthRangeIndexed_profile;
+this->m_names[658] = "glIsEnabled";
+this->m_orig_glIsEnabled = this->m_ptr_glIsEnabled;
+if(this->m_ptr_glIsEnabled)this->m_ptr_glIsEnabled = (FunctionTable::MEMBERPFNGLISENABLEDPROC)&ProfilingTableDecorator::m_glIsEnabled_profile;
+this->m_names[659] = "glMatrixScalefEXT";
+this->m_orig_glMatrixScalefEXT = this->m_ptr_glMatrixScalefEXT;
+if(this->m_ptr_glMatrixScalefEXT)this->m_ptr_glMatrixScalefEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC)&ProfilingTableDecorator::m_glMatrixScalefEXT_profile;
+this->m_names[660] = "glGetError";
+this->m_orig_glGetError = this->m_ptr_glGetError;
+if(this->m_ptr_glGetError)this->m_ptr_glGetError = (FunctionTable::MEMBERPFNGLGETERRORPROC)&ProfilingTableDecorator::m_glGetError_profile;
+this->m_names[661] = "glGetTexEnviv";
+this->m_orig_glGetTexEnviv = this->m_ptr_glGetTexEnviv;
+if(this->m_ptr_glGetTexEnviv)this->m_ptr_glGetTexEnviv = (FunctionTable::MEMBERPFNGLGETTEXENVIVPROC)&ProfilingTableDecorator::m_glGetTexEnviv_profile;
+this->m_names[662] = "glBindTextureUnitParameterEXT";
+this->m_orig_glBindTextureUnitParameterEXT = this->m_ptr_glBindTextureUnitParameterEXT;
+if(this->m_ptr_glBindTextureUnitParameterEXT)this->m_ptr_glBindTextureUnitParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindTextureUnitParameterEXT_profile;
+this->m_names[663] = "glGetnUniformfvARB";
+this->m_orig_glGetnUniformfvARB = this->m_ptr_glGetnUniformfvARB;
+if(this->m_ptr_glGetnUniformfvARB)this->m_ptr_glGetnUniformfvARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC)&ProfilingTableDecorator::m_glGetnUniformfvARB_profile;
+this->m_names[664] = "glReplacementCodeuiNormal3fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiNormal3fVertex3fvSUN_profile;
+this->m_names[665] = "glDeletePerfQueryINTEL";
+this->m_orig_glDeletePerfQueryINTEL = this->m_ptr_glDeletePerfQueryINTEL;
+if(this->m_ptr_glDeletePerfQueryINTEL)this->m_ptr_glDeletePerfQueryINTEL = (FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glDeletePerfQueryINTEL_profile;
+this->m_names[666] = "glActiveVaryingNV";
+this->m_orig_glActiveVaryingNV = this->m_ptr_glActiveVaryingNV;
+if(this->m_ptr_glActiveVaryingNV)this->m_ptr_glActiveVaryingNV = (FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC)&ProfilingTableDecorator::m_glActiveVaryingNV_profile;
+this->m_names[667] = "glGetActiveUniformARB";
+this->m_orig_glGetActiveUniformARB = this->m_ptr_glGetActiveUniformARB;
+if(this->m_ptr_glGetActiveUniformARB)this->m_ptr_glGetActiveUniformARB = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC)&ProfilingTableDecorator::m_glGetActiveUniformARB_profile;
+this->m_names[668] = "glVertexAttribI3ivEXT";
+this->m_orig_glVertexAttribI3ivEXT = this->m_ptr_glVertexAttribI3ivEXT;
+if(this->m_ptr_glVertexAttribI3ivEXT)this->m_ptr_glVertexAttribI3ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3ivEXT_profile;
+this->m_names[669] = "glEvalCoord1d";
+this->m_orig_glEvalCoord1d = this->m_ptr_glEvalCoord1d;
+if(this->m_ptr_glEvalCoord1d)this->m_ptr_glEvalCoord1d = (FunctionTable::MEMBERPFNGLEVALCOORD1DPROC)&ProfilingTableDecorator::m_glEvalCoord1d_profile;
+this->m_names[670] = "glNamedCopyBufferSubDataEXT";
+this->m_orig_glNamedCopyBufferSubDataEXT = this->m_ptr_glNamedCopyBufferSubDataEXT;
+if(this->m_ptr_glNamedCopyBufferSubDataEXT)this->m_ptr_glNamedCopyBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glNamedCopyBufferSubDataEXT_profile;
+this->m_names[671] = "glEvalCoord1f";
+this->m_orig_glEvalCoord1f = this->m_ptr_glEvalCoord1f;
+if(this->m_ptr_glEvalCoord1f)this->m_ptr_glEvalCoord1f = (FunctionTable::MEMBERPFNGLEVALCOORD1FPROC)&ProfilingTableDecorator::m_glEvalCoord1f_profile;
+this->m_names[672] = "glPixelMapfv";
+this->m_orig_glPixelMapfv = this->m_ptr_glPixelMapfv;
+if(this->m_ptr_glPixelMapfv)this->m_ptr_glPixelMapfv = (FunctionTable::MEMBERPFNGLPIXELMAPFVPROC)&ProfilingTableDecorator::m_glPixelMapfv_profile;
+this->m_names[673] = "glVertexAttribI1ivEXT";
+this->m_orig_glVertexAttribI1ivEXT = this->m_ptr_glVertexAttribI1ivEXT;
+if(this->m_ptr_glVertexAttribI1ivEXT)this->m_ptr_glVertexAttribI1ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1ivEXT_profile;
+this->m_names[674] = "glCreateSyncFromCLeventARB";
+this->m_orig_glCreateSyncFromCLeventARB = this->m_ptr_glCreateSyncFromCLeventARB;
+if(this->m_ptr_glCreateSyncFromCLeventARB)this->m_ptr_glCreateSyncFromCLeventARB = (FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC)&ProfilingTableDecorator::m_glCreateSyncFromCLeventARB_profile;
+this->m_names[675] = "glGetPixelMapusv";
+this->m_orig_glGetPixelMapusv = this->m_ptr_glGetPixelMapusv;
+if(this->m_ptr_glGetPixelMapusv)this->m_ptr_glGetPixelMapusv = (FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glGetPixelMapusv_profile;
+this->m_names[676] = "glGetnColorTableARB";
+this->m_orig_glGetnColorTableARB = this->m_ptr_glGetnColorTableARB;
+if(this->m_ptr_glGetnColorTableARB)this->m_ptr_glGetnColorTableARB = (FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC)&ProfilingTableDecorator::m_glGetnColorTableARB_profile;
+this->m_names[677] = "glAccum";
+this->m_orig_glAccum = this->m_ptr_glAccum;
+if(this->m_ptr_glAccum)this->m_ptr_glAccum = (FunctionTable::MEMBERPFNGLACCUMPROC)&ProfilingTableDecorator::m_glAccum_profile;
+this->m_names[678] = "glRasterPos3sv";
+this->m_orig_glRasterPos3sv = this->m_ptr_glRasterPos3sv;
+if(this->m_ptr_glRasterPos3sv)this->m_ptr_glRasterPos3sv = (FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC)&ProfilingTableDecorator::m_glRasterPos3sv_profile;
+this->m_names[679] = "glTexCoord2iv";
+this->m_orig_glTexCoord2iv = this->m_ptr_glTexCoord2iv;
+if(this->m_ptr_glTexCoord2iv)this->m_ptr_glTexCoord2iv = (FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC)&ProfilingTableDecorator::m_glTexCoord2iv_profile;
+this->m_names[680] = "glBlendFunciARB";
+this->m_orig_glBlendFunciARB = this->m_ptr_glBlendFunciARB;
+if(this->m_ptr_glBlendFunciARB)this->m_ptr_glBlendFunciARB = (FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC)&ProfilingTableDecorator::m_glBlendFunciARB_profile;
+this->m_names[681] = "glProgramUniform3i64vARB";
+this->m_orig_glProgramUniform3i64vARB = this->m_ptr_glProgramUniform3i64vARB;
+if(this->m_ptr_glProgramUniform3i64vARB)this->m_ptr_glProgramUniform3i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform3i64vARB_profile;
+this->m_names[682] = "glGetFramebufferAttachmentParameteriv";
+this->m_orig_glGetFramebufferAttachmentParameteriv = this->m_ptr_glGetFramebufferAttachmentParameteriv;
+if(this->m_ptr_glGetFramebufferAttachmentParameteriv)this->m_ptr_glGetFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetFramebufferAttachmentParameteriv_profile;
+this->m_names[683] = "glProgramUniform4ui";
+this->m_orig_glProgramUniform4ui = this->m_ptr_glProgramUniform4ui;
+if(this->m_ptr_glProgramUniform4ui)this->m_ptr_glProgramUniform4ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC)&ProfilingTableDecorator::m_glProgramUniform4ui_profile;
+this->m_names[684] = "glStencilMask";
+this->m_orig_glStencilMask = this->m_ptr_glStencilMask;
+if(this->m_ptr_glStencilMask)this->m_ptr_glStencilMask = (FunctionTable::MEMBERPFNGLSTENCILMASKPROC)&ProfilingTableDecorator::m_glStencilMask_profile;
+this->m_names[685] = "glResetHistogramEXT";
+this->m_orig_glResetHistogramEXT = this->m_ptr_glResetHistogramEXT;
+if(this->m_ptr_glResetHistogramEXT)this->m_ptr_glResetHistogramEXT = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glResetHistogramEXT_profile;
+this->m_names[686] = "glLightxOES";
+this->m_orig_glLightxOES = this->m_ptr_glLightxOES;
+if(this->m_ptr_glLightxOES)this->m_ptr_glLightxOES = (FunctionTable::MEMBERPFNGLLIGHTXOESPROC)&ProfilingTableDecorator::m_glLightxOES_profile;
+this->m_names[687] = "glNamedBufferData";
+this->m_orig_glNamedBufferData = this->m_ptr_glNamedBufferData;
+if(this->m_ptr_glNamedBufferData)this->m_ptr_glNamedBufferData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC)&ProfilingTableDecorator::m_glNamedBufferData_profile;
+this->m_names[688] = "glVertexStream3sATI";
+this->m_orig_glVertexStream3sATI = this->m_ptr_glVertexStream3sATI;
+if(this->m_ptr_glVertexStream3sATI)this->m_ptr_glVertexStream3sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC)&ProfilingTableDecorator::m_glVertexStream3sATI_profile;
+this->m_names[689] = "glVertexAttrib3fvARB";
+this->m_orig_glVertexAttrib3fvARB = this->m_ptr_glVertexAttrib3fvARB;
+if(this->m_ptr_glVertexAttrib3fvARB)this->m_ptr_glVertexAttrib3fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3fvARB_profile;
+this->m_names[690] = "glClearNamedBufferSubData";
+this->m_orig_glClearNamedBufferSubData = this->m_ptr_glClearNamedBufferSubData;
+if(this->m_ptr_glClearNamedBufferSubData)this->m_ptr_glClearNamedBufferSubData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glClearNamedBufferSubData_profile;
+this->m_names[691] = "glProgramUniformHandleui64ARB";
+this->m_orig_glProgramUniformHandleui64ARB = this->m_ptr_glProgramUniformHandleui64ARB;
+if(this->m_ptr_glProgramUniformHandleui64ARB)this->m_ptr_glProgramUniformHandleui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64ARB_profile;
+this->m_names[692] = "glUniform3iARB";
+this->m_orig_glUniform3iARB = this->m_ptr_glUniform3iARB;
+if(this->m_ptr_glUniform3iARB)this->m_ptr_glUniform3iARB = (FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC)&ProfilingTableDecorator::m_glUniform3iARB_profile;
+this->m_names[693] = "glCreateProgramObjectARB";
+this->m_orig_glCreateProgramObjectARB = this->m_ptr_glCreateProgramObjectARB;
+if(this->m_ptr_glCreateProgramObjectARB)this->m_ptr_glCreateProgramObjectARB = (FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC)&ProfilingTableDecorator::m_glCreateProgramObjectARB_profile;
+this->m_names[694] = "glMultiTexCoord1dvARB";
+this->m_orig_glMultiTexCoord1dvARB = this->m_ptr_glMultiTexCoord1dvARB;
+if(this->m_ptr_glMultiTexCoord1dvARB)this->m_ptr_glMultiTexCoord1dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dvARB_profile;
+this->m_names[695] = "glGetObjectParameterfvARB";
+this->m_orig_glGetObjectParameterfvARB = this->m_ptr_glGetObjectParameterfvARB;
+if(this->m_ptr_glGetObjectParameterfvARB)this->m_ptr_glGetObjectParameterfvARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetObjectParameterfvARB_profile;
+this->m_names[696] = "glRectsv";
+this->m_orig_glRectsv = this->m_ptr_glRectsv;
+if(this->m_ptr_glRectsv)this->m_ptr_glRectsv = (FunctionTable::MEMBERPFNGLRECTSVPROC)&ProfilingTableDecorator::m_glRectsv_profile;
+this->m_names[697] = "glMultiTexImage2DEXT";
+this->m_orig_glMultiTexImage2DEXT = this->m_ptr_glMultiTexImage2DEXT;
+if(this->m_ptr_glMultiTexImage2DEXT)this->m_ptr_glMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage2DEXT_profile;
+this->m_names[698] = "glProgramUniform1i64NV";
+this->m_orig_glProgramUniform1i64NV = this->m_ptr_glProgramUniform1i64NV;
+if(this->m_ptr_glProgramUniform1i64NV)this->m_ptr_glProgramUniform1i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform1i64NV_profile;
+this->m_names[699] = "glGetObjectBufferivATI";
+this->m_orig_glGetObjectBufferivATI = this->m_ptr_glGetObjectBufferivATI;
+if(this->m_ptr_glGetObjectBufferivATI)this->m_ptr_glGetObjectBufferivATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC)&ProfilingTableDecorator::m_glGetObjectBufferivATI_profile;
+this->m_names[700] = "glUniform4i64ARB";
+this->m_orig_glUniform4i64ARB = this->m_ptr_glUniform4i64ARB;
+if(this->m_ptr_glUniform4i64ARB)this->m_ptr_glUniform4i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC)&ProfilingTableDecorator::m_glUniform4i64ARB_profile;
+this->m_names[701] = "glReplacementCodeuiColor4ubVertex3fvSUN";
+this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fvSUN_profile;
+this->m_names[702] = "glBlendFuncSeparateINGR";
+this->m_orig_glBlendFuncSeparateINGR = this->m_ptr_glBlendFuncSeparateINGR;
+if(this->m_ptr_glBlendFuncSeparateINGR)this->m_ptr_glBlendFuncSeparateINGR = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateINGR_profile;
+this->m_names[703] = "glGetVideoCaptureStreamfvNV";
+this->m_orig_glGetVideoCaptureStreamfvNV = this->m_ptr_glGetVideoCaptureStreamfvNV;
+if(this->m_ptr_glGetVideoCaptureStreamfvNV)this->m_ptr_glGetVideoCaptureStreamfvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamfvNV_profile;
+this->m_names[704] = "glVertexAttrib2fARB";
+this->m_orig_glVertexAttrib2fARB = this->m_ptr_glVertexAttrib2fARB;
+if(this->m_ptr_glVertexAttrib2fARB)this->m_ptr_glVertexAttrib2fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2fARB_profile;
+this->m_names[705] = "glGetTexGeniv";
+this->m_orig_glGetTexGeniv = this->m_ptr_glGetTexGeniv;
+if(this->m_ptr_glGetTexGeniv)this->m_ptr_glGetTexGeniv = (FunctionTable::MEMBERPFNGLGETTEXGENIVPROC)&ProfilingTableDecorator::m_glGetTexGeniv_profile;
+this->m_names[706] = "glPixelStorei";
+this->m_orig_glPixelStorei = this->m_ptr_glPixelStorei;
+if(this->m_ptr_glPixelStorei)this->m_ptr_glPixelStorei = (FunctionTable::MEMBERPFNGLPIXELSTOREIPROC)&ProfilingTableDecorator::m_glPixelStorei_profile;
+this->m_names[707] = "glGetCompressedTextureSubImage";
+this->m_orig_glGetCompressedTextureSubImage = this->m_ptr_glGetCompressedTextureSubImage;
+if(this->m_ptr_glGetCompressedTextureSubImage)this->m_ptr_glGetCompressedTextureSubImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTextureSubImage_profile;
+this->m_names[708] = "glCopyImageSubDataNV";
+this->m_orig_glCopyImageSubDataNV = this->m_ptr_glCopyImageSubDataNV;
+if(this->m_ptr_glCopyImageSubDataNV)this->m_ptr_glCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC)&ProfilingTableDecorator::m_glCopyImageSubDataNV_profile;
+this->m_names[709] = "glActiveShaderProgram";
+this->m_orig_glActiveShaderProgram = this->m_ptr_glActiveShaderProgram;
+if(this->m_ptr_glActiveShaderProgram)this->m_ptr_glActiveShaderProgram = (FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC)&ProfilingTableDecorator::m_glActiveShaderProgram_profile;
+this->m_names[710] = "glVertexStream1iATI";
+this->m_orig_glVertexStream1iATI = this->m_ptr_glVertexStream1iATI;
+if(this->m_ptr_glVertexStream1iATI)this->m_ptr_glVertexStream1iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC)&ProfilingTableDecorator::m_glVertexStream1iATI_profile;
+this->m_names[711] = "glPatchParameterfv";
+this->m_orig_glPatchParameterfv = this->m_ptr_glPatchParameterfv;
+if(this->m_ptr_glPatchParameterfv)this->m_ptr_glPatchParameterfv = (FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC)&ProfilingTableDecorator::m_glPatchParameterfv_profile;
+this->m_names[712] = "glIsFramebufferEXT";
+this->m_orig_glIsFramebufferEXT = this->m_ptr_glIsFramebufferEXT;
+if(this->m_ptr_glIsFramebufferEXT)this->m_ptr_glIsFramebufferEXT = (FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glIsFramebufferEXT_profile;
+this->m_names[713] = "glTextureStorage2D";
+this->m_orig_glTextureStorage2D = this->m_ptr_glTextureStorage2D;
+if(this->m_ptr_glTextureStorage2D)this->m_ptr_glTextureStorage2D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC)&ProfilingTableDecorator::m_glTextureStorage2D_profile;
+this->m_names[714] = "glProgramUniform1ui64ARB";
+this->m_orig_glProgramUniform1ui64ARB = this->m_ptr_glProgramUniform1ui64ARB;
+if(this->m_ptr_glProgramUniform1ui64ARB)this->m_ptr_glProgramUniform1ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64ARB_profile;
+this->m_names[715] = "glTexBufferRange";
+this->m_orig_glTexBufferRange = this->m_ptr_glTexBufferRange;
+if(this->m_ptr_glTexBufferRange)this->m_ptr_glTexBufferRange = (FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTexBufferRange_profile;
+this->m_names[716] = "glGetPixelTexGenParameterivSGIS";
+this->m_orig_glGetPixelTexGenParameterivSGIS = this->m_ptr_glGetPixelTexGenParameterivSGIS;
+if(this->m_ptr_glGetPixelTexGenParameterivSGIS)this->m_ptr_glGetPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC)&ProfilingTableDecorator::m_glGetPixelTexGenParameterivSGIS_profile;
+this->m_names[717] = "glTextureSubImage3DEXT";
+this->m_orig_glTextureSubImage3DEXT = this->m_ptr_glTextureSubImage3DEXT;
+if(this->m_ptr_glTextureSubImage3DEXT)this->m_ptr_glTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage3DEXT_profile;
+this->m_names[718] = "glClipControl";
+this->m_orig_glClipControl = this->m_ptr_glClipControl;
+if(this->m_ptr_glClipControl)this->m_ptr_glClipControl = (FunctionTable::MEMBERPFNGLCLIPCONTROLPROC)&ProfilingTableDecorator::m_glClipControl_profile;
+this->m_names[719] = "glGetProgramResourceiv";
+this->m_orig_glGetProgramResourceiv = this->m_ptr_glGetProgramResourceiv;
+if(this->m_ptr_glGetProgramResourceiv)this->m_ptr_glGetProgramResourceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC)&ProfilingTableDecorator::m_glGetProgramResourceiv_profile;
+this->m_names[720] = "glMultiTexCoordP2uiv";
+this->m_orig_glMultiTexCoordP2uiv = this->m_ptr_glMultiTexCoordP2uiv;
+if(this->m_ptr_glMultiTexCoordP2uiv)this->m_ptr_glMultiTexCoordP2uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP2uiv_profile;
+this->m_names[721] = "glVertexAttribI3ui";
+this->m_orig_glVertexAttribI3ui = this->m_ptr_glVertexAttribI3ui;
+if(this->m_ptr_glVertexAttribI3ui)this->m_ptr_glVertexAttribI3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC)&ProfilingTableDecorator::m_glVertexAttribI3ui_profile;
+this->m_names[722] = "glSampleMaskSGIS";
+this->m_orig_glSampleMaskSGIS = this->m_ptr_glSampleMaskSGIS;
+if(this->m_ptr_glSampleMaskSGIS)this->m_ptr_glSampleMaskSGIS = (FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC)&ProfilingTableDecorator::m_glSampleMaskSGIS_profile;
+this->m_names[723] = "glVertexAttrib4NivARB";
+this->m_orig_glVertexAttrib4NivARB = this->m_ptr_glVertexAttrib4NivARB;
+if(this->m_ptr_glVertexAttrib4NivARB)this->m_ptr_glVertexAttrib4NivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NivARB_profile;
+this->m_names[724] = "glGlobalAlphaFactorfSUN";
+this->m_orig_glGlobalAlphaFactorfSUN = this->m_ptr_glGlobalAlphaFactorfSUN;
+if(this->m_ptr_glGlobalAlphaFactorfSUN)this->m_ptr_glGlobalAlphaFactorfSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorfSUN_profile;
+this->m_names[725] = "glBlendEquationSeparateIndexedAMD";
+this->m_orig_glBlendEquationSeparateIndexedAMD = this->m_ptr_glBlendEquationSeparateIndexedAMD;
+if(this->m_ptr_glBlendEquationSeparateIndexedAMD)this->m_ptr_glBlendEquationSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateIndexedAMD_profile;
+this->m_names[726] = "glGetPerfCounterInfoINTEL";
+this->m_orig_glGetPerfCounterInfoINTEL = this->m_ptr_glGetPerfCounterInfoINTEL;
+if(this->m_ptr_glGetPerfCounterInfoINTEL)this->m_ptr_glGetPerfCounterInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC)&ProfilingTableDecorator::m_glGetPerfCounterInfoINTEL_profile;
+this->m_names[727] = "glDeleteProgramsNV";
+this->m_orig_glDeleteProgramsNV = this->m_ptr_glDeleteProgramsNV;
+if(this->m_ptr_glDeleteProgramsNV)this->m_ptr_glDeleteProgramsNV = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC)&ProfilingTableDecorator::m_glDeleteProgramsNV_profile;
+this->m_names[728] = "glPixelZoomxOES";
+this->m_orig_glPixelZoomxOES = this->m_ptr_glPixelZoomxOES;
+if(this->m_ptr_glPixelZoomxOES)this->m_ptr_glPixelZoomxOES = (FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC)&ProfilingTableDecorator::m_glPixelZoomxOES_profile;
+this->m_names[729] = "glGetCombinerOutputParameterivNV";
+this->m_orig_glGetCombinerOutputParameterivNV = this->m_ptr_glGetCombinerOutputParameterivNV;
+if(this->m_ptr_glGetCombinerOutputParameterivNV)this->m_ptr_glGetCombinerOutputParameterivNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetCombinerOutputParameterivNV_profile;
+this->m_names[730] = "glRasterPos2xvOES";
+this->m_orig_glRasterPos2xvOES = this->m_ptr_glRasterPos2xvOES;
+if(this->m_ptr_glRasterPos2xvOES)this->m_ptr_glRasterPos2xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC)&ProfilingTableDecorator::m_glRasterPos2xvOES_profile;
+this->m_names[731] = "glGetTexImage";
+this->m_orig_glGetTexImage = this->m_ptr_glGetTexImage;
+if(this->m_ptr_glGetTexImage)this->m_ptr_glGetTexImage = (FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetTexImage_profile;
+this->m_names[732] = "glVertexArrayVertexBuffers";
+this->m_orig_glVertexArrayVertexBuffers = this->m_ptr_glVertexArrayVertexBuffers;
+if(this->m_ptr_glVertexArrayVertexBuffers)this->m_ptr_glVertexArrayVertexBuffers = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBuffers_profile;
+this->m_names[733] = "glUniform1ui64NV";
+this->m_orig_glUniform1ui64NV = this->m_ptr_glUniform1ui64NV;
+if(this->m_ptr_glUniform1ui64NV)this->m_ptr_glUniform1ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC)&ProfilingTableDecorator::m_glUniform1ui64NV_profile;
+this->m_names[734] = "glProgramParameteri";
+this->m_orig_glProgramParameteri = this->m_ptr_glProgramParameteri;
+if(this->m_ptr_glProgramParameteri)this->m_ptr_glProgramParameteri = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC)&ProfilingTableDecorator::m_glProgramParameteri_profile;
+this->m_names[735] = "glNormal3xOES";
+this->m_orig_glNormal3xOES = this->m_ptr_glNormal3xOES;
+if(this->m_ptr_glNormal3xOES)this->m_ptr_glNormal3xOES = (FunctionTable::MEMBERPFNGLNORMAL3XOESPROC)&ProfilingTableDecorator::m_glNormal3xOES_profile;
+this->m_names[736] = "glGetMapfv";
+this->m_orig_glGetMapfv = this->m_ptr_glGetMapfv;
+if(this->m_ptr_glGetMapfv)this->m_ptr_glGetMapfv = (FunctionTable::MEMBERPFNGLGETMAPFVPROC)&ProfilingTableDecorator::m_glGetMapfv_profile;
+this->m_names[737] = "glVertexStream2dvATI";
+this->m_orig_glVertexStream2dvATI = this->m_ptr_glVertexStream2dvATI;
+if(this->m_ptr_glVertexStream2dvATI)this->m_ptr_glVertexStream2dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC)&ProfilingTableDecorator::m_glVertexStream2dvATI_profile;
+this->m_names[738] = "glPathStencilDepthOffsetNV";
+this->m_orig_glPathStencilDepthOffsetNV = this->m_ptr_glPathStencilDepthOffsetNV;
+if(this->m_ptr_glPathStencilDepthOffsetNV)this->m_ptr_glPathStencilDepthOffsetNV = (FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC)&ProfilingTableDecorator::m_glPathStencilDepthOffsetNV_profile;
+this->m_names[739] = "glIsStateNV";
+this->m_orig_glIsStateNV = this->m_ptr_glIsStateNV;
+if(this->m_ptr_glIsStateNV)this->m_ptr_glIsStateNV = (FunctionTable::MEMBERPFNGLISSTATENVPROC)&ProfilingTableDecorator::m_glIsStateNV_profile;
+this->m_names[740] = "glGetIntegerui64vNV";
+this->m_orig_glGetIntegerui64vNV = this->m_ptr_glGetIntegerui64vNV;
+if(this->m_ptr_glGetIntegerui64vNV)this->m_ptr_glGetIntegerui64vNV = (FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC)&ProfilingTableDecorator::m_glGetIntegerui64vNV_profile;
+this->m_names[741] = "glGetImageTransformParameterfvHP";
+this->m_orig_glGetImageTransformParameterfvHP = this->m_ptr_glGetImageTransformParameterfvHP;
+if(this->m_ptr_glGetImageTransformParameterfvHP)this->m_ptr_glGetImageTransformParameterfvHP = (FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)&ProfilingTableDecorator::m_glGetImageTransformParameterfvHP_profile;
+this->m_names[742] = "glRasterPos2fv";
+this->m_orig_glRasterPos2fv = this->m_ptr_glRasterPos2fv;
+if(this->m_ptr_glRasterPos2fv)this->m_ptr_glRasterPos2fv = (FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC)&ProfilingTableDecorator::m_glRasterPos2fv_profile;
+this->m_names[743] = "glVertex3xOES";
+this->m_orig_glVertex3xOES = this->m_ptr_glVertex3xOES;
+if(this->m_ptr_glVertex3xOES)this->m_ptr_glVertex3xOES = (FunctionTable::MEMBERPFNGLVERTEX3XOESPROC)&ProfilingTableDecorator::m_glVertex3xOES_profile;
+this->m_names[744] = "glIsMemoryObjectEXT";
+this->m_orig_glIsMemoryObjectEXT = this->m_ptr_glIsMemoryObjectEXT;
+if(this->m_ptr_glIsMemoryObjectEXT)this->m_ptr_glIsMemoryObjectEXT = (FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC)&ProfilingTableDecorator::m_glIsMemoryObjectEXT_profile;
+this->m_names[745] = "glWeightPointerARB";
+this->m_orig_glWeightPointerARB = this->m_ptr_glWeightPointerARB;
+if(this->m_ptr_glWeightPointerARB)this->m_ptr_glWeightPointerARB = (FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC)&ProfilingTableDecorator::m_glWeightPointerARB_profile;
+this->m_names[746] = "glFinishFenceNV";
+this->m_orig_glFinishFenceNV = this->m_ptr_glFinishFenceNV;
+if(this->m_ptr_glFinishFenceNV)this->m_ptr_glFinishFenceNV = (FunctionTable::MEMBERPFNGLFINISHFENCENVPROC)&ProfilingTableDecorator::m_glFinishFenceNV_profile;
+this->m_names[747] = "glDepthRangexOES";
+this->m_orig_glDepthRangexOES = this->m_ptr_glDepthRangexOES;
+if(this->m_ptr_glDepthRangexOES)this->m_ptr_glDepthRangexOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC)&ProfilingTableDecorator::m_glDepthRangexOES_profile;
+this->m_names[748] = "glEnableVertexArrayAttribEXT";
+this->m_orig_glEnableVertexArrayAttribEXT = this->m_ptr_glEnableVertexArrayAttribEXT;
+if(this->m_ptr_glEnableVertexArrayAttribEXT)this->m_ptr_glEnableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC)&ProfilingTableDecorator::m_glEnableVertexArrayAttribEXT_profile;
+this->m_names[749] = "glProgramUniform2uivEXT";
+this->m_orig_glProgramUniform2uivEXT = this->m_ptr_glProgramUniform2uivEXT;
+if(this->m_ptr_glProgramUniform2uivEXT)this->m_ptr_glProgramUniform2uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2uivEXT_profile;
+this->m_names[750] = "glGetDoubleIndexedvEXT";
+this->m_orig_glGetDoubleIndexedvEXT = this->m_ptr_glGetDoubleIndexedvEXT;
+if(this->m_ptr_glGetDoubleIndexedvEXT)this->m_ptr_glGetDoubleIndexedvEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetDoubleIndexedvEXT_profile;
+this->m_names[751] = "glWindowPos2fMESA";
+this->m_orig_glWindowPos2fMESA = this->m_ptr_glWindowPos2fMESA;
+if(this->m_ptr_glWindowPos2fMESA)this->m_ptr_glWindowPos2fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC)&ProfilingTableDecorator::m_glWindowPos2fMESA_profile;
+this->m_names[752] = "glSecondaryColor3b";
+this->m_orig_glSecondaryColor3b = this->m_ptr_glSecondaryColor3b;
+if(this->m_ptr_glSecondaryColor3b)this->m_ptr_glSecondaryColor3b = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC)&ProfilingTableDecorator::m_glSecondaryColor3b_profile;
+this->m_names[753] = "glCopyConvolutionFilter1DEXT";
+this->m_orig_glCopyConvolutionFilter1DEXT = this->m_ptr_glCopyConvolutionFilter1DEXT;
+if(this->m_ptr_glCopyConvolutionFilter1DEXT)this->m_ptr_glCopyConvolutionFilter1DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter1DEXT_profile;
+this->m_names[754] = "glWindowPos2sv";
+this->m_orig_glWindowPos2sv = this->m_ptr_glWindowPos2sv;
+if(this->m_ptr_glWindowPos2sv)this->m_ptr_glWindowPos2sv = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC)&ProfilingTableDecorator::m_glWindowPos2sv_profile;
+this->m_names[755] = "glBindFramebufferEXT";
+this->m_orig_glBindFramebufferEXT = this->m_ptr_glBindFramebufferEXT;
+if(this->m_ptr_glBindFramebufferEXT)this->m_ptr_glBindFramebufferEXT = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glBindFramebufferEXT_profile;
+this->m_names[756] = "glCreateShader";
+this->m_orig_glCreateShader = this->m_ptr_glCreateShader;
+if(this->m_ptr_glCreateShader)this->m_ptr_glCreateShader = (FunctionTable::MEMBERPFNGLCREATESHADERPROC)&ProfilingTableDecorator::m_glCreateShader_profile;
+this->m_names[757] = "glGenPathsNV";
+this->m_orig_glGenPathsNV = this->m_ptr_glGenPathsNV;
+if(this->m_ptr_glGenPathsNV)this->m_ptr_glGenPathsNV = (FunctionTable::MEMBERPFNGLGENPATHSNVPROC)&ProfilingTableDecorator::m_glGenPathsNV_profile;
+this->m_names[758] = "glGenRenderbuffers";
+this->m_orig_glGenRenderbuffers = this->m_ptr_glGenRenderbuffers;
+if(this->m_ptr_glGenRenderbuffers)this->m_ptr_glGenRenderbuffers = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC)&ProfilingTableDecorator::m_glGenRenderbuffers_profile;
+this->m_names[759] = "glCopyTexSubImage2D";
+this->m_orig_glCopyTexSubImage2D = this->m_ptr_glCopyTexSubImage2D;
+if(this->m_ptr_glCopyTexSubImage2D)this->m_ptr_glCopyTexSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTexSubImage2D_profile;
+this->m_names[760] = "glVertexAttrib4ubvARB";
+this->m_orig_glVertexAttrib4ubvARB = this->m_ptr_glVertexAttrib4ubvARB;
+if(this->m_ptr_glVertexAttrib4ubvARB)this->m_ptr_glVertexAttrib4ubvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubvARB_profile;
+this->m_names[761] = "glDrawTextureNV";
+this->m_orig_glDrawTextureNV = this->m_ptr_glDrawTextureNV;
+if(this->m_ptr_glDrawTextureNV)this->m_ptr_glDrawTextureNV = (FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC)&ProfilingTableDecorator::m_glDrawTextureNV_profile;
+this->m_names[762] = "glVertexAttribs1svNV";
+this->m_orig_glVertexAttribs1svNV = this->m_ptr_glVertexAttribs1svNV;
+if(this->m_ptr_glVertexAttribs1svNV)this->m_ptr_glVertexAttribs1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1svNV_profile;
+this->m_names[763] = "glClearNamedBufferSubDataEXT";
+this->m_orig_glClearNamedBufferSubDataEXT = this->m_ptr_glClearNamedBufferSubDataEXT;
+if(this->m_ptr_glClearNamedBufferSubDataEXT)this->m_ptr_glClearNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glClearNamedBufferSubDataEXT_profile;
+this->m_names[764] = "glBlendFuncSeparate";
+this->m_orig_glBlendFuncSeparate = this->m_ptr_glBlendFuncSeparate;
+if(this->m_ptr_glBlendFuncSeparate)this->m_ptr_glBlendFuncSeparate = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC)&ProfilingTableDecorator::m_glBlendFuncSeparate_profile;
+this->m_names[765] = "glPointParameterfARB";
+this->m_orig_glPointParameterfARB = this->m_ptr_glPointParameterfARB;
+if(this->m_ptr_glPointParameterfARB)this->m_ptr_glPointParameterfARB = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC)&ProfilingTableDecorator::m_glPointParameterfARB_profile;
+this->m_names[766] = "glTexCoord2fv";
+this->m_orig_glTexCoord2fv = this->m_ptr_glTexCoord2fv;
+if(this->m_ptr_glTexCoord2fv)this->m_ptr_glTexCoord2fv = (FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC)&ProfilingTableDecorator::m_glTexCoord2fv_profile;
+this->m_names[767] = "glGetVariantFloatvEXT";
+this->m_orig_glGetVariantFloatvEXT = this->m_ptr_glGetVariantFloatvEXT;
+if(this->m_ptr_glGetVariantFloatvEXT)this->m_ptr_glGetVariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetVariantFloatvEXT_profile;
+this->m_names[768] = "glVertexP2ui";
+this->m_orig_glVertexP2ui = this->m_ptr_glVertexP2ui;
+if(this->m_ptr_glVertexP2ui)this->m_ptr_glVertexP2ui = (FunctionTable::MEMBERPFNGLVERTEXP2UIPROC)&ProfilingTableDecorator::m_glVertexP2ui_profile;
+this->m_names[769] = "glWindowPos2dMESA";
+this->m_orig_glWindowPos2dMESA = this->m_ptr_glWindowPos2dMESA;
+if(this->m_ptr_glWindowPos2dMESA)this->m_ptr_glWindowPos2dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC)&ProfilingTableDecorator::m_glWindowPos2dMESA_profile;
+this->m_names[770] = "glTexCoord4fv";
+this->m_orig_glTexCoord4fv = this->m_ptr_glTexCoord4fv;
+if(this->m_ptr_glTexCoord4fv)this->m_ptr_glTexCoord4fv = (FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC)&ProfilingTableDecorator::m_glTexCoord4fv_profile;
+this->m_names[771] = "glBindFragDataLocationEXT";
+this->m_orig_glBindFragDataLocationEXT = this->m_ptr_glBindFragDataLocationEXT;
+if(this->m_ptr_glBindFragDataLocationEXT)this->m_ptr_glBindFragDataLocationEXT = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC)&ProfilingTableDecorator::m_glBindFragDataLocationEXT_profile;
+this->m_names[772] = "glCompressedTexSubImage1DARB";
+this->m_orig_glCompressedTexSubImage1DARB = this->m_ptr_glCompressedTexSubImage1DARB;
+if(this->m_ptr_glCompressedTexSubImage1DARB)this->m_ptr_glCompressedTexSubImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage1DARB_profile;
+this->m_names[773] = "glGetTextureImageEXT";
+this->m_orig_glGetTextureImageEXT = this->m_ptr_glGetTextureImageEXT;
+if(this->m_ptr_glGetTextureImageEXT)this->m_ptr_glGetTextureImageEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetTextureImageEXT_profile;
+this->m_names[774] = "glFogCoordd";
+this->m_orig_glFogCoordd = this->m_ptr_glFogCoordd;
+if(this->m_ptr_glFogCoordd)this->m_ptr_glFogCoordd = (FunctionTable::MEMBERPFNGLFOGCOORDDPROC)&ProfilingTableDecorator::m_glFogCoordd_profile;
+this->m_names[775] = "glPointSize";
+this->m_orig_glPointSize = this->m_ptr_glPointSize;
+if(this->m_ptr_glPointSize)this->m_ptr_glPointSize = (FunctionTable::MEMBERPFNGLPOINTSIZEPROC)&ProfilingTableDecorator::m_glPointSize_profile;
+this->m_names[776] = "glBindTextureUnit";
+this->m_orig_glBindTextureUnit = this->m_ptr_glBindTextureUnit;
+if(this->m_ptr_glBindTextureUnit)this->m_ptr_glBindTextureUnit = (FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC)&ProfilingTableDecorator::m_glBindTextureUnit_profile;
+this->m_names[777] = "glProgramEnvParameterI4uiNV";
+this->m_orig_glProgramEnvParameterI4uiNV = this->m_ptr_glProgramEnvParameterI4uiNV;
+if(this->m_ptr_glProgramEnvParameterI4uiNV)this->m_ptr_glProgramEnvParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4uiNV_profile;
+this->m_names[778] = "glGetProgramPipelineInfoLog";
+this->m_orig_glGetProgramPipelineInfoLog = this->m_ptr_glGetProgramPipelineInfoLog;
+if(this->m_ptr_glGetProgramPipelineInfoLog)this->m_ptr_glGetProgramPipelineInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC)&ProfilingTableDecorator::m_glGetProgramPipelineInfoLog_profile;
+this->m_names[779] = "glProgramUniform4i64vARB";
+this->m_orig_glProgramUniform4i64vARB = this->m_ptr_glProgramUniform4i64vARB;
+if(this->m_ptr_glProgramUniform4i64vARB)this->m_ptr_glProgramUniform4i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform4i64vARB_profile;
+this->m_names[780] = "glVertexAttrib4Nuiv";
+this->m_orig_glVertexAttrib4Nuiv = this->m_ptr_glVertexAttrib4Nuiv;
+if(this->m_ptr_glVertexAttrib4Nuiv)this->m_ptr_glVertexAttrib4Nuiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nuiv_profile;
+this->m_names[781] = "glGetUniformfvARB";
+this->m_orig_glGetUniformfvARB = this->m_ptr_glGetUniformfvARB;
+if(this->m_ptr_glGetUniformfvARB)this->m_ptr_glGetUniformfvARB = (FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC)&ProfilingTableDecorator::m_glGetUniformfvARB_profile;
+this->m_names[782] = "glWaitSync";
+this->m_orig_glWaitSync = this->m_ptr_glWaitSync;
+if(this->m_ptr_glWaitSync)this->m_ptr_glWaitSync = (FunctionTable::MEMBERPFNGLWAITSYNCPROC)&ProfilingTableDecorator::m_glWaitSync_profile;
+this->m_names[783] = "glUniform3i";
+this->m_orig_glUniform3i = this->m_ptr_glUniform3i;
+if(this->m_ptr_glUniform3i)this->m_ptr_glUniform3i = (FunctionTable::MEMBERPFNGLUNIFORM3IPROC)&ProfilingTableDecorator::m_glUniform3i_profile;
+this->m_names[784] = "glBlendEquationSeparatei";
+this->m_orig_glBlendEquationSeparatei = this->m_ptr_glBlendEquationSeparatei;
+if(this->m_ptr_glBlendEquationSeparatei)this->m_ptr_glBlendEquationSeparatei = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC)&ProfilingTableDecorator::m_glBlendEquationSeparatei_profile;
+this->m_names[785] = "glVertexAttrib2hvNV";
+this->m_orig_glVertexAttrib2hvNV = this->m_ptr_glVertexAttrib2hvNV;
+if(this->m_ptr_glVertexAttrib2hvNV)this->m_ptr_glVertexAttrib2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2hvNV_profile;
+this->m_names[786] = "glTextureParameterivEXT";
+this->m_orig_glTextureParameterivEXT = this->m_ptr_glTextureParameterivEXT;
+if(this->m_ptr_glTextureParameterivEXT)this->m_ptr_glTextureParameterivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterivEXT_profile;
+this->m_names[787] = "glUniform3d";
+this->m_orig_glUniform3d = this->m_ptr_glUniform3d;
+if(this->m_ptr_glUniform3d)this->m_ptr_glUniform3d = (FunctionTable::MEMBERPFNGLUNIFORM3DPROC)&ProfilingTableDecorator::m_glUniform3d_profile;
+this->m_names[788] = "glUniform3f";
+this->m_orig_glUniform3f = this->m_ptr_glUniform3f;
+if(this->m_ptr_glUniform3f)this->m_ptr_glUniform3f = (FunctionTable::MEMBERPFNGLUNIFORM3FPROC)&ProfilingTableDecorator::m_glUniform3f_profile;
+this->m_names[789] = "glActiveProgramEXT";
+this->m_orig_glActiveProgramEXT = this->m_ptr_glActiveProgramEXT;
+if(this->m_ptr_glActiveProgramEXT)this->m_ptr_glActiveProgramEXT = (FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC)&ProfilingTableDecorator::m_glActiveProgramEXT_profile;
+this->m_names[790] = "glProgramUniform3uiv";
+this->m_orig_glProgramUniform3uiv = this->m_ptr_glProgramUniform3uiv;
+if(this->m_ptr_glProgramUniform3uiv)this->m_ptr_glProgramUniform3uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC)&ProfilingTableDecorator::m_glProgramUniform3uiv_profile;
+this->m_names[791] = "glUniform3ui64vARB";
+this->m_orig_glUniform3ui64vARB = this->m_ptr_glUniform3ui64vARB;
+if(this->m_ptr_glUniform3ui64vARB)this->m_ptr_glUniform3ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC)&ProfilingTableDecorator::m_glUniform3ui64vARB_profile;
+this->m_names[792] = "glProgramUniform1ui64vARB";
+this->m_orig_glProgramUniform1ui64vARB = this->m_ptr_glProgramUniform1ui64vARB;
+if(this->m_ptr_glProgramUniform1ui64vARB)this->m_ptr_glProgramUniform1ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64vARB_profile;
+this->m_names[793] = "glTextureParameterfEXT";
+this->m_orig_glTextureParameterfEXT = this->m_ptr_glTextureParameterfEXT;
+if(this->m_ptr_glTextureParameterfEXT)this->m_ptr_glTextureParameterfEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glTextureParameterfEXT_profile;
+this->m_names[794] = "glSetFragmentShaderConstantATI";
+this->m_orig_glSetFragmentShaderConstantATI = this->m_ptr_glSetFragmentShaderConstantATI;
+if(this->m_ptr_glSetFragmentShaderConstantATI)this->m_ptr_glSetFragmentShaderConstantATI = (FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC)&ProfilingTableDecorator::m_glSetFragmentShaderConstantATI_profile;
+this->m_names[795] = "glColorSubTable";
+this->m_orig_glColorSubTable = this->m_ptr_glColorSubTable;
+if(this->m_ptr_glColorSubTable)this->m_ptr_glColorSubTable = (FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC)&ProfilingTableDecorator::m_glColorSubTable_profile;
+this->m_names[796] = "glReplacementCodeuiSUN";
+this->m_orig_glReplacementCodeuiSUN = this->m_ptr_glReplacementCodeuiSUN;
+if(this->m_ptr_glReplacementCodeuiSUN)this->m_ptr_glReplacementCodeuiSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiSUN_profile;
+this->m_names[797] = "glStateCaptureNV";
+this->m_orig_glStateCaptureNV = this->m_ptr_glStateCaptureNV;
+if(this->m_ptr_glStateCaptureNV)this->m_ptr_glStateCaptureNV = (FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC)&ProfilingTableDecorator::m_glStateCaptureNV_profile;
+this->m_names[798] = "glBindAttribLocation";
+this->m_orig_glBindAttribLocation = this->m_ptr_glBindAttribLocation;
+if(this->m_ptr_glBindAttribLocation)this->m_ptr_glBindAttribLocation = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC)&ProfilingTableDecorator::m_glBindAttribLocation_profile;
+this->m_names[799] = "glWeightusvARB";
+this->m_orig_glWeightusvARB = this->m_ptr_glWeightusvARB;
+if(this->m_ptr_glWeightusvARB)this->m_ptr_glWeightusvARB = (FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC)&ProfilingTableDecorator::m_glWeightusvARB_profile;
+this->m_names[800] = "glGetFragDataIndex";
+this->m_orig_glGetFragDataIndex = this->m_ptr_glGetFragDataIndex;
+if(this->m_ptr_glGetFragDataIndex)this->m_ptr_glGetFragDataIndex = (FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC)&ProfilingTableDecorator::m_glGetFragDataIndex_profile;
+this->m_names[801] = "glMultiTexCoord2xOES";
+this->m_orig_glMultiTexCoord2xOES = this->m_ptr_glMultiTexCoord2xOES;
+if(this->m_ptr_glMultiTexCoord2xOES)this->m_ptr_glMultiTexCoord2xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2xOES_profile;
+this->m_names[802] = "glColor3sv";
+this->m_orig_glColor3sv = this->m_ptr_glColor3sv;
+if(this->m_ptr_glColor3sv)this->m_ptr_glColor3sv = (FunctionTable::MEMBERPFNGLCOLOR3SVPROC)&ProfilingTableDecorator::m_glColor3sv_profile;
+this->m_names[803] = "glTexCoord2fVertex3fSUN";
+this->m_orig_glTexCoord2fVertex3fSUN = this->m_ptr_glTexCoord2fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fVertex3fSUN)this->m_ptr_glTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fVertex3fSUN_profile;
+this->m_names[804] = "glGetMemoryObjectParameterivEXT";
+this->m_orig_glGetMemoryObjectParameterivEXT = this->m_ptr_glGetMemoryObjectParameterivEXT;
+if(this->m_ptr_glGetMemoryObjectParameterivEXT)this->m_ptr_glGetMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMemoryObjectParameterivEXT_profile;
+this->m_names[805] = "glPolygonOffsetEXT";
+this->m_orig_glPolygonOffsetEXT = this->m_ptr_glPolygonOffsetEXT;
+if(this->m_ptr_glPolygonOffsetEXT)this->m_ptr_glPolygonOffsetEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC)&ProfilingTableDecorator::m_glPolygonOffsetEXT_profile;
+this->m_names[806] = "glWeightPathsNV";
+this->m_orig_glWeightPathsNV = this->m_ptr_glWeightPathsNV;
+if(this->m_ptr_glWeightPathsNV)this->m_ptr_glWeightPathsNV = (FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC)&ProfilingTableDecorator::m_glWeightPathsNV_profile;
+this->m_names[807] = "glCombinerStageParameterfvNV";
+this->m_orig_glCombinerStageParameterfvNV = this->m_ptr_glCombinerStageParameterfvNV;
+if(this->m_ptr_glCombinerStageParameterfvNV)this->m_ptr_glCombinerStageParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glCombinerStageParameterfvNV_profile;
+this->m_names[808] = "glPointParameterfEXT";
+this->m_orig_glPointParameterfEXT = this->m_ptr_glPointParameterfEXT;
+if(this->m_ptr_glPointParameterfEXT)this->m_ptr_glPointParameterfEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glPointParameterfEXT_profile;
+this->m_names[809] = "glCopyTexImage1DEXT";
+this->m_orig_glCopyTexImage1DEXT = this->m_ptr_glCopyTexImage1DEXT;
+if(this->m_ptr_glCopyTexImage1DEXT)this->m_ptr_glCopyTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTexImage1DEXT_profile;
+this->m_names[810] = "glVertex4sv";
+this->m_orig_glVertex4sv = this->m_ptr_glVertex4sv;
+if(this->m_ptr_glVertex4sv)this->m_ptr_glVertex4sv = (FunctionTable::MEMBERPFNGLVERTEX4SVPROC)&ProfilingTableDecorator::m_glVertex4sv_profile;
+this->m_names[811] = "glMatrixMultfEXT";
+this->m_orig_glMatrixMultfEXT = this->m_ptr_glMatrixMultfEXT;
+if(this->m_ptr_glMatrixMultfEXT)this->m_ptr_glMatrixMultfEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC)&ProfilingTableDecorator::m_glMatrixMultfEXT_profile;
+this->m_names[812] = "glCompressedTextureSubImage3DEXT";
+this->m_orig_glCompressedTextureSubImage3DEXT = this->m_ptr_glCompressedTextureSubImage3DEXT;
+if(this->m_ptr_glCompressedTextureSubImage3DEXT)this->m_ptr_glCompressedTextureSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage3DEXT_profile;
+this->m_names[813] = "glGetTexLevelParameterxvOES";
+this->m_orig_glGetTexLevelParameterxvOES = this->m_ptr_glGetTexLevelParameterxvOES;
+if(this->m_ptr_glGetTexLevelParameterxvOES)this->m_ptr_glGetTexLevelParameterxvOES = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetTexLevelParameterxvOES_profile;
+this->m_names[814] = "glVertexAttribL3dvEXT";
+this->m_orig_glVertexAttribL3dvEXT = this->m_ptr_glVertexAttribL3dvEXT;
+if(this->m_ptr_glVertexAttribL3dvEXT)this->m_ptr_glVertexAttribL3dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL3dvEXT_profile;
+this->m_names[815] = "glMultiTexCoordP4ui";
+this->m_orig_glMultiTexCoordP4ui = this->m_ptr_glMultiTexCoordP4ui;
+if(this->m_ptr_glMultiTexCoordP4ui)this->m_ptr_glMultiTexCoordP4ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP4ui_profile;
+this->m_names[816] = "glGetTextureLevelParameterivEXT";
+this->m_orig_glGetTextureLevelParameterivEXT = this->m_ptr_glGetTextureLevelParameterivEXT;
+if(this->m_ptr_glGetTextureLevelParameterivEXT)this->m_ptr_glGetTextureLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterivEXT_profile;
+this->m_names[817] = "glAlphaFragmentOp2ATI";
+this->m_orig_glAlphaFragmentOp2ATI = this->m_ptr_glAlphaFragmentOp2ATI;
+if(this->m_ptr_glAlphaFragmentOp2ATI)this->m_ptr_glAlphaFragmentOp2ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp2ATI_profile;
+this->m_names[818] = "glDeleteFramebuffers";
+this->m_orig_glDeleteFramebuffers = this->m_ptr_glDeleteFramebuffers;
+if(this->m_ptr_glDeleteFramebuffers)this->m_ptr_glDeleteFramebuffers = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteFramebuffers_profile;
+this->m_names[819] = "glDrawArrays";
+this->m_orig_glDrawArrays = this->m_ptr_glDrawArrays;
+if(this->m_ptr_glDrawArrays)this->m_ptr_glDrawArrays = (FunctionTable::MEMBERPFNGLDRAWARRAYSPROC)&ProfilingTableDecorator::m_glDrawArrays_profile;
+this->m_names[820] = "glGetTransformFeedbackiv";
+this->m_orig_glGetTransformFeedbackiv = this->m_ptr_glGetTransformFeedbackiv;
+if(this->m_ptr_glGetTransformFeedbackiv)this->m_ptr_glGetTransformFeedbackiv = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackiv_profile;
+this->m_names[821] = "glGetnTexImageARB";
+this->m_orig_glGetnTexImageARB = this->m_ptr_glGetnTexImageARB;
+if(this->m_ptr_glGetnTexImageARB)this->m_ptr_glGetnTexImageARB = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetnTexImageARB_profile;
+this->m_names[822] = "glClear";
+this->m_orig_glClear = this->m_ptr_glClear;
+if(this->m_ptr_glClear)this->m_ptr_glClear = (FunctionTable::MEMBERPFNGLCLEARPROC)&ProfilingTableDecorator::m_glClear_profile;
+this->m_names[823] = "glVertexArrayParameteriAPPLE";
+this->m_orig_glVertexArrayParameteriAPPLE = this->m_ptr_glVertexArrayParameteriAPPLE;
+if(this->m_ptr_glVertexArrayParameteriAPPLE)this->m_ptr_glVertexArrayParameteriAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC)&ProfilingTableDecorator::m_glVertexArrayParameteriAPPLE_profile;
+this->m_names[824] = "glMultiTexCoord2dvARB";
+this->m_orig_glMultiTexCoord2dvARB = this->m_ptr_glMultiTexCoord2dvARB;
+if(this->m_ptr_glMultiTexCoord2dvARB)this->m_ptr_glMultiTexCoord2dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dvARB_profile;
+this->m_names[825] = "glGetVideoCaptureStreamdvNV";
+this->m_orig_glGetVideoCaptureStreamdvNV = this->m_ptr_glGetVideoCaptureStreamdvNV;
+if(this->m_ptr_glGetVideoCaptureStreamdvNV)this->m_ptr_glGetVideoCaptureStreamdvNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamdvNV_profile;
+this->m_names[826] = "glFragmentLightModelivSGIX";
+this->m_orig_glFragmentLightModelivSGIX = this->m_ptr_glFragmentLightModelivSGIX;
+if(this->m_ptr_glFragmentLightModelivSGIX)this->m_ptr_glFragmentLightModelivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelivSGIX_profile;
+this->m_names[827] = "glVertexAttribP2ui";
+this->m_orig_glVertexAttribP2ui = this->m_ptr_glVertexAttribP2ui;
+if(this->m_ptr_glVertexAttribP2ui)this->m_ptr_glVertexAttribP2ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC)&ProfilingTableDecorator::m_glVertexAttribP2ui_profile;
+this->m_names[828] = "glMultiTexCoordPointerEXT";
+this->m_orig_glMultiTexCoordPointerEXT = this->m_ptr_glMultiTexCoordPointerEXT;
+if(this->m_ptr_glMultiTexCoordPointerEXT)this->m_ptr_glMultiTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glMultiTexCoordPointerEXT_profile;
+this->m_names[829] = "glProgramUniform3iEXT";
+this->m_orig_glProgramUniform3iEXT = this->m_ptr_glProgramUniform3iEXT;
+if(this->m_ptr_glProgramUniform3iEXT)this->m_ptr_glProgramUniform3iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3iEXT_profile;
+this->m_names[830] = "glTranslatef";
+this->m_orig_glTranslatef = this->m_ptr_glTranslatef;
+if(this->m_ptr_glTranslatef)this->m_ptr_glTranslatef = (FunctionTable::MEMBERPFNGLTRANSLATEFPROC)&ProfilingTableDecorator::m_glTranslatef_profile;
+this->m_names[831] = "glVertexAttrib4Nub";
+this->m_orig_glVertexAttrib4Nub = this->m_ptr_glVertexAttrib4Nub;
+if(this->m_ptr_glVertexAttrib4Nub)this->m_ptr_glVertexAttrib4Nub = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nub_profile;
+this->m_names[832] = "glTranslated";
+this->m_orig_glTranslated = this->m_ptr_glTranslated;
+if(this->m_ptr_glTranslated)this->m_ptr_glTranslated = (FunctionTable::MEMBERPFNGLTRANSLATEDPROC)&ProfilingTableDecorator::m_glTranslated_profile;
+this->m_names[833] = "glSamplerParameterIiv";
+this->m_orig_glSamplerParameterIiv = this->m_ptr_glSamplerParameterIiv;
+if(this->m_ptr_glSamplerParameterIiv)this->m_ptr_glSamplerParameterIiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC)&ProfilingTableDecorator::m_glSamplerParameterIiv_profile;
+this->m_names[834] = "glTexCoord4hNV";
+this->m_orig_glTexCoord4hNV = this->m_ptr_glTexCoord4hNV;
+if(this->m_ptr_glTexCoord4hNV)this->m_ptr_glTexCoord4hNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC)&ProfilingTableDecorator::m_glTexCoord4hNV_profile;
+this->m_names[835] = "glDrawElementsIndirect";
+this->m_orig_glDrawElementsIndirect = this->m_ptr_glDrawElementsIndirect;
+if(this->m_ptr_glDrawElementsIndirect)this->m_ptr_glDrawElementsIndirect = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC)&ProfilingTableDecorator::m_glDrawElementsIndirect_profile;
+this->m_names[836] = "glDeletePerfMonitorsAMD";
+this->m_orig_glDeletePerfMonitorsAMD = this->m_ptr_glDeletePerfMonitorsAMD;
+if(this->m_ptr_glDeletePerfMonitorsAMD)this->m_ptr_glDeletePerfMonitorsAMD = (FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC)&ProfilingTableDecorator::m_glDeletePerfMonitorsAMD_profile;
+this->m_names[837] = "glIsRenderbufferEXT";
+this->m_orig_glIsRenderbufferEXT = this->m_ptr_glIsRenderbufferEXT;
+if(this->m_ptr_glIsRenderbufferEXT)this->m_ptr_glIsRenderbufferEXT = (FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glIsRenderbufferEXT_profile;
+this->m_names[838] = "glDrawCommandsNV";
+this->m_orig_glDrawCommandsNV = this->m_ptr_glDrawCommandsNV;
+if(this->m_ptr_glDrawCommandsNV)this->m_ptr_glDrawCommandsNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsNV_profile;
+this->m_names[839] = "glUniform3ivARB";
+this->m_orig_glUniform3ivARB = this->m_ptr_glUniform3ivARB;
+if(this->m_ptr_glUniform3ivARB)this->m_ptr_glUniform3ivARB = (FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC)&ProfilingTableDecorator::m_glUniform3ivARB_profile;
+this->m_names[840] = "glBufferSubData";
+this->m_orig_glBufferSubData = this->m_ptr_glBufferSubData;
+if(this->m_ptr_glBufferSubData)this->m_ptr_glBufferSubData = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glBufferSubData_profile;
+this->m_names[841] = "glSecondaryColor3bv";
+this->m_orig_glSecondaryColor3bv = this->m_ptr_glSecondaryColor3bv;
+if(this->m_ptr_glSecondaryColor3bv)this->m_ptr_glSecondaryColor3bv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC)&ProfilingTableDecorator::m_glSecondaryColor3bv_profile;
+this->m_names[842] = "glMatrixMultTransposedEXT";
+this->m_orig_glMatrixMultTransposedEXT = this->m_ptr_glMatrixMultTransposedEXT;
+if(this->m_ptr_glMatrixMultTransposedEXT)this->m_ptr_glMatrixMultTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC)&ProfilingTableDecorator::m_glMatrixMultTransposedEXT_profile;
+this->m_names[843] = "glRequestResidentProgramsNV";
+this->m_orig_glRequestResidentProgramsNV = this->m_ptr_glRequestResidentProgramsNV;
+if(this->m_ptr_glRequestResidentProgramsNV)this->m_ptr_glRequestResidentProgramsNV = (FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC)&ProfilingTableDecorator::m_glRequestResidentProgramsNV_profile;
+this->m_names[844] = "glAlphaFragmentOp1ATI";
+this->m_orig_glAlphaFragmentOp1ATI = this->m_ptr_glAlphaFragmentOp1ATI;
+if(this->m_ptr_glAlphaFragmentOp1ATI)this->m_ptr_glAlphaFragmentOp1ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp1ATI_profile;
+this->m_names[845] = "glGetQueryObjecti64v";
+this->m_orig_glGetQueryObjecti64v = this->m_ptr_glGetQueryObjecti64v;
+if(this->m_ptr_glGetQueryObjecti64v)this->m_ptr_glGetQueryObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC)&ProfilingTableDecorator::m_glGetQueryObjecti64v_profile;
+this->m_names[846] = "glMatrixMult3x3fNV";
+this->m_orig_glMatrixMult3x3fNV = this->m_ptr_glMatrixMult3x3fNV;
+if(this->m_ptr_glMatrixMult3x3fNV)this->m_ptr_glMatrixMult3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixMult3x3fNV_profile;
+this->m_names[847] = "glColorTableParameteriv";
+this->m_orig_glColorTableParameteriv = this->m_ptr_glColorTableParameteriv;
+if(this->m_ptr_glColorTableParameteriv)this->m_ptr_glColorTableParameteriv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC)&ProfilingTableDecorator::m_glColorTableParameteriv_profile;
+this->m_names[848] = "glPathSubCommandsNV";
+this->m_orig_glPathSubCommandsNV = this->m_ptr_glPathSubCommandsNV;
+if(this->m_ptr_glPathSubCommandsNV)this->m_ptr_glPathSubCommandsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC)&ProfilingTableDecorator::m_glPathSubCommandsNV_profile;
+this->m_names[849] = "glGetFinalCombinerInputParameterivNV";
+this->m_orig_glGetFinalCombinerInputParameterivNV = this->m_ptr_glGetFinalCombinerInputParameterivNV;
+if(this->m_ptr_glGetFinalCombinerInputParameterivNV)this->m_ptr_glGetFinalCombinerInputParameterivNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetFinalCombinerInputParameterivNV_profile;
+this->m_names[850] = "glIsRenderbuffer";
+this->m_orig_glIsRenderbuffer = this->m_ptr_glIsRenderbuffer;
+if(this->m_ptr_glIsRenderbuffer)this->m_ptr_glIsRenderbuffer = (FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC)&ProfilingTableDecorator::m_glIsRenderbuffer_profile;
+this->m_names[851] = "glVertex3iv";
+this->m_orig_glVertex3iv = this->m_ptr_glVertex3iv;
+if(this->m_ptr_glVertex3iv)this->m_ptr_glVertex3iv = (FunctionTable::MEMBERPFNGLVERTEX3IVPROC)&ProfilingTableDecorator::m_glVertex3iv_profile;
+this->m_names[852] = "glTexGenfv";
+this->m_orig_glTexGenfv = this->m_ptr_glTexGenfv;
+if(this->m_ptr_glTexGenfv)this->m_ptr_glTexGenfv = (FunctionTable::MEMBERPFNGLTEXGENFVPROC)&ProfilingTableDecorator::m_glTexGenfv_profile;
+this->m_names[853] = "glFrustumfOES";
+this->m_orig_glFrustumfOES = this->m_ptr_glFrustumfOES;
+if(this->m_ptr_glFrustumfOES)this->m_ptr_glFrustumfOES = (FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC)&ProfilingTableDecorator::m_glFrustumfOES_profile;
+this->m_names[854] = "glBindVertexBuffers";
+this->m_orig_glBindVertexBuffers = this->m_ptr_glBindVertexBuffers;
+if(this->m_ptr_glBindVertexBuffers)this->m_ptr_glBindVertexBuffers = (FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC)&ProfilingTableDecorator::m_glBindVertexBuffers_profile;
+this->m_names[855] = "glMateriali";
+this->m_orig_glMateriali = this->m_ptr_glMateriali;
+if(this->m_ptr_glMateriali)this->m_ptr_glMateriali = (FunctionTable::MEMBERPFNGLMATERIALIPROC)&ProfilingTableDecorator::m_glMateriali_profile;
+this->m_names[856] = "glMultiTexCoord2svARB";
+this->m_orig_glMultiTexCoord2svARB = this->m_ptr_glMultiTexCoord2svARB;
+if(this->m_ptr_glMultiTexCoord2svARB)this->m_ptr_glMultiTexCoord2svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2svARB_profile;
+this->m_names[857] = "glDisableVertexAttribArray";
+this->m_orig_glDisableVertexAttribArray = this->m_ptr_glDisableVertexAttribArray;
+if(this->m_ptr_glDisableVertexAttribArray)this->m_ptr_glDisableVertexAttribArray = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC)&ProfilingTableDecorator::m_glDisableVertexAttribArray_profile;
+this->m_names[858] = "glWindowPos3ivARB";
+this->m_orig_glWindowPos3ivARB = this->m_ptr_glWindowPos3ivARB;
+if(this->m_ptr_glWindowPos3ivARB)this->m_ptr_glWindowPos3ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC)&ProfilingTableDecorator::m_glWindowPos3ivARB_profile;
+this->m_names[859] = "glTexCoordFormatNV";
+this->m_orig_glTexCoordFormatNV = this->m_ptr_glTexCoordFormatNV;
+if(this->m_ptr_glTexCoordFormatNV)this->m_ptr_glTexCoordFormatNV = (FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC)&ProfilingTableDecorator::m_glTexCoordFormatNV_profile;
+this->m_names[860] = "glBlitNamedFramebuffer";
+this->m_orig_glBlitNamedFramebuffer = this->m_ptr_glBlitNamedFramebuffer;
+if(this->m_ptr_glBlitNamedFramebuffer)this->m_ptr_glBlitNamedFramebuffer = (FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBlitNamedFramebuffer_profile;
+this->m_names[861] = "glMatrixLoadTransposefEXT";
+this->m_orig_glMatrixLoadTransposefEXT = this->m_ptr_glMatrixLoadTransposefEXT;
+if(this->m_ptr_glMatrixLoadTransposefEXT)this->m_ptr_glMatrixLoadTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadTransposefEXT_profile;
+this->m_names[862] = "glMultiTexGenfEXT";
+this->m_orig_glMultiTexGenfEXT = this->m_ptr_glMultiTexGenfEXT;
+if(this->m_ptr_glMultiTexGenfEXT)this->m_ptr_glMultiTexGenfEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenfEXT_profile;
+this->m_names[863] = "glShaderStorageBlockBinding";
+this->m_orig_glShaderStorageBlockBinding = this->m_ptr_glShaderStorageBlockBinding;
+if(this->m_ptr_glShaderStorageBlockBinding)this->m_ptr_glShaderStorageBlockBinding = (FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC)&ProfilingTableDecorator::m_glShaderStorageBlockBinding_profile;
+this->m_names[864] = "glMaterialf";
+this->m_orig_glMaterialf = this->m_ptr_glMaterialf;
+if(this->m_ptr_glMaterialf)this->m_ptr_glMaterialf = (FunctionTable::MEMBERPFNGLMATERIALFPROC)&ProfilingTableDecorator::m_glMaterialf_profile;
+this->m_names[865] = "glReplacementCodeuiColor4fNormal3fVertex3fSUN";
+this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profile;
+this->m_names[866] = "glCheckNamedFramebufferStatusEXT";
+this->m_orig_glCheckNamedFramebufferStatusEXT = this->m_ptr_glCheckNamedFramebufferStatusEXT;
+if(this->m_ptr_glCheckNamedFramebufferStatusEXT)this->m_ptr_glCheckNamedFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)&ProfilingTableDecorator::m_glCheckNamedFramebufferStatusEXT_profile;
+this->m_names[867] = "glVertexArrayVertexAttribFormatEXT";
+this->m_orig_glVertexArrayVertexAttribFormatEXT = this->m_ptr_glVertexArrayVertexAttribFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribFormatEXT)this->m_ptr_glVertexArrayVertexAttribFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribFormatEXT_profile;
+this->m_names[868] = "glVertex2hNV";
+this->m_orig_glVertex2hNV = this->m_ptr_glVertex2hNV;
+if(this->m_ptr_glVertex2hNV)this->m_ptr_glVertex2hNV = (FunctionTable::MEMBERPFNGLVERTEX2HNVPROC)&ProfilingTableDecorator::m_glVertex2hNV_profile;
+this->m_names[869] = "glDeleteVertexShaderEXT";
+this->m_orig_glDeleteVertexShaderEXT = this->m_ptr_glDeleteVertexShaderEXT;
+if(this->m_ptr_glDeleteVertexShaderEXT)this->m_ptr_glDeleteVertexShaderEXT = (FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glDeleteVertexShaderEXT_profile;
+this->m_names[870] = "glTexImage3DEXT";
+this->m_orig_glTexImage3DEXT = this->m_ptr_glTexImage3DEXT;
+if(this->m_ptr_glTexImage3DEXT)this->m_ptr_glTexImage3DEXT = (FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTexImage3DEXT_profile;
+this->m_names[871] = "glSignalVkFenceNV";
+this->m_orig_glSignalVkFenceNV = this->m_ptr_glSignalVkFenceNV;
+if(this->m_ptr_glSignalVkFenceNV)this->m_ptr_glSignalVkFenceNV = (FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC)&ProfilingTableDecorator::m_glSignalVkFenceNV_profile;
+this->m_names[872] = "glProgramLocalParameterI4ivNV";
+this->m_orig_glProgramLocalParameterI4ivNV = this->m_ptr_glProgramLocalParameterI4ivNV;
+if(this->m_ptr_glProgramLocalParameterI4ivNV)this->m_ptr_glProgramLocalParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4ivNV_profile;
+this->m_names[873] = "glGlobalAlphaFactoriSUN";
+this->m_orig_glGlobalAlphaFactoriSUN = this->m_ptr_glGlobalAlphaFactoriSUN;
+if(this->m_ptr_glGlobalAlphaFactoriSUN)this->m_ptr_glGlobalAlphaFactoriSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactoriSUN_profile;
+this->m_names[874] = "glTextureStorage1D";
+this->m_orig_glTextureStorage1D = this->m_ptr_glTextureStorage1D;
+if(this->m_ptr_glTextureStorage1D)this->m_ptr_glTextureStorage1D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC)&ProfilingTableDecorator::m_glTextureStorage1D_profile;
+this->m_names[875] = "glBinormal3sEXT";
+this->m_orig_glBinormal3sEXT = this->m_ptr_glBinormal3sEXT;
+if(this->m_ptr_glBinormal3sEXT)this->m_ptr_glBinormal3sEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC)&ProfilingTableDecorator::m_glBinormal3sEXT_profile;
+this->m_names[876] = "glGetProgramInterfaceiv";
+this->m_orig_glGetProgramInterfaceiv = this->m_ptr_glGetProgramInterfaceiv;
+if(this->m_ptr_glGetProgramInterfaceiv)this->m_ptr_glGetProgramInterfaceiv = (FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC)&ProfilingTableDecorator::m_glGetProgramInterfaceiv_profile;
+this->m_names[877] = "glMatrixIndexPointerARB";
+this->m_orig_glMatrixIndexPointerARB = this->m_ptr_glMatrixIndexPointerARB;
+if(this->m_ptr_glMatrixIndexPointerARB)this->m_ptr_glMatrixIndexPointerARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC)&ProfilingTableDecorator::m_glMatrixIndexPointerARB_profile;
+this->m_names[878] = "glTexCoordPointerEXT";
+this->m_orig_glTexCoordPointerEXT = this->m_ptr_glTexCoordPointerEXT;
+if(this->m_ptr_glTexCoordPointerEXT)this->m_ptr_glTexCoordPointerEXT = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glTexCoordPointerEXT_profile;
+this->m_names[879] = "glMultiTexGeniEXT";
+this->m_orig_glMultiTexGeniEXT = this->m_ptr_glMultiTexGeniEXT;
+if(this->m_ptr_glMultiTexGeniEXT)this->m_ptr_glMultiTexGeniEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC)&ProfilingTableDecorator::m_glMultiTexGeniEXT_profile;
+this->m_names[880] = "glVertexAttrib2fNV";
+this->m_orig_glVertexAttrib2fNV = this->m_ptr_glVertexAttrib2fNV;
+if(this->m_ptr_glVertexAttrib2fNV)this->m_ptr_glVertexAttrib2fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fNV_profile;
+this->m_names[881] = "glNamedProgramStringEXT";
+this->m_orig_glNamedProgramStringEXT = this->m_ptr_glNamedProgramStringEXT;
+if(this->m_ptr_glNamedProgramStringEXT)this->m_ptr_glNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC)&ProfilingTableDecorator::m_glNamedProgramStringEXT_profile;
+this->m_names[882] = "glMapNamedBuffer";
+this->m_orig_glMapNamedBuffer = this->m_ptr_glMapNamedBuffer;
+if(this->m_ptr_glMapNamedBuffer)this->m_ptr_glMapNamedBuffer = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC)&ProfilingTableDecorator::m_glMapNamedBuffer_profile;
+this->m_names[883] = "glGetMinmaxParameteriv";
+this->m_orig_glGetMinmaxParameteriv = this->m_ptr_glGetMinmaxParameteriv;
+if(this->m_ptr_glGetMinmaxParameteriv)this->m_ptr_glGetMinmaxParameteriv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetMinmaxParameteriv_profile;
+this->m_names[884] = "glGetnUniformdv";
+this->m_orig_glGetnUniformdv = this->m_ptr_glGetnUniformdv;
+if(this->m_ptr_glGetnUniformdv)this->m_ptr_glGetnUniformdv = (FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC)&ProfilingTableDecorator::m_glGetnUniformdv_profile;
+this->m_names[885] = "glEndConditionalRenderNVX";
+this->m_orig_glEndConditionalRenderNVX = this->m_ptr_glEndConditionalRenderNVX;
+if(this->m_ptr_glEndConditionalRenderNVX)this->m_ptr_glEndConditionalRenderNVX = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC)&ProfilingTableDecorator::m_glEndConditionalRenderNVX_profile;
+this->m_names[886] = "glBinormal3fEXT";
+this->m_orig_glBinormal3fEXT = this->m_ptr_glBinormal3fEXT;
+if(this->m_ptr_glBinormal3fEXT)this->m_ptr_glBinormal3fEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC)&ProfilingTableDecorator::m_glBinormal3fEXT_profile;
+this->m_names[887] = "glNormalStream3iATI";
+this->m_orig_glNormalStream3iATI = this->m_ptr_glNormalStream3iATI;
+if(this->m_ptr_glNormalStream3iATI)this->m_ptr_glNormalStream3iATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC)&ProfilingTableDecorator::m_glNormalStream3iATI_profile;
+this->m_names[888] = "glProgramBufferParametersIivNV";
+this->m_orig_glProgramBufferParametersIivNV = this->m_ptr_glProgramBufferParametersIivNV;
+if(this->m_ptr_glProgramBufferParametersIivNV)this->m_ptr_glProgramBufferParametersIivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersIivNV_profile;
+this->m_names[889] = "glMapGrid1xOES";
+this->m_orig_glMapGrid1xOES = this->m_ptr_glMapGrid1xOES;
+if(this->m_ptr_glMapGrid1xOES)this->m_ptr_glMapGrid1xOES = (FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC)&ProfilingTableDecorator::m_glMapGrid1xOES_profile;
+this->m_names[890] = "glGetVertexAttribPointervARB";
+this->m_orig_glGetVertexAttribPointervARB = this->m_ptr_glGetVertexAttribPointervARB;
+if(this->m_ptr_glGetVertexAttribPointervARB)this->m_ptr_glGetVertexAttribPointervARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointervARB_profile;
+this->m_names[891] = "glFlushMappedNamedBufferRangeEXT";
+this->m_orig_glFlushMappedNamedBufferRangeEXT = this->m_ptr_glFlushMappedNamedBufferRangeEXT;
+if(this->m_ptr_glFlushMappedNamedBufferRangeEXT)this->m_ptr_glFlushMappedNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glFlushMappedNamedBufferRangeEXT_profile;
+this->m_names[892] = "glGetVertexAttribIiv";
+this->m_orig_glGetVertexAttribIiv = this->m_ptr_glGetVertexAttribIiv;
+if(this->m_ptr_glGetVertexAttribIiv)this->m_ptr_glGetVertexAttribIiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribIiv_profile;
+this->m_names[893] = "glVertexP4uiv";
+this->m_orig_glVertexP4uiv = this->m_ptr_glVertexP4uiv;
+if(this->m_ptr_glVertexP4uiv)this->m_ptr_glVertexP4uiv = (FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC)&ProfilingTableDecorator::m_glVertexP4uiv_profile;
+this->m_names[894] = "glUniformui64NV";
+this->m_orig_glUniformui64NV = this->m_ptr_glUniformui64NV;
+if(this->m_ptr_glUniformui64NV)this->m_ptr_glUniformui64NV = (FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC)&ProfilingTableDecorator::m_glUniformui64NV_profile;
+this->m_names[895] = "glColor4fv";
+this->m_orig_glColor4fv = this->m_ptr_glColor4fv;
+if(this->m_ptr_glColor4fv)this->m_ptr_glColor4fv = (FunctionTable::MEMBERPFNGLCOLOR4FVPROC)&ProfilingTableDecorator::m_glColor4fv_profile;
+this->m_names[896] = "glTexParameterxvOES";
+this->m_orig_glTexParameterxvOES = this->m_ptr_glTexParameterxvOES;
+if(this->m_ptr_glTexParameterxvOES)this->m_ptr_glTexParameterxvOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glTexParameterxvOES_profile;
+this->m_names[897] = "glPatchParameteri";
+this->m_orig_glPatchParameteri = this->m_ptr_glPatchParameteri;
+if(this->m_ptr_glPatchParameteri)this->m_ptr_glPatchParameteri = (FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC)&ProfilingTableDecorator::m_glPatchParameteri_profile;
+this->m_names[898] = "glMap1d";
+this->m_orig_glMap1d = this->m_ptr_glMap1d;
+if(this->m_ptr_glMap1d)this->m_ptr_glMap1d = (FunctionTable::MEMBERPFNGLMAP1DPROC)&ProfilingTableDecorator::m_glMap1d_profile;
+this->m_names[899] = "glGetTexFilterFuncSGIS";
+this->m_orig_glGetTexFilterFuncSGIS = this->m_ptr_glGetTexFilterFuncSGIS;
+if(this->m_ptr_glGetTexFilterFuncSGIS)this->m_ptr_glGetTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC)&ProfilingTableDecorator::m_glGetTexFilterFuncSGIS_profile;
+this->m_names[900] = "glVertexStream3dATI";
+this->m_orig_glVertexStream3dATI = this->m_ptr_glVertexStream3dATI;
+if(this->m_ptr_glVertexStream3dATI)this->m_ptr_glVertexStream3dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC)&ProfilingTableDecorator::m_glVertexStream3dATI_profile;
+this->m_names[901] = "glVertexArrayVertexBindingDivisorEXT";
+this->m_orig_glVertexArrayVertexBindingDivisorEXT = this->m_ptr_glVertexArrayVertexBindingDivisorEXT;
+if(this->m_ptr_glVertexArrayVertexBindingDivisorEXT)this->m_ptr_glVertexArrayVertexBindingDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBindingDivisorEXT_profile;
+this->m_names[902] = "glMultiTexCoord3svARB";
+this->m_orig_glMultiTexCoord3svARB = this->m_ptr_glMultiTexCoord3svARB;
+if(this->m_ptr_glMultiTexCoord3svARB)this->m_ptr_glMultiTexCoord3svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3svARB_profile;
+this->m_names[903] = "glBindProgramNV";
+this->m_orig_glBindProgramNV = this->m_ptr_glBindProgramNV;
+if(this->m_ptr_glBindProgramNV)this->m_ptr_glBindProgramNV = (FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC)&ProfilingTableDecorator::m_glBindProgramNV_profile;
+this->m_names[904] = "glGetConvolutionParameteriv";
+this->m_orig_glGetConvolutionParameteriv = this->m_ptr_glGetConvolutionParameteriv;
+if(this->m_ptr_glGetConvolutionParameteriv)this->m_ptr_glGetConvolutionParameteriv = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetConvolutionParameteriv_profile;
+this->m_names[905] = "glGetProgramLocalParameterfvARB";
+this->m_orig_glGetProgramLocalParameterfvARB = this->m_ptr_glGetProgramLocalParameterfvARB;
+if(this->m_ptr_glGetProgramLocalParameterfvARB)this->m_ptr_glGetProgramLocalParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterfvARB_profile;
+this->m_names[906] = "glGenFragmentShadersATI";
+this->m_orig_glGenFragmentShadersATI = this->m_ptr_glGenFragmentShadersATI;
+if(this->m_ptr_glGenFragmentShadersATI)this->m_ptr_glGenFragmentShadersATI = (FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC)&ProfilingTableDecorator::m_glGenFragmentShadersATI_profile;
+this->m_names[907] = "glTexBumpParameterivATI";
+this->m_orig_glTexBumpParameterivATI = this->m_ptr_glTexBumpParameterivATI;
+if(this->m_ptr_glTexBumpParameterivATI)this->m_ptr_glTexBumpParameterivATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC)&ProfilingTableDecorator::m_glTexBumpParameterivATI_profile;
+this->m_names[908] = "glGetNamedFramebufferAttachmentParameteriv";
+this->m_orig_glGetNamedFramebufferAttachmentParameteriv = this->m_ptr_glGetNamedFramebufferAttachmentParameteriv;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameteriv)this->m_ptr_glGetNamedFramebufferAttachmentParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferAttachmentParameteriv_profile;
+this->m_names[909] = "glGetnSeparableFilter";
+this->m_orig_glGetnSeparableFilter = this->m_ptr_glGetnSeparableFilter;
+if(this->m_ptr_glGetnSeparableFilter)this->m_ptr_glGetnSeparableFilter = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC)&ProfilingTableDecorator::m_glGetnSeparableFilter_profile;
+this->m_names[910] = "glNormal3xvOES";
+this->m_orig_glNormal3xvOES = this->m_ptr_glNormal3xvOES;
+if(this->m_ptr_glNormal3xvOES)this->m_ptr_glNormal3xvOES = (FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC)&ProfilingTableDecorator::m_glNormal3xvOES_profile;
+this->m_names[911] = "glPassTexCoordATI";
+this->m_orig_glPassTexCoordATI = this->m_ptr_glPassTexCoordATI;
+if(this->m_ptr_glPassTexCoordATI)this->m_ptr_glPassTexCoordATI = (FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC)&ProfilingTableDecorator::m_glPassTexCoordATI_profile;
+this->m_names[912] = "glFramebufferTextureFaceARB";
+this->m_orig_glFramebufferTextureFaceARB = this->m_ptr_glFramebufferTextureFaceARB;
+if(this->m_ptr_glFramebufferTextureFaceARB)this->m_ptr_glFramebufferTextureFaceARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureFaceARB_profile;
+this->m_names[913] = "glProgramUniform1dv";
+this->m_orig_glProgramUniform1dv = this->m_ptr_glProgramUniform1dv;
+if(this->m_ptr_glProgramUniform1dv)this->m_ptr_glProgramUniform1dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC)&ProfilingTableDecorator::m_glProgramUniform1dv_profile;
+this->m_names[914] = "glTextureStorage2DEXT";
+this->m_orig_glTextureStorage2DEXT = this->m_ptr_glTextureStorage2DEXT;
+if(this->m_ptr_glTextureStorage2DEXT)this->m_ptr_glTextureStorage2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage2DEXT_profile;
+this->m_names[915] = "glVertexArrayFogCoordOffsetEXT";
+this->m_orig_glVertexArrayFogCoordOffsetEXT = this->m_ptr_glVertexArrayFogCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayFogCoordOffsetEXT)this->m_ptr_glVertexArrayFogCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayFogCoordOffsetEXT_profile;
+this->m_names[916] = "glDeleteNamedStringARB";
+this->m_orig_glDeleteNamedStringARB = this->m_ptr_glDeleteNamedStringARB;
+if(this->m_ptr_glDeleteNamedStringARB)this->m_ptr_glDeleteNamedStringARB = (FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glDeleteNamedStringARB_profile;
+this->m_names[917] = "glMulticastGetQueryObjecti64vNV";
+this->m_orig_glMulticastGetQueryObjecti64vNV = this->m_ptr_glMulticastGetQueryObjecti64vNV;
+if(this->m_ptr_glMulticastGetQueryObjecti64vNV)this->m_ptr_glMulticastGetQueryObjecti64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC)&ProfilingTableDecorator::m_glMulticastGetQueryObjecti64vNV_profile;
+this->m_names[918] = "glGenOcclusionQueriesNV";
+this->m_orig_glGenOcclusionQueriesNV = this->m_ptr_glGenOcclusionQueriesNV;
+if(this->m_ptr_glGenOcclusionQueriesNV)this->m_ptr_glGenOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC)&ProfilingTableDecorator::m_glGenOcclusionQueriesNV_profile;
+this->m_names[919] = "glLighti";
+this->m_orig_glLighti = this->m_ptr_glLighti;
+if(this->m_ptr_glLighti)this->m_ptr_glLighti = (FunctionTable::MEMBERPFNGLLIGHTIPROC)&ProfilingTableDecorator::m_glLighti_profile;
+this->m_names[920] = "glTexImage1D";
+this->m_orig_glTexImage1D = this->m_ptr_glTexImage1D;
+if(this->m_ptr_glTexImage1D)this->m_ptr_glTexImage1D = (FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glTexImage1D_profile;
+this->m_names[921] = "glLightf";
+this->m_orig_glLightf = this->m_ptr_glLightf;
+if(this->m_ptr_glLightf)this->m_ptr_glLightf = (FunctionTable::MEMBERPFNGLLIGHTFPROC)&ProfilingTableDecorator::m_glLightf_profile;
+this->m_names[922] = "glClientAttribDefaultEXT";
+this->m_orig_glClientAttribDefaultEXT = this->m_ptr_glClientAttribDefaultEXT;
+if(this->m_ptr_glClientAttribDefaultEXT)this->m_ptr_glClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC)&ProfilingTableDecorator::m_glClientAttribDefaultEXT_profile;
+this->m_names[923] = "glVertexAttrib4bvARB";
+this->m_orig_glVertexAttrib4bvARB = this->m_ptr_glVertexAttrib4bvARB;
+if(this->m_ptr_glVertexAttrib4bvARB)this->m_ptr_glVertexAttrib4bvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4bvARB_profile;
+this->m_names[924] = "glVertexAttribIFormatNV";
+this->m_orig_glVertexAttribIFormatNV = this->m_ptr_glVertexAttribIFormatNV;
+if(this->m_ptr_glVertexAttribIFormatNV)this->m_ptr_glVertexAttribIFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribIFormatNV_profile;
+this->m_names[925] = "glStencilFuncSeparate";
+this->m_orig_glStencilFuncSeparate = this->m_ptr_glStencilFuncSeparate;
+if(this->m_ptr_glStencilFuncSeparate)this->m_ptr_glStencilFuncSeparate = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC)&ProfilingTableDecorator::m_glStencilFuncSeparate_profile;
+this->m_names[926] = "glGetVertexAttribfvARB";
+this->m_orig_glGetVertexAttribfvARB = this->m_ptr_glGetVertexAttribfvARB;
+if(this->m_ptr_glGetVertexAttribfvARB)this->m_ptr_glGetVertexAttribfvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribfvARB_profile;
+this->m_names[927] = "glVertexAttrib2dNV";
+this->m_orig_glVertexAttrib2dNV = this->m_ptr_glVertexAttrib2dNV;
+if(this->m_ptr_glVertexAttrib2dNV)this->m_ptr_glVertexAttrib2dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dNV_profile;
+this->m_names[928] = "glProgramUniform2iEXT";
+this->m_orig_glProgramUniform2iEXT = this->m_ptr_glProgramUniform2iEXT;
+if(this->m_ptr_glProgramUniform2iEXT)this->m_ptr_glProgramUniform2iEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2iEXT_profile;
+this->m_names[929] = "glClientActiveVertexStreamATI";
+this->m_orig_glClientActiveVertexStreamATI = this->m_ptr_glClientActiveVertexStreamATI;
+if(this->m_ptr_glClientActiveVertexStreamATI)this->m_ptr_glClientActiveVertexStreamATI = (FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)&ProfilingTableDecorator::m_glClientActiveVertexStreamATI_profile;
+this->m_names[930] = "glRasterPos3xOES";
+this->m_orig_glRasterPos3xOES = this->m_ptr_glRasterPos3xOES;
+if(this->m_ptr_glRasterPos3xOES)this->m_ptr_glRasterPos3xOES = (FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC)&ProfilingTableDecorator::m_glRasterPos3xOES_profile;
+this->m_names[931] = "glGetMapParameterivNV";
+this->m_orig_glGetMapParameterivNV = this->m_ptr_glGetMapParameterivNV;
+if(this->m_ptr_glGetMapParameterivNV)this->m_ptr_glGetMapParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetMapParameterivNV_profile;
+this->m_names[932] = "glSampleCoverage";
+this->m_orig_glSampleCoverage = this->m_ptr_glSampleCoverage;
+if(this->m_ptr_glSampleCoverage)this->m_ptr_glSampleCoverage = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC)&ProfilingTableDecorator::m_glSampleCoverage_profile;
+this->m_names[933] = "glClearDepthxOES";
+this->m_orig_glClearDepthxOES = this->m_ptr_glClearDepthxOES;
+if(this->m_ptr_glClearDepthxOES)this->m_ptr_glClearDepthxOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC)&ProfilingTableDecorator::m_glClearDepthxOES_profile;
+this->m_names[934] = "glUniformBufferEXT";
+this->m_orig_glUniformBufferEXT = this->m_ptr_glUniformBufferEXT;
+if(this->m_ptr_glUniformBufferEXT)this->m_ptr_glUniformBufferEXT = (FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC)&ProfilingTableDecorator::m_glUniformBufferEXT_profile;
+this->m_names[935] = "glTexCoord2fNormal3fVertex3fvSUN";
+this->m_orig_glTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fNormal3fVertex3fvSUN_profile;
+this->m_names[936] = "glMulticastGetQueryObjectuivNV";
+this->m_orig_glMulticastGetQueryObjectuivNV = this->m_ptr_glMulticastGetQueryObjectuivNV;
+if(this->m_ptr_glMulticastGetQueryObjectuivNV)this->m_ptr_glMulticastGetQueryObjectuivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC)&ProfilingTableDecorator::m_glMulticastGetQueryObjectuivNV_profile;
+this->m_names[937] = "glGetFirstPerfQueryIdINTEL";
+this->m_orig_glGetFirstPerfQueryIdINTEL = this->m_ptr_glGetFirstPerfQueryIdINTEL;
+if(this->m_ptr_glGetFirstPerfQueryIdINTEL)this->m_ptr_glGetFirstPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC)&ProfilingTableDecorator::m_glGetFirstPerfQueryIdINTEL_profile;
+this->m_names[938] = "glUnmapNamedBufferEXT";
+this->m_orig_glUnmapNamedBufferEXT = this->m_ptr_glUnmapNamedBufferEXT;
+if(this->m_ptr_glUnmapNamedBufferEXT)this->m_ptr_glUnmapNamedBufferEXT = (FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC)&ProfilingTableDecorator::m_glUnmapNamedBufferEXT_profile;
+this->m_names[939] = "glGetTransformFeedbacki_v";
+this->m_orig_glGetTransformFeedbacki_v = this->m_ptr_glGetTransformFeedbacki_v;
+if(this->m_ptr_glGetTransformFeedbacki_v)this->m_ptr_glGetTransformFeedbacki_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC)&ProfilingTableDecorator::m_glGetTransformFeedbacki_v_profile;
+this->m_names[940] = "glUniform4fvARB";
+this->m_orig_glUniform4fvARB = this->m_ptr_glUniform4fvARB;
+if(this->m_ptr_glUniform4fvARB)this->m_ptr_glUniform4fvARB = (FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC)&ProfilingTableDecorator::m_glUniform4fvARB_profile;
+this->m_names[941] = "glRenderbufferStorageMultisampleCoverageNV";
+this->m_orig_glRenderbufferStorageMultisampleCoverageNV = this->m_ptr_glRenderbufferStorageMultisampleCoverageNV;
+if(this->m_ptr_glRenderbufferStorageMultisampleCoverageNV)this->m_ptr_glRenderbufferStorageMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisampleCoverageNV_profile;
+this->m_names[942] = "glGetFloati_vEXT";
+this->m_orig_glGetFloati_vEXT = this->m_ptr_glGetFloati_vEXT;
+if(this->m_ptr_glGetFloati_vEXT)this->m_ptr_glGetFloati_vEXT = (FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC)&ProfilingTableDecorator::m_glGetFloati_vEXT_profile;
+this->m_names[943] = "glBindAttribLocationARB";
+this->m_orig_glBindAttribLocationARB = this->m_ptr_glBindAttribLocationARB;
+if(this->m_ptr_glBindAttribLocationARB)this->m_ptr_glBindAttribLocationARB = (FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC)&ProfilingTableDecorator::m_glBindAttribLocationARB_profile;
+this->m_names[944] = "glBufferAddressRangeNV";
+this->m_orig_glBufferAddressRangeNV = this->m_ptr_glBufferAddressRangeNV;
+if(this->m_ptr_glBufferAddressRangeNV)this->m_ptr_glBufferAddressRangeNV = (FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC)&ProfilingTableDecorator::m_glBufferAddressRangeNV_profile;
+this->m_names[945] = "glGenProgramsARB";
+this->m_orig_glGenProgramsARB = this->m_ptr_glGenProgramsARB;
+if(this->m_ptr_glGenProgramsARB)this->m_ptr_glGenProgramsARB = (FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC)&ProfilingTableDecorator::m_glGenProgramsARB_profile;
+this->m_names[946] = "glMultiTexEnvivEXT";
+this->m_orig_glMultiTexEnvivEXT = this->m_ptr_glMultiTexEnvivEXT;
+if(this->m_ptr_glMultiTexEnvivEXT)this->m_ptr_glMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvivEXT_profile;
+this->m_names[947] = "glSecondaryColor3uiEXT";
+this->m_orig_glSecondaryColor3uiEXT = this->m_ptr_glSecondaryColor3uiEXT;
+if(this->m_ptr_glSecondaryColor3uiEXT)this->m_ptr_glSecondaryColor3uiEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3uiEXT_profile;
+this->m_names[948] = "glCompressedTextureImage2DEXT";
+this->m_orig_glCompressedTextureImage2DEXT = this->m_ptr_glCompressedTextureImage2DEXT;
+if(this->m_ptr_glCompressedTextureImage2DEXT)this->m_ptr_glCompressedTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage2DEXT_profile;
+this->m_names[949] = "glUniform2i";
+this->m_orig_glUniform2i = this->m_ptr_glUniform2i;
+if(this->m_ptr_glUniform2i)this->m_ptr_glUniform2i = (FunctionTable::MEMBERPFNGLUNIFORM2IPROC)&ProfilingTableDecorator::m_glUniform2i_profile;
+this->m_names[950] = "glCopyTexImage2DEXT";
+this->m_orig_glCopyTexImage2DEXT = this->m_ptr_glCopyTexImage2DEXT;
+if(this->m_ptr_glCopyTexImage2DEXT)this->m_ptr_glCopyTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTexImage2DEXT_profile;
+this->m_names[951] = "glUniform2d";
+this->m_orig_glUniform2d = this->m_ptr_glUniform2d;
+if(this->m_ptr_glUniform2d)this->m_ptr_glUniform2d = (FunctionTable::MEMBERPFNGLUNIFORM2DPROC)&ProfilingTableDecorator::m_glUniform2d_profile;
+this->m_names[952] = "glVertexAttribL1d";
+this->m_orig_glVertexAttribL1d = this->m_ptr_glVertexAttribL1d;
+if(this->m_ptr_glVertexAttribL1d)this->m_ptr_glVertexAttribL1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC)&ProfilingTableDecorator::m_glVertexAttribL1d_profile;
+this->m_names[953] = "glFramebufferTextureFaceEXT";
+this->m_orig_glFramebufferTextureFaceEXT = this->m_ptr_glFramebufferTextureFaceEXT;
+if(this->m_ptr_glFramebufferTextureFaceEXT)this->m_ptr_glFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureFaceEXT_profile;
+this->m_names[954] = "glFramebufferTextureLayer";
+this->m_orig_glFramebufferTextureLayer = this->m_ptr_glFramebufferTextureLayer;
+if(this->m_ptr_glFramebufferTextureLayer)this->m_ptr_glFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC)&ProfilingTableDecorator::m_glFramebufferTextureLayer_profile;
+this->m_names[955] = "glMultiTexCoord4bvOES";
+this->m_orig_glMultiTexCoord4bvOES = this->m_ptr_glMultiTexCoord4bvOES;
+if(this->m_ptr_glMultiTexCoord4bvOES)this->m_ptr_glMultiTexCoord4bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4bvOES_profile;
+this->m_names[956] = "glGetVertexArrayPointeri_vEXT";
+this->m_orig_glGetVertexArrayPointeri_vEXT = this->m_ptr_glGetVertexArrayPointeri_vEXT;
+if(this->m_ptr_glGetVertexArrayPointeri_vEXT)this->m_ptr_glGetVertexArrayPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayPointeri_vEXT_profile;
+this->m_names[957] = "glNamedProgramLocalParameter4dEXT";
+this->m_orig_glNamedProgramLocalParameter4dEXT = this->m_ptr_glNamedProgramLocalParameter4dEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4dEXT)this->m_ptr_glNamedProgramLocalParameter4dEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4dEXT_profile;
+this->m_names[958] = "glBinormal3bEXT";
+this->m_orig_glBinormal3bEXT = this->m_ptr_glBinormal3bEXT;
+if(this->m_ptr_glBinormal3bEXT)this->m_ptr_glBinormal3bEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC)&ProfilingTableDecorator::m_glBinormal3bEXT_profile;
+this->m_names[959] = "glConvolutionFilter2DEXT";
+this->m_orig_glConvolutionFilter2DEXT = this->m_ptr_glConvolutionFilter2DEXT;
+if(this->m_ptr_glConvolutionFilter2DEXT)this->m_ptr_glConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC)&ProfilingTableDecorator::m_glConvolutionFilter2DEXT_profile;
+this->m_names[960] = "glProgramUniform2fv";
+this->m_orig_glProgramUniform2fv = this->m_ptr_glProgramUniform2fv;
+if(this->m_ptr_glProgramUniform2fv)this->m_ptr_glProgramUniform2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC)&ProfilingTableDecorator::m_glProgramUniform2fv_profile;
+this->m_names[961] = "glColor3fVertex3fSUN";
+this->m_orig_glColor3fVertex3fSUN = this->m_ptr_glColor3fVertex3fSUN;
+if(this->m_ptr_glColor3fVertex3fSUN)this->m_ptr_glColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor3fVertex3fSUN_profile;
+this->m_names[962] = "glNormal3fVertex3fvSUN";
+this->m_orig_glNormal3fVertex3fvSUN = this->m_ptr_glNormal3fVertex3fvSUN;
+if(this->m_ptr_glNormal3fVertex3fvSUN)this->m_ptr_glNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glNormal3fVertex3fvSUN_profile;
+this->m_names[963] = "glCopyMultiTexSubImage3DEXT";
+this->m_orig_glCopyMultiTexSubImage3DEXT = this->m_ptr_glCopyMultiTexSubImage3DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage3DEXT)this->m_ptr_glCopyMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage3DEXT_profile;
+this->m_names[964] = "glProgramLocalParameterI4iNV";
+this->m_orig_glProgramLocalParameterI4iNV = this->m_ptr_glProgramLocalParameterI4iNV;
+if(this->m_ptr_glProgramLocalParameterI4iNV)this->m_ptr_glProgramLocalParameterI4iNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4iNV_profile;
+this->m_names[965] = "glProgramUniformMatrix2x4dv";
+this->m_orig_glProgramUniformMatrix2x4dv = this->m_ptr_glProgramUniformMatrix2x4dv;
+if(this->m_ptr_glProgramUniformMatrix2x4dv)this->m_ptr_glProgramUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4dv_profile;
+this->m_names[966] = "glPathMemoryGlyphIndexArrayNV";
+this->m_orig_glPathMemoryGlyphIndexArrayNV = this->m_ptr_glPathMemoryGlyphIndexArrayNV;
+if(this->m_ptr_glPathMemoryGlyphIndexArrayNV)this->m_ptr_glPathMemoryGlyphIndexArrayNV = (FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)&ProfilingTableDecorator::m_glPathMemoryGlyphIndexArrayNV_profile;
+this->m_names[967] = "glDrawArraysEXT";
+this->m_orig_glDrawArraysEXT = this->m_ptr_glDrawArraysEXT;
+if(this->m_ptr_glDrawArraysEXT)this->m_ptr_glDrawArraysEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC)&ProfilingTableDecorator::m_glDrawArraysEXT_profile;
+this->m_names[968] = "glBlendEquationEXT";
+this->m_orig_glBlendEquationEXT = this->m_ptr_glBlendEquationEXT;
+if(this->m_ptr_glBlendEquationEXT)this->m_ptr_glBlendEquationEXT = (FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC)&ProfilingTableDecorator::m_glBlendEquationEXT_profile;
+this->m_names[969] = "glStencilOp";
+this->m_orig_glStencilOp = this->m_ptr_glStencilOp;
+if(this->m_ptr_glStencilOp)this->m_ptr_glStencilOp = (FunctionTable::MEMBERPFNGLSTENCILOPPROC)&ProfilingTableDecorator::m_glStencilOp_profile;
+this->m_names[970] = "glCopyTextureSubImage2DEXT";
+this->m_orig_glCopyTextureSubImage2DEXT = this->m_ptr_glCopyTextureSubImage2DEXT;
+if(this->m_ptr_glCopyTextureSubImage2DEXT)this->m_ptr_glCopyTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage2DEXT_profile;
+this->m_names[971] = "glTexEnvf";
+this->m_orig_glTexEnvf = this->m_ptr_glTexEnvf;
+if(this->m_ptr_glTexEnvf)this->m_ptr_glTexEnvf = (FunctionTable::MEMBERPFNGLTEXENVFPROC)&ProfilingTableDecorator::m_glTexEnvf_profile;
+this->m_names[972] = "glVertexAttrib2dvNV";
+this->m_orig_glVertexAttrib2dvNV = this->m_ptr_glVertexAttrib2dvNV;
+if(this->m_ptr_glVertexAttrib2dvNV)this->m_ptr_glVertexAttrib2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dvNV_profile;
+this->m_names[973] = "glGenPerfMonitorsAMD";
+this->m_orig_glGenPerfMonitorsAMD = this->m_ptr_glGenPerfMonitorsAMD;
+if(this->m_ptr_glGenPerfMonitorsAMD)this->m_ptr_glGenPerfMonitorsAMD = (FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC)&ProfilingTableDecorator::m_glGenPerfMonitorsAMD_profile;
+this->m_names[974] = "glGetInteger64i_v";
+this->m_orig_glGetInteger64i_v = this->m_ptr_glGetInteger64i_v;
+if(this->m_ptr_glGetInteger64i_v)this->m_ptr_glGetInteger64i_v = (FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC)&ProfilingTableDecorator::m_glGetInteger64i_v_profile;
+this->m_names[975] = "glGetHistogramParameterfv";
+this->m_orig_glGetHistogramParameterfv = this->m_ptr_glGetHistogramParameterfv;
+if(this->m_ptr_glGetHistogramParameterfv)this->m_ptr_glGetHistogramParameterfv = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetHistogramParameterfv_profile;
+this->m_names[976] = "glVertexFormatNV";
+this->m_orig_glVertexFormatNV = this->m_ptr_glVertexFormatNV;
+if(this->m_ptr_glVertexFormatNV)this->m_ptr_glVertexFormatNV = (FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC)&ProfilingTableDecorator::m_glVertexFormatNV_profile;
+this->m_names[977] = "glBlendFuncIndexedAMD";
+this->m_orig_glBlendFuncIndexedAMD = this->m_ptr_glBlendFuncIndexedAMD;
+if(this->m_ptr_glBlendFuncIndexedAMD)this->m_ptr_glBlendFuncIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendFuncIndexedAMD_profile;
+this->m_names[978] = "glTexEnvi";
+this->m_orig_glTexEnvi = this->m_ptr_glTexEnvi;
+if(this->m_ptr_glTexEnvi)this->m_ptr_glTexEnvi = (FunctionTable::MEMBERPFNGLTEXENVIPROC)&ProfilingTableDecorator::m_glTexEnvi_profile;
+this->m_names[979] = "glMultiTexCoord1iv";
+this->m_orig_glMultiTexCoord1iv = this->m_ptr_glMultiTexCoord1iv;
+if(this->m_ptr_glMultiTexCoord1iv)this->m_ptr_glMultiTexCoord1iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1iv_profile;
+this->m_names[980] = "glIsEnabledi";
+this->m_orig_glIsEnabledi = this->m_ptr_glIsEnabledi;
+if(this->m_ptr_glIsEnabledi)this->m_ptr_glIsEnabledi = (FunctionTable::MEMBERPFNGLISENABLEDIPROC)&ProfilingTableDecorator::m_glIsEnabledi_profile;
+this->m_names[981] = "glVertexAttribL2ui64vNV";
+this->m_orig_glVertexAttribL2ui64vNV = this->m_ptr_glVertexAttribL2ui64vNV;
+if(this->m_ptr_glVertexAttribL2ui64vNV)this->m_ptr_glVertexAttribL2ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL2ui64vNV_profile;
+this->m_names[982] = "glVertexAttribL4i64NV";
+this->m_orig_glVertexAttribL4i64NV = this->m_ptr_glVertexAttribL4i64NV;
+if(this->m_ptr_glVertexAttribL4i64NV)this->m_ptr_glVertexAttribL4i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL4i64NV_profile;
+this->m_names[983] = "glMatrixTranslatedEXT";
+this->m_orig_glMatrixTranslatedEXT = this->m_ptr_glMatrixTranslatedEXT;
+if(this->m_ptr_glMatrixTranslatedEXT)this->m_ptr_glMatrixTranslatedEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC)&ProfilingTableDecorator::m_glMatrixTranslatedEXT_profile;
+this->m_names[984] = "glMakeTextureHandleResidentARB";
+this->m_orig_glMakeTextureHandleResidentARB = this->m_ptr_glMakeTextureHandleResidentARB;
+if(this->m_ptr_glMakeTextureHandleResidentARB)this->m_ptr_glMakeTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeTextureHandleResidentARB_profile;
+this->m_names[985] = "glMatrixMultdEXT";
+this->m_orig_glMatrixMultdEXT = this->m_ptr_glMatrixMultdEXT;
+if(this->m_ptr_glMatrixMultdEXT)this->m_ptr_glMatrixMultdEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC)&ProfilingTableDecorator::m_glMatrixMultdEXT_profile;
+this->m_names[986] = "glBinormal3dvEXT";
+this->m_orig_glBinormal3dvEXT = this->m_ptr_glBinormal3dvEXT;
+if(this->m_ptr_glBinormal3dvEXT)this->m_ptr_glBinormal3dvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC)&ProfilingTableDecorator::m_glBinormal3dvEXT_profile;
+this->m_names[987] = "glImportSyncEXT";
+this->m_orig_glImportSyncEXT = this->m_ptr_glImportSyncEXT;
+if(this->m_ptr_glImportSyncEXT)this->m_ptr_glImportSyncEXT = (FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC)&ProfilingTableDecorator::m_glImportSyncEXT_profile;
+this->m_names[988] = "glGetMapiv";
+this->m_orig_glGetMapiv = this->m_ptr_glGetMapiv;
+if(this->m_ptr_glGetMapiv)this->m_ptr_glGetMapiv = (FunctionTable::MEMBERPFNGLGETMAPIVPROC)&ProfilingTableDecorator::m_glGetMapiv_profile;
+this->m_names[989] = "glImportSemaphoreFdEXT";
+this->m_orig_glImportSemaphoreFdEXT = this->m_ptr_glImportSemaphoreFdEXT;
+if(this->m_ptr_glImportSemaphoreFdEXT)this->m_ptr_glImportSemaphoreFdEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC)&ProfilingTableDecorator::m_glImportSemaphoreFdEXT_profile;
+this->m_names[990] = "glMultiTexCoord4sv";
+this->m_orig_glMultiTexCoord4sv = this->m_ptr_glMultiTexCoord4sv;
+if(this->m_ptr_glMultiTexCoord4sv)this->m_ptr_glMultiTexCoord4sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4sv_profile;
+this->m_names[991] = "glPNTrianglesiATI";
+this->m_orig_glPNTrianglesiATI = this->m_ptr_glPNTrianglesiATI;
+if(this->m_ptr_glPNTrianglesiATI)this->m_ptr_glPNTrianglesiATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC)&ProfilingTableDecorator::m_glPNTrianglesiATI_profile;
+this->m_names[992] = "glBindVertexArrayAPPLE";
+this->m_orig_glBindVertexArrayAPPLE = this->m_ptr_glBindVertexArrayAPPLE;
+if(this->m_ptr_glBindVertexArrayAPPLE)this->m_ptr_glBindVertexArrayAPPLE = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC)&ProfilingTableDecorator::m_glBindVertexArrayAPPLE_profile;
+this->m_names[993] = "glObjectPtrLabel";
+this->m_orig_glObjectPtrLabel = this->m_ptr_glObjectPtrLabel;
+if(this->m_ptr_glObjectPtrLabel)this->m_ptr_glObjectPtrLabel = (FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC)&ProfilingTableDecorator::m_glObjectPtrLabel_profile;
+this->m_names[994] = "glGetDebugMessageLog";
+this->m_orig_glGetDebugMessageLog = this->m_ptr_glGetDebugMessageLog;
+if(this->m_ptr_glGetDebugMessageLog)this->m_ptr_glGetDebugMessageLog = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC)&ProfilingTableDecorator::m_glGetDebugMessageLog_profile;
+this->m_names[995] = "glTrackMatrixNV";
+this->m_orig_glTrackMatrixNV = this->m_ptr_glTrackMatrixNV;
+if(this->m_ptr_glTrackMatrixNV)this->m_ptr_glTrackMatrixNV = (FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC)&ProfilingTableDecorator::m_glTrackMatrixNV_profile;
+this->m_names[996] = "glProgramPathFragmentInputGenNV";
+this->m_orig_glProgramPathFragmentInputGenNV = this->m_ptr_glProgramPathFragmentInputGenNV;
+if(this->m_ptr_glProgramPathFragmentInputGenNV)this->m_ptr_glProgramPathFragmentInputGenNV = (FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)&ProfilingTableDecorator::m_glProgramPathFragmentInputGenNV_profile;
+this->m_names[997] = "glTangent3ivEXT";
+this->m_orig_glTangent3ivEXT = this->m_ptr_glTangent3ivEXT;
+if(this->m_ptr_glTangent3ivEXT)this->m_ptr_glTangent3ivEXT = (FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC)&ProfilingTableDecorator::m_glTangent3ivEXT_profile;
+this->m_names[998] = "glGetUniformfv";
+this->m_orig_glGetUniformfv = this->m_ptr_glGetUniformfv;
+if(this->m_ptr_glGetUniformfv)this->m_ptr_glGetUniformfv = (FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC)&ProfilingTableDecorator::m_glGetUniformfv_profile;
+this->m_names[999] = "glSecondaryColor3ubv";
+this->m_orig_glSecondaryColor3ubv = this->m_ptr_glSecondaryColor3ubv;
+if(this->m_ptr_glSecondaryColor3ubv)this->m_ptr_glSecondaryColor3ubv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubv_profile;
+this->m_names[1000] = "glMakeTextureHandleNonResidentNV";
+this->m_orig_glMakeTextureHandleNonResidentNV = this->m_ptr_glMakeTextureHandleNonResidentNV;
+if(this->m_ptr_glMakeTextureHandleNonResidentNV)this->m_ptr_glMakeTextureHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeTextureHandleNonResidentNV_profile;
+this->m_names[1001] = "glVertexAttribs4ubvNV";
+this->m_orig_glVertexAttribs4ubvNV = this->m_ptr_glVertexAttribs4ubvNV;
+if(this->m_ptr_glVertexAttribs4ubvNV)this->m_ptr_glVertexAttribs4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4ubvNV_profile;
+this->m_names[1002] = "glClipPlanexOES";
+this->m_orig_glClipPlanexOES = this->m_ptr_glClipPlanexOES;
+if(this->m_ptr_glClipPlanexOES)this->m_ptr_glClipPlanexOES = (FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC)&ProfilingTableDecorator::m_glClipPlanexOES_profile;
+this->m_names[1003] = "glMultiTexCoord3iv";
+this->m_orig_glMultiTexCoord3iv = this->m_ptr_glMultiTexCoord3iv;
+if(this->m_ptr_glMultiTexCoord3iv)this->m_ptr_glMultiTexCoord3iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3iv_profile;
+this->m_names[1004] = "glGetnPolygonStippleARB";
+this->m_orig_glGetnPolygonStippleARB = this->m_ptr_glGetnPolygonStippleARB;
+if(this->m_ptr_glGetnPolygonStippleARB)this->m_ptr_glGetnPolygonStippleARB = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC)&ProfilingTableDecorator::m_glGetnPolygonStippleARB_profile;
+this->m_names[1005] = "glUniform2i64vNV";
+this->m_orig_glUniform2i64vNV = this->m_ptr_glUniform2i64vNV;
+if(this->m_ptr_glUniform2i64vNV)this->m_ptr_glUniform2i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC)&ProfilingTableDecorator::m_glUniform2i64vNV_profile;
+this->m_names[1006] = "glLightModelf";
+this->m_orig_glLightModelf = this->m_ptr_glLightModelf;
+if(this->m_ptr_glLightModelf)this->m_ptr_glLightModelf = (FunctionTable::MEMBERPFNGLLIGHTMODELFPROC)&ProfilingTableDecorator::m_glLightModelf_profile;
+this->m_names[1007] = "glDeleteMemoryObjectsEXT";
+this->m_orig_glDeleteMemoryObjectsEXT = this->m_ptr_glDeleteMemoryObjectsEXT;
+if(this->m_ptr_glDeleteMemoryObjectsEXT)this->m_ptr_glDeleteMemoryObjectsEXT = (FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC)&ProfilingTableDecorator::m_glDeleteMemoryObjectsEXT_profile;
+this->m_names[1008] = "glMultiTexSubImage2DEXT";
+this->m_orig_glMultiTexSubImage2DEXT = this->m_ptr_glMultiTexSubImage2DEXT;
+if(this->m_ptr_glMultiTexSubImage2DEXT)this->m_ptr_glMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage2DEXT_profile;
+this->m_names[1009] = "glReplacementCodeuiColor3fVertex3fSUN";
+this->m_orig_glReplacementCodeuiColor3fVertex3fSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor3fVertex3fSUN_profile;
+this->m_names[1010] = "glTangent3dvEXT";
+this->m_orig_glTangent3dvEXT = this->m_ptr_glTangent3dvEXT;
+if(this->m_ptr_glTangent3dvEXT)this->m_ptr_glTangent3dvEXT = (FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC)&ProfilingTableDecorator::m_glTangent3dvEXT_profile;
+this->m_names[1011] = "glLightModeli";
+this->m_orig_glLightModeli = this->m_ptr_glLightModeli;
+if(this->m_ptr_glLightModeli)this->m_ptr_glLightModeli = (FunctionTable::MEMBERPFNGLLIGHTMODELIPROC)&ProfilingTableDecorator::m_glLightModeli_profile;
+this->m_names[1012] = "glVertexWeighthvNV";
+this->m_orig_glVertexWeighthvNV = this->m_ptr_glVertexWeighthvNV;
+if(this->m_ptr_glVertexWeighthvNV)this->m_ptr_glVertexWeighthvNV = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC)&ProfilingTableDecorator::m_glVertexWeighthvNV_profile;
+this->m_names[1013] = "glWindowPos3iv";
+this->m_orig_glWindowPos3iv = this->m_ptr_glWindowPos3iv;
+if(this->m_ptr_glWindowPos3iv)this->m_ptr_glWindowPos3iv = (FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC)&ProfilingTableDecorator::m_glWindowPos3iv_profile;
+this->m_names[1014] = "glMultiTexCoordP1uiv";
+this->m_orig_glMultiTexCoordP1uiv = this->m_ptr_glMultiTexCoordP1uiv;
+if(this->m_ptr_glMultiTexCoordP1uiv)this->m_ptr_glMultiTexCoordP1uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP1uiv_profile;
+this->m_names[1015] = "glTransformPathNV";
+this->m_orig_glTransformPathNV = this->m_ptr_glTransformPathNV;
+if(this->m_ptr_glTransformPathNV)this->m_ptr_glTransformPathNV = (FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC)&ProfilingTableDecorator::m_glTransformPathNV_profile;
+this->m_names[1016] = "glProgramNamedParameter4dNV";
+this->m_orig_glProgramNamedParameter4dNV = this->m_ptr_glProgramNamedParameter4dNV;
+if(this->m_ptr_glProgramNamedParameter4dNV)this->m_ptr_glProgramNamedParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4dNV_profile;
+this->m_names[1017] = "glMultiDrawElementsIndirect";
+this->m_orig_glMultiDrawElementsIndirect = this->m_ptr_glMultiDrawElementsIndirect;
+if(this->m_ptr_glMultiDrawElementsIndirect)this->m_ptr_glMultiDrawElementsIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirect_profile;
+this->m_names[1018] = "glProgramUniform1dEXT";
+this->m_orig_glProgramUniform1dEXT = this->m_ptr_glProgramUniform1dEXT;
+if(this->m_ptr_glProgramUniform1dEXT)this->m_ptr_glProgramUniform1dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1dEXT_profile;
+this->m_names[1019] = "glCallLists";
+this->m_orig_glCallLists = this->m_ptr_glCallLists;
+if(this->m_ptr_glCallLists)this->m_ptr_glCallLists = (FunctionTable::MEMBERPFNGLCALLLISTSPROC)&ProfilingTableDecorator::m_glCallLists_profile;
+this->m_names[1020] = "glNormal3hvNV";
+this->m_orig_glNormal3hvNV = this->m_ptr_glNormal3hvNV;
+if(this->m_ptr_glNormal3hvNV)this->m_ptr_glNormal3hvNV = (FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC)&ProfilingTableDecorator::m_glNormal3hvNV_profile;
+this->m_names[1021] = "glGetCombinerOutputParameterfvNV";
+this->m_orig_glGetCombinerOutputParameterfvNV = this->m_ptr_glGetCombinerOutputParameterfvNV;
+if(this->m_ptr_glGetCombinerOutputParameterfvNV)this->m_ptr_glGetCombinerOutputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerOutputParameterfvNV_profile;
+this->m_names[1022] = "glVertexAttrib4sARB";
+this->m_orig_glVertexAttrib4sARB = this->m_ptr_glVertexAttrib4sARB;
+if(this->m_ptr_glVertexAttrib4sARB)this->m_ptr_glVertexAttrib4sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4sARB_profile;
+this->m_names[1023] = "glTexCoord3i";
+this->m_orig_glTexCoord3i = this->m_ptr_glTexCoord3i;
+if(this->m_ptr_glTexCoord3i)this->m_ptr_glTexCoord3i = (FunctionTable::MEMBERPFNGLTEXCOORD3IPROC)&ProfilingTableDecorator::m_glTexCoord3i_profile;
+this->m_names[1024] = "glVertexAttribI3uiv";
+this->m_orig_glVertexAttribI3uiv = this->m_ptr_glVertexAttribI3uiv;
+if(this->m_ptr_glVertexAttribI3uiv)this->m_ptr_glVertexAttribI3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI3uiv_profile;
+this->m_names[1025] = "glPushDebugGroup";
+this->m_orig_glPushDebugGroup = this->m_ptr_glPushDebugGroup;
+if(this->m_ptr_glPushDebugGroup)this->m_ptr_glPushDebugGroup = (FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC)&ProfilingTableDecorator::m_glPushDebugGroup_profile;
+this->m_names[1026] = "glTexCoord3f";
+this->m_orig_glTexCoord3f = this->m_ptr_glTexCoord3f;
+if(this->m_ptr_glTexCoord3f)this->m_ptr_glTexCoord3f = (FunctionTable::MEMBERPFNGLTEXCOORD3FPROC)&ProfilingTableDecorator::m_glTexCoord3f_profile;
+this->m_names[1027] = "glTexCoord3d";
+this->m_orig_glTexCoord3d = this->m_ptr_glTexCoord3d;
+if(this->m_ptr_glTexCoord3d)this->m_ptr_glTexCoord3d = (FunctionTable::MEMBERPFNGLTEXCOORD3DPROC)&ProfilingTableDecorator::m_glTexCoord3d_profile;
+this->m_names[1028] = "glTexCoord2xOES";
+this->m_orig_glTexCoord2xOES = this->m_ptr_glTexCoord2xOES;
+if(this->m_ptr_glTexCoord2xOES)this->m_ptr_glTexCoord2xOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC)&ProfilingTableDecorator::m_glTexCoord2xOES_profile;
+this->m_names[1029] = "glGetStageIndexNV";
+this->m_orig_glGetStageIndexNV = this->m_ptr_glGetStageIndexNV;
+if(this->m_ptr_glGetStageIndexNV)this->m_ptr_glGetStageIndexNV = (FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC)&ProfilingTableDecorator::m_glGetStageIndexNV_profile;
+this->m_names[1030] = "glProgramUniform4i64vNV";
+this->m_orig_glProgramUniform4i64vNV = this->m_ptr_glProgramUniform4i64vNV;
+if(this->m_ptr_glProgramUniform4i64vNV)this->m_ptr_glProgramUniform4i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform4i64vNV_profile;
+this->m_names[1031] = "glGetNamedBufferPointervEXT";
+this->m_orig_glGetNamedBufferPointervEXT = this->m_ptr_glGetNamedBufferPointervEXT;
+if(this->m_ptr_glGetNamedBufferPointervEXT)this->m_ptr_glGetNamedBufferPointervEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferPointervEXT_profile;
+this->m_names[1032] = "glTextureBarrierNV";
+this->m_orig_glTextureBarrierNV = this->m_ptr_glTextureBarrierNV;
+if(this->m_ptr_glTextureBarrierNV)this->m_ptr_glTextureBarrierNV = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC)&ProfilingTableDecorator::m_glTextureBarrierNV_profile;
+this->m_names[1033] = "glColor4ubVertex3fvSUN";
+this->m_orig_glColor4ubVertex3fvSUN = this->m_ptr_glColor4ubVertex3fvSUN;
+if(this->m_ptr_glColor4ubVertex3fvSUN)this->m_ptr_glColor4ubVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex3fvSUN_profile;
+this->m_names[1034] = "glGetCommandHeaderNV";
+this->m_orig_glGetCommandHeaderNV = this->m_ptr_glGetCommandHeaderNV;
+if(this->m_ptr_glGetCommandHeaderNV)this->m_ptr_glGetCommandHeaderNV = (FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC)&ProfilingTableDecorator::m_glGetCommandHeaderNV_profile;
+this->m_names[1035] = "glGetPerfMonitorCounterInfoAMD";
+this->m_orig_glGetPerfMonitorCounterInfoAMD = this->m_ptr_glGetPerfMonitorCounterInfoAMD;
+if(this->m_ptr_glGetPerfMonitorCounterInfoAMD)this->m_ptr_glGetPerfMonitorCounterInfoAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterInfoAMD_profile;
+this->m_names[1036] = "glVertexAttrib1svARB";
+this->m_orig_glVertexAttrib1svARB = this->m_ptr_glVertexAttrib1svARB;
+if(this->m_ptr_glVertexAttrib1svARB)this->m_ptr_glVertexAttrib1svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1svARB_profile;
+this->m_names[1037] = "glCombinerParameteriNV";
+this->m_orig_glCombinerParameteriNV = this->m_ptr_glCombinerParameteriNV;
+if(this->m_ptr_glCombinerParameteriNV)this->m_ptr_glCombinerParameteriNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC)&ProfilingTableDecorator::m_glCombinerParameteriNV_profile;
+this->m_names[1038] = "glMatrixMultTransposefEXT";
+this->m_orig_glMatrixMultTransposefEXT = this->m_ptr_glMatrixMultTransposefEXT;
+if(this->m_ptr_glMatrixMultTransposefEXT)this->m_ptr_glMatrixMultTransposefEXT = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC)&ProfilingTableDecorator::m_glMatrixMultTransposefEXT_profile;
+this->m_names[1039] = "glDetailTexFuncSGIS";
+this->m_orig_glDetailTexFuncSGIS = this->m_ptr_glDetailTexFuncSGIS;
+if(this->m_ptr_glDetailTexFuncSGIS)this->m_ptr_glDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glDetailTexFuncSGIS_profile;
+this->m_names[1040] = "glAreTexturesResident";
+this->m_orig_glAreTexturesResident = this->m_ptr_glAreTexturesResident;
+if(this->m_ptr_glAreTexturesResident)this->m_ptr_glAreTexturesResident = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC)&ProfilingTableDecorator::m_glAreTexturesResident_profile;
+this->m_names[1041] = "glProgramUniform2d";
+this->m_orig_glProgramUniform2d = this->m_ptr_glProgramUniform2d;
+if(this->m_ptr_glProgramUniform2d)this->m_ptr_glProgramUniform2d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC)&ProfilingTableDecorator::m_glProgramUniform2d_profile;
+this->m_names[1042] = "glGetConvolutionParameterfvEXT";
+this->m_orig_glGetConvolutionParameterfvEXT = this->m_ptr_glGetConvolutionParameterfvEXT;
+if(this->m_ptr_glGetConvolutionParameterfvEXT)this->m_ptr_glGetConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterfvEXT_profile;
+this->m_names[1043] = "glIndexPointerListIBM";
+this->m_orig_glIndexPointerListIBM = this->m_ptr_glIndexPointerListIBM;
+if(this->m_ptr_glIndexPointerListIBM)this->m_ptr_glIndexPointerListIBM = (FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glIndexPointerListIBM_profile;
+this->m_names[1044] = "glVertexAttribI4iEXT";
+this->m_orig_glVertexAttribI4iEXT = this->m_ptr_glVertexAttribI4iEXT;
+if(this->m_ptr_glVertexAttribI4iEXT)this->m_ptr_glVertexAttribI4iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4iEXT_profile;
+this->m_names[1045] = "glProgramUniform2f";
+this->m_orig_glProgramUniform2f = this->m_ptr_glProgramUniform2f;
+if(this->m_ptr_glProgramUniform2f)this->m_ptr_glProgramUniform2f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC)&ProfilingTableDecorator::m_glProgramUniform2f_profile;
+this->m_names[1046] = "glRasterPos4sv";
+this->m_orig_glRasterPos4sv = this->m_ptr_glRasterPos4sv;
+if(this->m_ptr_glRasterPos4sv)this->m_ptr_glRasterPos4sv = (FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC)&ProfilingTableDecorator::m_glRasterPos4sv_profile;
+this->m_names[1047] = "glColor4s";
+this->m_orig_glColor4s = this->m_ptr_glColor4s;
+if(this->m_ptr_glColor4s)this->m_ptr_glColor4s = (FunctionTable::MEMBERPFNGLCOLOR4SPROC)&ProfilingTableDecorator::m_glColor4s_profile;
+this->m_names[1048] = "glMulticastGetQueryObjectivNV";
+this->m_orig_glMulticastGetQueryObjectivNV = this->m_ptr_glMulticastGetQueryObjectivNV;
+if(this->m_ptr_glMulticastGetQueryObjectivNV)this->m_ptr_glMulticastGetQueryObjectivNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC)&ProfilingTableDecorator::m_glMulticastGetQueryObjectivNV_profile;
+this->m_names[1049] = "glColorFragmentOp3ATI";
+this->m_orig_glColorFragmentOp3ATI = this->m_ptr_glColorFragmentOp3ATI;
+if(this->m_ptr_glColorFragmentOp3ATI)this->m_ptr_glColorFragmentOp3ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp3ATI_profile;
+this->m_names[1050] = "glResizeBuffersMESA";
+this->m_orig_glResizeBuffersMESA = this->m_ptr_glResizeBuffersMESA;
+if(this->m_ptr_glResizeBuffersMESA)this->m_ptr_glResizeBuffersMESA = (FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC)&ProfilingTableDecorator::m_glResizeBuffersMESA_profile;
+this->m_names[1051] = "glGetMinmaxParameterfv";
+this->m_orig_glGetMinmaxParameterfv = this->m_ptr_glGetMinmaxParameterfv;
+if(this->m_ptr_glGetMinmaxParameterfv)this->m_ptr_glGetMinmaxParameterfv = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterfv_profile;
+this->m_names[1052] = "glClientActiveTextureARB";
+this->m_orig_glClientActiveTextureARB = this->m_ptr_glClientActiveTextureARB;
+if(this->m_ptr_glClientActiveTextureARB)this->m_ptr_glClientActiveTextureARB = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC)&ProfilingTableDecorator::m_glClientActiveTextureARB_profile;
+this->m_names[1053] = "glBindVertexArray";
+this->m_orig_glBindVertexArray = this->m_ptr_glBindVertexArray;
+if(this->m_ptr_glBindVertexArray)this->m_ptr_glBindVertexArray = (FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC)&ProfilingTableDecorator::m_glBindVertexArray_profile;
+this->m_names[1054] = "glColor4b";
+this->m_orig_glColor4b = this->m_ptr_glColor4b;
+if(this->m_ptr_glColor4b)this->m_ptr_glColor4b = (FunctionTable::MEMBERPFNGLCOLOR4BPROC)&ProfilingTableDecorator::m_glColor4b_profile;
+this->m_names[1055] = "glColor4f";
+this->m_orig_glColor4f = this->m_ptr_glColor4f;
+if(this->m_ptr_glColor4f)this->m_ptr_glColor4f = (FunctionTable::MEMBERPFNGLCOLOR4FPROC)&ProfilingTableDecorator::m_glColor4f_profile;
+this->m_names[1056] = "glColor4d";
+this->m_orig_glColor4d = this->m_ptr_glColor4d;
+if(this->m_ptr_glColor4d)this->m_ptr_glColor4d = (FunctionTable::MEMBERPFNGLCOLOR4DPROC)&ProfilingTableDecorator::m_glColor4d_profile;
+this->m_names[1057] = "glColor4i";
+this->m_orig_glColor4i = this->m_ptr_glColor4i;
+if(this->m_ptr_glColor4i)this->m_ptr_glColor4i = (FunctionTable::MEMBERPFNGLCOLOR4IPROC)&ProfilingTableDecorator::m_glColor4i_profile;
+this->m_names[1058] = "glEdgeFlagFormatNV";
+this->m_orig_glEdgeFlagFormatNV = this->m_ptr_glEdgeFlagFormatNV;
+if(this->m_ptr_glEdgeFlagFormatNV)this->m_ptr_glEdgeFlagFormatNV = (FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC)&ProfilingTableDecorator::m_glEdgeFlagFormatNV_profile;
+this->m_names[1059] = "glNamedBufferSubData";
+this->m_orig_glNamedBufferSubData = this->m_ptr_glNamedBufferSubData;
+if(this->m_ptr_glNamedBufferSubData)this->m_ptr_glNamedBufferSubData = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glNamedBufferSubData_profile;
+this->m_names[1060] = "glDrawElementsInstanced";
+this->m_orig_glDrawElementsInstanced = this->m_ptr_glDrawElementsInstanced;
+if(this->m_ptr_glDrawElementsInstanced)this->m_ptr_glDrawElementsInstanced = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawElementsInstanced_profile;
+this->m_names[1061] = "glGetMultiTexParameterIivEXT";
+this->m_orig_glGetMultiTexParameterIivEXT = this->m_ptr_glGetMultiTexParameterIivEXT;
+if(this->m_ptr_glGetMultiTexParameterIivEXT)this->m_ptr_glGetMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterIivEXT_profile;
+this->m_names[1062] = "glVertex2dv";
+this->m_orig_glVertex2dv = this->m_ptr_glVertex2dv;
+if(this->m_ptr_glVertex2dv)this->m_ptr_glVertex2dv = (FunctionTable::MEMBERPFNGLVERTEX2DVPROC)&ProfilingTableDecorator::m_glVertex2dv_profile;
+this->m_names[1063] = "glDisableVertexArrayAttribEXT";
+this->m_orig_glDisableVertexArrayAttribEXT = this->m_ptr_glDisableVertexArrayAttribEXT;
+if(this->m_ptr_glDisableVertexArrayAttribEXT)this->m_ptr_glDisableVertexArrayAttribEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)&ProfilingTableDecorator::m_glDisableVertexArrayAttribEXT_profile;
+this->m_names[1064] = "glObjectUnpurgeableAPPLE";
+this->m_orig_glObjectUnpurgeableAPPLE = this->m_ptr_glObjectUnpurgeableAPPLE;
+if(this->m_ptr_glObjectUnpurgeableAPPLE)this->m_ptr_glObjectUnpurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC)&ProfilingTableDecorator::m_glObjectUnpurgeableAPPLE_profile;
+this->m_names[1065] = "glVertexAttribs2dvNV";
+this->m_orig_glVertexAttribs2dvNV = this->m_ptr_glVertexAttribs2dvNV;
+if(this->m_ptr_glVertexAttribs2dvNV)this->m_ptr_glVertexAttribs2dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2dvNV_profile;
+this->m_names[1066] = "glReplacementCodeuiTexCoord2fVertex3fSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fSUN_profile;
+this->m_names[1067] = "glGetMapParameterfvNV";
+this->m_orig_glGetMapParameterfvNV = this->m_ptr_glGetMapParameterfvNV;
+if(this->m_ptr_glGetMapParameterfvNV)this->m_ptr_glGetMapParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetMapParameterfvNV_profile;
+this->m_names[1068] = "glProgramUniform4ivEXT";
+this->m_orig_glProgramUniform4ivEXT = this->m_ptr_glProgramUniform4ivEXT;
+if(this->m_ptr_glProgramUniform4ivEXT)this->m_ptr_glProgramUniform4ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4ivEXT_profile;
+this->m_names[1069] = "glProgramUniform3ui64vNV";
+this->m_orig_glProgramUniform3ui64vNV = this->m_ptr_glProgramUniform3ui64vNV;
+if(this->m_ptr_glProgramUniform3ui64vNV)this->m_ptr_glProgramUniform3ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64vNV_profile;
+this->m_names[1070] = "glRectfv";
+this->m_orig_glRectfv = this->m_ptr_glRectfv;
+if(this->m_ptr_glRectfv)this->m_ptr_glRectfv = (FunctionTable::MEMBERPFNGLRECTFVPROC)&ProfilingTableDecorator::m_glRectfv_profile;
+this->m_names[1071] = "glTexFilterFuncSGIS";
+this->m_orig_glTexFilterFuncSGIS = this->m_ptr_glTexFilterFuncSGIS;
+if(this->m_ptr_glTexFilterFuncSGIS)this->m_ptr_glTexFilterFuncSGIS = (FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC)&ProfilingTableDecorator::m_glTexFilterFuncSGIS_profile;
+this->m_names[1072] = "glSpriteParameterfvSGIX";
+this->m_orig_glSpriteParameterfvSGIX = this->m_ptr_glSpriteParameterfvSGIX;
+if(this->m_ptr_glSpriteParameterfvSGIX)this->m_ptr_glSpriteParameterfvSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterfvSGIX_profile;
+this->m_names[1073] = "glCopyMultiTexImage1DEXT";
+this->m_orig_glCopyMultiTexImage1DEXT = this->m_ptr_glCopyMultiTexImage1DEXT;
+if(this->m_ptr_glCopyMultiTexImage1DEXT)this->m_ptr_glCopyMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexImage1DEXT_profile;
+this->m_names[1074] = "glGetVertexAttribIuivEXT";
+this->m_orig_glGetVertexAttribIuivEXT = this->m_ptr_glGetVertexAttribIuivEXT;
+if(this->m_ptr_glGetVertexAttribIuivEXT)this->m_ptr_glGetVertexAttribIuivEXT = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC)&ProfilingTableDecorator::m_glGetVertexAttribIuivEXT_profile;
+this->m_names[1075] = "glUniformMatrix2x4dv";
+this->m_orig_glUniformMatrix2x4dv = this->m_ptr_glUniformMatrix2x4dv;
+if(this->m_ptr_glUniformMatrix2x4dv)this->m_ptr_glUniformMatrix2x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x4dv_profile;
+this->m_names[1076] = "glGetProgramResourceLocationIndex";
+this->m_orig_glGetProgramResourceLocationIndex = this->m_ptr_glGetProgramResourceLocationIndex;
+if(this->m_ptr_glGetProgramResourceLocationIndex)this->m_ptr_glGetProgramResourceLocationIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)&ProfilingTableDecorator::m_glGetProgramResourceLocationIndex_profile;
+this->m_names[1077] = "glColor3hNV";
+this->m_orig_glColor3hNV = this->m_ptr_glColor3hNV;
+if(this->m_ptr_glColor3hNV)this->m_ptr_glColor3hNV = (FunctionTable::MEMBERPFNGLCOLOR3HNVPROC)&ProfilingTableDecorator::m_glColor3hNV_profile;
+this->m_names[1078] = "glViewport";
+this->m_orig_glViewport = this->m_ptr_glViewport;
+if(this->m_ptr_glViewport)this->m_ptr_glViewport = (FunctionTable::MEMBERPFNGLVIEWPORTPROC)&ProfilingTableDecorator::m_glViewport_profile;
+this->m_names[1079] = "glProgramNamedParameter4fNV";
+this->m_orig_glProgramNamedParameter4fNV = this->m_ptr_glProgramNamedParameter4fNV;
+if(this->m_ptr_glProgramNamedParameter4fNV)this->m_ptr_glProgramNamedParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4fNV_profile;
+this->m_names[1080] = "glGetInvariantBooleanvEXT";
+this->m_orig_glGetInvariantBooleanvEXT = this->m_ptr_glGetInvariantBooleanvEXT;
+if(this->m_ptr_glGetInvariantBooleanvEXT)this->m_ptr_glGetInvariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantBooleanvEXT_profile;
+this->m_names[1081] = "glTexStorage2DMultisample";
+this->m_orig_glTexStorage2DMultisample = this->m_ptr_glTexStorage2DMultisample;
+if(this->m_ptr_glTexStorage2DMultisample)this->m_ptr_glTexStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexStorage2DMultisample_profile;
+this->m_names[1082] = "glPixelStorex";
+this->m_orig_glPixelStorex = this->m_ptr_glPixelStorex;
+if(this->m_ptr_glPixelStorex)this->m_ptr_glPixelStorex = (FunctionTable::MEMBERPFNGLPIXELSTOREXPROC)&ProfilingTableDecorator::m_glPixelStorex_profile;
+this->m_names[1083] = "glVertexAttribL1dvEXT";
+this->m_orig_glVertexAttribL1dvEXT = this->m_ptr_glVertexAttribL1dvEXT;
+if(this->m_ptr_glVertexAttribL1dvEXT)this->m_ptr_glVertexAttribL1dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL1dvEXT_profile;
+this->m_names[1084] = "glGetActiveSubroutineUniformiv";
+this->m_orig_glGetActiveSubroutineUniformiv = this->m_ptr_glGetActiveSubroutineUniformiv;
+if(this->m_ptr_glGetActiveSubroutineUniformiv)this->m_ptr_glGetActiveSubroutineUniformiv = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineUniformiv_profile;
+this->m_names[1085] = "glVertexAttribPointerARB";
+this->m_orig_glVertexAttribPointerARB = this->m_ptr_glVertexAttribPointerARB;
+if(this->m_ptr_glVertexAttribPointerARB)this->m_ptr_glVertexAttribPointerARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC)&ProfilingTableDecorator::m_glVertexAttribPointerARB_profile;
+this->m_names[1086] = "glCompressedTexSubImage2DARB";
+this->m_orig_glCompressedTexSubImage2DARB = this->m_ptr_glCompressedTexSubImage2DARB;
+if(this->m_ptr_glCompressedTexSubImage2DARB)this->m_ptr_glCompressedTexSubImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage2DARB_profile;
+this->m_names[1087] = "glTexStorageMem1DEXT";
+this->m_orig_glTexStorageMem1DEXT = this->m_ptr_glTexStorageMem1DEXT;
+if(this->m_ptr_glTexStorageMem1DEXT)this->m_ptr_glTexStorageMem1DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC)&ProfilingTableDecorator::m_glTexStorageMem1DEXT_profile;
+this->m_names[1088] = "glVertex2hvNV";
+this->m_orig_glVertex2hvNV = this->m_ptr_glVertex2hvNV;
+if(this->m_ptr_glVertex2hvNV)this->m_ptr_glVertex2hvNV = (FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC)&ProfilingTableDecorator::m_glVertex2hvNV_profile;
+this->m_names[1089] = "glTexBuffer";
+this->m_orig_glTexBuffer = this->m_ptr_glTexBuffer;
+if(this->m_ptr_glTexBuffer)this->m_ptr_glTexBuffer = (FunctionTable::MEMBERPFNGLTEXBUFFERPROC)&ProfilingTableDecorator::m_glTexBuffer_profile;
+this->m_names[1090] = "glArrayElement";
+this->m_orig_glArrayElement = this->m_ptr_glArrayElement;
+if(this->m_ptr_glArrayElement)this->m_ptr_glArrayElement = (FunctionTable::MEMBERPFNGLARRAYELEMENTPROC)&ProfilingTableDecorator::m_glArrayElement_profile;
+this->m_names[1091] = "glValidateProgram";
+this->m_orig_glValidateProgram = this->m_ptr_glValidateProgram;
+if(this->m_ptr_glValidateProgram)this->m_ptr_glValidateProgram = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC)&ProfilingTableDecorator::m_glValidateProgram_profile;
+this->m_names[1092] = "glPixelStoref";
+this->m_orig_glPixelStoref = this->m_ptr_glPixelStoref;
+if(this->m_ptr_glPixelStoref)this->m_ptr_glPixelStoref = (FunctionTable::MEMBERPFNGLPIXELSTOREFPROC)&ProfilingTableDecorator::m_glPixelStoref_profile;
+this->m_names[1093] = "glWindowPos3dARB";
+this->m_orig_glWindowPos3dARB = this->m_ptr_glWindowPos3dARB;
+if(this->m_ptr_glWindowPos3dARB)this->m_ptr_glWindowPos3dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC)&ProfilingTableDecorator::m_glWindowPos3dARB_profile;
+this->m_names[1094] = "glEvalCoord1dv";
+this->m_orig_glEvalCoord1dv = this->m_ptr_glEvalCoord1dv;
+if(this->m_ptr_glEvalCoord1dv)this->m_ptr_glEvalCoord1dv = (FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC)&ProfilingTableDecorator::m_glEvalCoord1dv_profile;
+this->m_names[1095] = "glVertexAttribs2fvNV";
+this->m_orig_glVertexAttribs2fvNV = this->m_ptr_glVertexAttribs2fvNV;
+if(this->m_ptr_glVertexAttribs2fvNV)this->m_ptr_glVertexAttribs2fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2fvNV_profile;
+this->m_names[1096] = "glRecti";
+this->m_orig_glRecti = this->m_ptr_glRecti;
+if(this->m_ptr_glRecti)this->m_ptr_glRecti = (FunctionTable::MEMBERPFNGLRECTIPROC)&ProfilingTableDecorator::m_glRecti_profile;
+this->m_names[1097] = "glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profile;
+this->m_names[1098] = "glTexCoord1bOES";
+this->m_orig_glTexCoord1bOES = this->m_ptr_glTexCoord1bOES;
+if(this->m_ptr_glTexCoord1bOES)this->m_ptr_glTexCoord1bOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC)&ProfilingTableDecorator::m_glTexCoord1bOES_profile;
+this->m_names[1099] = "glProgramUniform2i64vARB";
+this->m_orig_glProgramUniform2i64vARB = this->m_ptr_glProgramUniform2i64vARB;
+if(this->m_ptr_glProgramUniform2i64vARB)this->m_ptr_glProgramUniform2i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform2i64vARB_profile;
+this->m_names[1100] = "glWindowPos2dARB";
+this->m_orig_glWindowPos2dARB = this->m_ptr_glWindowPos2dARB;
+if(this->m_ptr_glWindowPos2dARB)this->m_ptr_glWindowPos2dARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC)&ProfilingTableDecorator::m_glWindowPos2dARB_profile;
+this->m_names[1101] = "glGetProgramParameterdvNV";
+this->m_orig_glGetProgramParameterdvNV = this->m_ptr_glGetProgramParameterdvNV;
+if(this->m_ptr_glGetProgramParameterdvNV)this->m_ptr_glGetProgramParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glGetProgramParameterdvNV_profile;
+this->m_names[1102] = "glRectf";
+this->m_orig_glRectf = this->m_ptr_glRectf;
+if(this->m_ptr_glRectf)this->m_ptr_glRectf = (FunctionTable::MEMBERPFNGLRECTFPROC)&ProfilingTableDecorator::m_glRectf_profile;
+this->m_names[1103] = "glRectd";
+this->m_orig_glRectd = this->m_ptr_glRectd;
+if(this->m_ptr_glRectd)this->m_ptr_glRectd = (FunctionTable::MEMBERPFNGLRECTDPROC)&ProfilingTableDecorator::m_glRectd_profile;
+this->m_names[1104] = "glMap1xOES";
+this->m_orig_glMap1xOES = this->m_ptr_glMap1xOES;
+if(this->m_ptr_glMap1xOES)this->m_ptr_glMap1xOES = (FunctionTable::MEMBERPFNGLMAP1XOESPROC)&ProfilingTableDecorator::m_glMap1xOES_profile;
+this->m_names[1105] = "glVertexAttrib3fvNV";
+this->m_orig_glVertexAttrib3fvNV = this->m_ptr_glVertexAttrib3fvNV;
+if(this->m_ptr_glVertexAttrib3fvNV)this->m_ptr_glVertexAttrib3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fvNV_profile;
+this->m_names[1106] = "glReferencePlaneSGIX";
+this->m_orig_glReferencePlaneSGIX = this->m_ptr_glReferencePlaneSGIX;
+if(this->m_ptr_glReferencePlaneSGIX)this->m_ptr_glReferencePlaneSGIX = (FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC)&ProfilingTableDecorator::m_glReferencePlaneSGIX_profile;
+this->m_names[1107] = "glMulticastBlitFramebufferNV";
+this->m_orig_glMulticastBlitFramebufferNV = this->m_ptr_glMulticastBlitFramebufferNV;
+if(this->m_ptr_glMulticastBlitFramebufferNV)this->m_ptr_glMulticastBlitFramebufferNV = (FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC)&ProfilingTableDecorator::m_glMulticastBlitFramebufferNV_profile;
+this->m_names[1108] = "glGetCombinerInputParameterfvNV";
+this->m_orig_glGetCombinerInputParameterfvNV = this->m_ptr_glGetCombinerInputParameterfvNV;
+if(this->m_ptr_glGetCombinerInputParameterfvNV)this->m_ptr_glGetCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetCombinerInputParameterfvNV_profile;
+this->m_names[1109] = "glGetTextureSamplerHandleARB";
+this->m_orig_glGetTextureSamplerHandleARB = this->m_ptr_glGetTextureSamplerHandleARB;
+if(this->m_ptr_glGetTextureSamplerHandleARB)this->m_ptr_glGetTextureSamplerHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC)&ProfilingTableDecorator::m_glGetTextureSamplerHandleARB_profile;
+this->m_names[1110] = "glBindTexture";
+this->m_orig_glBindTexture = this->m_ptr_glBindTexture;
+if(this->m_ptr_glBindTexture)this->m_ptr_glBindTexture = (FunctionTable::MEMBERPFNGLBINDTEXTUREPROC)&ProfilingTableDecorator::m_glBindTexture_profile;
+this->m_names[1111] = "glRects";
+this->m_orig_glRects = this->m_ptr_glRects;
+if(this->m_ptr_glRects)this->m_ptr_glRects = (FunctionTable::MEMBERPFNGLRECTSPROC)&ProfilingTableDecorator::m_glRects_profile;
+this->m_names[1112] = "glGetActiveAttribARB";
+this->m_orig_glGetActiveAttribARB = this->m_ptr_glGetActiveAttribARB;
+if(this->m_ptr_glGetActiveAttribARB)this->m_ptr_glGetActiveAttribARB = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC)&ProfilingTableDecorator::m_glGetActiveAttribARB_profile;
+this->m_names[1113] = "glHistogramEXT";
+this->m_orig_glHistogramEXT = this->m_ptr_glHistogramEXT;
+if(this->m_ptr_glHistogramEXT)this->m_ptr_glHistogramEXT = (FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glHistogramEXT_profile;
+this->m_names[1114] = "glGetTextureSamplerHandleNV";
+this->m_orig_glGetTextureSamplerHandleNV = this->m_ptr_glGetTextureSamplerHandleNV;
+if(this->m_ptr_glGetTextureSamplerHandleNV)this->m_ptr_glGetTextureSamplerHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC)&ProfilingTableDecorator::m_glGetTextureSamplerHandleNV_profile;
+this->m_names[1115] = "glDetachShader";
+this->m_orig_glDetachShader = this->m_ptr_glDetachShader;
+if(this->m_ptr_glDetachShader)this->m_ptr_glDetachShader = (FunctionTable::MEMBERPFNGLDETACHSHADERPROC)&ProfilingTableDecorator::m_glDetachShader_profile;
+this->m_names[1116] = "glFinishTextureSUNX";
+this->m_orig_glFinishTextureSUNX = this->m_ptr_glFinishTextureSUNX;
+if(this->m_ptr_glFinishTextureSUNX)this->m_ptr_glFinishTextureSUNX = (FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC)&ProfilingTableDecorator::m_glFinishTextureSUNX_profile;
+this->m_names[1117] = "glUniformMatrix3x4dv";
+this->m_orig_glUniformMatrix3x4dv = this->m_ptr_glUniformMatrix3x4dv;
+if(this->m_ptr_glUniformMatrix3x4dv)this->m_ptr_glUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x4dv_profile;
+this->m_names[1118] = "glVertexAttrib4fARB";
+this->m_orig_glVertexAttrib4fARB = this->m_ptr_glVertexAttrib4fARB;
+if(this->m_ptr_glVertexAttrib4fARB)this->m_ptr_glVertexAttrib4fARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4fARB_profile;
+this->m_names[1119] = "glGetPathColorGenivNV";
+this->m_orig_glGetPathColorGenivNV = this->m_ptr_glGetPathColorGenivNV;
+if(this->m_ptr_glGetPathColorGenivNV)this->m_ptr_glGetPathColorGenivNV = (FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC)&ProfilingTableDecorator::m_glGetPathColorGenivNV_profile;
+this->m_names[1120] = "glGetProgramResourceLocation";
+this->m_orig_glGetProgramResourceLocation = this->m_ptr_glGetProgramResourceLocation;
+if(this->m_ptr_glGetProgramResourceLocation)this->m_ptr_glGetProgramResourceLocation = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC)&ProfilingTableDecorator::m_glGetProgramResourceLocation_profile;
+this->m_names[1121] = "glVertexArrayAttribLFormat";
+this->m_orig_glVertexArrayAttribLFormat = this->m_ptr_glVertexArrayAttribLFormat;
+if(this->m_ptr_glVertexArrayAttribLFormat)this->m_ptr_glVertexArrayAttribLFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribLFormat_profile;
+this->m_names[1122] = "glGetTexLevelParameterfv";
+this->m_orig_glGetTexLevelParameterfv = this->m_ptr_glGetTexLevelParameterfv;
+if(this->m_ptr_glGetTexLevelParameterfv)this->m_ptr_glGetTexLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTexLevelParameterfv_profile;
+this->m_names[1123] = "glVertexArrayVertexAttribOffsetEXT";
+this->m_orig_glVertexArrayVertexAttribOffsetEXT = this->m_ptr_glVertexArrayVertexAttribOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribOffsetEXT)this->m_ptr_glVertexArrayVertexAttribOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribOffsetEXT_profile;
+this->m_names[1124] = "glIndexFormatNV";
+this->m_orig_glIndexFormatNV = this->m_ptr_glIndexFormatNV;
+if(this->m_ptr_glIndexFormatNV)this->m_ptr_glIndexFormatNV = (FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC)&ProfilingTableDecorator::m_glIndexFormatNV_profile;
+this->m_names[1125] = "glMultiTexCoord3i";
+this->m_orig_glMultiTexCoord3i = this->m_ptr_glMultiTexCoord3i;
+if(this->m_ptr_glMultiTexCoord3i)this->m_ptr_glMultiTexCoord3i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC)&ProfilingTableDecorator::m_glMultiTexCoord3i_profile;
+this->m_names[1126] = "glReplacementCodeuiVertex3fvSUN";
+this->m_orig_glReplacementCodeuiVertex3fvSUN = this->m_ptr_glReplacementCodeuiVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiVertex3fvSUN)this->m_ptr_glReplacementCodeuiVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiVertex3fvSUN_profile;
+this->m_names[1127] = "glViewportIndexedfv";
+this->m_orig_glViewportIndexedfv = this->m_ptr_glViewportIndexedfv;
+if(this->m_ptr_glViewportIndexedfv)this->m_ptr_glViewportIndexedfv = (FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC)&ProfilingTableDecorator::m_glViewportIndexedfv_profile;
+this->m_names[1128] = "glBindBuffersBase";
+this->m_orig_glBindBuffersBase = this->m_ptr_glBindBuffersBase;
+if(this->m_ptr_glBindBuffersBase)this->m_ptr_glBindBuffersBase = (FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC)&ProfilingTableDecorator::m_glBindBuffersBase_profile;
+this->m_names[1129] = "glTexBumpParameterfvATI";
+this->m_orig_glTexBumpParameterfvATI = this->m_ptr_glTexBumpParameterfvATI;
+if(this->m_ptr_glTexBumpParameterfvATI)this->m_ptr_glTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC)&ProfilingTableDecorator::m_glTexBumpParameterfvATI_profile;
+this->m_names[1130] = "glMatrixIndexuivARB";
+this->m_orig_glMatrixIndexuivARB = this->m_ptr_glMatrixIndexuivARB;
+if(this->m_ptr_glMatrixIndexuivARB)this->m_ptr_glMatrixIndexuivARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexuivARB_profile;
+this->m_names[1131] = "glVertexAttrib1hNV";
+this->m_orig_glVertexAttrib1hNV = this->m_ptr_glVertexAttrib1hNV;
+if(this->m_ptr_glVertexAttrib1hNV)this->m_ptr_glVertexAttrib1hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1hNV_profile;
+this->m_names[1132] = "glWindowPos3svMESA";
+this->m_orig_glWindowPos3svMESA = this->m_ptr_glWindowPos3svMESA;
+if(this->m_ptr_glWindowPos3svMESA)this->m_ptr_glWindowPos3svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3svMESA_profile;
+this->m_names[1133] = "glStencilOpSeparateATI";
+this->m_orig_glStencilOpSeparateATI = this->m_ptr_glStencilOpSeparateATI;
+if(this->m_ptr_glStencilOpSeparateATI)this->m_ptr_glStencilOpSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC)&ProfilingTableDecorator::m_glStencilOpSeparateATI_profile;
+this->m_names[1134] = "glDrawElementsBaseVertex";
+this->m_orig_glDrawElementsBaseVertex = this->m_ptr_glDrawElementsBaseVertex;
+if(this->m_ptr_glDrawElementsBaseVertex)this->m_ptr_glDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawElementsBaseVertex_profile;
+this->m_names[1135] = "glBlendEquationSeparateiARB";
+this->m_orig_glBlendEquationSeparateiARB = this->m_ptr_glBlendEquationSeparateiARB;
+if(this->m_ptr_glBlendEquationSeparateiARB)this->m_ptr_glBlendEquationSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC)&ProfilingTableDecorator::m_glBlendEquationSeparateiARB_profile;
+this->m_names[1136] = "glVertexAttrib1fNV";
+this->m_orig_glVertexAttrib1fNV = this->m_ptr_glVertexAttrib1fNV;
+if(this->m_ptr_glVertexAttrib1fNV)this->m_ptr_glVertexAttrib1fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fNV_profile;
+this->m_names[1137] = "glMapVertexAttrib2fAPPLE";
+this->m_orig_glMapVertexAttrib2fAPPLE = this->m_ptr_glMapVertexAttrib2fAPPLE;
+if(this->m_ptr_glMapVertexAttrib2fAPPLE)this->m_ptr_glMapVertexAttrib2fAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib2fAPPLE_profile;
+this->m_names[1138] = "glCompressedTextureSubImage1DEXT";
+this->m_orig_glCompressedTextureSubImage1DEXT = this->m_ptr_glCompressedTextureSubImage1DEXT;
+if(this->m_ptr_glCompressedTextureSubImage1DEXT)this->m_ptr_glCompressedTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage1DEXT_profile;
+this->m_names[1139] = "glClearBufferSubData";
+this->m_orig_glClearBufferSubData = this->m_ptr_glClearBufferSubData;
+if(this->m_ptr_glClearBufferSubData)this->m_ptr_glClearBufferSubData = (FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glClearBufferSubData_profile;
+this->m_names[1140] = "glTexStorage1D";
+this->m_orig_glTexStorage1D = this->m_ptr_glTexStorage1D;
+if(this->m_ptr_glTexStorage1D)this->m_ptr_glTexStorage1D = (FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC)&ProfilingTableDecorator::m_glTexStorage1D_profile;
+this->m_names[1141] = "glVertexAttribI3iEXT";
+this->m_orig_glVertexAttribI3iEXT = this->m_ptr_glVertexAttribI3iEXT;
+if(this->m_ptr_glVertexAttribI3iEXT)this->m_ptr_glVertexAttribI3iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3iEXT_profile;
+this->m_names[1142] = "glMakeTextureHandleNonResidentARB";
+this->m_orig_glMakeTextureHandleNonResidentARB = this->m_ptr_glMakeTextureHandleNonResidentARB;
+if(this->m_ptr_glMakeTextureHandleNonResidentARB)this->m_ptr_glMakeTextureHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeTextureHandleNonResidentARB_profile;
+this->m_names[1143] = "glMultiDrawElementArrayAPPLE";
+this->m_orig_glMultiDrawElementArrayAPPLE = this->m_ptr_glMultiDrawElementArrayAPPLE;
+if(this->m_ptr_glMultiDrawElementArrayAPPLE)this->m_ptr_glMultiDrawElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glMultiDrawElementArrayAPPLE_profile;
+this->m_names[1144] = "glVertexStream4dATI";
+this->m_orig_glVertexStream4dATI = this->m_ptr_glVertexStream4dATI;
+if(this->m_ptr_glVertexStream4dATI)this->m_ptr_glVertexStream4dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC)&ProfilingTableDecorator::m_glVertexStream4dATI_profile;
+this->m_names[1145] = "glProgramUniformMatrix2dvEXT";
+this->m_orig_glProgramUniformMatrix2dvEXT = this->m_ptr_glProgramUniformMatrix2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2dvEXT)this->m_ptr_glProgramUniformMatrix2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2dvEXT_profile;
+this->m_names[1146] = "glVertexAttribs2hvNV";
+this->m_orig_glVertexAttribs2hvNV = this->m_ptr_glVertexAttribs2hvNV;
+if(this->m_ptr_glVertexAttribs2hvNV)this->m_ptr_glVertexAttribs2hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2hvNV_profile;
+this->m_names[1147] = "glGetUniformiv";
+this->m_orig_glGetUniformiv = this->m_ptr_glGetUniformiv;
+if(this->m_ptr_glGetUniformiv)this->m_ptr_glGetUniformiv = (FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetUniformiv_profile;
+this->m_names[1148] = "glClipPlanefOES";
+this->m_orig_glClipPlanefOES = this->m_ptr_glClipPlanefOES;
+if(this->m_ptr_glClipPlanefOES)this->m_ptr_glClipPlanefOES = (FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC)&ProfilingTableDecorator::m_glClipPlanefOES_profile;
+this->m_names[1149] = "glRenderbufferStorage";
+this->m_orig_glRenderbufferStorage = this->m_ptr_glRenderbufferStorage;
+if(this->m_ptr_glRenderbufferStorage)this->m_ptr_glRenderbufferStorage = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glRenderbufferStorage_profile;
+this->m_names[1150] = "glUniform4ui";
+this->m_orig_glUniform4ui = this->m_ptr_glUniform4ui;
+if(this->m_ptr_glUniform4ui)this->m_ptr_glUniform4ui = (FunctionTable::MEMBERPFNGLUNIFORM4UIPROC)&ProfilingTableDecorator::m_glUniform4ui_profile;
+this->m_names[1151] = "glBindFramebuffer";
+this->m_orig_glBindFramebuffer = this->m_ptr_glBindFramebuffer;
+if(this->m_ptr_glBindFramebuffer)this->m_ptr_glBindFramebuffer = (FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glBindFramebuffer_profile;
+this->m_names[1152] = "glValidateProgramARB";
+this->m_orig_glValidateProgramARB = this->m_ptr_glValidateProgramARB;
+if(this->m_ptr_glValidateProgramARB)this->m_ptr_glValidateProgramARB = (FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC)&ProfilingTableDecorator::m_glValidateProgramARB_profile;
+this->m_names[1153] = "glTexGenf";
+this->m_orig_glTexGenf = this->m_ptr_glTexGenf;
+if(this->m_ptr_glTexGenf)this->m_ptr_glTexGenf = (FunctionTable::MEMBERPFNGLTEXGENFPROC)&ProfilingTableDecorator::m_glTexGenf_profile;
+this->m_names[1154] = "glTexGend";
+this->m_orig_glTexGend = this->m_ptr_glTexGend;
+if(this->m_ptr_glTexGend)this->m_ptr_glTexGend = (FunctionTable::MEMBERPFNGLTEXGENDPROC)&ProfilingTableDecorator::m_glTexGend_profile;
+this->m_names[1155] = "glTexGeni";
+this->m_orig_glTexGeni = this->m_ptr_glTexGeni;
+if(this->m_ptr_glTexGeni)this->m_ptr_glTexGeni = (FunctionTable::MEMBERPFNGLTEXGENIPROC)&ProfilingTableDecorator::m_glTexGeni_profile;
+this->m_names[1156] = "glDeleteFramebuffersEXT";
+this->m_orig_glDeleteFramebuffersEXT = this->m_ptr_glDeleteFramebuffersEXT;
+if(this->m_ptr_glDeleteFramebuffersEXT)this->m_ptr_glDeleteFramebuffersEXT = (FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC)&ProfilingTableDecorator::m_glDeleteFramebuffersEXT_profile;
+this->m_names[1157] = "glResetMinmaxEXT";
+this->m_orig_glResetMinmaxEXT = this->m_ptr_glResetMinmaxEXT;
+if(this->m_ptr_glResetMinmaxEXT)this->m_ptr_glResetMinmaxEXT = (FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC)&ProfilingTableDecorator::m_glResetMinmaxEXT_profile;
+this->m_names[1158] = "glVertexAttrib1fvNV";
+this->m_orig_glVertexAttrib1fvNV = this->m_ptr_glVertexAttrib1fvNV;
+if(this->m_ptr_glVertexAttrib1fvNV)this->m_ptr_glVertexAttrib1fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1fvNV_profile;
+this->m_names[1159] = "glIsQueryARB";
+this->m_orig_glIsQueryARB = this->m_ptr_glIsQueryARB;
+if(this->m_ptr_glIsQueryARB)this->m_ptr_glIsQueryARB = (FunctionTable::MEMBERPFNGLISQUERYARBPROC)&ProfilingTableDecorator::m_glIsQueryARB_profile;
+this->m_names[1160] = "glEnableVariantClientStateEXT";
+this->m_orig_glEnableVariantClientStateEXT = this->m_ptr_glEnableVariantClientStateEXT;
+if(this->m_ptr_glEnableVariantClientStateEXT)this->m_ptr_glEnableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC)&ProfilingTableDecorator::m_glEnableVariantClientStateEXT_profile;
+this->m_names[1161] = "glScissorIndexed";
+this->m_orig_glScissorIndexed = this->m_ptr_glScissorIndexed;
+if(this->m_ptr_glScissorIndexed)this->m_ptr_glScissorIndexed = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC)&ProfilingTableDecorator::m_glScissorIndexed_profile;
+this->m_names[1162] = "glGetInvariantIntegervEXT";
+this->m_orig_glGetInvariantIntegervEXT = this->m_ptr_glGetInvariantIntegervEXT;
+if(this->m_ptr_glGetInvariantIntegervEXT)this->m_ptr_glGetInvariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantIntegervEXT_profile;
+this->m_names[1163] = "glProgramLocalParameterI4uiNV";
+this->m_orig_glProgramLocalParameterI4uiNV = this->m_ptr_glProgramLocalParameterI4uiNV;
+if(this->m_ptr_glProgramLocalParameterI4uiNV)this->m_ptr_glProgramLocalParameterI4uiNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4uiNV_profile;
+this->m_names[1164] = "glConvolutionParameterxvOES";
+this->m_orig_glConvolutionParameterxvOES = this->m_ptr_glConvolutionParameterxvOES;
+if(this->m_ptr_glConvolutionParameterxvOES)this->m_ptr_glConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glConvolutionParameterxvOES_profile;
+this->m_names[1165] = "glGenFramebuffersEXT";
+this->m_orig_glGenFramebuffersEXT = this->m_ptr_glGenFramebuffersEXT;
+if(this->m_ptr_glGenFramebuffersEXT)this->m_ptr_glGenFramebuffersEXT = (FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC)&ProfilingTableDecorator::m_glGenFramebuffersEXT_profile;
+this->m_names[1166] = "glVertexArrayColorOffsetEXT";
+this->m_orig_glVertexArrayColorOffsetEXT = this->m_ptr_glVertexArrayColorOffsetEXT;
+if(this->m_ptr_glVertexArrayColorOffsetEXT)this->m_ptr_glVertexArrayColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayColorOffsetEXT_profile;
+this->m_names[1167] = "glMultiTexCoord3ivARB";
+this->m_orig_glMultiTexCoord3ivARB = this->m_ptr_glMultiTexCoord3ivARB;
+if(this->m_ptr_glMultiTexCoord3ivARB)this->m_ptr_glMultiTexCoord3ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3ivARB_profile;
+this->m_names[1168] = "glVertexWeightfEXT";
+this->m_orig_glVertexWeightfEXT = this->m_ptr_glVertexWeightfEXT;
+if(this->m_ptr_glVertexWeightfEXT)this->m_ptr_glVertexWeightfEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC)&ProfilingTableDecorator::m_glVertexWeightfEXT_profile;
+this->m_names[1169] = "glRasterPos4dv";
+this->m_orig_glRasterPos4dv = this->m_ptr_glRasterPos4dv;
+if(this->m_ptr_glRasterPos4dv)this->m_ptr_glRasterPos4dv = (FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC)&ProfilingTableDecorator::m_glRasterPos4dv_profile;
+this->m_names[1170] = "glIsTextureHandleResidentARB";
+this->m_orig_glIsTextureHandleResidentARB = this->m_ptr_glIsTextureHandleResidentARB;
+if(this->m_ptr_glIsTextureHandleResidentARB)this->m_ptr_glIsTextureHandleResidentARB = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glIsTextureHandleResidentARB_profile;
+this->m_names[1171] = "glRasterPos2dv";
+this->m_orig_glRasterPos2dv = this->m_ptr_glRasterPos2dv;
+if(this->m_ptr_glRasterPos2dv)this->m_ptr_glRasterPos2dv = (FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC)&ProfilingTableDecorator::m_glRasterPos2dv_profile;
+this->m_names[1172] = "glWindowPos4ivMESA";
+this->m_orig_glWindowPos4ivMESA = this->m_ptr_glWindowPos4ivMESA;
+if(this->m_ptr_glWindowPos4ivMESA)this->m_ptr_glWindowPos4ivMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4ivMESA_profile;
+this->m_names[1173] = "glGetVariantPointervEXT";
+this->m_orig_glGetVariantPointervEXT = this->m_ptr_glGetVariantPointervEXT;
+if(this->m_ptr_glGetVariantPointervEXT)this->m_ptr_glGetVariantPointervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetVariantPointervEXT_profile;
+this->m_names[1174] = "glMapNamedBufferRangeEXT";
+this->m_orig_glMapNamedBufferRangeEXT = this->m_ptr_glMapNamedBufferRangeEXT;
+if(this->m_ptr_glMapNamedBufferRangeEXT)this->m_ptr_glMapNamedBufferRangeEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glMapNamedBufferRangeEXT_profile;
+this->m_names[1175] = "glGetnUniformui64vARB";
+this->m_orig_glGetnUniformui64vARB = this->m_ptr_glGetnUniformui64vARB;
+if(this->m_ptr_glGetnUniformui64vARB)this->m_ptr_glGetnUniformui64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC)&ProfilingTableDecorator::m_glGetnUniformui64vARB_profile;
+this->m_names[1176] = "glCreateShaderProgramv";
+this->m_orig_glCreateShaderProgramv = this->m_ptr_glCreateShaderProgramv;
+if(this->m_ptr_glCreateShaderProgramv)this->m_ptr_glCreateShaderProgramv = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC)&ProfilingTableDecorator::m_glCreateShaderProgramv_profile;
+this->m_names[1177] = "glGetQueryObjectiv";
+this->m_orig_glGetQueryObjectiv = this->m_ptr_glGetQueryObjectiv;
+if(this->m_ptr_glGetQueryObjectiv)this->m_ptr_glGetQueryObjectiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC)&ProfilingTableDecorator::m_glGetQueryObjectiv_profile;
+this->m_names[1178] = "glMaxShaderCompilerThreadsKHR";
+this->m_orig_glMaxShaderCompilerThreadsKHR = this->m_ptr_glMaxShaderCompilerThreadsKHR;
+if(this->m_ptr_glMaxShaderCompilerThreadsKHR)this->m_ptr_glMaxShaderCompilerThreadsKHR = (FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC)&ProfilingTableDecorator::m_glMaxShaderCompilerThreadsKHR_profile;
+this->m_names[1179] = "glPNTrianglesfATI";
+this->m_orig_glPNTrianglesfATI = this->m_ptr_glPNTrianglesfATI;
+if(this->m_ptr_glPNTrianglesfATI)this->m_ptr_glPNTrianglesfATI = (FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC)&ProfilingTableDecorator::m_glPNTrianglesfATI_profile;
+this->m_names[1180] = "glGlobalAlphaFactorusSUN";
+this->m_orig_glGlobalAlphaFactorusSUN = this->m_ptr_glGlobalAlphaFactorusSUN;
+if(this->m_ptr_glGlobalAlphaFactorusSUN)this->m_ptr_glGlobalAlphaFactorusSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorusSUN_profile;
+this->m_names[1181] = "glVertexAttrib3dvNV";
+this->m_orig_glVertexAttrib3dvNV = this->m_ptr_glVertexAttrib3dvNV;
+if(this->m_ptr_glVertexAttrib3dvNV)this->m_ptr_glVertexAttrib3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dvNV_profile;
+this->m_names[1182] = "glMultiTexCoord3sARB";
+this->m_orig_glMultiTexCoord3sARB = this->m_ptr_glMultiTexCoord3sARB;
+if(this->m_ptr_glMultiTexCoord3sARB)this->m_ptr_glMultiTexCoord3sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3sARB_profile;
+this->m_names[1183] = "glGenerateMipmap";
+this->m_orig_glGenerateMipmap = this->m_ptr_glGenerateMipmap;
+if(this->m_ptr_glGenerateMipmap)this->m_ptr_glGenerateMipmap = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC)&ProfilingTableDecorator::m_glGenerateMipmap_profile;
+this->m_names[1184] = "glCompressedTextureSubImage2D";
+this->m_orig_glCompressedTextureSubImage2D = this->m_ptr_glCompressedTextureSubImage2D;
+if(this->m_ptr_glCompressedTextureSubImage2D)this->m_ptr_glCompressedTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage2D_profile;
+this->m_names[1185] = "glNamedRenderbufferStorageMultisampleEXT";
+this->m_orig_glNamedRenderbufferStorageMultisampleEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleEXT;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisampleEXT_profile;
+this->m_names[1186] = "glPolygonOffsetClampEXT";
+this->m_orig_glPolygonOffsetClampEXT = this->m_ptr_glPolygonOffsetClampEXT;
+if(this->m_ptr_glPolygonOffsetClampEXT)this->m_ptr_glPolygonOffsetClampEXT = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC)&ProfilingTableDecorator::m_glPolygonOffsetClampEXT_profile;
+this->m_names[1187] = "glTextureRangeAPPLE";
+this->m_orig_glTextureRangeAPPLE = this->m_ptr_glTextureRangeAPPLE;
+if(this->m_ptr_glTextureRangeAPPLE)this->m_ptr_glTextureRangeAPPLE = (FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC)&ProfilingTableDecorator::m_glTextureRangeAPPLE_profile;
+this->m_names[1188] = "glBlendEquationIndexedAMD";
+this->m_orig_glBlendEquationIndexedAMD = this->m_ptr_glBlendEquationIndexedAMD;
+if(this->m_ptr_glBlendEquationIndexedAMD)this->m_ptr_glBlendEquationIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendEquationIndexedAMD_profile;
+this->m_names[1189] = "glTexCoord2d";
+this->m_orig_glTexCoord2d = this->m_ptr_glTexCoord2d;
+if(this->m_ptr_glTexCoord2d)this->m_ptr_glTexCoord2d = (FunctionTable::MEMBERPFNGLTEXCOORD2DPROC)&ProfilingTableDecorator::m_glTexCoord2d_profile;
+this->m_names[1190] = "glPointParameteri";
+this->m_orig_glPointParameteri = this->m_ptr_glPointParameteri;
+if(this->m_ptr_glPointParameteri)this->m_ptr_glPointParameteri = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC)&ProfilingTableDecorator::m_glPointParameteri_profile;
+this->m_names[1191] = "glTexCoord2f";
+this->m_orig_glTexCoord2f = this->m_ptr_glTexCoord2f;
+if(this->m_ptr_glTexCoord2f)this->m_ptr_glTexCoord2f = (FunctionTable::MEMBERPFNGLTEXCOORD2FPROC)&ProfilingTableDecorator::m_glTexCoord2f_profile;
+this->m_names[1192] = "glGetUnsignedBytei_vEXT";
+this->m_orig_glGetUnsignedBytei_vEXT = this->m_ptr_glGetUnsignedBytei_vEXT;
+if(this->m_ptr_glGetUnsignedBytei_vEXT)this->m_ptr_glGetUnsignedBytei_vEXT = (FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC)&ProfilingTableDecorator::m_glGetUnsignedBytei_vEXT_profile;
+this->m_names[1193] = "glColor4iv";
+this->m_orig_glColor4iv = this->m_ptr_glColor4iv;
+if(this->m_ptr_glColor4iv)this->m_ptr_glColor4iv = (FunctionTable::MEMBERPFNGLCOLOR4IVPROC)&ProfilingTableDecorator::m_glColor4iv_profile;
+this->m_names[1194] = "glMapNamedBufferRange";
+this->m_orig_glMapNamedBufferRange = this->m_ptr_glMapNamedBufferRange;
+if(this->m_ptr_glMapNamedBufferRange)this->m_ptr_glMapNamedBufferRange = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glMapNamedBufferRange_profile;
+this->m_names[1195] = "glUnmapBuffer";
+this->m_orig_glUnmapBuffer = this->m_ptr_glUnmapBuffer;
+if(this->m_ptr_glUnmapBuffer)this->m_ptr_glUnmapBuffer = (FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC)&ProfilingTableDecorator::m_glUnmapBuffer_profile;
+this->m_names[1196] = "glSampleMaskEXT";
+this->m_orig_glSampleMaskEXT = this->m_ptr_glSampleMaskEXT;
+if(this->m_ptr_glSampleMaskEXT)this->m_ptr_glSampleMaskEXT = (FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC)&ProfilingTableDecorator::m_glSampleMaskEXT_profile;
+this->m_names[1197] = "glTexCoord2i";
+this->m_orig_glTexCoord2i = this->m_ptr_glTexCoord2i;
+if(this->m_ptr_glTexCoord2i)this->m_ptr_glTexCoord2i = (FunctionTable::MEMBERPFNGLTEXCOORD2IPROC)&ProfilingTableDecorator::m_glTexCoord2i_profile;
+this->m_names[1198] = "glTexCoord1xvOES";
+this->m_orig_glTexCoord1xvOES = this->m_ptr_glTexCoord1xvOES;
+if(this->m_ptr_glTexCoord1xvOES)this->m_ptr_glTexCoord1xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC)&ProfilingTableDecorator::m_glTexCoord1xvOES_profile;
+this->m_names[1199] = "glVertexAttrib1sARB";
+this->m_orig_glVertexAttrib1sARB = this->m_ptr_glVertexAttrib1sARB;
+if(this->m_ptr_glVertexAttrib1sARB)this->m_ptr_glVertexAttrib1sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1sARB_profile;
+this->m_names[1200] = "glGetVertexArrayiv";
+this->m_orig_glGetVertexArrayiv = this->m_ptr_glGetVertexArrayiv;
+if(this->m_ptr_glGetVertexArrayiv)this->m_ptr_glGetVertexArrayiv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC)&ProfilingTableDecorator::m_glGetVertexArrayiv_profile;
+this->m_names[1201] = "glProgramParameter4dvNV";
+this->m_orig_glProgramParameter4dvNV = this->m_ptr_glProgramParameter4dvNV;
+if(this->m_ptr_glProgramParameter4dvNV)this->m_ptr_glProgramParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC)&ProfilingTableDecorator::m_glProgramParameter4dvNV_profile;
+this->m_names[1202] = "glTexCoord2s";
+this->m_orig_glTexCoord2s = this->m_ptr_glTexCoord2s;
+if(this->m_ptr_glTexCoord2s)this->m_ptr_glTexCoord2s = (FunctionTable::MEMBERPFNGLTEXCOORD2SPROC)&ProfilingTableDecorator::m_glTexCoord2s_profile;
+this->m_names[1203] = "glTextureParameterIuivEXT";
+this->m_orig_glTextureParameterIuivEXT = this->m_ptr_glTextureParameterIuivEXT;
+if(this->m_ptr_glTextureParameterIuivEXT)this->m_ptr_glTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterIuivEXT_profile;
+this->m_names[1204] = "glGetColorTableParameterfvSGI";
+this->m_orig_glGetColorTableParameterfvSGI = this->m_ptr_glGetColorTableParameterfvSGI;
+if(this->m_ptr_glGetColorTableParameterfvSGI)this->m_ptr_glGetColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfvSGI_profile;
+this->m_names[1205] = "glTexCoord4dv";
+this->m_orig_glTexCoord4dv = this->m_ptr_glTexCoord4dv;
+if(this->m_ptr_glTexCoord4dv)this->m_ptr_glTexCoord4dv = (FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC)&ProfilingTableDecorator::m_glTexCoord4dv_profile;
+this->m_names[1206] = "glVertexAttrib1svNV";
+this->m_orig_glVertexAttrib1svNV = this->m_ptr_glVertexAttrib1svNV;
+if(this->m_ptr_glVertexAttrib1svNV)this->m_ptr_glVertexAttrib1svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1svNV_profile;
+this->m_names[1207] = "glNamedFramebufferTextureFaceEXT";
+this->m_orig_glNamedFramebufferTextureFaceEXT = this->m_ptr_glNamedFramebufferTextureFaceEXT;
+if(this->m_ptr_glNamedFramebufferTextureFaceEXT)this->m_ptr_glNamedFramebufferTextureFaceEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureFaceEXT_profile;
+this->m_names[1208] = "glProgramUniform2ui64vNV";
+this->m_orig_glProgramUniform2ui64vNV = this->m_ptr_glProgramUniform2ui64vNV;
+if(this->m_ptr_glProgramUniform2ui64vNV)this->m_ptr_glProgramUniform2ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64vNV_profile;
+this->m_names[1209] = "glStencilFillPathNV";
+this->m_orig_glStencilFillPathNV = this->m_ptr_glStencilFillPathNV;
+if(this->m_ptr_glStencilFillPathNV)this->m_ptr_glStencilFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC)&ProfilingTableDecorator::m_glStencilFillPathNV_profile;
+this->m_names[1210] = "glNormal3dv";
+this->m_orig_glNormal3dv = this->m_ptr_glNormal3dv;
+if(this->m_ptr_glNormal3dv)this->m_ptr_glNormal3dv = (FunctionTable::MEMBERPFNGLNORMAL3DVPROC)&ProfilingTableDecorator::m_glNormal3dv_profile;
+this->m_names[1211] = "glReleaseShaderCompiler";
+this->m_orig_glReleaseShaderCompiler = this->m_ptr_glReleaseShaderCompiler;
+if(this->m_ptr_glReleaseShaderCompiler)this->m_ptr_glReleaseShaderCompiler = (FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC)&ProfilingTableDecorator::m_glReleaseShaderCompiler_profile;
+this->m_names[1212] = "glTexStorageMem3DEXT";
+this->m_orig_glTexStorageMem3DEXT = this->m_ptr_glTexStorageMem3DEXT;
+if(this->m_ptr_glTexStorageMem3DEXT)this->m_ptr_glTexStorageMem3DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC)&ProfilingTableDecorator::m_glTexStorageMem3DEXT_profile;
+this->m_names[1213] = "glTexCoord3bvOES";
+this->m_orig_glTexCoord3bvOES = this->m_ptr_glTexCoord3bvOES;
+if(this->m_ptr_glTexCoord3bvOES)this->m_ptr_glTexCoord3bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC)&ProfilingTableDecorator::m_glTexCoord3bvOES_profile;
+this->m_names[1214] = "glIsVertexAttribEnabledAPPLE";
+this->m_orig_glIsVertexAttribEnabledAPPLE = this->m_ptr_glIsVertexAttribEnabledAPPLE;
+if(this->m_ptr_glIsVertexAttribEnabledAPPLE)this->m_ptr_glIsVertexAttribEnabledAPPLE = (FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC)&ProfilingTableDecorator::m_glIsVertexAttribEnabledAPPLE_profile;
+this->m_names[1215] = "glTexCoord1dv";
+this->m_orig_glTexCoord1dv = this->m_ptr_glTexCoord1dv;
+if(this->m_ptr_glTexCoord1dv)this->m_ptr_glTexCoord1dv = (FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC)&ProfilingTableDecorator::m_glTexCoord1dv_profile;
+this->m_names[1216] = "glReadPixels";
+this->m_orig_glReadPixels = this->m_ptr_glReadPixels;
+if(this->m_ptr_glReadPixels)this->m_ptr_glReadPixels = (FunctionTable::MEMBERPFNGLREADPIXELSPROC)&ProfilingTableDecorator::m_glReadPixels_profile;
+this->m_names[1217] = "glVertexAttribI3iv";
+this->m_orig_glVertexAttribI3iv = this->m_ptr_glVertexAttribI3iv;
+if(this->m_ptr_glVertexAttribI3iv)this->m_ptr_glVertexAttribI3iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC)&ProfilingTableDecorator::m_glVertexAttribI3iv_profile;
+this->m_names[1218] = "glSetFenceAPPLE";
+this->m_orig_glSetFenceAPPLE = this->m_ptr_glSetFenceAPPLE;
+if(this->m_ptr_glSetFenceAPPLE)this->m_ptr_glSetFenceAPPLE = (FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC)&ProfilingTableDecorator::m_glSetFenceAPPLE_profile;
+this->m_names[1219] = "glWeightsvARB";
+this->m_orig_glWeightsvARB = this->m_ptr_glWeightsvARB;
+if(this->m_ptr_glWeightsvARB)this->m_ptr_glWeightsvARB = (FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC)&ProfilingTableDecorator::m_glWeightsvARB_profile;
+this->m_names[1220] = "glShadeModel";
+this->m_orig_glShadeModel = this->m_ptr_glShadeModel;
+if(this->m_ptr_glShadeModel)this->m_ptr_glShadeModel = (FunctionTable::MEMBERPFNGLSHADEMODELPROC)&ProfilingTableDecorator::m_glShadeModel_profile;
+this->m_names[1221] = "glTextureStorageMem3DMultisampleEXT";
+this->m_orig_glTextureStorageMem3DMultisampleEXT = this->m_ptr_glTextureStorageMem3DMultisampleEXT;
+if(this->m_ptr_glTextureStorageMem3DMultisampleEXT)this->m_ptr_glTextureStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorageMem3DMultisampleEXT_profile;
+this->m_names[1222] = "glMapGrid1d";
+this->m_orig_glMapGrid1d = this->m_ptr_glMapGrid1d;
+if(this->m_ptr_glMapGrid1d)this->m_ptr_glMapGrid1d = (FunctionTable::MEMBERPFNGLMAPGRID1DPROC)&ProfilingTableDecorator::m_glMapGrid1d_profile;
+this->m_names[1223] = "glGetHistogramParameterivEXT";
+this->m_orig_glGetHistogramParameterivEXT = this->m_ptr_glGetHistogramParameterivEXT;
+if(this->m_ptr_glGetHistogramParameterivEXT)this->m_ptr_glGetHistogramParameterivEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetHistogramParameterivEXT_profile;
+this->m_names[1224] = "glConservativeRasterParameteriNV";
+this->m_orig_glConservativeRasterParameteriNV = this->m_ptr_glConservativeRasterParameteriNV;
+if(this->m_ptr_glConservativeRasterParameteriNV)this->m_ptr_glConservativeRasterParameteriNV = (FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC)&ProfilingTableDecorator::m_glConservativeRasterParameteriNV_profile;
+this->m_names[1225] = "glClearNamedBufferData";
+this->m_orig_glClearNamedBufferData = this->m_ptr_glClearNamedBufferData;
+if(this->m_ptr_glClearNamedBufferData)this->m_ptr_glClearNamedBufferData = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC)&ProfilingTableDecorator::m_glClearNamedBufferData_profile;
+this->m_names[1226] = "glClearDepthf";
+this->m_orig_glClearDepthf = this->m_ptr_glClearDepthf;
+if(this->m_ptr_glClearDepthf)this->m_ptr_glClearDepthf = (FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC)&ProfilingTableDecorator::m_glClearDepthf_profile;
+this->m_names[1227] = "glCreatePerfQueryINTEL";
+this->m_orig_glCreatePerfQueryINTEL = this->m_ptr_glCreatePerfQueryINTEL;
+if(this->m_ptr_glCreatePerfQueryINTEL)this->m_ptr_glCreatePerfQueryINTEL = (FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glCreatePerfQueryINTEL_profile;
+this->m_names[1228] = "glFogCoordfEXT";
+this->m_orig_glFogCoordfEXT = this->m_ptr_glFogCoordfEXT;
+if(this->m_ptr_glFogCoordfEXT)this->m_ptr_glFogCoordfEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC)&ProfilingTableDecorator::m_glFogCoordfEXT_profile;
+this->m_names[1229] = "glVertexAttrib2dARB";
+this->m_orig_glVertexAttrib2dARB = this->m_ptr_glVertexAttrib2dARB;
+if(this->m_ptr_glVertexAttrib2dARB)this->m_ptr_glVertexAttrib2dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2dARB_profile;
+this->m_names[1230] = "glMultiTexCoord4dARB";
+this->m_orig_glMultiTexCoord4dARB = this->m_ptr_glMultiTexCoord4dARB;
+if(this->m_ptr_glMultiTexCoord4dARB)this->m_ptr_glMultiTexCoord4dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dARB_profile;
+this->m_names[1231] = "glReadnPixelsARB";
+this->m_orig_glReadnPixelsARB = this->m_ptr_glReadnPixelsARB;
+if(this->m_ptr_glReadnPixelsARB)this->m_ptr_glReadnPixelsARB = (FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC)&ProfilingTableDecorator::m_glReadnPixelsARB_profile;
+this->m_names[1232] = "glMultiTexBufferEXT";
+this->m_orig_glMultiTexBufferEXT = this->m_ptr_glMultiTexBufferEXT;
+if(this->m_ptr_glMultiTexBufferEXT)this->m_ptr_glMultiTexBufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glMultiTexBufferEXT_profile;
+this->m_names[1233] = "glWindowPos4dvMESA";
+this->m_orig_glWindowPos4dvMESA = this->m_ptr_glWindowPos4dvMESA;
+if(this->m_ptr_glWindowPos4dvMESA)this->m_ptr_glWindowPos4dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4dvMESA_profile;
+this->m_names[1234] = "glInvalidateNamedFramebufferData";
+this->m_orig_glInvalidateNamedFramebufferData = this->m_ptr_glInvalidateNamedFramebufferData;
+if(this->m_ptr_glInvalidateNamedFramebufferData)this->m_ptr_glInvalidateNamedFramebufferData = (FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)&ProfilingTableDecorator::m_glInvalidateNamedFramebufferData_profile;
+this->m_names[1235] = "glSecondaryColorPointerListIBM";
+this->m_orig_glSecondaryColorPointerListIBM = this->m_ptr_glSecondaryColorPointerListIBM;
+if(this->m_ptr_glSecondaryColorPointerListIBM)this->m_ptr_glSecondaryColorPointerListIBM = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glSecondaryColorPointerListIBM_profile;
+this->m_names[1236] = "glRectiv";
+this->m_orig_glRectiv = this->m_ptr_glRectiv;
+if(this->m_ptr_glRectiv)this->m_ptr_glRectiv = (FunctionTable::MEMBERPFNGLRECTIVPROC)&ProfilingTableDecorator::m_glRectiv_profile;
+this->m_names[1237] = "glColorP4ui";
+this->m_orig_glColorP4ui = this->m_ptr_glColorP4ui;
+if(this->m_ptr_glColorP4ui)this->m_ptr_glColorP4ui = (FunctionTable::MEMBERPFNGLCOLORP4UIPROC)&ProfilingTableDecorator::m_glColorP4ui_profile;
+this->m_names[1238] = "glUseProgramStages";
+this->m_orig_glUseProgramStages = this->m_ptr_glUseProgramStages;
+if(this->m_ptr_glUseProgramStages)this->m_ptr_glUseProgramStages = (FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC)&ProfilingTableDecorator::m_glUseProgramStages_profile;
+this->m_names[1239] = "glRasterPos3dv";
+this->m_orig_glRasterPos3dv = this->m_ptr_glRasterPos3dv;
+if(this->m_ptr_glRasterPos3dv)this->m_ptr_glRasterPos3dv = (FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC)&ProfilingTableDecorator::m_glRasterPos3dv_profile;
+this->m_names[1240] = "glPathTexGenNV";
+this->m_orig_glPathTexGenNV = this->m_ptr_glPathTexGenNV;
+if(this->m_ptr_glPathTexGenNV)this->m_ptr_glPathTexGenNV = (FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC)&ProfilingTableDecorator::m_glPathTexGenNV_profile;
+this->m_names[1241] = "glVertexBlendEnviATI";
+this->m_orig_glVertexBlendEnviATI = this->m_ptr_glVertexBlendEnviATI;
+if(this->m_ptr_glVertexBlendEnviATI)this->m_ptr_glVertexBlendEnviATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC)&ProfilingTableDecorator::m_glVertexBlendEnviATI_profile;
+this->m_names[1242] = "glUniform3i64ARB";
+this->m_orig_glUniform3i64ARB = this->m_ptr_glUniform3i64ARB;
+if(this->m_ptr_glUniform3i64ARB)this->m_ptr_glUniform3i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC)&ProfilingTableDecorator::m_glUniform3i64ARB_profile;
+this->m_names[1243] = "glLoadMatrixf";
+this->m_orig_glLoadMatrixf = this->m_ptr_glLoadMatrixf;
+if(this->m_ptr_glLoadMatrixf)this->m_ptr_glLoadMatrixf = (FunctionTable::MEMBERPFNGLLOADMATRIXFPROC)&ProfilingTableDecorator::m_glLoadMatrixf_profile;
+this->m_names[1244] = "glProgramUniform2dEXT";
+this->m_orig_glProgramUniform2dEXT = this->m_ptr_glProgramUniform2dEXT;
+if(this->m_ptr_glProgramUniform2dEXT)this->m_ptr_glProgramUniform2dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2dEXT_profile;
+this->m_names[1245] = "glVertexAttribI4iv";
+this->m_orig_glVertexAttribI4iv = this->m_ptr_glVertexAttribI4iv;
+if(this->m_ptr_glVertexAttribI4iv)this->m_ptr_glVertexAttribI4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC)&ProfilingTableDecorator::m_glVertexAttribI4iv_profile;
+this->m_names[1246] = "glNamedFramebufferDrawBuffer";
+this->m_orig_glNamedFramebufferDrawBuffer = this->m_ptr_glNamedFramebufferDrawBuffer;
+if(this->m_ptr_glNamedFramebufferDrawBuffer)this->m_ptr_glNamedFramebufferDrawBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferDrawBuffer_profile;
+this->m_names[1247] = "glColor4ubv";
+this->m_orig_glColor4ubv = this->m_ptr_glColor4ubv;
+if(this->m_ptr_glColor4ubv)this->m_ptr_glColor4ubv = (FunctionTable::MEMBERPFNGLCOLOR4UBVPROC)&ProfilingTableDecorator::m_glColor4ubv_profile;
+this->m_names[1248] = "glColor3hvNV";
+this->m_orig_glColor3hvNV = this->m_ptr_glColor3hvNV;
+if(this->m_ptr_glColor3hvNV)this->m_ptr_glColor3hvNV = (FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC)&ProfilingTableDecorator::m_glColor3hvNV_profile;
+this->m_names[1249] = "glGetMapAttribParameterfvNV";
+this->m_orig_glGetMapAttribParameterfvNV = this->m_ptr_glGetMapAttribParameterfvNV;
+if(this->m_ptr_glGetMapAttribParameterfvNV)this->m_ptr_glGetMapAttribParameterfvNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetMapAttribParameterfvNV_profile;
+this->m_names[1250] = "glGetBufferSubData";
+this->m_orig_glGetBufferSubData = this->m_ptr_glGetBufferSubData;
+if(this->m_ptr_glGetBufferSubData)this->m_ptr_glGetBufferSubData = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glGetBufferSubData_profile;
+this->m_names[1251] = "glGetVertexAttribLdv";
+this->m_orig_glGetVertexAttribLdv = this->m_ptr_glGetVertexAttribLdv;
+if(this->m_ptr_glGetVertexAttribLdv)this->m_ptr_glGetVertexAttribLdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLdv_profile;
+this->m_names[1252] = "glGetnUniformuiv";
+this->m_orig_glGetnUniformuiv = this->m_ptr_glGetnUniformuiv;
+if(this->m_ptr_glGetnUniformuiv)this->m_ptr_glGetnUniformuiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC)&ProfilingTableDecorator::m_glGetnUniformuiv_profile;
+this->m_names[1253] = "glGetUniformui64vNV";
+this->m_orig_glGetUniformui64vNV = this->m_ptr_glGetUniformui64vNV;
+if(this->m_ptr_glGetUniformui64vNV)this->m_ptr_glGetUniformui64vNV = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glGetUniformui64vNV_profile;
+this->m_names[1254] = "glNamedRenderbufferStorageEXT";
+this->m_orig_glNamedRenderbufferStorageEXT = this->m_ptr_glNamedRenderbufferStorageEXT;
+if(this->m_ptr_glNamedRenderbufferStorageEXT)this->m_ptr_glNamedRenderbufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageEXT_profile;
+this->m_names[1255] = "glVertexAttrib3dNV";
+this->m_orig_glVertexAttrib3dNV = this->m_ptr_glVertexAttrib3dNV;
+if(this->m_ptr_glVertexAttrib3dNV)this->m_ptr_glVertexAttrib3dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dNV_profile;
+this->m_names[1256] = "glTextureStorage1DEXT";
+this->m_orig_glTextureStorage1DEXT = this->m_ptr_glTextureStorage1DEXT;
+if(this->m_ptr_glTextureStorage1DEXT)this->m_ptr_glTextureStorage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureStorage1DEXT_profile;
+this->m_names[1257] = "glPixelTexGenParameteriSGIS";
+this->m_orig_glPixelTexGenParameteriSGIS = this->m_ptr_glPixelTexGenParameteriSGIS;
+if(this->m_ptr_glPixelTexGenParameteriSGIS)this->m_ptr_glPixelTexGenParameteriSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameteriSGIS_profile;
+this->m_names[1258] = "glColorTableEXT";
+this->m_orig_glColorTableEXT = this->m_ptr_glColorTableEXT;
+if(this->m_ptr_glColorTableEXT)this->m_ptr_glColorTableEXT = (FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC)&ProfilingTableDecorator::m_glColorTableEXT_profile;
+this->m_names[1259] = "glGenBuffers";
+this->m_orig_glGenBuffers = this->m_ptr_glGenBuffers;
+if(this->m_ptr_glGenBuffers)this->m_ptr_glGenBuffers = (FunctionTable::MEMBERPFNGLGENBUFFERSPROC)&ProfilingTableDecorator::m_glGenBuffers_profile;
+this->m_names[1260] = "glMultiTexCoord3xvOES";
+this->m_orig_glMultiTexCoord3xvOES = this->m_ptr_glMultiTexCoord3xvOES;
+if(this->m_ptr_glMultiTexCoord3xvOES)this->m_ptr_glMultiTexCoord3xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3xvOES_profile;
+this->m_names[1261] = "glExecuteProgramNV";
+this->m_orig_glExecuteProgramNV = this->m_ptr_glExecuteProgramNV;
+if(this->m_ptr_glExecuteProgramNV)this->m_ptr_glExecuteProgramNV = (FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC)&ProfilingTableDecorator::m_glExecuteProgramNV_profile;
+this->m_names[1262] = "glVariantArrayObjectATI";
+this->m_orig_glVariantArrayObjectATI = this->m_ptr_glVariantArrayObjectATI;
+if(this->m_ptr_glVariantArrayObjectATI)this->m_ptr_glVariantArrayObjectATI = (FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glVariantArrayObjectATI_profile;
+this->m_names[1263] = "glColor3xvOES";
+this->m_orig_glColor3xvOES = this->m_ptr_glColor3xvOES;
+if(this->m_ptr_glColor3xvOES)this->m_ptr_glColor3xvOES = (FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC)&ProfilingTableDecorator::m_glColor3xvOES_profile;
+this->m_names[1264] = "glGetnConvolutionFilterARB";
+this->m_orig_glGetnConvolutionFilterARB = this->m_ptr_glGetnConvolutionFilterARB;
+if(this->m_ptr_glGetnConvolutionFilterARB)this->m_ptr_glGetnConvolutionFilterARB = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC)&ProfilingTableDecorator::m_glGetnConvolutionFilterARB_profile;
+this->m_names[1265] = "glNormalFormatNV";
+this->m_orig_glNormalFormatNV = this->m_ptr_glNormalFormatNV;
+if(this->m_ptr_glNormalFormatNV)this->m_ptr_glNormalFormatNV = (FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC)&ProfilingTableDecorator::m_glNormalFormatNV_profile;
+this->m_names[1266] = "glGetInvariantFloatvEXT";
+this->m_orig_glGetInvariantFloatvEXT = this->m_ptr_glGetInvariantFloatvEXT;
+if(this->m_ptr_glGetInvariantFloatvEXT)this->m_ptr_glGetInvariantFloatvEXT = (FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetInvariantFloatvEXT_profile;
+this->m_names[1267] = "glClearNamedFramebufferiv";
+this->m_orig_glClearNamedFramebufferiv = this->m_ptr_glClearNamedFramebufferiv;
+if(this->m_ptr_glClearNamedFramebufferiv)this->m_ptr_glClearNamedFramebufferiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferiv_profile;
+this->m_names[1268] = "glTexImage3D";
+this->m_orig_glTexImage3D = this->m_ptr_glTexImage3D;
+if(this->m_ptr_glTexImage3D)this->m_ptr_glTexImage3D = (FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC)&ProfilingTableDecorator::m_glTexImage3D_profile;
+this->m_names[1269] = "glGenSamplers";
+this->m_orig_glGenSamplers = this->m_ptr_glGenSamplers;
+if(this->m_ptr_glGenSamplers)this->m_ptr_glGenSamplers = (FunctionTable::MEMBERPFNGLGENSAMPLERSPROC)&ProfilingTableDecorator::m_glGenSamplers_profile;
+this->m_names[1270] = "glIsFramebuffer";
+this->m_orig_glIsFramebuffer = this->m_ptr_glIsFramebuffer;
+if(this->m_ptr_glIsFramebuffer)this->m_ptr_glIsFramebuffer = (FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glIsFramebuffer_profile;
+this->m_names[1271] = "glProgramUniform3dvEXT";
+this->m_orig_glProgramUniform3dvEXT = this->m_ptr_glProgramUniform3dvEXT;
+if(this->m_ptr_glProgramUniform3dvEXT)this->m_ptr_glProgramUniform3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3dvEXT_profile;
+this->m_names[1272] = "glGetVertexAttribfvNV";
+this->m_orig_glGetVertexAttribfvNV = this->m_ptr_glGetVertexAttribfvNV;
+if(this->m_ptr_glGetVertexAttribfvNV)this->m_ptr_glGetVertexAttribfvNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribfvNV_profile;
+this->m_names[1273] = "glDrawRangeElementArrayAPPLE";
+this->m_orig_glDrawRangeElementArrayAPPLE = this->m_ptr_glDrawRangeElementArrayAPPLE;
+if(this->m_ptr_glDrawRangeElementArrayAPPLE)this->m_ptr_glDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glDrawRangeElementArrayAPPLE_profile;
+this->m_names[1274] = "glUniform3i64NV";
+this->m_orig_glUniform3i64NV = this->m_ptr_glUniform3i64NV;
+if(this->m_ptr_glUniform3i64NV)this->m_ptr_glUniform3i64NV = (FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC)&ProfilingTableDecorator::m_glUniform3i64NV_profile;
+this->m_names[1275] = "glMatrixPopEXT";
+this->m_orig_glMatrixPopEXT = this->m_ptr_glMatrixPopEXT;
+if(this->m_ptr_glMatrixPopEXT)this->m_ptr_glMatrixPopEXT = (FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC)&ProfilingTableDecorator::m_glMatrixPopEXT_profile;
+this->m_names[1276] = "glVertexStream1sATI";
+this->m_orig_glVertexStream1sATI = this->m_ptr_glVertexStream1sATI;
+if(this->m_ptr_glVertexStream1sATI)this->m_ptr_glVertexStream1sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC)&ProfilingTableDecorator::m_glVertexStream1sATI_profile;
+this->m_names[1277] = "glGetnPixelMapuivARB";
+this->m_orig_glGetnPixelMapuivARB = this->m_ptr_glGetnPixelMapuivARB;
+if(this->m_ptr_glGetnPixelMapuivARB)this->m_ptr_glGetnPixelMapuivARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapuivARB_profile;
+this->m_names[1278] = "glMultiTexEnviEXT";
+this->m_orig_glMultiTexEnviEXT = this->m_ptr_glMultiTexEnviEXT;
+if(this->m_ptr_glMultiTexEnviEXT)this->m_ptr_glMultiTexEnviEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnviEXT_profile;
+this->m_names[1279] = "glVertexAttribI2iEXT";
+this->m_orig_glVertexAttribI2iEXT = this->m_ptr_glVertexAttribI2iEXT;
+if(this->m_ptr_glVertexAttribI2iEXT)this->m_ptr_glVertexAttribI2iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2iEXT_profile;
+this->m_names[1280] = "glProgramParameter4fvNV";
+this->m_orig_glProgramParameter4fvNV = this->m_ptr_glProgramParameter4fvNV;
+if(this->m_ptr_glProgramParameter4fvNV)this->m_ptr_glProgramParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC)&ProfilingTableDecorator::m_glProgramParameter4fvNV_profile;
+this->m_names[1281] = "glWaitSemaphoreEXT";
+this->m_orig_glWaitSemaphoreEXT = this->m_ptr_glWaitSemaphoreEXT;
+if(this->m_ptr_glWaitSemaphoreEXT)this->m_ptr_glWaitSemaphoreEXT = (FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC)&ProfilingTableDecorator::m_glWaitSemaphoreEXT_profile;
+this->m_names[1282] = "glNamedFramebufferSampleLocationsfvNV";
+this->m_orig_glNamedFramebufferSampleLocationsfvNV = this->m_ptr_glNamedFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvNV)this->m_ptr_glNamedFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfilingTableDecorator::m_glNamedFramebufferSampleLocationsfvNV_profile;
+this->m_names[1283] = "glTexCoordP4uiv";
+this->m_orig_glTexCoordP4uiv = this->m_ptr_glTexCoordP4uiv;
+if(this->m_ptr_glTexCoordP4uiv)this->m_ptr_glTexCoordP4uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC)&ProfilingTableDecorator::m_glTexCoordP4uiv_profile;
+this->m_names[1284] = "glRectxvOES";
+this->m_orig_glRectxvOES = this->m_ptr_glRectxvOES;
+if(this->m_ptr_glRectxvOES)this->m_ptr_glRectxvOES = (FunctionTable::MEMBERPFNGLRECTXVOESPROC)&ProfilingTableDecorator::m_glRectxvOES_profile;
+this->m_names[1285] = "glGetVariantIntegervEXT";
+this->m_orig_glGetVariantIntegervEXT = this->m_ptr_glGetVariantIntegervEXT;
+if(this->m_ptr_glGetVariantIntegervEXT)this->m_ptr_glGetVariantIntegervEXT = (FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetVariantIntegervEXT_profile;
+this->m_names[1286] = "glDeleteLists";
+this->m_orig_glDeleteLists = this->m_ptr_glDeleteLists;
+if(this->m_ptr_glDeleteLists)this->m_ptr_glDeleteLists = (FunctionTable::MEMBERPFNGLDELETELISTSPROC)&ProfilingTableDecorator::m_glDeleteLists_profile;
+this->m_names[1287] = "glTexGendv";
+this->m_orig_glTexGendv = this->m_ptr_glTexGendv;
+if(this->m_ptr_glTexGendv)this->m_ptr_glTexGendv = (FunctionTable::MEMBERPFNGLTEXGENDVPROC)&ProfilingTableDecorator::m_glTexGendv_profile;
+this->m_names[1288] = "glVertexP2uiv";
+this->m_orig_glVertexP2uiv = this->m_ptr_glVertexP2uiv;
+if(this->m_ptr_glVertexP2uiv)this->m_ptr_glVertexP2uiv = (FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC)&ProfilingTableDecorator::m_glVertexP2uiv_profile;
+this->m_names[1289] = "glGetPerfMonitorGroupsAMD";
+this->m_orig_glGetPerfMonitorGroupsAMD = this->m_ptr_glGetPerfMonitorGroupsAMD;
+if(this->m_ptr_glGetPerfMonitorGroupsAMD)this->m_ptr_glGetPerfMonitorGroupsAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorGroupsAMD_profile;
+this->m_names[1290] = "glMultTransposeMatrixfARB";
+this->m_orig_glMultTransposeMatrixfARB = this->m_ptr_glMultTransposeMatrixfARB;
+if(this->m_ptr_glMultTransposeMatrixfARB)this->m_ptr_glMultTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixfARB_profile;
+this->m_names[1291] = "glVertexAttribI2ivEXT";
+this->m_orig_glVertexAttribI2ivEXT = this->m_ptr_glVertexAttribI2ivEXT;
+if(this->m_ptr_glVertexAttribI2ivEXT)this->m_ptr_glVertexAttribI2ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2ivEXT_profile;
+this->m_names[1292] = "glReplacementCodeuiColor4fNormal3fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profile;
+this->m_names[1293] = "glDeleteStatesNV";
+this->m_orig_glDeleteStatesNV = this->m_ptr_glDeleteStatesNV;
+if(this->m_ptr_glDeleteStatesNV)this->m_ptr_glDeleteStatesNV = (FunctionTable::MEMBERPFNGLDELETESTATESNVPROC)&ProfilingTableDecorator::m_glDeleteStatesNV_profile;
+this->m_names[1294] = "glGetBufferParameteri64v";
+this->m_orig_glGetBufferParameteri64v = this->m_ptr_glGetBufferParameteri64v;
+if(this->m_ptr_glGetBufferParameteri64v)this->m_ptr_glGetBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC)&ProfilingTableDecorator::m_glGetBufferParameteri64v_profile;
+this->m_names[1295] = "glProgramUniform4dv";
+this->m_orig_glProgramUniform4dv = this->m_ptr_glProgramUniform4dv;
+if(this->m_ptr_glProgramUniform4dv)this->m_ptr_glProgramUniform4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC)&ProfilingTableDecorator::m_glProgramUniform4dv_profile;
+this->m_names[1296] = "glEdgeFlagPointerEXT";
+this->m_orig_glEdgeFlagPointerEXT = this->m_ptr_glEdgeFlagPointerEXT;
+if(this->m_ptr_glEdgeFlagPointerEXT)this->m_ptr_glEdgeFlagPointerEXT = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC)&ProfilingTableDecorator::m_glEdgeFlagPointerEXT_profile;
+this->m_names[1297] = "glVideoCaptureStreamParameterivNV";
+this->m_orig_glVideoCaptureStreamParameterivNV = this->m_ptr_glVideoCaptureStreamParameterivNV;
+if(this->m_ptr_glVideoCaptureStreamParameterivNV)this->m_ptr_glVideoCaptureStreamParameterivNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterivNV_profile;
+this->m_names[1298] = "glVertexStream4iATI";
+this->m_orig_glVertexStream4iATI = this->m_ptr_glVertexStream4iATI;
+if(this->m_ptr_glVertexStream4iATI)this->m_ptr_glVertexStream4iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC)&ProfilingTableDecorator::m_glVertexStream4iATI_profile;
+this->m_names[1299] = "glVDPAUFiniNV";
+this->m_orig_glVDPAUFiniNV = this->m_ptr_glVDPAUFiniNV;
+if(this->m_ptr_glVDPAUFiniNV)this->m_ptr_glVDPAUFiniNV = (FunctionTable::MEMBERPFNGLVDPAUFININVPROC)&ProfilingTableDecorator::m_glVDPAUFiniNV_profile;
+this->m_names[1300] = "glMakeBufferNonResidentNV";
+this->m_orig_glMakeBufferNonResidentNV = this->m_ptr_glMakeBufferNonResidentNV;
+if(this->m_ptr_glMakeBufferNonResidentNV)this->m_ptr_glMakeBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeBufferNonResidentNV_profile;
+this->m_names[1301] = "glUniform1ui64ARB";
+this->m_orig_glUniform1ui64ARB = this->m_ptr_glUniform1ui64ARB;
+if(this->m_ptr_glUniform1ui64ARB)this->m_ptr_glUniform1ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC)&ProfilingTableDecorator::m_glUniform1ui64ARB_profile;
+this->m_names[1302] = "glStencilStrokePathNV";
+this->m_orig_glStencilStrokePathNV = this->m_ptr_glStencilStrokePathNV;
+if(this->m_ptr_glStencilStrokePathNV)this->m_ptr_glStencilStrokePathNV = (FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glStencilStrokePathNV_profile;
+this->m_names[1303] = "glVariantuivEXT";
+this->m_orig_glVariantuivEXT = this->m_ptr_glVariantuivEXT;
+if(this->m_ptr_glVariantuivEXT)this->m_ptr_glVariantuivEXT = (FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC)&ProfilingTableDecorator::m_glVariantuivEXT_profile;
+this->m_names[1304] = "glCopyTexSubImage3DEXT";
+this->m_orig_glCopyTexSubImage3DEXT = this->m_ptr_glCopyTexSubImage3DEXT;
+if(this->m_ptr_glCopyTexSubImage3DEXT)this->m_ptr_glCopyTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage3DEXT_profile;
+this->m_names[1305] = "glSpriteParameteriSGIX";
+this->m_orig_glSpriteParameteriSGIX = this->m_ptr_glSpriteParameteriSGIX;
+if(this->m_ptr_glSpriteParameteriSGIX)this->m_ptr_glSpriteParameteriSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC)&ProfilingTableDecorator::m_glSpriteParameteriSGIX_profile;
+this->m_names[1306] = "glMultiTexCoord1sARB";
+this->m_orig_glMultiTexCoord1sARB = this->m_ptr_glMultiTexCoord1sARB;
+if(this->m_ptr_glMultiTexCoord1sARB)this->m_ptr_glMultiTexCoord1sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1sARB_profile;
+this->m_names[1307] = "glConvolutionParameterfv";
+this->m_orig_glConvolutionParameterfv = this->m_ptr_glConvolutionParameterfv;
+if(this->m_ptr_glConvolutionParameterfv)this->m_ptr_glConvolutionParameterfv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC)&ProfilingTableDecorator::m_glConvolutionParameterfv_profile;
+this->m_names[1308] = "glMakeTextureHandleResidentNV";
+this->m_orig_glMakeTextureHandleResidentNV = this->m_ptr_glMakeTextureHandleResidentNV;
+if(this->m_ptr_glMakeTextureHandleResidentNV)this->m_ptr_glMakeTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeTextureHandleResidentNV_profile;
+this->m_names[1309] = "glMultMatrixxOES";
+this->m_orig_glMultMatrixxOES = this->m_ptr_glMultMatrixxOES;
+if(this->m_ptr_glMultMatrixxOES)this->m_ptr_glMultMatrixxOES = (FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC)&ProfilingTableDecorator::m_glMultMatrixxOES_profile;
+this->m_names[1310] = "glTextureNormalEXT";
+this->m_orig_glTextureNormalEXT = this->m_ptr_glTextureNormalEXT;
+if(this->m_ptr_glTextureNormalEXT)this->m_ptr_glTextureNormalEXT = (FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC)&ProfilingTableDecorator::m_glTextureNormalEXT_profile;
+this->m_names[1311] = "glGetQueryivARB";
+this->m_orig_glGetQueryivARB = this->m_ptr_glGetQueryivARB;
+if(this->m_ptr_glGetQueryivARB)this->m_ptr_glGetQueryivARB = (FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC)&ProfilingTableDecorator::m_glGetQueryivARB_profile;
+this->m_names[1312] = "glCompressedMultiTexImage3DEXT";
+this->m_orig_glCompressedMultiTexImage3DEXT = this->m_ptr_glCompressedMultiTexImage3DEXT;
+if(this->m_ptr_glCompressedMultiTexImage3DEXT)this->m_ptr_glCompressedMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage3DEXT_profile;
+this->m_names[1313] = "glGetInstrumentsSGIX";
+this->m_orig_glGetInstrumentsSGIX = this->m_ptr_glGetInstrumentsSGIX;
+if(this->m_ptr_glGetInstrumentsSGIX)this->m_ptr_glGetInstrumentsSGIX = (FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glGetInstrumentsSGIX_profile;
+this->m_names[1314] = "glProgramUniformMatrix4x3fvEXT";
+this->m_orig_glProgramUniformMatrix4x3fvEXT = this->m_ptr_glProgramUniformMatrix4x3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x3fvEXT)this->m_ptr_glProgramUniformMatrix4x3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3fvEXT_profile;
+this->m_names[1315] = "glPointParameterf";
+this->m_orig_glPointParameterf = this->m_ptr_glPointParameterf;
+if(this->m_ptr_glPointParameterf)this->m_ptr_glPointParameterf = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC)&ProfilingTableDecorator::m_glPointParameterf_profile;
+this->m_names[1316] = "glProgramUniform3dEXT";
+this->m_orig_glProgramUniform3dEXT = this->m_ptr_glProgramUniform3dEXT;
+if(this->m_ptr_glProgramUniform3dEXT)this->m_ptr_glProgramUniform3dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3dEXT_profile;
+this->m_names[1317] = "glMultiTexCoord2hNV";
+this->m_orig_glMultiTexCoord2hNV = this->m_ptr_glMultiTexCoord2hNV;
+if(this->m_ptr_glMultiTexCoord2hNV)this->m_ptr_glMultiTexCoord2hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2hNV_profile;
+this->m_names[1318] = "glGetConvolutionFilterEXT";
+this->m_orig_glGetConvolutionFilterEXT = this->m_ptr_glGetConvolutionFilterEXT;
+if(this->m_ptr_glGetConvolutionFilterEXT)this->m_ptr_glGetConvolutionFilterEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC)&ProfilingTableDecorator::m_glGetConvolutionFilterEXT_profile;
+this->m_names[1319] = "glVertexAttrib2hNV";
+this->m_orig_glVertexAttrib2hNV = this->m_ptr_glVertexAttrib2hNV;
+if(this->m_ptr_glVertexAttrib2hNV)this->m_ptr_glVertexAttrib2hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2hNV_profile;
+this->m_names[1320] = "glCurrentPaletteMatrixARB";
+this->m_orig_glCurrentPaletteMatrixARB = this->m_ptr_glCurrentPaletteMatrixARB;
+if(this->m_ptr_glCurrentPaletteMatrixARB)this->m_ptr_glCurrentPaletteMatrixARB = (FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC)&ProfilingTableDecorator::m_glCurrentPaletteMatrixARB_profile;
+this->m_names[1321] = "glFogxvOES";
+this->m_orig_glFogxvOES = this->m_ptr_glFogxvOES;
+if(this->m_ptr_glFogxvOES)this->m_ptr_glFogxvOES = (FunctionTable::MEMBERPFNGLFOGXVOESPROC)&ProfilingTableDecorator::m_glFogxvOES_profile;
+this->m_names[1322] = "glCreateRenderbuffers";
+this->m_orig_glCreateRenderbuffers = this->m_ptr_glCreateRenderbuffers;
+if(this->m_ptr_glCreateRenderbuffers)this->m_ptr_glCreateRenderbuffers = (FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC)&ProfilingTableDecorator::m_glCreateRenderbuffers_profile;
+this->m_names[1323] = "glVertexAttrib4Nusv";
+this->m_orig_glVertexAttrib4Nusv = this->m_ptr_glVertexAttrib4Nusv;
+if(this->m_ptr_glVertexAttrib4Nusv)this->m_ptr_glVertexAttrib4Nusv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nusv_profile;
+this->m_names[1324] = "glCombinerInputNV";
+this->m_orig_glCombinerInputNV = this->m_ptr_glCombinerInputNV;
+if(this->m_ptr_glCombinerInputNV)this->m_ptr_glCombinerInputNV = (FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC)&ProfilingTableDecorator::m_glCombinerInputNV_profile;
+this->m_names[1325] = "glDepthFunc";
+this->m_orig_glDepthFunc = this->m_ptr_glDepthFunc;
+if(this->m_ptr_glDepthFunc)this->m_ptr_glDepthFunc = (FunctionTable::MEMBERPFNGLDEPTHFUNCPROC)&ProfilingTableDecorator::m_glDepthFunc_profile;
+this->m_names[1326] = "glWindowPos4fMESA";
+this->m_orig_glWindowPos4fMESA = this->m_ptr_glWindowPos4fMESA;
+if(this->m_ptr_glWindowPos4fMESA)this->m_ptr_glWindowPos4fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC)&ProfilingTableDecorator::m_glWindowPos4fMESA_profile;
+this->m_names[1327] = "glEnableClientStateIndexedEXT";
+this->m_orig_glEnableClientStateIndexedEXT = this->m_ptr_glEnableClientStateIndexedEXT;
+if(this->m_ptr_glEnableClientStateIndexedEXT)this->m_ptr_glEnableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glEnableClientStateIndexedEXT_profile;
+this->m_names[1328] = "glTexCoord4iv";
+this->m_orig_glTexCoord4iv = this->m_ptr_glTexCoord4iv;
+if(this->m_ptr_glTexCoord4iv)this->m_ptr_glTexCoord4iv = (FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC)&ProfilingTableDecorator::m_glTexCoord4iv_profile;
+this->m_names[1329] = "glProgramUniform4i64ARB";
+this->m_orig_glProgramUniform4i64ARB = this->m_ptr_glProgramUniform4i64ARB;
+if(this->m_ptr_glProgramUniform4i64ARB)this->m_ptr_glProgramUniform4i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform4i64ARB_profile;
+this->m_names[1330] = "glBlendFunci";
+this->m_orig_glBlendFunci = this->m_ptr_glBlendFunci;
+if(this->m_ptr_glBlendFunci)this->m_ptr_glBlendFunci = (FunctionTable::MEMBERPFNGLBLENDFUNCIPROC)&ProfilingTableDecorator::m_glBlendFunci_profile;
+this->m_names[1331] = "glResolveDepthValuesNV";
+this->m_orig_glResolveDepthValuesNV = this->m_ptr_glResolveDepthValuesNV;
+if(this->m_ptr_glResolveDepthValuesNV)this->m_ptr_glResolveDepthValuesNV = (FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC)&ProfilingTableDecorator::m_glResolveDepthValuesNV_profile;
+this->m_names[1332] = "glTextureColorMaskSGIS";
+this->m_orig_glTextureColorMaskSGIS = this->m_ptr_glTextureColorMaskSGIS;
+if(this->m_ptr_glTextureColorMaskSGIS)this->m_ptr_glTextureColorMaskSGIS = (FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC)&ProfilingTableDecorator::m_glTextureColorMaskSGIS_profile;
+this->m_names[1333] = "glCreateShaderProgramEXT";
+this->m_orig_glCreateShaderProgramEXT = this->m_ptr_glCreateShaderProgramEXT;
+if(this->m_ptr_glCreateShaderProgramEXT)this->m_ptr_glCreateShaderProgramEXT = (FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC)&ProfilingTableDecorator::m_glCreateShaderProgramEXT_profile;
+this->m_names[1334] = "glBufferStorage";
+this->m_orig_glBufferStorage = this->m_ptr_glBufferStorage;
+if(this->m_ptr_glBufferStorage)this->m_ptr_glBufferStorage = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glBufferStorage_profile;
+this->m_names[1335] = "glMakeNamedBufferNonResidentNV";
+this->m_orig_glMakeNamedBufferNonResidentNV = this->m_ptr_glMakeNamedBufferNonResidentNV;
+if(this->m_ptr_glMakeNamedBufferNonResidentNV)this->m_ptr_glMakeNamedBufferNonResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeNamedBufferNonResidentNV_profile;
+this->m_names[1336] = "glRenderbufferStorageMultisampleEXT";
+this->m_orig_glRenderbufferStorageMultisampleEXT = this->m_ptr_glRenderbufferStorageMultisampleEXT;
+if(this->m_ptr_glRenderbufferStorageMultisampleEXT)this->m_ptr_glRenderbufferStorageMultisampleEXT = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisampleEXT_profile;
+this->m_names[1337] = "glGetFloati_v";
+this->m_orig_glGetFloati_v = this->m_ptr_glGetFloati_v;
+if(this->m_ptr_glGetFloati_v)this->m_ptr_glGetFloati_v = (FunctionTable::MEMBERPFNGLGETFLOATI_VPROC)&ProfilingTableDecorator::m_glGetFloati_v_profile;
+this->m_names[1338] = "glUniform2ui64ARB";
+this->m_orig_glUniform2ui64ARB = this->m_ptr_glUniform2ui64ARB;
+if(this->m_ptr_glUniform2ui64ARB)this->m_ptr_glUniform2ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC)&ProfilingTableDecorator::m_glUniform2ui64ARB_profile;
+this->m_names[1339] = "glVertex3fv";
+this->m_orig_glVertex3fv = this->m_ptr_glVertex3fv;
+if(this->m_ptr_glVertex3fv)this->m_ptr_glVertex3fv = (FunctionTable::MEMBERPFNGLVERTEX3FVPROC)&ProfilingTableDecorator::m_glVertex3fv_profile;
+this->m_names[1340] = "glGetUniformLocation";
+this->m_orig_glGetUniformLocation = this->m_ptr_glGetUniformLocation;
+if(this->m_ptr_glGetUniformLocation)this->m_ptr_glGetUniformLocation = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC)&ProfilingTableDecorator::m_glGetUniformLocation_profile;
+this->m_names[1341] = "glVertexStream1svATI";
+this->m_orig_glVertexStream1svATI = this->m_ptr_glVertexStream1svATI;
+if(this->m_ptr_glVertexStream1svATI)this->m_ptr_glVertexStream1svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC)&ProfilingTableDecorator::m_glVertexStream1svATI_profile;
+this->m_names[1342] = "glVertexStream3fATI";
+this->m_orig_glVertexStream3fATI = this->m_ptr_glVertexStream3fATI;
+if(this->m_ptr_glVertexStream3fATI)this->m_ptr_glVertexStream3fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC)&ProfilingTableDecorator::m_glVertexStream3fATI_profile;
+this->m_names[1343] = "glNamedFramebufferDrawBuffers";
+this->m_orig_glNamedFramebufferDrawBuffers = this->m_ptr_glNamedFramebufferDrawBuffers;
+if(this->m_ptr_glNamedFramebufferDrawBuffers)this->m_ptr_glNamedFramebufferDrawBuffers = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)&ProfilingTableDecorator::m_glNamedFramebufferDrawBuffers_profile;
+this->m_names[1344] = "glUniform2ui64vNV";
+this->m_orig_glUniform2ui64vNV = this->m_ptr_glUniform2ui64vNV;
+if(this->m_ptr_glUniform2ui64vNV)this->m_ptr_glUniform2ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC)&ProfilingTableDecorator::m_glUniform2ui64vNV_profile;
+this->m_names[1345] = "glTexCoordPointervINTEL";
+this->m_orig_glTexCoordPointervINTEL = this->m_ptr_glTexCoordPointervINTEL;
+if(this->m_ptr_glTexCoordPointervINTEL)this->m_ptr_glTexCoordPointervINTEL = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC)&ProfilingTableDecorator::m_glTexCoordPointervINTEL_profile;
+this->m_names[1346] = "glUniform4fv";
+this->m_orig_glUniform4fv = this->m_ptr_glUniform4fv;
+if(this->m_ptr_glUniform4fv)this->m_ptr_glUniform4fv = (FunctionTable::MEMBERPFNGLUNIFORM4FVPROC)&ProfilingTableDecorator::m_glUniform4fv_profile;
+this->m_names[1347] = "glNormalPointerEXT";
+this->m_orig_glNormalPointerEXT = this->m_ptr_glNormalPointerEXT;
+if(this->m_ptr_glNormalPointerEXT)this->m_ptr_glNormalPointerEXT = (FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC)&ProfilingTableDecorator::m_glNormalPointerEXT_profile;
+this->m_names[1348] = "glVertexAttrib4hNV";
+this->m_orig_glVertexAttrib4hNV = this->m_ptr_glVertexAttrib4hNV;
+if(this->m_ptr_glVertexAttrib4hNV)this->m_ptr_glVertexAttrib4hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4hNV_profile;
+this->m_names[1349] = "glNormal3f";
+this->m_orig_glNormal3f = this->m_ptr_glNormal3f;
+if(this->m_ptr_glNormal3f)this->m_ptr_glNormal3f = (FunctionTable::MEMBERPFNGLNORMAL3FPROC)&ProfilingTableDecorator::m_glNormal3f_profile;
+this->m_names[1350] = "glVertexStream2iATI";
+this->m_orig_glVertexStream2iATI = this->m_ptr_glVertexStream2iATI;
+if(this->m_ptr_glVertexStream2iATI)this->m_ptr_glVertexStream2iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC)&ProfilingTableDecorator::m_glVertexStream2iATI_profile;
+this->m_names[1351] = "glVertexAttribP4uiv";
+this->m_orig_glVertexAttribP4uiv = this->m_ptr_glVertexAttribP4uiv;
+if(this->m_ptr_glVertexAttribP4uiv)this->m_ptr_glVertexAttribP4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP4uiv_profile;
+this->m_names[1352] = "glCompressedTextureSubImage3D";
+this->m_orig_glCompressedTextureSubImage3D = this->m_ptr_glCompressedTextureSubImage3D;
+if(this->m_ptr_glCompressedTextureSubImage3D)this->m_ptr_glCompressedTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage3D_profile;
+this->m_names[1353] = "glAsyncMarkerSGIX";
+this->m_orig_glAsyncMarkerSGIX = this->m_ptr_glAsyncMarkerSGIX;
+if(this->m_ptr_glAsyncMarkerSGIX)this->m_ptr_glAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC)&ProfilingTableDecorator::m_glAsyncMarkerSGIX_profile;
+this->m_names[1354] = "glTextureStorageSparseAMD";
+this->m_orig_glTextureStorageSparseAMD = this->m_ptr_glTextureStorageSparseAMD;
+if(this->m_ptr_glTextureStorageSparseAMD)this->m_ptr_glTextureStorageSparseAMD = (FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC)&ProfilingTableDecorator::m_glTextureStorageSparseAMD_profile;
+this->m_names[1355] = "glGetConvolutionParameterivEXT";
+this->m_orig_glGetConvolutionParameterivEXT = this->m_ptr_glGetConvolutionParameterivEXT;
+if(this->m_ptr_glGetConvolutionParameterivEXT)this->m_ptr_glGetConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterivEXT_profile;
+this->m_names[1356] = "glEndPerfQueryINTEL";
+this->m_orig_glEndPerfQueryINTEL = this->m_ptr_glEndPerfQueryINTEL;
+if(this->m_ptr_glEndPerfQueryINTEL)this->m_ptr_glEndPerfQueryINTEL = (FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC)&ProfilingTableDecorator::m_glEndPerfQueryINTEL_profile;
+this->m_names[1357] = "glFragmentLightModeliSGIX";
+this->m_orig_glFragmentLightModeliSGIX = this->m_ptr_glFragmentLightModeliSGIX;
+if(this->m_ptr_glFragmentLightModeliSGIX)this->m_ptr_glFragmentLightModeliSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModeliSGIX_profile;
+this->m_names[1358] = "glPrioritizeTexturesEXT";
+this->m_orig_glPrioritizeTexturesEXT = this->m_ptr_glPrioritizeTexturesEXT;
+if(this->m_ptr_glPrioritizeTexturesEXT)this->m_ptr_glPrioritizeTexturesEXT = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC)&ProfilingTableDecorator::m_glPrioritizeTexturesEXT_profile;
+this->m_names[1359] = "glEndConditionalRender";
+this->m_orig_glEndConditionalRender = this->m_ptr_glEndConditionalRender;
+if(this->m_ptr_glEndConditionalRender)this->m_ptr_glEndConditionalRender = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC)&ProfilingTableDecorator::m_glEndConditionalRender_profile;
+this->m_names[1360] = "glEnableClientState";
+this->m_orig_glEnableClientState = this->m_ptr_glEnableClientState;
+if(this->m_ptr_glEnableClientState)this->m_ptr_glEnableClientState = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC)&ProfilingTableDecorator::m_glEnableClientState_profile;
+this->m_names[1361] = "glResetHistogram";
+this->m_orig_glResetHistogram = this->m_ptr_glResetHistogram;
+if(this->m_ptr_glResetHistogram)this->m_ptr_glResetHistogram = (FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC)&ProfilingTableDecorator::m_glResetHistogram_profile;
+this->m_names[1362] = "glGetOcclusionQueryivNV";
+this->m_orig_glGetOcclusionQueryivNV = this->m_ptr_glGetOcclusionQueryivNV;
+if(this->m_ptr_glGetOcclusionQueryivNV)this->m_ptr_glGetOcclusionQueryivNV = (FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC)&ProfilingTableDecorator::m_glGetOcclusionQueryivNV_profile;
+this->m_names[1363] = "glUniform1uiEXT";
+this->m_orig_glUniform1uiEXT = this->m_ptr_glUniform1uiEXT;
+if(this->m_ptr_glUniform1uiEXT)this->m_ptr_glUniform1uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC)&ProfilingTableDecorator::m_glUniform1uiEXT_profile;
+this->m_names[1364] = "glMultiTexCoord2sv";
+this->m_orig_glMultiTexCoord2sv = this->m_ptr_glMultiTexCoord2sv;
+if(this->m_ptr_glMultiTexCoord2sv)this->m_ptr_glMultiTexCoord2sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2sv_profile;
+this->m_names[1365] = "glTexSubImage2DEXT";
+this->m_orig_glTexSubImage2DEXT = this->m_ptr_glTexSubImage2DEXT;
+if(this->m_ptr_glTexSubImage2DEXT)this->m_ptr_glTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage2DEXT_profile;
+this->m_names[1366] = "glProgramUniform2uiv";
+this->m_orig_glProgramUniform2uiv = this->m_ptr_glProgramUniform2uiv;
+if(this->m_ptr_glProgramUniform2uiv)this->m_ptr_glProgramUniform2uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC)&ProfilingTableDecorator::m_glProgramUniform2uiv_profile;
+this->m_names[1367] = "glMultiTexCoord2iARB";
+this->m_orig_glMultiTexCoord2iARB = this->m_ptr_glMultiTexCoord2iARB;
+if(this->m_ptr_glMultiTexCoord2iARB)this->m_ptr_glMultiTexCoord2iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2iARB_profile;
+this->m_names[1368] = "glGetQueryObjectuiv";
+this->m_orig_glGetQueryObjectuiv = this->m_ptr_glGetQueryObjectuiv;
+if(this->m_ptr_glGetQueryObjectuiv)this->m_ptr_glGetQueryObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC)&ProfilingTableDecorator::m_glGetQueryObjectuiv_profile;
+this->m_names[1369] = "glGenerateMultiTexMipmapEXT";
+this->m_orig_glGenerateMultiTexMipmapEXT = this->m_ptr_glGenerateMultiTexMipmapEXT;
+if(this->m_ptr_glGenerateMultiTexMipmapEXT)this->m_ptr_glGenerateMultiTexMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateMultiTexMipmapEXT_profile;
+this->m_names[1370] = "glVertexAttrib4iv";
+this->m_orig_glVertexAttrib4iv = this->m_ptr_glVertexAttrib4iv;
+if(this->m_ptr_glVertexAttrib4iv)this->m_ptr_glVertexAttrib4iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC)&ProfilingTableDecorator::m_glVertexAttrib4iv_profile;
+this->m_names[1371] = "glWindowPos3dvMESA";
+this->m_orig_glWindowPos3dvMESA = this->m_ptr_glWindowPos3dvMESA;
+if(this->m_ptr_glWindowPos3dvMESA)this->m_ptr_glWindowPos3dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3dvMESA_profile;
+this->m_names[1372] = "glLabelObjectEXT";
+this->m_orig_glLabelObjectEXT = this->m_ptr_glLabelObjectEXT;
+if(this->m_ptr_glLabelObjectEXT)this->m_ptr_glLabelObjectEXT = (FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC)&ProfilingTableDecorator::m_glLabelObjectEXT_profile;
+this->m_names[1373] = "glProgramUniform1uiv";
+this->m_orig_glProgramUniform1uiv = this->m_ptr_glProgramUniform1uiv;
+if(this->m_ptr_glProgramUniform1uiv)this->m_ptr_glProgramUniform1uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC)&ProfilingTableDecorator::m_glProgramUniform1uiv_profile;
+this->m_names[1374] = "glFramebufferTexture";
+this->m_orig_glFramebufferTexture = this->m_ptr_glFramebufferTexture;
+if(this->m_ptr_glFramebufferTexture)this->m_ptr_glFramebufferTexture = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC)&ProfilingTableDecorator::m_glFramebufferTexture_profile;
+this->m_names[1375] = "glMultiTexEnvfEXT";
+this->m_orig_glMultiTexEnvfEXT = this->m_ptr_glMultiTexEnvfEXT;
+if(this->m_ptr_glMultiTexEnvfEXT)this->m_ptr_glMultiTexEnvfEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvfEXT_profile;
+this->m_names[1376] = "glGetTexGendv";
+this->m_orig_glGetTexGendv = this->m_ptr_glGetTexGendv;
+if(this->m_ptr_glGetTexGendv)this->m_ptr_glGetTexGendv = (FunctionTable::MEMBERPFNGLGETTEXGENDVPROC)&ProfilingTableDecorator::m_glGetTexGendv_profile;
+this->m_names[1377] = "glVertex4xOES";
+this->m_orig_glVertex4xOES = this->m_ptr_glVertex4xOES;
+if(this->m_ptr_glVertex4xOES)this->m_ptr_glVertex4xOES = (FunctionTable::MEMBERPFNGLVERTEX4XOESPROC)&ProfilingTableDecorator::m_glVertex4xOES_profile;
+this->m_names[1378] = "glVertexAttribI2uivEXT";
+this->m_orig_glVertexAttribI2uivEXT = this->m_ptr_glVertexAttribI2uivEXT;
+if(this->m_ptr_glVertexAttribI2uivEXT)this->m_ptr_glVertexAttribI2uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2uivEXT_profile;
+this->m_names[1379] = "glNamedProgramLocalParameter4fvEXT";
+this->m_orig_glNamedProgramLocalParameter4fvEXT = this->m_ptr_glNamedProgramLocalParameter4fvEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4fvEXT)this->m_ptr_glNamedProgramLocalParameter4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4fvEXT_profile;
+this->m_names[1380] = "glColor3usv";
+this->m_orig_glColor3usv = this->m_ptr_glColor3usv;
+if(this->m_ptr_glColor3usv)this->m_ptr_glColor3usv = (FunctionTable::MEMBERPFNGLCOLOR3USVPROC)&ProfilingTableDecorator::m_glColor3usv_profile;
+this->m_names[1381] = "glGetPixelTransformParameterfvEXT";
+this->m_orig_glGetPixelTransformParameterfvEXT = this->m_ptr_glGetPixelTransformParameterfvEXT;
+if(this->m_ptr_glGetPixelTransformParameterfvEXT)this->m_ptr_glGetPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetPixelTransformParameterfvEXT_profile;
+this->m_names[1382] = "glIndexxvOES";
+this->m_orig_glIndexxvOES = this->m_ptr_glIndexxvOES;
+if(this->m_ptr_glIndexxvOES)this->m_ptr_glIndexxvOES = (FunctionTable::MEMBERPFNGLINDEXXVOESPROC)&ProfilingTableDecorator::m_glIndexxvOES_profile;
+this->m_names[1383] = "glDepthMask";
+this->m_orig_glDepthMask = this->m_ptr_glDepthMask;
+if(this->m_ptr_glDepthMask)this->m_ptr_glDepthMask = (FunctionTable::MEMBERPFNGLDEPTHMASKPROC)&ProfilingTableDecorator::m_glDepthMask_profile;
+this->m_names[1384] = "glProgramUniformMatrix2x4fv";
+this->m_orig_glProgramUniformMatrix2x4fv = this->m_ptr_glProgramUniformMatrix2x4fv;
+if(this->m_ptr_glProgramUniformMatrix2x4fv)this->m_ptr_glProgramUniformMatrix2x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4fv_profile;
+this->m_names[1385] = "glAreProgramsResidentNV";
+this->m_orig_glAreProgramsResidentNV = this->m_ptr_glAreProgramsResidentNV;
+if(this->m_ptr_glAreProgramsResidentNV)this->m_ptr_glAreProgramsResidentNV = (FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC)&ProfilingTableDecorator::m_glAreProgramsResidentNV_profile;
+this->m_names[1386] = "glColorTable";
+this->m_orig_glColorTable = this->m_ptr_glColorTable;
+if(this->m_ptr_glColorTable)this->m_ptr_glColorTable = (FunctionTable::MEMBERPFNGLCOLORTABLEPROC)&ProfilingTableDecorator::m_glColorTable_profile;
+this->m_names[1387] = "glBeginQueryIndexed";
+this->m_orig_glBeginQueryIndexed = this->m_ptr_glBeginQueryIndexed;
+if(this->m_ptr_glBeginQueryIndexed)this->m_ptr_glBeginQueryIndexed = (FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC)&ProfilingTableDecorator::m_glBeginQueryIndexed_profile;
+this->m_names[1388] = "glVertexStream1dvATI";
+this->m_orig_glVertexStream1dvATI = this->m_ptr_glVertexStream1dvATI;
+if(this->m_ptr_glVertexStream1dvATI)this->m_ptr_glVertexStream1dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC)&ProfilingTableDecorator::m_glVertexStream1dvATI_profile;
+this->m_names[1389] = "glGetMultiTexEnvfvEXT";
+this->m_orig_glGetMultiTexEnvfvEXT = this->m_ptr_glGetMultiTexEnvfvEXT;
+if(this->m_ptr_glGetMultiTexEnvfvEXT)this->m_ptr_glGetMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexEnvfvEXT_profile;
+this->m_names[1390] = "glDeleteFencesNV";
+this->m_orig_glDeleteFencesNV = this->m_ptr_glDeleteFencesNV;
+if(this->m_ptr_glDeleteFencesNV)this->m_ptr_glDeleteFencesNV = (FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC)&ProfilingTableDecorator::m_glDeleteFencesNV_profile;
+this->m_names[1391] = "glVertexAttribs1dvNV";
+this->m_orig_glVertexAttribs1dvNV = this->m_ptr_glVertexAttribs1dvNV;
+if(this->m_ptr_glVertexAttribs1dvNV)this->m_ptr_glVertexAttribs1dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1dvNV_profile;
+this->m_names[1392] = "glBufferStorageExternalEXT";
+this->m_orig_glBufferStorageExternalEXT = this->m_ptr_glBufferStorageExternalEXT;
+if(this->m_ptr_glBufferStorageExternalEXT)this->m_ptr_glBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC)&ProfilingTableDecorator::m_glBufferStorageExternalEXT_profile;
+this->m_names[1393] = "glVertexStream2sATI";
+this->m_orig_glVertexStream2sATI = this->m_ptr_glVertexStream2sATI;
+if(this->m_ptr_glVertexStream2sATI)this->m_ptr_glVertexStream2sATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC)&ProfilingTableDecorator::m_glVertexStream2sATI_profile;
+this->m_names[1394] = "glGetnSeparableFilterARB";
+this->m_orig_glGetnSeparableFilterARB = this->m_ptr_glGetnSeparableFilterARB;
+if(this->m_ptr_glGetnSeparableFilterARB)this->m_ptr_glGetnSeparableFilterARB = (FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC)&ProfilingTableDecorator::m_glGetnSeparableFilterARB_profile;
+this->m_names[1395] = "glProgramUniform2dv";
+this->m_orig_glProgramUniform2dv = this->m_ptr_glProgramUniform2dv;
+if(this->m_ptr_glProgramUniform2dv)this->m_ptr_glProgramUniform2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC)&ProfilingTableDecorator::m_glProgramUniform2dv_profile;
+this->m_names[1396] = "glActiveStencilFaceEXT";
+this->m_orig_glActiveStencilFaceEXT = this->m_ptr_glActiveStencilFaceEXT;
+if(this->m_ptr_glActiveStencilFaceEXT)this->m_ptr_glActiveStencilFaceEXT = (FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC)&ProfilingTableDecorator::m_glActiveStencilFaceEXT_profile;
+this->m_names[1397] = "glProgramUniform4dEXT";
+this->m_orig_glProgramUniform4dEXT = this->m_ptr_glProgramUniform4dEXT;
+if(this->m_ptr_glProgramUniform4dEXT)this->m_ptr_glProgramUniform4dEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4dEXT_profile;
+this->m_names[1398] = "glPointSizexOES";
+this->m_orig_glPointSizexOES = this->m_ptr_glPointSizexOES;
+if(this->m_ptr_glPointSizexOES)this->m_ptr_glPointSizexOES = (FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC)&ProfilingTableDecorator::m_glPointSizexOES_profile;
+this->m_names[1399] = "glRasterPos2sv";
+this->m_orig_glRasterPos2sv = this->m_ptr_glRasterPos2sv;
+if(this->m_ptr_glRasterPos2sv)this->m_ptr_glRasterPos2sv = (FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC)&ProfilingTableDecorator::m_glRasterPos2sv_profile;
+this->m_names[1400] = "glBindParameterEXT";
+this->m_orig_glBindParameterEXT = this->m_ptr_glBindParameterEXT;
+if(this->m_ptr_glBindParameterEXT)this->m_ptr_glBindParameterEXT = (FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindParameterEXT_profile;
+this->m_names[1401] = "glTexCoord1sv";
+this->m_orig_glTexCoord1sv = this->m_ptr_glTexCoord1sv;
+if(this->m_ptr_glTexCoord1sv)this->m_ptr_glTexCoord1sv = (FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC)&ProfilingTableDecorator::m_glTexCoord1sv_profile;
+this->m_names[1402] = "glBlendParameteriNV";
+this->m_orig_glBlendParameteriNV = this->m_ptr_glBlendParameteriNV;
+if(this->m_ptr_glBlendParameteriNV)this->m_ptr_glBlendParameteriNV = (FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC)&ProfilingTableDecorator::m_glBlendParameteriNV_profile;
+this->m_names[1403] = "glNamedProgramLocalParameter4dvEXT";
+this->m_orig_glNamedProgramLocalParameter4dvEXT = this->m_ptr_glNamedProgramLocalParameter4dvEXT;
+if(this->m_ptr_glNamedProgramLocalParameter4dvEXT)this->m_ptr_glNamedProgramLocalParameter4dvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameter4dvEXT_profile;
+this->m_names[1404] = "glProgramUniformHandleui64NV";
+this->m_orig_glProgramUniformHandleui64NV = this->m_ptr_glProgramUniformHandleui64NV;
+if(this->m_ptr_glProgramUniformHandleui64NV)this->m_ptr_glProgramUniformHandleui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64NV_profile;
+this->m_names[1405] = "glGetTextureParameterfvEXT";
+this->m_orig_glGetTextureParameterfvEXT = this->m_ptr_glGetTextureParameterfvEXT;
+if(this->m_ptr_glGetTextureParameterfvEXT)this->m_ptr_glGetTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterfvEXT_profile;
+this->m_names[1406] = "glGetPathMetricsNV";
+this->m_orig_glGetPathMetricsNV = this->m_ptr_glGetPathMetricsNV;
+if(this->m_ptr_glGetPathMetricsNV)this->m_ptr_glGetPathMetricsNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC)&ProfilingTableDecorator::m_glGetPathMetricsNV_profile;
+this->m_names[1407] = "glVertex2i";
+this->m_orig_glVertex2i = this->m_ptr_glVertex2i;
+if(this->m_ptr_glVertex2i)this->m_ptr_glVertex2i = (FunctionTable::MEMBERPFNGLVERTEX2IPROC)&ProfilingTableDecorator::m_glVertex2i_profile;
+this->m_names[1408] = "glNewList";
+this->m_orig_glNewList = this->m_ptr_glNewList;
+if(this->m_ptr_glNewList)this->m_ptr_glNewList = (FunctionTable::MEMBERPFNGLNEWLISTPROC)&ProfilingTableDecorator::m_glNewList_profile;
+this->m_names[1409] = "glMatrixLoad3x3fNV";
+this->m_orig_glMatrixLoad3x3fNV = this->m_ptr_glMatrixLoad3x3fNV;
+if(this->m_ptr_glMatrixLoad3x3fNV)this->m_ptr_glMatrixLoad3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixLoad3x3fNV_profile;
+this->m_names[1410] = "glMultiTexCoord2fARB";
+this->m_orig_glMultiTexCoord2fARB = this->m_ptr_glMultiTexCoord2fARB;
+if(this->m_ptr_glMultiTexCoord2fARB)this->m_ptr_glMultiTexCoord2fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fARB_profile;
+this->m_names[1411] = "glWeightdvARB";
+this->m_orig_glWeightdvARB = this->m_ptr_glWeightdvARB;
+if(this->m_ptr_glWeightdvARB)this->m_ptr_glWeightdvARB = (FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC)&ProfilingTableDecorator::m_glWeightdvARB_profile;
+this->m_names[1412] = "glIsTransformFeedbackNV";
+this->m_orig_glIsTransformFeedbackNV = this->m_ptr_glIsTransformFeedbackNV;
+if(this->m_ptr_glIsTransformFeedbackNV)this->m_ptr_glIsTransformFeedbackNV = (FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glIsTransformFeedbackNV_profile;
+this->m_names[1413] = "glVertexAttribDivisorARB";
+this->m_orig_glVertexAttribDivisorARB = this->m_ptr_glVertexAttribDivisorARB;
+if(this->m_ptr_glVertexAttribDivisorARB)this->m_ptr_glVertexAttribDivisorARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC)&ProfilingTableDecorator::m_glVertexAttribDivisorARB_profile;
+this->m_names[1414] = "glSecondaryColorP3uiv";
+this->m_orig_glSecondaryColorP3uiv = this->m_ptr_glSecondaryColorP3uiv;
+if(this->m_ptr_glSecondaryColorP3uiv)this->m_ptr_glSecondaryColorP3uiv = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC)&ProfilingTableDecorator::m_glSecondaryColorP3uiv_profile;
+this->m_names[1415] = "glGetnCompressedTexImageARB";
+this->m_orig_glGetnCompressedTexImageARB = this->m_ptr_glGetnCompressedTexImageARB;
+if(this->m_ptr_glGetnCompressedTexImageARB)this->m_ptr_glGetnCompressedTexImageARB = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)&ProfilingTableDecorator::m_glGetnCompressedTexImageARB_profile;
+this->m_names[1416] = "glGetIntegerv";
+this->m_orig_glGetIntegerv = this->m_ptr_glGetIntegerv;
+if(this->m_ptr_glGetIntegerv)this->m_ptr_glGetIntegerv = (FunctionTable::MEMBERPFNGLGETINTEGERVPROC)&ProfilingTableDecorator::m_glGetIntegerv_profile;
+this->m_names[1417] = "glMatrixLoaddEXT";
+this->m_orig_glMatrixLoaddEXT = this->m_ptr_glMatrixLoaddEXT;
+if(this->m_ptr_glMatrixLoaddEXT)this->m_ptr_glMatrixLoaddEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC)&ProfilingTableDecorator::m_glMatrixLoaddEXT_profile;
+this->m_names[1418] = "glGetPathLengthNV";
+this->m_orig_glGetPathLengthNV = this->m_ptr_glGetPathLengthNV;
+if(this->m_ptr_glGetPathLengthNV)this->m_ptr_glGetPathLengthNV = (FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC)&ProfilingTableDecorator::m_glGetPathLengthNV_profile;
+this->m_names[1419] = "glProgramUniformMatrix3dv";
+this->m_orig_glProgramUniformMatrix3dv = this->m_ptr_glProgramUniformMatrix3dv;
+if(this->m_ptr_glProgramUniformMatrix3dv)this->m_ptr_glProgramUniformMatrix3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3dv_profile;
+this->m_names[1420] = "glUniform4i64NV";
+this->m_orig_glUniform4i64NV = this->m_ptr_glUniform4i64NV;
+if(this->m_ptr_glUniform4i64NV)this->m_ptr_glUniform4i64NV = (FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC)&ProfilingTableDecorator::m_glUniform4i64NV_profile;
+this->m_names[1421] = "glGetHistogramEXT";
+this->m_orig_glGetHistogramEXT = this->m_ptr_glGetHistogramEXT;
+if(this->m_ptr_glGetHistogramEXT)this->m_ptr_glGetHistogramEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC)&ProfilingTableDecorator::m_glGetHistogramEXT_profile;
+this->m_names[1422] = "glVertexAttrib4NuivARB";
+this->m_orig_glVertexAttrib4NuivARB = this->m_ptr_glVertexAttrib4NuivARB;
+if(this->m_ptr_glVertexAttrib4NuivARB)this->m_ptr_glVertexAttrib4NuivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NuivARB_profile;
+this->m_names[1423] = "glMapGrid2xOES";
+this->m_orig_glMapGrid2xOES = this->m_ptr_glMapGrid2xOES;
+if(this->m_ptr_glMapGrid2xOES)this->m_ptr_glMapGrid2xOES = (FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC)&ProfilingTableDecorator::m_glMapGrid2xOES_profile;
+this->m_names[1424] = "glTexImage2D";
+this->m_orig_glTexImage2D = this->m_ptr_glTexImage2D;
+if(this->m_ptr_glTexImage2D)this->m_ptr_glTexImage2D = (FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glTexImage2D_profile;
+this->m_names[1425] = "glWindowPos2fvARB";
+this->m_orig_glWindowPos2fvARB = this->m_ptr_glWindowPos2fvARB;
+if(this->m_ptr_glWindowPos2fvARB)this->m_ptr_glWindowPos2fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC)&ProfilingTableDecorator::m_glWindowPos2fvARB_profile;
+this->m_names[1426] = "glEnableIndexedEXT";
+this->m_orig_glEnableIndexedEXT = this->m_ptr_glEnableIndexedEXT;
+if(this->m_ptr_glEnableIndexedEXT)this->m_ptr_glEnableIndexedEXT = (FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glEnableIndexedEXT_profile;
+this->m_names[1427] = "glTexCoord1bvOES";
+this->m_orig_glTexCoord1bvOES = this->m_ptr_glTexCoord1bvOES;
+if(this->m_ptr_glTexCoord1bvOES)this->m_ptr_glTexCoord1bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC)&ProfilingTableDecorator::m_glTexCoord1bvOES_profile;
+this->m_names[1428] = "glDrawPixels";
+this->m_orig_glDrawPixels = this->m_ptr_glDrawPixels;
+if(this->m_ptr_glDrawPixels)this->m_ptr_glDrawPixels = (FunctionTable::MEMBERPFNGLDRAWPIXELSPROC)&ProfilingTableDecorator::m_glDrawPixels_profile;
+this->m_names[1429] = "glMultMatrixd";
+this->m_orig_glMultMatrixd = this->m_ptr_glMultMatrixd;
+if(this->m_ptr_glMultMatrixd)this->m_ptr_glMultMatrixd = (FunctionTable::MEMBERPFNGLMULTMATRIXDPROC)&ProfilingTableDecorator::m_glMultMatrixd_profile;
+this->m_names[1430] = "glMultMatrixf";
+this->m_orig_glMultMatrixf = this->m_ptr_glMultMatrixf;
+if(this->m_ptr_glMultMatrixf)this->m_ptr_glMultMatrixf = (FunctionTable::MEMBERPFNGLMULTMATRIXFPROC)&ProfilingTableDecorator::m_glMultMatrixf_profile;
+this->m_names[1431] = "glReplacementCodePointerSUN";
+this->m_orig_glReplacementCodePointerSUN = this->m_ptr_glReplacementCodePointerSUN;
+if(this->m_ptr_glReplacementCodePointerSUN)this->m_ptr_glReplacementCodePointerSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC)&ProfilingTableDecorator::m_glReplacementCodePointerSUN_profile;
+this->m_names[1432] = "glLoadTransposeMatrixdARB";
+this->m_orig_glLoadTransposeMatrixdARB = this->m_ptr_glLoadTransposeMatrixdARB;
+if(this->m_ptr_glLoadTransposeMatrixdARB)this->m_ptr_glLoadTransposeMatrixdARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixdARB_profile;
+this->m_names[1433] = "glVertexAttrib4Nubv";
+this->m_orig_glVertexAttrib4Nubv = this->m_ptr_glVertexAttrib4Nubv;
+if(this->m_ptr_glVertexAttrib4Nubv)this->m_ptr_glVertexAttrib4Nubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nubv_profile;
+this->m_names[1434] = "glVertexArrayVertexAttribIOffsetEXT";
+this->m_orig_glVertexArrayVertexAttribIOffsetEXT = this->m_ptr_glVertexArrayVertexAttribIOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexAttribIOffsetEXT)this->m_ptr_glVertexArrayVertexAttribIOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribIOffsetEXT_profile;
+this->m_names[1435] = "glCompileShaderARB";
+this->m_orig_glCompileShaderARB = this->m_ptr_glCompileShaderARB;
+if(this->m_ptr_glCompileShaderARB)this->m_ptr_glCompileShaderARB = (FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC)&ProfilingTableDecorator::m_glCompileShaderARB_profile;
+this->m_names[1436] = "glWindowPos3dMESA";
+this->m_orig_glWindowPos3dMESA = this->m_ptr_glWindowPos3dMESA;
+if(this->m_ptr_glWindowPos3dMESA)this->m_ptr_glWindowPos3dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC)&ProfilingTableDecorator::m_glWindowPos3dMESA_profile;
+this->m_names[1437] = "glNormalStream3fvATI";
+this->m_orig_glNormalStream3fvATI = this->m_ptr_glNormalStream3fvATI;
+if(this->m_ptr_glNormalStream3fvATI)this->m_ptr_glNormalStream3fvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC)&ProfilingTableDecorator::m_glNormalStream3fvATI_profile;
+this->m_names[1438] = "glColor4usv";
+this->m_orig_glColor4usv = this->m_ptr_glColor4usv;
+if(this->m_ptr_glColor4usv)this->m_ptr_glColor4usv = (FunctionTable::MEMBERPFNGLCOLOR4USVPROC)&ProfilingTableDecorator::m_glColor4usv_profile;
+this->m_names[1439] = "glMapGrid1f";
+this->m_orig_glMapGrid1f = this->m_ptr_glMapGrid1f;
+if(this->m_ptr_glMapGrid1f)this->m_ptr_glMapGrid1f = (FunctionTable::MEMBERPFNGLMAPGRID1FPROC)&ProfilingTableDecorator::m_glMapGrid1f_profile;
+this->m_names[1440] = "glPolygonStipple";
+this->m_orig_glPolygonStipple = this->m_ptr_glPolygonStipple;
+if(this->m_ptr_glPolygonStipple)this->m_ptr_glPolygonStipple = (FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glPolygonStipple_profile;
+this->m_names[1441] = "glUniform4ui64ARB";
+this->m_orig_glUniform4ui64ARB = this->m_ptr_glUniform4ui64ARB;
+if(this->m_ptr_glUniform4ui64ARB)this->m_ptr_glUniform4ui64ARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC)&ProfilingTableDecorator::m_glUniform4ui64ARB_profile;
+this->m_names[1442] = "glTextureRenderbufferEXT";
+this->m_orig_glTextureRenderbufferEXT = this->m_ptr_glTextureRenderbufferEXT;
+if(this->m_ptr_glTextureRenderbufferEXT)this->m_ptr_glTextureRenderbufferEXT = (FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glTextureRenderbufferEXT_profile;
+this->m_names[1443] = "glGetSubroutineUniformLocation";
+this->m_orig_glGetSubroutineUniformLocation = this->m_ptr_glGetSubroutineUniformLocation;
+if(this->m_ptr_glGetSubroutineUniformLocation)this->m_ptr_glGetSubroutineUniformLocation = (FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)&ProfilingTableDecorator::m_glGetSubroutineUniformLocation_profile;
+this->m_names[1444] = "glGetFramebufferParameteriv";
+this->m_orig_glGetFramebufferParameteriv = this->m_ptr_glGetFramebufferParameteriv;
+if(this->m_ptr_glGetFramebufferParameteriv)this->m_ptr_glGetFramebufferParameteriv = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetFramebufferParameteriv_profile;
+this->m_names[1445] = "glPixelMapusv";
+this->m_orig_glPixelMapusv = this->m_ptr_glPixelMapusv;
+if(this->m_ptr_glPixelMapusv)this->m_ptr_glPixelMapusv = (FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glPixelMapusv_profile;
+this->m_names[1446] = "glGetSamplerParameteriv";
+this->m_orig_glGetSamplerParameteriv = this->m_ptr_glGetSamplerParameteriv;
+if(this->m_ptr_glGetSamplerParameteriv)this->m_ptr_glGetSamplerParameteriv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameteriv_profile;
+this->m_names[1447] = "glVertexStream2fvATI";
+this->m_orig_glVertexStream2fvATI = this->m_ptr_glVertexStream2fvATI;
+if(this->m_ptr_glVertexStream2fvATI)this->m_ptr_glVertexStream2fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC)&ProfilingTableDecorator::m_glVertexStream2fvATI_profile;
+this->m_names[1448] = "glProgramStringARB";
+this->m_orig_glProgramStringARB = this->m_ptr_glProgramStringARB;
+if(this->m_ptr_glProgramStringARB)this->m_ptr_glProgramStringARB = (FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC)&ProfilingTableDecorator::m_glProgramStringARB_profile;
+this->m_names[1449] = "glProgramUniformMatrix3dvEXT";
+this->m_orig_glProgramUniformMatrix3dvEXT = this->m_ptr_glProgramUniformMatrix3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3dvEXT)this->m_ptr_glProgramUniformMatrix3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3dvEXT_profile;
+this->m_names[1450] = "glSeparableFilter2D";
+this->m_orig_glSeparableFilter2D = this->m_ptr_glSeparableFilter2D;
+if(this->m_ptr_glSeparableFilter2D)this->m_ptr_glSeparableFilter2D = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC)&ProfilingTableDecorator::m_glSeparableFilter2D_profile;
+this->m_names[1451] = "glVertexAttribI1uiv";
+this->m_orig_glVertexAttribI1uiv = this->m_ptr_glVertexAttribI1uiv;
+if(this->m_ptr_glVertexAttribI1uiv)this->m_ptr_glVertexAttribI1uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI1uiv_profile;
+this->m_names[1452] = "glLGPUCopyImageSubDataNVX";
+this->m_orig_glLGPUCopyImageSubDataNVX = this->m_ptr_glLGPUCopyImageSubDataNVX;
+if(this->m_ptr_glLGPUCopyImageSubDataNVX)this->m_ptr_glLGPUCopyImageSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC)&ProfilingTableDecorator::m_glLGPUCopyImageSubDataNVX_profile;
+this->m_names[1453] = "glTexStorage2D";
+this->m_orig_glTexStorage2D = this->m_ptr_glTexStorage2D;
+if(this->m_ptr_glTexStorage2D)this->m_ptr_glTexStorage2D = (FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC)&ProfilingTableDecorator::m_glTexStorage2D_profile;
+this->m_names[1454] = "glColor3fv";
+this->m_orig_glColor3fv = this->m_ptr_glColor3fv;
+if(this->m_ptr_glColor3fv)this->m_ptr_glColor3fv = (FunctionTable::MEMBERPFNGLCOLOR3FVPROC)&ProfilingTableDecorator::m_glColor3fv_profile;
+this->m_names[1455] = "glGetMultiTexGendvEXT";
+this->m_orig_glGetMultiTexGendvEXT = this->m_ptr_glGetMultiTexGendvEXT;
+if(this->m_ptr_glGetMultiTexGendvEXT)this->m_ptr_glGetMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGendvEXT_profile;
+this->m_names[1456] = "glVertexAttribL4dvEXT";
+this->m_orig_glVertexAttribL4dvEXT = this->m_ptr_glVertexAttribL4dvEXT;
+if(this->m_ptr_glVertexAttribL4dvEXT)this->m_ptr_glVertexAttribL4dvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL4dvEXT_profile;
+this->m_names[1457] = "glGetActiveUniform";
+this->m_orig_glGetActiveUniform = this->m_ptr_glGetActiveUniform;
+if(this->m_ptr_glGetActiveUniform)this->m_ptr_glGetActiveUniform = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC)&ProfilingTableDecorator::m_glGetActiveUniform_profile;
+this->m_names[1458] = "glUniform2ui64vARB";
+this->m_orig_glUniform2ui64vARB = this->m_ptr_glUniform2ui64vARB;
+if(this->m_ptr_glUniform2ui64vARB)this->m_ptr_glUniform2ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC)&ProfilingTableDecorator::m_glUniform2ui64vARB_profile;
+this->m_names[1459] = "glMakeNamedBufferResidentNV";
+this->m_orig_glMakeNamedBufferResidentNV = this->m_ptr_glMakeNamedBufferResidentNV;
+if(this->m_ptr_glMakeNamedBufferResidentNV)this->m_ptr_glMakeNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeNamedBufferResidentNV_profile;
+this->m_names[1460] = "glPathGlyphIndexRangeNV";
+this->m_orig_glPathGlyphIndexRangeNV = this->m_ptr_glPathGlyphIndexRangeNV;
+if(this->m_ptr_glPathGlyphIndexRangeNV)this->m_ptr_glPathGlyphIndexRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC)&ProfilingTableDecorator::m_glPathGlyphIndexRangeNV_profile;
+this->m_names[1461] = "glColorPointer";
+this->m_orig_glColorPointer = this->m_ptr_glColorPointer;
+if(this->m_ptr_glColorPointer)this->m_ptr_glColorPointer = (FunctionTable::MEMBERPFNGLCOLORPOINTERPROC)&ProfilingTableDecorator::m_glColorPointer_profile;
+this->m_names[1462] = "glProgramEnvParameterI4ivNV";
+this->m_orig_glProgramEnvParameterI4ivNV = this->m_ptr_glProgramEnvParameterI4ivNV;
+if(this->m_ptr_glProgramEnvParameterI4ivNV)this->m_ptr_glProgramEnvParameterI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4ivNV_profile;
+this->m_names[1463] = "glMulticastGetQueryObjectui64vNV";
+this->m_orig_glMulticastGetQueryObjectui64vNV = this->m_ptr_glMulticastGetQueryObjectui64vNV;
+if(this->m_ptr_glMulticastGetQueryObjectui64vNV)this->m_ptr_glMulticastGetQueryObjectui64vNV = (FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC)&ProfilingTableDecorator::m_glMulticastGetQueryObjectui64vNV_profile;
+this->m_names[1464] = "glMultiTexParameterfEXT";
+this->m_orig_glMultiTexParameterfEXT = this->m_ptr_glMultiTexParameterfEXT;
+if(this->m_ptr_glMultiTexParameterfEXT)this->m_ptr_glMultiTexParameterfEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterfEXT_profile;
+this->m_names[1465] = "glNamedFramebufferTextureLayer";
+this->m_orig_glNamedFramebufferTextureLayer = this->m_ptr_glNamedFramebufferTextureLayer;
+if(this->m_ptr_glNamedFramebufferTextureLayer)this->m_ptr_glNamedFramebufferTextureLayer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureLayer_profile;
+this->m_names[1466] = "glGetVertexArrayIntegervEXT";
+this->m_orig_glGetVertexArrayIntegervEXT = this->m_ptr_glGetVertexArrayIntegervEXT;
+if(this->m_ptr_glGetVertexArrayIntegervEXT)this->m_ptr_glGetVertexArrayIntegervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayIntegervEXT_profile;
+this->m_names[1467] = "glVertexAttrib3dARB";
+this->m_orig_glVertexAttrib3dARB = this->m_ptr_glVertexAttrib3dARB;
+if(this->m_ptr_glVertexAttrib3dARB)this->m_ptr_glVertexAttrib3dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3dARB_profile;
+this->m_names[1468] = "glVDPAUIsSurfaceNV";
+this->m_orig_glVDPAUIsSurfaceNV = this->m_ptr_glVDPAUIsSurfaceNV;
+if(this->m_ptr_glVDPAUIsSurfaceNV)this->m_ptr_glVDPAUIsSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAUIsSurfaceNV_profile;
+this->m_names[1469] = "glMultiTexImage1DEXT";
+this->m_orig_glMultiTexImage1DEXT = this->m_ptr_glMultiTexImage1DEXT;
+if(this->m_ptr_glMultiTexImage1DEXT)this->m_ptr_glMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage1DEXT_profile;
+this->m_names[1470] = "glIsAsyncMarkerSGIX";
+this->m_orig_glIsAsyncMarkerSGIX = this->m_ptr_glIsAsyncMarkerSGIX;
+if(this->m_ptr_glIsAsyncMarkerSGIX)this->m_ptr_glIsAsyncMarkerSGIX = (FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC)&ProfilingTableDecorator::m_glIsAsyncMarkerSGIX_profile;
+this->m_names[1471] = "glGetDoublei_vEXT";
+this->m_orig_glGetDoublei_vEXT = this->m_ptr_glGetDoublei_vEXT;
+if(this->m_ptr_glGetDoublei_vEXT)this->m_ptr_glGetDoublei_vEXT = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC)&ProfilingTableDecorator::m_glGetDoublei_vEXT_profile;
+this->m_names[1472] = "glUniform2i64NV";
+this->m_orig_glUniform2i64NV = this->m_ptr_glUniform2i64NV;
+if(this->m_ptr_glUniform2i64NV)this->m_ptr_glUniform2i64NV = (FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC)&ProfilingTableDecorator::m_glUniform2i64NV_profile;
+this->m_names[1473] = "glIsCommandListNV";
+this->m_orig_glIsCommandListNV = this->m_ptr_glIsCommandListNV;
+if(this->m_ptr_glIsCommandListNV)this->m_ptr_glIsCommandListNV = (FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glIsCommandListNV_profile;
+this->m_names[1474] = "glUniform3uiEXT";
+this->m_orig_glUniform3uiEXT = this->m_ptr_glUniform3uiEXT;
+if(this->m_ptr_glUniform3uiEXT)this->m_ptr_glUniform3uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC)&ProfilingTableDecorator::m_glUniform3uiEXT_profile;
+this->m_names[1475] = "glTexParameterIuivEXT";
+this->m_orig_glTexParameterIuivEXT = this->m_ptr_glTexParameterIuivEXT;
+if(this->m_ptr_glTexParameterIuivEXT)this->m_ptr_glTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glTexParameterIuivEXT_profile;
+this->m_names[1476] = "glProgramUniformMatrix4fv";
+this->m_orig_glProgramUniformMatrix4fv = this->m_ptr_glProgramUniformMatrix4fv;
+if(this->m_ptr_glProgramUniformMatrix4fv)this->m_ptr_glProgramUniformMatrix4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4fv_profile;
+this->m_names[1477] = "glVertex2fv";
+this->m_orig_glVertex2fv = this->m_ptr_glVertex2fv;
+if(this->m_ptr_glVertex2fv)this->m_ptr_glVertex2fv = (FunctionTable::MEMBERPFNGLVERTEX2FVPROC)&ProfilingTableDecorator::m_glVertex2fv_profile;
+this->m_names[1478] = "glVertexAttribL3dEXT";
+this->m_orig_glVertexAttribL3dEXT = this->m_ptr_glVertexAttribL3dEXT;
+if(this->m_ptr_glVertexAttribL3dEXT)this->m_ptr_glVertexAttribL3dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL3dEXT_profile;
+this->m_names[1479] = "glFramebufferRenderbuffer";
+this->m_orig_glFramebufferRenderbuffer = this->m_ptr_glFramebufferRenderbuffer;
+if(this->m_ptr_glFramebufferRenderbuffer)this->m_ptr_glFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC)&ProfilingTableDecorator::m_glFramebufferRenderbuffer_profile;
+this->m_names[1480] = "glGetUniformLocationARB";
+this->m_orig_glGetUniformLocationARB = this->m_ptr_glGetUniformLocationARB;
+if(this->m_ptr_glGetUniformLocationARB)this->m_ptr_glGetUniformLocationARB = (FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC)&ProfilingTableDecorator::m_glGetUniformLocationARB_profile;
+this->m_names[1481] = "glPathParameterfvNV";
+this->m_orig_glPathParameterfvNV = this->m_ptr_glPathParameterfvNV;
+if(this->m_ptr_glPathParameterfvNV)this->m_ptr_glPathParameterfvNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glPathParameterfvNV_profile;
+this->m_names[1482] = "glVertexAttrib3sNV";
+this->m_orig_glVertexAttrib3sNV = this->m_ptr_glVertexAttrib3sNV;
+if(this->m_ptr_glVertexAttrib3sNV)this->m_ptr_glVertexAttrib3sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3sNV_profile;
+this->m_names[1483] = "glGetDoublei_v";
+this->m_orig_glGetDoublei_v = this->m_ptr_glGetDoublei_v;
+if(this->m_ptr_glGetDoublei_v)this->m_ptr_glGetDoublei_v = (FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC)&ProfilingTableDecorator::m_glGetDoublei_v_profile;
+this->m_names[1484] = "glVertexAttrib1sv";
+this->m_orig_glVertexAttrib1sv = this->m_ptr_glVertexAttrib1sv;
+if(this->m_ptr_glVertexAttrib1sv)this->m_ptr_glVertexAttrib1sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC)&ProfilingTableDecorator::m_glVertexAttrib1sv_profile;
+this->m_names[1485] = "glBindSampler";
+this->m_orig_glBindSampler = this->m_ptr_glBindSampler;
+if(this->m_ptr_glBindSampler)this->m_ptr_glBindSampler = (FunctionTable::MEMBERPFNGLBINDSAMPLERPROC)&ProfilingTableDecorator::m_glBindSampler_profile;
+this->m_names[1486] = "glLineWidth";
+this->m_orig_glLineWidth = this->m_ptr_glLineWidth;
+if(this->m_ptr_glLineWidth)this->m_ptr_glLineWidth = (FunctionTable::MEMBERPFNGLLINEWIDTHPROC)&ProfilingTableDecorator::m_glLineWidth_profile;
+this->m_names[1487] = "glVertexArrayRangeAPPLE";
+this->m_orig_glVertexArrayRangeAPPLE = this->m_ptr_glVertexArrayRangeAPPLE;
+if(this->m_ptr_glVertexArrayRangeAPPLE)this->m_ptr_glVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC)&ProfilingTableDecorator::m_glVertexArrayRangeAPPLE_profile;
+this->m_names[1488] = "glBindBufferOffsetEXT";
+this->m_orig_glBindBufferOffsetEXT = this->m_ptr_glBindBufferOffsetEXT;
+if(this->m_ptr_glBindBufferOffsetEXT)this->m_ptr_glBindBufferOffsetEXT = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC)&ProfilingTableDecorator::m_glBindBufferOffsetEXT_profile;
+this->m_names[1489] = "glWeightfvARB";
+this->m_orig_glWeightfvARB = this->m_ptr_glWeightfvARB;
+if(this->m_ptr_glWeightfvARB)this->m_ptr_glWeightfvARB = (FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC)&ProfilingTableDecorator::m_glWeightfvARB_profile;
+this->m_names[1490] = "glGetIntegeri_v";
+this->m_orig_glGetIntegeri_v = this->m_ptr_glGetIntegeri_v;
+if(this->m_ptr_glGetIntegeri_v)this->m_ptr_glGetIntegeri_v = (FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC)&ProfilingTableDecorator::m_glGetIntegeri_v_profile;
+this->m_names[1491] = "glGetTransformFeedbackVarying";
+this->m_orig_glGetTransformFeedbackVarying = this->m_ptr_glGetTransformFeedbackVarying;
+if(this->m_ptr_glGetTransformFeedbackVarying)this->m_ptr_glGetTransformFeedbackVarying = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVarying_profile;
+this->m_names[1492] = "glProgramLocalParameter4fvARB";
+this->m_orig_glProgramLocalParameter4fvARB = this->m_ptr_glProgramLocalParameter4fvARB;
+if(this->m_ptr_glProgramLocalParameter4fvARB)this->m_ptr_glProgramLocalParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4fvARB_profile;
+this->m_names[1493] = "glGetTransformFeedbackVaryingNV";
+this->m_orig_glGetTransformFeedbackVaryingNV = this->m_ptr_glGetTransformFeedbackVaryingNV;
+if(this->m_ptr_glGetTransformFeedbackVaryingNV)this->m_ptr_glGetTransformFeedbackVaryingNV = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVaryingNV_profile;
+this->m_names[1494] = "glWindowPos2iv";
+this->m_orig_glWindowPos2iv = this->m_ptr_glWindowPos2iv;
+if(this->m_ptr_glWindowPos2iv)this->m_ptr_glWindowPos2iv = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC)&ProfilingTableDecorator::m_glWindowPos2iv_profile;
+this->m_names[1495] = "glVertexStream1dATI";
+this->m_orig_glVertexStream1dATI = this->m_ptr_glVertexStream1dATI;
+if(this->m_ptr_glVertexStream1dATI)this->m_ptr_glVertexStream1dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC)&ProfilingTableDecorator::m_glVertexStream1dATI_profile;
+this->m_names[1496] = "glColorFragmentOp2ATI";
+this->m_orig_glColorFragmentOp2ATI = this->m_ptr_glColorFragmentOp2ATI;
+if(this->m_ptr_glColorFragmentOp2ATI)this->m_ptr_glColorFragmentOp2ATI = (FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC)&ProfilingTableDecorator::m_glColorFragmentOp2ATI_profile;
+this->m_names[1497] = "glFogiv";
+this->m_orig_glFogiv = this->m_ptr_glFogiv;
+if(this->m_ptr_glFogiv)this->m_ptr_glFogiv = (FunctionTable::MEMBERPFNGLFOGIVPROC)&ProfilingTableDecorator::m_glFogiv_profile;
+this->m_names[1498] = "glGetTextureHandleNV";
+this->m_orig_glGetTextureHandleNV = this->m_ptr_glGetTextureHandleNV;
+if(this->m_ptr_glGetTextureHandleNV)this->m_ptr_glGetTextureHandleNV = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC)&ProfilingTableDecorator::m_glGetTextureHandleNV_profile;
+this->m_names[1499] = "glLightModeliv";
+this->m_orig_glLightModeliv = this->m_ptr_glLightModeliv;
+if(this->m_ptr_glLightModeliv)this->m_ptr_glLightModeliv = (FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC)&ProfilingTableDecorator::m_glLightModeliv_profile;
+this->m_names[1500] = "glDepthRangef";
+this->m_orig_glDepthRangef = this->m_ptr_glDepthRangef;
+if(this->m_ptr_glDepthRangef)this->m_ptr_glDepthRangef = (FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC)&ProfilingTableDecorator::m_glDepthRangef_profile;
+this->m_names[1501] = "glGetFragmentMaterialivSGIX";
+this->m_orig_glGetFragmentMaterialivSGIX = this->m_ptr_glGetFragmentMaterialivSGIX;
+if(this->m_ptr_glGetFragmentMaterialivSGIX)this->m_ptr_glGetFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentMaterialivSGIX_profile;
+this->m_names[1502] = "glVideoCaptureStreamParameterfvNV";
+this->m_orig_glVideoCaptureStreamParameterfvNV = this->m_ptr_glVideoCaptureStreamParameterfvNV;
+if(this->m_ptr_glVideoCaptureStreamParameterfvNV)this->m_ptr_glVideoCaptureStreamParameterfvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterfvNV_profile;
+this->m_names[1503] = "glDeleteProgramsARB";
+this->m_orig_glDeleteProgramsARB = this->m_ptr_glDeleteProgramsARB;
+if(this->m_ptr_glDeleteProgramsARB)this->m_ptr_glDeleteProgramsARB = (FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC)&ProfilingTableDecorator::m_glDeleteProgramsARB_profile;
+this->m_names[1504] = "glWindowPos3fvARB";
+this->m_orig_glWindowPos3fvARB = this->m_ptr_glWindowPos3fvARB;
+if(this->m_ptr_glWindowPos3fvARB)this->m_ptr_glWindowPos3fvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC)&ProfilingTableDecorator::m_glWindowPos3fvARB_profile;
+this->m_names[1505] = "glFeedbackBufferxOES";
+this->m_orig_glFeedbackBufferxOES = this->m_ptr_glFeedbackBufferxOES;
+if(this->m_ptr_glFeedbackBufferxOES)this->m_ptr_glFeedbackBufferxOES = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC)&ProfilingTableDecorator::m_glFeedbackBufferxOES_profile;
+this->m_names[1506] = "glGetTexBumpParameterfvATI";
+this->m_orig_glGetTexBumpParameterfvATI = this->m_ptr_glGetTexBumpParameterfvATI;
+if(this->m_ptr_glGetTexBumpParameterfvATI)this->m_ptr_glGetTexBumpParameterfvATI = (FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC)&ProfilingTableDecorator::m_glGetTexBumpParameterfvATI_profile;
+this->m_names[1507] = "glEnablei";
+this->m_orig_glEnablei = this->m_ptr_glEnablei;
+if(this->m_ptr_glEnablei)this->m_ptr_glEnablei = (FunctionTable::MEMBERPFNGLENABLEIPROC)&ProfilingTableDecorator::m_glEnablei_profile;
+this->m_names[1508] = "glGetActiveSubroutineName";
+this->m_orig_glGetActiveSubroutineName = this->m_ptr_glGetActiveSubroutineName;
+if(this->m_ptr_glGetActiveSubroutineName)this->m_ptr_glGetActiveSubroutineName = (FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC)&ProfilingTableDecorator::m_glGetActiveSubroutineName_profile;
+this->m_names[1509] = "glDrawBuffersARB";
+this->m_orig_glDrawBuffersARB = this->m_ptr_glDrawBuffersARB;
+if(this->m_ptr_glDrawBuffersARB)this->m_ptr_glDrawBuffersARB = (FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC)&ProfilingTableDecorator::m_glDrawBuffersARB_profile;
+this->m_names[1510] = "glBindProgramARB";
+this->m_orig_glBindProgramARB = this->m_ptr_glBindProgramARB;
+if(this->m_ptr_glBindProgramARB)this->m_ptr_glBindProgramARB = (FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC)&ProfilingTableDecorator::m_glBindProgramARB_profile;
+this->m_names[1511] = "glEvalCoord1fv";
+this->m_orig_glEvalCoord1fv = this->m_ptr_glEvalCoord1fv;
+if(this->m_ptr_glEvalCoord1fv)this->m_ptr_glEvalCoord1fv = (FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC)&ProfilingTableDecorator::m_glEvalCoord1fv_profile;
+this->m_names[1512] = "glProgramUniform3ui64vARB";
+this->m_orig_glProgramUniform3ui64vARB = this->m_ptr_glProgramUniform3ui64vARB;
+if(this->m_ptr_glProgramUniform3ui64vARB)this->m_ptr_glProgramUniform3ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64vARB_profile;
+this->m_names[1513] = "glProgramUniformMatrix2dv";
+this->m_orig_glProgramUniformMatrix2dv = this->m_ptr_glProgramUniformMatrix2dv;
+if(this->m_ptr_glProgramUniformMatrix2dv)this->m_ptr_glProgramUniformMatrix2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2dv_profile;
+this->m_names[1514] = "glMultiTexCoord2hvNV";
+this->m_orig_glMultiTexCoord2hvNV = this->m_ptr_glMultiTexCoord2hvNV;
+if(this->m_ptr_glMultiTexCoord2hvNV)this->m_ptr_glMultiTexCoord2hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2hvNV_profile;
+this->m_names[1515] = "glGetFloatIndexedvEXT";
+this->m_orig_glGetFloatIndexedvEXT = this->m_ptr_glGetFloatIndexedvEXT;
+if(this->m_ptr_glGetFloatIndexedvEXT)this->m_ptr_glGetFloatIndexedvEXT = (FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetFloatIndexedvEXT_profile;
+this->m_names[1516] = "glSampleCoverageARB";
+this->m_orig_glSampleCoverageARB = this->m_ptr_glSampleCoverageARB;
+if(this->m_ptr_glSampleCoverageARB)this->m_ptr_glSampleCoverageARB = (FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC)&ProfilingTableDecorator::m_glSampleCoverageARB_profile;
+this->m_names[1517] = "glProgramUniform2ui64vARB";
+this->m_orig_glProgramUniform2ui64vARB = this->m_ptr_glProgramUniform2ui64vARB;
+if(this->m_ptr_glProgramUniform2ui64vARB)this->m_ptr_glProgramUniform2ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64vARB_profile;
+this->m_names[1518] = "glPixelDataRangeNV";
+this->m_orig_glPixelDataRangeNV = this->m_ptr_glPixelDataRangeNV;
+if(this->m_ptr_glPixelDataRangeNV)this->m_ptr_glPixelDataRangeNV = (FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC)&ProfilingTableDecorator::m_glPixelDataRangeNV_profile;
+this->m_names[1519] = "glVertexStream3svATI";
+this->m_orig_glVertexStream3svATI = this->m_ptr_glVertexStream3svATI;
+if(this->m_ptr_glVertexStream3svATI)this->m_ptr_glVertexStream3svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC)&ProfilingTableDecorator::m_glVertexStream3svATI_profile;
+this->m_names[1520] = "glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profile;
+this->m_names[1521] = "glTexCoord3hvNV";
+this->m_orig_glTexCoord3hvNV = this->m_ptr_glTexCoord3hvNV;
+if(this->m_ptr_glTexCoord3hvNV)this->m_ptr_glTexCoord3hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC)&ProfilingTableDecorator::m_glTexCoord3hvNV_profile;
+this->m_names[1522] = "glSampleMaski";
+this->m_orig_glSampleMaski = this->m_ptr_glSampleMaski;
+if(this->m_ptr_glSampleMaski)this->m_ptr_glSampleMaski = (FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC)&ProfilingTableDecorator::m_glSampleMaski_profile;
+this->m_names[1523] = "glIndexFuncEXT";
+this->m_orig_glIndexFuncEXT = this->m_ptr_glIndexFuncEXT;
+if(this->m_ptr_glIndexFuncEXT)this->m_ptr_glIndexFuncEXT = (FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC)&ProfilingTableDecorator::m_glIndexFuncEXT_profile;
+this->m_names[1524] = "glPointParameteriNV";
+this->m_orig_glPointParameteriNV = this->m_ptr_glPointParameteriNV;
+if(this->m_ptr_glPointParameteriNV)this->m_ptr_glPointParameteriNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC)&ProfilingTableDecorator::m_glPointParameteriNV_profile;
+this->m_names[1525] = "glUniformMatrix3x2fv";
+this->m_orig_glUniformMatrix3x2fv = this->m_ptr_glUniformMatrix3x2fv;
+if(this->m_ptr_glUniformMatrix3x2fv)this->m_ptr_glUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x2fv_profile;
+this->m_names[1526] = "glGetFramebufferParameterivEXT";
+this->m_orig_glGetFramebufferParameterivEXT = this->m_ptr_glGetFramebufferParameterivEXT;
+if(this->m_ptr_glGetFramebufferParameterivEXT)this->m_ptr_glGetFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetFramebufferParameterivEXT_profile;
+this->m_names[1527] = "glUniform2i64ARB";
+this->m_orig_glUniform2i64ARB = this->m_ptr_glUniform2i64ARB;
+if(this->m_ptr_glUniform2i64ARB)this->m_ptr_glUniform2i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC)&ProfilingTableDecorator::m_glUniform2i64ARB_profile;
+this->m_names[1528] = "glNamedBufferStorageEXT";
+this->m_orig_glNamedBufferStorageEXT = this->m_ptr_glNamedBufferStorageEXT;
+if(this->m_ptr_glNamedBufferStorageEXT)this->m_ptr_glNamedBufferStorageEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC)&ProfilingTableDecorator::m_glNamedBufferStorageEXT_profile;
+this->m_names[1529] = "glNamedFramebufferTexture3DEXT";
+this->m_orig_glNamedFramebufferTexture3DEXT = this->m_ptr_glNamedFramebufferTexture3DEXT;
+if(this->m_ptr_glNamedFramebufferTexture3DEXT)this->m_ptr_glNamedFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture3DEXT_profile;
+this->m_names[1530] = "glVertexAttrib2dv";
+this->m_orig_glVertexAttrib2dv = this->m_ptr_glVertexAttrib2dv;
+if(this->m_ptr_glVertexAttrib2dv)this->m_ptr_glVertexAttrib2dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC)&ProfilingTableDecorator::m_glVertexAttrib2dv_profile;
+this->m_names[1531] = "glGetVertexArrayPointervEXT";
+this->m_orig_glGetVertexArrayPointervEXT = this->m_ptr_glGetVertexArrayPointervEXT;
+if(this->m_ptr_glGetVertexArrayPointervEXT)this->m_ptr_glGetVertexArrayPointervEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayPointervEXT_profile;
+this->m_names[1532] = "glGetVertexAttribArrayObjectivATI";
+this->m_orig_glGetVertexAttribArrayObjectivATI = this->m_ptr_glGetVertexAttribArrayObjectivATI;
+if(this->m_ptr_glGetVertexAttribArrayObjectivATI)this->m_ptr_glGetVertexAttribArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetVertexAttribArrayObjectivATI_profile;
+this->m_names[1533] = "glProgramUniformMatrix3fvEXT";
+this->m_orig_glProgramUniformMatrix3fvEXT = this->m_ptr_glProgramUniformMatrix3fvEXT;
+if(this->m_ptr_glProgramUniformMatrix3fvEXT)this->m_ptr_glProgramUniformMatrix3fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3fvEXT_profile;
+this->m_names[1534] = "glEnableVertexArrayEXT";
+this->m_orig_glEnableVertexArrayEXT = this->m_ptr_glEnableVertexArrayEXT;
+if(this->m_ptr_glEnableVertexArrayEXT)this->m_ptr_glEnableVertexArrayEXT = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC)&ProfilingTableDecorator::m_glEnableVertexArrayEXT_profile;
+this->m_names[1535] = "glColorTableParameterfvSGI";
+this->m_orig_glColorTableParameterfvSGI = this->m_ptr_glColorTableParameterfvSGI;
+if(this->m_ptr_glColorTableParameterfvSGI)this->m_ptr_glColorTableParameterfvSGI = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC)&ProfilingTableDecorator::m_glColorTableParameterfvSGI_profile;
+this->m_names[1536] = "glEdgeFlag";
+this->m_orig_glEdgeFlag = this->m_ptr_glEdgeFlag;
+if(this->m_ptr_glEdgeFlag)this->m_ptr_glEdgeFlag = (FunctionTable::MEMBERPFNGLEDGEFLAGPROC)&ProfilingTableDecorator::m_glEdgeFlag_profile;
+this->m_names[1537] = "glFogCoordf";
+this->m_orig_glFogCoordf = this->m_ptr_glFogCoordf;
+if(this->m_ptr_glFogCoordf)this->m_ptr_glFogCoordf = (FunctionTable::MEMBERPFNGLFOGCOORDFPROC)&ProfilingTableDecorator::m_glFogCoordf_profile;
+this->m_names[1538] = "glVertex3d";
+this->m_orig_glVertex3d = this->m_ptr_glVertex3d;
+if(this->m_ptr_glVertex3d)this->m_ptr_glVertex3d = (FunctionTable::MEMBERPFNGLVERTEX3DPROC)&ProfilingTableDecorator::m_glVertex3d_profile;
+this->m_names[1539] = "glVertex3f";
+this->m_orig_glVertex3f = this->m_ptr_glVertex3f;
+if(this->m_ptr_glVertex3f)this->m_ptr_glVertex3f = (FunctionTable::MEMBERPFNGLVERTEX3FPROC)&ProfilingTableDecorator::m_glVertex3f_profile;
+this->m_names[1540] = "glSpriteParameterivSGIX";
+this->m_orig_glSpriteParameterivSGIX = this->m_ptr_glSpriteParameterivSGIX;
+if(this->m_ptr_glSpriteParameterivSGIX)this->m_ptr_glSpriteParameterivSGIX = (FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glSpriteParameterivSGIX_profile;
+this->m_names[1541] = "glPathGlyphRangeNV";
+this->m_orig_glPathGlyphRangeNV = this->m_ptr_glPathGlyphRangeNV;
+if(this->m_ptr_glPathGlyphRangeNV)this->m_ptr_glPathGlyphRangeNV = (FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC)&ProfilingTableDecorator::m_glPathGlyphRangeNV_profile;
+this->m_names[1542] = "glPrimitiveBoundingBoxARB";
+this->m_orig_glPrimitiveBoundingBoxARB = this->m_ptr_glPrimitiveBoundingBoxARB;
+if(this->m_ptr_glPrimitiveBoundingBoxARB)this->m_ptr_glPrimitiveBoundingBoxARB = (FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC)&ProfilingTableDecorator::m_glPrimitiveBoundingBoxARB_profile;
+this->m_names[1543] = "glVertexAttribL3ui64vNV";
+this->m_orig_glVertexAttribL3ui64vNV = this->m_ptr_glVertexAttribL3ui64vNV;
+if(this->m_ptr_glVertexAttribL3ui64vNV)this->m_ptr_glVertexAttribL3ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL3ui64vNV_profile;
+this->m_names[1544] = "glVertex3s";
+this->m_orig_glVertex3s = this->m_ptr_glVertex3s;
+if(this->m_ptr_glVertex3s)this->m_ptr_glVertex3s = (FunctionTable::MEMBERPFNGLVERTEX3SPROC)&ProfilingTableDecorator::m_glVertex3s_profile;
+this->m_names[1545] = "glTexCoordP2ui";
+this->m_orig_glTexCoordP2ui = this->m_ptr_glTexCoordP2ui;
+if(this->m_ptr_glTexCoordP2ui)this->m_ptr_glTexCoordP2ui = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC)&ProfilingTableDecorator::m_glTexCoordP2ui_profile;
+this->m_names[1546] = "glProgramUniform2fvEXT";
+this->m_orig_glProgramUniform2fvEXT = this->m_ptr_glProgramUniform2fvEXT;
+if(this->m_ptr_glProgramUniform2fvEXT)this->m_ptr_glProgramUniform2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2fvEXT_profile;
+this->m_names[1547] = "glDeletePathsNV";
+this->m_orig_glDeletePathsNV = this->m_ptr_glDeletePathsNV;
+if(this->m_ptr_glDeletePathsNV)this->m_ptr_glDeletePathsNV = (FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC)&ProfilingTableDecorator::m_glDeletePathsNV_profile;
+this->m_names[1548] = "glPrimitiveRestartIndexNV";
+this->m_orig_glPrimitiveRestartIndexNV = this->m_ptr_glPrimitiveRestartIndexNV;
+if(this->m_ptr_glPrimitiveRestartIndexNV)this->m_ptr_glPrimitiveRestartIndexNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC)&ProfilingTableDecorator::m_glPrimitiveRestartIndexNV_profile;
+this->m_names[1549] = "glTexCoord2fColor3fVertex3fvSUN";
+this->m_orig_glTexCoord2fColor3fVertex3fvSUN = this->m_ptr_glTexCoord2fColor3fVertex3fvSUN;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fvSUN)this->m_ptr_glTexCoord2fColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor3fVertex3fvSUN_profile;
+this->m_names[1550] = "glTexCoordPointerListIBM";
+this->m_orig_glTexCoordPointerListIBM = this->m_ptr_glTexCoordPointerListIBM;
+if(this->m_ptr_glTexCoordPointerListIBM)this->m_ptr_glTexCoordPointerListIBM = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glTexCoordPointerListIBM_profile;
+this->m_names[1551] = "glRectxOES";
+this->m_orig_glRectxOES = this->m_ptr_glRectxOES;
+if(this->m_ptr_glRectxOES)this->m_ptr_glRectxOES = (FunctionTable::MEMBERPFNGLRECTXOESPROC)&ProfilingTableDecorator::m_glRectxOES_profile;
+this->m_names[1552] = "glCopyNamedBufferSubData";
+this->m_orig_glCopyNamedBufferSubData = this->m_ptr_glCopyNamedBufferSubData;
+if(this->m_ptr_glCopyNamedBufferSubData)this->m_ptr_glCopyNamedBufferSubData = (FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glCopyNamedBufferSubData_profile;
+this->m_names[1553] = "glGenProgramsNV";
+this->m_orig_glGenProgramsNV = this->m_ptr_glGenProgramsNV;
+if(this->m_ptr_glGenProgramsNV)this->m_ptr_glGenProgramsNV = (FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC)&ProfilingTableDecorator::m_glGenProgramsNV_profile;
+this->m_names[1554] = "glFragmentLightfSGIX";
+this->m_orig_glFragmentLightfSGIX = this->m_ptr_glFragmentLightfSGIX;
+if(this->m_ptr_glFragmentLightfSGIX)this->m_ptr_glFragmentLightfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightfSGIX_profile;
+this->m_names[1555] = "glTexStorage3D";
+this->m_orig_glTexStorage3D = this->m_ptr_glTexStorage3D;
+if(this->m_ptr_glTexStorage3D)this->m_ptr_glTexStorage3D = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC)&ProfilingTableDecorator::m_glTexStorage3D_profile;
+this->m_names[1556] = "glTextureParameteriv";
+this->m_orig_glTextureParameteriv = this->m_ptr_glTextureParameteriv;
+if(this->m_ptr_glTextureParameteriv)this->m_ptr_glTextureParameteriv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC)&ProfilingTableDecorator::m_glTextureParameteriv_profile;
+this->m_names[1557] = "glNamedBufferDataEXT";
+this->m_orig_glNamedBufferDataEXT = this->m_ptr_glNamedBufferDataEXT;
+if(this->m_ptr_glNamedBufferDataEXT)this->m_ptr_glNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC)&ProfilingTableDecorator::m_glNamedBufferDataEXT_profile;
+this->m_names[1558] = "glImportSemaphoreWin32NameEXT";
+this->m_orig_glImportSemaphoreWin32NameEXT = this->m_ptr_glImportSemaphoreWin32NameEXT;
+if(this->m_ptr_glImportSemaphoreWin32NameEXT)this->m_ptr_glImportSemaphoreWin32NameEXT = (FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC)&ProfilingTableDecorator::m_glImportSemaphoreWin32NameEXT_profile;
+this->m_names[1559] = "glMultiTexCoord3fvARB";
+this->m_orig_glMultiTexCoord3fvARB = this->m_ptr_glMultiTexCoord3fvARB;
+if(this->m_ptr_glMultiTexCoord3fvARB)this->m_ptr_glMultiTexCoord3fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fvARB_profile;
+this->m_names[1560] = "glUniformMatrix3x4fv";
+this->m_orig_glUniformMatrix3x4fv = this->m_ptr_glUniformMatrix3x4fv;
+if(this->m_ptr_glUniformMatrix3x4fv)this->m_ptr_glUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x4fv_profile;
+this->m_names[1561] = "glSubpixelPrecisionBiasNV";
+this->m_orig_glSubpixelPrecisionBiasNV = this->m_ptr_glSubpixelPrecisionBiasNV;
+if(this->m_ptr_glSubpixelPrecisionBiasNV)this->m_ptr_glSubpixelPrecisionBiasNV = (FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC)&ProfilingTableDecorator::m_glSubpixelPrecisionBiasNV_profile;
+this->m_names[1562] = "glNormalPointer";
+this->m_orig_glNormalPointer = this->m_ptr_glNormalPointer;
+if(this->m_ptr_glNormalPointer)this->m_ptr_glNormalPointer = (FunctionTable::MEMBERPFNGLNORMALPOINTERPROC)&ProfilingTableDecorator::m_glNormalPointer_profile;
+this->m_names[1563] = "glNamedFramebufferTexture";
+this->m_orig_glNamedFramebufferTexture = this->m_ptr_glNamedFramebufferTexture;
+if(this->m_ptr_glNamedFramebufferTexture)this->m_ptr_glNamedFramebufferTexture = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture_profile;
+this->m_names[1564] = "glVertexAttrib4NsvARB";
+this->m_orig_glVertexAttrib4NsvARB = this->m_ptr_glVertexAttrib4NsvARB;
+if(this->m_ptr_glVertexAttrib4NsvARB)this->m_ptr_glVertexAttrib4NsvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NsvARB_profile;
+this->m_names[1565] = "glPassThrough";
+this->m_orig_glPassThrough = this->m_ptr_glPassThrough;
+if(this->m_ptr_glPassThrough)this->m_ptr_glPassThrough = (FunctionTable::MEMBERPFNGLPASSTHROUGHPROC)&ProfilingTableDecorator::m_glPassThrough_profile;
+this->m_names[1566] = "glSecondaryColorP3ui";
+this->m_orig_glSecondaryColorP3ui = this->m_ptr_glSecondaryColorP3ui;
+if(this->m_ptr_glSecondaryColorP3ui)this->m_ptr_glSecondaryColorP3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC)&ProfilingTableDecorator::m_glSecondaryColorP3ui_profile;
+this->m_names[1567] = "glInvalidateTexSubImage";
+this->m_orig_glInvalidateTexSubImage = this->m_ptr_glInvalidateTexSubImage;
+if(this->m_ptr_glInvalidateTexSubImage)this->m_ptr_glInvalidateTexSubImage = (FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC)&ProfilingTableDecorator::m_glInvalidateTexSubImage_profile;
+this->m_names[1568] = "glIsImageHandleResidentARB";
+this->m_orig_glIsImageHandleResidentARB = this->m_ptr_glIsImageHandleResidentARB;
+if(this->m_ptr_glIsImageHandleResidentARB)this->m_ptr_glIsImageHandleResidentARB = (FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glIsImageHandleResidentARB_profile;
+this->m_names[1569] = "glTangent3fvEXT";
+this->m_orig_glTangent3fvEXT = this->m_ptr_glTangent3fvEXT;
+if(this->m_ptr_glTangent3fvEXT)this->m_ptr_glTangent3fvEXT = (FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC)&ProfilingTableDecorator::m_glTangent3fvEXT_profile;
+this->m_names[1570] = "glProgramUniformMatrix4x3fv";
+this->m_orig_glProgramUniformMatrix4x3fv = this->m_ptr_glProgramUniformMatrix4x3fv;
+if(this->m_ptr_glProgramUniformMatrix4x3fv)this->m_ptr_glProgramUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3fv_profile;
+this->m_names[1571] = "glBegin";
+this->m_orig_glBegin = this->m_ptr_glBegin;
+if(this->m_ptr_glBegin)this->m_ptr_glBegin = (FunctionTable::MEMBERPFNGLBEGINPROC)&ProfilingTableDecorator::m_glBegin_profile;
+this->m_names[1572] = "glEvalCoord2dv";
+this->m_orig_glEvalCoord2dv = this->m_ptr_glEvalCoord2dv;
+if(this->m_ptr_glEvalCoord2dv)this->m_ptr_glEvalCoord2dv = (FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC)&ProfilingTableDecorator::m_glEvalCoord2dv_profile;
+this->m_names[1573] = "glColor3ubv";
+this->m_orig_glColor3ubv = this->m_ptr_glColor3ubv;
+if(this->m_ptr_glColor3ubv)this->m_ptr_glColor3ubv = (FunctionTable::MEMBERPFNGLCOLOR3UBVPROC)&ProfilingTableDecorator::m_glColor3ubv_profile;
+this->m_names[1574] = "glFogCoordfvEXT";
+this->m_orig_glFogCoordfvEXT = this->m_ptr_glFogCoordfvEXT;
+if(this->m_ptr_glFogCoordfvEXT)this->m_ptr_glFogCoordfvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC)&ProfilingTableDecorator::m_glFogCoordfvEXT_profile;
+this->m_names[1575] = "glVertexP3ui";
+this->m_orig_glVertexP3ui = this->m_ptr_glVertexP3ui;
+if(this->m_ptr_glVertexP3ui)this->m_ptr_glVertexP3ui = (FunctionTable::MEMBERPFNGLVERTEXP3UIPROC)&ProfilingTableDecorator::m_glVertexP3ui_profile;
+this->m_names[1576] = "glLightfv";
+this->m_orig_glLightfv = this->m_ptr_glLightfv;
+if(this->m_ptr_glLightfv)this->m_ptr_glLightfv = (FunctionTable::MEMBERPFNGLLIGHTFVPROC)&ProfilingTableDecorator::m_glLightfv_profile;
+this->m_names[1577] = "glVertexAttribL3i64NV";
+this->m_orig_glVertexAttribL3i64NV = this->m_ptr_glVertexAttribL3i64NV;
+if(this->m_ptr_glVertexAttribL3i64NV)this->m_ptr_glVertexAttribL3i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL3i64NV_profile;
+this->m_names[1578] = "glStencilClearTagEXT";
+this->m_orig_glStencilClearTagEXT = this->m_ptr_glStencilClearTagEXT;
+if(this->m_ptr_glStencilClearTagEXT)this->m_ptr_glStencilClearTagEXT = (FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC)&ProfilingTableDecorator::m_glStencilClearTagEXT_profile;
+this->m_names[1579] = "glGetActiveUniformName";
+this->m_orig_glGetActiveUniformName = this->m_ptr_glGetActiveUniformName;
+if(this->m_ptr_glGetActiveUniformName)this->m_ptr_glGetActiveUniformName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC)&ProfilingTableDecorator::m_glGetActiveUniformName_profile;
+this->m_names[1580] = "glTangentPointerEXT";
+this->m_orig_glTangentPointerEXT = this->m_ptr_glTangentPointerEXT;
+if(this->m_ptr_glTangentPointerEXT)this->m_ptr_glTangentPointerEXT = (FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC)&ProfilingTableDecorator::m_glTangentPointerEXT_profile;
+this->m_names[1581] = "glUniform4ui64vNV";
+this->m_orig_glUniform4ui64vNV = this->m_ptr_glUniform4ui64vNV;
+if(this->m_ptr_glUniform4ui64vNV)this->m_ptr_glUniform4ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC)&ProfilingTableDecorator::m_glUniform4ui64vNV_profile;
+this->m_names[1582] = "glDebugMessageEnableAMD";
+this->m_orig_glDebugMessageEnableAMD = this->m_ptr_glDebugMessageEnableAMD;
+if(this->m_ptr_glDebugMessageEnableAMD)this->m_ptr_glDebugMessageEnableAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC)&ProfilingTableDecorator::m_glDebugMessageEnableAMD_profile;
+this->m_names[1583] = "glProgramUniform2ui";
+this->m_orig_glProgramUniform2ui = this->m_ptr_glProgramUniform2ui;
+if(this->m_ptr_glProgramUniform2ui)this->m_ptr_glProgramUniform2ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC)&ProfilingTableDecorator::m_glProgramUniform2ui_profile;
+this->m_names[1584] = "glCopyTexSubImage2DEXT";
+this->m_orig_glCopyTexSubImage2DEXT = this->m_ptr_glCopyTexSubImage2DEXT;
+if(this->m_ptr_glCopyTexSubImage2DEXT)this->m_ptr_glCopyTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage2DEXT_profile;
+this->m_names[1585] = "glGenRenderbuffersEXT";
+this->m_orig_glGenRenderbuffersEXT = this->m_ptr_glGenRenderbuffersEXT;
+if(this->m_ptr_glGenRenderbuffersEXT)this->m_ptr_glGenRenderbuffersEXT = (FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC)&ProfilingTableDecorator::m_glGenRenderbuffersEXT_profile;
+this->m_names[1586] = "glNamedProgramLocalParameterI4ivEXT";
+this->m_orig_glNamedProgramLocalParameterI4ivEXT = this->m_ptr_glNamedProgramLocalParameterI4ivEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4ivEXT)this->m_ptr_glNamedProgramLocalParameterI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4ivEXT_profile;
+this->m_names[1587] = "glMultiTexCoord2f";
+this->m_orig_glMultiTexCoord2f = this->m_ptr_glMultiTexCoord2f;
+if(this->m_ptr_glMultiTexCoord2f)this->m_ptr_glMultiTexCoord2f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC)&ProfilingTableDecorator::m_glMultiTexCoord2f_profile;
+this->m_names[1588] = "glMapGrid2d";
+this->m_orig_glMapGrid2d = this->m_ptr_glMapGrid2d;
+if(this->m_ptr_glMapGrid2d)this->m_ptr_glMapGrid2d = (FunctionTable::MEMBERPFNGLMAPGRID2DPROC)&ProfilingTableDecorator::m_glMapGrid2d_profile;
+this->m_names[1589] = "glGetMultiTexParameterIuivEXT";
+this->m_orig_glGetMultiTexParameterIuivEXT = this->m_ptr_glGetMultiTexParameterIuivEXT;
+if(this->m_ptr_glGetMultiTexParameterIuivEXT)this->m_ptr_glGetMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexParameterIuivEXT_profile;
+this->m_names[1590] = "glBlendEquationiARB";
+this->m_orig_glBlendEquationiARB = this->m_ptr_glBlendEquationiARB;
+if(this->m_ptr_glBlendEquationiARB)this->m_ptr_glBlendEquationiARB = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC)&ProfilingTableDecorator::m_glBlendEquationiARB_profile;
+this->m_names[1591] = "glTexParameteriv";
+this->m_orig_glTexParameteriv = this->m_ptr_glTexParameteriv;
+if(this->m_ptr_glTexParameteriv)this->m_ptr_glTexParameteriv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC)&ProfilingTableDecorator::m_glTexParameteriv_profile;
+this->m_names[1592] = "glUniform4ivARB";
+this->m_orig_glUniform4ivARB = this->m_ptr_glUniform4ivARB;
+if(this->m_ptr_glUniform4ivARB)this->m_ptr_glUniform4ivARB = (FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC)&ProfilingTableDecorator::m_glUniform4ivARB_profile;
+this->m_names[1593] = "glMatrixOrthoEXT";
+this->m_orig_glMatrixOrthoEXT = this->m_ptr_glMatrixOrthoEXT;
+if(this->m_ptr_glMatrixOrthoEXT)this->m_ptr_glMatrixOrthoEXT = (FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC)&ProfilingTableDecorator::m_glMatrixOrthoEXT_profile;
+this->m_names[1594] = "glVertexArrayVertexBuffer";
+this->m_orig_glVertexArrayVertexBuffer = this->m_ptr_glVertexArrayVertexBuffer;
+if(this->m_ptr_glVertexArrayVertexBuffer)this->m_ptr_glVertexArrayVertexBuffer = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC)&ProfilingTableDecorator::m_glVertexArrayVertexBuffer_profile;
+this->m_names[1595] = "glProgramLocalParametersI4ivNV";
+this->m_orig_glProgramLocalParametersI4ivNV = this->m_ptr_glProgramLocalParametersI4ivNV;
+if(this->m_ptr_glProgramLocalParametersI4ivNV)this->m_ptr_glProgramLocalParametersI4ivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParametersI4ivNV_profile;
+this->m_names[1596] = "glProgramUniform4ui64vNV";
+this->m_orig_glProgramUniform4ui64vNV = this->m_ptr_glProgramUniform4ui64vNV;
+if(this->m_ptr_glProgramUniform4ui64vNV)this->m_ptr_glProgramUniform4ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64vNV_profile;
+this->m_names[1597] = "glGetNamedStringivARB";
+this->m_orig_glGetNamedStringivARB = this->m_ptr_glGetNamedStringivARB;
+if(this->m_ptr_glGetNamedStringivARB)this->m_ptr_glGetNamedStringivARB = (FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC)&ProfilingTableDecorator::m_glGetNamedStringivARB_profile;
+this->m_names[1598] = "glVertexAttribL1i64vNV";
+this->m_orig_glVertexAttribL1i64vNV = this->m_ptr_glVertexAttribL1i64vNV;
+if(this->m_ptr_glVertexAttribL1i64vNV)this->m_ptr_glVertexAttribL1i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL1i64vNV_profile;
+this->m_names[1599] = "glTransformFeedbackBufferBase";
+this->m_orig_glTransformFeedbackBufferBase = this->m_ptr_glTransformFeedbackBufferBase;
+if(this->m_ptr_glTransformFeedbackBufferBase)this->m_ptr_glTransformFeedbackBufferBase = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)&ProfilingTableDecorator::m_glTransformFeedbackBufferBase_profile;
+this->m_names[1600] = "glIndexsv";
+this->m_orig_glIndexsv = this->m_ptr_glIndexsv;
+if(this->m_ptr_glIndexsv)this->m_ptr_glIndexsv = (FunctionTable::MEMBERPFNGLINDEXSVPROC)&ProfilingTableDecorator::m_glIndexsv_profile;
+this->m_names[1601] = "glPointParameterivNV";
+this->m_orig_glPointParameterivNV = this->m_ptr_glPointParameterivNV;
+if(this->m_ptr_glPointParameterivNV)this->m_ptr_glPointParameterivNV = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glPointParameterivNV_profile;
+this->m_names[1602] = "glGetDetailTexFuncSGIS";
+this->m_orig_glGetDetailTexFuncSGIS = this->m_ptr_glGetDetailTexFuncSGIS;
+if(this->m_ptr_glGetDetailTexFuncSGIS)this->m_ptr_glGetDetailTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glGetDetailTexFuncSGIS_profile;
+this->m_names[1603] = "glReplacementCodeuiColor3fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN = this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN)this->m_ptr_glReplacementCodeuiColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor3fVertex3fvSUN_profile;
+this->m_names[1604] = "glProgramLocalParameter4fARB";
+this->m_orig_glProgramLocalParameter4fARB = this->m_ptr_glProgramLocalParameter4fARB;
+if(this->m_ptr_glProgramLocalParameter4fARB)this->m_ptr_glProgramLocalParameter4fARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4fARB_profile;
+this->m_names[1605] = "glBitmap";
+this->m_orig_glBitmap = this->m_ptr_glBitmap;
+if(this->m_ptr_glBitmap)this->m_ptr_glBitmap = (FunctionTable::MEMBERPFNGLBITMAPPROC)&ProfilingTableDecorator::m_glBitmap_profile;
+this->m_names[1606] = "glNamedFramebufferTextureLayerEXT";
+this->m_orig_glNamedFramebufferTextureLayerEXT = this->m_ptr_glNamedFramebufferTextureLayerEXT;
+if(this->m_ptr_glNamedFramebufferTextureLayerEXT)this->m_ptr_glNamedFramebufferTextureLayerEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTextureLayerEXT_profile;
+this->m_names[1607] = "glMultiTexGenfvEXT";
+this->m_orig_glMultiTexGenfvEXT = this->m_ptr_glMultiTexGenfvEXT;
+if(this->m_ptr_glMultiTexGenfvEXT)this->m_ptr_glMultiTexGenfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGenfvEXT_profile;
+this->m_names[1608] = "glGetNamedBufferSubData";
+this->m_orig_glGetNamedBufferSubData = this->m_ptr_glGetNamedBufferSubData;
+if(this->m_ptr_glGetNamedBufferSubData)this->m_ptr_glGetNamedBufferSubData = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glGetNamedBufferSubData_profile;
+this->m_names[1609] = "glStencilFuncSeparateATI";
+this->m_orig_glStencilFuncSeparateATI = this->m_ptr_glStencilFuncSeparateATI;
+if(this->m_ptr_glStencilFuncSeparateATI)this->m_ptr_glStencilFuncSeparateATI = (FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC)&ProfilingTableDecorator::m_glStencilFuncSeparateATI_profile;
+this->m_names[1610] = "glProgramUniform2iv";
+this->m_orig_glProgramUniform2iv = this->m_ptr_glProgramUniform2iv;
+if(this->m_ptr_glProgramUniform2iv)this->m_ptr_glProgramUniform2iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC)&ProfilingTableDecorator::m_glProgramUniform2iv_profile;
+this->m_names[1611] = "glGetQueryiv";
+this->m_orig_glGetQueryiv = this->m_ptr_glGetQueryiv;
+if(this->m_ptr_glGetQueryiv)this->m_ptr_glGetQueryiv = (FunctionTable::MEMBERPFNGLGETQUERYIVPROC)&ProfilingTableDecorator::m_glGetQueryiv_profile;
+this->m_names[1612] = "glTexCoord4f";
+this->m_orig_glTexCoord4f = this->m_ptr_glTexCoord4f;
+if(this->m_ptr_glTexCoord4f)this->m_ptr_glTexCoord4f = (FunctionTable::MEMBERPFNGLTEXCOORD4FPROC)&ProfilingTableDecorator::m_glTexCoord4f_profile;
+this->m_names[1613] = "glMapGrid2f";
+this->m_orig_glMapGrid2f = this->m_ptr_glMapGrid2f;
+if(this->m_ptr_glMapGrid2f)this->m_ptr_glMapGrid2f = (FunctionTable::MEMBERPFNGLMAPGRID2FPROC)&ProfilingTableDecorator::m_glMapGrid2f_profile;
+this->m_names[1614] = "glListParameterivSGIX";
+this->m_orig_glListParameterivSGIX = this->m_ptr_glListParameterivSGIX;
+if(this->m_ptr_glListParameterivSGIX)this->m_ptr_glListParameterivSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC)&ProfilingTableDecorator::m_glListParameterivSGIX_profile;
+this->m_names[1615] = "glCreateQueries";
+this->m_orig_glCreateQueries = this->m_ptr_glCreateQueries;
+if(this->m_ptr_glCreateQueries)this->m_ptr_glCreateQueries = (FunctionTable::MEMBERPFNGLCREATEQUERIESPROC)&ProfilingTableDecorator::m_glCreateQueries_profile;
+this->m_names[1616] = "glGetSamplerParameterfv";
+this->m_orig_glGetSamplerParameterfv = this->m_ptr_glGetSamplerParameterfv;
+if(this->m_ptr_glGetSamplerParameterfv)this->m_ptr_glGetSamplerParameterfv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterfv_profile;
+this->m_names[1617] = "glTexCoord4i";
+this->m_orig_glTexCoord4i = this->m_ptr_glTexCoord4i;
+if(this->m_ptr_glTexCoord4i)this->m_ptr_glTexCoord4i = (FunctionTable::MEMBERPFNGLTEXCOORD4IPROC)&ProfilingTableDecorator::m_glTexCoord4i_profile;
+this->m_names[1618] = "glObjectLabel";
+this->m_orig_glObjectLabel = this->m_ptr_glObjectLabel;
+if(this->m_ptr_glObjectLabel)this->m_ptr_glObjectLabel = (FunctionTable::MEMBERPFNGLOBJECTLABELPROC)&ProfilingTableDecorator::m_glObjectLabel_profile;
+this->m_names[1619] = "glProgramUniform3i64NV";
+this->m_orig_glProgramUniform3i64NV = this->m_ptr_glProgramUniform3i64NV;
+if(this->m_ptr_glProgramUniform3i64NV)this->m_ptr_glProgramUniform3i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform3i64NV_profile;
+this->m_names[1620] = "glGetTextureHandleARB";
+this->m_orig_glGetTextureHandleARB = this->m_ptr_glGetTextureHandleARB;
+if(this->m_ptr_glGetTextureHandleARB)this->m_ptr_glGetTextureHandleARB = (FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC)&ProfilingTableDecorator::m_glGetTextureHandleARB_profile;
+this->m_names[1621] = "glTexCoord4s";
+this->m_orig_glTexCoord4s = this->m_ptr_glTexCoord4s;
+if(this->m_ptr_glTexCoord4s)this->m_ptr_glTexCoord4s = (FunctionTable::MEMBERPFNGLTEXCOORD4SPROC)&ProfilingTableDecorator::m_glTexCoord4s_profile;
+this->m_names[1622] = "glUniform4iARB";
+this->m_orig_glUniform4iARB = this->m_ptr_glUniform4iARB;
+if(this->m_ptr_glUniform4iARB)this->m_ptr_glUniform4iARB = (FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC)&ProfilingTableDecorator::m_glUniform4iARB_profile;
+this->m_names[1623] = "glGetUniformIndices";
+this->m_orig_glGetUniformIndices = this->m_ptr_glGetUniformIndices;
+if(this->m_ptr_glGetUniformIndices)this->m_ptr_glGetUniformIndices = (FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC)&ProfilingTableDecorator::m_glGetUniformIndices_profile;
+this->m_names[1624] = "glMultiTexImage3DEXT";
+this->m_orig_glMultiTexImage3DEXT = this->m_ptr_glMultiTexImage3DEXT;
+if(this->m_ptr_glMultiTexImage3DEXT)this->m_ptr_glMultiTexImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glMultiTexImage3DEXT_profile;
+this->m_names[1625] = "glCoverageModulationTableNV";
+this->m_orig_glCoverageModulationTableNV = this->m_ptr_glCoverageModulationTableNV;
+if(this->m_ptr_glCoverageModulationTableNV)this->m_ptr_glCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC)&ProfilingTableDecorator::m_glCoverageModulationTableNV_profile;
+this->m_names[1626] = "glPointParameteriv";
+this->m_orig_glPointParameteriv = this->m_ptr_glPointParameteriv;
+if(this->m_ptr_glPointParameteriv)this->m_ptr_glPointParameteriv = (FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC)&ProfilingTableDecorator::m_glPointParameteriv_profile;
+this->m_names[1627] = "glMultiTexCoord4svARB";
+this->m_orig_glMultiTexCoord4svARB = this->m_ptr_glMultiTexCoord4svARB;
+if(this->m_ptr_glMultiTexCoord4svARB)this->m_ptr_glMultiTexCoord4svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4svARB_profile;
+this->m_names[1628] = "glNormal3fv";
+this->m_orig_glNormal3fv = this->m_ptr_glNormal3fv;
+if(this->m_ptr_glNormal3fv)this->m_ptr_glNormal3fv = (FunctionTable::MEMBERPFNGLNORMAL3FVPROC)&ProfilingTableDecorator::m_glNormal3fv_profile;
+this->m_names[1629] = "glProgramUniformMatrix3x4dvEXT";
+this->m_orig_glProgramUniformMatrix3x4dvEXT = this->m_ptr_glProgramUniformMatrix3x4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x4dvEXT)this->m_ptr_glProgramUniformMatrix3x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4dvEXT_profile;
+this->m_names[1630] = "glTexCoord1fv";
+this->m_orig_glTexCoord1fv = this->m_ptr_glTexCoord1fv;
+if(this->m_ptr_glTexCoord1fv)this->m_ptr_glTexCoord1fv = (FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC)&ProfilingTableDecorator::m_glTexCoord1fv_profile;
+this->m_names[1631] = "glProgramUniformMatrix4x3dvEXT";
+this->m_orig_glProgramUniformMatrix4x3dvEXT = this->m_ptr_glProgramUniformMatrix4x3dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x3dvEXT)this->m_ptr_glProgramUniformMatrix4x3dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3dvEXT_profile;
+this->m_names[1632] = "glGetActiveVaryingNV";
+this->m_orig_glGetActiveVaryingNV = this->m_ptr_glGetActiveVaryingNV;
+if(this->m_ptr_glGetActiveVaryingNV)this->m_ptr_glGetActiveVaryingNV = (FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC)&ProfilingTableDecorator::m_glGetActiveVaryingNV_profile;
+this->m_names[1633] = "glUniform1i64vARB";
+this->m_orig_glUniform1i64vARB = this->m_ptr_glUniform1i64vARB;
+if(this->m_ptr_glUniform1i64vARB)this->m_ptr_glUniform1i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC)&ProfilingTableDecorator::m_glUniform1i64vARB_profile;
+this->m_names[1634] = "glMultiTexCoord1dv";
+this->m_orig_glMultiTexCoord1dv = this->m_ptr_glMultiTexCoord1dv;
+if(this->m_ptr_glMultiTexCoord1dv)this->m_ptr_glMultiTexCoord1dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dv_profile;
+this->m_names[1635] = "glTexCoord3fv";
+this->m_orig_glTexCoord3fv = this->m_ptr_glTexCoord3fv;
+if(this->m_ptr_glTexCoord3fv)this->m_ptr_glTexCoord3fv = (FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC)&ProfilingTableDecorator::m_glTexCoord3fv_profile;
+this->m_names[1636] = "glMatrixTranslatefEXT";
+this->m_orig_glMatrixTranslatefEXT = this->m_ptr_glMatrixTranslatefEXT;
+if(this->m_ptr_glMatrixTranslatefEXT)this->m_ptr_glMatrixTranslatefEXT = (FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC)&ProfilingTableDecorator::m_glMatrixTranslatefEXT_profile;
+this->m_names[1637] = "glProgramUniform1ui64vNV";
+this->m_orig_glProgramUniform1ui64vNV = this->m_ptr_glProgramUniform1ui64vNV;
+if(this->m_ptr_glProgramUniform1ui64vNV)this->m_ptr_glProgramUniform1ui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64vNV_profile;
+this->m_names[1638] = "glTextureMaterialEXT";
+this->m_orig_glTextureMaterialEXT = this->m_ptr_glTextureMaterialEXT;
+if(this->m_ptr_glTextureMaterialEXT)this->m_ptr_glTextureMaterialEXT = (FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC)&ProfilingTableDecorator::m_glTextureMaterialEXT_profile;
+this->m_names[1639] = "glMultiTexCoordP3uiv";
+this->m_orig_glMultiTexCoordP3uiv = this->m_ptr_glMultiTexCoordP3uiv;
+if(this->m_ptr_glMultiTexCoordP3uiv)this->m_ptr_glMultiTexCoordP3uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP3uiv_profile;
+this->m_names[1640] = "glVertexAttribP3ui";
+this->m_orig_glVertexAttribP3ui = this->m_ptr_glVertexAttribP3ui;
+if(this->m_ptr_glVertexAttribP3ui)this->m_ptr_glVertexAttribP3ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC)&ProfilingTableDecorator::m_glVertexAttribP3ui_profile;
+this->m_names[1641] = "glInterpolatePathsNV";
+this->m_orig_glInterpolatePathsNV = this->m_ptr_glInterpolatePathsNV;
+if(this->m_ptr_glInterpolatePathsNV)this->m_ptr_glInterpolatePathsNV = (FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC)&ProfilingTableDecorator::m_glInterpolatePathsNV_profile;
+this->m_names[1642] = "glTextureBufferRange";
+this->m_orig_glTextureBufferRange = this->m_ptr_glTextureBufferRange;
+if(this->m_ptr_glTextureBufferRange)this->m_ptr_glTextureBufferRange = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC)&ProfilingTableDecorator::m_glTextureBufferRange_profile;
+this->m_names[1643] = "glVertexAttribL2dEXT";
+this->m_orig_glVertexAttribL2dEXT = this->m_ptr_glVertexAttribL2dEXT;
+if(this->m_ptr_glVertexAttribL2dEXT)this->m_ptr_glVertexAttribL2dEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC)&ProfilingTableDecorator::m_glVertexAttribL2dEXT_profile;
+this->m_names[1644] = "glGetPixelTransformParameterivEXT";
+this->m_orig_glGetPixelTransformParameterivEXT = this->m_ptr_glGetPixelTransformParameterivEXT;
+if(this->m_ptr_glGetPixelTransformParameterivEXT)this->m_ptr_glGetPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetPixelTransformParameterivEXT_profile;
+this->m_names[1645] = "glTexCoord4xvOES";
+this->m_orig_glTexCoord4xvOES = this->m_ptr_glTexCoord4xvOES;
+if(this->m_ptr_glTexCoord4xvOES)this->m_ptr_glTexCoord4xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC)&ProfilingTableDecorator::m_glTexCoord4xvOES_profile;
+this->m_names[1646] = "glGetVariantBooleanvEXT";
+this->m_orig_glGetVariantBooleanvEXT = this->m_ptr_glGetVariantBooleanvEXT;
+if(this->m_ptr_glGetVariantBooleanvEXT)this->m_ptr_glGetVariantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetVariantBooleanvEXT_profile;
+this->m_names[1647] = "glDepthRange";
+this->m_orig_glDepthRange = this->m_ptr_glDepthRange;
+if(this->m_ptr_glDepthRange)this->m_ptr_glDepthRange = (FunctionTable::MEMBERPFNGLDEPTHRANGEPROC)&ProfilingTableDecorator::m_glDepthRange_profile;
+this->m_names[1648] = "glGetVertexAttribdvARB";
+this->m_orig_glGetVertexAttribdvARB = this->m_ptr_glGetVertexAttribdvARB;
+if(this->m_ptr_glGetVertexAttribdvARB)this->m_ptr_glGetVertexAttribdvARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribdvARB_profile;
+this->m_names[1649] = "glGetColorTableParameterfv";
+this->m_orig_glGetColorTableParameterfv = this->m_ptr_glGetColorTableParameterfv;
+if(this->m_ptr_glGetColorTableParameterfv)this->m_ptr_glGetColorTableParameterfv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfv_profile;
+this->m_names[1650] = "glDrawArraysInstancedEXT";
+this->m_orig_glDrawArraysInstancedEXT = this->m_ptr_glDrawArraysInstancedEXT;
+if(this->m_ptr_glDrawArraysInstancedEXT)this->m_ptr_glDrawArraysInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedEXT_profile;
+this->m_names[1651] = "glDisableClientStateIndexedEXT";
+this->m_orig_glDisableClientStateIndexedEXT = this->m_ptr_glDisableClientStateIndexedEXT;
+if(this->m_ptr_glDisableClientStateIndexedEXT)this->m_ptr_glDisableClientStateIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glDisableClientStateIndexedEXT_profile;
+this->m_names[1652] = "glDrawBuffer";
+this->m_orig_glDrawBuffer = this->m_ptr_glDrawBuffer;
+if(this->m_ptr_glDrawBuffer)this->m_ptr_glDrawBuffer = (FunctionTable::MEMBERPFNGLDRAWBUFFERPROC)&ProfilingTableDecorator::m_glDrawBuffer_profile;
+this->m_names[1653] = "glMultiDrawArraysIndirectBindlessNV";
+this->m_orig_glMultiDrawArraysIndirectBindlessNV = this->m_ptr_glMultiDrawArraysIndirectBindlessNV;
+if(this->m_ptr_glMultiDrawArraysIndirectBindlessNV)this->m_ptr_glMultiDrawArraysIndirectBindlessNV = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirectBindlessNV_profile;
+this->m_names[1654] = "glGetnPixelMapusv";
+this->m_orig_glGetnPixelMapusv = this->m_ptr_glGetnPixelMapusv;
+if(this->m_ptr_glGetnPixelMapusv)this->m_ptr_glGetnPixelMapusv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC)&ProfilingTableDecorator::m_glGetnPixelMapusv_profile;
+this->m_names[1655] = "glRasterPos3fv";
+this->m_orig_glRasterPos3fv = this->m_ptr_glRasterPos3fv;
+if(this->m_ptr_glRasterPos3fv)this->m_ptr_glRasterPos3fv = (FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC)&ProfilingTableDecorator::m_glRasterPos3fv_profile;
+this->m_names[1656] = "glClearBufferuiv";
+this->m_orig_glClearBufferuiv = this->m_ptr_glClearBufferuiv;
+if(this->m_ptr_glClearBufferuiv)this->m_ptr_glClearBufferuiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC)&ProfilingTableDecorator::m_glClearBufferuiv_profile;
+this->m_names[1657] = "glGetInternalformati64v";
+this->m_orig_glGetInternalformati64v = this->m_ptr_glGetInternalformati64v;
+if(this->m_ptr_glGetInternalformati64v)this->m_ptr_glGetInternalformati64v = (FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC)&ProfilingTableDecorator::m_glGetInternalformati64v_profile;
+this->m_names[1658] = "glShaderSourceARB";
+this->m_orig_glShaderSourceARB = this->m_ptr_glShaderSourceARB;
+if(this->m_ptr_glShaderSourceARB)this->m_ptr_glShaderSourceARB = (FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC)&ProfilingTableDecorator::m_glShaderSourceARB_profile;
+this->m_names[1659] = "glShaderOp3EXT";
+this->m_orig_glShaderOp3EXT = this->m_ptr_glShaderOp3EXT;
+if(this->m_ptr_glShaderOp3EXT)this->m_ptr_glShaderOp3EXT = (FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC)&ProfilingTableDecorator::m_glShaderOp3EXT_profile;
+this->m_names[1660] = "glWindowPos2dvMESA";
+this->m_orig_glWindowPos2dvMESA = this->m_ptr_glWindowPos2dvMESA;
+if(this->m_ptr_glWindowPos2dvMESA)this->m_ptr_glWindowPos2dvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2dvMESA_profile;
+this->m_names[1661] = "glClearIndex";
+this->m_orig_glClearIndex = this->m_ptr_glClearIndex;
+if(this->m_ptr_glClearIndex)this->m_ptr_glClearIndex = (FunctionTable::MEMBERPFNGLCLEARINDEXPROC)&ProfilingTableDecorator::m_glClearIndex_profile;
+this->m_names[1662] = "glProvokingVertexEXT";
+this->m_orig_glProvokingVertexEXT = this->m_ptr_glProvokingVertexEXT;
+if(this->m_ptr_glProvokingVertexEXT)this->m_ptr_glProvokingVertexEXT = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC)&ProfilingTableDecorator::m_glProvokingVertexEXT_profile;
+this->m_names[1663] = "glVariantubvEXT";
+this->m_orig_glVariantubvEXT = this->m_ptr_glVariantubvEXT;
+if(this->m_ptr_glVariantubvEXT)this->m_ptr_glVariantubvEXT = (FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC)&ProfilingTableDecorator::m_glVariantubvEXT_profile;
+this->m_names[1664] = "glFlush";
+this->m_orig_glFlush = this->m_ptr_glFlush;
+if(this->m_ptr_glFlush)this->m_ptr_glFlush = (FunctionTable::MEMBERPFNGLFLUSHPROC)&ProfilingTableDecorator::m_glFlush_profile;
+this->m_names[1665] = "glFramebufferTexture2DEXT";
+this->m_orig_glFramebufferTexture2DEXT = this->m_ptr_glFramebufferTexture2DEXT;
+if(this->m_ptr_glFramebufferTexture2DEXT)this->m_ptr_glFramebufferTexture2DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture2DEXT_profile;
+this->m_names[1666] = "glGetColorTableParameterivEXT";
+this->m_orig_glGetColorTableParameterivEXT = this->m_ptr_glGetColorTableParameterivEXT;
+if(this->m_ptr_glGetColorTableParameterivEXT)this->m_ptr_glGetColorTableParameterivEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetColorTableParameterivEXT_profile;
+this->m_names[1667] = "glPresentFrameDualFillNV";
+this->m_orig_glPresentFrameDualFillNV = this->m_ptr_glPresentFrameDualFillNV;
+if(this->m_ptr_glPresentFrameDualFillNV)this->m_ptr_glPresentFrameDualFillNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC)&ProfilingTableDecorator::m_glPresentFrameDualFillNV_profile;
+this->m_names[1668] = "glGenVertexShadersEXT";
+this->m_orig_glGenVertexShadersEXT = this->m_ptr_glGenVertexShadersEXT;
+if(this->m_ptr_glGenVertexShadersEXT)this->m_ptr_glGenVertexShadersEXT = (FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC)&ProfilingTableDecorator::m_glGenVertexShadersEXT_profile;
+this->m_names[1669] = "glSpecializeShaderARB";
+this->m_orig_glSpecializeShaderARB = this->m_ptr_glSpecializeShaderARB;
+if(this->m_ptr_glSpecializeShaderARB)this->m_ptr_glSpecializeShaderARB = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC)&ProfilingTableDecorator::m_glSpecializeShaderARB_profile;
+this->m_names[1670] = "glProgramUniformHandleui64vARB";
+this->m_orig_glProgramUniformHandleui64vARB = this->m_ptr_glProgramUniformHandleui64vARB;
+if(this->m_ptr_glProgramUniformHandleui64vARB)this->m_ptr_glProgramUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64vARB_profile;
+this->m_names[1671] = "glDepthRangefOES";
+this->m_orig_glDepthRangefOES = this->m_ptr_glDepthRangefOES;
+if(this->m_ptr_glDepthRangefOES)this->m_ptr_glDepthRangefOES = (FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC)&ProfilingTableDecorator::m_glDepthRangefOES_profile;
+this->m_names[1672] = "glDeleteVertexArrays";
+this->m_orig_glDeleteVertexArrays = this->m_ptr_glDeleteVertexArrays;
+if(this->m_ptr_glDeleteVertexArrays)this->m_ptr_glDeleteVertexArrays = (FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glDeleteVertexArrays_profile;
+this->m_names[1673] = "glDrawElementsInstancedBaseVertexBaseInstance";
+this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance = this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance;
+if(this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance)this->m_ptr_glDrawElementsInstancedBaseVertexBaseInstance = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseVertexBaseInstance_profile;
+this->m_names[1674] = "glGetTexLevelParameteriv";
+this->m_orig_glGetTexLevelParameteriv = this->m_ptr_glGetTexLevelParameteriv;
+if(this->m_ptr_glGetTexLevelParameteriv)this->m_ptr_glGetTexLevelParameteriv = (FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTexLevelParameteriv_profile;
+this->m_names[1675] = "glDrawVkImageNV";
+this->m_orig_glDrawVkImageNV = this->m_ptr_glDrawVkImageNV;
+if(this->m_ptr_glDrawVkImageNV)this->m_ptr_glDrawVkImageNV = (FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC)&ProfilingTableDecorator::m_glDrawVkImageNV_profile;
+this->m_names[1676] = "glWindowPos3iARB";
+this->m_orig_glWindowPos3iARB = this->m_ptr_glWindowPos3iARB;
+if(this->m_ptr_glWindowPos3iARB)this->m_ptr_glWindowPos3iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC)&ProfilingTableDecorator::m_glWindowPos3iARB_profile;
+this->m_names[1677] = "glPrioritizeTextures";
+this->m_orig_glPrioritizeTextures = this->m_ptr_glPrioritizeTextures;
+if(this->m_ptr_glPrioritizeTextures)this->m_ptr_glPrioritizeTextures = (FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC)&ProfilingTableDecorator::m_glPrioritizeTextures_profile;
+this->m_names[1678] = "glWindowPos3fvMESA";
+this->m_orig_glWindowPos3fvMESA = this->m_ptr_glWindowPos3fvMESA;
+if(this->m_ptr_glWindowPos3fvMESA)this->m_ptr_glWindowPos3fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos3fvMESA_profile;
+this->m_names[1679] = "glProgramUniformMatrix3x2dvEXT";
+this->m_orig_glProgramUniformMatrix3x2dvEXT = this->m_ptr_glProgramUniformMatrix3x2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix3x2dvEXT)this->m_ptr_glProgramUniformMatrix3x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2dvEXT_profile;
+this->m_names[1680] = "glVertex4xvOES";
+this->m_orig_glVertex4xvOES = this->m_ptr_glVertex4xvOES;
+if(this->m_ptr_glVertex4xvOES)this->m_ptr_glVertex4xvOES = (FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC)&ProfilingTableDecorator::m_glVertex4xvOES_profile;
+this->m_names[1681] = "glTexStorage3DMultisample";
+this->m_orig_glTexStorage3DMultisample = this->m_ptr_glTexStorage3DMultisample;
+if(this->m_ptr_glTexStorage3DMultisample)this->m_ptr_glTexStorage3DMultisample = (FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexStorage3DMultisample_profile;
+this->m_names[1682] = "glWindowPos2sARB";
+this->m_orig_glWindowPos2sARB = this->m_ptr_glWindowPos2sARB;
+if(this->m_ptr_glWindowPos2sARB)this->m_ptr_glWindowPos2sARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC)&ProfilingTableDecorator::m_glWindowPos2sARB_profile;
+this->m_names[1683] = "glStencilOpValueAMD";
+this->m_orig_glStencilOpValueAMD = this->m_ptr_glStencilOpValueAMD;
+if(this->m_ptr_glStencilOpValueAMD)this->m_ptr_glStencilOpValueAMD = (FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC)&ProfilingTableDecorator::m_glStencilOpValueAMD_profile;
+this->m_names[1684] = "glProgramVertexLimitNV";
+this->m_orig_glProgramVertexLimitNV = this->m_ptr_glProgramVertexLimitNV;
+if(this->m_ptr_glProgramVertexLimitNV)this->m_ptr_glProgramVertexLimitNV = (FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC)&ProfilingTableDecorator::m_glProgramVertexLimitNV_profile;
+this->m_names[1685] = "glGetTexParameterPointervAPPLE";
+this->m_orig_glGetTexParameterPointervAPPLE = this->m_ptr_glGetTexParameterPointervAPPLE;
+if(this->m_ptr_glGetTexParameterPointervAPPLE)this->m_ptr_glGetTexParameterPointervAPPLE = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)&ProfilingTableDecorator::m_glGetTexParameterPointervAPPLE_profile;
+this->m_names[1686] = "glProgramUniform3uivEXT";
+this->m_orig_glProgramUniform3uivEXT = this->m_ptr_glProgramUniform3uivEXT;
+if(this->m_ptr_glProgramUniform3uivEXT)this->m_ptr_glProgramUniform3uivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3uivEXT_profile;
+this->m_names[1687] = "glClampColor";
+this->m_orig_glClampColor = this->m_ptr_glClampColor;
+if(this->m_ptr_glClampColor)this->m_ptr_glClampColor = (FunctionTable::MEMBERPFNGLCLAMPCOLORPROC)&ProfilingTableDecorator::m_glClampColor_profile;
+this->m_names[1688] = "glClearStencil";
+this->m_orig_glClearStencil = this->m_ptr_glClearStencil;
+if(this->m_ptr_glClearStencil)this->m_ptr_glClearStencil = (FunctionTable::MEMBERPFNGLCLEARSTENCILPROC)&ProfilingTableDecorator::m_glClearStencil_profile;
+this->m_names[1689] = "glTexCoordP1uiv";
+this->m_orig_glTexCoordP1uiv = this->m_ptr_glTexCoordP1uiv;
+if(this->m_ptr_glTexCoordP1uiv)this->m_ptr_glTexCoordP1uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC)&ProfilingTableDecorator::m_glTexCoordP1uiv_profile;
+this->m_names[1690] = "glVertexAttribs3svNV";
+this->m_orig_glVertexAttribs3svNV = this->m_ptr_glVertexAttribs3svNV;
+if(this->m_ptr_glVertexAttribs3svNV)this->m_ptr_glVertexAttribs3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3svNV_profile;
+this->m_names[1691] = "glMultiTexCoord3fv";
+this->m_orig_glMultiTexCoord3fv = this->m_ptr_glMultiTexCoord3fv;
+if(this->m_ptr_glMultiTexCoord3fv)this->m_ptr_glMultiTexCoord3fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3fv_profile;
+this->m_names[1692] = "glVertexBlendEnvfATI";
+this->m_orig_glVertexBlendEnvfATI = this->m_ptr_glVertexBlendEnvfATI;
+if(this->m_ptr_glVertexBlendEnvfATI)this->m_ptr_glVertexBlendEnvfATI = (FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC)&ProfilingTableDecorator::m_glVertexBlendEnvfATI_profile;
+this->m_names[1693] = "glIsFenceAPPLE";
+this->m_orig_glIsFenceAPPLE = this->m_ptr_glIsFenceAPPLE;
+if(this->m_ptr_glIsFenceAPPLE)this->m_ptr_glIsFenceAPPLE = (FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC)&ProfilingTableDecorator::m_glIsFenceAPPLE_profile;
+this->m_names[1694] = "glGetBufferParameterui64vNV";
+this->m_orig_glGetBufferParameterui64vNV = this->m_ptr_glGetBufferParameterui64vNV;
+if(this->m_ptr_glGetBufferParameterui64vNV)this->m_ptr_glGetBufferParameterui64vNV = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC)&ProfilingTableDecorator::m_glGetBufferParameterui64vNV_profile;
+this->m_names[1695] = "glVertexAttribI4bvEXT";
+this->m_orig_glVertexAttribI4bvEXT = this->m_ptr_glVertexAttribI4bvEXT;
+if(this->m_ptr_glVertexAttribI4bvEXT)this->m_ptr_glVertexAttribI4bvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4bvEXT_profile;
+this->m_names[1696] = "glUniform2fARB";
+this->m_orig_glUniform2fARB = this->m_ptr_glUniform2fARB;
+if(this->m_ptr_glUniform2fARB)this->m_ptr_glUniform2fARB = (FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC)&ProfilingTableDecorator::m_glUniform2fARB_profile;
+this->m_names[1697] = "glStopInstrumentsSGIX";
+this->m_orig_glStopInstrumentsSGIX = this->m_ptr_glStopInstrumentsSGIX;
+if(this->m_ptr_glStopInstrumentsSGIX)this->m_ptr_glStopInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glStopInstrumentsSGIX_profile;
+this->m_names[1698] = "glVertexAttrib3fNV";
+this->m_orig_glVertexAttrib3fNV = this->m_ptr_glVertexAttrib3fNV;
+if(this->m_ptr_glVertexAttrib3fNV)this->m_ptr_glVertexAttrib3fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fNV_profile;
+this->m_names[1699] = "glMapVertexAttrib2dAPPLE";
+this->m_orig_glMapVertexAttrib2dAPPLE = this->m_ptr_glMapVertexAttrib2dAPPLE;
+if(this->m_ptr_glMapVertexAttrib2dAPPLE)this->m_ptr_glMapVertexAttrib2dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib2dAPPLE_profile;
+this->m_names[1700] = "glVertex2f";
+this->m_orig_glVertex2f = this->m_ptr_glVertex2f;
+if(this->m_ptr_glVertex2f)this->m_ptr_glVertex2f = (FunctionTable::MEMBERPFNGLVERTEX2FPROC)&ProfilingTableDecorator::m_glVertex2f_profile;
+this->m_names[1701] = "glCopyTextureImage2DEXT";
+this->m_orig_glCopyTextureImage2DEXT = this->m_ptr_glCopyTextureImage2DEXT;
+if(this->m_ptr_glCopyTextureImage2DEXT)this->m_ptr_glCopyTextureImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureImage2DEXT_profile;
+this->m_names[1702] = "glVertex2d";
+this->m_orig_glVertex2d = this->m_ptr_glVertex2d;
+if(this->m_ptr_glVertex2d)this->m_ptr_glVertex2d = (FunctionTable::MEMBERPFNGLVERTEX2DPROC)&ProfilingTableDecorator::m_glVertex2d_profile;
+this->m_names[1703] = "glSecondaryColor3bvEXT";
+this->m_orig_glSecondaryColor3bvEXT = this->m_ptr_glSecondaryColor3bvEXT;
+if(this->m_ptr_glSecondaryColor3bvEXT)this->m_ptr_glSecondaryColor3bvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3bvEXT_profile;
+this->m_names[1704] = "glMultiTexCoord4fARB";
+this->m_orig_glMultiTexCoord4fARB = this->m_ptr_glMultiTexCoord4fARB;
+if(this->m_ptr_glMultiTexCoord4fARB)this->m_ptr_glMultiTexCoord4fARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fARB_profile;
+this->m_names[1705] = "glPolygonOffset";
+this->m_orig_glPolygonOffset = this->m_ptr_glPolygonOffset;
+if(this->m_ptr_glPolygonOffset)this->m_ptr_glPolygonOffset = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC)&ProfilingTableDecorator::m_glPolygonOffset_profile;
+this->m_names[1706] = "glTangent3bvEXT";
+this->m_orig_glTangent3bvEXT = this->m_ptr_glTangent3bvEXT;
+if(this->m_ptr_glTangent3bvEXT)this->m_ptr_glTangent3bvEXT = (FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC)&ProfilingTableDecorator::m_glTangent3bvEXT_profile;
+this->m_names[1707] = "glHistogram";
+this->m_orig_glHistogram = this->m_ptr_glHistogram;
+if(this->m_ptr_glHistogram)this->m_ptr_glHistogram = (FunctionTable::MEMBERPFNGLHISTOGRAMPROC)&ProfilingTableDecorator::m_glHistogram_profile;
+this->m_names[1708] = "glGetProgramiv";
+this->m_orig_glGetProgramiv = this->m_ptr_glGetProgramiv;
+if(this->m_ptr_glGetProgramiv)this->m_ptr_glGetProgramiv = (FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC)&ProfilingTableDecorator::m_glGetProgramiv_profile;
+this->m_names[1709] = "glMatrixIndexubvARB";
+this->m_orig_glMatrixIndexubvARB = this->m_ptr_glMatrixIndexubvARB;
+if(this->m_ptr_glMatrixIndexubvARB)this->m_ptr_glMatrixIndexubvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexubvARB_profile;
+this->m_names[1710] = "glVertex2s";
+this->m_orig_glVertex2s = this->m_ptr_glVertex2s;
+if(this->m_ptr_glVertex2s)this->m_ptr_glVertex2s = (FunctionTable::MEMBERPFNGLVERTEX2SPROC)&ProfilingTableDecorator::m_glVertex2s_profile;
+this->m_names[1711] = "glGetVertexAttribLui64vNV";
+this->m_orig_glGetVertexAttribLui64vNV = this->m_ptr_glGetVertexAttribLui64vNV;
+if(this->m_ptr_glGetVertexAttribLui64vNV)this->m_ptr_glGetVertexAttribLui64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLui64vNV_profile;
+this->m_names[1712] = "glGetProgramStringARB";
+this->m_orig_glGetProgramStringARB = this->m_ptr_glGetProgramStringARB;
+if(this->m_ptr_glGetProgramStringARB)this->m_ptr_glGetProgramStringARB = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC)&ProfilingTableDecorator::m_glGetProgramStringARB_profile;
+this->m_names[1713] = "glFlushMappedBufferRange";
+this->m_orig_glFlushMappedBufferRange = this->m_ptr_glFlushMappedBufferRange;
+if(this->m_ptr_glFlushMappedBufferRange)this->m_ptr_glFlushMappedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glFlushMappedBufferRange_profile;
+this->m_names[1714] = "glVertexAttribI3uiEXT";
+this->m_orig_glVertexAttribI3uiEXT = this->m_ptr_glVertexAttribI3uiEXT;
+if(this->m_ptr_glVertexAttribI3uiEXT)this->m_ptr_glVertexAttribI3uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI3uiEXT_profile;
+this->m_names[1715] = "glLineWidthxOES";
+this->m_orig_glLineWidthxOES = this->m_ptr_glLineWidthxOES;
+if(this->m_ptr_glLineWidthxOES)this->m_ptr_glLineWidthxOES = (FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC)&ProfilingTableDecorator::m_glLineWidthxOES_profile;
+this->m_names[1716] = "glProgramUniformMatrix2fvEXT";
+this->m_orig_glProgramUniformMatrix2fvEXT = this->m_ptr_glProgramUniformMatrix2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix2fvEXT)this->m_ptr_glProgramUniformMatrix2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2fvEXT_profile;
+this->m_names[1717] = "glGetTextureParameterIuivEXT";
+this->m_orig_glGetTextureParameterIuivEXT = this->m_ptr_glGetTextureParameterIuivEXT;
+if(this->m_ptr_glGetTextureParameterIuivEXT)this->m_ptr_glGetTextureParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterIuivEXT_profile;
+this->m_names[1718] = "glGetMultiTexEnvivEXT";
+this->m_orig_glGetMultiTexEnvivEXT = this->m_ptr_glGetMultiTexEnvivEXT;
+if(this->m_ptr_glGetMultiTexEnvivEXT)this->m_ptr_glGetMultiTexEnvivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexEnvivEXT_profile;
+this->m_names[1719] = "glPixelTexGenParameterivSGIS";
+this->m_orig_glPixelTexGenParameterivSGIS = this->m_ptr_glPixelTexGenParameterivSGIS;
+if(this->m_ptr_glPixelTexGenParameterivSGIS)this->m_ptr_glPixelTexGenParameterivSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterivSGIS_profile;
+this->m_names[1720] = "glGenQueries";
+this->m_orig_glGenQueries = this->m_ptr_glGenQueries;
+if(this->m_ptr_glGenQueries)this->m_ptr_glGenQueries = (FunctionTable::MEMBERPFNGLGENQUERIESPROC)&ProfilingTableDecorator::m_glGenQueries_profile;
+this->m_names[1721] = "glGetPixelMapfv";
+this->m_orig_glGetPixelMapfv = this->m_ptr_glGetPixelMapfv;
+if(this->m_ptr_glGetPixelMapfv)this->m_ptr_glGetPixelMapfv = (FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC)&ProfilingTableDecorator::m_glGetPixelMapfv_profile;
+this->m_names[1722] = "glBlendColorEXT";
+this->m_orig_glBlendColorEXT = this->m_ptr_glBlendColorEXT;
+if(this->m_ptr_glBlendColorEXT)this->m_ptr_glBlendColorEXT = (FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC)&ProfilingTableDecorator::m_glBlendColorEXT_profile;
+this->m_names[1723] = "glResetMinmax";
+this->m_orig_glResetMinmax = this->m_ptr_glResetMinmax;
+if(this->m_ptr_glResetMinmax)this->m_ptr_glResetMinmax = (FunctionTable::MEMBERPFNGLRESETMINMAXPROC)&ProfilingTableDecorator::m_glResetMinmax_profile;
+this->m_names[1724] = "glGetnUniformivARB";
+this->m_orig_glGetnUniformivARB = this->m_ptr_glGetnUniformivARB;
+if(this->m_ptr_glGetnUniformivARB)this->m_ptr_glGetnUniformivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC)&ProfilingTableDecorator::m_glGetnUniformivARB_profile;
+this->m_names[1725] = "glVertexBlendARB";
+this->m_orig_glVertexBlendARB = this->m_ptr_glVertexBlendARB;
+if(this->m_ptr_glVertexBlendARB)this->m_ptr_glVertexBlendARB = (FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC)&ProfilingTableDecorator::m_glVertexBlendARB_profile;
+this->m_names[1726] = "glVertexAttrib4d";
+this->m_orig_glVertexAttrib4d = this->m_ptr_glVertexAttrib4d;
+if(this->m_ptr_glVertexAttrib4d)this->m_ptr_glVertexAttrib4d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC)&ProfilingTableDecorator::m_glVertexAttrib4d_profile;
+this->m_names[1727] = "glGetVaryingLocationNV";
+this->m_orig_glGetVaryingLocationNV = this->m_ptr_glGetVaryingLocationNV;
+if(this->m_ptr_glGetVaryingLocationNV)this->m_ptr_glGetVaryingLocationNV = (FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC)&ProfilingTableDecorator::m_glGetVaryingLocationNV_profile;
+this->m_names[1728] = "glGetMapAttribParameterivNV";
+this->m_orig_glGetMapAttribParameterivNV = this->m_ptr_glGetMapAttribParameterivNV;
+if(this->m_ptr_glGetMapAttribParameterivNV)this->m_ptr_glGetMapAttribParameterivNV = (FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetMapAttribParameterivNV_profile;
+this->m_names[1729] = "glTexSubImage3D";
+this->m_orig_glTexSubImage3D = this->m_ptr_glTexSubImage3D;
+if(this->m_ptr_glTexSubImage3D)this->m_ptr_glTexSubImage3D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC)&ProfilingTableDecorator::m_glTexSubImage3D_profile;
+this->m_names[1730] = "glDeleteSamplers";
+this->m_orig_glDeleteSamplers = this->m_ptr_glDeleteSamplers;
+if(this->m_ptr_glDeleteSamplers)this->m_ptr_glDeleteSamplers = (FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC)&ProfilingTableDecorator::m_glDeleteSamplers_profile;
+this->m_names[1731] = "glGetLightxOES";
+this->m_orig_glGetLightxOES = this->m_ptr_glGetLightxOES;
+if(this->m_ptr_glGetLightxOES)this->m_ptr_glGetLightxOES = (FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC)&ProfilingTableDecorator::m_glGetLightxOES_profile;
+this->m_names[1732] = "glGetVertexAttribArrayObjectfvATI";
+this->m_orig_glGetVertexAttribArrayObjectfvATI = this->m_ptr_glGetVertexAttribArrayObjectfvATI;
+if(this->m_ptr_glGetVertexAttribArrayObjectfvATI)this->m_ptr_glGetVertexAttribArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetVertexAttribArrayObjectfvATI_profile;
+this->m_names[1733] = "glVertexArrayNormalOffsetEXT";
+this->m_orig_glVertexArrayNormalOffsetEXT = this->m_ptr_glVertexArrayNormalOffsetEXT;
+if(this->m_ptr_glVertexArrayNormalOffsetEXT)this->m_ptr_glVertexArrayNormalOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayNormalOffsetEXT_profile;
+this->m_names[1734] = "glGetBufferParameterivARB";
+this->m_orig_glGetBufferParameterivARB = this->m_ptr_glGetBufferParameterivARB;
+if(this->m_ptr_glGetBufferParameterivARB)this->m_ptr_glGetBufferParameterivARB = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC)&ProfilingTableDecorator::m_glGetBufferParameterivARB_profile;
+this->m_names[1735] = "glGetTextureParameterfv";
+this->m_orig_glGetTextureParameterfv = this->m_ptr_glGetTextureParameterfv;
+if(this->m_ptr_glGetTextureParameterfv)this->m_ptr_glGetTextureParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTextureParameterfv_profile;
+this->m_names[1736] = "glDrawMeshArraysSUN";
+this->m_orig_glDrawMeshArraysSUN = this->m_ptr_glDrawMeshArraysSUN;
+if(this->m_ptr_glDrawMeshArraysSUN)this->m_ptr_glDrawMeshArraysSUN = (FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC)&ProfilingTableDecorator::m_glDrawMeshArraysSUN_profile;
+this->m_names[1737] = "glVertexAttrib4dNV";
+this->m_orig_glVertexAttrib4dNV = this->m_ptr_glVertexAttrib4dNV;
+if(this->m_ptr_glVertexAttrib4dNV)this->m_ptr_glVertexAttrib4dNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dNV_profile;
+this->m_names[1738] = "glGetMultisamplefvNV";
+this->m_orig_glGetMultisamplefvNV = this->m_ptr_glGetMultisamplefvNV;
+if(this->m_ptr_glGetMultisamplefvNV)this->m_ptr_glGetMultisamplefvNV = (FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC)&ProfilingTableDecorator::m_glGetMultisamplefvNV_profile;
+this->m_names[1739] = "glMapObjectBufferATI";
+this->m_orig_glMapObjectBufferATI = this->m_ptr_glMapObjectBufferATI;
+if(this->m_ptr_glMapObjectBufferATI)this->m_ptr_glMapObjectBufferATI = (FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glMapObjectBufferATI_profile;
+this->m_names[1740] = "glGetPathCommandsNV";
+this->m_orig_glGetPathCommandsNV = this->m_ptr_glGetPathCommandsNV;
+if(this->m_ptr_glGetPathCommandsNV)this->m_ptr_glGetPathCommandsNV = (FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC)&ProfilingTableDecorator::m_glGetPathCommandsNV_profile;
+this->m_names[1741] = "glVertexArrayTexCoordOffsetEXT";
+this->m_orig_glVertexArrayTexCoordOffsetEXT = this->m_ptr_glVertexArrayTexCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayTexCoordOffsetEXT)this->m_ptr_glVertexArrayTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayTexCoordOffsetEXT_profile;
+this->m_names[1742] = "glGetHistogram";
+this->m_orig_glGetHistogram = this->m_ptr_glGetHistogram;
+if(this->m_ptr_glGetHistogram)this->m_ptr_glGetHistogram = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC)&ProfilingTableDecorator::m_glGetHistogram_profile;
+this->m_names[1743] = "glMatrixMode";
+this->m_orig_glMatrixMode = this->m_ptr_glMatrixMode;
+if(this->m_ptr_glMatrixMode)this->m_ptr_glMatrixMode = (FunctionTable::MEMBERPFNGLMATRIXMODEPROC)&ProfilingTableDecorator::m_glMatrixMode_profile;
+this->m_names[1744] = "glColorFormatNV";
+this->m_orig_glColorFormatNV = this->m_ptr_glColorFormatNV;
+if(this->m_ptr_glColorFormatNV)this->m_ptr_glColorFormatNV = (FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC)&ProfilingTableDecorator::m_glColorFormatNV_profile;
+this->m_names[1745] = "glProgramUniformui64NV";
+this->m_orig_glProgramUniformui64NV = this->m_ptr_glProgramUniformui64NV;
+if(this->m_ptr_glProgramUniformui64NV)this->m_ptr_glProgramUniformui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC)&ProfilingTableDecorator::m_glProgramUniformui64NV_profile;
+this->m_names[1746] = "glProgramUniformMatrix4x2fvEXT";
+this->m_orig_glProgramUniformMatrix4x2fvEXT = this->m_ptr_glProgramUniformMatrix4x2fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x2fvEXT)this->m_ptr_glProgramUniformMatrix4x2fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2fvEXT_profile;
+this->m_names[1747] = "glLoadMatrixxOES";
+this->m_orig_glLoadMatrixxOES = this->m_ptr_glLoadMatrixxOES;
+if(this->m_ptr_glLoadMatrixxOES)this->m_ptr_glLoadMatrixxOES = (FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC)&ProfilingTableDecorator::m_glLoadMatrixxOES_profile;
+this->m_names[1748] = "glGetColorTableParameterfvEXT";
+this->m_orig_glGetColorTableParameterfvEXT = this->m_ptr_glGetColorTableParameterfvEXT;
+if(this->m_ptr_glGetColorTableParameterfvEXT)this->m_ptr_glGetColorTableParameterfvEXT = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetColorTableParameterfvEXT_profile;
+this->m_names[1749] = "glRasterPos4i";
+this->m_orig_glRasterPos4i = this->m_ptr_glRasterPos4i;
+if(this->m_ptr_glRasterPos4i)this->m_ptr_glRasterPos4i = (FunctionTable::MEMBERPFNGLRASTERPOS4IPROC)&ProfilingTableDecorator::m_glRasterPos4i_profile;
+this->m_names[1750] = "glVertexAttribL2i64NV";
+this->m_orig_glVertexAttribL2i64NV = this->m_ptr_glVertexAttribL2i64NV;
+if(this->m_ptr_glVertexAttribL2i64NV)this->m_ptr_glVertexAttribL2i64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL2i64NV_profile;
+this->m_names[1751] = "glBindTextures";
+this->m_orig_glBindTextures = this->m_ptr_glBindTextures;
+if(this->m_ptr_glBindTextures)this->m_ptr_glBindTextures = (FunctionTable::MEMBERPFNGLBINDTEXTURESPROC)&ProfilingTableDecorator::m_glBindTextures_profile;
+this->m_names[1752] = "glMatrixRotatefEXT";
+this->m_orig_glMatrixRotatefEXT = this->m_ptr_glMatrixRotatefEXT;
+if(this->m_ptr_glMatrixRotatefEXT)this->m_ptr_glMatrixRotatefEXT = (FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC)&ProfilingTableDecorator::m_glMatrixRotatefEXT_profile;
+this->m_names[1753] = "glGetClipPlanexOES";
+this->m_orig_glGetClipPlanexOES = this->m_ptr_glGetClipPlanexOES;
+if(this->m_ptr_glGetClipPlanexOES)this->m_ptr_glGetClipPlanexOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC)&ProfilingTableDecorator::m_glGetClipPlanexOES_profile;
+this->m_names[1754] = "glSecondaryColor3uivEXT";
+this->m_orig_glSecondaryColor3uivEXT = this->m_ptr_glSecondaryColor3uivEXT;
+if(this->m_ptr_glSecondaryColor3uivEXT)this->m_ptr_glSecondaryColor3uivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3uivEXT_profile;
+this->m_names[1755] = "glGetPerfQueryInfoINTEL";
+this->m_orig_glGetPerfQueryInfoINTEL = this->m_ptr_glGetPerfQueryInfoINTEL;
+if(this->m_ptr_glGetPerfQueryInfoINTEL)this->m_ptr_glGetPerfQueryInfoINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryInfoINTEL_profile;
+this->m_names[1756] = "glGetDoublev";
+this->m_orig_glGetDoublev = this->m_ptr_glGetDoublev;
+if(this->m_ptr_glGetDoublev)this->m_ptr_glGetDoublev = (FunctionTable::MEMBERPFNGLGETDOUBLEVPROC)&ProfilingTableDecorator::m_glGetDoublev_profile;
+this->m_names[1757] = "glBindBufferRangeEXT";
+this->m_orig_glBindBufferRangeEXT = this->m_ptr_glBindBufferRangeEXT;
+if(this->m_ptr_glBindBufferRangeEXT)this->m_ptr_glBindBufferRangeEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glBindBufferRangeEXT_profile;
+this->m_names[1758] = "glCompressedTexImage2D";
+this->m_orig_glCompressedTexImage2D = this->m_ptr_glCompressedTexImage2D;
+if(this->m_ptr_glCompressedTexImage2D)this->m_ptr_glCompressedTexImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTexImage2D_profile;
+this->m_names[1759] = "glMapBufferARB";
+this->m_orig_glMapBufferARB = this->m_ptr_glMapBufferARB;
+if(this->m_ptr_glMapBufferARB)this->m_ptr_glMapBufferARB = (FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC)&ProfilingTableDecorator::m_glMapBufferARB_profile;
+this->m_names[1760] = "glGetPathSpacingNV";
+this->m_orig_glGetPathSpacingNV = this->m_ptr_glGetPathSpacingNV;
+if(this->m_ptr_glGetPathSpacingNV)this->m_ptr_glGetPathSpacingNV = (FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC)&ProfilingTableDecorator::m_glGetPathSpacingNV_profile;
+this->m_names[1761] = "glUniform4dv";
+this->m_orig_glUniform4dv = this->m_ptr_glUniform4dv;
+if(this->m_ptr_glUniform4dv)this->m_ptr_glUniform4dv = (FunctionTable::MEMBERPFNGLUNIFORM4DVPROC)&ProfilingTableDecorator::m_glUniform4dv_profile;
+this->m_names[1762] = "glGlobalAlphaFactordSUN";
+this->m_orig_glGlobalAlphaFactordSUN = this->m_ptr_glGlobalAlphaFactordSUN;
+if(this->m_ptr_glGlobalAlphaFactordSUN)this->m_ptr_glGlobalAlphaFactordSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactordSUN_profile;
+this->m_names[1763] = "glProgramUniform3dv";
+this->m_orig_glProgramUniform3dv = this->m_ptr_glProgramUniform3dv;
+if(this->m_ptr_glProgramUniform3dv)this->m_ptr_glProgramUniform3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC)&ProfilingTableDecorator::m_glProgramUniform3dv_profile;
+this->m_names[1764] = "glGetShaderSourceARB";
+this->m_orig_glGetShaderSourceARB = this->m_ptr_glGetShaderSourceARB;
+if(this->m_ptr_glGetShaderSourceARB)this->m_ptr_glGetShaderSourceARB = (FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC)&ProfilingTableDecorator::m_glGetShaderSourceARB_profile;
+this->m_names[1765] = "glVertexAttrib3dvARB";
+this->m_orig_glVertexAttrib3dvARB = this->m_ptr_glVertexAttrib3dvARB;
+if(this->m_ptr_glVertexAttrib3dvARB)this->m_ptr_glVertexAttrib3dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3dvARB_profile;
+this->m_names[1766] = "glInvalidateBufferData";
+this->m_orig_glInvalidateBufferData = this->m_ptr_glInvalidateBufferData;
+if(this->m_ptr_glInvalidateBufferData)this->m_ptr_glInvalidateBufferData = (FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC)&ProfilingTableDecorator::m_glInvalidateBufferData_profile;
+this->m_names[1767] = "glMatrixLoad3x2fNV";
+this->m_orig_glMatrixLoad3x2fNV = this->m_ptr_glMatrixLoad3x2fNV;
+if(this->m_ptr_glMatrixLoad3x2fNV)this->m_ptr_glMatrixLoad3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC)&ProfilingTableDecorator::m_glMatrixLoad3x2fNV_profile;
+this->m_names[1768] = "glCompressedTextureSubImage1D";
+this->m_orig_glCompressedTextureSubImage1D = this->m_ptr_glCompressedTextureSubImage1D;
+if(this->m_ptr_glCompressedTextureSubImage1D)this->m_ptr_glCompressedTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage1D_profile;
+this->m_names[1769] = "glTexCoord3xvOES";
+this->m_orig_glTexCoord3xvOES = this->m_ptr_glTexCoord3xvOES;
+if(this->m_ptr_glTexCoord3xvOES)this->m_ptr_glTexCoord3xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC)&ProfilingTableDecorator::m_glTexCoord3xvOES_profile;
+this->m_names[1770] = "glGenTexturesEXT";
+this->m_orig_glGenTexturesEXT = this->m_ptr_glGenTexturesEXT;
+if(this->m_ptr_glGenTexturesEXT)this->m_ptr_glGenTexturesEXT = (FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC)&ProfilingTableDecorator::m_glGenTexturesEXT_profile;
+this->m_names[1771] = "glTangent3iEXT";
+this->m_orig_glTangent3iEXT = this->m_ptr_glTangent3iEXT;
+if(this->m_ptr_glTangent3iEXT)this->m_ptr_glTangent3iEXT = (FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC)&ProfilingTableDecorator::m_glTangent3iEXT_profile;
+this->m_names[1772] = "glClearTexImage";
+this->m_orig_glClearTexImage = this->m_ptr_glClearTexImage;
+if(this->m_ptr_glClearTexImage)this->m_ptr_glClearTexImage = (FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC)&ProfilingTableDecorator::m_glClearTexImage_profile;
+this->m_names[1773] = "glBinormal3bvEXT";
+this->m_orig_glBinormal3bvEXT = this->m_ptr_glBinormal3bvEXT;
+if(this->m_ptr_glBinormal3bvEXT)this->m_ptr_glBinormal3bvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC)&ProfilingTableDecorator::m_glBinormal3bvEXT_profile;
+this->m_names[1774] = "glUniform3fv";
+this->m_orig_glUniform3fv = this->m_ptr_glUniform3fv;
+if(this->m_ptr_glUniform3fv)this->m_ptr_glUniform3fv = (FunctionTable::MEMBERPFNGLUNIFORM3FVPROC)&ProfilingTableDecorator::m_glUniform3fv_profile;
+this->m_names[1775] = "glGetnPixelMapusvARB";
+this->m_orig_glGetnPixelMapusvARB = this->m_ptr_glGetnPixelMapusvARB;
+if(this->m_ptr_glGetnPixelMapusvARB)this->m_ptr_glGetnPixelMapusvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapusvARB_profile;
+this->m_names[1776] = "glMemoryObjectParameterivEXT";
+this->m_orig_glMemoryObjectParameterivEXT = this->m_ptr_glMemoryObjectParameterivEXT;
+if(this->m_ptr_glMemoryObjectParameterivEXT)this->m_ptr_glMemoryObjectParameterivEXT = (FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glMemoryObjectParameterivEXT_profile;
+this->m_names[1777] = "glGenSemaphoresEXT";
+this->m_orig_glGenSemaphoresEXT = this->m_ptr_glGenSemaphoresEXT;
+if(this->m_ptr_glGenSemaphoresEXT)this->m_ptr_glGenSemaphoresEXT = (FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC)&ProfilingTableDecorator::m_glGenSemaphoresEXT_profile;
+this->m_names[1778] = "glMultiTexCoordP1ui";
+this->m_orig_glMultiTexCoordP1ui = this->m_ptr_glMultiTexCoordP1ui;
+if(this->m_ptr_glMultiTexCoordP1ui)this->m_ptr_glMultiTexCoordP1ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP1ui_profile;
+this->m_names[1779] = "glClearNamedBufferDataEXT";
+this->m_orig_glClearNamedBufferDataEXT = this->m_ptr_glClearNamedBufferDataEXT;
+if(this->m_ptr_glClearNamedBufferDataEXT)this->m_ptr_glClearNamedBufferDataEXT = (FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC)&ProfilingTableDecorator::m_glClearNamedBufferDataEXT_profile;
+this->m_names[1780] = "glUniformMatrix4dv";
+this->m_orig_glUniformMatrix4dv = this->m_ptr_glUniformMatrix4dv;
+if(this->m_ptr_glUniformMatrix4dv)this->m_ptr_glUniformMatrix4dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4dv_profile;
+this->m_names[1781] = "glWindowPos3fMESA";
+this->m_orig_glWindowPos3fMESA = this->m_ptr_glWindowPos3fMESA;
+if(this->m_ptr_glWindowPos3fMESA)this->m_ptr_glWindowPos3fMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC)&ProfilingTableDecorator::m_glWindowPos3fMESA_profile;
+this->m_names[1782] = "glDeleteRenderbuffers";
+this->m_orig_glDeleteRenderbuffers = this->m_ptr_glDeleteRenderbuffers;
+if(this->m_ptr_glDeleteRenderbuffers)this->m_ptr_glDeleteRenderbuffers = (FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC)&ProfilingTableDecorator::m_glDeleteRenderbuffers_profile;
+this->m_names[1783] = "glGetTextureLevelParameterfvEXT";
+this->m_orig_glGetTextureLevelParameterfvEXT = this->m_ptr_glGetTextureLevelParameterfvEXT;
+if(this->m_ptr_glGetTextureLevelParameterfvEXT)this->m_ptr_glGetTextureLevelParameterfvEXT = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterfvEXT_profile;
+this->m_names[1784] = "glGetHistogramParameterxvOES";
+this->m_orig_glGetHistogramParameterxvOES = this->m_ptr_glGetHistogramParameterxvOES;
+if(this->m_ptr_glGetHistogramParameterxvOES)this->m_ptr_glGetHistogramParameterxvOES = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetHistogramParameterxvOES_profile;
+this->m_names[1785] = "glMultiDrawElements";
+this->m_orig_glMultiDrawElements = this->m_ptr_glMultiDrawElements;
+if(this->m_ptr_glMultiDrawElements)this->m_ptr_glMultiDrawElements = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC)&ProfilingTableDecorator::m_glMultiDrawElements_profile;
+this->m_names[1786] = "glMakeImageHandleNonResidentNV";
+this->m_orig_glMakeImageHandleNonResidentNV = this->m_ptr_glMakeImageHandleNonResidentNV;
+if(this->m_ptr_glMakeImageHandleNonResidentNV)this->m_ptr_glMakeImageHandleNonResidentNV = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeImageHandleNonResidentNV_profile;
+this->m_names[1787] = "glTexSubImage1DEXT";
+this->m_orig_glTexSubImage1DEXT = this->m_ptr_glTexSubImage1DEXT;
+if(this->m_ptr_glTexSubImage1DEXT)this->m_ptr_glTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTexSubImage1DEXT_profile;
+this->m_names[1788] = "glNormalStream3dATI";
+this->m_orig_glNormalStream3dATI = this->m_ptr_glNormalStream3dATI;
+if(this->m_ptr_glNormalStream3dATI)this->m_ptr_glNormalStream3dATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC)&ProfilingTableDecorator::m_glNormalStream3dATI_profile;
+this->m_names[1789] = "glVertexAttribL4i64vNV";
+this->m_orig_glVertexAttribL4i64vNV = this->m_ptr_glVertexAttribL4i64vNV;
+if(this->m_ptr_glVertexAttribL4i64vNV)this->m_ptr_glVertexAttribL4i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL4i64vNV_profile;
+this->m_names[1790] = "glDrawBuffers";
+this->m_orig_glDrawBuffers = this->m_ptr_glDrawBuffers;
+if(this->m_ptr_glDrawBuffers)this->m_ptr_glDrawBuffers = (FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC)&ProfilingTableDecorator::m_glDrawBuffers_profile;
+this->m_names[1791] = "glCopyTextureSubImage1DEXT";
+this->m_orig_glCopyTextureSubImage1DEXT = this->m_ptr_glCopyTextureSubImage1DEXT;
+if(this->m_ptr_glCopyTextureSubImage1DEXT)this->m_ptr_glCopyTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage1DEXT_profile;
+this->m_names[1792] = "glWindowRectanglesEXT";
+this->m_orig_glWindowRectanglesEXT = this->m_ptr_glWindowRectanglesEXT;
+if(this->m_ptr_glWindowRectanglesEXT)this->m_ptr_glWindowRectanglesEXT = (FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC)&ProfilingTableDecorator::m_glWindowRectanglesEXT_profile;
+this->m_names[1793] = "glNamedFramebufferReadBuffer";
+this->m_orig_glNamedFramebufferReadBuffer = this->m_ptr_glNamedFramebufferReadBuffer;
+if(this->m_ptr_glNamedFramebufferReadBuffer)this->m_ptr_glNamedFramebufferReadBuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferReadBuffer_profile;
+this->m_names[1794] = "glUniform2i64vARB";
+this->m_orig_glUniform2i64vARB = this->m_ptr_glUniform2i64vARB;
+if(this->m_ptr_glUniform2i64vARB)this->m_ptr_glUniform2i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC)&ProfilingTableDecorator::m_glUniform2i64vARB_profile;
+this->m_names[1795] = "glVertexAttribI1uivEXT";
+this->m_orig_glVertexAttribI1uivEXT = this->m_ptr_glVertexAttribI1uivEXT;
+if(this->m_ptr_glVertexAttribI1uivEXT)this->m_ptr_glVertexAttribI1uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1uivEXT_profile;
+this->m_names[1796] = "glGetTexGenfv";
+this->m_orig_glGetTexGenfv = this->m_ptr_glGetTexGenfv;
+if(this->m_ptr_glGetTexGenfv)this->m_ptr_glGetTexGenfv = (FunctionTable::MEMBERPFNGLGETTEXGENFVPROC)&ProfilingTableDecorator::m_glGetTexGenfv_profile;
+this->m_names[1797] = "glBeginQueryARB";
+this->m_orig_glBeginQueryARB = this->m_ptr_glBeginQueryARB;
+if(this->m_ptr_glBeginQueryARB)this->m_ptr_glBeginQueryARB = (FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC)&ProfilingTableDecorator::m_glBeginQueryARB_profile;
+this->m_names[1798] = "glUniform1iARB";
+this->m_orig_glUniform1iARB = this->m_ptr_glUniform1iARB;
+if(this->m_ptr_glUniform1iARB)this->m_ptr_glUniform1iARB = (FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC)&ProfilingTableDecorator::m_glUniform1iARB_profile;
+this->m_names[1799] = "glVertex4bvOES";
+this->m_orig_glVertex4bvOES = this->m_ptr_glVertex4bvOES;
+if(this->m_ptr_glVertex4bvOES)this->m_ptr_glVertex4bvOES = (FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC)&ProfilingTableDecorator::m_glVertex4bvOES_profile;
+this->m_names[1800] = "glInvalidateSubFramebuffer";
+this->m_orig_glInvalidateSubFramebuffer = this->m_ptr_glInvalidateSubFramebuffer;
+if(this->m_ptr_glInvalidateSubFramebuffer)this->m_ptr_glInvalidateSubFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glInvalidateSubFramebuffer_profile;
+this->m_names[1801] = "glUniform1fvARB";
+this->m_orig_glUniform1fvARB = this->m_ptr_glUniform1fvARB;
+if(this->m_ptr_glUniform1fvARB)this->m_ptr_glUniform1fvARB = (FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC)&ProfilingTableDecorator::m_glUniform1fvARB_profile;
+this->m_names[1802] = "glTestFenceNV";
+this->m_orig_glTestFenceNV = this->m_ptr_glTestFenceNV;
+if(this->m_ptr_glTestFenceNV)this->m_ptr_glTestFenceNV = (FunctionTable::MEMBERPFNGLTESTFENCENVPROC)&ProfilingTableDecorator::m_glTestFenceNV_profile;
+this->m_names[1803] = "glBindTransformFeedback";
+this->m_orig_glBindTransformFeedback = this->m_ptr_glBindTransformFeedback;
+if(this->m_ptr_glBindTransformFeedback)this->m_ptr_glBindTransformFeedback = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glBindTransformFeedback_profile;
+this->m_names[1804] = "glMultiTexCoord2iv";
+this->m_orig_glMultiTexCoord2iv = this->m_ptr_glMultiTexCoord2iv;
+if(this->m_ptr_glMultiTexCoord2iv)this->m_ptr_glMultiTexCoord2iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2iv_profile;
+this->m_names[1805] = "glCopyMultiTexSubImage1DEXT";
+this->m_orig_glCopyMultiTexSubImage1DEXT = this->m_ptr_glCopyMultiTexSubImage1DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage1DEXT)this->m_ptr_glCopyMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage1DEXT_profile;
+this->m_names[1806] = "glVariantbvEXT";
+this->m_orig_glVariantbvEXT = this->m_ptr_glVariantbvEXT;
+if(this->m_ptr_glVariantbvEXT)this->m_ptr_glVariantbvEXT = (FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC)&ProfilingTableDecorator::m_glVariantbvEXT_profile;
+this->m_names[1807] = "glTexCoord1hNV";
+this->m_orig_glTexCoord1hNV = this->m_ptr_glTexCoord1hNV;
+if(this->m_ptr_glTexCoord1hNV)this->m_ptr_glTexCoord1hNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC)&ProfilingTableDecorator::m_glTexCoord1hNV_profile;
+this->m_names[1808] = "glGenFencesNV";
+this->m_orig_glGenFencesNV = this->m_ptr_glGenFencesNV;
+if(this->m_ptr_glGenFencesNV)this->m_ptr_glGenFencesNV = (FunctionTable::MEMBERPFNGLGENFENCESNVPROC)&ProfilingTableDecorator::m_glGenFencesNV_profile;
+this->m_names[1809] = "glRasterPos3iv";
+this->m_orig_glRasterPos3iv = this->m_ptr_glRasterPos3iv;
+if(this->m_ptr_glRasterPos3iv)this->m_ptr_glRasterPos3iv = (FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC)&ProfilingTableDecorator::m_glRasterPos3iv_profile;
+this->m_names[1810] = "glVertexAttribL2ui64NV";
+this->m_orig_glVertexAttribL2ui64NV = this->m_ptr_glVertexAttribL2ui64NV;
+if(this->m_ptr_glVertexAttribL2ui64NV)this->m_ptr_glVertexAttribL2ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL2ui64NV_profile;
+this->m_names[1811] = "glMultiTexCoord1hvNV";
+this->m_orig_glMultiTexCoord1hvNV = this->m_ptr_glMultiTexCoord1hvNV;
+if(this->m_ptr_glMultiTexCoord1hvNV)this->m_ptr_glMultiTexCoord1hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1hvNV_profile;
+this->m_names[1812] = "glGetnConvolutionFilter";
+this->m_orig_glGetnConvolutionFilter = this->m_ptr_glGetnConvolutionFilter;
+if(this->m_ptr_glGetnConvolutionFilter)this->m_ptr_glGetnConvolutionFilter = (FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC)&ProfilingTableDecorator::m_glGetnConvolutionFilter_profile;
+this->m_names[1813] = "glNormal3bv";
+this->m_orig_glNormal3bv = this->m_ptr_glNormal3bv;
+if(this->m_ptr_glNormal3bv)this->m_ptr_glNormal3bv = (FunctionTable::MEMBERPFNGLNORMAL3BVPROC)&ProfilingTableDecorator::m_glNormal3bv_profile;
+this->m_names[1814] = "glWeightbvARB";
+this->m_orig_glWeightbvARB = this->m_ptr_glWeightbvARB;
+if(this->m_ptr_glWeightbvARB)this->m_ptr_glWeightbvARB = (FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC)&ProfilingTableDecorator::m_glWeightbvARB_profile;
+this->m_names[1815] = "glTexCoord4sv";
+this->m_orig_glTexCoord4sv = this->m_ptr_glTexCoord4sv;
+if(this->m_ptr_glTexCoord4sv)this->m_ptr_glTexCoord4sv = (FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC)&ProfilingTableDecorator::m_glTexCoord4sv_profile;
+this->m_names[1816] = "glUniform2uiv";
+this->m_orig_glUniform2uiv = this->m_ptr_glUniform2uiv;
+if(this->m_ptr_glUniform2uiv)this->m_ptr_glUniform2uiv = (FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC)&ProfilingTableDecorator::m_glUniform2uiv_profile;
+this->m_names[1817] = "glBeginConditionalRenderNVX";
+this->m_orig_glBeginConditionalRenderNVX = this->m_ptr_glBeginConditionalRenderNVX;
+if(this->m_ptr_glBeginConditionalRenderNVX)this->m_ptr_glBeginConditionalRenderNVX = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC)&ProfilingTableDecorator::m_glBeginConditionalRenderNVX_profile;
+this->m_names[1818] = "glFinish";
+this->m_orig_glFinish = this->m_ptr_glFinish;
+if(this->m_ptr_glFinish)this->m_ptr_glFinish = (FunctionTable::MEMBERPFNGLFINISHPROC)&ProfilingTableDecorator::m_glFinish_profile;
+this->m_names[1819] = "glColorTableParameterfv";
+this->m_orig_glColorTableParameterfv = this->m_ptr_glColorTableParameterfv;
+if(this->m_ptr_glColorTableParameterfv)this->m_ptr_glColorTableParameterfv = (FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC)&ProfilingTableDecorator::m_glColorTableParameterfv_profile;
+this->m_names[1820] = "glFragmentCoverageColorNV";
+this->m_orig_glFragmentCoverageColorNV = this->m_ptr_glFragmentCoverageColorNV;
+if(this->m_ptr_glFragmentCoverageColorNV)this->m_ptr_glFragmentCoverageColorNV = (FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC)&ProfilingTableDecorator::m_glFragmentCoverageColorNV_profile;
+this->m_names[1821] = "glProgramUniform3ivEXT";
+this->m_orig_glProgramUniform3ivEXT = this->m_ptr_glProgramUniform3ivEXT;
+if(this->m_ptr_glProgramUniform3ivEXT)this->m_ptr_glProgramUniform3ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3ivEXT_profile;
+this->m_names[1822] = "glVertexArrayVertexOffsetEXT";
+this->m_orig_glVertexArrayVertexOffsetEXT = this->m_ptr_glVertexArrayVertexOffsetEXT;
+if(this->m_ptr_glVertexArrayVertexOffsetEXT)this->m_ptr_glVertexArrayVertexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexOffsetEXT_profile;
+this->m_names[1823] = "glViewportPositionWScaleNV";
+this->m_orig_glViewportPositionWScaleNV = this->m_ptr_glViewportPositionWScaleNV;
+if(this->m_ptr_glViewportPositionWScaleNV)this->m_ptr_glViewportPositionWScaleNV = (FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC)&ProfilingTableDecorator::m_glViewportPositionWScaleNV_profile;
+this->m_names[1824] = "glGetProgramLocalParameterIuivNV";
+this->m_orig_glGetProgramLocalParameterIuivNV = this->m_ptr_glGetProgramLocalParameterIuivNV;
+if(this->m_ptr_glGetProgramLocalParameterIuivNV)this->m_ptr_glGetProgramLocalParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterIuivNV_profile;
+this->m_names[1825] = "glReplacementCodeuiTexCoord2fVertex3fvSUN";
+this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN;
+if(this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN)this->m_ptr_glReplacementCodeuiTexCoord2fVertex3fvSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profile;
+this->m_names[1826] = "glUniform1uiv";
+this->m_orig_glUniform1uiv = this->m_ptr_glUniform1uiv;
+if(this->m_ptr_glUniform1uiv)this->m_ptr_glUniform1uiv = (FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC)&ProfilingTableDecorator::m_glUniform1uiv_profile;
+this->m_names[1827] = "glUniformMatrix2dv";
+this->m_orig_glUniformMatrix2dv = this->m_ptr_glUniformMatrix2dv;
+if(this->m_ptr_glUniformMatrix2dv)this->m_ptr_glUniformMatrix2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix2dv_profile;
+this->m_names[1828] = "glIndexdv";
+this->m_orig_glIndexdv = this->m_ptr_glIndexdv;
+if(this->m_ptr_glIndexdv)this->m_ptr_glIndexdv = (FunctionTable::MEMBERPFNGLINDEXDVPROC)&ProfilingTableDecorator::m_glIndexdv_profile;
+this->m_names[1829] = "glSecondaryColor3ivEXT";
+this->m_orig_glSecondaryColor3ivEXT = this->m_ptr_glSecondaryColor3ivEXT;
+if(this->m_ptr_glSecondaryColor3ivEXT)this->m_ptr_glSecondaryColor3ivEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ivEXT_profile;
+this->m_names[1830] = "glTexCoord3iv";
+this->m_orig_glTexCoord3iv = this->m_ptr_glTexCoord3iv;
+if(this->m_ptr_glTexCoord3iv)this->m_ptr_glTexCoord3iv = (FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC)&ProfilingTableDecorator::m_glTexCoord3iv_profile;
+this->m_names[1831] = "glVertexStream4fvATI";
+this->m_orig_glVertexStream4fvATI = this->m_ptr_glVertexStream4fvATI;
+if(this->m_ptr_glVertexStream4fvATI)this->m_ptr_glVertexStream4fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC)&ProfilingTableDecorator::m_glVertexStream4fvATI_profile;
+this->m_names[1832] = "glDeformationMap3fSGIX";
+this->m_orig_glDeformationMap3fSGIX = this->m_ptr_glDeformationMap3fSGIX;
+if(this->m_ptr_glDeformationMap3fSGIX)this->m_ptr_glDeformationMap3fSGIX = (FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC)&ProfilingTableDecorator::m_glDeformationMap3fSGIX_profile;
+this->m_names[1833] = "glClearDepth";
+this->m_orig_glClearDepth = this->m_ptr_glClearDepth;
+if(this->m_ptr_glClearDepth)this->m_ptr_glClearDepth = (FunctionTable::MEMBERPFNGLCLEARDEPTHPROC)&ProfilingTableDecorator::m_glClearDepth_profile;
+this->m_names[1834] = "glGenAsyncMarkersSGIX";
+this->m_orig_glGenAsyncMarkersSGIX = this->m_ptr_glGenAsyncMarkersSGIX;
+if(this->m_ptr_glGenAsyncMarkersSGIX)this->m_ptr_glGenAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC)&ProfilingTableDecorator::m_glGenAsyncMarkersSGIX_profile;
+this->m_names[1835] = "glDisableIndexedEXT";
+this->m_orig_glDisableIndexedEXT = this->m_ptr_glDisableIndexedEXT;
+if(this->m_ptr_glDisableIndexedEXT)this->m_ptr_glDisableIndexedEXT = (FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC)&ProfilingTableDecorator::m_glDisableIndexedEXT_profile;
+this->m_names[1836] = "glVertexWeightfvEXT";
+this->m_orig_glVertexWeightfvEXT = this->m_ptr_glVertexWeightfvEXT;
+if(this->m_ptr_glVertexWeightfvEXT)this->m_ptr_glVertexWeightfvEXT = (FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC)&ProfilingTableDecorator::m_glVertexWeightfvEXT_profile;
+this->m_names[1837] = "glGetProgramLocalParameterIivNV";
+this->m_orig_glGetProgramLocalParameterIivNV = this->m_ptr_glGetProgramLocalParameterIivNV;
+if(this->m_ptr_glGetProgramLocalParameterIivNV)this->m_ptr_glGetProgramLocalParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterIivNV_profile;
+this->m_names[1838] = "glCompressedTexImage3DARB";
+this->m_orig_glCompressedTexImage3DARB = this->m_ptr_glCompressedTexImage3DARB;
+if(this->m_ptr_glCompressedTexImage3DARB)this->m_ptr_glCompressedTexImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage3DARB_profile;
+this->m_names[1839] = "glProgramParameter4fNV";
+this->m_orig_glProgramParameter4fNV = this->m_ptr_glProgramParameter4fNV;
+if(this->m_ptr_glProgramParameter4fNV)this->m_ptr_glProgramParameter4fNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC)&ProfilingTableDecorator::m_glProgramParameter4fNV_profile;
+this->m_names[1840] = "glConvolutionParameterxOES";
+this->m_orig_glConvolutionParameterxOES = this->m_ptr_glConvolutionParameterxOES;
+if(this->m_ptr_glConvolutionParameterxOES)this->m_ptr_glConvolutionParameterxOES = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC)&ProfilingTableDecorator::m_glConvolutionParameterxOES_profile;
+this->m_names[1841] = "glInsertComponentEXT";
+this->m_orig_glInsertComponentEXT = this->m_ptr_glInsertComponentEXT;
+if(this->m_ptr_glInsertComponentEXT)this->m_ptr_glInsertComponentEXT = (FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC)&ProfilingTableDecorator::m_glInsertComponentEXT_profile;
+this->m_names[1842] = "glCreateTextures";
+this->m_orig_glCreateTextures = this->m_ptr_glCreateTextures;
+if(this->m_ptr_glCreateTextures)this->m_ptr_glCreateTextures = (FunctionTable::MEMBERPFNGLCREATETEXTURESPROC)&ProfilingTableDecorator::m_glCreateTextures_profile;
+this->m_names[1843] = "glSecondaryColor3iv";
+this->m_orig_glSecondaryColor3iv = this->m_ptr_glSecondaryColor3iv;
+if(this->m_ptr_glSecondaryColor3iv)this->m_ptr_glSecondaryColor3iv = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC)&ProfilingTableDecorator::m_glSecondaryColor3iv_profile;
+this->m_names[1844] = "glCreateBuffers";
+this->m_orig_glCreateBuffers = this->m_ptr_glCreateBuffers;
+if(this->m_ptr_glCreateBuffers)this->m_ptr_glCreateBuffers = (FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC)&ProfilingTableDecorator::m_glCreateBuffers_profile;
+this->m_names[1845] = "glMultiTexCoord2xvOES";
+this->m_orig_glMultiTexCoord2xvOES = this->m_ptr_glMultiTexCoord2xvOES;
+if(this->m_ptr_glMultiTexCoord2xvOES)this->m_ptr_glMultiTexCoord2xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2xvOES_profile;
+this->m_names[1846] = "glTexGenxvOES";
+this->m_orig_glTexGenxvOES = this->m_ptr_glTexGenxvOES;
+if(this->m_ptr_glTexGenxvOES)this->m_ptr_glTexGenxvOES = (FunctionTable::MEMBERPFNGLTEXGENXVOESPROC)&ProfilingTableDecorator::m_glTexGenxvOES_profile;
+this->m_names[1847] = "glMultTransposeMatrixf";
+this->m_orig_glMultTransposeMatrixf = this->m_ptr_glMultTransposeMatrixf;
+if(this->m_ptr_glMultTransposeMatrixf)this->m_ptr_glMultTransposeMatrixf = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixf_profile;
+this->m_names[1848] = "glBeginTransformFeedbackEXT";
+this->m_orig_glBeginTransformFeedbackEXT = this->m_ptr_glBeginTransformFeedbackEXT;
+if(this->m_ptr_glBeginTransformFeedbackEXT)this->m_ptr_glBeginTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC)&ProfilingTableDecorator::m_glBeginTransformFeedbackEXT_profile;
+this->m_names[1849] = "glTexCoord2fColor3fVertex3fSUN";
+this->m_orig_glTexCoord2fColor3fVertex3fSUN = this->m_ptr_glTexCoord2fColor3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor3fVertex3fSUN)this->m_ptr_glTexCoord2fColor3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor3fVertex3fSUN_profile;
+this->m_names[1850] = "glNormal3sv";
+this->m_orig_glNormal3sv = this->m_ptr_glNormal3sv;
+if(this->m_ptr_glNormal3sv)this->m_ptr_glNormal3sv = (FunctionTable::MEMBERPFNGLNORMAL3SVPROC)&ProfilingTableDecorator::m_glNormal3sv_profile;
+this->m_names[1851] = "glFreeObjectBufferATI";
+this->m_orig_glFreeObjectBufferATI = this->m_ptr_glFreeObjectBufferATI;
+if(this->m_ptr_glFreeObjectBufferATI)this->m_ptr_glFreeObjectBufferATI = (FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glFreeObjectBufferATI_profile;
+this->m_names[1852] = "glBlendBarrierNV";
+this->m_orig_glBlendBarrierNV = this->m_ptr_glBlendBarrierNV;
+if(this->m_ptr_glBlendBarrierNV)this->m_ptr_glBlendBarrierNV = (FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC)&ProfilingTableDecorator::m_glBlendBarrierNV_profile;
+this->m_names[1853] = "glUniform4i64vNV";
+this->m_orig_glUniform4i64vNV = this->m_ptr_glUniform4i64vNV;
+if(this->m_ptr_glUniform4i64vNV)this->m_ptr_glUniform4i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC)&ProfilingTableDecorator::m_glUniform4i64vNV_profile;
+this->m_names[1854] = "glGetnUniformuivARB";
+this->m_orig_glGetnUniformuivARB = this->m_ptr_glGetnUniformuivARB;
+if(this->m_ptr_glGetnUniformuivARB)this->m_ptr_glGetnUniformuivARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC)&ProfilingTableDecorator::m_glGetnUniformuivARB_profile;
+this->m_names[1855] = "glAlphaFragmentOp3ATI";
+this->m_orig_glAlphaFragmentOp3ATI = this->m_ptr_glAlphaFragmentOp3ATI;
+if(this->m_ptr_glAlphaFragmentOp3ATI)this->m_ptr_glAlphaFragmentOp3ATI = (FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC)&ProfilingTableDecorator::m_glAlphaFragmentOp3ATI_profile;
+this->m_names[1856] = "glProgramEnvParameters4fvEXT";
+this->m_orig_glProgramEnvParameters4fvEXT = this->m_ptr_glProgramEnvParameters4fvEXT;
+if(this->m_ptr_glProgramEnvParameters4fvEXT)this->m_ptr_glProgramEnvParameters4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glProgramEnvParameters4fvEXT_profile;
+this->m_names[1857] = "glBlendFuncSeparateEXT";
+this->m_orig_glBlendFuncSeparateEXT = this->m_ptr_glBlendFuncSeparateEXT;
+if(this->m_ptr_glBlendFuncSeparateEXT)this->m_ptr_glBlendFuncSeparateEXT = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateEXT_profile;
+this->m_names[1858] = "glConvolutionParameterivEXT";
+this->m_orig_glConvolutionParameterivEXT = this->m_ptr_glConvolutionParameterivEXT;
+if(this->m_ptr_glConvolutionParameterivEXT)this->m_ptr_glConvolutionParameterivEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterivEXT_profile;
+this->m_names[1859] = "glPixelTexGenSGIX";
+this->m_orig_glPixelTexGenSGIX = this->m_ptr_glPixelTexGenSGIX;
+if(this->m_ptr_glPixelTexGenSGIX)this->m_ptr_glPixelTexGenSGIX = (FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC)&ProfilingTableDecorator::m_glPixelTexGenSGIX_profile;
+this->m_names[1860] = "glDeleteProgram";
+this->m_orig_glDeleteProgram = this->m_ptr_glDeleteProgram;
+if(this->m_ptr_glDeleteProgram)this->m_ptr_glDeleteProgram = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC)&ProfilingTableDecorator::m_glDeleteProgram_profile;
+this->m_names[1861] = "glUniformMatrix4x3dv";
+this->m_orig_glUniformMatrix4x3dv = this->m_ptr_glUniformMatrix4x3dv;
+if(this->m_ptr_glUniformMatrix4x3dv)this->m_ptr_glUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x3dv_profile;
+this->m_names[1862] = "glGetVideoCaptureStreamivNV";
+this->m_orig_glGetVideoCaptureStreamivNV = this->m_ptr_glGetVideoCaptureStreamivNV;
+if(this->m_ptr_glGetVideoCaptureStreamivNV)this->m_ptr_glGetVideoCaptureStreamivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureStreamivNV_profile;
+this->m_names[1863] = "glProgramUniform4uiEXT";
+this->m_orig_glProgramUniform4uiEXT = this->m_ptr_glProgramUniform4uiEXT;
+if(this->m_ptr_glProgramUniform4uiEXT)this->m_ptr_glProgramUniform4uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4uiEXT_profile;
+this->m_names[1864] = "glMakeImageHandleNonResidentARB";
+this->m_orig_glMakeImageHandleNonResidentARB = this->m_ptr_glMakeImageHandleNonResidentARB;
+if(this->m_ptr_glMakeImageHandleNonResidentARB)this->m_ptr_glMakeImageHandleNonResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeImageHandleNonResidentARB_profile;
+this->m_names[1865] = "glSecondaryColor3dEXT";
+this->m_orig_glSecondaryColor3dEXT = this->m_ptr_glSecondaryColor3dEXT;
+if(this->m_ptr_glSecondaryColor3dEXT)this->m_ptr_glSecondaryColor3dEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3dEXT_profile;
+this->m_names[1866] = "glDeleteQueries";
+this->m_orig_glDeleteQueries = this->m_ptr_glDeleteQueries;
+if(this->m_ptr_glDeleteQueries)this->m_ptr_glDeleteQueries = (FunctionTable::MEMBERPFNGLDELETEQUERIESPROC)&ProfilingTableDecorator::m_glDeleteQueries_profile;
+this->m_names[1867] = "glNormalP3uiv";
+this->m_orig_glNormalP3uiv = this->m_ptr_glNormalP3uiv;
+if(this->m_ptr_glNormalP3uiv)this->m_ptr_glNormalP3uiv = (FunctionTable::MEMBERPFNGLNORMALP3UIVPROC)&ProfilingTableDecorator::m_glNormalP3uiv_profile;
+this->m_names[1868] = "glRasterPos2d";
+this->m_orig_glRasterPos2d = this->m_ptr_glRasterPos2d;
+if(this->m_ptr_glRasterPos2d)this->m_ptr_glRasterPos2d = (FunctionTable::MEMBERPFNGLRASTERPOS2DPROC)&ProfilingTableDecorator::m_glRasterPos2d_profile;
+this->m_names[1869] = "glInitNames";
+this->m_orig_glInitNames = this->m_ptr_glInitNames;
+if(this->m_ptr_glInitNames)this->m_ptr_glInitNames = (FunctionTable::MEMBERPFNGLINITNAMESPROC)&ProfilingTableDecorator::m_glInitNames_profile;
+this->m_names[1870] = "glBinormal3fvEXT";
+this->m_orig_glBinormal3fvEXT = this->m_ptr_glBinormal3fvEXT;
+if(this->m_ptr_glBinormal3fvEXT)this->m_ptr_glBinormal3fvEXT = (FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC)&ProfilingTableDecorator::m_glBinormal3fvEXT_profile;
+this->m_names[1871] = "glColor3dv";
+this->m_orig_glColor3dv = this->m_ptr_glColor3dv;
+if(this->m_ptr_glColor3dv)this->m_ptr_glColor3dv = (FunctionTable::MEMBERPFNGLCOLOR3DVPROC)&ProfilingTableDecorator::m_glColor3dv_profile;
+this->m_names[1872] = "glVertexArrayVertexAttribDivisorEXT";
+this->m_orig_glVertexArrayVertexAttribDivisorEXT = this->m_ptr_glVertexArrayVertexAttribDivisorEXT;
+if(this->m_ptr_glVertexArrayVertexAttribDivisorEXT)this->m_ptr_glVertexArrayVertexAttribDivisorEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribDivisorEXT_profile;
+this->m_names[1873] = "glArrayElementEXT";
+this->m_orig_glArrayElementEXT = this->m_ptr_glArrayElementEXT;
+if(this->m_ptr_glArrayElementEXT)this->m_ptr_glArrayElementEXT = (FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC)&ProfilingTableDecorator::m_glArrayElementEXT_profile;
+this->m_names[1874] = "glProgramParameter4dNV";
+this->m_orig_glProgramParameter4dNV = this->m_ptr_glProgramParameter4dNV;
+if(this->m_ptr_glProgramParameter4dNV)this->m_ptr_glProgramParameter4dNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC)&ProfilingTableDecorator::m_glProgramParameter4dNV_profile;
+this->m_names[1875] = "glIndexxOES";
+this->m_orig_glIndexxOES = this->m_ptr_glIndexxOES;
+if(this->m_ptr_glIndexxOES)this->m_ptr_glIndexxOES = (FunctionTable::MEMBERPFNGLINDEXXOESPROC)&ProfilingTableDecorator::m_glIndexxOES_profile;
+this->m_names[1876] = "glUniform3uivEXT";
+this->m_orig_glUniform3uivEXT = this->m_ptr_glUniform3uivEXT;
+if(this->m_ptr_glUniform3uivEXT)this->m_ptr_glUniform3uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC)&ProfilingTableDecorator::m_glUniform3uivEXT_profile;
+this->m_names[1877] = "glPopGroupMarkerEXT";
+this->m_orig_glPopGroupMarkerEXT = this->m_ptr_glPopGroupMarkerEXT;
+if(this->m_ptr_glPopGroupMarkerEXT)this->m_ptr_glPopGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC)&ProfilingTableDecorator::m_glPopGroupMarkerEXT_profile;
+this->m_names[1878] = "glClearNamedFramebufferuiv";
+this->m_orig_glClearNamedFramebufferuiv = this->m_ptr_glClearNamedFramebufferuiv;
+if(this->m_ptr_glClearNamedFramebufferuiv)this->m_ptr_glClearNamedFramebufferuiv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferuiv_profile;
+this->m_names[1879] = "glSetLocalConstantEXT";
+this->m_orig_glSetLocalConstantEXT = this->m_ptr_glSetLocalConstantEXT;
+if(this->m_ptr_glSetLocalConstantEXT)this->m_ptr_glSetLocalConstantEXT = (FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC)&ProfilingTableDecorator::m_glSetLocalConstantEXT_profile;
+this->m_names[1880] = "glProgramUniform1ui64NV";
+this->m_orig_glProgramUniform1ui64NV = this->m_ptr_glProgramUniform1ui64NV;
+if(this->m_ptr_glProgramUniform1ui64NV)this->m_ptr_glProgramUniform1ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform1ui64NV_profile;
+this->m_names[1881] = "glColor4hvNV";
+this->m_orig_glColor4hvNV = this->m_ptr_glColor4hvNV;
+if(this->m_ptr_glColor4hvNV)this->m_ptr_glColor4hvNV = (FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC)&ProfilingTableDecorator::m_glColor4hvNV_profile;
+this->m_names[1882] = "glGetVertexAttribfv";
+this->m_orig_glGetVertexAttribfv = this->m_ptr_glGetVertexAttribfv;
+if(this->m_ptr_glGetVertexAttribfv)this->m_ptr_glGetVertexAttribfv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC)&ProfilingTableDecorator::m_glGetVertexAttribfv_profile;
+this->m_names[1883] = "glDispatchCompute";
+this->m_orig_glDispatchCompute = this->m_ptr_glDispatchCompute;
+if(this->m_ptr_glDispatchCompute)this->m_ptr_glDispatchCompute = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC)&ProfilingTableDecorator::m_glDispatchCompute_profile;
+this->m_names[1884] = "glGetActiveAttrib";
+this->m_orig_glGetActiveAttrib = this->m_ptr_glGetActiveAttrib;
+if(this->m_ptr_glGetActiveAttrib)this->m_ptr_glGetActiveAttrib = (FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC)&ProfilingTableDecorator::m_glGetActiveAttrib_profile;
+this->m_names[1885] = "glFragmentColorMaterialSGIX";
+this->m_orig_glFragmentColorMaterialSGIX = this->m_ptr_glFragmentColorMaterialSGIX;
+if(this->m_ptr_glFragmentColorMaterialSGIX)this->m_ptr_glFragmentColorMaterialSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC)&ProfilingTableDecorator::m_glFragmentColorMaterialSGIX_profile;
+this->m_names[1886] = "glTexSubImage2D";
+this->m_orig_glTexSubImage2D = this->m_ptr_glTexSubImage2D;
+if(this->m_ptr_glTexSubImage2D)this->m_ptr_glTexSubImage2D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glTexSubImage2D_profile;
+this->m_names[1887] = "glGetnMinmaxARB";
+this->m_orig_glGetnMinmaxARB = this->m_ptr_glGetnMinmaxARB;
+if(this->m_ptr_glGetnMinmaxARB)this->m_ptr_glGetnMinmaxARB = (FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC)&ProfilingTableDecorator::m_glGetnMinmaxARB_profile;
+this->m_names[1888] = "glLogicOp";
+this->m_orig_glLogicOp = this->m_ptr_glLogicOp;
+if(this->m_ptr_glLogicOp)this->m_ptr_glLogicOp = (FunctionTable::MEMBERPFNGLLOGICOPPROC)&ProfilingTableDecorator::m_glLogicOp_profile;
+this->m_names[1889] = "glProgramUniformMatrix3x4fv";
+this->m_orig_glProgramUniformMatrix3x4fv = this->m_ptr_glProgramUniformMatrix3x4fv;
+if(this->m_ptr_glProgramUniformMatrix3x4fv)this->m_ptr_glProgramUniformMatrix3x4fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4fv_profile;
+this->m_names[1890] = "glWindowPos4iMESA";
+this->m_orig_glWindowPos4iMESA = this->m_ptr_glWindowPos4iMESA;
+if(this->m_ptr_glWindowPos4iMESA)this->m_ptr_glWindowPos4iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC)&ProfilingTableDecorator::m_glWindowPos4iMESA_profile;
+this->m_names[1891] = "glPixelTransferf";
+this->m_orig_glPixelTransferf = this->m_ptr_glPixelTransferf;
+if(this->m_ptr_glPixelTransferf)this->m_ptr_glPixelTransferf = (FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC)&ProfilingTableDecorator::m_glPixelTransferf_profile;
+this->m_names[1892] = "glGetTextureParameterIuiv";
+this->m_orig_glGetTextureParameterIuiv = this->m_ptr_glGetTextureParameterIuiv;
+if(this->m_ptr_glGetTextureParameterIuiv)this->m_ptr_glGetTextureParameterIuiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetTextureParameterIuiv_profile;
+this->m_names[1893] = "glMultiTexCoord1xOES";
+this->m_orig_glMultiTexCoord1xOES = this->m_ptr_glMultiTexCoord1xOES;
+if(this->m_ptr_glMultiTexCoord1xOES)this->m_ptr_glMultiTexCoord1xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1xOES_profile;
+this->m_names[1894] = "glProgramUniformMatrix4dv";
+this->m_orig_glProgramUniformMatrix4dv = this->m_ptr_glProgramUniformMatrix4dv;
+if(this->m_ptr_glProgramUniformMatrix4dv)this->m_ptr_glProgramUniformMatrix4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4dv_profile;
+this->m_names[1895] = "glGetnUniformiv";
+this->m_orig_glGetnUniformiv = this->m_ptr_glGetnUniformiv;
+if(this->m_ptr_glGetnUniformiv)this->m_ptr_glGetnUniformiv = (FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC)&ProfilingTableDecorator::m_glGetnUniformiv_profile;
+this->m_names[1896] = "glFramebufferTexture1DEXT";
+this->m_orig_glFramebufferTexture1DEXT = this->m_ptr_glFramebufferTexture1DEXT;
+if(this->m_ptr_glFramebufferTexture1DEXT)this->m_ptr_glFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture1DEXT_profile;
+this->m_names[1897] = "glVertexPointervINTEL";
+this->m_orig_glVertexPointervINTEL = this->m_ptr_glVertexPointervINTEL;
+if(this->m_ptr_glVertexPointervINTEL)this->m_ptr_glVertexPointervINTEL = (FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC)&ProfilingTableDecorator::m_glVertexPointervINTEL_profile;
+this->m_names[1898] = "glTextureParameterIiv";
+this->m_orig_glTextureParameterIiv = this->m_ptr_glTextureParameterIiv;
+if(this->m_ptr_glTextureParameterIiv)this->m_ptr_glTextureParameterIiv = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC)&ProfilingTableDecorator::m_glTextureParameterIiv_profile;
+this->m_names[1899] = "glGetSeparableFilterEXT";
+this->m_orig_glGetSeparableFilterEXT = this->m_ptr_glGetSeparableFilterEXT;
+if(this->m_ptr_glGetSeparableFilterEXT)this->m_ptr_glGetSeparableFilterEXT = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC)&ProfilingTableDecorator::m_glGetSeparableFilterEXT_profile;
+this->m_names[1900] = "glMultiTexCoord3iARB";
+this->m_orig_glMultiTexCoord3iARB = this->m_ptr_glMultiTexCoord3iARB;
+if(this->m_ptr_glMultiTexCoord3iARB)this->m_ptr_glMultiTexCoord3iARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3iARB_profile;
+this->m_names[1901] = "glRasterPos4xvOES";
+this->m_orig_glRasterPos4xvOES = this->m_ptr_glRasterPos4xvOES;
+if(this->m_ptr_glRasterPos4xvOES)this->m_ptr_glRasterPos4xvOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC)&ProfilingTableDecorator::m_glRasterPos4xvOES_profile;
+this->m_names[1902] = "glDrawTransformFeedbackStream";
+this->m_orig_glDrawTransformFeedbackStream = this->m_ptr_glDrawTransformFeedbackStream;
+if(this->m_ptr_glDrawTransformFeedbackStream)this->m_ptr_glDrawTransformFeedbackStream = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackStream_profile;
+this->m_names[1903] = "glVertex3hvNV";
+this->m_orig_glVertex3hvNV = this->m_ptr_glVertex3hvNV;
+if(this->m_ptr_glVertex3hvNV)this->m_ptr_glVertex3hvNV = (FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC)&ProfilingTableDecorator::m_glVertex3hvNV_profile;
+this->m_names[1904] = "glVertexArrayMultiTexCoordOffsetEXT";
+this->m_orig_glVertexArrayMultiTexCoordOffsetEXT = this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT;
+if(this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT)this->m_ptr_glVertexArrayMultiTexCoordOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayMultiTexCoordOffsetEXT_profile;
+this->m_names[1905] = "glProvokingVertex";
+this->m_orig_glProvokingVertex = this->m_ptr_glProvokingVertex;
+if(this->m_ptr_glProvokingVertex)this->m_ptr_glProvokingVertex = (FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC)&ProfilingTableDecorator::m_glProvokingVertex_profile;
+this->m_names[1906] = "glAccumxOES";
+this->m_orig_glAccumxOES = this->m_ptr_glAccumxOES;
+if(this->m_ptr_glAccumxOES)this->m_ptr_glAccumxOES = (FunctionTable::MEMBERPFNGLACCUMXOESPROC)&ProfilingTableDecorator::m_glAccumxOES_profile;
+this->m_names[1907] = "glShaderBinary";
+this->m_orig_glShaderBinary = this->m_ptr_glShaderBinary;
+if(this->m_ptr_glShaderBinary)this->m_ptr_glShaderBinary = (FunctionTable::MEMBERPFNGLSHADERBINARYPROC)&ProfilingTableDecorator::m_glShaderBinary_profile;
+this->m_names[1908] = "glGetMultiTexGenivEXT";
+this->m_orig_glGetMultiTexGenivEXT = this->m_ptr_glGetMultiTexGenivEXT;
+if(this->m_ptr_glGetMultiTexGenivEXT)this->m_ptr_glGetMultiTexGenivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexGenivEXT_profile;
+this->m_names[1909] = "glPointParameterxvOES";
+this->m_orig_glPointParameterxvOES = this->m_ptr_glPointParameterxvOES;
+if(this->m_ptr_glPointParameterxvOES)this->m_ptr_glPointParameterxvOES = (FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glPointParameterxvOES_profile;
+this->m_names[1910] = "glCreateStatesNV";
+this->m_orig_glCreateStatesNV = this->m_ptr_glCreateStatesNV;
+if(this->m_ptr_glCreateStatesNV)this->m_ptr_glCreateStatesNV = (FunctionTable::MEMBERPFNGLCREATESTATESNVPROC)&ProfilingTableDecorator::m_glCreateStatesNV_profile;
+this->m_names[1911] = "glClearDepthdNV";
+this->m_orig_glClearDepthdNV = this->m_ptr_glClearDepthdNV;
+if(this->m_ptr_glClearDepthdNV)this->m_ptr_glClearDepthdNV = (FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC)&ProfilingTableDecorator::m_glClearDepthdNV_profile;
+this->m_names[1912] = "glClearColorIuiEXT";
+this->m_orig_glClearColorIuiEXT = this->m_ptr_glClearColorIuiEXT;
+if(this->m_ptr_glClearColorIuiEXT)this->m_ptr_glClearColorIuiEXT = (FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC)&ProfilingTableDecorator::m_glClearColorIuiEXT_profile;
+this->m_names[1913] = "glBindMultiTextureEXT";
+this->m_orig_glBindMultiTextureEXT = this->m_ptr_glBindMultiTextureEXT;
+if(this->m_ptr_glBindMultiTextureEXT)this->m_ptr_glBindMultiTextureEXT = (FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindMultiTextureEXT_profile;
+this->m_names[1914] = "glTexGeniv";
+this->m_orig_glTexGeniv = this->m_ptr_glTexGeniv;
+if(this->m_ptr_glTexGeniv)this->m_ptr_glTexGeniv = (FunctionTable::MEMBERPFNGLTEXGENIVPROC)&ProfilingTableDecorator::m_glTexGeniv_profile;
+this->m_names[1915] = "glDrawElements";
+this->m_orig_glDrawElements = this->m_ptr_glDrawElements;
+if(this->m_ptr_glDrawElements)this->m_ptr_glDrawElements = (FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC)&ProfilingTableDecorator::m_glDrawElements_profile;
+this->m_names[1916] = "glProgramUniform4iv";
+this->m_orig_glProgramUniform4iv = this->m_ptr_glProgramUniform4iv;
+if(this->m_ptr_glProgramUniform4iv)this->m_ptr_glProgramUniform4iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC)&ProfilingTableDecorator::m_glProgramUniform4iv_profile;
+this->m_names[1917] = "glDisableVertexArrayEXT";
+this->m_orig_glDisableVertexArrayEXT = this->m_ptr_glDisableVertexArrayEXT;
+if(this->m_ptr_glDisableVertexArrayEXT)this->m_ptr_glDisableVertexArrayEXT = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC)&ProfilingTableDecorator::m_glDisableVertexArrayEXT_profile;
+this->m_names[1918] = "glProgramUniform3ui64NV";
+this->m_orig_glProgramUniform3ui64NV = this->m_ptr_glProgramUniform3ui64NV;
+if(this->m_ptr_glProgramUniform3ui64NV)this->m_ptr_glProgramUniform3ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform3ui64NV_profile;
+this->m_names[1919] = "glClientActiveTexture";
+this->m_orig_glClientActiveTexture = this->m_ptr_glClientActiveTexture;
+if(this->m_ptr_glClientActiveTexture)this->m_ptr_glClientActiveTexture = (FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC)&ProfilingTableDecorator::m_glClientActiveTexture_profile;
+this->m_names[1920] = "glMultiTexParameterIivEXT";
+this->m_orig_glMultiTexParameterIivEXT = this->m_ptr_glMultiTexParameterIivEXT;
+if(this->m_ptr_glMultiTexParameterIivEXT)this->m_ptr_glMultiTexParameterIivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterIivEXT_profile;
+this->m_names[1921] = "glUniform1i64ARB";
+this->m_orig_glUniform1i64ARB = this->m_ptr_glUniform1i64ARB;
+if(this->m_ptr_glUniform1i64ARB)this->m_ptr_glUniform1i64ARB = (FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC)&ProfilingTableDecorator::m_glUniform1i64ARB_profile;
+this->m_names[1922] = "glUniform1iv";
+this->m_orig_glUniform1iv = this->m_ptr_glUniform1iv;
+if(this->m_ptr_glUniform1iv)this->m_ptr_glUniform1iv = (FunctionTable::MEMBERPFNGLUNIFORM1IVPROC)&ProfilingTableDecorator::m_glUniform1iv_profile;
+this->m_names[1923] = "glMulticastBarrierNV";
+this->m_orig_glMulticastBarrierNV = this->m_ptr_glMulticastBarrierNV;
+if(this->m_ptr_glMulticastBarrierNV)this->m_ptr_glMulticastBarrierNV = (FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC)&ProfilingTableDecorator::m_glMulticastBarrierNV_profile;
+this->m_names[1924] = "glVertexAttribArrayObjectATI";
+this->m_orig_glVertexAttribArrayObjectATI = this->m_ptr_glVertexAttribArrayObjectATI;
+if(this->m_ptr_glVertexAttribArrayObjectATI)this->m_ptr_glVertexAttribArrayObjectATI = (FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glVertexAttribArrayObjectATI_profile;
+this->m_names[1925] = "glUniform2iARB";
+this->m_orig_glUniform2iARB = this->m_ptr_glUniform2iARB;
+if(this->m_ptr_glUniform2iARB)this->m_ptr_glUniform2iARB = (FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC)&ProfilingTableDecorator::m_glUniform2iARB_profile;
+this->m_names[1926] = "glDrawArraysInstanced";
+this->m_orig_glDrawArraysInstanced = this->m_ptr_glDrawArraysInstanced;
+if(this->m_ptr_glDrawArraysInstanced)this->m_ptr_glDrawArraysInstanced = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC)&ProfilingTableDecorator::m_glDrawArraysInstanced_profile;
+this->m_names[1927] = "glVertexAttrib2sNV";
+this->m_orig_glVertexAttrib2sNV = this->m_ptr_glVertexAttrib2sNV;
+if(this->m_ptr_glVertexAttrib2sNV)this->m_ptr_glVertexAttrib2sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2sNV_profile;
+this->m_names[1928] = "glTexBufferEXT";
+this->m_orig_glTexBufferEXT = this->m_ptr_glTexBufferEXT;
+if(this->m_ptr_glTexBufferEXT)this->m_ptr_glTexBufferEXT = (FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC)&ProfilingTableDecorator::m_glTexBufferEXT_profile;
+this->m_names[1929] = "glVertexStream2fATI";
+this->m_orig_glVertexStream2fATI = this->m_ptr_glVertexStream2fATI;
+if(this->m_ptr_glVertexStream2fATI)this->m_ptr_glVertexStream2fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC)&ProfilingTableDecorator::m_glVertexStream2fATI_profile;
+this->m_names[1930] = "glDebugMessageCallbackAMD";
+this->m_orig_glDebugMessageCallbackAMD = this->m_ptr_glDebugMessageCallbackAMD;
+if(this->m_ptr_glDebugMessageCallbackAMD)this->m_ptr_glDebugMessageCallbackAMD = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC)&ProfilingTableDecorator::m_glDebugMessageCallbackAMD_profile;
+this->m_names[1931] = "glSamplerParameteriv";
+this->m_orig_glSamplerParameteriv = this->m_ptr_glSamplerParameteriv;
+if(this->m_ptr_glSamplerParameteriv)this->m_ptr_glSamplerParameteriv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC)&ProfilingTableDecorator::m_glSamplerParameteriv_profile;
+this->m_names[1932] = "glVertexAttrib4uiv";
+this->m_orig_glVertexAttrib4uiv = this->m_ptr_glVertexAttrib4uiv;
+if(this->m_ptr_glVertexAttrib4uiv)this->m_ptr_glVertexAttrib4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4uiv_profile;
+this->m_names[1933] = "glEndQueryIndexed";
+this->m_orig_glEndQueryIndexed = this->m_ptr_glEndQueryIndexed;
+if(this->m_ptr_glEndQueryIndexed)this->m_ptr_glEndQueryIndexed = (FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC)&ProfilingTableDecorator::m_glEndQueryIndexed_profile;
+this->m_names[1934] = "glNormalStream3sATI";
+this->m_orig_glNormalStream3sATI = this->m_ptr_glNormalStream3sATI;
+if(this->m_ptr_glNormalStream3sATI)this->m_ptr_glNormalStream3sATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC)&ProfilingTableDecorator::m_glNormalStream3sATI_profile;
+this->m_names[1935] = "glProgramParameteriARB";
+this->m_orig_glProgramParameteriARB = this->m_ptr_glProgramParameteriARB;
+if(this->m_ptr_glProgramParameteriARB)this->m_ptr_glProgramParameteriARB = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC)&ProfilingTableDecorator::m_glProgramParameteriARB_profile;
+this->m_names[1936] = "glTexEnvxOES";
+this->m_orig_glTexEnvxOES = this->m_ptr_glTexEnvxOES;
+if(this->m_ptr_glTexEnvxOES)this->m_ptr_glTexEnvxOES = (FunctionTable::MEMBERPFNGLTEXENVXOESPROC)&ProfilingTableDecorator::m_glTexEnvxOES_profile;
+this->m_names[1937] = "glProgramUniform1iv";
+this->m_orig_glProgramUniform1iv = this->m_ptr_glProgramUniform1iv;
+if(this->m_ptr_glProgramUniform1iv)this->m_ptr_glProgramUniform1iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC)&ProfilingTableDecorator::m_glProgramUniform1iv_profile;
+this->m_names[1938] = "glDisableVertexAttribAPPLE";
+this->m_orig_glDisableVertexAttribAPPLE = this->m_ptr_glDisableVertexAttribAPPLE;
+if(this->m_ptr_glDisableVertexAttribAPPLE)this->m_ptr_glDisableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC)&ProfilingTableDecorator::m_glDisableVertexAttribAPPLE_profile;
+this->m_names[1939] = "glBindRenderbuffer";
+this->m_orig_glBindRenderbuffer = this->m_ptr_glBindRenderbuffer;
+if(this->m_ptr_glBindRenderbuffer)this->m_ptr_glBindRenderbuffer = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC)&ProfilingTableDecorator::m_glBindRenderbuffer_profile;
+this->m_names[1940] = "glMultiTexSubImage3DEXT";
+this->m_orig_glMultiTexSubImage3DEXT = this->m_ptr_glMultiTexSubImage3DEXT;
+if(this->m_ptr_glMultiTexSubImage3DEXT)this->m_ptr_glMultiTexSubImage3DEXT = (FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glMultiTexSubImage3DEXT_profile;
+this->m_names[1941] = "glIsProgram";
+this->m_orig_glIsProgram = this->m_ptr_glIsProgram;
+if(this->m_ptr_glIsProgram)this->m_ptr_glIsProgram = (FunctionTable::MEMBERPFNGLISPROGRAMPROC)&ProfilingTableDecorator::m_glIsProgram_profile;
+this->m_names[1942] = "glMultiDrawElementsIndirectAMD";
+this->m_orig_glMultiDrawElementsIndirectAMD = this->m_ptr_glMultiDrawElementsIndirectAMD;
+if(this->m_ptr_glMultiDrawElementsIndirectAMD)this->m_ptr_glMultiDrawElementsIndirectAMD = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectAMD_profile;
+this->m_names[1943] = "glGetProgramInfoLog";
+this->m_orig_glGetProgramInfoLog = this->m_ptr_glGetProgramInfoLog;
+if(this->m_ptr_glGetProgramInfoLog)this->m_ptr_glGetProgramInfoLog = (FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC)&ProfilingTableDecorator::m_glGetProgramInfoLog_profile;
+this->m_names[1944] = "glGetLocalConstantBooleanvEXT";
+this->m_orig_glGetLocalConstantBooleanvEXT = this->m_ptr_glGetLocalConstantBooleanvEXT;
+if(this->m_ptr_glGetLocalConstantBooleanvEXT)this->m_ptr_glGetLocalConstantBooleanvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantBooleanvEXT_profile;
+this->m_names[1945] = "glPixelTransformParameteriEXT";
+this->m_orig_glPixelTransformParameteriEXT = this->m_ptr_glPixelTransformParameteriEXT;
+if(this->m_ptr_glPixelTransformParameteriEXT)this->m_ptr_glPixelTransformParameteriEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameteriEXT_profile;
+this->m_names[1946] = "glTexCoord4bOES";
+this->m_orig_glTexCoord4bOES = this->m_ptr_glTexCoord4bOES;
+if(this->m_ptr_glTexCoord4bOES)this->m_ptr_glTexCoord4bOES = (FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC)&ProfilingTableDecorator::m_glTexCoord4bOES_profile;
+this->m_names[1947] = "glVertexAttrib4fv";
+this->m_orig_glVertexAttrib4fv = this->m_ptr_glVertexAttrib4fv;
+if(this->m_ptr_glVertexAttrib4fv)this->m_ptr_glVertexAttrib4fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fv_profile;
+this->m_names[1948] = "glProgramUniformMatrix2x3dv";
+this->m_orig_glProgramUniformMatrix2x3dv = this->m_ptr_glProgramUniformMatrix2x3dv;
+if(this->m_ptr_glProgramUniformMatrix2x3dv)this->m_ptr_glProgramUniformMatrix2x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3dv_profile;
+this->m_names[1949] = "glProgramEnvParametersI4uivNV";
+this->m_orig_glProgramEnvParametersI4uivNV = this->m_ptr_glProgramEnvParametersI4uivNV;
+if(this->m_ptr_glProgramEnvParametersI4uivNV)this->m_ptr_glProgramEnvParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParametersI4uivNV_profile;
+this->m_names[1950] = "glTexCoord3xOES";
+this->m_orig_glTexCoord3xOES = this->m_ptr_glTexCoord3xOES;
+if(this->m_ptr_glTexCoord3xOES)this->m_ptr_glTexCoord3xOES = (FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC)&ProfilingTableDecorator::m_glTexCoord3xOES_profile;
+this->m_names[1951] = "glLoadTransposeMatrixfARB";
+this->m_orig_glLoadTransposeMatrixfARB = this->m_ptr_glLoadTransposeMatrixfARB;
+if(this->m_ptr_glLoadTransposeMatrixfARB)this->m_ptr_glLoadTransposeMatrixfARB = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixfARB_profile;
+this->m_names[1952] = "glImageTransformParameteriHP";
+this->m_orig_glImageTransformParameteriHP = this->m_ptr_glImageTransformParameteriHP;
+if(this->m_ptr_glImageTransformParameteriHP)this->m_ptr_glImageTransformParameteriHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC)&ProfilingTableDecorator::m_glImageTransformParameteriHP_profile;
+this->m_names[1953] = "glMultiTexCoord4xOES";
+this->m_orig_glMultiTexCoord4xOES = this->m_ptr_glMultiTexCoord4xOES;
+if(this->m_ptr_glMultiTexCoord4xOES)this->m_ptr_glMultiTexCoord4xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4xOES_profile;
+this->m_names[1954] = "glVertexAttribs3fvNV";
+this->m_orig_glVertexAttribs3fvNV = this->m_ptr_glVertexAttribs3fvNV;
+if(this->m_ptr_glVertexAttribs3fvNV)this->m_ptr_glVertexAttribs3fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3fvNV_profile;
+this->m_names[1955] = "glVertexAttrib2fv";
+this->m_orig_glVertexAttrib2fv = this->m_ptr_glVertexAttrib2fv;
+if(this->m_ptr_glVertexAttrib2fv)this->m_ptr_glVertexAttrib2fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC)&ProfilingTableDecorator::m_glVertexAttrib2fv_profile;
+this->m_names[1956] = "glUniform3ui64NV";
+this->m_orig_glUniform3ui64NV = this->m_ptr_glUniform3ui64NV;
+if(this->m_ptr_glUniform3ui64NV)this->m_ptr_glUniform3ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC)&ProfilingTableDecorator::m_glUniform3ui64NV_profile;
+this->m_names[1957] = "glCombinerParameterfvNV";
+this->m_orig_glCombinerParameterfvNV = this->m_ptr_glCombinerParameterfvNV;
+if(this->m_ptr_glCombinerParameterfvNV)this->m_ptr_glCombinerParameterfvNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glCombinerParameterfvNV_profile;
+this->m_names[1958] = "glFragmentMaterialiSGIX";
+this->m_orig_glFragmentMaterialiSGIX = this->m_ptr_glFragmentMaterialiSGIX;
+if(this->m_ptr_glFragmentMaterialiSGIX)this->m_ptr_glFragmentMaterialiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialiSGIX_profile;
+this->m_names[1959] = "glGetBooleani_v";
+this->m_orig_glGetBooleani_v = this->m_ptr_glGetBooleani_v;
+if(this->m_ptr_glGetBooleani_v)this->m_ptr_glGetBooleani_v = (FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC)&ProfilingTableDecorator::m_glGetBooleani_v_profile;
+this->m_names[1960] = "glGetProgramResourceIndex";
+this->m_orig_glGetProgramResourceIndex = this->m_ptr_glGetProgramResourceIndex;
+if(this->m_ptr_glGetProgramResourceIndex)this->m_ptr_glGetProgramResourceIndex = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC)&ProfilingTableDecorator::m_glGetProgramResourceIndex_profile;
+this->m_names[1961] = "glBeginConditionalRenderNV";
+this->m_orig_glBeginConditionalRenderNV = this->m_ptr_glBeginConditionalRenderNV;
+if(this->m_ptr_glBeginConditionalRenderNV)this->m_ptr_glBeginConditionalRenderNV = (FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC)&ProfilingTableDecorator::m_glBeginConditionalRenderNV_profile;
+this->m_names[1962] = "glDisableClientState";
+this->m_orig_glDisableClientState = this->m_ptr_glDisableClientState;
+if(this->m_ptr_glDisableClientState)this->m_ptr_glDisableClientState = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC)&ProfilingTableDecorator::m_glDisableClientState_profile;
+this->m_names[1963] = "glPathFogGenNV";
+this->m_orig_glPathFogGenNV = this->m_ptr_glPathFogGenNV;
+if(this->m_ptr_glPathFogGenNV)this->m_ptr_glPathFogGenNV = (FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC)&ProfilingTableDecorator::m_glPathFogGenNV_profile;
+this->m_names[1964] = "glStencilThenCoverFillPathNV";
+this->m_orig_glStencilThenCoverFillPathNV = this->m_ptr_glStencilThenCoverFillPathNV;
+if(this->m_ptr_glStencilThenCoverFillPathNV)this->m_ptr_glStencilThenCoverFillPathNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverFillPathNV_profile;
+this->m_names[1965] = "glVertexArrayIndexOffsetEXT";
+this->m_orig_glVertexArrayIndexOffsetEXT = this->m_ptr_glVertexArrayIndexOffsetEXT;
+if(this->m_ptr_glVertexArrayIndexOffsetEXT)this->m_ptr_glVertexArrayIndexOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayIndexOffsetEXT_profile;
+this->m_names[1966] = "glProgramBufferParametersIuivNV";
+this->m_orig_glProgramBufferParametersIuivNV = this->m_ptr_glProgramBufferParametersIuivNV;
+if(this->m_ptr_glProgramBufferParametersIuivNV)this->m_ptr_glProgramBufferParametersIuivNV = (FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)&ProfilingTableDecorator::m_glProgramBufferParametersIuivNV_profile;
+this->m_names[1967] = "glPixelTransformParameterivEXT";
+this->m_orig_glPixelTransformParameterivEXT = this->m_ptr_glPixelTransformParameterivEXT;
+if(this->m_ptr_glPixelTransformParameterivEXT)this->m_ptr_glPixelTransformParameterivEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterivEXT_profile;
+this->m_names[1968] = "glDisableClientStateiEXT";
+this->m_orig_glDisableClientStateiEXT = this->m_ptr_glDisableClientStateiEXT;
+if(this->m_ptr_glDisableClientStateiEXT)this->m_ptr_glDisableClientStateiEXT = (FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC)&ProfilingTableDecorator::m_glDisableClientStateiEXT_profile;
+this->m_names[1969] = "glTexBufferARB";
+this->m_orig_glTexBufferARB = this->m_ptr_glTexBufferARB;
+if(this->m_ptr_glTexBufferARB)this->m_ptr_glTexBufferARB = (FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC)&ProfilingTableDecorator::m_glTexBufferARB_profile;
+this->m_names[1970] = "glGetLocalConstantIntegervEXT";
+this->m_orig_glGetLocalConstantIntegervEXT = this->m_ptr_glGetLocalConstantIntegervEXT;
+if(this->m_ptr_glGetLocalConstantIntegervEXT)this->m_ptr_glGetLocalConstantIntegervEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantIntegervEXT_profile;
+this->m_names[1971] = "glColor4uiv";
+this->m_orig_glColor4uiv = this->m_ptr_glColor4uiv;
+if(this->m_ptr_glColor4uiv)this->m_ptr_glColor4uiv = (FunctionTable::MEMBERPFNGLCOLOR4UIVPROC)&ProfilingTableDecorator::m_glColor4uiv_profile;
+this->m_names[1972] = "glProgramUniform3i";
+this->m_orig_glProgramUniform3i = this->m_ptr_glProgramUniform3i;
+if(this->m_ptr_glProgramUniform3i)this->m_ptr_glProgramUniform3i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC)&ProfilingTableDecorator::m_glProgramUniform3i_profile;
+this->m_names[1973] = "glMultiDrawElementsIndirectBindlessCountNV";
+this->m_orig_glMultiDrawElementsIndirectBindlessCountNV = this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV;
+if(this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV)this->m_ptr_glMultiDrawElementsIndirectBindlessCountNV = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectBindlessCountNV_profile;
+this->m_names[1974] = "glGetBufferPointervARB";
+this->m_orig_glGetBufferPointervARB = this->m_ptr_glGetBufferPointervARB;
+if(this->m_ptr_glGetBufferPointervARB)this->m_ptr_glGetBufferPointervARB = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC)&ProfilingTableDecorator::m_glGetBufferPointervARB_profile;
+this->m_names[1975] = "glMultiTexParameterIuivEXT";
+this->m_orig_glMultiTexParameterIuivEXT = this->m_ptr_glMultiTexParameterIuivEXT;
+if(this->m_ptr_glMultiTexParameterIuivEXT)this->m_ptr_glMultiTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterIuivEXT_profile;
+this->m_names[1976] = "glEvalMesh2";
+this->m_orig_glEvalMesh2 = this->m_ptr_glEvalMesh2;
+if(this->m_ptr_glEvalMesh2)this->m_ptr_glEvalMesh2 = (FunctionTable::MEMBERPFNGLEVALMESH2PROC)&ProfilingTableDecorator::m_glEvalMesh2_profile;
+this->m_names[1977] = "glEvalMesh1";
+this->m_orig_glEvalMesh1 = this->m_ptr_glEvalMesh1;
+if(this->m_ptr_glEvalMesh1)this->m_ptr_glEvalMesh1 = (FunctionTable::MEMBERPFNGLEVALMESH1PROC)&ProfilingTableDecorator::m_glEvalMesh1_profile;
+this->m_names[1978] = "glProgramUniform3f";
+this->m_orig_glProgramUniform3f = this->m_ptr_glProgramUniform3f;
+if(this->m_ptr_glProgramUniform3f)this->m_ptr_glProgramUniform3f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC)&ProfilingTableDecorator::m_glProgramUniform3f_profile;
+this->m_names[1979] = "glStencilThenCoverFillPathInstancedNV";
+this->m_orig_glStencilThenCoverFillPathInstancedNV = this->m_ptr_glStencilThenCoverFillPathInstancedNV;
+if(this->m_ptr_glStencilThenCoverFillPathInstancedNV)this->m_ptr_glStencilThenCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilThenCoverFillPathInstancedNV_profile;
+this->m_names[1980] = "glProgramUniform3d";
+this->m_orig_glProgramUniform3d = this->m_ptr_glProgramUniform3d;
+if(this->m_ptr_glProgramUniform3d)this->m_ptr_glProgramUniform3d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC)&ProfilingTableDecorator::m_glProgramUniform3d_profile;
+this->m_names[1981] = "glMapVertexAttrib1dAPPLE";
+this->m_orig_glMapVertexAttrib1dAPPLE = this->m_ptr_glMapVertexAttrib1dAPPLE;
+if(this->m_ptr_glMapVertexAttrib1dAPPLE)this->m_ptr_glMapVertexAttrib1dAPPLE = (FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC)&ProfilingTableDecorator::m_glMapVertexAttrib1dAPPLE_profile;
+this->m_names[1982] = "glEvalCoord2fv";
+this->m_orig_glEvalCoord2fv = this->m_ptr_glEvalCoord2fv;
+if(this->m_ptr_glEvalCoord2fv)this->m_ptr_glEvalCoord2fv = (FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC)&ProfilingTableDecorator::m_glEvalCoord2fv_profile;
+this->m_names[1983] = "glGetUniformivARB";
+this->m_orig_glGetUniformivARB = this->m_ptr_glGetUniformivARB;
+if(this->m_ptr_glGetUniformivARB)this->m_ptr_glGetUniformivARB = (FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC)&ProfilingTableDecorator::m_glGetUniformivARB_profile;
+this->m_names[1984] = "glLoadTransposeMatrixd";
+this->m_orig_glLoadTransposeMatrixd = this->m_ptr_glLoadTransposeMatrixd;
+if(this->m_ptr_glLoadTransposeMatrixd)this->m_ptr_glLoadTransposeMatrixd = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixd_profile;
+this->m_names[1985] = "glLoadTransposeMatrixf";
+this->m_orig_glLoadTransposeMatrixf = this->m_ptr_glLoadTransposeMatrixf;
+if(this->m_ptr_glLoadTransposeMatrixf)this->m_ptr_glLoadTransposeMatrixf = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixf_profile;
+this->m_names[1986] = "glGetPointervEXT";
+this->m_orig_glGetPointervEXT = this->m_ptr_glGetPointervEXT;
+if(this->m_ptr_glGetPointervEXT)this->m_ptr_glGetPointervEXT = (FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC)&ProfilingTableDecorator::m_glGetPointervEXT_profile;
+this->m_names[1987] = "glSignalVkSemaphoreNV";
+this->m_orig_glSignalVkSemaphoreNV = this->m_ptr_glSignalVkSemaphoreNV;
+if(this->m_ptr_glSignalVkSemaphoreNV)this->m_ptr_glSignalVkSemaphoreNV = (FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC)&ProfilingTableDecorator::m_glSignalVkSemaphoreNV_profile;
+this->m_names[1988] = "glEndConditionalRenderNV";
+this->m_orig_glEndConditionalRenderNV = this->m_ptr_glEndConditionalRenderNV;
+if(this->m_ptr_glEndConditionalRenderNV)this->m_ptr_glEndConditionalRenderNV = (FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC)&ProfilingTableDecorator::m_glEndConditionalRenderNV_profile;
+this->m_names[1989] = "glTexCoord2fNormal3fVertex3fSUN";
+this->m_orig_glTexCoord2fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fNormal3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fNormal3fVertex3fSUN_profile;
+this->m_names[1990] = "glUniform3i64vARB";
+this->m_orig_glUniform3i64vARB = this->m_ptr_glUniform3i64vARB;
+if(this->m_ptr_glUniform3i64vARB)this->m_ptr_glUniform3i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC)&ProfilingTableDecorator::m_glUniform3i64vARB_profile;
+this->m_names[1991] = "glProgramUniform2uiEXT";
+this->m_orig_glProgramUniform2uiEXT = this->m_ptr_glProgramUniform2uiEXT;
+if(this->m_ptr_glProgramUniform2uiEXT)this->m_ptr_glProgramUniform2uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2uiEXT_profile;
+this->m_names[1992] = "glVertexAttribI1ui";
+this->m_orig_glVertexAttribI1ui = this->m_ptr_glVertexAttribI1ui;
+if(this->m_ptr_glVertexAttribI1ui)this->m_ptr_glVertexAttribI1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC)&ProfilingTableDecorator::m_glVertexAttribI1ui_profile;
+this->m_names[1993] = "glProgramNamedParameter4dvNV";
+this->m_orig_glProgramNamedParameter4dvNV = this->m_ptr_glProgramNamedParameter4dvNV;
+if(this->m_ptr_glProgramNamedParameter4dvNV)this->m_ptr_glProgramNamedParameter4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4dvNV_profile;
+this->m_names[1994] = "glCompileCommandListNV";
+this->m_orig_glCompileCommandListNV = this->m_ptr_glCompileCommandListNV;
+if(this->m_ptr_glCompileCommandListNV)this->m_ptr_glCompileCommandListNV = (FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glCompileCommandListNV_profile;
+this->m_names[1995] = "glGetRenderbufferParameterivEXT";
+this->m_orig_glGetRenderbufferParameterivEXT = this->m_ptr_glGetRenderbufferParameterivEXT;
+if(this->m_ptr_glGetRenderbufferParameterivEXT)this->m_ptr_glGetRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetRenderbufferParameterivEXT_profile;
+this->m_names[1996] = "glGetnPolygonStipple";
+this->m_orig_glGetnPolygonStipple = this->m_ptr_glGetnPolygonStipple;
+if(this->m_ptr_glGetnPolygonStipple)this->m_ptr_glGetnPolygonStipple = (FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glGetnPolygonStipple_profile;
+this->m_names[1997] = "glIsBufferResidentNV";
+this->m_orig_glIsBufferResidentNV = this->m_ptr_glIsBufferResidentNV;
+if(this->m_ptr_glIsBufferResidentNV)this->m_ptr_glIsBufferResidentNV = (FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glIsBufferResidentNV_profile;
+this->m_names[1998] = "glSecondaryColor3ubvEXT";
+this->m_orig_glSecondaryColor3ubvEXT = this->m_ptr_glSecondaryColor3ubvEXT;
+if(this->m_ptr_glSecondaryColor3ubvEXT)this->m_ptr_glSecondaryColor3ubvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubvEXT_profile;
+this->m_names[1999] = "glGetNamedRenderbufferParameterivEXT";
+this->m_orig_glGetNamedRenderbufferParameterivEXT = this->m_ptr_glGetNamedRenderbufferParameterivEXT;
+if(this->m_ptr_glGetNamedRenderbufferParameterivEXT)this->m_ptr_glGetNamedRenderbufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedRenderbufferParameterivEXT_profile;
+this->m_names[2000] = "glNamedFramebufferSampleLocationsfvARB";
+this->m_orig_glNamedFramebufferSampleLocationsfvARB = this->m_ptr_glNamedFramebufferSampleLocationsfvARB;
+if(this->m_ptr_glNamedFramebufferSampleLocationsfvARB)this->m_ptr_glNamedFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfilingTableDecorator::m_glNamedFramebufferSampleLocationsfvARB_profile;
+this->m_names[2001] = "glMultiTexGendvEXT";
+this->m_orig_glMultiTexGendvEXT = this->m_ptr_glMultiTexGendvEXT;
+if(this->m_ptr_glMultiTexGendvEXT)this->m_ptr_glMultiTexGendvEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC)&ProfilingTableDecorator::m_glMultiTexGendvEXT_profile;
+this->m_names[2002] = "glVertexArrayRangeNV";
+this->m_orig_glVertexArrayRangeNV = this->m_ptr_glVertexArrayRangeNV;
+if(this->m_ptr_glVertexArrayRangeNV)this->m_ptr_glVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC)&ProfilingTableDecorator::m_glVertexArrayRangeNV_profile;
+this->m_names[2003] = "glIsTextureHandleResidentNV";
+this->m_orig_glIsTextureHandleResidentNV = this->m_ptr_glIsTextureHandleResidentNV;
+if(this->m_ptr_glIsTextureHandleResidentNV)this->m_ptr_glIsTextureHandleResidentNV = (FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC)&ProfilingTableDecorator::m_glIsTextureHandleResidentNV_profile;
+this->m_names[2004] = "glGetProgramEnvParameterdvARB";
+this->m_orig_glGetProgramEnvParameterdvARB = this->m_ptr_glGetProgramEnvParameterdvARB;
+if(this->m_ptr_glGetProgramEnvParameterdvARB)this->m_ptr_glGetProgramEnvParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterdvARB_profile;
+this->m_names[2005] = "glIsNamedStringARB";
+this->m_orig_glIsNamedStringARB = this->m_ptr_glIsNamedStringARB;
+if(this->m_ptr_glIsNamedStringARB)this->m_ptr_glIsNamedStringARB = (FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glIsNamedStringARB_profile;
+this->m_names[2006] = "glSecondaryColorFormatNV";
+this->m_orig_glSecondaryColorFormatNV = this->m_ptr_glSecondaryColorFormatNV;
+if(this->m_ptr_glSecondaryColorFormatNV)this->m_ptr_glSecondaryColorFormatNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC)&ProfilingTableDecorator::m_glSecondaryColorFormatNV_profile;
+this->m_names[2007] = "glVertexAttrib4ubvNV";
+this->m_orig_glVertexAttrib4ubvNV = this->m_ptr_glVertexAttrib4ubvNV;
+if(this->m_ptr_glVertexAttrib4ubvNV)this->m_ptr_glVertexAttrib4ubvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4ubvNV_profile;
+this->m_names[2008] = "glTagSampleBufferSGIX";
+this->m_orig_glTagSampleBufferSGIX = this->m_ptr_glTagSampleBufferSGIX;
+if(this->m_ptr_glTagSampleBufferSGIX)this->m_ptr_glTagSampleBufferSGIX = (FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC)&ProfilingTableDecorator::m_glTagSampleBufferSGIX_profile;
+this->m_names[2009] = "glVDPAUUnregisterSurfaceNV";
+this->m_orig_glVDPAUUnregisterSurfaceNV = this->m_ptr_glVDPAUUnregisterSurfaceNV;
+if(this->m_ptr_glVDPAUUnregisterSurfaceNV)this->m_ptr_glVDPAUUnregisterSurfaceNV = (FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC)&ProfilingTableDecorator::m_glVDPAUUnregisterSurfaceNV_profile;
+this->m_names[2010] = "glGetPerfQueryIdByNameINTEL";
+this->m_orig_glGetPerfQueryIdByNameINTEL = this->m_ptr_glGetPerfQueryIdByNameINTEL;
+if(this->m_ptr_glGetPerfQueryIdByNameINTEL)this->m_ptr_glGetPerfQueryIdByNameINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryIdByNameINTEL_profile;
+this->m_names[2011] = "glGetInteger64v";
+this->m_orig_glGetInteger64v = this->m_ptr_glGetInteger64v;
+if(this->m_ptr_glGetInteger64v)this->m_ptr_glGetInteger64v = (FunctionTable::MEMBERPFNGLGETINTEGER64VPROC)&ProfilingTableDecorator::m_glGetInteger64v_profile;
+this->m_names[2012] = "glClipPlane";
+this->m_orig_glClipPlane = this->m_ptr_glClipPlane;
+if(this->m_ptr_glClipPlane)this->m_ptr_glClipPlane = (FunctionTable::MEMBERPFNGLCLIPPLANEPROC)&ProfilingTableDecorator::m_glClipPlane_profile;
+this->m_names[2013] = "glColor4ubVertex3fSUN";
+this->m_orig_glColor4ubVertex3fSUN = this->m_ptr_glColor4ubVertex3fSUN;
+if(this->m_ptr_glColor4ubVertex3fSUN)this->m_ptr_glColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor4ubVertex3fSUN_profile;
+this->m_names[2014] = "glIndexub";
+this->m_orig_glIndexub = this->m_ptr_glIndexub;
+if(this->m_ptr_glIndexub)this->m_ptr_glIndexub = (FunctionTable::MEMBERPFNGLINDEXUBPROC)&ProfilingTableDecorator::m_glIndexub_profile;
+this->m_names[2015] = "glGetProgramEnvParameterfvARB";
+this->m_orig_glGetProgramEnvParameterfvARB = this->m_ptr_glGetProgramEnvParameterfvARB;
+if(this->m_ptr_glGetProgramEnvParameterfvARB)this->m_ptr_glGetProgramEnvParameterfvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterfvARB_profile;
+this->m_names[2016] = "glVertexAttrib4usvARB";
+this->m_orig_glVertexAttrib4usvARB = this->m_ptr_glVertexAttrib4usvARB;
+if(this->m_ptr_glVertexAttrib4usvARB)this->m_ptr_glVertexAttrib4usvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4usvARB_profile;
+this->m_names[2017] = "glNamedFramebufferRenderbuffer";
+this->m_orig_glNamedFramebufferRenderbuffer = this->m_ptr_glNamedFramebufferRenderbuffer;
+if(this->m_ptr_glNamedFramebufferRenderbuffer)this->m_ptr_glNamedFramebufferRenderbuffer = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)&ProfilingTableDecorator::m_glNamedFramebufferRenderbuffer_profile;
+this->m_names[2018] = "glProgramUniformMatrix3x4dv";
+this->m_orig_glProgramUniformMatrix3x4dv = this->m_ptr_glProgramUniformMatrix3x4dv;
+if(this->m_ptr_glProgramUniformMatrix3x4dv)this->m_ptr_glProgramUniformMatrix3x4dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x4dv_profile;
+this->m_names[2019] = "glTestFenceAPPLE";
+this->m_orig_glTestFenceAPPLE = this->m_ptr_glTestFenceAPPLE;
+if(this->m_ptr_glTestFenceAPPLE)this->m_ptr_glTestFenceAPPLE = (FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC)&ProfilingTableDecorator::m_glTestFenceAPPLE_profile;
+this->m_names[2020] = "glVertexAttrib4Niv";
+this->m_orig_glVertexAttrib4Niv = this->m_ptr_glVertexAttrib4Niv;
+if(this->m_ptr_glVertexAttrib4Niv)this->m_ptr_glVertexAttrib4Niv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Niv_profile;
+this->m_names[2021] = "glVertexAttribL2i64vNV";
+this->m_orig_glVertexAttribL2i64vNV = this->m_ptr_glVertexAttribL2i64vNV;
+if(this->m_ptr_glVertexAttribL2i64vNV)this->m_ptr_glVertexAttribL2i64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL2i64vNV_profile;
+this->m_names[2022] = "glColorP4uiv";
+this->m_orig_glColorP4uiv = this->m_ptr_glColorP4uiv;
+if(this->m_ptr_glColorP4uiv)this->m_ptr_glColorP4uiv = (FunctionTable::MEMBERPFNGLCOLORP4UIVPROC)&ProfilingTableDecorator::m_glColorP4uiv_profile;
+this->m_names[2023] = "glUniformMatrix2x3fv";
+this->m_orig_glUniformMatrix2x3fv = this->m_ptr_glUniformMatrix2x3fv;
+if(this->m_ptr_glUniformMatrix2x3fv)this->m_ptr_glUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2x3fv_profile;
+this->m_names[2024] = "glCallCommandListNV";
+this->m_orig_glCallCommandListNV = this->m_ptr_glCallCommandListNV;
+if(this->m_ptr_glCallCommandListNV)this->m_ptr_glCallCommandListNV = (FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC)&ProfilingTableDecorator::m_glCallCommandListNV_profile;
+this->m_names[2025] = "glClearBufferiv";
+this->m_orig_glClearBufferiv = this->m_ptr_glClearBufferiv;
+if(this->m_ptr_glClearBufferiv)this->m_ptr_glClearBufferiv = (FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC)&ProfilingTableDecorator::m_glClearBufferiv_profile;
+this->m_names[2026] = "glNamedStringARB";
+this->m_orig_glNamedStringARB = this->m_ptr_glNamedStringARB;
+if(this->m_ptr_glNamedStringARB)this->m_ptr_glNamedStringARB = (FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC)&ProfilingTableDecorator::m_glNamedStringARB_profile;
+this->m_names[2027] = "glMatrixMult3x2fNV";
+this->m_orig_glMatrixMult3x2fNV = this->m_ptr_glMatrixMult3x2fNV;
+if(this->m_ptr_glMatrixMult3x2fNV)this->m_ptr_glMatrixMult3x2fNV = (FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC)&ProfilingTableDecorator::m_glMatrixMult3x2fNV_profile;
+this->m_names[2028] = "glGetNamedProgramStringEXT";
+this->m_orig_glGetNamedProgramStringEXT = this->m_ptr_glGetNamedProgramStringEXT;
+if(this->m_ptr_glGetNamedProgramStringEXT)this->m_ptr_glGetNamedProgramStringEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramStringEXT_profile;
+this->m_names[2029] = "glGetnHistogramARB";
+this->m_orig_glGetnHistogramARB = this->m_ptr_glGetnHistogramARB;
+if(this->m_ptr_glGetnHistogramARB)this->m_ptr_glGetnHistogramARB = (FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC)&ProfilingTableDecorator::m_glGetnHistogramARB_profile;
+this->m_names[2030] = "glGetTextureLevelParameterfv";
+this->m_orig_glGetTextureLevelParameterfv = this->m_ptr_glGetTextureLevelParameterfv;
+if(this->m_ptr_glGetTextureLevelParameterfv)this->m_ptr_glGetTextureLevelParameterfv = (FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTextureLevelParameterfv_profile;
+this->m_names[2031] = "glMultiTexCoord1fv";
+this->m_orig_glMultiTexCoord1fv = this->m_ptr_glMultiTexCoord1fv;
+if(this->m_ptr_glMultiTexCoord1fv)this->m_ptr_glMultiTexCoord1fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1fv_profile;
+this->m_names[2032] = "glBitmapxOES";
+this->m_orig_glBitmapxOES = this->m_ptr_glBitmapxOES;
+if(this->m_ptr_glBitmapxOES)this->m_ptr_glBitmapxOES = (FunctionTable::MEMBERPFNGLBITMAPXOESPROC)&ProfilingTableDecorator::m_glBitmapxOES_profile;
+this->m_names[2033] = "glGetSamplerParameterIuiv";
+this->m_orig_glGetSamplerParameterIuiv = this->m_ptr_glGetSamplerParameterIuiv;
+if(this->m_ptr_glGetSamplerParameterIuiv)this->m_ptr_glGetSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterIuiv_profile;
+this->m_names[2034] = "glTexCoordP3ui";
+this->m_orig_glTexCoordP3ui = this->m_ptr_glTexCoordP3ui;
+if(this->m_ptr_glTexCoordP3ui)this->m_ptr_glTexCoordP3ui = (FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC)&ProfilingTableDecorator::m_glTexCoordP3ui_profile;
+this->m_names[2035] = "glTextureSubImage1D";
+this->m_orig_glTextureSubImage1D = this->m_ptr_glTextureSubImage1D;
+if(this->m_ptr_glTextureSubImage1D)this->m_ptr_glTextureSubImage1D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glTextureSubImage1D_profile;
+this->m_names[2036] = "glVertexAttribLPointerEXT";
+this->m_orig_glVertexAttribLPointerEXT = this->m_ptr_glVertexAttribLPointerEXT;
+if(this->m_ptr_glVertexAttribLPointerEXT)this->m_ptr_glVertexAttribLPointerEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC)&ProfilingTableDecorator::m_glVertexAttribLPointerEXT_profile;
+this->m_names[2037] = "glFogCoordPointerEXT";
+this->m_orig_glFogCoordPointerEXT = this->m_ptr_glFogCoordPointerEXT;
+if(this->m_ptr_glFogCoordPointerEXT)this->m_ptr_glFogCoordPointerEXT = (FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC)&ProfilingTableDecorator::m_glFogCoordPointerEXT_profile;
+this->m_names[2038] = "glWindowPos3s";
+this->m_orig_glWindowPos3s = this->m_ptr_glWindowPos3s;
+if(this->m_ptr_glWindowPos3s)this->m_ptr_glWindowPos3s = (FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC)&ProfilingTableDecorator::m_glWindowPos3s_profile;
+this->m_names[2039] = "glVertexAttribs2svNV";
+this->m_orig_glVertexAttribs2svNV = this->m_ptr_glVertexAttribs2svNV;
+if(this->m_ptr_glVertexAttribs2svNV)this->m_ptr_glVertexAttribs2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs2svNV_profile;
+this->m_names[2040] = "glTextureImage3DEXT";
+this->m_orig_glTextureImage3DEXT = this->m_ptr_glTextureImage3DEXT;
+if(this->m_ptr_glTextureImage3DEXT)this->m_ptr_glTextureImage3DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glTextureImage3DEXT_profile;
+this->m_names[2041] = "glWindowPos3i";
+this->m_orig_glWindowPos3i = this->m_ptr_glWindowPos3i;
+if(this->m_ptr_glWindowPos3i)this->m_ptr_glWindowPos3i = (FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC)&ProfilingTableDecorator::m_glWindowPos3i_profile;
+this->m_names[2042] = "glWindowPos3d";
+this->m_orig_glWindowPos3d = this->m_ptr_glWindowPos3d;
+if(this->m_ptr_glWindowPos3d)this->m_ptr_glWindowPos3d = (FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC)&ProfilingTableDecorator::m_glWindowPos3d_profile;
+this->m_names[2043] = "glWindowPos3f";
+this->m_orig_glWindowPos3f = this->m_ptr_glWindowPos3f;
+if(this->m_ptr_glWindowPos3f)this->m_ptr_glWindowPos3f = (FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC)&ProfilingTableDecorator::m_glWindowPos3f_profile;
+this->m_names[2044] = "glIsEnabledIndexedEXT";
+this->m_orig_glIsEnabledIndexedEXT = this->m_ptr_glIsEnabledIndexedEXT;
+if(this->m_ptr_glIsEnabledIndexedEXT)this->m_ptr_glIsEnabledIndexedEXT = (FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC)&ProfilingTableDecorator::m_glIsEnabledIndexedEXT_profile;
+this->m_names[2045] = "glGetNamedProgramivEXT";
+this->m_orig_glGetNamedProgramivEXT = this->m_ptr_glGetNamedProgramivEXT;
+if(this->m_ptr_glGetNamedProgramivEXT)this->m_ptr_glGetNamedProgramivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramivEXT_profile;
+this->m_names[2046] = "glVertex3xvOES";
+this->m_orig_glVertex3xvOES = this->m_ptr_glVertex3xvOES;
+if(this->m_ptr_glVertex3xvOES)this->m_ptr_glVertex3xvOES = (FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC)&ProfilingTableDecorator::m_glVertex3xvOES_profile;
+this->m_names[2047] = "glColor3us";
+this->m_orig_glColor3us = this->m_ptr_glColor3us;
+if(this->m_ptr_glColor3us)this->m_ptr_glColor3us = (FunctionTable::MEMBERPFNGLCOLOR3USPROC)&ProfilingTableDecorator::m_glColor3us_profile;
+this->m_names[2048] = "glBeginPerfMonitorAMD";
+this->m_orig_glBeginPerfMonitorAMD = this->m_ptr_glBeginPerfMonitorAMD;
+if(this->m_ptr_glBeginPerfMonitorAMD)this->m_ptr_glBeginPerfMonitorAMD = (FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC)&ProfilingTableDecorator::m_glBeginPerfMonitorAMD_profile;
+this->m_names[2049] = "glProgramUniformMatrix4x3dv";
+this->m_orig_glProgramUniformMatrix4x3dv = this->m_ptr_glProgramUniformMatrix4x3dv;
+if(this->m_ptr_glProgramUniformMatrix4x3dv)this->m_ptr_glProgramUniformMatrix4x3dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x3dv_profile;
+this->m_names[2050] = "glGetNamedProgramLocalParameterIuivEXT";
+this->m_orig_glGetNamedProgramLocalParameterIuivEXT = this->m_ptr_glGetNamedProgramLocalParameterIuivEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterIuivEXT)this->m_ptr_glGetNamedProgramLocalParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterIuivEXT_profile;
+this->m_names[2051] = "glReadnPixels";
+this->m_orig_glReadnPixels = this->m_ptr_glReadnPixels;
+if(this->m_ptr_glReadnPixels)this->m_ptr_glReadnPixels = (FunctionTable::MEMBERPFNGLREADNPIXELSPROC)&ProfilingTableDecorator::m_glReadnPixels_profile;
+this->m_names[2052] = "glMultiTexCoord4f";
+this->m_orig_glMultiTexCoord4f = this->m_ptr_glMultiTexCoord4f;
+if(this->m_ptr_glMultiTexCoord4f)this->m_ptr_glMultiTexCoord4f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC)&ProfilingTableDecorator::m_glMultiTexCoord4f_profile;
+this->m_names[2053] = "glColor3ub";
+this->m_orig_glColor3ub = this->m_ptr_glColor3ub;
+if(this->m_ptr_glColor3ub)this->m_ptr_glColor3ub = (FunctionTable::MEMBERPFNGLCOLOR3UBPROC)&ProfilingTableDecorator::m_glColor3ub_profile;
+this->m_names[2054] = "glMultiTexCoord4d";
+this->m_orig_glMultiTexCoord4d = this->m_ptr_glMultiTexCoord4d;
+if(this->m_ptr_glMultiTexCoord4d)this->m_ptr_glMultiTexCoord4d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC)&ProfilingTableDecorator::m_glMultiTexCoord4d_profile;
+this->m_names[2055] = "glVertexAttribL3ui64NV";
+this->m_orig_glVertexAttribL3ui64NV = this->m_ptr_glVertexAttribL3ui64NV;
+if(this->m_ptr_glVertexAttribL3ui64NV)this->m_ptr_glVertexAttribL3ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL3ui64NV_profile;
+this->m_names[2056] = "glColor3ui";
+this->m_orig_glColor3ui = this->m_ptr_glColor3ui;
+if(this->m_ptr_glColor3ui)this->m_ptr_glColor3ui = (FunctionTable::MEMBERPFNGLCOLOR3UIPROC)&ProfilingTableDecorator::m_glColor3ui_profile;
+this->m_names[2057] = "glProgramUniform4fvEXT";
+this->m_orig_glProgramUniform4fvEXT = this->m_ptr_glProgramUniform4fvEXT;
+if(this->m_ptr_glProgramUniform4fvEXT)this->m_ptr_glProgramUniform4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4fvEXT_profile;
+this->m_names[2058] = "glVertexAttrib2sARB";
+this->m_orig_glVertexAttrib2sARB = this->m_ptr_glVertexAttrib2sARB;
+if(this->m_ptr_glVertexAttrib2sARB)this->m_ptr_glVertexAttrib2sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2sARB_profile;
+this->m_names[2059] = "glMultiTexCoord4i";
+this->m_orig_glMultiTexCoord4i = this->m_ptr_glMultiTexCoord4i;
+if(this->m_ptr_glMultiTexCoord4i)this->m_ptr_glMultiTexCoord4i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC)&ProfilingTableDecorator::m_glMultiTexCoord4i_profile;
+this->m_names[2060] = "glCheckFramebufferStatusEXT";
+this->m_orig_glCheckFramebufferStatusEXT = this->m_ptr_glCheckFramebufferStatusEXT;
+if(this->m_ptr_glCheckFramebufferStatusEXT)this->m_ptr_glCheckFramebufferStatusEXT = (FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)&ProfilingTableDecorator::m_glCheckFramebufferStatusEXT_profile;
+this->m_names[2061] = "glGetnMapivARB";
+this->m_orig_glGetnMapivARB = this->m_ptr_glGetnMapivARB;
+if(this->m_ptr_glGetnMapivARB)this->m_ptr_glGetnMapivARB = (FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC)&ProfilingTableDecorator::m_glGetnMapivARB_profile;
+this->m_names[2062] = "glMultiTexCoord1ivARB";
+this->m_orig_glMultiTexCoord1ivARB = this->m_ptr_glMultiTexCoord1ivARB;
+if(this->m_ptr_glMultiTexCoord1ivARB)this->m_ptr_glMultiTexCoord1ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1ivARB_profile;
+this->m_names[2063] = "glDisableVertexAttribArrayARB";
+this->m_orig_glDisableVertexAttribArrayARB = this->m_ptr_glDisableVertexAttribArrayARB;
+if(this->m_ptr_glDisableVertexAttribArrayARB)this->m_ptr_glDisableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC)&ProfilingTableDecorator::m_glDisableVertexAttribArrayARB_profile;
+this->m_names[2064] = "glGetPolygonStipple";
+this->m_orig_glGetPolygonStipple = this->m_ptr_glGetPolygonStipple;
+if(this->m_ptr_glGetPolygonStipple)this->m_ptr_glGetPolygonStipple = (FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC)&ProfilingTableDecorator::m_glGetPolygonStipple_profile;
+this->m_names[2065] = "glVertexAttribI4ui";
+this->m_orig_glVertexAttribI4ui = this->m_ptr_glVertexAttribI4ui;
+if(this->m_ptr_glVertexAttribI4ui)this->m_ptr_glVertexAttribI4ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC)&ProfilingTableDecorator::m_glVertexAttribI4ui_profile;
+this->m_names[2066] = "glGetPathDashArrayNV";
+this->m_orig_glGetPathDashArrayNV = this->m_ptr_glGetPathDashArrayNV;
+if(this->m_ptr_glGetPathDashArrayNV)this->m_ptr_glGetPathDashArrayNV = (FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC)&ProfilingTableDecorator::m_glGetPathDashArrayNV_profile;
+this->m_names[2067] = "glMultiTexRenderbufferEXT";
+this->m_orig_glMultiTexRenderbufferEXT = this->m_ptr_glMultiTexRenderbufferEXT;
+if(this->m_ptr_glMultiTexRenderbufferEXT)this->m_ptr_glMultiTexRenderbufferEXT = (FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glMultiTexRenderbufferEXT_profile;
+this->m_names[2068] = "glCopyTextureSubImage1D";
+this->m_orig_glCopyTextureSubImage1D = this->m_ptr_glCopyTextureSubImage1D;
+if(this->m_ptr_glCopyTextureSubImage1D)this->m_ptr_glCopyTextureSubImage1D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage1D_profile;
+this->m_names[2069] = "glDeleteOcclusionQueriesNV";
+this->m_orig_glDeleteOcclusionQueriesNV = this->m_ptr_glDeleteOcclusionQueriesNV;
+if(this->m_ptr_glDeleteOcclusionQueriesNV)this->m_ptr_glDeleteOcclusionQueriesNV = (FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC)&ProfilingTableDecorator::m_glDeleteOcclusionQueriesNV_profile;
+this->m_names[2070] = "glVertex4hvNV";
+this->m_orig_glVertex4hvNV = this->m_ptr_glVertex4hvNV;
+if(this->m_ptr_glVertex4hvNV)this->m_ptr_glVertex4hvNV = (FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC)&ProfilingTableDecorator::m_glVertex4hvNV_profile;
+this->m_names[2071] = "glGetnTexImage";
+this->m_orig_glGetnTexImage = this->m_ptr_glGetnTexImage;
+if(this->m_ptr_glGetnTexImage)this->m_ptr_glGetnTexImage = (FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetnTexImage_profile;
+this->m_names[2072] = "glProgramLocalParameter4dARB";
+this->m_orig_glProgramLocalParameter4dARB = this->m_ptr_glProgramLocalParameter4dARB;
+if(this->m_ptr_glProgramLocalParameter4dARB)this->m_ptr_glProgramLocalParameter4dARB = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC)&ProfilingTableDecorator::m_glProgramLocalParameter4dARB_profile;
+this->m_names[2073] = "glBlendEquation";
+this->m_orig_glBlendEquation = this->m_ptr_glBlendEquation;
+if(this->m_ptr_glBlendEquation)this->m_ptr_glBlendEquation = (FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC)&ProfilingTableDecorator::m_glBlendEquation_profile;
+this->m_names[2074] = "glUnlockArraysEXT";
+this->m_orig_glUnlockArraysEXT = this->m_ptr_glUnlockArraysEXT;
+if(this->m_ptr_glUnlockArraysEXT)this->m_ptr_glUnlockArraysEXT = (FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC)&ProfilingTableDecorator::m_glUnlockArraysEXT_profile;
+this->m_names[2075] = "glGetQueryObjectui64vEXT";
+this->m_orig_glGetQueryObjectui64vEXT = this->m_ptr_glGetQueryObjectui64vEXT;
+if(this->m_ptr_glGetQueryObjectui64vEXT)this->m_ptr_glGetQueryObjectui64vEXT = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC)&ProfilingTableDecorator::m_glGetQueryObjectui64vEXT_profile;
+this->m_names[2076] = "glVertexAttribI4uivEXT";
+this->m_orig_glVertexAttribI4uivEXT = this->m_ptr_glVertexAttribI4uivEXT;
+if(this->m_ptr_glVertexAttribI4uivEXT)this->m_ptr_glVertexAttribI4uivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4uivEXT_profile;
+this->m_names[2077] = "glUniform1i64vNV";
+this->m_orig_glUniform1i64vNV = this->m_ptr_glUniform1i64vNV;
+if(this->m_ptr_glUniform1i64vNV)this->m_ptr_glUniform1i64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC)&ProfilingTableDecorator::m_glUniform1i64vNV_profile;
+this->m_names[2078] = "glMultiTexCoord3dv";
+this->m_orig_glMultiTexCoord3dv = this->m_ptr_glMultiTexCoord3dv;
+if(this->m_ptr_glMultiTexCoord3dv)this->m_ptr_glMultiTexCoord3dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dv_profile;
+this->m_names[2079] = "glColor4sv";
+this->m_orig_glColor4sv = this->m_ptr_glColor4sv;
+if(this->m_ptr_glColor4sv)this->m_ptr_glColor4sv = (FunctionTable::MEMBERPFNGLCOLOR4SVPROC)&ProfilingTableDecorator::m_glColor4sv_profile;
+this->m_names[2080] = "glVertexStream4ivATI";
+this->m_orig_glVertexStream4ivATI = this->m_ptr_glVertexStream4ivATI;
+if(this->m_ptr_glVertexStream4ivATI)this->m_ptr_glVertexStream4ivATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC)&ProfilingTableDecorator::m_glVertexStream4ivATI_profile;
+this->m_names[2081] = "glPopClientAttrib";
+this->m_orig_glPopClientAttrib = this->m_ptr_glPopClientAttrib;
+if(this->m_ptr_glPopClientAttrib)this->m_ptr_glPopClientAttrib = (FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC)&ProfilingTableDecorator::m_glPopClientAttrib_profile;
+this->m_names[2082] = "glClearBufferData";
+this->m_orig_glClearBufferData = this->m_ptr_glClearBufferData;
+if(this->m_ptr_glClearBufferData)this->m_ptr_glClearBufferData = (FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC)&ProfilingTableDecorator::m_glClearBufferData_profile;
+this->m_names[2083] = "glGetProgramivNV";
+this->m_orig_glGetProgramivNV = this->m_ptr_glGetProgramivNV;
+if(this->m_ptr_glGetProgramivNV)this->m_ptr_glGetProgramivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC)&ProfilingTableDecorator::m_glGetProgramivNV_profile;
+this->m_names[2084] = "glBeginTransformFeedback";
+this->m_orig_glBeginTransformFeedback = this->m_ptr_glBeginTransformFeedback;
+if(this->m_ptr_glBeginTransformFeedback)this->m_ptr_glBeginTransformFeedback = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glBeginTransformFeedback_profile;
+this->m_names[2085] = "glFinishObjectAPPLE";
+this->m_orig_glFinishObjectAPPLE = this->m_ptr_glFinishObjectAPPLE;
+if(this->m_ptr_glFinishObjectAPPLE)this->m_ptr_glFinishObjectAPPLE = (FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC)&ProfilingTableDecorator::m_glFinishObjectAPPLE_profile;
+this->m_names[2086] = "glGetMinmaxParameterivEXT";
+this->m_orig_glGetMinmaxParameterivEXT = this->m_ptr_glGetMinmaxParameterivEXT;
+if(this->m_ptr_glGetMinmaxParameterivEXT)this->m_ptr_glGetMinmaxParameterivEXT = (FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMinmaxParameterivEXT_profile;
+this->m_names[2087] = "glColor3iv";
+this->m_orig_glColor3iv = this->m_ptr_glColor3iv;
+if(this->m_ptr_glColor3iv)this->m_ptr_glColor3iv = (FunctionTable::MEMBERPFNGLCOLOR3IVPROC)&ProfilingTableDecorator::m_glColor3iv_profile;
+this->m_names[2088] = "glVertexAttrib3sv";
+this->m_orig_glVertexAttrib3sv = this->m_ptr_glVertexAttrib3sv;
+if(this->m_ptr_glVertexAttrib3sv)this->m_ptr_glVertexAttrib3sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC)&ProfilingTableDecorator::m_glVertexAttrib3sv_profile;
+this->m_names[2089] = "glCompressedTexImage1D";
+this->m_orig_glCompressedTexImage1D = this->m_ptr_glCompressedTexImage1D;
+if(this->m_ptr_glCompressedTexImage1D)this->m_ptr_glCompressedTexImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTexImage1D_profile;
+this->m_names[2090] = "glDeleteTransformFeedbacks";
+this->m_orig_glDeleteTransformFeedbacks = this->m_ptr_glDeleteTransformFeedbacks;
+if(this->m_ptr_glDeleteTransformFeedbacks)this->m_ptr_glDeleteTransformFeedbacks = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glDeleteTransformFeedbacks_profile;
+this->m_names[2091] = "glGetVideoi64vNV";
+this->m_orig_glGetVideoi64vNV = this->m_ptr_glGetVideoi64vNV;
+if(this->m_ptr_glGetVideoi64vNV)this->m_ptr_glGetVideoi64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC)&ProfilingTableDecorator::m_glGetVideoi64vNV_profile;
+this->m_names[2092] = "glDrawRangeElementsBaseVertex";
+this->m_orig_glDrawRangeElementsBaseVertex = this->m_ptr_glDrawRangeElementsBaseVertex;
+if(this->m_ptr_glDrawRangeElementsBaseVertex)this->m_ptr_glDrawRangeElementsBaseVertex = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawRangeElementsBaseVertex_profile;
+this->m_names[2093] = "glUniform4i64vARB";
+this->m_orig_glUniform4i64vARB = this->m_ptr_glUniform4i64vARB;
+if(this->m_ptr_glUniform4i64vARB)this->m_ptr_glUniform4i64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC)&ProfilingTableDecorator::m_glUniform4i64vARB_profile;
+this->m_names[2094] = "glTextureStorage3DMultisampleEXT";
+this->m_orig_glTextureStorage3DMultisampleEXT = this->m_ptr_glTextureStorage3DMultisampleEXT;
+if(this->m_ptr_glTextureStorage3DMultisampleEXT)this->m_ptr_glTextureStorage3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorage3DMultisampleEXT_profile;
+this->m_names[2095] = "glGetTexParameterfv";
+this->m_orig_glGetTexParameterfv = this->m_ptr_glGetTexParameterfv;
+if(this->m_ptr_glGetTexParameterfv)this->m_ptr_glGetTexParameterfv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC)&ProfilingTableDecorator::m_glGetTexParameterfv_profile;
+this->m_names[2096] = "glProgramUniformui64vNV";
+this->m_orig_glProgramUniformui64vNV = this->m_ptr_glProgramUniformui64vNV;
+if(this->m_ptr_glProgramUniformui64vNV)this->m_ptr_glProgramUniformui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniformui64vNV_profile;
+this->m_names[2097] = "glCompressedMultiTexImage1DEXT";
+this->m_orig_glCompressedMultiTexImage1DEXT = this->m_ptr_glCompressedMultiTexImage1DEXT;
+if(this->m_ptr_glCompressedMultiTexImage1DEXT)this->m_ptr_glCompressedMultiTexImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage1DEXT_profile;
+this->m_names[2098] = "glProgramUniform2ivEXT";
+this->m_orig_glProgramUniform2ivEXT = this->m_ptr_glProgramUniform2ivEXT;
+if(this->m_ptr_glProgramUniform2ivEXT)this->m_ptr_glProgramUniform2ivEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2ivEXT_profile;
+this->m_names[2099] = "glPushGroupMarkerEXT";
+this->m_orig_glPushGroupMarkerEXT = this->m_ptr_glPushGroupMarkerEXT;
+if(this->m_ptr_glPushGroupMarkerEXT)this->m_ptr_glPushGroupMarkerEXT = (FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC)&ProfilingTableDecorator::m_glPushGroupMarkerEXT_profile;
+this->m_names[2100] = "glVertexAttrib1dv";
+this->m_orig_glVertexAttrib1dv = this->m_ptr_glVertexAttrib1dv;
+if(this->m_ptr_glVertexAttrib1dv)this->m_ptr_glVertexAttrib1dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC)&ProfilingTableDecorator::m_glVertexAttrib1dv_profile;
+this->m_names[2101] = "glMatrixLoadIdentityEXT";
+this->m_orig_glMatrixLoadIdentityEXT = this->m_ptr_glMatrixLoadIdentityEXT;
+if(this->m_ptr_glMatrixLoadIdentityEXT)this->m_ptr_glMatrixLoadIdentityEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadIdentityEXT_profile;
+this->m_names[2102] = "glMultTransposeMatrixxOES";
+this->m_orig_glMultTransposeMatrixxOES = this->m_ptr_glMultTransposeMatrixxOES;
+if(this->m_ptr_glMultTransposeMatrixxOES)this->m_ptr_glMultTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixxOES_profile;
+this->m_names[2103] = "glGetPixelMapxv";
+this->m_orig_glGetPixelMapxv = this->m_ptr_glGetPixelMapxv;
+if(this->m_ptr_glGetPixelMapxv)this->m_ptr_glGetPixelMapxv = (FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC)&ProfilingTableDecorator::m_glGetPixelMapxv_profile;
+this->m_names[2104] = "glFramebufferSampleLocationsfvARB";
+this->m_orig_glFramebufferSampleLocationsfvARB = this->m_ptr_glFramebufferSampleLocationsfvARB;
+if(this->m_ptr_glFramebufferSampleLocationsfvARB)this->m_ptr_glFramebufferSampleLocationsfvARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC)&ProfilingTableDecorator::m_glFramebufferSampleLocationsfvARB_profile;
+this->m_names[2105] = "glGetLightiv";
+this->m_orig_glGetLightiv = this->m_ptr_glGetLightiv;
+if(this->m_ptr_glGetLightiv)this->m_ptr_glGetLightiv = (FunctionTable::MEMBERPFNGLGETLIGHTIVPROC)&ProfilingTableDecorator::m_glGetLightiv_profile;
+this->m_names[2106] = "glBlendFuncSeparatei";
+this->m_orig_glBlendFuncSeparatei = this->m_ptr_glBlendFuncSeparatei;
+if(this->m_ptr_glBlendFuncSeparatei)this->m_ptr_glBlendFuncSeparatei = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC)&ProfilingTableDecorator::m_glBlendFuncSeparatei_profile;
+this->m_names[2107] = "glAcquireKeyedMutexWin32EXT";
+this->m_orig_glAcquireKeyedMutexWin32EXT = this->m_ptr_glAcquireKeyedMutexWin32EXT;
+if(this->m_ptr_glAcquireKeyedMutexWin32EXT)this->m_ptr_glAcquireKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC)&ProfilingTableDecorator::m_glAcquireKeyedMutexWin32EXT_profile;
+this->m_names[2108] = "glGetBooleanIndexedvEXT";
+this->m_orig_glGetBooleanIndexedvEXT = this->m_ptr_glGetBooleanIndexedvEXT;
+if(this->m_ptr_glGetBooleanIndexedvEXT)this->m_ptr_glGetBooleanIndexedvEXT = (FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC)&ProfilingTableDecorator::m_glGetBooleanIndexedvEXT_profile;
+this->m_names[2109] = "glGetProgramSubroutineParameteruivNV";
+this->m_orig_glGetProgramSubroutineParameteruivNV = this->m_ptr_glGetProgramSubroutineParameteruivNV;
+if(this->m_ptr_glGetProgramSubroutineParameteruivNV)this->m_ptr_glGetProgramSubroutineParameteruivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramSubroutineParameteruivNV_profile;
+this->m_names[2110] = "glUniform2ui";
+this->m_orig_glUniform2ui = this->m_ptr_glUniform2ui;
+if(this->m_ptr_glUniform2ui)this->m_ptr_glUniform2ui = (FunctionTable::MEMBERPFNGLUNIFORM2UIPROC)&ProfilingTableDecorator::m_glUniform2ui_profile;
+this->m_names[2111] = "glApplyFramebufferAttachmentCMAAINTEL";
+this->m_orig_glApplyFramebufferAttachmentCMAAINTEL = this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL;
+if(this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL)this->m_ptr_glApplyFramebufferAttachmentCMAAINTEL = (FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC)&ProfilingTableDecorator::m_glApplyFramebufferAttachmentCMAAINTEL_profile;
+this->m_names[2112] = "glWindowPos2fv";
+this->m_orig_glWindowPos2fv = this->m_ptr_glWindowPos2fv;
+if(this->m_ptr_glWindowPos2fv)this->m_ptr_glWindowPos2fv = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC)&ProfilingTableDecorator::m_glWindowPos2fv_profile;
+this->m_names[2113] = "glWaitVkSemaphoreNV";
+this->m_orig_glWaitVkSemaphoreNV = this->m_ptr_glWaitVkSemaphoreNV;
+if(this->m_ptr_glWaitVkSemaphoreNV)this->m_ptr_glWaitVkSemaphoreNV = (FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC)&ProfilingTableDecorator::m_glWaitVkSemaphoreNV_profile;
+this->m_names[2114] = "glDisablei";
+this->m_orig_glDisablei = this->m_ptr_glDisablei;
+if(this->m_ptr_glDisablei)this->m_ptr_glDisablei = (FunctionTable::MEMBERPFNGLDISABLEIPROC)&ProfilingTableDecorator::m_glDisablei_profile;
+this->m_names[2115] = "glSelectPerfMonitorCountersAMD";
+this->m_orig_glSelectPerfMonitorCountersAMD = this->m_ptr_glSelectPerfMonitorCountersAMD;
+if(this->m_ptr_glSelectPerfMonitorCountersAMD)this->m_ptr_glSelectPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC)&ProfilingTableDecorator::m_glSelectPerfMonitorCountersAMD_profile;
+this->m_names[2116] = "glGetVertexAttribLi64vNV";
+this->m_orig_glGetVertexAttribLi64vNV = this->m_ptr_glGetVertexAttribLi64vNV;
+if(this->m_ptr_glGetVertexAttribLi64vNV)this->m_ptr_glGetVertexAttribLi64vNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribLi64vNV_profile;
+this->m_names[2117] = "glBlendFuncSeparateiARB";
+this->m_orig_glBlendFuncSeparateiARB = this->m_ptr_glBlendFuncSeparateiARB;
+if(this->m_ptr_glBlendFuncSeparateiARB)this->m_ptr_glBlendFuncSeparateiARB = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateiARB_profile;
+this->m_names[2118] = "glWeightuivARB";
+this->m_orig_glWeightuivARB = this->m_ptr_glWeightuivARB;
+if(this->m_ptr_glWeightuivARB)this->m_ptr_glWeightuivARB = (FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC)&ProfilingTableDecorator::m_glWeightuivARB_profile;
+this->m_names[2119] = "glWindowPos2iARB";
+this->m_orig_glWindowPos2iARB = this->m_ptr_glWindowPos2iARB;
+if(this->m_ptr_glWindowPos2iARB)this->m_ptr_glWindowPos2iARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC)&ProfilingTableDecorator::m_glWindowPos2iARB_profile;
+this->m_names[2120] = "glGetProgramLocalParameterdvARB";
+this->m_orig_glGetProgramLocalParameterdvARB = this->m_ptr_glGetProgramLocalParameterdvARB;
+if(this->m_ptr_glGetProgramLocalParameterdvARB)this->m_ptr_glGetProgramLocalParameterdvARB = (FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)&ProfilingTableDecorator::m_glGetProgramLocalParameterdvARB_profile;
+this->m_names[2121] = "glGetUniformui64vARB";
+this->m_orig_glGetUniformui64vARB = this->m_ptr_glGetUniformui64vARB;
+if(this->m_ptr_glGetUniformui64vARB)this->m_ptr_glGetUniformui64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC)&ProfilingTableDecorator::m_glGetUniformui64vARB_profile;
+this->m_names[2122] = "glSecondaryColor3us";
+this->m_orig_glSecondaryColor3us = this->m_ptr_glSecondaryColor3us;
+if(this->m_ptr_glSecondaryColor3us)this->m_ptr_glSecondaryColor3us = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC)&ProfilingTableDecorator::m_glSecondaryColor3us_profile;
+this->m_names[2123] = "glGetSynciv";
+this->m_orig_glGetSynciv = this->m_ptr_glGetSynciv;
+if(this->m_ptr_glGetSynciv)this->m_ptr_glGetSynciv = (FunctionTable::MEMBERPFNGLGETSYNCIVPROC)&ProfilingTableDecorator::m_glGetSynciv_profile;
+this->m_names[2124] = "glMakeImageHandleResidentARB";
+this->m_orig_glMakeImageHandleResidentARB = this->m_ptr_glMakeImageHandleResidentARB;
+if(this->m_ptr_glMakeImageHandleResidentARB)this->m_ptr_glMakeImageHandleResidentARB = (FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC)&ProfilingTableDecorator::m_glMakeImageHandleResidentARB_profile;
+this->m_names[2125] = "glGetProgramNamedParameterfvNV";
+this->m_orig_glGetProgramNamedParameterfvNV = this->m_ptr_glGetProgramNamedParameterfvNV;
+if(this->m_ptr_glGetProgramNamedParameterfvNV)this->m_ptr_glGetProgramNamedParameterfvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetProgramNamedParameterfvNV_profile;
+this->m_names[2126] = "glTextureStorage3D";
+this->m_orig_glTextureStorage3D = this->m_ptr_glTextureStorage3D;
+if(this->m_ptr_glTextureStorage3D)this->m_ptr_glTextureStorage3D = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC)&ProfilingTableDecorator::m_glTextureStorage3D_profile;
+this->m_names[2127] = "glVertexAttrib4svNV";
+this->m_orig_glVertexAttrib4svNV = this->m_ptr_glVertexAttrib4svNV;
+if(this->m_ptr_glVertexAttrib4svNV)this->m_ptr_glVertexAttrib4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4svNV_profile;
+this->m_names[2128] = "glProgramUniform2i";
+this->m_orig_glProgramUniform2i = this->m_ptr_glProgramUniform2i;
+if(this->m_ptr_glProgramUniform2i)this->m_ptr_glProgramUniform2i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC)&ProfilingTableDecorator::m_glProgramUniform2i_profile;
+this->m_names[2129] = "glListDrawCommandsStatesClientNV";
+this->m_orig_glListDrawCommandsStatesClientNV = this->m_ptr_glListDrawCommandsStatesClientNV;
+if(this->m_ptr_glListDrawCommandsStatesClientNV)this->m_ptr_glListDrawCommandsStatesClientNV = (FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC)&ProfilingTableDecorator::m_glListDrawCommandsStatesClientNV_profile;
+this->m_names[2130] = "glProgramLocalParametersI4uivNV";
+this->m_orig_glProgramLocalParametersI4uivNV = this->m_ptr_glProgramLocalParametersI4uivNV;
+if(this->m_ptr_glProgramLocalParametersI4uivNV)this->m_ptr_glProgramLocalParametersI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParametersI4uivNV_profile;
+this->m_names[2131] = "glBeginTransformFeedbackNV";
+this->m_orig_glBeginTransformFeedbackNV = this->m_ptr_glBeginTransformFeedbackNV;
+if(this->m_ptr_glBeginTransformFeedbackNV)this->m_ptr_glBeginTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glBeginTransformFeedbackNV_profile;
+this->m_names[2132] = "glGetProgramBinary";
+this->m_orig_glGetProgramBinary = this->m_ptr_glGetProgramBinary;
+if(this->m_ptr_glGetProgramBinary)this->m_ptr_glGetProgramBinary = (FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC)&ProfilingTableDecorator::m_glGetProgramBinary_profile;
+this->m_names[2133] = "glBinormal3iEXT";
+this->m_orig_glBinormal3iEXT = this->m_ptr_glBinormal3iEXT;
+if(this->m_ptr_glBinormal3iEXT)this->m_ptr_glBinormal3iEXT = (FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC)&ProfilingTableDecorator::m_glBinormal3iEXT_profile;
+this->m_names[2134] = "glEvalPoint1";
+this->m_orig_glEvalPoint1 = this->m_ptr_glEvalPoint1;
+if(this->m_ptr_glEvalPoint1)this->m_ptr_glEvalPoint1 = (FunctionTable::MEMBERPFNGLEVALPOINT1PROC)&ProfilingTableDecorator::m_glEvalPoint1_profile;
+this->m_names[2135] = "glEvalPoint2";
+this->m_orig_glEvalPoint2 = this->m_ptr_glEvalPoint2;
+if(this->m_ptr_glEvalPoint2)this->m_ptr_glEvalPoint2 = (FunctionTable::MEMBERPFNGLEVALPOINT2PROC)&ProfilingTableDecorator::m_glEvalPoint2_profile;
+this->m_names[2136] = "glPauseTransformFeedback";
+this->m_orig_glPauseTransformFeedback = this->m_ptr_glPauseTransformFeedback;
+if(this->m_ptr_glPauseTransformFeedback)this->m_ptr_glPauseTransformFeedback = (FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glPauseTransformFeedback_profile;
+this->m_names[2137] = "glWindowPos2sMESA";
+this->m_orig_glWindowPos2sMESA = this->m_ptr_glWindowPos2sMESA;
+if(this->m_ptr_glWindowPos2sMESA)this->m_ptr_glWindowPos2sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC)&ProfilingTableDecorator::m_glWindowPos2sMESA_profile;
+this->m_names[2138] = "glGlobalAlphaFactorbSUN";
+this->m_orig_glGlobalAlphaFactorbSUN = this->m_ptr_glGlobalAlphaFactorbSUN;
+if(this->m_ptr_glGlobalAlphaFactorbSUN)this->m_ptr_glGlobalAlphaFactorbSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorbSUN_profile;
+this->m_names[2139] = "glCreateTransformFeedbacks";
+this->m_orig_glCreateTransformFeedbacks = this->m_ptr_glCreateTransformFeedbacks;
+if(this->m_ptr_glCreateTransformFeedbacks)this->m_ptr_glCreateTransformFeedbacks = (FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glCreateTransformFeedbacks_profile;
+this->m_names[2140] = "glTexturePageCommitmentEXT";
+this->m_orig_glTexturePageCommitmentEXT = this->m_ptr_glTexturePageCommitmentEXT;
+if(this->m_ptr_glTexturePageCommitmentEXT)this->m_ptr_glTexturePageCommitmentEXT = (FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC)&ProfilingTableDecorator::m_glTexturePageCommitmentEXT_profile;
+this->m_names[2141] = "glTransformFeedbackVaryingsNV";
+this->m_orig_glTransformFeedbackVaryingsNV = this->m_ptr_glTransformFeedbackVaryingsNV;
+if(this->m_ptr_glTransformFeedbackVaryingsNV)this->m_ptr_glTransformFeedbackVaryingsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryingsNV_profile;
+this->m_names[2142] = "glTexSubImage1D";
+this->m_orig_glTexSubImage1D = this->m_ptr_glTexSubImage1D;
+if(this->m_ptr_glTexSubImage1D)this->m_ptr_glTexSubImage1D = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glTexSubImage1D_profile;
+this->m_names[2143] = "glConvolutionParameterfvEXT";
+this->m_orig_glConvolutionParameterfvEXT = this->m_ptr_glConvolutionParameterfvEXT;
+if(this->m_ptr_glConvolutionParameterfvEXT)this->m_ptr_glConvolutionParameterfvEXT = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glConvolutionParameterfvEXT_profile;
+this->m_names[2144] = "glBlitFramebufferEXT";
+this->m_orig_glBlitFramebufferEXT = this->m_ptr_glBlitFramebufferEXT;
+if(this->m_ptr_glBlitFramebufferEXT)this->m_ptr_glBlitFramebufferEXT = (FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC)&ProfilingTableDecorator::m_glBlitFramebufferEXT_profile;
+this->m_names[2145] = "glUniformMatrix4fvARB";
+this->m_orig_glUniformMatrix4fvARB = this->m_ptr_glUniformMatrix4fvARB;
+if(this->m_ptr_glUniformMatrix4fvARB)this->m_ptr_glUniformMatrix4fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix4fvARB_profile;
+this->m_names[2146] = "glProgramEnvParameter4dvARB";
+this->m_orig_glProgramEnvParameter4dvARB = this->m_ptr_glProgramEnvParameter4dvARB;
+if(this->m_ptr_glProgramEnvParameter4dvARB)this->m_ptr_glProgramEnvParameter4dvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4dvARB_profile;
+this->m_names[2147] = "glTextureStorageMem2DEXT";
+this->m_orig_glTextureStorageMem2DEXT = this->m_ptr_glTextureStorageMem2DEXT;
+if(this->m_ptr_glTextureStorageMem2DEXT)this->m_ptr_glTextureStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC)&ProfilingTableDecorator::m_glTextureStorageMem2DEXT_profile;
+this->m_names[2148] = "glVertexAttribP3uiv";
+this->m_orig_glVertexAttribP3uiv = this->m_ptr_glVertexAttribP3uiv;
+if(this->m_ptr_glVertexAttribP3uiv)this->m_ptr_glVertexAttribP3uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP3uiv_profile;
+this->m_names[2149] = "glFogCoordFormatNV";
+this->m_orig_glFogCoordFormatNV = this->m_ptr_glFogCoordFormatNV;
+if(this->m_ptr_glFogCoordFormatNV)this->m_ptr_glFogCoordFormatNV = (FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC)&ProfilingTableDecorator::m_glFogCoordFormatNV_profile;
+this->m_names[2150] = "glGetMultiTexLevelParameterivEXT";
+this->m_orig_glGetMultiTexLevelParameterivEXT = this->m_ptr_glGetMultiTexLevelParameterivEXT;
+if(this->m_ptr_glGetMultiTexLevelParameterivEXT)this->m_ptr_glGetMultiTexLevelParameterivEXT = (FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetMultiTexLevelParameterivEXT_profile;
+this->m_names[2151] = "glIsOcclusionQueryNV";
+this->m_orig_glIsOcclusionQueryNV = this->m_ptr_glIsOcclusionQueryNV;
+if(this->m_ptr_glIsOcclusionQueryNV)this->m_ptr_glIsOcclusionQueryNV = (FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glIsOcclusionQueryNV_profile;
+this->m_names[2152] = "glCompressedTexImage2DARB";
+this->m_orig_glCompressedTexImage2DARB = this->m_ptr_glCompressedTexImage2DARB;
+if(this->m_ptr_glCompressedTexImage2DARB)this->m_ptr_glCompressedTexImage2DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage2DARB_profile;
+this->m_names[2153] = "glGetProgramEnvParameterIuivNV";
+this->m_orig_glGetProgramEnvParameterIuivNV = this->m_ptr_glGetProgramEnvParameterIuivNV;
+if(this->m_ptr_glGetProgramEnvParameterIuivNV)this->m_ptr_glGetProgramEnvParameterIuivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterIuivNV_profile;
+this->m_names[2154] = "glVertexAttrib4sv";
+this->m_orig_glVertexAttrib4sv = this->m_ptr_glVertexAttrib4sv;
+if(this->m_ptr_glVertexAttrib4sv)this->m_ptr_glVertexAttrib4sv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC)&ProfilingTableDecorator::m_glVertexAttrib4sv_profile;
+this->m_names[2155] = "glVertexAttrib4fvARB";
+this->m_orig_glVertexAttrib4fvARB = this->m_ptr_glVertexAttrib4fvARB;
+if(this->m_ptr_glVertexAttrib4fvARB)this->m_ptr_glVertexAttrib4fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4fvARB_profile;
+this->m_names[2156] = "glLoadName";
+this->m_orig_glLoadName = this->m_ptr_glLoadName;
+if(this->m_ptr_glLoadName)this->m_ptr_glLoadName = (FunctionTable::MEMBERPFNGLLOADNAMEPROC)&ProfilingTableDecorator::m_glLoadName_profile;
+this->m_names[2157] = "glBindVertexShaderEXT";
+this->m_orig_glBindVertexShaderEXT = this->m_ptr_glBindVertexShaderEXT;
+if(this->m_ptr_glBindVertexShaderEXT)this->m_ptr_glBindVertexShaderEXT = (FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glBindVertexShaderEXT_profile;
+this->m_names[2158] = "glGetNamedProgramLocalParameterIivEXT";
+this->m_orig_glGetNamedProgramLocalParameterIivEXT = this->m_ptr_glGetNamedProgramLocalParameterIivEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterIivEXT)this->m_ptr_glGetNamedProgramLocalParameterIivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterIivEXT_profile;
+this->m_names[2159] = "glProgramUniform3uiEXT";
+this->m_orig_glProgramUniform3uiEXT = this->m_ptr_glProgramUniform3uiEXT;
+if(this->m_ptr_glProgramUniform3uiEXT)this->m_ptr_glProgramUniform3uiEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC)&ProfilingTableDecorator::m_glProgramUniform3uiEXT_profile;
+this->m_names[2160] = "glProgramUniformMatrix4x2dvEXT";
+this->m_orig_glProgramUniformMatrix4x2dvEXT = this->m_ptr_glProgramUniformMatrix4x2dvEXT;
+if(this->m_ptr_glProgramUniformMatrix4x2dvEXT)this->m_ptr_glProgramUniformMatrix4x2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2dvEXT_profile;
+this->m_names[2161] = "glTexCoord1hvNV";
+this->m_orig_glTexCoord1hvNV = this->m_ptr_glTexCoord1hvNV;
+if(this->m_ptr_glTexCoord1hvNV)this->m_ptr_glTexCoord1hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC)&ProfilingTableDecorator::m_glTexCoord1hvNV_profile;
+this->m_names[2162] = "glLoadMatrixd";
+this->m_orig_glLoadMatrixd = this->m_ptr_glLoadMatrixd;
+if(this->m_ptr_glLoadMatrixd)this->m_ptr_glLoadMatrixd = (FunctionTable::MEMBERPFNGLLOADMATRIXDPROC)&ProfilingTableDecorator::m_glLoadMatrixd_profile;
+this->m_names[2163] = "glTexParameterfv";
+this->m_orig_glTexParameterfv = this->m_ptr_glTexParameterfv;
+if(this->m_ptr_glTexParameterfv)this->m_ptr_glTexParameterfv = (FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC)&ProfilingTableDecorator::m_glTexParameterfv_profile;
+this->m_names[2164] = "glVariantdvEXT";
+this->m_orig_glVariantdvEXT = this->m_ptr_glVariantdvEXT;
+if(this->m_ptr_glVariantdvEXT)this->m_ptr_glVariantdvEXT = (FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC)&ProfilingTableDecorator::m_glVariantdvEXT_profile;
+this->m_names[2165] = "glCullParameterfvEXT";
+this->m_orig_glCullParameterfvEXT = this->m_ptr_glCullParameterfvEXT;
+if(this->m_ptr_glCullParameterfvEXT)this->m_ptr_glCullParameterfvEXT = (FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glCullParameterfvEXT_profile;
+this->m_names[2166] = "glUniform3dv";
+this->m_orig_glUniform3dv = this->m_ptr_glUniform3dv;
+if(this->m_ptr_glUniform3dv)this->m_ptr_glUniform3dv = (FunctionTable::MEMBERPFNGLUNIFORM3DVPROC)&ProfilingTableDecorator::m_glUniform3dv_profile;
+this->m_names[2167] = "glProgramUniform3fv";
+this->m_orig_glProgramUniform3fv = this->m_ptr_glProgramUniform3fv;
+if(this->m_ptr_glProgramUniform3fv)this->m_ptr_glProgramUniform3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC)&ProfilingTableDecorator::m_glProgramUniform3fv_profile;
+this->m_names[2168] = "glIsBufferARB";
+this->m_orig_glIsBufferARB = this->m_ptr_glIsBufferARB;
+if(this->m_ptr_glIsBufferARB)this->m_ptr_glIsBufferARB = (FunctionTable::MEMBERPFNGLISBUFFERARBPROC)&ProfilingTableDecorator::m_glIsBufferARB_profile;
+this->m_names[2169] = "glMultiTexCoord1bOES";
+this->m_orig_glMultiTexCoord1bOES = this->m_ptr_glMultiTexCoord1bOES;
+if(this->m_ptr_glMultiTexCoord1bOES)this->m_ptr_glMultiTexCoord1bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1bOES_profile;
+this->m_names[2170] = "glFogCoordhNV";
+this->m_orig_glFogCoordhNV = this->m_ptr_glFogCoordhNV;
+if(this->m_ptr_glFogCoordhNV)this->m_ptr_glFogCoordhNV = (FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC)&ProfilingTableDecorator::m_glFogCoordhNV_profile;
+this->m_names[2171] = "glFramebufferSampleLocationsfvNV";
+this->m_orig_glFramebufferSampleLocationsfvNV = this->m_ptr_glFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glFramebufferSampleLocationsfvNV)this->m_ptr_glFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfilingTableDecorator::m_glFramebufferSampleLocationsfvNV_profile;
+this->m_names[2172] = "glGenSymbolsEXT";
+this->m_orig_glGenSymbolsEXT = this->m_ptr_glGenSymbolsEXT;
+if(this->m_ptr_glGenSymbolsEXT)this->m_ptr_glGenSymbolsEXT = (FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC)&ProfilingTableDecorator::m_glGenSymbolsEXT_profile;
+this->m_names[2173] = "glGetConvolutionFilter";
+this->m_orig_glGetConvolutionFilter = this->m_ptr_glGetConvolutionFilter;
+if(this->m_ptr_glGetConvolutionFilter)this->m_ptr_glGetConvolutionFilter = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC)&ProfilingTableDecorator::m_glGetConvolutionFilter_profile;
+this->m_names[2174] = "glProgramUniform1fvEXT";
+this->m_orig_glProgramUniform1fvEXT = this->m_ptr_glProgramUniform1fvEXT;
+if(this->m_ptr_glProgramUniform1fvEXT)this->m_ptr_glProgramUniform1fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1fvEXT_profile;
+this->m_names[2175] = "glGetNextPerfQueryIdINTEL";
+this->m_orig_glGetNextPerfQueryIdINTEL = this->m_ptr_glGetNextPerfQueryIdINTEL;
+if(this->m_ptr_glGetNextPerfQueryIdINTEL)this->m_ptr_glGetNextPerfQueryIdINTEL = (FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC)&ProfilingTableDecorator::m_glGetNextPerfQueryIdINTEL_profile;
+this->m_names[2176] = "glCompressedTexImage1DARB";
+this->m_orig_glCompressedTexImage1DARB = this->m_ptr_glCompressedTexImage1DARB;
+if(this->m_ptr_glCompressedTexImage1DARB)this->m_ptr_glCompressedTexImage1DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC)&ProfilingTableDecorator::m_glCompressedTexImage1DARB_profile;
+this->m_names[2177] = "glBindSamplers";
+this->m_orig_glBindSamplers = this->m_ptr_glBindSamplers;
+if(this->m_ptr_glBindSamplers)this->m_ptr_glBindSamplers = (FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC)&ProfilingTableDecorator::m_glBindSamplers_profile;
+this->m_names[2178] = "glGetProgramEnvParameterIivNV";
+this->m_orig_glGetProgramEnvParameterIivNV = this->m_ptr_glGetProgramEnvParameterIivNV;
+if(this->m_ptr_glGetProgramEnvParameterIivNV)this->m_ptr_glGetProgramEnvParameterIivNV = (FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC)&ProfilingTableDecorator::m_glGetProgramEnvParameterIivNV_profile;
+this->m_names[2179] = "glGetQueryObjectui64v";
+this->m_orig_glGetQueryObjectui64v = this->m_ptr_glGetQueryObjectui64v;
+if(this->m_ptr_glGetQueryObjectui64v)this->m_ptr_glGetQueryObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC)&ProfilingTableDecorator::m_glGetQueryObjectui64v_profile;
+this->m_names[2180] = "glVertexAttribL4ui64vNV";
+this->m_orig_glVertexAttribL4ui64vNV = this->m_ptr_glVertexAttribL4ui64vNV;
+if(this->m_ptr_glVertexAttribL4ui64vNV)this->m_ptr_glVertexAttribL4ui64vNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC)&ProfilingTableDecorator::m_glVertexAttribL4ui64vNV_profile;
+this->m_names[2181] = "glGetVideoivNV";
+this->m_orig_glGetVideoivNV = this->m_ptr_glGetVideoivNV;
+if(this->m_ptr_glGetVideoivNV)this->m_ptr_glGetVideoivNV = (FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC)&ProfilingTableDecorator::m_glGetVideoivNV_profile;
+this->m_names[2182] = "glGetTextureImage";
+this->m_orig_glGetTextureImage = this->m_ptr_glGetTextureImage;
+if(this->m_ptr_glGetTextureImage)this->m_ptr_glGetTextureImage = (FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC)&ProfilingTableDecorator::m_glGetTextureImage_profile;
+this->m_names[2183] = "glProgramUniform1fv";
+this->m_orig_glProgramUniform1fv = this->m_ptr_glProgramUniform1fv;
+if(this->m_ptr_glProgramUniform1fv)this->m_ptr_glProgramUniform1fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC)&ProfilingTableDecorator::m_glProgramUniform1fv_profile;
+this->m_names[2184] = "glUniformMatrix4fv";
+this->m_orig_glUniformMatrix4fv = this->m_ptr_glUniformMatrix4fv;
+if(this->m_ptr_glUniformMatrix4fv)this->m_ptr_glUniformMatrix4fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4fv_profile;
+this->m_names[2185] = "glColorMask";
+this->m_orig_glColorMask = this->m_ptr_glColorMask;
+if(this->m_ptr_glColorMask)this->m_ptr_glColorMask = (FunctionTable::MEMBERPFNGLCOLORMASKPROC)&ProfilingTableDecorator::m_glColorMask_profile;
+this->m_names[2186] = "glBeginFragmentShaderATI";
+this->m_orig_glBeginFragmentShaderATI = this->m_ptr_glBeginFragmentShaderATI;
+if(this->m_ptr_glBeginFragmentShaderATI)this->m_ptr_glBeginFragmentShaderATI = (FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glBeginFragmentShaderATI_profile;
+this->m_names[2187] = "glMultiDrawArraysEXT";
+this->m_orig_glMultiDrawArraysEXT = this->m_ptr_glMultiDrawArraysEXT;
+if(this->m_ptr_glMultiDrawArraysEXT)this->m_ptr_glMultiDrawArraysEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC)&ProfilingTableDecorator::m_glMultiDrawArraysEXT_profile;
+this->m_names[2188] = "glGenNamesAMD";
+this->m_orig_glGenNamesAMD = this->m_ptr_glGenNamesAMD;
+if(this->m_ptr_glGenNamesAMD)this->m_ptr_glGenNamesAMD = (FunctionTable::MEMBERPFNGLGENNAMESAMDPROC)&ProfilingTableDecorator::m_glGenNamesAMD_profile;
+this->m_names[2189] = "glPathParameteriNV";
+this->m_orig_glPathParameteriNV = this->m_ptr_glPathParameteriNV;
+if(this->m_ptr_glPathParameteriNV)this->m_ptr_glPathParameteriNV = (FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC)&ProfilingTableDecorator::m_glPathParameteriNV_profile;
+this->m_names[2190] = "glCreateCommandListsNV";
+this->m_orig_glCreateCommandListsNV = this->m_ptr_glCreateCommandListsNV;
+if(this->m_ptr_glCreateCommandListsNV)this->m_ptr_glCreateCommandListsNV = (FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC)&ProfilingTableDecorator::m_glCreateCommandListsNV_profile;
+this->m_names[2191] = "glDeleteProgramPipelines";
+this->m_orig_glDeleteProgramPipelines = this->m_ptr_glDeleteProgramPipelines;
+if(this->m_ptr_glDeleteProgramPipelines)this->m_ptr_glDeleteProgramPipelines = (FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glDeleteProgramPipelines_profile;
+this->m_names[2192] = "glCopyColorSubTableEXT";
+this->m_orig_glCopyColorSubTableEXT = this->m_ptr_glCopyColorSubTableEXT;
+if(this->m_ptr_glCopyColorSubTableEXT)this->m_ptr_glCopyColorSubTableEXT = (FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC)&ProfilingTableDecorator::m_glCopyColorSubTableEXT_profile;
+this->m_names[2193] = "glVariantsvEXT";
+this->m_orig_glVariantsvEXT = this->m_ptr_glVariantsvEXT;
+if(this->m_ptr_glVariantsvEXT)this->m_ptr_glVariantsvEXT = (FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC)&ProfilingTableDecorator::m_glVariantsvEXT_profile;
+this->m_names[2194] = "glGenProgramPipelines";
+this->m_orig_glGenProgramPipelines = this->m_ptr_glGenProgramPipelines;
+if(this->m_ptr_glGenProgramPipelines)this->m_ptr_glGenProgramPipelines = (FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glGenProgramPipelines_profile;
+this->m_names[2195] = "glVertexArrayEdgeFlagOffsetEXT";
+this->m_orig_glVertexArrayEdgeFlagOffsetEXT = this->m_ptr_glVertexArrayEdgeFlagOffsetEXT;
+if(this->m_ptr_glVertexArrayEdgeFlagOffsetEXT)this->m_ptr_glVertexArrayEdgeFlagOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArrayEdgeFlagOffsetEXT_profile;
+this->m_names[2196] = "glWindowPos2s";
+this->m_orig_glWindowPos2s = this->m_ptr_glWindowPos2s;
+if(this->m_ptr_glWindowPos2s)this->m_ptr_glWindowPos2s = (FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC)&ProfilingTableDecorator::m_glWindowPos2s_profile;
+this->m_names[2197] = "glSecondaryColor3iEXT";
+this->m_orig_glSecondaryColor3iEXT = this->m_ptr_glSecondaryColor3iEXT;
+if(this->m_ptr_glSecondaryColor3iEXT)this->m_ptr_glSecondaryColor3iEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3iEXT_profile;
+this->m_names[2198] = "glWindowPos2i";
+this->m_orig_glWindowPos2i = this->m_ptr_glWindowPos2i;
+if(this->m_ptr_glWindowPos2i)this->m_ptr_glWindowPos2i = (FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC)&ProfilingTableDecorator::m_glWindowPos2i_profile;
+this->m_names[2199] = "glWindowPos2f";
+this->m_orig_glWindowPos2f = this->m_ptr_glWindowPos2f;
+if(this->m_ptr_glWindowPos2f)this->m_ptr_glWindowPos2f = (FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC)&ProfilingTableDecorator::m_glWindowPos2f_profile;
+this->m_names[2200] = "glWindowPos2d";
+this->m_orig_glWindowPos2d = this->m_ptr_glWindowPos2d;
+if(this->m_ptr_glWindowPos2d)this->m_ptr_glWindowPos2d = (FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC)&ProfilingTableDecorator::m_glWindowPos2d_profile;
+this->m_names[2201] = "glUniform4uivEXT";
+this->m_orig_glUniform4uivEXT = this->m_ptr_glUniform4uivEXT;
+if(this->m_ptr_glUniform4uivEXT)this->m_ptr_glUniform4uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC)&ProfilingTableDecorator::m_glUniform4uivEXT_profile;
+this->m_names[2202] = "glOrthoxOES";
+this->m_orig_glOrthoxOES = this->m_ptr_glOrthoxOES;
+if(this->m_ptr_glOrthoxOES)this->m_ptr_glOrthoxOES = (FunctionTable::MEMBERPFNGLORTHOXOESPROC)&ProfilingTableDecorator::m_glOrthoxOES_profile;
+this->m_names[2203] = "glUniformSubroutinesuiv";
+this->m_orig_glUniformSubroutinesuiv = this->m_ptr_glUniformSubroutinesuiv;
+if(this->m_ptr_glUniformSubroutinesuiv)this->m_ptr_glUniformSubroutinesuiv = (FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC)&ProfilingTableDecorator::m_glUniformSubroutinesuiv_profile;
+this->m_names[2204] = "glRectdv";
+this->m_orig_glRectdv = this->m_ptr_glRectdv;
+if(this->m_ptr_glRectdv)this->m_ptr_glRectdv = (FunctionTable::MEMBERPFNGLRECTDVPROC)&ProfilingTableDecorator::m_glRectdv_profile;
+this->m_names[2205] = "glProgramUniform1i64vNV";
+this->m_orig_glProgramUniform1i64vNV = this->m_ptr_glProgramUniform1i64vNV;
+if(this->m_ptr_glProgramUniform1i64vNV)this->m_ptr_glProgramUniform1i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform1i64vNV_profile;
+this->m_names[2206] = "glVertexAttribI4uiEXT";
+this->m_orig_glVertexAttribI4uiEXT = this->m_ptr_glVertexAttribI4uiEXT;
+if(this->m_ptr_glVertexAttribI4uiEXT)this->m_ptr_glVertexAttribI4uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4uiEXT_profile;
+this->m_names[2207] = "glSecondaryColor3ubEXT";
+this->m_orig_glSecondaryColor3ubEXT = this->m_ptr_glSecondaryColor3ubEXT;
+if(this->m_ptr_glSecondaryColor3ubEXT)this->m_ptr_glSecondaryColor3ubEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3ubEXT_profile;
+this->m_names[2208] = "glCompressedMultiTexSubImage1DEXT";
+this->m_orig_glCompressedMultiTexSubImage1DEXT = this->m_ptr_glCompressedMultiTexSubImage1DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage1DEXT)this->m_ptr_glCompressedMultiTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage1DEXT_profile;
+this->m_names[2209] = "glMultiTexGendEXT";
+this->m_orig_glMultiTexGendEXT = this->m_ptr_glMultiTexGendEXT;
+if(this->m_ptr_glMultiTexGendEXT)this->m_ptr_glMultiTexGendEXT = (FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC)&ProfilingTableDecorator::m_glMultiTexGendEXT_profile;
+this->m_names[2210] = "glColorP3uiv";
+this->m_orig_glColorP3uiv = this->m_ptr_glColorP3uiv;
+if(this->m_ptr_glColorP3uiv)this->m_ptr_glColorP3uiv = (FunctionTable::MEMBERPFNGLCOLORP3UIVPROC)&ProfilingTableDecorator::m_glColorP3uiv_profile;
+this->m_names[2211] = "glFogCoordfv";
+this->m_orig_glFogCoordfv = this->m_ptr_glFogCoordfv;
+if(this->m_ptr_glFogCoordfv)this->m_ptr_glFogCoordfv = (FunctionTable::MEMBERPFNGLFOGCOORDFVPROC)&ProfilingTableDecorator::m_glFogCoordfv_profile;
+this->m_names[2212] = "glCompileShader";
+this->m_orig_glCompileShader = this->m_ptr_glCompileShader;
+if(this->m_ptr_glCompileShader)this->m_ptr_glCompileShader = (FunctionTable::MEMBERPFNGLCOMPILESHADERPROC)&ProfilingTableDecorator::m_glCompileShader_profile;
+this->m_names[2213] = "glTexCoord2hNV";
+this->m_orig_glTexCoord2hNV = this->m_ptr_glTexCoord2hNV;
+if(this->m_ptr_glTexCoord2hNV)this->m_ptr_glTexCoord2hNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC)&ProfilingTableDecorator::m_glTexCoord2hNV_profile;
+this->m_names[2214] = "glUniform1uivEXT";
+this->m_orig_glUniform1uivEXT = this->m_ptr_glUniform1uivEXT;
+if(this->m_ptr_glUniform1uivEXT)this->m_ptr_glUniform1uivEXT = (FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC)&ProfilingTableDecorator::m_glUniform1uivEXT_profile;
+this->m_names[2215] = "glMatrixLoadTransposedEXT";
+this->m_orig_glMatrixLoadTransposedEXT = this->m_ptr_glMatrixLoadTransposedEXT;
+if(this->m_ptr_glMatrixLoadTransposedEXT)this->m_ptr_glMatrixLoadTransposedEXT = (FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC)&ProfilingTableDecorator::m_glMatrixLoadTransposedEXT_profile;
+this->m_names[2216] = "glIndexfv";
+this->m_orig_glIndexfv = this->m_ptr_glIndexfv;
+if(this->m_ptr_glIndexfv)this->m_ptr_glIndexfv = (FunctionTable::MEMBERPFNGLINDEXFVPROC)&ProfilingTableDecorator::m_glIndexfv_profile;
+this->m_names[2217] = "glGetCompressedTextureImage";
+this->m_orig_glGetCompressedTextureImage = this->m_ptr_glGetCompressedTextureImage;
+if(this->m_ptr_glGetCompressedTextureImage)this->m_ptr_glGetCompressedTextureImage = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)&ProfilingTableDecorator::m_glGetCompressedTextureImage_profile;
+this->m_names[2218] = "glGetUniformuivEXT";
+this->m_orig_glGetUniformuivEXT = this->m_ptr_glGetUniformuivEXT;
+if(this->m_ptr_glGetUniformuivEXT)this->m_ptr_glGetUniformuivEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC)&ProfilingTableDecorator::m_glGetUniformuivEXT_profile;
+this->m_names[2219] = "glGetnPixelMapfvARB";
+this->m_orig_glGetnPixelMapfvARB = this->m_ptr_glGetnPixelMapfvARB;
+if(this->m_ptr_glGetnPixelMapfvARB)this->m_ptr_glGetnPixelMapfvARB = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC)&ProfilingTableDecorator::m_glGetnPixelMapfvARB_profile;
+this->m_names[2220] = "glFramebufferTextureEXT";
+this->m_orig_glFramebufferTextureEXT = this->m_ptr_glFramebufferTextureEXT;
+if(this->m_ptr_glFramebufferTextureEXT)this->m_ptr_glFramebufferTextureEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC)&ProfilingTableDecorator::m_glFramebufferTextureEXT_profile;
+this->m_names[2221] = "glMultiDrawElementsIndirectCount";
+this->m_orig_glMultiDrawElementsIndirectCount = this->m_ptr_glMultiDrawElementsIndirectCount;
+if(this->m_ptr_glMultiDrawElementsIndirectCount)this->m_ptr_glMultiDrawElementsIndirectCount = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectCount_profile;
+this->m_names[2222] = "glVertexAttribIPointer";
+this->m_orig_glVertexAttribIPointer = this->m_ptr_glVertexAttribIPointer;
+if(this->m_ptr_glVertexAttribIPointer)this->m_ptr_glVertexAttribIPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribIPointer_profile;
+this->m_names[2223] = "glMultiTexCoordP3ui";
+this->m_orig_glMultiTexCoordP3ui = this->m_ptr_glMultiTexCoordP3ui;
+if(this->m_ptr_glMultiTexCoordP3ui)this->m_ptr_glMultiTexCoordP3ui = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC)&ProfilingTableDecorator::m_glMultiTexCoordP3ui_profile;
+this->m_names[2224] = "glEvaluateDepthValuesARB";
+this->m_orig_glEvaluateDepthValuesARB = this->m_ptr_glEvaluateDepthValuesARB;
+if(this->m_ptr_glEvaluateDepthValuesARB)this->m_ptr_glEvaluateDepthValuesARB = (FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC)&ProfilingTableDecorator::m_glEvaluateDepthValuesARB_profile;
+this->m_names[2225] = "glGetNamedBufferParameteriv";
+this->m_orig_glGetNamedBufferParameteriv = this->m_ptr_glGetNamedBufferParameteriv;
+if(this->m_ptr_glGetNamedBufferParameteriv)this->m_ptr_glGetNamedBufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameteriv_profile;
+this->m_names[2226] = "glGetNamedProgramLocalParameterfvEXT";
+this->m_orig_glGetNamedProgramLocalParameterfvEXT = this->m_ptr_glGetNamedProgramLocalParameterfvEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterfvEXT)this->m_ptr_glGetNamedProgramLocalParameterfvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterfvEXT_profile;
+this->m_names[2227] = "glColor4fNormal3fVertex3fvSUN";
+this->m_orig_glColor4fNormal3fVertex3fvSUN = this->m_ptr_glColor4fNormal3fVertex3fvSUN;
+if(this->m_ptr_glColor4fNormal3fVertex3fvSUN)this->m_ptr_glColor4fNormal3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor4fNormal3fVertex3fvSUN_profile;
+this->m_names[2228] = "glSeparableFilter2DEXT";
+this->m_orig_glSeparableFilter2DEXT = this->m_ptr_glSeparableFilter2DEXT;
+if(this->m_ptr_glSeparableFilter2DEXT)this->m_ptr_glSeparableFilter2DEXT = (FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC)&ProfilingTableDecorator::m_glSeparableFilter2DEXT_profile;
+this->m_names[2229] = "glTexParameterxOES";
+this->m_orig_glTexParameterxOES = this->m_ptr_glTexParameterxOES;
+if(this->m_ptr_glTexParameterxOES)this->m_ptr_glTexParameterxOES = (FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC)&ProfilingTableDecorator::m_glTexParameterxOES_profile;
+this->m_names[2230] = "glClearAccumxOES";
+this->m_orig_glClearAccumxOES = this->m_ptr_glClearAccumxOES;
+if(this->m_ptr_glClearAccumxOES)this->m_ptr_glClearAccumxOES = (FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC)&ProfilingTableDecorator::m_glClearAccumxOES_profile;
+this->m_names[2231] = "glInvalidateFramebuffer";
+this->m_orig_glInvalidateFramebuffer = this->m_ptr_glInvalidateFramebuffer;
+if(this->m_ptr_glInvalidateFramebuffer)this->m_ptr_glInvalidateFramebuffer = (FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC)&ProfilingTableDecorator::m_glInvalidateFramebuffer_profile;
+this->m_names[2232] = "glWeightubvARB";
+this->m_orig_glWeightubvARB = this->m_ptr_glWeightubvARB;
+if(this->m_ptr_glWeightubvARB)this->m_ptr_glWeightubvARB = (FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC)&ProfilingTableDecorator::m_glWeightubvARB_profile;
+this->m_names[2233] = "glVertexAttrib1d";
+this->m_orig_glVertexAttrib1d = this->m_ptr_glVertexAttrib1d;
+if(this->m_ptr_glVertexAttrib1d)this->m_ptr_glVertexAttrib1d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC)&ProfilingTableDecorator::m_glVertexAttrib1d_profile;
+this->m_names[2234] = "glVertexAttrib1f";
+this->m_orig_glVertexAttrib1f = this->m_ptr_glVertexAttrib1f;
+if(this->m_ptr_glVertexAttrib1f)this->m_ptr_glVertexAttrib1f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC)&ProfilingTableDecorator::m_glVertexAttrib1f_profile;
+this->m_names[2235] = "glVertex4fv";
+this->m_orig_glVertex4fv = this->m_ptr_glVertex4fv;
+if(this->m_ptr_glVertex4fv)this->m_ptr_glVertex4fv = (FunctionTable::MEMBERPFNGLVERTEX4FVPROC)&ProfilingTableDecorator::m_glVertex4fv_profile;
+this->m_names[2236] = "glClearNamedFramebufferfi";
+this->m_orig_glClearNamedFramebufferfi = this->m_ptr_glClearNamedFramebufferfi;
+if(this->m_ptr_glClearNamedFramebufferfi)this->m_ptr_glClearNamedFramebufferfi = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferfi_profile;
+this->m_names[2237] = "glGetQueryBufferObjectuiv";
+this->m_orig_glGetQueryBufferObjectuiv = this->m_ptr_glGetQueryBufferObjectuiv;
+if(this->m_ptr_glGetQueryBufferObjectuiv)this->m_ptr_glGetQueryBufferObjectuiv = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectuiv_profile;
+this->m_names[2238] = "glClearNamedFramebufferfv";
+this->m_orig_glClearNamedFramebufferfv = this->m_ptr_glClearNamedFramebufferfv;
+if(this->m_ptr_glClearNamedFramebufferfv)this->m_ptr_glClearNamedFramebufferfv = (FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC)&ProfilingTableDecorator::m_glClearNamedFramebufferfv_profile;
+this->m_names[2239] = "glEndVertexShaderEXT";
+this->m_orig_glEndVertexShaderEXT = this->m_ptr_glEndVertexShaderEXT;
+if(this->m_ptr_glEndVertexShaderEXT)this->m_ptr_glEndVertexShaderEXT = (FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC)&ProfilingTableDecorator::m_glEndVertexShaderEXT_profile;
+this->m_names[2240] = "glVertexAttrib1s";
+this->m_orig_glVertexAttrib1s = this->m_ptr_glVertexAttrib1s;
+if(this->m_ptr_glVertexAttrib1s)this->m_ptr_glVertexAttrib1s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC)&ProfilingTableDecorator::m_glVertexAttrib1s_profile;
+this->m_names[2241] = "glMultiTexCoord4dvARB";
+this->m_orig_glMultiTexCoord4dvARB = this->m_ptr_glMultiTexCoord4dvARB;
+if(this->m_ptr_glMultiTexCoord4dvARB)this->m_ptr_glMultiTexCoord4dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dvARB_profile;
+this->m_names[2242] = "glMultiTexCoord1sv";
+this->m_orig_glMultiTexCoord1sv = this->m_ptr_glMultiTexCoord1sv;
+if(this->m_ptr_glMultiTexCoord1sv)this->m_ptr_glMultiTexCoord1sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord1sv_profile;
+this->m_names[2243] = "glUniform1ui64vNV";
+this->m_orig_glUniform1ui64vNV = this->m_ptr_glUniform1ui64vNV;
+if(this->m_ptr_glUniform1ui64vNV)this->m_ptr_glUniform1ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC)&ProfilingTableDecorator::m_glUniform1ui64vNV_profile;
+this->m_names[2244] = "glGetClipPlanefOES";
+this->m_orig_glGetClipPlanefOES = this->m_ptr_glGetClipPlanefOES;
+if(this->m_ptr_glGetClipPlanefOES)this->m_ptr_glGetClipPlanefOES = (FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC)&ProfilingTableDecorator::m_glGetClipPlanefOES_profile;
+this->m_names[2245] = "glRasterPos2s";
+this->m_orig_glRasterPos2s = this->m_ptr_glRasterPos2s;
+if(this->m_ptr_glRasterPos2s)this->m_ptr_glRasterPos2s = (FunctionTable::MEMBERPFNGLRASTERPOS2SPROC)&ProfilingTableDecorator::m_glRasterPos2s_profile;
+this->m_names[2246] = "glWeightivARB";
+this->m_orig_glWeightivARB = this->m_ptr_glWeightivARB;
+if(this->m_ptr_glWeightivARB)this->m_ptr_glWeightivARB = (FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC)&ProfilingTableDecorator::m_glWeightivARB_profile;
+this->m_names[2247] = "glMultiTexCoord4hvNV";
+this->m_orig_glMultiTexCoord4hvNV = this->m_ptr_glMultiTexCoord4hvNV;
+if(this->m_ptr_glMultiTexCoord4hvNV)this->m_ptr_glMultiTexCoord4hvNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4hvNV_profile;
+this->m_names[2248] = "glNormal3hNV";
+this->m_orig_glNormal3hNV = this->m_ptr_glNormal3hNV;
+if(this->m_ptr_glNormal3hNV)this->m_ptr_glNormal3hNV = (FunctionTable::MEMBERPFNGLNORMAL3HNVPROC)&ProfilingTableDecorator::m_glNormal3hNV_profile;
+this->m_names[2249] = "glGetSeparableFilter";
+this->m_orig_glGetSeparableFilter = this->m_ptr_glGetSeparableFilter;
+if(this->m_ptr_glGetSeparableFilter)this->m_ptr_glGetSeparableFilter = (FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC)&ProfilingTableDecorator::m_glGetSeparableFilter_profile;
+this->m_names[2250] = "glGetPathTexGenivNV";
+this->m_orig_glGetPathTexGenivNV = this->m_ptr_glGetPathTexGenivNV;
+if(this->m_ptr_glGetPathTexGenivNV)this->m_ptr_glGetPathTexGenivNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC)&ProfilingTableDecorator::m_glGetPathTexGenivNV_profile;
+this->m_names[2251] = "glColor4bv";
+this->m_orig_glColor4bv = this->m_ptr_glColor4bv;
+if(this->m_ptr_glColor4bv)this->m_ptr_glColor4bv = (FunctionTable::MEMBERPFNGLCOLOR4BVPROC)&ProfilingTableDecorator::m_glColor4bv_profile;
+this->m_names[2252] = "glRasterPos2f";
+this->m_orig_glRasterPos2f = this->m_ptr_glRasterPos2f;
+if(this->m_ptr_glRasterPos2f)this->m_ptr_glRasterPos2f = (FunctionTable::MEMBERPFNGLRASTERPOS2FPROC)&ProfilingTableDecorator::m_glRasterPos2f_profile;
+this->m_names[2253] = "glNamedBufferPageCommitmentARB";
+this->m_orig_glNamedBufferPageCommitmentARB = this->m_ptr_glNamedBufferPageCommitmentARB;
+if(this->m_ptr_glNamedBufferPageCommitmentARB)this->m_ptr_glNamedBufferPageCommitmentARB = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC)&ProfilingTableDecorator::m_glNamedBufferPageCommitmentARB_profile;
+this->m_names[2254] = "glLoadIdentity";
+this->m_orig_glLoadIdentity = this->m_ptr_glLoadIdentity;
+if(this->m_ptr_glLoadIdentity)this->m_ptr_glLoadIdentity = (FunctionTable::MEMBERPFNGLLOADIDENTITYPROC)&ProfilingTableDecorator::m_glLoadIdentity_profile;
+this->m_names[2255] = "glRasterPos2i";
+this->m_orig_glRasterPos2i = this->m_ptr_glRasterPos2i;
+if(this->m_ptr_glRasterPos2i)this->m_ptr_glRasterPos2i = (FunctionTable::MEMBERPFNGLRASTERPOS2IPROC)&ProfilingTableDecorator::m_glRasterPos2i_profile;
+this->m_names[2256] = "glRasterPos4iv";
+this->m_orig_glRasterPos4iv = this->m_ptr_glRasterPos4iv;
+if(this->m_ptr_glRasterPos4iv)this->m_ptr_glRasterPos4iv = (FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC)&ProfilingTableDecorator::m_glRasterPos4iv_profile;
+this->m_names[2257] = "glMultiTexCoord2fvARB";
+this->m_orig_glMultiTexCoord2fvARB = this->m_ptr_glMultiTexCoord2fvARB;
+if(this->m_ptr_glMultiTexCoord2fvARB)this->m_ptr_glMultiTexCoord2fvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fvARB_profile;
+this->m_names[2258] = "glUniformMatrix4x3fv";
+this->m_orig_glUniformMatrix4x3fv = this->m_ptr_glUniformMatrix4x3fv;
+if(this->m_ptr_glUniformMatrix4x3fv)this->m_ptr_glUniformMatrix4x3fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x3fv_profile;
+this->m_names[2259] = "glClearBufferfv";
+this->m_orig_glClearBufferfv = this->m_ptr_glClearBufferfv;
+if(this->m_ptr_glClearBufferfv)this->m_ptr_glClearBufferfv = (FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC)&ProfilingTableDecorator::m_glClearBufferfv_profile;
+this->m_names[2260] = "glMultiTexCoord4hNV";
+this->m_orig_glMultiTexCoord4hNV = this->m_ptr_glMultiTexCoord4hNV;
+if(this->m_ptr_glMultiTexCoord4hNV)this->m_ptr_glMultiTexCoord4hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4hNV_profile;
+this->m_names[2261] = "glTextureBarrier";
+this->m_orig_glTextureBarrier = this->m_ptr_glTextureBarrier;
+if(this->m_ptr_glTextureBarrier)this->m_ptr_glTextureBarrier = (FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC)&ProfilingTableDecorator::m_glTextureBarrier_profile;
+this->m_names[2262] = "glReplacementCodeuivSUN";
+this->m_orig_glReplacementCodeuivSUN = this->m_ptr_glReplacementCodeuivSUN;
+if(this->m_ptr_glReplacementCodeuivSUN)this->m_ptr_glReplacementCodeuivSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuivSUN_profile;
+this->m_names[2263] = "glDeleteAsyncMarkersSGIX";
+this->m_orig_glDeleteAsyncMarkersSGIX = this->m_ptr_glDeleteAsyncMarkersSGIX;
+if(this->m_ptr_glDeleteAsyncMarkersSGIX)this->m_ptr_glDeleteAsyncMarkersSGIX = (FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC)&ProfilingTableDecorator::m_glDeleteAsyncMarkersSGIX_profile;
+this->m_names[2264] = "glTexCoord2bvOES";
+this->m_orig_glTexCoord2bvOES = this->m_ptr_glTexCoord2bvOES;
+if(this->m_ptr_glTexCoord2bvOES)this->m_ptr_glTexCoord2bvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC)&ProfilingTableDecorator::m_glTexCoord2bvOES_profile;
+this->m_names[2265] = "glEvalCoord2xOES";
+this->m_orig_glEvalCoord2xOES = this->m_ptr_glEvalCoord2xOES;
+if(this->m_ptr_glEvalCoord2xOES)this->m_ptr_glEvalCoord2xOES = (FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC)&ProfilingTableDecorator::m_glEvalCoord2xOES_profile;
+this->m_names[2266] = "glGetSharpenTexFuncSGIS";
+this->m_orig_glGetSharpenTexFuncSGIS = this->m_ptr_glGetSharpenTexFuncSGIS;
+if(this->m_ptr_glGetSharpenTexFuncSGIS)this->m_ptr_glGetSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glGetSharpenTexFuncSGIS_profile;
+this->m_names[2267] = "glProgramUniformHandleui64vNV";
+this->m_orig_glProgramUniformHandleui64vNV = this->m_ptr_glProgramUniformHandleui64vNV;
+if(this->m_ptr_glProgramUniformHandleui64vNV)this->m_ptr_glProgramUniformHandleui64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)&ProfilingTableDecorator::m_glProgramUniformHandleui64vNV_profile;
+this->m_names[2268] = "glIglooInterfaceSGIX";
+this->m_orig_glIglooInterfaceSGIX = this->m_ptr_glIglooInterfaceSGIX;
+if(this->m_ptr_glIglooInterfaceSGIX)this->m_ptr_glIglooInterfaceSGIX = (FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC)&ProfilingTableDecorator::m_glIglooInterfaceSGIX_profile;
+this->m_names[2269] = "glWindowPos2dvARB";
+this->m_orig_glWindowPos2dvARB = this->m_ptr_glWindowPos2dvARB;
+if(this->m_ptr_glWindowPos2dvARB)this->m_ptr_glWindowPos2dvARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC)&ProfilingTableDecorator::m_glWindowPos2dvARB_profile;
+this->m_names[2270] = "glClearBufferfi";
+this->m_orig_glClearBufferfi = this->m_ptr_glClearBufferfi;
+if(this->m_ptr_glClearBufferfi)this->m_ptr_glClearBufferfi = (FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC)&ProfilingTableDecorator::m_glClearBufferfi_profile;
+this->m_names[2271] = "glDrawArraysIndirect";
+this->m_orig_glDrawArraysIndirect = this->m_ptr_glDrawArraysIndirect;
+if(this->m_ptr_glDrawArraysIndirect)this->m_ptr_glDrawArraysIndirect = (FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC)&ProfilingTableDecorator::m_glDrawArraysIndirect_profile;
+this->m_names[2272] = "glGenVertexArrays";
+this->m_orig_glGenVertexArrays = this->m_ptr_glGenVertexArrays;
+if(this->m_ptr_glGenVertexArrays)this->m_ptr_glGenVertexArrays = (FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC)&ProfilingTableDecorator::m_glGenVertexArrays_profile;
+this->m_names[2273] = "glGetTransformFeedbacki64_v";
+this->m_orig_glGetTransformFeedbacki64_v = this->m_ptr_glGetTransformFeedbacki64_v;
+if(this->m_ptr_glGetTransformFeedbacki64_v)this->m_ptr_glGetTransformFeedbacki64_v = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC)&ProfilingTableDecorator::m_glGetTransformFeedbacki64_v_profile;
+this->m_names[2274] = "glEnableVertexArrayAttrib";
+this->m_orig_glEnableVertexArrayAttrib = this->m_ptr_glEnableVertexArrayAttrib;
+if(this->m_ptr_glEnableVertexArrayAttrib)this->m_ptr_glEnableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC)&ProfilingTableDecorator::m_glEnableVertexArrayAttrib_profile;
+this->m_names[2275] = "glProgramUniformMatrix3x2dv";
+this->m_orig_glProgramUniformMatrix3x2dv = this->m_ptr_glProgramUniformMatrix3x2dv;
+if(this->m_ptr_glProgramUniformMatrix3x2dv)this->m_ptr_glProgramUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2dv_profile;
+this->m_names[2276] = "glVertexStream4fATI";
+this->m_orig_glVertexStream4fATI = this->m_ptr_glVertexStream4fATI;
+if(this->m_ptr_glVertexStream4fATI)this->m_ptr_glVertexStream4fATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC)&ProfilingTableDecorator::m_glVertexStream4fATI_profile;
+this->m_names[2277] = "glVertexBindingDivisor";
+this->m_orig_glVertexBindingDivisor = this->m_ptr_glVertexBindingDivisor;
+if(this->m_ptr_glVertexBindingDivisor)this->m_ptr_glVertexBindingDivisor = (FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC)&ProfilingTableDecorator::m_glVertexBindingDivisor_profile;
+this->m_names[2278] = "glGetSamplerParameterIiv";
+this->m_orig_glGetSamplerParameterIiv = this->m_ptr_glGetSamplerParameterIiv;
+if(this->m_ptr_glGetSamplerParameterIiv)this->m_ptr_glGetSamplerParameterIiv = (FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetSamplerParameterIiv_profile;
+this->m_names[2279] = "glGetCoverageModulationTableNV";
+this->m_orig_glGetCoverageModulationTableNV = this->m_ptr_glGetCoverageModulationTableNV;
+if(this->m_ptr_glGetCoverageModulationTableNV)this->m_ptr_glGetCoverageModulationTableNV = (FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC)&ProfilingTableDecorator::m_glGetCoverageModulationTableNV_profile;
+this->m_names[2280] = "glDepthRangedNV";
+this->m_orig_glDepthRangedNV = this->m_ptr_glDepthRangedNV;
+if(this->m_ptr_glDepthRangedNV)this->m_ptr_glDepthRangedNV = (FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC)&ProfilingTableDecorator::m_glDepthRangedNV_profile;
+this->m_names[2281] = "glVertexAttrib3f";
+this->m_orig_glVertexAttrib3f = this->m_ptr_glVertexAttrib3f;
+if(this->m_ptr_glVertexAttrib3f)this->m_ptr_glVertexAttrib3f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC)&ProfilingTableDecorator::m_glVertexAttrib3f_profile;
+this->m_names[2282] = "glMultiDrawRangeElementArrayAPPLE";
+this->m_orig_glMultiDrawRangeElementArrayAPPLE = this->m_ptr_glMultiDrawRangeElementArrayAPPLE;
+if(this->m_ptr_glMultiDrawRangeElementArrayAPPLE)this->m_ptr_glMultiDrawRangeElementArrayAPPLE = (FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)&ProfilingTableDecorator::m_glMultiDrawRangeElementArrayAPPLE_profile;
+this->m_names[2283] = "glVertexAttribFormatNV";
+this->m_orig_glVertexAttribFormatNV = this->m_ptr_glVertexAttribFormatNV;
+if(this->m_ptr_glVertexAttribFormatNV)this->m_ptr_glVertexAttribFormatNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC)&ProfilingTableDecorator::m_glVertexAttribFormatNV_profile;
+this->m_names[2284] = "glGetQueryBufferObjecti64v";
+this->m_orig_glGetQueryBufferObjecti64v = this->m_ptr_glGetQueryBufferObjecti64v;
+if(this->m_ptr_glGetQueryBufferObjecti64v)this->m_ptr_glGetQueryBufferObjecti64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjecti64v_profile;
+this->m_names[2285] = "glGetVertexAttribdv";
+this->m_orig_glGetVertexAttribdv = this->m_ptr_glGetVertexAttribdv;
+if(this->m_ptr_glGetVertexAttribdv)this->m_ptr_glGetVertexAttribdv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC)&ProfilingTableDecorator::m_glGetVertexAttribdv_profile;
+this->m_names[2286] = "glGetUniformi64vARB";
+this->m_orig_glGetUniformi64vARB = this->m_ptr_glGetUniformi64vARB;
+if(this->m_ptr_glGetUniformi64vARB)this->m_ptr_glGetUniformi64vARB = (FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC)&ProfilingTableDecorator::m_glGetUniformi64vARB_profile;
+this->m_names[2287] = "glAreTexturesResidentEXT";
+this->m_orig_glAreTexturesResidentEXT = this->m_ptr_glAreTexturesResidentEXT;
+if(this->m_ptr_glAreTexturesResidentEXT)this->m_ptr_glAreTexturesResidentEXT = (FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC)&ProfilingTableDecorator::m_glAreTexturesResidentEXT_profile;
+this->m_names[2288] = "glGetHandleARB";
+this->m_orig_glGetHandleARB = this->m_ptr_glGetHandleARB;
+if(this->m_ptr_glGetHandleARB)this->m_ptr_glGetHandleARB = (FunctionTable::MEMBERPFNGLGETHANDLEARBPROC)&ProfilingTableDecorator::m_glGetHandleARB_profile;
+this->m_names[2289] = "glVideoCaptureStreamParameterdvNV";
+this->m_orig_glVideoCaptureStreamParameterdvNV = this->m_ptr_glVideoCaptureStreamParameterdvNV;
+if(this->m_ptr_glVideoCaptureStreamParameterdvNV)this->m_ptr_glVideoCaptureStreamParameterdvNV = (FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glVideoCaptureStreamParameterdvNV_profile;
+this->m_names[2290] = "glMapParameterivNV";
+this->m_orig_glMapParameterivNV = this->m_ptr_glMapParameterivNV;
+if(this->m_ptr_glMapParameterivNV)this->m_ptr_glMapParameterivNV = (FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glMapParameterivNV_profile;
+this->m_names[2291] = "glIsVertexArray";
+this->m_orig_glIsVertexArray = this->m_ptr_glIsVertexArray;
+if(this->m_ptr_glIsVertexArray)this->m_ptr_glIsVertexArray = (FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC)&ProfilingTableDecorator::m_glIsVertexArray_profile;
+this->m_names[2292] = "glSecondaryColor3sEXT";
+this->m_orig_glSecondaryColor3sEXT = this->m_ptr_glSecondaryColor3sEXT;
+if(this->m_ptr_glSecondaryColor3sEXT)this->m_ptr_glSecondaryColor3sEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3sEXT_profile;
+this->m_names[2293] = "glGetTexParameterIivEXT";
+this->m_orig_glGetTexParameterIivEXT = this->m_ptr_glGetTexParameterIivEXT;
+if(this->m_ptr_glGetTexParameterIivEXT)this->m_ptr_glGetTexParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetTexParameterIivEXT_profile;
+this->m_names[2294] = "glFrameTerminatorGREMEDY";
+this->m_orig_glFrameTerminatorGREMEDY = this->m_ptr_glFrameTerminatorGREMEDY;
+if(this->m_ptr_glFrameTerminatorGREMEDY)this->m_ptr_glFrameTerminatorGREMEDY = (FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC)&ProfilingTableDecorator::m_glFrameTerminatorGREMEDY_profile;
+this->m_names[2295] = "glBlendBarrierKHR";
+this->m_orig_glBlendBarrierKHR = this->m_ptr_glBlendBarrierKHR;
+if(this->m_ptr_glBlendBarrierKHR)this->m_ptr_glBlendBarrierKHR = (FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC)&ProfilingTableDecorator::m_glBlendBarrierKHR_profile;
+this->m_names[2296] = "glVertexAttrib4NubARB";
+this->m_orig_glVertexAttrib4NubARB = this->m_ptr_glVertexAttrib4NubARB;
+if(this->m_ptr_glVertexAttrib4NubARB)this->m_ptr_glVertexAttrib4NubARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NubARB_profile;
+this->m_names[2297] = "glPrimitiveRestartNV";
+this->m_orig_glPrimitiveRestartNV = this->m_ptr_glPrimitiveRestartNV;
+if(this->m_ptr_glPrimitiveRestartNV)this->m_ptr_glPrimitiveRestartNV = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC)&ProfilingTableDecorator::m_glPrimitiveRestartNV_profile;
+this->m_names[2298] = "glVertexAttribL1ui64vARB";
+this->m_orig_glVertexAttribL1ui64vARB = this->m_ptr_glVertexAttribL1ui64vARB;
+if(this->m_ptr_glVertexAttribL1ui64vARB)this->m_ptr_glVertexAttribL1ui64vARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC)&ProfilingTableDecorator::m_glVertexAttribL1ui64vARB_profile;
+this->m_names[2299] = "glVertexAttribI4ivEXT";
+this->m_orig_glVertexAttribI4ivEXT = this->m_ptr_glVertexAttribI4ivEXT;
+if(this->m_ptr_glVertexAttribI4ivEXT)this->m_ptr_glVertexAttribI4ivEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4ivEXT_profile;
+this->m_names[2300] = "glVertexAttribs4svNV";
+this->m_orig_glVertexAttribs4svNV = this->m_ptr_glVertexAttribs4svNV;
+if(this->m_ptr_glVertexAttribs4svNV)this->m_ptr_glVertexAttribs4svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs4svNV_profile;
+this->m_names[2301] = "glUniform1ui";
+this->m_orig_glUniform1ui = this->m_ptr_glUniform1ui;
+if(this->m_ptr_glUniform1ui)this->m_ptr_glUniform1ui = (FunctionTable::MEMBERPFNGLUNIFORM1UIPROC)&ProfilingTableDecorator::m_glUniform1ui_profile;
+this->m_names[2302] = "glVertexAttrib2fvARB";
+this->m_orig_glVertexAttrib2fvARB = this->m_ptr_glVertexAttrib2fvARB;
+if(this->m_ptr_glVertexAttrib2fvARB)this->m_ptr_glVertexAttrib2fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2fvARB_profile;
+this->m_names[2303] = "glVertexAttribI4svEXT";
+this->m_orig_glVertexAttribI4svEXT = this->m_ptr_glVertexAttribI4svEXT;
+if(this->m_ptr_glVertexAttribI4svEXT)this->m_ptr_glVertexAttribI4svEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4svEXT_profile;
+this->m_names[2304] = "glTextureImage3DMultisampleCoverageNV";
+this->m_orig_glTextureImage3DMultisampleCoverageNV = this->m_ptr_glTextureImage3DMultisampleCoverageNV;
+if(this->m_ptr_glTextureImage3DMultisampleCoverageNV)this->m_ptr_glTextureImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTextureImage3DMultisampleCoverageNV_profile;
+this->m_names[2305] = "glMemoryBarrier";
+this->m_orig_glMemoryBarrier = this->m_ptr_glMemoryBarrier;
+if(this->m_ptr_glMemoryBarrier)this->m_ptr_glMemoryBarrier = (FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC)&ProfilingTableDecorator::m_glMemoryBarrier_profile;
+this->m_names[2306] = "glGetVariantArrayObjectfvATI";
+this->m_orig_glGetVariantArrayObjectfvATI = this->m_ptr_glGetVariantArrayObjectfvATI;
+if(this->m_ptr_glGetVariantArrayObjectfvATI)this->m_ptr_glGetVariantArrayObjectfvATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC)&ProfilingTableDecorator::m_glGetVariantArrayObjectfvATI_profile;
+this->m_names[2307] = "glTexCoord4fColor4fNormal3fVertex4fvSUN";
+this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN;
+if(this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN)this->m_ptr_glTexCoord4fColor4fNormal3fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profile;
+this->m_names[2308] = "glIsProgramARB";
+this->m_orig_glIsProgramARB = this->m_ptr_glIsProgramARB;
+if(this->m_ptr_glIsProgramARB)this->m_ptr_glIsProgramARB = (FunctionTable::MEMBERPFNGLISPROGRAMARBPROC)&ProfilingTableDecorator::m_glIsProgramARB_profile;
+this->m_names[2309] = "glBindImageTextureEXT";
+this->m_orig_glBindImageTextureEXT = this->m_ptr_glBindImageTextureEXT;
+if(this->m_ptr_glBindImageTextureEXT)this->m_ptr_glBindImageTextureEXT = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindImageTextureEXT_profile;
+this->m_names[2310] = "glGetFragDataLocation";
+this->m_orig_glGetFragDataLocation = this->m_ptr_glGetFragDataLocation;
+if(this->m_ptr_glGetFragDataLocation)this->m_ptr_glGetFragDataLocation = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC)&ProfilingTableDecorator::m_glGetFragDataLocation_profile;
+this->m_names[2311] = "glMultiTexCoord1svARB";
+this->m_orig_glMultiTexCoord1svARB = this->m_ptr_glMultiTexCoord1svARB;
+if(this->m_ptr_glMultiTexCoord1svARB)this->m_ptr_glMultiTexCoord1svARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1svARB_profile;
+this->m_names[2312] = "glGetMapxvOES";
+this->m_orig_glGetMapxvOES = this->m_ptr_glGetMapxvOES;
+if(this->m_ptr_glGetMapxvOES)this->m_ptr_glGetMapxvOES = (FunctionTable::MEMBERPFNGLGETMAPXVOESPROC)&ProfilingTableDecorator::m_glGetMapxvOES_profile;
+this->m_names[2313] = "glTextureStorage2DMultisampleEXT";
+this->m_orig_glTextureStorage2DMultisampleEXT = this->m_ptr_glTextureStorage2DMultisampleEXT;
+if(this->m_ptr_glTextureStorage2DMultisampleEXT)this->m_ptr_glTextureStorage2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorage2DMultisampleEXT_profile;
+this->m_names[2314] = "glGetMaterialfv";
+this->m_orig_glGetMaterialfv = this->m_ptr_glGetMaterialfv;
+if(this->m_ptr_glGetMaterialfv)this->m_ptr_glGetMaterialfv = (FunctionTable::MEMBERPFNGLGETMATERIALFVPROC)&ProfilingTableDecorator::m_glGetMaterialfv_profile;
+this->m_names[2315] = "glVertexAttrib4NbvARB";
+this->m_orig_glVertexAttrib4NbvARB = this->m_ptr_glVertexAttrib4NbvARB;
+if(this->m_ptr_glVertexAttrib4NbvARB)this->m_ptr_glVertexAttrib4NbvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4NbvARB_profile;
+this->m_names[2316] = "glPixelMapuiv";
+this->m_orig_glPixelMapuiv = this->m_ptr_glPixelMapuiv;
+if(this->m_ptr_glPixelMapuiv)this->m_ptr_glPixelMapuiv = (FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glPixelMapuiv_profile;
+this->m_names[2317] = "glColorPointerEXT";
+this->m_orig_glColorPointerEXT = this->m_ptr_glColorPointerEXT;
+if(this->m_ptr_glColorPointerEXT)this->m_ptr_glColorPointerEXT = (FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC)&ProfilingTableDecorator::m_glColorPointerEXT_profile;
+this->m_names[2318] = "glEnableClientStateiEXT";
+this->m_orig_glEnableClientStateiEXT = this->m_ptr_glEnableClientStateiEXT;
+if(this->m_ptr_glEnableClientStateiEXT)this->m_ptr_glEnableClientStateiEXT = (FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC)&ProfilingTableDecorator::m_glEnableClientStateiEXT_profile;
+this->m_names[2319] = "glClearTexSubImage";
+this->m_orig_glClearTexSubImage = this->m_ptr_glClearTexSubImage;
+if(this->m_ptr_glClearTexSubImage)this->m_ptr_glClearTexSubImage = (FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC)&ProfilingTableDecorator::m_glClearTexSubImage_profile;
+this->m_names[2320] = "glEvalCoord1xvOES";
+this->m_orig_glEvalCoord1xvOES = this->m_ptr_glEvalCoord1xvOES;
+if(this->m_ptr_glEvalCoord1xvOES)this->m_ptr_glEvalCoord1xvOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC)&ProfilingTableDecorator::m_glEvalCoord1xvOES_profile;
+this->m_names[2321] = "glDetachObjectARB";
+this->m_orig_glDetachObjectARB = this->m_ptr_glDetachObjectARB;
+if(this->m_ptr_glDetachObjectARB)this->m_ptr_glDetachObjectARB = (FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC)&ProfilingTableDecorator::m_glDetachObjectARB_profile;
+this->m_names[2322] = "glGetTextureParameterIiv";
+this->m_orig_glGetTextureParameterIiv = this->m_ptr_glGetTextureParameterIiv;
+if(this->m_ptr_glGetTextureParameterIiv)this->m_ptr_glGetTextureParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetTextureParameterIiv_profile;
+this->m_names[2323] = "glVariantusvEXT";
+this->m_orig_glVariantusvEXT = this->m_ptr_glVariantusvEXT;
+if(this->m_ptr_glVariantusvEXT)this->m_ptr_glVariantusvEXT = (FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC)&ProfilingTableDecorator::m_glVariantusvEXT_profile;
+this->m_names[2324] = "glCompressedTextureImage3DEXT";
+this->m_orig_glCompressedTextureImage3DEXT = this->m_ptr_glCompressedTextureImage3DEXT;
+if(this->m_ptr_glCompressedTextureImage3DEXT)this->m_ptr_glCompressedTextureImage3DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureImage3DEXT_profile;
+this->m_names[2325] = "glMultiTexCoord1dARB";
+this->m_orig_glMultiTexCoord1dARB = this->m_ptr_glMultiTexCoord1dARB;
+if(this->m_ptr_glMultiTexCoord1dARB)this->m_ptr_glMultiTexCoord1dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord1dARB_profile;
+this->m_names[2326] = "glGetVertexArrayIntegeri_vEXT";
+this->m_orig_glGetVertexArrayIntegeri_vEXT = this->m_ptr_glGetVertexArrayIntegeri_vEXT;
+if(this->m_ptr_glGetVertexArrayIntegeri_vEXT)this->m_ptr_glGetVertexArrayIntegeri_vEXT = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)&ProfilingTableDecorator::m_glGetVertexArrayIntegeri_vEXT_profile;
+this->m_names[2327] = "glVertexAttribI4ubv";
+this->m_orig_glVertexAttribI4ubv = this->m_ptr_glVertexAttribI4ubv;
+if(this->m_ptr_glVertexAttribI4ubv)this->m_ptr_glVertexAttribI4ubv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC)&ProfilingTableDecorator::m_glVertexAttribI4ubv_profile;
+this->m_names[2328] = "glPixelTexGenParameterfSGIS";
+this->m_orig_glPixelTexGenParameterfSGIS = this->m_ptr_glPixelTexGenParameterfSGIS;
+if(this->m_ptr_glPixelTexGenParameterfSGIS)this->m_ptr_glPixelTexGenParameterfSGIS = (FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC)&ProfilingTableDecorator::m_glPixelTexGenParameterfSGIS_profile;
+this->m_names[2329] = "glProgramUniformMatrix4x2dv";
+this->m_orig_glProgramUniformMatrix4x2dv = this->m_ptr_glProgramUniformMatrix4x2dv;
+if(this->m_ptr_glProgramUniformMatrix4x2dv)this->m_ptr_glProgramUniformMatrix4x2dv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2dv_profile;
+this->m_names[2330] = "glUniform3fARB";
+this->m_orig_glUniform3fARB = this->m_ptr_glUniform3fARB;
+if(this->m_ptr_glUniform3fARB)this->m_ptr_glUniform3fARB = (FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC)&ProfilingTableDecorator::m_glUniform3fARB_profile;
+this->m_names[2331] = "glIsShader";
+this->m_orig_glIsShader = this->m_ptr_glIsShader;
+if(this->m_ptr_glIsShader)this->m_ptr_glIsShader = (FunctionTable::MEMBERPFNGLISSHADERPROC)&ProfilingTableDecorator::m_glIsShader_profile;
+this->m_names[2332] = "glConvolutionParameteriv";
+this->m_orig_glConvolutionParameteriv = this->m_ptr_glConvolutionParameteriv;
+if(this->m_ptr_glConvolutionParameteriv)this->m_ptr_glConvolutionParameteriv = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC)&ProfilingTableDecorator::m_glConvolutionParameteriv_profile;
+this->m_names[2333] = "glCopyMultiTexSubImage2DEXT";
+this->m_orig_glCopyMultiTexSubImage2DEXT = this->m_ptr_glCopyMultiTexSubImage2DEXT;
+if(this->m_ptr_glCopyMultiTexSubImage2DEXT)this->m_ptr_glCopyMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexSubImage2DEXT_profile;
+this->m_names[2334] = "glEnableVertexAttribArrayARB";
+this->m_orig_glEnableVertexAttribArrayARB = this->m_ptr_glEnableVertexAttribArrayARB;
+if(this->m_ptr_glEnableVertexAttribArrayARB)this->m_ptr_glEnableVertexAttribArrayARB = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC)&ProfilingTableDecorator::m_glEnableVertexAttribArrayARB_profile;
+this->m_names[2335] = "glMulticastCopyBufferSubDataNV";
+this->m_orig_glMulticastCopyBufferSubDataNV = this->m_ptr_glMulticastCopyBufferSubDataNV;
+if(this->m_ptr_glMulticastCopyBufferSubDataNV)this->m_ptr_glMulticastCopyBufferSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC)&ProfilingTableDecorator::m_glMulticastCopyBufferSubDataNV_profile;
+this->m_names[2336] = "glEnable";
+this->m_orig_glEnable = this->m_ptr_glEnable;
+if(this->m_ptr_glEnable)this->m_ptr_glEnable = (FunctionTable::MEMBERPFNGLENABLEPROC)&ProfilingTableDecorator::m_glEnable_profile;
+this->m_names[2337] = "glGetActiveUniformsiv";
+this->m_orig_glGetActiveUniformsiv = this->m_ptr_glGetActiveUniformsiv;
+if(this->m_ptr_glGetActiveUniformsiv)this->m_ptr_glGetActiveUniformsiv = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC)&ProfilingTableDecorator::m_glGetActiveUniformsiv_profile;
+this->m_names[2338] = "glGetVertexAttribivARB";
+this->m_orig_glGetVertexAttribivARB = this->m_ptr_glGetVertexAttribivARB;
+if(this->m_ptr_glGetVertexAttribivARB)this->m_ptr_glGetVertexAttribivARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribivARB_profile;
+this->m_names[2339] = "glTexCoord4hvNV";
+this->m_orig_glTexCoord4hvNV = this->m_ptr_glTexCoord4hvNV;
+if(this->m_ptr_glTexCoord4hvNV)this->m_ptr_glTexCoord4hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC)&ProfilingTableDecorator::m_glTexCoord4hvNV_profile;
+this->m_names[2340] = "glUseProgramObjectARB";
+this->m_orig_glUseProgramObjectARB = this->m_ptr_glUseProgramObjectARB;
+if(this->m_ptr_glUseProgramObjectARB)this->m_ptr_glUseProgramObjectARB = (FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC)&ProfilingTableDecorator::m_glUseProgramObjectARB_profile;
+this->m_names[2341] = "glGetAttribLocation";
+this->m_orig_glGetAttribLocation = this->m_ptr_glGetAttribLocation;
+if(this->m_ptr_glGetAttribLocation)this->m_ptr_glGetAttribLocation = (FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC)&ProfilingTableDecorator::m_glGetAttribLocation_profile;
+this->m_names[2342] = "glVertexAttrib4dv";
+this->m_orig_glVertexAttrib4dv = this->m_ptr_glVertexAttrib4dv;
+if(this->m_ptr_glVertexAttrib4dv)this->m_ptr_glVertexAttrib4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC)&ProfilingTableDecorator::m_glVertexAttrib4dv_profile;
+this->m_names[2343] = "glGetTextureParameteriv";
+this->m_orig_glGetTextureParameteriv = this->m_ptr_glGetTextureParameteriv;
+if(this->m_ptr_glGetTextureParameteriv)this->m_ptr_glGetTextureParameteriv = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTextureParameteriv_profile;
+this->m_names[2344] = "glNamedBufferStorageMemEXT";
+this->m_orig_glNamedBufferStorageMemEXT = this->m_ptr_glNamedBufferStorageMemEXT;
+if(this->m_ptr_glNamedBufferStorageMemEXT)this->m_ptr_glNamedBufferStorageMemEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC)&ProfilingTableDecorator::m_glNamedBufferStorageMemEXT_profile;
+this->m_names[2345] = "glPathSubCoordsNV";
+this->m_orig_glPathSubCoordsNV = this->m_ptr_glPathSubCoordsNV;
+if(this->m_ptr_glPathSubCoordsNV)this->m_ptr_glPathSubCoordsNV = (FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC)&ProfilingTableDecorator::m_glPathSubCoordsNV_profile;
+this->m_names[2346] = "glMatrixIndexusvARB";
+this->m_orig_glMatrixIndexusvARB = this->m_ptr_glMatrixIndexusvARB;
+if(this->m_ptr_glMatrixIndexusvARB)this->m_ptr_glMatrixIndexusvARB = (FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC)&ProfilingTableDecorator::m_glMatrixIndexusvARB_profile;
+this->m_names[2347] = "glGetVideouivNV";
+this->m_orig_glGetVideouivNV = this->m_ptr_glGetVideouivNV;
+if(this->m_ptr_glGetVideouivNV)this->m_ptr_glGetVideouivNV = (FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC)&ProfilingTableDecorator::m_glGetVideouivNV_profile;
+this->m_names[2348] = "glGetVideoCaptureivNV";
+this->m_orig_glGetVideoCaptureivNV = this->m_ptr_glGetVideoCaptureivNV;
+if(this->m_ptr_glGetVideoCaptureivNV)this->m_ptr_glGetVideoCaptureivNV = (FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC)&ProfilingTableDecorator::m_glGetVideoCaptureivNV_profile;
+this->m_names[2349] = "glProgramUniform3ui";
+this->m_orig_glProgramUniform3ui = this->m_ptr_glProgramUniform3ui;
+if(this->m_ptr_glProgramUniform3ui)this->m_ptr_glProgramUniform3ui = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC)&ProfilingTableDecorator::m_glProgramUniform3ui_profile;
+this->m_names[2350] = "glVertexAttrib3svARB";
+this->m_orig_glVertexAttrib3svARB = this->m_ptr_glVertexAttrib3svARB;
+if(this->m_ptr_glVertexAttrib3svARB)this->m_ptr_glVertexAttrib3svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3svARB_profile;
+this->m_names[2351] = "glGetNamedBufferParameterivEXT";
+this->m_orig_glGetNamedBufferParameterivEXT = this->m_ptr_glGetNamedBufferParameterivEXT;
+if(this->m_ptr_glGetNamedBufferParameterivEXT)this->m_ptr_glGetNamedBufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameterivEXT_profile;
+this->m_names[2352] = "glMatrixScaledEXT";
+this->m_orig_glMatrixScaledEXT = this->m_ptr_glMatrixScaledEXT;
+if(this->m_ptr_glMatrixScaledEXT)this->m_ptr_glMatrixScaledEXT = (FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC)&ProfilingTableDecorator::m_glMatrixScaledEXT_profile;
+this->m_names[2353] = "glProgramUniformMatrix2x3fv";
+this->m_orig_glProgramUniformMatrix2x3fv = this->m_ptr_glProgramUniformMatrix2x3fv;
+if(this->m_ptr_glProgramUniformMatrix2x3fv)this->m_ptr_glProgramUniformMatrix2x3fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x3fv_profile;
+this->m_names[2354] = "glGetFragmentLightivSGIX";
+this->m_orig_glGetFragmentLightivSGIX = this->m_ptr_glGetFragmentLightivSGIX;
+if(this->m_ptr_glGetFragmentLightivSGIX)this->m_ptr_glGetFragmentLightivSGIX = (FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC)&ProfilingTableDecorator::m_glGetFragmentLightivSGIX_profile;
+this->m_names[2355] = "glGetStringi";
+this->m_orig_glGetStringi = this->m_ptr_glGetStringi;
+if(this->m_ptr_glGetStringi)this->m_ptr_glGetStringi = (FunctionTable::MEMBERPFNGLGETSTRINGIPROC)&ProfilingTableDecorator::m_glGetStringi_profile;
+this->m_names[2356] = "glWindowPos2svARB";
+this->m_orig_glWindowPos2svARB = this->m_ptr_glWindowPos2svARB;
+if(this->m_ptr_glWindowPos2svARB)this->m_ptr_glWindowPos2svARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC)&ProfilingTableDecorator::m_glWindowPos2svARB_profile;
+this->m_names[2357] = "glVertexAttrib2svNV";
+this->m_orig_glVertexAttrib2svNV = this->m_ptr_glVertexAttrib2svNV;
+if(this->m_ptr_glVertexAttrib2svNV)this->m_ptr_glVertexAttrib2svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib2svNV_profile;
+this->m_names[2358] = "glWindowPos2ivARB";
+this->m_orig_glWindowPos2ivARB = this->m_ptr_glWindowPos2ivARB;
+if(this->m_ptr_glWindowPos2ivARB)this->m_ptr_glWindowPos2ivARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC)&ProfilingTableDecorator::m_glWindowPos2ivARB_profile;
+this->m_names[2359] = "glGetVertexAttribPointervNV";
+this->m_orig_glGetVertexAttribPointervNV = this->m_ptr_glGetVertexAttribPointervNV;
+if(this->m_ptr_glGetVertexAttribPointervNV)this->m_ptr_glGetVertexAttribPointervNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointervNV_profile;
+this->m_names[2360] = "glPushMatrix";
+this->m_orig_glPushMatrix = this->m_ptr_glPushMatrix;
+if(this->m_ptr_glPushMatrix)this->m_ptr_glPushMatrix = (FunctionTable::MEMBERPFNGLPUSHMATRIXPROC)&ProfilingTableDecorator::m_glPushMatrix_profile;
+this->m_names[2361] = "glEdgeFlagPointerListIBM";
+this->m_orig_glEdgeFlagPointerListIBM = this->m_ptr_glEdgeFlagPointerListIBM;
+if(this->m_ptr_glEdgeFlagPointerListIBM)this->m_ptr_glEdgeFlagPointerListIBM = (FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glEdgeFlagPointerListIBM_profile;
+this->m_names[2362] = "glGenerateMipmapEXT";
+this->m_orig_glGenerateMipmapEXT = this->m_ptr_glGenerateMipmapEXT;
+if(this->m_ptr_glGenerateMipmapEXT)this->m_ptr_glGenerateMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateMipmapEXT_profile;
+this->m_names[2363] = "glWindowPos3sv";
+this->m_orig_glWindowPos3sv = this->m_ptr_glWindowPos3sv;
+if(this->m_ptr_glWindowPos3sv)this->m_ptr_glWindowPos3sv = (FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC)&ProfilingTableDecorator::m_glWindowPos3sv_profile;
+this->m_names[2364] = "glPathCoordsNV";
+this->m_orig_glPathCoordsNV = this->m_ptr_glPathCoordsNV;
+if(this->m_ptr_glPathCoordsNV)this->m_ptr_glPathCoordsNV = (FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC)&ProfilingTableDecorator::m_glPathCoordsNV_profile;
+this->m_names[2365] = "glProgramUniform1i";
+this->m_orig_glProgramUniform1i = this->m_ptr_glProgramUniform1i;
+if(this->m_ptr_glProgramUniform1i)this->m_ptr_glProgramUniform1i = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC)&ProfilingTableDecorator::m_glProgramUniform1i_profile;
+this->m_names[2366] = "glProgramUniform1d";
+this->m_orig_glProgramUniform1d = this->m_ptr_glProgramUniform1d;
+if(this->m_ptr_glProgramUniform1d)this->m_ptr_glProgramUniform1d = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC)&ProfilingTableDecorator::m_glProgramUniform1d_profile;
+this->m_names[2367] = "glProgramUniform1f";
+this->m_orig_glProgramUniform1f = this->m_ptr_glProgramUniform1f;
+if(this->m_ptr_glProgramUniform1f)this->m_ptr_glProgramUniform1f = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC)&ProfilingTableDecorator::m_glProgramUniform1f_profile;
+this->m_names[2368] = "glProgramParameteriEXT";
+this->m_orig_glProgramParameteriEXT = this->m_ptr_glProgramParameteriEXT;
+if(this->m_ptr_glProgramParameteriEXT)this->m_ptr_glProgramParameteriEXT = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glProgramParameteriEXT_profile;
+this->m_names[2369] = "glCompressedMultiTexImage2DEXT";
+this->m_orig_glCompressedMultiTexImage2DEXT = this->m_ptr_glCompressedMultiTexImage2DEXT;
+if(this->m_ptr_glCompressedMultiTexImage2DEXT)this->m_ptr_glCompressedMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexImage2DEXT_profile;
+this->m_names[2370] = "glProgramUniform3iv";
+this->m_orig_glProgramUniform3iv = this->m_ptr_glProgramUniform3iv;
+if(this->m_ptr_glProgramUniform3iv)this->m_ptr_glProgramUniform3iv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC)&ProfilingTableDecorator::m_glProgramUniform3iv_profile;
+this->m_names[2371] = "glIndexiv";
+this->m_orig_glIndexiv = this->m_ptr_glIndexiv;
+if(this->m_ptr_glIndexiv)this->m_ptr_glIndexiv = (FunctionTable::MEMBERPFNGLINDEXIVPROC)&ProfilingTableDecorator::m_glIndexiv_profile;
+this->m_names[2372] = "glMultiTexCoord4xvOES";
+this->m_orig_glMultiTexCoord4xvOES = this->m_ptr_glMultiTexCoord4xvOES;
+if(this->m_ptr_glMultiTexCoord4xvOES)this->m_ptr_glMultiTexCoord4xvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord4xvOES_profile;
+this->m_names[2373] = "glEGLImageTargetTexture2DOES";
+this->m_orig_glEGLImageTargetTexture2DOES = this->m_ptr_glEGLImageTargetTexture2DOES;
+if(this->m_ptr_glEGLImageTargetTexture2DOES)this->m_ptr_glEGLImageTargetTexture2DOES = (FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC)&ProfilingTableDecorator::m_glEGLImageTargetTexture2DOES_profile;
+this->m_names[2374] = "glPixelZoom";
+this->m_orig_glPixelZoom = this->m_ptr_glPixelZoom;
+if(this->m_ptr_glPixelZoom)this->m_ptr_glPixelZoom = (FunctionTable::MEMBERPFNGLPIXELZOOMPROC)&ProfilingTableDecorator::m_glPixelZoom_profile;
+this->m_names[2375] = "glVertex3bvOES";
+this->m_orig_glVertex3bvOES = this->m_ptr_glVertex3bvOES;
+if(this->m_ptr_glVertex3bvOES)this->m_ptr_glVertex3bvOES = (FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC)&ProfilingTableDecorator::m_glVertex3bvOES_profile;
+this->m_names[2376] = "glFramebufferReadBufferEXT";
+this->m_orig_glFramebufferReadBufferEXT = this->m_ptr_glFramebufferReadBufferEXT;
+if(this->m_ptr_glFramebufferReadBufferEXT)this->m_ptr_glFramebufferReadBufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferReadBufferEXT_profile;
+this->m_names[2377] = "glExtractComponentEXT";
+this->m_orig_glExtractComponentEXT = this->m_ptr_glExtractComponentEXT;
+if(this->m_ptr_glExtractComponentEXT)this->m_ptr_glExtractComponentEXT = (FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC)&ProfilingTableDecorator::m_glExtractComponentEXT_profile;
+this->m_names[2378] = "glCombinerParameterivNV";
+this->m_orig_glCombinerParameterivNV = this->m_ptr_glCombinerParameterivNV;
+if(this->m_ptr_glCombinerParameterivNV)this->m_ptr_glCombinerParameterivNV = (FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glCombinerParameterivNV_profile;
+this->m_names[2379] = "glMinmax";
+this->m_orig_glMinmax = this->m_ptr_glMinmax;
+if(this->m_ptr_glMinmax)this->m_ptr_glMinmax = (FunctionTable::MEMBERPFNGLMINMAXPROC)&ProfilingTableDecorator::m_glMinmax_profile;
+this->m_names[2380] = "glColorP3ui";
+this->m_orig_glColorP3ui = this->m_ptr_glColorP3ui;
+if(this->m_ptr_glColorP3ui)this->m_ptr_glColorP3ui = (FunctionTable::MEMBERPFNGLCOLORP3UIPROC)&ProfilingTableDecorator::m_glColorP3ui_profile;
+this->m_names[2381] = "glPointParameterfvSGIS";
+this->m_orig_glPointParameterfvSGIS = this->m_ptr_glPointParameterfvSGIS;
+if(this->m_ptr_glPointParameterfvSGIS)this->m_ptr_glPointParameterfvSGIS = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC)&ProfilingTableDecorator::m_glPointParameterfvSGIS_profile;
+this->m_names[2382] = "glBlendEquationi";
+this->m_orig_glBlendEquationi = this->m_ptr_glBlendEquationi;
+if(this->m_ptr_glBlendEquationi)this->m_ptr_glBlendEquationi = (FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC)&ProfilingTableDecorator::m_glBlendEquationi_profile;
+this->m_names[2383] = "glGetFogFuncSGIS";
+this->m_orig_glGetFogFuncSGIS = this->m_ptr_glGetFogFuncSGIS;
+if(this->m_ptr_glGetFogFuncSGIS)this->m_ptr_glGetFogFuncSGIS = (FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC)&ProfilingTableDecorator::m_glGetFogFuncSGIS_profile;
+this->m_names[2384] = "glVertexAttrib4fvNV";
+this->m_orig_glVertexAttrib4fvNV = this->m_ptr_glVertexAttrib4fvNV;
+if(this->m_ptr_glVertexAttrib4fvNV)this->m_ptr_glVertexAttrib4fvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fvNV_profile;
+this->m_names[2385] = "glGetnMinmax";
+this->m_orig_glGetnMinmax = this->m_ptr_glGetnMinmax;
+if(this->m_ptr_glGetnMinmax)this->m_ptr_glGetnMinmax = (FunctionTable::MEMBERPFNGLGETNMINMAXPROC)&ProfilingTableDecorator::m_glGetnMinmax_profile;
+this->m_names[2386] = "glFragmentLightiSGIX";
+this->m_orig_glFragmentLightiSGIX = this->m_ptr_glFragmentLightiSGIX;
+if(this->m_ptr_glFragmentLightiSGIX)this->m_ptr_glFragmentLightiSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC)&ProfilingTableDecorator::m_glFragmentLightiSGIX_profile;
+this->m_names[2387] = "glMultiTexCoord1bvOES";
+this->m_orig_glMultiTexCoord1bvOES = this->m_ptr_glMultiTexCoord1bvOES;
+if(this->m_ptr_glMultiTexCoord1bvOES)this->m_ptr_glMultiTexCoord1bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord1bvOES_profile;
+this->m_names[2388] = "glSecondaryColorPointerEXT";
+this->m_orig_glSecondaryColorPointerEXT = this->m_ptr_glSecondaryColorPointerEXT;
+if(this->m_ptr_glSecondaryColorPointerEXT)this->m_ptr_glSecondaryColorPointerEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC)&ProfilingTableDecorator::m_glSecondaryColorPointerEXT_profile;
+this->m_names[2389] = "glMultiTexCoordP4uiv";
+this->m_orig_glMultiTexCoordP4uiv = this->m_ptr_glMultiTexCoordP4uiv;
+if(this->m_ptr_glMultiTexCoordP4uiv)this->m_ptr_glMultiTexCoordP4uiv = (FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC)&ProfilingTableDecorator::m_glMultiTexCoordP4uiv_profile;
+this->m_names[2390] = "glGetBufferSubDataARB";
+this->m_orig_glGetBufferSubDataARB = this->m_ptr_glGetBufferSubDataARB;
+if(this->m_ptr_glGetBufferSubDataARB)this->m_ptr_glGetBufferSubDataARB = (FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC)&ProfilingTableDecorator::m_glGetBufferSubDataARB_profile;
+this->m_names[2391] = "glSecondaryColor3hNV";
+this->m_orig_glSecondaryColor3hNV = this->m_ptr_glSecondaryColor3hNV;
+if(this->m_ptr_glSecondaryColor3hNV)this->m_ptr_glSecondaryColor3hNV = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC)&ProfilingTableDecorator::m_glSecondaryColor3hNV_profile;
+this->m_names[2392] = "glGetPathParameterivNV";
+this->m_orig_glGetPathParameterivNV = this->m_ptr_glGetPathParameterivNV;
+if(this->m_ptr_glGetPathParameterivNV)this->m_ptr_glGetPathParameterivNV = (FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC)&ProfilingTableDecorator::m_glGetPathParameterivNV_profile;
+this->m_names[2393] = "glFlushRasterSGIX";
+this->m_orig_glFlushRasterSGIX = this->m_ptr_glFlushRasterSGIX;
+if(this->m_ptr_glFlushRasterSGIX)this->m_ptr_glFlushRasterSGIX = (FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC)&ProfilingTableDecorator::m_glFlushRasterSGIX_profile;
+this->m_names[2394] = "glElementPointerATI";
+this->m_orig_glElementPointerATI = this->m_ptr_glElementPointerATI;
+if(this->m_ptr_glElementPointerATI)this->m_ptr_glElementPointerATI = (FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC)&ProfilingTableDecorator::m_glElementPointerATI_profile;
+this->m_names[2395] = "glGetAttachedObjectsARB";
+this->m_orig_glGetAttachedObjectsARB = this->m_ptr_glGetAttachedObjectsARB;
+if(this->m_ptr_glGetAttachedObjectsARB)this->m_ptr_glGetAttachedObjectsARB = (FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC)&ProfilingTableDecorator::m_glGetAttachedObjectsARB_profile;
+this->m_names[2396] = "glUniform4iv";
+this->m_orig_glUniform4iv = this->m_ptr_glUniform4iv;
+if(this->m_ptr_glUniform4iv)this->m_ptr_glUniform4iv = (FunctionTable::MEMBERPFNGLUNIFORM4IVPROC)&ProfilingTableDecorator::m_glUniform4iv_profile;
+this->m_names[2397] = "glFogxOES";
+this->m_orig_glFogxOES = this->m_ptr_glFogxOES;
+if(this->m_ptr_glFogxOES)this->m_ptr_glFogxOES = (FunctionTable::MEMBERPFNGLFOGXOESPROC)&ProfilingTableDecorator::m_glFogxOES_profile;
+this->m_names[2398] = "glSharpenTexFuncSGIS";
+this->m_orig_glSharpenTexFuncSGIS = this->m_ptr_glSharpenTexFuncSGIS;
+if(this->m_ptr_glSharpenTexFuncSGIS)this->m_ptr_glSharpenTexFuncSGIS = (FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC)&ProfilingTableDecorator::m_glSharpenTexFuncSGIS_profile;
+this->m_names[2399] = "glClearDepthfOES";
+this->m_orig_glClearDepthfOES = this->m_ptr_glClearDepthfOES;
+if(this->m_ptr_glClearDepthfOES)this->m_ptr_glClearDepthfOES = (FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC)&ProfilingTableDecorator::m_glClearDepthfOES_profile;
+this->m_names[2400] = "glDeleteCommandListsNV";
+this->m_orig_glDeleteCommandListsNV = this->m_ptr_glDeleteCommandListsNV;
+if(this->m_ptr_glDeleteCommandListsNV)this->m_ptr_glDeleteCommandListsNV = (FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC)&ProfilingTableDecorator::m_glDeleteCommandListsNV_profile;
+this->m_names[2401] = "glSpecializeShader";
+this->m_orig_glSpecializeShader = this->m_ptr_glSpecializeShader;
+if(this->m_ptr_glSpecializeShader)this->m_ptr_glSpecializeShader = (FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC)&ProfilingTableDecorator::m_glSpecializeShader_profile;
+this->m_names[2402] = "glVertex4hNV";
+this->m_orig_glVertex4hNV = this->m_ptr_glVertex4hNV;
+if(this->m_ptr_glVertex4hNV)this->m_ptr_glVertex4hNV = (FunctionTable::MEMBERPFNGLVERTEX4HNVPROC)&ProfilingTableDecorator::m_glVertex4hNV_profile;
+this->m_names[2403] = "glSecondaryColor3dvEXT";
+this->m_orig_glSecondaryColor3dvEXT = this->m_ptr_glSecondaryColor3dvEXT;
+if(this->m_ptr_glSecondaryColor3dvEXT)this->m_ptr_glSecondaryColor3dvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3dvEXT_profile;
+this->m_names[2404] = "glGenTextures";
+this->m_orig_glGenTextures = this->m_ptr_glGenTextures;
+if(this->m_ptr_glGenTextures)this->m_ptr_glGenTextures = (FunctionTable::MEMBERPFNGLGENTEXTURESPROC)&ProfilingTableDecorator::m_glGenTextures_profile;
+this->m_names[2405] = "glTextureStorage2DMultisample";
+this->m_orig_glTextureStorage2DMultisample = this->m_ptr_glTextureStorage2DMultisample;
+if(this->m_ptr_glTextureStorage2DMultisample)this->m_ptr_glTextureStorage2DMultisample = (FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTextureStorage2DMultisample_profile;
+this->m_names[2406] = "glUniform3ui64vNV";
+this->m_orig_glUniform3ui64vNV = this->m_ptr_glUniform3ui64vNV;
+if(this->m_ptr_glUniform3ui64vNV)this->m_ptr_glUniform3ui64vNV = (FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC)&ProfilingTableDecorator::m_glUniform3ui64vNV_profile;
+this->m_names[2407] = "glBlendFuncSeparateIndexedAMD";
+this->m_orig_glBlendFuncSeparateIndexedAMD = this->m_ptr_glBlendFuncSeparateIndexedAMD;
+if(this->m_ptr_glBlendFuncSeparateIndexedAMD)this->m_ptr_glBlendFuncSeparateIndexedAMD = (FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)&ProfilingTableDecorator::m_glBlendFuncSeparateIndexedAMD_profile;
+this->m_names[2408] = "glMakeBufferResidentNV";
+this->m_orig_glMakeBufferResidentNV = this->m_ptr_glMakeBufferResidentNV;
+if(this->m_ptr_glMakeBufferResidentNV)this->m_ptr_glMakeBufferResidentNV = (FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glMakeBufferResidentNV_profile;
+this->m_names[2409] = "glShaderOp2EXT";
+this->m_orig_glShaderOp2EXT = this->m_ptr_glShaderOp2EXT;
+if(this->m_ptr_glShaderOp2EXT)this->m_ptr_glShaderOp2EXT = (FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC)&ProfilingTableDecorator::m_glShaderOp2EXT_profile;
+this->m_names[2410] = "glGetVertexAttribivNV";
+this->m_orig_glGetVertexAttribivNV = this->m_ptr_glGetVertexAttribivNV;
+if(this->m_ptr_glGetVertexAttribivNV)this->m_ptr_glGetVertexAttribivNV = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC)&ProfilingTableDecorator::m_glGetVertexAttribivNV_profile;
+this->m_names[2411] = "glTexParameterIivEXT";
+this->m_orig_glTexParameterIivEXT = this->m_ptr_glTexParameterIivEXT;
+if(this->m_ptr_glTexParameterIivEXT)this->m_ptr_glTexParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glTexParameterIivEXT_profile;
+this->m_names[2412] = "glGetPerfQueryDataINTEL";
+this->m_orig_glGetPerfQueryDataINTEL = this->m_ptr_glGetPerfQueryDataINTEL;
+if(this->m_ptr_glGetPerfQueryDataINTEL)this->m_ptr_glGetPerfQueryDataINTEL = (FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC)&ProfilingTableDecorator::m_glGetPerfQueryDataINTEL_profile;
+this->m_names[2413] = "glVertexAttrib4dvARB";
+this->m_orig_glVertexAttrib4dvARB = this->m_ptr_glVertexAttrib4dvARB;
+if(this->m_ptr_glVertexAttrib4dvARB)this->m_ptr_glVertexAttrib4dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4dvARB_profile;
+this->m_names[2414] = "glTextureSubImage1DEXT";
+this->m_orig_glTextureSubImage1DEXT = this->m_ptr_glTextureSubImage1DEXT;
+if(this->m_ptr_glTextureSubImage1DEXT)this->m_ptr_glTextureSubImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureSubImage1DEXT_profile;
+this->m_names[2415] = "glGetActiveUniformBlockName";
+this->m_orig_glGetActiveUniformBlockName = this->m_ptr_glGetActiveUniformBlockName;
+if(this->m_ptr_glGetActiveUniformBlockName)this->m_ptr_glGetActiveUniformBlockName = (FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)&ProfilingTableDecorator::m_glGetActiveUniformBlockName_profile;
+this->m_names[2416] = "glVertexAttrib2dvARB";
+this->m_orig_glVertexAttrib2dvARB = this->m_ptr_glVertexAttrib2dvARB;
+if(this->m_ptr_glVertexAttrib2dvARB)this->m_ptr_glVertexAttrib2dvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib2dvARB_profile;
+this->m_names[2417] = "glVertexAttribPointer";
+this->m_orig_glVertexAttribPointer = this->m_ptr_glVertexAttribPointer;
+if(this->m_ptr_glVertexAttribPointer)this->m_ptr_glVertexAttribPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribPointer_profile;
+this->m_names[2418] = "glDepthBoundsdNV";
+this->m_orig_glDepthBoundsdNV = this->m_ptr_glDepthBoundsdNV;
+if(this->m_ptr_glDepthBoundsdNV)this->m_ptr_glDepthBoundsdNV = (FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC)&ProfilingTableDecorator::m_glDepthBoundsdNV_profile;
+this->m_names[2419] = "glDeleteTexturesEXT";
+this->m_orig_glDeleteTexturesEXT = this->m_ptr_glDeleteTexturesEXT;
+if(this->m_ptr_glDeleteTexturesEXT)this->m_ptr_glDeleteTexturesEXT = (FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC)&ProfilingTableDecorator::m_glDeleteTexturesEXT_profile;
+this->m_names[2420] = "glDrawBuffersATI";
+this->m_orig_glDrawBuffersATI = this->m_ptr_glDrawBuffersATI;
+if(this->m_ptr_glDrawBuffersATI)this->m_ptr_glDrawBuffersATI = (FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC)&ProfilingTableDecorator::m_glDrawBuffersATI_profile;
+this->m_names[2421] = "glLightModelxvOES";
+this->m_orig_glLightModelxvOES = this->m_ptr_glLightModelxvOES;
+if(this->m_ptr_glLightModelxvOES)this->m_ptr_glLightModelxvOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC)&ProfilingTableDecorator::m_glLightModelxvOES_profile;
+this->m_names[2422] = "glApplyTextureEXT";
+this->m_orig_glApplyTextureEXT = this->m_ptr_glApplyTextureEXT;
+if(this->m_ptr_glApplyTextureEXT)this->m_ptr_glApplyTextureEXT = (FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC)&ProfilingTableDecorator::m_glApplyTextureEXT_profile;
+this->m_names[2423] = "glGetImageHandleNV";
+this->m_orig_glGetImageHandleNV = this->m_ptr_glGetImageHandleNV;
+if(this->m_ptr_glGetImageHandleNV)this->m_ptr_glGetImageHandleNV = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC)&ProfilingTableDecorator::m_glGetImageHandleNV_profile;
+this->m_names[2424] = "glGetMinmax";
+this->m_orig_glGetMinmax = this->m_ptr_glGetMinmax;
+if(this->m_ptr_glGetMinmax)this->m_ptr_glGetMinmax = (FunctionTable::MEMBERPFNGLGETMINMAXPROC)&ProfilingTableDecorator::m_glGetMinmax_profile;
+this->m_names[2425] = "glGetFixedvOES";
+this->m_orig_glGetFixedvOES = this->m_ptr_glGetFixedvOES;
+if(this->m_ptr_glGetFixedvOES)this->m_ptr_glGetFixedvOES = (FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC)&ProfilingTableDecorator::m_glGetFixedvOES_profile;
+this->m_names[2426] = "glSamplePatternEXT";
+this->m_orig_glSamplePatternEXT = this->m_ptr_glSamplePatternEXT;
+if(this->m_ptr_glSamplePatternEXT)this->m_ptr_glSamplePatternEXT = (FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC)&ProfilingTableDecorator::m_glSamplePatternEXT_profile;
+this->m_names[2427] = "glUniform1f";
+this->m_orig_glUniform1f = this->m_ptr_glUniform1f;
+if(this->m_ptr_glUniform1f)this->m_ptr_glUniform1f = (FunctionTable::MEMBERPFNGLUNIFORM1FPROC)&ProfilingTableDecorator::m_glUniform1f_profile;
+this->m_names[2428] = "glColor4fNormal3fVertex3fSUN";
+this->m_orig_glColor4fNormal3fVertex3fSUN = this->m_ptr_glColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glColor4fNormal3fVertex3fSUN)this->m_ptr_glColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glColor4fNormal3fVertex3fSUN_profile;
+this->m_names[2429] = "glFogCoorddvEXT";
+this->m_orig_glFogCoorddvEXT = this->m_ptr_glFogCoorddvEXT;
+if(this->m_ptr_glFogCoorddvEXT)this->m_ptr_glFogCoorddvEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC)&ProfilingTableDecorator::m_glFogCoorddvEXT_profile;
+this->m_names[2430] = "glCopyTextureImage1DEXT";
+this->m_orig_glCopyTextureImage1DEXT = this->m_ptr_glCopyTextureImage1DEXT;
+if(this->m_ptr_glCopyTextureImage1DEXT)this->m_ptr_glCopyTextureImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTextureImage1DEXT_profile;
+this->m_names[2431] = "glFlushMappedBufferRangeAPPLE";
+this->m_orig_glFlushMappedBufferRangeAPPLE = this->m_ptr_glFlushMappedBufferRangeAPPLE;
+if(this->m_ptr_glFlushMappedBufferRangeAPPLE)this->m_ptr_glFlushMappedBufferRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)&ProfilingTableDecorator::m_glFlushMappedBufferRangeAPPLE_profile;
+this->m_names[2432] = "glVertex3sv";
+this->m_orig_glVertex3sv = this->m_ptr_glVertex3sv;
+if(this->m_ptr_glVertex3sv)this->m_ptr_glVertex3sv = (FunctionTable::MEMBERPFNGLVERTEX3SVPROC)&ProfilingTableDecorator::m_glVertex3sv_profile;
+this->m_names[2433] = "glFlushStaticDataIBM";
+this->m_orig_glFlushStaticDataIBM = this->m_ptr_glFlushStaticDataIBM;
+if(this->m_ptr_glFlushStaticDataIBM)this->m_ptr_glFlushStaticDataIBM = (FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC)&ProfilingTableDecorator::m_glFlushStaticDataIBM_profile;
+this->m_names[2434] = "glProgramUniform4ui64NV";
+this->m_orig_glProgramUniform4ui64NV = this->m_ptr_glProgramUniform4ui64NV;
+if(this->m_ptr_glProgramUniform4ui64NV)this->m_ptr_glProgramUniform4ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64NV_profile;
+this->m_names[2435] = "glRasterPos4xOES";
+this->m_orig_glRasterPos4xOES = this->m_ptr_glRasterPos4xOES;
+if(this->m_ptr_glRasterPos4xOES)this->m_ptr_glRasterPos4xOES = (FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC)&ProfilingTableDecorator::m_glRasterPos4xOES_profile;
+this->m_names[2436] = "glVertexAttribP1ui";
+this->m_orig_glVertexAttribP1ui = this->m_ptr_glVertexAttribP1ui;
+if(this->m_ptr_glVertexAttribP1ui)this->m_ptr_glVertexAttribP1ui = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC)&ProfilingTableDecorator::m_glVertexAttribP1ui_profile;
+this->m_names[2437] = "glProgramUniform4dvEXT";
+this->m_orig_glProgramUniform4dvEXT = this->m_ptr_glProgramUniform4dvEXT;
+if(this->m_ptr_glProgramUniform4dvEXT)this->m_ptr_glProgramUniform4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform4dvEXT_profile;
+this->m_names[2438] = "glEndTransformFeedbackEXT";
+this->m_orig_glEndTransformFeedbackEXT = this->m_ptr_glEndTransformFeedbackEXT;
+if(this->m_ptr_glEndTransformFeedbackEXT)this->m_ptr_glEndTransformFeedbackEXT = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC)&ProfilingTableDecorator::m_glEndTransformFeedbackEXT_profile;
+this->m_names[2439] = "glBinormal3dEXT";
+this->m_orig_glBinormal3dEXT = this->m_ptr_glBinormal3dEXT;
+if(this->m_ptr_glBinormal3dEXT)this->m_ptr_glBinormal3dEXT = (FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC)&ProfilingTableDecorator::m_glBinormal3dEXT_profile;
+this->m_names[2440] = "glGetTextureSubImage";
+this->m_orig_glGetTextureSubImage = this->m_ptr_glGetTextureSubImage;
+if(this->m_ptr_glGetTextureSubImage)this->m_ptr_glGetTextureSubImage = (FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC)&ProfilingTableDecorator::m_glGetTextureSubImage_profile;
+this->m_names[2441] = "glGetNamedRenderbufferParameteriv";
+this->m_orig_glGetNamedRenderbufferParameteriv = this->m_ptr_glGetNamedRenderbufferParameteriv;
+if(this->m_ptr_glGetNamedRenderbufferParameteriv)this->m_ptr_glGetNamedRenderbufferParameteriv = (FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetNamedRenderbufferParameteriv_profile;
+this->m_names[2442] = "glBindBuffersRange";
+this->m_orig_glBindBuffersRange = this->m_ptr_glBindBuffersRange;
+if(this->m_ptr_glBindBuffersRange)this->m_ptr_glBindBuffersRange = (FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC)&ProfilingTableDecorator::m_glBindBuffersRange_profile;
+this->m_names[2443] = "glFinishAsyncSGIX";
+this->m_orig_glFinishAsyncSGIX = this->m_ptr_glFinishAsyncSGIX;
+if(this->m_ptr_glFinishAsyncSGIX)this->m_ptr_glFinishAsyncSGIX = (FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC)&ProfilingTableDecorator::m_glFinishAsyncSGIX_profile;
+this->m_names[2444] = "glBindFragDataLocationIndexed";
+this->m_orig_glBindFragDataLocationIndexed = this->m_ptr_glBindFragDataLocationIndexed;
+if(this->m_ptr_glBindFragDataLocationIndexed)this->m_ptr_glBindFragDataLocationIndexed = (FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC)&ProfilingTableDecorator::m_glBindFragDataLocationIndexed_profile;
+this->m_names[2445] = "glMultiTexCoord2dv";
+this->m_orig_glMultiTexCoord2dv = this->m_ptr_glMultiTexCoord2dv;
+if(this->m_ptr_glMultiTexCoord2dv)this->m_ptr_glMultiTexCoord2dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dv_profile;
+this->m_names[2446] = "glUniform2iv";
+this->m_orig_glUniform2iv = this->m_ptr_glUniform2iv;
+if(this->m_ptr_glUniform2iv)this->m_ptr_glUniform2iv = (FunctionTable::MEMBERPFNGLUNIFORM2IVPROC)&ProfilingTableDecorator::m_glUniform2iv_profile;
+this->m_names[2447] = "glProgramUniform2i64vNV";
+this->m_orig_glProgramUniform2i64vNV = this->m_ptr_glProgramUniform2i64vNV;
+if(this->m_ptr_glProgramUniform2i64vNV)this->m_ptr_glProgramUniform2i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform2i64vNV_profile;
+this->m_names[2448] = "glFlushVertexArrayRangeAPPLE";
+this->m_orig_glFlushVertexArrayRangeAPPLE = this->m_ptr_glFlushVertexArrayRangeAPPLE;
+if(this->m_ptr_glFlushVertexArrayRangeAPPLE)this->m_ptr_glFlushVertexArrayRangeAPPLE = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)&ProfilingTableDecorator::m_glFlushVertexArrayRangeAPPLE_profile;
+this->m_names[2449] = "glTextureParameterf";
+this->m_orig_glTextureParameterf = this->m_ptr_glTextureParameterf;
+if(this->m_ptr_glTextureParameterf)this->m_ptr_glTextureParameterf = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC)&ProfilingTableDecorator::m_glTextureParameterf_profile;
+this->m_names[2450] = "glMultiTexCoord3dvARB";
+this->m_orig_glMultiTexCoord3dvARB = this->m_ptr_glMultiTexCoord3dvARB;
+if(this->m_ptr_glMultiTexCoord3dvARB)this->m_ptr_glMultiTexCoord3dvARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord3dvARB_profile;
+this->m_names[2451] = "glFeedbackBuffer";
+this->m_orig_glFeedbackBuffer = this->m_ptr_glFeedbackBuffer;
+if(this->m_ptr_glFeedbackBuffer)this->m_ptr_glFeedbackBuffer = (FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC)&ProfilingTableDecorator::m_glFeedbackBuffer_profile;
+this->m_names[2452] = "glDebugMessageInsertARB";
+this->m_orig_glDebugMessageInsertARB = this->m_ptr_glDebugMessageInsertARB;
+if(this->m_ptr_glDebugMessageInsertARB)this->m_ptr_glDebugMessageInsertARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC)&ProfilingTableDecorator::m_glDebugMessageInsertARB_profile;
+this->m_names[2453] = "glMultiTexCoord2i";
+this->m_orig_glMultiTexCoord2i = this->m_ptr_glMultiTexCoord2i;
+if(this->m_ptr_glMultiTexCoord2i)this->m_ptr_glMultiTexCoord2i = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC)&ProfilingTableDecorator::m_glMultiTexCoord2i_profile;
+this->m_names[2454] = "glTextureSubImage3D";
+this->m_orig_glTextureSubImage3D = this->m_ptr_glTextureSubImage3D;
+if(this->m_ptr_glTextureSubImage3D)this->m_ptr_glTextureSubImage3D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glTextureSubImage3D_profile;
+this->m_names[2455] = "glFramebufferTexture1D";
+this->m_orig_glFramebufferTexture1D = this->m_ptr_glFramebufferTexture1D;
+if(this->m_ptr_glFramebufferTexture1D)this->m_ptr_glFramebufferTexture1D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC)&ProfilingTableDecorator::m_glFramebufferTexture1D_profile;
+this->m_names[2456] = "glGetShaderiv";
+this->m_orig_glGetShaderiv = this->m_ptr_glGetShaderiv;
+if(this->m_ptr_glGetShaderiv)this->m_ptr_glGetShaderiv = (FunctionTable::MEMBERPFNGLGETSHADERIVPROC)&ProfilingTableDecorator::m_glGetShaderiv_profile;
+this->m_names[2457] = "glMultiTexCoord2d";
+this->m_orig_glMultiTexCoord2d = this->m_ptr_glMultiTexCoord2d;
+if(this->m_ptr_glMultiTexCoord2d)this->m_ptr_glMultiTexCoord2d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC)&ProfilingTableDecorator::m_glMultiTexCoord2d_profile;
+this->m_names[2458] = "glArrayObjectATI";
+this->m_orig_glArrayObjectATI = this->m_ptr_glArrayObjectATI;
+if(this->m_ptr_glArrayObjectATI)this->m_ptr_glArrayObjectATI = (FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC)&ProfilingTableDecorator::m_glArrayObjectATI_profile;
+this->m_names[2459] = "glGetPointeri_vEXT";
+this->m_orig_glGetPointeri_vEXT = this->m_ptr_glGetPointeri_vEXT;
+if(this->m_ptr_glGetPointeri_vEXT)this->m_ptr_glGetPointeri_vEXT = (FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC)&ProfilingTableDecorator::m_glGetPointeri_vEXT_profile;
+this->m_names[2460] = "glGetPerfMonitorCountersAMD";
+this->m_orig_glGetPerfMonitorCountersAMD = this->m_ptr_glGetPerfMonitorCountersAMD;
+if(this->m_ptr_glGetPerfMonitorCountersAMD)this->m_ptr_glGetPerfMonitorCountersAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCountersAMD_profile;
+this->m_names[2461] = "glNamedBufferStorage";
+this->m_orig_glNamedBufferStorage = this->m_ptr_glNamedBufferStorage;
+if(this->m_ptr_glNamedBufferStorage)this->m_ptr_glNamedBufferStorage = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC)&ProfilingTableDecorator::m_glNamedBufferStorage_profile;
+this->m_names[2462] = "glTexEnvxvOES";
+this->m_orig_glTexEnvxvOES = this->m_ptr_glTexEnvxvOES;
+if(this->m_ptr_glTexEnvxvOES)this->m_ptr_glTexEnvxvOES = (FunctionTable::MEMBERPFNGLTEXENVXVOESPROC)&ProfilingTableDecorator::m_glTexEnvxvOES_profile;
+this->m_names[2463] = "glProgramUniform2ui64NV";
+this->m_orig_glProgramUniform2ui64NV = this->m_ptr_glProgramUniform2ui64NV;
+if(this->m_ptr_glProgramUniform2ui64NV)this->m_ptr_glProgramUniform2ui64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64NV_profile;
+this->m_names[2464] = "glMultiTexCoord3bOES";
+this->m_orig_glMultiTexCoord3bOES = this->m_ptr_glMultiTexCoord3bOES;
+if(this->m_ptr_glMultiTexCoord3bOES)this->m_ptr_glMultiTexCoord3bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3bOES_profile;
+this->m_names[2465] = "glUniform1dv";
+this->m_orig_glUniform1dv = this->m_ptr_glUniform1dv;
+if(this->m_ptr_glUniform1dv)this->m_ptr_glUniform1dv = (FunctionTable::MEMBERPFNGLUNIFORM1DVPROC)&ProfilingTableDecorator::m_glUniform1dv_profile;
+this->m_names[2466] = "glPixelTransferi";
+this->m_orig_glPixelTransferi = this->m_ptr_glPixelTransferi;
+if(this->m_ptr_glPixelTransferi)this->m_ptr_glPixelTransferi = (FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC)&ProfilingTableDecorator::m_glPixelTransferi_profile;
+this->m_names[2467] = "glSecondaryColor3usvEXT";
+this->m_orig_glSecondaryColor3usvEXT = this->m_ptr_glSecondaryColor3usvEXT;
+if(this->m_ptr_glSecondaryColor3usvEXT)this->m_ptr_glSecondaryColor3usvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3usvEXT_profile;
+this->m_names[2468] = "glProgramEnvParameterI4uivNV";
+this->m_orig_glProgramEnvParameterI4uivNV = this->m_ptr_glProgramEnvParameterI4uivNV;
+if(this->m_ptr_glProgramEnvParameterI4uivNV)this->m_ptr_glProgramEnvParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramEnvParameterI4uivNV_profile;
+this->m_names[2469] = "glVertex2sv";
+this->m_orig_glVertex2sv = this->m_ptr_glVertex2sv;
+if(this->m_ptr_glVertex2sv)this->m_ptr_glVertex2sv = (FunctionTable::MEMBERPFNGLVERTEX2SVPROC)&ProfilingTableDecorator::m_glVertex2sv_profile;
+this->m_names[2470] = "glWindowPos4dMESA";
+this->m_orig_glWindowPos4dMESA = this->m_ptr_glWindowPos4dMESA;
+if(this->m_ptr_glWindowPos4dMESA)this->m_ptr_glWindowPos4dMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC)&ProfilingTableDecorator::m_glWindowPos4dMESA_profile;
+this->m_names[2471] = "glDebugMessageControlARB";
+this->m_orig_glDebugMessageControlARB = this->m_ptr_glDebugMessageControlARB;
+if(this->m_ptr_glDebugMessageControlARB)this->m_ptr_glDebugMessageControlARB = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC)&ProfilingTableDecorator::m_glDebugMessageControlARB_profile;
+this->m_names[2472] = "glIsTextureEXT";
+this->m_orig_glIsTextureEXT = this->m_ptr_glIsTextureEXT;
+if(this->m_ptr_glIsTextureEXT)this->m_ptr_glIsTextureEXT = (FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC)&ProfilingTableDecorator::m_glIsTextureEXT_profile;
+this->m_names[2473] = "glFragmentMaterialivSGIX";
+this->m_orig_glFragmentMaterialivSGIX = this->m_ptr_glFragmentMaterialivSGIX;
+if(this->m_ptr_glFragmentMaterialivSGIX)this->m_ptr_glFragmentMaterialivSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialivSGIX_profile;
+this->m_names[2474] = "glLinkProgramARB";
+this->m_orig_glLinkProgramARB = this->m_ptr_glLinkProgramARB;
+if(this->m_ptr_glLinkProgramARB)this->m_ptr_glLinkProgramARB = (FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC)&ProfilingTableDecorator::m_glLinkProgramARB_profile;
+this->m_names[2475] = "glFinishFenceAPPLE";
+this->m_orig_glFinishFenceAPPLE = this->m_ptr_glFinishFenceAPPLE;
+if(this->m_ptr_glFinishFenceAPPLE)this->m_ptr_glFinishFenceAPPLE = (FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC)&ProfilingTableDecorator::m_glFinishFenceAPPLE_profile;
+this->m_names[2476] = "glVertexArrayVertexAttribBindingEXT";
+this->m_orig_glVertexArrayVertexAttribBindingEXT = this->m_ptr_glVertexArrayVertexAttribBindingEXT;
+if(this->m_ptr_glVertexArrayVertexAttribBindingEXT)this->m_ptr_glVertexArrayVertexAttribBindingEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribBindingEXT_profile;
+this->m_names[2477] = "glTexStorageMem3DMultisampleEXT";
+this->m_orig_glTexStorageMem3DMultisampleEXT = this->m_ptr_glTexStorageMem3DMultisampleEXT;
+if(this->m_ptr_glTexStorageMem3DMultisampleEXT)this->m_ptr_glTexStorageMem3DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTexStorageMem3DMultisampleEXT_profile;
+this->m_names[2478] = "glUniform1ui64vARB";
+this->m_orig_glUniform1ui64vARB = this->m_ptr_glUniform1ui64vARB;
+if(this->m_ptr_glUniform1ui64vARB)this->m_ptr_glUniform1ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC)&ProfilingTableDecorator::m_glUniform1ui64vARB_profile;
+this->m_names[2479] = "glMultiTexCoord4fv";
+this->m_orig_glMultiTexCoord4fv = this->m_ptr_glMultiTexCoord4fv;
+if(this->m_ptr_glMultiTexCoord4fv)this->m_ptr_glMultiTexCoord4fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4fv_profile;
+this->m_names[2480] = "glMulticastFramebufferSampleLocationsfvNV";
+this->m_orig_glMulticastFramebufferSampleLocationsfvNV = this->m_ptr_glMulticastFramebufferSampleLocationsfvNV;
+if(this->m_ptr_glMulticastFramebufferSampleLocationsfvNV)this->m_ptr_glMulticastFramebufferSampleLocationsfvNV = (FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)&ProfilingTableDecorator::m_glMulticastFramebufferSampleLocationsfvNV_profile;
+this->m_names[2481] = "glRasterPos3d";
+this->m_orig_glRasterPos3d = this->m_ptr_glRasterPos3d;
+if(this->m_ptr_glRasterPos3d)this->m_ptr_glRasterPos3d = (FunctionTable::MEMBERPFNGLRASTERPOS3DPROC)&ProfilingTableDecorator::m_glRasterPos3d_profile;
+this->m_names[2482] = "glPollAsyncSGIX";
+this->m_orig_glPollAsyncSGIX = this->m_ptr_glPollAsyncSGIX;
+if(this->m_ptr_glPollAsyncSGIX)this->m_ptr_glPollAsyncSGIX = (FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC)&ProfilingTableDecorator::m_glPollAsyncSGIX_profile;
+this->m_names[2483] = "glRasterPos3f";
+this->m_orig_glRasterPos3f = this->m_ptr_glRasterPos3f;
+if(this->m_ptr_glRasterPos3f)this->m_ptr_glRasterPos3f = (FunctionTable::MEMBERPFNGLRASTERPOS3FPROC)&ProfilingTableDecorator::m_glRasterPos3f_profile;
+this->m_names[2484] = "glCompressedTexImage3D";
+this->m_orig_glCompressedTexImage3D = this->m_ptr_glCompressedTexImage3D;
+if(this->m_ptr_glCompressedTexImage3D)this->m_ptr_glCompressedTexImage3D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC)&ProfilingTableDecorator::m_glCompressedTexImage3D_profile;
+this->m_names[2485] = "glVariantivEXT";
+this->m_orig_glVariantivEXT = this->m_ptr_glVariantivEXT;
+if(this->m_ptr_glVariantivEXT)this->m_ptr_glVariantivEXT = (FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC)&ProfilingTableDecorator::m_glVariantivEXT_profile;
+this->m_names[2486] = "glUnmapTexture2DINTEL";
+this->m_orig_glUnmapTexture2DINTEL = this->m_ptr_glUnmapTexture2DINTEL;
+if(this->m_ptr_glUnmapTexture2DINTEL)this->m_ptr_glUnmapTexture2DINTEL = (FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC)&ProfilingTableDecorator::m_glUnmapTexture2DINTEL_profile;
+this->m_names[2487] = "glMulticastWaitSyncNV";
+this->m_orig_glMulticastWaitSyncNV = this->m_ptr_glMulticastWaitSyncNV;
+if(this->m_ptr_glMulticastWaitSyncNV)this->m_ptr_glMulticastWaitSyncNV = (FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC)&ProfilingTableDecorator::m_glMulticastWaitSyncNV_profile;
+this->m_names[2488] = "glGetVertexAttribiv";
+this->m_orig_glGetVertexAttribiv = this->m_ptr_glGetVertexAttribiv;
+if(this->m_ptr_glGetVertexAttribiv)this->m_ptr_glGetVertexAttribiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribiv_profile;
+this->m_names[2489] = "glGetPathCoordsNV";
+this->m_orig_glGetPathCoordsNV = this->m_ptr_glGetPathCoordsNV;
+if(this->m_ptr_glGetPathCoordsNV)this->m_ptr_glGetPathCoordsNV = (FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC)&ProfilingTableDecorator::m_glGetPathCoordsNV_profile;
+this->m_names[2490] = "glColor4xvOES";
+this->m_orig_glColor4xvOES = this->m_ptr_glColor4xvOES;
+if(this->m_ptr_glColor4xvOES)this->m_ptr_glColor4xvOES = (FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC)&ProfilingTableDecorator::m_glColor4xvOES_profile;
+this->m_names[2491] = "glVertexAttrib3fv";
+this->m_orig_glVertexAttrib3fv = this->m_ptr_glVertexAttrib3fv;
+if(this->m_ptr_glVertexAttrib3fv)this->m_ptr_glVertexAttrib3fv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC)&ProfilingTableDecorator::m_glVertexAttrib3fv_profile;
+this->m_names[2492] = "glRasterPos3s";
+this->m_orig_glRasterPos3s = this->m_ptr_glRasterPos3s;
+if(this->m_ptr_glRasterPos3s)this->m_ptr_glRasterPos3s = (FunctionTable::MEMBERPFNGLRASTERPOS3SPROC)&ProfilingTableDecorator::m_glRasterPos3s_profile;
+this->m_names[2493] = "glVertex4bOES";
+this->m_orig_glVertex4bOES = this->m_ptr_glVertex4bOES;
+if(this->m_ptr_glVertex4bOES)this->m_ptr_glVertex4bOES = (FunctionTable::MEMBERPFNGLVERTEX4BOESPROC)&ProfilingTableDecorator::m_glVertex4bOES_profile;
+this->m_names[2494] = "glTransformFeedbackVaryingsEXT";
+this->m_orig_glTransformFeedbackVaryingsEXT = this->m_ptr_glTransformFeedbackVaryingsEXT;
+if(this->m_ptr_glTransformFeedbackVaryingsEXT)this->m_ptr_glTransformFeedbackVaryingsEXT = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)&ProfilingTableDecorator::m_glTransformFeedbackVaryingsEXT_profile;
+this->m_names[2495] = "glCombinerOutputNV";
+this->m_orig_glCombinerOutputNV = this->m_ptr_glCombinerOutputNV;
+if(this->m_ptr_glCombinerOutputNV)this->m_ptr_glCombinerOutputNV = (FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC)&ProfilingTableDecorator::m_glCombinerOutputNV_profile;
+this->m_names[2496] = "glWindowPos4sMESA";
+this->m_orig_glWindowPos4sMESA = this->m_ptr_glWindowPos4sMESA;
+if(this->m_ptr_glWindowPos4sMESA)this->m_ptr_glWindowPos4sMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC)&ProfilingTableDecorator::m_glWindowPos4sMESA_profile;
+this->m_names[2497] = "glVertexAttrib4svARB";
+this->m_orig_glVertexAttrib4svARB = this->m_ptr_glVertexAttrib4svARB;
+if(this->m_ptr_glVertexAttrib4svARB)this->m_ptr_glVertexAttrib4svARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4svARB_profile;
+this->m_names[2498] = "glIsList";
+this->m_orig_glIsList = this->m_ptr_glIsList;
+if(this->m_ptr_glIsList)this->m_ptr_glIsList = (FunctionTable::MEMBERPFNGLISLISTPROC)&ProfilingTableDecorator::m_glIsList_profile;
+this->m_names[2499] = "glGetInfoLogARB";
+this->m_orig_glGetInfoLogARB = this->m_ptr_glGetInfoLogARB;
+if(this->m_ptr_glGetInfoLogARB)this->m_ptr_glGetInfoLogARB = (FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC)&ProfilingTableDecorator::m_glGetInfoLogARB_profile;
+this->m_names[2500] = "glUniformMatrix2fv";
+this->m_orig_glUniformMatrix2fv = this->m_ptr_glUniformMatrix2fv;
+if(this->m_ptr_glUniformMatrix2fv)this->m_ptr_glUniformMatrix2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix2fv_profile;
+this->m_names[2501] = "glVertexAttribs3dvNV";
+this->m_orig_glVertexAttribs3dvNV = this->m_ptr_glVertexAttribs3dvNV;
+if(this->m_ptr_glVertexAttribs3dvNV)this->m_ptr_glVertexAttribs3dvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3dvNV_profile;
+this->m_names[2502] = "glGlobalAlphaFactorsSUN";
+this->m_orig_glGlobalAlphaFactorsSUN = this->m_ptr_glGlobalAlphaFactorsSUN;
+if(this->m_ptr_glGlobalAlphaFactorsSUN)this->m_ptr_glGlobalAlphaFactorsSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactorsSUN_profile;
+this->m_names[2503] = "glGetTrackMatrixivNV";
+this->m_orig_glGetTrackMatrixivNV = this->m_ptr_glGetTrackMatrixivNV;
+if(this->m_ptr_glGetTrackMatrixivNV)this->m_ptr_glGetTrackMatrixivNV = (FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC)&ProfilingTableDecorator::m_glGetTrackMatrixivNV_profile;
+this->m_names[2504] = "glTextureParameterfvEXT";
+this->m_orig_glTextureParameterfvEXT = this->m_ptr_glTextureParameterfvEXT;
+if(this->m_ptr_glTextureParameterfvEXT)this->m_ptr_glTextureParameterfvEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterfvEXT_profile;
+this->m_names[2505] = "glIsNamedBufferResidentNV";
+this->m_orig_glIsNamedBufferResidentNV = this->m_ptr_glIsNamedBufferResidentNV;
+if(this->m_ptr_glIsNamedBufferResidentNV)this->m_ptr_glIsNamedBufferResidentNV = (FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC)&ProfilingTableDecorator::m_glIsNamedBufferResidentNV_profile;
+this->m_names[2506] = "glProgramUniform4ui64vARB";
+this->m_orig_glProgramUniform4ui64vARB = this->m_ptr_glProgramUniform4ui64vARB;
+if(this->m_ptr_glProgramUniform4ui64vARB)this->m_ptr_glProgramUniform4ui64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform4ui64vARB_profile;
+this->m_names[2507] = "glTbufferMask3DFX";
+this->m_orig_glTbufferMask3DFX = this->m_ptr_glTbufferMask3DFX;
+if(this->m_ptr_glTbufferMask3DFX)this->m_ptr_glTbufferMask3DFX = (FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC)&ProfilingTableDecorator::m_glTbufferMask3DFX_profile;
+this->m_names[2508] = "glCoverFillPathNV";
+this->m_orig_glCoverFillPathNV = this->m_ptr_glCoverFillPathNV;
+if(this->m_ptr_glCoverFillPathNV)this->m_ptr_glCoverFillPathNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC)&ProfilingTableDecorator::m_glCoverFillPathNV_profile;
+this->m_names[2509] = "glVertexAttrib1fvARB";
+this->m_orig_glVertexAttrib1fvARB = this->m_ptr_glVertexAttrib1fvARB;
+if(this->m_ptr_glVertexAttrib1fvARB)this->m_ptr_glVertexAttrib1fvARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1fvARB_profile;
+this->m_names[2510] = "glGenerateTextureMipmap";
+this->m_orig_glGenerateTextureMipmap = this->m_ptr_glGenerateTextureMipmap;
+if(this->m_ptr_glGenerateTextureMipmap)this->m_ptr_glGenerateTextureMipmap = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC)&ProfilingTableDecorator::m_glGenerateTextureMipmap_profile;
+this->m_names[2511] = "glNamedProgramLocalParameterI4uivEXT";
+this->m_orig_glNamedProgramLocalParameterI4uivEXT = this->m_ptr_glNamedProgramLocalParameterI4uivEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4uivEXT)this->m_ptr_glNamedProgramLocalParameterI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4uivEXT_profile;
+this->m_names[2512] = "glMultiDrawElementsBaseVertex";
+this->m_orig_glMultiDrawElementsBaseVertex = this->m_ptr_glMultiDrawElementsBaseVertex;
+if(this->m_ptr_glMultiDrawElementsBaseVertex)this->m_ptr_glMultiDrawElementsBaseVertex = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)&ProfilingTableDecorator::m_glMultiDrawElementsBaseVertex_profile;
+this->m_names[2513] = "glProgramSubroutineParametersuivNV";
+this->m_orig_glProgramSubroutineParametersuivNV = this->m_ptr_glProgramSubroutineParametersuivNV;
+if(this->m_ptr_glProgramSubroutineParametersuivNV)this->m_ptr_glProgramSubroutineParametersuivNV = (FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC)&ProfilingTableDecorator::m_glProgramSubroutineParametersuivNV_profile;
+this->m_names[2514] = "glProgramUniformMatrix2x4dvEXT";
+this->m_orig_glProgramUniformMatrix2x4dvEXT = this->m_ptr_glProgramUniformMatrix2x4dvEXT;
+if(this->m_ptr_glProgramUniformMatrix2x4dvEXT)this->m_ptr_glProgramUniformMatrix2x4dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2x4dvEXT_profile;
+this->m_names[2515] = "glRotatexOES";
+this->m_orig_glRotatexOES = this->m_ptr_glRotatexOES;
+if(this->m_ptr_glRotatexOES)this->m_ptr_glRotatexOES = (FunctionTable::MEMBERPFNGLROTATEXOESPROC)&ProfilingTableDecorator::m_glRotatexOES_profile;
+this->m_names[2516] = "glMemoryBarrierEXT";
+this->m_orig_glMemoryBarrierEXT = this->m_ptr_glMemoryBarrierEXT;
+if(this->m_ptr_glMemoryBarrierEXT)this->m_ptr_glMemoryBarrierEXT = (FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC)&ProfilingTableDecorator::m_glMemoryBarrierEXT_profile;
+this->m_names[2517] = "glVertexAttrib3svNV";
+this->m_orig_glVertexAttrib3svNV = this->m_ptr_glVertexAttrib3svNV;
+if(this->m_ptr_glVertexAttrib3svNV)this->m_ptr_glVertexAttrib3svNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3svNV_profile;
+this->m_names[2518] = "glVertexStream3iATI";
+this->m_orig_glVertexStream3iATI = this->m_ptr_glVertexStream3iATI;
+if(this->m_ptr_glVertexStream3iATI)this->m_ptr_glVertexStream3iATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC)&ProfilingTableDecorator::m_glVertexStream3iATI_profile;
+this->m_names[2519] = "glCompressedTexSubImage1D";
+this->m_orig_glCompressedTexSubImage1D = this->m_ptr_glCompressedTexSubImage1D;
+if(this->m_ptr_glCompressedTexSubImage1D)this->m_ptr_glCompressedTexSubImage1D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage1D_profile;
+this->m_names[2520] = "glSetFenceNV";
+this->m_orig_glSetFenceNV = this->m_ptr_glSetFenceNV;
+if(this->m_ptr_glSetFenceNV)this->m_ptr_glSetFenceNV = (FunctionTable::MEMBERPFNGLSETFENCENVPROC)&ProfilingTableDecorator::m_glSetFenceNV_profile;
+this->m_names[2521] = "glAttachObjectARB";
+this->m_orig_glAttachObjectARB = this->m_ptr_glAttachObjectARB;
+if(this->m_ptr_glAttachObjectARB)this->m_ptr_glAttachObjectARB = (FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC)&ProfilingTableDecorator::m_glAttachObjectARB_profile;
+this->m_names[2522] = "glCopyConvolutionFilter1D";
+this->m_orig_glCopyConvolutionFilter1D = this->m_ptr_glCopyConvolutionFilter1D;
+if(this->m_ptr_glCopyConvolutionFilter1D)this->m_ptr_glCopyConvolutionFilter1D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter1D_profile;
+this->m_names[2523] = "glTexStorageMem2DMultisampleEXT";
+this->m_orig_glTexStorageMem2DMultisampleEXT = this->m_ptr_glTexStorageMem2DMultisampleEXT;
+if(this->m_ptr_glTexStorageMem2DMultisampleEXT)this->m_ptr_glTexStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTexStorageMem2DMultisampleEXT_profile;
+this->m_names[2524] = "glProgramParameters4fvNV";
+this->m_orig_glProgramParameters4fvNV = this->m_ptr_glProgramParameters4fvNV;
+if(this->m_ptr_glProgramParameters4fvNV)this->m_ptr_glProgramParameters4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC)&ProfilingTableDecorator::m_glProgramParameters4fvNV_profile;
+this->m_names[2525] = "glNamedFramebufferParameteriEXT";
+this->m_orig_glNamedFramebufferParameteriEXT = this->m_ptr_glNamedFramebufferParameteriEXT;
+if(this->m_ptr_glNamedFramebufferParameteriEXT)this->m_ptr_glNamedFramebufferParameteriEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferParameteriEXT_profile;
+this->m_names[2526] = "glVertexAttrib4Nsv";
+this->m_orig_glVertexAttrib4Nsv = this->m_ptr_glVertexAttrib4Nsv;
+if(this->m_ptr_glVertexAttrib4Nsv)this->m_ptr_glVertexAttrib4Nsv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC)&ProfilingTableDecorator::m_glVertexAttrib4Nsv_profile;
+this->m_names[2527] = "glVertexAttribI4usvEXT";
+this->m_orig_glVertexAttribI4usvEXT = this->m_ptr_glVertexAttribI4usvEXT;
+if(this->m_ptr_glVertexAttribI4usvEXT)this->m_ptr_glVertexAttribI4usvEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI4usvEXT_profile;
+this->m_names[2528] = "glTextureBufferRangeEXT";
+this->m_orig_glTextureBufferRangeEXT = this->m_ptr_glTextureBufferRangeEXT;
+if(this->m_ptr_glTextureBufferRangeEXT)this->m_ptr_glTextureBufferRangeEXT = (FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC)&ProfilingTableDecorator::m_glTextureBufferRangeEXT_profile;
+this->m_names[2529] = "glVertexP3uiv";
+this->m_orig_glVertexP3uiv = this->m_ptr_glVertexP3uiv;
+if(this->m_ptr_glVertexP3uiv)this->m_ptr_glVertexP3uiv = (FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC)&ProfilingTableDecorator::m_glVertexP3uiv_profile;
+this->m_names[2530] = "glIsPathNV";
+this->m_orig_glIsPathNV = this->m_ptr_glIsPathNV;
+if(this->m_ptr_glIsPathNV)this->m_ptr_glIsPathNV = (FunctionTable::MEMBERPFNGLISPATHNVPROC)&ProfilingTableDecorator::m_glIsPathNV_profile;
+this->m_names[2531] = "glGetnUniformi64vARB";
+this->m_orig_glGetnUniformi64vARB = this->m_ptr_glGetnUniformi64vARB;
+if(this->m_ptr_glGetnUniformi64vARB)this->m_ptr_glGetnUniformi64vARB = (FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC)&ProfilingTableDecorator::m_glGetnUniformi64vARB_profile;
+this->m_names[2532] = "glFramebufferTextureMultiviewOVR";
+this->m_orig_glFramebufferTextureMultiviewOVR = this->m_ptr_glFramebufferTextureMultiviewOVR;
+if(this->m_ptr_glFramebufferTextureMultiviewOVR)this->m_ptr_glFramebufferTextureMultiviewOVR = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC)&ProfilingTableDecorator::m_glFramebufferTextureMultiviewOVR_profile;
+this->m_names[2533] = "glCompressedMultiTexSubImage2DEXT";
+this->m_orig_glCompressedMultiTexSubImage2DEXT = this->m_ptr_glCompressedMultiTexSubImage2DEXT;
+if(this->m_ptr_glCompressedMultiTexSubImage2DEXT)this->m_ptr_glCompressedMultiTexSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedMultiTexSubImage2DEXT_profile;
+this->m_names[2534] = "glGetnMapdv";
+this->m_orig_glGetnMapdv = this->m_ptr_glGetnMapdv;
+if(this->m_ptr_glGetnMapdv)this->m_ptr_glGetnMapdv = (FunctionTable::MEMBERPFNGLGETNMAPDVPROC)&ProfilingTableDecorator::m_glGetnMapdv_profile;
+this->m_names[2535] = "glDebugMessageCallback";
+this->m_orig_glDebugMessageCallback = this->m_ptr_glDebugMessageCallback;
+if(this->m_ptr_glDebugMessageCallback)this->m_ptr_glDebugMessageCallback = (FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC)&ProfilingTableDecorator::m_glDebugMessageCallback_profile;
+this->m_names[2536] = "glTangent3svEXT";
+this->m_orig_glTangent3svEXT = this->m_ptr_glTangent3svEXT;
+if(this->m_ptr_glTangent3svEXT)this->m_ptr_glTangent3svEXT = (FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC)&ProfilingTableDecorator::m_glTangent3svEXT_profile;
+this->m_names[2537] = "glVertexAttribParameteriAMD";
+this->m_orig_glVertexAttribParameteriAMD = this->m_ptr_glVertexAttribParameteriAMD;
+if(this->m_ptr_glVertexAttribParameteriAMD)this->m_ptr_glVertexAttribParameteriAMD = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC)&ProfilingTableDecorator::m_glVertexAttribParameteriAMD_profile;
+this->m_names[2538] = "glBufferSubDataARB";
+this->m_orig_glBufferSubDataARB = this->m_ptr_glBufferSubDataARB;
+if(this->m_ptr_glBufferSubDataARB)this->m_ptr_glBufferSubDataARB = (FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC)&ProfilingTableDecorator::m_glBufferSubDataARB_profile;
+this->m_names[2539] = "glGetVertexAttribLui64vARB";
+this->m_orig_glGetVertexAttribLui64vARB = this->m_ptr_glGetVertexAttribLui64vARB;
+if(this->m_ptr_glGetVertexAttribLui64vARB)this->m_ptr_glGetVertexAttribLui64vARB = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC)&ProfilingTableDecorator::m_glGetVertexAttribLui64vARB_profile;
+this->m_names[2540] = "glVertexAttribL4ui64NV";
+this->m_orig_glVertexAttribL4ui64NV = this->m_ptr_glVertexAttribL4ui64NV;
+if(this->m_ptr_glVertexAttribL4ui64NV)this->m_ptr_glVertexAttribL4ui64NV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC)&ProfilingTableDecorator::m_glVertexAttribL4ui64NV_profile;
+this->m_names[2541] = "glReplacementCodeuiColor4ubVertex3fSUN";
+this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN = this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN)this->m_ptr_glReplacementCodeuiColor4ubVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiColor4ubVertex3fSUN_profile;
+this->m_names[2542] = "glImageTransformParameterfHP";
+this->m_orig_glImageTransformParameterfHP = this->m_ptr_glImageTransformParameterfHP;
+if(this->m_ptr_glImageTransformParameterfHP)this->m_ptr_glImageTransformParameterfHP = (FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC)&ProfilingTableDecorator::m_glImageTransformParameterfHP_profile;
+this->m_names[2543] = "glMap1f";
+this->m_orig_glMap1f = this->m_ptr_glMap1f;
+if(this->m_ptr_glMap1f)this->m_ptr_glMap1f = (FunctionTable::MEMBERPFNGLMAP1FPROC)&ProfilingTableDecorator::m_glMap1f_profile;
+this->m_names[2544] = "glRasterPos4fv";
+this->m_orig_glRasterPos4fv = this->m_ptr_glRasterPos4fv;
+if(this->m_ptr_glRasterPos4fv)this->m_ptr_glRasterPos4fv = (FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC)&ProfilingTableDecorator::m_glRasterPos4fv_profile;
+this->m_names[2545] = "glVertex2bvOES";
+this->m_orig_glVertex2bvOES = this->m_ptr_glVertex2bvOES;
+if(this->m_ptr_glVertex2bvOES)this->m_ptr_glVertex2bvOES = (FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC)&ProfilingTableDecorator::m_glVertex2bvOES_profile;
+this->m_names[2546] = "glGetMapControlPointsNV";
+this->m_orig_glGetMapControlPointsNV = this->m_ptr_glGetMapControlPointsNV;
+if(this->m_ptr_glGetMapControlPointsNV)this->m_ptr_glGetMapControlPointsNV = (FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC)&ProfilingTableDecorator::m_glGetMapControlPointsNV_profile;
+this->m_names[2547] = "glNamedProgramLocalParametersI4ivEXT";
+this->m_orig_glNamedProgramLocalParametersI4ivEXT = this->m_ptr_glNamedProgramLocalParametersI4ivEXT;
+if(this->m_ptr_glNamedProgramLocalParametersI4ivEXT)this->m_ptr_glNamedProgramLocalParametersI4ivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParametersI4ivEXT_profile;
+this->m_names[2548] = "glBindBufferRangeNV";
+this->m_orig_glBindBufferRangeNV = this->m_ptr_glBindBufferRangeNV;
+if(this->m_ptr_glBindBufferRangeNV)this->m_ptr_glBindBufferRangeNV = (FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC)&ProfilingTableDecorator::m_glBindBufferRangeNV_profile;
+this->m_names[2549] = "glVertexStream3dvATI";
+this->m_orig_glVertexStream3dvATI = this->m_ptr_glVertexStream3dvATI;
+if(this->m_ptr_glVertexStream3dvATI)this->m_ptr_glVertexStream3dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC)&ProfilingTableDecorator::m_glVertexStream3dvATI_profile;
+this->m_names[2550] = "glNormalPointerListIBM";
+this->m_orig_glNormalPointerListIBM = this->m_ptr_glNormalPointerListIBM;
+if(this->m_ptr_glNormalPointerListIBM)this->m_ptr_glNormalPointerListIBM = (FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC)&ProfilingTableDecorator::m_glNormalPointerListIBM_profile;
+this->m_names[2551] = "glFogFuncSGIS";
+this->m_orig_glFogFuncSGIS = this->m_ptr_glFogFuncSGIS;
+if(this->m_ptr_glFogFuncSGIS)this->m_ptr_glFogFuncSGIS = (FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC)&ProfilingTableDecorator::m_glFogFuncSGIS_profile;
+this->m_names[2552] = "glMultiModeDrawArraysIBM";
+this->m_orig_glMultiModeDrawArraysIBM = this->m_ptr_glMultiModeDrawArraysIBM;
+if(this->m_ptr_glMultiModeDrawArraysIBM)this->m_ptr_glMultiModeDrawArraysIBM = (FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC)&ProfilingTableDecorator::m_glMultiModeDrawArraysIBM_profile;
+this->m_names[2553] = "glGetNamedFramebufferAttachmentParameterivEXT";
+this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT = this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT;
+if(this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT)this->m_ptr_glGetNamedFramebufferAttachmentParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferAttachmentParameterivEXT_profile;
+this->m_names[2554] = "glGetFloatv";
+this->m_orig_glGetFloatv = this->m_ptr_glGetFloatv;
+if(this->m_ptr_glGetFloatv)this->m_ptr_glGetFloatv = (FunctionTable::MEMBERPFNGLGETFLOATVPROC)&ProfilingTableDecorator::m_glGetFloatv_profile;
+this->m_names[2555] = "glVertexArrayVertexAttribIFormatEXT";
+this->m_orig_glVertexArrayVertexAttribIFormatEXT = this->m_ptr_glVertexArrayVertexAttribIFormatEXT;
+if(this->m_ptr_glVertexArrayVertexAttribIFormatEXT)this->m_ptr_glVertexArrayVertexAttribIFormatEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)&ProfilingTableDecorator::m_glVertexArrayVertexAttribIFormatEXT_profile;
+this->m_names[2556] = "glHint";
+this->m_orig_glHint = this->m_ptr_glHint;
+if(this->m_ptr_glHint)this->m_ptr_glHint = (FunctionTable::MEMBERPFNGLHINTPROC)&ProfilingTableDecorator::m_glHint_profile;
+this->m_names[2557] = "glVertexStream2svATI";
+this->m_orig_glVertexStream2svATI = this->m_ptr_glVertexStream2svATI;
+if(this->m_ptr_glVertexStream2svATI)this->m_ptr_glVertexStream2svATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC)&ProfilingTableDecorator::m_glVertexStream2svATI_profile;
+this->m_names[2558] = "glMultiDrawArraysIndirect";
+this->m_orig_glMultiDrawArraysIndirect = this->m_ptr_glMultiDrawArraysIndirect;
+if(this->m_ptr_glMultiDrawArraysIndirect)this->m_ptr_glMultiDrawArraysIndirect = (FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC)&ProfilingTableDecorator::m_glMultiDrawArraysIndirect_profile;
+this->m_names[2559] = "glMultiTexEnvfvEXT";
+this->m_orig_glMultiTexEnvfvEXT = this->m_ptr_glMultiTexEnvfvEXT;
+if(this->m_ptr_glMultiTexEnvfvEXT)this->m_ptr_glMultiTexEnvfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexEnvfvEXT_profile;
+this->m_names[2560] = "glVertexAttribP2uiv";
+this->m_orig_glVertexAttribP2uiv = this->m_ptr_glVertexAttribP2uiv;
+if(this->m_ptr_glVertexAttribP2uiv)this->m_ptr_glVertexAttribP2uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC)&ProfilingTableDecorator::m_glVertexAttribP2uiv_profile;
+this->m_names[2561] = "glProgramUniform1i64vARB";
+this->m_orig_glProgramUniform1i64vARB = this->m_ptr_glProgramUniform1i64vARB;
+if(this->m_ptr_glProgramUniform1i64vARB)this->m_ptr_glProgramUniform1i64vARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC)&ProfilingTableDecorator::m_glProgramUniform1i64vARB_profile;
+this->m_names[2562] = "glFramebufferTextureARB";
+this->m_orig_glFramebufferTextureARB = this->m_ptr_glFramebufferTextureARB;
+if(this->m_ptr_glFramebufferTextureARB)this->m_ptr_glFramebufferTextureARB = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC)&ProfilingTableDecorator::m_glFramebufferTextureARB_profile;
+this->m_names[2563] = "glPushClientAttribDefaultEXT";
+this->m_orig_glPushClientAttribDefaultEXT = this->m_ptr_glPushClientAttribDefaultEXT;
+if(this->m_ptr_glPushClientAttribDefaultEXT)this->m_ptr_glPushClientAttribDefaultEXT = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)&ProfilingTableDecorator::m_glPushClientAttribDefaultEXT_profile;
+this->m_names[2564] = "glScalef";
+this->m_orig_glScalef = this->m_ptr_glScalef;
+if(this->m_ptr_glScalef)this->m_ptr_glScalef = (FunctionTable::MEMBERPFNGLSCALEFPROC)&ProfilingTableDecorator::m_glScalef_profile;
+this->m_names[2565] = "glScaled";
+this->m_orig_glScaled = this->m_ptr_glScaled;
+if(this->m_ptr_glScaled)this->m_ptr_glScaled = (FunctionTable::MEMBERPFNGLSCALEDPROC)&ProfilingTableDecorator::m_glScaled_profile;
+this->m_names[2566] = "glGetConvolutionParameterxvOES";
+this->m_orig_glGetConvolutionParameterxvOES = this->m_ptr_glGetConvolutionParameterxvOES;
+if(this->m_ptr_glGetConvolutionParameterxvOES)this->m_ptr_glGetConvolutionParameterxvOES = (FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC)&ProfilingTableDecorator::m_glGetConvolutionParameterxvOES_profile;
+this->m_names[2567] = "glGetProgramResourceName";
+this->m_orig_glGetProgramResourceName = this->m_ptr_glGetProgramResourceName;
+if(this->m_ptr_glGetProgramResourceName)this->m_ptr_glGetProgramResourceName = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC)&ProfilingTableDecorator::m_glGetProgramResourceName_profile;
+this->m_names[2568] = "glCopyColorTable";
+this->m_orig_glCopyColorTable = this->m_ptr_glCopyColorTable;
+if(this->m_ptr_glCopyColorTable)this->m_ptr_glCopyColorTable = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC)&ProfilingTableDecorator::m_glCopyColorTable_profile;
+this->m_names[2569] = "glDepthRangeArrayv";
+this->m_orig_glDepthRangeArrayv = this->m_ptr_glDepthRangeArrayv;
+if(this->m_ptr_glDepthRangeArrayv)this->m_ptr_glDepthRangeArrayv = (FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC)&ProfilingTableDecorator::m_glDepthRangeArrayv_profile;
+this->m_names[2570] = "glCoverFillPathInstancedNV";
+this->m_orig_glCoverFillPathInstancedNV = this->m_ptr_glCoverFillPathInstancedNV;
+if(this->m_ptr_glCoverFillPathInstancedNV)this->m_ptr_glCoverFillPathInstancedNV = (FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glCoverFillPathInstancedNV_profile;
+this->m_names[2571] = "glMultiTexParameterivEXT";
+this->m_orig_glMultiTexParameterivEXT = this->m_ptr_glMultiTexParameterivEXT;
+if(this->m_ptr_glMultiTexParameterivEXT)this->m_ptr_glMultiTexParameterivEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterivEXT_profile;
+this->m_names[2572] = "glGetActiveAtomicCounterBufferiv";
+this->m_orig_glGetActiveAtomicCounterBufferiv = this->m_ptr_glGetActiveAtomicCounterBufferiv;
+if(this->m_ptr_glGetActiveAtomicCounterBufferiv)this->m_ptr_glGetActiveAtomicCounterBufferiv = (FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)&ProfilingTableDecorator::m_glGetActiveAtomicCounterBufferiv_profile;
+this->m_names[2573] = "glStencilOpSeparate";
+this->m_orig_glStencilOpSeparate = this->m_ptr_glStencilOpSeparate;
+if(this->m_ptr_glStencilOpSeparate)this->m_ptr_glStencilOpSeparate = (FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC)&ProfilingTableDecorator::m_glStencilOpSeparate_profile;
+this->m_names[2574] = "glVertexAttrib4fNV";
+this->m_orig_glVertexAttrib4fNV = this->m_ptr_glVertexAttrib4fNV;
+if(this->m_ptr_glVertexAttrib4fNV)this->m_ptr_glVertexAttrib4fNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC)&ProfilingTableDecorator::m_glVertexAttrib4fNV_profile;
+this->m_names[2575] = "glGetColorTableParameterivSGI";
+this->m_orig_glGetColorTableParameterivSGI = this->m_ptr_glGetColorTableParameterivSGI;
+if(this->m_ptr_glGetColorTableParameterivSGI)this->m_ptr_glGetColorTableParameterivSGI = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC)&ProfilingTableDecorator::m_glGetColorTableParameterivSGI_profile;
+this->m_names[2576] = "glVertexArrayAttribBinding";
+this->m_orig_glVertexArrayAttribBinding = this->m_ptr_glVertexArrayAttribBinding;
+if(this->m_ptr_glVertexArrayAttribBinding)this->m_ptr_glVertexArrayAttribBinding = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC)&ProfilingTableDecorator::m_glVertexArrayAttribBinding_profile;
+this->m_names[2577] = "glIsSemaphoreEXT";
+this->m_orig_glIsSemaphoreEXT = this->m_ptr_glIsSemaphoreEXT;
+if(this->m_ptr_glIsSemaphoreEXT)this->m_ptr_glIsSemaphoreEXT = (FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC)&ProfilingTableDecorator::m_glIsSemaphoreEXT_profile;
+this->m_names[2578] = "glProgramParameters4dvNV";
+this->m_orig_glProgramParameters4dvNV = this->m_ptr_glProgramParameters4dvNV;
+if(this->m_ptr_glProgramParameters4dvNV)this->m_ptr_glProgramParameters4dvNV = (FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC)&ProfilingTableDecorator::m_glProgramParameters4dvNV_profile;
+this->m_names[2579] = "glVertexAttribL4dv";
+this->m_orig_glVertexAttribL4dv = this->m_ptr_glVertexAttribL4dv;
+if(this->m_ptr_glVertexAttribL4dv)this->m_ptr_glVertexAttribL4dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC)&ProfilingTableDecorator::m_glVertexAttribL4dv_profile;
+this->m_names[2580] = "glGetTexParameteriv";
+this->m_orig_glGetTexParameteriv = this->m_ptr_glGetTexParameteriv;
+if(this->m_ptr_glGetTexParameteriv)this->m_ptr_glGetTexParameteriv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetTexParameteriv_profile;
+this->m_names[2581] = "glGetUniformOffsetEXT";
+this->m_orig_glGetUniformOffsetEXT = this->m_ptr_glGetUniformOffsetEXT;
+if(this->m_ptr_glGetUniformOffsetEXT)this->m_ptr_glGetUniformOffsetEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC)&ProfilingTableDecorator::m_glGetUniformOffsetEXT_profile;
+this->m_names[2582] = "glGetVertexAttribPointerv";
+this->m_orig_glGetVertexAttribPointerv = this->m_ptr_glGetVertexAttribPointerv;
+if(this->m_ptr_glGetVertexAttribPointerv)this->m_ptr_glGetVertexAttribPointerv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC)&ProfilingTableDecorator::m_glGetVertexAttribPointerv_profile;
+this->m_names[2583] = "glResumeTransformFeedbackNV";
+this->m_orig_glResumeTransformFeedbackNV = this->m_ptr_glResumeTransformFeedbackNV;
+if(this->m_ptr_glResumeTransformFeedbackNV)this->m_ptr_glResumeTransformFeedbackNV = (FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glResumeTransformFeedbackNV_profile;
+this->m_names[2584] = "glProgramUniform3i64vNV";
+this->m_orig_glProgramUniform3i64vNV = this->m_ptr_glProgramUniform3i64vNV;
+if(this->m_ptr_glProgramUniform3i64vNV)this->m_ptr_glProgramUniform3i64vNV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC)&ProfilingTableDecorator::m_glProgramUniform3i64vNV_profile;
+this->m_names[2585] = "glTangent3fEXT";
+this->m_orig_glTangent3fEXT = this->m_ptr_glTangent3fEXT;
+if(this->m_ptr_glTangent3fEXT)this->m_ptr_glTangent3fEXT = (FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC)&ProfilingTableDecorator::m_glTangent3fEXT_profile;
+this->m_names[2586] = "glGetPathMetricRangeNV";
+this->m_orig_glGetPathMetricRangeNV = this->m_ptr_glGetPathMetricRangeNV;
+if(this->m_ptr_glGetPathMetricRangeNV)this->m_ptr_glGetPathMetricRangeNV = (FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC)&ProfilingTableDecorator::m_glGetPathMetricRangeNV_profile;
+this->m_names[2587] = "glWindowPos2iMESA";
+this->m_orig_glWindowPos2iMESA = this->m_ptr_glWindowPos2iMESA;
+if(this->m_ptr_glWindowPos2iMESA)this->m_ptr_glWindowPos2iMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC)&ProfilingTableDecorator::m_glWindowPos2iMESA_profile;
+this->m_names[2588] = "glVertex2xvOES";
+this->m_orig_glVertex2xvOES = this->m_ptr_glVertex2xvOES;
+if(this->m_ptr_glVertex2xvOES)this->m_ptr_glVertex2xvOES = (FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC)&ProfilingTableDecorator::m_glVertex2xvOES_profile;
+this->m_names[2589] = "glGetnCompressedTexImage";
+this->m_orig_glGetnCompressedTexImage = this->m_ptr_glGetnCompressedTexImage;
+if(this->m_ptr_glGetnCompressedTexImage)this->m_ptr_glGetnCompressedTexImage = (FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC)&ProfilingTableDecorator::m_glGetnCompressedTexImage_profile;
+this->m_names[2590] = "glWindowPos2dv";
+this->m_orig_glWindowPos2dv = this->m_ptr_glWindowPos2dv;
+if(this->m_ptr_glWindowPos2dv)this->m_ptr_glWindowPos2dv = (FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC)&ProfilingTableDecorator::m_glWindowPos2dv_profile;
+this->m_names[2591] = "glReplacementCodeuiVertex3fSUN";
+this->m_orig_glReplacementCodeuiVertex3fSUN = this->m_ptr_glReplacementCodeuiVertex3fSUN;
+if(this->m_ptr_glReplacementCodeuiVertex3fSUN)this->m_ptr_glReplacementCodeuiVertex3fSUN = (FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glReplacementCodeuiVertex3fSUN_profile;
+this->m_names[2592] = "glGetTransformFeedbackVaryingEXT";
+this->m_orig_glGetTransformFeedbackVaryingEXT = this->m_ptr_glGetTransformFeedbackVaryingEXT;
+if(this->m_ptr_glGetTransformFeedbackVaryingEXT)this->m_ptr_glGetTransformFeedbackVaryingEXT = (FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)&ProfilingTableDecorator::m_glGetTransformFeedbackVaryingEXT_profile;
+this->m_names[2593] = "glWindowPos3fARB";
+this->m_orig_glWindowPos3fARB = this->m_ptr_glWindowPos3fARB;
+if(this->m_ptr_glWindowPos3fARB)this->m_ptr_glWindowPos3fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC)&ProfilingTableDecorator::m_glWindowPos3fARB_profile;
+this->m_names[2594] = "glMapNamedBufferEXT";
+this->m_orig_glMapNamedBufferEXT = this->m_ptr_glMapNamedBufferEXT;
+if(this->m_ptr_glMapNamedBufferEXT)this->m_ptr_glMapNamedBufferEXT = (FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC)&ProfilingTableDecorator::m_glMapNamedBufferEXT_profile;
+this->m_names[2595] = "glDisable";
+this->m_orig_glDisable = this->m_ptr_glDisable;
+if(this->m_ptr_glDisable)this->m_ptr_glDisable = (FunctionTable::MEMBERPFNGLDISABLEPROC)&ProfilingTableDecorator::m_glDisable_profile;
+this->m_names[2596] = "glIsPointInFillPathNV";
+this->m_orig_glIsPointInFillPathNV = this->m_ptr_glIsPointInFillPathNV;
+if(this->m_ptr_glIsPointInFillPathNV)this->m_ptr_glIsPointInFillPathNV = (FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC)&ProfilingTableDecorator::m_glIsPointInFillPathNV_profile;
+this->m_names[2597] = "glVertexAttribI2uiEXT";
+this->m_orig_glVertexAttribI2uiEXT = this->m_ptr_glVertexAttribI2uiEXT;
+if(this->m_ptr_glVertexAttribI2uiEXT)this->m_ptr_glVertexAttribI2uiEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI2uiEXT_profile;
+this->m_names[2598] = "glProgramUniform4uiv";
+this->m_orig_glProgramUniform4uiv = this->m_ptr_glProgramUniform4uiv;
+if(this->m_ptr_glProgramUniform4uiv)this->m_ptr_glProgramUniform4uiv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC)&ProfilingTableDecorator::m_glProgramUniform4uiv_profile;
+this->m_names[2599] = "glQueryCounter";
+this->m_orig_glQueryCounter = this->m_ptr_glQueryCounter;
+if(this->m_ptr_glQueryCounter)this->m_ptr_glQueryCounter = (FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC)&ProfilingTableDecorator::m_glQueryCounter_profile;
+this->m_names[2600] = "glFramebufferRenderbufferEXT";
+this->m_orig_glFramebufferRenderbufferEXT = this->m_ptr_glFramebufferRenderbufferEXT;
+if(this->m_ptr_glFramebufferRenderbufferEXT)this->m_ptr_glFramebufferRenderbufferEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glFramebufferRenderbufferEXT_profile;
+this->m_names[2601] = "glBinormal3svEXT";
+this->m_orig_glBinormal3svEXT = this->m_ptr_glBinormal3svEXT;
+if(this->m_ptr_glBinormal3svEXT)this->m_ptr_glBinormal3svEXT = (FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC)&ProfilingTableDecorator::m_glBinormal3svEXT_profile;
+this->m_names[2602] = "glBindBufferOffsetNV";
+this->m_orig_glBindBufferOffsetNV = this->m_ptr_glBindBufferOffsetNV;
+if(this->m_ptr_glBindBufferOffsetNV)this->m_ptr_glBindBufferOffsetNV = (FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC)&ProfilingTableDecorator::m_glBindBufferOffsetNV_profile;
+this->m_names[2603] = "glCopyTextureSubImage2D";
+this->m_orig_glCopyTextureSubImage2D = this->m_ptr_glCopyTextureSubImage2D;
+if(this->m_ptr_glCopyTextureSubImage2D)this->m_ptr_glCopyTextureSubImage2D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage2D_profile;
+this->m_names[2604] = "glGetProgramResourcefvNV";
+this->m_orig_glGetProgramResourcefvNV = this->m_ptr_glGetProgramResourcefvNV;
+if(this->m_ptr_glGetProgramResourcefvNV)this->m_ptr_glGetProgramResourcefvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC)&ProfilingTableDecorator::m_glGetProgramResourcefvNV_profile;
+this->m_names[2605] = "glBinormalPointerEXT";
+this->m_orig_glBinormalPointerEXT = this->m_ptr_glBinormalPointerEXT;
+if(this->m_ptr_glBinormalPointerEXT)this->m_ptr_glBinormalPointerEXT = (FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC)&ProfilingTableDecorator::m_glBinormalPointerEXT_profile;
+this->m_names[2606] = "glGetLightfv";
+this->m_orig_glGetLightfv = this->m_ptr_glGetLightfv;
+if(this->m_ptr_glGetLightfv)this->m_ptr_glGetLightfv = (FunctionTable::MEMBERPFNGLGETLIGHTFVPROC)&ProfilingTableDecorator::m_glGetLightfv_profile;
+this->m_names[2607] = "glMulticastCopyImageSubDataNV";
+this->m_orig_glMulticastCopyImageSubDataNV = this->m_ptr_glMulticastCopyImageSubDataNV;
+if(this->m_ptr_glMulticastCopyImageSubDataNV)this->m_ptr_glMulticastCopyImageSubDataNV = (FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC)&ProfilingTableDecorator::m_glMulticastCopyImageSubDataNV_profile;
+this->m_names[2608] = "glVertex2bOES";
+this->m_orig_glVertex2bOES = this->m_ptr_glVertex2bOES;
+if(this->m_ptr_glVertex2bOES)this->m_ptr_glVertex2bOES = (FunctionTable::MEMBERPFNGLVERTEX2BOESPROC)&ProfilingTableDecorator::m_glVertex2bOES_profile;
+this->m_names[2609] = "glUniform2ivARB";
+this->m_orig_glUniform2ivARB = this->m_ptr_glUniform2ivARB;
+if(this->m_ptr_glUniform2ivARB)this->m_ptr_glUniform2ivARB = (FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC)&ProfilingTableDecorator::m_glUniform2ivARB_profile;
+this->m_names[2610] = "glMultiTexCoord3s";
+this->m_orig_glMultiTexCoord3s = this->m_ptr_glMultiTexCoord3s;
+if(this->m_ptr_glMultiTexCoord3s)this->m_ptr_glMultiTexCoord3s = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC)&ProfilingTableDecorator::m_glMultiTexCoord3s_profile;
+this->m_names[2611] = "glGetHistogramParameterfvEXT";
+this->m_orig_glGetHistogramParameterfvEXT = this->m_ptr_glGetHistogramParameterfvEXT;
+if(this->m_ptr_glGetHistogramParameterfvEXT)this->m_ptr_glGetHistogramParameterfvEXT = (FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glGetHistogramParameterfvEXT_profile;
+this->m_names[2612] = "glGetProgramStringNV";
+this->m_orig_glGetProgramStringNV = this->m_ptr_glGetProgramStringNV;
+if(this->m_ptr_glGetProgramStringNV)this->m_ptr_glGetProgramStringNV = (FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC)&ProfilingTableDecorator::m_glGetProgramStringNV_profile;
+this->m_names[2613] = "glGetTexGenxvOES";
+this->m_orig_glGetTexGenxvOES = this->m_ptr_glGetTexGenxvOES;
+if(this->m_ptr_glGetTexGenxvOES)this->m_ptr_glGetTexGenxvOES = (FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC)&ProfilingTableDecorator::m_glGetTexGenxvOES_profile;
+this->m_names[2614] = "glTextureSubImage2D";
+this->m_orig_glTextureSubImage2D = this->m_ptr_glTextureSubImage2D;
+if(this->m_ptr_glTextureSubImage2D)this->m_ptr_glTextureSubImage2D = (FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC)&ProfilingTableDecorator::m_glTextureSubImage2D_profile;
+this->m_names[2615] = "glObjectPurgeableAPPLE";
+this->m_orig_glObjectPurgeableAPPLE = this->m_ptr_glObjectPurgeableAPPLE;
+if(this->m_ptr_glObjectPurgeableAPPLE)this->m_ptr_glObjectPurgeableAPPLE = (FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC)&ProfilingTableDecorator::m_glObjectPurgeableAPPLE_profile;
+this->m_names[2616] = "glColorTableSGI";
+this->m_orig_glColorTableSGI = this->m_ptr_glColorTableSGI;
+if(this->m_ptr_glColorTableSGI)this->m_ptr_glColorTableSGI = (FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glColorTableSGI_profile;
+this->m_names[2617] = "glCopyConvolutionFilter2DEXT";
+this->m_orig_glCopyConvolutionFilter2DEXT = this->m_ptr_glCopyConvolutionFilter2DEXT;
+if(this->m_ptr_glCopyConvolutionFilter2DEXT)this->m_ptr_glCopyConvolutionFilter2DEXT = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter2DEXT_profile;
+this->m_names[2618] = "glMultiTexCoord3f";
+this->m_orig_glMultiTexCoord3f = this->m_ptr_glMultiTexCoord3f;
+if(this->m_ptr_glMultiTexCoord3f)this->m_ptr_glMultiTexCoord3f = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC)&ProfilingTableDecorator::m_glMultiTexCoord3f_profile;
+this->m_names[2619] = "glMultiTexCoord3d";
+this->m_orig_glMultiTexCoord3d = this->m_ptr_glMultiTexCoord3d;
+if(this->m_ptr_glMultiTexCoord3d)this->m_ptr_glMultiTexCoord3d = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC)&ProfilingTableDecorator::m_glMultiTexCoord3d_profile;
+this->m_names[2620] = "glFogCoorddv";
+this->m_orig_glFogCoorddv = this->m_ptr_glFogCoorddv;
+if(this->m_ptr_glFogCoorddv)this->m_ptr_glFogCoorddv = (FunctionTable::MEMBERPFNGLFOGCOORDDVPROC)&ProfilingTableDecorator::m_glFogCoorddv_profile;
+this->m_names[2621] = "glGetBufferPointerv";
+this->m_orig_glGetBufferPointerv = this->m_ptr_glGetBufferPointerv;
+if(this->m_ptr_glGetBufferPointerv)this->m_ptr_glGetBufferPointerv = (FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC)&ProfilingTableDecorator::m_glGetBufferPointerv_profile;
+this->m_names[2622] = "glProgramUniform1fEXT";
+this->m_orig_glProgramUniform1fEXT = this->m_ptr_glProgramUniform1fEXT;
+if(this->m_ptr_glProgramUniform1fEXT)this->m_ptr_glProgramUniform1fEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC)&ProfilingTableDecorator::m_glProgramUniform1fEXT_profile;
+this->m_names[2623] = "glWindowPos2fvMESA";
+this->m_orig_glWindowPos2fvMESA = this->m_ptr_glWindowPos2fvMESA;
+if(this->m_ptr_glWindowPos2fvMESA)this->m_ptr_glWindowPos2fvMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2fvMESA_profile;
+this->m_names[2624] = "glAlphaToCoverageDitherControlNV";
+this->m_orig_glAlphaToCoverageDitherControlNV = this->m_ptr_glAlphaToCoverageDitherControlNV;
+if(this->m_ptr_glAlphaToCoverageDitherControlNV)this->m_ptr_glAlphaToCoverageDitherControlNV = (FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC)&ProfilingTableDecorator::m_glAlphaToCoverageDitherControlNV_profile;
+this->m_names[2625] = "glPolygonOffsetxOES";
+this->m_orig_glPolygonOffsetxOES = this->m_ptr_glPolygonOffsetxOES;
+if(this->m_ptr_glPolygonOffsetxOES)this->m_ptr_glPolygonOffsetxOES = (FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC)&ProfilingTableDecorator::m_glPolygonOffsetxOES_profile;
+this->m_names[2626] = "glVertexAttrib4dARB";
+this->m_orig_glVertexAttrib4dARB = this->m_ptr_glVertexAttrib4dARB;
+if(this->m_ptr_glVertexAttrib4dARB)this->m_ptr_glVertexAttrib4dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4dARB_profile;
+this->m_names[2627] = "glUniformHandleui64vARB";
+this->m_orig_glUniformHandleui64vARB = this->m_ptr_glUniformHandleui64vARB;
+if(this->m_ptr_glUniformHandleui64vARB)this->m_ptr_glUniformHandleui64vARB = (FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC)&ProfilingTableDecorator::m_glUniformHandleui64vARB_profile;
+this->m_names[2628] = "glFragmentLightModelfvSGIX";
+this->m_orig_glFragmentLightModelfvSGIX = this->m_ptr_glFragmentLightModelfvSGIX;
+if(this->m_ptr_glFragmentLightModelfvSGIX)this->m_ptr_glFragmentLightModelfvSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC)&ProfilingTableDecorator::m_glFragmentLightModelfvSGIX_profile;
+this->m_names[2629] = "glSwizzleEXT";
+this->m_orig_glSwizzleEXT = this->m_ptr_glSwizzleEXT;
+if(this->m_ptr_glSwizzleEXT)this->m_ptr_glSwizzleEXT = (FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC)&ProfilingTableDecorator::m_glSwizzleEXT_profile;
+this->m_names[2630] = "glBindFragmentShaderATI";
+this->m_orig_glBindFragmentShaderATI = this->m_ptr_glBindFragmentShaderATI;
+if(this->m_ptr_glBindFragmentShaderATI)this->m_ptr_glBindFragmentShaderATI = (FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glBindFragmentShaderATI_profile;
+this->m_names[2631] = "glVertexAttribs3hvNV";
+this->m_orig_glVertexAttribs3hvNV = this->m_ptr_glVertexAttribs3hvNV;
+if(this->m_ptr_glVertexAttribs3hvNV)this->m_ptr_glVertexAttribs3hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs3hvNV_profile;
+this->m_names[2632] = "glGenBuffersARB";
+this->m_orig_glGenBuffersARB = this->m_ptr_glGenBuffersARB;
+if(this->m_ptr_glGenBuffersARB)this->m_ptr_glGenBuffersARB = (FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC)&ProfilingTableDecorator::m_glGenBuffersARB_profile;
+this->m_names[2633] = "glTextureStorageMem2DMultisampleEXT";
+this->m_orig_glTextureStorageMem2DMultisampleEXT = this->m_ptr_glTextureStorageMem2DMultisampleEXT;
+if(this->m_ptr_glTextureStorageMem2DMultisampleEXT)this->m_ptr_glTextureStorageMem2DMultisampleEXT = (FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC)&ProfilingTableDecorator::m_glTextureStorageMem2DMultisampleEXT_profile;
+this->m_names[2634] = "glListParameterfvSGIX";
+this->m_orig_glListParameterfvSGIX = this->m_ptr_glListParameterfvSGIX;
+if(this->m_ptr_glListParameterfvSGIX)this->m_ptr_glListParameterfvSGIX = (FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC)&ProfilingTableDecorator::m_glListParameterfvSGIX_profile;
+this->m_names[2635] = "glNamedRenderbufferStorageMultisample";
+this->m_orig_glNamedRenderbufferStorageMultisample = this->m_ptr_glNamedRenderbufferStorageMultisample;
+if(this->m_ptr_glNamedRenderbufferStorageMultisample)this->m_ptr_glNamedRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisample_profile;
+this->m_names[2636] = "glVertexAttribI1iEXT";
+this->m_orig_glVertexAttribI1iEXT = this->m_ptr_glVertexAttribI1iEXT;
+if(this->m_ptr_glVertexAttribI1iEXT)this->m_ptr_glVertexAttribI1iEXT = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC)&ProfilingTableDecorator::m_glVertexAttribI1iEXT_profile;
+this->m_names[2637] = "glMultiTexCoord2ivARB";
+this->m_orig_glMultiTexCoord2ivARB = this->m_ptr_glMultiTexCoord2ivARB;
+if(this->m_ptr_glMultiTexCoord2ivARB)this->m_ptr_glMultiTexCoord2ivARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2ivARB_profile;
+this->m_names[2638] = "glLightModelxOES";
+this->m_orig_glLightModelxOES = this->m_ptr_glLightModelxOES;
+if(this->m_ptr_glLightModelxOES)this->m_ptr_glLightModelxOES = (FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC)&ProfilingTableDecorator::m_glLightModelxOES_profile;
+this->m_names[2639] = "glColor3xOES";
+this->m_orig_glColor3xOES = this->m_ptr_glColor3xOES;
+if(this->m_ptr_glColor3xOES)this->m_ptr_glColor3xOES = (FunctionTable::MEMBERPFNGLCOLOR3XOESPROC)&ProfilingTableDecorator::m_glColor3xOES_profile;
+this->m_names[2640] = "glReadBuffer";
+this->m_orig_glReadBuffer = this->m_ptr_glReadBuffer;
+if(this->m_ptr_glReadBuffer)this->m_ptr_glReadBuffer = (FunctionTable::MEMBERPFNGLREADBUFFERPROC)&ProfilingTableDecorator::m_glReadBuffer_profile;
+this->m_names[2641] = "glStencilFillPathInstancedNV";
+this->m_orig_glStencilFillPathInstancedNV = this->m_ptr_glStencilFillPathInstancedNV;
+if(this->m_ptr_glStencilFillPathInstancedNV)this->m_ptr_glStencilFillPathInstancedNV = (FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC)&ProfilingTableDecorator::m_glStencilFillPathInstancedNV_profile;
+this->m_names[2642] = "glVDPAUUnmapSurfacesNV";
+this->m_orig_glVDPAUUnmapSurfacesNV = this->m_ptr_glVDPAUUnmapSurfacesNV;
+if(this->m_ptr_glVDPAUUnmapSurfacesNV)this->m_ptr_glVDPAUUnmapSurfacesNV = (FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC)&ProfilingTableDecorator::m_glVDPAUUnmapSurfacesNV_profile;
+this->m_names[2643] = "glProgramUniform4i64NV";
+this->m_orig_glProgramUniform4i64NV = this->m_ptr_glProgramUniform4i64NV;
+if(this->m_ptr_glProgramUniform4i64NV)this->m_ptr_glProgramUniform4i64NV = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC)&ProfilingTableDecorator::m_glProgramUniform4i64NV_profile;
+this->m_names[2644] = "glVertexStream4dvATI";
+this->m_orig_glVertexStream4dvATI = this->m_ptr_glVertexStream4dvATI;
+if(this->m_ptr_glVertexStream4dvATI)this->m_ptr_glVertexStream4dvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC)&ProfilingTableDecorator::m_glVertexStream4dvATI_profile;
+this->m_names[2645] = "glIsQuery";
+this->m_orig_glIsQuery = this->m_ptr_glIsQuery;
+if(this->m_ptr_glIsQuery)this->m_ptr_glIsQuery = (FunctionTable::MEMBERPFNGLISQUERYPROC)&ProfilingTableDecorator::m_glIsQuery_profile;
+this->m_names[2646] = "glProgramUniformMatrix4fvEXT";
+this->m_orig_glProgramUniformMatrix4fvEXT = this->m_ptr_glProgramUniformMatrix4fvEXT;
+if(this->m_ptr_glProgramUniformMatrix4fvEXT)this->m_ptr_glProgramUniformMatrix4fvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4fvEXT_profile;
+this->m_names[2647] = "glVertexAttrib3hNV";
+this->m_orig_glVertexAttrib3hNV = this->m_ptr_glVertexAttrib3hNV;
+if(this->m_ptr_glVertexAttrib3hNV)this->m_ptr_glVertexAttrib3hNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC)&ProfilingTableDecorator::m_glVertexAttrib3hNV_profile;
+this->m_names[2648] = "glFlushMappedNamedBufferRange";
+this->m_orig_glFlushMappedNamedBufferRange = this->m_ptr_glFlushMappedNamedBufferRange;
+if(this->m_ptr_glFlushMappedNamedBufferRange)this->m_ptr_glFlushMappedNamedBufferRange = (FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)&ProfilingTableDecorator::m_glFlushMappedNamedBufferRange_profile;
+this->m_names[2649] = "glPushName";
+this->m_orig_glPushName = this->m_ptr_glPushName;
+if(this->m_ptr_glPushName)this->m_ptr_glPushName = (FunctionTable::MEMBERPFNGLPUSHNAMEPROC)&ProfilingTableDecorator::m_glPushName_profile;
+this->m_names[2650] = "glGetClipPlane";
+this->m_orig_glGetClipPlane = this->m_ptr_glGetClipPlane;
+if(this->m_ptr_glGetClipPlane)this->m_ptr_glGetClipPlane = (FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC)&ProfilingTableDecorator::m_glGetClipPlane_profile;
+this->m_names[2651] = "glVertex4dv";
+this->m_orig_glVertex4dv = this->m_ptr_glVertex4dv;
+if(this->m_ptr_glVertex4dv)this->m_ptr_glVertex4dv = (FunctionTable::MEMBERPFNGLVERTEX4DVPROC)&ProfilingTableDecorator::m_glVertex4dv_profile;
+this->m_names[2652] = "glVertexAttrib3d";
+this->m_orig_glVertexAttrib3d = this->m_ptr_glVertexAttrib3d;
+if(this->m_ptr_glVertexAttrib3d)this->m_ptr_glVertexAttrib3d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC)&ProfilingTableDecorator::m_glVertexAttrib3d_profile;
+this->m_names[2653] = "glBlendColor";
+this->m_orig_glBlendColor = this->m_ptr_glBlendColor;
+if(this->m_ptr_glBlendColor)this->m_ptr_glBlendColor = (FunctionTable::MEMBERPFNGLBLENDCOLORPROC)&ProfilingTableDecorator::m_glBlendColor_profile;
+this->m_names[2654] = "glBindTransformFeedbackNV";
+this->m_orig_glBindTransformFeedbackNV = this->m_ptr_glBindTransformFeedbackNV;
+if(this->m_ptr_glBindTransformFeedbackNV)this->m_ptr_glBindTransformFeedbackNV = (FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glBindTransformFeedbackNV_profile;
+this->m_names[2655] = "glSamplerParameterIuiv";
+this->m_orig_glSamplerParameterIuiv = this->m_ptr_glSamplerParameterIuiv;
+if(this->m_ptr_glSamplerParameterIuiv)this->m_ptr_glSamplerParameterIuiv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC)&ProfilingTableDecorator::m_glSamplerParameterIuiv_profile;
+this->m_names[2656] = "glIndexubv";
+this->m_orig_glIndexubv = this->m_ptr_glIndexubv;
+if(this->m_ptr_glIndexubv)this->m_ptr_glIndexubv = (FunctionTable::MEMBERPFNGLINDEXUBVPROC)&ProfilingTableDecorator::m_glIndexubv_profile;
+this->m_names[2657] = "glNamedBufferPageCommitmentEXT";
+this->m_orig_glNamedBufferPageCommitmentEXT = this->m_ptr_glNamedBufferPageCommitmentEXT;
+if(this->m_ptr_glNamedBufferPageCommitmentEXT)this->m_ptr_glNamedBufferPageCommitmentEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC)&ProfilingTableDecorator::m_glNamedBufferPageCommitmentEXT_profile;
+this->m_names[2658] = "glCheckNamedFramebufferStatus";
+this->m_orig_glCheckNamedFramebufferStatus = this->m_ptr_glCheckNamedFramebufferStatus;
+if(this->m_ptr_glCheckNamedFramebufferStatus)this->m_ptr_glCheckNamedFramebufferStatus = (FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)&ProfilingTableDecorator::m_glCheckNamedFramebufferStatus_profile;
+this->m_names[2659] = "glGetObjectBufferfvATI";
+this->m_orig_glGetObjectBufferfvATI = this->m_ptr_glGetObjectBufferfvATI;
+if(this->m_ptr_glGetObjectBufferfvATI)this->m_ptr_glGetObjectBufferfvATI = (FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC)&ProfilingTableDecorator::m_glGetObjectBufferfvATI_profile;
+this->m_names[2660] = "glRasterPos4d";
+this->m_orig_glRasterPos4d = this->m_ptr_glRasterPos4d;
+if(this->m_ptr_glRasterPos4d)this->m_ptr_glRasterPos4d = (FunctionTable::MEMBERPFNGLRASTERPOS4DPROC)&ProfilingTableDecorator::m_glRasterPos4d_profile;
+this->m_names[2661] = "glRasterPos4f";
+this->m_orig_glRasterPos4f = this->m_ptr_glRasterPos4f;
+if(this->m_ptr_glRasterPos4f)this->m_ptr_glRasterPos4f = (FunctionTable::MEMBERPFNGLRASTERPOS4FPROC)&ProfilingTableDecorator::m_glRasterPos4f_profile;
+this->m_names[2662] = "glGetPerfMonitorCounterStringAMD";
+this->m_orig_glGetPerfMonitorCounterStringAMD = this->m_ptr_glGetPerfMonitorCounterStringAMD;
+if(this->m_ptr_glGetPerfMonitorCounterStringAMD)this->m_ptr_glGetPerfMonitorCounterStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorCounterStringAMD_profile;
+this->m_names[2663] = "glVertexAttrib3s";
+this->m_orig_glVertexAttrib3s = this->m_ptr_glVertexAttrib3s;
+if(this->m_ptr_glVertexAttrib3s)this->m_ptr_glVertexAttrib3s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC)&ProfilingTableDecorator::m_glVertexAttrib3s_profile;
+this->m_names[2664] = "glDrawElementsInstancedEXT";
+this->m_orig_glDrawElementsInstancedEXT = this->m_ptr_glDrawElementsInstancedEXT;
+if(this->m_ptr_glDrawElementsInstancedEXT)this->m_ptr_glDrawElementsInstancedEXT = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedEXT_profile;
+this->m_names[2665] = "glNamedProgramLocalParameterI4iEXT";
+this->m_orig_glNamedProgramLocalParameterI4iEXT = this->m_ptr_glNamedProgramLocalParameterI4iEXT;
+if(this->m_ptr_glNamedProgramLocalParameterI4iEXT)this->m_ptr_glNamedProgramLocalParameterI4iEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameterI4iEXT_profile;
+this->m_names[2666] = "glRasterPos4s";
+this->m_orig_glRasterPos4s = this->m_ptr_glRasterPos4s;
+if(this->m_ptr_glRasterPos4s)this->m_ptr_glRasterPos4s = (FunctionTable::MEMBERPFNGLRASTERPOS4SPROC)&ProfilingTableDecorator::m_glRasterPos4s_profile;
+this->m_names[2667] = "glGetProgramStageiv";
+this->m_orig_glGetProgramStageiv = this->m_ptr_glGetProgramStageiv;
+if(this->m_ptr_glGetProgramStageiv)this->m_ptr_glGetProgramStageiv = (FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC)&ProfilingTableDecorator::m_glGetProgramStageiv_profile;
+this->m_names[2668] = "glGetMaterialxOES";
+this->m_orig_glGetMaterialxOES = this->m_ptr_glGetMaterialxOES;
+if(this->m_ptr_glGetMaterialxOES)this->m_ptr_glGetMaterialxOES = (FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC)&ProfilingTableDecorator::m_glGetMaterialxOES_profile;
+this->m_names[2669] = "glPopMatrix";
+this->m_orig_glPopMatrix = this->m_ptr_glPopMatrix;
+if(this->m_ptr_glPopMatrix)this->m_ptr_glPopMatrix = (FunctionTable::MEMBERPFNGLPOPMATRIXPROC)&ProfilingTableDecorator::m_glPopMatrix_profile;
+this->m_names[2670] = "glGetVideoui64vNV";
+this->m_orig_glGetVideoui64vNV = this->m_ptr_glGetVideoui64vNV;
+if(this->m_ptr_glGetVideoui64vNV)this->m_ptr_glGetVideoui64vNV = (FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC)&ProfilingTableDecorator::m_glGetVideoui64vNV_profile;
+this->m_names[2671] = "glTangent3bEXT";
+this->m_orig_glTangent3bEXT = this->m_ptr_glTangent3bEXT;
+if(this->m_ptr_glTangent3bEXT)this->m_ptr_glTangent3bEXT = (FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC)&ProfilingTableDecorator::m_glTangent3bEXT_profile;
+this->m_names[2672] = "glGetGraphicsResetStatusARB";
+this->m_orig_glGetGraphicsResetStatusARB = this->m_ptr_glGetGraphicsResetStatusARB;
+if(this->m_ptr_glGetGraphicsResetStatusARB)this->m_ptr_glGetGraphicsResetStatusARB = (FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC)&ProfilingTableDecorator::m_glGetGraphicsResetStatusARB_profile;
+this->m_names[2673] = "glUniform4i";
+this->m_orig_glUniform4i = this->m_ptr_glUniform4i;
+if(this->m_ptr_glUniform4i)this->m_ptr_glUniform4i = (FunctionTable::MEMBERPFNGLUNIFORM4IPROC)&ProfilingTableDecorator::m_glUniform4i_profile;
+this->m_names[2674] = "glActiveTexture";
+this->m_orig_glActiveTexture = this->m_ptr_glActiveTexture;
+if(this->m_ptr_glActiveTexture)this->m_ptr_glActiveTexture = (FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC)&ProfilingTableDecorator::m_glActiveTexture_profile;
+this->m_names[2675] = "glEnableVertexAttribArray";
+this->m_orig_glEnableVertexAttribArray = this->m_ptr_glEnableVertexAttribArray;
+if(this->m_ptr_glEnableVertexAttribArray)this->m_ptr_glEnableVertexAttribArray = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC)&ProfilingTableDecorator::m_glEnableVertexAttribArray_profile;
+this->m_names[2676] = "glTexCoord4fVertex4fvSUN";
+this->m_orig_glTexCoord4fVertex4fvSUN = this->m_ptr_glTexCoord4fVertex4fvSUN;
+if(this->m_ptr_glTexCoord4fVertex4fvSUN)this->m_ptr_glTexCoord4fVertex4fvSUN = (FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC)&ProfilingTableDecorator::m_glTexCoord4fVertex4fvSUN_profile;
+this->m_names[2677] = "glUniform4d";
+this->m_orig_glUniform4d = this->m_ptr_glUniform4d;
+if(this->m_ptr_glUniform4d)this->m_ptr_glUniform4d = (FunctionTable::MEMBERPFNGLUNIFORM4DPROC)&ProfilingTableDecorator::m_glUniform4d_profile;
+this->m_names[2678] = "glUniform4f";
+this->m_orig_glUniform4f = this->m_ptr_glUniform4f;
+if(this->m_ptr_glUniform4f)this->m_ptr_glUniform4f = (FunctionTable::MEMBERPFNGLUNIFORM4FPROC)&ProfilingTableDecorator::m_glUniform4f_profile;
+this->m_names[2679] = "glRenderbufferStorageMultisample";
+this->m_orig_glRenderbufferStorageMultisample = this->m_ptr_glRenderbufferStorageMultisample;
+if(this->m_ptr_glRenderbufferStorageMultisample)this->m_ptr_glRenderbufferStorageMultisample = (FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)&ProfilingTableDecorator::m_glRenderbufferStorageMultisample_profile;
+this->m_names[2680] = "glCreateProgramPipelines";
+this->m_orig_glCreateProgramPipelines = this->m_ptr_glCreateProgramPipelines;
+if(this->m_ptr_glCreateProgramPipelines)this->m_ptr_glCreateProgramPipelines = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC)&ProfilingTableDecorator::m_glCreateProgramPipelines_profile;
+this->m_names[2681] = "glVertexAttribLPointer";
+this->m_orig_glVertexAttribLPointer = this->m_ptr_glVertexAttribLPointer;
+if(this->m_ptr_glVertexAttribLPointer)this->m_ptr_glVertexAttribLPointer = (FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC)&ProfilingTableDecorator::m_glVertexAttribLPointer_profile;
+this->m_names[2682] = "glUniform2uiEXT";
+this->m_orig_glUniform2uiEXT = this->m_ptr_glUniform2uiEXT;
+if(this->m_ptr_glUniform2uiEXT)this->m_ptr_glUniform2uiEXT = (FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC)&ProfilingTableDecorator::m_glUniform2uiEXT_profile;
+this->m_names[2683] = "glMultiTexCoord3sv";
+this->m_orig_glMultiTexCoord3sv = this->m_ptr_glMultiTexCoord3sv;
+if(this->m_ptr_glMultiTexCoord3sv)this->m_ptr_glMultiTexCoord3sv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3sv_profile;
+this->m_names[2684] = "glDrawElementsInstancedBaseVertex";
+this->m_orig_glDrawElementsInstancedBaseVertex = this->m_ptr_glDrawElementsInstancedBaseVertex;
+if(this->m_ptr_glDrawElementsInstancedBaseVertex)this->m_ptr_glDrawElementsInstancedBaseVertex = (FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)&ProfilingTableDecorator::m_glDrawElementsInstancedBaseVertex_profile;
+this->m_names[2685] = "glPixelTransformParameterfvEXT";
+this->m_orig_glPixelTransformParameterfvEXT = this->m_ptr_glPixelTransformParameterfvEXT;
+if(this->m_ptr_glPixelTransformParameterfvEXT)this->m_ptr_glPixelTransformParameterfvEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterfvEXT_profile;
+this->m_names[2686] = "glDrawTransformFeedbackNV";
+this->m_orig_glDrawTransformFeedbackNV = this->m_ptr_glDrawTransformFeedbackNV;
+if(this->m_ptr_glDrawTransformFeedbackNV)this->m_ptr_glDrawTransformFeedbackNV = (FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glDrawTransformFeedbackNV_profile;
+this->m_names[2687] = "glTextureImage2DMultisampleCoverageNV";
+this->m_orig_glTextureImage2DMultisampleCoverageNV = this->m_ptr_glTextureImage2DMultisampleCoverageNV;
+if(this->m_ptr_glTextureImage2DMultisampleCoverageNV)this->m_ptr_glTextureImage2DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTextureImage2DMultisampleCoverageNV_profile;
+this->m_names[2688] = "glNamedRenderbufferStorageMultisampleCoverageEXT";
+this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT;
+if(this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT)this->m_ptr_glNamedRenderbufferStorageMultisampleCoverageEXT = (FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)&ProfilingTableDecorator::m_glNamedRenderbufferStorageMultisampleCoverageEXT_profile;
+this->m_names[2689] = "glIsTexture";
+this->m_orig_glIsTexture = this->m_ptr_glIsTexture;
+if(this->m_ptr_glIsTexture)this->m_ptr_glIsTexture = (FunctionTable::MEMBERPFNGLISTEXTUREPROC)&ProfilingTableDecorator::m_glIsTexture_profile;
+this->m_names[2690] = "glMultiTexCoord4iv";
+this->m_orig_glMultiTexCoord4iv = this->m_ptr_glMultiTexCoord4iv;
+if(this->m_ptr_glMultiTexCoord4iv)this->m_ptr_glMultiTexCoord4iv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4iv_profile;
+this->m_names[2691] = "glTexEnvfv";
+this->m_orig_glTexEnvfv = this->m_ptr_glTexEnvfv;
+if(this->m_ptr_glTexEnvfv)this->m_ptr_glTexEnvfv = (FunctionTable::MEMBERPFNGLTEXENVFVPROC)&ProfilingTableDecorator::m_glTexEnvfv_profile;
+this->m_names[2692] = "glPopDebugGroup";
+this->m_orig_glPopDebugGroup = this->m_ptr_glPopDebugGroup;
+if(this->m_ptr_glPopDebugGroup)this->m_ptr_glPopDebugGroup = (FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC)&ProfilingTableDecorator::m_glPopDebugGroup_profile;
+this->m_names[2693] = "glUniformBlockBinding";
+this->m_orig_glUniformBlockBinding = this->m_ptr_glUniformBlockBinding;
+if(this->m_ptr_glUniformBlockBinding)this->m_ptr_glUniformBlockBinding = (FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC)&ProfilingTableDecorator::m_glUniformBlockBinding_profile;
+this->m_names[2694] = "glWindowPos2svMESA";
+this->m_orig_glWindowPos2svMESA = this->m_ptr_glWindowPos2svMESA;
+if(this->m_ptr_glWindowPos2svMESA)this->m_ptr_glWindowPos2svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos2svMESA_profile;
+this->m_names[2695] = "glGenerateTextureMipmapEXT";
+this->m_orig_glGenerateTextureMipmapEXT = this->m_ptr_glGenerateTextureMipmapEXT;
+if(this->m_ptr_glGenerateTextureMipmapEXT)this->m_ptr_glGenerateTextureMipmapEXT = (FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC)&ProfilingTableDecorator::m_glGenerateTextureMipmapEXT_profile;
+this->m_names[2696] = "glBindLightParameterEXT";
+this->m_orig_glBindLightParameterEXT = this->m_ptr_glBindLightParameterEXT;
+if(this->m_ptr_glBindLightParameterEXT)this->m_ptr_glBindLightParameterEXT = (FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindLightParameterEXT_profile;
+this->m_names[2697] = "glTexCoord3bOES";
+this->m_orig_glTexCoord3bOES = this->m_ptr_glTexCoord3bOES;
+if(this->m_ptr_glTexCoord3bOES)this->m_ptr_glTexCoord3bOES = (FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC)&ProfilingTableDecorator::m_glTexCoord3bOES_profile;
+this->m_names[2698] = "glTexCoordPointer";
+this->m_orig_glTexCoordPointer = this->m_ptr_glTexCoordPointer;
+if(this->m_ptr_glTexCoordPointer)this->m_ptr_glTexCoordPointer = (FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC)&ProfilingTableDecorator::m_glTexCoordPointer_profile;
+this->m_names[2699] = "glProgramUniformMatrix3x2fv";
+this->m_orig_glProgramUniformMatrix3x2fv = this->m_ptr_glProgramUniformMatrix3x2fv;
+if(this->m_ptr_glProgramUniformMatrix3x2fv)this->m_ptr_glProgramUniformMatrix3x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix3x2fv_profile;
+this->m_names[2700] = "glUniform2fvARB";
+this->m_orig_glUniform2fvARB = this->m_ptr_glUniform2fvARB;
+if(this->m_ptr_glUniform2fvARB)this->m_ptr_glUniform2fvARB = (FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC)&ProfilingTableDecorator::m_glUniform2fvARB_profile;
+this->m_names[2701] = "glProgramLocalParameterI4uivNV";
+this->m_orig_glProgramLocalParameterI4uivNV = this->m_ptr_glProgramLocalParameterI4uivNV;
+if(this->m_ptr_glProgramLocalParameterI4uivNV)this->m_ptr_glProgramLocalParameterI4uivNV = (FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)&ProfilingTableDecorator::m_glProgramLocalParameterI4uivNV_profile;
+this->m_names[2702] = "glFlushVertexArrayRangeNV";
+this->m_orig_glFlushVertexArrayRangeNV = this->m_ptr_glFlushVertexArrayRangeNV;
+if(this->m_ptr_glFlushVertexArrayRangeNV)this->m_ptr_glFlushVertexArrayRangeNV = (FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC)&ProfilingTableDecorator::m_glFlushVertexArrayRangeNV_profile;
+this->m_names[2703] = "glSecondaryColor3svEXT";
+this->m_orig_glSecondaryColor3svEXT = this->m_ptr_glSecondaryColor3svEXT;
+if(this->m_ptr_glSecondaryColor3svEXT)this->m_ptr_glSecondaryColor3svEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3svEXT_profile;
+this->m_names[2704] = "glGetBufferParameteriv";
+this->m_orig_glGetBufferParameteriv = this->m_ptr_glGetBufferParameteriv;
+if(this->m_ptr_glGetBufferParameteriv)this->m_ptr_glGetBufferParameteriv = (FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetBufferParameteriv_profile;
+this->m_names[2705] = "glGetQueryIndexediv";
+this->m_orig_glGetQueryIndexediv = this->m_ptr_glGetQueryIndexediv;
+if(this->m_ptr_glGetQueryIndexediv)this->m_ptr_glGetQueryIndexediv = (FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC)&ProfilingTableDecorator::m_glGetQueryIndexediv_profile;
+this->m_names[2706] = "glFramebufferTexture3DEXT";
+this->m_orig_glFramebufferTexture3DEXT = this->m_ptr_glFramebufferTexture3DEXT;
+if(this->m_ptr_glFramebufferTexture3DEXT)this->m_ptr_glFramebufferTexture3DEXT = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC)&ProfilingTableDecorator::m_glFramebufferTexture3DEXT_profile;
+this->m_names[2707] = "glLoadTransposeMatrixxOES";
+this->m_orig_glLoadTransposeMatrixxOES = this->m_ptr_glLoadTransposeMatrixxOES;
+if(this->m_ptr_glLoadTransposeMatrixxOES)this->m_ptr_glLoadTransposeMatrixxOES = (FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC)&ProfilingTableDecorator::m_glLoadTransposeMatrixxOES_profile;
+this->m_names[2708] = "glDeleteTransformFeedbacksNV";
+this->m_orig_glDeleteTransformFeedbacksNV = this->m_ptr_glDeleteTransformFeedbacksNV;
+if(this->m_ptr_glDeleteTransformFeedbacksNV)this->m_ptr_glDeleteTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC)&ProfilingTableDecorator::m_glDeleteTransformFeedbacksNV_profile;
+this->m_names[2709] = "glGetCompressedTextureImageEXT";
+this->m_orig_glGetCompressedTextureImageEXT = this->m_ptr_glGetCompressedTextureImageEXT;
+if(this->m_ptr_glGetCompressedTextureImageEXT)this->m_ptr_glGetCompressedTextureImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetCompressedTextureImageEXT_profile;
+this->m_names[2710] = "glIndexMaterialEXT";
+this->m_orig_glIndexMaterialEXT = this->m_ptr_glIndexMaterialEXT;
+if(this->m_ptr_glIndexMaterialEXT)this->m_ptr_glIndexMaterialEXT = (FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC)&ProfilingTableDecorator::m_glIndexMaterialEXT_profile;
+this->m_names[2711] = "glFogCoorddEXT";
+this->m_orig_glFogCoorddEXT = this->m_ptr_glFogCoorddEXT;
+if(this->m_ptr_glFogCoorddEXT)this->m_ptr_glFogCoorddEXT = (FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC)&ProfilingTableDecorator::m_glFogCoorddEXT_profile;
+this->m_names[2712] = "glTexCoord2hvNV";
+this->m_orig_glTexCoord2hvNV = this->m_ptr_glTexCoord2hvNV;
+if(this->m_ptr_glTexCoord2hvNV)this->m_ptr_glTexCoord2hvNV = (FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC)&ProfilingTableDecorator::m_glTexCoord2hvNV_profile;
+this->m_names[2713] = "glGetFramebufferParameterfvAMD";
+this->m_orig_glGetFramebufferParameterfvAMD = this->m_ptr_glGetFramebufferParameterfvAMD;
+if(this->m_ptr_glGetFramebufferParameterfvAMD)this->m_ptr_glGetFramebufferParameterfvAMD = (FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC)&ProfilingTableDecorator::m_glGetFramebufferParameterfvAMD_profile;
+this->m_names[2714] = "glTexEnviv";
+this->m_orig_glTexEnviv = this->m_ptr_glTexEnviv;
+if(this->m_ptr_glTexEnviv)this->m_ptr_glTexEnviv = (FunctionTable::MEMBERPFNGLTEXENVIVPROC)&ProfilingTableDecorator::m_glTexEnviv_profile;
+this->m_names[2715] = "glEndTransformFeedbackNV";
+this->m_orig_glEndTransformFeedbackNV = this->m_ptr_glEndTransformFeedbackNV;
+if(this->m_ptr_glEndTransformFeedbackNV)this->m_ptr_glEndTransformFeedbackNV = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC)&ProfilingTableDecorator::m_glEndTransformFeedbackNV_profile;
+this->m_names[2716] = "glGlobalAlphaFactoruiSUN";
+this->m_orig_glGlobalAlphaFactoruiSUN = this->m_ptr_glGlobalAlphaFactoruiSUN;
+if(this->m_ptr_glGlobalAlphaFactoruiSUN)this->m_ptr_glGlobalAlphaFactoruiSUN = (FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC)&ProfilingTableDecorator::m_glGlobalAlphaFactoruiSUN_profile;
+this->m_names[2717] = "glSelectBuffer";
+this->m_orig_glSelectBuffer = this->m_ptr_glSelectBuffer;
+if(this->m_ptr_glSelectBuffer)this->m_ptr_glSelectBuffer = (FunctionTable::MEMBERPFNGLSELECTBUFFERPROC)&ProfilingTableDecorator::m_glSelectBuffer_profile;
+this->m_names[2718] = "glNamedBufferSubDataEXT";
+this->m_orig_glNamedBufferSubDataEXT = this->m_ptr_glNamedBufferSubDataEXT;
+if(this->m_ptr_glNamedBufferSubDataEXT)this->m_ptr_glNamedBufferSubDataEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC)&ProfilingTableDecorator::m_glNamedBufferSubDataEXT_profile;
+this->m_names[2719] = "glDisableVertexArrayAttrib";
+this->m_orig_glDisableVertexArrayAttrib = this->m_ptr_glDisableVertexArrayAttrib;
+if(this->m_ptr_glDisableVertexArrayAttrib)this->m_ptr_glDisableVertexArrayAttrib = (FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC)&ProfilingTableDecorator::m_glDisableVertexArrayAttrib_profile;
+this->m_names[2720] = "glBlendFunc";
+this->m_orig_glBlendFunc = this->m_ptr_glBlendFunc;
+if(this->m_ptr_glBlendFunc)this->m_ptr_glBlendFunc = (FunctionTable::MEMBERPFNGLBLENDFUNCPROC)&ProfilingTableDecorator::m_glBlendFunc_profile;
+this->m_names[2721] = "glCreateProgram";
+this->m_orig_glCreateProgram = this->m_ptr_glCreateProgram;
+if(this->m_ptr_glCreateProgram)this->m_ptr_glCreateProgram = (FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC)&ProfilingTableDecorator::m_glCreateProgram_profile;
+this->m_names[2722] = "glVertexStream2dATI";
+this->m_orig_glVertexStream2dATI = this->m_ptr_glVertexStream2dATI;
+if(this->m_ptr_glVertexStream2dATI)this->m_ptr_glVertexStream2dATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC)&ProfilingTableDecorator::m_glVertexStream2dATI_profile;
+this->m_names[2723] = "glUniform4ui64vARB";
+this->m_orig_glUniform4ui64vARB = this->m_ptr_glUniform4ui64vARB;
+if(this->m_ptr_glUniform4ui64vARB)this->m_ptr_glUniform4ui64vARB = (FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC)&ProfilingTableDecorator::m_glUniform4ui64vARB_profile;
+this->m_names[2724] = "glGetSemaphoreParameterui64vEXT";
+this->m_orig_glGetSemaphoreParameterui64vEXT = this->m_ptr_glGetSemaphoreParameterui64vEXT;
+if(this->m_ptr_glGetSemaphoreParameterui64vEXT)this->m_ptr_glGetSemaphoreParameterui64vEXT = (FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC)&ProfilingTableDecorator::m_glGetSemaphoreParameterui64vEXT_profile;
+this->m_names[2725] = "glPrimitiveRestartIndex";
+this->m_orig_glPrimitiveRestartIndex = this->m_ptr_glPrimitiveRestartIndex;
+if(this->m_ptr_glPrimitiveRestartIndex)this->m_ptr_glPrimitiveRestartIndex = (FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC)&ProfilingTableDecorator::m_glPrimitiveRestartIndex_profile;
+this->m_names[2726] = "glNormalStream3fATI";
+this->m_orig_glNormalStream3fATI = this->m_ptr_glNormalStream3fATI;
+if(this->m_ptr_glNormalStream3fATI)this->m_ptr_glNormalStream3fATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC)&ProfilingTableDecorator::m_glNormalStream3fATI_profile;
+this->m_names[2727] = "glProgramUniformMatrix2fv";
+this->m_orig_glProgramUniformMatrix2fv = this->m_ptr_glProgramUniformMatrix2fv;
+if(this->m_ptr_glProgramUniformMatrix2fv)this->m_ptr_glProgramUniformMatrix2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix2fv_profile;
+this->m_names[2728] = "glVertexAttribs1hvNV";
+this->m_orig_glVertexAttribs1hvNV = this->m_ptr_glVertexAttribs1hvNV;
+if(this->m_ptr_glVertexAttribs1hvNV)this->m_ptr_glVertexAttribs1hvNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC)&ProfilingTableDecorator::m_glVertexAttribs1hvNV_profile;
+this->m_names[2729] = "glWindowPos4svMESA";
+this->m_orig_glWindowPos4svMESA = this->m_ptr_glWindowPos4svMESA;
+if(this->m_ptr_glWindowPos4svMESA)this->m_ptr_glWindowPos4svMESA = (FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC)&ProfilingTableDecorator::m_glWindowPos4svMESA_profile;
+this->m_names[2730] = "glDeleteFragmentShaderATI";
+this->m_orig_glDeleteFragmentShaderATI = this->m_ptr_glDeleteFragmentShaderATI;
+if(this->m_ptr_glDeleteFragmentShaderATI)this->m_ptr_glDeleteFragmentShaderATI = (FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC)&ProfilingTableDecorator::m_glDeleteFragmentShaderATI_profile;
+this->m_names[2731] = "glBindImageTextures";
+this->m_orig_glBindImageTextures = this->m_ptr_glBindImageTextures;
+if(this->m_ptr_glBindImageTextures)this->m_ptr_glBindImageTextures = (FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC)&ProfilingTableDecorator::m_glBindImageTextures_profile;
+this->m_names[2732] = "glMap2xOES";
+this->m_orig_glMap2xOES = this->m_ptr_glMap2xOES;
+if(this->m_ptr_glMap2xOES)this->m_ptr_glMap2xOES = (FunctionTable::MEMBERPFNGLMAP2XOESPROC)&ProfilingTableDecorator::m_glMap2xOES_profile;
+this->m_names[2733] = "glEnd";
+this->m_orig_glEnd = this->m_ptr_glEnd;
+if(this->m_ptr_glEnd)this->m_ptr_glEnd = (FunctionTable::MEMBERPFNGLENDPROC)&ProfilingTableDecorator::m_glEnd_profile;
+this->m_names[2734] = "glMultiTexCoord2dARB";
+this->m_orig_glMultiTexCoord2dARB = this->m_ptr_glMultiTexCoord2dARB;
+if(this->m_ptr_glMultiTexCoord2dARB)this->m_ptr_glMultiTexCoord2dARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord2dARB_profile;
+this->m_names[2735] = "glUniform1i64NV";
+this->m_orig_glUniform1i64NV = this->m_ptr_glUniform1i64NV;
+if(this->m_ptr_glUniform1i64NV)this->m_ptr_glUniform1i64NV = (FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC)&ProfilingTableDecorator::m_glUniform1i64NV_profile;
+this->m_names[2736] = "glPathStringNV";
+this->m_orig_glPathStringNV = this->m_ptr_glPathStringNV;
+if(this->m_ptr_glPathStringNV)this->m_ptr_glPathStringNV = (FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC)&ProfilingTableDecorator::m_glPathStringNV_profile;
+this->m_names[2737] = "glGetNamedFramebufferParameterivEXT";
+this->m_orig_glGetNamedFramebufferParameterivEXT = this->m_ptr_glGetNamedFramebufferParameterivEXT;
+if(this->m_ptr_glGetNamedFramebufferParameterivEXT)this->m_ptr_glGetNamedFramebufferParameterivEXT = (FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)&ProfilingTableDecorator::m_glGetNamedFramebufferParameterivEXT_profile;
+this->m_names[2738] = "glGetProgramNamedParameterdvNV";
+this->m_orig_glGetProgramNamedParameterdvNV = this->m_ptr_glGetProgramNamedParameterdvNV;
+if(this->m_ptr_glGetProgramNamedParameterdvNV)this->m_ptr_glGetProgramNamedParameterdvNV = (FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)&ProfilingTableDecorator::m_glGetProgramNamedParameterdvNV_profile;
+this->m_names[2739] = "glPathDashArrayNV";
+this->m_orig_glPathDashArrayNV = this->m_ptr_glPathDashArrayNV;
+if(this->m_ptr_glPathDashArrayNV)this->m_ptr_glPathDashArrayNV = (FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC)&ProfilingTableDecorator::m_glPathDashArrayNV_profile;
+this->m_names[2740] = "glUniform3uiv";
+this->m_orig_glUniform3uiv = this->m_ptr_glUniform3uiv;
+if(this->m_ptr_glUniform3uiv)this->m_ptr_glUniform3uiv = (FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC)&ProfilingTableDecorator::m_glUniform3uiv_profile;
+this->m_names[2741] = "glColor3fVertex3fvSUN";
+this->m_orig_glColor3fVertex3fvSUN = this->m_ptr_glColor3fVertex3fvSUN;
+if(this->m_ptr_glColor3fVertex3fvSUN)this->m_ptr_glColor3fVertex3fvSUN = (FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC)&ProfilingTableDecorator::m_glColor3fVertex3fvSUN_profile;
+this->m_names[2742] = "glMultTransposeMatrixd";
+this->m_orig_glMultTransposeMatrixd = this->m_ptr_glMultTransposeMatrixd;
+if(this->m_ptr_glMultTransposeMatrixd)this->m_ptr_glMultTransposeMatrixd = (FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC)&ProfilingTableDecorator::m_glMultTransposeMatrixd_profile;
+this->m_names[2743] = "glClearColor";
+this->m_orig_glClearColor = this->m_ptr_glClearColor;
+if(this->m_ptr_glClearColor)this->m_ptr_glClearColor = (FunctionTable::MEMBERPFNGLCLEARCOLORPROC)&ProfilingTableDecorator::m_glClearColor_profile;
+this->m_names[2744] = "glGetImageHandleARB";
+this->m_orig_glGetImageHandleARB = this->m_ptr_glGetImageHandleARB;
+if(this->m_ptr_glGetImageHandleARB)this->m_ptr_glGetImageHandleARB = (FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC)&ProfilingTableDecorator::m_glGetImageHandleARB_profile;
+this->m_names[2745] = "glTangent3dEXT";
+this->m_orig_glTangent3dEXT = this->m_ptr_glTangent3dEXT;
+if(this->m_ptr_glTangent3dEXT)this->m_ptr_glTangent3dEXT = (FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC)&ProfilingTableDecorator::m_glTangent3dEXT_profile;
+this->m_names[2746] = "glGetQueryObjectivARB";
+this->m_orig_glGetQueryObjectivARB = this->m_ptr_glGetQueryObjectivARB;
+if(this->m_ptr_glGetQueryObjectivARB)this->m_ptr_glGetQueryObjectivARB = (FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC)&ProfilingTableDecorator::m_glGetQueryObjectivARB_profile;
+this->m_names[2747] = "glGetLocalConstantFloatvEXT";
+this->m_orig_glGetLocalConstantFloatvEXT = this->m_ptr_glGetLocalConstantFloatvEXT;
+if(this->m_ptr_glGetLocalConstantFloatvEXT)this->m_ptr_glGetLocalConstantFloatvEXT = (FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC)&ProfilingTableDecorator::m_glGetLocalConstantFloatvEXT_profile;
+this->m_names[2748] = "glUseShaderProgramEXT";
+this->m_orig_glUseShaderProgramEXT = this->m_ptr_glUseShaderProgramEXT;
+if(this->m_ptr_glUseShaderProgramEXT)this->m_ptr_glUseShaderProgramEXT = (FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC)&ProfilingTableDecorator::m_glUseShaderProgramEXT_profile;
+this->m_names[2749] = "glBindRenderbufferEXT";
+this->m_orig_glBindRenderbufferEXT = this->m_ptr_glBindRenderbufferEXT;
+if(this->m_ptr_glBindRenderbufferEXT)this->m_ptr_glBindRenderbufferEXT = (FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC)&ProfilingTableDecorator::m_glBindRenderbufferEXT_profile;
+this->m_names[2750] = "glInterleavedArrays";
+this->m_orig_glInterleavedArrays = this->m_ptr_glInterleavedArrays;
+if(this->m_ptr_glInterleavedArrays)this->m_ptr_glInterleavedArrays = (FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC)&ProfilingTableDecorator::m_glInterleavedArrays_profile;
+this->m_names[2751] = "glGetPerfMonitorGroupStringAMD";
+this->m_orig_glGetPerfMonitorGroupStringAMD = this->m_ptr_glGetPerfMonitorGroupStringAMD;
+if(this->m_ptr_glGetPerfMonitorGroupStringAMD)this->m_ptr_glGetPerfMonitorGroupStringAMD = (FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC)&ProfilingTableDecorator::m_glGetPerfMonitorGroupStringAMD_profile;
+this->m_names[2752] = "glUniform3ui";
+this->m_orig_glUniform3ui = this->m_ptr_glUniform3ui;
+if(this->m_ptr_glUniform3ui)this->m_ptr_glUniform3ui = (FunctionTable::MEMBERPFNGLUNIFORM3UIPROC)&ProfilingTableDecorator::m_glUniform3ui_profile;
+this->m_names[2753] = "glGetNamedProgramLocalParameterdvEXT";
+this->m_orig_glGetNamedProgramLocalParameterdvEXT = this->m_ptr_glGetNamedProgramLocalParameterdvEXT;
+if(this->m_ptr_glGetNamedProgramLocalParameterdvEXT)this->m_ptr_glGetNamedProgramLocalParameterdvEXT = (FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)&ProfilingTableDecorator::m_glGetNamedProgramLocalParameterdvEXT_profile;
+this->m_names[2754] = "glDeleteQueryResourceTagNV";
+this->m_orig_glDeleteQueryResourceTagNV = this->m_ptr_glDeleteQueryResourceTagNV;
+if(this->m_ptr_glDeleteQueryResourceTagNV)this->m_ptr_glDeleteQueryResourceTagNV = (FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC)&ProfilingTableDecorator::m_glDeleteQueryResourceTagNV_profile;
+this->m_names[2755] = "glVertexAttribI4uiv";
+this->m_orig_glVertexAttribI4uiv = this->m_ptr_glVertexAttribI4uiv;
+if(this->m_ptr_glVertexAttribI4uiv)this->m_ptr_glVertexAttribI4uiv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC)&ProfilingTableDecorator::m_glVertexAttribI4uiv_profile;
+this->m_names[2756] = "glVertexAttrib4bv";
+this->m_orig_glVertexAttrib4bv = this->m_ptr_glVertexAttrib4bv;
+if(this->m_ptr_glVertexAttrib4bv)this->m_ptr_glVertexAttrib4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC)&ProfilingTableDecorator::m_glVertexAttrib4bv_profile;
+this->m_names[2757] = "glMultiTexCoord3xOES";
+this->m_orig_glMultiTexCoord3xOES = this->m_ptr_glMultiTexCoord3xOES;
+if(this->m_ptr_glMultiTexCoord3xOES)this->m_ptr_glMultiTexCoord3xOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3xOES_profile;
+this->m_names[2758] = "glSecondaryColor3ub";
+this->m_orig_glSecondaryColor3ub = this->m_ptr_glSecondaryColor3ub;
+if(this->m_ptr_glSecondaryColor3ub)this->m_ptr_glSecondaryColor3ub = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC)&ProfilingTableDecorator::m_glSecondaryColor3ub_profile;
+this->m_names[2759] = "glFragmentMaterialfSGIX";
+this->m_orig_glFragmentMaterialfSGIX = this->m_ptr_glFragmentMaterialfSGIX;
+if(this->m_ptr_glFragmentMaterialfSGIX)this->m_ptr_glFragmentMaterialfSGIX = (FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC)&ProfilingTableDecorator::m_glFragmentMaterialfSGIX_profile;
+this->m_names[2760] = "glGetVariantArrayObjectivATI";
+this->m_orig_glGetVariantArrayObjectivATI = this->m_ptr_glGetVariantArrayObjectivATI;
+if(this->m_ptr_glGetVariantArrayObjectivATI)this->m_ptr_glGetVariantArrayObjectivATI = (FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC)&ProfilingTableDecorator::m_glGetVariantArrayObjectivATI_profile;
+this->m_names[2761] = "glSecondaryColor3ui";
+this->m_orig_glSecondaryColor3ui = this->m_ptr_glSecondaryColor3ui;
+if(this->m_ptr_glSecondaryColor3ui)this->m_ptr_glSecondaryColor3ui = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC)&ProfilingTableDecorator::m_glSecondaryColor3ui_profile;
+this->m_names[2762] = "glVertexAttrib1dARB";
+this->m_orig_glVertexAttrib1dARB = this->m_ptr_glVertexAttrib1dARB;
+if(this->m_ptr_glVertexAttrib1dARB)this->m_ptr_glVertexAttrib1dARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC)&ProfilingTableDecorator::m_glVertexAttrib1dARB_profile;
+this->m_names[2763] = "glGetNamedBufferPointerv";
+this->m_orig_glGetNamedBufferPointerv = this->m_ptr_glGetNamedBufferPointerv;
+if(this->m_ptr_glGetNamedBufferPointerv)this->m_ptr_glGetNamedBufferPointerv = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC)&ProfilingTableDecorator::m_glGetNamedBufferPointerv_profile;
+this->m_names[2764] = "glLockArraysEXT";
+this->m_orig_glLockArraysEXT = this->m_ptr_glLockArraysEXT;
+if(this->m_ptr_glLockArraysEXT)this->m_ptr_glLockArraysEXT = (FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC)&ProfilingTableDecorator::m_glLockArraysEXT_profile;
+this->m_names[2765] = "glVertexAttribPointerNV";
+this->m_orig_glVertexAttribPointerNV = this->m_ptr_glVertexAttribPointerNV;
+if(this->m_ptr_glVertexAttribPointerNV)this->m_ptr_glVertexAttribPointerNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC)&ProfilingTableDecorator::m_glVertexAttribPointerNV_profile;
+this->m_names[2766] = "glConvolutionParameterf";
+this->m_orig_glConvolutionParameterf = this->m_ptr_glConvolutionParameterf;
+if(this->m_ptr_glConvolutionParameterf)this->m_ptr_glConvolutionParameterf = (FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC)&ProfilingTableDecorator::m_glConvolutionParameterf_profile;
+this->m_names[2767] = "glBindBufferBaseEXT";
+this->m_orig_glBindBufferBaseEXT = this->m_ptr_glBindBufferBaseEXT;
+if(this->m_ptr_glBindBufferBaseEXT)this->m_ptr_glBindBufferBaseEXT = (FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC)&ProfilingTableDecorator::m_glBindBufferBaseEXT_profile;
+this->m_names[2768] = "glTexCoord2xvOES";
+this->m_orig_glTexCoord2xvOES = this->m_ptr_glTexCoord2xvOES;
+if(this->m_ptr_glTexCoord2xvOES)this->m_ptr_glTexCoord2xvOES = (FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC)&ProfilingTableDecorator::m_glTexCoord2xvOES_profile;
+this->m_names[2769] = "glGetQueryBufferObjectui64v";
+this->m_orig_glGetQueryBufferObjectui64v = this->m_ptr_glGetQueryBufferObjectui64v;
+if(this->m_ptr_glGetQueryBufferObjectui64v)this->m_ptr_glGetQueryBufferObjectui64v = (FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC)&ProfilingTableDecorator::m_glGetQueryBufferObjectui64v_profile;
+this->m_names[2770] = "glSetMultisamplefvAMD";
+this->m_orig_glSetMultisamplefvAMD = this->m_ptr_glSetMultisamplefvAMD;
+if(this->m_ptr_glSetMultisamplefvAMD)this->m_ptr_glSetMultisamplefvAMD = (FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC)&ProfilingTableDecorator::m_glSetMultisamplefvAMD_profile;
+this->m_names[2771] = "glPathColorGenNV";
+this->m_orig_glPathColorGenNV = this->m_ptr_glPathColorGenNV;
+if(this->m_ptr_glPathColorGenNV)this->m_ptr_glPathColorGenNV = (FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC)&ProfilingTableDecorator::m_glPathColorGenNV_profile;
+this->m_names[2772] = "glVertexAttrib3sARB";
+this->m_orig_glVertexAttrib3sARB = this->m_ptr_glVertexAttrib3sARB;
+if(this->m_ptr_glVertexAttrib3sARB)this->m_ptr_glVertexAttrib3sARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC)&ProfilingTableDecorator::m_glVertexAttrib3sARB_profile;
+this->m_names[2773] = "glVertexAttrib4ivARB";
+this->m_orig_glVertexAttrib4ivARB = this->m_ptr_glVertexAttrib4ivARB;
+if(this->m_ptr_glVertexAttrib4ivARB)this->m_ptr_glVertexAttrib4ivARB = (FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC)&ProfilingTableDecorator::m_glVertexAttrib4ivARB_profile;
+this->m_names[2774] = "glGenTransformFeedbacks";
+this->m_orig_glGenTransformFeedbacks = this->m_ptr_glGenTransformFeedbacks;
+if(this->m_ptr_glGenTransformFeedbacks)this->m_ptr_glGenTransformFeedbacks = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC)&ProfilingTableDecorator::m_glGenTransformFeedbacks_profile;
+this->m_names[2775] = "glGetVertexAttribIuiv";
+this->m_orig_glGetVertexAttribIuiv = this->m_ptr_glGetVertexAttribIuiv;
+if(this->m_ptr_glGetVertexAttribIuiv)this->m_ptr_glGetVertexAttribIuiv = (FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC)&ProfilingTableDecorator::m_glGetVertexAttribIuiv_profile;
+this->m_names[2776] = "glPixelTransformParameterfEXT";
+this->m_orig_glPixelTransformParameterfEXT = this->m_ptr_glPixelTransformParameterfEXT;
+if(this->m_ptr_glPixelTransformParameterfEXT)this->m_ptr_glPixelTransformParameterfEXT = (FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC)&ProfilingTableDecorator::m_glPixelTransformParameterfEXT_profile;
+this->m_names[2777] = "glGetTexParameterIuivEXT";
+this->m_orig_glGetTexParameterIuivEXT = this->m_ptr_glGetTexParameterIuivEXT;
+if(this->m_ptr_glGetTexParameterIuivEXT)this->m_ptr_glGetTexParameterIuivEXT = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC)&ProfilingTableDecorator::m_glGetTexParameterIuivEXT_profile;
+this->m_names[2778] = "glGetObjectParameterivARB";
+this->m_orig_glGetObjectParameterivARB = this->m_ptr_glGetObjectParameterivARB;
+if(this->m_ptr_glGetObjectParameterivARB)this->m_ptr_glGetObjectParameterivARB = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC)&ProfilingTableDecorator::m_glGetObjectParameterivARB_profile;
+this->m_names[2779] = "glVertexArraySecondaryColorOffsetEXT";
+this->m_orig_glVertexArraySecondaryColorOffsetEXT = this->m_ptr_glVertexArraySecondaryColorOffsetEXT;
+if(this->m_ptr_glVertexArraySecondaryColorOffsetEXT)this->m_ptr_glVertexArraySecondaryColorOffsetEXT = (FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)&ProfilingTableDecorator::m_glVertexArraySecondaryColorOffsetEXT_profile;
+this->m_names[2780] = "glWindowPos2fARB";
+this->m_orig_glWindowPos2fARB = this->m_ptr_glWindowPos2fARB;
+if(this->m_ptr_glWindowPos2fARB)this->m_ptr_glWindowPos2fARB = (FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC)&ProfilingTableDecorator::m_glWindowPos2fARB_profile;
+this->m_names[2781] = "glCompressedTexSubImage2D";
+this->m_orig_glCompressedTexSubImage2D = this->m_ptr_glCompressedTexSubImage2D;
+if(this->m_ptr_glCompressedTexSubImage2D)this->m_ptr_glCompressedTexSubImage2D = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage2D_profile;
+this->m_names[2782] = "glCompressedTexSubImage3DARB";
+this->m_orig_glCompressedTexSubImage3DARB = this->m_ptr_glCompressedTexSubImage3DARB;
+if(this->m_ptr_glCompressedTexSubImage3DARB)this->m_ptr_glCompressedTexSubImage3DARB = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)&ProfilingTableDecorator::m_glCompressedTexSubImage3DARB_profile;
+this->m_names[2783] = "glProgramBinary";
+this->m_orig_glProgramBinary = this->m_ptr_glProgramBinary;
+if(this->m_ptr_glProgramBinary)this->m_ptr_glProgramBinary = (FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC)&ProfilingTableDecorator::m_glProgramBinary_profile;
+this->m_names[2784] = "glPresentFrameKeyedNV";
+this->m_orig_glPresentFrameKeyedNV = this->m_ptr_glPresentFrameKeyedNV;
+if(this->m_ptr_glPresentFrameKeyedNV)this->m_ptr_glPresentFrameKeyedNV = (FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC)&ProfilingTableDecorator::m_glPresentFrameKeyedNV_profile;
+this->m_names[2785] = "glVertexAttribI4bv";
+this->m_orig_glVertexAttribI4bv = this->m_ptr_glVertexAttribI4bv;
+if(this->m_ptr_glVertexAttribI4bv)this->m_ptr_glVertexAttribI4bv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC)&ProfilingTableDecorator::m_glVertexAttribI4bv_profile;
+this->m_names[2786] = "glPathCoverDepthFuncNV";
+this->m_orig_glPathCoverDepthFuncNV = this->m_ptr_glPathCoverDepthFuncNV;
+if(this->m_ptr_glPathCoverDepthFuncNV)this->m_ptr_glPathCoverDepthFuncNV = (FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC)&ProfilingTableDecorator::m_glPathCoverDepthFuncNV_profile;
+this->m_names[2787] = "glTransformFeedbackStreamAttribsNV";
+this->m_orig_glTransformFeedbackStreamAttribsNV = this->m_ptr_glTransformFeedbackStreamAttribsNV;
+if(this->m_ptr_glTransformFeedbackStreamAttribsNV)this->m_ptr_glTransformFeedbackStreamAttribsNV = (FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC)&ProfilingTableDecorator::m_glTransformFeedbackStreamAttribsNV_profile;
+this->m_names[2788] = "glSecondaryColor3usEXT";
+this->m_orig_glSecondaryColor3usEXT = this->m_ptr_glSecondaryColor3usEXT;
+if(this->m_ptr_glSecondaryColor3usEXT)this->m_ptr_glSecondaryColor3usEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3usEXT_profile;
+this->m_names[2789] = "glCopyColorTableSGI";
+this->m_orig_glCopyColorTableSGI = this->m_ptr_glCopyColorTableSGI;
+if(this->m_ptr_glCopyColorTableSGI)this->m_ptr_glCopyColorTableSGI = (FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC)&ProfilingTableDecorator::m_glCopyColorTableSGI_profile;
+this->m_names[2790] = "glProgramEnvParameter4fvARB";
+this->m_orig_glProgramEnvParameter4fvARB = this->m_ptr_glProgramEnvParameter4fvARB;
+if(this->m_ptr_glProgramEnvParameter4fvARB)this->m_ptr_glProgramEnvParameter4fvARB = (FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC)&ProfilingTableDecorator::m_glProgramEnvParameter4fvARB_profile;
+this->m_names[2791] = "glMultiTexCoord4sARB";
+this->m_orig_glMultiTexCoord4sARB = this->m_ptr_glMultiTexCoord4sARB;
+if(this->m_ptr_glMultiTexCoord4sARB)this->m_ptr_glMultiTexCoord4sARB = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC)&ProfilingTableDecorator::m_glMultiTexCoord4sARB_profile;
+this->m_names[2792] = "glGetVertexArrayIndexed64iv";
+this->m_orig_glGetVertexArrayIndexed64iv = this->m_ptr_glGetVertexArrayIndexed64iv;
+if(this->m_ptr_glGetVertexArrayIndexed64iv)this->m_ptr_glGetVertexArrayIndexed64iv = (FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC)&ProfilingTableDecorator::m_glGetVertexArrayIndexed64iv_profile;
+this->m_names[2793] = "glMatrixMultTranspose3x3fNV";
+this->m_orig_glMatrixMultTranspose3x3fNV = this->m_ptr_glMatrixMultTranspose3x3fNV;
+if(this->m_ptr_glMatrixMultTranspose3x3fNV)this->m_ptr_glMatrixMultTranspose3x3fNV = (FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)&ProfilingTableDecorator::m_glMatrixMultTranspose3x3fNV_profile;
+this->m_names[2794] = "glTexParameterIiv";
+this->m_orig_glTexParameterIiv = this->m_ptr_glTexParameterIiv;
+if(this->m_ptr_glTexParameterIiv)this->m_ptr_glTexParameterIiv = (FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC)&ProfilingTableDecorator::m_glTexParameterIiv_profile;
+this->m_names[2795] = "glVertexArrayAttribFormat";
+this->m_orig_glVertexArrayAttribFormat = this->m_ptr_glVertexArrayAttribFormat;
+if(this->m_ptr_glVertexArrayAttribFormat)this->m_ptr_glVertexArrayAttribFormat = (FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC)&ProfilingTableDecorator::m_glVertexArrayAttribFormat_profile;
+this->m_names[2796] = "glEndTransformFeedback";
+this->m_orig_glEndTransformFeedback = this->m_ptr_glEndTransformFeedback;
+if(this->m_ptr_glEndTransformFeedback)this->m_ptr_glEndTransformFeedback = (FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC)&ProfilingTableDecorator::m_glEndTransformFeedback_profile;
+this->m_names[2797] = "glDrawCommandsStatesAddressNV";
+this->m_orig_glDrawCommandsStatesAddressNV = this->m_ptr_glDrawCommandsStatesAddressNV;
+if(this->m_ptr_glDrawCommandsStatesAddressNV)this->m_ptr_glDrawCommandsStatesAddressNV = (FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC)&ProfilingTableDecorator::m_glDrawCommandsStatesAddressNV_profile;
+this->m_names[2798] = "glUniform4ui64NV";
+this->m_orig_glUniform4ui64NV = this->m_ptr_glUniform4ui64NV;
+if(this->m_ptr_glUniform4ui64NV)this->m_ptr_glUniform4ui64NV = (FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC)&ProfilingTableDecorator::m_glUniform4ui64NV_profile;
+this->m_names[2799] = "glMaterialiv";
+this->m_orig_glMaterialiv = this->m_ptr_glMaterialiv;
+if(this->m_ptr_glMaterialiv)this->m_ptr_glMaterialiv = (FunctionTable::MEMBERPFNGLMATERIALIVPROC)&ProfilingTableDecorator::m_glMaterialiv_profile;
+this->m_names[2800] = "glTexImage2DMultisample";
+this->m_orig_glTexImage2DMultisample = this->m_ptr_glTexImage2DMultisample;
+if(this->m_ptr_glTexImage2DMultisample)this->m_ptr_glTexImage2DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexImage2DMultisample_profile;
+this->m_names[2801] = "glBindTextureEXT";
+this->m_orig_glBindTextureEXT = this->m_ptr_glBindTextureEXT;
+if(this->m_ptr_glBindTextureEXT)this->m_ptr_glBindTextureEXT = (FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC)&ProfilingTableDecorator::m_glBindTextureEXT_profile;
+this->m_names[2802] = "glIsBuffer";
+this->m_orig_glIsBuffer = this->m_ptr_glIsBuffer;
+if(this->m_ptr_glIsBuffer)this->m_ptr_glIsBuffer = (FunctionTable::MEMBERPFNGLISBUFFERPROC)&ProfilingTableDecorator::m_glIsBuffer_profile;
+this->m_names[2803] = "glVertexAttribI1iv";
+this->m_orig_glVertexAttribI1iv = this->m_ptr_glVertexAttribI1iv;
+if(this->m_ptr_glVertexAttribI1iv)this->m_ptr_glVertexAttribI1iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC)&ProfilingTableDecorator::m_glVertexAttribI1iv_profile;
+this->m_names[2804] = "glGetFinalCombinerInputParameterfvNV";
+this->m_orig_glGetFinalCombinerInputParameterfvNV = this->m_ptr_glGetFinalCombinerInputParameterfvNV;
+if(this->m_ptr_glGetFinalCombinerInputParameterfvNV)this->m_ptr_glGetFinalCombinerInputParameterfvNV = (FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)&ProfilingTableDecorator::m_glGetFinalCombinerInputParameterfvNV_profile;
+this->m_names[2805] = "glMultiTexCoord3bvOES";
+this->m_orig_glMultiTexCoord3bvOES = this->m_ptr_glMultiTexCoord3bvOES;
+if(this->m_ptr_glMultiTexCoord3bvOES)this->m_ptr_glMultiTexCoord3bvOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord3bvOES_profile;
+this->m_names[2806] = "glVertexAttribDivisor";
+this->m_orig_glVertexAttribDivisor = this->m_ptr_glVertexAttribDivisor;
+if(this->m_ptr_glVertexAttribDivisor)this->m_ptr_glVertexAttribDivisor = (FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC)&ProfilingTableDecorator::m_glVertexAttribDivisor_profile;
+this->m_names[2807] = "glCopyBufferSubData";
+this->m_orig_glCopyBufferSubData = this->m_ptr_glCopyBufferSubData;
+if(this->m_ptr_glCopyBufferSubData)this->m_ptr_glCopyBufferSubData = (FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC)&ProfilingTableDecorator::m_glCopyBufferSubData_profile;
+this->m_names[2808] = "glBindTexGenParameterEXT";
+this->m_orig_glBindTexGenParameterEXT = this->m_ptr_glBindTexGenParameterEXT;
+if(this->m_ptr_glBindTexGenParameterEXT)this->m_ptr_glBindTexGenParameterEXT = (FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC)&ProfilingTableDecorator::m_glBindTexGenParameterEXT_profile;
+this->m_names[2809] = "glNormalStream3bATI";
+this->m_orig_glNormalStream3bATI = this->m_ptr_glNormalStream3bATI;
+if(this->m_ptr_glNormalStream3bATI)this->m_ptr_glNormalStream3bATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC)&ProfilingTableDecorator::m_glNormalStream3bATI_profile;
+this->m_names[2810] = "glTexStorageMem2DEXT";
+this->m_orig_glTexStorageMem2DEXT = this->m_ptr_glTexStorageMem2DEXT;
+if(this->m_ptr_glTexStorageMem2DEXT)this->m_ptr_glTexStorageMem2DEXT = (FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC)&ProfilingTableDecorator::m_glTexStorageMem2DEXT_profile;
+this->m_names[2811] = "glTextureImage2DEXT";
+this->m_orig_glTextureImage2DEXT = this->m_ptr_glTextureImage2DEXT;
+if(this->m_ptr_glTextureImage2DEXT)this->m_ptr_glTextureImage2DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glTextureImage2DEXT_profile;
+this->m_names[2812] = "glGetColorTableParameteriv";
+this->m_orig_glGetColorTableParameteriv = this->m_ptr_glGetColorTableParameteriv;
+if(this->m_ptr_glGetColorTableParameteriv)this->m_ptr_glGetColorTableParameteriv = (FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC)&ProfilingTableDecorator::m_glGetColorTableParameteriv_profile;
+this->m_names[2813] = "glActiveTextureARB";
+this->m_orig_glActiveTextureARB = this->m_ptr_glActiveTextureARB;
+if(this->m_ptr_glActiveTextureARB)this->m_ptr_glActiveTextureARB = (FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC)&ProfilingTableDecorator::m_glActiveTextureARB_profile;
+this->m_names[2814] = "glTexCoord4xOES";
+this->m_orig_glTexCoord4xOES = this->m_ptr_glTexCoord4xOES;
+if(this->m_ptr_glTexCoord4xOES)this->m_ptr_glTexCoord4xOES = (FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC)&ProfilingTableDecorator::m_glTexCoord4xOES_profile;
+this->m_names[2815] = "glNamedBufferStorageExternalEXT";
+this->m_orig_glNamedBufferStorageExternalEXT = this->m_ptr_glNamedBufferStorageExternalEXT;
+if(this->m_ptr_glNamedBufferStorageExternalEXT)this->m_ptr_glNamedBufferStorageExternalEXT = (FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC)&ProfilingTableDecorator::m_glNamedBufferStorageExternalEXT_profile;
+this->m_names[2816] = "glSecondaryColor3fvEXT";
+this->m_orig_glSecondaryColor3fvEXT = this->m_ptr_glSecondaryColor3fvEXT;
+if(this->m_ptr_glSecondaryColor3fvEXT)this->m_ptr_glSecondaryColor3fvEXT = (FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC)&ProfilingTableDecorator::m_glSecondaryColor3fvEXT_profile;
+this->m_names[2817] = "glUniformMatrix4x2fv";
+this->m_orig_glUniformMatrix4x2fv = this->m_ptr_glUniformMatrix4x2fv;
+if(this->m_ptr_glUniformMatrix4x2fv)this->m_ptr_glUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC)&ProfilingTableDecorator::m_glUniformMatrix4x2fv_profile;
+this->m_names[2818] = "glStartInstrumentsSGIX";
+this->m_orig_glStartInstrumentsSGIX = this->m_ptr_glStartInstrumentsSGIX;
+if(this->m_ptr_glStartInstrumentsSGIX)this->m_ptr_glStartInstrumentsSGIX = (FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glStartInstrumentsSGIX_profile;
+this->m_names[2819] = "glProgramNamedParameter4fvNV";
+this->m_orig_glProgramNamedParameter4fvNV = this->m_ptr_glProgramNamedParameter4fvNV;
+if(this->m_ptr_glProgramNamedParameter4fvNV)this->m_ptr_glProgramNamedParameter4fvNV = (FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)&ProfilingTableDecorator::m_glProgramNamedParameter4fvNV_profile;
+this->m_names[2820] = "glEndVideoCaptureNV";
+this->m_orig_glEndVideoCaptureNV = this->m_ptr_glEndVideoCaptureNV;
+if(this->m_ptr_glEndVideoCaptureNV)this->m_ptr_glEndVideoCaptureNV = (FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC)&ProfilingTableDecorator::m_glEndVideoCaptureNV_profile;
+this->m_names[2821] = "glGenLists";
+this->m_orig_glGenLists = this->m_ptr_glGenLists;
+if(this->m_ptr_glGenLists)this->m_ptr_glGenLists = (FunctionTable::MEMBERPFNGLGENLISTSPROC)&ProfilingTableDecorator::m_glGenLists_profile;
+this->m_names[2822] = "glUniform1fARB";
+this->m_orig_glUniform1fARB = this->m_ptr_glUniform1fARB;
+if(this->m_ptr_glUniform1fARB)this->m_ptr_glUniform1fARB = (FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC)&ProfilingTableDecorator::m_glUniform1fARB_profile;
+this->m_names[2823] = "glNamedFramebufferTexture1DEXT";
+this->m_orig_glNamedFramebufferTexture1DEXT = this->m_ptr_glNamedFramebufferTexture1DEXT;
+if(this->m_ptr_glNamedFramebufferTexture1DEXT)this->m_ptr_glNamedFramebufferTexture1DEXT = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)&ProfilingTableDecorator::m_glNamedFramebufferTexture1DEXT_profile;
+this->m_names[2824] = "glMapBufferRange";
+this->m_orig_glMapBufferRange = this->m_ptr_glMapBufferRange;
+if(this->m_ptr_glMapBufferRange)this->m_ptr_glMapBufferRange = (FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC)&ProfilingTableDecorator::m_glMapBufferRange_profile;
+this->m_names[2825] = "glMultiDrawElementsIndirectCountARB";
+this->m_orig_glMultiDrawElementsIndirectCountARB = this->m_ptr_glMultiDrawElementsIndirectCountARB;
+if(this->m_ptr_glMultiDrawElementsIndirectCountARB)this->m_ptr_glMultiDrawElementsIndirectCountARB = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)&ProfilingTableDecorator::m_glMultiDrawElementsIndirectCountARB_profile;
+this->m_names[2826] = "glProgramUniformMatrix4x2fv";
+this->m_orig_glProgramUniformMatrix4x2fv = this->m_ptr_glProgramUniformMatrix4x2fv;
+if(this->m_ptr_glProgramUniformMatrix4x2fv)this->m_ptr_glProgramUniformMatrix4x2fv = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)&ProfilingTableDecorator::m_glProgramUniformMatrix4x2fv_profile;
+this->m_names[2827] = "glGetTextureParameterIivEXT";
+this->m_orig_glGetTextureParameterIivEXT = this->m_ptr_glGetTextureParameterIivEXT;
+if(this->m_ptr_glGetTextureParameterIivEXT)this->m_ptr_glGetTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glGetTextureParameterIivEXT_profile;
+this->m_names[2828] = "glMultiTexCoord3hNV";
+this->m_orig_glMultiTexCoord3hNV = this->m_ptr_glMultiTexCoord3hNV;
+if(this->m_ptr_glMultiTexCoord3hNV)this->m_ptr_glMultiTexCoord3hNV = (FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC)&ProfilingTableDecorator::m_glMultiTexCoord3hNV_profile;
+this->m_names[2829] = "glNamedProgramLocalParametersI4uivEXT";
+this->m_orig_glNamedProgramLocalParametersI4uivEXT = this->m_ptr_glNamedProgramLocalParametersI4uivEXT;
+if(this->m_ptr_glNamedProgramLocalParametersI4uivEXT)this->m_ptr_glNamedProgramLocalParametersI4uivEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParametersI4uivEXT_profile;
+this->m_names[2830] = "glEndList";
+this->m_orig_glEndList = this->m_ptr_glEndList;
+if(this->m_ptr_glEndList)this->m_ptr_glEndList = (FunctionTable::MEMBERPFNGLENDLISTPROC)&ProfilingTableDecorator::m_glEndList_profile;
+this->m_names[2831] = "glTexCoord2fColor4fNormal3fVertex3fSUN";
+this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN;
+if(this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN)this->m_ptr_glTexCoord2fColor4fNormal3fVertex3fSUN = (FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)&ProfilingTableDecorator::m_glTexCoord2fColor4fNormal3fVertex3fSUN_profile;
+this->m_names[2832] = "glGenTransformFeedbacksNV";
+this->m_orig_glGenTransformFeedbacksNV = this->m_ptr_glGenTransformFeedbacksNV;
+if(this->m_ptr_glGenTransformFeedbacksNV)this->m_ptr_glGenTransformFeedbacksNV = (FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC)&ProfilingTableDecorator::m_glGenTransformFeedbacksNV_profile;
+this->m_names[2833] = "glEdgeFlagv";
+this->m_orig_glEdgeFlagv = this->m_ptr_glEdgeFlagv;
+if(this->m_ptr_glEdgeFlagv)this->m_ptr_glEdgeFlagv = (FunctionTable::MEMBERPFNGLEDGEFLAGVPROC)&ProfilingTableDecorator::m_glEdgeFlagv_profile;
+this->m_names[2834] = "glVertexAttribI2iv";
+this->m_orig_glVertexAttribI2iv = this->m_ptr_glVertexAttribI2iv;
+if(this->m_ptr_glVertexAttribI2iv)this->m_ptr_glVertexAttribI2iv = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC)&ProfilingTableDecorator::m_glVertexAttribI2iv_profile;
+this->m_names[2835] = "glCopyMultiTexImage2DEXT";
+this->m_orig_glCopyMultiTexImage2DEXT = this->m_ptr_glCopyMultiTexImage2DEXT;
+if(this->m_ptr_glCopyMultiTexImage2DEXT)this->m_ptr_glCopyMultiTexImage2DEXT = (FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCopyMultiTexImage2DEXT_profile;
+this->m_names[2836] = "glUniformMatrix3x2dv";
+this->m_orig_glUniformMatrix3x2dv = this->m_ptr_glUniformMatrix3x2dv;
+if(this->m_ptr_glUniformMatrix3x2dv)this->m_ptr_glUniformMatrix3x2dv = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC)&ProfilingTableDecorator::m_glUniformMatrix3x2dv_profile;
+this->m_names[2837] = "glTexImage3DMultisampleCoverageNV";
+this->m_orig_glTexImage3DMultisampleCoverageNV = this->m_ptr_glTexImage3DMultisampleCoverageNV;
+if(this->m_ptr_glTexImage3DMultisampleCoverageNV)this->m_ptr_glTexImage3DMultisampleCoverageNV = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)&ProfilingTableDecorator::m_glTexImage3DMultisampleCoverageNV_profile;
+this->m_names[2838] = "glGetShaderPrecisionFormat";
+this->m_orig_glGetShaderPrecisionFormat = this->m_ptr_glGetShaderPrecisionFormat;
+if(this->m_ptr_glGetShaderPrecisionFormat)this->m_ptr_glGetShaderPrecisionFormat = (FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC)&ProfilingTableDecorator::m_glGetShaderPrecisionFormat_profile;
+this->m_names[2839] = "glTexSubImage4DSGIS";
+this->m_orig_glTexSubImage4DSGIS = this->m_ptr_glTexSubImage4DSGIS;
+if(this->m_ptr_glTexSubImage4DSGIS)this->m_ptr_glTexSubImage4DSGIS = (FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC)&ProfilingTableDecorator::m_glTexSubImage4DSGIS_profile;
+this->m_names[2840] = "glRasterSamplesEXT";
+this->m_orig_glRasterSamplesEXT = this->m_ptr_glRasterSamplesEXT;
+if(this->m_ptr_glRasterSamplesEXT)this->m_ptr_glRasterSamplesEXT = (FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC)&ProfilingTableDecorator::m_glRasterSamplesEXT_profile;
+this->m_names[2841] = "glTextureView";
+this->m_orig_glTextureView = this->m_ptr_glTextureView;
+if(this->m_ptr_glTextureView)this->m_ptr_glTextureView = (FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC)&ProfilingTableDecorator::m_glTextureView_profile;
+this->m_names[2842] = "glEvalMapsNV";
+this->m_orig_glEvalMapsNV = this->m_ptr_glEvalMapsNV;
+if(this->m_ptr_glEvalMapsNV)this->m_ptr_glEvalMapsNV = (FunctionTable::MEMBERPFNGLEVALMAPSNVPROC)&ProfilingTableDecorator::m_glEvalMapsNV_profile;
+this->m_names[2843] = "glGetFragDataLocationEXT";
+this->m_orig_glGetFragDataLocationEXT = this->m_ptr_glGetFragDataLocationEXT;
+if(this->m_ptr_glGetFragDataLocationEXT)this->m_ptr_glGetFragDataLocationEXT = (FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC)&ProfilingTableDecorator::m_glGetFragDataLocationEXT_profile;
+this->m_names[2844] = "glGetCompressedMultiTexImageEXT";
+this->m_orig_glGetCompressedMultiTexImageEXT = this->m_ptr_glGetCompressedMultiTexImageEXT;
+if(this->m_ptr_glGetCompressedMultiTexImageEXT)this->m_ptr_glGetCompressedMultiTexImageEXT = (FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)&ProfilingTableDecorator::m_glGetCompressedMultiTexImageEXT_profile;
+this->m_names[2845] = "glIndexMask";
+this->m_orig_glIndexMask = this->m_ptr_glIndexMask;
+if(this->m_ptr_glIndexMask)this->m_ptr_glIndexMask = (FunctionTable::MEMBERPFNGLINDEXMASKPROC)&ProfilingTableDecorator::m_glIndexMask_profile;
+this->m_names[2846] = "glPushClientAttrib";
+this->m_orig_glPushClientAttrib = this->m_ptr_glPushClientAttrib;
+if(this->m_ptr_glPushClientAttrib)this->m_ptr_glPushClientAttrib = (FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC)&ProfilingTableDecorator::m_glPushClientAttrib_profile;
+this->m_names[2847] = "glShaderSource";
+this->m_orig_glShaderSource = this->m_ptr_glShaderSource;
+if(this->m_ptr_glShaderSource)this->m_ptr_glShaderSource = (FunctionTable::MEMBERPFNGLSHADERSOURCEPROC)&ProfilingTableDecorator::m_glShaderSource_profile;
+this->m_names[2848] = "glDispatchComputeGroupSizeARB";
+this->m_orig_glDispatchComputeGroupSizeARB = this->m_ptr_glDispatchComputeGroupSizeARB;
+if(this->m_ptr_glDispatchComputeGroupSizeARB)this->m_ptr_glDispatchComputeGroupSizeARB = (FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)&ProfilingTableDecorator::m_glDispatchComputeGroupSizeARB_profile;
+this->m_names[2849] = "glLGPUNamedBufferSubDataNVX";
+this->m_orig_glLGPUNamedBufferSubDataNVX = this->m_ptr_glLGPUNamedBufferSubDataNVX;
+if(this->m_ptr_glLGPUNamedBufferSubDataNVX)this->m_ptr_glLGPUNamedBufferSubDataNVX = (FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC)&ProfilingTableDecorator::m_glLGPUNamedBufferSubDataNVX_profile;
+this->m_names[2850] = "glGetnPixelMapfv";
+this->m_orig_glGetnPixelMapfv = this->m_ptr_glGetnPixelMapfv;
+if(this->m_ptr_glGetnPixelMapfv)this->m_ptr_glGetnPixelMapfv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC)&ProfilingTableDecorator::m_glGetnPixelMapfv_profile;
+this->m_names[2851] = "glTexCoordP2uiv";
+this->m_orig_glTexCoordP2uiv = this->m_ptr_glTexCoordP2uiv;
+if(this->m_ptr_glTexCoordP2uiv)this->m_ptr_glTexCoordP2uiv = (FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC)&ProfilingTableDecorator::m_glTexCoordP2uiv_profile;
+this->m_names[2852] = "glUniform2f";
+this->m_orig_glUniform2f = this->m_ptr_glUniform2f;
+if(this->m_ptr_glUniform2f)this->m_ptr_glUniform2f = (FunctionTable::MEMBERPFNGLUNIFORM2FPROC)&ProfilingTableDecorator::m_glUniform2f_profile;
+this->m_names[2853] = "glGetNamedBufferParameteri64v";
+this->m_orig_glGetNamedBufferParameteri64v = this->m_ptr_glGetNamedBufferParameteri64v;
+if(this->m_ptr_glGetNamedBufferParameteri64v)this->m_ptr_glGetNamedBufferParameteri64v = (FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC)&ProfilingTableDecorator::m_glGetNamedBufferParameteri64v_profile;
+this->m_names[2854] = "glCommandListSegmentsNV";
+this->m_orig_glCommandListSegmentsNV = this->m_ptr_glCommandListSegmentsNV;
+if(this->m_ptr_glCommandListSegmentsNV)this->m_ptr_glCommandListSegmentsNV = (FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC)&ProfilingTableDecorator::m_glCommandListSegmentsNV_profile;
+this->m_names[2855] = "glTextureParameterIivEXT";
+this->m_orig_glTextureParameterIivEXT = this->m_ptr_glTextureParameterIivEXT;
+if(this->m_ptr_glTextureParameterIivEXT)this->m_ptr_glTextureParameterIivEXT = (FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC)&ProfilingTableDecorator::m_glTextureParameterIivEXT_profile;
+this->m_names[2856] = "glMultiTexParameterfvEXT";
+this->m_orig_glMultiTexParameterfvEXT = this->m_ptr_glMultiTexParameterfvEXT;
+if(this->m_ptr_glMultiTexParameterfvEXT)this->m_ptr_glMultiTexParameterfvEXT = (FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glMultiTexParameterfvEXT_profile;
+this->m_names[2857] = "glProgramUniform2ui64ARB";
+this->m_orig_glProgramUniform2ui64ARB = this->m_ptr_glProgramUniform2ui64ARB;
+if(this->m_ptr_glProgramUniform2ui64ARB)this->m_ptr_glProgramUniform2ui64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform2ui64ARB_profile;
+this->m_names[2858] = "glVertex4d";
+this->m_orig_glVertex4d = this->m_ptr_glVertex4d;
+if(this->m_ptr_glVertex4d)this->m_ptr_glVertex4d = (FunctionTable::MEMBERPFNGLVERTEX4DPROC)&ProfilingTableDecorator::m_glVertex4d_profile;
+this->m_names[2859] = "glNewObjectBufferATI";
+this->m_orig_glNewObjectBufferATI = this->m_ptr_glNewObjectBufferATI;
+if(this->m_ptr_glNewObjectBufferATI)this->m_ptr_glNewObjectBufferATI = (FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glNewObjectBufferATI_profile;
+this->m_names[2860] = "glViewportSwizzleNV";
+this->m_orig_glViewportSwizzleNV = this->m_ptr_glViewportSwizzleNV;
+if(this->m_ptr_glViewportSwizzleNV)this->m_ptr_glViewportSwizzleNV = (FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC)&ProfilingTableDecorator::m_glViewportSwizzleNV_profile;
+this->m_names[2861] = "glBufferData";
+this->m_orig_glBufferData = this->m_ptr_glBufferData;
+if(this->m_ptr_glBufferData)this->m_ptr_glBufferData = (FunctionTable::MEMBERPFNGLBUFFERDATAPROC)&ProfilingTableDecorator::m_glBufferData_profile;
+this->m_names[2862] = "glTextureImage1DEXT";
+this->m_orig_glTextureImage1DEXT = this->m_ptr_glTextureImage1DEXT;
+if(this->m_ptr_glTextureImage1DEXT)this->m_ptr_glTextureImage1DEXT = (FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glTextureImage1DEXT_profile;
+this->m_names[2863] = "glGetTexParameterIiv";
+this->m_orig_glGetTexParameterIiv = this->m_ptr_glGetTexParameterIiv;
+if(this->m_ptr_glGetTexParameterIiv)this->m_ptr_glGetTexParameterIiv = (FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC)&ProfilingTableDecorator::m_glGetTexParameterIiv_profile;
+this->m_names[2864] = "glCopyTexSubImage1DEXT";
+this->m_orig_glCopyTexSubImage1DEXT = this->m_ptr_glCopyTexSubImage1DEXT;
+if(this->m_ptr_glCopyTexSubImage1DEXT)this->m_ptr_glCopyTexSubImage1DEXT = (FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC)&ProfilingTableDecorator::m_glCopyTexSubImage1DEXT_profile;
+this->m_names[2865] = "glVertex4f";
+this->m_orig_glVertex4f = this->m_ptr_glVertex4f;
+if(this->m_ptr_glVertex4f)this->m_ptr_glVertex4f = (FunctionTable::MEMBERPFNGLVERTEX4FPROC)&ProfilingTableDecorator::m_glVertex4f_profile;
+this->m_names[2866] = "glUniformMatrix3fvARB";
+this->m_orig_glUniformMatrix3fvARB = this->m_ptr_glUniformMatrix3fvARB;
+if(this->m_ptr_glUniformMatrix3fvARB)this->m_ptr_glUniformMatrix3fvARB = (FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC)&ProfilingTableDecorator::m_glUniformMatrix3fvARB_profile;
+this->m_names[2867] = "glTexCoordP1ui";
+this->m_orig_glTexCoordP1ui = this->m_ptr_glTexCoordP1ui;
+if(this->m_ptr_glTexCoordP1ui)this->m_ptr_glTexCoordP1ui = (FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC)&ProfilingTableDecorator::m_glTexCoordP1ui_profile;
+this->m_names[2868] = "glPointParameterfvEXT";
+this->m_orig_glPointParameterfvEXT = this->m_ptr_glPointParameterfvEXT;
+if(this->m_ptr_glPointParameterfvEXT)this->m_ptr_glPointParameterfvEXT = (FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC)&ProfilingTableDecorator::m_glPointParameterfvEXT_profile;
+this->m_names[2869] = "glUniform4fARB";
+this->m_orig_glUniform4fARB = this->m_ptr_glUniform4fARB;
+if(this->m_ptr_glUniform4fARB)this->m_ptr_glUniform4fARB = (FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC)&ProfilingTableDecorator::m_glUniform4fARB_profile;
+this->m_names[2870] = "glImportMemoryFdEXT";
+this->m_orig_glImportMemoryFdEXT = this->m_ptr_glImportMemoryFdEXT;
+if(this->m_ptr_glImportMemoryFdEXT)this->m_ptr_glImportMemoryFdEXT = (FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC)&ProfilingTableDecorator::m_glImportMemoryFdEXT_profile;
+this->m_names[2871] = "glCopyTextureSubImage3D";
+this->m_orig_glCopyTextureSubImage3D = this->m_ptr_glCopyTextureSubImage3D;
+if(this->m_ptr_glCopyTextureSubImage3D)this->m_ptr_glCopyTextureSubImage3D = (FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC)&ProfilingTableDecorator::m_glCopyTextureSubImage3D_profile;
+this->m_names[2872] = "glMultiTexCoord2fv";
+this->m_orig_glMultiTexCoord2fv = this->m_ptr_glMultiTexCoord2fv;
+if(this->m_ptr_glMultiTexCoord2fv)this->m_ptr_glMultiTexCoord2fv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC)&ProfilingTableDecorator::m_glMultiTexCoord2fv_profile;
+this->m_names[2873] = "glNamedFramebufferSamplePositionsfvAMD";
+this->m_orig_glNamedFramebufferSamplePositionsfvAMD = this->m_ptr_glNamedFramebufferSamplePositionsfvAMD;
+if(this->m_ptr_glNamedFramebufferSamplePositionsfvAMD)this->m_ptr_glNamedFramebufferSamplePositionsfvAMD = (FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC)&ProfilingTableDecorator::m_glNamedFramebufferSamplePositionsfvAMD_profile;
+this->m_names[2874] = "glNormalP3ui";
+this->m_orig_glNormalP3ui = this->m_ptr_glNormalP3ui;
+if(this->m_ptr_glNormalP3ui)this->m_ptr_glNormalP3ui = (FunctionTable::MEMBERPFNGLNORMALP3UIPROC)&ProfilingTableDecorator::m_glNormalP3ui_profile;
+this->m_names[2875] = "glDrawRangeElementArrayATI";
+this->m_orig_glDrawRangeElementArrayATI = this->m_ptr_glDrawRangeElementArrayATI;
+if(this->m_ptr_glDrawRangeElementArrayATI)this->m_ptr_glDrawRangeElementArrayATI = (FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC)&ProfilingTableDecorator::m_glDrawRangeElementArrayATI_profile;
+this->m_names[2876] = "glVertexAttribI1i";
+this->m_orig_glVertexAttribI1i = this->m_ptr_glVertexAttribI1i;
+if(this->m_ptr_glVertexAttribI1i)this->m_ptr_glVertexAttribI1i = (FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC)&ProfilingTableDecorator::m_glVertexAttribI1i_profile;
+this->m_names[2877] = "glDrawArraysInstancedARB";
+this->m_orig_glDrawArraysInstancedARB = this->m_ptr_glDrawArraysInstancedARB;
+if(this->m_ptr_glDrawArraysInstancedARB)this->m_ptr_glDrawArraysInstancedARB = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedARB_profile;
+this->m_names[2878] = "glEnableVertexAttribAPPLE";
+this->m_orig_glEnableVertexAttribAPPLE = this->m_ptr_glEnableVertexAttribAPPLE;
+if(this->m_ptr_glEnableVertexAttribAPPLE)this->m_ptr_glEnableVertexAttribAPPLE = (FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC)&ProfilingTableDecorator::m_glEnableVertexAttribAPPLE_profile;
+this->m_names[2879] = "glGetDebugMessageLogARB";
+this->m_orig_glGetDebugMessageLogARB = this->m_ptr_glGetDebugMessageLogARB;
+if(this->m_ptr_glGetDebugMessageLogARB)this->m_ptr_glGetDebugMessageLogARB = (FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC)&ProfilingTableDecorator::m_glGetDebugMessageLogARB_profile;
+this->m_names[2880] = "glGetPathTexGenfvNV";
+this->m_orig_glGetPathTexGenfvNV = this->m_ptr_glGetPathTexGenfvNV;
+if(this->m_ptr_glGetPathTexGenfvNV)this->m_ptr_glGetPathTexGenfvNV = (FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC)&ProfilingTableDecorator::m_glGetPathTexGenfvNV_profile;
+this->m_names[2881] = "glNamedProgramLocalParameters4fvEXT";
+this->m_orig_glNamedProgramLocalParameters4fvEXT = this->m_ptr_glNamedProgramLocalParameters4fvEXT;
+if(this->m_ptr_glNamedProgramLocalParameters4fvEXT)this->m_ptr_glNamedProgramLocalParameters4fvEXT = (FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)&ProfilingTableDecorator::m_glNamedProgramLocalParameters4fvEXT_profile;
+this->m_names[2882] = "glQueryResourceTagNV";
+this->m_orig_glQueryResourceTagNV = this->m_ptr_glQueryResourceTagNV;
+if(this->m_ptr_glQueryResourceTagNV)this->m_ptr_glQueryResourceTagNV = (FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC)&ProfilingTableDecorator::m_glQueryResourceTagNV_profile;
+this->m_names[2883] = "glVertexStream3fvATI";
+this->m_orig_glVertexStream3fvATI = this->m_ptr_glVertexStream3fvATI;
+if(this->m_ptr_glVertexStream3fvATI)this->m_ptr_glVertexStream3fvATI = (FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC)&ProfilingTableDecorator::m_glVertexStream3fvATI_profile;
+this->m_names[2884] = "glFramebufferTexture3D";
+this->m_orig_glFramebufferTexture3D = this->m_ptr_glFramebufferTexture3D;
+if(this->m_ptr_glFramebufferTexture3D)this->m_ptr_glFramebufferTexture3D = (FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC)&ProfilingTableDecorator::m_glFramebufferTexture3D_profile;
+this->m_names[2885] = "glCompressedTextureSubImage2DEXT";
+this->m_orig_glCompressedTextureSubImage2DEXT = this->m_ptr_glCompressedTextureSubImage2DEXT;
+if(this->m_ptr_glCompressedTextureSubImage2DEXT)this->m_ptr_glCompressedTextureSubImage2DEXT = (FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)&ProfilingTableDecorator::m_glCompressedTextureSubImage2DEXT_profile;
+this->m_names[2886] = "glWindowPos3dv";
+this->m_orig_glWindowPos3dv = this->m_ptr_glWindowPos3dv;
+if(this->m_ptr_glWindowPos3dv)this->m_ptr_glWindowPos3dv = (FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC)&ProfilingTableDecorator::m_glWindowPos3dv_profile;
+this->m_names[2887] = "glCopyConvolutionFilter2D";
+this->m_orig_glCopyConvolutionFilter2D = this->m_ptr_glCopyConvolutionFilter2D;
+if(this->m_ptr_glCopyConvolutionFilter2D)this->m_ptr_glCopyConvolutionFilter2D = (FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC)&ProfilingTableDecorator::m_glCopyConvolutionFilter2D_profile;
+this->m_names[2888] = "glReadInstrumentsSGIX";
+this->m_orig_glReadInstrumentsSGIX = this->m_ptr_glReadInstrumentsSGIX;
+if(this->m_ptr_glReadInstrumentsSGIX)this->m_ptr_glReadInstrumentsSGIX = (FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC)&ProfilingTableDecorator::m_glReadInstrumentsSGIX_profile;
+this->m_names[2889] = "glProgramUniform2dvEXT";
+this->m_orig_glProgramUniform2dvEXT = this->m_ptr_glProgramUniform2dvEXT;
+if(this->m_ptr_glProgramUniform2dvEXT)this->m_ptr_glProgramUniform2dvEXT = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC)&ProfilingTableDecorator::m_glProgramUniform2dvEXT_profile;
+this->m_names[2890] = "glSamplerParameterfv";
+this->m_orig_glSamplerParameterfv = this->m_ptr_glSamplerParameterfv;
+if(this->m_ptr_glSamplerParameterfv)this->m_ptr_glSamplerParameterfv = (FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC)&ProfilingTableDecorator::m_glSamplerParameterfv_profile;
+this->m_names[2891] = "glBindBufferARB";
+this->m_orig_glBindBufferARB = this->m_ptr_glBindBufferARB;
+if(this->m_ptr_glBindBufferARB)this->m_ptr_glBindBufferARB = (FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC)&ProfilingTableDecorator::m_glBindBufferARB_profile;
+this->m_names[2892] = "glVertexAttrib1sNV";
+this->m_orig_glVertexAttrib1sNV = this->m_ptr_glVertexAttrib1sNV;
+if(this->m_ptr_glVertexAttrib1sNV)this->m_ptr_glVertexAttrib1sNV = (FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC)&ProfilingTableDecorator::m_glVertexAttrib1sNV_profile;
+this->m_names[2893] = "glGetMaterialiv";
+this->m_orig_glGetMaterialiv = this->m_ptr_glGetMaterialiv;
+if(this->m_ptr_glGetMaterialiv)this->m_ptr_glGetMaterialiv = (FunctionTable::MEMBERPFNGLGETMATERIALIVPROC)&ProfilingTableDecorator::m_glGetMaterialiv_profile;
+this->m_names[2894] = "glUniform1fv";
+this->m_orig_glUniform1fv = this->m_ptr_glUniform1fv;
+if(this->m_ptr_glUniform1fv)this->m_ptr_glUniform1fv = (FunctionTable::MEMBERPFNGLUNIFORM1FVPROC)&ProfilingTableDecorator::m_glUniform1fv_profile;
+this->m_names[2895] = "glBeginOcclusionQueryNV";
+this->m_orig_glBeginOcclusionQueryNV = this->m_ptr_glBeginOcclusionQueryNV;
+if(this->m_ptr_glBeginOcclusionQueryNV)this->m_ptr_glBeginOcclusionQueryNV = (FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC)&ProfilingTableDecorator::m_glBeginOcclusionQueryNV_profile;
+this->m_names[2896] = "glGenFencesAPPLE";
+this->m_orig_glGenFencesAPPLE = this->m_ptr_glGenFencesAPPLE;
+if(this->m_ptr_glGenFencesAPPLE)this->m_ptr_glGenFencesAPPLE = (FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC)&ProfilingTableDecorator::m_glGenFencesAPPLE_profile;
+this->m_names[2897] = "glScissorIndexedv";
+this->m_orig_glScissorIndexedv = this->m_ptr_glScissorIndexedv;
+if(this->m_ptr_glScissorIndexedv)this->m_ptr_glScissorIndexedv = (FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC)&ProfilingTableDecorator::m_glScissorIndexedv_profile;
+this->m_names[2898] = "glDisableVariantClientStateEXT";
+this->m_orig_glDisableVariantClientStateEXT = this->m_ptr_glDisableVariantClientStateEXT;
+if(this->m_ptr_glDisableVariantClientStateEXT)this->m_ptr_glDisableVariantClientStateEXT = (FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)&ProfilingTableDecorator::m_glDisableVariantClientStateEXT_profile;
+this->m_names[2899] = "glMinmaxEXT";
+this->m_orig_glMinmaxEXT = this->m_ptr_glMinmaxEXT;
+if(this->m_ptr_glMinmaxEXT)this->m_ptr_glMinmaxEXT = (FunctionTable::MEMBERPFNGLMINMAXEXTPROC)&ProfilingTableDecorator::m_glMinmaxEXT_profile;
+this->m_names[2900] = "glNormalPointervINTEL";
+this->m_orig_glNormalPointervINTEL = this->m_ptr_glNormalPointervINTEL;
+if(this->m_ptr_glNormalPointervINTEL)this->m_ptr_glNormalPointervINTEL = (FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC)&ProfilingTableDecorator::m_glNormalPointervINTEL_profile;
+this->m_names[2901] = "glNormal3s";
+this->m_orig_glNormal3s = this->m_ptr_glNormal3s;
+if(this->m_ptr_glNormal3s)this->m_ptr_glNormal3s = (FunctionTable::MEMBERPFNGLNORMAL3SPROC)&ProfilingTableDecorator::m_glNormal3s_profile;
+this->m_names[2902] = "glGetnPixelMapuiv";
+this->m_orig_glGetnPixelMapuiv = this->m_ptr_glGetnPixelMapuiv;
+if(this->m_ptr_glGetnPixelMapuiv)this->m_ptr_glGetnPixelMapuiv = (FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC)&ProfilingTableDecorator::m_glGetnPixelMapuiv_profile;
+this->m_names[2903] = "glNormalStream3bvATI";
+this->m_orig_glNormalStream3bvATI = this->m_ptr_glNormalStream3bvATI;
+if(this->m_ptr_glNormalStream3bvATI)this->m_ptr_glNormalStream3bvATI = (FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC)&ProfilingTableDecorator::m_glNormalStream3bvATI_profile;
+this->m_names[2904] = "glGetObjectParameterivAPPLE";
+this->m_orig_glGetObjectParameterivAPPLE = this->m_ptr_glGetObjectParameterivAPPLE;
+if(this->m_ptr_glGetObjectParameterivAPPLE)this->m_ptr_glGetObjectParameterivAPPLE = (FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC)&ProfilingTableDecorator::m_glGetObjectParameterivAPPLE_profile;
+this->m_names[2905] = "glNormal3i";
+this->m_orig_glNormal3i = this->m_ptr_glNormal3i;
+if(this->m_ptr_glNormal3i)this->m_ptr_glNormal3i = (FunctionTable::MEMBERPFNGLNORMAL3IPROC)&ProfilingTableDecorator::m_glNormal3i_profile;
+this->m_names[2906] = "glUniform1ivARB";
+this->m_orig_glUniform1ivARB = this->m_ptr_glUniform1ivARB;
+if(this->m_ptr_glUniform1ivARB)this->m_ptr_glUniform1ivARB = (FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC)&ProfilingTableDecorator::m_glUniform1ivARB_profile;
+this->m_names[2907] = "glNormal3d";
+this->m_orig_glNormal3d = this->m_ptr_glNormal3d;
+if(this->m_ptr_glNormal3d)this->m_ptr_glNormal3d = (FunctionTable::MEMBERPFNGLNORMAL3DPROC)&ProfilingTableDecorator::m_glNormal3d_profile;
+this->m_names[2908] = "glUpdateObjectBufferATI";
+this->m_orig_glUpdateObjectBufferATI = this->m_ptr_glUpdateObjectBufferATI;
+if(this->m_ptr_glUpdateObjectBufferATI)this->m_ptr_glUpdateObjectBufferATI = (FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC)&ProfilingTableDecorator::m_glUpdateObjectBufferATI_profile;
+this->m_names[2909] = "glNormal3b";
+this->m_orig_glNormal3b = this->m_ptr_glNormal3b;
+if(this->m_ptr_glNormal3b)this->m_ptr_glNormal3b = (FunctionTable::MEMBERPFNGLNORMAL3BPROC)&ProfilingTableDecorator::m_glNormal3b_profile;
+this->m_names[2910] = "glGetUniformBufferSizeEXT";
+this->m_orig_glGetUniformBufferSizeEXT = this->m_ptr_glGetUniformBufferSizeEXT;
+if(this->m_ptr_glGetUniformBufferSizeEXT)this->m_ptr_glGetUniformBufferSizeEXT = (FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC)&ProfilingTableDecorator::m_glGetUniformBufferSizeEXT_profile;
+this->m_names[2911] = "glMultiTexCoord4dv";
+this->m_orig_glMultiTexCoord4dv = this->m_ptr_glMultiTexCoord4dv;
+if(this->m_ptr_glMultiTexCoord4dv)this->m_ptr_glMultiTexCoord4dv = (FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC)&ProfilingTableDecorator::m_glMultiTexCoord4dv_profile;
+this->m_names[2912] = "glProgramUniform3i64ARB";
+this->m_orig_glProgramUniform3i64ARB = this->m_ptr_glProgramUniform3i64ARB;
+if(this->m_ptr_glProgramUniform3i64ARB)this->m_ptr_glProgramUniform3i64ARB = (FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC)&ProfilingTableDecorator::m_glProgramUniform3i64ARB_profile;
+this->m_names[2913] = "glVertexAttrib2d";
+this->m_orig_glVertexAttrib2d = this->m_ptr_glVertexAttrib2d;
+if(this->m_ptr_glVertexAttrib2d)this->m_ptr_glVertexAttrib2d = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC)&ProfilingTableDecorator::m_glVertexAttrib2d_profile;
+this->m_names[2914] = "glVertexAttrib2f";
+this->m_orig_glVertexAttrib2f = this->m_ptr_glVertexAttrib2f;
+if(this->m_ptr_glVertexAttrib2f)this->m_ptr_glVertexAttrib2f = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC)&ProfilingTableDecorator::m_glVertexAttrib2f_profile;
+this->m_names[2915] = "glMultiDrawElementsEXT";
+this->m_orig_glMultiDrawElementsEXT = this->m_ptr_glMultiDrawElementsEXT;
+if(this->m_ptr_glMultiDrawElementsEXT)this->m_ptr_glMultiDrawElementsEXT = (FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC)&ProfilingTableDecorator::m_glMultiDrawElementsEXT_profile;
+this->m_names[2916] = "glVertexAttrib3dv";
+this->m_orig_glVertexAttrib3dv = this->m_ptr_glVertexAttrib3dv;
+if(this->m_ptr_glVertexAttrib3dv)this->m_ptr_glVertexAttrib3dv = (FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC)&ProfilingTableDecorator::m_glVertexAttrib3dv_profile;
+this->m_names[2917] = "glMultiTexCoord2bOES";
+this->m_orig_glMultiTexCoord2bOES = this->m_ptr_glMultiTexCoord2bOES;
+if(this->m_ptr_glMultiTexCoord2bOES)this->m_ptr_glMultiTexCoord2bOES = (FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC)&ProfilingTableDecorator::m_glMultiTexCoord2bOES_profile;
+this->m_names[2918] = "glVertexAttrib2s";
+this->m_orig_glVertexAttrib2s = this->m_ptr_glVertexAttrib2s;
+if(this->m_ptr_glVertexAttrib2s)this->m_ptr_glVertexAttrib2s = (FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC)&ProfilingTableDecorator::m_glVertexAttrib2s_profile;
+this->m_names[2919] = "glTexImage3DMultisample";
+this->m_orig_glTexImage3DMultisample = this->m_ptr_glTexImage3DMultisample;
+if(this->m_ptr_glTexImage3DMultisample)this->m_ptr_glTexImage3DMultisample = (FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC)&ProfilingTableDecorator::m_glTexImage3DMultisample_profile;
+this->m_names[2920] = "glGetUniformBlockIndex";
+this->m_orig_glGetUniformBlockIndex = this->m_ptr_glGetUniformBlockIndex;
+if(this->m_ptr_glGetUniformBlockIndex)this->m_ptr_glGetUniformBlockIndex = (FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC)&ProfilingTableDecorator::m_glGetUniformBlockIndex_profile;
+this->m_names[2921] = "glReleaseKeyedMutexWin32EXT";
+this->m_orig_glReleaseKeyedMutexWin32EXT = this->m_ptr_glReleaseKeyedMutexWin32EXT;
+if(this->m_ptr_glReleaseKeyedMutexWin32EXT)this->m_ptr_glReleaseKeyedMutexWin32EXT = (FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC)&ProfilingTableDecorator::m_glReleaseKeyedMutexWin32EXT_profile;
+this->m_names[2922] = "glFrontFace";
+this->m_orig_glFrontFace = this->m_ptr_glFrontFace;
+if(this->m_ptr_glFrontFace)this->m_ptr_glFrontFace = (FunctionTable::MEMBERPFNGLFRONTFACEPROC)&ProfilingTableDecorator::m_glFrontFace_profile;
+this->m_names[2923] = "glEvalCoord1xOES";
+this->m_orig_glEvalCoord1xOES = this->m_ptr_glEvalCoord1xOES;
+if(this->m_ptr_glEvalCoord1xOES)this->m_ptr_glEvalCoord1xOES = (FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC)&ProfilingTableDecorator::m_glEvalCoord1xOES_profile;
+this->m_names[2924] = "glDrawArraysInstancedBaseInstance";
+this->m_orig_glDrawArraysInstancedBaseInstance = this->m_ptr_glDrawArraysInstancedBaseInstance;
+if(this->m_ptr_glDrawArraysInstancedBaseInstance)this->m_ptr_glDrawArraysInstancedBaseInstance = (FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)&ProfilingTableDecorator::m_glDrawArraysInstancedBaseInstance_profile;
+this->m_names[2925] = "glIsPointInStrokePathNV";
+this->m_orig_glIsPointInStrokePathNV = this->m_ptr_glIsPointInStrokePathNV;
+if(this->m_ptr_glIsPointInStrokePathNV)this->m_ptr_glIsPointInStrokePathNV = (FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC)&ProfilingTableDecorator::m_glIsPointInStrokePathNV_profile;
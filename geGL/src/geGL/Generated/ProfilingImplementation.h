@@ -0,0 +1,5852 @@
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC m_orig_glMultiDrawArraysIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessCountNV_profile(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{ProfilingScope const scope(this,0);(this->*(this->m_orig_glMultiDrawArraysIndirectBindlessCountNV))(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVPROC m_orig_glTextureParameterfv = nullptr;
+void m_glTextureParameterfv_profile(GLuint texture,GLenum pname,const GLfloat* param)const{ProfilingScope const scope(this,1);(this->*(this->m_orig_glTextureParameterfv))(texture,pname,param);}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERIVSGIXPROC m_orig_glGetListParameterivSGIX = nullptr;
+void m_glGetListParameterivSGIX_profile(GLuint list,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2);(this->*(this->m_orig_glGetListParameterivSGIX))(list,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64ARBPROC m_orig_glProgramUniform1i64ARB = nullptr;
+void m_glProgramUniform1i64ARB_profile(GLuint program,GLint location,GLint64 x)const{ProfilingScope const scope(this,3);(this->*(this->m_orig_glProgramUniform1i64ARB))(program,location,x);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYELEMENTBUFFERPROC m_orig_glVertexArrayElementBuffer = nullptr;
+void m_glVertexArrayElementBuffer_profile(GLuint vaobj,GLuint buffer)const{ProfilingScope const scope(this,4);(this->*(this->m_orig_glVertexArrayElementBuffer))(vaobj,buffer);}
+FunctionTable::MEMBERPFNGLHINTPGIPROC m_orig_glHintPGI = nullptr;
+void m_glHintPGI_profile(GLenum target,GLint mode)const{ProfilingScope const scope(this,5);(this->*(this->m_orig_glHintPGI))(target,mode);}
+FunctionTable::MEMBERPFNGLSTENCILMASKSEPARATEPROC m_orig_glStencilMaskSeparate = nullptr;
+void m_glStencilMaskSeparate_profile(GLenum face,GLuint mask)const{ProfilingScope const scope(this,6);(this->*(this->m_orig_glStencilMaskSeparate))(face,mask);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_orig_glGetFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetFramebufferAttachmentParameterivEXT_profile(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{ProfilingScope const scope(this,7);(this->*(this->m_orig_glGetFramebufferAttachmentParameterivEXT))(target,attachment,pname,params);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEPROC m_orig_glTextureStorage3DMultisample = nullptr;
+void m_glTextureStorage3DMultisample_profile(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,8);(this->*(this->m_orig_glTextureStorage3DMultisample))(texture,samples,internalformat,width,height,depth,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLGETINTEGERINDEXEDVEXTPROC m_orig_glGetIntegerIndexedvEXT = nullptr;
+void m_glGetIntegerIndexedvEXT_profile(GLenum target,GLuint index,GLint* data)const{ProfilingScope const scope(this,9);(this->*(this->m_orig_glGetIntegerIndexedvEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DPROC m_orig_glCopyTexImage1D = nullptr;
+void m_glCopyTexImage1D_profile(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{ProfilingScope const scope(this,10);(this->*(this->m_orig_glCopyTexImage1D))(target,level,internalformat,x,y,width,border);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVPROC m_orig_glVertexAttrib4usv = nullptr;
+void m_glVertexAttrib4usv_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,11);(this->*(this->m_orig_glVertexAttrib4usv))(index,v);}
+FunctionTable::MEMBERPFNGLTEXRENDERBUFFERNVPROC m_orig_glTexRenderbufferNV = nullptr;
+void m_glTexRenderbufferNV_profile(GLenum target,GLuint renderbuffer)const{ProfilingScope const scope(this,12);(this->*(this->m_orig_glTexRenderbufferNV))(target,renderbuffer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HVNVPROC m_orig_glVertexAttrib3hvNV = nullptr;
+void m_glVertexAttrib3hvNV_profile(GLuint index,const GLhalfNV* v)const{ProfilingScope const scope(this,13);(this->*(this->m_orig_glVertexAttrib3hvNV))(index,v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64ARBPROC m_orig_glProgramUniform4ui64ARB = nullptr;
+void m_glProgramUniform4ui64ARB_profile(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{ProfilingScope const scope(this,14);(this->*(this->m_orig_glProgramUniform4ui64ARB))(program,location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLINSTRUMENTSBUFFERSGIXPROC m_orig_glInstrumentsBufferSGIX = nullptr;
+void m_glInstrumentsBufferSGIX_profile(GLsizei size,GLint* buffer)const{ProfilingScope const scope(this,15);(this->*(this->m_orig_glInstrumentsBufferSGIX))(size,buffer);}
+FunctionTable::MEMBERPFNGLINDEXIPROC m_orig_glIndexi = nullptr;
+void m_glIndexi_profile(GLint c)const{ProfilingScope const scope(this,16);(this->*(this->m_orig_glIndexi))(c);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SARBPROC m_orig_glMultiTexCoord2sARB = nullptr;
+void m_glMultiTexCoord2sARB_profile(GLenum target,GLshort s,GLshort t)const{ProfilingScope const scope(this,17);(this->*(this->m_orig_glMultiTexCoord2sARB))(target,s,t);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FARBPROC m_orig_glProgramEnvParameter4fARB = nullptr;
+void m_glProgramEnvParameter4fARB_profile(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,18);(this->*(this->m_orig_glProgramEnvParameter4fARB))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DPROC m_orig_glCompressedTexSubImage3D = nullptr;
+void m_glCompressedTexSubImage3D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,19);(this->*(this->m_orig_glCompressedTexSubImage3D))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLEVALCOORD2DPROC m_orig_glEvalCoord2d = nullptr;
+void m_glEvalCoord2d_profile(GLdouble u,GLdouble v)const{ProfilingScope const scope(this,20);(this->*(this->m_orig_glEvalCoord2d))(u,v);}
+FunctionTable::MEMBERPFNGLEVALCOORD2FPROC m_orig_glEvalCoord2f = nullptr;
+void m_glEvalCoord2f_profile(GLfloat u,GLfloat v)const{ProfilingScope const scope(this,21);(this->*(this->m_orig_glEvalCoord2f))(u,v);}
+FunctionTable::MEMBERPFNGLINDEXDPROC m_orig_glIndexd = nullptr;
+void m_glIndexd_profile(GLdouble c)const{ProfilingScope const scope(this,22);(this->*(this->m_orig_glIndexd))(c);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HVNVPROC m_orig_glSecondaryColor3hvNV = nullptr;
+void m_glSecondaryColor3hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,23);(this->*(this->m_orig_glSecondaryColor3hvNV))(v);}
+FunctionTable::MEMBERPFNGLINDEXFPROC m_orig_glIndexf = nullptr;
+void m_glIndexf_profile(GLfloat c)const{ProfilingScope const scope(this,24);(this->*(this->m_orig_glIndexf))(c);}
+FunctionTable::MEMBERPFNGLFRUSTUMXOESPROC m_orig_glFrustumxOES = nullptr;
+void m_glFrustumxOES_profile(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{ProfilingScope const scope(this,25);(this->*(this->m_orig_glFrustumxOES))(l,r,b,t,n,f);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DEXTPROC m_orig_glTextureStorage3DEXT = nullptr;
+void m_glTextureStorage3DEXT_profile(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,26);(this->*(this->m_orig_glTextureStorage3DEXT))(texture,target,levels,internalformat,width,height,depth);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESNVPROC m_orig_glDrawCommandsStatesNV = nullptr;
+void m_glDrawCommandsStatesNV_profile(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{ProfilingScope const scope(this,27);(this->*(this->m_orig_glDrawCommandsStatesNV))(buffer,indirects,sizes,states,fbos,count);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIEXTPROC m_orig_glUniform4uiEXT = nullptr;
+void m_glUniform4uiEXT_profile(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{ProfilingScope const scope(this,28);(this->*(this->m_orig_glUniform4uiEXT))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64ARBPROC m_orig_glProgramUniform3ui64ARB = nullptr;
+void m_glProgramUniform3ui64ARB_profile(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{ProfilingScope const scope(this,29);(this->*(this->m_orig_glProgramUniform3ui64ARB))(program,location,x,y,z);}
+FunctionTable::MEMBERPFNGLINDEXSPROC m_orig_glIndexs = nullptr;
+void m_glIndexs_profile(GLshort c)const{ProfilingScope const scope(this,30);(this->*(this->m_orig_glIndexs))(c);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC m_orig_glVertexArrayBindVertexBufferEXT = nullptr;
+void m_glVertexArrayBindVertexBufferEXT_profile(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{ProfilingScope const scope(this,31);(this->*(this->m_orig_glVertexArrayBindVertexBufferEXT))(vaobj,bindingindex,buffer,offset,stride);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIEXTPROC m_orig_glConvolutionParameteriEXT = nullptr;
+void m_glConvolutionParameteriEXT_profile(GLenum target,GLenum pname,GLint params)const{ProfilingScope const scope(this,32);(this->*(this->m_orig_glConvolutionParameteriEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FSUNPROC m_orig_glColor4ubVertex2fSUN = nullptr;
+void m_glColor4ubVertex2fSUN_profile(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,33);(this->*(this->m_orig_glColor4ubVertex2fSUN))(r,g,b,a,x,y);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVEXTPROC m_orig_glProgramUniform1ivEXT = nullptr;
+void m_glProgramUniform1ivEXT_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,34);(this->*(this->m_orig_glProgramUniform1ivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETNMAPFVPROC m_orig_glGetnMapfv = nullptr;
+void m_glGetnMapfv_profile(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{ProfilingScope const scope(this,35);(this->*(this->m_orig_glGetnMapfv))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC m_orig_glTransformFeedbackBufferRange = nullptr;
+void m_glTransformFeedbackBufferRange_profile(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,36);(this->*(this->m_orig_glTransformFeedbackBufferRange))(xfb,index,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLPATHGLYPHSNVPROC m_orig_glPathGlyphsNV = nullptr;
+void m_glPathGlyphsNV_profile(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{ProfilingScope const scope(this,37);(this->*(this->m_orig_glPathGlyphsNV))(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVPROC m_orig_glSecondaryColor3fv = nullptr;
+void m_glSecondaryColor3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,38);(this->*(this->m_orig_glSecondaryColor3fv))(v);}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERIVNVPROC m_orig_glGetCombinerInputParameterivNV = nullptr;
+void m_glGetCombinerInputParameterivNV_profile(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params)const{ProfilingScope const scope(this,39);(this->*(this->m_orig_glGetCombinerInputParameterivNV))(stage,portion,variable,pname,params);}
+FunctionTable::MEMBERPFNGLENDPERFMONITORAMDPROC m_orig_glEndPerfMonitorAMD = nullptr;
+void m_glEndPerfMonitorAMD_profile(GLuint monitor)const{ProfilingScope const scope(this,40);(this->*(this->m_orig_glEndPerfMonitorAMD))(monitor);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVARBPROC m_orig_glPointParameterfvARB = nullptr;
+void m_glPointParameterfvARB_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,41);(this->*(this->m_orig_glPointParameterfvARB))(pname,params);}
+FunctionTable::MEMBERPFNGLVERTEX2XOESPROC m_orig_glVertex2xOES = nullptr;
+void m_glVertex2xOES_profile(GLfixed x)const{ProfilingScope const scope(this,42);(this->*(this->m_orig_glVertex2xOES))(x);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC m_orig_glDrawElementsInstancedBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseInstance_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance)const{ProfilingScope const scope(this,43);(this->*(this->m_orig_glDrawElementsInstancedBaseInstance))(mode,count,type,indices,instancecount,baseinstance);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDARBPROC m_orig_glMultTransposeMatrixdARB = nullptr;
+void m_glMultTransposeMatrixdARB_profile(const GLdouble* m)const{ProfilingScope const scope(this,44);(this->*(this->m_orig_glMultTransposeMatrixdARB))(m);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DEXTPROC m_orig_glVertexAttribL4dEXT = nullptr;
+void m_glVertexAttribL4dEXT_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,45);(this->*(this->m_orig_glVertexAttribL4dEXT))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEX4IVPROC m_orig_glVertex4iv = nullptr;
+void m_glVertex4iv_profile(const GLint* v)const{ProfilingScope const scope(this,46);(this->*(this->m_orig_glVertex4iv))(v);}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHINSTANCEDNVPROC m_orig_glCoverStrokePathInstancedNV = nullptr;
+void m_glCoverStrokePathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,47);(this->*(this->m_orig_glCoverStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLDEFORMSGIXPROC m_orig_glDeformSGIX = nullptr;
+void m_glDeformSGIX_profile(GLbitfield mask)const{ProfilingScope const scope(this,48);(this->*(this->m_orig_glDeformSGIX))(mask);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64NVPROC m_orig_glUniform2ui64NV = nullptr;
+void m_glUniform2ui64NV_profile(GLint location,GLuint64EXT x,GLuint64EXT y)const{ProfilingScope const scope(this,49);(this->*(this->m_orig_glUniform2ui64NV))(location,x,y);}
+FunctionTable::MEMBERPFNGLCOPYPATHNVPROC m_orig_glCopyPathNV = nullptr;
+void m_glCopyPathNV_profile(GLuint resultPath,GLuint srcPath)const{ProfilingScope const scope(this,50);(this->*(this->m_orig_glCopyPathNV))(resultPath,srcPath);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIPROC m_orig_glVertexAttribP4ui = nullptr;
+void m_glVertexAttribP4ui_profile(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{ProfilingScope const scope(this,51);(this->*(this->m_orig_glVertexAttribP4ui))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DPROC m_orig_glVertexAttribL2d = nullptr;
+void m_glVertexAttribL2d_profile(GLuint index,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,52);(this->*(this->m_orig_glVertexAttribL2d))(index,x,y);}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVPROC m_orig_glGetMultisamplefv = nullptr;
+void m_glGetMultisamplefv_profile(GLenum pname,GLuint index,GLfloat* val)const{ProfilingScope const scope(this,53);(this->*(this->m_orig_glGetMultisamplefv))(pname,index,val);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC m_orig_glCompressedMultiTexSubImage3DEXT = nullptr;
+void m_glCompressedMultiTexSubImage3DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,54);(this->*(this->m_orig_glCompressedMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLVDPAUREGISTEROUTPUTSURFACENVPROC m_orig_glVDPAURegisterOutputSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterOutputSurfaceNV_profile(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{ProfilingScope const scope(this,55);return (this->*(this->m_orig_glVDPAURegisterOutputSurfaceNV))(vdpSurface,target,numTextureNames,textureNames);}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGPROC m_orig_glMinSampleShading = nullptr;
+void m_glMinSampleShading_profile(GLfloat value)const{ProfilingScope const scope(this,56);(this->*(this->m_orig_glMinSampleShading))(value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FEXTPROC m_orig_glProgramUniform4fEXT = nullptr;
+void m_glProgramUniform4fEXT_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{ProfilingScope const scope(this,57);(this->*(this->m_orig_glProgramUniform4fEXT))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLCOVERSTROKEPATHNVPROC m_orig_glCoverStrokePathNV = nullptr;
+void m_glCoverStrokePathNV_profile(GLuint path,GLenum coverMode)const{ProfilingScope const scope(this,58);(this->*(this->m_orig_glCoverStrokePathNV))(path,coverMode);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC m_orig_glTextureImage2DMultisampleNV = nullptr;
+void m_glTextureImage2DMultisampleNV_profile(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,59);(this->*(this->m_orig_glTextureImage2DMultisampleNV))(texture,target,samples,internalFormat,width,height,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLVERTEX3BOESPROC m_orig_glVertex3bOES = nullptr;
+void m_glVertex3bOES_profile(GLbyte x,GLbyte y,GLbyte z)const{ProfilingScope const scope(this,60);(this->*(this->m_orig_glVertex3bOES))(x,y,z);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32HANDLEEXTPROC m_orig_glImportMemoryWin32HandleEXT = nullptr;
+void m_glImportMemoryWin32HandleEXT_profile(GLuint memory,GLuint64 size,GLenum handleType,void* handle)const{ProfilingScope const scope(this,61);(this->*(this->m_orig_glImportMemoryWin32HandleEXT))(memory,size,handleType,handle);}
+FunctionTable::MEMBERPFNGLTESSELLATIONFACTORAMDPROC m_orig_glTessellationFactorAMD = nullptr;
+void m_glTessellationFactorAMD_profile(GLfloat factor)const{ProfilingScope const scope(this,62);(this->*(this->m_orig_glTessellationFactorAMD))(factor);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLPROC m_orig_glDebugMessageControl = nullptr;
+void m_glDebugMessageControl_profile(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{ProfilingScope const scope(this,63);(this->*(this->m_orig_glDebugMessageControl))(source,type,severity,count,ids,enabled);}
+FunctionTable::MEMBERPFNGLISOBJECTBUFFERATIPROC m_orig_glIsObjectBufferATI = nullptr;
+GLboolean m_glIsObjectBufferATI_profile(GLuint buffer)const{ProfilingScope const scope(this,64);return (this->*(this->m_orig_glIsObjectBufferATI))(buffer);}
+FunctionTable::MEMBERPFNGLPOPATTRIBPROC m_orig_glPopAttrib = nullptr;
+void m_glPopAttrib_profile()const{ProfilingScope const scope(this,65);(this->*(this->m_orig_glPopAttrib))();}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IEXTPROC m_orig_glProgramUniform4iEXT = nullptr;
+void m_glProgramUniform4iEXT_profile(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{ProfilingScope const scope(this,66);(this->*(this->m_orig_glProgramUniform4iEXT))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBNVPROC m_orig_glVertexAttrib4ubNV = nullptr;
+void m_glVertexAttrib4ubNV_profile(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{ProfilingScope const scope(this,67);(this->*(this->m_orig_glVertexAttrib4ubNV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLCOLORMATERIALPROC m_orig_glColorMaterial = nullptr;
+void m_glColorMaterial_profile(GLenum face,GLenum mode)const{ProfilingScope const scope(this,68);(this->*(this->m_orig_glColorMaterial))(face,mode);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVARBPROC m_orig_glVertexAttrib2svARB = nullptr;
+void m_glVertexAttrib2svARB_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,69);(this->*(this->m_orig_glVertexAttrib2svARB))(index,v);}
+FunctionTable::MEMBERPFNGLMINSAMPLESHADINGARBPROC m_orig_glMinSampleShadingARB = nullptr;
+void m_glMinSampleShadingARB_profile(GLfloat value)const{ProfilingScope const scope(this,70);(this->*(this->m_orig_glMinSampleShadingARB))(value);}
+FunctionTable::MEMBERPFNGLCOLOR3BPROC m_orig_glColor3b = nullptr;
+void m_glColor3b_profile(GLbyte red,GLbyte green,GLbyte blue)const{ProfilingScope const scope(this,71);(this->*(this->m_orig_glColor3b))(red,green,blue);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN_profile(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,72);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN))(rc,s,t,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLCOLOR3FPROC m_orig_glColor3f = nullptr;
+void m_glColor3f_profile(GLfloat red,GLfloat green,GLfloat blue)const{ProfilingScope const scope(this,73);(this->*(this->m_orig_glColor3f))(red,green,blue);}
+FunctionTable::MEMBERPFNGLVDPAUGETSURFACEIVNVPROC m_orig_glVDPAUGetSurfaceivNV = nullptr;
+void m_glVDPAUGetSurfaceivNV_profile(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{ProfilingScope const scope(this,74);(this->*(this->m_orig_glVDPAUGetSurfaceivNV))(surface,pname,bufSize,length,values);}
+FunctionTable::MEMBERPFNGLCOLOR3DPROC m_orig_glColor3d = nullptr;
+void m_glColor3d_profile(GLdouble red,GLdouble green,GLdouble blue)const{ProfilingScope const scope(this,75);(this->*(this->m_orig_glColor3d))(red,green,blue);}
+FunctionTable::MEMBERPFNGLGETNMAPIVPROC m_orig_glGetnMapiv = nullptr;
+void m_glGetnMapiv_profile(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{ProfilingScope const scope(this,76);(this->*(this->m_orig_glGetnMapiv))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLCOLOR3IPROC m_orig_glColor3i = nullptr;
+void m_glColor3i_profile(GLint red,GLint green,GLint blue)const{ProfilingScope const scope(this,77);(this->*(this->m_orig_glColor3i))(red,green,blue);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATSAMPLEIVNVPROC m_orig_glGetInternalformatSampleivNV = nullptr;
+void m_glGetInternalformatSampleivNV_profile(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params)const{ProfilingScope const scope(this,78);(this->*(this->m_orig_glGetInternalformatSampleivNV))(target,internalformat,samples,pname,bufSize,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVPROC m_orig_glVertexAttrib4ubv = nullptr;
+void m_glVertexAttrib4ubv_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,79);(this->*(this->m_orig_glVertexAttrib4ubv))(index,v);}
+FunctionTable::MEMBERPFNGLCOLOR3SPROC m_orig_glColor3s = nullptr;
+void m_glColor3s_profile(GLshort red,GLshort green,GLshort blue)const{ProfilingScope const scope(this,80);(this->*(this->m_orig_glColor3s))(red,green,blue);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4HVNVPROC m_orig_glVertexAttribs4hvNV = nullptr;
+void m_glVertexAttribs4hvNV_profile(GLuint index,GLsizei n,const GLhalfNV* v)const{ProfilingScope const scope(this,81);(this->*(this->m_orig_glVertexAttribs4hvNV))(index,n,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVARBPROC m_orig_glVertexAttrib4NubvARB = nullptr;
+void m_glVertexAttrib4NubvARB_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,82);(this->*(this->m_orig_glVertexAttrib4NubvARB))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HVNVPROC m_orig_glMultiTexCoord3hvNV = nullptr;
+void m_glMultiTexCoord3hvNV_profile(GLenum target,const GLhalfNV* v)const{ProfilingScope const scope(this,83);(this->*(this->m_orig_glMultiTexCoord3hvNV))(target,v);}
+FunctionTable::MEMBERPFNGLMATRIXPUSHEXTPROC m_orig_glMatrixPushEXT = nullptr;
+void m_glMatrixPushEXT_profile(GLenum mode)const{ProfilingScope const scope(this,84);(this->*(this->m_orig_glMatrixPushEXT))(mode);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FEXTPROC m_orig_glProgramUniform2fEXT = nullptr;
+void m_glProgramUniform2fEXT_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{ProfilingScope const scope(this,85);(this->*(this->m_orig_glProgramUniform2fEXT))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXEDIVPROC m_orig_glGetVertexArrayIndexediv = nullptr;
+void m_glGetVertexArrayIndexediv_profile(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{ProfilingScope const scope(this,86);(this->*(this->m_orig_glGetVertexArrayIndexediv))(vaobj,index,pname,param);}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFERPROC m_orig_glBlitFramebuffer = nullptr;
+void m_glBlitFramebuffer_profile(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{ProfilingScope const scope(this,87);(this->*(this->m_orig_glBlitFramebuffer))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIPROC m_orig_glMultiTexCoordP2ui = nullptr;
+void m_glMultiTexCoordP2ui_profile(GLenum texture,GLenum type,GLuint coords)const{ProfilingScope const scope(this,88);(this->*(this->m_orig_glMultiTexCoordP2ui))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERLISTIBMPROC m_orig_glColorPointerListIBM = nullptr;
+void m_glColorPointerListIBM_profile(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,89);(this->*(this->m_orig_glColorPointerListIBM))(size,type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DPROC m_orig_glVertexAttribL4d = nullptr;
+void m_glVertexAttribL4d_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,90);(this->*(this->m_orig_glVertexAttribL4d))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALFVSGIXPROC m_orig_glGetFragmentMaterialfvSGIX = nullptr;
+void m_glGetFragmentMaterialfvSGIX_profile(GLenum face,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,91);(this->*(this->m_orig_glGetFragmentMaterialfvSGIX))(face,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEX2IVPROC m_orig_glVertex2iv = nullptr;
+void m_glVertex2iv_profile(const GLint* v)const{ProfilingScope const scope(this,92);(this->*(this->m_orig_glVertex2iv))(v);}
+FunctionTable::MEMBERPFNGLGETTEXENVXVOESPROC m_orig_glGetTexEnvxvOES = nullptr;
+void m_glGetTexEnvxvOES_profile(GLenum target,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,93);(this->*(this->m_orig_glGetTexEnvxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3DVPROC m_orig_glUniformMatrix3dv = nullptr;
+void m_glUniformMatrix3dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,94);(this->*(this->m_orig_glUniformMatrix3dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVEXTPROC m_orig_glGetVertexAttribLdvEXT = nullptr;
+void m_glGetVertexAttribLdvEXT_profile(GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,95);(this->*(this->m_orig_glGetVertexAttribLdvEXT))(index,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIVPROC m_orig_glTexCoordP3uiv = nullptr;
+void m_glTexCoordP3uiv_profile(GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,96);(this->*(this->m_orig_glTexCoordP3uiv))(type,coords);}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3DSGIXPROC m_orig_glDeformationMap3dSGIX = nullptr;
+void m_glDeformationMap3dSGIX_profile(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points)const{ProfilingScope const scope(this,97);(this->*(this->m_orig_glDeformationMap3dSGIX))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKPROC m_orig_glResumeTransformFeedback = nullptr;
+void m_glResumeTransformFeedback_profile()const{ProfilingScope const scope(this,98);(this->*(this->m_orig_glResumeTransformFeedback))();}
+FunctionTable::MEMBERPFNGLINSERTEVENTMARKEREXTPROC m_orig_glInsertEventMarkerEXT = nullptr;
+void m_glInsertEventMarkerEXT_profile(GLsizei length,const GLchar* marker)const{ProfilingScope const scope(this,99);(this->*(this->m_orig_glInsertEventMarkerEXT))(length,marker);}
+FunctionTable::MEMBERPFNGLTESSELLATIONMODEAMDPROC m_orig_glTessellationModeAMD = nullptr;
+void m_glTessellationModeAMD_profile(GLenum mode)const{ProfilingScope const scope(this,100);(this->*(this->m_orig_glTessellationModeAMD))(mode);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSADDRESSNVPROC m_orig_glDrawCommandsAddressNV = nullptr;
+void m_glDrawCommandsAddressNV_profile(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count)const{ProfilingScope const scope(this,101);(this->*(this->m_orig_glDrawCommandsAddressNV))(primitiveMode,indirects,sizes,count);}
+FunctionTable::MEMBERPFNGLFOGIPROC m_orig_glFogi = nullptr;
+void m_glFogi_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,102);(this->*(this->m_orig_glFogi))(pname,param);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERXVOESPROC m_orig_glGetTexParameterxvOES = nullptr;
+void m_glGetTexParameterxvOES_profile(GLenum target,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,103);(this->*(this->m_orig_glGetTexParameterxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERPROC m_orig_glVertexPointer = nullptr;
+void m_glVertexPointer_profile(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,104);(this->*(this->m_orig_glVertexPointer))(size,type,stride,ptr);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERDATAAMDPROC m_orig_glGetPerfMonitorCounterDataAMD = nullptr;
+void m_glGetPerfMonitorCounterDataAMD_profile(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten)const{ProfilingScope const scope(this,105);(this->*(this->m_orig_glGetPerfMonitorCounterDataAMD))(monitor,pname,dataSize,data,bytesWritten);}
+FunctionTable::MEMBERPFNGLFOGFPROC m_orig_glFogf = nullptr;
+void m_glFogf_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,106);(this->*(this->m_orig_glFogf))(pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DPROC m_orig_glMultiTexCoord1d = nullptr;
+void m_glMultiTexCoord1d_profile(GLenum target,GLdouble s)const{ProfilingScope const scope(this,107);(this->*(this->m_orig_glMultiTexCoord1d))(target,s);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FPROC m_orig_glMultiTexCoord1f = nullptr;
+void m_glMultiTexCoord1f_profile(GLenum target,GLfloat s)const{ProfilingScope const scope(this,108);(this->*(this->m_orig_glMultiTexCoord1f))(target,s);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIVEXTPROC m_orig_glGetMultiTexParameterivEXT = nullptr;
+void m_glGetMultiTexParameterivEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,109);(this->*(this->m_orig_glGetMultiTexParameterivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC m_orig_glProgramUniformMatrix3x4fvEXT = nullptr;
+void m_glProgramUniformMatrix3x4fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,110);(this->*(this->m_orig_glProgramUniformMatrix3x4fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IPROC m_orig_glVertexAttribI2i = nullptr;
+void m_glVertexAttribI2i_profile(GLuint index,GLint x,GLint y)const{ProfilingScope const scope(this,111);(this->*(this->m_orig_glVertexAttribI2i))(index,x,y);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IPROC m_orig_glMultiTexCoord1i = nullptr;
+void m_glMultiTexCoord1i_profile(GLenum target,GLint s)const{ProfilingScope const scope(this,112);(this->*(this->m_orig_glMultiTexCoord1i))(target,s);}
+FunctionTable::MEMBERPFNGLDELETESEMAPHORESEXTPROC m_orig_glDeleteSemaphoresEXT = nullptr;
+void m_glDeleteSemaphoresEXT_profile(GLsizei n,const GLuint* semaphores)const{ProfilingScope const scope(this,113);(this->*(this->m_orig_glDeleteSemaphoresEXT))(n,semaphores);}
+FunctionTable::MEMBERPFNGLLOADPROGRAMNVPROC m_orig_glLoadProgramNV = nullptr;
+void m_glLoadProgramNV_profile(GLenum target,GLuint id,GLsizei len,const GLubyte* program)const{ProfilingScope const scope(this,114);(this->*(this->m_orig_glLoadProgramNV))(target,id,len,program);}
+FunctionTable::MEMBERPFNGLWRITEMASKEXTPROC m_orig_glWriteMaskEXT = nullptr;
+void m_glWriteMaskEXT_profile(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{ProfilingScope const scope(this,115);(this->*(this->m_orig_glWriteMaskEXT))(res,in,outX,outY,outZ,outW);}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSPROC m_orig_glGetGraphicsResetStatus = nullptr;
+GLenum m_glGetGraphicsResetStatus_profile()const{ProfilingScope const scope(this,116);return (this->*(this->m_orig_glGetGraphicsResetStatus))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVPROC m_orig_glVertexAttrib1fv = nullptr;
+void m_glVertexAttrib1fv_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,117);(this->*(this->m_orig_glVertexAttrib1fv))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SPROC m_orig_glMultiTexCoord1s = nullptr;
+void m_glMultiTexCoord1s_profile(GLenum target,GLshort s)const{ProfilingScope const scope(this,118);(this->*(this->m_orig_glMultiTexCoord1s))(target,s);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFVHPPROC m_orig_glImageTransformParameterfvHP = nullptr;
+void m_glImageTransformParameterfvHP_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,119);(this->*(this->m_orig_glImageTransformParameterfvHP))(target,pname,params);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DPROC m_orig_glFramebufferTexture2D = nullptr;
+void m_glFramebufferTexture2D_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,120);(this->*(this->m_orig_glFramebufferTexture2D))(target,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTFVSGIXPROC m_orig_glGetFragmentLightfvSGIX = nullptr;
+void m_glGetFragmentLightfvSGIX_profile(GLenum light,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,121);(this->*(this->m_orig_glGetFragmentLightfvSGIX))(light,pname,params);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFSGIXPROC m_orig_glListParameterfSGIX = nullptr;
+void m_glListParameterfSGIX_profile(GLuint list,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,122);(this->*(this->m_orig_glListParameterfSGIX))(list,pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD3SVPROC m_orig_glTexCoord3sv = nullptr;
+void m_glTexCoord3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,123);(this->*(this->m_orig_glTexCoord3sv))(v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC m_orig_glNamedFramebufferRenderbufferEXT = nullptr;
+void m_glNamedFramebufferRenderbufferEXT_profile(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{ProfilingScope const scope(this,124);(this->*(this->m_orig_glNamedFramebufferRenderbufferEXT))(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFSGIXPROC m_orig_glFragmentLightModelfSGIX = nullptr;
+void m_glFragmentLightModelfSGIX_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,125);(this->*(this->m_orig_glFragmentLightModelfSGIX))(pname,param);}
+FunctionTable::MEMBERPFNGLINDEXPOINTEREXTPROC m_orig_glIndexPointerEXT = nullptr;
+void m_glIndexPointerEXT_profile(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{ProfilingScope const scope(this,126);(this->*(this->m_orig_glIndexPointerEXT))(type,stride,count,pointer);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEATIPROC m_orig_glBlendEquationSeparateATI = nullptr;
+void m_glBlendEquationSeparateATI_profile(GLenum modeRGB,GLenum modeA)const{ProfilingScope const scope(this,127);(this->*(this->m_orig_glBlendEquationSeparateATI))(modeRGB,modeA);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBIFORMATPROC m_orig_glVertexArrayAttribIFormat = nullptr;
+void m_glVertexArrayAttribIFormat_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,128);(this->*(this->m_orig_glVertexArrayAttribIFormat))(vaobj,attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN_profile(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,129);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN))(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBVSUNPROC m_orig_glReplacementCodeubvSUN = nullptr;
+void m_glReplacementCodeubvSUN_profile(const GLubyte* code)const{ProfilingScope const scope(this,130);(this->*(this->m_orig_glReplacementCodeubvSUN))(code);}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSPROC m_orig_glGenFramebuffers = nullptr;
+void m_glGenFramebuffers_profile(GLsizei n,GLuint* framebuffers)const{ProfilingScope const scope(this,131);(this->*(this->m_orig_glGenFramebuffers))(n,framebuffers);}
+FunctionTable::MEMBERPFNGLPIXELMAPXPROC m_orig_glPixelMapx = nullptr;
+void m_glPixelMapx_profile(GLenum map,GLint size,const GLfixed* values)const{ProfilingScope const scope(this,132);(this->*(this->m_orig_glPixelMapx))(map,size,values);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DEXTPROC m_orig_glTexSubImage3DEXT = nullptr;
+void m_glTexSubImage3DEXT_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,133);(this->*(this->m_orig_glTexSubImage3DEXT))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETATTACHEDSHADERSPROC m_orig_glGetAttachedShaders = nullptr;
+void m_glGetAttachedShaders_profile(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders)const{ProfilingScope const scope(this,134);(this->*(this->m_orig_glGetAttachedShaders))(program,maxCount,count,shaders);}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERFVSGISPROC m_orig_glGetPixelTexGenParameterfvSGIS = nullptr;
+void m_glGetPixelTexGenParameterfvSGIS_profile(GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,135);(this->*(this->m_orig_glGetPixelTexGenParameterfvSGIS))(pname,params);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fSUN_profile(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,136);(this->*(this->m_orig_glReplacementCodeuiNormal3fVertex3fSUN))(rc,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGAMDPROC m_orig_glGetDebugMessageLogAMD = nullptr;
+GLuint m_glGetDebugMessageLogAMD_profile(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message)const{ProfilingScope const scope(this,137);return (this->*(this->m_orig_glGetDebugMessageLogAMD))(count,bufsize,categories,severities,ids,lengths,message);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SATIPROC m_orig_glVertexStream4sATI = nullptr;
+void m_glVertexStream4sATI_profile(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,138);(this->*(this->m_orig_glVertexStream4sATI))(stream,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4DVNVPROC m_orig_glVertexAttribs4dvNV = nullptr;
+void m_glVertexAttribs4dvNV_profile(GLuint index,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,139);(this->*(this->m_orig_glVertexAttribs4dvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLGETNMAPDVARBPROC m_orig_glGetnMapdvARB = nullptr;
+void m_glGetnMapdvARB_profile(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{ProfilingScope const scope(this,140);(this->*(this->m_orig_glGetnMapdvARB))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLORTHOFOESPROC m_orig_glOrthofOES = nullptr;
+void m_glOrthofOES_profile(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{ProfilingScope const scope(this,141);(this->*(this->m_orig_glOrthofOES))(l,r,b,t,n,f);}
+FunctionTable::MEMBERPFNGLVIEWPORTARRAYVPROC m_orig_glViewportArrayv = nullptr;
+void m_glViewportArrayv_profile(GLuint first,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,142);(this->*(this->m_orig_glViewportArrayv))(first,count,v);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYATIPROC m_orig_glDrawElementArrayATI = nullptr;
+void m_glDrawElementArrayATI_profile(GLenum mode,GLsizei count)const{ProfilingScope const scope(this,143);(this->*(this->m_orig_glDrawElementArrayATI))(mode,count);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEMEMEXTPROC m_orig_glBufferStorageMemEXT = nullptr;
+void m_glBufferStorageMemEXT_profile(GLenum target,GLsizeiptr size,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,144);(this->*(this->m_orig_glBufferStorageMemEXT))(target,size,memory,offset);}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENFVNVPROC m_orig_glGetPathColorGenfvNV = nullptr;
+void m_glGetPathColorGenfvNV_profile(GLenum color,GLenum pname,GLfloat* value)const{ProfilingScope const scope(this,145);(this->*(this->m_orig_glGetPathColorGenfvNV))(color,pname,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IMESAPROC m_orig_glWindowPos3iMESA = nullptr;
+void m_glWindowPos3iMESA_profile(GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,146);(this->*(this->m_orig_glWindowPos3iMESA))(x,y,z);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SPROC m_orig_glMultiTexCoord2s = nullptr;
+void m_glMultiTexCoord2s_profile(GLenum target,GLshort s,GLshort t)const{ProfilingScope const scope(this,147);(this->*(this->m_orig_glMultiTexCoord2s))(target,s,t);}
+FunctionTable::MEMBERPFNGLVERTEX3DVPROC m_orig_glVertex3dv = nullptr;
+void m_glVertex3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,148);(this->*(this->m_orig_glVertex3dv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVEXTPROC m_orig_glVertexAttribI3uivEXT = nullptr;
+void m_glVertexAttribI3uivEXT_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,149);(this->*(this->m_orig_glVertexAttribI3uivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64ARBPROC m_orig_glUniform3ui64ARB = nullptr;
+void m_glUniform3ui64ARB_profile(GLint location,GLuint64 x,GLuint64 y,GLuint64 z)const{ProfilingScope const scope(this,150);(this->*(this->m_orig_glUniform3ui64ARB))(location,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVNVPROC m_orig_glVertexAttrib2fvNV = nullptr;
+void m_glVertexAttrib2fvNV_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,151);(this->*(this->m_orig_glVertexAttrib2fvNV))(index,v);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAEXTPROC m_orig_glGetNamedBufferSubDataEXT = nullptr;
+void m_glGetNamedBufferSubDataEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{ProfilingScope const scope(this,152);(this->*(this->m_orig_glGetNamedBufferSubDataEXT))(buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DPROC m_orig_glConvolutionFilter2D = nullptr;
+void m_glConvolutionFilter2D_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image)const{ProfilingScope const scope(this,153);(this->*(this->m_orig_glConvolutionFilter2D))(target,internalformat,width,height,format,type,image);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERBYREGIONPROC m_orig_glMemoryBarrierByRegion = nullptr;
+void m_glMemoryBarrierByRegion_profile(GLbitfield barriers)const{ProfilingScope const scope(this,154);(this->*(this->m_orig_glMemoryBarrierByRegion))(barriers);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYBINDINGDIVISORPROC m_orig_glVertexArrayBindingDivisor = nullptr;
+void m_glVertexArrayBindingDivisor_profile(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{ProfilingScope const scope(this,155);(this->*(this->m_orig_glVertexArrayBindingDivisor))(vaobj,bindingindex,divisor);}
+FunctionTable::MEMBERPFNGLMATRIXROTATEDEXTPROC m_orig_glMatrixRotatedEXT = nullptr;
+void m_glMatrixRotatedEXT_profile(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,156);(this->*(this->m_orig_glMatrixRotatedEXT))(mode,angle,x,y,z);}
+FunctionTable::MEMBERPFNGLTEXCOORD2SVPROC m_orig_glTexCoord2sv = nullptr;
+void m_glTexCoord2sv_profile(const GLshort* v)const{ProfilingScope const scope(this,157);(this->*(this->m_orig_glTexCoord2sv))(v);}
+FunctionTable::MEMBERPFNGLISPROGRAMNVPROC m_orig_glIsProgramNV = nullptr;
+GLboolean m_glIsProgramNV_profile(GLuint id)const{ProfilingScope const scope(this,158);return (this->*(this->m_orig_glIsProgramNV))(id);}
+FunctionTable::MEMBERPFNGLUNIFORM2DVPROC m_orig_glUniform2dv = nullptr;
+void m_glUniform2dv_profile(GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,159);(this->*(this->m_orig_glUniform2dv))(location,count,value);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUIVPROC m_orig_glGetPixelMapuiv = nullptr;
+void m_glGetPixelMapuiv_profile(GLenum map,GLuint* values)const{ProfilingScope const scope(this,160);(this->*(this->m_orig_glGetPixelMapuiv))(map,values);}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSEXTPROC m_orig_glDepthBoundsEXT = nullptr;
+void m_glDepthBoundsEXT_profile(GLclampd zmin,GLclampd zmax)const{ProfilingScope const scope(this,161);(this->*(this->m_orig_glDepthBoundsEXT))(zmin,zmax);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HVNVPROC m_orig_glVertexAttrib4hvNV = nullptr;
+void m_glVertexAttrib4hvNV_profile(GLuint index,const GLhalfNV* v)const{ProfilingScope const scope(this,162);(this->*(this->m_orig_glVertexAttrib4hvNV))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIEXTPROC m_orig_glMultiTexParameteriEXT = nullptr;
+void m_glMultiTexParameteriEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,163);(this->*(this->m_orig_glMultiTexParameteriEXT))(texunit,target,pname,param);}
+FunctionTable::MEMBERPFNGLGETPOINTERVPROC m_orig_glGetPointerv = nullptr;
+void m_glGetPointerv_profile(GLenum pname,GLvoid** params)const{ProfilingScope const scope(this,164);(this->*(this->m_orig_glGetPointerv))(pname,params);}
+FunctionTable::MEMBERPFNGLPATHCOMMANDSNVPROC m_orig_glPathCommandsNV = nullptr;
+void m_glPathCommandsNV_profile(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{ProfilingScope const scope(this,165);(this->*(this->m_orig_glPathCommandsNV))(path,numCommands,commands,numCoords,coordType,coords);}
+FunctionTable::MEMBERPFNGLGETLISTPARAMETERFVSGIXPROC m_orig_glGetListParameterfvSGIX = nullptr;
+void m_glGetListParameterfvSGIX_profile(GLuint list,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,166);(this->*(this->m_orig_glGetListParameterfvSGIX))(list,pname,params);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVPROC m_orig_glGetUniformuiv = nullptr;
+void m_glGetUniformuiv_profile(GLuint program,GLint location,GLuint* params)const{ProfilingScope const scope(this,167);(this->*(this->m_orig_glGetUniformuiv))(program,location,params);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTAMDPROC m_orig_glDebugMessageInsertAMD = nullptr;
+void m_glDebugMessageInsertAMD_profile(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf)const{ProfilingScope const scope(this,168);(this->*(this->m_orig_glDebugMessageInsertAMD))(category,severity,id,length,buf);}
+FunctionTable::MEMBERPFNGLFRUSTUMPROC m_orig_glFrustum = nullptr;
+void m_glFrustum_profile(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{ProfilingScope const scope(this,169);(this->*(this->m_orig_glFrustum))(left,right,bottom,top,near_val,far_val);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VNVPROC m_orig_glVertexAttribL1ui64vNV = nullptr;
+void m_glVertexAttribL1ui64vNV_profile(GLuint index,const GLuint64EXT* v)const{ProfilingScope const scope(this,170);(this->*(this->m_orig_glVertexAttribL1ui64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLCLEARCOLORXOESPROC m_orig_glClearColorxOES = nullptr;
+void m_glClearColorxOES_profile(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{ProfilingScope const scope(this,171);(this->*(this->m_orig_glClearColorxOES))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVPROC m_orig_glProgramUniformMatrix3fv = nullptr;
+void m_glProgramUniformMatrix3fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,172);(this->*(this->m_orig_glProgramUniformMatrix3fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKINDEXEDNVPROC m_orig_glSampleMaskIndexedNV = nullptr;
+void m_glSampleMaskIndexedNV_profile(GLuint index,GLbitfield mask)const{ProfilingScope const scope(this,173);(this->*(this->m_orig_glSampleMaskIndexedNV))(index,mask);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERINCLUDEARBPROC m_orig_glCompileShaderIncludeARB = nullptr;
+void m_glCompileShaderIncludeARB_profile(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length)const{ProfilingScope const scope(this,174);(this->*(this->m_orig_glCompileShaderIncludeARB))(shader,count,path,length);}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTFVATIPROC m_orig_glGetArrayObjectfvATI = nullptr;
+void m_glGetArrayObjectfvATI_profile(GLenum array,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,175);(this->*(this->m_orig_glGetArrayObjectfvATI))(array,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4SVATIPROC m_orig_glVertexStream4svATI = nullptr;
+void m_glVertexStream4svATI_profile(GLenum stream,const GLshort* coords)const{ProfilingScope const scope(this,176);(this->*(this->m_orig_glVertexStream4svATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IARBPROC m_orig_glMultiTexCoord4iARB = nullptr;
+void m_glMultiTexCoord4iARB_profile(GLenum target,GLint s,GLint t,GLint r,GLint q)const{ProfilingScope const scope(this,177);(this->*(this->m_orig_glMultiTexCoord4iARB))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLVARIANTFVEXTPROC m_orig_glVariantfvEXT = nullptr;
+void m_glVariantfvEXT_profile(GLuint id,const GLfloat* addr)const{ProfilingScope const scope(this,178);(this->*(this->m_orig_glVariantfvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLMATRIXLOADFEXTPROC m_orig_glMatrixLoadfEXT = nullptr;
+void m_glMatrixLoadfEXT_profile(GLenum mode,const GLfloat* m)const{ProfilingScope const scope(this,179);(this->*(this->m_orig_glMatrixLoadfEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLLOADIDENTITYDEFORMATIONMAPSGIXPROC m_orig_glLoadIdentityDeformationMapSGIX = nullptr;
+void m_glLoadIdentityDeformationMapSGIX_profile(GLbitfield mask)const{ProfilingScope const scope(this,180);(this->*(this->m_orig_glLoadIdentityDeformationMapSGIX))(mask);}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVPROC m_orig_glGetRenderbufferParameteriv = nullptr;
+void m_glGetRenderbufferParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,181);(this->*(this->m_orig_glGetRenderbufferParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FEXTPROC m_orig_glProgramUniform3fEXT = nullptr;
+void m_glProgramUniform3fEXT_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{ProfilingScope const scope(this,182);(this->*(this->m_orig_glProgramUniform3fEXT))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEPROC m_orig_glNamedRenderbufferStorage = nullptr;
+void m_glNamedRenderbufferStorage_profile(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,183);(this->*(this->m_orig_glNamedRenderbufferStorage))(renderbuffer,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONPROC m_orig_glBindFragDataLocation = nullptr;
+void m_glBindFragDataLocation_profile(GLuint program,GLuint color,const GLchar* name)const{ProfilingScope const scope(this,184);(this->*(this->m_orig_glBindFragDataLocation))(program,color,name);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPPROC m_orig_glPolygonOffsetClamp = nullptr;
+void m_glPolygonOffsetClamp_profile(GLfloat factor,GLfloat units,GLfloat clamp)const{ProfilingScope const scope(this,185);(this->*(this->m_orig_glPolygonOffsetClamp))(factor,units,clamp);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERLISTIBMPROC m_orig_glFogCoordPointerListIBM = nullptr;
+void m_glFogCoordPointerListIBM_profile(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,186);(this->*(this->m_orig_glFogCoordPointerListIBM))(type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLFENCESYNCPROC m_orig_glFenceSync = nullptr;
+GLsync m_glFenceSync_profile(GLenum condition,GLbitfield flags)const{ProfilingScope const scope(this,187);return (this->*(this->m_orig_glFenceSync))(condition,flags);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVEXTPROC m_orig_glGetVertexAttribIivEXT = nullptr;
+void m_glGetVertexAttribIivEXT_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,188);(this->*(this->m_orig_glGetVertexAttribIivEXT))(index,pname,params);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC m_orig_glFramebufferDrawBuffersEXT = nullptr;
+void m_glFramebufferDrawBuffersEXT_profile(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{ProfilingScope const scope(this,189);(this->*(this->m_orig_glFramebufferDrawBuffersEXT))(framebuffer,n,bufs);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4FVNVPROC m_orig_glVertexAttribs4fvNV = nullptr;
+void m_glVertexAttribs4fvNV_profile(GLuint index,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,190);(this->*(this->m_orig_glVertexAttribs4fvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKNVPROC m_orig_glPauseTransformFeedbackNV = nullptr;
+void m_glPauseTransformFeedbackNV_profile()const{ProfilingScope const scope(this,191);(this->*(this->m_orig_glPauseTransformFeedbackNV))();}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VEXTPROC m_orig_glGetQueryObjecti64vEXT = nullptr;
+void m_glGetQueryObjecti64vEXT_profile(GLuint id,GLenum pname,GLint64* params)const{ProfilingScope const scope(this,192);(this->*(this->m_orig_glGetQueryObjecti64vEXT))(id,pname,params);}
+FunctionTable::MEMBERPFNGLVDPAUSURFACEACCESSNVPROC m_orig_glVDPAUSurfaceAccessNV = nullptr;
+void m_glVDPAUSurfaceAccessNV_profile(GLvdpauSurfaceNV surface,GLenum access)const{ProfilingScope const scope(this,193);(this->*(this->m_orig_glVDPAUSurfaceAccessNV))(surface,access);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPIPELINEPROC m_orig_glValidateProgramPipeline = nullptr;
+void m_glValidateProgramPipeline_profile(GLuint pipeline)const{ProfilingScope const scope(this,194);(this->*(this->m_orig_glValidateProgramPipeline))(pipeline);}
+FunctionTable::MEMBERPFNGLTEXPAGECOMMITMENTARBPROC m_orig_glTexPageCommitmentARB = nullptr;
+void m_glTexPageCommitmentARB_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{ProfilingScope const scope(this,195);(this->*(this->m_orig_glTexPageCommitmentARB))(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVARBPROC m_orig_glWindowPos3dvARB = nullptr;
+void m_glWindowPos3dvARB_profile(const GLdouble* v)const{ProfilingScope const scope(this,196);(this->*(this->m_orig_glWindowPos3dvARB))(v);}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHINSTANCEDNVPROC m_orig_glStencilStrokePathInstancedNV = nullptr;
+void m_glStencilStrokePathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,197);(this->*(this->m_orig_glStencilStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLFOGFVPROC m_orig_glFogfv = nullptr;
+void m_glFogfv_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,198);(this->*(this->m_orig_glFogfv))(pname,params);}
+FunctionTable::MEMBERPFNGLGENQUERIESARBPROC m_orig_glGenQueriesARB = nullptr;
+void m_glGenQueriesARB_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,199);(this->*(this->m_orig_glGenQueriesARB))(n,ids);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64NVPROC m_orig_glProgramUniform2i64NV = nullptr;
+void m_glProgramUniform2i64NV_profile(GLuint program,GLint location,GLint64EXT x,GLint64EXT y)const{ProfilingScope const scope(this,200);(this->*(this->m_orig_glProgramUniform2i64NV))(program,location,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXP4UIPROC m_orig_glVertexP4ui = nullptr;
+void m_glVertexP4ui_profile(GLenum type,GLuint value)const{ProfilingScope const scope(this,201);(this->*(this->m_orig_glVertexP4ui))(type,value);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IVATIPROC m_orig_glVertexStream1ivATI = nullptr;
+void m_glVertexStream1ivATI_profile(GLenum stream,const GLint* coords)const{ProfilingScope const scope(this,202);(this->*(this->m_orig_glVertexStream1ivATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4INVPROC m_orig_glProgramEnvParameterI4iNV = nullptr;
+void m_glProgramEnvParameterI4iNV_profile(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,203);(this->*(this->m_orig_glProgramEnvParameterI4iNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSAPPLEPROC m_orig_glGenVertexArraysAPPLE = nullptr;
+void m_glGenVertexArraysAPPLE_profile(GLsizei n,GLuint* arrays)const{ProfilingScope const scope(this,204);(this->*(this->m_orig_glGenVertexArraysAPPLE))(n,arrays);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC m_orig_glDrawTransformFeedbackInstanced = nullptr;
+void m_glDrawTransformFeedbackInstanced_profile(GLenum mode,GLuint id,GLsizei instancecount)const{ProfilingScope const scope(this,205);(this->*(this->m_orig_glDrawTransformFeedbackInstanced))(mode,id,instancecount);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHNVPROC m_orig_glStencilThenCoverStrokePathNV = nullptr;
+void m_glStencilThenCoverStrokePathNV_profile(GLuint path,GLint reference,GLuint mask,GLenum coverMode)const{ProfilingScope const scope(this,206);(this->*(this->m_orig_glStencilThenCoverStrokePathNV))(path,reference,mask,coverMode);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSAPPLEPROC m_orig_glDeleteVertexArraysAPPLE = nullptr;
+void m_glDeleteVertexArraysAPPLE_profile(GLsizei n,const GLuint* arrays)const{ProfilingScope const scope(this,207);(this->*(this->m_orig_glDeleteVertexArraysAPPLE))(n,arrays);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC m_orig_glGetNamedBufferParameterui64vNV = nullptr;
+void m_glGetNamedBufferParameterui64vNV_profile(GLuint buffer,GLenum pname,GLuint64EXT* params)const{ProfilingScope const scope(this,208);(this->*(this->m_orig_glGetNamedBufferParameterui64vNV))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLQUERYMATRIXXOESPROC m_orig_glQueryMatrixxOES = nullptr;
+GLbitfield m_glQueryMatrixxOES_profile(GLfixed* mantissa,GLint* exponent)const{ProfilingScope const scope(this,209);return (this->*(this->m_orig_glQueryMatrixxOES))(mantissa,exponent);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVPROC m_orig_glSecondaryColor3usv = nullptr;
+void m_glSecondaryColor3usv_profile(const GLushort* v)const{ProfilingScope const scope(this,210);(this->*(this->m_orig_glSecondaryColor3usv))(v);}
+FunctionTable::MEMBERPFNGLTRANSLATEXOESPROC m_orig_glTranslatexOES = nullptr;
+void m_glTranslatexOES_profile(GLfixed x,GLfixed y,GLfixed z)const{ProfilingScope const scope(this,211);(this->*(this->m_orig_glTranslatexOES))(x,y,z);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKPROC m_orig_glDrawTransformFeedback = nullptr;
+void m_glDrawTransformFeedback_profile(GLenum mode,GLuint id)const{ProfilingScope const scope(this,212);(this->*(this->m_orig_glDrawTransformFeedback))(mode,id);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fvSUN_profile(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,213);(this->*(this->m_orig_glTexCoord2fColor4fNormal3fVertex3fvSUN))(tc,c,n,v);}
+FunctionTable::MEMBERPFNGLVDPAUREGISTERVIDEOSURFACENVPROC m_orig_glVDPAURegisterVideoSurfaceNV = nullptr;
+GLvdpauSurfaceNV m_glVDPAURegisterVideoSurfaceNV_profile(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames)const{ProfilingScope const scope(this,214);return (this->*(this->m_orig_glVDPAURegisterVideoSurfaceNV))(vdpSurface,target,numTextureNames,textureNames);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVPROC m_orig_glGetTexParameterIuiv = nullptr;
+void m_glGetTexParameterIuiv_profile(GLenum target,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,215);(this->*(this->m_orig_glGetTexParameterIuiv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASENVPROC m_orig_glBindBufferBaseNV = nullptr;
+void m_glBindBufferBaseNV_profile(GLenum target,GLuint index,GLuint buffer)const{ProfilingScope const scope(this,216);(this->*(this->m_orig_glBindBufferBaseNV))(target,index,buffer);}
+FunctionTable::MEMBERPFNGLINDEXPOINTERPROC m_orig_glIndexPointer = nullptr;
+void m_glIndexPointer_profile(GLenum type,GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,217);(this->*(this->m_orig_glIndexPointer))(type,stride,ptr);}
+FunctionTable::MEMBERPFNGLGENQUERYRESOURCETAGNVPROC m_orig_glGenQueryResourceTagNV = nullptr;
+void m_glGenQueryResourceTagNV_profile(GLsizei n,GLint* tagIds)const{ProfilingScope const scope(this,218);(this->*(this->m_orig_glGenQueryResourceTagNV))(n,tagIds);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVPROC m_orig_glVertexAttrib4Nbv = nullptr;
+void m_glVertexAttrib4Nbv_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,219);(this->*(this->m_orig_glVertexAttrib4Nbv))(index,v);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERISGIXPROC m_orig_glListParameteriSGIX = nullptr;
+void m_glListParameteriSGIX_profile(GLuint list,GLenum pname,GLint param)const{ProfilingScope const scope(this,220);(this->*(this->m_orig_glListParameteriSGIX))(list,pname,param);}
+FunctionTable::MEMBERPFNGLBLENDCOLORXOESPROC m_orig_glBlendColorxOES = nullptr;
+void m_glBlendColorxOES_profile(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{ProfilingScope const scope(this,221);(this->*(this->m_orig_glBlendColorxOES))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLUNIFORMUI64VNVPROC m_orig_glUniformui64vNV = nullptr;
+void m_glUniformui64vNV_profile(GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,222);(this->*(this->m_orig_glUniformui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLISSYNCPROC m_orig_glIsSync = nullptr;
+GLboolean m_glIsSync_profile(GLsync sync)const{ProfilingScope const scope(this,223);return (this->*(this->m_orig_glIsSync))(sync);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVEXTPROC m_orig_glGetTextureParameterivEXT = nullptr;
+void m_glGetTextureParameterivEXT_profile(GLuint texture,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,224);(this->*(this->m_orig_glGetTextureParameterivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLFOGCOORDHVNVPROC m_orig_glFogCoordhvNV = nullptr;
+void m_glFogCoordhvNV_profile(const GLhalfNV* fog)const{ProfilingScope const scope(this,225);(this->*(this->m_orig_glFogCoordhvNV))(fog);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYEREXTPROC m_orig_glFramebufferTextureLayerEXT = nullptr;
+void m_glFramebufferTextureLayerEXT_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{ProfilingScope const scope(this,226);(this->*(this->m_orig_glFramebufferTextureLayerEXT))(target,attachment,texture,level,layer);}
+FunctionTable::MEMBERPFNGLGETOBJECTPTRLABELPROC m_orig_glGetObjectPtrLabel = nullptr;
+void m_glGetObjectPtrLabel_profile(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label)const{ProfilingScope const scope(this,227);(this->*(this->m_orig_glGetObjectPtrLabel))(ptr,bufSize,length,label);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIPROC m_orig_glTextureParameteri = nullptr;
+void m_glTextureParameteri_profile(GLuint texture,GLenum pname,GLint param)const{ProfilingScope const scope(this,228);(this->*(this->m_orig_glTextureParameteri))(texture,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FARBPROC m_orig_glMultiTexCoord1fARB = nullptr;
+void m_glMultiTexCoord1fARB_profile(GLenum target,GLfloat s)const{ProfilingScope const scope(this,229);(this->*(this->m_orig_glMultiTexCoord1fARB))(target,s);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3DVPROC m_orig_glUniformMatrix2x3dv = nullptr;
+void m_glUniformMatrix2x3dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,230);(this->*(this->m_orig_glUniformMatrix2x3dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERDRAWBUFFEREXTPROC m_orig_glFramebufferDrawBufferEXT = nullptr;
+void m_glFramebufferDrawBufferEXT_profile(GLuint framebuffer,GLenum mode)const{ProfilingScope const scope(this,231);(this->*(this->m_orig_glFramebufferDrawBufferEXT))(framebuffer,mode);}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEPROC m_orig_glCopyColorSubTable = nullptr;
+void m_glCopyColorSubTable_profile(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,232);(this->*(this->m_orig_glCopyColorSubTable))(target,start,x,y,width);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERFVAMDPROC m_orig_glGetNamedFramebufferParameterfvAMD = nullptr;
+void m_glGetNamedFramebufferParameterfvAMD_profile(GLuint framebuffer,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{ProfilingScope const scope(this,233);(this->*(this->m_orig_glGetNamedFramebufferParameterfvAMD))(framebuffer,pname,numsamples,pixelindex,size,values);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DPROC m_orig_glVertexAttribL3d = nullptr;
+void m_glVertexAttribL3d_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,234);(this->*(this->m_orig_glVertexAttribL3d))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFVSGIXPROC m_orig_glFragmentMaterialfvSGIX = nullptr;
+void m_glFragmentMaterialfvSGIX_profile(GLenum face,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,235);(this->*(this->m_orig_glFragmentMaterialfvSGIX))(face,pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSE3X3FNVPROC m_orig_glMatrixLoadTranspose3x3fNV = nullptr;
+void m_glMatrixLoadTranspose3x3fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,236);(this->*(this->m_orig_glMatrixLoadTranspose3x3fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLDELETENAMESAMDPROC m_orig_glDeleteNamesAMD = nullptr;
+void m_glDeleteNamesAMD_profile(GLenum identifier,GLuint num,const GLuint* names)const{ProfilingScope const scope(this,237);(this->*(this->m_orig_glDeleteNamesAMD))(identifier,num,names);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSEXTPROC m_orig_glDrawRangeElementsEXT = nullptr;
+void m_glDrawRangeElementsEXT_profile(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices)const{ProfilingScope const scope(this,238);(this->*(this->m_orig_glDrawRangeElementsEXT))(mode,start,end,count,type,indices);}
+FunctionTable::MEMBERPFNGLORTHOPROC m_orig_glOrtho = nullptr;
+void m_glOrtho_profile(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val)const{ProfilingScope const scope(this,239);(this->*(this->m_orig_glOrtho))(left,right,bottom,top,near_val,far_val);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVEXTPROC m_orig_glProgramUniform1dvEXT = nullptr;
+void m_glProgramUniform1dvEXT_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,240);(this->*(this->m_orig_glProgramUniform1dvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLCOLOR4XOESPROC m_orig_glColor4xOES = nullptr;
+void m_glColor4xOES_profile(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{ProfilingScope const scope(this,241);(this->*(this->m_orig_glColor4xOES))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLTEXIMAGE4DSGISPROC m_orig_glTexImage4DSGIS = nullptr;
+void m_glTexImage4DSGIS_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,242);(this->*(this->m_orig_glTexImage4DSGIS))(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIPROC m_orig_glProgramUniform1ui = nullptr;
+void m_glProgramUniform1ui_profile(GLuint program,GLint location,GLuint v0)const{ProfilingScope const scope(this,243);(this->*(this->m_orig_glProgramUniform1ui))(program,location,v0);}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSARBPROC m_orig_glDeleteBuffersARB = nullptr;
+void m_glDeleteBuffersARB_profile(GLsizei n,const GLuint* buffers)const{ProfilingScope const scope(this,244);(this->*(this->m_orig_glDeleteBuffersARB))(n,buffers);}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERARBPROC m_orig_glUnmapBufferARB = nullptr;
+GLboolean m_glUnmapBufferARB_profile(GLenum target)const{ProfilingScope const scope(this,245);return (this->*(this->m_orig_glUnmapBufferARB))(target);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DPROC m_orig_glCopyTexImage2D = nullptr;
+void m_glCopyTexImage2D_profile(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{ProfilingScope const scope(this,246);(this->*(this->m_orig_glCopyTexImage2D))(target,level,internalformat,x,y,width,height,border);}
+FunctionTable::MEMBERPFNGLMATERIALXOESPROC m_orig_glMaterialxOES = nullptr;
+void m_glMaterialxOES_profile(GLenum face,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,247);(this->*(this->m_orig_glMaterialxOES))(face,pname,param);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC m_orig_glProgramUniformMatrix2x4fvEXT = nullptr;
+void m_glProgramUniformMatrix2x4fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,248);(this->*(this->m_orig_glProgramUniformMatrix2x4fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTESTOBJECTAPPLEPROC m_orig_glTestObjectAPPLE = nullptr;
+GLboolean m_glTestObjectAPPLE_profile(GLenum object,GLuint name)const{ProfilingScope const scope(this,249);return (this->*(this->m_orig_glTestObjectAPPLE))(object,name);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEEXTPROC m_orig_glRenderbufferStorageEXT = nullptr;
+void m_glRenderbufferStorageEXT_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,250);(this->*(this->m_orig_glRenderbufferStorageEXT))(target,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64ARBPROC m_orig_glVertexAttribL1ui64ARB = nullptr;
+void m_glVertexAttribL1ui64ARB_profile(GLuint index,GLuint64EXT x)const{ProfilingScope const scope(this,251);(this->*(this->m_orig_glVertexAttribL1ui64ARB))(index,x);}
+FunctionTable::MEMBERPFNGLENDFRAGMENTSHADERATIPROC m_orig_glEndFragmentShaderATI = nullptr;
+void m_glEndFragmentShaderATI_profile()const{ProfilingScope const scope(this,252);(this->*(this->m_orig_glEndFragmentShaderATI))();}
+FunctionTable::MEMBERPFNGLPATHPARAMETERIVNVPROC m_orig_glPathParameterivNV = nullptr;
+void m_glPathParameterivNV_profile(GLuint path,GLenum pname,const GLint* value)const{ProfilingScope const scope(this,253);(this->*(this->m_orig_glPathParameterivNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVPROC m_orig_glUniform4uiv = nullptr;
+void m_glUniform4uiv_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,254);(this->*(this->m_orig_glUniform4uiv))(location,count,value);}
+FunctionTable::MEMBERPFNGLFRAMEZOOMSGIXPROC m_orig_glFrameZoomSGIX = nullptr;
+void m_glFrameZoomSGIX_profile(GLint factor)const{ProfilingScope const scope(this,255);(this->*(this->m_orig_glFrameZoomSGIX))(factor);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FEXTPROC m_orig_glSecondaryColor3fEXT = nullptr;
+void m_glSecondaryColor3fEXT_profile(GLfloat red,GLfloat green,GLfloat blue)const{ProfilingScope const scope(this,256);(this->*(this->m_orig_glSecondaryColor3fEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLLGPUINTERLOCKNVXPROC m_orig_glLGPUInterlockNVX = nullptr;
+void m_glLGPUInterlockNVX_profile()const{ProfilingScope const scope(this,257);(this->*(this->m_orig_glLGPUInterlockNVX))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVPROC m_orig_glVertexAttribL1dv = nullptr;
+void m_glVertexAttribL1dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,258);(this->*(this->m_orig_glVertexAttribL1dv))(index,v);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SVATIPROC m_orig_glNormalStream3svATI = nullptr;
+void m_glNormalStream3svATI_profile(GLenum stream,const GLshort* coords)const{ProfilingScope const scope(this,259);(this->*(this->m_orig_glNormalStream3svATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPATHSTENCILFUNCNVPROC m_orig_glPathStencilFuncNV = nullptr;
+void m_glPathStencilFuncNV_profile(GLenum func,GLint ref,GLuint mask)const{ProfilingScope const scope(this,260);(this->*(this->m_orig_glPathStencilFuncNV))(func,ref,mask);}
+FunctionTable::MEMBERPFNGLSETINVARIANTEXTPROC m_orig_glSetInvariantEXT = nullptr;
+void m_glSetInvariantEXT_profile(GLuint id,GLenum type,const void* addr)const{ProfilingScope const scope(this,261);(this->*(this->m_orig_glSetInvariantEXT))(id,type,addr);}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERIVATIPROC m_orig_glGetTexBumpParameterivATI = nullptr;
+void m_glGetTexBumpParameterivATI_profile(GLenum pname,GLint* param)const{ProfilingScope const scope(this,262);(this->*(this->m_orig_glGetTexBumpParameterivATI))(pname,param);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEEXTPROC m_orig_glBlendEquationSeparateEXT = nullptr;
+void m_glBlendEquationSeparateEXT_profile(GLenum modeRGB,GLenum modeAlpha)const{ProfilingScope const scope(this,263);(this->*(this->m_orig_glBlendEquationSeparateEXT))(modeRGB,modeAlpha);}
+FunctionTable::MEMBERPFNGLENDOCCLUSIONQUERYNVPROC m_orig_glEndOcclusionQueryNV = nullptr;
+void m_glEndOcclusionQueryNV_profile()const{ProfilingScope const scope(this,264);(this->*(this->m_orig_glEndOcclusionQueryNV))();}
+FunctionTable::MEMBERPFNGLSCISSORARRAYVPROC m_orig_glScissorArrayv = nullptr;
+void m_glScissorArrayv_profile(GLuint first,GLsizei count,const GLint* v)const{ProfilingScope const scope(this,265);(this->*(this->m_orig_glScissorArrayv))(first,count,v);}
+FunctionTable::MEMBERPFNGLCALLLISTPROC m_orig_glCallList = nullptr;
+void m_glCallList_profile(GLuint list)const{ProfilingScope const scope(this,266);(this->*(this->m_orig_glCallList))(list);}
+FunctionTable::MEMBERPFNGLMAPTEXTURE2DINTELPROC m_orig_glMapTexture2DINTEL = nullptr;
+void* m_glMapTexture2DINTEL_profile(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout)const{ProfilingScope const scope(this,267);return (this->*(this->m_orig_glMapTexture2DINTEL))(texture,level,access,stride,layout);}
+FunctionTable::MEMBERPFNGLGETVKPROCADDRNVPROC m_orig_glGetVkProcAddrNV = nullptr;
+GLVULKANPROCNV m_glGetVkProcAddrNV_profile(const GLchar* name)const{ProfilingScope const scope(this,268);return (this->*(this->m_orig_glGetVkProcAddrNV))(name);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERXOESPROC m_orig_glPixelTransferxOES = nullptr;
+void m_glPixelTransferxOES_profile(GLenum pname,GLfixed param)const{ProfilingScope const scope(this,269);(this->*(this->m_orig_glPixelTransferxOES))(pname,param);}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSEXTPROC m_orig_glDeleteRenderbuffersEXT = nullptr;
+void m_glDeleteRenderbuffersEXT_profile(GLsizei n,const GLuint* renderbuffers)const{ProfilingScope const scope(this,270);(this->*(this->m_orig_glDeleteRenderbuffersEXT))(n,renderbuffers);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fSUN_profile(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,271);(this->*(this->m_orig_glTexCoord4fColor4fNormal3fVertex4fSUN))(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVEXTPROC m_orig_glProgramUniformMatrix4dvEXT = nullptr;
+void m_glProgramUniformMatrix4dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,272);(this->*(this->m_orig_glProgramUniformMatrix4dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEPROC m_orig_glGetnColorTable = nullptr;
+void m_glGetnColorTable_profile(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{ProfilingScope const scope(this,273);(this->*(this->m_orig_glGetnColorTable))(target,format,type,bufSize,table);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERARBPROC m_orig_glFramebufferTextureLayerARB = nullptr;
+void m_glFramebufferTextureLayerARB_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{ProfilingScope const scope(this,274);(this->*(this->m_orig_glFramebufferTextureLayerARB))(target,attachment,texture,level,layer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVEXTPROC m_orig_glVertexAttribL2dvEXT = nullptr;
+void m_glVertexAttribL2dvEXT_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,275);(this->*(this->m_orig_glVertexAttribL2dvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC m_orig_glGetCombinerStageParameterfvNV = nullptr;
+void m_glGetCombinerStageParameterfvNV_profile(GLenum stage,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,276);(this->*(this->m_orig_glGetCombinerStageParameterfvNV))(stage,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XVOESPROC m_orig_glMultiTexCoord1xvOES = nullptr;
+void m_glMultiTexCoord1xvOES_profile(GLenum texture,const GLfixed* coords)const{ProfilingScope const scope(this,277);(this->*(this->m_orig_glMultiTexCoord1xvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLMAPBUFFERPROC m_orig_glMapBuffer = nullptr;
+void* m_glMapBuffer_profile(GLenum target,GLenum access)const{ProfilingScope const scope(this,278);return (this->*(this->m_orig_glMapBuffer))(target,access);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DPROC m_orig_glSecondaryColor3d = nullptr;
+void m_glSecondaryColor3d_profile(GLdouble red,GLdouble green,GLdouble blue)const{ProfilingScope const scope(this,279);(this->*(this->m_orig_glSecondaryColor3d))(red,green,blue);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FPROC m_orig_glSecondaryColor3f = nullptr;
+void m_glSecondaryColor3f_profile(GLfloat red,GLfloat green,GLfloat blue)const{ProfilingScope const scope(this,280);(this->*(this->m_orig_glSecondaryColor3f))(red,green,blue);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATPROC m_orig_glVertexAttribLFormat = nullptr;
+void m_glVertexAttribLFormat_profile(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,281);(this->*(this->m_orig_glVertexAttribLFormat))(attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERAPPLEPROC m_orig_glElementPointerAPPLE = nullptr;
+void m_glElementPointerAPPLE_profile(GLenum type,const void* pointer)const{ProfilingScope const scope(this,282);(this->*(this->m_orig_glElementPointerAPPLE))(type,pointer);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FATIPROC m_orig_glVertexStream1fATI = nullptr;
+void m_glVertexStream1fATI_profile(GLenum stream,GLfloat x)const{ProfilingScope const scope(this,283);(this->*(this->m_orig_glVertexStream1fATI))(stream,x);}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONNVPROC m_orig_glCoverageModulationNV = nullptr;
+void m_glCoverageModulationNV_profile(GLenum components)const{ProfilingScope const scope(this,284);(this->*(this->m_orig_glCoverageModulationNV))(components);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IPROC m_orig_glSecondaryColor3i = nullptr;
+void m_glSecondaryColor3i_profile(GLint red,GLint green,GLint blue)const{ProfilingScope const scope(this,285);(this->*(this->m_orig_glSecondaryColor3i))(red,green,blue);}
+FunctionTable::MEMBERPFNGLDELETESYNCPROC m_orig_glDeleteSync = nullptr;
+void m_glDeleteSync_profile(GLsync sync)const{ProfilingScope const scope(this,286);(this->*(this->m_orig_glDeleteSync))(sync);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERFVNVPROC m_orig_glGetProgramParameterfvNV = nullptr;
+void m_glGetProgramParameterfvNV_profile(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,287);(this->*(this->m_orig_glGetProgramParameterfvNV))(target,index,pname,params);}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSARBPROC m_orig_glMaxShaderCompilerThreadsARB = nullptr;
+void m_glMaxShaderCompilerThreadsARB_profile(GLuint count)const{ProfilingScope const scope(this,288);(this->*(this->m_orig_glMaxShaderCompilerThreadsARB))(count);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2DVPROC m_orig_glUniformMatrix4x2dv = nullptr;
+void m_glUniformMatrix4x2dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,289);(this->*(this->m_orig_glUniformMatrix4x2dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC m_orig_glVertexArrayVertexAttribLOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribLOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,290);(this->*(this->m_orig_glVertexArrayVertexAttribLOffsetEXT))(vaobj,buffer,index,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SPROC m_orig_glSecondaryColor3s = nullptr;
+void m_glSecondaryColor3s_profile(GLshort red,GLshort green,GLshort blue)const{ProfilingScope const scope(this,291);(this->*(this->m_orig_glSecondaryColor3s))(red,green,blue);}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTNVPROC m_orig_glIsImageHandleResidentNV = nullptr;
+GLboolean m_glIsImageHandleResidentNV_profile(GLuint64 handle)const{ProfilingScope const scope(this,292);return (this->*(this->m_orig_glIsImageHandleResidentNV))(handle);}
+FunctionTable::MEMBERPFNGLUNIFORM3IVPROC m_orig_glUniform3iv = nullptr;
+void m_glUniform3iv_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,293);(this->*(this->m_orig_glUniform3iv))(location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64VNVPROC m_orig_glVertexAttribL3i64vNV = nullptr;
+void m_glVertexAttribL3i64vNV_profile(GLuint index,const GLint64EXT* v)const{ProfilingScope const scope(this,294);(this->*(this->m_orig_glVertexAttribL3i64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLPOLYGONMODEPROC m_orig_glPolygonMode = nullptr;
+void m_glPolygonMode_profile(GLenum face,GLenum mode)const{ProfilingScope const scope(this,295);(this->*(this->m_orig_glPolygonMode))(face,mode);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_orig_glFramebufferSamplePositionsfvAMD = nullptr;
+void m_glFramebufferSamplePositionsfvAMD_profile(GLenum target,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{ProfilingScope const scope(this,296);(this->*(this->m_orig_glFramebufferSamplePositionsfvAMD))(target,numsamples,pixelindex,values);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DEXTPROC m_orig_glConvolutionFilter1DEXT = nullptr;
+void m_glConvolutionFilter1DEXT_profile(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image)const{ProfilingScope const scope(this,297);(this->*(this->m_orig_glConvolutionFilter1DEXT))(target,internalformat,width,format,type,image);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVARBPROC m_orig_glVertexAttrib1dvARB = nullptr;
+void m_glVertexAttrib1dvARB_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,298);(this->*(this->m_orig_glVertexAttrib1dvARB))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DEXTPROC m_orig_glTextureSubImage2DEXT = nullptr;
+void m_glTextureSubImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,299);(this->*(this->m_orig_glTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYAPPLEPROC m_orig_glIsVertexArrayAPPLE = nullptr;
+GLboolean m_glIsVertexArrayAPPLE_profile(GLuint array)const{ProfilingScope const scope(this,300);return (this->*(this->m_orig_glIsVertexArrayAPPLE))(array);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMPROC m_orig_glUseProgram = nullptr;
+void m_glUseProgram_profile(GLuint program)const{ProfilingScope const scope(this,301);(this->*(this->m_orig_glUseProgram))(program);}
+FunctionTable::MEMBERPFNGLLINESTIPPLEPROC m_orig_glLineStipple = nullptr;
+void m_glLineStipple_profile(GLint factor,GLushort pattern)const{ProfilingScope const scope(this,302);(this->*(this->m_orig_glLineStipple))(factor,pattern);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVARBPROC m_orig_glMultiTexCoord4fvARB = nullptr;
+void m_glMultiTexCoord4fvARB_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,303);(this->*(this->m_orig_glMultiTexCoord4fvARB))(target,v);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURENVPROC m_orig_glVideoCaptureNV = nullptr;
+GLenum m_glVideoCaptureNV_profile(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time)const{ProfilingScope const scope(this,304);return (this->*(this->m_orig_glVideoCaptureNV))(video_capture_slot,sequence_num,capture_time);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC m_orig_glVertexArrayVertexAttribLFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribLFormatEXT_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,305);(this->*(this->m_orig_glVertexArrayVertexAttribLFormatEXT))(vaobj,attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLUNIFORM3FVARBPROC m_orig_glUniform3fvARB = nullptr;
+void m_glUniform3fvARB_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,306);(this->*(this->m_orig_glUniform3fvARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC m_orig_glProgramUniformMatrix3x2fvEXT = nullptr;
+void m_glProgramUniformMatrix3x2fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,307);(this->*(this->m_orig_glProgramUniformMatrix3x2fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DEXTPROC m_orig_glCopyTextureSubImage3DEXT = nullptr;
+void m_glCopyTextureSubImage3DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,308);(this->*(this->m_orig_glCopyTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BVOESPROC m_orig_glMultiTexCoord2bvOES = nullptr;
+void m_glMultiTexCoord2bvOES_profile(GLenum texture,const GLbyte* coords)const{ProfilingScope const scope(this,309);(this->*(this->m_orig_glMultiTexCoord2bvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLDELETEOBJECTARBPROC m_orig_glDeleteObjectARB = nullptr;
+void m_glDeleteObjectARB_profile(GLhandleARB obj)const{ProfilingScope const scope(this,310);(this->*(this->m_orig_glDeleteObjectARB))(obj);}
+FunctionTable::MEMBERPFNGLTEXTURELIGHTEXTPROC m_orig_glTextureLightEXT = nullptr;
+void m_glTextureLightEXT_profile(GLenum pname)const{ProfilingScope const scope(this,311);(this->*(this->m_orig_glTextureLightEXT))(pname);}
+FunctionTable::MEMBERPFNGLRASTERPOS3IPROC m_orig_glRasterPos3i = nullptr;
+void m_glRasterPos3i_profile(GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,312);(this->*(this->m_orig_glRasterPos3i))(x,y,z);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DARBPROC m_orig_glMultiTexCoord3dARB = nullptr;
+void m_glMultiTexCoord3dARB_profile(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{ProfilingScope const scope(this,313);(this->*(this->m_orig_glMultiTexCoord3dARB))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC m_orig_glNamedFramebufferTextureEXT = nullptr;
+void m_glNamedFramebufferTextureEXT_profile(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{ProfilingScope const scope(this,314);(this->*(this->m_orig_glNamedFramebufferTextureEXT))(framebuffer,attachment,texture,level);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIEXTPROC m_orig_glTextureParameteriEXT = nullptr;
+void m_glTextureParameteriEXT_profile(GLuint texture,GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,315);(this->*(this->m_orig_glTextureParameteriEXT))(texture,target,pname,param);}
+FunctionTable::MEMBERPFNGLEVALCOORD2XVOESPROC m_orig_glEvalCoord2xvOES = nullptr;
+void m_glEvalCoord2xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,316);(this->*(this->m_orig_glEvalCoord2xvOES))(coords);}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC m_orig_glBindVideoCaptureStreamBufferNV = nullptr;
+void m_glBindVideoCaptureStreamBufferNV_profile(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset)const{ProfilingScope const scope(this,317);(this->*(this->m_orig_glBindVideoCaptureStreamBufferNV))(video_capture_slot,stream,frame_region,offset);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC m_orig_glTexImage2DMultisampleCoverageNV = nullptr;
+void m_glTexImage2DMultisampleCoverageNV_profile(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,318);(this->*(this->m_orig_glTexImage2DMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONARBPROC m_orig_glGetAttribLocationARB = nullptr;
+GLint m_glGetAttribLocationARB_profile(GLhandleARB programObj,const GLcharARB* name)const{ProfilingScope const scope(this,319);return (this->*(this->m_orig_glGetAttribLocationARB))(programObj,name);}
+FunctionTable::MEMBERPFNGLDELETESHADERPROC m_orig_glDeleteShader = nullptr;
+void m_glDeleteShader_profile(GLuint shader)const{ProfilingScope const scope(this,320);(this->*(this->m_orig_glDeleteShader))(shader);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FARBPROC m_orig_glVertexAttrib1fARB = nullptr;
+void m_glVertexAttrib1fARB_profile(GLuint index,GLfloat x)const{ProfilingScope const scope(this,321);(this->*(this->m_orig_glVertexAttrib1fARB))(index,x);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC m_orig_glTexCoord2fColor4ubVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fSUN_profile(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,322);(this->*(this->m_orig_glTexCoord2fColor4ubVertex3fSUN))(s,t,r,g,b,a,x,y,z);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FSUNPROC m_orig_glTexCoord4fVertex4fSUN = nullptr;
+void m_glTexCoord4fVertex4fSUN_profile(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,323);(this->*(this->m_orig_glTexCoord4fVertex4fSUN))(s,t,p,q,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETMAPDVPROC m_orig_glGetMapdv = nullptr;
+void m_glGetMapdv_profile(GLenum target,GLenum query,GLdouble* v)const{ProfilingScope const scope(this,324);(this->*(this->m_orig_glGetMapdv))(target,query,v);}
+FunctionTable::MEMBERPFNGLMAPPARAMETERFVNVPROC m_orig_glMapParameterfvNV = nullptr;
+void m_glMapParameterfvNV_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,325);(this->*(this->m_orig_glMapParameterfvNV))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVPROC m_orig_glTextureParameterIuiv = nullptr;
+void m_glTextureParameterIuiv_profile(GLuint texture,GLenum pname,const GLuint* params)const{ProfilingScope const scope(this,326);(this->*(this->m_orig_glTextureParameterIuiv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKATTRIBSNVPROC m_orig_glTransformFeedbackAttribsNV = nullptr;
+void m_glTransformFeedbackAttribsNV_profile(GLsizei count,const GLint* attribs,GLenum bufferMode)const{ProfilingScope const scope(this,327);(this->*(this->m_orig_glTransformFeedbackAttribsNV))(count,attribs,bufferMode);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFVSGIXPROC m_orig_glFragmentLightfvSGIX = nullptr;
+void m_glFragmentLightfvSGIX_profile(GLenum light,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,328);(this->*(this->m_orig_glFragmentLightfvSGIX))(light,pname,params);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SARBPROC m_orig_glWindowPos3sARB = nullptr;
+void m_glWindowPos3sARB_profile(GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,329);(this->*(this->m_orig_glWindowPos3sARB))(x,y,z);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVPROC m_orig_glGetConvolutionParameterfv = nullptr;
+void m_glGetConvolutionParameterfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,330);(this->*(this->m_orig_glGetConvolutionParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DPROC m_orig_glCopyTexSubImage3D = nullptr;
+void m_glCopyTexSubImage3D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,331);(this->*(this->m_orig_glCopyTexSubImage3D))(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IPROC m_orig_glVertexAttribI3i = nullptr;
+void m_glVertexAttribI3i_profile(GLuint index,GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,332);(this->*(this->m_orig_glVertexAttribI3i))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLCREATESHADEROBJECTARBPROC m_orig_glCreateShaderObjectARB = nullptr;
+GLhandleARB m_glCreateShaderObjectARB_profile(GLenum shaderType)const{ProfilingScope const scope(this,333);return (this->*(this->m_orig_glCreateShaderObjectARB))(shaderType);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATPROC m_orig_glVertexAttribFormat = nullptr;
+void m_glVertexAttribFormat_profile(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{ProfilingScope const scope(this,334);(this->*(this->m_orig_glVertexAttribFormat))(attribindex,size,type,normalized,relativeoffset);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVARBPROC m_orig_glGetProgramivARB = nullptr;
+void m_glGetProgramivARB_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,335);(this->*(this->m_orig_glGetProgramivARB))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVPROC m_orig_glVertexAttribI4usv = nullptr;
+void m_glVertexAttribI4usv_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,336);(this->*(this->m_orig_glVertexAttribI4usv))(index,v);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFPROC m_orig_glTexParameterf = nullptr;
+void m_glTexParameterf_profile(GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,337);(this->*(this->m_orig_glTexParameterf))(target,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBBINDINGPROC m_orig_glVertexAttribBinding = nullptr;
+void m_glVertexAttribBinding_profile(GLuint attribindex,GLuint bindingindex)const{ProfilingScope const scope(this,338);(this->*(this->m_orig_glVertexAttribBinding))(attribindex,bindingindex);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVPROC m_orig_glGetHistogramParameteriv = nullptr;
+void m_glGetHistogramParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,339);(this->*(this->m_orig_glGetHistogramParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIPROC m_orig_glTexParameteri = nullptr;
+void m_glTexParameteri_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,340);(this->*(this->m_orig_glTexParameteri))(target,pname,param);}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEPROC m_orig_glGetShaderSource = nullptr;
+void m_glGetShaderSource_profile(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source)const{ProfilingScope const scope(this,341);(this->*(this->m_orig_glGetShaderSource))(shader,bufSize,length,source);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SPROC m_orig_glVertexAttrib4s = nullptr;
+void m_glVertexAttrib4s_profile(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,342);(this->*(this->m_orig_glVertexAttrib4s))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVNVPROC m_orig_glVertexAttrib4dvNV = nullptr;
+void m_glVertexAttrib4dvNV_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,343);(this->*(this->m_orig_glVertexAttrib4dvNV))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVNVPROC m_orig_glVertexAttrib1dvNV = nullptr;
+void m_glVertexAttrib1dvNV_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,344);(this->*(this->m_orig_glVertexAttrib1dvNV))(index,v);}
+FunctionTable::MEMBERPFNGLPOPNAMEPROC m_orig_glPopName = nullptr;
+void m_glPopName_profile()const{ProfilingScope const scope(this,345);(this->*(this->m_orig_glPopName))();}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFEREXTPROC m_orig_glTextureBufferEXT = nullptr;
+void m_glTextureBufferEXT_profile(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,346);(this->*(this->m_orig_glTextureBufferEXT))(texture,target,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLGETMULTITEXIMAGEEXTPROC m_orig_glGetMultiTexImageEXT = nullptr;
+void m_glGetMultiTexImageEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{ProfilingScope const scope(this,347);(this->*(this->m_orig_glGetMultiTexImageEXT))(texunit,target,level,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETPOINTERINDEXEDVEXTPROC m_orig_glGetPointerIndexedvEXT = nullptr;
+void m_glGetPointerIndexedvEXT_profile(GLenum target,GLuint index,void** data)const{ProfilingScope const scope(this,348);(this->*(this->m_orig_glGetPointerIndexedvEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLISNAMEAMDPROC m_orig_glIsNameAMD = nullptr;
+GLboolean m_glIsNameAMD_profile(GLenum identifier,GLuint name)const{ProfilingScope const scope(this,349);return (this->*(this->m_orig_glIsNameAMD))(identifier,name);}
+FunctionTable::MEMBERPFNGLCOLOR4UBPROC m_orig_glColor4ub = nullptr;
+void m_glColor4ub_profile(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha)const{ProfilingScope const scope(this,350);(this->*(this->m_orig_glColor4ub))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLBUFFERPARAMETERIAPPLEPROC m_orig_glBufferParameteriAPPLE = nullptr;
+void m_glBufferParameteriAPPLE_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,351);(this->*(this->m_orig_glBufferParameteriAPPLE))(target,pname,param);}
+FunctionTable::MEMBERPFNGLCOLOR4UIPROC m_orig_glColor4ui = nullptr;
+void m_glColor4ui_profile(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{ProfilingScope const scope(this,352);(this->*(this->m_orig_glColor4ui))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATIVPROC m_orig_glGetInternalformativ = nullptr;
+void m_glGetInternalformativ_profile(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params)const{ProfilingScope const scope(this,353);(this->*(this->m_orig_glGetInternalformativ))(target,internalformat,pname,bufSize,params);}
+FunctionTable::MEMBERPFNGLCOLOR4USPROC m_orig_glColor4us = nullptr;
+void m_glColor4us_profile(GLushort red,GLushort green,GLushort blue,GLushort alpha)const{ProfilingScope const scope(this,354);(this->*(this->m_orig_glColor4us))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIVPROC m_orig_glVertexAttribP1uiv = nullptr;
+void m_glVertexAttribP1uiv_profile(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{ProfilingScope const scope(this,355);(this->*(this->m_orig_glVertexAttribP1uiv))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLLINKPROGRAMPROC m_orig_glLinkProgram = nullptr;
+void m_glLinkProgram_profile(GLuint program)const{ProfilingScope const scope(this,356);(this->*(this->m_orig_glLinkProgram))(program);}
+FunctionTable::MEMBERPFNGLTEXCOORD3SPROC m_orig_glTexCoord3s = nullptr;
+void m_glTexCoord3s_profile(GLshort s,GLshort t,GLshort r)const{ProfilingScope const scope(this,357);(this->*(this->m_orig_glTexCoord3s))(s,t,r);}
+FunctionTable::MEMBERPFNGLTEXCOORD2DVPROC m_orig_glTexCoord2dv = nullptr;
+void m_glTexCoord2dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,358);(this->*(this->m_orig_glTexCoord2dv))(v);}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELPROC m_orig_glGetObjectLabel = nullptr;
+void m_glGetObjectLabel_profile(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label)const{ProfilingScope const scope(this,359);(this->*(this->m_orig_glGetObjectLabel))(identifier,name,bufSize,length,label);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTEREXTPROC m_orig_glVertexPointerEXT = nullptr;
+void m_glVertexPointerEXT_profile(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{ProfilingScope const scope(this,360);(this->*(this->m_orig_glVertexPointerEXT))(size,type,stride,count,pointer);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKARBPROC m_orig_glDebugMessageCallbackARB = nullptr;
+void m_glDebugMessageCallbackARB_profile(GLDEBUGPROCARB callback,const void* userParam)const{ProfilingScope const scope(this,361);(this->*(this->m_orig_glDebugMessageCallbackARB))(callback,userParam);}
+FunctionTable::MEMBERPFNGLGETSTRINGPROC m_orig_glGetString = nullptr;
+const GLubyte* m_glGetString_profile(GLenum name)const{ProfilingScope const scope(this,362);return (this->*(this->m_orig_glGetString))(name);}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERFVNVPROC m_orig_glGetPathParameterfvNV = nullptr;
+void m_glGetPathParameterfvNV_profile(GLuint path,GLenum pname,GLfloat* value)const{ProfilingScope const scope(this,363);(this->*(this->m_orig_glGetPathParameterfvNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLLIGHTXVOESPROC m_orig_glLightxvOES = nullptr;
+void m_glLightxvOES_profile(GLenum light,GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,364);(this->*(this->m_orig_glLightxvOES))(light,pname,params);}
+FunctionTable::MEMBERPFNGLENDQUERYPROC m_orig_glEndQuery = nullptr;
+void m_glEndQuery_profile(GLenum target)const{ProfilingScope const scope(this,365);(this->*(this->m_orig_glEndQuery))(target);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVPROC m_orig_glSecondaryColor3uiv = nullptr;
+void m_glSecondaryColor3uiv_profile(const GLuint* v)const{ProfilingScope const scope(this,366);(this->*(this->m_orig_glSecondaryColor3uiv))(v);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESXOESPROC m_orig_glPrioritizeTexturesxOES = nullptr;
+void m_glPrioritizeTexturesxOES_profile(GLsizei n,const GLuint* textures,const GLfixed* priorities)const{ProfilingScope const scope(this,367);(this->*(this->m_orig_glPrioritizeTexturesxOES))(n,textures,priorities);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERPROC m_orig_glEdgeFlagPointer = nullptr;
+void m_glEdgeFlagPointer_profile(GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,368);(this->*(this->m_orig_glEdgeFlagPointer))(stride,ptr);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERPARAMETERIPROC m_orig_glFramebufferParameteri = nullptr;
+void m_glFramebufferParameteri_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,369);(this->*(this->m_orig_glFramebufferParameteri))(target,pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD3HNVPROC m_orig_glTexCoord3hNV = nullptr;
+void m_glTexCoord3hNV_profile(GLhalfNV s,GLhalfNV t,GLhalfNV r)const{ProfilingScope const scope(this,370);(this->*(this->m_orig_glTexCoord3hNV))(s,t,r);}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWELEMENTSIBMPROC m_orig_glMultiModeDrawElementsIBM = nullptr;
+void m_glMultiModeDrawElementsIBM_profile(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride)const{ProfilingScope const scope(this,371);(this->*(this->m_orig_glMultiModeDrawElementsIBM))(mode,count,type,indices,primcount,modestride);}
+FunctionTable::MEMBERPFNGLCOPYPIXELSPROC m_orig_glCopyPixels = nullptr;
+void m_glCopyPixels_profile(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type)const{ProfilingScope const scope(this,372);(this->*(this->m_orig_glCopyPixels))(x,y,width,height,type);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIPROC m_orig_glVertexAttribI2ui = nullptr;
+void m_glVertexAttribI2ui_profile(GLuint index,GLuint x,GLuint y)const{ProfilingScope const scope(this,373);(this->*(this->m_orig_glVertexAttribI2ui))(index,x,y);}
+FunctionTable::MEMBERPFNGLCLAMPCOLORARBPROC m_orig_glClampColorARB = nullptr;
+void m_glClampColorARB_profile(GLenum target,GLenum clamp)const{ProfilingScope const scope(this,374);(this->*(this->m_orig_glClampColorARB))(target,clamp);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERVINTELPROC m_orig_glColorPointervINTEL = nullptr;
+void m_glColorPointervINTEL_profile(GLint size,GLenum type,const void** pointer)const{ProfilingScope const scope(this,375);(this->*(this->m_orig_glColorPointervINTEL))(size,type,pointer);}
+FunctionTable::MEMBERPFNGLDELETETEXTURESPROC m_orig_glDeleteTextures = nullptr;
+void m_glDeleteTextures_profile(GLsizei n,const GLuint* textures)const{ProfilingScope const scope(this,376);(this->*(this->m_orig_glDeleteTextures))(n,textures);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVEXTPROC m_orig_glGetMinmaxParameterfvEXT = nullptr;
+void m_glGetMinmaxParameterfvEXT_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,377);(this->*(this->m_orig_glGetMinmaxParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SMESAPROC m_orig_glWindowPos3sMESA = nullptr;
+void m_glWindowPos3sMESA_profile(GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,378);(this->*(this->m_orig_glWindowPos3sMESA))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FPROC m_orig_glVertexAttrib4f = nullptr;
+void m_glVertexAttrib4f_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,379);(this->*(this->m_orig_glVertexAttrib4f))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIPROC m_orig_glNamedFramebufferParameteri = nullptr;
+void m_glNamedFramebufferParameteri_profile(GLuint framebuffer,GLenum pname,GLint param)const{ProfilingScope const scope(this,380);(this->*(this->m_orig_glNamedFramebufferParameteri))(framebuffer,pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FVSUNPROC m_orig_glTexCoord2fVertex3fvSUN = nullptr;
+void m_glTexCoord2fVertex3fvSUN_profile(const GLfloat* tc,const GLfloat* v)const{ProfilingScope const scope(this,381);(this->*(this->m_orig_glTexCoord2fVertex3fvSUN))(tc,v);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSSUNPROC m_orig_glReplacementCodeusSUN = nullptr;
+void m_glReplacementCodeusSUN_profile(GLushort code)const{ProfilingScope const scope(this,382);(this->*(this->m_orig_glReplacementCodeusSUN))(code);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC m_orig_glGetNamedFramebufferParameteriv = nullptr;
+void m_glGetNamedFramebufferParameteriv_profile(GLuint framebuffer,GLenum pname,GLint* param)const{ProfilingScope const scope(this,383);(this->*(this->m_orig_glGetNamedFramebufferParameteriv))(framebuffer,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1FVATIPROC m_orig_glVertexStream1fvATI = nullptr;
+void m_glVertexStream1fvATI_profile(GLenum stream,const GLfloat* coords)const{ProfilingScope const scope(this,384);(this->*(this->m_orig_glVertexStream1fvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLCREATEVERTEXARRAYSPROC m_orig_glCreateVertexArrays = nullptr;
+void m_glCreateVertexArrays_profile(GLsizei n,GLuint* arrays)const{ProfilingScope const scope(this,385);(this->*(this->m_orig_glCreateVertexArrays))(n,arrays);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERPROC m_orig_glBeginConditionalRender = nullptr;
+void m_glBeginConditionalRender_profile(GLuint id,GLenum mode)const{ProfilingScope const scope(this,386);(this->*(this->m_orig_glBeginConditionalRender))(id,mode);}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEVEXTPROC m_orig_glGetUnsignedBytevEXT = nullptr;
+void m_glGetUnsignedBytevEXT_profile(GLenum pname,GLubyte* data)const{ProfilingScope const scope(this,387);(this->*(this->m_orig_glGetUnsignedBytevEXT))(pname,data);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER1DPROC m_orig_glConvolutionFilter1D = nullptr;
+void m_glConvolutionFilter1D_profile(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image)const{ProfilingScope const scope(this,388);(this->*(this->m_orig_glConvolutionFilter1D))(target,internalformat,width,format,type,image);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FARBPROC m_orig_glMultiTexCoord3fARB = nullptr;
+void m_glMultiTexCoord3fARB_profile(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{ProfilingScope const scope(this,389);(this->*(this->m_orig_glMultiTexCoord3fARB))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVARBPROC m_orig_glGetQueryObjectuivARB = nullptr;
+void m_glGetQueryObjectuivARB_profile(GLuint id,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,390);(this->*(this->m_orig_glGetQueryObjectuivARB))(id,pname,params);}
+FunctionTable::MEMBERPFNGLSCALEXOESPROC m_orig_glScalexOES = nullptr;
+void m_glScalexOES_profile(GLfixed x,GLfixed y,GLfixed z)const{ProfilingScope const scope(this,391);(this->*(this->m_orig_glScalexOES))(x,y,z);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIPROC m_orig_glSamplerParameteri = nullptr;
+void m_glSamplerParameteri_profile(GLuint sampler,GLenum pname,GLint param)const{ProfilingScope const scope(this,392);(this->*(this->m_orig_glSamplerParameteri))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFPROC m_orig_glSamplerParameterf = nullptr;
+void m_glSamplerParameterf_profile(GLuint sampler,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,393);(this->*(this->m_orig_glSamplerParameterf))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLSHADEROP1EXTPROC m_orig_glShaderOp1EXT = nullptr;
+void m_glShaderOp1EXT_profile(GLenum op,GLuint res,GLuint arg1)const{ProfilingScope const scope(this,394);(this->*(this->m_orig_glShaderOp1EXT))(op,res,arg1);}
+FunctionTable::MEMBERPFNGLBEGINVIDEOCAPTURENVPROC m_orig_glBeginVideoCaptureNV = nullptr;
+void m_glBeginVideoCaptureNV_profile(GLuint video_capture_slot)const{ProfilingScope const scope(this,395);(this->*(this->m_orig_glBeginVideoCaptureNV))(video_capture_slot);}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMPROC m_orig_glGetnHistogram = nullptr;
+void m_glGetnHistogram_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{ProfilingScope const scope(this,396);(this->*(this->m_orig_glGetnHistogram))(target,reset,format,type,bufSize,values);}
+FunctionTable::MEMBERPFNGLUNIFORM1DPROC m_orig_glUniform1d = nullptr;
+void m_glUniform1d_profile(GLint location,GLdouble x)const{ProfilingScope const scope(this,397);(this->*(this->m_orig_glUniform1d))(location,x);}
+FunctionTable::MEMBERPFNGLRENDERMODEPROC m_orig_glRenderMode = nullptr;
+GLint m_glRenderMode_profile(GLenum mode)const{ProfilingScope const scope(this,398);return (this->*(this->m_orig_glRenderMode))(mode);}
+FunctionTable::MEMBERPFNGLCLEARCOLORIIEXTPROC m_orig_glClearColorIiEXT = nullptr;
+void m_glClearColorIiEXT_profile(GLint red,GLint green,GLint blue,GLint alpha)const{ProfilingScope const scope(this,399);(this->*(this->m_orig_glClearColorIiEXT))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLSIGNALSEMAPHOREEXTPROC m_orig_glSignalSemaphoreEXT = nullptr;
+void m_glSignalSemaphoreEXT_profile(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* dstLayouts)const{ProfilingScope const scope(this,400);(this->*(this->m_orig_glSignalSemaphoreEXT))(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEPROC m_orig_glGetCompressedTexImage = nullptr;
+void m_glGetCompressedTexImage_profile(GLenum target,GLint lod,GLvoid* img)const{ProfilingScope const scope(this,401);(this->*(this->m_orig_glGetCompressedTexImage))(target,lod,img);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC m_orig_glCompressedTextureImage1DEXT = nullptr;
+void m_glCompressedTextureImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,402);(this->*(this->m_orig_glCompressedTextureImage1DEXT))(texture,target,level,internalformat,width,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKIVPROC m_orig_glGetActiveUniformBlockiv = nullptr;
+void m_glGetActiveUniformBlockiv_profile(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params)const{ProfilingScope const scope(this,403);(this->*(this->m_orig_glGetActiveUniformBlockiv))(program,uniformBlockIndex,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM1IPROC m_orig_glUniform1i = nullptr;
+void m_glUniform1i_profile(GLint location,GLint v0)const{ProfilingScope const scope(this,404);(this->*(this->m_orig_glUniform1i))(location,v0);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC m_orig_glMultiDrawArraysIndirectCount = nullptr;
+void m_glMultiDrawArraysIndirectCount_profile(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{ProfilingScope const scope(this,405);(this->*(this->m_orig_glMultiDrawArraysIndirectCount))(mode,indirect,drawcount,maxdrawcount,stride);}
+FunctionTable::MEMBERPFNGLGETTEXENVFVPROC m_orig_glGetTexEnvfv = nullptr;
+void m_glGetTexEnvfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,406);(this->*(this->m_orig_glGetTexEnvfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVSGIPROC m_orig_glColorTableParameterivSGI = nullptr;
+void m_glColorTableParameterivSGI_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,407);(this->*(this->m_orig_glColorTableParameterivSGI))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCULLFACEPROC m_orig_glCullFace = nullptr;
+void m_glCullFace_profile(GLenum mode)const{ProfilingScope const scope(this,408);(this->*(this->m_orig_glCullFace))(mode);}
+FunctionTable::MEMBERPFNGLDELETEFENCESAPPLEPROC m_orig_glDeleteFencesAPPLE = nullptr;
+void m_glDeleteFencesAPPLE_profile(GLsizei n,const GLuint* fences)const{ProfilingScope const scope(this,409);(this->*(this->m_orig_glDeleteFencesAPPLE))(n,fences);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IPROC m_orig_glProgramUniform4i = nullptr;
+void m_glProgramUniform4i_profile(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{ProfilingScope const scope(this,410);(this->*(this->m_orig_glProgramUniform4i))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64ARBPROC m_orig_glUniformHandleui64ARB = nullptr;
+void m_glUniformHandleui64ARB_profile(GLint location,GLuint64 value)const{ProfilingScope const scope(this,411);(this->*(this->m_orig_glUniformHandleui64ARB))(location,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FPROC m_orig_glProgramUniform4f = nullptr;
+void m_glProgramUniform4f_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{ProfilingScope const scope(this,412);(this->*(this->m_orig_glProgramUniform4f))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFPROC m_orig_glViewportIndexedf = nullptr;
+void m_glViewportIndexedf_profile(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h)const{ProfilingScope const scope(this,413);(this->*(this->m_orig_glViewportIndexedf))(index,x,y,w,h);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DPROC m_orig_glProgramUniform4d = nullptr;
+void m_glProgramUniform4d_profile(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3)const{ProfilingScope const scope(this,414);(this->*(this->m_orig_glProgramUniform4d))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLTEXCOORD1XOESPROC m_orig_glTexCoord1xOES = nullptr;
+void m_glTexCoord1xOES_profile(GLfixed s)const{ProfilingScope const scope(this,415);(this->*(this->m_orig_glTexCoord1xOES))(s);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IVATIPROC m_orig_glVertexStream3ivATI = nullptr;
+void m_glVertexStream3ivATI_profile(GLenum stream,const GLint* coords)const{ProfilingScope const scope(this,416);(this->*(this->m_orig_glVertexStream3ivATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPOINTALONGPATHNVPROC m_orig_glPointAlongPathNV = nullptr;
+GLboolean m_glPointAlongPathNV_profile(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY)const{ProfilingScope const scope(this,417);return (this->*(this->m_orig_glPointAlongPathNV))(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);}
+FunctionTable::MEMBERPFNGLENDQUERYARBPROC m_orig_glEndQueryARB = nullptr;
+void m_glEndQueryARB_profile(GLenum target)const{ProfilingScope const scope(this,418);(this->*(this->m_orig_glEndQueryARB))(target);}
+FunctionTable::MEMBERPFNGLVDPAUMAPSURFACESNVPROC m_orig_glVDPAUMapSurfacesNV = nullptr;
+void m_glVDPAUMapSurfacesNV_profile(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces)const{ProfilingScope const scope(this,419);(this->*(this->m_orig_glVDPAUMapSurfacesNV))(numSurfaces,surfaces);}
+FunctionTable::MEMBERPFNGLVERTEX3IPROC m_orig_glVertex3i = nullptr;
+void m_glVertex3i_profile(GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,420);(this->*(this->m_orig_glVertex3i))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVARBPROC m_orig_glVertexAttrib4uivARB = nullptr;
+void m_glVertexAttrib4uivARB_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,421);(this->*(this->m_orig_glVertexAttrib4uivARB))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DEXTPROC m_orig_glTextureStorageMem3DEXT = nullptr;
+void m_glTextureStorageMem3DEXT_profile(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,422);(this->*(this->m_orig_glTextureStorageMem3DEXT))(texture,levels,internalFormat,width,height,depth,memory,offset);}
+FunctionTable::MEMBERPFNGLATTACHSHADERPROC m_orig_glAttachShader = nullptr;
+void m_glAttachShader_profile(GLuint program,GLuint shader)const{ProfilingScope const scope(this,423);(this->*(this->m_orig_glAttachShader))(program,shader);}
+FunctionTable::MEMBERPFNGLCOLOR4HNVPROC m_orig_glColor4hNV = nullptr;
+void m_glColor4hNV_profile(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha)const{ProfilingScope const scope(this,424);(this->*(this->m_orig_glColor4hNV))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLGETFENCEIVNVPROC m_orig_glGetFenceivNV = nullptr;
+void m_glGetFenceivNV_profile(GLuint fence,GLenum pname,GLint* params)const{ProfilingScope const scope(this,425);(this->*(this->m_orig_glGetFenceivNV))(fence,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC m_orig_glTexCoord2fColor4ubVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor4ubVertex3fvSUN_profile(const GLfloat* tc,const GLubyte* c,const GLfloat* v)const{ProfilingScope const scope(this,426);(this->*(this->m_orig_glTexCoord2fColor4ubVertex3fvSUN))(tc,c,v);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPROC m_orig_glGetColorTable = nullptr;
+void m_glGetColorTable_profile(GLenum target,GLenum format,GLenum type,GLvoid* table)const{ProfilingScope const scope(this,427);(this->*(this->m_orig_glGetColorTable))(target,format,type,table);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTERPROC m_orig_glFogCoordPointer = nullptr;
+void m_glFogCoordPointer_profile(GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,428);(this->*(this->m_orig_glFogCoordPointer))(type,stride,pointer);}
+FunctionTable::MEMBERPFNGLTEXSTORAGESPARSEAMDPROC m_orig_glTexStorageSparseAMD = nullptr;
+void m_glTexStorageSparseAMD_profile(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{ProfilingScope const scope(this,429);(this->*(this->m_orig_glTexStorageSparseAMD))(target,internalFormat,width,height,depth,layers,flags);}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFERPROC m_orig_glUnmapNamedBuffer = nullptr;
+GLboolean m_glUnmapNamedBuffer_profile(GLuint buffer)const{ProfilingScope const scope(this,430);return (this->*(this->m_orig_glUnmapNamedBuffer))(buffer);}
+FunctionTable::MEMBERPFNGLTEXCOORD4BVOESPROC m_orig_glTexCoord4bvOES = nullptr;
+void m_glTexCoord4bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,431);(this->*(this->m_orig_glTexCoord4bvOES))(coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FARBPROC m_orig_glVertexAttrib3fARB = nullptr;
+void m_glVertexAttrib3fARB_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,432);(this->*(this->m_orig_glVertexAttrib3fARB))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLRASTERPOS2XOESPROC m_orig_glRasterPos2xOES = nullptr;
+void m_glRasterPos2xOES_profile(GLfixed x,GLfixed y)const{ProfilingScope const scope(this,433);(this->*(this->m_orig_glRasterPos2xOES))(x,y);}
+FunctionTable::MEMBERPFNGLCREATEMEMORYOBJECTSEXTPROC m_orig_glCreateMemoryObjectsEXT = nullptr;
+void m_glCreateMemoryObjectsEXT_profile(GLsizei n,GLuint* memoryObjects)const{ProfilingScope const scope(this,434);(this->*(this->m_orig_glCreateMemoryObjectsEXT))(n,memoryObjects);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX2FVSUNPROC m_orig_glColor4ubVertex2fvSUN = nullptr;
+void m_glColor4ubVertex2fvSUN_profile(const GLubyte* c,const GLfloat* v)const{ProfilingScope const scope(this,435);(this->*(this->m_orig_glColor4ubVertex2fvSUN))(c,v);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVPROC m_orig_glSecondaryColor3dv = nullptr;
+void m_glSecondaryColor3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,436);(this->*(this->m_orig_glSecondaryColor3dv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVPROC m_orig_glVertexAttribI4sv = nullptr;
+void m_glVertexAttribI4sv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,437);(this->*(this->m_orig_glVertexAttribI4sv))(index,v);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC m_orig_glDrawTransformFeedbackStreamInstanced = nullptr;
+void m_glDrawTransformFeedbackStreamInstanced_profile(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount)const{ProfilingScope const scope(this,438);(this->*(this->m_orig_glDrawTransformFeedbackStreamInstanced))(mode,id,stream,instancecount);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVARBPROC m_orig_glMultiTexCoord4ivARB = nullptr;
+void m_glMultiTexCoord4ivARB_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,439);(this->*(this->m_orig_glMultiTexCoord4ivARB))(target,v);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFSGIXPROC m_orig_glSpriteParameterfSGIX = nullptr;
+void m_glSpriteParameterfSGIX_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,440);(this->*(this->m_orig_glSpriteParameterfSGIX))(pname,param);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVPROC m_orig_glSecondaryColor3sv = nullptr;
+void m_glSecondaryColor3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,441);(this->*(this->m_orig_glSecondaryColor3sv))(v);}
+FunctionTable::MEMBERPFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC m_orig_glBindVideoCaptureStreamTextureNV = nullptr;
+void m_glBindVideoCaptureStreamTextureNV_profile(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture)const{ProfilingScope const scope(this,442);(this->*(this->m_orig_glBindVideoCaptureStreamTextureNV))(video_capture_slot,stream,frame_region,target,texture);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVPROC m_orig_glTexParameterIuiv = nullptr;
+void m_glTexParameterIuiv_profile(GLenum target,GLenum pname,const GLuint* params)const{ProfilingScope const scope(this,443);(this->*(this->m_orig_glTexParameterIuiv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLFLUSHPIXELDATARANGENVPROC m_orig_glFlushPixelDataRangeNV = nullptr;
+void m_glFlushPixelDataRangeNV_profile(GLenum target)const{ProfilingScope const scope(this,444);(this->*(this->m_orig_glFlushPixelDataRangeNV))(target);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVPROC m_orig_glWindowPos3fv = nullptr;
+void m_glWindowPos3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,445);(this->*(this->m_orig_glWindowPos3fv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLFORMATNVPROC m_orig_glVertexAttribLFormatNV = nullptr;
+void m_glVertexAttribLFormatNV_profile(GLuint index,GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,446);(this->*(this->m_orig_glVertexAttribLFormatNV))(index,size,type,stride);}
+FunctionTable::MEMBERPFNGLLIGHTMODELFVPROC m_orig_glLightModelfv = nullptr;
+void m_glLightModelfv_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,447);(this->*(this->m_orig_glLightModelfv))(pname,params);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLESGIPROC m_orig_glGetColorTableSGI = nullptr;
+void m_glGetColorTableSGI_profile(GLenum target,GLenum format,GLenum type,void* table)const{ProfilingScope const scope(this,448);(this->*(this->m_orig_glGetColorTableSGI))(target,format,type,table);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXIMAGEARBPROC m_orig_glGetCompressedTexImageARB = nullptr;
+void m_glGetCompressedTexImageARB_profile(GLenum target,GLint level,void* img)const{ProfilingScope const scope(this,449);(this->*(this->m_orig_glGetCompressedTexImageARB))(target,level,img);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIPROC m_orig_glConvolutionParameteri = nullptr;
+void m_glConvolutionParameteri_profile(GLenum target,GLenum pname,GLint params)const{ProfilingScope const scope(this,450);(this->*(this->m_orig_glConvolutionParameteri))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHNVPROC m_orig_glVertexWeighthNV = nullptr;
+void m_glVertexWeighthNV_profile(GLhalfNV weight)const{ProfilingScope const scope(this,451);(this->*(this->m_orig_glVertexWeighthNV))(weight);}
+FunctionTable::MEMBERPFNGLCOLORMASKINDEXEDEXTPROC m_orig_glColorMaskIndexedEXT = nullptr;
+void m_glColorMaskIndexedEXT_profile(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{ProfilingScope const scope(this,452);(this->*(this->m_orig_glColorMaskIndexedEXT))(index,r,g,b,a);}
+FunctionTable::MEMBERPFNGLCOLORMASKIPROC m_orig_glColorMaski = nullptr;
+void m_glColorMaski_profile(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a)const{ProfilingScope const scope(this,453);(this->*(this->m_orig_glColorMaski))(index,r,g,b,a);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP1ATIPROC m_orig_glColorFragmentOp1ATI = nullptr;
+void m_glColorFragmentOp1ATI_profile(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{ProfilingScope const scope(this,454);(this->*(this->m_orig_glColorFragmentOp1ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVEXTPROC m_orig_glVertexAttribI4ubvEXT = nullptr;
+void m_glVertexAttribI4ubvEXT_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,455);(this->*(this->m_orig_glVertexAttribI4ubvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DNVPROC m_orig_glVertexAttrib1dNV = nullptr;
+void m_glVertexAttrib1dNV_profile(GLuint index,GLdouble x)const{ProfilingScope const scope(this,456);(this->*(this->m_orig_glVertexAttrib1dNV))(index,x);}
+FunctionTable::MEMBERPFNGLUNMAPOBJECTBUFFERATIPROC m_orig_glUnmapObjectBufferATI = nullptr;
+void m_glUnmapObjectBufferATI_profile(GLuint buffer)const{ProfilingScope const scope(this,457);(this->*(this->m_orig_glUnmapObjectBufferATI))(buffer);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC m_orig_glNamedProgramLocalParameterI4uiEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uiEXT_profile(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{ProfilingScope const scope(this,458);(this->*(this->m_orig_glNamedProgramLocalParameterI4uiEXT))(program,target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IEXTPROC m_orig_glProgramUniform1iEXT = nullptr;
+void m_glProgramUniform1iEXT_profile(GLuint program,GLint location,GLint v0)const{ProfilingScope const scope(this,459);(this->*(this->m_orig_glProgramUniform1iEXT))(program,location,v0);}
+FunctionTable::MEMBERPFNGLDELETEQUERIESARBPROC m_orig_glDeleteQueriesARB = nullptr;
+void m_glDeleteQueriesARB_profile(GLsizei n,const GLuint* ids)const{ProfilingScope const scope(this,460);(this->*(this->m_orig_glDeleteQueriesARB))(n,ids);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVARBPROC m_orig_glWindowPos3svARB = nullptr;
+void m_glWindowPos3svARB_profile(const GLshort* v)const{ProfilingScope const scope(this,461);(this->*(this->m_orig_glWindowPos3svARB))(v);}
+FunctionTable::MEMBERPFNGLVERTEX4SPROC m_orig_glVertex4s = nullptr;
+void m_glVertex4s_profile(GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,462);(this->*(this->m_orig_glVertex4s))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYWIN32NAMEEXTPROC m_orig_glImportMemoryWin32NameEXT = nullptr;
+void m_glImportMemoryWin32NameEXT_profile(GLuint memory,GLuint64 size,GLenum handleType,const void* name)const{ProfilingScope const scope(this,463);(this->*(this->m_orig_glImportMemoryWin32NameEXT))(memory,size,handleType,name);}
+FunctionTable::MEMBERPFNGLSTRINGMARKERGREMEDYPROC m_orig_glStringMarkerGREMEDY = nullptr;
+void m_glStringMarkerGREMEDY_profile(GLsizei len,const void* string)const{ProfilingScope const scope(this,464);(this->*(this->m_orig_glStringMarkerGREMEDY))(len,string);}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKPROC m_orig_glIsTransformFeedback = nullptr;
+GLboolean m_glIsTransformFeedback_profile(GLuint id)const{ProfilingScope const scope(this,465);return (this->*(this->m_orig_glIsTransformFeedback))(id);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVEXTPROC m_orig_glProgramUniformMatrix2x3dvEXT = nullptr;
+void m_glProgramUniformMatrix2x3dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,466);(this->*(this->m_orig_glProgramUniformMatrix2x3dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETOBJECTLABELEXTPROC m_orig_glGetObjectLabelEXT = nullptr;
+void m_glGetObjectLabelEXT_profile(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label)const{ProfilingScope const scope(this,467);(this->*(this->m_orig_glGetObjectLabelEXT))(type,object,bufSize,length,label);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VNVPROC m_orig_glUniformHandleui64vNV = nullptr;
+void m_glUniformHandleui64vNV_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,468);(this->*(this->m_orig_glUniformHandleui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLROTATEDPROC m_orig_glRotated = nullptr;
+void m_glRotated_profile(GLdouble angle,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,469);(this->*(this->m_orig_glRotated))(angle,x,y,z);}
+FunctionTable::MEMBERPFNGLISPROGRAMPIPELINEPROC m_orig_glIsProgramPipeline = nullptr;
+GLboolean m_glIsProgramPipeline_profile(GLuint pipeline)const{ProfilingScope const scope(this,470);return (this->*(this->m_orig_glIsProgramPipeline))(pipeline);}
+FunctionTable::MEMBERPFNGLROTATEFPROC m_orig_glRotatef = nullptr;
+void m_glRotatef_profile(GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,471);(this->*(this->m_orig_glRotatef))(angle,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEX4IPROC m_orig_glVertex4i = nullptr;
+void m_glVertex4i_profile(GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,472);(this->*(this->m_orig_glVertex4i))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC m_orig_glGetActiveSubroutineUniformName = nullptr;
+void m_glGetActiveSubroutineUniformName_profile(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{ProfilingScope const scope(this,473);(this->*(this->m_orig_glGetActiveSubroutineUniformName))(program,shadertype,index,bufsize,length,name);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SNVPROC m_orig_glVertexAttrib4sNV = nullptr;
+void m_glVertexAttrib4sNV_profile(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,474);(this->*(this->m_orig_glVertexAttrib4sNV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DVARBPROC m_orig_glProgramLocalParameter4dvARB = nullptr;
+void m_glProgramLocalParameter4dvARB_profile(GLenum target,GLuint index,const GLdouble* params)const{ProfilingScope const scope(this,475);(this->*(this->m_orig_glProgramLocalParameter4dvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUBSUNPROC m_orig_glReplacementCodeubSUN = nullptr;
+void m_glReplacementCodeubSUN_profile(GLubyte code)const{ProfilingScope const scope(this,476);(this->*(this->m_orig_glReplacementCodeubSUN))(code);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC m_orig_glMultiDrawElementsIndirectBindlessNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessNV_profile(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{ProfilingScope const scope(this,477);(this->*(this->m_orig_glMultiDrawElementsIndirectBindlessNV))(mode,type,indirect,drawCount,stride,vertexBufferCount);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32HANDLEEXTPROC m_orig_glImportSemaphoreWin32HandleEXT = nullptr;
+void m_glImportSemaphoreWin32HandleEXT_profile(GLuint semaphore,GLenum handleType,void* handle)const{ProfilingScope const scope(this,478);(this->*(this->m_orig_glImportSemaphoreWin32HandleEXT))(semaphore,handleType,handle);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVPROC m_orig_glUniformMatrix3fv = nullptr;
+void m_glUniformMatrix3fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,479);(this->*(this->m_orig_glUniformMatrix3fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETNMAPFVARBPROC m_orig_glGetnMapfvARB = nullptr;
+void m_glGetnMapfvARB_profile(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v)const{ProfilingScope const scope(this,480);(this->*(this->m_orig_glGetnMapfvARB))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVPROC m_orig_glGetnUniformfv = nullptr;
+void m_glGetnUniformfv_profile(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{ProfilingScope const scope(this,481);(this->*(this->m_orig_glGetnUniformfv))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DVPROC m_orig_glVertexAttribL2dv = nullptr;
+void m_glVertexAttribL2dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,482);(this->*(this->m_orig_glVertexAttribL2dv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTPOINTEREXTPROC m_orig_glVertexWeightPointerEXT = nullptr;
+void m_glVertexWeightPointerEXT_profile(GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,483);(this->*(this->m_orig_glVertexWeightPointerEXT))(size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLTANGENT3SEXTPROC m_orig_glTangent3sEXT = nullptr;
+void m_glTangent3sEXT_profile(GLshort tx,GLshort ty,GLshort tz)const{ProfilingScope const scope(this,484);(this->*(this->m_orig_glTangent3sEXT))(tx,ty,tz);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERPROC m_orig_glSecondaryColorPointer = nullptr;
+void m_glSecondaryColorPointer_profile(GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,485);(this->*(this->m_orig_glSecondaryColorPointer))(size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLALPHAFUNCPROC m_orig_glAlphaFunc = nullptr;
+void m_glAlphaFunc_profile(GLenum func,GLclampf ref)const{ProfilingScope const scope(this,486);(this->*(this->m_orig_glAlphaFunc))(func,ref);}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGARBPROC m_orig_glGetNamedStringARB = nullptr;
+void m_glGetNamedStringARB_profile(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string)const{ProfilingScope const scope(this,487);(this->*(this->m_orig_glGetNamedStringARB))(namelen,name,bufSize,stringlen,string);}
+FunctionTable::MEMBERPFNGLTEXCOORD4DPROC m_orig_glTexCoord4d = nullptr;
+void m_glTexCoord4d_profile(GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{ProfilingScope const scope(this,488);(this->*(this->m_orig_glTexCoord4d))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLBUFFERPAGECOMMITMENTARBPROC m_orig_glBufferPageCommitmentARB = nullptr;
+void m_glBufferPageCommitmentARB_profile(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit)const{ProfilingScope const scope(this,489);(this->*(this->m_orig_glBufferPageCommitmentARB))(target,offset,size,commit);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC m_orig_glProgramLocalParameters4fvEXT = nullptr;
+void m_glProgramLocalParameters4fvEXT_profile(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{ProfilingScope const scope(this,490);(this->*(this->m_orig_glProgramLocalParameters4fvEXT))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCPROC m_orig_glStencilFunc = nullptr;
+void m_glStencilFunc_profile(GLenum func,GLint ref,GLuint mask)const{ProfilingScope const scope(this,491);(this->*(this->m_orig_glStencilFunc))(func,ref,mask);}
+FunctionTable::MEMBERPFNGLSEMAPHOREPARAMETERUI64VEXTPROC m_orig_glSemaphoreParameterui64vEXT = nullptr;
+void m_glSemaphoreParameterui64vEXT_profile(GLuint semaphore,GLenum pname,const GLuint64* params)const{ProfilingScope const scope(this,492);(this->*(this->m_orig_glSemaphoreParameterui64vEXT))(semaphore,pname,params);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVNVPROC m_orig_glGetVertexAttribdvNV = nullptr;
+void m_glGetVertexAttribdvNV_profile(GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,493);(this->*(this->m_orig_glGetVertexAttribdvNV))(index,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD3DVPROC m_orig_glTexCoord3dv = nullptr;
+void m_glTexCoord3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,494);(this->*(this->m_orig_glTexCoord3dv))(v);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTIVPROC m_orig_glGetQueryBufferObjectiv = nullptr;
+void m_glGetQueryBufferObjectiv_profile(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{ProfilingScope const scope(this,495);(this->*(this->m_orig_glGetQueryBufferObjectiv))(id,buffer,pname,offset);}
+FunctionTable::MEMBERPFNGLTEXGENXOESPROC m_orig_glTexGenxOES = nullptr;
+void m_glTexGenxOES_profile(GLenum coord,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,496);(this->*(this->m_orig_glTexGenxOES))(coord,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVARBPROC m_orig_glMultiTexCoord1fvARB = nullptr;
+void m_glMultiTexCoord1fvARB_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,497);(this->*(this->m_orig_glMultiTexCoord1fvARB))(target,v);}
+FunctionTable::MEMBERPFNGLLIGHTENVISGIXPROC m_orig_glLightEnviSGIX = nullptr;
+void m_glLightEnviSGIX_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,498);(this->*(this->m_orig_glLightEnviSGIX))(pname,param);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEIVPROC m_orig_glGetProgramPipelineiv = nullptr;
+void m_glGetProgramPipelineiv_profile(GLuint pipeline,GLenum pname,GLint* params)const{ProfilingScope const scope(this,499);(this->*(this->m_orig_glGetProgramPipelineiv))(pipeline,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IVATIPROC m_orig_glVertexStream2ivATI = nullptr;
+void m_glVertexStream2ivATI_profile(GLenum stream,const GLint* coords)const{ProfilingScope const scope(this,500);(this->*(this->m_orig_glVertexStream2ivATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEEXTPROC m_orig_glGetColorTableEXT = nullptr;
+void m_glGetColorTableEXT_profile(GLenum target,GLenum format,GLenum type,void* data)const{ProfilingScope const scope(this,501);(this->*(this->m_orig_glGetColorTableEXT))(target,format,type,data);}
+FunctionTable::MEMBERPFNGLGETSHADERINFOLOGPROC m_orig_glGetShaderInfoLog = nullptr;
+void m_glGetShaderInfoLog_profile(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{ProfilingScope const scope(this,502);(this->*(this->m_orig_glGetShaderInfoLog))(shader,bufSize,length,infoLog);}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYUIVNVPROC m_orig_glGetOcclusionQueryuivNV = nullptr;
+void m_glGetOcclusionQueryuivNV_profile(GLuint id,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,503);(this->*(this->m_orig_glGetOcclusionQueryuivNV))(id,pname,params);}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC m_orig_glInvalidateNamedFramebufferSubData = nullptr;
+void m_glInvalidateNamedFramebufferSubData_profile(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,504);(this->*(this->m_orig_glInvalidateNamedFramebufferSubData))(framebuffer,numAttachments,attachments,x,y,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64NVPROC m_orig_glVertexAttribL1i64NV = nullptr;
+void m_glVertexAttribL1i64NV_profile(GLuint index,GLint64EXT x)const{ProfilingScope const scope(this,505);(this->*(this->m_orig_glVertexAttribL1i64NV))(index,x);}
+FunctionTable::MEMBERPFNGLVDPAUINITNVPROC m_orig_glVDPAUInitNV = nullptr;
+void m_glVDPAUInitNV_profile(const void* vdpDevice,const void* getProcAddress)const{ProfilingScope const scope(this,506);(this->*(this->m_orig_glVDPAUInitNV))(vdpDevice,getProcAddress);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HVNVPROC m_orig_glVertexAttrib1hvNV = nullptr;
+void m_glVertexAttrib1hvNV_profile(GLuint index,const GLhalfNV* v)const{ProfilingScope const scope(this,507);(this->*(this->m_orig_glVertexAttrib1hvNV))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IPROC m_orig_glVertexAttribI4i = nullptr;
+void m_glVertexAttribI4i_profile(GLuint index,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,508);(this->*(this->m_orig_glVertexAttribI4i))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLRASTERPOS2IVPROC m_orig_glRasterPos2iv = nullptr;
+void m_glRasterPos2iv_profile(const GLint* v)const{ProfilingScope const scope(this,509);(this->*(this->m_orig_glRasterPos2iv))(v);}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64I_VNVPROC m_orig_glGetIntegerui64i_vNV = nullptr;
+void m_glGetIntegerui64i_vNV_profile(GLenum value,GLuint index,GLuint64EXT* result)const{ProfilingScope const scope(this,510);(this->*(this->m_orig_glGetIntegerui64i_vNV))(value,index,result);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64NVPROC m_orig_glUniformHandleui64NV = nullptr;
+void m_glUniformHandleui64NV_profile(GLint location,GLuint64 value)const{ProfilingScope const scope(this,511);(this->*(this->m_orig_glUniformHandleui64NV))(location,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVMESAPROC m_orig_glWindowPos3ivMESA = nullptr;
+void m_glWindowPos3ivMESA_profile(const GLint* v)const{ProfilingScope const scope(this,512);(this->*(this->m_orig_glWindowPos3ivMESA))(v);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEPROC m_orig_glBlendEquationSeparate = nullptr;
+void m_glBlendEquationSeparate_profile(GLenum modeRGB,GLenum modeAlpha)const{ProfilingScope const scope(this,513);(this->*(this->m_orig_glBlendEquationSeparate))(modeRGB,modeAlpha);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDARBPROC m_orig_glDrawElementsInstancedARB = nullptr;
+void m_glDrawElementsInstancedARB_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{ProfilingScope const scope(this,514);(this->*(this->m_orig_glDrawElementsInstancedARB))(mode,count,type,indices,primcount);}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEINDEXPROC m_orig_glGetSubroutineIndex = nullptr;
+GLuint m_glGetSubroutineIndex_profile(GLuint program,GLenum shadertype,const GLchar* name)const{ProfilingScope const scope(this,515);return (this->*(this->m_orig_glGetSubroutineIndex))(program,shadertype,name);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVPROC m_orig_glVertexAttrib2sv = nullptr;
+void m_glVertexAttrib2sv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,516);(this->*(this->m_orig_glVertexAttrib2sv))(index,v);}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNSGISPROC m_orig_glSamplePatternSGIS = nullptr;
+void m_glSamplePatternSGIS_profile(GLenum pattern)const{ProfilingScope const scope(this,517);(this->*(this->m_orig_glSamplePatternSGIS))(pattern);}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC m_orig_glEGLImageTargetRenderbufferStorageOES = nullptr;
+void m_glEGLImageTargetRenderbufferStorageOES_profile(GLenum target,GLeglImageOES image)const{ProfilingScope const scope(this,518);(this->*(this->m_orig_glEGLImageTargetRenderbufferStorageOES))(target,image);}
+FunctionTable::MEMBERPFNGLPUSHATTRIBPROC m_orig_glPushAttrib = nullptr;
+void m_glPushAttrib_profile(GLbitfield mask)const{ProfilingScope const scope(this,519);(this->*(this->m_orig_glPushAttrib))(mask);}
+FunctionTable::MEMBERPFNGLVERTEX3HNVPROC m_orig_glVertex3hNV = nullptr;
+void m_glVertex3hNV_profile(GLhalfNV x,GLhalfNV y,GLhalfNV z)const{ProfilingScope const scope(this,520);(this->*(this->m_orig_glVertex3hNV))(x,y,z);}
+FunctionTable::MEMBERPFNGLRASTERPOS3XVOESPROC m_orig_glRasterPos3xvOES = nullptr;
+void m_glRasterPos3xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,521);(this->*(this->m_orig_glRasterPos3xvOES))(coords);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFNVPROC m_orig_glPathParameterfNV = nullptr;
+void m_glPathParameterfNV_profile(GLuint path,GLenum pname,GLfloat value)const{ProfilingScope const scope(this,522);(this->*(this->m_orig_glPathParameterfNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VNVPROC m_orig_glGetUniformi64vNV = nullptr;
+void m_glGetUniformi64vNV_profile(GLuint program,GLint location,GLint64EXT* params)const{ProfilingScope const scope(this,523);(this->*(this->m_orig_glGetUniformi64vNV))(program,location,params);}
+FunctionTable::MEMBERPFNGLLIGHTIVPROC m_orig_glLightiv = nullptr;
+void m_glLightiv_profile(GLenum light,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,524);(this->*(this->m_orig_glLightiv))(light,pname,params);}
+FunctionTable::MEMBERPFNGLMATERIALXVOESPROC m_orig_glMaterialxvOES = nullptr;
+void m_glMaterialxvOES_profile(GLenum face,GLenum pname,const GLfixed* param)const{ProfilingScope const scope(this,525);(this->*(this->m_orig_glMaterialxvOES))(face,pname,param);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC m_orig_glNamedProgramLocalParameter4fEXT = nullptr;
+void m_glNamedProgramLocalParameter4fEXT_profile(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,526);(this->*(this->m_orig_glNamedProgramLocalParameter4fEXT))(program,target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DEXTPROC m_orig_glVertexAttribL1dEXT = nullptr;
+void m_glVertexAttribL1dEXT_profile(GLuint index,GLdouble x)const{ProfilingScope const scope(this,527);(this->*(this->m_orig_glVertexAttribL1dEXT))(index,x);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVARBPROC m_orig_glGetnUniformdvARB = nullptr;
+void m_glGetnUniformdvARB_profile(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{ProfilingScope const scope(this,528);(this->*(this->m_orig_glGetnUniformdvARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BEXTPROC m_orig_glSecondaryColor3bEXT = nullptr;
+void m_glSecondaryColor3bEXT_profile(GLbyte red,GLbyte green,GLbyte blue)const{ProfilingScope const scope(this,529);(this->*(this->m_orig_glSecondaryColor3bEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLBEGINPERFQUERYINTELPROC m_orig_glBeginPerfQueryINTEL = nullptr;
+void m_glBeginPerfQueryINTEL_profile(GLuint queryHandle)const{ProfilingScope const scope(this,530);(this->*(this->m_orig_glBeginPerfQueryINTEL))(queryHandle);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVEXTPROC m_orig_glProgramUniform1uivEXT = nullptr;
+void m_glProgramUniform1uivEXT_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,531);(this->*(this->m_orig_glProgramUniform1uivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIVHPPROC m_orig_glImageTransformParameterivHP = nullptr;
+void m_glImageTransformParameterivHP_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,532);(this->*(this->m_orig_glImageTransformParameterivHP))(target,pname,params);}
+FunctionTable::MEMBERPFNGLDELETEBUFFERSPROC m_orig_glDeleteBuffers = nullptr;
+void m_glDeleteBuffers_profile(GLsizei n,const GLuint* buffers)const{ProfilingScope const scope(this,533);(this->*(this->m_orig_glDeleteBuffers))(n,buffers);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMPIPELINEPROC m_orig_glBindProgramPipeline = nullptr;
+void m_glBindProgramPipeline_profile(GLuint pipeline)const{ProfilingScope const scope(this,534);(this->*(this->m_orig_glBindProgramPipeline))(pipeline);}
+FunctionTable::MEMBERPFNGLSCISSORPROC m_orig_glScissor = nullptr;
+void m_glScissor_profile(GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,535);(this->*(this->m_orig_glScissor))(x,y,width,height);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVPROC m_orig_glProgramUniform4fv = nullptr;
+void m_glProgramUniform4fv_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,536);(this->*(this->m_orig_glProgramUniform4fv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETBOOLEANVPROC m_orig_glGetBooleanv = nullptr;
+void m_glGetBooleanv_profile(GLenum pname,GLboolean* params)const{ProfilingScope const scope(this,537);(this->*(this->m_orig_glGetBooleanv))(pname,params);}
+FunctionTable::MEMBERPFNGLMATERIALFVPROC m_orig_glMaterialfv = nullptr;
+void m_glMaterialfv_profile(GLenum face,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,538);(this->*(this->m_orig_glMaterialfv))(face,pname,params);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FVMESAPROC m_orig_glWindowPos4fvMESA = nullptr;
+void m_glWindowPos4fvMESA_profile(const GLfloat* v)const{ProfilingScope const scope(this,539);(this->*(this->m_orig_glWindowPos4fvMESA))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTEREXTPROC m_orig_glVertexAttribIPointerEXT = nullptr;
+void m_glVertexAttribIPointerEXT_profile(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,540);(this->*(this->m_orig_glVertexAttribIPointerEXT))(index,size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSFVNVPROC m_orig_glProgramBufferParametersfvNV = nullptr;
+void m_glProgramBufferParametersfvNV_profile(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params)const{ProfilingScope const scope(this,541);(this->*(this->m_orig_glProgramBufferParametersfvNV))(target,bindingIndex,wordIndex,count,params);}
+FunctionTable::MEMBERPFNGLALPHAFUNCXOESPROC m_orig_glAlphaFuncxOES = nullptr;
+void m_glAlphaFuncxOES_profile(GLenum func,GLfixed ref)const{ProfilingScope const scope(this,542);(this->*(this->m_orig_glAlphaFuncxOES))(func,ref);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTAMDPROC m_orig_glMultiDrawArraysIndirectAMD = nullptr;
+void m_glMultiDrawArraysIndirectAMD_profile(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride)const{ProfilingScope const scope(this,543);(this->*(this->m_orig_glMultiDrawArraysIndirectAMD))(mode,indirect,primcount,stride);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IVATIPROC m_orig_glNormalStream3ivATI = nullptr;
+void m_glNormalStream3ivATI_profile(GLenum stream,const GLint* coords)const{ProfilingScope const scope(this,544);(this->*(this->m_orig_glNormalStream3ivATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC m_orig_glTextureImage3DMultisampleNV = nullptr;
+void m_glTextureImage3DMultisampleNV_profile(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,545);(this->*(this->m_orig_glTextureImage3DMultisampleNV))(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVEXTPROC m_orig_glProgramUniform4uivEXT = nullptr;
+void m_glProgramUniform4uivEXT_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,546);(this->*(this->m_orig_glProgramUniform4uivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUSVSUNPROC m_orig_glReplacementCodeusvSUN = nullptr;
+void m_glReplacementCodeusvSUN_profile(const GLushort* code)const{ProfilingScope const scope(this,547);(this->*(this->m_orig_glReplacementCodeusvSUN))(code);}
+FunctionTable::MEMBERPFNGLPOLLINSTRUMENTSSGIXPROC m_orig_glPollInstrumentsSGIX = nullptr;
+GLint m_glPollInstrumentsSGIX_profile(GLint* marker_p)const{ProfilingScope const scope(this,548);return (this->*(this->m_orig_glPollInstrumentsSGIX))(marker_p);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVPROC m_orig_glGetTextureLevelParameteriv = nullptr;
+void m_glGetTextureLevelParameteriv_profile(GLuint texture,GLint level,GLenum pname,GLint* params)const{ProfilingScope const scope(this,549);(this->*(this->m_orig_glGetTextureLevelParameteriv))(texture,level,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVPROC m_orig_glVertexAttribI2uiv = nullptr;
+void m_glVertexAttribI2uiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,550);(this->*(this->m_orig_glVertexAttribI2uiv))(index,v);}
+FunctionTable::MEMBERPFNGLMAPCONTROLPOINTSNVPROC m_orig_glMapControlPointsNV = nullptr;
+void m_glMapControlPointsNV_profile(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points)const{ProfilingScope const scope(this,551);(this->*(this->m_orig_glMapControlPointsNV))(target,index,type,ustride,vstride,uorder,vorder,packed,points);}
+FunctionTable::MEMBERPFNGLCOLOR4DVPROC m_orig_glColor4dv = nullptr;
+void m_glColor4dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,552);(this->*(this->m_orig_glColor4dv))(v);}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERSUBDATAPROC m_orig_glInvalidateBufferSubData = nullptr;
+void m_glInvalidateBufferSubData_profile(GLuint buffer,GLintptr offset,GLsizeiptr length)const{ProfilingScope const scope(this,553);(this->*(this->m_orig_glInvalidateBufferSubData))(buffer,offset,length);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HNVPROC m_orig_glMultiTexCoord1hNV = nullptr;
+void m_glMultiTexCoord1hNV_profile(GLenum target,GLhalfNV s)const{ProfilingScope const scope(this,554);(this->*(this->m_orig_glMultiTexCoord1hNV))(target,s);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVPROC m_orig_glPointParameterfv = nullptr;
+void m_glPointParameterfv_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,555);(this->*(this->m_orig_glPointParameterfv))(pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVARBPROC m_orig_glUniformMatrix2fvARB = nullptr;
+void m_glUniformMatrix2fvARB_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,556);(this->*(this->m_orig_glUniformMatrix2fvARB))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLUNIFORM2FVPROC m_orig_glUniform2fv = nullptr;
+void m_glUniform2fv_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,557);(this->*(this->m_orig_glUniform2fv))(location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERLISTIBMPROC m_orig_glVertexPointerListIBM = nullptr;
+void m_glVertexPointerListIBM_profile(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,558);(this->*(this->m_orig_glVertexPointerListIBM))(size,type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENFVEXTPROC m_orig_glGetMultiTexGenfvEXT = nullptr;
+void m_glGetMultiTexGenfvEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,559);(this->*(this->m_orig_glGetMultiTexGenfvEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLGETMINMAXEXTPROC m_orig_glGetMinmaxEXT = nullptr;
+void m_glGetMinmaxEXT_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{ProfilingScope const scope(this,560);(this->*(this->m_orig_glGetMinmaxEXT))(target,reset,format,type,values);}
+FunctionTable::MEMBERPFNGLISFENCENVPROC m_orig_glIsFenceNV = nullptr;
+GLboolean m_glIsFenceNV_profile(GLuint fence)const{ProfilingScope const scope(this,561);return (this->*(this->m_orig_glIsFenceNV))(fence);}
+FunctionTable::MEMBERPFNGLMATRIXFRUSTUMEXTPROC m_orig_glMatrixFrustumEXT = nullptr;
+void m_glMatrixFrustumEXT_profile(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{ProfilingScope const scope(this,562);(this->*(this->m_orig_glMatrixFrustumEXT))(mode,left,right,bottom,top,zNear,zFar);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEINDIRECTPROC m_orig_glDispatchComputeIndirect = nullptr;
+void m_glDispatchComputeIndirect_profile(GLintptr indirect)const{ProfilingScope const scope(this,563);(this->*(this->m_orig_glDispatchComputeIndirect))(indirect);}
+FunctionTable::MEMBERPFNGLQUERYRESOURCENVPROC m_orig_glQueryResourceNV = nullptr;
+GLint m_glQueryResourceNV_profile(GLenum queryType,GLint tagId,GLuint bufSize,GLint* buffer)const{ProfilingScope const scope(this,564);return (this->*(this->m_orig_glQueryResourceNV))(queryType,tagId,bufSize,buffer);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BOESPROC m_orig_glMultiTexCoord4bOES = nullptr;
+void m_glMultiTexCoord4bOES_profile(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{ProfilingScope const scope(this,565);(this->*(this->m_orig_glMultiTexCoord4bOES))(texture,s,t,r,q);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DARBPROC m_orig_glProgramEnvParameter4dARB = nullptr;
+void m_glProgramEnvParameter4dARB_profile(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,566);(this->*(this->m_orig_glProgramEnvParameter4dARB))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIEXTPROC m_orig_glProgramUniform1uiEXT = nullptr;
+void m_glProgramUniform1uiEXT_profile(GLuint program,GLint location,GLuint v0)const{ProfilingScope const scope(this,567);(this->*(this->m_orig_glProgramUniform1uiEXT))(program,location,v0);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEPROC m_orig_glBindBufferRange = nullptr;
+void m_glBindBufferRange_profile(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,568);(this->*(this->m_orig_glBindBufferRange))(target,index,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLNORMAL3IVPROC m_orig_glNormal3iv = nullptr;
+void m_glNormal3iv_profile(const GLint* v)const{ProfilingScope const scope(this,569);(this->*(this->m_orig_glNormal3iv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVPROC m_orig_glVertexAttribL3dv = nullptr;
+void m_glVertexAttribL3dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,570);(this->*(this->m_orig_glVertexAttribL3dv))(index,v);}
+FunctionTable::MEMBERPFNGLGETUNIFORMDVPROC m_orig_glGetUniformdv = nullptr;
+void m_glGetUniformdv_profile(GLuint program,GLint location,GLdouble* params)const{ProfilingScope const scope(this,571);(this->*(this->m_orig_glGetUniformdv))(program,location,params);}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC m_orig_glGetMultiTexLevelParameterfvEXT = nullptr;
+void m_glGetMultiTexLevelParameterfvEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,572);(this->*(this->m_orig_glGetMultiTexLevelParameterfvEXT))(texunit,target,level,pname,params);}
+FunctionTable::MEMBERPFNGLFINALCOMBINERINPUTNVPROC m_orig_glFinalCombinerInputNV = nullptr;
+void m_glFinalCombinerInputNV_profile(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{ProfilingScope const scope(this,573);(this->*(this->m_orig_glFinalCombinerInputNV))(variable,input,mapping,componentUsage);}
+FunctionTable::MEMBERPFNGLCULLPARAMETERDVEXTPROC m_orig_glCullParameterdvEXT = nullptr;
+void m_glCullParameterdvEXT_profile(GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,574);(this->*(this->m_orig_glCullParameterdvEXT))(pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SPROC m_orig_glMultiTexCoord4s = nullptr;
+void m_glMultiTexCoord4s_profile(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{ProfilingScope const scope(this,575);(this->*(this->m_orig_glMultiTexCoord4s))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1FAPPLEPROC m_orig_glMapVertexAttrib1fAPPLE = nullptr;
+void m_glMapVertexAttrib1fAPPLE_profile(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{ProfilingScope const scope(this,576);(this->*(this->m_orig_glMapVertexAttrib1fAPPLE))(index,size,u1,u2,stride,order,points);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFEXTPROC m_orig_glConvolutionParameterfEXT = nullptr;
+void m_glConvolutionParameterfEXT_profile(GLenum target,GLenum pname,GLfloat params)const{ProfilingScope const scope(this,577);(this->*(this->m_orig_glConvolutionParameterfEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD1IVPROC m_orig_glTexCoord1iv = nullptr;
+void m_glTexCoord1iv_profile(const GLint* v)const{ProfilingScope const scope(this,578);(this->*(this->m_orig_glTexCoord1iv))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVEXTPROC m_orig_glProgramUniform3fvEXT = nullptr;
+void m_glProgramUniform3fvEXT_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,579);(this->*(this->m_orig_glProgramUniform3fvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLCOLOR3UIVPROC m_orig_glColor3uiv = nullptr;
+void m_glColor3uiv_profile(const GLuint* v)const{ProfilingScope const scope(this,580);(this->*(this->m_orig_glColor3uiv))(v);}
+FunctionTable::MEMBERPFNGLRENDERGPUMASKNVPROC m_orig_glRenderGpuMaskNV = nullptr;
+void m_glRenderGpuMaskNV_profile(GLbitfield mask)const{ProfilingScope const scope(this,581);(this->*(this->m_orig_glRenderGpuMaskNV))(mask);}
+FunctionTable::MEMBERPFNGLLISTBASEPROC m_orig_glListBase = nullptr;
+void m_glListBase_profile(GLuint base)const{ProfilingScope const scope(this,582);(this->*(this->m_orig_glListBase))(base);}
+FunctionTable::MEMBERPFNGLTEXCOORD2BOESPROC m_orig_glTexCoord2bOES = nullptr;
+void m_glTexCoord2bOES_profile(GLbyte s,GLbyte t)const{ProfilingScope const scope(this,583);(this->*(this->m_orig_glTexCoord2bOES))(s,t);}
+FunctionTable::MEMBERPFNGLBINDMATERIALPARAMETEREXTPROC m_orig_glBindMaterialParameterEXT = nullptr;
+GLuint m_glBindMaterialParameterEXT_profile(GLenum face,GLenum value)const{ProfilingScope const scope(this,584);return (this->*(this->m_orig_glBindMaterialParameterEXT))(face,value);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUBSUNPROC m_orig_glGlobalAlphaFactorubSUN = nullptr;
+void m_glGlobalAlphaFactorubSUN_profile(GLubyte factor)const{ProfilingScope const scope(this,585);(this->*(this->m_orig_glGlobalAlphaFactorubSUN))(factor);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64NVPROC m_orig_glVertexAttribL1ui64NV = nullptr;
+void m_glVertexAttribL1ui64NV_profile(GLuint index,GLuint64EXT x)const{ProfilingScope const scope(this,586);(this->*(this->m_orig_glVertexAttribL1ui64NV))(index,x);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFSGISPROC m_orig_glPointParameterfSGIS = nullptr;
+void m_glPointParameterfSGIS_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,587);(this->*(this->m_orig_glPointParameterfSGIS))(pname,param);}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC m_orig_glGetImageTransformParameterivHP = nullptr;
+void m_glGetImageTransformParameterivHP_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,588);(this->*(this->m_orig_glGetImageTransformParameterivHP))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEEXTPROC m_orig_glColorSubTableEXT = nullptr;
+void m_glColorSubTableEXT_profile(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,589);(this->*(this->m_orig_glColorSubTableEXT))(target,start,count,format,type,data);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFVSGISPROC m_orig_glPixelTexGenParameterfvSGIS = nullptr;
+void m_glPixelTexGenParameterfvSGIS_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,590);(this->*(this->m_orig_glPixelTexGenParameterfvSGIS))(pname,params);}
+FunctionTable::MEMBERPFNGLCLIENTWAITSYNCPROC m_orig_glClientWaitSync = nullptr;
+GLenum m_glClientWaitSync_profile(GLsync sync,GLbitfield flags,GLuint64 timeout)const{ProfilingScope const scope(this,591);return (this->*(this->m_orig_glClientWaitSync))(sync,flags,timeout);}
+FunctionTable::MEMBERPFNGLQUERYOBJECTPARAMETERUIAMDPROC m_orig_glQueryObjectParameteruiAMD = nullptr;
+void m_glQueryObjectParameteruiAMD_profile(GLenum target,GLuint id,GLenum pname,GLuint param)const{ProfilingScope const scope(this,592);(this->*(this->m_orig_glQueryObjectParameteruiAMD))(target,id,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1FVNVPROC m_orig_glVertexAttribs1fvNV = nullptr;
+void m_glVertexAttribs1fvNV_profile(GLuint index,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,593);(this->*(this->m_orig_glVertexAttribs1fvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVARBPROC m_orig_glVertexAttrib4NusvARB = nullptr;
+void m_glVertexAttrib4NusvARB_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,594);(this->*(this->m_orig_glVertexAttrib4NusvARB))(index,v);}
+FunctionTable::MEMBERPFNGLVARIANTPOINTEREXTPROC m_orig_glVariantPointerEXT = nullptr;
+void m_glVariantPointerEXT_profile(GLuint id,GLenum type,GLuint stride,const void* addr)const{ProfilingScope const scope(this,595);(this->*(this->m_orig_glVariantPointerEXT))(id,type,stride,addr);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERPROC m_orig_glTextureBuffer = nullptr;
+void m_glTextureBuffer_profile(GLuint texture,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,596);(this->*(this->m_orig_glTextureBuffer))(texture,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIEXTPROC m_orig_glVertexAttribI1uiEXT = nullptr;
+void m_glVertexAttribI1uiEXT_profile(GLuint index,GLuint x)const{ProfilingScope const scope(this,597);(this->*(this->m_orig_glVertexAttribI1uiEXT))(index,x);}
+FunctionTable::MEMBERPFNGLINVALIDATETEXIMAGEPROC m_orig_glInvalidateTexImage = nullptr;
+void m_glInvalidateTexImage_profile(GLuint texture,GLint level)const{ProfilingScope const scope(this,598);(this->*(this->m_orig_glInvalidateTexImage))(texture,level);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4IVNVPROC m_orig_glProgramEnvParametersI4ivNV = nullptr;
+void m_glProgramEnvParametersI4ivNV_profile(GLenum target,GLuint index,GLsizei count,const GLint* params)const{ProfilingScope const scope(this,599);(this->*(this->m_orig_glProgramEnvParametersI4ivNV))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXARRAYNVPROC m_orig_glPathGlyphIndexArrayNV = nullptr;
+GLenum m_glPathGlyphIndexArrayNV_profile(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{ProfilingScope const scope(this,600);return (this->*(this->m_orig_glPathGlyphIndexArrayNV))(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATAPROC m_orig_glCopyImageSubData = nullptr;
+void m_glCopyImageSubData_profile(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{ProfilingScope const scope(this,601);(this->*(this->m_orig_glCopyImageSubData))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+FunctionTable::MEMBERPFNGLGETUNIFORMSUBROUTINEUIVPROC m_orig_glGetUniformSubroutineuiv = nullptr;
+void m_glGetUniformSubroutineuiv_profile(GLenum shadertype,GLint location,GLuint* params)const{ProfilingScope const scope(this,602);(this->*(this->m_orig_glGetUniformSubroutineuiv))(shadertype,location,params);}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERPROC m_orig_glBindVertexBuffer = nullptr;
+void m_glBindVertexBuffer_profile(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{ProfilingScope const scope(this,603);(this->*(this->m_orig_glBindVertexBuffer))(bindingindex,buffer,offset,stride);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IARBPROC m_orig_glMultiTexCoord1iARB = nullptr;
+void m_glMultiTexCoord1iARB_profile(GLenum target,GLint s)const{ProfilingScope const scope(this,604);(this->*(this->m_orig_glMultiTexCoord1iARB))(target,s);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTPROC m_orig_glDebugMessageInsert = nullptr;
+void m_glDebugMessageInsert_profile(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{ProfilingScope const scope(this,605);(this->*(this->m_orig_glDebugMessageInsert))(source,type,id,severity,length,buf);}
+FunctionTable::MEMBERPFNGLBEGINVERTEXSHADEREXTPROC m_orig_glBeginVertexShaderEXT = nullptr;
+void m_glBeginVertexShaderEXT_profile()const{ProfilingScope const scope(this,606);(this->*(this->m_orig_glBeginVertexShaderEXT))();}
+FunctionTable::MEMBERPFNGLISVARIANTENABLEDEXTPROC m_orig_glIsVariantEnabledEXT = nullptr;
+GLboolean m_glIsVariantEnabledEXT_profile(GLuint id,GLenum cap)const{ProfilingScope const scope(this,607);return (this->*(this->m_orig_glIsVariantEnabledEXT))(id,cap);}
+FunctionTable::MEMBERPFNGLPASSTHROUGHXOESPROC m_orig_glPassThroughxOES = nullptr;
+void m_glPassThroughxOES_profile(GLfixed token)const{ProfilingScope const scope(this,608);(this->*(this->m_orig_glPassThroughxOES))(token);}
+FunctionTable::MEMBERPFNGLISSAMPLERPROC m_orig_glIsSampler = nullptr;
+GLboolean m_glIsSampler_profile(GLuint sampler)const{ProfilingScope const scope(this,609);return (this->*(this->m_orig_glIsSampler))(sampler);}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERFNVPROC m_orig_glConservativeRasterParameterfNV = nullptr;
+void m_glConservativeRasterParameterfNV_profile(GLenum pname,GLfloat value)const{ProfilingScope const scope(this,610);(this->*(this->m_orig_glConservativeRasterParameterfNV))(pname,value);}
+FunctionTable::MEMBERPFNGLMULTITEXGENIVEXTPROC m_orig_glMultiTexGenivEXT = nullptr;
+void m_glMultiTexGenivEXT_profile(GLenum texunit,GLenum coord,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,611);(this->*(this->m_orig_glMultiTexGenivEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC m_orig_glNamedFramebufferTexture2DEXT = nullptr;
+void m_glNamedFramebufferTexture2DEXT_profile(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,612);(this->*(this->m_orig_glNamedFramebufferTexture2DEXT))(framebuffer,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DPROC m_orig_glCopyTexSubImage1D = nullptr;
+void m_glCopyTexSubImage1D_profile(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,613);(this->*(this->m_orig_glCopyTexSubImage1D))(target,level,xoffset,x,y,width);}
+FunctionTable::MEMBERPFNGLTEXCOORD1IPROC m_orig_glTexCoord1i = nullptr;
+void m_glTexCoord1i_profile(GLint s)const{ProfilingScope const scope(this,614);(this->*(this->m_orig_glTexCoord1i))(s);}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSPROC m_orig_glCheckFramebufferStatus = nullptr;
+GLenum m_glCheckFramebufferStatus_profile(GLenum target)const{ProfilingScope const scope(this,615);return (this->*(this->m_orig_glCheckFramebufferStatus))(target);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTARRAYAPPLEPROC m_orig_glDrawElementArrayAPPLE = nullptr;
+void m_glDrawElementArrayAPPLE_profile(GLenum mode,GLint first,GLsizei count)const{ProfilingScope const scope(this,616);(this->*(this->m_orig_glDrawElementArrayAPPLE))(mode,first,count);}
+FunctionTable::MEMBERPFNGLTEXCOORD1DPROC m_orig_glTexCoord1d = nullptr;
+void m_glTexCoord1d_profile(GLdouble s)const{ProfilingScope const scope(this,617);(this->*(this->m_orig_glTexCoord1d))(s);}
+FunctionTable::MEMBERPFNGLTEXCOORD1FPROC m_orig_glTexCoord1f = nullptr;
+void m_glTexCoord1f_profile(GLfloat s)const{ProfilingScope const scope(this,618);(this->*(this->m_orig_glTexCoord1f))(s);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTIVSGIXPROC m_orig_glFragmentLightivSGIX = nullptr;
+void m_glFragmentLightivSGIX_profile(GLenum light,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,619);(this->*(this->m_orig_glFragmentLightivSGIX))(light,pname,params);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREPROC m_orig_glBindImageTexture = nullptr;
+void m_glBindImageTexture_profile(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format)const{ProfilingScope const scope(this,620);(this->*(this->m_orig_glBindImageTexture))(unit,texture,level,layered,layer,access,format);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSPROC m_orig_glTransformFeedbackVaryings = nullptr;
+void m_glTransformFeedbackVaryings_profile(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{ProfilingScope const scope(this,621);(this->*(this->m_orig_glTransformFeedbackVaryings))(program,count,varyings,bufferMode);}
+FunctionTable::MEMBERPFNGLMULTICASTBUFFERSUBDATANVPROC m_orig_glMulticastBufferSubDataNV = nullptr;
+void m_glMulticastBufferSubDataNV_profile(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const GLvoid* data)const{ProfilingScope const scope(this,622);(this->*(this->m_orig_glMulticastBufferSubDataNV))(gpuMask,buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSPROC m_orig_glDrawRangeElements = nullptr;
+void m_glDrawRangeElements_profile(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices)const{ProfilingScope const scope(this,623);(this->*(this->m_orig_glDrawRangeElements))(mode,start,end,count,type,indices);}
+FunctionTable::MEMBERPFNGLTEXCOORD1SPROC m_orig_glTexCoord1s = nullptr;
+void m_glTexCoord1s_profile(GLshort s)const{ProfilingScope const scope(this,624);(this->*(this->m_orig_glTexCoord1s))(s);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEPROC m_orig_glBindBufferBase = nullptr;
+void m_glBindBufferBase_profile(GLenum target,GLuint index,GLuint buffer)const{ProfilingScope const scope(this,625);(this->*(this->m_orig_glBindBufferBase))(target,index,buffer);}
+FunctionTable::MEMBERPFNGLCOLOR3BVPROC m_orig_glColor3bv = nullptr;
+void m_glColor3bv_profile(const GLbyte* v)const{ProfilingScope const scope(this,626);(this->*(this->m_orig_glColor3bv))(v);}
+FunctionTable::MEMBERPFNGLSYNCTEXTUREINTELPROC m_orig_glSyncTextureINTEL = nullptr;
+void m_glSyncTextureINTEL_profile(GLuint texture)const{ProfilingScope const scope(this,627);(this->*(this->m_orig_glSyncTextureINTEL))(texture);}
+FunctionTable::MEMBERPFNGLCREATESAMPLERSPROC m_orig_glCreateSamplers = nullptr;
+void m_glCreateSamplers_profile(GLsizei n,GLuint* samplers)const{ProfilingScope const scope(this,628);(this->*(this->m_orig_glCreateSamplers))(n,samplers);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFNVPROC m_orig_glCombinerParameterfNV = nullptr;
+void m_glCombinerParameterfNV_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,629);(this->*(this->m_orig_glCombinerParameterfNV))(pname,param);}
+FunctionTable::MEMBERPFNGLGETARRAYOBJECTIVATIPROC m_orig_glGetArrayObjectivATI = nullptr;
+void m_glGetArrayObjectivATI_profile(GLenum array,GLenum pname,GLint* params)const{ProfilingScope const scope(this,630);(this->*(this->m_orig_glGetArrayObjectivATI))(array,pname,params);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSPROC m_orig_glMultiDrawArrays = nullptr;
+void m_glMultiDrawArrays_profile(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount)const{ProfilingScope const scope(this,631);(this->*(this->m_orig_glMultiDrawArrays))(mode,first,count,drawcount);}
+FunctionTable::MEMBERPFNGLSAMPLEMAPATIPROC m_orig_glSampleMapATI = nullptr;
+void m_glSampleMapATI_profile(GLuint dst,GLuint interp,GLenum swizzle)const{ProfilingScope const scope(this,632);(this->*(this->m_orig_glSampleMapATI))(dst,interp,swizzle);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64ARBPROC m_orig_glProgramUniform2i64ARB = nullptr;
+void m_glProgramUniform2i64ARB_profile(GLuint program,GLint location,GLint64 x,GLint64 y)const{ProfilingScope const scope(this,633);(this->*(this->m_orig_glProgramUniform2i64ARB))(program,location,x,y);}
+FunctionTable::MEMBERPFNGLBINORMAL3IVEXTPROC m_orig_glBinormal3ivEXT = nullptr;
+void m_glBinormal3ivEXT_profile(const GLint* v)const{ProfilingScope const scope(this,634);(this->*(this->m_orig_glBinormal3ivEXT))(v);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC m_orig_glMultiDrawArraysIndirectCountARB = nullptr;
+void m_glMultiDrawArraysIndirectCountARB_profile(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{ProfilingScope const scope(this,635);(this->*(this->m_orig_glMultiDrawArraysIndirectCountARB))(mode,indirect,drawcount,maxdrawcount,stride);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM1DEXTPROC m_orig_glTextureStorageMem1DEXT = nullptr;
+void m_glTextureStorageMem1DEXT_profile(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,636);(this->*(this->m_orig_glTextureStorageMem1DEXT))(texture,levels,internalFormat,width,memory,offset);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVMESAPROC m_orig_glWindowPos2ivMESA = nullptr;
+void m_glWindowPos2ivMESA_profile(const GLint* v)const{ProfilingScope const scope(this,637);(this->*(this->m_orig_glWindowPos2ivMESA))(v);}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIPROC m_orig_glTexCoordP4ui = nullptr;
+void m_glTexCoordP4ui_profile(GLenum type,GLuint coords)const{ProfilingScope const scope(this,638);(this->*(this->m_orig_glTexCoordP4ui))(type,coords);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE1DEXTPROC m_orig_glMultiTexSubImage1DEXT = nullptr;
+void m_glMultiTexSubImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,639);(this->*(this->m_orig_glMultiTexSubImage1DEXT))(texunit,target,level,xoffset,width,format,type,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC m_orig_glProgramUniformMatrix2x3fvEXT = nullptr;
+void m_glProgramUniformMatrix2x3fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,640);(this->*(this->m_orig_glProgramUniformMatrix2x3fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLBUFFERDATAARBPROC m_orig_glBufferDataARB = nullptr;
+void m_glBufferDataARB_profile(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage)const{ProfilingScope const scope(this,641);(this->*(this->m_orig_glBufferDataARB))(target,size,data,usage);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATPROC m_orig_glVertexAttribIFormat = nullptr;
+void m_glVertexAttribIFormat_profile(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,642);(this->*(this->m_orig_glVertexAttribIFormat))(attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLCREATEFRAMEBUFFERSPROC m_orig_glCreateFramebuffers = nullptr;
+void m_glCreateFramebuffers_profile(GLsizei n,GLuint* framebuffers)const{ProfilingScope const scope(this,643);(this->*(this->m_orig_glCreateFramebuffers))(n,framebuffers);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DVATIPROC m_orig_glNormalStream3dvATI = nullptr;
+void m_glNormalStream3dvATI_profile(GLenum stream,const GLdouble* coords)const{ProfilingScope const scope(this,644);(this->*(this->m_orig_glNormalStream3dvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLCLEARACCUMPROC m_orig_glClearAccum = nullptr;
+void m_glClearAccum_profile(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{ProfilingScope const scope(this,645);(this->*(this->m_orig_glClearAccum))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VNVPROC m_orig_glUniform3i64vNV = nullptr;
+void m_glUniform3i64vNV_profile(GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,646);(this->*(this->m_orig_glUniform3i64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FSUNPROC m_orig_glNormal3fVertex3fSUN = nullptr;
+void m_glNormal3fVertex3fSUN_profile(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,647);(this->*(this->m_orig_glNormal3fVertex3fSUN))(nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVEXTPROC m_orig_glUniform2uivEXT = nullptr;
+void m_glUniform2uivEXT_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,648);(this->*(this->m_orig_glUniform2uivEXT))(location,count,value);}
+FunctionTable::MEMBERPFNGLBEGINQUERYPROC m_orig_glBeginQuery = nullptr;
+void m_glBeginQuery_profile(GLenum target,GLuint id)const{ProfilingScope const scope(this,649);(this->*(this->m_orig_glBeginQuery))(target,id);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC m_orig_glStencilThenCoverStrokePathInstancedNV = nullptr;
+void m_glStencilThenCoverStrokePathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,650);(this->*(this->m_orig_glStencilThenCoverStrokePathInstancedNV))(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLBINDBUFFERPROC m_orig_glBindBuffer = nullptr;
+void m_glBindBuffer_profile(GLenum target,GLuint buffer)const{ProfilingScope const scope(this,651);(this->*(this->m_orig_glBindBuffer))(target,buffer);}
+FunctionTable::MEMBERPFNGLMAP2DPROC m_orig_glMap2d = nullptr;
+void m_glMap2d_profile(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{ProfilingScope const scope(this,652);(this->*(this->m_orig_glMap2d))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+FunctionTable::MEMBERPFNGLMAP2FPROC m_orig_glMap2f = nullptr;
+void m_glMap2f_profile(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{ProfilingScope const scope(this,653);(this->*(this->m_orig_glMap2f))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTNVPROC m_orig_glMakeImageHandleResidentNV = nullptr;
+void m_glMakeImageHandleResidentNV_profile(GLuint64 handle,GLenum access)const{ProfilingScope const scope(this,654);(this->*(this->m_orig_glMakeImageHandleResidentNV))(handle,access);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4FVPROC m_orig_glUniformMatrix2x4fv = nullptr;
+void m_glUniformMatrix2x4fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,655);(this->*(this->m_orig_glUniformMatrix2x4fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERFVEXTPROC m_orig_glGetMultiTexParameterfvEXT = nullptr;
+void m_glGetMultiTexParameterfvEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,656);(this->*(this->m_orig_glGetMultiTexParameterfvEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEINDEXEDPROC m_orig_glDepthRangeIndexed = nullptr;
+void m_glDepthRangeIndexed_profile(GLuint index,GLdouble n,GLdouble f)const{ProfilingScope const scope(this,657);(this->*(this->m_orig_glDepthRangeIndexed))(index,n,f);}
+FunctionTable::MEMBERPFNGLISENABLEDPROC m_orig_glIsEnabled = nullptr;
+GLboolean m_glIsEnabled_profile(GLenum cap)const{ProfilingScope const scope(this,658);return (this->*(this->m_orig_glIsEnabled))(cap);}
+FunctionTable::MEMBERPFNGLMATRIXSCALEFEXTPROC m_orig_glMatrixScalefEXT = nullptr;
+void m_glMatrixScalefEXT_profile(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,659);(this->*(this->m_orig_glMatrixScalefEXT))(mode,x,y,z);}
+FunctionTable::MEMBERPFNGLGETERRORPROC m_orig_glGetError = nullptr;
+GLenum m_glGetError_profile()const{ProfilingScope const scope(this,660);return (this->*(this->m_orig_glGetError))();}
+FunctionTable::MEMBERPFNGLGETTEXENVIVPROC m_orig_glGetTexEnviv = nullptr;
+void m_glGetTexEnviv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,661);(this->*(this->m_orig_glGetTexEnviv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPARAMETEREXTPROC m_orig_glBindTextureUnitParameterEXT = nullptr;
+GLuint m_glBindTextureUnitParameterEXT_profile(GLenum unit,GLenum value)const{ProfilingScope const scope(this,662);return (this->*(this->m_orig_glBindTextureUnitParameterEXT))(unit,value);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMFVARBPROC m_orig_glGetnUniformfvARB = nullptr;
+void m_glGetnUniformfvARB_profile(GLuint program,GLint location,GLsizei bufSize,GLfloat* params)const{ProfilingScope const scope(this,663);(this->*(this->m_orig_glGetnUniformfvARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiNormal3fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,664);(this->*(this->m_orig_glReplacementCodeuiNormal3fVertex3fvSUN))(rc,n,v);}
+FunctionTable::MEMBERPFNGLDELETEPERFQUERYINTELPROC m_orig_glDeletePerfQueryINTEL = nullptr;
+void m_glDeletePerfQueryINTEL_profile(GLuint queryHandle)const{ProfilingScope const scope(this,665);(this->*(this->m_orig_glDeletePerfQueryINTEL))(queryHandle);}
+FunctionTable::MEMBERPFNGLACTIVEVARYINGNVPROC m_orig_glActiveVaryingNV = nullptr;
+void m_glActiveVaryingNV_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,666);(this->*(this->m_orig_glActiveVaryingNV))(program,name);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMARBPROC m_orig_glGetActiveUniformARB = nullptr;
+void m_glGetActiveUniformARB_profile(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{ProfilingScope const scope(this,667);(this->*(this->m_orig_glGetActiveUniformARB))(programObj,index,maxLength,length,size,type,name);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVEXTPROC m_orig_glVertexAttribI3ivEXT = nullptr;
+void m_glVertexAttribI3ivEXT_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,668);(this->*(this->m_orig_glVertexAttribI3ivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLEVALCOORD1DPROC m_orig_glEvalCoord1d = nullptr;
+void m_glEvalCoord1d_profile(GLdouble u)const{ProfilingScope const scope(this,669);(this->*(this->m_orig_glEvalCoord1d))(u);}
+FunctionTable::MEMBERPFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC m_orig_glNamedCopyBufferSubDataEXT = nullptr;
+void m_glNamedCopyBufferSubDataEXT_profile(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{ProfilingScope const scope(this,670);(this->*(this->m_orig_glNamedCopyBufferSubDataEXT))(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+FunctionTable::MEMBERPFNGLEVALCOORD1FPROC m_orig_glEvalCoord1f = nullptr;
+void m_glEvalCoord1f_profile(GLfloat u)const{ProfilingScope const scope(this,671);(this->*(this->m_orig_glEvalCoord1f))(u);}
+FunctionTable::MEMBERPFNGLPIXELMAPFVPROC m_orig_glPixelMapfv = nullptr;
+void m_glPixelMapfv_profile(GLenum map,GLsizei mapsize,const GLfloat* values)const{ProfilingScope const scope(this,672);(this->*(this->m_orig_glPixelMapfv))(map,mapsize,values);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVEXTPROC m_orig_glVertexAttribI1ivEXT = nullptr;
+void m_glVertexAttribI1ivEXT_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,673);(this->*(this->m_orig_glVertexAttribI1ivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLCREATESYNCFROMCLEVENTARBPROC m_orig_glCreateSyncFromCLeventARB = nullptr;
+GLsync m_glCreateSyncFromCLeventARB_profile(struct _cl_context* context,struct _cl_event* event,GLbitfield flags)const{ProfilingScope const scope(this,674);return (this->*(this->m_orig_glCreateSyncFromCLeventARB))(context,event,flags);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPUSVPROC m_orig_glGetPixelMapusv = nullptr;
+void m_glGetPixelMapusv_profile(GLenum map,GLushort* values)const{ProfilingScope const scope(this,675);(this->*(this->m_orig_glGetPixelMapusv))(map,values);}
+FunctionTable::MEMBERPFNGLGETNCOLORTABLEARBPROC m_orig_glGetnColorTableARB = nullptr;
+void m_glGetnColorTableARB_profile(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table)const{ProfilingScope const scope(this,676);(this->*(this->m_orig_glGetnColorTableARB))(target,format,type,bufSize,table);}
+FunctionTable::MEMBERPFNGLACCUMPROC m_orig_glAccum = nullptr;
+void m_glAccum_profile(GLenum op,GLfloat value)const{ProfilingScope const scope(this,677);(this->*(this->m_orig_glAccum))(op,value);}
+FunctionTable::MEMBERPFNGLRASTERPOS3SVPROC m_orig_glRasterPos3sv = nullptr;
+void m_glRasterPos3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,678);(this->*(this->m_orig_glRasterPos3sv))(v);}
+FunctionTable::MEMBERPFNGLTEXCOORD2IVPROC m_orig_glTexCoord2iv = nullptr;
+void m_glTexCoord2iv_profile(const GLint* v)const{ProfilingScope const scope(this,679);(this->*(this->m_orig_glTexCoord2iv))(v);}
+FunctionTable::MEMBERPFNGLBLENDFUNCIARBPROC m_orig_glBlendFunciARB = nullptr;
+void m_glBlendFunciARB_profile(GLuint buf,GLenum src,GLenum dst)const{ProfilingScope const scope(this,680);(this->*(this->m_orig_glBlendFunciARB))(buf,src,dst);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VARBPROC m_orig_glProgramUniform3i64vARB = nullptr;
+void m_glProgramUniform3i64vARB_profile(GLuint program,GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,681);(this->*(this->m_orig_glProgramUniform3i64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_orig_glGetFramebufferAttachmentParameteriv = nullptr;
+void m_glGetFramebufferAttachmentParameteriv_profile(GLenum target,GLenum attachment,GLenum pname,GLint* params)const{ProfilingScope const scope(this,682);(this->*(this->m_orig_glGetFramebufferAttachmentParameteriv))(target,attachment,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIPROC m_orig_glProgramUniform4ui = nullptr;
+void m_glProgramUniform4ui_profile(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{ProfilingScope const scope(this,683);(this->*(this->m_orig_glProgramUniform4ui))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLSTENCILMASKPROC m_orig_glStencilMask = nullptr;
+void m_glStencilMask_profile(GLuint mask)const{ProfilingScope const scope(this,684);(this->*(this->m_orig_glStencilMask))(mask);}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMEXTPROC m_orig_glResetHistogramEXT = nullptr;
+void m_glResetHistogramEXT_profile(GLenum target)const{ProfilingScope const scope(this,685);(this->*(this->m_orig_glResetHistogramEXT))(target);}
+FunctionTable::MEMBERPFNGLLIGHTXOESPROC m_orig_glLightxOES = nullptr;
+void m_glLightxOES_profile(GLenum light,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,686);(this->*(this->m_orig_glLightxOES))(light,pname,param);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAPROC m_orig_glNamedBufferData = nullptr;
+void m_glNamedBufferData_profile(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{ProfilingScope const scope(this,687);(this->*(this->m_orig_glNamedBufferData))(buffer,size,data,usage);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SATIPROC m_orig_glVertexStream3sATI = nullptr;
+void m_glVertexStream3sATI_profile(GLenum stream,GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,688);(this->*(this->m_orig_glVertexStream3sATI))(stream,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVARBPROC m_orig_glVertexAttrib3fvARB = nullptr;
+void m_glVertexAttrib3fvARB_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,689);(this->*(this->m_orig_glVertexAttrib3fvARB))(index,v);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAPROC m_orig_glClearNamedBufferSubData = nullptr;
+void m_glClearNamedBufferSubData_profile(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,690);(this->*(this->m_orig_glClearNamedBufferSubData))(buffer,internalformat,offset,size,format,type,data);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC m_orig_glProgramUniformHandleui64ARB = nullptr;
+void m_glProgramUniformHandleui64ARB_profile(GLuint program,GLint location,GLuint64 value)const{ProfilingScope const scope(this,691);(this->*(this->m_orig_glProgramUniformHandleui64ARB))(program,location,value);}
+FunctionTable::MEMBERPFNGLUNIFORM3IARBPROC m_orig_glUniform3iARB = nullptr;
+void m_glUniform3iARB_profile(GLint location,GLint v0,GLint v1,GLint v2)const{ProfilingScope const scope(this,692);(this->*(this->m_orig_glUniform3iARB))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMOBJECTARBPROC m_orig_glCreateProgramObjectARB = nullptr;
+GLhandleARB m_glCreateProgramObjectARB_profile()const{ProfilingScope const scope(this,693);return (this->*(this->m_orig_glCreateProgramObjectARB))();}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVARBPROC m_orig_glMultiTexCoord1dvARB = nullptr;
+void m_glMultiTexCoord1dvARB_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,694);(this->*(this->m_orig_glMultiTexCoord1dvARB))(target,v);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERFVARBPROC m_orig_glGetObjectParameterfvARB = nullptr;
+void m_glGetObjectParameterfvARB_profile(GLhandleARB obj,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,695);(this->*(this->m_orig_glGetObjectParameterfvARB))(obj,pname,params);}
+FunctionTable::MEMBERPFNGLRECTSVPROC m_orig_glRectsv = nullptr;
+void m_glRectsv_profile(const GLshort* v1,const GLshort* v2)const{ProfilingScope const scope(this,696);(this->*(this->m_orig_glRectsv))(v1,v2);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE2DEXTPROC m_orig_glMultiTexImage2DEXT = nullptr;
+void m_glMultiTexImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,697);(this->*(this->m_orig_glMultiTexImage2DEXT))(texunit,target,level,internalformat,width,height,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64NVPROC m_orig_glProgramUniform1i64NV = nullptr;
+void m_glProgramUniform1i64NV_profile(GLuint program,GLint location,GLint64EXT x)const{ProfilingScope const scope(this,698);(this->*(this->m_orig_glProgramUniform1i64NV))(program,location,x);}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERIVATIPROC m_orig_glGetObjectBufferivATI = nullptr;
+void m_glGetObjectBufferivATI_profile(GLuint buffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,699);(this->*(this->m_orig_glGetObjectBufferivATI))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64ARBPROC m_orig_glUniform4i64ARB = nullptr;
+void m_glUniform4i64ARB_profile(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{ProfilingScope const scope(this,700);(this->*(this->m_orig_glUniform4i64ARB))(location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor4ubVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fvSUN_profile(const GLuint* rc,const GLubyte* c,const GLfloat* v)const{ProfilingScope const scope(this,701);(this->*(this->m_orig_glReplacementCodeuiColor4ubVertex3fvSUN))(rc,c,v);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINGRPROC m_orig_glBlendFuncSeparateINGR = nullptr;
+void m_glBlendFuncSeparateINGR_profile(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{ProfilingScope const scope(this,702);(this->*(this->m_orig_glBlendFuncSeparateINGR))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMFVNVPROC m_orig_glGetVideoCaptureStreamfvNV = nullptr;
+void m_glGetVideoCaptureStreamfvNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,703);(this->*(this->m_orig_glGetVideoCaptureStreamfvNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FARBPROC m_orig_glVertexAttrib2fARB = nullptr;
+void m_glVertexAttrib2fARB_profile(GLuint index,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,704);(this->*(this->m_orig_glVertexAttrib2fARB))(index,x,y);}
+FunctionTable::MEMBERPFNGLGETTEXGENIVPROC m_orig_glGetTexGeniv = nullptr;
+void m_glGetTexGeniv_profile(GLenum coord,GLenum pname,GLint* params)const{ProfilingScope const scope(this,705);(this->*(this->m_orig_glGetTexGeniv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLPIXELSTOREIPROC m_orig_glPixelStorei = nullptr;
+void m_glPixelStorei_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,706);(this->*(this->m_orig_glPixelStorei))(pname,param);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC m_orig_glGetCompressedTextureSubImage = nullptr;
+void m_glGetCompressedTextureSubImage_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,707);(this->*(this->m_orig_glGetCompressedTextureSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLCOPYIMAGESUBDATANVPROC m_orig_glCopyImageSubDataNV = nullptr;
+void m_glCopyImageSubDataNV_profile(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,708);(this->*(this->m_orig_glCopyImageSubDataNV))(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+FunctionTable::MEMBERPFNGLACTIVESHADERPROGRAMPROC m_orig_glActiveShaderProgram = nullptr;
+void m_glActiveShaderProgram_profile(GLuint pipeline,GLuint program)const{ProfilingScope const scope(this,709);(this->*(this->m_orig_glActiveShaderProgram))(pipeline,program);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1IATIPROC m_orig_glVertexStream1iATI = nullptr;
+void m_glVertexStream1iATI_profile(GLenum stream,GLint x)const{ProfilingScope const scope(this,710);(this->*(this->m_orig_glVertexStream1iATI))(stream,x);}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERFVPROC m_orig_glPatchParameterfv = nullptr;
+void m_glPatchParameterfv_profile(GLenum pname,const GLfloat* values)const{ProfilingScope const scope(this,711);(this->*(this->m_orig_glPatchParameterfv))(pname,values);}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFEREXTPROC m_orig_glIsFramebufferEXT = nullptr;
+GLboolean m_glIsFramebufferEXT_profile(GLuint framebuffer)const{ProfilingScope const scope(this,712);return (this->*(this->m_orig_glIsFramebufferEXT))(framebuffer);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DPROC m_orig_glTextureStorage2D = nullptr;
+void m_glTextureStorage2D_profile(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,713);(this->*(this->m_orig_glTextureStorage2D))(texture,levels,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64ARBPROC m_orig_glProgramUniform1ui64ARB = nullptr;
+void m_glProgramUniform1ui64ARB_profile(GLuint program,GLint location,GLuint64 x)const{ProfilingScope const scope(this,714);(this->*(this->m_orig_glProgramUniform1ui64ARB))(program,location,x);}
+FunctionTable::MEMBERPFNGLTEXBUFFERRANGEPROC m_orig_glTexBufferRange = nullptr;
+void m_glTexBufferRange_profile(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,715);(this->*(this->m_orig_glTexBufferRange))(target,internalformat,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLGETPIXELTEXGENPARAMETERIVSGISPROC m_orig_glGetPixelTexGenParameterivSGIS = nullptr;
+void m_glGetPixelTexGenParameterivSGIS_profile(GLenum pname,GLint* params)const{ProfilingScope const scope(this,716);(this->*(this->m_orig_glGetPixelTexGenParameterivSGIS))(pname,params);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DEXTPROC m_orig_glTextureSubImage3DEXT = nullptr;
+void m_glTextureSubImage3DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,717);(this->*(this->m_orig_glTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+FunctionTable::MEMBERPFNGLCLIPCONTROLPROC m_orig_glClipControl = nullptr;
+void m_glClipControl_profile(GLenum origin,GLenum depth)const{ProfilingScope const scope(this,718);(this->*(this->m_orig_glClipControl))(origin,depth);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEIVPROC m_orig_glGetProgramResourceiv = nullptr;
+void m_glGetProgramResourceiv_profile(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params)const{ProfilingScope const scope(this,719);(this->*(this->m_orig_glGetProgramResourceiv))(program,programInterface,index,propCount,props,bufSize,length,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP2UIVPROC m_orig_glMultiTexCoordP2uiv = nullptr;
+void m_glMultiTexCoordP2uiv_profile(GLenum texture,GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,720);(this->*(this->m_orig_glMultiTexCoordP2uiv))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIPROC m_orig_glVertexAttribI3ui = nullptr;
+void m_glVertexAttribI3ui_profile(GLuint index,GLuint x,GLuint y,GLuint z)const{ProfilingScope const scope(this,721);(this->*(this->m_orig_glVertexAttribI3ui))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKSGISPROC m_orig_glSampleMaskSGIS = nullptr;
+void m_glSampleMaskSGIS_profile(GLclampf value,GLboolean invert)const{ProfilingScope const scope(this,722);(this->*(this->m_orig_glSampleMaskSGIS))(value,invert);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVARBPROC m_orig_glVertexAttrib4NivARB = nullptr;
+void m_glVertexAttrib4NivARB_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,723);(this->*(this->m_orig_glVertexAttrib4NivARB))(index,v);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORFSUNPROC m_orig_glGlobalAlphaFactorfSUN = nullptr;
+void m_glGlobalAlphaFactorfSUN_profile(GLfloat factor)const{ProfilingScope const scope(this,724);(this->*(this->m_orig_glGlobalAlphaFactorfSUN))(factor);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC m_orig_glBlendEquationSeparateIndexedAMD = nullptr;
+void m_glBlendEquationSeparateIndexedAMD_profile(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{ProfilingScope const scope(this,725);(this->*(this->m_orig_glBlendEquationSeparateIndexedAMD))(buf,modeRGB,modeAlpha);}
+FunctionTable::MEMBERPFNGLGETPERFCOUNTERINFOINTELPROC m_orig_glGetPerfCounterInfoINTEL = nullptr;
+void m_glGetPerfCounterInfoINTEL_profile(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue)const{ProfilingScope const scope(this,726);(this->*(this->m_orig_glGetPerfCounterInfoINTEL))(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSNVPROC m_orig_glDeleteProgramsNV = nullptr;
+void m_glDeleteProgramsNV_profile(GLsizei n,const GLuint* programs)const{ProfilingScope const scope(this,727);(this->*(this->m_orig_glDeleteProgramsNV))(n,programs);}
+FunctionTable::MEMBERPFNGLPIXELZOOMXOESPROC m_orig_glPixelZoomxOES = nullptr;
+void m_glPixelZoomxOES_profile(GLfixed xfactor,GLfixed yfactor)const{ProfilingScope const scope(this,728);(this->*(this->m_orig_glPixelZoomxOES))(xfactor,yfactor);}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC m_orig_glGetCombinerOutputParameterivNV = nullptr;
+void m_glGetCombinerOutputParameterivNV_profile(GLenum stage,GLenum portion,GLenum pname,GLint* params)const{ProfilingScope const scope(this,729);(this->*(this->m_orig_glGetCombinerOutputParameterivNV))(stage,portion,pname,params);}
+FunctionTable::MEMBERPFNGLRASTERPOS2XVOESPROC m_orig_glRasterPos2xvOES = nullptr;
+void m_glRasterPos2xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,730);(this->*(this->m_orig_glRasterPos2xvOES))(coords);}
+FunctionTable::MEMBERPFNGLGETTEXIMAGEPROC m_orig_glGetTexImage = nullptr;
+void m_glGetTexImage_profile(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels)const{ProfilingScope const scope(this,731);(this->*(this->m_orig_glGetTexImage))(target,level,format,type,pixels);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERSPROC m_orig_glVertexArrayVertexBuffers = nullptr;
+void m_glVertexArrayVertexBuffers_profile(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{ProfilingScope const scope(this,732);(this->*(this->m_orig_glVertexArrayVertexBuffers))(vaobj,first,count,buffers,offsets,strides);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64NVPROC m_orig_glUniform1ui64NV = nullptr;
+void m_glUniform1ui64NV_profile(GLint location,GLuint64EXT x)const{ProfilingScope const scope(this,733);(this->*(this->m_orig_glUniform1ui64NV))(location,x);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIPROC m_orig_glProgramParameteri = nullptr;
+void m_glProgramParameteri_profile(GLuint program,GLenum pname,GLint value)const{ProfilingScope const scope(this,734);(this->*(this->m_orig_glProgramParameteri))(program,pname,value);}
+FunctionTable::MEMBERPFNGLNORMAL3XOESPROC m_orig_glNormal3xOES = nullptr;
+void m_glNormal3xOES_profile(GLfixed nx,GLfixed ny,GLfixed nz)const{ProfilingScope const scope(this,735);(this->*(this->m_orig_glNormal3xOES))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLGETMAPFVPROC m_orig_glGetMapfv = nullptr;
+void m_glGetMapfv_profile(GLenum target,GLenum query,GLfloat* v)const{ProfilingScope const scope(this,736);(this->*(this->m_orig_glGetMapfv))(target,query,v);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DVATIPROC m_orig_glVertexStream2dvATI = nullptr;
+void m_glVertexStream2dvATI_profile(GLenum stream,const GLdouble* coords)const{ProfilingScope const scope(this,737);(this->*(this->m_orig_glVertexStream2dvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPATHSTENCILDEPTHOFFSETNVPROC m_orig_glPathStencilDepthOffsetNV = nullptr;
+void m_glPathStencilDepthOffsetNV_profile(GLfloat factor,GLfloat units)const{ProfilingScope const scope(this,738);(this->*(this->m_orig_glPathStencilDepthOffsetNV))(factor,units);}
+FunctionTable::MEMBERPFNGLISSTATENVPROC m_orig_glIsStateNV = nullptr;
+GLboolean m_glIsStateNV_profile(GLuint state)const{ProfilingScope const scope(this,739);return (this->*(this->m_orig_glIsStateNV))(state);}
+FunctionTable::MEMBERPFNGLGETINTEGERUI64VNVPROC m_orig_glGetIntegerui64vNV = nullptr;
+void m_glGetIntegerui64vNV_profile(GLenum value,GLuint64EXT* result)const{ProfilingScope const scope(this,740);(this->*(this->m_orig_glGetIntegerui64vNV))(value,result);}
+FunctionTable::MEMBERPFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC m_orig_glGetImageTransformParameterfvHP = nullptr;
+void m_glGetImageTransformParameterfvHP_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,741);(this->*(this->m_orig_glGetImageTransformParameterfvHP))(target,pname,params);}
+FunctionTable::MEMBERPFNGLRASTERPOS2FVPROC m_orig_glRasterPos2fv = nullptr;
+void m_glRasterPos2fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,742);(this->*(this->m_orig_glRasterPos2fv))(v);}
+FunctionTable::MEMBERPFNGLVERTEX3XOESPROC m_orig_glVertex3xOES = nullptr;
+void m_glVertex3xOES_profile(GLfixed x,GLfixed y)const{ProfilingScope const scope(this,743);(this->*(this->m_orig_glVertex3xOES))(x,y);}
+FunctionTable::MEMBERPFNGLISMEMORYOBJECTEXTPROC m_orig_glIsMemoryObjectEXT = nullptr;
+GLboolean m_glIsMemoryObjectEXT_profile(GLuint memoryObject)const{ProfilingScope const scope(this,744);return (this->*(this->m_orig_glIsMemoryObjectEXT))(memoryObject);}
+FunctionTable::MEMBERPFNGLWEIGHTPOINTERARBPROC m_orig_glWeightPointerARB = nullptr;
+void m_glWeightPointerARB_profile(GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,745);(this->*(this->m_orig_glWeightPointerARB))(size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLFINISHFENCENVPROC m_orig_glFinishFenceNV = nullptr;
+void m_glFinishFenceNV_profile(GLuint fence)const{ProfilingScope const scope(this,746);(this->*(this->m_orig_glFinishFenceNV))(fence);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEXOESPROC m_orig_glDepthRangexOES = nullptr;
+void m_glDepthRangexOES_profile(GLfixed n,GLfixed f)const{ProfilingScope const scope(this,747);(this->*(this->m_orig_glDepthRangexOES))(n,f);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBEXTPROC m_orig_glEnableVertexArrayAttribEXT = nullptr;
+void m_glEnableVertexArrayAttribEXT_profile(GLuint vaobj,GLuint index)const{ProfilingScope const scope(this,748);(this->*(this->m_orig_glEnableVertexArrayAttribEXT))(vaobj,index);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVEXTPROC m_orig_glProgramUniform2uivEXT = nullptr;
+void m_glProgramUniform2uivEXT_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,749);(this->*(this->m_orig_glProgramUniform2uivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETDOUBLEINDEXEDVEXTPROC m_orig_glGetDoubleIndexedvEXT = nullptr;
+void m_glGetDoubleIndexedvEXT_profile(GLenum target,GLuint index,GLdouble* data)const{ProfilingScope const scope(this,750);(this->*(this->m_orig_glGetDoubleIndexedvEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FMESAPROC m_orig_glWindowPos2fMESA = nullptr;
+void m_glWindowPos2fMESA_profile(GLfloat x,GLfloat y)const{ProfilingScope const scope(this,751);(this->*(this->m_orig_glWindowPos2fMESA))(x,y);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BPROC m_orig_glSecondaryColor3b = nullptr;
+void m_glSecondaryColor3b_profile(GLbyte red,GLbyte green,GLbyte blue)const{ProfilingScope const scope(this,752);(this->*(this->m_orig_glSecondaryColor3b))(red,green,blue);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DEXTPROC m_orig_glCopyConvolutionFilter1DEXT = nullptr;
+void m_glCopyConvolutionFilter1DEXT_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,753);(this->*(this->m_orig_glCopyConvolutionFilter1DEXT))(target,internalformat,x,y,width);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVPROC m_orig_glWindowPos2sv = nullptr;
+void m_glWindowPos2sv_profile(const GLshort* v)const{ProfilingScope const scope(this,754);(this->*(this->m_orig_glWindowPos2sv))(v);}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFEREXTPROC m_orig_glBindFramebufferEXT = nullptr;
+void m_glBindFramebufferEXT_profile(GLenum target,GLuint framebuffer)const{ProfilingScope const scope(this,755);(this->*(this->m_orig_glBindFramebufferEXT))(target,framebuffer);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROC m_orig_glCreateShader = nullptr;
+GLuint m_glCreateShader_profile(GLenum type)const{ProfilingScope const scope(this,756);return (this->*(this->m_orig_glCreateShader))(type);}
+FunctionTable::MEMBERPFNGLGENPATHSNVPROC m_orig_glGenPathsNV = nullptr;
+GLuint m_glGenPathsNV_profile(GLsizei range)const{ProfilingScope const scope(this,757);return (this->*(this->m_orig_glGenPathsNV))(range);}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSPROC m_orig_glGenRenderbuffers = nullptr;
+void m_glGenRenderbuffers_profile(GLsizei n,GLuint* renderbuffers)const{ProfilingScope const scope(this,758);(this->*(this->m_orig_glGenRenderbuffers))(n,renderbuffers);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DPROC m_orig_glCopyTexSubImage2D = nullptr;
+void m_glCopyTexSubImage2D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,759);(this->*(this->m_orig_glCopyTexSubImage2D))(target,level,xoffset,yoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVARBPROC m_orig_glVertexAttrib4ubvARB = nullptr;
+void m_glVertexAttrib4ubvARB_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,760);(this->*(this->m_orig_glVertexAttrib4ubvARB))(index,v);}
+FunctionTable::MEMBERPFNGLDRAWTEXTURENVPROC m_orig_glDrawTextureNV = nullptr;
+void m_glDrawTextureNV_profile(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{ProfilingScope const scope(this,761);(this->*(this->m_orig_glDrawTextureNV))(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1SVNVPROC m_orig_glVertexAttribs1svNV = nullptr;
+void m_glVertexAttribs1svNV_profile(GLuint index,GLsizei count,const GLshort* v)const{ProfilingScope const scope(this,762);(this->*(this->m_orig_glVertexAttribs1svNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC m_orig_glClearNamedBufferSubDataEXT = nullptr;
+void m_glClearNamedBufferSubDataEXT_profile(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,763);(this->*(this->m_orig_glClearNamedBufferSubDataEXT))(buffer,internalformat,offset,size,format,type,data);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEPROC m_orig_glBlendFuncSeparate = nullptr;
+void m_glBlendFuncSeparate_profile(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{ProfilingScope const scope(this,764);(this->*(this->m_orig_glBlendFuncSeparate))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFARBPROC m_orig_glPointParameterfARB = nullptr;
+void m_glPointParameterfARB_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,765);(this->*(this->m_orig_glPointParameterfARB))(pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVPROC m_orig_glTexCoord2fv = nullptr;
+void m_glTexCoord2fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,766);(this->*(this->m_orig_glTexCoord2fv))(v);}
+FunctionTable::MEMBERPFNGLGETVARIANTFLOATVEXTPROC m_orig_glGetVariantFloatvEXT = nullptr;
+void m_glGetVariantFloatvEXT_profile(GLuint id,GLenum value,GLfloat* data)const{ProfilingScope const scope(this,767);(this->*(this->m_orig_glGetVariantFloatvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLVERTEXP2UIPROC m_orig_glVertexP2ui = nullptr;
+void m_glVertexP2ui_profile(GLenum type,GLuint value)const{ProfilingScope const scope(this,768);(this->*(this->m_orig_glVertexP2ui))(type,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DMESAPROC m_orig_glWindowPos2dMESA = nullptr;
+void m_glWindowPos2dMESA_profile(GLdouble x,GLdouble y)const{ProfilingScope const scope(this,769);(this->*(this->m_orig_glWindowPos2dMESA))(x,y);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVPROC m_orig_glTexCoord4fv = nullptr;
+void m_glTexCoord4fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,770);(this->*(this->m_orig_glTexCoord4fv))(v);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONEXTPROC m_orig_glBindFragDataLocationEXT = nullptr;
+void m_glBindFragDataLocationEXT_profile(GLuint program,GLuint color,const GLchar* name)const{ProfilingScope const scope(this,771);(this->*(this->m_orig_glBindFragDataLocationEXT))(program,color,name);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC m_orig_glCompressedTexSubImage1DARB = nullptr;
+void m_glCompressedTexSubImage1DARB_profile(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,772);(this->*(this->m_orig_glCompressedTexSubImage1DARB))(target,level,xoffset,width,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEEXTPROC m_orig_glGetTextureImageEXT = nullptr;
+void m_glGetTextureImageEXT_profile(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels)const{ProfilingScope const scope(this,773);(this->*(this->m_orig_glGetTextureImageEXT))(texture,target,level,format,type,pixels);}
+FunctionTable::MEMBERPFNGLFOGCOORDDPROC m_orig_glFogCoordd = nullptr;
+void m_glFogCoordd_profile(GLdouble coord)const{ProfilingScope const scope(this,774);(this->*(this->m_orig_glFogCoordd))(coord);}
+FunctionTable::MEMBERPFNGLPOINTSIZEPROC m_orig_glPointSize = nullptr;
+void m_glPointSize_profile(GLfloat size)const{ProfilingScope const scope(this,775);(this->*(this->m_orig_glPointSize))(size);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREUNITPROC m_orig_glBindTextureUnit = nullptr;
+void m_glBindTextureUnit_profile(GLuint unit,GLuint texture)const{ProfilingScope const scope(this,776);(this->*(this->m_orig_glBindTextureUnit))(unit,texture);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UINVPROC m_orig_glProgramEnvParameterI4uiNV = nullptr;
+void m_glProgramEnvParameterI4uiNV_profile(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{ProfilingScope const scope(this,777);(this->*(this->m_orig_glProgramEnvParameterI4uiNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPIPELINEINFOLOGPROC m_orig_glGetProgramPipelineInfoLog = nullptr;
+void m_glGetProgramPipelineInfoLog_profile(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{ProfilingScope const scope(this,778);(this->*(this->m_orig_glGetProgramPipelineInfoLog))(pipeline,bufSize,length,infoLog);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VARBPROC m_orig_glProgramUniform4i64vARB = nullptr;
+void m_glProgramUniform4i64vARB_profile(GLuint program,GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,779);(this->*(this->m_orig_glProgramUniform4i64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVPROC m_orig_glVertexAttrib4Nuiv = nullptr;
+void m_glVertexAttrib4Nuiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,780);(this->*(this->m_orig_glVertexAttrib4Nuiv))(index,v);}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVARBPROC m_orig_glGetUniformfvARB = nullptr;
+void m_glGetUniformfvARB_profile(GLhandleARB programObj,GLint location,GLfloat* params)const{ProfilingScope const scope(this,781);(this->*(this->m_orig_glGetUniformfvARB))(programObj,location,params);}
+FunctionTable::MEMBERPFNGLWAITSYNCPROC m_orig_glWaitSync = nullptr;
+void m_glWaitSync_profile(GLsync sync,GLbitfield flags,GLuint64 timeout)const{ProfilingScope const scope(this,782);(this->*(this->m_orig_glWaitSync))(sync,flags,timeout);}
+FunctionTable::MEMBERPFNGLUNIFORM3IPROC m_orig_glUniform3i = nullptr;
+void m_glUniform3i_profile(GLint location,GLint v0,GLint v1,GLint v2)const{ProfilingScope const scope(this,783);(this->*(this->m_orig_glUniform3i))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIPROC m_orig_glBlendEquationSeparatei = nullptr;
+void m_glBlendEquationSeparatei_profile(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{ProfilingScope const scope(this,784);(this->*(this->m_orig_glBlendEquationSeparatei))(buf,modeRGB,modeAlpha);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HVNVPROC m_orig_glVertexAttrib2hvNV = nullptr;
+void m_glVertexAttrib2hvNV_profile(GLuint index,const GLhalfNV* v)const{ProfilingScope const scope(this,785);(this->*(this->m_orig_glVertexAttrib2hvNV))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVEXTPROC m_orig_glTextureParameterivEXT = nullptr;
+void m_glTextureParameterivEXT_profile(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,786);(this->*(this->m_orig_glTextureParameterivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM3DPROC m_orig_glUniform3d = nullptr;
+void m_glUniform3d_profile(GLint location,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,787);(this->*(this->m_orig_glUniform3d))(location,x,y,z);}
+FunctionTable::MEMBERPFNGLUNIFORM3FPROC m_orig_glUniform3f = nullptr;
+void m_glUniform3f_profile(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{ProfilingScope const scope(this,788);(this->*(this->m_orig_glUniform3f))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLACTIVEPROGRAMEXTPROC m_orig_glActiveProgramEXT = nullptr;
+void m_glActiveProgramEXT_profile(GLuint program)const{ProfilingScope const scope(this,789);(this->*(this->m_orig_glActiveProgramEXT))(program);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVPROC m_orig_glProgramUniform3uiv = nullptr;
+void m_glProgramUniform3uiv_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,790);(this->*(this->m_orig_glProgramUniform3uiv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VARBPROC m_orig_glUniform3ui64vARB = nullptr;
+void m_glUniform3ui64vARB_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,791);(this->*(this->m_orig_glUniform3ui64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VARBPROC m_orig_glProgramUniform1ui64vARB = nullptr;
+void m_glProgramUniform1ui64vARB_profile(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,792);(this->*(this->m_orig_glProgramUniform1ui64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFEXTPROC m_orig_glTextureParameterfEXT = nullptr;
+void m_glTextureParameterfEXT_profile(GLuint texture,GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,793);(this->*(this->m_orig_glTextureParameterfEXT))(texture,target,pname,param);}
+FunctionTable::MEMBERPFNGLSETFRAGMENTSHADERCONSTANTATIPROC m_orig_glSetFragmentShaderConstantATI = nullptr;
+void m_glSetFragmentShaderConstantATI_profile(GLuint dst,const GLfloat* value)const{ProfilingScope const scope(this,794);(this->*(this->m_orig_glSetFragmentShaderConstantATI))(dst,value);}
+FunctionTable::MEMBERPFNGLCOLORSUBTABLEPROC m_orig_glColorSubTable = nullptr;
+void m_glColorSubTable_profile(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data)const{ProfilingScope const scope(this,795);(this->*(this->m_orig_glColorSubTable))(target,start,count,format,type,data);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUISUNPROC m_orig_glReplacementCodeuiSUN = nullptr;
+void m_glReplacementCodeuiSUN_profile(GLuint code)const{ProfilingScope const scope(this,796);(this->*(this->m_orig_glReplacementCodeuiSUN))(code);}
+FunctionTable::MEMBERPFNGLSTATECAPTURENVPROC m_orig_glStateCaptureNV = nullptr;
+void m_glStateCaptureNV_profile(GLuint state,GLenum mode)const{ProfilingScope const scope(this,797);(this->*(this->m_orig_glStateCaptureNV))(state,mode);}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONPROC m_orig_glBindAttribLocation = nullptr;
+void m_glBindAttribLocation_profile(GLuint program,GLuint index,const GLchar* name)const{ProfilingScope const scope(this,798);(this->*(this->m_orig_glBindAttribLocation))(program,index,name);}
+FunctionTable::MEMBERPFNGLWEIGHTUSVARBPROC m_orig_glWeightusvARB = nullptr;
+void m_glWeightusvARB_profile(GLint size,const GLushort* weights)const{ProfilingScope const scope(this,799);(this->*(this->m_orig_glWeightusvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLGETFRAGDATAINDEXPROC m_orig_glGetFragDataIndex = nullptr;
+GLint m_glGetFragDataIndex_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,800);return (this->*(this->m_orig_glGetFragDataIndex))(program,name);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XOESPROC m_orig_glMultiTexCoord2xOES = nullptr;
+void m_glMultiTexCoord2xOES_profile(GLenum texture,GLfixed s,GLfixed t)const{ProfilingScope const scope(this,801);(this->*(this->m_orig_glMultiTexCoord2xOES))(texture,s,t);}
+FunctionTable::MEMBERPFNGLCOLOR3SVPROC m_orig_glColor3sv = nullptr;
+void m_glColor3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,802);(this->*(this->m_orig_glColor3sv))(v);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FVERTEX3FSUNPROC m_orig_glTexCoord2fVertex3fSUN = nullptr;
+void m_glTexCoord2fVertex3fSUN_profile(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,803);(this->*(this->m_orig_glTexCoord2fVertex3fSUN))(s,t,x,y,z);}
+FunctionTable::MEMBERPFNGLGETMEMORYOBJECTPARAMETERIVEXTPROC m_orig_glGetMemoryObjectParameterivEXT = nullptr;
+void m_glGetMemoryObjectParameterivEXT_profile(GLuint memoryObject,GLenum pname,GLint* params)const{ProfilingScope const scope(this,804);(this->*(this->m_orig_glGetMemoryObjectParameterivEXT))(memoryObject,pname,params);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETEXTPROC m_orig_glPolygonOffsetEXT = nullptr;
+void m_glPolygonOffsetEXT_profile(GLfloat factor,GLfloat bias)const{ProfilingScope const scope(this,805);(this->*(this->m_orig_glPolygonOffsetEXT))(factor,bias);}
+FunctionTable::MEMBERPFNGLWEIGHTPATHSNVPROC m_orig_glWeightPathsNV = nullptr;
+void m_glWeightPathsNV_profile(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights)const{ProfilingScope const scope(this,806);(this->*(this->m_orig_glWeightPathsNV))(resultPath,numPaths,paths,weights);}
+FunctionTable::MEMBERPFNGLCOMBINERSTAGEPARAMETERFVNVPROC m_orig_glCombinerStageParameterfvNV = nullptr;
+void m_glCombinerStageParameterfvNV_profile(GLenum stage,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,807);(this->*(this->m_orig_glCombinerStageParameterfvNV))(stage,pname,params);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFEXTPROC m_orig_glPointParameterfEXT = nullptr;
+void m_glPointParameterfEXT_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,808);(this->*(this->m_orig_glPointParameterfEXT))(pname,param);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE1DEXTPROC m_orig_glCopyTexImage1DEXT = nullptr;
+void m_glCopyTexImage1DEXT_profile(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{ProfilingScope const scope(this,809);(this->*(this->m_orig_glCopyTexImage1DEXT))(target,level,internalformat,x,y,width,border);}
+FunctionTable::MEMBERPFNGLVERTEX4SVPROC m_orig_glVertex4sv = nullptr;
+void m_glVertex4sv_profile(const GLshort* v)const{ProfilingScope const scope(this,810);(this->*(this->m_orig_glVertex4sv))(v);}
+FunctionTable::MEMBERPFNGLMATRIXMULTFEXTPROC m_orig_glMatrixMultfEXT = nullptr;
+void m_glMatrixMultfEXT_profile(GLenum mode,const GLfloat* m)const{ProfilingScope const scope(this,811);(this->*(this->m_orig_glMatrixMultfEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC m_orig_glCompressedTextureSubImage3DEXT = nullptr;
+void m_glCompressedTextureSubImage3DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,812);(this->*(this->m_orig_glCompressedTextureSubImage3DEXT))(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERXVOESPROC m_orig_glGetTexLevelParameterxvOES = nullptr;
+void m_glGetTexLevelParameterxvOES_profile(GLenum target,GLint level,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,813);(this->*(this->m_orig_glGetTexLevelParameterxvOES))(target,level,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DVEXTPROC m_orig_glVertexAttribL3dvEXT = nullptr;
+void m_glVertexAttribL3dvEXT_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,814);(this->*(this->m_orig_glVertexAttribL3dvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIPROC m_orig_glMultiTexCoordP4ui = nullptr;
+void m_glMultiTexCoordP4ui_profile(GLenum texture,GLenum type,GLuint coords)const{ProfilingScope const scope(this,815);(this->*(this->m_orig_glMultiTexCoordP4ui))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERIVEXTPROC m_orig_glGetTextureLevelParameterivEXT = nullptr;
+void m_glGetTextureLevelParameterivEXT_profile(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params)const{ProfilingScope const scope(this,816);(this->*(this->m_orig_glGetTextureLevelParameterivEXT))(texture,target,level,pname,params);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP2ATIPROC m_orig_glAlphaFragmentOp2ATI = nullptr;
+void m_glAlphaFragmentOp2ATI_profile(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{ProfilingScope const scope(this,817);(this->*(this->m_orig_glAlphaFragmentOp2ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSPROC m_orig_glDeleteFramebuffers = nullptr;
+void m_glDeleteFramebuffers_profile(GLsizei n,const GLuint* framebuffers)const{ProfilingScope const scope(this,818);(this->*(this->m_orig_glDeleteFramebuffers))(n,framebuffers);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSPROC m_orig_glDrawArrays = nullptr;
+void m_glDrawArrays_profile(GLenum mode,GLint first,GLsizei count)const{ProfilingScope const scope(this,819);(this->*(this->m_orig_glDrawArrays))(mode,first,count);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKIVPROC m_orig_glGetTransformFeedbackiv = nullptr;
+void m_glGetTransformFeedbackiv_profile(GLuint xfb,GLenum pname,GLint* param)const{ProfilingScope const scope(this,820);(this->*(this->m_orig_glGetTransformFeedbackiv))(xfb,pname,param);}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEARBPROC m_orig_glGetnTexImageARB = nullptr;
+void m_glGetnTexImageARB_profile(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img)const{ProfilingScope const scope(this,821);(this->*(this->m_orig_glGetnTexImageARB))(target,level,format,type,bufSize,img);}
+FunctionTable::MEMBERPFNGLCLEARPROC m_orig_glClear = nullptr;
+void m_glClear_profile(GLbitfield mask)const{ProfilingScope const scope(this,822);(this->*(this->m_orig_glClear))(mask);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYPARAMETERIAPPLEPROC m_orig_glVertexArrayParameteriAPPLE = nullptr;
+void m_glVertexArrayParameteriAPPLE_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,823);(this->*(this->m_orig_glVertexArrayParameteriAPPLE))(pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVARBPROC m_orig_glMultiTexCoord2dvARB = nullptr;
+void m_glMultiTexCoord2dvARB_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,824);(this->*(this->m_orig_glMultiTexCoord2dvARB))(target,v);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMDVNVPROC m_orig_glGetVideoCaptureStreamdvNV = nullptr;
+void m_glGetVideoCaptureStreamdvNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,825);(this->*(this->m_orig_glGetVideoCaptureStreamdvNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELIVSGIXPROC m_orig_glFragmentLightModelivSGIX = nullptr;
+void m_glFragmentLightModelivSGIX_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,826);(this->*(this->m_orig_glFragmentLightModelivSGIX))(pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIPROC m_orig_glVertexAttribP2ui = nullptr;
+void m_glVertexAttribP2ui_profile(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{ProfilingScope const scope(this,827);(this->*(this->m_orig_glVertexAttribP2ui))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDPOINTEREXTPROC m_orig_glMultiTexCoordPointerEXT = nullptr;
+void m_glMultiTexCoordPointerEXT_profile(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,828);(this->*(this->m_orig_glMultiTexCoordPointerEXT))(texunit,size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IEXTPROC m_orig_glProgramUniform3iEXT = nullptr;
+void m_glProgramUniform3iEXT_profile(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{ProfilingScope const scope(this,829);(this->*(this->m_orig_glProgramUniform3iEXT))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLTRANSLATEFPROC m_orig_glTranslatef = nullptr;
+void m_glTranslatef_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,830);(this->*(this->m_orig_glTranslatef))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBPROC m_orig_glVertexAttrib4Nub = nullptr;
+void m_glVertexAttrib4Nub_profile(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{ProfilingScope const scope(this,831);(this->*(this->m_orig_glVertexAttrib4Nub))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLTRANSLATEDPROC m_orig_glTranslated = nullptr;
+void m_glTranslated_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,832);(this->*(this->m_orig_glTranslated))(x,y,z);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIIVPROC m_orig_glSamplerParameterIiv = nullptr;
+void m_glSamplerParameterIiv_profile(GLuint sampler,GLenum pname,const GLint* param)const{ProfilingScope const scope(this,833);(this->*(this->m_orig_glSamplerParameterIiv))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD4HNVPROC m_orig_glTexCoord4hNV = nullptr;
+void m_glTexCoord4hNV_profile(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{ProfilingScope const scope(this,834);(this->*(this->m_orig_glTexCoord4hNV))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINDIRECTPROC m_orig_glDrawElementsIndirect = nullptr;
+void m_glDrawElementsIndirect_profile(GLenum mode,GLenum type,const void* indirect)const{ProfilingScope const scope(this,835);(this->*(this->m_orig_glDrawElementsIndirect))(mode,type,indirect);}
+FunctionTable::MEMBERPFNGLDELETEPERFMONITORSAMDPROC m_orig_glDeletePerfMonitorsAMD = nullptr;
+void m_glDeletePerfMonitorsAMD_profile(GLsizei n,GLuint* monitors)const{ProfilingScope const scope(this,836);(this->*(this->m_orig_glDeletePerfMonitorsAMD))(n,monitors);}
+FunctionTable::MEMBERPFNGLISRENDERBUFFEREXTPROC m_orig_glIsRenderbufferEXT = nullptr;
+GLboolean m_glIsRenderbufferEXT_profile(GLuint renderbuffer)const{ProfilingScope const scope(this,837);return (this->*(this->m_orig_glIsRenderbufferEXT))(renderbuffer);}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSNVPROC m_orig_glDrawCommandsNV = nullptr;
+void m_glDrawCommandsNV_profile(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count)const{ProfilingScope const scope(this,838);(this->*(this->m_orig_glDrawCommandsNV))(primitiveMode,buffer,indirects,sizes,count);}
+FunctionTable::MEMBERPFNGLUNIFORM3IVARBPROC m_orig_glUniform3ivARB = nullptr;
+void m_glUniform3ivARB_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,839);(this->*(this->m_orig_glUniform3ivARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAPROC m_orig_glBufferSubData = nullptr;
+void m_glBufferSubData_profile(GLenum target,GLintptr offset,GLsizeiptr size,const void* data)const{ProfilingScope const scope(this,840);(this->*(this->m_orig_glBufferSubData))(target,offset,size,data);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVPROC m_orig_glSecondaryColor3bv = nullptr;
+void m_glSecondaryColor3bv_profile(const GLbyte* v)const{ProfilingScope const scope(this,841);(this->*(this->m_orig_glSecondaryColor3bv))(v);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEDEXTPROC m_orig_glMatrixMultTransposedEXT = nullptr;
+void m_glMatrixMultTransposedEXT_profile(GLenum mode,const GLdouble* m)const{ProfilingScope const scope(this,842);(this->*(this->m_orig_glMatrixMultTransposedEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLREQUESTRESIDENTPROGRAMSNVPROC m_orig_glRequestResidentProgramsNV = nullptr;
+void m_glRequestResidentProgramsNV_profile(GLsizei n,const GLuint* programs)const{ProfilingScope const scope(this,843);(this->*(this->m_orig_glRequestResidentProgramsNV))(n,programs);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP1ATIPROC m_orig_glAlphaFragmentOp1ATI = nullptr;
+void m_glAlphaFragmentOp1ATI_profile(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod)const{ProfilingScope const scope(this,844);(this->*(this->m_orig_glAlphaFragmentOp1ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTI64VPROC m_orig_glGetQueryObjecti64v = nullptr;
+void m_glGetQueryObjecti64v_profile(GLuint id,GLenum pname,GLint64* params)const{ProfilingScope const scope(this,845);(this->*(this->m_orig_glGetQueryObjecti64v))(id,pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X3FNVPROC m_orig_glMatrixMult3x3fNV = nullptr;
+void m_glMatrixMult3x3fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,846);(this->*(this->m_orig_glMatrixMult3x3fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERIVPROC m_orig_glColorTableParameteriv = nullptr;
+void m_glColorTableParameteriv_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,847);(this->*(this->m_orig_glColorTableParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPATHSUBCOMMANDSNVPROC m_orig_glPathSubCommandsNV = nullptr;
+void m_glPathSubCommandsNV_profile(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords)const{ProfilingScope const scope(this,848);(this->*(this->m_orig_glPathSubCommandsNV))(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC m_orig_glGetFinalCombinerInputParameterivNV = nullptr;
+void m_glGetFinalCombinerInputParameterivNV_profile(GLenum variable,GLenum pname,GLint* params)const{ProfilingScope const scope(this,849);(this->*(this->m_orig_glGetFinalCombinerInputParameterivNV))(variable,pname,params);}
+FunctionTable::MEMBERPFNGLISRENDERBUFFERPROC m_orig_glIsRenderbuffer = nullptr;
+GLboolean m_glIsRenderbuffer_profile(GLuint renderbuffer)const{ProfilingScope const scope(this,850);return (this->*(this->m_orig_glIsRenderbuffer))(renderbuffer);}
+FunctionTable::MEMBERPFNGLVERTEX3IVPROC m_orig_glVertex3iv = nullptr;
+void m_glVertex3iv_profile(const GLint* v)const{ProfilingScope const scope(this,851);(this->*(this->m_orig_glVertex3iv))(v);}
+FunctionTable::MEMBERPFNGLTEXGENFVPROC m_orig_glTexGenfv = nullptr;
+void m_glTexGenfv_profile(GLenum coord,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,852);(this->*(this->m_orig_glTexGenfv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLFRUSTUMFOESPROC m_orig_glFrustumfOES = nullptr;
+void m_glFrustumfOES_profile(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f)const{ProfilingScope const scope(this,853);(this->*(this->m_orig_glFrustumfOES))(l,r,b,t,n,f);}
+FunctionTable::MEMBERPFNGLBINDVERTEXBUFFERSPROC m_orig_glBindVertexBuffers = nullptr;
+void m_glBindVertexBuffers_profile(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides)const{ProfilingScope const scope(this,854);(this->*(this->m_orig_glBindVertexBuffers))(first,count,buffers,offsets,strides);}
+FunctionTable::MEMBERPFNGLMATERIALIPROC m_orig_glMateriali = nullptr;
+void m_glMateriali_profile(GLenum face,GLenum pname,GLint param)const{ProfilingScope const scope(this,855);(this->*(this->m_orig_glMateriali))(face,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVARBPROC m_orig_glMultiTexCoord2svARB = nullptr;
+void m_glMultiTexCoord2svARB_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,856);(this->*(this->m_orig_glMultiTexCoord2svARB))(target,v);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYPROC m_orig_glDisableVertexAttribArray = nullptr;
+void m_glDisableVertexAttribArray_profile(GLuint index)const{ProfilingScope const scope(this,857);(this->*(this->m_orig_glDisableVertexAttribArray))(index);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVARBPROC m_orig_glWindowPos3ivARB = nullptr;
+void m_glWindowPos3ivARB_profile(const GLint* v)const{ProfilingScope const scope(this,858);(this->*(this->m_orig_glWindowPos3ivARB))(v);}
+FunctionTable::MEMBERPFNGLTEXCOORDFORMATNVPROC m_orig_glTexCoordFormatNV = nullptr;
+void m_glTexCoordFormatNV_profile(GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,859);(this->*(this->m_orig_glTexCoordFormatNV))(size,type,stride);}
+FunctionTable::MEMBERPFNGLBLITNAMEDFRAMEBUFFERPROC m_orig_glBlitNamedFramebuffer = nullptr;
+void m_glBlitNamedFramebuffer_profile(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{ProfilingScope const scope(this,860);(this->*(this->m_orig_glBlitNamedFramebuffer))(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEFEXTPROC m_orig_glMatrixLoadTransposefEXT = nullptr;
+void m_glMatrixLoadTransposefEXT_profile(GLenum mode,const GLfloat* m)const{ProfilingScope const scope(this,861);(this->*(this->m_orig_glMatrixLoadTransposefEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLMULTITEXGENFEXTPROC m_orig_glMultiTexGenfEXT = nullptr;
+void m_glMultiTexGenfEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,862);(this->*(this->m_orig_glMultiTexGenfEXT))(texunit,coord,pname,param);}
+FunctionTable::MEMBERPFNGLSHADERSTORAGEBLOCKBINDINGPROC m_orig_glShaderStorageBlockBinding = nullptr;
+void m_glShaderStorageBlockBinding_profile(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding)const{ProfilingScope const scope(this,863);(this->*(this->m_orig_glShaderStorageBlockBinding))(program,storageBlockIndex,storageBlockBinding);}
+FunctionTable::MEMBERPFNGLMATERIALFPROC m_orig_glMaterialf = nullptr;
+void m_glMaterialf_profile(GLenum face,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,864);(this->*(this->m_orig_glMaterialf))(face,pname,param);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fSUN_profile(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,865);(this->*(this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fSUN))(rc,r,g,b,a,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC m_orig_glCheckNamedFramebufferStatusEXT = nullptr;
+GLenum m_glCheckNamedFramebufferStatusEXT_profile(GLuint framebuffer,GLenum target)const{ProfilingScope const scope(this,866);return (this->*(this->m_orig_glCheckNamedFramebufferStatusEXT))(framebuffer,target);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC m_orig_glVertexArrayVertexAttribFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribFormatEXT_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{ProfilingScope const scope(this,867);(this->*(this->m_orig_glVertexArrayVertexAttribFormatEXT))(vaobj,attribindex,size,type,normalized,relativeoffset);}
+FunctionTable::MEMBERPFNGLVERTEX2HNVPROC m_orig_glVertex2hNV = nullptr;
+void m_glVertex2hNV_profile(GLhalfNV x,GLhalfNV y)const{ProfilingScope const scope(this,868);(this->*(this->m_orig_glVertex2hNV))(x,y);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXSHADEREXTPROC m_orig_glDeleteVertexShaderEXT = nullptr;
+void m_glDeleteVertexShaderEXT_profile(GLuint id)const{ProfilingScope const scope(this,869);(this->*(this->m_orig_glDeleteVertexShaderEXT))(id);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DEXTPROC m_orig_glTexImage3DEXT = nullptr;
+void m_glTexImage3DEXT_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,870);(this->*(this->m_orig_glTexImage3DEXT))(target,level,internalformat,width,height,depth,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLSIGNALVKFENCENVPROC m_orig_glSignalVkFenceNV = nullptr;
+void m_glSignalVkFenceNV_profile(GLuint64 vkFence)const{ProfilingScope const scope(this,871);(this->*(this->m_orig_glSignalVkFenceNV))(vkFence);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4IVNVPROC m_orig_glProgramLocalParameterI4ivNV = nullptr;
+void m_glProgramLocalParameterI4ivNV_profile(GLenum target,GLuint index,const GLint* params)const{ProfilingScope const scope(this,872);(this->*(this->m_orig_glProgramLocalParameterI4ivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORISUNPROC m_orig_glGlobalAlphaFactoriSUN = nullptr;
+void m_glGlobalAlphaFactoriSUN_profile(GLint factor)const{ProfilingScope const scope(this,873);(this->*(this->m_orig_glGlobalAlphaFactoriSUN))(factor);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DPROC m_orig_glTextureStorage1D = nullptr;
+void m_glTextureStorage1D_profile(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width)const{ProfilingScope const scope(this,874);(this->*(this->m_orig_glTextureStorage1D))(texture,levels,internalformat,width);}
+FunctionTable::MEMBERPFNGLBINORMAL3SEXTPROC m_orig_glBinormal3sEXT = nullptr;
+void m_glBinormal3sEXT_profile(GLshort bx,GLshort by,GLshort bz)const{ProfilingScope const scope(this,875);(this->*(this->m_orig_glBinormal3sEXT))(bx,by,bz);}
+FunctionTable::MEMBERPFNGLGETPROGRAMINTERFACEIVPROC m_orig_glGetProgramInterfaceiv = nullptr;
+void m_glGetProgramInterfaceiv_profile(GLuint program,GLenum programInterface,GLenum pname,GLint* params)const{ProfilingScope const scope(this,876);(this->*(this->m_orig_glGetProgramInterfaceiv))(program,programInterface,pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXPOINTERARBPROC m_orig_glMatrixIndexPointerARB = nullptr;
+void m_glMatrixIndexPointerARB_profile(GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,877);(this->*(this->m_orig_glMatrixIndexPointerARB))(size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTEREXTPROC m_orig_glTexCoordPointerEXT = nullptr;
+void m_glTexCoordPointerEXT_profile(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{ProfilingScope const scope(this,878);(this->*(this->m_orig_glTexCoordPointerEXT))(size,type,stride,count,pointer);}
+FunctionTable::MEMBERPFNGLMULTITEXGENIEXTPROC m_orig_glMultiTexGeniEXT = nullptr;
+void m_glMultiTexGeniEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLint param)const{ProfilingScope const scope(this,879);(this->*(this->m_orig_glMultiTexGeniEXT))(texunit,coord,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FNVPROC m_orig_glVertexAttrib2fNV = nullptr;
+void m_glVertexAttrib2fNV_profile(GLuint index,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,880);(this->*(this->m_orig_glVertexAttrib2fNV))(index,x,y);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMSTRINGEXTPROC m_orig_glNamedProgramStringEXT = nullptr;
+void m_glNamedProgramStringEXT_profile(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string)const{ProfilingScope const scope(this,881);(this->*(this->m_orig_glNamedProgramStringEXT))(program,target,format,len,string);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERPROC m_orig_glMapNamedBuffer = nullptr;
+void* m_glMapNamedBuffer_profile(GLuint buffer,GLenum access)const{ProfilingScope const scope(this,882);return (this->*(this->m_orig_glMapNamedBuffer))(buffer,access);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVPROC m_orig_glGetMinmaxParameteriv = nullptr;
+void m_glGetMinmaxParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,883);(this->*(this->m_orig_glGetMinmaxParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMDVPROC m_orig_glGetnUniformdv = nullptr;
+void m_glGetnUniformdv_profile(GLuint program,GLint location,GLsizei bufSize,GLdouble* params)const{ProfilingScope const scope(this,884);(this->*(this->m_orig_glGetnUniformdv))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVXPROC m_orig_glEndConditionalRenderNVX = nullptr;
+void m_glEndConditionalRenderNVX_profile()const{ProfilingScope const scope(this,885);(this->*(this->m_orig_glEndConditionalRenderNVX))();}
+FunctionTable::MEMBERPFNGLBINORMAL3FEXTPROC m_orig_glBinormal3fEXT = nullptr;
+void m_glBinormal3fEXT_profile(GLfloat bx,GLfloat by,GLfloat bz)const{ProfilingScope const scope(this,886);(this->*(this->m_orig_glBinormal3fEXT))(bx,by,bz);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3IATIPROC m_orig_glNormalStream3iATI = nullptr;
+void m_glNormalStream3iATI_profile(GLenum stream,GLint nx,GLint ny,GLint nz)const{ProfilingScope const scope(this,887);(this->*(this->m_orig_glNormalStream3iATI))(stream,nx,ny,nz);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC m_orig_glProgramBufferParametersIivNV = nullptr;
+void m_glProgramBufferParametersIivNV_profile(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params)const{ProfilingScope const scope(this,888);(this->*(this->m_orig_glProgramBufferParametersIivNV))(target,bindingIndex,wordIndex,count,params);}
+FunctionTable::MEMBERPFNGLMAPGRID1XOESPROC m_orig_glMapGrid1xOES = nullptr;
+void m_glMapGrid1xOES_profile(GLint n,GLfixed u1,GLfixed u2)const{ProfilingScope const scope(this,889);(this->*(this->m_orig_glMapGrid1xOES))(n,u1,u2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVARBPROC m_orig_glGetVertexAttribPointervARB = nullptr;
+void m_glGetVertexAttribPointervARB_profile(GLuint index,GLenum pname,void** pointer)const{ProfilingScope const scope(this,890);(this->*(this->m_orig_glGetVertexAttribPointervARB))(index,pname,pointer);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC m_orig_glFlushMappedNamedBufferRangeEXT = nullptr;
+void m_glFlushMappedNamedBufferRangeEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr length)const{ProfilingScope const scope(this,891);(this->*(this->m_orig_glFlushMappedNamedBufferRangeEXT))(buffer,offset,length);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIIVPROC m_orig_glGetVertexAttribIiv = nullptr;
+void m_glGetVertexAttribIiv_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,892);(this->*(this->m_orig_glGetVertexAttribIiv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXP4UIVPROC m_orig_glVertexP4uiv = nullptr;
+void m_glVertexP4uiv_profile(GLenum type,const GLuint* value)const{ProfilingScope const scope(this,893);(this->*(this->m_orig_glVertexP4uiv))(type,value);}
+FunctionTable::MEMBERPFNGLUNIFORMUI64NVPROC m_orig_glUniformui64NV = nullptr;
+void m_glUniformui64NV_profile(GLint location,GLuint64EXT value)const{ProfilingScope const scope(this,894);(this->*(this->m_orig_glUniformui64NV))(location,value);}
+FunctionTable::MEMBERPFNGLCOLOR4FVPROC m_orig_glColor4fv = nullptr;
+void m_glColor4fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,895);(this->*(this->m_orig_glColor4fv))(v);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXVOESPROC m_orig_glTexParameterxvOES = nullptr;
+void m_glTexParameterxvOES_profile(GLenum target,GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,896);(this->*(this->m_orig_glTexParameterxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPATCHPARAMETERIPROC m_orig_glPatchParameteri = nullptr;
+void m_glPatchParameteri_profile(GLenum pname,GLint value)const{ProfilingScope const scope(this,897);(this->*(this->m_orig_glPatchParameteri))(pname,value);}
+FunctionTable::MEMBERPFNGLMAP1DPROC m_orig_glMap1d = nullptr;
+void m_glMap1d_profile(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{ProfilingScope const scope(this,898);(this->*(this->m_orig_glMap1d))(target,u1,u2,stride,order,points);}
+FunctionTable::MEMBERPFNGLGETTEXFILTERFUNCSGISPROC m_orig_glGetTexFilterFuncSGIS = nullptr;
+void m_glGetTexFilterFuncSGIS_profile(GLenum target,GLenum filter,GLfloat* weights)const{ProfilingScope const scope(this,899);(this->*(this->m_orig_glGetTexFilterFuncSGIS))(target,filter,weights);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DATIPROC m_orig_glVertexStream3dATI = nullptr;
+void m_glVertexStream3dATI_profile(GLenum stream,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,900);(this->*(this->m_orig_glVertexStream3dATI))(stream,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC m_orig_glVertexArrayVertexBindingDivisorEXT = nullptr;
+void m_glVertexArrayVertexBindingDivisorEXT_profile(GLuint vaobj,GLuint bindingindex,GLuint divisor)const{ProfilingScope const scope(this,901);(this->*(this->m_orig_glVertexArrayVertexBindingDivisorEXT))(vaobj,bindingindex,divisor);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVARBPROC m_orig_glMultiTexCoord3svARB = nullptr;
+void m_glMultiTexCoord3svARB_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,902);(this->*(this->m_orig_glMultiTexCoord3svARB))(target,v);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMNVPROC m_orig_glBindProgramNV = nullptr;
+void m_glBindProgramNV_profile(GLenum target,GLuint id)const{ProfilingScope const scope(this,903);(this->*(this->m_orig_glBindProgramNV))(target,id);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVPROC m_orig_glGetConvolutionParameteriv = nullptr;
+void m_glGetConvolutionParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,904);(this->*(this->m_orig_glGetConvolutionParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERFVARBPROC m_orig_glGetProgramLocalParameterfvARB = nullptr;
+void m_glGetProgramLocalParameterfvARB_profile(GLenum target,GLuint index,GLfloat* params)const{ProfilingScope const scope(this,905);(this->*(this->m_orig_glGetProgramLocalParameterfvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLGENFRAGMENTSHADERSATIPROC m_orig_glGenFragmentShadersATI = nullptr;
+GLuint m_glGenFragmentShadersATI_profile(GLuint range)const{ProfilingScope const scope(this,906);return (this->*(this->m_orig_glGenFragmentShadersATI))(range);}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERIVATIPROC m_orig_glTexBumpParameterivATI = nullptr;
+void m_glTexBumpParameterivATI_profile(GLenum pname,const GLint* param)const{ProfilingScope const scope(this,907);(this->*(this->m_orig_glTexBumpParameterivATI))(pname,param);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC m_orig_glGetNamedFramebufferAttachmentParameteriv = nullptr;
+void m_glGetNamedFramebufferAttachmentParameteriv_profile(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{ProfilingScope const scope(this,908);(this->*(this->m_orig_glGetNamedFramebufferAttachmentParameteriv))(framebuffer,attachment,pname,params);}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERPROC m_orig_glGetnSeparableFilter = nullptr;
+void m_glGetnSeparableFilter_profile(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{ProfilingScope const scope(this,909);(this->*(this->m_orig_glGetnSeparableFilter))(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+FunctionTable::MEMBERPFNGLNORMAL3XVOESPROC m_orig_glNormal3xvOES = nullptr;
+void m_glNormal3xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,910);(this->*(this->m_orig_glNormal3xvOES))(coords);}
+FunctionTable::MEMBERPFNGLPASSTEXCOORDATIPROC m_orig_glPassTexCoordATI = nullptr;
+void m_glPassTexCoordATI_profile(GLuint dst,GLuint coord,GLenum swizzle)const{ProfilingScope const scope(this,911);(this->*(this->m_orig_glPassTexCoordATI))(dst,coord,swizzle);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEARBPROC m_orig_glFramebufferTextureFaceARB = nullptr;
+void m_glFramebufferTextureFaceARB_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{ProfilingScope const scope(this,912);(this->*(this->m_orig_glFramebufferTextureFaceARB))(target,attachment,texture,level,face);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DVPROC m_orig_glProgramUniform1dv = nullptr;
+void m_glProgramUniform1dv_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,913);(this->*(this->m_orig_glProgramUniform1dv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DEXTPROC m_orig_glTextureStorage2DEXT = nullptr;
+void m_glTextureStorage2DEXT_profile(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,914);(this->*(this->m_orig_glTextureStorage2DEXT))(texture,target,levels,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC m_orig_glVertexArrayFogCoordOffsetEXT = nullptr;
+void m_glVertexArrayFogCoordOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,915);(this->*(this->m_orig_glVertexArrayFogCoordOffsetEXT))(vaobj,buffer,type,stride,offset);}
+FunctionTable::MEMBERPFNGLDELETENAMEDSTRINGARBPROC m_orig_glDeleteNamedStringARB = nullptr;
+void m_glDeleteNamedStringARB_profile(GLint namelen,const GLchar* name)const{ProfilingScope const scope(this,916);(this->*(this->m_orig_glDeleteNamedStringARB))(namelen,name);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTI64VNVPROC m_orig_glMulticastGetQueryObjecti64vNV = nullptr;
+void m_glMulticastGetQueryObjecti64vNV_profile(GLuint gpu,GLuint id,GLenum pname,GLint64* params)const{ProfilingScope const scope(this,917);(this->*(this->m_orig_glMulticastGetQueryObjecti64vNV))(gpu,id,pname,params);}
+FunctionTable::MEMBERPFNGLGENOCCLUSIONQUERIESNVPROC m_orig_glGenOcclusionQueriesNV = nullptr;
+void m_glGenOcclusionQueriesNV_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,918);(this->*(this->m_orig_glGenOcclusionQueriesNV))(n,ids);}
+FunctionTable::MEMBERPFNGLLIGHTIPROC m_orig_glLighti = nullptr;
+void m_glLighti_profile(GLenum light,GLenum pname,GLint param)const{ProfilingScope const scope(this,919);(this->*(this->m_orig_glLighti))(light,pname,param);}
+FunctionTable::MEMBERPFNGLTEXIMAGE1DPROC m_orig_glTexImage1D = nullptr;
+void m_glTexImage1D_profile(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,920);(this->*(this->m_orig_glTexImage1D))(target,level,internalFormat,width,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLLIGHTFPROC m_orig_glLightf = nullptr;
+void m_glLightf_profile(GLenum light,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,921);(this->*(this->m_orig_glLightf))(light,pname,param);}
+FunctionTable::MEMBERPFNGLCLIENTATTRIBDEFAULTEXTPROC m_orig_glClientAttribDefaultEXT = nullptr;
+void m_glClientAttribDefaultEXT_profile(GLbitfield mask)const{ProfilingScope const scope(this,922);(this->*(this->m_orig_glClientAttribDefaultEXT))(mask);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVARBPROC m_orig_glVertexAttrib4bvARB = nullptr;
+void m_glVertexAttrib4bvARB_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,923);(this->*(this->m_orig_glVertexAttrib4bvARB))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIFORMATNVPROC m_orig_glVertexAttribIFormatNV = nullptr;
+void m_glVertexAttribIFormatNV_profile(GLuint index,GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,924);(this->*(this->m_orig_glVertexAttribIFormatNV))(index,size,type,stride);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEPROC m_orig_glStencilFuncSeparate = nullptr;
+void m_glStencilFuncSeparate_profile(GLenum face,GLenum func,GLint ref,GLuint mask)const{ProfilingScope const scope(this,925);(this->*(this->m_orig_glStencilFuncSeparate))(face,func,ref,mask);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVARBPROC m_orig_glGetVertexAttribfvARB = nullptr;
+void m_glGetVertexAttribfvARB_profile(GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,926);(this->*(this->m_orig_glGetVertexAttribfvARB))(index,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DNVPROC m_orig_glVertexAttrib2dNV = nullptr;
+void m_glVertexAttrib2dNV_profile(GLuint index,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,927);(this->*(this->m_orig_glVertexAttrib2dNV))(index,x,y);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IEXTPROC m_orig_glProgramUniform2iEXT = nullptr;
+void m_glProgramUniform2iEXT_profile(GLuint program,GLint location,GLint v0,GLint v1)const{ProfilingScope const scope(this,928);(this->*(this->m_orig_glProgramUniform2iEXT))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVEVERTEXSTREAMATIPROC m_orig_glClientActiveVertexStreamATI = nullptr;
+void m_glClientActiveVertexStreamATI_profile(GLenum stream)const{ProfilingScope const scope(this,929);(this->*(this->m_orig_glClientActiveVertexStreamATI))(stream);}
+FunctionTable::MEMBERPFNGLRASTERPOS3XOESPROC m_orig_glRasterPos3xOES = nullptr;
+void m_glRasterPos3xOES_profile(GLfixed x,GLfixed y,GLfixed z)const{ProfilingScope const scope(this,930);(this->*(this->m_orig_glRasterPos3xOES))(x,y,z);}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERIVNVPROC m_orig_glGetMapParameterivNV = nullptr;
+void m_glGetMapParameterivNV_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,931);(this->*(this->m_orig_glGetMapParameterivNV))(target,pname,params);}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEPROC m_orig_glSampleCoverage = nullptr;
+void m_glSampleCoverage_profile(GLclampf value,GLboolean invert)const{ProfilingScope const scope(this,932);(this->*(this->m_orig_glSampleCoverage))(value,invert);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHXOESPROC m_orig_glClearDepthxOES = nullptr;
+void m_glClearDepthxOES_profile(GLfixed depth)const{ProfilingScope const scope(this,933);(this->*(this->m_orig_glClearDepthxOES))(depth);}
+FunctionTable::MEMBERPFNGLUNIFORMBUFFEREXTPROC m_orig_glUniformBufferEXT = nullptr;
+void m_glUniformBufferEXT_profile(GLuint program,GLint location,GLuint buffer)const{ProfilingScope const scope(this,934);(this->*(this->m_orig_glUniformBufferEXT))(program,location,buffer);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_orig_glTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fvSUN_profile(const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,935);(this->*(this->m_orig_glTexCoord2fNormal3fVertex3fvSUN))(tc,n,v);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUIVNVPROC m_orig_glMulticastGetQueryObjectuivNV = nullptr;
+void m_glMulticastGetQueryObjectuivNV_profile(GLuint gpu,GLuint id,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,936);(this->*(this->m_orig_glMulticastGetQueryObjectuivNV))(gpu,id,pname,params);}
+FunctionTable::MEMBERPFNGLGETFIRSTPERFQUERYIDINTELPROC m_orig_glGetFirstPerfQueryIdINTEL = nullptr;
+void m_glGetFirstPerfQueryIdINTEL_profile(GLuint* queryId)const{ProfilingScope const scope(this,937);(this->*(this->m_orig_glGetFirstPerfQueryIdINTEL))(queryId);}
+FunctionTable::MEMBERPFNGLUNMAPNAMEDBUFFEREXTPROC m_orig_glUnmapNamedBufferEXT = nullptr;
+GLboolean m_glUnmapNamedBufferEXT_profile(GLuint buffer)const{ProfilingScope const scope(this,938);return (this->*(this->m_orig_glUnmapNamedBufferEXT))(buffer);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI_VPROC m_orig_glGetTransformFeedbacki_v = nullptr;
+void m_glGetTransformFeedbacki_v_profile(GLuint xfb,GLenum pname,GLuint index,GLint* param)const{ProfilingScope const scope(this,939);(this->*(this->m_orig_glGetTransformFeedbacki_v))(xfb,pname,index,param);}
+FunctionTable::MEMBERPFNGLUNIFORM4FVARBPROC m_orig_glUniform4fvARB = nullptr;
+void m_glUniform4fvARB_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,940);(this->*(this->m_orig_glUniform4fvARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC m_orig_glRenderbufferStorageMultisampleCoverageNV = nullptr;
+void m_glRenderbufferStorageMultisampleCoverageNV_profile(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,941);(this->*(this->m_orig_glRenderbufferStorageMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLGETFLOATI_VEXTPROC m_orig_glGetFloati_vEXT = nullptr;
+void m_glGetFloati_vEXT_profile(GLenum pname,GLuint index,GLfloat* params)const{ProfilingScope const scope(this,942);(this->*(this->m_orig_glGetFloati_vEXT))(pname,index,params);}
+FunctionTable::MEMBERPFNGLBINDATTRIBLOCATIONARBPROC m_orig_glBindAttribLocationARB = nullptr;
+void m_glBindAttribLocationARB_profile(GLhandleARB programObj,GLuint index,const GLcharARB* name)const{ProfilingScope const scope(this,943);(this->*(this->m_orig_glBindAttribLocationARB))(programObj,index,name);}
+FunctionTable::MEMBERPFNGLBUFFERADDRESSRANGENVPROC m_orig_glBufferAddressRangeNV = nullptr;
+void m_glBufferAddressRangeNV_profile(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length)const{ProfilingScope const scope(this,944);(this->*(this->m_orig_glBufferAddressRangeNV))(pname,index,address,length);}
+FunctionTable::MEMBERPFNGLGENPROGRAMSARBPROC m_orig_glGenProgramsARB = nullptr;
+void m_glGenProgramsARB_profile(GLsizei n,GLuint* programs)const{ProfilingScope const scope(this,945);(this->*(this->m_orig_glGenProgramsARB))(n,programs);}
+FunctionTable::MEMBERPFNGLMULTITEXENVIVEXTPROC m_orig_glMultiTexEnvivEXT = nullptr;
+void m_glMultiTexEnvivEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,946);(this->*(this->m_orig_glMultiTexEnvivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIEXTPROC m_orig_glSecondaryColor3uiEXT = nullptr;
+void m_glSecondaryColor3uiEXT_profile(GLuint red,GLuint green,GLuint blue)const{ProfilingScope const scope(this,947);(this->*(this->m_orig_glSecondaryColor3uiEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC m_orig_glCompressedTextureImage2DEXT = nullptr;
+void m_glCompressedTextureImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,948);(this->*(this->m_orig_glCompressedTextureImage2DEXT))(texture,target,level,internalformat,width,height,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLUNIFORM2IPROC m_orig_glUniform2i = nullptr;
+void m_glUniform2i_profile(GLint location,GLint v0,GLint v1)const{ProfilingScope const scope(this,949);(this->*(this->m_orig_glUniform2i))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLCOPYTEXIMAGE2DEXTPROC m_orig_glCopyTexImage2DEXT = nullptr;
+void m_glCopyTexImage2DEXT_profile(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{ProfilingScope const scope(this,950);(this->*(this->m_orig_glCopyTexImage2DEXT))(target,level,internalformat,x,y,width,height,border);}
+FunctionTable::MEMBERPFNGLUNIFORM2DPROC m_orig_glUniform2d = nullptr;
+void m_glUniform2d_profile(GLint location,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,951);(this->*(this->m_orig_glUniform2d))(location,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DPROC m_orig_glVertexAttribL1d = nullptr;
+void m_glVertexAttribL1d_profile(GLuint index,GLdouble x)const{ProfilingScope const scope(this,952);(this->*(this->m_orig_glVertexAttribL1d))(index,x);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREFACEEXTPROC m_orig_glFramebufferTextureFaceEXT = nullptr;
+void m_glFramebufferTextureFaceEXT_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face)const{ProfilingScope const scope(this,953);(this->*(this->m_orig_glFramebufferTextureFaceEXT))(target,attachment,texture,level,face);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURELAYERPROC m_orig_glFramebufferTextureLayer = nullptr;
+void m_glFramebufferTextureLayer_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer)const{ProfilingScope const scope(this,954);(this->*(this->m_orig_glFramebufferTextureLayer))(target,attachment,texture,level,layer);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4BVOESPROC m_orig_glMultiTexCoord4bvOES = nullptr;
+void m_glMultiTexCoord4bvOES_profile(GLenum texture,const GLbyte* coords)const{ProfilingScope const scope(this,955);(this->*(this->m_orig_glMultiTexCoord4bvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERI_VEXTPROC m_orig_glGetVertexArrayPointeri_vEXT = nullptr;
+void m_glGetVertexArrayPointeri_vEXT_profile(GLuint vaobj,GLuint index,GLenum pname,void** param)const{ProfilingScope const scope(this,956);(this->*(this->m_orig_glGetVertexArrayPointeri_vEXT))(vaobj,index,pname,param);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC m_orig_glNamedProgramLocalParameter4dEXT = nullptr;
+void m_glNamedProgramLocalParameter4dEXT_profile(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,957);(this->*(this->m_orig_glNamedProgramLocalParameter4dEXT))(program,target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLBINORMAL3BEXTPROC m_orig_glBinormal3bEXT = nullptr;
+void m_glBinormal3bEXT_profile(GLbyte bx,GLbyte by,GLbyte bz)const{ProfilingScope const scope(this,958);(this->*(this->m_orig_glBinormal3bEXT))(bx,by,bz);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONFILTER2DEXTPROC m_orig_glConvolutionFilter2DEXT = nullptr;
+void m_glConvolutionFilter2DEXT_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image)const{ProfilingScope const scope(this,959);(this->*(this->m_orig_glConvolutionFilter2DEXT))(target,internalformat,width,height,format,type,image);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVPROC m_orig_glProgramUniform2fv = nullptr;
+void m_glProgramUniform2fv_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,960);(this->*(this->m_orig_glProgramUniform2fv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FSUNPROC m_orig_glColor3fVertex3fSUN = nullptr;
+void m_glColor3fVertex3fSUN_profile(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,961);(this->*(this->m_orig_glColor3fVertex3fSUN))(r,g,b,x,y,z);}
+FunctionTable::MEMBERPFNGLNORMAL3FVERTEX3FVSUNPROC m_orig_glNormal3fVertex3fvSUN = nullptr;
+void m_glNormal3fVertex3fvSUN_profile(const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,962);(this->*(this->m_orig_glNormal3fVertex3fvSUN))(n,v);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC m_orig_glCopyMultiTexSubImage3DEXT = nullptr;
+void m_glCopyMultiTexSubImage3DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,963);(this->*(this->m_orig_glCopyMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4INVPROC m_orig_glProgramLocalParameterI4iNV = nullptr;
+void m_glProgramLocalParameterI4iNV_profile(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,964);(this->*(this->m_orig_glProgramLocalParameterI4iNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVPROC m_orig_glProgramUniformMatrix2x4dv = nullptr;
+void m_glProgramUniformMatrix2x4dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,965);(this->*(this->m_orig_glProgramUniformMatrix2x4dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC m_orig_glPathMemoryGlyphIndexArrayNV = nullptr;
+GLenum m_glPathMemoryGlyphIndexArrayNV_profile(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{ProfilingScope const scope(this,966);return (this->*(this->m_orig_glPathMemoryGlyphIndexArrayNV))(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSEXTPROC m_orig_glDrawArraysEXT = nullptr;
+void m_glDrawArraysEXT_profile(GLenum mode,GLint first,GLsizei count)const{ProfilingScope const scope(this,967);(this->*(this->m_orig_glDrawArraysEXT))(mode,first,count);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONEXTPROC m_orig_glBlendEquationEXT = nullptr;
+void m_glBlendEquationEXT_profile(GLenum mode)const{ProfilingScope const scope(this,968);(this->*(this->m_orig_glBlendEquationEXT))(mode);}
+FunctionTable::MEMBERPFNGLSTENCILOPPROC m_orig_glStencilOp = nullptr;
+void m_glStencilOp_profile(GLenum fail,GLenum zfail,GLenum zpass)const{ProfilingScope const scope(this,969);(this->*(this->m_orig_glStencilOp))(fail,zfail,zpass);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DEXTPROC m_orig_glCopyTextureSubImage2DEXT = nullptr;
+void m_glCopyTextureSubImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,970);(this->*(this->m_orig_glCopyTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLTEXENVFPROC m_orig_glTexEnvf = nullptr;
+void m_glTexEnvf_profile(GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,971);(this->*(this->m_orig_glTexEnvf))(target,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVNVPROC m_orig_glVertexAttrib2dvNV = nullptr;
+void m_glVertexAttrib2dvNV_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,972);(this->*(this->m_orig_glVertexAttrib2dvNV))(index,v);}
+FunctionTable::MEMBERPFNGLGENPERFMONITORSAMDPROC m_orig_glGenPerfMonitorsAMD = nullptr;
+void m_glGenPerfMonitorsAMD_profile(GLsizei n,GLuint* monitors)const{ProfilingScope const scope(this,973);(this->*(this->m_orig_glGenPerfMonitorsAMD))(n,monitors);}
+FunctionTable::MEMBERPFNGLGETINTEGER64I_VPROC m_orig_glGetInteger64i_v = nullptr;
+void m_glGetInteger64i_v_profile(GLenum target,GLuint index,GLint64* data)const{ProfilingScope const scope(this,974);(this->*(this->m_orig_glGetInteger64i_v))(target,index,data);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVPROC m_orig_glGetHistogramParameterfv = nullptr;
+void m_glGetHistogramParameterfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,975);(this->*(this->m_orig_glGetHistogramParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXFORMATNVPROC m_orig_glVertexFormatNV = nullptr;
+void m_glVertexFormatNV_profile(GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,976);(this->*(this->m_orig_glVertexFormatNV))(size,type,stride);}
+FunctionTable::MEMBERPFNGLBLENDFUNCINDEXEDAMDPROC m_orig_glBlendFuncIndexedAMD = nullptr;
+void m_glBlendFuncIndexedAMD_profile(GLuint buf,GLenum src,GLenum dst)const{ProfilingScope const scope(this,977);(this->*(this->m_orig_glBlendFuncIndexedAMD))(buf,src,dst);}
+FunctionTable::MEMBERPFNGLTEXENVIPROC m_orig_glTexEnvi = nullptr;
+void m_glTexEnvi_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,978);(this->*(this->m_orig_glTexEnvi))(target,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVPROC m_orig_glMultiTexCoord1iv = nullptr;
+void m_glMultiTexCoord1iv_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,979);(this->*(this->m_orig_glMultiTexCoord1iv))(target,v);}
+FunctionTable::MEMBERPFNGLISENABLEDIPROC m_orig_glIsEnabledi = nullptr;
+GLboolean m_glIsEnabledi_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,980);return (this->*(this->m_orig_glIsEnabledi))(target,index);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64VNVPROC m_orig_glVertexAttribL2ui64vNV = nullptr;
+void m_glVertexAttribL2ui64vNV_profile(GLuint index,const GLuint64EXT* v)const{ProfilingScope const scope(this,981);(this->*(this->m_orig_glVertexAttribL2ui64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64NVPROC m_orig_glVertexAttribL4i64NV = nullptr;
+void m_glVertexAttribL4i64NV_profile(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{ProfilingScope const scope(this,982);(this->*(this->m_orig_glVertexAttribL4i64NV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEDEXTPROC m_orig_glMatrixTranslatedEXT = nullptr;
+void m_glMatrixTranslatedEXT_profile(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,983);(this->*(this->m_orig_glMatrixTranslatedEXT))(mode,x,y,z);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTARBPROC m_orig_glMakeTextureHandleResidentARB = nullptr;
+void m_glMakeTextureHandleResidentARB_profile(GLuint64 handle)const{ProfilingScope const scope(this,984);(this->*(this->m_orig_glMakeTextureHandleResidentARB))(handle);}
+FunctionTable::MEMBERPFNGLMATRIXMULTDEXTPROC m_orig_glMatrixMultdEXT = nullptr;
+void m_glMatrixMultdEXT_profile(GLenum mode,const GLdouble* m)const{ProfilingScope const scope(this,985);(this->*(this->m_orig_glMatrixMultdEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLBINORMAL3DVEXTPROC m_orig_glBinormal3dvEXT = nullptr;
+void m_glBinormal3dvEXT_profile(const GLdouble* v)const{ProfilingScope const scope(this,986);(this->*(this->m_orig_glBinormal3dvEXT))(v);}
+FunctionTable::MEMBERPFNGLIMPORTSYNCEXTPROC m_orig_glImportSyncEXT = nullptr;
+GLsync m_glImportSyncEXT_profile(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags)const{ProfilingScope const scope(this,987);return (this->*(this->m_orig_glImportSyncEXT))(external_sync_type,external_sync,flags);}
+FunctionTable::MEMBERPFNGLGETMAPIVPROC m_orig_glGetMapiv = nullptr;
+void m_glGetMapiv_profile(GLenum target,GLenum query,GLint* v)const{ProfilingScope const scope(this,988);(this->*(this->m_orig_glGetMapiv))(target,query,v);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREFDEXTPROC m_orig_glImportSemaphoreFdEXT = nullptr;
+void m_glImportSemaphoreFdEXT_profile(GLuint semaphore,GLenum handleType,GLint fd)const{ProfilingScope const scope(this,989);(this->*(this->m_orig_glImportSemaphoreFdEXT))(semaphore,handleType,fd);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVPROC m_orig_glMultiTexCoord4sv = nullptr;
+void m_glMultiTexCoord4sv_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,990);(this->*(this->m_orig_glMultiTexCoord4sv))(target,v);}
+FunctionTable::MEMBERPFNGLPNTRIANGLESIATIPROC m_orig_glPNTrianglesiATI = nullptr;
+void m_glPNTrianglesiATI_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,991);(this->*(this->m_orig_glPNTrianglesiATI))(pname,param);}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYAPPLEPROC m_orig_glBindVertexArrayAPPLE = nullptr;
+void m_glBindVertexArrayAPPLE_profile(GLuint array)const{ProfilingScope const scope(this,992);(this->*(this->m_orig_glBindVertexArrayAPPLE))(array);}
+FunctionTable::MEMBERPFNGLOBJECTPTRLABELPROC m_orig_glObjectPtrLabel = nullptr;
+void m_glObjectPtrLabel_profile(const void* ptr,GLsizei length,const GLchar* label)const{ProfilingScope const scope(this,993);(this->*(this->m_orig_glObjectPtrLabel))(ptr,length,label);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGPROC m_orig_glGetDebugMessageLog = nullptr;
+GLuint m_glGetDebugMessageLog_profile(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{ProfilingScope const scope(this,994);return (this->*(this->m_orig_glGetDebugMessageLog))(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+FunctionTable::MEMBERPFNGLTRACKMATRIXNVPROC m_orig_glTrackMatrixNV = nullptr;
+void m_glTrackMatrixNV_profile(GLenum target,GLuint address,GLenum matrix,GLenum transform)const{ProfilingScope const scope(this,995);(this->*(this->m_orig_glTrackMatrixNV))(target,address,matrix,transform);}
+FunctionTable::MEMBERPFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC m_orig_glProgramPathFragmentInputGenNV = nullptr;
+void m_glProgramPathFragmentInputGenNV_profile(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs)const{ProfilingScope const scope(this,996);(this->*(this->m_orig_glProgramPathFragmentInputGenNV))(program,location,genMode,components,coeffs);}
+FunctionTable::MEMBERPFNGLTANGENT3IVEXTPROC m_orig_glTangent3ivEXT = nullptr;
+void m_glTangent3ivEXT_profile(const GLint* v)const{ProfilingScope const scope(this,997);(this->*(this->m_orig_glTangent3ivEXT))(v);}
+FunctionTable::MEMBERPFNGLGETUNIFORMFVPROC m_orig_glGetUniformfv = nullptr;
+void m_glGetUniformfv_profile(GLuint program,GLint location,GLfloat* params)const{ProfilingScope const scope(this,998);(this->*(this->m_orig_glGetUniformfv))(program,location,params);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVPROC m_orig_glSecondaryColor3ubv = nullptr;
+void m_glSecondaryColor3ubv_profile(const GLubyte* v)const{ProfilingScope const scope(this,999);(this->*(this->m_orig_glSecondaryColor3ubv))(v);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC m_orig_glMakeTextureHandleNonResidentNV = nullptr;
+void m_glMakeTextureHandleNonResidentNV_profile(GLuint64 handle)const{ProfilingScope const scope(this,1000);(this->*(this->m_orig_glMakeTextureHandleNonResidentNV))(handle);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4UBVNVPROC m_orig_glVertexAttribs4ubvNV = nullptr;
+void m_glVertexAttribs4ubvNV_profile(GLuint index,GLsizei count,const GLubyte* v)const{ProfilingScope const scope(this,1001);(this->*(this->m_orig_glVertexAttribs4ubvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLCLIPPLANEXOESPROC m_orig_glClipPlanexOES = nullptr;
+void m_glClipPlanexOES_profile(GLenum plane,const GLfixed* equation)const{ProfilingScope const scope(this,1002);(this->*(this->m_orig_glClipPlanexOES))(plane,equation);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVPROC m_orig_glMultiTexCoord3iv = nullptr;
+void m_glMultiTexCoord3iv_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,1003);(this->*(this->m_orig_glMultiTexCoord3iv))(target,v);}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEARBPROC m_orig_glGetnPolygonStippleARB = nullptr;
+void m_glGetnPolygonStippleARB_profile(GLsizei bufSize,GLubyte* pattern)const{ProfilingScope const scope(this,1004);(this->*(this->m_orig_glGetnPolygonStippleARB))(bufSize,pattern);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VNVPROC m_orig_glUniform2i64vNV = nullptr;
+void m_glUniform2i64vNV_profile(GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,1005);(this->*(this->m_orig_glUniform2i64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLLIGHTMODELFPROC m_orig_glLightModelf = nullptr;
+void m_glLightModelf_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1006);(this->*(this->m_orig_glLightModelf))(pname,param);}
+FunctionTable::MEMBERPFNGLDELETEMEMORYOBJECTSEXTPROC m_orig_glDeleteMemoryObjectsEXT = nullptr;
+void m_glDeleteMemoryObjectsEXT_profile(GLsizei n,const GLuint* memoryObjects)const{ProfilingScope const scope(this,1007);(this->*(this->m_orig_glDeleteMemoryObjectsEXT))(n,memoryObjects);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE2DEXTPROC m_orig_glMultiTexSubImage2DEXT = nullptr;
+void m_glMultiTexSubImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1008);(this->*(this->m_orig_glMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor3fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fSUN_profile(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1009);(this->*(this->m_orig_glReplacementCodeuiColor3fVertex3fSUN))(rc,r,g,b,x,y,z);}
+FunctionTable::MEMBERPFNGLTANGENT3DVEXTPROC m_orig_glTangent3dvEXT = nullptr;
+void m_glTangent3dvEXT_profile(const GLdouble* v)const{ProfilingScope const scope(this,1010);(this->*(this->m_orig_glTangent3dvEXT))(v);}
+FunctionTable::MEMBERPFNGLLIGHTMODELIPROC m_orig_glLightModeli = nullptr;
+void m_glLightModeli_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1011);(this->*(this->m_orig_glLightModeli))(pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTHVNVPROC m_orig_glVertexWeighthvNV = nullptr;
+void m_glVertexWeighthvNV_profile(const GLhalfNV* weight)const{ProfilingScope const scope(this,1012);(this->*(this->m_orig_glVertexWeighthvNV))(weight);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IVPROC m_orig_glWindowPos3iv = nullptr;
+void m_glWindowPos3iv_profile(const GLint* v)const{ProfilingScope const scope(this,1013);(this->*(this->m_orig_glWindowPos3iv))(v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIVPROC m_orig_glMultiTexCoordP1uiv = nullptr;
+void m_glMultiTexCoordP1uiv_profile(GLenum texture,GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,1014);(this->*(this->m_orig_glMultiTexCoordP1uiv))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLTRANSFORMPATHNVPROC m_orig_glTransformPathNV = nullptr;
+void m_glTransformPathNV_profile(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,1015);(this->*(this->m_orig_glTransformPathNV))(resultPath,srcPath,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DNVPROC m_orig_glProgramNamedParameter4dNV = nullptr;
+void m_glProgramNamedParameter4dNV_profile(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1016);(this->*(this->m_orig_glProgramNamedParameter4dNV))(id,len,name,x,y,z,w);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTPROC m_orig_glMultiDrawElementsIndirect = nullptr;
+void m_glMultiDrawElementsIndirect_profile(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride)const{ProfilingScope const scope(this,1017);(this->*(this->m_orig_glMultiDrawElementsIndirect))(mode,type,indirect,drawcount,stride);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DEXTPROC m_orig_glProgramUniform1dEXT = nullptr;
+void m_glProgramUniform1dEXT_profile(GLuint program,GLint location,GLdouble x)const{ProfilingScope const scope(this,1018);(this->*(this->m_orig_glProgramUniform1dEXT))(program,location,x);}
+FunctionTable::MEMBERPFNGLCALLLISTSPROC m_orig_glCallLists = nullptr;
+void m_glCallLists_profile(GLsizei n,GLenum type,const GLvoid* lists)const{ProfilingScope const scope(this,1019);(this->*(this->m_orig_glCallLists))(n,type,lists);}
+FunctionTable::MEMBERPFNGLNORMAL3HVNVPROC m_orig_glNormal3hvNV = nullptr;
+void m_glNormal3hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1020);(this->*(this->m_orig_glNormal3hvNV))(v);}
+FunctionTable::MEMBERPFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC m_orig_glGetCombinerOutputParameterfvNV = nullptr;
+void m_glGetCombinerOutputParameterfvNV_profile(GLenum stage,GLenum portion,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1021);(this->*(this->m_orig_glGetCombinerOutputParameterfvNV))(stage,portion,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SARBPROC m_orig_glVertexAttrib4sARB = nullptr;
+void m_glVertexAttrib4sARB_profile(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,1022);(this->*(this->m_orig_glVertexAttrib4sARB))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLTEXCOORD3IPROC m_orig_glTexCoord3i = nullptr;
+void m_glTexCoord3i_profile(GLint s,GLint t,GLint r)const{ProfilingScope const scope(this,1023);(this->*(this->m_orig_glTexCoord3i))(s,t,r);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIVPROC m_orig_glVertexAttribI3uiv = nullptr;
+void m_glVertexAttribI3uiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1024);(this->*(this->m_orig_glVertexAttribI3uiv))(index,v);}
+FunctionTable::MEMBERPFNGLPUSHDEBUGGROUPPROC m_orig_glPushDebugGroup = nullptr;
+void m_glPushDebugGroup_profile(GLenum source,GLuint id,GLsizei length,const GLchar* message)const{ProfilingScope const scope(this,1025);(this->*(this->m_orig_glPushDebugGroup))(source,id,length,message);}
+FunctionTable::MEMBERPFNGLTEXCOORD3FPROC m_orig_glTexCoord3f = nullptr;
+void m_glTexCoord3f_profile(GLfloat s,GLfloat t,GLfloat r)const{ProfilingScope const scope(this,1026);(this->*(this->m_orig_glTexCoord3f))(s,t,r);}
+FunctionTable::MEMBERPFNGLTEXCOORD3DPROC m_orig_glTexCoord3d = nullptr;
+void m_glTexCoord3d_profile(GLdouble s,GLdouble t,GLdouble r)const{ProfilingScope const scope(this,1027);(this->*(this->m_orig_glTexCoord3d))(s,t,r);}
+FunctionTable::MEMBERPFNGLTEXCOORD2XOESPROC m_orig_glTexCoord2xOES = nullptr;
+void m_glTexCoord2xOES_profile(GLfixed s,GLfixed t)const{ProfilingScope const scope(this,1028);(this->*(this->m_orig_glTexCoord2xOES))(s,t);}
+FunctionTable::MEMBERPFNGLGETSTAGEINDEXNVPROC m_orig_glGetStageIndexNV = nullptr;
+GLushort m_glGetStageIndexNV_profile(GLenum shadertype)const{ProfilingScope const scope(this,1029);return (this->*(this->m_orig_glGetStageIndexNV))(shadertype);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64VNVPROC m_orig_glProgramUniform4i64vNV = nullptr;
+void m_glProgramUniform4i64vNV_profile(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,1030);(this->*(this->m_orig_glProgramUniform4i64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVEXTPROC m_orig_glGetNamedBufferPointervEXT = nullptr;
+void m_glGetNamedBufferPointervEXT_profile(GLuint buffer,GLenum pname,void** params)const{ProfilingScope const scope(this,1031);(this->*(this->m_orig_glGetNamedBufferPointervEXT))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERNVPROC m_orig_glTextureBarrierNV = nullptr;
+void m_glTextureBarrierNV_profile()const{ProfilingScope const scope(this,1032);(this->*(this->m_orig_glTextureBarrierNV))();}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FVSUNPROC m_orig_glColor4ubVertex3fvSUN = nullptr;
+void m_glColor4ubVertex3fvSUN_profile(const GLubyte* c,const GLfloat* v)const{ProfilingScope const scope(this,1033);(this->*(this->m_orig_glColor4ubVertex3fvSUN))(c,v);}
+FunctionTable::MEMBERPFNGLGETCOMMANDHEADERNVPROC m_orig_glGetCommandHeaderNV = nullptr;
+GLuint m_glGetCommandHeaderNV_profile(GLenum tokenID,GLuint size)const{ProfilingScope const scope(this,1034);return (this->*(this->m_orig_glGetCommandHeaderNV))(tokenID,size);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERINFOAMDPROC m_orig_glGetPerfMonitorCounterInfoAMD = nullptr;
+void m_glGetPerfMonitorCounterInfoAMD_profile(GLuint group,GLuint counter,GLenum pname,void* data)const{ProfilingScope const scope(this,1035);(this->*(this->m_orig_glGetPerfMonitorCounterInfoAMD))(group,counter,pname,data);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVARBPROC m_orig_glVertexAttrib1svARB = nullptr;
+void m_glVertexAttrib1svARB_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,1036);(this->*(this->m_orig_glVertexAttrib1svARB))(index,v);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERINVPROC m_orig_glCombinerParameteriNV = nullptr;
+void m_glCombinerParameteriNV_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1037);(this->*(this->m_orig_glCombinerParameteriNV))(pname,param);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSEFEXTPROC m_orig_glMatrixMultTransposefEXT = nullptr;
+void m_glMatrixMultTransposefEXT_profile(GLenum mode,const GLfloat* m)const{ProfilingScope const scope(this,1038);(this->*(this->m_orig_glMatrixMultTransposefEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLDETAILTEXFUNCSGISPROC m_orig_glDetailTexFuncSGIS = nullptr;
+void m_glDetailTexFuncSGIS_profile(GLenum target,GLsizei n,const GLfloat* points)const{ProfilingScope const scope(this,1039);(this->*(this->m_orig_glDetailTexFuncSGIS))(target,n,points);}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTPROC m_orig_glAreTexturesResident = nullptr;
+GLboolean m_glAreTexturesResident_profile(GLsizei n,const GLuint* textures,GLboolean* residences)const{ProfilingScope const scope(this,1040);return (this->*(this->m_orig_glAreTexturesResident))(n,textures,residences);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DPROC m_orig_glProgramUniform2d = nullptr;
+void m_glProgramUniform2d_profile(GLuint program,GLint location,GLdouble v0,GLdouble v1)const{ProfilingScope const scope(this,1041);(this->*(this->m_orig_glProgramUniform2d))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERFVEXTPROC m_orig_glGetConvolutionParameterfvEXT = nullptr;
+void m_glGetConvolutionParameterfvEXT_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1042);(this->*(this->m_orig_glGetConvolutionParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLINDEXPOINTERLISTIBMPROC m_orig_glIndexPointerListIBM = nullptr;
+void m_glIndexPointerListIBM_profile(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,1043);(this->*(this->m_orig_glIndexPointerListIBM))(type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IEXTPROC m_orig_glVertexAttribI4iEXT = nullptr;
+void m_glVertexAttribI4iEXT_profile(GLuint index,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,1044);(this->*(this->m_orig_glVertexAttribI4iEXT))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FPROC m_orig_glProgramUniform2f = nullptr;
+void m_glProgramUniform2f_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1)const{ProfilingScope const scope(this,1045);(this->*(this->m_orig_glProgramUniform2f))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLRASTERPOS4SVPROC m_orig_glRasterPos4sv = nullptr;
+void m_glRasterPos4sv_profile(const GLshort* v)const{ProfilingScope const scope(this,1046);(this->*(this->m_orig_glRasterPos4sv))(v);}
+FunctionTable::MEMBERPFNGLCOLOR4SPROC m_orig_glColor4s = nullptr;
+void m_glColor4s_profile(GLshort red,GLshort green,GLshort blue,GLshort alpha)const{ProfilingScope const scope(this,1047);(this->*(this->m_orig_glColor4s))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTIVNVPROC m_orig_glMulticastGetQueryObjectivNV = nullptr;
+void m_glMulticastGetQueryObjectivNV_profile(GLuint gpu,GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1048);(this->*(this->m_orig_glMulticastGetQueryObjectivNV))(gpu,id,pname,params);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP3ATIPROC m_orig_glColorFragmentOp3ATI = nullptr;
+void m_glColorFragmentOp3ATI_profile(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{ProfilingScope const scope(this,1049);(this->*(this->m_orig_glColorFragmentOp3ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+FunctionTable::MEMBERPFNGLRESIZEBUFFERSMESAPROC m_orig_glResizeBuffersMESA = nullptr;
+void m_glResizeBuffersMESA_profile()const{ProfilingScope const scope(this,1050);(this->*(this->m_orig_glResizeBuffersMESA))();}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERFVPROC m_orig_glGetMinmaxParameterfv = nullptr;
+void m_glGetMinmaxParameterfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1051);(this->*(this->m_orig_glGetMinmaxParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREARBPROC m_orig_glClientActiveTextureARB = nullptr;
+void m_glClientActiveTextureARB_profile(GLenum texture)const{ProfilingScope const scope(this,1052);(this->*(this->m_orig_glClientActiveTextureARB))(texture);}
+FunctionTable::MEMBERPFNGLBINDVERTEXARRAYPROC m_orig_glBindVertexArray = nullptr;
+void m_glBindVertexArray_profile(GLuint array)const{ProfilingScope const scope(this,1053);(this->*(this->m_orig_glBindVertexArray))(array);}
+FunctionTable::MEMBERPFNGLCOLOR4BPROC m_orig_glColor4b = nullptr;
+void m_glColor4b_profile(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha)const{ProfilingScope const scope(this,1054);(this->*(this->m_orig_glColor4b))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLCOLOR4FPROC m_orig_glColor4f = nullptr;
+void m_glColor4f_profile(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{ProfilingScope const scope(this,1055);(this->*(this->m_orig_glColor4f))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLCOLOR4DPROC m_orig_glColor4d = nullptr;
+void m_glColor4d_profile(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha)const{ProfilingScope const scope(this,1056);(this->*(this->m_orig_glColor4d))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLCOLOR4IPROC m_orig_glColor4i = nullptr;
+void m_glColor4i_profile(GLint red,GLint green,GLint blue,GLint alpha)const{ProfilingScope const scope(this,1057);(this->*(this->m_orig_glColor4i))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLEDGEFLAGFORMATNVPROC m_orig_glEdgeFlagFormatNV = nullptr;
+void m_glEdgeFlagFormatNV_profile(GLsizei stride)const{ProfilingScope const scope(this,1058);(this->*(this->m_orig_glEdgeFlagFormatNV))(stride);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAPROC m_orig_glNamedBufferSubData = nullptr;
+void m_glNamedBufferSubData_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{ProfilingScope const scope(this,1059);(this->*(this->m_orig_glNamedBufferSubData))(buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDPROC m_orig_glDrawElementsInstanced = nullptr;
+void m_glDrawElementsInstanced_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount)const{ProfilingScope const scope(this,1060);(this->*(this->m_orig_glDrawElementsInstanced))(mode,count,type,indices,instancecount);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIIVEXTPROC m_orig_glGetMultiTexParameterIivEXT = nullptr;
+void m_glGetMultiTexParameterIivEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1061);(this->*(this->m_orig_glGetMultiTexParameterIivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEX2DVPROC m_orig_glVertex2dv = nullptr;
+void m_glVertex2dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1062);(this->*(this->m_orig_glVertex2dv))(v);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBEXTPROC m_orig_glDisableVertexArrayAttribEXT = nullptr;
+void m_glDisableVertexArrayAttribEXT_profile(GLuint vaobj,GLuint index)const{ProfilingScope const scope(this,1063);(this->*(this->m_orig_glDisableVertexArrayAttribEXT))(vaobj,index);}
+FunctionTable::MEMBERPFNGLOBJECTUNPURGEABLEAPPLEPROC m_orig_glObjectUnpurgeableAPPLE = nullptr;
+GLenum m_glObjectUnpurgeableAPPLE_profile(GLenum objectType,GLuint name,GLenum option)const{ProfilingScope const scope(this,1064);return (this->*(this->m_orig_glObjectUnpurgeableAPPLE))(objectType,name,option);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2DVNVPROC m_orig_glVertexAttribs2dvNV = nullptr;
+void m_glVertexAttribs2dvNV_profile(GLuint index,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,1065);(this->*(this->m_orig_glVertexAttribs2dvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fSUN_profile(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1066);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fVertex3fSUN))(rc,s,t,x,y,z);}
+FunctionTable::MEMBERPFNGLGETMAPPARAMETERFVNVPROC m_orig_glGetMapParameterfvNV = nullptr;
+void m_glGetMapParameterfvNV_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1067);(this->*(this->m_orig_glGetMapParameterfvNV))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVEXTPROC m_orig_glProgramUniform4ivEXT = nullptr;
+void m_glProgramUniform4ivEXT_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1068);(this->*(this->m_orig_glProgramUniform4ivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VNVPROC m_orig_glProgramUniform3ui64vNV = nullptr;
+void m_glProgramUniform3ui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1069);(this->*(this->m_orig_glProgramUniform3ui64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLRECTFVPROC m_orig_glRectfv = nullptr;
+void m_glRectfv_profile(const GLfloat* v1,const GLfloat* v2)const{ProfilingScope const scope(this,1070);(this->*(this->m_orig_glRectfv))(v1,v2);}
+FunctionTable::MEMBERPFNGLTEXFILTERFUNCSGISPROC m_orig_glTexFilterFuncSGIS = nullptr;
+void m_glTexFilterFuncSGIS_profile(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights)const{ProfilingScope const scope(this,1071);(this->*(this->m_orig_glTexFilterFuncSGIS))(target,filter,n,weights);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERFVSGIXPROC m_orig_glSpriteParameterfvSGIX = nullptr;
+void m_glSpriteParameterfvSGIX_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1072);(this->*(this->m_orig_glSpriteParameterfvSGIX))(pname,params);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE1DEXTPROC m_orig_glCopyMultiTexImage1DEXT = nullptr;
+void m_glCopyMultiTexImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{ProfilingScope const scope(this,1073);(this->*(this->m_orig_glCopyMultiTexImage1DEXT))(texunit,target,level,internalformat,x,y,width,border);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVEXTPROC m_orig_glGetVertexAttribIuivEXT = nullptr;
+void m_glGetVertexAttribIuivEXT_profile(GLuint index,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,1074);(this->*(this->m_orig_glGetVertexAttribIuivEXT))(index,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X4DVPROC m_orig_glUniformMatrix2x4dv = nullptr;
+void m_glUniformMatrix2x4dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1075);(this->*(this->m_orig_glUniformMatrix2x4dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC m_orig_glGetProgramResourceLocationIndex = nullptr;
+GLint m_glGetProgramResourceLocationIndex_profile(GLuint program,GLenum programInterface,const GLchar* name)const{ProfilingScope const scope(this,1076);return (this->*(this->m_orig_glGetProgramResourceLocationIndex))(program,programInterface,name);}
+FunctionTable::MEMBERPFNGLCOLOR3HNVPROC m_orig_glColor3hNV = nullptr;
+void m_glColor3hNV_profile(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{ProfilingScope const scope(this,1077);(this->*(this->m_orig_glColor3hNV))(red,green,blue);}
+FunctionTable::MEMBERPFNGLVIEWPORTPROC m_orig_glViewport = nullptr;
+void m_glViewport_profile(GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1078);(this->*(this->m_orig_glViewport))(x,y,width,height);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FNVPROC m_orig_glProgramNamedParameter4fNV = nullptr;
+void m_glProgramNamedParameter4fNV_profile(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,1079);(this->*(this->m_orig_glProgramNamedParameter4fNV))(id,len,name,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETINVARIANTBOOLEANVEXTPROC m_orig_glGetInvariantBooleanvEXT = nullptr;
+void m_glGetInvariantBooleanvEXT_profile(GLuint id,GLenum value,GLboolean* data)const{ProfilingScope const scope(this,1080);(this->*(this->m_orig_glGetInvariantBooleanvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DMULTISAMPLEPROC m_orig_glTexStorage2DMultisample = nullptr;
+void m_glTexStorage2DMultisample_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,1081);(this->*(this->m_orig_glTexStorage2DMultisample))(target,samples,internalformat,width,height,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLPIXELSTOREXPROC m_orig_glPixelStorex = nullptr;
+void m_glPixelStorex_profile(GLenum pname,GLfixed param)const{ProfilingScope const scope(this,1082);(this->*(this->m_orig_glPixelStorex))(pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1DVEXTPROC m_orig_glVertexAttribL1dvEXT = nullptr;
+void m_glVertexAttribL1dvEXT_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1083);(this->*(this->m_orig_glVertexAttribL1dvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINEUNIFORMIVPROC m_orig_glGetActiveSubroutineUniformiv = nullptr;
+void m_glGetActiveSubroutineUniformiv_profile(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values)const{ProfilingScope const scope(this,1084);(this->*(this->m_orig_glGetActiveSubroutineUniformiv))(program,shadertype,index,pname,values);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERARBPROC m_orig_glVertexAttribPointerARB = nullptr;
+void m_glVertexAttribPointerARB_profile(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,1085);(this->*(this->m_orig_glVertexAttribPointerARB))(index,size,type,normalized,stride,pointer);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC m_orig_glCompressedTexSubImage2DARB = nullptr;
+void m_glCompressedTexSubImage2DARB_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,1086);(this->*(this->m_orig_glCompressedTexSubImage2DARB))(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM1DEXTPROC m_orig_glTexStorageMem1DEXT = nullptr;
+void m_glTexStorageMem1DEXT_profile(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,1087);(this->*(this->m_orig_glTexStorageMem1DEXT))(target,levels,internalFormat,width,memory,offset);}
+FunctionTable::MEMBERPFNGLVERTEX2HVNVPROC m_orig_glVertex2hvNV = nullptr;
+void m_glVertex2hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1088);(this->*(this->m_orig_glVertex2hvNV))(v);}
+FunctionTable::MEMBERPFNGLTEXBUFFERPROC m_orig_glTexBuffer = nullptr;
+void m_glTexBuffer_profile(GLenum target,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,1089);(this->*(this->m_orig_glTexBuffer))(target,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLARRAYELEMENTPROC m_orig_glArrayElement = nullptr;
+void m_glArrayElement_profile(GLint i)const{ProfilingScope const scope(this,1090);(this->*(this->m_orig_glArrayElement))(i);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMPROC m_orig_glValidateProgram = nullptr;
+void m_glValidateProgram_profile(GLuint program)const{ProfilingScope const scope(this,1091);(this->*(this->m_orig_glValidateProgram))(program);}
+FunctionTable::MEMBERPFNGLPIXELSTOREFPROC m_orig_glPixelStoref = nullptr;
+void m_glPixelStoref_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1092);(this->*(this->m_orig_glPixelStoref))(pname,param);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DARBPROC m_orig_glWindowPos3dARB = nullptr;
+void m_glWindowPos3dARB_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1093);(this->*(this->m_orig_glWindowPos3dARB))(x,y,z);}
+FunctionTable::MEMBERPFNGLEVALCOORD1DVPROC m_orig_glEvalCoord1dv = nullptr;
+void m_glEvalCoord1dv_profile(const GLdouble* u)const{ProfilingScope const scope(this,1094);(this->*(this->m_orig_glEvalCoord1dv))(u);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2FVNVPROC m_orig_glVertexAttribs2fvNV = nullptr;
+void m_glVertexAttribs2fvNV_profile(GLuint index,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,1095);(this->*(this->m_orig_glVertexAttribs2fvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLRECTIPROC m_orig_glRecti = nullptr;
+void m_glRecti_profile(GLint x1,GLint y1,GLint x2,GLint y2)const{ProfilingScope const scope(this,1096);(this->*(this->m_orig_glRecti))(x1,y1,x2,y2);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,1097);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN))(rc,tc,c,n,v);}
+FunctionTable::MEMBERPFNGLTEXCOORD1BOESPROC m_orig_glTexCoord1bOES = nullptr;
+void m_glTexCoord1bOES_profile(GLbyte s)const{ProfilingScope const scope(this,1098);(this->*(this->m_orig_glTexCoord1bOES))(s);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VARBPROC m_orig_glProgramUniform2i64vARB = nullptr;
+void m_glProgramUniform2i64vARB_profile(GLuint program,GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,1099);(this->*(this->m_orig_glProgramUniform2i64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DARBPROC m_orig_glWindowPos2dARB = nullptr;
+void m_glWindowPos2dARB_profile(GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1100);(this->*(this->m_orig_glWindowPos2dARB))(x,y);}
+FunctionTable::MEMBERPFNGLGETPROGRAMPARAMETERDVNVPROC m_orig_glGetProgramParameterdvNV = nullptr;
+void m_glGetProgramParameterdvNV_profile(GLenum target,GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1101);(this->*(this->m_orig_glGetProgramParameterdvNV))(target,index,pname,params);}
+FunctionTable::MEMBERPFNGLRECTFPROC m_orig_glRectf = nullptr;
+void m_glRectf_profile(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2)const{ProfilingScope const scope(this,1102);(this->*(this->m_orig_glRectf))(x1,y1,x2,y2);}
+FunctionTable::MEMBERPFNGLRECTDPROC m_orig_glRectd = nullptr;
+void m_glRectd_profile(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2)const{ProfilingScope const scope(this,1103);(this->*(this->m_orig_glRectd))(x1,y1,x2,y2);}
+FunctionTable::MEMBERPFNGLMAP1XOESPROC m_orig_glMap1xOES = nullptr;
+void m_glMap1xOES_profile(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points)const{ProfilingScope const scope(this,1104);(this->*(this->m_orig_glMap1xOES))(target,u1,u2,stride,order,points);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVNVPROC m_orig_glVertexAttrib3fvNV = nullptr;
+void m_glVertexAttrib3fvNV_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1105);(this->*(this->m_orig_glVertexAttrib3fvNV))(index,v);}
+FunctionTable::MEMBERPFNGLREFERENCEPLANESGIXPROC m_orig_glReferencePlaneSGIX = nullptr;
+void m_glReferencePlaneSGIX_profile(const GLdouble* equation)const{ProfilingScope const scope(this,1106);(this->*(this->m_orig_glReferencePlaneSGIX))(equation);}
+FunctionTable::MEMBERPFNGLMULTICASTBLITFRAMEBUFFERNVPROC m_orig_glMulticastBlitFramebufferNV = nullptr;
+void m_glMulticastBlitFramebufferNV_profile(GLuint srcGpu,GLuint dstGpu,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{ProfilingScope const scope(this,1107);(this->*(this->m_orig_glMulticastBlitFramebufferNV))(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+FunctionTable::MEMBERPFNGLGETCOMBINERINPUTPARAMETERFVNVPROC m_orig_glGetCombinerInputParameterfvNV = nullptr;
+void m_glGetCombinerInputParameterfvNV_profile(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1108);(this->*(this->m_orig_glGetCombinerInputParameterfvNV))(stage,portion,variable,pname,params);}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLEARBPROC m_orig_glGetTextureSamplerHandleARB = nullptr;
+GLuint64 m_glGetTextureSamplerHandleARB_profile(GLuint texture,GLuint sampler)const{ProfilingScope const scope(this,1109);return (this->*(this->m_orig_glGetTextureSamplerHandleARB))(texture,sampler);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREPROC m_orig_glBindTexture = nullptr;
+void m_glBindTexture_profile(GLenum target,GLuint texture)const{ProfilingScope const scope(this,1110);(this->*(this->m_orig_glBindTexture))(target,texture);}
+FunctionTable::MEMBERPFNGLRECTSPROC m_orig_glRects = nullptr;
+void m_glRects_profile(GLshort x1,GLshort y1,GLshort x2,GLshort y2)const{ProfilingScope const scope(this,1111);(this->*(this->m_orig_glRects))(x1,y1,x2,y2);}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBARBPROC m_orig_glGetActiveAttribARB = nullptr;
+void m_glGetActiveAttribARB_profile(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name)const{ProfilingScope const scope(this,1112);(this->*(this->m_orig_glGetActiveAttribARB))(programObj,index,maxLength,length,size,type,name);}
+FunctionTable::MEMBERPFNGLHISTOGRAMEXTPROC m_orig_glHistogramEXT = nullptr;
+void m_glHistogramEXT_profile(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{ProfilingScope const scope(this,1113);(this->*(this->m_orig_glHistogramEXT))(target,width,internalformat,sink);}
+FunctionTable::MEMBERPFNGLGETTEXTURESAMPLERHANDLENVPROC m_orig_glGetTextureSamplerHandleNV = nullptr;
+GLuint64 m_glGetTextureSamplerHandleNV_profile(GLuint texture,GLuint sampler)const{ProfilingScope const scope(this,1114);return (this->*(this->m_orig_glGetTextureSamplerHandleNV))(texture,sampler);}
+FunctionTable::MEMBERPFNGLDETACHSHADERPROC m_orig_glDetachShader = nullptr;
+void m_glDetachShader_profile(GLuint program,GLuint shader)const{ProfilingScope const scope(this,1115);(this->*(this->m_orig_glDetachShader))(program,shader);}
+FunctionTable::MEMBERPFNGLFINISHTEXTURESUNXPROC m_orig_glFinishTextureSUNX = nullptr;
+void m_glFinishTextureSUNX_profile()const{ProfilingScope const scope(this,1116);(this->*(this->m_orig_glFinishTextureSUNX))();}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4DVPROC m_orig_glUniformMatrix3x4dv = nullptr;
+void m_glUniformMatrix3x4dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1117);(this->*(this->m_orig_glUniformMatrix3x4dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FARBPROC m_orig_glVertexAttrib4fARB = nullptr;
+void m_glVertexAttrib4fARB_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,1118);(this->*(this->m_orig_glVertexAttrib4fARB))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETPATHCOLORGENIVNVPROC m_orig_glGetPathColorGenivNV = nullptr;
+void m_glGetPathColorGenivNV_profile(GLenum color,GLenum pname,GLint* value)const{ProfilingScope const scope(this,1119);(this->*(this->m_orig_glGetPathColorGenivNV))(color,pname,value);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCELOCATIONPROC m_orig_glGetProgramResourceLocation = nullptr;
+GLint m_glGetProgramResourceLocation_profile(GLuint program,GLenum programInterface,const GLchar* name)const{ProfilingScope const scope(this,1120);return (this->*(this->m_orig_glGetProgramResourceLocation))(program,programInterface,name);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBLFORMATPROC m_orig_glVertexArrayAttribLFormat = nullptr;
+void m_glVertexArrayAttribLFormat_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,1121);(this->*(this->m_orig_glVertexArrayAttribLFormat))(vaobj,attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERFVPROC m_orig_glGetTexLevelParameterfv = nullptr;
+void m_glGetTexLevelParameterfv_profile(GLenum target,GLint level,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1122);(this->*(this->m_orig_glGetTexLevelParameterfv))(target,level,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC m_orig_glVertexArrayVertexAttribOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1123);(this->*(this->m_orig_glVertexArrayVertexAttribOffsetEXT))(vaobj,buffer,index,size,type,normalized,stride,offset);}
+FunctionTable::MEMBERPFNGLINDEXFORMATNVPROC m_orig_glIndexFormatNV = nullptr;
+void m_glIndexFormatNV_profile(GLenum type,GLsizei stride)const{ProfilingScope const scope(this,1124);(this->*(this->m_orig_glIndexFormatNV))(type,stride);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IPROC m_orig_glMultiTexCoord3i = nullptr;
+void m_glMultiTexCoord3i_profile(GLenum target,GLint s,GLint t,GLint r)const{ProfilingScope const scope(this,1125);(this->*(this->m_orig_glMultiTexCoord3i))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC m_orig_glReplacementCodeuiVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiVertex3fvSUN_profile(const GLuint* rc,const GLfloat* v)const{ProfilingScope const scope(this,1126);(this->*(this->m_orig_glReplacementCodeuiVertex3fvSUN))(rc,v);}
+FunctionTable::MEMBERPFNGLVIEWPORTINDEXEDFVPROC m_orig_glViewportIndexedfv = nullptr;
+void m_glViewportIndexedfv_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1127);(this->*(this->m_orig_glViewportIndexedfv))(index,v);}
+FunctionTable::MEMBERPFNGLBINDBUFFERSBASEPROC m_orig_glBindBuffersBase = nullptr;
+void m_glBindBuffersBase_profile(GLenum target,GLuint first,GLsizei count,const GLuint* buffers)const{ProfilingScope const scope(this,1128);(this->*(this->m_orig_glBindBuffersBase))(target,first,count,buffers);}
+FunctionTable::MEMBERPFNGLTEXBUMPPARAMETERFVATIPROC m_orig_glTexBumpParameterfvATI = nullptr;
+void m_glTexBumpParameterfvATI_profile(GLenum pname,const GLfloat* param)const{ProfilingScope const scope(this,1129);(this->*(this->m_orig_glTexBumpParameterfvATI))(pname,param);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUIVARBPROC m_orig_glMatrixIndexuivARB = nullptr;
+void m_glMatrixIndexuivARB_profile(GLint size,const GLuint* indices)const{ProfilingScope const scope(this,1130);(this->*(this->m_orig_glMatrixIndexuivARB))(size,indices);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1HNVPROC m_orig_glVertexAttrib1hNV = nullptr;
+void m_glVertexAttrib1hNV_profile(GLuint index,GLhalfNV x)const{ProfilingScope const scope(this,1131);(this->*(this->m_orig_glVertexAttrib1hNV))(index,x);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVMESAPROC m_orig_glWindowPos3svMESA = nullptr;
+void m_glWindowPos3svMESA_profile(const GLshort* v)const{ProfilingScope const scope(this,1132);(this->*(this->m_orig_glWindowPos3svMESA))(v);}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEATIPROC m_orig_glStencilOpSeparateATI = nullptr;
+void m_glStencilOpSeparateATI_profile(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{ProfilingScope const scope(this,1133);(this->*(this->m_orig_glStencilOpSeparateATI))(face,sfail,dpfail,dppass);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSBASEVERTEXPROC m_orig_glDrawElementsBaseVertex = nullptr;
+void m_glDrawElementsBaseVertex_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{ProfilingScope const scope(this,1134);(this->*(this->m_orig_glDrawElementsBaseVertex))(mode,count,type,indices,basevertex);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONSEPARATEIARBPROC m_orig_glBlendEquationSeparateiARB = nullptr;
+void m_glBlendEquationSeparateiARB_profile(GLuint buf,GLenum modeRGB,GLenum modeAlpha)const{ProfilingScope const scope(this,1135);(this->*(this->m_orig_glBlendEquationSeparateiARB))(buf,modeRGB,modeAlpha);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FNVPROC m_orig_glVertexAttrib1fNV = nullptr;
+void m_glVertexAttrib1fNV_profile(GLuint index,GLfloat x)const{ProfilingScope const scope(this,1136);(this->*(this->m_orig_glVertexAttrib1fNV))(index,x);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2FAPPLEPROC m_orig_glMapVertexAttrib2fAPPLE = nullptr;
+void m_glMapVertexAttrib2fAPPLE_profile(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points)const{ProfilingScope const scope(this,1137);(this->*(this->m_orig_glMapVertexAttrib2fAPPLE))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC m_orig_glCompressedTextureSubImage1DEXT = nullptr;
+void m_glCompressedTextureSubImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,1138);(this->*(this->m_orig_glCompressedTextureSubImage1DEXT))(texture,target,level,xoffset,width,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERSUBDATAPROC m_orig_glClearBufferSubData = nullptr;
+void m_glClearBufferSubData_profile(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,1139);(this->*(this->m_orig_glClearBufferSubData))(target,internalformat,offset,size,format,type,data);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE1DPROC m_orig_glTexStorage1D = nullptr;
+void m_glTexStorage1D_profile(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{ProfilingScope const scope(this,1140);(this->*(this->m_orig_glTexStorage1D))(target,levels,internalformat,width);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IEXTPROC m_orig_glVertexAttribI3iEXT = nullptr;
+void m_glVertexAttribI3iEXT_profile(GLuint index,GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,1141);(this->*(this->m_orig_glVertexAttribI3iEXT))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC m_orig_glMakeTextureHandleNonResidentARB = nullptr;
+void m_glMakeTextureHandleNonResidentARB_profile(GLuint64 handle)const{ProfilingScope const scope(this,1142);(this->*(this->m_orig_glMakeTextureHandleNonResidentARB))(handle);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTARRAYAPPLEPROC m_orig_glMultiDrawElementArrayAPPLE = nullptr;
+void m_glMultiDrawElementArrayAPPLE_profile(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{ProfilingScope const scope(this,1143);(this->*(this->m_orig_glMultiDrawElementArrayAPPLE))(mode,first,count,primcount);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DATIPROC m_orig_glVertexStream4dATI = nullptr;
+void m_glVertexStream4dATI_profile(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1144);(this->*(this->m_orig_glVertexStream4dATI))(stream,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVEXTPROC m_orig_glProgramUniformMatrix2dvEXT = nullptr;
+void m_glProgramUniformMatrix2dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1145);(this->*(this->m_orig_glProgramUniformMatrix2dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2HVNVPROC m_orig_glVertexAttribs2hvNV = nullptr;
+void m_glVertexAttribs2hvNV_profile(GLuint index,GLsizei n,const GLhalfNV* v)const{ProfilingScope const scope(this,1146);(this->*(this->m_orig_glVertexAttribs2hvNV))(index,n,v);}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVPROC m_orig_glGetUniformiv = nullptr;
+void m_glGetUniformiv_profile(GLuint program,GLint location,GLint* params)const{ProfilingScope const scope(this,1147);(this->*(this->m_orig_glGetUniformiv))(program,location,params);}
+FunctionTable::MEMBERPFNGLCLIPPLANEFOESPROC m_orig_glClipPlanefOES = nullptr;
+void m_glClipPlanefOES_profile(GLenum plane,const GLfloat* equation)const{ProfilingScope const scope(this,1148);(this->*(this->m_orig_glClipPlanefOES))(plane,equation);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEPROC m_orig_glRenderbufferStorage = nullptr;
+void m_glRenderbufferStorage_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1149);(this->*(this->m_orig_glRenderbufferStorage))(target,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIPROC m_orig_glUniform4ui = nullptr;
+void m_glUniform4ui_profile(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{ProfilingScope const scope(this,1150);(this->*(this->m_orig_glUniform4ui))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLBINDFRAMEBUFFERPROC m_orig_glBindFramebuffer = nullptr;
+void m_glBindFramebuffer_profile(GLenum target,GLuint framebuffer)const{ProfilingScope const scope(this,1151);(this->*(this->m_orig_glBindFramebuffer))(target,framebuffer);}
+FunctionTable::MEMBERPFNGLVALIDATEPROGRAMARBPROC m_orig_glValidateProgramARB = nullptr;
+void m_glValidateProgramARB_profile(GLhandleARB programObj)const{ProfilingScope const scope(this,1152);(this->*(this->m_orig_glValidateProgramARB))(programObj);}
+FunctionTable::MEMBERPFNGLTEXGENFPROC m_orig_glTexGenf = nullptr;
+void m_glTexGenf_profile(GLenum coord,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1153);(this->*(this->m_orig_glTexGenf))(coord,pname,param);}
+FunctionTable::MEMBERPFNGLTEXGENDPROC m_orig_glTexGend = nullptr;
+void m_glTexGend_profile(GLenum coord,GLenum pname,GLdouble param)const{ProfilingScope const scope(this,1154);(this->*(this->m_orig_glTexGend))(coord,pname,param);}
+FunctionTable::MEMBERPFNGLTEXGENIPROC m_orig_glTexGeni = nullptr;
+void m_glTexGeni_profile(GLenum coord,GLenum pname,GLint param)const{ProfilingScope const scope(this,1155);(this->*(this->m_orig_glTexGeni))(coord,pname,param);}
+FunctionTable::MEMBERPFNGLDELETEFRAMEBUFFERSEXTPROC m_orig_glDeleteFramebuffersEXT = nullptr;
+void m_glDeleteFramebuffersEXT_profile(GLsizei n,const GLuint* framebuffers)const{ProfilingScope const scope(this,1156);(this->*(this->m_orig_glDeleteFramebuffersEXT))(n,framebuffers);}
+FunctionTable::MEMBERPFNGLRESETMINMAXEXTPROC m_orig_glResetMinmaxEXT = nullptr;
+void m_glResetMinmaxEXT_profile(GLenum target)const{ProfilingScope const scope(this,1157);(this->*(this->m_orig_glResetMinmaxEXT))(target);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVNVPROC m_orig_glVertexAttrib1fvNV = nullptr;
+void m_glVertexAttrib1fvNV_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1158);(this->*(this->m_orig_glVertexAttrib1fvNV))(index,v);}
+FunctionTable::MEMBERPFNGLISQUERYARBPROC m_orig_glIsQueryARB = nullptr;
+GLboolean m_glIsQueryARB_profile(GLuint id)const{ProfilingScope const scope(this,1159);return (this->*(this->m_orig_glIsQueryARB))(id);}
+FunctionTable::MEMBERPFNGLENABLEVARIANTCLIENTSTATEEXTPROC m_orig_glEnableVariantClientStateEXT = nullptr;
+void m_glEnableVariantClientStateEXT_profile(GLuint id)const{ProfilingScope const scope(this,1160);(this->*(this->m_orig_glEnableVariantClientStateEXT))(id);}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDPROC m_orig_glScissorIndexed = nullptr;
+void m_glScissorIndexed_profile(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1161);(this->*(this->m_orig_glScissorIndexed))(index,left,bottom,width,height);}
+FunctionTable::MEMBERPFNGLGETINVARIANTINTEGERVEXTPROC m_orig_glGetInvariantIntegervEXT = nullptr;
+void m_glGetInvariantIntegervEXT_profile(GLuint id,GLenum value,GLint* data)const{ProfilingScope const scope(this,1162);(this->*(this->m_orig_glGetInvariantIntegervEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UINVPROC m_orig_glProgramLocalParameterI4uiNV = nullptr;
+void m_glProgramLocalParameterI4uiNV_profile(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{ProfilingScope const scope(this,1163);(this->*(this->m_orig_glProgramLocalParameterI4uiNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXVOESPROC m_orig_glConvolutionParameterxvOES = nullptr;
+void m_glConvolutionParameterxvOES_profile(GLenum target,GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,1164);(this->*(this->m_orig_glConvolutionParameterxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGENFRAMEBUFFERSEXTPROC m_orig_glGenFramebuffersEXT = nullptr;
+void m_glGenFramebuffersEXT_profile(GLsizei n,GLuint* framebuffers)const{ProfilingScope const scope(this,1165);(this->*(this->m_orig_glGenFramebuffersEXT))(n,framebuffers);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYCOLOROFFSETEXTPROC m_orig_glVertexArrayColorOffsetEXT = nullptr;
+void m_glVertexArrayColorOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1166);(this->*(this->m_orig_glVertexArrayColorOffsetEXT))(vaobj,buffer,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IVARBPROC m_orig_glMultiTexCoord3ivARB = nullptr;
+void m_glMultiTexCoord3ivARB_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,1167);(this->*(this->m_orig_glMultiTexCoord3ivARB))(target,v);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFEXTPROC m_orig_glVertexWeightfEXT = nullptr;
+void m_glVertexWeightfEXT_profile(GLfloat weight)const{ProfilingScope const scope(this,1168);(this->*(this->m_orig_glVertexWeightfEXT))(weight);}
+FunctionTable::MEMBERPFNGLRASTERPOS4DVPROC m_orig_glRasterPos4dv = nullptr;
+void m_glRasterPos4dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1169);(this->*(this->m_orig_glRasterPos4dv))(v);}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTARBPROC m_orig_glIsTextureHandleResidentARB = nullptr;
+GLboolean m_glIsTextureHandleResidentARB_profile(GLuint64 handle)const{ProfilingScope const scope(this,1170);return (this->*(this->m_orig_glIsTextureHandleResidentARB))(handle);}
+FunctionTable::MEMBERPFNGLRASTERPOS2DVPROC m_orig_glRasterPos2dv = nullptr;
+void m_glRasterPos2dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1171);(this->*(this->m_orig_glRasterPos2dv))(v);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IVMESAPROC m_orig_glWindowPos4ivMESA = nullptr;
+void m_glWindowPos4ivMESA_profile(const GLint* v)const{ProfilingScope const scope(this,1172);(this->*(this->m_orig_glWindowPos4ivMESA))(v);}
+FunctionTable::MEMBERPFNGLGETVARIANTPOINTERVEXTPROC m_orig_glGetVariantPointervEXT = nullptr;
+void m_glGetVariantPointervEXT_profile(GLuint id,GLenum value,void** data)const{ProfilingScope const scope(this,1173);(this->*(this->m_orig_glGetVariantPointervEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEEXTPROC m_orig_glMapNamedBufferRangeEXT = nullptr;
+void* m_glMapNamedBufferRangeEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{ProfilingScope const scope(this,1174);return (this->*(this->m_orig_glMapNamedBufferRangeEXT))(buffer,offset,length,access);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUI64VARBPROC m_orig_glGetnUniformui64vARB = nullptr;
+void m_glGetnUniformui64vARB_profile(GLuint program,GLint location,GLsizei bufSize,GLuint64* params)const{ProfilingScope const scope(this,1175);(this->*(this->m_orig_glGetnUniformui64vARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMVPROC m_orig_glCreateShaderProgramv = nullptr;
+GLuint m_glCreateShaderProgramv_profile(GLenum type,GLsizei count,const GLchar*const* strings)const{ProfilingScope const scope(this,1176);return (this->*(this->m_orig_glCreateShaderProgramv))(type,count,strings);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVPROC m_orig_glGetQueryObjectiv = nullptr;
+void m_glGetQueryObjectiv_profile(GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1177);(this->*(this->m_orig_glGetQueryObjectiv))(id,pname,params);}
+FunctionTable::MEMBERPFNGLMAXSHADERCOMPILERTHREADSKHRPROC m_orig_glMaxShaderCompilerThreadsKHR = nullptr;
+void m_glMaxShaderCompilerThreadsKHR_profile(GLuint count)const{ProfilingScope const scope(this,1178);(this->*(this->m_orig_glMaxShaderCompilerThreadsKHR))(count);}
+FunctionTable::MEMBERPFNGLPNTRIANGLESFATIPROC m_orig_glPNTrianglesfATI = nullptr;
+void m_glPNTrianglesfATI_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1179);(this->*(this->m_orig_glPNTrianglesfATI))(pname,param);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUSSUNPROC m_orig_glGlobalAlphaFactorusSUN = nullptr;
+void m_glGlobalAlphaFactorusSUN_profile(GLushort factor)const{ProfilingScope const scope(this,1180);(this->*(this->m_orig_glGlobalAlphaFactorusSUN))(factor);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVNVPROC m_orig_glVertexAttrib3dvNV = nullptr;
+void m_glVertexAttrib3dvNV_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1181);(this->*(this->m_orig_glVertexAttrib3dvNV))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SARBPROC m_orig_glMultiTexCoord3sARB = nullptr;
+void m_glMultiTexCoord3sARB_profile(GLenum target,GLshort s,GLshort t,GLshort r)const{ProfilingScope const scope(this,1182);(this->*(this->m_orig_glMultiTexCoord3sARB))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPPROC m_orig_glGenerateMipmap = nullptr;
+void m_glGenerateMipmap_profile(GLenum target)const{ProfilingScope const scope(this,1183);(this->*(this->m_orig_glGenerateMipmap))(target);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC m_orig_glCompressedTextureSubImage2D = nullptr;
+void m_glCompressedTextureSubImage2D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,1184);(this->*(this->m_orig_glCompressedTextureSubImage2D))(texture,level,xoffset,yoffset,width,height,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_orig_glNamedRenderbufferStorageMultisampleEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleEXT_profile(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1185);(this->*(this->m_orig_glNamedRenderbufferStorageMultisampleEXT))(renderbuffer,samples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETCLAMPEXTPROC m_orig_glPolygonOffsetClampEXT = nullptr;
+void m_glPolygonOffsetClampEXT_profile(GLfloat factor,GLfloat units,GLfloat clamp)const{ProfilingScope const scope(this,1186);(this->*(this->m_orig_glPolygonOffsetClampEXT))(factor,units,clamp);}
+FunctionTable::MEMBERPFNGLTEXTURERANGEAPPLEPROC m_orig_glTextureRangeAPPLE = nullptr;
+void m_glTextureRangeAPPLE_profile(GLenum target,GLsizei length,const void* pointer)const{ProfilingScope const scope(this,1187);(this->*(this->m_orig_glTextureRangeAPPLE))(target,length,pointer);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONINDEXEDAMDPROC m_orig_glBlendEquationIndexedAMD = nullptr;
+void m_glBlendEquationIndexedAMD_profile(GLuint buf,GLenum mode)const{ProfilingScope const scope(this,1188);(this->*(this->m_orig_glBlendEquationIndexedAMD))(buf,mode);}
+FunctionTable::MEMBERPFNGLTEXCOORD2DPROC m_orig_glTexCoord2d = nullptr;
+void m_glTexCoord2d_profile(GLdouble s,GLdouble t)const{ProfilingScope const scope(this,1189);(this->*(this->m_orig_glTexCoord2d))(s,t);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIPROC m_orig_glPointParameteri = nullptr;
+void m_glPointParameteri_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1190);(this->*(this->m_orig_glPointParameteri))(pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FPROC m_orig_glTexCoord2f = nullptr;
+void m_glTexCoord2f_profile(GLfloat s,GLfloat t)const{ProfilingScope const scope(this,1191);(this->*(this->m_orig_glTexCoord2f))(s,t);}
+FunctionTable::MEMBERPFNGLGETUNSIGNEDBYTEI_VEXTPROC m_orig_glGetUnsignedBytei_vEXT = nullptr;
+void m_glGetUnsignedBytei_vEXT_profile(GLenum target,GLuint index,GLubyte* data)const{ProfilingScope const scope(this,1192);(this->*(this->m_orig_glGetUnsignedBytei_vEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLCOLOR4IVPROC m_orig_glColor4iv = nullptr;
+void m_glColor4iv_profile(const GLint* v)const{ProfilingScope const scope(this,1193);(this->*(this->m_orig_glColor4iv))(v);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFERRANGEPROC m_orig_glMapNamedBufferRange = nullptr;
+void* m_glMapNamedBufferRange_profile(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access)const{ProfilingScope const scope(this,1194);return (this->*(this->m_orig_glMapNamedBufferRange))(buffer,offset,length,access);}
+FunctionTable::MEMBERPFNGLUNMAPBUFFERPROC m_orig_glUnmapBuffer = nullptr;
+GLboolean m_glUnmapBuffer_profile(GLenum target)const{ProfilingScope const scope(this,1195);return (this->*(this->m_orig_glUnmapBuffer))(target);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKEXTPROC m_orig_glSampleMaskEXT = nullptr;
+void m_glSampleMaskEXT_profile(GLclampf value,GLboolean invert)const{ProfilingScope const scope(this,1196);(this->*(this->m_orig_glSampleMaskEXT))(value,invert);}
+FunctionTable::MEMBERPFNGLTEXCOORD2IPROC m_orig_glTexCoord2i = nullptr;
+void m_glTexCoord2i_profile(GLint s,GLint t)const{ProfilingScope const scope(this,1197);(this->*(this->m_orig_glTexCoord2i))(s,t);}
+FunctionTable::MEMBERPFNGLTEXCOORD1XVOESPROC m_orig_glTexCoord1xvOES = nullptr;
+void m_glTexCoord1xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,1198);(this->*(this->m_orig_glTexCoord1xvOES))(coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SARBPROC m_orig_glVertexAttrib1sARB = nullptr;
+void m_glVertexAttrib1sARB_profile(GLuint index,GLshort x)const{ProfilingScope const scope(this,1199);(this->*(this->m_orig_glVertexAttrib1sARB))(index,x);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYIVPROC m_orig_glGetVertexArrayiv = nullptr;
+void m_glGetVertexArrayiv_profile(GLuint vaobj,GLenum pname,GLint* param)const{ProfilingScope const scope(this,1200);(this->*(this->m_orig_glGetVertexArrayiv))(vaobj,pname,param);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DVNVPROC m_orig_glProgramParameter4dvNV = nullptr;
+void m_glProgramParameter4dvNV_profile(GLenum target,GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1201);(this->*(this->m_orig_glProgramParameter4dvNV))(target,index,v);}
+FunctionTable::MEMBERPFNGLTEXCOORD2SPROC m_orig_glTexCoord2s = nullptr;
+void m_glTexCoord2s_profile(GLshort s,GLshort t)const{ProfilingScope const scope(this,1202);(this->*(this->m_orig_glTexCoord2s))(s,t);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIUIVEXTPROC m_orig_glTextureParameterIuivEXT = nullptr;
+void m_glTextureParameterIuivEXT_profile(GLuint texture,GLenum target,GLenum pname,const GLuint* params)const{ProfilingScope const scope(this,1203);(this->*(this->m_orig_glTextureParameterIuivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVSGIPROC m_orig_glGetColorTableParameterfvSGI = nullptr;
+void m_glGetColorTableParameterfvSGI_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1204);(this->*(this->m_orig_glGetColorTableParameterfvSGI))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4DVPROC m_orig_glTexCoord4dv = nullptr;
+void m_glTexCoord4dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1205);(this->*(this->m_orig_glTexCoord4dv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVNVPROC m_orig_glVertexAttrib1svNV = nullptr;
+void m_glVertexAttrib1svNV_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,1206);(this->*(this->m_orig_glVertexAttrib1svNV))(index,v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC m_orig_glNamedFramebufferTextureFaceEXT = nullptr;
+void m_glNamedFramebufferTextureFaceEXT_profile(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face)const{ProfilingScope const scope(this,1207);(this->*(this->m_orig_glNamedFramebufferTextureFaceEXT))(framebuffer,attachment,texture,level,face);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VNVPROC m_orig_glProgramUniform2ui64vNV = nullptr;
+void m_glProgramUniform2ui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1208);(this->*(this->m_orig_glProgramUniform2ui64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHNVPROC m_orig_glStencilFillPathNV = nullptr;
+void m_glStencilFillPathNV_profile(GLuint path,GLenum fillMode,GLuint mask)const{ProfilingScope const scope(this,1209);(this->*(this->m_orig_glStencilFillPathNV))(path,fillMode,mask);}
+FunctionTable::MEMBERPFNGLNORMAL3DVPROC m_orig_glNormal3dv = nullptr;
+void m_glNormal3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1210);(this->*(this->m_orig_glNormal3dv))(v);}
+FunctionTable::MEMBERPFNGLRELEASESHADERCOMPILERPROC m_orig_glReleaseShaderCompiler = nullptr;
+void m_glReleaseShaderCompiler_profile()const{ProfilingScope const scope(this,1211);(this->*(this->m_orig_glReleaseShaderCompiler))();}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DEXTPROC m_orig_glTexStorageMem3DEXT = nullptr;
+void m_glTexStorageMem3DEXT_profile(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,1212);(this->*(this->m_orig_glTexStorageMem3DEXT))(target,levels,internalFormat,width,height,depth,memory,offset);}
+FunctionTable::MEMBERPFNGLTEXCOORD3BVOESPROC m_orig_glTexCoord3bvOES = nullptr;
+void m_glTexCoord3bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,1213);(this->*(this->m_orig_glTexCoord3bvOES))(coords);}
+FunctionTable::MEMBERPFNGLISVERTEXATTRIBENABLEDAPPLEPROC m_orig_glIsVertexAttribEnabledAPPLE = nullptr;
+GLboolean m_glIsVertexAttribEnabledAPPLE_profile(GLuint index,GLenum pname)const{ProfilingScope const scope(this,1214);return (this->*(this->m_orig_glIsVertexAttribEnabledAPPLE))(index,pname);}
+FunctionTable::MEMBERPFNGLTEXCOORD1DVPROC m_orig_glTexCoord1dv = nullptr;
+void m_glTexCoord1dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1215);(this->*(this->m_orig_glTexCoord1dv))(v);}
+FunctionTable::MEMBERPFNGLREADPIXELSPROC m_orig_glReadPixels = nullptr;
+void m_glReadPixels_profile(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels)const{ProfilingScope const scope(this,1216);(this->*(this->m_orig_glReadPixels))(x,y,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3IVPROC m_orig_glVertexAttribI3iv = nullptr;
+void m_glVertexAttribI3iv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,1217);(this->*(this->m_orig_glVertexAttribI3iv))(index,v);}
+FunctionTable::MEMBERPFNGLSETFENCEAPPLEPROC m_orig_glSetFenceAPPLE = nullptr;
+void m_glSetFenceAPPLE_profile(GLuint fence)const{ProfilingScope const scope(this,1218);(this->*(this->m_orig_glSetFenceAPPLE))(fence);}
+FunctionTable::MEMBERPFNGLWEIGHTSVARBPROC m_orig_glWeightsvARB = nullptr;
+void m_glWeightsvARB_profile(GLint size,const GLshort* weights)const{ProfilingScope const scope(this,1219);(this->*(this->m_orig_glWeightsvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLSHADEMODELPROC m_orig_glShadeModel = nullptr;
+void m_glShadeModel_profile(GLenum mode)const{ProfilingScope const scope(this,1220);(this->*(this->m_orig_glShadeModel))(mode);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM3DMULTISAMPLEEXTPROC m_orig_glTextureStorageMem3DMultisampleEXT = nullptr;
+void m_glTextureStorageMem3DMultisampleEXT_profile(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,1221);(this->*(this->m_orig_glTextureStorageMem3DMultisampleEXT))(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+FunctionTable::MEMBERPFNGLMAPGRID1DPROC m_orig_glMapGrid1d = nullptr;
+void m_glMapGrid1d_profile(GLint un,GLdouble u1,GLdouble u2)const{ProfilingScope const scope(this,1222);(this->*(this->m_orig_glMapGrid1d))(un,u1,u2);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERIVEXTPROC m_orig_glGetHistogramParameterivEXT = nullptr;
+void m_glGetHistogramParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1223);(this->*(this->m_orig_glGetHistogramParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCONSERVATIVERASTERPARAMETERINVPROC m_orig_glConservativeRasterParameteriNV = nullptr;
+void m_glConservativeRasterParameteriNV_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1224);(this->*(this->m_orig_glConservativeRasterParameteriNV))(pname,param);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAPROC m_orig_glClearNamedBufferData = nullptr;
+void m_glClearNamedBufferData_profile(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,1225);(this->*(this->m_orig_glClearNamedBufferData))(buffer,internalformat,format,type,data);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFPROC m_orig_glClearDepthf = nullptr;
+void m_glClearDepthf_profile(GLfloat d)const{ProfilingScope const scope(this,1226);(this->*(this->m_orig_glClearDepthf))(d);}
+FunctionTable::MEMBERPFNGLCREATEPERFQUERYINTELPROC m_orig_glCreatePerfQueryINTEL = nullptr;
+void m_glCreatePerfQueryINTEL_profile(GLuint queryId,GLuint* queryHandle)const{ProfilingScope const scope(this,1227);(this->*(this->m_orig_glCreatePerfQueryINTEL))(queryId,queryHandle);}
+FunctionTable::MEMBERPFNGLFOGCOORDFEXTPROC m_orig_glFogCoordfEXT = nullptr;
+void m_glFogCoordfEXT_profile(GLfloat coord)const{ProfilingScope const scope(this,1228);(this->*(this->m_orig_glFogCoordfEXT))(coord);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DARBPROC m_orig_glVertexAttrib2dARB = nullptr;
+void m_glVertexAttrib2dARB_profile(GLuint index,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1229);(this->*(this->m_orig_glVertexAttrib2dARB))(index,x,y);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DARBPROC m_orig_glMultiTexCoord4dARB = nullptr;
+void m_glMultiTexCoord4dARB_profile(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{ProfilingScope const scope(this,1230);(this->*(this->m_orig_glMultiTexCoord4dARB))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLREADNPIXELSARBPROC m_orig_glReadnPixelsARB = nullptr;
+void m_glReadnPixelsARB_profile(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{ProfilingScope const scope(this,1231);(this->*(this->m_orig_glReadnPixelsARB))(x,y,width,height,format,type,bufSize,data);}
+FunctionTable::MEMBERPFNGLMULTITEXBUFFEREXTPROC m_orig_glMultiTexBufferEXT = nullptr;
+void m_glMultiTexBufferEXT_profile(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,1232);(this->*(this->m_orig_glMultiTexBufferEXT))(texunit,target,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DVMESAPROC m_orig_glWindowPos4dvMESA = nullptr;
+void m_glWindowPos4dvMESA_profile(const GLdouble* v)const{ProfilingScope const scope(this,1233);(this->*(this->m_orig_glWindowPos4dvMESA))(v);}
+FunctionTable::MEMBERPFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC m_orig_glInvalidateNamedFramebufferData = nullptr;
+void m_glInvalidateNamedFramebufferData_profile(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments)const{ProfilingScope const scope(this,1234);(this->*(this->m_orig_glInvalidateNamedFramebufferData))(framebuffer,numAttachments,attachments);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTERLISTIBMPROC m_orig_glSecondaryColorPointerListIBM = nullptr;
+void m_glSecondaryColorPointerListIBM_profile(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,1235);(this->*(this->m_orig_glSecondaryColorPointerListIBM))(size,type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLRECTIVPROC m_orig_glRectiv = nullptr;
+void m_glRectiv_profile(const GLint* v1,const GLint* v2)const{ProfilingScope const scope(this,1236);(this->*(this->m_orig_glRectiv))(v1,v2);}
+FunctionTable::MEMBERPFNGLCOLORP4UIPROC m_orig_glColorP4ui = nullptr;
+void m_glColorP4ui_profile(GLenum type,GLuint color)const{ProfilingScope const scope(this,1237);(this->*(this->m_orig_glColorP4ui))(type,color);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMSTAGESPROC m_orig_glUseProgramStages = nullptr;
+void m_glUseProgramStages_profile(GLuint pipeline,GLbitfield stages,GLuint program)const{ProfilingScope const scope(this,1238);(this->*(this->m_orig_glUseProgramStages))(pipeline,stages,program);}
+FunctionTable::MEMBERPFNGLRASTERPOS3DVPROC m_orig_glRasterPos3dv = nullptr;
+void m_glRasterPos3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1239);(this->*(this->m_orig_glRasterPos3dv))(v);}
+FunctionTable::MEMBERPFNGLPATHTEXGENNVPROC m_orig_glPathTexGenNV = nullptr;
+void m_glPathTexGenNV_profile(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs)const{ProfilingScope const scope(this,1240);(this->*(this->m_orig_glPathTexGenNV))(texCoordSet,genMode,components,coeffs);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVIATIPROC m_orig_glVertexBlendEnviATI = nullptr;
+void m_glVertexBlendEnviATI_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1241);(this->*(this->m_orig_glVertexBlendEnviATI))(pname,param);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64ARBPROC m_orig_glUniform3i64ARB = nullptr;
+void m_glUniform3i64ARB_profile(GLint location,GLint64 x,GLint64 y,GLint64 z)const{ProfilingScope const scope(this,1242);(this->*(this->m_orig_glUniform3i64ARB))(location,x,y,z);}
+FunctionTable::MEMBERPFNGLLOADMATRIXFPROC m_orig_glLoadMatrixf = nullptr;
+void m_glLoadMatrixf_profile(const GLfloat* m)const{ProfilingScope const scope(this,1243);(this->*(this->m_orig_glLoadMatrixf))(m);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DEXTPROC m_orig_glProgramUniform2dEXT = nullptr;
+void m_glProgramUniform2dEXT_profile(GLuint program,GLint location,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1244);(this->*(this->m_orig_glProgramUniform2dEXT))(program,location,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVPROC m_orig_glVertexAttribI4iv = nullptr;
+void m_glVertexAttribI4iv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,1245);(this->*(this->m_orig_glVertexAttribI4iv))(index,v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC m_orig_glNamedFramebufferDrawBuffer = nullptr;
+void m_glNamedFramebufferDrawBuffer_profile(GLuint framebuffer,GLenum buf)const{ProfilingScope const scope(this,1246);(this->*(this->m_orig_glNamedFramebufferDrawBuffer))(framebuffer,buf);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVPROC m_orig_glColor4ubv = nullptr;
+void m_glColor4ubv_profile(const GLubyte* v)const{ProfilingScope const scope(this,1247);(this->*(this->m_orig_glColor4ubv))(v);}
+FunctionTable::MEMBERPFNGLCOLOR3HVNVPROC m_orig_glColor3hvNV = nullptr;
+void m_glColor3hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1248);(this->*(this->m_orig_glColor3hvNV))(v);}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERFVNVPROC m_orig_glGetMapAttribParameterfvNV = nullptr;
+void m_glGetMapAttribParameterfvNV_profile(GLenum target,GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1249);(this->*(this->m_orig_glGetMapAttribParameterfvNV))(target,index,pname,params);}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAPROC m_orig_glGetBufferSubData = nullptr;
+void m_glGetBufferSubData_profile(GLenum target,GLintptr offset,GLsizeiptr size,void* data)const{ProfilingScope const scope(this,1250);(this->*(this->m_orig_glGetBufferSubData))(target,offset,size,data);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLDVPROC m_orig_glGetVertexAttribLdv = nullptr;
+void m_glGetVertexAttribLdv_profile(GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1251);(this->*(this->m_orig_glGetVertexAttribLdv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVPROC m_orig_glGetnUniformuiv = nullptr;
+void m_glGetnUniformuiv_profile(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{ProfilingScope const scope(this,1252);(this->*(this->m_orig_glGetnUniformuiv))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VNVPROC m_orig_glGetUniformui64vNV = nullptr;
+void m_glGetUniformui64vNV_profile(GLuint program,GLint location,GLuint64EXT* params)const{ProfilingScope const scope(this,1253);(this->*(this->m_orig_glGetUniformui64vNV))(program,location,params);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC m_orig_glNamedRenderbufferStorageEXT = nullptr;
+void m_glNamedRenderbufferStorageEXT_profile(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1254);(this->*(this->m_orig_glNamedRenderbufferStorageEXT))(renderbuffer,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DNVPROC m_orig_glVertexAttrib3dNV = nullptr;
+void m_glVertexAttrib3dNV_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1255);(this->*(this->m_orig_glVertexAttrib3dNV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE1DEXTPROC m_orig_glTextureStorage1DEXT = nullptr;
+void m_glTextureStorage1DEXT_profile(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width)const{ProfilingScope const scope(this,1256);(this->*(this->m_orig_glTextureStorage1DEXT))(texture,target,levels,internalformat,width);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERISGISPROC m_orig_glPixelTexGenParameteriSGIS = nullptr;
+void m_glPixelTexGenParameteriSGIS_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1257);(this->*(this->m_orig_glPixelTexGenParameteriSGIS))(pname,param);}
+FunctionTable::MEMBERPFNGLCOLORTABLEEXTPROC m_orig_glColorTableEXT = nullptr;
+void m_glColorTableEXT_profile(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table)const{ProfilingScope const scope(this,1258);(this->*(this->m_orig_glColorTableEXT))(target,internalFormat,width,format,type,table);}
+FunctionTable::MEMBERPFNGLGENBUFFERSPROC m_orig_glGenBuffers = nullptr;
+void m_glGenBuffers_profile(GLsizei n,GLuint* buffers)const{ProfilingScope const scope(this,1259);(this->*(this->m_orig_glGenBuffers))(n,buffers);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XVOESPROC m_orig_glMultiTexCoord3xvOES = nullptr;
+void m_glMultiTexCoord3xvOES_profile(GLenum texture,const GLfixed* coords)const{ProfilingScope const scope(this,1260);(this->*(this->m_orig_glMultiTexCoord3xvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLEXECUTEPROGRAMNVPROC m_orig_glExecuteProgramNV = nullptr;
+void m_glExecuteProgramNV_profile(GLenum target,GLuint id,const GLfloat* params)const{ProfilingScope const scope(this,1261);(this->*(this->m_orig_glExecuteProgramNV))(target,id,params);}
+FunctionTable::MEMBERPFNGLVARIANTARRAYOBJECTATIPROC m_orig_glVariantArrayObjectATI = nullptr;
+void m_glVariantArrayObjectATI_profile(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{ProfilingScope const scope(this,1262);(this->*(this->m_orig_glVariantArrayObjectATI))(id,type,stride,buffer,offset);}
+FunctionTable::MEMBERPFNGLCOLOR3XVOESPROC m_orig_glColor3xvOES = nullptr;
+void m_glColor3xvOES_profile(const GLfixed* components)const{ProfilingScope const scope(this,1263);(this->*(this->m_orig_glColor3xvOES))(components);}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERARBPROC m_orig_glGetnConvolutionFilterARB = nullptr;
+void m_glGetnConvolutionFilterARB_profile(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{ProfilingScope const scope(this,1264);(this->*(this->m_orig_glGetnConvolutionFilterARB))(target,format,type,bufSize,image);}
+FunctionTable::MEMBERPFNGLNORMALFORMATNVPROC m_orig_glNormalFormatNV = nullptr;
+void m_glNormalFormatNV_profile(GLenum type,GLsizei stride)const{ProfilingScope const scope(this,1265);(this->*(this->m_orig_glNormalFormatNV))(type,stride);}
+FunctionTable::MEMBERPFNGLGETINVARIANTFLOATVEXTPROC m_orig_glGetInvariantFloatvEXT = nullptr;
+void m_glGetInvariantFloatvEXT_profile(GLuint id,GLenum value,GLfloat* data)const{ProfilingScope const scope(this,1266);(this->*(this->m_orig_glGetInvariantFloatvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERIVPROC m_orig_glClearNamedFramebufferiv = nullptr;
+void m_glClearNamedFramebufferiv_profile(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value)const{ProfilingScope const scope(this,1267);(this->*(this->m_orig_glClearNamedFramebufferiv))(framebuffer,buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DPROC m_orig_glTexImage3D = nullptr;
+void m_glTexImage3D_profile(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,1268);(this->*(this->m_orig_glTexImage3D))(target,level,internalFormat,width,height,depth,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGENSAMPLERSPROC m_orig_glGenSamplers = nullptr;
+void m_glGenSamplers_profile(GLsizei count,GLuint* samplers)const{ProfilingScope const scope(this,1269);(this->*(this->m_orig_glGenSamplers))(count,samplers);}
+FunctionTable::MEMBERPFNGLISFRAMEBUFFERPROC m_orig_glIsFramebuffer = nullptr;
+GLboolean m_glIsFramebuffer_profile(GLuint framebuffer)const{ProfilingScope const scope(this,1270);return (this->*(this->m_orig_glIsFramebuffer))(framebuffer);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVEXTPROC m_orig_glProgramUniform3dvEXT = nullptr;
+void m_glProgramUniform3dvEXT_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,1271);(this->*(this->m_orig_glProgramUniform3dvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVNVPROC m_orig_glGetVertexAttribfvNV = nullptr;
+void m_glGetVertexAttribfvNV_profile(GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1272);(this->*(this->m_orig_glGetVertexAttribfvNV))(index,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYAPPLEPROC m_orig_glDrawRangeElementArrayAPPLE = nullptr;
+void m_glDrawRangeElementArrayAPPLE_profile(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count)const{ProfilingScope const scope(this,1273);(this->*(this->m_orig_glDrawRangeElementArrayAPPLE))(mode,start,end,first,count);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64NVPROC m_orig_glUniform3i64NV = nullptr;
+void m_glUniform3i64NV_profile(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{ProfilingScope const scope(this,1274);(this->*(this->m_orig_glUniform3i64NV))(location,x,y,z);}
+FunctionTable::MEMBERPFNGLMATRIXPOPEXTPROC m_orig_glMatrixPopEXT = nullptr;
+void m_glMatrixPopEXT_profile(GLenum mode)const{ProfilingScope const scope(this,1275);(this->*(this->m_orig_glMatrixPopEXT))(mode);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SATIPROC m_orig_glVertexStream1sATI = nullptr;
+void m_glVertexStream1sATI_profile(GLenum stream,GLshort x)const{ProfilingScope const scope(this,1276);(this->*(this->m_orig_glVertexStream1sATI))(stream,x);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVARBPROC m_orig_glGetnPixelMapuivARB = nullptr;
+void m_glGetnPixelMapuivARB_profile(GLenum map,GLsizei bufSize,GLuint* values)const{ProfilingScope const scope(this,1277);(this->*(this->m_orig_glGetnPixelMapuivARB))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLMULTITEXENVIEXTPROC m_orig_glMultiTexEnviEXT = nullptr;
+void m_glMultiTexEnviEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,1278);(this->*(this->m_orig_glMultiTexEnviEXT))(texunit,target,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IEXTPROC m_orig_glVertexAttribI2iEXT = nullptr;
+void m_glVertexAttribI2iEXT_profile(GLuint index,GLint x,GLint y)const{ProfilingScope const scope(this,1279);(this->*(this->m_orig_glVertexAttribI2iEXT))(index,x,y);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FVNVPROC m_orig_glProgramParameter4fvNV = nullptr;
+void m_glProgramParameter4fvNV_profile(GLenum target,GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1280);(this->*(this->m_orig_glProgramParameter4fvNV))(target,index,v);}
+FunctionTable::MEMBERPFNGLWAITSEMAPHOREEXTPROC m_orig_glWaitSemaphoreEXT = nullptr;
+void m_glWaitSemaphoreEXT_profile(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* srcLayouts)const{ProfilingScope const scope(this,1281);(this->*(this->m_orig_glWaitSemaphoreEXT))(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glNamedFramebufferSampleLocationsfvNV = nullptr;
+void m_glNamedFramebufferSampleLocationsfvNV_profile(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,1282);(this->*(this->m_orig_glNamedFramebufferSampleLocationsfvNV))(framebuffer,start,count,v);}
+FunctionTable::MEMBERPFNGLTEXCOORDP4UIVPROC m_orig_glTexCoordP4uiv = nullptr;
+void m_glTexCoordP4uiv_profile(GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,1283);(this->*(this->m_orig_glTexCoordP4uiv))(type,coords);}
+FunctionTable::MEMBERPFNGLRECTXVOESPROC m_orig_glRectxvOES = nullptr;
+void m_glRectxvOES_profile(const GLfixed* v1,const GLfixed* v2)const{ProfilingScope const scope(this,1284);(this->*(this->m_orig_glRectxvOES))(v1,v2);}
+FunctionTable::MEMBERPFNGLGETVARIANTINTEGERVEXTPROC m_orig_glGetVariantIntegervEXT = nullptr;
+void m_glGetVariantIntegervEXT_profile(GLuint id,GLenum value,GLint* data)const{ProfilingScope const scope(this,1285);(this->*(this->m_orig_glGetVariantIntegervEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLDELETELISTSPROC m_orig_glDeleteLists = nullptr;
+void m_glDeleteLists_profile(GLuint list,GLsizei range)const{ProfilingScope const scope(this,1286);(this->*(this->m_orig_glDeleteLists))(list,range);}
+FunctionTable::MEMBERPFNGLTEXGENDVPROC m_orig_glTexGendv = nullptr;
+void m_glTexGendv_profile(GLenum coord,GLenum pname,const GLdouble* params)const{ProfilingScope const scope(this,1287);(this->*(this->m_orig_glTexGendv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXP2UIVPROC m_orig_glVertexP2uiv = nullptr;
+void m_glVertexP2uiv_profile(GLenum type,const GLuint* value)const{ProfilingScope const scope(this,1288);(this->*(this->m_orig_glVertexP2uiv))(type,value);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSAMDPROC m_orig_glGetPerfMonitorGroupsAMD = nullptr;
+void m_glGetPerfMonitorGroupsAMD_profile(GLint* numGroups,GLsizei groupsSize,GLuint* groups)const{ProfilingScope const scope(this,1289);(this->*(this->m_orig_glGetPerfMonitorGroupsAMD))(numGroups,groupsSize,groups);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFARBPROC m_orig_glMultTransposeMatrixfARB = nullptr;
+void m_glMultTransposeMatrixfARB_profile(const GLfloat* m)const{ProfilingScope const scope(this,1290);(this->*(this->m_orig_glMultTransposeMatrixfARB))(m);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVEXTPROC m_orig_glVertexAttribI2ivEXT = nullptr;
+void m_glVertexAttribI2ivEXT_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,1291);(this->*(this->m_orig_glVertexAttribI2ivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor4fNormal3fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,1292);(this->*(this->m_orig_glReplacementCodeuiColor4fNormal3fVertex3fvSUN))(rc,c,n,v);}
+FunctionTable::MEMBERPFNGLDELETESTATESNVPROC m_orig_glDeleteStatesNV = nullptr;
+void m_glDeleteStatesNV_profile(GLsizei n,const GLuint* states)const{ProfilingScope const scope(this,1293);(this->*(this->m_orig_glDeleteStatesNV))(n,states);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERI64VPROC m_orig_glGetBufferParameteri64v = nullptr;
+void m_glGetBufferParameteri64v_profile(GLenum target,GLenum pname,GLint64* params)const{ProfilingScope const scope(this,1294);(this->*(this->m_orig_glGetBufferParameteri64v))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVPROC m_orig_glProgramUniform4dv = nullptr;
+void m_glProgramUniform4dv_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,1295);(this->*(this->m_orig_glProgramUniform4dv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTEREXTPROC m_orig_glEdgeFlagPointerEXT = nullptr;
+void m_glEdgeFlagPointerEXT_profile(GLsizei stride,GLsizei count,const GLboolean* pointer)const{ProfilingScope const scope(this,1296);(this->*(this->m_orig_glEdgeFlagPointerEXT))(stride,count,pointer);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC m_orig_glVideoCaptureStreamParameterivNV = nullptr;
+void m_glVideoCaptureStreamParameterivNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1297);(this->*(this->m_orig_glVideoCaptureStreamParameterivNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IATIPROC m_orig_glVertexStream4iATI = nullptr;
+void m_glVertexStream4iATI_profile(GLenum stream,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,1298);(this->*(this->m_orig_glVertexStream4iATI))(stream,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVDPAUFININVPROC m_orig_glVDPAUFiniNV = nullptr;
+void m_glVDPAUFiniNV_profile()const{ProfilingScope const scope(this,1299);(this->*(this->m_orig_glVDPAUFiniNV))();}
+FunctionTable::MEMBERPFNGLMAKEBUFFERNONRESIDENTNVPROC m_orig_glMakeBufferNonResidentNV = nullptr;
+void m_glMakeBufferNonResidentNV_profile(GLenum target)const{ProfilingScope const scope(this,1300);(this->*(this->m_orig_glMakeBufferNonResidentNV))(target);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64ARBPROC m_orig_glUniform1ui64ARB = nullptr;
+void m_glUniform1ui64ARB_profile(GLint location,GLuint64 x)const{ProfilingScope const scope(this,1301);(this->*(this->m_orig_glUniform1ui64ARB))(location,x);}
+FunctionTable::MEMBERPFNGLSTENCILSTROKEPATHNVPROC m_orig_glStencilStrokePathNV = nullptr;
+void m_glStencilStrokePathNV_profile(GLuint path,GLint reference,GLuint mask)const{ProfilingScope const scope(this,1302);(this->*(this->m_orig_glStencilStrokePathNV))(path,reference,mask);}
+FunctionTable::MEMBERPFNGLVARIANTUIVEXTPROC m_orig_glVariantuivEXT = nullptr;
+void m_glVariantuivEXT_profile(GLuint id,const GLuint* addr)const{ProfilingScope const scope(this,1303);(this->*(this->m_orig_glVariantuivEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE3DEXTPROC m_orig_glCopyTexSubImage3DEXT = nullptr;
+void m_glCopyTexSubImage3DEXT_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1304);(this->*(this->m_orig_glCopyTexSubImage3DEXT))(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERISGIXPROC m_orig_glSpriteParameteriSGIX = nullptr;
+void m_glSpriteParameteriSGIX_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1305);(this->*(this->m_orig_glSpriteParameteriSGIX))(pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SARBPROC m_orig_glMultiTexCoord1sARB = nullptr;
+void m_glMultiTexCoord1sARB_profile(GLenum target,GLshort s)const{ProfilingScope const scope(this,1306);(this->*(this->m_orig_glMultiTexCoord1sARB))(target,s);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVPROC m_orig_glConvolutionParameterfv = nullptr;
+void m_glConvolutionParameterfv_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1307);(this->*(this->m_orig_glConvolutionParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLMAKETEXTUREHANDLERESIDENTNVPROC m_orig_glMakeTextureHandleResidentNV = nullptr;
+void m_glMakeTextureHandleResidentNV_profile(GLuint64 handle)const{ProfilingScope const scope(this,1308);(this->*(this->m_orig_glMakeTextureHandleResidentNV))(handle);}
+FunctionTable::MEMBERPFNGLMULTMATRIXXOESPROC m_orig_glMultMatrixxOES = nullptr;
+void m_glMultMatrixxOES_profile(const GLfixed* m)const{ProfilingScope const scope(this,1309);(this->*(this->m_orig_glMultMatrixxOES))(m);}
+FunctionTable::MEMBERPFNGLTEXTURENORMALEXTPROC m_orig_glTextureNormalEXT = nullptr;
+void m_glTextureNormalEXT_profile(GLenum mode)const{ProfilingScope const scope(this,1310);(this->*(this->m_orig_glTextureNormalEXT))(mode);}
+FunctionTable::MEMBERPFNGLGETQUERYIVARBPROC m_orig_glGetQueryivARB = nullptr;
+void m_glGetQueryivARB_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1311);(this->*(this->m_orig_glGetQueryivARB))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC m_orig_glCompressedMultiTexImage3DEXT = nullptr;
+void m_glCompressedMultiTexImage3DEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,1312);(this->*(this->m_orig_glCompressedMultiTexImage3DEXT))(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLGETINSTRUMENTSSGIXPROC m_orig_glGetInstrumentsSGIX = nullptr;
+GLint m_glGetInstrumentsSGIX_profile()const{ProfilingScope const scope(this,1313);return (this->*(this->m_orig_glGetInstrumentsSGIX))();}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC m_orig_glProgramUniformMatrix4x3fvEXT = nullptr;
+void m_glProgramUniformMatrix4x3fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1314);(this->*(this->m_orig_glProgramUniformMatrix4x3fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFPROC m_orig_glPointParameterf = nullptr;
+void m_glPointParameterf_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1315);(this->*(this->m_orig_glPointParameterf))(pname,param);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DEXTPROC m_orig_glProgramUniform3dEXT = nullptr;
+void m_glProgramUniform3dEXT_profile(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1316);(this->*(this->m_orig_glProgramUniform3dEXT))(program,location,x,y,z);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HNVPROC m_orig_glMultiTexCoord2hNV = nullptr;
+void m_glMultiTexCoord2hNV_profile(GLenum target,GLhalfNV s,GLhalfNV t)const{ProfilingScope const scope(this,1317);(this->*(this->m_orig_glMultiTexCoord2hNV))(target,s,t);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTEREXTPROC m_orig_glGetConvolutionFilterEXT = nullptr;
+void m_glGetConvolutionFilterEXT_profile(GLenum target,GLenum format,GLenum type,void* image)const{ProfilingScope const scope(this,1318);(this->*(this->m_orig_glGetConvolutionFilterEXT))(target,format,type,image);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2HNVPROC m_orig_glVertexAttrib2hNV = nullptr;
+void m_glVertexAttrib2hNV_profile(GLuint index,GLhalfNV x,GLhalfNV y)const{ProfilingScope const scope(this,1319);(this->*(this->m_orig_glVertexAttrib2hNV))(index,x,y);}
+FunctionTable::MEMBERPFNGLCURRENTPALETTEMATRIXARBPROC m_orig_glCurrentPaletteMatrixARB = nullptr;
+void m_glCurrentPaletteMatrixARB_profile(GLint index)const{ProfilingScope const scope(this,1320);(this->*(this->m_orig_glCurrentPaletteMatrixARB))(index);}
+FunctionTable::MEMBERPFNGLFOGXVOESPROC m_orig_glFogxvOES = nullptr;
+void m_glFogxvOES_profile(GLenum pname,const GLfixed* param)const{ProfilingScope const scope(this,1321);(this->*(this->m_orig_glFogxvOES))(pname,param);}
+FunctionTable::MEMBERPFNGLCREATERENDERBUFFERSPROC m_orig_glCreateRenderbuffers = nullptr;
+void m_glCreateRenderbuffers_profile(GLsizei n,GLuint* renderbuffers)const{ProfilingScope const scope(this,1322);(this->*(this->m_orig_glCreateRenderbuffers))(n,renderbuffers);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUSVPROC m_orig_glVertexAttrib4Nusv = nullptr;
+void m_glVertexAttrib4Nusv_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,1323);(this->*(this->m_orig_glVertexAttrib4Nusv))(index,v);}
+FunctionTable::MEMBERPFNGLCOMBINERINPUTNVPROC m_orig_glCombinerInputNV = nullptr;
+void m_glCombinerInputNV_profile(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage)const{ProfilingScope const scope(this,1324);(this->*(this->m_orig_glCombinerInputNV))(stage,portion,variable,input,mapping,componentUsage);}
+FunctionTable::MEMBERPFNGLDEPTHFUNCPROC m_orig_glDepthFunc = nullptr;
+void m_glDepthFunc_profile(GLenum func)const{ProfilingScope const scope(this,1325);(this->*(this->m_orig_glDepthFunc))(func);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4FMESAPROC m_orig_glWindowPos4fMESA = nullptr;
+void m_glWindowPos4fMESA_profile(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,1326);(this->*(this->m_orig_glWindowPos4fMESA))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEINDEXEDEXTPROC m_orig_glEnableClientStateIndexedEXT = nullptr;
+void m_glEnableClientStateIndexedEXT_profile(GLenum array,GLuint index)const{ProfilingScope const scope(this,1327);(this->*(this->m_orig_glEnableClientStateIndexedEXT))(array,index);}
+FunctionTable::MEMBERPFNGLTEXCOORD4IVPROC m_orig_glTexCoord4iv = nullptr;
+void m_glTexCoord4iv_profile(const GLint* v)const{ProfilingScope const scope(this,1328);(this->*(this->m_orig_glTexCoord4iv))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64ARBPROC m_orig_glProgramUniform4i64ARB = nullptr;
+void m_glProgramUniform4i64ARB_profile(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w)const{ProfilingScope const scope(this,1329);(this->*(this->m_orig_glProgramUniform4i64ARB))(program,location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLBLENDFUNCIPROC m_orig_glBlendFunci = nullptr;
+void m_glBlendFunci_profile(GLuint buf,GLenum src,GLenum dst)const{ProfilingScope const scope(this,1330);(this->*(this->m_orig_glBlendFunci))(buf,src,dst);}
+FunctionTable::MEMBERPFNGLRESOLVEDEPTHVALUESNVPROC m_orig_glResolveDepthValuesNV = nullptr;
+void m_glResolveDepthValuesNV_profile()const{ProfilingScope const scope(this,1331);(this->*(this->m_orig_glResolveDepthValuesNV))();}
+FunctionTable::MEMBERPFNGLTEXTURECOLORMASKSGISPROC m_orig_glTextureColorMaskSGIS = nullptr;
+void m_glTextureColorMaskSGIS_profile(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{ProfilingScope const scope(this,1332);(this->*(this->m_orig_glTextureColorMaskSGIS))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLCREATESHADERPROGRAMEXTPROC m_orig_glCreateShaderProgramEXT = nullptr;
+GLuint m_glCreateShaderProgramEXT_profile(GLenum type,const GLchar* string)const{ProfilingScope const scope(this,1333);return (this->*(this->m_orig_glCreateShaderProgramEXT))(type,string);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEPROC m_orig_glBufferStorage = nullptr;
+void m_glBufferStorage_profile(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags)const{ProfilingScope const scope(this,1334);(this->*(this->m_orig_glBufferStorage))(target,size,data,flags);}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC m_orig_glMakeNamedBufferNonResidentNV = nullptr;
+void m_glMakeNamedBufferNonResidentNV_profile(GLuint buffer)const{ProfilingScope const scope(this,1335);(this->*(this->m_orig_glMakeNamedBufferNonResidentNV))(buffer);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC m_orig_glRenderbufferStorageMultisampleEXT = nullptr;
+void m_glRenderbufferStorageMultisampleEXT_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1336);(this->*(this->m_orig_glRenderbufferStorageMultisampleEXT))(target,samples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLGETFLOATI_VPROC m_orig_glGetFloati_v = nullptr;
+void m_glGetFloati_v_profile(GLenum target,GLuint index,GLfloat* data)const{ProfilingScope const scope(this,1337);(this->*(this->m_orig_glGetFloati_v))(target,index,data);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64ARBPROC m_orig_glUniform2ui64ARB = nullptr;
+void m_glUniform2ui64ARB_profile(GLint location,GLuint64 x,GLuint64 y)const{ProfilingScope const scope(this,1338);(this->*(this->m_orig_glUniform2ui64ARB))(location,x,y);}
+FunctionTable::MEMBERPFNGLVERTEX3FVPROC m_orig_glVertex3fv = nullptr;
+void m_glVertex3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1339);(this->*(this->m_orig_glVertex3fv))(v);}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONPROC m_orig_glGetUniformLocation = nullptr;
+GLint m_glGetUniformLocation_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,1340);return (this->*(this->m_orig_glGetUniformLocation))(program,name);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1SVATIPROC m_orig_glVertexStream1svATI = nullptr;
+void m_glVertexStream1svATI_profile(GLenum stream,const GLshort* coords)const{ProfilingScope const scope(this,1341);(this->*(this->m_orig_glVertexStream1svATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FATIPROC m_orig_glVertexStream3fATI = nullptr;
+void m_glVertexStream3fATI_profile(GLenum stream,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1342);(this->*(this->m_orig_glVertexStream3fATI))(stream,x,y,z);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC m_orig_glNamedFramebufferDrawBuffers = nullptr;
+void m_glNamedFramebufferDrawBuffers_profile(GLuint framebuffer,GLsizei n,const GLenum* bufs)const{ProfilingScope const scope(this,1343);(this->*(this->m_orig_glNamedFramebufferDrawBuffers))(framebuffer,n,bufs);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VNVPROC m_orig_glUniform2ui64vNV = nullptr;
+void m_glUniform2ui64vNV_profile(GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1344);(this->*(this->m_orig_glUniform2ui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERVINTELPROC m_orig_glTexCoordPointervINTEL = nullptr;
+void m_glTexCoordPointervINTEL_profile(GLint size,GLenum type,const void** pointer)const{ProfilingScope const scope(this,1345);(this->*(this->m_orig_glTexCoordPointervINTEL))(size,type,pointer);}
+FunctionTable::MEMBERPFNGLUNIFORM4FVPROC m_orig_glUniform4fv = nullptr;
+void m_glUniform4fv_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,1346);(this->*(this->m_orig_glUniform4fv))(location,count,value);}
+FunctionTable::MEMBERPFNGLNORMALPOINTEREXTPROC m_orig_glNormalPointerEXT = nullptr;
+void m_glNormalPointerEXT_profile(GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{ProfilingScope const scope(this,1347);(this->*(this->m_orig_glNormalPointerEXT))(type,stride,count,pointer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4HNVPROC m_orig_glVertexAttrib4hNV = nullptr;
+void m_glVertexAttrib4hNV_profile(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{ProfilingScope const scope(this,1348);(this->*(this->m_orig_glVertexAttrib4hNV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLNORMAL3FPROC m_orig_glNormal3f = nullptr;
+void m_glNormal3f_profile(GLfloat nx,GLfloat ny,GLfloat nz)const{ProfilingScope const scope(this,1349);(this->*(this->m_orig_glNormal3f))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2IATIPROC m_orig_glVertexStream2iATI = nullptr;
+void m_glVertexStream2iATI_profile(GLenum stream,GLint x,GLint y)const{ProfilingScope const scope(this,1350);(this->*(this->m_orig_glVertexStream2iATI))(stream,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP4UIVPROC m_orig_glVertexAttribP4uiv = nullptr;
+void m_glVertexAttribP4uiv_profile(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{ProfilingScope const scope(this,1351);(this->*(this->m_orig_glVertexAttribP4uiv))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC m_orig_glCompressedTextureSubImage3D = nullptr;
+void m_glCompressedTextureSubImage3D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,1352);(this->*(this->m_orig_glCompressedTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLASYNCMARKERSGIXPROC m_orig_glAsyncMarkerSGIX = nullptr;
+void m_glAsyncMarkerSGIX_profile(GLuint marker)const{ProfilingScope const scope(this,1353);(this->*(this->m_orig_glAsyncMarkerSGIX))(marker);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGESPARSEAMDPROC m_orig_glTextureStorageSparseAMD = nullptr;
+void m_glTextureStorageSparseAMD_profile(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags)const{ProfilingScope const scope(this,1354);(this->*(this->m_orig_glTextureStorageSparseAMD))(texture,target,internalFormat,width,height,depth,layers,flags);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERIVEXTPROC m_orig_glGetConvolutionParameterivEXT = nullptr;
+void m_glGetConvolutionParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1355);(this->*(this->m_orig_glGetConvolutionParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLENDPERFQUERYINTELPROC m_orig_glEndPerfQueryINTEL = nullptr;
+void m_glEndPerfQueryINTEL_profile(GLuint queryHandle)const{ProfilingScope const scope(this,1356);(this->*(this->m_orig_glEndPerfQueryINTEL))(queryHandle);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELISGIXPROC m_orig_glFragmentLightModeliSGIX = nullptr;
+void m_glFragmentLightModeliSGIX_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1357);(this->*(this->m_orig_glFragmentLightModeliSGIX))(pname,param);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESEXTPROC m_orig_glPrioritizeTexturesEXT = nullptr;
+void m_glPrioritizeTexturesEXT_profile(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{ProfilingScope const scope(this,1358);(this->*(this->m_orig_glPrioritizeTexturesEXT))(n,textures,priorities);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERPROC m_orig_glEndConditionalRender = nullptr;
+void m_glEndConditionalRender_profile()const{ProfilingScope const scope(this,1359);(this->*(this->m_orig_glEndConditionalRender))();}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEPROC m_orig_glEnableClientState = nullptr;
+void m_glEnableClientState_profile(GLenum cap)const{ProfilingScope const scope(this,1360);(this->*(this->m_orig_glEnableClientState))(cap);}
+FunctionTable::MEMBERPFNGLRESETHISTOGRAMPROC m_orig_glResetHistogram = nullptr;
+void m_glResetHistogram_profile(GLenum target)const{ProfilingScope const scope(this,1361);(this->*(this->m_orig_glResetHistogram))(target);}
+FunctionTable::MEMBERPFNGLGETOCCLUSIONQUERYIVNVPROC m_orig_glGetOcclusionQueryivNV = nullptr;
+void m_glGetOcclusionQueryivNV_profile(GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1362);(this->*(this->m_orig_glGetOcclusionQueryivNV))(id,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIEXTPROC m_orig_glUniform1uiEXT = nullptr;
+void m_glUniform1uiEXT_profile(GLint location,GLuint v0)const{ProfilingScope const scope(this,1363);(this->*(this->m_orig_glUniform1uiEXT))(location,v0);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2SVPROC m_orig_glMultiTexCoord2sv = nullptr;
+void m_glMultiTexCoord2sv_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,1364);(this->*(this->m_orig_glMultiTexCoord2sv))(target,v);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DEXTPROC m_orig_glTexSubImage2DEXT = nullptr;
+void m_glTexSubImage2DEXT_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1365);(this->*(this->m_orig_glTexSubImage2DEXT))(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIVPROC m_orig_glProgramUniform2uiv = nullptr;
+void m_glProgramUniform2uiv_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1366);(this->*(this->m_orig_glProgramUniform2uiv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IARBPROC m_orig_glMultiTexCoord2iARB = nullptr;
+void m_glMultiTexCoord2iARB_profile(GLenum target,GLint s,GLint t)const{ProfilingScope const scope(this,1367);(this->*(this->m_orig_glMultiTexCoord2iARB))(target,s,t);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUIVPROC m_orig_glGetQueryObjectuiv = nullptr;
+void m_glGetQueryObjectuiv_profile(GLuint id,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,1368);(this->*(this->m_orig_glGetQueryObjectuiv))(id,pname,params);}
+FunctionTable::MEMBERPFNGLGENERATEMULTITEXMIPMAPEXTPROC m_orig_glGenerateMultiTexMipmapEXT = nullptr;
+void m_glGenerateMultiTexMipmapEXT_profile(GLenum texunit,GLenum target)const{ProfilingScope const scope(this,1369);(this->*(this->m_orig_glGenerateMultiTexMipmapEXT))(texunit,target);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVPROC m_orig_glVertexAttrib4iv = nullptr;
+void m_glVertexAttrib4iv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,1370);(this->*(this->m_orig_glVertexAttrib4iv))(index,v);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVMESAPROC m_orig_glWindowPos3dvMESA = nullptr;
+void m_glWindowPos3dvMESA_profile(const GLdouble* v)const{ProfilingScope const scope(this,1371);(this->*(this->m_orig_glWindowPos3dvMESA))(v);}
+FunctionTable::MEMBERPFNGLLABELOBJECTEXTPROC m_orig_glLabelObjectEXT = nullptr;
+void m_glLabelObjectEXT_profile(GLenum type,GLuint object,GLsizei length,const GLchar* label)const{ProfilingScope const scope(this,1372);(this->*(this->m_orig_glLabelObjectEXT))(type,object,length,label);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UIVPROC m_orig_glProgramUniform1uiv = nullptr;
+void m_glProgramUniform1uiv_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1373);(this->*(this->m_orig_glProgramUniform1uiv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREPROC m_orig_glFramebufferTexture = nullptr;
+void m_glFramebufferTexture_profile(GLenum target,GLenum attachment,GLuint texture,GLint level)const{ProfilingScope const scope(this,1374);(this->*(this->m_orig_glFramebufferTexture))(target,attachment,texture,level);}
+FunctionTable::MEMBERPFNGLMULTITEXENVFEXTPROC m_orig_glMultiTexEnvfEXT = nullptr;
+void m_glMultiTexEnvfEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1375);(this->*(this->m_orig_glMultiTexEnvfEXT))(texunit,target,pname,param);}
+FunctionTable::MEMBERPFNGLGETTEXGENDVPROC m_orig_glGetTexGendv = nullptr;
+void m_glGetTexGendv_profile(GLenum coord,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1376);(this->*(this->m_orig_glGetTexGendv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEX4XOESPROC m_orig_glVertex4xOES = nullptr;
+void m_glVertex4xOES_profile(GLfixed x,GLfixed y,GLfixed z)const{ProfilingScope const scope(this,1377);(this->*(this->m_orig_glVertex4xOES))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIVEXTPROC m_orig_glVertexAttribI2uivEXT = nullptr;
+void m_glVertexAttribI2uivEXT_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1378);(this->*(this->m_orig_glVertexAttribI2uivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC m_orig_glNamedProgramLocalParameter4fvEXT = nullptr;
+void m_glNamedProgramLocalParameter4fvEXT_profile(GLuint program,GLenum target,GLuint index,const GLfloat* params)const{ProfilingScope const scope(this,1379);(this->*(this->m_orig_glNamedProgramLocalParameter4fvEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLCOLOR3USVPROC m_orig_glColor3usv = nullptr;
+void m_glColor3usv_profile(const GLushort* v)const{ProfilingScope const scope(this,1380);(this->*(this->m_orig_glColor3usv))(v);}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC m_orig_glGetPixelTransformParameterfvEXT = nullptr;
+void m_glGetPixelTransformParameterfvEXT_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1381);(this->*(this->m_orig_glGetPixelTransformParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLINDEXXVOESPROC m_orig_glIndexxvOES = nullptr;
+void m_glIndexxvOES_profile(const GLfixed* component)const{ProfilingScope const scope(this,1382);(this->*(this->m_orig_glIndexxvOES))(component);}
+FunctionTable::MEMBERPFNGLDEPTHMASKPROC m_orig_glDepthMask = nullptr;
+void m_glDepthMask_profile(GLboolean flag)const{ProfilingScope const scope(this,1383);(this->*(this->m_orig_glDepthMask))(flag);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4FVPROC m_orig_glProgramUniformMatrix2x4fv = nullptr;
+void m_glProgramUniformMatrix2x4fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1384);(this->*(this->m_orig_glProgramUniformMatrix2x4fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLAREPROGRAMSRESIDENTNVPROC m_orig_glAreProgramsResidentNV = nullptr;
+GLboolean m_glAreProgramsResidentNV_profile(GLsizei n,const GLuint* programs,GLboolean* residences)const{ProfilingScope const scope(this,1385);return (this->*(this->m_orig_glAreProgramsResidentNV))(n,programs,residences);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPROC m_orig_glColorTable = nullptr;
+void m_glColorTable_profile(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table)const{ProfilingScope const scope(this,1386);(this->*(this->m_orig_glColorTable))(target,internalformat,width,format,type,table);}
+FunctionTable::MEMBERPFNGLBEGINQUERYINDEXEDPROC m_orig_glBeginQueryIndexed = nullptr;
+void m_glBeginQueryIndexed_profile(GLenum target,GLuint index,GLuint id)const{ProfilingScope const scope(this,1387);(this->*(this->m_orig_glBeginQueryIndexed))(target,index,id);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DVATIPROC m_orig_glVertexStream1dvATI = nullptr;
+void m_glVertexStream1dvATI_profile(GLenum stream,const GLdouble* coords)const{ProfilingScope const scope(this,1388);(this->*(this->m_orig_glVertexStream1dvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVFVEXTPROC m_orig_glGetMultiTexEnvfvEXT = nullptr;
+void m_glGetMultiTexEnvfvEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1389);(this->*(this->m_orig_glGetMultiTexEnvfvEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLDELETEFENCESNVPROC m_orig_glDeleteFencesNV = nullptr;
+void m_glDeleteFencesNV_profile(GLsizei n,const GLuint* fences)const{ProfilingScope const scope(this,1390);(this->*(this->m_orig_glDeleteFencesNV))(n,fences);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1DVNVPROC m_orig_glVertexAttribs1dvNV = nullptr;
+void m_glVertexAttribs1dvNV_profile(GLuint index,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,1391);(this->*(this->m_orig_glVertexAttribs1dvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLBUFFERSTORAGEEXTERNALEXTPROC m_orig_glBufferStorageExternalEXT = nullptr;
+void m_glBufferStorageExternalEXT_profile(GLenum target,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{ProfilingScope const scope(this,1392);(this->*(this->m_orig_glBufferStorageExternalEXT))(target,offset,size,clientBuffer,flags);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SATIPROC m_orig_glVertexStream2sATI = nullptr;
+void m_glVertexStream2sATI_profile(GLenum stream,GLshort x,GLshort y)const{ProfilingScope const scope(this,1393);(this->*(this->m_orig_glVertexStream2sATI))(stream,x,y);}
+FunctionTable::MEMBERPFNGLGETNSEPARABLEFILTERARBPROC m_orig_glGetnSeparableFilterARB = nullptr;
+void m_glGetnSeparableFilterARB_profile(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span)const{ProfilingScope const scope(this,1394);(this->*(this->m_orig_glGetnSeparableFilterARB))(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVPROC m_orig_glProgramUniform2dv = nullptr;
+void m_glProgramUniform2dv_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,1395);(this->*(this->m_orig_glProgramUniform2dv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLACTIVESTENCILFACEEXTPROC m_orig_glActiveStencilFaceEXT = nullptr;
+void m_glActiveStencilFaceEXT_profile(GLenum face)const{ProfilingScope const scope(this,1396);(this->*(this->m_orig_glActiveStencilFaceEXT))(face);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DEXTPROC m_orig_glProgramUniform4dEXT = nullptr;
+void m_glProgramUniform4dEXT_profile(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1397);(this->*(this->m_orig_glProgramUniform4dEXT))(program,location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPOINTSIZEXOESPROC m_orig_glPointSizexOES = nullptr;
+void m_glPointSizexOES_profile(GLfixed size)const{ProfilingScope const scope(this,1398);(this->*(this->m_orig_glPointSizexOES))(size);}
+FunctionTable::MEMBERPFNGLRASTERPOS2SVPROC m_orig_glRasterPos2sv = nullptr;
+void m_glRasterPos2sv_profile(const GLshort* v)const{ProfilingScope const scope(this,1399);(this->*(this->m_orig_glRasterPos2sv))(v);}
+FunctionTable::MEMBERPFNGLBINDPARAMETEREXTPROC m_orig_glBindParameterEXT = nullptr;
+GLuint m_glBindParameterEXT_profile(GLenum value)const{ProfilingScope const scope(this,1400);return (this->*(this->m_orig_glBindParameterEXT))(value);}
+FunctionTable::MEMBERPFNGLTEXCOORD1SVPROC m_orig_glTexCoord1sv = nullptr;
+void m_glTexCoord1sv_profile(const GLshort* v)const{ProfilingScope const scope(this,1401);(this->*(this->m_orig_glTexCoord1sv))(v);}
+FunctionTable::MEMBERPFNGLBLENDPARAMETERINVPROC m_orig_glBlendParameteriNV = nullptr;
+void m_glBlendParameteriNV_profile(GLenum pname,GLint value)const{ProfilingScope const scope(this,1402);(this->*(this->m_orig_glBlendParameteriNV))(pname,value);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC m_orig_glNamedProgramLocalParameter4dvEXT = nullptr;
+void m_glNamedProgramLocalParameter4dvEXT_profile(GLuint program,GLenum target,GLuint index,const GLdouble* params)const{ProfilingScope const scope(this,1403);(this->*(this->m_orig_glNamedProgramLocalParameter4dvEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64NVPROC m_orig_glProgramUniformHandleui64NV = nullptr;
+void m_glProgramUniformHandleui64NV_profile(GLuint program,GLint location,GLuint64 value)const{ProfilingScope const scope(this,1404);(this->*(this->m_orig_glProgramUniformHandleui64NV))(program,location,value);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVEXTPROC m_orig_glGetTextureParameterfvEXT = nullptr;
+void m_glGetTextureParameterfvEXT_profile(GLuint texture,GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1405);(this->*(this->m_orig_glGetTextureParameterfvEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLGETPATHMETRICSNVPROC m_orig_glGetPathMetricsNV = nullptr;
+void m_glGetPathMetricsNV_profile(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics)const{ProfilingScope const scope(this,1406);(this->*(this->m_orig_glGetPathMetricsNV))(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);}
+FunctionTable::MEMBERPFNGLVERTEX2IPROC m_orig_glVertex2i = nullptr;
+void m_glVertex2i_profile(GLint x,GLint y)const{ProfilingScope const scope(this,1407);(this->*(this->m_orig_glVertex2i))(x,y);}
+FunctionTable::MEMBERPFNGLNEWLISTPROC m_orig_glNewList = nullptr;
+void m_glNewList_profile(GLuint list,GLenum mode)const{ProfilingScope const scope(this,1408);(this->*(this->m_orig_glNewList))(list,mode);}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X3FNVPROC m_orig_glMatrixLoad3x3fNV = nullptr;
+void m_glMatrixLoad3x3fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,1409);(this->*(this->m_orig_glMatrixLoad3x3fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FARBPROC m_orig_glMultiTexCoord2fARB = nullptr;
+void m_glMultiTexCoord2fARB_profile(GLenum target,GLfloat s,GLfloat t)const{ProfilingScope const scope(this,1410);(this->*(this->m_orig_glMultiTexCoord2fARB))(target,s,t);}
+FunctionTable::MEMBERPFNGLWEIGHTDVARBPROC m_orig_glWeightdvARB = nullptr;
+void m_glWeightdvARB_profile(GLint size,const GLdouble* weights)const{ProfilingScope const scope(this,1411);(this->*(this->m_orig_glWeightdvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLISTRANSFORMFEEDBACKNVPROC m_orig_glIsTransformFeedbackNV = nullptr;
+GLboolean m_glIsTransformFeedbackNV_profile(GLuint id)const{ProfilingScope const scope(this,1412);return (this->*(this->m_orig_glIsTransformFeedbackNV))(id);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORARBPROC m_orig_glVertexAttribDivisorARB = nullptr;
+void m_glVertexAttribDivisorARB_profile(GLuint index,GLuint divisor)const{ProfilingScope const scope(this,1413);(this->*(this->m_orig_glVertexAttribDivisorARB))(index,divisor);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIVPROC m_orig_glSecondaryColorP3uiv = nullptr;
+void m_glSecondaryColorP3uiv_profile(GLenum type,const GLuint* color)const{ProfilingScope const scope(this,1414);(this->*(this->m_orig_glSecondaryColorP3uiv))(type,color);}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEARBPROC m_orig_glGetnCompressedTexImageARB = nullptr;
+void m_glGetnCompressedTexImageARB_profile(GLenum target,GLint lod,GLsizei bufSize,void* img)const{ProfilingScope const scope(this,1415);(this->*(this->m_orig_glGetnCompressedTexImageARB))(target,lod,bufSize,img);}
+FunctionTable::MEMBERPFNGLGETINTEGERVPROC m_orig_glGetIntegerv = nullptr;
+void m_glGetIntegerv_profile(GLenum pname,GLint* params)const{ProfilingScope const scope(this,1416);(this->*(this->m_orig_glGetIntegerv))(pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXLOADDEXTPROC m_orig_glMatrixLoaddEXT = nullptr;
+void m_glMatrixLoaddEXT_profile(GLenum mode,const GLdouble* m)const{ProfilingScope const scope(this,1417);(this->*(this->m_orig_glMatrixLoaddEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLGETPATHLENGTHNVPROC m_orig_glGetPathLengthNV = nullptr;
+GLfloat m_glGetPathLengthNV_profile(GLuint path,GLsizei startSegment,GLsizei numSegments)const{ProfilingScope const scope(this,1418);return (this->*(this->m_orig_glGetPathLengthNV))(path,startSegment,numSegments);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVPROC m_orig_glProgramUniformMatrix3dv = nullptr;
+void m_glProgramUniformMatrix3dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1419);(this->*(this->m_orig_glProgramUniformMatrix3dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64NVPROC m_orig_glUniform4i64NV = nullptr;
+void m_glUniform4i64NV_profile(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{ProfilingScope const scope(this,1420);(this->*(this->m_orig_glUniform4i64NV))(location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMEXTPROC m_orig_glGetHistogramEXT = nullptr;
+void m_glGetHistogramEXT_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values)const{ProfilingScope const scope(this,1421);(this->*(this->m_orig_glGetHistogramEXT))(target,reset,format,type,values);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUIVARBPROC m_orig_glVertexAttrib4NuivARB = nullptr;
+void m_glVertexAttrib4NuivARB_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1422);(this->*(this->m_orig_glVertexAttrib4NuivARB))(index,v);}
+FunctionTable::MEMBERPFNGLMAPGRID2XOESPROC m_orig_glMapGrid2xOES = nullptr;
+void m_glMapGrid2xOES_profile(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2)const{ProfilingScope const scope(this,1423);(this->*(this->m_orig_glMapGrid2xOES))(n,u1,u2,v1,v2);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DPROC m_orig_glTexImage2D = nullptr;
+void m_glTexImage2D_profile(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,1424);(this->*(this->m_orig_glTexImage2D))(target,level,internalFormat,width,height,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVARBPROC m_orig_glWindowPos2fvARB = nullptr;
+void m_glWindowPos2fvARB_profile(const GLfloat* v)const{ProfilingScope const scope(this,1425);(this->*(this->m_orig_glWindowPos2fvARB))(v);}
+FunctionTable::MEMBERPFNGLENABLEINDEXEDEXTPROC m_orig_glEnableIndexedEXT = nullptr;
+void m_glEnableIndexedEXT_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,1426);(this->*(this->m_orig_glEnableIndexedEXT))(target,index);}
+FunctionTable::MEMBERPFNGLTEXCOORD1BVOESPROC m_orig_glTexCoord1bvOES = nullptr;
+void m_glTexCoord1bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,1427);(this->*(this->m_orig_glTexCoord1bvOES))(coords);}
+FunctionTable::MEMBERPFNGLDRAWPIXELSPROC m_orig_glDrawPixels = nullptr;
+void m_glDrawPixels_profile(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,1428);(this->*(this->m_orig_glDrawPixels))(width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLMULTMATRIXDPROC m_orig_glMultMatrixd = nullptr;
+void m_glMultMatrixd_profile(const GLdouble* m)const{ProfilingScope const scope(this,1429);(this->*(this->m_orig_glMultMatrixd))(m);}
+FunctionTable::MEMBERPFNGLMULTMATRIXFPROC m_orig_glMultMatrixf = nullptr;
+void m_glMultMatrixf_profile(const GLfloat* m)const{ProfilingScope const scope(this,1430);(this->*(this->m_orig_glMultMatrixf))(m);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEPOINTERSUNPROC m_orig_glReplacementCodePointerSUN = nullptr;
+void m_glReplacementCodePointerSUN_profile(GLenum type,GLsizei stride,const void** pointer)const{ProfilingScope const scope(this,1431);(this->*(this->m_orig_glReplacementCodePointerSUN))(type,stride,pointer);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDARBPROC m_orig_glLoadTransposeMatrixdARB = nullptr;
+void m_glLoadTransposeMatrixdARB_profile(const GLdouble* m)const{ProfilingScope const scope(this,1432);(this->*(this->m_orig_glLoadTransposeMatrixdARB))(m);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBVPROC m_orig_glVertexAttrib4Nubv = nullptr;
+void m_glVertexAttrib4Nubv_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,1433);(this->*(this->m_orig_glVertexAttrib4Nubv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC m_orig_glVertexArrayVertexAttribIOffsetEXT = nullptr;
+void m_glVertexArrayVertexAttribIOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1434);(this->*(this->m_orig_glVertexArrayVertexAttribIOffsetEXT))(vaobj,buffer,index,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERARBPROC m_orig_glCompileShaderARB = nullptr;
+void m_glCompileShaderARB_profile(GLhandleARB shaderObj)const{ProfilingScope const scope(this,1435);(this->*(this->m_orig_glCompileShaderARB))(shaderObj);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DMESAPROC m_orig_glWindowPos3dMESA = nullptr;
+void m_glWindowPos3dMESA_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1436);(this->*(this->m_orig_glWindowPos3dMESA))(x,y,z);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FVATIPROC m_orig_glNormalStream3fvATI = nullptr;
+void m_glNormalStream3fvATI_profile(GLenum stream,const GLfloat* coords)const{ProfilingScope const scope(this,1437);(this->*(this->m_orig_glNormalStream3fvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLCOLOR4USVPROC m_orig_glColor4usv = nullptr;
+void m_glColor4usv_profile(const GLushort* v)const{ProfilingScope const scope(this,1438);(this->*(this->m_orig_glColor4usv))(v);}
+FunctionTable::MEMBERPFNGLMAPGRID1FPROC m_orig_glMapGrid1f = nullptr;
+void m_glMapGrid1f_profile(GLint un,GLfloat u1,GLfloat u2)const{ProfilingScope const scope(this,1439);(this->*(this->m_orig_glMapGrid1f))(un,u1,u2);}
+FunctionTable::MEMBERPFNGLPOLYGONSTIPPLEPROC m_orig_glPolygonStipple = nullptr;
+void m_glPolygonStipple_profile(const GLubyte* mask)const{ProfilingScope const scope(this,1440);(this->*(this->m_orig_glPolygonStipple))(mask);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64ARBPROC m_orig_glUniform4ui64ARB = nullptr;
+void m_glUniform4ui64ARB_profile(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w)const{ProfilingScope const scope(this,1441);(this->*(this->m_orig_glUniform4ui64ARB))(location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLTEXTURERENDERBUFFEREXTPROC m_orig_glTextureRenderbufferEXT = nullptr;
+void m_glTextureRenderbufferEXT_profile(GLuint texture,GLenum target,GLuint renderbuffer)const{ProfilingScope const scope(this,1442);(this->*(this->m_orig_glTextureRenderbufferEXT))(texture,target,renderbuffer);}
+FunctionTable::MEMBERPFNGLGETSUBROUTINEUNIFORMLOCATIONPROC m_orig_glGetSubroutineUniformLocation = nullptr;
+GLint m_glGetSubroutineUniformLocation_profile(GLuint program,GLenum shadertype,const GLchar* name)const{ProfilingScope const scope(this,1443);return (this->*(this->m_orig_glGetSubroutineUniformLocation))(program,shadertype,name);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVPROC m_orig_glGetFramebufferParameteriv = nullptr;
+void m_glGetFramebufferParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1444);(this->*(this->m_orig_glGetFramebufferParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPIXELMAPUSVPROC m_orig_glPixelMapusv = nullptr;
+void m_glPixelMapusv_profile(GLenum map,GLsizei mapsize,const GLushort* values)const{ProfilingScope const scope(this,1445);(this->*(this->m_orig_glPixelMapusv))(map,mapsize,values);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIVPROC m_orig_glGetSamplerParameteriv = nullptr;
+void m_glGetSamplerParameteriv_profile(GLuint sampler,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1446);(this->*(this->m_orig_glGetSamplerParameteriv))(sampler,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FVATIPROC m_orig_glVertexStream2fvATI = nullptr;
+void m_glVertexStream2fvATI_profile(GLenum stream,const GLfloat* coords)const{ProfilingScope const scope(this,1447);(this->*(this->m_orig_glVertexStream2fvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPROGRAMSTRINGARBPROC m_orig_glProgramStringARB = nullptr;
+void m_glProgramStringARB_profile(GLenum target,GLenum format,GLsizei len,const void* string)const{ProfilingScope const scope(this,1448);(this->*(this->m_orig_glProgramStringARB))(target,format,len,string);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3DVEXTPROC m_orig_glProgramUniformMatrix3dvEXT = nullptr;
+void m_glProgramUniformMatrix3dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1449);(this->*(this->m_orig_glProgramUniformMatrix3dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DPROC m_orig_glSeparableFilter2D = nullptr;
+void m_glSeparableFilter2D_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column)const{ProfilingScope const scope(this,1450);(this->*(this->m_orig_glSeparableFilter2D))(target,internalformat,width,height,format,type,row,column);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVPROC m_orig_glVertexAttribI1uiv = nullptr;
+void m_glVertexAttribI1uiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1451);(this->*(this->m_orig_glVertexAttribI1uiv))(index,v);}
+FunctionTable::MEMBERPFNGLLGPUCOPYIMAGESUBDATANVXPROC m_orig_glLGPUCopyImageSubDataNVX = nullptr;
+void m_glLGPUCopyImageSubDataNVX_profile(GLuint sourceGpu,GLbitfield destinationGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srxY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,1452);(this->*(this->m_orig_glLGPUCopyImageSubDataNVX))(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE2DPROC m_orig_glTexStorage2D = nullptr;
+void m_glTexStorage2D_profile(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1453);(this->*(this->m_orig_glTexStorage2D))(target,levels,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLCOLOR3FVPROC m_orig_glColor3fv = nullptr;
+void m_glColor3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1454);(this->*(this->m_orig_glColor3fv))(v);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENDVEXTPROC m_orig_glGetMultiTexGendvEXT = nullptr;
+void m_glGetMultiTexGendvEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1455);(this->*(this->m_orig_glGetMultiTexGendvEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVEXTPROC m_orig_glVertexAttribL4dvEXT = nullptr;
+void m_glVertexAttribL4dvEXT_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1456);(this->*(this->m_orig_glVertexAttribL4dvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMPROC m_orig_glGetActiveUniform = nullptr;
+void m_glGetActiveUniform_profile(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{ProfilingScope const scope(this,1457);(this->*(this->m_orig_glGetActiveUniform))(program,index,bufSize,length,size,type,name);}
+FunctionTable::MEMBERPFNGLUNIFORM2UI64VARBPROC m_orig_glUniform2ui64vARB = nullptr;
+void m_glUniform2ui64vARB_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,1458);(this->*(this->m_orig_glUniform2ui64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLMAKENAMEDBUFFERRESIDENTNVPROC m_orig_glMakeNamedBufferResidentNV = nullptr;
+void m_glMakeNamedBufferResidentNV_profile(GLuint buffer,GLenum access)const{ProfilingScope const scope(this,1459);(this->*(this->m_orig_glMakeNamedBufferResidentNV))(buffer,access);}
+FunctionTable::MEMBERPFNGLPATHGLYPHINDEXRANGENVPROC m_orig_glPathGlyphIndexRangeNV = nullptr;
+GLenum m_glPathGlyphIndexRangeNV_profile(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint baseAndCount[2])const{ProfilingScope const scope(this,1460);return (this->*(this->m_orig_glPathGlyphIndexRangeNV))(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);}
+FunctionTable::MEMBERPFNGLCOLORPOINTERPROC m_orig_glColorPointer = nullptr;
+void m_glColorPointer_profile(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,1461);(this->*(this->m_orig_glColorPointer))(size,type,stride,ptr);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4IVNVPROC m_orig_glProgramEnvParameterI4ivNV = nullptr;
+void m_glProgramEnvParameterI4ivNV_profile(GLenum target,GLuint index,const GLint* params)const{ProfilingScope const scope(this,1462);(this->*(this->m_orig_glProgramEnvParameterI4ivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLMULTICASTGETQUERYOBJECTUI64VNVPROC m_orig_glMulticastGetQueryObjectui64vNV = nullptr;
+void m_glMulticastGetQueryObjectui64vNV_profile(GLuint gpu,GLuint id,GLenum pname,GLuint64* params)const{ProfilingScope const scope(this,1463);(this->*(this->m_orig_glMulticastGetQueryObjectui64vNV))(gpu,id,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFEXTPROC m_orig_glMultiTexParameterfEXT = nullptr;
+void m_glMultiTexParameterfEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1464);(this->*(this->m_orig_glMultiTexParameterfEXT))(texunit,target,pname,param);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC m_orig_glNamedFramebufferTextureLayer = nullptr;
+void m_glNamedFramebufferTextureLayer_profile(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{ProfilingScope const scope(this,1465);(this->*(this->m_orig_glNamedFramebufferTextureLayer))(framebuffer,attachment,texture,level,layer);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERVEXTPROC m_orig_glGetVertexArrayIntegervEXT = nullptr;
+void m_glGetVertexArrayIntegervEXT_profile(GLuint vaobj,GLenum pname,GLint* param)const{ProfilingScope const scope(this,1466);(this->*(this->m_orig_glGetVertexArrayIntegervEXT))(vaobj,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DARBPROC m_orig_glVertexAttrib3dARB = nullptr;
+void m_glVertexAttrib3dARB_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1467);(this->*(this->m_orig_glVertexAttrib3dARB))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLVDPAUISSURFACENVPROC m_orig_glVDPAUIsSurfaceNV = nullptr;
+GLboolean m_glVDPAUIsSurfaceNV_profile(GLvdpauSurfaceNV surface)const{ProfilingScope const scope(this,1468);return (this->*(this->m_orig_glVDPAUIsSurfaceNV))(surface);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE1DEXTPROC m_orig_glMultiTexImage1DEXT = nullptr;
+void m_glMultiTexImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1469);(this->*(this->m_orig_glMultiTexImage1DEXT))(texunit,target,level,internalformat,width,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLISASYNCMARKERSGIXPROC m_orig_glIsAsyncMarkerSGIX = nullptr;
+GLboolean m_glIsAsyncMarkerSGIX_profile(GLuint marker)const{ProfilingScope const scope(this,1470);return (this->*(this->m_orig_glIsAsyncMarkerSGIX))(marker);}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VEXTPROC m_orig_glGetDoublei_vEXT = nullptr;
+void m_glGetDoublei_vEXT_profile(GLenum pname,GLuint index,GLdouble* params)const{ProfilingScope const scope(this,1471);(this->*(this->m_orig_glGetDoublei_vEXT))(pname,index,params);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64NVPROC m_orig_glUniform2i64NV = nullptr;
+void m_glUniform2i64NV_profile(GLint location,GLint64EXT x,GLint64EXT y)const{ProfilingScope const scope(this,1472);(this->*(this->m_orig_glUniform2i64NV))(location,x,y);}
+FunctionTable::MEMBERPFNGLISCOMMANDLISTNVPROC m_orig_glIsCommandListNV = nullptr;
+GLboolean m_glIsCommandListNV_profile(GLuint list)const{ProfilingScope const scope(this,1473);return (this->*(this->m_orig_glIsCommandListNV))(list);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIEXTPROC m_orig_glUniform3uiEXT = nullptr;
+void m_glUniform3uiEXT_profile(GLint location,GLuint v0,GLuint v1,GLuint v2)const{ProfilingScope const scope(this,1474);(this->*(this->m_orig_glUniform3uiEXT))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIUIVEXTPROC m_orig_glTexParameterIuivEXT = nullptr;
+void m_glTexParameterIuivEXT_profile(GLenum target,GLenum pname,const GLuint* params)const{ProfilingScope const scope(this,1475);(this->*(this->m_orig_glTexParameterIuivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVPROC m_orig_glProgramUniformMatrix4fv = nullptr;
+void m_glProgramUniformMatrix4fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1476);(this->*(this->m_orig_glProgramUniformMatrix4fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEX2FVPROC m_orig_glVertex2fv = nullptr;
+void m_glVertex2fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1477);(this->*(this->m_orig_glVertex2fv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3DEXTPROC m_orig_glVertexAttribL3dEXT = nullptr;
+void m_glVertexAttribL3dEXT_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1478);(this->*(this->m_orig_glVertexAttribL3dEXT))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFERPROC m_orig_glFramebufferRenderbuffer = nullptr;
+void m_glFramebufferRenderbuffer_profile(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{ProfilingScope const scope(this,1479);(this->*(this->m_orig_glFramebufferRenderbuffer))(target,attachment,renderbuffertarget,renderbuffer);}
+FunctionTable::MEMBERPFNGLGETUNIFORMLOCATIONARBPROC m_orig_glGetUniformLocationARB = nullptr;
+GLint m_glGetUniformLocationARB_profile(GLhandleARB programObj,const GLcharARB* name)const{ProfilingScope const scope(this,1480);return (this->*(this->m_orig_glGetUniformLocationARB))(programObj,name);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERFVNVPROC m_orig_glPathParameterfvNV = nullptr;
+void m_glPathParameterfvNV_profile(GLuint path,GLenum pname,const GLfloat* value)const{ProfilingScope const scope(this,1481);(this->*(this->m_orig_glPathParameterfvNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SNVPROC m_orig_glVertexAttrib3sNV = nullptr;
+void m_glVertexAttrib3sNV_profile(GLuint index,GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,1482);(this->*(this->m_orig_glVertexAttrib3sNV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLGETDOUBLEI_VPROC m_orig_glGetDoublei_v = nullptr;
+void m_glGetDoublei_v_profile(GLenum target,GLuint index,GLdouble* data)const{ProfilingScope const scope(this,1483);(this->*(this->m_orig_glGetDoublei_v))(target,index,data);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SVPROC m_orig_glVertexAttrib1sv = nullptr;
+void m_glVertexAttrib1sv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,1484);(this->*(this->m_orig_glVertexAttrib1sv))(index,v);}
+FunctionTable::MEMBERPFNGLBINDSAMPLERPROC m_orig_glBindSampler = nullptr;
+void m_glBindSampler_profile(GLuint unit,GLuint sampler)const{ProfilingScope const scope(this,1485);(this->*(this->m_orig_glBindSampler))(unit,sampler);}
+FunctionTable::MEMBERPFNGLLINEWIDTHPROC m_orig_glLineWidth = nullptr;
+void m_glLineWidth_profile(GLfloat width)const{ProfilingScope const scope(this,1486);(this->*(this->m_orig_glLineWidth))(width);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGEAPPLEPROC m_orig_glVertexArrayRangeAPPLE = nullptr;
+void m_glVertexArrayRangeAPPLE_profile(GLsizei length,void* pointer)const{ProfilingScope const scope(this,1487);(this->*(this->m_orig_glVertexArrayRangeAPPLE))(length,pointer);}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETEXTPROC m_orig_glBindBufferOffsetEXT = nullptr;
+void m_glBindBufferOffsetEXT_profile(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{ProfilingScope const scope(this,1488);(this->*(this->m_orig_glBindBufferOffsetEXT))(target,index,buffer,offset);}
+FunctionTable::MEMBERPFNGLWEIGHTFVARBPROC m_orig_glWeightfvARB = nullptr;
+void m_glWeightfvARB_profile(GLint size,const GLfloat* weights)const{ProfilingScope const scope(this,1489);(this->*(this->m_orig_glWeightfvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLGETINTEGERI_VPROC m_orig_glGetIntegeri_v = nullptr;
+void m_glGetIntegeri_v_profile(GLenum target,GLuint index,GLint* data)const{ProfilingScope const scope(this,1490);(this->*(this->m_orig_glGetIntegeri_v))(target,index,data);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGPROC m_orig_glGetTransformFeedbackVarying = nullptr;
+void m_glGetTransformFeedbackVarying_profile(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{ProfilingScope const scope(this,1491);(this->*(this->m_orig_glGetTransformFeedbackVarying))(program,index,bufSize,length,size,type,name);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FVARBPROC m_orig_glProgramLocalParameter4fvARB = nullptr;
+void m_glProgramLocalParameter4fvARB_profile(GLenum target,GLuint index,const GLfloat* params)const{ProfilingScope const scope(this,1492);(this->*(this->m_orig_glProgramLocalParameter4fvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC m_orig_glGetTransformFeedbackVaryingNV = nullptr;
+void m_glGetTransformFeedbackVaryingNV_profile(GLuint program,GLuint index,GLint* location)const{ProfilingScope const scope(this,1493);(this->*(this->m_orig_glGetTransformFeedbackVaryingNV))(program,index,location);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVPROC m_orig_glWindowPos2iv = nullptr;
+void m_glWindowPos2iv_profile(const GLint* v)const{ProfilingScope const scope(this,1494);(this->*(this->m_orig_glWindowPos2iv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM1DATIPROC m_orig_glVertexStream1dATI = nullptr;
+void m_glVertexStream1dATI_profile(GLenum stream,GLdouble x)const{ProfilingScope const scope(this,1495);(this->*(this->m_orig_glVertexStream1dATI))(stream,x);}
+FunctionTable::MEMBERPFNGLCOLORFRAGMENTOP2ATIPROC m_orig_glColorFragmentOp2ATI = nullptr;
+void m_glColorFragmentOp2ATI_profile(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod)const{ProfilingScope const scope(this,1496);(this->*(this->m_orig_glColorFragmentOp2ATI))(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+FunctionTable::MEMBERPFNGLFOGIVPROC m_orig_glFogiv = nullptr;
+void m_glFogiv_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1497);(this->*(this->m_orig_glFogiv))(pname,params);}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLENVPROC m_orig_glGetTextureHandleNV = nullptr;
+GLuint64 m_glGetTextureHandleNV_profile(GLuint texture)const{ProfilingScope const scope(this,1498);return (this->*(this->m_orig_glGetTextureHandleNV))(texture);}
+FunctionTable::MEMBERPFNGLLIGHTMODELIVPROC m_orig_glLightModeliv = nullptr;
+void m_glLightModeliv_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1499);(this->*(this->m_orig_glLightModeliv))(pname,params);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFPROC m_orig_glDepthRangef = nullptr;
+void m_glDepthRangef_profile(GLfloat n,GLfloat f)const{ProfilingScope const scope(this,1500);(this->*(this->m_orig_glDepthRangef))(n,f);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTMATERIALIVSGIXPROC m_orig_glGetFragmentMaterialivSGIX = nullptr;
+void m_glGetFragmentMaterialivSGIX_profile(GLenum face,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1501);(this->*(this->m_orig_glGetFragmentMaterialivSGIX))(face,pname,params);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC m_orig_glVideoCaptureStreamParameterfvNV = nullptr;
+void m_glVideoCaptureStreamParameterfvNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1502);(this->*(this->m_orig_glVideoCaptureStreamParameterfvNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMSARBPROC m_orig_glDeleteProgramsARB = nullptr;
+void m_glDeleteProgramsARB_profile(GLsizei n,const GLuint* programs)const{ProfilingScope const scope(this,1503);(this->*(this->m_orig_glDeleteProgramsARB))(n,programs);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVARBPROC m_orig_glWindowPos3fvARB = nullptr;
+void m_glWindowPos3fvARB_profile(const GLfloat* v)const{ProfilingScope const scope(this,1504);(this->*(this->m_orig_glWindowPos3fvARB))(v);}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERXOESPROC m_orig_glFeedbackBufferxOES = nullptr;
+void m_glFeedbackBufferxOES_profile(GLsizei n,GLenum type,const GLfixed* buffer)const{ProfilingScope const scope(this,1505);(this->*(this->m_orig_glFeedbackBufferxOES))(n,type,buffer);}
+FunctionTable::MEMBERPFNGLGETTEXBUMPPARAMETERFVATIPROC m_orig_glGetTexBumpParameterfvATI = nullptr;
+void m_glGetTexBumpParameterfvATI_profile(GLenum pname,GLfloat* param)const{ProfilingScope const scope(this,1506);(this->*(this->m_orig_glGetTexBumpParameterfvATI))(pname,param);}
+FunctionTable::MEMBERPFNGLENABLEIPROC m_orig_glEnablei = nullptr;
+void m_glEnablei_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,1507);(this->*(this->m_orig_glEnablei))(target,index);}
+FunctionTable::MEMBERPFNGLGETACTIVESUBROUTINENAMEPROC m_orig_glGetActiveSubroutineName = nullptr;
+void m_glGetActiveSubroutineName_profile(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name)const{ProfilingScope const scope(this,1508);(this->*(this->m_orig_glGetActiveSubroutineName))(program,shadertype,index,bufsize,length,name);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSARBPROC m_orig_glDrawBuffersARB = nullptr;
+void m_glDrawBuffersARB_profile(GLsizei n,const GLenum* bufs)const{ProfilingScope const scope(this,1509);(this->*(this->m_orig_glDrawBuffersARB))(n,bufs);}
+FunctionTable::MEMBERPFNGLBINDPROGRAMARBPROC m_orig_glBindProgramARB = nullptr;
+void m_glBindProgramARB_profile(GLenum target,GLuint program)const{ProfilingScope const scope(this,1510);(this->*(this->m_orig_glBindProgramARB))(target,program);}
+FunctionTable::MEMBERPFNGLEVALCOORD1FVPROC m_orig_glEvalCoord1fv = nullptr;
+void m_glEvalCoord1fv_profile(const GLfloat* u)const{ProfilingScope const scope(this,1511);(this->*(this->m_orig_glEvalCoord1fv))(u);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64VARBPROC m_orig_glProgramUniform3ui64vARB = nullptr;
+void m_glProgramUniform3ui64vARB_profile(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,1512);(this->*(this->m_orig_glProgramUniform3ui64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2DVPROC m_orig_glProgramUniformMatrix2dv = nullptr;
+void m_glProgramUniformMatrix2dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1513);(this->*(this->m_orig_glProgramUniformMatrix2dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2HVNVPROC m_orig_glMultiTexCoord2hvNV = nullptr;
+void m_glMultiTexCoord2hvNV_profile(GLenum target,const GLhalfNV* v)const{ProfilingScope const scope(this,1514);(this->*(this->m_orig_glMultiTexCoord2hvNV))(target,v);}
+FunctionTable::MEMBERPFNGLGETFLOATINDEXEDVEXTPROC m_orig_glGetFloatIndexedvEXT = nullptr;
+void m_glGetFloatIndexedvEXT_profile(GLenum target,GLuint index,GLfloat* data)const{ProfilingScope const scope(this,1515);(this->*(this->m_orig_glGetFloatIndexedvEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLSAMPLECOVERAGEARBPROC m_orig_glSampleCoverageARB = nullptr;
+void m_glSampleCoverageARB_profile(GLfloat value,GLboolean invert)const{ProfilingScope const scope(this,1516);(this->*(this->m_orig_glSampleCoverageARB))(value,invert);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64VARBPROC m_orig_glProgramUniform2ui64vARB = nullptr;
+void m_glProgramUniform2ui64vARB_profile(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,1517);(this->*(this->m_orig_glProgramUniform2ui64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLPIXELDATARANGENVPROC m_orig_glPixelDataRangeNV = nullptr;
+void m_glPixelDataRangeNV_profile(GLenum target,GLsizei length,const void* pointer)const{ProfilingScope const scope(this,1518);(this->*(this->m_orig_glPixelDataRangeNV))(target,length,pointer);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3SVATIPROC m_orig_glVertexStream3svATI = nullptr;
+void m_glVertexStream3svATI_profile(GLenum stream,const GLshort* coords)const{ProfilingScope const scope(this,1519);(this->*(this->m_orig_glVertexStream3svATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,1520);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN))(rc,tc,n,v);}
+FunctionTable::MEMBERPFNGLTEXCOORD3HVNVPROC m_orig_glTexCoord3hvNV = nullptr;
+void m_glTexCoord3hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1521);(this->*(this->m_orig_glTexCoord3hvNV))(v);}
+FunctionTable::MEMBERPFNGLSAMPLEMASKIPROC m_orig_glSampleMaski = nullptr;
+void m_glSampleMaski_profile(GLuint maskNumber,GLbitfield mask)const{ProfilingScope const scope(this,1522);(this->*(this->m_orig_glSampleMaski))(maskNumber,mask);}
+FunctionTable::MEMBERPFNGLINDEXFUNCEXTPROC m_orig_glIndexFuncEXT = nullptr;
+void m_glIndexFuncEXT_profile(GLenum func,GLclampf ref)const{ProfilingScope const scope(this,1523);(this->*(this->m_orig_glIndexFuncEXT))(func,ref);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERINVPROC m_orig_glPointParameteriNV = nullptr;
+void m_glPointParameteriNV_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,1524);(this->*(this->m_orig_glPointParameteriNV))(pname,param);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2FVPROC m_orig_glUniformMatrix3x2fv = nullptr;
+void m_glUniformMatrix3x2fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1525);(this->*(this->m_orig_glUniformMatrix3x2fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC m_orig_glGetFramebufferParameterivEXT = nullptr;
+void m_glGetFramebufferParameterivEXT_profile(GLuint framebuffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1526);(this->*(this->m_orig_glGetFramebufferParameterivEXT))(framebuffer,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64ARBPROC m_orig_glUniform2i64ARB = nullptr;
+void m_glUniform2i64ARB_profile(GLint location,GLint64 x,GLint64 y)const{ProfilingScope const scope(this,1527);(this->*(this->m_orig_glUniform2i64ARB))(location,x,y);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTPROC m_orig_glNamedBufferStorageEXT = nullptr;
+void m_glNamedBufferStorageEXT_profile(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{ProfilingScope const scope(this,1528);(this->*(this->m_orig_glNamedBufferStorageEXT))(buffer,size,data,flags);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC m_orig_glNamedFramebufferTexture3DEXT = nullptr;
+void m_glNamedFramebufferTexture3DEXT_profile(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{ProfilingScope const scope(this,1529);(this->*(this->m_orig_glNamedFramebufferTexture3DEXT))(framebuffer,attachment,textarget,texture,level,zoffset);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVPROC m_orig_glVertexAttrib2dv = nullptr;
+void m_glVertexAttrib2dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1530);(this->*(this->m_orig_glVertexAttrib2dv))(index,v);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYPOINTERVEXTPROC m_orig_glGetVertexArrayPointervEXT = nullptr;
+void m_glGetVertexArrayPointervEXT_profile(GLuint vaobj,GLenum pname,void** param)const{ProfilingScope const scope(this,1531);(this->*(this->m_orig_glGetVertexArrayPointervEXT))(vaobj,pname,param);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC m_orig_glGetVertexAttribArrayObjectivATI = nullptr;
+void m_glGetVertexAttribArrayObjectivATI_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1532);(this->*(this->m_orig_glGetVertexAttribArrayObjectivATI))(index,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC m_orig_glProgramUniformMatrix3fvEXT = nullptr;
+void m_glProgramUniformMatrix3fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1533);(this->*(this->m_orig_glProgramUniformMatrix3fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYEXTPROC m_orig_glEnableVertexArrayEXT = nullptr;
+void m_glEnableVertexArrayEXT_profile(GLuint vaobj,GLenum array)const{ProfilingScope const scope(this,1534);(this->*(this->m_orig_glEnableVertexArrayEXT))(vaobj,array);}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVSGIPROC m_orig_glColorTableParameterfvSGI = nullptr;
+void m_glColorTableParameterfvSGI_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1535);(this->*(this->m_orig_glColorTableParameterfvSGI))(target,pname,params);}
+FunctionTable::MEMBERPFNGLEDGEFLAGPROC m_orig_glEdgeFlag = nullptr;
+void m_glEdgeFlag_profile(GLboolean flag)const{ProfilingScope const scope(this,1536);(this->*(this->m_orig_glEdgeFlag))(flag);}
+FunctionTable::MEMBERPFNGLFOGCOORDFPROC m_orig_glFogCoordf = nullptr;
+void m_glFogCoordf_profile(GLfloat coord)const{ProfilingScope const scope(this,1537);(this->*(this->m_orig_glFogCoordf))(coord);}
+FunctionTable::MEMBERPFNGLVERTEX3DPROC m_orig_glVertex3d = nullptr;
+void m_glVertex3d_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,1538);(this->*(this->m_orig_glVertex3d))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEX3FPROC m_orig_glVertex3f = nullptr;
+void m_glVertex3f_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1539);(this->*(this->m_orig_glVertex3f))(x,y,z);}
+FunctionTable::MEMBERPFNGLSPRITEPARAMETERIVSGIXPROC m_orig_glSpriteParameterivSGIX = nullptr;
+void m_glSpriteParameterivSGIX_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1540);(this->*(this->m_orig_glSpriteParameterivSGIX))(pname,params);}
+FunctionTable::MEMBERPFNGLPATHGLYPHRANGENVPROC m_orig_glPathGlyphRangeNV = nullptr;
+void m_glPathGlyphRangeNV_profile(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale)const{ProfilingScope const scope(this,1541);(this->*(this->m_orig_glPathGlyphRangeNV))(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);}
+FunctionTable::MEMBERPFNGLPRIMITIVEBOUNDINGBOXARBPROC m_orig_glPrimitiveBoundingBoxARB = nullptr;
+void m_glPrimitiveBoundingBoxARB_profile(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW)const{ProfilingScope const scope(this,1542);(this->*(this->m_orig_glPrimitiveBoundingBoxARB))(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64VNVPROC m_orig_glVertexAttribL3ui64vNV = nullptr;
+void m_glVertexAttribL3ui64vNV_profile(GLuint index,const GLuint64EXT* v)const{ProfilingScope const scope(this,1543);(this->*(this->m_orig_glVertexAttribL3ui64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEX3SPROC m_orig_glVertex3s = nullptr;
+void m_glVertex3s_profile(GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,1544);(this->*(this->m_orig_glVertex3s))(x,y,z);}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIPROC m_orig_glTexCoordP2ui = nullptr;
+void m_glTexCoordP2ui_profile(GLenum type,GLuint coords)const{ProfilingScope const scope(this,1545);(this->*(this->m_orig_glTexCoordP2ui))(type,coords);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2FVEXTPROC m_orig_glProgramUniform2fvEXT = nullptr;
+void m_glProgramUniform2fvEXT_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,1546);(this->*(this->m_orig_glProgramUniform2fvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLDELETEPATHSNVPROC m_orig_glDeletePathsNV = nullptr;
+void m_glDeletePathsNV_profile(GLuint path,GLsizei range)const{ProfilingScope const scope(this,1547);(this->*(this->m_orig_glDeletePathsNV))(path,range);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXNVPROC m_orig_glPrimitiveRestartIndexNV = nullptr;
+void m_glPrimitiveRestartIndexNV_profile(GLuint index)const{ProfilingScope const scope(this,1548);(this->*(this->m_orig_glPrimitiveRestartIndexNV))(index);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC m_orig_glTexCoord2fColor3fVertex3fvSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fvSUN_profile(const GLfloat* tc,const GLfloat* c,const GLfloat* v)const{ProfilingScope const scope(this,1549);(this->*(this->m_orig_glTexCoord2fColor3fVertex3fvSUN))(tc,c,v);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERLISTIBMPROC m_orig_glTexCoordPointerListIBM = nullptr;
+void m_glTexCoordPointerListIBM_profile(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,1550);(this->*(this->m_orig_glTexCoordPointerListIBM))(size,type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLRECTXOESPROC m_orig_glRectxOES = nullptr;
+void m_glRectxOES_profile(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2)const{ProfilingScope const scope(this,1551);(this->*(this->m_orig_glRectxOES))(x1,y1,x2,y2);}
+FunctionTable::MEMBERPFNGLCOPYNAMEDBUFFERSUBDATAPROC m_orig_glCopyNamedBufferSubData = nullptr;
+void m_glCopyNamedBufferSubData_profile(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{ProfilingScope const scope(this,1552);(this->*(this->m_orig_glCopyNamedBufferSubData))(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+FunctionTable::MEMBERPFNGLGENPROGRAMSNVPROC m_orig_glGenProgramsNV = nullptr;
+void m_glGenProgramsNV_profile(GLsizei n,GLuint* programs)const{ProfilingScope const scope(this,1553);(this->*(this->m_orig_glGenProgramsNV))(n,programs);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTFSGIXPROC m_orig_glFragmentLightfSGIX = nullptr;
+void m_glFragmentLightfSGIX_profile(GLenum light,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1554);(this->*(this->m_orig_glFragmentLightfSGIX))(light,pname,param);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DPROC m_orig_glTexStorage3D = nullptr;
+void m_glTexStorage3D_profile(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,1555);(this->*(this->m_orig_glTexStorage3D))(target,levels,internalformat,width,height,depth);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIVPROC m_orig_glTextureParameteriv = nullptr;
+void m_glTextureParameteriv_profile(GLuint texture,GLenum pname,const GLint* param)const{ProfilingScope const scope(this,1556);(this->*(this->m_orig_glTextureParameteriv))(texture,pname,param);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERDATAEXTPROC m_orig_glNamedBufferDataEXT = nullptr;
+void m_glNamedBufferDataEXT_profile(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage)const{ProfilingScope const scope(this,1557);(this->*(this->m_orig_glNamedBufferDataEXT))(buffer,size,data,usage);}
+FunctionTable::MEMBERPFNGLIMPORTSEMAPHOREWIN32NAMEEXTPROC m_orig_glImportSemaphoreWin32NameEXT = nullptr;
+void m_glImportSemaphoreWin32NameEXT_profile(GLuint semaphore,GLenum handleType,const void* name)const{ProfilingScope const scope(this,1558);(this->*(this->m_orig_glImportSemaphoreWin32NameEXT))(semaphore,handleType,name);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVARBPROC m_orig_glMultiTexCoord3fvARB = nullptr;
+void m_glMultiTexCoord3fvARB_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,1559);(this->*(this->m_orig_glMultiTexCoord3fvARB))(target,v);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X4FVPROC m_orig_glUniformMatrix3x4fv = nullptr;
+void m_glUniformMatrix3x4fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1560);(this->*(this->m_orig_glUniformMatrix3x4fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLSUBPIXELPRECISIONBIASNVPROC m_orig_glSubpixelPrecisionBiasNV = nullptr;
+void m_glSubpixelPrecisionBiasNV_profile(GLuint xbits,GLuint ybits)const{ProfilingScope const scope(this,1561);(this->*(this->m_orig_glSubpixelPrecisionBiasNV))(xbits,ybits);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERPROC m_orig_glNormalPointer = nullptr;
+void m_glNormalPointer_profile(GLenum type,GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,1562);(this->*(this->m_orig_glNormalPointer))(type,stride,ptr);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTUREPROC m_orig_glNamedFramebufferTexture = nullptr;
+void m_glNamedFramebufferTexture_profile(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level)const{ProfilingScope const scope(this,1563);(this->*(this->m_orig_glNamedFramebufferTexture))(framebuffer,attachment,texture,level);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVARBPROC m_orig_glVertexAttrib4NsvARB = nullptr;
+void m_glVertexAttrib4NsvARB_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,1564);(this->*(this->m_orig_glVertexAttrib4NsvARB))(index,v);}
+FunctionTable::MEMBERPFNGLPASSTHROUGHPROC m_orig_glPassThrough = nullptr;
+void m_glPassThrough_profile(GLfloat token)const{ProfilingScope const scope(this,1565);(this->*(this->m_orig_glPassThrough))(token);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORP3UIPROC m_orig_glSecondaryColorP3ui = nullptr;
+void m_glSecondaryColorP3ui_profile(GLenum type,GLuint color)const{ProfilingScope const scope(this,1566);(this->*(this->m_orig_glSecondaryColorP3ui))(type,color);}
+FunctionTable::MEMBERPFNGLINVALIDATETEXSUBIMAGEPROC m_orig_glInvalidateTexSubImage = nullptr;
+void m_glInvalidateTexSubImage_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,1567);(this->*(this->m_orig_glInvalidateTexSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth);}
+FunctionTable::MEMBERPFNGLISIMAGEHANDLERESIDENTARBPROC m_orig_glIsImageHandleResidentARB = nullptr;
+GLboolean m_glIsImageHandleResidentARB_profile(GLuint64 handle)const{ProfilingScope const scope(this,1568);return (this->*(this->m_orig_glIsImageHandleResidentARB))(handle);}
+FunctionTable::MEMBERPFNGLTANGENT3FVEXTPROC m_orig_glTangent3fvEXT = nullptr;
+void m_glTangent3fvEXT_profile(const GLfloat* v)const{ProfilingScope const scope(this,1569);(this->*(this->m_orig_glTangent3fvEXT))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3FVPROC m_orig_glProgramUniformMatrix4x3fv = nullptr;
+void m_glProgramUniformMatrix4x3fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1570);(this->*(this->m_orig_glProgramUniformMatrix4x3fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLBEGINPROC m_orig_glBegin = nullptr;
+void m_glBegin_profile(GLenum mode)const{ProfilingScope const scope(this,1571);(this->*(this->m_orig_glBegin))(mode);}
+FunctionTable::MEMBERPFNGLEVALCOORD2DVPROC m_orig_glEvalCoord2dv = nullptr;
+void m_glEvalCoord2dv_profile(const GLdouble* u)const{ProfilingScope const scope(this,1572);(this->*(this->m_orig_glEvalCoord2dv))(u);}
+FunctionTable::MEMBERPFNGLCOLOR3UBVPROC m_orig_glColor3ubv = nullptr;
+void m_glColor3ubv_profile(const GLubyte* v)const{ProfilingScope const scope(this,1573);(this->*(this->m_orig_glColor3ubv))(v);}
+FunctionTable::MEMBERPFNGLFOGCOORDFVEXTPROC m_orig_glFogCoordfvEXT = nullptr;
+void m_glFogCoordfvEXT_profile(const GLfloat* coord)const{ProfilingScope const scope(this,1574);(this->*(this->m_orig_glFogCoordfvEXT))(coord);}
+FunctionTable::MEMBERPFNGLVERTEXP3UIPROC m_orig_glVertexP3ui = nullptr;
+void m_glVertexP3ui_profile(GLenum type,GLuint value)const{ProfilingScope const scope(this,1575);(this->*(this->m_orig_glVertexP3ui))(type,value);}
+FunctionTable::MEMBERPFNGLLIGHTFVPROC m_orig_glLightfv = nullptr;
+void m_glLightfv_profile(GLenum light,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1576);(this->*(this->m_orig_glLightfv))(light,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3I64NVPROC m_orig_glVertexAttribL3i64NV = nullptr;
+void m_glVertexAttribL3i64NV_profile(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{ProfilingScope const scope(this,1577);(this->*(this->m_orig_glVertexAttribL3i64NV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLSTENCILCLEARTAGEXTPROC m_orig_glStencilClearTagEXT = nullptr;
+void m_glStencilClearTagEXT_profile(GLsizei stencilTagBits,GLuint stencilClearTag)const{ProfilingScope const scope(this,1578);(this->*(this->m_orig_glStencilClearTagEXT))(stencilTagBits,stencilClearTag);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMNAMEPROC m_orig_glGetActiveUniformName = nullptr;
+void m_glGetActiveUniformName_profile(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName)const{ProfilingScope const scope(this,1579);(this->*(this->m_orig_glGetActiveUniformName))(program,uniformIndex,bufSize,length,uniformName);}
+FunctionTable::MEMBERPFNGLTANGENTPOINTEREXTPROC m_orig_glTangentPointerEXT = nullptr;
+void m_glTangentPointerEXT_profile(GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,1580);(this->*(this->m_orig_glTangentPointerEXT))(type,stride,pointer);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VNVPROC m_orig_glUniform4ui64vNV = nullptr;
+void m_glUniform4ui64vNV_profile(GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1581);(this->*(this->m_orig_glUniform4ui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEENABLEAMDPROC m_orig_glDebugMessageEnableAMD = nullptr;
+void m_glDebugMessageEnableAMD_profile(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{ProfilingScope const scope(this,1582);(this->*(this->m_orig_glDebugMessageEnableAMD))(category,severity,count,ids,enabled);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIPROC m_orig_glProgramUniform2ui = nullptr;
+void m_glProgramUniform2ui_profile(GLuint program,GLint location,GLuint v0,GLuint v1)const{ProfilingScope const scope(this,1583);(this->*(this->m_orig_glProgramUniform2ui))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE2DEXTPROC m_orig_glCopyTexSubImage2DEXT = nullptr;
+void m_glCopyTexSubImage2DEXT_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1584);(this->*(this->m_orig_glCopyTexSubImage2DEXT))(target,level,xoffset,yoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLGENRENDERBUFFERSEXTPROC m_orig_glGenRenderbuffersEXT = nullptr;
+void m_glGenRenderbuffersEXT_profile(GLsizei n,GLuint* renderbuffers)const{ProfilingScope const scope(this,1585);(this->*(this->m_orig_glGenRenderbuffersEXT))(n,renderbuffers);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC m_orig_glNamedProgramLocalParameterI4ivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4ivEXT_profile(GLuint program,GLenum target,GLuint index,const GLint* params)const{ProfilingScope const scope(this,1586);(this->*(this->m_orig_glNamedProgramLocalParameterI4ivEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FPROC m_orig_glMultiTexCoord2f = nullptr;
+void m_glMultiTexCoord2f_profile(GLenum target,GLfloat s,GLfloat t)const{ProfilingScope const scope(this,1587);(this->*(this->m_orig_glMultiTexCoord2f))(target,s,t);}
+FunctionTable::MEMBERPFNGLMAPGRID2DPROC m_orig_glMapGrid2d = nullptr;
+void m_glMapGrid2d_profile(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2)const{ProfilingScope const scope(this,1588);(this->*(this->m_orig_glMapGrid2d))(un,u1,u2,vn,v1,v2);}
+FunctionTable::MEMBERPFNGLGETMULTITEXPARAMETERIUIVEXTPROC m_orig_glGetMultiTexParameterIuivEXT = nullptr;
+void m_glGetMultiTexParameterIuivEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,1589);(this->*(this->m_orig_glGetMultiTexParameterIuivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIARBPROC m_orig_glBlendEquationiARB = nullptr;
+void m_glBlendEquationiARB_profile(GLuint buf,GLenum mode)const{ProfilingScope const scope(this,1590);(this->*(this->m_orig_glBlendEquationiARB))(buf,mode);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIVPROC m_orig_glTexParameteriv = nullptr;
+void m_glTexParameteriv_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1591);(this->*(this->m_orig_glTexParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM4IVARBPROC m_orig_glUniform4ivARB = nullptr;
+void m_glUniform4ivARB_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1592);(this->*(this->m_orig_glUniform4ivARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLMATRIXORTHOEXTPROC m_orig_glMatrixOrthoEXT = nullptr;
+void m_glMatrixOrthoEXT_profile(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar)const{ProfilingScope const scope(this,1593);(this->*(this->m_orig_glMatrixOrthoEXT))(mode,left,right,bottom,top,zNear,zFar);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXBUFFERPROC m_orig_glVertexArrayVertexBuffer = nullptr;
+void m_glVertexArrayVertexBuffer_profile(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride)const{ProfilingScope const scope(this,1594);(this->*(this->m_orig_glVertexArrayVertexBuffer))(vaobj,bindingindex,buffer,offset,stride);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC m_orig_glProgramLocalParametersI4ivNV = nullptr;
+void m_glProgramLocalParametersI4ivNV_profile(GLenum target,GLuint index,GLsizei count,const GLint* params)const{ProfilingScope const scope(this,1595);(this->*(this->m_orig_glProgramLocalParametersI4ivNV))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VNVPROC m_orig_glProgramUniform4ui64vNV = nullptr;
+void m_glProgramUniform4ui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1596);(this->*(this->m_orig_glProgramUniform4ui64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETNAMEDSTRINGIVARBPROC m_orig_glGetNamedStringivARB = nullptr;
+void m_glGetNamedStringivARB_profile(GLint namelen,const GLchar* name,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1597);(this->*(this->m_orig_glGetNamedStringivARB))(namelen,name,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1I64VNVPROC m_orig_glVertexAttribL1i64vNV = nullptr;
+void m_glVertexAttribL1i64vNV_profile(GLuint index,const GLint64EXT* v)const{ProfilingScope const scope(this,1598);(this->*(this->m_orig_glVertexAttribL1i64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKBUFFERBASEPROC m_orig_glTransformFeedbackBufferBase = nullptr;
+void m_glTransformFeedbackBufferBase_profile(GLuint xfb,GLuint index,GLuint buffer)const{ProfilingScope const scope(this,1599);(this->*(this->m_orig_glTransformFeedbackBufferBase))(xfb,index,buffer);}
+FunctionTable::MEMBERPFNGLINDEXSVPROC m_orig_glIndexsv = nullptr;
+void m_glIndexsv_profile(const GLshort* c)const{ProfilingScope const scope(this,1600);(this->*(this->m_orig_glIndexsv))(c);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVNVPROC m_orig_glPointParameterivNV = nullptr;
+void m_glPointParameterivNV_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1601);(this->*(this->m_orig_glPointParameterivNV))(pname,params);}
+FunctionTable::MEMBERPFNGLGETDETAILTEXFUNCSGISPROC m_orig_glGetDetailTexFuncSGIS = nullptr;
+void m_glGetDetailTexFuncSGIS_profile(GLenum target,GLfloat* points)const{ProfilingScope const scope(this,1602);(this->*(this->m_orig_glGetDetailTexFuncSGIS))(target,points);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiColor3fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiColor3fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* c,const GLfloat* v)const{ProfilingScope const scope(this,1603);(this->*(this->m_orig_glReplacementCodeuiColor3fVertex3fvSUN))(rc,c,v);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4FARBPROC m_orig_glProgramLocalParameter4fARB = nullptr;
+void m_glProgramLocalParameter4fARB_profile(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,1604);(this->*(this->m_orig_glProgramLocalParameter4fARB))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLBITMAPPROC m_orig_glBitmap = nullptr;
+void m_glBitmap_profile(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap)const{ProfilingScope const scope(this,1605);(this->*(this->m_orig_glBitmap))(width,height,xorig,yorig,xmove,ymove,bitmap);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC m_orig_glNamedFramebufferTextureLayerEXT = nullptr;
+void m_glNamedFramebufferTextureLayerEXT_profile(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer)const{ProfilingScope const scope(this,1606);(this->*(this->m_orig_glNamedFramebufferTextureLayerEXT))(framebuffer,attachment,texture,level,layer);}
+FunctionTable::MEMBERPFNGLMULTITEXGENFVEXTPROC m_orig_glMultiTexGenfvEXT = nullptr;
+void m_glMultiTexGenfvEXT_profile(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1607);(this->*(this->m_orig_glMultiTexGenfvEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERSUBDATAPROC m_orig_glGetNamedBufferSubData = nullptr;
+void m_glGetNamedBufferSubData_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data)const{ProfilingScope const scope(this,1608);(this->*(this->m_orig_glGetNamedBufferSubData))(buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLSTENCILFUNCSEPARATEATIPROC m_orig_glStencilFuncSeparateATI = nullptr;
+void m_glStencilFuncSeparateATI_profile(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask)const{ProfilingScope const scope(this,1609);(this->*(this->m_orig_glStencilFuncSeparateATI))(frontfunc,backfunc,ref,mask);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVPROC m_orig_glProgramUniform2iv = nullptr;
+void m_glProgramUniform2iv_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1610);(this->*(this->m_orig_glProgramUniform2iv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETQUERYIVPROC m_orig_glGetQueryiv = nullptr;
+void m_glGetQueryiv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1611);(this->*(this->m_orig_glGetQueryiv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FPROC m_orig_glTexCoord4f = nullptr;
+void m_glTexCoord4f_profile(GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{ProfilingScope const scope(this,1612);(this->*(this->m_orig_glTexCoord4f))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLMAPGRID2FPROC m_orig_glMapGrid2f = nullptr;
+void m_glMapGrid2f_profile(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2)const{ProfilingScope const scope(this,1613);(this->*(this->m_orig_glMapGrid2f))(un,u1,u2,vn,v1,v2);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERIVSGIXPROC m_orig_glListParameterivSGIX = nullptr;
+void m_glListParameterivSGIX_profile(GLuint list,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1614);(this->*(this->m_orig_glListParameterivSGIX))(list,pname,params);}
+FunctionTable::MEMBERPFNGLCREATEQUERIESPROC m_orig_glCreateQueries = nullptr;
+void m_glCreateQueries_profile(GLenum target,GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,1615);(this->*(this->m_orig_glCreateQueries))(target,n,ids);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERFVPROC m_orig_glGetSamplerParameterfv = nullptr;
+void m_glGetSamplerParameterfv_profile(GLuint sampler,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1616);(this->*(this->m_orig_glGetSamplerParameterfv))(sampler,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4IPROC m_orig_glTexCoord4i = nullptr;
+void m_glTexCoord4i_profile(GLint s,GLint t,GLint r,GLint q)const{ProfilingScope const scope(this,1617);(this->*(this->m_orig_glTexCoord4i))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLOBJECTLABELPROC m_orig_glObjectLabel = nullptr;
+void m_glObjectLabel_profile(GLenum identifier,GLuint name,GLsizei length,const GLchar* label)const{ProfilingScope const scope(this,1618);(this->*(this->m_orig_glObjectLabel))(identifier,name,length,label);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64NVPROC m_orig_glProgramUniform3i64NV = nullptr;
+void m_glProgramUniform3i64NV_profile(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z)const{ProfilingScope const scope(this,1619);(this->*(this->m_orig_glProgramUniform3i64NV))(program,location,x,y,z);}
+FunctionTable::MEMBERPFNGLGETTEXTUREHANDLEARBPROC m_orig_glGetTextureHandleARB = nullptr;
+GLuint64 m_glGetTextureHandleARB_profile(GLuint texture)const{ProfilingScope const scope(this,1620);return (this->*(this->m_orig_glGetTextureHandleARB))(texture);}
+FunctionTable::MEMBERPFNGLTEXCOORD4SPROC m_orig_glTexCoord4s = nullptr;
+void m_glTexCoord4s_profile(GLshort s,GLshort t,GLshort r,GLshort q)const{ProfilingScope const scope(this,1621);(this->*(this->m_orig_glTexCoord4s))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLUNIFORM4IARBPROC m_orig_glUniform4iARB = nullptr;
+void m_glUniform4iARB_profile(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{ProfilingScope const scope(this,1622);(this->*(this->m_orig_glUniform4iARB))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLGETUNIFORMINDICESPROC m_orig_glGetUniformIndices = nullptr;
+void m_glGetUniformIndices_profile(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices)const{ProfilingScope const scope(this,1623);(this->*(this->m_orig_glGetUniformIndices))(program,uniformCount,uniformNames,uniformIndices);}
+FunctionTable::MEMBERPFNGLMULTITEXIMAGE3DEXTPROC m_orig_glMultiTexImage3DEXT = nullptr;
+void m_glMultiTexImage3DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1624);(this->*(this->m_orig_glMultiTexImage3DEXT))(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLCOVERAGEMODULATIONTABLENVPROC m_orig_glCoverageModulationTableNV = nullptr;
+void m_glCoverageModulationTableNV_profile(GLsizei n,const GLfloat* v)const{ProfilingScope const scope(this,1625);(this->*(this->m_orig_glCoverageModulationTableNV))(n,v);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERIVPROC m_orig_glPointParameteriv = nullptr;
+void m_glPointParameteriv_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1626);(this->*(this->m_orig_glPointParameteriv))(pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SVARBPROC m_orig_glMultiTexCoord4svARB = nullptr;
+void m_glMultiTexCoord4svARB_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,1627);(this->*(this->m_orig_glMultiTexCoord4svARB))(target,v);}
+FunctionTable::MEMBERPFNGLNORMAL3FVPROC m_orig_glNormal3fv = nullptr;
+void m_glNormal3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1628);(this->*(this->m_orig_glNormal3fv))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVEXTPROC m_orig_glProgramUniformMatrix3x4dvEXT = nullptr;
+void m_glProgramUniformMatrix3x4dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1629);(this->*(this->m_orig_glProgramUniformMatrix3x4dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTEXCOORD1FVPROC m_orig_glTexCoord1fv = nullptr;
+void m_glTexCoord1fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1630);(this->*(this->m_orig_glTexCoord1fv))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVEXTPROC m_orig_glProgramUniformMatrix4x3dvEXT = nullptr;
+void m_glProgramUniformMatrix4x3dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1631);(this->*(this->m_orig_glProgramUniformMatrix4x3dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETACTIVEVARYINGNVPROC m_orig_glGetActiveVaryingNV = nullptr;
+void m_glGetActiveVaryingNV_profile(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{ProfilingScope const scope(this,1632);(this->*(this->m_orig_glGetActiveVaryingNV))(program,index,bufSize,length,size,type,name);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VARBPROC m_orig_glUniform1i64vARB = nullptr;
+void m_glUniform1i64vARB_profile(GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,1633);(this->*(this->m_orig_glUniform1i64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DVPROC m_orig_glMultiTexCoord1dv = nullptr;
+void m_glMultiTexCoord1dv_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,1634);(this->*(this->m_orig_glMultiTexCoord1dv))(target,v);}
+FunctionTable::MEMBERPFNGLTEXCOORD3FVPROC m_orig_glTexCoord3fv = nullptr;
+void m_glTexCoord3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1635);(this->*(this->m_orig_glTexCoord3fv))(v);}
+FunctionTable::MEMBERPFNGLMATRIXTRANSLATEFEXTPROC m_orig_glMatrixTranslatefEXT = nullptr;
+void m_glMatrixTranslatefEXT_profile(GLenum mode,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1636);(this->*(this->m_orig_glMatrixTranslatefEXT))(mode,x,y,z);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64VNVPROC m_orig_glProgramUniform1ui64vNV = nullptr;
+void m_glProgramUniform1ui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,1637);(this->*(this->m_orig_glProgramUniform1ui64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLTEXTUREMATERIALEXTPROC m_orig_glTextureMaterialEXT = nullptr;
+void m_glTextureMaterialEXT_profile(GLenum face,GLenum mode)const{ProfilingScope const scope(this,1638);(this->*(this->m_orig_glTextureMaterialEXT))(face,mode);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIVPROC m_orig_glMultiTexCoordP3uiv = nullptr;
+void m_glMultiTexCoordP3uiv_profile(GLenum texture,GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,1639);(this->*(this->m_orig_glMultiTexCoordP3uiv))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIPROC m_orig_glVertexAttribP3ui = nullptr;
+void m_glVertexAttribP3ui_profile(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{ProfilingScope const scope(this,1640);(this->*(this->m_orig_glVertexAttribP3ui))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLINTERPOLATEPATHSNVPROC m_orig_glInterpolatePathsNV = nullptr;
+void m_glInterpolatePathsNV_profile(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight)const{ProfilingScope const scope(this,1641);(this->*(this->m_orig_glInterpolatePathsNV))(resultPath,pathA,pathB,weight);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEPROC m_orig_glTextureBufferRange = nullptr;
+void m_glTextureBufferRange_profile(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,1642);(this->*(this->m_orig_glTextureBufferRange))(texture,internalformat,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2DEXTPROC m_orig_glVertexAttribL2dEXT = nullptr;
+void m_glVertexAttribL2dEXT_profile(GLuint index,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1643);(this->*(this->m_orig_glVertexAttribL2dEXT))(index,x,y);}
+FunctionTable::MEMBERPFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC m_orig_glGetPixelTransformParameterivEXT = nullptr;
+void m_glGetPixelTransformParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1644);(this->*(this->m_orig_glGetPixelTransformParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4XVOESPROC m_orig_glTexCoord4xvOES = nullptr;
+void m_glTexCoord4xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,1645);(this->*(this->m_orig_glTexCoord4xvOES))(coords);}
+FunctionTable::MEMBERPFNGLGETVARIANTBOOLEANVEXTPROC m_orig_glGetVariantBooleanvEXT = nullptr;
+void m_glGetVariantBooleanvEXT_profile(GLuint id,GLenum value,GLboolean* data)const{ProfilingScope const scope(this,1646);(this->*(this->m_orig_glGetVariantBooleanvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEPROC m_orig_glDepthRange = nullptr;
+void m_glDepthRange_profile(GLclampd near_val,GLclampd far_val)const{ProfilingScope const scope(this,1647);(this->*(this->m_orig_glDepthRange))(near_val,far_val);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVARBPROC m_orig_glGetVertexAttribdvARB = nullptr;
+void m_glGetVertexAttribdvARB_profile(GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1648);(this->*(this->m_orig_glGetVertexAttribdvARB))(index,pname,params);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVPROC m_orig_glGetColorTableParameterfv = nullptr;
+void m_glGetColorTableParameterfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1649);(this->*(this->m_orig_glGetColorTableParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDEXTPROC m_orig_glDrawArraysInstancedEXT = nullptr;
+void m_glDrawArraysInstancedEXT_profile(GLenum mode,GLint start,GLsizei count,GLsizei primcount)const{ProfilingScope const scope(this,1650);(this->*(this->m_orig_glDrawArraysInstancedEXT))(mode,start,count,primcount);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEINDEXEDEXTPROC m_orig_glDisableClientStateIndexedEXT = nullptr;
+void m_glDisableClientStateIndexedEXT_profile(GLenum array,GLuint index)const{ProfilingScope const scope(this,1651);(this->*(this->m_orig_glDisableClientStateIndexedEXT))(array,index);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERPROC m_orig_glDrawBuffer = nullptr;
+void m_glDrawBuffer_profile(GLenum mode)const{ProfilingScope const scope(this,1652);(this->*(this->m_orig_glDrawBuffer))(mode);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC m_orig_glMultiDrawArraysIndirectBindlessNV = nullptr;
+void m_glMultiDrawArraysIndirectBindlessNV_profile(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount)const{ProfilingScope const scope(this,1653);(this->*(this->m_orig_glMultiDrawArraysIndirectBindlessNV))(mode,indirect,drawCount,stride,vertexBufferCount);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVPROC m_orig_glGetnPixelMapusv = nullptr;
+void m_glGetnPixelMapusv_profile(GLenum map,GLsizei bufSize,GLushort* values)const{ProfilingScope const scope(this,1654);(this->*(this->m_orig_glGetnPixelMapusv))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLRASTERPOS3FVPROC m_orig_glRasterPos3fv = nullptr;
+void m_glRasterPos3fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,1655);(this->*(this->m_orig_glRasterPos3fv))(v);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERUIVPROC m_orig_glClearBufferuiv = nullptr;
+void m_glClearBufferuiv_profile(GLenum buffer,GLint drawbuffer,const GLuint* value)const{ProfilingScope const scope(this,1656);(this->*(this->m_orig_glClearBufferuiv))(buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLGETINTERNALFORMATI64VPROC m_orig_glGetInternalformati64v = nullptr;
+void m_glGetInternalformati64v_profile(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params)const{ProfilingScope const scope(this,1657);(this->*(this->m_orig_glGetInternalformati64v))(target,internalformat,pname,bufSize,params);}
+FunctionTable::MEMBERPFNGLSHADERSOURCEARBPROC m_orig_glShaderSourceARB = nullptr;
+void m_glShaderSourceARB_profile(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length)const{ProfilingScope const scope(this,1658);(this->*(this->m_orig_glShaderSourceARB))(shaderObj,count,string,length);}
+FunctionTable::MEMBERPFNGLSHADEROP3EXTPROC m_orig_glShaderOp3EXT = nullptr;
+void m_glShaderOp3EXT_profile(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3)const{ProfilingScope const scope(this,1659);(this->*(this->m_orig_glShaderOp3EXT))(op,res,arg1,arg2,arg3);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVMESAPROC m_orig_glWindowPos2dvMESA = nullptr;
+void m_glWindowPos2dvMESA_profile(const GLdouble* v)const{ProfilingScope const scope(this,1660);(this->*(this->m_orig_glWindowPos2dvMESA))(v);}
+FunctionTable::MEMBERPFNGLCLEARINDEXPROC m_orig_glClearIndex = nullptr;
+void m_glClearIndex_profile(GLfloat c)const{ProfilingScope const scope(this,1661);(this->*(this->m_orig_glClearIndex))(c);}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXEXTPROC m_orig_glProvokingVertexEXT = nullptr;
+void m_glProvokingVertexEXT_profile(GLenum mode)const{ProfilingScope const scope(this,1662);(this->*(this->m_orig_glProvokingVertexEXT))(mode);}
+FunctionTable::MEMBERPFNGLVARIANTUBVEXTPROC m_orig_glVariantubvEXT = nullptr;
+void m_glVariantubvEXT_profile(GLuint id,const GLubyte* addr)const{ProfilingScope const scope(this,1663);(this->*(this->m_orig_glVariantubvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLFLUSHPROC m_orig_glFlush = nullptr;
+void m_glFlush_profile()const{ProfilingScope const scope(this,1664);(this->*(this->m_orig_glFlush))();}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE2DEXTPROC m_orig_glFramebufferTexture2DEXT = nullptr;
+void m_glFramebufferTexture2DEXT_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,1665);(this->*(this->m_orig_glFramebufferTexture2DEXT))(target,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVEXTPROC m_orig_glGetColorTableParameterivEXT = nullptr;
+void m_glGetColorTableParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1666);(this->*(this->m_orig_glGetColorTableParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEDUALFILLNVPROC m_orig_glPresentFrameDualFillNV = nullptr;
+void m_glPresentFrameDualFillNV_profile(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3)const{ProfilingScope const scope(this,1667);(this->*(this->m_orig_glPresentFrameDualFillNV))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);}
+FunctionTable::MEMBERPFNGLGENVERTEXSHADERSEXTPROC m_orig_glGenVertexShadersEXT = nullptr;
+GLuint m_glGenVertexShadersEXT_profile(GLuint range)const{ProfilingScope const scope(this,1668);return (this->*(this->m_orig_glGenVertexShadersEXT))(range);}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERARBPROC m_orig_glSpecializeShaderARB = nullptr;
+void m_glSpecializeShaderARB_profile(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{ProfilingScope const scope(this,1669);(this->*(this->m_orig_glSpecializeShaderARB))(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC m_orig_glProgramUniformHandleui64vARB = nullptr;
+void m_glProgramUniformHandleui64vARB_profile(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{ProfilingScope const scope(this,1670);(this->*(this->m_orig_glProgramUniformHandleui64vARB))(program,location,count,values);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEFOESPROC m_orig_glDepthRangefOES = nullptr;
+void m_glDepthRangefOES_profile(GLclampf n,GLclampf f)const{ProfilingScope const scope(this,1671);(this->*(this->m_orig_glDepthRangefOES))(n,f);}
+FunctionTable::MEMBERPFNGLDELETEVERTEXARRAYSPROC m_orig_glDeleteVertexArrays = nullptr;
+void m_glDeleteVertexArrays_profile(GLsizei n,const GLuint* arrays)const{ProfilingScope const scope(this,1672);(this->*(this->m_orig_glDeleteVertexArrays))(n,arrays);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC m_orig_glDrawElementsInstancedBaseVertexBaseInstance = nullptr;
+void m_glDrawElementsInstancedBaseVertexBaseInstance_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance)const{ProfilingScope const scope(this,1673);(this->*(this->m_orig_glDrawElementsInstancedBaseVertexBaseInstance))(mode,count,type,indices,instancecount,basevertex,baseinstance);}
+FunctionTable::MEMBERPFNGLGETTEXLEVELPARAMETERIVPROC m_orig_glGetTexLevelParameteriv = nullptr;
+void m_glGetTexLevelParameteriv_profile(GLenum target,GLint level,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1674);(this->*(this->m_orig_glGetTexLevelParameteriv))(target,level,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWVKIMAGENVPROC m_orig_glDrawVkImageNV = nullptr;
+void m_glDrawVkImageNV_profile(GLuint64 vkImage,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1)const{ProfilingScope const scope(this,1675);(this->*(this->m_orig_glDrawVkImageNV))(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IARBPROC m_orig_glWindowPos3iARB = nullptr;
+void m_glWindowPos3iARB_profile(GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,1676);(this->*(this->m_orig_glWindowPos3iARB))(x,y,z);}
+FunctionTable::MEMBERPFNGLPRIORITIZETEXTURESPROC m_orig_glPrioritizeTextures = nullptr;
+void m_glPrioritizeTextures_profile(GLsizei n,const GLuint* textures,const GLclampf* priorities)const{ProfilingScope const scope(this,1677);(this->*(this->m_orig_glPrioritizeTextures))(n,textures,priorities);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FVMESAPROC m_orig_glWindowPos3fvMESA = nullptr;
+void m_glWindowPos3fvMESA_profile(const GLfloat* v)const{ProfilingScope const scope(this,1678);(this->*(this->m_orig_glWindowPos3fvMESA))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVEXTPROC m_orig_glProgramUniformMatrix3x2dvEXT = nullptr;
+void m_glProgramUniformMatrix3x2dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1679);(this->*(this->m_orig_glProgramUniformMatrix3x2dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEX4XVOESPROC m_orig_glVertex4xvOES = nullptr;
+void m_glVertex4xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,1680);(this->*(this->m_orig_glVertex4xvOES))(coords);}
+FunctionTable::MEMBERPFNGLTEXSTORAGE3DMULTISAMPLEPROC m_orig_glTexStorage3DMultisample = nullptr;
+void m_glTexStorage3DMultisample_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,1681);(this->*(this->m_orig_glTexStorage3DMultisample))(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SARBPROC m_orig_glWindowPos2sARB = nullptr;
+void m_glWindowPos2sARB_profile(GLshort x,GLshort y)const{ProfilingScope const scope(this,1682);(this->*(this->m_orig_glWindowPos2sARB))(x,y);}
+FunctionTable::MEMBERPFNGLSTENCILOPVALUEAMDPROC m_orig_glStencilOpValueAMD = nullptr;
+void m_glStencilOpValueAMD_profile(GLenum face,GLuint value)const{ProfilingScope const scope(this,1683);(this->*(this->m_orig_glStencilOpValueAMD))(face,value);}
+FunctionTable::MEMBERPFNGLPROGRAMVERTEXLIMITNVPROC m_orig_glProgramVertexLimitNV = nullptr;
+void m_glProgramVertexLimitNV_profile(GLenum target,GLint limit)const{ProfilingScope const scope(this,1684);(this->*(this->m_orig_glProgramVertexLimitNV))(target,limit);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERPOINTERVAPPLEPROC m_orig_glGetTexParameterPointervAPPLE = nullptr;
+void m_glGetTexParameterPointervAPPLE_profile(GLenum target,GLenum pname,void** params)const{ProfilingScope const scope(this,1685);(this->*(this->m_orig_glGetTexParameterPointervAPPLE))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIVEXTPROC m_orig_glProgramUniform3uivEXT = nullptr;
+void m_glProgramUniform3uivEXT_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1686);(this->*(this->m_orig_glProgramUniform3uivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLCLAMPCOLORPROC m_orig_glClampColor = nullptr;
+void m_glClampColor_profile(GLenum target,GLenum clamp)const{ProfilingScope const scope(this,1687);(this->*(this->m_orig_glClampColor))(target,clamp);}
+FunctionTable::MEMBERPFNGLCLEARSTENCILPROC m_orig_glClearStencil = nullptr;
+void m_glClearStencil_profile(GLint s)const{ProfilingScope const scope(this,1688);(this->*(this->m_orig_glClearStencil))(s);}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIVPROC m_orig_glTexCoordP1uiv = nullptr;
+void m_glTexCoordP1uiv_profile(GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,1689);(this->*(this->m_orig_glTexCoordP1uiv))(type,coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3SVNVPROC m_orig_glVertexAttribs3svNV = nullptr;
+void m_glVertexAttribs3svNV_profile(GLuint index,GLsizei count,const GLshort* v)const{ProfilingScope const scope(this,1690);(this->*(this->m_orig_glVertexAttribs3svNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FVPROC m_orig_glMultiTexCoord3fv = nullptr;
+void m_glMultiTexCoord3fv_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,1691);(this->*(this->m_orig_glMultiTexCoord3fv))(target,v);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDENVFATIPROC m_orig_glVertexBlendEnvfATI = nullptr;
+void m_glVertexBlendEnvfATI_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1692);(this->*(this->m_orig_glVertexBlendEnvfATI))(pname,param);}
+FunctionTable::MEMBERPFNGLISFENCEAPPLEPROC m_orig_glIsFenceAPPLE = nullptr;
+GLboolean m_glIsFenceAPPLE_profile(GLuint fence)const{ProfilingScope const scope(this,1693);return (this->*(this->m_orig_glIsFenceAPPLE))(fence);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERUI64VNVPROC m_orig_glGetBufferParameterui64vNV = nullptr;
+void m_glGetBufferParameterui64vNV_profile(GLenum target,GLenum pname,GLuint64EXT* params)const{ProfilingScope const scope(this,1694);(this->*(this->m_orig_glGetBufferParameterui64vNV))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVEXTPROC m_orig_glVertexAttribI4bvEXT = nullptr;
+void m_glVertexAttribI4bvEXT_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,1695);(this->*(this->m_orig_glVertexAttribI4bvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLUNIFORM2FARBPROC m_orig_glUniform2fARB = nullptr;
+void m_glUniform2fARB_profile(GLint location,GLfloat v0,GLfloat v1)const{ProfilingScope const scope(this,1696);(this->*(this->m_orig_glUniform2fARB))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLSTOPINSTRUMENTSSGIXPROC m_orig_glStopInstrumentsSGIX = nullptr;
+void m_glStopInstrumentsSGIX_profile(GLint marker)const{ProfilingScope const scope(this,1697);(this->*(this->m_orig_glStopInstrumentsSGIX))(marker);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FNVPROC m_orig_glVertexAttrib3fNV = nullptr;
+void m_glVertexAttrib3fNV_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1698);(this->*(this->m_orig_glVertexAttrib3fNV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB2DAPPLEPROC m_orig_glMapVertexAttrib2dAPPLE = nullptr;
+void m_glMapVertexAttrib2dAPPLE_profile(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points)const{ProfilingScope const scope(this,1699);(this->*(this->m_orig_glMapVertexAttrib2dAPPLE))(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+FunctionTable::MEMBERPFNGLVERTEX2FPROC m_orig_glVertex2f = nullptr;
+void m_glVertex2f_profile(GLfloat x,GLfloat y)const{ProfilingScope const scope(this,1700);(this->*(this->m_orig_glVertex2f))(x,y);}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE2DEXTPROC m_orig_glCopyTextureImage2DEXT = nullptr;
+void m_glCopyTextureImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{ProfilingScope const scope(this,1701);(this->*(this->m_orig_glCopyTextureImage2DEXT))(texture,target,level,internalformat,x,y,width,height,border);}
+FunctionTable::MEMBERPFNGLVERTEX2DPROC m_orig_glVertex2d = nullptr;
+void m_glVertex2d_profile(GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1702);(this->*(this->m_orig_glVertex2d))(x,y);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3BVEXTPROC m_orig_glSecondaryColor3bvEXT = nullptr;
+void m_glSecondaryColor3bvEXT_profile(const GLbyte* v)const{ProfilingScope const scope(this,1703);(this->*(this->m_orig_glSecondaryColor3bvEXT))(v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FARBPROC m_orig_glMultiTexCoord4fARB = nullptr;
+void m_glMultiTexCoord4fARB_profile(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{ProfilingScope const scope(this,1704);(this->*(this->m_orig_glMultiTexCoord4fARB))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETPROC m_orig_glPolygonOffset = nullptr;
+void m_glPolygonOffset_profile(GLfloat factor,GLfloat units)const{ProfilingScope const scope(this,1705);(this->*(this->m_orig_glPolygonOffset))(factor,units);}
+FunctionTable::MEMBERPFNGLTANGENT3BVEXTPROC m_orig_glTangent3bvEXT = nullptr;
+void m_glTangent3bvEXT_profile(const GLbyte* v)const{ProfilingScope const scope(this,1706);(this->*(this->m_orig_glTangent3bvEXT))(v);}
+FunctionTable::MEMBERPFNGLHISTOGRAMPROC m_orig_glHistogram = nullptr;
+void m_glHistogram_profile(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink)const{ProfilingScope const scope(this,1707);(this->*(this->m_orig_glHistogram))(target,width,internalformat,sink);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVPROC m_orig_glGetProgramiv = nullptr;
+void m_glGetProgramiv_profile(GLuint program,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1708);(this->*(this->m_orig_glGetProgramiv))(program,pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUBVARBPROC m_orig_glMatrixIndexubvARB = nullptr;
+void m_glMatrixIndexubvARB_profile(GLint size,const GLubyte* indices)const{ProfilingScope const scope(this,1709);(this->*(this->m_orig_glMatrixIndexubvARB))(size,indices);}
+FunctionTable::MEMBERPFNGLVERTEX2SPROC m_orig_glVertex2s = nullptr;
+void m_glVertex2s_profile(GLshort x,GLshort y)const{ProfilingScope const scope(this,1710);(this->*(this->m_orig_glVertex2s))(x,y);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VNVPROC m_orig_glGetVertexAttribLui64vNV = nullptr;
+void m_glGetVertexAttribLui64vNV_profile(GLuint index,GLenum pname,GLuint64EXT* params)const{ProfilingScope const scope(this,1711);(this->*(this->m_orig_glGetVertexAttribLui64vNV))(index,pname,params);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGARBPROC m_orig_glGetProgramStringARB = nullptr;
+void m_glGetProgramStringARB_profile(GLenum target,GLenum pname,void* string)const{ProfilingScope const scope(this,1712);(this->*(this->m_orig_glGetProgramStringARB))(target,pname,string);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEPROC m_orig_glFlushMappedBufferRange = nullptr;
+void m_glFlushMappedBufferRange_profile(GLenum target,GLintptr offset,GLsizeiptr length)const{ProfilingScope const scope(this,1713);(this->*(this->m_orig_glFlushMappedBufferRange))(target,offset,length);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI3UIEXTPROC m_orig_glVertexAttribI3uiEXT = nullptr;
+void m_glVertexAttribI3uiEXT_profile(GLuint index,GLuint x,GLuint y,GLuint z)const{ProfilingScope const scope(this,1714);(this->*(this->m_orig_glVertexAttribI3uiEXT))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLLINEWIDTHXOESPROC m_orig_glLineWidthxOES = nullptr;
+void m_glLineWidthxOES_profile(GLfixed width)const{ProfilingScope const scope(this,1715);(this->*(this->m_orig_glLineWidthxOES))(width);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC m_orig_glProgramUniformMatrix2fvEXT = nullptr;
+void m_glProgramUniformMatrix2fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1716);(this->*(this->m_orig_glProgramUniformMatrix2fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVEXTPROC m_orig_glGetTextureParameterIuivEXT = nullptr;
+void m_glGetTextureParameterIuivEXT_profile(GLuint texture,GLenum target,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,1717);(this->*(this->m_orig_glGetTextureParameterIuivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLGETMULTITEXENVIVEXTPROC m_orig_glGetMultiTexEnvivEXT = nullptr;
+void m_glGetMultiTexEnvivEXT_profile(GLenum texunit,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1718);(this->*(this->m_orig_glGetMultiTexEnvivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERIVSGISPROC m_orig_glPixelTexGenParameterivSGIS = nullptr;
+void m_glPixelTexGenParameterivSGIS_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1719);(this->*(this->m_orig_glPixelTexGenParameterivSGIS))(pname,params);}
+FunctionTable::MEMBERPFNGLGENQUERIESPROC m_orig_glGenQueries = nullptr;
+void m_glGenQueries_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,1720);(this->*(this->m_orig_glGenQueries))(n,ids);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPFVPROC m_orig_glGetPixelMapfv = nullptr;
+void m_glGetPixelMapfv_profile(GLenum map,GLfloat* values)const{ProfilingScope const scope(this,1721);(this->*(this->m_orig_glGetPixelMapfv))(map,values);}
+FunctionTable::MEMBERPFNGLBLENDCOLOREXTPROC m_orig_glBlendColorEXT = nullptr;
+void m_glBlendColorEXT_profile(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{ProfilingScope const scope(this,1722);(this->*(this->m_orig_glBlendColorEXT))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLRESETMINMAXPROC m_orig_glResetMinmax = nullptr;
+void m_glResetMinmax_profile(GLenum target)const{ProfilingScope const scope(this,1723);(this->*(this->m_orig_glResetMinmax))(target);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVARBPROC m_orig_glGetnUniformivARB = nullptr;
+void m_glGetnUniformivARB_profile(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{ProfilingScope const scope(this,1724);(this->*(this->m_orig_glGetnUniformivARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLVERTEXBLENDARBPROC m_orig_glVertexBlendARB = nullptr;
+void m_glVertexBlendARB_profile(GLint count)const{ProfilingScope const scope(this,1725);(this->*(this->m_orig_glVertexBlendARB))(count);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DPROC m_orig_glVertexAttrib4d = nullptr;
+void m_glVertexAttrib4d_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1726);(this->*(this->m_orig_glVertexAttrib4d))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETVARYINGLOCATIONNVPROC m_orig_glGetVaryingLocationNV = nullptr;
+GLint m_glGetVaryingLocationNV_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,1727);return (this->*(this->m_orig_glGetVaryingLocationNV))(program,name);}
+FunctionTable::MEMBERPFNGLGETMAPATTRIBPARAMETERIVNVPROC m_orig_glGetMapAttribParameterivNV = nullptr;
+void m_glGetMapAttribParameterivNV_profile(GLenum target,GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1728);(this->*(this->m_orig_glGetMapAttribParameterivNV))(target,index,pname,params);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE3DPROC m_orig_glTexSubImage3D = nullptr;
+void m_glTexSubImage3D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,1729);(this->*(this->m_orig_glTexSubImage3D))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+FunctionTable::MEMBERPFNGLDELETESAMPLERSPROC m_orig_glDeleteSamplers = nullptr;
+void m_glDeleteSamplers_profile(GLsizei count,const GLuint* samplers)const{ProfilingScope const scope(this,1730);(this->*(this->m_orig_glDeleteSamplers))(count,samplers);}
+FunctionTable::MEMBERPFNGLGETLIGHTXOESPROC m_orig_glGetLightxOES = nullptr;
+void m_glGetLightxOES_profile(GLenum light,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,1731);(this->*(this->m_orig_glGetLightxOES))(light,pname,params);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC m_orig_glGetVertexAttribArrayObjectfvATI = nullptr;
+void m_glGetVertexAttribArrayObjectfvATI_profile(GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1732);(this->*(this->m_orig_glGetVertexAttribArrayObjectfvATI))(index,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYNORMALOFFSETEXTPROC m_orig_glVertexArrayNormalOffsetEXT = nullptr;
+void m_glVertexArrayNormalOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1733);(this->*(this->m_orig_glVertexArrayNormalOffsetEXT))(vaobj,buffer,type,stride,offset);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVARBPROC m_orig_glGetBufferParameterivARB = nullptr;
+void m_glGetBufferParameterivARB_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1734);(this->*(this->m_orig_glGetBufferParameterivARB))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERFVPROC m_orig_glGetTextureParameterfv = nullptr;
+void m_glGetTextureParameterfv_profile(GLuint texture,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1735);(this->*(this->m_orig_glGetTextureParameterfv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWMESHARRAYSSUNPROC m_orig_glDrawMeshArraysSUN = nullptr;
+void m_glDrawMeshArraysSUN_profile(GLenum mode,GLint first,GLsizei count,GLsizei width)const{ProfilingScope const scope(this,1736);(this->*(this->m_orig_glDrawMeshArraysSUN))(mode,first,count,width);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DNVPROC m_orig_glVertexAttrib4dNV = nullptr;
+void m_glVertexAttrib4dNV_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1737);(this->*(this->m_orig_glVertexAttrib4dNV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETMULTISAMPLEFVNVPROC m_orig_glGetMultisamplefvNV = nullptr;
+void m_glGetMultisamplefvNV_profile(GLenum pname,GLuint index,GLfloat* val)const{ProfilingScope const scope(this,1738);(this->*(this->m_orig_glGetMultisamplefvNV))(pname,index,val);}
+FunctionTable::MEMBERPFNGLMAPOBJECTBUFFERATIPROC m_orig_glMapObjectBufferATI = nullptr;
+void* m_glMapObjectBufferATI_profile(GLuint buffer)const{ProfilingScope const scope(this,1739);return (this->*(this->m_orig_glMapObjectBufferATI))(buffer);}
+FunctionTable::MEMBERPFNGLGETPATHCOMMANDSNVPROC m_orig_glGetPathCommandsNV = nullptr;
+void m_glGetPathCommandsNV_profile(GLuint path,GLubyte* commands)const{ProfilingScope const scope(this,1740);(this->*(this->m_orig_glGetPathCommandsNV))(path,commands);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC m_orig_glVertexArrayTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayTexCoordOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1741);(this->*(this->m_orig_glVertexArrayTexCoordOffsetEXT))(vaobj,buffer,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPROC m_orig_glGetHistogram = nullptr;
+void m_glGetHistogram_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values)const{ProfilingScope const scope(this,1742);(this->*(this->m_orig_glGetHistogram))(target,reset,format,type,values);}
+FunctionTable::MEMBERPFNGLMATRIXMODEPROC m_orig_glMatrixMode = nullptr;
+void m_glMatrixMode_profile(GLenum mode)const{ProfilingScope const scope(this,1743);(this->*(this->m_orig_glMatrixMode))(mode);}
+FunctionTable::MEMBERPFNGLCOLORFORMATNVPROC m_orig_glColorFormatNV = nullptr;
+void m_glColorFormatNV_profile(GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,1744);(this->*(this->m_orig_glColorFormatNV))(size,type,stride);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64NVPROC m_orig_glProgramUniformui64NV = nullptr;
+void m_glProgramUniformui64NV_profile(GLuint program,GLint location,GLuint64EXT value)const{ProfilingScope const scope(this,1745);(this->*(this->m_orig_glProgramUniformui64NV))(program,location,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC m_orig_glProgramUniformMatrix4x2fvEXT = nullptr;
+void m_glProgramUniformMatrix4x2fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1746);(this->*(this->m_orig_glProgramUniformMatrix4x2fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLLOADMATRIXXOESPROC m_orig_glLoadMatrixxOES = nullptr;
+void m_glLoadMatrixxOES_profile(const GLfixed* m)const{ProfilingScope const scope(this,1747);(this->*(this->m_orig_glLoadMatrixxOES))(m);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERFVEXTPROC m_orig_glGetColorTableParameterfvEXT = nullptr;
+void m_glGetColorTableParameterfvEXT_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1748);(this->*(this->m_orig_glGetColorTableParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLRASTERPOS4IPROC m_orig_glRasterPos4i = nullptr;
+void m_glRasterPos4i_profile(GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,1749);(this->*(this->m_orig_glRasterPos4i))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64NVPROC m_orig_glVertexAttribL2i64NV = nullptr;
+void m_glVertexAttribL2i64NV_profile(GLuint index,GLint64EXT x,GLint64EXT y)const{ProfilingScope const scope(this,1750);(this->*(this->m_orig_glVertexAttribL2i64NV))(index,x,y);}
+FunctionTable::MEMBERPFNGLBINDTEXTURESPROC m_orig_glBindTextures = nullptr;
+void m_glBindTextures_profile(GLuint first,GLsizei count,const GLuint* textures)const{ProfilingScope const scope(this,1751);(this->*(this->m_orig_glBindTextures))(first,count,textures);}
+FunctionTable::MEMBERPFNGLMATRIXROTATEFEXTPROC m_orig_glMatrixRotatefEXT = nullptr;
+void m_glMatrixRotatefEXT_profile(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1752);(this->*(this->m_orig_glMatrixRotatefEXT))(mode,angle,x,y,z);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEXOESPROC m_orig_glGetClipPlanexOES = nullptr;
+void m_glGetClipPlanexOES_profile(GLenum plane,GLfixed* equation)const{ProfilingScope const scope(this,1753);(this->*(this->m_orig_glGetClipPlanexOES))(plane,equation);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIVEXTPROC m_orig_glSecondaryColor3uivEXT = nullptr;
+void m_glSecondaryColor3uivEXT_profile(const GLuint* v)const{ProfilingScope const scope(this,1754);(this->*(this->m_orig_glSecondaryColor3uivEXT))(v);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYINFOINTELPROC m_orig_glGetPerfQueryInfoINTEL = nullptr;
+void m_glGetPerfQueryInfoINTEL_profile(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask)const{ProfilingScope const scope(this,1755);(this->*(this->m_orig_glGetPerfQueryInfoINTEL))(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);}
+FunctionTable::MEMBERPFNGLGETDOUBLEVPROC m_orig_glGetDoublev = nullptr;
+void m_glGetDoublev_profile(GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,1756);(this->*(this->m_orig_glGetDoublev))(pname,params);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGEEXTPROC m_orig_glBindBufferRangeEXT = nullptr;
+void m_glBindBufferRangeEXT_profile(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,1757);(this->*(this->m_orig_glBindBufferRangeEXT))(target,index,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DPROC m_orig_glCompressedTexImage2D = nullptr;
+void m_glCompressedTexImage2D_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,1758);(this->*(this->m_orig_glCompressedTexImage2D))(target,level,internalformat,width,height,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLMAPBUFFERARBPROC m_orig_glMapBufferARB = nullptr;
+void* m_glMapBufferARB_profile(GLenum target,GLenum access)const{ProfilingScope const scope(this,1759);return (this->*(this->m_orig_glMapBufferARB))(target,access);}
+FunctionTable::MEMBERPFNGLGETPATHSPACINGNVPROC m_orig_glGetPathSpacingNV = nullptr;
+void m_glGetPathSpacingNV_profile(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing)const{ProfilingScope const scope(this,1760);(this->*(this->m_orig_glGetPathSpacingNV))(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);}
+FunctionTable::MEMBERPFNGLUNIFORM4DVPROC m_orig_glUniform4dv = nullptr;
+void m_glUniform4dv_profile(GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,1761);(this->*(this->m_orig_glUniform4dv))(location,count,value);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORDSUNPROC m_orig_glGlobalAlphaFactordSUN = nullptr;
+void m_glGlobalAlphaFactordSUN_profile(GLdouble factor)const{ProfilingScope const scope(this,1762);(this->*(this->m_orig_glGlobalAlphaFactordSUN))(factor);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DVPROC m_orig_glProgramUniform3dv = nullptr;
+void m_glProgramUniform3dv_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,1763);(this->*(this->m_orig_glProgramUniform3dv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETSHADERSOURCEARBPROC m_orig_glGetShaderSourceARB = nullptr;
+void m_glGetShaderSourceARB_profile(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source)const{ProfilingScope const scope(this,1764);(this->*(this->m_orig_glGetShaderSourceARB))(obj,maxLength,length,source);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVARBPROC m_orig_glVertexAttrib3dvARB = nullptr;
+void m_glVertexAttrib3dvARB_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,1765);(this->*(this->m_orig_glVertexAttrib3dvARB))(index,v);}
+FunctionTable::MEMBERPFNGLINVALIDATEBUFFERDATAPROC m_orig_glInvalidateBufferData = nullptr;
+void m_glInvalidateBufferData_profile(GLuint buffer)const{ProfilingScope const scope(this,1766);(this->*(this->m_orig_glInvalidateBufferData))(buffer);}
+FunctionTable::MEMBERPFNGLMATRIXLOAD3X2FNVPROC m_orig_glMatrixLoad3x2fNV = nullptr;
+void m_glMatrixLoad3x2fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,1767);(this->*(this->m_orig_glMatrixLoad3x2fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC m_orig_glCompressedTextureSubImage1D = nullptr;
+void m_glCompressedTextureSubImage1D_profile(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,1768);(this->*(this->m_orig_glCompressedTextureSubImage1D))(texture,level,xoffset,width,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLTEXCOORD3XVOESPROC m_orig_glTexCoord3xvOES = nullptr;
+void m_glTexCoord3xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,1769);(this->*(this->m_orig_glTexCoord3xvOES))(coords);}
+FunctionTable::MEMBERPFNGLGENTEXTURESEXTPROC m_orig_glGenTexturesEXT = nullptr;
+void m_glGenTexturesEXT_profile(GLsizei n,GLuint* textures)const{ProfilingScope const scope(this,1770);(this->*(this->m_orig_glGenTexturesEXT))(n,textures);}
+FunctionTable::MEMBERPFNGLTANGENT3IEXTPROC m_orig_glTangent3iEXT = nullptr;
+void m_glTangent3iEXT_profile(GLint tx,GLint ty,GLint tz)const{ProfilingScope const scope(this,1771);(this->*(this->m_orig_glTangent3iEXT))(tx,ty,tz);}
+FunctionTable::MEMBERPFNGLCLEARTEXIMAGEPROC m_orig_glClearTexImage = nullptr;
+void m_glClearTexImage_profile(GLuint texture,GLint level,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,1772);(this->*(this->m_orig_glClearTexImage))(texture,level,format,type,data);}
+FunctionTable::MEMBERPFNGLBINORMAL3BVEXTPROC m_orig_glBinormal3bvEXT = nullptr;
+void m_glBinormal3bvEXT_profile(const GLbyte* v)const{ProfilingScope const scope(this,1773);(this->*(this->m_orig_glBinormal3bvEXT))(v);}
+FunctionTable::MEMBERPFNGLUNIFORM3FVPROC m_orig_glUniform3fv = nullptr;
+void m_glUniform3fv_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,1774);(this->*(this->m_orig_glUniform3fv))(location,count,value);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUSVARBPROC m_orig_glGetnPixelMapusvARB = nullptr;
+void m_glGetnPixelMapusvARB_profile(GLenum map,GLsizei bufSize,GLushort* values)const{ProfilingScope const scope(this,1775);(this->*(this->m_orig_glGetnPixelMapusvARB))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLMEMORYOBJECTPARAMETERIVEXTPROC m_orig_glMemoryObjectParameterivEXT = nullptr;
+void m_glMemoryObjectParameterivEXT_profile(GLuint memoryObject,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1776);(this->*(this->m_orig_glMemoryObjectParameterivEXT))(memoryObject,pname,params);}
+FunctionTable::MEMBERPFNGLGENSEMAPHORESEXTPROC m_orig_glGenSemaphoresEXT = nullptr;
+void m_glGenSemaphoresEXT_profile(GLsizei n,GLuint* semaphores)const{ProfilingScope const scope(this,1777);(this->*(this->m_orig_glGenSemaphoresEXT))(n,semaphores);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP1UIPROC m_orig_glMultiTexCoordP1ui = nullptr;
+void m_glMultiTexCoordP1ui_profile(GLenum texture,GLenum type,GLuint coords)const{ProfilingScope const scope(this,1778);(this->*(this->m_orig_glMultiTexCoordP1ui))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDBUFFERDATAEXTPROC m_orig_glClearNamedBufferDataEXT = nullptr;
+void m_glClearNamedBufferDataEXT_profile(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,1779);(this->*(this->m_orig_glClearNamedBufferDataEXT))(buffer,internalformat,format,type,data);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4DVPROC m_orig_glUniformMatrix4dv = nullptr;
+void m_glUniformMatrix4dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1780);(this->*(this->m_orig_glUniformMatrix4dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FMESAPROC m_orig_glWindowPos3fMESA = nullptr;
+void m_glWindowPos3fMESA_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1781);(this->*(this->m_orig_glWindowPos3fMESA))(x,y,z);}
+FunctionTable::MEMBERPFNGLDELETERENDERBUFFERSPROC m_orig_glDeleteRenderbuffers = nullptr;
+void m_glDeleteRenderbuffers_profile(GLsizei n,const GLuint* renderbuffers)const{ProfilingScope const scope(this,1782);(this->*(this->m_orig_glDeleteRenderbuffers))(n,renderbuffers);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVEXTPROC m_orig_glGetTextureLevelParameterfvEXT = nullptr;
+void m_glGetTextureLevelParameterfvEXT_profile(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1783);(this->*(this->m_orig_glGetTextureLevelParameterfvEXT))(texture,target,level,pname,params);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERXVOESPROC m_orig_glGetHistogramParameterxvOES = nullptr;
+void m_glGetHistogramParameterxvOES_profile(GLenum target,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,1784);(this->*(this->m_orig_glGetHistogramParameterxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSPROC m_orig_glMultiDrawElements = nullptr;
+void m_glMultiDrawElements_profile(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount)const{ProfilingScope const scope(this,1785);(this->*(this->m_orig_glMultiDrawElements))(mode,count,type,indices,drawcount);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC m_orig_glMakeImageHandleNonResidentNV = nullptr;
+void m_glMakeImageHandleNonResidentNV_profile(GLuint64 handle)const{ProfilingScope const scope(this,1786);(this->*(this->m_orig_glMakeImageHandleNonResidentNV))(handle);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DEXTPROC m_orig_glTexSubImage1DEXT = nullptr;
+void m_glTexSubImage1DEXT_profile(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1787);(this->*(this->m_orig_glTexSubImage1DEXT))(target,level,xoffset,width,format,type,pixels);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3DATIPROC m_orig_glNormalStream3dATI = nullptr;
+void m_glNormalStream3dATI_profile(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz)const{ProfilingScope const scope(this,1788);(this->*(this->m_orig_glNormalStream3dATI))(stream,nx,ny,nz);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4I64VNVPROC m_orig_glVertexAttribL4i64vNV = nullptr;
+void m_glVertexAttribL4i64vNV_profile(GLuint index,const GLint64EXT* v)const{ProfilingScope const scope(this,1789);(this->*(this->m_orig_glVertexAttribL4i64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSPROC m_orig_glDrawBuffers = nullptr;
+void m_glDrawBuffers_profile(GLsizei n,const GLenum* bufs)const{ProfilingScope const scope(this,1790);(this->*(this->m_orig_glDrawBuffers))(n,bufs);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DEXTPROC m_orig_glCopyTextureSubImage1DEXT = nullptr;
+void m_glCopyTextureSubImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,1791);(this->*(this->m_orig_glCopyTextureSubImage1DEXT))(texture,target,level,xoffset,x,y,width);}
+FunctionTable::MEMBERPFNGLWINDOWRECTANGLESEXTPROC m_orig_glWindowRectanglesEXT = nullptr;
+void m_glWindowRectanglesEXT_profile(GLenum mode,GLsizei count,const GLint* box)const{ProfilingScope const scope(this,1792);(this->*(this->m_orig_glWindowRectanglesEXT))(mode,count,box);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERREADBUFFERPROC m_orig_glNamedFramebufferReadBuffer = nullptr;
+void m_glNamedFramebufferReadBuffer_profile(GLuint framebuffer,GLenum src)const{ProfilingScope const scope(this,1793);(this->*(this->m_orig_glNamedFramebufferReadBuffer))(framebuffer,src);}
+FunctionTable::MEMBERPFNGLUNIFORM2I64VARBPROC m_orig_glUniform2i64vARB = nullptr;
+void m_glUniform2i64vARB_profile(GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,1794);(this->*(this->m_orig_glUniform2i64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIVEXTPROC m_orig_glVertexAttribI1uivEXT = nullptr;
+void m_glVertexAttribI1uivEXT_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1795);(this->*(this->m_orig_glVertexAttribI1uivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLGETTEXGENFVPROC m_orig_glGetTexGenfv = nullptr;
+void m_glGetTexGenfv_profile(GLenum coord,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1796);(this->*(this->m_orig_glGetTexGenfv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLBEGINQUERYARBPROC m_orig_glBeginQueryARB = nullptr;
+void m_glBeginQueryARB_profile(GLenum target,GLuint id)const{ProfilingScope const scope(this,1797);(this->*(this->m_orig_glBeginQueryARB))(target,id);}
+FunctionTable::MEMBERPFNGLUNIFORM1IARBPROC m_orig_glUniform1iARB = nullptr;
+void m_glUniform1iARB_profile(GLint location,GLint v0)const{ProfilingScope const scope(this,1798);(this->*(this->m_orig_glUniform1iARB))(location,v0);}
+FunctionTable::MEMBERPFNGLVERTEX4BVOESPROC m_orig_glVertex4bvOES = nullptr;
+void m_glVertex4bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,1799);(this->*(this->m_orig_glVertex4bvOES))(coords);}
+FunctionTable::MEMBERPFNGLINVALIDATESUBFRAMEBUFFERPROC m_orig_glInvalidateSubFramebuffer = nullptr;
+void m_glInvalidateSubFramebuffer_profile(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,1800);(this->*(this->m_orig_glInvalidateSubFramebuffer))(target,numAttachments,attachments,x,y,width,height);}
+FunctionTable::MEMBERPFNGLUNIFORM1FVARBPROC m_orig_glUniform1fvARB = nullptr;
+void m_glUniform1fvARB_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,1801);(this->*(this->m_orig_glUniform1fvARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLTESTFENCENVPROC m_orig_glTestFenceNV = nullptr;
+GLboolean m_glTestFenceNV_profile(GLuint fence)const{ProfilingScope const scope(this,1802);return (this->*(this->m_orig_glTestFenceNV))(fence);}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKPROC m_orig_glBindTransformFeedback = nullptr;
+void m_glBindTransformFeedback_profile(GLenum target,GLuint id)const{ProfilingScope const scope(this,1803);(this->*(this->m_orig_glBindTransformFeedback))(target,id);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVPROC m_orig_glMultiTexCoord2iv = nullptr;
+void m_glMultiTexCoord2iv_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,1804);(this->*(this->m_orig_glMultiTexCoord2iv))(target,v);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC m_orig_glCopyMultiTexSubImage1DEXT = nullptr;
+void m_glCopyMultiTexSubImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,1805);(this->*(this->m_orig_glCopyMultiTexSubImage1DEXT))(texunit,target,level,xoffset,x,y,width);}
+FunctionTable::MEMBERPFNGLVARIANTBVEXTPROC m_orig_glVariantbvEXT = nullptr;
+void m_glVariantbvEXT_profile(GLuint id,const GLbyte* addr)const{ProfilingScope const scope(this,1806);(this->*(this->m_orig_glVariantbvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLTEXCOORD1HNVPROC m_orig_glTexCoord1hNV = nullptr;
+void m_glTexCoord1hNV_profile(GLhalfNV s)const{ProfilingScope const scope(this,1807);(this->*(this->m_orig_glTexCoord1hNV))(s);}
+FunctionTable::MEMBERPFNGLGENFENCESNVPROC m_orig_glGenFencesNV = nullptr;
+void m_glGenFencesNV_profile(GLsizei n,GLuint* fences)const{ProfilingScope const scope(this,1808);(this->*(this->m_orig_glGenFencesNV))(n,fences);}
+FunctionTable::MEMBERPFNGLRASTERPOS3IVPROC m_orig_glRasterPos3iv = nullptr;
+void m_glRasterPos3iv_profile(const GLint* v)const{ProfilingScope const scope(this,1809);(this->*(this->m_orig_glRasterPos3iv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2UI64NVPROC m_orig_glVertexAttribL2ui64NV = nullptr;
+void m_glVertexAttribL2ui64NV_profile(GLuint index,GLuint64EXT x,GLuint64EXT y)const{ProfilingScope const scope(this,1810);(this->*(this->m_orig_glVertexAttribL2ui64NV))(index,x,y);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1HVNVPROC m_orig_glMultiTexCoord1hvNV = nullptr;
+void m_glMultiTexCoord1hvNV_profile(GLenum target,const GLhalfNV* v)const{ProfilingScope const scope(this,1811);(this->*(this->m_orig_glMultiTexCoord1hvNV))(target,v);}
+FunctionTable::MEMBERPFNGLGETNCONVOLUTIONFILTERPROC m_orig_glGetnConvolutionFilter = nullptr;
+void m_glGetnConvolutionFilter_profile(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image)const{ProfilingScope const scope(this,1812);(this->*(this->m_orig_glGetnConvolutionFilter))(target,format,type,bufSize,image);}
+FunctionTable::MEMBERPFNGLNORMAL3BVPROC m_orig_glNormal3bv = nullptr;
+void m_glNormal3bv_profile(const GLbyte* v)const{ProfilingScope const scope(this,1813);(this->*(this->m_orig_glNormal3bv))(v);}
+FunctionTable::MEMBERPFNGLWEIGHTBVARBPROC m_orig_glWeightbvARB = nullptr;
+void m_glWeightbvARB_profile(GLint size,const GLbyte* weights)const{ProfilingScope const scope(this,1814);(this->*(this->m_orig_glWeightbvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLTEXCOORD4SVPROC m_orig_glTexCoord4sv = nullptr;
+void m_glTexCoord4sv_profile(const GLshort* v)const{ProfilingScope const scope(this,1815);(this->*(this->m_orig_glTexCoord4sv))(v);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIVPROC m_orig_glUniform2uiv = nullptr;
+void m_glUniform2uiv_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1816);(this->*(this->m_orig_glUniform2uiv))(location,count,value);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVXPROC m_orig_glBeginConditionalRenderNVX = nullptr;
+void m_glBeginConditionalRenderNVX_profile(GLuint id)const{ProfilingScope const scope(this,1817);(this->*(this->m_orig_glBeginConditionalRenderNVX))(id);}
+FunctionTable::MEMBERPFNGLFINISHPROC m_orig_glFinish = nullptr;
+void m_glFinish_profile()const{ProfilingScope const scope(this,1818);(this->*(this->m_orig_glFinish))();}
+FunctionTable::MEMBERPFNGLCOLORTABLEPARAMETERFVPROC m_orig_glColorTableParameterfv = nullptr;
+void m_glColorTableParameterfv_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1819);(this->*(this->m_orig_glColorTableParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLFRAGMENTCOVERAGECOLORNVPROC m_orig_glFragmentCoverageColorNV = nullptr;
+void m_glFragmentCoverageColorNV_profile(GLuint color)const{ProfilingScope const scope(this,1820);(this->*(this->m_orig_glFragmentCoverageColorNV))(color);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVEXTPROC m_orig_glProgramUniform3ivEXT = nullptr;
+void m_glProgramUniform3ivEXT_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1821);(this->*(this->m_orig_glProgramUniform3ivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXOFFSETEXTPROC m_orig_glVertexArrayVertexOffsetEXT = nullptr;
+void m_glVertexArrayVertexOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1822);(this->*(this->m_orig_glVertexArrayVertexOffsetEXT))(vaobj,buffer,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLVIEWPORTPOSITIONWSCALENVPROC m_orig_glViewportPositionWScaleNV = nullptr;
+void m_glViewportPositionWScaleNV_profile(GLuint index,GLfloat xcoeff,GLfloat ycoeff)const{ProfilingScope const scope(this,1823);(this->*(this->m_orig_glViewportPositionWScaleNV))(index,xcoeff,ycoeff);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIUIVNVPROC m_orig_glGetProgramLocalParameterIuivNV = nullptr;
+void m_glGetProgramLocalParameterIuivNV_profile(GLenum target,GLuint index,GLuint* params)const{ProfilingScope const scope(this,1824);(this->*(this->m_orig_glGetProgramLocalParameterIuivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN = nullptr;
+void m_glReplacementCodeuiTexCoord2fVertex3fvSUN_profile(const GLuint* rc,const GLfloat* tc,const GLfloat* v)const{ProfilingScope const scope(this,1825);(this->*(this->m_orig_glReplacementCodeuiTexCoord2fVertex3fvSUN))(rc,tc,v);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVPROC m_orig_glUniform1uiv = nullptr;
+void m_glUniform1uiv_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1826);(this->*(this->m_orig_glUniform1uiv))(location,count,value);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2DVPROC m_orig_glUniformMatrix2dv = nullptr;
+void m_glUniformMatrix2dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1827);(this->*(this->m_orig_glUniformMatrix2dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLINDEXDVPROC m_orig_glIndexdv = nullptr;
+void m_glIndexdv_profile(const GLdouble* c)const{ProfilingScope const scope(this,1828);(this->*(this->m_orig_glIndexdv))(c);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVEXTPROC m_orig_glSecondaryColor3ivEXT = nullptr;
+void m_glSecondaryColor3ivEXT_profile(const GLint* v)const{ProfilingScope const scope(this,1829);(this->*(this->m_orig_glSecondaryColor3ivEXT))(v);}
+FunctionTable::MEMBERPFNGLTEXCOORD3IVPROC m_orig_glTexCoord3iv = nullptr;
+void m_glTexCoord3iv_profile(const GLint* v)const{ProfilingScope const scope(this,1830);(this->*(this->m_orig_glTexCoord3iv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FVATIPROC m_orig_glVertexStream4fvATI = nullptr;
+void m_glVertexStream4fvATI_profile(GLenum stream,const GLfloat* coords)const{ProfilingScope const scope(this,1831);(this->*(this->m_orig_glVertexStream4fvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLDEFORMATIONMAP3FSGIXPROC m_orig_glDeformationMap3fSGIX = nullptr;
+void m_glDeformationMap3fSGIX_profile(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points)const{ProfilingScope const scope(this,1832);(this->*(this->m_orig_glDeformationMap3fSGIX))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHPROC m_orig_glClearDepth = nullptr;
+void m_glClearDepth_profile(GLclampd depth)const{ProfilingScope const scope(this,1833);(this->*(this->m_orig_glClearDepth))(depth);}
+FunctionTable::MEMBERPFNGLGENASYNCMARKERSSGIXPROC m_orig_glGenAsyncMarkersSGIX = nullptr;
+GLuint m_glGenAsyncMarkersSGIX_profile(GLsizei range)const{ProfilingScope const scope(this,1834);return (this->*(this->m_orig_glGenAsyncMarkersSGIX))(range);}
+FunctionTable::MEMBERPFNGLDISABLEINDEXEDEXTPROC m_orig_glDisableIndexedEXT = nullptr;
+void m_glDisableIndexedEXT_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,1835);(this->*(this->m_orig_glDisableIndexedEXT))(target,index);}
+FunctionTable::MEMBERPFNGLVERTEXWEIGHTFVEXTPROC m_orig_glVertexWeightfvEXT = nullptr;
+void m_glVertexWeightfvEXT_profile(const GLfloat* weight)const{ProfilingScope const scope(this,1836);(this->*(this->m_orig_glVertexWeightfvEXT))(weight);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERIIVNVPROC m_orig_glGetProgramLocalParameterIivNV = nullptr;
+void m_glGetProgramLocalParameterIivNV_profile(GLenum target,GLuint index,GLint* params)const{ProfilingScope const scope(this,1837);(this->*(this->m_orig_glGetProgramLocalParameterIivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DARBPROC m_orig_glCompressedTexImage3DARB = nullptr;
+void m_glCompressedTexImage3DARB_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,1838);(this->*(this->m_orig_glCompressedTexImage3DARB))(target,level,internalformat,width,height,depth,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4FNVPROC m_orig_glProgramParameter4fNV = nullptr;
+void m_glProgramParameter4fNV_profile(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,1839);(this->*(this->m_orig_glProgramParameter4fNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERXOESPROC m_orig_glConvolutionParameterxOES = nullptr;
+void m_glConvolutionParameterxOES_profile(GLenum target,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,1840);(this->*(this->m_orig_glConvolutionParameterxOES))(target,pname,param);}
+FunctionTable::MEMBERPFNGLINSERTCOMPONENTEXTPROC m_orig_glInsertComponentEXT = nullptr;
+void m_glInsertComponentEXT_profile(GLuint res,GLuint src,GLuint num)const{ProfilingScope const scope(this,1841);(this->*(this->m_orig_glInsertComponentEXT))(res,src,num);}
+FunctionTable::MEMBERPFNGLCREATETEXTURESPROC m_orig_glCreateTextures = nullptr;
+void m_glCreateTextures_profile(GLenum target,GLsizei n,GLuint* textures)const{ProfilingScope const scope(this,1842);(this->*(this->m_orig_glCreateTextures))(target,n,textures);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IVPROC m_orig_glSecondaryColor3iv = nullptr;
+void m_glSecondaryColor3iv_profile(const GLint* v)const{ProfilingScope const scope(this,1843);(this->*(this->m_orig_glSecondaryColor3iv))(v);}
+FunctionTable::MEMBERPFNGLCREATEBUFFERSPROC m_orig_glCreateBuffers = nullptr;
+void m_glCreateBuffers_profile(GLsizei n,GLuint* buffers)const{ProfilingScope const scope(this,1844);(this->*(this->m_orig_glCreateBuffers))(n,buffers);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2XVOESPROC m_orig_glMultiTexCoord2xvOES = nullptr;
+void m_glMultiTexCoord2xvOES_profile(GLenum texture,const GLfixed* coords)const{ProfilingScope const scope(this,1845);(this->*(this->m_orig_glMultiTexCoord2xvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLTEXGENXVOESPROC m_orig_glTexGenxvOES = nullptr;
+void m_glTexGenxvOES_profile(GLenum coord,GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,1846);(this->*(this->m_orig_glTexGenxvOES))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXFPROC m_orig_glMultTransposeMatrixf = nullptr;
+void m_glMultTransposeMatrixf_profile(const GLfloat m[16])const{ProfilingScope const scope(this,1847);(this->*(this->m_orig_glMultTransposeMatrixf))(m);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKEXTPROC m_orig_glBeginTransformFeedbackEXT = nullptr;
+void m_glBeginTransformFeedbackEXT_profile(GLenum primitiveMode)const{ProfilingScope const scope(this,1848);(this->*(this->m_orig_glBeginTransformFeedbackEXT))(primitiveMode);}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC m_orig_glTexCoord2fColor3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor3fVertex3fSUN_profile(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1849);(this->*(this->m_orig_glTexCoord2fColor3fVertex3fSUN))(s,t,r,g,b,x,y,z);}
+FunctionTable::MEMBERPFNGLNORMAL3SVPROC m_orig_glNormal3sv = nullptr;
+void m_glNormal3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,1850);(this->*(this->m_orig_glNormal3sv))(v);}
+FunctionTable::MEMBERPFNGLFREEOBJECTBUFFERATIPROC m_orig_glFreeObjectBufferATI = nullptr;
+void m_glFreeObjectBufferATI_profile(GLuint buffer)const{ProfilingScope const scope(this,1851);(this->*(this->m_orig_glFreeObjectBufferATI))(buffer);}
+FunctionTable::MEMBERPFNGLBLENDBARRIERNVPROC m_orig_glBlendBarrierNV = nullptr;
+void m_glBlendBarrierNV_profile()const{ProfilingScope const scope(this,1852);(this->*(this->m_orig_glBlendBarrierNV))();}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VNVPROC m_orig_glUniform4i64vNV = nullptr;
+void m_glUniform4i64vNV_profile(GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,1853);(this->*(this->m_orig_glUniform4i64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMUIVARBPROC m_orig_glGetnUniformuivARB = nullptr;
+void m_glGetnUniformuivARB_profile(GLuint program,GLint location,GLsizei bufSize,GLuint* params)const{ProfilingScope const scope(this,1854);(this->*(this->m_orig_glGetnUniformuivARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLALPHAFRAGMENTOP3ATIPROC m_orig_glAlphaFragmentOp3ATI = nullptr;
+void m_glAlphaFragmentOp3ATI_profile(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod)const{ProfilingScope const scope(this,1855);(this->*(this->m_orig_glAlphaFragmentOp3ATI))(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERS4FVEXTPROC m_orig_glProgramEnvParameters4fvEXT = nullptr;
+void m_glProgramEnvParameters4fvEXT_profile(GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{ProfilingScope const scope(this,1856);(this->*(this->m_orig_glProgramEnvParameters4fvEXT))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEEXTPROC m_orig_glBlendFuncSeparateEXT = nullptr;
+void m_glBlendFuncSeparateEXT_profile(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha)const{ProfilingScope const scope(this,1857);(this->*(this->m_orig_glBlendFuncSeparateEXT))(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVEXTPROC m_orig_glConvolutionParameterivEXT = nullptr;
+void m_glConvolutionParameterivEXT_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1858);(this->*(this->m_orig_glConvolutionParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENSGIXPROC m_orig_glPixelTexGenSGIX = nullptr;
+void m_glPixelTexGenSGIX_profile(GLenum mode)const{ProfilingScope const scope(this,1859);(this->*(this->m_orig_glPixelTexGenSGIX))(mode);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPROC m_orig_glDeleteProgram = nullptr;
+void m_glDeleteProgram_profile(GLuint program)const{ProfilingScope const scope(this,1860);(this->*(this->m_orig_glDeleteProgram))(program);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3DVPROC m_orig_glUniformMatrix4x3dv = nullptr;
+void m_glUniformMatrix4x3dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1861);(this->*(this->m_orig_glUniformMatrix4x3dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTURESTREAMIVNVPROC m_orig_glGetVideoCaptureStreamivNV = nullptr;
+void m_glGetVideoCaptureStreamivNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1862);(this->*(this->m_orig_glGetVideoCaptureStreamivNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIEXTPROC m_orig_glProgramUniform4uiEXT = nullptr;
+void m_glProgramUniform4uiEXT_profile(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3)const{ProfilingScope const scope(this,1863);(this->*(this->m_orig_glProgramUniform4uiEXT))(program,location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC m_orig_glMakeImageHandleNonResidentARB = nullptr;
+void m_glMakeImageHandleNonResidentARB_profile(GLuint64 handle)const{ProfilingScope const scope(this,1864);(this->*(this->m_orig_glMakeImageHandleNonResidentARB))(handle);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DEXTPROC m_orig_glSecondaryColor3dEXT = nullptr;
+void m_glSecondaryColor3dEXT_profile(GLdouble red,GLdouble green,GLdouble blue)const{ProfilingScope const scope(this,1865);(this->*(this->m_orig_glSecondaryColor3dEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLDELETEQUERIESPROC m_orig_glDeleteQueries = nullptr;
+void m_glDeleteQueries_profile(GLsizei n,const GLuint* ids)const{ProfilingScope const scope(this,1866);(this->*(this->m_orig_glDeleteQueries))(n,ids);}
+FunctionTable::MEMBERPFNGLNORMALP3UIVPROC m_orig_glNormalP3uiv = nullptr;
+void m_glNormalP3uiv_profile(GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,1867);(this->*(this->m_orig_glNormalP3uiv))(type,coords);}
+FunctionTable::MEMBERPFNGLRASTERPOS2DPROC m_orig_glRasterPos2d = nullptr;
+void m_glRasterPos2d_profile(GLdouble x,GLdouble y)const{ProfilingScope const scope(this,1868);(this->*(this->m_orig_glRasterPos2d))(x,y);}
+FunctionTable::MEMBERPFNGLINITNAMESPROC m_orig_glInitNames = nullptr;
+void m_glInitNames_profile()const{ProfilingScope const scope(this,1869);(this->*(this->m_orig_glInitNames))();}
+FunctionTable::MEMBERPFNGLBINORMAL3FVEXTPROC m_orig_glBinormal3fvEXT = nullptr;
+void m_glBinormal3fvEXT_profile(const GLfloat* v)const{ProfilingScope const scope(this,1870);(this->*(this->m_orig_glBinormal3fvEXT))(v);}
+FunctionTable::MEMBERPFNGLCOLOR3DVPROC m_orig_glColor3dv = nullptr;
+void m_glColor3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,1871);(this->*(this->m_orig_glColor3dv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC m_orig_glVertexArrayVertexAttribDivisorEXT = nullptr;
+void m_glVertexArrayVertexAttribDivisorEXT_profile(GLuint vaobj,GLuint index,GLuint divisor)const{ProfilingScope const scope(this,1872);(this->*(this->m_orig_glVertexArrayVertexAttribDivisorEXT))(vaobj,index,divisor);}
+FunctionTable::MEMBERPFNGLARRAYELEMENTEXTPROC m_orig_glArrayElementEXT = nullptr;
+void m_glArrayElementEXT_profile(GLint i)const{ProfilingScope const scope(this,1873);(this->*(this->m_orig_glArrayElementEXT))(i);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETER4DNVPROC m_orig_glProgramParameter4dNV = nullptr;
+void m_glProgramParameter4dNV_profile(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,1874);(this->*(this->m_orig_glProgramParameter4dNV))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLINDEXXOESPROC m_orig_glIndexxOES = nullptr;
+void m_glIndexxOES_profile(GLfixed component)const{ProfilingScope const scope(this,1875);(this->*(this->m_orig_glIndexxOES))(component);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVEXTPROC m_orig_glUniform3uivEXT = nullptr;
+void m_glUniform3uivEXT_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,1876);(this->*(this->m_orig_glUniform3uivEXT))(location,count,value);}
+FunctionTable::MEMBERPFNGLPOPGROUPMARKEREXTPROC m_orig_glPopGroupMarkerEXT = nullptr;
+void m_glPopGroupMarkerEXT_profile()const{ProfilingScope const scope(this,1877);(this->*(this->m_orig_glPopGroupMarkerEXT))();}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERUIVPROC m_orig_glClearNamedFramebufferuiv = nullptr;
+void m_glClearNamedFramebufferuiv_profile(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value)const{ProfilingScope const scope(this,1878);(this->*(this->m_orig_glClearNamedFramebufferuiv))(framebuffer,buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLSETLOCALCONSTANTEXTPROC m_orig_glSetLocalConstantEXT = nullptr;
+void m_glSetLocalConstantEXT_profile(GLuint id,GLenum type,const void* addr)const{ProfilingScope const scope(this,1879);(this->*(this->m_orig_glSetLocalConstantEXT))(id,type,addr);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1UI64NVPROC m_orig_glProgramUniform1ui64NV = nullptr;
+void m_glProgramUniform1ui64NV_profile(GLuint program,GLint location,GLuint64EXT x)const{ProfilingScope const scope(this,1880);(this->*(this->m_orig_glProgramUniform1ui64NV))(program,location,x);}
+FunctionTable::MEMBERPFNGLCOLOR4HVNVPROC m_orig_glColor4hvNV = nullptr;
+void m_glColor4hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1881);(this->*(this->m_orig_glColor4hvNV))(v);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBFVPROC m_orig_glGetVertexAttribfv = nullptr;
+void m_glGetVertexAttribfv_profile(GLuint index,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,1882);(this->*(this->m_orig_glGetVertexAttribfv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEPROC m_orig_glDispatchCompute = nullptr;
+void m_glDispatchCompute_profile(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z)const{ProfilingScope const scope(this,1883);(this->*(this->m_orig_glDispatchCompute))(num_groups_x,num_groups_y,num_groups_z);}
+FunctionTable::MEMBERPFNGLGETACTIVEATTRIBPROC m_orig_glGetActiveAttrib = nullptr;
+void m_glGetActiveAttrib_profile(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name)const{ProfilingScope const scope(this,1884);(this->*(this->m_orig_glGetActiveAttrib))(program,index,bufSize,length,size,type,name);}
+FunctionTable::MEMBERPFNGLFRAGMENTCOLORMATERIALSGIXPROC m_orig_glFragmentColorMaterialSGIX = nullptr;
+void m_glFragmentColorMaterialSGIX_profile(GLenum face,GLenum mode)const{ProfilingScope const scope(this,1885);(this->*(this->m_orig_glFragmentColorMaterialSGIX))(face,mode);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE2DPROC m_orig_glTexSubImage2D = nullptr;
+void m_glTexSubImage2D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,1886);(this->*(this->m_orig_glTexSubImage2D))(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETNMINMAXARBPROC m_orig_glGetnMinmaxARB = nullptr;
+void m_glGetnMinmaxARB_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{ProfilingScope const scope(this,1887);(this->*(this->m_orig_glGetnMinmaxARB))(target,reset,format,type,bufSize,values);}
+FunctionTable::MEMBERPFNGLLOGICOPPROC m_orig_glLogicOp = nullptr;
+void m_glLogicOp_profile(GLenum opcode)const{ProfilingScope const scope(this,1888);(this->*(this->m_orig_glLogicOp))(opcode);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4FVPROC m_orig_glProgramUniformMatrix3x4fv = nullptr;
+void m_glProgramUniformMatrix3x4fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,1889);(this->*(this->m_orig_glProgramUniformMatrix3x4fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4IMESAPROC m_orig_glWindowPos4iMESA = nullptr;
+void m_glWindowPos4iMESA_profile(GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,1890);(this->*(this->m_orig_glWindowPos4iMESA))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERFPROC m_orig_glPixelTransferf = nullptr;
+void m_glPixelTransferf_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,1891);(this->*(this->m_orig_glPixelTransferf))(pname,param);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIUIVPROC m_orig_glGetTextureParameterIuiv = nullptr;
+void m_glGetTextureParameterIuiv_profile(GLuint texture,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,1892);(this->*(this->m_orig_glGetTextureParameterIuiv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1XOESPROC m_orig_glMultiTexCoord1xOES = nullptr;
+void m_glMultiTexCoord1xOES_profile(GLenum texture,GLfixed s)const{ProfilingScope const scope(this,1893);(this->*(this->m_orig_glMultiTexCoord1xOES))(texture,s);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4DVPROC m_orig_glProgramUniformMatrix4dv = nullptr;
+void m_glProgramUniformMatrix4dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1894);(this->*(this->m_orig_glProgramUniformMatrix4dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMIVPROC m_orig_glGetnUniformiv = nullptr;
+void m_glGetnUniformiv_profile(GLuint program,GLint location,GLsizei bufSize,GLint* params)const{ProfilingScope const scope(this,1895);(this->*(this->m_orig_glGetnUniformiv))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DEXTPROC m_orig_glFramebufferTexture1DEXT = nullptr;
+void m_glFramebufferTexture1DEXT_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,1896);(this->*(this->m_orig_glFramebufferTexture1DEXT))(target,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLVERTEXPOINTERVINTELPROC m_orig_glVertexPointervINTEL = nullptr;
+void m_glVertexPointervINTEL_profile(GLint size,GLenum type,const void** pointer)const{ProfilingScope const scope(this,1897);(this->*(this->m_orig_glVertexPointervINTEL))(size,type,pointer);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVPROC m_orig_glTextureParameterIiv = nullptr;
+void m_glTextureParameterIiv_profile(GLuint texture,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1898);(this->*(this->m_orig_glTextureParameterIiv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTEREXTPROC m_orig_glGetSeparableFilterEXT = nullptr;
+void m_glGetSeparableFilterEXT_profile(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span)const{ProfilingScope const scope(this,1899);(this->*(this->m_orig_glGetSeparableFilterEXT))(target,format,type,row,column,span);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3IARBPROC m_orig_glMultiTexCoord3iARB = nullptr;
+void m_glMultiTexCoord3iARB_profile(GLenum target,GLint s,GLint t,GLint r)const{ProfilingScope const scope(this,1900);(this->*(this->m_orig_glMultiTexCoord3iARB))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLRASTERPOS4XVOESPROC m_orig_glRasterPos4xvOES = nullptr;
+void m_glRasterPos4xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,1901);(this->*(this->m_orig_glRasterPos4xvOES))(coords);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC m_orig_glDrawTransformFeedbackStream = nullptr;
+void m_glDrawTransformFeedbackStream_profile(GLenum mode,GLuint id,GLuint stream)const{ProfilingScope const scope(this,1902);(this->*(this->m_orig_glDrawTransformFeedbackStream))(mode,id,stream);}
+FunctionTable::MEMBERPFNGLVERTEX3HVNVPROC m_orig_glVertex3hvNV = nullptr;
+void m_glVertex3hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,1903);(this->*(this->m_orig_glVertex3hvNV))(v);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC m_orig_glVertexArrayMultiTexCoordOffsetEXT = nullptr;
+void m_glVertexArrayMultiTexCoordOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1904);(this->*(this->m_orig_glVertexArrayMultiTexCoordOffsetEXT))(vaobj,buffer,texunit,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLPROVOKINGVERTEXPROC m_orig_glProvokingVertex = nullptr;
+void m_glProvokingVertex_profile(GLenum mode)const{ProfilingScope const scope(this,1905);(this->*(this->m_orig_glProvokingVertex))(mode);}
+FunctionTable::MEMBERPFNGLACCUMXOESPROC m_orig_glAccumxOES = nullptr;
+void m_glAccumxOES_profile(GLenum op,GLfixed value)const{ProfilingScope const scope(this,1906);(this->*(this->m_orig_glAccumxOES))(op,value);}
+FunctionTable::MEMBERPFNGLSHADERBINARYPROC m_orig_glShaderBinary = nullptr;
+void m_glShaderBinary_profile(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length)const{ProfilingScope const scope(this,1907);(this->*(this->m_orig_glShaderBinary))(count,shaders,binaryformat,binary,length);}
+FunctionTable::MEMBERPFNGLGETMULTITEXGENIVEXTPROC m_orig_glGetMultiTexGenivEXT = nullptr;
+void m_glGetMultiTexGenivEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1908);(this->*(this->m_orig_glGetMultiTexGenivEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERXVOESPROC m_orig_glPointParameterxvOES = nullptr;
+void m_glPointParameterxvOES_profile(GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,1909);(this->*(this->m_orig_glPointParameterxvOES))(pname,params);}
+FunctionTable::MEMBERPFNGLCREATESTATESNVPROC m_orig_glCreateStatesNV = nullptr;
+void m_glCreateStatesNV_profile(GLsizei n,GLuint* states)const{ProfilingScope const scope(this,1910);(this->*(this->m_orig_glCreateStatesNV))(n,states);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHDNVPROC m_orig_glClearDepthdNV = nullptr;
+void m_glClearDepthdNV_profile(GLdouble depth)const{ProfilingScope const scope(this,1911);(this->*(this->m_orig_glClearDepthdNV))(depth);}
+FunctionTable::MEMBERPFNGLCLEARCOLORIUIEXTPROC m_orig_glClearColorIuiEXT = nullptr;
+void m_glClearColorIuiEXT_profile(GLuint red,GLuint green,GLuint blue,GLuint alpha)const{ProfilingScope const scope(this,1912);(this->*(this->m_orig_glClearColorIuiEXT))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLBINDMULTITEXTUREEXTPROC m_orig_glBindMultiTextureEXT = nullptr;
+void m_glBindMultiTextureEXT_profile(GLenum texunit,GLenum target,GLuint texture)const{ProfilingScope const scope(this,1913);(this->*(this->m_orig_glBindMultiTextureEXT))(texunit,target,texture);}
+FunctionTable::MEMBERPFNGLTEXGENIVPROC m_orig_glTexGeniv = nullptr;
+void m_glTexGeniv_profile(GLenum coord,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1914);(this->*(this->m_orig_glTexGeniv))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSPROC m_orig_glDrawElements = nullptr;
+void m_glDrawElements_profile(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices)const{ProfilingScope const scope(this,1915);(this->*(this->m_orig_glDrawElements))(mode,count,type,indices);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4IVPROC m_orig_glProgramUniform4iv = nullptr;
+void m_glProgramUniform4iv_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1916);(this->*(this->m_orig_glProgramUniform4iv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYEXTPROC m_orig_glDisableVertexArrayEXT = nullptr;
+void m_glDisableVertexArrayEXT_profile(GLuint vaobj,GLenum array)const{ProfilingScope const scope(this,1917);(this->*(this->m_orig_glDisableVertexArrayEXT))(vaobj,array);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UI64NVPROC m_orig_glProgramUniform3ui64NV = nullptr;
+void m_glProgramUniform3ui64NV_profile(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{ProfilingScope const scope(this,1918);(this->*(this->m_orig_glProgramUniform3ui64NV))(program,location,x,y,z);}
+FunctionTable::MEMBERPFNGLCLIENTACTIVETEXTUREPROC m_orig_glClientActiveTexture = nullptr;
+void m_glClientActiveTexture_profile(GLenum texture)const{ProfilingScope const scope(this,1919);(this->*(this->m_orig_glClientActiveTexture))(texture);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIIVEXTPROC m_orig_glMultiTexParameterIivEXT = nullptr;
+void m_glMultiTexParameterIivEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1920);(this->*(this->m_orig_glMultiTexParameterIivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64ARBPROC m_orig_glUniform1i64ARB = nullptr;
+void m_glUniform1i64ARB_profile(GLint location,GLint64 x)const{ProfilingScope const scope(this,1921);(this->*(this->m_orig_glUniform1i64ARB))(location,x);}
+FunctionTable::MEMBERPFNGLUNIFORM1IVPROC m_orig_glUniform1iv = nullptr;
+void m_glUniform1iv_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1922);(this->*(this->m_orig_glUniform1iv))(location,count,value);}
+FunctionTable::MEMBERPFNGLMULTICASTBARRIERNVPROC m_orig_glMulticastBarrierNV = nullptr;
+void m_glMulticastBarrierNV_profile()const{ProfilingScope const scope(this,1923);(this->*(this->m_orig_glMulticastBarrierNV))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBARRAYOBJECTATIPROC m_orig_glVertexAttribArrayObjectATI = nullptr;
+void m_glVertexAttribArrayObjectATI_profile(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset)const{ProfilingScope const scope(this,1924);(this->*(this->m_orig_glVertexAttribArrayObjectATI))(index,size,type,normalized,stride,buffer,offset);}
+FunctionTable::MEMBERPFNGLUNIFORM2IARBPROC m_orig_glUniform2iARB = nullptr;
+void m_glUniform2iARB_profile(GLint location,GLint v0,GLint v1)const{ProfilingScope const scope(this,1925);(this->*(this->m_orig_glUniform2iARB))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDPROC m_orig_glDrawArraysInstanced = nullptr;
+void m_glDrawArraysInstanced_profile(GLenum mode,GLint first,GLsizei count,GLsizei instancecount)const{ProfilingScope const scope(this,1926);(this->*(this->m_orig_glDrawArraysInstanced))(mode,first,count,instancecount);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SNVPROC m_orig_glVertexAttrib2sNV = nullptr;
+void m_glVertexAttrib2sNV_profile(GLuint index,GLshort x,GLshort y)const{ProfilingScope const scope(this,1927);(this->*(this->m_orig_glVertexAttrib2sNV))(index,x,y);}
+FunctionTable::MEMBERPFNGLTEXBUFFEREXTPROC m_orig_glTexBufferEXT = nullptr;
+void m_glTexBufferEXT_profile(GLenum target,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,1928);(this->*(this->m_orig_glTexBufferEXT))(target,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2FATIPROC m_orig_glVertexStream2fATI = nullptr;
+void m_glVertexStream2fATI_profile(GLenum stream,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,1929);(this->*(this->m_orig_glVertexStream2fATI))(stream,x,y);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKAMDPROC m_orig_glDebugMessageCallbackAMD = nullptr;
+void m_glDebugMessageCallbackAMD_profile(GLDEBUGPROCAMD callback,void* userParam)const{ProfilingScope const scope(this,1930);(this->*(this->m_orig_glDebugMessageCallbackAMD))(callback,userParam);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIVPROC m_orig_glSamplerParameteriv = nullptr;
+void m_glSamplerParameteriv_profile(GLuint sampler,GLenum pname,const GLint* param)const{ProfilingScope const scope(this,1931);(this->*(this->m_orig_glSamplerParameteriv))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UIVPROC m_orig_glVertexAttrib4uiv = nullptr;
+void m_glVertexAttrib4uiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,1932);(this->*(this->m_orig_glVertexAttrib4uiv))(index,v);}
+FunctionTable::MEMBERPFNGLENDQUERYINDEXEDPROC m_orig_glEndQueryIndexed = nullptr;
+void m_glEndQueryIndexed_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,1933);(this->*(this->m_orig_glEndQueryIndexed))(target,index);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3SATIPROC m_orig_glNormalStream3sATI = nullptr;
+void m_glNormalStream3sATI_profile(GLenum stream,GLshort nx,GLshort ny,GLshort nz)const{ProfilingScope const scope(this,1934);(this->*(this->m_orig_glNormalStream3sATI))(stream,nx,ny,nz);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIARBPROC m_orig_glProgramParameteriARB = nullptr;
+void m_glProgramParameteriARB_profile(GLuint program,GLenum pname,GLint value)const{ProfilingScope const scope(this,1935);(this->*(this->m_orig_glProgramParameteriARB))(program,pname,value);}
+FunctionTable::MEMBERPFNGLTEXENVXOESPROC m_orig_glTexEnvxOES = nullptr;
+void m_glTexEnvxOES_profile(GLenum target,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,1936);(this->*(this->m_orig_glTexEnvxOES))(target,pname,param);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IVPROC m_orig_glProgramUniform1iv = nullptr;
+void m_glProgramUniform1iv_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,1937);(this->*(this->m_orig_glProgramUniform1iv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBAPPLEPROC m_orig_glDisableVertexAttribAPPLE = nullptr;
+void m_glDisableVertexAttribAPPLE_profile(GLuint index,GLenum pname)const{ProfilingScope const scope(this,1938);(this->*(this->m_orig_glDisableVertexAttribAPPLE))(index,pname);}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFERPROC m_orig_glBindRenderbuffer = nullptr;
+void m_glBindRenderbuffer_profile(GLenum target,GLuint renderbuffer)const{ProfilingScope const scope(this,1939);(this->*(this->m_orig_glBindRenderbuffer))(target,renderbuffer);}
+FunctionTable::MEMBERPFNGLMULTITEXSUBIMAGE3DEXTPROC m_orig_glMultiTexSubImage3DEXT = nullptr;
+void m_glMultiTexSubImage3DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,1940);(this->*(this->m_orig_glMultiTexSubImage3DEXT))(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+FunctionTable::MEMBERPFNGLISPROGRAMPROC m_orig_glIsProgram = nullptr;
+GLboolean m_glIsProgram_profile(GLuint program)const{ProfilingScope const scope(this,1941);return (this->*(this->m_orig_glIsProgram))(program);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC m_orig_glMultiDrawElementsIndirectAMD = nullptr;
+void m_glMultiDrawElementsIndirectAMD_profile(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride)const{ProfilingScope const scope(this,1942);(this->*(this->m_orig_glMultiDrawElementsIndirectAMD))(mode,type,indirect,primcount,stride);}
+FunctionTable::MEMBERPFNGLGETPROGRAMINFOLOGPROC m_orig_glGetProgramInfoLog = nullptr;
+void m_glGetProgramInfoLog_profile(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog)const{ProfilingScope const scope(this,1943);(this->*(this->m_orig_glGetProgramInfoLog))(program,bufSize,length,infoLog);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTBOOLEANVEXTPROC m_orig_glGetLocalConstantBooleanvEXT = nullptr;
+void m_glGetLocalConstantBooleanvEXT_profile(GLuint id,GLenum value,GLboolean* data)const{ProfilingScope const scope(this,1944);(this->*(this->m_orig_glGetLocalConstantBooleanvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIEXTPROC m_orig_glPixelTransformParameteriEXT = nullptr;
+void m_glPixelTransformParameteriEXT_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,1945);(this->*(this->m_orig_glPixelTransformParameteriEXT))(target,pname,param);}
+FunctionTable::MEMBERPFNGLTEXCOORD4BOESPROC m_orig_glTexCoord4bOES = nullptr;
+void m_glTexCoord4bOES_profile(GLbyte s,GLbyte t,GLbyte r,GLbyte q)const{ProfilingScope const scope(this,1946);(this->*(this->m_orig_glTexCoord4bOES))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVPROC m_orig_glVertexAttrib4fv = nullptr;
+void m_glVertexAttrib4fv_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1947);(this->*(this->m_orig_glVertexAttrib4fv))(index,v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3DVPROC m_orig_glProgramUniformMatrix2x3dv = nullptr;
+void m_glProgramUniformMatrix2x3dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,1948);(this->*(this->m_orig_glProgramUniformMatrix2x3dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERSI4UIVNVPROC m_orig_glProgramEnvParametersI4uivNV = nullptr;
+void m_glProgramEnvParametersI4uivNV_profile(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{ProfilingScope const scope(this,1949);(this->*(this->m_orig_glProgramEnvParametersI4uivNV))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD3XOESPROC m_orig_glTexCoord3xOES = nullptr;
+void m_glTexCoord3xOES_profile(GLfixed s,GLfixed t,GLfixed r)const{ProfilingScope const scope(this,1950);(this->*(this->m_orig_glTexCoord3xOES))(s,t,r);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFARBPROC m_orig_glLoadTransposeMatrixfARB = nullptr;
+void m_glLoadTransposeMatrixfARB_profile(const GLfloat* m)const{ProfilingScope const scope(this,1951);(this->*(this->m_orig_glLoadTransposeMatrixfARB))(m);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERIHPPROC m_orig_glImageTransformParameteriHP = nullptr;
+void m_glImageTransformParameteriHP_profile(GLenum target,GLenum pname,GLint param)const{ProfilingScope const scope(this,1952);(this->*(this->m_orig_glImageTransformParameteriHP))(target,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XOESPROC m_orig_glMultiTexCoord4xOES = nullptr;
+void m_glMultiTexCoord4xOES_profile(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{ProfilingScope const scope(this,1953);(this->*(this->m_orig_glMultiTexCoord4xOES))(texture,s,t,r,q);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3FVNVPROC m_orig_glVertexAttribs3fvNV = nullptr;
+void m_glVertexAttribs3fvNV_profile(GLuint index,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,1954);(this->*(this->m_orig_glVertexAttribs3fvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVPROC m_orig_glVertexAttrib2fv = nullptr;
+void m_glVertexAttrib2fv_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,1955);(this->*(this->m_orig_glVertexAttrib2fv))(index,v);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64NVPROC m_orig_glUniform3ui64NV = nullptr;
+void m_glUniform3ui64NV_profile(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{ProfilingScope const scope(this,1956);(this->*(this->m_orig_glUniform3ui64NV))(location,x,y,z);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERFVNVPROC m_orig_glCombinerParameterfvNV = nullptr;
+void m_glCombinerParameterfvNV_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,1957);(this->*(this->m_orig_glCombinerParameterfvNV))(pname,params);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALISGIXPROC m_orig_glFragmentMaterialiSGIX = nullptr;
+void m_glFragmentMaterialiSGIX_profile(GLenum face,GLenum pname,GLint param)const{ProfilingScope const scope(this,1958);(this->*(this->m_orig_glFragmentMaterialiSGIX))(face,pname,param);}
+FunctionTable::MEMBERPFNGLGETBOOLEANI_VPROC m_orig_glGetBooleani_v = nullptr;
+void m_glGetBooleani_v_profile(GLenum target,GLuint index,GLboolean* data)const{ProfilingScope const scope(this,1959);(this->*(this->m_orig_glGetBooleani_v))(target,index,data);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEINDEXPROC m_orig_glGetProgramResourceIndex = nullptr;
+GLuint m_glGetProgramResourceIndex_profile(GLuint program,GLenum programInterface,const GLchar* name)const{ProfilingScope const scope(this,1960);return (this->*(this->m_orig_glGetProgramResourceIndex))(program,programInterface,name);}
+FunctionTable::MEMBERPFNGLBEGINCONDITIONALRENDERNVPROC m_orig_glBeginConditionalRenderNV = nullptr;
+void m_glBeginConditionalRenderNV_profile(GLuint id,GLenum mode)const{ProfilingScope const scope(this,1961);(this->*(this->m_orig_glBeginConditionalRenderNV))(id,mode);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEPROC m_orig_glDisableClientState = nullptr;
+void m_glDisableClientState_profile(GLenum cap)const{ProfilingScope const scope(this,1962);(this->*(this->m_orig_glDisableClientState))(cap);}
+FunctionTable::MEMBERPFNGLPATHFOGGENNVPROC m_orig_glPathFogGenNV = nullptr;
+void m_glPathFogGenNV_profile(GLenum genMode)const{ProfilingScope const scope(this,1963);(this->*(this->m_orig_glPathFogGenNV))(genMode);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHNVPROC m_orig_glStencilThenCoverFillPathNV = nullptr;
+void m_glStencilThenCoverFillPathNV_profile(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode)const{ProfilingScope const scope(this,1964);(this->*(this->m_orig_glStencilThenCoverFillPathNV))(path,fillMode,mask,coverMode);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYINDEXOFFSETEXTPROC m_orig_glVertexArrayIndexOffsetEXT = nullptr;
+void m_glVertexArrayIndexOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,1965);(this->*(this->m_orig_glVertexArrayIndexOffsetEXT))(vaobj,buffer,type,stride,offset);}
+FunctionTable::MEMBERPFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC m_orig_glProgramBufferParametersIuivNV = nullptr;
+void m_glProgramBufferParametersIuivNV_profile(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params)const{ProfilingScope const scope(this,1966);(this->*(this->m_orig_glProgramBufferParametersIuivNV))(target,bindingIndex,wordIndex,count,params);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERIVEXTPROC m_orig_glPixelTransformParameterivEXT = nullptr;
+void m_glPixelTransformParameterivEXT_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,1967);(this->*(this->m_orig_glPixelTransformParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLDISABLECLIENTSTATEIEXTPROC m_orig_glDisableClientStateiEXT = nullptr;
+void m_glDisableClientStateiEXT_profile(GLenum array,GLuint index)const{ProfilingScope const scope(this,1968);(this->*(this->m_orig_glDisableClientStateiEXT))(array,index);}
+FunctionTable::MEMBERPFNGLTEXBUFFERARBPROC m_orig_glTexBufferARB = nullptr;
+void m_glTexBufferARB_profile(GLenum target,GLenum internalformat,GLuint buffer)const{ProfilingScope const scope(this,1969);(this->*(this->m_orig_glTexBufferARB))(target,internalformat,buffer);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTINTEGERVEXTPROC m_orig_glGetLocalConstantIntegervEXT = nullptr;
+void m_glGetLocalConstantIntegervEXT_profile(GLuint id,GLenum value,GLint* data)const{ProfilingScope const scope(this,1970);(this->*(this->m_orig_glGetLocalConstantIntegervEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLCOLOR4UIVPROC m_orig_glColor4uiv = nullptr;
+void m_glColor4uiv_profile(const GLuint* v)const{ProfilingScope const scope(this,1971);(this->*(this->m_orig_glColor4uiv))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IPROC m_orig_glProgramUniform3i = nullptr;
+void m_glProgramUniform3i_profile(GLuint program,GLint location,GLint v0,GLint v1,GLint v2)const{ProfilingScope const scope(this,1972);(this->*(this->m_orig_glProgramUniform3i))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC m_orig_glMultiDrawElementsIndirectBindlessCountNV = nullptr;
+void m_glMultiDrawElementsIndirectBindlessCountNV_profile(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount)const{ProfilingScope const scope(this,1973);(this->*(this->m_orig_glMultiDrawElementsIndirectBindlessCountNV))(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVARBPROC m_orig_glGetBufferPointervARB = nullptr;
+void m_glGetBufferPointervARB_profile(GLenum target,GLenum pname,void** params)const{ProfilingScope const scope(this,1974);(this->*(this->m_orig_glGetBufferPointervARB))(target,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIUIVEXTPROC m_orig_glMultiTexParameterIuivEXT = nullptr;
+void m_glMultiTexParameterIuivEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLuint* params)const{ProfilingScope const scope(this,1975);(this->*(this->m_orig_glMultiTexParameterIuivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLEVALMESH2PROC m_orig_glEvalMesh2 = nullptr;
+void m_glEvalMesh2_profile(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2)const{ProfilingScope const scope(this,1976);(this->*(this->m_orig_glEvalMesh2))(mode,i1,i2,j1,j2);}
+FunctionTable::MEMBERPFNGLEVALMESH1PROC m_orig_glEvalMesh1 = nullptr;
+void m_glEvalMesh1_profile(GLenum mode,GLint i1,GLint i2)const{ProfilingScope const scope(this,1977);(this->*(this->m_orig_glEvalMesh1))(mode,i1,i2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FPROC m_orig_glProgramUniform3f = nullptr;
+void m_glProgramUniform3f_profile(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{ProfilingScope const scope(this,1978);(this->*(this->m_orig_glProgramUniform3f))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC m_orig_glStencilThenCoverFillPathInstancedNV = nullptr;
+void m_glStencilThenCoverFillPathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,1979);(this->*(this->m_orig_glStencilThenCoverFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3DPROC m_orig_glProgramUniform3d = nullptr;
+void m_glProgramUniform3d_profile(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2)const{ProfilingScope const scope(this,1980);(this->*(this->m_orig_glProgramUniform3d))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLMAPVERTEXATTRIB1DAPPLEPROC m_orig_glMapVertexAttrib1dAPPLE = nullptr;
+void m_glMapVertexAttrib1dAPPLE_profile(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points)const{ProfilingScope const scope(this,1981);(this->*(this->m_orig_glMapVertexAttrib1dAPPLE))(index,size,u1,u2,stride,order,points);}
+FunctionTable::MEMBERPFNGLEVALCOORD2FVPROC m_orig_glEvalCoord2fv = nullptr;
+void m_glEvalCoord2fv_profile(const GLfloat* u)const{ProfilingScope const scope(this,1982);(this->*(this->m_orig_glEvalCoord2fv))(u);}
+FunctionTable::MEMBERPFNGLGETUNIFORMIVARBPROC m_orig_glGetUniformivARB = nullptr;
+void m_glGetUniformivARB_profile(GLhandleARB programObj,GLint location,GLint* params)const{ProfilingScope const scope(this,1983);(this->*(this->m_orig_glGetUniformivARB))(programObj,location,params);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXDPROC m_orig_glLoadTransposeMatrixd = nullptr;
+void m_glLoadTransposeMatrixd_profile(const GLdouble m[16])const{ProfilingScope const scope(this,1984);(this->*(this->m_orig_glLoadTransposeMatrixd))(m);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXFPROC m_orig_glLoadTransposeMatrixf = nullptr;
+void m_glLoadTransposeMatrixf_profile(const GLfloat m[16])const{ProfilingScope const scope(this,1985);(this->*(this->m_orig_glLoadTransposeMatrixf))(m);}
+FunctionTable::MEMBERPFNGLGETPOINTERVEXTPROC m_orig_glGetPointervEXT = nullptr;
+void m_glGetPointervEXT_profile(GLenum pname,void** params)const{ProfilingScope const scope(this,1986);(this->*(this->m_orig_glGetPointervEXT))(pname,params);}
+FunctionTable::MEMBERPFNGLSIGNALVKSEMAPHORENVPROC m_orig_glSignalVkSemaphoreNV = nullptr;
+void m_glSignalVkSemaphoreNV_profile(GLuint64 vkSemaphore)const{ProfilingScope const scope(this,1987);(this->*(this->m_orig_glSignalVkSemaphoreNV))(vkSemaphore);}
+FunctionTable::MEMBERPFNGLENDCONDITIONALRENDERNVPROC m_orig_glEndConditionalRenderNV = nullptr;
+void m_glEndConditionalRenderNV_profile()const{ProfilingScope const scope(this,1988);(this->*(this->m_orig_glEndConditionalRenderNV))();}
+FunctionTable::MEMBERPFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC m_orig_glTexCoord2fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fNormal3fVertex3fSUN_profile(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,1989);(this->*(this->m_orig_glTexCoord2fNormal3fVertex3fSUN))(s,t,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLUNIFORM3I64VARBPROC m_orig_glUniform3i64vARB = nullptr;
+void m_glUniform3i64vARB_profile(GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,1990);(this->*(this->m_orig_glUniform3i64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UIEXTPROC m_orig_glProgramUniform2uiEXT = nullptr;
+void m_glProgramUniform2uiEXT_profile(GLuint program,GLint location,GLuint v0,GLuint v1)const{ProfilingScope const scope(this,1991);(this->*(this->m_orig_glProgramUniform2uiEXT))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1UIPROC m_orig_glVertexAttribI1ui = nullptr;
+void m_glVertexAttribI1ui_profile(GLuint index,GLuint x)const{ProfilingScope const scope(this,1992);(this->*(this->m_orig_glVertexAttribI1ui))(index,x);}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4DVNVPROC m_orig_glProgramNamedParameter4dvNV = nullptr;
+void m_glProgramNamedParameter4dvNV_profile(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v)const{ProfilingScope const scope(this,1993);(this->*(this->m_orig_glProgramNamedParameter4dvNV))(id,len,name,v);}
+FunctionTable::MEMBERPFNGLCOMPILECOMMANDLISTNVPROC m_orig_glCompileCommandListNV = nullptr;
+void m_glCompileCommandListNV_profile(GLuint list)const{ProfilingScope const scope(this,1994);(this->*(this->m_orig_glCompileCommandListNV))(list);}
+FunctionTable::MEMBERPFNGLGETRENDERBUFFERPARAMETERIVEXTPROC m_orig_glGetRenderbufferParameterivEXT = nullptr;
+void m_glGetRenderbufferParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1995);(this->*(this->m_orig_glGetRenderbufferParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETNPOLYGONSTIPPLEPROC m_orig_glGetnPolygonStipple = nullptr;
+void m_glGetnPolygonStipple_profile(GLsizei bufSize,GLubyte* pattern)const{ProfilingScope const scope(this,1996);(this->*(this->m_orig_glGetnPolygonStipple))(bufSize,pattern);}
+FunctionTable::MEMBERPFNGLISBUFFERRESIDENTNVPROC m_orig_glIsBufferResidentNV = nullptr;
+GLboolean m_glIsBufferResidentNV_profile(GLenum target)const{ProfilingScope const scope(this,1997);return (this->*(this->m_orig_glIsBufferResidentNV))(target);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBVEXTPROC m_orig_glSecondaryColor3ubvEXT = nullptr;
+void m_glSecondaryColor3ubvEXT_profile(const GLubyte* v)const{ProfilingScope const scope(this,1998);(this->*(this->m_orig_glSecondaryColor3ubvEXT))(v);}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedRenderbufferParameterivEXT = nullptr;
+void m_glGetNamedRenderbufferParameterivEXT_profile(GLuint renderbuffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,1999);(this->*(this->m_orig_glGetNamedRenderbufferParameterivEXT))(renderbuffer,pname,params);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_orig_glNamedFramebufferSampleLocationsfvARB = nullptr;
+void m_glNamedFramebufferSampleLocationsfvARB_profile(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,2000);(this->*(this->m_orig_glNamedFramebufferSampleLocationsfvARB))(framebuffer,start,count,v);}
+FunctionTable::MEMBERPFNGLMULTITEXGENDVEXTPROC m_orig_glMultiTexGendvEXT = nullptr;
+void m_glMultiTexGendvEXT_profile(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params)const{ProfilingScope const scope(this,2001);(this->*(this->m_orig_glMultiTexGendvEXT))(texunit,coord,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYRANGENVPROC m_orig_glVertexArrayRangeNV = nullptr;
+void m_glVertexArrayRangeNV_profile(GLsizei length,const void* pointer)const{ProfilingScope const scope(this,2002);(this->*(this->m_orig_glVertexArrayRangeNV))(length,pointer);}
+FunctionTable::MEMBERPFNGLISTEXTUREHANDLERESIDENTNVPROC m_orig_glIsTextureHandleResidentNV = nullptr;
+GLboolean m_glIsTextureHandleResidentNV_profile(GLuint64 handle)const{ProfilingScope const scope(this,2003);return (this->*(this->m_orig_glIsTextureHandleResidentNV))(handle);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERDVARBPROC m_orig_glGetProgramEnvParameterdvARB = nullptr;
+void m_glGetProgramEnvParameterdvARB_profile(GLenum target,GLuint index,GLdouble* params)const{ProfilingScope const scope(this,2004);(this->*(this->m_orig_glGetProgramEnvParameterdvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLISNAMEDSTRINGARBPROC m_orig_glIsNamedStringARB = nullptr;
+GLboolean m_glIsNamedStringARB_profile(GLint namelen,const GLchar* name)const{ProfilingScope const scope(this,2005);return (this->*(this->m_orig_glIsNamedStringARB))(namelen,name);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORFORMATNVPROC m_orig_glSecondaryColorFormatNV = nullptr;
+void m_glSecondaryColorFormatNV_profile(GLint size,GLenum type,GLsizei stride)const{ProfilingScope const scope(this,2006);(this->*(this->m_orig_glSecondaryColorFormatNV))(size,type,stride);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4UBVNVPROC m_orig_glVertexAttrib4ubvNV = nullptr;
+void m_glVertexAttrib4ubvNV_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,2007);(this->*(this->m_orig_glVertexAttrib4ubvNV))(index,v);}
+FunctionTable::MEMBERPFNGLTAGSAMPLEBUFFERSGIXPROC m_orig_glTagSampleBufferSGIX = nullptr;
+void m_glTagSampleBufferSGIX_profile()const{ProfilingScope const scope(this,2008);(this->*(this->m_orig_glTagSampleBufferSGIX))();}
+FunctionTable::MEMBERPFNGLVDPAUUNREGISTERSURFACENVPROC m_orig_glVDPAUUnregisterSurfaceNV = nullptr;
+void m_glVDPAUUnregisterSurfaceNV_profile(GLvdpauSurfaceNV surface)const{ProfilingScope const scope(this,2009);(this->*(this->m_orig_glVDPAUUnregisterSurfaceNV))(surface);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYIDBYNAMEINTELPROC m_orig_glGetPerfQueryIdByNameINTEL = nullptr;
+void m_glGetPerfQueryIdByNameINTEL_profile(GLchar* queryName,GLuint* queryId)const{ProfilingScope const scope(this,2010);(this->*(this->m_orig_glGetPerfQueryIdByNameINTEL))(queryName,queryId);}
+FunctionTable::MEMBERPFNGLGETINTEGER64VPROC m_orig_glGetInteger64v = nullptr;
+void m_glGetInteger64v_profile(GLenum pname,GLint64* data)const{ProfilingScope const scope(this,2011);(this->*(this->m_orig_glGetInteger64v))(pname,data);}
+FunctionTable::MEMBERPFNGLCLIPPLANEPROC m_orig_glClipPlane = nullptr;
+void m_glClipPlane_profile(GLenum plane,const GLdouble* equation)const{ProfilingScope const scope(this,2012);(this->*(this->m_orig_glClipPlane))(plane,equation);}
+FunctionTable::MEMBERPFNGLCOLOR4UBVERTEX3FSUNPROC m_orig_glColor4ubVertex3fSUN = nullptr;
+void m_glColor4ubVertex3fSUN_profile(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2013);(this->*(this->m_orig_glColor4ubVertex3fSUN))(r,g,b,a,x,y,z);}
+FunctionTable::MEMBERPFNGLINDEXUBPROC m_orig_glIndexub = nullptr;
+void m_glIndexub_profile(GLubyte c)const{ProfilingScope const scope(this,2014);(this->*(this->m_orig_glIndexub))(c);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERFVARBPROC m_orig_glGetProgramEnvParameterfvARB = nullptr;
+void m_glGetProgramEnvParameterfvARB_profile(GLenum target,GLuint index,GLfloat* params)const{ProfilingScope const scope(this,2015);(this->*(this->m_orig_glGetProgramEnvParameterfvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4USVARBPROC m_orig_glVertexAttrib4usvARB = nullptr;
+void m_glVertexAttrib4usvARB_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,2016);(this->*(this->m_orig_glVertexAttrib4usvARB))(index,v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC m_orig_glNamedFramebufferRenderbuffer = nullptr;
+void m_glNamedFramebufferRenderbuffer_profile(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{ProfilingScope const scope(this,2017);(this->*(this->m_orig_glNamedFramebufferRenderbuffer))(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X4DVPROC m_orig_glProgramUniformMatrix3x4dv = nullptr;
+void m_glProgramUniformMatrix3x4dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2018);(this->*(this->m_orig_glProgramUniformMatrix3x4dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTESTFENCEAPPLEPROC m_orig_glTestFenceAPPLE = nullptr;
+GLboolean m_glTestFenceAPPLE_profile(GLuint fence)const{ProfilingScope const scope(this,2019);return (this->*(this->m_orig_glTestFenceAPPLE))(fence);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NIVPROC m_orig_glVertexAttrib4Niv = nullptr;
+void m_glVertexAttrib4Niv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2020);(this->*(this->m_orig_glVertexAttrib4Niv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL2I64VNVPROC m_orig_glVertexAttribL2i64vNV = nullptr;
+void m_glVertexAttribL2i64vNV_profile(GLuint index,const GLint64EXT* v)const{ProfilingScope const scope(this,2021);(this->*(this->m_orig_glVertexAttribL2i64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLCOLORP4UIVPROC m_orig_glColorP4uiv = nullptr;
+void m_glColorP4uiv_profile(GLenum type,const GLuint* color)const{ProfilingScope const scope(this,2022);(this->*(this->m_orig_glColorP4uiv))(type,color);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2X3FVPROC m_orig_glUniformMatrix2x3fv = nullptr;
+void m_glUniformMatrix2x3fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2023);(this->*(this->m_orig_glUniformMatrix2x3fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLCALLCOMMANDLISTNVPROC m_orig_glCallCommandListNV = nullptr;
+void m_glCallCommandListNV_profile(GLuint list)const{ProfilingScope const scope(this,2024);(this->*(this->m_orig_glCallCommandListNV))(list);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERIVPROC m_orig_glClearBufferiv = nullptr;
+void m_glClearBufferiv_profile(GLenum buffer,GLint drawbuffer,const GLint* value)const{ProfilingScope const scope(this,2025);(this->*(this->m_orig_glClearBufferiv))(buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLNAMEDSTRINGARBPROC m_orig_glNamedStringARB = nullptr;
+void m_glNamedStringARB_profile(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string)const{ProfilingScope const scope(this,2026);(this->*(this->m_orig_glNamedStringARB))(type,namelen,name,stringlen,string);}
+FunctionTable::MEMBERPFNGLMATRIXMULT3X2FNVPROC m_orig_glMatrixMult3x2fNV = nullptr;
+void m_glMatrixMult3x2fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,2027);(this->*(this->m_orig_glMatrixMult3x2fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMSTRINGEXTPROC m_orig_glGetNamedProgramStringEXT = nullptr;
+void m_glGetNamedProgramStringEXT_profile(GLuint program,GLenum target,GLenum pname,void* string)const{ProfilingScope const scope(this,2028);(this->*(this->m_orig_glGetNamedProgramStringEXT))(program,target,pname,string);}
+FunctionTable::MEMBERPFNGLGETNHISTOGRAMARBPROC m_orig_glGetnHistogramARB = nullptr;
+void m_glGetnHistogramARB_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{ProfilingScope const scope(this,2029);(this->*(this->m_orig_glGetnHistogramARB))(target,reset,format,type,bufSize,values);}
+FunctionTable::MEMBERPFNGLGETTEXTURELEVELPARAMETERFVPROC m_orig_glGetTextureLevelParameterfv = nullptr;
+void m_glGetTextureLevelParameterfv_profile(GLuint texture,GLint level,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2030);(this->*(this->m_orig_glGetTextureLevelParameterfv))(texture,level,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1FVPROC m_orig_glMultiTexCoord1fv = nullptr;
+void m_glMultiTexCoord1fv_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,2031);(this->*(this->m_orig_glMultiTexCoord1fv))(target,v);}
+FunctionTable::MEMBERPFNGLBITMAPXOESPROC m_orig_glBitmapxOES = nullptr;
+void m_glBitmapxOES_profile(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap)const{ProfilingScope const scope(this,2032);(this->*(this->m_orig_glBitmapxOES))(width,height,xorig,yorig,xmove,ymove,bitmap);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIUIVPROC m_orig_glGetSamplerParameterIuiv = nullptr;
+void m_glGetSamplerParameterIuiv_profile(GLuint sampler,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,2033);(this->*(this->m_orig_glGetSamplerParameterIuiv))(sampler,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORDP3UIPROC m_orig_glTexCoordP3ui = nullptr;
+void m_glTexCoordP3ui_profile(GLenum type,GLuint coords)const{ProfilingScope const scope(this,2034);(this->*(this->m_orig_glTexCoordP3ui))(type,coords);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DPROC m_orig_glTextureSubImage1D = nullptr;
+void m_glTextureSubImage1D_profile(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2035);(this->*(this->m_orig_glTextureSubImage1D))(texture,level,xoffset,width,format,type,pixels);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTEREXTPROC m_orig_glVertexAttribLPointerEXT = nullptr;
+void m_glVertexAttribLPointerEXT_profile(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2036);(this->*(this->m_orig_glVertexAttribLPointerEXT))(index,size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLFOGCOORDPOINTEREXTPROC m_orig_glFogCoordPointerEXT = nullptr;
+void m_glFogCoordPointerEXT_profile(GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2037);(this->*(this->m_orig_glFogCoordPointerEXT))(type,stride,pointer);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SPROC m_orig_glWindowPos3s = nullptr;
+void m_glWindowPos3s_profile(GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,2038);(this->*(this->m_orig_glWindowPos3s))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS2SVNVPROC m_orig_glVertexAttribs2svNV = nullptr;
+void m_glVertexAttribs2svNV_profile(GLuint index,GLsizei count,const GLshort* v)const{ProfilingScope const scope(this,2039);(this->*(this->m_orig_glVertexAttribs2svNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DEXTPROC m_orig_glTextureImage3DEXT = nullptr;
+void m_glTextureImage3DEXT_profile(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2040);(this->*(this->m_orig_glTextureImage3DEXT))(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3IPROC m_orig_glWindowPos3i = nullptr;
+void m_glWindowPos3i_profile(GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,2041);(this->*(this->m_orig_glWindowPos3i))(x,y,z);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DPROC m_orig_glWindowPos3d = nullptr;
+void m_glWindowPos3d_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,2042);(this->*(this->m_orig_glWindowPos3d))(x,y,z);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FPROC m_orig_glWindowPos3f = nullptr;
+void m_glWindowPos3f_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2043);(this->*(this->m_orig_glWindowPos3f))(x,y,z);}
+FunctionTable::MEMBERPFNGLISENABLEDINDEXEDEXTPROC m_orig_glIsEnabledIndexedEXT = nullptr;
+GLboolean m_glIsEnabledIndexedEXT_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,2044);return (this->*(this->m_orig_glIsEnabledIndexedEXT))(target,index);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMIVEXTPROC m_orig_glGetNamedProgramivEXT = nullptr;
+void m_glGetNamedProgramivEXT_profile(GLuint program,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2045);(this->*(this->m_orig_glGetNamedProgramivEXT))(program,target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEX3XVOESPROC m_orig_glVertex3xvOES = nullptr;
+void m_glVertex3xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,2046);(this->*(this->m_orig_glVertex3xvOES))(coords);}
+FunctionTable::MEMBERPFNGLCOLOR3USPROC m_orig_glColor3us = nullptr;
+void m_glColor3us_profile(GLushort red,GLushort green,GLushort blue)const{ProfilingScope const scope(this,2047);(this->*(this->m_orig_glColor3us))(red,green,blue);}
+FunctionTable::MEMBERPFNGLBEGINPERFMONITORAMDPROC m_orig_glBeginPerfMonitorAMD = nullptr;
+void m_glBeginPerfMonitorAMD_profile(GLuint monitor)const{ProfilingScope const scope(this,2048);(this->*(this->m_orig_glBeginPerfMonitorAMD))(monitor);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X3DVPROC m_orig_glProgramUniformMatrix4x3dv = nullptr;
+void m_glProgramUniformMatrix4x3dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2049);(this->*(this->m_orig_glProgramUniformMatrix4x3dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC m_orig_glGetNamedProgramLocalParameterIuivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIuivEXT_profile(GLuint program,GLenum target,GLuint index,GLuint* params)const{ProfilingScope const scope(this,2050);(this->*(this->m_orig_glGetNamedProgramLocalParameterIuivEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLREADNPIXELSPROC m_orig_glReadnPixels = nullptr;
+void m_glReadnPixels_profile(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data)const{ProfilingScope const scope(this,2051);(this->*(this->m_orig_glReadnPixels))(x,y,width,height,format,type,bufSize,data);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FPROC m_orig_glMultiTexCoord4f = nullptr;
+void m_glMultiTexCoord4f_profile(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q)const{ProfilingScope const scope(this,2052);(this->*(this->m_orig_glMultiTexCoord4f))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLCOLOR3UBPROC m_orig_glColor3ub = nullptr;
+void m_glColor3ub_profile(GLubyte red,GLubyte green,GLubyte blue)const{ProfilingScope const scope(this,2053);(this->*(this->m_orig_glColor3ub))(red,green,blue);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DPROC m_orig_glMultiTexCoord4d = nullptr;
+void m_glMultiTexCoord4d_profile(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q)const{ProfilingScope const scope(this,2054);(this->*(this->m_orig_glMultiTexCoord4d))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL3UI64NVPROC m_orig_glVertexAttribL3ui64NV = nullptr;
+void m_glVertexAttribL3ui64NV_profile(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z)const{ProfilingScope const scope(this,2055);(this->*(this->m_orig_glVertexAttribL3ui64NV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLCOLOR3UIPROC m_orig_glColor3ui = nullptr;
+void m_glColor3ui_profile(GLuint red,GLuint green,GLuint blue)const{ProfilingScope const scope(this,2056);(this->*(this->m_orig_glColor3ui))(red,green,blue);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4FVEXTPROC m_orig_glProgramUniform4fvEXT = nullptr;
+void m_glProgramUniform4fvEXT_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2057);(this->*(this->m_orig_glProgramUniform4fvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SARBPROC m_orig_glVertexAttrib2sARB = nullptr;
+void m_glVertexAttrib2sARB_profile(GLuint index,GLshort x,GLshort y)const{ProfilingScope const scope(this,2058);(this->*(this->m_orig_glVertexAttrib2sARB))(index,x,y);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IPROC m_orig_glMultiTexCoord4i = nullptr;
+void m_glMultiTexCoord4i_profile(GLenum target,GLint s,GLint t,GLint r,GLint q)const{ProfilingScope const scope(this,2059);(this->*(this->m_orig_glMultiTexCoord4i))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLCHECKFRAMEBUFFERSTATUSEXTPROC m_orig_glCheckFramebufferStatusEXT = nullptr;
+GLenum m_glCheckFramebufferStatusEXT_profile(GLenum target)const{ProfilingScope const scope(this,2060);return (this->*(this->m_orig_glCheckFramebufferStatusEXT))(target);}
+FunctionTable::MEMBERPFNGLGETNMAPIVARBPROC m_orig_glGetnMapivARB = nullptr;
+void m_glGetnMapivARB_profile(GLenum target,GLenum query,GLsizei bufSize,GLint* v)const{ProfilingScope const scope(this,2061);(this->*(this->m_orig_glGetnMapivARB))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1IVARBPROC m_orig_glMultiTexCoord1ivARB = nullptr;
+void m_glMultiTexCoord1ivARB_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,2062);(this->*(this->m_orig_glMultiTexCoord1ivARB))(target,v);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXATTRIBARRAYARBPROC m_orig_glDisableVertexAttribArrayARB = nullptr;
+void m_glDisableVertexAttribArrayARB_profile(GLuint index)const{ProfilingScope const scope(this,2063);(this->*(this->m_orig_glDisableVertexAttribArrayARB))(index);}
+FunctionTable::MEMBERPFNGLGETPOLYGONSTIPPLEPROC m_orig_glGetPolygonStipple = nullptr;
+void m_glGetPolygonStipple_profile(GLubyte* mask)const{ProfilingScope const scope(this,2064);(this->*(this->m_orig_glGetPolygonStipple))(mask);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIPROC m_orig_glVertexAttribI4ui = nullptr;
+void m_glVertexAttribI4ui_profile(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{ProfilingScope const scope(this,2065);(this->*(this->m_orig_glVertexAttribI4ui))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETPATHDASHARRAYNVPROC m_orig_glGetPathDashArrayNV = nullptr;
+void m_glGetPathDashArrayNV_profile(GLuint path,GLfloat* dashArray)const{ProfilingScope const scope(this,2066);(this->*(this->m_orig_glGetPathDashArrayNV))(path,dashArray);}
+FunctionTable::MEMBERPFNGLMULTITEXRENDERBUFFEREXTPROC m_orig_glMultiTexRenderbufferEXT = nullptr;
+void m_glMultiTexRenderbufferEXT_profile(GLenum texunit,GLenum target,GLuint renderbuffer)const{ProfilingScope const scope(this,2067);(this->*(this->m_orig_glMultiTexRenderbufferEXT))(texunit,target,renderbuffer);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE1DPROC m_orig_glCopyTextureSubImage1D = nullptr;
+void m_glCopyTextureSubImage1D_profile(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2068);(this->*(this->m_orig_glCopyTextureSubImage1D))(texture,level,xoffset,x,y,width);}
+FunctionTable::MEMBERPFNGLDELETEOCCLUSIONQUERIESNVPROC m_orig_glDeleteOcclusionQueriesNV = nullptr;
+void m_glDeleteOcclusionQueriesNV_profile(GLsizei n,const GLuint* ids)const{ProfilingScope const scope(this,2069);(this->*(this->m_orig_glDeleteOcclusionQueriesNV))(n,ids);}
+FunctionTable::MEMBERPFNGLVERTEX4HVNVPROC m_orig_glVertex4hvNV = nullptr;
+void m_glVertex4hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,2070);(this->*(this->m_orig_glVertex4hvNV))(v);}
+FunctionTable::MEMBERPFNGLGETNTEXIMAGEPROC m_orig_glGetnTexImage = nullptr;
+void m_glGetnTexImage_profile(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,2071);(this->*(this->m_orig_glGetnTexImage))(target,level,format,type,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETER4DARBPROC m_orig_glProgramLocalParameter4dARB = nullptr;
+void m_glProgramLocalParameter4dARB_profile(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2072);(this->*(this->m_orig_glProgramLocalParameter4dARB))(target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONPROC m_orig_glBlendEquation = nullptr;
+void m_glBlendEquation_profile(GLenum mode)const{ProfilingScope const scope(this,2073);(this->*(this->m_orig_glBlendEquation))(mode);}
+FunctionTable::MEMBERPFNGLUNLOCKARRAYSEXTPROC m_orig_glUnlockArraysEXT = nullptr;
+void m_glUnlockArraysEXT_profile()const{ProfilingScope const scope(this,2074);(this->*(this->m_orig_glUnlockArraysEXT))();}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VEXTPROC m_orig_glGetQueryObjectui64vEXT = nullptr;
+void m_glGetQueryObjectui64vEXT_profile(GLuint id,GLenum pname,GLuint64* params)const{ProfilingScope const scope(this,2075);(this->*(this->m_orig_glGetQueryObjectui64vEXT))(id,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVEXTPROC m_orig_glVertexAttribI4uivEXT = nullptr;
+void m_glVertexAttribI4uivEXT_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,2076);(this->*(this->m_orig_glVertexAttribI4uivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64VNVPROC m_orig_glUniform1i64vNV = nullptr;
+void m_glUniform1i64vNV_profile(GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,2077);(this->*(this->m_orig_glUniform1i64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVPROC m_orig_glMultiTexCoord3dv = nullptr;
+void m_glMultiTexCoord3dv_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,2078);(this->*(this->m_orig_glMultiTexCoord3dv))(target,v);}
+FunctionTable::MEMBERPFNGLCOLOR4SVPROC m_orig_glColor4sv = nullptr;
+void m_glColor4sv_profile(const GLshort* v)const{ProfilingScope const scope(this,2079);(this->*(this->m_orig_glColor4sv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4IVATIPROC m_orig_glVertexStream4ivATI = nullptr;
+void m_glVertexStream4ivATI_profile(GLenum stream,const GLint* coords)const{ProfilingScope const scope(this,2080);(this->*(this->m_orig_glVertexStream4ivATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLPOPCLIENTATTRIBPROC m_orig_glPopClientAttrib = nullptr;
+void m_glPopClientAttrib_profile()const{ProfilingScope const scope(this,2081);(this->*(this->m_orig_glPopClientAttrib))();}
+FunctionTable::MEMBERPFNGLCLEARBUFFERDATAPROC m_orig_glClearBufferData = nullptr;
+void m_glClearBufferData_profile(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,2082);(this->*(this->m_orig_glClearBufferData))(target,internalformat,format,type,data);}
+FunctionTable::MEMBERPFNGLGETPROGRAMIVNVPROC m_orig_glGetProgramivNV = nullptr;
+void m_glGetProgramivNV_profile(GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2083);(this->*(this->m_orig_glGetProgramivNV))(id,pname,params);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKPROC m_orig_glBeginTransformFeedback = nullptr;
+void m_glBeginTransformFeedback_profile(GLenum primitiveMode)const{ProfilingScope const scope(this,2084);(this->*(this->m_orig_glBeginTransformFeedback))(primitiveMode);}
+FunctionTable::MEMBERPFNGLFINISHOBJECTAPPLEPROC m_orig_glFinishObjectAPPLE = nullptr;
+void m_glFinishObjectAPPLE_profile(GLenum object,GLint name)const{ProfilingScope const scope(this,2085);(this->*(this->m_orig_glFinishObjectAPPLE))(object,name);}
+FunctionTable::MEMBERPFNGLGETMINMAXPARAMETERIVEXTPROC m_orig_glGetMinmaxParameterivEXT = nullptr;
+void m_glGetMinmaxParameterivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2086);(this->*(this->m_orig_glGetMinmaxParameterivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOLOR3IVPROC m_orig_glColor3iv = nullptr;
+void m_glColor3iv_profile(const GLint* v)const{ProfilingScope const scope(this,2087);(this->*(this->m_orig_glColor3iv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVPROC m_orig_glVertexAttrib3sv = nullptr;
+void m_glVertexAttrib3sv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2088);(this->*(this->m_orig_glVertexAttrib3sv))(index,v);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DPROC m_orig_glCompressedTexImage1D = nullptr;
+void m_glCompressedTexImage1D_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,2089);(this->*(this->m_orig_glCompressedTexImage1D))(target,level,internalformat,width,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSPROC m_orig_glDeleteTransformFeedbacks = nullptr;
+void m_glDeleteTransformFeedbacks_profile(GLsizei n,const GLuint* ids)const{ProfilingScope const scope(this,2090);(this->*(this->m_orig_glDeleteTransformFeedbacks))(n,ids);}
+FunctionTable::MEMBERPFNGLGETVIDEOI64VNVPROC m_orig_glGetVideoi64vNV = nullptr;
+void m_glGetVideoi64vNV_profile(GLuint video_slot,GLenum pname,GLint64EXT* params)const{ProfilingScope const scope(this,2091);(this->*(this->m_orig_glGetVideoi64vNV))(video_slot,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTSBASEVERTEXPROC m_orig_glDrawRangeElementsBaseVertex = nullptr;
+void m_glDrawRangeElementsBaseVertex_profile(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex)const{ProfilingScope const scope(this,2092);(this->*(this->m_orig_glDrawRangeElementsBaseVertex))(mode,start,end,count,type,indices,basevertex);}
+FunctionTable::MEMBERPFNGLUNIFORM4I64VARBPROC m_orig_glUniform4i64vARB = nullptr;
+void m_glUniform4i64vARB_profile(GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,2093);(this->*(this->m_orig_glUniform4i64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC m_orig_glTextureStorage3DMultisampleEXT = nullptr;
+void m_glTextureStorage3DMultisampleEXT_profile(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2094);(this->*(this->m_orig_glTextureStorage3DMultisampleEXT))(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERFVPROC m_orig_glGetTexParameterfv = nullptr;
+void m_glGetTexParameterfv_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2095);(this->*(this->m_orig_glGetTexParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMUI64VNVPROC m_orig_glProgramUniformui64vNV = nullptr;
+void m_glProgramUniformui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,2096);(this->*(this->m_orig_glProgramUniformui64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC m_orig_glCompressedMultiTexImage1DEXT = nullptr;
+void m_glCompressedMultiTexImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2097);(this->*(this->m_orig_glCompressedMultiTexImage1DEXT))(texunit,target,level,internalformat,width,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IVEXTPROC m_orig_glProgramUniform2ivEXT = nullptr;
+void m_glProgramUniform2ivEXT_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2098);(this->*(this->m_orig_glProgramUniform2ivEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLPUSHGROUPMARKEREXTPROC m_orig_glPushGroupMarkerEXT = nullptr;
+void m_glPushGroupMarkerEXT_profile(GLsizei length,const GLchar* marker)const{ProfilingScope const scope(this,2099);(this->*(this->m_orig_glPushGroupMarkerEXT))(length,marker);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DVPROC m_orig_glVertexAttrib1dv = nullptr;
+void m_glVertexAttrib1dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2100);(this->*(this->m_orig_glVertexAttrib1dv))(index,v);}
+FunctionTable::MEMBERPFNGLMATRIXLOADIDENTITYEXTPROC m_orig_glMatrixLoadIdentityEXT = nullptr;
+void m_glMatrixLoadIdentityEXT_profile(GLenum mode)const{ProfilingScope const scope(this,2101);(this->*(this->m_orig_glMatrixLoadIdentityEXT))(mode);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXXOESPROC m_orig_glMultTransposeMatrixxOES = nullptr;
+void m_glMultTransposeMatrixxOES_profile(const GLfixed* m)const{ProfilingScope const scope(this,2102);(this->*(this->m_orig_glMultTransposeMatrixxOES))(m);}
+FunctionTable::MEMBERPFNGLGETPIXELMAPXVPROC m_orig_glGetPixelMapxv = nullptr;
+void m_glGetPixelMapxv_profile(GLenum map,GLint size,GLfixed* values)const{ProfilingScope const scope(this,2103);(this->*(this->m_orig_glGetPixelMapxv))(map,size,values);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVARBPROC m_orig_glFramebufferSampleLocationsfvARB = nullptr;
+void m_glFramebufferSampleLocationsfvARB_profile(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,2104);(this->*(this->m_orig_glFramebufferSampleLocationsfvARB))(target,start,count,v);}
+FunctionTable::MEMBERPFNGLGETLIGHTIVPROC m_orig_glGetLightiv = nullptr;
+void m_glGetLightiv_profile(GLenum light,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2105);(this->*(this->m_orig_glGetLightiv))(light,pname,params);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIPROC m_orig_glBlendFuncSeparatei = nullptr;
+void m_glBlendFuncSeparatei_profile(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{ProfilingScope const scope(this,2106);(this->*(this->m_orig_glBlendFuncSeparatei))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+FunctionTable::MEMBERPFNGLACQUIREKEYEDMUTEXWIN32EXTPROC m_orig_glAcquireKeyedMutexWin32EXT = nullptr;
+GLboolean m_glAcquireKeyedMutexWin32EXT_profile(GLuint memory,GLuint64 key,GLuint timeout)const{ProfilingScope const scope(this,2107);return (this->*(this->m_orig_glAcquireKeyedMutexWin32EXT))(memory,key,timeout);}
+FunctionTable::MEMBERPFNGLGETBOOLEANINDEXEDVEXTPROC m_orig_glGetBooleanIndexedvEXT = nullptr;
+void m_glGetBooleanIndexedvEXT_profile(GLenum target,GLuint index,GLboolean* data)const{ProfilingScope const scope(this,2108);(this->*(this->m_orig_glGetBooleanIndexedvEXT))(target,index,data);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSUBROUTINEPARAMETERUIVNVPROC m_orig_glGetProgramSubroutineParameteruivNV = nullptr;
+void m_glGetProgramSubroutineParameteruivNV_profile(GLenum target,GLuint index,GLuint* param)const{ProfilingScope const scope(this,2109);(this->*(this->m_orig_glGetProgramSubroutineParameteruivNV))(target,index,param);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIPROC m_orig_glUniform2ui = nullptr;
+void m_glUniform2ui_profile(GLint location,GLuint v0,GLuint v1)const{ProfilingScope const scope(this,2110);(this->*(this->m_orig_glUniform2ui))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC m_orig_glApplyFramebufferAttachmentCMAAINTEL = nullptr;
+void m_glApplyFramebufferAttachmentCMAAINTEL_profile()const{ProfilingScope const scope(this,2111);(this->*(this->m_orig_glApplyFramebufferAttachmentCMAAINTEL))();}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVPROC m_orig_glWindowPos2fv = nullptr;
+void m_glWindowPos2fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,2112);(this->*(this->m_orig_glWindowPos2fv))(v);}
+FunctionTable::MEMBERPFNGLWAITVKSEMAPHORENVPROC m_orig_glWaitVkSemaphoreNV = nullptr;
+void m_glWaitVkSemaphoreNV_profile(GLuint64 vkSemaphore)const{ProfilingScope const scope(this,2113);(this->*(this->m_orig_glWaitVkSemaphoreNV))(vkSemaphore);}
+FunctionTable::MEMBERPFNGLDISABLEIPROC m_orig_glDisablei = nullptr;
+void m_glDisablei_profile(GLenum target,GLuint index)const{ProfilingScope const scope(this,2114);(this->*(this->m_orig_glDisablei))(target,index);}
+FunctionTable::MEMBERPFNGLSELECTPERFMONITORCOUNTERSAMDPROC m_orig_glSelectPerfMonitorCountersAMD = nullptr;
+void m_glSelectPerfMonitorCountersAMD_profile(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList)const{ProfilingScope const scope(this,2115);(this->*(this->m_orig_glSelectPerfMonitorCountersAMD))(monitor,enable,group,numCounters,counterList);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLI64VNVPROC m_orig_glGetVertexAttribLi64vNV = nullptr;
+void m_glGetVertexAttribLi64vNV_profile(GLuint index,GLenum pname,GLint64EXT* params)const{ProfilingScope const scope(this,2116);(this->*(this->m_orig_glGetVertexAttribLi64vNV))(index,pname,params);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEIARBPROC m_orig_glBlendFuncSeparateiARB = nullptr;
+void m_glBlendFuncSeparateiARB_profile(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{ProfilingScope const scope(this,2117);(this->*(this->m_orig_glBlendFuncSeparateiARB))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+FunctionTable::MEMBERPFNGLWEIGHTUIVARBPROC m_orig_glWeightuivARB = nullptr;
+void m_glWeightuivARB_profile(GLint size,const GLuint* weights)const{ProfilingScope const scope(this,2118);(this->*(this->m_orig_glWeightuivARB))(size,weights);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IARBPROC m_orig_glWindowPos2iARB = nullptr;
+void m_glWindowPos2iARB_profile(GLint x,GLint y)const{ProfilingScope const scope(this,2119);(this->*(this->m_orig_glWindowPos2iARB))(x,y);}
+FunctionTable::MEMBERPFNGLGETPROGRAMLOCALPARAMETERDVARBPROC m_orig_glGetProgramLocalParameterdvARB = nullptr;
+void m_glGetProgramLocalParameterdvARB_profile(GLenum target,GLuint index,GLdouble* params)const{ProfilingScope const scope(this,2120);(this->*(this->m_orig_glGetProgramLocalParameterdvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUI64VARBPROC m_orig_glGetUniformui64vARB = nullptr;
+void m_glGetUniformui64vARB_profile(GLuint program,GLint location,GLuint64* params)const{ProfilingScope const scope(this,2121);(this->*(this->m_orig_glGetUniformui64vARB))(program,location,params);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USPROC m_orig_glSecondaryColor3us = nullptr;
+void m_glSecondaryColor3us_profile(GLushort red,GLushort green,GLushort blue)const{ProfilingScope const scope(this,2122);(this->*(this->m_orig_glSecondaryColor3us))(red,green,blue);}
+FunctionTable::MEMBERPFNGLGETSYNCIVPROC m_orig_glGetSynciv = nullptr;
+void m_glGetSynciv_profile(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values)const{ProfilingScope const scope(this,2123);(this->*(this->m_orig_glGetSynciv))(sync,pname,bufSize,length,values);}
+FunctionTable::MEMBERPFNGLMAKEIMAGEHANDLERESIDENTARBPROC m_orig_glMakeImageHandleResidentARB = nullptr;
+void m_glMakeImageHandleResidentARB_profile(GLuint64 handle,GLenum access)const{ProfilingScope const scope(this,2124);(this->*(this->m_orig_glMakeImageHandleResidentARB))(handle,access);}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC m_orig_glGetProgramNamedParameterfvNV = nullptr;
+void m_glGetProgramNamedParameterfvNV_profile(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params)const{ProfilingScope const scope(this,2125);(this->*(this->m_orig_glGetProgramNamedParameterfvNV))(id,len,name,params);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE3DPROC m_orig_glTextureStorage3D = nullptr;
+void m_glTextureStorage3D_profile(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth)const{ProfilingScope const scope(this,2126);(this->*(this->m_orig_glTextureStorage3D))(texture,levels,internalformat,width,height,depth);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVNVPROC m_orig_glVertexAttrib4svNV = nullptr;
+void m_glVertexAttrib4svNV_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2127);(this->*(this->m_orig_glVertexAttrib4svNV))(index,v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2IPROC m_orig_glProgramUniform2i = nullptr;
+void m_glProgramUniform2i_profile(GLuint program,GLint location,GLint v0,GLint v1)const{ProfilingScope const scope(this,2128);(this->*(this->m_orig_glProgramUniform2i))(program,location,v0,v1);}
+FunctionTable::MEMBERPFNGLLISTDRAWCOMMANDSSTATESCLIENTNVPROC m_orig_glListDrawCommandsStatesClientNV = nullptr;
+void m_glListDrawCommandsStatesClientNV_profile(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{ProfilingScope const scope(this,2129);(this->*(this->m_orig_glListDrawCommandsStatesClientNV))(list,segment,indirects,sizes,states,fbos,count);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC m_orig_glProgramLocalParametersI4uivNV = nullptr;
+void m_glProgramLocalParametersI4uivNV_profile(GLenum target,GLuint index,GLsizei count,const GLuint* params)const{ProfilingScope const scope(this,2130);(this->*(this->m_orig_glProgramLocalParametersI4uivNV))(target,index,count,params);}
+FunctionTable::MEMBERPFNGLBEGINTRANSFORMFEEDBACKNVPROC m_orig_glBeginTransformFeedbackNV = nullptr;
+void m_glBeginTransformFeedbackNV_profile(GLenum primitiveMode)const{ProfilingScope const scope(this,2131);(this->*(this->m_orig_glBeginTransformFeedbackNV))(primitiveMode);}
+FunctionTable::MEMBERPFNGLGETPROGRAMBINARYPROC m_orig_glGetProgramBinary = nullptr;
+void m_glGetProgramBinary_profile(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary)const{ProfilingScope const scope(this,2132);(this->*(this->m_orig_glGetProgramBinary))(program,bufSize,length,binaryFormat,binary);}
+FunctionTable::MEMBERPFNGLBINORMAL3IEXTPROC m_orig_glBinormal3iEXT = nullptr;
+void m_glBinormal3iEXT_profile(GLint bx,GLint by,GLint bz)const{ProfilingScope const scope(this,2133);(this->*(this->m_orig_glBinormal3iEXT))(bx,by,bz);}
+FunctionTable::MEMBERPFNGLEVALPOINT1PROC m_orig_glEvalPoint1 = nullptr;
+void m_glEvalPoint1_profile(GLint i)const{ProfilingScope const scope(this,2134);(this->*(this->m_orig_glEvalPoint1))(i);}
+FunctionTable::MEMBERPFNGLEVALPOINT2PROC m_orig_glEvalPoint2 = nullptr;
+void m_glEvalPoint2_profile(GLint i,GLint j)const{ProfilingScope const scope(this,2135);(this->*(this->m_orig_glEvalPoint2))(i,j);}
+FunctionTable::MEMBERPFNGLPAUSETRANSFORMFEEDBACKPROC m_orig_glPauseTransformFeedback = nullptr;
+void m_glPauseTransformFeedback_profile()const{ProfilingScope const scope(this,2136);(this->*(this->m_orig_glPauseTransformFeedback))();}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SMESAPROC m_orig_glWindowPos2sMESA = nullptr;
+void m_glWindowPos2sMESA_profile(GLshort x,GLshort y)const{ProfilingScope const scope(this,2137);(this->*(this->m_orig_glWindowPos2sMESA))(x,y);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORBSUNPROC m_orig_glGlobalAlphaFactorbSUN = nullptr;
+void m_glGlobalAlphaFactorbSUN_profile(GLbyte factor)const{ProfilingScope const scope(this,2138);(this->*(this->m_orig_glGlobalAlphaFactorbSUN))(factor);}
+FunctionTable::MEMBERPFNGLCREATETRANSFORMFEEDBACKSPROC m_orig_glCreateTransformFeedbacks = nullptr;
+void m_glCreateTransformFeedbacks_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,2139);(this->*(this->m_orig_glCreateTransformFeedbacks))(n,ids);}
+FunctionTable::MEMBERPFNGLTEXTUREPAGECOMMITMENTEXTPROC m_orig_glTexturePageCommitmentEXT = nullptr;
+void m_glTexturePageCommitmentEXT_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit)const{ProfilingScope const scope(this,2140);(this->*(this->m_orig_glTexturePageCommitmentEXT))(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSNVPROC m_orig_glTransformFeedbackVaryingsNV = nullptr;
+void m_glTransformFeedbackVaryingsNV_profile(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode)const{ProfilingScope const scope(this,2141);(this->*(this->m_orig_glTransformFeedbackVaryingsNV))(program,count,locations,bufferMode);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE1DPROC m_orig_glTexSubImage1D = nullptr;
+void m_glTexSubImage1D_profile(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels)const{ProfilingScope const scope(this,2142);(this->*(this->m_orig_glTexSubImage1D))(target,level,xoffset,width,format,type,pixels);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFVEXTPROC m_orig_glConvolutionParameterfvEXT = nullptr;
+void m_glConvolutionParameterfvEXT_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2143);(this->*(this->m_orig_glConvolutionParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLBLITFRAMEBUFFEREXTPROC m_orig_glBlitFramebufferEXT = nullptr;
+void m_glBlitFramebufferEXT_profile(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter)const{ProfilingScope const scope(this,2144);(this->*(this->m_orig_glBlitFramebufferEXT))(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVARBPROC m_orig_glUniformMatrix4fvARB = nullptr;
+void m_glUniformMatrix4fvARB_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2145);(this->*(this->m_orig_glUniformMatrix4fvARB))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4DVARBPROC m_orig_glProgramEnvParameter4dvARB = nullptr;
+void m_glProgramEnvParameter4dvARB_profile(GLenum target,GLuint index,const GLdouble* params)const{ProfilingScope const scope(this,2146);(this->*(this->m_orig_glProgramEnvParameter4dvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DEXTPROC m_orig_glTextureStorageMem2DEXT = nullptr;
+void m_glTextureStorageMem2DEXT_profile(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2147);(this->*(this->m_orig_glTextureStorageMem2DEXT))(texture,levels,internalFormat,width,height,memory,offset);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP3UIVPROC m_orig_glVertexAttribP3uiv = nullptr;
+void m_glVertexAttribP3uiv_profile(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{ProfilingScope const scope(this,2148);(this->*(this->m_orig_glVertexAttribP3uiv))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLFOGCOORDFORMATNVPROC m_orig_glFogCoordFormatNV = nullptr;
+void m_glFogCoordFormatNV_profile(GLenum type,GLsizei stride)const{ProfilingScope const scope(this,2149);(this->*(this->m_orig_glFogCoordFormatNV))(type,stride);}
+FunctionTable::MEMBERPFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC m_orig_glGetMultiTexLevelParameterivEXT = nullptr;
+void m_glGetMultiTexLevelParameterivEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2150);(this->*(this->m_orig_glGetMultiTexLevelParameterivEXT))(texunit,target,level,pname,params);}
+FunctionTable::MEMBERPFNGLISOCCLUSIONQUERYNVPROC m_orig_glIsOcclusionQueryNV = nullptr;
+GLboolean m_glIsOcclusionQueryNV_profile(GLuint id)const{ProfilingScope const scope(this,2151);return (this->*(this->m_orig_glIsOcclusionQueryNV))(id);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE2DARBPROC m_orig_glCompressedTexImage2DARB = nullptr;
+void m_glCompressedTexImage2DARB_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,2152);(this->*(this->m_orig_glCompressedTexImage2DARB))(target,level,internalformat,width,height,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIUIVNVPROC m_orig_glGetProgramEnvParameterIuivNV = nullptr;
+void m_glGetProgramEnvParameterIuivNV_profile(GLenum target,GLuint index,GLuint* params)const{ProfilingScope const scope(this,2153);(this->*(this->m_orig_glGetProgramEnvParameterIuivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVPROC m_orig_glVertexAttrib4sv = nullptr;
+void m_glVertexAttrib4sv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2154);(this->*(this->m_orig_glVertexAttrib4sv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVARBPROC m_orig_glVertexAttrib4fvARB = nullptr;
+void m_glVertexAttrib4fvARB_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,2155);(this->*(this->m_orig_glVertexAttrib4fvARB))(index,v);}
+FunctionTable::MEMBERPFNGLLOADNAMEPROC m_orig_glLoadName = nullptr;
+void m_glLoadName_profile(GLuint name)const{ProfilingScope const scope(this,2156);(this->*(this->m_orig_glLoadName))(name);}
+FunctionTable::MEMBERPFNGLBINDVERTEXSHADEREXTPROC m_orig_glBindVertexShaderEXT = nullptr;
+void m_glBindVertexShaderEXT_profile(GLuint id)const{ProfilingScope const scope(this,2157);(this->*(this->m_orig_glBindVertexShaderEXT))(id);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC m_orig_glGetNamedProgramLocalParameterIivEXT = nullptr;
+void m_glGetNamedProgramLocalParameterIivEXT_profile(GLuint program,GLenum target,GLuint index,GLint* params)const{ProfilingScope const scope(this,2158);(this->*(this->m_orig_glGetNamedProgramLocalParameterIivEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIEXTPROC m_orig_glProgramUniform3uiEXT = nullptr;
+void m_glProgramUniform3uiEXT_profile(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{ProfilingScope const scope(this,2159);(this->*(this->m_orig_glProgramUniform3uiEXT))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVEXTPROC m_orig_glProgramUniformMatrix4x2dvEXT = nullptr;
+void m_glProgramUniformMatrix4x2dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2160);(this->*(this->m_orig_glProgramUniformMatrix4x2dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTEXCOORD1HVNVPROC m_orig_glTexCoord1hvNV = nullptr;
+void m_glTexCoord1hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,2161);(this->*(this->m_orig_glTexCoord1hvNV))(v);}
+FunctionTable::MEMBERPFNGLLOADMATRIXDPROC m_orig_glLoadMatrixd = nullptr;
+void m_glLoadMatrixd_profile(const GLdouble* m)const{ProfilingScope const scope(this,2162);(this->*(this->m_orig_glLoadMatrixd))(m);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERFVPROC m_orig_glTexParameterfv = nullptr;
+void m_glTexParameterfv_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2163);(this->*(this->m_orig_glTexParameterfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVARIANTDVEXTPROC m_orig_glVariantdvEXT = nullptr;
+void m_glVariantdvEXT_profile(GLuint id,const GLdouble* addr)const{ProfilingScope const scope(this,2164);(this->*(this->m_orig_glVariantdvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLCULLPARAMETERFVEXTPROC m_orig_glCullParameterfvEXT = nullptr;
+void m_glCullParameterfvEXT_profile(GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2165);(this->*(this->m_orig_glCullParameterfvEXT))(pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM3DVPROC m_orig_glUniform3dv = nullptr;
+void m_glUniform3dv_profile(GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,2166);(this->*(this->m_orig_glUniform3dv))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3FVPROC m_orig_glProgramUniform3fv = nullptr;
+void m_glProgramUniform3fv_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2167);(this->*(this->m_orig_glProgramUniform3fv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLISBUFFERARBPROC m_orig_glIsBufferARB = nullptr;
+GLboolean m_glIsBufferARB_profile(GLuint buffer)const{ProfilingScope const scope(this,2168);return (this->*(this->m_orig_glIsBufferARB))(buffer);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BOESPROC m_orig_glMultiTexCoord1bOES = nullptr;
+void m_glMultiTexCoord1bOES_profile(GLenum texture,GLbyte s)const{ProfilingScope const scope(this,2169);(this->*(this->m_orig_glMultiTexCoord1bOES))(texture,s);}
+FunctionTable::MEMBERPFNGLFOGCOORDHNVPROC m_orig_glFogCoordhNV = nullptr;
+void m_glFogCoordhNV_profile(GLhalfNV fog)const{ProfilingScope const scope(this,2170);(this->*(this->m_orig_glFogCoordhNV))(fog);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glFramebufferSampleLocationsfvNV = nullptr;
+void m_glFramebufferSampleLocationsfvNV_profile(GLenum target,GLuint start,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,2171);(this->*(this->m_orig_glFramebufferSampleLocationsfvNV))(target,start,count,v);}
+FunctionTable::MEMBERPFNGLGENSYMBOLSEXTPROC m_orig_glGenSymbolsEXT = nullptr;
+GLuint m_glGenSymbolsEXT_profile(GLenum datatype,GLenum storagetype,GLenum range,GLuint components)const{ProfilingScope const scope(this,2172);return (this->*(this->m_orig_glGenSymbolsEXT))(datatype,storagetype,range,components);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONFILTERPROC m_orig_glGetConvolutionFilter = nullptr;
+void m_glGetConvolutionFilter_profile(GLenum target,GLenum format,GLenum type,GLvoid* image)const{ProfilingScope const scope(this,2173);(this->*(this->m_orig_glGetConvolutionFilter))(target,format,type,image);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVEXTPROC m_orig_glProgramUniform1fvEXT = nullptr;
+void m_glProgramUniform1fvEXT_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2174);(this->*(this->m_orig_glProgramUniform1fvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLGETNEXTPERFQUERYIDINTELPROC m_orig_glGetNextPerfQueryIdINTEL = nullptr;
+void m_glGetNextPerfQueryIdINTEL_profile(GLuint queryId,GLuint* nextQueryId)const{ProfilingScope const scope(this,2175);(this->*(this->m_orig_glGetNextPerfQueryIdINTEL))(queryId,nextQueryId);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE1DARBPROC m_orig_glCompressedTexImage1DARB = nullptr;
+void m_glCompressedTexImage1DARB_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,2176);(this->*(this->m_orig_glCompressedTexImage1DARB))(target,level,internalformat,width,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLBINDSAMPLERSPROC m_orig_glBindSamplers = nullptr;
+void m_glBindSamplers_profile(GLuint first,GLsizei count,const GLuint* samplers)const{ProfilingScope const scope(this,2177);(this->*(this->m_orig_glBindSamplers))(first,count,samplers);}
+FunctionTable::MEMBERPFNGLGETPROGRAMENVPARAMETERIIVNVPROC m_orig_glGetProgramEnvParameterIivNV = nullptr;
+void m_glGetProgramEnvParameterIivNV_profile(GLenum target,GLuint index,GLint* params)const{ProfilingScope const scope(this,2178);(this->*(this->m_orig_glGetProgramEnvParameterIivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTUI64VPROC m_orig_glGetQueryObjectui64v = nullptr;
+void m_glGetQueryObjectui64v_profile(GLuint id,GLenum pname,GLuint64* params)const{ProfilingScope const scope(this,2179);(this->*(this->m_orig_glGetQueryObjectui64v))(id,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64VNVPROC m_orig_glVertexAttribL4ui64vNV = nullptr;
+void m_glVertexAttribL4ui64vNV_profile(GLuint index,const GLuint64EXT* v)const{ProfilingScope const scope(this,2180);(this->*(this->m_orig_glVertexAttribL4ui64vNV))(index,v);}
+FunctionTable::MEMBERPFNGLGETVIDEOIVNVPROC m_orig_glGetVideoivNV = nullptr;
+void m_glGetVideoivNV_profile(GLuint video_slot,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2181);(this->*(this->m_orig_glGetVideoivNV))(video_slot,pname,params);}
+FunctionTable::MEMBERPFNGLGETTEXTUREIMAGEPROC m_orig_glGetTextureImage = nullptr;
+void m_glGetTextureImage_profile(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,2182);(this->*(this->m_orig_glGetTextureImage))(texture,level,format,type,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FVPROC m_orig_glProgramUniform1fv = nullptr;
+void m_glProgramUniform1fv_profile(GLuint program,GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2183);(this->*(this->m_orig_glProgramUniform1fv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4FVPROC m_orig_glUniformMatrix4fv = nullptr;
+void m_glUniformMatrix4fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2184);(this->*(this->m_orig_glUniformMatrix4fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLCOLORMASKPROC m_orig_glColorMask = nullptr;
+void m_glColorMask_profile(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha)const{ProfilingScope const scope(this,2185);(this->*(this->m_orig_glColorMask))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLBEGINFRAGMENTSHADERATIPROC m_orig_glBeginFragmentShaderATI = nullptr;
+void m_glBeginFragmentShaderATI_profile()const{ProfilingScope const scope(this,2186);(this->*(this->m_orig_glBeginFragmentShaderATI))();}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSEXTPROC m_orig_glMultiDrawArraysEXT = nullptr;
+void m_glMultiDrawArraysEXT_profile(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount)const{ProfilingScope const scope(this,2187);(this->*(this->m_orig_glMultiDrawArraysEXT))(mode,first,count,primcount);}
+FunctionTable::MEMBERPFNGLGENNAMESAMDPROC m_orig_glGenNamesAMD = nullptr;
+void m_glGenNamesAMD_profile(GLenum identifier,GLuint num,GLuint* names)const{ProfilingScope const scope(this,2188);(this->*(this->m_orig_glGenNamesAMD))(identifier,num,names);}
+FunctionTable::MEMBERPFNGLPATHPARAMETERINVPROC m_orig_glPathParameteriNV = nullptr;
+void m_glPathParameteriNV_profile(GLuint path,GLenum pname,GLint value)const{ProfilingScope const scope(this,2189);(this->*(this->m_orig_glPathParameteriNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLCREATECOMMANDLISTSNVPROC m_orig_glCreateCommandListsNV = nullptr;
+void m_glCreateCommandListsNV_profile(GLsizei n,GLuint* lists)const{ProfilingScope const scope(this,2190);(this->*(this->m_orig_glCreateCommandListsNV))(n,lists);}
+FunctionTable::MEMBERPFNGLDELETEPROGRAMPIPELINESPROC m_orig_glDeleteProgramPipelines = nullptr;
+void m_glDeleteProgramPipelines_profile(GLsizei n,const GLuint* pipelines)const{ProfilingScope const scope(this,2191);(this->*(this->m_orig_glDeleteProgramPipelines))(n,pipelines);}
+FunctionTable::MEMBERPFNGLCOPYCOLORSUBTABLEEXTPROC m_orig_glCopyColorSubTableEXT = nullptr;
+void m_glCopyColorSubTableEXT_profile(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2192);(this->*(this->m_orig_glCopyColorSubTableEXT))(target,start,x,y,width);}
+FunctionTable::MEMBERPFNGLVARIANTSVEXTPROC m_orig_glVariantsvEXT = nullptr;
+void m_glVariantsvEXT_profile(GLuint id,const GLshort* addr)const{ProfilingScope const scope(this,2193);(this->*(this->m_orig_glVariantsvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLGENPROGRAMPIPELINESPROC m_orig_glGenProgramPipelines = nullptr;
+void m_glGenProgramPipelines_profile(GLsizei n,GLuint* pipelines)const{ProfilingScope const scope(this,2194);(this->*(this->m_orig_glGenProgramPipelines))(n,pipelines);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC m_orig_glVertexArrayEdgeFlagOffsetEXT = nullptr;
+void m_glVertexArrayEdgeFlagOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,2195);(this->*(this->m_orig_glVertexArrayEdgeFlagOffsetEXT))(vaobj,buffer,stride,offset);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SPROC m_orig_glWindowPos2s = nullptr;
+void m_glWindowPos2s_profile(GLshort x,GLshort y)const{ProfilingScope const scope(this,2196);(this->*(this->m_orig_glWindowPos2s))(x,y);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3IEXTPROC m_orig_glSecondaryColor3iEXT = nullptr;
+void m_glSecondaryColor3iEXT_profile(GLint red,GLint green,GLint blue)const{ProfilingScope const scope(this,2197);(this->*(this->m_orig_glSecondaryColor3iEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IPROC m_orig_glWindowPos2i = nullptr;
+void m_glWindowPos2i_profile(GLint x,GLint y)const{ProfilingScope const scope(this,2198);(this->*(this->m_orig_glWindowPos2i))(x,y);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FPROC m_orig_glWindowPos2f = nullptr;
+void m_glWindowPos2f_profile(GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2199);(this->*(this->m_orig_glWindowPos2f))(x,y);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DPROC m_orig_glWindowPos2d = nullptr;
+void m_glWindowPos2d_profile(GLdouble x,GLdouble y)const{ProfilingScope const scope(this,2200);(this->*(this->m_orig_glWindowPos2d))(x,y);}
+FunctionTable::MEMBERPFNGLUNIFORM4UIVEXTPROC m_orig_glUniform4uivEXT = nullptr;
+void m_glUniform4uivEXT_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,2201);(this->*(this->m_orig_glUniform4uivEXT))(location,count,value);}
+FunctionTable::MEMBERPFNGLORTHOXOESPROC m_orig_glOrthoxOES = nullptr;
+void m_glOrthoxOES_profile(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f)const{ProfilingScope const scope(this,2202);(this->*(this->m_orig_glOrthoxOES))(l,r,b,t,n,f);}
+FunctionTable::MEMBERPFNGLUNIFORMSUBROUTINESUIVPROC m_orig_glUniformSubroutinesuiv = nullptr;
+void m_glUniformSubroutinesuiv_profile(GLenum shadertype,GLsizei count,const GLuint* indices)const{ProfilingScope const scope(this,2203);(this->*(this->m_orig_glUniformSubroutinesuiv))(shadertype,count,indices);}
+FunctionTable::MEMBERPFNGLRECTDVPROC m_orig_glRectdv = nullptr;
+void m_glRectdv_profile(const GLdouble* v1,const GLdouble* v2)const{ProfilingScope const scope(this,2204);(this->*(this->m_orig_glRectdv))(v1,v2);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VNVPROC m_orig_glProgramUniform1i64vNV = nullptr;
+void m_glProgramUniform1i64vNV_profile(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,2205);(this->*(this->m_orig_glProgramUniform1i64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIEXTPROC m_orig_glVertexAttribI4uiEXT = nullptr;
+void m_glVertexAttribI4uiEXT_profile(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w)const{ProfilingScope const scope(this,2206);(this->*(this->m_orig_glVertexAttribI4uiEXT))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBEXTPROC m_orig_glSecondaryColor3ubEXT = nullptr;
+void m_glSecondaryColor3ubEXT_profile(GLubyte red,GLubyte green,GLubyte blue)const{ProfilingScope const scope(this,2207);(this->*(this->m_orig_glSecondaryColor3ubEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC m_orig_glCompressedMultiTexSubImage1DEXT = nullptr;
+void m_glCompressedMultiTexSubImage1DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2208);(this->*(this->m_orig_glCompressedMultiTexSubImage1DEXT))(texunit,target,level,xoffset,width,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLMULTITEXGENDEXTPROC m_orig_glMultiTexGendEXT = nullptr;
+void m_glMultiTexGendEXT_profile(GLenum texunit,GLenum coord,GLenum pname,GLdouble param)const{ProfilingScope const scope(this,2209);(this->*(this->m_orig_glMultiTexGendEXT))(texunit,coord,pname,param);}
+FunctionTable::MEMBERPFNGLCOLORP3UIVPROC m_orig_glColorP3uiv = nullptr;
+void m_glColorP3uiv_profile(GLenum type,const GLuint* color)const{ProfilingScope const scope(this,2210);(this->*(this->m_orig_glColorP3uiv))(type,color);}
+FunctionTable::MEMBERPFNGLFOGCOORDFVPROC m_orig_glFogCoordfv = nullptr;
+void m_glFogCoordfv_profile(const GLfloat* coord)const{ProfilingScope const scope(this,2211);(this->*(this->m_orig_glFogCoordfv))(coord);}
+FunctionTable::MEMBERPFNGLCOMPILESHADERPROC m_orig_glCompileShader = nullptr;
+void m_glCompileShader_profile(GLuint shader)const{ProfilingScope const scope(this,2212);(this->*(this->m_orig_glCompileShader))(shader);}
+FunctionTable::MEMBERPFNGLTEXCOORD2HNVPROC m_orig_glTexCoord2hNV = nullptr;
+void m_glTexCoord2hNV_profile(GLhalfNV s,GLhalfNV t)const{ProfilingScope const scope(this,2213);(this->*(this->m_orig_glTexCoord2hNV))(s,t);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIVEXTPROC m_orig_glUniform1uivEXT = nullptr;
+void m_glUniform1uivEXT_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,2214);(this->*(this->m_orig_glUniform1uivEXT))(location,count,value);}
+FunctionTable::MEMBERPFNGLMATRIXLOADTRANSPOSEDEXTPROC m_orig_glMatrixLoadTransposedEXT = nullptr;
+void m_glMatrixLoadTransposedEXT_profile(GLenum mode,const GLdouble* m)const{ProfilingScope const scope(this,2215);(this->*(this->m_orig_glMatrixLoadTransposedEXT))(mode,m);}
+FunctionTable::MEMBERPFNGLINDEXFVPROC m_orig_glIndexfv = nullptr;
+void m_glIndexfv_profile(const GLfloat* c)const{ProfilingScope const scope(this,2216);(this->*(this->m_orig_glIndexfv))(c);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEPROC m_orig_glGetCompressedTextureImage = nullptr;
+void m_glGetCompressedTextureImage_profile(GLuint texture,GLint level,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,2217);(this->*(this->m_orig_glGetCompressedTextureImage))(texture,level,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLGETUNIFORMUIVEXTPROC m_orig_glGetUniformuivEXT = nullptr;
+void m_glGetUniformuivEXT_profile(GLuint program,GLint location,GLuint* params)const{ProfilingScope const scope(this,2218);(this->*(this->m_orig_glGetUniformuivEXT))(program,location,params);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVARBPROC m_orig_glGetnPixelMapfvARB = nullptr;
+void m_glGetnPixelMapfvARB_profile(GLenum map,GLsizei bufSize,GLfloat* values)const{ProfilingScope const scope(this,2219);(this->*(this->m_orig_glGetnPixelMapfvARB))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREEXTPROC m_orig_glFramebufferTextureEXT = nullptr;
+void m_glFramebufferTextureEXT_profile(GLenum target,GLenum attachment,GLuint texture,GLint level)const{ProfilingScope const scope(this,2220);(this->*(this->m_orig_glFramebufferTextureEXT))(target,attachment,texture,level);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC m_orig_glMultiDrawElementsIndirectCount = nullptr;
+void m_glMultiDrawElementsIndirectCount_profile(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{ProfilingScope const scope(this,2221);(this->*(this->m_orig_glMultiDrawElementsIndirectCount))(mode,type,indirect,drawcount,maxdrawcount,stride);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBIPOINTERPROC m_orig_glVertexAttribIPointer = nullptr;
+void m_glVertexAttribIPointer_profile(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2222);(this->*(this->m_orig_glVertexAttribIPointer))(index,size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP3UIPROC m_orig_glMultiTexCoordP3ui = nullptr;
+void m_glMultiTexCoordP3ui_profile(GLenum texture,GLenum type,GLuint coords)const{ProfilingScope const scope(this,2223);(this->*(this->m_orig_glMultiTexCoordP3ui))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLEVALUATEDEPTHVALUESARBPROC m_orig_glEvaluateDepthValuesARB = nullptr;
+void m_glEvaluateDepthValuesARB_profile()const{ProfilingScope const scope(this,2224);(this->*(this->m_orig_glEvaluateDepthValuesARB))();}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVPROC m_orig_glGetNamedBufferParameteriv = nullptr;
+void m_glGetNamedBufferParameteriv_profile(GLuint buffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2225);(this->*(this->m_orig_glGetNamedBufferParameteriv))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC m_orig_glGetNamedProgramLocalParameterfvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterfvEXT_profile(GLuint program,GLenum target,GLuint index,GLfloat* params)const{ProfilingScope const scope(this,2226);(this->*(this->m_orig_glGetNamedProgramLocalParameterfvEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC m_orig_glColor4fNormal3fVertex3fvSUN = nullptr;
+void m_glColor4fNormal3fVertex3fvSUN_profile(const GLfloat* c,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,2227);(this->*(this->m_orig_glColor4fNormal3fVertex3fvSUN))(c,n,v);}
+FunctionTable::MEMBERPFNGLSEPARABLEFILTER2DEXTPROC m_orig_glSeparableFilter2DEXT = nullptr;
+void m_glSeparableFilter2DEXT_profile(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column)const{ProfilingScope const scope(this,2228);(this->*(this->m_orig_glSeparableFilter2DEXT))(target,internalformat,width,height,format,type,row,column);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERXOESPROC m_orig_glTexParameterxOES = nullptr;
+void m_glTexParameterxOES_profile(GLenum target,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,2229);(this->*(this->m_orig_glTexParameterxOES))(target,pname,param);}
+FunctionTable::MEMBERPFNGLCLEARACCUMXOESPROC m_orig_glClearAccumxOES = nullptr;
+void m_glClearAccumxOES_profile(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha)const{ProfilingScope const scope(this,2230);(this->*(this->m_orig_glClearAccumxOES))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLINVALIDATEFRAMEBUFFERPROC m_orig_glInvalidateFramebuffer = nullptr;
+void m_glInvalidateFramebuffer_profile(GLenum target,GLsizei numAttachments,const GLenum* attachments)const{ProfilingScope const scope(this,2231);(this->*(this->m_orig_glInvalidateFramebuffer))(target,numAttachments,attachments);}
+FunctionTable::MEMBERPFNGLWEIGHTUBVARBPROC m_orig_glWeightubvARB = nullptr;
+void m_glWeightubvARB_profile(GLint size,const GLubyte* weights)const{ProfilingScope const scope(this,2232);(this->*(this->m_orig_glWeightubvARB))(size,weights);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DPROC m_orig_glVertexAttrib1d = nullptr;
+void m_glVertexAttrib1d_profile(GLuint index,GLdouble x)const{ProfilingScope const scope(this,2233);(this->*(this->m_orig_glVertexAttrib1d))(index,x);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FPROC m_orig_glVertexAttrib1f = nullptr;
+void m_glVertexAttrib1f_profile(GLuint index,GLfloat x)const{ProfilingScope const scope(this,2234);(this->*(this->m_orig_glVertexAttrib1f))(index,x);}
+FunctionTable::MEMBERPFNGLVERTEX4FVPROC m_orig_glVertex4fv = nullptr;
+void m_glVertex4fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,2235);(this->*(this->m_orig_glVertex4fv))(v);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFIPROC m_orig_glClearNamedFramebufferfi = nullptr;
+void m_glClearNamedFramebufferfi_profile(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{ProfilingScope const scope(this,2236);(this->*(this->m_orig_glClearNamedFramebufferfi))(framebuffer,buffer,drawbuffer,depth,stencil);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUIVPROC m_orig_glGetQueryBufferObjectuiv = nullptr;
+void m_glGetQueryBufferObjectuiv_profile(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{ProfilingScope const scope(this,2237);(this->*(this->m_orig_glGetQueryBufferObjectuiv))(id,buffer,pname,offset);}
+FunctionTable::MEMBERPFNGLCLEARNAMEDFRAMEBUFFERFVPROC m_orig_glClearNamedFramebufferfv = nullptr;
+void m_glClearNamedFramebufferfv_profile(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value)const{ProfilingScope const scope(this,2238);(this->*(this->m_orig_glClearNamedFramebufferfv))(framebuffer,buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLENDVERTEXSHADEREXTPROC m_orig_glEndVertexShaderEXT = nullptr;
+void m_glEndVertexShaderEXT_profile()const{ProfilingScope const scope(this,2239);(this->*(this->m_orig_glEndVertexShaderEXT))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SPROC m_orig_glVertexAttrib1s = nullptr;
+void m_glVertexAttrib1s_profile(GLuint index,GLshort x)const{ProfilingScope const scope(this,2240);(this->*(this->m_orig_glVertexAttrib1s))(index,x);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVARBPROC m_orig_glMultiTexCoord4dvARB = nullptr;
+void m_glMultiTexCoord4dvARB_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,2241);(this->*(this->m_orig_glMultiTexCoord4dvARB))(target,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVPROC m_orig_glMultiTexCoord1sv = nullptr;
+void m_glMultiTexCoord1sv_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,2242);(this->*(this->m_orig_glMultiTexCoord1sv))(target,v);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VNVPROC m_orig_glUniform1ui64vNV = nullptr;
+void m_glUniform1ui64vNV_profile(GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,2243);(this->*(this->m_orig_glUniform1ui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEFOESPROC m_orig_glGetClipPlanefOES = nullptr;
+void m_glGetClipPlanefOES_profile(GLenum plane,GLfloat* equation)const{ProfilingScope const scope(this,2244);(this->*(this->m_orig_glGetClipPlanefOES))(plane,equation);}
+FunctionTable::MEMBERPFNGLRASTERPOS2SPROC m_orig_glRasterPos2s = nullptr;
+void m_glRasterPos2s_profile(GLshort x,GLshort y)const{ProfilingScope const scope(this,2245);(this->*(this->m_orig_glRasterPos2s))(x,y);}
+FunctionTable::MEMBERPFNGLWEIGHTIVARBPROC m_orig_glWeightivARB = nullptr;
+void m_glWeightivARB_profile(GLint size,const GLint* weights)const{ProfilingScope const scope(this,2246);(this->*(this->m_orig_glWeightivARB))(size,weights);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HVNVPROC m_orig_glMultiTexCoord4hvNV = nullptr;
+void m_glMultiTexCoord4hvNV_profile(GLenum target,const GLhalfNV* v)const{ProfilingScope const scope(this,2247);(this->*(this->m_orig_glMultiTexCoord4hvNV))(target,v);}
+FunctionTable::MEMBERPFNGLNORMAL3HNVPROC m_orig_glNormal3hNV = nullptr;
+void m_glNormal3hNV_profile(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz)const{ProfilingScope const scope(this,2248);(this->*(this->m_orig_glNormal3hNV))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLGETSEPARABLEFILTERPROC m_orig_glGetSeparableFilter = nullptr;
+void m_glGetSeparableFilter_profile(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span)const{ProfilingScope const scope(this,2249);(this->*(this->m_orig_glGetSeparableFilter))(target,format,type,row,column,span);}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENIVNVPROC m_orig_glGetPathTexGenivNV = nullptr;
+void m_glGetPathTexGenivNV_profile(GLenum texCoordSet,GLenum pname,GLint* value)const{ProfilingScope const scope(this,2250);(this->*(this->m_orig_glGetPathTexGenivNV))(texCoordSet,pname,value);}
+FunctionTable::MEMBERPFNGLCOLOR4BVPROC m_orig_glColor4bv = nullptr;
+void m_glColor4bv_profile(const GLbyte* v)const{ProfilingScope const scope(this,2251);(this->*(this->m_orig_glColor4bv))(v);}
+FunctionTable::MEMBERPFNGLRASTERPOS2FPROC m_orig_glRasterPos2f = nullptr;
+void m_glRasterPos2f_profile(GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2252);(this->*(this->m_orig_glRasterPos2f))(x,y);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTARBPROC m_orig_glNamedBufferPageCommitmentARB = nullptr;
+void m_glNamedBufferPageCommitmentARB_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{ProfilingScope const scope(this,2253);(this->*(this->m_orig_glNamedBufferPageCommitmentARB))(buffer,offset,size,commit);}
+FunctionTable::MEMBERPFNGLLOADIDENTITYPROC m_orig_glLoadIdentity = nullptr;
+void m_glLoadIdentity_profile()const{ProfilingScope const scope(this,2254);(this->*(this->m_orig_glLoadIdentity))();}
+FunctionTable::MEMBERPFNGLRASTERPOS2IPROC m_orig_glRasterPos2i = nullptr;
+void m_glRasterPos2i_profile(GLint x,GLint y)const{ProfilingScope const scope(this,2255);(this->*(this->m_orig_glRasterPos2i))(x,y);}
+FunctionTable::MEMBERPFNGLRASTERPOS4IVPROC m_orig_glRasterPos4iv = nullptr;
+void m_glRasterPos4iv_profile(const GLint* v)const{ProfilingScope const scope(this,2256);(this->*(this->m_orig_glRasterPos4iv))(v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVARBPROC m_orig_glMultiTexCoord2fvARB = nullptr;
+void m_glMultiTexCoord2fvARB_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,2257);(this->*(this->m_orig_glMultiTexCoord2fvARB))(target,v);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X3FVPROC m_orig_glUniformMatrix4x3fv = nullptr;
+void m_glUniformMatrix4x3fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2258);(this->*(this->m_orig_glUniformMatrix4x3fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFVPROC m_orig_glClearBufferfv = nullptr;
+void m_glClearBufferfv_profile(GLenum buffer,GLint drawbuffer,const GLfloat* value)const{ProfilingScope const scope(this,2259);(this->*(this->m_orig_glClearBufferfv))(buffer,drawbuffer,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4HNVPROC m_orig_glMultiTexCoord4hNV = nullptr;
+void m_glMultiTexCoord4hNV_profile(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q)const{ProfilingScope const scope(this,2260);(this->*(this->m_orig_glMultiTexCoord4hNV))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLTEXTUREBARRIERPROC m_orig_glTextureBarrier = nullptr;
+void m_glTextureBarrier_profile()const{ProfilingScope const scope(this,2261);(this->*(this->m_orig_glTextureBarrier))();}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVSUNPROC m_orig_glReplacementCodeuivSUN = nullptr;
+void m_glReplacementCodeuivSUN_profile(const GLuint* code)const{ProfilingScope const scope(this,2262);(this->*(this->m_orig_glReplacementCodeuivSUN))(code);}
+FunctionTable::MEMBERPFNGLDELETEASYNCMARKERSSGIXPROC m_orig_glDeleteAsyncMarkersSGIX = nullptr;
+void m_glDeleteAsyncMarkersSGIX_profile(GLuint marker,GLsizei range)const{ProfilingScope const scope(this,2263);(this->*(this->m_orig_glDeleteAsyncMarkersSGIX))(marker,range);}
+FunctionTable::MEMBERPFNGLTEXCOORD2BVOESPROC m_orig_glTexCoord2bvOES = nullptr;
+void m_glTexCoord2bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,2264);(this->*(this->m_orig_glTexCoord2bvOES))(coords);}
+FunctionTable::MEMBERPFNGLEVALCOORD2XOESPROC m_orig_glEvalCoord2xOES = nullptr;
+void m_glEvalCoord2xOES_profile(GLfixed u,GLfixed v)const{ProfilingScope const scope(this,2265);(this->*(this->m_orig_glEvalCoord2xOES))(u,v);}
+FunctionTable::MEMBERPFNGLGETSHARPENTEXFUNCSGISPROC m_orig_glGetSharpenTexFuncSGIS = nullptr;
+void m_glGetSharpenTexFuncSGIS_profile(GLenum target,GLfloat* points)const{ProfilingScope const scope(this,2266);(this->*(this->m_orig_glGetSharpenTexFuncSGIS))(target,points);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC m_orig_glProgramUniformHandleui64vNV = nullptr;
+void m_glProgramUniformHandleui64vNV_profile(GLuint program,GLint location,GLsizei count,const GLuint64* values)const{ProfilingScope const scope(this,2267);(this->*(this->m_orig_glProgramUniformHandleui64vNV))(program,location,count,values);}
+FunctionTable::MEMBERPFNGLIGLOOINTERFACESGIXPROC m_orig_glIglooInterfaceSGIX = nullptr;
+void m_glIglooInterfaceSGIX_profile(GLenum pname,const void* params)const{ProfilingScope const scope(this,2268);(this->*(this->m_orig_glIglooInterfaceSGIX))(pname,params);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVARBPROC m_orig_glWindowPos2dvARB = nullptr;
+void m_glWindowPos2dvARB_profile(const GLdouble* v)const{ProfilingScope const scope(this,2269);(this->*(this->m_orig_glWindowPos2dvARB))(v);}
+FunctionTable::MEMBERPFNGLCLEARBUFFERFIPROC m_orig_glClearBufferfi = nullptr;
+void m_glClearBufferfi_profile(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil)const{ProfilingScope const scope(this,2270);(this->*(this->m_orig_glClearBufferfi))(buffer,drawbuffer,depth,stencil);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINDIRECTPROC m_orig_glDrawArraysIndirect = nullptr;
+void m_glDrawArraysIndirect_profile(GLenum mode,const void* indirect)const{ProfilingScope const scope(this,2271);(this->*(this->m_orig_glDrawArraysIndirect))(mode,indirect);}
+FunctionTable::MEMBERPFNGLGENVERTEXARRAYSPROC m_orig_glGenVertexArrays = nullptr;
+void m_glGenVertexArrays_profile(GLsizei n,GLuint* arrays)const{ProfilingScope const scope(this,2272);(this->*(this->m_orig_glGenVertexArrays))(n,arrays);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKI64_VPROC m_orig_glGetTransformFeedbacki64_v = nullptr;
+void m_glGetTransformFeedbacki64_v_profile(GLuint xfb,GLenum pname,GLuint index,GLint64* param)const{ProfilingScope const scope(this,2273);(this->*(this->m_orig_glGetTransformFeedbacki64_v))(xfb,pname,index,param);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXARRAYATTRIBPROC m_orig_glEnableVertexArrayAttrib = nullptr;
+void m_glEnableVertexArrayAttrib_profile(GLuint vaobj,GLuint index)const{ProfilingScope const scope(this,2274);(this->*(this->m_orig_glEnableVertexArrayAttrib))(vaobj,index);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2DVPROC m_orig_glProgramUniformMatrix3x2dv = nullptr;
+void m_glProgramUniformMatrix3x2dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2275);(this->*(this->m_orig_glProgramUniformMatrix3x2dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4FATIPROC m_orig_glVertexStream4fATI = nullptr;
+void m_glVertexStream4fATI_profile(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,2276);(this->*(this->m_orig_glVertexStream4fATI))(stream,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXBINDINGDIVISORPROC m_orig_glVertexBindingDivisor = nullptr;
+void m_glVertexBindingDivisor_profile(GLuint bindingindex,GLuint divisor)const{ProfilingScope const scope(this,2277);(this->*(this->m_orig_glVertexBindingDivisor))(bindingindex,divisor);}
+FunctionTable::MEMBERPFNGLGETSAMPLERPARAMETERIIVPROC m_orig_glGetSamplerParameterIiv = nullptr;
+void m_glGetSamplerParameterIiv_profile(GLuint sampler,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2278);(this->*(this->m_orig_glGetSamplerParameterIiv))(sampler,pname,params);}
+FunctionTable::MEMBERPFNGLGETCOVERAGEMODULATIONTABLENVPROC m_orig_glGetCoverageModulationTableNV = nullptr;
+void m_glGetCoverageModulationTableNV_profile(GLsizei bufsize,GLfloat* v)const{ProfilingScope const scope(this,2279);(this->*(this->m_orig_glGetCoverageModulationTableNV))(bufsize,v);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEDNVPROC m_orig_glDepthRangedNV = nullptr;
+void m_glDepthRangedNV_profile(GLdouble zNear,GLdouble zFar)const{ProfilingScope const scope(this,2280);(this->*(this->m_orig_glDepthRangedNV))(zNear,zFar);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FPROC m_orig_glVertexAttrib3f = nullptr;
+void m_glVertexAttrib3f_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2281);(this->*(this->m_orig_glVertexAttrib3f))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC m_orig_glMultiDrawRangeElementArrayAPPLE = nullptr;
+void m_glMultiDrawRangeElementArrayAPPLE_profile(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount)const{ProfilingScope const scope(this,2282);(this->*(this->m_orig_glMultiDrawRangeElementArrayAPPLE))(mode,start,end,first,count,primcount);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBFORMATNVPROC m_orig_glVertexAttribFormatNV = nullptr;
+void m_glVertexAttribFormatNV_profile(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride)const{ProfilingScope const scope(this,2283);(this->*(this->m_orig_glVertexAttribFormatNV))(index,size,type,normalized,stride);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTI64VPROC m_orig_glGetQueryBufferObjecti64v = nullptr;
+void m_glGetQueryBufferObjecti64v_profile(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{ProfilingScope const scope(this,2284);(this->*(this->m_orig_glGetQueryBufferObjecti64v))(id,buffer,pname,offset);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBDVPROC m_orig_glGetVertexAttribdv = nullptr;
+void m_glGetVertexAttribdv_profile(GLuint index,GLenum pname,GLdouble* params)const{ProfilingScope const scope(this,2285);(this->*(this->m_orig_glGetVertexAttribdv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLGETUNIFORMI64VARBPROC m_orig_glGetUniformi64vARB = nullptr;
+void m_glGetUniformi64vARB_profile(GLuint program,GLint location,GLint64* params)const{ProfilingScope const scope(this,2286);(this->*(this->m_orig_glGetUniformi64vARB))(program,location,params);}
+FunctionTable::MEMBERPFNGLARETEXTURESRESIDENTEXTPROC m_orig_glAreTexturesResidentEXT = nullptr;
+GLboolean m_glAreTexturesResidentEXT_profile(GLsizei n,const GLuint* textures,GLboolean* residences)const{ProfilingScope const scope(this,2287);return (this->*(this->m_orig_glAreTexturesResidentEXT))(n,textures,residences);}
+FunctionTable::MEMBERPFNGLGETHANDLEARBPROC m_orig_glGetHandleARB = nullptr;
+GLhandleARB m_glGetHandleARB_profile(GLenum pname)const{ProfilingScope const scope(this,2288);return (this->*(this->m_orig_glGetHandleARB))(pname);}
+FunctionTable::MEMBERPFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC m_orig_glVideoCaptureStreamParameterdvNV = nullptr;
+void m_glVideoCaptureStreamParameterdvNV_profile(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params)const{ProfilingScope const scope(this,2289);(this->*(this->m_orig_glVideoCaptureStreamParameterdvNV))(video_capture_slot,stream,pname,params);}
+FunctionTable::MEMBERPFNGLMAPPARAMETERIVNVPROC m_orig_glMapParameterivNV = nullptr;
+void m_glMapParameterivNV_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2290);(this->*(this->m_orig_glMapParameterivNV))(target,pname,params);}
+FunctionTable::MEMBERPFNGLISVERTEXARRAYPROC m_orig_glIsVertexArray = nullptr;
+GLboolean m_glIsVertexArray_profile(GLuint array)const{ProfilingScope const scope(this,2291);return (this->*(this->m_orig_glIsVertexArray))(array);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SEXTPROC m_orig_glSecondaryColor3sEXT = nullptr;
+void m_glSecondaryColor3sEXT_profile(GLshort red,GLshort green,GLshort blue)const{ProfilingScope const scope(this,2292);(this->*(this->m_orig_glSecondaryColor3sEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVEXTPROC m_orig_glGetTexParameterIivEXT = nullptr;
+void m_glGetTexParameterIivEXT_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2293);(this->*(this->m_orig_glGetTexParameterIivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLFRAMETERMINATORGREMEDYPROC m_orig_glFrameTerminatorGREMEDY = nullptr;
+void m_glFrameTerminatorGREMEDY_profile()const{ProfilingScope const scope(this,2294);(this->*(this->m_orig_glFrameTerminatorGREMEDY))();}
+FunctionTable::MEMBERPFNGLBLENDBARRIERKHRPROC m_orig_glBlendBarrierKHR = nullptr;
+void m_glBlendBarrierKHR_profile()const{ProfilingScope const scope(this,2295);(this->*(this->m_orig_glBlendBarrierKHR))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NUBARBPROC m_orig_glVertexAttrib4NubARB = nullptr;
+void m_glVertexAttrib4NubARB_profile(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w)const{ProfilingScope const scope(this,2296);(this->*(this->m_orig_glVertexAttrib4NubARB))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTNVPROC m_orig_glPrimitiveRestartNV = nullptr;
+void m_glPrimitiveRestartNV_profile()const{ProfilingScope const scope(this,2297);(this->*(this->m_orig_glPrimitiveRestartNV))();}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL1UI64VARBPROC m_orig_glVertexAttribL1ui64vARB = nullptr;
+void m_glVertexAttribL1ui64vARB_profile(GLuint index,const GLuint64EXT* v)const{ProfilingScope const scope(this,2298);(this->*(this->m_orig_glVertexAttribL1ui64vARB))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4IVEXTPROC m_orig_glVertexAttribI4ivEXT = nullptr;
+void m_glVertexAttribI4ivEXT_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2299);(this->*(this->m_orig_glVertexAttribI4ivEXT))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS4SVNVPROC m_orig_glVertexAttribs4svNV = nullptr;
+void m_glVertexAttribs4svNV_profile(GLuint index,GLsizei count,const GLshort* v)const{ProfilingScope const scope(this,2300);(this->*(this->m_orig_glVertexAttribs4svNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLUNIFORM1UIPROC m_orig_glUniform1ui = nullptr;
+void m_glUniform1ui_profile(GLint location,GLuint v0)const{ProfilingScope const scope(this,2301);(this->*(this->m_orig_glUniform1ui))(location,v0);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FVARBPROC m_orig_glVertexAttrib2fvARB = nullptr;
+void m_glVertexAttrib2fvARB_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,2302);(this->*(this->m_orig_glVertexAttrib2fvARB))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4SVEXTPROC m_orig_glVertexAttribI4svEXT = nullptr;
+void m_glVertexAttribI4svEXT_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2303);(this->*(this->m_orig_glVertexAttribI4svEXT))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC m_orig_glTextureImage3DMultisampleCoverageNV = nullptr;
+void m_glTextureImage3DMultisampleCoverageNV_profile(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,2304);(this->*(this->m_orig_glTextureImage3DMultisampleCoverageNV))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIERPROC m_orig_glMemoryBarrier = nullptr;
+void m_glMemoryBarrier_profile(GLbitfield barriers)const{ProfilingScope const scope(this,2305);(this->*(this->m_orig_glMemoryBarrier))(barriers);}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTFVATIPROC m_orig_glGetVariantArrayObjectfvATI = nullptr;
+void m_glGetVariantArrayObjectfvATI_profile(GLuint id,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2306);(this->*(this->m_orig_glGetVariantArrayObjectfvATI))(id,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN = nullptr;
+void m_glTexCoord4fColor4fNormal3fVertex4fvSUN_profile(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v)const{ProfilingScope const scope(this,2307);(this->*(this->m_orig_glTexCoord4fColor4fNormal3fVertex4fvSUN))(tc,c,n,v);}
+FunctionTable::MEMBERPFNGLISPROGRAMARBPROC m_orig_glIsProgramARB = nullptr;
+GLboolean m_glIsProgramARB_profile(GLuint program)const{ProfilingScope const scope(this,2308);return (this->*(this->m_orig_glIsProgramARB))(program);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTUREEXTPROC m_orig_glBindImageTextureEXT = nullptr;
+void m_glBindImageTextureEXT_profile(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format)const{ProfilingScope const scope(this,2309);(this->*(this->m_orig_glBindImageTextureEXT))(index,texture,level,layered,layer,access,format);}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONPROC m_orig_glGetFragDataLocation = nullptr;
+GLint m_glGetFragDataLocation_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,2310);return (this->*(this->m_orig_glGetFragDataLocation))(program,name);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1SVARBPROC m_orig_glMultiTexCoord1svARB = nullptr;
+void m_glMultiTexCoord1svARB_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,2311);(this->*(this->m_orig_glMultiTexCoord1svARB))(target,v);}
+FunctionTable::MEMBERPFNGLGETMAPXVOESPROC m_orig_glGetMapxvOES = nullptr;
+void m_glGetMapxvOES_profile(GLenum target,GLenum query,GLfixed* v)const{ProfilingScope const scope(this,2312);(this->*(this->m_orig_glGetMapxvOES))(target,query,v);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC m_orig_glTextureStorage2DMultisampleEXT = nullptr;
+void m_glTextureStorage2DMultisampleEXT_profile(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2313);(this->*(this->m_orig_glTextureStorage2DMultisampleEXT))(texture,target,samples,internalformat,width,height,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLGETMATERIALFVPROC m_orig_glGetMaterialfv = nullptr;
+void m_glGetMaterialfv_profile(GLenum face,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2314);(this->*(this->m_orig_glGetMaterialfv))(face,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NBVARBPROC m_orig_glVertexAttrib4NbvARB = nullptr;
+void m_glVertexAttrib4NbvARB_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,2315);(this->*(this->m_orig_glVertexAttrib4NbvARB))(index,v);}
+FunctionTable::MEMBERPFNGLPIXELMAPUIVPROC m_orig_glPixelMapuiv = nullptr;
+void m_glPixelMapuiv_profile(GLenum map,GLsizei mapsize,const GLuint* values)const{ProfilingScope const scope(this,2316);(this->*(this->m_orig_glPixelMapuiv))(map,mapsize,values);}
+FunctionTable::MEMBERPFNGLCOLORPOINTEREXTPROC m_orig_glColorPointerEXT = nullptr;
+void m_glColorPointerEXT_profile(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer)const{ProfilingScope const scope(this,2317);(this->*(this->m_orig_glColorPointerEXT))(size,type,stride,count,pointer);}
+FunctionTable::MEMBERPFNGLENABLECLIENTSTATEIEXTPROC m_orig_glEnableClientStateiEXT = nullptr;
+void m_glEnableClientStateiEXT_profile(GLenum array,GLuint index)const{ProfilingScope const scope(this,2318);(this->*(this->m_orig_glEnableClientStateiEXT))(array,index);}
+FunctionTable::MEMBERPFNGLCLEARTEXSUBIMAGEPROC m_orig_glClearTexSubImage = nullptr;
+void m_glClearTexSubImage_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data)const{ProfilingScope const scope(this,2319);(this->*(this->m_orig_glClearTexSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);}
+FunctionTable::MEMBERPFNGLEVALCOORD1XVOESPROC m_orig_glEvalCoord1xvOES = nullptr;
+void m_glEvalCoord1xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,2320);(this->*(this->m_orig_glEvalCoord1xvOES))(coords);}
+FunctionTable::MEMBERPFNGLDETACHOBJECTARBPROC m_orig_glDetachObjectARB = nullptr;
+void m_glDetachObjectARB_profile(GLhandleARB containerObj,GLhandleARB attachedObj)const{ProfilingScope const scope(this,2321);(this->*(this->m_orig_glDetachObjectARB))(containerObj,attachedObj);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVPROC m_orig_glGetTextureParameterIiv = nullptr;
+void m_glGetTextureParameterIiv_profile(GLuint texture,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2322);(this->*(this->m_orig_glGetTextureParameterIiv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLVARIANTUSVEXTPROC m_orig_glVariantusvEXT = nullptr;
+void m_glVariantusvEXT_profile(GLuint id,const GLushort* addr)const{ProfilingScope const scope(this,2323);(this->*(this->m_orig_glVariantusvEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC m_orig_glCompressedTextureImage3DEXT = nullptr;
+void m_glCompressedTextureImage3DEXT_profile(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2324);(this->*(this->m_orig_glCompressedTextureImage3DEXT))(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1DARBPROC m_orig_glMultiTexCoord1dARB = nullptr;
+void m_glMultiTexCoord1dARB_profile(GLenum target,GLdouble s)const{ProfilingScope const scope(this,2325);(this->*(this->m_orig_glMultiTexCoord1dARB))(target,s);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINTEGERI_VEXTPROC m_orig_glGetVertexArrayIntegeri_vEXT = nullptr;
+void m_glGetVertexArrayIntegeri_vEXT_profile(GLuint vaobj,GLuint index,GLenum pname,GLint* param)const{ProfilingScope const scope(this,2326);(this->*(this->m_orig_glGetVertexArrayIntegeri_vEXT))(vaobj,index,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UBVPROC m_orig_glVertexAttribI4ubv = nullptr;
+void m_glVertexAttribI4ubv_profile(GLuint index,const GLubyte* v)const{ProfilingScope const scope(this,2327);(this->*(this->m_orig_glVertexAttribI4ubv))(index,v);}
+FunctionTable::MEMBERPFNGLPIXELTEXGENPARAMETERFSGISPROC m_orig_glPixelTexGenParameterfSGIS = nullptr;
+void m_glPixelTexGenParameterfSGIS_profile(GLenum pname,GLfloat param)const{ProfilingScope const scope(this,2328);(this->*(this->m_orig_glPixelTexGenParameterfSGIS))(pname,param);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2DVPROC m_orig_glProgramUniformMatrix4x2dv = nullptr;
+void m_glProgramUniformMatrix4x2dv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2329);(this->*(this->m_orig_glProgramUniformMatrix4x2dv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLUNIFORM3FARBPROC m_orig_glUniform3fARB = nullptr;
+void m_glUniform3fARB_profile(GLint location,GLfloat v0,GLfloat v1,GLfloat v2)const{ProfilingScope const scope(this,2330);(this->*(this->m_orig_glUniform3fARB))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLISSHADERPROC m_orig_glIsShader = nullptr;
+GLboolean m_glIsShader_profile(GLuint shader)const{ProfilingScope const scope(this,2331);return (this->*(this->m_orig_glIsShader))(shader);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERIVPROC m_orig_glConvolutionParameteriv = nullptr;
+void m_glConvolutionParameteriv_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2332);(this->*(this->m_orig_glConvolutionParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC m_orig_glCopyMultiTexSubImage2DEXT = nullptr;
+void m_glCopyMultiTexSubImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2333);(this->*(this->m_orig_glCopyMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYARBPROC m_orig_glEnableVertexAttribArrayARB = nullptr;
+void m_glEnableVertexAttribArrayARB_profile(GLuint index)const{ProfilingScope const scope(this,2334);(this->*(this->m_orig_glEnableVertexAttribArrayARB))(index);}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYBUFFERSUBDATANVPROC m_orig_glMulticastCopyBufferSubDataNV = nullptr;
+void m_glMulticastCopyBufferSubDataNV_profile(GLuint readGpu,GLbitfield writeGpuMask,GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{ProfilingScope const scope(this,2335);(this->*(this->m_orig_glMulticastCopyBufferSubDataNV))(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);}
+FunctionTable::MEMBERPFNGLENABLEPROC m_orig_glEnable = nullptr;
+void m_glEnable_profile(GLenum cap)const{ProfilingScope const scope(this,2336);(this->*(this->m_orig_glEnable))(cap);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMSIVPROC m_orig_glGetActiveUniformsiv = nullptr;
+void m_glGetActiveUniformsiv_profile(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2337);(this->*(this->m_orig_glGetActiveUniformsiv))(program,uniformCount,uniformIndices,pname,params);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVARBPROC m_orig_glGetVertexAttribivARB = nullptr;
+void m_glGetVertexAttribivARB_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2338);(this->*(this->m_orig_glGetVertexAttribivARB))(index,pname,params);}
+FunctionTable::MEMBERPFNGLTEXCOORD4HVNVPROC m_orig_glTexCoord4hvNV = nullptr;
+void m_glTexCoord4hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,2339);(this->*(this->m_orig_glTexCoord4hvNV))(v);}
+FunctionTable::MEMBERPFNGLUSEPROGRAMOBJECTARBPROC m_orig_glUseProgramObjectARB = nullptr;
+void m_glUseProgramObjectARB_profile(GLhandleARB programObj)const{ProfilingScope const scope(this,2340);(this->*(this->m_orig_glUseProgramObjectARB))(programObj);}
+FunctionTable::MEMBERPFNGLGETATTRIBLOCATIONPROC m_orig_glGetAttribLocation = nullptr;
+GLint m_glGetAttribLocation_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,2341);return (this->*(this->m_orig_glGetAttribLocation))(program,name);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVPROC m_orig_glVertexAttrib4dv = nullptr;
+void m_glVertexAttrib4dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2342);(this->*(this->m_orig_glVertexAttrib4dv))(index,v);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIVPROC m_orig_glGetTextureParameteriv = nullptr;
+void m_glGetTextureParameteriv_profile(GLuint texture,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2343);(this->*(this->m_orig_glGetTextureParameteriv))(texture,pname,params);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEMEMEXTPROC m_orig_glNamedBufferStorageMemEXT = nullptr;
+void m_glNamedBufferStorageMemEXT_profile(GLuint buffer,GLsizeiptr size,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2344);(this->*(this->m_orig_glNamedBufferStorageMemEXT))(buffer,size,memory,offset);}
+FunctionTable::MEMBERPFNGLPATHSUBCOORDSNVPROC m_orig_glPathSubCoordsNV = nullptr;
+void m_glPathSubCoordsNV_profile(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords)const{ProfilingScope const scope(this,2345);(this->*(this->m_orig_glPathSubCoordsNV))(path,coordStart,numCoords,coordType,coords);}
+FunctionTable::MEMBERPFNGLMATRIXINDEXUSVARBPROC m_orig_glMatrixIndexusvARB = nullptr;
+void m_glMatrixIndexusvARB_profile(GLint size,const GLushort* indices)const{ProfilingScope const scope(this,2346);(this->*(this->m_orig_glMatrixIndexusvARB))(size,indices);}
+FunctionTable::MEMBERPFNGLGETVIDEOUIVNVPROC m_orig_glGetVideouivNV = nullptr;
+void m_glGetVideouivNV_profile(GLuint video_slot,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,2347);(this->*(this->m_orig_glGetVideouivNV))(video_slot,pname,params);}
+FunctionTable::MEMBERPFNGLGETVIDEOCAPTUREIVNVPROC m_orig_glGetVideoCaptureivNV = nullptr;
+void m_glGetVideoCaptureivNV_profile(GLuint video_capture_slot,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2348);(this->*(this->m_orig_glGetVideoCaptureivNV))(video_capture_slot,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3UIPROC m_orig_glProgramUniform3ui = nullptr;
+void m_glProgramUniform3ui_profile(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2)const{ProfilingScope const scope(this,2349);(this->*(this->m_orig_glProgramUniform3ui))(program,location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVARBPROC m_orig_glVertexAttrib3svARB = nullptr;
+void m_glVertexAttrib3svARB_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2350);(this->*(this->m_orig_glVertexAttrib3svARB))(index,v);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedBufferParameterivEXT = nullptr;
+void m_glGetNamedBufferParameterivEXT_profile(GLuint buffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2351);(this->*(this->m_orig_glGetNamedBufferParameterivEXT))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLMATRIXSCALEDEXTPROC m_orig_glMatrixScaledEXT = nullptr;
+void m_glMatrixScaledEXT_profile(GLenum mode,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,2352);(this->*(this->m_orig_glMatrixScaledEXT))(mode,x,y,z);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X3FVPROC m_orig_glProgramUniformMatrix2x3fv = nullptr;
+void m_glProgramUniformMatrix2x3fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2353);(this->*(this->m_orig_glProgramUniformMatrix2x3fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETFRAGMENTLIGHTIVSGIXPROC m_orig_glGetFragmentLightivSGIX = nullptr;
+void m_glGetFragmentLightivSGIX_profile(GLenum light,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2354);(this->*(this->m_orig_glGetFragmentLightivSGIX))(light,pname,params);}
+FunctionTable::MEMBERPFNGLGETSTRINGIPROC m_orig_glGetStringi = nullptr;
+const GLubyte* m_glGetStringi_profile(GLenum name,GLuint index)const{ProfilingScope const scope(this,2355);return (this->*(this->m_orig_glGetStringi))(name,index);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVARBPROC m_orig_glWindowPos2svARB = nullptr;
+void m_glWindowPos2svARB_profile(const GLshort* v)const{ProfilingScope const scope(this,2356);(this->*(this->m_orig_glWindowPos2svARB))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SVNVPROC m_orig_glVertexAttrib2svNV = nullptr;
+void m_glVertexAttrib2svNV_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2357);(this->*(this->m_orig_glVertexAttrib2svNV))(index,v);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IVARBPROC m_orig_glWindowPos2ivARB = nullptr;
+void m_glWindowPos2ivARB_profile(const GLint* v)const{ProfilingScope const scope(this,2358);(this->*(this->m_orig_glWindowPos2ivARB))(v);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVNVPROC m_orig_glGetVertexAttribPointervNV = nullptr;
+void m_glGetVertexAttribPointervNV_profile(GLuint index,GLenum pname,void** pointer)const{ProfilingScope const scope(this,2359);(this->*(this->m_orig_glGetVertexAttribPointervNV))(index,pname,pointer);}
+FunctionTable::MEMBERPFNGLPUSHMATRIXPROC m_orig_glPushMatrix = nullptr;
+void m_glPushMatrix_profile()const{ProfilingScope const scope(this,2360);(this->*(this->m_orig_glPushMatrix))();}
+FunctionTable::MEMBERPFNGLEDGEFLAGPOINTERLISTIBMPROC m_orig_glEdgeFlagPointerListIBM = nullptr;
+void m_glEdgeFlagPointerListIBM_profile(GLint stride,const GLboolean** pointer,GLint ptrstride)const{ProfilingScope const scope(this,2361);(this->*(this->m_orig_glEdgeFlagPointerListIBM))(stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLGENERATEMIPMAPEXTPROC m_orig_glGenerateMipmapEXT = nullptr;
+void m_glGenerateMipmapEXT_profile(GLenum target)const{ProfilingScope const scope(this,2362);(this->*(this->m_orig_glGenerateMipmapEXT))(target);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3SVPROC m_orig_glWindowPos3sv = nullptr;
+void m_glWindowPos3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,2363);(this->*(this->m_orig_glWindowPos3sv))(v);}
+FunctionTable::MEMBERPFNGLPATHCOORDSNVPROC m_orig_glPathCoordsNV = nullptr;
+void m_glPathCoordsNV_profile(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords)const{ProfilingScope const scope(this,2364);(this->*(this->m_orig_glPathCoordsNV))(path,numCoords,coordType,coords);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1IPROC m_orig_glProgramUniform1i = nullptr;
+void m_glProgramUniform1i_profile(GLuint program,GLint location,GLint v0)const{ProfilingScope const scope(this,2365);(this->*(this->m_orig_glProgramUniform1i))(program,location,v0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1DPROC m_orig_glProgramUniform1d = nullptr;
+void m_glProgramUniform1d_profile(GLuint program,GLint location,GLdouble v0)const{ProfilingScope const scope(this,2366);(this->*(this->m_orig_glProgramUniform1d))(program,location,v0);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FPROC m_orig_glProgramUniform1f = nullptr;
+void m_glProgramUniform1f_profile(GLuint program,GLint location,GLfloat v0)const{ProfilingScope const scope(this,2367);(this->*(this->m_orig_glProgramUniform1f))(program,location,v0);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERIEXTPROC m_orig_glProgramParameteriEXT = nullptr;
+void m_glProgramParameteriEXT_profile(GLuint program,GLenum pname,GLint value)const{ProfilingScope const scope(this,2368);(this->*(this->m_orig_glProgramParameteriEXT))(program,pname,value);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC m_orig_glCompressedMultiTexImage2DEXT = nullptr;
+void m_glCompressedMultiTexImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2369);(this->*(this->m_orig_glCompressedMultiTexImage2DEXT))(texunit,target,level,internalformat,width,height,border,imageSize,bits);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3IVPROC m_orig_glProgramUniform3iv = nullptr;
+void m_glProgramUniform3iv_profile(GLuint program,GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2370);(this->*(this->m_orig_glProgramUniform3iv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLINDEXIVPROC m_orig_glIndexiv = nullptr;
+void m_glIndexiv_profile(const GLint* c)const{ProfilingScope const scope(this,2371);(this->*(this->m_orig_glIndexiv))(c);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4XVOESPROC m_orig_glMultiTexCoord4xvOES = nullptr;
+void m_glMultiTexCoord4xvOES_profile(GLenum texture,const GLfixed* coords)const{ProfilingScope const scope(this,2372);(this->*(this->m_orig_glMultiTexCoord4xvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLEGLIMAGETARGETTEXTURE2DOESPROC m_orig_glEGLImageTargetTexture2DOES = nullptr;
+void m_glEGLImageTargetTexture2DOES_profile(GLenum target,GLeglImageOES image)const{ProfilingScope const scope(this,2373);(this->*(this->m_orig_glEGLImageTargetTexture2DOES))(target,image);}
+FunctionTable::MEMBERPFNGLPIXELZOOMPROC m_orig_glPixelZoom = nullptr;
+void m_glPixelZoom_profile(GLfloat xfactor,GLfloat yfactor)const{ProfilingScope const scope(this,2374);(this->*(this->m_orig_glPixelZoom))(xfactor,yfactor);}
+FunctionTable::MEMBERPFNGLVERTEX3BVOESPROC m_orig_glVertex3bvOES = nullptr;
+void m_glVertex3bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,2375);(this->*(this->m_orig_glVertex3bvOES))(coords);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERREADBUFFEREXTPROC m_orig_glFramebufferReadBufferEXT = nullptr;
+void m_glFramebufferReadBufferEXT_profile(GLuint framebuffer,GLenum mode)const{ProfilingScope const scope(this,2376);(this->*(this->m_orig_glFramebufferReadBufferEXT))(framebuffer,mode);}
+FunctionTable::MEMBERPFNGLEXTRACTCOMPONENTEXTPROC m_orig_glExtractComponentEXT = nullptr;
+void m_glExtractComponentEXT_profile(GLuint res,GLuint src,GLuint num)const{ProfilingScope const scope(this,2377);(this->*(this->m_orig_glExtractComponentEXT))(res,src,num);}
+FunctionTable::MEMBERPFNGLCOMBINERPARAMETERIVNVPROC m_orig_glCombinerParameterivNV = nullptr;
+void m_glCombinerParameterivNV_profile(GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2378);(this->*(this->m_orig_glCombinerParameterivNV))(pname,params);}
+FunctionTable::MEMBERPFNGLMINMAXPROC m_orig_glMinmax = nullptr;
+void m_glMinmax_profile(GLenum target,GLenum internalformat,GLboolean sink)const{ProfilingScope const scope(this,2379);(this->*(this->m_orig_glMinmax))(target,internalformat,sink);}
+FunctionTable::MEMBERPFNGLCOLORP3UIPROC m_orig_glColorP3ui = nullptr;
+void m_glColorP3ui_profile(GLenum type,GLuint color)const{ProfilingScope const scope(this,2380);(this->*(this->m_orig_glColorP3ui))(type,color);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVSGISPROC m_orig_glPointParameterfvSGIS = nullptr;
+void m_glPointParameterfvSGIS_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2381);(this->*(this->m_orig_glPointParameterfvSGIS))(pname,params);}
+FunctionTable::MEMBERPFNGLBLENDEQUATIONIPROC m_orig_glBlendEquationi = nullptr;
+void m_glBlendEquationi_profile(GLuint buf,GLenum mode)const{ProfilingScope const scope(this,2382);(this->*(this->m_orig_glBlendEquationi))(buf,mode);}
+FunctionTable::MEMBERPFNGLGETFOGFUNCSGISPROC m_orig_glGetFogFuncSGIS = nullptr;
+void m_glGetFogFuncSGIS_profile(GLfloat* points)const{ProfilingScope const scope(this,2383);(this->*(this->m_orig_glGetFogFuncSGIS))(points);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FVNVPROC m_orig_glVertexAttrib4fvNV = nullptr;
+void m_glVertexAttrib4fvNV_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,2384);(this->*(this->m_orig_glVertexAttrib4fvNV))(index,v);}
+FunctionTable::MEMBERPFNGLGETNMINMAXPROC m_orig_glGetnMinmax = nullptr;
+void m_glGetnMinmax_profile(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values)const{ProfilingScope const scope(this,2385);(this->*(this->m_orig_glGetnMinmax))(target,reset,format,type,bufSize,values);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTISGIXPROC m_orig_glFragmentLightiSGIX = nullptr;
+void m_glFragmentLightiSGIX_profile(GLenum light,GLenum pname,GLint param)const{ProfilingScope const scope(this,2386);(this->*(this->m_orig_glFragmentLightiSGIX))(light,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD1BVOESPROC m_orig_glMultiTexCoord1bvOES = nullptr;
+void m_glMultiTexCoord1bvOES_profile(GLenum texture,const GLbyte* coords)const{ProfilingScope const scope(this,2387);(this->*(this->m_orig_glMultiTexCoord1bvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLORPOINTEREXTPROC m_orig_glSecondaryColorPointerEXT = nullptr;
+void m_glSecondaryColorPointerEXT_profile(GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2388);(this->*(this->m_orig_glSecondaryColorPointerEXT))(size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORDP4UIVPROC m_orig_glMultiTexCoordP4uiv = nullptr;
+void m_glMultiTexCoordP4uiv_profile(GLenum texture,GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,2389);(this->*(this->m_orig_glMultiTexCoordP4uiv))(texture,type,coords);}
+FunctionTable::MEMBERPFNGLGETBUFFERSUBDATAARBPROC m_orig_glGetBufferSubDataARB = nullptr;
+void m_glGetBufferSubDataARB_profile(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data)const{ProfilingScope const scope(this,2390);(this->*(this->m_orig_glGetBufferSubDataARB))(target,offset,size,data);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3HNVPROC m_orig_glSecondaryColor3hNV = nullptr;
+void m_glSecondaryColor3hNV_profile(GLhalfNV red,GLhalfNV green,GLhalfNV blue)const{ProfilingScope const scope(this,2391);(this->*(this->m_orig_glSecondaryColor3hNV))(red,green,blue);}
+FunctionTable::MEMBERPFNGLGETPATHPARAMETERIVNVPROC m_orig_glGetPathParameterivNV = nullptr;
+void m_glGetPathParameterivNV_profile(GLuint path,GLenum pname,GLint* value)const{ProfilingScope const scope(this,2392);(this->*(this->m_orig_glGetPathParameterivNV))(path,pname,value);}
+FunctionTable::MEMBERPFNGLFLUSHRASTERSGIXPROC m_orig_glFlushRasterSGIX = nullptr;
+void m_glFlushRasterSGIX_profile()const{ProfilingScope const scope(this,2393);(this->*(this->m_orig_glFlushRasterSGIX))();}
+FunctionTable::MEMBERPFNGLELEMENTPOINTERATIPROC m_orig_glElementPointerATI = nullptr;
+void m_glElementPointerATI_profile(GLenum type,const void* pointer)const{ProfilingScope const scope(this,2394);(this->*(this->m_orig_glElementPointerATI))(type,pointer);}
+FunctionTable::MEMBERPFNGLGETATTACHEDOBJECTSARBPROC m_orig_glGetAttachedObjectsARB = nullptr;
+void m_glGetAttachedObjectsARB_profile(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj)const{ProfilingScope const scope(this,2395);(this->*(this->m_orig_glGetAttachedObjectsARB))(containerObj,maxCount,count,obj);}
+FunctionTable::MEMBERPFNGLUNIFORM4IVPROC m_orig_glUniform4iv = nullptr;
+void m_glUniform4iv_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2396);(this->*(this->m_orig_glUniform4iv))(location,count,value);}
+FunctionTable::MEMBERPFNGLFOGXOESPROC m_orig_glFogxOES = nullptr;
+void m_glFogxOES_profile(GLenum pname,GLfixed param)const{ProfilingScope const scope(this,2397);(this->*(this->m_orig_glFogxOES))(pname,param);}
+FunctionTable::MEMBERPFNGLSHARPENTEXFUNCSGISPROC m_orig_glSharpenTexFuncSGIS = nullptr;
+void m_glSharpenTexFuncSGIS_profile(GLenum target,GLsizei n,const GLfloat* points)const{ProfilingScope const scope(this,2398);(this->*(this->m_orig_glSharpenTexFuncSGIS))(target,n,points);}
+FunctionTable::MEMBERPFNGLCLEARDEPTHFOESPROC m_orig_glClearDepthfOES = nullptr;
+void m_glClearDepthfOES_profile(GLclampf depth)const{ProfilingScope const scope(this,2399);(this->*(this->m_orig_glClearDepthfOES))(depth);}
+FunctionTable::MEMBERPFNGLDELETECOMMANDLISTSNVPROC m_orig_glDeleteCommandListsNV = nullptr;
+void m_glDeleteCommandListsNV_profile(GLsizei n,const GLuint* lists)const{ProfilingScope const scope(this,2400);(this->*(this->m_orig_glDeleteCommandListsNV))(n,lists);}
+FunctionTable::MEMBERPFNGLSPECIALIZESHADERPROC m_orig_glSpecializeShader = nullptr;
+void m_glSpecializeShader_profile(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue)const{ProfilingScope const scope(this,2401);(this->*(this->m_orig_glSpecializeShader))(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+FunctionTable::MEMBERPFNGLVERTEX4HNVPROC m_orig_glVertex4hNV = nullptr;
+void m_glVertex4hNV_profile(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w)const{ProfilingScope const scope(this,2402);(this->*(this->m_orig_glVertex4hNV))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3DVEXTPROC m_orig_glSecondaryColor3dvEXT = nullptr;
+void m_glSecondaryColor3dvEXT_profile(const GLdouble* v)const{ProfilingScope const scope(this,2403);(this->*(this->m_orig_glSecondaryColor3dvEXT))(v);}
+FunctionTable::MEMBERPFNGLGENTEXTURESPROC m_orig_glGenTextures = nullptr;
+void m_glGenTextures_profile(GLsizei n,GLuint* textures)const{ProfilingScope const scope(this,2404);(this->*(this->m_orig_glGenTextures))(n,textures);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGE2DMULTISAMPLEPROC m_orig_glTextureStorage2DMultisample = nullptr;
+void m_glTextureStorage2DMultisample_profile(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2405);(this->*(this->m_orig_glTextureStorage2DMultisample))(texture,samples,internalformat,width,height,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLUNIFORM3UI64VNVPROC m_orig_glUniform3ui64vNV = nullptr;
+void m_glUniform3ui64vNV_profile(GLint location,GLsizei count,const GLuint64EXT* value)const{ProfilingScope const scope(this,2406);(this->*(this->m_orig_glUniform3ui64vNV))(location,count,value);}
+FunctionTable::MEMBERPFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC m_orig_glBlendFuncSeparateIndexedAMD = nullptr;
+void m_glBlendFuncSeparateIndexedAMD_profile(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha)const{ProfilingScope const scope(this,2407);(this->*(this->m_orig_glBlendFuncSeparateIndexedAMD))(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+FunctionTable::MEMBERPFNGLMAKEBUFFERRESIDENTNVPROC m_orig_glMakeBufferResidentNV = nullptr;
+void m_glMakeBufferResidentNV_profile(GLenum target,GLenum access)const{ProfilingScope const scope(this,2408);(this->*(this->m_orig_glMakeBufferResidentNV))(target,access);}
+FunctionTable::MEMBERPFNGLSHADEROP2EXTPROC m_orig_glShaderOp2EXT = nullptr;
+void m_glShaderOp2EXT_profile(GLenum op,GLuint res,GLuint arg1,GLuint arg2)const{ProfilingScope const scope(this,2409);(this->*(this->m_orig_glShaderOp2EXT))(op,res,arg1,arg2);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVNVPROC m_orig_glGetVertexAttribivNV = nullptr;
+void m_glGetVertexAttribivNV_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2410);(this->*(this->m_orig_glGetVertexAttribivNV))(index,pname,params);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVEXTPROC m_orig_glTexParameterIivEXT = nullptr;
+void m_glTexParameterIivEXT_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2411);(this->*(this->m_orig_glTexParameterIivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETPERFQUERYDATAINTELPROC m_orig_glGetPerfQueryDataINTEL = nullptr;
+void m_glGetPerfQueryDataINTEL_profile(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten)const{ProfilingScope const scope(this,2412);(this->*(this->m_orig_glGetPerfQueryDataINTEL))(queryHandle,flags,dataSize,data,bytesWritten);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DVARBPROC m_orig_glVertexAttrib4dvARB = nullptr;
+void m_glVertexAttrib4dvARB_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2413);(this->*(this->m_orig_glVertexAttrib4dvARB))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE1DEXTPROC m_orig_glTextureSubImage1DEXT = nullptr;
+void m_glTextureSubImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2414);(this->*(this->m_orig_glTextureSubImage1DEXT))(texture,target,level,xoffset,width,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETACTIVEUNIFORMBLOCKNAMEPROC m_orig_glGetActiveUniformBlockName = nullptr;
+void m_glGetActiveUniformBlockName_profile(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName)const{ProfilingScope const scope(this,2415);(this->*(this->m_orig_glGetActiveUniformBlockName))(program,uniformBlockIndex,bufSize,length,uniformBlockName);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DVARBPROC m_orig_glVertexAttrib2dvARB = nullptr;
+void m_glVertexAttrib2dvARB_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2416);(this->*(this->m_orig_glVertexAttrib2dvARB))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERPROC m_orig_glVertexAttribPointer = nullptr;
+void m_glVertexAttribPointer_profile(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2417);(this->*(this->m_orig_glVertexAttribPointer))(index,size,type,normalized,stride,pointer);}
+FunctionTable::MEMBERPFNGLDEPTHBOUNDSDNVPROC m_orig_glDepthBoundsdNV = nullptr;
+void m_glDepthBoundsdNV_profile(GLdouble zmin,GLdouble zmax)const{ProfilingScope const scope(this,2418);(this->*(this->m_orig_glDepthBoundsdNV))(zmin,zmax);}
+FunctionTable::MEMBERPFNGLDELETETEXTURESEXTPROC m_orig_glDeleteTexturesEXT = nullptr;
+void m_glDeleteTexturesEXT_profile(GLsizei n,const GLuint* textures)const{ProfilingScope const scope(this,2419);(this->*(this->m_orig_glDeleteTexturesEXT))(n,textures);}
+FunctionTable::MEMBERPFNGLDRAWBUFFERSATIPROC m_orig_glDrawBuffersATI = nullptr;
+void m_glDrawBuffersATI_profile(GLsizei n,const GLenum* bufs)const{ProfilingScope const scope(this,2420);(this->*(this->m_orig_glDrawBuffersATI))(n,bufs);}
+FunctionTable::MEMBERPFNGLLIGHTMODELXVOESPROC m_orig_glLightModelxvOES = nullptr;
+void m_glLightModelxvOES_profile(GLenum pname,const GLfixed* param)const{ProfilingScope const scope(this,2421);(this->*(this->m_orig_glLightModelxvOES))(pname,param);}
+FunctionTable::MEMBERPFNGLAPPLYTEXTUREEXTPROC m_orig_glApplyTextureEXT = nullptr;
+void m_glApplyTextureEXT_profile(GLenum mode)const{ProfilingScope const scope(this,2422);(this->*(this->m_orig_glApplyTextureEXT))(mode);}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLENVPROC m_orig_glGetImageHandleNV = nullptr;
+GLuint64 m_glGetImageHandleNV_profile(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{ProfilingScope const scope(this,2423);return (this->*(this->m_orig_glGetImageHandleNV))(texture,level,layered,layer,format);}
+FunctionTable::MEMBERPFNGLGETMINMAXPROC m_orig_glGetMinmax = nullptr;
+void m_glGetMinmax_profile(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values)const{ProfilingScope const scope(this,2424);(this->*(this->m_orig_glGetMinmax))(target,reset,format,types,values);}
+FunctionTable::MEMBERPFNGLGETFIXEDVOESPROC m_orig_glGetFixedvOES = nullptr;
+void m_glGetFixedvOES_profile(GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,2425);(this->*(this->m_orig_glGetFixedvOES))(pname,params);}
+FunctionTable::MEMBERPFNGLSAMPLEPATTERNEXTPROC m_orig_glSamplePatternEXT = nullptr;
+void m_glSamplePatternEXT_profile(GLenum pattern)const{ProfilingScope const scope(this,2426);(this->*(this->m_orig_glSamplePatternEXT))(pattern);}
+FunctionTable::MEMBERPFNGLUNIFORM1FPROC m_orig_glUniform1f = nullptr;
+void m_glUniform1f_profile(GLint location,GLfloat v0)const{ProfilingScope const scope(this,2427);(this->*(this->m_orig_glUniform1f))(location,v0);}
+FunctionTable::MEMBERPFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glColor4fNormal3fVertex3fSUN = nullptr;
+void m_glColor4fNormal3fVertex3fSUN_profile(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2428);(this->*(this->m_orig_glColor4fNormal3fVertex3fSUN))(r,g,b,a,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLFOGCOORDDVEXTPROC m_orig_glFogCoorddvEXT = nullptr;
+void m_glFogCoorddvEXT_profile(const GLdouble* coord)const{ProfilingScope const scope(this,2429);(this->*(this->m_orig_glFogCoorddvEXT))(coord);}
+FunctionTable::MEMBERPFNGLCOPYTEXTUREIMAGE1DEXTPROC m_orig_glCopyTextureImage1DEXT = nullptr;
+void m_glCopyTextureImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border)const{ProfilingScope const scope(this,2430);(this->*(this->m_orig_glCopyTextureImage1DEXT))(texture,target,level,internalformat,x,y,width,border);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC m_orig_glFlushMappedBufferRangeAPPLE = nullptr;
+void m_glFlushMappedBufferRangeAPPLE_profile(GLenum target,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,2431);(this->*(this->m_orig_glFlushMappedBufferRangeAPPLE))(target,offset,size);}
+FunctionTable::MEMBERPFNGLVERTEX3SVPROC m_orig_glVertex3sv = nullptr;
+void m_glVertex3sv_profile(const GLshort* v)const{ProfilingScope const scope(this,2432);(this->*(this->m_orig_glVertex3sv))(v);}
+FunctionTable::MEMBERPFNGLFLUSHSTATICDATAIBMPROC m_orig_glFlushStaticDataIBM = nullptr;
+void m_glFlushStaticDataIBM_profile(GLenum target)const{ProfilingScope const scope(this,2433);(this->*(this->m_orig_glFlushStaticDataIBM))(target);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64NVPROC m_orig_glProgramUniform4ui64NV = nullptr;
+void m_glProgramUniform4ui64NV_profile(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{ProfilingScope const scope(this,2434);(this->*(this->m_orig_glProgramUniform4ui64NV))(program,location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLRASTERPOS4XOESPROC m_orig_glRasterPos4xOES = nullptr;
+void m_glRasterPos4xOES_profile(GLfixed x,GLfixed y,GLfixed z,GLfixed w)const{ProfilingScope const scope(this,2435);(this->*(this->m_orig_glRasterPos4xOES))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP1UIPROC m_orig_glVertexAttribP1ui = nullptr;
+void m_glVertexAttribP1ui_profile(GLuint index,GLenum type,GLboolean normalized,GLuint value)const{ProfilingScope const scope(this,2436);(this->*(this->m_orig_glVertexAttribP1ui))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4DVEXTPROC m_orig_glProgramUniform4dvEXT = nullptr;
+void m_glProgramUniform4dvEXT_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,2437);(this->*(this->m_orig_glProgramUniform4dvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKEXTPROC m_orig_glEndTransformFeedbackEXT = nullptr;
+void m_glEndTransformFeedbackEXT_profile()const{ProfilingScope const scope(this,2438);(this->*(this->m_orig_glEndTransformFeedbackEXT))();}
+FunctionTable::MEMBERPFNGLBINORMAL3DEXTPROC m_orig_glBinormal3dEXT = nullptr;
+void m_glBinormal3dEXT_profile(GLdouble bx,GLdouble by,GLdouble bz)const{ProfilingScope const scope(this,2439);(this->*(this->m_orig_glBinormal3dEXT))(bx,by,bz);}
+FunctionTable::MEMBERPFNGLGETTEXTURESUBIMAGEPROC m_orig_glGetTextureSubImage = nullptr;
+void m_glGetTextureSubImage_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,2440);(this->*(this->m_orig_glGetTextureSubImage))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC m_orig_glGetNamedRenderbufferParameteriv = nullptr;
+void m_glGetNamedRenderbufferParameteriv_profile(GLuint renderbuffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2441);(this->*(this->m_orig_glGetNamedRenderbufferParameteriv))(renderbuffer,pname,params);}
+FunctionTable::MEMBERPFNGLBINDBUFFERSRANGEPROC m_orig_glBindBuffersRange = nullptr;
+void m_glBindBuffersRange_profile(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes)const{ProfilingScope const scope(this,2442);(this->*(this->m_orig_glBindBuffersRange))(target,first,count,buffers,offsets,sizes);}
+FunctionTable::MEMBERPFNGLFINISHASYNCSGIXPROC m_orig_glFinishAsyncSGIX = nullptr;
+GLint m_glFinishAsyncSGIX_profile(GLuint* markerp)const{ProfilingScope const scope(this,2443);return (this->*(this->m_orig_glFinishAsyncSGIX))(markerp);}
+FunctionTable::MEMBERPFNGLBINDFRAGDATALOCATIONINDEXEDPROC m_orig_glBindFragDataLocationIndexed = nullptr;
+void m_glBindFragDataLocationIndexed_profile(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name)const{ProfilingScope const scope(this,2444);(this->*(this->m_orig_glBindFragDataLocationIndexed))(program,colorNumber,index,name);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DVPROC m_orig_glMultiTexCoord2dv = nullptr;
+void m_glMultiTexCoord2dv_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,2445);(this->*(this->m_orig_glMultiTexCoord2dv))(target,v);}
+FunctionTable::MEMBERPFNGLUNIFORM2IVPROC m_orig_glUniform2iv = nullptr;
+void m_glUniform2iv_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2446);(this->*(this->m_orig_glUniform2iv))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2I64VNVPROC m_orig_glProgramUniform2i64vNV = nullptr;
+void m_glProgramUniform2i64vNV_profile(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,2447);(this->*(this->m_orig_glProgramUniform2i64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC m_orig_glFlushVertexArrayRangeAPPLE = nullptr;
+void m_glFlushVertexArrayRangeAPPLE_profile(GLsizei length,void* pointer)const{ProfilingScope const scope(this,2448);(this->*(this->m_orig_glFlushVertexArrayRangeAPPLE))(length,pointer);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFPROC m_orig_glTextureParameterf = nullptr;
+void m_glTextureParameterf_profile(GLuint texture,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,2449);(this->*(this->m_orig_glTextureParameterf))(texture,pname,param);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DVARBPROC m_orig_glMultiTexCoord3dvARB = nullptr;
+void m_glMultiTexCoord3dvARB_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,2450);(this->*(this->m_orig_glMultiTexCoord3dvARB))(target,v);}
+FunctionTable::MEMBERPFNGLFEEDBACKBUFFERPROC m_orig_glFeedbackBuffer = nullptr;
+void m_glFeedbackBuffer_profile(GLsizei size,GLenum type,GLfloat* buffer)const{ProfilingScope const scope(this,2451);(this->*(this->m_orig_glFeedbackBuffer))(size,type,buffer);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGEINSERTARBPROC m_orig_glDebugMessageInsertARB = nullptr;
+void m_glDebugMessageInsertARB_profile(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf)const{ProfilingScope const scope(this,2452);(this->*(this->m_orig_glDebugMessageInsertARB))(source,type,id,severity,length,buf);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IPROC m_orig_glMultiTexCoord2i = nullptr;
+void m_glMultiTexCoord2i_profile(GLenum target,GLint s,GLint t)const{ProfilingScope const scope(this,2453);(this->*(this->m_orig_glMultiTexCoord2i))(target,s,t);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE3DPROC m_orig_glTextureSubImage3D = nullptr;
+void m_glTextureSubImage3D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2454);(this->*(this->m_orig_glTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE1DPROC m_orig_glFramebufferTexture1D = nullptr;
+void m_glFramebufferTexture1D_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,2455);(this->*(this->m_orig_glFramebufferTexture1D))(target,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLGETSHADERIVPROC m_orig_glGetShaderiv = nullptr;
+void m_glGetShaderiv_profile(GLuint shader,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2456);(this->*(this->m_orig_glGetShaderiv))(shader,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DPROC m_orig_glMultiTexCoord2d = nullptr;
+void m_glMultiTexCoord2d_profile(GLenum target,GLdouble s,GLdouble t)const{ProfilingScope const scope(this,2457);(this->*(this->m_orig_glMultiTexCoord2d))(target,s,t);}
+FunctionTable::MEMBERPFNGLARRAYOBJECTATIPROC m_orig_glArrayObjectATI = nullptr;
+void m_glArrayObjectATI_profile(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset)const{ProfilingScope const scope(this,2458);(this->*(this->m_orig_glArrayObjectATI))(array,size,type,stride,buffer,offset);}
+FunctionTable::MEMBERPFNGLGETPOINTERI_VEXTPROC m_orig_glGetPointeri_vEXT = nullptr;
+void m_glGetPointeri_vEXT_profile(GLenum pname,GLuint index,void** params)const{ProfilingScope const scope(this,2459);(this->*(this->m_orig_glGetPointeri_vEXT))(pname,index,params);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSAMDPROC m_orig_glGetPerfMonitorCountersAMD = nullptr;
+void m_glGetPerfMonitorCountersAMD_profile(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters)const{ProfilingScope const scope(this,2460);(this->*(this->m_orig_glGetPerfMonitorCountersAMD))(group,numCounters,maxActiveCounters,counterSize,counters);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEPROC m_orig_glNamedBufferStorage = nullptr;
+void m_glNamedBufferStorage_profile(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags)const{ProfilingScope const scope(this,2461);(this->*(this->m_orig_glNamedBufferStorage))(buffer,size,data,flags);}
+FunctionTable::MEMBERPFNGLTEXENVXVOESPROC m_orig_glTexEnvxvOES = nullptr;
+void m_glTexEnvxvOES_profile(GLenum target,GLenum pname,const GLfixed* params)const{ProfilingScope const scope(this,2462);(this->*(this->m_orig_glTexEnvxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64NVPROC m_orig_glProgramUniform2ui64NV = nullptr;
+void m_glProgramUniform2ui64NV_profile(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y)const{ProfilingScope const scope(this,2463);(this->*(this->m_orig_glProgramUniform2ui64NV))(program,location,x,y);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BOESPROC m_orig_glMultiTexCoord3bOES = nullptr;
+void m_glMultiTexCoord3bOES_profile(GLenum texture,GLbyte s,GLbyte t,GLbyte r)const{ProfilingScope const scope(this,2464);(this->*(this->m_orig_glMultiTexCoord3bOES))(texture,s,t,r);}
+FunctionTable::MEMBERPFNGLUNIFORM1DVPROC m_orig_glUniform1dv = nullptr;
+void m_glUniform1dv_profile(GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,2465);(this->*(this->m_orig_glUniform1dv))(location,count,value);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFERIPROC m_orig_glPixelTransferi = nullptr;
+void m_glPixelTransferi_profile(GLenum pname,GLint param)const{ProfilingScope const scope(this,2466);(this->*(this->m_orig_glPixelTransferi))(pname,param);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USVEXTPROC m_orig_glSecondaryColor3usvEXT = nullptr;
+void m_glSecondaryColor3usvEXT_profile(const GLushort* v)const{ProfilingScope const scope(this,2467);(this->*(this->m_orig_glSecondaryColor3usvEXT))(v);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETERI4UIVNVPROC m_orig_glProgramEnvParameterI4uivNV = nullptr;
+void m_glProgramEnvParameterI4uivNV_profile(GLenum target,GLuint index,const GLuint* params)const{ProfilingScope const scope(this,2468);(this->*(this->m_orig_glProgramEnvParameterI4uivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLVERTEX2SVPROC m_orig_glVertex2sv = nullptr;
+void m_glVertex2sv_profile(const GLshort* v)const{ProfilingScope const scope(this,2469);(this->*(this->m_orig_glVertex2sv))(v);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4DMESAPROC m_orig_glWindowPos4dMESA = nullptr;
+void m_glWindowPos4dMESA_profile(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2470);(this->*(this->m_orig_glWindowPos4dMESA))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECONTROLARBPROC m_orig_glDebugMessageControlARB = nullptr;
+void m_glDebugMessageControlARB_profile(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled)const{ProfilingScope const scope(this,2471);(this->*(this->m_orig_glDebugMessageControlARB))(source,type,severity,count,ids,enabled);}
+FunctionTable::MEMBERPFNGLISTEXTUREEXTPROC m_orig_glIsTextureEXT = nullptr;
+GLboolean m_glIsTextureEXT_profile(GLuint texture)const{ProfilingScope const scope(this,2472);return (this->*(this->m_orig_glIsTextureEXT))(texture);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALIVSGIXPROC m_orig_glFragmentMaterialivSGIX = nullptr;
+void m_glFragmentMaterialivSGIX_profile(GLenum face,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2473);(this->*(this->m_orig_glFragmentMaterialivSGIX))(face,pname,params);}
+FunctionTable::MEMBERPFNGLLINKPROGRAMARBPROC m_orig_glLinkProgramARB = nullptr;
+void m_glLinkProgramARB_profile(GLhandleARB programObj)const{ProfilingScope const scope(this,2474);(this->*(this->m_orig_glLinkProgramARB))(programObj);}
+FunctionTable::MEMBERPFNGLFINISHFENCEAPPLEPROC m_orig_glFinishFenceAPPLE = nullptr;
+void m_glFinishFenceAPPLE_profile(GLuint fence)const{ProfilingScope const scope(this,2475);(this->*(this->m_orig_glFinishFenceAPPLE))(fence);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC m_orig_glVertexArrayVertexAttribBindingEXT = nullptr;
+void m_glVertexArrayVertexAttribBindingEXT_profile(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{ProfilingScope const scope(this,2476);(this->*(this->m_orig_glVertexArrayVertexAttribBindingEXT))(vaobj,attribindex,bindingindex);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM3DMULTISAMPLEEXTPROC m_orig_glTexStorageMem3DMultisampleEXT = nullptr;
+void m_glTexStorageMem3DMultisampleEXT_profile(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2477);(this->*(this->m_orig_glTexStorageMem3DMultisampleEXT))(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+FunctionTable::MEMBERPFNGLUNIFORM1UI64VARBPROC m_orig_glUniform1ui64vARB = nullptr;
+void m_glUniform1ui64vARB_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,2478);(this->*(this->m_orig_glUniform1ui64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4FVPROC m_orig_glMultiTexCoord4fv = nullptr;
+void m_glMultiTexCoord4fv_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,2479);(this->*(this->m_orig_glMultiTexCoord4fv))(target,v);}
+FunctionTable::MEMBERPFNGLMULTICASTFRAMEBUFFERSAMPLELOCATIONSFVNVPROC m_orig_glMulticastFramebufferSampleLocationsfvNV = nullptr;
+void m_glMulticastFramebufferSampleLocationsfvNV_profile(GLuint gpu,GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,2480);(this->*(this->m_orig_glMulticastFramebufferSampleLocationsfvNV))(gpu,framebuffer,start,count,v);}
+FunctionTable::MEMBERPFNGLRASTERPOS3DPROC m_orig_glRasterPos3d = nullptr;
+void m_glRasterPos3d_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,2481);(this->*(this->m_orig_glRasterPos3d))(x,y,z);}
+FunctionTable::MEMBERPFNGLPOLLASYNCSGIXPROC m_orig_glPollAsyncSGIX = nullptr;
+GLint m_glPollAsyncSGIX_profile(GLuint* markerp)const{ProfilingScope const scope(this,2482);return (this->*(this->m_orig_glPollAsyncSGIX))(markerp);}
+FunctionTable::MEMBERPFNGLRASTERPOS3FPROC m_orig_glRasterPos3f = nullptr;
+void m_glRasterPos3f_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2483);(this->*(this->m_orig_glRasterPos3f))(x,y,z);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXIMAGE3DPROC m_orig_glCompressedTexImage3D = nullptr;
+void m_glCompressedTexImage3D_profile(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,2484);(this->*(this->m_orig_glCompressedTexImage3D))(target,level,internalformat,width,height,depth,border,imageSize,data);}
+FunctionTable::MEMBERPFNGLVARIANTIVEXTPROC m_orig_glVariantivEXT = nullptr;
+void m_glVariantivEXT_profile(GLuint id,const GLint* addr)const{ProfilingScope const scope(this,2485);(this->*(this->m_orig_glVariantivEXT))(id,addr);}
+FunctionTable::MEMBERPFNGLUNMAPTEXTURE2DINTELPROC m_orig_glUnmapTexture2DINTEL = nullptr;
+void m_glUnmapTexture2DINTEL_profile(GLuint texture,GLint level)const{ProfilingScope const scope(this,2486);(this->*(this->m_orig_glUnmapTexture2DINTEL))(texture,level);}
+FunctionTable::MEMBERPFNGLMULTICASTWAITSYNCNVPROC m_orig_glMulticastWaitSyncNV = nullptr;
+void m_glMulticastWaitSyncNV_profile(GLuint signalGpu,GLbitfield waitGpuMask)const{ProfilingScope const scope(this,2487);(this->*(this->m_orig_glMulticastWaitSyncNV))(signalGpu,waitGpuMask);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIVPROC m_orig_glGetVertexAttribiv = nullptr;
+void m_glGetVertexAttribiv_profile(GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2488);(this->*(this->m_orig_glGetVertexAttribiv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLGETPATHCOORDSNVPROC m_orig_glGetPathCoordsNV = nullptr;
+void m_glGetPathCoordsNV_profile(GLuint path,GLfloat* coords)const{ProfilingScope const scope(this,2489);(this->*(this->m_orig_glGetPathCoordsNV))(path,coords);}
+FunctionTable::MEMBERPFNGLCOLOR4XVOESPROC m_orig_glColor4xvOES = nullptr;
+void m_glColor4xvOES_profile(const GLfixed* components)const{ProfilingScope const scope(this,2490);(this->*(this->m_orig_glColor4xvOES))(components);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3FVPROC m_orig_glVertexAttrib3fv = nullptr;
+void m_glVertexAttrib3fv_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,2491);(this->*(this->m_orig_glVertexAttrib3fv))(index,v);}
+FunctionTable::MEMBERPFNGLRASTERPOS3SPROC m_orig_glRasterPos3s = nullptr;
+void m_glRasterPos3s_profile(GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,2492);(this->*(this->m_orig_glRasterPos3s))(x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEX4BOESPROC m_orig_glVertex4bOES = nullptr;
+void m_glVertex4bOES_profile(GLbyte x,GLbyte y,GLbyte z,GLbyte w)const{ProfilingScope const scope(this,2493);(this->*(this->m_orig_glVertex4bOES))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC m_orig_glTransformFeedbackVaryingsEXT = nullptr;
+void m_glTransformFeedbackVaryingsEXT_profile(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode)const{ProfilingScope const scope(this,2494);(this->*(this->m_orig_glTransformFeedbackVaryingsEXT))(program,count,varyings,bufferMode);}
+FunctionTable::MEMBERPFNGLCOMBINEROUTPUTNVPROC m_orig_glCombinerOutputNV = nullptr;
+void m_glCombinerOutputNV_profile(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum)const{ProfilingScope const scope(this,2495);(this->*(this->m_orig_glCombinerOutputNV))(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SMESAPROC m_orig_glWindowPos4sMESA = nullptr;
+void m_glWindowPos4sMESA_profile(GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,2496);(this->*(this->m_orig_glWindowPos4sMESA))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4SVARBPROC m_orig_glVertexAttrib4svARB = nullptr;
+void m_glVertexAttrib4svARB_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2497);(this->*(this->m_orig_glVertexAttrib4svARB))(index,v);}
+FunctionTable::MEMBERPFNGLISLISTPROC m_orig_glIsList = nullptr;
+GLboolean m_glIsList_profile(GLuint list)const{ProfilingScope const scope(this,2498);return (this->*(this->m_orig_glIsList))(list);}
+FunctionTable::MEMBERPFNGLGETINFOLOGARBPROC m_orig_glGetInfoLogARB = nullptr;
+void m_glGetInfoLogARB_profile(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog)const{ProfilingScope const scope(this,2499);(this->*(this->m_orig_glGetInfoLogARB))(obj,maxLength,length,infoLog);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX2FVPROC m_orig_glUniformMatrix2fv = nullptr;
+void m_glUniformMatrix2fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2500);(this->*(this->m_orig_glUniformMatrix2fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3DVNVPROC m_orig_glVertexAttribs3dvNV = nullptr;
+void m_glVertexAttribs3dvNV_profile(GLuint index,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,2501);(this->*(this->m_orig_glVertexAttribs3dvNV))(index,count,v);}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORSSUNPROC m_orig_glGlobalAlphaFactorsSUN = nullptr;
+void m_glGlobalAlphaFactorsSUN_profile(GLshort factor)const{ProfilingScope const scope(this,2502);(this->*(this->m_orig_glGlobalAlphaFactorsSUN))(factor);}
+FunctionTable::MEMBERPFNGLGETTRACKMATRIXIVNVPROC m_orig_glGetTrackMatrixivNV = nullptr;
+void m_glGetTrackMatrixivNV_profile(GLenum target,GLuint address,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2503);(this->*(this->m_orig_glGetTrackMatrixivNV))(target,address,pname,params);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERFVEXTPROC m_orig_glTextureParameterfvEXT = nullptr;
+void m_glTextureParameterfvEXT_profile(GLuint texture,GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2504);(this->*(this->m_orig_glTextureParameterfvEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLISNAMEDBUFFERRESIDENTNVPROC m_orig_glIsNamedBufferResidentNV = nullptr;
+GLboolean m_glIsNamedBufferResidentNV_profile(GLuint buffer)const{ProfilingScope const scope(this,2505);return (this->*(this->m_orig_glIsNamedBufferResidentNV))(buffer);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UI64VARBPROC m_orig_glProgramUniform4ui64vARB = nullptr;
+void m_glProgramUniform4ui64vARB_profile(GLuint program,GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,2506);(this->*(this->m_orig_glProgramUniform4ui64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLTBUFFERMASK3DFXPROC m_orig_glTbufferMask3DFX = nullptr;
+void m_glTbufferMask3DFX_profile(GLuint mask)const{ProfilingScope const scope(this,2507);(this->*(this->m_orig_glTbufferMask3DFX))(mask);}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHNVPROC m_orig_glCoverFillPathNV = nullptr;
+void m_glCoverFillPathNV_profile(GLuint path,GLenum coverMode)const{ProfilingScope const scope(this,2508);(this->*(this->m_orig_glCoverFillPathNV))(path,coverMode);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1FVARBPROC m_orig_glVertexAttrib1fvARB = nullptr;
+void m_glVertexAttrib1fvARB_profile(GLuint index,const GLfloat* v)const{ProfilingScope const scope(this,2509);(this->*(this->m_orig_glVertexAttrib1fvARB))(index,v);}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPPROC m_orig_glGenerateTextureMipmap = nullptr;
+void m_glGenerateTextureMipmap_profile(GLuint texture)const{ProfilingScope const scope(this,2510);(this->*(this->m_orig_glGenerateTextureMipmap))(texture);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC m_orig_glNamedProgramLocalParameterI4uivEXT = nullptr;
+void m_glNamedProgramLocalParameterI4uivEXT_profile(GLuint program,GLenum target,GLuint index,const GLuint* params)const{ProfilingScope const scope(this,2511);(this->*(this->m_orig_glNamedProgramLocalParameterI4uivEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSBASEVERTEXPROC m_orig_glMultiDrawElementsBaseVertex = nullptr;
+void m_glMultiDrawElementsBaseVertex_profile(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex)const{ProfilingScope const scope(this,2512);(this->*(this->m_orig_glMultiDrawElementsBaseVertex))(mode,count,type,indices,drawcount,basevertex);}
+FunctionTable::MEMBERPFNGLPROGRAMSUBROUTINEPARAMETERSUIVNVPROC m_orig_glProgramSubroutineParametersuivNV = nullptr;
+void m_glProgramSubroutineParametersuivNV_profile(GLenum target,GLsizei count,const GLuint* params)const{ProfilingScope const scope(this,2513);(this->*(this->m_orig_glProgramSubroutineParametersuivNV))(target,count,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2X4DVEXTPROC m_orig_glProgramUniformMatrix2x4dvEXT = nullptr;
+void m_glProgramUniformMatrix2x4dvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2514);(this->*(this->m_orig_glProgramUniformMatrix2x4dvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLROTATEXOESPROC m_orig_glRotatexOES = nullptr;
+void m_glRotatexOES_profile(GLfixed angle,GLfixed x,GLfixed y,GLfixed z)const{ProfilingScope const scope(this,2515);(this->*(this->m_orig_glRotatexOES))(angle,x,y,z);}
+FunctionTable::MEMBERPFNGLMEMORYBARRIEREXTPROC m_orig_glMemoryBarrierEXT = nullptr;
+void m_glMemoryBarrierEXT_profile(GLbitfield barriers)const{ProfilingScope const scope(this,2516);(this->*(this->m_orig_glMemoryBarrierEXT))(barriers);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SVNVPROC m_orig_glVertexAttrib3svNV = nullptr;
+void m_glVertexAttrib3svNV_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2517);(this->*(this->m_orig_glVertexAttrib3svNV))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3IATIPROC m_orig_glVertexStream3iATI = nullptr;
+void m_glVertexStream3iATI_profile(GLenum stream,GLint x,GLint y,GLint z)const{ProfilingScope const scope(this,2518);(this->*(this->m_orig_glVertexStream3iATI))(stream,x,y,z);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE1DPROC m_orig_glCompressedTexSubImage1D = nullptr;
+void m_glCompressedTexSubImage1D_profile(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,2519);(this->*(this->m_orig_glCompressedTexSubImage1D))(target,level,xoffset,width,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLSETFENCENVPROC m_orig_glSetFenceNV = nullptr;
+void m_glSetFenceNV_profile(GLuint fence,GLenum condition)const{ProfilingScope const scope(this,2520);(this->*(this->m_orig_glSetFenceNV))(fence,condition);}
+FunctionTable::MEMBERPFNGLATTACHOBJECTARBPROC m_orig_glAttachObjectARB = nullptr;
+void m_glAttachObjectARB_profile(GLhandleARB containerObj,GLhandleARB obj)const{ProfilingScope const scope(this,2521);(this->*(this->m_orig_glAttachObjectARB))(containerObj,obj);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER1DPROC m_orig_glCopyConvolutionFilter1D = nullptr;
+void m_glCopyConvolutionFilter1D_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2522);(this->*(this->m_orig_glCopyConvolutionFilter1D))(target,internalformat,x,y,width);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DMULTISAMPLEEXTPROC m_orig_glTexStorageMem2DMultisampleEXT = nullptr;
+void m_glTexStorageMem2DMultisampleEXT_profile(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2523);(this->*(this->m_orig_glTexStorageMem2DMultisampleEXT))(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4FVNVPROC m_orig_glProgramParameters4fvNV = nullptr;
+void m_glProgramParameters4fvNV_profile(GLenum target,GLuint index,GLsizei count,const GLfloat* v)const{ProfilingScope const scope(this,2524);(this->*(this->m_orig_glProgramParameters4fvNV))(target,index,count,v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC m_orig_glNamedFramebufferParameteriEXT = nullptr;
+void m_glNamedFramebufferParameteriEXT_profile(GLuint framebuffer,GLenum pname,GLint param)const{ProfilingScope const scope(this,2525);(this->*(this->m_orig_glNamedFramebufferParameteriEXT))(framebuffer,pname,param);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4NSVPROC m_orig_glVertexAttrib4Nsv = nullptr;
+void m_glVertexAttrib4Nsv_profile(GLuint index,const GLshort* v)const{ProfilingScope const scope(this,2526);(this->*(this->m_orig_glVertexAttrib4Nsv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4USVEXTPROC m_orig_glVertexAttribI4usvEXT = nullptr;
+void m_glVertexAttribI4usvEXT_profile(GLuint index,const GLushort* v)const{ProfilingScope const scope(this,2527);(this->*(this->m_orig_glVertexAttribI4usvEXT))(index,v);}
+FunctionTable::MEMBERPFNGLTEXTUREBUFFERRANGEEXTPROC m_orig_glTextureBufferRangeEXT = nullptr;
+void m_glTextureBufferRangeEXT_profile(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,2528);(this->*(this->m_orig_glTextureBufferRangeEXT))(texture,target,internalformat,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLVERTEXP3UIVPROC m_orig_glVertexP3uiv = nullptr;
+void m_glVertexP3uiv_profile(GLenum type,const GLuint* value)const{ProfilingScope const scope(this,2529);(this->*(this->m_orig_glVertexP3uiv))(type,value);}
+FunctionTable::MEMBERPFNGLISPATHNVPROC m_orig_glIsPathNV = nullptr;
+GLboolean m_glIsPathNV_profile(GLuint path)const{ProfilingScope const scope(this,2530);return (this->*(this->m_orig_glIsPathNV))(path);}
+FunctionTable::MEMBERPFNGLGETNUNIFORMI64VARBPROC m_orig_glGetnUniformi64vARB = nullptr;
+void m_glGetnUniformi64vARB_profile(GLuint program,GLint location,GLsizei bufSize,GLint64* params)const{ProfilingScope const scope(this,2531);(this->*(this->m_orig_glGetnUniformi64vARB))(program,location,bufSize,params);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC m_orig_glFramebufferTextureMultiviewOVR = nullptr;
+void m_glFramebufferTextureMultiviewOVR_profile(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews)const{ProfilingScope const scope(this,2532);(this->*(this->m_orig_glFramebufferTextureMultiviewOVR))(target,attachment,texture,level,baseViewIndex,numViews);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC m_orig_glCompressedMultiTexSubImage2DEXT = nullptr;
+void m_glCompressedMultiTexSubImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2533);(this->*(this->m_orig_glCompressedMultiTexSubImage2DEXT))(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLGETNMAPDVPROC m_orig_glGetnMapdv = nullptr;
+void m_glGetnMapdv_profile(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v)const{ProfilingScope const scope(this,2534);(this->*(this->m_orig_glGetnMapdv))(target,query,bufSize,v);}
+FunctionTable::MEMBERPFNGLDEBUGMESSAGECALLBACKPROC m_orig_glDebugMessageCallback = nullptr;
+void m_glDebugMessageCallback_profile(GLDEBUGPROC callback,const void* userParam)const{ProfilingScope const scope(this,2535);(this->*(this->m_orig_glDebugMessageCallback))(callback,userParam);}
+FunctionTable::MEMBERPFNGLTANGENT3SVEXTPROC m_orig_glTangent3svEXT = nullptr;
+void m_glTangent3svEXT_profile(const GLshort* v)const{ProfilingScope const scope(this,2536);(this->*(this->m_orig_glTangent3svEXT))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPARAMETERIAMDPROC m_orig_glVertexAttribParameteriAMD = nullptr;
+void m_glVertexAttribParameteriAMD_profile(GLuint index,GLenum pname,GLint param)const{ProfilingScope const scope(this,2537);(this->*(this->m_orig_glVertexAttribParameteriAMD))(index,pname,param);}
+FunctionTable::MEMBERPFNGLBUFFERSUBDATAARBPROC m_orig_glBufferSubDataARB = nullptr;
+void m_glBufferSubDataARB_profile(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data)const{ProfilingScope const scope(this,2538);(this->*(this->m_orig_glBufferSubDataARB))(target,offset,size,data);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBLUI64VARBPROC m_orig_glGetVertexAttribLui64vARB = nullptr;
+void m_glGetVertexAttribLui64vARB_profile(GLuint index,GLenum pname,GLuint64EXT* params)const{ProfilingScope const scope(this,2539);(this->*(this->m_orig_glGetVertexAttribLui64vARB))(index,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4UI64NVPROC m_orig_glVertexAttribL4ui64NV = nullptr;
+void m_glVertexAttribL4ui64NV_profile(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{ProfilingScope const scope(this,2540);(this->*(this->m_orig_glVertexAttribL4ui64NV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC m_orig_glReplacementCodeuiColor4ubVertex3fSUN = nullptr;
+void m_glReplacementCodeuiColor4ubVertex3fSUN_profile(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2541);(this->*(this->m_orig_glReplacementCodeuiColor4ubVertex3fSUN))(rc,r,g,b,a,x,y,z);}
+FunctionTable::MEMBERPFNGLIMAGETRANSFORMPARAMETERFHPPROC m_orig_glImageTransformParameterfHP = nullptr;
+void m_glImageTransformParameterfHP_profile(GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,2542);(this->*(this->m_orig_glImageTransformParameterfHP))(target,pname,param);}
+FunctionTable::MEMBERPFNGLMAP1FPROC m_orig_glMap1f = nullptr;
+void m_glMap1f_profile(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points)const{ProfilingScope const scope(this,2543);(this->*(this->m_orig_glMap1f))(target,u1,u2,stride,order,points);}
+FunctionTable::MEMBERPFNGLRASTERPOS4FVPROC m_orig_glRasterPos4fv = nullptr;
+void m_glRasterPos4fv_profile(const GLfloat* v)const{ProfilingScope const scope(this,2544);(this->*(this->m_orig_glRasterPos4fv))(v);}
+FunctionTable::MEMBERPFNGLVERTEX2BVOESPROC m_orig_glVertex2bvOES = nullptr;
+void m_glVertex2bvOES_profile(const GLbyte* coords)const{ProfilingScope const scope(this,2545);(this->*(this->m_orig_glVertex2bvOES))(coords);}
+FunctionTable::MEMBERPFNGLGETMAPCONTROLPOINTSNVPROC m_orig_glGetMapControlPointsNV = nullptr;
+void m_glGetMapControlPointsNV_profile(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points)const{ProfilingScope const scope(this,2546);(this->*(this->m_orig_glGetMapControlPointsNV))(target,index,type,ustride,vstride,packed,points);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC m_orig_glNamedProgramLocalParametersI4ivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4ivEXT_profile(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params)const{ProfilingScope const scope(this,2547);(this->*(this->m_orig_glNamedProgramLocalParametersI4ivEXT))(program,target,index,count,params);}
+FunctionTable::MEMBERPFNGLBINDBUFFERRANGENVPROC m_orig_glBindBufferRangeNV = nullptr;
+void m_glBindBufferRangeNV_profile(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{ProfilingScope const scope(this,2548);(this->*(this->m_orig_glBindBufferRangeNV))(target,index,buffer,offset,size);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3DVATIPROC m_orig_glVertexStream3dvATI = nullptr;
+void m_glVertexStream3dvATI_profile(GLenum stream,const GLdouble* coords)const{ProfilingScope const scope(this,2549);(this->*(this->m_orig_glVertexStream3dvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERLISTIBMPROC m_orig_glNormalPointerListIBM = nullptr;
+void m_glNormalPointerListIBM_profile(GLenum type,GLint stride,const void** pointer,GLint ptrstride)const{ProfilingScope const scope(this,2550);(this->*(this->m_orig_glNormalPointerListIBM))(type,stride,pointer,ptrstride);}
+FunctionTable::MEMBERPFNGLFOGFUNCSGISPROC m_orig_glFogFuncSGIS = nullptr;
+void m_glFogFuncSGIS_profile(GLsizei n,const GLfloat* points)const{ProfilingScope const scope(this,2551);(this->*(this->m_orig_glFogFuncSGIS))(n,points);}
+FunctionTable::MEMBERPFNGLMULTIMODEDRAWARRAYSIBMPROC m_orig_glMultiModeDrawArraysIBM = nullptr;
+void m_glMultiModeDrawArraysIBM_profile(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride)const{ProfilingScope const scope(this,2552);(this->*(this->m_orig_glMultiModeDrawArraysIBM))(mode,first,count,primcount,modestride);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC m_orig_glGetNamedFramebufferAttachmentParameterivEXT = nullptr;
+void m_glGetNamedFramebufferAttachmentParameterivEXT_profile(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2553);(this->*(this->m_orig_glGetNamedFramebufferAttachmentParameterivEXT))(framebuffer,attachment,pname,params);}
+FunctionTable::MEMBERPFNGLGETFLOATVPROC m_orig_glGetFloatv = nullptr;
+void m_glGetFloatv_profile(GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2554);(this->*(this->m_orig_glGetFloatv))(pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC m_orig_glVertexArrayVertexAttribIFormatEXT = nullptr;
+void m_glVertexArrayVertexAttribIFormatEXT_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset)const{ProfilingScope const scope(this,2555);(this->*(this->m_orig_glVertexArrayVertexAttribIFormatEXT))(vaobj,attribindex,size,type,relativeoffset);}
+FunctionTable::MEMBERPFNGLHINTPROC m_orig_glHint = nullptr;
+void m_glHint_profile(GLenum target,GLenum mode)const{ProfilingScope const scope(this,2556);(this->*(this->m_orig_glHint))(target,mode);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2SVATIPROC m_orig_glVertexStream2svATI = nullptr;
+void m_glVertexStream2svATI_profile(GLenum stream,const GLshort* coords)const{ProfilingScope const scope(this,2557);(this->*(this->m_orig_glVertexStream2svATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLMULTIDRAWARRAYSINDIRECTPROC m_orig_glMultiDrawArraysIndirect = nullptr;
+void m_glMultiDrawArraysIndirect_profile(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride)const{ProfilingScope const scope(this,2558);(this->*(this->m_orig_glMultiDrawArraysIndirect))(mode,indirect,drawcount,stride);}
+FunctionTable::MEMBERPFNGLMULTITEXENVFVEXTPROC m_orig_glMultiTexEnvfvEXT = nullptr;
+void m_glMultiTexEnvfvEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2559);(this->*(this->m_orig_glMultiTexEnvfvEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBP2UIVPROC m_orig_glVertexAttribP2uiv = nullptr;
+void m_glVertexAttribP2uiv_profile(GLuint index,GLenum type,GLboolean normalized,const GLuint* value)const{ProfilingScope const scope(this,2560);(this->*(this->m_orig_glVertexAttribP2uiv))(index,type,normalized,value);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1I64VARBPROC m_orig_glProgramUniform1i64vARB = nullptr;
+void m_glProgramUniform1i64vARB_profile(GLuint program,GLint location,GLsizei count,const GLint64* value)const{ProfilingScope const scope(this,2561);(this->*(this->m_orig_glProgramUniform1i64vARB))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTUREARBPROC m_orig_glFramebufferTextureARB = nullptr;
+void m_glFramebufferTextureARB_profile(GLenum target,GLenum attachment,GLuint texture,GLint level)const{ProfilingScope const scope(this,2562);(this->*(this->m_orig_glFramebufferTextureARB))(target,attachment,texture,level);}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC m_orig_glPushClientAttribDefaultEXT = nullptr;
+void m_glPushClientAttribDefaultEXT_profile(GLbitfield mask)const{ProfilingScope const scope(this,2563);(this->*(this->m_orig_glPushClientAttribDefaultEXT))(mask);}
+FunctionTable::MEMBERPFNGLSCALEFPROC m_orig_glScalef = nullptr;
+void m_glScalef_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2564);(this->*(this->m_orig_glScalef))(x,y,z);}
+FunctionTable::MEMBERPFNGLSCALEDPROC m_orig_glScaled = nullptr;
+void m_glScaled_profile(GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,2565);(this->*(this->m_orig_glScaled))(x,y,z);}
+FunctionTable::MEMBERPFNGLGETCONVOLUTIONPARAMETERXVOESPROC m_orig_glGetConvolutionParameterxvOES = nullptr;
+void m_glGetConvolutionParameterxvOES_profile(GLenum target,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,2566);(this->*(this->m_orig_glGetConvolutionParameterxvOES))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCENAMEPROC m_orig_glGetProgramResourceName = nullptr;
+void m_glGetProgramResourceName_profile(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name)const{ProfilingScope const scope(this,2567);(this->*(this->m_orig_glGetProgramResourceName))(program,programInterface,index,bufSize,length,name);}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLEPROC m_orig_glCopyColorTable = nullptr;
+void m_glCopyColorTable_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2568);(this->*(this->m_orig_glCopyColorTable))(target,internalformat,x,y,width);}
+FunctionTable::MEMBERPFNGLDEPTHRANGEARRAYVPROC m_orig_glDepthRangeArrayv = nullptr;
+void m_glDepthRangeArrayv_profile(GLuint first,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,2569);(this->*(this->m_orig_glDepthRangeArrayv))(first,count,v);}
+FunctionTable::MEMBERPFNGLCOVERFILLPATHINSTANCEDNVPROC m_orig_glCoverFillPathInstancedNV = nullptr;
+void m_glCoverFillPathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,2570);(this->*(this->m_orig_glCoverFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERIVEXTPROC m_orig_glMultiTexParameterivEXT = nullptr;
+void m_glMultiTexParameterivEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2571);(this->*(this->m_orig_glMultiTexParameterivEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC m_orig_glGetActiveAtomicCounterBufferiv = nullptr;
+void m_glGetActiveAtomicCounterBufferiv_profile(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2572);(this->*(this->m_orig_glGetActiveAtomicCounterBufferiv))(program,bufferIndex,pname,params);}
+FunctionTable::MEMBERPFNGLSTENCILOPSEPARATEPROC m_orig_glStencilOpSeparate = nullptr;
+void m_glStencilOpSeparate_profile(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass)const{ProfilingScope const scope(this,2573);(this->*(this->m_orig_glStencilOpSeparate))(face,sfail,dpfail,dppass);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4FNVPROC m_orig_glVertexAttrib4fNV = nullptr;
+void m_glVertexAttrib4fNV_profile(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,2574);(this->*(this->m_orig_glVertexAttrib4fNV))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVSGIPROC m_orig_glGetColorTableParameterivSGI = nullptr;
+void m_glGetColorTableParameterivSGI_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2575);(this->*(this->m_orig_glGetColorTableParameterivSGI))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBBINDINGPROC m_orig_glVertexArrayAttribBinding = nullptr;
+void m_glVertexArrayAttribBinding_profile(GLuint vaobj,GLuint attribindex,GLuint bindingindex)const{ProfilingScope const scope(this,2576);(this->*(this->m_orig_glVertexArrayAttribBinding))(vaobj,attribindex,bindingindex);}
+FunctionTable::MEMBERPFNGLISSEMAPHOREEXTPROC m_orig_glIsSemaphoreEXT = nullptr;
+GLboolean m_glIsSemaphoreEXT_profile(GLuint semaphore)const{ProfilingScope const scope(this,2577);return (this->*(this->m_orig_glIsSemaphoreEXT))(semaphore);}
+FunctionTable::MEMBERPFNGLPROGRAMPARAMETERS4DVNVPROC m_orig_glProgramParameters4dvNV = nullptr;
+void m_glProgramParameters4dvNV_profile(GLenum target,GLuint index,GLsizei count,const GLdouble* v)const{ProfilingScope const scope(this,2578);(this->*(this->m_orig_glProgramParameters4dvNV))(target,index,count,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBL4DVPROC m_orig_glVertexAttribL4dv = nullptr;
+void m_glVertexAttribL4dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2579);(this->*(this->m_orig_glVertexAttribL4dv))(index,v);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIVPROC m_orig_glGetTexParameteriv = nullptr;
+void m_glGetTexParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2580);(this->*(this->m_orig_glGetTexParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETUNIFORMOFFSETEXTPROC m_orig_glGetUniformOffsetEXT = nullptr;
+GLintptr m_glGetUniformOffsetEXT_profile(GLuint program,GLint location)const{ProfilingScope const scope(this,2581);return (this->*(this->m_orig_glGetUniformOffsetEXT))(program,location);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBPOINTERVPROC m_orig_glGetVertexAttribPointerv = nullptr;
+void m_glGetVertexAttribPointerv_profile(GLuint index,GLenum pname,void** pointer)const{ProfilingScope const scope(this,2582);(this->*(this->m_orig_glGetVertexAttribPointerv))(index,pname,pointer);}
+FunctionTable::MEMBERPFNGLRESUMETRANSFORMFEEDBACKNVPROC m_orig_glResumeTransformFeedbackNV = nullptr;
+void m_glResumeTransformFeedbackNV_profile()const{ProfilingScope const scope(this,2583);(this->*(this->m_orig_glResumeTransformFeedbackNV))();}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64VNVPROC m_orig_glProgramUniform3i64vNV = nullptr;
+void m_glProgramUniform3i64vNV_profile(GLuint program,GLint location,GLsizei count,const GLint64EXT* value)const{ProfilingScope const scope(this,2584);(this->*(this->m_orig_glProgramUniform3i64vNV))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLTANGENT3FEXTPROC m_orig_glTangent3fEXT = nullptr;
+void m_glTangent3fEXT_profile(GLfloat tx,GLfloat ty,GLfloat tz)const{ProfilingScope const scope(this,2585);(this->*(this->m_orig_glTangent3fEXT))(tx,ty,tz);}
+FunctionTable::MEMBERPFNGLGETPATHMETRICRANGENVPROC m_orig_glGetPathMetricRangeNV = nullptr;
+void m_glGetPathMetricRangeNV_profile(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics)const{ProfilingScope const scope(this,2586);(this->*(this->m_orig_glGetPathMetricRangeNV))(metricQueryMask,firstPathName,numPaths,stride,metrics);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2IMESAPROC m_orig_glWindowPos2iMESA = nullptr;
+void m_glWindowPos2iMESA_profile(GLint x,GLint y)const{ProfilingScope const scope(this,2587);(this->*(this->m_orig_glWindowPos2iMESA))(x,y);}
+FunctionTable::MEMBERPFNGLVERTEX2XVOESPROC m_orig_glVertex2xvOES = nullptr;
+void m_glVertex2xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,2588);(this->*(this->m_orig_glVertex2xvOES))(coords);}
+FunctionTable::MEMBERPFNGLGETNCOMPRESSEDTEXIMAGEPROC m_orig_glGetnCompressedTexImage = nullptr;
+void m_glGetnCompressedTexImage_profile(GLenum target,GLint lod,GLsizei bufSize,void* pixels)const{ProfilingScope const scope(this,2589);(this->*(this->m_orig_glGetnCompressedTexImage))(target,lod,bufSize,pixels);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2DVPROC m_orig_glWindowPos2dv = nullptr;
+void m_glWindowPos2dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,2590);(this->*(this->m_orig_glWindowPos2dv))(v);}
+FunctionTable::MEMBERPFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC m_orig_glReplacementCodeuiVertex3fSUN = nullptr;
+void m_glReplacementCodeuiVertex3fSUN_profile(GLuint rc,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2591);(this->*(this->m_orig_glReplacementCodeuiVertex3fSUN))(rc,x,y,z);}
+FunctionTable::MEMBERPFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC m_orig_glGetTransformFeedbackVaryingEXT = nullptr;
+void m_glGetTransformFeedbackVaryingEXT_profile(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name)const{ProfilingScope const scope(this,2592);(this->*(this->m_orig_glGetTransformFeedbackVaryingEXT))(program,index,bufSize,length,size,type,name);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3FARBPROC m_orig_glWindowPos3fARB = nullptr;
+void m_glWindowPos3fARB_profile(GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2593);(this->*(this->m_orig_glWindowPos3fARB))(x,y,z);}
+FunctionTable::MEMBERPFNGLMAPNAMEDBUFFEREXTPROC m_orig_glMapNamedBufferEXT = nullptr;
+void* m_glMapNamedBufferEXT_profile(GLuint buffer,GLenum access)const{ProfilingScope const scope(this,2594);return (this->*(this->m_orig_glMapNamedBufferEXT))(buffer,access);}
+FunctionTable::MEMBERPFNGLDISABLEPROC m_orig_glDisable = nullptr;
+void m_glDisable_profile(GLenum cap)const{ProfilingScope const scope(this,2595);(this->*(this->m_orig_glDisable))(cap);}
+FunctionTable::MEMBERPFNGLISPOINTINFILLPATHNVPROC m_orig_glIsPointInFillPathNV = nullptr;
+GLboolean m_glIsPointInFillPathNV_profile(GLuint path,GLuint mask,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2596);return (this->*(this->m_orig_glIsPointInFillPathNV))(path,mask,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2UIEXTPROC m_orig_glVertexAttribI2uiEXT = nullptr;
+void m_glVertexAttribI2uiEXT_profile(GLuint index,GLuint x,GLuint y)const{ProfilingScope const scope(this,2597);(this->*(this->m_orig_glVertexAttribI2uiEXT))(index,x,y);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4UIVPROC m_orig_glProgramUniform4uiv = nullptr;
+void m_glProgramUniform4uiv_profile(GLuint program,GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,2598);(this->*(this->m_orig_glProgramUniform4uiv))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLQUERYCOUNTERPROC m_orig_glQueryCounter = nullptr;
+void m_glQueryCounter_profile(GLuint id,GLenum target)const{ProfilingScope const scope(this,2599);(this->*(this->m_orig_glQueryCounter))(id,target);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERRENDERBUFFEREXTPROC m_orig_glFramebufferRenderbufferEXT = nullptr;
+void m_glFramebufferRenderbufferEXT_profile(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer)const{ProfilingScope const scope(this,2600);(this->*(this->m_orig_glFramebufferRenderbufferEXT))(target,attachment,renderbuffertarget,renderbuffer);}
+FunctionTable::MEMBERPFNGLBINORMAL3SVEXTPROC m_orig_glBinormal3svEXT = nullptr;
+void m_glBinormal3svEXT_profile(const GLshort* v)const{ProfilingScope const scope(this,2601);(this->*(this->m_orig_glBinormal3svEXT))(v);}
+FunctionTable::MEMBERPFNGLBINDBUFFEROFFSETNVPROC m_orig_glBindBufferOffsetNV = nullptr;
+void m_glBindBufferOffsetNV_profile(GLenum target,GLuint index,GLuint buffer,GLintptr offset)const{ProfilingScope const scope(this,2602);(this->*(this->m_orig_glBindBufferOffsetNV))(target,index,buffer,offset);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE2DPROC m_orig_glCopyTextureSubImage2D = nullptr;
+void m_glCopyTextureSubImage2D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2603);(this->*(this->m_orig_glCopyTextureSubImage2D))(texture,level,xoffset,yoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLGETPROGRAMRESOURCEFVNVPROC m_orig_glGetProgramResourcefvNV = nullptr;
+void m_glGetProgramResourcefvNV_profile(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params)const{ProfilingScope const scope(this,2604);(this->*(this->m_orig_glGetProgramResourcefvNV))(program,programInterface,index,propCount,props,bufSize,length,params);}
+FunctionTable::MEMBERPFNGLBINORMALPOINTEREXTPROC m_orig_glBinormalPointerEXT = nullptr;
+void m_glBinormalPointerEXT_profile(GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2605);(this->*(this->m_orig_glBinormalPointerEXT))(type,stride,pointer);}
+FunctionTable::MEMBERPFNGLGETLIGHTFVPROC m_orig_glGetLightfv = nullptr;
+void m_glGetLightfv_profile(GLenum light,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2606);(this->*(this->m_orig_glGetLightfv))(light,pname,params);}
+FunctionTable::MEMBERPFNGLMULTICASTCOPYIMAGESUBDATANVPROC m_orig_glMulticastCopyImageSubDataNV = nullptr;
+void m_glMulticastCopyImageSubDataNV_profile(GLuint srcGpu,GLbitfield dstGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth)const{ProfilingScope const scope(this,2607);(this->*(this->m_orig_glMulticastCopyImageSubDataNV))(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+FunctionTable::MEMBERPFNGLVERTEX2BOESPROC m_orig_glVertex2bOES = nullptr;
+void m_glVertex2bOES_profile(GLbyte x,GLbyte y)const{ProfilingScope const scope(this,2608);(this->*(this->m_orig_glVertex2bOES))(x,y);}
+FunctionTable::MEMBERPFNGLUNIFORM2IVARBPROC m_orig_glUniform2ivARB = nullptr;
+void m_glUniform2ivARB_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2609);(this->*(this->m_orig_glUniform2ivARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SPROC m_orig_glMultiTexCoord3s = nullptr;
+void m_glMultiTexCoord3s_profile(GLenum target,GLshort s,GLshort t,GLshort r)const{ProfilingScope const scope(this,2610);(this->*(this->m_orig_glMultiTexCoord3s))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLGETHISTOGRAMPARAMETERFVEXTPROC m_orig_glGetHistogramParameterfvEXT = nullptr;
+void m_glGetHistogramParameterfvEXT_profile(GLenum target,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2611);(this->*(this->m_orig_glGetHistogramParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTRINGNVPROC m_orig_glGetProgramStringNV = nullptr;
+void m_glGetProgramStringNV_profile(GLuint id,GLenum pname,GLubyte* program)const{ProfilingScope const scope(this,2612);(this->*(this->m_orig_glGetProgramStringNV))(id,pname,program);}
+FunctionTable::MEMBERPFNGLGETTEXGENXVOESPROC m_orig_glGetTexGenxvOES = nullptr;
+void m_glGetTexGenxvOES_profile(GLenum coord,GLenum pname,GLfixed* params)const{ProfilingScope const scope(this,2613);(this->*(this->m_orig_glGetTexGenxvOES))(coord,pname,params);}
+FunctionTable::MEMBERPFNGLTEXTURESUBIMAGE2DPROC m_orig_glTextureSubImage2D = nullptr;
+void m_glTextureSubImage2D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2614);(this->*(this->m_orig_glTextureSubImage2D))(texture,level,xoffset,yoffset,width,height,format,type,pixels);}
+FunctionTable::MEMBERPFNGLOBJECTPURGEABLEAPPLEPROC m_orig_glObjectPurgeableAPPLE = nullptr;
+GLenum m_glObjectPurgeableAPPLE_profile(GLenum objectType,GLuint name,GLenum option)const{ProfilingScope const scope(this,2615);return (this->*(this->m_orig_glObjectPurgeableAPPLE))(objectType,name,option);}
+FunctionTable::MEMBERPFNGLCOLORTABLESGIPROC m_orig_glColorTableSGI = nullptr;
+void m_glColorTableSGI_profile(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table)const{ProfilingScope const scope(this,2616);(this->*(this->m_orig_glColorTableSGI))(target,internalformat,width,format,type,table);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DEXTPROC m_orig_glCopyConvolutionFilter2DEXT = nullptr;
+void m_glCopyConvolutionFilter2DEXT_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2617);(this->*(this->m_orig_glCopyConvolutionFilter2DEXT))(target,internalformat,x,y,width,height);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3FPROC m_orig_glMultiTexCoord3f = nullptr;
+void m_glMultiTexCoord3f_profile(GLenum target,GLfloat s,GLfloat t,GLfloat r)const{ProfilingScope const scope(this,2618);(this->*(this->m_orig_glMultiTexCoord3f))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3DPROC m_orig_glMultiTexCoord3d = nullptr;
+void m_glMultiTexCoord3d_profile(GLenum target,GLdouble s,GLdouble t,GLdouble r)const{ProfilingScope const scope(this,2619);(this->*(this->m_orig_glMultiTexCoord3d))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLFOGCOORDDVPROC m_orig_glFogCoorddv = nullptr;
+void m_glFogCoorddv_profile(const GLdouble* coord)const{ProfilingScope const scope(this,2620);(this->*(this->m_orig_glFogCoorddv))(coord);}
+FunctionTable::MEMBERPFNGLGETBUFFERPOINTERVPROC m_orig_glGetBufferPointerv = nullptr;
+void m_glGetBufferPointerv_profile(GLenum target,GLenum pname,void** params)const{ProfilingScope const scope(this,2621);(this->*(this->m_orig_glGetBufferPointerv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM1FEXTPROC m_orig_glProgramUniform1fEXT = nullptr;
+void m_glProgramUniform1fEXT_profile(GLuint program,GLint location,GLfloat v0)const{ProfilingScope const scope(this,2622);(this->*(this->m_orig_glProgramUniform1fEXT))(program,location,v0);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FVMESAPROC m_orig_glWindowPos2fvMESA = nullptr;
+void m_glWindowPos2fvMESA_profile(const GLfloat* v)const{ProfilingScope const scope(this,2623);(this->*(this->m_orig_glWindowPos2fvMESA))(v);}
+FunctionTable::MEMBERPFNGLALPHATOCOVERAGEDITHERCONTROLNVPROC m_orig_glAlphaToCoverageDitherControlNV = nullptr;
+void m_glAlphaToCoverageDitherControlNV_profile(GLenum mode)const{ProfilingScope const scope(this,2624);(this->*(this->m_orig_glAlphaToCoverageDitherControlNV))(mode);}
+FunctionTable::MEMBERPFNGLPOLYGONOFFSETXOESPROC m_orig_glPolygonOffsetxOES = nullptr;
+void m_glPolygonOffsetxOES_profile(GLfixed factor,GLfixed units)const{ProfilingScope const scope(this,2625);(this->*(this->m_orig_glPolygonOffsetxOES))(factor,units);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4DARBPROC m_orig_glVertexAttrib4dARB = nullptr;
+void m_glVertexAttrib4dARB_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2626);(this->*(this->m_orig_glVertexAttrib4dARB))(index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLUNIFORMHANDLEUI64VARBPROC m_orig_glUniformHandleui64vARB = nullptr;
+void m_glUniformHandleui64vARB_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,2627);(this->*(this->m_orig_glUniformHandleui64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLFRAGMENTLIGHTMODELFVSGIXPROC m_orig_glFragmentLightModelfvSGIX = nullptr;
+void m_glFragmentLightModelfvSGIX_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2628);(this->*(this->m_orig_glFragmentLightModelfvSGIX))(pname,params);}
+FunctionTable::MEMBERPFNGLSWIZZLEEXTPROC m_orig_glSwizzleEXT = nullptr;
+void m_glSwizzleEXT_profile(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW)const{ProfilingScope const scope(this,2629);(this->*(this->m_orig_glSwizzleEXT))(res,in,outX,outY,outZ,outW);}
+FunctionTable::MEMBERPFNGLBINDFRAGMENTSHADERATIPROC m_orig_glBindFragmentShaderATI = nullptr;
+void m_glBindFragmentShaderATI_profile(GLuint id)const{ProfilingScope const scope(this,2630);(this->*(this->m_orig_glBindFragmentShaderATI))(id);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS3HVNVPROC m_orig_glVertexAttribs3hvNV = nullptr;
+void m_glVertexAttribs3hvNV_profile(GLuint index,GLsizei n,const GLhalfNV* v)const{ProfilingScope const scope(this,2631);(this->*(this->m_orig_glVertexAttribs3hvNV))(index,n,v);}
+FunctionTable::MEMBERPFNGLGENBUFFERSARBPROC m_orig_glGenBuffersARB = nullptr;
+void m_glGenBuffersARB_profile(GLsizei n,GLuint* buffers)const{ProfilingScope const scope(this,2632);(this->*(this->m_orig_glGenBuffersARB))(n,buffers);}
+FunctionTable::MEMBERPFNGLTEXTURESTORAGEMEM2DMULTISAMPLEEXTPROC m_orig_glTextureStorageMem2DMultisampleEXT = nullptr;
+void m_glTextureStorageMem2DMultisampleEXT_profile(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2633);(this->*(this->m_orig_glTextureStorageMem2DMultisampleEXT))(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+FunctionTable::MEMBERPFNGLLISTPARAMETERFVSGIXPROC m_orig_glListParameterfvSGIX = nullptr;
+void m_glListParameterfvSGIX_profile(GLuint list,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2634);(this->*(this->m_orig_glListParameterfvSGIX))(list,pname,params);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC m_orig_glNamedRenderbufferStorageMultisample = nullptr;
+void m_glNamedRenderbufferStorageMultisample_profile(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2635);(this->*(this->m_orig_glNamedRenderbufferStorageMultisample))(renderbuffer,samples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IEXTPROC m_orig_glVertexAttribI1iEXT = nullptr;
+void m_glVertexAttribI1iEXT_profile(GLuint index,GLint x)const{ProfilingScope const scope(this,2636);(this->*(this->m_orig_glVertexAttribI1iEXT))(index,x);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2IVARBPROC m_orig_glMultiTexCoord2ivARB = nullptr;
+void m_glMultiTexCoord2ivARB_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,2637);(this->*(this->m_orig_glMultiTexCoord2ivARB))(target,v);}
+FunctionTable::MEMBERPFNGLLIGHTMODELXOESPROC m_orig_glLightModelxOES = nullptr;
+void m_glLightModelxOES_profile(GLenum pname,GLfixed param)const{ProfilingScope const scope(this,2638);(this->*(this->m_orig_glLightModelxOES))(pname,param);}
+FunctionTable::MEMBERPFNGLCOLOR3XOESPROC m_orig_glColor3xOES = nullptr;
+void m_glColor3xOES_profile(GLfixed red,GLfixed green,GLfixed blue)const{ProfilingScope const scope(this,2639);(this->*(this->m_orig_glColor3xOES))(red,green,blue);}
+FunctionTable::MEMBERPFNGLREADBUFFERPROC m_orig_glReadBuffer = nullptr;
+void m_glReadBuffer_profile(GLenum mode)const{ProfilingScope const scope(this,2640);(this->*(this->m_orig_glReadBuffer))(mode);}
+FunctionTable::MEMBERPFNGLSTENCILFILLPATHINSTANCEDNVPROC m_orig_glStencilFillPathInstancedNV = nullptr;
+void m_glStencilFillPathInstancedNV_profile(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues)const{ProfilingScope const scope(this,2641);(this->*(this->m_orig_glStencilFillPathInstancedNV))(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);}
+FunctionTable::MEMBERPFNGLVDPAUUNMAPSURFACESNVPROC m_orig_glVDPAUUnmapSurfacesNV = nullptr;
+void m_glVDPAUUnmapSurfacesNV_profile(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces)const{ProfilingScope const scope(this,2642);(this->*(this->m_orig_glVDPAUUnmapSurfacesNV))(numSurface,surfaces);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM4I64NVPROC m_orig_glProgramUniform4i64NV = nullptr;
+void m_glProgramUniform4i64NV_profile(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w)const{ProfilingScope const scope(this,2643);(this->*(this->m_orig_glProgramUniform4i64NV))(program,location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM4DVATIPROC m_orig_glVertexStream4dvATI = nullptr;
+void m_glVertexStream4dvATI_profile(GLenum stream,const GLdouble* coords)const{ProfilingScope const scope(this,2644);(this->*(this->m_orig_glVertexStream4dvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLISQUERYPROC m_orig_glIsQuery = nullptr;
+GLboolean m_glIsQuery_profile(GLuint id)const{ProfilingScope const scope(this,2645);return (this->*(this->m_orig_glIsQuery))(id);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC m_orig_glProgramUniformMatrix4fvEXT = nullptr;
+void m_glProgramUniformMatrix4fvEXT_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2646);(this->*(this->m_orig_glProgramUniformMatrix4fvEXT))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3HNVPROC m_orig_glVertexAttrib3hNV = nullptr;
+void m_glVertexAttrib3hNV_profile(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z)const{ProfilingScope const scope(this,2647);(this->*(this->m_orig_glVertexAttrib3hNV))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC m_orig_glFlushMappedNamedBufferRange = nullptr;
+void m_glFlushMappedNamedBufferRange_profile(GLuint buffer,GLintptr offset,GLsizeiptr length)const{ProfilingScope const scope(this,2648);(this->*(this->m_orig_glFlushMappedNamedBufferRange))(buffer,offset,length);}
+FunctionTable::MEMBERPFNGLPUSHNAMEPROC m_orig_glPushName = nullptr;
+void m_glPushName_profile(GLuint name)const{ProfilingScope const scope(this,2649);(this->*(this->m_orig_glPushName))(name);}
+FunctionTable::MEMBERPFNGLGETCLIPPLANEPROC m_orig_glGetClipPlane = nullptr;
+void m_glGetClipPlane_profile(GLenum plane,GLdouble* equation)const{ProfilingScope const scope(this,2650);(this->*(this->m_orig_glGetClipPlane))(plane,equation);}
+FunctionTable::MEMBERPFNGLVERTEX4DVPROC m_orig_glVertex4dv = nullptr;
+void m_glVertex4dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,2651);(this->*(this->m_orig_glVertex4dv))(v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DPROC m_orig_glVertexAttrib3d = nullptr;
+void m_glVertexAttrib3d_profile(GLuint index,GLdouble x,GLdouble y,GLdouble z)const{ProfilingScope const scope(this,2652);(this->*(this->m_orig_glVertexAttrib3d))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLBLENDCOLORPROC m_orig_glBlendColor = nullptr;
+void m_glBlendColor_profile(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha)const{ProfilingScope const scope(this,2653);(this->*(this->m_orig_glBlendColor))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLBINDTRANSFORMFEEDBACKNVPROC m_orig_glBindTransformFeedbackNV = nullptr;
+void m_glBindTransformFeedbackNV_profile(GLenum target,GLuint id)const{ProfilingScope const scope(this,2654);(this->*(this->m_orig_glBindTransformFeedbackNV))(target,id);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERIUIVPROC m_orig_glSamplerParameterIuiv = nullptr;
+void m_glSamplerParameterIuiv_profile(GLuint sampler,GLenum pname,const GLuint* param)const{ProfilingScope const scope(this,2655);(this->*(this->m_orig_glSamplerParameterIuiv))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLINDEXUBVPROC m_orig_glIndexubv = nullptr;
+void m_glIndexubv_profile(const GLubyte* c)const{ProfilingScope const scope(this,2656);(this->*(this->m_orig_glIndexubv))(c);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERPAGECOMMITMENTEXTPROC m_orig_glNamedBufferPageCommitmentEXT = nullptr;
+void m_glNamedBufferPageCommitmentEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit)const{ProfilingScope const scope(this,2657);(this->*(this->m_orig_glNamedBufferPageCommitmentEXT))(buffer,offset,size,commit);}
+FunctionTable::MEMBERPFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC m_orig_glCheckNamedFramebufferStatus = nullptr;
+GLenum m_glCheckNamedFramebufferStatus_profile(GLuint framebuffer,GLenum target)const{ProfilingScope const scope(this,2658);return (this->*(this->m_orig_glCheckNamedFramebufferStatus))(framebuffer,target);}
+FunctionTable::MEMBERPFNGLGETOBJECTBUFFERFVATIPROC m_orig_glGetObjectBufferfvATI = nullptr;
+void m_glGetObjectBufferfvATI_profile(GLuint buffer,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2659);(this->*(this->m_orig_glGetObjectBufferfvATI))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLRASTERPOS4DPROC m_orig_glRasterPos4d = nullptr;
+void m_glRasterPos4d_profile(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2660);(this->*(this->m_orig_glRasterPos4d))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLRASTERPOS4FPROC m_orig_glRasterPos4f = nullptr;
+void m_glRasterPos4f_profile(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,2661);(this->*(this->m_orig_glRasterPos4f))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC m_orig_glGetPerfMonitorCounterStringAMD = nullptr;
+void m_glGetPerfMonitorCounterStringAMD_profile(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString)const{ProfilingScope const scope(this,2662);(this->*(this->m_orig_glGetPerfMonitorCounterStringAMD))(group,counter,bufSize,length,counterString);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SPROC m_orig_glVertexAttrib3s = nullptr;
+void m_glVertexAttrib3s_profile(GLuint index,GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,2663);(this->*(this->m_orig_glVertexAttrib3s))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDEXTPROC m_orig_glDrawElementsInstancedEXT = nullptr;
+void m_glDrawElementsInstancedEXT_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount)const{ProfilingScope const scope(this,2664);(this->*(this->m_orig_glDrawElementsInstancedEXT))(mode,count,type,indices,primcount);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC m_orig_glNamedProgramLocalParameterI4iEXT = nullptr;
+void m_glNamedProgramLocalParameterI4iEXT_profile(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w)const{ProfilingScope const scope(this,2665);(this->*(this->m_orig_glNamedProgramLocalParameterI4iEXT))(program,target,index,x,y,z,w);}
+FunctionTable::MEMBERPFNGLRASTERPOS4SPROC m_orig_glRasterPos4s = nullptr;
+void m_glRasterPos4s_profile(GLshort x,GLshort y,GLshort z,GLshort w)const{ProfilingScope const scope(this,2666);(this->*(this->m_orig_glRasterPos4s))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLGETPROGRAMSTAGEIVPROC m_orig_glGetProgramStageiv = nullptr;
+void m_glGetProgramStageiv_profile(GLuint program,GLenum shadertype,GLenum pname,GLint* values)const{ProfilingScope const scope(this,2667);(this->*(this->m_orig_glGetProgramStageiv))(program,shadertype,pname,values);}
+FunctionTable::MEMBERPFNGLGETMATERIALXOESPROC m_orig_glGetMaterialxOES = nullptr;
+void m_glGetMaterialxOES_profile(GLenum face,GLenum pname,GLfixed param)const{ProfilingScope const scope(this,2668);(this->*(this->m_orig_glGetMaterialxOES))(face,pname,param);}
+FunctionTable::MEMBERPFNGLPOPMATRIXPROC m_orig_glPopMatrix = nullptr;
+void m_glPopMatrix_profile()const{ProfilingScope const scope(this,2669);(this->*(this->m_orig_glPopMatrix))();}
+FunctionTable::MEMBERPFNGLGETVIDEOUI64VNVPROC m_orig_glGetVideoui64vNV = nullptr;
+void m_glGetVideoui64vNV_profile(GLuint video_slot,GLenum pname,GLuint64EXT* params)const{ProfilingScope const scope(this,2670);(this->*(this->m_orig_glGetVideoui64vNV))(video_slot,pname,params);}
+FunctionTable::MEMBERPFNGLTANGENT3BEXTPROC m_orig_glTangent3bEXT = nullptr;
+void m_glTangent3bEXT_profile(GLbyte tx,GLbyte ty,GLbyte tz)const{ProfilingScope const scope(this,2671);(this->*(this->m_orig_glTangent3bEXT))(tx,ty,tz);}
+FunctionTable::MEMBERPFNGLGETGRAPHICSRESETSTATUSARBPROC m_orig_glGetGraphicsResetStatusARB = nullptr;
+GLenum m_glGetGraphicsResetStatusARB_profile()const{ProfilingScope const scope(this,2672);return (this->*(this->m_orig_glGetGraphicsResetStatusARB))();}
+FunctionTable::MEMBERPFNGLUNIFORM4IPROC m_orig_glUniform4i = nullptr;
+void m_glUniform4i_profile(GLint location,GLint v0,GLint v1,GLint v2,GLint v3)const{ProfilingScope const scope(this,2673);(this->*(this->m_orig_glUniform4i))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREPROC m_orig_glActiveTexture = nullptr;
+void m_glActiveTexture_profile(GLenum texture)const{ProfilingScope const scope(this,2674);(this->*(this->m_orig_glActiveTexture))(texture);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBARRAYPROC m_orig_glEnableVertexAttribArray = nullptr;
+void m_glEnableVertexAttribArray_profile(GLuint index)const{ProfilingScope const scope(this,2675);(this->*(this->m_orig_glEnableVertexAttribArray))(index);}
+FunctionTable::MEMBERPFNGLTEXCOORD4FVERTEX4FVSUNPROC m_orig_glTexCoord4fVertex4fvSUN = nullptr;
+void m_glTexCoord4fVertex4fvSUN_profile(const GLfloat* tc,const GLfloat* v)const{ProfilingScope const scope(this,2676);(this->*(this->m_orig_glTexCoord4fVertex4fvSUN))(tc,v);}
+FunctionTable::MEMBERPFNGLUNIFORM4DPROC m_orig_glUniform4d = nullptr;
+void m_glUniform4d_profile(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2677);(this->*(this->m_orig_glUniform4d))(location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLUNIFORM4FPROC m_orig_glUniform4f = nullptr;
+void m_glUniform4f_profile(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{ProfilingScope const scope(this,2678);(this->*(this->m_orig_glUniform4f))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC m_orig_glRenderbufferStorageMultisample = nullptr;
+void m_glRenderbufferStorageMultisample_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2679);(this->*(this->m_orig_glRenderbufferStorageMultisample))(target,samples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPIPELINESPROC m_orig_glCreateProgramPipelines = nullptr;
+void m_glCreateProgramPipelines_profile(GLsizei n,GLuint* pipelines)const{ProfilingScope const scope(this,2680);(this->*(this->m_orig_glCreateProgramPipelines))(n,pipelines);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBLPOINTERPROC m_orig_glVertexAttribLPointer = nullptr;
+void m_glVertexAttribLPointer_profile(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2681);(this->*(this->m_orig_glVertexAttribLPointer))(index,size,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLUNIFORM2UIEXTPROC m_orig_glUniform2uiEXT = nullptr;
+void m_glUniform2uiEXT_profile(GLint location,GLuint v0,GLuint v1)const{ProfilingScope const scope(this,2682);(this->*(this->m_orig_glUniform2uiEXT))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3SVPROC m_orig_glMultiTexCoord3sv = nullptr;
+void m_glMultiTexCoord3sv_profile(GLenum target,const GLshort* v)const{ProfilingScope const scope(this,2683);(this->*(this->m_orig_glMultiTexCoord3sv))(target,v);}
+FunctionTable::MEMBERPFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC m_orig_glDrawElementsInstancedBaseVertex = nullptr;
+void m_glDrawElementsInstancedBaseVertex_profile(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex)const{ProfilingScope const scope(this,2684);(this->*(this->m_orig_glDrawElementsInstancedBaseVertex))(mode,count,type,indices,instancecount,basevertex);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFVEXTPROC m_orig_glPixelTransformParameterfvEXT = nullptr;
+void m_glPixelTransformParameterfvEXT_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2685);(this->*(this->m_orig_glPixelTransformParameterfvEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLDRAWTRANSFORMFEEDBACKNVPROC m_orig_glDrawTransformFeedbackNV = nullptr;
+void m_glDrawTransformFeedbackNV_profile(GLenum mode,GLuint id)const{ProfilingScope const scope(this,2686);(this->*(this->m_orig_glDrawTransformFeedbackNV))(mode,id);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC m_orig_glTextureImage2DMultisampleCoverageNV = nullptr;
+void m_glTextureImage2DMultisampleCoverageNV_profile(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,2687);(this->*(this->m_orig_glTextureImage2DMultisampleCoverageNV))(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT = nullptr;
+void m_glNamedRenderbufferStorageMultisampleCoverageEXT_profile(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2688);(this->*(this->m_orig_glNamedRenderbufferStorageMultisampleCoverageEXT))(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);}
+FunctionTable::MEMBERPFNGLISTEXTUREPROC m_orig_glIsTexture = nullptr;
+GLboolean m_glIsTexture_profile(GLuint texture)const{ProfilingScope const scope(this,2689);return (this->*(this->m_orig_glIsTexture))(texture);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4IVPROC m_orig_glMultiTexCoord4iv = nullptr;
+void m_glMultiTexCoord4iv_profile(GLenum target,const GLint* v)const{ProfilingScope const scope(this,2690);(this->*(this->m_orig_glMultiTexCoord4iv))(target,v);}
+FunctionTable::MEMBERPFNGLTEXENVFVPROC m_orig_glTexEnvfv = nullptr;
+void m_glTexEnvfv_profile(GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2691);(this->*(this->m_orig_glTexEnvfv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLPOPDEBUGGROUPPROC m_orig_glPopDebugGroup = nullptr;
+void m_glPopDebugGroup_profile()const{ProfilingScope const scope(this,2692);(this->*(this->m_orig_glPopDebugGroup))();}
+FunctionTable::MEMBERPFNGLUNIFORMBLOCKBINDINGPROC m_orig_glUniformBlockBinding = nullptr;
+void m_glUniformBlockBinding_profile(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding)const{ProfilingScope const scope(this,2693);(this->*(this->m_orig_glUniformBlockBinding))(program,uniformBlockIndex,uniformBlockBinding);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2SVMESAPROC m_orig_glWindowPos2svMESA = nullptr;
+void m_glWindowPos2svMESA_profile(const GLshort* v)const{ProfilingScope const scope(this,2694);(this->*(this->m_orig_glWindowPos2svMESA))(v);}
+FunctionTable::MEMBERPFNGLGENERATETEXTUREMIPMAPEXTPROC m_orig_glGenerateTextureMipmapEXT = nullptr;
+void m_glGenerateTextureMipmapEXT_profile(GLuint texture,GLenum target)const{ProfilingScope const scope(this,2695);(this->*(this->m_orig_glGenerateTextureMipmapEXT))(texture,target);}
+FunctionTable::MEMBERPFNGLBINDLIGHTPARAMETEREXTPROC m_orig_glBindLightParameterEXT = nullptr;
+GLuint m_glBindLightParameterEXT_profile(GLenum light,GLenum value)const{ProfilingScope const scope(this,2696);return (this->*(this->m_orig_glBindLightParameterEXT))(light,value);}
+FunctionTable::MEMBERPFNGLTEXCOORD3BOESPROC m_orig_glTexCoord3bOES = nullptr;
+void m_glTexCoord3bOES_profile(GLbyte s,GLbyte t,GLbyte r)const{ProfilingScope const scope(this,2697);(this->*(this->m_orig_glTexCoord3bOES))(s,t,r);}
+FunctionTable::MEMBERPFNGLTEXCOORDPOINTERPROC m_orig_glTexCoordPointer = nullptr;
+void m_glTexCoordPointer_profile(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr)const{ProfilingScope const scope(this,2698);(this->*(this->m_orig_glTexCoordPointer))(size,type,stride,ptr);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX3X2FVPROC m_orig_glProgramUniformMatrix3x2fv = nullptr;
+void m_glProgramUniformMatrix3x2fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2699);(this->*(this->m_orig_glProgramUniformMatrix3x2fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLUNIFORM2FVARBPROC m_orig_glUniform2fvARB = nullptr;
+void m_glUniform2fvARB_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2700);(this->*(this->m_orig_glUniform2fvARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC m_orig_glProgramLocalParameterI4uivNV = nullptr;
+void m_glProgramLocalParameterI4uivNV_profile(GLenum target,GLuint index,const GLuint* params)const{ProfilingScope const scope(this,2701);(this->*(this->m_orig_glProgramLocalParameterI4uivNV))(target,index,params);}
+FunctionTable::MEMBERPFNGLFLUSHVERTEXARRAYRANGENVPROC m_orig_glFlushVertexArrayRangeNV = nullptr;
+void m_glFlushVertexArrayRangeNV_profile()const{ProfilingScope const scope(this,2702);(this->*(this->m_orig_glFlushVertexArrayRangeNV))();}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3SVEXTPROC m_orig_glSecondaryColor3svEXT = nullptr;
+void m_glSecondaryColor3svEXT_profile(const GLshort* v)const{ProfilingScope const scope(this,2703);(this->*(this->m_orig_glSecondaryColor3svEXT))(v);}
+FunctionTable::MEMBERPFNGLGETBUFFERPARAMETERIVPROC m_orig_glGetBufferParameteriv = nullptr;
+void m_glGetBufferParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2704);(this->*(this->m_orig_glGetBufferParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETQUERYINDEXEDIVPROC m_orig_glGetQueryIndexediv = nullptr;
+void m_glGetQueryIndexediv_profile(GLenum target,GLuint index,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2705);(this->*(this->m_orig_glGetQueryIndexediv))(target,index,pname,params);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DEXTPROC m_orig_glFramebufferTexture3DEXT = nullptr;
+void m_glFramebufferTexture3DEXT_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{ProfilingScope const scope(this,2706);(this->*(this->m_orig_glFramebufferTexture3DEXT))(target,attachment,textarget,texture,level,zoffset);}
+FunctionTable::MEMBERPFNGLLOADTRANSPOSEMATRIXXOESPROC m_orig_glLoadTransposeMatrixxOES = nullptr;
+void m_glLoadTransposeMatrixxOES_profile(const GLfixed* m)const{ProfilingScope const scope(this,2707);(this->*(this->m_orig_glLoadTransposeMatrixxOES))(m);}
+FunctionTable::MEMBERPFNGLDELETETRANSFORMFEEDBACKSNVPROC m_orig_glDeleteTransformFeedbacksNV = nullptr;
+void m_glDeleteTransformFeedbacksNV_profile(GLsizei n,const GLuint* ids)const{ProfilingScope const scope(this,2708);(this->*(this->m_orig_glDeleteTransformFeedbacksNV))(n,ids);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC m_orig_glGetCompressedTextureImageEXT = nullptr;
+void m_glGetCompressedTextureImageEXT_profile(GLuint texture,GLenum target,GLint lod,void* img)const{ProfilingScope const scope(this,2709);(this->*(this->m_orig_glGetCompressedTextureImageEXT))(texture,target,lod,img);}
+FunctionTable::MEMBERPFNGLINDEXMATERIALEXTPROC m_orig_glIndexMaterialEXT = nullptr;
+void m_glIndexMaterialEXT_profile(GLenum face,GLenum mode)const{ProfilingScope const scope(this,2710);(this->*(this->m_orig_glIndexMaterialEXT))(face,mode);}
+FunctionTable::MEMBERPFNGLFOGCOORDDEXTPROC m_orig_glFogCoorddEXT = nullptr;
+void m_glFogCoorddEXT_profile(GLdouble coord)const{ProfilingScope const scope(this,2711);(this->*(this->m_orig_glFogCoorddEXT))(coord);}
+FunctionTable::MEMBERPFNGLTEXCOORD2HVNVPROC m_orig_glTexCoord2hvNV = nullptr;
+void m_glTexCoord2hvNV_profile(const GLhalfNV* v)const{ProfilingScope const scope(this,2712);(this->*(this->m_orig_glTexCoord2hvNV))(v);}
+FunctionTable::MEMBERPFNGLGETFRAMEBUFFERPARAMETERFVAMDPROC m_orig_glGetFramebufferParameterfvAMD = nullptr;
+void m_glGetFramebufferParameterfvAMD_profile(GLenum target,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values)const{ProfilingScope const scope(this,2713);(this->*(this->m_orig_glGetFramebufferParameterfvAMD))(target,pname,numsamples,pixelindex,size,values);}
+FunctionTable::MEMBERPFNGLTEXENVIVPROC m_orig_glTexEnviv = nullptr;
+void m_glTexEnviv_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2714);(this->*(this->m_orig_glTexEnviv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKNVPROC m_orig_glEndTransformFeedbackNV = nullptr;
+void m_glEndTransformFeedbackNV_profile()const{ProfilingScope const scope(this,2715);(this->*(this->m_orig_glEndTransformFeedbackNV))();}
+FunctionTable::MEMBERPFNGLGLOBALALPHAFACTORUISUNPROC m_orig_glGlobalAlphaFactoruiSUN = nullptr;
+void m_glGlobalAlphaFactoruiSUN_profile(GLuint factor)const{ProfilingScope const scope(this,2716);(this->*(this->m_orig_glGlobalAlphaFactoruiSUN))(factor);}
+FunctionTable::MEMBERPFNGLSELECTBUFFERPROC m_orig_glSelectBuffer = nullptr;
+void m_glSelectBuffer_profile(GLsizei size,GLuint* buffer)const{ProfilingScope const scope(this,2717);(this->*(this->m_orig_glSelectBuffer))(size,buffer);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSUBDATAEXTPROC m_orig_glNamedBufferSubDataEXT = nullptr;
+void m_glNamedBufferSubDataEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{ProfilingScope const scope(this,2718);(this->*(this->m_orig_glNamedBufferSubDataEXT))(buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLDISABLEVERTEXARRAYATTRIBPROC m_orig_glDisableVertexArrayAttrib = nullptr;
+void m_glDisableVertexArrayAttrib_profile(GLuint vaobj,GLuint index)const{ProfilingScope const scope(this,2719);(this->*(this->m_orig_glDisableVertexArrayAttrib))(vaobj,index);}
+FunctionTable::MEMBERPFNGLBLENDFUNCPROC m_orig_glBlendFunc = nullptr;
+void m_glBlendFunc_profile(GLenum sfactor,GLenum dfactor)const{ProfilingScope const scope(this,2720);(this->*(this->m_orig_glBlendFunc))(sfactor,dfactor);}
+FunctionTable::MEMBERPFNGLCREATEPROGRAMPROC m_orig_glCreateProgram = nullptr;
+GLuint m_glCreateProgram_profile()const{ProfilingScope const scope(this,2721);return (this->*(this->m_orig_glCreateProgram))();}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM2DATIPROC m_orig_glVertexStream2dATI = nullptr;
+void m_glVertexStream2dATI_profile(GLenum stream,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,2722);(this->*(this->m_orig_glVertexStream2dATI))(stream,x,y);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64VARBPROC m_orig_glUniform4ui64vARB = nullptr;
+void m_glUniform4ui64vARB_profile(GLint location,GLsizei count,const GLuint64* value)const{ProfilingScope const scope(this,2723);(this->*(this->m_orig_glUniform4ui64vARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLGETSEMAPHOREPARAMETERUI64VEXTPROC m_orig_glGetSemaphoreParameterui64vEXT = nullptr;
+void m_glGetSemaphoreParameterui64vEXT_profile(GLuint semaphore,GLenum pname,GLuint64* params)const{ProfilingScope const scope(this,2724);(this->*(this->m_orig_glGetSemaphoreParameterui64vEXT))(semaphore,pname,params);}
+FunctionTable::MEMBERPFNGLPRIMITIVERESTARTINDEXPROC m_orig_glPrimitiveRestartIndex = nullptr;
+void m_glPrimitiveRestartIndex_profile(GLuint index)const{ProfilingScope const scope(this,2725);(this->*(this->m_orig_glPrimitiveRestartIndex))(index);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3FATIPROC m_orig_glNormalStream3fATI = nullptr;
+void m_glNormalStream3fATI_profile(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz)const{ProfilingScope const scope(this,2726);(this->*(this->m_orig_glNormalStream3fATI))(stream,nx,ny,nz);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX2FVPROC m_orig_glProgramUniformMatrix2fv = nullptr;
+void m_glProgramUniformMatrix2fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2727);(this->*(this->m_orig_glProgramUniformMatrix2fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBS1HVNVPROC m_orig_glVertexAttribs1hvNV = nullptr;
+void m_glVertexAttribs1hvNV_profile(GLuint index,GLsizei n,const GLhalfNV* v)const{ProfilingScope const scope(this,2728);(this->*(this->m_orig_glVertexAttribs1hvNV))(index,n,v);}
+FunctionTable::MEMBERPFNGLWINDOWPOS4SVMESAPROC m_orig_glWindowPos4svMESA = nullptr;
+void m_glWindowPos4svMESA_profile(const GLshort* v)const{ProfilingScope const scope(this,2729);(this->*(this->m_orig_glWindowPos4svMESA))(v);}
+FunctionTable::MEMBERPFNGLDELETEFRAGMENTSHADERATIPROC m_orig_glDeleteFragmentShaderATI = nullptr;
+void m_glDeleteFragmentShaderATI_profile(GLuint id)const{ProfilingScope const scope(this,2730);(this->*(this->m_orig_glDeleteFragmentShaderATI))(id);}
+FunctionTable::MEMBERPFNGLBINDIMAGETEXTURESPROC m_orig_glBindImageTextures = nullptr;
+void m_glBindImageTextures_profile(GLuint first,GLsizei count,const GLuint* textures)const{ProfilingScope const scope(this,2731);(this->*(this->m_orig_glBindImageTextures))(first,count,textures);}
+FunctionTable::MEMBERPFNGLMAP2XOESPROC m_orig_glMap2xOES = nullptr;
+void m_glMap2xOES_profile(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points)const{ProfilingScope const scope(this,2732);(this->*(this->m_orig_glMap2xOES))(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+FunctionTable::MEMBERPFNGLENDPROC m_orig_glEnd = nullptr;
+void m_glEnd_profile()const{ProfilingScope const scope(this,2733);(this->*(this->m_orig_glEnd))();}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2DARBPROC m_orig_glMultiTexCoord2dARB = nullptr;
+void m_glMultiTexCoord2dARB_profile(GLenum target,GLdouble s,GLdouble t)const{ProfilingScope const scope(this,2734);(this->*(this->m_orig_glMultiTexCoord2dARB))(target,s,t);}
+FunctionTable::MEMBERPFNGLUNIFORM1I64NVPROC m_orig_glUniform1i64NV = nullptr;
+void m_glUniform1i64NV_profile(GLint location,GLint64EXT x)const{ProfilingScope const scope(this,2735);(this->*(this->m_orig_glUniform1i64NV))(location,x);}
+FunctionTable::MEMBERPFNGLPATHSTRINGNVPROC m_orig_glPathStringNV = nullptr;
+void m_glPathStringNV_profile(GLuint path,GLenum format,GLsizei length,const void* pathString)const{ProfilingScope const scope(this,2736);(this->*(this->m_orig_glPathStringNV))(path,format,length,pathString);}
+FunctionTable::MEMBERPFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC m_orig_glGetNamedFramebufferParameterivEXT = nullptr;
+void m_glGetNamedFramebufferParameterivEXT_profile(GLuint framebuffer,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2737);(this->*(this->m_orig_glGetNamedFramebufferParameterivEXT))(framebuffer,pname,params);}
+FunctionTable::MEMBERPFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC m_orig_glGetProgramNamedParameterdvNV = nullptr;
+void m_glGetProgramNamedParameterdvNV_profile(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params)const{ProfilingScope const scope(this,2738);(this->*(this->m_orig_glGetProgramNamedParameterdvNV))(id,len,name,params);}
+FunctionTable::MEMBERPFNGLPATHDASHARRAYNVPROC m_orig_glPathDashArrayNV = nullptr;
+void m_glPathDashArrayNV_profile(GLuint path,GLsizei dashCount,const GLfloat* dashArray)const{ProfilingScope const scope(this,2739);(this->*(this->m_orig_glPathDashArrayNV))(path,dashCount,dashArray);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIVPROC m_orig_glUniform3uiv = nullptr;
+void m_glUniform3uiv_profile(GLint location,GLsizei count,const GLuint* value)const{ProfilingScope const scope(this,2740);(this->*(this->m_orig_glUniform3uiv))(location,count,value);}
+FunctionTable::MEMBERPFNGLCOLOR3FVERTEX3FVSUNPROC m_orig_glColor3fVertex3fvSUN = nullptr;
+void m_glColor3fVertex3fvSUN_profile(const GLfloat* c,const GLfloat* v)const{ProfilingScope const scope(this,2741);(this->*(this->m_orig_glColor3fVertex3fvSUN))(c,v);}
+FunctionTable::MEMBERPFNGLMULTTRANSPOSEMATRIXDPROC m_orig_glMultTransposeMatrixd = nullptr;
+void m_glMultTransposeMatrixd_profile(const GLdouble m[16])const{ProfilingScope const scope(this,2742);(this->*(this->m_orig_glMultTransposeMatrixd))(m);}
+FunctionTable::MEMBERPFNGLCLEARCOLORPROC m_orig_glClearColor = nullptr;
+void m_glClearColor_profile(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha)const{ProfilingScope const scope(this,2743);(this->*(this->m_orig_glClearColor))(red,green,blue,alpha);}
+FunctionTable::MEMBERPFNGLGETIMAGEHANDLEARBPROC m_orig_glGetImageHandleARB = nullptr;
+GLuint64 m_glGetImageHandleARB_profile(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format)const{ProfilingScope const scope(this,2744);return (this->*(this->m_orig_glGetImageHandleARB))(texture,level,layered,layer,format);}
+FunctionTable::MEMBERPFNGLTANGENT3DEXTPROC m_orig_glTangent3dEXT = nullptr;
+void m_glTangent3dEXT_profile(GLdouble tx,GLdouble ty,GLdouble tz)const{ProfilingScope const scope(this,2745);(this->*(this->m_orig_glTangent3dEXT))(tx,ty,tz);}
+FunctionTable::MEMBERPFNGLGETQUERYOBJECTIVARBPROC m_orig_glGetQueryObjectivARB = nullptr;
+void m_glGetQueryObjectivARB_profile(GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2746);(this->*(this->m_orig_glGetQueryObjectivARB))(id,pname,params);}
+FunctionTable::MEMBERPFNGLGETLOCALCONSTANTFLOATVEXTPROC m_orig_glGetLocalConstantFloatvEXT = nullptr;
+void m_glGetLocalConstantFloatvEXT_profile(GLuint id,GLenum value,GLfloat* data)const{ProfilingScope const scope(this,2747);(this->*(this->m_orig_glGetLocalConstantFloatvEXT))(id,value,data);}
+FunctionTable::MEMBERPFNGLUSESHADERPROGRAMEXTPROC m_orig_glUseShaderProgramEXT = nullptr;
+void m_glUseShaderProgramEXT_profile(GLenum type,GLuint program)const{ProfilingScope const scope(this,2748);(this->*(this->m_orig_glUseShaderProgramEXT))(type,program);}
+FunctionTable::MEMBERPFNGLBINDRENDERBUFFEREXTPROC m_orig_glBindRenderbufferEXT = nullptr;
+void m_glBindRenderbufferEXT_profile(GLenum target,GLuint renderbuffer)const{ProfilingScope const scope(this,2749);(this->*(this->m_orig_glBindRenderbufferEXT))(target,renderbuffer);}
+FunctionTable::MEMBERPFNGLINTERLEAVEDARRAYSPROC m_orig_glInterleavedArrays = nullptr;
+void m_glInterleavedArrays_profile(GLenum format,GLsizei stride,const GLvoid* pointer)const{ProfilingScope const scope(this,2750);(this->*(this->m_orig_glInterleavedArrays))(format,stride,pointer);}
+FunctionTable::MEMBERPFNGLGETPERFMONITORGROUPSTRINGAMDPROC m_orig_glGetPerfMonitorGroupStringAMD = nullptr;
+void m_glGetPerfMonitorGroupStringAMD_profile(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString)const{ProfilingScope const scope(this,2751);(this->*(this->m_orig_glGetPerfMonitorGroupStringAMD))(group,bufSize,length,groupString);}
+FunctionTable::MEMBERPFNGLUNIFORM3UIPROC m_orig_glUniform3ui = nullptr;
+void m_glUniform3ui_profile(GLint location,GLuint v0,GLuint v1,GLuint v2)const{ProfilingScope const scope(this,2752);(this->*(this->m_orig_glUniform3ui))(location,v0,v1,v2);}
+FunctionTable::MEMBERPFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC m_orig_glGetNamedProgramLocalParameterdvEXT = nullptr;
+void m_glGetNamedProgramLocalParameterdvEXT_profile(GLuint program,GLenum target,GLuint index,GLdouble* params)const{ProfilingScope const scope(this,2753);(this->*(this->m_orig_glGetNamedProgramLocalParameterdvEXT))(program,target,index,params);}
+FunctionTable::MEMBERPFNGLDELETEQUERYRESOURCETAGNVPROC m_orig_glDeleteQueryResourceTagNV = nullptr;
+void m_glDeleteQueryResourceTagNV_profile(GLsizei n,const GLint* tagIds)const{ProfilingScope const scope(this,2754);(this->*(this->m_orig_glDeleteQueryResourceTagNV))(n,tagIds);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4UIVPROC m_orig_glVertexAttribI4uiv = nullptr;
+void m_glVertexAttribI4uiv_profile(GLuint index,const GLuint* v)const{ProfilingScope const scope(this,2755);(this->*(this->m_orig_glVertexAttribI4uiv))(index,v);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4BVPROC m_orig_glVertexAttrib4bv = nullptr;
+void m_glVertexAttrib4bv_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,2756);(this->*(this->m_orig_glVertexAttrib4bv))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3XOESPROC m_orig_glMultiTexCoord3xOES = nullptr;
+void m_glMultiTexCoord3xOES_profile(GLenum texture,GLfixed s,GLfixed t,GLfixed r)const{ProfilingScope const scope(this,2757);(this->*(this->m_orig_glMultiTexCoord3xOES))(texture,s,t,r);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UBPROC m_orig_glSecondaryColor3ub = nullptr;
+void m_glSecondaryColor3ub_profile(GLubyte red,GLubyte green,GLubyte blue)const{ProfilingScope const scope(this,2758);(this->*(this->m_orig_glSecondaryColor3ub))(red,green,blue);}
+FunctionTable::MEMBERPFNGLFRAGMENTMATERIALFSGIXPROC m_orig_glFragmentMaterialfSGIX = nullptr;
+void m_glFragmentMaterialfSGIX_profile(GLenum face,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,2759);(this->*(this->m_orig_glFragmentMaterialfSGIX))(face,pname,param);}
+FunctionTable::MEMBERPFNGLGETVARIANTARRAYOBJECTIVATIPROC m_orig_glGetVariantArrayObjectivATI = nullptr;
+void m_glGetVariantArrayObjectivATI_profile(GLuint id,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2760);(this->*(this->m_orig_glGetVariantArrayObjectivATI))(id,pname,params);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3UIPROC m_orig_glSecondaryColor3ui = nullptr;
+void m_glSecondaryColor3ui_profile(GLuint red,GLuint green,GLuint blue)const{ProfilingScope const scope(this,2761);(this->*(this->m_orig_glSecondaryColor3ui))(red,green,blue);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1DARBPROC m_orig_glVertexAttrib1dARB = nullptr;
+void m_glVertexAttrib1dARB_profile(GLuint index,GLdouble x)const{ProfilingScope const scope(this,2762);(this->*(this->m_orig_glVertexAttrib1dARB))(index,x);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPOINTERVPROC m_orig_glGetNamedBufferPointerv = nullptr;
+void m_glGetNamedBufferPointerv_profile(GLuint buffer,GLenum pname,void** params)const{ProfilingScope const scope(this,2763);(this->*(this->m_orig_glGetNamedBufferPointerv))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLLOCKARRAYSEXTPROC m_orig_glLockArraysEXT = nullptr;
+void m_glLockArraysEXT_profile(GLint first,GLsizei count)const{ProfilingScope const scope(this,2764);(this->*(this->m_orig_glLockArraysEXT))(first,count);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBPOINTERNVPROC m_orig_glVertexAttribPointerNV = nullptr;
+void m_glVertexAttribPointerNV_profile(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer)const{ProfilingScope const scope(this,2765);(this->*(this->m_orig_glVertexAttribPointerNV))(index,fsize,type,stride,pointer);}
+FunctionTable::MEMBERPFNGLCONVOLUTIONPARAMETERFPROC m_orig_glConvolutionParameterf = nullptr;
+void m_glConvolutionParameterf_profile(GLenum target,GLenum pname,GLfloat params)const{ProfilingScope const scope(this,2766);(this->*(this->m_orig_glConvolutionParameterf))(target,pname,params);}
+FunctionTable::MEMBERPFNGLBINDBUFFERBASEEXTPROC m_orig_glBindBufferBaseEXT = nullptr;
+void m_glBindBufferBaseEXT_profile(GLenum target,GLuint index,GLuint buffer)const{ProfilingScope const scope(this,2767);(this->*(this->m_orig_glBindBufferBaseEXT))(target,index,buffer);}
+FunctionTable::MEMBERPFNGLTEXCOORD2XVOESPROC m_orig_glTexCoord2xvOES = nullptr;
+void m_glTexCoord2xvOES_profile(const GLfixed* coords)const{ProfilingScope const scope(this,2768);(this->*(this->m_orig_glTexCoord2xvOES))(coords);}
+FunctionTable::MEMBERPFNGLGETQUERYBUFFEROBJECTUI64VPROC m_orig_glGetQueryBufferObjectui64v = nullptr;
+void m_glGetQueryBufferObjectui64v_profile(GLuint id,GLuint buffer,GLenum pname,GLintptr offset)const{ProfilingScope const scope(this,2769);(this->*(this->m_orig_glGetQueryBufferObjectui64v))(id,buffer,pname,offset);}
+FunctionTable::MEMBERPFNGLSETMULTISAMPLEFVAMDPROC m_orig_glSetMultisamplefvAMD = nullptr;
+void m_glSetMultisamplefvAMD_profile(GLenum pname,GLuint index,const GLfloat* val)const{ProfilingScope const scope(this,2770);(this->*(this->m_orig_glSetMultisamplefvAMD))(pname,index,val);}
+FunctionTable::MEMBERPFNGLPATHCOLORGENNVPROC m_orig_glPathColorGenNV = nullptr;
+void m_glPathColorGenNV_profile(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs)const{ProfilingScope const scope(this,2771);(this->*(this->m_orig_glPathColorGenNV))(color,genMode,colorFormat,coeffs);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3SARBPROC m_orig_glVertexAttrib3sARB = nullptr;
+void m_glVertexAttrib3sARB_profile(GLuint index,GLshort x,GLshort y,GLshort z)const{ProfilingScope const scope(this,2772);(this->*(this->m_orig_glVertexAttrib3sARB))(index,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB4IVARBPROC m_orig_glVertexAttrib4ivARB = nullptr;
+void m_glVertexAttrib4ivARB_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2773);(this->*(this->m_orig_glVertexAttrib4ivARB))(index,v);}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSPROC m_orig_glGenTransformFeedbacks = nullptr;
+void m_glGenTransformFeedbacks_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,2774);(this->*(this->m_orig_glGenTransformFeedbacks))(n,ids);}
+FunctionTable::MEMBERPFNGLGETVERTEXATTRIBIUIVPROC m_orig_glGetVertexAttribIuiv = nullptr;
+void m_glGetVertexAttribIuiv_profile(GLuint index,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,2775);(this->*(this->m_orig_glGetVertexAttribIuiv))(index,pname,params);}
+FunctionTable::MEMBERPFNGLPIXELTRANSFORMPARAMETERFEXTPROC m_orig_glPixelTransformParameterfEXT = nullptr;
+void m_glPixelTransformParameterfEXT_profile(GLenum target,GLenum pname,GLfloat param)const{ProfilingScope const scope(this,2776);(this->*(this->m_orig_glPixelTransformParameterfEXT))(target,pname,param);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIUIVEXTPROC m_orig_glGetTexParameterIuivEXT = nullptr;
+void m_glGetTexParameterIuivEXT_profile(GLenum target,GLenum pname,GLuint* params)const{ProfilingScope const scope(this,2777);(this->*(this->m_orig_glGetTexParameterIuivEXT))(target,pname,params);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVARBPROC m_orig_glGetObjectParameterivARB = nullptr;
+void m_glGetObjectParameterivARB_profile(GLhandleARB obj,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2778);(this->*(this->m_orig_glGetObjectParameterivARB))(obj,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC m_orig_glVertexArraySecondaryColorOffsetEXT = nullptr;
+void m_glVertexArraySecondaryColorOffsetEXT_profile(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset)const{ProfilingScope const scope(this,2779);(this->*(this->m_orig_glVertexArraySecondaryColorOffsetEXT))(vaobj,buffer,size,type,stride,offset);}
+FunctionTable::MEMBERPFNGLWINDOWPOS2FARBPROC m_orig_glWindowPos2fARB = nullptr;
+void m_glWindowPos2fARB_profile(GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2780);(this->*(this->m_orig_glWindowPos2fARB))(x,y);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE2DPROC m_orig_glCompressedTexSubImage2D = nullptr;
+void m_glCompressedTexSubImage2D_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data)const{ProfilingScope const scope(this,2781);(this->*(this->m_orig_glCompressedTexSubImage2D))(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC m_orig_glCompressedTexSubImage3DARB = nullptr;
+void m_glCompressedTexSubImage3DARB_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data)const{ProfilingScope const scope(this,2782);(this->*(this->m_orig_glCompressedTexSubImage3DARB))(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+FunctionTable::MEMBERPFNGLPROGRAMBINARYPROC m_orig_glProgramBinary = nullptr;
+void m_glProgramBinary_profile(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length)const{ProfilingScope const scope(this,2783);(this->*(this->m_orig_glProgramBinary))(program,binaryFormat,binary,length);}
+FunctionTable::MEMBERPFNGLPRESENTFRAMEKEYEDNVPROC m_orig_glPresentFrameKeyedNV = nullptr;
+void m_glPresentFrameKeyedNV_profile(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1)const{ProfilingScope const scope(this,2784);(this->*(this->m_orig_glPresentFrameKeyedNV))(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI4BVPROC m_orig_glVertexAttribI4bv = nullptr;
+void m_glVertexAttribI4bv_profile(GLuint index,const GLbyte* v)const{ProfilingScope const scope(this,2785);(this->*(this->m_orig_glVertexAttribI4bv))(index,v);}
+FunctionTable::MEMBERPFNGLPATHCOVERDEPTHFUNCNVPROC m_orig_glPathCoverDepthFuncNV = nullptr;
+void m_glPathCoverDepthFuncNV_profile(GLenum func)const{ProfilingScope const scope(this,2786);(this->*(this->m_orig_glPathCoverDepthFuncNV))(func);}
+FunctionTable::MEMBERPFNGLTRANSFORMFEEDBACKSTREAMATTRIBSNVPROC m_orig_glTransformFeedbackStreamAttribsNV = nullptr;
+void m_glTransformFeedbackStreamAttribsNV_profile(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode)const{ProfilingScope const scope(this,2787);(this->*(this->m_orig_glTransformFeedbackStreamAttribsNV))(count,attribs,nbuffers,bufstreams,bufferMode);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3USEXTPROC m_orig_glSecondaryColor3usEXT = nullptr;
+void m_glSecondaryColor3usEXT_profile(GLushort red,GLushort green,GLushort blue)const{ProfilingScope const scope(this,2788);(this->*(this->m_orig_glSecondaryColor3usEXT))(red,green,blue);}
+FunctionTable::MEMBERPFNGLCOPYCOLORTABLESGIPROC m_orig_glCopyColorTableSGI = nullptr;
+void m_glCopyColorTableSGI_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2789);(this->*(this->m_orig_glCopyColorTableSGI))(target,internalformat,x,y,width);}
+FunctionTable::MEMBERPFNGLPROGRAMENVPARAMETER4FVARBPROC m_orig_glProgramEnvParameter4fvARB = nullptr;
+void m_glProgramEnvParameter4fvARB_profile(GLenum target,GLuint index,const GLfloat* params)const{ProfilingScope const scope(this,2790);(this->*(this->m_orig_glProgramEnvParameter4fvARB))(target,index,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4SARBPROC m_orig_glMultiTexCoord4sARB = nullptr;
+void m_glMultiTexCoord4sARB_profile(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q)const{ProfilingScope const scope(this,2791);(this->*(this->m_orig_glMultiTexCoord4sARB))(target,s,t,r,q);}
+FunctionTable::MEMBERPFNGLGETVERTEXARRAYINDEXED64IVPROC m_orig_glGetVertexArrayIndexed64iv = nullptr;
+void m_glGetVertexArrayIndexed64iv_profile(GLuint vaobj,GLuint index,GLenum pname,GLint64* param)const{ProfilingScope const scope(this,2792);(this->*(this->m_orig_glGetVertexArrayIndexed64iv))(vaobj,index,pname,param);}
+FunctionTable::MEMBERPFNGLMATRIXMULTTRANSPOSE3X3FNVPROC m_orig_glMatrixMultTranspose3x3fNV = nullptr;
+void m_glMatrixMultTranspose3x3fNV_profile(GLenum matrixMode,const GLfloat* m)const{ProfilingScope const scope(this,2793);(this->*(this->m_orig_glMatrixMultTranspose3x3fNV))(matrixMode,m);}
+FunctionTable::MEMBERPFNGLTEXPARAMETERIIVPROC m_orig_glTexParameterIiv = nullptr;
+void m_glTexParameterIiv_profile(GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2794);(this->*(this->m_orig_glTexParameterIiv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLVERTEXARRAYATTRIBFORMATPROC m_orig_glVertexArrayAttribFormat = nullptr;
+void m_glVertexArrayAttribFormat_profile(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset)const{ProfilingScope const scope(this,2795);(this->*(this->m_orig_glVertexArrayAttribFormat))(vaobj,attribindex,size,type,normalized,relativeoffset);}
+FunctionTable::MEMBERPFNGLENDTRANSFORMFEEDBACKPROC m_orig_glEndTransformFeedback = nullptr;
+void m_glEndTransformFeedback_profile()const{ProfilingScope const scope(this,2796);(this->*(this->m_orig_glEndTransformFeedback))();}
+FunctionTable::MEMBERPFNGLDRAWCOMMANDSSTATESADDRESSNVPROC m_orig_glDrawCommandsStatesAddressNV = nullptr;
+void m_glDrawCommandsStatesAddressNV_profile(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count)const{ProfilingScope const scope(this,2797);(this->*(this->m_orig_glDrawCommandsStatesAddressNV))(indirects,sizes,states,fbos,count);}
+FunctionTable::MEMBERPFNGLUNIFORM4UI64NVPROC m_orig_glUniform4ui64NV = nullptr;
+void m_glUniform4ui64NV_profile(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w)const{ProfilingScope const scope(this,2798);(this->*(this->m_orig_glUniform4ui64NV))(location,x,y,z,w);}
+FunctionTable::MEMBERPFNGLMATERIALIVPROC m_orig_glMaterialiv = nullptr;
+void m_glMaterialiv_profile(GLenum face,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2799);(this->*(this->m_orig_glMaterialiv))(face,pname,params);}
+FunctionTable::MEMBERPFNGLTEXIMAGE2DMULTISAMPLEPROC m_orig_glTexImage2DMultisample = nullptr;
+void m_glTexImage2DMultisample_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2800);(this->*(this->m_orig_glTexImage2DMultisample))(target,samples,internalformat,width,height,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLBINDTEXTUREEXTPROC m_orig_glBindTextureEXT = nullptr;
+void m_glBindTextureEXT_profile(GLenum target,GLuint texture)const{ProfilingScope const scope(this,2801);(this->*(this->m_orig_glBindTextureEXT))(target,texture);}
+FunctionTable::MEMBERPFNGLISBUFFERPROC m_orig_glIsBuffer = nullptr;
+GLboolean m_glIsBuffer_profile(GLuint buffer)const{ProfilingScope const scope(this,2802);return (this->*(this->m_orig_glIsBuffer))(buffer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IVPROC m_orig_glVertexAttribI1iv = nullptr;
+void m_glVertexAttribI1iv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2803);(this->*(this->m_orig_glVertexAttribI1iv))(index,v);}
+FunctionTable::MEMBERPFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC m_orig_glGetFinalCombinerInputParameterfvNV = nullptr;
+void m_glGetFinalCombinerInputParameterfvNV_profile(GLenum variable,GLenum pname,GLfloat* params)const{ProfilingScope const scope(this,2804);(this->*(this->m_orig_glGetFinalCombinerInputParameterfvNV))(variable,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3BVOESPROC m_orig_glMultiTexCoord3bvOES = nullptr;
+void m_glMultiTexCoord3bvOES_profile(GLenum texture,const GLbyte* coords)const{ProfilingScope const scope(this,2805);(this->*(this->m_orig_glMultiTexCoord3bvOES))(texture,coords);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBDIVISORPROC m_orig_glVertexAttribDivisor = nullptr;
+void m_glVertexAttribDivisor_profile(GLuint index,GLuint divisor)const{ProfilingScope const scope(this,2806);(this->*(this->m_orig_glVertexAttribDivisor))(index,divisor);}
+FunctionTable::MEMBERPFNGLCOPYBUFFERSUBDATAPROC m_orig_glCopyBufferSubData = nullptr;
+void m_glCopyBufferSubData_profile(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size)const{ProfilingScope const scope(this,2807);(this->*(this->m_orig_glCopyBufferSubData))(readTarget,writeTarget,readOffset,writeOffset,size);}
+FunctionTable::MEMBERPFNGLBINDTEXGENPARAMETEREXTPROC m_orig_glBindTexGenParameterEXT = nullptr;
+GLuint m_glBindTexGenParameterEXT_profile(GLenum unit,GLenum coord,GLenum value)const{ProfilingScope const scope(this,2808);return (this->*(this->m_orig_glBindTexGenParameterEXT))(unit,coord,value);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BATIPROC m_orig_glNormalStream3bATI = nullptr;
+void m_glNormalStream3bATI_profile(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz)const{ProfilingScope const scope(this,2809);(this->*(this->m_orig_glNormalStream3bATI))(stream,nx,ny,nz);}
+FunctionTable::MEMBERPFNGLTEXSTORAGEMEM2DEXTPROC m_orig_glTexStorageMem2DEXT = nullptr;
+void m_glTexStorageMem2DEXT_profile(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset)const{ProfilingScope const scope(this,2810);(this->*(this->m_orig_glTexStorageMem2DEXT))(target,levels,internalFormat,width,height,memory,offset);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE2DEXTPROC m_orig_glTextureImage2DEXT = nullptr;
+void m_glTextureImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2811);(this->*(this->m_orig_glTextureImage2DEXT))(texture,target,level,internalformat,width,height,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETCOLORTABLEPARAMETERIVPROC m_orig_glGetColorTableParameteriv = nullptr;
+void m_glGetColorTableParameteriv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2812);(this->*(this->m_orig_glGetColorTableParameteriv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLACTIVETEXTUREARBPROC m_orig_glActiveTextureARB = nullptr;
+void m_glActiveTextureARB_profile(GLenum texture)const{ProfilingScope const scope(this,2813);(this->*(this->m_orig_glActiveTextureARB))(texture);}
+FunctionTable::MEMBERPFNGLTEXCOORD4XOESPROC m_orig_glTexCoord4xOES = nullptr;
+void m_glTexCoord4xOES_profile(GLfixed s,GLfixed t,GLfixed r,GLfixed q)const{ProfilingScope const scope(this,2814);(this->*(this->m_orig_glTexCoord4xOES))(s,t,r,q);}
+FunctionTable::MEMBERPFNGLNAMEDBUFFERSTORAGEEXTERNALEXTPROC m_orig_glNamedBufferStorageExternalEXT = nullptr;
+void m_glNamedBufferStorageExternalEXT_profile(GLuint buffer,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags)const{ProfilingScope const scope(this,2815);(this->*(this->m_orig_glNamedBufferStorageExternalEXT))(buffer,offset,size,clientBuffer,flags);}
+FunctionTable::MEMBERPFNGLSECONDARYCOLOR3FVEXTPROC m_orig_glSecondaryColor3fvEXT = nullptr;
+void m_glSecondaryColor3fvEXT_profile(const GLfloat* v)const{ProfilingScope const scope(this,2816);(this->*(this->m_orig_glSecondaryColor3fvEXT))(v);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX4X2FVPROC m_orig_glUniformMatrix4x2fv = nullptr;
+void m_glUniformMatrix4x2fv_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2817);(this->*(this->m_orig_glUniformMatrix4x2fv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLSTARTINSTRUMENTSSGIXPROC m_orig_glStartInstrumentsSGIX = nullptr;
+void m_glStartInstrumentsSGIX_profile()const{ProfilingScope const scope(this,2818);(this->*(this->m_orig_glStartInstrumentsSGIX))();}
+FunctionTable::MEMBERPFNGLPROGRAMNAMEDPARAMETER4FVNVPROC m_orig_glProgramNamedParameter4fvNV = nullptr;
+void m_glProgramNamedParameter4fvNV_profile(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v)const{ProfilingScope const scope(this,2819);(this->*(this->m_orig_glProgramNamedParameter4fvNV))(id,len,name,v);}
+FunctionTable::MEMBERPFNGLENDVIDEOCAPTURENVPROC m_orig_glEndVideoCaptureNV = nullptr;
+void m_glEndVideoCaptureNV_profile(GLuint video_capture_slot)const{ProfilingScope const scope(this,2820);(this->*(this->m_orig_glEndVideoCaptureNV))(video_capture_slot);}
+FunctionTable::MEMBERPFNGLGENLISTSPROC m_orig_glGenLists = nullptr;
+GLuint m_glGenLists_profile(GLsizei range)const{ProfilingScope const scope(this,2821);return (this->*(this->m_orig_glGenLists))(range);}
+FunctionTable::MEMBERPFNGLUNIFORM1FARBPROC m_orig_glUniform1fARB = nullptr;
+void m_glUniform1fARB_profile(GLint location,GLfloat v0)const{ProfilingScope const scope(this,2822);(this->*(this->m_orig_glUniform1fARB))(location,v0);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC m_orig_glNamedFramebufferTexture1DEXT = nullptr;
+void m_glNamedFramebufferTexture1DEXT_profile(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level)const{ProfilingScope const scope(this,2823);(this->*(this->m_orig_glNamedFramebufferTexture1DEXT))(framebuffer,attachment,textarget,texture,level);}
+FunctionTable::MEMBERPFNGLMAPBUFFERRANGEPROC m_orig_glMapBufferRange = nullptr;
+void* m_glMapBufferRange_profile(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access)const{ProfilingScope const scope(this,2824);return (this->*(this->m_orig_glMapBufferRange))(target,offset,length,access);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC m_orig_glMultiDrawElementsIndirectCountARB = nullptr;
+void m_glMultiDrawElementsIndirectCountARB_profile(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride)const{ProfilingScope const scope(this,2825);(this->*(this->m_orig_glMultiDrawElementsIndirectCountARB))(mode,type,indirect,drawcount,maxdrawcount,stride);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORMMATRIX4X2FVPROC m_orig_glProgramUniformMatrix4x2fv = nullptr;
+void m_glProgramUniformMatrix4x2fv_profile(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2826);(this->*(this->m_orig_glProgramUniformMatrix4x2fv))(program,location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLGETTEXTUREPARAMETERIIVEXTPROC m_orig_glGetTextureParameterIivEXT = nullptr;
+void m_glGetTextureParameterIivEXT_profile(GLuint texture,GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2827);(this->*(this->m_orig_glGetTextureParameterIivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD3HNVPROC m_orig_glMultiTexCoord3hNV = nullptr;
+void m_glMultiTexCoord3hNV_profile(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r)const{ProfilingScope const scope(this,2828);(this->*(this->m_orig_glMultiTexCoord3hNV))(target,s,t,r);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC m_orig_glNamedProgramLocalParametersI4uivEXT = nullptr;
+void m_glNamedProgramLocalParametersI4uivEXT_profile(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params)const{ProfilingScope const scope(this,2829);(this->*(this->m_orig_glNamedProgramLocalParametersI4uivEXT))(program,target,index,count,params);}
+FunctionTable::MEMBERPFNGLENDLISTPROC m_orig_glEndList = nullptr;
+void m_glEndList_profile()const{ProfilingScope const scope(this,2830);(this->*(this->m_orig_glEndList))();}
+FunctionTable::MEMBERPFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN = nullptr;
+void m_glTexCoord2fColor4fNormal3fVertex3fSUN_profile(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z)const{ProfilingScope const scope(this,2831);(this->*(this->m_orig_glTexCoord2fColor4fNormal3fVertex3fSUN))(s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+FunctionTable::MEMBERPFNGLGENTRANSFORMFEEDBACKSNVPROC m_orig_glGenTransformFeedbacksNV = nullptr;
+void m_glGenTransformFeedbacksNV_profile(GLsizei n,GLuint* ids)const{ProfilingScope const scope(this,2832);(this->*(this->m_orig_glGenTransformFeedbacksNV))(n,ids);}
+FunctionTable::MEMBERPFNGLEDGEFLAGVPROC m_orig_glEdgeFlagv = nullptr;
+void m_glEdgeFlagv_profile(const GLboolean* flag)const{ProfilingScope const scope(this,2833);(this->*(this->m_orig_glEdgeFlagv))(flag);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI2IVPROC m_orig_glVertexAttribI2iv = nullptr;
+void m_glVertexAttribI2iv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2834);(this->*(this->m_orig_glVertexAttribI2iv))(index,v);}
+FunctionTable::MEMBERPFNGLCOPYMULTITEXIMAGE2DEXTPROC m_orig_glCopyMultiTexImage2DEXT = nullptr;
+void m_glCopyMultiTexImage2DEXT_profile(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border)const{ProfilingScope const scope(this,2835);(this->*(this->m_orig_glCopyMultiTexImage2DEXT))(texunit,target,level,internalformat,x,y,width,height,border);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3X2DVPROC m_orig_glUniformMatrix3x2dv = nullptr;
+void m_glUniformMatrix3x2dv_profile(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value)const{ProfilingScope const scope(this,2836);(this->*(this->m_orig_glUniformMatrix3x2dv))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC m_orig_glTexImage3DMultisampleCoverageNV = nullptr;
+void m_glTexImage3DMultisampleCoverageNV_profile(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations)const{ProfilingScope const scope(this,2837);(this->*(this->m_orig_glTexImage3DMultisampleCoverageNV))(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+FunctionTable::MEMBERPFNGLGETSHADERPRECISIONFORMATPROC m_orig_glGetShaderPrecisionFormat = nullptr;
+void m_glGetShaderPrecisionFormat_profile(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision)const{ProfilingScope const scope(this,2838);(this->*(this->m_orig_glGetShaderPrecisionFormat))(shadertype,precisiontype,range,precision);}
+FunctionTable::MEMBERPFNGLTEXSUBIMAGE4DSGISPROC m_orig_glTexSubImage4DSGIS = nullptr;
+void m_glTexSubImage4DSGIS_profile(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2839);(this->*(this->m_orig_glTexSubImage4DSGIS))(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);}
+FunctionTable::MEMBERPFNGLRASTERSAMPLESEXTPROC m_orig_glRasterSamplesEXT = nullptr;
+void m_glRasterSamplesEXT_profile(GLuint samples,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2840);(this->*(this->m_orig_glRasterSamplesEXT))(samples,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLTEXTUREVIEWPROC m_orig_glTextureView = nullptr;
+void m_glTextureView_profile(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers)const{ProfilingScope const scope(this,2841);(this->*(this->m_orig_glTextureView))(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);}
+FunctionTable::MEMBERPFNGLEVALMAPSNVPROC m_orig_glEvalMapsNV = nullptr;
+void m_glEvalMapsNV_profile(GLenum target,GLenum mode)const{ProfilingScope const scope(this,2842);(this->*(this->m_orig_glEvalMapsNV))(target,mode);}
+FunctionTable::MEMBERPFNGLGETFRAGDATALOCATIONEXTPROC m_orig_glGetFragDataLocationEXT = nullptr;
+GLint m_glGetFragDataLocationEXT_profile(GLuint program,const GLchar* name)const{ProfilingScope const scope(this,2843);return (this->*(this->m_orig_glGetFragDataLocationEXT))(program,name);}
+FunctionTable::MEMBERPFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC m_orig_glGetCompressedMultiTexImageEXT = nullptr;
+void m_glGetCompressedMultiTexImageEXT_profile(GLenum texunit,GLenum target,GLint lod,void* img)const{ProfilingScope const scope(this,2844);(this->*(this->m_orig_glGetCompressedMultiTexImageEXT))(texunit,target,lod,img);}
+FunctionTable::MEMBERPFNGLINDEXMASKPROC m_orig_glIndexMask = nullptr;
+void m_glIndexMask_profile(GLuint mask)const{ProfilingScope const scope(this,2845);(this->*(this->m_orig_glIndexMask))(mask);}
+FunctionTable::MEMBERPFNGLPUSHCLIENTATTRIBPROC m_orig_glPushClientAttrib = nullptr;
+void m_glPushClientAttrib_profile(GLbitfield mask)const{ProfilingScope const scope(this,2846);(this->*(this->m_orig_glPushClientAttrib))(mask);}
+FunctionTable::MEMBERPFNGLSHADERSOURCEPROC m_orig_glShaderSource = nullptr;
+void m_glShaderSource_profile(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length)const{ProfilingScope const scope(this,2847);(this->*(this->m_orig_glShaderSource))(shader,count,string,length);}
+FunctionTable::MEMBERPFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC m_orig_glDispatchComputeGroupSizeARB = nullptr;
+void m_glDispatchComputeGroupSizeARB_profile(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z)const{ProfilingScope const scope(this,2848);(this->*(this->m_orig_glDispatchComputeGroupSizeARB))(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);}
+FunctionTable::MEMBERPFNGLLGPUNAMEDBUFFERSUBDATANVXPROC m_orig_glLGPUNamedBufferSubDataNVX = nullptr;
+void m_glLGPUNamedBufferSubDataNVX_profile(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data)const{ProfilingScope const scope(this,2849);(this->*(this->m_orig_glLGPUNamedBufferSubDataNVX))(gpuMask,buffer,offset,size,data);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPFVPROC m_orig_glGetnPixelMapfv = nullptr;
+void m_glGetnPixelMapfv_profile(GLenum map,GLsizei bufSize,GLfloat* values)const{ProfilingScope const scope(this,2850);(this->*(this->m_orig_glGetnPixelMapfv))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLTEXCOORDP2UIVPROC m_orig_glTexCoordP2uiv = nullptr;
+void m_glTexCoordP2uiv_profile(GLenum type,const GLuint* coords)const{ProfilingScope const scope(this,2851);(this->*(this->m_orig_glTexCoordP2uiv))(type,coords);}
+FunctionTable::MEMBERPFNGLUNIFORM2FPROC m_orig_glUniform2f = nullptr;
+void m_glUniform2f_profile(GLint location,GLfloat v0,GLfloat v1)const{ProfilingScope const scope(this,2852);(this->*(this->m_orig_glUniform2f))(location,v0,v1);}
+FunctionTable::MEMBERPFNGLGETNAMEDBUFFERPARAMETERI64VPROC m_orig_glGetNamedBufferParameteri64v = nullptr;
+void m_glGetNamedBufferParameteri64v_profile(GLuint buffer,GLenum pname,GLint64* params)const{ProfilingScope const scope(this,2853);(this->*(this->m_orig_glGetNamedBufferParameteri64v))(buffer,pname,params);}
+FunctionTable::MEMBERPFNGLCOMMANDLISTSEGMENTSNVPROC m_orig_glCommandListSegmentsNV = nullptr;
+void m_glCommandListSegmentsNV_profile(GLuint list,GLuint segments)const{ProfilingScope const scope(this,2854);(this->*(this->m_orig_glCommandListSegmentsNV))(list,segments);}
+FunctionTable::MEMBERPFNGLTEXTUREPARAMETERIIVEXTPROC m_orig_glTextureParameterIivEXT = nullptr;
+void m_glTextureParameterIivEXT_profile(GLuint texture,GLenum target,GLenum pname,const GLint* params)const{ProfilingScope const scope(this,2855);(this->*(this->m_orig_glTextureParameterIivEXT))(texture,target,pname,params);}
+FunctionTable::MEMBERPFNGLMULTITEXPARAMETERFVEXTPROC m_orig_glMultiTexParameterfvEXT = nullptr;
+void m_glMultiTexParameterfvEXT_profile(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2856);(this->*(this->m_orig_glMultiTexParameterfvEXT))(texunit,target,pname,params);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2UI64ARBPROC m_orig_glProgramUniform2ui64ARB = nullptr;
+void m_glProgramUniform2ui64ARB_profile(GLuint program,GLint location,GLuint64 x,GLuint64 y)const{ProfilingScope const scope(this,2857);(this->*(this->m_orig_glProgramUniform2ui64ARB))(program,location,x,y);}
+FunctionTable::MEMBERPFNGLVERTEX4DPROC m_orig_glVertex4d = nullptr;
+void m_glVertex4d_profile(GLdouble x,GLdouble y,GLdouble z,GLdouble w)const{ProfilingScope const scope(this,2858);(this->*(this->m_orig_glVertex4d))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLNEWOBJECTBUFFERATIPROC m_orig_glNewObjectBufferATI = nullptr;
+GLuint m_glNewObjectBufferATI_profile(GLsizei size,const void* pointer,GLenum usage)const{ProfilingScope const scope(this,2859);return (this->*(this->m_orig_glNewObjectBufferATI))(size,pointer,usage);}
+FunctionTable::MEMBERPFNGLVIEWPORTSWIZZLENVPROC m_orig_glViewportSwizzleNV = nullptr;
+void m_glViewportSwizzleNV_profile(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew)const{ProfilingScope const scope(this,2860);(this->*(this->m_orig_glViewportSwizzleNV))(index,swizzlex,swizzley,swizzlez,swizzlew);}
+FunctionTable::MEMBERPFNGLBUFFERDATAPROC m_orig_glBufferData = nullptr;
+void m_glBufferData_profile(GLenum target,GLsizeiptr size,const void* data,GLenum usage)const{ProfilingScope const scope(this,2861);(this->*(this->m_orig_glBufferData))(target,size,data,usage);}
+FunctionTable::MEMBERPFNGLTEXTUREIMAGE1DEXTPROC m_orig_glTextureImage1DEXT = nullptr;
+void m_glTextureImage1DEXT_profile(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels)const{ProfilingScope const scope(this,2862);(this->*(this->m_orig_glTextureImage1DEXT))(texture,target,level,internalformat,width,border,format,type,pixels);}
+FunctionTable::MEMBERPFNGLGETTEXPARAMETERIIVPROC m_orig_glGetTexParameterIiv = nullptr;
+void m_glGetTexParameterIiv_profile(GLenum target,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2863);(this->*(this->m_orig_glGetTexParameterIiv))(target,pname,params);}
+FunctionTable::MEMBERPFNGLCOPYTEXSUBIMAGE1DEXTPROC m_orig_glCopyTexSubImage1DEXT = nullptr;
+void m_glCopyTexSubImage1DEXT_profile(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width)const{ProfilingScope const scope(this,2864);(this->*(this->m_orig_glCopyTexSubImage1DEXT))(target,level,xoffset,x,y,width);}
+FunctionTable::MEMBERPFNGLVERTEX4FPROC m_orig_glVertex4f = nullptr;
+void m_glVertex4f_profile(GLfloat x,GLfloat y,GLfloat z,GLfloat w)const{ProfilingScope const scope(this,2865);(this->*(this->m_orig_glVertex4f))(x,y,z,w);}
+FunctionTable::MEMBERPFNGLUNIFORMMATRIX3FVARBPROC m_orig_glUniformMatrix3fvARB = nullptr;
+void m_glUniformMatrix3fvARB_profile(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value)const{ProfilingScope const scope(this,2866);(this->*(this->m_orig_glUniformMatrix3fvARB))(location,count,transpose,value);}
+FunctionTable::MEMBERPFNGLTEXCOORDP1UIPROC m_orig_glTexCoordP1ui = nullptr;
+void m_glTexCoordP1ui_profile(GLenum type,GLuint coords)const{ProfilingScope const scope(this,2867);(this->*(this->m_orig_glTexCoordP1ui))(type,coords);}
+FunctionTable::MEMBERPFNGLPOINTPARAMETERFVEXTPROC m_orig_glPointParameterfvEXT = nullptr;
+void m_glPointParameterfvEXT_profile(GLenum pname,const GLfloat* params)const{ProfilingScope const scope(this,2868);(this->*(this->m_orig_glPointParameterfvEXT))(pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM4FARBPROC m_orig_glUniform4fARB = nullptr;
+void m_glUniform4fARB_profile(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3)const{ProfilingScope const scope(this,2869);(this->*(this->m_orig_glUniform4fARB))(location,v0,v1,v2,v3);}
+FunctionTable::MEMBERPFNGLIMPORTMEMORYFDEXTPROC m_orig_glImportMemoryFdEXT = nullptr;
+void m_glImportMemoryFdEXT_profile(GLuint memory,GLuint64 size,GLenum handleType,GLint fd)const{ProfilingScope const scope(this,2870);(this->*(this->m_orig_glImportMemoryFdEXT))(memory,size,handleType,fd);}
+FunctionTable::MEMBERPFNGLCOPYTEXTURESUBIMAGE3DPROC m_orig_glCopyTextureSubImage3D = nullptr;
+void m_glCopyTextureSubImage3D_profile(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2871);(this->*(this->m_orig_glCopyTextureSubImage3D))(texture,level,xoffset,yoffset,zoffset,x,y,width,height);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2FVPROC m_orig_glMultiTexCoord2fv = nullptr;
+void m_glMultiTexCoord2fv_profile(GLenum target,const GLfloat* v)const{ProfilingScope const scope(this,2872);(this->*(this->m_orig_glMultiTexCoord2fv))(target,v);}
+FunctionTable::MEMBERPFNGLNAMEDFRAMEBUFFERSAMPLEPOSITIONSFVAMDPROC m_orig_glNamedFramebufferSamplePositionsfvAMD = nullptr;
+void m_glNamedFramebufferSamplePositionsfvAMD_profile(GLuint framebuffer,GLuint numsamples,GLuint pixelindex,const GLfloat* values)const{ProfilingScope const scope(this,2873);(this->*(this->m_orig_glNamedFramebufferSamplePositionsfvAMD))(framebuffer,numsamples,pixelindex,values);}
+FunctionTable::MEMBERPFNGLNORMALP3UIPROC m_orig_glNormalP3ui = nullptr;
+void m_glNormalP3ui_profile(GLenum type,GLuint coords)const{ProfilingScope const scope(this,2874);(this->*(this->m_orig_glNormalP3ui))(type,coords);}
+FunctionTable::MEMBERPFNGLDRAWRANGEELEMENTARRAYATIPROC m_orig_glDrawRangeElementArrayATI = nullptr;
+void m_glDrawRangeElementArrayATI_profile(GLenum mode,GLuint start,GLuint end,GLsizei count)const{ProfilingScope const scope(this,2875);(this->*(this->m_orig_glDrawRangeElementArrayATI))(mode,start,end,count);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIBI1IPROC m_orig_glVertexAttribI1i = nullptr;
+void m_glVertexAttribI1i_profile(GLuint index,GLint x)const{ProfilingScope const scope(this,2876);(this->*(this->m_orig_glVertexAttribI1i))(index,x);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDARBPROC m_orig_glDrawArraysInstancedARB = nullptr;
+void m_glDrawArraysInstancedARB_profile(GLenum mode,GLint first,GLsizei count,GLsizei primcount)const{ProfilingScope const scope(this,2877);(this->*(this->m_orig_glDrawArraysInstancedARB))(mode,first,count,primcount);}
+FunctionTable::MEMBERPFNGLENABLEVERTEXATTRIBAPPLEPROC m_orig_glEnableVertexAttribAPPLE = nullptr;
+void m_glEnableVertexAttribAPPLE_profile(GLuint index,GLenum pname)const{ProfilingScope const scope(this,2878);(this->*(this->m_orig_glEnableVertexAttribAPPLE))(index,pname);}
+FunctionTable::MEMBERPFNGLGETDEBUGMESSAGELOGARBPROC m_orig_glGetDebugMessageLogARB = nullptr;
+GLuint m_glGetDebugMessageLogARB_profile(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog)const{ProfilingScope const scope(this,2879);return (this->*(this->m_orig_glGetDebugMessageLogARB))(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+FunctionTable::MEMBERPFNGLGETPATHTEXGENFVNVPROC m_orig_glGetPathTexGenfvNV = nullptr;
+void m_glGetPathTexGenfvNV_profile(GLenum texCoordSet,GLenum pname,GLfloat* value)const{ProfilingScope const scope(this,2880);(this->*(this->m_orig_glGetPathTexGenfvNV))(texCoordSet,pname,value);}
+FunctionTable::MEMBERPFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC m_orig_glNamedProgramLocalParameters4fvEXT = nullptr;
+void m_glNamedProgramLocalParameters4fvEXT_profile(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params)const{ProfilingScope const scope(this,2881);(this->*(this->m_orig_glNamedProgramLocalParameters4fvEXT))(program,target,index,count,params);}
+FunctionTable::MEMBERPFNGLQUERYRESOURCETAGNVPROC m_orig_glQueryResourceTagNV = nullptr;
+void m_glQueryResourceTagNV_profile(GLint tagId,const GLchar* tagString)const{ProfilingScope const scope(this,2882);(this->*(this->m_orig_glQueryResourceTagNV))(tagId,tagString);}
+FunctionTable::MEMBERPFNGLVERTEXSTREAM3FVATIPROC m_orig_glVertexStream3fvATI = nullptr;
+void m_glVertexStream3fvATI_profile(GLenum stream,const GLfloat* coords)const{ProfilingScope const scope(this,2883);(this->*(this->m_orig_glVertexStream3fvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLFRAMEBUFFERTEXTURE3DPROC m_orig_glFramebufferTexture3D = nullptr;
+void m_glFramebufferTexture3D_profile(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset)const{ProfilingScope const scope(this,2884);(this->*(this->m_orig_glFramebufferTexture3D))(target,attachment,textarget,texture,level,zoffset);}
+FunctionTable::MEMBERPFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC m_orig_glCompressedTextureSubImage2DEXT = nullptr;
+void m_glCompressedTextureSubImage2DEXT_profile(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits)const{ProfilingScope const scope(this,2885);(this->*(this->m_orig_glCompressedTextureSubImage2DEXT))(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+FunctionTable::MEMBERPFNGLWINDOWPOS3DVPROC m_orig_glWindowPos3dv = nullptr;
+void m_glWindowPos3dv_profile(const GLdouble* v)const{ProfilingScope const scope(this,2886);(this->*(this->m_orig_glWindowPos3dv))(v);}
+FunctionTable::MEMBERPFNGLCOPYCONVOLUTIONFILTER2DPROC m_orig_glCopyConvolutionFilter2D = nullptr;
+void m_glCopyConvolutionFilter2D_profile(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height)const{ProfilingScope const scope(this,2887);(this->*(this->m_orig_glCopyConvolutionFilter2D))(target,internalformat,x,y,width,height);}
+FunctionTable::MEMBERPFNGLREADINSTRUMENTSSGIXPROC m_orig_glReadInstrumentsSGIX = nullptr;
+void m_glReadInstrumentsSGIX_profile(GLint marker)const{ProfilingScope const scope(this,2888);(this->*(this->m_orig_glReadInstrumentsSGIX))(marker);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM2DVEXTPROC m_orig_glProgramUniform2dvEXT = nullptr;
+void m_glProgramUniform2dvEXT_profile(GLuint program,GLint location,GLsizei count,const GLdouble* value)const{ProfilingScope const scope(this,2889);(this->*(this->m_orig_glProgramUniform2dvEXT))(program,location,count,value);}
+FunctionTable::MEMBERPFNGLSAMPLERPARAMETERFVPROC m_orig_glSamplerParameterfv = nullptr;
+void m_glSamplerParameterfv_profile(GLuint sampler,GLenum pname,const GLfloat* param)const{ProfilingScope const scope(this,2890);(this->*(this->m_orig_glSamplerParameterfv))(sampler,pname,param);}
+FunctionTable::MEMBERPFNGLBINDBUFFERARBPROC m_orig_glBindBufferARB = nullptr;
+void m_glBindBufferARB_profile(GLenum target,GLuint buffer)const{ProfilingScope const scope(this,2891);(this->*(this->m_orig_glBindBufferARB))(target,buffer);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB1SNVPROC m_orig_glVertexAttrib1sNV = nullptr;
+void m_glVertexAttrib1sNV_profile(GLuint index,GLshort x)const{ProfilingScope const scope(this,2892);(this->*(this->m_orig_glVertexAttrib1sNV))(index,x);}
+FunctionTable::MEMBERPFNGLGETMATERIALIVPROC m_orig_glGetMaterialiv = nullptr;
+void m_glGetMaterialiv_profile(GLenum face,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2893);(this->*(this->m_orig_glGetMaterialiv))(face,pname,params);}
+FunctionTable::MEMBERPFNGLUNIFORM1FVPROC m_orig_glUniform1fv = nullptr;
+void m_glUniform1fv_profile(GLint location,GLsizei count,const GLfloat* value)const{ProfilingScope const scope(this,2894);(this->*(this->m_orig_glUniform1fv))(location,count,value);}
+FunctionTable::MEMBERPFNGLBEGINOCCLUSIONQUERYNVPROC m_orig_glBeginOcclusionQueryNV = nullptr;
+void m_glBeginOcclusionQueryNV_profile(GLuint id)const{ProfilingScope const scope(this,2895);(this->*(this->m_orig_glBeginOcclusionQueryNV))(id);}
+FunctionTable::MEMBERPFNGLGENFENCESAPPLEPROC m_orig_glGenFencesAPPLE = nullptr;
+void m_glGenFencesAPPLE_profile(GLsizei n,GLuint* fences)const{ProfilingScope const scope(this,2896);(this->*(this->m_orig_glGenFencesAPPLE))(n,fences);}
+FunctionTable::MEMBERPFNGLSCISSORINDEXEDVPROC m_orig_glScissorIndexedv = nullptr;
+void m_glScissorIndexedv_profile(GLuint index,const GLint* v)const{ProfilingScope const scope(this,2897);(this->*(this->m_orig_glScissorIndexedv))(index,v);}
+FunctionTable::MEMBERPFNGLDISABLEVARIANTCLIENTSTATEEXTPROC m_orig_glDisableVariantClientStateEXT = nullptr;
+void m_glDisableVariantClientStateEXT_profile(GLuint id)const{ProfilingScope const scope(this,2898);(this->*(this->m_orig_glDisableVariantClientStateEXT))(id);}
+FunctionTable::MEMBERPFNGLMINMAXEXTPROC m_orig_glMinmaxEXT = nullptr;
+void m_glMinmaxEXT_profile(GLenum target,GLenum internalformat,GLboolean sink)const{ProfilingScope const scope(this,2899);(this->*(this->m_orig_glMinmaxEXT))(target,internalformat,sink);}
+FunctionTable::MEMBERPFNGLNORMALPOINTERVINTELPROC m_orig_glNormalPointervINTEL = nullptr;
+void m_glNormalPointervINTEL_profile(GLenum type,const void** pointer)const{ProfilingScope const scope(this,2900);(this->*(this->m_orig_glNormalPointervINTEL))(type,pointer);}
+FunctionTable::MEMBERPFNGLNORMAL3SPROC m_orig_glNormal3s = nullptr;
+void m_glNormal3s_profile(GLshort nx,GLshort ny,GLshort nz)const{ProfilingScope const scope(this,2901);(this->*(this->m_orig_glNormal3s))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLGETNPIXELMAPUIVPROC m_orig_glGetnPixelMapuiv = nullptr;
+void m_glGetnPixelMapuiv_profile(GLenum map,GLsizei bufSize,GLuint* values)const{ProfilingScope const scope(this,2902);(this->*(this->m_orig_glGetnPixelMapuiv))(map,bufSize,values);}
+FunctionTable::MEMBERPFNGLNORMALSTREAM3BVATIPROC m_orig_glNormalStream3bvATI = nullptr;
+void m_glNormalStream3bvATI_profile(GLenum stream,const GLbyte* coords)const{ProfilingScope const scope(this,2903);(this->*(this->m_orig_glNormalStream3bvATI))(stream,coords);}
+FunctionTable::MEMBERPFNGLGETOBJECTPARAMETERIVAPPLEPROC m_orig_glGetObjectParameterivAPPLE = nullptr;
+void m_glGetObjectParameterivAPPLE_profile(GLenum objectType,GLuint name,GLenum pname,GLint* params)const{ProfilingScope const scope(this,2904);(this->*(this->m_orig_glGetObjectParameterivAPPLE))(objectType,name,pname,params);}
+FunctionTable::MEMBERPFNGLNORMAL3IPROC m_orig_glNormal3i = nullptr;
+void m_glNormal3i_profile(GLint nx,GLint ny,GLint nz)const{ProfilingScope const scope(this,2905);(this->*(this->m_orig_glNormal3i))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLUNIFORM1IVARBPROC m_orig_glUniform1ivARB = nullptr;
+void m_glUniform1ivARB_profile(GLint location,GLsizei count,const GLint* value)const{ProfilingScope const scope(this,2906);(this->*(this->m_orig_glUniform1ivARB))(location,count,value);}
+FunctionTable::MEMBERPFNGLNORMAL3DPROC m_orig_glNormal3d = nullptr;
+void m_glNormal3d_profile(GLdouble nx,GLdouble ny,GLdouble nz)const{ProfilingScope const scope(this,2907);(this->*(this->m_orig_glNormal3d))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLUPDATEOBJECTBUFFERATIPROC m_orig_glUpdateObjectBufferATI = nullptr;
+void m_glUpdateObjectBufferATI_profile(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve)const{ProfilingScope const scope(this,2908);(this->*(this->m_orig_glUpdateObjectBufferATI))(buffer,offset,size,pointer,preserve);}
+FunctionTable::MEMBERPFNGLNORMAL3BPROC m_orig_glNormal3b = nullptr;
+void m_glNormal3b_profile(GLbyte nx,GLbyte ny,GLbyte nz)const{ProfilingScope const scope(this,2909);(this->*(this->m_orig_glNormal3b))(nx,ny,nz);}
+FunctionTable::MEMBERPFNGLGETUNIFORMBUFFERSIZEEXTPROC m_orig_glGetUniformBufferSizeEXT = nullptr;
+GLint m_glGetUniformBufferSizeEXT_profile(GLuint program,GLint location)const{ProfilingScope const scope(this,2910);return (this->*(this->m_orig_glGetUniformBufferSizeEXT))(program,location);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD4DVPROC m_orig_glMultiTexCoord4dv = nullptr;
+void m_glMultiTexCoord4dv_profile(GLenum target,const GLdouble* v)const{ProfilingScope const scope(this,2911);(this->*(this->m_orig_glMultiTexCoord4dv))(target,v);}
+FunctionTable::MEMBERPFNGLPROGRAMUNIFORM3I64ARBPROC m_orig_glProgramUniform3i64ARB = nullptr;
+void m_glProgramUniform3i64ARB_profile(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z)const{ProfilingScope const scope(this,2912);(this->*(this->m_orig_glProgramUniform3i64ARB))(program,location,x,y,z);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2DPROC m_orig_glVertexAttrib2d = nullptr;
+void m_glVertexAttrib2d_profile(GLuint index,GLdouble x,GLdouble y)const{ProfilingScope const scope(this,2913);(this->*(this->m_orig_glVertexAttrib2d))(index,x,y);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2FPROC m_orig_glVertexAttrib2f = nullptr;
+void m_glVertexAttrib2f_profile(GLuint index,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2914);(this->*(this->m_orig_glVertexAttrib2f))(index,x,y);}
+FunctionTable::MEMBERPFNGLMULTIDRAWELEMENTSEXTPROC m_orig_glMultiDrawElementsEXT = nullptr;
+void m_glMultiDrawElementsEXT_profile(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount)const{ProfilingScope const scope(this,2915);(this->*(this->m_orig_glMultiDrawElementsEXT))(mode,count,type,indices,primcount);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB3DVPROC m_orig_glVertexAttrib3dv = nullptr;
+void m_glVertexAttrib3dv_profile(GLuint index,const GLdouble* v)const{ProfilingScope const scope(this,2916);(this->*(this->m_orig_glVertexAttrib3dv))(index,v);}
+FunctionTable::MEMBERPFNGLMULTITEXCOORD2BOESPROC m_orig_glMultiTexCoord2bOES = nullptr;
+void m_glMultiTexCoord2bOES_profile(GLenum texture,GLbyte s,GLbyte t)const{ProfilingScope const scope(this,2917);(this->*(this->m_orig_glMultiTexCoord2bOES))(texture,s,t);}
+FunctionTable::MEMBERPFNGLVERTEXATTRIB2SPROC m_orig_glVertexAttrib2s = nullptr;
+void m_glVertexAttrib2s_profile(GLuint index,GLshort x,GLshort y)const{ProfilingScope const scope(this,2918);(this->*(this->m_orig_glVertexAttrib2s))(index,x,y);}
+FunctionTable::MEMBERPFNGLTEXIMAGE3DMULTISAMPLEPROC m_orig_glTexImage3DMultisample = nullptr;
+void m_glTexImage3DMultisample_profile(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations)const{ProfilingScope const scope(this,2919);(this->*(this->m_orig_glTexImage3DMultisample))(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+FunctionTable::MEMBERPFNGLGETUNIFORMBLOCKINDEXPROC m_orig_glGetUniformBlockIndex = nullptr;
+GLuint m_glGetUniformBlockIndex_profile(GLuint program,const GLchar* uniformBlockName)const{ProfilingScope const scope(this,2920);return (this->*(this->m_orig_glGetUniformBlockIndex))(program,uniformBlockName);}
+FunctionTable::MEMBERPFNGLRELEASEKEYEDMUTEXWIN32EXTPROC m_orig_glReleaseKeyedMutexWin32EXT = nullptr;
+GLboolean m_glReleaseKeyedMutexWin32EXT_profile(GLuint memory,GLuint64 key)const{ProfilingScope const scope(this,2921);return (this->*(this->m_orig_glReleaseKeyedMutexWin32EXT))(memory,key);}
+FunctionTable::MEMBERPFNGLFRONTFACEPROC m_orig_glFrontFace = nullptr;
+void m_glFrontFace_profile(GLenum mode)const{ProfilingScope const scope(this,2922);(this->*(this->m_orig_glFrontFace))(mode);}
+FunctionTable::MEMBERPFNGLEVALCOORD1XOESPROC m_orig_glEvalCoord1xOES = nullptr;
+void m_glEvalCoord1xOES_profile(GLfixed u)const{ProfilingScope const scope(this,2923);(this->*(this->m_orig_glEvalCoord1xOES))(u);}
+FunctionTable::MEMBERPFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC m_orig_glDrawArraysInstancedBaseInstance = nullptr;
+void m_glDrawArraysInstancedBaseInstance_profile(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance)const{ProfilingScope const scope(this,2924);(this->*(this->m_orig_glDrawArraysInstancedBaseInstance))(mode,first,count,instancecount,baseinstance);}
+FunctionTable::MEMBERPFNGLISPOINTINSTROKEPATHNVPROC m_orig_glIsPointInStrokePathNV = nullptr;
+GLboolean m_glIsPointInStrokePathNV_profile(GLuint path,GLfloat x,GLfloat y)const{ProfilingScope const scope(this,2925);return (this->*(this->m_orig_glIsPointInStrokePathNV))(path,x,y);}
@@ -0,0 +1,2926 @@
+{"glMultiDrawArraysIndirectBindlessCountNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();table.glMultiDrawArraysIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5);}},
+{"glTextureParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glTextureParameterfv(a0,a1,a2);}},
+{"glGetListParameterivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetListParameterivSGIX(a0,a1,a2);}},
+{"glProgramUniform1i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64>();table.glProgramUniform1i64ARB(a0,a1,a2);}},
+{"glVertexArrayElementBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexArrayElementBuffer(a0,a1);}},
+{"glHintPGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glHintPGI(a0,a1);}},
+{"glStencilMaskSeparate",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glStencilMaskSeparate(a0,a1);}},
+{"glGetFramebufferAttachmentParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);}},
+{"glTextureStorage3DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTextureStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetIntegerIndexedvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint*>();table.glGetIntegerIndexedvEXT(a0,a1,a2);}},
+{"glCopyTexImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();table.glCopyTexImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttrib4usv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttrib4usv(a0,a1);}},
+{"glTexRenderbufferNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTexRenderbufferNV(a0,a1);}},
+{"glVertexAttrib3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLhalfNV*>();table.glVertexAttrib3hvNV(a0,a1);}},
+{"glProgramUniform4ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();auto const a3 = call.scalar<GLuint64>();auto const a4 = call.scalar<GLuint64>();auto const a5 = call.scalar<GLuint64>();table.glProgramUniform4ui64ARB(a0,a1,a2,a3,a4,a5);}},
+{"glInstrumentsBufferSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLint*>();table.glInstrumentsBufferSGIX(a0,a1);}},
+{"glIndexi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glIndexi(a0);}},
+{"glMultiTexCoord2sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glMultiTexCoord2sARB(a0,a1,a2);}},
+{"glProgramEnvParameter4fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glProgramEnvParameter4fARB(a0,a1,a2,a3,a4,a5);}},
+{"glCompressedTexSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLsizei>();auto const a10 = call.pointer<const GLvoid*>();table.glCompressedTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glEvalCoord2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glEvalCoord2d(a0,a1);}},
+{"glEvalCoord2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glEvalCoord2f(a0,a1);}},
+{"glIndexd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glIndexd(a0);}},
+{"glSecondaryColor3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glSecondaryColor3hvNV(a0);}},
+{"glIndexf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glIndexf(a0);}},
+{"glFrustumxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();auto const a4 = call.scalar<GLfixed>();auto const a5 = call.scalar<GLfixed>();table.glFrustumxOES(a0,a1,a2,a3,a4,a5);}},
+{"glTextureStorage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();table.glTextureStorage3DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glDrawCommandsStatesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLintptr*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.scalar<GLuint>();table.glDrawCommandsStatesNV(a0,a1,a2,a3,a4,a5);}},
+{"glUniform4uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glUniform4uiEXT(a0,a1,a2,a3,a4);}},
+{"glProgramUniform3ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();auto const a3 = call.scalar<GLuint64>();auto const a4 = call.scalar<GLuint64>();table.glProgramUniform3ui64ARB(a0,a1,a2,a3,a4);}},
+{"glIndexs",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();table.glIndexs(a0);}},
+{"glVertexArrayBindVertexBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizei>();table.glVertexArrayBindVertexBufferEXT(a0,a1,a2,a3,a4);}},
+{"glConvolutionParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glConvolutionParameteriEXT(a0,a1,a2);}},
+{"glColor4ubVertex2fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glColor4ubVertex2fSUN(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniform1ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform1ivEXT(a0,a1,a2,a3);}},
+{"glGetnMapfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLfloat*>();table.glGetnMapfv(a0,a1,a2,a3);}},
+{"glTransformFeedbackBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glTransformFeedbackBufferRange(a0,a1,a2,a3,a4);}},
+{"glPathGlyphsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLfloat>();table.glPathGlyphsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glSecondaryColor3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glSecondaryColor3fv(a0);}},
+{"glGetCombinerInputParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLint*>();table.glGetCombinerInputParameterivNV(a0,a1,a2,a3,a4);}},
+{"glEndPerfMonitorAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEndPerfMonitorAMD(a0);}},
+{"glPointParameterfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPointParameterfvARB(a0,a1);}},
+{"glVertex2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glVertex2xOES(a0);}},
+{"glDrawElementsInstancedBaseInstance",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLuint>();table.glDrawElementsInstancedBaseInstance(a0,a1,a2,a3,a4,a5);}},
+{"glMultTransposeMatrixdARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glMultTransposeMatrixdARB(a0);}},
+{"glVertexAttribL4dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexAttribL4dEXT(a0,a1,a2,a3,a4);}},
+{"glVertex4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glVertex4iv(a0);}},
+{"glCoverStrokePathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const GLfloat*>();table.glCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glDeformSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glDeformSGIX(a0);}},
+{"glUniform2ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();table.glUniform2ui64NV(a0,a1,a2);}},
+{"glCopyPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glCopyPathNV(a0,a1);}},
+{"glVertexAttribP4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribP4ui(a0,a1,a2,a3);}},
+{"glVertexAttribL2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexAttribL2d(a0,a1,a2);}},
+{"glGetMultisamplefv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetMultisamplefv(a0,a1,a2);}},
+{"glCompressedMultiTexSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLsizei>();auto const a11 = call.pointer<const void*>();table.glCompressedMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glVDPAURegisterOutputSurfaceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const void*>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glVDPAURegisterOutputSurfaceNV(a0,a1,a2,a3);}},
+{"glMinSampleShading",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glMinSampleShading(a0);}},
+{"glProgramUniform4fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glProgramUniform4fEXT(a0,a1,a2,a3,a4,a5);}},
+{"glCoverStrokePathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glCoverStrokePathNV(a0,a1);}},
+{"glTextureImage2DMultisampleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTextureImage2DMultisampleNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertex3bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glVertex3bOES(a0,a1,a2);}},
+{"glImportMemoryWin32HandleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glImportMemoryWin32HandleEXT(a0,a1,a2,a3);}},
+{"glTessellationFactorAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glTessellationFactorAMD(a0);}},
+{"glDebugMessageControl",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.scalar<GLboolean>();table.glDebugMessageControl(a0,a1,a2,a3,a4,a5);}},
+{"glIsObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsObjectBufferATI(a0);}},
+{"glPopAttrib",[](FunctionTable const&table,ReplayCall&){table.glPopAttrib();}},
+{"glProgramUniform4iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glProgramUniform4iEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib4ubNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLubyte>();table.glVertexAttrib4ubNV(a0,a1,a2,a3,a4);}},
+{"glColorMaterial",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glColorMaterial(a0,a1);}},
+{"glVertexAttrib2svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib2svARB(a0,a1);}},
+{"glMinSampleShadingARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glMinSampleShadingARB(a0);}},
+{"glColor3b",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glColor3b(a0,a1,a2);}},
+{"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();table.glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glColor3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glColor3f(a0,a1,a2);}},
+{"glVDPAUGetSurfaceivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLvdpauSurfaceNV>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();table.glVDPAUGetSurfaceivNV(a0,a1,a2,a3,a4);}},
+{"glColor3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glColor3d(a0,a1,a2);}},
+{"glGetnMapiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint*>();table.glGetnMapiv(a0,a1,a2,a3);}},
+{"glColor3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glColor3i(a0,a1,a2);}},
+{"glGetInternalformatSampleivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<GLint*>();table.glGetInternalformatSampleivNV(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib4ubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttrib4ubv(a0,a1);}},
+{"glColor3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glColor3s(a0,a1,a2);}},
+{"glVertexAttribs4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLhalfNV*>();table.glVertexAttribs4hvNV(a0,a1,a2);}},
+{"glVertexAttrib4NubvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttrib4NubvARB(a0,a1);}},
+{"glMultiTexCoord3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLhalfNV*>();table.glMultiTexCoord3hvNV(a0,a1);}},
+{"glMatrixPushEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glMatrixPushEXT(a0);}},
+{"glProgramUniform2fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glProgramUniform2fEXT(a0,a1,a2,a3);}},
+{"glGetVertexArrayIndexediv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetVertexArrayIndexediv(a0,a1,a2,a3);}},
+{"glBlitFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLbitfield>();auto const a9 = call.scalar<GLenum>();table.glBlitFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glMultiTexCoordP2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glMultiTexCoordP2ui(a0,a1,a2);}},
+{"glColorPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const void**>();auto const a4 = call.scalar<GLint>();table.glColorPointerListIBM(a0,a1,a2,a3,a4);}},
+{"glVertexAttribL4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexAttribL4d(a0,a1,a2,a3,a4);}},
+{"glGetFragmentMaterialfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetFragmentMaterialfvSGIX(a0,a1,a2);}},
+{"glVertex2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glVertex2iv(a0);}},
+{"glGetTexEnvxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetTexEnvxvOES(a0,a1,a2);}},
+{"glUniformMatrix3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix3dv(a0,a1,a2,a3);}},
+{"glGetVertexAttribLdvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetVertexAttribLdvEXT(a0,a1,a2);}},
+{"glTexCoordP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glTexCoordP3uiv(a0,a1);}},
+{"glDeformationMap3dSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLdouble>();auto const a10 = call.scalar<GLdouble>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLint>();auto const a13 = call.pointer<const GLdouble*>();table.glDeformationMap3dSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}},
+{"glResumeTransformFeedback",[](FunctionTable const&table,ReplayCall&){table.glResumeTransformFeedback();}},
+{"glInsertEventMarkerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLchar*>();table.glInsertEventMarkerEXT(a0,a1);}},
+{"glTessellationModeAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glTessellationModeAMD(a0);}},
+{"glDrawCommandsAddressNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint64*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.scalar<GLuint>();table.glDrawCommandsAddressNV(a0,a1,a2,a3);}},
+{"glFogi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glFogi(a0,a1);}},
+{"glGetTexParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetTexParameterxvOES(a0,a1,a2);}},
+{"glVertexPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLvoid*>();table.glVertexPointer(a0,a1,a2,a3);}},
+{"glGetPerfMonitorCounterDataAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLuint*>();auto const a4 = call.pointer<GLint*>();table.glGetPerfMonitorCounterDataAMD(a0,a1,a2,a3,a4);}},
+{"glFogf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glFogf(a0,a1);}},
+{"glMultiTexCoord1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();table.glMultiTexCoord1d(a0,a1);}},
+{"glMultiTexCoord1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glMultiTexCoord1f(a0,a1);}},
+{"glGetMultiTexParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetMultiTexParameterivEXT(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix3x4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3x4fvEXT(a0,a1,a2,a3,a4);}},
+{"glVertexAttribI2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glVertexAttribI2i(a0,a1,a2);}},
+{"glMultiTexCoord1i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glMultiTexCoord1i(a0,a1);}},
+{"glDeleteSemaphoresEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteSemaphoresEXT(a0,a1);}},
+{"glLoadProgramNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLubyte*>();table.glLoadProgramNV(a0,a1,a2,a3);}},
+{"glWriteMaskEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();table.glWriteMaskEXT(a0,a1,a2,a3,a4,a5);}},
+{"glGetGraphicsResetStatus",[](FunctionTable const&table,ReplayCall&){table.glGetGraphicsResetStatus();}},
+{"glVertexAttrib1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib1fv(a0,a1);}},
+{"glMultiTexCoord1s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();table.glMultiTexCoord1s(a0,a1);}},
+{"glImageTransformParameterfvHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glImageTransformParameterfvHP(a0,a1,a2);}},
+{"glFramebufferTexture2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTexture2D(a0,a1,a2,a3,a4);}},
+{"glGetFragmentLightfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetFragmentLightfvSGIX(a0,a1,a2);}},
+{"glListParameterfSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glListParameterfSGIX(a0,a1,a2);}},
+{"glTexCoord3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glTexCoord3sv(a0);}},
+{"glNamedFramebufferRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glNamedFramebufferRenderbufferEXT(a0,a1,a2,a3);}},
+{"glFragmentLightModelfSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glFragmentLightModelfSGIX(a0,a1);}},
+{"glIndexPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glIndexPointerEXT(a0,a1,a2,a3);}},
+{"glBlendEquationSeparateATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationSeparateATI(a0,a1);}},
+{"glVertexArrayAttribIFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();table.glVertexArrayAttribIFormat(a0,a1,a2,a3,a4);}},
+{"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();auto const a11 = call.scalar<GLfloat>();auto const a12 = call.scalar<GLfloat>();table.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}},
+{"glReplacementCodeubvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glReplacementCodeubvSUN(a0);}},
+{"glGenFramebuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenFramebuffers(a0,a1);}},
+{"glPixelMapx",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const GLfixed*>();table.glPixelMapx(a0,a1,a2);}},
+{"glTexSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glGetAttachedShaders",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLuint*>();table.glGetAttachedShaders(a0,a1,a2,a3);}},
+{"glGetPixelTexGenParameterfvSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetPixelTexGenParameterfvSGIS(a0,a1);}},
+{"glReplacementCodeuiNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();table.glReplacementCodeuiNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetDebugMessageLogAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLenum*>();auto const a3 = call.pointer<GLuint*>();auto const a4 = call.pointer<GLuint*>();auto const a5 = call.pointer<GLsizei*>();auto const a6 = call.pointer<GLchar*>();table.glGetDebugMessageLogAMD(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexStream4sATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glVertexStream4sATI(a0,a1,a2,a3,a4);}},
+{"glVertexAttribs4dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glVertexAttribs4dvNV(a0,a1,a2);}},
+{"glGetnMapdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLdouble*>();table.glGetnMapdvARB(a0,a1,a2,a3);}},
+{"glOrthofOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glOrthofOES(a0,a1,a2,a3,a4,a5);}},
+{"glViewportArrayv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glViewportArrayv(a0,a1,a2);}},
+{"glDrawElementArrayATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();table.glDrawElementArrayATI(a0,a1);}},
+{"glBufferStorageMemEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint64>();table.glBufferStorageMemEXT(a0,a1,a2,a3);}},
+{"glGetPathColorGenfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetPathColorGenfvNV(a0,a1,a2);}},
+{"glWindowPos3iMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glWindowPos3iMESA(a0,a1,a2);}},
+{"glMultiTexCoord2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glMultiTexCoord2s(a0,a1,a2);}},
+{"glVertex3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glVertex3dv(a0);}},
+{"glVertexAttribI3uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI3uivEXT(a0,a1);}},
+{"glUniform3ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLuint64>();auto const a3 = call.scalar<GLuint64>();table.glUniform3ui64ARB(a0,a1,a2,a3);}},
+{"glVertexAttrib2fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib2fvNV(a0,a1);}},
+{"glGetNamedBufferSubDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<void*>();table.glGetNamedBufferSubDataEXT(a0,a1,a2,a3);}},
+{"glConvolutionFilter2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const GLvoid*>();table.glConvolutionFilter2D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glMemoryBarrierByRegion",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glMemoryBarrierByRegion(a0);}},
+{"glVertexArrayBindingDivisor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexArrayBindingDivisor(a0,a1,a2);}},
+{"glMatrixRotatedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glMatrixRotatedEXT(a0,a1,a2,a3,a4);}},
+{"glTexCoord2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glTexCoord2sv(a0);}},
+{"glIsProgramNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsProgramNV(a0);}},
+{"glUniform2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glUniform2dv(a0,a1,a2);}},
+{"glGetPixelMapuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLuint*>();table.glGetPixelMapuiv(a0,a1);}},
+{"glDepthBoundsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampd>();auto const a1 = call.scalar<GLclampd>();table.glDepthBoundsEXT(a0,a1);}},
+{"glVertexAttrib4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLhalfNV*>();table.glVertexAttrib4hvNV(a0,a1);}},
+{"glMultiTexParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();table.glMultiTexParameteriEXT(a0,a1,a2,a3);}},
+{"glGetPointerv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLvoid**>();table.glGetPointerv(a0,a1);}},
+{"glPathCommandsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glPathCommandsNV(a0,a1,a2,a3,a4,a5);}},
+{"glGetListParameterfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetListParameterfvSGIX(a0,a1,a2);}},
+{"glGetUniformuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLuint*>();table.glGetUniformuiv(a0,a1,a2);}},
+{"glDebugMessageInsertAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLchar*>();table.glDebugMessageInsertAMD(a0,a1,a2,a3,a4);}},
+{"glFrustum",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glFrustum(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttribL1ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint64EXT*>();table.glVertexAttribL1ui64vNV(a0,a1);}},
+{"glClearColorxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glClearColorxOES(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3fv(a0,a1,a2,a3,a4);}},
+{"glSampleMaskIndexedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();table.glSampleMaskIndexedNV(a0,a1);}},
+{"glCompileShaderIncludeARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();auto const a3 = call.pointer<const GLint*>();table.glCompileShaderIncludeARB(a0,a1,a2,a3);}},
+{"glGetArrayObjectfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetArrayObjectfvATI(a0,a1,a2);}},
+{"glVertexStream4svATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glVertexStream4svATI(a0,a1);}},
+{"glMultiTexCoord4iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glMultiTexCoord4iARB(a0,a1,a2,a3,a4);}},
+{"glVariantfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVariantfvEXT(a0,a1);}},
+{"glMatrixLoadfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixLoadfEXT(a0,a1);}},
+{"glLoadIdentityDeformationMapSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glLoadIdentityDeformationMapSGIX(a0);}},
+{"glGetRenderbufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetRenderbufferParameteriv(a0,a1,a2);}},
+{"glProgramUniform3fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glProgramUniform3fEXT(a0,a1,a2,a3,a4);}},
+{"glNamedRenderbufferStorage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glNamedRenderbufferStorage(a0,a1,a2,a3);}},
+{"glBindFragDataLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLchar*>();table.glBindFragDataLocation(a0,a1,a2);}},
+{"glPolygonOffsetClamp",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glPolygonOffsetClamp(a0,a1,a2);}},
+{"glFogCoordPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const void**>();auto const a3 = call.scalar<GLint>();table.glFogCoordPointerListIBM(a0,a1,a2,a3);}},
+{"glFenceSync",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbitfield>();call.mapSync(table.glFenceSync(a0,a1));}},
+{"glGetVertexAttribIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribIivEXT(a0,a1,a2);}},
+{"glFramebufferDrawBuffersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();table.glFramebufferDrawBuffersEXT(a0,a1,a2);}},
+{"glVertexAttribs4fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glVertexAttribs4fvNV(a0,a1,a2);}},
+{"glPauseTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&){table.glPauseTransformFeedbackNV();}},
+{"glGetQueryObjecti64vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64*>();table.glGetQueryObjecti64vEXT(a0,a1,a2);}},
+{"glVDPAUSurfaceAccessNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLvdpauSurfaceNV>();auto const a1 = call.scalar<GLenum>();table.glVDPAUSurfaceAccessNV(a0,a1);}},
+{"glValidateProgramPipeline",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glValidateProgramPipeline(a0);}},
+{"glTexPageCommitmentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLboolean>();table.glTexPageCommitmentARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glWindowPos3dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos3dvARB(a0);}},
+{"glStencilStrokePathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const GLfloat*>();table.glStencilStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glFogfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glFogfv(a0,a1);}},
+{"glGenQueriesARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenQueriesARB(a0,a1);}},
+{"glProgramUniform2i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();table.glProgramUniform2i64NV(a0,a1,a2,a3);}},
+{"glVertexP4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glVertexP4ui(a0,a1);}},
+{"glVertexStream1ivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glVertexStream1ivATI(a0,a1);}},
+{"glProgramEnvParameterI4iNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glProgramEnvParameterI4iNV(a0,a1,a2,a3,a4,a5);}},
+{"glGenVertexArraysAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenVertexArraysAPPLE(a0,a1);}},
+{"glDrawTransformFeedbackInstanced",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();table.glDrawTransformFeedbackInstanced(a0,a1,a2);}},
+{"glStencilThenCoverStrokePathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();table.glStencilThenCoverStrokePathNV(a0,a1,a2,a3);}},
+{"glDeleteVertexArraysAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteVertexArraysAPPLE(a0,a1);}},
+{"glGetNamedBufferParameterui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetNamedBufferParameterui64vNV(a0,a1,a2);}},
+{"glQueryMatrixxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLfixed*>();auto const a1 = call.pointer<GLint*>();table.glQueryMatrixxOES(a0,a1);}},
+{"glSecondaryColor3usv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLushort*>();table.glSecondaryColor3usv(a0);}},
+{"glTranslatexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glTranslatexOES(a0,a1,a2);}},
+{"glDrawTransformFeedback",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDrawTransformFeedback(a0,a1);}},
+{"glTexCoord2fColor4fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();auto const a3 = call.pointer<const GLfloat*>();table.glTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);}},
+{"glVDPAURegisterVideoSurfaceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const void*>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glVDPAURegisterVideoSurfaceNV(a0,a1,a2,a3);}},
+{"glGetTexParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetTexParameterIuiv(a0,a1,a2);}},
+{"glBindBufferBaseNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glBindBufferBaseNV(a0,a1,a2);}},
+{"glIndexPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLvoid*>();table.glIndexPointer(a0,a1,a2);}},
+{"glGenQueryResourceTagNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLint*>();table.glGenQueryResourceTagNV(a0,a1);}},
+{"glVertexAttrib4Nbv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttrib4Nbv(a0,a1);}},
+{"glListParameteriSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glListParameteriSGIX(a0,a1,a2);}},
+{"glBlendColorxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glBlendColorxOES(a0,a1,a2,a3);}},
+{"glUniformui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64EXT*>();table.glUniformui64vNV(a0,a1,a2);}},
+{"glIsSync",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.sync();table.glIsSync(a0);}},
+{"glGetTextureParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetTextureParameterivEXT(a0,a1,a2,a3);}},
+{"glFogCoordhvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glFogCoordhvNV(a0);}},
+{"glFramebufferTextureLayerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);}},
+{"glGetObjectPtrLabel",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const void*>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetObjectPtrLabel(a0,a1,a2,a3);}},
+{"glTextureParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glTextureParameteri(a0,a1,a2);}},
+{"glMultiTexCoord1fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glMultiTexCoord1fARB(a0,a1);}},
+{"glUniformMatrix2x3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix2x3dv(a0,a1,a2,a3);}},
+{"glFramebufferDrawBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glFramebufferDrawBufferEXT(a0,a1);}},
+{"glCopyColorSubTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyColorSubTable(a0,a1,a2,a3,a4);}},
+{"glGetNamedFramebufferParameterfvAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<GLfloat*>();table.glGetNamedFramebufferParameterfvAMD(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttribL3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexAttribL3d(a0,a1,a2,a3);}},
+{"glFragmentMaterialfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glFragmentMaterialfvSGIX(a0,a1,a2);}},
+{"glMatrixLoadTranspose3x3fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixLoadTranspose3x3fNV(a0,a1);}},
+{"glDeleteNamesAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLuint*>();table.glDeleteNamesAMD(a0,a1,a2);}},
+{"glDrawRangeElementsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glDrawRangeElementsEXT(a0,a1,a2,a3,a4,a5);}},
+{"glOrtho",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glOrtho(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniform1dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform1dvEXT(a0,a1,a2,a3);}},
+{"glColor4xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glColor4xOES(a0,a1,a2,a3);}},
+{"glTexImage4DSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glTexImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glProgramUniform1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glProgramUniform1ui(a0,a1,a2);}},
+{"glDeleteBuffersARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteBuffersARB(a0,a1);}},
+{"glUnmapBufferARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glUnmapBufferARB(a0);}},
+{"glCopyTexImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();table.glCopyTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMaterialxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glMaterialxOES(a0,a1,a2);}},
+{"glProgramUniformMatrix2x4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2x4fvEXT(a0,a1,a2,a3,a4);}},
+{"glTestObjectAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTestObjectAPPLE(a0,a1);}},
+{"glRenderbufferStorageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glRenderbufferStorageEXT(a0,a1,a2,a3);}},
+{"glVertexAttribL1ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();table.glVertexAttribL1ui64ARB(a0,a1);}},
+{"glEndFragmentShaderATI",[](FunctionTable const&table,ReplayCall&){table.glEndFragmentShaderATI();}},
+{"glPathParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glPathParameterivNV(a0,a1,a2);}},
+{"glUniform4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform4uiv(a0,a1,a2);}},
+{"glFrameZoomSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glFrameZoomSGIX(a0);}},
+{"glSecondaryColor3fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glSecondaryColor3fEXT(a0,a1,a2);}},
+{"glLGPUInterlockNVX",[](FunctionTable const&table,ReplayCall&){table.glLGPUInterlockNVX();}},
+{"glVertexAttribL1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL1dv(a0,a1);}},
+{"glNormalStream3svATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glNormalStream3svATI(a0,a1);}},
+{"glPathStencilFuncNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glPathStencilFuncNV(a0,a1,a2);}},
+{"glSetInvariantEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();table.glSetInvariantEXT(a0,a1,a2);}},
+{"glGetTexBumpParameterivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLint*>();table.glGetTexBumpParameterivATI(a0,a1);}},
+{"glBlendEquationSeparateEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationSeparateEXT(a0,a1);}},
+{"glEndOcclusionQueryNV",[](FunctionTable const&table,ReplayCall&){table.glEndOcclusionQueryNV();}},
+{"glScissorArrayv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glScissorArrayv(a0,a1,a2);}},
+{"glCallList",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glCallList(a0);}},
+{"glMapTexture2DINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLbitfield>();auto const a3 = call.pointer<GLint*>();auto const a4 = call.pointer<GLenum*>();table.glMapTexture2DINTEL(a0,a1,a2,a3,a4);}},
+{"glGetVkProcAddrNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLchar*>();table.glGetVkProcAddrNV(a0);}},
+{"glPixelTransferxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glPixelTransferxOES(a0,a1);}},
+{"glDeleteRenderbuffersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteRenderbuffersEXT(a0,a1);}},
+{"glTexCoord4fColor4fNormal3fVertex4fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();auto const a11 = call.scalar<GLfloat>();auto const a12 = call.scalar<GLfloat>();auto const a13 = call.scalar<GLfloat>();auto const a14 = call.scalar<GLfloat>();table.glTexCoord4fColor4fNormal3fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}},
+{"glProgramUniformMatrix4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4dvEXT(a0,a1,a2,a3,a4);}},
+{"glGetnColorTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();table.glGetnColorTable(a0,a1,a2,a3,a4);}},
+{"glFramebufferTextureLayerARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTextureLayerARB(a0,a1,a2,a3,a4);}},
+{"glVertexAttribL2dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL2dvEXT(a0,a1);}},
+{"glGetCombinerStageParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetCombinerStageParameterfvNV(a0,a1,a2);}},
+{"glMultiTexCoord1xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glMultiTexCoord1xvOES(a0,a1);}},
+{"glMapBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glMapBuffer(a0,a1);}},
+{"glSecondaryColor3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glSecondaryColor3d(a0,a1,a2);}},
+{"glSecondaryColor3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glSecondaryColor3f(a0,a1,a2);}},
+{"glVertexAttribLFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribLFormat(a0,a1,a2,a3);}},
+{"glElementPointerAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();table.glElementPointerAPPLE(a0,a1);}},
+{"glVertexStream1fATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glVertexStream1fATI(a0,a1);}},
+{"glCoverageModulationNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCoverageModulationNV(a0);}},
+{"glSecondaryColor3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glSecondaryColor3i(a0,a1,a2);}},
+{"glDeleteSync",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.sync();table.glDeleteSync(a0);}},
+{"glGetProgramParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetProgramParameterfvNV(a0,a1,a2,a3);}},
+{"glMaxShaderCompilerThreadsARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glMaxShaderCompilerThreadsARB(a0);}},
+{"glUniformMatrix4x2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix4x2dv(a0,a1,a2,a3);}},
+{"glVertexArrayVertexAttribLOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLintptr>();table.glVertexArrayVertexAttribLOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glSecondaryColor3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glSecondaryColor3s(a0,a1,a2);}},
+{"glIsImageHandleResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glIsImageHandleResidentNV(a0);}},
+{"glUniform3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform3iv(a0,a1,a2);}},
+{"glVertexAttribL3i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint64EXT*>();table.glVertexAttribL3i64vNV(a0,a1);}},
+{"glPolygonMode",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glPolygonMode(a0,a1);}},
+{"glFramebufferSamplePositionsfvAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLfloat*>();table.glFramebufferSamplePositionsfvAMD(a0,a1,a2,a3);}},
+{"glConvolutionFilter1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glConvolutionFilter1DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib1dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib1dvARB(a0,a1);}},
+{"glTextureSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const void*>();table.glTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glIsVertexArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsVertexArrayAPPLE(a0);}},
+{"glUseProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glUseProgram(a0);}},
+{"glLineStipple",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLushort>();table.glLineStipple(a0,a1);}},
+{"glMultiTexCoord4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord4fvARB(a0,a1);}},
+{"glVideoCaptureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLuint*>();auto const a2 = call.pointer<GLuint64EXT*>();table.glVideoCaptureNV(a0,a1,a2);}},
+{"glVertexArrayVertexAttribLFormatEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();table.glVertexArrayVertexAttribLFormatEXT(a0,a1,a2,a3,a4);}},
+{"glUniform3fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform3fvARB(a0,a1,a2);}},
+{"glProgramUniformMatrix3x2fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3x2fvEXT(a0,a1,a2,a3,a4);}},
+{"glCopyTextureSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLsizei>();table.glCopyTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glMultiTexCoord2bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLbyte*>();table.glMultiTexCoord2bvOES(a0,a1);}},
+{"glDeleteObjectARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();table.glDeleteObjectARB(a0);}},
+{"glTextureLightEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glTextureLightEXT(a0);}},
+{"glRasterPos3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glRasterPos3i(a0,a1,a2);}},
+{"glMultiTexCoord3dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glMultiTexCoord3dARB(a0,a1,a2,a3);}},
+{"glNamedFramebufferTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();table.glNamedFramebufferTextureEXT(a0,a1,a2,a3);}},
+{"glTextureParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();table.glTextureParameteriEXT(a0,a1,a2,a3);}},
+{"glEvalCoord2xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glEvalCoord2xvOES(a0);}},
+{"glBindVideoCaptureStreamBufferNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLintptrARB>();table.glBindVideoCaptureStreamBufferNV(a0,a1,a2,a3);}},
+{"glTexImage2DMultisampleCoverageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTexImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetAttribLocationARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.pointer<const GLcharARB*>();table.glGetAttribLocationARB(a0,a1);}},
+{"glDeleteShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDeleteShader(a0);}},
+{"glVertexAttrib1fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();table.glVertexAttrib1fARB(a0,a1);}},
+{"glTexCoord2fColor4ubVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLubyte>();auto const a5 = call.scalar<GLubyte>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();table.glTexCoord2fColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glTexCoord4fVertex4fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();table.glTexCoord4fVertex4fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetMapdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetMapdv(a0,a1,a2);}},
+{"glMapParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glMapParameterfvNV(a0,a1,a2);}},
+{"glTextureParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glTextureParameterIuiv(a0,a1,a2);}},
+{"glTransformFeedbackAttribsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.scalar<GLenum>();table.glTransformFeedbackAttribsNV(a0,a1,a2);}},
+{"glFragmentLightfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glFragmentLightfvSGIX(a0,a1,a2);}},
+{"glWindowPos3sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glWindowPos3sARB(a0,a1,a2);}},
+{"glGetConvolutionParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetConvolutionParameterfv(a0,a1,a2);}},
+{"glCopyTexSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();table.glCopyTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glVertexAttribI3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glVertexAttribI3i(a0,a1,a2,a3);}},
+{"glCreateShaderObjectARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCreateShaderObjectARB(a0);}},
+{"glVertexAttribFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLuint>();table.glVertexAttribFormat(a0,a1,a2,a3,a4);}},
+{"glGetProgramivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetProgramivARB(a0,a1,a2);}},
+{"glVertexAttribI4usv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttribI4usv(a0,a1);}},
+{"glTexParameterf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glTexParameterf(a0,a1,a2);}},
+{"glVertexAttribBinding",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexAttribBinding(a0,a1);}},
+{"glGetHistogramParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetHistogramParameteriv(a0,a1,a2);}},
+{"glTexParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glTexParameteri(a0,a1,a2);}},
+{"glGetShaderSource",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetShaderSource(a0,a1,a2,a3);}},
+{"glVertexAttrib4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glVertexAttrib4s(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib4dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib4dvNV(a0,a1);}},
+{"glVertexAttrib1dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib1dvNV(a0,a1);}},
+{"glPopName",[](FunctionTable const&table,ReplayCall&){table.glPopName();}},
+{"glTextureBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glTextureBufferEXT(a0,a1,a2,a3);}},
+{"glGetMultiTexImageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<void*>();table.glGetMultiTexImageEXT(a0,a1,a2,a3,a4,a5);}},
+{"glGetPointerIndexedvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<void**>();table.glGetPointerIndexedvEXT(a0,a1,a2);}},
+{"glIsNameAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glIsNameAMD(a0,a1);}},
+{"glColor4ub",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();table.glColor4ub(a0,a1,a2,a3);}},
+{"glBufferParameteriAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glBufferParameteriAPPLE(a0,a1,a2);}},
+{"glColor4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glColor4ui(a0,a1,a2,a3);}},
+{"glGetInternalformativ",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLint*>();table.glGetInternalformativ(a0,a1,a2,a3,a4);}},
+{"glColor4us",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();auto const a1 = call.scalar<GLushort>();auto const a2 = call.scalar<GLushort>();auto const a3 = call.scalar<GLushort>();table.glColor4us(a0,a1,a2,a3);}},
+{"glVertexAttribP1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLuint*>();table.glVertexAttribP1uiv(a0,a1,a2,a3);}},
+{"glLinkProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glLinkProgram(a0);}},
+{"glTexCoord3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glTexCoord3s(a0,a1,a2);}},
+{"glTexCoord2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glTexCoord2dv(a0);}},
+{"glGetObjectLabel",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLchar*>();table.glGetObjectLabel(a0,a1,a2,a3,a4);}},
+{"glVertexPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexPointerEXT(a0,a1,a2,a3,a4);}},
+{"glDebugMessageCallbackARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.null<GLDEBUGPROCARB>();auto const a1 = call.pointer<const void*>();table.glDebugMessageCallbackARB(a0,a1);}},
+{"glGetString",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glGetString(a0);}},
+{"glGetPathParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetPathParameterfvNV(a0,a1,a2);}},
+{"glLightxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glLightxvOES(a0,a1,a2);}},
+{"glEndQuery",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glEndQuery(a0);}},
+{"glSecondaryColor3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();table.glSecondaryColor3uiv(a0);}},
+{"glPrioritizeTexturesxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<const GLfixed*>();table.glPrioritizeTexturesxOES(a0,a1,a2);}},
+{"glEdgeFlagPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLvoid*>();table.glEdgeFlagPointer(a0,a1);}},
+{"glFramebufferParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glFramebufferParameteri(a0,a1,a2);}},
+{"glTexCoord3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glTexCoord3hNV(a0,a1,a2);}},
+{"glMultiModeDrawElementsIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLenum*>();auto const a1 = call.pointer<const GLsizei*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*const*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();table.glMultiModeDrawElementsIBM(a0,a1,a2,a3,a4,a5);}},
+{"glCopyPixels",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();table.glCopyPixels(a0,a1,a2,a3,a4);}},
+{"glVertexAttribI2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexAttribI2ui(a0,a1,a2);}},
+{"glClampColorARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glClampColorARB(a0,a1);}},
+{"glColorPointervINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void**>();table.glColorPointervINTEL(a0,a1,a2);}},
+{"glDeleteTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteTextures(a0,a1);}},
+{"glGetMinmaxParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetMinmaxParameterfvEXT(a0,a1,a2);}},
+{"glWindowPos3sMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glWindowPos3sMESA(a0,a1,a2);}},
+{"glVertexAttrib4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glVertexAttrib4f(a0,a1,a2,a3,a4);}},
+{"glNamedFramebufferParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glNamedFramebufferParameteri(a0,a1,a2);}},
+{"glTexCoord2fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();table.glTexCoord2fVertex3fvSUN(a0,a1);}},
+{"glReplacementCodeusSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();table.glReplacementCodeusSUN(a0);}},
+{"glGetNamedFramebufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedFramebufferParameteriv(a0,a1,a2);}},
+{"glVertexStream1fvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexStream1fvATI(a0,a1);}},
+{"glCreateVertexArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateVertexArrays(a0,a1);}},
+{"glBeginConditionalRender",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glBeginConditionalRender(a0,a1);}},
+{"glGetUnsignedBytevEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLubyte*>();table.glGetUnsignedBytevEXT(a0,a1);}},
+{"glConvolutionFilter1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const GLvoid*>();table.glConvolutionFilter1D(a0,a1,a2,a3,a4,a5);}},
+{"glMultiTexCoord3fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glMultiTexCoord3fARB(a0,a1,a2,a3);}},
+{"glGetQueryObjectuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetQueryObjectuivARB(a0,a1,a2);}},
+{"glScalexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glScalexOES(a0,a1,a2);}},
+{"glSamplerParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glSamplerParameteri(a0,a1,a2);}},
+{"glSamplerParameterf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glSamplerParameterf(a0,a1,a2);}},
+{"glShaderOp1EXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glShaderOp1EXT(a0,a1,a2);}},
+{"glBeginVideoCaptureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBeginVideoCaptureNV(a0);}},
+{"glGetnHistogram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnHistogram(a0,a1,a2,a3,a4,a5);}},
+{"glUniform1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();table.glUniform1d(a0,a1);}},
+{"glRenderMode",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glRenderMode(a0);}},
+{"glClearColorIiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glClearColorIiEXT(a0,a1,a2,a3);}},
+{"glSignalSemaphoreEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.pointer<const GLenum*>();table.glSignalSemaphoreEXT(a0,a1,a2,a3,a4,a5);}},
+{"glGetCompressedTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLvoid*>();table.glGetCompressedTexImage(a0,a1,a2);}},
+{"glCompressedTextureImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const void*>();table.glCompressedTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetActiveUniformBlockiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetActiveUniformBlockiv(a0,a1,a2,a3);}},
+{"glUniform1i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glUniform1i(a0,a1);}},
+{"glMultiDrawArraysIndirectCount",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawArraysIndirectCount(a0,a1,a2,a3,a4);}},
+{"glGetTexEnvfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetTexEnvfv(a0,a1,a2);}},
+{"glColorTableParameterivSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glColorTableParameterivSGI(a0,a1,a2);}},
+{"glCullFace",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCullFace(a0);}},
+{"glDeleteFencesAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteFencesAPPLE(a0,a1);}},
+{"glProgramUniform4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glProgramUniform4i(a0,a1,a2,a3,a4,a5);}},
+{"glUniformHandleui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();table.glUniformHandleui64ARB(a0,a1);}},
+{"glProgramUniform4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glProgramUniform4f(a0,a1,a2,a3,a4,a5);}},
+{"glViewportIndexedf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glViewportIndexedf(a0,a1,a2,a3,a4);}},
+{"glProgramUniform4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glProgramUniform4d(a0,a1,a2,a3,a4,a5);}},
+{"glTexCoord1xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glTexCoord1xOES(a0);}},
+{"glVertexStream3ivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glVertexStream3ivATI(a0,a1);}},
+{"glPointAlongPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.pointer<GLfloat*>();auto const a5 = call.pointer<GLfloat*>();auto const a6 = call.pointer<GLfloat*>();auto const a7 = call.pointer<GLfloat*>();table.glPointAlongPathNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glEndQueryARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glEndQueryARB(a0);}},
+{"glVDPAUMapSurfacesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLvdpauSurfaceNV*>();table.glVDPAUMapSurfacesNV(a0,a1);}},
+{"glVertex3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glVertex3i(a0,a1,a2);}},
+{"glVertexAttrib4uivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttrib4uivARB(a0,a1);}},
+{"glTextureStorageMem3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint64>();table.glTextureStorageMem3DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glAttachShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glAttachShader(a0,a1);}},
+{"glColor4hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();table.glColor4hNV(a0,a1,a2,a3);}},
+{"glGetFenceivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFenceivNV(a0,a1,a2);}},
+{"glTexCoord2fColor4ubVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLubyte*>();auto const a2 = call.pointer<const GLfloat*>();table.glTexCoord2fColor4ubVertex3fvSUN(a0,a1,a2);}},
+{"glGetColorTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLvoid*>();table.glGetColorTable(a0,a1,a2,a3);}},
+{"glFogCoordPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glFogCoordPointer(a0,a1,a2);}},
+{"glTexStorageSparseAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLbitfield>();table.glTexStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUnmapNamedBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glUnmapNamedBuffer(a0);}},
+{"glTexCoord4bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glTexCoord4bvOES(a0);}},
+{"glVertexAttrib3fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glVertexAttrib3fARB(a0,a1,a2,a3);}},
+{"glRasterPos2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glRasterPos2xOES(a0,a1);}},
+{"glCreateMemoryObjectsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateMemoryObjectsEXT(a0,a1);}},
+{"glColor4ubVertex2fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();auto const a1 = call.pointer<const GLfloat*>();table.glColor4ubVertex2fvSUN(a0,a1);}},
+{"glSecondaryColor3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glSecondaryColor3dv(a0);}},
+{"glVertexAttribI4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttribI4sv(a0,a1);}},
+{"glDrawTransformFeedbackStreamInstanced",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();table.glDrawTransformFeedbackStreamInstanced(a0,a1,a2,a3);}},
+{"glMultiTexCoord4ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord4ivARB(a0,a1);}},
+{"glSpriteParameterfSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glSpriteParameterfSGIX(a0,a1);}},
+{"glSecondaryColor3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glSecondaryColor3sv(a0);}},
+{"glBindVideoCaptureStreamTextureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();table.glBindVideoCaptureStreamTextureNV(a0,a1,a2,a3,a4);}},
+{"glTexParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glTexParameterIuiv(a0,a1,a2);}},
+{"glFlushPixelDataRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glFlushPixelDataRangeNV(a0);}},
+{"glWindowPos3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos3fv(a0);}},
+{"glVertexAttribLFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();table.glVertexAttribLFormatNV(a0,a1,a2,a3);}},
+{"glLightModelfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glLightModelfv(a0,a1);}},
+{"glGetColorTableSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glGetColorTableSGI(a0,a1,a2,a3);}},
+{"glGetCompressedTexImageARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<void*>();table.glGetCompressedTexImageARB(a0,a1,a2);}},
+{"glConvolutionParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glConvolutionParameteri(a0,a1,a2);}},
+{"glVertexWeighthNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();table.glVertexWeighthNV(a0);}},
+{"glColorMaskIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLboolean>();table.glColorMaskIndexedEXT(a0,a1,a2,a3,a4);}},
+{"glColorMaski",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLboolean>();table.glColorMaski(a0,a1,a2,a3,a4);}},
+{"glColorFragmentOp1ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();table.glColorFragmentOp1ATI(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribI4ubvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttribI4ubvEXT(a0,a1);}},
+{"glVertexAttrib1dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();table.glVertexAttrib1dNV(a0,a1);}},
+{"glUnmapObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glUnmapObjectBufferATI(a0);}},
+{"glNamedProgramLocalParameterI4uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();table.glNamedProgramLocalParameterI4uiEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProgramUniform1iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glProgramUniform1iEXT(a0,a1,a2);}},
+{"glDeleteQueriesARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteQueriesARB(a0,a1);}},
+{"glWindowPos3svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos3svARB(a0);}},
+{"glVertex4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glVertex4s(a0,a1,a2,a3);}},
+{"glImportMemoryWin32NameEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();table.glImportMemoryWin32NameEXT(a0,a1,a2,a3);}},
+{"glStringMarkerGREMEDY",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const void*>();table.glStringMarkerGREMEDY(a0,a1);}},
+{"glIsTransformFeedback",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsTransformFeedback(a0);}},
+{"glProgramUniformMatrix2x3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2x3dvEXT(a0,a1,a2,a3,a4);}},
+{"glGetObjectLabelEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLchar*>();table.glGetObjectLabelEXT(a0,a1,a2,a3,a4);}},
+{"glUniformHandleui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniformHandleui64vNV(a0,a1,a2);}},
+{"glRotated",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glRotated(a0,a1,a2,a3);}},
+{"glIsProgramPipeline",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsProgramPipeline(a0);}},
+{"glRotatef",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glRotatef(a0,a1,a2,a3);}},
+{"glVertex4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glVertex4i(a0,a1,a2,a3);}},
+{"glGetActiveSubroutineUniformName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLchar*>();table.glGetActiveSubroutineUniformName(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib4sNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glVertexAttrib4sNV(a0,a1,a2,a3,a4);}},
+{"glProgramLocalParameter4dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLdouble*>();table.glProgramLocalParameter4dvARB(a0,a1,a2);}},
+{"glReplacementCodeubSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();table.glReplacementCodeubSUN(a0);}},
+{"glMultiDrawElementsIndirectBindlessNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();table.glMultiDrawElementsIndirectBindlessNV(a0,a1,a2,a3,a4,a5);}},
+{"glImportSemaphoreWin32HandleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void*>();table.glImportSemaphoreWin32HandleEXT(a0,a1,a2);}},
+{"glUniformMatrix3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix3fv(a0,a1,a2,a3);}},
+{"glGetnMapfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLfloat*>();table.glGetnMapfvARB(a0,a1,a2,a3);}},
+{"glGetnUniformfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLfloat*>();table.glGetnUniformfv(a0,a1,a2,a3);}},
+{"glVertexAttribL2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL2dv(a0,a1);}},
+{"glVertexWeightPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glVertexWeightPointerEXT(a0,a1,a2,a3);}},
+{"glTangent3sEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glTangent3sEXT(a0,a1,a2);}},
+{"glSecondaryColorPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glSecondaryColorPointer(a0,a1,a2,a3);}},
+{"glAlphaFunc",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLclampf>();table.glAlphaFunc(a0,a1);}},
+{"glGetNamedStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLchar*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint*>();auto const a4 = call.pointer<GLchar*>();table.glGetNamedStringARB(a0,a1,a2,a3,a4);}},
+{"glTexCoord4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glTexCoord4d(a0,a1,a2,a3);}},
+{"glBufferPageCommitmentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLboolean>();table.glBufferPageCommitmentARB(a0,a1,a2,a3);}},
+{"glProgramLocalParameters4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramLocalParameters4fvEXT(a0,a1,a2,a3);}},
+{"glStencilFunc",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glStencilFunc(a0,a1,a2);}},
+{"glSemaphoreParameterui64vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint64*>();table.glSemaphoreParameterui64vEXT(a0,a1,a2);}},
+{"glGetVertexAttribdvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetVertexAttribdvNV(a0,a1,a2);}},
+{"glTexCoord3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glTexCoord3dv(a0);}},
+{"glGetQueryBufferObjectiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLintptr>();table.glGetQueryBufferObjectiv(a0,a1,a2,a3);}},
+{"glTexGenxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glTexGenxOES(a0,a1,a2);}},
+{"glMultiTexCoord1fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord1fvARB(a0,a1);}},
+{"glLightEnviSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glLightEnviSGIX(a0,a1);}},
+{"glGetProgramPipelineiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetProgramPipelineiv(a0,a1,a2);}},
+{"glVertexStream2ivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glVertexStream2ivATI(a0,a1);}},
+{"glGetColorTableEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glGetColorTableEXT(a0,a1,a2,a3);}},
+{"glGetShaderInfoLog",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetShaderInfoLog(a0,a1,a2,a3);}},
+{"glGetOcclusionQueryuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetOcclusionQueryuivNV(a0,a1,a2);}},
+{"glInvalidateNamedFramebufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();table.glInvalidateNamedFramebufferSubData(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribL1i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint64EXT>();table.glVertexAttribL1i64NV(a0,a1);}},
+{"glVDPAUInitNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const void*>();auto const a1 = call.pointer<const void*>();table.glVDPAUInitNV(a0,a1);}},
+{"glVertexAttrib1hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLhalfNV*>();table.glVertexAttrib1hvNV(a0,a1);}},
+{"glVertexAttribI4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glVertexAttribI4i(a0,a1,a2,a3,a4);}},
+{"glRasterPos2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glRasterPos2iv(a0);}},
+{"glGetIntegerui64i_vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetIntegerui64i_vNV(a0,a1,a2);}},
+{"glUniformHandleui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();table.glUniformHandleui64NV(a0,a1);}},
+{"glWindowPos3ivMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos3ivMESA(a0);}},
+{"glBlendEquationSeparate",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationSeparate(a0,a1);}},
+{"glDrawElementsInstancedARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();table.glDrawElementsInstancedARB(a0,a1,a2,a3,a4);}},
+{"glGetSubroutineIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLchar*>();table.glGetSubroutineIndex(a0,a1,a2);}},
+{"glVertexAttrib2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib2sv(a0,a1);}},
+{"glSamplePatternSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glSamplePatternSGIS(a0);}},
+{"glEGLImageTargetRenderbufferStorageOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLeglImageOES>();table.glEGLImageTargetRenderbufferStorageOES(a0,a1);}},
+{"glPushAttrib",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glPushAttrib(a0);}},
+{"glVertex3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glVertex3hNV(a0,a1,a2);}},
+{"glRasterPos3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glRasterPos3xvOES(a0);}},
+{"glPathParameterfNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glPathParameterfNV(a0,a1,a2);}},
+{"glGetUniformi64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLint64EXT*>();table.glGetUniformi64vNV(a0,a1,a2);}},
+{"glLightiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glLightiv(a0,a1,a2);}},
+{"glMaterialxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glMaterialxvOES(a0,a1,a2);}},
+{"glNamedProgramLocalParameter4fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();table.glNamedProgramLocalParameter4fEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribL1dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();table.glVertexAttribL1dEXT(a0,a1);}},
+{"glGetnUniformdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLdouble*>();table.glGetnUniformdvARB(a0,a1,a2,a3);}},
+{"glSecondaryColor3bEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glSecondaryColor3bEXT(a0,a1,a2);}},
+{"glBeginPerfQueryINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBeginPerfQueryINTEL(a0);}},
+{"glProgramUniform1uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform1uivEXT(a0,a1,a2,a3);}},
+{"glImageTransformParameterivHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glImageTransformParameterivHP(a0,a1,a2);}},
+{"glDeleteBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteBuffers(a0,a1);}},
+{"glBindProgramPipeline",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBindProgramPipeline(a0);}},
+{"glScissor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glScissor(a0,a1,a2,a3);}},
+{"glProgramUniform4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform4fv(a0,a1,a2,a3);}},
+{"glGetBooleanv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLboolean*>();table.glGetBooleanv(a0,a1);}},
+{"glMaterialfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glMaterialfv(a0,a1,a2);}},
+{"glWindowPos4fvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos4fvMESA(a0);}},
+{"glVertexAttribIPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexAttribIPointerEXT(a0,a1,a2,a3,a4);}},
+{"glProgramBufferParametersfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramBufferParametersfvNV(a0,a1,a2,a3,a4);}},
+{"glAlphaFuncxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glAlphaFuncxOES(a0,a1);}},
+{"glMultiDrawArraysIndirectAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glMultiDrawArraysIndirectAMD(a0,a1,a2,a3);}},
+{"glNormalStream3ivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glNormalStream3ivATI(a0,a1);}},
+{"glTextureImage3DMultisampleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLboolean>();table.glTextureImage3DMultisampleNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glProgramUniform4uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform4uivEXT(a0,a1,a2,a3);}},
+{"glReplacementCodeusvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLushort*>();table.glReplacementCodeusvSUN(a0);}},
+{"glPollInstrumentsSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLint*>();table.glPollInstrumentsSGIX(a0);}},
+{"glGetTextureLevelParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetTextureLevelParameteriv(a0,a1,a2,a3);}},
+{"glVertexAttribI2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI2uiv(a0,a1);}},
+{"glMapControlPointsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLboolean>();auto const a8 = call.pointer<const void*>();table.glMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glColor4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glColor4dv(a0);}},
+{"glInvalidateBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();table.glInvalidateBufferSubData(a0,a1,a2);}},
+{"glMultiTexCoord1hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLhalfNV>();table.glMultiTexCoord1hNV(a0,a1);}},
+{"glPointParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPointParameterfv(a0,a1);}},
+{"glUniformMatrix2fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix2fvARB(a0,a1,a2,a3);}},
+{"glUniform2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform2fv(a0,a1,a2);}},
+{"glVertexPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const void**>();auto const a4 = call.scalar<GLint>();table.glVertexPointerListIBM(a0,a1,a2,a3,a4);}},
+{"glGetMultiTexGenfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetMultiTexGenfvEXT(a0,a1,a2,a3);}},
+{"glGetMinmaxEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<void*>();table.glGetMinmaxEXT(a0,a1,a2,a3,a4);}},
+{"glIsFenceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsFenceNV(a0);}},
+{"glMatrixFrustumEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();table.glMatrixFrustumEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glDispatchComputeIndirect",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLintptr>();table.glDispatchComputeIndirect(a0);}},
+{"glQueryResourceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLint*>();table.glQueryResourceNV(a0,a1,a2,a3);}},
+{"glMultiTexCoord4bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();auto const a4 = call.scalar<GLbyte>();table.glMultiTexCoord4bOES(a0,a1,a2,a3,a4);}},
+{"glProgramEnvParameter4dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glProgramEnvParameter4dARB(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniform1uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glProgramUniform1uiEXT(a0,a1,a2);}},
+{"glBindBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glBindBufferRange(a0,a1,a2,a3,a4);}},
+{"glNormal3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glNormal3iv(a0);}},
+{"glVertexAttribL3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL3dv(a0,a1);}},
+{"glGetUniformdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLdouble*>();table.glGetUniformdv(a0,a1,a2);}},
+{"glGetMultiTexLevelParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLfloat*>();table.glGetMultiTexLevelParameterfvEXT(a0,a1,a2,a3,a4);}},
+{"glFinalCombinerInputNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glFinalCombinerInputNV(a0,a1,a2,a3);}},
+{"glCullParameterdvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLdouble*>();table.glCullParameterdvEXT(a0,a1);}},
+{"glMultiTexCoord4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glMultiTexCoord4s(a0,a1,a2,a3,a4);}},
+{"glMapVertexAttrib1fAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.pointer<const GLfloat*>();table.glMapVertexAttrib1fAPPLE(a0,a1,a2,a3,a4,a5,a6);}},
+{"glConvolutionParameterfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glConvolutionParameterfEXT(a0,a1,a2);}},
+{"glTexCoord1iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glTexCoord1iv(a0);}},
+{"glProgramUniform3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform3fvEXT(a0,a1,a2,a3);}},
+{"glColor3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();table.glColor3uiv(a0);}},
+{"glRenderGpuMaskNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glRenderGpuMaskNV(a0);}},
+{"glListBase",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glListBase(a0);}},
+{"glTexCoord2bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();table.glTexCoord2bOES(a0,a1);}},
+{"glBindMaterialParameterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBindMaterialParameterEXT(a0,a1);}},
+{"glGlobalAlphaFactorubSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();table.glGlobalAlphaFactorubSUN(a0);}},
+{"glVertexAttribL1ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();table.glVertexAttribL1ui64NV(a0,a1);}},
+{"glPointParameterfSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPointParameterfSGIS(a0,a1);}},
+{"glGetImageTransformParameterivHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetImageTransformParameterivHP(a0,a1,a2);}},
+{"glColorSubTableEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glColorSubTableEXT(a0,a1,a2,a3,a4,a5);}},
+{"glPixelTexGenParameterfvSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPixelTexGenParameterfvSGIS(a0,a1);}},
+{"glClientWaitSync",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.sync();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint64>();table.glClientWaitSync(a0,a1,a2);}},
+{"glQueryObjectParameteruiAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glQueryObjectParameteruiAMD(a0,a1,a2,a3);}},
+{"glVertexAttribs1fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glVertexAttribs1fvNV(a0,a1,a2);}},
+{"glVertexAttrib4NusvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttrib4NusvARB(a0,a1);}},
+{"glVariantPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const void*>();table.glVariantPointerEXT(a0,a1,a2,a3);}},
+{"glTextureBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glTextureBuffer(a0,a1,a2);}},
+{"glVertexAttribI1uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexAttribI1uiEXT(a0,a1);}},
+{"glInvalidateTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glInvalidateTexImage(a0,a1);}},
+{"glProgramEnvParametersI4ivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramEnvParametersI4ivNV(a0,a1,a2,a3);}},
+{"glPathGlyphIndexArrayNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLfloat>();table.glPathGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glCopyImageSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.scalar<GLint>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLsizei>();auto const a13 = call.scalar<GLsizei>();auto const a14 = call.scalar<GLsizei>();table.glCopyImageSubData(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}},
+{"glGetUniformSubroutineuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLuint*>();table.glGetUniformSubroutineuiv(a0,a1,a2);}},
+{"glBindVertexBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizei>();table.glBindVertexBuffer(a0,a1,a2,a3);}},
+{"glMultiTexCoord1iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glMultiTexCoord1iARB(a0,a1);}},
+{"glDebugMessageInsert",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<const GLchar*>();table.glDebugMessageInsert(a0,a1,a2,a3,a4,a5);}},
+{"glBeginVertexShaderEXT",[](FunctionTable const&table,ReplayCall&){table.glBeginVertexShaderEXT();}},
+{"glIsVariantEnabledEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glIsVariantEnabledEXT(a0,a1);}},
+{"glPassThroughxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glPassThroughxOES(a0);}},
+{"glIsSampler",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsSampler(a0);}},
+{"glConservativeRasterParameterfNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glConservativeRasterParameterfNV(a0,a1);}},
+{"glMultiTexGenivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glMultiTexGenivEXT(a0,a1,a2,a3);}},
+{"glNamedFramebufferTexture2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glNamedFramebufferTexture2DEXT(a0,a1,a2,a3,a4);}},
+{"glCopyTexSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();table.glCopyTexSubImage1D(a0,a1,a2,a3,a4,a5);}},
+{"glTexCoord1i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glTexCoord1i(a0);}},
+{"glCheckFramebufferStatus",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCheckFramebufferStatus(a0);}},
+{"glDrawElementArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();table.glDrawElementArrayAPPLE(a0,a1,a2);}},
+{"glTexCoord1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glTexCoord1d(a0);}},
+{"glTexCoord1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glTexCoord1f(a0);}},
+{"glFragmentLightivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glFragmentLightivSGIX(a0,a1,a2);}},
+{"glBindImageTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLenum>();table.glBindImageTexture(a0,a1,a2,a3,a4,a5,a6);}},
+{"glTransformFeedbackVaryings",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();auto const a3 = call.scalar<GLenum>();table.glTransformFeedbackVaryings(a0,a1,a2,a3);}},
+{"glMulticastBufferSubDataNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizeiptr>();auto const a4 = call.pointer<const GLvoid*>();table.glMulticastBufferSubDataNV(a0,a1,a2,a3,a4);}},
+{"glDrawRangeElements",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const GLvoid*>();table.glDrawRangeElements(a0,a1,a2,a3,a4,a5);}},
+{"glTexCoord1s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();table.glTexCoord1s(a0);}},
+{"glBindBufferBase",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glBindBufferBase(a0,a1,a2);}},
+{"glColor3bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glColor3bv(a0);}},
+{"glSyncTextureINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glSyncTextureINTEL(a0);}},
+{"glCreateSamplers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateSamplers(a0,a1);}},
+{"glCombinerParameterfNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glCombinerParameterfNV(a0,a1);}},
+{"glGetArrayObjectivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetArrayObjectivATI(a0,a1,a2);}},
+{"glMultiDrawArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.scalar<GLsizei>();table.glMultiDrawArrays(a0,a1,a2,a3);}},
+{"glSampleMapATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();table.glSampleMapATI(a0,a1,a2);}},
+{"glProgramUniform2i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64>();auto const a3 = call.scalar<GLint64>();table.glProgramUniform2i64ARB(a0,a1,a2,a3);}},
+{"glBinormal3ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glBinormal3ivEXT(a0);}},
+{"glMultiDrawArraysIndirectCountARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawArraysIndirectCountARB(a0,a1,a2,a3,a4);}},
+{"glTextureStorageMem1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint64>();table.glTextureStorageMem1DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glWindowPos2ivMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos2ivMESA(a0);}},
+{"glTexCoordP4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTexCoordP4ui(a0,a1);}},
+{"glMultiTexSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const void*>();table.glMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glProgramUniformMatrix2x3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2x3fvEXT(a0,a1,a2,a3,a4);}},
+{"glBufferDataARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizeiptrARB>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLenum>();table.glBufferDataARB(a0,a1,a2,a3);}},
+{"glVertexAttribIFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribIFormat(a0,a1,a2,a3);}},
+{"glCreateFramebuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateFramebuffers(a0,a1);}},
+{"glNormalStream3dvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glNormalStream3dvATI(a0,a1);}},
+{"glClearAccum",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glClearAccum(a0,a1,a2,a3);}},
+{"glUniform3i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64EXT*>();table.glUniform3i64vNV(a0,a1,a2);}},
+{"glNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5);}},
+{"glUniform2uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform2uivEXT(a0,a1,a2);}},
+{"glBeginQuery",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBeginQuery(a0,a1);}},
+{"glStencilThenCoverStrokePathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const GLfloat*>();table.glStencilThenCoverStrokePathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glBindBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindBuffer(a0,a1);}},
+{"glMap2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.pointer<const GLdouble*>();table.glMap2d(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glMap2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.pointer<const GLfloat*>();table.glMap2f(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glMakeImageHandleResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();auto const a1 = call.scalar<GLenum>();table.glMakeImageHandleResidentNV(a0,a1);}},
+{"glUniformMatrix2x4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix2x4fv(a0,a1,a2,a3);}},
+{"glGetMultiTexParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetMultiTexParameterfvEXT(a0,a1,a2,a3);}},
+{"glDepthRangeIndexed",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glDepthRangeIndexed(a0,a1,a2);}},
+{"glIsEnabled",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glIsEnabled(a0);}},
+{"glMatrixScalefEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glMatrixScalefEXT(a0,a1,a2,a3);}},
+{"glGetError",[](FunctionTable const&table,ReplayCall&){table.glGetError();}},
+{"glGetTexEnviv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTexEnviv(a0,a1,a2);}},
+{"glBindTextureUnitParameterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBindTextureUnitParameterEXT(a0,a1);}},
+{"glGetnUniformfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLfloat*>();table.glGetnUniformfvARB(a0,a1,a2,a3);}},
+{"glReplacementCodeuiNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glReplacementCodeuiNormal3fVertex3fvSUN(a0,a1,a2);}},
+{"glDeletePerfQueryINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDeletePerfQueryINTEL(a0);}},
+{"glActiveVaryingNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glActiveVaryingNV(a0,a1);}},
+{"glGetActiveUniformARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLcharARB*>();table.glGetActiveUniformARB(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribI3ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI3ivEXT(a0,a1);}},
+{"glEvalCoord1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glEvalCoord1d(a0);}},
+{"glNamedCopyBufferSubDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glNamedCopyBufferSubDataEXT(a0,a1,a2,a3,a4);}},
+{"glEvalCoord1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glEvalCoord1f(a0);}},
+{"glPixelMapfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glPixelMapfv(a0,a1,a2);}},
+{"glVertexAttribI1ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI1ivEXT(a0,a1);}},
+{"glCreateSyncFromCLeventARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<struct _cl_context*>();auto const a1 = call.pointer<struct _cl_event*>();auto const a2 = call.scalar<GLbitfield>();call.mapSync(table.glCreateSyncFromCLeventARB(a0,a1,a2));}},
+{"glGetPixelMapusv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLushort*>();table.glGetPixelMapusv(a0,a1);}},
+{"glGetnColorTableARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();table.glGetnColorTableARB(a0,a1,a2,a3,a4);}},
+{"glAccum",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glAccum(a0,a1);}},
+{"glRasterPos3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glRasterPos3sv(a0);}},
+{"glTexCoord2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glTexCoord2iv(a0);}},
+{"glBlendFunciARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendFunciARB(a0,a1,a2);}},
+{"glProgramUniform3i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64*>();table.glProgramUniform3i64vARB(a0,a1,a2,a3);}},
+{"glGetFramebufferAttachmentParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetFramebufferAttachmentParameteriv(a0,a1,a2,a3);}},
+{"glProgramUniform4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glProgramUniform4ui(a0,a1,a2,a3,a4,a5);}},
+{"glStencilMask",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glStencilMask(a0);}},
+{"glResetHistogramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glResetHistogramEXT(a0);}},
+{"glLightxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glLightxOES(a0,a1,a2);}},
+{"glNamedBufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLenum>();table.glNamedBufferData(a0,a1,a2,a3);}},
+{"glVertexStream3sATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glVertexStream3sATI(a0,a1,a2,a3);}},
+{"glVertexAttrib3fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib3fvARB(a0,a1);}},
+{"glClearNamedBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizeiptr>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glClearNamedBufferSubData(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProgramUniformHandleui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();table.glProgramUniformHandleui64ARB(a0,a1,a2);}},
+{"glUniform3iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glUniform3iARB(a0,a1,a2,a3);}},
+{"glCreateProgramObjectARB",[](FunctionTable const&table,ReplayCall&){table.glCreateProgramObjectARB();}},
+{"glMultiTexCoord1dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord1dvARB(a0,a1);}},
+{"glGetObjectParameterfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetObjectParameterfvARB(a0,a1,a2);}},
+{"glRectsv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();auto const a1 = call.pointer<const GLshort*>();table.glRectsv(a0,a1);}},
+{"glMultiTexImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const void*>();table.glMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glProgramUniform1i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64EXT>();table.glProgramUniform1i64NV(a0,a1,a2);}},
+{"glGetObjectBufferivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetObjectBufferivATI(a0,a1,a2);}},
+{"glUniform4i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64>();auto const a2 = call.scalar<GLint64>();auto const a3 = call.scalar<GLint64>();auto const a4 = call.scalar<GLint64>();table.glUniform4i64ARB(a0,a1,a2,a3,a4);}},
+{"glReplacementCodeuiColor4ubVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLubyte*>();auto const a2 = call.pointer<const GLfloat*>();table.glReplacementCodeuiColor4ubVertex3fvSUN(a0,a1,a2);}},
+{"glBlendFuncSeparateINGR",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glBlendFuncSeparateINGR(a0,a1,a2,a3);}},
+{"glGetVideoCaptureStreamfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetVideoCaptureStreamfvNV(a0,a1,a2,a3);}},
+{"glVertexAttrib2fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glVertexAttrib2fARB(a0,a1,a2);}},
+{"glGetTexGeniv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTexGeniv(a0,a1,a2);}},
+{"glPixelStorei",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPixelStorei(a0,a1);}},
+{"glGetCompressedTextureSubImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.pointer<void*>();table.glGetCompressedTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glCopyImageSubDataNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.scalar<GLint>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLsizei>();auto const a13 = call.scalar<GLsizei>();auto const a14 = call.scalar<GLsizei>();table.glCopyImageSubDataNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14);}},
+{"glActiveShaderProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glActiveShaderProgram(a0,a1);}},
+{"glVertexStream1iATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glVertexStream1iATI(a0,a1);}},
+{"glPatchParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPatchParameterfv(a0,a1);}},
+{"glIsFramebufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsFramebufferEXT(a0);}},
+{"glTextureStorage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glTextureStorage2D(a0,a1,a2,a3,a4);}},
+{"glProgramUniform1ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();table.glProgramUniform1ui64ARB(a0,a1,a2);}},
+{"glTexBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glTexBufferRange(a0,a1,a2,a3,a4);}},
+{"glGetPixelTexGenParameterivSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLint*>();table.glGetPixelTexGenParameterivSGIS(a0,a1);}},
+{"glTextureSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLenum>();auto const a11 = call.pointer<const void*>();table.glTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glClipControl",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glClipControl(a0,a1);}},
+{"glGetProgramResourceiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLenum*>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<GLsizei*>();auto const a7 = call.pointer<GLint*>();table.glGetProgramResourceiv(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMultiTexCoordP2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glMultiTexCoordP2uiv(a0,a1,a2);}},
+{"glVertexAttribI3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribI3ui(a0,a1,a2,a3);}},
+{"glSampleMaskSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();auto const a1 = call.scalar<GLboolean>();table.glSampleMaskSGIS(a0,a1);}},
+{"glVertexAttrib4NivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttrib4NivARB(a0,a1);}},
+{"glGlobalAlphaFactorfSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glGlobalAlphaFactorfSUN(a0);}},
+{"glBlendEquationSeparateIndexedAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendEquationSeparateIndexedAMD(a0,a1,a2);}},
+{"glGetPerfCounterInfoINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLchar*>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.pointer<GLchar*>();auto const a6 = call.pointer<GLuint*>();auto const a7 = call.pointer<GLuint*>();auto const a8 = call.pointer<GLuint*>();auto const a9 = call.pointer<GLuint*>();auto const a10 = call.pointer<GLuint64*>();table.glGetPerfCounterInfoINTEL(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glDeleteProgramsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteProgramsNV(a0,a1);}},
+{"glPixelZoomxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glPixelZoomxOES(a0,a1);}},
+{"glGetCombinerOutputParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetCombinerOutputParameterivNV(a0,a1,a2,a3);}},
+{"glRasterPos2xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glRasterPos2xvOES(a0);}},
+{"glGetTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLvoid*>();table.glGetTexImage(a0,a1,a2,a3,a4);}},
+{"glVertexArrayVertexBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.pointer<const GLintptr*>();auto const a5 = call.pointer<const GLsizei*>();table.glVertexArrayVertexBuffers(a0,a1,a2,a3,a4,a5);}},
+{"glUniform1ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64EXT>();table.glUniform1ui64NV(a0,a1);}},
+{"glProgramParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glProgramParameteri(a0,a1,a2);}},
+{"glNormal3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glNormal3xOES(a0,a1,a2);}},
+{"glGetMapfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetMapfv(a0,a1,a2);}},
+{"glVertexStream2dvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexStream2dvATI(a0,a1);}},
+{"glPathStencilDepthOffsetNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glPathStencilDepthOffsetNV(a0,a1);}},
+{"glIsStateNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsStateNV(a0);}},
+{"glGetIntegerui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLuint64EXT*>();table.glGetIntegerui64vNV(a0,a1);}},
+{"glGetImageTransformParameterfvHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetImageTransformParameterfvHP(a0,a1,a2);}},
+{"glRasterPos2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glRasterPos2fv(a0);}},
+{"glVertex3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glVertex3xOES(a0,a1);}},
+{"glIsMemoryObjectEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsMemoryObjectEXT(a0);}},
+{"glWeightPointerARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glWeightPointerARB(a0,a1,a2,a3);}},
+{"glFinishFenceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glFinishFenceNV(a0);}},
+{"glDepthRangexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glDepthRangexOES(a0,a1);}},
+{"glEnableVertexArrayAttribEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glEnableVertexArrayAttribEXT(a0,a1);}},
+{"glProgramUniform2uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform2uivEXT(a0,a1,a2,a3);}},
+{"glGetDoubleIndexedvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLdouble*>();table.glGetDoubleIndexedvEXT(a0,a1,a2);}},
+{"glWindowPos2fMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glWindowPos2fMESA(a0,a1);}},
+{"glSecondaryColor3b",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glSecondaryColor3b(a0,a1,a2);}},
+{"glCopyConvolutionFilter1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyConvolutionFilter1DEXT(a0,a1,a2,a3,a4);}},
+{"glWindowPos2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos2sv(a0);}},
+{"glBindFramebufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindFramebufferEXT(a0,a1);}},
+{"glCreateShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCreateShader(a0);}},
+{"glGenPathsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();table.glGenPathsNV(a0);}},
+{"glGenRenderbuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenRenderbuffers(a0,a1);}},
+{"glCopyTexSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();table.glCopyTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glVertexAttrib4ubvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttrib4ubvARB(a0,a1);}},
+{"glDrawTextureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();table.glDrawTextureNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glVertexAttribs1svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLshort*>();table.glVertexAttribs1svNV(a0,a1,a2);}},
+{"glClearNamedBufferSubDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLsizeiptr>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glClearNamedBufferSubDataEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glBlendFuncSeparate",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glBlendFuncSeparate(a0,a1,a2,a3);}},
+{"glPointParameterfARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPointParameterfARB(a0,a1);}},
+{"glTexCoord2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glTexCoord2fv(a0);}},
+{"glGetVariantFloatvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVariantFloatvEXT(a0,a1,a2);}},
+{"glVertexP2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glVertexP2ui(a0,a1);}},
+{"glWindowPos2dMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glWindowPos2dMESA(a0,a1);}},
+{"glTexCoord4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glTexCoord4fv(a0);}},
+{"glBindFragDataLocationEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLchar*>();table.glBindFragDataLocationEXT(a0,a1,a2);}},
+{"glCompressedTexSubImage1DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<const void*>();table.glCompressedTexSubImage1DARB(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetTextureImageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<void*>();table.glGetTextureImageEXT(a0,a1,a2,a3,a4,a5);}},
+{"glFogCoordd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glFogCoordd(a0);}},
+{"glPointSize",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glPointSize(a0);}},
+{"glBindTextureUnit",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glBindTextureUnit(a0,a1);}},
+{"glProgramEnvParameterI4uiNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glProgramEnvParameterI4uiNV(a0,a1,a2,a3,a4,a5);}},
+{"glGetProgramPipelineInfoLog",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetProgramPipelineInfoLog(a0,a1,a2,a3);}},
+{"glProgramUniform4i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64*>();table.glProgramUniform4i64vARB(a0,a1,a2,a3);}},
+{"glVertexAttrib4Nuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttrib4Nuiv(a0,a1);}},
+{"glGetUniformfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLfloat*>();table.glGetUniformfvARB(a0,a1,a2);}},
+{"glWaitSync",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.sync();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint64>();table.glWaitSync(a0,a1,a2);}},
+{"glUniform3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glUniform3i(a0,a1,a2,a3);}},
+{"glBlendEquationSeparatei",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendEquationSeparatei(a0,a1,a2);}},
+{"glVertexAttrib2hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLhalfNV*>();table.glVertexAttrib2hvNV(a0,a1);}},
+{"glTextureParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glTextureParameterivEXT(a0,a1,a2,a3);}},
+{"glUniform3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glUniform3d(a0,a1,a2,a3);}},
+{"glUniform3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glUniform3f(a0,a1,a2,a3);}},
+{"glActiveProgramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glActiveProgramEXT(a0);}},
+{"glProgramUniform3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform3uiv(a0,a1,a2,a3);}},
+{"glUniform3ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniform3ui64vARB(a0,a1,a2);}},
+{"glProgramUniform1ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniform1ui64vARB(a0,a1,a2,a3);}},
+{"glTextureParameterfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLfloat>();table.glTextureParameterfEXT(a0,a1,a2,a3);}},
+{"glSetFragmentShaderConstantATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glSetFragmentShaderConstantATI(a0,a1);}},
+{"glColorSubTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const GLvoid*>();table.glColorSubTable(a0,a1,a2,a3,a4,a5);}},
+{"glReplacementCodeuiSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glReplacementCodeuiSUN(a0);}},
+{"glStateCaptureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glStateCaptureNV(a0,a1);}},
+{"glBindAttribLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLchar*>();table.glBindAttribLocation(a0,a1,a2);}},
+{"glWeightusvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLushort*>();table.glWeightusvARB(a0,a1);}},
+{"glGetFragDataIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetFragDataIndex(a0,a1);}},
+{"glMultiTexCoord2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glMultiTexCoord2xOES(a0,a1,a2);}},
+{"glColor3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glColor3sv(a0);}},
+{"glTexCoord2fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4);}},
+{"glGetMemoryObjectParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMemoryObjectParameterivEXT(a0,a1,a2);}},
+{"glPolygonOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glPolygonOffsetEXT(a0,a1);}},
+{"glWeightPathsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.pointer<const GLfloat*>();table.glWeightPathsNV(a0,a1,a2,a3);}},
+{"glCombinerStageParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glCombinerStageParameterfvNV(a0,a1,a2);}},
+{"glPointParameterfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPointParameterfEXT(a0,a1);}},
+{"glCopyTexImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();table.glCopyTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertex4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glVertex4sv(a0);}},
+{"glMatrixMultfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixMultfEXT(a0,a1);}},
+{"glCompressedTextureSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLsizei>();auto const a11 = call.pointer<const void*>();table.glCompressedTextureSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glGetTexLevelParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfixed*>();table.glGetTexLevelParameterxvOES(a0,a1,a2,a3);}},
+{"glVertexAttribL3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL3dvEXT(a0,a1);}},
+{"glMultiTexCoordP4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glMultiTexCoordP4ui(a0,a1,a2);}},
+{"glGetTextureLevelParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLint*>();table.glGetTextureLevelParameterivEXT(a0,a1,a2,a3,a4);}},
+{"glAlphaFragmentOp2ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint>();table.glAlphaFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glDeleteFramebuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteFramebuffers(a0,a1);}},
+{"glDrawArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();table.glDrawArrays(a0,a1,a2);}},
+{"glGetTransformFeedbackiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTransformFeedbackiv(a0,a1,a2);}},
+{"glGetnTexImageARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnTexImageARB(a0,a1,a2,a3,a4,a5);}},
+{"glClear",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glClear(a0);}},
+{"glVertexArrayParameteriAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glVertexArrayParameteriAPPLE(a0,a1);}},
+{"glMultiTexCoord2dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord2dvARB(a0,a1);}},
+{"glGetVideoCaptureStreamdvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLdouble*>();table.glGetVideoCaptureStreamdvNV(a0,a1,a2,a3);}},
+{"glFragmentLightModelivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glFragmentLightModelivSGIX(a0,a1);}},
+{"glVertexAttribP2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribP2ui(a0,a1,a2,a3);}},
+{"glMultiTexCoordPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glMultiTexCoordPointerEXT(a0,a1,a2,a3,a4);}},
+{"glProgramUniform3iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glProgramUniform3iEXT(a0,a1,a2,a3,a4);}},
+{"glTranslatef",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glTranslatef(a0,a1,a2);}},
+{"glVertexAttrib4Nub",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLubyte>();table.glVertexAttrib4Nub(a0,a1,a2,a3,a4);}},
+{"glTranslated",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glTranslated(a0,a1,a2);}},
+{"glSamplerParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glSamplerParameterIiv(a0,a1,a2);}},
+{"glTexCoord4hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();table.glTexCoord4hNV(a0,a1,a2,a3);}},
+{"glDrawElementsIndirect",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();table.glDrawElementsIndirect(a0,a1,a2);}},
+{"glDeletePerfMonitorsAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glDeletePerfMonitorsAMD(a0,a1);}},
+{"glIsRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsRenderbufferEXT(a0);}},
+{"glDrawCommandsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLintptr*>();auto const a3 = call.pointer<const GLsizei*>();auto const a4 = call.scalar<GLuint>();table.glDrawCommandsNV(a0,a1,a2,a3,a4);}},
+{"glUniform3ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform3ivARB(a0,a1,a2);}},
+{"glBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<const void*>();table.glBufferSubData(a0,a1,a2,a3);}},
+{"glSecondaryColor3bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glSecondaryColor3bv(a0);}},
+{"glMatrixMultTransposedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMatrixMultTransposedEXT(a0,a1);}},
+{"glRequestResidentProgramsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glRequestResidentProgramsNV(a0,a1);}},
+{"glAlphaFragmentOp1ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glAlphaFragmentOp1ATI(a0,a1,a2,a3,a4,a5);}},
+{"glGetQueryObjecti64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64*>();table.glGetQueryObjecti64v(a0,a1,a2);}},
+{"glMatrixMult3x3fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixMult3x3fNV(a0,a1);}},
+{"glColorTableParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glColorTableParameteriv(a0,a1,a2);}},
+{"glPathSubCommandsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLubyte*>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const void*>();table.glPathSubCommandsNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetFinalCombinerInputParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFinalCombinerInputParameterivNV(a0,a1,a2);}},
+{"glIsRenderbuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsRenderbuffer(a0);}},
+{"glVertex3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glVertex3iv(a0);}},
+{"glTexGenfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glTexGenfv(a0,a1,a2);}},
+{"glFrustumfOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glFrustumfOES(a0,a1,a2,a3,a4,a5);}},
+{"glBindVertexBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.pointer<const GLintptr*>();auto const a4 = call.pointer<const GLsizei*>();table.glBindVertexBuffers(a0,a1,a2,a3,a4);}},
+{"glMateriali",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glMateriali(a0,a1,a2);}},
+{"glMultiTexCoord2svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord2svARB(a0,a1);}},
+{"glDisableVertexAttribArray",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDisableVertexAttribArray(a0);}},
+{"glWindowPos3ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos3ivARB(a0);}},
+{"glTexCoordFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();table.glTexCoordFormatNV(a0,a1,a2);}},
+{"glBlitNamedFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.scalar<GLbitfield>();auto const a11 = call.scalar<GLenum>();table.glBlitNamedFramebuffer(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glMatrixLoadTransposefEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixLoadTransposefEXT(a0,a1);}},
+{"glMultiTexGenfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLfloat>();table.glMultiTexGenfEXT(a0,a1,a2,a3);}},
+{"glShaderStorageBlockBinding",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glShaderStorageBlockBinding(a0,a1,a2);}},
+{"glMaterialf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glMaterialf(a0,a1,a2);}},
+{"glReplacementCodeuiColor4fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();table.glReplacementCodeuiColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glCheckNamedFramebufferStatusEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glCheckNamedFramebufferStatusEXT(a0,a1);}},
+{"glVertexArrayVertexAttribFormatEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLboolean>();auto const a5 = call.scalar<GLuint>();table.glVertexArrayVertexAttribFormatEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertex2hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();table.glVertex2hNV(a0,a1);}},
+{"glDeleteVertexShaderEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDeleteVertexShaderEXT(a0);}},
+{"glTexImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const void*>();table.glTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glSignalVkFenceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glSignalVkFenceNV(a0);}},
+{"glProgramLocalParameterI4ivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLint*>();table.glProgramLocalParameterI4ivNV(a0,a1,a2);}},
+{"glGlobalAlphaFactoriSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glGlobalAlphaFactoriSUN(a0);}},
+{"glTextureStorage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();table.glTextureStorage1D(a0,a1,a2,a3);}},
+{"glBinormal3sEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glBinormal3sEXT(a0,a1,a2);}},
+{"glGetProgramInterfaceiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetProgramInterfaceiv(a0,a1,a2,a3);}},
+{"glMatrixIndexPointerARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glMatrixIndexPointerARB(a0,a1,a2,a3);}},
+{"glTexCoordPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glTexCoordPointerEXT(a0,a1,a2,a3,a4);}},
+{"glMultiTexGeniEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();table.glMultiTexGeniEXT(a0,a1,a2,a3);}},
+{"glVertexAttrib2fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glVertexAttrib2fNV(a0,a1,a2);}},
+{"glNamedProgramStringEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glNamedProgramStringEXT(a0,a1,a2,a3,a4);}},
+{"glMapNamedBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glMapNamedBuffer(a0,a1);}},
+{"glGetMinmaxParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMinmaxParameteriv(a0,a1,a2);}},
+{"glGetnUniformdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLdouble*>();table.glGetnUniformdv(a0,a1,a2,a3);}},
+{"glEndConditionalRenderNVX",[](FunctionTable const&table,ReplayCall&){table.glEndConditionalRenderNVX();}},
+{"glBinormal3fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glBinormal3fEXT(a0,a1,a2);}},
+{"glNormalStream3iATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glNormalStream3iATI(a0,a1,a2,a3);}},
+{"glProgramBufferParametersIivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLint*>();table.glProgramBufferParametersIivNV(a0,a1,a2,a3,a4);}},
+{"glMapGrid1xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glMapGrid1xOES(a0,a1,a2);}},
+{"glGetVertexAttribPointervARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetVertexAttribPointervARB(a0,a1,a2);}},
+{"glFlushMappedNamedBufferRangeEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();table.glFlushMappedNamedBufferRangeEXT(a0,a1,a2);}},
+{"glGetVertexAttribIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribIiv(a0,a1,a2);}},
+{"glVertexP4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glVertexP4uiv(a0,a1);}},
+{"glUniformui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64EXT>();table.glUniformui64NV(a0,a1);}},
+{"glColor4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glColor4fv(a0);}},
+{"glTexParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glTexParameterxvOES(a0,a1,a2);}},
+{"glPatchParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPatchParameteri(a0,a1);}},
+{"glMap1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.pointer<const GLdouble*>();table.glMap1d(a0,a1,a2,a3,a4,a5);}},
+{"glGetTexFilterFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetTexFilterFuncSGIS(a0,a1,a2);}},
+{"glVertexStream3dATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexStream3dATI(a0,a1,a2,a3);}},
+{"glVertexArrayVertexBindingDivisorEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexArrayVertexBindingDivisorEXT(a0,a1,a2);}},
+{"glMultiTexCoord3svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord3svARB(a0,a1);}},
+{"glBindProgramNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindProgramNV(a0,a1);}},
+{"glGetConvolutionParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetConvolutionParameteriv(a0,a1,a2);}},
+{"glGetProgramLocalParameterfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetProgramLocalParameterfvARB(a0,a1,a2);}},
+{"glGenFragmentShadersATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGenFragmentShadersATI(a0);}},
+{"glTexBumpParameterivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glTexBumpParameterivATI(a0,a1);}},
+{"glGetNamedFramebufferAttachmentParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetNamedFramebufferAttachmentParameteriv(a0,a1,a2,a3);}},
+{"glGetnSeparableFilter",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<void*>();auto const a7 = call.pointer<void*>();table.glGetnSeparableFilter(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glNormal3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glNormal3xvOES(a0);}},
+{"glPassTexCoordATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();table.glPassTexCoordATI(a0,a1,a2);}},
+{"glFramebufferTextureFaceARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();table.glFramebufferTextureFaceARB(a0,a1,a2,a3,a4);}},
+{"glProgramUniform1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform1dv(a0,a1,a2,a3);}},
+{"glTextureStorage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glTextureStorage2DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertexArrayFogCoordOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLintptr>();table.glVertexArrayFogCoordOffsetEXT(a0,a1,a2,a3,a4);}},
+{"glDeleteNamedStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLchar*>();table.glDeleteNamedStringARB(a0,a1);}},
+{"glMulticastGetQueryObjecti64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint64*>();table.glMulticastGetQueryObjecti64vNV(a0,a1,a2,a3);}},
+{"glGenOcclusionQueriesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenOcclusionQueriesNV(a0,a1);}},
+{"glLighti",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glLighti(a0,a1,a2);}},
+{"glTexImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const GLvoid*>();table.glTexImage1D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glLightf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glLightf(a0,a1,a2);}},
+{"glClientAttribDefaultEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glClientAttribDefaultEXT(a0);}},
+{"glVertexAttrib4bvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttrib4bvARB(a0,a1);}},
+{"glVertexAttribIFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();table.glVertexAttribIFormatNV(a0,a1,a2,a3);}},
+{"glStencilFuncSeparate",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLuint>();table.glStencilFuncSeparate(a0,a1,a2,a3);}},
+{"glGetVertexAttribfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVertexAttribfvARB(a0,a1,a2);}},
+{"glVertexAttrib2dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexAttrib2dNV(a0,a1,a2);}},
+{"glProgramUniform2iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glProgramUniform2iEXT(a0,a1,a2,a3);}},
+{"glClientActiveVertexStreamATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glClientActiveVertexStreamATI(a0);}},
+{"glRasterPos3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glRasterPos3xOES(a0,a1,a2);}},
+{"glGetMapParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMapParameterivNV(a0,a1,a2);}},
+{"glSampleCoverage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();auto const a1 = call.scalar<GLboolean>();table.glSampleCoverage(a0,a1);}},
+{"glClearDepthxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glClearDepthxOES(a0);}},
+{"glUniformBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glUniformBufferEXT(a0,a1,a2);}},
+{"glTexCoord2fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2);}},
+{"glMulticastGetQueryObjectuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLuint*>();table.glMulticastGetQueryObjectuivNV(a0,a1,a2,a3);}},
+{"glGetFirstPerfQueryIdINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLuint*>();table.glGetFirstPerfQueryIdINTEL(a0);}},
+{"glUnmapNamedBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glUnmapNamedBufferEXT(a0);}},
+{"glGetTransformFeedbacki_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLint*>();table.glGetTransformFeedbacki_v(a0,a1,a2,a3);}},
+{"glUniform4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform4fvARB(a0,a1,a2);}},
+{"glRenderbufferStorageMultisampleCoverageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glRenderbufferStorageMultisampleCoverageNV(a0,a1,a2,a3,a4,a5);}},
+{"glGetFloati_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetFloati_vEXT(a0,a1,a2);}},
+{"glBindAttribLocationARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLcharARB*>();table.glBindAttribLocationARB(a0,a1,a2);}},
+{"glBufferAddressRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLsizeiptr>();table.glBufferAddressRangeNV(a0,a1,a2,a3);}},
+{"glGenProgramsARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenProgramsARB(a0,a1);}},
+{"glMultiTexEnvivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glMultiTexEnvivEXT(a0,a1,a2,a3);}},
+{"glSecondaryColor3uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glSecondaryColor3uiEXT(a0,a1,a2);}},
+{"glCompressedTextureImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const void*>();table.glCompressedTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glUniform2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glUniform2i(a0,a1,a2);}},
+{"glCopyTexImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();table.glCopyTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glUniform2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glUniform2d(a0,a1,a2);}},
+{"glVertexAttribL1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();table.glVertexAttribL1d(a0,a1);}},
+{"glFramebufferTextureFaceEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();table.glFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);}},
+{"glFramebufferTextureLayer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTextureLayer(a0,a1,a2,a3,a4);}},
+{"glMultiTexCoord4bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLbyte*>();table.glMultiTexCoord4bvOES(a0,a1);}},
+{"glGetVertexArrayPointeri_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void**>();table.glGetVertexArrayPointeri_vEXT(a0,a1,a2,a3);}},
+{"glNamedProgramLocalParameter4dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();table.glNamedProgramLocalParameter4dEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glBinormal3bEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glBinormal3bEXT(a0,a1,a2);}},
+{"glConvolutionFilter2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProgramUniform2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform2fv(a0,a1,a2,a3);}},
+{"glColor3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5);}},
+{"glNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();table.glNormal3fVertex3fvSUN(a0,a1);}},
+{"glCopyMultiTexSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLsizei>();table.glCopyMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glProgramLocalParameterI4iNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glProgramLocalParameterI4iNV(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniformMatrix2x4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2x4dv(a0,a1,a2,a3,a4);}},
+{"glPathMemoryGlyphIndexArrayNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLfloat>();table.glPathMemoryGlyphIndexArrayNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glDrawArraysEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();table.glDrawArraysEXT(a0,a1,a2);}},
+{"glBlendEquationEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBlendEquationEXT(a0);}},
+{"glStencilOp",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glStencilOp(a0,a1,a2);}},
+{"glCopyTextureSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();table.glCopyTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glTexEnvf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glTexEnvf(a0,a1,a2);}},
+{"glVertexAttrib2dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib2dvNV(a0,a1);}},
+{"glGenPerfMonitorsAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenPerfMonitorsAMD(a0,a1);}},
+{"glGetInteger64i_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint64*>();table.glGetInteger64i_v(a0,a1,a2);}},
+{"glGetHistogramParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetHistogramParameterfv(a0,a1,a2);}},
+{"glVertexFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();table.glVertexFormatNV(a0,a1,a2);}},
+{"glBlendFuncIndexedAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendFuncIndexedAMD(a0,a1,a2);}},
+{"glTexEnvi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glTexEnvi(a0,a1,a2);}},
+{"glMultiTexCoord1iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord1iv(a0,a1);}},
+{"glIsEnabledi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glIsEnabledi(a0,a1);}},
+{"glVertexAttribL2ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint64EXT*>();table.glVertexAttribL2ui64vNV(a0,a1);}},
+{"glVertexAttribL4i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();auto const a4 = call.scalar<GLint64EXT>();table.glVertexAttribL4i64NV(a0,a1,a2,a3,a4);}},
+{"glMatrixTranslatedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glMatrixTranslatedEXT(a0,a1,a2,a3);}},
+{"glMakeTextureHandleResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeTextureHandleResidentARB(a0);}},
+{"glMatrixMultdEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMatrixMultdEXT(a0,a1);}},
+{"glBinormal3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glBinormal3dvEXT(a0);}},
+{"glImportSyncEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLbitfield>();call.mapSync(table.glImportSyncEXT(a0,a1,a2));}},
+{"glGetMapiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMapiv(a0,a1,a2);}},
+{"glImportSemaphoreFdEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glImportSemaphoreFdEXT(a0,a1,a2);}},
+{"glMultiTexCoord4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord4sv(a0,a1);}},
+{"glPNTrianglesiATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPNTrianglesiATI(a0,a1);}},
+{"glBindVertexArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBindVertexArrayAPPLE(a0);}},
+{"glObjectPtrLabel",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const void*>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*>();table.glObjectPtrLabel(a0,a1,a2);}},
+{"glGetDebugMessageLog",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLenum*>();auto const a3 = call.pointer<GLenum*>();auto const a4 = call.pointer<GLuint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLsizei*>();auto const a7 = call.pointer<GLchar*>();table.glGetDebugMessageLog(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glTrackMatrixNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glTrackMatrixNV(a0,a1,a2,a3);}},
+{"glProgramPathFragmentInputGenNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramPathFragmentInputGenNV(a0,a1,a2,a3,a4);}},
+{"glTangent3ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glTangent3ivEXT(a0);}},
+{"glGetUniformfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLfloat*>();table.glGetUniformfv(a0,a1,a2);}},
+{"glSecondaryColor3ubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glSecondaryColor3ubv(a0);}},
+{"glMakeTextureHandleNonResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeTextureHandleNonResidentNV(a0);}},
+{"glVertexAttribs4ubvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();table.glVertexAttribs4ubvNV(a0,a1,a2);}},
+{"glClipPlanexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glClipPlanexOES(a0,a1);}},
+{"glMultiTexCoord3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord3iv(a0,a1);}},
+{"glGetnPolygonStippleARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLubyte*>();table.glGetnPolygonStippleARB(a0,a1);}},
+{"glUniform2i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64EXT*>();table.glUniform2i64vNV(a0,a1,a2);}},
+{"glLightModelf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glLightModelf(a0,a1);}},
+{"glDeleteMemoryObjectsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteMemoryObjectsEXT(a0,a1);}},
+{"glMultiTexSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const void*>();table.glMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glReplacementCodeuiColor3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();table.glReplacementCodeuiColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}},
+{"glTangent3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glTangent3dvEXT(a0);}},
+{"glLightModeli",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glLightModeli(a0,a1);}},
+{"glVertexWeighthvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glVertexWeighthvNV(a0);}},
+{"glWindowPos3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos3iv(a0);}},
+{"glMultiTexCoordP1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glMultiTexCoordP1uiv(a0,a1,a2);}},
+{"glTransformPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glTransformPathNV(a0,a1,a2,a3);}},
+{"glProgramNamedParameter4dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();table.glProgramNamedParameter4dNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glMultiDrawElementsIndirect",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawElementsIndirect(a0,a1,a2,a3,a4);}},
+{"glProgramUniform1dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();table.glProgramUniform1dEXT(a0,a1,a2);}},
+{"glCallLists",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLvoid*>();table.glCallLists(a0,a1,a2);}},
+{"glNormal3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glNormal3hvNV(a0);}},
+{"glGetCombinerOutputParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetCombinerOutputParameterfvNV(a0,a1,a2,a3);}},
+{"glVertexAttrib4sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glVertexAttrib4sARB(a0,a1,a2,a3,a4);}},
+{"glTexCoord3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glTexCoord3i(a0,a1,a2);}},
+{"glVertexAttribI3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI3uiv(a0,a1);}},
+{"glPushDebugGroup",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLchar*>();table.glPushDebugGroup(a0,a1,a2,a3);}},
+{"glTexCoord3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glTexCoord3f(a0,a1,a2);}},
+{"glTexCoord3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glTexCoord3d(a0,a1,a2);}},
+{"glTexCoord2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glTexCoord2xOES(a0,a1);}},
+{"glGetStageIndexNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glGetStageIndexNV(a0);}},
+{"glProgramUniform4i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64EXT*>();table.glProgramUniform4i64vNV(a0,a1,a2,a3);}},
+{"glGetNamedBufferPointervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetNamedBufferPointervEXT(a0,a1,a2);}},
+{"glTextureBarrierNV",[](FunctionTable const&table,ReplayCall&){table.glTextureBarrierNV();}},
+{"glColor4ubVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();auto const a1 = call.pointer<const GLfloat*>();table.glColor4ubVertex3fvSUN(a0,a1);}},
+{"glGetCommandHeaderNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glGetCommandHeaderNV(a0,a1);}},
+{"glGetPerfMonitorCounterInfoAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glGetPerfMonitorCounterInfoAMD(a0,a1,a2,a3);}},
+{"glVertexAttrib1svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib1svARB(a0,a1);}},
+{"glCombinerParameteriNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glCombinerParameteriNV(a0,a1);}},
+{"glMatrixMultTransposefEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixMultTransposefEXT(a0,a1);}},
+{"glDetailTexFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glDetailTexFuncSGIS(a0,a1,a2);}},
+{"glAreTexturesResident",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<GLboolean*>();table.glAreTexturesResident(a0,a1,a2);}},
+{"glProgramUniform2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glProgramUniform2d(a0,a1,a2,a3);}},
+{"glGetConvolutionParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetConvolutionParameterfvEXT(a0,a1,a2);}},
+{"glIndexPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const void**>();auto const a3 = call.scalar<GLint>();table.glIndexPointerListIBM(a0,a1,a2,a3);}},
+{"glVertexAttribI4iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glVertexAttribI4iEXT(a0,a1,a2,a3,a4);}},
+{"glProgramUniform2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glProgramUniform2f(a0,a1,a2,a3);}},
+{"glRasterPos4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glRasterPos4sv(a0);}},
+{"glColor4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glColor4s(a0,a1,a2,a3);}},
+{"glMulticastGetQueryObjectivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glMulticastGetQueryObjectivNV(a0,a1,a2,a3);}},
+{"glColorFragmentOp3ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLuint>();auto const a10 = call.scalar<GLuint>();auto const a11 = call.scalar<GLuint>();auto const a12 = call.scalar<GLuint>();table.glColorFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}},
+{"glResizeBuffersMESA",[](FunctionTable const&table,ReplayCall&){table.glResizeBuffersMESA();}},
+{"glGetMinmaxParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetMinmaxParameterfv(a0,a1,a2);}},
+{"glClientActiveTextureARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glClientActiveTextureARB(a0);}},
+{"glBindVertexArray",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBindVertexArray(a0);}},
+{"glColor4b",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();table.glColor4b(a0,a1,a2,a3);}},
+{"glColor4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glColor4f(a0,a1,a2,a3);}},
+{"glColor4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glColor4d(a0,a1,a2,a3);}},
+{"glColor4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glColor4i(a0,a1,a2,a3);}},
+{"glEdgeFlagFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();table.glEdgeFlagFormatNV(a0);}},
+{"glNamedBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<const void*>();table.glNamedBufferSubData(a0,a1,a2,a3);}},
+{"glDrawElementsInstanced",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();table.glDrawElementsInstanced(a0,a1,a2,a3,a4);}},
+{"glGetMultiTexParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetMultiTexParameterIivEXT(a0,a1,a2,a3);}},
+{"glVertex2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glVertex2dv(a0);}},
+{"glDisableVertexArrayAttribEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glDisableVertexArrayAttribEXT(a0,a1);}},
+{"glObjectUnpurgeableAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();table.glObjectUnpurgeableAPPLE(a0,a1,a2);}},
+{"glVertexAttribs2dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glVertexAttribs2dvNV(a0,a1,a2);}},
+{"glReplacementCodeuiTexCoord2fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glReplacementCodeuiTexCoord2fVertex3fSUN(a0,a1,a2,a3,a4,a5);}},
+{"glGetMapParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetMapParameterfvNV(a0,a1,a2);}},
+{"glProgramUniform4ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform4ivEXT(a0,a1,a2,a3);}},
+{"glProgramUniform3ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64EXT*>();table.glProgramUniform3ui64vNV(a0,a1,a2,a3);}},
+{"glRectfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();table.glRectfv(a0,a1);}},
+{"glTexFilterFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glTexFilterFuncSGIS(a0,a1,a2,a3);}},
+{"glSpriteParameterfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glSpriteParameterfvSGIX(a0,a1);}},
+{"glCopyMultiTexImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();table.glCopyMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetVertexAttribIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetVertexAttribIuivEXT(a0,a1,a2);}},
+{"glUniformMatrix2x4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix2x4dv(a0,a1,a2,a3);}},
+{"glGetProgramResourceLocationIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLchar*>();table.glGetProgramResourceLocationIndex(a0,a1,a2);}},
+{"glColor3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glColor3hNV(a0,a1,a2);}},
+{"glViewport",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glViewport(a0,a1,a2,a3);}},
+{"glProgramNamedParameter4fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();table.glProgramNamedParameter4fNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetInvariantBooleanvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLboolean*>();table.glGetInvariantBooleanvEXT(a0,a1,a2);}},
+{"glTexStorage2DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();table.glTexStorage2DMultisample(a0,a1,a2,a3,a4,a5);}},
+{"glPixelStorex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glPixelStorex(a0,a1);}},
+{"glVertexAttribL1dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL1dvEXT(a0,a1);}},
+{"glGetActiveSubroutineUniformiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLint*>();table.glGetActiveSubroutineUniformiv(a0,a1,a2,a3,a4);}},
+{"glVertexAttribPointerARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<const void*>();table.glVertexAttribPointerARB(a0,a1,a2,a3,a4,a5);}},
+{"glCompressedTexSubImage2DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const void*>();table.glCompressedTexSubImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glTexStorageMem1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint64>();table.glTexStorageMem1DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertex2hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glVertex2hvNV(a0);}},
+{"glTexBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glTexBuffer(a0,a1,a2);}},
+{"glArrayElement",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glArrayElement(a0);}},
+{"glValidateProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glValidateProgram(a0);}},
+{"glPixelStoref",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPixelStoref(a0,a1);}},
+{"glWindowPos3dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glWindowPos3dARB(a0,a1,a2);}},
+{"glEvalCoord1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glEvalCoord1dv(a0);}},
+{"glVertexAttribs2fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glVertexAttribs2fvNV(a0,a1,a2);}},
+{"glRecti",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glRecti(a0,a1,a2,a3);}},
+{"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();auto const a3 = call.pointer<const GLfloat*>();auto const a4 = call.pointer<const GLfloat*>();table.glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3,a4);}},
+{"glTexCoord1bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();table.glTexCoord1bOES(a0);}},
+{"glProgramUniform2i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64*>();table.glProgramUniform2i64vARB(a0,a1,a2,a3);}},
+{"glWindowPos2dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glWindowPos2dARB(a0,a1);}},
+{"glGetProgramParameterdvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLdouble*>();table.glGetProgramParameterdvNV(a0,a1,a2,a3);}},
+{"glRectf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glRectf(a0,a1,a2,a3);}},
+{"glRectd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glRectd(a0,a1,a2,a3);}},
+{"glMap1xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLfixed>();table.glMap1xOES(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib3fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib3fvNV(a0,a1);}},
+{"glReferencePlaneSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glReferencePlaneSGIX(a0);}},
+{"glMulticastBlitFramebufferNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.scalar<GLbitfield>();auto const a11 = call.scalar<GLenum>();table.glMulticastBlitFramebufferNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glGetCombinerInputParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLfloat*>();table.glGetCombinerInputParameterfvNV(a0,a1,a2,a3,a4);}},
+{"glGetTextureSamplerHandleARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glGetTextureSamplerHandleARB(a0,a1);}},
+{"glBindTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindTexture(a0,a1);}},
+{"glRects",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glRects(a0,a1,a2,a3);}},
+{"glGetActiveAttribARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLcharARB*>();table.glGetActiveAttribARB(a0,a1,a2,a3,a4,a5,a6);}},
+{"glHistogramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();table.glHistogramEXT(a0,a1,a2,a3);}},
+{"glGetTextureSamplerHandleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glGetTextureSamplerHandleNV(a0,a1);}},
+{"glDetachShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glDetachShader(a0,a1);}},
+{"glFinishTextureSUNX",[](FunctionTable const&table,ReplayCall&){table.glFinishTextureSUNX();}},
+{"glUniformMatrix3x4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix3x4dv(a0,a1,a2,a3);}},
+{"glVertexAttrib4fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glVertexAttrib4fARB(a0,a1,a2,a3,a4);}},
+{"glGetPathColorGenivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetPathColorGenivNV(a0,a1,a2);}},
+{"glGetProgramResourceLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLchar*>();table.glGetProgramResourceLocation(a0,a1,a2);}},
+{"glVertexArrayAttribLFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();table.glVertexArrayAttribLFormat(a0,a1,a2,a3,a4);}},
+{"glGetTexLevelParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetTexLevelParameterfv(a0,a1,a2,a3);}},
+{"glVertexArrayVertexAttribOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLboolean>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLintptr>();table.glVertexArrayVertexAttribOffsetEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glIndexFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();table.glIndexFormatNV(a0,a1);}},
+{"glMultiTexCoord3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glMultiTexCoord3i(a0,a1,a2,a3);}},
+{"glReplacementCodeuiVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();table.glReplacementCodeuiVertex3fvSUN(a0,a1);}},
+{"glViewportIndexedfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glViewportIndexedfv(a0,a1);}},
+{"glBindBuffersBase",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glBindBuffersBase(a0,a1,a2,a3);}},
+{"glTexBumpParameterfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glTexBumpParameterfvATI(a0,a1);}},
+{"glMatrixIndexuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLuint*>();table.glMatrixIndexuivARB(a0,a1);}},
+{"glVertexAttrib1hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLhalfNV>();table.glVertexAttrib1hNV(a0,a1);}},
+{"glWindowPos3svMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos3svMESA(a0);}},
+{"glStencilOpSeparateATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glStencilOpSeparateATI(a0,a1,a2,a3);}},
+{"glDrawElementsBaseVertex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLint>();table.glDrawElementsBaseVertex(a0,a1,a2,a3,a4);}},
+{"glBlendEquationSeparateiARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendEquationSeparateiARB(a0,a1,a2);}},
+{"glVertexAttrib1fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();table.glVertexAttrib1fNV(a0,a1);}},
+{"glMapVertexAttrib2fAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.pointer<const GLfloat*>();table.glMapVertexAttrib2fAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glCompressedTextureSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const void*>();table.glCompressedTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glClearBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizeiptr>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glClearBufferSubData(a0,a1,a2,a3,a4,a5,a6);}},
+{"glTexStorage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();table.glTexStorage1D(a0,a1,a2,a3);}},
+{"glVertexAttribI3iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glVertexAttribI3iEXT(a0,a1,a2,a3);}},
+{"glMakeTextureHandleNonResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeTextureHandleNonResidentARB(a0);}},
+{"glMultiDrawElementArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.scalar<GLsizei>();table.glMultiDrawElementArrayAPPLE(a0,a1,a2,a3);}},
+{"glVertexStream4dATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexStream4dATI(a0,a1,a2,a3,a4);}},
+{"glProgramUniformMatrix2dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2dvEXT(a0,a1,a2,a3,a4);}},
+{"glVertexAttribs2hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLhalfNV*>();table.glVertexAttribs2hvNV(a0,a1,a2);}},
+{"glGetUniformiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLint*>();table.glGetUniformiv(a0,a1,a2);}},
+{"glClipPlanefOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glClipPlanefOES(a0,a1);}},
+{"glRenderbufferStorage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glRenderbufferStorage(a0,a1,a2,a3);}},
+{"glUniform4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glUniform4ui(a0,a1,a2,a3,a4);}},
+{"glBindFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindFramebuffer(a0,a1);}},
+{"glValidateProgramARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();table.glValidateProgramARB(a0);}},
+{"glTexGenf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glTexGenf(a0,a1,a2);}},
+{"glTexGend",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLdouble>();table.glTexGend(a0,a1,a2);}},
+{"glTexGeni",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glTexGeni(a0,a1,a2);}},
+{"glDeleteFramebuffersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteFramebuffersEXT(a0,a1);}},
+{"glResetMinmaxEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glResetMinmaxEXT(a0);}},
+{"glVertexAttrib1fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib1fvNV(a0,a1);}},
+{"glIsQueryARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsQueryARB(a0);}},
+{"glEnableVariantClientStateEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEnableVariantClientStateEXT(a0);}},
+{"glScissorIndexed",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glScissorIndexed(a0,a1,a2,a3,a4);}},
+{"glGetInvariantIntegervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetInvariantIntegervEXT(a0,a1,a2);}},
+{"glProgramLocalParameterI4uiNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glProgramLocalParameterI4uiNV(a0,a1,a2,a3,a4,a5);}},
+{"glConvolutionParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glConvolutionParameterxvOES(a0,a1,a2);}},
+{"glGenFramebuffersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenFramebuffersEXT(a0,a1);}},
+{"glVertexArrayColorOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLintptr>();table.glVertexArrayColorOffsetEXT(a0,a1,a2,a3,a4,a5);}},
+{"glMultiTexCoord3ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord3ivARB(a0,a1);}},
+{"glVertexWeightfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glVertexWeightfEXT(a0);}},
+{"glRasterPos4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glRasterPos4dv(a0);}},
+{"glIsTextureHandleResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glIsTextureHandleResidentARB(a0);}},
+{"glRasterPos2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glRasterPos2dv(a0);}},
+{"glWindowPos4ivMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos4ivMESA(a0);}},
+{"glGetVariantPointervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetVariantPointervEXT(a0,a1,a2);}},
+{"glMapNamedBufferRangeEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLbitfield>();table.glMapNamedBufferRangeEXT(a0,a1,a2,a3);}},
+{"glGetnUniformui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLuint64*>();table.glGetnUniformui64vARB(a0,a1,a2,a3);}},
+{"glCreateShaderProgramv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();table.glCreateShaderProgramv(a0,a1,a2);}},
+{"glGetQueryObjectiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetQueryObjectiv(a0,a1,a2);}},
+{"glMaxShaderCompilerThreadsKHR",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glMaxShaderCompilerThreadsKHR(a0);}},
+{"glPNTrianglesfATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPNTrianglesfATI(a0,a1);}},
+{"glGlobalAlphaFactorusSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();table.glGlobalAlphaFactorusSUN(a0);}},
+{"glVertexAttrib3dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib3dvNV(a0,a1);}},
+{"glMultiTexCoord3sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glMultiTexCoord3sARB(a0,a1,a2,a3);}},
+{"glGenerateMipmap",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glGenerateMipmap(a0);}},
+{"glCompressedTextureSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const void*>();table.glCompressedTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glNamedRenderbufferStorageMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glNamedRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);}},
+{"glPolygonOffsetClampEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glPolygonOffsetClampEXT(a0,a1,a2);}},
+{"glTextureRangeAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glTextureRangeAPPLE(a0,a1,a2);}},
+{"glBlendEquationIndexedAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationIndexedAMD(a0,a1);}},
+{"glTexCoord2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glTexCoord2d(a0,a1);}},
+{"glPointParameteri",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPointParameteri(a0,a1);}},
+{"glTexCoord2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glTexCoord2f(a0,a1);}},
+{"glGetUnsignedBytei_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLubyte*>();table.glGetUnsignedBytei_vEXT(a0,a1,a2);}},
+{"glColor4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glColor4iv(a0);}},
+{"glMapNamedBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLbitfield>();table.glMapNamedBufferRange(a0,a1,a2,a3);}},
+{"glUnmapBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glUnmapBuffer(a0);}},
+{"glSampleMaskEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();auto const a1 = call.scalar<GLboolean>();table.glSampleMaskEXT(a0,a1);}},
+{"glTexCoord2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glTexCoord2i(a0,a1);}},
+{"glTexCoord1xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glTexCoord1xvOES(a0);}},
+{"glVertexAttrib1sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();table.glVertexAttrib1sARB(a0,a1);}},
+{"glGetVertexArrayiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexArrayiv(a0,a1,a2);}},
+{"glProgramParameter4dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLdouble*>();table.glProgramParameter4dvNV(a0,a1,a2);}},
+{"glTexCoord2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glTexCoord2s(a0,a1);}},
+{"glTextureParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLuint*>();table.glTextureParameterIuivEXT(a0,a1,a2,a3);}},
+{"glGetColorTableParameterfvSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetColorTableParameterfvSGI(a0,a1,a2);}},
+{"glTexCoord4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glTexCoord4dv(a0);}},
+{"glVertexAttrib1svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib1svNV(a0,a1);}},
+{"glNamedFramebufferTextureFaceEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();table.glNamedFramebufferTextureFaceEXT(a0,a1,a2,a3,a4);}},
+{"glProgramUniform2ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64EXT*>();table.glProgramUniform2ui64vNV(a0,a1,a2,a3);}},
+{"glStencilFillPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glStencilFillPathNV(a0,a1,a2);}},
+{"glNormal3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glNormal3dv(a0);}},
+{"glReleaseShaderCompiler",[](FunctionTable const&table,ReplayCall&){table.glReleaseShaderCompiler();}},
+{"glTexStorageMem3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint64>();table.glTexStorageMem3DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glTexCoord3bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glTexCoord3bvOES(a0);}},
+{"glIsVertexAttribEnabledAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glIsVertexAttribEnabledAPPLE(a0,a1);}},
+{"glTexCoord1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glTexCoord1dv(a0);}},
+{"glReadPixels",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<GLvoid*>();table.glReadPixels(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribI3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI3iv(a0,a1);}},
+{"glSetFenceAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glSetFenceAPPLE(a0);}},
+{"glWeightsvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLshort*>();table.glWeightsvARB(a0,a1);}},
+{"glShadeModel",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glShadeModel(a0);}},
+{"glTextureStorageMem3DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint64>();table.glTextureStorageMem3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glMapGrid1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glMapGrid1d(a0,a1,a2);}},
+{"glGetHistogramParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetHistogramParameterivEXT(a0,a1,a2);}},
+{"glConservativeRasterParameteriNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glConservativeRasterParameteriNV(a0,a1);}},
+{"glClearNamedBufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const void*>();table.glClearNamedBufferData(a0,a1,a2,a3,a4);}},
+{"glClearDepthf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glClearDepthf(a0);}},
+{"glCreatePerfQueryINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLuint*>();table.glCreatePerfQueryINTEL(a0,a1);}},
+{"glFogCoordfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glFogCoordfEXT(a0);}},
+{"glVertexAttrib2dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexAttrib2dARB(a0,a1,a2);}},
+{"glMultiTexCoord4dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glMultiTexCoord4dARB(a0,a1,a2,a3,a4);}},
+{"glReadnPixelsARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<void*>();table.glReadnPixelsARB(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMultiTexBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glMultiTexBufferEXT(a0,a1,a2,a3);}},
+{"glWindowPos4dvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos4dvMESA(a0);}},
+{"glInvalidateNamedFramebufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();table.glInvalidateNamedFramebufferData(a0,a1,a2);}},
+{"glSecondaryColorPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const void**>();auto const a4 = call.scalar<GLint>();table.glSecondaryColorPointerListIBM(a0,a1,a2,a3,a4);}},
+{"glRectiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();auto const a1 = call.pointer<const GLint*>();table.glRectiv(a0,a1);}},
+{"glColorP4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glColorP4ui(a0,a1);}},
+{"glUseProgramStages",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint>();table.glUseProgramStages(a0,a1,a2);}},
+{"glRasterPos3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glRasterPos3dv(a0);}},
+{"glPathTexGenNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const GLfloat*>();table.glPathTexGenNV(a0,a1,a2,a3);}},
+{"glVertexBlendEnviATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glVertexBlendEnviATI(a0,a1);}},
+{"glUniform3i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64>();auto const a2 = call.scalar<GLint64>();auto const a3 = call.scalar<GLint64>();table.glUniform3i64ARB(a0,a1,a2,a3);}},
+{"glLoadMatrixf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glLoadMatrixf(a0);}},
+{"glProgramUniform2dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glProgramUniform2dEXT(a0,a1,a2,a3);}},
+{"glVertexAttribI4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI4iv(a0,a1);}},
+{"glNamedFramebufferDrawBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glNamedFramebufferDrawBuffer(a0,a1);}},
+{"glColor4ubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glColor4ubv(a0);}},
+{"glColor3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glColor3hvNV(a0);}},
+{"glGetMapAttribParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetMapAttribParameterfvNV(a0,a1,a2,a3);}},
+{"glGetBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<void*>();table.glGetBufferSubData(a0,a1,a2,a3);}},
+{"glGetVertexAttribLdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetVertexAttribLdv(a0,a1,a2);}},
+{"glGetnUniformuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLuint*>();table.glGetnUniformuiv(a0,a1,a2,a3);}},
+{"glGetUniformui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetUniformui64vNV(a0,a1,a2);}},
+{"glNamedRenderbufferStorageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glNamedRenderbufferStorageEXT(a0,a1,a2,a3);}},
+{"glVertexAttrib3dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexAttrib3dNV(a0,a1,a2,a3);}},
+{"glTextureStorage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();table.glTextureStorage1DEXT(a0,a1,a2,a3,a4);}},
+{"glPixelTexGenParameteriSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPixelTexGenParameteriSGIS(a0,a1);}},
+{"glColorTableEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glColorTableEXT(a0,a1,a2,a3,a4,a5);}},
+{"glGenBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenBuffers(a0,a1);}},
+{"glMultiTexCoord3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glMultiTexCoord3xvOES(a0,a1);}},
+{"glExecuteProgramNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLfloat*>();table.glExecuteProgramNV(a0,a1,a2);}},
+{"glVariantArrayObjectATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glVariantArrayObjectATI(a0,a1,a2,a3,a4);}},
+{"glColor3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glColor3xvOES(a0);}},
+{"glGetnConvolutionFilterARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();table.glGetnConvolutionFilterARB(a0,a1,a2,a3,a4);}},
+{"glNormalFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();table.glNormalFormatNV(a0,a1);}},
+{"glGetInvariantFloatvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetInvariantFloatvEXT(a0,a1,a2);}},
+{"glClearNamedFramebufferiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const GLint*>();table.glClearNamedFramebufferiv(a0,a1,a2,a3);}},
+{"glTexImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const GLvoid*>();table.glTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glGenSamplers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenSamplers(a0,a1);}},
+{"glIsFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsFramebuffer(a0);}},
+{"glProgramUniform3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform3dvEXT(a0,a1,a2,a3);}},
+{"glGetVertexAttribfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVertexAttribfvNV(a0,a1,a2);}},
+{"glDrawRangeElementArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4);}},
+{"glUniform3i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();table.glUniform3i64NV(a0,a1,a2,a3);}},
+{"glMatrixPopEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glMatrixPopEXT(a0);}},
+{"glVertexStream1sATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();table.glVertexStream1sATI(a0,a1);}},
+{"glGetnPixelMapuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLuint*>();table.glGetnPixelMapuivARB(a0,a1,a2);}},
+{"glMultiTexEnviEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();table.glMultiTexEnviEXT(a0,a1,a2,a3);}},
+{"glVertexAttribI2iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glVertexAttribI2iEXT(a0,a1,a2);}},
+{"glProgramParameter4fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLfloat*>();table.glProgramParameter4fvNV(a0,a1,a2);}},
+{"glWaitSemaphoreEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.pointer<const GLenum*>();table.glWaitSemaphoreEXT(a0,a1,a2,a3,a4,a5);}},
+{"glNamedFramebufferSampleLocationsfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glNamedFramebufferSampleLocationsfvNV(a0,a1,a2,a3);}},
+{"glTexCoordP4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glTexCoordP4uiv(a0,a1);}},
+{"glRectxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();auto const a1 = call.pointer<const GLfixed*>();table.glRectxvOES(a0,a1);}},
+{"glGetVariantIntegervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVariantIntegervEXT(a0,a1,a2);}},
+{"glDeleteLists",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();table.glDeleteLists(a0,a1);}},
+{"glTexGendv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLdouble*>();table.glTexGendv(a0,a1,a2);}},
+{"glVertexP2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glVertexP2uiv(a0,a1);}},
+{"glGetPerfMonitorGroupsAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLint*>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLuint*>();table.glGetPerfMonitorGroupsAMD(a0,a1,a2);}},
+{"glMultTransposeMatrixfARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glMultTransposeMatrixfARB(a0);}},
+{"glVertexAttribI2ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI2ivEXT(a0,a1);}},
+{"glReplacementCodeuiColor4fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();auto const a3 = call.pointer<const GLfloat*>();table.glReplacementCodeuiColor4fNormal3fVertex3fvSUN(a0,a1,a2,a3);}},
+{"glDeleteStatesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteStatesNV(a0,a1);}},
+{"glGetBufferParameteri64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64*>();table.glGetBufferParameteri64v(a0,a1,a2);}},
+{"glProgramUniform4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform4dv(a0,a1,a2,a3);}},
+{"glEdgeFlagPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLboolean*>();table.glEdgeFlagPointerEXT(a0,a1,a2);}},
+{"glVideoCaptureStreamParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glVideoCaptureStreamParameterivNV(a0,a1,a2,a3);}},
+{"glVertexStream4iATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glVertexStream4iATI(a0,a1,a2,a3,a4);}},
+{"glVDPAUFiniNV",[](FunctionTable const&table,ReplayCall&){table.glVDPAUFiniNV();}},
+{"glMakeBufferNonResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glMakeBufferNonResidentNV(a0);}},
+{"glUniform1ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();table.glUniform1ui64ARB(a0,a1);}},
+{"glStencilStrokePathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();table.glStencilStrokePathNV(a0,a1,a2);}},
+{"glVariantuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVariantuivEXT(a0,a1);}},
+{"glCopyTexSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();table.glCopyTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glSpriteParameteriSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glSpriteParameteriSGIX(a0,a1);}},
+{"glMultiTexCoord1sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();table.glMultiTexCoord1sARB(a0,a1);}},
+{"glConvolutionParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glConvolutionParameterfv(a0,a1,a2);}},
+{"glMakeTextureHandleResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeTextureHandleResidentNV(a0);}},
+{"glMultMatrixxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glMultMatrixxOES(a0);}},
+{"glTextureNormalEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glTextureNormalEXT(a0);}},
+{"glGetQueryivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetQueryivARB(a0,a1,a2);}},
+{"glCompressedMultiTexImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.pointer<const void*>();table.glCompressedMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glGetInstrumentsSGIX",[](FunctionTable const&table,ReplayCall&){table.glGetInstrumentsSGIX();}},
+{"glProgramUniformMatrix4x3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4x3fvEXT(a0,a1,a2,a3,a4);}},
+{"glPointParameterf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPointParameterf(a0,a1);}},
+{"glProgramUniform3dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glProgramUniform3dEXT(a0,a1,a2,a3,a4);}},
+{"glMultiTexCoord2hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glMultiTexCoord2hNV(a0,a1,a2);}},
+{"glGetConvolutionFilterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glGetConvolutionFilterEXT(a0,a1,a2,a3);}},
+{"glVertexAttrib2hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glVertexAttrib2hNV(a0,a1,a2);}},
+{"glCurrentPaletteMatrixARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glCurrentPaletteMatrixARB(a0);}},
+{"glFogxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glFogxvOES(a0,a1);}},
+{"glCreateRenderbuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateRenderbuffers(a0,a1);}},
+{"glVertexAttrib4Nusv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttrib4Nusv(a0,a1);}},
+{"glCombinerInputNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();table.glCombinerInputNV(a0,a1,a2,a3,a4,a5);}},
+{"glDepthFunc",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glDepthFunc(a0);}},
+{"glWindowPos4fMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glWindowPos4fMESA(a0,a1,a2,a3);}},
+{"glEnableClientStateIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glEnableClientStateIndexedEXT(a0,a1);}},
+{"glTexCoord4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glTexCoord4iv(a0);}},
+{"glProgramUniform4i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64>();auto const a3 = call.scalar<GLint64>();auto const a4 = call.scalar<GLint64>();auto const a5 = call.scalar<GLint64>();table.glProgramUniform4i64ARB(a0,a1,a2,a3,a4,a5);}},
+{"glBlendFunci",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBlendFunci(a0,a1,a2);}},
+{"glResolveDepthValuesNV",[](FunctionTable const&table,ReplayCall&){table.glResolveDepthValuesNV();}},
+{"glTextureColorMaskSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLboolean>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLboolean>();table.glTextureColorMaskSGIS(a0,a1,a2,a3);}},
+{"glCreateShaderProgramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLchar*>();table.glCreateShaderProgramEXT(a0,a1);}},
+{"glBufferStorage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();table.glBufferStorage(a0,a1,a2,a3);}},
+{"glMakeNamedBufferNonResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glMakeNamedBufferNonResidentNV(a0);}},
+{"glRenderbufferStorageMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glRenderbufferStorageMultisampleEXT(a0,a1,a2,a3,a4);}},
+{"glGetFloati_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetFloati_v(a0,a1,a2);}},
+{"glUniform2ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLuint64>();table.glUniform2ui64ARB(a0,a1,a2);}},
+{"glVertex3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glVertex3fv(a0);}},
+{"glGetUniformLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetUniformLocation(a0,a1);}},
+{"glVertexStream1svATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glVertexStream1svATI(a0,a1);}},
+{"glVertexStream3fATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glVertexStream3fATI(a0,a1,a2,a3);}},
+{"glNamedFramebufferDrawBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();table.glNamedFramebufferDrawBuffers(a0,a1,a2);}},
+{"glUniform2ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64EXT*>();table.glUniform2ui64vNV(a0,a1,a2);}},
+{"glTexCoordPointervINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void**>();table.glTexCoordPointervINTEL(a0,a1,a2);}},
+{"glUniform4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform4fv(a0,a1,a2);}},
+{"glNormalPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glNormalPointerEXT(a0,a1,a2,a3);}},
+{"glVertexAttrib4hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();auto const a4 = call.scalar<GLhalfNV>();table.glVertexAttrib4hNV(a0,a1,a2,a3,a4);}},
+{"glNormal3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glNormal3f(a0,a1,a2);}},
+{"glVertexStream2iATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glVertexStream2iATI(a0,a1,a2);}},
+{"glVertexAttribP4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLuint*>();table.glVertexAttribP4uiv(a0,a1,a2,a3);}},
+{"glCompressedTextureSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLsizei>();auto const a10 = call.pointer<const void*>();table.glCompressedTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glAsyncMarkerSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glAsyncMarkerSGIX(a0);}},
+{"glTextureStorageSparseAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLbitfield>();table.glTextureStorageSparseAMD(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetConvolutionParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetConvolutionParameterivEXT(a0,a1,a2);}},
+{"glEndPerfQueryINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEndPerfQueryINTEL(a0);}},
+{"glFragmentLightModeliSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glFragmentLightModeliSGIX(a0,a1);}},
+{"glPrioritizeTexturesEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<const GLclampf*>();table.glPrioritizeTexturesEXT(a0,a1,a2);}},
+{"glEndConditionalRender",[](FunctionTable const&table,ReplayCall&){table.glEndConditionalRender();}},
+{"glEnableClientState",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glEnableClientState(a0);}},
+{"glResetHistogram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glResetHistogram(a0);}},
+{"glGetOcclusionQueryivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetOcclusionQueryivNV(a0,a1,a2);}},
+{"glUniform1uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();table.glUniform1uiEXT(a0,a1);}},
+{"glMultiTexCoord2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord2sv(a0,a1);}},
+{"glTexSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const void*>();table.glTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glProgramUniform2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform2uiv(a0,a1,a2,a3);}},
+{"glMultiTexCoord2iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glMultiTexCoord2iARB(a0,a1,a2);}},
+{"glGetQueryObjectuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetQueryObjectuiv(a0,a1,a2);}},
+{"glGenerateMultiTexMipmapEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glGenerateMultiTexMipmapEXT(a0,a1);}},
+{"glVertexAttrib4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttrib4iv(a0,a1);}},
+{"glWindowPos3dvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos3dvMESA(a0);}},
+{"glLabelObjectEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLchar*>();table.glLabelObjectEXT(a0,a1,a2,a3);}},
+{"glProgramUniform1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform1uiv(a0,a1,a2,a3);}},
+{"glFramebufferTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();table.glFramebufferTexture(a0,a1,a2,a3);}},
+{"glMultiTexEnvfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLfloat>();table.glMultiTexEnvfEXT(a0,a1,a2,a3);}},
+{"glGetTexGendv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetTexGendv(a0,a1,a2);}},
+{"glVertex4xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glVertex4xOES(a0,a1,a2);}},
+{"glVertexAttribI2uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI2uivEXT(a0,a1);}},
+{"glNamedProgramLocalParameter4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLfloat*>();table.glNamedProgramLocalParameter4fvEXT(a0,a1,a2,a3);}},
+{"glColor3usv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLushort*>();table.glColor3usv(a0);}},
+{"glGetPixelTransformParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetPixelTransformParameterfvEXT(a0,a1,a2);}},
+{"glIndexxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glIndexxvOES(a0);}},
+{"glDepthMask",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLboolean>();table.glDepthMask(a0);}},
+{"glProgramUniformMatrix2x4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2x4fv(a0,a1,a2,a3,a4);}},
+{"glAreProgramsResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<GLboolean*>();table.glAreProgramsResidentNV(a0,a1,a2);}},
+{"glColorTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const GLvoid*>();table.glColorTable(a0,a1,a2,a3,a4,a5);}},
+{"glBeginQueryIndexed",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glBeginQueryIndexed(a0,a1,a2);}},
+{"glVertexStream1dvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexStream1dvATI(a0,a1);}},
+{"glGetMultiTexEnvfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetMultiTexEnvfvEXT(a0,a1,a2,a3);}},
+{"glDeleteFencesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteFencesNV(a0,a1);}},
+{"glVertexAttribs1dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glVertexAttribs1dvNV(a0,a1,a2);}},
+{"glBufferStorageExternalEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLeglClientBufferEXT>();auto const a4 = call.scalar<GLbitfield>();table.glBufferStorageExternalEXT(a0,a1,a2,a3,a4);}},
+{"glVertexStream2sATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glVertexStream2sATI(a0,a1,a2);}},
+{"glGetnSeparableFilterARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<void*>();auto const a7 = call.pointer<void*>();table.glGetnSeparableFilterARB(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glProgramUniform2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform2dv(a0,a1,a2,a3);}},
+{"glActiveStencilFaceEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glActiveStencilFaceEXT(a0);}},
+{"glProgramUniform4dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glProgramUniform4dEXT(a0,a1,a2,a3,a4,a5);}},
+{"glPointSizexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glPointSizexOES(a0);}},
+{"glRasterPos2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glRasterPos2sv(a0);}},
+{"glBindParameterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBindParameterEXT(a0);}},
+{"glTexCoord1sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glTexCoord1sv(a0);}},
+{"glBlendParameteriNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glBlendParameteriNV(a0,a1);}},
+{"glNamedProgramLocalParameter4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLdouble*>();table.glNamedProgramLocalParameter4dvEXT(a0,a1,a2,a3);}},
+{"glProgramUniformHandleui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();table.glProgramUniformHandleui64NV(a0,a1,a2);}},
+{"glGetTextureParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetTextureParameterfvEXT(a0,a1,a2,a3);}},
+{"glGetPathMetricsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<GLfloat*>();table.glGetPathMetricsNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertex2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glVertex2i(a0,a1);}},
+{"glNewList",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glNewList(a0,a1);}},
+{"glMatrixLoad3x3fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixLoad3x3fNV(a0,a1);}},
+{"glMultiTexCoord2fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glMultiTexCoord2fARB(a0,a1,a2);}},
+{"glWeightdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLdouble*>();table.glWeightdvARB(a0,a1);}},
+{"glIsTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsTransformFeedbackNV(a0);}},
+{"glVertexAttribDivisorARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexAttribDivisorARB(a0,a1);}},
+{"glSecondaryColorP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glSecondaryColorP3uiv(a0,a1);}},
+{"glGetnCompressedTexImageARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<void*>();table.glGetnCompressedTexImageARB(a0,a1,a2,a3);}},
+{"glGetIntegerv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLint*>();table.glGetIntegerv(a0,a1);}},
+{"glMatrixLoaddEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMatrixLoaddEXT(a0,a1);}},
+{"glGetPathLengthNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();table.glGetPathLengthNV(a0,a1,a2);}},
+{"glProgramUniformMatrix3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3dv(a0,a1,a2,a3,a4);}},
+{"glUniform4i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();auto const a4 = call.scalar<GLint64EXT>();table.glUniform4i64NV(a0,a1,a2,a3,a4);}},
+{"glGetHistogramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<void*>();table.glGetHistogramEXT(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib4NuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttrib4NuivARB(a0,a1);}},
+{"glMapGrid2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();auto const a4 = call.scalar<GLfixed>();table.glMapGrid2xOES(a0,a1,a2,a3,a4);}},
+{"glTexImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const GLvoid*>();table.glTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glWindowPos2fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos2fvARB(a0);}},
+{"glEnableIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glEnableIndexedEXT(a0,a1);}},
+{"glTexCoord1bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glTexCoord1bvOES(a0);}},
+{"glDrawPixels",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const GLvoid*>();table.glDrawPixels(a0,a1,a2,a3,a4);}},
+{"glMultMatrixd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glMultMatrixd(a0);}},
+{"glMultMatrixf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glMultMatrixf(a0);}},
+{"glReplacementCodePointerSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void**>();table.glReplacementCodePointerSUN(a0,a1,a2);}},
+{"glLoadTransposeMatrixdARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glLoadTransposeMatrixdARB(a0);}},
+{"glVertexAttrib4Nubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttrib4Nubv(a0,a1);}},
+{"glVertexArrayVertexAttribIOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLintptr>();table.glVertexArrayVertexAttribIOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glCompileShaderARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();table.glCompileShaderARB(a0);}},
+{"glWindowPos3dMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glWindowPos3dMESA(a0,a1,a2);}},
+{"glNormalStream3fvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glNormalStream3fvATI(a0,a1);}},
+{"glColor4usv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLushort*>();table.glColor4usv(a0);}},
+{"glMapGrid1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glMapGrid1f(a0,a1,a2);}},
+{"glPolygonStipple",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glPolygonStipple(a0);}},
+{"glUniform4ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLuint64>();auto const a3 = call.scalar<GLuint64>();auto const a4 = call.scalar<GLuint64>();table.glUniform4ui64ARB(a0,a1,a2,a3,a4);}},
+{"glTextureRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glTextureRenderbufferEXT(a0,a1,a2);}},
+{"glGetSubroutineUniformLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLchar*>();table.glGetSubroutineUniformLocation(a0,a1,a2);}},
+{"glGetFramebufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFramebufferParameteriv(a0,a1,a2);}},
+{"glPixelMapusv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLushort*>();table.glPixelMapusv(a0,a1,a2);}},
+{"glGetSamplerParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetSamplerParameteriv(a0,a1,a2);}},
+{"glVertexStream2fvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexStream2fvATI(a0,a1);}},
+{"glProgramStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glProgramStringARB(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3dvEXT(a0,a1,a2,a3,a4);}},
+{"glSeparableFilter2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const GLvoid*>();auto const a7 = call.pointer<const GLvoid*>();table.glSeparableFilter2D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glVertexAttribI1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI1uiv(a0,a1);}},
+{"glLGPUCopyImageSubDataNVX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLint>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLint>();auto const a13 = call.scalar<GLint>();auto const a14 = call.scalar<GLsizei>();auto const a15 = call.scalar<GLsizei>();auto const a16 = call.scalar<GLsizei>();table.glLGPUCopyImageSubDataNVX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}},
+{"glTexStorage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glTexStorage2D(a0,a1,a2,a3,a4);}},
+{"glColor3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glColor3fv(a0);}},
+{"glGetMultiTexGendvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLdouble*>();table.glGetMultiTexGendvEXT(a0,a1,a2,a3);}},
+{"glVertexAttribL4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL4dvEXT(a0,a1);}},
+{"glGetActiveUniform",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLchar*>();table.glGetActiveUniform(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUniform2ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniform2ui64vARB(a0,a1,a2);}},
+{"glMakeNamedBufferResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glMakeNamedBufferResidentNV(a0,a1);}},
+{"glPathGlyphIndexRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLbitfield>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.pointer<GLuint*>();table.glPathGlyphIndexRangeNV(a0,a1,a2,a3,a4,a5);}},
+{"glColorPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLvoid*>();table.glColorPointer(a0,a1,a2,a3);}},
+{"glProgramEnvParameterI4ivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLint*>();table.glProgramEnvParameterI4ivNV(a0,a1,a2);}},
+{"glMulticastGetQueryObjectui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLuint64*>();table.glMulticastGetQueryObjectui64vNV(a0,a1,a2,a3);}},
+{"glMultiTexParameterfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLfloat>();table.glMultiTexParameterfEXT(a0,a1,a2,a3);}},
+{"glNamedFramebufferTextureLayer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glNamedFramebufferTextureLayer(a0,a1,a2,a3,a4);}},
+{"glGetVertexArrayIntegervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexArrayIntegervEXT(a0,a1,a2);}},
+{"glVertexAttrib3dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexAttrib3dARB(a0,a1,a2,a3);}},
+{"glVDPAUIsSurfaceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLvdpauSurfaceNV>();table.glVDPAUIsSurfaceNV(a0);}},
+{"glMultiTexImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const void*>();table.glMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glIsAsyncMarkerSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsAsyncMarkerSGIX(a0);}},
+{"glGetDoublei_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLdouble*>();table.glGetDoublei_vEXT(a0,a1,a2);}},
+{"glUniform2i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();table.glUniform2i64NV(a0,a1,a2);}},
+{"glIsCommandListNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsCommandListNV(a0);}},
+{"glUniform3uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glUniform3uiEXT(a0,a1,a2,a3);}},
+{"glTexParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glTexParameterIuivEXT(a0,a1,a2);}},
+{"glProgramUniformMatrix4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4fv(a0,a1,a2,a3,a4);}},
+{"glVertex2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glVertex2fv(a0);}},
+{"glVertexAttribL3dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexAttribL3dEXT(a0,a1,a2,a3);}},
+{"glFramebufferRenderbuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glFramebufferRenderbuffer(a0,a1,a2,a3);}},
+{"glGetUniformLocationARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.pointer<const GLcharARB*>();table.glGetUniformLocationARB(a0,a1);}},
+{"glPathParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glPathParameterfvNV(a0,a1,a2);}},
+{"glVertexAttrib3sNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glVertexAttrib3sNV(a0,a1,a2,a3);}},
+{"glGetDoublei_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLdouble*>();table.glGetDoublei_v(a0,a1,a2);}},
+{"glVertexAttrib1sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib1sv(a0,a1);}},
+{"glBindSampler",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glBindSampler(a0,a1);}},
+{"glLineWidth",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glLineWidth(a0);}},
+{"glVertexArrayRangeAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<void*>();table.glVertexArrayRangeAPPLE(a0,a1);}},
+{"glBindBufferOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();table.glBindBufferOffsetEXT(a0,a1,a2,a3);}},
+{"glWeightfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLfloat*>();table.glWeightfvARB(a0,a1);}},
+{"glGetIntegeri_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint*>();table.glGetIntegeri_v(a0,a1,a2);}},
+{"glGetTransformFeedbackVarying",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLchar*>();table.glGetTransformFeedbackVarying(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProgramLocalParameter4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLfloat*>();table.glProgramLocalParameter4fvARB(a0,a1,a2);}},
+{"glGetTransformFeedbackVaryingNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint*>();table.glGetTransformFeedbackVaryingNV(a0,a1,a2);}},
+{"glWindowPos2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos2iv(a0);}},
+{"glVertexStream1dATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();table.glVertexStream1dATI(a0,a1);}},
+{"glColorFragmentOp2ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLuint>();table.glColorFragmentOp2ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glFogiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glFogiv(a0,a1);}},
+{"glGetTextureHandleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGetTextureHandleNV(a0);}},
+{"glLightModeliv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glLightModeliv(a0,a1);}},
+{"glDepthRangef",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glDepthRangef(a0,a1);}},
+{"glGetFragmentMaterialivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFragmentMaterialivSGIX(a0,a1,a2);}},
+{"glVideoCaptureStreamParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glVideoCaptureStreamParameterfvNV(a0,a1,a2,a3);}},
+{"glDeleteProgramsARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteProgramsARB(a0,a1);}},
+{"glWindowPos3fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos3fvARB(a0);}},
+{"glFeedbackBufferxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glFeedbackBufferxOES(a0,a1,a2);}},
+{"glGetTexBumpParameterfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetTexBumpParameterfvATI(a0,a1);}},
+{"glEnablei",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glEnablei(a0,a1);}},
+{"glGetActiveSubroutineName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLchar*>();table.glGetActiveSubroutineName(a0,a1,a2,a3,a4,a5);}},
+{"glDrawBuffersARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLenum*>();table.glDrawBuffersARB(a0,a1);}},
+{"glBindProgramARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindProgramARB(a0,a1);}},
+{"glEvalCoord1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glEvalCoord1fv(a0);}},
+{"glProgramUniform3ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniform3ui64vARB(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2dv(a0,a1,a2,a3,a4);}},
+{"glMultiTexCoord2hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLhalfNV*>();table.glMultiTexCoord2hvNV(a0,a1);}},
+{"glGetFloatIndexedvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetFloatIndexedvEXT(a0,a1,a2);}},
+{"glSampleCoverageARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLboolean>();table.glSampleCoverageARB(a0,a1);}},
+{"glProgramUniform2ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniform2ui64vARB(a0,a1,a2,a3);}},
+{"glPixelDataRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glPixelDataRangeNV(a0,a1,a2);}},
+{"glVertexStream3svATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glVertexStream3svATI(a0,a1);}},
+{"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();auto const a3 = call.pointer<const GLfloat*>();table.glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(a0,a1,a2,a3);}},
+{"glTexCoord3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glTexCoord3hvNV(a0);}},
+{"glSampleMaski",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();table.glSampleMaski(a0,a1);}},
+{"glIndexFuncEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLclampf>();table.glIndexFuncEXT(a0,a1);}},
+{"glPointParameteriNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPointParameteriNV(a0,a1);}},
+{"glUniformMatrix3x2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix3x2fv(a0,a1,a2,a3);}},
+{"glGetFramebufferParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFramebufferParameterivEXT(a0,a1,a2);}},
+{"glUniform2i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64>();auto const a2 = call.scalar<GLint64>();table.glUniform2i64ARB(a0,a1,a2);}},
+{"glNamedBufferStorageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();table.glNamedBufferStorageEXT(a0,a1,a2,a3);}},
+{"glNamedFramebufferTexture3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glNamedFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib2dv(a0,a1);}},
+{"glGetVertexArrayPointervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetVertexArrayPointervEXT(a0,a1,a2);}},
+{"glGetVertexAttribArrayObjectivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribArrayObjectivATI(a0,a1,a2);}},
+{"glProgramUniformMatrix3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3fvEXT(a0,a1,a2,a3,a4);}},
+{"glEnableVertexArrayEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glEnableVertexArrayEXT(a0,a1);}},
+{"glColorTableParameterfvSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glColorTableParameterfvSGI(a0,a1,a2);}},
+{"glEdgeFlag",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLboolean>();table.glEdgeFlag(a0);}},
+{"glFogCoordf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glFogCoordf(a0);}},
+{"glVertex3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertex3d(a0,a1,a2);}},
+{"glVertex3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glVertex3f(a0,a1,a2);}},
+{"glSpriteParameterivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glSpriteParameterivSGIX(a0,a1);}},
+{"glPathGlyphRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLfloat>();table.glPathGlyphRangeNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glPrimitiveBoundingBoxARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();table.glPrimitiveBoundingBoxARB(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glVertexAttribL3ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint64EXT*>();table.glVertexAttribL3ui64vNV(a0,a1);}},
+{"glVertex3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glVertex3s(a0,a1,a2);}},
+{"glTexCoordP2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTexCoordP2ui(a0,a1);}},
+{"glProgramUniform2fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform2fvEXT(a0,a1,a2,a3);}},
+{"glDeletePathsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();table.glDeletePathsNV(a0,a1);}},
+{"glPrimitiveRestartIndexNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glPrimitiveRestartIndexNV(a0);}},
+{"glTexCoord2fColor3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glTexCoord2fColor3fVertex3fvSUN(a0,a1,a2);}},
+{"glTexCoordPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const void**>();auto const a4 = call.scalar<GLint>();table.glTexCoordPointerListIBM(a0,a1,a2,a3,a4);}},
+{"glRectxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glRectxOES(a0,a1,a2,a3);}},
+{"glCopyNamedBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glCopyNamedBufferSubData(a0,a1,a2,a3,a4);}},
+{"glGenProgramsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenProgramsNV(a0,a1);}},
+{"glFragmentLightfSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glFragmentLightfSGIX(a0,a1,a2);}},
+{"glTexStorage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glTexStorage3D(a0,a1,a2,a3,a4,a5);}},
+{"glTextureParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTextureParameteriv(a0,a1,a2);}},
+{"glNamedBufferDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLenum>();table.glNamedBufferDataEXT(a0,a1,a2,a3);}},
+{"glImportSemaphoreWin32NameEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();table.glImportSemaphoreWin32NameEXT(a0,a1,a2);}},
+{"glMultiTexCoord3fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord3fvARB(a0,a1);}},
+{"glUniformMatrix3x4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix3x4fv(a0,a1,a2,a3);}},
+{"glSubpixelPrecisionBiasNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glSubpixelPrecisionBiasNV(a0,a1);}},
+{"glNormalPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLvoid*>();table.glNormalPointer(a0,a1,a2);}},
+{"glNamedFramebufferTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();table.glNamedFramebufferTexture(a0,a1,a2,a3);}},
+{"glVertexAttrib4NsvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib4NsvARB(a0,a1);}},
+{"glPassThrough",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glPassThrough(a0);}},
+{"glSecondaryColorP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glSecondaryColorP3ui(a0,a1);}},
+{"glInvalidateTexSubImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();table.glInvalidateTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glIsImageHandleResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glIsImageHandleResidentARB(a0);}},
+{"glTangent3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glTangent3fvEXT(a0);}},
+{"glProgramUniformMatrix4x3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4x3fv(a0,a1,a2,a3,a4);}},
+{"glBegin",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBegin(a0);}},
+{"glEvalCoord2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glEvalCoord2dv(a0);}},
+{"glColor3ubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glColor3ubv(a0);}},
+{"glFogCoordfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glFogCoordfvEXT(a0);}},
+{"glVertexP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glVertexP3ui(a0,a1);}},
+{"glLightfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glLightfv(a0,a1,a2);}},
+{"glVertexAttribL3i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();table.glVertexAttribL3i64NV(a0,a1,a2,a3);}},
+{"glStencilClearTagEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLuint>();table.glStencilClearTagEXT(a0,a1);}},
+{"glGetActiveUniformName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLchar*>();table.glGetActiveUniformName(a0,a1,a2,a3,a4);}},
+{"glTangentPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glTangentPointerEXT(a0,a1,a2);}},
+{"glUniform4ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64EXT*>();table.glUniform4ui64vNV(a0,a1,a2);}},
+{"glDebugMessageEnableAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.scalar<GLboolean>();table.glDebugMessageEnableAMD(a0,a1,a2,a3,a4);}},
+{"glProgramUniform2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glProgramUniform2ui(a0,a1,a2,a3);}},
+{"glCopyTexSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();table.glCopyTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGenRenderbuffersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenRenderbuffersEXT(a0,a1);}},
+{"glNamedProgramLocalParameterI4ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLint*>();table.glNamedProgramLocalParameterI4ivEXT(a0,a1,a2,a3);}},
+{"glMultiTexCoord2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glMultiTexCoord2f(a0,a1,a2);}},
+{"glMapGrid2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glMapGrid2d(a0,a1,a2,a3,a4,a5);}},
+{"glGetMultiTexParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLuint*>();table.glGetMultiTexParameterIuivEXT(a0,a1,a2,a3);}},
+{"glBlendEquationiARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationiARB(a0,a1);}},
+{"glTexParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTexParameteriv(a0,a1,a2);}},
+{"glUniform4ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform4ivARB(a0,a1,a2);}},
+{"glMatrixOrthoEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();auto const a6 = call.scalar<GLdouble>();table.glMatrixOrthoEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexArrayVertexBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizei>();table.glVertexArrayVertexBuffer(a0,a1,a2,a3,a4);}},
+{"glProgramLocalParametersI4ivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramLocalParametersI4ivNV(a0,a1,a2,a3);}},
+{"glProgramUniform4ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64EXT*>();table.glProgramUniform4ui64vNV(a0,a1,a2,a3);}},
+{"glGetNamedStringivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLchar*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetNamedStringivARB(a0,a1,a2,a3);}},
+{"glVertexAttribL1i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint64EXT*>();table.glVertexAttribL1i64vNV(a0,a1);}},
+{"glTransformFeedbackBufferBase",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glTransformFeedbackBufferBase(a0,a1,a2);}},
+{"glIndexsv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glIndexsv(a0);}},
+{"glPointParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glPointParameterivNV(a0,a1);}},
+{"glGetDetailTexFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetDetailTexFuncSGIS(a0,a1);}},
+{"glReplacementCodeuiColor3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glReplacementCodeuiColor3fVertex3fvSUN(a0,a1,a2);}},
+{"glProgramLocalParameter4fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glProgramLocalParameter4fARB(a0,a1,a2,a3,a4,a5);}},
+{"glBitmap",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.pointer<const GLubyte*>();table.glBitmap(a0,a1,a2,a3,a4,a5,a6);}},
+{"glNamedFramebufferTextureLayerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glNamedFramebufferTextureLayerEXT(a0,a1,a2,a3,a4);}},
+{"glMultiTexGenfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glMultiTexGenfvEXT(a0,a1,a2,a3);}},
+{"glGetNamedBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<void*>();table.glGetNamedBufferSubData(a0,a1,a2,a3);}},
+{"glStencilFuncSeparateATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLuint>();table.glStencilFuncSeparateATI(a0,a1,a2,a3);}},
+{"glProgramUniform2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform2iv(a0,a1,a2,a3);}},
+{"glGetQueryiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetQueryiv(a0,a1,a2);}},
+{"glTexCoord4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glTexCoord4f(a0,a1,a2,a3);}},
+{"glMapGrid2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glMapGrid2f(a0,a1,a2,a3,a4,a5);}},
+{"glListParameterivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glListParameterivSGIX(a0,a1,a2);}},
+{"glCreateQueries",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLuint*>();table.glCreateQueries(a0,a1,a2);}},
+{"glGetSamplerParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetSamplerParameterfv(a0,a1,a2);}},
+{"glTexCoord4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glTexCoord4i(a0,a1,a2,a3);}},
+{"glObjectLabel",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLchar*>();table.glObjectLabel(a0,a1,a2,a3);}},
+{"glProgramUniform3i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();auto const a4 = call.scalar<GLint64EXT>();table.glProgramUniform3i64NV(a0,a1,a2,a3,a4);}},
+{"glGetTextureHandleARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGetTextureHandleARB(a0);}},
+{"glTexCoord4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glTexCoord4s(a0,a1,a2,a3);}},
+{"glUniform4iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glUniform4iARB(a0,a1,a2,a3,a4);}},
+{"glGetUniformIndices",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();auto const a3 = call.pointer<GLuint*>();table.glGetUniformIndices(a0,a1,a2,a3);}},
+{"glMultiTexImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glMultiTexImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glCoverageModulationTableNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLfloat*>();table.glCoverageModulationTableNV(a0,a1);}},
+{"glPointParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glPointParameteriv(a0,a1);}},
+{"glMultiTexCoord4svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord4svARB(a0,a1);}},
+{"glNormal3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glNormal3fv(a0);}},
+{"glProgramUniformMatrix3x4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3x4dvEXT(a0,a1,a2,a3,a4);}},
+{"glTexCoord1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glTexCoord1fv(a0);}},
+{"glProgramUniformMatrix4x3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4x3dvEXT(a0,a1,a2,a3,a4);}},
+{"glGetActiveVaryingNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLchar*>();table.glGetActiveVaryingNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUniform1i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64*>();table.glUniform1i64vARB(a0,a1,a2);}},
+{"glMultiTexCoord1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord1dv(a0,a1);}},
+{"glTexCoord3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glTexCoord3fv(a0);}},
+{"glMatrixTranslatefEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glMatrixTranslatefEXT(a0,a1,a2,a3);}},
+{"glProgramUniform1ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64EXT*>();table.glProgramUniform1ui64vNV(a0,a1,a2,a3);}},
+{"glTextureMaterialEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glTextureMaterialEXT(a0,a1);}},
+{"glMultiTexCoordP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glMultiTexCoordP3uiv(a0,a1,a2);}},
+{"glVertexAttribP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribP3ui(a0,a1,a2,a3);}},
+{"glInterpolatePathsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLfloat>();table.glInterpolatePathsNV(a0,a1,a2,a3);}},
+{"glTextureBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glTextureBufferRange(a0,a1,a2,a3,a4);}},
+{"glVertexAttribL2dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexAttribL2dEXT(a0,a1,a2);}},
+{"glGetPixelTransformParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetPixelTransformParameterivEXT(a0,a1,a2);}},
+{"glTexCoord4xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glTexCoord4xvOES(a0);}},
+{"glGetVariantBooleanvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLboolean*>();table.glGetVariantBooleanvEXT(a0,a1,a2);}},
+{"glDepthRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampd>();auto const a1 = call.scalar<GLclampd>();table.glDepthRange(a0,a1);}},
+{"glGetVertexAttribdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetVertexAttribdvARB(a0,a1,a2);}},
+{"glGetColorTableParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetColorTableParameterfv(a0,a1,a2);}},
+{"glDrawArraysInstancedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glDrawArraysInstancedEXT(a0,a1,a2,a3);}},
+{"glDisableClientStateIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDisableClientStateIndexedEXT(a0,a1);}},
+{"glDrawBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glDrawBuffer(a0);}},
+{"glMultiDrawArraysIndirectBindlessNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();table.glMultiDrawArraysIndirectBindlessNV(a0,a1,a2,a3,a4);}},
+{"glGetnPixelMapusv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLushort*>();table.glGetnPixelMapusv(a0,a1,a2);}},
+{"glRasterPos3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glRasterPos3fv(a0);}},
+{"glClearBufferuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const GLuint*>();table.glClearBufferuiv(a0,a1,a2);}},
+{"glGetInternalformati64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLint64*>();table.glGetInternalformati64v(a0,a1,a2,a3,a4);}},
+{"glShaderSourceARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLcharARB**>();auto const a3 = call.pointer<const GLint*>();table.glShaderSourceARB(a0,a1,a2,a3);}},
+{"glShaderOp3EXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glShaderOp3EXT(a0,a1,a2,a3,a4);}},
+{"glWindowPos2dvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos2dvMESA(a0);}},
+{"glClearIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();table.glClearIndex(a0);}},
+{"glProvokingVertexEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glProvokingVertexEXT(a0);}},
+{"glVariantubvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVariantubvEXT(a0,a1);}},
+{"glFlush",[](FunctionTable const&table,ReplayCall&){table.glFlush();}},
+{"glFramebufferTexture2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTexture2DEXT(a0,a1,a2,a3,a4);}},
+{"glGetColorTableParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetColorTableParameterivEXT(a0,a1,a2);}},
+{"glPresentFrameDualFillNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLuint>();auto const a11 = call.scalar<GLenum>();auto const a12 = call.scalar<GLuint>();table.glPresentFrameDualFillNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}},
+{"glGenVertexShadersEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGenVertexShadersEXT(a0);}},
+{"glSpecializeShaderARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.pointer<const GLuint*>();table.glSpecializeShaderARB(a0,a1,a2,a3,a4);}},
+{"glProgramUniformHandleui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniformHandleui64vARB(a0,a1,a2,a3);}},
+{"glDepthRangefOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();auto const a1 = call.scalar<GLclampf>();table.glDepthRangefOES(a0,a1);}},
+{"glDeleteVertexArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteVertexArrays(a0,a1);}},
+{"glDrawElementsInstancedBaseVertexBaseInstance",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLuint>();table.glDrawElementsInstancedBaseVertexBaseInstance(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetTexLevelParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetTexLevelParameteriv(a0,a1,a2,a3);}},
+{"glDrawVkImageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();table.glDrawVkImageNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glWindowPos3iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glWindowPos3iARB(a0,a1,a2);}},
+{"glPrioritizeTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<const GLclampf*>();table.glPrioritizeTextures(a0,a1,a2);}},
+{"glWindowPos3fvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos3fvMESA(a0);}},
+{"glProgramUniformMatrix3x2dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3x2dvEXT(a0,a1,a2,a3,a4);}},
+{"glVertex4xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glVertex4xvOES(a0);}},
+{"glTexStorage3DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTexStorage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}},
+{"glWindowPos2sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glWindowPos2sARB(a0,a1);}},
+{"glStencilOpValueAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glStencilOpValueAMD(a0,a1);}},
+{"glProgramVertexLimitNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glProgramVertexLimitNV(a0,a1);}},
+{"glGetTexParameterPointervAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetTexParameterPointervAPPLE(a0,a1,a2);}},
+{"glProgramUniform3uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform3uivEXT(a0,a1,a2,a3);}},
+{"glClampColor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glClampColor(a0,a1);}},
+{"glClearStencil",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glClearStencil(a0);}},
+{"glTexCoordP1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glTexCoordP1uiv(a0,a1);}},
+{"glVertexAttribs3svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLshort*>();table.glVertexAttribs3svNV(a0,a1,a2);}},
+{"glMultiTexCoord3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord3fv(a0,a1);}},
+{"glVertexBlendEnvfATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glVertexBlendEnvfATI(a0,a1);}},
+{"glIsFenceAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsFenceAPPLE(a0);}},
+{"glGetBufferParameterui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetBufferParameterui64vNV(a0,a1,a2);}},
+{"glVertexAttribI4bvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttribI4bvEXT(a0,a1);}},
+{"glUniform2fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glUniform2fARB(a0,a1,a2);}},
+{"glStopInstrumentsSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glStopInstrumentsSGIX(a0);}},
+{"glVertexAttrib3fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glVertexAttrib3fNV(a0,a1,a2,a3);}},
+{"glMapVertexAttrib2dAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLdouble>();auto const a7 = call.scalar<GLdouble>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLint>();auto const a10 = call.pointer<const GLdouble*>();table.glMapVertexAttrib2dAPPLE(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glVertex2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glVertex2f(a0,a1);}},
+{"glCopyTextureImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLint>();table.glCopyTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glVertex2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glVertex2d(a0,a1);}},
+{"glSecondaryColor3bvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glSecondaryColor3bvEXT(a0);}},
+{"glMultiTexCoord4fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glMultiTexCoord4fARB(a0,a1,a2,a3,a4);}},
+{"glPolygonOffset",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glPolygonOffset(a0,a1);}},
+{"glTangent3bvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glTangent3bvEXT(a0);}},
+{"glHistogram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();table.glHistogram(a0,a1,a2,a3);}},
+{"glGetProgramiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetProgramiv(a0,a1,a2);}},
+{"glMatrixIndexubvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLubyte*>();table.glMatrixIndexubvARB(a0,a1);}},
+{"glVertex2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glVertex2s(a0,a1);}},
+{"glGetVertexAttribLui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetVertexAttribLui64vNV(a0,a1,a2);}},
+{"glGetProgramStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void*>();table.glGetProgramStringARB(a0,a1,a2);}},
+{"glFlushMappedBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();table.glFlushMappedBufferRange(a0,a1,a2);}},
+{"glVertexAttribI3uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribI3uiEXT(a0,a1,a2,a3);}},
+{"glLineWidthxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glLineWidthxOES(a0);}},
+{"glProgramUniformMatrix2fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2fvEXT(a0,a1,a2,a3,a4);}},
+{"glGetTextureParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLuint*>();table.glGetTextureParameterIuivEXT(a0,a1,a2,a3);}},
+{"glGetMultiTexEnvivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetMultiTexEnvivEXT(a0,a1,a2,a3);}},
+{"glPixelTexGenParameterivSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glPixelTexGenParameterivSGIS(a0,a1);}},
+{"glGenQueries",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenQueries(a0,a1);}},
+{"glGetPixelMapfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetPixelMapfv(a0,a1);}},
+{"glBlendColorEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glBlendColorEXT(a0,a1,a2,a3);}},
+{"glResetMinmax",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glResetMinmax(a0);}},
+{"glGetnUniformivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint*>();table.glGetnUniformivARB(a0,a1,a2,a3);}},
+{"glVertexBlendARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glVertexBlendARB(a0);}},
+{"glVertexAttrib4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexAttrib4d(a0,a1,a2,a3,a4);}},
+{"glGetVaryingLocationNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetVaryingLocationNV(a0,a1);}},
+{"glGetMapAttribParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetMapAttribParameterivNV(a0,a1,a2,a3);}},
+{"glTexSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const GLvoid*>();table.glTexSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glDeleteSamplers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteSamplers(a0,a1);}},
+{"glGetLightxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetLightxOES(a0,a1,a2);}},
+{"glGetVertexAttribArrayObjectfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVertexAttribArrayObjectfvATI(a0,a1,a2);}},
+{"glVertexArrayNormalOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLintptr>();table.glVertexArrayNormalOffsetEXT(a0,a1,a2,a3,a4);}},
+{"glGetBufferParameterivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetBufferParameterivARB(a0,a1,a2);}},
+{"glGetTextureParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetTextureParameterfv(a0,a1,a2);}},
+{"glDrawMeshArraysSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glDrawMeshArraysSUN(a0,a1,a2,a3);}},
+{"glVertexAttrib4dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexAttrib4dNV(a0,a1,a2,a3,a4);}},
+{"glGetMultisamplefvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetMultisamplefvNV(a0,a1,a2);}},
+{"glMapObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glMapObjectBufferATI(a0);}},
+{"glGetPathCommandsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLubyte*>();table.glGetPathCommandsNV(a0,a1);}},
+{"glVertexArrayTexCoordOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLintptr>();table.glVertexArrayTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5);}},
+{"glGetHistogram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLvoid*>();table.glGetHistogram(a0,a1,a2,a3,a4);}},
+{"glMatrixMode",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glMatrixMode(a0);}},
+{"glColorFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();table.glColorFormatNV(a0,a1,a2);}},
+{"glProgramUniformui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64EXT>();table.glProgramUniformui64NV(a0,a1,a2);}},
+{"glProgramUniformMatrix4x2fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4x2fvEXT(a0,a1,a2,a3,a4);}},
+{"glLoadMatrixxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glLoadMatrixxOES(a0);}},
+{"glGetColorTableParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetColorTableParameterfvEXT(a0,a1,a2);}},
+{"glRasterPos4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glRasterPos4i(a0,a1,a2,a3);}},
+{"glVertexAttribL2i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint64EXT>();auto const a2 = call.scalar<GLint64EXT>();table.glVertexAttribL2i64NV(a0,a1,a2);}},
+{"glBindTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glBindTextures(a0,a1,a2);}},
+{"glMatrixRotatefEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glMatrixRotatefEXT(a0,a1,a2,a3,a4);}},
+{"glGetClipPlanexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfixed*>();table.glGetClipPlanexOES(a0,a1);}},
+{"glSecondaryColor3uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();table.glSecondaryColor3uivEXT(a0);}},
+{"glGetPerfQueryInfoINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLchar*>();auto const a3 = call.pointer<GLuint*>();auto const a4 = call.pointer<GLuint*>();auto const a5 = call.pointer<GLuint*>();auto const a6 = call.pointer<GLuint*>();table.glGetPerfQueryInfoINTEL(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetDoublev",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLdouble*>();table.glGetDoublev(a0,a1);}},
+{"glBindBufferRangeEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glBindBufferRangeEXT(a0,a1,a2,a3,a4);}},
+{"glCompressedTexImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const GLvoid*>();table.glCompressedTexImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMapBufferARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glMapBufferARB(a0,a1);}},
+{"glGetPathSpacingNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<GLfloat*>();table.glGetPathSpacingNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glUniform4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glUniform4dv(a0,a1,a2);}},
+{"glGlobalAlphaFactordSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glGlobalAlphaFactordSUN(a0);}},
+{"glProgramUniform3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform3dv(a0,a1,a2,a3);}},
+{"glGetShaderSourceARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLcharARB*>();table.glGetShaderSourceARB(a0,a1,a2,a3);}},
+{"glVertexAttrib3dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib3dvARB(a0,a1);}},
+{"glInvalidateBufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glInvalidateBufferData(a0);}},
+{"glMatrixLoad3x2fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixLoad3x2fNV(a0,a1);}},
+{"glCompressedTextureSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<const void*>();table.glCompressedTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glTexCoord3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glTexCoord3xvOES(a0);}},
+{"glGenTexturesEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenTexturesEXT(a0,a1);}},
+{"glTangent3iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glTangent3iEXT(a0,a1,a2);}},
+{"glClearTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const void*>();table.glClearTexImage(a0,a1,a2,a3,a4);}},
+{"glBinormal3bvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glBinormal3bvEXT(a0);}},
+{"glUniform3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform3fv(a0,a1,a2);}},
+{"glGetnPixelMapusvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLushort*>();table.glGetnPixelMapusvARB(a0,a1,a2);}},
+{"glMemoryObjectParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glMemoryObjectParameterivEXT(a0,a1,a2);}},
+{"glGenSemaphoresEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenSemaphoresEXT(a0,a1);}},
+{"glMultiTexCoordP1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glMultiTexCoordP1ui(a0,a1,a2);}},
+{"glClearNamedBufferDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const void*>();table.glClearNamedBufferDataEXT(a0,a1,a2,a3,a4);}},
+{"glUniformMatrix4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix4dv(a0,a1,a2,a3);}},
+{"glWindowPos3fMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glWindowPos3fMESA(a0,a1,a2);}},
+{"glDeleteRenderbuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteRenderbuffers(a0,a1);}},
+{"glGetTextureLevelParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLfloat*>();table.glGetTextureLevelParameterfvEXT(a0,a1,a2,a3,a4);}},
+{"glGetHistogramParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetHistogramParameterxvOES(a0,a1,a2);}},
+{"glMultiDrawElements",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLsizei*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*const*>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawElements(a0,a1,a2,a3,a4);}},
+{"glMakeImageHandleNonResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeImageHandleNonResidentNV(a0);}},
+{"glTexSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glNormalStream3dATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glNormalStream3dATI(a0,a1,a2,a3);}},
+{"glVertexAttribL4i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint64EXT*>();table.glVertexAttribL4i64vNV(a0,a1);}},
+{"glDrawBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLenum*>();table.glDrawBuffers(a0,a1);}},
+{"glCopyTextureSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();table.glCopyTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glWindowRectanglesEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glWindowRectanglesEXT(a0,a1,a2);}},
+{"glNamedFramebufferReadBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glNamedFramebufferReadBuffer(a0,a1);}},
+{"glUniform2i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64*>();table.glUniform2i64vARB(a0,a1,a2);}},
+{"glVertexAttribI1uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI1uivEXT(a0,a1);}},
+{"glGetTexGenfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetTexGenfv(a0,a1,a2);}},
+{"glBeginQueryARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBeginQueryARB(a0,a1);}},
+{"glUniform1iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glUniform1iARB(a0,a1);}},
+{"glVertex4bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glVertex4bvOES(a0);}},
+{"glInvalidateSubFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();table.glInvalidateSubFramebuffer(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUniform1fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform1fvARB(a0,a1,a2);}},
+{"glTestFenceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glTestFenceNV(a0);}},
+{"glBindTransformFeedback",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindTransformFeedback(a0,a1);}},
+{"glMultiTexCoord2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord2iv(a0,a1);}},
+{"glCopyMultiTexSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();table.glCopyMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVariantbvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVariantbvEXT(a0,a1);}},
+{"glTexCoord1hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();table.glTexCoord1hNV(a0);}},
+{"glGenFencesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenFencesNV(a0,a1);}},
+{"glRasterPos3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glRasterPos3iv(a0);}},
+{"glVertexAttribL2ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();table.glVertexAttribL2ui64NV(a0,a1,a2);}},
+{"glMultiTexCoord1hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLhalfNV*>();table.glMultiTexCoord1hvNV(a0,a1);}},
+{"glGetnConvolutionFilter",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<void*>();table.glGetnConvolutionFilter(a0,a1,a2,a3,a4);}},
+{"glNormal3bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glNormal3bv(a0);}},
+{"glWeightbvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLbyte*>();table.glWeightbvARB(a0,a1);}},
+{"glTexCoord4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glTexCoord4sv(a0);}},
+{"glUniform2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform2uiv(a0,a1,a2);}},
+{"glBeginConditionalRenderNVX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBeginConditionalRenderNVX(a0);}},
+{"glFinish",[](FunctionTable const&table,ReplayCall&){table.glFinish();}},
+{"glColorTableParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glColorTableParameterfv(a0,a1,a2);}},
+{"glFragmentCoverageColorNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glFragmentCoverageColorNV(a0);}},
+{"glProgramUniform3ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform3ivEXT(a0,a1,a2,a3);}},
+{"glVertexArrayVertexOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLintptr>();table.glVertexArrayVertexOffsetEXT(a0,a1,a2,a3,a4,a5);}},
+{"glViewportPositionWScaleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glViewportPositionWScaleNV(a0,a1,a2);}},
+{"glGetProgramLocalParameterIuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLuint*>();table.glGetProgramLocalParameterIuivNV(a0,a1,a2);}},
+{"glReplacementCodeuiTexCoord2fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glReplacementCodeuiTexCoord2fVertex3fvSUN(a0,a1,a2);}},
+{"glUniform1uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform1uiv(a0,a1,a2);}},
+{"glUniformMatrix2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix2dv(a0,a1,a2,a3);}},
+{"glIndexdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glIndexdv(a0);}},
+{"glSecondaryColor3ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glSecondaryColor3ivEXT(a0);}},
+{"glTexCoord3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glTexCoord3iv(a0);}},
+{"glVertexStream4fvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexStream4fvATI(a0,a1);}},
+{"glDeformationMap3fSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLint>();auto const a13 = call.pointer<const GLfloat*>();table.glDeformationMap3fSGIX(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13);}},
+{"glClearDepth",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampd>();table.glClearDepth(a0);}},
+{"glGenAsyncMarkersSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();table.glGenAsyncMarkersSGIX(a0);}},
+{"glDisableIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDisableIndexedEXT(a0,a1);}},
+{"glVertexWeightfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glVertexWeightfvEXT(a0);}},
+{"glGetProgramLocalParameterIivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint*>();table.glGetProgramLocalParameterIivNV(a0,a1,a2);}},
+{"glCompressedTexImage3DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const void*>();table.glCompressedTexImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glProgramParameter4fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();table.glProgramParameter4fNV(a0,a1,a2,a3,a4,a5);}},
+{"glConvolutionParameterxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glConvolutionParameterxOES(a0,a1,a2);}},
+{"glInsertComponentEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glInsertComponentEXT(a0,a1,a2);}},
+{"glCreateTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLuint*>();table.glCreateTextures(a0,a1,a2);}},
+{"glSecondaryColor3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glSecondaryColor3iv(a0);}},
+{"glCreateBuffers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateBuffers(a0,a1);}},
+{"glMultiTexCoord2xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glMultiTexCoord2xvOES(a0,a1);}},
+{"glTexGenxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glTexGenxvOES(a0,a1,a2);}},
+{"glMultTransposeMatrixf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glMultTransposeMatrixf(a0);}},
+{"glBeginTransformFeedbackEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBeginTransformFeedbackEXT(a0);}},
+{"glTexCoord2fColor3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();table.glTexCoord2fColor3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glNormal3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glNormal3sv(a0);}},
+{"glFreeObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glFreeObjectBufferATI(a0);}},
+{"glBlendBarrierNV",[](FunctionTable const&table,ReplayCall&){table.glBlendBarrierNV();}},
+{"glUniform4i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64EXT*>();table.glUniform4i64vNV(a0,a1,a2);}},
+{"glGetnUniformuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLuint*>();table.glGetnUniformuivARB(a0,a1,a2,a3);}},
+{"glAlphaFragmentOp3ATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLuint>();auto const a10 = call.scalar<GLuint>();auto const a11 = call.scalar<GLuint>();table.glAlphaFragmentOp3ATI(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glProgramEnvParameters4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramEnvParameters4fvEXT(a0,a1,a2,a3);}},
+{"glBlendFuncSeparateEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glBlendFuncSeparateEXT(a0,a1,a2,a3);}},
+{"glConvolutionParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glConvolutionParameterivEXT(a0,a1,a2);}},
+{"glPixelTexGenSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glPixelTexGenSGIX(a0);}},
+{"glDeleteProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDeleteProgram(a0);}},
+{"glUniformMatrix4x3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix4x3dv(a0,a1,a2,a3);}},
+{"glGetVideoCaptureStreamivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetVideoCaptureStreamivNV(a0,a1,a2,a3);}},
+{"glProgramUniform4uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glProgramUniform4uiEXT(a0,a1,a2,a3,a4,a5);}},
+{"glMakeImageHandleNonResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glMakeImageHandleNonResidentARB(a0);}},
+{"glSecondaryColor3dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glSecondaryColor3dEXT(a0,a1,a2);}},
+{"glDeleteQueries",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteQueries(a0,a1);}},
+{"glNormalP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glNormalP3uiv(a0,a1);}},
+{"glRasterPos2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glRasterPos2d(a0,a1);}},
+{"glInitNames",[](FunctionTable const&table,ReplayCall&){table.glInitNames();}},
+{"glBinormal3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glBinormal3fvEXT(a0);}},
+{"glColor3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glColor3dv(a0);}},
+{"glVertexArrayVertexAttribDivisorEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexArrayVertexAttribDivisorEXT(a0,a1,a2);}},
+{"glArrayElementEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glArrayElementEXT(a0);}},
+{"glProgramParameter4dNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glProgramParameter4dNV(a0,a1,a2,a3,a4,a5);}},
+{"glIndexxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glIndexxOES(a0);}},
+{"glUniform3uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform3uivEXT(a0,a1,a2);}},
+{"glPopGroupMarkerEXT",[](FunctionTable const&table,ReplayCall&){table.glPopGroupMarkerEXT();}},
+{"glClearNamedFramebufferuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const GLuint*>();table.glClearNamedFramebufferuiv(a0,a1,a2,a3);}},
+{"glSetLocalConstantEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();table.glSetLocalConstantEXT(a0,a1,a2);}},
+{"glProgramUniform1ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64EXT>();table.glProgramUniform1ui64NV(a0,a1,a2);}},
+{"glColor4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glColor4hvNV(a0);}},
+{"glGetVertexAttribfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVertexAttribfv(a0,a1,a2);}},
+{"glDispatchCompute",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glDispatchCompute(a0,a1,a2);}},
+{"glGetActiveAttrib",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLchar*>();table.glGetActiveAttrib(a0,a1,a2,a3,a4,a5,a6);}},
+{"glFragmentColorMaterialSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glFragmentColorMaterialSGIX(a0,a1);}},
+{"glTexSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const GLvoid*>();table.glTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glGetnMinmaxARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnMinmaxARB(a0,a1,a2,a3,a4,a5);}},
+{"glLogicOp",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glLogicOp(a0);}},
+{"glProgramUniformMatrix3x4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3x4fv(a0,a1,a2,a3,a4);}},
+{"glWindowPos4iMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glWindowPos4iMESA(a0,a1,a2,a3);}},
+{"glPixelTransferf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPixelTransferf(a0,a1);}},
+{"glGetTextureParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetTextureParameterIuiv(a0,a1,a2);}},
+{"glMultiTexCoord1xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glMultiTexCoord1xOES(a0,a1);}},
+{"glProgramUniformMatrix4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4dv(a0,a1,a2,a3,a4);}},
+{"glGetnUniformiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint*>();table.glGetnUniformiv(a0,a1,a2,a3);}},
+{"glFramebufferTexture1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTexture1DEXT(a0,a1,a2,a3,a4);}},
+{"glVertexPointervINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void**>();table.glVertexPointervINTEL(a0,a1,a2);}},
+{"glTextureParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTextureParameterIiv(a0,a1,a2);}},
+{"glGetSeparableFilterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();auto const a4 = call.pointer<void*>();auto const a5 = call.pointer<void*>();table.glGetSeparableFilterEXT(a0,a1,a2,a3,a4,a5);}},
+{"glMultiTexCoord3iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glMultiTexCoord3iARB(a0,a1,a2,a3);}},
+{"glRasterPos4xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glRasterPos4xvOES(a0);}},
+{"glDrawTransformFeedbackStream",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glDrawTransformFeedbackStream(a0,a1,a2);}},
+{"glVertex3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glVertex3hvNV(a0);}},
+{"glVertexArrayMultiTexCoordOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLintptr>();table.glVertexArrayMultiTexCoordOffsetEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProvokingVertex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glProvokingVertex(a0);}},
+{"glAccumxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glAccumxOES(a0,a1);}},
+{"glShaderBinary",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();table.glShaderBinary(a0,a1,a2,a3,a4);}},
+{"glGetMultiTexGenivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetMultiTexGenivEXT(a0,a1,a2,a3);}},
+{"glPointParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glPointParameterxvOES(a0,a1);}},
+{"glCreateStatesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateStatesNV(a0,a1);}},
+{"glClearDepthdNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glClearDepthdNV(a0);}},
+{"glClearColorIuiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glClearColorIuiEXT(a0,a1,a2,a3);}},
+{"glBindMultiTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glBindMultiTextureEXT(a0,a1,a2);}},
+{"glTexGeniv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTexGeniv(a0,a1,a2);}},
+{"glDrawElements",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLvoid*>();table.glDrawElements(a0,a1,a2,a3);}},
+{"glProgramUniform4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform4iv(a0,a1,a2,a3);}},
+{"glDisableVertexArrayEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glDisableVertexArrayEXT(a0,a1);}},
+{"glProgramUniform3ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();auto const a4 = call.scalar<GLuint64EXT>();table.glProgramUniform3ui64NV(a0,a1,a2,a3,a4);}},
+{"glClientActiveTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glClientActiveTexture(a0);}},
+{"glMultiTexParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glMultiTexParameterIivEXT(a0,a1,a2,a3);}},
+{"glUniform1i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64>();table.glUniform1i64ARB(a0,a1);}},
+{"glUniform1iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform1iv(a0,a1,a2);}},
+{"glMulticastBarrierNV",[](FunctionTable const&table,ReplayCall&){table.glMulticastBarrierNV();}},
+{"glVertexAttribArrayObjectATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();table.glVertexAttribArrayObjectATI(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUniform2iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glUniform2iARB(a0,a1,a2);}},
+{"glDrawArraysInstanced",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glDrawArraysInstanced(a0,a1,a2,a3);}},
+{"glVertexAttrib2sNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glVertexAttrib2sNV(a0,a1,a2);}},
+{"glTexBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glTexBufferEXT(a0,a1,a2);}},
+{"glVertexStream2fATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glVertexStream2fATI(a0,a1,a2);}},
+{"glDebugMessageCallbackAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.null<GLDEBUGPROCAMD>();auto const a1 = call.pointer<void*>();table.glDebugMessageCallbackAMD(a0,a1);}},
+{"glSamplerParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glSamplerParameteriv(a0,a1,a2);}},
+{"glVertexAttrib4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttrib4uiv(a0,a1);}},
+{"glEndQueryIndexed",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glEndQueryIndexed(a0,a1);}},
+{"glNormalStream3sATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glNormalStream3sATI(a0,a1,a2,a3);}},
+{"glProgramParameteriARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glProgramParameteriARB(a0,a1,a2);}},
+{"glTexEnvxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glTexEnvxOES(a0,a1,a2);}},
+{"glProgramUniform1iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform1iv(a0,a1,a2,a3);}},
+{"glDisableVertexAttribAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glDisableVertexAttribAPPLE(a0,a1);}},
+{"glBindRenderbuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindRenderbuffer(a0,a1);}},
+{"glMultiTexSubImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLenum>();auto const a11 = call.pointer<const void*>();table.glMultiTexSubImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glIsProgram",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsProgram(a0);}},
+{"glMultiDrawElementsIndirectAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawElementsIndirectAMD(a0,a1,a2,a3,a4);}},
+{"glGetProgramInfoLog",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetProgramInfoLog(a0,a1,a2,a3);}},
+{"glGetLocalConstantBooleanvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLboolean*>();table.glGetLocalConstantBooleanvEXT(a0,a1,a2);}},
+{"glPixelTransformParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glPixelTransformParameteriEXT(a0,a1,a2);}},
+{"glTexCoord4bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();table.glTexCoord4bOES(a0,a1,a2,a3);}},
+{"glVertexAttrib4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib4fv(a0,a1);}},
+{"glProgramUniformMatrix2x3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2x3dv(a0,a1,a2,a3,a4);}},
+{"glProgramEnvParametersI4uivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramEnvParametersI4uivNV(a0,a1,a2,a3);}},
+{"glTexCoord3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glTexCoord3xOES(a0,a1,a2);}},
+{"glLoadTransposeMatrixfARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glLoadTransposeMatrixfARB(a0);}},
+{"glImageTransformParameteriHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glImageTransformParameteriHP(a0,a1,a2);}},
+{"glMultiTexCoord4xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();auto const a4 = call.scalar<GLfixed>();table.glMultiTexCoord4xOES(a0,a1,a2,a3,a4);}},
+{"glVertexAttribs3fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glVertexAttribs3fvNV(a0,a1,a2);}},
+{"glVertexAttrib2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib2fv(a0,a1);}},
+{"glUniform3ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();table.glUniform3ui64NV(a0,a1,a2,a3);}},
+{"glCombinerParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glCombinerParameterfvNV(a0,a1);}},
+{"glFragmentMaterialiSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glFragmentMaterialiSGIX(a0,a1,a2);}},
+{"glGetBooleani_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLboolean*>();table.glGetBooleani_v(a0,a1,a2);}},
+{"glGetProgramResourceIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLchar*>();table.glGetProgramResourceIndex(a0,a1,a2);}},
+{"glBeginConditionalRenderNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glBeginConditionalRenderNV(a0,a1);}},
+{"glDisableClientState",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glDisableClientState(a0);}},
+{"glPathFogGenNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glPathFogGenNV(a0);}},
+{"glStencilThenCoverFillPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();table.glStencilThenCoverFillPathNV(a0,a1,a2,a3);}},
+{"glVertexArrayIndexOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLintptr>();table.glVertexArrayIndexOffsetEXT(a0,a1,a2,a3,a4);}},
+{"glProgramBufferParametersIuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLuint*>();table.glProgramBufferParametersIuivNV(a0,a1,a2,a3,a4);}},
+{"glPixelTransformParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glPixelTransformParameterivEXT(a0,a1,a2);}},
+{"glDisableClientStateiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDisableClientStateiEXT(a0,a1);}},
+{"glTexBufferARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glTexBufferARB(a0,a1,a2);}},
+{"glGetLocalConstantIntegervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetLocalConstantIntegervEXT(a0,a1,a2);}},
+{"glColor4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();table.glColor4uiv(a0);}},
+{"glProgramUniform3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glProgramUniform3i(a0,a1,a2,a3,a4);}},
+{"glMultiDrawElementsIndirectBindlessCountNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();table.glMultiDrawElementsIndirectBindlessCountNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetBufferPointervARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetBufferPointervARB(a0,a1,a2);}},
+{"glMultiTexParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLuint*>();table.glMultiTexParameterIuivEXT(a0,a1,a2,a3);}},
+{"glEvalMesh2",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glEvalMesh2(a0,a1,a2,a3,a4);}},
+{"glEvalMesh1",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glEvalMesh1(a0,a1,a2);}},
+{"glProgramUniform3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glProgramUniform3f(a0,a1,a2,a3,a4);}},
+{"glStencilThenCoverFillPathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const GLfloat*>();table.glStencilThenCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glProgramUniform3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glProgramUniform3d(a0,a1,a2,a3,a4);}},
+{"glMapVertexAttrib1dAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.pointer<const GLdouble*>();table.glMapVertexAttrib1dAPPLE(a0,a1,a2,a3,a4,a5,a6);}},
+{"glEvalCoord2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glEvalCoord2fv(a0);}},
+{"glGetUniformivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLint*>();table.glGetUniformivARB(a0,a1,a2);}},
+{"glLoadTransposeMatrixd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glLoadTransposeMatrixd(a0);}},
+{"glLoadTransposeMatrixf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glLoadTransposeMatrixf(a0);}},
+{"glGetPointervEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<void**>();table.glGetPointervEXT(a0,a1);}},
+{"glSignalVkSemaphoreNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glSignalVkSemaphoreNV(a0);}},
+{"glEndConditionalRenderNV",[](FunctionTable const&table,ReplayCall&){table.glEndConditionalRenderNV();}},
+{"glTexCoord2fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();table.glTexCoord2fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glUniform3i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64*>();table.glUniform3i64vARB(a0,a1,a2);}},
+{"glProgramUniform2uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glProgramUniform2uiEXT(a0,a1,a2,a3);}},
+{"glVertexAttribI1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexAttribI1ui(a0,a1);}},
+{"glProgramNamedParameter4dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramNamedParameter4dvNV(a0,a1,a2,a3);}},
+{"glCompileCommandListNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glCompileCommandListNV(a0);}},
+{"glGetRenderbufferParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetRenderbufferParameterivEXT(a0,a1,a2);}},
+{"glGetnPolygonStipple",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLubyte*>();table.glGetnPolygonStipple(a0,a1);}},
+{"glIsBufferResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glIsBufferResidentNV(a0);}},
+{"glSecondaryColor3ubvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glSecondaryColor3ubvEXT(a0);}},
+{"glGetNamedRenderbufferParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedRenderbufferParameterivEXT(a0,a1,a2);}},
+{"glNamedFramebufferSampleLocationsfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glNamedFramebufferSampleLocationsfvARB(a0,a1,a2,a3);}},
+{"glMultiTexGendvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLdouble*>();table.glMultiTexGendvEXT(a0,a1,a2,a3);}},
+{"glVertexArrayRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const void*>();table.glVertexArrayRangeNV(a0,a1);}},
+{"glIsTextureHandleResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glIsTextureHandleResidentNV(a0);}},
+{"glGetProgramEnvParameterdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLdouble*>();table.glGetProgramEnvParameterdvARB(a0,a1,a2);}},
+{"glIsNamedStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLchar*>();table.glIsNamedStringARB(a0,a1);}},
+{"glSecondaryColorFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();table.glSecondaryColorFormatNV(a0,a1,a2);}},
+{"glVertexAttrib4ubvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttrib4ubvNV(a0,a1);}},
+{"glTagSampleBufferSGIX",[](FunctionTable const&table,ReplayCall&){table.glTagSampleBufferSGIX();}},
+{"glVDPAUUnregisterSurfaceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLvdpauSurfaceNV>();table.glVDPAUUnregisterSurfaceNV(a0);}},
+{"glGetPerfQueryIdByNameINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLchar*>();auto const a1 = call.pointer<GLuint*>();table.glGetPerfQueryIdByNameINTEL(a0,a1);}},
+{"glGetInteger64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLint64*>();table.glGetInteger64v(a0,a1);}},
+{"glClipPlane",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glClipPlane(a0,a1);}},
+{"glColor4ubVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();table.glColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6);}},
+{"glIndexub",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();table.glIndexub(a0);}},
+{"glGetProgramEnvParameterfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLfloat*>();table.glGetProgramEnvParameterfvARB(a0,a1,a2);}},
+{"glVertexAttrib4usvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttrib4usvARB(a0,a1);}},
+{"glNamedFramebufferRenderbuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glNamedFramebufferRenderbuffer(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix3x4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3x4dv(a0,a1,a2,a3,a4);}},
+{"glTestFenceAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glTestFenceAPPLE(a0);}},
+{"glVertexAttrib4Niv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttrib4Niv(a0,a1);}},
+{"glVertexAttribL2i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint64EXT*>();table.glVertexAttribL2i64vNV(a0,a1);}},
+{"glColorP4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glColorP4uiv(a0,a1);}},
+{"glUniformMatrix2x3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix2x3fv(a0,a1,a2,a3);}},
+{"glCallCommandListNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glCallCommandListNV(a0);}},
+{"glClearBufferiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const GLint*>();table.glClearBufferiv(a0,a1,a2);}},
+{"glNamedStringARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const GLchar*>();auto const a3 = call.scalar<GLint>();auto const a4 = call.pointer<const GLchar*>();table.glNamedStringARB(a0,a1,a2,a3,a4);}},
+{"glMatrixMult3x2fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixMult3x2fNV(a0,a1);}},
+{"glGetNamedProgramStringEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<void*>();table.glGetNamedProgramStringEXT(a0,a1,a2,a3);}},
+{"glGetnHistogramARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnHistogramARB(a0,a1,a2,a3,a4,a5);}},
+{"glGetTextureLevelParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLfloat*>();table.glGetTextureLevelParameterfv(a0,a1,a2,a3);}},
+{"glMultiTexCoord1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord1fv(a0,a1);}},
+{"glBitmapxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();auto const a4 = call.scalar<GLfixed>();auto const a5 = call.scalar<GLfixed>();auto const a6 = call.pointer<const GLubyte*>();table.glBitmapxOES(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetSamplerParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetSamplerParameterIuiv(a0,a1,a2);}},
+{"glTexCoordP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTexCoordP3ui(a0,a1);}},
+{"glTextureSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();table.glTextureSubImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribLPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexAttribLPointerEXT(a0,a1,a2,a3,a4);}},
+{"glFogCoordPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glFogCoordPointerEXT(a0,a1,a2);}},
+{"glWindowPos3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glWindowPos3s(a0,a1,a2);}},
+{"glVertexAttribs2svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLshort*>();table.glVertexAttribs2svNV(a0,a1,a2);}},
+{"glTextureImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glWindowPos3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glWindowPos3i(a0,a1,a2);}},
+{"glWindowPos3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glWindowPos3d(a0,a1,a2);}},
+{"glWindowPos3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glWindowPos3f(a0,a1,a2);}},
+{"glIsEnabledIndexedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glIsEnabledIndexedEXT(a0,a1);}},
+{"glGetNamedProgramivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetNamedProgramivEXT(a0,a1,a2,a3);}},
+{"glVertex3xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glVertex3xvOES(a0);}},
+{"glColor3us",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();auto const a1 = call.scalar<GLushort>();auto const a2 = call.scalar<GLushort>();table.glColor3us(a0,a1,a2);}},
+{"glBeginPerfMonitorAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBeginPerfMonitorAMD(a0);}},
+{"glProgramUniformMatrix4x3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4x3dv(a0,a1,a2,a3,a4);}},
+{"glGetNamedProgramLocalParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLuint*>();table.glGetNamedProgramLocalParameterIuivEXT(a0,a1,a2,a3);}},
+{"glReadnPixels",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<void*>();table.glReadnPixels(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMultiTexCoord4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glMultiTexCoord4f(a0,a1,a2,a3,a4);}},
+{"glColor3ub",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();table.glColor3ub(a0,a1,a2);}},
+{"glMultiTexCoord4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glMultiTexCoord4d(a0,a1,a2,a3,a4);}},
+{"glVertexAttribL3ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();table.glVertexAttribL3ui64NV(a0,a1,a2,a3);}},
+{"glColor3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glColor3ui(a0,a1,a2);}},
+{"glProgramUniform4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform4fvEXT(a0,a1,a2,a3);}},
+{"glVertexAttrib2sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glVertexAttrib2sARB(a0,a1,a2);}},
+{"glMultiTexCoord4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glMultiTexCoord4i(a0,a1,a2,a3,a4);}},
+{"glCheckFramebufferStatusEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glCheckFramebufferStatusEXT(a0);}},
+{"glGetnMapivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint*>();table.glGetnMapivARB(a0,a1,a2,a3);}},
+{"glMultiTexCoord1ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord1ivARB(a0,a1);}},
+{"glDisableVertexAttribArrayARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDisableVertexAttribArrayARB(a0);}},
+{"glGetPolygonStipple",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLubyte*>();table.glGetPolygonStipple(a0);}},
+{"glVertexAttribI4ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glVertexAttribI4ui(a0,a1,a2,a3,a4);}},
+{"glGetPathDashArrayNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLfloat*>();table.glGetPathDashArrayNV(a0,a1);}},
+{"glMultiTexRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glMultiTexRenderbufferEXT(a0,a1,a2);}},
+{"glCopyTextureSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();table.glCopyTextureSubImage1D(a0,a1,a2,a3,a4,a5);}},
+{"glDeleteOcclusionQueriesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteOcclusionQueriesNV(a0,a1);}},
+{"glVertex4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glVertex4hvNV(a0);}},
+{"glGetnTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnTexImage(a0,a1,a2,a3,a4,a5);}},
+{"glProgramLocalParameter4dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();auto const a5 = call.scalar<GLdouble>();table.glProgramLocalParameter4dARB(a0,a1,a2,a3,a4,a5);}},
+{"glBlendEquation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBlendEquation(a0);}},
+{"glUnlockArraysEXT",[](FunctionTable const&table,ReplayCall&){table.glUnlockArraysEXT();}},
+{"glGetQueryObjectui64vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64*>();table.glGetQueryObjectui64vEXT(a0,a1,a2);}},
+{"glVertexAttribI4uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI4uivEXT(a0,a1);}},
+{"glUniform1i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64EXT*>();table.glUniform1i64vNV(a0,a1,a2);}},
+{"glMultiTexCoord3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord3dv(a0,a1);}},
+{"glColor4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glColor4sv(a0);}},
+{"glVertexStream4ivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glVertexStream4ivATI(a0,a1);}},
+{"glPopClientAttrib",[](FunctionTable const&table,ReplayCall&){table.glPopClientAttrib();}},
+{"glClearBufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const void*>();table.glClearBufferData(a0,a1,a2,a3,a4);}},
+{"glGetProgramivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetProgramivNV(a0,a1,a2);}},
+{"glBeginTransformFeedback",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBeginTransformFeedback(a0);}},
+{"glFinishObjectAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glFinishObjectAPPLE(a0,a1);}},
+{"glGetMinmaxParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMinmaxParameterivEXT(a0,a1,a2);}},
+{"glColor3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glColor3iv(a0);}},
+{"glVertexAttrib3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib3sv(a0,a1);}},
+{"glCompressedTexImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<const GLvoid*>();table.glCompressedTexImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glDeleteTransformFeedbacks",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteTransformFeedbacks(a0,a1);}},
+{"glGetVideoi64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64EXT*>();table.glGetVideoi64vNV(a0,a1,a2);}},
+{"glDrawRangeElementsBaseVertex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();auto const a6 = call.scalar<GLint>();table.glDrawRangeElementsBaseVertex(a0,a1,a2,a3,a4,a5,a6);}},
+{"glUniform4i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint64*>();table.glUniform4i64vARB(a0,a1,a2);}},
+{"glTextureStorage3DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLboolean>();table.glTextureStorage3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetTexParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetTexParameterfv(a0,a1,a2);}},
+{"glProgramUniformui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64EXT*>();table.glProgramUniformui64vNV(a0,a1,a2,a3);}},
+{"glCompressedMultiTexImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const void*>();table.glCompressedMultiTexImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glProgramUniform2ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform2ivEXT(a0,a1,a2,a3);}},
+{"glPushGroupMarkerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLchar*>();table.glPushGroupMarkerEXT(a0,a1);}},
+{"glVertexAttrib1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib1dv(a0,a1);}},
+{"glMatrixLoadIdentityEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glMatrixLoadIdentityEXT(a0);}},
+{"glMultTransposeMatrixxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glMultTransposeMatrixxOES(a0);}},
+{"glGetPixelMapxv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLfixed*>();table.glGetPixelMapxv(a0,a1,a2);}},
+{"glFramebufferSampleLocationsfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glFramebufferSampleLocationsfvARB(a0,a1,a2,a3);}},
+{"glGetLightiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetLightiv(a0,a1,a2);}},
+{"glBlendFuncSeparatei",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();table.glBlendFuncSeparatei(a0,a1,a2,a3,a4);}},
+{"glAcquireKeyedMutexWin32EXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLuint>();table.glAcquireKeyedMutexWin32EXT(a0,a1,a2);}},
+{"glGetBooleanIndexedvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLboolean*>();table.glGetBooleanIndexedvEXT(a0,a1,a2);}},
+{"glGetProgramSubroutineParameteruivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLuint*>();table.glGetProgramSubroutineParameteruivNV(a0,a1,a2);}},
+{"glUniform2ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glUniform2ui(a0,a1,a2);}},
+{"glApplyFramebufferAttachmentCMAAINTEL",[](FunctionTable const&table,ReplayCall&){table.glApplyFramebufferAttachmentCMAAINTEL();}},
+{"glWindowPos2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos2fv(a0);}},
+{"glWaitVkSemaphoreNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();table.glWaitVkSemaphoreNV(a0);}},
+{"glDisablei",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDisablei(a0,a1);}},
+{"glSelectPerfMonitorCountersAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.pointer<GLuint*>();table.glSelectPerfMonitorCountersAMD(a0,a1,a2,a3,a4);}},
+{"glGetVertexAttribLi64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64EXT*>();table.glGetVertexAttribLi64vNV(a0,a1,a2);}},
+{"glBlendFuncSeparateiARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();table.glBlendFuncSeparateiARB(a0,a1,a2,a3,a4);}},
+{"glWeightuivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLuint*>();table.glWeightuivARB(a0,a1);}},
+{"glWindowPos2iARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glWindowPos2iARB(a0,a1);}},
+{"glGetProgramLocalParameterdvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLdouble*>();table.glGetProgramLocalParameterdvARB(a0,a1,a2);}},
+{"glGetUniformui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLuint64*>();table.glGetUniformui64vARB(a0,a1,a2);}},
+{"glSecondaryColor3us",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();auto const a1 = call.scalar<GLushort>();auto const a2 = call.scalar<GLushort>();table.glSecondaryColor3us(a0,a1,a2);}},
+{"glGetSynciv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.sync();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLint*>();table.glGetSynciv(a0,a1,a2,a3,a4);}},
+{"glMakeImageHandleResidentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint64>();auto const a1 = call.scalar<GLenum>();table.glMakeImageHandleResidentARB(a0,a1);}},
+{"glGetProgramNamedParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.pointer<GLfloat*>();table.glGetProgramNamedParameterfvNV(a0,a1,a2,a3);}},
+{"glTextureStorage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glTextureStorage3D(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttrib4svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib4svNV(a0,a1);}},
+{"glProgramUniform2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glProgramUniform2i(a0,a1,a2,a3);}},
+{"glListDrawCommandsStatesClientNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const void**>();auto const a3 = call.pointer<const GLsizei*>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.pointer<const GLuint*>();auto const a6 = call.scalar<GLuint>();table.glListDrawCommandsStatesClientNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glProgramLocalParametersI4uivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramLocalParametersI4uivNV(a0,a1,a2,a3);}},
+{"glBeginTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glBeginTransformFeedbackNV(a0);}},
+{"glGetProgramBinary",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLenum*>();auto const a4 = call.pointer<void*>();table.glGetProgramBinary(a0,a1,a2,a3,a4);}},
+{"glBinormal3iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glBinormal3iEXT(a0,a1,a2);}},
+{"glEvalPoint1",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glEvalPoint1(a0);}},
+{"glEvalPoint2",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glEvalPoint2(a0,a1);}},
+{"glPauseTransformFeedback",[](FunctionTable const&table,ReplayCall&){table.glPauseTransformFeedback();}},
+{"glWindowPos2sMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glWindowPos2sMESA(a0,a1);}},
+{"glGlobalAlphaFactorbSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();table.glGlobalAlphaFactorbSUN(a0);}},
+{"glCreateTransformFeedbacks",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateTransformFeedbacks(a0,a1);}},
+{"glTexturePageCommitmentEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLboolean>();table.glTexturePageCommitmentEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glTransformFeedbackVaryingsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();auto const a3 = call.scalar<GLenum>();table.glTransformFeedbackVaryingsNV(a0,a1,a2,a3);}},
+{"glTexSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const GLvoid*>();table.glTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glConvolutionParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glConvolutionParameterfvEXT(a0,a1,a2);}},
+{"glBlitFramebufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLbitfield>();auto const a9 = call.scalar<GLenum>();table.glBlitFramebufferEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glUniformMatrix4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix4fvARB(a0,a1,a2,a3);}},
+{"glProgramEnvParameter4dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLdouble*>();table.glProgramEnvParameter4dvARB(a0,a1,a2);}},
+{"glTextureStorageMem2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint64>();table.glTextureStorageMem2DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glVertexAttribP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLuint*>();table.glVertexAttribP3uiv(a0,a1,a2,a3);}},
+{"glFogCoordFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();table.glFogCoordFormatNV(a0,a1);}},
+{"glGetMultiTexLevelParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLint*>();table.glGetMultiTexLevelParameterivEXT(a0,a1,a2,a3,a4);}},
+{"glIsOcclusionQueryNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsOcclusionQueryNV(a0);}},
+{"glCompressedTexImage2DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const void*>();table.glCompressedTexImage2DARB(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetProgramEnvParameterIuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLuint*>();table.glGetProgramEnvParameterIuivNV(a0,a1,a2);}},
+{"glVertexAttrib4sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib4sv(a0,a1);}},
+{"glVertexAttrib4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib4fvARB(a0,a1);}},
+{"glLoadName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glLoadName(a0);}},
+{"glBindVertexShaderEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBindVertexShaderEXT(a0);}},
+{"glGetNamedProgramLocalParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLint*>();table.glGetNamedProgramLocalParameterIivEXT(a0,a1,a2,a3);}},
+{"glProgramUniform3uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glProgramUniform3uiEXT(a0,a1,a2,a3,a4);}},
+{"glProgramUniformMatrix4x2dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4x2dvEXT(a0,a1,a2,a3,a4);}},
+{"glTexCoord1hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glTexCoord1hvNV(a0);}},
+{"glLoadMatrixd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glLoadMatrixd(a0);}},
+{"glTexParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glTexParameterfv(a0,a1,a2);}},
+{"glVariantdvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVariantdvEXT(a0,a1);}},
+{"glCullParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glCullParameterfvEXT(a0,a1);}},
+{"glUniform3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glUniform3dv(a0,a1,a2);}},
+{"glProgramUniform3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform3fv(a0,a1,a2,a3);}},
+{"glIsBufferARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsBufferARB(a0);}},
+{"glMultiTexCoord1bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbyte>();table.glMultiTexCoord1bOES(a0,a1);}},
+{"glFogCoordhNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();table.glFogCoordhNV(a0);}},
+{"glFramebufferSampleLocationsfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glFramebufferSampleLocationsfvNV(a0,a1,a2,a3);}},
+{"glGenSymbolsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glGenSymbolsEXT(a0,a1,a2,a3);}},
+{"glGetConvolutionFilter",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLvoid*>();table.glGetConvolutionFilter(a0,a1,a2,a3);}},
+{"glProgramUniform1fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform1fvEXT(a0,a1,a2,a3);}},
+{"glGetNextPerfQueryIdINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLuint*>();table.glGetNextPerfQueryIdINTEL(a0,a1);}},
+{"glCompressedTexImage1DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<const void*>();table.glCompressedTexImage1DARB(a0,a1,a2,a3,a4,a5,a6);}},
+{"glBindSamplers",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glBindSamplers(a0,a1,a2);}},
+{"glGetProgramEnvParameterIivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLint*>();table.glGetProgramEnvParameterIivNV(a0,a1,a2);}},
+{"glGetQueryObjectui64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64*>();table.glGetQueryObjectui64v(a0,a1,a2);}},
+{"glVertexAttribL4ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint64EXT*>();table.glVertexAttribL4ui64vNV(a0,a1);}},
+{"glGetVideoivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVideoivNV(a0,a1,a2);}},
+{"glGetTextureImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetTextureImage(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniform1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramUniform1fv(a0,a1,a2,a3);}},
+{"glUniformMatrix4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix4fv(a0,a1,a2,a3);}},
+{"glColorMask",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLboolean>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLboolean>();table.glColorMask(a0,a1,a2,a3);}},
+{"glBeginFragmentShaderATI",[](FunctionTable const&table,ReplayCall&){table.glBeginFragmentShaderATI();}},
+{"glMultiDrawArraysEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.scalar<GLsizei>();table.glMultiDrawArraysEXT(a0,a1,a2,a3);}},
+{"glGenNamesAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<GLuint*>();table.glGenNamesAMD(a0,a1,a2);}},
+{"glPathParameteriNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glPathParameteriNV(a0,a1,a2);}},
+{"glCreateCommandListsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateCommandListsNV(a0,a1);}},
+{"glDeleteProgramPipelines",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteProgramPipelines(a0,a1);}},
+{"glCopyColorSubTableEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyColorSubTableEXT(a0,a1,a2,a3,a4);}},
+{"glVariantsvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVariantsvEXT(a0,a1);}},
+{"glGenProgramPipelines",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenProgramPipelines(a0,a1);}},
+{"glVertexArrayEdgeFlagOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLintptr>();table.glVertexArrayEdgeFlagOffsetEXT(a0,a1,a2,a3);}},
+{"glWindowPos2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glWindowPos2s(a0,a1);}},
+{"glSecondaryColor3iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glSecondaryColor3iEXT(a0,a1,a2);}},
+{"glWindowPos2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glWindowPos2i(a0,a1);}},
+{"glWindowPos2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glWindowPos2f(a0,a1);}},
+{"glWindowPos2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glWindowPos2d(a0,a1);}},
+{"glUniform4uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform4uivEXT(a0,a1,a2);}},
+{"glOrthoxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();auto const a4 = call.scalar<GLfixed>();auto const a5 = call.scalar<GLfixed>();table.glOrthoxOES(a0,a1,a2,a3,a4,a5);}},
+{"glUniformSubroutinesuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniformSubroutinesuiv(a0,a1,a2);}},
+{"glRectdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();auto const a1 = call.pointer<const GLdouble*>();table.glRectdv(a0,a1);}},
+{"glProgramUniform1i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64EXT*>();table.glProgramUniform1i64vNV(a0,a1,a2,a3);}},
+{"glVertexAttribI4uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glVertexAttribI4uiEXT(a0,a1,a2,a3,a4);}},
+{"glSecondaryColor3ubEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();table.glSecondaryColor3ubEXT(a0,a1,a2);}},
+{"glCompressedMultiTexSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.pointer<const void*>();table.glCompressedMultiTexSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glMultiTexGendEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLdouble>();table.glMultiTexGendEXT(a0,a1,a2,a3);}},
+{"glColorP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glColorP3uiv(a0,a1);}},
+{"glFogCoordfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glFogCoordfv(a0);}},
+{"glCompileShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glCompileShader(a0);}},
+{"glTexCoord2hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();table.glTexCoord2hNV(a0,a1);}},
+{"glUniform1uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform1uivEXT(a0,a1,a2);}},
+{"glMatrixLoadTransposedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMatrixLoadTransposedEXT(a0,a1);}},
+{"glIndexfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glIndexfv(a0);}},
+{"glGetCompressedTextureImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<void*>();table.glGetCompressedTextureImage(a0,a1,a2,a3);}},
+{"glGetUniformuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLuint*>();table.glGetUniformuivEXT(a0,a1,a2);}},
+{"glGetnPixelMapfvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLfloat*>();table.glGetnPixelMapfvARB(a0,a1,a2);}},
+{"glFramebufferTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();table.glFramebufferTextureEXT(a0,a1,a2,a3);}},
+{"glMultiDrawElementsIndirectCount",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glMultiDrawElementsIndirectCount(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttribIPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexAttribIPointer(a0,a1,a2,a3,a4);}},
+{"glMultiTexCoordP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();table.glMultiTexCoordP3ui(a0,a1,a2);}},
+{"glEvaluateDepthValuesARB",[](FunctionTable const&table,ReplayCall&){table.glEvaluateDepthValuesARB();}},
+{"glGetNamedBufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedBufferParameteriv(a0,a1,a2);}},
+{"glGetNamedProgramLocalParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLfloat*>();table.glGetNamedProgramLocalParameterfvEXT(a0,a1,a2,a3);}},
+{"glColor4fNormal3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();table.glColor4fNormal3fVertex3fvSUN(a0,a1,a2);}},
+{"glSeparableFilter2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const void*>();auto const a7 = call.pointer<const void*>();table.glSeparableFilter2DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glTexParameterxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glTexParameterxOES(a0,a1,a2);}},
+{"glClearAccumxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glClearAccumxOES(a0,a1,a2,a3);}},
+{"glInvalidateFramebuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLenum*>();table.glInvalidateFramebuffer(a0,a1,a2);}},
+{"glWeightubvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLubyte*>();table.glWeightubvARB(a0,a1);}},
+{"glVertexAttrib1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();table.glVertexAttrib1d(a0,a1);}},
+{"glVertexAttrib1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();table.glVertexAttrib1f(a0,a1);}},
+{"glVertex4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glVertex4fv(a0);}},
+{"glClearNamedFramebufferfi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLint>();table.glClearNamedFramebufferfi(a0,a1,a2,a3,a4);}},
+{"glGetQueryBufferObjectuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLintptr>();table.glGetQueryBufferObjectuiv(a0,a1,a2,a3);}},
+{"glClearNamedFramebufferfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<const GLfloat*>();table.glClearNamedFramebufferfv(a0,a1,a2,a3);}},
+{"glEndVertexShaderEXT",[](FunctionTable const&table,ReplayCall&){table.glEndVertexShaderEXT();}},
+{"glVertexAttrib1s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();table.glVertexAttrib1s(a0,a1);}},
+{"glMultiTexCoord4dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord4dvARB(a0,a1);}},
+{"glMultiTexCoord1sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord1sv(a0,a1);}},
+{"glUniform1ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64EXT*>();table.glUniform1ui64vNV(a0,a1,a2);}},
+{"glGetClipPlanefOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetClipPlanefOES(a0,a1);}},
+{"glRasterPos2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();table.glRasterPos2s(a0,a1);}},
+{"glWeightivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLint*>();table.glWeightivARB(a0,a1);}},
+{"glMultiTexCoord4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLhalfNV*>();table.glMultiTexCoord4hvNV(a0,a1);}},
+{"glNormal3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glNormal3hNV(a0,a1,a2);}},
+{"glGetSeparableFilter",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLvoid*>();auto const a4 = call.pointer<GLvoid*>();auto const a5 = call.pointer<GLvoid*>();table.glGetSeparableFilter(a0,a1,a2,a3,a4,a5);}},
+{"glGetPathTexGenivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetPathTexGenivNV(a0,a1,a2);}},
+{"glColor4bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glColor4bv(a0);}},
+{"glRasterPos2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glRasterPos2f(a0,a1);}},
+{"glNamedBufferPageCommitmentARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLboolean>();table.glNamedBufferPageCommitmentARB(a0,a1,a2,a3);}},
+{"glLoadIdentity",[](FunctionTable const&table,ReplayCall&){table.glLoadIdentity();}},
+{"glRasterPos2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glRasterPos2i(a0,a1);}},
+{"glRasterPos4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glRasterPos4iv(a0);}},
+{"glMultiTexCoord2fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord2fvARB(a0,a1);}},
+{"glUniformMatrix4x3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix4x3fv(a0,a1,a2,a3);}},
+{"glClearBufferfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const GLfloat*>();table.glClearBufferfv(a0,a1,a2);}},
+{"glMultiTexCoord4hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();auto const a4 = call.scalar<GLhalfNV>();table.glMultiTexCoord4hNV(a0,a1,a2,a3,a4);}},
+{"glTextureBarrier",[](FunctionTable const&table,ReplayCall&){table.glTextureBarrier();}},
+{"glReplacementCodeuivSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint*>();table.glReplacementCodeuivSUN(a0);}},
+{"glDeleteAsyncMarkersSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();table.glDeleteAsyncMarkersSGIX(a0,a1);}},
+{"glTexCoord2bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glTexCoord2bvOES(a0);}},
+{"glEvalCoord2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glEvalCoord2xOES(a0,a1);}},
+{"glGetSharpenTexFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetSharpenTexFuncSGIS(a0,a1);}},
+{"glProgramUniformHandleui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniformHandleui64vNV(a0,a1,a2,a3);}},
+{"glIglooInterfaceSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();table.glIglooInterfaceSGIX(a0,a1);}},
+{"glWindowPos2dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos2dvARB(a0);}},
+{"glClearBufferfi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLint>();table.glClearBufferfi(a0,a1,a2,a3);}},
+{"glDrawArraysIndirect",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();table.glDrawArraysIndirect(a0,a1);}},
+{"glGenVertexArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenVertexArrays(a0,a1);}},
+{"glGetTransformFeedbacki64_v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLint64*>();table.glGetTransformFeedbacki64_v(a0,a1,a2,a3);}},
+{"glEnableVertexArrayAttrib",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glEnableVertexArrayAttrib(a0,a1);}},
+{"glProgramUniformMatrix3x2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix3x2dv(a0,a1,a2,a3,a4);}},
+{"glVertexStream4fATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glVertexStream4fATI(a0,a1,a2,a3,a4);}},
+{"glVertexBindingDivisor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexBindingDivisor(a0,a1);}},
+{"glGetSamplerParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetSamplerParameterIiv(a0,a1,a2);}},
+{"glGetCoverageModulationTableNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLfloat*>();table.glGetCoverageModulationTableNV(a0,a1);}},
+{"glDepthRangedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glDepthRangedNV(a0,a1);}},
+{"glVertexAttrib3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glVertexAttrib3f(a0,a1,a2,a3);}},
+{"glMultiDrawRangeElementArrayAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLint*>();auto const a4 = call.pointer<const GLsizei*>();auto const a5 = call.scalar<GLsizei>();table.glMultiDrawRangeElementArrayAPPLE(a0,a1,a2,a3,a4,a5);}},
+{"glVertexAttribFormatNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLsizei>();table.glVertexAttribFormatNV(a0,a1,a2,a3,a4);}},
+{"glGetQueryBufferObjecti64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLintptr>();table.glGetQueryBufferObjecti64v(a0,a1,a2,a3);}},
+{"glGetVertexAttribdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLdouble*>();table.glGetVertexAttribdv(a0,a1,a2);}},
+{"glGetUniformi64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<GLint64*>();table.glGetUniformi64vARB(a0,a1,a2);}},
+{"glAreTexturesResidentEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();auto const a2 = call.pointer<GLboolean*>();table.glAreTexturesResidentEXT(a0,a1,a2);}},
+{"glGetHandleARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glGetHandleARB(a0);}},
+{"glVideoCaptureStreamParameterdvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLdouble*>();table.glVideoCaptureStreamParameterdvNV(a0,a1,a2,a3);}},
+{"glMapParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glMapParameterivNV(a0,a1,a2);}},
+{"glIsVertexArray",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsVertexArray(a0);}},
+{"glSecondaryColor3sEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glSecondaryColor3sEXT(a0,a1,a2);}},
+{"glGetTexParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTexParameterIivEXT(a0,a1,a2);}},
+{"glFrameTerminatorGREMEDY",[](FunctionTable const&table,ReplayCall&){table.glFrameTerminatorGREMEDY();}},
+{"glBlendBarrierKHR",[](FunctionTable const&table,ReplayCall&){table.glBlendBarrierKHR();}},
+{"glVertexAttrib4NubARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLubyte>();table.glVertexAttrib4NubARB(a0,a1,a2,a3,a4);}},
+{"glPrimitiveRestartNV",[](FunctionTable const&table,ReplayCall&){table.glPrimitiveRestartNV();}},
+{"glVertexAttribL1ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint64EXT*>();table.glVertexAttribL1ui64vARB(a0,a1);}},
+{"glVertexAttribI4ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI4ivEXT(a0,a1);}},
+{"glVertexAttribs4svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLshort*>();table.glVertexAttribs4svNV(a0,a1,a2);}},
+{"glUniform1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();table.glUniform1ui(a0,a1);}},
+{"glVertexAttrib2fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib2fvARB(a0,a1);}},
+{"glVertexAttribI4svEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttribI4svEXT(a0,a1);}},
+{"glTextureImage3DMultisampleCoverageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLboolean>();table.glTextureImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glMemoryBarrier",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glMemoryBarrier(a0);}},
+{"glGetVariantArrayObjectfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetVariantArrayObjectfvATI(a0,a1,a2);}},
+{"glTexCoord4fColor4fNormal3fVertex4fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();auto const a2 = call.pointer<const GLfloat*>();auto const a3 = call.pointer<const GLfloat*>();table.glTexCoord4fColor4fNormal3fVertex4fvSUN(a0,a1,a2,a3);}},
+{"glIsProgramARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsProgramARB(a0);}},
+{"glBindImageTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLint>();table.glBindImageTextureEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetFragDataLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetFragDataLocation(a0,a1);}},
+{"glMultiTexCoord1svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord1svARB(a0,a1);}},
+{"glGetMapxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetMapxvOES(a0,a1,a2);}},
+{"glTextureStorage2DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTextureStorage2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetMaterialfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetMaterialfv(a0,a1,a2);}},
+{"glVertexAttrib4NbvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttrib4NbvARB(a0,a1);}},
+{"glPixelMapuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glPixelMapuiv(a0,a1,a2);}},
+{"glColorPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glColorPointerEXT(a0,a1,a2,a3,a4);}},
+{"glEnableClientStateiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glEnableClientStateiEXT(a0,a1);}},
+{"glClearTexSubImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glClearTexSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glEvalCoord1xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glEvalCoord1xvOES(a0);}},
+{"glDetachObjectARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLhandleARB>();table.glDetachObjectARB(a0,a1);}},
+{"glGetTextureParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTextureParameterIiv(a0,a1,a2);}},
+{"glVariantusvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVariantusvEXT(a0,a1);}},
+{"glCompressedTextureImage3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.pointer<const void*>();table.glCompressedTextureImage3DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glMultiTexCoord1dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();table.glMultiTexCoord1dARB(a0,a1);}},
+{"glGetVertexArrayIntegeri_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetVertexArrayIntegeri_vEXT(a0,a1,a2,a3);}},
+{"glVertexAttribI4ubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLubyte*>();table.glVertexAttribI4ubv(a0,a1);}},
+{"glPixelTexGenParameterfSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();table.glPixelTexGenParameterfSGIS(a0,a1);}},
+{"glProgramUniformMatrix4x2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix4x2dv(a0,a1,a2,a3,a4);}},
+{"glUniform3fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glUniform3fARB(a0,a1,a2,a3);}},
+{"glIsShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsShader(a0);}},
+{"glConvolutionParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glConvolutionParameteriv(a0,a1,a2);}},
+{"glCopyMultiTexSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();table.glCopyMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glEnableVertexAttribArrayARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEnableVertexAttribArrayARB(a0);}},
+{"glMulticastCopyBufferSubDataNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLintptr>();auto const a5 = call.scalar<GLintptr>();auto const a6 = call.scalar<GLsizeiptr>();table.glMulticastCopyBufferSubDataNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glEnable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glEnable(a0);}},
+{"glGetActiveUniformsiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLint*>();table.glGetActiveUniformsiv(a0,a1,a2,a3,a4);}},
+{"glGetVertexAttribivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribivARB(a0,a1,a2);}},
+{"glTexCoord4hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glTexCoord4hvNV(a0);}},
+{"glUseProgramObjectARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();table.glUseProgramObjectARB(a0);}},
+{"glGetAttribLocation",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetAttribLocation(a0,a1);}},
+{"glVertexAttrib4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib4dv(a0,a1);}},
+{"glGetTextureParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTextureParameteriv(a0,a1,a2);}},
+{"glNamedBufferStorageMemEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint64>();table.glNamedBufferStorageMemEXT(a0,a1,a2,a3);}},
+{"glPathSubCoordsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<const void*>();table.glPathSubCoordsNV(a0,a1,a2,a3,a4);}},
+{"glMatrixIndexusvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLushort*>();table.glMatrixIndexusvARB(a0,a1);}},
+{"glGetVideouivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetVideouivNV(a0,a1,a2);}},
+{"glGetVideoCaptureivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVideoCaptureivNV(a0,a1,a2);}},
+{"glProgramUniform3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();table.glProgramUniform3ui(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib3svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib3svARB(a0,a1);}},
+{"glGetNamedBufferParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedBufferParameterivEXT(a0,a1,a2);}},
+{"glMatrixScaledEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glMatrixScaledEXT(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix2x3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2x3fv(a0,a1,a2,a3,a4);}},
+{"glGetFragmentLightivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetFragmentLightivSGIX(a0,a1,a2);}},
+{"glGetStringi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glGetStringi(a0,a1);}},
+{"glWindowPos2svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos2svARB(a0);}},
+{"glVertexAttrib2svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib2svNV(a0,a1);}},
+{"glWindowPos2ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glWindowPos2ivARB(a0);}},
+{"glGetVertexAttribPointervNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetVertexAttribPointervNV(a0,a1,a2);}},
+{"glPushMatrix",[](FunctionTable const&table,ReplayCall&){table.glPushMatrix();}},
+{"glEdgeFlagPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLboolean**>();auto const a2 = call.scalar<GLint>();table.glEdgeFlagPointerListIBM(a0,a1,a2);}},
+{"glGenerateMipmapEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glGenerateMipmapEXT(a0);}},
+{"glWindowPos3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos3sv(a0);}},
+{"glPathCoordsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();table.glPathCoordsNV(a0,a1,a2,a3);}},
+{"glProgramUniform1i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glProgramUniform1i(a0,a1,a2);}},
+{"glProgramUniform1d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLdouble>();table.glProgramUniform1d(a0,a1,a2);}},
+{"glProgramUniform1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();table.glProgramUniform1f(a0,a1,a2);}},
+{"glProgramParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glProgramParameteriEXT(a0,a1,a2);}},
+{"glCompressedMultiTexImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const void*>();table.glCompressedMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glProgramUniform3iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();table.glProgramUniform3iv(a0,a1,a2,a3);}},
+{"glIndexiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLint*>();table.glIndexiv(a0);}},
+{"glMultiTexCoord4xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glMultiTexCoord4xvOES(a0,a1);}},
+{"glEGLImageTargetTexture2DOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLeglImageOES>();table.glEGLImageTargetTexture2DOES(a0,a1);}},
+{"glPixelZoom",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glPixelZoom(a0,a1);}},
+{"glVertex3bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glVertex3bvOES(a0);}},
+{"glFramebufferReadBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glFramebufferReadBufferEXT(a0,a1);}},
+{"glExtractComponentEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glExtractComponentEXT(a0,a1,a2);}},
+{"glCombinerParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glCombinerParameterivNV(a0,a1);}},
+{"glMinmax",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();table.glMinmax(a0,a1,a2);}},
+{"glColorP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glColorP3ui(a0,a1);}},
+{"glPointParameterfvSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPointParameterfvSGIS(a0,a1);}},
+{"glBlendEquationi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glBlendEquationi(a0,a1);}},
+{"glGetFogFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLfloat*>();table.glGetFogFuncSGIS(a0);}},
+{"glVertexAttrib4fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib4fvNV(a0,a1);}},
+{"glGetnMinmax",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<void*>();table.glGetnMinmax(a0,a1,a2,a3,a4,a5);}},
+{"glFragmentLightiSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glFragmentLightiSGIX(a0,a1,a2);}},
+{"glMultiTexCoord1bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLbyte*>();table.glMultiTexCoord1bvOES(a0,a1);}},
+{"glSecondaryColorPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glSecondaryColorPointerEXT(a0,a1,a2,a3);}},
+{"glMultiTexCoordP4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glMultiTexCoordP4uiv(a0,a1,a2);}},
+{"glGetBufferSubDataARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptrARB>();auto const a2 = call.scalar<GLsizeiptrARB>();auto const a3 = call.pointer<void*>();table.glGetBufferSubDataARB(a0,a1,a2,a3);}},
+{"glSecondaryColor3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();table.glSecondaryColor3hNV(a0,a1,a2);}},
+{"glGetPathParameterivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetPathParameterivNV(a0,a1,a2);}},
+{"glFlushRasterSGIX",[](FunctionTable const&table,ReplayCall&){table.glFlushRasterSGIX();}},
+{"glElementPointerATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();table.glElementPointerATI(a0,a1);}},
+{"glGetAttachedObjectsARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLhandleARB*>();table.glGetAttachedObjectsARB(a0,a1,a2,a3);}},
+{"glUniform4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform4iv(a0,a1,a2);}},
+{"glFogxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glFogxOES(a0,a1);}},
+{"glSharpenTexFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glSharpenTexFuncSGIS(a0,a1,a2);}},
+{"glClearDepthfOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();table.glClearDepthfOES(a0);}},
+{"glDeleteCommandListsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteCommandListsNV(a0,a1);}},
+{"glSpecializeShader",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.pointer<const GLuint*>();table.glSpecializeShader(a0,a1,a2,a3,a4);}},
+{"glVertex4hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhalfNV>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();table.glVertex4hNV(a0,a1,a2,a3);}},
+{"glSecondaryColor3dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glSecondaryColor3dvEXT(a0);}},
+{"glGenTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenTextures(a0,a1);}},
+{"glTextureStorage2DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();table.glTextureStorage2DMultisample(a0,a1,a2,a3,a4,a5);}},
+{"glUniform3ui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64EXT*>();table.glUniform3ui64vNV(a0,a1,a2);}},
+{"glBlendFuncSeparateIndexedAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();table.glBlendFuncSeparateIndexedAMD(a0,a1,a2,a3,a4);}},
+{"glMakeBufferResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glMakeBufferResidentNV(a0,a1);}},
+{"glShaderOp2EXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glShaderOp2EXT(a0,a1,a2,a3);}},
+{"glGetVertexAttribivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribivNV(a0,a1,a2);}},
+{"glTexParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTexParameterIivEXT(a0,a1,a2);}},
+{"glGetPerfQueryDataINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLvoid*>();auto const a4 = call.pointer<GLuint*>();table.glGetPerfQueryDataINTEL(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib4dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib4dvARB(a0,a1);}},
+{"glTextureSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const void*>();table.glTextureSubImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetActiveUniformBlockName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLchar*>();table.glGetActiveUniformBlockName(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib2dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib2dvARB(a0,a1);}},
+{"glVertexAttribPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<const void*>();table.glVertexAttribPointer(a0,a1,a2,a3,a4,a5);}},
+{"glDepthBoundsdNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();table.glDepthBoundsdNV(a0,a1);}},
+{"glDeleteTexturesEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteTexturesEXT(a0,a1);}},
+{"glDrawBuffersATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLenum*>();table.glDrawBuffersATI(a0,a1);}},
+{"glLightModelxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfixed*>();table.glLightModelxvOES(a0,a1);}},
+{"glApplyTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glApplyTextureEXT(a0);}},
+{"glGetImageHandleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();table.glGetImageHandleNV(a0,a1,a2,a3,a4);}},
+{"glGetMinmax",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLboolean>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.pointer<GLvoid*>();table.glGetMinmax(a0,a1,a2,a3,a4);}},
+{"glGetFixedvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfixed*>();table.glGetFixedvOES(a0,a1);}},
+{"glSamplePatternEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glSamplePatternEXT(a0);}},
+{"glUniform1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();table.glUniform1f(a0,a1);}},
+{"glColor4fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();table.glColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glFogCoorddvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glFogCoorddvEXT(a0);}},
+{"glCopyTextureImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLint>();table.glCopyTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glFlushMappedBufferRangeAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();table.glFlushMappedBufferRangeAPPLE(a0,a1,a2);}},
+{"glVertex3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glVertex3sv(a0);}},
+{"glFlushStaticDataIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glFlushStaticDataIBM(a0);}},
+{"glProgramUniform4ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();auto const a4 = call.scalar<GLuint64EXT>();auto const a5 = call.scalar<GLuint64EXT>();table.glProgramUniform4ui64NV(a0,a1,a2,a3,a4,a5);}},
+{"glRasterPos4xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glRasterPos4xOES(a0,a1,a2,a3);}},
+{"glVertexAttribP1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLuint>();table.glVertexAttribP1ui(a0,a1,a2,a3);}},
+{"glProgramUniform4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform4dvEXT(a0,a1,a2,a3);}},
+{"glEndTransformFeedbackEXT",[](FunctionTable const&table,ReplayCall&){table.glEndTransformFeedbackEXT();}},
+{"glBinormal3dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glBinormal3dEXT(a0,a1,a2);}},
+{"glGetTextureSubImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLsizei>();auto const a11 = call.pointer<void*>();table.glGetTextureSubImage(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glGetNamedRenderbufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedRenderbufferParameteriv(a0,a1,a2);}},
+{"glBindBuffersRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.pointer<const GLintptr*>();auto const a5 = call.pointer<const GLsizeiptr*>();table.glBindBuffersRange(a0,a1,a2,a3,a4,a5);}},
+{"glFinishAsyncSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLuint*>();table.glFinishAsyncSGIX(a0);}},
+{"glBindFragDataLocationIndexed",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLchar*>();table.glBindFragDataLocationIndexed(a0,a1,a2,a3);}},
+{"glMultiTexCoord2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord2dv(a0,a1);}},
+{"glUniform2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform2iv(a0,a1,a2);}},
+{"glProgramUniform2i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64EXT*>();table.glProgramUniform2i64vNV(a0,a1,a2,a3);}},
+{"glFlushVertexArrayRangeAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<void*>();table.glFlushVertexArrayRangeAPPLE(a0,a1);}},
+{"glTextureParameterf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glTextureParameterf(a0,a1,a2);}},
+{"glMultiTexCoord3dvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord3dvARB(a0,a1);}},
+{"glFeedbackBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glFeedbackBuffer(a0,a1,a2);}},
+{"glDebugMessageInsertARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<const GLchar*>();table.glDebugMessageInsertARB(a0,a1,a2,a3,a4,a5);}},
+{"glMultiTexCoord2i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glMultiTexCoord2i(a0,a1,a2);}},
+{"glTextureSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.pointer<const void*>();table.glTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glFramebufferTexture1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glFramebufferTexture1D(a0,a1,a2,a3,a4);}},
+{"glGetShaderiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetShaderiv(a0,a1,a2);}},
+{"glMultiTexCoord2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glMultiTexCoord2d(a0,a1,a2);}},
+{"glArrayObjectATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glArrayObjectATI(a0,a1,a2,a3,a4,a5);}},
+{"glGetPointeri_vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<void**>();table.glGetPointeri_vEXT(a0,a1,a2);}},
+{"glGetPerfMonitorCountersAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLint*>();auto const a2 = call.pointer<GLint*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLuint*>();table.glGetPerfMonitorCountersAMD(a0,a1,a2,a3,a4);}},
+{"glNamedBufferStorage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLbitfield>();table.glNamedBufferStorage(a0,a1,a2,a3);}},
+{"glTexEnvxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfixed*>();table.glTexEnvxvOES(a0,a1,a2);}},
+{"glProgramUniform2ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();table.glProgramUniform2ui64NV(a0,a1,a2,a3);}},
+{"glMultiTexCoord3bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();table.glMultiTexCoord3bOES(a0,a1,a2,a3);}},
+{"glUniform1dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glUniform1dv(a0,a1,a2);}},
+{"glPixelTransferi",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();table.glPixelTransferi(a0,a1);}},
+{"glSecondaryColor3usvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLushort*>();table.glSecondaryColor3usvEXT(a0);}},
+{"glProgramEnvParameterI4uivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLuint*>();table.glProgramEnvParameterI4uivNV(a0,a1,a2);}},
+{"glVertex2sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glVertex2sv(a0);}},
+{"glWindowPos4dMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glWindowPos4dMESA(a0,a1,a2,a3);}},
+{"glDebugMessageControlARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLuint*>();auto const a5 = call.scalar<GLboolean>();table.glDebugMessageControlARB(a0,a1,a2,a3,a4,a5);}},
+{"glIsTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsTextureEXT(a0);}},
+{"glFragmentMaterialivSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glFragmentMaterialivSGIX(a0,a1,a2);}},
+{"glLinkProgramARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();table.glLinkProgramARB(a0);}},
+{"glFinishFenceAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glFinishFenceAPPLE(a0);}},
+{"glVertexArrayVertexAttribBindingEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexArrayVertexAttribBindingEXT(a0,a1,a2);}},
+{"glTexStorageMem3DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLuint64>();table.glTexStorageMem3DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glUniform1ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniform1ui64vARB(a0,a1,a2);}},
+{"glMultiTexCoord4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord4fv(a0,a1);}},
+{"glMulticastFramebufferSampleLocationsfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLfloat*>();table.glMulticastFramebufferSampleLocationsfvNV(a0,a1,a2,a3,a4);}},
+{"glRasterPos3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glRasterPos3d(a0,a1,a2);}},
+{"glPollAsyncSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<GLuint*>();table.glPollAsyncSGIX(a0);}},
+{"glRasterPos3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glRasterPos3f(a0,a1,a2);}},
+{"glCompressedTexImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const GLvoid*>();table.glCompressedTexImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glVariantivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVariantivEXT(a0,a1);}},
+{"glUnmapTexture2DINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glUnmapTexture2DINTEL(a0,a1);}},
+{"glMulticastWaitSyncNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();table.glMulticastWaitSyncNV(a0,a1);}},
+{"glGetVertexAttribiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVertexAttribiv(a0,a1,a2);}},
+{"glGetPathCoordsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<GLfloat*>();table.glGetPathCoordsNV(a0,a1);}},
+{"glColor4xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glColor4xvOES(a0);}},
+{"glVertexAttrib3fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib3fv(a0,a1);}},
+{"glRasterPos3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glRasterPos3s(a0,a1,a2);}},
+{"glVertex4bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();table.glVertex4bOES(a0,a1,a2,a3);}},
+{"glTransformFeedbackVaryingsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();auto const a3 = call.scalar<GLenum>();table.glTransformFeedbackVaryingsEXT(a0,a1,a2,a3);}},
+{"glCombinerOutputNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLboolean>();auto const a8 = call.scalar<GLboolean>();auto const a9 = call.scalar<GLboolean>();table.glCombinerOutputNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glWindowPos4sMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glWindowPos4sMESA(a0,a1,a2,a3);}},
+{"glVertexAttrib4svARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib4svARB(a0,a1);}},
+{"glIsList",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsList(a0);}},
+{"glGetInfoLogARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLcharARB*>();table.glGetInfoLogARB(a0,a1,a2,a3);}},
+{"glUniformMatrix2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix2fv(a0,a1,a2,a3);}},
+{"glVertexAttribs3dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glVertexAttribs3dvNV(a0,a1,a2);}},
+{"glGlobalAlphaFactorsSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();table.glGlobalAlphaFactorsSUN(a0);}},
+{"glGetTrackMatrixivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetTrackMatrixivNV(a0,a1,a2,a3);}},
+{"glTextureParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glTextureParameterfvEXT(a0,a1,a2,a3);}},
+{"glIsNamedBufferResidentNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsNamedBufferResidentNV(a0);}},
+{"glProgramUniform4ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint64*>();table.glProgramUniform4ui64vARB(a0,a1,a2,a3);}},
+{"glTbufferMask3DFX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glTbufferMask3DFX(a0);}},
+{"glCoverFillPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glCoverFillPathNV(a0,a1);}},
+{"glVertexAttrib1fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexAttrib1fvARB(a0,a1);}},
+{"glGenerateTextureMipmap",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGenerateTextureMipmap(a0);}},
+{"glNamedProgramLocalParameterI4uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLuint*>();table.glNamedProgramLocalParameterI4uivEXT(a0,a1,a2,a3);}},
+{"glMultiDrawElementsBaseVertex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLsizei*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*const*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<const GLint*>();table.glMultiDrawElementsBaseVertex(a0,a1,a2,a3,a4,a5);}},
+{"glProgramSubroutineParametersuivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glProgramSubroutineParametersuivNV(a0,a1,a2);}},
+{"glProgramUniformMatrix2x4dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLdouble*>();table.glProgramUniformMatrix2x4dvEXT(a0,a1,a2,a3,a4);}},
+{"glRotatexOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glRotatexOES(a0,a1,a2,a3);}},
+{"glMemoryBarrierEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glMemoryBarrierEXT(a0);}},
+{"glVertexAttrib3svNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib3svNV(a0,a1);}},
+{"glVertexStream3iATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();table.glVertexStream3iATI(a0,a1,a2,a3);}},
+{"glCompressedTexSubImage1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<const GLvoid*>();table.glCompressedTexSubImage1D(a0,a1,a2,a3,a4,a5,a6);}},
+{"glSetFenceNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glSetFenceNV(a0,a1);}},
+{"glAttachObjectARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLhandleARB>();table.glAttachObjectARB(a0,a1);}},
+{"glCopyConvolutionFilter1D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyConvolutionFilter1D(a0,a1,a2,a3,a4);}},
+{"glTexStorageMem2DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint64>();table.glTexStorageMem2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glProgramParameters4fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramParameters4fvNV(a0,a1,a2,a3);}},
+{"glNamedFramebufferParameteriEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glNamedFramebufferParameteriEXT(a0,a1,a2);}},
+{"glVertexAttrib4Nsv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLshort*>();table.glVertexAttrib4Nsv(a0,a1);}},
+{"glVertexAttribI4usvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLushort*>();table.glVertexAttribI4usvEXT(a0,a1);}},
+{"glTextureBufferRangeEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLintptr>();auto const a5 = call.scalar<GLsizeiptr>();table.glTextureBufferRangeEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertexP3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glVertexP3uiv(a0,a1);}},
+{"glIsPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsPathNV(a0);}},
+{"glGetnUniformi64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLint64*>();table.glGetnUniformi64vARB(a0,a1,a2,a3);}},
+{"glFramebufferTextureMultiviewOVR",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();table.glFramebufferTextureMultiviewOVR(a0,a1,a2,a3,a4,a5);}},
+{"glCompressedMultiTexSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.pointer<const void*>();table.glCompressedMultiTexSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glGetnMapdv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLdouble*>();table.glGetnMapdv(a0,a1,a2,a3);}},
+{"glDebugMessageCallback",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.null<GLDEBUGPROC>();auto const a1 = call.pointer<const void*>();table.glDebugMessageCallback(a0,a1);}},
+{"glTangent3svEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glTangent3svEXT(a0);}},
+{"glVertexAttribParameteriAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();table.glVertexAttribParameteriAMD(a0,a1,a2);}},
+{"glBufferSubDataARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptrARB>();auto const a2 = call.scalar<GLsizeiptrARB>();auto const a3 = call.pointer<const void*>();table.glBufferSubDataARB(a0,a1,a2,a3);}},
+{"glGetVertexAttribLui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetVertexAttribLui64vARB(a0,a1,a2);}},
+{"glVertexAttribL4ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();auto const a4 = call.scalar<GLuint64EXT>();table.glVertexAttribL4ui64NV(a0,a1,a2,a3,a4);}},
+{"glReplacementCodeuiColor4ubVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();auto const a3 = call.scalar<GLubyte>();auto const a4 = call.scalar<GLubyte>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();table.glReplacementCodeuiColor4ubVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glImageTransformParameterfHP",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glImageTransformParameterfHP(a0,a1,a2);}},
+{"glMap1f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.pointer<const GLfloat*>();table.glMap1f(a0,a1,a2,a3,a4,a5);}},
+{"glRasterPos4fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glRasterPos4fv(a0);}},
+{"glVertex2bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLbyte*>();table.glVertex2bvOES(a0);}},
+{"glGetMapControlPointsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();auto const a6 = call.pointer<void*>();table.glGetMapControlPointsNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glNamedProgramLocalParametersI4ivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLint*>();table.glNamedProgramLocalParametersI4ivEXT(a0,a1,a2,a3,a4);}},
+{"glBindBufferRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glBindBufferRangeNV(a0,a1,a2,a3,a4);}},
+{"glVertexStream3dvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexStream3dvATI(a0,a1);}},
+{"glNormalPointerListIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.pointer<const void**>();auto const a3 = call.scalar<GLint>();table.glNormalPointerListIBM(a0,a1,a2,a3);}},
+{"glFogFuncSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLfloat*>();table.glFogFuncSGIS(a0,a1);}},
+{"glMultiModeDrawArraysIBM",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLenum*>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.pointer<const GLsizei*>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();table.glMultiModeDrawArraysIBM(a0,a1,a2,a3,a4);}},
+{"glGetNamedFramebufferAttachmentParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetNamedFramebufferAttachmentParameterivEXT(a0,a1,a2,a3);}},
+{"glGetFloatv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLfloat*>();table.glGetFloatv(a0,a1);}},
+{"glVertexArrayVertexAttribIFormatEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();table.glVertexArrayVertexAttribIFormatEXT(a0,a1,a2,a3,a4);}},
+{"glHint",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glHint(a0,a1);}},
+{"glVertexStream2svATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glVertexStream2svATI(a0,a1);}},
+{"glMultiDrawArraysIndirect",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glMultiDrawArraysIndirect(a0,a1,a2,a3);}},
+{"glMultiTexEnvfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glMultiTexEnvfvEXT(a0,a1,a2,a3);}},
+{"glVertexAttribP2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLuint*>();table.glVertexAttribP2uiv(a0,a1,a2,a3);}},
+{"glProgramUniform1i64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64*>();table.glProgramUniform1i64vARB(a0,a1,a2,a3);}},
+{"glFramebufferTextureARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();table.glFramebufferTextureARB(a0,a1,a2,a3);}},
+{"glPushClientAttribDefaultEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glPushClientAttribDefaultEXT(a0);}},
+{"glScalef",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glScalef(a0,a1,a2);}},
+{"glScaled",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glScaled(a0,a1,a2);}},
+{"glGetConvolutionParameterxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetConvolutionParameterxvOES(a0,a1,a2);}},
+{"glGetProgramResourceName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLchar*>();table.glGetProgramResourceName(a0,a1,a2,a3,a4,a5);}},
+{"glCopyColorTable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyColorTable(a0,a1,a2,a3,a4);}},
+{"glDepthRangeArrayv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLdouble*>();table.glDepthRangeArrayv(a0,a1,a2);}},
+{"glCoverFillPathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.pointer<const GLfloat*>();table.glCoverFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6);}},
+{"glMultiTexParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glMultiTexParameterivEXT(a0,a1,a2,a3);}},
+{"glGetActiveAtomicCounterBufferiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetActiveAtomicCounterBufferiv(a0,a1,a2,a3);}},
+{"glStencilOpSeparate",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();table.glStencilOpSeparate(a0,a1,a2,a3);}},
+{"glVertexAttrib4fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glVertexAttrib4fNV(a0,a1,a2,a3,a4);}},
+{"glGetColorTableParameterivSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetColorTableParameterivSGI(a0,a1,a2);}},
+{"glVertexArrayAttribBinding",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexArrayAttribBinding(a0,a1,a2);}},
+{"glIsSemaphoreEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsSemaphoreEXT(a0);}},
+{"glProgramParameters4dvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramParameters4dvNV(a0,a1,a2,a3);}},
+{"glVertexAttribL4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttribL4dv(a0,a1);}},
+{"glGetTexParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTexParameteriv(a0,a1,a2);}},
+{"glGetUniformOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glGetUniformOffsetEXT(a0,a1);}},
+{"glGetVertexAttribPointerv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetVertexAttribPointerv(a0,a1,a2);}},
+{"glResumeTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&){table.glResumeTransformFeedbackNV();}},
+{"glProgramUniform3i64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint64EXT*>();table.glProgramUniform3i64vNV(a0,a1,a2,a3);}},
+{"glTangent3fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glTangent3fEXT(a0,a1,a2);}},
+{"glGetPathMetricRangeNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<GLfloat*>();table.glGetPathMetricRangeNV(a0,a1,a2,a3,a4);}},
+{"glWindowPos2iMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();table.glWindowPos2iMESA(a0,a1);}},
+{"glVertex2xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glVertex2xvOES(a0);}},
+{"glGetnCompressedTexImage",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<void*>();table.glGetnCompressedTexImage(a0,a1,a2,a3);}},
+{"glWindowPos2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos2dv(a0);}},
+{"glReplacementCodeuiVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glReplacementCodeuiVertex3fSUN(a0,a1,a2,a3);}},
+{"glGetTransformFeedbackVaryingEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLsizei*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLchar*>();table.glGetTransformFeedbackVaryingEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glWindowPos3fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glWindowPos3fARB(a0,a1,a2);}},
+{"glMapNamedBufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glMapNamedBufferEXT(a0,a1);}},
+{"glDisable",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glDisable(a0);}},
+{"glIsPointInFillPathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glIsPointInFillPathNV(a0,a1,a2,a3);}},
+{"glVertexAttribI2uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glVertexAttribI2uiEXT(a0,a1,a2);}},
+{"glProgramUniform4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLuint*>();table.glProgramUniform4uiv(a0,a1,a2,a3);}},
+{"glQueryCounter",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glQueryCounter(a0,a1);}},
+{"glFramebufferRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();table.glFramebufferRenderbufferEXT(a0,a1,a2,a3);}},
+{"glBinormal3svEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glBinormal3svEXT(a0);}},
+{"glBindBufferOffsetNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLintptr>();table.glBindBufferOffsetNV(a0,a1,a2,a3);}},
+{"glCopyTextureSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();table.glCopyTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetProgramResourcefvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLenum*>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.pointer<GLsizei*>();auto const a7 = call.pointer<GLfloat*>();table.glGetProgramResourcefvNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glBinormalPointerEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const void*>();table.glBinormalPointerEXT(a0,a1,a2);}},
+{"glGetLightfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetLightfv(a0,a1,a2);}},
+{"glMulticastCopyImageSubDataNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLbitfield>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLuint>();auto const a9 = call.scalar<GLenum>();auto const a10 = call.scalar<GLint>();auto const a11 = call.scalar<GLint>();auto const a12 = call.scalar<GLint>();auto const a13 = call.scalar<GLint>();auto const a14 = call.scalar<GLsizei>();auto const a15 = call.scalar<GLsizei>();auto const a16 = call.scalar<GLsizei>();table.glMulticastCopyImageSubDataNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12,a13,a14,a15,a16);}},
+{"glVertex2bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();table.glVertex2bOES(a0,a1);}},
+{"glUniform2ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform2ivARB(a0,a1,a2);}},
+{"glMultiTexCoord3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glMultiTexCoord3s(a0,a1,a2,a3);}},
+{"glGetHistogramParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetHistogramParameterfvEXT(a0,a1,a2);}},
+{"glGetProgramStringNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLubyte*>();table.glGetProgramStringNV(a0,a1,a2);}},
+{"glGetTexGenxvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfixed*>();table.glGetTexGenxvOES(a0,a1,a2);}},
+{"glTextureSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const void*>();table.glTextureSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glObjectPurgeableAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();table.glObjectPurgeableAPPLE(a0,a1,a2);}},
+{"glColorTableSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.pointer<const void*>();table.glColorTableSGI(a0,a1,a2,a3,a4,a5);}},
+{"glCopyConvolutionFilter2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glCopyConvolutionFilter2DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glMultiTexCoord3f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glMultiTexCoord3f(a0,a1,a2,a3);}},
+{"glMultiTexCoord3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glMultiTexCoord3d(a0,a1,a2,a3);}},
+{"glFogCoorddv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glFogCoorddv(a0);}},
+{"glGetBufferPointerv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetBufferPointerv(a0,a1,a2);}},
+{"glProgramUniform1fEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLfloat>();table.glProgramUniform1fEXT(a0,a1,a2);}},
+{"glWindowPos2fvMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glWindowPos2fvMESA(a0);}},
+{"glAlphaToCoverageDitherControlNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glAlphaToCoverageDitherControlNV(a0);}},
+{"glPolygonOffsetxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();table.glPolygonOffsetxOES(a0,a1);}},
+{"glVertexAttrib4dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glVertexAttrib4dARB(a0,a1,a2,a3,a4);}},
+{"glUniformHandleui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniformHandleui64vARB(a0,a1,a2);}},
+{"glFragmentLightModelfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glFragmentLightModelfvSGIX(a0,a1);}},
+{"glSwizzleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();table.glSwizzleEXT(a0,a1,a2,a3,a4,a5);}},
+{"glBindFragmentShaderATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBindFragmentShaderATI(a0);}},
+{"glVertexAttribs3hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLhalfNV*>();table.glVertexAttribs3hvNV(a0,a1,a2);}},
+{"glGenBuffersARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenBuffersARB(a0,a1);}},
+{"glTextureStorageMem2DMultisampleEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint64>();table.glTextureStorageMem2DMultisampleEXT(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glListParameterfvSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glListParameterfvSGIX(a0,a1,a2);}},
+{"glNamedRenderbufferStorageMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glNamedRenderbufferStorageMultisample(a0,a1,a2,a3,a4);}},
+{"glVertexAttribI1iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glVertexAttribI1iEXT(a0,a1);}},
+{"glMultiTexCoord2ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord2ivARB(a0,a1);}},
+{"glLightModelxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();table.glLightModelxOES(a0,a1);}},
+{"glColor3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();table.glColor3xOES(a0,a1,a2);}},
+{"glReadBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glReadBuffer(a0);}},
+{"glStencilFillPathInstancedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.pointer<const GLfloat*>();table.glStencilFillPathInstancedNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glVDPAUUnmapSurfacesNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLvdpauSurfaceNV*>();table.glVDPAUUnmapSurfacesNV(a0,a1);}},
+{"glProgramUniform4i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64EXT>();auto const a3 = call.scalar<GLint64EXT>();auto const a4 = call.scalar<GLint64EXT>();auto const a5 = call.scalar<GLint64EXT>();table.glProgramUniform4i64NV(a0,a1,a2,a3,a4,a5);}},
+{"glVertexStream4dvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexStream4dvATI(a0,a1);}},
+{"glIsQuery",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsQuery(a0);}},
+{"glProgramUniformMatrix4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4fvEXT(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();table.glVertexAttrib3hNV(a0,a1,a2,a3);}},
+{"glFlushMappedNamedBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();table.glFlushMappedNamedBufferRange(a0,a1,a2);}},
+{"glPushName",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glPushName(a0);}},
+{"glGetClipPlane",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<GLdouble*>();table.glGetClipPlane(a0,a1);}},
+{"glVertex4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glVertex4dv(a0);}},
+{"glVertexAttrib3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertexAttrib3d(a0,a1,a2,a3);}},
+{"glBlendColor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glBlendColor(a0,a1,a2,a3);}},
+{"glBindTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindTransformFeedbackNV(a0,a1);}},
+{"glSamplerParameterIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLuint*>();table.glSamplerParameterIuiv(a0,a1,a2);}},
+{"glIndexubv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLubyte*>();table.glIndexubv(a0);}},
+{"glNamedBufferPageCommitmentEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLboolean>();table.glNamedBufferPageCommitmentEXT(a0,a1,a2,a3);}},
+{"glCheckNamedFramebufferStatus",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glCheckNamedFramebufferStatus(a0,a1);}},
+{"glGetObjectBufferfvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetObjectBufferfvATI(a0,a1,a2);}},
+{"glRasterPos4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glRasterPos4d(a0,a1,a2,a3);}},
+{"glRasterPos4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glRasterPos4f(a0,a1,a2,a3);}},
+{"glGetPerfMonitorCounterStringAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<GLsizei*>();auto const a4 = call.pointer<GLchar*>();table.glGetPerfMonitorCounterStringAMD(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glVertexAttrib3s(a0,a1,a2,a3);}},
+{"glDrawElementsInstancedEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();table.glDrawElementsInstancedEXT(a0,a1,a2,a3,a4);}},
+{"glNamedProgramLocalParameterI4iEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();table.glNamedProgramLocalParameterI4iEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glRasterPos4s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glRasterPos4s(a0,a1,a2,a3);}},
+{"glGetProgramStageiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetProgramStageiv(a0,a1,a2,a3);}},
+{"glGetMaterialxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfixed>();table.glGetMaterialxOES(a0,a1,a2);}},
+{"glPopMatrix",[](FunctionTable const&table,ReplayCall&){table.glPopMatrix();}},
+{"glGetVideoui64vNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64EXT*>();table.glGetVideoui64vNV(a0,a1,a2);}},
+{"glTangent3bEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glTangent3bEXT(a0,a1,a2);}},
+{"glGetGraphicsResetStatusARB",[](FunctionTable const&table,ReplayCall&){table.glGetGraphicsResetStatusARB();}},
+{"glUniform4i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();table.glUniform4i(a0,a1,a2,a3,a4);}},
+{"glActiveTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glActiveTexture(a0);}},
+{"glEnableVertexAttribArray",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEnableVertexAttribArray(a0);}},
+{"glTexCoord4fVertex4fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();table.glTexCoord4fVertex4fvSUN(a0,a1);}},
+{"glUniform4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();auto const a4 = call.scalar<GLdouble>();table.glUniform4d(a0,a1,a2,a3,a4);}},
+{"glUniform4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glUniform4f(a0,a1,a2,a3,a4);}},
+{"glRenderbufferStorageMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();table.glRenderbufferStorageMultisample(a0,a1,a2,a3,a4);}},
+{"glCreateProgramPipelines",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glCreateProgramPipelines(a0,a1);}},
+{"glVertexAttribLPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexAttribLPointer(a0,a1,a2,a3,a4);}},
+{"glUniform2uiEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glUniform2uiEXT(a0,a1,a2);}},
+{"glMultiTexCoord3sv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLshort*>();table.glMultiTexCoord3sv(a0,a1);}},
+{"glDrawElementsInstancedBaseVertex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();table.glDrawElementsInstancedBaseVertex(a0,a1,a2,a3,a4,a5);}},
+{"glPixelTransformParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glPixelTransformParameterfvEXT(a0,a1,a2);}},
+{"glDrawTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glDrawTransformFeedbackNV(a0,a1);}},
+{"glTextureImage2DMultisampleCoverageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLboolean>();table.glTextureImage2DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glNamedRenderbufferStorageMultisampleCoverageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glNamedRenderbufferStorageMultisampleCoverageEXT(a0,a1,a2,a3,a4,a5);}},
+{"glIsTexture",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsTexture(a0);}},
+{"glMultiTexCoord4iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLint*>();table.glMultiTexCoord4iv(a0,a1);}},
+{"glTexEnvfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glTexEnvfv(a0,a1,a2);}},
+{"glPopDebugGroup",[](FunctionTable const&table,ReplayCall&){table.glPopDebugGroup();}},
+{"glUniformBlockBinding",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glUniformBlockBinding(a0,a1,a2);}},
+{"glWindowPos2svMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos2svMESA(a0);}},
+{"glGenerateTextureMipmapEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glGenerateTextureMipmapEXT(a0,a1);}},
+{"glBindLightParameterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBindLightParameterEXT(a0,a1);}},
+{"glTexCoord3bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glTexCoord3bOES(a0,a1,a2);}},
+{"glTexCoordPointer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLvoid*>();table.glTexCoordPointer(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix3x2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix3x2fv(a0,a1,a2,a3,a4);}},
+{"glUniform2fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform2fvARB(a0,a1,a2);}},
+{"glProgramLocalParameterI4uivNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLuint*>();table.glProgramLocalParameterI4uivNV(a0,a1,a2);}},
+{"glFlushVertexArrayRangeNV",[](FunctionTable const&table,ReplayCall&){table.glFlushVertexArrayRangeNV();}},
+{"glSecondaryColor3svEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glSecondaryColor3svEXT(a0);}},
+{"glGetBufferParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetBufferParameteriv(a0,a1,a2);}},
+{"glGetQueryIndexediv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetQueryIndexediv(a0,a1,a2,a3);}},
+{"glFramebufferTexture3DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glFramebufferTexture3DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glLoadTransposeMatrixxOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glLoadTransposeMatrixxOES(a0);}},
+{"glDeleteTransformFeedbacksNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLuint*>();table.glDeleteTransformFeedbacksNV(a0,a1);}},
+{"glGetCompressedTextureImageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<void*>();table.glGetCompressedTextureImageEXT(a0,a1,a2,a3);}},
+{"glIndexMaterialEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glIndexMaterialEXT(a0,a1);}},
+{"glFogCoorddEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();table.glFogCoorddEXT(a0);}},
+{"glTexCoord2hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLhalfNV*>();table.glTexCoord2hvNV(a0);}},
+{"glGetFramebufferParameterfvAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.pointer<GLfloat*>();table.glGetFramebufferParameterfvAMD(a0,a1,a2,a3,a4,a5);}},
+{"glTexEnviv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTexEnviv(a0,a1,a2);}},
+{"glEndTransformFeedbackNV",[](FunctionTable const&table,ReplayCall&){table.glEndTransformFeedbackNV();}},
+{"glGlobalAlphaFactoruiSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glGlobalAlphaFactoruiSUN(a0);}},
+{"glSelectBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glSelectBuffer(a0,a1);}},
+{"glNamedBufferSubDataEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.pointer<const void*>();table.glNamedBufferSubDataEXT(a0,a1,a2,a3);}},
+{"glDisableVertexArrayAttrib",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glDisableVertexArrayAttrib(a0,a1);}},
+{"glBlendFunc",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glBlendFunc(a0,a1);}},
+{"glCreateProgram",[](FunctionTable const&table,ReplayCall&){table.glCreateProgram();}},
+{"glVertexStream2dATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexStream2dATI(a0,a1,a2);}},
+{"glUniform4ui64vARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint64*>();table.glUniform4ui64vARB(a0,a1,a2);}},
+{"glGetSemaphoreParameterui64vEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint64*>();table.glGetSemaphoreParameterui64vEXT(a0,a1,a2);}},
+{"glPrimitiveRestartIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glPrimitiveRestartIndex(a0);}},
+{"glNormalStream3fATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glNormalStream3fATI(a0,a1,a2,a3);}},
+{"glProgramUniformMatrix2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix2fv(a0,a1,a2,a3,a4);}},
+{"glVertexAttribs1hvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLhalfNV*>();table.glVertexAttribs1hvNV(a0,a1,a2);}},
+{"glWindowPos4svMESA",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLshort*>();table.glWindowPos4svMESA(a0);}},
+{"glDeleteFragmentShaderATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDeleteFragmentShaderATI(a0);}},
+{"glBindImageTextures",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glBindImageTextures(a0,a1,a2);}},
+{"glMap2xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLfixed>();auto const a6 = call.scalar<GLfixed>();auto const a7 = call.scalar<GLint>();auto const a8 = call.scalar<GLint>();auto const a9 = call.scalar<GLfixed>();table.glMap2xOES(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glEnd",[](FunctionTable const&table,ReplayCall&){table.glEnd();}},
+{"glMultiTexCoord2dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glMultiTexCoord2dARB(a0,a1,a2);}},
+{"glUniform1i64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint64EXT>();table.glUniform1i64NV(a0,a1);}},
+{"glPathStringNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();table.glPathStringNV(a0,a1,a2,a3);}},
+{"glGetNamedFramebufferParameterivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetNamedFramebufferParameterivEXT(a0,a1,a2);}},
+{"glGetProgramNamedParameterdvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.pointer<GLdouble*>();table.glGetProgramNamedParameterdvNV(a0,a1,a2,a3);}},
+{"glPathDashArrayNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glPathDashArrayNV(a0,a1,a2);}},
+{"glUniform3uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLuint*>();table.glUniform3uiv(a0,a1,a2);}},
+{"glColor3fVertex3fvSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();auto const a1 = call.pointer<const GLfloat*>();table.glColor3fVertex3fvSUN(a0,a1);}},
+{"glMultTransposeMatrixd",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glMultTransposeMatrixd(a0);}},
+{"glClearColor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLclampf>();auto const a1 = call.scalar<GLclampf>();auto const a2 = call.scalar<GLclampf>();auto const a3 = call.scalar<GLclampf>();table.glClearColor(a0,a1,a2,a3);}},
+{"glGetImageHandleARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLenum>();table.glGetImageHandleARB(a0,a1,a2,a3,a4);}},
+{"glTangent3dEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glTangent3dEXT(a0,a1,a2);}},
+{"glGetQueryObjectivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetQueryObjectivARB(a0,a1,a2);}},
+{"glGetLocalConstantFloatvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetLocalConstantFloatvEXT(a0,a1,a2);}},
+{"glUseShaderProgramEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glUseShaderProgramEXT(a0,a1);}},
+{"glBindRenderbufferEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindRenderbufferEXT(a0,a1);}},
+{"glInterleavedArrays",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLvoid*>();table.glInterleavedArrays(a0,a1,a2);}},
+{"glGetPerfMonitorGroupStringAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLsizei*>();auto const a3 = call.pointer<GLchar*>();table.glGetPerfMonitorGroupStringAMD(a0,a1,a2,a3);}},
+{"glUniform3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();table.glUniform3ui(a0,a1,a2,a3);}},
+{"glGetNamedProgramLocalParameterdvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<GLdouble*>();table.glGetNamedProgramLocalParameterdvEXT(a0,a1,a2,a3);}},
+{"glDeleteQueryResourceTagNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLint*>();table.glDeleteQueryResourceTagNV(a0,a1);}},
+{"glVertexAttribI4uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLuint*>();table.glVertexAttribI4uiv(a0,a1);}},
+{"glVertexAttrib4bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttrib4bv(a0,a1);}},
+{"glMultiTexCoord3xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glMultiTexCoord3xOES(a0,a1,a2,a3);}},
+{"glSecondaryColor3ub",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLubyte>();auto const a1 = call.scalar<GLubyte>();auto const a2 = call.scalar<GLubyte>();table.glSecondaryColor3ub(a0,a1,a2);}},
+{"glFragmentMaterialfSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glFragmentMaterialfSGIX(a0,a1,a2);}},
+{"glGetVariantArrayObjectivATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetVariantArrayObjectivATI(a0,a1,a2);}},
+{"glSecondaryColor3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glSecondaryColor3ui(a0,a1,a2);}},
+{"glVertexAttrib1dARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();table.glVertexAttrib1dARB(a0,a1);}},
+{"glGetNamedBufferPointerv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<void**>();table.glGetNamedBufferPointerv(a0,a1,a2);}},
+{"glLockArraysEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();table.glLockArraysEXT(a0,a1);}},
+{"glVertexAttribPointerNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const void*>();table.glVertexAttribPointerNV(a0,a1,a2,a3,a4);}},
+{"glConvolutionParameterf",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glConvolutionParameterf(a0,a1,a2);}},
+{"glBindBufferBaseEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();table.glBindBufferBaseEXT(a0,a1,a2);}},
+{"glTexCoord2xvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfixed*>();table.glTexCoord2xvOES(a0);}},
+{"glGetQueryBufferObjectui64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLintptr>();table.glGetQueryBufferObjectui64v(a0,a1,a2,a3);}},
+{"glSetMultisamplefvAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLfloat*>();table.glSetMultisamplefvAMD(a0,a1,a2);}},
+{"glPathColorGenNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glPathColorGenNV(a0,a1,a2,a3);}},
+{"glVertexAttrib3sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();table.glVertexAttrib3sARB(a0,a1,a2,a3);}},
+{"glVertexAttrib4ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttrib4ivARB(a0,a1);}},
+{"glGenTransformFeedbacks",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenTransformFeedbacks(a0,a1);}},
+{"glGetVertexAttribIuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetVertexAttribIuiv(a0,a1,a2);}},
+{"glPixelTransformParameterfEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLfloat>();table.glPixelTransformParameterfEXT(a0,a1,a2);}},
+{"glGetTexParameterIuivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLuint*>();table.glGetTexParameterIuivEXT(a0,a1,a2);}},
+{"glGetObjectParameterivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLhandleARB>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetObjectParameterivARB(a0,a1,a2);}},
+{"glVertexArraySecondaryColorOffsetEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLintptr>();table.glVertexArraySecondaryColorOffsetEXT(a0,a1,a2,a3,a4,a5);}},
+{"glWindowPos2fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();table.glWindowPos2fARB(a0,a1);}},
+{"glCompressedTexSubImage2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.pointer<const GLvoid*>();table.glCompressedTexSubImage2D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glCompressedTexSubImage3DARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLsizei>();auto const a10 = call.pointer<const void*>();table.glCompressedTexSubImage3DARB(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glProgramBinary",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLsizei>();table.glProgramBinary(a0,a1,a2,a3);}},
+{"glPresentFrameKeyedNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLenum>();auto const a5 = call.scalar<GLenum>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.scalar<GLuint>();auto const a10 = call.scalar<GLuint>();table.glPresentFrameKeyedNV(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10);}},
+{"glVertexAttribI4bv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLbyte*>();table.glVertexAttribI4bv(a0,a1);}},
+{"glPathCoverDepthFuncNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glPathCoverDepthFuncNV(a0);}},
+{"glTransformFeedbackStreamAttribsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const GLint*>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLint*>();auto const a4 = call.scalar<GLenum>();table.glTransformFeedbackStreamAttribsNV(a0,a1,a2,a3,a4);}},
+{"glSecondaryColor3usEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLushort>();auto const a1 = call.scalar<GLushort>();auto const a2 = call.scalar<GLushort>();table.glSecondaryColor3usEXT(a0,a1,a2);}},
+{"glCopyColorTableSGI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();table.glCopyColorTableSGI(a0,a1,a2,a3,a4);}},
+{"glProgramEnvParameter4fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.pointer<const GLfloat*>();table.glProgramEnvParameter4fvARB(a0,a1,a2);}},
+{"glMultiTexCoord4sARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();auto const a3 = call.scalar<GLshort>();auto const a4 = call.scalar<GLshort>();table.glMultiTexCoord4sARB(a0,a1,a2,a3,a4);}},
+{"glGetVertexArrayIndexed64iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint64*>();table.glGetVertexArrayIndexed64iv(a0,a1,a2,a3);}},
+{"glMatrixMultTranspose3x3fNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMatrixMultTranspose3x3fNV(a0,a1);}},
+{"glTexParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glTexParameterIiv(a0,a1,a2);}},
+{"glVertexArrayAttribFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLboolean>();auto const a5 = call.scalar<GLuint>();table.glVertexArrayAttribFormat(a0,a1,a2,a3,a4,a5);}},
+{"glEndTransformFeedback",[](FunctionTable const&table,ReplayCall&){table.glEndTransformFeedback();}},
+{"glDrawCommandsStatesAddressNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLuint64*>();auto const a1 = call.pointer<const GLsizei*>();auto const a2 = call.pointer<const GLuint*>();auto const a3 = call.pointer<const GLuint*>();auto const a4 = call.scalar<GLuint>();table.glDrawCommandsStatesAddressNV(a0,a1,a2,a3,a4);}},
+{"glUniform4ui64NV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLuint64EXT>();auto const a2 = call.scalar<GLuint64EXT>();auto const a3 = call.scalar<GLuint64EXT>();auto const a4 = call.scalar<GLuint64EXT>();table.glUniform4ui64NV(a0,a1,a2,a3,a4);}},
+{"glMaterialiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLint*>();table.glMaterialiv(a0,a1,a2);}},
+{"glTexImage2DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLboolean>();table.glTexImage2DMultisample(a0,a1,a2,a3,a4,a5);}},
+{"glBindTextureEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindTextureEXT(a0,a1);}},
+{"glIsBuffer",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIsBuffer(a0);}},
+{"glVertexAttribI1iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI1iv(a0,a1);}},
+{"glGetFinalCombinerInputParameterfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetFinalCombinerInputParameterfvNV(a0,a1,a2);}},
+{"glMultiTexCoord3bvOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLbyte*>();table.glMultiTexCoord3bvOES(a0,a1);}},
+{"glVertexAttribDivisor",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glVertexAttribDivisor(a0,a1);}},
+{"glCopyBufferSubData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizeiptr>();table.glCopyBufferSubData(a0,a1,a2,a3,a4);}},
+{"glBindTexGenParameterEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();table.glBindTexGenParameterEXT(a0,a1,a2);}},
+{"glNormalStream3bATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();auto const a3 = call.scalar<GLbyte>();table.glNormalStream3bATI(a0,a1,a2,a3);}},
+{"glTexStorageMem2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint64>();table.glTexStorageMem2DEXT(a0,a1,a2,a3,a4,a5,a6);}},
+{"glTextureImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLenum>();auto const a9 = call.pointer<const void*>();table.glTextureImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glGetColorTableParameteriv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetColorTableParameteriv(a0,a1,a2);}},
+{"glActiveTextureARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glActiveTextureARB(a0);}},
+{"glTexCoord4xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();auto const a1 = call.scalar<GLfixed>();auto const a2 = call.scalar<GLfixed>();auto const a3 = call.scalar<GLfixed>();table.glTexCoord4xOES(a0,a1,a2,a3);}},
+{"glNamedBufferStorageExternalEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLeglClientBufferEXT>();auto const a4 = call.scalar<GLbitfield>();table.glNamedBufferStorageExternalEXT(a0,a1,a2,a3,a4);}},
+{"glSecondaryColor3fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLfloat*>();table.glSecondaryColor3fvEXT(a0);}},
+{"glUniformMatrix4x2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix4x2fv(a0,a1,a2,a3);}},
+{"glStartInstrumentsSGIX",[](FunctionTable const&table,ReplayCall&){table.glStartInstrumentsSGIX();}},
+{"glProgramNamedParameter4fvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLubyte*>();auto const a3 = call.pointer<const GLfloat*>();table.glProgramNamedParameter4fvNV(a0,a1,a2,a3);}},
+{"glEndVideoCaptureNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glEndVideoCaptureNV(a0);}},
+{"glGenLists",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();table.glGenLists(a0);}},
+{"glUniform1fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();table.glUniform1fARB(a0,a1);}},
+{"glNamedFramebufferTexture1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();table.glNamedFramebufferTexture1DEXT(a0,a1,a2,a3,a4);}},
+{"glMapBufferRange",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLintptr>();auto const a2 = call.scalar<GLsizeiptr>();auto const a3 = call.scalar<GLbitfield>();table.glMapBufferRange(a0,a1,a2,a3);}},
+{"glMultiDrawElementsIndirectCountARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLintptr>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glMultiDrawElementsIndirectCountARB(a0,a1,a2,a3,a4,a5);}},
+{"glProgramUniformMatrix4x2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLboolean>();auto const a4 = call.pointer<const GLfloat*>();table.glProgramUniformMatrix4x2fv(a0,a1,a2,a3,a4);}},
+{"glGetTextureParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetTextureParameterIivEXT(a0,a1,a2,a3);}},
+{"glMultiTexCoord3hNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLhalfNV>();auto const a2 = call.scalar<GLhalfNV>();auto const a3 = call.scalar<GLhalfNV>();table.glMultiTexCoord3hNV(a0,a1,a2,a3);}},
+{"glNamedProgramLocalParametersI4uivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLuint*>();table.glNamedProgramLocalParametersI4uivEXT(a0,a1,a2,a3,a4);}},
+{"glEndList",[](FunctionTable const&table,ReplayCall&){table.glEndList();}},
+{"glTexCoord2fColor4fNormal3fVertex3fSUN",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();auto const a5 = call.scalar<GLfloat>();auto const a6 = call.scalar<GLfloat>();auto const a7 = call.scalar<GLfloat>();auto const a8 = call.scalar<GLfloat>();auto const a9 = call.scalar<GLfloat>();auto const a10 = call.scalar<GLfloat>();auto const a11 = call.scalar<GLfloat>();table.glTexCoord2fColor4fNormal3fVertex3fSUN(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11);}},
+{"glGenTransformFeedbacksNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenTransformFeedbacksNV(a0,a1);}},
+{"glEdgeFlagv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLboolean*>();table.glEdgeFlagv(a0);}},
+{"glVertexAttribI2iv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glVertexAttribI2iv(a0,a1);}},
+{"glCopyMultiTexImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLint>();table.glCopyMultiTexImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glUniformMatrix3x2dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLdouble*>();table.glUniformMatrix3x2dv(a0,a1,a2,a3);}},
+{"glTexImage3DMultisampleCoverageNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLboolean>();table.glTexImage3DMultisampleCoverageNV(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetShaderPrecisionFormat",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();auto const a3 = call.pointer<GLint*>();table.glGetShaderPrecisionFormat(a0,a1,a2,a3);}},
+{"glTexSubImage4DSGIS",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.scalar<GLsizei>();auto const a10 = call.scalar<GLenum>();auto const a11 = call.scalar<GLenum>();auto const a12 = call.pointer<const void*>();table.glTexSubImage4DSGIS(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,a11,a12);}},
+{"glRasterSamplesEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLboolean>();table.glRasterSamplesEXT(a0,a1);}},
+{"glTextureView",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();auto const a6 = call.scalar<GLuint>();auto const a7 = call.scalar<GLuint>();table.glTextureView(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glEvalMapsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();table.glEvalMapsNV(a0,a1);}},
+{"glGetFragDataLocationEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetFragDataLocationEXT(a0,a1);}},
+{"glGetCompressedMultiTexImageEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.pointer<void*>();table.glGetCompressedMultiTexImageEXT(a0,a1,a2,a3);}},
+{"glIndexMask",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glIndexMask(a0);}},
+{"glPushClientAttrib",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();table.glPushClientAttrib(a0);}},
+{"glShaderSource",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLchar*const*>();auto const a3 = call.pointer<const GLint*>();table.glShaderSource(a0,a1,a2,a3);}},
+{"glDispatchComputeGroupSizeARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLuint>();auto const a5 = call.scalar<GLuint>();table.glDispatchComputeGroupSizeARB(a0,a1,a2,a3,a4,a5);}},
+{"glLGPUNamedBufferSubDataNVX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbitfield>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLintptr>();auto const a3 = call.scalar<GLsizeiptr>();auto const a4 = call.pointer<const void*>();table.glLGPUNamedBufferSubDataNVX(a0,a1,a2,a3,a4);}},
+{"glGetnPixelMapfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLfloat*>();table.glGetnPixelMapfv(a0,a1,a2);}},
+{"glTexCoordP2uiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLuint*>();table.glTexCoordP2uiv(a0,a1);}},
+{"glUniform2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glUniform2f(a0,a1,a2);}},
+{"glGetNamedBufferParameteri64v",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint64*>();table.glGetNamedBufferParameteri64v(a0,a1,a2);}},
+{"glCommandListSegmentsNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();table.glCommandListSegmentsNV(a0,a1);}},
+{"glTextureParameterIivEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLint*>();table.glTextureParameterIivEXT(a0,a1,a2,a3);}},
+{"glMultiTexParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const GLfloat*>();table.glMultiTexParameterfvEXT(a0,a1,a2,a3);}},
+{"glProgramUniform2ui64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLuint64>();auto const a3 = call.scalar<GLuint64>();table.glProgramUniform2ui64ARB(a0,a1,a2,a3);}},
+{"glVertex4d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();auto const a3 = call.scalar<GLdouble>();table.glVertex4d(a0,a1,a2,a3);}},
+{"glNewObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<const void*>();auto const a2 = call.scalar<GLenum>();table.glNewObjectBufferATI(a0,a1,a2);}},
+{"glViewportSwizzleNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLenum>();auto const a4 = call.scalar<GLenum>();table.glViewportSwizzleNV(a0,a1,a2,a3,a4);}},
+{"glBufferData",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizeiptr>();auto const a2 = call.pointer<const void*>();auto const a3 = call.scalar<GLenum>();table.glBufferData(a0,a1,a2,a3);}},
+{"glTextureImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLenum>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.pointer<const void*>();table.glTextureImage1DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glGetTexParameterIiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetTexParameterIiv(a0,a1,a2);}},
+{"glCopyTexSubImage1DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();table.glCopyTexSubImage1DEXT(a0,a1,a2,a3,a4,a5);}},
+{"glVertex4f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfloat>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();table.glVertex4f(a0,a1,a2,a3);}},
+{"glUniformMatrix3fvARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLboolean>();auto const a3 = call.pointer<const GLfloat*>();table.glUniformMatrix3fvARB(a0,a1,a2,a3);}},
+{"glTexCoordP1ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glTexCoordP1ui(a0,a1);}},
+{"glPointParameterfvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glPointParameterfvEXT(a0,a1);}},
+{"glUniform4fARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();auto const a3 = call.scalar<GLfloat>();auto const a4 = call.scalar<GLfloat>();table.glUniform4fARB(a0,a1,a2,a3,a4);}},
+{"glImportMemoryFdEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLint>();table.glImportMemoryFdEXT(a0,a1,a2,a3);}},
+{"glCopyTextureSubImage3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();auto const a6 = call.scalar<GLint>();auto const a7 = call.scalar<GLsizei>();auto const a8 = call.scalar<GLsizei>();table.glCopyTextureSubImage3D(a0,a1,a2,a3,a4,a5,a6,a7,a8);}},
+{"glMultiTexCoord2fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glMultiTexCoord2fv(a0,a1);}},
+{"glNamedFramebufferSamplePositionsfvAMD",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.pointer<const GLfloat*>();table.glNamedFramebufferSamplePositionsfvAMD(a0,a1,a2,a3);}},
+{"glNormalP3ui",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glNormalP3ui(a0,a1);}},
+{"glDrawRangeElementArrayATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();table.glDrawRangeElementArrayATI(a0,a1,a2,a3);}},
+{"glVertexAttribI1i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glVertexAttribI1i(a0,a1);}},
+{"glDrawArraysInstancedARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();table.glDrawArraysInstancedARB(a0,a1,a2,a3);}},
+{"glEnableVertexAttribAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();table.glEnableVertexAttribAPPLE(a0,a1);}},
+{"glGetDebugMessageLogARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLenum*>();auto const a3 = call.pointer<GLenum*>();auto const a4 = call.pointer<GLuint*>();auto const a5 = call.pointer<GLenum*>();auto const a6 = call.pointer<GLsizei*>();auto const a7 = call.pointer<GLchar*>();table.glGetDebugMessageLogARB(a0,a1,a2,a3,a4,a5,a6,a7);}},
+{"glGetPathTexGenfvNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLfloat*>();table.glGetPathTexGenfvNV(a0,a1,a2);}},
+{"glNamedProgramLocalParameters4fvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLuint>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.pointer<const GLfloat*>();table.glNamedProgramLocalParameters4fvEXT(a0,a1,a2,a3,a4);}},
+{"glQueryResourceTagNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.pointer<const GLchar*>();table.glQueryResourceTagNV(a0,a1);}},
+{"glVertexStream3fvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLfloat*>();table.glVertexStream3fvATI(a0,a1);}},
+{"glFramebufferTexture3D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLuint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLint>();table.glFramebufferTexture3D(a0,a1,a2,a3,a4,a5);}},
+{"glCompressedTextureSubImage2DEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLint>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLsizei>();auto const a7 = call.scalar<GLenum>();auto const a8 = call.scalar<GLsizei>();auto const a9 = call.pointer<const void*>();table.glCompressedTextureSubImage2DEXT(a0,a1,a2,a3,a4,a5,a6,a7,a8,a9);}},
+{"glWindowPos3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.pointer<const GLdouble*>();table.glWindowPos3dv(a0);}},
+{"glCopyConvolutionFilter2D",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLint>();auto const a3 = call.scalar<GLint>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();table.glCopyConvolutionFilter2D(a0,a1,a2,a3,a4,a5);}},
+{"glReadInstrumentsSGIX",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();table.glReadInstrumentsSGIX(a0);}},
+{"glProgramUniform2dvEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const GLdouble*>();table.glProgramUniform2dvEXT(a0,a1,a2,a3);}},
+{"glSamplerParameterfv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<const GLfloat*>();table.glSamplerParameterfv(a0,a1,a2);}},
+{"glBindBufferARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();table.glBindBufferARB(a0,a1);}},
+{"glVertexAttrib1sNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();table.glVertexAttrib1sNV(a0,a1);}},
+{"glGetMaterialiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.pointer<GLint*>();table.glGetMaterialiv(a0,a1,a2);}},
+{"glUniform1fv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLfloat*>();table.glUniform1fv(a0,a1,a2);}},
+{"glBeginOcclusionQueryNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glBeginOcclusionQueryNV(a0);}},
+{"glGenFencesAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLsizei>();auto const a1 = call.pointer<GLuint*>();table.glGenFencesAPPLE(a0,a1);}},
+{"glScissorIndexedv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLint*>();table.glScissorIndexedv(a0,a1);}},
+{"glDisableVariantClientStateEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();table.glDisableVariantClientStateEXT(a0);}},
+{"glMinmaxEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLenum>();auto const a2 = call.scalar<GLboolean>();table.glMinmaxEXT(a0,a1,a2);}},
+{"glNormalPointervINTEL",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const void**>();table.glNormalPointervINTEL(a0,a1);}},
+{"glNormal3s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLshort>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glNormal3s(a0,a1,a2);}},
+{"glGetnPixelMapuiv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<GLuint*>();table.glGetnPixelMapuiv(a0,a1,a2);}},
+{"glNormalStream3bvATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLbyte*>();table.glNormalStream3bvATI(a0,a1);}},
+{"glGetObjectParameterivAPPLE",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<GLint*>();table.glGetObjectParameterivAPPLE(a0,a1,a2,a3);}},
+{"glNormal3i",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint>();table.glNormal3i(a0,a1,a2);}},
+{"glUniform1ivARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLint>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.pointer<const GLint*>();table.glUniform1ivARB(a0,a1,a2);}},
+{"glNormal3d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLdouble>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glNormal3d(a0,a1,a2);}},
+{"glUpdateObjectBufferATI",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.pointer<const void*>();auto const a4 = call.scalar<GLenum>();table.glUpdateObjectBufferATI(a0,a1,a2,a3,a4);}},
+{"glNormal3b",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLbyte>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glNormal3b(a0,a1,a2);}},
+{"glGetUniformBufferSizeEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();table.glGetUniformBufferSizeEXT(a0,a1);}},
+{"glMultiTexCoord4dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLdouble*>();table.glMultiTexCoord4dv(a0,a1);}},
+{"glProgramUniform3i64ARB",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLint64>();auto const a3 = call.scalar<GLint64>();auto const a4 = call.scalar<GLint64>();table.glProgramUniform3i64ARB(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib2d",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLdouble>();auto const a2 = call.scalar<GLdouble>();table.glVertexAttrib2d(a0,a1,a2);}},
+{"glVertexAttrib2f",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glVertexAttrib2f(a0,a1,a2);}},
+{"glMultiDrawElementsEXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.pointer<const GLsizei*>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.pointer<const void*const*>();auto const a4 = call.scalar<GLsizei>();table.glMultiDrawElementsEXT(a0,a1,a2,a3,a4);}},
+{"glVertexAttrib3dv",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLdouble*>();table.glVertexAttrib3dv(a0,a1);}},
+{"glMultiTexCoord2bOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLbyte>();auto const a2 = call.scalar<GLbyte>();table.glMultiTexCoord2bOES(a0,a1,a2);}},
+{"glVertexAttrib2s",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLshort>();auto const a2 = call.scalar<GLshort>();table.glVertexAttrib2s(a0,a1,a2);}},
+{"glTexImage3DMultisample",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLsizei>();auto const a2 = call.scalar<GLenum>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLsizei>();auto const a5 = call.scalar<GLsizei>();auto const a6 = call.scalar<GLboolean>();table.glTexImage3DMultisample(a0,a1,a2,a3,a4,a5,a6);}},
+{"glGetUniformBlockIndex",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.pointer<const GLchar*>();table.glGetUniformBlockIndex(a0,a1);}},
+{"glReleaseKeyedMutexWin32EXT",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLuint64>();table.glReleaseKeyedMutexWin32EXT(a0,a1);}},
+{"glFrontFace",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();table.glFrontFace(a0);}},
+{"glEvalCoord1xOES",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLfixed>();table.glEvalCoord1xOES(a0);}},
+{"glDrawArraysInstancedBaseInstance",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLenum>();auto const a1 = call.scalar<GLint>();auto const a2 = call.scalar<GLsizei>();auto const a3 = call.scalar<GLsizei>();auto const a4 = call.scalar<GLuint>();table.glDrawArraysInstancedBaseInstance(a0,a1,a2,a3,a4);}},
+{"glIsPointInStrokePathNV",[](FunctionTable const&table,ReplayCall&call){auto const a0 = call.scalar<GLuint>();auto const a1 = call.scalar<GLfloat>();auto const a2 = call.scalar<GLfloat>();table.glIsPointInStrokePathNV(a0,a1,a2);}},
@@ -3,29 +3,105 @@
 #include<geGL/FunctionLoaderInterface.h>
 #include<geGL/OpenGLFunctionTable.h>
 #include<cassert>
+#include<stdexcept>
+#include<string>
+#include<vector>
 
 namespace ge{
   namespace gl{
+    /**
+     * @brief This decorator loads OpenGL functions using FunctionLoaderInterface.
+     * Functions are loaded eagerly during initialization by default.
+     * If lazyLoading is true, every function points to thunk that loads the function
+     * during its first call and patches itself.
+     * Decorators ask for availability using m_isAvailable, so they resolve only functions they need.
+     * Decorator has to resolve function using m_isAvailable before it wraps the function,
+     * otherwise decorators above it see the wrapper instead of missing function.
+     * Lazy resolution is not synchronized, function table has to be used by thread of its context.
+     */
     template<typename T>
       class LoaderTableDecorator: public T{
         public:
           template<typename...ARGS>
             LoaderTableDecorator(
                 std::shared_ptr<FunctionLoaderInterface>const&functionLoader,
+                bool                                          lazyLoading = false,
                 ARGS&&...args):T(args...){
               assert(this!=nullptr);
               this->m_functionLoader = functionLoader;
+              this->m_lazyLoading    = lazyLoading   ;
             }
           virtual ~LoaderTableDecorator(){}
+          virtual FUNCTION_POINTER getDirectFunction(size_t index)const override{
+            assert(this!=nullptr);
+            if(index >= GE_GL_NOF_OPENGL_FUNCTIONS)return nullptr;
+            if(this->m_memberFunctions()[index] != this->m_implFunctions()[index])return nullptr;
+            return this->m_baseFunctions()[index];
+          }
         protected:
+          using MEMBER_FUNCTION_POINTER = FunctionTable::MEMBER_FUNCTION_POINTER;
           std::shared_ptr<FunctionLoaderInterface>m_functionLoader = nullptr;
+          bool                                    m_lazyLoading    = false  ;
+          mutable std::vector<bool>               m_resolved                ;///< functions that were already loaded in lazy mode
           virtual bool m_init(){
             assert(this!=nullptr);
             if(!T::m_init())return false;
             assert(this->m_functionLoader!=nullptr);
-#include<geGL/Generated/LoaderLoadingCalls.h>
+            auto const baseFunctions   = this->m_baseFunctions  ();
+            auto const memberFunctions = this->m_memberFunctions();
+            if(this->m_lazyLoading){
+              this->m_resolved.assign(GE_GL_NOF_OPENGL_FUNCTIONS,false);
+              auto const lazyFunctions = this->m_lazyFunctions();
+              for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i){
+                baseFunctions  [i] = nullptr;
+                memberFunctions[i] = lazyFunctions[i];
+              }
+              return true;
+            }
+            auto const functionNames = this->m_functionNames();
+            auto const implFunctions = this->m_implFunctions();
+            for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+              baseFunctions[i] = this->m_functionLoader->load(functionNames[i]);
+            for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i)
+              if(baseFunctions[i])memberFunctions[i] = implFunctions[i];
+              else memberFunctions[i] = nullptr;
             return true;
           }
+          virtual bool m_resolve(MEMBER_FUNCTION_POINTER const*member)const override{
+            assert(this!=nullptr);
+            if(this->m_lazyLoading){
+              auto const index = (size_t)(member - this->m_memberFunctions());
+              assert(index < GE_GL_NOF_OPENGL_FUNCTIONS);
+              if(*member == this->m_lazyFunctions()[index])
+                this->m_resolveFunction(index);
+            }
+            return *member != nullptr;
+          }
+          /**
+           * @brief Loads function, its m_ptr_* is patched if it still points to thunk.
+           *
+           * @param index index of function
+           *
+           * @return true if function is available
+           */
+          bool m_resolveFunction(size_t index)const{
+            auto const baseFunctions = this->m_baseFunctions();
+            if(!this->m_resolved[index]){
+              baseFunctions[index]   = this->m_functionLoader->load(this->m_functionNames()[index]);
+              this->m_resolved[index] = true;
+              auto const memberFunctions = this->m_memberFunctions();
+              if(memberFunctions[index] == this->m_lazyFunctions()[index]){
+                if(baseFunctions[index])memberFunctions[index] = this->m_implFunctions()[index];
+                else memberFunctions[index] = nullptr;
+              }
+            }
+            return baseFunctions[index] != nullptr;
+          }
+          void m_resolveOrThrow(size_t index)const{
+            if(this->m_resolveFunction(index))return;
+            throw std::runtime_error(std::string("geGL - function: ")+this->m_functionNames()[index]+" is not available");
+          }
+#include<geGL/Generated/LoaderTables.h>
 #include<geGL/Generated/LoaderImplementation.h>
       };
   }
@@ -0,0 +1,833 @@
+#include <geGL/MipmapGenerator.h>
+#include <geGL/OpenGLUtil.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GEGL_MIPMAP_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__AVX__)
+#define GEGL_MIPMAP_AVX
+#include <immintrin.h>
+#endif
+
+using namespace ge::gl;
+
+namespace {
+size_t getNofChannels(GLenum format)
+{
+  switch (format) {
+    case GL_RED: return 1;
+    case GL_RG: return 2;
+    case GL_RGB:
+    case GL_BGR: return 3;
+    case GL_RGBA:
+    case GL_BGRA: return 4;
+    default:
+      throw std::invalid_argument(
+          "geGL: MipmapGenerator - unsupported format");
+  }
+}
+
+bool isBgr(GLenum format) { return format == GL_BGR || format == GL_BGRA; }
+
+float clamp01(float v)
+{
+  v = v > 0.f ? v : 0.f;
+  return v < 1.f ? v : 1.f;
+}
+
+float srgbToLinear(float c)
+{
+  return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+}
+
+float linearToSrgb(float l)
+{
+  return l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.f / 2.4f) - 0.055f;
+}
+
+/**
+ * @brief Conversion tables of 8 bit sRGB, linear values are quantized to 16
+ * bits for encoding
+ */
+struct SrgbTables {
+  SrgbTables()
+  {
+    for (size_t i = 0; i < 256; ++i)
+      toLinear[i] = srgbToLinear(static_cast<float>(i) / 255.f);
+    for (size_t i = 0; i < 65536; ++i)
+      fromLinear[i] = static_cast<uint8_t>(std::nearbyint(
+          clamp01(linearToSrgb(static_cast<float>(i) / 65535.f)) * 255.f));
+  }
+  float   toLinear[256];
+  uint8_t fromLinear[65536];
+};
+
+SrgbTables const &srgbTables()
+{
+  static SrgbTables const tables;
+  return tables;
+}
+
+float halfToFloat(uint16_t h)
+{
+  uint32_t const sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+  uint32_t       exp  = (h >> 10) & 0x1fu;
+  uint32_t       mant = h & 0x3ffu;
+  uint32_t       bits;
+  if (exp == 0) {
+    if (mant == 0)
+      bits = sign;
+    else {
+      exp = 127 - 15 + 1;
+      while (!(mant & 0x400u)) {
+        mant <<= 1;
+        exp--;
+      }
+      bits = sign | (exp << 23) | ((mant & 0x3ffu) << 13);
+    }
+  } else if (exp == 31)
+    bits = sign | 0x7f800000u | (mant << 13);
+  else
+    bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+uint16_t floatToHalf(float f)
+{
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+  uint32_t const sign = (x >> 16) & 0x8000u;
+  uint32_t const absx = x & 0x7fffffffu;
+  if (absx >= 0x7f800000u)
+    return static_cast<uint16_t>(sign | 0x7c00u | (absx > 0x7f800000u ? 0x200u : 0u));
+  if (absx >= 0x477ff000u) return static_cast<uint16_t>(sign | 0x7c00u);
+  if (absx < 0x38800000u) {
+    if (absx < 0x33000000u) return static_cast<uint16_t>(sign);
+    uint32_t const e       = absx >> 23;
+    uint32_t const m       = (absx & 0x7fffffu) | 0x800000u;
+    uint32_t const shift   = 126 - e;
+    uint32_t       h       = m >> shift;
+    uint32_t const rem     = m & ((1u << shift) - 1);
+    uint32_t const halfway = 1u << (shift - 1);
+    if (rem > halfway || (rem == halfway && (h & 1u))) h++;
+    return static_cast<uint16_t>(sign | h);
+  }
+  uint32_t       h   = (absx >> 13) - ((127u - 15u) << 10);
+  uint32_t const rem = absx & 0x1fffu;
+  if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) h++;
+  return static_cast<uint16_t>(sign | h);
+}
+
+/**
+ * @brief Channel codecs, they convert stored channel to float and back
+ */
+struct Unorm8 {
+  using Type = uint8_t;
+  static float decode(Type v) { return static_cast<float>(v) * (1.f / 255.f); }
+  static Type  encode(float v)
+  {
+    return static_cast<Type>(std::nearbyint(clamp01(v) * 255.f));
+  }
+  static float decodeSrgb(Type v) { return srgbTables().toLinear[v]; }
+  static Type  encodeSrgb(float v)
+  {
+    return srgbTables().fromLinear[static_cast<size_t>(
+        std::nearbyint(clamp01(v) * 65535.f))];
+  }
+};
+
+struct Unorm16 {
+  using Type = uint16_t;
+  static float decode(Type v)
+  {
+    return static_cast<float>(v) * (1.f / 65535.f);
+  }
+  static Type encode(float v)
+  {
+    return static_cast<Type>(std::nearbyint(clamp01(v) * 65535.f));
+  }
+  static float decodeSrgb(Type v) { return srgbToLinear(decode(v)); }
+  static Type  encodeSrgb(float v) { return encode(linearToSrgb(clamp01(v))); }
+};
+
+struct Half {
+  using Type = uint16_t;
+  static float decode(Type v) { return halfToFloat(v); }
+  static Type  encode(float v) { return floatToHalf(v); }
+  static float decodeSrgb(Type v) { return srgbToLinear(decode(v)); }
+  static Type  encodeSrgb(float v) { return encode(linearToSrgb(clamp01(v))); }
+};
+
+struct Float {
+  using Type = float;
+  static float decode(Type v) { return v; }
+  static Type  encode(float v) { return v; }
+  static float decodeSrgb(Type v) { return srgbToLinear(v); }
+  static Type  encodeSrgb(float v) { return linearToSrgb(clamp01(v)); }
+};
+
+template <typename FCE>
+void dispatchType(GLenum type, FCE const &fce)
+{
+  switch (type) {
+    case GL_UNSIGNED_BYTE: fce(Unorm8()); return;
+    case GL_UNSIGNED_SHORT: fce(Unorm16()); return;
+    case GL_HALF_FLOAT: fce(Half()); return;
+    case GL_FLOAT: fce(Float()); return;
+    default:
+      throw std::invalid_argument("geGL: MipmapGenerator - unsupported type");
+  }
+}
+
+/**
+ * @brief Layout of pixels of one row
+ */
+struct Pixels {
+  size_t channels;
+  bool   bgr;
+  bool   srgb;
+};
+
+template <typename C>
+void decodeRow(void const *data, size_t width, Pixels const &p, float *dst)
+{
+  auto s = static_cast<typename C::Type const *>(data);
+  for (size_t x = 0; x < width; ++x, s += p.channels, dst += 4) {
+    float c[4] = {0.f, 0.f, 0.f, 1.f};
+    for (size_t i = 0; i < p.channels; ++i)
+      c[i] = p.srgb && i < 3 ? C::decodeSrgb(s[i]) : C::decode(s[i]);
+    if (p.bgr) std::swap(c[0], c[2]);
+    std::memcpy(dst, c, sizeof(c));
+  }
+}
+
+template <typename C>
+void encodeRow(float const *src, size_t width, Pixels const &p, void *data)
+{
+  auto d = static_cast<typename C::Type *>(data);
+  for (size_t x = 0; x < width; ++x, d += p.channels, src += 4) {
+    float c[4];
+    std::memcpy(c, src, sizeof(c));
+    if (p.bgr) std::swap(c[0], c[2]);
+    for (size_t i = 0; i < p.channels; ++i)
+      d[i] = p.srgb && i < 3 ? C::encodeSrgb(c[i]) : C::encode(c[i]);
+  }
+}
+
+#ifdef GEGL_MIPMAP_SSE2
+template <typename C>
+struct Simd {
+  static bool supports(Pixels const &) { return false; }
+  static void decodeRow(void const *, size_t, Pixels const &, float *) {}
+  static void encodeRow(float const *, size_t, Pixels const &, void *) {}
+};
+
+/**
+ * @brief SSE2 conversion of normalized integer channels, sRGB is supported
+ * for 8 bit channels (through tables)
+ */
+template <typename C, int MAX>
+struct SimdUnorm {
+  static bool supports(Pixels const &p)
+  {
+    return !p.srgb || sizeof(typename C::Type) == 1;
+  }
+  static void decodeRow(void const *data, size_t width, Pixels const &p, float *dst)
+  {
+    auto       s     = static_cast<typename C::Type const *>(data);
+    auto const scale = _mm_set1_ps(1.f / static_cast<float>(MAX));
+    auto const zero  = _mm_setzero_si128();
+    auto const &tables = srgbTables();
+    for (size_t x = 0; x < width; ++x, s += p.channels, dst += 4) {
+      if (p.srgb) {
+        float c[4] = {0.f, 0.f, 0.f, 1.f};
+        for (size_t i = 0; i < p.channels; ++i)
+          c[i] = i < 3 ? tables.toLinear[s[i]] : C::decode(s[i]);
+        auto f = _mm_loadu_ps(c);
+        if (p.bgr) f = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 0, 1, 2));
+        _mm_storeu_ps(dst, f);
+        continue;
+      }
+      __m128i i;
+      if (sizeof(typename C::Type) == 1 && p.channels == 4) {
+        int32_t bits;
+        std::memcpy(&bits, s, sizeof(bits));
+        i = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(bits), zero), zero);
+      } else {
+        int32_t v[4] = {0, 0, 0, 0};
+        for (size_t c = 0; c < p.channels; ++c) v[c] = s[c];
+        i = _mm_loadu_si128(reinterpret_cast<__m128i const *>(v));
+      }
+      auto f = _mm_mul_ps(_mm_cvtepi32_ps(i), scale);
+      if (p.bgr) f = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 0, 1, 2));
+      _mm_storeu_ps(dst, f);
+      if (p.channels < 4) dst[3] = 1.f;
+    }
+  }
+  static void encodeRow(float const *src, size_t width, Pixels const &p, void *data)
+  {
+    auto       d     = static_cast<typename C::Type *>(data);
+    auto const zero  = _mm_setzero_ps();
+    auto const one   = _mm_set1_ps(1.f);
+    auto const scale = _mm_set1_ps(static_cast<float>(MAX));
+    auto const lutScale = _mm_set1_ps(65535.f);
+    auto const &tables  = srgbTables();
+    for (size_t x = 0; x < width; ++x, d += p.channels, src += 4) {
+      auto f = _mm_loadu_ps(src);
+      if (p.bgr) f = _mm_shuffle_ps(f, f, _MM_SHUFFLE(3, 0, 1, 2));
+      f = _mm_min_ps(_mm_max_ps(f, zero), one);
+      if (p.srgb) {
+        int32_t index[4], v[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(index),
+                         _mm_cvtps_epi32(_mm_mul_ps(f, lutScale)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(v),
+                         _mm_cvtps_epi32(_mm_mul_ps(f, scale)));
+        for (size_t c = 0; c < p.channels; ++c)
+          d[c] = c < 3 ? tables.fromLinear[index[c]]
+                       : static_cast<typename C::Type>(v[c]);
+        continue;
+      }
+      f      = _mm_mul_ps(f, scale);
+      auto i = _mm_cvtps_epi32(f);
+      if (sizeof(typename C::Type) == 1 && p.channels == 4) {
+        i                  = _mm_packus_epi16(_mm_packs_epi32(i, i), i);
+        int32_t const bits = _mm_cvtsi128_si32(i);
+        std::memcpy(d, &bits, sizeof(bits));
+      } else {
+        int32_t v[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(v), i);
+        for (size_t c = 0; c < p.channels; ++c)
+          d[c] = static_cast<typename C::Type>(v[c]);
+      }
+    }
+  }
+};
+
+template <>
+struct Simd<Unorm8> : SimdUnorm<Unorm8, 255> {
+};
+template <>
+struct Simd<Unorm16> : SimdUnorm<Unorm16, 65535> {
+};
+#endif
+
+/**
+ * @brief Runs fce(begin,end) over row ranges of [0,nofRows) in parallel,
+ * small images are processed by calling thread
+ */
+template <typename FCE>
+void parallelFor(size_t nofThreads, size_t nofRows, size_t rowSize, FCE const &fce)
+{
+  size_t const minPixelsPerThread = 1 << 14;
+  auto const   maxThreads =
+      std::max<size_t>(nofRows * rowSize / minPixelsPerThread, 1);
+  auto const threads = std::min(std::min(nofThreads, maxThreads), nofRows);
+  if (threads <= 1) {
+    fce(size_t(0), nofRows);
+    return;
+  }
+  auto const               chunk = (nofRows + threads - 1) / threads;
+  std::vector<std::thread> workers;
+  for (size_t b = chunk; b < nofRows; b += chunk)
+    workers.emplace_back(fce, b, std::min(b + chunk, nofRows));
+  fce(size_t(0), chunk);
+  for (auto &w : workers) w.join();
+}
+
+/**
+ * @brief Taps of box filter in one direction. Even sizes average 2 texels,
+ * odd sizes (2n+1 -> n) use 3 taps 2x, 2x+1, 2x+2 with weights
+ * (n-x, n, x+1) / (2n+1), so every source texel contributes.
+ */
+struct BoxTaps {
+  size_t index[3];
+  float  weight[3];
+};
+
+BoxTaps boxTaps(size_t size, size_t index)
+{
+  BoxTaps t;
+  for (size_t k = 0; k < 3; ++k) t.index[k] = std::min(2 * index + k, size - 1);
+  if (size % 2 == 0 || size == 1) {
+    t.weight[0] = .5f;
+    t.weight[1] = .5f;
+    t.weight[2] = 0.f;
+    return t;
+  }
+  auto const n     = static_cast<float>(size / 2);
+  auto const x     = static_cast<float>(index);
+  auto const scale = 1.f / (2.f * n + 1.f);
+  t.weight[0]      = (n - x) * scale;
+  t.weight[1]      = n * scale;
+  t.weight[2]      = (x + 1.f) * scale;
+  return t;
+}
+
+bool isBoxOdd(size_t size) { return size % 2 == 1 && size > 1; }
+
+/**
+ * @brief Box filter of levels with odd width or height, 3x3 (3x2, 2x3) taps
+ *
+ * @param simd use SIMD implementation
+ */
+void boxRowsOdd(float const *src,
+                size_t       width,
+                size_t       height,
+                float *      dst,
+                size_t       dstWidth,
+                size_t       begin,
+                size_t       end,
+                bool         simd)
+{
+  std::vector<BoxTaps> columns(dstWidth);
+  for (size_t x = 0; x < dstWidth; ++x) columns[x] = boxTaps(width, x);
+  for (size_t y = begin; y < end; ++y) {
+    auto const row = boxTaps(height, y);
+    auto       d   = dst + 4 * dstWidth * y;
+    for (size_t x = 0; x < dstWidth; ++x, d += 4) {
+      auto const &column = columns[x];
+#ifdef GEGL_MIPMAP_SSE2
+      if (simd) {
+        auto acc = _mm_setzero_ps();
+        for (size_t ky = 0; ky < 3; ++ky) {
+          auto const s = src + 4 * width * row.index[ky];
+          for (size_t kx = 0; kx < 3; ++kx) {
+            auto const w = row.weight[ky] * column.weight[kx];
+            if (w == 0.f) continue;
+            acc          = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(w),
+                                             _mm_loadu_ps(s + 4 * column.index[kx])));
+          }
+        }
+        _mm_storeu_ps(d, acc);
+        continue;
+      }
+#endif
+      float acc[4] = {0.f, 0.f, 0.f, 0.f};
+      for (size_t ky = 0; ky < 3; ++ky) {
+        auto const s = src + 4 * width * row.index[ky];
+        for (size_t kx = 0; kx < 3; ++kx) {
+          auto const w = row.weight[ky] * column.weight[kx];
+          if (w == 0.f) continue;
+          auto const t = s + 4 * column.index[kx];
+          for (size_t c = 0; c < 4; ++c) acc[c] = acc[c] + w * t[c];
+        }
+      }
+      std::memcpy(d, acc, sizeof(acc));
+    }
+  }
+  (void)simd;
+}
+
+void boxRows(float const *src,
+             size_t       width,
+             size_t       height,
+             float *      dst,
+             size_t       dstWidth,
+             size_t       begin,
+             size_t       end)
+{
+  for (size_t y = begin; y < end; ++y) {
+    auto const s0 = src + 4 * width * std::min(2 * y, height - 1);
+    auto const s1 = src + 4 * width * std::min(2 * y + 1, height - 1);
+    auto       d  = dst + 4 * dstWidth * y;
+    for (size_t x = 0; x < dstWidth; ++x, d += 4) {
+      auto const x0 = 4 * std::min(2 * x, width - 1);
+      auto const x1 = 4 * std::min(2 * x + 1, width - 1);
+      for (size_t c = 0; c < 4; ++c)
+        d[c] = ((s0[x0 + c] + s0[x1 + c]) + (s1[x0 + c] + s1[x1 + c])) * .25f;
+    }
+  }
+}
+
+#ifdef GEGL_MIPMAP_SSE2
+void boxRowsSimd(float const *src,
+                 size_t       width,
+                 size_t       height,
+                 float *      dst,
+                 size_t       dstWidth,
+                 size_t       begin,
+                 size_t       end)
+{
+  auto const quarter = _mm_set1_ps(.25f);
+  for (size_t y = begin; y < end; ++y) {
+    auto const s0 = src + 4 * width * std::min(2 * y, height - 1);
+    auto const s1 = src + 4 * width * std::min(2 * y + 1, height - 1);
+    auto       d  = dst + 4 * dstWidth * y;
+    size_t     x  = 0;
+#ifdef GEGL_MIPMAP_AVX
+    auto const quarter8 = _mm256_set1_ps(.25f);
+    for (; 2 * x + 3 < width; x += 2) {
+      auto const a0 = _mm256_loadu_ps(s0 + 8 * x);
+      auto const b0 = _mm256_loadu_ps(s0 + 8 * x + 8);
+      auto const a1 = _mm256_loadu_ps(s1 + 8 * x);
+      auto const b1 = _mm256_loadu_ps(s1 + 8 * x + 8);
+      auto const r0 = _mm256_add_ps(_mm256_permute2f128_ps(a0, b0, 0x20),
+                                    _mm256_permute2f128_ps(a0, b0, 0x31));
+      auto const r1 = _mm256_add_ps(_mm256_permute2f128_ps(a1, b1, 0x20),
+                                    _mm256_permute2f128_ps(a1, b1, 0x31));
+      _mm256_storeu_ps(d + 4 * x,
+                       _mm256_mul_ps(_mm256_add_ps(r0, r1), quarter8));
+    }
+#endif
+    for (; x < dstWidth; ++x) {
+      auto const x0 = 4 * std::min(2 * x, width - 1);
+      auto const x1 = 4 * std::min(2 * x + 1, width - 1);
+      auto const r0 = _mm_add_ps(_mm_loadu_ps(s0 + x0), _mm_loadu_ps(s0 + x1));
+      auto const r1 = _mm_add_ps(_mm_loadu_ps(s1 + x0), _mm_loadu_ps(s1 + x1));
+      _mm_storeu_ps(d + 4 * x, _mm_mul_ps(_mm_add_ps(r0, r1), quarter));
+    }
+  }
+}
+#endif
+
+/**
+ * @brief Computes one texel of separable Kaiser filter in one direction
+ *
+ * @param src first source texel of filtered line
+ * @param stride distance between source texels of line in texels
+ * @param size number of source texels of line
+ * @param index index of destination texel, it is centered at 2*index+0.5
+ * @param weights weights of taps
+ * @param simd use SIMD implementation
+ * @param dst destination texel
+ */
+void kaiserTexel(float const *             src,
+                 size_t                    stride,
+                 size_t                    size,
+                 size_t                    index,
+                 std::vector<float> const &weights,
+                 bool                      simd,
+                 float *                   dst)
+{
+  auto const nofTaps = static_cast<ptrdiff_t>(weights.size());
+  auto const last    = static_cast<ptrdiff_t>(size) - 1;
+  auto const first   = 2 * static_cast<ptrdiff_t>(index) - 2;
+#ifdef GEGL_MIPMAP_SSE2
+  if (simd) {
+    auto acc = _mm_setzero_ps();
+    for (ptrdiff_t k = 0; k < nofTaps; ++k) {
+      auto const i = std::min(std::max(first + k, ptrdiff_t(0)), last);
+      acc          = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(weights[k]),
+                                       _mm_loadu_ps(src + 4 * stride * i)));
+    }
+    _mm_storeu_ps(dst, acc);
+    return;
+  }
+#endif
+  (void)simd;
+  float acc[4] = {0.f, 0.f, 0.f, 0.f};
+  for (ptrdiff_t k = 0; k < nofTaps; ++k) {
+    auto const i = std::min(std::max(first + k, ptrdiff_t(0)), last);
+    auto const s = src + 4 * stride * i;
+    for (size_t c = 0; c < 4; ++c) acc[c] = acc[c] + weights[k] * s[c];
+  }
+  std::memcpy(dst, acc, sizeof(acc));
+}
+
+double besselI0(double x)
+{
+  double sum = 1., term = 1.;
+  for (int k = 1; k < 32; ++k) {
+    term *= (x / (2. * k)) * (x / (2. * k));
+    sum += term;
+  }
+  return sum;
+}
+}  // namespace
+
+/**
+ * @brief Constructor
+ *
+ * @param filter downsampling filter
+ * @param srgb color channels of source and destination are sRGB encoded,
+ * they are averaged in linear space
+ * @param nofThreads number of threads, 0 - hardware concurrency
+ */
+MipmapGenerator::MipmapGenerator(Filter filter, bool srgb, size_t nofThreads)
+    : filter(filter), srgb(srgb), nofThreads(nofThreads)
+{
+  if (this->nofThreads == 0)
+    this->nofThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  // taps -2..3 around 2x+0.5, sinc of destination texel units, window radius 1.5
+  double const beta = 4.;
+  double       sum  = 0.;
+  std::vector<double> w;
+  for (int k = -2; k <= 3; ++k) {
+    auto const u      = (k - .5) / 2.;
+    auto const pu     = 3.14159265358979323846 * u;
+    auto const sinc   = u == 0. ? 1. : std::sin(pu) / pu;
+    auto const r      = u / 1.5;
+    auto const window = besselI0(beta * std::sqrt(std::max(1. - r * r, 0.))) /
+                        besselI0(beta);
+    w.push_back(sinc * window);
+    sum += w.back();
+  }
+  for (auto const v : w) kaiserWeights.push_back(static_cast<float>(v / sum));
+}
+
+/**
+ * @brief Builds mipmap chain of 2D image
+ *
+ * @param data tightly packed source pixels
+ * @param width width of image
+ * @param height height of image
+ * @param format format of source pixels
+ * @param type type of source channels
+ * @param dstFormat format of levels
+ * @param dstType type of channels of levels
+ * @param nofLevels number of levels, 0 - full chain
+ *
+ * @return levels, level 0 is converted source image
+ */
+std::vector<MipmapGenerator::Level> MipmapGenerator::generate(
+    void const *data,
+    GLsizei     width,
+    GLsizei     height,
+    GLenum      format,
+    GLenum      type,
+    GLenum      dstFormat,
+    GLenum      dstType,
+    GLsizei     nofLevels) const
+{
+  assert(this != nullptr);
+  auto const maxLevels = computeNofLevels(width, height);
+  if (nofLevels <= 0 || nofLevels > maxLevels) nofLevels = maxLevels;
+  std::vector<Level> levels(static_cast<size_t>(nofLevels));
+  Image              image;
+  decode(data, width, height, format, type, image);
+  if (format == dstFormat && type == dstType) {
+    levels[0].width  = width;
+    levels[0].height = height;
+    auto const size  = getImageSize(format, type, width, height, 1, 1);
+    auto const bytes = static_cast<uint8_t const *>(data);
+    levels[0].data.assign(bytes, bytes + size);
+  } else
+    encode(image, width, height, dstFormat, dstType, levels[0]);
+
+  Image next;
+  for (size_t l = 1; l < levels.size(); ++l) {
+    auto const w = std::max(width / 2, 1);
+    auto const h = std::max(height / 2, 1);
+    downsample(image, width, height, next, w, h);
+    encode(next, w, h, dstFormat, dstType, levels[l]);
+    std::swap(image, next);
+    width  = w;
+    height = h;
+  }
+  return levels;
+}
+
+/**
+ * @brief Converts 2D image into other format and type
+ *
+ * @param data tightly packed source pixels
+ * @param width width of image
+ * @param height height of image
+ * @param format format of source pixels
+ * @param type type of source channels
+ * @param dstFormat format of result
+ * @param dstType type of channels of result
+ *
+ * @return converted image
+ */
+MipmapGenerator::Level MipmapGenerator::convert(void const *data,
+                                                GLsizei     width,
+                                                GLsizei     height,
+                                                GLenum      format,
+                                                GLenum      type,
+                                                GLenum      dstFormat,
+                                                GLenum      dstType) const
+{
+  assert(this != nullptr);
+  Image image;
+  decode(data, width, height, format, type, image);
+  Level level;
+  encode(image, width, height, dstFormat, dstType, level);
+  return level;
+}
+
+/**
+ * @brief Selects implementation, it is meant for benchmarks and tests
+ *
+ * @param implementation implementation
+ */
+void MipmapGenerator::setImplementation(Implementation implementation)
+{
+  this->implementation = implementation;
+}
+
+MipmapGenerator::Implementation MipmapGenerator::getImplementation() const
+{
+  return implementation;
+}
+
+MipmapGenerator::Filter MipmapGenerator::getFilter() const { return filter; }
+
+bool MipmapGenerator::isSrgb() const { return srgb; }
+
+size_t MipmapGenerator::getNofThreads() const { return nofThreads; }
+
+/**
+ * @brief Returns true if library is compiled with SIMD path
+ *
+ * @return true if SIMD implementation is available
+ */
+bool MipmapGenerator::isSimdAvailable()
+{
+#ifdef GEGL_MIPMAP_SSE2
+  return true;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @brief Computes number of levels of full mipmap chain
+ *
+ * @param width width of level 0
+ * @param height height of level 0
+ *
+ * @return number of levels
+ */
+GLsizei MipmapGenerator::computeNofLevels(GLsizei width, GLsizei height)
+{
+  GLsizei levels = 1;
+  while ((std::max(width, height) >> levels) > 0) levels++;
+  return levels;
+}
+
+/**
+ * @brief Decodes pixels into linear float RGBA
+ */
+void MipmapGenerator::decode(void const *data,
+                             GLsizei     width,
+                             GLsizei     height,
+                             GLenum      format,
+                             GLenum      type,
+                             Image &     image) const
+{
+  if (!data || width <= 0 || height <= 0)
+    throw std::invalid_argument(
+        "geGL: MipmapGenerator - image has to have data and positive size");
+  Pixels const p{getNofChannels(format), isBgr(format), srgb};
+  auto const   w       = static_cast<size_t>(width);
+  auto const   h       = static_cast<size_t>(height);
+  auto const   rowSize = getImageSize(format, type, width, 1, 1, 1);
+  image.resize(4 * w * h);
+  auto const bytes = static_cast<uint8_t const *>(data);
+  auto const simd  = useSimd();
+  dispatchType(type, [&](auto codec) {
+    using C = decltype(codec);
+    parallelFor(nofThreads, h, w, [&](size_t begin, size_t end) {
+      for (size_t y = begin; y < end; ++y) {
+#ifdef GEGL_MIPMAP_SSE2
+        if (simd && Simd<C>::supports(p)) {
+          Simd<C>::decodeRow(bytes + rowSize * y, w, p, &image[4 * w * y]);
+          continue;
+        }
+#endif
+        decodeRow<C>(bytes + rowSize * y, w, p, &image[4 * w * y]);
+      }
+    });
+  });
+  (void)simd;
+}
+
+/**
+ * @brief Encodes linear float RGBA into level
+ */
+void MipmapGenerator::encode(Image const &image,
+                             GLsizei      width,
+                             GLsizei      height,
+                             GLenum       format,
+                             GLenum       type,
+                             Level &      level) const
+{
+  Pixels const p{getNofChannels(format), isBgr(format), srgb};
+  auto const   w       = static_cast<size_t>(width);
+  auto const   h       = static_cast<size_t>(height);
+  auto const   rowSize = getImageSize(format, type, width, 1, 1, 1);
+  level.width          = width;
+  level.height         = height;
+  level.data.resize(rowSize * h);
+  auto const simd = useSimd();
+  dispatchType(type, [&](auto codec) {
+    using C = decltype(codec);
+    parallelFor(nofThreads, h, w, [&](size_t begin, size_t end) {
+      for (size_t y = begin; y < end; ++y) {
+#ifdef GEGL_MIPMAP_SSE2
+        if (simd && Simd<C>::supports(p)) {
+          Simd<C>::encodeRow(&image[4 * w * y], w, p,
+                             level.data.data() + rowSize * y);
+          continue;
+        }
+#endif
+        encodeRow<C>(&image[4 * w * y], w, p, level.data.data() + rowSize * y);
+      }
+    });
+  });
+  (void)simd;
+}
+
+/**
+ * @brief Filters float RGBA level into next level
+ */
+void MipmapGenerator::downsample(Image const &src,
+                                 GLsizei      width,
+                                 GLsizei      height,
+                                 Image &      dst,
+                                 GLsizei      dstWidth,
+                                 GLsizei      dstHeight) const
+{
+  auto const w    = static_cast<size_t>(width);
+  auto const h    = static_cast<size_t>(height);
+  auto const dw   = static_cast<size_t>(dstWidth);
+  auto const dh   = static_cast<size_t>(dstHeight);
+  auto const simd = useSimd();
+  dst.resize(4 * dw * dh);
+  if (filter == BOX) {
+    parallelFor(nofThreads, dh, 4 * dw, [&](size_t begin, size_t end) {
+      if (isBoxOdd(w) || isBoxOdd(h)) {
+        boxRowsOdd(src.data(), w, h, dst.data(), dw, begin, end, simd);
+        return;
+      }
+#ifdef GEGL_MIPMAP_SSE2
+      if (simd) {
+        boxRowsSimd(src.data(), w, h, dst.data(), dw, begin, end);
+        return;
+      }
+#endif
+      boxRows(src.data(), w, h, dst.data(), dw, begin, end);
+    });
+    return;
+  }
+  Image rows(4 * dw * h);
+  parallelFor(nofThreads, h, 6 * dw, [&](size_t begin, size_t end) {
+    for (size_t y = begin; y < end; ++y)
+      for (size_t x = 0; x < dw; ++x)
+        kaiserTexel(&src[4 * w * y], 1, w, x, kaiserWeights, simd,
+                    &rows[4 * (dw * y + x)]);
+  });
+  parallelFor(nofThreads, dh, 6 * dw, [&](size_t begin, size_t end) {
+    for (size_t y = begin; y < end; ++y)
+      for (size_t x = 0; x < dw; ++x)
+        kaiserTexel(&rows[4 * x], dw, h, y, kaiserWeights, simd,
+                    &dst[4 * (dw * y + x)]);
+  });
+}
+
+bool MipmapGenerator::useSimd() const
+{
+  return implementation == SIMD && isSimdAvailable();
+}
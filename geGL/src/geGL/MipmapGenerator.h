@@ -0,0 +1,105 @@
+#pragma once
+
+#include <geGL/OpenGL.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Builds mipmap chains and converts pixel formats on CPU.
+ * It does not touch OpenGL, it only uses OpenGL enums to describe pixels.
+ *
+ * Source pixels are decoded into linear float RGBA (RGB/BGR sources are
+ * swizzled and expanded with alpha 1, sRGB color channels are linearized),
+ * levels are filtered in float and encoded into destination format and type.
+ * Filtering is separable: BOX averages 2x2 texels, KAISER uses 6 tap
+ * Kaiser-windowed sinc. Odd sizes are rounded down, BOX then uses 3 taps
+ * with polyphase weights in that direction, so every source texel
+ * contributes to the smaller level.
+ * Float RGBA texel fits one SSE register, SSE2 (AVX if compiler targets it)
+ * path is used when available, SCALAR path is reference implementation.
+ * Rows of every level are split among nofThreads threads.
+ *
+ * Supported formats: GL_RED, GL_RG, GL_RGB, GL_BGR, GL_RGBA, GL_BGRA.
+ * Supported types: GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_HALF_FLOAT,
+ * GL_FLOAT. Rows are tightly packed (alignment 1).
+ *
+ * @code
+ * MipmapGenerator generator(MipmapGenerator::BOX,true);
+ * auto const levels = generator.generate(bits,width,height,GL_BGR,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+ * for(size_t l=0;l<levels.size();++l)
+ *   texture.setData2D(levels[l].data.data(),GL_RGBA,GL_UNSIGNED_BYTE,(GLint)l);
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::MipmapGenerator {
+ public:
+  enum Filter {
+    BOX,     ///< 2x2 average, 3 taps along odd sizes
+    KAISER,  ///< Kaiser-windowed sinc, sharper minification
+  };
+  enum Implementation {
+    SCALAR,  ///< reference implementation
+    SIMD,    ///< SSE2 / AVX, falls back to SCALAR if it is not available
+  };
+  /**
+   * @brief One mipmap level, data are tightly packed
+   */
+  struct Level {
+    GLsizei              width  = 0;
+    GLsizei              height = 0;
+    std::vector<uint8_t> data;
+  };
+  MipmapGenerator(Filter filter     = BOX,
+                  bool   srgb       = false,
+                  size_t nofThreads = 0);
+  std::vector<Level> generate(void const* data,
+                              GLsizei     width,
+                              GLsizei     height,
+                              GLenum      format,
+                              GLenum      type,
+                              GLenum      dstFormat,
+                              GLenum      dstType,
+                              GLsizei     nofLevels = 0) const;
+  Level              convert(void const* data,
+                             GLsizei     width,
+                             GLsizei     height,
+                             GLenum      format,
+                             GLenum      type,
+                             GLenum      dstFormat,
+                             GLenum      dstType) const;
+  void               setImplementation(Implementation implementation);
+  Implementation     getImplementation() const;
+  Filter             getFilter() const;
+  bool               isSrgb() const;
+  size_t             getNofThreads() const;
+
+  static bool    isSimdAvailable();
+  static GLsizei computeNofLevels(GLsizei width, GLsizei height);
+
+ protected:
+  using Image = std::vector<float>;  ///< float RGBA texels
+  void decode(void const* data,
+              GLsizei     width,
+              GLsizei     height,
+              GLenum      format,
+              GLenum      type,
+              Image&      image) const;
+  void encode(Image const& image,
+              GLsizei      width,
+              GLsizei      height,
+              GLenum       format,
+              GLenum       type,
+              Level&       level) const;
+  void downsample(Image const& src,
+                  GLsizei      width,
+                  GLsizei      height,
+                  Image&       dst,
+                  GLsizei      dstWidth,
+                  GLsizei      dstHeight) const;
+  bool               useSimd() const;
+  Filter             filter;
+  bool               srgb;
+  size_t             nofThreads;
+  Implementation     implementation = SIMD;
+  std::vector<float> kaiserWeights;  ///< weights of taps -2..3 around 2x+0.5
+};
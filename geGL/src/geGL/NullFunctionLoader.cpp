@@ -0,0 +1,53 @@
+#include<geGL/NullFunctionLoader.h>
+#include<geGL/private/NullContext.h>
+#include<map>
+#include<string>
+
+using namespace ge::gl;
+
+namespace{
+  struct NullFunctions{
+#include<geGL/Generated/NullImplementation.h>
+  };
+#include<geGL/Generated/NullLoadingCalls.h>
+
+  std::map<std::string,FUNCTION_POINTER>const&getNullFunctions(){
+    static std::map<std::string,FUNCTION_POINTER>functions;
+    if(functions.empty()){
+      size_t const n = sizeof(functionNames)/sizeof(functionNames[0]);
+      for(size_t i=0;i<n;++i)
+        functions[functionNames[i]] = functionPointers[i];
+    }
+    return functions;
+  }
+}
+
+NullFunctionLoader::NullFunctionLoader():m_context(new NullContext()){
+  makeCurrent();
+}
+
+NullFunctionLoader::~NullFunctionLoader(){}
+
+/**
+ * @brief This function loads OpenGL function using its name.
+ * Function modelled by null context is preferred, no-op is returned otherwise.
+ *
+ * @param fceName function name of OpenGL fuction ("glUseProgram", ...)
+ *
+ * @return function pointer, nullptr for unknown names
+ */
+FUNCTION_POINTER NullFunctionLoader::load(char const*fceName)const{
+  auto const modelled = NullContext::getFunction(fceName);
+  if(modelled)return modelled;
+  auto const&functions = getNullFunctions();
+  auto const it = functions.find(fceName);
+  if(it == functions.end())return nullptr;
+  return it->second;
+}
+
+/**
+ * @brief makes context of this loader current in calling thread
+ */
+void NullFunctionLoader::makeCurrent()const{
+  NullContext::current() = m_context.get();
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include<geGL/gegl_export.h>
+#include<geGL/FunctionLoaderInterface.h>
+#include<memory>
+
+namespace ge{
+  namespace gl{
+    class NullContext;
+    /**
+     * @brief Function loader that does not need GPU nor OpenGL driver.
+     * Every OpenGL function is loaded.
+     * Most of them do nothing and return zero,
+     * the rest is implemented on top of CPU-side object model (see private/NullContext.h):
+     * object names, buffer storage in host memory, vertex arrays,
+     * texture and sampler parameters, shader and program reflection of plain uniforms and vertex inputs,
+     * fences, queries and glGet* limits and bindings.
+     *
+     * Each loader owns one null context.
+     * Like real OpenGL context, it has to be current in thread that calls OpenGL functions.
+     * Loader makes its context current during construction.
+     */
+    class GEGL_EXPORT NullFunctionLoader: public FunctionLoaderInterface{
+      public:
+        NullFunctionLoader();
+        ~NullFunctionLoader();
+        virtual FUNCTION_POINTER load(char const*fceName)const override;
+        void makeCurrent()const;
+      protected:
+        std::unique_ptr<NullContext>m_context;
+    };
+  }
+}
@@ -2,17 +2,49 @@
 
 #include<geGL/OpenGLFunctionTable.h>
 #include<geGL/LoaderTableDecorator.h>
+#include<geGL/BindingTrackerTableDecorator.h>
 #include<geGL/DSATableDecorator.h>
 #include<geGL/CapabilitiesTableDecorator.h>
 #include<geGL/TrapTableDecorator.h>
+#include<geGL/StateCacheTableDecorator.h>
+#include<geGL/ProfilingTableDecorator.h>
+#include<geGL/CaptureTableDecorator.h>
 #include<geGL/OpenGLCapabilities.h>
 #include<geGL/OpenGLContext.h>
+#include<geGL/DirectContext.h>
 
 thread_local ge::gl::FunctionTablePointer _defaultOpenGLFunctionTable = nullptr;
 thread_local ge::gl::ContextPointer       _defaultOpenGLContext       = nullptr;
 
 using namespace ge::gl;
 
+#if defined(GEGL_STATIC_DISPATCH)
+thread_local std::unique_ptr<DirectContext>   _defaultDirectContextOwner = nullptr;
+thread_local DirectContext const*ge::gl::_defaultDirectContext           = nullptr;
+
+#if defined(_WIN32)
+DirectContext const&ge::gl::getDefaultDirectContext(){
+  assert(_defaultDirectContext!=nullptr);
+  return *_defaultDirectContext;
+}
+#endif
+#endif
+
+namespace{
+  /**
+   * @brief Takes snapshot of default context for static dispatch of free functions
+   */
+  void updateDefaultDirectContext(){
+#if defined(GEGL_STATIC_DISPATCH)
+    if(_defaultOpenGLContext && _defaultOpenGLContext->getFunctionTable())
+      _defaultDirectContextOwner = std::unique_ptr<DirectContext>(new DirectContext(_defaultOpenGLContext->getFunctionTable()));
+    else
+      _defaultDirectContextOwner = nullptr;
+    _defaultDirectContext = _defaultDirectContextOwner.get();
+#endif
+  }
+}
+
 /**
  * @brief Function returns default, global OpenGLFunctionTable
  *
@@ -40,6 +72,7 @@ void ge::gl::setDefaultFunctionTable   (FunctionTablePointer    const&table   ){
   _defaultOpenGLFunctionTable = table;
   if(_defaultOpenGLContext)
     _defaultOpenGLContext->setFunctionTable(table);
+  updateDefaultDirectContext();
 }
 
 /**
@@ -49,25 +82,118 @@ void ge::gl::setDefaultFunctionTable   (FunctionTablePointer    const&table   ){
  */
 void ge::gl::setDefaultContext(ContextPointer const&provider){
   _defaultOpenGLContext = provider;
+  updateDefaultDirectContext();
+}
+
+namespace{
+  template<typename TABLE>
+    std::shared_ptr<FunctionTable>createCapturedTable(
+        FunctionLoaderInterfacePointer const&loader,
+        std::shared_ptr<CaptureWriter> const&writer,
+        uint32_t                             flags ){
+      bool const lazyLoading = (flags & LAZY_LOADING_TABLE) != 0;
+      if(writer)
+        return std::make_shared<CaptureTableDecorator<TABLE>>(writer,loader,lazyLoading);
+      return std::make_shared<TABLE>(loader,lazyLoading);
+    }
+  template<typename TABLE>
+    std::shared_ptr<FunctionTable>createCachedTable(
+        FunctionLoaderInterfacePointer const&loader,
+        std::shared_ptr<CaptureWriter> const&writer,
+        uint32_t                             flags ){
+      if(flags & STATE_CACHE_TABLE)
+        return createCapturedTable<StateCacheTableDecorator<TABLE>>(loader,writer,flags);
+      return createCapturedTable<TABLE>(loader,writer,flags);
+    }
+  FunctionTablePointer createDecoratedTable(
+      FunctionLoaderInterfacePointer const&loader,
+      std::shared_ptr<CaptureWriter> const&writer,
+      uint32_t                             flags ){
+    using DefaultTable =
+      TrapTableDecorator<
+      CapabilitiesTableDecorator<
+      DSATableDecorator<
+      BindingTrackerTableDecorator<
+      LoaderTableDecorator<
+      FunctionTable>>>>>;
+    std::shared_ptr<FunctionTable>table;
+#if defined(GEGL_PROFILING)
+    if(flags & PROFILING_TABLE)
+      table = createCachedTable<ProfilingTableDecorator<DefaultTable>>(loader,writer,flags);
+    else
+#endif
+      table = createCachedTable<DefaultTable>(loader,writer,flags);
+    table->construct();
+    return table;
+  }
 }
 
 /**
  * @brief Function creates OpenGL function table
- * Function table is decorated using LoaderTableDecorator, DSATableDecorator, CapabilitiesTableDecorator and TrapTableDecorator
+ * Function table is decorated using LoaderTableDecorator, BindingTrackerTableDecorator, DSATableDecorator, CapabilitiesTableDecorator and TrapTableDecorator
+ * Flag PROFILING_TABLE adds ProfilingTableDecorator on top of them
+ * Flag STATE_CACHE_TABLE adds StateCacheTableDecorator on top of them, so only calls that reach driver are profiled
+ * Flag LAZY_LOADING_TABLE defers loading of each function to its first use, it shortens creation of table
+ *
+ * @param loader valid FunctionLoaderInterface that can load OpenGL functions
+ * @param flags combination of TableFlags
+ *
+ * @return OpenGLFunctionTable
+ */
+FunctionTablePointer ge::gl::createTable(FunctionLoaderInterfacePointer const&loader,uint32_t flags){
+  return createDecoratedTable(loader,nullptr,flags);
+}
+
+/**
+ * @brief Function creates OpenGL function table that captures calls
+ * CaptureTableDecorator is placed on top of table created by createTable,
+ * so capture contains calls of application, not calls that reach driver.
+ * Capture can be replayed using replayCapture.
  *
  * @param loader valid FunctionLoaderInterface that can load OpenGL functions
+ * @param writer capture writer
+ * @param flags combination of TableFlags
  *
  * @return OpenGLFunctionTable
  */
-FunctionTablePointer ge::gl::createTable(FunctionLoaderInterfacePointer const&loader){
-  auto table = std::make_shared<
-    TrapTableDecorator<
-    CapabilitiesTableDecorator<
-    DSATableDecorator<
-    LoaderTableDecorator<
-    FunctionTable>>>>>(loader);
-  table->construct();
-  return table;
+FunctionTablePointer ge::gl::createCaptureTable(FunctionLoaderInterfacePointer const&loader,std::shared_ptr<CaptureWriter>const&writer,uint32_t flags){
+  assert(writer != nullptr);
+  return createDecoratedTable(loader,writer,flags);
+}
+
+/**
+ * @brief Function forgets OpenGL state shadowed by function table
+ * It should be called after OpenGL state was changed outside of geGL (third-party libraries, ...).
+ * It also forgets bindings tracked for emulated DSA functions.
+ *
+ * @param table FunctionTable
+ */
+void ge::gl::invalidateStateCache(FunctionTablePointer const&table){
+  auto const cache = std::dynamic_pointer_cast<StateCacheInterface const>(table);
+  if(!cache)return;
+  cache->invalidate();
+}
+
+/**
+ * @brief Function returns profiling interface of function table
+ *
+ * @param table FunctionTable
+ *
+ * @return profiling interface or nullptr if table was not created with PROFILING_TABLE flag
+ */
+ProfilingInterface const*ge::gl::getProfiling(FunctionTablePointer const&table){
+  return dynamic_cast<ProfilingInterface const*>(table.get());
+}
+
+/**
+ * @brief Function returns binding tracker interface of function table
+ *
+ * @param table FunctionTable
+ *
+ * @return binding tracker interface or nullptr if table does not track bindings
+ */
+BindingTrackerInterface const*ge::gl::getBindingTracker(FunctionTablePointer const&table){
+  return dynamic_cast<BindingTrackerInterface const*>(table.get());
 }
 
 /**
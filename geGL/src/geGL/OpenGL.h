@@ -14,11 +14,21 @@
 
 namespace ge{
   namespace gl{
+    enum TableFlags{
+      DEFAULT_TABLE      = 0u     ,///< loader, binding tracker, DSA emulation, capabilities and trap decorators
+      STATE_CACHE_TABLE  = 1u<<0u,///< StateCacheTableDecorator drops redundant binds and state changes
+      PROFILING_TABLE    = 1u<<1u,///< ProfilingTableDecorator counts calls, it is ignored if geGL is built without GEGL_PROFILING
+      LAZY_LOADING_TABLE = 1u<<2u,///< functions are loaded during their first call (or availability query) instead of table creation
+    };
     GEGL_EXPORT FunctionTablePointer const& getDefaultFunctionTable();
     GEGL_EXPORT ContextPointer       const& getDefaultContext      ();
     GEGL_EXPORT void setDefaultFunctionTable(FunctionTablePointer const&table   );
     GEGL_EXPORT void setDefaultContext      (ContextPointer       const&provider);
-    GEGL_EXPORT FunctionTablePointer createTable(FunctionLoaderInterfacePointer const&loader);
+    GEGL_EXPORT FunctionTablePointer createTable(FunctionLoaderInterfacePointer const&loader,uint32_t flags = DEFAULT_TABLE);
+    GEGL_EXPORT FunctionTablePointer createCaptureTable(FunctionLoaderInterfacePointer const&loader,std::shared_ptr<CaptureWriter>const&writer,uint32_t flags = DEFAULT_TABLE);
+    GEGL_EXPORT void invalidateStateCache(FunctionTablePointer const&table);
+    GEGL_EXPORT ProfilingInterface const*getProfiling(FunctionTablePointer const&table);
+    GEGL_EXPORT BindingTrackerInterface const*getBindingTracker(FunctionTablePointer const&table);
     GEGL_EXPORT ContextPointer createContext(FunctionTablePointer const&table = nullptr);
   }
 }
@@ -18,6 +18,27 @@ namespace ge{
           return this->m_init();
         }
         virtual bool m_init(){return true;}
+        /**
+         * @brief Returns true if OpenGL function is available.
+         * Decorators use it instead of comparison of m_ptr_* with nullptr,
+         * so lazily loaded functions are resolved during the query.
+         *
+         * @param member m_ptr_* member of function
+         */
+        template<typename MEMBER_PFN>
+          bool m_isAvailable(MEMBER_PFN const&member)const{
+            return this->m_resolve((MEMBER_FUNCTION_POINTER const*)&member);
+          }
+        virtual bool m_resolve(MEMBER_FUNCTION_POINTER const*member)const{return *member != nullptr;}
+        /**
+         * @brief Returns loaded function if its calls are not decorated.
+         * DirectContext calls such functions without function table.
+         *
+         * @param index index of function (order of generated functions)
+         *
+         * @return loaded function or nullptr if function is decorated or not loaded
+         */
+        virtual FUNCTION_POINTER getDirectFunction(size_t index)const{(void)index;return nullptr;}
 #include<geGL/Generated/FunctionTableCalls.h>
 #include<geGL/Generated/OpenGLPFN.h>
 #include<geGL/Generated/OpenGLFunctions.h>
@@ -564,6 +564,73 @@ unsigned ge::gl::getTypeSize(GLenum type){
   }
 }
 
+/**
+ * @brief This function returns size of one pixel of client image data
+ *
+ * @param format pixel format (GL_RGBA, GL_RED_INTEGER, GL_DEPTH_COMPONENT, ...)
+ * @param type pixel type (GL_UNSIGNED_BYTE, GL_FLOAT, GL_UNSIGNED_INT_2_10_10_10_REV, ...)
+ *
+ * @return size of pixel in bytes
+ */
+size_t ge::gl::getPixelSize(GLenum format,GLenum type){
+  switch(type){
+    case GL_UNSIGNED_BYTE_3_3_2              :
+    case GL_UNSIGNED_BYTE_2_3_3_REV          :return 1;
+    case GL_UNSIGNED_SHORT_5_6_5             :
+    case GL_UNSIGNED_SHORT_5_6_5_REV         :
+    case GL_UNSIGNED_SHORT_4_4_4_4           :
+    case GL_UNSIGNED_SHORT_4_4_4_4_REV       :
+    case GL_UNSIGNED_SHORT_5_5_5_1           :
+    case GL_UNSIGNED_SHORT_1_5_5_5_REV       :return 2;
+    case GL_UNSIGNED_INT_8_8_8_8             :
+    case GL_UNSIGNED_INT_8_8_8_8_REV         :
+    case GL_UNSIGNED_INT_10_10_10_2          :
+    case GL_UNSIGNED_INT_2_10_10_10_REV      :
+    case GL_UNSIGNED_INT_24_8                :
+    case GL_UNSIGNED_INT_10F_11F_11F_REV     :
+    case GL_UNSIGNED_INT_5_9_9_9_REV         :return 4;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV   :return 8;
+    default                                  :break;
+  }
+  size_t nofChannels = 1;
+  switch(format){
+    case GL_RG            :
+    case GL_RG_INTEGER    :
+    case GL_DEPTH_STENCIL :nofChannels = 2;break;
+    case GL_RGB           :
+    case GL_BGR           :
+    case GL_RGB_INTEGER   :
+    case GL_BGR_INTEGER   :nofChannels = 3;break;
+    case GL_RGBA          :
+    case GL_BGRA          :
+    case GL_RGBA_INTEGER  :
+    case GL_BGRA_INTEGER  :nofChannels = 4;break;
+    default               :nofChannels = 1;break;
+  }
+  return nofChannels*getTypeSize(type);
+}
+
+/**
+ * @brief This function returns number of bytes that OpenGL reads from client image data
+ * Rows are aligned to alignment (GL_UNPACK_ALIGNMENT), last row is not padded.
+ *
+ * @param format pixel format
+ * @param type pixel type
+ * @param width width of image
+ * @param height height of image
+ * @param depth depth of image
+ * @param alignment row alignment
+ *
+ * @return size of image in bytes
+ */
+size_t ge::gl::getImageSize(GLenum format,GLenum type,GLsizei width,GLsizei height,GLsizei depth,GLint alignment){
+  if(width <= 0 || height <= 0 || depth <= 0)return 0;
+  auto const rowSize = getPixelSize(format,type)*(size_t)width;
+  auto const a       = (size_t)(alignment > 0 ? alignment : 1);
+  auto const stride  = (rowSize+a-1)/a*a;
+  return stride*((size_t)height*(size_t)depth-1)+rowSize;
+}
+
 bool ge::gl::isSamplerType(GLenum type){
   switch(type){
     case GL_SAMPLER_1D                               :
@@ -93,6 +93,8 @@ namespace ge{
     GEGL_EXPORT std::string translateAttribType(GLenum    type   );
     GEGL_EXPORT std::string translateBoolean   (GLboolean boolean);
     GEGL_EXPORT unsigned    getTypeSize        (GLenum    type   );
+    GEGL_EXPORT size_t      getPixelSize       (GLenum    format,GLenum type);
+    GEGL_EXPORT size_t      getImageSize       (GLenum    format,GLenum type,GLsizei width,GLsizei height = 1,GLsizei depth = 1,GLint alignment = 4);
 
     GEGL_EXPORT std::string translateUniformType      (GLenum      type    );
     GEGL_EXPORT std::string translateBufferProperty   (GLenum      property);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include<cstdint>
+#include<string>
+#include<vector>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Call statistics of one OpenGL function
+     */
+    struct FunctionProfile{
+      std::string name       ;///< name of OpenGL function
+      uint64_t    calls      ;///< number of calls
+      uint64_t    nanoseconds;///< time spent inside of function, it is measured only when timing is enabled
+    };
+
+    /**
+     * @brief Interface of function tables that count OpenGL calls
+     * Call counters are updated atomically and frame counters are guarded by mutex,
+     * so table, nextFrame, resetProfile and getProfile can be used from several threads.
+     */
+    class ProfilingInterface{
+      public:
+        enum Order{
+          BY_CALLS,///< profiles are sorted by number of calls
+          BY_TIME ,///< profiles are sorted by time spent inside of function
+        };
+        enum Range{
+          TOTAL     ,///< calls since creation of table or since last reset
+          LAST_FRAME,///< calls between last two nextFrame calls
+        };
+        virtual ~ProfilingInterface(){}
+        /**
+         * @brief This function enables or disables measuring of time using steady_clock.
+         * Timing is disabled by default, calls are always counted.
+         *
+         * @param enabled true enables timing
+         */
+        virtual void setTiming(bool enabled)const = 0;
+        /**
+         * @brief This function marks end of frame.
+         * Calls since previous nextFrame are available as LAST_FRAME range.
+         */
+        virtual void nextFrame()const = 0;
+        /**
+         * @brief This function resets all counters.
+         */
+        virtual void resetProfile()const = 0;
+        /**
+         * @brief This function returns statistics of called functions.
+         *
+         * @param n maximal number of returned functions (top-N), 0 means all
+         * @param order sorting of functions
+         * @param range TOTAL or LAST_FRAME
+         *
+         * @return profiles of called functions, functions without calls are omitted
+         */
+        virtual std::vector<FunctionProfile>getProfile(size_t n = 0,Order order = BY_CALLS,Range range = TOTAL)const = 0;
+    };
+  }
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include<algorithm>
+#include<array>
+#include<atomic>
+#include<chrono>
+#include<mutex>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/ProfilingInterface.h>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator counts calls of every loaded OpenGL function
+     * and optionally measures time spent inside of them.
+     * It should be placed on top of TrapTableDecorator,
+     * so missing functions are not counted and emulated functions are counted with the calls they emulate.
+     */
+    template<typename T>
+      class ProfilingTableDecorator: public T, public virtual ProfilingInterface{
+        public:
+          template<typename...ARGS>
+            ProfilingTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~ProfilingTableDecorator(){}
+          virtual void setTiming(bool enabled)const override{
+            assert(this!=nullptr);
+            this->m_timing.store(enabled,std::memory_order_relaxed);
+          }
+          virtual void nextFrame()const override{
+            assert(this!=nullptr);
+            std::lock_guard<std::mutex>const lock(this->m_frameMutex);
+            for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i){
+              auto&c = this->m_counters[i];
+              auto const calls       = c.calls      .load(std::memory_order_relaxed);
+              auto const nanoseconds = c.nanoseconds.load(std::memory_order_relaxed);
+              c.lastFrameCalls       = calls       - c.frameStartCalls      ;
+              c.lastFrameNanoseconds = nanoseconds - c.frameStartNanoseconds;
+              c.frameStartCalls       = calls      ;
+              c.frameStartNanoseconds = nanoseconds;
+            }
+          }
+          virtual void resetProfile()const override{
+            assert(this!=nullptr);
+            std::lock_guard<std::mutex>const lock(this->m_frameMutex);
+            for(auto&c:this->m_counters){
+              c.calls      .store(0,std::memory_order_relaxed);
+              c.nanoseconds.store(0,std::memory_order_relaxed);
+              c.frameStartCalls       = 0;
+              c.frameStartNanoseconds = 0;
+              c.lastFrameCalls        = 0;
+              c.lastFrameNanoseconds  = 0;
+            }
+          }
+          virtual std::vector<FunctionProfile>getProfile(size_t n = 0,Order order = BY_CALLS,Range range = TOTAL)const override{
+            assert(this!=nullptr);
+            std::vector<FunctionProfile>result;
+            std::unique_lock<std::mutex>lock(this->m_frameMutex);
+            for(size_t i=0;i<GE_GL_NOF_OPENGL_FUNCTIONS;++i){
+              auto const&c = this->m_counters[i];
+              FunctionProfile p;
+              p.name = this->m_names[i]?this->m_names[i]:"";
+              if(range == TOTAL){
+                p.calls       = c.calls      .load(std::memory_order_relaxed);
+                p.nanoseconds = c.nanoseconds.load(std::memory_order_relaxed);
+              }else{
+                p.calls       = c.lastFrameCalls      ;
+                p.nanoseconds = c.lastFrameNanoseconds;
+              }
+              if(p.calls == 0)continue;
+              result.push_back(p);
+            }
+            lock.unlock();
+            auto const key = [&](FunctionProfile const&p){return order == BY_CALLS?p.calls:p.nanoseconds;};
+            std::stable_sort(result.begin(),result.end(),[&](FunctionProfile const&a,FunctionProfile const&b){return key(a) > key(b);});
+            if(n != 0 && result.size() > n)result.resize(n);
+            return result;
+          }
+        protected:
+          /**
+           * @brief Counters of one function.
+           * calls and nanoseconds are updated by calls of function,
+           * frame fields are updated by nextFrame/resetProfile under m_frameMutex.
+           */
+          struct Counter{
+            std::atomic<uint64_t>calls                {0};
+            std::atomic<uint64_t>nanoseconds          {0};
+            uint64_t             frameStartCalls       = 0;
+            uint64_t             frameStartNanoseconds = 0;
+            uint64_t             lastFrameCalls        = 0;
+            uint64_t             lastFrameNanoseconds  = 0;
+          };
+          /**
+           * @brief Counts one call, measures its duration if timing is enabled.
+           */
+          class ProfilingScope{
+            public:
+              ProfilingScope(ProfilingTableDecorator const*table,size_t id):counter(table->m_counters[id]){
+                counter.calls.fetch_add(1,std::memory_order_relaxed);
+                timing = table->m_timing.load(std::memory_order_relaxed);
+                if(timing)start = std::chrono::steady_clock::now();
+              }
+              ~ProfilingScope(){
+                if(!timing)return;
+                auto const duration = std::chrono::steady_clock::now() - start;
+                counter.nanoseconds.fetch_add((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),std::memory_order_relaxed);
+              }
+            protected:
+              Counter&                             counter;
+              bool                                 timing ;
+              std::chrono::steady_clock::time_point start ;
+          };
+          mutable std::array<Counter,GE_GL_NOF_OPENGL_FUNCTIONS>m_counters        ;
+          std::array<char const*,GE_GL_NOF_OPENGL_FUNCTIONS>    m_names    = {}   ;
+          mutable std::atomic<bool>                             m_timing   {false};
+          mutable std::mutex                                    m_frameMutex      ;///< guards frame fields of m_counters
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+#include<geGL/Generated/ProfilingCalls.h>
+            return true;
+          }
+#include<geGL/Generated/ProfilingImplementation.h>
+      };
+  }
+}
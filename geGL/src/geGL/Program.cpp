@@ -7,13 +7,15 @@
 #include<string>
 #include<limits>
 #include<sstream>
+#include<cstring>
+#include<algorithm>
 //#include<GPUEngine/geCore/ErrorPrinter/ErrorPrinter.h>
 
 using namespace ge::gl;
 
 static bool printUniformWarnings = true;
 
-std::shared_ptr<ProgramInfo> const&Program::getInfo()const { return impl->info; }
+std::shared_ptr<ProgramInfo> const&Program::getInfo()const { _ensureInfo(); return impl->info; }
 
 /**
  * @brief sets warning for setting non existing uniform 
@@ -33,6 +35,42 @@ bool Program::isNonexistingUniformWarningEnabled(){
   return printUniformWarnings;
 }
 
+/**
+ * @brief enables CPU copies of uniforms, set* skips glProgramUniform* if values did not change.
+ * Copies are allocated from program reflection when program is linked.
+ * Uniforms that are set by other means (glUniform*, default values in shader)
+ * are not known, so the first set of every uniform is always issued.
+ * Enabling shadowing again forgets all copies.
+ *
+ * @param enable true for enabling shadowing
+ */
+void Program::setUniformShadowing(bool enable){
+  assert(this!=nullptr);
+  impl->shadowUniforms = enable;
+  impl->uniformShadows.clear();
+  impl->shadowData    .clear();
+  impl->shadowValid   .clear();
+  if(enable && !impl->infoPending)_fillUniformShadows();
+}
+
+bool Program::isUniformShadowingEnabled()const{
+  assert(this!=nullptr);
+  return impl->shadowUniforms;
+}
+
+/**
+ * @brief returns number of issued and skipped uniform updates
+ *
+ * @return statistics
+ */
+Program::UniformStatistics Program::getUniformStatistics()const{
+  assert(this!=nullptr);
+  UniformStatistics statistics;
+  statistics.issued  = impl->issuedUniformUpdates ;
+  statistics.skipped = impl->skippedUniformUpdates;
+  return statistics;
+}
+
 GLint Program::_getParam(GLenum pname)const{
   assert(this!=nullptr);
   GLint params;
@@ -138,17 +176,72 @@ void Program::link(ShaderPointers const&shaders){
   assert(this!=nullptr);
   attachShaders(shaders);
   getContext().glLinkProgram(getId());
+  impl->infoPending = false;
   if(!getLinkStatus()){
     std::cerr<<getInfoLog()<<std::endl;
   }
   _fillInfo();
 }
 
+/**
+ * @brief starts linking of program, it does not wait for linker.
+ * Link status is checked and reflection is filled when program is used for the first time
+ * (use, set*, getInfo, ...). With GL_KHR_parallel_shader_compile the driver links in background,
+ * poll GL_COMPLETION_STATUS_KHR (see ProgramCompiler) before the first use to avoid stall.
+ *
+ * @param shaders optional vector of shaders, they do not have to be compiled yet
+ */
+void Program::linkAsync(ShaderPointers const&shaders){
+  assert(this!=nullptr);
+  attachShaders(shaders);
+  getContext().glLinkProgram(getId());
+  impl->infoPending = true;
+}
+
+/**
+ * @brief loads program from binary obtained by getBinary (glProgramBinary)
+ * Attached shaders are not needed.
+ *
+ * @param format format of binary
+ * @param binary program binary
+ * @param length length of binary in bytes
+ *
+ * @return link status, false if driver rejected binary
+ */
+bool Program::setBinary(GLenum format,void const*binary,GLsizei length){
+  assert(this!=nullptr);
+  create();
+  impl->infoPending = false;
+  getContext().glProgramBinary(getId(),format,binary,length);
+  if(!getLinkStatus())return false;
+  _fillInfo();
+  return true;
+}
+
+/**
+ * @brief gets binary of linked program (glGetProgramBinary)
+ * Set GL_PROGRAM_BINARY_RETRIEVABLE_HINT before linking.
+ *
+ * @param format output format of binary
+ *
+ * @return program binary, empty if program is not linked
+ */
+std::vector<uint8_t>Program::getBinary(GLenum&format)const{
+  assert(this!=nullptr);
+  std::vector<uint8_t>binary(getBinaryLength());
+  if(binary.empty())return binary;
+  GLsizei length = 0;
+  getContext().glGetProgramBinary(getId(),(GLsizei)binary.size(),&length,&format,binary.data());
+  binary.resize(length);
+  return binary;
+}
+
 /**
  * @brief use this program
  */
 void Program::use()const{
   assert(this!=nullptr);
+  _ensureInfo();
   getContext().glUseProgram(getId());
 }
 
@@ -423,249 +516,215 @@ GLint Program::getResourceParam(GLenum interf,GLenum pname,GLuint index)const{
 
 
 
-#define GE_GL_PROGRAM_SET(fce,type,...)\
-  assert(this!=nullptr);\
-  auto ii = impl->info->uniforms.find(name);\
-  if(ii==impl->info->uniforms.end()){\
-    if(printUniformWarnings)\
-      throw std::invalid_argument("there is no such uniform: "+name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type);\
-  std::get<ProgramInfo::LOCATION>(ii->second);\
-  getContext().fce(getId(),std::get<ProgramInfo::LOCATION>(ii->second),__VA_ARGS__);\
-  return this
-
-#define GE_GL_PROGRAM_SETI(fce,type0,type1,...)\
-  assert(this!=nullptr);\
-  auto ii = impl->info->uniforms.find(name);\
-  if(ii==impl->info->uniforms.end()){\
-    if(printUniformWarnings)\
-      throw std::invalid_argument("there is no such uniform: "+name);\
-    return this;\
-  }\
-  assert(\
-      std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type0 ||\
-      std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type1);\
-  std::get<ProgramInfo::LOCATION>(ii->second);\
-  getContext().fce(getId(),std::get<ProgramInfo::LOCATION>(ii->second),__VA_ARGS__);\
-  return this
-
-#define GE_GL_PROGRAM_SETV(fce,type)\
-  assert(this!=nullptr);\
-  auto ii = impl->info->uniforms.find(name);\
-  if(ii==impl->info->uniforms.end()){\
-    if(printUniformWarnings)\
-      throw std::invalid_argument("there is no such uniform: "+name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type);\
-  assert(count<=std::get<ProgramInfo::SIZE>(impl->info->uniforms[name]));\
-  getContext().fce(getId(),std::get<ProgramInfo::LOCATION>(ii->second),count,v0);\
-  return this
-
-#define GE_GL_PROGRAM_SETIV(fce,type0,type1)\
-  assert(this!=nullptr);\
-  auto ii = impl->info->uniforms.find(name);\
-  if(ii==impl->info->uniforms.end()){\
-    if(printUniformWarnings)\
-      throw std::invalid_argument("there is no such uniform: "+name);\
-    return this;\
-  }\
-  assert(\
-      std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type0 ||\
-      std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type1);\
-  assert(count<=std::get<ProgramInfo::SIZE>(impl->info->uniforms[name]));\
-  getContext().fce(getId(),std::get<ProgramInfo::LOCATION>(ii->second),count,v0);\
-  return this
-
-
-#define GE_GL_PROGRAM_SETMATRIX(fce,type)\
+ProgramInfo::Properties const*Program::_findUniform(std::string const&name)const{
+  assert(this!=nullptr);
+  _ensureInfo();
+  auto ii = impl->info->uniforms.find(name);
+  if(ii==impl->info->uniforms.end())
+    return nullptr;
+  return &ii->second;
+}
+
+/**
+ * @brief Returns handle for name based setters (set1f, set4fv, ...)
+ * It does only one lookup, missing uniform throws if warnings are enabled.
+ */
+template<GLenum TYPE>
+Uniform<TYPE>Program::_getUniformHandle(std::string const&name)const{
+  auto const properties = _findUniform(name);
+  if(!properties){
+    if(printUniformWarnings)
+      throw std::invalid_argument("there is no such uniform: "+name);
+    return Uniform<TYPE>();
+  }
+  assert(Uniform<TYPE>::Type::accepts(std::get<ProgramInfo::TYPE>(*properties)));
+  return Uniform<TYPE>(std::get<ProgramInfo::LOCATION>(*properties),std::get<ProgramInfo::SIZE>(*properties));
+}
+
+#define GE_GL_PROGRAM_SET(type,...)\
   assert(this!=nullptr);\
-  auto ii = impl->info->uniforms.find(name);\
-  if(ii==impl->info->uniforms.end()){\
-    if(printUniformWarnings)\
-      throw std::invalid_argument("there is no such uniform: "+name);\
-    return this;\
-  }\
-  assert(std::get<ProgramInfo::TYPE>(impl->info->uniforms[name]) == type);\
-  assert(count<=std::get<ProgramInfo::SIZE>(impl->info->uniforms[name]));\
-  getContext().fce(getId(),std::get<ProgramInfo::LOCATION>(ii->second),count,transpose,v0);\
-  return this
+  return set(_getUniformHandle<type>(name),__VA_ARGS__)
 
+#define GE_GL_PROGRAM_SETV(type)\
+  assert(this!=nullptr);\
+  return setv(_getUniformHandle<type>(name),v0,count)
 
+#define GE_GL_PROGRAM_SETMATRIX(type)\
+  assert(this!=nullptr);\
+  return setv(_getUniformHandle<type>(name),v0,count,transpose)
 
 Program const* Program::set1f(std::string const&name,float v0)const{
-  GE_GL_PROGRAM_SET(glProgramUniform1f,GL_FLOAT,v0);
+  GE_GL_PROGRAM_SET(GL_FLOAT,v0);
 }
 
 Program const* Program::set2f(std::string const&name,float v0,float v1)const{
-  GE_GL_PROGRAM_SET(glProgramUniform2f,GL_FLOAT_VEC2,v0,v1);
+  GE_GL_PROGRAM_SET(GL_FLOAT_VEC2,v0,v1);
 }
 
 Program const* Program::set3f(std::string const&name,float v0,float v1,float v2)const{
-  GE_GL_PROGRAM_SET(glProgramUniform3f,GL_FLOAT_VEC3,v0,v1,v2);
+  GE_GL_PROGRAM_SET(GL_FLOAT_VEC3,v0,v1,v2);
 }
 
 Program const* Program::set4f(std::string const&name,float v0,float v1,float v2,float v3)const{
-  GE_GL_PROGRAM_SET(glProgramUniform4f,GL_FLOAT_VEC4,v0,v1,v2,v3);
+  GE_GL_PROGRAM_SET(GL_FLOAT_VEC4,v0,v1,v2,v3);
 }
 
 Program const* Program::set1i(std::string const&name,int32_t v0)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform1i,GL_INT,GL_BOOL,v0);
+  GE_GL_PROGRAM_SET(GL_INT,v0);
 }
 
 Program const* Program::set2i(std::string const&name,int32_t v0,int32_t v1)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform2i,GL_INT_VEC2,GL_BOOL_VEC2,v0,v1);
+  GE_GL_PROGRAM_SET(GL_INT_VEC2,v0,v1);
 }
 
 Program const* Program::set3i(std::string const&name,int32_t v0,int32_t v1,int32_t v2)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform3i,GL_INT_VEC3,GL_BOOL_VEC3,v0,v1,v2);
+  GE_GL_PROGRAM_SET(GL_INT_VEC3,v0,v1,v2);
 }
 
 Program const* Program::set4i(std::string const&name,int32_t v0,int32_t v1,int32_t v2,int32_t v3)const{
-  GE_GL_PROGRAM_SETI(glProgramUniform4i,GL_INT_VEC4,GL_BOOL_VEC4,v0,v1,v2,v3);
+  GE_GL_PROGRAM_SET(GL_INT_VEC4,v0,v1,v2,v3);
 }
 
 Program const* Program::set1ui(std::string const&name,uint32_t v0)const{
-  GE_GL_PROGRAM_SET(glProgramUniform1ui,GL_UNSIGNED_INT,v0);
+  GE_GL_PROGRAM_SET(GL_UNSIGNED_INT,v0);
 }
 
 Program const* Program::set2ui(std::string const&name,uint32_t v0,uint32_t v1)const{
-  GE_GL_PROGRAM_SET(glProgramUniform2ui,GL_UNSIGNED_INT_VEC2,v0,v1);
+  GE_GL_PROGRAM_SET(GL_UNSIGNED_INT_VEC2,v0,v1);
 }
 
 Program const* Program::set3ui(std::string const&name,uint32_t v0,uint32_t v1,uint32_t v2)const{
-  GE_GL_PROGRAM_SET(glProgramUniform3ui,GL_UNSIGNED_INT_VEC3,v0,v1,v2);
+  GE_GL_PROGRAM_SET(GL_UNSIGNED_INT_VEC3,v0,v1,v2);
 }
 
 Program const* Program::set4ui(std::string const&name,uint32_t v0,uint32_t v1,uint32_t v2,uint32_t v3)const{
-  GE_GL_PROGRAM_SET(glProgramUniform4ui,GL_UNSIGNED_INT_VEC4,v0,v1,v2,v3);
+  GE_GL_PROGRAM_SET(GL_UNSIGNED_INT_VEC4,v0,v1,v2,v3);
 }
 
 
 Program const* Program::set1fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform1fv,GL_FLOAT);
+  GE_GL_PROGRAM_SETV(GL_FLOAT);
 }
 
 Program const* Program::set2fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform2fv,GL_FLOAT_VEC2);
+  GE_GL_PROGRAM_SETV(GL_FLOAT_VEC2);
 }
 
 Program const* Program::set3fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform3fv,GL_FLOAT_VEC3);
+  GE_GL_PROGRAM_SETV(GL_FLOAT_VEC3);
 }
 
 Program const* Program::set4fv(std::string const&name,float const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform4fv,GL_FLOAT_VEC4);
+  GE_GL_PROGRAM_SETV(GL_FLOAT_VEC4);
 }
 
 Program const* Program::set1iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform1iv,GL_INT,GL_BOOL);
+  GE_GL_PROGRAM_SETV(GL_INT);
 }
 
 Program const* Program::set2iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform2iv,GL_INT_VEC2,GL_BOOL_VEC2);
+  GE_GL_PROGRAM_SETV(GL_INT_VEC2);
 }
 
 Program const* Program::set3iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform3iv,GL_INT_VEC3,GL_BOOL_VEC3);
+  GE_GL_PROGRAM_SETV(GL_INT_VEC3);
 }
 
 Program const* Program::set4iv(std::string const&name,int32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETIV(glProgramUniform4iv,GL_INT_VEC4,GL_BOOL_VEC4);
+  GE_GL_PROGRAM_SETV(GL_INT_VEC4);
 }
 
 Program const* Program::set1uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform1uiv,GL_UNSIGNED_INT);
+  GE_GL_PROGRAM_SETV(GL_UNSIGNED_INT);
 }
 
 Program const* Program::set2uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform2uiv,GL_UNSIGNED_INT_VEC2);
+  GE_GL_PROGRAM_SETV(GL_UNSIGNED_INT_VEC2);
 }
 
 Program const* Program::set3uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform3uiv,GL_UNSIGNED_INT_VEC3);
+  GE_GL_PROGRAM_SETV(GL_UNSIGNED_INT_VEC3);
 }
 
 Program const* Program::set4uiv(std::string const&name,uint32_t const*v0,GLsizei count)const{
-  GE_GL_PROGRAM_SETV(glProgramUniform4uiv,GL_UNSIGNED_INT_VEC4);
+  GE_GL_PROGRAM_SETV(GL_UNSIGNED_INT_VEC4);
 }
 
 Program const* Program::setMatrix4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4fv,GL_FLOAT_MAT4);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT4);
 }
 
 Program const* Program::setMatrix3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3fv,GL_FLOAT_MAT3);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT3);
 }
 
 Program const* Program::setMatrix2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2fv,GL_FLOAT_MAT2);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT2);
 }
 
 Program const* Program::setMatrix4x3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3fv,GL_FLOAT_MAT4x3);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT4x3);
 }
 
 Program const* Program::setMatrix4x2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2fv,GL_FLOAT_MAT4x2);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT4x2);
 }
 
 Program const* Program::setMatrix3x4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4fv,GL_FLOAT_MAT3x4);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT3x4);
 }
 
 Program const* Program::setMatrix3x2fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2fv,GL_FLOAT_MAT3x2);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT3x2);
 }
 
 Program const* Program::setMatrix2x4fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4fv,GL_FLOAT_MAT2x4);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT2x4);
 }
 
 Program const* Program::setMatrix2x3fv(std::string const&name,float const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3fv,GL_FLOAT_MAT2x3);
+  GE_GL_PROGRAM_SETMATRIX(GL_FLOAT_MAT2x3);
 }
 
 Program const* Program::setMatrix4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4dv,GL_DOUBLE_MAT4);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT4);
 }
 
 Program const* Program::setMatrix3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3dv,GL_DOUBLE_MAT3);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT3);
 }
 
 Program const* Program::setMatrix2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2dv,GL_DOUBLE_MAT2);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT2);
 }
 
 Program const* Program::setMatrix4x3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x3dv,GL_DOUBLE_MAT4x3);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT4x3);
 }
 
 Program const* Program::setMatrix4x2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix4x2dv,GL_DOUBLE_MAT4x2);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT4x2);
 }
 
 Program const* Program::setMatrix3x4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x4dv,GL_DOUBLE_MAT3x4);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT3x4);
 }
 
 Program const* Program::setMatrix3x2dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix3x2dv,GL_DOUBLE_MAT3x2);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT3x2);
 }
 
 Program const* Program::setMatrix2x4dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x4dv,GL_DOUBLE_MAT2x4);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT2x4);
 }
 
 Program const* Program::setMatrix2x3dv(std::string const&name,double const*v0,GLsizei count,GLboolean transpose)const{
-  GE_GL_PROGRAM_SETMATRIX(glProgramUniformMatrix2x3dv,GL_DOUBLE_MAT2x3);
+  GE_GL_PROGRAM_SETMATRIX(GL_DOUBLE_MAT2x3);
 }
 
 GLint Program::_getUniform(std::string name){
   assert(this!=nullptr);
+  _ensureInfo();
   auto ii = impl->info->uniforms.find(name);
   if(ii==impl->info->uniforms.end())
     return -1;
@@ -753,11 +812,190 @@ void Program::_fillBufferInfo(){
   }
 }
 
+/**
+ * @brief reflects uniform blocks and offsets, array strides and matrix strides of their members
+ */
+void Program::_fillUniformBlockInfo(){
+  assert(this!=nullptr);
+  impl->info->uniformBlocks.clear();
+  GLuint nofBlocks = getInterfaceParam(GL_UNIFORM_BLOCK,GL_ACTIVE_RESOURCES);
+  for(GLuint i=0;i<nofBlocks;++i){
+    std::string name = getResourceName(GL_UNIFORM_BLOCK,i);
+    GLint binding            = getResourceParam(GL_UNIFORM_BLOCK,GL_BUFFER_BINDING       ,i);
+    GLint dataSize           = getResourceParam(GL_UNIFORM_BLOCK,GL_BUFFER_DATA_SIZE     ,i);
+    GLint nofActiveVariables = getResourceParam(GL_UNIFORM_BLOCK,GL_NUM_ACTIVE_VARIABLES ,i);
+    std::vector<GLint>variables(nofActiveVariables);
+    GLenum const activeVariables = GL_ACTIVE_VARIABLES;
+    if(nofActiveVariables > 0)
+      getContext().glGetProgramResourceiv(getId(),GL_UNIFORM_BLOCK,i,1,&activeVariables,nofActiveVariables,nullptr,variables.data());
+    std::map<std::string,ProgramInfo::UniformBlockMemberProperties>members;
+    for(auto const&v:variables){
+      std::string memberName = _chopIndexingInPropertyName(getResourceName(GL_UNIFORM,v));
+      members[memberName] = ProgramInfo::UniformBlockMemberProperties(
+          memberName,
+          getResourceParam(GL_UNIFORM,GL_TYPE         ,v),
+          getResourceParam(GL_UNIFORM,GL_ARRAY_SIZE   ,v),
+          getResourceParam(GL_UNIFORM,GL_OFFSET       ,v),
+          getResourceParam(GL_UNIFORM,GL_ARRAY_STRIDE ,v),
+          getResourceParam(GL_UNIFORM,GL_MATRIX_STRIDE,v),
+          getResourceParam(GL_UNIFORM,GL_IS_ROW_MAJOR ,v));
+    }
+    impl->info->uniformBlocks[name] = ProgramInfo::UniformBlockProperties(
+        name,
+        binding,
+        dataSize,
+        members);
+  }
+}
+
 void Program::_fillInfo(){
   assert(this!=nullptr);
   _fillUniformInfo();
   _fillAttribInfo();
   _fillBufferInfo();
+  _fillUniformBlockInfo();
+  if(impl->shadowUniforms)_fillUniformShadows();
+}
+
+namespace{
+  /**
+   * @brief size of one element of uniform as it is passed to glProgramUniform*v
+   *
+   * @param type type of uniform
+   *
+   * @return size in bytes, 0 for unknown types
+   */
+  size_t getUniformElementSize(GLenum type){
+    if(isOpaqueUniformType(type))return sizeof(GLint);
+    switch(type){
+      case GL_FLOAT            :return 1 *sizeof(GLfloat );
+      case GL_FLOAT_VEC2       :return 2 *sizeof(GLfloat );
+      case GL_FLOAT_VEC3       :return 3 *sizeof(GLfloat );
+      case GL_FLOAT_VEC4       :return 4 *sizeof(GLfloat );
+      case GL_DOUBLE           :return 1 *sizeof(GLdouble);
+      case GL_DOUBLE_VEC2      :return 2 *sizeof(GLdouble);
+      case GL_DOUBLE_VEC3      :return 3 *sizeof(GLdouble);
+      case GL_DOUBLE_VEC4      :return 4 *sizeof(GLdouble);
+      case GL_INT              :
+      case GL_BOOL             :
+      case GL_UNSIGNED_INT     :return 1 *sizeof(GLint   );
+      case GL_INT_VEC2         :
+      case GL_BOOL_VEC2        :
+      case GL_UNSIGNED_INT_VEC2:return 2 *sizeof(GLint   );
+      case GL_INT_VEC3         :
+      case GL_BOOL_VEC3        :
+      case GL_UNSIGNED_INT_VEC3:return 3 *sizeof(GLint   );
+      case GL_INT_VEC4         :
+      case GL_BOOL_VEC4        :
+      case GL_UNSIGNED_INT_VEC4:return 4 *sizeof(GLint   );
+      case GL_FLOAT_MAT2       :return 4 *sizeof(GLfloat );
+      case GL_FLOAT_MAT3       :return 9 *sizeof(GLfloat );
+      case GL_FLOAT_MAT4       :return 16*sizeof(GLfloat );
+      case GL_FLOAT_MAT2x3     :
+      case GL_FLOAT_MAT3x2     :return 6 *sizeof(GLfloat );
+      case GL_FLOAT_MAT2x4     :
+      case GL_FLOAT_MAT4x2     :return 8 *sizeof(GLfloat );
+      case GL_FLOAT_MAT3x4     :
+      case GL_FLOAT_MAT4x3     :return 12*sizeof(GLfloat );
+      case GL_DOUBLE_MAT2      :return 4 *sizeof(GLdouble);
+      case GL_DOUBLE_MAT3      :return 9 *sizeof(GLdouble);
+      case GL_DOUBLE_MAT4      :return 16*sizeof(GLdouble);
+      case GL_DOUBLE_MAT2x3    :
+      case GL_DOUBLE_MAT3x2    :return 6 *sizeof(GLdouble);
+      case GL_DOUBLE_MAT2x4    :
+      case GL_DOUBLE_MAT4x2    :return 8 *sizeof(GLdouble);
+      case GL_DOUBLE_MAT3x4    :
+      case GL_DOUBLE_MAT4x3    :return 12*sizeof(GLdouble);
+      default                  :return 0;
+    }
+  }
+}
+
+/**
+ * @brief allocates CPU copies of uniforms according to program reflection.
+ * Array elements (name[i]) share copy of the whole array,
+ * so setting the whole array and setting its elements see the same values.
+ */
+void Program::_fillUniformShadows(){
+  assert(this!=nullptr);
+  impl->uniformShadows.clear();
+  impl->shadowData    .clear();
+  impl->shadowValid   .clear();
+  auto const setShadow = [&](GLint location,ProgramImpl::UniformShadow const&shadow){
+    if(location < 0)return;
+    if(static_cast<size_t>(location) >= impl->uniformShadows.size())
+      impl->uniformShadows.resize(location+1);
+    impl->uniformShadows[location] = shadow;
+  };
+  for(auto const&u:impl->info->uniforms){
+    auto const&name = u.first;
+    if(name.find('[') != std::string::npos)continue;
+    ProgramImpl::UniformShadow shadow;
+    shadow.elementSize = getUniformElementSize(std::get<ProgramInfo::TYPE>(u.second));
+    shadow.nofElements = std::max<GLint>(std::get<ProgramInfo::SIZE>(u.second),1);
+    shadow.offset      = impl->shadowData .size();
+    shadow.element     = impl->shadowValid.size();
+    if(shadow.elementSize == 0 || std::get<ProgramInfo::LOCATION>(u.second) < 0)continue;
+    impl->shadowData .resize(shadow.offset +shadow.nofElements*shadow.elementSize);
+    impl->shadowValid.resize(shadow.element+shadow.nofElements,0);
+    setShadow(std::get<ProgramInfo::LOCATION>(u.second),shadow);
+    for(size_t i=1;i<shadow.nofElements;++i){
+      auto const ii = impl->info->uniforms.find(name+"["+std::to_string(i)+"]");
+      if(ii == impl->info->uniforms.end())continue;
+      ProgramImpl::UniformShadow element = shadow;
+      element.offset      += i*shadow.elementSize;
+      element.element     += i;
+      element.nofElements -= i;
+      setShadow(std::get<ProgramInfo::LOCATION>(ii->second),element);
+    }
+  }
+}
+
+/**
+ * @brief compares values with CPU copy of uniform and updates the copy
+ *
+ * @param location location of uniform
+ * @param values new values
+ * @param size size of values in bytes
+ * @param transpose matrices are transposed, such values are not shadowed
+ *
+ * @return true if glProgramUniform* has to be called
+ */
+bool Program::_updateUniformShadow(GLint location,void const*values,size_t size,GLboolean transpose)const{
+  if(!impl->shadowUniforms || static_cast<size_t>(location) >= impl->uniformShadows.size()){
+    impl->issuedUniformUpdates++;
+    return true;
+  }
+  auto const&shadow = impl->uniformShadows[location];
+  size_t const nofElements = shadow.elementSize ? std::min(size/shadow.elementSize,shadow.nofElements) : 0;
+  if(nofElements == 0){
+    impl->issuedUniformUpdates++;
+    return true;
+  }
+  size_t const bytes = nofElements*shadow.elementSize;
+  auto   const data  = impl->shadowData .data()+shadow.offset ;
+  auto   const valid = impl->shadowValid.data()+shadow.element;
+  if(!transpose && std::find(valid,valid+nofElements,0) == valid+nofElements && std::memcmp(data,values,bytes) == 0){
+    impl->skippedUniformUpdates++;
+    return false;
+  }
+  std::memcpy(data,values,bytes);
+  std::fill(valid,valid+nofElements,transpose?0:1);
+  impl->issuedUniformUpdates++;
+  return true;
+}
+
+/**
+ * @brief finishes linking started by linkAsync - checks link status and fills reflection
+ */
+void Program::_ensureInfo()const{
+  assert(this!=nullptr);
+  if(!impl->infoPending)return;
+  impl->infoPending = false;
+  if(!getLinkStatus()){
+    std::cerr<<getInfoLog()<<std::endl;
+  }
+  const_cast<Program*>(this)->_fillInfo();
 }
 
 std::string Program::_chopIndexingInPropertyName(std::string name)const{
@@ -771,6 +1009,7 @@ GLuint const Program::nonExistingBufferBinding = std::numeric_limits<GLuint>::ma
 
 GLuint Program::getBufferBinding(std::string const&name)const{
   assert(this != nullptr);
+  _ensureInfo();
   auto ii = impl->info->buffers.find(name);
   if(ii == impl->info->buffers.end()){
     throw std::invalid_argument("there is no such buffer: "+name);
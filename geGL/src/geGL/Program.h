@@ -4,9 +4,11 @@
 #include<memory>
 #include<set>
 #include<map>
+#include<stdexcept>
 
 #include<geGL/Shader.h>
 #include<geGL/ProgramInfo.h>
+#include<geGL/Uniform.h>
 
 class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   public:
@@ -21,6 +23,9 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
 	void attachShaders(ShaderPointers const&shaders = {});
 	void detachShaders(ShaderPointers const&shaders = {});
 	void link         (ShaderPointers const&shaders = {});
+	void linkAsync    (ShaderPointers const&shaders = {});
+	bool setBinary    (GLenum format,void const*binary,GLsizei length);
+	std::vector<uint8_t>getBinary(GLenum&format)const;
 	GLboolean isProgram()const;
 	void use ()const;
 	void validate()const;
@@ -114,6 +119,12 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   void set2v(std::string const&name,uint32_t const*v0,GLsizei count = 1);
   void set3v(std::string const&name,uint32_t const*v0,GLsizei count = 1);
   void set4v(std::string const&name,uint32_t const*v0,GLsizei count = 1);
+  template<GLenum TYPE>
+    Uniform<TYPE>getUniform(std::string const&name)const;
+  template<GLenum TYPE,typename...ARGS>
+    Program const*set (Uniform<TYPE>const&uniform,ARGS const&...values)const;
+  template<GLenum TYPE>
+    Program const*setv(Uniform<TYPE>const&uniform,typename Uniform<TYPE>::Component const*values,GLsizei count = 1,GLboolean transpose = GL_FALSE)const;
   Program const*bindBuffer(std::string const&name,std::shared_ptr<Buffer>const&buffer)const;
   Program const*bindBuffer(std::string const&name,Buffer*const&buffer)const;
   Program const*dispatch(GLuint nofWorkGroupsX = 1,GLuint nofWorkGroupsY = 1,GLuint nofWorkGroupsZ = 1)const;
@@ -121,6 +132,13 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   std::shared_ptr<ProgramInfo> const&getInfo()const;
 	static void setNonexistingUniformWarning(bool enableWarning = true);
 	static bool isNonexistingUniformWarningEnabled();
+  struct UniformStatistics{
+    size_t issued  = 0;///< glProgramUniform* calls
+    size_t skipped = 0;///< updates with the same values as last time
+  };
+  void setUniformShadowing(bool enable = true);
+  bool isUniformShadowingEnabled()const;
+  UniformStatistics getUniformStatistics()const;
 
 	GLuint static const nonExistingBufferBinding;
 	GLuint getBufferBinding(std::string const&name)const;
@@ -140,11 +158,18 @@ class GEGL_EXPORT ge::gl::Program: public OpenGLObject{
   protected:
 	ProgramImpl*impl = nullptr;
 	GLint _getUniform(std::string name);
+	ProgramInfo::Properties const*_findUniform(std::string const&name)const;
+	template<GLenum TYPE>
+	  Uniform<TYPE>_getUniformHandle(std::string const&name)const;
 	GLint _getParam(GLenum pname)const;
     void _fillUniformInfo();
     void _fillAttribInfo();
     void _fillBufferInfo();
+    void _fillUniformBlockInfo();
     void _fillInfo();
+    void _fillUniformShadows();
+    bool _updateUniformShadow(GLint location,void const*values,size_t size,GLboolean transpose)const;
+    void _ensureInfo()const;
     std::string _chopIndexingInPropertyName(std::string name)const;
     friend class Shader;
 };
@@ -170,6 +195,65 @@ void ge::gl::Program::link(ARGS... shaders){
   assert(this!=nullptr);
   this->link(ShaderPointers({shaders...}));
 }
+
+/**
+ * @brief Returns typed handle of uniform, it can be set without name lookup.
+ * Handle is valid until program is linked again.
+ *
+ * @tparam TYPE GLSL type of uniform (GL_FLOAT_VEC4, GL_FLOAT_MAT4, ...),
+ * GL_INT handle can be used for bool, sampler and image uniforms
+ * @param name name of uniform
+ *
+ * @return handle, it is invalid (and it is ignored by set) if there is no such active uniform
+ */
+template<GLenum TYPE>
+ge::gl::Uniform<TYPE>ge::gl::Program::getUniform(std::string const&name)const{
+  assert(this!=nullptr);
+  auto const properties = _findUniform(name);
+  if(!properties)return Uniform<TYPE>();
+  if(!Uniform<TYPE>::Type::accepts(std::get<ProgramInfo::TYPE>(*properties)))
+    throw std::invalid_argument("geGL: Program::getUniform - uniform "+name+" has different type");
+  return Uniform<TYPE>(std::get<ProgramInfo::LOCATION>(*properties),std::get<ProgramInfo::SIZE>(*properties));
+}
+
+/**
+ * @brief Sets uniform using handle, number and type of values are checked at compile time
+ *
+ * @param uniform handle from getUniform
+ * @param values components of uniform (e.g. 4 floats for GL_FLOAT_VEC4)
+ *
+ * @return this
+ */
+template<GLenum TYPE,typename...ARGS>
+ge::gl::Program const*ge::gl::Program::set(Uniform<TYPE>const&uniform,ARGS const&...values)const{
+  using Type = typename Uniform<TYPE>::Type;
+  static_assert(!Type::matrix,"matrix uniforms have to be set using setv");
+  static_assert(sizeof...(ARGS) == Type::nofComponents,"number of values does not match type of uniform");
+  typename Type::Component const data[] = {values...};
+  return setv(uniform,data);
+}
+
+/**
+ * @brief Sets uniform (array) using handle
+ *
+ * @param uniform handle from getUniform
+ * @param values count*nofComponents values
+ * @param count number of array elements
+ * @param transpose transpose matrices, it is ignored for non-matrix types
+ *
+ * @return this
+ */
+template<GLenum TYPE>
+ge::gl::Program const*ge::gl::Program::setv(Uniform<TYPE>const&uniform,typename Uniform<TYPE>::Component const*values,GLsizei count,GLboolean transpose)const{
+  assert(this!=nullptr);
+  if(!uniform.isValid())return this;
+  assert(count<=uniform.getSize());
+  if(!_updateUniformShadow(uniform.getLocation(),values,count*Uniform<TYPE>::Type::nofComponents*sizeof(*values),transpose))
+    return this;
+  Uniform<TYPE>::Type::upload(getContext(),getId(),uniform.getLocation(),count,transpose,values);
+  return this;
+}
+
 inline void ge::gl::Program::set(std::string const&name,float v0                           ){assert(this!=nullptr);this->set1f(name,v0);}
 inline void ge::gl::Program::set(std::string const&name,float v0,float v1                  ){assert(this!=nullptr);this->set2f(name,v0,v1);}
 inline void ge::gl::Program::set(std::string const&name,float v0,float v1,float v2         ){assert(this!=nullptr);this->set3f(name,v0,v1,v2);}
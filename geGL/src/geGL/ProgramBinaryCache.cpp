@@ -0,0 +1,460 @@
+#include <geGL/ProgramBinaryCache.h>
+#include <geGL/OpenGLContext.h>
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+using namespace ge::gl;
+
+namespace {
+char const   fileMagic[8]  = {'g', 'e', 'G', 'L', 'P', 'B', 'C', '1'};
+char const   indexHeader[] = "geGL program binary cache 1";
+size_t const fileHeaderSize =
+    sizeof(fileMagic) + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+/**
+ * @brief FNV-1a hash that can be continued
+ */
+uint64_t hash(uint64_t h, void const *data, size_t size)
+{
+  auto const d = static_cast<uint8_t const *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    h ^= d[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+uint64_t hash(uint64_t h, std::string const &str)
+{
+  uint64_t const length = str.size();
+  h = hash(h, &length, sizeof(length));
+  return hash(h, str.data(), str.size());
+}
+
+bool makeDirectory(std::string const &directory)
+{
+#ifdef _WIN32
+  auto const result = _mkdir(directory.c_str());
+#else
+  auto const result = mkdir(directory.c_str(), 0755);
+#endif
+  return result == 0 || errno == EEXIST;
+}
+
+std::string getString(Context const &gl, GLenum name)
+{
+  auto const str = gl.glGetString(name);
+  if (!str) return "";
+  return reinterpret_cast<char const *>(str);
+}
+
+bool isFormatSupported(Context const &gl, GLenum format)
+{
+  GLint nofFormats = 0;
+  gl.glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &nofFormats);
+  if (nofFormats <= 0) return false;
+  std::vector<GLint> formats(nofFormats);
+  gl.glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
+  return std::find(formats.begin(), formats.end(),
+                   static_cast<GLint>(format)) != formats.end();
+}
+}  // namespace
+
+/**
+ * @brief Opens cache directory, it is created if it does not exist
+ * (parent directory has to exist)
+ *
+ * @param directory cache directory
+ * @param maxSize maximal size of stored binaries in bytes
+ */
+ProgramBinaryCache::ProgramBinaryCache(std::string const &directory,
+                                       size_t             maxSize)
+    : directory(directory), maxSize(maxSize)
+{
+  if (directory.empty() || !makeDirectory(directory))
+    throw std::runtime_error(
+        "geGL: ProgramBinaryCache - cannot create directory: " + directory);
+  readIndex();
+  if (size > maxSize) {
+    evict(0);
+    writeIndex();
+  }
+}
+
+/**
+ * @brief Destructor, writes index
+ */
+ProgramBinaryCache::~ProgramBinaryCache() { flush(); }
+
+/**
+ * @brief Creates program using default context
+ *
+ * @param stages shader types and their sources
+ *
+ * @return linked program (check its link status)
+ */
+std::shared_ptr<Program> ProgramBinaryCache::createProgram(Stages const &stages)
+{
+  return createProgram(nullptr, stages);
+}
+
+/**
+ * @brief Creates program from cached binary, compiles shaders and stores
+ * binary if it is not cached or driver rejects it
+ *
+ * @param table opengl function table
+ * @param stages shader types and their sources
+ *
+ * @return linked program (check its link status)
+ */
+std::shared_ptr<Program> ProgramBinaryCache::createProgram(
+    FunctionTablePointer const &table,
+    Stages const &              stages)
+{
+  assert(this != nullptr);
+  Context    gl(table);
+  auto const key = computeKey(stages, getDriver(table));
+
+  GLenum format = 0;
+  Binary binary;
+  if (load(key, format, binary)) {
+    if (isFormatSupported(gl, format)) {
+      auto program = std::make_shared<Program>(table);
+      if (program->setBinary(format, binary.data(),
+                             static_cast<GLsizei>(binary.size())))
+        return program;
+    }
+    statistics.rejected++;
+    remove(key);
+  }
+
+  Program::ShaderPointers shaders;
+  for (auto const &s : stages)
+    shaders.push_back(std::make_shared<Shader>(table, s.first, s.second));
+  auto program = std::make_shared<Program>(table);
+  program->create();
+  gl.glProgramParameteri(program->getId(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+                         GL_TRUE);
+  program->link(shaders);
+  if (!program->getLinkStatus()) return program;
+
+  binary = program->getBinary(format);
+  if (!binary.empty()) store(key, format, binary);
+  return program;
+}
+
+/**
+ * @brief Loads binary from cache, corrupted file is removed
+ *
+ * @param key key of binary
+ * @param format output format of binary
+ * @param binary output binary
+ *
+ * @return true if binary was loaded
+ */
+bool ProgramBinaryCache::load(Key key, GLenum &format, Binary &binary)
+{
+  assert(this != nullptr);
+  auto const it = entries.find(key);
+  if (it == entries.end()) {
+    statistics.misses++;
+    return false;
+  }
+  std::ifstream file(getFileName(key), std::ios::binary);
+  char          magic[sizeof(fileMagic)];
+  uint64_t      fileKey    = 0;
+  uint32_t      fileFormat = 0;
+  uint64_t      length     = 0;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char *>(&fileKey), sizeof(fileKey));
+  file.read(reinterpret_cast<char *>(&fileFormat), sizeof(fileFormat));
+  file.read(reinterpret_cast<char *>(&length), sizeof(length));
+  bool valid = file && std::memcmp(magic, fileMagic, sizeof(magic)) == 0 &&
+               fileKey == key && fileHeaderSize + length == it->second.size;
+  if (valid) {
+    binary.resize(static_cast<size_t>(length));
+    file.read(reinterpret_cast<char *>(binary.data()),
+              static_cast<std::streamsize>(length));
+    valid = file.gcount() == static_cast<std::streamsize>(length);
+  }
+  if (!valid) {
+    binary.clear();
+    statistics.rejected++;
+    remove(key);
+    return false;
+  }
+  format             = static_cast<GLenum>(fileFormat);
+  it->second.lastUse = ++useTime;
+  dirty              = true;
+  statistics.hits++;
+  return true;
+}
+
+/**
+ * @brief Stores binary, least recently used binaries are evicted
+ * if maximal size would be exceeded.
+ * Binaries larger than maximal size are not stored.
+ *
+ * @param key key of binary
+ * @param format format of binary
+ * @param binary binary
+ */
+void ProgramBinaryCache::store(Key key, GLenum format, Binary const &binary)
+{
+  assert(this != nullptr);
+  erase(key);
+  auto const fileSize = fileHeaderSize + binary.size();
+  if (fileSize > maxSize) {
+    writeIndex();
+    return;
+  }
+  evict(fileSize);
+
+  std::ofstream file(getFileName(key), std::ios::binary | std::ios::trunc);
+  uint32_t const fileFormat = format;
+  uint64_t const length     = binary.size();
+  file.write(fileMagic, sizeof(fileMagic));
+  file.write(reinterpret_cast<char const *>(&key), sizeof(key));
+  file.write(reinterpret_cast<char const *>(&fileFormat), sizeof(fileFormat));
+  file.write(reinterpret_cast<char const *>(&length), sizeof(length));
+  file.write(reinterpret_cast<char const *>(binary.data()),
+             static_cast<std::streamsize>(binary.size()));
+  file.close();
+  if (!file) {
+    std::remove(getFileName(key).c_str());
+    writeIndex();
+    return;
+  }
+  auto &entry   = entries[key];
+  entry.size    = fileSize;
+  entry.lastUse = ++useTime;
+  size += fileSize;
+  statistics.stores++;
+  writeIndex();
+}
+
+/**
+ * @brief Removes binary from cache
+ *
+ * @param key key of binary
+ */
+void ProgramBinaryCache::remove(Key key)
+{
+  assert(this != nullptr);
+  if (!contains(key)) return;
+  erase(key);
+  writeIndex();
+}
+
+/**
+ * @brief Is binary in cache
+ *
+ * @param key key of binary
+ *
+ * @return true if cache contains binary
+ */
+bool ProgramBinaryCache::contains(Key key) const
+{
+  assert(this != nullptr);
+  return entries.count(key) != 0;
+}
+
+/**
+ * @brief Removes all binaries and index file
+ */
+void ProgramBinaryCache::clear()
+{
+  assert(this != nullptr);
+  for (auto const &e : entries) std::remove(getFileName(e.first).c_str());
+  entries.clear();
+  size  = 0;
+  dirty = false;
+  std::remove(getIndexFileName().c_str());
+}
+
+/**
+ * @brief Writes index if order of use has changed
+ */
+void ProgramBinaryCache::flush()
+{
+  assert(this != nullptr);
+  if (dirty) writeIndex();
+}
+
+size_t ProgramBinaryCache::getNofBinaries() const
+{
+  assert(this != nullptr);
+  return entries.size();
+}
+
+/**
+ * @brief Gets size of stored binaries
+ *
+ * @return size of binary files (including headers) in bytes
+ */
+size_t ProgramBinaryCache::getSize() const
+{
+  assert(this != nullptr);
+  return size;
+}
+
+size_t ProgramBinaryCache::getMaxSize() const
+{
+  assert(this != nullptr);
+  return maxSize;
+}
+
+/**
+ * @brief Sets maximal size, binaries are evicted if it is exceeded
+ *
+ * @param maxSize maximal size of binary files in bytes
+ */
+void ProgramBinaryCache::setMaxSize(size_t maxSize)
+{
+  assert(this != nullptr);
+  this->maxSize = maxSize;
+  if (size <= maxSize) return;
+  evict(0);
+  writeIndex();
+}
+
+std::string const &ProgramBinaryCache::getDirectory() const
+{
+  assert(this != nullptr);
+  return directory;
+}
+
+ProgramBinaryCache::Statistics const &ProgramBinaryCache::getStatistics() const
+{
+  assert(this != nullptr);
+  return statistics;
+}
+
+/**
+ * @brief Computes key of program
+ *
+ * @param stages shader types and their sources
+ * @param driver driver identification (see getDriver)
+ *
+ * @return key
+ */
+ProgramBinaryCache::Key ProgramBinaryCache::computeKey(
+    Stages const &stages, std::string const &driver)
+{
+  uint64_t h = 14695981039346656037ull;
+  h          = hash(h, driver);
+  for (auto const &s : stages) {
+    uint32_t const type       = s.first;
+    uint64_t const nofSources = s.second.size();
+    h = hash(h, &type, sizeof(type));
+    h = hash(h, &nofSources, sizeof(nofSources));
+    for (auto const &source : s.second) h = hash(h, source);
+  }
+  return h;
+}
+
+/**
+ * @brief Gets driver identification, binaries of different drivers are
+ * stored under different keys
+ *
+ * @param table opengl function table
+ *
+ * @return GL_VENDOR, GL_RENDERER and GL_VERSION strings
+ */
+std::string ProgramBinaryCache::getDriver(FunctionTablePointer const &table)
+{
+  Context gl(table);
+  return getString(gl, GL_VENDOR) + "\n" + getString(gl, GL_RENDERER) + "\n" +
+         getString(gl, GL_VERSION);
+}
+
+std::string ProgramBinaryCache::getFileName(Key key) const
+{
+  std::ostringstream ss;
+  ss << directory << "/" << std::hex << std::setw(16) << std::setfill('0')
+     << key << ".bin";
+  return ss.str();
+}
+
+std::string ProgramBinaryCache::getIndexFileName() const
+{
+  return directory + "/index";
+}
+
+/**
+ * @brief Reads index, missing or damaged index means empty cache
+ */
+void ProgramBinaryCache::readIndex()
+{
+  std::ifstream file(getIndexFileName());
+  std::string   header;
+  if (!std::getline(file, header) || header != indexHeader) return;
+  Key   key;
+  Entry entry;
+  while (file >> std::hex >> key >> std::dec >> entry.size >> entry.lastUse) {
+    if (entries.count(key)) continue;
+    entries[key] = entry;
+    size += entry.size;
+    useTime = std::max(useTime, entry.lastUse);
+  }
+}
+
+/**
+ * @brief Writes index, failures are ignored (cache only gets colder)
+ */
+void ProgramBinaryCache::writeIndex()
+{
+  std::ofstream file(getIndexFileName(), std::ios::trunc);
+  file << indexHeader << std::endl;
+  for (auto const &e : entries)
+    file << std::hex << e.first << " " << std::dec << e.second.size << " "
+         << e.second.lastUse << "\n";
+  dirty = false;
+}
+
+/**
+ * @brief Removes binary file and its entry, index is not written
+ *
+ * @param key key of binary
+ */
+void ProgramBinaryCache::erase(Key key)
+{
+  auto const it = entries.find(key);
+  if (it == entries.end()) return;
+  std::remove(getFileName(key).c_str());
+  size -= it->second.size;
+  entries.erase(it);
+}
+
+/**
+ * @brief Evicts least recently used binaries until binary of required size
+ * fits into maximal size, index is not written
+ *
+ * @param requiredSize size of binary that has to fit
+ */
+void ProgramBinaryCache::evict(size_t requiredSize)
+{
+  while (!entries.empty() && size + requiredSize > maxSize) {
+    auto const oldest = std::min_element(
+        entries.begin(), entries.end(),
+        [](std::pair<Key const, Entry> const &a,
+           std::pair<Key const, Entry> const &b) {
+          return a.second.lastUse < b.second.lastUse;
+        });
+    erase(oldest->first);
+    statistics.evictions++;
+  }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <geGL/Program.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief On-disk cache of program binaries.
+ *
+ * createProgram() hashes shader sources, stage types and driver strings
+ * (vendor, renderer, version). If the directory contains binary for the hash,
+ * program is created using glProgramBinary without compiling shaders.
+ * Otherwise shaders are compiled, program is linked and its binary
+ * (glGetProgramBinary) is stored. Binaries rejected by driver (unknown format,
+ * driver update) are removed and program is compiled as usual.
+ * Program reflection (ProgramInfo) is filled in both cases.
+ *
+ * Every binary is one file in the directory, index file keeps sizes and
+ * order of last use. When total size exceeds maximal size, least recently
+ * used binaries are evicted. load()/store() do not need OpenGL.
+ * Cache is not thread safe.
+ *
+ * @code
+ * ProgramBinaryCache cache("shaderCache");
+ * auto program = cache.createProgram({
+ *     {GL_VERTEX_SHADER  ,{"#version 450\n",vsSource}},
+ *     {GL_FRAGMENT_SHADER,{"#version 450\n",fsSource}}});
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::ProgramBinaryCache {
+ public:
+  using Key    = uint64_t;
+  using Binary = std::vector<uint8_t>;
+  using Stage  = std::pair<GLenum, Shader::Sources>;  ///< shader type, sources
+  using Stages = std::vector<Stage>;
+  /**
+   * @brief Cache statistics
+   */
+  struct Statistics {
+    size_t hits      = 0;  ///< binaries loaded
+    size_t misses    = 0;  ///< keys that were not in cache
+    size_t stores    = 0;  ///< binaries stored
+    size_t evictions = 0;  ///< binaries evicted by size limit
+    size_t rejected  = 0;  ///< corrupted binaries or binaries rejected by driver
+  };
+  ProgramBinaryCache(std::string const& directory,
+                     size_t             maxSize = 256 * 1024 * 1024);
+  ~ProgramBinaryCache();
+  std::shared_ptr<Program> createProgram(Stages const& stages);
+  std::shared_ptr<Program> createProgram(FunctionTablePointer const& table,
+                                         Stages const&               stages);
+  bool               load(Key key, GLenum& format, Binary& binary);
+  void               store(Key key, GLenum format, Binary const& binary);
+  void               remove(Key key);
+  bool               contains(Key key) const;
+  void               clear();
+  void               flush();
+  size_t             getNofBinaries() const;
+  size_t             getSize() const;
+  size_t             getMaxSize() const;
+  void               setMaxSize(size_t maxSize);
+  std::string const& getDirectory() const;
+  Statistics const&  getStatistics() const;
+
+  static Key         computeKey(Stages const& stages, std::string const& driver);
+  static std::string getDriver(FunctionTablePointer const& table);
+
+ protected:
+  struct Entry {
+    size_t   size    = 0;  ///< size of file in bytes
+    uint64_t lastUse = 0;
+  };
+  std::string        getFileName(Key key) const;
+  std::string        getIndexFileName() const;
+  void               readIndex();
+  void               writeIndex();
+  void               erase(Key key);
+  void               evict(size_t requiredSize);
+  std::string          directory;
+  size_t               maxSize;
+  size_t               size    = 0;
+  uint64_t             useTime = 0;
+  bool                 dirty   = false;  ///< index has to be written
+  std::map<Key, Entry> entries;
+  Statistics           statistics;
+};
@@ -0,0 +1,166 @@
+#include <geGL/ProgramCompiler.h>
+#include <geGL/OpenGLContext.h>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+using namespace ge::gl;
+
+GLuint const ProgramCompiler::ALL_THREADS;
+
+namespace {
+bool hasExtension(Context const &gl, char const *name)
+{
+  GLint nofExtensions = 0;
+  gl.glGetIntegerv(GL_NUM_EXTENSIONS, &nofExtensions);
+  for (GLint i = 0; i < nofExtensions; ++i) {
+    auto const extension = reinterpret_cast<char const *>(
+        gl.glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+    if (extension && std::strcmp(extension, name) == 0) return true;
+  }
+  return false;
+}
+}  // namespace
+
+/**
+ * @brief Constructor that uses default context
+ *
+ * @param maxCompilerThreads maximal number of driver compiler threads
+ */
+ProgramCompiler::ProgramCompiler(GLuint maxCompilerThreads)
+    : ProgramCompiler(nullptr, maxCompilerThreads)
+{
+}
+
+/**
+ * @brief Constructor, it detects parallel shader compile extension and sets
+ * number of driver compiler threads
+ *
+ * @param table opengl function table
+ * @param maxCompilerThreads maximal number of driver compiler threads,
+ * ALL_THREADS lets driver decide, 0 disables parallel compilation
+ */
+ProgramCompiler::ProgramCompiler(FunctionTablePointer const &table,
+                                 GLuint                      maxCompilerThreads)
+    : gl(table)
+{
+  if (hasExtension(gl, "GL_KHR_parallel_shader_compile")) {
+    gl.glMaxShaderCompilerThreadsKHR(maxCompilerThreads);
+    parallel = true;
+  } else if (hasExtension(gl, "GL_ARB_parallel_shader_compile")) {
+    gl.glMaxShaderCompilerThreadsARB(maxCompilerThreads);
+    parallel = true;
+  }
+  if (maxCompilerThreads == 0) parallel = false;
+}
+
+/**
+ * @brief Destructor, it waits for pending programs so their futures are
+ * fulfilled
+ */
+ProgramCompiler::~ProgramCompiler() { finish(); }
+
+/**
+ * @brief Starts compilation of shaders and linking of program
+ *
+ * @param stages shader types and their sources
+ *
+ * @return future with program, it is fulfilled by pump()
+ */
+ProgramCompiler::Future ProgramCompiler::compile(Stages const &stages)
+{
+  assert(this != nullptr);
+  auto const &table = gl.getFunctionTable();
+  Request     request;
+  for (auto const &s : stages) {
+    auto shader = std::make_shared<Shader>(table);
+    shader->create(s.first);
+    shader->compileAsync(s.second);
+    request.shaders.push_back(shader);
+  }
+  request.program = std::make_shared<Program>(table);
+  request.program->linkAsync(request.shaders);
+  auto future = request.promise.get_future();
+  pending.push_back(std::move(request));
+  statistics.submitted++;
+  return future;
+}
+
+/**
+ * @brief Fulfils futures of finished programs, it does not block
+ * if compilation is parallel
+ *
+ * @return number of fulfilled futures
+ */
+size_t ProgramCompiler::pump()
+{
+  assert(this != nullptr);
+  size_t completed = 0;
+  for (auto it = pending.begin(); it != pending.end();) {
+    if (!isCompleted(*it)) {
+      ++it;
+      continue;
+    }
+    complete(*it);
+    it = pending.erase(it);
+    completed++;
+  }
+  return completed;
+}
+
+/**
+ * @brief Waits for all pending programs and fulfils their futures
+ */
+void ProgramCompiler::finish()
+{
+  assert(this != nullptr);
+  while (!pending.empty()) {
+    complete(pending.front());
+    pending.pop_front();
+  }
+}
+
+size_t ProgramCompiler::getNofPending() const
+{
+  assert(this != nullptr);
+  return pending.size();
+}
+
+/**
+ * @brief Does driver compile programs in background
+ *
+ * @return true if GL_KHR_parallel_shader_compile or
+ * GL_ARB_parallel_shader_compile is used
+ */
+bool ProgramCompiler::isParallel() const
+{
+  assert(this != nullptr);
+  return parallel;
+}
+
+ProgramCompiler::Statistics const &ProgramCompiler::getStatistics() const
+{
+  assert(this != nullptr);
+  return statistics;
+}
+
+bool ProgramCompiler::isCompleted(Request const &request)
+{
+  if (!parallel) return true;
+  statistics.polls++;
+  GLint status = GL_TRUE;
+  gl.glGetProgramiv(request.program->getId(), GL_COMPLETION_STATUS_KHR,
+                    &status);
+  return status != GL_FALSE;
+}
+
+void ProgramCompiler::complete(Request &request)
+{
+  if (!request.program->getLinkStatus()) {
+    for (auto const &s : request.shaders)
+      if (!s->getCompileStatus()) std::cerr << s->getInfoLog() << std::endl;
+    statistics.failed++;
+  }
+  statistics.completed++;
+  request.promise.set_value(request.program);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <geGL/Program.h>
+#include <deque>
+#include <future>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Asynchronous compilation and linking of programs.
+ *
+ * compile() creates shaders, starts their compilation and linking of program
+ * without querying any status, so the driver is not forced to finish.
+ * With GL_KHR_parallel_shader_compile (or ARB variant) the driver compiles on
+ * its own threads (glMaxShaderCompilerThreadsKHR) and pump() polls
+ * GL_COMPLETION_STATUS_KHR without blocking. Without the extension pump()
+ * completes programs in submission order and may block in the driver.
+ * pump() has to be called by thread of the context (e.g. once per frame of
+ * loading screen), it fulfils futures of finished programs.
+ * Reflection (ProgramInfo) of finished programs is filled lazily when they
+ * are used for the first time. Programs that fail to link are returned too,
+ * check their link status.
+ *
+ * @code
+ * ProgramCompiler compiler;
+ * std::vector<ProgramCompiler::Future>programs;
+ * for(auto const&s:allShaderSources)programs.push_back(compiler.compile(s));
+ * while(compiler.getNofPending()){
+ *   compiler.pump();
+ *   ...draw loading screen...
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::ProgramCompiler {
+ public:
+  using Stage          = std::pair<GLenum, Shader::Sources>;  ///< shader type, sources
+  using Stages         = std::vector<Stage>;
+  using ProgramPointer = std::shared_ptr<Program>;
+  using Future         = std::future<ProgramPointer>;
+  static GLuint const ALL_THREADS = 0xffffffff;
+  /**
+   * @brief Compilation statistics
+   */
+  struct Statistics {
+    size_t submitted = 0;  ///< number of compiled programs
+    size_t completed = 0;  ///< number of fulfilled futures
+    size_t failed    = 0;  ///< completed programs that did not link
+    size_t polls     = 0;  ///< completion status queries
+  };
+  ProgramCompiler(GLuint maxCompilerThreads = ALL_THREADS);
+  ProgramCompiler(FunctionTablePointer const& table,
+                  GLuint                      maxCompilerThreads = ALL_THREADS);
+  ~ProgramCompiler();
+  ProgramCompiler(ProgramCompiler const&) = delete;
+  ProgramCompiler& operator=(ProgramCompiler const&) = delete;
+  Future            compile(Stages const& stages);
+  size_t            pump();
+  void              finish();
+  size_t            getNofPending() const;
+  bool              isParallel() const;
+  Statistics const& getStatistics() const;
+
+ protected:
+  struct Request {
+    ProgramPointer               program;
+    Program::ShaderPointers      shaders;
+    std::promise<ProgramPointer> promise;
+  };
+  bool                isCompleted(Request const& request);
+  void                complete(Request& request);
+  Context             gl;
+  bool                parallel = false;  ///< driver compiles in background
+  std::deque<Request> pending;
+  Statistics          statistics;
+};
@@ -52,6 +52,36 @@ class ge::gl::ProgramInfo{
       BUFFER_REFERENCED_BY_COMPUTE_SHADER         = 9,
     };
 
+    using UniformBlockMemberProperties = std::tuple<
+      std::string,
+      GLenum     ,
+      GLint      ,
+      GLint      ,
+      GLint      ,
+      GLint      ,
+      GLint      >;
+    enum UniformBlockMemberPropertiesParts{
+      MEMBER_NAME          = 0,
+      MEMBER_TYPE          = 1,
+      MEMBER_SIZE          = 2,///< number of array elements, 1 for non-arrays
+      MEMBER_OFFSET        = 3,///< offset in bytes from start of block
+      MEMBER_ARRAY_STRIDE  = 4,///< 0 for non-arrays
+      MEMBER_MATRIX_STRIDE = 5,///< 0 for non-matrices
+      MEMBER_ROW_MAJOR     = 6,
+    };
+
+    using UniformBlockProperties = std::tuple<
+      std::string,
+      GLint      ,
+      GLint      ,
+      std::map<std::string,UniformBlockMemberProperties>>;
+    enum UniformBlockPropertiesParts{
+      UNIFORM_BLOCK_NAME      = 0,
+      UNIFORM_BLOCK_BINDING   = 1,
+      UNIFORM_BLOCK_DATA_SIZE = 2,
+      UNIFORM_BLOCK_MEMBERS   = 3,
+    };
+
     using SubroutineUniformProperties = std::tuple<
       GLint      ,
                  GLint      ,
@@ -69,6 +99,7 @@ class ge::gl::ProgramInfo{
     std::map<std::string,Properties                 >attribs           ;
     std::map<std::string,Properties                 >uniforms          ;
     std::map<std::string,BufferProperties           >buffers           ;
+    std::map<std::string,UniformBlockProperties     >uniformBlocks     ;
     std::map<std::string,SubroutineUniformProperties>subroutineUniforms;
 
 };
@@ -0,0 +1,217 @@
+#include <geGL/RangeAllocator.h>
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+size_t const RangeAllocator::INVALID;
+
+namespace {
+size_t alignUp(size_t offset, size_t alignment)
+{
+  return (offset + alignment - 1) / alignment * alignment;
+}
+}  // namespace
+
+/**
+ * @brief Constructor
+ *
+ * @param capacity size of managed memory in bytes
+ */
+RangeAllocator::RangeAllocator(size_t capacity) : capacity(capacity)
+{
+  addFreeRange(0, capacity);
+}
+
+/**
+ * @brief Allocates range, the smallest free range that fits is used
+ *
+ * @param size size of range in bytes
+ * @param alignment alignment of offset
+ *
+ * @return offset of range or INVALID if there is no free range that fits
+ */
+size_t RangeAllocator::allocate(size_t size, size_t alignment)
+{
+  assert(this != nullptr);
+  if (size == 0)
+    throw std::invalid_argument(
+        "geGL: RangeAllocator::allocate - size has to be positive");
+  if (alignment == 0) alignment = 1;
+
+  auto best = freeRanges.end();
+  for (auto it = freeRanges.begin(); it != freeRanges.end(); ++it) {
+    auto const start = alignUp(it->first, alignment);
+    if (start + size > it->first + it->second) continue;
+    if (best == freeRanges.end() || it->second < best->second) best = it;
+  }
+  if (best == freeRanges.end()) return INVALID;
+
+  auto const rangeOffset = best->first;
+  auto const rangeSize   = best->second;
+  auto const offset      = alignUp(rangeOffset, alignment);
+  freeRanges.erase(best);
+  if (offset > rangeOffset) freeRanges[rangeOffset] = offset - rangeOffset;
+  if (offset + size < rangeOffset + rangeSize)
+    freeRanges[offset + size] = rangeOffset + rangeSize - offset - size;
+
+  allocations[offset] = Block{size, alignment};
+  used += size;
+  peakUsed = std::max(peakUsed, used);
+  return offset;
+}
+
+/**
+ * @brief Frees range
+ *
+ * @param offset offset returned by allocate
+ */
+void RangeAllocator::free(size_t offset)
+{
+  assert(this != nullptr);
+  auto const it = allocations.find(offset);
+  if (it == allocations.end())
+    throw std::invalid_argument(
+        "geGL: RangeAllocator::free - offset is not allocated");
+  auto const size = it->second.size;
+  allocations.erase(it);
+  used -= size;
+  addFreeRange(offset, size);
+}
+
+/**
+ * @brief Enlarges managed memory, new space is appended to the end
+ *
+ * @param newCapacity new size of managed memory in bytes
+ */
+void RangeAllocator::grow(size_t newCapacity)
+{
+  assert(this != nullptr);
+  if (newCapacity <= capacity) return;
+  auto const oldCapacity = capacity;
+  capacity               = newCapacity;
+  addFreeRange(oldCapacity, newCapacity - oldCapacity);
+}
+
+/**
+ * @brief Packs allocations to the beginning of memory, their order and
+ * alignment are kept. Moves are sorted by offset and move data towards the
+ * beginning, so applying them in order never overwrites data that was not
+ * moved yet (source and destination of one move can overlap).
+ *
+ * @return moves that have to be applied to the memory
+ */
+std::vector<RangeAllocator::Move> RangeAllocator::compact()
+{
+  assert(this != nullptr);
+  std::vector<Move>       moves;
+  std::map<size_t, Block> packed;
+  size_t                  end = 0;
+  for (auto const& a : allocations) {
+    auto const offset = alignUp(end, a.second.alignment);
+    if (offset != a.first) {
+      Move move;
+      move.from = a.first;
+      move.to   = offset;
+      move.size = a.second.size;
+      moves.push_back(move);
+    }
+    packed[offset] = a.second;
+    end            = offset + a.second.size;
+  }
+  allocations.swap(packed);
+  freeRanges.clear();
+  end = 0;
+  for (auto const& a : allocations) {
+    if (a.first > end) freeRanges[end] = a.first - end;
+    end = a.first + a.second.size;
+  }
+  if (capacity > end) freeRanges[end] = capacity - end;
+  return moves;
+}
+
+/**
+ * @brief Frees all ranges
+ */
+void RangeAllocator::clear()
+{
+  assert(this != nullptr);
+  allocations.clear();
+  freeRanges.clear();
+  used = 0;
+  addFreeRange(0, capacity);
+}
+
+bool RangeAllocator::isAllocated(size_t offset) const
+{
+  return allocations.count(offset) != 0;
+}
+
+/**
+ * @brief gets size of allocation
+ *
+ * @param offset offset of allocation
+ *
+ * @return size of allocation or 0 if offset is not allocated
+ */
+size_t RangeAllocator::getAllocationSize(size_t offset) const
+{
+  auto const it = allocations.find(offset);
+  if (it == allocations.end()) return 0;
+  return it->second.size;
+}
+
+size_t RangeAllocator::getCapacity() const { return capacity; }
+
+size_t RangeAllocator::getUsed() const { return used; }
+
+size_t RangeAllocator::getNofAllocations() const { return allocations.size(); }
+
+/**
+ * @brief gets usage statistics
+ *
+ * @return statistics
+ */
+RangeAllocator::Statistics RangeAllocator::getStatistics() const
+{
+  Statistics s;
+  s.capacity       = capacity;
+  s.used           = used;
+  s.peakUsed       = peakUsed;
+  s.nofAllocations = allocations.size();
+  s.nofFreeRanges  = freeRanges.size();
+  for (auto const& r : freeRanges)
+    s.largestFreeRange = std::max(s.largestFreeRange, r.second);
+  auto const freeBytes = capacity - used;
+  if (freeBytes > 0)
+    s.fragmentation = 1.f - static_cast<float>(s.largestFreeRange) /
+                                static_cast<float>(freeBytes);
+  return s;
+}
+
+/**
+ * @brief Inserts free range and merges it with adjacent free ranges
+ *
+ * @param offset offset of range
+ * @param size size of range
+ */
+void RangeAllocator::addFreeRange(size_t offset, size_t size)
+{
+  if (size == 0) return;
+  auto next = freeRanges.lower_bound(offset);
+  if (next != freeRanges.begin()) {
+    auto const prev = std::prev(next);
+    if (prev->first + prev->second == offset) {
+      offset = prev->first;
+      size += prev->second;
+      freeRanges.erase(prev);
+    }
+  }
+  if (next != freeRanges.end() && offset + size == next->first) {
+    size += next->second;
+    freeRanges.erase(next);
+  }
+  freeRanges[offset] = size;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <geGL/gegl_export.h>
+#include <geGL/Fwd.h>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+/**
+ * @brief Free-list allocator of ranges of abstract memory (e.g. buffer).
+ * It does not touch OpenGL, it only manages offsets.
+ * Allocation uses best fit over free ranges, freed ranges are coalesced with
+ * their neighbours. compact() packs allocations to the beginning and returns
+ * moves that have to be applied to the memory.
+ */
+class GEGL_EXPORT ge::gl::RangeAllocator {
+ public:
+  static size_t const INVALID = ~static_cast<size_t>(0);  ///< failed allocation
+  /**
+   * @brief Relocation of allocation made by compact()
+   */
+  struct Move {
+    size_t from = 0;  ///< old offset
+    size_t to   = 0;  ///< new offset
+    size_t size = 0;  ///< size of allocation
+  };
+  /**
+   * @brief Usage statistics
+   */
+  struct Statistics {
+    size_t capacity         = 0;  ///< managed size in bytes
+    size_t used             = 0;  ///< allocated bytes
+    size_t peakUsed         = 0;  ///< maximal number of allocated bytes
+    size_t nofAllocations   = 0;  ///< number of live allocations
+    size_t nofFreeRanges    = 0;  ///< number of free ranges
+    size_t largestFreeRange = 0;  ///< size of largest free range
+    float  fragmentation    = 0.f;  ///< 1 - largestFreeRange / free bytes
+  };
+  RangeAllocator(size_t capacity = 0);
+  size_t            allocate(size_t size, size_t alignment = 1);
+  void              free(size_t offset);
+  void              grow(size_t newCapacity);
+  std::vector<Move> compact();
+  void              clear();
+  bool              isAllocated(size_t offset) const;
+  size_t            getAllocationSize(size_t offset) const;
+  size_t            getCapacity() const;
+  size_t            getUsed() const;
+  size_t            getNofAllocations() const;
+  Statistics        getStatistics() const;
+
+ protected:
+  struct Block {
+    size_t size;
+    size_t alignment;
+  };
+  void                     addFreeRange(size_t offset, size_t size);
+  std::map<size_t, size_t> freeRanges;   ///< offset -> size of free range
+  std::map<size_t, Block>  allocations;  ///< offset -> allocation
+  size_t                   capacity = 0;
+  size_t                   used     = 0;
+  size_t                   peakUsed = 0;
+};
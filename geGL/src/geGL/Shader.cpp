@@ -116,6 +116,19 @@ void Shader::compile(Sources const& sources){
   }
 }
 
+/**
+ * @brief this function sets shader source code and starts compilation.
+ * It does not wait for compiler (compile status is not queried) and
+ * it does not relink programs that are using this shader.
+ *
+ * @param sources optional source codes
+ */
+void Shader::compileAsync(Sources const& sources){
+  assert(this!=nullptr);
+  if(sources.size()>0)this->setSource(sources);
+  this->getContext().glCompileShader(this->getId());
+}
+
 /**
  * @brief function returns true if object represents valid shader
  *
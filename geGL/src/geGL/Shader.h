@@ -23,6 +23,7 @@ class GEGL_EXPORT ge::gl::Shader:public OpenGLObject{
   void        create(GLenum type);
   void        setSource(Sources const& sources = {});
   void        compile  (Sources const& sources = {});
+  void        compileAsync(Sources const& sources = {});
   GLboolean   isShader        ()const;
   GLenum      getType         ()const;
   GLboolean   getDeleteStatus ()const;
@@ -0,0 +1,21 @@
+#pragma once
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief Interface of function tables that shadow OpenGL state
+     * Decorators that shadow state derive from it virtually,
+     * so one table has one interface no matter how many such decorators it contains.
+     */
+    class StateCacheInterface{
+      public:
+        virtual ~StateCacheInterface(){}
+        /**
+         * @brief This function forgets all shadowed state.
+         * It has to be called when OpenGL state is changed
+         * behind the back of the function table (third-party libraries, ...).
+         */
+        virtual void invalidate()const = 0;
+    };
+  }
+}
@@ -0,0 +1,354 @@
+#pragma once
+
+#include<map>
+#include<utility>
+#include<type_traits>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/StateCacheInterface.h>
+
+#define CACHE_STATE(name)\
+  this->m_orig_##name = this->m_ptr_##name;\
+  if(this->m_ptr_##name)\
+    this->m_ptr_##name =\
+      (decltype(FunctionTable::m_ptr_##name))\
+        &StateCacheTableDecorator::m_##name##_cache
+
+#define DECLARE_ORIGINAL(name)\
+  decltype(FunctionTable::m_ptr_##name)m_orig_##name = nullptr
+
+#define CALL_ORIGINAL(name)\
+  (this->*(this->m_orig_##name))
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief This decorator shadows binding and enable/disable state
+     * and drops calls that would not change it.
+     * Shadowed state starts unknown, so first call of every binding always reaches the driver.
+     *
+     * Tracked state:
+     * current program, vertex array,
+     * generic and indexed buffer bindings,
+     * active texture, per unit texture bindings, per unit sampler bindings,
+     * glEnable/glDisable capabilities.
+     */
+    template<typename T>
+      class StateCacheTableDecorator: public T, public virtual StateCacheInterface{
+        public:
+          template<typename...ARGS>
+            StateCacheTableDecorator(ARGS&&...args):T(args...){}
+          virtual ~StateCacheTableDecorator(){}
+          virtual void invalidate()const override{
+            assert(this!=nullptr);
+            this->m_programKnown       = false;
+            this->m_vertexArrayKnown   = false;
+            this->m_activeTextureKnown = false;
+            this->m_buffers       .clear();
+            this->m_indexedBuffers.clear();
+            this->m_textures      .clear();
+            this->m_textureUnits  .clear();
+            this->m_samplers      .clear();
+            this->m_capabilities  .clear();
+            this->m_invalidateBase(std::is_base_of<StateCacheInterface,T>{});
+          }
+        protected:
+          void m_invalidateBase(std::true_type )const{T::invalidate();}
+          void m_invalidateBase(std::false_type)const{}
+          virtual bool m_init(){
+            assert(this!=nullptr);
+            if(!T::m_init())return false;
+            CACHE_STATE(glUseProgram              );
+            CACHE_STATE(glBindVertexArray         );
+            CACHE_STATE(glDeleteVertexArrays      );
+            CACHE_STATE(glVertexArrayElementBuffer);
+            CACHE_STATE(glBindBuffer              );
+            CACHE_STATE(glBindBufferBase          );
+            CACHE_STATE(glBindBufferRange         );
+            CACHE_STATE(glBindBuffersBase         );
+            CACHE_STATE(glBindBuffersRange        );
+            CACHE_STATE(glDeleteBuffers           );
+            CACHE_STATE(glActiveTexture           );
+            CACHE_STATE(glBindTexture             );
+            CACHE_STATE(glBindTextureUnit         );
+            CACHE_STATE(glBindTextures            );
+            CACHE_STATE(glDeleteTextures          );
+            CACHE_STATE(glBindSampler             );
+            CACHE_STATE(glBindSamplers            );
+            CACHE_STATE(glDeleteSamplers          );
+            CACHE_STATE(glEnable                  );
+            CACHE_STATE(glDisable                 );
+            CACHE_STATE(glEnablei                 );
+            CACHE_STATE(glDisablei                );
+            CACHE_STATE(glIsEnabled               );
+            return true;
+          }
+
+          struct IndexedBuffer{
+            GLuint     buffer;
+            GLintptr   offset;
+            GLsizeiptr size  ;
+            bool       whole ;
+            bool operator==(IndexedBuffer const&other)const{
+              return buffer == other.buffer &&
+                     offset == other.offset &&
+                     size   == other.size   &&
+                     whole  == other.whole  ;
+            }
+          };
+
+          mutable bool                                         m_programKnown       = false;
+          mutable GLuint                                       m_program            = 0    ;
+          mutable bool                                         m_vertexArrayKnown   = false;
+          mutable GLuint                                       m_vertexArray        = 0    ;
+          mutable bool                                         m_activeTextureKnown = false;
+          mutable GLuint                                       m_activeTexture      = 0    ;
+          mutable std::map<GLenum,GLuint>                      m_buffers                   ;
+          mutable std::map<std::pair<GLenum,GLuint>,IndexedBuffer>m_indexedBuffers         ;
+          mutable std::map<std::pair<GLuint,GLenum>,GLuint>    m_textures                  ;
+          mutable std::map<GLuint,GLuint>                      m_textureUnits              ;
+          mutable std::map<GLuint,GLuint>                      m_samplers                  ;
+          mutable std::map<GLenum,GLboolean>                   m_capabilities              ;
+
+          DECLARE_ORIGINAL(glUseProgram              );
+          DECLARE_ORIGINAL(glBindVertexArray         );
+          DECLARE_ORIGINAL(glDeleteVertexArrays      );
+          DECLARE_ORIGINAL(glVertexArrayElementBuffer);
+          DECLARE_ORIGINAL(glBindBuffer              );
+          DECLARE_ORIGINAL(glBindBufferBase          );
+          DECLARE_ORIGINAL(glBindBufferRange         );
+          DECLARE_ORIGINAL(glBindBuffersBase         );
+          DECLARE_ORIGINAL(glBindBuffersRange        );
+          DECLARE_ORIGINAL(glDeleteBuffers           );
+          DECLARE_ORIGINAL(glActiveTexture           );
+          DECLARE_ORIGINAL(glBindTexture             );
+          DECLARE_ORIGINAL(glBindTextureUnit         );
+          DECLARE_ORIGINAL(glBindTextures            );
+          DECLARE_ORIGINAL(glDeleteTextures          );
+          DECLARE_ORIGINAL(glBindSampler             );
+          DECLARE_ORIGINAL(glBindSamplers            );
+          DECLARE_ORIGINAL(glDeleteSamplers          );
+          DECLARE_ORIGINAL(glEnable                  );
+          DECLARE_ORIGINAL(glDisable                 );
+          DECLARE_ORIGINAL(glEnablei                 );
+          DECLARE_ORIGINAL(glDisablei                );
+          DECLARE_ORIGINAL(glIsEnabled               );
+
+          template<typename MAP,typename PREDICATE>
+            static void m_eraseIf(MAP&map,PREDICATE const&predicate){
+              for(auto it = map.begin();it != map.end();){
+                if(predicate(*it))it = map.erase(it);
+                else ++it;
+              }
+            }
+
+          void m_forgetTextureUnits(GLuint first,GLsizei count)const{
+            auto const last = first + static_cast<GLuint>(count);
+            m_eraseIf(this->m_textures    ,[&](auto const&v){return v.first.first >= first && v.first.first < last;});
+            m_eraseIf(this->m_textureUnits,[&](auto const&v){return v.first       >= first && v.first       < last;});
+          }
+
+          void m_glUseProgram_cache(GLuint program)const{
+            if(this->m_programKnown && this->m_program == program)return;
+            CALL_ORIGINAL(glUseProgram)(program);
+            this->m_programKnown = true;
+            this->m_program      = program;
+          }
+
+          void m_glBindVertexArray_cache(GLuint array)const{
+            if(this->m_vertexArrayKnown && this->m_vertexArray == array)return;
+            CALL_ORIGINAL(glBindVertexArray)(array);
+            this->m_vertexArrayKnown = true;
+            this->m_vertexArray      = array;
+            //element array buffer binding is part of vertex array state
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+          }
+
+          void m_glDeleteVertexArrays_cache(GLsizei n,GLuint const*arrays)const{
+            CALL_ORIGINAL(glDeleteVertexArrays)(n,arrays);
+            if(!this->m_vertexArrayKnown)return;
+            for(GLsizei i=0;i<n;++i){
+              if(arrays[i] != this->m_vertexArray)continue;
+              this->m_vertexArray = 0;
+              this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+            }
+          }
+
+          void m_glVertexArrayElementBuffer_cache(GLuint vaobj,GLuint buffer)const{
+            CALL_ORIGINAL(glVertexArrayElementBuffer)(vaobj,buffer);
+            if(this->m_vertexArrayKnown && this->m_vertexArray != vaobj)return;
+            this->m_buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+          }
+
+          void m_glBindBuffer_cache(GLenum target,GLuint buffer)const{
+            auto const it = this->m_buffers.find(target);
+            if(it != this->m_buffers.end() && it->second == buffer)return;
+            CALL_ORIGINAL(glBindBuffer)(target,buffer);
+            this->m_buffers[target] = buffer;
+          }
+
+          void m_bindIndexedBuffer(GLenum target,GLuint index,IndexedBuffer const&binding)const{
+            this->m_indexedBuffers[std::make_pair(target,index)] = binding;
+            //indexed binding also changes generic binding
+            this->m_buffers[target] = binding.buffer;
+          }
+
+          bool m_isIndexedBufferBound(GLenum target,GLuint index,IndexedBuffer const&binding)const{
+            auto const it = this->m_indexedBuffers.find(std::make_pair(target,index));
+            if(it == this->m_indexedBuffers.end())return false;
+            if(!(it->second == binding))return false;
+            auto const generic = this->m_buffers.find(target);
+            return generic != this->m_buffers.end() && generic->second == binding.buffer;
+          }
+
+          void m_glBindBufferBase_cache(GLenum target,GLuint index,GLuint buffer)const{
+            auto const binding = IndexedBuffer{buffer,0,0,true};
+            if(this->m_isIndexedBufferBound(target,index,binding))return;
+            CALL_ORIGINAL(glBindBufferBase)(target,index,buffer);
+            this->m_bindIndexedBuffer(target,index,binding);
+          }
+
+          void m_glBindBufferRange_cache(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size)const{
+            auto const binding = IndexedBuffer{buffer,offset,size,false};
+            if(this->m_isIndexedBufferBound(target,index,binding))return;
+            CALL_ORIGINAL(glBindBufferRange)(target,index,buffer,offset,size);
+            this->m_bindIndexedBuffer(target,index,binding);
+          }
+
+          void m_forgetIndexedBuffers(GLenum target,GLuint first,GLsizei count)const{
+            auto const last = first + static_cast<GLuint>(count);
+            m_eraseIf(this->m_indexedBuffers,[&](auto const&v){
+                return v.first.first == target && v.first.second >= first && v.first.second < last;});
+          }
+
+          void m_glBindBuffersBase_cache(GLenum target,GLuint first,GLsizei count,GLuint const*buffers)const{
+            CALL_ORIGINAL(glBindBuffersBase)(target,first,count,buffers);
+            this->m_forgetIndexedBuffers(target,first,count);
+          }
+
+          void m_glBindBuffersRange_cache(GLenum target,GLuint first,GLsizei count,GLuint const*buffers,GLintptr const*offsets,GLsizeiptr const*sizes)const{
+            CALL_ORIGINAL(glBindBuffersRange)(target,first,count,buffers,offsets,sizes);
+            this->m_forgetIndexedBuffers(target,first,count);
+          }
+
+          void m_glDeleteBuffers_cache(GLsizei n,GLuint const*buffers)const{
+            CALL_ORIGINAL(glDeleteBuffers)(n,buffers);
+            for(GLsizei i=0;i<n;++i){
+              auto const id = buffers[i];
+              if(id == 0)continue;
+              for(auto&b:this->m_buffers)
+                if(b.second == id)b.second = 0;
+              m_eraseIf(this->m_indexedBuffers,[&](auto const&v){return v.second.buffer == id;});
+            }
+          }
+
+          void m_glActiveTexture_cache(GLenum texture)const{
+            auto const unit = static_cast<GLuint>(texture - GL_TEXTURE0);
+            if(this->m_activeTextureKnown && this->m_activeTexture == unit)return;
+            CALL_ORIGINAL(glActiveTexture)(texture);
+            this->m_activeTextureKnown = true;
+            this->m_activeTexture      = unit;
+          }
+
+          void m_glBindTexture_cache(GLenum target,GLuint texture)const{
+            if(!this->m_activeTextureKnown){
+              CALL_ORIGINAL(glBindTexture)(target,texture);
+              m_eraseIf(this->m_textures,[&](auto const&v){return v.first.second == target;});
+              this->m_textureUnits.clear();
+              return;
+            }
+            auto const key = std::make_pair(this->m_activeTexture,target);
+            auto const it  = this->m_textures.find(key);
+            if(it != this->m_textures.end() && it->second == texture)return;
+            CALL_ORIGINAL(glBindTexture)(target,texture);
+            this->m_textures[key] = texture;
+            this->m_textureUnits.erase(this->m_activeTexture);
+          }
+
+          void m_glBindTextureUnit_cache(GLuint unit,GLuint texture)const{
+            auto const it = this->m_textureUnits.find(unit);
+            if(it != this->m_textureUnits.end() && it->second == texture)return;
+            CALL_ORIGINAL(glBindTextureUnit)(unit,texture);
+            this->m_forgetTextureUnits(unit,1);
+            this->m_textureUnits[unit] = texture;
+          }
+
+          void m_glBindTextures_cache(GLuint first,GLsizei count,GLuint const*textures)const{
+            CALL_ORIGINAL(glBindTextures)(first,count,textures);
+            this->m_forgetTextureUnits(first,count);
+          }
+
+          void m_glDeleteTextures_cache(GLsizei n,GLuint const*textures)const{
+            CALL_ORIGINAL(glDeleteTextures)(n,textures);
+            for(GLsizei i=0;i<n;++i){
+              auto const id = textures[i];
+              if(id == 0)continue;
+              for(auto&t:this->m_textures)
+                if(t.second == id)t.second = 0;
+              m_eraseIf(this->m_textureUnits,[&](auto const&v){return v.second == id;});
+            }
+          }
+
+          void m_glBindSampler_cache(GLuint unit,GLuint sampler)const{
+            auto const it = this->m_samplers.find(unit);
+            if(it != this->m_samplers.end() && it->second == sampler)return;
+            CALL_ORIGINAL(glBindSampler)(unit,sampler);
+            this->m_samplers[unit] = sampler;
+          }
+
+          void m_glBindSamplers_cache(GLuint first,GLsizei count,GLuint const*samplers)const{
+            CALL_ORIGINAL(glBindSamplers)(first,count,samplers);
+            auto const last = first + static_cast<GLuint>(count);
+            m_eraseIf(this->m_samplers,[&](auto const&v){return v.first >= first && v.first < last;});
+          }
+
+          void m_glDeleteSamplers_cache(GLsizei count,GLuint const*samplers)const{
+            CALL_ORIGINAL(glDeleteSamplers)(count,samplers);
+            for(GLsizei i=0;i<count;++i){
+              auto const id = samplers[i];
+              if(id == 0)continue;
+              for(auto&s:this->m_samplers)
+                if(s.second == id)s.second = 0;
+            }
+          }
+
+          bool m_isCapability(GLenum cap,GLboolean value)const{
+            auto const it = this->m_capabilities.find(cap);
+            return it != this->m_capabilities.end() && it->second == value;
+          }
+
+          void m_glEnable_cache(GLenum cap)const{
+            if(this->m_isCapability(cap,GL_TRUE))return;
+            CALL_ORIGINAL(glEnable)(cap);
+            this->m_capabilities[cap] = GL_TRUE;
+          }
+
+          void m_glDisable_cache(GLenum cap)const{
+            if(this->m_isCapability(cap,GL_FALSE))return;
+            CALL_ORIGINAL(glDisable)(cap);
+            this->m_capabilities[cap] = GL_FALSE;
+          }
+
+          void m_glEnablei_cache(GLenum target,GLuint index)const{
+            CALL_ORIGINAL(glEnablei)(target,index);
+            this->m_capabilities.erase(target);
+          }
+
+          void m_glDisablei_cache(GLenum target,GLuint index)const{
+            CALL_ORIGINAL(glDisablei)(target,index);
+            this->m_capabilities.erase(target);
+          }
+
+          GLboolean m_glIsEnabled_cache(GLenum cap)const{
+            auto const it = this->m_capabilities.find(cap);
+            if(it != this->m_capabilities.end())return it->second;
+            auto const result = CALL_ORIGINAL(glIsEnabled)(cap);
+            this->m_capabilities[cap] = result;
+            return result;
+          }
+      };
+  }
+}
+
+#undef CACHE_STATE
+#undef DECLARE_ORIGINAL
+#undef CALL_ORIGINAL
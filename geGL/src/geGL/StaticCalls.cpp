@@ -1,5 +1,6 @@
 #include<geGL/StaticCalls.h>
 #include<geGL/OpenGLContext.h>
+#if !defined(GEGL_STATIC_DISPATCH)
 void ge::gl::glMultiDrawArraysIndirectBindlessCountNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount){ge::gl::getDefaultContext()->glMultiDrawArraysIndirectBindlessCountNV(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
 void ge::gl::glTextureParameterfv(GLuint texture,GLenum pname,const GLfloat* param){ge::gl::getDefaultContext()->glTextureParameterfv(texture,pname,param);}
 void ge::gl::glGetListParameterivSGIX(GLuint list,GLenum pname,GLint* params){ge::gl::getDefaultContext()->glGetListParameterivSGIX(list,pname,params);}
@@ -2926,3 +2927,4 @@ void ge::gl::glFrontFace(GLenum mode){ge::gl::getDefaultContext()->glFrontFace(m
 void ge::gl::glEvalCoord1xOES(GLfixed u){ge::gl::getDefaultContext()->glEvalCoord1xOES(u);}
 void ge::gl::glDrawArraysInstancedBaseInstance(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance){ge::gl::getDefaultContext()->glDrawArraysInstancedBaseInstance(mode,first,count,instancecount,baseinstance);}
 GLboolean ge::gl::glIsPointInStrokePathNV(GLuint path,GLfloat x,GLfloat y){return ge::gl::getDefaultContext()->glIsPointInStrokePathNV(path,x,y);}
+#endif
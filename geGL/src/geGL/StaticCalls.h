@@ -1,4 +1,2938 @@
+#pragma once
 #include<geGL/OpenGL.h>
+#if defined(GEGL_STATIC_DISPATCH)
+#include<geGL/DirectContext.h>
+namespace ge{
+  namespace gl{
+    inline void glMultiDrawArraysIndirectBindlessCountNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirectBindlessCountNV(mode,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+    inline void glTextureParameterfv(GLuint texture,GLenum pname,const GLfloat* param){ge::gl::getDefaultDirectContext().glTextureParameterfv(texture,pname,param);}
+    inline void glGetListParameterivSGIX(GLuint list,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetListParameterivSGIX(list,pname,params);}
+    inline void glProgramUniform1i64ARB(GLuint program,GLint location,GLint64 x){ge::gl::getDefaultDirectContext().glProgramUniform1i64ARB(program,location,x);}
+    inline void glVertexArrayElementBuffer(GLuint vaobj,GLuint buffer){ge::gl::getDefaultDirectContext().glVertexArrayElementBuffer(vaobj,buffer);}
+    inline void glHintPGI(GLenum target,GLint mode){ge::gl::getDefaultDirectContext().glHintPGI(target,mode);}
+    inline void glStencilMaskSeparate(GLenum face,GLuint mask){ge::gl::getDefaultDirectContext().glStencilMaskSeparate(face,mask);}
+    inline void glGetFramebufferAttachmentParameterivEXT(GLenum target,GLenum attachment,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFramebufferAttachmentParameterivEXT(target,attachment,pname,params);}
+    inline void glTextureStorage3DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTextureStorage3DMultisample(texture,samples,internalformat,width,height,depth,fixedsamplelocations);}
+    inline void glGetIntegerIndexedvEXT(GLenum target,GLuint index,GLint* data){ge::gl::getDefaultDirectContext().glGetIntegerIndexedvEXT(target,index,data);}
+    inline void glCopyTexImage1D(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border){ge::gl::getDefaultDirectContext().glCopyTexImage1D(target,level,internalformat,x,y,width,border);}
+    inline void glVertexAttrib4usv(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4usv(index,v);}
+    inline void glTexRenderbufferNV(GLenum target,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glTexRenderbufferNV(target,renderbuffer);}
+    inline void glVertexAttrib3hvNV(GLuint index,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttrib3hvNV(index,v);}
+    inline void glProgramUniform4ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w){ge::gl::getDefaultDirectContext().glProgramUniform4ui64ARB(program,location,x,y,z,w);}
+    inline void glInstrumentsBufferSGIX(GLsizei size,GLint* buffer){ge::gl::getDefaultDirectContext().glInstrumentsBufferSGIX(size,buffer);}
+    inline void glIndexi(GLint c){ge::gl::getDefaultDirectContext().glIndexi(c);}
+    inline void glMultiTexCoord2sARB(GLenum target,GLshort s,GLshort t){ge::gl::getDefaultDirectContext().glMultiTexCoord2sARB(target,s,t);}
+    inline void glProgramEnvParameter4fARB(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glProgramEnvParameter4fARB(target,index,x,y,z,w);}
+    inline void glCompressedTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+    inline void glEvalCoord2d(GLdouble u,GLdouble v){ge::gl::getDefaultDirectContext().glEvalCoord2d(u,v);}
+    inline void glEvalCoord2f(GLfloat u,GLfloat v){ge::gl::getDefaultDirectContext().glEvalCoord2f(u,v);}
+    inline void glIndexd(GLdouble c){ge::gl::getDefaultDirectContext().glIndexd(c);}
+    inline void glSecondaryColor3hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glSecondaryColor3hvNV(v);}
+    inline void glIndexf(GLfloat c){ge::gl::getDefaultDirectContext().glIndexf(c);}
+    inline void glFrustumxOES(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f){ge::gl::getDefaultDirectContext().glFrustumxOES(l,r,b,t,n,f);}
+    inline void glTextureStorage3DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glTextureStorage3DEXT(texture,target,levels,internalformat,width,height,depth);}
+    inline void glDrawCommandsStatesNV(GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count){ge::gl::getDefaultDirectContext().glDrawCommandsStatesNV(buffer,indirects,sizes,states,fbos,count);}
+    inline void glUniform4uiEXT(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3){ge::gl::getDefaultDirectContext().glUniform4uiEXT(location,v0,v1,v2,v3);}
+    inline void glProgramUniform3ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y,GLuint64 z){ge::gl::getDefaultDirectContext().glProgramUniform3ui64ARB(program,location,x,y,z);}
+    inline void glIndexs(GLshort c){ge::gl::getDefaultDirectContext().glIndexs(c);}
+    inline void glVertexArrayBindVertexBufferEXT(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexArrayBindVertexBufferEXT(vaobj,bindingindex,buffer,offset,stride);}
+    inline void glConvolutionParameteriEXT(GLenum target,GLenum pname,GLint params){ge::gl::getDefaultDirectContext().glConvolutionParameteriEXT(target,pname,params);}
+    inline void glColor4ubVertex2fSUN(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glColor4ubVertex2fSUN(r,g,b,a,x,y);}
+    inline void glProgramUniform1ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform1ivEXT(program,location,count,value);}
+    inline void glGetnMapfv(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v){ge::gl::getDefaultDirectContext().glGetnMapfv(target,query,bufSize,v);}
+    inline void glTransformFeedbackBufferRange(GLuint xfb,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glTransformFeedbackBufferRange(xfb,index,buffer,offset,size);}
+    inline void glPathGlyphsNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLsizei numGlyphs,GLenum type,const void* charcodes,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale){ge::gl::getDefaultDirectContext().glPathGlyphsNV(firstPathName,fontTarget,fontName,fontStyle,numGlyphs,type,charcodes,handleMissingGlyphs,pathParameterTemplate,emScale);}
+    inline void glSecondaryColor3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glSecondaryColor3fv(v);}
+    inline void glGetCombinerInputParameterivNV(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetCombinerInputParameterivNV(stage,portion,variable,pname,params);}
+    inline void glEndPerfMonitorAMD(GLuint monitor){ge::gl::getDefaultDirectContext().glEndPerfMonitorAMD(monitor);}
+    inline void glPointParameterfvARB(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPointParameterfvARB(pname,params);}
+    inline void glVertex2xOES(GLfixed x){ge::gl::getDefaultDirectContext().glVertex2xOES(x);}
+    inline void glDrawElementsInstancedBaseInstance(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLuint baseinstance){ge::gl::getDefaultDirectContext().glDrawElementsInstancedBaseInstance(mode,count,type,indices,instancecount,baseinstance);}
+    inline void glMultTransposeMatrixdARB(const GLdouble* m){ge::gl::getDefaultDirectContext().glMultTransposeMatrixdARB(m);}
+    inline void glVertexAttribL4dEXT(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexAttribL4dEXT(index,x,y,z,w);}
+    inline void glVertex4iv(const GLint* v){ge::gl::getDefaultDirectContext().glVertex4iv(v);}
+    inline void glCoverStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+    inline void glDeformSGIX(GLbitfield mask){ge::gl::getDefaultDirectContext().glDeformSGIX(mask);}
+    inline void glUniform2ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y){ge::gl::getDefaultDirectContext().glUniform2ui64NV(location,x,y);}
+    inline void glCopyPathNV(GLuint resultPath,GLuint srcPath){ge::gl::getDefaultDirectContext().glCopyPathNV(resultPath,srcPath);}
+    inline void glVertexAttribP4ui(GLuint index,GLenum type,GLboolean normalized,GLuint value){ge::gl::getDefaultDirectContext().glVertexAttribP4ui(index,type,normalized,value);}
+    inline void glVertexAttribL2d(GLuint index,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexAttribL2d(index,x,y);}
+    inline void glGetMultisamplefv(GLenum pname,GLuint index,GLfloat* val){ge::gl::getDefaultDirectContext().glGetMultisamplefv(pname,index,val);}
+    inline void glCompressedMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+    inline GLvdpauSurfaceNV glVDPAURegisterOutputSurfaceNV(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames){return ge::gl::getDefaultDirectContext().glVDPAURegisterOutputSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+    inline void glMinSampleShading(GLfloat value){ge::gl::getDefaultDirectContext().glMinSampleShading(value);}
+    inline void glProgramUniform4fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3){ge::gl::getDefaultDirectContext().glProgramUniform4fEXT(program,location,v0,v1,v2,v3);}
+    inline void glCoverStrokePathNV(GLuint path,GLenum coverMode){ge::gl::getDefaultDirectContext().glCoverStrokePathNV(path,coverMode);}
+    inline void glTextureImage2DMultisampleNV(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTextureImage2DMultisampleNV(texture,target,samples,internalFormat,width,height,fixedSampleLocations);}
+    inline void glVertex3bOES(GLbyte x,GLbyte y,GLbyte z){ge::gl::getDefaultDirectContext().glVertex3bOES(x,y,z);}
+    inline void glImportMemoryWin32HandleEXT(GLuint memory,GLuint64 size,GLenum handleType,void* handle){ge::gl::getDefaultDirectContext().glImportMemoryWin32HandleEXT(memory,size,handleType,handle);}
+    inline void glTessellationFactorAMD(GLfloat factor){ge::gl::getDefaultDirectContext().glTessellationFactorAMD(factor);}
+    inline void glDebugMessageControl(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled){ge::gl::getDefaultDirectContext().glDebugMessageControl(source,type,severity,count,ids,enabled);}
+    inline GLboolean glIsObjectBufferATI(GLuint buffer){return ge::gl::getDefaultDirectContext().glIsObjectBufferATI(buffer);}
+    inline void glPopAttrib(){ge::gl::getDefaultDirectContext().glPopAttrib();}
+    inline void glProgramUniform4iEXT(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3){ge::gl::getDefaultDirectContext().glProgramUniform4iEXT(program,location,v0,v1,v2,v3);}
+    inline void glVertexAttrib4ubNV(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w){ge::gl::getDefaultDirectContext().glVertexAttrib4ubNV(index,x,y,z,w);}
+    inline void glColorMaterial(GLenum face,GLenum mode){ge::gl::getDefaultDirectContext().glColorMaterial(face,mode);}
+    inline void glVertexAttrib2svARB(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib2svARB(index,v);}
+    inline void glMinSampleShadingARB(GLfloat value){ge::gl::getDefaultDirectContext().glMinSampleShadingARB(value);}
+    inline void glColor3b(GLbyte red,GLbyte green,GLbyte blue){ge::gl::getDefaultDirectContext().glColor3b(red,green,blue);}
+    inline void glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc,s,t,nx,ny,nz,x,y,z);}
+    inline void glColor3f(GLfloat red,GLfloat green,GLfloat blue){ge::gl::getDefaultDirectContext().glColor3f(red,green,blue);}
+    inline void glVDPAUGetSurfaceivNV(GLvdpauSurfaceNV surface,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values){ge::gl::getDefaultDirectContext().glVDPAUGetSurfaceivNV(surface,pname,bufSize,length,values);}
+    inline void glColor3d(GLdouble red,GLdouble green,GLdouble blue){ge::gl::getDefaultDirectContext().glColor3d(red,green,blue);}
+    inline void glGetnMapiv(GLenum target,GLenum query,GLsizei bufSize,GLint* v){ge::gl::getDefaultDirectContext().glGetnMapiv(target,query,bufSize,v);}
+    inline void glColor3i(GLint red,GLint green,GLint blue){ge::gl::getDefaultDirectContext().glColor3i(red,green,blue);}
+    inline void glGetInternalformatSampleivNV(GLenum target,GLenum internalformat,GLsizei samples,GLenum pname,GLsizei bufSize,GLint* params){ge::gl::getDefaultDirectContext().glGetInternalformatSampleivNV(target,internalformat,samples,pname,bufSize,params);}
+    inline void glVertexAttrib4ubv(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4ubv(index,v);}
+    inline void glColor3s(GLshort red,GLshort green,GLshort blue){ge::gl::getDefaultDirectContext().glColor3s(red,green,blue);}
+    inline void glVertexAttribs4hvNV(GLuint index,GLsizei n,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttribs4hvNV(index,n,v);}
+    inline void glVertexAttrib4NubvARB(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NubvARB(index,v);}
+    inline void glMultiTexCoord3hvNV(GLenum target,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3hvNV(target,v);}
+    inline void glMatrixPushEXT(GLenum mode){ge::gl::getDefaultDirectContext().glMatrixPushEXT(mode);}
+    inline void glProgramUniform2fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1){ge::gl::getDefaultDirectContext().glProgramUniform2fEXT(program,location,v0,v1);}
+    inline void glGetVertexArrayIndexediv(GLuint vaobj,GLuint index,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetVertexArrayIndexediv(vaobj,index,pname,param);}
+    inline void glBlitFramebuffer(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter){ge::gl::getDefaultDirectContext().glBlitFramebuffer(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+    inline void glMultiTexCoordP2ui(GLenum texture,GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP2ui(texture,type,coords);}
+    inline void glColorPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+    inline void glVertexAttribL4d(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexAttribL4d(index,x,y,z,w);}
+    inline void glGetFragmentMaterialfvSGIX(GLenum face,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetFragmentMaterialfvSGIX(face,pname,params);}
+    inline void glVertex2iv(const GLint* v){ge::gl::getDefaultDirectContext().glVertex2iv(v);}
+    inline void glGetTexEnvxvOES(GLenum target,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetTexEnvxvOES(target,pname,params);}
+    inline void glUniformMatrix3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix3dv(location,count,transpose,value);}
+    inline void glGetVertexAttribLdvEXT(GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVertexAttribLdvEXT(index,pname,params);}
+    inline void glTexCoordP3uiv(GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glTexCoordP3uiv(type,coords);}
+    inline void glDeformationMap3dSGIX(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,GLdouble w1,GLdouble w2,GLint wstride,GLint worder,const GLdouble* points){ge::gl::getDefaultDirectContext().glDeformationMap3dSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+    inline void glResumeTransformFeedback(){ge::gl::getDefaultDirectContext().glResumeTransformFeedback();}
+    inline void glInsertEventMarkerEXT(GLsizei length,const GLchar* marker){ge::gl::getDefaultDirectContext().glInsertEventMarkerEXT(length,marker);}
+    inline void glTessellationModeAMD(GLenum mode){ge::gl::getDefaultDirectContext().glTessellationModeAMD(mode);}
+    inline void glDrawCommandsAddressNV(GLenum primitiveMode,const GLuint64* indirects,const GLsizei* sizes,GLuint count){ge::gl::getDefaultDirectContext().glDrawCommandsAddressNV(primitiveMode,indirects,sizes,count);}
+    inline void glFogi(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glFogi(pname,param);}
+    inline void glGetTexParameterxvOES(GLenum target,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetTexParameterxvOES(target,pname,params);}
+    inline void glVertexPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glVertexPointer(size,type,stride,ptr);}
+    inline void glGetPerfMonitorCounterDataAMD(GLuint monitor,GLenum pname,GLsizei dataSize,GLuint* data,GLint* bytesWritten){ge::gl::getDefaultDirectContext().glGetPerfMonitorCounterDataAMD(monitor,pname,dataSize,data,bytesWritten);}
+    inline void glFogf(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glFogf(pname,param);}
+    inline void glMultiTexCoord1d(GLenum target,GLdouble s){ge::gl::getDefaultDirectContext().glMultiTexCoord1d(target,s);}
+    inline void glMultiTexCoord1f(GLenum target,GLfloat s){ge::gl::getDefaultDirectContext().glMultiTexCoord1f(target,s);}
+    inline void glGetMultiTexParameterivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMultiTexParameterivEXT(texunit,target,pname,params);}
+    inline void glProgramUniformMatrix3x4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x4fvEXT(program,location,count,transpose,value);}
+    inline void glVertexAttribI2i(GLuint index,GLint x,GLint y){ge::gl::getDefaultDirectContext().glVertexAttribI2i(index,x,y);}
+    inline void glMultiTexCoord1i(GLenum target,GLint s){ge::gl::getDefaultDirectContext().glMultiTexCoord1i(target,s);}
+    inline void glDeleteSemaphoresEXT(GLsizei n,const GLuint* semaphores){ge::gl::getDefaultDirectContext().glDeleteSemaphoresEXT(n,semaphores);}
+    inline void glLoadProgramNV(GLenum target,GLuint id,GLsizei len,const GLubyte* program){ge::gl::getDefaultDirectContext().glLoadProgramNV(target,id,len,program);}
+    inline void glWriteMaskEXT(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW){ge::gl::getDefaultDirectContext().glWriteMaskEXT(res,in,outX,outY,outZ,outW);}
+    inline GLenum glGetGraphicsResetStatus(){return ge::gl::getDefaultDirectContext().glGetGraphicsResetStatus();}
+    inline void glVertexAttrib1fv(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib1fv(index,v);}
+    inline void glMultiTexCoord1s(GLenum target,GLshort s){ge::gl::getDefaultDirectContext().glMultiTexCoord1s(target,s);}
+    inline void glImageTransformParameterfvHP(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glImageTransformParameterfvHP(target,pname,params);}
+    inline void glFramebufferTexture2D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTexture2D(target,attachment,textarget,texture,level);}
+    inline void glGetFragmentLightfvSGIX(GLenum light,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetFragmentLightfvSGIX(light,pname,params);}
+    inline void glListParameterfSGIX(GLuint list,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glListParameterfSGIX(list,pname,param);}
+    inline void glTexCoord3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glTexCoord3sv(v);}
+    inline void glNamedFramebufferRenderbufferEXT(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glNamedFramebufferRenderbufferEXT(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+    inline void glFragmentLightModelfSGIX(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glFragmentLightModelfSGIX(pname,param);}
+    inline void glIndexPointerEXT(GLenum type,GLsizei stride,GLsizei count,const void* pointer){ge::gl::getDefaultDirectContext().glIndexPointerEXT(type,stride,count,pointer);}
+    inline void glBlendEquationSeparateATI(GLenum modeRGB,GLenum modeA){ge::gl::getDefaultDirectContext().glBlendEquationSeparateATI(modeRGB,modeA);}
+    inline void glVertexArrayAttribIFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayAttribIFormat(vaobj,attribindex,size,type,relativeoffset);}
+    inline void glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc,s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+    inline void glReplacementCodeubvSUN(const GLubyte* code){ge::gl::getDefaultDirectContext().glReplacementCodeubvSUN(code);}
+    inline void glGenFramebuffers(GLsizei n,GLuint* framebuffers){ge::gl::getDefaultDirectContext().glGenFramebuffers(n,framebuffers);}
+    inline void glPixelMapx(GLenum map,GLint size,const GLfixed* values){ge::gl::getDefaultDirectContext().glPixelMapx(map,size,values);}
+    inline void glTexSubImage3DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+    inline void glGetAttachedShaders(GLuint program,GLsizei maxCount,GLsizei* count,GLuint* shaders){ge::gl::getDefaultDirectContext().glGetAttachedShaders(program,maxCount,count,shaders);}
+    inline void glGetPixelTexGenParameterfvSGIS(GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetPixelTexGenParameterfvSGIS(pname,params);}
+    inline void glReplacementCodeuiNormal3fVertex3fSUN(GLuint rc,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiNormal3fVertex3fSUN(rc,nx,ny,nz,x,y,z);}
+    inline GLuint glGetDebugMessageLogAMD(GLuint count,GLsizei bufsize,GLenum* categories,GLuint* severities,GLuint* ids,GLsizei* lengths,GLchar* message){return ge::gl::getDefaultDirectContext().glGetDebugMessageLogAMD(count,bufsize,categories,severities,ids,lengths,message);}
+    inline void glVertexStream4sATI(GLenum stream,GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glVertexStream4sATI(stream,x,y,z,w);}
+    inline void glVertexAttribs4dvNV(GLuint index,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribs4dvNV(index,count,v);}
+    inline void glGetnMapdvARB(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v){ge::gl::getDefaultDirectContext().glGetnMapdvARB(target,query,bufSize,v);}
+    inline void glOrthofOES(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f){ge::gl::getDefaultDirectContext().glOrthofOES(l,r,b,t,n,f);}
+    inline void glViewportArrayv(GLuint first,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glViewportArrayv(first,count,v);}
+    inline void glDrawElementArrayATI(GLenum mode,GLsizei count){ge::gl::getDefaultDirectContext().glDrawElementArrayATI(mode,count);}
+    inline void glBufferStorageMemEXT(GLenum target,GLsizeiptr size,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glBufferStorageMemEXT(target,size,memory,offset);}
+    inline void glGetPathColorGenfvNV(GLenum color,GLenum pname,GLfloat* value){ge::gl::getDefaultDirectContext().glGetPathColorGenfvNV(color,pname,value);}
+    inline void glWindowPos3iMESA(GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glWindowPos3iMESA(x,y,z);}
+    inline void glMultiTexCoord2s(GLenum target,GLshort s,GLshort t){ge::gl::getDefaultDirectContext().glMultiTexCoord2s(target,s,t);}
+    inline void glVertex3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glVertex3dv(v);}
+    inline void glVertexAttribI3uivEXT(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI3uivEXT(index,v);}
+    inline void glUniform3ui64ARB(GLint location,GLuint64 x,GLuint64 y,GLuint64 z){ge::gl::getDefaultDirectContext().glUniform3ui64ARB(location,x,y,z);}
+    inline void glVertexAttrib2fvNV(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib2fvNV(index,v);}
+    inline void glGetNamedBufferSubDataEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data){ge::gl::getDefaultDirectContext().glGetNamedBufferSubDataEXT(buffer,offset,size,data);}
+    inline void glConvolutionFilter2D(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* image){ge::gl::getDefaultDirectContext().glConvolutionFilter2D(target,internalformat,width,height,format,type,image);}
+    inline void glMemoryBarrierByRegion(GLbitfield barriers){ge::gl::getDefaultDirectContext().glMemoryBarrierByRegion(barriers);}
+    inline void glVertexArrayBindingDivisor(GLuint vaobj,GLuint bindingindex,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexArrayBindingDivisor(vaobj,bindingindex,divisor);}
+    inline void glMatrixRotatedEXT(GLenum mode,GLdouble angle,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glMatrixRotatedEXT(mode,angle,x,y,z);}
+    inline void glTexCoord2sv(const GLshort* v){ge::gl::getDefaultDirectContext().glTexCoord2sv(v);}
+    inline GLboolean glIsProgramNV(GLuint id){return ge::gl::getDefaultDirectContext().glIsProgramNV(id);}
+    inline void glUniform2dv(GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniform2dv(location,count,value);}
+    inline void glGetPixelMapuiv(GLenum map,GLuint* values){ge::gl::getDefaultDirectContext().glGetPixelMapuiv(map,values);}
+    inline void glDepthBoundsEXT(GLclampd zmin,GLclampd zmax){ge::gl::getDefaultDirectContext().glDepthBoundsEXT(zmin,zmax);}
+    inline void glVertexAttrib4hvNV(GLuint index,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttrib4hvNV(index,v);}
+    inline void glMultiTexParameteriEXT(GLenum texunit,GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glMultiTexParameteriEXT(texunit,target,pname,param);}
+    inline void glGetPointerv(GLenum pname,GLvoid** params){ge::gl::getDefaultDirectContext().glGetPointerv(pname,params);}
+    inline void glPathCommandsNV(GLuint path,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords){ge::gl::getDefaultDirectContext().glPathCommandsNV(path,numCommands,commands,numCoords,coordType,coords);}
+    inline void glGetListParameterfvSGIX(GLuint list,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetListParameterfvSGIX(list,pname,params);}
+    inline void glGetUniformuiv(GLuint program,GLint location,GLuint* params){ge::gl::getDefaultDirectContext().glGetUniformuiv(program,location,params);}
+    inline void glDebugMessageInsertAMD(GLenum category,GLenum severity,GLuint id,GLsizei length,const GLchar* buf){ge::gl::getDefaultDirectContext().glDebugMessageInsertAMD(category,severity,id,length,buf);}
+    inline void glFrustum(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val){ge::gl::getDefaultDirectContext().glFrustum(left,right,bottom,top,near_val,far_val);}
+    inline void glVertexAttribL1ui64vNV(GLuint index,const GLuint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL1ui64vNV(index,v);}
+    inline void glClearColorxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha){ge::gl::getDefaultDirectContext().glClearColorxOES(red,green,blue,alpha);}
+    inline void glProgramUniformMatrix3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3fv(program,location,count,transpose,value);}
+    inline void glSampleMaskIndexedNV(GLuint index,GLbitfield mask){ge::gl::getDefaultDirectContext().glSampleMaskIndexedNV(index,mask);}
+    inline void glCompileShaderIncludeARB(GLuint shader,GLsizei count,const GLchar*const* path,const GLint* length){ge::gl::getDefaultDirectContext().glCompileShaderIncludeARB(shader,count,path,length);}
+    inline void glGetArrayObjectfvATI(GLenum array,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetArrayObjectfvATI(array,pname,params);}
+    inline void glVertexStream4svATI(GLenum stream,const GLshort* coords){ge::gl::getDefaultDirectContext().glVertexStream4svATI(stream,coords);}
+    inline void glMultiTexCoord4iARB(GLenum target,GLint s,GLint t,GLint r,GLint q){ge::gl::getDefaultDirectContext().glMultiTexCoord4iARB(target,s,t,r,q);}
+    inline void glVariantfvEXT(GLuint id,const GLfloat* addr){ge::gl::getDefaultDirectContext().glVariantfvEXT(id,addr);}
+    inline void glMatrixLoadfEXT(GLenum mode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixLoadfEXT(mode,m);}
+    inline void glLoadIdentityDeformationMapSGIX(GLbitfield mask){ge::gl::getDefaultDirectContext().glLoadIdentityDeformationMapSGIX(mask);}
+    inline void glGetRenderbufferParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetRenderbufferParameteriv(target,pname,params);}
+    inline void glProgramUniform3fEXT(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2){ge::gl::getDefaultDirectContext().glProgramUniform3fEXT(program,location,v0,v1,v2);}
+    inline void glNamedRenderbufferStorage(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glNamedRenderbufferStorage(renderbuffer,internalformat,width,height);}
+    inline void glBindFragDataLocation(GLuint program,GLuint color,const GLchar* name){ge::gl::getDefaultDirectContext().glBindFragDataLocation(program,color,name);}
+    inline void glPolygonOffsetClamp(GLfloat factor,GLfloat units,GLfloat clamp){ge::gl::getDefaultDirectContext().glPolygonOffsetClamp(factor,units,clamp);}
+    inline void glFogCoordPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glFogCoordPointerListIBM(type,stride,pointer,ptrstride);}
+    inline GLsync glFenceSync(GLenum condition,GLbitfield flags){return ge::gl::getDefaultDirectContext().glFenceSync(condition,flags);}
+    inline void glGetVertexAttribIivEXT(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribIivEXT(index,pname,params);}
+    inline void glFramebufferDrawBuffersEXT(GLuint framebuffer,GLsizei n,const GLenum* bufs){ge::gl::getDefaultDirectContext().glFramebufferDrawBuffersEXT(framebuffer,n,bufs);}
+    inline void glVertexAttribs4fvNV(GLuint index,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttribs4fvNV(index,count,v);}
+    inline void glPauseTransformFeedbackNV(){ge::gl::getDefaultDirectContext().glPauseTransformFeedbackNV();}
+    inline void glGetQueryObjecti64vEXT(GLuint id,GLenum pname,GLint64* params){ge::gl::getDefaultDirectContext().glGetQueryObjecti64vEXT(id,pname,params);}
+    inline void glVDPAUSurfaceAccessNV(GLvdpauSurfaceNV surface,GLenum access){ge::gl::getDefaultDirectContext().glVDPAUSurfaceAccessNV(surface,access);}
+    inline void glValidateProgramPipeline(GLuint pipeline){ge::gl::getDefaultDirectContext().glValidateProgramPipeline(pipeline);}
+    inline void glTexPageCommitmentARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit){ge::gl::getDefaultDirectContext().glTexPageCommitmentARB(target,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+    inline void glWindowPos3dvARB(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos3dvARB(v);}
+    inline void glStencilStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glStencilStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,transformType,transformValues);}
+    inline void glFogfv(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glFogfv(pname,params);}
+    inline void glGenQueriesARB(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glGenQueriesARB(n,ids);}
+    inline void glProgramUniform2i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y){ge::gl::getDefaultDirectContext().glProgramUniform2i64NV(program,location,x,y);}
+    inline void glVertexP4ui(GLenum type,GLuint value){ge::gl::getDefaultDirectContext().glVertexP4ui(type,value);}
+    inline void glVertexStream1ivATI(GLenum stream,const GLint* coords){ge::gl::getDefaultDirectContext().glVertexStream1ivATI(stream,coords);}
+    inline void glProgramEnvParameterI4iNV(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glProgramEnvParameterI4iNV(target,index,x,y,z,w);}
+    inline void glGenVertexArraysAPPLE(GLsizei n,GLuint* arrays){ge::gl::getDefaultDirectContext().glGenVertexArraysAPPLE(n,arrays);}
+    inline void glDrawTransformFeedbackInstanced(GLenum mode,GLuint id,GLsizei instancecount){ge::gl::getDefaultDirectContext().glDrawTransformFeedbackInstanced(mode,id,instancecount);}
+    inline void glStencilThenCoverStrokePathNV(GLuint path,GLint reference,GLuint mask,GLenum coverMode){ge::gl::getDefaultDirectContext().glStencilThenCoverStrokePathNV(path,reference,mask,coverMode);}
+    inline void glDeleteVertexArraysAPPLE(GLsizei n,const GLuint* arrays){ge::gl::getDefaultDirectContext().glDeleteVertexArraysAPPLE(n,arrays);}
+    inline void glGetNamedBufferParameterui64vNV(GLuint buffer,GLenum pname,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetNamedBufferParameterui64vNV(buffer,pname,params);}
+    inline GLbitfield glQueryMatrixxOES(GLfixed* mantissa,GLint* exponent){return ge::gl::getDefaultDirectContext().glQueryMatrixxOES(mantissa,exponent);}
+    inline void glSecondaryColor3usv(const GLushort* v){ge::gl::getDefaultDirectContext().glSecondaryColor3usv(v);}
+    inline void glTranslatexOES(GLfixed x,GLfixed y,GLfixed z){ge::gl::getDefaultDirectContext().glTranslatexOES(x,y,z);}
+    inline void glDrawTransformFeedback(GLenum mode,GLuint id){ge::gl::getDefaultDirectContext().glDrawTransformFeedback(mode,id);}
+    inline void glTexCoord2fColor4fNormal3fVertex3fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fColor4fNormal3fVertex3fvSUN(tc,c,n,v);}
+    inline GLvdpauSurfaceNV glVDPAURegisterVideoSurfaceNV(const void* vdpSurface,GLenum target,GLsizei numTextureNames,const GLuint* textureNames){return ge::gl::getDefaultDirectContext().glVDPAURegisterVideoSurfaceNV(vdpSurface,target,numTextureNames,textureNames);}
+    inline void glGetTexParameterIuiv(GLenum target,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetTexParameterIuiv(target,pname,params);}
+    inline void glBindBufferBaseNV(GLenum target,GLuint index,GLuint buffer){ge::gl::getDefaultDirectContext().glBindBufferBaseNV(target,index,buffer);}
+    inline void glIndexPointer(GLenum type,GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glIndexPointer(type,stride,ptr);}
+    inline void glGenQueryResourceTagNV(GLsizei n,GLint* tagIds){ge::gl::getDefaultDirectContext().glGenQueryResourceTagNV(n,tagIds);}
+    inline void glVertexAttrib4Nbv(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Nbv(index,v);}
+    inline void glListParameteriSGIX(GLuint list,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glListParameteriSGIX(list,pname,param);}
+    inline void glBlendColorxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha){ge::gl::getDefaultDirectContext().glBlendColorxOES(red,green,blue,alpha);}
+    inline void glUniformui64vNV(GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glUniformui64vNV(location,count,value);}
+    inline GLboolean glIsSync(GLsync sync){return ge::gl::getDefaultDirectContext().glIsSync(sync);}
+    inline void glGetTextureParameterivEXT(GLuint texture,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureParameterivEXT(texture,target,pname,params);}
+    inline void glFogCoordhvNV(const GLhalfNV* fog){ge::gl::getDefaultDirectContext().glFogCoordhvNV(fog);}
+    inline void glFramebufferTextureLayerEXT(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer){ge::gl::getDefaultDirectContext().glFramebufferTextureLayerEXT(target,attachment,texture,level,layer);}
+    inline void glGetObjectPtrLabel(const void* ptr,GLsizei bufSize,GLsizei* length,GLchar* label){ge::gl::getDefaultDirectContext().glGetObjectPtrLabel(ptr,bufSize,length,label);}
+    inline void glTextureParameteri(GLuint texture,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glTextureParameteri(texture,pname,param);}
+    inline void glMultiTexCoord1fARB(GLenum target,GLfloat s){ge::gl::getDefaultDirectContext().glMultiTexCoord1fARB(target,s);}
+    inline void glUniformMatrix2x3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix2x3dv(location,count,transpose,value);}
+    inline void glFramebufferDrawBufferEXT(GLuint framebuffer,GLenum mode){ge::gl::getDefaultDirectContext().glFramebufferDrawBufferEXT(framebuffer,mode);}
+    inline void glCopyColorSubTable(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyColorSubTable(target,start,x,y,width);}
+    inline void glGetNamedFramebufferParameterfvAMD(GLuint framebuffer,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values){ge::gl::getDefaultDirectContext().glGetNamedFramebufferParameterfvAMD(framebuffer,pname,numsamples,pixelindex,size,values);}
+    inline void glVertexAttribL3d(GLuint index,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexAttribL3d(index,x,y,z);}
+    inline void glFragmentMaterialfvSGIX(GLenum face,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glFragmentMaterialfvSGIX(face,pname,params);}
+    inline void glMatrixLoadTranspose3x3fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixLoadTranspose3x3fNV(matrixMode,m);}
+    inline void glDeleteNamesAMD(GLenum identifier,GLuint num,const GLuint* names){ge::gl::getDefaultDirectContext().glDeleteNamesAMD(identifier,num,names);}
+    inline void glDrawRangeElementsEXT(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices){ge::gl::getDefaultDirectContext().glDrawRangeElementsEXT(mode,start,end,count,type,indices);}
+    inline void glOrtho(GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble near_val,GLdouble far_val){ge::gl::getDefaultDirectContext().glOrtho(left,right,bottom,top,near_val,far_val);}
+    inline void glProgramUniform1dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform1dvEXT(program,location,count,value);}
+    inline void glColor4xOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha){ge::gl::getDefaultDirectContext().glColor4xOES(red,green,blue,alpha);}
+    inline void glTexImage4DSGIS(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexImage4DSGIS(target,level,internalformat,width,height,depth,size4d,border,format,type,pixels);}
+    inline void glProgramUniform1ui(GLuint program,GLint location,GLuint v0){ge::gl::getDefaultDirectContext().glProgramUniform1ui(program,location,v0);}
+    inline void glDeleteBuffersARB(GLsizei n,const GLuint* buffers){ge::gl::getDefaultDirectContext().glDeleteBuffersARB(n,buffers);}
+    inline GLboolean glUnmapBufferARB(GLenum target){return ge::gl::getDefaultDirectContext().glUnmapBufferARB(target);}
+    inline void glCopyTexImage2D(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border){ge::gl::getDefaultDirectContext().glCopyTexImage2D(target,level,internalformat,x,y,width,height,border);}
+    inline void glMaterialxOES(GLenum face,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glMaterialxOES(face,pname,param);}
+    inline void glProgramUniformMatrix2x4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x4fvEXT(program,location,count,transpose,value);}
+    inline GLboolean glTestObjectAPPLE(GLenum object,GLuint name){return ge::gl::getDefaultDirectContext().glTestObjectAPPLE(object,name);}
+    inline void glRenderbufferStorageEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glRenderbufferStorageEXT(target,internalformat,width,height);}
+    inline void glVertexAttribL1ui64ARB(GLuint index,GLuint64EXT x){ge::gl::getDefaultDirectContext().glVertexAttribL1ui64ARB(index,x);}
+    inline void glEndFragmentShaderATI(){ge::gl::getDefaultDirectContext().glEndFragmentShaderATI();}
+    inline void glPathParameterivNV(GLuint path,GLenum pname,const GLint* value){ge::gl::getDefaultDirectContext().glPathParameterivNV(path,pname,value);}
+    inline void glUniform4uiv(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform4uiv(location,count,value);}
+    inline void glFrameZoomSGIX(GLint factor){ge::gl::getDefaultDirectContext().glFrameZoomSGIX(factor);}
+    inline void glSecondaryColor3fEXT(GLfloat red,GLfloat green,GLfloat blue){ge::gl::getDefaultDirectContext().glSecondaryColor3fEXT(red,green,blue);}
+    inline void glLGPUInterlockNVX(){ge::gl::getDefaultDirectContext().glLGPUInterlockNVX();}
+    inline void glVertexAttribL1dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL1dv(index,v);}
+    inline void glNormalStream3svATI(GLenum stream,const GLshort* coords){ge::gl::getDefaultDirectContext().glNormalStream3svATI(stream,coords);}
+    inline void glPathStencilFuncNV(GLenum func,GLint ref,GLuint mask){ge::gl::getDefaultDirectContext().glPathStencilFuncNV(func,ref,mask);}
+    inline void glSetInvariantEXT(GLuint id,GLenum type,const void* addr){ge::gl::getDefaultDirectContext().glSetInvariantEXT(id,type,addr);}
+    inline void glGetTexBumpParameterivATI(GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetTexBumpParameterivATI(pname,param);}
+    inline void glBlendEquationSeparateEXT(GLenum modeRGB,GLenum modeAlpha){ge::gl::getDefaultDirectContext().glBlendEquationSeparateEXT(modeRGB,modeAlpha);}
+    inline void glEndOcclusionQueryNV(){ge::gl::getDefaultDirectContext().glEndOcclusionQueryNV();}
+    inline void glScissorArrayv(GLuint first,GLsizei count,const GLint* v){ge::gl::getDefaultDirectContext().glScissorArrayv(first,count,v);}
+    inline void glCallList(GLuint list){ge::gl::getDefaultDirectContext().glCallList(list);}
+    inline void* glMapTexture2DINTEL(GLuint texture,GLint level,GLbitfield access,GLint* stride,GLenum* layout){return ge::gl::getDefaultDirectContext().glMapTexture2DINTEL(texture,level,access,stride,layout);}
+    inline GLVULKANPROCNV glGetVkProcAddrNV(const GLchar* name){return ge::gl::getDefaultDirectContext().glGetVkProcAddrNV(name);}
+    inline void glPixelTransferxOES(GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glPixelTransferxOES(pname,param);}
+    inline void glDeleteRenderbuffersEXT(GLsizei n,const GLuint* renderbuffers){ge::gl::getDefaultDirectContext().glDeleteRenderbuffersEXT(n,renderbuffers);}
+    inline void glTexCoord4fColor4fNormal3fVertex4fSUN(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glTexCoord4fColor4fNormal3fVertex4fSUN(s,t,p,q,r,g,b,a,nx,ny,nz,x,y,z,w);}
+    inline void glProgramUniformMatrix4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4dvEXT(program,location,count,transpose,value);}
+    inline void glGetnColorTable(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table){ge::gl::getDefaultDirectContext().glGetnColorTable(target,format,type,bufSize,table);}
+    inline void glFramebufferTextureLayerARB(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer){ge::gl::getDefaultDirectContext().glFramebufferTextureLayerARB(target,attachment,texture,level,layer);}
+    inline void glVertexAttribL2dvEXT(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL2dvEXT(index,v);}
+    inline void glGetCombinerStageParameterfvNV(GLenum stage,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetCombinerStageParameterfvNV(stage,pname,params);}
+    inline void glMultiTexCoord1xvOES(GLenum texture,const GLfixed* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord1xvOES(texture,coords);}
+    inline void* glMapBuffer(GLenum target,GLenum access){return ge::gl::getDefaultDirectContext().glMapBuffer(target,access);}
+    inline void glSecondaryColor3d(GLdouble red,GLdouble green,GLdouble blue){ge::gl::getDefaultDirectContext().glSecondaryColor3d(red,green,blue);}
+    inline void glSecondaryColor3f(GLfloat red,GLfloat green,GLfloat blue){ge::gl::getDefaultDirectContext().glSecondaryColor3f(red,green,blue);}
+    inline void glVertexAttribLFormat(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexAttribLFormat(attribindex,size,type,relativeoffset);}
+    inline void glElementPointerAPPLE(GLenum type,const void* pointer){ge::gl::getDefaultDirectContext().glElementPointerAPPLE(type,pointer);}
+    inline void glVertexStream1fATI(GLenum stream,GLfloat x){ge::gl::getDefaultDirectContext().glVertexStream1fATI(stream,x);}
+    inline void glCoverageModulationNV(GLenum components){ge::gl::getDefaultDirectContext().glCoverageModulationNV(components);}
+    inline void glSecondaryColor3i(GLint red,GLint green,GLint blue){ge::gl::getDefaultDirectContext().glSecondaryColor3i(red,green,blue);}
+    inline void glDeleteSync(GLsync sync){ge::gl::getDefaultDirectContext().glDeleteSync(sync);}
+    inline void glGetProgramParameterfvNV(GLenum target,GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetProgramParameterfvNV(target,index,pname,params);}
+    inline void glMaxShaderCompilerThreadsARB(GLuint count){ge::gl::getDefaultDirectContext().glMaxShaderCompilerThreadsARB(count);}
+    inline void glUniformMatrix4x2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix4x2dv(location,count,transpose,value);}
+    inline void glVertexArrayVertexAttribLOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribLOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+    inline void glSecondaryColor3s(GLshort red,GLshort green,GLshort blue){ge::gl::getDefaultDirectContext().glSecondaryColor3s(red,green,blue);}
+    inline GLboolean glIsImageHandleResidentNV(GLuint64 handle){return ge::gl::getDefaultDirectContext().glIsImageHandleResidentNV(handle);}
+    inline void glUniform3iv(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform3iv(location,count,value);}
+    inline void glVertexAttribL3i64vNV(GLuint index,const GLint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL3i64vNV(index,v);}
+    inline void glPolygonMode(GLenum face,GLenum mode){ge::gl::getDefaultDirectContext().glPolygonMode(face,mode);}
+    inline void glFramebufferSamplePositionsfvAMD(GLenum target,GLuint numsamples,GLuint pixelindex,const GLfloat* values){ge::gl::getDefaultDirectContext().glFramebufferSamplePositionsfvAMD(target,numsamples,pixelindex,values);}
+    inline void glConvolutionFilter1DEXT(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* image){ge::gl::getDefaultDirectContext().glConvolutionFilter1DEXT(target,internalformat,width,format,type,image);}
+    inline void glVertexAttrib1dvARB(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib1dvARB(index,v);}
+    inline void glTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+    inline GLboolean glIsVertexArrayAPPLE(GLuint array){return ge::gl::getDefaultDirectContext().glIsVertexArrayAPPLE(array);}
+    inline void glUseProgram(GLuint program){ge::gl::getDefaultDirectContext().glUseProgram(program);}
+    inline void glLineStipple(GLint factor,GLushort pattern){ge::gl::getDefaultDirectContext().glLineStipple(factor,pattern);}
+    inline void glMultiTexCoord4fvARB(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4fvARB(target,v);}
+    inline GLenum glVideoCaptureNV(GLuint video_capture_slot,GLuint* sequence_num,GLuint64EXT* capture_time){return ge::gl::getDefaultDirectContext().glVideoCaptureNV(video_capture_slot,sequence_num,capture_time);}
+    inline void glVertexArrayVertexAttribLFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribLFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+    inline void glUniform3fvARB(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform3fvARB(location,count,value);}
+    inline void glProgramUniformMatrix3x2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x2fvEXT(program,location,count,transpose,value);}
+    inline void glCopyTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+    inline void glMultiTexCoord2bvOES(GLenum texture,const GLbyte* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord2bvOES(texture,coords);}
+    inline void glDeleteObjectARB(GLhandleARB obj){ge::gl::getDefaultDirectContext().glDeleteObjectARB(obj);}
+    inline void glTextureLightEXT(GLenum pname){ge::gl::getDefaultDirectContext().glTextureLightEXT(pname);}
+    inline void glRasterPos3i(GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glRasterPos3i(x,y,z);}
+    inline void glMultiTexCoord3dARB(GLenum target,GLdouble s,GLdouble t,GLdouble r){ge::gl::getDefaultDirectContext().glMultiTexCoord3dARB(target,s,t,r);}
+    inline void glNamedFramebufferTextureEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glNamedFramebufferTextureEXT(framebuffer,attachment,texture,level);}
+    inline void glTextureParameteriEXT(GLuint texture,GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glTextureParameteriEXT(texture,target,pname,param);}
+    inline void glEvalCoord2xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glEvalCoord2xvOES(coords);}
+    inline void glBindVideoCaptureStreamBufferNV(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLintptrARB offset){ge::gl::getDefaultDirectContext().glBindVideoCaptureStreamBufferNV(video_capture_slot,stream,frame_region,offset);}
+    inline void glTexImage2DMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTexImage2DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+    inline GLint glGetAttribLocationARB(GLhandleARB programObj,const GLcharARB* name){return ge::gl::getDefaultDirectContext().glGetAttribLocationARB(programObj,name);}
+    inline void glDeleteShader(GLuint shader){ge::gl::getDefaultDirectContext().glDeleteShader(shader);}
+    inline void glVertexAttrib1fARB(GLuint index,GLfloat x){ge::gl::getDefaultDirectContext().glVertexAttrib1fARB(index,x);}
+    inline void glTexCoord2fColor4ubVertex3fSUN(GLfloat s,GLfloat t,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTexCoord2fColor4ubVertex3fSUN(s,t,r,g,b,a,x,y,z);}
+    inline void glTexCoord4fVertex4fSUN(GLfloat s,GLfloat t,GLfloat p,GLfloat q,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glTexCoord4fVertex4fSUN(s,t,p,q,x,y,z,w);}
+    inline void glGetMapdv(GLenum target,GLenum query,GLdouble* v){ge::gl::getDefaultDirectContext().glGetMapdv(target,query,v);}
+    inline void glMapParameterfvNV(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glMapParameterfvNV(target,pname,params);}
+    inline void glTextureParameterIuiv(GLuint texture,GLenum pname,const GLuint* params){ge::gl::getDefaultDirectContext().glTextureParameterIuiv(texture,pname,params);}
+    inline void glTransformFeedbackAttribsNV(GLsizei count,const GLint* attribs,GLenum bufferMode){ge::gl::getDefaultDirectContext().glTransformFeedbackAttribsNV(count,attribs,bufferMode);}
+    inline void glFragmentLightfvSGIX(GLenum light,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glFragmentLightfvSGIX(light,pname,params);}
+    inline void glWindowPos3sARB(GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glWindowPos3sARB(x,y,z);}
+    inline void glGetConvolutionParameterfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetConvolutionParameterfv(target,pname,params);}
+    inline void glCopyTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTexSubImage3D(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+    inline void glVertexAttribI3i(GLuint index,GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glVertexAttribI3i(index,x,y,z);}
+    inline GLhandleARB glCreateShaderObjectARB(GLenum shaderType){return ge::gl::getDefaultDirectContext().glCreateShaderObjectARB(shaderType);}
+    inline void glVertexAttribFormat(GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexAttribFormat(attribindex,size,type,normalized,relativeoffset);}
+    inline void glGetProgramivARB(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramivARB(target,pname,params);}
+    inline void glVertexAttribI4usv(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttribI4usv(index,v);}
+    inline void glTexParameterf(GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glTexParameterf(target,pname,param);}
+    inline void glVertexAttribBinding(GLuint attribindex,GLuint bindingindex){ge::gl::getDefaultDirectContext().glVertexAttribBinding(attribindex,bindingindex);}
+    inline void glGetHistogramParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetHistogramParameteriv(target,pname,params);}
+    inline void glTexParameteri(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glTexParameteri(target,pname,param);}
+    inline void glGetShaderSource(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* source){ge::gl::getDefaultDirectContext().glGetShaderSource(shader,bufSize,length,source);}
+    inline void glVertexAttrib4s(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glVertexAttrib4s(index,x,y,z,w);}
+    inline void glVertexAttrib4dvNV(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib4dvNV(index,v);}
+    inline void glVertexAttrib1dvNV(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib1dvNV(index,v);}
+    inline void glPopName(){ge::gl::getDefaultDirectContext().glPopName();}
+    inline void glTextureBufferEXT(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glTextureBufferEXT(texture,target,internalformat,buffer);}
+    inline void glGetMultiTexImageEXT(GLenum texunit,GLenum target,GLint level,GLenum format,GLenum type,void* pixels){ge::gl::getDefaultDirectContext().glGetMultiTexImageEXT(texunit,target,level,format,type,pixels);}
+    inline void glGetPointerIndexedvEXT(GLenum target,GLuint index,void** data){ge::gl::getDefaultDirectContext().glGetPointerIndexedvEXT(target,index,data);}
+    inline GLboolean glIsNameAMD(GLenum identifier,GLuint name){return ge::gl::getDefaultDirectContext().glIsNameAMD(identifier,name);}
+    inline void glColor4ub(GLubyte red,GLubyte green,GLubyte blue,GLubyte alpha){ge::gl::getDefaultDirectContext().glColor4ub(red,green,blue,alpha);}
+    inline void glBufferParameteriAPPLE(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glBufferParameteriAPPLE(target,pname,param);}
+    inline void glColor4ui(GLuint red,GLuint green,GLuint blue,GLuint alpha){ge::gl::getDefaultDirectContext().glColor4ui(red,green,blue,alpha);}
+    inline void glGetInternalformativ(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint* params){ge::gl::getDefaultDirectContext().glGetInternalformativ(target,internalformat,pname,bufSize,params);}
+    inline void glColor4us(GLushort red,GLushort green,GLushort blue,GLushort alpha){ge::gl::getDefaultDirectContext().glColor4us(red,green,blue,alpha);}
+    inline void glVertexAttribP1uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexAttribP1uiv(index,type,normalized,value);}
+    inline void glLinkProgram(GLuint program){ge::gl::getDefaultDirectContext().glLinkProgram(program);}
+    inline void glTexCoord3s(GLshort s,GLshort t,GLshort r){ge::gl::getDefaultDirectContext().glTexCoord3s(s,t,r);}
+    inline void glTexCoord2dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glTexCoord2dv(v);}
+    inline void glGetObjectLabel(GLenum identifier,GLuint name,GLsizei bufSize,GLsizei* length,GLchar* label){ge::gl::getDefaultDirectContext().glGetObjectLabel(identifier,name,bufSize,length,label);}
+    inline void glVertexPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer){ge::gl::getDefaultDirectContext().glVertexPointerEXT(size,type,stride,count,pointer);}
+    inline void glDebugMessageCallbackARB(GLDEBUGPROCARB callback,const void* userParam){ge::gl::getDefaultDirectContext().glDebugMessageCallbackARB(callback,userParam);}
+    inline const GLubyte* glGetString(GLenum name){return ge::gl::getDefaultDirectContext().glGetString(name);}
+    inline void glGetPathParameterfvNV(GLuint path,GLenum pname,GLfloat* value){ge::gl::getDefaultDirectContext().glGetPathParameterfvNV(path,pname,value);}
+    inline void glLightxvOES(GLenum light,GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glLightxvOES(light,pname,params);}
+    inline void glEndQuery(GLenum target){ge::gl::getDefaultDirectContext().glEndQuery(target);}
+    inline void glSecondaryColor3uiv(const GLuint* v){ge::gl::getDefaultDirectContext().glSecondaryColor3uiv(v);}
+    inline void glPrioritizeTexturesxOES(GLsizei n,const GLuint* textures,const GLfixed* priorities){ge::gl::getDefaultDirectContext().glPrioritizeTexturesxOES(n,textures,priorities);}
+    inline void glEdgeFlagPointer(GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glEdgeFlagPointer(stride,ptr);}
+    inline void glFramebufferParameteri(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glFramebufferParameteri(target,pname,param);}
+    inline void glTexCoord3hNV(GLhalfNV s,GLhalfNV t,GLhalfNV r){ge::gl::getDefaultDirectContext().glTexCoord3hNV(s,t,r);}
+    inline void glMultiModeDrawElementsIBM(const GLenum* mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount,GLint modestride){ge::gl::getDefaultDirectContext().glMultiModeDrawElementsIBM(mode,count,type,indices,primcount,modestride);}
+    inline void glCopyPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum type){ge::gl::getDefaultDirectContext().glCopyPixels(x,y,width,height,type);}
+    inline void glVertexAttribI2ui(GLuint index,GLuint x,GLuint y){ge::gl::getDefaultDirectContext().glVertexAttribI2ui(index,x,y);}
+    inline void glClampColorARB(GLenum target,GLenum clamp){ge::gl::getDefaultDirectContext().glClampColorARB(target,clamp);}
+    inline void glColorPointervINTEL(GLint size,GLenum type,const void** pointer){ge::gl::getDefaultDirectContext().glColorPointervINTEL(size,type,pointer);}
+    inline void glDeleteTextures(GLsizei n,const GLuint* textures){ge::gl::getDefaultDirectContext().glDeleteTextures(n,textures);}
+    inline void glGetMinmaxParameterfvEXT(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMinmaxParameterfvEXT(target,pname,params);}
+    inline void glWindowPos3sMESA(GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glWindowPos3sMESA(x,y,z);}
+    inline void glVertexAttrib4f(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glVertexAttrib4f(index,x,y,z,w);}
+    inline void glNamedFramebufferParameteri(GLuint framebuffer,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glNamedFramebufferParameteri(framebuffer,pname,param);}
+    inline void glTexCoord2fVertex3fvSUN(const GLfloat* tc,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fVertex3fvSUN(tc,v);}
+    inline void glReplacementCodeusSUN(GLushort code){ge::gl::getDefaultDirectContext().glReplacementCodeusSUN(code);}
+    inline void glGetNamedFramebufferParameteriv(GLuint framebuffer,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetNamedFramebufferParameteriv(framebuffer,pname,param);}
+    inline void glVertexStream1fvATI(GLenum stream,const GLfloat* coords){ge::gl::getDefaultDirectContext().glVertexStream1fvATI(stream,coords);}
+    inline void glCreateVertexArrays(GLsizei n,GLuint* arrays){ge::gl::getDefaultDirectContext().glCreateVertexArrays(n,arrays);}
+    inline void glBeginConditionalRender(GLuint id,GLenum mode){ge::gl::getDefaultDirectContext().glBeginConditionalRender(id,mode);}
+    inline void glGetUnsignedBytevEXT(GLenum pname,GLubyte* data){ge::gl::getDefaultDirectContext().glGetUnsignedBytevEXT(pname,data);}
+    inline void glConvolutionFilter1D(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* image){ge::gl::getDefaultDirectContext().glConvolutionFilter1D(target,internalformat,width,format,type,image);}
+    inline void glMultiTexCoord3fARB(GLenum target,GLfloat s,GLfloat t,GLfloat r){ge::gl::getDefaultDirectContext().glMultiTexCoord3fARB(target,s,t,r);}
+    inline void glGetQueryObjectuivARB(GLuint id,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetQueryObjectuivARB(id,pname,params);}
+    inline void glScalexOES(GLfixed x,GLfixed y,GLfixed z){ge::gl::getDefaultDirectContext().glScalexOES(x,y,z);}
+    inline void glSamplerParameteri(GLuint sampler,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glSamplerParameteri(sampler,pname,param);}
+    inline void glSamplerParameterf(GLuint sampler,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glSamplerParameterf(sampler,pname,param);}
+    inline void glShaderOp1EXT(GLenum op,GLuint res,GLuint arg1){ge::gl::getDefaultDirectContext().glShaderOp1EXT(op,res,arg1);}
+    inline void glBeginVideoCaptureNV(GLuint video_capture_slot){ge::gl::getDefaultDirectContext().glBeginVideoCaptureNV(video_capture_slot);}
+    inline void glGetnHistogram(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values){ge::gl::getDefaultDirectContext().glGetnHistogram(target,reset,format,type,bufSize,values);}
+    inline void glUniform1d(GLint location,GLdouble x){ge::gl::getDefaultDirectContext().glUniform1d(location,x);}
+    inline GLint glRenderMode(GLenum mode){return ge::gl::getDefaultDirectContext().glRenderMode(mode);}
+    inline void glClearColorIiEXT(GLint red,GLint green,GLint blue,GLint alpha){ge::gl::getDefaultDirectContext().glClearColorIiEXT(red,green,blue,alpha);}
+    inline void glSignalSemaphoreEXT(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* dstLayouts){ge::gl::getDefaultDirectContext().glSignalSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,dstLayouts);}
+    inline void glGetCompressedTexImage(GLenum target,GLint lod,GLvoid* img){ge::gl::getDefaultDirectContext().glGetCompressedTexImage(target,lod,img);}
+    inline void glCompressedTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureImage1DEXT(texture,target,level,internalformat,width,border,imageSize,bits);}
+    inline void glGetActiveUniformBlockiv(GLuint program,GLuint uniformBlockIndex,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetActiveUniformBlockiv(program,uniformBlockIndex,pname,params);}
+    inline void glUniform1i(GLint location,GLint v0){ge::gl::getDefaultDirectContext().glUniform1i(location,v0);}
+    inline void glMultiDrawArraysIndirectCount(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirectCount(mode,indirect,drawcount,maxdrawcount,stride);}
+    inline void glGetTexEnvfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTexEnvfv(target,pname,params);}
+    inline void glColorTableParameterivSGI(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glColorTableParameterivSGI(target,pname,params);}
+    inline void glCullFace(GLenum mode){ge::gl::getDefaultDirectContext().glCullFace(mode);}
+    inline void glDeleteFencesAPPLE(GLsizei n,const GLuint* fences){ge::gl::getDefaultDirectContext().glDeleteFencesAPPLE(n,fences);}
+    inline void glProgramUniform4i(GLuint program,GLint location,GLint v0,GLint v1,GLint v2,GLint v3){ge::gl::getDefaultDirectContext().glProgramUniform4i(program,location,v0,v1,v2,v3);}
+    inline void glUniformHandleui64ARB(GLint location,GLuint64 value){ge::gl::getDefaultDirectContext().glUniformHandleui64ARB(location,value);}
+    inline void glProgramUniform4f(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3){ge::gl::getDefaultDirectContext().glProgramUniform4f(program,location,v0,v1,v2,v3);}
+    inline void glViewportIndexedf(GLuint index,GLfloat x,GLfloat y,GLfloat w,GLfloat h){ge::gl::getDefaultDirectContext().glViewportIndexedf(index,x,y,w,h);}
+    inline void glProgramUniform4d(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2,GLdouble v3){ge::gl::getDefaultDirectContext().glProgramUniform4d(program,location,v0,v1,v2,v3);}
+    inline void glTexCoord1xOES(GLfixed s){ge::gl::getDefaultDirectContext().glTexCoord1xOES(s);}
+    inline void glVertexStream3ivATI(GLenum stream,const GLint* coords){ge::gl::getDefaultDirectContext().glVertexStream3ivATI(stream,coords);}
+    inline GLboolean glPointAlongPathNV(GLuint path,GLsizei startSegment,GLsizei numSegments,GLfloat distance,GLfloat* x,GLfloat* y,GLfloat* tangentX,GLfloat* tangentY){return ge::gl::getDefaultDirectContext().glPointAlongPathNV(path,startSegment,numSegments,distance,x,y,tangentX,tangentY);}
+    inline void glEndQueryARB(GLenum target){ge::gl::getDefaultDirectContext().glEndQueryARB(target);}
+    inline void glVDPAUMapSurfacesNV(GLsizei numSurfaces,const GLvdpauSurfaceNV* surfaces){ge::gl::getDefaultDirectContext().glVDPAUMapSurfacesNV(numSurfaces,surfaces);}
+    inline void glVertex3i(GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glVertex3i(x,y,z);}
+    inline void glVertexAttrib4uivARB(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4uivARB(index,v);}
+    inline void glTextureStorageMem3DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTextureStorageMem3DEXT(texture,levels,internalFormat,width,height,depth,memory,offset);}
+    inline void glAttachShader(GLuint program,GLuint shader){ge::gl::getDefaultDirectContext().glAttachShader(program,shader);}
+    inline void glColor4hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue,GLhalfNV alpha){ge::gl::getDefaultDirectContext().glColor4hNV(red,green,blue,alpha);}
+    inline void glGetFenceivNV(GLuint fence,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFenceivNV(fence,pname,params);}
+    inline void glTexCoord2fColor4ubVertex3fvSUN(const GLfloat* tc,const GLubyte* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fColor4ubVertex3fvSUN(tc,c,v);}
+    inline void glGetColorTable(GLenum target,GLenum format,GLenum type,GLvoid* table){ge::gl::getDefaultDirectContext().glGetColorTable(target,format,type,table);}
+    inline void glFogCoordPointer(GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glFogCoordPointer(type,stride,pointer);}
+    inline void glTexStorageSparseAMD(GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags){ge::gl::getDefaultDirectContext().glTexStorageSparseAMD(target,internalFormat,width,height,depth,layers,flags);}
+    inline GLboolean glUnmapNamedBuffer(GLuint buffer){return ge::gl::getDefaultDirectContext().glUnmapNamedBuffer(buffer);}
+    inline void glTexCoord4bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glTexCoord4bvOES(coords);}
+    inline void glVertexAttrib3fARB(GLuint index,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glVertexAttrib3fARB(index,x,y,z);}
+    inline void glRasterPos2xOES(GLfixed x,GLfixed y){ge::gl::getDefaultDirectContext().glRasterPos2xOES(x,y);}
+    inline void glCreateMemoryObjectsEXT(GLsizei n,GLuint* memoryObjects){ge::gl::getDefaultDirectContext().glCreateMemoryObjectsEXT(n,memoryObjects);}
+    inline void glColor4ubVertex2fvSUN(const GLubyte* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glColor4ubVertex2fvSUN(c,v);}
+    inline void glSecondaryColor3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glSecondaryColor3dv(v);}
+    inline void glVertexAttribI4sv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribI4sv(index,v);}
+    inline void glDrawTransformFeedbackStreamInstanced(GLenum mode,GLuint id,GLuint stream,GLsizei instancecount){ge::gl::getDefaultDirectContext().glDrawTransformFeedbackStreamInstanced(mode,id,stream,instancecount);}
+    inline void glMultiTexCoord4ivARB(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4ivARB(target,v);}
+    inline void glSpriteParameterfSGIX(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glSpriteParameterfSGIX(pname,param);}
+    inline void glSecondaryColor3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glSecondaryColor3sv(v);}
+    inline void glBindVideoCaptureStreamTextureNV(GLuint video_capture_slot,GLuint stream,GLenum frame_region,GLenum target,GLuint texture){ge::gl::getDefaultDirectContext().glBindVideoCaptureStreamTextureNV(video_capture_slot,stream,frame_region,target,texture);}
+    inline void glTexParameterIuiv(GLenum target,GLenum pname,const GLuint* params){ge::gl::getDefaultDirectContext().glTexParameterIuiv(target,pname,params);}
+    inline void glFlushPixelDataRangeNV(GLenum target){ge::gl::getDefaultDirectContext().glFlushPixelDataRangeNV(target);}
+    inline void glWindowPos3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos3fv(v);}
+    inline void glVertexAttribLFormatNV(GLuint index,GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexAttribLFormatNV(index,size,type,stride);}
+    inline void glLightModelfv(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glLightModelfv(pname,params);}
+    inline void glGetColorTableSGI(GLenum target,GLenum format,GLenum type,void* table){ge::gl::getDefaultDirectContext().glGetColorTableSGI(target,format,type,table);}
+    inline void glGetCompressedTexImageARB(GLenum target,GLint level,void* img){ge::gl::getDefaultDirectContext().glGetCompressedTexImageARB(target,level,img);}
+    inline void glConvolutionParameteri(GLenum target,GLenum pname,GLint params){ge::gl::getDefaultDirectContext().glConvolutionParameteri(target,pname,params);}
+    inline void glVertexWeighthNV(GLhalfNV weight){ge::gl::getDefaultDirectContext().glVertexWeighthNV(weight);}
+    inline void glColorMaskIndexedEXT(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a){ge::gl::getDefaultDirectContext().glColorMaskIndexedEXT(index,r,g,b,a);}
+    inline void glColorMaski(GLuint index,GLboolean r,GLboolean g,GLboolean b,GLboolean a){ge::gl::getDefaultDirectContext().glColorMaski(index,r,g,b,a);}
+    inline void glColorFragmentOp1ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod){ge::gl::getDefaultDirectContext().glColorFragmentOp1ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod);}
+    inline void glVertexAttribI4ubvEXT(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttribI4ubvEXT(index,v);}
+    inline void glVertexAttrib1dNV(GLuint index,GLdouble x){ge::gl::getDefaultDirectContext().glVertexAttrib1dNV(index,x);}
+    inline void glUnmapObjectBufferATI(GLuint buffer){ge::gl::getDefaultDirectContext().glUnmapObjectBufferATI(buffer);}
+    inline void glNamedProgramLocalParameterI4uiEXT(GLuint program,GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameterI4uiEXT(program,target,index,x,y,z,w);}
+    inline void glProgramUniform1iEXT(GLuint program,GLint location,GLint v0){ge::gl::getDefaultDirectContext().glProgramUniform1iEXT(program,location,v0);}
+    inline void glDeleteQueriesARB(GLsizei n,const GLuint* ids){ge::gl::getDefaultDirectContext().glDeleteQueriesARB(n,ids);}
+    inline void glWindowPos3svARB(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos3svARB(v);}
+    inline void glVertex4s(GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glVertex4s(x,y,z,w);}
+    inline void glImportMemoryWin32NameEXT(GLuint memory,GLuint64 size,GLenum handleType,const void* name){ge::gl::getDefaultDirectContext().glImportMemoryWin32NameEXT(memory,size,handleType,name);}
+    inline void glStringMarkerGREMEDY(GLsizei len,const void* string){ge::gl::getDefaultDirectContext().glStringMarkerGREMEDY(len,string);}
+    inline GLboolean glIsTransformFeedback(GLuint id){return ge::gl::getDefaultDirectContext().glIsTransformFeedback(id);}
+    inline void glProgramUniformMatrix2x3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x3dvEXT(program,location,count,transpose,value);}
+    inline void glGetObjectLabelEXT(GLenum type,GLuint object,GLsizei bufSize,GLsizei* length,GLchar* label){ge::gl::getDefaultDirectContext().glGetObjectLabelEXT(type,object,bufSize,length,label);}
+    inline void glUniformHandleui64vNV(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniformHandleui64vNV(location,count,value);}
+    inline void glRotated(GLdouble angle,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glRotated(angle,x,y,z);}
+    inline GLboolean glIsProgramPipeline(GLuint pipeline){return ge::gl::getDefaultDirectContext().glIsProgramPipeline(pipeline);}
+    inline void glRotatef(GLfloat angle,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glRotatef(angle,x,y,z);}
+    inline void glVertex4i(GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glVertex4i(x,y,z,w);}
+    inline void glGetActiveSubroutineUniformName(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name){ge::gl::getDefaultDirectContext().glGetActiveSubroutineUniformName(program,shadertype,index,bufsize,length,name);}
+    inline void glVertexAttrib4sNV(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glVertexAttrib4sNV(index,x,y,z,w);}
+    inline void glProgramLocalParameter4dvARB(GLenum target,GLuint index,const GLdouble* params){ge::gl::getDefaultDirectContext().glProgramLocalParameter4dvARB(target,index,params);}
+    inline void glReplacementCodeubSUN(GLubyte code){ge::gl::getDefaultDirectContext().glReplacementCodeubSUN(code);}
+    inline void glMultiDrawElementsIndirectBindlessNV(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirectBindlessNV(mode,type,indirect,drawCount,stride,vertexBufferCount);}
+    inline void glImportSemaphoreWin32HandleEXT(GLuint semaphore,GLenum handleType,void* handle){ge::gl::getDefaultDirectContext().glImportSemaphoreWin32HandleEXT(semaphore,handleType,handle);}
+    inline void glUniformMatrix3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix3fv(location,count,transpose,value);}
+    inline void glGetnMapfvARB(GLenum target,GLenum query,GLsizei bufSize,GLfloat* v){ge::gl::getDefaultDirectContext().glGetnMapfvARB(target,query,bufSize,v);}
+    inline void glGetnUniformfv(GLuint program,GLint location,GLsizei bufSize,GLfloat* params){ge::gl::getDefaultDirectContext().glGetnUniformfv(program,location,bufSize,params);}
+    inline void glVertexAttribL2dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL2dv(index,v);}
+    inline void glVertexWeightPointerEXT(GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexWeightPointerEXT(size,type,stride,pointer);}
+    inline void glTangent3sEXT(GLshort tx,GLshort ty,GLshort tz){ge::gl::getDefaultDirectContext().glTangent3sEXT(tx,ty,tz);}
+    inline void glSecondaryColorPointer(GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glSecondaryColorPointer(size,type,stride,pointer);}
+    inline void glAlphaFunc(GLenum func,GLclampf ref){ge::gl::getDefaultDirectContext().glAlphaFunc(func,ref);}
+    inline void glGetNamedStringARB(GLint namelen,const GLchar* name,GLsizei bufSize,GLint* stringlen,GLchar* string){ge::gl::getDefaultDirectContext().glGetNamedStringARB(namelen,name,bufSize,stringlen,string);}
+    inline void glTexCoord4d(GLdouble s,GLdouble t,GLdouble r,GLdouble q){ge::gl::getDefaultDirectContext().glTexCoord4d(s,t,r,q);}
+    inline void glBufferPageCommitmentARB(GLenum target,GLintptr offset,GLsizeiptr size,GLboolean commit){ge::gl::getDefaultDirectContext().glBufferPageCommitmentARB(target,offset,size,commit);}
+    inline void glProgramLocalParameters4fvEXT(GLenum target,GLuint index,GLsizei count,const GLfloat* params){ge::gl::getDefaultDirectContext().glProgramLocalParameters4fvEXT(target,index,count,params);}
+    inline void glStencilFunc(GLenum func,GLint ref,GLuint mask){ge::gl::getDefaultDirectContext().glStencilFunc(func,ref,mask);}
+    inline void glSemaphoreParameterui64vEXT(GLuint semaphore,GLenum pname,const GLuint64* params){ge::gl::getDefaultDirectContext().glSemaphoreParameterui64vEXT(semaphore,pname,params);}
+    inline void glGetVertexAttribdvNV(GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVertexAttribdvNV(index,pname,params);}
+    inline void glTexCoord3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glTexCoord3dv(v);}
+    inline void glGetQueryBufferObjectiv(GLuint id,GLuint buffer,GLenum pname,GLintptr offset){ge::gl::getDefaultDirectContext().glGetQueryBufferObjectiv(id,buffer,pname,offset);}
+    inline void glTexGenxOES(GLenum coord,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glTexGenxOES(coord,pname,param);}
+    inline void glMultiTexCoord1fvARB(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1fvARB(target,v);}
+    inline void glLightEnviSGIX(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glLightEnviSGIX(pname,param);}
+    inline void glGetProgramPipelineiv(GLuint pipeline,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramPipelineiv(pipeline,pname,params);}
+    inline void glVertexStream2ivATI(GLenum stream,const GLint* coords){ge::gl::getDefaultDirectContext().glVertexStream2ivATI(stream,coords);}
+    inline void glGetColorTableEXT(GLenum target,GLenum format,GLenum type,void* data){ge::gl::getDefaultDirectContext().glGetColorTableEXT(target,format,type,data);}
+    inline void glGetShaderInfoLog(GLuint shader,GLsizei bufSize,GLsizei* length,GLchar* infoLog){ge::gl::getDefaultDirectContext().glGetShaderInfoLog(shader,bufSize,length,infoLog);}
+    inline void glGetOcclusionQueryuivNV(GLuint id,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetOcclusionQueryuivNV(id,pname,params);}
+    inline void glInvalidateNamedFramebufferSubData(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glInvalidateNamedFramebufferSubData(framebuffer,numAttachments,attachments,x,y,width,height);}
+    inline void glVertexAttribL1i64NV(GLuint index,GLint64EXT x){ge::gl::getDefaultDirectContext().glVertexAttribL1i64NV(index,x);}
+    inline void glVDPAUInitNV(const void* vdpDevice,const void* getProcAddress){ge::gl::getDefaultDirectContext().glVDPAUInitNV(vdpDevice,getProcAddress);}
+    inline void glVertexAttrib1hvNV(GLuint index,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttrib1hvNV(index,v);}
+    inline void glVertexAttribI4i(GLuint index,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glVertexAttribI4i(index,x,y,z,w);}
+    inline void glRasterPos2iv(const GLint* v){ge::gl::getDefaultDirectContext().glRasterPos2iv(v);}
+    inline void glGetIntegerui64i_vNV(GLenum value,GLuint index,GLuint64EXT* result){ge::gl::getDefaultDirectContext().glGetIntegerui64i_vNV(value,index,result);}
+    inline void glUniformHandleui64NV(GLint location,GLuint64 value){ge::gl::getDefaultDirectContext().glUniformHandleui64NV(location,value);}
+    inline void glWindowPos3ivMESA(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos3ivMESA(v);}
+    inline void glBlendEquationSeparate(GLenum modeRGB,GLenum modeAlpha){ge::gl::getDefaultDirectContext().glBlendEquationSeparate(modeRGB,modeAlpha);}
+    inline void glDrawElementsInstancedARB(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount){ge::gl::getDefaultDirectContext().glDrawElementsInstancedARB(mode,count,type,indices,primcount);}
+    inline GLuint glGetSubroutineIndex(GLuint program,GLenum shadertype,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetSubroutineIndex(program,shadertype,name);}
+    inline void glVertexAttrib2sv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib2sv(index,v);}
+    inline void glSamplePatternSGIS(GLenum pattern){ge::gl::getDefaultDirectContext().glSamplePatternSGIS(pattern);}
+    inline void glEGLImageTargetRenderbufferStorageOES(GLenum target,GLeglImageOES image){ge::gl::getDefaultDirectContext().glEGLImageTargetRenderbufferStorageOES(target,image);}
+    inline void glPushAttrib(GLbitfield mask){ge::gl::getDefaultDirectContext().glPushAttrib(mask);}
+    inline void glVertex3hNV(GLhalfNV x,GLhalfNV y,GLhalfNV z){ge::gl::getDefaultDirectContext().glVertex3hNV(x,y,z);}
+    inline void glRasterPos3xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glRasterPos3xvOES(coords);}
+    inline void glPathParameterfNV(GLuint path,GLenum pname,GLfloat value){ge::gl::getDefaultDirectContext().glPathParameterfNV(path,pname,value);}
+    inline void glGetUniformi64vNV(GLuint program,GLint location,GLint64EXT* params){ge::gl::getDefaultDirectContext().glGetUniformi64vNV(program,location,params);}
+    inline void glLightiv(GLenum light,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glLightiv(light,pname,params);}
+    inline void glMaterialxvOES(GLenum face,GLenum pname,const GLfixed* param){ge::gl::getDefaultDirectContext().glMaterialxvOES(face,pname,param);}
+    inline void glNamedProgramLocalParameter4fEXT(GLuint program,GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameter4fEXT(program,target,index,x,y,z,w);}
+    inline void glVertexAttribL1dEXT(GLuint index,GLdouble x){ge::gl::getDefaultDirectContext().glVertexAttribL1dEXT(index,x);}
+    inline void glGetnUniformdvARB(GLuint program,GLint location,GLsizei bufSize,GLdouble* params){ge::gl::getDefaultDirectContext().glGetnUniformdvARB(program,location,bufSize,params);}
+    inline void glSecondaryColor3bEXT(GLbyte red,GLbyte green,GLbyte blue){ge::gl::getDefaultDirectContext().glSecondaryColor3bEXT(red,green,blue);}
+    inline void glBeginPerfQueryINTEL(GLuint queryHandle){ge::gl::getDefaultDirectContext().glBeginPerfQueryINTEL(queryHandle);}
+    inline void glProgramUniform1uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform1uivEXT(program,location,count,value);}
+    inline void glImageTransformParameterivHP(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glImageTransformParameterivHP(target,pname,params);}
+    inline void glDeleteBuffers(GLsizei n,const GLuint* buffers){ge::gl::getDefaultDirectContext().glDeleteBuffers(n,buffers);}
+    inline void glBindProgramPipeline(GLuint pipeline){ge::gl::getDefaultDirectContext().glBindProgramPipeline(pipeline);}
+    inline void glScissor(GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glScissor(x,y,width,height);}
+    inline void glProgramUniform4fv(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform4fv(program,location,count,value);}
+    inline void glGetBooleanv(GLenum pname,GLboolean* params){ge::gl::getDefaultDirectContext().glGetBooleanv(pname,params);}
+    inline void glMaterialfv(GLenum face,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glMaterialfv(face,pname,params);}
+    inline void glWindowPos4fvMESA(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos4fvMESA(v);}
+    inline void glVertexAttribIPointerEXT(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribIPointerEXT(index,size,type,stride,pointer);}
+    inline void glProgramBufferParametersfvNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLfloat* params){ge::gl::getDefaultDirectContext().glProgramBufferParametersfvNV(target,bindingIndex,wordIndex,count,params);}
+    inline void glAlphaFuncxOES(GLenum func,GLfixed ref){ge::gl::getDefaultDirectContext().glAlphaFuncxOES(func,ref);}
+    inline void glMultiDrawArraysIndirectAMD(GLenum mode,const void* indirect,GLsizei primcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirectAMD(mode,indirect,primcount,stride);}
+    inline void glNormalStream3ivATI(GLenum stream,const GLint* coords){ge::gl::getDefaultDirectContext().glNormalStream3ivATI(stream,coords);}
+    inline void glTextureImage3DMultisampleNV(GLuint texture,GLenum target,GLsizei samples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTextureImage3DMultisampleNV(texture,target,samples,internalFormat,width,height,depth,fixedSampleLocations);}
+    inline void glProgramUniform4uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform4uivEXT(program,location,count,value);}
+    inline void glReplacementCodeusvSUN(const GLushort* code){ge::gl::getDefaultDirectContext().glReplacementCodeusvSUN(code);}
+    inline GLint glPollInstrumentsSGIX(GLint* marker_p){return ge::gl::getDefaultDirectContext().glPollInstrumentsSGIX(marker_p);}
+    inline void glGetTextureLevelParameteriv(GLuint texture,GLint level,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureLevelParameteriv(texture,level,pname,params);}
+    inline void glVertexAttribI2uiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI2uiv(index,v);}
+    inline void glMapControlPointsNV(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLint uorder,GLint vorder,GLboolean packed,const void* points){ge::gl::getDefaultDirectContext().glMapControlPointsNV(target,index,type,ustride,vstride,uorder,vorder,packed,points);}
+    inline void glColor4dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glColor4dv(v);}
+    inline void glInvalidateBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr length){ge::gl::getDefaultDirectContext().glInvalidateBufferSubData(buffer,offset,length);}
+    inline void glMultiTexCoord1hNV(GLenum target,GLhalfNV s){ge::gl::getDefaultDirectContext().glMultiTexCoord1hNV(target,s);}
+    inline void glPointParameterfv(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPointParameterfv(pname,params);}
+    inline void glUniformMatrix2fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix2fvARB(location,count,transpose,value);}
+    inline void glUniform2fv(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform2fv(location,count,value);}
+    inline void glVertexPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glVertexPointerListIBM(size,type,stride,pointer,ptrstride);}
+    inline void glGetMultiTexGenfvEXT(GLenum texunit,GLenum coord,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMultiTexGenfvEXT(texunit,coord,pname,params);}
+    inline void glGetMinmaxEXT(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values){ge::gl::getDefaultDirectContext().glGetMinmaxEXT(target,reset,format,type,values);}
+    inline GLboolean glIsFenceNV(GLuint fence){return ge::gl::getDefaultDirectContext().glIsFenceNV(fence);}
+    inline void glMatrixFrustumEXT(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar){ge::gl::getDefaultDirectContext().glMatrixFrustumEXT(mode,left,right,bottom,top,zNear,zFar);}
+    inline void glDispatchComputeIndirect(GLintptr indirect){ge::gl::getDefaultDirectContext().glDispatchComputeIndirect(indirect);}
+    inline GLint glQueryResourceNV(GLenum queryType,GLint tagId,GLuint bufSize,GLint* buffer){return ge::gl::getDefaultDirectContext().glQueryResourceNV(queryType,tagId,bufSize,buffer);}
+    inline void glMultiTexCoord4bOES(GLenum texture,GLbyte s,GLbyte t,GLbyte r,GLbyte q){ge::gl::getDefaultDirectContext().glMultiTexCoord4bOES(texture,s,t,r,q);}
+    inline void glProgramEnvParameter4dARB(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glProgramEnvParameter4dARB(target,index,x,y,z,w);}
+    inline void glProgramUniform1uiEXT(GLuint program,GLint location,GLuint v0){ge::gl::getDefaultDirectContext().glProgramUniform1uiEXT(program,location,v0);}
+    inline void glBindBufferRange(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glBindBufferRange(target,index,buffer,offset,size);}
+    inline void glNormal3iv(const GLint* v){ge::gl::getDefaultDirectContext().glNormal3iv(v);}
+    inline void glVertexAttribL3dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL3dv(index,v);}
+    inline void glGetUniformdv(GLuint program,GLint location,GLdouble* params){ge::gl::getDefaultDirectContext().glGetUniformdv(program,location,params);}
+    inline void glGetMultiTexLevelParameterfvEXT(GLenum texunit,GLenum target,GLint level,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMultiTexLevelParameterfvEXT(texunit,target,level,pname,params);}
+    inline void glFinalCombinerInputNV(GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage){ge::gl::getDefaultDirectContext().glFinalCombinerInputNV(variable,input,mapping,componentUsage);}
+    inline void glCullParameterdvEXT(GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glCullParameterdvEXT(pname,params);}
+    inline void glMultiTexCoord4s(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q){ge::gl::getDefaultDirectContext().glMultiTexCoord4s(target,s,t,r,q);}
+    inline void glMapVertexAttrib1fAPPLE(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points){ge::gl::getDefaultDirectContext().glMapVertexAttrib1fAPPLE(index,size,u1,u2,stride,order,points);}
+    inline void glConvolutionParameterfEXT(GLenum target,GLenum pname,GLfloat params){ge::gl::getDefaultDirectContext().glConvolutionParameterfEXT(target,pname,params);}
+    inline void glTexCoord1iv(const GLint* v){ge::gl::getDefaultDirectContext().glTexCoord1iv(v);}
+    inline void glProgramUniform3fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform3fvEXT(program,location,count,value);}
+    inline void glColor3uiv(const GLuint* v){ge::gl::getDefaultDirectContext().glColor3uiv(v);}
+    inline void glRenderGpuMaskNV(GLbitfield mask){ge::gl::getDefaultDirectContext().glRenderGpuMaskNV(mask);}
+    inline void glListBase(GLuint base){ge::gl::getDefaultDirectContext().glListBase(base);}
+    inline void glTexCoord2bOES(GLbyte s,GLbyte t){ge::gl::getDefaultDirectContext().glTexCoord2bOES(s,t);}
+    inline GLuint glBindMaterialParameterEXT(GLenum face,GLenum value){return ge::gl::getDefaultDirectContext().glBindMaterialParameterEXT(face,value);}
+    inline void glGlobalAlphaFactorubSUN(GLubyte factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactorubSUN(factor);}
+    inline void glVertexAttribL1ui64NV(GLuint index,GLuint64EXT x){ge::gl::getDefaultDirectContext().glVertexAttribL1ui64NV(index,x);}
+    inline void glPointParameterfSGIS(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPointParameterfSGIS(pname,param);}
+    inline void glGetImageTransformParameterivHP(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetImageTransformParameterivHP(target,pname,params);}
+    inline void glColorSubTableEXT(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glColorSubTableEXT(target,start,count,format,type,data);}
+    inline void glPixelTexGenParameterfvSGIS(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPixelTexGenParameterfvSGIS(pname,params);}
+    inline GLenum glClientWaitSync(GLsync sync,GLbitfield flags,GLuint64 timeout){return ge::gl::getDefaultDirectContext().glClientWaitSync(sync,flags,timeout);}
+    inline void glQueryObjectParameteruiAMD(GLenum target,GLuint id,GLenum pname,GLuint param){ge::gl::getDefaultDirectContext().glQueryObjectParameteruiAMD(target,id,pname,param);}
+    inline void glVertexAttribs1fvNV(GLuint index,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttribs1fvNV(index,count,v);}
+    inline void glVertexAttrib4NusvARB(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NusvARB(index,v);}
+    inline void glVariantPointerEXT(GLuint id,GLenum type,GLuint stride,const void* addr){ge::gl::getDefaultDirectContext().glVariantPointerEXT(id,type,stride,addr);}
+    inline void glTextureBuffer(GLuint texture,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glTextureBuffer(texture,internalformat,buffer);}
+    inline void glVertexAttribI1uiEXT(GLuint index,GLuint x){ge::gl::getDefaultDirectContext().glVertexAttribI1uiEXT(index,x);}
+    inline void glInvalidateTexImage(GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glInvalidateTexImage(texture,level);}
+    inline void glProgramEnvParametersI4ivNV(GLenum target,GLuint index,GLsizei count,const GLint* params){ge::gl::getDefaultDirectContext().glProgramEnvParametersI4ivNV(target,index,count,params);}
+    inline GLenum glPathGlyphIndexArrayNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale){return ge::gl::getDefaultDirectContext().glPathGlyphIndexArrayNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+    inline void glCopyImageSubData(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth){ge::gl::getDefaultDirectContext().glCopyImageSubData(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+    inline void glGetUniformSubroutineuiv(GLenum shadertype,GLint location,GLuint* params){ge::gl::getDefaultDirectContext().glGetUniformSubroutineuiv(shadertype,location,params);}
+    inline void glBindVertexBuffer(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){ge::gl::getDefaultDirectContext().glBindVertexBuffer(bindingindex,buffer,offset,stride);}
+    inline void glMultiTexCoord1iARB(GLenum target,GLint s){ge::gl::getDefaultDirectContext().glMultiTexCoord1iARB(target,s);}
+    inline void glDebugMessageInsert(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf){ge::gl::getDefaultDirectContext().glDebugMessageInsert(source,type,id,severity,length,buf);}
+    inline void glBeginVertexShaderEXT(){ge::gl::getDefaultDirectContext().glBeginVertexShaderEXT();}
+    inline GLboolean glIsVariantEnabledEXT(GLuint id,GLenum cap){return ge::gl::getDefaultDirectContext().glIsVariantEnabledEXT(id,cap);}
+    inline void glPassThroughxOES(GLfixed token){ge::gl::getDefaultDirectContext().glPassThroughxOES(token);}
+    inline GLboolean glIsSampler(GLuint sampler){return ge::gl::getDefaultDirectContext().glIsSampler(sampler);}
+    inline void glConservativeRasterParameterfNV(GLenum pname,GLfloat value){ge::gl::getDefaultDirectContext().glConservativeRasterParameterfNV(pname,value);}
+    inline void glMultiTexGenivEXT(GLenum texunit,GLenum coord,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMultiTexGenivEXT(texunit,coord,pname,params);}
+    inline void glNamedFramebufferTexture2DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glNamedFramebufferTexture2DEXT(framebuffer,attachment,textarget,texture,level);}
+    inline void glCopyTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyTexSubImage1D(target,level,xoffset,x,y,width);}
+    inline void glTexCoord1i(GLint s){ge::gl::getDefaultDirectContext().glTexCoord1i(s);}
+    inline GLenum glCheckFramebufferStatus(GLenum target){return ge::gl::getDefaultDirectContext().glCheckFramebufferStatus(target);}
+    inline void glDrawElementArrayAPPLE(GLenum mode,GLint first,GLsizei count){ge::gl::getDefaultDirectContext().glDrawElementArrayAPPLE(mode,first,count);}
+    inline void glTexCoord1d(GLdouble s){ge::gl::getDefaultDirectContext().glTexCoord1d(s);}
+    inline void glTexCoord1f(GLfloat s){ge::gl::getDefaultDirectContext().glTexCoord1f(s);}
+    inline void glFragmentLightivSGIX(GLenum light,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glFragmentLightivSGIX(light,pname,params);}
+    inline void glBindImageTexture(GLuint unit,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLenum format){ge::gl::getDefaultDirectContext().glBindImageTexture(unit,texture,level,layered,layer,access,format);}
+    inline void glTransformFeedbackVaryings(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode){ge::gl::getDefaultDirectContext().glTransformFeedbackVaryings(program,count,varyings,bufferMode);}
+    inline void glMulticastBufferSubDataNV(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const GLvoid* data){ge::gl::getDefaultDirectContext().glMulticastBufferSubDataNV(gpuMask,buffer,offset,size,data);}
+    inline void glDrawRangeElements(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const GLvoid* indices){ge::gl::getDefaultDirectContext().glDrawRangeElements(mode,start,end,count,type,indices);}
+    inline void glTexCoord1s(GLshort s){ge::gl::getDefaultDirectContext().glTexCoord1s(s);}
+    inline void glBindBufferBase(GLenum target,GLuint index,GLuint buffer){ge::gl::getDefaultDirectContext().glBindBufferBase(target,index,buffer);}
+    inline void glColor3bv(const GLbyte* v){ge::gl::getDefaultDirectContext().glColor3bv(v);}
+    inline void glSyncTextureINTEL(GLuint texture){ge::gl::getDefaultDirectContext().glSyncTextureINTEL(texture);}
+    inline void glCreateSamplers(GLsizei n,GLuint* samplers){ge::gl::getDefaultDirectContext().glCreateSamplers(n,samplers);}
+    inline void glCombinerParameterfNV(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glCombinerParameterfNV(pname,param);}
+    inline void glGetArrayObjectivATI(GLenum array,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetArrayObjectivATI(array,pname,params);}
+    inline void glMultiDrawArrays(GLenum mode,const GLint* first,const GLsizei* count,GLsizei drawcount){ge::gl::getDefaultDirectContext().glMultiDrawArrays(mode,first,count,drawcount);}
+    inline void glSampleMapATI(GLuint dst,GLuint interp,GLenum swizzle){ge::gl::getDefaultDirectContext().glSampleMapATI(dst,interp,swizzle);}
+    inline void glProgramUniform2i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y){ge::gl::getDefaultDirectContext().glProgramUniform2i64ARB(program,location,x,y);}
+    inline void glBinormal3ivEXT(const GLint* v){ge::gl::getDefaultDirectContext().glBinormal3ivEXT(v);}
+    inline void glMultiDrawArraysIndirectCountARB(GLenum mode,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirectCountARB(mode,indirect,drawcount,maxdrawcount,stride);}
+    inline void glTextureStorageMem1DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTextureStorageMem1DEXT(texture,levels,internalFormat,width,memory,offset);}
+    inline void glWindowPos2ivMESA(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos2ivMESA(v);}
+    inline void glTexCoordP4ui(GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glTexCoordP4ui(type,coords);}
+    inline void glMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,type,pixels);}
+    inline void glProgramUniformMatrix2x3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x3fvEXT(program,location,count,transpose,value);}
+    inline void glBufferDataARB(GLenum target,GLsizeiptrARB size,const void* data,GLenum usage){ge::gl::getDefaultDirectContext().glBufferDataARB(target,size,data,usage);}
+    inline void glVertexAttribIFormat(GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexAttribIFormat(attribindex,size,type,relativeoffset);}
+    inline void glCreateFramebuffers(GLsizei n,GLuint* framebuffers){ge::gl::getDefaultDirectContext().glCreateFramebuffers(n,framebuffers);}
+    inline void glNormalStream3dvATI(GLenum stream,const GLdouble* coords){ge::gl::getDefaultDirectContext().glNormalStream3dvATI(stream,coords);}
+    inline void glClearAccum(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha){ge::gl::getDefaultDirectContext().glClearAccum(red,green,blue,alpha);}
+    inline void glUniform3i64vNV(GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glUniform3i64vNV(location,count,value);}
+    inline void glNormal3fVertex3fSUN(GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glNormal3fVertex3fSUN(nx,ny,nz,x,y,z);}
+    inline void glUniform2uivEXT(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform2uivEXT(location,count,value);}
+    inline void glBeginQuery(GLenum target,GLuint id){ge::gl::getDefaultDirectContext().glBeginQuery(target,id);}
+    inline void glStencilThenCoverStrokePathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLint reference,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glStencilThenCoverStrokePathInstancedNV(numPaths,pathNameType,paths,pathBase,reference,mask,coverMode,transformType,transformValues);}
+    inline void glBindBuffer(GLenum target,GLuint buffer){ge::gl::getDefaultDirectContext().glBindBuffer(target,buffer);}
+    inline void glMap2d(GLenum target,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points){ge::gl::getDefaultDirectContext().glMap2d(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+    inline void glMap2f(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points){ge::gl::getDefaultDirectContext().glMap2f(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+    inline void glMakeImageHandleResidentNV(GLuint64 handle,GLenum access){ge::gl::getDefaultDirectContext().glMakeImageHandleResidentNV(handle,access);}
+    inline void glUniformMatrix2x4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix2x4fv(location,count,transpose,value);}
+    inline void glGetMultiTexParameterfvEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMultiTexParameterfvEXT(texunit,target,pname,params);}
+    inline void glDepthRangeIndexed(GLuint index,GLdouble n,GLdouble f){ge::gl::getDefaultDirectContext().glDepthRangeIndexed(index,n,f);}
+    inline GLboolean glIsEnabled(GLenum cap){return ge::gl::getDefaultDirectContext().glIsEnabled(cap);}
+    inline void glMatrixScalefEXT(GLenum mode,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glMatrixScalefEXT(mode,x,y,z);}
+    inline GLenum glGetError(){return ge::gl::getDefaultDirectContext().glGetError();}
+    inline void glGetTexEnviv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexEnviv(target,pname,params);}
+    inline GLuint glBindTextureUnitParameterEXT(GLenum unit,GLenum value){return ge::gl::getDefaultDirectContext().glBindTextureUnitParameterEXT(unit,value);}
+    inline void glGetnUniformfvARB(GLuint program,GLint location,GLsizei bufSize,GLfloat* params){ge::gl::getDefaultDirectContext().glGetnUniformfvARB(program,location,bufSize,params);}
+    inline void glReplacementCodeuiNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiNormal3fVertex3fvSUN(rc,n,v);}
+    inline void glDeletePerfQueryINTEL(GLuint queryHandle){ge::gl::getDefaultDirectContext().glDeletePerfQueryINTEL(queryHandle);}
+    inline void glActiveVaryingNV(GLuint program,const GLchar* name){ge::gl::getDefaultDirectContext().glActiveVaryingNV(program,name);}
+    inline void glGetActiveUniformARB(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name){ge::gl::getDefaultDirectContext().glGetActiveUniformARB(programObj,index,maxLength,length,size,type,name);}
+    inline void glVertexAttribI3ivEXT(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI3ivEXT(index,v);}
+    inline void glEvalCoord1d(GLdouble u){ge::gl::getDefaultDirectContext().glEvalCoord1d(u);}
+    inline void glNamedCopyBufferSubDataEXT(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glNamedCopyBufferSubDataEXT(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+    inline void glEvalCoord1f(GLfloat u){ge::gl::getDefaultDirectContext().glEvalCoord1f(u);}
+    inline void glPixelMapfv(GLenum map,GLsizei mapsize,const GLfloat* values){ge::gl::getDefaultDirectContext().glPixelMapfv(map,mapsize,values);}
+    inline void glVertexAttribI1ivEXT(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI1ivEXT(index,v);}
+    inline GLsync glCreateSyncFromCLeventARB(struct _cl_context* context,struct _cl_event* event,GLbitfield flags){return ge::gl::getDefaultDirectContext().glCreateSyncFromCLeventARB(context,event,flags);}
+    inline void glGetPixelMapusv(GLenum map,GLushort* values){ge::gl::getDefaultDirectContext().glGetPixelMapusv(map,values);}
+    inline void glGetnColorTableARB(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* table){ge::gl::getDefaultDirectContext().glGetnColorTableARB(target,format,type,bufSize,table);}
+    inline void glAccum(GLenum op,GLfloat value){ge::gl::getDefaultDirectContext().glAccum(op,value);}
+    inline void glRasterPos3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glRasterPos3sv(v);}
+    inline void glTexCoord2iv(const GLint* v){ge::gl::getDefaultDirectContext().glTexCoord2iv(v);}
+    inline void glBlendFunciARB(GLuint buf,GLenum src,GLenum dst){ge::gl::getDefaultDirectContext().glBlendFunciARB(buf,src,dst);}
+    inline void glProgramUniform3i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glProgramUniform3i64vARB(program,location,count,value);}
+    inline void glGetFramebufferAttachmentParameteriv(GLenum target,GLenum attachment,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFramebufferAttachmentParameteriv(target,attachment,pname,params);}
+    inline void glProgramUniform4ui(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3){ge::gl::getDefaultDirectContext().glProgramUniform4ui(program,location,v0,v1,v2,v3);}
+    inline void glStencilMask(GLuint mask){ge::gl::getDefaultDirectContext().glStencilMask(mask);}
+    inline void glResetHistogramEXT(GLenum target){ge::gl::getDefaultDirectContext().glResetHistogramEXT(target);}
+    inline void glLightxOES(GLenum light,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glLightxOES(light,pname,param);}
+    inline void glNamedBufferData(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage){ge::gl::getDefaultDirectContext().glNamedBufferData(buffer,size,data,usage);}
+    inline void glVertexStream3sATI(GLenum stream,GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glVertexStream3sATI(stream,x,y,z);}
+    inline void glVertexAttrib3fvARB(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib3fvARB(index,v);}
+    inline void glClearNamedBufferSubData(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearNamedBufferSubData(buffer,internalformat,offset,size,format,type,data);}
+    inline void glProgramUniformHandleui64ARB(GLuint program,GLint location,GLuint64 value){ge::gl::getDefaultDirectContext().glProgramUniformHandleui64ARB(program,location,value);}
+    inline void glUniform3iARB(GLint location,GLint v0,GLint v1,GLint v2){ge::gl::getDefaultDirectContext().glUniform3iARB(location,v0,v1,v2);}
+    inline GLhandleARB glCreateProgramObjectARB(){return ge::gl::getDefaultDirectContext().glCreateProgramObjectARB();}
+    inline void glMultiTexCoord1dvARB(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1dvARB(target,v);}
+    inline void glGetObjectParameterfvARB(GLhandleARB obj,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetObjectParameterfvARB(obj,pname,params);}
+    inline void glRectsv(const GLshort* v1,const GLshort* v2){ge::gl::getDefaultDirectContext().glRectsv(v1,v2);}
+    inline void glMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,format,type,pixels);}
+    inline void glProgramUniform1i64NV(GLuint program,GLint location,GLint64EXT x){ge::gl::getDefaultDirectContext().glProgramUniform1i64NV(program,location,x);}
+    inline void glGetObjectBufferivATI(GLuint buffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetObjectBufferivATI(buffer,pname,params);}
+    inline void glUniform4i64ARB(GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w){ge::gl::getDefaultDirectContext().glUniform4i64ARB(location,x,y,z,w);}
+    inline void glReplacementCodeuiColor4ubVertex3fvSUN(const GLuint* rc,const GLubyte* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor4ubVertex3fvSUN(rc,c,v);}
+    inline void glBlendFuncSeparateINGR(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparateINGR(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+    inline void glGetVideoCaptureStreamfvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVideoCaptureStreamfvNV(video_capture_slot,stream,pname,params);}
+    inline void glVertexAttrib2fARB(GLuint index,GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glVertexAttrib2fARB(index,x,y);}
+    inline void glGetTexGeniv(GLenum coord,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexGeniv(coord,pname,params);}
+    inline void glPixelStorei(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPixelStorei(pname,param);}
+    inline void glGetCompressedTextureSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetCompressedTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,bufSize,pixels);}
+    inline void glCopyImageSubDataNV(GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glCopyImageSubDataNV(srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+    inline void glActiveShaderProgram(GLuint pipeline,GLuint program){ge::gl::getDefaultDirectContext().glActiveShaderProgram(pipeline,program);}
+    inline void glVertexStream1iATI(GLenum stream,GLint x){ge::gl::getDefaultDirectContext().glVertexStream1iATI(stream,x);}
+    inline void glPatchParameterfv(GLenum pname,const GLfloat* values){ge::gl::getDefaultDirectContext().glPatchParameterfv(pname,values);}
+    inline GLboolean glIsFramebufferEXT(GLuint framebuffer){return ge::gl::getDefaultDirectContext().glIsFramebufferEXT(framebuffer);}
+    inline void glTextureStorage2D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glTextureStorage2D(texture,levels,internalformat,width,height);}
+    inline void glProgramUniform1ui64ARB(GLuint program,GLint location,GLuint64 x){ge::gl::getDefaultDirectContext().glProgramUniform1ui64ARB(program,location,x);}
+    inline void glTexBufferRange(GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glTexBufferRange(target,internalformat,buffer,offset,size);}
+    inline void glGetPixelTexGenParameterivSGIS(GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetPixelTexGenParameterivSGIS(pname,params);}
+    inline void glTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+    inline void glClipControl(GLenum origin,GLenum depth){ge::gl::getDefaultDirectContext().glClipControl(origin,depth);}
+    inline void glGetProgramResourceiv(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramResourceiv(program,programInterface,index,propCount,props,bufSize,length,params);}
+    inline void glMultiTexCoordP2uiv(GLenum texture,GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP2uiv(texture,type,coords);}
+    inline void glVertexAttribI3ui(GLuint index,GLuint x,GLuint y,GLuint z){ge::gl::getDefaultDirectContext().glVertexAttribI3ui(index,x,y,z);}
+    inline void glSampleMaskSGIS(GLclampf value,GLboolean invert){ge::gl::getDefaultDirectContext().glSampleMaskSGIS(value,invert);}
+    inline void glVertexAttrib4NivARB(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NivARB(index,v);}
+    inline void glGlobalAlphaFactorfSUN(GLfloat factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactorfSUN(factor);}
+    inline void glBlendEquationSeparateIndexedAMD(GLuint buf,GLenum modeRGB,GLenum modeAlpha){ge::gl::getDefaultDirectContext().glBlendEquationSeparateIndexedAMD(buf,modeRGB,modeAlpha);}
+    inline void glGetPerfCounterInfoINTEL(GLuint queryId,GLuint counterId,GLuint counterNameLength,GLchar* counterName,GLuint counterDescLength,GLchar* counterDesc,GLuint* counterOffset,GLuint* counterDataSize,GLuint* counterTypeEnum,GLuint* counterDataTypeEnum,GLuint64* rawCounterMaxValue){ge::gl::getDefaultDirectContext().glGetPerfCounterInfoINTEL(queryId,counterId,counterNameLength,counterName,counterDescLength,counterDesc,counterOffset,counterDataSize,counterTypeEnum,counterDataTypeEnum,rawCounterMaxValue);}
+    inline void glDeleteProgramsNV(GLsizei n,const GLuint* programs){ge::gl::getDefaultDirectContext().glDeleteProgramsNV(n,programs);}
+    inline void glPixelZoomxOES(GLfixed xfactor,GLfixed yfactor){ge::gl::getDefaultDirectContext().glPixelZoomxOES(xfactor,yfactor);}
+    inline void glGetCombinerOutputParameterivNV(GLenum stage,GLenum portion,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetCombinerOutputParameterivNV(stage,portion,pname,params);}
+    inline void glRasterPos2xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glRasterPos2xvOES(coords);}
+    inline void glGetTexImage(GLenum target,GLint level,GLenum format,GLenum type,GLvoid* pixels){ge::gl::getDefaultDirectContext().glGetTexImage(target,level,format,type,pixels);}
+    inline void glVertexArrayVertexBuffers(GLuint vaobj,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides){ge::gl::getDefaultDirectContext().glVertexArrayVertexBuffers(vaobj,first,count,buffers,offsets,strides);}
+    inline void glUniform1ui64NV(GLint location,GLuint64EXT x){ge::gl::getDefaultDirectContext().glUniform1ui64NV(location,x);}
+    inline void glProgramParameteri(GLuint program,GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glProgramParameteri(program,pname,value);}
+    inline void glNormal3xOES(GLfixed nx,GLfixed ny,GLfixed nz){ge::gl::getDefaultDirectContext().glNormal3xOES(nx,ny,nz);}
+    inline void glGetMapfv(GLenum target,GLenum query,GLfloat* v){ge::gl::getDefaultDirectContext().glGetMapfv(target,query,v);}
+    inline void glVertexStream2dvATI(GLenum stream,const GLdouble* coords){ge::gl::getDefaultDirectContext().glVertexStream2dvATI(stream,coords);}
+    inline void glPathStencilDepthOffsetNV(GLfloat factor,GLfloat units){ge::gl::getDefaultDirectContext().glPathStencilDepthOffsetNV(factor,units);}
+    inline GLboolean glIsStateNV(GLuint state){return ge::gl::getDefaultDirectContext().glIsStateNV(state);}
+    inline void glGetIntegerui64vNV(GLenum value,GLuint64EXT* result){ge::gl::getDefaultDirectContext().glGetIntegerui64vNV(value,result);}
+    inline void glGetImageTransformParameterfvHP(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetImageTransformParameterfvHP(target,pname,params);}
+    inline void glRasterPos2fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glRasterPos2fv(v);}
+    inline void glVertex3xOES(GLfixed x,GLfixed y){ge::gl::getDefaultDirectContext().glVertex3xOES(x,y);}
+    inline GLboolean glIsMemoryObjectEXT(GLuint memoryObject){return ge::gl::getDefaultDirectContext().glIsMemoryObjectEXT(memoryObject);}
+    inline void glWeightPointerARB(GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glWeightPointerARB(size,type,stride,pointer);}
+    inline void glFinishFenceNV(GLuint fence){ge::gl::getDefaultDirectContext().glFinishFenceNV(fence);}
+    inline void glDepthRangexOES(GLfixed n,GLfixed f){ge::gl::getDefaultDirectContext().glDepthRangexOES(n,f);}
+    inline void glEnableVertexArrayAttribEXT(GLuint vaobj,GLuint index){ge::gl::getDefaultDirectContext().glEnableVertexArrayAttribEXT(vaobj,index);}
+    inline void glProgramUniform2uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform2uivEXT(program,location,count,value);}
+    inline void glGetDoubleIndexedvEXT(GLenum target,GLuint index,GLdouble* data){ge::gl::getDefaultDirectContext().glGetDoubleIndexedvEXT(target,index,data);}
+    inline void glWindowPos2fMESA(GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glWindowPos2fMESA(x,y);}
+    inline void glSecondaryColor3b(GLbyte red,GLbyte green,GLbyte blue){ge::gl::getDefaultDirectContext().glSecondaryColor3b(red,green,blue);}
+    inline void glCopyConvolutionFilter1DEXT(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyConvolutionFilter1DEXT(target,internalformat,x,y,width);}
+    inline void glWindowPos2sv(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos2sv(v);}
+    inline void glBindFramebufferEXT(GLenum target,GLuint framebuffer){ge::gl::getDefaultDirectContext().glBindFramebufferEXT(target,framebuffer);}
+    inline GLuint glCreateShader(GLenum type){return ge::gl::getDefaultDirectContext().glCreateShader(type);}
+    inline GLuint glGenPathsNV(GLsizei range){return ge::gl::getDefaultDirectContext().glGenPathsNV(range);}
+    inline void glGenRenderbuffers(GLsizei n,GLuint* renderbuffers){ge::gl::getDefaultDirectContext().glGenRenderbuffers(n,renderbuffers);}
+    inline void glCopyTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTexSubImage2D(target,level,xoffset,yoffset,x,y,width,height);}
+    inline void glVertexAttrib4ubvARB(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4ubvARB(index,v);}
+    inline void glDrawTextureNV(GLuint texture,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1){ge::gl::getDefaultDirectContext().glDrawTextureNV(texture,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+    inline void glVertexAttribs1svNV(GLuint index,GLsizei count,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribs1svNV(index,count,v);}
+    inline void glClearNamedBufferSubDataEXT(GLuint buffer,GLenum internalformat,GLsizeiptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearNamedBufferSubDataEXT(buffer,internalformat,offset,size,format,type,data);}
+    inline void glBlendFuncSeparate(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparate(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+    inline void glPointParameterfARB(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPointParameterfARB(pname,param);}
+    inline void glTexCoord2fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fv(v);}
+    inline void glGetVariantFloatvEXT(GLuint id,GLenum value,GLfloat* data){ge::gl::getDefaultDirectContext().glGetVariantFloatvEXT(id,value,data);}
+    inline void glVertexP2ui(GLenum type,GLuint value){ge::gl::getDefaultDirectContext().glVertexP2ui(type,value);}
+    inline void glWindowPos2dMESA(GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glWindowPos2dMESA(x,y);}
+    inline void glTexCoord4fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord4fv(v);}
+    inline void glBindFragDataLocationEXT(GLuint program,GLuint color,const GLchar* name){ge::gl::getDefaultDirectContext().glBindFragDataLocationEXT(program,color,name);}
+    inline void glCompressedTexSubImage1DARB(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage1DARB(target,level,xoffset,width,format,imageSize,data);}
+    inline void glGetTextureImageEXT(GLuint texture,GLenum target,GLint level,GLenum format,GLenum type,void* pixels){ge::gl::getDefaultDirectContext().glGetTextureImageEXT(texture,target,level,format,type,pixels);}
+    inline void glFogCoordd(GLdouble coord){ge::gl::getDefaultDirectContext().glFogCoordd(coord);}
+    inline void glPointSize(GLfloat size){ge::gl::getDefaultDirectContext().glPointSize(size);}
+    inline void glBindTextureUnit(GLuint unit,GLuint texture){ge::gl::getDefaultDirectContext().glBindTextureUnit(unit,texture);}
+    inline void glProgramEnvParameterI4uiNV(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w){ge::gl::getDefaultDirectContext().glProgramEnvParameterI4uiNV(target,index,x,y,z,w);}
+    inline void glGetProgramPipelineInfoLog(GLuint pipeline,GLsizei bufSize,GLsizei* length,GLchar* infoLog){ge::gl::getDefaultDirectContext().glGetProgramPipelineInfoLog(pipeline,bufSize,length,infoLog);}
+    inline void glProgramUniform4i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glProgramUniform4i64vARB(program,location,count,value);}
+    inline void glVertexAttrib4Nuiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Nuiv(index,v);}
+    inline void glGetUniformfvARB(GLhandleARB programObj,GLint location,GLfloat* params){ge::gl::getDefaultDirectContext().glGetUniformfvARB(programObj,location,params);}
+    inline void glWaitSync(GLsync sync,GLbitfield flags,GLuint64 timeout){ge::gl::getDefaultDirectContext().glWaitSync(sync,flags,timeout);}
+    inline void glUniform3i(GLint location,GLint v0,GLint v1,GLint v2){ge::gl::getDefaultDirectContext().glUniform3i(location,v0,v1,v2);}
+    inline void glBlendEquationSeparatei(GLuint buf,GLenum modeRGB,GLenum modeAlpha){ge::gl::getDefaultDirectContext().glBlendEquationSeparatei(buf,modeRGB,modeAlpha);}
+    inline void glVertexAttrib2hvNV(GLuint index,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttrib2hvNV(index,v);}
+    inline void glTextureParameterivEXT(GLuint texture,GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTextureParameterivEXT(texture,target,pname,params);}
+    inline void glUniform3d(GLint location,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glUniform3d(location,x,y,z);}
+    inline void glUniform3f(GLint location,GLfloat v0,GLfloat v1,GLfloat v2){ge::gl::getDefaultDirectContext().glUniform3f(location,v0,v1,v2);}
+    inline void glActiveProgramEXT(GLuint program){ge::gl::getDefaultDirectContext().glActiveProgramEXT(program);}
+    inline void glProgramUniform3uiv(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform3uiv(program,location,count,value);}
+    inline void glUniform3ui64vARB(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniform3ui64vARB(location,count,value);}
+    inline void glProgramUniform1ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glProgramUniform1ui64vARB(program,location,count,value);}
+    inline void glTextureParameterfEXT(GLuint texture,GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glTextureParameterfEXT(texture,target,pname,param);}
+    inline void glSetFragmentShaderConstantATI(GLuint dst,const GLfloat* value){ge::gl::getDefaultDirectContext().glSetFragmentShaderConstantATI(dst,value);}
+    inline void glColorSubTable(GLenum target,GLsizei start,GLsizei count,GLenum format,GLenum type,const GLvoid* data){ge::gl::getDefaultDirectContext().glColorSubTable(target,start,count,format,type,data);}
+    inline void glReplacementCodeuiSUN(GLuint code){ge::gl::getDefaultDirectContext().glReplacementCodeuiSUN(code);}
+    inline void glStateCaptureNV(GLuint state,GLenum mode){ge::gl::getDefaultDirectContext().glStateCaptureNV(state,mode);}
+    inline void glBindAttribLocation(GLuint program,GLuint index,const GLchar* name){ge::gl::getDefaultDirectContext().glBindAttribLocation(program,index,name);}
+    inline void glWeightusvARB(GLint size,const GLushort* weights){ge::gl::getDefaultDirectContext().glWeightusvARB(size,weights);}
+    inline GLint glGetFragDataIndex(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetFragDataIndex(program,name);}
+    inline void glMultiTexCoord2xOES(GLenum texture,GLfixed s,GLfixed t){ge::gl::getDefaultDirectContext().glMultiTexCoord2xOES(texture,s,t);}
+    inline void glColor3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glColor3sv(v);}
+    inline void glTexCoord2fVertex3fSUN(GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTexCoord2fVertex3fSUN(s,t,x,y,z);}
+    inline void glGetMemoryObjectParameterivEXT(GLuint memoryObject,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMemoryObjectParameterivEXT(memoryObject,pname,params);}
+    inline void glPolygonOffsetEXT(GLfloat factor,GLfloat bias){ge::gl::getDefaultDirectContext().glPolygonOffsetEXT(factor,bias);}
+    inline void glWeightPathsNV(GLuint resultPath,GLsizei numPaths,const GLuint* paths,const GLfloat* weights){ge::gl::getDefaultDirectContext().glWeightPathsNV(resultPath,numPaths,paths,weights);}
+    inline void glCombinerStageParameterfvNV(GLenum stage,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glCombinerStageParameterfvNV(stage,pname,params);}
+    inline void glPointParameterfEXT(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPointParameterfEXT(pname,param);}
+    inline void glCopyTexImage1DEXT(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border){ge::gl::getDefaultDirectContext().glCopyTexImage1DEXT(target,level,internalformat,x,y,width,border);}
+    inline void glVertex4sv(const GLshort* v){ge::gl::getDefaultDirectContext().glVertex4sv(v);}
+    inline void glMatrixMultfEXT(GLenum mode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixMultfEXT(mode,m);}
+    inline void glCompressedTextureSubImage3DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage3DEXT(texture,target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,bits);}
+    inline void glGetTexLevelParameterxvOES(GLenum target,GLint level,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetTexLevelParameterxvOES(target,level,pname,params);}
+    inline void glVertexAttribL3dvEXT(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL3dvEXT(index,v);}
+    inline void glMultiTexCoordP4ui(GLenum texture,GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP4ui(texture,type,coords);}
+    inline void glGetTextureLevelParameterivEXT(GLuint texture,GLenum target,GLint level,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureLevelParameterivEXT(texture,target,level,pname,params);}
+    inline void glAlphaFragmentOp2ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod){ge::gl::getDefaultDirectContext().glAlphaFragmentOp2ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+    inline void glDeleteFramebuffers(GLsizei n,const GLuint* framebuffers){ge::gl::getDefaultDirectContext().glDeleteFramebuffers(n,framebuffers);}
+    inline void glDrawArrays(GLenum mode,GLint first,GLsizei count){ge::gl::getDefaultDirectContext().glDrawArrays(mode,first,count);}
+    inline void glGetTransformFeedbackiv(GLuint xfb,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetTransformFeedbackiv(xfb,pname,param);}
+    inline void glGetnTexImageARB(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* img){ge::gl::getDefaultDirectContext().glGetnTexImageARB(target,level,format,type,bufSize,img);}
+    inline void glClear(GLbitfield mask){ge::gl::getDefaultDirectContext().glClear(mask);}
+    inline void glVertexArrayParameteriAPPLE(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glVertexArrayParameteriAPPLE(pname,param);}
+    inline void glMultiTexCoord2dvARB(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2dvARB(target,v);}
+    inline void glGetVideoCaptureStreamdvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVideoCaptureStreamdvNV(video_capture_slot,stream,pname,params);}
+    inline void glFragmentLightModelivSGIX(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glFragmentLightModelivSGIX(pname,params);}
+    inline void glVertexAttribP2ui(GLuint index,GLenum type,GLboolean normalized,GLuint value){ge::gl::getDefaultDirectContext().glVertexAttribP2ui(index,type,normalized,value);}
+    inline void glMultiTexCoordPointerEXT(GLenum texunit,GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glMultiTexCoordPointerEXT(texunit,size,type,stride,pointer);}
+    inline void glProgramUniform3iEXT(GLuint program,GLint location,GLint v0,GLint v1,GLint v2){ge::gl::getDefaultDirectContext().glProgramUniform3iEXT(program,location,v0,v1,v2);}
+    inline void glTranslatef(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTranslatef(x,y,z);}
+    inline void glVertexAttrib4Nub(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w){ge::gl::getDefaultDirectContext().glVertexAttrib4Nub(index,x,y,z,w);}
+    inline void glTranslated(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glTranslated(x,y,z);}
+    inline void glSamplerParameterIiv(GLuint sampler,GLenum pname,const GLint* param){ge::gl::getDefaultDirectContext().glSamplerParameterIiv(sampler,pname,param);}
+    inline void glTexCoord4hNV(GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q){ge::gl::getDefaultDirectContext().glTexCoord4hNV(s,t,r,q);}
+    inline void glDrawElementsIndirect(GLenum mode,GLenum type,const void* indirect){ge::gl::getDefaultDirectContext().glDrawElementsIndirect(mode,type,indirect);}
+    inline void glDeletePerfMonitorsAMD(GLsizei n,GLuint* monitors){ge::gl::getDefaultDirectContext().glDeletePerfMonitorsAMD(n,monitors);}
+    inline GLboolean glIsRenderbufferEXT(GLuint renderbuffer){return ge::gl::getDefaultDirectContext().glIsRenderbufferEXT(renderbuffer);}
+    inline void glDrawCommandsNV(GLenum primitiveMode,GLuint buffer,const GLintptr* indirects,const GLsizei* sizes,GLuint count){ge::gl::getDefaultDirectContext().glDrawCommandsNV(primitiveMode,buffer,indirects,sizes,count);}
+    inline void glUniform3ivARB(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform3ivARB(location,count,value);}
+    inline void glBufferSubData(GLenum target,GLintptr offset,GLsizeiptr size,const void* data){ge::gl::getDefaultDirectContext().glBufferSubData(target,offset,size,data);}
+    inline void glSecondaryColor3bv(const GLbyte* v){ge::gl::getDefaultDirectContext().glSecondaryColor3bv(v);}
+    inline void glMatrixMultTransposedEXT(GLenum mode,const GLdouble* m){ge::gl::getDefaultDirectContext().glMatrixMultTransposedEXT(mode,m);}
+    inline void glRequestResidentProgramsNV(GLsizei n,const GLuint* programs){ge::gl::getDefaultDirectContext().glRequestResidentProgramsNV(n,programs);}
+    inline void glAlphaFragmentOp1ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod){ge::gl::getDefaultDirectContext().glAlphaFragmentOp1ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod);}
+    inline void glGetQueryObjecti64v(GLuint id,GLenum pname,GLint64* params){ge::gl::getDefaultDirectContext().glGetQueryObjecti64v(id,pname,params);}
+    inline void glMatrixMult3x3fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixMult3x3fNV(matrixMode,m);}
+    inline void glColorTableParameteriv(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glColorTableParameteriv(target,pname,params);}
+    inline void glPathSubCommandsNV(GLuint path,GLsizei commandStart,GLsizei commandsToDelete,GLsizei numCommands,const GLubyte* commands,GLsizei numCoords,GLenum coordType,const void* coords){ge::gl::getDefaultDirectContext().glPathSubCommandsNV(path,commandStart,commandsToDelete,numCommands,commands,numCoords,coordType,coords);}
+    inline void glGetFinalCombinerInputParameterivNV(GLenum variable,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFinalCombinerInputParameterivNV(variable,pname,params);}
+    inline GLboolean glIsRenderbuffer(GLuint renderbuffer){return ge::gl::getDefaultDirectContext().glIsRenderbuffer(renderbuffer);}
+    inline void glVertex3iv(const GLint* v){ge::gl::getDefaultDirectContext().glVertex3iv(v);}
+    inline void glTexGenfv(GLenum coord,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glTexGenfv(coord,pname,params);}
+    inline void glFrustumfOES(GLfloat l,GLfloat r,GLfloat b,GLfloat t,GLfloat n,GLfloat f){ge::gl::getDefaultDirectContext().glFrustumfOES(l,r,b,t,n,f);}
+    inline void glBindVertexBuffers(GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizei* strides){ge::gl::getDefaultDirectContext().glBindVertexBuffers(first,count,buffers,offsets,strides);}
+    inline void glMateriali(GLenum face,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glMateriali(face,pname,param);}
+    inline void glMultiTexCoord2svARB(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2svARB(target,v);}
+    inline void glDisableVertexAttribArray(GLuint index){ge::gl::getDefaultDirectContext().glDisableVertexAttribArray(index);}
+    inline void glWindowPos3ivARB(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos3ivARB(v);}
+    inline void glTexCoordFormatNV(GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glTexCoordFormatNV(size,type,stride);}
+    inline void glBlitNamedFramebuffer(GLuint readFramebuffer,GLuint drawFramebuffer,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter){ge::gl::getDefaultDirectContext().glBlitNamedFramebuffer(readFramebuffer,drawFramebuffer,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+    inline void glMatrixLoadTransposefEXT(GLenum mode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixLoadTransposefEXT(mode,m);}
+    inline void glMultiTexGenfEXT(GLenum texunit,GLenum coord,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glMultiTexGenfEXT(texunit,coord,pname,param);}
+    inline void glShaderStorageBlockBinding(GLuint program,GLuint storageBlockIndex,GLuint storageBlockBinding){ge::gl::getDefaultDirectContext().glShaderStorageBlockBinding(program,storageBlockIndex,storageBlockBinding);}
+    inline void glMaterialf(GLenum face,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glMaterialf(face,pname,param);}
+    inline void glReplacementCodeuiColor4fNormal3fVertex3fSUN(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc,r,g,b,a,nx,ny,nz,x,y,z);}
+    inline GLenum glCheckNamedFramebufferStatusEXT(GLuint framebuffer,GLenum target){return ge::gl::getDefaultDirectContext().glCheckNamedFramebufferStatusEXT(framebuffer,target);}
+    inline void glVertexArrayVertexAttribFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribFormatEXT(vaobj,attribindex,size,type,normalized,relativeoffset);}
+    inline void glVertex2hNV(GLhalfNV x,GLhalfNV y){ge::gl::getDefaultDirectContext().glVertex2hNV(x,y);}
+    inline void glDeleteVertexShaderEXT(GLuint id){ge::gl::getDefaultDirectContext().glDeleteVertexShaderEXT(id);}
+    inline void glTexImage3DEXT(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexImage3DEXT(target,level,internalformat,width,height,depth,border,format,type,pixels);}
+    inline void glSignalVkFenceNV(GLuint64 vkFence){ge::gl::getDefaultDirectContext().glSignalVkFenceNV(vkFence);}
+    inline void glProgramLocalParameterI4ivNV(GLenum target,GLuint index,const GLint* params){ge::gl::getDefaultDirectContext().glProgramLocalParameterI4ivNV(target,index,params);}
+    inline void glGlobalAlphaFactoriSUN(GLint factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactoriSUN(factor);}
+    inline void glTextureStorage1D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width){ge::gl::getDefaultDirectContext().glTextureStorage1D(texture,levels,internalformat,width);}
+    inline void glBinormal3sEXT(GLshort bx,GLshort by,GLshort bz){ge::gl::getDefaultDirectContext().glBinormal3sEXT(bx,by,bz);}
+    inline void glGetProgramInterfaceiv(GLuint program,GLenum programInterface,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramInterfaceiv(program,programInterface,pname,params);}
+    inline void glMatrixIndexPointerARB(GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glMatrixIndexPointerARB(size,type,stride,pointer);}
+    inline void glTexCoordPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer){ge::gl::getDefaultDirectContext().glTexCoordPointerEXT(size,type,stride,count,pointer);}
+    inline void glMultiTexGeniEXT(GLenum texunit,GLenum coord,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glMultiTexGeniEXT(texunit,coord,pname,param);}
+    inline void glVertexAttrib2fNV(GLuint index,GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glVertexAttrib2fNV(index,x,y);}
+    inline void glNamedProgramStringEXT(GLuint program,GLenum target,GLenum format,GLsizei len,const void* string){ge::gl::getDefaultDirectContext().glNamedProgramStringEXT(program,target,format,len,string);}
+    inline void* glMapNamedBuffer(GLuint buffer,GLenum access){return ge::gl::getDefaultDirectContext().glMapNamedBuffer(buffer,access);}
+    inline void glGetMinmaxParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMinmaxParameteriv(target,pname,params);}
+    inline void glGetnUniformdv(GLuint program,GLint location,GLsizei bufSize,GLdouble* params){ge::gl::getDefaultDirectContext().glGetnUniformdv(program,location,bufSize,params);}
+    inline void glEndConditionalRenderNVX(){ge::gl::getDefaultDirectContext().glEndConditionalRenderNVX();}
+    inline void glBinormal3fEXT(GLfloat bx,GLfloat by,GLfloat bz){ge::gl::getDefaultDirectContext().glBinormal3fEXT(bx,by,bz);}
+    inline void glNormalStream3iATI(GLenum stream,GLint nx,GLint ny,GLint nz){ge::gl::getDefaultDirectContext().glNormalStream3iATI(stream,nx,ny,nz);}
+    inline void glProgramBufferParametersIivNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLint* params){ge::gl::getDefaultDirectContext().glProgramBufferParametersIivNV(target,bindingIndex,wordIndex,count,params);}
+    inline void glMapGrid1xOES(GLint n,GLfixed u1,GLfixed u2){ge::gl::getDefaultDirectContext().glMapGrid1xOES(n,u1,u2);}
+    inline void glGetVertexAttribPointervARB(GLuint index,GLenum pname,void** pointer){ge::gl::getDefaultDirectContext().glGetVertexAttribPointervARB(index,pname,pointer);}
+    inline void glFlushMappedNamedBufferRangeEXT(GLuint buffer,GLintptr offset,GLsizeiptr length){ge::gl::getDefaultDirectContext().glFlushMappedNamedBufferRangeEXT(buffer,offset,length);}
+    inline void glGetVertexAttribIiv(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribIiv(index,pname,params);}
+    inline void glVertexP4uiv(GLenum type,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexP4uiv(type,value);}
+    inline void glUniformui64NV(GLint location,GLuint64EXT value){ge::gl::getDefaultDirectContext().glUniformui64NV(location,value);}
+    inline void glColor4fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glColor4fv(v);}
+    inline void glTexParameterxvOES(GLenum target,GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glTexParameterxvOES(target,pname,params);}
+    inline void glPatchParameteri(GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glPatchParameteri(pname,value);}
+    inline void glMap1d(GLenum target,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points){ge::gl::getDefaultDirectContext().glMap1d(target,u1,u2,stride,order,points);}
+    inline void glGetTexFilterFuncSGIS(GLenum target,GLenum filter,GLfloat* weights){ge::gl::getDefaultDirectContext().glGetTexFilterFuncSGIS(target,filter,weights);}
+    inline void glVertexStream3dATI(GLenum stream,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexStream3dATI(stream,x,y,z);}
+    inline void glVertexArrayVertexBindingDivisorEXT(GLuint vaobj,GLuint bindingindex,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexArrayVertexBindingDivisorEXT(vaobj,bindingindex,divisor);}
+    inline void glMultiTexCoord3svARB(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3svARB(target,v);}
+    inline void glBindProgramNV(GLenum target,GLuint id){ge::gl::getDefaultDirectContext().glBindProgramNV(target,id);}
+    inline void glGetConvolutionParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetConvolutionParameteriv(target,pname,params);}
+    inline void glGetProgramLocalParameterfvARB(GLenum target,GLuint index,GLfloat* params){ge::gl::getDefaultDirectContext().glGetProgramLocalParameterfvARB(target,index,params);}
+    inline GLuint glGenFragmentShadersATI(GLuint range){return ge::gl::getDefaultDirectContext().glGenFragmentShadersATI(range);}
+    inline void glTexBumpParameterivATI(GLenum pname,const GLint* param){ge::gl::getDefaultDirectContext().glTexBumpParameterivATI(pname,param);}
+    inline void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedFramebufferAttachmentParameteriv(framebuffer,attachment,pname,params);}
+    inline void glGetnSeparableFilter(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span){ge::gl::getDefaultDirectContext().glGetnSeparableFilter(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+    inline void glNormal3xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glNormal3xvOES(coords);}
+    inline void glPassTexCoordATI(GLuint dst,GLuint coord,GLenum swizzle){ge::gl::getDefaultDirectContext().glPassTexCoordATI(dst,coord,swizzle);}
+    inline void glFramebufferTextureFaceARB(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face){ge::gl::getDefaultDirectContext().glFramebufferTextureFaceARB(target,attachment,texture,level,face);}
+    inline void glProgramUniform1dv(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform1dv(program,location,count,value);}
+    inline void glTextureStorage2DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glTextureStorage2DEXT(texture,target,levels,internalformat,width,height);}
+    inline void glVertexArrayFogCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayFogCoordOffsetEXT(vaobj,buffer,type,stride,offset);}
+    inline void glDeleteNamedStringARB(GLint namelen,const GLchar* name){ge::gl::getDefaultDirectContext().glDeleteNamedStringARB(namelen,name);}
+    inline void glMulticastGetQueryObjecti64vNV(GLuint gpu,GLuint id,GLenum pname,GLint64* params){ge::gl::getDefaultDirectContext().glMulticastGetQueryObjecti64vNV(gpu,id,pname,params);}
+    inline void glGenOcclusionQueriesNV(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glGenOcclusionQueriesNV(n,ids);}
+    inline void glLighti(GLenum light,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glLighti(light,pname,param);}
+    inline void glTexImage1D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLint border,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexImage1D(target,level,internalFormat,width,border,format,type,pixels);}
+    inline void glLightf(GLenum light,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glLightf(light,pname,param);}
+    inline void glClientAttribDefaultEXT(GLbitfield mask){ge::gl::getDefaultDirectContext().glClientAttribDefaultEXT(mask);}
+    inline void glVertexAttrib4bvARB(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4bvARB(index,v);}
+    inline void glVertexAttribIFormatNV(GLuint index,GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexAttribIFormatNV(index,size,type,stride);}
+    inline void glStencilFuncSeparate(GLenum face,GLenum func,GLint ref,GLuint mask){ge::gl::getDefaultDirectContext().glStencilFuncSeparate(face,func,ref,mask);}
+    inline void glGetVertexAttribfvARB(GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVertexAttribfvARB(index,pname,params);}
+    inline void glVertexAttrib2dNV(GLuint index,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexAttrib2dNV(index,x,y);}
+    inline void glProgramUniform2iEXT(GLuint program,GLint location,GLint v0,GLint v1){ge::gl::getDefaultDirectContext().glProgramUniform2iEXT(program,location,v0,v1);}
+    inline void glClientActiveVertexStreamATI(GLenum stream){ge::gl::getDefaultDirectContext().glClientActiveVertexStreamATI(stream);}
+    inline void glRasterPos3xOES(GLfixed x,GLfixed y,GLfixed z){ge::gl::getDefaultDirectContext().glRasterPos3xOES(x,y,z);}
+    inline void glGetMapParameterivNV(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMapParameterivNV(target,pname,params);}
+    inline void glSampleCoverage(GLclampf value,GLboolean invert){ge::gl::getDefaultDirectContext().glSampleCoverage(value,invert);}
+    inline void glClearDepthxOES(GLfixed depth){ge::gl::getDefaultDirectContext().glClearDepthxOES(depth);}
+    inline void glUniformBufferEXT(GLuint program,GLint location,GLuint buffer){ge::gl::getDefaultDirectContext().glUniformBufferEXT(program,location,buffer);}
+    inline void glTexCoord2fNormal3fVertex3fvSUN(const GLfloat* tc,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fNormal3fVertex3fvSUN(tc,n,v);}
+    inline void glMulticastGetQueryObjectuivNV(GLuint gpu,GLuint id,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glMulticastGetQueryObjectuivNV(gpu,id,pname,params);}
+    inline void glGetFirstPerfQueryIdINTEL(GLuint* queryId){ge::gl::getDefaultDirectContext().glGetFirstPerfQueryIdINTEL(queryId);}
+    inline GLboolean glUnmapNamedBufferEXT(GLuint buffer){return ge::gl::getDefaultDirectContext().glUnmapNamedBufferEXT(buffer);}
+    inline void glGetTransformFeedbacki_v(GLuint xfb,GLenum pname,GLuint index,GLint* param){ge::gl::getDefaultDirectContext().glGetTransformFeedbacki_v(xfb,pname,index,param);}
+    inline void glUniform4fvARB(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform4fvARB(location,count,value);}
+    inline void glRenderbufferStorageMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glRenderbufferStorageMultisampleCoverageNV(target,coverageSamples,colorSamples,internalformat,width,height);}
+    inline void glGetFloati_vEXT(GLenum pname,GLuint index,GLfloat* params){ge::gl::getDefaultDirectContext().glGetFloati_vEXT(pname,index,params);}
+    inline void glBindAttribLocationARB(GLhandleARB programObj,GLuint index,const GLcharARB* name){ge::gl::getDefaultDirectContext().glBindAttribLocationARB(programObj,index,name);}
+    inline void glBufferAddressRangeNV(GLenum pname,GLuint index,GLuint64EXT address,GLsizeiptr length){ge::gl::getDefaultDirectContext().glBufferAddressRangeNV(pname,index,address,length);}
+    inline void glGenProgramsARB(GLsizei n,GLuint* programs){ge::gl::getDefaultDirectContext().glGenProgramsARB(n,programs);}
+    inline void glMultiTexEnvivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMultiTexEnvivEXT(texunit,target,pname,params);}
+    inline void glSecondaryColor3uiEXT(GLuint red,GLuint green,GLuint blue){ge::gl::getDefaultDirectContext().glSecondaryColor3uiEXT(red,green,blue);}
+    inline void glCompressedTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureImage2DEXT(texture,target,level,internalformat,width,height,border,imageSize,bits);}
+    inline void glUniform2i(GLint location,GLint v0,GLint v1){ge::gl::getDefaultDirectContext().glUniform2i(location,v0,v1);}
+    inline void glCopyTexImage2DEXT(GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border){ge::gl::getDefaultDirectContext().glCopyTexImage2DEXT(target,level,internalformat,x,y,width,height,border);}
+    inline void glUniform2d(GLint location,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glUniform2d(location,x,y);}
+    inline void glVertexAttribL1d(GLuint index,GLdouble x){ge::gl::getDefaultDirectContext().glVertexAttribL1d(index,x);}
+    inline void glFramebufferTextureFaceEXT(GLenum target,GLenum attachment,GLuint texture,GLint level,GLenum face){ge::gl::getDefaultDirectContext().glFramebufferTextureFaceEXT(target,attachment,texture,level,face);}
+    inline void glFramebufferTextureLayer(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer){ge::gl::getDefaultDirectContext().glFramebufferTextureLayer(target,attachment,texture,level,layer);}
+    inline void glMultiTexCoord4bvOES(GLenum texture,const GLbyte* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord4bvOES(texture,coords);}
+    inline void glGetVertexArrayPointeri_vEXT(GLuint vaobj,GLuint index,GLenum pname,void** param){ge::gl::getDefaultDirectContext().glGetVertexArrayPointeri_vEXT(vaobj,index,pname,param);}
+    inline void glNamedProgramLocalParameter4dEXT(GLuint program,GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameter4dEXT(program,target,index,x,y,z,w);}
+    inline void glBinormal3bEXT(GLbyte bx,GLbyte by,GLbyte bz){ge::gl::getDefaultDirectContext().glBinormal3bEXT(bx,by,bz);}
+    inline void glConvolutionFilter2DEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* image){ge::gl::getDefaultDirectContext().glConvolutionFilter2DEXT(target,internalformat,width,height,format,type,image);}
+    inline void glProgramUniform2fv(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform2fv(program,location,count,value);}
+    inline void glColor3fVertex3fSUN(GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glColor3fVertex3fSUN(r,g,b,x,y,z);}
+    inline void glNormal3fVertex3fvSUN(const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glNormal3fVertex3fvSUN(n,v);}
+    inline void glCopyMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+    inline void glProgramLocalParameterI4iNV(GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glProgramLocalParameterI4iNV(target,index,x,y,z,w);}
+    inline void glProgramUniformMatrix2x4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x4dv(program,location,count,transpose,value);}
+    inline GLenum glPathMemoryGlyphIndexArrayNV(GLuint firstPathName,GLenum fontTarget,GLsizeiptr fontSize,const void* fontData,GLsizei faceIndex,GLuint firstGlyphIndex,GLsizei numGlyphs,GLuint pathParameterTemplate,GLfloat emScale){return ge::gl::getDefaultDirectContext().glPathMemoryGlyphIndexArrayNV(firstPathName,fontTarget,fontSize,fontData,faceIndex,firstGlyphIndex,numGlyphs,pathParameterTemplate,emScale);}
+    inline void glDrawArraysEXT(GLenum mode,GLint first,GLsizei count){ge::gl::getDefaultDirectContext().glDrawArraysEXT(mode,first,count);}
+    inline void glBlendEquationEXT(GLenum mode){ge::gl::getDefaultDirectContext().glBlendEquationEXT(mode);}
+    inline void glStencilOp(GLenum fail,GLenum zfail,GLenum zpass){ge::gl::getDefaultDirectContext().glStencilOp(fail,zfail,zpass);}
+    inline void glCopyTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,x,y,width,height);}
+    inline void glTexEnvf(GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glTexEnvf(target,pname,param);}
+    inline void glVertexAttrib2dvNV(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib2dvNV(index,v);}
+    inline void glGenPerfMonitorsAMD(GLsizei n,GLuint* monitors){ge::gl::getDefaultDirectContext().glGenPerfMonitorsAMD(n,monitors);}
+    inline void glGetInteger64i_v(GLenum target,GLuint index,GLint64* data){ge::gl::getDefaultDirectContext().glGetInteger64i_v(target,index,data);}
+    inline void glGetHistogramParameterfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetHistogramParameterfv(target,pname,params);}
+    inline void glVertexFormatNV(GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexFormatNV(size,type,stride);}
+    inline void glBlendFuncIndexedAMD(GLuint buf,GLenum src,GLenum dst){ge::gl::getDefaultDirectContext().glBlendFuncIndexedAMD(buf,src,dst);}
+    inline void glTexEnvi(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glTexEnvi(target,pname,param);}
+    inline void glMultiTexCoord1iv(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1iv(target,v);}
+    inline GLboolean glIsEnabledi(GLenum target,GLuint index){return ge::gl::getDefaultDirectContext().glIsEnabledi(target,index);}
+    inline void glVertexAttribL2ui64vNV(GLuint index,const GLuint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL2ui64vNV(index,v);}
+    inline void glVertexAttribL4i64NV(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w){ge::gl::getDefaultDirectContext().glVertexAttribL4i64NV(index,x,y,z,w);}
+    inline void glMatrixTranslatedEXT(GLenum mode,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glMatrixTranslatedEXT(mode,x,y,z);}
+    inline void glMakeTextureHandleResidentARB(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeTextureHandleResidentARB(handle);}
+    inline void glMatrixMultdEXT(GLenum mode,const GLdouble* m){ge::gl::getDefaultDirectContext().glMatrixMultdEXT(mode,m);}
+    inline void glBinormal3dvEXT(const GLdouble* v){ge::gl::getDefaultDirectContext().glBinormal3dvEXT(v);}
+    inline GLsync glImportSyncEXT(GLenum external_sync_type,GLintptr external_sync,GLbitfield flags){return ge::gl::getDefaultDirectContext().glImportSyncEXT(external_sync_type,external_sync,flags);}
+    inline void glGetMapiv(GLenum target,GLenum query,GLint* v){ge::gl::getDefaultDirectContext().glGetMapiv(target,query,v);}
+    inline void glImportSemaphoreFdEXT(GLuint semaphore,GLenum handleType,GLint fd){ge::gl::getDefaultDirectContext().glImportSemaphoreFdEXT(semaphore,handleType,fd);}
+    inline void glMultiTexCoord4sv(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4sv(target,v);}
+    inline void glPNTrianglesiATI(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPNTrianglesiATI(pname,param);}
+    inline void glBindVertexArrayAPPLE(GLuint array){ge::gl::getDefaultDirectContext().glBindVertexArrayAPPLE(array);}
+    inline void glObjectPtrLabel(const void* ptr,GLsizei length,const GLchar* label){ge::gl::getDefaultDirectContext().glObjectPtrLabel(ptr,length,label);}
+    inline GLuint glGetDebugMessageLog(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog){return ge::gl::getDefaultDirectContext().glGetDebugMessageLog(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+    inline void glTrackMatrixNV(GLenum target,GLuint address,GLenum matrix,GLenum transform){ge::gl::getDefaultDirectContext().glTrackMatrixNV(target,address,matrix,transform);}
+    inline void glProgramPathFragmentInputGenNV(GLuint program,GLint location,GLenum genMode,GLint components,const GLfloat* coeffs){ge::gl::getDefaultDirectContext().glProgramPathFragmentInputGenNV(program,location,genMode,components,coeffs);}
+    inline void glTangent3ivEXT(const GLint* v){ge::gl::getDefaultDirectContext().glTangent3ivEXT(v);}
+    inline void glGetUniformfv(GLuint program,GLint location,GLfloat* params){ge::gl::getDefaultDirectContext().glGetUniformfv(program,location,params);}
+    inline void glSecondaryColor3ubv(const GLubyte* v){ge::gl::getDefaultDirectContext().glSecondaryColor3ubv(v);}
+    inline void glMakeTextureHandleNonResidentNV(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeTextureHandleNonResidentNV(handle);}
+    inline void glVertexAttribs4ubvNV(GLuint index,GLsizei count,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttribs4ubvNV(index,count,v);}
+    inline void glClipPlanexOES(GLenum plane,const GLfixed* equation){ge::gl::getDefaultDirectContext().glClipPlanexOES(plane,equation);}
+    inline void glMultiTexCoord3iv(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3iv(target,v);}
+    inline void glGetnPolygonStippleARB(GLsizei bufSize,GLubyte* pattern){ge::gl::getDefaultDirectContext().glGetnPolygonStippleARB(bufSize,pattern);}
+    inline void glUniform2i64vNV(GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glUniform2i64vNV(location,count,value);}
+    inline void glLightModelf(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glLightModelf(pname,param);}
+    inline void glDeleteMemoryObjectsEXT(GLsizei n,const GLuint* memoryObjects){ge::gl::getDefaultDirectContext().glDeleteMemoryObjectsEXT(n,memoryObjects);}
+    inline void glMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,type,pixels);}
+    inline void glReplacementCodeuiColor3fVertex3fSUN(GLuint rc,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor3fVertex3fSUN(rc,r,g,b,x,y,z);}
+    inline void glTangent3dvEXT(const GLdouble* v){ge::gl::getDefaultDirectContext().glTangent3dvEXT(v);}
+    inline void glLightModeli(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glLightModeli(pname,param);}
+    inline void glVertexWeighthvNV(const GLhalfNV* weight){ge::gl::getDefaultDirectContext().glVertexWeighthvNV(weight);}
+    inline void glWindowPos3iv(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos3iv(v);}
+    inline void glMultiTexCoordP1uiv(GLenum texture,GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP1uiv(texture,type,coords);}
+    inline void glTransformPathNV(GLuint resultPath,GLuint srcPath,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glTransformPathNV(resultPath,srcPath,transformType,transformValues);}
+    inline void glProgramNamedParameter4dNV(GLuint id,GLsizei len,const GLubyte* name,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glProgramNamedParameter4dNV(id,len,name,x,y,z,w);}
+    inline void glMultiDrawElementsIndirect(GLenum mode,GLenum type,const void* indirect,GLsizei drawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirect(mode,type,indirect,drawcount,stride);}
+    inline void glProgramUniform1dEXT(GLuint program,GLint location,GLdouble x){ge::gl::getDefaultDirectContext().glProgramUniform1dEXT(program,location,x);}
+    inline void glCallLists(GLsizei n,GLenum type,const GLvoid* lists){ge::gl::getDefaultDirectContext().glCallLists(n,type,lists);}
+    inline void glNormal3hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glNormal3hvNV(v);}
+    inline void glGetCombinerOutputParameterfvNV(GLenum stage,GLenum portion,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetCombinerOutputParameterfvNV(stage,portion,pname,params);}
+    inline void glVertexAttrib4sARB(GLuint index,GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glVertexAttrib4sARB(index,x,y,z,w);}
+    inline void glTexCoord3i(GLint s,GLint t,GLint r){ge::gl::getDefaultDirectContext().glTexCoord3i(s,t,r);}
+    inline void glVertexAttribI3uiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI3uiv(index,v);}
+    inline void glPushDebugGroup(GLenum source,GLuint id,GLsizei length,const GLchar* message){ge::gl::getDefaultDirectContext().glPushDebugGroup(source,id,length,message);}
+    inline void glTexCoord3f(GLfloat s,GLfloat t,GLfloat r){ge::gl::getDefaultDirectContext().glTexCoord3f(s,t,r);}
+    inline void glTexCoord3d(GLdouble s,GLdouble t,GLdouble r){ge::gl::getDefaultDirectContext().glTexCoord3d(s,t,r);}
+    inline void glTexCoord2xOES(GLfixed s,GLfixed t){ge::gl::getDefaultDirectContext().glTexCoord2xOES(s,t);}
+    inline GLushort glGetStageIndexNV(GLenum shadertype){return ge::gl::getDefaultDirectContext().glGetStageIndexNV(shadertype);}
+    inline void glProgramUniform4i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform4i64vNV(program,location,count,value);}
+    inline void glGetNamedBufferPointervEXT(GLuint buffer,GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetNamedBufferPointervEXT(buffer,pname,params);}
+    inline void glTextureBarrierNV(){ge::gl::getDefaultDirectContext().glTextureBarrierNV();}
+    inline void glColor4ubVertex3fvSUN(const GLubyte* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glColor4ubVertex3fvSUN(c,v);}
+    inline GLuint glGetCommandHeaderNV(GLenum tokenID,GLuint size){return ge::gl::getDefaultDirectContext().glGetCommandHeaderNV(tokenID,size);}
+    inline void glGetPerfMonitorCounterInfoAMD(GLuint group,GLuint counter,GLenum pname,void* data){ge::gl::getDefaultDirectContext().glGetPerfMonitorCounterInfoAMD(group,counter,pname,data);}
+    inline void glVertexAttrib1svARB(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib1svARB(index,v);}
+    inline void glCombinerParameteriNV(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glCombinerParameteriNV(pname,param);}
+    inline void glMatrixMultTransposefEXT(GLenum mode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixMultTransposefEXT(mode,m);}
+    inline void glDetailTexFuncSGIS(GLenum target,GLsizei n,const GLfloat* points){ge::gl::getDefaultDirectContext().glDetailTexFuncSGIS(target,n,points);}
+    inline GLboolean glAreTexturesResident(GLsizei n,const GLuint* textures,GLboolean* residences){return ge::gl::getDefaultDirectContext().glAreTexturesResident(n,textures,residences);}
+    inline void glProgramUniform2d(GLuint program,GLint location,GLdouble v0,GLdouble v1){ge::gl::getDefaultDirectContext().glProgramUniform2d(program,location,v0,v1);}
+    inline void glGetConvolutionParameterfvEXT(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetConvolutionParameterfvEXT(target,pname,params);}
+    inline void glIndexPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glIndexPointerListIBM(type,stride,pointer,ptrstride);}
+    inline void glVertexAttribI4iEXT(GLuint index,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glVertexAttribI4iEXT(index,x,y,z,w);}
+    inline void glProgramUniform2f(GLuint program,GLint location,GLfloat v0,GLfloat v1){ge::gl::getDefaultDirectContext().glProgramUniform2f(program,location,v0,v1);}
+    inline void glRasterPos4sv(const GLshort* v){ge::gl::getDefaultDirectContext().glRasterPos4sv(v);}
+    inline void glColor4s(GLshort red,GLshort green,GLshort blue,GLshort alpha){ge::gl::getDefaultDirectContext().glColor4s(red,green,blue,alpha);}
+    inline void glMulticastGetQueryObjectivNV(GLuint gpu,GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glMulticastGetQueryObjectivNV(gpu,id,pname,params);}
+    inline void glColorFragmentOp3ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod){ge::gl::getDefaultDirectContext().glColorFragmentOp3ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+    inline void glResizeBuffersMESA(){ge::gl::getDefaultDirectContext().glResizeBuffersMESA();}
+    inline void glGetMinmaxParameterfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMinmaxParameterfv(target,pname,params);}
+    inline void glClientActiveTextureARB(GLenum texture){ge::gl::getDefaultDirectContext().glClientActiveTextureARB(texture);}
+    inline void glBindVertexArray(GLuint array){ge::gl::getDefaultDirectContext().glBindVertexArray(array);}
+    inline void glColor4b(GLbyte red,GLbyte green,GLbyte blue,GLbyte alpha){ge::gl::getDefaultDirectContext().glColor4b(red,green,blue,alpha);}
+    inline void glColor4f(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha){ge::gl::getDefaultDirectContext().glColor4f(red,green,blue,alpha);}
+    inline void glColor4d(GLdouble red,GLdouble green,GLdouble blue,GLdouble alpha){ge::gl::getDefaultDirectContext().glColor4d(red,green,blue,alpha);}
+    inline void glColor4i(GLint red,GLint green,GLint blue,GLint alpha){ge::gl::getDefaultDirectContext().glColor4i(red,green,blue,alpha);}
+    inline void glEdgeFlagFormatNV(GLsizei stride){ge::gl::getDefaultDirectContext().glEdgeFlagFormatNV(stride);}
+    inline void glNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data){ge::gl::getDefaultDirectContext().glNamedBufferSubData(buffer,offset,size,data);}
+    inline void glDrawElementsInstanced(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount){ge::gl::getDefaultDirectContext().glDrawElementsInstanced(mode,count,type,indices,instancecount);}
+    inline void glGetMultiTexParameterIivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMultiTexParameterIivEXT(texunit,target,pname,params);}
+    inline void glVertex2dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glVertex2dv(v);}
+    inline void glDisableVertexArrayAttribEXT(GLuint vaobj,GLuint index){ge::gl::getDefaultDirectContext().glDisableVertexArrayAttribEXT(vaobj,index);}
+    inline GLenum glObjectUnpurgeableAPPLE(GLenum objectType,GLuint name,GLenum option){return ge::gl::getDefaultDirectContext().glObjectUnpurgeableAPPLE(objectType,name,option);}
+    inline void glVertexAttribs2dvNV(GLuint index,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribs2dvNV(index,count,v);}
+    inline void glReplacementCodeuiTexCoord2fVertex3fSUN(GLuint rc,GLfloat s,GLfloat t,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fVertex3fSUN(rc,s,t,x,y,z);}
+    inline void glGetMapParameterfvNV(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMapParameterfvNV(target,pname,params);}
+    inline void glProgramUniform4ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform4ivEXT(program,location,count,value);}
+    inline void glProgramUniform3ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform3ui64vNV(program,location,count,value);}
+    inline void glRectfv(const GLfloat* v1,const GLfloat* v2){ge::gl::getDefaultDirectContext().glRectfv(v1,v2);}
+    inline void glTexFilterFuncSGIS(GLenum target,GLenum filter,GLsizei n,const GLfloat* weights){ge::gl::getDefaultDirectContext().glTexFilterFuncSGIS(target,filter,n,weights);}
+    inline void glSpriteParameterfvSGIX(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glSpriteParameterfvSGIX(pname,params);}
+    inline void glCopyMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border){ge::gl::getDefaultDirectContext().glCopyMultiTexImage1DEXT(texunit,target,level,internalformat,x,y,width,border);}
+    inline void glGetVertexAttribIuivEXT(GLuint index,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribIuivEXT(index,pname,params);}
+    inline void glUniformMatrix2x4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix2x4dv(location,count,transpose,value);}
+    inline GLint glGetProgramResourceLocationIndex(GLuint program,GLenum programInterface,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetProgramResourceLocationIndex(program,programInterface,name);}
+    inline void glColor3hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue){ge::gl::getDefaultDirectContext().glColor3hNV(red,green,blue);}
+    inline void glViewport(GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glViewport(x,y,width,height);}
+    inline void glProgramNamedParameter4fNV(GLuint id,GLsizei len,const GLubyte* name,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glProgramNamedParameter4fNV(id,len,name,x,y,z,w);}
+    inline void glGetInvariantBooleanvEXT(GLuint id,GLenum value,GLboolean* data){ge::gl::getDefaultDirectContext().glGetInvariantBooleanvEXT(id,value,data);}
+    inline void glTexStorage2DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTexStorage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+    inline void glPixelStorex(GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glPixelStorex(pname,param);}
+    inline void glVertexAttribL1dvEXT(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL1dvEXT(index,v);}
+    inline void glGetActiveSubroutineUniformiv(GLuint program,GLenum shadertype,GLuint index,GLenum pname,GLint* values){ge::gl::getDefaultDirectContext().glGetActiveSubroutineUniformiv(program,shadertype,index,pname,values);}
+    inline void glVertexAttribPointerARB(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribPointerARB(index,size,type,normalized,stride,pointer);}
+    inline void glCompressedTexSubImage2DARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage2DARB(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+    inline void glTexStorageMem1DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTexStorageMem1DEXT(target,levels,internalFormat,width,memory,offset);}
+    inline void glVertex2hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertex2hvNV(v);}
+    inline void glTexBuffer(GLenum target,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glTexBuffer(target,internalformat,buffer);}
+    inline void glArrayElement(GLint i){ge::gl::getDefaultDirectContext().glArrayElement(i);}
+    inline void glValidateProgram(GLuint program){ge::gl::getDefaultDirectContext().glValidateProgram(program);}
+    inline void glPixelStoref(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPixelStoref(pname,param);}
+    inline void glWindowPos3dARB(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glWindowPos3dARB(x,y,z);}
+    inline void glEvalCoord1dv(const GLdouble* u){ge::gl::getDefaultDirectContext().glEvalCoord1dv(u);}
+    inline void glVertexAttribs2fvNV(GLuint index,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttribs2fvNV(index,count,v);}
+    inline void glRecti(GLint x1,GLint y1,GLint x2,GLint y2){ge::gl::getDefaultDirectContext().glRecti(x1,y1,x2,y2);}
+    inline void glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc,tc,c,n,v);}
+    inline void glTexCoord1bOES(GLbyte s){ge::gl::getDefaultDirectContext().glTexCoord1bOES(s);}
+    inline void glProgramUniform2i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glProgramUniform2i64vARB(program,location,count,value);}
+    inline void glWindowPos2dARB(GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glWindowPos2dARB(x,y);}
+    inline void glGetProgramParameterdvNV(GLenum target,GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetProgramParameterdvNV(target,index,pname,params);}
+    inline void glRectf(GLfloat x1,GLfloat y1,GLfloat x2,GLfloat y2){ge::gl::getDefaultDirectContext().glRectf(x1,y1,x2,y2);}
+    inline void glRectd(GLdouble x1,GLdouble y1,GLdouble x2,GLdouble y2){ge::gl::getDefaultDirectContext().glRectd(x1,y1,x2,y2);}
+    inline void glMap1xOES(GLenum target,GLfixed u1,GLfixed u2,GLint stride,GLint order,GLfixed points){ge::gl::getDefaultDirectContext().glMap1xOES(target,u1,u2,stride,order,points);}
+    inline void glVertexAttrib3fvNV(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib3fvNV(index,v);}
+    inline void glReferencePlaneSGIX(const GLdouble* equation){ge::gl::getDefaultDirectContext().glReferencePlaneSGIX(equation);}
+    inline void glMulticastBlitFramebufferNV(GLuint srcGpu,GLuint dstGpu,GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter){ge::gl::getDefaultDirectContext().glMulticastBlitFramebufferNV(srcGpu,dstGpu,srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+    inline void glGetCombinerInputParameterfvNV(GLenum stage,GLenum portion,GLenum variable,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetCombinerInputParameterfvNV(stage,portion,variable,pname,params);}
+    inline GLuint64 glGetTextureSamplerHandleARB(GLuint texture,GLuint sampler){return ge::gl::getDefaultDirectContext().glGetTextureSamplerHandleARB(texture,sampler);}
+    inline void glBindTexture(GLenum target,GLuint texture){ge::gl::getDefaultDirectContext().glBindTexture(target,texture);}
+    inline void glRects(GLshort x1,GLshort y1,GLshort x2,GLshort y2){ge::gl::getDefaultDirectContext().glRects(x1,y1,x2,y2);}
+    inline void glGetActiveAttribARB(GLhandleARB programObj,GLuint index,GLsizei maxLength,GLsizei* length,GLint* size,GLenum* type,GLcharARB* name){ge::gl::getDefaultDirectContext().glGetActiveAttribARB(programObj,index,maxLength,length,size,type,name);}
+    inline void glHistogramEXT(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink){ge::gl::getDefaultDirectContext().glHistogramEXT(target,width,internalformat,sink);}
+    inline GLuint64 glGetTextureSamplerHandleNV(GLuint texture,GLuint sampler){return ge::gl::getDefaultDirectContext().glGetTextureSamplerHandleNV(texture,sampler);}
+    inline void glDetachShader(GLuint program,GLuint shader){ge::gl::getDefaultDirectContext().glDetachShader(program,shader);}
+    inline void glFinishTextureSUNX(){ge::gl::getDefaultDirectContext().glFinishTextureSUNX();}
+    inline void glUniformMatrix3x4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix3x4dv(location,count,transpose,value);}
+    inline void glVertexAttrib4fARB(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glVertexAttrib4fARB(index,x,y,z,w);}
+    inline void glGetPathColorGenivNV(GLenum color,GLenum pname,GLint* value){ge::gl::getDefaultDirectContext().glGetPathColorGenivNV(color,pname,value);}
+    inline GLint glGetProgramResourceLocation(GLuint program,GLenum programInterface,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetProgramResourceLocation(program,programInterface,name);}
+    inline void glVertexArrayAttribLFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayAttribLFormat(vaobj,attribindex,size,type,relativeoffset);}
+    inline void glGetTexLevelParameterfv(GLenum target,GLint level,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTexLevelParameterfv(target,level,pname,params);}
+    inline void glVertexArrayVertexAttribOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribOffsetEXT(vaobj,buffer,index,size,type,normalized,stride,offset);}
+    inline void glIndexFormatNV(GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glIndexFormatNV(type,stride);}
+    inline void glMultiTexCoord3i(GLenum target,GLint s,GLint t,GLint r){ge::gl::getDefaultDirectContext().glMultiTexCoord3i(target,s,t,r);}
+    inline void glReplacementCodeuiVertex3fvSUN(const GLuint* rc,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiVertex3fvSUN(rc,v);}
+    inline void glViewportIndexedfv(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glViewportIndexedfv(index,v);}
+    inline void glBindBuffersBase(GLenum target,GLuint first,GLsizei count,const GLuint* buffers){ge::gl::getDefaultDirectContext().glBindBuffersBase(target,first,count,buffers);}
+    inline void glTexBumpParameterfvATI(GLenum pname,const GLfloat* param){ge::gl::getDefaultDirectContext().glTexBumpParameterfvATI(pname,param);}
+    inline void glMatrixIndexuivARB(GLint size,const GLuint* indices){ge::gl::getDefaultDirectContext().glMatrixIndexuivARB(size,indices);}
+    inline void glVertexAttrib1hNV(GLuint index,GLhalfNV x){ge::gl::getDefaultDirectContext().glVertexAttrib1hNV(index,x);}
+    inline void glWindowPos3svMESA(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos3svMESA(v);}
+    inline void glStencilOpSeparateATI(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass){ge::gl::getDefaultDirectContext().glStencilOpSeparateATI(face,sfail,dpfail,dppass);}
+    inline void glDrawElementsBaseVertex(GLenum mode,GLsizei count,GLenum type,const void* indices,GLint basevertex){ge::gl::getDefaultDirectContext().glDrawElementsBaseVertex(mode,count,type,indices,basevertex);}
+    inline void glBlendEquationSeparateiARB(GLuint buf,GLenum modeRGB,GLenum modeAlpha){ge::gl::getDefaultDirectContext().glBlendEquationSeparateiARB(buf,modeRGB,modeAlpha);}
+    inline void glVertexAttrib1fNV(GLuint index,GLfloat x){ge::gl::getDefaultDirectContext().glVertexAttrib1fNV(index,x);}
+    inline void glMapVertexAttrib2fAPPLE(GLuint index,GLuint size,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,const GLfloat* points){ge::gl::getDefaultDirectContext().glMapVertexAttrib2fAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+    inline void glCompressedTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage1DEXT(texture,target,level,xoffset,width,format,imageSize,bits);}
+    inline void glClearBufferSubData(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearBufferSubData(target,internalformat,offset,size,format,type,data);}
+    inline void glTexStorage1D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width){ge::gl::getDefaultDirectContext().glTexStorage1D(target,levels,internalformat,width);}
+    inline void glVertexAttribI3iEXT(GLuint index,GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glVertexAttribI3iEXT(index,x,y,z);}
+    inline void glMakeTextureHandleNonResidentARB(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeTextureHandleNonResidentARB(handle);}
+    inline void glMultiDrawElementArrayAPPLE(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount){ge::gl::getDefaultDirectContext().glMultiDrawElementArrayAPPLE(mode,first,count,primcount);}
+    inline void glVertexStream4dATI(GLenum stream,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexStream4dATI(stream,x,y,z,w);}
+    inline void glProgramUniformMatrix2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2dvEXT(program,location,count,transpose,value);}
+    inline void glVertexAttribs2hvNV(GLuint index,GLsizei n,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttribs2hvNV(index,n,v);}
+    inline void glGetUniformiv(GLuint program,GLint location,GLint* params){ge::gl::getDefaultDirectContext().glGetUniformiv(program,location,params);}
+    inline void glClipPlanefOES(GLenum plane,const GLfloat* equation){ge::gl::getDefaultDirectContext().glClipPlanefOES(plane,equation);}
+    inline void glRenderbufferStorage(GLenum target,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glRenderbufferStorage(target,internalformat,width,height);}
+    inline void glUniform4ui(GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3){ge::gl::getDefaultDirectContext().glUniform4ui(location,v0,v1,v2,v3);}
+    inline void glBindFramebuffer(GLenum target,GLuint framebuffer){ge::gl::getDefaultDirectContext().glBindFramebuffer(target,framebuffer);}
+    inline void glValidateProgramARB(GLhandleARB programObj){ge::gl::getDefaultDirectContext().glValidateProgramARB(programObj);}
+    inline void glTexGenf(GLenum coord,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glTexGenf(coord,pname,param);}
+    inline void glTexGend(GLenum coord,GLenum pname,GLdouble param){ge::gl::getDefaultDirectContext().glTexGend(coord,pname,param);}
+    inline void glTexGeni(GLenum coord,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glTexGeni(coord,pname,param);}
+    inline void glDeleteFramebuffersEXT(GLsizei n,const GLuint* framebuffers){ge::gl::getDefaultDirectContext().glDeleteFramebuffersEXT(n,framebuffers);}
+    inline void glResetMinmaxEXT(GLenum target){ge::gl::getDefaultDirectContext().glResetMinmaxEXT(target);}
+    inline void glVertexAttrib1fvNV(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib1fvNV(index,v);}
+    inline GLboolean glIsQueryARB(GLuint id){return ge::gl::getDefaultDirectContext().glIsQueryARB(id);}
+    inline void glEnableVariantClientStateEXT(GLuint id){ge::gl::getDefaultDirectContext().glEnableVariantClientStateEXT(id);}
+    inline void glScissorIndexed(GLuint index,GLint left,GLint bottom,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glScissorIndexed(index,left,bottom,width,height);}
+    inline void glGetInvariantIntegervEXT(GLuint id,GLenum value,GLint* data){ge::gl::getDefaultDirectContext().glGetInvariantIntegervEXT(id,value,data);}
+    inline void glProgramLocalParameterI4uiNV(GLenum target,GLuint index,GLuint x,GLuint y,GLuint z,GLuint w){ge::gl::getDefaultDirectContext().glProgramLocalParameterI4uiNV(target,index,x,y,z,w);}
+    inline void glConvolutionParameterxvOES(GLenum target,GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glConvolutionParameterxvOES(target,pname,params);}
+    inline void glGenFramebuffersEXT(GLsizei n,GLuint* framebuffers){ge::gl::getDefaultDirectContext().glGenFramebuffersEXT(n,framebuffers);}
+    inline void glVertexArrayColorOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+    inline void glMultiTexCoord3ivARB(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3ivARB(target,v);}
+    inline void glVertexWeightfEXT(GLfloat weight){ge::gl::getDefaultDirectContext().glVertexWeightfEXT(weight);}
+    inline void glRasterPos4dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glRasterPos4dv(v);}
+    inline GLboolean glIsTextureHandleResidentARB(GLuint64 handle){return ge::gl::getDefaultDirectContext().glIsTextureHandleResidentARB(handle);}
+    inline void glRasterPos2dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glRasterPos2dv(v);}
+    inline void glWindowPos4ivMESA(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos4ivMESA(v);}
+    inline void glGetVariantPointervEXT(GLuint id,GLenum value,void** data){ge::gl::getDefaultDirectContext().glGetVariantPointervEXT(id,value,data);}
+    inline void* glMapNamedBufferRangeEXT(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access){return ge::gl::getDefaultDirectContext().glMapNamedBufferRangeEXT(buffer,offset,length,access);}
+    inline void glGetnUniformui64vARB(GLuint program,GLint location,GLsizei bufSize,GLuint64* params){ge::gl::getDefaultDirectContext().glGetnUniformui64vARB(program,location,bufSize,params);}
+    inline GLuint glCreateShaderProgramv(GLenum type,GLsizei count,const GLchar*const* strings){return ge::gl::getDefaultDirectContext().glCreateShaderProgramv(type,count,strings);}
+    inline void glGetQueryObjectiv(GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetQueryObjectiv(id,pname,params);}
+    inline void glMaxShaderCompilerThreadsKHR(GLuint count){ge::gl::getDefaultDirectContext().glMaxShaderCompilerThreadsKHR(count);}
+    inline void glPNTrianglesfATI(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPNTrianglesfATI(pname,param);}
+    inline void glGlobalAlphaFactorusSUN(GLushort factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactorusSUN(factor);}
+    inline void glVertexAttrib3dvNV(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib3dvNV(index,v);}
+    inline void glMultiTexCoord3sARB(GLenum target,GLshort s,GLshort t,GLshort r){ge::gl::getDefaultDirectContext().glMultiTexCoord3sARB(target,s,t,r);}
+    inline void glGenerateMipmap(GLenum target){ge::gl::getDefaultDirectContext().glGenerateMipmap(target);}
+    inline void glCompressedTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,imageSize,data);}
+    inline void glNamedRenderbufferStorageMultisampleEXT(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glNamedRenderbufferStorageMultisampleEXT(renderbuffer,samples,internalformat,width,height);}
+    inline void glPolygonOffsetClampEXT(GLfloat factor,GLfloat units,GLfloat clamp){ge::gl::getDefaultDirectContext().glPolygonOffsetClampEXT(factor,units,clamp);}
+    inline void glTextureRangeAPPLE(GLenum target,GLsizei length,const void* pointer){ge::gl::getDefaultDirectContext().glTextureRangeAPPLE(target,length,pointer);}
+    inline void glBlendEquationIndexedAMD(GLuint buf,GLenum mode){ge::gl::getDefaultDirectContext().glBlendEquationIndexedAMD(buf,mode);}
+    inline void glTexCoord2d(GLdouble s,GLdouble t){ge::gl::getDefaultDirectContext().glTexCoord2d(s,t);}
+    inline void glPointParameteri(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPointParameteri(pname,param);}
+    inline void glTexCoord2f(GLfloat s,GLfloat t){ge::gl::getDefaultDirectContext().glTexCoord2f(s,t);}
+    inline void glGetUnsignedBytei_vEXT(GLenum target,GLuint index,GLubyte* data){ge::gl::getDefaultDirectContext().glGetUnsignedBytei_vEXT(target,index,data);}
+    inline void glColor4iv(const GLint* v){ge::gl::getDefaultDirectContext().glColor4iv(v);}
+    inline void* glMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access){return ge::gl::getDefaultDirectContext().glMapNamedBufferRange(buffer,offset,length,access);}
+    inline GLboolean glUnmapBuffer(GLenum target){return ge::gl::getDefaultDirectContext().glUnmapBuffer(target);}
+    inline void glSampleMaskEXT(GLclampf value,GLboolean invert){ge::gl::getDefaultDirectContext().glSampleMaskEXT(value,invert);}
+    inline void glTexCoord2i(GLint s,GLint t){ge::gl::getDefaultDirectContext().glTexCoord2i(s,t);}
+    inline void glTexCoord1xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glTexCoord1xvOES(coords);}
+    inline void glVertexAttrib1sARB(GLuint index,GLshort x){ge::gl::getDefaultDirectContext().glVertexAttrib1sARB(index,x);}
+    inline void glGetVertexArrayiv(GLuint vaobj,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetVertexArrayiv(vaobj,pname,param);}
+    inline void glProgramParameter4dvNV(GLenum target,GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glProgramParameter4dvNV(target,index,v);}
+    inline void glTexCoord2s(GLshort s,GLshort t){ge::gl::getDefaultDirectContext().glTexCoord2s(s,t);}
+    inline void glTextureParameterIuivEXT(GLuint texture,GLenum target,GLenum pname,const GLuint* params){ge::gl::getDefaultDirectContext().glTextureParameterIuivEXT(texture,target,pname,params);}
+    inline void glGetColorTableParameterfvSGI(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetColorTableParameterfvSGI(target,pname,params);}
+    inline void glTexCoord4dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glTexCoord4dv(v);}
+    inline void glVertexAttrib1svNV(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib1svNV(index,v);}
+    inline void glNamedFramebufferTextureFaceEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLenum face){ge::gl::getDefaultDirectContext().glNamedFramebufferTextureFaceEXT(framebuffer,attachment,texture,level,face);}
+    inline void glProgramUniform2ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform2ui64vNV(program,location,count,value);}
+    inline void glStencilFillPathNV(GLuint path,GLenum fillMode,GLuint mask){ge::gl::getDefaultDirectContext().glStencilFillPathNV(path,fillMode,mask);}
+    inline void glNormal3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glNormal3dv(v);}
+    inline void glReleaseShaderCompiler(){ge::gl::getDefaultDirectContext().glReleaseShaderCompiler();}
+    inline void glTexStorageMem3DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTexStorageMem3DEXT(target,levels,internalFormat,width,height,depth,memory,offset);}
+    inline void glTexCoord3bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glTexCoord3bvOES(coords);}
+    inline GLboolean glIsVertexAttribEnabledAPPLE(GLuint index,GLenum pname){return ge::gl::getDefaultDirectContext().glIsVertexAttribEnabledAPPLE(index,pname);}
+    inline void glTexCoord1dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glTexCoord1dv(v);}
+    inline void glReadPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLvoid* pixels){ge::gl::getDefaultDirectContext().glReadPixels(x,y,width,height,format,type,pixels);}
+    inline void glVertexAttribI3iv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI3iv(index,v);}
+    inline void glSetFenceAPPLE(GLuint fence){ge::gl::getDefaultDirectContext().glSetFenceAPPLE(fence);}
+    inline void glWeightsvARB(GLint size,const GLshort* weights){ge::gl::getDefaultDirectContext().glWeightsvARB(size,weights);}
+    inline void glShadeModel(GLenum mode){ge::gl::getDefaultDirectContext().glShadeModel(mode);}
+    inline void glTextureStorageMem3DMultisampleEXT(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTextureStorageMem3DMultisampleEXT(texture,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+    inline void glMapGrid1d(GLint un,GLdouble u1,GLdouble u2){ge::gl::getDefaultDirectContext().glMapGrid1d(un,u1,u2);}
+    inline void glGetHistogramParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetHistogramParameterivEXT(target,pname,params);}
+    inline void glConservativeRasterParameteriNV(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glConservativeRasterParameteriNV(pname,param);}
+    inline void glClearNamedBufferData(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearNamedBufferData(buffer,internalformat,format,type,data);}
+    inline void glClearDepthf(GLfloat d){ge::gl::getDefaultDirectContext().glClearDepthf(d);}
+    inline void glCreatePerfQueryINTEL(GLuint queryId,GLuint* queryHandle){ge::gl::getDefaultDirectContext().glCreatePerfQueryINTEL(queryId,queryHandle);}
+    inline void glFogCoordfEXT(GLfloat coord){ge::gl::getDefaultDirectContext().glFogCoordfEXT(coord);}
+    inline void glVertexAttrib2dARB(GLuint index,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexAttrib2dARB(index,x,y);}
+    inline void glMultiTexCoord4dARB(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q){ge::gl::getDefaultDirectContext().glMultiTexCoord4dARB(target,s,t,r,q);}
+    inline void glReadnPixelsARB(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data){ge::gl::getDefaultDirectContext().glReadnPixelsARB(x,y,width,height,format,type,bufSize,data);}
+    inline void glMultiTexBufferEXT(GLenum texunit,GLenum target,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glMultiTexBufferEXT(texunit,target,internalformat,buffer);}
+    inline void glWindowPos4dvMESA(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos4dvMESA(v);}
+    inline void glInvalidateNamedFramebufferData(GLuint framebuffer,GLsizei numAttachments,const GLenum* attachments){ge::gl::getDefaultDirectContext().glInvalidateNamedFramebufferData(framebuffer,numAttachments,attachments);}
+    inline void glSecondaryColorPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glSecondaryColorPointerListIBM(size,type,stride,pointer,ptrstride);}
+    inline void glRectiv(const GLint* v1,const GLint* v2){ge::gl::getDefaultDirectContext().glRectiv(v1,v2);}
+    inline void glColorP4ui(GLenum type,GLuint color){ge::gl::getDefaultDirectContext().glColorP4ui(type,color);}
+    inline void glUseProgramStages(GLuint pipeline,GLbitfield stages,GLuint program){ge::gl::getDefaultDirectContext().glUseProgramStages(pipeline,stages,program);}
+    inline void glRasterPos3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glRasterPos3dv(v);}
+    inline void glPathTexGenNV(GLenum texCoordSet,GLenum genMode,GLint components,const GLfloat* coeffs){ge::gl::getDefaultDirectContext().glPathTexGenNV(texCoordSet,genMode,components,coeffs);}
+    inline void glVertexBlendEnviATI(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glVertexBlendEnviATI(pname,param);}
+    inline void glUniform3i64ARB(GLint location,GLint64 x,GLint64 y,GLint64 z){ge::gl::getDefaultDirectContext().glUniform3i64ARB(location,x,y,z);}
+    inline void glLoadMatrixf(const GLfloat* m){ge::gl::getDefaultDirectContext().glLoadMatrixf(m);}
+    inline void glProgramUniform2dEXT(GLuint program,GLint location,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glProgramUniform2dEXT(program,location,x,y);}
+    inline void glVertexAttribI4iv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI4iv(index,v);}
+    inline void glNamedFramebufferDrawBuffer(GLuint framebuffer,GLenum buf){ge::gl::getDefaultDirectContext().glNamedFramebufferDrawBuffer(framebuffer,buf);}
+    inline void glColor4ubv(const GLubyte* v){ge::gl::getDefaultDirectContext().glColor4ubv(v);}
+    inline void glColor3hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glColor3hvNV(v);}
+    inline void glGetMapAttribParameterfvNV(GLenum target,GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMapAttribParameterfvNV(target,index,pname,params);}
+    inline void glGetBufferSubData(GLenum target,GLintptr offset,GLsizeiptr size,void* data){ge::gl::getDefaultDirectContext().glGetBufferSubData(target,offset,size,data);}
+    inline void glGetVertexAttribLdv(GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVertexAttribLdv(index,pname,params);}
+    inline void glGetnUniformuiv(GLuint program,GLint location,GLsizei bufSize,GLuint* params){ge::gl::getDefaultDirectContext().glGetnUniformuiv(program,location,bufSize,params);}
+    inline void glGetUniformui64vNV(GLuint program,GLint location,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetUniformui64vNV(program,location,params);}
+    inline void glNamedRenderbufferStorageEXT(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glNamedRenderbufferStorageEXT(renderbuffer,internalformat,width,height);}
+    inline void glVertexAttrib3dNV(GLuint index,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexAttrib3dNV(index,x,y,z);}
+    inline void glTextureStorage1DEXT(GLuint texture,GLenum target,GLsizei levels,GLenum internalformat,GLsizei width){ge::gl::getDefaultDirectContext().glTextureStorage1DEXT(texture,target,levels,internalformat,width);}
+    inline void glPixelTexGenParameteriSGIS(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPixelTexGenParameteriSGIS(pname,param);}
+    inline void glColorTableEXT(GLenum target,GLenum internalFormat,GLsizei width,GLenum format,GLenum type,const void* table){ge::gl::getDefaultDirectContext().glColorTableEXT(target,internalFormat,width,format,type,table);}
+    inline void glGenBuffers(GLsizei n,GLuint* buffers){ge::gl::getDefaultDirectContext().glGenBuffers(n,buffers);}
+    inline void glMultiTexCoord3xvOES(GLenum texture,const GLfixed* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord3xvOES(texture,coords);}
+    inline void glExecuteProgramNV(GLenum target,GLuint id,const GLfloat* params){ge::gl::getDefaultDirectContext().glExecuteProgramNV(target,id,params);}
+    inline void glVariantArrayObjectATI(GLuint id,GLenum type,GLsizei stride,GLuint buffer,GLuint offset){ge::gl::getDefaultDirectContext().glVariantArrayObjectATI(id,type,stride,buffer,offset);}
+    inline void glColor3xvOES(const GLfixed* components){ge::gl::getDefaultDirectContext().glColor3xvOES(components);}
+    inline void glGetnConvolutionFilterARB(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image){ge::gl::getDefaultDirectContext().glGetnConvolutionFilterARB(target,format,type,bufSize,image);}
+    inline void glNormalFormatNV(GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glNormalFormatNV(type,stride);}
+    inline void glGetInvariantFloatvEXT(GLuint id,GLenum value,GLfloat* data){ge::gl::getDefaultDirectContext().glGetInvariantFloatvEXT(id,value,data);}
+    inline void glClearNamedFramebufferiv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLint* value){ge::gl::getDefaultDirectContext().glClearNamedFramebufferiv(framebuffer,buffer,drawbuffer,value);}
+    inline void glTexImage3D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexImage3D(target,level,internalFormat,width,height,depth,border,format,type,pixels);}
+    inline void glGenSamplers(GLsizei count,GLuint* samplers){ge::gl::getDefaultDirectContext().glGenSamplers(count,samplers);}
+    inline GLboolean glIsFramebuffer(GLuint framebuffer){return ge::gl::getDefaultDirectContext().glIsFramebuffer(framebuffer);}
+    inline void glProgramUniform3dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform3dvEXT(program,location,count,value);}
+    inline void glGetVertexAttribfvNV(GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVertexAttribfvNV(index,pname,params);}
+    inline void glDrawRangeElementArrayAPPLE(GLenum mode,GLuint start,GLuint end,GLint first,GLsizei count){ge::gl::getDefaultDirectContext().glDrawRangeElementArrayAPPLE(mode,start,end,first,count);}
+    inline void glUniform3i64NV(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z){ge::gl::getDefaultDirectContext().glUniform3i64NV(location,x,y,z);}
+    inline void glMatrixPopEXT(GLenum mode){ge::gl::getDefaultDirectContext().glMatrixPopEXT(mode);}
+    inline void glVertexStream1sATI(GLenum stream,GLshort x){ge::gl::getDefaultDirectContext().glVertexStream1sATI(stream,x);}
+    inline void glGetnPixelMapuivARB(GLenum map,GLsizei bufSize,GLuint* values){ge::gl::getDefaultDirectContext().glGetnPixelMapuivARB(map,bufSize,values);}
+    inline void glMultiTexEnviEXT(GLenum texunit,GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glMultiTexEnviEXT(texunit,target,pname,param);}
+    inline void glVertexAttribI2iEXT(GLuint index,GLint x,GLint y){ge::gl::getDefaultDirectContext().glVertexAttribI2iEXT(index,x,y);}
+    inline void glProgramParameter4fvNV(GLenum target,GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glProgramParameter4fvNV(target,index,v);}
+    inline void glWaitSemaphoreEXT(GLuint semaphore,GLuint numBufferBarriers,const GLuint* buffers,GLuint numTextureBarriers,const GLuint* textures,const GLenum* srcLayouts){ge::gl::getDefaultDirectContext().glWaitSemaphoreEXT(semaphore,numBufferBarriers,buffers,numTextureBarriers,textures,srcLayouts);}
+    inline void glNamedFramebufferSampleLocationsfvNV(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glNamedFramebufferSampleLocationsfvNV(framebuffer,start,count,v);}
+    inline void glTexCoordP4uiv(GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glTexCoordP4uiv(type,coords);}
+    inline void glRectxvOES(const GLfixed* v1,const GLfixed* v2){ge::gl::getDefaultDirectContext().glRectxvOES(v1,v2);}
+    inline void glGetVariantIntegervEXT(GLuint id,GLenum value,GLint* data){ge::gl::getDefaultDirectContext().glGetVariantIntegervEXT(id,value,data);}
+    inline void glDeleteLists(GLuint list,GLsizei range){ge::gl::getDefaultDirectContext().glDeleteLists(list,range);}
+    inline void glTexGendv(GLenum coord,GLenum pname,const GLdouble* params){ge::gl::getDefaultDirectContext().glTexGendv(coord,pname,params);}
+    inline void glVertexP2uiv(GLenum type,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexP2uiv(type,value);}
+    inline void glGetPerfMonitorGroupsAMD(GLint* numGroups,GLsizei groupsSize,GLuint* groups){ge::gl::getDefaultDirectContext().glGetPerfMonitorGroupsAMD(numGroups,groupsSize,groups);}
+    inline void glMultTransposeMatrixfARB(const GLfloat* m){ge::gl::getDefaultDirectContext().glMultTransposeMatrixfARB(m);}
+    inline void glVertexAttribI2ivEXT(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI2ivEXT(index,v);}
+    inline void glReplacementCodeuiColor4fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* c,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc,c,n,v);}
+    inline void glDeleteStatesNV(GLsizei n,const GLuint* states){ge::gl::getDefaultDirectContext().glDeleteStatesNV(n,states);}
+    inline void glGetBufferParameteri64v(GLenum target,GLenum pname,GLint64* params){ge::gl::getDefaultDirectContext().glGetBufferParameteri64v(target,pname,params);}
+    inline void glProgramUniform4dv(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform4dv(program,location,count,value);}
+    inline void glEdgeFlagPointerEXT(GLsizei stride,GLsizei count,const GLboolean* pointer){ge::gl::getDefaultDirectContext().glEdgeFlagPointerEXT(stride,count,pointer);}
+    inline void glVideoCaptureStreamParameterivNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glVideoCaptureStreamParameterivNV(video_capture_slot,stream,pname,params);}
+    inline void glVertexStream4iATI(GLenum stream,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glVertexStream4iATI(stream,x,y,z,w);}
+    inline void glVDPAUFiniNV(){ge::gl::getDefaultDirectContext().glVDPAUFiniNV();}
+    inline void glMakeBufferNonResidentNV(GLenum target){ge::gl::getDefaultDirectContext().glMakeBufferNonResidentNV(target);}
+    inline void glUniform1ui64ARB(GLint location,GLuint64 x){ge::gl::getDefaultDirectContext().glUniform1ui64ARB(location,x);}
+    inline void glStencilStrokePathNV(GLuint path,GLint reference,GLuint mask){ge::gl::getDefaultDirectContext().glStencilStrokePathNV(path,reference,mask);}
+    inline void glVariantuivEXT(GLuint id,const GLuint* addr){ge::gl::getDefaultDirectContext().glVariantuivEXT(id,addr);}
+    inline void glCopyTexSubImage3DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTexSubImage3DEXT(target,level,xoffset,yoffset,zoffset,x,y,width,height);}
+    inline void glSpriteParameteriSGIX(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glSpriteParameteriSGIX(pname,param);}
+    inline void glMultiTexCoord1sARB(GLenum target,GLshort s){ge::gl::getDefaultDirectContext().glMultiTexCoord1sARB(target,s);}
+    inline void glConvolutionParameterfv(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glConvolutionParameterfv(target,pname,params);}
+    inline void glMakeTextureHandleResidentNV(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeTextureHandleResidentNV(handle);}
+    inline void glMultMatrixxOES(const GLfixed* m){ge::gl::getDefaultDirectContext().glMultMatrixxOES(m);}
+    inline void glTextureNormalEXT(GLenum mode){ge::gl::getDefaultDirectContext().glTextureNormalEXT(mode);}
+    inline void glGetQueryivARB(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetQueryivARB(target,pname,params);}
+    inline void glCompressedMultiTexImage3DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+    inline GLint glGetInstrumentsSGIX(){return ge::gl::getDefaultDirectContext().glGetInstrumentsSGIX();}
+    inline void glProgramUniformMatrix4x3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x3fvEXT(program,location,count,transpose,value);}
+    inline void glPointParameterf(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPointParameterf(pname,param);}
+    inline void glProgramUniform3dEXT(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glProgramUniform3dEXT(program,location,x,y,z);}
+    inline void glMultiTexCoord2hNV(GLenum target,GLhalfNV s,GLhalfNV t){ge::gl::getDefaultDirectContext().glMultiTexCoord2hNV(target,s,t);}
+    inline void glGetConvolutionFilterEXT(GLenum target,GLenum format,GLenum type,void* image){ge::gl::getDefaultDirectContext().glGetConvolutionFilterEXT(target,format,type,image);}
+    inline void glVertexAttrib2hNV(GLuint index,GLhalfNV x,GLhalfNV y){ge::gl::getDefaultDirectContext().glVertexAttrib2hNV(index,x,y);}
+    inline void glCurrentPaletteMatrixARB(GLint index){ge::gl::getDefaultDirectContext().glCurrentPaletteMatrixARB(index);}
+    inline void glFogxvOES(GLenum pname,const GLfixed* param){ge::gl::getDefaultDirectContext().glFogxvOES(pname,param);}
+    inline void glCreateRenderbuffers(GLsizei n,GLuint* renderbuffers){ge::gl::getDefaultDirectContext().glCreateRenderbuffers(n,renderbuffers);}
+    inline void glVertexAttrib4Nusv(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Nusv(index,v);}
+    inline void glCombinerInputNV(GLenum stage,GLenum portion,GLenum variable,GLenum input,GLenum mapping,GLenum componentUsage){ge::gl::getDefaultDirectContext().glCombinerInputNV(stage,portion,variable,input,mapping,componentUsage);}
+    inline void glDepthFunc(GLenum func){ge::gl::getDefaultDirectContext().glDepthFunc(func);}
+    inline void glWindowPos4fMESA(GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glWindowPos4fMESA(x,y,z,w);}
+    inline void glEnableClientStateIndexedEXT(GLenum array,GLuint index){ge::gl::getDefaultDirectContext().glEnableClientStateIndexedEXT(array,index);}
+    inline void glTexCoord4iv(const GLint* v){ge::gl::getDefaultDirectContext().glTexCoord4iv(v);}
+    inline void glProgramUniform4i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z,GLint64 w){ge::gl::getDefaultDirectContext().glProgramUniform4i64ARB(program,location,x,y,z,w);}
+    inline void glBlendFunci(GLuint buf,GLenum src,GLenum dst){ge::gl::getDefaultDirectContext().glBlendFunci(buf,src,dst);}
+    inline void glResolveDepthValuesNV(){ge::gl::getDefaultDirectContext().glResolveDepthValuesNV();}
+    inline void glTextureColorMaskSGIS(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha){ge::gl::getDefaultDirectContext().glTextureColorMaskSGIS(red,green,blue,alpha);}
+    inline GLuint glCreateShaderProgramEXT(GLenum type,const GLchar* string){return ge::gl::getDefaultDirectContext().glCreateShaderProgramEXT(type,string);}
+    inline void glBufferStorage(GLenum target,GLsizeiptr size,const void* data,GLbitfield flags){ge::gl::getDefaultDirectContext().glBufferStorage(target,size,data,flags);}
+    inline void glMakeNamedBufferNonResidentNV(GLuint buffer){ge::gl::getDefaultDirectContext().glMakeNamedBufferNonResidentNV(buffer);}
+    inline void glRenderbufferStorageMultisampleEXT(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glRenderbufferStorageMultisampleEXT(target,samples,internalformat,width,height);}
+    inline void glGetFloati_v(GLenum target,GLuint index,GLfloat* data){ge::gl::getDefaultDirectContext().glGetFloati_v(target,index,data);}
+    inline void glUniform2ui64ARB(GLint location,GLuint64 x,GLuint64 y){ge::gl::getDefaultDirectContext().glUniform2ui64ARB(location,x,y);}
+    inline void glVertex3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glVertex3fv(v);}
+    inline GLint glGetUniformLocation(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetUniformLocation(program,name);}
+    inline void glVertexStream1svATI(GLenum stream,const GLshort* coords){ge::gl::getDefaultDirectContext().glVertexStream1svATI(stream,coords);}
+    inline void glVertexStream3fATI(GLenum stream,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glVertexStream3fATI(stream,x,y,z);}
+    inline void glNamedFramebufferDrawBuffers(GLuint framebuffer,GLsizei n,const GLenum* bufs){ge::gl::getDefaultDirectContext().glNamedFramebufferDrawBuffers(framebuffer,n,bufs);}
+    inline void glUniform2ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glUniform2ui64vNV(location,count,value);}
+    inline void glTexCoordPointervINTEL(GLint size,GLenum type,const void** pointer){ge::gl::getDefaultDirectContext().glTexCoordPointervINTEL(size,type,pointer);}
+    inline void glUniform4fv(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform4fv(location,count,value);}
+    inline void glNormalPointerEXT(GLenum type,GLsizei stride,GLsizei count,const void* pointer){ge::gl::getDefaultDirectContext().glNormalPointerEXT(type,stride,count,pointer);}
+    inline void glVertexAttrib4hNV(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w){ge::gl::getDefaultDirectContext().glVertexAttrib4hNV(index,x,y,z,w);}
+    inline void glNormal3f(GLfloat nx,GLfloat ny,GLfloat nz){ge::gl::getDefaultDirectContext().glNormal3f(nx,ny,nz);}
+    inline void glVertexStream2iATI(GLenum stream,GLint x,GLint y){ge::gl::getDefaultDirectContext().glVertexStream2iATI(stream,x,y);}
+    inline void glVertexAttribP4uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexAttribP4uiv(index,type,normalized,value);}
+    inline void glCompressedTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+    inline void glAsyncMarkerSGIX(GLuint marker){ge::gl::getDefaultDirectContext().glAsyncMarkerSGIX(marker);}
+    inline void glTextureStorageSparseAMD(GLuint texture,GLenum target,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei layers,GLbitfield flags){ge::gl::getDefaultDirectContext().glTextureStorageSparseAMD(texture,target,internalFormat,width,height,depth,layers,flags);}
+    inline void glGetConvolutionParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetConvolutionParameterivEXT(target,pname,params);}
+    inline void glEndPerfQueryINTEL(GLuint queryHandle){ge::gl::getDefaultDirectContext().glEndPerfQueryINTEL(queryHandle);}
+    inline void glFragmentLightModeliSGIX(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glFragmentLightModeliSGIX(pname,param);}
+    inline void glPrioritizeTexturesEXT(GLsizei n,const GLuint* textures,const GLclampf* priorities){ge::gl::getDefaultDirectContext().glPrioritizeTexturesEXT(n,textures,priorities);}
+    inline void glEndConditionalRender(){ge::gl::getDefaultDirectContext().glEndConditionalRender();}
+    inline void glEnableClientState(GLenum cap){ge::gl::getDefaultDirectContext().glEnableClientState(cap);}
+    inline void glResetHistogram(GLenum target){ge::gl::getDefaultDirectContext().glResetHistogram(target);}
+    inline void glGetOcclusionQueryivNV(GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetOcclusionQueryivNV(id,pname,params);}
+    inline void glUniform1uiEXT(GLint location,GLuint v0){ge::gl::getDefaultDirectContext().glUniform1uiEXT(location,v0);}
+    inline void glMultiTexCoord2sv(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2sv(target,v);}
+    inline void glTexSubImage2DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexSubImage2DEXT(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+    inline void glProgramUniform2uiv(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform2uiv(program,location,count,value);}
+    inline void glMultiTexCoord2iARB(GLenum target,GLint s,GLint t){ge::gl::getDefaultDirectContext().glMultiTexCoord2iARB(target,s,t);}
+    inline void glGetQueryObjectuiv(GLuint id,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetQueryObjectuiv(id,pname,params);}
+    inline void glGenerateMultiTexMipmapEXT(GLenum texunit,GLenum target){ge::gl::getDefaultDirectContext().glGenerateMultiTexMipmapEXT(texunit,target);}
+    inline void glVertexAttrib4iv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4iv(index,v);}
+    inline void glWindowPos3dvMESA(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos3dvMESA(v);}
+    inline void glLabelObjectEXT(GLenum type,GLuint object,GLsizei length,const GLchar* label){ge::gl::getDefaultDirectContext().glLabelObjectEXT(type,object,length,label);}
+    inline void glProgramUniform1uiv(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform1uiv(program,location,count,value);}
+    inline void glFramebufferTexture(GLenum target,GLenum attachment,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTexture(target,attachment,texture,level);}
+    inline void glMultiTexEnvfEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glMultiTexEnvfEXT(texunit,target,pname,param);}
+    inline void glGetTexGendv(GLenum coord,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetTexGendv(coord,pname,params);}
+    inline void glVertex4xOES(GLfixed x,GLfixed y,GLfixed z){ge::gl::getDefaultDirectContext().glVertex4xOES(x,y,z);}
+    inline void glVertexAttribI2uivEXT(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI2uivEXT(index,v);}
+    inline void glNamedProgramLocalParameter4fvEXT(GLuint program,GLenum target,GLuint index,const GLfloat* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameter4fvEXT(program,target,index,params);}
+    inline void glColor3usv(const GLushort* v){ge::gl::getDefaultDirectContext().glColor3usv(v);}
+    inline void glGetPixelTransformParameterfvEXT(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetPixelTransformParameterfvEXT(target,pname,params);}
+    inline void glIndexxvOES(const GLfixed* component){ge::gl::getDefaultDirectContext().glIndexxvOES(component);}
+    inline void glDepthMask(GLboolean flag){ge::gl::getDefaultDirectContext().glDepthMask(flag);}
+    inline void glProgramUniformMatrix2x4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x4fv(program,location,count,transpose,value);}
+    inline GLboolean glAreProgramsResidentNV(GLsizei n,const GLuint* programs,GLboolean* residences){return ge::gl::getDefaultDirectContext().glAreProgramsResidentNV(n,programs,residences);}
+    inline void glColorTable(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const GLvoid* table){ge::gl::getDefaultDirectContext().glColorTable(target,internalformat,width,format,type,table);}
+    inline void glBeginQueryIndexed(GLenum target,GLuint index,GLuint id){ge::gl::getDefaultDirectContext().glBeginQueryIndexed(target,index,id);}
+    inline void glVertexStream1dvATI(GLenum stream,const GLdouble* coords){ge::gl::getDefaultDirectContext().glVertexStream1dvATI(stream,coords);}
+    inline void glGetMultiTexEnvfvEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMultiTexEnvfvEXT(texunit,target,pname,params);}
+    inline void glDeleteFencesNV(GLsizei n,const GLuint* fences){ge::gl::getDefaultDirectContext().glDeleteFencesNV(n,fences);}
+    inline void glVertexAttribs1dvNV(GLuint index,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribs1dvNV(index,count,v);}
+    inline void glBufferStorageExternalEXT(GLenum target,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags){ge::gl::getDefaultDirectContext().glBufferStorageExternalEXT(target,offset,size,clientBuffer,flags);}
+    inline void glVertexStream2sATI(GLenum stream,GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glVertexStream2sATI(stream,x,y);}
+    inline void glGetnSeparableFilterARB(GLenum target,GLenum format,GLenum type,GLsizei rowBufSize,void* row,GLsizei columnBufSize,void* column,void* span){ge::gl::getDefaultDirectContext().glGetnSeparableFilterARB(target,format,type,rowBufSize,row,columnBufSize,column,span);}
+    inline void glProgramUniform2dv(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform2dv(program,location,count,value);}
+    inline void glActiveStencilFaceEXT(GLenum face){ge::gl::getDefaultDirectContext().glActiveStencilFaceEXT(face);}
+    inline void glProgramUniform4dEXT(GLuint program,GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glProgramUniform4dEXT(program,location,x,y,z,w);}
+    inline void glPointSizexOES(GLfixed size){ge::gl::getDefaultDirectContext().glPointSizexOES(size);}
+    inline void glRasterPos2sv(const GLshort* v){ge::gl::getDefaultDirectContext().glRasterPos2sv(v);}
+    inline GLuint glBindParameterEXT(GLenum value){return ge::gl::getDefaultDirectContext().glBindParameterEXT(value);}
+    inline void glTexCoord1sv(const GLshort* v){ge::gl::getDefaultDirectContext().glTexCoord1sv(v);}
+    inline void glBlendParameteriNV(GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glBlendParameteriNV(pname,value);}
+    inline void glNamedProgramLocalParameter4dvEXT(GLuint program,GLenum target,GLuint index,const GLdouble* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameter4dvEXT(program,target,index,params);}
+    inline void glProgramUniformHandleui64NV(GLuint program,GLint location,GLuint64 value){ge::gl::getDefaultDirectContext().glProgramUniformHandleui64NV(program,location,value);}
+    inline void glGetTextureParameterfvEXT(GLuint texture,GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTextureParameterfvEXT(texture,target,pname,params);}
+    inline void glGetPathMetricsNV(GLbitfield metricQueryMask,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLsizei stride,GLfloat* metrics){ge::gl::getDefaultDirectContext().glGetPathMetricsNV(metricQueryMask,numPaths,pathNameType,paths,pathBase,stride,metrics);}
+    inline void glVertex2i(GLint x,GLint y){ge::gl::getDefaultDirectContext().glVertex2i(x,y);}
+    inline void glNewList(GLuint list,GLenum mode){ge::gl::getDefaultDirectContext().glNewList(list,mode);}
+    inline void glMatrixLoad3x3fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixLoad3x3fNV(matrixMode,m);}
+    inline void glMultiTexCoord2fARB(GLenum target,GLfloat s,GLfloat t){ge::gl::getDefaultDirectContext().glMultiTexCoord2fARB(target,s,t);}
+    inline void glWeightdvARB(GLint size,const GLdouble* weights){ge::gl::getDefaultDirectContext().glWeightdvARB(size,weights);}
+    inline GLboolean glIsTransformFeedbackNV(GLuint id){return ge::gl::getDefaultDirectContext().glIsTransformFeedbackNV(id);}
+    inline void glVertexAttribDivisorARB(GLuint index,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexAttribDivisorARB(index,divisor);}
+    inline void glSecondaryColorP3uiv(GLenum type,const GLuint* color){ge::gl::getDefaultDirectContext().glSecondaryColorP3uiv(type,color);}
+    inline void glGetnCompressedTexImageARB(GLenum target,GLint lod,GLsizei bufSize,void* img){ge::gl::getDefaultDirectContext().glGetnCompressedTexImageARB(target,lod,bufSize,img);}
+    inline void glGetIntegerv(GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetIntegerv(pname,params);}
+    inline void glMatrixLoaddEXT(GLenum mode,const GLdouble* m){ge::gl::getDefaultDirectContext().glMatrixLoaddEXT(mode,m);}
+    inline GLfloat glGetPathLengthNV(GLuint path,GLsizei startSegment,GLsizei numSegments){return ge::gl::getDefaultDirectContext().glGetPathLengthNV(path,startSegment,numSegments);}
+    inline void glProgramUniformMatrix3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3dv(program,location,count,transpose,value);}
+    inline void glUniform4i64NV(GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w){ge::gl::getDefaultDirectContext().glUniform4i64NV(location,x,y,z,w);}
+    inline void glGetHistogramEXT(GLenum target,GLboolean reset,GLenum format,GLenum type,void* values){ge::gl::getDefaultDirectContext().glGetHistogramEXT(target,reset,format,type,values);}
+    inline void glVertexAttrib4NuivARB(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NuivARB(index,v);}
+    inline void glMapGrid2xOES(GLint n,GLfixed u1,GLfixed u2,GLfixed v1,GLfixed v2){ge::gl::getDefaultDirectContext().glMapGrid2xOES(n,u1,u2,v1,v2);}
+    inline void glTexImage2D(GLenum target,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexImage2D(target,level,internalFormat,width,height,border,format,type,pixels);}
+    inline void glWindowPos2fvARB(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos2fvARB(v);}
+    inline void glEnableIndexedEXT(GLenum target,GLuint index){ge::gl::getDefaultDirectContext().glEnableIndexedEXT(target,index);}
+    inline void glTexCoord1bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glTexCoord1bvOES(coords);}
+    inline void glDrawPixels(GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glDrawPixels(width,height,format,type,pixels);}
+    inline void glMultMatrixd(const GLdouble* m){ge::gl::getDefaultDirectContext().glMultMatrixd(m);}
+    inline void glMultMatrixf(const GLfloat* m){ge::gl::getDefaultDirectContext().glMultMatrixf(m);}
+    inline void glReplacementCodePointerSUN(GLenum type,GLsizei stride,const void** pointer){ge::gl::getDefaultDirectContext().glReplacementCodePointerSUN(type,stride,pointer);}
+    inline void glLoadTransposeMatrixdARB(const GLdouble* m){ge::gl::getDefaultDirectContext().glLoadTransposeMatrixdARB(m);}
+    inline void glVertexAttrib4Nubv(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Nubv(index,v);}
+    inline void glVertexArrayVertexAttribIOffsetEXT(GLuint vaobj,GLuint buffer,GLuint index,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribIOffsetEXT(vaobj,buffer,index,size,type,stride,offset);}
+    inline void glCompileShaderARB(GLhandleARB shaderObj){ge::gl::getDefaultDirectContext().glCompileShaderARB(shaderObj);}
+    inline void glWindowPos3dMESA(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glWindowPos3dMESA(x,y,z);}
+    inline void glNormalStream3fvATI(GLenum stream,const GLfloat* coords){ge::gl::getDefaultDirectContext().glNormalStream3fvATI(stream,coords);}
+    inline void glColor4usv(const GLushort* v){ge::gl::getDefaultDirectContext().glColor4usv(v);}
+    inline void glMapGrid1f(GLint un,GLfloat u1,GLfloat u2){ge::gl::getDefaultDirectContext().glMapGrid1f(un,u1,u2);}
+    inline void glPolygonStipple(const GLubyte* mask){ge::gl::getDefaultDirectContext().glPolygonStipple(mask);}
+    inline void glUniform4ui64ARB(GLint location,GLuint64 x,GLuint64 y,GLuint64 z,GLuint64 w){ge::gl::getDefaultDirectContext().glUniform4ui64ARB(location,x,y,z,w);}
+    inline void glTextureRenderbufferEXT(GLuint texture,GLenum target,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glTextureRenderbufferEXT(texture,target,renderbuffer);}
+    inline GLint glGetSubroutineUniformLocation(GLuint program,GLenum shadertype,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetSubroutineUniformLocation(program,shadertype,name);}
+    inline void glGetFramebufferParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFramebufferParameteriv(target,pname,params);}
+    inline void glPixelMapusv(GLenum map,GLsizei mapsize,const GLushort* values){ge::gl::getDefaultDirectContext().glPixelMapusv(map,mapsize,values);}
+    inline void glGetSamplerParameteriv(GLuint sampler,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetSamplerParameteriv(sampler,pname,params);}
+    inline void glVertexStream2fvATI(GLenum stream,const GLfloat* coords){ge::gl::getDefaultDirectContext().glVertexStream2fvATI(stream,coords);}
+    inline void glProgramStringARB(GLenum target,GLenum format,GLsizei len,const void* string){ge::gl::getDefaultDirectContext().glProgramStringARB(target,format,len,string);}
+    inline void glProgramUniformMatrix3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3dvEXT(program,location,count,transpose,value);}
+    inline void glSeparableFilter2D(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* row,const GLvoid* column){ge::gl::getDefaultDirectContext().glSeparableFilter2D(target,internalformat,width,height,format,type,row,column);}
+    inline void glVertexAttribI1uiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI1uiv(index,v);}
+    inline void glLGPUCopyImageSubDataNVX(GLuint sourceGpu,GLbitfield destinationGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srxY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glLGPUCopyImageSubDataNVX(sourceGpu,destinationGpuMask,srcName,srcTarget,srcLevel,srcX,srxY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,width,height,depth);}
+    inline void glTexStorage2D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glTexStorage2D(target,levels,internalformat,width,height);}
+    inline void glColor3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glColor3fv(v);}
+    inline void glGetMultiTexGendvEXT(GLenum texunit,GLenum coord,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetMultiTexGendvEXT(texunit,coord,pname,params);}
+    inline void glVertexAttribL4dvEXT(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL4dvEXT(index,v);}
+    inline void glGetActiveUniform(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name){ge::gl::getDefaultDirectContext().glGetActiveUniform(program,index,bufSize,length,size,type,name);}
+    inline void glUniform2ui64vARB(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniform2ui64vARB(location,count,value);}
+    inline void glMakeNamedBufferResidentNV(GLuint buffer,GLenum access){ge::gl::getDefaultDirectContext().glMakeNamedBufferResidentNV(buffer,access);}
+    inline GLenum glPathGlyphIndexRangeNV(GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint pathParameterTemplate,GLfloat emScale,GLuint baseAndCount[2]){return ge::gl::getDefaultDirectContext().glPathGlyphIndexRangeNV(fontTarget,fontName,fontStyle,pathParameterTemplate,emScale,baseAndCount);}
+    inline void glColorPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glColorPointer(size,type,stride,ptr);}
+    inline void glProgramEnvParameterI4ivNV(GLenum target,GLuint index,const GLint* params){ge::gl::getDefaultDirectContext().glProgramEnvParameterI4ivNV(target,index,params);}
+    inline void glMulticastGetQueryObjectui64vNV(GLuint gpu,GLuint id,GLenum pname,GLuint64* params){ge::gl::getDefaultDirectContext().glMulticastGetQueryObjectui64vNV(gpu,id,pname,params);}
+    inline void glMultiTexParameterfEXT(GLenum texunit,GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glMultiTexParameterfEXT(texunit,target,pname,param);}
+    inline void glNamedFramebufferTextureLayer(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer){ge::gl::getDefaultDirectContext().glNamedFramebufferTextureLayer(framebuffer,attachment,texture,level,layer);}
+    inline void glGetVertexArrayIntegervEXT(GLuint vaobj,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetVertexArrayIntegervEXT(vaobj,pname,param);}
+    inline void glVertexAttrib3dARB(GLuint index,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexAttrib3dARB(index,x,y,z);}
+    inline GLboolean glVDPAUIsSurfaceNV(GLvdpauSurfaceNV surface){return ge::gl::getDefaultDirectContext().glVDPAUIsSurfaceNV(surface);}
+    inline void glMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,format,type,pixels);}
+    inline GLboolean glIsAsyncMarkerSGIX(GLuint marker){return ge::gl::getDefaultDirectContext().glIsAsyncMarkerSGIX(marker);}
+    inline void glGetDoublei_vEXT(GLenum pname,GLuint index,GLdouble* params){ge::gl::getDefaultDirectContext().glGetDoublei_vEXT(pname,index,params);}
+    inline void glUniform2i64NV(GLint location,GLint64EXT x,GLint64EXT y){ge::gl::getDefaultDirectContext().glUniform2i64NV(location,x,y);}
+    inline GLboolean glIsCommandListNV(GLuint list){return ge::gl::getDefaultDirectContext().glIsCommandListNV(list);}
+    inline void glUniform3uiEXT(GLint location,GLuint v0,GLuint v1,GLuint v2){ge::gl::getDefaultDirectContext().glUniform3uiEXT(location,v0,v1,v2);}
+    inline void glTexParameterIuivEXT(GLenum target,GLenum pname,const GLuint* params){ge::gl::getDefaultDirectContext().glTexParameterIuivEXT(target,pname,params);}
+    inline void glProgramUniformMatrix4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4fv(program,location,count,transpose,value);}
+    inline void glVertex2fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glVertex2fv(v);}
+    inline void glVertexAttribL3dEXT(GLuint index,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexAttribL3dEXT(index,x,y,z);}
+    inline void glFramebufferRenderbuffer(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glFramebufferRenderbuffer(target,attachment,renderbuffertarget,renderbuffer);}
+    inline GLint glGetUniformLocationARB(GLhandleARB programObj,const GLcharARB* name){return ge::gl::getDefaultDirectContext().glGetUniformLocationARB(programObj,name);}
+    inline void glPathParameterfvNV(GLuint path,GLenum pname,const GLfloat* value){ge::gl::getDefaultDirectContext().glPathParameterfvNV(path,pname,value);}
+    inline void glVertexAttrib3sNV(GLuint index,GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glVertexAttrib3sNV(index,x,y,z);}
+    inline void glGetDoublei_v(GLenum target,GLuint index,GLdouble* data){ge::gl::getDefaultDirectContext().glGetDoublei_v(target,index,data);}
+    inline void glVertexAttrib1sv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib1sv(index,v);}
+    inline void glBindSampler(GLuint unit,GLuint sampler){ge::gl::getDefaultDirectContext().glBindSampler(unit,sampler);}
+    inline void glLineWidth(GLfloat width){ge::gl::getDefaultDirectContext().glLineWidth(width);}
+    inline void glVertexArrayRangeAPPLE(GLsizei length,void* pointer){ge::gl::getDefaultDirectContext().glVertexArrayRangeAPPLE(length,pointer);}
+    inline void glBindBufferOffsetEXT(GLenum target,GLuint index,GLuint buffer,GLintptr offset){ge::gl::getDefaultDirectContext().glBindBufferOffsetEXT(target,index,buffer,offset);}
+    inline void glWeightfvARB(GLint size,const GLfloat* weights){ge::gl::getDefaultDirectContext().glWeightfvARB(size,weights);}
+    inline void glGetIntegeri_v(GLenum target,GLuint index,GLint* data){ge::gl::getDefaultDirectContext().glGetIntegeri_v(target,index,data);}
+    inline void glGetTransformFeedbackVarying(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name){ge::gl::getDefaultDirectContext().glGetTransformFeedbackVarying(program,index,bufSize,length,size,type,name);}
+    inline void glProgramLocalParameter4fvARB(GLenum target,GLuint index,const GLfloat* params){ge::gl::getDefaultDirectContext().glProgramLocalParameter4fvARB(target,index,params);}
+    inline void glGetTransformFeedbackVaryingNV(GLuint program,GLuint index,GLint* location){ge::gl::getDefaultDirectContext().glGetTransformFeedbackVaryingNV(program,index,location);}
+    inline void glWindowPos2iv(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos2iv(v);}
+    inline void glVertexStream1dATI(GLenum stream,GLdouble x){ge::gl::getDefaultDirectContext().glVertexStream1dATI(stream,x);}
+    inline void glColorFragmentOp2ATI(GLenum op,GLuint dst,GLuint dstMask,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod){ge::gl::getDefaultDirectContext().glColorFragmentOp2ATI(op,dst,dstMask,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod);}
+    inline void glFogiv(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glFogiv(pname,params);}
+    inline GLuint64 glGetTextureHandleNV(GLuint texture){return ge::gl::getDefaultDirectContext().glGetTextureHandleNV(texture);}
+    inline void glLightModeliv(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glLightModeliv(pname,params);}
+    inline void glDepthRangef(GLfloat n,GLfloat f){ge::gl::getDefaultDirectContext().glDepthRangef(n,f);}
+    inline void glGetFragmentMaterialivSGIX(GLenum face,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFragmentMaterialivSGIX(face,pname,params);}
+    inline void glVideoCaptureStreamParameterfvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glVideoCaptureStreamParameterfvNV(video_capture_slot,stream,pname,params);}
+    inline void glDeleteProgramsARB(GLsizei n,const GLuint* programs){ge::gl::getDefaultDirectContext().glDeleteProgramsARB(n,programs);}
+    inline void glWindowPos3fvARB(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos3fvARB(v);}
+    inline void glFeedbackBufferxOES(GLsizei n,GLenum type,const GLfixed* buffer){ge::gl::getDefaultDirectContext().glFeedbackBufferxOES(n,type,buffer);}
+    inline void glGetTexBumpParameterfvATI(GLenum pname,GLfloat* param){ge::gl::getDefaultDirectContext().glGetTexBumpParameterfvATI(pname,param);}
+    inline void glEnablei(GLenum target,GLuint index){ge::gl::getDefaultDirectContext().glEnablei(target,index);}
+    inline void glGetActiveSubroutineName(GLuint program,GLenum shadertype,GLuint index,GLsizei bufsize,GLsizei* length,GLchar* name){ge::gl::getDefaultDirectContext().glGetActiveSubroutineName(program,shadertype,index,bufsize,length,name);}
+    inline void glDrawBuffersARB(GLsizei n,const GLenum* bufs){ge::gl::getDefaultDirectContext().glDrawBuffersARB(n,bufs);}
+    inline void glBindProgramARB(GLenum target,GLuint program){ge::gl::getDefaultDirectContext().glBindProgramARB(target,program);}
+    inline void glEvalCoord1fv(const GLfloat* u){ge::gl::getDefaultDirectContext().glEvalCoord1fv(u);}
+    inline void glProgramUniform3ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glProgramUniform3ui64vARB(program,location,count,value);}
+    inline void glProgramUniformMatrix2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2dv(program,location,count,transpose,value);}
+    inline void glMultiTexCoord2hvNV(GLenum target,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2hvNV(target,v);}
+    inline void glGetFloatIndexedvEXT(GLenum target,GLuint index,GLfloat* data){ge::gl::getDefaultDirectContext().glGetFloatIndexedvEXT(target,index,data);}
+    inline void glSampleCoverageARB(GLfloat value,GLboolean invert){ge::gl::getDefaultDirectContext().glSampleCoverageARB(value,invert);}
+    inline void glProgramUniform2ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glProgramUniform2ui64vARB(program,location,count,value);}
+    inline void glPixelDataRangeNV(GLenum target,GLsizei length,const void* pointer){ge::gl::getDefaultDirectContext().glPixelDataRangeNV(target,length,pointer);}
+    inline void glVertexStream3svATI(GLenum stream,const GLshort* coords){ge::gl::getDefaultDirectContext().glVertexStream3svATI(stream,coords);}
+    inline void glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc,tc,n,v);}
+    inline void glTexCoord3hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glTexCoord3hvNV(v);}
+    inline void glSampleMaski(GLuint maskNumber,GLbitfield mask){ge::gl::getDefaultDirectContext().glSampleMaski(maskNumber,mask);}
+    inline void glIndexFuncEXT(GLenum func,GLclampf ref){ge::gl::getDefaultDirectContext().glIndexFuncEXT(func,ref);}
+    inline void glPointParameteriNV(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPointParameteriNV(pname,param);}
+    inline void glUniformMatrix3x2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix3x2fv(location,count,transpose,value);}
+    inline void glGetFramebufferParameterivEXT(GLuint framebuffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFramebufferParameterivEXT(framebuffer,pname,params);}
+    inline void glUniform2i64ARB(GLint location,GLint64 x,GLint64 y){ge::gl::getDefaultDirectContext().glUniform2i64ARB(location,x,y);}
+    inline void glNamedBufferStorageEXT(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags){ge::gl::getDefaultDirectContext().glNamedBufferStorageEXT(buffer,size,data,flags);}
+    inline void glNamedFramebufferTexture3DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset){ge::gl::getDefaultDirectContext().glNamedFramebufferTexture3DEXT(framebuffer,attachment,textarget,texture,level,zoffset);}
+    inline void glVertexAttrib2dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib2dv(index,v);}
+    inline void glGetVertexArrayPointervEXT(GLuint vaobj,GLenum pname,void** param){ge::gl::getDefaultDirectContext().glGetVertexArrayPointervEXT(vaobj,pname,param);}
+    inline void glGetVertexAttribArrayObjectivATI(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribArrayObjectivATI(index,pname,params);}
+    inline void glProgramUniformMatrix3fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3fvEXT(program,location,count,transpose,value);}
+    inline void glEnableVertexArrayEXT(GLuint vaobj,GLenum array){ge::gl::getDefaultDirectContext().glEnableVertexArrayEXT(vaobj,array);}
+    inline void glColorTableParameterfvSGI(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glColorTableParameterfvSGI(target,pname,params);}
+    inline void glEdgeFlag(GLboolean flag){ge::gl::getDefaultDirectContext().glEdgeFlag(flag);}
+    inline void glFogCoordf(GLfloat coord){ge::gl::getDefaultDirectContext().glFogCoordf(coord);}
+    inline void glVertex3d(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertex3d(x,y,z);}
+    inline void glVertex3f(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glVertex3f(x,y,z);}
+    inline void glSpriteParameterivSGIX(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glSpriteParameterivSGIX(pname,params);}
+    inline void glPathGlyphRangeNV(GLuint firstPathName,GLenum fontTarget,const void* fontName,GLbitfield fontStyle,GLuint firstGlyph,GLsizei numGlyphs,GLenum handleMissingGlyphs,GLuint pathParameterTemplate,GLfloat emScale){ge::gl::getDefaultDirectContext().glPathGlyphRangeNV(firstPathName,fontTarget,fontName,fontStyle,firstGlyph,numGlyphs,handleMissingGlyphs,pathParameterTemplate,emScale);}
+    inline void glPrimitiveBoundingBoxARB(GLfloat minX,GLfloat minY,GLfloat minZ,GLfloat minW,GLfloat maxX,GLfloat maxY,GLfloat maxZ,GLfloat maxW){ge::gl::getDefaultDirectContext().glPrimitiveBoundingBoxARB(minX,minY,minZ,minW,maxX,maxY,maxZ,maxW);}
+    inline void glVertexAttribL3ui64vNV(GLuint index,const GLuint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL3ui64vNV(index,v);}
+    inline void glVertex3s(GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glVertex3s(x,y,z);}
+    inline void glTexCoordP2ui(GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glTexCoordP2ui(type,coords);}
+    inline void glProgramUniform2fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform2fvEXT(program,location,count,value);}
+    inline void glDeletePathsNV(GLuint path,GLsizei range){ge::gl::getDefaultDirectContext().glDeletePathsNV(path,range);}
+    inline void glPrimitiveRestartIndexNV(GLuint index){ge::gl::getDefaultDirectContext().glPrimitiveRestartIndexNV(index);}
+    inline void glTexCoord2fColor3fVertex3fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord2fColor3fVertex3fvSUN(tc,c,v);}
+    inline void glTexCoordPointerListIBM(GLint size,GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glTexCoordPointerListIBM(size,type,stride,pointer,ptrstride);}
+    inline void glRectxOES(GLfixed x1,GLfixed y1,GLfixed x2,GLfixed y2){ge::gl::getDefaultDirectContext().glRectxOES(x1,y1,x2,y2);}
+    inline void glCopyNamedBufferSubData(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glCopyNamedBufferSubData(readBuffer,writeBuffer,readOffset,writeOffset,size);}
+    inline void glGenProgramsNV(GLsizei n,GLuint* programs){ge::gl::getDefaultDirectContext().glGenProgramsNV(n,programs);}
+    inline void glFragmentLightfSGIX(GLenum light,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glFragmentLightfSGIX(light,pname,param);}
+    inline void glTexStorage3D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glTexStorage3D(target,levels,internalformat,width,height,depth);}
+    inline void glTextureParameteriv(GLuint texture,GLenum pname,const GLint* param){ge::gl::getDefaultDirectContext().glTextureParameteriv(texture,pname,param);}
+    inline void glNamedBufferDataEXT(GLuint buffer,GLsizeiptr size,const void* data,GLenum usage){ge::gl::getDefaultDirectContext().glNamedBufferDataEXT(buffer,size,data,usage);}
+    inline void glImportSemaphoreWin32NameEXT(GLuint semaphore,GLenum handleType,const void* name){ge::gl::getDefaultDirectContext().glImportSemaphoreWin32NameEXT(semaphore,handleType,name);}
+    inline void glMultiTexCoord3fvARB(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3fvARB(target,v);}
+    inline void glUniformMatrix3x4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix3x4fv(location,count,transpose,value);}
+    inline void glSubpixelPrecisionBiasNV(GLuint xbits,GLuint ybits){ge::gl::getDefaultDirectContext().glSubpixelPrecisionBiasNV(xbits,ybits);}
+    inline void glNormalPointer(GLenum type,GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glNormalPointer(type,stride,ptr);}
+    inline void glNamedFramebufferTexture(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glNamedFramebufferTexture(framebuffer,attachment,texture,level);}
+    inline void glVertexAttrib4NsvARB(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NsvARB(index,v);}
+    inline void glPassThrough(GLfloat token){ge::gl::getDefaultDirectContext().glPassThrough(token);}
+    inline void glSecondaryColorP3ui(GLenum type,GLuint color){ge::gl::getDefaultDirectContext().glSecondaryColorP3ui(type,color);}
+    inline void glInvalidateTexSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glInvalidateTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth);}
+    inline GLboolean glIsImageHandleResidentARB(GLuint64 handle){return ge::gl::getDefaultDirectContext().glIsImageHandleResidentARB(handle);}
+    inline void glTangent3fvEXT(const GLfloat* v){ge::gl::getDefaultDirectContext().glTangent3fvEXT(v);}
+    inline void glProgramUniformMatrix4x3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x3fv(program,location,count,transpose,value);}
+    inline void glBegin(GLenum mode){ge::gl::getDefaultDirectContext().glBegin(mode);}
+    inline void glEvalCoord2dv(const GLdouble* u){ge::gl::getDefaultDirectContext().glEvalCoord2dv(u);}
+    inline void glColor3ubv(const GLubyte* v){ge::gl::getDefaultDirectContext().glColor3ubv(v);}
+    inline void glFogCoordfvEXT(const GLfloat* coord){ge::gl::getDefaultDirectContext().glFogCoordfvEXT(coord);}
+    inline void glVertexP3ui(GLenum type,GLuint value){ge::gl::getDefaultDirectContext().glVertexP3ui(type,value);}
+    inline void glLightfv(GLenum light,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glLightfv(light,pname,params);}
+    inline void glVertexAttribL3i64NV(GLuint index,GLint64EXT x,GLint64EXT y,GLint64EXT z){ge::gl::getDefaultDirectContext().glVertexAttribL3i64NV(index,x,y,z);}
+    inline void glStencilClearTagEXT(GLsizei stencilTagBits,GLuint stencilClearTag){ge::gl::getDefaultDirectContext().glStencilClearTagEXT(stencilTagBits,stencilClearTag);}
+    inline void glGetActiveUniformName(GLuint program,GLuint uniformIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformName){ge::gl::getDefaultDirectContext().glGetActiveUniformName(program,uniformIndex,bufSize,length,uniformName);}
+    inline void glTangentPointerEXT(GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glTangentPointerEXT(type,stride,pointer);}
+    inline void glUniform4ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glUniform4ui64vNV(location,count,value);}
+    inline void glDebugMessageEnableAMD(GLenum category,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled){ge::gl::getDefaultDirectContext().glDebugMessageEnableAMD(category,severity,count,ids,enabled);}
+    inline void glProgramUniform2ui(GLuint program,GLint location,GLuint v0,GLuint v1){ge::gl::getDefaultDirectContext().glProgramUniform2ui(program,location,v0,v1);}
+    inline void glCopyTexSubImage2DEXT(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTexSubImage2DEXT(target,level,xoffset,yoffset,x,y,width,height);}
+    inline void glGenRenderbuffersEXT(GLsizei n,GLuint* renderbuffers){ge::gl::getDefaultDirectContext().glGenRenderbuffersEXT(n,renderbuffers);}
+    inline void glNamedProgramLocalParameterI4ivEXT(GLuint program,GLenum target,GLuint index,const GLint* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameterI4ivEXT(program,target,index,params);}
+    inline void glMultiTexCoord2f(GLenum target,GLfloat s,GLfloat t){ge::gl::getDefaultDirectContext().glMultiTexCoord2f(target,s,t);}
+    inline void glMapGrid2d(GLint un,GLdouble u1,GLdouble u2,GLint vn,GLdouble v1,GLdouble v2){ge::gl::getDefaultDirectContext().glMapGrid2d(un,u1,u2,vn,v1,v2);}
+    inline void glGetMultiTexParameterIuivEXT(GLenum texunit,GLenum target,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetMultiTexParameterIuivEXT(texunit,target,pname,params);}
+    inline void glBlendEquationiARB(GLuint buf,GLenum mode){ge::gl::getDefaultDirectContext().glBlendEquationiARB(buf,mode);}
+    inline void glTexParameteriv(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTexParameteriv(target,pname,params);}
+    inline void glUniform4ivARB(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform4ivARB(location,count,value);}
+    inline void glMatrixOrthoEXT(GLenum mode,GLdouble left,GLdouble right,GLdouble bottom,GLdouble top,GLdouble zNear,GLdouble zFar){ge::gl::getDefaultDirectContext().glMatrixOrthoEXT(mode,left,right,bottom,top,zNear,zFar);}
+    inline void glVertexArrayVertexBuffer(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexArrayVertexBuffer(vaobj,bindingindex,buffer,offset,stride);}
+    inline void glProgramLocalParametersI4ivNV(GLenum target,GLuint index,GLsizei count,const GLint* params){ge::gl::getDefaultDirectContext().glProgramLocalParametersI4ivNV(target,index,count,params);}
+    inline void glProgramUniform4ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform4ui64vNV(program,location,count,value);}
+    inline void glGetNamedStringivARB(GLint namelen,const GLchar* name,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedStringivARB(namelen,name,pname,params);}
+    inline void glVertexAttribL1i64vNV(GLuint index,const GLint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL1i64vNV(index,v);}
+    inline void glTransformFeedbackBufferBase(GLuint xfb,GLuint index,GLuint buffer){ge::gl::getDefaultDirectContext().glTransformFeedbackBufferBase(xfb,index,buffer);}
+    inline void glIndexsv(const GLshort* c){ge::gl::getDefaultDirectContext().glIndexsv(c);}
+    inline void glPointParameterivNV(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glPointParameterivNV(pname,params);}
+    inline void glGetDetailTexFuncSGIS(GLenum target,GLfloat* points){ge::gl::getDefaultDirectContext().glGetDetailTexFuncSGIS(target,points);}
+    inline void glReplacementCodeuiColor3fVertex3fvSUN(const GLuint* rc,const GLfloat* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor3fVertex3fvSUN(rc,c,v);}
+    inline void glProgramLocalParameter4fARB(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glProgramLocalParameter4fARB(target,index,x,y,z,w);}
+    inline void glBitmap(GLsizei width,GLsizei height,GLfloat xorig,GLfloat yorig,GLfloat xmove,GLfloat ymove,const GLubyte* bitmap){ge::gl::getDefaultDirectContext().glBitmap(width,height,xorig,yorig,xmove,ymove,bitmap);}
+    inline void glNamedFramebufferTextureLayerEXT(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer){ge::gl::getDefaultDirectContext().glNamedFramebufferTextureLayerEXT(framebuffer,attachment,texture,level,layer);}
+    inline void glMultiTexGenfvEXT(GLenum texunit,GLenum coord,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glMultiTexGenfvEXT(texunit,coord,pname,params);}
+    inline void glGetNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void* data){ge::gl::getDefaultDirectContext().glGetNamedBufferSubData(buffer,offset,size,data);}
+    inline void glStencilFuncSeparateATI(GLenum frontfunc,GLenum backfunc,GLint ref,GLuint mask){ge::gl::getDefaultDirectContext().glStencilFuncSeparateATI(frontfunc,backfunc,ref,mask);}
+    inline void glProgramUniform2iv(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform2iv(program,location,count,value);}
+    inline void glGetQueryiv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetQueryiv(target,pname,params);}
+    inline void glTexCoord4f(GLfloat s,GLfloat t,GLfloat r,GLfloat q){ge::gl::getDefaultDirectContext().glTexCoord4f(s,t,r,q);}
+    inline void glMapGrid2f(GLint un,GLfloat u1,GLfloat u2,GLint vn,GLfloat v1,GLfloat v2){ge::gl::getDefaultDirectContext().glMapGrid2f(un,u1,u2,vn,v1,v2);}
+    inline void glListParameterivSGIX(GLuint list,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glListParameterivSGIX(list,pname,params);}
+    inline void glCreateQueries(GLenum target,GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glCreateQueries(target,n,ids);}
+    inline void glGetSamplerParameterfv(GLuint sampler,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetSamplerParameterfv(sampler,pname,params);}
+    inline void glTexCoord4i(GLint s,GLint t,GLint r,GLint q){ge::gl::getDefaultDirectContext().glTexCoord4i(s,t,r,q);}
+    inline void glObjectLabel(GLenum identifier,GLuint name,GLsizei length,const GLchar* label){ge::gl::getDefaultDirectContext().glObjectLabel(identifier,name,length,label);}
+    inline void glProgramUniform3i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z){ge::gl::getDefaultDirectContext().glProgramUniform3i64NV(program,location,x,y,z);}
+    inline GLuint64 glGetTextureHandleARB(GLuint texture){return ge::gl::getDefaultDirectContext().glGetTextureHandleARB(texture);}
+    inline void glTexCoord4s(GLshort s,GLshort t,GLshort r,GLshort q){ge::gl::getDefaultDirectContext().glTexCoord4s(s,t,r,q);}
+    inline void glUniform4iARB(GLint location,GLint v0,GLint v1,GLint v2,GLint v3){ge::gl::getDefaultDirectContext().glUniform4iARB(location,v0,v1,v2,v3);}
+    inline void glGetUniformIndices(GLuint program,GLsizei uniformCount,const GLchar*const* uniformNames,GLuint* uniformIndices){ge::gl::getDefaultDirectContext().glGetUniformIndices(program,uniformCount,uniformNames,uniformIndices);}
+    inline void glMultiTexImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexImage3DEXT(texunit,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+    inline void glCoverageModulationTableNV(GLsizei n,const GLfloat* v){ge::gl::getDefaultDirectContext().glCoverageModulationTableNV(n,v);}
+    inline void glPointParameteriv(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glPointParameteriv(pname,params);}
+    inline void glMultiTexCoord4svARB(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4svARB(target,v);}
+    inline void glNormal3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glNormal3fv(v);}
+    inline void glProgramUniformMatrix3x4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x4dvEXT(program,location,count,transpose,value);}
+    inline void glTexCoord1fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord1fv(v);}
+    inline void glProgramUniformMatrix4x3dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x3dvEXT(program,location,count,transpose,value);}
+    inline void glGetActiveVaryingNV(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name){ge::gl::getDefaultDirectContext().glGetActiveVaryingNV(program,index,bufSize,length,size,type,name);}
+    inline void glUniform1i64vARB(GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glUniform1i64vARB(location,count,value);}
+    inline void glMultiTexCoord1dv(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1dv(target,v);}
+    inline void glTexCoord3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord3fv(v);}
+    inline void glMatrixTranslatefEXT(GLenum mode,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glMatrixTranslatefEXT(mode,x,y,z);}
+    inline void glProgramUniform1ui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform1ui64vNV(program,location,count,value);}
+    inline void glTextureMaterialEXT(GLenum face,GLenum mode){ge::gl::getDefaultDirectContext().glTextureMaterialEXT(face,mode);}
+    inline void glMultiTexCoordP3uiv(GLenum texture,GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP3uiv(texture,type,coords);}
+    inline void glVertexAttribP3ui(GLuint index,GLenum type,GLboolean normalized,GLuint value){ge::gl::getDefaultDirectContext().glVertexAttribP3ui(index,type,normalized,value);}
+    inline void glInterpolatePathsNV(GLuint resultPath,GLuint pathA,GLuint pathB,GLfloat weight){ge::gl::getDefaultDirectContext().glInterpolatePathsNV(resultPath,pathA,pathB,weight);}
+    inline void glTextureBufferRange(GLuint texture,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glTextureBufferRange(texture,internalformat,buffer,offset,size);}
+    inline void glVertexAttribL2dEXT(GLuint index,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexAttribL2dEXT(index,x,y);}
+    inline void glGetPixelTransformParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetPixelTransformParameterivEXT(target,pname,params);}
+    inline void glTexCoord4xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glTexCoord4xvOES(coords);}
+    inline void glGetVariantBooleanvEXT(GLuint id,GLenum value,GLboolean* data){ge::gl::getDefaultDirectContext().glGetVariantBooleanvEXT(id,value,data);}
+    inline void glDepthRange(GLclampd near_val,GLclampd far_val){ge::gl::getDefaultDirectContext().glDepthRange(near_val,far_val);}
+    inline void glGetVertexAttribdvARB(GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVertexAttribdvARB(index,pname,params);}
+    inline void glGetColorTableParameterfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetColorTableParameterfv(target,pname,params);}
+    inline void glDrawArraysInstancedEXT(GLenum mode,GLint start,GLsizei count,GLsizei primcount){ge::gl::getDefaultDirectContext().glDrawArraysInstancedEXT(mode,start,count,primcount);}
+    inline void glDisableClientStateIndexedEXT(GLenum array,GLuint index){ge::gl::getDefaultDirectContext().glDisableClientStateIndexedEXT(array,index);}
+    inline void glDrawBuffer(GLenum mode){ge::gl::getDefaultDirectContext().glDrawBuffer(mode);}
+    inline void glMultiDrawArraysIndirectBindlessNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei stride,GLint vertexBufferCount){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirectBindlessNV(mode,indirect,drawCount,stride,vertexBufferCount);}
+    inline void glGetnPixelMapusv(GLenum map,GLsizei bufSize,GLushort* values){ge::gl::getDefaultDirectContext().glGetnPixelMapusv(map,bufSize,values);}
+    inline void glRasterPos3fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glRasterPos3fv(v);}
+    inline void glClearBufferuiv(GLenum buffer,GLint drawbuffer,const GLuint* value){ge::gl::getDefaultDirectContext().glClearBufferuiv(buffer,drawbuffer,value);}
+    inline void glGetInternalformati64v(GLenum target,GLenum internalformat,GLenum pname,GLsizei bufSize,GLint64* params){ge::gl::getDefaultDirectContext().glGetInternalformati64v(target,internalformat,pname,bufSize,params);}
+    inline void glShaderSourceARB(GLhandleARB shaderObj,GLsizei count,const GLcharARB** string,const GLint* length){ge::gl::getDefaultDirectContext().glShaderSourceARB(shaderObj,count,string,length);}
+    inline void glShaderOp3EXT(GLenum op,GLuint res,GLuint arg1,GLuint arg2,GLuint arg3){ge::gl::getDefaultDirectContext().glShaderOp3EXT(op,res,arg1,arg2,arg3);}
+    inline void glWindowPos2dvMESA(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos2dvMESA(v);}
+    inline void glClearIndex(GLfloat c){ge::gl::getDefaultDirectContext().glClearIndex(c);}
+    inline void glProvokingVertexEXT(GLenum mode){ge::gl::getDefaultDirectContext().glProvokingVertexEXT(mode);}
+    inline void glVariantubvEXT(GLuint id,const GLubyte* addr){ge::gl::getDefaultDirectContext().glVariantubvEXT(id,addr);}
+    inline void glFlush(){ge::gl::getDefaultDirectContext().glFlush();}
+    inline void glFramebufferTexture2DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTexture2DEXT(target,attachment,textarget,texture,level);}
+    inline void glGetColorTableParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetColorTableParameterivEXT(target,pname,params);}
+    inline void glPresentFrameDualFillNV(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLenum target1,GLuint fill1,GLenum target2,GLuint fill2,GLenum target3,GLuint fill3){ge::gl::getDefaultDirectContext().glPresentFrameDualFillNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,target1,fill1,target2,fill2,target3,fill3);}
+    inline GLuint glGenVertexShadersEXT(GLuint range){return ge::gl::getDefaultDirectContext().glGenVertexShadersEXT(range);}
+    inline void glSpecializeShaderARB(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue){ge::gl::getDefaultDirectContext().glSpecializeShaderARB(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+    inline void glProgramUniformHandleui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* values){ge::gl::getDefaultDirectContext().glProgramUniformHandleui64vARB(program,location,count,values);}
+    inline void glDepthRangefOES(GLclampf n,GLclampf f){ge::gl::getDefaultDirectContext().glDepthRangefOES(n,f);}
+    inline void glDeleteVertexArrays(GLsizei n,const GLuint* arrays){ge::gl::getDefaultDirectContext().glDeleteVertexArrays(n,arrays);}
+    inline void glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex,GLuint baseinstance){ge::gl::getDefaultDirectContext().glDrawElementsInstancedBaseVertexBaseInstance(mode,count,type,indices,instancecount,basevertex,baseinstance);}
+    inline void glGetTexLevelParameteriv(GLenum target,GLint level,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexLevelParameteriv(target,level,pname,params);}
+    inline void glDrawVkImageNV(GLuint64 vkImage,GLuint sampler,GLfloat x0,GLfloat y0,GLfloat x1,GLfloat y1,GLfloat z,GLfloat s0,GLfloat t0,GLfloat s1,GLfloat t1){ge::gl::getDefaultDirectContext().glDrawVkImageNV(vkImage,sampler,x0,y0,x1,y1,z,s0,t0,s1,t1);}
+    inline void glWindowPos3iARB(GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glWindowPos3iARB(x,y,z);}
+    inline void glPrioritizeTextures(GLsizei n,const GLuint* textures,const GLclampf* priorities){ge::gl::getDefaultDirectContext().glPrioritizeTextures(n,textures,priorities);}
+    inline void glWindowPos3fvMESA(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos3fvMESA(v);}
+    inline void glProgramUniformMatrix3x2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x2dvEXT(program,location,count,transpose,value);}
+    inline void glVertex4xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glVertex4xvOES(coords);}
+    inline void glTexStorage3DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTexStorage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+    inline void glWindowPos2sARB(GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glWindowPos2sARB(x,y);}
+    inline void glStencilOpValueAMD(GLenum face,GLuint value){ge::gl::getDefaultDirectContext().glStencilOpValueAMD(face,value);}
+    inline void glProgramVertexLimitNV(GLenum target,GLint limit){ge::gl::getDefaultDirectContext().glProgramVertexLimitNV(target,limit);}
+    inline void glGetTexParameterPointervAPPLE(GLenum target,GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetTexParameterPointervAPPLE(target,pname,params);}
+    inline void glProgramUniform3uivEXT(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform3uivEXT(program,location,count,value);}
+    inline void glClampColor(GLenum target,GLenum clamp){ge::gl::getDefaultDirectContext().glClampColor(target,clamp);}
+    inline void glClearStencil(GLint s){ge::gl::getDefaultDirectContext().glClearStencil(s);}
+    inline void glTexCoordP1uiv(GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glTexCoordP1uiv(type,coords);}
+    inline void glVertexAttribs3svNV(GLuint index,GLsizei count,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribs3svNV(index,count,v);}
+    inline void glMultiTexCoord3fv(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3fv(target,v);}
+    inline void glVertexBlendEnvfATI(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glVertexBlendEnvfATI(pname,param);}
+    inline GLboolean glIsFenceAPPLE(GLuint fence){return ge::gl::getDefaultDirectContext().glIsFenceAPPLE(fence);}
+    inline void glGetBufferParameterui64vNV(GLenum target,GLenum pname,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetBufferParameterui64vNV(target,pname,params);}
+    inline void glVertexAttribI4bvEXT(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttribI4bvEXT(index,v);}
+    inline void glUniform2fARB(GLint location,GLfloat v0,GLfloat v1){ge::gl::getDefaultDirectContext().glUniform2fARB(location,v0,v1);}
+    inline void glStopInstrumentsSGIX(GLint marker){ge::gl::getDefaultDirectContext().glStopInstrumentsSGIX(marker);}
+    inline void glVertexAttrib3fNV(GLuint index,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glVertexAttrib3fNV(index,x,y,z);}
+    inline void glMapVertexAttrib2dAPPLE(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint ustride,GLint uorder,GLdouble v1,GLdouble v2,GLint vstride,GLint vorder,const GLdouble* points){ge::gl::getDefaultDirectContext().glMapVertexAttrib2dAPPLE(index,size,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+    inline void glVertex2f(GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glVertex2f(x,y);}
+    inline void glCopyTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border){ge::gl::getDefaultDirectContext().glCopyTextureImage2DEXT(texture,target,level,internalformat,x,y,width,height,border);}
+    inline void glVertex2d(GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertex2d(x,y);}
+    inline void glSecondaryColor3bvEXT(const GLbyte* v){ge::gl::getDefaultDirectContext().glSecondaryColor3bvEXT(v);}
+    inline void glMultiTexCoord4fARB(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q){ge::gl::getDefaultDirectContext().glMultiTexCoord4fARB(target,s,t,r,q);}
+    inline void glPolygonOffset(GLfloat factor,GLfloat units){ge::gl::getDefaultDirectContext().glPolygonOffset(factor,units);}
+    inline void glTangent3bvEXT(const GLbyte* v){ge::gl::getDefaultDirectContext().glTangent3bvEXT(v);}
+    inline void glHistogram(GLenum target,GLsizei width,GLenum internalformat,GLboolean sink){ge::gl::getDefaultDirectContext().glHistogram(target,width,internalformat,sink);}
+    inline void glGetProgramiv(GLuint program,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramiv(program,pname,params);}
+    inline void glMatrixIndexubvARB(GLint size,const GLubyte* indices){ge::gl::getDefaultDirectContext().glMatrixIndexubvARB(size,indices);}
+    inline void glVertex2s(GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glVertex2s(x,y);}
+    inline void glGetVertexAttribLui64vNV(GLuint index,GLenum pname,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetVertexAttribLui64vNV(index,pname,params);}
+    inline void glGetProgramStringARB(GLenum target,GLenum pname,void* string){ge::gl::getDefaultDirectContext().glGetProgramStringARB(target,pname,string);}
+    inline void glFlushMappedBufferRange(GLenum target,GLintptr offset,GLsizeiptr length){ge::gl::getDefaultDirectContext().glFlushMappedBufferRange(target,offset,length);}
+    inline void glVertexAttribI3uiEXT(GLuint index,GLuint x,GLuint y,GLuint z){ge::gl::getDefaultDirectContext().glVertexAttribI3uiEXT(index,x,y,z);}
+    inline void glLineWidthxOES(GLfixed width){ge::gl::getDefaultDirectContext().glLineWidthxOES(width);}
+    inline void glProgramUniformMatrix2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2fvEXT(program,location,count,transpose,value);}
+    inline void glGetTextureParameterIuivEXT(GLuint texture,GLenum target,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetTextureParameterIuivEXT(texture,target,pname,params);}
+    inline void glGetMultiTexEnvivEXT(GLenum texunit,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMultiTexEnvivEXT(texunit,target,pname,params);}
+    inline void glPixelTexGenParameterivSGIS(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glPixelTexGenParameterivSGIS(pname,params);}
+    inline void glGenQueries(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glGenQueries(n,ids);}
+    inline void glGetPixelMapfv(GLenum map,GLfloat* values){ge::gl::getDefaultDirectContext().glGetPixelMapfv(map,values);}
+    inline void glBlendColorEXT(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha){ge::gl::getDefaultDirectContext().glBlendColorEXT(red,green,blue,alpha);}
+    inline void glResetMinmax(GLenum target){ge::gl::getDefaultDirectContext().glResetMinmax(target);}
+    inline void glGetnUniformivARB(GLuint program,GLint location,GLsizei bufSize,GLint* params){ge::gl::getDefaultDirectContext().glGetnUniformivARB(program,location,bufSize,params);}
+    inline void glVertexBlendARB(GLint count){ge::gl::getDefaultDirectContext().glVertexBlendARB(count);}
+    inline void glVertexAttrib4d(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexAttrib4d(index,x,y,z,w);}
+    inline GLint glGetVaryingLocationNV(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetVaryingLocationNV(program,name);}
+    inline void glGetMapAttribParameterivNV(GLenum target,GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMapAttribParameterivNV(target,index,pname,params);}
+    inline void glTexSubImage3D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexSubImage3D(target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+    inline void glDeleteSamplers(GLsizei count,const GLuint* samplers){ge::gl::getDefaultDirectContext().glDeleteSamplers(count,samplers);}
+    inline void glGetLightxOES(GLenum light,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetLightxOES(light,pname,params);}
+    inline void glGetVertexAttribArrayObjectfvATI(GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVertexAttribArrayObjectfvATI(index,pname,params);}
+    inline void glVertexArrayNormalOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayNormalOffsetEXT(vaobj,buffer,type,stride,offset);}
+    inline void glGetBufferParameterivARB(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetBufferParameterivARB(target,pname,params);}
+    inline void glGetTextureParameterfv(GLuint texture,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTextureParameterfv(texture,pname,params);}
+    inline void glDrawMeshArraysSUN(GLenum mode,GLint first,GLsizei count,GLsizei width){ge::gl::getDefaultDirectContext().glDrawMeshArraysSUN(mode,first,count,width);}
+    inline void glVertexAttrib4dNV(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexAttrib4dNV(index,x,y,z,w);}
+    inline void glGetMultisamplefvNV(GLenum pname,GLuint index,GLfloat* val){ge::gl::getDefaultDirectContext().glGetMultisamplefvNV(pname,index,val);}
+    inline void* glMapObjectBufferATI(GLuint buffer){return ge::gl::getDefaultDirectContext().glMapObjectBufferATI(buffer);}
+    inline void glGetPathCommandsNV(GLuint path,GLubyte* commands){ge::gl::getDefaultDirectContext().glGetPathCommandsNV(path,commands);}
+    inline void glVertexArrayTexCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayTexCoordOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+    inline void glGetHistogram(GLenum target,GLboolean reset,GLenum format,GLenum type,GLvoid* values){ge::gl::getDefaultDirectContext().glGetHistogram(target,reset,format,type,values);}
+    inline void glMatrixMode(GLenum mode){ge::gl::getDefaultDirectContext().glMatrixMode(mode);}
+    inline void glColorFormatNV(GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glColorFormatNV(size,type,stride);}
+    inline void glProgramUniformui64NV(GLuint program,GLint location,GLuint64EXT value){ge::gl::getDefaultDirectContext().glProgramUniformui64NV(program,location,value);}
+    inline void glProgramUniformMatrix4x2fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x2fvEXT(program,location,count,transpose,value);}
+    inline void glLoadMatrixxOES(const GLfixed* m){ge::gl::getDefaultDirectContext().glLoadMatrixxOES(m);}
+    inline void glGetColorTableParameterfvEXT(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetColorTableParameterfvEXT(target,pname,params);}
+    inline void glRasterPos4i(GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glRasterPos4i(x,y,z,w);}
+    inline void glVertexAttribL2i64NV(GLuint index,GLint64EXT x,GLint64EXT y){ge::gl::getDefaultDirectContext().glVertexAttribL2i64NV(index,x,y);}
+    inline void glBindTextures(GLuint first,GLsizei count,const GLuint* textures){ge::gl::getDefaultDirectContext().glBindTextures(first,count,textures);}
+    inline void glMatrixRotatefEXT(GLenum mode,GLfloat angle,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glMatrixRotatefEXT(mode,angle,x,y,z);}
+    inline void glGetClipPlanexOES(GLenum plane,GLfixed* equation){ge::gl::getDefaultDirectContext().glGetClipPlanexOES(plane,equation);}
+    inline void glSecondaryColor3uivEXT(const GLuint* v){ge::gl::getDefaultDirectContext().glSecondaryColor3uivEXT(v);}
+    inline void glGetPerfQueryInfoINTEL(GLuint queryId,GLuint queryNameLength,GLchar* queryName,GLuint* dataSize,GLuint* noCounters,GLuint* noInstances,GLuint* capsMask){ge::gl::getDefaultDirectContext().glGetPerfQueryInfoINTEL(queryId,queryNameLength,queryName,dataSize,noCounters,noInstances,capsMask);}
+    inline void glGetDoublev(GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetDoublev(pname,params);}
+    inline void glBindBufferRangeEXT(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glBindBufferRangeEXT(target,index,buffer,offset,size);}
+    inline void glCompressedTexImage2D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexImage2D(target,level,internalformat,width,height,border,imageSize,data);}
+    inline void* glMapBufferARB(GLenum target,GLenum access){return ge::gl::getDefaultDirectContext().glMapBufferARB(target,access);}
+    inline void glGetPathSpacingNV(GLenum pathListMode,GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLfloat advanceScale,GLfloat kerningScale,GLenum transformType,GLfloat* returnedSpacing){ge::gl::getDefaultDirectContext().glGetPathSpacingNV(pathListMode,numPaths,pathNameType,paths,pathBase,advanceScale,kerningScale,transformType,returnedSpacing);}
+    inline void glUniform4dv(GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniform4dv(location,count,value);}
+    inline void glGlobalAlphaFactordSUN(GLdouble factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactordSUN(factor);}
+    inline void glProgramUniform3dv(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform3dv(program,location,count,value);}
+    inline void glGetShaderSourceARB(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* source){ge::gl::getDefaultDirectContext().glGetShaderSourceARB(obj,maxLength,length,source);}
+    inline void glVertexAttrib3dvARB(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib3dvARB(index,v);}
+    inline void glInvalidateBufferData(GLuint buffer){ge::gl::getDefaultDirectContext().glInvalidateBufferData(buffer);}
+    inline void glMatrixLoad3x2fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixLoad3x2fNV(matrixMode,m);}
+    inline void glCompressedTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage1D(texture,level,xoffset,width,format,imageSize,data);}
+    inline void glTexCoord3xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glTexCoord3xvOES(coords);}
+    inline void glGenTexturesEXT(GLsizei n,GLuint* textures){ge::gl::getDefaultDirectContext().glGenTexturesEXT(n,textures);}
+    inline void glTangent3iEXT(GLint tx,GLint ty,GLint tz){ge::gl::getDefaultDirectContext().glTangent3iEXT(tx,ty,tz);}
+    inline void glClearTexImage(GLuint texture,GLint level,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearTexImage(texture,level,format,type,data);}
+    inline void glBinormal3bvEXT(const GLbyte* v){ge::gl::getDefaultDirectContext().glBinormal3bvEXT(v);}
+    inline void glUniform3fv(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform3fv(location,count,value);}
+    inline void glGetnPixelMapusvARB(GLenum map,GLsizei bufSize,GLushort* values){ge::gl::getDefaultDirectContext().glGetnPixelMapusvARB(map,bufSize,values);}
+    inline void glMemoryObjectParameterivEXT(GLuint memoryObject,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMemoryObjectParameterivEXT(memoryObject,pname,params);}
+    inline void glGenSemaphoresEXT(GLsizei n,GLuint* semaphores){ge::gl::getDefaultDirectContext().glGenSemaphoresEXT(n,semaphores);}
+    inline void glMultiTexCoordP1ui(GLenum texture,GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP1ui(texture,type,coords);}
+    inline void glClearNamedBufferDataEXT(GLuint buffer,GLenum internalformat,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearNamedBufferDataEXT(buffer,internalformat,format,type,data);}
+    inline void glUniformMatrix4dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix4dv(location,count,transpose,value);}
+    inline void glWindowPos3fMESA(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glWindowPos3fMESA(x,y,z);}
+    inline void glDeleteRenderbuffers(GLsizei n,const GLuint* renderbuffers){ge::gl::getDefaultDirectContext().glDeleteRenderbuffers(n,renderbuffers);}
+    inline void glGetTextureLevelParameterfvEXT(GLuint texture,GLenum target,GLint level,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTextureLevelParameterfvEXT(texture,target,level,pname,params);}
+    inline void glGetHistogramParameterxvOES(GLenum target,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetHistogramParameterxvOES(target,pname,params);}
+    inline void glMultiDrawElements(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount){ge::gl::getDefaultDirectContext().glMultiDrawElements(mode,count,type,indices,drawcount);}
+    inline void glMakeImageHandleNonResidentNV(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeImageHandleNonResidentNV(handle);}
+    inline void glTexSubImage1DEXT(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexSubImage1DEXT(target,level,xoffset,width,format,type,pixels);}
+    inline void glNormalStream3dATI(GLenum stream,GLdouble nx,GLdouble ny,GLdouble nz){ge::gl::getDefaultDirectContext().glNormalStream3dATI(stream,nx,ny,nz);}
+    inline void glVertexAttribL4i64vNV(GLuint index,const GLint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL4i64vNV(index,v);}
+    inline void glDrawBuffers(GLsizei n,const GLenum* bufs){ge::gl::getDefaultDirectContext().glDrawBuffers(n,bufs);}
+    inline void glCopyTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyTextureSubImage1DEXT(texture,target,level,xoffset,x,y,width);}
+    inline void glWindowRectanglesEXT(GLenum mode,GLsizei count,const GLint* box){ge::gl::getDefaultDirectContext().glWindowRectanglesEXT(mode,count,box);}
+    inline void glNamedFramebufferReadBuffer(GLuint framebuffer,GLenum src){ge::gl::getDefaultDirectContext().glNamedFramebufferReadBuffer(framebuffer,src);}
+    inline void glUniform2i64vARB(GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glUniform2i64vARB(location,count,value);}
+    inline void glVertexAttribI1uivEXT(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI1uivEXT(index,v);}
+    inline void glGetTexGenfv(GLenum coord,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTexGenfv(coord,pname,params);}
+    inline void glBeginQueryARB(GLenum target,GLuint id){ge::gl::getDefaultDirectContext().glBeginQueryARB(target,id);}
+    inline void glUniform1iARB(GLint location,GLint v0){ge::gl::getDefaultDirectContext().glUniform1iARB(location,v0);}
+    inline void glVertex4bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glVertex4bvOES(coords);}
+    inline void glInvalidateSubFramebuffer(GLenum target,GLsizei numAttachments,const GLenum* attachments,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glInvalidateSubFramebuffer(target,numAttachments,attachments,x,y,width,height);}
+    inline void glUniform1fvARB(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform1fvARB(location,count,value);}
+    inline GLboolean glTestFenceNV(GLuint fence){return ge::gl::getDefaultDirectContext().glTestFenceNV(fence);}
+    inline void glBindTransformFeedback(GLenum target,GLuint id){ge::gl::getDefaultDirectContext().glBindTransformFeedback(target,id);}
+    inline void glMultiTexCoord2iv(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2iv(target,v);}
+    inline void glCopyMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyMultiTexSubImage1DEXT(texunit,target,level,xoffset,x,y,width);}
+    inline void glVariantbvEXT(GLuint id,const GLbyte* addr){ge::gl::getDefaultDirectContext().glVariantbvEXT(id,addr);}
+    inline void glTexCoord1hNV(GLhalfNV s){ge::gl::getDefaultDirectContext().glTexCoord1hNV(s);}
+    inline void glGenFencesNV(GLsizei n,GLuint* fences){ge::gl::getDefaultDirectContext().glGenFencesNV(n,fences);}
+    inline void glRasterPos3iv(const GLint* v){ge::gl::getDefaultDirectContext().glRasterPos3iv(v);}
+    inline void glVertexAttribL2ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y){ge::gl::getDefaultDirectContext().glVertexAttribL2ui64NV(index,x,y);}
+    inline void glMultiTexCoord1hvNV(GLenum target,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1hvNV(target,v);}
+    inline void glGetnConvolutionFilter(GLenum target,GLenum format,GLenum type,GLsizei bufSize,void* image){ge::gl::getDefaultDirectContext().glGetnConvolutionFilter(target,format,type,bufSize,image);}
+    inline void glNormal3bv(const GLbyte* v){ge::gl::getDefaultDirectContext().glNormal3bv(v);}
+    inline void glWeightbvARB(GLint size,const GLbyte* weights){ge::gl::getDefaultDirectContext().glWeightbvARB(size,weights);}
+    inline void glTexCoord4sv(const GLshort* v){ge::gl::getDefaultDirectContext().glTexCoord4sv(v);}
+    inline void glUniform2uiv(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform2uiv(location,count,value);}
+    inline void glBeginConditionalRenderNVX(GLuint id){ge::gl::getDefaultDirectContext().glBeginConditionalRenderNVX(id);}
+    inline void glFinish(){ge::gl::getDefaultDirectContext().glFinish();}
+    inline void glColorTableParameterfv(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glColorTableParameterfv(target,pname,params);}
+    inline void glFragmentCoverageColorNV(GLuint color){ge::gl::getDefaultDirectContext().glFragmentCoverageColorNV(color);}
+    inline void glProgramUniform3ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform3ivEXT(program,location,count,value);}
+    inline void glVertexArrayVertexOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayVertexOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+    inline void glViewportPositionWScaleNV(GLuint index,GLfloat xcoeff,GLfloat ycoeff){ge::gl::getDefaultDirectContext().glViewportPositionWScaleNV(index,xcoeff,ycoeff);}
+    inline void glGetProgramLocalParameterIuivNV(GLenum target,GLuint index,GLuint* params){ge::gl::getDefaultDirectContext().glGetProgramLocalParameterIuivNV(target,index,params);}
+    inline void glReplacementCodeuiTexCoord2fVertex3fvSUN(const GLuint* rc,const GLfloat* tc,const GLfloat* v){ge::gl::getDefaultDirectContext().glReplacementCodeuiTexCoord2fVertex3fvSUN(rc,tc,v);}
+    inline void glUniform1uiv(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform1uiv(location,count,value);}
+    inline void glUniformMatrix2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix2dv(location,count,transpose,value);}
+    inline void glIndexdv(const GLdouble* c){ge::gl::getDefaultDirectContext().glIndexdv(c);}
+    inline void glSecondaryColor3ivEXT(const GLint* v){ge::gl::getDefaultDirectContext().glSecondaryColor3ivEXT(v);}
+    inline void glTexCoord3iv(const GLint* v){ge::gl::getDefaultDirectContext().glTexCoord3iv(v);}
+    inline void glVertexStream4fvATI(GLenum stream,const GLfloat* coords){ge::gl::getDefaultDirectContext().glVertexStream4fvATI(stream,coords);}
+    inline void glDeformationMap3fSGIX(GLenum target,GLfloat u1,GLfloat u2,GLint ustride,GLint uorder,GLfloat v1,GLfloat v2,GLint vstride,GLint vorder,GLfloat w1,GLfloat w2,GLint wstride,GLint worder,const GLfloat* points){ge::gl::getDefaultDirectContext().glDeformationMap3fSGIX(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,w1,w2,wstride,worder,points);}
+    inline void glClearDepth(GLclampd depth){ge::gl::getDefaultDirectContext().glClearDepth(depth);}
+    inline GLuint glGenAsyncMarkersSGIX(GLsizei range){return ge::gl::getDefaultDirectContext().glGenAsyncMarkersSGIX(range);}
+    inline void glDisableIndexedEXT(GLenum target,GLuint index){ge::gl::getDefaultDirectContext().glDisableIndexedEXT(target,index);}
+    inline void glVertexWeightfvEXT(const GLfloat* weight){ge::gl::getDefaultDirectContext().glVertexWeightfvEXT(weight);}
+    inline void glGetProgramLocalParameterIivNV(GLenum target,GLuint index,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramLocalParameterIivNV(target,index,params);}
+    inline void glCompressedTexImage3DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexImage3DARB(target,level,internalformat,width,height,depth,border,imageSize,data);}
+    inline void glProgramParameter4fNV(GLenum target,GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glProgramParameter4fNV(target,index,x,y,z,w);}
+    inline void glConvolutionParameterxOES(GLenum target,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glConvolutionParameterxOES(target,pname,param);}
+    inline void glInsertComponentEXT(GLuint res,GLuint src,GLuint num){ge::gl::getDefaultDirectContext().glInsertComponentEXT(res,src,num);}
+    inline void glCreateTextures(GLenum target,GLsizei n,GLuint* textures){ge::gl::getDefaultDirectContext().glCreateTextures(target,n,textures);}
+    inline void glSecondaryColor3iv(const GLint* v){ge::gl::getDefaultDirectContext().glSecondaryColor3iv(v);}
+    inline void glCreateBuffers(GLsizei n,GLuint* buffers){ge::gl::getDefaultDirectContext().glCreateBuffers(n,buffers);}
+    inline void glMultiTexCoord2xvOES(GLenum texture,const GLfixed* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord2xvOES(texture,coords);}
+    inline void glTexGenxvOES(GLenum coord,GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glTexGenxvOES(coord,pname,params);}
+    inline void glMultTransposeMatrixf(const GLfloat m[16]){ge::gl::getDefaultDirectContext().glMultTransposeMatrixf(m);}
+    inline void glBeginTransformFeedbackEXT(GLenum primitiveMode){ge::gl::getDefaultDirectContext().glBeginTransformFeedbackEXT(primitiveMode);}
+    inline void glTexCoord2fColor3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTexCoord2fColor3fVertex3fSUN(s,t,r,g,b,x,y,z);}
+    inline void glNormal3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glNormal3sv(v);}
+    inline void glFreeObjectBufferATI(GLuint buffer){ge::gl::getDefaultDirectContext().glFreeObjectBufferATI(buffer);}
+    inline void glBlendBarrierNV(){ge::gl::getDefaultDirectContext().glBlendBarrierNV();}
+    inline void glUniform4i64vNV(GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glUniform4i64vNV(location,count,value);}
+    inline void glGetnUniformuivARB(GLuint program,GLint location,GLsizei bufSize,GLuint* params){ge::gl::getDefaultDirectContext().glGetnUniformuivARB(program,location,bufSize,params);}
+    inline void glAlphaFragmentOp3ATI(GLenum op,GLuint dst,GLuint dstMod,GLuint arg1,GLuint arg1Rep,GLuint arg1Mod,GLuint arg2,GLuint arg2Rep,GLuint arg2Mod,GLuint arg3,GLuint arg3Rep,GLuint arg3Mod){ge::gl::getDefaultDirectContext().glAlphaFragmentOp3ATI(op,dst,dstMod,arg1,arg1Rep,arg1Mod,arg2,arg2Rep,arg2Mod,arg3,arg3Rep,arg3Mod);}
+    inline void glProgramEnvParameters4fvEXT(GLenum target,GLuint index,GLsizei count,const GLfloat* params){ge::gl::getDefaultDirectContext().glProgramEnvParameters4fvEXT(target,index,count,params);}
+    inline void glBlendFuncSeparateEXT(GLenum sfactorRGB,GLenum dfactorRGB,GLenum sfactorAlpha,GLenum dfactorAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparateEXT(sfactorRGB,dfactorRGB,sfactorAlpha,dfactorAlpha);}
+    inline void glConvolutionParameterivEXT(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glConvolutionParameterivEXT(target,pname,params);}
+    inline void glPixelTexGenSGIX(GLenum mode){ge::gl::getDefaultDirectContext().glPixelTexGenSGIX(mode);}
+    inline void glDeleteProgram(GLuint program){ge::gl::getDefaultDirectContext().glDeleteProgram(program);}
+    inline void glUniformMatrix4x3dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix4x3dv(location,count,transpose,value);}
+    inline void glGetVideoCaptureStreamivNV(GLuint video_capture_slot,GLuint stream,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVideoCaptureStreamivNV(video_capture_slot,stream,pname,params);}
+    inline void glProgramUniform4uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2,GLuint v3){ge::gl::getDefaultDirectContext().glProgramUniform4uiEXT(program,location,v0,v1,v2,v3);}
+    inline void glMakeImageHandleNonResidentARB(GLuint64 handle){ge::gl::getDefaultDirectContext().glMakeImageHandleNonResidentARB(handle);}
+    inline void glSecondaryColor3dEXT(GLdouble red,GLdouble green,GLdouble blue){ge::gl::getDefaultDirectContext().glSecondaryColor3dEXT(red,green,blue);}
+    inline void glDeleteQueries(GLsizei n,const GLuint* ids){ge::gl::getDefaultDirectContext().glDeleteQueries(n,ids);}
+    inline void glNormalP3uiv(GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glNormalP3uiv(type,coords);}
+    inline void glRasterPos2d(GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glRasterPos2d(x,y);}
+    inline void glInitNames(){ge::gl::getDefaultDirectContext().glInitNames();}
+    inline void glBinormal3fvEXT(const GLfloat* v){ge::gl::getDefaultDirectContext().glBinormal3fvEXT(v);}
+    inline void glColor3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glColor3dv(v);}
+    inline void glVertexArrayVertexAttribDivisorEXT(GLuint vaobj,GLuint index,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribDivisorEXT(vaobj,index,divisor);}
+    inline void glArrayElementEXT(GLint i){ge::gl::getDefaultDirectContext().glArrayElementEXT(i);}
+    inline void glProgramParameter4dNV(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glProgramParameter4dNV(target,index,x,y,z,w);}
+    inline void glIndexxOES(GLfixed component){ge::gl::getDefaultDirectContext().glIndexxOES(component);}
+    inline void glUniform3uivEXT(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform3uivEXT(location,count,value);}
+    inline void glPopGroupMarkerEXT(){ge::gl::getDefaultDirectContext().glPopGroupMarkerEXT();}
+    inline void glClearNamedFramebufferuiv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLuint* value){ge::gl::getDefaultDirectContext().glClearNamedFramebufferuiv(framebuffer,buffer,drawbuffer,value);}
+    inline void glSetLocalConstantEXT(GLuint id,GLenum type,const void* addr){ge::gl::getDefaultDirectContext().glSetLocalConstantEXT(id,type,addr);}
+    inline void glProgramUniform1ui64NV(GLuint program,GLint location,GLuint64EXT x){ge::gl::getDefaultDirectContext().glProgramUniform1ui64NV(program,location,x);}
+    inline void glColor4hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glColor4hvNV(v);}
+    inline void glGetVertexAttribfv(GLuint index,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVertexAttribfv(index,pname,params);}
+    inline void glDispatchCompute(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z){ge::gl::getDefaultDirectContext().glDispatchCompute(num_groups_x,num_groups_y,num_groups_z);}
+    inline void glGetActiveAttrib(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLint* size,GLenum* type,GLchar* name){ge::gl::getDefaultDirectContext().glGetActiveAttrib(program,index,bufSize,length,size,type,name);}
+    inline void glFragmentColorMaterialSGIX(GLenum face,GLenum mode){ge::gl::getDefaultDirectContext().glFragmentColorMaterialSGIX(face,mode);}
+    inline void glTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexSubImage2D(target,level,xoffset,yoffset,width,height,format,type,pixels);}
+    inline void glGetnMinmaxARB(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values){ge::gl::getDefaultDirectContext().glGetnMinmaxARB(target,reset,format,type,bufSize,values);}
+    inline void glLogicOp(GLenum opcode){ge::gl::getDefaultDirectContext().glLogicOp(opcode);}
+    inline void glProgramUniformMatrix3x4fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x4fv(program,location,count,transpose,value);}
+    inline void glWindowPos4iMESA(GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glWindowPos4iMESA(x,y,z,w);}
+    inline void glPixelTransferf(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPixelTransferf(pname,param);}
+    inline void glGetTextureParameterIuiv(GLuint texture,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetTextureParameterIuiv(texture,pname,params);}
+    inline void glMultiTexCoord1xOES(GLenum texture,GLfixed s){ge::gl::getDefaultDirectContext().glMultiTexCoord1xOES(texture,s);}
+    inline void glProgramUniformMatrix4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4dv(program,location,count,transpose,value);}
+    inline void glGetnUniformiv(GLuint program,GLint location,GLsizei bufSize,GLint* params){ge::gl::getDefaultDirectContext().glGetnUniformiv(program,location,bufSize,params);}
+    inline void glFramebufferTexture1DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTexture1DEXT(target,attachment,textarget,texture,level);}
+    inline void glVertexPointervINTEL(GLint size,GLenum type,const void** pointer){ge::gl::getDefaultDirectContext().glVertexPointervINTEL(size,type,pointer);}
+    inline void glTextureParameterIiv(GLuint texture,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTextureParameterIiv(texture,pname,params);}
+    inline void glGetSeparableFilterEXT(GLenum target,GLenum format,GLenum type,void* row,void* column,void* span){ge::gl::getDefaultDirectContext().glGetSeparableFilterEXT(target,format,type,row,column,span);}
+    inline void glMultiTexCoord3iARB(GLenum target,GLint s,GLint t,GLint r){ge::gl::getDefaultDirectContext().glMultiTexCoord3iARB(target,s,t,r);}
+    inline void glRasterPos4xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glRasterPos4xvOES(coords);}
+    inline void glDrawTransformFeedbackStream(GLenum mode,GLuint id,GLuint stream){ge::gl::getDefaultDirectContext().glDrawTransformFeedbackStream(mode,id,stream);}
+    inline void glVertex3hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertex3hvNV(v);}
+    inline void glVertexArrayMultiTexCoordOffsetEXT(GLuint vaobj,GLuint buffer,GLenum texunit,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayMultiTexCoordOffsetEXT(vaobj,buffer,texunit,size,type,stride,offset);}
+    inline void glProvokingVertex(GLenum mode){ge::gl::getDefaultDirectContext().glProvokingVertex(mode);}
+    inline void glAccumxOES(GLenum op,GLfixed value){ge::gl::getDefaultDirectContext().glAccumxOES(op,value);}
+    inline void glShaderBinary(GLsizei count,const GLuint* shaders,GLenum binaryformat,const void* binary,GLsizei length){ge::gl::getDefaultDirectContext().glShaderBinary(count,shaders,binaryformat,binary,length);}
+    inline void glGetMultiTexGenivEXT(GLenum texunit,GLenum coord,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMultiTexGenivEXT(texunit,coord,pname,params);}
+    inline void glPointParameterxvOES(GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glPointParameterxvOES(pname,params);}
+    inline void glCreateStatesNV(GLsizei n,GLuint* states){ge::gl::getDefaultDirectContext().glCreateStatesNV(n,states);}
+    inline void glClearDepthdNV(GLdouble depth){ge::gl::getDefaultDirectContext().glClearDepthdNV(depth);}
+    inline void glClearColorIuiEXT(GLuint red,GLuint green,GLuint blue,GLuint alpha){ge::gl::getDefaultDirectContext().glClearColorIuiEXT(red,green,blue,alpha);}
+    inline void glBindMultiTextureEXT(GLenum texunit,GLenum target,GLuint texture){ge::gl::getDefaultDirectContext().glBindMultiTextureEXT(texunit,target,texture);}
+    inline void glTexGeniv(GLenum coord,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTexGeniv(coord,pname,params);}
+    inline void glDrawElements(GLenum mode,GLsizei count,GLenum type,const GLvoid* indices){ge::gl::getDefaultDirectContext().glDrawElements(mode,count,type,indices);}
+    inline void glProgramUniform4iv(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform4iv(program,location,count,value);}
+    inline void glDisableVertexArrayEXT(GLuint vaobj,GLenum array){ge::gl::getDefaultDirectContext().glDisableVertexArrayEXT(vaobj,array);}
+    inline void glProgramUniform3ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z){ge::gl::getDefaultDirectContext().glProgramUniform3ui64NV(program,location,x,y,z);}
+    inline void glClientActiveTexture(GLenum texture){ge::gl::getDefaultDirectContext().glClientActiveTexture(texture);}
+    inline void glMultiTexParameterIivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMultiTexParameterIivEXT(texunit,target,pname,params);}
+    inline void glUniform1i64ARB(GLint location,GLint64 x){ge::gl::getDefaultDirectContext().glUniform1i64ARB(location,x);}
+    inline void glUniform1iv(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform1iv(location,count,value);}
+    inline void glMulticastBarrierNV(){ge::gl::getDefaultDirectContext().glMulticastBarrierNV();}
+    inline void glVertexAttribArrayObjectATI(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,GLuint buffer,GLuint offset){ge::gl::getDefaultDirectContext().glVertexAttribArrayObjectATI(index,size,type,normalized,stride,buffer,offset);}
+    inline void glUniform2iARB(GLint location,GLint v0,GLint v1){ge::gl::getDefaultDirectContext().glUniform2iARB(location,v0,v1);}
+    inline void glDrawArraysInstanced(GLenum mode,GLint first,GLsizei count,GLsizei instancecount){ge::gl::getDefaultDirectContext().glDrawArraysInstanced(mode,first,count,instancecount);}
+    inline void glVertexAttrib2sNV(GLuint index,GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glVertexAttrib2sNV(index,x,y);}
+    inline void glTexBufferEXT(GLenum target,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glTexBufferEXT(target,internalformat,buffer);}
+    inline void glVertexStream2fATI(GLenum stream,GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glVertexStream2fATI(stream,x,y);}
+    inline void glDebugMessageCallbackAMD(GLDEBUGPROCAMD callback,void* userParam){ge::gl::getDefaultDirectContext().glDebugMessageCallbackAMD(callback,userParam);}
+    inline void glSamplerParameteriv(GLuint sampler,GLenum pname,const GLint* param){ge::gl::getDefaultDirectContext().glSamplerParameteriv(sampler,pname,param);}
+    inline void glVertexAttrib4uiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4uiv(index,v);}
+    inline void glEndQueryIndexed(GLenum target,GLuint index){ge::gl::getDefaultDirectContext().glEndQueryIndexed(target,index);}
+    inline void glNormalStream3sATI(GLenum stream,GLshort nx,GLshort ny,GLshort nz){ge::gl::getDefaultDirectContext().glNormalStream3sATI(stream,nx,ny,nz);}
+    inline void glProgramParameteriARB(GLuint program,GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glProgramParameteriARB(program,pname,value);}
+    inline void glTexEnvxOES(GLenum target,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glTexEnvxOES(target,pname,param);}
+    inline void glProgramUniform1iv(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform1iv(program,location,count,value);}
+    inline void glDisableVertexAttribAPPLE(GLuint index,GLenum pname){ge::gl::getDefaultDirectContext().glDisableVertexAttribAPPLE(index,pname);}
+    inline void glBindRenderbuffer(GLenum target,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glBindRenderbuffer(target,renderbuffer);}
+    inline void glMultiTexSubImage3DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glMultiTexSubImage3DEXT(texunit,target,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+    inline GLboolean glIsProgram(GLuint program){return ge::gl::getDefaultDirectContext().glIsProgram(program);}
+    inline void glMultiDrawElementsIndirectAMD(GLenum mode,GLenum type,const void* indirect,GLsizei primcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirectAMD(mode,type,indirect,primcount,stride);}
+    inline void glGetProgramInfoLog(GLuint program,GLsizei bufSize,GLsizei* length,GLchar* infoLog){ge::gl::getDefaultDirectContext().glGetProgramInfoLog(program,bufSize,length,infoLog);}
+    inline void glGetLocalConstantBooleanvEXT(GLuint id,GLenum value,GLboolean* data){ge::gl::getDefaultDirectContext().glGetLocalConstantBooleanvEXT(id,value,data);}
+    inline void glPixelTransformParameteriEXT(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPixelTransformParameteriEXT(target,pname,param);}
+    inline void glTexCoord4bOES(GLbyte s,GLbyte t,GLbyte r,GLbyte q){ge::gl::getDefaultDirectContext().glTexCoord4bOES(s,t,r,q);}
+    inline void glVertexAttrib4fv(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib4fv(index,v);}
+    inline void glProgramUniformMatrix2x3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x3dv(program,location,count,transpose,value);}
+    inline void glProgramEnvParametersI4uivNV(GLenum target,GLuint index,GLsizei count,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramEnvParametersI4uivNV(target,index,count,params);}
+    inline void glTexCoord3xOES(GLfixed s,GLfixed t,GLfixed r){ge::gl::getDefaultDirectContext().glTexCoord3xOES(s,t,r);}
+    inline void glLoadTransposeMatrixfARB(const GLfloat* m){ge::gl::getDefaultDirectContext().glLoadTransposeMatrixfARB(m);}
+    inline void glImageTransformParameteriHP(GLenum target,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glImageTransformParameteriHP(target,pname,param);}
+    inline void glMultiTexCoord4xOES(GLenum texture,GLfixed s,GLfixed t,GLfixed r,GLfixed q){ge::gl::getDefaultDirectContext().glMultiTexCoord4xOES(texture,s,t,r,q);}
+    inline void glVertexAttribs3fvNV(GLuint index,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttribs3fvNV(index,count,v);}
+    inline void glVertexAttrib2fv(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib2fv(index,v);}
+    inline void glUniform3ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z){ge::gl::getDefaultDirectContext().glUniform3ui64NV(location,x,y,z);}
+    inline void glCombinerParameterfvNV(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glCombinerParameterfvNV(pname,params);}
+    inline void glFragmentMaterialiSGIX(GLenum face,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glFragmentMaterialiSGIX(face,pname,param);}
+    inline void glGetBooleani_v(GLenum target,GLuint index,GLboolean* data){ge::gl::getDefaultDirectContext().glGetBooleani_v(target,index,data);}
+    inline GLuint glGetProgramResourceIndex(GLuint program,GLenum programInterface,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetProgramResourceIndex(program,programInterface,name);}
+    inline void glBeginConditionalRenderNV(GLuint id,GLenum mode){ge::gl::getDefaultDirectContext().glBeginConditionalRenderNV(id,mode);}
+    inline void glDisableClientState(GLenum cap){ge::gl::getDefaultDirectContext().glDisableClientState(cap);}
+    inline void glPathFogGenNV(GLenum genMode){ge::gl::getDefaultDirectContext().glPathFogGenNV(genMode);}
+    inline void glStencilThenCoverFillPathNV(GLuint path,GLenum fillMode,GLuint mask,GLenum coverMode){ge::gl::getDefaultDirectContext().glStencilThenCoverFillPathNV(path,fillMode,mask,coverMode);}
+    inline void glVertexArrayIndexOffsetEXT(GLuint vaobj,GLuint buffer,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayIndexOffsetEXT(vaobj,buffer,type,stride,offset);}
+    inline void glProgramBufferParametersIuivNV(GLenum target,GLuint bindingIndex,GLuint wordIndex,GLsizei count,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramBufferParametersIuivNV(target,bindingIndex,wordIndex,count,params);}
+    inline void glPixelTransformParameterivEXT(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glPixelTransformParameterivEXT(target,pname,params);}
+    inline void glDisableClientStateiEXT(GLenum array,GLuint index){ge::gl::getDefaultDirectContext().glDisableClientStateiEXT(array,index);}
+    inline void glTexBufferARB(GLenum target,GLenum internalformat,GLuint buffer){ge::gl::getDefaultDirectContext().glTexBufferARB(target,internalformat,buffer);}
+    inline void glGetLocalConstantIntegervEXT(GLuint id,GLenum value,GLint* data){ge::gl::getDefaultDirectContext().glGetLocalConstantIntegervEXT(id,value,data);}
+    inline void glColor4uiv(const GLuint* v){ge::gl::getDefaultDirectContext().glColor4uiv(v);}
+    inline void glProgramUniform3i(GLuint program,GLint location,GLint v0,GLint v1,GLint v2){ge::gl::getDefaultDirectContext().glProgramUniform3i(program,location,v0,v1,v2);}
+    inline void glMultiDrawElementsIndirectBindlessCountNV(GLenum mode,GLenum type,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirectBindlessCountNV(mode,type,indirect,drawCount,maxDrawCount,stride,vertexBufferCount);}
+    inline void glGetBufferPointervARB(GLenum target,GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetBufferPointervARB(target,pname,params);}
+    inline void glMultiTexParameterIuivEXT(GLenum texunit,GLenum target,GLenum pname,const GLuint* params){ge::gl::getDefaultDirectContext().glMultiTexParameterIuivEXT(texunit,target,pname,params);}
+    inline void glEvalMesh2(GLenum mode,GLint i1,GLint i2,GLint j1,GLint j2){ge::gl::getDefaultDirectContext().glEvalMesh2(mode,i1,i2,j1,j2);}
+    inline void glEvalMesh1(GLenum mode,GLint i1,GLint i2){ge::gl::getDefaultDirectContext().glEvalMesh1(mode,i1,i2);}
+    inline void glProgramUniform3f(GLuint program,GLint location,GLfloat v0,GLfloat v1,GLfloat v2){ge::gl::getDefaultDirectContext().glProgramUniform3f(program,location,v0,v1,v2);}
+    inline void glStencilThenCoverFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum coverMode,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glStencilThenCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,coverMode,transformType,transformValues);}
+    inline void glProgramUniform3d(GLuint program,GLint location,GLdouble v0,GLdouble v1,GLdouble v2){ge::gl::getDefaultDirectContext().glProgramUniform3d(program,location,v0,v1,v2);}
+    inline void glMapVertexAttrib1dAPPLE(GLuint index,GLuint size,GLdouble u1,GLdouble u2,GLint stride,GLint order,const GLdouble* points){ge::gl::getDefaultDirectContext().glMapVertexAttrib1dAPPLE(index,size,u1,u2,stride,order,points);}
+    inline void glEvalCoord2fv(const GLfloat* u){ge::gl::getDefaultDirectContext().glEvalCoord2fv(u);}
+    inline void glGetUniformivARB(GLhandleARB programObj,GLint location,GLint* params){ge::gl::getDefaultDirectContext().glGetUniformivARB(programObj,location,params);}
+    inline void glLoadTransposeMatrixd(const GLdouble m[16]){ge::gl::getDefaultDirectContext().glLoadTransposeMatrixd(m);}
+    inline void glLoadTransposeMatrixf(const GLfloat m[16]){ge::gl::getDefaultDirectContext().glLoadTransposeMatrixf(m);}
+    inline void glGetPointervEXT(GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetPointervEXT(pname,params);}
+    inline void glSignalVkSemaphoreNV(GLuint64 vkSemaphore){ge::gl::getDefaultDirectContext().glSignalVkSemaphoreNV(vkSemaphore);}
+    inline void glEndConditionalRenderNV(){ge::gl::getDefaultDirectContext().glEndConditionalRenderNV();}
+    inline void glTexCoord2fNormal3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTexCoord2fNormal3fVertex3fSUN(s,t,nx,ny,nz,x,y,z);}
+    inline void glUniform3i64vARB(GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glUniform3i64vARB(location,count,value);}
+    inline void glProgramUniform2uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1){ge::gl::getDefaultDirectContext().glProgramUniform2uiEXT(program,location,v0,v1);}
+    inline void glVertexAttribI1ui(GLuint index,GLuint x){ge::gl::getDefaultDirectContext().glVertexAttribI1ui(index,x);}
+    inline void glProgramNamedParameter4dvNV(GLuint id,GLsizei len,const GLubyte* name,const GLdouble* v){ge::gl::getDefaultDirectContext().glProgramNamedParameter4dvNV(id,len,name,v);}
+    inline void glCompileCommandListNV(GLuint list){ge::gl::getDefaultDirectContext().glCompileCommandListNV(list);}
+    inline void glGetRenderbufferParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetRenderbufferParameterivEXT(target,pname,params);}
+    inline void glGetnPolygonStipple(GLsizei bufSize,GLubyte* pattern){ge::gl::getDefaultDirectContext().glGetnPolygonStipple(bufSize,pattern);}
+    inline GLboolean glIsBufferResidentNV(GLenum target){return ge::gl::getDefaultDirectContext().glIsBufferResidentNV(target);}
+    inline void glSecondaryColor3ubvEXT(const GLubyte* v){ge::gl::getDefaultDirectContext().glSecondaryColor3ubvEXT(v);}
+    inline void glGetNamedRenderbufferParameterivEXT(GLuint renderbuffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedRenderbufferParameterivEXT(renderbuffer,pname,params);}
+    inline void glNamedFramebufferSampleLocationsfvARB(GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glNamedFramebufferSampleLocationsfvARB(framebuffer,start,count,v);}
+    inline void glMultiTexGendvEXT(GLenum texunit,GLenum coord,GLenum pname,const GLdouble* params){ge::gl::getDefaultDirectContext().glMultiTexGendvEXT(texunit,coord,pname,params);}
+    inline void glVertexArrayRangeNV(GLsizei length,const void* pointer){ge::gl::getDefaultDirectContext().glVertexArrayRangeNV(length,pointer);}
+    inline GLboolean glIsTextureHandleResidentNV(GLuint64 handle){return ge::gl::getDefaultDirectContext().glIsTextureHandleResidentNV(handle);}
+    inline void glGetProgramEnvParameterdvARB(GLenum target,GLuint index,GLdouble* params){ge::gl::getDefaultDirectContext().glGetProgramEnvParameterdvARB(target,index,params);}
+    inline GLboolean glIsNamedStringARB(GLint namelen,const GLchar* name){return ge::gl::getDefaultDirectContext().glIsNamedStringARB(namelen,name);}
+    inline void glSecondaryColorFormatNV(GLint size,GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glSecondaryColorFormatNV(size,type,stride);}
+    inline void glVertexAttrib4ubvNV(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4ubvNV(index,v);}
+    inline void glTagSampleBufferSGIX(){ge::gl::getDefaultDirectContext().glTagSampleBufferSGIX();}
+    inline void glVDPAUUnregisterSurfaceNV(GLvdpauSurfaceNV surface){ge::gl::getDefaultDirectContext().glVDPAUUnregisterSurfaceNV(surface);}
+    inline void glGetPerfQueryIdByNameINTEL(GLchar* queryName,GLuint* queryId){ge::gl::getDefaultDirectContext().glGetPerfQueryIdByNameINTEL(queryName,queryId);}
+    inline void glGetInteger64v(GLenum pname,GLint64* data){ge::gl::getDefaultDirectContext().glGetInteger64v(pname,data);}
+    inline void glClipPlane(GLenum plane,const GLdouble* equation){ge::gl::getDefaultDirectContext().glClipPlane(plane,equation);}
+    inline void glColor4ubVertex3fSUN(GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glColor4ubVertex3fSUN(r,g,b,a,x,y,z);}
+    inline void glIndexub(GLubyte c){ge::gl::getDefaultDirectContext().glIndexub(c);}
+    inline void glGetProgramEnvParameterfvARB(GLenum target,GLuint index,GLfloat* params){ge::gl::getDefaultDirectContext().glGetProgramEnvParameterfvARB(target,index,params);}
+    inline void glVertexAttrib4usvARB(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4usvARB(index,v);}
+    inline void glNamedFramebufferRenderbuffer(GLuint framebuffer,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glNamedFramebufferRenderbuffer(framebuffer,attachment,renderbuffertarget,renderbuffer);}
+    inline void glProgramUniformMatrix3x4dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x4dv(program,location,count,transpose,value);}
+    inline GLboolean glTestFenceAPPLE(GLuint fence){return ge::gl::getDefaultDirectContext().glTestFenceAPPLE(fence);}
+    inline void glVertexAttrib4Niv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Niv(index,v);}
+    inline void glVertexAttribL2i64vNV(GLuint index,const GLint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL2i64vNV(index,v);}
+    inline void glColorP4uiv(GLenum type,const GLuint* color){ge::gl::getDefaultDirectContext().glColorP4uiv(type,color);}
+    inline void glUniformMatrix2x3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix2x3fv(location,count,transpose,value);}
+    inline void glCallCommandListNV(GLuint list){ge::gl::getDefaultDirectContext().glCallCommandListNV(list);}
+    inline void glClearBufferiv(GLenum buffer,GLint drawbuffer,const GLint* value){ge::gl::getDefaultDirectContext().glClearBufferiv(buffer,drawbuffer,value);}
+    inline void glNamedStringARB(GLenum type,GLint namelen,const GLchar* name,GLint stringlen,const GLchar* string){ge::gl::getDefaultDirectContext().glNamedStringARB(type,namelen,name,stringlen,string);}
+    inline void glMatrixMult3x2fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixMult3x2fNV(matrixMode,m);}
+    inline void glGetNamedProgramStringEXT(GLuint program,GLenum target,GLenum pname,void* string){ge::gl::getDefaultDirectContext().glGetNamedProgramStringEXT(program,target,pname,string);}
+    inline void glGetnHistogramARB(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values){ge::gl::getDefaultDirectContext().glGetnHistogramARB(target,reset,format,type,bufSize,values);}
+    inline void glGetTextureLevelParameterfv(GLuint texture,GLint level,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTextureLevelParameterfv(texture,level,pname,params);}
+    inline void glMultiTexCoord1fv(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1fv(target,v);}
+    inline void glBitmapxOES(GLsizei width,GLsizei height,GLfixed xorig,GLfixed yorig,GLfixed xmove,GLfixed ymove,const GLubyte* bitmap){ge::gl::getDefaultDirectContext().glBitmapxOES(width,height,xorig,yorig,xmove,ymove,bitmap);}
+    inline void glGetSamplerParameterIuiv(GLuint sampler,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetSamplerParameterIuiv(sampler,pname,params);}
+    inline void glTexCoordP3ui(GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glTexCoordP3ui(type,coords);}
+    inline void glTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage1D(texture,level,xoffset,width,format,type,pixels);}
+    inline void glVertexAttribLPointerEXT(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribLPointerEXT(index,size,type,stride,pointer);}
+    inline void glFogCoordPointerEXT(GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glFogCoordPointerEXT(type,stride,pointer);}
+    inline void glWindowPos3s(GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glWindowPos3s(x,y,z);}
+    inline void glVertexAttribs2svNV(GLuint index,GLsizei count,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribs2svNV(index,count,v);}
+    inline void glTextureImage3DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,format,type,pixels);}
+    inline void glWindowPos3i(GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glWindowPos3i(x,y,z);}
+    inline void glWindowPos3d(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glWindowPos3d(x,y,z);}
+    inline void glWindowPos3f(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glWindowPos3f(x,y,z);}
+    inline GLboolean glIsEnabledIndexedEXT(GLenum target,GLuint index){return ge::gl::getDefaultDirectContext().glIsEnabledIndexedEXT(target,index);}
+    inline void glGetNamedProgramivEXT(GLuint program,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedProgramivEXT(program,target,pname,params);}
+    inline void glVertex3xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glVertex3xvOES(coords);}
+    inline void glColor3us(GLushort red,GLushort green,GLushort blue){ge::gl::getDefaultDirectContext().glColor3us(red,green,blue);}
+    inline void glBeginPerfMonitorAMD(GLuint monitor){ge::gl::getDefaultDirectContext().glBeginPerfMonitorAMD(monitor);}
+    inline void glProgramUniformMatrix4x3dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x3dv(program,location,count,transpose,value);}
+    inline void glGetNamedProgramLocalParameterIuivEXT(GLuint program,GLenum target,GLuint index,GLuint* params){ge::gl::getDefaultDirectContext().glGetNamedProgramLocalParameterIuivEXT(program,target,index,params);}
+    inline void glReadnPixels(GLint x,GLint y,GLsizei width,GLsizei height,GLenum format,GLenum type,GLsizei bufSize,void* data){ge::gl::getDefaultDirectContext().glReadnPixels(x,y,width,height,format,type,bufSize,data);}
+    inline void glMultiTexCoord4f(GLenum target,GLfloat s,GLfloat t,GLfloat r,GLfloat q){ge::gl::getDefaultDirectContext().glMultiTexCoord4f(target,s,t,r,q);}
+    inline void glColor3ub(GLubyte red,GLubyte green,GLubyte blue){ge::gl::getDefaultDirectContext().glColor3ub(red,green,blue);}
+    inline void glMultiTexCoord4d(GLenum target,GLdouble s,GLdouble t,GLdouble r,GLdouble q){ge::gl::getDefaultDirectContext().glMultiTexCoord4d(target,s,t,r,q);}
+    inline void glVertexAttribL3ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z){ge::gl::getDefaultDirectContext().glVertexAttribL3ui64NV(index,x,y,z);}
+    inline void glColor3ui(GLuint red,GLuint green,GLuint blue){ge::gl::getDefaultDirectContext().glColor3ui(red,green,blue);}
+    inline void glProgramUniform4fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform4fvEXT(program,location,count,value);}
+    inline void glVertexAttrib2sARB(GLuint index,GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glVertexAttrib2sARB(index,x,y);}
+    inline void glMultiTexCoord4i(GLenum target,GLint s,GLint t,GLint r,GLint q){ge::gl::getDefaultDirectContext().glMultiTexCoord4i(target,s,t,r,q);}
+    inline GLenum glCheckFramebufferStatusEXT(GLenum target){return ge::gl::getDefaultDirectContext().glCheckFramebufferStatusEXT(target);}
+    inline void glGetnMapivARB(GLenum target,GLenum query,GLsizei bufSize,GLint* v){ge::gl::getDefaultDirectContext().glGetnMapivARB(target,query,bufSize,v);}
+    inline void glMultiTexCoord1ivARB(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1ivARB(target,v);}
+    inline void glDisableVertexAttribArrayARB(GLuint index){ge::gl::getDefaultDirectContext().glDisableVertexAttribArrayARB(index);}
+    inline void glGetPolygonStipple(GLubyte* mask){ge::gl::getDefaultDirectContext().glGetPolygonStipple(mask);}
+    inline void glVertexAttribI4ui(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w){ge::gl::getDefaultDirectContext().glVertexAttribI4ui(index,x,y,z,w);}
+    inline void glGetPathDashArrayNV(GLuint path,GLfloat* dashArray){ge::gl::getDefaultDirectContext().glGetPathDashArrayNV(path,dashArray);}
+    inline void glMultiTexRenderbufferEXT(GLenum texunit,GLenum target,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glMultiTexRenderbufferEXT(texunit,target,renderbuffer);}
+    inline void glCopyTextureSubImage1D(GLuint texture,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyTextureSubImage1D(texture,level,xoffset,x,y,width);}
+    inline void glDeleteOcclusionQueriesNV(GLsizei n,const GLuint* ids){ge::gl::getDefaultDirectContext().glDeleteOcclusionQueriesNV(n,ids);}
+    inline void glVertex4hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertex4hvNV(v);}
+    inline void glGetnTexImage(GLenum target,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetnTexImage(target,level,format,type,bufSize,pixels);}
+    inline void glProgramLocalParameter4dARB(GLenum target,GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glProgramLocalParameter4dARB(target,index,x,y,z,w);}
+    inline void glBlendEquation(GLenum mode){ge::gl::getDefaultDirectContext().glBlendEquation(mode);}
+    inline void glUnlockArraysEXT(){ge::gl::getDefaultDirectContext().glUnlockArraysEXT();}
+    inline void glGetQueryObjectui64vEXT(GLuint id,GLenum pname,GLuint64* params){ge::gl::getDefaultDirectContext().glGetQueryObjectui64vEXT(id,pname,params);}
+    inline void glVertexAttribI4uivEXT(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI4uivEXT(index,v);}
+    inline void glUniform1i64vNV(GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glUniform1i64vNV(location,count,value);}
+    inline void glMultiTexCoord3dv(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3dv(target,v);}
+    inline void glColor4sv(const GLshort* v){ge::gl::getDefaultDirectContext().glColor4sv(v);}
+    inline void glVertexStream4ivATI(GLenum stream,const GLint* coords){ge::gl::getDefaultDirectContext().glVertexStream4ivATI(stream,coords);}
+    inline void glPopClientAttrib(){ge::gl::getDefaultDirectContext().glPopClientAttrib();}
+    inline void glClearBufferData(GLenum target,GLenum internalformat,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearBufferData(target,internalformat,format,type,data);}
+    inline void glGetProgramivNV(GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramivNV(id,pname,params);}
+    inline void glBeginTransformFeedback(GLenum primitiveMode){ge::gl::getDefaultDirectContext().glBeginTransformFeedback(primitiveMode);}
+    inline void glFinishObjectAPPLE(GLenum object,GLint name){ge::gl::getDefaultDirectContext().glFinishObjectAPPLE(object,name);}
+    inline void glGetMinmaxParameterivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMinmaxParameterivEXT(target,pname,params);}
+    inline void glColor3iv(const GLint* v){ge::gl::getDefaultDirectContext().glColor3iv(v);}
+    inline void glVertexAttrib3sv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib3sv(index,v);}
+    inline void glCompressedTexImage1D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexImage1D(target,level,internalformat,width,border,imageSize,data);}
+    inline void glDeleteTransformFeedbacks(GLsizei n,const GLuint* ids){ge::gl::getDefaultDirectContext().glDeleteTransformFeedbacks(n,ids);}
+    inline void glGetVideoi64vNV(GLuint video_slot,GLenum pname,GLint64EXT* params){ge::gl::getDefaultDirectContext().glGetVideoi64vNV(video_slot,pname,params);}
+    inline void glDrawRangeElementsBaseVertex(GLenum mode,GLuint start,GLuint end,GLsizei count,GLenum type,const void* indices,GLint basevertex){ge::gl::getDefaultDirectContext().glDrawRangeElementsBaseVertex(mode,start,end,count,type,indices,basevertex);}
+    inline void glUniform4i64vARB(GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glUniform4i64vARB(location,count,value);}
+    inline void glTextureStorage3DMultisampleEXT(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTextureStorage3DMultisampleEXT(texture,target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+    inline void glGetTexParameterfv(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetTexParameterfv(target,pname,params);}
+    inline void glProgramUniformui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniformui64vNV(program,location,count,value);}
+    inline void glCompressedMultiTexImage1DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexImage1DEXT(texunit,target,level,internalformat,width,border,imageSize,bits);}
+    inline void glProgramUniform2ivEXT(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform2ivEXT(program,location,count,value);}
+    inline void glPushGroupMarkerEXT(GLsizei length,const GLchar* marker){ge::gl::getDefaultDirectContext().glPushGroupMarkerEXT(length,marker);}
+    inline void glVertexAttrib1dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib1dv(index,v);}
+    inline void glMatrixLoadIdentityEXT(GLenum mode){ge::gl::getDefaultDirectContext().glMatrixLoadIdentityEXT(mode);}
+    inline void glMultTransposeMatrixxOES(const GLfixed* m){ge::gl::getDefaultDirectContext().glMultTransposeMatrixxOES(m);}
+    inline void glGetPixelMapxv(GLenum map,GLint size,GLfixed* values){ge::gl::getDefaultDirectContext().glGetPixelMapxv(map,size,values);}
+    inline void glFramebufferSampleLocationsfvARB(GLenum target,GLuint start,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glFramebufferSampleLocationsfvARB(target,start,count,v);}
+    inline void glGetLightiv(GLenum light,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetLightiv(light,pname,params);}
+    inline void glBlendFuncSeparatei(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparatei(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+    inline GLboolean glAcquireKeyedMutexWin32EXT(GLuint memory,GLuint64 key,GLuint timeout){return ge::gl::getDefaultDirectContext().glAcquireKeyedMutexWin32EXT(memory,key,timeout);}
+    inline void glGetBooleanIndexedvEXT(GLenum target,GLuint index,GLboolean* data){ge::gl::getDefaultDirectContext().glGetBooleanIndexedvEXT(target,index,data);}
+    inline void glGetProgramSubroutineParameteruivNV(GLenum target,GLuint index,GLuint* param){ge::gl::getDefaultDirectContext().glGetProgramSubroutineParameteruivNV(target,index,param);}
+    inline void glUniform2ui(GLint location,GLuint v0,GLuint v1){ge::gl::getDefaultDirectContext().glUniform2ui(location,v0,v1);}
+    inline void glApplyFramebufferAttachmentCMAAINTEL(){ge::gl::getDefaultDirectContext().glApplyFramebufferAttachmentCMAAINTEL();}
+    inline void glWindowPos2fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos2fv(v);}
+    inline void glWaitVkSemaphoreNV(GLuint64 vkSemaphore){ge::gl::getDefaultDirectContext().glWaitVkSemaphoreNV(vkSemaphore);}
+    inline void glDisablei(GLenum target,GLuint index){ge::gl::getDefaultDirectContext().glDisablei(target,index);}
+    inline void glSelectPerfMonitorCountersAMD(GLuint monitor,GLboolean enable,GLuint group,GLint numCounters,GLuint* counterList){ge::gl::getDefaultDirectContext().glSelectPerfMonitorCountersAMD(monitor,enable,group,numCounters,counterList);}
+    inline void glGetVertexAttribLi64vNV(GLuint index,GLenum pname,GLint64EXT* params){ge::gl::getDefaultDirectContext().glGetVertexAttribLi64vNV(index,pname,params);}
+    inline void glBlendFuncSeparateiARB(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparateiARB(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+    inline void glWeightuivARB(GLint size,const GLuint* weights){ge::gl::getDefaultDirectContext().glWeightuivARB(size,weights);}
+    inline void glWindowPos2iARB(GLint x,GLint y){ge::gl::getDefaultDirectContext().glWindowPos2iARB(x,y);}
+    inline void glGetProgramLocalParameterdvARB(GLenum target,GLuint index,GLdouble* params){ge::gl::getDefaultDirectContext().glGetProgramLocalParameterdvARB(target,index,params);}
+    inline void glGetUniformui64vARB(GLuint program,GLint location,GLuint64* params){ge::gl::getDefaultDirectContext().glGetUniformui64vARB(program,location,params);}
+    inline void glSecondaryColor3us(GLushort red,GLushort green,GLushort blue){ge::gl::getDefaultDirectContext().glSecondaryColor3us(red,green,blue);}
+    inline void glGetSynciv(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei* length,GLint* values){ge::gl::getDefaultDirectContext().glGetSynciv(sync,pname,bufSize,length,values);}
+    inline void glMakeImageHandleResidentARB(GLuint64 handle,GLenum access){ge::gl::getDefaultDirectContext().glMakeImageHandleResidentARB(handle,access);}
+    inline void glGetProgramNamedParameterfvNV(GLuint id,GLsizei len,const GLubyte* name,GLfloat* params){ge::gl::getDefaultDirectContext().glGetProgramNamedParameterfvNV(id,len,name,params);}
+    inline void glTextureStorage3D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){ge::gl::getDefaultDirectContext().glTextureStorage3D(texture,levels,internalformat,width,height,depth);}
+    inline void glVertexAttrib4svNV(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4svNV(index,v);}
+    inline void glProgramUniform2i(GLuint program,GLint location,GLint v0,GLint v1){ge::gl::getDefaultDirectContext().glProgramUniform2i(program,location,v0,v1);}
+    inline void glListDrawCommandsStatesClientNV(GLuint list,GLuint segment,const void** indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count){ge::gl::getDefaultDirectContext().glListDrawCommandsStatesClientNV(list,segment,indirects,sizes,states,fbos,count);}
+    inline void glProgramLocalParametersI4uivNV(GLenum target,GLuint index,GLsizei count,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramLocalParametersI4uivNV(target,index,count,params);}
+    inline void glBeginTransformFeedbackNV(GLenum primitiveMode){ge::gl::getDefaultDirectContext().glBeginTransformFeedbackNV(primitiveMode);}
+    inline void glGetProgramBinary(GLuint program,GLsizei bufSize,GLsizei* length,GLenum* binaryFormat,void* binary){ge::gl::getDefaultDirectContext().glGetProgramBinary(program,bufSize,length,binaryFormat,binary);}
+    inline void glBinormal3iEXT(GLint bx,GLint by,GLint bz){ge::gl::getDefaultDirectContext().glBinormal3iEXT(bx,by,bz);}
+    inline void glEvalPoint1(GLint i){ge::gl::getDefaultDirectContext().glEvalPoint1(i);}
+    inline void glEvalPoint2(GLint i,GLint j){ge::gl::getDefaultDirectContext().glEvalPoint2(i,j);}
+    inline void glPauseTransformFeedback(){ge::gl::getDefaultDirectContext().glPauseTransformFeedback();}
+    inline void glWindowPos2sMESA(GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glWindowPos2sMESA(x,y);}
+    inline void glGlobalAlphaFactorbSUN(GLbyte factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactorbSUN(factor);}
+    inline void glCreateTransformFeedbacks(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glCreateTransformFeedbacks(n,ids);}
+    inline void glTexturePageCommitmentEXT(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLboolean commit){ge::gl::getDefaultDirectContext().glTexturePageCommitmentEXT(texture,level,xoffset,yoffset,zoffset,width,height,depth,commit);}
+    inline void glTransformFeedbackVaryingsNV(GLuint program,GLsizei count,const GLint* locations,GLenum bufferMode){ge::gl::getDefaultDirectContext().glTransformFeedbackVaryingsNV(program,count,locations,bufferMode);}
+    inline void glTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const GLvoid* pixels){ge::gl::getDefaultDirectContext().glTexSubImage1D(target,level,xoffset,width,format,type,pixels);}
+    inline void glConvolutionParameterfvEXT(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glConvolutionParameterfvEXT(target,pname,params);}
+    inline void glBlitFramebufferEXT(GLint srcX0,GLint srcY0,GLint srcX1,GLint srcY1,GLint dstX0,GLint dstY0,GLint dstX1,GLint dstY1,GLbitfield mask,GLenum filter){ge::gl::getDefaultDirectContext().glBlitFramebufferEXT(srcX0,srcY0,srcX1,srcY1,dstX0,dstY0,dstX1,dstY1,mask,filter);}
+    inline void glUniformMatrix4fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix4fvARB(location,count,transpose,value);}
+    inline void glProgramEnvParameter4dvARB(GLenum target,GLuint index,const GLdouble* params){ge::gl::getDefaultDirectContext().glProgramEnvParameter4dvARB(target,index,params);}
+    inline void glTextureStorageMem2DEXT(GLuint texture,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTextureStorageMem2DEXT(texture,levels,internalFormat,width,height,memory,offset);}
+    inline void glVertexAttribP3uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexAttribP3uiv(index,type,normalized,value);}
+    inline void glFogCoordFormatNV(GLenum type,GLsizei stride){ge::gl::getDefaultDirectContext().glFogCoordFormatNV(type,stride);}
+    inline void glGetMultiTexLevelParameterivEXT(GLenum texunit,GLenum target,GLint level,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMultiTexLevelParameterivEXT(texunit,target,level,pname,params);}
+    inline GLboolean glIsOcclusionQueryNV(GLuint id){return ge::gl::getDefaultDirectContext().glIsOcclusionQueryNV(id);}
+    inline void glCompressedTexImage2DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexImage2DARB(target,level,internalformat,width,height,border,imageSize,data);}
+    inline void glGetProgramEnvParameterIuivNV(GLenum target,GLuint index,GLuint* params){ge::gl::getDefaultDirectContext().glGetProgramEnvParameterIuivNV(target,index,params);}
+    inline void glVertexAttrib4sv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4sv(index,v);}
+    inline void glVertexAttrib4fvARB(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib4fvARB(index,v);}
+    inline void glLoadName(GLuint name){ge::gl::getDefaultDirectContext().glLoadName(name);}
+    inline void glBindVertexShaderEXT(GLuint id){ge::gl::getDefaultDirectContext().glBindVertexShaderEXT(id);}
+    inline void glGetNamedProgramLocalParameterIivEXT(GLuint program,GLenum target,GLuint index,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedProgramLocalParameterIivEXT(program,target,index,params);}
+    inline void glProgramUniform3uiEXT(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2){ge::gl::getDefaultDirectContext().glProgramUniform3uiEXT(program,location,v0,v1,v2);}
+    inline void glProgramUniformMatrix4x2dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x2dvEXT(program,location,count,transpose,value);}
+    inline void glTexCoord1hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glTexCoord1hvNV(v);}
+    inline void glLoadMatrixd(const GLdouble* m){ge::gl::getDefaultDirectContext().glLoadMatrixd(m);}
+    inline void glTexParameterfv(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glTexParameterfv(target,pname,params);}
+    inline void glVariantdvEXT(GLuint id,const GLdouble* addr){ge::gl::getDefaultDirectContext().glVariantdvEXT(id,addr);}
+    inline void glCullParameterfvEXT(GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glCullParameterfvEXT(pname,params);}
+    inline void glUniform3dv(GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniform3dv(location,count,value);}
+    inline void glProgramUniform3fv(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform3fv(program,location,count,value);}
+    inline GLboolean glIsBufferARB(GLuint buffer){return ge::gl::getDefaultDirectContext().glIsBufferARB(buffer);}
+    inline void glMultiTexCoord1bOES(GLenum texture,GLbyte s){ge::gl::getDefaultDirectContext().glMultiTexCoord1bOES(texture,s);}
+    inline void glFogCoordhNV(GLhalfNV fog){ge::gl::getDefaultDirectContext().glFogCoordhNV(fog);}
+    inline void glFramebufferSampleLocationsfvNV(GLenum target,GLuint start,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glFramebufferSampleLocationsfvNV(target,start,count,v);}
+    inline GLuint glGenSymbolsEXT(GLenum datatype,GLenum storagetype,GLenum range,GLuint components){return ge::gl::getDefaultDirectContext().glGenSymbolsEXT(datatype,storagetype,range,components);}
+    inline void glGetConvolutionFilter(GLenum target,GLenum format,GLenum type,GLvoid* image){ge::gl::getDefaultDirectContext().glGetConvolutionFilter(target,format,type,image);}
+    inline void glProgramUniform1fvEXT(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform1fvEXT(program,location,count,value);}
+    inline void glGetNextPerfQueryIdINTEL(GLuint queryId,GLuint* nextQueryId){ge::gl::getDefaultDirectContext().glGetNextPerfQueryIdINTEL(queryId,nextQueryId);}
+    inline void glCompressedTexImage1DARB(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLint border,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexImage1DARB(target,level,internalformat,width,border,imageSize,data);}
+    inline void glBindSamplers(GLuint first,GLsizei count,const GLuint* samplers){ge::gl::getDefaultDirectContext().glBindSamplers(first,count,samplers);}
+    inline void glGetProgramEnvParameterIivNV(GLenum target,GLuint index,GLint* params){ge::gl::getDefaultDirectContext().glGetProgramEnvParameterIivNV(target,index,params);}
+    inline void glGetQueryObjectui64v(GLuint id,GLenum pname,GLuint64* params){ge::gl::getDefaultDirectContext().glGetQueryObjectui64v(id,pname,params);}
+    inline void glVertexAttribL4ui64vNV(GLuint index,const GLuint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL4ui64vNV(index,v);}
+    inline void glGetVideoivNV(GLuint video_slot,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVideoivNV(video_slot,pname,params);}
+    inline void glGetTextureImage(GLuint texture,GLint level,GLenum format,GLenum type,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetTextureImage(texture,level,format,type,bufSize,pixels);}
+    inline void glProgramUniform1fv(GLuint program,GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniform1fv(program,location,count,value);}
+    inline void glUniformMatrix4fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix4fv(location,count,transpose,value);}
+    inline void glColorMask(GLboolean red,GLboolean green,GLboolean blue,GLboolean alpha){ge::gl::getDefaultDirectContext().glColorMask(red,green,blue,alpha);}
+    inline void glBeginFragmentShaderATI(){ge::gl::getDefaultDirectContext().glBeginFragmentShaderATI();}
+    inline void glMultiDrawArraysEXT(GLenum mode,const GLint* first,const GLsizei* count,GLsizei primcount){ge::gl::getDefaultDirectContext().glMultiDrawArraysEXT(mode,first,count,primcount);}
+    inline void glGenNamesAMD(GLenum identifier,GLuint num,GLuint* names){ge::gl::getDefaultDirectContext().glGenNamesAMD(identifier,num,names);}
+    inline void glPathParameteriNV(GLuint path,GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glPathParameteriNV(path,pname,value);}
+    inline void glCreateCommandListsNV(GLsizei n,GLuint* lists){ge::gl::getDefaultDirectContext().glCreateCommandListsNV(n,lists);}
+    inline void glDeleteProgramPipelines(GLsizei n,const GLuint* pipelines){ge::gl::getDefaultDirectContext().glDeleteProgramPipelines(n,pipelines);}
+    inline void glCopyColorSubTableEXT(GLenum target,GLsizei start,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyColorSubTableEXT(target,start,x,y,width);}
+    inline void glVariantsvEXT(GLuint id,const GLshort* addr){ge::gl::getDefaultDirectContext().glVariantsvEXT(id,addr);}
+    inline void glGenProgramPipelines(GLsizei n,GLuint* pipelines){ge::gl::getDefaultDirectContext().glGenProgramPipelines(n,pipelines);}
+    inline void glVertexArrayEdgeFlagOffsetEXT(GLuint vaobj,GLuint buffer,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArrayEdgeFlagOffsetEXT(vaobj,buffer,stride,offset);}
+    inline void glWindowPos2s(GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glWindowPos2s(x,y);}
+    inline void glSecondaryColor3iEXT(GLint red,GLint green,GLint blue){ge::gl::getDefaultDirectContext().glSecondaryColor3iEXT(red,green,blue);}
+    inline void glWindowPos2i(GLint x,GLint y){ge::gl::getDefaultDirectContext().glWindowPos2i(x,y);}
+    inline void glWindowPos2f(GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glWindowPos2f(x,y);}
+    inline void glWindowPos2d(GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glWindowPos2d(x,y);}
+    inline void glUniform4uivEXT(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform4uivEXT(location,count,value);}
+    inline void glOrthoxOES(GLfixed l,GLfixed r,GLfixed b,GLfixed t,GLfixed n,GLfixed f){ge::gl::getDefaultDirectContext().glOrthoxOES(l,r,b,t,n,f);}
+    inline void glUniformSubroutinesuiv(GLenum shadertype,GLsizei count,const GLuint* indices){ge::gl::getDefaultDirectContext().glUniformSubroutinesuiv(shadertype,count,indices);}
+    inline void glRectdv(const GLdouble* v1,const GLdouble* v2){ge::gl::getDefaultDirectContext().glRectdv(v1,v2);}
+    inline void glProgramUniform1i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform1i64vNV(program,location,count,value);}
+    inline void glVertexAttribI4uiEXT(GLuint index,GLuint x,GLuint y,GLuint z,GLuint w){ge::gl::getDefaultDirectContext().glVertexAttribI4uiEXT(index,x,y,z,w);}
+    inline void glSecondaryColor3ubEXT(GLubyte red,GLubyte green,GLubyte blue){ge::gl::getDefaultDirectContext().glSecondaryColor3ubEXT(red,green,blue);}
+    inline void glCompressedMultiTexSubImage1DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexSubImage1DEXT(texunit,target,level,xoffset,width,format,imageSize,bits);}
+    inline void glMultiTexGendEXT(GLenum texunit,GLenum coord,GLenum pname,GLdouble param){ge::gl::getDefaultDirectContext().glMultiTexGendEXT(texunit,coord,pname,param);}
+    inline void glColorP3uiv(GLenum type,const GLuint* color){ge::gl::getDefaultDirectContext().glColorP3uiv(type,color);}
+    inline void glFogCoordfv(const GLfloat* coord){ge::gl::getDefaultDirectContext().glFogCoordfv(coord);}
+    inline void glCompileShader(GLuint shader){ge::gl::getDefaultDirectContext().glCompileShader(shader);}
+    inline void glTexCoord2hNV(GLhalfNV s,GLhalfNV t){ge::gl::getDefaultDirectContext().glTexCoord2hNV(s,t);}
+    inline void glUniform1uivEXT(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform1uivEXT(location,count,value);}
+    inline void glMatrixLoadTransposedEXT(GLenum mode,const GLdouble* m){ge::gl::getDefaultDirectContext().glMatrixLoadTransposedEXT(mode,m);}
+    inline void glIndexfv(const GLfloat* c){ge::gl::getDefaultDirectContext().glIndexfv(c);}
+    inline void glGetCompressedTextureImage(GLuint texture,GLint level,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetCompressedTextureImage(texture,level,bufSize,pixels);}
+    inline void glGetUniformuivEXT(GLuint program,GLint location,GLuint* params){ge::gl::getDefaultDirectContext().glGetUniformuivEXT(program,location,params);}
+    inline void glGetnPixelMapfvARB(GLenum map,GLsizei bufSize,GLfloat* values){ge::gl::getDefaultDirectContext().glGetnPixelMapfvARB(map,bufSize,values);}
+    inline void glFramebufferTextureEXT(GLenum target,GLenum attachment,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTextureEXT(target,attachment,texture,level);}
+    inline void glMultiDrawElementsIndirectCount(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirectCount(mode,type,indirect,drawcount,maxdrawcount,stride);}
+    inline void glVertexAttribIPointer(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribIPointer(index,size,type,stride,pointer);}
+    inline void glMultiTexCoordP3ui(GLenum texture,GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP3ui(texture,type,coords);}
+    inline void glEvaluateDepthValuesARB(){ge::gl::getDefaultDirectContext().glEvaluateDepthValuesARB();}
+    inline void glGetNamedBufferParameteriv(GLuint buffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedBufferParameteriv(buffer,pname,params);}
+    inline void glGetNamedProgramLocalParameterfvEXT(GLuint program,GLenum target,GLuint index,GLfloat* params){ge::gl::getDefaultDirectContext().glGetNamedProgramLocalParameterfvEXT(program,target,index,params);}
+    inline void glColor4fNormal3fVertex3fvSUN(const GLfloat* c,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glColor4fNormal3fVertex3fvSUN(c,n,v);}
+    inline void glSeparableFilter2DEXT(GLenum target,GLenum internalformat,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* row,const void* column){ge::gl::getDefaultDirectContext().glSeparableFilter2DEXT(target,internalformat,width,height,format,type,row,column);}
+    inline void glTexParameterxOES(GLenum target,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glTexParameterxOES(target,pname,param);}
+    inline void glClearAccumxOES(GLfixed red,GLfixed green,GLfixed blue,GLfixed alpha){ge::gl::getDefaultDirectContext().glClearAccumxOES(red,green,blue,alpha);}
+    inline void glInvalidateFramebuffer(GLenum target,GLsizei numAttachments,const GLenum* attachments){ge::gl::getDefaultDirectContext().glInvalidateFramebuffer(target,numAttachments,attachments);}
+    inline void glWeightubvARB(GLint size,const GLubyte* weights){ge::gl::getDefaultDirectContext().glWeightubvARB(size,weights);}
+    inline void glVertexAttrib1d(GLuint index,GLdouble x){ge::gl::getDefaultDirectContext().glVertexAttrib1d(index,x);}
+    inline void glVertexAttrib1f(GLuint index,GLfloat x){ge::gl::getDefaultDirectContext().glVertexAttrib1f(index,x);}
+    inline void glVertex4fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glVertex4fv(v);}
+    inline void glClearNamedFramebufferfi(GLuint framebuffer,GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil){ge::gl::getDefaultDirectContext().glClearNamedFramebufferfi(framebuffer,buffer,drawbuffer,depth,stencil);}
+    inline void glGetQueryBufferObjectuiv(GLuint id,GLuint buffer,GLenum pname,GLintptr offset){ge::gl::getDefaultDirectContext().glGetQueryBufferObjectuiv(id,buffer,pname,offset);}
+    inline void glClearNamedFramebufferfv(GLuint framebuffer,GLenum buffer,GLint drawbuffer,const GLfloat* value){ge::gl::getDefaultDirectContext().glClearNamedFramebufferfv(framebuffer,buffer,drawbuffer,value);}
+    inline void glEndVertexShaderEXT(){ge::gl::getDefaultDirectContext().glEndVertexShaderEXT();}
+    inline void glVertexAttrib1s(GLuint index,GLshort x){ge::gl::getDefaultDirectContext().glVertexAttrib1s(index,x);}
+    inline void glMultiTexCoord4dvARB(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4dvARB(target,v);}
+    inline void glMultiTexCoord1sv(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1sv(target,v);}
+    inline void glUniform1ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glUniform1ui64vNV(location,count,value);}
+    inline void glGetClipPlanefOES(GLenum plane,GLfloat* equation){ge::gl::getDefaultDirectContext().glGetClipPlanefOES(plane,equation);}
+    inline void glRasterPos2s(GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glRasterPos2s(x,y);}
+    inline void glWeightivARB(GLint size,const GLint* weights){ge::gl::getDefaultDirectContext().glWeightivARB(size,weights);}
+    inline void glMultiTexCoord4hvNV(GLenum target,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4hvNV(target,v);}
+    inline void glNormal3hNV(GLhalfNV nx,GLhalfNV ny,GLhalfNV nz){ge::gl::getDefaultDirectContext().glNormal3hNV(nx,ny,nz);}
+    inline void glGetSeparableFilter(GLenum target,GLenum format,GLenum type,GLvoid* row,GLvoid* column,GLvoid* span){ge::gl::getDefaultDirectContext().glGetSeparableFilter(target,format,type,row,column,span);}
+    inline void glGetPathTexGenivNV(GLenum texCoordSet,GLenum pname,GLint* value){ge::gl::getDefaultDirectContext().glGetPathTexGenivNV(texCoordSet,pname,value);}
+    inline void glColor4bv(const GLbyte* v){ge::gl::getDefaultDirectContext().glColor4bv(v);}
+    inline void glRasterPos2f(GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glRasterPos2f(x,y);}
+    inline void glNamedBufferPageCommitmentARB(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit){ge::gl::getDefaultDirectContext().glNamedBufferPageCommitmentARB(buffer,offset,size,commit);}
+    inline void glLoadIdentity(){ge::gl::getDefaultDirectContext().glLoadIdentity();}
+    inline void glRasterPos2i(GLint x,GLint y){ge::gl::getDefaultDirectContext().glRasterPos2i(x,y);}
+    inline void glRasterPos4iv(const GLint* v){ge::gl::getDefaultDirectContext().glRasterPos4iv(v);}
+    inline void glMultiTexCoord2fvARB(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2fvARB(target,v);}
+    inline void glUniformMatrix4x3fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix4x3fv(location,count,transpose,value);}
+    inline void glClearBufferfv(GLenum buffer,GLint drawbuffer,const GLfloat* value){ge::gl::getDefaultDirectContext().glClearBufferfv(buffer,drawbuffer,value);}
+    inline void glMultiTexCoord4hNV(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r,GLhalfNV q){ge::gl::getDefaultDirectContext().glMultiTexCoord4hNV(target,s,t,r,q);}
+    inline void glTextureBarrier(){ge::gl::getDefaultDirectContext().glTextureBarrier();}
+    inline void glReplacementCodeuivSUN(const GLuint* code){ge::gl::getDefaultDirectContext().glReplacementCodeuivSUN(code);}
+    inline void glDeleteAsyncMarkersSGIX(GLuint marker,GLsizei range){ge::gl::getDefaultDirectContext().glDeleteAsyncMarkersSGIX(marker,range);}
+    inline void glTexCoord2bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glTexCoord2bvOES(coords);}
+    inline void glEvalCoord2xOES(GLfixed u,GLfixed v){ge::gl::getDefaultDirectContext().glEvalCoord2xOES(u,v);}
+    inline void glGetSharpenTexFuncSGIS(GLenum target,GLfloat* points){ge::gl::getDefaultDirectContext().glGetSharpenTexFuncSGIS(target,points);}
+    inline void glProgramUniformHandleui64vNV(GLuint program,GLint location,GLsizei count,const GLuint64* values){ge::gl::getDefaultDirectContext().glProgramUniformHandleui64vNV(program,location,count,values);}
+    inline void glIglooInterfaceSGIX(GLenum pname,const void* params){ge::gl::getDefaultDirectContext().glIglooInterfaceSGIX(pname,params);}
+    inline void glWindowPos2dvARB(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos2dvARB(v);}
+    inline void glClearBufferfi(GLenum buffer,GLint drawbuffer,GLfloat depth,GLint stencil){ge::gl::getDefaultDirectContext().glClearBufferfi(buffer,drawbuffer,depth,stencil);}
+    inline void glDrawArraysIndirect(GLenum mode,const void* indirect){ge::gl::getDefaultDirectContext().glDrawArraysIndirect(mode,indirect);}
+    inline void glGenVertexArrays(GLsizei n,GLuint* arrays){ge::gl::getDefaultDirectContext().glGenVertexArrays(n,arrays);}
+    inline void glGetTransformFeedbacki64_v(GLuint xfb,GLenum pname,GLuint index,GLint64* param){ge::gl::getDefaultDirectContext().glGetTransformFeedbacki64_v(xfb,pname,index,param);}
+    inline void glEnableVertexArrayAttrib(GLuint vaobj,GLuint index){ge::gl::getDefaultDirectContext().glEnableVertexArrayAttrib(vaobj,index);}
+    inline void glProgramUniformMatrix3x2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x2dv(program,location,count,transpose,value);}
+    inline void glVertexStream4fATI(GLenum stream,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glVertexStream4fATI(stream,x,y,z,w);}
+    inline void glVertexBindingDivisor(GLuint bindingindex,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexBindingDivisor(bindingindex,divisor);}
+    inline void glGetSamplerParameterIiv(GLuint sampler,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetSamplerParameterIiv(sampler,pname,params);}
+    inline void glGetCoverageModulationTableNV(GLsizei bufsize,GLfloat* v){ge::gl::getDefaultDirectContext().glGetCoverageModulationTableNV(bufsize,v);}
+    inline void glDepthRangedNV(GLdouble zNear,GLdouble zFar){ge::gl::getDefaultDirectContext().glDepthRangedNV(zNear,zFar);}
+    inline void glVertexAttrib3f(GLuint index,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glVertexAttrib3f(index,x,y,z);}
+    inline void glMultiDrawRangeElementArrayAPPLE(GLenum mode,GLuint start,GLuint end,const GLint* first,const GLsizei* count,GLsizei primcount){ge::gl::getDefaultDirectContext().glMultiDrawRangeElementArrayAPPLE(mode,start,end,first,count,primcount);}
+    inline void glVertexAttribFormatNV(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride){ge::gl::getDefaultDirectContext().glVertexAttribFormatNV(index,size,type,normalized,stride);}
+    inline void glGetQueryBufferObjecti64v(GLuint id,GLuint buffer,GLenum pname,GLintptr offset){ge::gl::getDefaultDirectContext().glGetQueryBufferObjecti64v(id,buffer,pname,offset);}
+    inline void glGetVertexAttribdv(GLuint index,GLenum pname,GLdouble* params){ge::gl::getDefaultDirectContext().glGetVertexAttribdv(index,pname,params);}
+    inline void glGetUniformi64vARB(GLuint program,GLint location,GLint64* params){ge::gl::getDefaultDirectContext().glGetUniformi64vARB(program,location,params);}
+    inline GLboolean glAreTexturesResidentEXT(GLsizei n,const GLuint* textures,GLboolean* residences){return ge::gl::getDefaultDirectContext().glAreTexturesResidentEXT(n,textures,residences);}
+    inline GLhandleARB glGetHandleARB(GLenum pname){return ge::gl::getDefaultDirectContext().glGetHandleARB(pname);}
+    inline void glVideoCaptureStreamParameterdvNV(GLuint video_capture_slot,GLuint stream,GLenum pname,const GLdouble* params){ge::gl::getDefaultDirectContext().glVideoCaptureStreamParameterdvNV(video_capture_slot,stream,pname,params);}
+    inline void glMapParameterivNV(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMapParameterivNV(target,pname,params);}
+    inline GLboolean glIsVertexArray(GLuint array){return ge::gl::getDefaultDirectContext().glIsVertexArray(array);}
+    inline void glSecondaryColor3sEXT(GLshort red,GLshort green,GLshort blue){ge::gl::getDefaultDirectContext().glSecondaryColor3sEXT(red,green,blue);}
+    inline void glGetTexParameterIivEXT(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexParameterIivEXT(target,pname,params);}
+    inline void glFrameTerminatorGREMEDY(){ge::gl::getDefaultDirectContext().glFrameTerminatorGREMEDY();}
+    inline void glBlendBarrierKHR(){ge::gl::getDefaultDirectContext().glBlendBarrierKHR();}
+    inline void glVertexAttrib4NubARB(GLuint index,GLubyte x,GLubyte y,GLubyte z,GLubyte w){ge::gl::getDefaultDirectContext().glVertexAttrib4NubARB(index,x,y,z,w);}
+    inline void glPrimitiveRestartNV(){ge::gl::getDefaultDirectContext().glPrimitiveRestartNV();}
+    inline void glVertexAttribL1ui64vARB(GLuint index,const GLuint64EXT* v){ge::gl::getDefaultDirectContext().glVertexAttribL1ui64vARB(index,v);}
+    inline void glVertexAttribI4ivEXT(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI4ivEXT(index,v);}
+    inline void glVertexAttribs4svNV(GLuint index,GLsizei count,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribs4svNV(index,count,v);}
+    inline void glUniform1ui(GLint location,GLuint v0){ge::gl::getDefaultDirectContext().glUniform1ui(location,v0);}
+    inline void glVertexAttrib2fvARB(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib2fvARB(index,v);}
+    inline void glVertexAttribI4svEXT(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttribI4svEXT(index,v);}
+    inline void glTextureImage3DMultisampleCoverageNV(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTextureImage3DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+    inline void glMemoryBarrier(GLbitfield barriers){ge::gl::getDefaultDirectContext().glMemoryBarrier(barriers);}
+    inline void glGetVariantArrayObjectfvATI(GLuint id,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetVariantArrayObjectfvATI(id,pname,params);}
+    inline void glTexCoord4fColor4fNormal3fVertex4fvSUN(const GLfloat* tc,const GLfloat* c,const GLfloat* n,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord4fColor4fNormal3fVertex4fvSUN(tc,c,n,v);}
+    inline GLboolean glIsProgramARB(GLuint program){return ge::gl::getDefaultDirectContext().glIsProgramARB(program);}
+    inline void glBindImageTextureEXT(GLuint index,GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum access,GLint format){ge::gl::getDefaultDirectContext().glBindImageTextureEXT(index,texture,level,layered,layer,access,format);}
+    inline GLint glGetFragDataLocation(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetFragDataLocation(program,name);}
+    inline void glMultiTexCoord1svARB(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord1svARB(target,v);}
+    inline void glGetMapxvOES(GLenum target,GLenum query,GLfixed* v){ge::gl::getDefaultDirectContext().glGetMapxvOES(target,query,v);}
+    inline void glTextureStorage2DMultisampleEXT(GLuint texture,GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTextureStorage2DMultisampleEXT(texture,target,samples,internalformat,width,height,fixedsamplelocations);}
+    inline void glGetMaterialfv(GLenum face,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetMaterialfv(face,pname,params);}
+    inline void glVertexAttrib4NbvARB(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4NbvARB(index,v);}
+    inline void glPixelMapuiv(GLenum map,GLsizei mapsize,const GLuint* values){ge::gl::getDefaultDirectContext().glPixelMapuiv(map,mapsize,values);}
+    inline void glColorPointerEXT(GLint size,GLenum type,GLsizei stride,GLsizei count,const void* pointer){ge::gl::getDefaultDirectContext().glColorPointerEXT(size,type,stride,count,pointer);}
+    inline void glEnableClientStateiEXT(GLenum array,GLuint index){ge::gl::getDefaultDirectContext().glEnableClientStateiEXT(array,index);}
+    inline void glClearTexSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* data){ge::gl::getDefaultDirectContext().glClearTexSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,data);}
+    inline void glEvalCoord1xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glEvalCoord1xvOES(coords);}
+    inline void glDetachObjectARB(GLhandleARB containerObj,GLhandleARB attachedObj){ge::gl::getDefaultDirectContext().glDetachObjectARB(containerObj,attachedObj);}
+    inline void glGetTextureParameterIiv(GLuint texture,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureParameterIiv(texture,pname,params);}
+    inline void glVariantusvEXT(GLuint id,const GLushort* addr){ge::gl::getDefaultDirectContext().glVariantusvEXT(id,addr);}
+    inline void glCompressedTextureImage3DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureImage3DEXT(texture,target,level,internalformat,width,height,depth,border,imageSize,bits);}
+    inline void glMultiTexCoord1dARB(GLenum target,GLdouble s){ge::gl::getDefaultDirectContext().glMultiTexCoord1dARB(target,s);}
+    inline void glGetVertexArrayIntegeri_vEXT(GLuint vaobj,GLuint index,GLenum pname,GLint* param){ge::gl::getDefaultDirectContext().glGetVertexArrayIntegeri_vEXT(vaobj,index,pname,param);}
+    inline void glVertexAttribI4ubv(GLuint index,const GLubyte* v){ge::gl::getDefaultDirectContext().glVertexAttribI4ubv(index,v);}
+    inline void glPixelTexGenParameterfSGIS(GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPixelTexGenParameterfSGIS(pname,param);}
+    inline void glProgramUniformMatrix4x2dv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x2dv(program,location,count,transpose,value);}
+    inline void glUniform3fARB(GLint location,GLfloat v0,GLfloat v1,GLfloat v2){ge::gl::getDefaultDirectContext().glUniform3fARB(location,v0,v1,v2);}
+    inline GLboolean glIsShader(GLuint shader){return ge::gl::getDefaultDirectContext().glIsShader(shader);}
+    inline void glConvolutionParameteriv(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glConvolutionParameteriv(target,pname,params);}
+    inline void glCopyMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,x,y,width,height);}
+    inline void glEnableVertexAttribArrayARB(GLuint index){ge::gl::getDefaultDirectContext().glEnableVertexAttribArrayARB(index);}
+    inline void glMulticastCopyBufferSubDataNV(GLuint readGpu,GLbitfield writeGpuMask,GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glMulticastCopyBufferSubDataNV(readGpu,writeGpuMask,readBuffer,writeBuffer,readOffset,writeOffset,size);}
+    inline void glEnable(GLenum cap){ge::gl::getDefaultDirectContext().glEnable(cap);}
+    inline void glGetActiveUniformsiv(GLuint program,GLsizei uniformCount,const GLuint* uniformIndices,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetActiveUniformsiv(program,uniformCount,uniformIndices,pname,params);}
+    inline void glGetVertexAttribivARB(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribivARB(index,pname,params);}
+    inline void glTexCoord4hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glTexCoord4hvNV(v);}
+    inline void glUseProgramObjectARB(GLhandleARB programObj){ge::gl::getDefaultDirectContext().glUseProgramObjectARB(programObj);}
+    inline GLint glGetAttribLocation(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetAttribLocation(program,name);}
+    inline void glVertexAttrib4dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib4dv(index,v);}
+    inline void glGetTextureParameteriv(GLuint texture,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureParameteriv(texture,pname,params);}
+    inline void glNamedBufferStorageMemEXT(GLuint buffer,GLsizeiptr size,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glNamedBufferStorageMemEXT(buffer,size,memory,offset);}
+    inline void glPathSubCoordsNV(GLuint path,GLsizei coordStart,GLsizei numCoords,GLenum coordType,const void* coords){ge::gl::getDefaultDirectContext().glPathSubCoordsNV(path,coordStart,numCoords,coordType,coords);}
+    inline void glMatrixIndexusvARB(GLint size,const GLushort* indices){ge::gl::getDefaultDirectContext().glMatrixIndexusvARB(size,indices);}
+    inline void glGetVideouivNV(GLuint video_slot,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetVideouivNV(video_slot,pname,params);}
+    inline void glGetVideoCaptureivNV(GLuint video_capture_slot,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVideoCaptureivNV(video_capture_slot,pname,params);}
+    inline void glProgramUniform3ui(GLuint program,GLint location,GLuint v0,GLuint v1,GLuint v2){ge::gl::getDefaultDirectContext().glProgramUniform3ui(program,location,v0,v1,v2);}
+    inline void glVertexAttrib3svARB(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib3svARB(index,v);}
+    inline void glGetNamedBufferParameterivEXT(GLuint buffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedBufferParameterivEXT(buffer,pname,params);}
+    inline void glMatrixScaledEXT(GLenum mode,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glMatrixScaledEXT(mode,x,y,z);}
+    inline void glProgramUniformMatrix2x3fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x3fv(program,location,count,transpose,value);}
+    inline void glGetFragmentLightivSGIX(GLenum light,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetFragmentLightivSGIX(light,pname,params);}
+    inline const GLubyte* glGetStringi(GLenum name,GLuint index){return ge::gl::getDefaultDirectContext().glGetStringi(name,index);}
+    inline void glWindowPos2svARB(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos2svARB(v);}
+    inline void glVertexAttrib2svNV(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib2svNV(index,v);}
+    inline void glWindowPos2ivARB(const GLint* v){ge::gl::getDefaultDirectContext().glWindowPos2ivARB(v);}
+    inline void glGetVertexAttribPointervNV(GLuint index,GLenum pname,void** pointer){ge::gl::getDefaultDirectContext().glGetVertexAttribPointervNV(index,pname,pointer);}
+    inline void glPushMatrix(){ge::gl::getDefaultDirectContext().glPushMatrix();}
+    inline void glEdgeFlagPointerListIBM(GLint stride,const GLboolean** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glEdgeFlagPointerListIBM(stride,pointer,ptrstride);}
+    inline void glGenerateMipmapEXT(GLenum target){ge::gl::getDefaultDirectContext().glGenerateMipmapEXT(target);}
+    inline void glWindowPos3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos3sv(v);}
+    inline void glPathCoordsNV(GLuint path,GLsizei numCoords,GLenum coordType,const void* coords){ge::gl::getDefaultDirectContext().glPathCoordsNV(path,numCoords,coordType,coords);}
+    inline void glProgramUniform1i(GLuint program,GLint location,GLint v0){ge::gl::getDefaultDirectContext().glProgramUniform1i(program,location,v0);}
+    inline void glProgramUniform1d(GLuint program,GLint location,GLdouble v0){ge::gl::getDefaultDirectContext().glProgramUniform1d(program,location,v0);}
+    inline void glProgramUniform1f(GLuint program,GLint location,GLfloat v0){ge::gl::getDefaultDirectContext().glProgramUniform1f(program,location,v0);}
+    inline void glProgramParameteriEXT(GLuint program,GLenum pname,GLint value){ge::gl::getDefaultDirectContext().glProgramParameteriEXT(program,pname,value);}
+    inline void glCompressedMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLint border,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexImage2DEXT(texunit,target,level,internalformat,width,height,border,imageSize,bits);}
+    inline void glProgramUniform3iv(GLuint program,GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glProgramUniform3iv(program,location,count,value);}
+    inline void glIndexiv(const GLint* c){ge::gl::getDefaultDirectContext().glIndexiv(c);}
+    inline void glMultiTexCoord4xvOES(GLenum texture,const GLfixed* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord4xvOES(texture,coords);}
+    inline void glEGLImageTargetTexture2DOES(GLenum target,GLeglImageOES image){ge::gl::getDefaultDirectContext().glEGLImageTargetTexture2DOES(target,image);}
+    inline void glPixelZoom(GLfloat xfactor,GLfloat yfactor){ge::gl::getDefaultDirectContext().glPixelZoom(xfactor,yfactor);}
+    inline void glVertex3bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glVertex3bvOES(coords);}
+    inline void glFramebufferReadBufferEXT(GLuint framebuffer,GLenum mode){ge::gl::getDefaultDirectContext().glFramebufferReadBufferEXT(framebuffer,mode);}
+    inline void glExtractComponentEXT(GLuint res,GLuint src,GLuint num){ge::gl::getDefaultDirectContext().glExtractComponentEXT(res,src,num);}
+    inline void glCombinerParameterivNV(GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glCombinerParameterivNV(pname,params);}
+    inline void glMinmax(GLenum target,GLenum internalformat,GLboolean sink){ge::gl::getDefaultDirectContext().glMinmax(target,internalformat,sink);}
+    inline void glColorP3ui(GLenum type,GLuint color){ge::gl::getDefaultDirectContext().glColorP3ui(type,color);}
+    inline void glPointParameterfvSGIS(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPointParameterfvSGIS(pname,params);}
+    inline void glBlendEquationi(GLuint buf,GLenum mode){ge::gl::getDefaultDirectContext().glBlendEquationi(buf,mode);}
+    inline void glGetFogFuncSGIS(GLfloat* points){ge::gl::getDefaultDirectContext().glGetFogFuncSGIS(points);}
+    inline void glVertexAttrib4fvNV(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib4fvNV(index,v);}
+    inline void glGetnMinmax(GLenum target,GLboolean reset,GLenum format,GLenum type,GLsizei bufSize,void* values){ge::gl::getDefaultDirectContext().glGetnMinmax(target,reset,format,type,bufSize,values);}
+    inline void glFragmentLightiSGIX(GLenum light,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glFragmentLightiSGIX(light,pname,param);}
+    inline void glMultiTexCoord1bvOES(GLenum texture,const GLbyte* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord1bvOES(texture,coords);}
+    inline void glSecondaryColorPointerEXT(GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glSecondaryColorPointerEXT(size,type,stride,pointer);}
+    inline void glMultiTexCoordP4uiv(GLenum texture,GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glMultiTexCoordP4uiv(texture,type,coords);}
+    inline void glGetBufferSubDataARB(GLenum target,GLintptrARB offset,GLsizeiptrARB size,void* data){ge::gl::getDefaultDirectContext().glGetBufferSubDataARB(target,offset,size,data);}
+    inline void glSecondaryColor3hNV(GLhalfNV red,GLhalfNV green,GLhalfNV blue){ge::gl::getDefaultDirectContext().glSecondaryColor3hNV(red,green,blue);}
+    inline void glGetPathParameterivNV(GLuint path,GLenum pname,GLint* value){ge::gl::getDefaultDirectContext().glGetPathParameterivNV(path,pname,value);}
+    inline void glFlushRasterSGIX(){ge::gl::getDefaultDirectContext().glFlushRasterSGIX();}
+    inline void glElementPointerATI(GLenum type,const void* pointer){ge::gl::getDefaultDirectContext().glElementPointerATI(type,pointer);}
+    inline void glGetAttachedObjectsARB(GLhandleARB containerObj,GLsizei maxCount,GLsizei* count,GLhandleARB* obj){ge::gl::getDefaultDirectContext().glGetAttachedObjectsARB(containerObj,maxCount,count,obj);}
+    inline void glUniform4iv(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform4iv(location,count,value);}
+    inline void glFogxOES(GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glFogxOES(pname,param);}
+    inline void glSharpenTexFuncSGIS(GLenum target,GLsizei n,const GLfloat* points){ge::gl::getDefaultDirectContext().glSharpenTexFuncSGIS(target,n,points);}
+    inline void glClearDepthfOES(GLclampf depth){ge::gl::getDefaultDirectContext().glClearDepthfOES(depth);}
+    inline void glDeleteCommandListsNV(GLsizei n,const GLuint* lists){ge::gl::getDefaultDirectContext().glDeleteCommandListsNV(n,lists);}
+    inline void glSpecializeShader(GLuint shader,const GLchar* pEntryPoint,GLuint numSpecializationConstants,const GLuint* pConstantIndex,const GLuint* pConstantValue){ge::gl::getDefaultDirectContext().glSpecializeShader(shader,pEntryPoint,numSpecializationConstants,pConstantIndex,pConstantValue);}
+    inline void glVertex4hNV(GLhalfNV x,GLhalfNV y,GLhalfNV z,GLhalfNV w){ge::gl::getDefaultDirectContext().glVertex4hNV(x,y,z,w);}
+    inline void glSecondaryColor3dvEXT(const GLdouble* v){ge::gl::getDefaultDirectContext().glSecondaryColor3dvEXT(v);}
+    inline void glGenTextures(GLsizei n,GLuint* textures){ge::gl::getDefaultDirectContext().glGenTextures(n,textures);}
+    inline void glTextureStorage2DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTextureStorage2DMultisample(texture,samples,internalformat,width,height,fixedsamplelocations);}
+    inline void glUniform3ui64vNV(GLint location,GLsizei count,const GLuint64EXT* value){ge::gl::getDefaultDirectContext().glUniform3ui64vNV(location,count,value);}
+    inline void glBlendFuncSeparateIndexedAMD(GLuint buf,GLenum srcRGB,GLenum dstRGB,GLenum srcAlpha,GLenum dstAlpha){ge::gl::getDefaultDirectContext().glBlendFuncSeparateIndexedAMD(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);}
+    inline void glMakeBufferResidentNV(GLenum target,GLenum access){ge::gl::getDefaultDirectContext().glMakeBufferResidentNV(target,access);}
+    inline void glShaderOp2EXT(GLenum op,GLuint res,GLuint arg1,GLuint arg2){ge::gl::getDefaultDirectContext().glShaderOp2EXT(op,res,arg1,arg2);}
+    inline void glGetVertexAttribivNV(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribivNV(index,pname,params);}
+    inline void glTexParameterIivEXT(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTexParameterIivEXT(target,pname,params);}
+    inline void glGetPerfQueryDataINTEL(GLuint queryHandle,GLuint flags,GLsizei dataSize,GLvoid* data,GLuint* bytesWritten){ge::gl::getDefaultDirectContext().glGetPerfQueryDataINTEL(queryHandle,flags,dataSize,data,bytesWritten);}
+    inline void glVertexAttrib4dvARB(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib4dvARB(index,v);}
+    inline void glTextureSubImage1DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage1DEXT(texture,target,level,xoffset,width,format,type,pixels);}
+    inline void glGetActiveUniformBlockName(GLuint program,GLuint uniformBlockIndex,GLsizei bufSize,GLsizei* length,GLchar* uniformBlockName){ge::gl::getDefaultDirectContext().glGetActiveUniformBlockName(program,uniformBlockIndex,bufSize,length,uniformBlockName);}
+    inline void glVertexAttrib2dvARB(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib2dvARB(index,v);}
+    inline void glVertexAttribPointer(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribPointer(index,size,type,normalized,stride,pointer);}
+    inline void glDepthBoundsdNV(GLdouble zmin,GLdouble zmax){ge::gl::getDefaultDirectContext().glDepthBoundsdNV(zmin,zmax);}
+    inline void glDeleteTexturesEXT(GLsizei n,const GLuint* textures){ge::gl::getDefaultDirectContext().glDeleteTexturesEXT(n,textures);}
+    inline void glDrawBuffersATI(GLsizei n,const GLenum* bufs){ge::gl::getDefaultDirectContext().glDrawBuffersATI(n,bufs);}
+    inline void glLightModelxvOES(GLenum pname,const GLfixed* param){ge::gl::getDefaultDirectContext().glLightModelxvOES(pname,param);}
+    inline void glApplyTextureEXT(GLenum mode){ge::gl::getDefaultDirectContext().glApplyTextureEXT(mode);}
+    inline GLuint64 glGetImageHandleNV(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format){return ge::gl::getDefaultDirectContext().glGetImageHandleNV(texture,level,layered,layer,format);}
+    inline void glGetMinmax(GLenum target,GLboolean reset,GLenum format,GLenum types,GLvoid* values){ge::gl::getDefaultDirectContext().glGetMinmax(target,reset,format,types,values);}
+    inline void glGetFixedvOES(GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetFixedvOES(pname,params);}
+    inline void glSamplePatternEXT(GLenum pattern){ge::gl::getDefaultDirectContext().glSamplePatternEXT(pattern);}
+    inline void glUniform1f(GLint location,GLfloat v0){ge::gl::getDefaultDirectContext().glUniform1f(location,v0);}
+    inline void glColor4fNormal3fVertex3fSUN(GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glColor4fNormal3fVertex3fSUN(r,g,b,a,nx,ny,nz,x,y,z);}
+    inline void glFogCoorddvEXT(const GLdouble* coord){ge::gl::getDefaultDirectContext().glFogCoorddvEXT(coord);}
+    inline void glCopyTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLint border){ge::gl::getDefaultDirectContext().glCopyTextureImage1DEXT(texture,target,level,internalformat,x,y,width,border);}
+    inline void glFlushMappedBufferRangeAPPLE(GLenum target,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glFlushMappedBufferRangeAPPLE(target,offset,size);}
+    inline void glVertex3sv(const GLshort* v){ge::gl::getDefaultDirectContext().glVertex3sv(v);}
+    inline void glFlushStaticDataIBM(GLenum target){ge::gl::getDefaultDirectContext().glFlushStaticDataIBM(target);}
+    inline void glProgramUniform4ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w){ge::gl::getDefaultDirectContext().glProgramUniform4ui64NV(program,location,x,y,z,w);}
+    inline void glRasterPos4xOES(GLfixed x,GLfixed y,GLfixed z,GLfixed w){ge::gl::getDefaultDirectContext().glRasterPos4xOES(x,y,z,w);}
+    inline void glVertexAttribP1ui(GLuint index,GLenum type,GLboolean normalized,GLuint value){ge::gl::getDefaultDirectContext().glVertexAttribP1ui(index,type,normalized,value);}
+    inline void glProgramUniform4dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform4dvEXT(program,location,count,value);}
+    inline void glEndTransformFeedbackEXT(){ge::gl::getDefaultDirectContext().glEndTransformFeedbackEXT();}
+    inline void glBinormal3dEXT(GLdouble bx,GLdouble by,GLdouble bz){ge::gl::getDefaultDirectContext().glBinormal3dEXT(bx,by,bz);}
+    inline void glGetTextureSubImage(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetTextureSubImage(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,bufSize,pixels);}
+    inline void glGetNamedRenderbufferParameteriv(GLuint renderbuffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedRenderbufferParameteriv(renderbuffer,pname,params);}
+    inline void glBindBuffersRange(GLenum target,GLuint first,GLsizei count,const GLuint* buffers,const GLintptr* offsets,const GLsizeiptr* sizes){ge::gl::getDefaultDirectContext().glBindBuffersRange(target,first,count,buffers,offsets,sizes);}
+    inline GLint glFinishAsyncSGIX(GLuint* markerp){return ge::gl::getDefaultDirectContext().glFinishAsyncSGIX(markerp);}
+    inline void glBindFragDataLocationIndexed(GLuint program,GLuint colorNumber,GLuint index,const GLchar* name){ge::gl::getDefaultDirectContext().glBindFragDataLocationIndexed(program,colorNumber,index,name);}
+    inline void glMultiTexCoord2dv(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2dv(target,v);}
+    inline void glUniform2iv(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform2iv(location,count,value);}
+    inline void glProgramUniform2i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform2i64vNV(program,location,count,value);}
+    inline void glFlushVertexArrayRangeAPPLE(GLsizei length,void* pointer){ge::gl::getDefaultDirectContext().glFlushVertexArrayRangeAPPLE(length,pointer);}
+    inline void glTextureParameterf(GLuint texture,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glTextureParameterf(texture,pname,param);}
+    inline void glMultiTexCoord3dvARB(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3dvARB(target,v);}
+    inline void glFeedbackBuffer(GLsizei size,GLenum type,GLfloat* buffer){ge::gl::getDefaultDirectContext().glFeedbackBuffer(size,type,buffer);}
+    inline void glDebugMessageInsertARB(GLenum source,GLenum type,GLuint id,GLenum severity,GLsizei length,const GLchar* buf){ge::gl::getDefaultDirectContext().glDebugMessageInsertARB(source,type,id,severity,length,buf);}
+    inline void glMultiTexCoord2i(GLenum target,GLint s,GLint t){ge::gl::getDefaultDirectContext().glMultiTexCoord2i(target,s,t);}
+    inline void glTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,width,height,depth,format,type,pixels);}
+    inline void glFramebufferTexture1D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTexture1D(target,attachment,textarget,texture,level);}
+    inline void glGetShaderiv(GLuint shader,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetShaderiv(shader,pname,params);}
+    inline void glMultiTexCoord2d(GLenum target,GLdouble s,GLdouble t){ge::gl::getDefaultDirectContext().glMultiTexCoord2d(target,s,t);}
+    inline void glArrayObjectATI(GLenum array,GLint size,GLenum type,GLsizei stride,GLuint buffer,GLuint offset){ge::gl::getDefaultDirectContext().glArrayObjectATI(array,size,type,stride,buffer,offset);}
+    inline void glGetPointeri_vEXT(GLenum pname,GLuint index,void** params){ge::gl::getDefaultDirectContext().glGetPointeri_vEXT(pname,index,params);}
+    inline void glGetPerfMonitorCountersAMD(GLuint group,GLint* numCounters,GLint* maxActiveCounters,GLsizei counterSize,GLuint* counters){ge::gl::getDefaultDirectContext().glGetPerfMonitorCountersAMD(group,numCounters,maxActiveCounters,counterSize,counters);}
+    inline void glNamedBufferStorage(GLuint buffer,GLsizeiptr size,const void* data,GLbitfield flags){ge::gl::getDefaultDirectContext().glNamedBufferStorage(buffer,size,data,flags);}
+    inline void glTexEnvxvOES(GLenum target,GLenum pname,const GLfixed* params){ge::gl::getDefaultDirectContext().glTexEnvxvOES(target,pname,params);}
+    inline void glProgramUniform2ui64NV(GLuint program,GLint location,GLuint64EXT x,GLuint64EXT y){ge::gl::getDefaultDirectContext().glProgramUniform2ui64NV(program,location,x,y);}
+    inline void glMultiTexCoord3bOES(GLenum texture,GLbyte s,GLbyte t,GLbyte r){ge::gl::getDefaultDirectContext().glMultiTexCoord3bOES(texture,s,t,r);}
+    inline void glUniform1dv(GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniform1dv(location,count,value);}
+    inline void glPixelTransferi(GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glPixelTransferi(pname,param);}
+    inline void glSecondaryColor3usvEXT(const GLushort* v){ge::gl::getDefaultDirectContext().glSecondaryColor3usvEXT(v);}
+    inline void glProgramEnvParameterI4uivNV(GLenum target,GLuint index,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramEnvParameterI4uivNV(target,index,params);}
+    inline void glVertex2sv(const GLshort* v){ge::gl::getDefaultDirectContext().glVertex2sv(v);}
+    inline void glWindowPos4dMESA(GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glWindowPos4dMESA(x,y,z,w);}
+    inline void glDebugMessageControlARB(GLenum source,GLenum type,GLenum severity,GLsizei count,const GLuint* ids,GLboolean enabled){ge::gl::getDefaultDirectContext().glDebugMessageControlARB(source,type,severity,count,ids,enabled);}
+    inline GLboolean glIsTextureEXT(GLuint texture){return ge::gl::getDefaultDirectContext().glIsTextureEXT(texture);}
+    inline void glFragmentMaterialivSGIX(GLenum face,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glFragmentMaterialivSGIX(face,pname,params);}
+    inline void glLinkProgramARB(GLhandleARB programObj){ge::gl::getDefaultDirectContext().glLinkProgramARB(programObj);}
+    inline void glFinishFenceAPPLE(GLuint fence){ge::gl::getDefaultDirectContext().glFinishFenceAPPLE(fence);}
+    inline void glVertexArrayVertexAttribBindingEXT(GLuint vaobj,GLuint attribindex,GLuint bindingindex){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribBindingEXT(vaobj,attribindex,bindingindex);}
+    inline void glTexStorageMem3DMultisampleEXT(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTexStorageMem3DMultisampleEXT(target,samples,internalFormat,width,height,depth,fixedSampleLocations,memory,offset);}
+    inline void glUniform1ui64vARB(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniform1ui64vARB(location,count,value);}
+    inline void glMultiTexCoord4fv(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4fv(target,v);}
+    inline void glMulticastFramebufferSampleLocationsfvNV(GLuint gpu,GLuint framebuffer,GLuint start,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glMulticastFramebufferSampleLocationsfvNV(gpu,framebuffer,start,count,v);}
+    inline void glRasterPos3d(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glRasterPos3d(x,y,z);}
+    inline GLint glPollAsyncSGIX(GLuint* markerp){return ge::gl::getDefaultDirectContext().glPollAsyncSGIX(markerp);}
+    inline void glRasterPos3f(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glRasterPos3f(x,y,z);}
+    inline void glCompressedTexImage3D(GLenum target,GLint level,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint border,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexImage3D(target,level,internalformat,width,height,depth,border,imageSize,data);}
+    inline void glVariantivEXT(GLuint id,const GLint* addr){ge::gl::getDefaultDirectContext().glVariantivEXT(id,addr);}
+    inline void glUnmapTexture2DINTEL(GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glUnmapTexture2DINTEL(texture,level);}
+    inline void glMulticastWaitSyncNV(GLuint signalGpu,GLbitfield waitGpuMask){ge::gl::getDefaultDirectContext().glMulticastWaitSyncNV(signalGpu,waitGpuMask);}
+    inline void glGetVertexAttribiv(GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribiv(index,pname,params);}
+    inline void glGetPathCoordsNV(GLuint path,GLfloat* coords){ge::gl::getDefaultDirectContext().glGetPathCoordsNV(path,coords);}
+    inline void glColor4xvOES(const GLfixed* components){ge::gl::getDefaultDirectContext().glColor4xvOES(components);}
+    inline void glVertexAttrib3fv(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib3fv(index,v);}
+    inline void glRasterPos3s(GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glRasterPos3s(x,y,z);}
+    inline void glVertex4bOES(GLbyte x,GLbyte y,GLbyte z,GLbyte w){ge::gl::getDefaultDirectContext().glVertex4bOES(x,y,z,w);}
+    inline void glTransformFeedbackVaryingsEXT(GLuint program,GLsizei count,const GLchar*const* varyings,GLenum bufferMode){ge::gl::getDefaultDirectContext().glTransformFeedbackVaryingsEXT(program,count,varyings,bufferMode);}
+    inline void glCombinerOutputNV(GLenum stage,GLenum portion,GLenum abOutput,GLenum cdOutput,GLenum sumOutput,GLenum scale,GLenum bias,GLboolean abDotProduct,GLboolean cdDotProduct,GLboolean muxSum){ge::gl::getDefaultDirectContext().glCombinerOutputNV(stage,portion,abOutput,cdOutput,sumOutput,scale,bias,abDotProduct,cdDotProduct,muxSum);}
+    inline void glWindowPos4sMESA(GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glWindowPos4sMESA(x,y,z,w);}
+    inline void glVertexAttrib4svARB(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4svARB(index,v);}
+    inline GLboolean glIsList(GLuint list){return ge::gl::getDefaultDirectContext().glIsList(list);}
+    inline void glGetInfoLogARB(GLhandleARB obj,GLsizei maxLength,GLsizei* length,GLcharARB* infoLog){ge::gl::getDefaultDirectContext().glGetInfoLogARB(obj,maxLength,length,infoLog);}
+    inline void glUniformMatrix2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix2fv(location,count,transpose,value);}
+    inline void glVertexAttribs3dvNV(GLuint index,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribs3dvNV(index,count,v);}
+    inline void glGlobalAlphaFactorsSUN(GLshort factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactorsSUN(factor);}
+    inline void glGetTrackMatrixivNV(GLenum target,GLuint address,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTrackMatrixivNV(target,address,pname,params);}
+    inline void glTextureParameterfvEXT(GLuint texture,GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glTextureParameterfvEXT(texture,target,pname,params);}
+    inline GLboolean glIsNamedBufferResidentNV(GLuint buffer){return ge::gl::getDefaultDirectContext().glIsNamedBufferResidentNV(buffer);}
+    inline void glProgramUniform4ui64vARB(GLuint program,GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glProgramUniform4ui64vARB(program,location,count,value);}
+    inline void glTbufferMask3DFX(GLuint mask){ge::gl::getDefaultDirectContext().glTbufferMask3DFX(mask);}
+    inline void glCoverFillPathNV(GLuint path,GLenum coverMode){ge::gl::getDefaultDirectContext().glCoverFillPathNV(path,coverMode);}
+    inline void glVertexAttrib1fvARB(GLuint index,const GLfloat* v){ge::gl::getDefaultDirectContext().glVertexAttrib1fvARB(index,v);}
+    inline void glGenerateTextureMipmap(GLuint texture){ge::gl::getDefaultDirectContext().glGenerateTextureMipmap(texture);}
+    inline void glNamedProgramLocalParameterI4uivEXT(GLuint program,GLenum target,GLuint index,const GLuint* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameterI4uivEXT(program,target,index,params);}
+    inline void glMultiDrawElementsBaseVertex(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei drawcount,const GLint* basevertex){ge::gl::getDefaultDirectContext().glMultiDrawElementsBaseVertex(mode,count,type,indices,drawcount,basevertex);}
+    inline void glProgramSubroutineParametersuivNV(GLenum target,GLsizei count,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramSubroutineParametersuivNV(target,count,params);}
+    inline void glProgramUniformMatrix2x4dvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2x4dvEXT(program,location,count,transpose,value);}
+    inline void glRotatexOES(GLfixed angle,GLfixed x,GLfixed y,GLfixed z){ge::gl::getDefaultDirectContext().glRotatexOES(angle,x,y,z);}
+    inline void glMemoryBarrierEXT(GLbitfield barriers){ge::gl::getDefaultDirectContext().glMemoryBarrierEXT(barriers);}
+    inline void glVertexAttrib3svNV(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib3svNV(index,v);}
+    inline void glVertexStream3iATI(GLenum stream,GLint x,GLint y,GLint z){ge::gl::getDefaultDirectContext().glVertexStream3iATI(stream,x,y,z);}
+    inline void glCompressedTexSubImage1D(GLenum target,GLint level,GLint xoffset,GLsizei width,GLenum format,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage1D(target,level,xoffset,width,format,imageSize,data);}
+    inline void glSetFenceNV(GLuint fence,GLenum condition){ge::gl::getDefaultDirectContext().glSetFenceNV(fence,condition);}
+    inline void glAttachObjectARB(GLhandleARB containerObj,GLhandleARB obj){ge::gl::getDefaultDirectContext().glAttachObjectARB(containerObj,obj);}
+    inline void glCopyConvolutionFilter1D(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyConvolutionFilter1D(target,internalformat,x,y,width);}
+    inline void glTexStorageMem2DMultisampleEXT(GLenum target,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTexStorageMem2DMultisampleEXT(target,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+    inline void glProgramParameters4fvNV(GLenum target,GLuint index,GLsizei count,const GLfloat* v){ge::gl::getDefaultDirectContext().glProgramParameters4fvNV(target,index,count,v);}
+    inline void glNamedFramebufferParameteriEXT(GLuint framebuffer,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glNamedFramebufferParameteriEXT(framebuffer,pname,param);}
+    inline void glVertexAttrib4Nsv(GLuint index,const GLshort* v){ge::gl::getDefaultDirectContext().glVertexAttrib4Nsv(index,v);}
+    inline void glVertexAttribI4usvEXT(GLuint index,const GLushort* v){ge::gl::getDefaultDirectContext().glVertexAttribI4usvEXT(index,v);}
+    inline void glTextureBufferRangeEXT(GLuint texture,GLenum target,GLenum internalformat,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glTextureBufferRangeEXT(texture,target,internalformat,buffer,offset,size);}
+    inline void glVertexP3uiv(GLenum type,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexP3uiv(type,value);}
+    inline GLboolean glIsPathNV(GLuint path){return ge::gl::getDefaultDirectContext().glIsPathNV(path);}
+    inline void glGetnUniformi64vARB(GLuint program,GLint location,GLsizei bufSize,GLint64* params){ge::gl::getDefaultDirectContext().glGetnUniformi64vARB(program,location,bufSize,params);}
+    inline void glFramebufferTextureMultiviewOVR(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint baseViewIndex,GLsizei numViews){ge::gl::getDefaultDirectContext().glFramebufferTextureMultiviewOVR(target,attachment,texture,level,baseViewIndex,numViews);}
+    inline void glCompressedMultiTexSubImage2DEXT(GLenum texunit,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedMultiTexSubImage2DEXT(texunit,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+    inline void glGetnMapdv(GLenum target,GLenum query,GLsizei bufSize,GLdouble* v){ge::gl::getDefaultDirectContext().glGetnMapdv(target,query,bufSize,v);}
+    inline void glDebugMessageCallback(GLDEBUGPROC callback,const void* userParam){ge::gl::getDefaultDirectContext().glDebugMessageCallback(callback,userParam);}
+    inline void glTangent3svEXT(const GLshort* v){ge::gl::getDefaultDirectContext().glTangent3svEXT(v);}
+    inline void glVertexAttribParameteriAMD(GLuint index,GLenum pname,GLint param){ge::gl::getDefaultDirectContext().glVertexAttribParameteriAMD(index,pname,param);}
+    inline void glBufferSubDataARB(GLenum target,GLintptrARB offset,GLsizeiptrARB size,const void* data){ge::gl::getDefaultDirectContext().glBufferSubDataARB(target,offset,size,data);}
+    inline void glGetVertexAttribLui64vARB(GLuint index,GLenum pname,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetVertexAttribLui64vARB(index,pname,params);}
+    inline void glVertexAttribL4ui64NV(GLuint index,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w){ge::gl::getDefaultDirectContext().glVertexAttribL4ui64NV(index,x,y,z,w);}
+    inline void glReplacementCodeuiColor4ubVertex3fSUN(GLuint rc,GLubyte r,GLubyte g,GLubyte b,GLubyte a,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiColor4ubVertex3fSUN(rc,r,g,b,a,x,y,z);}
+    inline void glImageTransformParameterfHP(GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glImageTransformParameterfHP(target,pname,param);}
+    inline void glMap1f(GLenum target,GLfloat u1,GLfloat u2,GLint stride,GLint order,const GLfloat* points){ge::gl::getDefaultDirectContext().glMap1f(target,u1,u2,stride,order,points);}
+    inline void glRasterPos4fv(const GLfloat* v){ge::gl::getDefaultDirectContext().glRasterPos4fv(v);}
+    inline void glVertex2bvOES(const GLbyte* coords){ge::gl::getDefaultDirectContext().glVertex2bvOES(coords);}
+    inline void glGetMapControlPointsNV(GLenum target,GLuint index,GLenum type,GLsizei ustride,GLsizei vstride,GLboolean packed,void* points){ge::gl::getDefaultDirectContext().glGetMapControlPointsNV(target,index,type,ustride,vstride,packed,points);}
+    inline void glNamedProgramLocalParametersI4ivEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLint* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParametersI4ivEXT(program,target,index,count,params);}
+    inline void glBindBufferRangeNV(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glBindBufferRangeNV(target,index,buffer,offset,size);}
+    inline void glVertexStream3dvATI(GLenum stream,const GLdouble* coords){ge::gl::getDefaultDirectContext().glVertexStream3dvATI(stream,coords);}
+    inline void glNormalPointerListIBM(GLenum type,GLint stride,const void** pointer,GLint ptrstride){ge::gl::getDefaultDirectContext().glNormalPointerListIBM(type,stride,pointer,ptrstride);}
+    inline void glFogFuncSGIS(GLsizei n,const GLfloat* points){ge::gl::getDefaultDirectContext().glFogFuncSGIS(n,points);}
+    inline void glMultiModeDrawArraysIBM(const GLenum* mode,const GLint* first,const GLsizei* count,GLsizei primcount,GLint modestride){ge::gl::getDefaultDirectContext().glMultiModeDrawArraysIBM(mode,first,count,primcount,modestride);}
+    inline void glGetNamedFramebufferAttachmentParameterivEXT(GLuint framebuffer,GLenum attachment,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedFramebufferAttachmentParameterivEXT(framebuffer,attachment,pname,params);}
+    inline void glGetFloatv(GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetFloatv(pname,params);}
+    inline void glVertexArrayVertexAttribIFormatEXT(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayVertexAttribIFormatEXT(vaobj,attribindex,size,type,relativeoffset);}
+    inline void glHint(GLenum target,GLenum mode){ge::gl::getDefaultDirectContext().glHint(target,mode);}
+    inline void glVertexStream2svATI(GLenum stream,const GLshort* coords){ge::gl::getDefaultDirectContext().glVertexStream2svATI(stream,coords);}
+    inline void glMultiDrawArraysIndirect(GLenum mode,const void* indirect,GLsizei drawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawArraysIndirect(mode,indirect,drawcount,stride);}
+    inline void glMultiTexEnvfvEXT(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glMultiTexEnvfvEXT(texunit,target,pname,params);}
+    inline void glVertexAttribP2uiv(GLuint index,GLenum type,GLboolean normalized,const GLuint* value){ge::gl::getDefaultDirectContext().glVertexAttribP2uiv(index,type,normalized,value);}
+    inline void glProgramUniform1i64vARB(GLuint program,GLint location,GLsizei count,const GLint64* value){ge::gl::getDefaultDirectContext().glProgramUniform1i64vARB(program,location,count,value);}
+    inline void glFramebufferTextureARB(GLenum target,GLenum attachment,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glFramebufferTextureARB(target,attachment,texture,level);}
+    inline void glPushClientAttribDefaultEXT(GLbitfield mask){ge::gl::getDefaultDirectContext().glPushClientAttribDefaultEXT(mask);}
+    inline void glScalef(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glScalef(x,y,z);}
+    inline void glScaled(GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glScaled(x,y,z);}
+    inline void glGetConvolutionParameterxvOES(GLenum target,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetConvolutionParameterxvOES(target,pname,params);}
+    inline void glGetProgramResourceName(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei* length,GLchar* name){ge::gl::getDefaultDirectContext().glGetProgramResourceName(program,programInterface,index,bufSize,length,name);}
+    inline void glCopyColorTable(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyColorTable(target,internalformat,x,y,width);}
+    inline void glDepthRangeArrayv(GLuint first,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glDepthRangeArrayv(first,count,v);}
+    inline void glCoverFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum coverMode,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glCoverFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,coverMode,transformType,transformValues);}
+    inline void glMultiTexParameterivEXT(GLenum texunit,GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMultiTexParameterivEXT(texunit,target,pname,params);}
+    inline void glGetActiveAtomicCounterBufferiv(GLuint program,GLuint bufferIndex,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetActiveAtomicCounterBufferiv(program,bufferIndex,pname,params);}
+    inline void glStencilOpSeparate(GLenum face,GLenum sfail,GLenum dpfail,GLenum dppass){ge::gl::getDefaultDirectContext().glStencilOpSeparate(face,sfail,dpfail,dppass);}
+    inline void glVertexAttrib4fNV(GLuint index,GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glVertexAttrib4fNV(index,x,y,z,w);}
+    inline void glGetColorTableParameterivSGI(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetColorTableParameterivSGI(target,pname,params);}
+    inline void glVertexArrayAttribBinding(GLuint vaobj,GLuint attribindex,GLuint bindingindex){ge::gl::getDefaultDirectContext().glVertexArrayAttribBinding(vaobj,attribindex,bindingindex);}
+    inline GLboolean glIsSemaphoreEXT(GLuint semaphore){return ge::gl::getDefaultDirectContext().glIsSemaphoreEXT(semaphore);}
+    inline void glProgramParameters4dvNV(GLenum target,GLuint index,GLsizei count,const GLdouble* v){ge::gl::getDefaultDirectContext().glProgramParameters4dvNV(target,index,count,v);}
+    inline void glVertexAttribL4dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttribL4dv(index,v);}
+    inline void glGetTexParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexParameteriv(target,pname,params);}
+    inline GLintptr glGetUniformOffsetEXT(GLuint program,GLint location){return ge::gl::getDefaultDirectContext().glGetUniformOffsetEXT(program,location);}
+    inline void glGetVertexAttribPointerv(GLuint index,GLenum pname,void** pointer){ge::gl::getDefaultDirectContext().glGetVertexAttribPointerv(index,pname,pointer);}
+    inline void glResumeTransformFeedbackNV(){ge::gl::getDefaultDirectContext().glResumeTransformFeedbackNV();}
+    inline void glProgramUniform3i64vNV(GLuint program,GLint location,GLsizei count,const GLint64EXT* value){ge::gl::getDefaultDirectContext().glProgramUniform3i64vNV(program,location,count,value);}
+    inline void glTangent3fEXT(GLfloat tx,GLfloat ty,GLfloat tz){ge::gl::getDefaultDirectContext().glTangent3fEXT(tx,ty,tz);}
+    inline void glGetPathMetricRangeNV(GLbitfield metricQueryMask,GLuint firstPathName,GLsizei numPaths,GLsizei stride,GLfloat* metrics){ge::gl::getDefaultDirectContext().glGetPathMetricRangeNV(metricQueryMask,firstPathName,numPaths,stride,metrics);}
+    inline void glWindowPos2iMESA(GLint x,GLint y){ge::gl::getDefaultDirectContext().glWindowPos2iMESA(x,y);}
+    inline void glVertex2xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glVertex2xvOES(coords);}
+    inline void glGetnCompressedTexImage(GLenum target,GLint lod,GLsizei bufSize,void* pixels){ge::gl::getDefaultDirectContext().glGetnCompressedTexImage(target,lod,bufSize,pixels);}
+    inline void glWindowPos2dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos2dv(v);}
+    inline void glReplacementCodeuiVertex3fSUN(GLuint rc,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glReplacementCodeuiVertex3fSUN(rc,x,y,z);}
+    inline void glGetTransformFeedbackVaryingEXT(GLuint program,GLuint index,GLsizei bufSize,GLsizei* length,GLsizei* size,GLenum* type,GLchar* name){ge::gl::getDefaultDirectContext().glGetTransformFeedbackVaryingEXT(program,index,bufSize,length,size,type,name);}
+    inline void glWindowPos3fARB(GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glWindowPos3fARB(x,y,z);}
+    inline void* glMapNamedBufferEXT(GLuint buffer,GLenum access){return ge::gl::getDefaultDirectContext().glMapNamedBufferEXT(buffer,access);}
+    inline void glDisable(GLenum cap){ge::gl::getDefaultDirectContext().glDisable(cap);}
+    inline GLboolean glIsPointInFillPathNV(GLuint path,GLuint mask,GLfloat x,GLfloat y){return ge::gl::getDefaultDirectContext().glIsPointInFillPathNV(path,mask,x,y);}
+    inline void glVertexAttribI2uiEXT(GLuint index,GLuint x,GLuint y){ge::gl::getDefaultDirectContext().glVertexAttribI2uiEXT(index,x,y);}
+    inline void glProgramUniform4uiv(GLuint program,GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glProgramUniform4uiv(program,location,count,value);}
+    inline void glQueryCounter(GLuint id,GLenum target){ge::gl::getDefaultDirectContext().glQueryCounter(id,target);}
+    inline void glFramebufferRenderbufferEXT(GLenum target,GLenum attachment,GLenum renderbuffertarget,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glFramebufferRenderbufferEXT(target,attachment,renderbuffertarget,renderbuffer);}
+    inline void glBinormal3svEXT(const GLshort* v){ge::gl::getDefaultDirectContext().glBinormal3svEXT(v);}
+    inline void glBindBufferOffsetNV(GLenum target,GLuint index,GLuint buffer,GLintptr offset){ge::gl::getDefaultDirectContext().glBindBufferOffsetNV(target,index,buffer,offset);}
+    inline void glCopyTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTextureSubImage2D(texture,level,xoffset,yoffset,x,y,width,height);}
+    inline void glGetProgramResourcefvNV(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,const GLenum* props,GLsizei bufSize,GLsizei* length,GLfloat* params){ge::gl::getDefaultDirectContext().glGetProgramResourcefvNV(program,programInterface,index,propCount,props,bufSize,length,params);}
+    inline void glBinormalPointerEXT(GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glBinormalPointerEXT(type,stride,pointer);}
+    inline void glGetLightfv(GLenum light,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetLightfv(light,pname,params);}
+    inline void glMulticastCopyImageSubDataNV(GLuint srcGpu,GLbitfield dstGpuMask,GLuint srcName,GLenum srcTarget,GLint srcLevel,GLint srcX,GLint srcY,GLint srcZ,GLuint dstName,GLenum dstTarget,GLint dstLevel,GLint dstX,GLint dstY,GLint dstZ,GLsizei srcWidth,GLsizei srcHeight,GLsizei srcDepth){ge::gl::getDefaultDirectContext().glMulticastCopyImageSubDataNV(srcGpu,dstGpuMask,srcName,srcTarget,srcLevel,srcX,srcY,srcZ,dstName,dstTarget,dstLevel,dstX,dstY,dstZ,srcWidth,srcHeight,srcDepth);}
+    inline void glVertex2bOES(GLbyte x,GLbyte y){ge::gl::getDefaultDirectContext().glVertex2bOES(x,y);}
+    inline void glUniform2ivARB(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform2ivARB(location,count,value);}
+    inline void glMultiTexCoord3s(GLenum target,GLshort s,GLshort t,GLshort r){ge::gl::getDefaultDirectContext().glMultiTexCoord3s(target,s,t,r);}
+    inline void glGetHistogramParameterfvEXT(GLenum target,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetHistogramParameterfvEXT(target,pname,params);}
+    inline void glGetProgramStringNV(GLuint id,GLenum pname,GLubyte* program){ge::gl::getDefaultDirectContext().glGetProgramStringNV(id,pname,program);}
+    inline void glGetTexGenxvOES(GLenum coord,GLenum pname,GLfixed* params){ge::gl::getDefaultDirectContext().glGetTexGenxvOES(coord,pname,params);}
+    inline void glTextureSubImage2D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureSubImage2D(texture,level,xoffset,yoffset,width,height,format,type,pixels);}
+    inline GLenum glObjectPurgeableAPPLE(GLenum objectType,GLuint name,GLenum option){return ge::gl::getDefaultDirectContext().glObjectPurgeableAPPLE(objectType,name,option);}
+    inline void glColorTableSGI(GLenum target,GLenum internalformat,GLsizei width,GLenum format,GLenum type,const void* table){ge::gl::getDefaultDirectContext().glColorTableSGI(target,internalformat,width,format,type,table);}
+    inline void glCopyConvolutionFilter2DEXT(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyConvolutionFilter2DEXT(target,internalformat,x,y,width,height);}
+    inline void glMultiTexCoord3f(GLenum target,GLfloat s,GLfloat t,GLfloat r){ge::gl::getDefaultDirectContext().glMultiTexCoord3f(target,s,t,r);}
+    inline void glMultiTexCoord3d(GLenum target,GLdouble s,GLdouble t,GLdouble r){ge::gl::getDefaultDirectContext().glMultiTexCoord3d(target,s,t,r);}
+    inline void glFogCoorddv(const GLdouble* coord){ge::gl::getDefaultDirectContext().glFogCoorddv(coord);}
+    inline void glGetBufferPointerv(GLenum target,GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetBufferPointerv(target,pname,params);}
+    inline void glProgramUniform1fEXT(GLuint program,GLint location,GLfloat v0){ge::gl::getDefaultDirectContext().glProgramUniform1fEXT(program,location,v0);}
+    inline void glWindowPos2fvMESA(const GLfloat* v){ge::gl::getDefaultDirectContext().glWindowPos2fvMESA(v);}
+    inline void glAlphaToCoverageDitherControlNV(GLenum mode){ge::gl::getDefaultDirectContext().glAlphaToCoverageDitherControlNV(mode);}
+    inline void glPolygonOffsetxOES(GLfixed factor,GLfixed units){ge::gl::getDefaultDirectContext().glPolygonOffsetxOES(factor,units);}
+    inline void glVertexAttrib4dARB(GLuint index,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertexAttrib4dARB(index,x,y,z,w);}
+    inline void glUniformHandleui64vARB(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniformHandleui64vARB(location,count,value);}
+    inline void glFragmentLightModelfvSGIX(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glFragmentLightModelfvSGIX(pname,params);}
+    inline void glSwizzleEXT(GLuint res,GLuint in,GLenum outX,GLenum outY,GLenum outZ,GLenum outW){ge::gl::getDefaultDirectContext().glSwizzleEXT(res,in,outX,outY,outZ,outW);}
+    inline void glBindFragmentShaderATI(GLuint id){ge::gl::getDefaultDirectContext().glBindFragmentShaderATI(id);}
+    inline void glVertexAttribs3hvNV(GLuint index,GLsizei n,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttribs3hvNV(index,n,v);}
+    inline void glGenBuffersARB(GLsizei n,GLuint* buffers){ge::gl::getDefaultDirectContext().glGenBuffersARB(n,buffers);}
+    inline void glTextureStorageMem2DMultisampleEXT(GLuint texture,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTextureStorageMem2DMultisampleEXT(texture,samples,internalFormat,width,height,fixedSampleLocations,memory,offset);}
+    inline void glListParameterfvSGIX(GLuint list,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glListParameterfvSGIX(list,pname,params);}
+    inline void glNamedRenderbufferStorageMultisample(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glNamedRenderbufferStorageMultisample(renderbuffer,samples,internalformat,width,height);}
+    inline void glVertexAttribI1iEXT(GLuint index,GLint x){ge::gl::getDefaultDirectContext().glVertexAttribI1iEXT(index,x);}
+    inline void glMultiTexCoord2ivARB(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2ivARB(target,v);}
+    inline void glLightModelxOES(GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glLightModelxOES(pname,param);}
+    inline void glColor3xOES(GLfixed red,GLfixed green,GLfixed blue){ge::gl::getDefaultDirectContext().glColor3xOES(red,green,blue);}
+    inline void glReadBuffer(GLenum mode){ge::gl::getDefaultDirectContext().glReadBuffer(mode);}
+    inline void glStencilFillPathInstancedNV(GLsizei numPaths,GLenum pathNameType,const void* paths,GLuint pathBase,GLenum fillMode,GLuint mask,GLenum transformType,const GLfloat* transformValues){ge::gl::getDefaultDirectContext().glStencilFillPathInstancedNV(numPaths,pathNameType,paths,pathBase,fillMode,mask,transformType,transformValues);}
+    inline void glVDPAUUnmapSurfacesNV(GLsizei numSurface,const GLvdpauSurfaceNV* surfaces){ge::gl::getDefaultDirectContext().glVDPAUUnmapSurfacesNV(numSurface,surfaces);}
+    inline void glProgramUniform4i64NV(GLuint program,GLint location,GLint64EXT x,GLint64EXT y,GLint64EXT z,GLint64EXT w){ge::gl::getDefaultDirectContext().glProgramUniform4i64NV(program,location,x,y,z,w);}
+    inline void glVertexStream4dvATI(GLenum stream,const GLdouble* coords){ge::gl::getDefaultDirectContext().glVertexStream4dvATI(stream,coords);}
+    inline GLboolean glIsQuery(GLuint id){return ge::gl::getDefaultDirectContext().glIsQuery(id);}
+    inline void glProgramUniformMatrix4fvEXT(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4fvEXT(program,location,count,transpose,value);}
+    inline void glVertexAttrib3hNV(GLuint index,GLhalfNV x,GLhalfNV y,GLhalfNV z){ge::gl::getDefaultDirectContext().glVertexAttrib3hNV(index,x,y,z);}
+    inline void glFlushMappedNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length){ge::gl::getDefaultDirectContext().glFlushMappedNamedBufferRange(buffer,offset,length);}
+    inline void glPushName(GLuint name){ge::gl::getDefaultDirectContext().glPushName(name);}
+    inline void glGetClipPlane(GLenum plane,GLdouble* equation){ge::gl::getDefaultDirectContext().glGetClipPlane(plane,equation);}
+    inline void glVertex4dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glVertex4dv(v);}
+    inline void glVertexAttrib3d(GLuint index,GLdouble x,GLdouble y,GLdouble z){ge::gl::getDefaultDirectContext().glVertexAttrib3d(index,x,y,z);}
+    inline void glBlendColor(GLfloat red,GLfloat green,GLfloat blue,GLfloat alpha){ge::gl::getDefaultDirectContext().glBlendColor(red,green,blue,alpha);}
+    inline void glBindTransformFeedbackNV(GLenum target,GLuint id){ge::gl::getDefaultDirectContext().glBindTransformFeedbackNV(target,id);}
+    inline void glSamplerParameterIuiv(GLuint sampler,GLenum pname,const GLuint* param){ge::gl::getDefaultDirectContext().glSamplerParameterIuiv(sampler,pname,param);}
+    inline void glIndexubv(const GLubyte* c){ge::gl::getDefaultDirectContext().glIndexubv(c);}
+    inline void glNamedBufferPageCommitmentEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,GLboolean commit){ge::gl::getDefaultDirectContext().glNamedBufferPageCommitmentEXT(buffer,offset,size,commit);}
+    inline GLenum glCheckNamedFramebufferStatus(GLuint framebuffer,GLenum target){return ge::gl::getDefaultDirectContext().glCheckNamedFramebufferStatus(framebuffer,target);}
+    inline void glGetObjectBufferfvATI(GLuint buffer,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetObjectBufferfvATI(buffer,pname,params);}
+    inline void glRasterPos4d(GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glRasterPos4d(x,y,z,w);}
+    inline void glRasterPos4f(GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glRasterPos4f(x,y,z,w);}
+    inline void glGetPerfMonitorCounterStringAMD(GLuint group,GLuint counter,GLsizei bufSize,GLsizei* length,GLchar* counterString){ge::gl::getDefaultDirectContext().glGetPerfMonitorCounterStringAMD(group,counter,bufSize,length,counterString);}
+    inline void glVertexAttrib3s(GLuint index,GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glVertexAttrib3s(index,x,y,z);}
+    inline void glDrawElementsInstancedEXT(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei primcount){ge::gl::getDefaultDirectContext().glDrawElementsInstancedEXT(mode,count,type,indices,primcount);}
+    inline void glNamedProgramLocalParameterI4iEXT(GLuint program,GLenum target,GLuint index,GLint x,GLint y,GLint z,GLint w){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameterI4iEXT(program,target,index,x,y,z,w);}
+    inline void glRasterPos4s(GLshort x,GLshort y,GLshort z,GLshort w){ge::gl::getDefaultDirectContext().glRasterPos4s(x,y,z,w);}
+    inline void glGetProgramStageiv(GLuint program,GLenum shadertype,GLenum pname,GLint* values){ge::gl::getDefaultDirectContext().glGetProgramStageiv(program,shadertype,pname,values);}
+    inline void glGetMaterialxOES(GLenum face,GLenum pname,GLfixed param){ge::gl::getDefaultDirectContext().glGetMaterialxOES(face,pname,param);}
+    inline void glPopMatrix(){ge::gl::getDefaultDirectContext().glPopMatrix();}
+    inline void glGetVideoui64vNV(GLuint video_slot,GLenum pname,GLuint64EXT* params){ge::gl::getDefaultDirectContext().glGetVideoui64vNV(video_slot,pname,params);}
+    inline void glTangent3bEXT(GLbyte tx,GLbyte ty,GLbyte tz){ge::gl::getDefaultDirectContext().glTangent3bEXT(tx,ty,tz);}
+    inline GLenum glGetGraphicsResetStatusARB(){return ge::gl::getDefaultDirectContext().glGetGraphicsResetStatusARB();}
+    inline void glUniform4i(GLint location,GLint v0,GLint v1,GLint v2,GLint v3){ge::gl::getDefaultDirectContext().glUniform4i(location,v0,v1,v2,v3);}
+    inline void glActiveTexture(GLenum texture){ge::gl::getDefaultDirectContext().glActiveTexture(texture);}
+    inline void glEnableVertexAttribArray(GLuint index){ge::gl::getDefaultDirectContext().glEnableVertexAttribArray(index);}
+    inline void glTexCoord4fVertex4fvSUN(const GLfloat* tc,const GLfloat* v){ge::gl::getDefaultDirectContext().glTexCoord4fVertex4fvSUN(tc,v);}
+    inline void glUniform4d(GLint location,GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glUniform4d(location,x,y,z,w);}
+    inline void glUniform4f(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3){ge::gl::getDefaultDirectContext().glUniform4f(location,v0,v1,v2,v3);}
+    inline void glRenderbufferStorageMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glRenderbufferStorageMultisample(target,samples,internalformat,width,height);}
+    inline void glCreateProgramPipelines(GLsizei n,GLuint* pipelines){ge::gl::getDefaultDirectContext().glCreateProgramPipelines(n,pipelines);}
+    inline void glVertexAttribLPointer(GLuint index,GLint size,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribLPointer(index,size,type,stride,pointer);}
+    inline void glUniform2uiEXT(GLint location,GLuint v0,GLuint v1){ge::gl::getDefaultDirectContext().glUniform2uiEXT(location,v0,v1);}
+    inline void glMultiTexCoord3sv(GLenum target,const GLshort* v){ge::gl::getDefaultDirectContext().glMultiTexCoord3sv(target,v);}
+    inline void glDrawElementsInstancedBaseVertex(GLenum mode,GLsizei count,GLenum type,const void* indices,GLsizei instancecount,GLint basevertex){ge::gl::getDefaultDirectContext().glDrawElementsInstancedBaseVertex(mode,count,type,indices,instancecount,basevertex);}
+    inline void glPixelTransformParameterfvEXT(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPixelTransformParameterfvEXT(target,pname,params);}
+    inline void glDrawTransformFeedbackNV(GLenum mode,GLuint id){ge::gl::getDefaultDirectContext().glDrawTransformFeedbackNV(mode,id);}
+    inline void glTextureImage2DMultisampleCoverageNV(GLuint texture,GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTextureImage2DMultisampleCoverageNV(texture,target,coverageSamples,colorSamples,internalFormat,width,height,fixedSampleLocations);}
+    inline void glNamedRenderbufferStorageMultisampleCoverageEXT(GLuint renderbuffer,GLsizei coverageSamples,GLsizei colorSamples,GLenum internalformat,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glNamedRenderbufferStorageMultisampleCoverageEXT(renderbuffer,coverageSamples,colorSamples,internalformat,width,height);}
+    inline GLboolean glIsTexture(GLuint texture){return ge::gl::getDefaultDirectContext().glIsTexture(texture);}
+    inline void glMultiTexCoord4iv(GLenum target,const GLint* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4iv(target,v);}
+    inline void glTexEnvfv(GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glTexEnvfv(target,pname,params);}
+    inline void glPopDebugGroup(){ge::gl::getDefaultDirectContext().glPopDebugGroup();}
+    inline void glUniformBlockBinding(GLuint program,GLuint uniformBlockIndex,GLuint uniformBlockBinding){ge::gl::getDefaultDirectContext().glUniformBlockBinding(program,uniformBlockIndex,uniformBlockBinding);}
+    inline void glWindowPos2svMESA(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos2svMESA(v);}
+    inline void glGenerateTextureMipmapEXT(GLuint texture,GLenum target){ge::gl::getDefaultDirectContext().glGenerateTextureMipmapEXT(texture,target);}
+    inline GLuint glBindLightParameterEXT(GLenum light,GLenum value){return ge::gl::getDefaultDirectContext().glBindLightParameterEXT(light,value);}
+    inline void glTexCoord3bOES(GLbyte s,GLbyte t,GLbyte r){ge::gl::getDefaultDirectContext().glTexCoord3bOES(s,t,r);}
+    inline void glTexCoordPointer(GLint size,GLenum type,GLsizei stride,const GLvoid* ptr){ge::gl::getDefaultDirectContext().glTexCoordPointer(size,type,stride,ptr);}
+    inline void glProgramUniformMatrix3x2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix3x2fv(program,location,count,transpose,value);}
+    inline void glUniform2fvARB(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform2fvARB(location,count,value);}
+    inline void glProgramLocalParameterI4uivNV(GLenum target,GLuint index,const GLuint* params){ge::gl::getDefaultDirectContext().glProgramLocalParameterI4uivNV(target,index,params);}
+    inline void glFlushVertexArrayRangeNV(){ge::gl::getDefaultDirectContext().glFlushVertexArrayRangeNV();}
+    inline void glSecondaryColor3svEXT(const GLshort* v){ge::gl::getDefaultDirectContext().glSecondaryColor3svEXT(v);}
+    inline void glGetBufferParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetBufferParameteriv(target,pname,params);}
+    inline void glGetQueryIndexediv(GLenum target,GLuint index,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetQueryIndexediv(target,index,pname,params);}
+    inline void glFramebufferTexture3DEXT(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset){ge::gl::getDefaultDirectContext().glFramebufferTexture3DEXT(target,attachment,textarget,texture,level,zoffset);}
+    inline void glLoadTransposeMatrixxOES(const GLfixed* m){ge::gl::getDefaultDirectContext().glLoadTransposeMatrixxOES(m);}
+    inline void glDeleteTransformFeedbacksNV(GLsizei n,const GLuint* ids){ge::gl::getDefaultDirectContext().glDeleteTransformFeedbacksNV(n,ids);}
+    inline void glGetCompressedTextureImageEXT(GLuint texture,GLenum target,GLint lod,void* img){ge::gl::getDefaultDirectContext().glGetCompressedTextureImageEXT(texture,target,lod,img);}
+    inline void glIndexMaterialEXT(GLenum face,GLenum mode){ge::gl::getDefaultDirectContext().glIndexMaterialEXT(face,mode);}
+    inline void glFogCoorddEXT(GLdouble coord){ge::gl::getDefaultDirectContext().glFogCoorddEXT(coord);}
+    inline void glTexCoord2hvNV(const GLhalfNV* v){ge::gl::getDefaultDirectContext().glTexCoord2hvNV(v);}
+    inline void glGetFramebufferParameterfvAMD(GLenum target,GLenum pname,GLuint numsamples,GLuint pixelindex,GLsizei size,GLfloat* values){ge::gl::getDefaultDirectContext().glGetFramebufferParameterfvAMD(target,pname,numsamples,pixelindex,size,values);}
+    inline void glTexEnviv(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTexEnviv(target,pname,params);}
+    inline void glEndTransformFeedbackNV(){ge::gl::getDefaultDirectContext().glEndTransformFeedbackNV();}
+    inline void glGlobalAlphaFactoruiSUN(GLuint factor){ge::gl::getDefaultDirectContext().glGlobalAlphaFactoruiSUN(factor);}
+    inline void glSelectBuffer(GLsizei size,GLuint* buffer){ge::gl::getDefaultDirectContext().glSelectBuffer(size,buffer);}
+    inline void glNamedBufferSubDataEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data){ge::gl::getDefaultDirectContext().glNamedBufferSubDataEXT(buffer,offset,size,data);}
+    inline void glDisableVertexArrayAttrib(GLuint vaobj,GLuint index){ge::gl::getDefaultDirectContext().glDisableVertexArrayAttrib(vaobj,index);}
+    inline void glBlendFunc(GLenum sfactor,GLenum dfactor){ge::gl::getDefaultDirectContext().glBlendFunc(sfactor,dfactor);}
+    inline GLuint glCreateProgram(){return ge::gl::getDefaultDirectContext().glCreateProgram();}
+    inline void glVertexStream2dATI(GLenum stream,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexStream2dATI(stream,x,y);}
+    inline void glUniform4ui64vARB(GLint location,GLsizei count,const GLuint64* value){ge::gl::getDefaultDirectContext().glUniform4ui64vARB(location,count,value);}
+    inline void glGetSemaphoreParameterui64vEXT(GLuint semaphore,GLenum pname,GLuint64* params){ge::gl::getDefaultDirectContext().glGetSemaphoreParameterui64vEXT(semaphore,pname,params);}
+    inline void glPrimitiveRestartIndex(GLuint index){ge::gl::getDefaultDirectContext().glPrimitiveRestartIndex(index);}
+    inline void glNormalStream3fATI(GLenum stream,GLfloat nx,GLfloat ny,GLfloat nz){ge::gl::getDefaultDirectContext().glNormalStream3fATI(stream,nx,ny,nz);}
+    inline void glProgramUniformMatrix2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix2fv(program,location,count,transpose,value);}
+    inline void glVertexAttribs1hvNV(GLuint index,GLsizei n,const GLhalfNV* v){ge::gl::getDefaultDirectContext().glVertexAttribs1hvNV(index,n,v);}
+    inline void glWindowPos4svMESA(const GLshort* v){ge::gl::getDefaultDirectContext().glWindowPos4svMESA(v);}
+    inline void glDeleteFragmentShaderATI(GLuint id){ge::gl::getDefaultDirectContext().glDeleteFragmentShaderATI(id);}
+    inline void glBindImageTextures(GLuint first,GLsizei count,const GLuint* textures){ge::gl::getDefaultDirectContext().glBindImageTextures(first,count,textures);}
+    inline void glMap2xOES(GLenum target,GLfixed u1,GLfixed u2,GLint ustride,GLint uorder,GLfixed v1,GLfixed v2,GLint vstride,GLint vorder,GLfixed points){ge::gl::getDefaultDirectContext().glMap2xOES(target,u1,u2,ustride,uorder,v1,v2,vstride,vorder,points);}
+    inline void glEnd(){ge::gl::getDefaultDirectContext().glEnd();}
+    inline void glMultiTexCoord2dARB(GLenum target,GLdouble s,GLdouble t){ge::gl::getDefaultDirectContext().glMultiTexCoord2dARB(target,s,t);}
+    inline void glUniform1i64NV(GLint location,GLint64EXT x){ge::gl::getDefaultDirectContext().glUniform1i64NV(location,x);}
+    inline void glPathStringNV(GLuint path,GLenum format,GLsizei length,const void* pathString){ge::gl::getDefaultDirectContext().glPathStringNV(path,format,length,pathString);}
+    inline void glGetNamedFramebufferParameterivEXT(GLuint framebuffer,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetNamedFramebufferParameterivEXT(framebuffer,pname,params);}
+    inline void glGetProgramNamedParameterdvNV(GLuint id,GLsizei len,const GLubyte* name,GLdouble* params){ge::gl::getDefaultDirectContext().glGetProgramNamedParameterdvNV(id,len,name,params);}
+    inline void glPathDashArrayNV(GLuint path,GLsizei dashCount,const GLfloat* dashArray){ge::gl::getDefaultDirectContext().glPathDashArrayNV(path,dashCount,dashArray);}
+    inline void glUniform3uiv(GLint location,GLsizei count,const GLuint* value){ge::gl::getDefaultDirectContext().glUniform3uiv(location,count,value);}
+    inline void glColor3fVertex3fvSUN(const GLfloat* c,const GLfloat* v){ge::gl::getDefaultDirectContext().glColor3fVertex3fvSUN(c,v);}
+    inline void glMultTransposeMatrixd(const GLdouble m[16]){ge::gl::getDefaultDirectContext().glMultTransposeMatrixd(m);}
+    inline void glClearColor(GLclampf red,GLclampf green,GLclampf blue,GLclampf alpha){ge::gl::getDefaultDirectContext().glClearColor(red,green,blue,alpha);}
+    inline GLuint64 glGetImageHandleARB(GLuint texture,GLint level,GLboolean layered,GLint layer,GLenum format){return ge::gl::getDefaultDirectContext().glGetImageHandleARB(texture,level,layered,layer,format);}
+    inline void glTangent3dEXT(GLdouble tx,GLdouble ty,GLdouble tz){ge::gl::getDefaultDirectContext().glTangent3dEXT(tx,ty,tz);}
+    inline void glGetQueryObjectivARB(GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetQueryObjectivARB(id,pname,params);}
+    inline void glGetLocalConstantFloatvEXT(GLuint id,GLenum value,GLfloat* data){ge::gl::getDefaultDirectContext().glGetLocalConstantFloatvEXT(id,value,data);}
+    inline void glUseShaderProgramEXT(GLenum type,GLuint program){ge::gl::getDefaultDirectContext().glUseShaderProgramEXT(type,program);}
+    inline void glBindRenderbufferEXT(GLenum target,GLuint renderbuffer){ge::gl::getDefaultDirectContext().glBindRenderbufferEXT(target,renderbuffer);}
+    inline void glInterleavedArrays(GLenum format,GLsizei stride,const GLvoid* pointer){ge::gl::getDefaultDirectContext().glInterleavedArrays(format,stride,pointer);}
+    inline void glGetPerfMonitorGroupStringAMD(GLuint group,GLsizei bufSize,GLsizei* length,GLchar* groupString){ge::gl::getDefaultDirectContext().glGetPerfMonitorGroupStringAMD(group,bufSize,length,groupString);}
+    inline void glUniform3ui(GLint location,GLuint v0,GLuint v1,GLuint v2){ge::gl::getDefaultDirectContext().glUniform3ui(location,v0,v1,v2);}
+    inline void glGetNamedProgramLocalParameterdvEXT(GLuint program,GLenum target,GLuint index,GLdouble* params){ge::gl::getDefaultDirectContext().glGetNamedProgramLocalParameterdvEXT(program,target,index,params);}
+    inline void glDeleteQueryResourceTagNV(GLsizei n,const GLint* tagIds){ge::gl::getDefaultDirectContext().glDeleteQueryResourceTagNV(n,tagIds);}
+    inline void glVertexAttribI4uiv(GLuint index,const GLuint* v){ge::gl::getDefaultDirectContext().glVertexAttribI4uiv(index,v);}
+    inline void glVertexAttrib4bv(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttrib4bv(index,v);}
+    inline void glMultiTexCoord3xOES(GLenum texture,GLfixed s,GLfixed t,GLfixed r){ge::gl::getDefaultDirectContext().glMultiTexCoord3xOES(texture,s,t,r);}
+    inline void glSecondaryColor3ub(GLubyte red,GLubyte green,GLubyte blue){ge::gl::getDefaultDirectContext().glSecondaryColor3ub(red,green,blue);}
+    inline void glFragmentMaterialfSGIX(GLenum face,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glFragmentMaterialfSGIX(face,pname,param);}
+    inline void glGetVariantArrayObjectivATI(GLuint id,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetVariantArrayObjectivATI(id,pname,params);}
+    inline void glSecondaryColor3ui(GLuint red,GLuint green,GLuint blue){ge::gl::getDefaultDirectContext().glSecondaryColor3ui(red,green,blue);}
+    inline void glVertexAttrib1dARB(GLuint index,GLdouble x){ge::gl::getDefaultDirectContext().glVertexAttrib1dARB(index,x);}
+    inline void glGetNamedBufferPointerv(GLuint buffer,GLenum pname,void** params){ge::gl::getDefaultDirectContext().glGetNamedBufferPointerv(buffer,pname,params);}
+    inline void glLockArraysEXT(GLint first,GLsizei count){ge::gl::getDefaultDirectContext().glLockArraysEXT(first,count);}
+    inline void glVertexAttribPointerNV(GLuint index,GLint fsize,GLenum type,GLsizei stride,const void* pointer){ge::gl::getDefaultDirectContext().glVertexAttribPointerNV(index,fsize,type,stride,pointer);}
+    inline void glConvolutionParameterf(GLenum target,GLenum pname,GLfloat params){ge::gl::getDefaultDirectContext().glConvolutionParameterf(target,pname,params);}
+    inline void glBindBufferBaseEXT(GLenum target,GLuint index,GLuint buffer){ge::gl::getDefaultDirectContext().glBindBufferBaseEXT(target,index,buffer);}
+    inline void glTexCoord2xvOES(const GLfixed* coords){ge::gl::getDefaultDirectContext().glTexCoord2xvOES(coords);}
+    inline void glGetQueryBufferObjectui64v(GLuint id,GLuint buffer,GLenum pname,GLintptr offset){ge::gl::getDefaultDirectContext().glGetQueryBufferObjectui64v(id,buffer,pname,offset);}
+    inline void glSetMultisamplefvAMD(GLenum pname,GLuint index,const GLfloat* val){ge::gl::getDefaultDirectContext().glSetMultisamplefvAMD(pname,index,val);}
+    inline void glPathColorGenNV(GLenum color,GLenum genMode,GLenum colorFormat,const GLfloat* coeffs){ge::gl::getDefaultDirectContext().glPathColorGenNV(color,genMode,colorFormat,coeffs);}
+    inline void glVertexAttrib3sARB(GLuint index,GLshort x,GLshort y,GLshort z){ge::gl::getDefaultDirectContext().glVertexAttrib3sARB(index,x,y,z);}
+    inline void glVertexAttrib4ivARB(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttrib4ivARB(index,v);}
+    inline void glGenTransformFeedbacks(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glGenTransformFeedbacks(n,ids);}
+    inline void glGetVertexAttribIuiv(GLuint index,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetVertexAttribIuiv(index,pname,params);}
+    inline void glPixelTransformParameterfEXT(GLenum target,GLenum pname,GLfloat param){ge::gl::getDefaultDirectContext().glPixelTransformParameterfEXT(target,pname,param);}
+    inline void glGetTexParameterIuivEXT(GLenum target,GLenum pname,GLuint* params){ge::gl::getDefaultDirectContext().glGetTexParameterIuivEXT(target,pname,params);}
+    inline void glGetObjectParameterivARB(GLhandleARB obj,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetObjectParameterivARB(obj,pname,params);}
+    inline void glVertexArraySecondaryColorOffsetEXT(GLuint vaobj,GLuint buffer,GLint size,GLenum type,GLsizei stride,GLintptr offset){ge::gl::getDefaultDirectContext().glVertexArraySecondaryColorOffsetEXT(vaobj,buffer,size,type,stride,offset);}
+    inline void glWindowPos2fARB(GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glWindowPos2fARB(x,y);}
+    inline void glCompressedTexSubImage2D(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const GLvoid* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage2D(target,level,xoffset,yoffset,width,height,format,imageSize,data);}
+    inline void glCompressedTexSubImage3DARB(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLsizei width,GLsizei height,GLsizei depth,GLenum format,GLsizei imageSize,const void* data){ge::gl::getDefaultDirectContext().glCompressedTexSubImage3DARB(target,level,xoffset,yoffset,zoffset,width,height,depth,format,imageSize,data);}
+    inline void glProgramBinary(GLuint program,GLenum binaryFormat,const void* binary,GLsizei length){ge::gl::getDefaultDirectContext().glProgramBinary(program,binaryFormat,binary,length);}
+    inline void glPresentFrameKeyedNV(GLuint video_slot,GLuint64EXT minPresentTime,GLuint beginPresentTimeId,GLuint presentDurationId,GLenum type,GLenum target0,GLuint fill0,GLuint key0,GLenum target1,GLuint fill1,GLuint key1){ge::gl::getDefaultDirectContext().glPresentFrameKeyedNV(video_slot,minPresentTime,beginPresentTimeId,presentDurationId,type,target0,fill0,key0,target1,fill1,key1);}
+    inline void glVertexAttribI4bv(GLuint index,const GLbyte* v){ge::gl::getDefaultDirectContext().glVertexAttribI4bv(index,v);}
+    inline void glPathCoverDepthFuncNV(GLenum func){ge::gl::getDefaultDirectContext().glPathCoverDepthFuncNV(func);}
+    inline void glTransformFeedbackStreamAttribsNV(GLsizei count,const GLint* attribs,GLsizei nbuffers,const GLint* bufstreams,GLenum bufferMode){ge::gl::getDefaultDirectContext().glTransformFeedbackStreamAttribsNV(count,attribs,nbuffers,bufstreams,bufferMode);}
+    inline void glSecondaryColor3usEXT(GLushort red,GLushort green,GLushort blue){ge::gl::getDefaultDirectContext().glSecondaryColor3usEXT(red,green,blue);}
+    inline void glCopyColorTableSGI(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyColorTableSGI(target,internalformat,x,y,width);}
+    inline void glProgramEnvParameter4fvARB(GLenum target,GLuint index,const GLfloat* params){ge::gl::getDefaultDirectContext().glProgramEnvParameter4fvARB(target,index,params);}
+    inline void glMultiTexCoord4sARB(GLenum target,GLshort s,GLshort t,GLshort r,GLshort q){ge::gl::getDefaultDirectContext().glMultiTexCoord4sARB(target,s,t,r,q);}
+    inline void glGetVertexArrayIndexed64iv(GLuint vaobj,GLuint index,GLenum pname,GLint64* param){ge::gl::getDefaultDirectContext().glGetVertexArrayIndexed64iv(vaobj,index,pname,param);}
+    inline void glMatrixMultTranspose3x3fNV(GLenum matrixMode,const GLfloat* m){ge::gl::getDefaultDirectContext().glMatrixMultTranspose3x3fNV(matrixMode,m);}
+    inline void glTexParameterIiv(GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTexParameterIiv(target,pname,params);}
+    inline void glVertexArrayAttribFormat(GLuint vaobj,GLuint attribindex,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){ge::gl::getDefaultDirectContext().glVertexArrayAttribFormat(vaobj,attribindex,size,type,normalized,relativeoffset);}
+    inline void glEndTransformFeedback(){ge::gl::getDefaultDirectContext().glEndTransformFeedback();}
+    inline void glDrawCommandsStatesAddressNV(const GLuint64* indirects,const GLsizei* sizes,const GLuint* states,const GLuint* fbos,GLuint count){ge::gl::getDefaultDirectContext().glDrawCommandsStatesAddressNV(indirects,sizes,states,fbos,count);}
+    inline void glUniform4ui64NV(GLint location,GLuint64EXT x,GLuint64EXT y,GLuint64EXT z,GLuint64EXT w){ge::gl::getDefaultDirectContext().glUniform4ui64NV(location,x,y,z,w);}
+    inline void glMaterialiv(GLenum face,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glMaterialiv(face,pname,params);}
+    inline void glTexImage2DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTexImage2DMultisample(target,samples,internalformat,width,height,fixedsamplelocations);}
+    inline void glBindTextureEXT(GLenum target,GLuint texture){ge::gl::getDefaultDirectContext().glBindTextureEXT(target,texture);}
+    inline GLboolean glIsBuffer(GLuint buffer){return ge::gl::getDefaultDirectContext().glIsBuffer(buffer);}
+    inline void glVertexAttribI1iv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI1iv(index,v);}
+    inline void glGetFinalCombinerInputParameterfvNV(GLenum variable,GLenum pname,GLfloat* params){ge::gl::getDefaultDirectContext().glGetFinalCombinerInputParameterfvNV(variable,pname,params);}
+    inline void glMultiTexCoord3bvOES(GLenum texture,const GLbyte* coords){ge::gl::getDefaultDirectContext().glMultiTexCoord3bvOES(texture,coords);}
+    inline void glVertexAttribDivisor(GLuint index,GLuint divisor){ge::gl::getDefaultDirectContext().glVertexAttribDivisor(index,divisor);}
+    inline void glCopyBufferSubData(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){ge::gl::getDefaultDirectContext().glCopyBufferSubData(readTarget,writeTarget,readOffset,writeOffset,size);}
+    inline GLuint glBindTexGenParameterEXT(GLenum unit,GLenum coord,GLenum value){return ge::gl::getDefaultDirectContext().glBindTexGenParameterEXT(unit,coord,value);}
+    inline void glNormalStream3bATI(GLenum stream,GLbyte nx,GLbyte ny,GLbyte nz){ge::gl::getDefaultDirectContext().glNormalStream3bATI(stream,nx,ny,nz);}
+    inline void glTexStorageMem2DEXT(GLenum target,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLuint memory,GLuint64 offset){ge::gl::getDefaultDirectContext().glTexStorageMem2DEXT(target,levels,internalFormat,width,height,memory,offset);}
+    inline void glTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureImage2DEXT(texture,target,level,internalformat,width,height,border,format,type,pixels);}
+    inline void glGetColorTableParameteriv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetColorTableParameteriv(target,pname,params);}
+    inline void glActiveTextureARB(GLenum texture){ge::gl::getDefaultDirectContext().glActiveTextureARB(texture);}
+    inline void glTexCoord4xOES(GLfixed s,GLfixed t,GLfixed r,GLfixed q){ge::gl::getDefaultDirectContext().glTexCoord4xOES(s,t,r,q);}
+    inline void glNamedBufferStorageExternalEXT(GLuint buffer,GLintptr offset,GLsizeiptr size,GLeglClientBufferEXT clientBuffer,GLbitfield flags){ge::gl::getDefaultDirectContext().glNamedBufferStorageExternalEXT(buffer,offset,size,clientBuffer,flags);}
+    inline void glSecondaryColor3fvEXT(const GLfloat* v){ge::gl::getDefaultDirectContext().glSecondaryColor3fvEXT(v);}
+    inline void glUniformMatrix4x2fv(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix4x2fv(location,count,transpose,value);}
+    inline void glStartInstrumentsSGIX(){ge::gl::getDefaultDirectContext().glStartInstrumentsSGIX();}
+    inline void glProgramNamedParameter4fvNV(GLuint id,GLsizei len,const GLubyte* name,const GLfloat* v){ge::gl::getDefaultDirectContext().glProgramNamedParameter4fvNV(id,len,name,v);}
+    inline void glEndVideoCaptureNV(GLuint video_capture_slot){ge::gl::getDefaultDirectContext().glEndVideoCaptureNV(video_capture_slot);}
+    inline GLuint glGenLists(GLsizei range){return ge::gl::getDefaultDirectContext().glGenLists(range);}
+    inline void glUniform1fARB(GLint location,GLfloat v0){ge::gl::getDefaultDirectContext().glUniform1fARB(location,v0);}
+    inline void glNamedFramebufferTexture1DEXT(GLuint framebuffer,GLenum attachment,GLenum textarget,GLuint texture,GLint level){ge::gl::getDefaultDirectContext().glNamedFramebufferTexture1DEXT(framebuffer,attachment,textarget,texture,level);}
+    inline void* glMapBufferRange(GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access){return ge::gl::getDefaultDirectContext().glMapBufferRange(target,offset,length,access);}
+    inline void glMultiDrawElementsIndirectCountARB(GLenum mode,GLenum type,const void* indirect,GLintptr drawcount,GLsizei maxdrawcount,GLsizei stride){ge::gl::getDefaultDirectContext().glMultiDrawElementsIndirectCountARB(mode,type,indirect,drawcount,maxdrawcount,stride);}
+    inline void glProgramUniformMatrix4x2fv(GLuint program,GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glProgramUniformMatrix4x2fv(program,location,count,transpose,value);}
+    inline void glGetTextureParameterIivEXT(GLuint texture,GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTextureParameterIivEXT(texture,target,pname,params);}
+    inline void glMultiTexCoord3hNV(GLenum target,GLhalfNV s,GLhalfNV t,GLhalfNV r){ge::gl::getDefaultDirectContext().glMultiTexCoord3hNV(target,s,t,r);}
+    inline void glNamedProgramLocalParametersI4uivEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLuint* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParametersI4uivEXT(program,target,index,count,params);}
+    inline void glEndList(){ge::gl::getDefaultDirectContext().glEndList();}
+    inline void glTexCoord2fColor4fNormal3fVertex3fSUN(GLfloat s,GLfloat t,GLfloat r,GLfloat g,GLfloat b,GLfloat a,GLfloat nx,GLfloat ny,GLfloat nz,GLfloat x,GLfloat y,GLfloat z){ge::gl::getDefaultDirectContext().glTexCoord2fColor4fNormal3fVertex3fSUN(s,t,r,g,b,a,nx,ny,nz,x,y,z);}
+    inline void glGenTransformFeedbacksNV(GLsizei n,GLuint* ids){ge::gl::getDefaultDirectContext().glGenTransformFeedbacksNV(n,ids);}
+    inline void glEdgeFlagv(const GLboolean* flag){ge::gl::getDefaultDirectContext().glEdgeFlagv(flag);}
+    inline void glVertexAttribI2iv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glVertexAttribI2iv(index,v);}
+    inline void glCopyMultiTexImage2DEXT(GLenum texunit,GLenum target,GLint level,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height,GLint border){ge::gl::getDefaultDirectContext().glCopyMultiTexImage2DEXT(texunit,target,level,internalformat,x,y,width,height,border);}
+    inline void glUniformMatrix3x2dv(GLint location,GLsizei count,GLboolean transpose,const GLdouble* value){ge::gl::getDefaultDirectContext().glUniformMatrix3x2dv(location,count,transpose,value);}
+    inline void glTexImage3DMultisampleCoverageNV(GLenum target,GLsizei coverageSamples,GLsizei colorSamples,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedSampleLocations){ge::gl::getDefaultDirectContext().glTexImage3DMultisampleCoverageNV(target,coverageSamples,colorSamples,internalFormat,width,height,depth,fixedSampleLocations);}
+    inline void glGetShaderPrecisionFormat(GLenum shadertype,GLenum precisiontype,GLint* range,GLint* precision){ge::gl::getDefaultDirectContext().glGetShaderPrecisionFormat(shadertype,precisiontype,range,precision);}
+    inline void glTexSubImage4DSGIS(GLenum target,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint woffset,GLsizei width,GLsizei height,GLsizei depth,GLsizei size4d,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTexSubImage4DSGIS(target,level,xoffset,yoffset,zoffset,woffset,width,height,depth,size4d,format,type,pixels);}
+    inline void glRasterSamplesEXT(GLuint samples,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glRasterSamplesEXT(samples,fixedsamplelocations);}
+    inline void glTextureView(GLuint texture,GLenum target,GLuint origtexture,GLenum internalformat,GLuint minlevel,GLuint numlevels,GLuint minlayer,GLuint numlayers){ge::gl::getDefaultDirectContext().glTextureView(texture,target,origtexture,internalformat,minlevel,numlevels,minlayer,numlayers);}
+    inline void glEvalMapsNV(GLenum target,GLenum mode){ge::gl::getDefaultDirectContext().glEvalMapsNV(target,mode);}
+    inline GLint glGetFragDataLocationEXT(GLuint program,const GLchar* name){return ge::gl::getDefaultDirectContext().glGetFragDataLocationEXT(program,name);}
+    inline void glGetCompressedMultiTexImageEXT(GLenum texunit,GLenum target,GLint lod,void* img){ge::gl::getDefaultDirectContext().glGetCompressedMultiTexImageEXT(texunit,target,lod,img);}
+    inline void glIndexMask(GLuint mask){ge::gl::getDefaultDirectContext().glIndexMask(mask);}
+    inline void glPushClientAttrib(GLbitfield mask){ge::gl::getDefaultDirectContext().glPushClientAttrib(mask);}
+    inline void glShaderSource(GLuint shader,GLsizei count,const GLchar*const* string,const GLint* length){ge::gl::getDefaultDirectContext().glShaderSource(shader,count,string,length);}
+    inline void glDispatchComputeGroupSizeARB(GLuint num_groups_x,GLuint num_groups_y,GLuint num_groups_z,GLuint group_size_x,GLuint group_size_y,GLuint group_size_z){ge::gl::getDefaultDirectContext().glDispatchComputeGroupSizeARB(num_groups_x,num_groups_y,num_groups_z,group_size_x,group_size_y,group_size_z);}
+    inline void glLGPUNamedBufferSubDataNVX(GLbitfield gpuMask,GLuint buffer,GLintptr offset,GLsizeiptr size,const void* data){ge::gl::getDefaultDirectContext().glLGPUNamedBufferSubDataNVX(gpuMask,buffer,offset,size,data);}
+    inline void glGetnPixelMapfv(GLenum map,GLsizei bufSize,GLfloat* values){ge::gl::getDefaultDirectContext().glGetnPixelMapfv(map,bufSize,values);}
+    inline void glTexCoordP2uiv(GLenum type,const GLuint* coords){ge::gl::getDefaultDirectContext().glTexCoordP2uiv(type,coords);}
+    inline void glUniform2f(GLint location,GLfloat v0,GLfloat v1){ge::gl::getDefaultDirectContext().glUniform2f(location,v0,v1);}
+    inline void glGetNamedBufferParameteri64v(GLuint buffer,GLenum pname,GLint64* params){ge::gl::getDefaultDirectContext().glGetNamedBufferParameteri64v(buffer,pname,params);}
+    inline void glCommandListSegmentsNV(GLuint list,GLuint segments){ge::gl::getDefaultDirectContext().glCommandListSegmentsNV(list,segments);}
+    inline void glTextureParameterIivEXT(GLuint texture,GLenum target,GLenum pname,const GLint* params){ge::gl::getDefaultDirectContext().glTextureParameterIivEXT(texture,target,pname,params);}
+    inline void glMultiTexParameterfvEXT(GLenum texunit,GLenum target,GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glMultiTexParameterfvEXT(texunit,target,pname,params);}
+    inline void glProgramUniform2ui64ARB(GLuint program,GLint location,GLuint64 x,GLuint64 y){ge::gl::getDefaultDirectContext().glProgramUniform2ui64ARB(program,location,x,y);}
+    inline void glVertex4d(GLdouble x,GLdouble y,GLdouble z,GLdouble w){ge::gl::getDefaultDirectContext().glVertex4d(x,y,z,w);}
+    inline GLuint glNewObjectBufferATI(GLsizei size,const void* pointer,GLenum usage){return ge::gl::getDefaultDirectContext().glNewObjectBufferATI(size,pointer,usage);}
+    inline void glViewportSwizzleNV(GLuint index,GLenum swizzlex,GLenum swizzley,GLenum swizzlez,GLenum swizzlew){ge::gl::getDefaultDirectContext().glViewportSwizzleNV(index,swizzlex,swizzley,swizzlez,swizzlew);}
+    inline void glBufferData(GLenum target,GLsizeiptr size,const void* data,GLenum usage){ge::gl::getDefaultDirectContext().glBufferData(target,size,data,usage);}
+    inline void glTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint border,GLenum format,GLenum type,const void* pixels){ge::gl::getDefaultDirectContext().glTextureImage1DEXT(texture,target,level,internalformat,width,border,format,type,pixels);}
+    inline void glGetTexParameterIiv(GLenum target,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetTexParameterIiv(target,pname,params);}
+    inline void glCopyTexSubImage1DEXT(GLenum target,GLint level,GLint xoffset,GLint x,GLint y,GLsizei width){ge::gl::getDefaultDirectContext().glCopyTexSubImage1DEXT(target,level,xoffset,x,y,width);}
+    inline void glVertex4f(GLfloat x,GLfloat y,GLfloat z,GLfloat w){ge::gl::getDefaultDirectContext().glVertex4f(x,y,z,w);}
+    inline void glUniformMatrix3fvARB(GLint location,GLsizei count,GLboolean transpose,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniformMatrix3fvARB(location,count,transpose,value);}
+    inline void glTexCoordP1ui(GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glTexCoordP1ui(type,coords);}
+    inline void glPointParameterfvEXT(GLenum pname,const GLfloat* params){ge::gl::getDefaultDirectContext().glPointParameterfvEXT(pname,params);}
+    inline void glUniform4fARB(GLint location,GLfloat v0,GLfloat v1,GLfloat v2,GLfloat v3){ge::gl::getDefaultDirectContext().glUniform4fARB(location,v0,v1,v2,v3);}
+    inline void glImportMemoryFdEXT(GLuint memory,GLuint64 size,GLenum handleType,GLint fd){ge::gl::getDefaultDirectContext().glImportMemoryFdEXT(memory,size,handleType,fd);}
+    inline void glCopyTextureSubImage3D(GLuint texture,GLint level,GLint xoffset,GLint yoffset,GLint zoffset,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyTextureSubImage3D(texture,level,xoffset,yoffset,zoffset,x,y,width,height);}
+    inline void glMultiTexCoord2fv(GLenum target,const GLfloat* v){ge::gl::getDefaultDirectContext().glMultiTexCoord2fv(target,v);}
+    inline void glNamedFramebufferSamplePositionsfvAMD(GLuint framebuffer,GLuint numsamples,GLuint pixelindex,const GLfloat* values){ge::gl::getDefaultDirectContext().glNamedFramebufferSamplePositionsfvAMD(framebuffer,numsamples,pixelindex,values);}
+    inline void glNormalP3ui(GLenum type,GLuint coords){ge::gl::getDefaultDirectContext().glNormalP3ui(type,coords);}
+    inline void glDrawRangeElementArrayATI(GLenum mode,GLuint start,GLuint end,GLsizei count){ge::gl::getDefaultDirectContext().glDrawRangeElementArrayATI(mode,start,end,count);}
+    inline void glVertexAttribI1i(GLuint index,GLint x){ge::gl::getDefaultDirectContext().glVertexAttribI1i(index,x);}
+    inline void glDrawArraysInstancedARB(GLenum mode,GLint first,GLsizei count,GLsizei primcount){ge::gl::getDefaultDirectContext().glDrawArraysInstancedARB(mode,first,count,primcount);}
+    inline void glEnableVertexAttribAPPLE(GLuint index,GLenum pname){ge::gl::getDefaultDirectContext().glEnableVertexAttribAPPLE(index,pname);}
+    inline GLuint glGetDebugMessageLogARB(GLuint count,GLsizei bufSize,GLenum* sources,GLenum* types,GLuint* ids,GLenum* severities,GLsizei* lengths,GLchar* messageLog){return ge::gl::getDefaultDirectContext().glGetDebugMessageLogARB(count,bufSize,sources,types,ids,severities,lengths,messageLog);}
+    inline void glGetPathTexGenfvNV(GLenum texCoordSet,GLenum pname,GLfloat* value){ge::gl::getDefaultDirectContext().glGetPathTexGenfvNV(texCoordSet,pname,value);}
+    inline void glNamedProgramLocalParameters4fvEXT(GLuint program,GLenum target,GLuint index,GLsizei count,const GLfloat* params){ge::gl::getDefaultDirectContext().glNamedProgramLocalParameters4fvEXT(program,target,index,count,params);}
+    inline void glQueryResourceTagNV(GLint tagId,const GLchar* tagString){ge::gl::getDefaultDirectContext().glQueryResourceTagNV(tagId,tagString);}
+    inline void glVertexStream3fvATI(GLenum stream,const GLfloat* coords){ge::gl::getDefaultDirectContext().glVertexStream3fvATI(stream,coords);}
+    inline void glFramebufferTexture3D(GLenum target,GLenum attachment,GLenum textarget,GLuint texture,GLint level,GLint zoffset){ge::gl::getDefaultDirectContext().glFramebufferTexture3D(target,attachment,textarget,texture,level,zoffset);}
+    inline void glCompressedTextureSubImage2DEXT(GLuint texture,GLenum target,GLint level,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum format,GLsizei imageSize,const void* bits){ge::gl::getDefaultDirectContext().glCompressedTextureSubImage2DEXT(texture,target,level,xoffset,yoffset,width,height,format,imageSize,bits);}
+    inline void glWindowPos3dv(const GLdouble* v){ge::gl::getDefaultDirectContext().glWindowPos3dv(v);}
+    inline void glCopyConvolutionFilter2D(GLenum target,GLenum internalformat,GLint x,GLint y,GLsizei width,GLsizei height){ge::gl::getDefaultDirectContext().glCopyConvolutionFilter2D(target,internalformat,x,y,width,height);}
+    inline void glReadInstrumentsSGIX(GLint marker){ge::gl::getDefaultDirectContext().glReadInstrumentsSGIX(marker);}
+    inline void glProgramUniform2dvEXT(GLuint program,GLint location,GLsizei count,const GLdouble* value){ge::gl::getDefaultDirectContext().glProgramUniform2dvEXT(program,location,count,value);}
+    inline void glSamplerParameterfv(GLuint sampler,GLenum pname,const GLfloat* param){ge::gl::getDefaultDirectContext().glSamplerParameterfv(sampler,pname,param);}
+    inline void glBindBufferARB(GLenum target,GLuint buffer){ge::gl::getDefaultDirectContext().glBindBufferARB(target,buffer);}
+    inline void glVertexAttrib1sNV(GLuint index,GLshort x){ge::gl::getDefaultDirectContext().glVertexAttrib1sNV(index,x);}
+    inline void glGetMaterialiv(GLenum face,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetMaterialiv(face,pname,params);}
+    inline void glUniform1fv(GLint location,GLsizei count,const GLfloat* value){ge::gl::getDefaultDirectContext().glUniform1fv(location,count,value);}
+    inline void glBeginOcclusionQueryNV(GLuint id){ge::gl::getDefaultDirectContext().glBeginOcclusionQueryNV(id);}
+    inline void glGenFencesAPPLE(GLsizei n,GLuint* fences){ge::gl::getDefaultDirectContext().glGenFencesAPPLE(n,fences);}
+    inline void glScissorIndexedv(GLuint index,const GLint* v){ge::gl::getDefaultDirectContext().glScissorIndexedv(index,v);}
+    inline void glDisableVariantClientStateEXT(GLuint id){ge::gl::getDefaultDirectContext().glDisableVariantClientStateEXT(id);}
+    inline void glMinmaxEXT(GLenum target,GLenum internalformat,GLboolean sink){ge::gl::getDefaultDirectContext().glMinmaxEXT(target,internalformat,sink);}
+    inline void glNormalPointervINTEL(GLenum type,const void** pointer){ge::gl::getDefaultDirectContext().glNormalPointervINTEL(type,pointer);}
+    inline void glNormal3s(GLshort nx,GLshort ny,GLshort nz){ge::gl::getDefaultDirectContext().glNormal3s(nx,ny,nz);}
+    inline void glGetnPixelMapuiv(GLenum map,GLsizei bufSize,GLuint* values){ge::gl::getDefaultDirectContext().glGetnPixelMapuiv(map,bufSize,values);}
+    inline void glNormalStream3bvATI(GLenum stream,const GLbyte* coords){ge::gl::getDefaultDirectContext().glNormalStream3bvATI(stream,coords);}
+    inline void glGetObjectParameterivAPPLE(GLenum objectType,GLuint name,GLenum pname,GLint* params){ge::gl::getDefaultDirectContext().glGetObjectParameterivAPPLE(objectType,name,pname,params);}
+    inline void glNormal3i(GLint nx,GLint ny,GLint nz){ge::gl::getDefaultDirectContext().glNormal3i(nx,ny,nz);}
+    inline void glUniform1ivARB(GLint location,GLsizei count,const GLint* value){ge::gl::getDefaultDirectContext().glUniform1ivARB(location,count,value);}
+    inline void glNormal3d(GLdouble nx,GLdouble ny,GLdouble nz){ge::gl::getDefaultDirectContext().glNormal3d(nx,ny,nz);}
+    inline void glUpdateObjectBufferATI(GLuint buffer,GLuint offset,GLsizei size,const void* pointer,GLenum preserve){ge::gl::getDefaultDirectContext().glUpdateObjectBufferATI(buffer,offset,size,pointer,preserve);}
+    inline void glNormal3b(GLbyte nx,GLbyte ny,GLbyte nz){ge::gl::getDefaultDirectContext().glNormal3b(nx,ny,nz);}
+    inline GLint glGetUniformBufferSizeEXT(GLuint program,GLint location){return ge::gl::getDefaultDirectContext().glGetUniformBufferSizeEXT(program,location);}
+    inline void glMultiTexCoord4dv(GLenum target,const GLdouble* v){ge::gl::getDefaultDirectContext().glMultiTexCoord4dv(target,v);}
+    inline void glProgramUniform3i64ARB(GLuint program,GLint location,GLint64 x,GLint64 y,GLint64 z){ge::gl::getDefaultDirectContext().glProgramUniform3i64ARB(program,location,x,y,z);}
+    inline void glVertexAttrib2d(GLuint index,GLdouble x,GLdouble y){ge::gl::getDefaultDirectContext().glVertexAttrib2d(index,x,y);}
+    inline void glVertexAttrib2f(GLuint index,GLfloat x,GLfloat y){ge::gl::getDefaultDirectContext().glVertexAttrib2f(index,x,y);}
+    inline void glMultiDrawElementsEXT(GLenum mode,const GLsizei* count,GLenum type,const void*const* indices,GLsizei primcount){ge::gl::getDefaultDirectContext().glMultiDrawElementsEXT(mode,count,type,indices,primcount);}
+    inline void glVertexAttrib3dv(GLuint index,const GLdouble* v){ge::gl::getDefaultDirectContext().glVertexAttrib3dv(index,v);}
+    inline void glMultiTexCoord2bOES(GLenum texture,GLbyte s,GLbyte t){ge::gl::getDefaultDirectContext().glMultiTexCoord2bOES(texture,s,t);}
+    inline void glVertexAttrib2s(GLuint index,GLshort x,GLshort y){ge::gl::getDefaultDirectContext().glVertexAttrib2s(index,x,y);}
+    inline void glTexImage3DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){ge::gl::getDefaultDirectContext().glTexImage3DMultisample(target,samples,internalformat,width,height,depth,fixedsamplelocations);}
+    inline GLuint glGetUniformBlockIndex(GLuint program,const GLchar* uniformBlockName){return ge::gl::getDefaultDirectContext().glGetUniformBlockIndex(program,uniformBlockName);}
+    inline GLboolean glReleaseKeyedMutexWin32EXT(GLuint memory,GLuint64 key){return ge::gl::getDefaultDirectContext().glReleaseKeyedMutexWin32EXT(memory,key);}
+    inline void glFrontFace(GLenum mode){ge::gl::getDefaultDirectContext().glFrontFace(mode);}
+    inline void glEvalCoord1xOES(GLfixed u){ge::gl::getDefaultDirectContext().glEvalCoord1xOES(u);}
+    inline void glDrawArraysInstancedBaseInstance(GLenum mode,GLint first,GLsizei count,GLsizei instancecount,GLuint baseinstance){ge::gl::getDefaultDirectContext().glDrawArraysInstancedBaseInstance(mode,first,count,instancecount,baseinstance);}
+    inline GLboolean glIsPointInStrokePathNV(GLuint path,GLfloat x,GLfloat y){return ge::gl::getDefaultDirectContext().glIsPointInStrokePathNV(path,x,y);}
+  }
+}
+#else
 namespace ge{
   namespace gl{
     GEGL_EXPORT void glMultiDrawArraysIndirectBindlessCountNV(GLenum mode,const void* indirect,GLsizei drawCount,GLsizei maxDrawCount,GLsizei stride,GLint vertexBufferCount);
@@ -2929,3 +5863,4 @@ namespace ge{
     GEGL_EXPORT GLboolean glIsPointInStrokePathNV(GLuint path,GLfloat x,GLfloat y);
   }
 }
+#endif
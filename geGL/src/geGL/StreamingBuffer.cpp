@@ -0,0 +1,210 @@
+#include <geGL/StreamingBuffer.h>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+namespace {
+GLbitfield const storageFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param frameSize size of one frame region in bytes
+ * @param nofFrames number of frame regions (frames that can be in flight)
+ */
+StreamingBuffer::StreamingBuffer(GLsizeiptr frameSize, size_t nofFrames)
+    : StreamingBuffer(nullptr, frameSize, nofFrames)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param frameSize size of one frame region in bytes
+ * @param nofFrames number of frame regions (frames that can be in flight)
+ */
+StreamingBuffer::StreamingBuffer(FunctionTablePointer const &table,
+                                 GLsizeiptr                  frameSize,
+                                 size_t                      nofFrames)
+    : fences(nofFrames), frameSize(frameSize)
+{
+  if (frameSize <= 0 || nofFrames == 0)
+    throw std::runtime_error(
+        "StreamingBuffer - frame size and number of frames have to be "
+        "positive");
+  auto const size = frameSize * static_cast<GLsizeiptr>(nofFrames);
+  buffer = std::make_shared<Buffer>(table, size, nullptr, storageFlags);
+  mapping = static_cast<uint8_t *>(buffer->map(0, size, storageFlags));
+  if (!mapping)
+    throw std::runtime_error("StreamingBuffer - persistent mapping failed");
+}
+
+/**
+ * @brief Destructor, it unmaps buffer
+ */
+StreamingBuffer::~StreamingBuffer() { buffer->unmap(); }
+
+/**
+ * @brief Begins frame, it waits until GPU stops reading region of the frame.
+ * Region is polled first, if its fence is not signaled, the wait is counted
+ * as stall and CPU blocks until fence is signaled or timeout expires.
+ *
+ * @param timeout timeout of the wait in nanoseconds
+ *
+ * @return false if timeout expired, region cannot be used
+ */
+bool StreamingBuffer::beginFrame(GLuint64 timeout)
+{
+  assert(this != nullptr);
+  if (begun) return true;
+  auto &fence = fences[frame];
+  if (fence) {
+    auto const start    = std::chrono::steady_clock::now();
+    auto       signaled = fence->isSignaled();
+    if (!signaled) {
+      statistics.stalls++;
+      signaled = fence->wait(timeout);
+    }
+    auto const duration = std::chrono::steady_clock::now() - start;
+    auto const elapsed  = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    statistics.waits++;
+    statistics.waitNanoseconds += elapsed;
+    statistics.maxWaitNanoseconds =
+        std::max(statistics.maxWaitNanoseconds, elapsed);
+    if (!signaled) {
+      statistics.timeouts++;
+      return false;
+    }
+    fence = nullptr;
+  }
+  begun = true;
+  used  = 0;
+  return true;
+}
+
+/**
+ * @brief Allocates part of current frame region.
+ * Data written through pointer are visible to GPU without flush (coherent
+ * mapping), they have to stay unchanged until region is reused.
+ *
+ * @param size size of allocation in bytes
+ * @param alignment alignment of offset (e.g.
+ * GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT)
+ *
+ * @return CPU pointer and offset into getBuffer()
+ */
+StreamingBuffer::Allocation StreamingBuffer::allocate(GLsizeiptr size,
+                                                      GLsizeiptr alignment)
+{
+  assert(this != nullptr);
+  if (!begun)
+    throw std::runtime_error(
+        "StreamingBuffer - allocate has to be called between beginFrame and "
+        "endFrame");
+  if (alignment <= 0) alignment = 1;
+  auto const regionStart = frameSize * static_cast<GLsizeiptr>(frame);
+  auto const current     = regionStart + used;
+  auto const offset      = (current + alignment - 1) / alignment * alignment;
+  if (size < 0 || offset + size > regionStart + frameSize)
+    throw std::runtime_error("StreamingBuffer - frame region is full");
+  statistics.allocatedBytes += offset + size - current;
+  used = offset + size - regionStart;
+  Allocation result;
+  result.pointer = mapping + offset;
+  result.offset  = offset;
+  result.size    = size;
+  return result;
+}
+
+/**
+ * @brief Ends frame, it places fence behind commands that read current region
+ * and moves to next region.
+ */
+void StreamingBuffer::endFrame()
+{
+  assert(this != nullptr);
+  if (!begun) return;
+  fences[frame] = std::unique_ptr<Sync>(
+      new Sync(buffer->getContext().getFunctionTable()));
+  frame = (frame + 1) % fences.size();
+  begun = false;
+  statistics.frames++;
+}
+
+/**
+ * @brief is frame begun
+ *
+ * @return true if allocate can be called
+ */
+bool StreamingBuffer::isFrameBegun() const { return begun; }
+
+/**
+ * @brief gets index of current frame region
+ *
+ * @return index of current frame region
+ */
+size_t StreamingBuffer::getFrame() const { return frame; }
+
+/**
+ * @brief gets number of frame regions
+ *
+ * @return number of frame regions
+ */
+size_t StreamingBuffer::getNofFrames() const { return fences.size(); }
+
+/**
+ * @brief gets size of frame region
+ *
+ * @return size of frame region in bytes
+ */
+GLsizeiptr StreamingBuffer::getFrameSize() const { return frameSize; }
+
+/**
+ * @brief gets free space of current frame region (ignoring alignment)
+ *
+ * @return free space in bytes
+ */
+GLsizeiptr StreamingBuffer::getFrameRemaining() const
+{
+  return frameSize - used;
+}
+
+/**
+ * @brief gets underlying buffer, it can be used with bindRange or
+ * VertexArray::addAttrib using offset of allocation
+ *
+ * @return buffer
+ */
+Buffer *StreamingBuffer::getBuffer() const { return buffer.get(); }
+
+/**
+ * @brief gets underlying buffer
+ *
+ * @return buffer
+ */
+std::shared_ptr<Buffer> const &StreamingBuffer::getSharedBuffer() const
+{
+  return buffer;
+}
+
+/**
+ * @brief gets fence waiting statistics
+ *
+ * @return statistics
+ */
+StreamingBuffer::Statistics const &StreamingBuffer::getStatistics() const
+{
+  return statistics;
+}
+
+/**
+ * @brief resets statistics
+ */
+void StreamingBuffer::resetStatistics() { statistics = Statistics(); }
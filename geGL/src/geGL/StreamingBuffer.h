@@ -0,0 +1,82 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <geGL/Sync.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Ring buffer for per-frame data (instance transforms, particles, UI
+ * vertices, ...).
+ *
+ * Storage is immutable and persistently + coherently mapped, so writes do not
+ * need map/unmap or setData. Buffer is split into nofFrames regions, every
+ * region is guarded by fence that is placed at the end of its frame.
+ * Waiting on fence is explicit (beginFrame) and it is measured, so statistics
+ * show when CPU gets ahead of GPU.
+ *
+ * @code
+ * StreamingBuffer stream(1024*1024);
+ * for(;;){
+ *   stream.beginFrame();
+ *   auto const a = stream.allocate(sizeof(data),16);
+ *   std::memcpy(a.pointer,data,sizeof(data));
+ *   stream.getBuffer()->bindRange(GL_UNIFORM_BUFFER,0,a.offset,a.size);
+ *   ...draw...
+ *   stream.endFrame();
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::StreamingBuffer {
+ public:
+  /**
+   * @brief Part of current frame region
+   */
+  struct Allocation {
+    GLvoid*    pointer = nullptr;  ///< CPU pointer into persistent mapping
+    GLintptr   offset  = 0;        ///< offset into getBuffer()
+    GLsizeiptr size    = 0;        ///< size of allocation in bytes
+  };
+  /**
+   * @brief Fence waiting statistics
+   */
+  struct Statistics {
+    size_t     frames             = 0;  ///< number of finished frames
+    size_t     waits              = 0;  ///< number of waits on region fences
+    size_t     stalls             = 0;  ///< waits whose fence was not signaled yet
+    size_t     timeouts           = 0;  ///< waits that timed out
+    uint64_t   waitNanoseconds    = 0;  ///< CPU time spent in waits
+    uint64_t   maxWaitNanoseconds = 0;  ///< longest wait
+    GLsizeiptr allocatedBytes     = 0;  ///< bytes handed out, including padding
+  };
+  StreamingBuffer(GLsizeiptr frameSize, size_t nofFrames = 3);
+  StreamingBuffer(FunctionTablePointer const& table,
+                  GLsizeiptr                  frameSize,
+                  size_t                      nofFrames = 3);
+  ~StreamingBuffer();
+  StreamingBuffer(StreamingBuffer const&) = delete;
+  StreamingBuffer& operator=(StreamingBuffer const&) = delete;
+  bool       beginFrame(GLuint64 timeout = 1000000000ull);
+  Allocation allocate(GLsizeiptr size, GLsizeiptr alignment = 1);
+  void       endFrame();
+  bool       isFrameBegun() const;
+  size_t     getFrame() const;
+  size_t     getNofFrames() const;
+  GLsizeiptr getFrameSize() const;
+  GLsizeiptr getFrameRemaining() const;
+  Buffer*    getBuffer() const;
+  std::shared_ptr<Buffer> const& getSharedBuffer() const;
+  Statistics const& getStatistics() const;
+  void              resetStatistics();
+
+ protected:
+  std::shared_ptr<Buffer>            buffer;
+  std::vector<std::unique_ptr<Sync>> fences;  ///< fence of every frame region
+  uint8_t*                           mapping   = nullptr;
+  GLsizeiptr                         frameSize = 0;
+  size_t                             frame     = 0;  ///< index of current frame region
+  GLsizeiptr                         used      = 0;  ///< used bytes of current region
+  bool                               begun     = false;
+  Statistics                         statistics;
+};
@@ -0,0 +1,82 @@
+#include <geGL/Sync.h>
+#include <cassert>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+/**
+ * @brief Constructor, it inserts fence into command stream
+ */
+Sync::Sync() : Sync(nullptr) {}
+
+/**
+ * @brief Constructor, it inserts fence into command stream
+ *
+ * @param table opengl function table
+ */
+Sync::Sync(FunctionTablePointer const &table) : OpenGLObject(table)
+{
+  sync = getContext().glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (!sync) throw std::runtime_error("geGL: Sync - glFenceSync failed");
+}
+
+/**
+ * @brief Destructor, it deletes fence
+ */
+Sync::~Sync() { getContext().glDeleteSync(sync); }
+
+GLsync Sync::getSync() const { return sync; }
+
+/**
+ * @brief Polls fence without blocking, pending commands are flushed so
+ * the fence is signaled eventually
+ *
+ * @return true if GPU has finished commands before fence
+ */
+bool Sync::isSignaled() const
+{
+  assert(this != nullptr);
+  if (signaled) return true;
+  return clientWait(GL_SYNC_FLUSH_COMMANDS_BIT, 0) != GL_TIMEOUT_EXPIRED;
+}
+
+/**
+ * @brief Blocks CPU until fence is signaled or timeout expires
+ *
+ * @param timeout timeout in nanoseconds
+ *
+ * @return false if timeout expired
+ */
+bool Sync::wait(GLuint64 timeout) const
+{
+  assert(this != nullptr);
+  if (signaled) return true;
+  return clientWait(GL_SYNC_FLUSH_COMMANDS_BIT, timeout) != GL_TIMEOUT_EXPIRED;
+}
+
+/**
+ * @brief Makes GPU wait for fence before executing following commands,
+ * CPU is not blocked
+ */
+void Sync::serverWait() const
+{
+  assert(this != nullptr);
+  getContext().glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+}
+
+/**
+ * @brief Calls glClientWaitSync and remembers signaled state
+ *
+ * @param flags GL_SYNC_FLUSH_COMMANDS_BIT or 0
+ * @param timeout timeout in nanoseconds
+ *
+ * @return GL_ALREADY_SIGNALED, GL_CONDITION_SATISFIED or GL_TIMEOUT_EXPIRED
+ */
+GLenum Sync::clientWait(GLbitfield flags, GLuint64 timeout) const
+{
+  auto const status = getContext().glClientWaitSync(sync, flags, timeout);
+  if (status == GL_WAIT_FAILED)
+    throw std::runtime_error("geGL: Sync - glClientWaitSync failed");
+  if (status != GL_TIMEOUT_EXPIRED) signaled = true;
+  return status;
+}
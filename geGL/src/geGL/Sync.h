@@ -0,0 +1,33 @@
+#pragma once
+
+#include <geGL/OpenGLObject.h>
+
+/**
+ * @brief Fence sync object.
+ *
+ * Fence is inserted into command stream in constructor and it is signaled
+ * when GPU finishes all preceding commands. Fence is not a named object,
+ * so getId() is 0, getSync() returns GLsync handle.
+ *
+ * @code
+ * ...draw...
+ * Sync fence;
+ * ...
+ * if(fence.isSignaled())reuse();
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::Sync : public OpenGLObject {
+ public:
+  Sync();
+  Sync(FunctionTablePointer const& table);
+  ~Sync();
+  GLsync getSync() const;
+  bool   isSignaled() const;
+  bool   wait(GLuint64 timeout = GL_TIMEOUT_IGNORED) const;
+  void   serverWait() const;
+
+ protected:
+  GLenum       clientWait(GLbitfield flags, GLuint64 timeout) const;
+  GLsync       sync     = nullptr;
+  mutable bool signaled = false;  ///< fence has been observed signaled
+};
@@ -1,12 +1,19 @@
 #include<geGL/Texture.h>
 #include<geGL/Framebuffer.h>
 #include<geGL/OpenGLUtil.h>
+#include<algorithm>
+#include<atomic>
 #include<sstream>
+#include<stdexcept>
 
 //#include<GPUEngine/geCore/Dtemplates.h>
 
 using namespace ge::gl;
 
+namespace{
+  std::atomic<bool>driverVerification{false};
+}
+
 Texture::Texture(){}
 
 void Texture::create(
@@ -20,6 +27,17 @@ void Texture::create(
   assert((width!=0)||(width!=0&&height!=0)||(width!=0&&height!=0&&depth!=0));
   this->_target = target;
   this->_format = internalFormat;
+  this->_metadata = Metadata();
+  this->_metadata.levels          = levels>0?levels:1;
+  this->_metadata.width           = width ;
+  this->_metadata.height          = height;
+  this->_metadata.depth           = depth ;
+  this->_metadata.immutable       = levels>0?GL_TRUE:GL_FALSE;
+  this->_metadata.immutableLevels = levels>0?levels:0;
+  if(target == GL_TEXTURE_RECTANGLE){
+    this->_metadata.minFilter = GL_LINEAR;
+    for(auto&w:this->_metadata.wrap)w = GL_CLAMP_TO_EDGE;
+  }
   this->getContext().glCreateTextures(this->_target,1,&this->getId());
   if(levels>0){
     if     (height == 0)this->getContext().glTextureStorage1D(this->getId(),levels,this->_format,width             );
@@ -292,6 +310,13 @@ void Texture::getCompressedData(std::vector<uint8_t>&data,GLint level){
 void Texture::generateMipmap()const{
   assert(this!=nullptr);
   this->getContext().glGenerateTextureMipmap(this->getId());
+  if(this->_metadata.immutable || this->_metadata.width == 0)return;
+  GLsizei size = this->_metadata.width;
+  if(this->_target != GL_TEXTURE_1D_ARRAY)size = std::max(size,this->_metadata.height);
+  if(this->_target == GL_TEXTURE_3D      )size = std::max(size,this->_metadata.depth );
+  GLsizei levels = 1;
+  while((size>>levels) > 0)++levels;
+  this->_metadata.levels = levels;
 }
 
 void Texture::clear(
@@ -313,6 +338,9 @@ void Texture::clear(
 void Texture::texParameteri(GLenum pname,GLint params)const{
   assert(this!=nullptr);
   this->getContext().glTextureParameteri(this->getId(),pname,params);
+  if(pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA)return;
+  GLfloat const value = (GLfloat)params;
+  this->_setParameter(pname,&value);
 }
 
 /**
@@ -329,6 +357,119 @@ void Texture::texParameterfv(GLenum pname,GLfloat *params)const{
 #else //USE_DSA
   this->getContext().glTextureParameterfv(this->getId(),pname,params);
 #endif//USE_DSA
+  this->_setParameter(pname,params);
+}
+
+/**
+ * @brief Getters answer parameters recorded by create, generateMipmap,
+ * texParameteri and texParameterfv from memory.
+ * If verification is enabled, every cached getter also queries driver and
+ * throws std::runtime_error if cached value differs (debugging of raw OpenGL
+ * calls on texture ids).
+ *
+ * @param enabled true enables verification of all textures
+ */
+void Texture::setDriverVerification(bool enabled){
+  driverVerification = enabled;
+}
+
+/**
+ * @brief is verification of cached parameters enabled
+ *
+ * @return true if getters compare cached parameters with driver
+ */
+bool Texture::isDriverVerificationEnabled(){
+  return driverVerification;
+}
+
+bool Texture::_isLevelKnown(GLint level)const{
+  return level >= 0 && level < this->_metadata.levels;
+}
+
+bool Texture::_isMultisample()const{
+  return this->_target == GL_TEXTURE_2D_MULTISAMPLE || this->_target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY;
+}
+
+/**
+ * @brief Records texture parameter, unknown parameters are not cached
+ *
+ * @param pname name of parameter
+ * @param values values of parameter
+ */
+void Texture::_setParameter(GLenum pname,GLfloat const*values)const{
+  auto&m = this->_metadata;
+  switch(pname){
+    case GL_TEXTURE_SWIZZLE_R          :
+    case GL_TEXTURE_SWIZZLE_G          :
+    case GL_TEXTURE_SWIZZLE_B          :
+    case GL_TEXTURE_SWIZZLE_A          :m.swizzle[pname-GL_TEXTURE_SWIZZLE_R] = (GLint)values[0];break;
+    case GL_TEXTURE_SWIZZLE_RGBA       :for(size_t i=0;i<4;++i)m.swizzle[i] = (GLint)values[i];break;
+    case GL_TEXTURE_BORDER_COLOR       :std::copy(values,values+4,m.borderColor);break;
+    case GL_TEXTURE_MIN_FILTER         :m.minFilter        = (GLint)values[0];break;
+    case GL_TEXTURE_MAG_FILTER         :m.magFilter        = (GLint)values[0];break;
+    case GL_TEXTURE_WRAP_S             :m.wrap[0]          = (GLint)values[0];break;
+    case GL_TEXTURE_WRAP_T             :m.wrap[1]          = (GLint)values[0];break;
+    case GL_TEXTURE_WRAP_R             :m.wrap[2]          = (GLint)values[0];break;
+    case GL_TEXTURE_MIN_LOD            :m.minLod           =        values[0];break;
+    case GL_TEXTURE_MAX_LOD            :m.maxLod           =        values[0];break;
+    case GL_TEXTURE_LOD_BIAS           :m.lodBias          =        values[0];break;
+    case GL_TEXTURE_BASE_LEVEL         :m.baseLevel        = (GLint)values[0];break;
+    case GL_TEXTURE_MAX_LEVEL          :m.maxLevel         = (GLint)values[0];break;
+    case GL_DEPTH_STENCIL_TEXTURE_MODE :m.depthStencilMode = (GLint)values[0];break;
+    case GL_TEXTURE_COMPARE_MODE       :m.compareMode      = (GLint)values[0];break;
+    case GL_TEXTURE_COMPARE_FUNC       :m.compareFunc      = (GLint)values[0];break;
+    default                            :break;
+  }
+}
+
+/**
+ * @brief Compares cached level parameter with driver if driver verification
+ * is enabled (Texture::setDriverVerification)
+ *
+ * @param name name of parameter
+ * @param level mipmap level
+ * @param pname parameter
+ * @param cached cached value
+ *
+ * @return cached value
+ */
+GLint Texture::_cachedLevel(char const*name,GLint level,GLenum pname,GLint cached)const{
+  if(!driverVerification)return cached;
+  auto const driver = this->_getTexLevelParameter(level,pname);
+  if(driver == cached)return cached;
+  throw std::runtime_error("geGL: Texture - cached "+std::string(name)+" of level "+std::to_string(level)+" ("+
+      std::to_string(cached)+") differs from driver ("+std::to_string(driver)+")");
+}
+
+/**
+ * @brief Compares cached texture parameter with driver if driver verification
+ * is enabled (Texture::setDriverVerification)
+ *
+ * @param name name of parameter
+ * @param pname parameter
+ * @param cached cached values
+ * @param n number of values
+ */
+void Texture::_verify(char const*name,GLenum pname,GLfloat const*cached,size_t n)const{
+  if(!driverVerification)return;
+  GLfloat driver[4] = {0.f,0.f,0.f,0.f};
+  this->_getTexParameterf(driver,pname);
+  for(size_t i=0;i<n;++i){
+    if(driver[i] == cached[i])continue;
+    throw std::runtime_error("geGL: Texture - cached "+std::string(name)+" ("+
+        std::to_string(cached[i])+") differs from driver ("+std::to_string(driver[i])+")");
+  }
+}
+
+GLint Texture::_cached(char const*name,GLenum pname,GLint cached)const{
+  GLfloat const value = (GLfloat)cached;
+  this->_verify(name,pname,&value);
+  return cached;
+}
+
+GLfloat Texture::_cached(char const*name,GLenum pname,GLfloat cached)const{
+  this->_verify(name,pname,&cached);
+  return cached;
 }
 
 
@@ -400,7 +541,8 @@ void Texture::_getTexParameterf(GLfloat*data,GLenum pname)const{
  */
 GLuint Texture::getWidth(GLint level)const{
   assert(this!=nullptr);
-  return this->_getTexLevelParameter(level,GL_TEXTURE_WIDTH);
+  if(!this->_isLevelKnown(level))return this->_getTexLevelParameter(level,GL_TEXTURE_WIDTH);
+  return this->_cachedLevel("GL_TEXTURE_WIDTH",level,GL_TEXTURE_WIDTH,std::max(this->_metadata.width>>level,1));
 
 }
 
@@ -413,7 +555,10 @@ GLuint Texture::getWidth(GLint level)const{
  */
 GLuint Texture::getHeight(GLint level)const{
   assert(this!=nullptr);
-  return this->_getTexLevelParameter(level,GL_TEXTURE_HEIGHT);
+  if(!this->_isLevelKnown(level))return this->_getTexLevelParameter(level,GL_TEXTURE_HEIGHT);
+  GLint height = std::max(this->_metadata.height,1);
+  if(this->_target != GL_TEXTURE_1D_ARRAY)height = std::max(height>>level,1);
+  return this->_cachedLevel("GL_TEXTURE_HEIGHT",level,GL_TEXTURE_HEIGHT,height);
 }
 
 /**
@@ -425,7 +570,14 @@ GLuint Texture::getHeight(GLint level)const{
  */
 GLuint Texture::getDepth(GLint level)const{
   assert(this!=nullptr);
-  return this->_getTexLevelParameter(level,GL_TEXTURE_DEPTH);
+  if(!this->_isLevelKnown(level))return this->_getTexLevelParameter(level,GL_TEXTURE_DEPTH);
+  GLint depth = std::max(this->_metadata.depth,1);
+  bool const layered =
+    this->_target == GL_TEXTURE_2D_ARRAY             ||
+    this->_target == GL_TEXTURE_CUBE_MAP_ARRAY       ||
+    this->_target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY ;
+  if(!layered)depth = std::max(depth>>level,1);
+  return this->_cachedLevel("GL_TEXTURE_DEPTH",level,GL_TEXTURE_DEPTH,depth);
 }
 
 /**
@@ -437,7 +589,8 @@ GLuint Texture::getDepth(GLint level)const{
  */
 GLuint Texture::getSamples(GLint level)const{
   assert(this!=nullptr);
-  return this->_getTexLevelParameter(level,GL_TEXTURE_SAMPLES);
+  if(!this->_isLevelKnown(level) || this->_isMultisample())return this->_getTexLevelParameter(level,GL_TEXTURE_SAMPLES);
+  return this->_cachedLevel("GL_TEXTURE_SAMPLES",level,GL_TEXTURE_SAMPLES,0);
 }
 
 /**
@@ -449,7 +602,8 @@ GLuint Texture::getSamples(GLint level)const{
  */
 GLboolean Texture::getFixedSampleLocation(GLint level)const{
   assert(this!=nullptr);
-  return (GLboolean)this->_getTexLevelParameter(level,GL_TEXTURE_FIXED_SAMPLE_LOCATIONS);
+  if(!this->_isLevelKnown(level) || this->_isMultisample())return (GLboolean)this->_getTexLevelParameter(level,GL_TEXTURE_FIXED_SAMPLE_LOCATIONS);
+  return (GLboolean)this->_cachedLevel("GL_TEXTURE_FIXED_SAMPLE_LOCATIONS",level,GL_TEXTURE_FIXED_SAMPLE_LOCATIONS,GL_TRUE);
 }
 
 /**
@@ -461,7 +615,9 @@ GLboolean Texture::getFixedSampleLocation(GLint level)const{
  */
 GLenum Texture::getInternalFormat(GLint level)const{
   assert(this!=nullptr);
-  return this->_getTexLevelParameter(level,GL_TEXTURE_INTERNAL_FORMAT);
+  //mutable textures can have unsized format, driver reports sized one
+  if(!this->_isLevelKnown(level) || !this->_metadata.immutable)return this->_getTexLevelParameter(level,GL_TEXTURE_INTERNAL_FORMAT);
+  return this->_cachedLevel("GL_TEXTURE_INTERNAL_FORMAT",level,GL_TEXTURE_INTERNAL_FORMAT,this->_format);
 }
 
 /**
@@ -617,7 +773,8 @@ GLenum Texture::getDepthType(GLint level)const{
  */
 GLboolean Texture::getCompressed(GLint level)const{
   assert(this!=nullptr);
-  return (GLboolean)this->_getTexLevelParameter(level,GL_TEXTURE_COMPRESSED);
+  if(!this->_isLevelKnown(level))return (GLboolean)this->_getTexLevelParameter(level,GL_TEXTURE_COMPRESSED);
+  return (GLboolean)this->_cachedLevel("GL_TEXTURE_COMPRESSED",level,GL_TEXTURE_COMPRESSED,isInternalFormatCompressed(this->_format));
 }
 
 /**
@@ -675,7 +832,7 @@ GLint Texture::getBufferSize(GLint level)const{
  */
 GLenum Texture::getSwizzleR()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_SWIZZLE_R);
+  return this->_cached("GL_TEXTURE_SWIZZLE_R",GL_TEXTURE_SWIZZLE_R,this->_metadata.swizzle[0]);
 }
 
 /**
@@ -685,7 +842,7 @@ GLenum Texture::getSwizzleR()const{
  */
 GLenum Texture::getSwizzleG()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_SWIZZLE_G);
+  return this->_cached("GL_TEXTURE_SWIZZLE_G",GL_TEXTURE_SWIZZLE_G,this->_metadata.swizzle[1]);
 }
 
 /**
@@ -695,7 +852,7 @@ GLenum Texture::getSwizzleG()const{
  */
 GLenum Texture::getSwizzleB()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_SWIZZLE_B);
+  return this->_cached("GL_TEXTURE_SWIZZLE_B",GL_TEXTURE_SWIZZLE_B,this->_metadata.swizzle[2]);
 }
 
 /**
@@ -705,7 +862,7 @@ GLenum Texture::getSwizzleB()const{
  */
 GLenum Texture::getSwizzleA()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_SWIZZLE_A);
+  return this->_cached("GL_TEXTURE_SWIZZLE_A",GL_TEXTURE_SWIZZLE_A,this->_metadata.swizzle[3]);
 }
 
 /**
@@ -715,7 +872,8 @@ GLenum Texture::getSwizzleA()const{
  */
 void Texture::getBorderColor(GLfloat*color)const{
   assert(this!=nullptr);
-  this->_getTexParameterf(color,GL_TEXTURE_BORDER_COLOR);
+  this->_verify("GL_TEXTURE_BORDER_COLOR",GL_TEXTURE_BORDER_COLOR,this->_metadata.borderColor,4);
+  std::copy(this->_metadata.borderColor,this->_metadata.borderColor+4,color);
 }
 
 /**
@@ -725,7 +883,7 @@ void Texture::getBorderColor(GLfloat*color)const{
  */
 GLenum Texture::getMinFilter()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_MIN_FILTER);
+  return this->_cached("GL_TEXTURE_MIN_FILTER",GL_TEXTURE_MIN_FILTER,this->_metadata.minFilter);
 }
 
 /**
@@ -735,7 +893,7 @@ GLenum Texture::getMinFilter()const{
  */
 GLenum Texture::getMagFilter()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_MAG_FILTER);
+  return this->_cached("GL_TEXTURE_MAG_FILTER",GL_TEXTURE_MAG_FILTER,this->_metadata.magFilter);
 }
 
 /**
@@ -745,7 +903,7 @@ GLenum Texture::getMagFilter()const{
  */
 GLenum Texture::getWrapS()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_WRAP_S);
+  return this->_cached("GL_TEXTURE_WRAP_S",GL_TEXTURE_WRAP_S,this->_metadata.wrap[0]);
 }
 
 /**
@@ -755,7 +913,7 @@ GLenum Texture::getWrapS()const{
  */
 GLenum Texture::getWrapT()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_WRAP_T);
+  return this->_cached("GL_TEXTURE_WRAP_T",GL_TEXTURE_WRAP_T,this->_metadata.wrap[1]);
 }
 
 /**
@@ -765,7 +923,7 @@ GLenum Texture::getWrapT()const{
  */
 GLenum Texture::getWrapR()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_WRAP_R);
+  return this->_cached("GL_TEXTURE_WRAP_R",GL_TEXTURE_WRAP_R,this->_metadata.wrap[2]);
 }
 
 /**
@@ -789,9 +947,7 @@ GLenum Texture::getTarget()const{
  */
 GLfloat Texture::getMinLod()const{
   assert(this!=nullptr);
-  GLfloat lod;
-  this->_getTexParameterf(&lod,GL_TEXTURE_MIN_LOD);
-  return lod;
+  return this->_cached("GL_TEXTURE_MIN_LOD",GL_TEXTURE_MIN_LOD,this->_metadata.minLod);
 }
 
 /**
@@ -801,9 +957,7 @@ GLfloat Texture::getMinLod()const{
  */
 GLfloat Texture::getMaxLod()const{
   assert(this!=nullptr);
-  GLfloat lod;
-  this->_getTexParameterf(&lod,GL_TEXTURE_MAX_LOD);
-  return lod;
+  return this->_cached("GL_TEXTURE_MAX_LOD",GL_TEXTURE_MAX_LOD,this->_metadata.maxLod);
 }
 
 /**
@@ -813,7 +967,7 @@ GLfloat Texture::getMaxLod()const{
  */
 GLuint Texture::getBaseLevel()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_BASE_LEVEL);
+  return this->_cached("GL_TEXTURE_BASE_LEVEL",GL_TEXTURE_BASE_LEVEL,this->_metadata.baseLevel);
 }
 
 /**
@@ -823,7 +977,7 @@ GLuint Texture::getBaseLevel()const{
  */
 GLuint Texture::getMaxLevel()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_MAX_LEVEL);
+  return this->_cached("GL_TEXTURE_MAX_LEVEL",GL_TEXTURE_MAX_LEVEL,this->_metadata.maxLevel);
 }
 
 /**
@@ -833,9 +987,7 @@ GLuint Texture::getMaxLevel()const{
  */
 GLfloat Texture::getLodBias()const{
   assert(this!=nullptr);
-  GLfloat bias;
-  this->_getTexParameterf(&bias,GL_TEXTURE_LOD_BIAS);
-  return bias;
+  return this->_cached("GL_TEXTURE_LOD_BIAS",GL_TEXTURE_LOD_BIAS,this->_metadata.lodBias);
 }
 
 /**
@@ -845,7 +997,7 @@ GLfloat Texture::getLodBias()const{
  */
 GLenum Texture::getDepthStencilTextureMode()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_DEPTH_STENCIL_TEXTURE_MODE);
+  return this->_cached("GL_DEPTH_STENCIL_TEXTURE_MODE",GL_DEPTH_STENCIL_TEXTURE_MODE,this->_metadata.depthStencilMode);
 }
 
 /**
@@ -855,7 +1007,7 @@ GLenum Texture::getDepthStencilTextureMode()const{
  */
 GLenum Texture::getCompareMode()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_COMPARE_MODE);
+  return this->_cached("GL_TEXTURE_COMPARE_MODE",GL_TEXTURE_COMPARE_MODE,this->_metadata.compareMode);
 }
 
 /**
@@ -865,7 +1017,7 @@ GLenum Texture::getCompareMode()const{
  */
 GLenum Texture::getCompareFunc()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_COMPARE_FUNC);
+  return this->_cached("GL_TEXTURE_COMPARE_FUNC",GL_TEXTURE_COMPARE_FUNC,this->_metadata.compareFunc);
 }
 
 /**
@@ -885,7 +1037,7 @@ GLenum Texture::getImageFormatCompatibilityType()const{
  */
 GLboolean Texture::getImmutableFormat()const{
   assert(this!=nullptr);
-  return (GLboolean)this->_getTexParameter(GL_TEXTURE_IMMUTABLE_FORMAT);
+  return (GLboolean)this->_cached("GL_TEXTURE_IMMUTABLE_FORMAT",GL_TEXTURE_IMMUTABLE_FORMAT,(GLint)this->_metadata.immutable);
 }
 
 /**
@@ -895,7 +1047,7 @@ GLboolean Texture::getImmutableFormat()const{
  */
 GLuint Texture::getImmutableLevels()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_IMMUTABLE_LEVELS);
+  return this->_cached("GL_TEXTURE_IMMUTABLE_LEVELS",GL_TEXTURE_IMMUTABLE_LEVELS,this->_metadata.immutableLevels);
 }
 
 /**
@@ -905,7 +1057,7 @@ GLuint Texture::getImmutableLevels()const{
  */
 GLuint Texture::getViewMinLevel()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_VIEW_MIN_LEVEL);
+  return this->_cached("GL_TEXTURE_VIEW_MIN_LEVEL",GL_TEXTURE_VIEW_MIN_LEVEL,0);
 }
 
 /**
@@ -915,7 +1067,7 @@ GLuint Texture::getViewMinLevel()const{
  */
 GLuint Texture::getViewNumLevels()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_VIEW_NUM_LEVELS);
+  return this->_cached("GL_TEXTURE_VIEW_NUM_LEVELS",GL_TEXTURE_VIEW_NUM_LEVELS,this->_metadata.immutableLevels);
 }
 
 /**
@@ -925,7 +1077,7 @@ GLuint Texture::getViewNumLevels()const{
  */
 GLuint Texture::getViewMinLayer()const{
   assert(this!=nullptr);
-  return this->_getTexParameter(GL_TEXTURE_VIEW_MIN_LAYER);
+  return this->_cached("GL_TEXTURE_VIEW_MIN_LAYER",GL_TEXTURE_VIEW_MIN_LAYER,0);
 }
 
 /**
@@ -1043,12 +1195,32 @@ unsigned long long Texture::getLevelSize(GLint level)const{
   return size/8;
 }
 
+/**
+ * @brief gets size of all mipmap levels in bytes.
+ * Levels recorded by create and generateMipmap are answered from memory,
+ * levels of mutable textures behind them (or all levels if the texture was
+ * not created by create) are queried from driver until mipmap chain ends.
+ *
+ * @return size of texture in bytes
+ */
 unsigned long long Texture::getSize()const{
   assert(this!=nullptr);
-  GLint nofLevels=this->getViewNumLayers();//TODO neco lepsiho?
+  GLint nofLevels=this->_metadata.levels;
   unsigned long long size=0;
   for(GLint l=0;l<nofLevels;++l)
     size+=this->getLevelSize(l);
+  if(this->_metadata.immutable)return size;
+  auto const isLastLevel = [&](GLint l){
+    if(this->getWidth(l) > 1)return false;
+    if(this->hasHeight() && this->_target != GL_TEXTURE_1D_ARRAY && this->getHeight(l) > 1)return false;
+    if(this->_target == GL_TEXTURE_3D && this->getDepth(l) > 1)return false;
+    return true;
+  };
+  if(nofLevels > 0 && isLastLevel(nofLevels-1))return size;
+  for(GLint l=nofLevels;this->_getTexLevelParameter(l,GL_TEXTURE_WIDTH) > 0;++l){
+    size+=this->getLevelSize(l);
+    if(isLastLevel(l))break;
+  }
   return size;
 }
 
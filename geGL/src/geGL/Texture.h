@@ -164,13 +164,48 @@ class ge::gl::Texture: public OpenGLObject{
   GEGL_EXPORT std::string getInfo()const;
   GEGL_EXPORT unsigned long long getSize()const;
   GEGL_EXPORT unsigned long long getLevelSize(GLint level)const;
+  GEGL_EXPORT static void setDriverVerification(bool enabled);
+  GEGL_EXPORT static bool isDriverVerificationEnabled();
   private:
+  /**
+   * @brief Parameters recorded by create, generateMipmap, texParameteri and
+   * texParameterfv, getters answer them without querying driver
+   */
+  struct Metadata{
+    GLsizei   levels          = 0                       ;///<number of levels with known size
+    GLsizei   width           = 0                       ;///<size of base level
+    GLsizei   height          = 0                       ;///<size of base level
+    GLsizei   depth           = 0                       ;///<size of base level
+    GLboolean immutable       = GL_FALSE                ;
+    GLsizei   immutableLevels = 0                       ;
+    GLint     swizzle[4]      = {GL_RED,GL_GREEN,GL_BLUE,GL_ALPHA};
+    GLfloat   borderColor[4]  = {0.f,0.f,0.f,0.f}       ;
+    GLint     minFilter       = GL_NEAREST_MIPMAP_LINEAR;
+    GLint     magFilter       = GL_LINEAR               ;
+    GLint     wrap[3]         = {GL_REPEAT,GL_REPEAT,GL_REPEAT};
+    GLfloat   minLod          = -1000.f                 ;
+    GLfloat   maxLod          =  1000.f                 ;
+    GLfloat   lodBias         = 0.f                     ;
+    GLint     baseLevel       = 0                       ;
+    GLint     maxLevel        = 1000                    ;
+    GLint     depthStencilMode= GL_DEPTH_COMPONENT      ;
+    GLint     compareMode     = GL_NONE                 ;
+    GLint     compareFunc     = GL_LEQUAL               ;
+  };
   inline GLint _getTexLevelParameter(GLint level,GLenum pname)const;
   inline GLint _getTexParameter (GLenum pname)const;
   inline void  _getTexParameterf(GLfloat*data,GLenum pname)const;
   inline GLuint _bindSafe()const;
+  bool _isLevelKnown(GLint level)const;
+  bool _isMultisample()const;
+  void _setParameter(GLenum pname,GLfloat const*values)const;
+  GLint   _cachedLevel(char const*name,GLint level,GLenum pname,GLint cached)const;
+  GLint   _cached(char const*name,GLenum pname,GLint   cached)const;
+  GLfloat _cached(char const*name,GLenum pname,GLfloat cached)const;
+  void    _verify(char const*name,GLenum pname,GLfloat const*cached,size_t n = 1)const;
   GLenum  _target;
   GLenum  _format;
+  mutable Metadata _metadata;
   std::set<Framebuffer*>_framebuffers;
   friend class Framebuffer;
 };
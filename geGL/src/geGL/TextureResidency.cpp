@@ -0,0 +1,291 @@
+#include <geGL/TextureResidency.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+using namespace ge::gl;
+
+TextureResidency::Id const TextureResidency::INVALID;
+
+/**
+ * @brief Constructor
+ *
+ * @param budget budget of resident levels in bytes
+ */
+TextureResidency::TextureResidency(size_t budget)
+{
+  statistics.budget = budget;
+}
+
+/**
+ * @brief Adds texture, its coarse levels become resident immediately
+ * (even if they exceed budget)
+ *
+ * @param levelSizes sizes of mipmap levels in bytes, level 0 is the finest
+ * @param nofCoarseLevels number of coarsest levels that are always resident
+ *
+ * @return id of texture
+ */
+TextureResidency::Id TextureResidency::add(
+    std::vector<size_t> const &levelSizes,
+    size_t                     nofCoarseLevels)
+{
+  assert(this != nullptr);
+  if (levelSizes.empty())
+    throw std::invalid_argument(
+        "geGL: TextureResidency::add - texture has to have some levels");
+  nofCoarseLevels = std::min(std::max(nofCoarseLevels, size_t(1)),
+                             levelSizes.size());
+  Entry t;
+  t.levelSizes = levelSizes;
+  t.coarsest   = levelSizes.size() - nofCoarseLevels;
+  t.resident   = t.coarsest;
+  t.requested  = t.coarsest;
+  t.previous   = t.coarsest;
+  t.lastUse    = frame;
+  t.valid      = true;
+  for (size_t l = t.coarsest; l < levelSizes.size(); ++l)
+    statistics.residentBytes += levelSizes[l];
+  statistics.peakResidentBytes =
+      std::max(statistics.peakResidentBytes, statistics.residentBytes);
+  statistics.nofTextures++;
+
+  if (!freeIds.empty()) {
+    auto const id = freeIds.back();
+    freeIds.pop_back();
+    textures[id] = t;
+    return id;
+  }
+  textures.push_back(t);
+  return textures.size() - 1;
+}
+
+/**
+ * @brief Removes texture, its resident levels are released
+ *
+ * @param id id of texture
+ */
+void TextureResidency::remove(Id id)
+{
+  assert(this != nullptr);
+  auto &t = get(id);
+  for (size_t l = t.resident; l < t.levelSizes.size(); ++l)
+    statistics.residentBytes -= t.levelSizes[l];
+  t       = Entry();
+  statistics.nofTextures--;
+  freeIds.push_back(id);
+}
+
+/**
+ * @brief Requests level of texture for current frame, the finest request
+ * of the frame wins
+ *
+ * @param id id of texture
+ * @param level finest level that is needed
+ */
+void TextureResidency::request(Id id, size_t level)
+{
+  assert(this != nullptr);
+  auto &t = get(id);
+  level   = std::min(level, t.levelSizes.size() - 1);
+  t.requested = t.used ? std::min(t.requested, level) : level;
+  t.used      = true;
+  t.lastUse   = frame;
+}
+
+/**
+ * @brief Ends frame, it loads requested levels coarse to fine and evicts
+ * levels that are not needed if budget is exceeded
+ *
+ * @return changes of resident levels, evictions are before loads
+ */
+std::vector<TextureResidency::Change> TextureResidency::update()
+{
+  assert(this != nullptr);
+  std::vector<Id> lru;
+  for (Id id = 0; id < textures.size(); ++id) {
+    if (!textures[id].valid) continue;
+    textures[id].previous = textures[id].resident;
+    lru.push_back(id);
+  }
+  std::stable_sort(lru.begin(), lru.end(), [&](Id a, Id b) {
+    return textures[a].lastUse < textures[b].lastUse;
+  });
+  size_t cursor = 0;
+  evict(0, lru, cursor);
+
+  // coarser levels first, they are cheaper and matter more
+  std::priority_queue<std::pair<size_t, Id>> queue;
+  for (auto const id : lru) {
+    auto const &t = textures[id];
+    if (t.used && getNeededLevel(t) < t.resident)
+      queue.push(std::make_pair(t.resident - 1, id));
+  }
+  while (!queue.empty()) {
+    auto const id    = queue.top().second;
+    auto const level = queue.top().first;
+    queue.pop();
+    auto &     t    = textures[id];
+    auto const size = t.levelSizes[level];
+    if (!evict(size, lru, cursor)) {
+      statistics.deniedLevels += t.resident - getNeededLevel(t);
+      continue;
+    }
+    t.resident = level;
+    statistics.residentBytes += size;
+    statistics.loadedLevels++;
+    statistics.loadedBytes += size;
+    if (getNeededLevel(t) < t.resident)
+      queue.push(std::make_pair(t.resident - 1, id));
+  }
+  statistics.peakResidentBytes =
+      std::max(statistics.peakResidentBytes, statistics.residentBytes);
+
+  std::vector<Change> changes;
+  for (int loads = 0; loads < 2; ++loads)
+    for (Id id = 0; id < textures.size(); ++id) {
+      auto const &t = textures[id];
+      if (!t.valid || t.resident == t.previous) continue;
+      if ((t.resident < t.previous) != (loads == 1)) continue;
+      Change c;
+      c.id   = id;
+      c.from = t.previous;
+      c.to   = t.resident;
+      changes.push_back(c);
+    }
+
+  for (auto &t : textures) t.used = false;
+  frame++;
+  return changes;
+}
+
+bool TextureResidency::isValid(Id id) const
+{
+  return id < textures.size() && textures[id].valid;
+}
+
+size_t TextureResidency::getResidentLevel(Id id) const
+{
+  return get(id).resident;
+}
+
+size_t TextureResidency::getNofLevels(Id id) const
+{
+  return get(id).levelSizes.size();
+}
+
+size_t TextureResidency::getBudget() const { return statistics.budget; }
+
+/**
+ * @brief Sets budget, next update() evicts levels if it is exceeded
+ *
+ * @param budget budget in bytes
+ */
+void TextureResidency::setBudget(size_t budget) { statistics.budget = budget; }
+
+size_t TextureResidency::getResidentBytes() const
+{
+  return statistics.residentBytes;
+}
+
+/**
+ * @brief gets number of current frame, it is incremented by update()
+ *
+ * @return frame number
+ */
+uint64_t TextureResidency::getFrame() const { return frame; }
+
+TextureResidency::Statistics const &TextureResidency::getStatistics() const
+{
+  return statistics;
+}
+
+/**
+ * @brief Computes finest level that is needed to cover screen-space size
+ * of texture (one texel per pixel)
+ *
+ * @param textureWidth width of level 0
+ * @param textureHeight height of level 0
+ * @param screenWidth width of texture on screen in pixels
+ * @param screenHeight height of texture on screen in pixels
+ * @param nofLevels number of levels of texture
+ *
+ * @return level, the coarsest one for invisible textures
+ */
+size_t TextureResidency::computeLevel(size_t textureWidth,
+                                      size_t textureHeight,
+                                      float  screenWidth,
+                                      float  screenHeight,
+                                      size_t nofLevels)
+{
+  if (nofLevels == 0) return 0;
+  if (!(screenWidth > 0.f) || !(screenHeight > 0.f)) return nofLevels - 1;
+  auto const ratio =
+      std::max(static_cast<float>(textureWidth) / screenWidth,
+               static_cast<float>(textureHeight) / screenHeight);
+  if (ratio <= 1.f) return 0;
+  auto const level = static_cast<size_t>(std::floor(std::log2(ratio)));
+  return std::min(level, nofLevels - 1);
+}
+
+TextureResidency::Entry &TextureResidency::get(Id id)
+{
+  if (!isValid(id))
+    throw std::invalid_argument("geGL: TextureResidency - invalid texture id");
+  return textures[id];
+}
+
+TextureResidency::Entry const &TextureResidency::get(Id id) const
+{
+  if (!isValid(id))
+    throw std::invalid_argument("geGL: TextureResidency - invalid texture id");
+  return textures[id];
+}
+
+/**
+ * @brief gets finest level that texture needs in current frame
+ *
+ * @param texture texture
+ *
+ * @return requested level if texture is used, coarse levels otherwise
+ */
+size_t TextureResidency::getNeededLevel(Entry const &texture) const
+{
+  if (!texture.used) return texture.coarsest;
+  return std::min(texture.requested, texture.coarsest);
+}
+
+/**
+ * @brief Evicts levels that are not needed in current frame until required
+ * bytes fit into budget, least recently used textures are evicted first
+ *
+ * @param required bytes that have to fit
+ * @param lru valid textures sorted by last use
+ * @param cursor first texture of lru that can have unneeded levels
+ *
+ * @return true if required bytes fit into budget
+ */
+bool TextureResidency::evict(size_t                 required,
+                             std::vector<Id> const &lru,
+                             size_t &               cursor)
+{
+  auto const fits = [&] {
+    return statistics.residentBytes + required <= statistics.budget;
+  };
+  while (!fits() && cursor < lru.size()) {
+    auto &t = textures[lru[cursor]];
+    if (t.resident >= getNeededLevel(t)) {
+      cursor++;
+      continue;
+    }
+    auto const size = t.levelSizes[t.resident];
+    t.resident++;
+    statistics.residentBytes -= size;
+    statistics.evictedLevels++;
+    statistics.evictedBytes += size;
+  }
+  return fits();
+}
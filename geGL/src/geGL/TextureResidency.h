@@ -0,0 +1,88 @@
+#pragma once
+
+#include <geGL/gegl_export.h>
+#include <geGL/Fwd.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Mip residency of streamed textures under a byte budget.
+ * It does not touch OpenGL, it only decides which mipmap levels are resident.
+ *
+ * Every texture has nofLevels levels, level 0 is the finest one.
+ * The coarsest nofCoarseLevels levels are always resident, finer levels are
+ * loaded on request. Textures request the finest level they need every frame
+ * (request()), update() loads requested levels coarse to fine while they fit
+ * into budget. If they do not fit, levels that are not needed in current
+ * frame are evicted, least recently used textures first.
+ * Resident level of texture is the finest resident level, all coarser levels
+ * are resident too.
+ */
+class GEGL_EXPORT ge::gl::TextureResidency {
+ public:
+  using Id = size_t;
+  static Id const INVALID = ~static_cast<Id>(0);
+  /**
+   * @brief Change of resident level made by update()
+   */
+  struct Change {
+    Id     id   = INVALID;
+    size_t from = 0;  ///< old resident level
+    size_t to   = 0;  ///< new resident level, levels [to,from) are loaded if to < from
+  };
+  /**
+   * @brief Residency statistics
+   */
+  struct Statistics {
+    size_t budget            = 0;  ///< budget in bytes
+    size_t residentBytes     = 0;  ///< bytes of resident levels
+    size_t peakResidentBytes = 0;  ///< maximal number of resident bytes
+    size_t nofTextures       = 0;  ///< number of managed textures
+    size_t loadedLevels      = 0;  ///< levels loaded by update()
+    size_t loadedBytes       = 0;  ///< bytes loaded by update()
+    size_t evictedLevels     = 0;  ///< levels evicted by update()
+    size_t evictedBytes      = 0;  ///< bytes evicted by update()
+    size_t deniedLevels      = 0;  ///< requested levels that did not fit into budget
+  };
+  TextureResidency(size_t budget);
+  Id                  add(std::vector<size_t> const& levelSizes,
+                          size_t                     nofCoarseLevels = 1);
+  void                remove(Id id);
+  void                request(Id id, size_t level);
+  std::vector<Change> update();
+  bool                isValid(Id id) const;
+  size_t              getResidentLevel(Id id) const;
+  size_t              getNofLevels(Id id) const;
+  size_t              getBudget() const;
+  void                setBudget(size_t budget);
+  size_t              getResidentBytes() const;
+  uint64_t            getFrame() const;
+  Statistics const&   getStatistics() const;
+
+  static size_t computeLevel(size_t textureWidth,
+                             size_t textureHeight,
+                             float  screenWidth,
+                             float  screenHeight,
+                             size_t nofLevels);
+
+ protected:
+  struct Entry {
+    std::vector<size_t> levelSizes;
+    size_t              coarsest  = 0;  ///< finest level that is never evicted
+    size_t              resident  = 0;  ///< finest resident level
+    size_t              requested = 0;  ///< finest level requested in current frame
+    size_t              previous  = 0;  ///< resident level before update()
+    uint64_t            lastUse   = 0;  ///< frame of last request
+    bool                used      = false;  ///< requested in current frame
+    bool                valid     = false;
+  };
+  Entry&             get(Id id);
+  Entry const&       get(Id id) const;
+  size_t             getNeededLevel(Entry const& texture) const;
+  bool               evict(size_t required, std::vector<Id> const& lru, size_t& cursor);
+  std::vector<Entry> textures;
+  std::vector<Id>    freeIds;
+  uint64_t           frame = 1;
+  Statistics         statistics;
+};
@@ -0,0 +1,214 @@
+#include <geGL/TextureStreamer.h>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+/**
+ * @brief Constructor
+ *
+ * @param budget budget of uploaded levels in bytes
+ * @param clamp parameter that limits sampled levels
+ */
+TextureStreamer::TextureStreamer(size_t budget, Clamp clamp)
+    : TextureStreamer(nullptr, budget, clamp)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param budget budget of uploaded levels in bytes
+ * @param clamp parameter that limits sampled levels
+ */
+TextureStreamer::TextureStreamer(FunctionTablePointer const &table,
+                                 size_t                      budget,
+                                 Clamp                       clamp)
+    : gl(table), clampMode(clamp), residency(budget)
+{
+}
+
+/**
+ * @brief Adds texture with immutable storage, its coarse levels are uploaded
+ * immediately
+ *
+ * @param texture texture with all mipmap levels allocated
+ * @param loader callback that uploads one mipmap level
+ * @param nofCoarseLevels number of coarsest levels that are always uploaded
+ *
+ * @return id of texture
+ */
+TextureStreamer::Id TextureStreamer::add(
+    std::shared_ptr<Texture> const &texture,
+    Loader const &                  loader,
+    size_t                          nofCoarseLevels)
+{
+  assert(this != nullptr);
+  if (!texture || !loader)
+    throw std::invalid_argument(
+        "geGL: TextureStreamer::add - texture and loader are required");
+  auto const nofLevels = texture->getImmutableLevels();
+  if (nofLevels == 0)
+    throw std::invalid_argument(
+        "geGL: TextureStreamer::add - texture has to have immutable storage");
+  std::vector<size_t> levelSizes;
+  for (GLuint l = 0; l < nofLevels; ++l)
+    levelSizes.push_back(static_cast<size_t>(texture->getLevelSize(l)));
+
+  auto const id = residency.add(levelSizes, nofCoarseLevels);
+  if (id >= entries.size()) entries.resize(id + 1);
+  auto &e   = entries[id];
+  e.texture = texture;
+  e.loader  = loader;
+  load(e, levelSizes.size(), residency.getResidentLevel(id));
+  clamp(e, residency.getResidentLevel(id));
+  return id;
+}
+
+/**
+ * @brief Creates 2D texture with full mipmap chain and adds it
+ *
+ * @param target target of texture
+ * @param internalFormat internal format of texture
+ * @param width width of level 0
+ * @param height height of level 0
+ * @param loader callback that uploads one mipmap level
+ * @param nofCoarseLevels number of coarsest levels that are always uploaded
+ *
+ * @return id of texture
+ */
+TextureStreamer::Id TextureStreamer::create(GLenum        target,
+                                            GLenum        internalFormat,
+                                            GLsizei       width,
+                                            GLsizei       height,
+                                            Loader const &loader,
+                                            size_t        nofCoarseLevels)
+{
+  assert(this != nullptr);
+  GLsizei levels = 1;
+  while ((std::max(width, height) >> levels) > 0) levels++;
+  auto const texture = std::make_shared<Texture>(
+      gl.getFunctionTable(), target, internalFormat, levels, width, height);
+  return add(texture, loader, nofCoarseLevels);
+}
+
+/**
+ * @brief Removes texture from streamer, texture itself is released by its
+ * last owner
+ *
+ * @param id id of texture
+ */
+void TextureStreamer::remove(Id id)
+{
+  assert(this != nullptr);
+  residency.remove(id);
+  entries[id] = Entry();
+}
+
+/**
+ * @brief Requests mipmap level of texture for current frame
+ *
+ * @param id id of texture
+ * @param level finest level that is needed
+ */
+void TextureStreamer::request(Id id, size_t level)
+{
+  assert(this != nullptr);
+  residency.request(id, level);
+}
+
+/**
+ * @brief Requests mipmap level that covers screen-space size of texture
+ *
+ * @param id id of texture
+ * @param screenWidth width of texture on screen in pixels
+ * @param screenHeight height of texture on screen in pixels
+ */
+void TextureStreamer::request(Id id, float screenWidth, float screenHeight)
+{
+  assert(this != nullptr);
+  auto const &texture = *get(id).texture;
+  residency.request(
+      id, TextureResidency::computeLevel(
+              texture.getWidth(0), std::max(texture.getHeight(0), 1u),
+              screenWidth, screenHeight, residency.getNofLevels(id)));
+}
+
+/**
+ * @brief Ends frame, it uploads levels chosen by residency and clamps
+ * sampled levels of changed textures
+ *
+ * @return number of uploaded levels
+ */
+size_t TextureStreamer::update()
+{
+  assert(this != nullptr);
+  size_t uploaded = 0;
+  for (auto const &c : residency.update()) {
+    auto &e = entries[c.id];
+    if (c.to < c.from) {
+      load(e, c.from, c.to);
+      uploaded += c.from - c.to;
+    }
+    clamp(e, c.to);
+  }
+  return uploaded;
+}
+
+std::shared_ptr<Texture> const &TextureStreamer::getTexture(Id id) const
+{
+  if (!residency.isValid(id))
+    throw std::invalid_argument("geGL: TextureStreamer - invalid texture id");
+  return entries[id].texture;
+}
+
+/**
+ * @brief gets residency, it can be used to change budget or read statistics
+ *
+ * @return residency
+ */
+TextureResidency &TextureStreamer::getResidency() { return residency; }
+
+TextureResidency const &TextureStreamer::getResidency() const
+{
+  return residency;
+}
+
+/**
+ * @brief Uploads levels [to,from), coarser levels first
+ *
+ * @param entry texture
+ * @param from coarsest level that is already uploaded
+ * @param to finest level that is uploaded
+ */
+void TextureStreamer::load(Entry &entry, size_t from, size_t to)
+{
+  for (auto l = from; l > to; --l)
+    entry.loader(*entry.texture, static_cast<GLint>(l - 1));
+}
+
+/**
+ * @brief Limits sampling of texture to levels that are uploaded
+ *
+ * @param entry texture
+ * @param level finest uploaded level
+ */
+void TextureStreamer::clamp(Entry const &entry, size_t level)
+{
+  if (clampMode == BASE_LEVEL) {
+    entry.texture->texParameteri(GL_TEXTURE_BASE_LEVEL,
+                                 static_cast<GLint>(level));
+    return;
+  }
+  auto lod = static_cast<GLfloat>(level);
+  entry.texture->texParameterfv(GL_TEXTURE_MIN_LOD, &lod);
+}
+
+TextureStreamer::Entry &TextureStreamer::get(Id id)
+{
+  if (!residency.isValid(id))
+    throw std::invalid_argument("geGL: TextureStreamer - invalid texture id");
+  return entries[id];
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <geGL/Texture.h>
+#include <geGL/TextureResidency.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Streams mipmap levels of textures under a byte budget.
+ *
+ * Thin OpenGL adapter of TextureResidency. Textures have immutable storage
+ * with full mipmap chain, only coarse levels are uploaded when texture is
+ * added. Finer levels are uploaded by loader callback when they are requested
+ * and fit into budget, and GL_TEXTURE_BASE_LEVEL (or GL_TEXTURE_MIN_LOD) of
+ * texture is moved so only uploaded levels are sampled.
+ * Evicted levels are only excluded from sampling, immutable storage cannot be
+ * shrunk. Budget therefore limits uploaded and sampled levels, not allocated
+ * memory.
+ *
+ * @code
+ * TextureStreamer streamer(256<<20);
+ * auto const id = streamer.create(GL_TEXTURE_2D,GL_RGBA8,2048,2048,
+ *   [&](Texture&texture,GLint level){texture.setData2D(pixels(level),GL_RGBA,GL_UNSIGNED_BYTE,level);});
+ * for(;;){
+ *   streamer.request(id,screenWidth,screenHeight);
+ *   streamer.update();
+ *   ...render...
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::TextureStreamer {
+ public:
+  using Id     = TextureResidency::Id;
+  using Loader = std::function<void(Texture&, GLint level)>;
+  /**
+   * @brief Parameter that limits sampled levels
+   */
+  enum Clamp {
+    BASE_LEVEL,  ///< GL_TEXTURE_BASE_LEVEL, levels outside are not sampled
+    MIN_LOD,     ///< GL_TEXTURE_MIN_LOD, base level stays 0
+  };
+  TextureStreamer(size_t budget, Clamp clamp = BASE_LEVEL);
+  TextureStreamer(FunctionTablePointer const& table,
+                  size_t                      budget,
+                  Clamp                       clamp = BASE_LEVEL);
+  Id     add(std::shared_ptr<Texture> const& texture,
+             Loader const&                   loader,
+             size_t                          nofCoarseLevels = 1);
+  Id     create(GLenum        target,
+                GLenum        internalFormat,
+                GLsizei       width,
+                GLsizei       height,
+                Loader const& loader,
+                size_t        nofCoarseLevels = 1);
+  void   remove(Id id);
+  void   request(Id id, size_t level);
+  void   request(Id id, float screenWidth, float screenHeight);
+  size_t update();
+  std::shared_ptr<Texture> const& getTexture(Id id) const;
+  TextureResidency&               getResidency();
+  TextureResidency const&         getResidency() const;
+
+ protected:
+  struct Entry {
+    std::shared_ptr<Texture> texture;
+    Loader                   loader;
+  };
+  void               load(Entry& entry, size_t from, size_t to);
+  void               clamp(Entry const& entry, size_t level);
+  Entry&             get(Id id);
+  Context            gl;
+  Clamp              clampMode;
+  TextureResidency   residency;
+  std::vector<Entry> entries;
+};
@@ -0,0 +1,409 @@
+#include <geGL/TextureUploader.h>
+#include <geGL/OpenGLUtil.h>
+#include <geGL/Texture.h>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+namespace {
+GLbitfield const storageFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+size_t const sliceAlignment = 16;
+
+/**
+ * @brief Binds buffer to GL_PIXEL_UNPACK_BUFFER with unpack alignment 1,
+ * previous state is restored in destructor
+ */
+class UnpackState {
+ public:
+  UnpackState(Context const &gl, Buffer const &buffer) : gl(gl)
+  {
+    gl.glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &oldBinding);
+    gl.glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldAlignment);
+    gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.getId());
+    gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  }
+  ~UnpackState()
+  {
+    gl.glPixelStorei(GL_UNPACK_ALIGNMENT, oldAlignment);
+    gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(oldBinding));
+  }
+
+ private:
+  Context const &gl;
+  GLint          oldBinding   = 0;
+  GLint          oldAlignment = 4;
+};
+}  // namespace
+
+/**
+ * @brief Constructor
+ *
+ * @param stagingSize size of persistently mapped staging buffer in bytes
+ * @param nofThreads number of decoding threads, 0 - decode inside pump()
+ */
+TextureUploader::TextureUploader(GLsizeiptr stagingSize, size_t nofThreads)
+    : TextureUploader(nullptr, stagingSize, nofThreads)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param stagingSize size of persistently mapped staging buffer in bytes
+ * @param nofThreads number of decoding threads, 0 - decode inside pump()
+ */
+TextureUploader::TextureUploader(FunctionTablePointer const &table,
+                                 GLsizeiptr                  stagingSize,
+                                 size_t                      nofThreads)
+    : gl(table)
+{
+  if (stagingSize <= 0)
+    throw std::invalid_argument(
+        "geGL: TextureUploader - staging size has to be positive");
+  allocator = RangeAllocator(static_cast<size_t>(stagingSize));
+  staging = std::make_shared<Buffer>(table, stagingSize, nullptr, storageFlags);
+  mapping = static_cast<uint8_t *>(staging->map(0, stagingSize, storageFlags));
+  if (!mapping)
+    throw std::runtime_error(
+        "geGL: TextureUploader - persistent mapping failed");
+  for (size_t i = 0; i < nofThreads; ++i)
+    workers.emplace_back(&TextureUploader::work, this);
+}
+
+/**
+ * @brief Destructor, it stops workers, requests that were not uploaded are
+ * dropped
+ */
+TextureUploader::~TextureUploader()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stop = true;
+  }
+  condition.notify_all();
+  for (auto &w : workers) w.join();
+  staging->unmap();
+}
+
+/**
+ * @brief Requests upload of whole mipmap level (all layers / faces)
+ *
+ * @param texture destination texture, it is kept alive until upload is issued
+ * @param level mipmap level
+ * @param format format of decoded pixels
+ * @param type type of decoded pixels
+ * @param decoder writes tightly packed pixels (alignment 1), it runs on
+ * worker thread
+ * @param done it is called by pump() when upload is issued
+ */
+void TextureUploader::upload(std::shared_ptr<Texture> const &texture,
+                             GLint                           level,
+                             GLenum                          format,
+                             GLenum                          type,
+                             Decoder const &                 decoder,
+                             Callback const &                done)
+{
+  assert(this != nullptr);
+  if (!texture)
+    throw std::invalid_argument(
+        "geGL: TextureUploader::upload - texture is nullptr");
+  GLsizei const width  = texture->getWidth(level);
+  GLsizei const height = texture->hasHeight() ? texture->getHeight(level) : 0;
+  GLsizei       depth  = texture->hasDepth() ? texture->getDepth(level) : 0;
+  if (texture->getTarget() == GL_TEXTURE_CUBE_MAP) depth = 6;
+  upload(texture, level, 0, 0, 0, width, height, depth, format, type, decoder,
+         done);
+}
+
+/**
+ * @brief Requests upload of sub-image
+ *
+ * @param texture destination texture, it is kept alive until upload is issued
+ * @param level mipmap level
+ * @param xoffset x offset of sub-image
+ * @param yoffset y offset of sub-image
+ * @param zoffset z offset of sub-image
+ * @param width width of sub-image
+ * @param height height of sub-image, 0 for 1D sub-image
+ * @param depth depth of sub-image, 0 for 1D and 2D sub-image
+ * @param format format of decoded pixels
+ * @param type type of decoded pixels
+ * @param decoder writes tightly packed pixels (alignment 1), it runs on
+ * worker thread
+ * @param done it is called by pump() when upload is issued
+ */
+void TextureUploader::upload(std::shared_ptr<Texture> const &texture,
+                             GLint                           level,
+                             GLint                           xoffset,
+                             GLint                           yoffset,
+                             GLint                           zoffset,
+                             GLsizei                         width,
+                             GLsizei                         height,
+                             GLsizei                         depth,
+                             GLenum                          format,
+                             GLenum                          type,
+                             Decoder const &                 decoder,
+                             Callback const &                done)
+{
+  assert(this != nullptr);
+  if (!texture || !decoder)
+    throw std::invalid_argument(
+        "geGL: TextureUploader::upload - texture and decoder are required");
+  auto const size = getImageSize(format, type, width, std::max(height, 1),
+                                 std::max(depth, 1), 1);
+  if (size > allocator.getCapacity())
+    throw std::invalid_argument(
+        "geGL: TextureUploader::upload - image is larger than staging buffer");
+  std::unique_ptr<Request> request(new Request());
+  request->texture = texture;
+  request->level   = level;
+  request->xoffset = xoffset;
+  request->yoffset = yoffset;
+  request->zoffset = zoffset;
+  request->width   = width;
+  request->height  = height;
+  request->depth   = depth;
+  request->format  = format;
+  request->type    = type;
+  request->size    = size;
+  request->decoder = decoder;
+  request->done    = done;
+  waiting.push_back(std::move(request));
+  statistics.requests++;
+  dispatch();
+}
+
+/**
+ * @brief Sets per-frame budget of pump(), at least one upload is issued per
+ * frame even if it exceeds budget
+ *
+ * @param bytesPerFrame uploaded bytes per frame, 0 - unlimited
+ * @param timePerFrame time spent in pump() per frame, 0 - unlimited
+ */
+void TextureUploader::setBudget(GLsizeiptr                bytesPerFrame,
+                                std::chrono::microseconds timePerFrame)
+{
+  this->bytesPerFrame = bytesPerFrame;
+  this->timePerFrame  = timePerFrame;
+}
+
+/**
+ * @brief Issues uploads of decoded requests within budget, it does not block
+ * on GPU or on workers
+ *
+ * @return number of issued uploads
+ */
+size_t TextureUploader::pump()
+{
+  assert(this != nullptr);
+  auto const start = std::chrono::steady_clock::now();
+  retire(false);
+  dispatch();
+  if (!waiting.empty()) statistics.stagingStalls++;
+
+  std::unique_ptr<Request> request;
+  if (!nextDecoded(request)) return 0;
+
+  Batch                 batch;
+  std::vector<Callback> callbacks;
+  GLsizeiptr            bytes = 0;
+  {
+    UnpackState const state(gl, *staging);
+    do {
+      issue(*request);
+      nofDecoding--;
+      batch.offsets.push_back(request->offset);
+      bytes += static_cast<GLsizeiptr>(request->size);
+      if (request->done) callbacks.push_back(request->done);
+      auto const elapsed = std::chrono::steady_clock::now() - start;
+      if ((bytesPerFrame > 0 && bytes >= bytesPerFrame) ||
+          (timePerFrame.count() > 0 && elapsed >= timePerFrame)) {
+        if (nofDecoding > 0) statistics.budgetStops++;
+        break;
+      }
+    } while (nextDecoded(request));
+  }
+  auto const issued = batch.offsets.size();
+  batch.fence       = std::unique_ptr<Sync>(new Sync(gl.getFunctionTable()));
+  inFlight.push_back(std::move(batch));
+  statistics.frames++;
+  for (auto const &c : callbacks) c();
+  return issued;
+}
+
+/**
+ * @brief Uploads all requests regardless of budget and waits for GPU
+ */
+void TextureUploader::finish()
+{
+  assert(this != nullptr);
+  auto const oldBytes = bytesPerFrame;
+  auto const oldTime  = timePerFrame;
+  bytesPerFrame       = 0;
+  timePerFrame        = std::chrono::microseconds(0);
+  while (getNofPending() > 0) {
+    if (pump() > 0) continue;
+    if (nofDecoding > 0 && !workers.empty()) {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&] { return !decoded.empty(); });
+      continue;
+    }
+    retire(true);
+  }
+  retire(true);
+  bytesPerFrame = oldBytes;
+  timePerFrame  = oldTime;
+}
+
+/**
+ * @brief gets number of requests that were not issued yet
+ *
+ * @return number of requests waiting for staging, decoding or upload
+ */
+size_t TextureUploader::getNofPending() const
+{
+  return waiting.size() + nofDecoding;
+}
+
+GLsizeiptr TextureUploader::getStagingSize() const
+{
+  return staging->getSize();
+}
+
+TextureUploader::Statistics const &TextureUploader::getStatistics() const
+{
+  return statistics;
+}
+
+/**
+ * @brief Frees staging slices of batches that GPU has finished
+ *
+ * @param wait true - wait for all batches, false - poll them
+ */
+void TextureUploader::retire(bool wait)
+{
+  while (!inFlight.empty()) {
+    auto &batch = inFlight.front();
+    if (wait)
+      batch.fence->wait();
+    else if (!batch.fence->isSignaled())
+      break;
+    for (auto const o : batch.offsets) allocator.free(o);
+    inFlight.pop_front();
+  }
+}
+
+/**
+ * @brief Gives staging slices to waiting requests in submission order and
+ * passes them to decoding
+ */
+void TextureUploader::dispatch()
+{
+  while (!waiting.empty()) {
+    auto &     request = waiting.front();
+    auto const offset =
+        allocator.allocate(std::max(request->size, size_t(1)), sliceAlignment);
+    if (offset == RangeAllocator::INVALID) break;
+    request->offset = offset;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      toDecode.push_back(std::move(request));
+    }
+    waiting.pop_front();
+    nofDecoding++;
+    condition.notify_all();
+  }
+}
+
+/**
+ * @brief Gets next decoded request, without workers the request is decoded
+ * on calling thread
+ *
+ * @param request decoded request
+ *
+ * @return false if no request is decoded
+ */
+bool TextureUploader::nextDecoded(std::unique_ptr<Request> &request)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!decoded.empty()) {
+      request = std::move(decoded.front());
+      decoded.pop_front();
+      return true;
+    }
+    if (!workers.empty() || toDecode.empty()) return false;
+    request = std::move(toDecode.front());
+    toDecode.pop_front();
+  }
+  decode(*request);
+  return true;
+}
+
+/**
+ * @brief Runs decoder of request into its staging slice
+ *
+ * @param request request
+ */
+void TextureUploader::decode(Request &request)
+{
+  request.decoder(mapping + request.offset, request.size);
+  request.decoder = nullptr;
+}
+
+/**
+ * @brief Uploads request from staging buffer bound to GL_PIXEL_UNPACK_BUFFER.
+ * Faces of cube map are uploaded one by one, glTexSubImage3D does not accept
+ * GL_TEXTURE_CUBE_MAP before OpenGL 4.5.
+ *
+ * @param request decoded request
+ */
+void TextureUploader::issue(Request const &request)
+{
+  auto const data = reinterpret_cast<GLvoid const *>(request.offset);
+  auto const &t   = *request.texture;
+  if (request.height == 0)
+    t.setData1D(data, request.format, request.type, request.level,
+                request.xoffset, request.width);
+  else if (request.depth != 0 && t.getTarget() == GL_TEXTURE_CUBE_MAP) {
+    auto const faceSize = request.size / static_cast<size_t>(request.depth);
+    for (GLsizei f = 0; f < request.depth; ++f)
+      t.setData2D(reinterpret_cast<GLvoid const *>(request.offset + f * faceSize),
+                  request.format, request.type, request.level,
+                  GL_TEXTURE_CUBE_MAP_POSITIVE_X + request.zoffset + f,
+                  request.xoffset, request.yoffset, request.width,
+                  request.height);
+  } else if (request.depth == 0)
+    t.setData2D(data, request.format, request.type, request.level, 0,
+                request.xoffset, request.yoffset, request.width,
+                request.height);
+  else
+    t.setData3D(data, request.format, request.type, request.level, 0,
+                request.xoffset, request.yoffset, request.zoffset,
+                request.width, request.height, request.depth);
+  statistics.uploads++;
+  statistics.bytesUploaded += static_cast<GLsizeiptr>(request.size);
+}
+
+/**
+ * @brief Loop of worker thread, it decodes requests until destructor
+ */
+void TextureUploader::work()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  for (;;) {
+    condition.wait(lock, [&] { return stop || !toDecode.empty(); });
+    if (stop) return;
+    auto request = std::move(toDecode.front());
+    toDecode.pop_front();
+    lock.unlock();
+    decode(*request);
+    lock.lock();
+    decoded.push_back(std::move(request));
+    condition.notify_all();
+  }
+}
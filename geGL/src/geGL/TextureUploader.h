@@ -0,0 +1,129 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <geGL/RangeAllocator.h>
+#include <geGL/Sync.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Asynchronous upload of texture images through persistently mapped
+ * pixel unpack buffer.
+ *
+ * Every request gets slice of staging buffer, worker threads run decoder of
+ * the request that writes pixels directly into the slice. pump() has to be
+ * called by thread of the context once per frame, it issues glTextureSubImage*
+ * from staging buffer for decoded requests until per-frame byte or time
+ * budget is exhausted, fences issued uploads and frees slices whose fences
+ * are signaled. Requests wait for staging space in submission order.
+ * Texture can be used (and done callback is called) as soon as its upload is
+ * issued, so textures become usable progressively. Upload coarse levels
+ * first to get low resolution textures early.
+ * With zero worker threads decoders run inside pump() on thread of the
+ * context (within time budget). Decoders must not throw.
+ *
+ * @code
+ * TextureUploader uploader;
+ * uploader.upload(texture,0,GL_RGBA,GL_UNSIGNED_BYTE,[file](void*pixels,size_t size){decode(file,pixels,size);});
+ * for(;;){
+ *   uploader.pump();
+ *   ...render...
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::TextureUploader {
+ public:
+  using Decoder  = std::function<void(void* pixels, size_t size)>;
+  using Callback = std::function<void()>;
+  /**
+   * @brief Upload statistics
+   */
+  struct Statistics {
+    size_t     requests      = 0;  ///< number of upload requests
+    size_t     uploads       = 0;  ///< glTextureSubImage* calls issued
+    GLsizeiptr bytesUploaded = 0;  ///< bytes uploaded from staging buffer
+    size_t     frames        = 0;  ///< calls of pump() that issued uploads
+    size_t     budgetStops   = 0;  ///< pumps stopped by byte or time budget
+    size_t     stagingStalls = 0;  ///< pumps that could not get staging space
+  };
+  TextureUploader(GLsizeiptr stagingSize = 64 * 1024 * 1024,
+                  size_t     nofThreads  = 1);
+  TextureUploader(FunctionTablePointer const& table,
+                  GLsizeiptr                  stagingSize = 64 * 1024 * 1024,
+                  size_t                      nofThreads  = 1);
+  ~TextureUploader();
+  TextureUploader(TextureUploader const&) = delete;
+  TextureUploader& operator=(TextureUploader const&) = delete;
+  void upload(std::shared_ptr<Texture> const& texture,
+              GLint                           level,
+              GLenum                          format,
+              GLenum                          type,
+              Decoder const&                  decoder,
+              Callback const&                 done = nullptr);
+  void upload(std::shared_ptr<Texture> const& texture,
+              GLint                           level,
+              GLint                           xoffset,
+              GLint                           yoffset,
+              GLint                           zoffset,
+              GLsizei                         width,
+              GLsizei                         height,
+              GLsizei                         depth,
+              GLenum                          format,
+              GLenum                          type,
+              Decoder const&                  decoder,
+              Callback const&                 done = nullptr);
+  void              setBudget(GLsizeiptr                bytesPerFrame,
+                              std::chrono::microseconds timePerFrame);
+  size_t            pump();
+  void              finish();
+  size_t            getNofPending() const;
+  GLsizeiptr        getStagingSize() const;
+  Statistics const& getStatistics() const;
+
+ protected:
+  struct Request {
+    std::shared_ptr<Texture> texture;
+    GLint                    level;
+    GLint                    xoffset, yoffset, zoffset;
+    GLsizei                  width, height, depth;
+    GLenum                   format;
+    GLenum                   type;
+    size_t                   size;
+    size_t                   offset = RangeAllocator::INVALID;  ///< staging slice
+    Decoder                  decoder;
+    Callback                 done;
+  };
+  struct Batch {
+    std::unique_ptr<Sync> fence;
+    std::vector<size_t>   offsets;  ///< slices read by uploads of batch
+  };
+  void retire(bool wait);
+  void dispatch();
+  bool nextDecoded(std::unique_ptr<Request>& request);
+  void decode(Request& request);
+  void issue(Request const& request);
+  void work();
+  Context                              gl;
+  std::shared_ptr<Buffer>              staging;
+  uint8_t*                             mapping = nullptr;
+  RangeAllocator                       allocator;
+  std::deque<std::unique_ptr<Request>> waiting;  ///< requests without staging slice
+  std::deque<Batch>                    inFlight;
+  GLsizeiptr                           bytesPerFrame = 0;  ///< 0 - unlimited
+  std::chrono::microseconds            timePerFrame{0};    ///< 0 - unlimited
+  size_t                               nofDecoding = 0;    ///< requests given to decoding
+  Statistics                           statistics;
+
+  std::vector<std::thread>             workers;
+  std::mutex                           mutex;
+  std::condition_variable              condition;
+  std::deque<std::unique_ptr<Request>> toDecode;  ///< guarded by mutex
+  std::deque<std::unique_ptr<Request>> decoded;   ///< guarded by mutex
+  bool                                 stop = false;  ///< guarded by mutex
+};
@@ -0,0 +1,160 @@
+#include <geGL/Timeline.h>
+#include <geGL/Sync.h>
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+using namespace ge::gl;
+
+/**
+ * @brief Constructor
+ */
+Timeline::Timeline() : Timeline(nullptr) {}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ */
+Timeline::Timeline(FunctionTablePointer const &table) : table(table) {}
+
+/**
+ * @brief Destructor, pending fences are deleted, their callbacks are not
+ * called
+ */
+Timeline::~Timeline() {}
+
+/**
+ * @brief Ends current frame, it places fence behind its commands
+ *
+ * @return number of ended frame
+ */
+uint64_t Timeline::endFrame()
+{
+  assert(this != nullptr);
+  fences.push_back(std::unique_ptr<Sync>(new Sync(table)));
+  return ++submitted;
+}
+
+/**
+ * @brief Polls fences of pending frames without blocking, retired frames
+ * call their callbacks
+ *
+ * @return number of frames retired by this call
+ */
+size_t Timeline::poll()
+{
+  assert(this != nullptr);
+  auto const before = retired;
+  size_t     index  = 0;
+  while (index < fences.size() && fences[index]->isSignaled()) index++;
+  if (index > 0) retire(retired + index);
+  return static_cast<size_t>(retired - before);
+}
+
+/**
+ * @brief Checks whether frame is retired without blocking
+ *
+ * @param frame frame number
+ *
+ * @return true if GPU has finished frame
+ */
+bool Timeline::isRetired(uint64_t frame)
+{
+  assert(this != nullptr);
+  if (frame <= retired) return true;
+  if (frame > submitted) return false;
+  if (!fences[static_cast<size_t>(frame - retired - 1)]->isSignaled())
+    return false;
+  retire(frame);
+  return true;
+}
+
+/**
+ * @brief Blocks CPU until frame is retired or timeout expires
+ *
+ * @param frame frame number, it has to be submitted
+ * @param timeout timeout in nanoseconds
+ *
+ * @return false if timeout expired
+ */
+bool Timeline::wait(uint64_t frame, GLuint64 timeout)
+{
+  assert(this != nullptr);
+  if (frame <= retired) return true;
+  if (frame > submitted)
+    throw std::invalid_argument(
+        "geGL: Timeline::wait - frame has not been submitted");
+  if (!fences[static_cast<size_t>(frame - retired - 1)]->wait(timeout))
+    return false;
+  retire(frame);
+  return true;
+}
+
+/**
+ * @brief Waits until all submitted frames are retired
+ */
+void Timeline::finish()
+{
+  assert(this != nullptr);
+  wait(submitted);
+}
+
+/**
+ * @brief Registers callback that is called when frame is retired.
+ * Callback of already retired frame is called immediately.
+ *
+ * @param frame frame number, it can be current frame or later frame
+ * @param callback callback
+ */
+void Timeline::onRetired(uint64_t frame, Callback const &callback)
+{
+  assert(this != nullptr);
+  if (!callback) return;
+  if (frame <= retired) {
+    callback();
+    return;
+  }
+  callbacks.emplace(frame, callback);
+}
+
+/**
+ * @brief gets number of frame that is being recorded
+ *
+ * @return number that endFrame() will return
+ */
+uint64_t Timeline::getCurrentFrame() const { return submitted + 1; }
+
+uint64_t Timeline::getLastSubmittedFrame() const { return submitted; }
+
+/**
+ * @brief gets number of last frame known to be retired, it is updated by
+ * poll(), isRetired() and wait()
+ *
+ * @return frame number, 0 if no frame has been retired
+ */
+uint64_t Timeline::getLastRetiredFrame() const { return retired; }
+
+size_t Timeline::getNofPendingFrames() const { return fences.size(); }
+
+size_t Timeline::getNofCallbacks() const { return callbacks.size(); }
+
+/**
+ * @brief Retires frames up to frame, deletes their fences and calls their
+ * callbacks in frame order
+ *
+ * @param frame last retired frame
+ */
+void Timeline::retire(uint64_t frame)
+{
+  while (retired < frame) {
+    fences.pop_front();
+    retired++;
+  }
+  auto const end = callbacks.upper_bound(retired);
+  std::vector<Callback> ready;
+  for (auto it = callbacks.begin(); it != end; ++it)
+    ready.push_back(it->second);
+  callbacks.erase(callbacks.begin(), end);
+  for (auto const &callback : ready) callback();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <geGL/OpenGLContext.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+
+/**
+ * @brief GPU timeline of frames.
+ *
+ * endFrame() places fence behind commands of current frame, frames are
+ * numbered from 1 and numbers increase monotonically. Frame is retired when
+ * its fence is signaled, fences are signaled in submission order, so
+ * retiring frame N retires all frames before it. Retirement is observed
+ * without blocking by poll()/isRetired(), callbacks registered by
+ * onRetired() are called from these functions on thread of the context.
+ *
+ * @code
+ * Timeline timeline;
+ * for(;;){
+ *   timeline.poll();
+ *   ...draw...
+ *   auto const frame = timeline.endFrame();
+ *   timeline.onRetired(frame,[=]{ releaseResourcesOf(frame); });
+ * }
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::Timeline {
+ public:
+  using Callback = std::function<void()>;
+  Timeline();
+  Timeline(FunctionTablePointer const& table);
+  ~Timeline();
+  Timeline(Timeline const&) = delete;
+  Timeline& operator=(Timeline const&) = delete;
+  uint64_t endFrame();
+  size_t   poll();
+  bool     isRetired(uint64_t frame);
+  bool     wait(uint64_t frame, GLuint64 timeout = GL_TIMEOUT_IGNORED);
+  void     finish();
+  void     onRetired(uint64_t frame, Callback const& callback);
+  uint64_t getCurrentFrame() const;
+  uint64_t getLastSubmittedFrame() const;
+  uint64_t getLastRetiredFrame() const;
+  size_t   getNofPendingFrames() const;
+  size_t   getNofCallbacks() const;
+
+ protected:
+  void                              retire(uint64_t frame);
+  FunctionTablePointer              table;
+  uint64_t                          submitted = 0;  ///< last ended frame
+  uint64_t                          retired   = 0;  ///< last retired frame
+  std::deque<std::unique_ptr<Sync>> fences;  ///< fences of unretired frames
+  std::multimap<uint64_t, Callback> callbacks;
+};
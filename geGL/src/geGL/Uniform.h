@@ -0,0 +1,152 @@
+#pragma once
+
+#include <geGL/OpenGLContext.h>
+#include <cstddef>
+
+namespace ge {
+namespace gl {
+/**
+ * @brief Is type of uniform sampler or image (they are set as int)
+ *
+ * @param type type of uniform (ProgramInfo::TYPE)
+ *
+ * @return true for sampler and image types
+ */
+inline bool isOpaqueUniformType(GLenum type)
+{
+  return (type >= GL_SAMPLER_1D && type <= GL_SAMPLER_2D_RECT_SHADOW) ||
+         (type >= GL_SAMPLER_1D_ARRAY && type <= GL_SAMPLER_CUBE_SHADOW) ||
+         (type >= GL_INT_SAMPLER_1D &&
+          type <= GL_UNSIGNED_INT_SAMPLER_BUFFER) ||
+         (type >= GL_SAMPLER_CUBE_MAP_ARRAY &&
+          type <= GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY) ||
+         (type >= GL_SAMPLER_2D_MULTISAMPLE &&
+          type <= GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY) ||
+         (type >= GL_IMAGE_1D &&
+          type <= GL_UNSIGNED_INT_IMAGE_2D_MULTISAMPLE_ARRAY);
+}
+
+/**
+ * @brief Compile time description of uniform type.
+ * Component is C++ type of one component, nofComponents is number of
+ * components of one element, upload() calls glProgramUniform*v.
+ * Only types listed below can be used, other types do not compile.
+ *
+ * @tparam TYPE GLSL type of uniform (GL_FLOAT_VEC4, GL_FLOAT_MAT4, ...)
+ */
+template <GLenum TYPE>
+struct UniformType;
+
+#define GEGL_UNIFORM_TYPE(TYPE, COMPONENT, COMPONENTS, FCE, ACCEPTS)    \
+  template <>                                                            \
+  struct UniformType<TYPE> {                                             \
+    using Component = COMPONENT;                                         \
+    static size_t const nofComponents = COMPONENTS;                      \
+    static bool const   matrix        = false;                           \
+    static bool         accepts(GLenum type) { return ACCEPTS; }         \
+    static void         upload(Context const&   gl,                      \
+                               GLuint           program,                 \
+                               GLint            location,                \
+                               GLsizei          count,                   \
+                               GLboolean        transpose,               \
+                               Component const* values)                  \
+    {                                                                    \
+      (void)transpose;                                                   \
+      gl.FCE(program, location, count, values);                          \
+    }                                                                    \
+  }
+
+#define GEGL_UNIFORM_MATRIX_TYPE(TYPE, COMPONENT, COMPONENTS, FCE)      \
+  template <>                                                            \
+  struct UniformType<TYPE> {                                             \
+    using Component = COMPONENT;                                         \
+    static size_t const nofComponents = COMPONENTS;                      \
+    static bool const   matrix        = true;                            \
+    static bool         accepts(GLenum type) { return type == TYPE; }    \
+    static void         upload(Context const&   gl,                      \
+                               GLuint           program,                 \
+                               GLint            location,                \
+                               GLsizei          count,                   \
+                               GLboolean        transpose,               \
+                               Component const* values)                  \
+    {                                                                    \
+      gl.FCE(program, location, count, transpose, values);               \
+    }                                                                    \
+  }
+
+// clang-format off
+GEGL_UNIFORM_TYPE(GL_FLOAT            ,GLfloat ,1,glProgramUniform1fv ,type == GL_FLOAT                                                  );
+GEGL_UNIFORM_TYPE(GL_FLOAT_VEC2       ,GLfloat ,2,glProgramUniform2fv ,type == GL_FLOAT_VEC2                                             );
+GEGL_UNIFORM_TYPE(GL_FLOAT_VEC3       ,GLfloat ,3,glProgramUniform3fv ,type == GL_FLOAT_VEC3                                             );
+GEGL_UNIFORM_TYPE(GL_FLOAT_VEC4       ,GLfloat ,4,glProgramUniform4fv ,type == GL_FLOAT_VEC4                                             );
+GEGL_UNIFORM_TYPE(GL_DOUBLE           ,GLdouble,1,glProgramUniform1dv ,type == GL_DOUBLE                                                 );
+GEGL_UNIFORM_TYPE(GL_DOUBLE_VEC2      ,GLdouble,2,glProgramUniform2dv ,type == GL_DOUBLE_VEC2                                            );
+GEGL_UNIFORM_TYPE(GL_DOUBLE_VEC3      ,GLdouble,3,glProgramUniform3dv ,type == GL_DOUBLE_VEC3                                            );
+GEGL_UNIFORM_TYPE(GL_DOUBLE_VEC4      ,GLdouble,4,glProgramUniform4dv ,type == GL_DOUBLE_VEC4                                            );
+GEGL_UNIFORM_TYPE(GL_INT              ,GLint   ,1,glProgramUniform1iv ,type == GL_INT      || type == GL_BOOL || isOpaqueUniformType(type));
+GEGL_UNIFORM_TYPE(GL_INT_VEC2         ,GLint   ,2,glProgramUniform2iv ,type == GL_INT_VEC2 || type == GL_BOOL_VEC2                       );
+GEGL_UNIFORM_TYPE(GL_INT_VEC3         ,GLint   ,3,glProgramUniform3iv ,type == GL_INT_VEC3 || type == GL_BOOL_VEC3                       );
+GEGL_UNIFORM_TYPE(GL_INT_VEC4         ,GLint   ,4,glProgramUniform4iv ,type == GL_INT_VEC4 || type == GL_BOOL_VEC4                       );
+GEGL_UNIFORM_TYPE(GL_UNSIGNED_INT     ,GLuint  ,1,glProgramUniform1uiv,type == GL_UNSIGNED_INT                                           );
+GEGL_UNIFORM_TYPE(GL_UNSIGNED_INT_VEC2,GLuint  ,2,glProgramUniform2uiv,type == GL_UNSIGNED_INT_VEC2                                      );
+GEGL_UNIFORM_TYPE(GL_UNSIGNED_INT_VEC3,GLuint  ,3,glProgramUniform3uiv,type == GL_UNSIGNED_INT_VEC3                                      );
+GEGL_UNIFORM_TYPE(GL_UNSIGNED_INT_VEC4,GLuint  ,4,glProgramUniform4uiv,type == GL_UNSIGNED_INT_VEC4                                      );
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT2   ,GLfloat , 4,glProgramUniformMatrix2fv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT3   ,GLfloat , 9,glProgramUniformMatrix3fv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT4   ,GLfloat ,16,glProgramUniformMatrix4fv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT2x3 ,GLfloat , 6,glProgramUniformMatrix2x3fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT2x4 ,GLfloat , 8,glProgramUniformMatrix2x4fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT3x2 ,GLfloat , 6,glProgramUniformMatrix3x2fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT3x4 ,GLfloat ,12,glProgramUniformMatrix3x4fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT4x2 ,GLfloat , 8,glProgramUniformMatrix4x2fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_FLOAT_MAT4x3 ,GLfloat ,12,glProgramUniformMatrix4x3fv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT2  ,GLdouble, 4,glProgramUniformMatrix2dv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT3  ,GLdouble, 9,glProgramUniformMatrix3dv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT4  ,GLdouble,16,glProgramUniformMatrix4dv  );
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT2x3,GLdouble, 6,glProgramUniformMatrix2x3dv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT2x4,GLdouble, 8,glProgramUniformMatrix2x4dv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT3x2,GLdouble, 6,glProgramUniformMatrix3x2dv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT3x4,GLdouble,12,glProgramUniformMatrix3x4dv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT4x2,GLdouble, 8,glProgramUniformMatrix4x2dv);
+GEGL_UNIFORM_MATRIX_TYPE(GL_DOUBLE_MAT4x3,GLdouble,12,glProgramUniformMatrix4x3dv);
+// clang-format on
+
+#undef GEGL_UNIFORM_TYPE
+#undef GEGL_UNIFORM_MATRIX_TYPE
+
+/**
+ * @brief Typed handle of uniform variable returned by Program::getUniform.
+ * It is location and array size, type is checked when handle is created,
+ * so setting it does not look up names.
+ * Handle with location -1 (uniform is not active) is ignored by set.
+ *
+ * @code
+ * auto const color = program->getUniform<GL_FLOAT_VEC4>("color");
+ * auto const mvp   = program->getUniform<GL_FLOAT_MAT4>("mvp");
+ * program->set(color,1.f,0.f,0.f,1.f);
+ * program->setv(mvp,matrix);
+ * @endcode
+ *
+ * @tparam TYPE GLSL type of uniform
+ */
+template <GLenum TYPE>
+class Uniform {
+ public:
+  using Type      = UniformType<TYPE>;
+  using Component = typename Type::Component;
+  static GLenum const type = TYPE;
+  Uniform() = default;
+  Uniform(GLint location, GLint size) : location(location), size(size) {}
+  GLint getLocation() const { return location; }
+  GLint getSize() const { return size; }
+  bool  isValid() const { return location >= 0; }
+
+ protected:
+  GLint location = -1;
+  GLint size     = 0;  ///< number of array elements
+};
+
+template <GLenum TYPE>
+GLenum const Uniform<TYPE>::type;
+}  // namespace gl
+}  // namespace ge
@@ -0,0 +1,353 @@
+#include <geGL/UniformBlockBuilder.h>
+#include <geGL/Buffer.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+namespace {
+/**
+ * @brief Shape of GLSL type, matrices have more than one column
+ */
+struct TypeInfo {
+  GLenum component = GL_NONE;
+  GLint  columns   = 0;
+  GLint  rows      = 0;
+};
+
+TypeInfo getTypeInfo(GLenum type)
+{
+  // clang-format off
+  switch (type) {
+    case GL_FLOAT            :return {GL_FLOAT       ,1,1};
+    case GL_FLOAT_VEC2       :return {GL_FLOAT       ,1,2};
+    case GL_FLOAT_VEC3       :return {GL_FLOAT       ,1,3};
+    case GL_FLOAT_VEC4       :return {GL_FLOAT       ,1,4};
+    case GL_DOUBLE           :return {GL_DOUBLE      ,1,1};
+    case GL_DOUBLE_VEC2      :return {GL_DOUBLE      ,1,2};
+    case GL_DOUBLE_VEC3      :return {GL_DOUBLE      ,1,3};
+    case GL_DOUBLE_VEC4      :return {GL_DOUBLE      ,1,4};
+    case GL_INT              :return {GL_INT         ,1,1};
+    case GL_INT_VEC2         :return {GL_INT         ,1,2};
+    case GL_INT_VEC3         :return {GL_INT         ,1,3};
+    case GL_INT_VEC4         :return {GL_INT         ,1,4};
+    case GL_UNSIGNED_INT     :return {GL_UNSIGNED_INT,1,1};
+    case GL_UNSIGNED_INT_VEC2:return {GL_UNSIGNED_INT,1,2};
+    case GL_UNSIGNED_INT_VEC3:return {GL_UNSIGNED_INT,1,3};
+    case GL_UNSIGNED_INT_VEC4:return {GL_UNSIGNED_INT,1,4};
+    case GL_BOOL             :return {GL_BOOL        ,1,1};
+    case GL_BOOL_VEC2        :return {GL_BOOL        ,1,2};
+    case GL_BOOL_VEC3        :return {GL_BOOL        ,1,3};
+    case GL_BOOL_VEC4        :return {GL_BOOL        ,1,4};
+    case GL_FLOAT_MAT2       :return {GL_FLOAT       ,2,2};
+    case GL_FLOAT_MAT2x3     :return {GL_FLOAT       ,2,3};
+    case GL_FLOAT_MAT2x4     :return {GL_FLOAT       ,2,4};
+    case GL_FLOAT_MAT3       :return {GL_FLOAT       ,3,3};
+    case GL_FLOAT_MAT3x2     :return {GL_FLOAT       ,3,2};
+    case GL_FLOAT_MAT3x4     :return {GL_FLOAT       ,3,4};
+    case GL_FLOAT_MAT4       :return {GL_FLOAT       ,4,4};
+    case GL_FLOAT_MAT4x2     :return {GL_FLOAT       ,4,2};
+    case GL_FLOAT_MAT4x3     :return {GL_FLOAT       ,4,3};
+    case GL_DOUBLE_MAT2      :return {GL_DOUBLE      ,2,2};
+    case GL_DOUBLE_MAT2x3    :return {GL_DOUBLE      ,2,3};
+    case GL_DOUBLE_MAT2x4    :return {GL_DOUBLE      ,2,4};
+    case GL_DOUBLE_MAT3      :return {GL_DOUBLE      ,3,3};
+    case GL_DOUBLE_MAT3x2    :return {GL_DOUBLE      ,3,2};
+    case GL_DOUBLE_MAT3x4    :return {GL_DOUBLE      ,3,4};
+    case GL_DOUBLE_MAT4      :return {GL_DOUBLE      ,4,4};
+    case GL_DOUBLE_MAT4x2    :return {GL_DOUBLE      ,4,2};
+    case GL_DOUBLE_MAT4x3    :return {GL_DOUBLE      ,4,3};
+    default                  :return {};
+  }
+  // clang-format on
+}
+
+size_t getComponentSize(GLenum component)
+{
+  return component == GL_DOUBLE ? sizeof(GLdouble) : sizeof(GLint);
+}
+
+GLint roundUp(GLint value, GLint alignment)
+{
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief std140 base alignment of vector (rules 1-3)
+ */
+GLint getVectorAlignment(GLint nofComponents, GLint componentSize)
+{
+  if (nofComponents == 1) return componentSize;
+  if (nofComponents == 2) return 2 * componentSize;
+  return 4 * componentSize;
+}
+
+GLint const vec4Alignment = 16;
+}  // namespace
+
+/**
+ * @brief Constructor that uses default context
+ *
+ * @param block reflected uniform block (ProgramInfo::uniformBlocks)
+ */
+UniformBlockBuilder::UniformBlockBuilder(Block const& block)
+    : UniformBlockBuilder(nullptr, block)
+{
+}
+
+/**
+ * @brief Constructor, it allocates CPU copy and buffer of block size
+ *
+ * @param table opengl function table
+ * @param block reflected uniform block (ProgramInfo::uniformBlocks)
+ */
+UniformBlockBuilder::UniformBlockBuilder(FunctionTablePointer const& table,
+                                         Block const&                block)
+    : block(block),
+      binding(std::get<ProgramInfo::UNIFORM_BLOCK_BINDING>(block)),
+      data(std::get<ProgramInfo::UNIFORM_BLOCK_DATA_SIZE>(block))
+{
+  buffer = std::make_shared<Buffer>(table, static_cast<GLsizeiptr>(data.size()),
+                                    nullptr, GL_DYNAMIC_DRAW);
+}
+
+/**
+ * @brief Constructor that uses block of program and context of program
+ *
+ * @param program linked program
+ * @param blockName name of uniform block
+ */
+UniformBlockBuilder::UniformBlockBuilder(Program const&     program,
+                                         std::string const& blockName)
+    : UniformBlockBuilder(program.getContext().getFunctionTable(), [&]() {
+        auto const& blocks = program.getInfo()->uniformBlocks;
+        auto const  it     = blocks.find(blockName);
+        if (it == blocks.end())
+          throw std::invalid_argument(
+              "geGL: UniformBlockBuilder::UniformBlockBuilder - there is no "
+              "such uniform block: " +
+              blockName);
+        return it->second;
+      }())
+{
+}
+
+/**
+ * @brief Has block member of this name
+ *
+ * @param name name of member with or without block name prefix
+ *
+ * @return true if member exists
+ */
+bool UniformBlockBuilder::has(std::string const& name) const
+{
+  assert(this != nullptr);
+  size_t element;
+  return findMember(name, element) != nullptr;
+}
+
+/**
+ * @brief Uploads CPU copy by one Buffer::setData if it was written and binds
+ * buffer to GL_UNIFORM_BUFFER binding point of block
+ */
+void UniformBlockBuilder::upload()
+{
+  assert(this != nullptr);
+  if (dirty && !data.empty()) {
+    buffer->setData(data.data(), static_cast<GLsizeiptr>(data.size()));
+    statistics.uploads++;
+  }
+  dirty = false;
+  buffer->bindRange(GL_UNIFORM_BUFFER, binding, 0,
+                    static_cast<GLsizeiptr>(data.size()));
+  statistics.binds++;
+}
+
+/**
+ * @brief Sets binding point used by upload(), program block binding is not
+ * changed (glUniformBlockBinding)
+ *
+ * @param binding index of GL_UNIFORM_BUFFER binding point
+ */
+void UniformBlockBuilder::setBinding(GLuint binding)
+{
+  assert(this != nullptr);
+  this->binding = binding;
+}
+
+GLuint UniformBlockBuilder::getBinding() const
+{
+  assert(this != nullptr);
+  return binding;
+}
+
+size_t UniformBlockBuilder::getSize() const
+{
+  assert(this != nullptr);
+  return data.size();
+}
+
+std::vector<uint8_t> const& UniformBlockBuilder::getData() const
+{
+  assert(this != nullptr);
+  return data;
+}
+
+std::shared_ptr<Buffer> const& UniformBlockBuilder::getBuffer() const
+{
+  assert(this != nullptr);
+  return buffer;
+}
+
+UniformBlockBuilder::Block const& UniformBlockBuilder::getBlock() const
+{
+  assert(this != nullptr);
+  return block;
+}
+
+UniformBlockBuilder::Statistics const& UniformBlockBuilder::getStatistics()
+    const
+{
+  assert(this != nullptr);
+  return statistics;
+}
+
+/**
+ * @brief Computes std140 layout of uniform block (OpenGL 4.6 spec, section
+ * 7.6.2.2), it is used by blocks declared with layout(std140).
+ * Structures are not supported, members are basic types and their arrays.
+ * Row major layout is reported only for matrices, like GL_IS_ROW_MAJOR.
+ *
+ * @param name name of block
+ * @param members members in order of declaration
+ * @param binding binding point of block
+ *
+ * @return block with offsets, array strides, matrix strides and data size
+ */
+UniformBlockBuilder::Block UniformBlockBuilder::computeStd140Layout(
+    std::string const&              name,
+    std::vector<Declaration> const& members,
+    GLint                           binding)
+{
+  std::map<std::string, Member> result;
+  GLint                         offset       = 0;
+  GLint                         maxAlignment = vec4Alignment;
+  for (auto const& m : members) {
+    auto const info = getTypeInfo(m.type);
+    if (info.component == GL_NONE)
+      throw std::invalid_argument(
+          "geGL: UniformBlockBuilder::computeStd140Layout - unsupported type "
+          "of member: " +
+          m.name);
+    auto const componentSize = static_cast<GLint>(getComponentSize(info.component));
+    bool const isArray       = m.size > 0;
+    GLint      alignment;
+    GLint      elementSize;
+    GLint      matrixStride = 0;
+    if (info.columns > 1) {
+      // rules 5-8: matrix is array of column (or row) vectors
+      GLint const nofVectors = m.rowMajor ? info.rows : info.columns;
+      GLint const vectorSize = m.rowMajor ? info.columns : info.rows;
+      matrixStride = roundUp(getVectorAlignment(vectorSize, componentSize),
+                             vec4Alignment);
+      alignment    = matrixStride;
+      elementSize  = nofVectors * matrixStride;
+    } else {
+      alignment   = getVectorAlignment(info.rows, componentSize);
+      elementSize = info.rows * componentSize;
+      if (isArray) {
+        // rule 4: array elements are aligned to vec4
+        alignment   = roundUp(alignment, vec4Alignment);
+        elementSize = roundUp(elementSize, alignment);
+      }
+    }
+    offset = roundUp(offset, alignment);
+    maxAlignment = std::max(maxAlignment, alignment);
+    GLint const arrayStride = isArray ? elementSize : 0;
+    result[m.name] = Member(m.name, m.type, std::max(m.size, 1), offset,
+                            arrayStride, matrixStride,
+                            info.columns > 1 && m.rowMajor ? 1 : 0);
+    offset += isArray ? m.size * arrayStride : elementSize;
+  }
+  // rule 9: block is structure, its size is multiple of its alignment
+  return Block(name, binding, roundUp(offset, maxAlignment), result);
+}
+
+UniformBlockBuilder::Member const* UniformBlockBuilder::findMember(
+    std::string const& name,
+    size_t&            element) const
+{
+  element                = 0;
+  std::string memberName = name;
+  auto const  bracket    = name.rfind('[');
+  if (bracket != std::string::npos && name.back() == ']') {
+    memberName = name.substr(0, bracket);
+    element    = std::stoul(name.substr(bracket + 1));
+  }
+  auto const& members = std::get<ProgramInfo::UNIFORM_BLOCK_MEMBERS>(block);
+  auto        it      = members.find(memberName);
+  if (it == members.end())
+    it = members.find(std::get<ProgramInfo::UNIFORM_BLOCK_NAME>(block) + "." +
+                      memberName);
+  if (it == members.end()) return nullptr;
+  return &it->second;
+}
+
+void UniformBlockBuilder::write(std::string const& name,
+                                void const*        values,
+                                GLenum             componentType,
+                                size_t             nofComponents,
+                                GLsizei            count)
+{
+  assert(this != nullptr);
+  size_t      element;
+  auto const  member = findMember(name, element);
+  std::string error;
+  if (!member) {
+    if (!Program::isNonexistingUniformWarningEnabled()) return;
+    throw std::invalid_argument(
+        "geGL: UniformBlockBuilder::set - there is no such member: " + name);
+  }
+  auto const info = getTypeInfo(std::get<ProgramInfo::MEMBER_TYPE>(*member));
+  bool const sameComponent =
+      info.component == componentType ||
+      (info.component == GL_BOOL &&
+       (componentType == GL_INT || componentType == GL_UNSIGNED_INT));
+  size_t const elementComponents = static_cast<size_t>(info.columns * info.rows);
+  auto const   size = static_cast<size_t>(std::get<ProgramInfo::MEMBER_SIZE>(*member));
+  if (!sameComponent)
+    error = "type of values does not match type of member: ";
+  else if (nofComponents != 0 && nofComponents != elementComponents)
+    error = "number of values does not match type of member: ";
+  else if (count < 0 || element + static_cast<size_t>(count) > size)
+    error = "array elements are out of range: ";
+  if (!error.empty())
+    throw std::invalid_argument("geGL: UniformBlockBuilder::set - " + error +
+                                name);
+
+  auto const componentSize = getComponentSize(info.component);
+  auto const arrayStride   = static_cast<size_t>(std::get<ProgramInfo::MEMBER_ARRAY_STRIDE>(*member));
+  auto const matrixStride  = static_cast<size_t>(std::get<ProgramInfo::MEMBER_MATRIX_STRIDE>(*member));
+  bool const rowMajor      = std::get<ProgramInfo::MEMBER_ROW_MAJOR>(*member) != 0;
+  auto const offset        = static_cast<size_t>(std::get<ProgramInfo::MEMBER_OFFSET>(*member));
+  auto       src           = static_cast<uint8_t const*>(values);
+  for (size_t e = element; e < element + static_cast<size_t>(count); ++e) {
+    auto const dst = data.data() + offset + e * arrayStride;
+    for (GLint c = 0; c < info.columns; ++c) {
+      if (!rowMajor) {
+        std::memcpy(dst + c * matrixStride, src, info.rows * componentSize);
+        src += info.rows * componentSize;
+        continue;
+      }
+      for (GLint r = 0; r < info.rows; ++r) {
+        std::memcpy(dst + r * matrixStride + c * componentSize, src,
+                    componentSize);
+        src += componentSize;
+      }
+    }
+  }
+  dirty = true;
+  statistics.writes++;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <geGL/Program.h>
+#include <geGL/ProgramInfo.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief CPU staging copy of uniform block.
+ *
+ * Members are written by name into CPU memory using layout reflected from
+ * program (ProgramInfo::uniformBlocks - offsets, array strides, matrix
+ * strides), upload() sends the whole block by one Buffer::setData (only if
+ * something was written) and binds it by bindRange to GL_UNIFORM_BUFFER.
+ * Member names can be given with or without block name prefix
+ * ("Material.color" or "color"), array elements as "lights[2]".
+ * Matrices are passed column-major, row_major members are transposed.
+ *
+ * computeStd140Layout() computes std140 layout of block without OpenGL.
+ *
+ * @code
+ * UniformBlockBuilder material(*program,"Material");
+ * material.set("roughness",.5f);
+ * material.set("color",1.f,0.f,0.f,1.f);
+ * material.setv("model",modelMatrix);
+ * material.upload();
+ * @endcode
+ */
+class GEGL_EXPORT ge::gl::UniformBlockBuilder {
+ public:
+  using Block  = ProgramInfo::UniformBlockProperties;
+  using Member = ProgramInfo::UniformBlockMemberProperties;
+  /**
+   * @brief Member declaration for computeStd140Layout
+   */
+  struct Declaration {
+    std::string name;
+    GLenum      type     = GL_FLOAT;
+    GLint       size     = 0;  ///< number of array elements, 0 - not an array
+    bool        rowMajor = false;
+  };
+  /**
+   * @brief Builder statistics
+   */
+  struct Statistics {
+    size_t writes  = 0;  ///< set/setv calls
+    size_t uploads = 0;  ///< Buffer::setData calls
+    size_t binds   = 0;  ///< Buffer::bindRange calls
+  };
+  UniformBlockBuilder(Block const& block);
+  UniformBlockBuilder(FunctionTablePointer const& table, Block const& block);
+  UniformBlockBuilder(Program const& program, std::string const& blockName);
+  template <typename T, typename... ARGS>
+  UniformBlockBuilder& set(std::string const& name,
+                           T const&           value,
+                           ARGS const&... values);
+  template <typename T>
+  UniformBlockBuilder& setv(std::string const& name,
+                            T const*           values,
+                            GLsizei            count = 1);
+  bool                           has(std::string const& name) const;
+  void                           upload();
+  void                           setBinding(GLuint binding);
+  GLuint                         getBinding() const;
+  size_t                         getSize() const;
+  std::vector<uint8_t> const&    getData() const;
+  std::shared_ptr<Buffer> const& getBuffer() const;
+  Block const&                   getBlock() const;
+  Statistics const&              getStatistics() const;
+
+  static Block computeStd140Layout(std::string const&              name,
+                                   std::vector<Declaration> const& members,
+                                   GLint                           binding = 0);
+
+ protected:
+  template <typename T>
+  struct ComponentType;
+  Member const* findMember(std::string const& name, size_t& element) const;
+  void          write(std::string const& name,
+                      void const*        values,
+                      GLenum             componentType,
+                      size_t             nofComponents,
+                      GLsizei            count);
+  Block                   block;
+  GLuint                  binding;
+  std::vector<uint8_t>    data;
+  bool                    dirty = true;  ///< data are not uploaded
+  std::shared_ptr<Buffer> buffer;
+  Statistics              statistics;
+};
+
+// clang-format off
+template <> struct ge::gl::UniformBlockBuilder::ComponentType<GLfloat >{ static GLenum const value = GL_FLOAT       ; };
+template <> struct ge::gl::UniformBlockBuilder::ComponentType<GLdouble>{ static GLenum const value = GL_DOUBLE      ; };
+template <> struct ge::gl::UniformBlockBuilder::ComponentType<GLint   >{ static GLenum const value = GL_INT         ; };
+template <> struct ge::gl::UniformBlockBuilder::ComponentType<GLuint  >{ static GLenum const value = GL_UNSIGNED_INT; };
+// clang-format on
+
+/**
+ * @brief Writes one element of member, number of values has to match type of
+ * member (e.g. 4 floats for vec4)
+ *
+ * @param name name of member, it can contain index of array element
+ * @param value first component
+ * @param values other components, they have to have the same type
+ *
+ * @return this
+ */
+template <typename T, typename... ARGS>
+ge::gl::UniformBlockBuilder& ge::gl::UniformBlockBuilder::set(
+    std::string const& name,
+    T const&           value,
+    ARGS const&... values)
+{
+  T const components[] = {value, values...};
+  write(name, components, ComponentType<T>::value, 1 + sizeof...(ARGS), 1);
+  return *this;
+}
+
+/**
+ * @brief Writes count consecutive array elements of member
+ *
+ * @param name name of member, it can contain index of first array element
+ * @param values count * number of components of member type
+ * @param count number of array elements
+ *
+ * @return this
+ */
+template <typename T>
+ge::gl::UniformBlockBuilder& ge::gl::UniformBlockBuilder::setv(
+    std::string const& name,
+    T const*           values,
+    GLsizei            count)
+{
+  write(name, values, ComponentType<T>::value, 0, count);
+  return *this;
+}
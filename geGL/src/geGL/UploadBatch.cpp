@@ -0,0 +1,305 @@
+#include <geGL/UploadBatch.h>
+#include <geGL/BindingTrackerInterface.h>
+#include <geGL/OpenGLUtil.h>
+#include <geGL/Texture.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+using namespace ge::gl;
+
+namespace {
+GLbitfield const storageFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param stagingSize size of one staging region in bytes
+ * @param nofRegions number of staging regions (batches that can be in flight)
+ */
+UploadBatch::UploadBatch(GLsizeiptr stagingSize, size_t nofRegions)
+    : UploadBatch(nullptr, stagingSize, nofRegions)
+{
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param table opengl function table
+ * @param stagingSize size of one staging region in bytes
+ * @param nofRegions number of staging regions (batches that can be in flight)
+ */
+UploadBatch::UploadBatch(FunctionTablePointer const &table,
+                         GLsizeiptr                  stagingSize,
+                         size_t                      nofRegions)
+    : fences(nofRegions), regionSize(stagingSize)
+{
+  if (stagingSize <= 0 || nofRegions == 0)
+    throw std::invalid_argument(
+        "geGL: UploadBatch - staging size and number of regions have to be "
+        "positive");
+  auto const size = stagingSize * static_cast<GLsizeiptr>(nofRegions);
+  staging  = std::make_shared<Buffer>(table, size, nullptr, storageFlags);
+  bindings = getBindingTracker(staging->getContext().getFunctionTable());
+  mapping  = static_cast<uint8_t *>(staging->map(0, size, storageFlags));
+  if (!mapping)
+    throw std::runtime_error("geGL: UploadBatch - persistent mapping failed");
+}
+
+/**
+ * @brief Destructor, it flushes pending writes and unmaps staging buffer
+ */
+UploadBatch::~UploadBatch()
+{
+  flush();
+  staging->unmap();
+}
+
+/**
+ * @brief Stages write into buffer
+ *
+ * @param buffer destination buffer
+ * @param data data
+ * @param size size of data in bytes
+ * @param offset offset into destination buffer
+ */
+void UploadBatch::setData(Buffer *      buffer,
+                          GLvoid const *data,
+                          GLsizeiptr    size,
+                          GLintptr      offset)
+{
+  assert(this != nullptr);
+  if (!buffer)
+    throw std::invalid_argument("geGL: UploadBatch::setData - buffer is nullptr");
+  if (size <= 0 || !data) return;
+  statistics.writes++;
+  if (size > getStagingSize()) {
+    flush();
+    buffer->setData(data, size, offset);
+    statistics.directUploads++;
+    return;
+  }
+  auto const stagingOffset = stage(data, size, 1);
+  if (!bufferWrites.empty()) {
+    auto &last = bufferWrites.back();
+    if (last.buffer == buffer && last.offset + last.size == offset &&
+        last.stagingOffset + last.size == stagingOffset) {
+      last.size += size;
+      statistics.merges++;
+      return;
+    }
+  }
+  BufferWrite w;
+  w.buffer        = buffer;
+  w.offset        = offset;
+  w.stagingOffset = stagingOffset;
+  w.size          = size;
+  bufferWrites.push_back(w);
+}
+
+/**
+ * @brief Stages texture sub-image, data are tightly packed (alignment 1).
+ * height == 0 means 1D image, depth == 0 means 2D image.
+ *
+ * @param texture destination texture
+ * @param data pixels
+ * @param format format of pixels
+ * @param type type of pixels
+ * @param level mipmap level
+ * @param xoffset x offset of sub-image
+ * @param yoffset y offset of sub-image
+ * @param zoffset z offset of sub-image
+ * @param width width of sub-image
+ * @param height height of sub-image
+ * @param depth depth of sub-image
+ */
+void UploadBatch::setTextureData(Texture const *texture,
+                                 GLvoid const * data,
+                                 GLenum         format,
+                                 GLenum         type,
+                                 GLint          level,
+                                 GLint          xoffset,
+                                 GLint          yoffset,
+                                 GLint          zoffset,
+                                 GLsizei        width,
+                                 GLsizei        height,
+                                 GLsizei        depth)
+{
+  assert(this != nullptr);
+  if (!texture)
+    throw std::invalid_argument(
+        "geGL: UploadBatch::setTextureData - texture is nullptr");
+  if (!data || width <= 0) return;
+  TextureWrite w;
+  w.texture = texture;
+  w.format  = format;
+  w.type    = type;
+  w.level   = level;
+  w.xoffset = xoffset;
+  w.yoffset = yoffset;
+  w.zoffset = zoffset;
+  w.width   = width;
+  w.height  = height;
+  w.depth   = depth;
+  statistics.writes++;
+  auto const size = static_cast<GLsizeiptr>(getImageSize(
+      format, type, width, std::max(height, 1), std::max(depth, 1), 1));
+  if (size > getStagingSize()) {
+    flush();
+    uploadTexture(w, data);
+    statistics.directUploads++;
+    return;
+  }
+  auto const pixelSize = static_cast<GLsizeiptr>(getPixelSize(format, type));
+  w.stagingOffset      = stage(data, size, std::max(pixelSize, GLsizeiptr(4)));
+  textureWrites.push_back(w);
+}
+
+/**
+ * @brief Submits pending writes
+ */
+void UploadBatch::flush()
+{
+  assert(this != nullptr);
+  if (!acquired) return;
+
+  auto const &gl = staging->getContext();
+  for (auto const &w : bufferWrites)
+    gl.glCopyNamedBufferSubData(staging->getId(), w.buffer->getId(),
+                                w.stagingOffset, w.offset, w.size);
+  statistics.copiesIssued += bufferWrites.size();
+
+  if (!textureWrites.empty()) {
+    GLint oldBinding = 0;
+    if (bindings)
+      oldBinding =
+          static_cast<GLint>(bindings->getBufferBinding(GL_PIXEL_UNPACK_BUFFER));
+    else
+      gl.glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &oldBinding);
+    staging->bind(GL_PIXEL_UNPACK_BUFFER);
+    for (auto const &w : textureWrites)
+      uploadTexture(w, reinterpret_cast<GLvoid const *>(w.stagingOffset));
+    gl.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, static_cast<GLuint>(oldBinding));
+    statistics.textureUploads += textureWrites.size();
+  }
+
+  fences[region] = std::unique_ptr<Sync>(new Sync(gl.getFunctionTable()));
+  region         = (region + 1) % fences.size();
+  acquired       = false;
+
+  bufferWrites.clear();
+  textureWrites.clear();
+  used = 0;
+  statistics.flushes++;
+}
+
+size_t UploadBatch::getNofPendingWrites() const
+{
+  return bufferWrites.size() + textureWrites.size();
+}
+
+/**
+ * @brief gets number of bytes staged since last flush
+ *
+ * @return staged bytes including alignment padding
+ */
+GLsizeiptr UploadBatch::getStagedSize() const { return used; }
+
+/**
+ * @brief gets size of one staging region
+ *
+ * @return maximal number of bytes of one batch
+ */
+GLsizeiptr UploadBatch::getStagingSize() const { return regionSize; }
+
+size_t UploadBatch::getNofRegions() const { return fences.size(); }
+
+UploadBatch::Statistics const &UploadBatch::getStatistics() const
+{
+  return statistics;
+}
+
+void UploadBatch::resetStatistics() { statistics = Statistics(); }
+
+/**
+ * @brief Copies data into current staging region, batch is flushed if they
+ * do not fit
+ *
+ * @param data data
+ * @param size size of data in bytes
+ * @param alignment alignment of staging offset
+ *
+ * @return offset of data in staging buffer
+ */
+GLintptr UploadBatch::stage(GLvoid const *data,
+                            GLsizeiptr    size,
+                            GLsizeiptr    alignment)
+{
+  auto offset = (used + alignment - 1) / alignment * alignment;
+  if (offset + size > getStagingSize()) {
+    flush();
+    offset = 0;
+  }
+  acquireRegion();
+  auto const stagingOffset =
+      static_cast<GLintptr>(region) * regionSize + offset;
+  std::memcpy(mapping + stagingOffset, data, static_cast<size_t>(size));
+  used = offset + size;
+  statistics.bytesStaged += size;
+  return stagingOffset;
+}
+
+/**
+ * @brief Waits until GPU stops reading current region.
+ * Region is polled first, if its fence is not signaled, the wait is counted
+ * as stall and CPU blocks until fence is signaled.
+ */
+void UploadBatch::acquireRegion()
+{
+  if (acquired) return;
+  auto &fence = fences[region];
+  if (fence) {
+    statistics.waits++;
+    if (!fence->isSignaled()) {
+      statistics.stalls++;
+      if (!fence->wait())
+        throw std::runtime_error(
+            "geGL: UploadBatch - waiting for staging region failed");
+    }
+    fence = nullptr;
+  }
+  acquired = true;
+}
+
+/**
+ * @brief Uploads texture sub-image, faces of cube map (zoffset, depth) are
+ * uploaded one by one, glTexSubImage3D does not accept GL_TEXTURE_CUBE_MAP
+ * before OpenGL 4.5.
+ *
+ * @param w sub-image
+ * @param data client pointer or offset into bound pixel unpack buffer
+ */
+void UploadBatch::uploadTexture(TextureWrite const &w, GLvoid const *data)
+{
+  if (w.height == 0)
+    w.texture->setData1D(data, w.format, w.type, w.level, w.xoffset, w.width);
+  else if (w.depth != 0 && w.texture->getTarget() == GL_TEXTURE_CUBE_MAP) {
+    auto const faceSize = static_cast<uintptr_t>(
+        getImageSize(w.format, w.type, w.width, w.height, 1, 1));
+    for (GLsizei f = 0; f < w.depth; ++f)
+      w.texture->setData2D(
+          reinterpret_cast<GLvoid const *>(reinterpret_cast<uintptr_t>(data) +
+                                           f * faceSize),
+          w.format, w.type, w.level,
+          GL_TEXTURE_CUBE_MAP_POSITIVE_X + w.zoffset + f, w.xoffset,
+          w.yoffset, w.width, w.height);
+  } else if (w.depth == 0)
+    w.texture->setData2D(data, w.format, w.type, w.level, 0, w.xoffset,
+                         w.yoffset, w.width, w.height);
+  else
+    w.texture->setData3D(data, w.format, w.type, w.level, 0, w.xoffset,
+                         w.yoffset, w.zoffset, w.width, w.height, w.depth);
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <geGL/Buffer.h>
+#include <geGL/Sync.h>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Collects many small buffer and texture uploads into one staging
+ * buffer and submits them at once.
+ *
+ * Staging buffer is persistently mapped ring of regions, every batch is
+ * written into one region. Writes are copied into the region, flush() issues
+ * one glCopyNamedBufferSubData per destination range and places fence behind
+ * them. Region is reused after its fence is signaled, so CPU does not wait
+ * for GPU unless all regions are in flight. Writes that continue
+ * previous write of the same buffer (in destination and in staging memory)
+ * are merged into one copy. Texture sub-images are uploaded from the same
+ * staging memory bound to GL_PIXEL_UNPACK_BUFFER, the binding is restored
+ * using binding tracker of the function table.
+ * Writes that do not fit into staging region flush the batch, writes larger
+ * than staging region are uploaded directly.
+ * Destination objects have to live until flush, destructor flushes the batch.
+ */
+class GEGL_EXPORT ge::gl::UploadBatch {
+ public:
+  /**
+   * @brief Upload statistics
+   */
+  struct Statistics {
+    size_t     writes         = 0;  ///< number of setData calls
+    GLsizeiptr bytesStaged    = 0;  ///< bytes copied into staging buffer
+    size_t     copiesIssued   = 0;  ///< glCopyNamedBufferSubData calls
+    size_t     merges         = 0;  ///< writes merged into previous copy
+    size_t     textureUploads = 0;  ///< texture sub-images uploaded from staging
+    size_t     directUploads  = 0;  ///< writes larger than staging buffer
+    size_t     flushes        = 0;  ///< flushes that submitted some writes
+    size_t     waits          = 0;  ///< waits on fences of reused regions
+    size_t     stalls         = 0;  ///< waits whose fence was not signaled yet
+  };
+  UploadBatch(GLsizeiptr stagingSize = 4 * 1024 * 1024, size_t nofRegions = 3);
+  UploadBatch(FunctionTablePointer const& table,
+              GLsizeiptr                  stagingSize = 4 * 1024 * 1024,
+              size_t                      nofRegions  = 3);
+  ~UploadBatch();
+  UploadBatch(UploadBatch const&) = delete;
+  UploadBatch& operator=(UploadBatch const&) = delete;
+  void setData(Buffer*       buffer,
+               GLvoid const* data,
+               GLsizeiptr    size,
+               GLintptr      offset = 0);
+  void setTextureData(Texture const* texture,
+                      GLvoid const*  data,
+                      GLenum         format,
+                      GLenum         type,
+                      GLint          level,
+                      GLint          xoffset,
+                      GLint          yoffset,
+                      GLint          zoffset,
+                      GLsizei        width,
+                      GLsizei        height = 0,
+                      GLsizei        depth  = 0);
+  void flush();
+  size_t     getNofPendingWrites() const;
+  GLsizeiptr getStagedSize() const;
+  GLsizeiptr getStagingSize() const;
+  size_t     getNofRegions() const;
+  Statistics const& getStatistics() const;
+  void              resetStatistics();
+
+  template <typename T>
+  void setData(Buffer* buffer, std::vector<T> const& data, GLintptr offset = 0);
+
+ protected:
+  struct BufferWrite {
+    Buffer*    buffer;
+    GLintptr   offset;
+    GLintptr   stagingOffset;
+    GLsizeiptr size;
+  };
+  struct TextureWrite {
+    Texture const* texture;
+    GLintptr       stagingOffset;
+    GLenum         format;
+    GLenum         type;
+    GLint          level;
+    GLint          xoffset, yoffset, zoffset;
+    GLsizei        width, height, depth;
+  };
+  GLintptr stage(GLvoid const* data, GLsizeiptr size, GLsizeiptr alignment);
+  void     acquireRegion();
+  static void uploadTexture(TextureWrite const& w, GLvoid const* data);
+  std::shared_ptr<Buffer>            staging;
+  BindingTrackerInterface const*     bindings   = nullptr;
+  uint8_t*                           mapping    = nullptr;
+  std::vector<std::unique_ptr<Sync>> fences;              ///< one fence per region
+  GLsizeiptr                         regionSize = 0;
+  size_t                             region     = 0;      ///< current region
+  bool                               acquired   = false;  ///< current region can be written
+  GLsizeiptr                         used       = 0;
+  std::vector<BufferWrite>           bufferWrites;
+  std::vector<TextureWrite>          textureWrites;
+  Statistics                         statistics;
+};
+
+template <typename T>
+void ge::gl::UploadBatch::setData(Buffer*               buffer,
+                                  std::vector<T> const& data,
+                                  GLintptr              offset)
+{
+  setData(buffer, data.data(), data.size() * sizeof(T), offset);
+}
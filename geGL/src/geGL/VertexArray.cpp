@@ -1,4 +1,5 @@
 #include <geGL/Buffer.h>
+#include <geGL/BufferArena.h>
 #include <geGL/private/BufferImpl.h>
 #include <geGL/private/VertexArrayImpl.h>
 #include <geGL/OpenGLUtil.h>
@@ -108,6 +109,35 @@ void VertexArray::addAttrib(std::shared_ptr<Buffer> const& buffer,
             divisor, apt);
 }
 
+/**
+ * @brief Adds vertex attrib stored in range of shared buffer (BufferArena)
+ *
+ * @param suballocation range of buffer where a attrib is stored
+ * @param index         index of attrib layout(location=index)
+ * @param nofComponents number of components of attrib vec3 = 3
+ * @param type          type of attrib vec3 = float, ivec2 = int
+ * @param stride        distance between attribs
+ * @param offset        offset to the first attrib relative to suballocation
+ * @param normalized    should the attrib be normalized?
+ * @param divisor       rate of incrementation of attrib per instance, 0 = per
+ * VS invocation
+ * @param apt           NONE - glVertexAttribPointer, I -
+ * glVertexAttribIPointer, L - glVertexAttribLPointer
+ */
+void VertexArray::addAttrib(BufferSuballocation const& suballocation,
+                            GLuint                     index,
+                            GLint                      nofComponents,
+                            GLenum                     type,
+                            GLsizei                    stride,
+                            GLintptr                   offset,
+                            GLboolean                  normalized,
+                            GLuint                     divisor,
+                            AttribPointerType          apt)
+{
+  addAttrib(suballocation.buffer, index, nofComponents, type, stride,
+            suballocation.offset + offset, normalized, divisor, apt);
+}
+
 void VertexArray::addElementBuffer(Buffer* buffer)
 {
   assert(this != nullptr);
@@ -13,7 +13,7 @@ class ge::gl::VertexArray : public OpenGLObject {
   GEGL_EXPORT ~VertexArray();
   GEGL_EXPORT void addAttrib(Buffer*           buffer,
                              GLuint            index,
-                             GLint             nofComponentsa,
+                             GLint             nofComponents,
                              GLenum            type,
                              GLsizei           stride            = 0,
                              GLintptr          offset            = 0,
@@ -23,7 +23,7 @@ class ge::gl::VertexArray : public OpenGLObject {
   GEGL_EXPORT void addElementBuffer(Buffer* buffer);
   GEGL_EXPORT void addAttrib(std::shared_ptr<Buffer> const& buffer,
                              GLuint                         index,
-                             GLint                          nofComponentsa,
+                             GLint                          nofComponents,
                              GLenum                         type,
                              GLsizei                        stride = 0,
                              GLintptr                       offset = 0,
@@ -31,6 +31,15 @@ class ge::gl::VertexArray : public OpenGLObject {
                              GLuint            divisor             = 0,
                              AttribPointerType attribPointerType   = NONE);
   GEGL_EXPORT void addElementBuffer(std::shared_ptr<Buffer> const& buffer);
+  GEGL_EXPORT void addAttrib(BufferSuballocation const& suballocation,
+                             GLuint                     index,
+                             GLint                      nofComponents,
+                             GLenum                     type,
+                             GLsizei                    stride     = 0,
+                             GLintptr                   offset     = 0,
+                             GLboolean                  normalized = GL_FALSE,
+                             GLuint                     divisor    = 0,
+                             AttribPointerType attribPointerType   = NONE);
   GEGL_EXPORT void removeAttrib(GLuint index);
   GEGL_EXPORT void removeElementBuffer();
   GEGL_EXPORT void bind() const;
@@ -26,12 +26,27 @@
 
 #include<geGL/AsynchronousQuery.h>
 #include<geGL/Buffer.h>
+#include<geGL/StreamingBuffer.h>
+#include<geGL/DynamicBuffer.h>
+#include<geGL/BufferArena.h>
+#include<geGL/UploadBatch.h>
+#include<geGL/Sync.h>
+#include<geGL/Timeline.h>
+#include<geGL/AsyncReadback.h>
 #include<geGL/Framebuffer.h>
 #include<geGL/Shader.h>
 #include<geGL/Program.h>
+#include<geGL/Uniform.h>
+#include<geGL/ProgramBinaryCache.h>
+#include<geGL/ProgramCompiler.h>
+#include<geGL/UniformBlockBuilder.h>
 #include<geGL/VertexArray.h>
 #include<geGL/ProgramPipeline.h>
 #include<geGL/Texture.h>
+#include<geGL/TextureResidency.h>
+#include<geGL/TextureStreamer.h>
+#include<geGL/TextureUploader.h>
+#include<geGL/MipmapGenerator.h>
 #include<geGL/Sampler.h>
 #include<geGL/Renderbuffer.h>
 #include<geGL/DebugMessage.h>
@@ -3,6 +3,7 @@
 #include <geGL/Buffer.h>
 #include <geGL/OpenGLUtil.h>
 #include <geGL/VertexArray.h>
+#include <utility>
 
 using namespace ge::gl;
 using namespace std;
@@ -11,13 +12,70 @@ BufferImpl::BufferImpl(Buffer *b) : buffer(b) {}
 
 void BufferImpl::bufferData(GLsizeiptr    size,
                             GLvoid const *data,
-                            GLbitfield    flags) const
+                            GLbitfield    flags)
 {
   auto const &gl = buffer->getContext();
-  if (areBufferFlagsMutable(flags))
+  metadata       = Metadata();
+  metadata.size  = size;
+  if (areBufferFlagsMutable(flags)) {
     gl.glNamedBufferData(buffer->getId(), size, data, flags);
-  else
+    metadata.usage = flags;
+    metadata.storageFlags =
+        GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_DYNAMIC_STORAGE_BIT;
+  } else {
     gl.glNamedBufferStorage(buffer->getId(), size, data, flags);
+    metadata.usage        = GL_DYNAMIC_DRAW;
+    metadata.storageFlags = flags;
+    metadata.immutable    = GL_TRUE;
+  }
+}
+
+void BufferImpl::setMapping(GLvoid *   pointer,
+                            GLintptr   offset,
+                            GLsizeiptr size,
+                            GLbitfield access)
+{
+  if (!pointer) return;
+  metadata.mapped      = GL_TRUE;
+  metadata.mapPointer  = pointer;
+  metadata.mapOffset   = offset;
+  metadata.mapSize     = size;
+  metadata.accessFlags = access;
+}
+
+void BufferImpl::resetMapping()
+{
+  metadata.mapped      = GL_FALSE;
+  metadata.mapPointer  = nullptr;
+  metadata.mapOffset   = 0;
+  metadata.mapSize     = 0;
+  metadata.accessFlags = 0;
+}
+
+/**
+ * @brief Compares cached parameter with driver if driver verification is
+ * enabled (Buffer::setDriverVerification)
+ *
+ * @param name name of parameter
+ * @param pname parameter
+ * @param cached cached value
+ */
+void BufferImpl::verify(char const *name, GLenum pname, GLint64 cached) const
+{
+  if (!Buffer::isDriverVerificationEnabled()) return;
+  auto const driver = getBufferParameter64(pname);
+  if (driver == cached) return;
+  throw runtime_error("geGL: Buffer - cached " + string(name) + " (" +
+                      to_string(cached) + ") differs from driver (" +
+                      to_string(driver) + ")");
+}
+
+void BufferImpl::verifyPointer(GLvoid *cached) const
+{
+  if (!Buffer::isDriverVerificationEnabled()) return;
+  if (getBufferPointer(GL_BUFFER_MAP_POINTER) == cached) return;
+  throw runtime_error(
+      "geGL: Buffer - cached GL_BUFFER_MAP_POINTER differs from driver");
 }
 
 BufferImpl::~BufferImpl(){
@@ -45,7 +103,7 @@ void BufferImpl::updateVertexArrays()
       vao->addAttrib(me, attribIndex, vao->getAttribSize(attribIndex),
                      vao->getAttribType(attribIndex),
                      vao->getAttribStride(attribIndex),
-                     vao->getAttribRelativeOffset(attribIndex),
+                     vao->impl->getBindingOffset(attribIndex),
                      vao->isAttribNormalized(attribIndex),
                      vao->getAttribDivisor(attribIndex), type);
     }
@@ -111,19 +169,22 @@ void BufferImpl::resizeBuffer(GLsizeiptr size, GLbitfield flags)
 
 void BufferImpl::resizeBufferKeepData(GLsizeiptr size, GLbitfield flags)
 {
-  auto newBuffer = new Buffer(size, nullptr, flags);
+  auto newBuffer =
+      new Buffer(buffer->getContext().getFunctionTable(), size, nullptr, flags);
   assert(newBuffer != nullptr);
   newBuffer->copy(*buffer);
   auto swapId        = buffer->getId();
   buffer->getId()    = newBuffer->getId();
   newBuffer->getId() = swapId;
+  std::swap(metadata, newBuffer->impl->metadata);
   delete newBuffer;
   updateVertexArrays();
 }
 
 void BufferImpl::resizeBufferKeepDataKeepId(GLsizeiptr size, GLbitfield flags)
 {
-  Buffer *temp = new Buffer(size, nullptr, flags);
+  Buffer *temp =
+      new Buffer(buffer->getContext().getFunctionTable(), size, nullptr, flags);
   assert(temp != nullptr);
   temp->copy(*buffer);
   bufferData(size, nullptr, flags);
@@ -2,6 +2,7 @@
 
 #include <geGL/Buffer.h>
 #include <set>
+#include <string>
 
 class ge::gl::BufferImpl {
  public:
@@ -10,7 +11,12 @@ class ge::gl::BufferImpl {
   GLint   getBufferParameter(GLenum pname) const;
   GLint64 getBufferParameter64(GLenum pname) const;
   GLvoid* getBufferPointer(GLenum pname) const;
-  void bufferData(GLsizeiptr size, GLvoid const* data, GLbitfield flags) const;
+  void bufferData(GLsizeiptr size, GLvoid const* data, GLbitfield flags);
+  void setMapping(GLvoid* pointer, GLintptr offset, GLsizeiptr size,
+                  GLbitfield access);
+  void resetMapping();
+  void verify(char const* name, GLenum pname, GLint64 cached) const;
+  void verifyPointer(GLvoid* cached) const;
   void updateVertexArrays();
   void realloc(GLsizeiptr size, Buffer::ReallocFlags f);
   void resizeBuffer(GLsizeiptr size, GLbitfield flags);
@@ -18,6 +24,21 @@ class ge::gl::BufferImpl {
   void resizeBufferKeepDataKeepId(GLsizeiptr size, GLbitfield flags);
   void newBuffer(GLsizeiptr size, GLbitfield flags);
   void removeReferences();
+  /**
+   * @brief Client-side copy of buffer parameters, getters do not query driver
+   */
+  struct Metadata {
+    GLsizeiptr size         = 0;
+    GLenum     usage        = GL_STATIC_DRAW;
+    GLbitfield storageFlags = 0;
+    GLboolean  immutable    = GL_FALSE;
+    GLboolean  mapped       = GL_FALSE;
+    GLbitfield accessFlags  = 0;
+    GLintptr   mapOffset    = 0;
+    GLsizeiptr mapSize      = 0;
+    GLvoid*    mapPointer   = nullptr;
+  };
   Buffer*                buffer = nullptr;
   std::set<VertexArray*> vertexArrays;
+  Metadata               metadata;
 };
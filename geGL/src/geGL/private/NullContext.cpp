@@ -0,0 +1,2692 @@
+#include<geGL/private/NullContext.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLUtil.h>
+#include<algorithm>
+#include<cstring>
+#include<regex>
+#include<sstream>
+
+using namespace ge::gl;
+
+NullContext::VertexArray::VertexArray(){
+  for(GLuint i=0;i<MAX_VERTEX_ATTRIBS;++i)
+    attribs[i].binding = i;
+}
+
+NullContext::NullContext(){}
+
+NullContext::~NullContext(){
+  if(current() == this)current() = nullptr;
+}
+
+/**
+ * @brief returns context that is current in calling thread
+ *
+ * @return reference to thread local pointer to current context
+ */
+NullContext*&NullContext::current(){
+  static thread_local NullContext*context = nullptr;
+  return context;
+}
+
+/**
+ * @brief Records error, only the first one is kept until glGetError is called.
+ *
+ * @param e error
+ */
+void NullContext::setError(GLenum e){
+  if(error == GL_NO_ERROR)error = e;
+}
+
+NullContext::Buffer*NullContext::getBuffer(GLuint name){
+  auto const result = buffers.get(name);
+  if(!result)setError(GL_INVALID_OPERATION);
+  return result;
+}
+
+NullContext::Buffer*NullContext::getBoundBuffer(GLenum target){
+  GLuint name = 0;
+  if(target == GL_ELEMENT_ARRAY_BUFFER)
+    name = getVertexArray(vertexArrayBinding)->elementBuffer;
+  else{
+    auto const it = bufferBindings.find(target);
+    if(it != bufferBindings.end())name = it->second;
+  }
+  return getBuffer(name);
+}
+
+NullContext::Texture*NullContext::getTexture(GLuint name){
+  auto const result = textures.get(name);
+  if(!result)setError(GL_INVALID_OPERATION);
+  return result;
+}
+
+NullContext::Texture*NullContext::getBoundTexture(GLenum target){
+  if(target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+    target = GL_TEXTURE_CUBE_MAP;
+  auto const it = textureBindings.find(std::make_pair(activeTexture,target));
+  if(it == textureBindings.end()){
+    setError(GL_INVALID_OPERATION);
+    return nullptr;
+  }
+  return getTexture(it->second);
+}
+
+NullContext::VertexArray*NullContext::getVertexArray(GLuint name){
+  if(name == 0)return &defaultVertexArray;
+  auto const result = vertexArrays.get(name);
+  if(!result)setError(GL_INVALID_OPERATION);
+  return result;
+}
+
+NullContext::Program*NullContext::getProgram(GLuint name){
+  auto const result = programs.get(name);
+  if(!result)setError(shaders.has(name)?GL_INVALID_OPERATION:GL_INVALID_VALUE);
+  return result;
+}
+
+NullContext::Shader*NullContext::getShader(GLuint name){
+  auto const result = shaders.get(name);
+  if(!result)setError(programs.has(name)?GL_INVALID_OPERATION:GL_INVALID_VALUE);
+  return result;
+}
+
+NullContext::Framebuffer*NullContext::getFramebuffer(GLuint name){
+  auto const result = framebuffers.get(name);
+  if(!result)setError(GL_INVALID_OPERATION);
+  return result;
+}
+
+NullContext::Renderbuffer*NullContext::getRenderbuffer(GLuint name){
+  auto const result = renderbuffers.get(name);
+  if(!result)setError(GL_INVALID_OPERATION);
+  return result;
+}
+
+namespace{
+  GLenum getGLSLType(std::string const&name){
+    static std::map<std::string,GLenum>const types = {
+      {"float"               ,GL_FLOAT                          },
+      {"vec2"                ,GL_FLOAT_VEC2                     },
+      {"vec3"                ,GL_FLOAT_VEC3                     },
+      {"vec4"                ,GL_FLOAT_VEC4                     },
+      {"double"              ,GL_DOUBLE                         },
+      {"dvec2"               ,GL_DOUBLE_VEC2                    },
+      {"dvec3"               ,GL_DOUBLE_VEC3                    },
+      {"dvec4"               ,GL_DOUBLE_VEC4                    },
+      {"int"                 ,GL_INT                            },
+      {"ivec2"               ,GL_INT_VEC2                       },
+      {"ivec3"               ,GL_INT_VEC3                       },
+      {"ivec4"               ,GL_INT_VEC4                       },
+      {"uint"                ,GL_UNSIGNED_INT                   },
+      {"uvec2"               ,GL_UNSIGNED_INT_VEC2              },
+      {"uvec3"               ,GL_UNSIGNED_INT_VEC3              },
+      {"uvec4"               ,GL_UNSIGNED_INT_VEC4              },
+      {"bool"                ,GL_BOOL                           },
+      {"bvec2"               ,GL_BOOL_VEC2                      },
+      {"bvec3"               ,GL_BOOL_VEC3                      },
+      {"bvec4"               ,GL_BOOL_VEC4                      },
+      {"mat2"                ,GL_FLOAT_MAT2                     },
+      {"mat3"                ,GL_FLOAT_MAT3                     },
+      {"mat4"                ,GL_FLOAT_MAT4                     },
+      {"mat2x2"              ,GL_FLOAT_MAT2                     },
+      {"mat2x3"              ,GL_FLOAT_MAT2x3                   },
+      {"mat2x4"              ,GL_FLOAT_MAT2x4                   },
+      {"mat3x2"              ,GL_FLOAT_MAT3x2                   },
+      {"mat3x3"              ,GL_FLOAT_MAT3                     },
+      {"mat3x4"              ,GL_FLOAT_MAT3x4                   },
+      {"mat4x2"              ,GL_FLOAT_MAT4x2                   },
+      {"mat4x3"              ,GL_FLOAT_MAT4x3                   },
+      {"mat4x4"              ,GL_FLOAT_MAT4                     },
+      {"dmat2"               ,GL_DOUBLE_MAT2                    },
+      {"dmat3"               ,GL_DOUBLE_MAT3                    },
+      {"dmat4"               ,GL_DOUBLE_MAT4                    },
+      {"dmat2x3"             ,GL_DOUBLE_MAT2x3                  },
+      {"dmat2x4"             ,GL_DOUBLE_MAT2x4                  },
+      {"dmat3x2"             ,GL_DOUBLE_MAT3x2                  },
+      {"dmat3x4"             ,GL_DOUBLE_MAT3x4                  },
+      {"dmat4x2"             ,GL_DOUBLE_MAT4x2                  },
+      {"dmat4x3"             ,GL_DOUBLE_MAT4x3                  },
+      {"sampler1D"           ,GL_SAMPLER_1D                     },
+      {"sampler2D"           ,GL_SAMPLER_2D                     },
+      {"sampler3D"           ,GL_SAMPLER_3D                     },
+      {"samplerCube"         ,GL_SAMPLER_CUBE                   },
+      {"sampler2DRect"       ,GL_SAMPLER_2D_RECT                },
+      {"sampler1DArray"      ,GL_SAMPLER_1D_ARRAY               },
+      {"sampler2DArray"      ,GL_SAMPLER_2D_ARRAY               },
+      {"samplerCubeArray"    ,GL_SAMPLER_CUBE_MAP_ARRAY         },
+      {"samplerBuffer"       ,GL_SAMPLER_BUFFER                 },
+      {"sampler2DMS"         ,GL_SAMPLER_2D_MULTISAMPLE         },
+      {"sampler2DMSArray"    ,GL_SAMPLER_2D_MULTISAMPLE_ARRAY   },
+      {"sampler1DShadow"     ,GL_SAMPLER_1D_SHADOW              },
+      {"sampler2DShadow"     ,GL_SAMPLER_2D_SHADOW              },
+      {"samplerCubeShadow"   ,GL_SAMPLER_CUBE_SHADOW            },
+      {"sampler2DArrayShadow",GL_SAMPLER_2D_ARRAY_SHADOW        },
+      {"isampler1D"          ,GL_INT_SAMPLER_1D                 },
+      {"isampler2D"          ,GL_INT_SAMPLER_2D                 },
+      {"isampler3D"          ,GL_INT_SAMPLER_3D                 },
+      {"isamplerCube"        ,GL_INT_SAMPLER_CUBE               },
+      {"isampler2DArray"     ,GL_INT_SAMPLER_2D_ARRAY           },
+      {"isamplerBuffer"      ,GL_INT_SAMPLER_BUFFER             },
+      {"usampler1D"          ,GL_UNSIGNED_INT_SAMPLER_1D        },
+      {"usampler2D"          ,GL_UNSIGNED_INT_SAMPLER_2D        },
+      {"usampler3D"          ,GL_UNSIGNED_INT_SAMPLER_3D        },
+      {"usamplerCube"        ,GL_UNSIGNED_INT_SAMPLER_CUBE      },
+      {"usampler2DArray"     ,GL_UNSIGNED_INT_SAMPLER_2D_ARRAY  },
+      {"usamplerBuffer"      ,GL_UNSIGNED_INT_SAMPLER_BUFFER    },
+      {"image1D"             ,GL_IMAGE_1D                       },
+      {"image2D"             ,GL_IMAGE_2D                       },
+      {"image3D"             ,GL_IMAGE_3D                       },
+      {"imageCube"           ,GL_IMAGE_CUBE                     },
+      {"image2DArray"        ,GL_IMAGE_2D_ARRAY                 },
+      {"imageBuffer"         ,GL_IMAGE_BUFFER                   },
+      {"iimage1D"            ,GL_INT_IMAGE_1D                   },
+      {"iimage2D"            ,GL_INT_IMAGE_2D                   },
+      {"iimage3D"            ,GL_INT_IMAGE_3D                   },
+      {"iimage2DArray"       ,GL_INT_IMAGE_2D_ARRAY             },
+      {"uimage1D"            ,GL_UNSIGNED_INT_IMAGE_1D          },
+      {"uimage2D"            ,GL_UNSIGNED_INT_IMAGE_2D          },
+      {"uimage3D"            ,GL_UNSIGNED_INT_IMAGE_3D          },
+      {"uimage2DArray"       ,GL_UNSIGNED_INT_IMAGE_2D_ARRAY    },
+      {"atomic_uint"         ,GL_UNSIGNED_INT_ATOMIC_COUNTER    },
+    };
+    auto const it = types.find(name);
+    if(it == types.end())return 0;
+    return it->second;
+  }
+
+  std::string removeComments(std::string const&source){
+    static std::regex const comments("//[^\\n]*|/\\*[\\s\\S]*?\\*/");
+    return std::regex_replace(source,comments," ");
+  }
+
+  GLint getLayoutValue(std::string const&layout,std::string const&name,GLint defaultValue){
+    std::smatch m;
+    std::regex const r("\\b"+name+"\\s*=\\s*(\\d+)");
+    if(!std::regex_search(layout,m,r))return defaultValue;
+    return std::stoi(m[1]);
+  }
+
+  GLint getNofColumns(GLenum type){
+    switch(type){
+      case GL_FLOAT_MAT2  :case GL_FLOAT_MAT2x3 :case GL_FLOAT_MAT2x4 :
+      case GL_DOUBLE_MAT2 :case GL_DOUBLE_MAT2x3:case GL_DOUBLE_MAT2x4:return 2;
+      case GL_FLOAT_MAT3  :case GL_FLOAT_MAT3x2 :case GL_FLOAT_MAT3x4 :
+      case GL_DOUBLE_MAT3 :case GL_DOUBLE_MAT3x2:case GL_DOUBLE_MAT3x4:return 3;
+      case GL_FLOAT_MAT4  :case GL_FLOAT_MAT4x2 :case GL_FLOAT_MAT4x3 :
+      case GL_DOUBLE_MAT4 :case GL_DOUBLE_MAT4x2:case GL_DOUBLE_MAT4x3:return 4;
+      default:return 1;
+    }
+  }
+
+  /**
+   * @brief Gets shape of types allowed in uniform blocks
+   *
+   * @param type type of member
+   * @param rows number of components of vector (rows of matrix)
+   * @param componentSize size of component in bytes
+   *
+   * @return false for opaque types
+   */
+  bool getBlockMemberShape(GLenum type,GLint&rows,GLint&componentSize){
+    switch(type){
+      case GL_FLOAT       :case GL_INT          :case GL_UNSIGNED_INT       :case GL_BOOL      :rows = 1;componentSize = 4;return true;
+      case GL_FLOAT_VEC2  :case GL_INT_VEC2     :case GL_UNSIGNED_INT_VEC2  :case GL_BOOL_VEC2 :
+      case GL_FLOAT_MAT2  :case GL_FLOAT_MAT3x2 :case GL_FLOAT_MAT4x2                          :rows = 2;componentSize = 4;return true;
+      case GL_FLOAT_VEC3  :case GL_INT_VEC3     :case GL_UNSIGNED_INT_VEC3  :case GL_BOOL_VEC3 :
+      case GL_FLOAT_MAT2x3:case GL_FLOAT_MAT3   :case GL_FLOAT_MAT4x3                          :rows = 3;componentSize = 4;return true;
+      case GL_FLOAT_VEC4  :case GL_INT_VEC4     :case GL_UNSIGNED_INT_VEC4  :case GL_BOOL_VEC4 :
+      case GL_FLOAT_MAT2x4:case GL_FLOAT_MAT3x4 :case GL_FLOAT_MAT4                            :rows = 4;componentSize = 4;return true;
+      case GL_DOUBLE                                                                           :rows = 1;componentSize = 8;return true;
+      case GL_DOUBLE_VEC2 :case GL_DOUBLE_MAT2  :case GL_DOUBLE_MAT3x2:case GL_DOUBLE_MAT4x2   :rows = 2;componentSize = 8;return true;
+      case GL_DOUBLE_VEC3 :case GL_DOUBLE_MAT2x3:case GL_DOUBLE_MAT3  :case GL_DOUBLE_MAT4x3   :rows = 3;componentSize = 8;return true;
+      case GL_DOUBLE_VEC4 :case GL_DOUBLE_MAT2x4:case GL_DOUBLE_MAT3x4:case GL_DOUBLE_MAT4     :rows = 4;componentSize = 8;return true;
+      default:return false;
+    }
+  }
+
+  GLint roundUp(GLint value,GLint alignment){
+    return (value+alignment-1)/alignment*alignment;
+  }
+
+  /**
+   * @brief Lays out member of uniform block using std140 rules (OpenGL 4.6 spec, section 7.6.2.2)
+   *
+   * @param v member, its type, size and rowMajor are read, offset and strides are written
+   * @param isArray member is declared as array
+   * @param offset end of previous member, it is moved behind the member
+   * @param maxAlignment maximal alignment of block members
+   *
+   * @return false for opaque types
+   */
+  bool layoutStd140(NullContext::Variable&v,bool isArray,GLint&offset,GLint&maxAlignment){
+    GLint rows,componentSize;
+    if(!getBlockMemberShape(v.type,rows,componentSize))return false;
+    auto const vectorAlignment = [&](GLint n){return (n == 3 ? 4 : n)*componentSize;};
+    auto const columns = getNofColumns(v.type);
+    GLint alignment,elementSize;
+    v.matrixStride = 0;
+    if(columns > 1){
+      if(!v.rowMajor)v.matrixStride = roundUp(vectorAlignment(rows   ),16);
+      else           v.matrixStride = roundUp(vectorAlignment(columns),16);
+      alignment   = v.matrixStride;
+      elementSize = (v.rowMajor ? rows : columns)*v.matrixStride;
+    }else{
+      v.rowMajor  = 0;
+      alignment   = vectorAlignment(rows);
+      elementSize = rows*componentSize;
+      if(isArray){
+        alignment   = roundUp(alignment,16);
+        elementSize = roundUp(elementSize,alignment);
+      }
+    }
+    offset         = roundUp(offset,alignment);
+    maxAlignment   = std::max(maxAlignment,alignment);
+    v.offset       = offset;
+    v.arrayStride  = isArray ? elementSize : 0;
+    offset        += v.size*elementSize;
+    return true;
+  }
+
+  /**
+   * @brief Splits "a,b[2] = float[2](1,2)" to declarators,
+   * commas inside of initializers are skipped.
+   */
+  std::vector<std::string>splitDeclarators(std::string const&list){
+    std::vector<std::string>result(1);
+    int depth = 0;
+    for(auto const c:list){
+      if(c == '(' || c == '[')depth++;
+      if(c == ')' || c == ']')depth--;
+      if(c == ',' && depth == 0)result.emplace_back();
+      else result.back() += c;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Parses declarations like "uniform vec3 a,b[4];" from shader source.
+   *
+   * @param source shader source without comments
+   * @param storage regex alternative of storage qualifiers ("uniform", "in|attribute")
+   * @param perColumn true if every column of matrix consumes one location
+   * @param variables output list of variables, location is -1 or explicit layout location
+   */
+  void parseVariables(
+      std::string                  const&source   ,
+      std::string                  const&storage  ,
+      bool                               perColumn,
+      std::vector<NullContext::Variable>&variables){
+    std::string const qualifiers = "(?:(?:flat|smooth|noperspective|centroid|highp|mediump|lowp|readonly|writeonly|coherent|volatile|restrict)\\s+)*";
+    std::regex const declaration(
+        "(?:layout\\s*\\(([^)]*)\\)\\s*)?"+qualifiers+
+        "\\b(?:"+storage+")\\s+"+qualifiers+
+        "(\\w+)\\s+([^;{}]+);");
+    static std::regex const declarator("^\\s*(\\w+)\\s*(?:\\[\\s*(\\d+)\\s*\\])?\\s*$");
+    for(auto it = std::sregex_iterator(source.begin(),source.end(),declaration);it != std::sregex_iterator();++it){
+      auto const type = getGLSLType((*it)[2]);
+      if(!type)continue;
+      std::string const layout = (*it)[1];
+      GLint location = getLayoutValue(layout,"location",-1);
+      for(auto item:splitDeclarators((*it)[3])){
+        auto const initializer = item.find('=');
+        if(initializer != std::string::npos)item = item.substr(0,initializer);
+        std::smatch m;
+        if(!std::regex_match(item,m,declarator))continue;
+        std::string const name = m[1];
+        if(name.compare(0,3,"gl_") == 0)continue;
+        GLint const size = m[2].matched?std::stoi(m[2]):1;
+        if(std::any_of(variables.begin(),variables.end(),[&](NullContext::Variable const&v){return v.name == name;}))continue;
+        variables.push_back({name,type,size,location});
+        if(location >= 0)location += size*(perColumn?getNofColumns(type):1);
+      }
+    }
+  }
+
+  /**
+   * @brief Parses uniform blocks like "layout(std140,binding=1)uniform Light{vec4 color;}light;" from shader source.
+   * All blocks are laid out using std140 rules, arrays of blocks and structures inside blocks are skipped.
+   * Row major layout is reported only for matrices.
+   *
+   * @param source shader source without comments
+   * @param program program, members are appended to its uniforms (without location)
+   */
+  void parseUniformBlocks(std::string const&source,NullContext::Program&program){
+    static std::regex const block(
+        "(?:layout\\s*\\(([^)]*)\\)\\s*)?\\buniform\\s+(\\w+)\\s*\\{([^}]*)\\}\\s*(\\w+)?\\s*(\\[[^\\]]*\\])?\\s*;");
+    static std::regex const member("(?:layout\\s*\\(([^)]*)\\)\\s*)?(?:(?:highp|mediump|lowp)\\s+)*(\\w+)\\s+([^;]+);");
+    static std::regex const declarator("^\\s*(\\w+)\\s*(?:\\[\\s*(\\d+)\\s*\\])?\\s*$");
+    static std::regex const rowMajor("\\brow_major\\b");
+    for(auto it = std::sregex_iterator(source.begin(),source.end(),block);it != std::sregex_iterator();++it){
+      std::string const name     = (*it)[2];
+      std::string const layout   = (*it)[1];
+      std::string const body     = (*it)[3];
+      std::string const instance = (*it)[4];
+      if((*it)[5].matched)continue;
+      if(std::any_of(program.uniformBlocks.begin(),program.uniformBlocks.end(),[&](NullContext::UniformBlock const&b){return b.name == name;}))continue;
+      bool const blockRowMajor = std::regex_search(layout,rowMajor);
+      NullContext::UniformBlock uniformBlock;
+      uniformBlock.name    = name;
+      uniformBlock.binding = getLayoutValue(layout,"binding",0);
+      GLint offset       = 0 ;
+      GLint maxAlignment = 16;
+      for(auto m = std::sregex_iterator(body.begin(),body.end(),member);m != std::sregex_iterator();++m){
+        auto const type = getGLSLType((*m)[2]);
+        if(!type)continue;
+        std::string const memberLayout = (*m)[1];
+        for(auto const&item:splitDeclarators((*m)[3])){
+          std::smatch d;
+          if(!std::regex_match(item,d,declarator))continue;
+          NullContext::Variable v;
+          v.name     = instance.empty() ? std::string(d[1]) : name+"."+std::string(d[1]);
+          v.type     = type;
+          v.size     = d[2].matched?std::stoi(d[2]):1;
+          v.location = -1;
+          v.block    = (GLint)program.uniformBlocks.size();
+          v.rowMajor = (memberLayout.empty() ? blockRowMajor : std::regex_search(memberLayout,rowMajor)) ? 1 : 0;
+          if(!layoutStd140(v,d[2].matched,offset,maxAlignment))continue;
+          uniformBlock.variables.push_back((GLint)program.uniforms.size());
+          program.uniforms.push_back(v);
+        }
+      }
+      //block is structure, its size is multiple of its alignment
+      uniformBlock.dataSize = roundUp(offset,maxAlignment);
+      program.uniformBlocks.push_back(uniformBlock);
+    }
+  }
+
+  void assignLocations(
+      std::vector<NullContext::Variable>     &variables,
+      std::map<std::string,GLuint>      const&bindings ,
+      bool                                    perColumn){
+    std::set<GLint>used;
+    auto const nofLocations = [&](NullContext::Variable const&v){
+      return v.size*(perColumn?getNofColumns(v.type):1);
+    };
+    for(auto&v:variables){
+      auto const it = bindings.find(v.name);
+      if(v.location < 0 && it != bindings.end())v.location = (GLint)it->second;
+      if(v.location < 0)continue;
+      for(GLint i=0;i<nofLocations(v);++i)used.insert(v.location+i);
+    }
+    GLint next = 0;
+    for(auto&v:variables){
+      if(v.location >= 0)continue;
+      for(;;++next){
+        bool free = true;
+        for(GLint i=0;i<nofLocations(v);++i)free &= used.count(next+i) == 0;
+        if(free)break;
+      }
+      v.location = next;
+      next += nofLocations(v);
+    }
+  }
+}
+
+/**
+ * @brief Links program and reflects uniforms, vertex inputs and work group size from sources of attached shaders.
+ * Unlike real linker, all declared uniforms are active.
+ * Matrices occupy one uniform location and one attribute location per column.
+ * Uniform blocks are laid out using std140 rules, their members do not have location.
+ *
+ * @param program program
+ */
+void NullContext::link(Program&program){
+  program.uniforms     .clear();
+  program.attribs      .clear();
+  program.uniformBlocks.clear();
+  std::vector<std::string>sources;
+  program.workGroupSize = {{0,0,0}};
+  program.infoLog = "";
+  program.linked = !program.shaders.empty();
+  for(auto const&name:program.shaders){
+    auto const shader = shaders.get(name);
+    if(!shader->compiled){
+      program.linked = false;
+      program.infoLog += "shader "+std::to_string(name)+" is not compiled\n";
+      continue;
+    }
+    auto const source = removeComments(shader->source);
+    sources.push_back(source);
+    parseVariables(source,"uniform"     ,false,program.uniforms);
+    if(shader->type == GL_VERTEX_SHADER)
+      parseVariables(source,"in|attribute",true ,program.attribs );
+    if(shader->type == GL_COMPUTE_SHADER){
+      static std::regex const localSize("layout\\s*\\(([^)]*)\\)\\s*in\\s*;");
+      std::smatch m;
+      program.workGroupSize = {{1,1,1}};
+      if(std::regex_search(source,m,localSize)){
+        program.workGroupSize[0] = getLayoutValue(m[1],"local_size_x",1);
+        program.workGroupSize[1] = getLayoutValue(m[1],"local_size_y",1);
+        program.workGroupSize[2] = getLayoutValue(m[1],"local_size_z",1);
+      }
+    }
+  }
+  if(!program.linked){
+    program.uniforms.clear();
+    program.attribs .clear();
+    return;
+  }
+  assignLocations(program.uniforms,{}                    ,false);
+  assignLocations(program.attribs ,program.attribBindings,true );
+  for(auto const&source:sources)
+    parseUniformBlocks(source,program);
+}
+
+/**
+ * @brief Serializes reflection of linked program, it is program binary of null context.
+ *
+ * @param program linked program
+ *
+ * @return program binary
+ */
+std::string NullContext::getProgramBinary(Program const&program){
+  std::ostringstream ss;
+  ss<<"geGL null program 2"<<std::endl;
+  ss<<program.workGroupSize[0]<<" "<<program.workGroupSize[1]<<" "<<program.workGroupSize[2]<<std::endl;
+  auto const write = [&](char const*kind,Variable const&v){
+    ss<<kind<<" "<<v.name<<" "<<v.type<<" "<<v.size<<" "<<v.location;
+    ss<<" "<<v.block<<" "<<v.offset<<" "<<v.arrayStride<<" "<<v.matrixStride<<" "<<v.rowMajor<<std::endl;
+  };
+  for(auto const&v:program.uniforms)write("u",v);
+  for(auto const&v:program.attribs )write("a",v);
+  for(auto const&b:program.uniformBlocks){
+    ss<<"b "<<b.name<<" "<<b.binding<<" "<<b.dataSize<<" "<<b.variables.size();
+    for(auto const&i:b.variables)ss<<" "<<i;
+    ss<<std::endl;
+  }
+  return ss.str();
+}
+
+/**
+ * @brief Restores program from binary returned by getProgramBinary.
+ * Program is not linked if binary is malformed.
+ *
+ * @param program program
+ * @param binary program binary
+ *
+ * @return link status
+ */
+bool NullContext::setProgramBinary(Program&program,std::string const&binary){
+  program.uniforms     .clear();
+  program.attribs      .clear();
+  program.uniformBlocks.clear();
+  program.linked = false;
+  std::istringstream ss(binary);
+  std::string header;
+  std::getline(ss,header);
+  auto&size = program.workGroupSize;
+  if(header != "geGL null program 2" || !(ss>>size[0]>>size[1]>>size[2])){
+    program.infoLog = "invalid program binary\n";
+    return false;
+  }
+  auto const invalid = [&](){
+    program.uniforms     .clear();
+    program.attribs      .clear();
+    program.uniformBlocks.clear();
+    program.infoLog = "invalid program binary\n";
+    return false;
+  };
+  std::string kind;
+  while(ss>>kind){
+    if(kind == "b"){
+      UniformBlock b;
+      size_t nofVariables = 0;
+      if(!(ss>>b.name>>b.binding>>b.dataSize>>nofVariables))return invalid();
+      b.variables.resize(nofVariables);
+      for(auto&i:b.variables)
+        if(!(ss>>i) || i < 0 || (size_t)i >= program.uniforms.size())return invalid();
+      program.uniformBlocks.push_back(b);
+      continue;
+    }
+    Variable v;
+    if(!(ss>>v.name>>v.type>>v.size>>v.location>>v.block>>v.offset>>v.arrayStride>>v.matrixStride>>v.rowMajor) || (kind != "u" && kind != "a"))
+      return invalid();
+    (kind == "u" ? program.uniforms : program.attribs).push_back(v);
+  }
+  program.infoLog = "";
+  program.linked = true;
+  return true;
+}
+
+namespace{
+#define CONTEXT(...)\
+  auto const c = NullContext::current();\
+  if(!c)return __VA_ARGS__
+
+  void copyString(std::string const&str,GLsizei bufSize,GLsizei*length,GLchar*out){
+    if(length)*length = 0;
+    if(bufSize <= 0 || !out)return;
+    auto const n = std::min<size_t>(str.size(),(size_t)bufSize-1);
+    std::memcpy(out,str.data(),n);
+    out[n] = 0;
+    if(length)*length = (GLsizei)n;
+  }
+
+  template<typename OBJECT>
+    void genObjects(NullContext::Objects<OBJECT>&objects,GLsizei n,GLuint*names){
+      if(n < 0){
+        NullContext::current()->setError(GL_INVALID_VALUE);
+        return;
+      }
+      for(GLsizei i=0;i<n;++i)names[i] = objects.create();
+    }
+
+  template<typename OBJECT>
+    void deleteObjects(NullContext::Objects<OBJECT>&objects,GLsizei n,GLuint const*names){
+      if(n < 0){
+        NullContext::current()->setError(GL_INVALID_VALUE);
+        return;
+      }
+      for(GLsizei i=0;i<n;++i)objects.objects.erase(names[i]);
+    }
+
+  template<typename OBJECT>
+    GLboolean isObject(NullContext::Objects<OBJECT>const&objects,GLuint name){
+      return objects.has(name)?GL_TRUE:GL_FALSE;
+    }
+
+  //errors, strings and global state
+
+  GLenum glGetError(){
+    CONTEXT(GL_NO_ERROR);
+    auto const result = c->error;
+    c->error = GL_NO_ERROR;
+    return result;
+  }
+
+  GLubyte const*glGetString(GLenum name){
+    CONTEXT(nullptr);
+    switch(name){
+      case GL_VENDOR                  :return (GLubyte const*)"geGL";
+      case GL_RENDERER                :return (GLubyte const*)"geGL null renderer";
+      case GL_VERSION                 :return (GLubyte const*)"4.6.0 geGL null";
+      case GL_SHADING_LANGUAGE_VERSION:return (GLubyte const*)"4.60 geGL null";
+      default                         :c->setError(GL_INVALID_ENUM);return nullptr;
+    }
+  }
+
+  GLubyte const*glGetStringi(GLenum name,GLuint index){
+    CONTEXT(nullptr);
+    if(name != GL_EXTENSIONS){
+      c->setError(GL_INVALID_ENUM);
+      return nullptr;
+    }
+    if(index != 0){
+      c->setError(GL_INVALID_VALUE);
+      return nullptr;
+    }
+    return (GLubyte const*)"GL_KHR_parallel_shader_compile";
+  }
+
+  struct IndexedBufferTarget{
+    GLenum target ;
+    GLenum binding;
+    GLenum start  ;
+    GLenum size   ;
+  };
+
+  IndexedBufferTarget const*getIndexedBufferTarget(GLenum pname){
+    static IndexedBufferTarget const targets[] = {
+      {GL_UNIFORM_BUFFER           ,GL_UNIFORM_BUFFER_BINDING           ,GL_UNIFORM_BUFFER_START           ,GL_UNIFORM_BUFFER_SIZE           },
+      {GL_SHADER_STORAGE_BUFFER    ,GL_SHADER_STORAGE_BUFFER_BINDING    ,GL_SHADER_STORAGE_BUFFER_START    ,GL_SHADER_STORAGE_BUFFER_SIZE    },
+      {GL_ATOMIC_COUNTER_BUFFER    ,GL_ATOMIC_COUNTER_BUFFER_BINDING    ,GL_ATOMIC_COUNTER_BUFFER_START    ,GL_ATOMIC_COUNTER_BUFFER_SIZE    },
+      {GL_TRANSFORM_FEEDBACK_BUFFER,GL_TRANSFORM_FEEDBACK_BUFFER_BINDING,GL_TRANSFORM_FEEDBACK_BUFFER_START,GL_TRANSFORM_FEEDBACK_BUFFER_SIZE},
+    };
+    for(auto const&t:targets)
+      if(t.target == pname || t.binding == pname || t.start == pname || t.size == pname)return &t;
+    return nullptr;
+  }
+
+  /**
+   * @brief Writes value of state variable.
+   *
+   * @param c context
+   * @param pname state variable
+   * @param data output, at most 4 values
+   *
+   * @return number of written values, 0 if state variable is unknown
+   */
+  size_t getState(NullContext*c,GLenum pname,GLint64*data){
+    auto const set = [&](std::initializer_list<GLint64>const&values){
+      std::copy(values.begin(),values.end(),data);
+      return values.size();
+    };
+    auto const bufferTarget = bufferBinding2Target(pname);
+    if(bufferTarget == GL_ELEMENT_ARRAY_BUFFER)
+      return set({c->getVertexArray(c->vertexArrayBinding)->elementBuffer});
+    if(bufferTarget != 0){
+      auto const it = c->bufferBindings.find(bufferTarget);
+      return set({it == c->bufferBindings.end()?0:it->second});
+    }
+    auto const textureTarget = textureBinding2Target(pname);
+    if(textureTarget != 0){
+      auto const it = c->textureBindings.find(std::make_pair(c->activeTexture,textureTarget));
+      return set({it == c->textureBindings.end()?0:it->second});
+    }
+    switch(pname){
+      case GL_MAJOR_VERSION                           :return set({4});
+      case GL_MINOR_VERSION                           :return set({6});
+      case GL_CONTEXT_PROFILE_MASK                    :return set({GL_CONTEXT_CORE_PROFILE_BIT});
+      case GL_CONTEXT_FLAGS                           :return set({0});
+      case GL_NUM_EXTENSIONS                          :return set({1});
+      case GL_NUM_SHADER_BINARY_FORMATS               :return set({0});
+      case GL_NUM_PROGRAM_BINARY_FORMATS              :return set({1});
+      case GL_PROGRAM_BINARY_FORMATS                  :return set({NullContext::PROGRAM_BINARY_FORMAT});
+      case GL_ACTIVE_TEXTURE                          :return set({GL_TEXTURE0+c->activeTexture});
+      case GL_VERTEX_ARRAY_BINDING                    :return set({c->vertexArrayBinding});
+      case GL_CURRENT_PROGRAM                         :return set({c->currentProgram});
+      case GL_DRAW_FRAMEBUFFER_BINDING                :return set({c->drawFramebuffer});
+      case GL_READ_FRAMEBUFFER_BINDING                :return set({c->readFramebuffer});
+      case GL_RENDERBUFFER_BINDING                    :return set({c->renderbufferBinding});
+      case GL_PROGRAM_PIPELINE_BINDING                :return set({c->pipelineBinding});
+      case GL_SAMPLER_BINDING                         :return set({c->samplerBindings[c->activeTexture]});
+      case GL_VIEWPORT                                :return set({c->viewport  [0],c->viewport  [1],c->viewport  [2],c->viewport  [3]});
+      case GL_SCISSOR_BOX                             :return set({c->scissorBox[0],c->scissorBox[1],c->scissorBox[2],c->scissorBox[3]});
+      case GL_PACK_ALIGNMENT                          :
+      case GL_UNPACK_ALIGNMENT                        :return set({c->pixelStore.count(pname)?c->pixelStore[pname]:4});
+      case GL_PACK_ROW_LENGTH                         :
+      case GL_PACK_IMAGE_HEIGHT                       :
+      case GL_PACK_SKIP_ROWS                          :
+      case GL_PACK_SKIP_PIXELS                        :
+      case GL_PACK_SKIP_IMAGES                        :
+      case GL_UNPACK_ROW_LENGTH                       :
+      case GL_UNPACK_IMAGE_HEIGHT                     :
+      case GL_UNPACK_SKIP_ROWS                        :
+      case GL_UNPACK_SKIP_PIXELS                      :
+      case GL_UNPACK_SKIP_IMAGES                      :return set({c->pixelStore.count(pname)?c->pixelStore[pname]:0});
+      case GL_MAX_VERTEX_ATTRIBS                      :
+      case GL_MAX_VERTEX_ATTRIB_BINDINGS              :return set({NullContext::MAX_VERTEX_ATTRIBS});
+      case GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET       :return set({2047});
+      case GL_MAX_VERTEX_ATTRIB_STRIDE                :return set({2048});
+      case GL_MAX_TEXTURE_SIZE                        :
+      case GL_MAX_CUBE_MAP_TEXTURE_SIZE               :
+      case GL_MAX_RECTANGLE_TEXTURE_SIZE              :
+      case GL_MAX_RENDERBUFFER_SIZE                   :
+      case GL_MAX_FRAMEBUFFER_WIDTH                   :
+      case GL_MAX_FRAMEBUFFER_HEIGHT                  :return set({16384});
+      case GL_MAX_3D_TEXTURE_SIZE                     :
+      case GL_MAX_ARRAY_TEXTURE_LAYERS                :
+      case GL_MAX_FRAMEBUFFER_LAYERS                  :return set({2048});
+      case GL_MAX_TEXTURE_BUFFER_SIZE                 :return set({1<<27});
+      case GL_MAX_TEXTURE_MAX_ANISOTROPY              :return set({16});
+      case GL_MAX_TEXTURE_LOD_BIAS                    :return set({16});
+      case GL_MAX_TEXTURE_IMAGE_UNITS                 :
+      case GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS          :
+      case GL_MAX_GEOMETRY_TEXTURE_IMAGE_UNITS        :
+      case GL_MAX_TESS_CONTROL_TEXTURE_IMAGE_UNITS    :
+      case GL_MAX_TESS_EVALUATION_TEXTURE_IMAGE_UNITS :
+      case GL_MAX_COMPUTE_TEXTURE_IMAGE_UNITS         :return set({32});
+      case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS        :return set({192});
+      case GL_MAX_IMAGE_UNITS                         :return set({8});
+      case GL_MAX_UNIFORM_BUFFER_BINDINGS             :return set({84});
+      case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS      :return set({96});
+      case GL_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS      :return set({8});
+      case GL_MAX_TRANSFORM_FEEDBACK_BUFFERS          :return set({4});
+      case GL_MAX_UNIFORM_BLOCK_SIZE                  :return set({65536});
+      case GL_MAX_SHADER_STORAGE_BLOCK_SIZE           :return set({1<<27});
+      case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT         :return set({256});
+      case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT  :return set({16});
+      case GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT         :return set({16});
+      case GL_MIN_MAP_BUFFER_ALIGNMENT                :return set({64});
+      case GL_MAX_UNIFORM_LOCATIONS                   :
+      case GL_MAX_VERTEX_UNIFORM_COMPONENTS           :
+      case GL_MAX_FRAGMENT_UNIFORM_COMPONENTS         :
+      case GL_MAX_COMPUTE_UNIFORM_COMPONENTS          :return set({4096});
+      case GL_MAX_VARYING_COMPONENTS                  :return set({128});
+      case GL_MAX_DRAW_BUFFERS                        :
+      case GL_MAX_COLOR_ATTACHMENTS                   :
+      case GL_MAX_SAMPLES                             :
+      case GL_MAX_COLOR_TEXTURE_SAMPLES               :
+      case GL_MAX_DEPTH_TEXTURE_SAMPLES               :
+      case GL_MAX_INTEGER_SAMPLES                     :
+      case GL_MAX_FRAMEBUFFER_SAMPLES                 :
+      case GL_MAX_CLIP_DISTANCES                      :return set({8});
+      case GL_MAX_VIEWPORTS                           :return set({16});
+      case GL_MAX_VIEWPORT_DIMS                       :return set({16384,16384});
+      case GL_MAX_ELEMENTS_VERTICES                   :
+      case GL_MAX_ELEMENTS_INDICES                    :return set({1<<20});
+      case GL_MAX_PATCH_VERTICES                      :return set({32});
+      case GL_MAX_GEOMETRY_OUTPUT_VERTICES            :return set({256});
+      case GL_MAX_COMPUTE_SHARED_MEMORY_SIZE          :return set({49152});
+      case GL_MAX_COMPUTE_WORK_GROUP_INVOCATIONS      :return set({1024});
+      case GL_MAX_DEBUG_MESSAGE_LENGTH                :return set({1024});
+      case GL_MAX_LABEL_LENGTH                        :return set({256});
+      case GL_MAX_SERVER_WAIT_TIMEOUT                 :return set({0});
+      case GL_SUBPIXEL_BITS                           :return set({8});
+      default                                         :return 0;
+    }
+  }
+
+  size_t getIndexedState(NullContext*c,GLenum pname,GLuint index,GLint64*data){
+    if(auto const t = getIndexedBufferTarget(pname)){
+      auto const&b = c->indexedBufferBindings[std::make_pair(t->target,index)];
+      if(pname == t->binding){data[0] = b.buffer;return 1;}
+      if(pname == t->start  ){data[0] = b.offset;return 1;}
+      if(pname == t->size   ){data[0] = b.size  ;return 1;}
+      return 0;
+    }
+    auto const textureTarget = textureBinding2Target(pname);
+    if(textureTarget != 0){
+      auto const it = c->textureBindings.find(std::make_pair(index,textureTarget));
+      data[0] = it == c->textureBindings.end()?0:it->second;
+      return 1;
+    }
+    switch(pname){
+      case GL_SAMPLER_BINDING                :data[0] = c->samplerBindings[index];return 1;
+      case GL_MAX_COMPUTE_WORK_GROUP_COUNT   :data[0] = 65535;return index<3;
+      case GL_MAX_COMPUTE_WORK_GROUP_SIZE    :data[0] = index<2?1024:64;return index<3;
+      case GL_VIEWPORT                       :
+      case GL_SCISSOR_BOX                    :return getState(c,pname,data);
+      default                                :break;
+    }
+    if(index >= NullContext::MAX_VERTEX_ATTRIBS)return 0;
+    auto const&binding = c->getVertexArray(c->vertexArrayBinding)->bindings[index];
+    switch(pname){
+      case GL_VERTEX_BINDING_BUFFER :data[0] = binding.buffer ;return 1;
+      case GL_VERTEX_BINDING_OFFSET :data[0] = binding.offset ;return 1;
+      case GL_VERTEX_BINDING_STRIDE :data[0] = binding.stride ;return 1;
+      case GL_VERTEX_BINDING_DIVISOR:data[0] = binding.divisor;return 1;
+      default                       :return 0;
+    }
+  }
+
+  template<typename TYPE>
+    void getStateAs(GLenum pname,TYPE*data){
+      CONTEXT();
+      GLint64 values[4];
+      auto const n = getState(c,pname,values);
+      if(!n){
+        c->setError(GL_INVALID_ENUM);
+        return;
+      }
+      for(size_t i=0;i<n;++i)data[i] = (TYPE)values[i];
+    }
+
+  template<typename TYPE>
+    void getIndexedStateAs(GLenum pname,GLuint index,TYPE*data){
+      CONTEXT();
+      GLint64 values[4];
+      auto const n = getIndexedState(c,pname,index,values);
+      if(!n){
+        c->setError(GL_INVALID_VALUE);
+        return;
+      }
+      for(size_t i=0;i<n;++i)data[i] = (TYPE)values[i];
+    }
+
+  void glGetIntegerv  (GLenum pname,GLint    *data){getStateAs(pname,data);}
+  void glGetInteger64v(GLenum pname,GLint64  *data){getStateAs(pname,data);}
+  void glGetFloatv    (GLenum pname,GLfloat  *data){getStateAs(pname,data);}
+  void glGetDoublev   (GLenum pname,GLdouble *data){getStateAs(pname,data);}
+  void glGetBooleanv  (GLenum pname,GLboolean*data){getStateAs(pname,data);}
+  void glGetIntegeri_v  (GLenum pname,GLuint index,GLint  *data){getIndexedStateAs(pname,index,data);}
+  void glGetInteger64i_v(GLenum pname,GLuint index,GLint64*data){getIndexedStateAs(pname,index,data);}
+
+  void glEnable (GLenum cap){CONTEXT();c->enabled.insert(cap);}
+  void glDisable(GLenum cap){CONTEXT();c->enabled.erase (cap);}
+  GLboolean glIsEnabled(GLenum cap){
+    CONTEXT(GL_FALSE);
+    return c->enabled.count(cap)?GL_TRUE:GL_FALSE;
+  }
+  void glEnablei (GLenum cap,GLuint index){CONTEXT();c->enabledIndexed.insert(std::make_pair(cap,index));}
+  void glDisablei(GLenum cap,GLuint index){CONTEXT();c->enabledIndexed.erase (std::make_pair(cap,index));}
+  GLboolean glIsEnabledi(GLenum cap,GLuint index){
+    CONTEXT(GL_FALSE);
+    return c->enabledIndexed.count(std::make_pair(cap,index))?GL_TRUE:GL_FALSE;
+  }
+
+  void glPixelStorei(GLenum pname,GLint   param){CONTEXT();c->pixelStore[pname] = param;}
+  void glPixelStoref(GLenum pname,GLfloat param){CONTEXT();c->pixelStore[pname] = (GLint)param;}
+  void glViewport(GLint x,GLint y,GLsizei width,GLsizei height){CONTEXT();c->viewport   = {{x,y,width,height}};}
+  void glScissor (GLint x,GLint y,GLsizei width,GLsizei height){CONTEXT();c->scissorBox = {{x,y,width,height}};}
+
+  //buffers
+
+  void glGenBuffers   (GLsizei n,GLuint      *buffers){CONTEXT();genObjects   (c->buffers,n,buffers);}
+  void glCreateBuffers(GLsizei n,GLuint      *buffers){CONTEXT();genObjects   (c->buffers,n,buffers);}
+  GLboolean glIsBuffer(GLuint buffer){CONTEXT(GL_FALSE);return isObject(c->buffers,buffer);}
+  void glDeleteBuffers(GLsizei n,GLuint const*buffers){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i){
+      if(buffers[i] == 0)continue;
+      for(auto&b:c->bufferBindings)
+        if(b.second == buffers[i])b.second = 0;
+      for(auto&b:c->indexedBufferBindings)
+        if(b.second.buffer == buffers[i])b.second = NullContext::IndexedBinding();
+      auto const vao = c->getVertexArray(c->vertexArrayBinding);
+      if(vao->elementBuffer == buffers[i])vao->elementBuffer = 0;
+      for(auto&b:vao->bindings)
+        if(b.buffer == buffers[i])b.buffer = 0;
+    }
+    deleteObjects(c->buffers,n,buffers);
+  }
+
+  void glBindBuffer(GLenum target,GLuint buffer){
+    CONTEXT();
+    if(buffer != 0 && !c->buffers.has(buffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(target == GL_ELEMENT_ARRAY_BUFFER)
+      c->getVertexArray(c->vertexArrayBinding)->elementBuffer = buffer;
+    else
+      c->bufferBindings[target] = buffer;
+  }
+
+  void glBindBufferRange(GLenum target,GLuint index,GLuint buffer,GLintptr offset,GLsizeiptr size){
+    CONTEXT();
+    if(!getIndexedBufferTarget(target)){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    if(buffer != 0 && !c->buffers.has(buffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->bufferBindings[target] = buffer;
+    auto&b = c->indexedBufferBindings[std::make_pair(target,index)];
+    b.buffer = buffer;
+    b.offset = offset;
+    b.size   = size  ;
+  }
+
+  void glBindBufferBase(GLenum target,GLuint index,GLuint buffer){
+    glBindBufferRange(target,index,buffer,0,0);
+  }
+
+  void glBindBuffersRange(GLenum target,GLuint first,GLsizei count,GLuint const*buffers,GLintptr const*offsets,GLsizeiptr const*sizes){
+    for(GLsizei i=0;i<count;++i)
+      glBindBufferRange(target,first+(GLuint)i,buffers?buffers[i]:0,buffers?offsets[i]:0,buffers?sizes[i]:0);
+  }
+
+  void glBindBuffersBase(GLenum target,GLuint first,GLsizei count,GLuint const*buffers){
+    for(GLsizei i=0;i<count;++i)
+      glBindBufferRange(target,first+(GLuint)i,buffers?buffers[i]:0,0,0);
+  }
+
+  bool allocate(NullContext*c,NullContext::Buffer*b,GLsizeiptr size,void const*data){
+    if(size < 0){
+      c->setError(GL_INVALID_VALUE);
+      return false;
+    }
+    std::unique_ptr<uint8_t,void(*)(void*)>storage((uint8_t*)calloc((size_t)std::max<GLsizeiptr>(size,1),1),free);
+    if(!storage){
+      c->setError(GL_OUT_OF_MEMORY);
+      return false;
+    }
+    if(data)std::memcpy(storage.get(),data,(size_t)size);
+    b->data      = std::move(storage);
+    b->size      = size ;
+    b->mapped    = false;
+    b->access    = 0    ;
+    b->mapOffset = 0    ;
+    b->mapLength = 0    ;
+    return true;
+  }
+
+  void bufferData(NullContext*c,NullContext::Buffer*b,GLsizeiptr size,void const*data,GLenum usage){
+    if(!b)return;
+    if(b->immutable){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(!allocate(c,b,size,data))return;
+    b->usage = usage;
+    b->flags = GL_MAP_READ_BIT|GL_MAP_WRITE_BIT|GL_DYNAMIC_STORAGE_BIT;
+  }
+
+  void bufferStorage(NullContext*c,NullContext::Buffer*b,GLsizeiptr size,void const*data,GLbitfield flags){
+    if(!b)return;
+    if(b->immutable){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(!allocate(c,b,size,data))return;
+    b->usage     = GL_DYNAMIC_DRAW;
+    b->flags     = flags;
+    b->immutable = true;
+  }
+
+  bool checkRange(NullContext*c,NullContext::Buffer const*b,GLintptr offset,GLsizeiptr size){
+    if(offset < 0 || size < 0 || offset+size > b->size){
+      c->setError(GL_INVALID_VALUE);
+      return false;
+    }
+    return true;
+  }
+
+  bool isMappedNonPersistently(NullContext::Buffer const*b){
+    return b->mapped && (b->access & GL_MAP_PERSISTENT_BIT) == 0;
+  }
+
+  void bufferSubData(NullContext*c,NullContext::Buffer*b,GLintptr offset,GLsizeiptr size,void const*data){
+    if(!b || !checkRange(c,b,offset,size))return;
+    if(isMappedNonPersistently(b) || (b->immutable && (b->flags & GL_DYNAMIC_STORAGE_BIT) == 0)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(data)std::memcpy(b->data.get()+offset,data,(size_t)size);
+  }
+
+  void getBufferSubData(NullContext*c,NullContext::Buffer*b,GLintptr offset,GLsizeiptr size,void*data){
+    if(!b || !checkRange(c,b,offset,size))return;
+    if(isMappedNonPersistently(b)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    std::memcpy(data,b->data.get()+offset,(size_t)size);
+  }
+
+  void copyBufferSubData(NullContext*c,NullContext::Buffer*r,NullContext::Buffer*w,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){
+    if(!r || !w || !checkRange(c,r,readOffset,size) || !checkRange(c,w,writeOffset,size))return;
+    if(r == w && std::abs(readOffset-writeOffset) < size){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    if(isMappedNonPersistently(r) || isMappedNonPersistently(w)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    std::memmove(w->data.get()+writeOffset,r->data.get()+readOffset,(size_t)size);
+  }
+
+  /**
+   * @brief Fills buffer range with one element.
+   * Data are not converted from format/type to internal format,
+   * the first internalFormatSize bytes of data are repeated.
+   */
+  void clearBufferSubData(NullContext*c,NullContext::Buffer*b,GLenum internalFormat,GLintptr offset,GLsizeiptr size,void const*data){
+    if(!b || !checkRange(c,b,offset,size))return;
+    auto const elementSize = (GLsizeiptr)internalFormatSize(internalFormat)/8;
+    if(elementSize == 0){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    if(offset%elementSize != 0 || size%elementSize != 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    if(isMappedNonPersistently(b)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    for(GLsizeiptr i=0;i<size;i+=elementSize){
+      if(data)std::memcpy(b->data.get()+offset+i,data,(size_t)elementSize);
+      else    std::memset(b->data.get()+offset+i,0   ,(size_t)elementSize);
+    }
+  }
+
+  void*mapBufferRange(NullContext*c,NullContext::Buffer*b,GLintptr offset,GLsizeiptr length,GLbitfield access){
+    if(!b)return nullptr;
+    if(!checkRange(c,b,offset,length))return nullptr;
+    if(length == 0){
+      c->setError(GL_INVALID_VALUE);
+      return nullptr;
+    }
+    if(b->mapped || (access & (GL_MAP_READ_BIT|GL_MAP_WRITE_BIT)) == 0){
+      c->setError(GL_INVALID_OPERATION);
+      return nullptr;
+    }
+    b->mapped    = true  ;
+    b->access    = access;
+    b->mapOffset = offset;
+    b->mapLength = length;
+    return b->data.get()+offset;
+  }
+
+  GLbitfield accessToBits(GLenum access){
+    switch(access){
+      case GL_READ_ONLY :return GL_MAP_READ_BIT;
+      case GL_WRITE_ONLY:return GL_MAP_WRITE_BIT;
+      case GL_READ_WRITE:return GL_MAP_READ_BIT|GL_MAP_WRITE_BIT;
+      default           :return 0;
+    }
+  }
+
+  GLboolean unmapBuffer(NullContext*c,NullContext::Buffer*b){
+    if(!b)return GL_FALSE;
+    if(!b->mapped){
+      c->setError(GL_INVALID_OPERATION);
+      return GL_FALSE;
+    }
+    b->mapped    = false;
+    b->access    = 0    ;
+    b->mapOffset = 0    ;
+    b->mapLength = 0    ;
+    return GL_TRUE;
+  }
+
+  bool getBufferParameter(NullContext*c,NullContext::Buffer*b,GLenum pname,GLint64*data){
+    if(!b)return false;
+    switch(pname){
+      case GL_BUFFER_SIZE             :*data = b->size     ;return true;
+      case GL_BUFFER_USAGE            :*data = b->usage    ;return true;
+      case GL_BUFFER_ACCESS_FLAGS     :*data = b->access   ;return true;
+      case GL_BUFFER_MAPPED           :*data = b->mapped   ;return true;
+      case GL_BUFFER_MAP_OFFSET       :*data = b->mapOffset;return true;
+      case GL_BUFFER_MAP_LENGTH       :*data = b->mapLength;return true;
+      case GL_BUFFER_IMMUTABLE_STORAGE:*data = b->immutable;return true;
+      case GL_BUFFER_STORAGE_FLAGS    :*data = b->flags    ;return true;
+      case GL_BUFFER_ACCESS           :
+        switch(b->access & (GL_MAP_READ_BIT|GL_MAP_WRITE_BIT)){
+          case GL_MAP_READ_BIT :*data = GL_READ_ONLY ;return true;
+          case GL_MAP_WRITE_BIT:*data = GL_WRITE_ONLY;return true;
+          default              :*data = GL_READ_WRITE;return true;
+        }
+      default:
+        c->setError(GL_INVALID_ENUM);
+        return false;
+    }
+  }
+
+  template<typename TYPE>
+    void getBufferParameterAs(NullContext*c,NullContext::Buffer*b,GLenum pname,TYPE*data){
+      GLint64 value;
+      if(getBufferParameter(c,b,pname,&value))*data = (TYPE)value;
+    }
+
+  void getBufferPointer(NullContext*c,NullContext::Buffer*b,GLenum pname,void**params){
+    if(!b)return;
+    if(pname != GL_BUFFER_MAP_POINTER){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    *params = b->mapped?b->data.get()+b->mapOffset:nullptr;
+  }
+
+  void glNamedBufferData(GLuint buffer,GLsizeiptr size,void const*data,GLenum usage){CONTEXT();bufferData(c,c->getBuffer(buffer),size,data,usage);}
+  void glBufferData     (GLenum target,GLsizeiptr size,void const*data,GLenum usage){CONTEXT();bufferData(c,c->getBoundBuffer(target),size,data,usage);}
+  void glNamedBufferStorage(GLuint buffer,GLsizeiptr size,void const*data,GLbitfield flags){CONTEXT();bufferStorage(c,c->getBuffer(buffer),size,data,flags);}
+  void glBufferStorage     (GLenum target,GLsizeiptr size,void const*data,GLbitfield flags){CONTEXT();bufferStorage(c,c->getBoundBuffer(target),size,data,flags);}
+  void glNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void const*data){CONTEXT();bufferSubData(c,c->getBuffer(buffer),offset,size,data);}
+  void glBufferSubData     (GLenum target,GLintptr offset,GLsizeiptr size,void const*data){CONTEXT();bufferSubData(c,c->getBoundBuffer(target),offset,size,data);}
+  void glGetNamedBufferSubData(GLuint buffer,GLintptr offset,GLsizeiptr size,void*data){CONTEXT();getBufferSubData(c,c->getBuffer(buffer),offset,size,data);}
+  void glGetBufferSubData     (GLenum target,GLintptr offset,GLsizeiptr size,void*data){CONTEXT();getBufferSubData(c,c->getBoundBuffer(target),offset,size,data);}
+  void glCopyNamedBufferSubData(GLuint readBuffer,GLuint writeBuffer,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){
+    CONTEXT();
+    copyBufferSubData(c,c->getBuffer(readBuffer),c->getBuffer(writeBuffer),readOffset,writeOffset,size);
+  }
+  void glCopyBufferSubData(GLenum readTarget,GLenum writeTarget,GLintptr readOffset,GLintptr writeOffset,GLsizeiptr size){
+    CONTEXT();
+    copyBufferSubData(c,c->getBoundBuffer(readTarget),c->getBoundBuffer(writeTarget),readOffset,writeOffset,size);
+  }
+  void glClearNamedBufferSubData(GLuint buffer,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum,GLenum,void const*data){
+    CONTEXT();
+    clearBufferSubData(c,c->getBuffer(buffer),internalformat,offset,size,data);
+  }
+  void glClearBufferSubData(GLenum target,GLenum internalformat,GLintptr offset,GLsizeiptr size,GLenum,GLenum,void const*data){
+    CONTEXT();
+    clearBufferSubData(c,c->getBoundBuffer(target),internalformat,offset,size,data);
+  }
+  void glClearNamedBufferData(GLuint buffer,GLenum internalformat,GLenum,GLenum,void const*data){
+    CONTEXT();
+    auto const b = c->getBuffer(buffer);
+    if(b)clearBufferSubData(c,b,internalformat,0,b->size,data);
+  }
+  void glClearBufferData(GLenum target,GLenum internalformat,GLenum,GLenum,void const*data){
+    CONTEXT();
+    auto const b = c->getBoundBuffer(target);
+    if(b)clearBufferSubData(c,b,internalformat,0,b->size,data);
+  }
+  void*glMapNamedBufferRange(GLuint buffer,GLintptr offset,GLsizeiptr length,GLbitfield access){CONTEXT(nullptr);return mapBufferRange(c,c->getBuffer(buffer),offset,length,access);}
+  void*glMapBufferRange     (GLenum target,GLintptr offset,GLsizeiptr length,GLbitfield access){CONTEXT(nullptr);return mapBufferRange(c,c->getBoundBuffer(target),offset,length,access);}
+  void*glMapNamedBuffer(GLuint buffer,GLenum access){
+    CONTEXT(nullptr);
+    auto const b = c->getBuffer(buffer);
+    if(!b)return nullptr;
+    return mapBufferRange(c,b,0,b->size,accessToBits(access));
+  }
+  void*glMapBuffer(GLenum target,GLenum access){
+    CONTEXT(nullptr);
+    auto const b = c->getBoundBuffer(target);
+    if(!b)return nullptr;
+    return mapBufferRange(c,b,0,b->size,accessToBits(access));
+  }
+  GLboolean glUnmapNamedBuffer(GLuint buffer){CONTEXT(GL_FALSE);return unmapBuffer(c,c->getBuffer(buffer));}
+  GLboolean glUnmapBuffer     (GLenum target){CONTEXT(GL_FALSE);return unmapBuffer(c,c->getBoundBuffer(target));}
+  void glGetNamedBufferParameteriv  (GLuint buffer,GLenum pname,GLint  *params){CONTEXT();getBufferParameterAs(c,c->getBuffer     (buffer),pname,params);}
+  void glGetNamedBufferParameteri64v(GLuint buffer,GLenum pname,GLint64*params){CONTEXT();getBufferParameterAs(c,c->getBuffer     (buffer),pname,params);}
+  void glGetBufferParameteriv       (GLenum target,GLenum pname,GLint  *params){CONTEXT();getBufferParameterAs(c,c->getBoundBuffer(target),pname,params);}
+  void glGetBufferParameteri64v     (GLenum target,GLenum pname,GLint64*params){CONTEXT();getBufferParameterAs(c,c->getBoundBuffer(target),pname,params);}
+  void glGetNamedBufferPointerv(GLuint buffer,GLenum pname,void**params){CONTEXT();getBufferPointer(c,c->getBuffer     (buffer),pname,params);}
+  void glGetBufferPointerv     (GLenum target,GLenum pname,void**params){CONTEXT();getBufferPointer(c,c->getBoundBuffer(target),pname,params);}
+
+  //textures and samplers
+
+  /**
+   * @brief Writes default value of texture or sampler parameter.
+   *
+   * @return number of values, 0 for unknown parameter
+   */
+  size_t getDefaultParameter(GLenum pname,GLfloat*v){
+    auto const set = [&](std::initializer_list<GLfloat>const&values){
+      std::copy(values.begin(),values.end(),v);
+      return values.size();
+    };
+    switch(pname){
+      case GL_TEXTURE_MIN_FILTER          :return set({GL_NEAREST_MIPMAP_LINEAR});
+      case GL_TEXTURE_MAG_FILTER          :return set({GL_LINEAR});
+      case GL_TEXTURE_WRAP_S              :
+      case GL_TEXTURE_WRAP_T              :
+      case GL_TEXTURE_WRAP_R              :return set({GL_REPEAT});
+      case GL_TEXTURE_MIN_LOD             :return set({-1000.f});
+      case GL_TEXTURE_MAX_LOD             :return set({ 1000.f});
+      case GL_TEXTURE_LOD_BIAS            :return set({0.f});
+      case GL_TEXTURE_BASE_LEVEL          :return set({0.f});
+      case GL_TEXTURE_MAX_LEVEL           :return set({1000.f});
+      case GL_TEXTURE_COMPARE_MODE        :return set({GL_NONE});
+      case GL_TEXTURE_COMPARE_FUNC        :return set({GL_LEQUAL});
+      case GL_TEXTURE_MAX_ANISOTROPY      :return set({1.f});
+      case GL_DEPTH_STENCIL_TEXTURE_MODE  :return set({GL_DEPTH_COMPONENT});
+      case GL_TEXTURE_SWIZZLE_R           :return set({GL_RED  });
+      case GL_TEXTURE_SWIZZLE_G           :return set({GL_GREEN});
+      case GL_TEXTURE_SWIZZLE_B           :return set({GL_BLUE });
+      case GL_TEXTURE_SWIZZLE_A           :return set({GL_ALPHA});
+      case GL_TEXTURE_SWIZZLE_RGBA        :return set({GL_RED,GL_GREEN,GL_BLUE,GL_ALPHA});
+      case GL_TEXTURE_BORDER_COLOR        :return set({0.f,0.f,0.f,0.f});
+      default                             :return 0;
+    }
+  }
+
+  void setParameter(NullContext*c,NullContext::Parameters&parameters,GLenum pname,GLfloat const*v){
+    GLfloat defaults[4];
+    auto const n = getDefaultParameter(pname,defaults);
+    if(!n){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    if(pname == GL_TEXTURE_SWIZZLE_RGBA){
+      for(GLenum i=0;i<4;++i)parameters[GL_TEXTURE_SWIZZLE_R+i] = {{v[i]}};
+      return;
+    }
+    auto&p = parameters[pname];
+    std::copy(v,v+n,p.begin());
+  }
+
+  size_t getParameter(NullContext::Parameters const&parameters,GLenum pname,GLfloat*v){
+    if(pname == GL_TEXTURE_SWIZZLE_RGBA){
+      for(GLenum i=0;i<4;++i)getParameter(parameters,GL_TEXTURE_SWIZZLE_R+i,v+i);
+      return 4;
+    }
+    auto const n = getDefaultParameter(pname,v);
+    auto const it = parameters.find(pname);
+    if(it != parameters.end())std::copy(it->second.begin(),it->second.begin()+n,v);
+    return n;
+  }
+
+  size_t getTextureParameter(NullContext::Texture const&t,GLenum pname,GLfloat*v){
+    switch(pname){
+      case GL_TEXTURE_TARGET             :v[0] = (GLfloat)t.target         ;return 1;
+      case GL_TEXTURE_IMMUTABLE_FORMAT   :v[0] = (GLfloat)t.immutable      ;return 1;
+      case GL_TEXTURE_IMMUTABLE_LEVELS   :
+      case GL_TEXTURE_VIEW_NUM_LEVELS    :v[0] = (GLfloat)t.immutableLevels;return 1;
+      case GL_TEXTURE_VIEW_MIN_LEVEL     :
+      case GL_TEXTURE_VIEW_MIN_LAYER     :
+      case GL_TEXTURE_VIEW_NUM_LAYERS    :v[0] = 0.f                       ;return 1;
+      case GL_IMAGE_FORMAT_COMPATIBILITY_TYPE:v[0] = (GLfloat)GL_IMAGE_FORMAT_COMPATIBILITY_BY_SIZE;return 1;
+      default                            :return getParameter(t.parameters,pname,v);
+    }
+  }
+
+  GLenum getTextureTarget(GLenum target){
+    if(target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)return GL_TEXTURE_CUBE_MAP;
+    return target;
+  }
+
+  void bindTexture(NullContext*c,GLuint unit,GLenum target,GLuint texture){
+    if(texture == 0){
+      c->textureBindings[std::make_pair(unit,target)] = 0;
+      return;
+    }
+    auto const t = c->getTexture(texture);
+    if(!t)return;
+    if(t->target == 0)t->target = target;
+    if(target == 0)target = t->target;
+    if(t->target != target){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->textureBindings[std::make_pair(unit,target)] = texture;
+  }
+
+  void glGenTextures(GLsizei n,GLuint*textures){CONTEXT();genObjects(c->textures,n,textures);}
+  void glCreateTextures(GLenum target,GLsizei n,GLuint*textures){
+    CONTEXT();
+    genObjects(c->textures,n,textures);
+    for(GLsizei i=0;i<n;++i)c->textures.get(textures[i])->target = target;
+  }
+  GLboolean glIsTexture(GLuint texture){CONTEXT(GL_FALSE);return isObject(c->textures,texture);}
+  void glDeleteTextures(GLsizei n,GLuint const*textures){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i)
+      for(auto&b:c->textureBindings)
+        if(b.second == textures[i])b.second = 0;
+    deleteObjects(c->textures,n,textures);
+  }
+  void glActiveTexture(GLenum texture){
+    CONTEXT();
+    if(texture < GL_TEXTURE0 || texture >= GL_TEXTURE0+192){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    c->activeTexture = texture-GL_TEXTURE0;
+  }
+  void glBindTexture(GLenum target,GLuint texture){CONTEXT();bindTexture(c,c->activeTexture,target,texture);}
+  void glBindTextureUnit(GLuint unit,GLuint texture){
+    CONTEXT();
+    if(texture == 0){
+      for(auto&b:c->textureBindings)
+        if(b.first.first == unit)b.second = 0;
+      return;
+    }
+    bindTexture(c,unit,0,texture);
+  }
+  void glBindTextures(GLuint first,GLsizei count,GLuint const*textures){
+    for(GLsizei i=0;i<count;++i)glBindTextureUnit(first+(GLuint)i,textures?textures[i]:0);
+  }
+
+  /**
+   * @brief Allocates mipmap chain of texture.
+   */
+  void textureStorage(NullContext*c,NullContext::Texture*t,GLsizei levels,GLenum internalFormat,GLsizei width,GLsizei height,GLsizei depth,GLsizei samples,GLboolean fixedSampleLocations){
+    if(!t)return;
+    if(t->immutable){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(levels < 1 || width < 1 || height < 1 || depth < 1){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    bool const layeredHeight = t->target == GL_TEXTURE_1D_ARRAY;
+    bool const layeredDepth  = t->target == GL_TEXTURE_2D_ARRAY || t->target == GL_TEXTURE_CUBE_MAP_ARRAY || t->target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY;
+    t->levels.clear();
+    for(GLsizei l=0;l<levels;++l){
+      NullContext::TextureLevel level;
+      level.width                = std::max(width >>l,1);
+      level.height               = layeredHeight?height:std::max(height>>l,1);
+      level.depth                = layeredDepth ?depth :std::max(depth >>l,1);
+      level.internalFormat       = internalFormat;
+      level.samples              = samples;
+      level.fixedSampleLocations = fixedSampleLocations;
+      t->levels.push_back(level);
+    }
+    t->immutable       = true;
+    t->immutableLevels = levels;
+  }
+
+  void textureImage(NullContext*c,NullContext::Texture*t,GLint level,GLint internalFormat,GLsizei width,GLsizei height,GLsizei depth){
+    if(!t)return;
+    if(t->immutable){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(level < 0 || width < 0 || height < 0 || depth < 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    if((size_t)level >= t->levels.size())t->levels.resize((size_t)level+1);
+    auto&l = t->levels[(size_t)level];
+    l.width          = width ;
+    l.height         = height;
+    l.depth          = depth ;
+    l.internalFormat = (GLenum)internalFormat;
+  }
+
+  void generateMipmap(NullContext*c,NullContext::Texture*t){
+    if(!t)return;
+    if(t->levels.empty()){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(t->immutable)return;
+    auto const base = t->levels[0];
+    GLsizei levels = 1;
+    while((std::max(std::max(base.width,base.height),base.depth)>>levels) > 0)++levels;
+    textureStorage(c,t,levels,base.internalFormat,base.width,base.height,base.depth,0,GL_TRUE);
+    t->immutable       = false;
+    t->immutableLevels = 0;
+  }
+
+  GLenum channelType(BasicInternalFormatElement::Type type){
+    switch(type){
+      case BasicInternalFormatElement::FLOAT               :return GL_FLOAT              ;
+      case BasicInternalFormatElement::FIXED_POINT         :return GL_SIGNED_NORMALIZED  ;
+      case BasicInternalFormatElement::UNSIGNED_FIXED_POINT:return GL_UNSIGNED_NORMALIZED;
+      case BasicInternalFormatElement::INT                 :return GL_INT                ;
+      case BasicInternalFormatElement::UNSIGNED_INT        :return GL_UNSIGNED_INT       ;
+      default                                              :return GL_NONE               ;
+    }
+  }
+
+  /**
+   * @brief Returns level parameter, sizes and types of channels are derived from internal format.
+   */
+  bool getInternalFormatParameter(GLenum internalFormat,GLenum pname,GLint*v){
+    GLenum const sizes[] = {GL_TEXTURE_RED_SIZE,GL_TEXTURE_GREEN_SIZE,GL_TEXTURE_BLUE_SIZE,GL_TEXTURE_ALPHA_SIZE};
+    GLenum const types[] = {GL_TEXTURE_RED_TYPE,GL_TEXTURE_GREEN_TYPE,GL_TEXTURE_BLUE_TYPE,GL_TEXTURE_ALPHA_TYPE};
+    for(size_t i=0;i<4;++i){
+      if(pname != sizes[i] && pname != types[i])continue;
+      *v = 0;
+      if(!isInternalFormatBasic(internalFormat))return true;
+      auto const info = getBasicInternalFormatInformation(internalFormat);
+      if(i >= info.nofChannels || info.channelSize[i] == 0)return true;
+      *v = pname == sizes[i]?(GLint)info.channelSize[i]:(GLint)channelType(info.type);
+      return true;
+    }
+    switch(pname){
+      case GL_TEXTURE_DEPTH_SIZE  :
+      case GL_TEXTURE_STENCIL_SIZE:
+      case GL_TEXTURE_DEPTH_TYPE  :
+        *v = 0;
+        if(!isInternalFormatDepth(internalFormat))return true;
+        {
+          auto const info = getDepthInternalFormatInformation(internalFormat);
+          if(pname == GL_TEXTURE_DEPTH_SIZE  )*v = (GLint)info.depthSize  ;
+          if(pname == GL_TEXTURE_STENCIL_SIZE)*v = (GLint)info.stencilSize;
+          if(pname == GL_TEXTURE_DEPTH_TYPE && info.depthSize)
+            *v = info.depthFloating?GL_FLOAT:GL_UNSIGNED_NORMALIZED;
+        }
+        return true;
+      case GL_TEXTURE_SHARED_SIZE:*v = 0;return true;
+      default                    :return false;
+    }
+  }
+
+  void getTextureLevelParameter(NullContext*c,NullContext::Texture*t,GLint level,GLenum pname,GLint*v){
+    if(!t)return;
+    if(level < 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    NullContext::TextureLevel l;
+    if((size_t)level < t->levels.size())l = t->levels[(size_t)level];
+    switch(pname){
+      case GL_TEXTURE_WIDTH                 :*v = l.width               ;return;
+      case GL_TEXTURE_HEIGHT                :*v = l.height              ;return;
+      case GL_TEXTURE_DEPTH                 :*v = l.depth               ;return;
+      case GL_TEXTURE_INTERNAL_FORMAT       :*v = (GLint)l.internalFormat;return;
+      case GL_TEXTURE_SAMPLES               :*v = l.samples             ;return;
+      case GL_TEXTURE_FIXED_SAMPLE_LOCATIONS:*v = l.fixedSampleLocations;return;
+      case GL_TEXTURE_COMPRESSED            :*v = isInternalFormatCompressed(l.internalFormat);return;
+      case GL_TEXTURE_COMPRESSED_IMAGE_SIZE :*v = 0                     ;return;
+      case GL_TEXTURE_BUFFER_OFFSET         :
+      case GL_TEXTURE_BUFFER_SIZE           :
+      case GL_TEXTURE_BUFFER_DATA_STORE_BINDING:*v = 0                  ;return;
+      default                               :break;
+    }
+    if(l.width == 0){
+      *v = 0;
+      return;
+    }
+    if(!getInternalFormatParameter(l.internalFormat,pname,v))
+      c->setError(GL_INVALID_ENUM);
+  }
+
+  template<typename TYPE>
+    void getTextureParameterAs(NullContext*c,NullContext::Texture*t,GLenum pname,TYPE*data){
+      if(!t)return;
+      GLfloat v[4];
+      auto const n = getTextureParameter(*t,pname,v);
+      if(!n)c->setError(GL_INVALID_ENUM);
+      for(size_t i=0;i<n;++i)data[i] = (TYPE)v[i];
+    }
+
+  template<typename TYPE>
+    void setTextureParameterAs(NullContext*c,NullContext::Parameters*parameters,GLenum pname,TYPE const*data,size_t n = 4){
+      if(!parameters)return;
+      GLfloat v[4] = {0.f,0.f,0.f,0.f};
+      n = std::min(n,getDefaultParameter(pname,v));
+      for(size_t i=0;i<n;++i)v[i] = (GLfloat)data[i];
+      setParameter(c,*parameters,pname,v);
+    }
+
+  NullContext::Parameters*getParameters(NullContext::Texture*t){return t?&t->parameters:nullptr;}
+
+  void glTexStorage1D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width){CONTEXT();textureStorage(c,c->getBoundTexture(target),levels,internalformat,width,1,1,0,GL_TRUE);}
+  void glTexStorage2D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();textureStorage(c,c->getBoundTexture(target),levels,internalformat,width,height,1,0,GL_TRUE);}
+  void glTexStorage3D(GLenum target,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){CONTEXT();textureStorage(c,c->getBoundTexture(target),levels,internalformat,width,height,depth,0,GL_TRUE);}
+  void glTexStorage2DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){CONTEXT();textureStorage(c,c->getBoundTexture(target),1,internalformat,width,height,1,samples,fixedsamplelocations);}
+  void glTexStorage3DMultisample(GLenum target,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){CONTEXT();textureStorage(c,c->getBoundTexture(target),1,internalformat,width,height,depth,samples,fixedsamplelocations);}
+  void glTextureStorage1D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width){CONTEXT();textureStorage(c,c->getTexture(texture),levels,internalformat,width,1,1,0,GL_TRUE);}
+  void glTextureStorage2D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();textureStorage(c,c->getTexture(texture),levels,internalformat,width,height,1,0,GL_TRUE);}
+  void glTextureStorage3D(GLuint texture,GLsizei levels,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth){CONTEXT();textureStorage(c,c->getTexture(texture),levels,internalformat,width,height,depth,0,GL_TRUE);}
+  void glTextureStorage2DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLboolean fixedsamplelocations){CONTEXT();textureStorage(c,c->getTexture(texture),1,internalformat,width,height,1,samples,fixedsamplelocations);}
+  void glTextureStorage3DMultisample(GLuint texture,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height,GLsizei depth,GLboolean fixedsamplelocations){CONTEXT();textureStorage(c,c->getTexture(texture),1,internalformat,width,height,depth,samples,fixedsamplelocations);}
+  void glTexImage1D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLint,GLenum,GLenum,GLvoid const*){CONTEXT();textureImage(c,c->getBoundTexture(target),level,internalformat,width,1,1);}
+  void glTexImage2D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint,GLenum,GLenum,GLvoid const*){CONTEXT();textureImage(c,c->getBoundTexture(target),level,internalformat,width,height,1);}
+  void glTexImage3D(GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint,GLenum,GLenum,GLvoid const*){CONTEXT();textureImage(c,c->getBoundTexture(target),level,internalformat,width,height,depth);}
+  void glTextureImage1DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLint,GLenum,GLenum,void const*){
+    CONTEXT();
+    auto const t = c->getTexture(texture);
+    if(t && t->target == 0)t->target = getTextureTarget(target);
+    textureImage(c,t,level,internalformat,width,1,1);
+  }
+  void glTextureImage2DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLint,GLenum,GLenum,void const*){
+    CONTEXT();
+    auto const t = c->getTexture(texture);
+    if(t && t->target == 0)t->target = getTextureTarget(target);
+    textureImage(c,t,level,internalformat,width,height,1);
+  }
+  void glTextureImage3DEXT(GLuint texture,GLenum target,GLint level,GLint internalformat,GLsizei width,GLsizei height,GLsizei depth,GLint,GLenum,GLenum,void const*){
+    CONTEXT();
+    auto const t = c->getTexture(texture);
+    if(t && t->target == 0)t->target = getTextureTarget(target);
+    textureImage(c,t,level,internalformat,width,height,depth);
+  }
+  //texels are not stored, sub-image uploads only validate their target
+  bool isSubImage3DTarget(GLenum target){
+    return target == GL_TEXTURE_3D || target == GL_TEXTURE_2D_ARRAY || target == GL_TEXTURE_CUBE_MAP_ARRAY;
+  }
+  void glTexSubImage3D(GLenum target,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,GLvoid const*){
+    CONTEXT();
+    if(!isSubImage3DTarget(target))c->setError(GL_INVALID_ENUM);
+  }
+  void glTextureSubImage3DEXT(GLuint texture,GLenum target,GLint,GLint,GLint,GLint,GLsizei,GLsizei,GLsizei,GLenum,GLenum,void const*){
+    CONTEXT();
+    if(!c->getTexture(texture))return;
+    if(!isSubImage3DTarget(target))c->setError(GL_INVALID_ENUM);
+  }
+  void glGenerateMipmap       (GLenum target ){CONTEXT();generateMipmap(c,c->getBoundTexture(target ));}
+  void glGenerateTextureMipmap(GLuint texture){CONTEXT();generateMipmap(c,c->getTexture     (texture));}
+
+  void glTexParameteri     (GLenum target ,GLenum pname,GLint          param ){CONTEXT();setTextureParameterAs(c,getParameters(c->getBoundTexture(target )),pname,&param,1);}
+  void glTexParameterf     (GLenum target ,GLenum pname,GLfloat        param ){CONTEXT();setTextureParameterAs(c,getParameters(c->getBoundTexture(target )),pname,&param,1);}
+  void glTexParameteriv    (GLenum target ,GLenum pname,GLint   const*params){CONTEXT();setTextureParameterAs(c,getParameters(c->getBoundTexture(target )),pname,params);}
+  void glTexParameterfv    (GLenum target ,GLenum pname,GLfloat const*params){CONTEXT();setTextureParameterAs(c,getParameters(c->getBoundTexture(target )),pname,params);}
+  void glTextureParameteri (GLuint texture,GLenum pname,GLint          param ){CONTEXT();setTextureParameterAs(c,getParameters(c->getTexture     (texture)),pname,&param,1);}
+  void glTextureParameterf (GLuint texture,GLenum pname,GLfloat        param ){CONTEXT();setTextureParameterAs(c,getParameters(c->getTexture     (texture)),pname,&param,1);}
+  void glTextureParameteriv(GLuint texture,GLenum pname,GLint   const*params){CONTEXT();setTextureParameterAs(c,getParameters(c->getTexture     (texture)),pname,params);}
+  void glTextureParameterfv(GLuint texture,GLenum pname,GLfloat const*params){CONTEXT();setTextureParameterAs(c,getParameters(c->getTexture     (texture)),pname,params);}
+  void glGetTexParameteriv    (GLenum target ,GLenum pname,GLint  *params){CONTEXT();getTextureParameterAs(c,c->getBoundTexture(target ),pname,params);}
+  void glGetTexParameterfv    (GLenum target ,GLenum pname,GLfloat*params){CONTEXT();getTextureParameterAs(c,c->getBoundTexture(target ),pname,params);}
+  void glGetTextureParameteriv(GLuint texture,GLenum pname,GLint  *params){CONTEXT();getTextureParameterAs(c,c->getTexture     (texture),pname,params);}
+  void glGetTextureParameterfv(GLuint texture,GLenum pname,GLfloat*params){CONTEXT();getTextureParameterAs(c,c->getTexture     (texture),pname,params);}
+  void glGetTexLevelParameteriv    (GLenum target ,GLint level,GLenum pname,GLint*params){CONTEXT();getTextureLevelParameter(c,c->getBoundTexture(target ),level,pname,params);}
+  void glGetTextureLevelParameteriv(GLuint texture,GLint level,GLenum pname,GLint*params){CONTEXT();getTextureLevelParameter(c,c->getTexture     (texture),level,pname,params);}
+  void glGetTexLevelParameterfv(GLenum target,GLint level,GLenum pname,GLfloat*params){
+    GLint v = 0;
+    glGetTexLevelParameteriv(target,level,pname,&v);
+    *params = (GLfloat)v;
+  }
+  void glGetTextureLevelParameterfv(GLuint texture,GLint level,GLenum pname,GLfloat*params){
+    GLint v = 0;
+    glGetTextureLevelParameteriv(texture,level,pname,&v);
+    *params = (GLfloat)v;
+  }
+
+  NullContext::Parameters*getSamplerParameters(NullContext*c,GLuint sampler){
+    auto const s = c->samplers.get(sampler);
+    if(!s){
+      c->setError(GL_INVALID_OPERATION);
+      return nullptr;
+    }
+    return &s->parameters;
+  }
+
+  template<typename TYPE>
+    void getSamplerParameterAs(NullContext*c,GLuint sampler,GLenum pname,TYPE*data){
+      auto const parameters = getSamplerParameters(c,sampler);
+      if(!parameters)return;
+      GLfloat v[4];
+      auto const n = getParameter(*parameters,pname,v);
+      if(!n)c->setError(GL_INVALID_ENUM);
+      for(size_t i=0;i<n;++i)data[i] = (TYPE)v[i];
+    }
+
+  void glGenSamplers   (GLsizei n,GLuint*samplers){CONTEXT();genObjects(c->samplers,n,samplers);}
+  void glCreateSamplers(GLsizei n,GLuint*samplers){CONTEXT();genObjects(c->samplers,n,samplers);}
+  GLboolean glIsSampler(GLuint sampler){CONTEXT(GL_FALSE);return isObject(c->samplers,sampler);}
+  void glDeleteSamplers(GLsizei n,GLuint const*samplers){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i)
+      for(auto&b:c->samplerBindings)
+        if(b.second == samplers[i])b.second = 0;
+    deleteObjects(c->samplers,n,samplers);
+  }
+  void glBindSampler(GLuint unit,GLuint sampler){
+    CONTEXT();
+    if(sampler != 0 && !c->samplers.has(sampler)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->samplerBindings[unit] = sampler;
+  }
+  void glBindSamplers(GLuint first,GLsizei count,GLuint const*samplers){
+    for(GLsizei i=0;i<count;++i)glBindSampler(first+(GLuint)i,samplers?samplers[i]:0);
+  }
+  void glSamplerParameteri (GLuint sampler,GLenum pname,GLint          param ){CONTEXT();setTextureParameterAs(c,getSamplerParameters(c,sampler),pname,&param,1);}
+  void glSamplerParameterf (GLuint sampler,GLenum pname,GLfloat        param ){CONTEXT();setTextureParameterAs(c,getSamplerParameters(c,sampler),pname,&param,1);}
+  void glSamplerParameteriv(GLuint sampler,GLenum pname,GLint   const*params){CONTEXT();setTextureParameterAs(c,getSamplerParameters(c,sampler),pname,params);}
+  void glSamplerParameterfv(GLuint sampler,GLenum pname,GLfloat const*params){CONTEXT();setTextureParameterAs(c,getSamplerParameters(c,sampler),pname,params);}
+  void glGetSamplerParameteriv(GLuint sampler,GLenum pname,GLint  *params){CONTEXT();getSamplerParameterAs(c,sampler,pname,params);}
+  void glGetSamplerParameterfv(GLuint sampler,GLenum pname,GLfloat*params){CONTEXT();getSamplerParameterAs(c,sampler,pname,params);}
+
+  //vertex arrays
+
+  NullContext::VertexAttrib*getAttrib(NullContext*c,NullContext::VertexArray*vao,GLuint index){
+    if(!vao)return nullptr;
+    if(index >= NullContext::MAX_VERTEX_ATTRIBS){
+      c->setError(GL_INVALID_VALUE);
+      return nullptr;
+    }
+    return &vao->attribs[index];
+  }
+
+  NullContext::VertexBinding*getBinding(NullContext*c,NullContext::VertexArray*vao,GLuint index){
+    if(!vao)return nullptr;
+    if(index >= NullContext::MAX_VERTEX_ATTRIBS){
+      c->setError(GL_INVALID_VALUE);
+      return nullptr;
+    }
+    return &vao->bindings[index];
+  }
+
+  void attribFormat(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLint size,GLenum type,GLboolean normalized,GLuint relativeOffset,GLboolean integer,GLboolean long_){
+    auto const a = getAttrib(c,vao,index);
+    if(!a)return;
+    a->size           = size          ;
+    a->type           = type          ;
+    a->normalized     = normalized    ;
+    a->relativeOffset = relativeOffset;
+    a->integer        = integer       ;
+    a->long_          = long_         ;
+  }
+
+  void attribBinding(NullContext*c,NullContext::VertexArray*vao,GLuint attribIndex,GLuint bindingIndex){
+    auto const a = getAttrib(c,vao,attribIndex);
+    if(!a || !getBinding(c,vao,bindingIndex))return;
+    a->binding = bindingIndex;
+  }
+
+  void vertexBuffer(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLuint buffer,GLintptr offset,GLsizei stride){
+    auto const b = getBinding(c,vao,index);
+    if(!b)return;
+    if(buffer != 0 && !c->buffers.has(buffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    b->buffer = buffer;
+    b->offset = offset;
+    b->stride = stride;
+  }
+
+  void bindingDivisor(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLuint divisor){
+    auto const b = getBinding(c,vao,index);
+    if(b)b->divisor = divisor;
+  }
+
+  void enableAttrib(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLboolean enabled){
+    auto const a = getAttrib(c,vao,index);
+    if(a)a->enabled = enabled;
+  }
+
+  void attribPointer(GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,void const*pointer,GLboolean integer,GLboolean long_){
+    CONTEXT();
+    auto const vao = c->getVertexArray(c->vertexArrayBinding);
+    attribFormat  (c,vao,index,size,type,normalized,0,integer,long_);
+    attribBinding (c,vao,index,index);
+    vertexBuffer  (c,vao,index,c->bufferBindings[GL_ARRAY_BUFFER],(GLintptr)pointer,stride?stride:size*(GLsizei)getTypeSize(type));
+  }
+
+  bool getVertexAttrib(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLenum pname,GLint64*v){
+    auto const a = getAttrib(c,vao,index);
+    if(!a)return false;
+    auto const&b = vao->bindings[a->binding];
+    switch(pname){
+      case GL_VERTEX_ATTRIB_ARRAY_ENABLED       :*v = a->enabled       ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_SIZE          :*v = a->size          ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_TYPE          :*v = a->type          ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_NORMALIZED    :*v = a->normalized    ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_INTEGER       :*v = a->integer       ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_LONG          :*v = a->long_         ;return true;
+      case GL_VERTEX_ATTRIB_RELATIVE_OFFSET     :*v = a->relativeOffset;return true;
+      case GL_VERTEX_ATTRIB_BINDING             :*v = a->binding       ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_STRIDE        :*v = b.stride         ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_DIVISOR       :*v = b.divisor        ;return true;
+      case GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING:*v = b.buffer         ;return true;
+      case GL_VERTEX_BINDING_OFFSET             :*v = b.offset         ;return true;
+      default:
+        c->setError(GL_INVALID_ENUM);
+        return false;
+    }
+  }
+
+  template<typename TYPE>
+    void getVertexAttribAs(NullContext*c,NullContext::VertexArray*vao,GLuint index,GLenum pname,TYPE*params){
+      GLint64 v;
+      if(getVertexAttrib(c,vao,index,pname,&v))*params = (TYPE)v;
+    }
+
+  void glGenVertexArrays   (GLsizei n,GLuint*arrays){CONTEXT();genObjects(c->vertexArrays,n,arrays);}
+  void glCreateVertexArrays(GLsizei n,GLuint*arrays){CONTEXT();genObjects(c->vertexArrays,n,arrays);}
+  GLboolean glIsVertexArray(GLuint array){CONTEXT(GL_FALSE);return isObject(c->vertexArrays,array);}
+  void glDeleteVertexArrays(GLsizei n,GLuint const*arrays){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i)
+      if(arrays[i] == c->vertexArrayBinding)c->vertexArrayBinding = 0;
+    deleteObjects(c->vertexArrays,n,arrays);
+  }
+  void glBindVertexArray(GLuint array){
+    CONTEXT();
+    if(array != 0 && !c->vertexArrays.has(array)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->vertexArrayBinding = array;
+  }
+  void glVertexArrayElementBuffer(GLuint vaobj,GLuint buffer){
+    CONTEXT();
+    auto const vao = c->getVertexArray(vaobj);
+    if(!vao)return;
+    if(buffer != 0 && !c->buffers.has(buffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    vao->elementBuffer = buffer;
+  }
+  void glEnableVertexArrayAttrib (GLuint vaobj,GLuint index){CONTEXT();enableAttrib(c,c->getVertexArray(vaobj),index,GL_TRUE );}
+  void glDisableVertexArrayAttrib(GLuint vaobj,GLuint index){CONTEXT();enableAttrib(c,c->getVertexArray(vaobj),index,GL_FALSE);}
+  void glEnableVertexAttribArray (GLuint index){CONTEXT();enableAttrib(c,c->getVertexArray(c->vertexArrayBinding),index,GL_TRUE );}
+  void glDisableVertexAttribArray(GLuint index){CONTEXT();enableAttrib(c,c->getVertexArray(c->vertexArrayBinding),index,GL_FALSE);}
+  void glVertexArrayAttribFormat (GLuint vaobj,GLuint index,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(vaobj),index,size,type,normalized,relativeoffset,GL_FALSE,GL_FALSE);}
+  void glVertexArrayAttribIFormat(GLuint vaobj,GLuint index,GLint size,GLenum type,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(vaobj),index,size,type,GL_FALSE,relativeoffset,GL_TRUE,GL_FALSE);}
+  void glVertexArrayAttribLFormat(GLuint vaobj,GLuint index,GLint size,GLenum type,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(vaobj),index,size,type,GL_FALSE,relativeoffset,GL_FALSE,GL_TRUE);}
+  void glVertexAttribFormat (GLuint index,GLint size,GLenum type,GLboolean normalized,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(c->vertexArrayBinding),index,size,type,normalized,relativeoffset,GL_FALSE,GL_FALSE);}
+  void glVertexAttribIFormat(GLuint index,GLint size,GLenum type,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(c->vertexArrayBinding),index,size,type,GL_FALSE,relativeoffset,GL_TRUE,GL_FALSE);}
+  void glVertexAttribLFormat(GLuint index,GLint size,GLenum type,GLuint relativeoffset){CONTEXT();attribFormat(c,c->getVertexArray(c->vertexArrayBinding),index,size,type,GL_FALSE,relativeoffset,GL_FALSE,GL_TRUE);}
+  void glVertexArrayAttribBinding(GLuint vaobj,GLuint attribindex,GLuint bindingindex){CONTEXT();attribBinding(c,c->getVertexArray(vaobj),attribindex,bindingindex);}
+  void glVertexAttribBinding(GLuint attribindex,GLuint bindingindex){CONTEXT();attribBinding(c,c->getVertexArray(c->vertexArrayBinding),attribindex,bindingindex);}
+  void glVertexArrayVertexBuffer(GLuint vaobj,GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){CONTEXT();vertexBuffer(c,c->getVertexArray(vaobj),bindingindex,buffer,offset,stride);}
+  void glBindVertexBuffer(GLuint bindingindex,GLuint buffer,GLintptr offset,GLsizei stride){CONTEXT();vertexBuffer(c,c->getVertexArray(c->vertexArrayBinding),bindingindex,buffer,offset,stride);}
+  void glVertexArrayBindingDivisor(GLuint vaobj,GLuint bindingindex,GLuint divisor){CONTEXT();bindingDivisor(c,c->getVertexArray(vaobj),bindingindex,divisor);}
+  void glVertexBindingDivisor(GLuint bindingindex,GLuint divisor){CONTEXT();bindingDivisor(c,c->getVertexArray(c->vertexArrayBinding),bindingindex,divisor);}
+  void glVertexAttribDivisor(GLuint index,GLuint divisor){
+    CONTEXT();
+    auto const vao = c->getVertexArray(c->vertexArrayBinding);
+    attribBinding (c,vao,index,index  );
+    bindingDivisor(c,vao,index,divisor);
+  }
+  void glVertexAttribPointer (GLuint index,GLint size,GLenum type,GLboolean normalized,GLsizei stride,void const*pointer){attribPointer(index,size,type,normalized,stride,pointer,GL_FALSE,GL_FALSE);}
+  void glVertexAttribIPointer(GLuint index,GLint size,GLenum type,GLsizei stride,void const*pointer){attribPointer(index,size,type,GL_FALSE,stride,pointer,GL_TRUE,GL_FALSE);}
+  void glVertexAttribLPointer(GLuint index,GLint size,GLenum type,GLsizei stride,void const*pointer){attribPointer(index,size,type,GL_FALSE,stride,pointer,GL_FALSE,GL_TRUE);}
+  void glGetVertexArrayiv(GLuint vaobj,GLenum pname,GLint*param){
+    CONTEXT();
+    auto const vao = c->getVertexArray(vaobj);
+    if(!vao)return;
+    if(pname != GL_ELEMENT_ARRAY_BUFFER_BINDING){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    *param = (GLint)vao->elementBuffer;
+  }
+  void glGetVertexArrayIndexediv  (GLuint vaobj,GLuint index,GLenum pname,GLint  *param){CONTEXT();getVertexAttribAs(c,c->getVertexArray(vaobj),index,pname,param);}
+  void glGetVertexArrayIndexed64iv(GLuint vaobj,GLuint index,GLenum pname,GLint64*param){CONTEXT();getVertexAttribAs(c,c->getVertexArray(vaobj),index,pname,param);}
+  void glGetVertexAttribiv (GLuint index,GLenum pname,GLint  *params){CONTEXT();getVertexAttribAs(c,c->getVertexArray(c->vertexArrayBinding),index,pname,params);}
+  void glGetVertexAttribIiv(GLuint index,GLenum pname,GLint  *params){CONTEXT();getVertexAttribAs(c,c->getVertexArray(c->vertexArrayBinding),index,pname,params);}
+  void glGetVertexAttribIuiv(GLuint index,GLenum pname,GLuint*params){CONTEXT();getVertexAttribAs(c,c->getVertexArray(c->vertexArrayBinding),index,pname,params);}
+  void glGetVertexAttribfv (GLuint index,GLenum pname,GLfloat*params){CONTEXT();getVertexAttribAs(c,c->getVertexArray(c->vertexArrayBinding),index,pname,params);}
+
+  //shaders and programs
+
+  bool isShaderType(GLenum type){
+    switch(type){
+      case GL_VERTEX_SHADER         :
+      case GL_TESS_CONTROL_SHADER   :
+      case GL_TESS_EVALUATION_SHADER:
+      case GL_GEOMETRY_SHADER       :
+      case GL_FRAGMENT_SHADER       :
+      case GL_COMPUTE_SHADER        :return true;
+      default                       :return false;
+    }
+  }
+
+  void releaseShader(NullContext*c,GLuint shader){
+    auto const s = c->shaders.get(shader);
+    if(!s || !s->deleted)return;
+    for(auto const&p:c->programs.objects)
+      if(p.second.shaders.count(shader))return;
+    c->shaders.objects.erase(shader);
+  }
+
+  std::string getResourceName(NullContext::Variable const&v){
+    if(v.size > 1)return v.name+"[0]";
+    return v.name;
+  }
+
+  GLint getMaxNameLength(std::vector<NullContext::Variable>const&variables){
+    GLint result = 0;
+    for(auto const&v:variables)
+      result = std::max(result,(GLint)getResourceName(v).size()+1);
+    return result;
+  }
+
+  GLint getLocation(std::vector<NullContext::Variable>const&variables,std::string const&name){
+    static std::regex const indexing("^(\\w+)\\[(\\d+)\\]$");
+    std::smatch m;
+    std::string base = name;
+    GLint index = 0;
+    if(std::regex_match(name,m,indexing)){
+      base  = m[1];
+      index = std::stoi(m[2]);
+    }
+    for(auto const&v:variables){
+      if(v.name != base)continue;
+      if(index >= v.size)return -1;
+      return v.location+index;
+    }
+    return -1;
+  }
+
+  std::vector<NullContext::Variable>const*getInterfaceVariables(NullContext*c,NullContext::Program const*p,GLenum programInterface){
+    static std::vector<NullContext::Variable>const none;
+    switch(programInterface){
+      case GL_UNIFORM      :return &p->uniforms;
+      case GL_PROGRAM_INPUT:return &p->attribs ;
+      case GL_PROGRAM_OUTPUT:
+      case GL_UNIFORM_BLOCK:
+      case GL_SHADER_STORAGE_BLOCK:
+      case GL_BUFFER_VARIABLE:
+      case GL_ATOMIC_COUNTER_BUFFER:
+      case GL_TRANSFORM_FEEDBACK_VARYING:
+      case GL_TRANSFORM_FEEDBACK_BUFFER:
+      case GL_VERTEX_SUBROUTINE:
+      case GL_TESS_CONTROL_SUBROUTINE:
+      case GL_TESS_EVALUATION_SUBROUTINE:
+      case GL_GEOMETRY_SUBROUTINE:
+      case GL_FRAGMENT_SUBROUTINE:
+      case GL_COMPUTE_SUBROUTINE:
+      case GL_VERTEX_SUBROUTINE_UNIFORM:
+      case GL_TESS_CONTROL_SUBROUTINE_UNIFORM:
+      case GL_TESS_EVALUATION_SUBROUTINE_UNIFORM:
+      case GL_GEOMETRY_SUBROUTINE_UNIFORM:
+      case GL_FRAGMENT_SUBROUTINE_UNIFORM:
+      case GL_COMPUTE_SUBROUTINE_UNIFORM:return &none;
+      default:
+        c->setError(GL_INVALID_ENUM);
+        return nullptr;
+    }
+  }
+
+  GLint getResourceProperty(NullContext::Variable const&v,GLenum property){
+    switch(property){
+      case GL_NAME_LENGTH               :return (GLint)getResourceName(v).size()+1;
+      case GL_TYPE                      :return (GLint)v.type;
+      case GL_ARRAY_SIZE                :return v.size;
+      case GL_LOCATION                  :return v.location;
+      case GL_BLOCK_INDEX               :return v.block;
+      case GL_OFFSET                    :return v.offset;
+      case GL_ARRAY_STRIDE              :return v.arrayStride;
+      case GL_MATRIX_STRIDE             :return v.matrixStride;
+      case GL_IS_ROW_MAJOR              :return v.rowMajor;
+      case GL_ATOMIC_COUNTER_BUFFER_INDEX:return -1;
+      default                           :return 0;
+    }
+  }
+
+  GLint getMaxNameLength(std::vector<NullContext::UniformBlock>const&blocks){
+    GLint result = 0;
+    for(auto const&b:blocks)
+      result = std::max(result,(GLint)b.name.size()+1);
+    return result;
+  }
+
+  /**
+   * @brief Writes properties of uniform block, GL_ACTIVE_VARIABLES writes indices of all members.
+   */
+  void getUniformBlockProperties(NullContext::UniformBlock const&b,GLsizei propCount,GLenum const*props,GLsizei bufSize,GLsizei*length,GLint*params){
+    GLsizei n = 0;
+    for(GLsizei i=0;i<propCount && n<bufSize;++i){
+      switch(props[i]){
+        case GL_NAME_LENGTH          :params[n++] = (GLint)b.name.size()+1      ;break;
+        case GL_BUFFER_BINDING       :params[n++] = b.binding                   ;break;
+        case GL_BUFFER_DATA_SIZE     :params[n++] = b.dataSize                  ;break;
+        case GL_NUM_ACTIVE_VARIABLES :params[n++] = (GLint)b.variables.size()   ;break;
+        case GL_ACTIVE_VARIABLES     :
+          for(size_t v=0;v<b.variables.size() && n<bufSize;++v)params[n++] = b.variables[v];
+          break;
+        default                      :params[n++] = 0                           ;break;
+      }
+    }
+    if(length)*length = n;
+  }
+
+  GLuint glCreateShader(GLenum type){
+    CONTEXT(0);
+    if(!isShaderType(type)){
+      c->setError(GL_INVALID_ENUM);
+      return 0;
+    }
+    auto const name = ++c->shaderProgramNames;
+    c->shaders.objects[name].type = type;
+    return name;
+  }
+  void glDeleteShader(GLuint shader){
+    CONTEXT();
+    if(shader == 0)return;
+    auto const s = c->getShader(shader);
+    if(!s)return;
+    s->deleted = true;
+    releaseShader(c,shader);
+  }
+  GLboolean glIsShader(GLuint shader){CONTEXT(GL_FALSE);return isObject(c->shaders,shader);}
+  void glShaderSource(GLuint shader,GLsizei count,GLchar const*const*string,GLint const*length){
+    CONTEXT();
+    auto const s = c->getShader(shader);
+    if(!s)return;
+    if(count < 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    s->source = "";
+    for(GLsizei i=0;i<count;++i){
+      if(length && length[i] >= 0)s->source += std::string(string[i],(size_t)length[i]);
+      else                        s->source += string[i];
+    }
+  }
+  void glCompileShader(GLuint shader){
+    CONTEXT();
+    auto const s = c->getShader(shader);
+    if(s)s->compiled = true;
+  }
+  void glGetShaderiv(GLuint shader,GLenum pname,GLint*params){
+    CONTEXT();
+    auto const s = c->getShader(shader);
+    if(!s)return;
+    switch(pname){
+      case GL_SHADER_TYPE         :*params = (GLint)s->type;return;
+      case GL_DELETE_STATUS       :*params = s->deleted    ;return;
+      case GL_COMPILE_STATUS      :*params = s->compiled   ;return;
+      case GL_INFO_LOG_LENGTH     :*params = 0             ;return;
+      case GL_SHADER_SOURCE_LENGTH:*params = s->source.empty()?0:(GLint)s->source.size()+1;return;
+      case GL_COMPLETION_STATUS_KHR:*params = GL_TRUE      ;return;
+      default                     :c->setError(GL_INVALID_ENUM);return;
+    }
+  }
+  void glGetShaderSource(GLuint shader,GLsizei bufSize,GLsizei*length,GLchar*source){
+    CONTEXT();
+    auto const s = c->getShader(shader);
+    if(s)copyString(s->source,bufSize,length,source);
+  }
+  void glGetShaderInfoLog(GLuint shader,GLsizei bufSize,GLsizei*length,GLchar*infoLog){
+    CONTEXT();
+    if(c->getShader(shader))copyString("",bufSize,length,infoLog);
+  }
+
+  GLuint glCreateProgram(){
+    CONTEXT(0);
+    auto const name = ++c->shaderProgramNames;
+    c->programs.objects[name];
+    return name;
+  }
+  void glDeleteProgram(GLuint program){
+    CONTEXT();
+    if(program == 0)return;
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    auto const shaders = p->shaders;
+    c->programs.objects.erase(program);
+    for(auto const&s:shaders)releaseShader(c,s);
+  }
+  GLboolean glIsProgram(GLuint program){CONTEXT(GL_FALSE);return isObject(c->programs,program);}
+  void glAttachShader(GLuint program,GLuint shader){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p || !c->getShader(shader))return;
+    if(p->shaders.count(shader)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    p->shaders.insert(shader);
+  }
+  void glDetachShader(GLuint program,GLuint shader){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p || !c->getShader(shader))return;
+    if(!p->shaders.erase(shader)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    releaseShader(c,shader);
+  }
+  void glBindAttribLocation(GLuint program,GLuint index,GLchar const*name){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)p->attribBindings[name] = index;
+  }
+  void glLinkProgram(GLuint program){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)c->link(*p);
+  }
+  void glValidateProgram(GLuint program){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)p->validated = p->linked;
+  }
+  void glUseProgram(GLuint program){
+    CONTEXT();
+    if(program != 0){
+      auto const p = c->getProgram(program);
+      if(!p)return;
+      if(!p->linked){
+        c->setError(GL_INVALID_OPERATION);
+        return;
+      }
+    }
+    c->currentProgram = program;
+  }
+  void glGetProgramiv(GLuint program,GLenum pname,GLint*params){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    switch(pname){
+      case GL_DELETE_STATUS             :*params = p->deleted                              ;return;
+      case GL_LINK_STATUS               :*params = p->linked                               ;return;
+      case GL_VALIDATE_STATUS           :*params = p->validated                            ;return;
+      case GL_INFO_LOG_LENGTH           :*params = p->infoLog.empty()?0:(GLint)p->infoLog.size()+1;return;
+      case GL_ATTACHED_SHADERS          :*params = (GLint)p->shaders.size()                ;return;
+      case GL_ACTIVE_UNIFORMS           :*params = (GLint)p->uniforms.size()               ;return;
+      case GL_ACTIVE_UNIFORM_MAX_LENGTH :*params = getMaxNameLength(p->uniforms)           ;return;
+      case GL_ACTIVE_ATTRIBUTES         :*params = (GLint)p->attribs.size()                ;return;
+      case GL_ACTIVE_UNIFORM_BLOCKS     :*params = (GLint)p->uniformBlocks.size()          ;return;
+      case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:*params = getMaxNameLength(p->attribs)           ;return;
+      case GL_COMPLETION_STATUS_KHR     :*params = GL_TRUE                                 ;return;
+      case GL_PROGRAM_BINARY_LENGTH     :*params = p->linked?(GLint)c->getProgramBinary(*p).size():0;return;
+      case GL_COMPUTE_WORK_GROUP_SIZE   :
+        if(p->workGroupSize[0] == 0){
+          c->setError(GL_INVALID_OPERATION);
+          return;
+        }
+        std::copy(p->workGroupSize.begin(),p->workGroupSize.end(),params);
+        return;
+      default                           :*params = 0;return;
+    }
+  }
+  void glGetProgramInfoLog(GLuint program,GLsizei bufSize,GLsizei*length,GLchar*infoLog){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)copyString(p->infoLog,bufSize,length,infoLog);
+  }
+  void glGetProgramBinary(GLuint program,GLsizei bufSize,GLsizei*length,GLenum*binaryFormat,void*binary){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(length)*length = 0;
+    if(!p)return;
+    auto const data = c->getProgramBinary(*p);
+    if(!p->linked || bufSize < (GLsizei)data.size()){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    std::memcpy(binary,data.data(),data.size());
+    *binaryFormat = NullContext::PROGRAM_BINARY_FORMAT;
+    if(length)*length = (GLsizei)data.size();
+  }
+  void glProgramBinary(GLuint program,GLenum binaryFormat,void const*binary,GLsizei length){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    if(binaryFormat != NullContext::PROGRAM_BINARY_FORMAT){
+      c->setError(GL_INVALID_ENUM);
+      return;
+    }
+    if(length < 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    c->setProgramBinary(*p,std::string((char const*)binary,(size_t)length));
+  }
+  void getActiveVariable(NullContext*c,std::vector<NullContext::Variable>const&variables,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    if(index >= variables.size()){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    auto const&v = variables[index];
+    *size = v.size;
+    *type = v.type;
+    copyString(getResourceName(v),bufSize,length,name);
+  }
+  void glGetActiveUniform(GLuint program,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)getActiveVariable(c,p->uniforms,index,bufSize,length,size,type,name);
+  }
+  void glGetActiveAttrib(GLuint program,GLuint index,GLsizei bufSize,GLsizei*length,GLint*size,GLenum*type,GLchar*name){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(p)getActiveVariable(c,p->attribs,index,bufSize,length,size,type,name);
+  }
+  GLint glGetUniformLocation(GLuint program,GLchar const*name){
+    CONTEXT(-1);
+    auto const p = c->getProgram(program);
+    if(!p)return -1;
+    return getLocation(p->uniforms,name);
+  }
+  GLint glGetAttribLocation(GLuint program,GLchar const*name){
+    CONTEXT(-1);
+    auto const p = c->getProgram(program);
+    if(!p)return -1;
+    return getLocation(p->attribs,name);
+  }
+  void glGetProgramInterfaceiv(GLuint program,GLenum programInterface,GLenum pname,GLint*params){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    if(programInterface == GL_UNIFORM_BLOCK){
+      switch(pname){
+        case GL_ACTIVE_RESOURCES        :*params = (GLint)p->uniformBlocks.size();return;
+        case GL_MAX_NAME_LENGTH         :*params = getMaxNameLength(p->uniformBlocks);return;
+        case GL_MAX_NUM_ACTIVE_VARIABLES:
+          *params = 0;
+          for(auto const&b:p->uniformBlocks)*params = std::max(*params,(GLint)b.variables.size());
+          return;
+        default                         :*params = 0;return;
+      }
+    }
+    auto const variables = getInterfaceVariables(c,p,programInterface);
+    if(!variables)return;
+    switch(pname){
+      case GL_ACTIVE_RESOURCES:*params = (GLint)variables->size();return;
+      case GL_MAX_NAME_LENGTH :*params = getMaxNameLength(*variables);return;
+      default                 :*params = 0;return;
+    }
+  }
+  void glGetProgramResourceiv(GLuint program,GLenum programInterface,GLuint index,GLsizei propCount,GLenum const*props,GLsizei bufSize,GLsizei*length,GLint*params){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    if(programInterface == GL_UNIFORM_BLOCK){
+      if(index >= p->uniformBlocks.size()){
+        c->setError(GL_INVALID_VALUE);
+        return;
+      }
+      getUniformBlockProperties(p->uniformBlocks[index],propCount,props,bufSize,length,params);
+      return;
+    }
+    auto const variables = getInterfaceVariables(c,p,programInterface);
+    if(!variables)return;
+    if(index >= variables->size()){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    auto const n = std::min(propCount,bufSize);
+    for(GLsizei i=0;i<n;++i)params[i] = getResourceProperty((*variables)[index],props[i]);
+    if(length)*length = std::max(n,0);
+  }
+  void glGetProgramResourceName(GLuint program,GLenum programInterface,GLuint index,GLsizei bufSize,GLsizei*length,GLchar*name){
+    CONTEXT();
+    auto const p = c->getProgram(program);
+    if(!p)return;
+    if(programInterface == GL_UNIFORM_BLOCK){
+      if(index >= p->uniformBlocks.size()){
+        c->setError(GL_INVALID_VALUE);
+        return;
+      }
+      copyString(p->uniformBlocks[index].name,bufSize,length,name);
+      return;
+    }
+    auto const variables = getInterfaceVariables(c,p,programInterface);
+    if(!variables)return;
+    if(index >= variables->size()){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    copyString(getResourceName((*variables)[index]),bufSize,length,name);
+  }
+  GLuint glGetProgramResourceIndex(GLuint program,GLenum programInterface,GLchar const*name){
+    CONTEXT(GL_INVALID_INDEX);
+    auto const p = c->getProgram(program);
+    if(!p)return GL_INVALID_INDEX;
+    if(programInterface == GL_UNIFORM_BLOCK){
+      for(size_t i=0;i<p->uniformBlocks.size();++i)
+        if(p->uniformBlocks[i].name == name)return (GLuint)i;
+      return GL_INVALID_INDEX;
+    }
+    auto const variables = getInterfaceVariables(c,p,programInterface);
+    if(!variables)return GL_INVALID_INDEX;
+    for(size_t i=0;i<variables->size();++i)
+      if((*variables)[i].name == name || getResourceName((*variables)[i]) == name)return (GLuint)i;
+    return GL_INVALID_INDEX;
+  }
+  GLint glGetProgramResourceLocation(GLuint program,GLenum programInterface,GLchar const*name){
+    CONTEXT(-1);
+    auto const p = c->getProgram(program);
+    if(!p)return -1;
+    auto const variables = getInterfaceVariables(c,p,programInterface);
+    if(!variables)return -1;
+    return getLocation(*variables,name);
+  }
+
+  //framebuffers and renderbuffers
+
+  GLuint*getFramebufferBinding(NullContext*c,GLenum target){
+    switch(target){
+      case GL_FRAMEBUFFER     :
+      case GL_DRAW_FRAMEBUFFER:return &c->drawFramebuffer;
+      case GL_READ_FRAMEBUFFER:return &c->readFramebuffer;
+      default:
+        c->setError(GL_INVALID_ENUM);
+        return nullptr;
+    }
+  }
+
+  NullContext::Framebuffer*getBoundFramebuffer(NullContext*c,GLenum target){
+    auto const binding = getFramebufferBinding(c,target);
+    if(!binding)return nullptr;
+    return c->getFramebuffer(*binding);
+  }
+
+  void attach(NullContext*c,NullContext::Framebuffer*f,GLenum attachment,GLenum type,GLuint name,GLint level,GLint layer){
+    if(!f)return;
+    if(name == 0){
+      f->attachments.erase(attachment);
+      return;
+    }
+    if(( type == GL_TEXTURE      && !c->textures     .has(name))||
+       ( type == GL_RENDERBUFFER && !c->renderbuffers.has(name))){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    auto&a = f->attachments[attachment];
+    a.type  = type ;
+    a.name  = name ;
+    a.level = level;
+    a.layer = layer;
+  }
+
+  void getAttachmentParameter(NullContext::Framebuffer*f,GLenum attachment,GLenum pname,GLint*params){
+    if(!f)return;
+    NullContext::Attachment a;
+    auto const it = f->attachments.find(attachment);
+    if(it != f->attachments.end())a = it->second;
+    switch(pname){
+      case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE   :*params = (GLint)a.type;return;
+      case GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME   :*params = (GLint)a.name;return;
+      case GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LEVEL :*params = a.level      ;return;
+      case GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LAYER :*params = a.layer      ;return;
+      default                                      :*params = 0            ;return;
+    }
+  }
+
+  void glGenFramebuffers   (GLsizei n,GLuint*framebuffers){CONTEXT();genObjects(c->framebuffers,n,framebuffers);}
+  void glCreateFramebuffers(GLsizei n,GLuint*framebuffers){CONTEXT();genObjects(c->framebuffers,n,framebuffers);}
+  GLboolean glIsFramebuffer(GLuint framebuffer){CONTEXT(GL_FALSE);return isObject(c->framebuffers,framebuffer);}
+  void glDeleteFramebuffers(GLsizei n,GLuint const*framebuffers){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i){
+      if(c->drawFramebuffer == framebuffers[i])c->drawFramebuffer = 0;
+      if(c->readFramebuffer == framebuffers[i])c->readFramebuffer = 0;
+    }
+    deleteObjects(c->framebuffers,n,framebuffers);
+  }
+  void glBindFramebuffer(GLenum target,GLuint framebuffer){
+    CONTEXT();
+    if(framebuffer != 0 && !c->framebuffers.has(framebuffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    if(target == GL_FRAMEBUFFER){
+      c->drawFramebuffer = c->readFramebuffer = framebuffer;
+      return;
+    }
+    auto const binding = getFramebufferBinding(c,target);
+    if(binding)*binding = framebuffer;
+  }
+  GLenum glCheckFramebufferStatus     (GLenum       ){return GL_FRAMEBUFFER_COMPLETE;}
+  GLenum glCheckNamedFramebufferStatus(GLuint,GLenum){return GL_FRAMEBUFFER_COMPLETE;}
+  void glNamedFramebufferTexture(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level){CONTEXT();attach(c,c->getFramebuffer(framebuffer),attachment,GL_TEXTURE,texture,level,0);}
+  void glNamedFramebufferTextureLayer(GLuint framebuffer,GLenum attachment,GLuint texture,GLint level,GLint layer){CONTEXT();attach(c,c->getFramebuffer(framebuffer),attachment,GL_TEXTURE,texture,level,layer);}
+  void glNamedFramebufferRenderbuffer(GLuint framebuffer,GLenum attachment,GLenum,GLuint renderbuffer){CONTEXT();attach(c,c->getFramebuffer(framebuffer),attachment,GL_RENDERBUFFER,renderbuffer,0,0);}
+  void glFramebufferTexture(GLenum target,GLenum attachment,GLuint texture,GLint level){CONTEXT();attach(c,getBoundFramebuffer(c,target),attachment,GL_TEXTURE,texture,level,0);}
+  void glFramebufferTexture2D(GLenum target,GLenum attachment,GLenum,GLuint texture,GLint level){CONTEXT();attach(c,getBoundFramebuffer(c,target),attachment,GL_TEXTURE,texture,level,0);}
+  void glFramebufferTextureLayer(GLenum target,GLenum attachment,GLuint texture,GLint level,GLint layer){CONTEXT();attach(c,getBoundFramebuffer(c,target),attachment,GL_TEXTURE,texture,level,layer);}
+  void glFramebufferRenderbuffer(GLenum target,GLenum attachment,GLenum,GLuint renderbuffer){CONTEXT();attach(c,getBoundFramebuffer(c,target),attachment,GL_RENDERBUFFER,renderbuffer,0,0);}
+  void glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,GLenum attachment,GLenum pname,GLint*params){CONTEXT();getAttachmentParameter(c->getFramebuffer(framebuffer),attachment,pname,params);}
+  void glGetFramebufferAttachmentParameteriv(GLenum target,GLenum attachment,GLenum pname,GLint*params){CONTEXT();getAttachmentParameter(getBoundFramebuffer(c,target),attachment,pname,params);}
+  void glNamedFramebufferParameteri(GLuint framebuffer,GLenum pname,GLint param){
+    CONTEXT();
+    auto const f = c->getFramebuffer(framebuffer);
+    if(f)f->parameters[pname] = param;
+  }
+  void glGetNamedFramebufferParameteriv(GLuint framebuffer,GLenum pname,GLint*param){
+    CONTEXT();
+    auto const f = c->getFramebuffer(framebuffer);
+    if(!f)return;
+    auto const it = f->parameters.find(pname);
+    *param = it == f->parameters.end()?0:it->second;
+  }
+
+  void renderbufferStorage(NullContext*c,NullContext::Renderbuffer*r,GLsizei samples,GLenum internalFormat,GLsizei width,GLsizei height){
+    if(!r)return;
+    if(width < 0 || height < 0 || samples < 0){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    r->samples        = samples       ;
+    r->internalFormat = internalFormat;
+    r->width          = width         ;
+    r->height         = height        ;
+  }
+
+  void getRenderbufferParameter(NullContext*c,NullContext::Renderbuffer*r,GLenum pname,GLint*params){
+    if(!r)return;
+    switch(pname){
+      case GL_RENDERBUFFER_WIDTH          :*params = r->width ;return;
+      case GL_RENDERBUFFER_HEIGHT         :*params = r->height;return;
+      case GL_RENDERBUFFER_SAMPLES        :*params = r->samples;return;
+      case GL_RENDERBUFFER_INTERNAL_FORMAT:*params = (GLint)r->internalFormat;return;
+      case GL_RENDERBUFFER_RED_SIZE       :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_RED_SIZE    ,params);return;
+      case GL_RENDERBUFFER_GREEN_SIZE     :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_GREEN_SIZE  ,params);return;
+      case GL_RENDERBUFFER_BLUE_SIZE      :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_BLUE_SIZE   ,params);return;
+      case GL_RENDERBUFFER_ALPHA_SIZE     :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_ALPHA_SIZE  ,params);return;
+      case GL_RENDERBUFFER_DEPTH_SIZE     :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_DEPTH_SIZE  ,params);return;
+      case GL_RENDERBUFFER_STENCIL_SIZE   :getInternalFormatParameter(r->internalFormat,GL_TEXTURE_STENCIL_SIZE,params);return;
+      default                             :c->setError(GL_INVALID_ENUM);return;
+    }
+  }
+
+  void glGenRenderbuffers   (GLsizei n,GLuint*renderbuffers){CONTEXT();genObjects(c->renderbuffers,n,renderbuffers);}
+  void glCreateRenderbuffers(GLsizei n,GLuint*renderbuffers){CONTEXT();genObjects(c->renderbuffers,n,renderbuffers);}
+  GLboolean glIsRenderbuffer(GLuint renderbuffer){CONTEXT(GL_FALSE);return isObject(c->renderbuffers,renderbuffer);}
+  void glDeleteRenderbuffers(GLsizei n,GLuint const*renderbuffers){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i)
+      if(c->renderbufferBinding == renderbuffers[i])c->renderbufferBinding = 0;
+    deleteObjects(c->renderbuffers,n,renderbuffers);
+  }
+  void glBindRenderbuffer(GLenum,GLuint renderbuffer){
+    CONTEXT();
+    if(renderbuffer != 0 && !c->renderbuffers.has(renderbuffer)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->renderbufferBinding = renderbuffer;
+  }
+  void glNamedRenderbufferStorage(GLuint renderbuffer,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();renderbufferStorage(c,c->getRenderbuffer(renderbuffer),0,internalformat,width,height);}
+  void glNamedRenderbufferStorageMultisample(GLuint renderbuffer,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();renderbufferStorage(c,c->getRenderbuffer(renderbuffer),samples,internalformat,width,height);}
+  void glRenderbufferStorage(GLenum,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();renderbufferStorage(c,c->getRenderbuffer(c->renderbufferBinding),0,internalformat,width,height);}
+  void glRenderbufferStorageMultisample(GLenum,GLsizei samples,GLenum internalformat,GLsizei width,GLsizei height){CONTEXT();renderbufferStorage(c,c->getRenderbuffer(c->renderbufferBinding),samples,internalformat,width,height);}
+  void glGetNamedRenderbufferParameteriv(GLuint renderbuffer,GLenum pname,GLint*params){CONTEXT();getRenderbufferParameter(c,c->getRenderbuffer(renderbuffer),pname,params);}
+  void glGetRenderbufferParameteriv(GLenum,GLenum pname,GLint*params){CONTEXT();getRenderbufferParameter(c,c->getRenderbuffer(c->renderbufferBinding),pname,params);}
+
+  //queries, program pipelines and syncs
+
+  template<typename TYPE>
+    void getQueryObject(GLuint id,GLenum pname,TYPE*params){
+      CONTEXT();
+      if(!c->queries.has(id)){
+        c->setError(GL_INVALID_OPERATION);
+        return;
+      }
+      switch(pname){
+        case GL_QUERY_RESULT_AVAILABLE:*params = 1;return;
+        case GL_QUERY_RESULT          :
+        case GL_QUERY_RESULT_NO_WAIT  :*params = 0;return;
+        case GL_QUERY_TARGET          :*params = (TYPE)c->queries.get(id)->target;return;
+        default                       :c->setError(GL_INVALID_ENUM);return;
+      }
+    }
+
+  void glGenQueries(GLsizei n,GLuint*ids){CONTEXT();genObjects(c->queries,n,ids);}
+  void glCreateQueries(GLenum target,GLsizei n,GLuint*ids){
+    CONTEXT();
+    genObjects(c->queries,n,ids);
+    for(GLsizei i=0;i<n;++i)c->queries.get(ids[i])->target = target;
+  }
+  GLboolean glIsQuery(GLuint id){CONTEXT(GL_FALSE);return isObject(c->queries,id);}
+  void glDeleteQueries(GLsizei n,GLuint const*ids){CONTEXT();deleteObjects(c->queries,n,ids);}
+  void glBeginQueryIndexed(GLenum target,GLuint,GLuint id){
+    CONTEXT();
+    auto const q = c->queries.get(id);
+    if(!q){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    q->target = target;
+  }
+  void glBeginQuery(GLenum target,GLuint id){glBeginQueryIndexed(target,0,id);}
+  void glQueryCounter(GLuint id,GLenum target){glBeginQueryIndexed(target,0,id);}
+  void glGetQueryObjectiv   (GLuint id,GLenum pname,GLint   *params){getQueryObject(id,pname,params);}
+  void glGetQueryObjectuiv  (GLuint id,GLenum pname,GLuint  *params){getQueryObject(id,pname,params);}
+  void glGetQueryObjecti64v (GLuint id,GLenum pname,GLint64 *params){getQueryObject(id,pname,params);}
+  void glGetQueryObjectui64v(GLuint id,GLenum pname,GLuint64*params){getQueryObject(id,pname,params);}
+  void glGetQueryiv(GLenum,GLenum pname,GLint*params){
+    CONTEXT();
+    switch(pname){
+      case GL_QUERY_COUNTER_BITS:*params = 64;return;
+      case GL_CURRENT_QUERY     :*params = 0 ;return;
+      default                   :c->setError(GL_INVALID_ENUM);return;
+    }
+  }
+
+  void glGenProgramPipelines   (GLsizei n,GLuint*pipelines){CONTEXT();genObjects(c->pipelines,n,pipelines);}
+  void glCreateProgramPipelines(GLsizei n,GLuint*pipelines){CONTEXT();genObjects(c->pipelines,n,pipelines);}
+  GLboolean glIsProgramPipeline(GLuint pipeline){CONTEXT(GL_FALSE);return isObject(c->pipelines,pipeline);}
+  void glDeleteProgramPipelines(GLsizei n,GLuint const*pipelines){
+    CONTEXT();
+    for(GLsizei i=0;i<n;++i)
+      if(c->pipelineBinding == pipelines[i])c->pipelineBinding = 0;
+    deleteObjects(c->pipelines,n,pipelines);
+  }
+  void glBindProgramPipeline(GLuint pipeline){
+    CONTEXT();
+    if(pipeline != 0 && !c->pipelines.has(pipeline)){
+      c->setError(GL_INVALID_OPERATION);
+      return;
+    }
+    c->pipelineBinding = pipeline;
+  }
+
+  GLuint syncName(GLsync sync){return (GLuint)(uintptr_t)sync;}
+
+  GLsync glFenceSync(GLenum condition,GLbitfield flags){
+    CONTEXT(nullptr);
+    if(condition != GL_SYNC_GPU_COMMANDS_COMPLETE || flags != 0){
+      c->setError(condition != GL_SYNC_GPU_COMMANDS_COMPLETE?GL_INVALID_ENUM:GL_INVALID_VALUE);
+      return nullptr;
+    }
+    return (GLsync)(uintptr_t)c->syncs.create();
+  }
+  GLboolean glIsSync(GLsync sync){CONTEXT(GL_FALSE);return isObject(c->syncs,syncName(sync));}
+  void glDeleteSync(GLsync sync){
+    CONTEXT();
+    if(sync == nullptr)return;
+    if(!c->syncs.objects.erase(syncName(sync)))c->setError(GL_INVALID_VALUE);
+  }
+  GLenum glClientWaitSync(GLsync sync,GLbitfield,GLuint64){
+    CONTEXT(GL_WAIT_FAILED);
+    if(!c->syncs.has(syncName(sync))){
+      c->setError(GL_INVALID_VALUE);
+      return GL_WAIT_FAILED;
+    }
+    return GL_ALREADY_SIGNALED;
+  }
+  void glWaitSync(GLsync sync,GLbitfield,GLuint64){
+    CONTEXT();
+    if(!c->syncs.has(syncName(sync)))c->setError(GL_INVALID_VALUE);
+  }
+  void glGetSynciv(GLsync sync,GLenum pname,GLsizei bufSize,GLsizei*length,GLint*values){
+    CONTEXT();
+    if(!c->syncs.has(syncName(sync))){
+      c->setError(GL_INVALID_VALUE);
+      return;
+    }
+    GLint value = 0;
+    switch(pname){
+      case GL_OBJECT_TYPE   :value = GL_SYNC_FENCE                ;break;
+      case GL_SYNC_STATUS   :value = GL_SIGNALED                  ;break;
+      case GL_SYNC_CONDITION:value = GL_SYNC_GPU_COMMANDS_COMPLETE;break;
+      case GL_SYNC_FLAGS    :value = 0                            ;break;
+      default               :c->setError(GL_INVALID_ENUM);return;
+    }
+    if(bufSize > 0)values[0] = value;
+    if(length)*length = bufSize > 0?1:0;
+  }
+
+#undef CONTEXT
+
+  template<typename>struct FreeFunction;
+  template<typename RETURN,typename CLASS,typename...ARGS>
+    struct FreeFunction<RETURN(CLASS::*)(ARGS...)const>{
+      using type = RETURN(*)(ARGS...);
+    };
+
+  //entry points are checked against signatures of FunctionTable
+#define NULL_FUNCTION(name)\
+  {#name,(FUNCTION_POINTER)static_cast<FreeFunction<decltype(&FunctionTable::name)>::type>(&name)}
+
+  std::map<std::string,FUNCTION_POINTER>const&getFunctions(){
+    static std::map<std::string,FUNCTION_POINTER>const functions = {
+      NULL_FUNCTION(glGetError),
+      NULL_FUNCTION(glGetString),
+      NULL_FUNCTION(glGetStringi),
+      NULL_FUNCTION(glGetIntegerv),
+      NULL_FUNCTION(glGetInteger64v),
+      NULL_FUNCTION(glGetFloatv),
+      NULL_FUNCTION(glGetDoublev),
+      NULL_FUNCTION(glGetBooleanv),
+      NULL_FUNCTION(glGetIntegeri_v),
+      NULL_FUNCTION(glGetInteger64i_v),
+      NULL_FUNCTION(glEnable),
+      NULL_FUNCTION(glDisable),
+      NULL_FUNCTION(glIsEnabled),
+      NULL_FUNCTION(glEnablei),
+      NULL_FUNCTION(glDisablei),
+      NULL_FUNCTION(glIsEnabledi),
+      NULL_FUNCTION(glPixelStorei),
+      NULL_FUNCTION(glPixelStoref),
+      NULL_FUNCTION(glViewport),
+      NULL_FUNCTION(glScissor),
+
+      NULL_FUNCTION(glGenBuffers),
+      NULL_FUNCTION(glCreateBuffers),
+      NULL_FUNCTION(glIsBuffer),
+      NULL_FUNCTION(glDeleteBuffers),
+      NULL_FUNCTION(glBindBuffer),
+      NULL_FUNCTION(glBindBufferRange),
+      NULL_FUNCTION(glBindBufferBase),
+      NULL_FUNCTION(glBindBuffersRange),
+      NULL_FUNCTION(glBindBuffersBase),
+      NULL_FUNCTION(glNamedBufferData),
+      NULL_FUNCTION(glBufferData),
+      NULL_FUNCTION(glNamedBufferStorage),
+      NULL_FUNCTION(glBufferStorage),
+      NULL_FUNCTION(glNamedBufferSubData),
+      NULL_FUNCTION(glBufferSubData),
+      NULL_FUNCTION(glGetNamedBufferSubData),
+      NULL_FUNCTION(glGetBufferSubData),
+      NULL_FUNCTION(glCopyNamedBufferSubData),
+      NULL_FUNCTION(glCopyBufferSubData),
+      NULL_FUNCTION(glClearNamedBufferSubData),
+      NULL_FUNCTION(glClearBufferSubData),
+      NULL_FUNCTION(glClearNamedBufferData),
+      NULL_FUNCTION(glClearBufferData),
+      NULL_FUNCTION(glMapNamedBufferRange),
+      NULL_FUNCTION(glMapBufferRange),
+      NULL_FUNCTION(glMapNamedBuffer),
+      NULL_FUNCTION(glMapBuffer),
+      NULL_FUNCTION(glUnmapNamedBuffer),
+      NULL_FUNCTION(glUnmapBuffer),
+      NULL_FUNCTION(glGetNamedBufferParameteriv),
+      NULL_FUNCTION(glGetNamedBufferParameteri64v),
+      NULL_FUNCTION(glGetBufferParameteriv),
+      NULL_FUNCTION(glGetBufferParameteri64v),
+      NULL_FUNCTION(glGetNamedBufferPointerv),
+      NULL_FUNCTION(glGetBufferPointerv),
+
+      NULL_FUNCTION(glGenTextures),
+      NULL_FUNCTION(glCreateTextures),
+      NULL_FUNCTION(glIsTexture),
+      NULL_FUNCTION(glDeleteTextures),
+      NULL_FUNCTION(glActiveTexture),
+      NULL_FUNCTION(glBindTexture),
+      NULL_FUNCTION(glBindTextureUnit),
+      NULL_FUNCTION(glBindTextures),
+      NULL_FUNCTION(glTexStorage1D),
+      NULL_FUNCTION(glTexStorage2D),
+      NULL_FUNCTION(glTexStorage3D),
+      NULL_FUNCTION(glTexStorage2DMultisample),
+      NULL_FUNCTION(glTexStorage3DMultisample),
+      NULL_FUNCTION(glTextureStorage1D),
+      NULL_FUNCTION(glTextureStorage2D),
+      NULL_FUNCTION(glTextureStorage3D),
+      NULL_FUNCTION(glTextureStorage2DMultisample),
+      NULL_FUNCTION(glTextureStorage3DMultisample),
+      NULL_FUNCTION(glTexImage1D),
+      NULL_FUNCTION(glTexImage2D),
+      NULL_FUNCTION(glTexImage3D),
+      NULL_FUNCTION(glTextureImage1DEXT),
+      NULL_FUNCTION(glTextureImage2DEXT),
+      NULL_FUNCTION(glTextureImage3DEXT),
+      NULL_FUNCTION(glTexSubImage3D),
+      NULL_FUNCTION(glTextureSubImage3DEXT),
+      NULL_FUNCTION(glGenerateMipmap),
+      NULL_FUNCTION(glGenerateTextureMipmap),
+      NULL_FUNCTION(glTexParameteri),
+      NULL_FUNCTION(glTexParameterf),
+      NULL_FUNCTION(glTexParameteriv),
+      NULL_FUNCTION(glTexParameterfv),
+      NULL_FUNCTION(glTextureParameteri),
+      NULL_FUNCTION(glTextureParameterf),
+      NULL_FUNCTION(glTextureParameteriv),
+      NULL_FUNCTION(glTextureParameterfv),
+      NULL_FUNCTION(glGetTexParameteriv),
+      NULL_FUNCTION(glGetTexParameterfv),
+      NULL_FUNCTION(glGetTextureParameteriv),
+      NULL_FUNCTION(glGetTextureParameterfv),
+      NULL_FUNCTION(glGetTexLevelParameteriv),
+      NULL_FUNCTION(glGetTexLevelParameterfv),
+      NULL_FUNCTION(glGetTextureLevelParameteriv),
+      NULL_FUNCTION(glGetTextureLevelParameterfv),
+      NULL_FUNCTION(glGenSamplers),
+      NULL_FUNCTION(glCreateSamplers),
+      NULL_FUNCTION(glIsSampler),
+      NULL_FUNCTION(glDeleteSamplers),
+      NULL_FUNCTION(glBindSampler),
+      NULL_FUNCTION(glBindSamplers),
+      NULL_FUNCTION(glSamplerParameteri),
+      NULL_FUNCTION(glSamplerParameterf),
+      NULL_FUNCTION(glSamplerParameteriv),
+      NULL_FUNCTION(glSamplerParameterfv),
+      NULL_FUNCTION(glGetSamplerParameteriv),
+      NULL_FUNCTION(glGetSamplerParameterfv),
+
+      NULL_FUNCTION(glGenVertexArrays),
+      NULL_FUNCTION(glCreateVertexArrays),
+      NULL_FUNCTION(glIsVertexArray),
+      NULL_FUNCTION(glDeleteVertexArrays),
+      NULL_FUNCTION(glBindVertexArray),
+      NULL_FUNCTION(glVertexArrayElementBuffer),
+      NULL_FUNCTION(glEnableVertexArrayAttrib),
+      NULL_FUNCTION(glDisableVertexArrayAttrib),
+      NULL_FUNCTION(glEnableVertexAttribArray),
+      NULL_FUNCTION(glDisableVertexAttribArray),
+      NULL_FUNCTION(glVertexArrayAttribFormat),
+      NULL_FUNCTION(glVertexArrayAttribIFormat),
+      NULL_FUNCTION(glVertexArrayAttribLFormat),
+      NULL_FUNCTION(glVertexAttribFormat),
+      NULL_FUNCTION(glVertexAttribIFormat),
+      NULL_FUNCTION(glVertexAttribLFormat),
+      NULL_FUNCTION(glVertexArrayAttribBinding),
+      NULL_FUNCTION(glVertexAttribBinding),
+      NULL_FUNCTION(glVertexArrayVertexBuffer),
+      NULL_FUNCTION(glBindVertexBuffer),
+      NULL_FUNCTION(glVertexArrayBindingDivisor),
+      NULL_FUNCTION(glVertexBindingDivisor),
+      NULL_FUNCTION(glVertexAttribDivisor),
+      NULL_FUNCTION(glVertexAttribPointer),
+      NULL_FUNCTION(glVertexAttribIPointer),
+      NULL_FUNCTION(glVertexAttribLPointer),
+      NULL_FUNCTION(glGetVertexArrayiv),
+      NULL_FUNCTION(glGetVertexArrayIndexediv),
+      NULL_FUNCTION(glGetVertexArrayIndexed64iv),
+      NULL_FUNCTION(glGetVertexAttribiv),
+      NULL_FUNCTION(glGetVertexAttribIiv),
+      NULL_FUNCTION(glGetVertexAttribIuiv),
+      NULL_FUNCTION(glGetVertexAttribfv),
+
+      NULL_FUNCTION(glCreateShader),
+      NULL_FUNCTION(glDeleteShader),
+      NULL_FUNCTION(glIsShader),
+      NULL_FUNCTION(glShaderSource),
+      NULL_FUNCTION(glCompileShader),
+      NULL_FUNCTION(glGetShaderiv),
+      NULL_FUNCTION(glGetShaderSource),
+      NULL_FUNCTION(glGetShaderInfoLog),
+      NULL_FUNCTION(glCreateProgram),
+      NULL_FUNCTION(glDeleteProgram),
+      NULL_FUNCTION(glIsProgram),
+      NULL_FUNCTION(glAttachShader),
+      NULL_FUNCTION(glDetachShader),
+      NULL_FUNCTION(glBindAttribLocation),
+      NULL_FUNCTION(glLinkProgram),
+      NULL_FUNCTION(glValidateProgram),
+      NULL_FUNCTION(glUseProgram),
+      NULL_FUNCTION(glGetProgramiv),
+      NULL_FUNCTION(glGetProgramInfoLog),
+      NULL_FUNCTION(glGetProgramBinary),
+      NULL_FUNCTION(glProgramBinary),
+      NULL_FUNCTION(glGetActiveUniform),
+      NULL_FUNCTION(glGetActiveAttrib),
+      NULL_FUNCTION(glGetUniformLocation),
+      NULL_FUNCTION(glGetAttribLocation),
+      NULL_FUNCTION(glGetProgramInterfaceiv),
+      NULL_FUNCTION(glGetProgramResourceiv),
+      NULL_FUNCTION(glGetProgramResourceName),
+      NULL_FUNCTION(glGetProgramResourceIndex),
+      NULL_FUNCTION(glGetProgramResourceLocation),
+
+      NULL_FUNCTION(glGenFramebuffers),
+      NULL_FUNCTION(glCreateFramebuffers),
+      NULL_FUNCTION(glIsFramebuffer),
+      NULL_FUNCTION(glDeleteFramebuffers),
+      NULL_FUNCTION(glBindFramebuffer),
+      NULL_FUNCTION(glCheckFramebufferStatus),
+      NULL_FUNCTION(glCheckNamedFramebufferStatus),
+      NULL_FUNCTION(glNamedFramebufferTexture),
+      NULL_FUNCTION(glNamedFramebufferTextureLayer),
+      NULL_FUNCTION(glNamedFramebufferRenderbuffer),
+      NULL_FUNCTION(glFramebufferTexture),
+      NULL_FUNCTION(glFramebufferTexture2D),
+      NULL_FUNCTION(glFramebufferTextureLayer),
+      NULL_FUNCTION(glFramebufferRenderbuffer),
+      NULL_FUNCTION(glGetNamedFramebufferAttachmentParameteriv),
+      NULL_FUNCTION(glGetFramebufferAttachmentParameteriv),
+      NULL_FUNCTION(glNamedFramebufferParameteri),
+      NULL_FUNCTION(glGetNamedFramebufferParameteriv),
+      NULL_FUNCTION(glGenRenderbuffers),
+      NULL_FUNCTION(glCreateRenderbuffers),
+      NULL_FUNCTION(glIsRenderbuffer),
+      NULL_FUNCTION(glDeleteRenderbuffers),
+      NULL_FUNCTION(glBindRenderbuffer),
+      NULL_FUNCTION(glNamedRenderbufferStorage),
+      NULL_FUNCTION(glNamedRenderbufferStorageMultisample),
+      NULL_FUNCTION(glRenderbufferStorage),
+      NULL_FUNCTION(glRenderbufferStorageMultisample),
+      NULL_FUNCTION(glGetNamedRenderbufferParameteriv),
+      NULL_FUNCTION(glGetRenderbufferParameteriv),
+
+      NULL_FUNCTION(glGenQueries),
+      NULL_FUNCTION(glCreateQueries),
+      NULL_FUNCTION(glIsQuery),
+      NULL_FUNCTION(glDeleteQueries),
+      NULL_FUNCTION(glBeginQueryIndexed),
+      NULL_FUNCTION(glBeginQuery),
+      NULL_FUNCTION(glQueryCounter),
+      NULL_FUNCTION(glGetQueryObjectiv),
+      NULL_FUNCTION(glGetQueryObjectuiv),
+      NULL_FUNCTION(glGetQueryObjecti64v),
+      NULL_FUNCTION(glGetQueryObjectui64v),
+      NULL_FUNCTION(glGetQueryiv),
+      NULL_FUNCTION(glGenProgramPipelines),
+      NULL_FUNCTION(glCreateProgramPipelines),
+      NULL_FUNCTION(glIsProgramPipeline),
+      NULL_FUNCTION(glDeleteProgramPipelines),
+      NULL_FUNCTION(glBindProgramPipeline),
+      NULL_FUNCTION(glFenceSync),
+      NULL_FUNCTION(glIsSync),
+      NULL_FUNCTION(glDeleteSync),
+      NULL_FUNCTION(glClientWaitSync),
+      NULL_FUNCTION(glWaitSync),
+      NULL_FUNCTION(glGetSynciv),
+    };
+    return functions;
+  }
+
+#undef NULL_FUNCTION
+}
+
+/**
+ * @brief returns entry point implemented on top of object model
+ *
+ * @param fceName name of OpenGL function
+ *
+ * @return function pointer or nullptr if function is not modelled
+ */
+FUNCTION_POINTER NullContext::getFunction(char const*fceName){
+  auto const&functions = getFunctions();
+  auto const it = functions.find(fceName);
+  if(it == functions.end())return nullptr;
+  return it->second;
+}
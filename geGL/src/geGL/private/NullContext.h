@@ -0,0 +1,213 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/FunctionLoaderInterface.h>
+#include<array>
+#include<map>
+#include<memory>
+#include<set>
+#include<string>
+#include<vector>
+
+namespace ge{
+  namespace gl{
+    /**
+     * @brief CPU-side model of OpenGL context used by NullFunctionLoader.
+     * It allocates object names, keeps buffer data in host memory,
+     * remembers texture levels and parameters, vertex array setup,
+     * shader sources and bindings.
+     * Linked programs are reflected from shader sources
+     * (default block uniforms, vertex inputs and compute work group size).
+     * Program binaries are serialized reflection of linked programs.
+     * GL_KHR_parallel_shader_compile is exposed, compilation is always complete.
+     * Nothing is ever rendered.
+     */
+    class NullContext{
+      public:
+        NullContext();
+        ~NullContext();
+        static NullContext*&current();
+        static FUNCTION_POINTER getFunction(char const*fceName);
+
+        struct Buffer{
+          std::unique_ptr<uint8_t,void(*)(void*)>data = {nullptr,free};
+          GLsizeiptr size      = 0              ;
+          GLenum     usage     = GL_STATIC_DRAW ;
+          GLbitfield flags     = 0              ;
+          bool       immutable = false          ;
+          bool       mapped    = false          ;
+          GLbitfield access    = 0              ;
+          GLintptr   mapOffset = 0              ;
+          GLsizeiptr mapLength = 0              ;
+        };
+        struct TextureLevel{
+          GLsizei width                = 0     ;
+          GLsizei height               = 0     ;
+          GLsizei depth                = 0     ;
+          GLenum  internalFormat       = GL_RGBA;
+          GLsizei samples              = 0     ;
+          GLint   fixedSampleLocations = GL_TRUE;
+        };
+        using Parameters = std::map<GLenum,std::array<GLfloat,4>>;
+        struct Texture{
+          GLenum                   target          = 0    ;
+          std::vector<TextureLevel>levels                 ;
+          Parameters               parameters             ;
+          bool                     immutable       = false;
+          GLint                    immutableLevels = 0    ;
+        };
+        struct Sampler{
+          Parameters parameters;
+        };
+        struct VertexAttrib{
+          GLboolean enabled        = GL_FALSE;
+          GLint     size           = 4       ;
+          GLenum    type           = GL_FLOAT;
+          GLboolean normalized     = GL_FALSE;
+          GLboolean integer        = GL_FALSE;
+          GLboolean long_          = GL_FALSE;
+          GLuint    relativeOffset = 0       ;
+          GLuint    binding        = 0       ;
+        };
+        struct VertexBinding{
+          GLuint   buffer  = 0;
+          GLintptr offset  = 0;
+          GLsizei  stride  = 16;
+          GLuint   divisor = 0;
+        };
+        enum{MAX_VERTEX_ATTRIBS = 16};
+        enum{PROGRAM_BINARY_FORMAT = 0x6E756C6C};///< the only program binary format
+        struct VertexArray{
+          std::array<VertexAttrib ,MAX_VERTEX_ATTRIBS>attribs      ;
+          std::array<VertexBinding,MAX_VERTEX_ATTRIBS>bindings     ;
+          GLuint                                      elementBuffer = 0;
+          VertexArray();
+        };
+        struct Shader{
+          GLenum      type     = 0    ;
+          std::string source          ;
+          bool        compiled = false;
+          bool        deleted  = false;
+        };
+        struct Variable{
+          std::string name              ;
+          GLenum      type              ;
+          GLint       size              ;
+          GLint       location          ;
+          GLint       block        = -1 ;///< index of uniform block, -1 for default block
+          GLint       offset       = -1 ;
+          GLint       arrayStride  = -1 ;
+          GLint       matrixStride = -1 ;
+          GLint       rowMajor     = 0  ;
+        };
+        struct UniformBlock{
+          std::string       name     ;
+          GLint             binding  ;
+          GLint             dataSize ;
+          std::vector<GLint>variables;///< indices of members in uniforms
+        };
+        struct Program{
+          std::set<GLuint>              shaders                    ;
+          std::map<std::string,GLuint>  attribBindings             ;
+          std::vector<Variable>         uniforms                   ;
+          std::vector<UniformBlock>     uniformBlocks              ;
+          std::vector<Variable>         attribs                    ;
+          std::array<GLint,3>           workGroupSize = {{0,0,0}}  ;
+          std::string                   infoLog                    ;
+          bool                          linked        = false      ;
+          bool                          validated     = false      ;
+          bool                          deleted       = false      ;
+        };
+        struct Attachment{
+          GLenum type  = GL_NONE;
+          GLuint name  = 0      ;
+          GLint  level = 0      ;
+          GLint  layer = 0      ;
+        };
+        struct Framebuffer{
+          std::map<GLenum,Attachment>attachments;
+          std::map<GLenum,GLint     >parameters ;
+        };
+        struct Renderbuffer{
+          GLsizei width          = 0      ;
+          GLsizei height         = 0      ;
+          GLenum  internalFormat = GL_RGBA;
+          GLsizei samples        = 0      ;
+        };
+        struct Query{
+          GLenum target = 0;
+        };
+        struct IndexedBinding{
+          GLuint     buffer = 0;
+          GLintptr   offset = 0;
+          GLsizeiptr size   = 0;
+        };
+
+        /**
+         * @brief Name space of one kind of objects.
+         * Names start at 1, 0 is reserved for default object.
+         */
+        template<typename OBJECT>
+          struct Objects{
+            std::map<GLuint,OBJECT>objects;
+            GLuint                 counter = 0;
+            GLuint create(){
+              objects[++counter];
+              return counter;
+            }
+            OBJECT*get(GLuint name){
+              auto const it = objects.find(name);
+              if(it == objects.end())return nullptr;
+              return &it->second;
+            }
+            bool has(GLuint name)const{return objects.count(name) != 0;}
+          };
+
+        Objects<Buffer      >buffers      ;
+        Objects<Texture     >textures     ;
+        Objects<Sampler     >samplers     ;
+        Objects<VertexArray >vertexArrays ;
+        Objects<Shader      >shaders      ;
+        Objects<Program     >programs     ;
+        Objects<Framebuffer >framebuffers ;
+        Objects<Renderbuffer>renderbuffers;
+        Objects<Query       >queries      ;
+        Objects<char        >pipelines    ;
+        Objects<char        >syncs        ;
+
+        GLenum                                     error               = GL_NO_ERROR ;
+        std::map<GLenum,GLuint>                    bufferBindings                    ;
+        std::map<std::pair<GLenum,GLuint>,IndexedBinding>indexedBufferBindings       ;
+        GLuint                                     activeTexture       = 0           ;
+        std::map<std::pair<GLuint,GLenum>,GLuint>  textureBindings                   ;
+        std::map<GLuint,GLuint>                    samplerBindings                   ;
+        GLuint                                     vertexArrayBinding  = 0           ;
+        GLuint                                     currentProgram      = 0           ;
+        GLuint                                     drawFramebuffer     = 0           ;
+        GLuint                                     readFramebuffer     = 0           ;
+        GLuint                                     renderbufferBinding = 0           ;
+        GLuint                                     pipelineBinding     = 0           ;
+        std::set<GLenum>                           enabled                           ;
+        std::set<std::pair<GLenum,GLuint>>         enabledIndexed                    ;
+        std::map<GLenum,GLint>                     pixelStore                        ;
+        std::array<GLint,4>                        viewport            = {{0,0,1,1}} ;
+        std::array<GLint,4>                        scissorBox          = {{0,0,1,1}} ;
+        GLuint                                     shaderProgramNames  = 0           ;
+        VertexArray                                defaultVertexArray                ;
+
+        void          setError(GLenum e);
+        Buffer*       getBuffer     (GLuint name  );
+        Buffer*       getBoundBuffer(GLenum target);
+        Texture*      getTexture     (GLuint name  );
+        Texture*      getBoundTexture(GLenum target);
+        VertexArray*  getVertexArray (GLuint name  );
+        Program*      getProgram     (GLuint name  );
+        Shader*       getShader      (GLuint name  );
+        Framebuffer*  getFramebuffer (GLuint name  );
+        Renderbuffer* getRenderbuffer(GLuint name  );
+        void          link(Program&program);
+        std::string   getProgramBinary(Program const&program);
+        bool          setProgramBinary(Program&program,std::string const&binary);
+    };
+  }
+}
@@ -3,6 +3,7 @@
 #include<memory>
 #include<set>
 #include<map>
+#include<vector>
 #include<geGL/ProgramInfo.h>
 
 class ge::gl::ProgramImpl {
@@ -11,4 +12,20 @@ public:
   std::set<ShaderPointer>shaders;
   std::map<std::string, GLint>name2Uniform;
   std::shared_ptr<ProgramInfo>info;
+  bool infoPending = false;///< linkAsync was called, info is not filled yet
+  /**
+   * @brief CPU copy of uniform at one location
+   */
+  struct UniformShadow{
+    size_t offset      = 0;///< offset of values in shadowData
+    size_t elementSize = 0;///< size of one array element in bytes, 0 - location is not shadowed
+    size_t element     = 0;///< index of element in shadowValid
+    size_t nofElements = 0;///< number of elements from this location to end of array
+  };
+  bool                      shadowUniforms        = false;
+  std::vector<UniformShadow>uniformShadows        ;///< indexed by location
+  std::vector<uint8_t>      shadowData            ;
+  std::vector<uint8_t>      shadowValid           ;///< shadowData of element was uploaded
+  size_t                    issuedUniformUpdates  = 0;
+  size_t                    skippedUniformUpdates = 0;
 };
\ No newline at end of file
@@ -26,6 +26,12 @@ GLint VertexArrayImpl::getAttrib(GLuint index,GLenum pname)const{
   vao->getContext().glGetVertexArrayIndexediv(vao->getId(),index,pname,&param);
   return param;
 }
+
+GLintptr VertexArrayImpl::getBindingOffset(GLuint index)const{
+  GLint64 param;
+  vao->getContext().glGetVertexArrayIndexed64iv(vao->getId(),index,GL_VERTEX_BINDING_OFFSET,&param);
+  return (GLintptr)param;
+}
   
 void VertexArrayImpl::addElementBuffer(Buffer*buffer){
   removeReferenceFromElementBufferIfItIsOnlyReference();
@@ -9,6 +9,7 @@ public:
   ~VertexArrayImpl();
   size_t getNofBufferUsages(Buffer const* buffer) const;
   GLint  getAttrib(GLuint index, GLenum pname) const;
+  GLintptr getBindingOffset(GLuint index) const;
   void   addElementBuffer(Buffer*buffer);
   void   removeReferencesFromBuffers();
   void   removeReferenceFromElementBuffer();
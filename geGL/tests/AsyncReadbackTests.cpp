@@ -0,0 +1,108 @@
+#include<catch.hpp>
+#include<BusyGPULoader.h>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<chrono>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  template<typename T>
+  bool isReady(future<T>const&f){
+    return f.wait_for(chrono::seconds(0)) == future_status::ready;
+  }
+}
+
+TEST_CASE("AsyncReadback fulfils futures from pump"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  vector<uint32_t>data(64);
+  for(size_t i=0;i<data.size();++i)data[i] = (uint32_t)i;
+  Buffer buffer(table,data);
+
+  AsyncReadback readback(table);
+  auto whole = readback.read(buffer);
+  auto part  = readback.read(buffer,4*sizeof(uint32_t),8*sizeof(uint32_t));
+  REQUIRE(readback.getNofPending() == 2);
+  REQUIRE(!isReady(whole));
+
+  REQUIRE(readback.pump() == 2);
+  REQUIRE(readback.getNofPending() == 0);
+  REQUIRE(isReady(whole));
+  REQUIRE(isReady(part));
+  auto const w = whole.get();
+  auto const p = part .get();
+  REQUIRE(w.size() == data.size()*sizeof(uint32_t));
+  REQUIRE(reinterpret_cast<uint32_t const*>(w.data())[63] == 63);
+  REQUIRE(p.size() == 4*sizeof(uint32_t));
+  REQUIRE(reinterpret_cast<uint32_t const*>(p.data())[0] == 8);
+  REQUIRE(reinterpret_cast<uint32_t const*>(p.data())[3] == 11);
+  REQUIRE_THROWS(readback.read(buffer,4,data.size()*sizeof(uint32_t)));
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("AsyncReadback reuses pooled staging buffers"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  Buffer buffer(table,1024);
+  AsyncReadback readback(table);
+  for(size_t frame=0;frame<10;++frame){
+    auto result = readback.read(buffer,256);
+    readback.pump();
+    REQUIRE(result.get().size() == 256);
+  }
+  auto const&s = readback.getStatistics();
+  REQUIRE(s.requests           == 10);
+  REQUIRE(s.completed          == 10);
+  REQUIRE(s.stagingAllocations == 1);
+  REQUIRE(s.stagingReuses      == 9);
+  REQUIRE(s.bytesRead          == 10*256);
+  REQUIRE(readback.getNofPooledBuffers() == 1);
+
+  readback.read(buffer,1024);
+  readback.pump();
+  REQUIRE(s.stagingAllocations == 2);
+  REQUIRE(readback.getNofPooledBuffers() == 2);
+  readback.releasePool();
+  REQUIRE(readback.getNofPooledBuffers() == 0);
+}
+
+TEST_CASE("AsyncReadback reads textures through pixel pack buffer"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  Texture texture(table,GL_TEXTURE_2D,GL_RGBA8,1,8,4);
+  AsyncReadback readback(table);
+  auto result = readback.readTexture(texture);
+  GLint binding = -1;
+  table->glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING,&binding);
+  REQUIRE(binding == 0);
+  GLint alignment = 0;
+  table->glGetIntegerv(GL_PACK_ALIGNMENT,&alignment);
+  REQUIRE(alignment == 4);
+  readback.finish();
+  REQUIRE(result.get().size() == 8*4*4);
+}
+
+TEST_CASE("AsyncReadback reads all faces of cube map"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  Texture texture(table,GL_TEXTURE_CUBE_MAP,GL_RGBA8,1,8,8);
+  AsyncReadback readback(table);
+  auto result = readback.readTexture(texture);
+  readback.finish();
+  REQUIRE(result.get().size() == 8*8*4*6);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("AsyncReadback pump does not block on busy GPU"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  Buffer buffer(table,256);
+  AsyncReadback readback(table);
+  auto result = readback.read(buffer);
+  for(int i=0;i<3;++i)REQUIRE(readback.pump() == 0);
+  REQUIRE(!isReady(result));
+  REQUIRE(readback.getNofPending() == 1);
+  readback.finish();
+  REQUIRE(readback.getNofPending() == 0);
+  REQUIRE(isReady(result));
+  REQUIRE(result.get().size() == 256);
+}
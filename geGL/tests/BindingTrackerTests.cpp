@@ -0,0 +1,57 @@
+#include<catch.hpp>
+#include<RecordingLoader.h>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+
+using namespace ge::gl;
+using namespace std;
+
+size_t nofGets(){
+  return RecordingLoader::count("glGetIntegerv") + RecordingLoader::count("glGetIntegeri_v");
+}
+
+TEST_CASE("Emulated DSA buffer calls do not query bindings"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>());
+
+  float data[4] = {};
+  table->glBindBuffer(GL_COPY_WRITE_BUFFER,7);
+  table->glNamedBufferSubData(1,0,sizeof(data),data);
+  REQUIRE(RecordingLoader::boundBuffers()[GL_COPY_WRITE_BUFFER] == 7);
+  REQUIRE(nofGets() == 0);
+
+  for(GLuint i=0;i<10;++i)
+    table->glNamedBufferSubData(i+1,0,sizeof(data),data);
+  REQUIRE(RecordingLoader::count("glBufferSubData") == 11);
+  REQUIRE(RecordingLoader::boundBuffers()[GL_COPY_WRITE_BUFFER] == 7);
+  REQUIRE(nofGets() == 0);
+}
+
+TEST_CASE("Emulated DSA queries unknown binding once"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>());
+
+  float data[4] = {};
+  table->glNamedBufferSubData(1,0,sizeof(data),data);
+  REQUIRE(nofGets() == 1);
+  table->glNamedBufferSubData(2,0,sizeof(data),data);
+  REQUIRE(nofGets() == 1);
+
+  invalidateStateCache(table);
+  table->glNamedBufferSubData(3,0,sizeof(data),data);
+  REQUIRE(nofGets() == 2);
+}
+
+TEST_CASE("Emulated DSA texture calls do not query bindings"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>());
+
+  table->glActiveTexture(GL_TEXTURE0);
+  table->glBindTexture(GL_TEXTURE_2D,0);
+  GLuint id;
+  table->glCreateTextures(GL_TEXTURE_2D,1,&id);
+  for(int i=0;i<10;++i)
+    table->glTextureParameteri(id,GL_TEXTURE_MIN_FILTER,GL_LINEAR);
+  REQUIRE(RecordingLoader::count("glTexParameteri") == 10);
+  REQUIRE(nofGets() == 0);
+}
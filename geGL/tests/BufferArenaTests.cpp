@@ -0,0 +1,132 @@
+#include<catch.hpp>
+#include<TestContext.h>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLContext.h>
+#include<geGL/RangeAllocator.h>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("RangeAllocator aligns and reuses best fitting ranges"){
+  RangeAllocator a(256);
+  auto const r0 = a.allocate(10);
+  auto const r1 = a.allocate(16,16);
+  auto const r2 = a.allocate(100);
+  REQUIRE(r0 == 0);
+  REQUIRE(r1 == 16);
+  REQUIRE(r2 == 32);
+  REQUIRE(a.getUsed() == 126);
+  REQUIRE(a.allocate(200) == RangeAllocator::INVALID);
+
+  a.free(r1);
+  REQUIRE(a.allocate(8,8) == 16);
+  REQUIRE(a.getStatistics().nofFreeRanges == 3);
+  REQUIRE_THROWS_AS(a.free(17),std::invalid_argument);
+  REQUIRE_THROWS_AS(a.allocate(0),std::invalid_argument);
+
+  a.free(16);
+  a.free(r0);
+  a.free(r2);
+  auto const s = a.getStatistics();
+  REQUIRE(s.nofAllocations   == 0);
+  REQUIRE(s.nofFreeRanges    == 1);
+  REQUIRE(s.largestFreeRange == 256);
+  REQUIRE(s.peakUsed         == 126);
+  REQUIRE(s.fragmentation    == 0.f);
+}
+
+TEST_CASE("RangeAllocator compacts allocations and grows"){
+  RangeAllocator a(64);
+  vector<size_t>r;
+  for(size_t i=0;i<8;++i)r.push_back(a.allocate(8));
+  REQUIRE(a.allocate(1) == RangeAllocator::INVALID);
+  a.free(r[0]);
+  a.free(r[2]);
+  a.free(r[5]);
+  REQUIRE(a.getStatistics().fragmentation > 0.f);
+  REQUIRE(a.allocate(16) == RangeAllocator::INVALID);
+
+  auto const moves = a.compact();
+  REQUIRE(moves.size() == 5);
+  REQUIRE(moves[0].from == 8 );
+  REQUIRE(moves[0].to   == 0 );
+  REQUIRE(moves[4].from == 56);
+  REQUIRE(moves[4].to   == 32);
+  for(auto const&m:moves)REQUIRE(a.getAllocationSize(m.to) == 8);
+  auto const s = a.getStatistics();
+  REQUIRE(s.nofFreeRanges    == 1 );
+  REQUIRE(s.largestFreeRange == 24);
+  REQUIRE(s.fragmentation    == 0.f);
+
+  REQUIRE(a.allocate(32) == RangeAllocator::INVALID);
+  a.grow(128);
+  REQUIRE(a.allocate(32) == 40);
+}
+
+TEST_CASE("BufferArena shares buffers among allocations"){
+  TestContext context;
+  BufferArena arena(1024);
+  vector<BufferSuballocation>allocations;
+  for(int i=0;i<20;++i){
+    float const data[4] = {(float)i,(float)i,(float)i,(float)i};
+    allocations.push_back(arena.allocate(sizeof(data),16,data));
+  }
+  REQUIRE(arena.getNofBuffers() == 1);
+  REQUIRE(allocations[3].buffer == allocations[0].buffer);
+  REQUIRE(allocations[3].offset == 48);
+
+  auto const big = arena.allocate(4096);
+  REQUIRE(arena.getNofBuffers() == 2);
+  REQUIRE(big.buffer->getSize() == 4096);
+
+  VertexArray vao;
+  vao.addAttrib(allocations[5],0,4,GL_FLOAT);
+  REQUIRE(vao.getBuffer(0) == allocations[5].buffer);
+  GLint64 bindingOffset = 0;
+  vao.getContext().glGetVertexArrayIndexed64iv(vao.getId(),0,GL_VERTEX_BINDING_OFFSET,&bindingOffset);
+  REQUIRE(bindingOffset == allocations[5].offset);
+
+  for(size_t i=0;i<allocations.size();i+=2)arena.free(allocations[i]);
+  arena.free(big);
+  REQUIRE(arena.releaseEmptyBuffers() == 1);
+
+  vector<pair<GLintptr,GLintptr>>moves;
+  auto const moved = arena.defragment([&](BufferSuballocation const&from,BufferSuballocation const&to){
+    moves.emplace_back(from.offset,to.offset);
+  });
+  REQUIRE(moved == 10);
+  REQUIRE(moves.size() == 10);
+  REQUIRE(moves[0] == make_pair(GLintptr(16),GLintptr(0)));
+  REQUIRE(moves[1] == make_pair(GLintptr(48),GLintptr(16)));
+  for(size_t i=0;i<moves.size();++i){
+    float read[4] = {};
+    allocations[0].buffer->getData(read,sizeof(read),moves[i].second);
+    REQUIRE(read[0] == (float)(2*i+1));
+    REQUIRE(read[3] == (float)(2*i+1));
+  }
+
+  auto const s = arena.getStatistics();
+  REQUIRE(s.nofBuffers       == 1);
+  REQUIRE(s.nofAllocations   == 10);
+  REQUIRE(s.used             == 160);
+  REQUIRE(s.largestFreeRange == 1024-160);
+  REQUIRE(s.nofMoves         == 10);
+  REQUIRE(s.movedBytes       == 160);
+  REQUIRE(vao.getContext().glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("BufferArena defragments overlapping ranges"){
+  TestContext context;
+  BufferArena arena(256);
+  uint8_t data[64];
+  for(size_t i=0;i<sizeof(data);++i)data[i] = (uint8_t)i;
+  auto const gap  = arena.allocate(8);
+  auto const tail = arena.allocate(sizeof(data),1,data);
+  arena.free(gap);
+  REQUIRE(arena.defragment() == 1);
+  uint8_t read[sizeof(data)] = {};
+  tail.buffer->getData(read,sizeof(read),0);
+  for(size_t i=0;i<sizeof(data);++i)REQUIRE(read[i] == data[i]);
+  REQUIRE(tail.buffer->getContext().glGetError() == GL_NO_ERROR);
+}
@@ -1,14 +1,12 @@
 #include<catch.hpp>
-#include<SDLWin.h>
+#include<TestContext.h>
 #include<geGL/geGL.h>
 
 using namespace ge::gl;
 using namespace std;
 
 TEST_CASE("Buffer Tests"){
-  SDLWin win;
-  win.beginFrame();
-  ge::gl::init();
+  TestContext context;
   {
     float data[4] = {1.f,2.f,3.f,4.f};
     auto b = make_shared<Buffer>(4*sizeof(float),data);
@@ -58,18 +56,59 @@ TEST_CASE("Buffer Tests"){
     REQUIRE(c->getSize() == sizeof(float));
     REQUIRE(c->getId() == oldId);
   }
-  win.endFrame();
 }
 
 TEST_CASE("BufferSize"){
-  SDLWin win;
-  win.beginFrame();
-  ge::gl::init();
+  TestContext context;
   {
     std::cerr << "sizeof(GLsizeiptr): " << sizeof(GLsizeiptr) << std::endl;
     size_t const size = 1024ull*1024ull*1024ull*3ull;
     auto b = make_shared<Buffer>(size);
     REQUIRE(b->getSize() == size);
   }
-  win.endFrame();
+}
+
+TEST_CASE("Buffer parameters are cached on client side"){
+  TestContext context;
+  Buffer::setDriverVerification(true);
+  {
+    auto b = make_shared<Buffer>(64,nullptr,GL_DYNAMIC_DRAW);
+    REQUIRE(b->getSize()        == 64);
+    REQUIRE(b->getUsage()       == GL_DYNAMIC_DRAW);
+    REQUIRE(b->isImmutable()    == GL_FALSE);
+    REQUIRE(b->getStorageFlags() == (GL_MAP_READ_BIT|GL_MAP_WRITE_BIT|GL_DYNAMIC_STORAGE_BIT));
+    REQUIRE(b->isMapped()       == GL_FALSE);
+    REQUIRE(b->getAccess()      == GL_READ_WRITE);
+
+    auto const ptr = b->map(16,32,GL_MAP_WRITE_BIT);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(b->isMapped()       == GL_TRUE);
+    REQUIRE(b->getMapOffset()   == 16);
+    REQUIRE(b->getMapSize()     == 32);
+    REQUIRE(b->getMapPointer()  == ptr);
+    REQUIRE(b->getAccessFlags() == GL_MAP_WRITE_BIT);
+    REQUIRE(b->getAccess()      == GL_WRITE_ONLY);
+    b->unmap();
+    REQUIRE(b->isMapped()       == GL_FALSE);
+    REQUIRE(b->getMapPointer()  == nullptr);
+
+    b->realloc(128,Buffer::KEEP_DATA);
+    REQUIRE(b->getSize() == 128);
+    b->realloc(32,Buffer::KEEP_DATA_ID);
+    REQUIRE(b->getSize() == 32);
+    b->realloc(16,Buffer::NEW_BUFFER);
+    REQUIRE(b->getSize() == 16);
+
+    auto s = make_shared<Buffer>(64,nullptr,GL_MAP_READ_BIT|GL_MAP_PERSISTENT_BIT);
+    REQUIRE(s->isImmutable()     == GL_TRUE);
+    REQUIRE(s->getUsage()        == GL_DYNAMIC_DRAW);
+    REQUIRE(s->getStorageFlags() == (GL_MAP_READ_BIT|GL_MAP_PERSISTENT_BIT));
+    s->map(GL_READ_ONLY);
+    REQUIRE(s->getAccess() == GL_READ_ONLY);
+    s->getContext().glUnmapNamedBuffer(s->getId());
+    REQUIRE_THROWS_AS(s->isMapped(),std::runtime_error);
+    Buffer::setDriverVerification(false);
+    REQUIRE(s->isMapped() == GL_TRUE);
+  }
+  Buffer::setDriverVerification(false);
 }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstdint>
+#include<string>
+
+/**
+ * @brief Null function loader that simulates busy GPU.
+ * Fences of null context are numbered 1,2,3,... GPU has finished fences up to completed(),
+ * polled fences behind it time out, blocking wait moves GPU up to waited fence.
+ * Tests simulate GPU latency by moving completed().
+ */
+class BusyGPULoader: public ge::gl::NullFunctionLoader{
+  public:
+    BusyGPULoader(){
+      completed    () = 0;
+      blockingWaits() = 0;
+    }
+    virtual ge::gl::FUNCTION_POINTER load(char const*fceName)const override{
+      if(std::string(fceName) == "glClientWaitSync")return (ge::gl::FUNCTION_POINTER)glClientWaitSync;
+      return ge::gl::NullFunctionLoader::load(fceName);
+    }
+    static uintptr_t&completed(){
+      static uintptr_t c = 0;
+      return c;
+    }
+    static size_t&blockingWaits(){
+      static size_t w = 0;
+      return w;
+    }
+  protected:
+    static GLenum glClientWaitSync(GLsync sync,GLbitfield,GLuint64 timeout){
+      auto const fence = (uintptr_t)sync;
+      if(fence <= completed())return GL_ALREADY_SIGNALED;
+      if(timeout == 0)return GL_TIMEOUT_EXPIRED;
+      blockingWaits()++;
+      completed() = fence;
+      return GL_CONDITION_SATISFIED;
+    }
+};
@@ -0,0 +1,216 @@
+#include<catch.hpp>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/CaptureStream.h>
+#include<geGL/NullFunctionLoader.h>
+#include<sstream>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  using GetIntegerv = void(*)(GLenum,GLint*);
+
+  /**
+   * @brief Null function loader that counts queries of pixel unpack buffer binding.
+   */
+  class UnpackQueryLoader: public NullFunctionLoader{
+    public:
+      static size_t queries;
+      virtual FUNCTION_POINTER load(char const*fceName)const override{
+        if(string(fceName) == "glGetIntegerv"){
+          original = (GetIntegerv)NullFunctionLoader::load(fceName);
+          return (FUNCTION_POINTER)glGetIntegerv;
+        }
+        return NullFunctionLoader::load(fceName);
+      }
+    protected:
+      static GetIntegerv original;
+      static void glGetIntegerv(GLenum pname,GLint*data){
+        if(pname == GL_PIXEL_UNPACK_BUFFER_BINDING)queries++;
+        original(pname,data);
+      }
+  };
+  size_t      UnpackQueryLoader::queries  = 0;
+  GetIntegerv UnpackQueryLoader::original = nullptr;
+
+  template<typename T>
+    void writeValue(ostream&stream,T const&value){
+      stream.write((char const*)&value,sizeof(T));
+    }
+}
+
+TEST_CASE("Capture stores payloads once and replays them"){
+  auto const stream = make_shared<stringstream>();
+  auto const writer = make_shared<CaptureWriter>(stream);
+  {
+    auto const table = createCaptureTable(make_shared<NullFunctionLoader>(),writer);
+    vector<float>const data = {1.f,2.f,3.f,4.f};
+    GLuint buffers[3];
+    table->glCreateBuffers(3,buffers);
+    for(auto const&b:buffers)
+      table->glNamedBufferData(b,data.size()*sizeof(float),data.data(),GL_STATIC_DRAW);
+    REQUIRE(writer->getNofBlobs() == 1);
+    REQUIRE(writer->getBlobsSize() == data.size()*sizeof(float));
+    writer->frame();
+
+    auto const shader = table->glCreateShader(GL_VERTEX_SHADER);
+    GLchar const*source = "#version 450\nuniform float a;\nvoid main(){gl_Position = vec4(a);}\n";
+    table->glShaderSource(shader,1,&source,nullptr);
+    table->glCompileShader(shader);
+    auto const sync = table->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+    table->glClientWaitSync(sync,0,0);
+    table->glDeleteSync(sync);
+    float const changed = 10.f;
+    table->glNamedBufferSubData(buffers[2],sizeof(float),sizeof(float),&changed);
+    writer->frame();
+    REQUIRE(writer->getNofCalls() == 11);
+  }
+  writer->flush();
+
+  auto const loader = make_shared<NullFunctionLoader>();
+  auto const table  = createTable(loader);
+  vector<size_t>replayed;
+  auto const frames = replayCapture(*table,*stream,[&](size_t f){replayed.push_back(f);});
+  REQUIRE(frames.size() == 2);
+  REQUIRE(frames[0].calls == 4);
+  REQUIRE(frames[1].calls == 7);
+  REQUIRE(replayed == vector<size_t>({0,1}));
+
+  float data[4] = {};
+  table->glGetNamedBufferSubData(1,0,sizeof(data),data);
+  REQUIRE(data[3] == 4.f);
+  table->glGetNamedBufferSubData(3,0,sizeof(data),data);
+  REQUIRE(data[0] ==  1.f);
+  REQUIRE(data[1] == 10.f);
+
+  GLint compiled = GL_FALSE;
+  table->glGetShaderiv(1,GL_COMPILE_STATUS,&compiled);
+  REQUIRE(compiled == GL_TRUE);
+}
+
+TEST_CASE("Capture does not record calls made by decorators"){
+  auto const stream = make_shared<stringstream>();
+  auto const writer = make_shared<CaptureWriter>(stream);
+  auto const table  = createCaptureTable(make_shared<NullFunctionLoader>(),writer);
+  GLuint texture;
+  table->glCreateTextures(GL_TEXTURE_2D,1,&texture);
+  table->glTextureStorage2D(texture,1,GL_RGBA8,2,2);
+  uint8_t const pixels[16] = {};
+  table->glTextureSubImage2D(texture,0,0,0,2,2,GL_RGBA,GL_UNSIGNED_BYTE,pixels);
+  REQUIRE(writer->getNofCalls() == 3);
+  REQUIRE(writer->getBlobsSize() == sizeof(pixels));
+}
+
+TEST_CASE("Capture takes pixel unpack buffer binding from binding tracker"){
+  auto const writer = make_shared<CaptureWriter>(make_shared<stringstream>());
+  auto const table  = createCaptureTable(make_shared<UnpackQueryLoader>(),writer);
+  UnpackQueryLoader::queries = 0;
+  GLuint texture;
+  table->glCreateTextures(GL_TEXTURE_2D,1,&texture);
+  table->glTextureStorage2D(texture,1,GL_RGBA8,2,2);
+  uint8_t pixels[16] = {};
+  for(uint8_t i=0;i<3;++i){
+    pixels[0] = i;
+    table->glTextureSubImage2D(texture,0,0,0,2,2,GL_RGBA,GL_UNSIGNED_BYTE,pixels);
+  }
+  REQUIRE(writer->getNofBlobs() == 3);
+
+  GLuint buffer;
+  table->glCreateBuffers(1,&buffer);
+  table->glNamedBufferStorage(buffer,sizeof(pixels)*2,nullptr,0);
+  table->glBindBuffer(GL_PIXEL_UNPACK_BUFFER,buffer);
+  table->glTextureSubImage2D(texture,0,0,0,2,2,GL_RGBA,GL_UNSIGNED_BYTE,(void const*)sizeof(pixels));
+  REQUIRE(writer->getNofBlobs() == 3);
+  table->glBindBuffer(GL_PIXEL_UNPACK_BUFFER,0);
+  pixels[0] = 3;
+  table->glTextureSubImage2D(texture,0,0,0,2,2,GL_RGBA,GL_UNSIGNED_BYTE,pixels);
+  REQUIRE(writer->getNofBlobs() == 4);
+  REQUIRE(UnpackQueryLoader::queries <= 1);
+}
+
+TEST_CASE("Capture reads only values that parameter and clear functions use"){
+  auto const writer = make_shared<CaptureWriter>(make_shared<stringstream>());
+  auto const table  = createCaptureTable(make_shared<NullFunctionLoader>(),writer);
+  GLuint texture;
+  table->glCreateTextures(GL_TEXTURE_2D,1,&texture);
+  table->glBindTexture(GL_TEXTURE_2D,texture);
+  GLint const filter = GL_LINEAR;
+  table->glTexParameteriv(GL_TEXTURE_2D,GL_TEXTURE_MIN_FILTER,&filter);
+  REQUIRE(writer->getNofBlobs() == 1);
+  REQUIRE(writer->getBlobsSize() == sizeof(GLint));
+
+  GLuint sampler;
+  table->glCreateSamplers(1,&sampler);
+  float const anisotropy = 4.f;
+  table->glSamplerParameterfv(sampler,GL_TEXTURE_MAX_ANISOTROPY,&anisotropy);
+  REQUIRE(writer->getNofBlobs() == 2);
+  REQUIRE(writer->getBlobsSize() == sizeof(GLint)+sizeof(float));
+
+  float const depth = 1.f;
+  table->glClearNamedFramebufferfv(0,GL_DEPTH,0,&depth);
+  REQUIRE(writer->getNofBlobs() == 3);
+  REQUIRE(writer->getBlobsSize() == sizeof(GLint)+2*sizeof(float));
+
+  float const color[4] = {0.f,0.f,0.f,1.f};
+  table->glClearNamedFramebufferfv(0,GL_COLOR,0,color);
+  float const border[4] = {1.f,0.f,0.f,1.f};
+  table->glSamplerParameterfv(sampler,GL_TEXTURE_BORDER_COLOR,border);
+  REQUIRE(writer->getNofBlobs() == 5);
+  REQUIRE(writer->getBlobsSize() == sizeof(GLint)+2*sizeof(float)+sizeof(color)+sizeof(border));
+}
+
+TEST_CASE("Replay distinguishes blobs with the same hash and different sizes"){
+  float const small[1] = {1.f};
+  float const large[2] = {2.f,3.f};
+  uint64_t const hash = 42;
+  string const name = "glNamedBufferData";
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  GLuint buffers[2];
+  table->glCreateBuffers(2,buffers);
+
+  stringstream stream;
+  stream.write(capture::MAGIC,capture::MAGIC_SIZE);
+  writeValue(stream,capture::FUNCTION);
+  writeValue(stream,(uint32_t)0);
+  writeValue(stream,(uint32_t)name.size());
+  stream.write(name.data(),name.size());
+  writeValue(stream,capture::BLOB);
+  writeValue(stream,hash);
+  writeValue(stream,(uint64_t)sizeof(small));
+  writeValue(stream,small);
+  writeValue(stream,capture::BLOB);
+  writeValue(stream,hash);
+  writeValue(stream,(uint64_t)sizeof(large));
+  writeValue(stream,large);
+  for(size_t i=0;i<2;++i){
+    stringstream arguments;
+    auto const size = (uint64_t)(i == 0 ? sizeof(small) : sizeof(large));
+    writeValue(arguments,buffers[i]);
+    writeValue(arguments,(GLsizeiptr)size);
+    writeValue(arguments,capture::BLOB_DATA);
+    writeValue(arguments,hash);
+    writeValue(arguments,size);
+    writeValue(arguments,(GLenum)GL_STATIC_DRAW);
+    auto const data = arguments.str();
+    writeValue(stream,capture::CALL);
+    writeValue(stream,(uint32_t)0);
+    writeValue(stream,(uint32_t)data.size());
+    stream.write(data.data(),data.size());
+  }
+
+  REQUIRE(replayCapture(*table,stream)[0].calls == 2);
+  float data[2] = {};
+  table->glGetNamedBufferSubData(buffers[0],0,sizeof(small),data);
+  REQUIRE(data[0] == 1.f);
+  table->glGetNamedBufferSubData(buffers[1],0,sizeof(large),data);
+  REQUIRE(data[0] == 2.f);
+  REQUIRE(data[1] == 3.f);
+}
+
+TEST_CASE("Replay rejects stream that is not capture"){
+  stringstream stream("not a capture");
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  REQUIRE_THROWS_AS(replayCapture(*table,stream),std::runtime_error);
+}
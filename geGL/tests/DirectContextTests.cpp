@@ -0,0 +1,84 @@
+#include<catch.hpp>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/DirectContext.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+#include<geGL/StaticCalls.h>
+#include<memory>
+#include<type_traits>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("Direct context calls undecorated functions directly"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  DirectContext gl(table);
+  REQUIRE(gl.getNofDirectFunctions() > 0);
+  REQUIRE(gl.getNofDirectFunctions() < GE_GL_NOF_OPENGL_FUNCTIONS);
+
+  GLuint buffer = 0;
+  gl.glCreateBuffers(1,&buffer);
+  float const data[2] = {3.f,4.f};
+  gl.glNamedBufferData(buffer,sizeof(data),data,GL_STATIC_DRAW);
+  float read[2] = {};
+  gl.glGetNamedBufferSubData(buffer,0,sizeof(read),read);
+  REQUIRE(read[1] == 4.f);
+  REQUIRE(gl.glIsBuffer(buffer) == GL_TRUE);
+  REQUIRE(gl.glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Direct context keeps decorated functions and refreshes snapshot"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  DirectContext gl(table);
+  REQUIRE(gl.getNofDirectFunctions() == 0);
+  gl.glEnable(GL_DEPTH_TEST);
+  auto const profile = getProfiling(table)->getProfile();
+  REQUIRE(profile.size() == 1);
+  REQUIRE(profile[0].name == "glEnable");
+
+  auto const plainTable = createTable(make_shared<NullFunctionLoader>());
+  gl.setFunctionTable(plainTable);
+  REQUIRE(gl.getFunctionTable() == plainTable);
+  REQUIRE(gl.getNofDirectFunctions() > 0);
+}
+
+TEST_CASE("Free functions follow default context"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  setDefaultFunctionTable(table);
+  setDefaultContext(createContext(table));
+  ge::gl::glEnable(GL_BLEND);
+  ge::gl::glEnable(GL_BLEND);
+  REQUIRE(getProfiling(table)->getProfile()[0].calls == 2);
+
+  auto const otherTable = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  setDefaultFunctionTable(otherTable);
+  ge::gl::glEnable(GL_BLEND);
+  REQUIRE(getProfiling(table     )->getProfile()[0].calls == 2);
+  REQUIRE(getProfiling(otherTable)->getProfile()[0].calls == 1);
+  REQUIRE(ge::gl::glIsEnabled(GL_BLEND) == GL_TRUE);
+}
+
+TEST_CASE("Moved direct context calls through its own snapshot"){
+  static_assert(!std::is_copy_constructible<DirectContext>::value,"snapshot must not be shared by copies");
+  static_assert(!std::is_copy_assignable   <DirectContext>::value,"snapshot must not be shared by copies");
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto source = unique_ptr<DirectContext>(new DirectContext(table));
+  auto const nofDirect = source->getNofDirectFunctions();
+  DirectContext gl(std::move(*source));
+  REQUIRE(source->getNofDirectFunctions() == 0);
+  source = nullptr;
+  REQUIRE(gl.getNofDirectFunctions() == nofDirect);
+  GLuint buffer = 0;
+  gl.glCreateBuffers(1,&buffer);
+  REQUIRE(gl.glIsBuffer(buffer) == GL_TRUE);
+
+  DirectContext other(table);
+  other = std::move(gl);
+  REQUIRE(other.getNofDirectFunctions() == nofDirect);
+  REQUIRE(gl.getNofDirectFunctions() == 0);
+  REQUIRE(other.glIsBuffer(buffer) == GL_TRUE);
+  gl.setFunctionTable(table);
+  REQUIRE(gl.getNofDirectFunctions() == nofDirect);
+  REQUIRE(gl.glIsBuffer(buffer) == GL_TRUE);
+}
@@ -0,0 +1,60 @@
+#include<catch.hpp>
+#include<TestContext.h>
+#include<geGL/geGL.h>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("DynamicBuffer grows geometrically"){
+  TestContext context;
+  DynamicBuffer buffer;
+  REQUIRE(buffer.empty());
+  size_t const n = 1000;
+  for(size_t i=0;i<n;++i)
+    REQUIRE(buffer.push_back((float)i) == (GLintptr)(i*sizeof(float)));
+  REQUIRE(buffer.getSize()     == (GLsizeiptr)(n*sizeof(float)));
+  REQUIRE(buffer.getCapacity() >= buffer.getSize());
+  REQUIRE(buffer.getBuffer()->getSize() == buffer.getCapacity());
+
+  vector<float>data;
+  buffer.getBuffer()->getData(data);
+  for(size_t i=0;i<n;++i)REQUIRE(data[i] == (float)i);
+
+  auto const&s = buffer.getStatistics();
+  REQUIRE(s.reallocations      == 11);
+  REQUIRE(s.exactReallocations == n);
+  REQUIRE(s.getSavedReallocations() == n-11);
+  REQUIRE(s.copiedBytes        == 4096-4);
+  REQUIRE(s.exactCopiedBytes   == (GLsizeiptr)(n*(n-1)/2*sizeof(float)));
+  REQUIRE(s.getSavedCopiedBytes() == s.exactCopiedBytes-s.copiedBytes);
+
+  buffer.shrinkToFit();
+  REQUIRE(buffer.getCapacity() == buffer.getSize());
+  buffer.getBuffer()->getData(data);
+  REQUIRE(data.size() == n);
+  REQUIRE(data[n-1] == (float)(n-1));
+
+  buffer.clear();
+  REQUIRE(buffer.empty());
+  REQUIRE(buffer.getCapacity() == (GLsizeiptr)(n*sizeof(float)));
+  REQUIRE_THROWS(DynamicBuffer(0,GL_DYNAMIC_DRAW,1.f));
+}
+
+TEST_CASE("DynamicBuffer keeps vertex arrays attached during growth"){
+  TestContext context;
+  DynamicBuffer buffer(16);
+  buffer.reserve(64);
+  REQUIRE(buffer.getCapacity() == 64);
+  VertexArray vao;
+  vao.addAttrib(buffer.getBuffer(),0,2,GL_FLOAT,0,8);
+  vector<float>const data(100,1.f);
+  buffer.append(data);
+  REQUIRE(buffer.getCapacity() == 400);
+  REQUIRE(vao.getBuffer(0) == buffer.getBuffer());
+  REQUIRE(vao.getAttribBufferBinding(0) == buffer.getBuffer()->getId());
+  GLint64 bindingOffset = 0;
+  vao.getContext().glGetVertexArrayIndexed64iv(vao.getId(),0,GL_VERTEX_BINDING_OFFSET,&bindingOffset);
+  REQUIRE(bindingOffset == 8);
+  REQUIRE(vao.getContext().glGetError() == GL_NO_ERROR);
+}
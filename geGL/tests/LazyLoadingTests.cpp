@@ -0,0 +1,80 @@
+#include<catch.hpp>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<set>
+#include<string>
+
+using namespace ge::gl;
+using namespace std;
+
+/**
+ * @brief Null function loader that counts loads and hides some functions.
+ */
+class CountingLoader: public NullFunctionLoader{
+  public:
+    CountingLoader(set<string>const&missing = {}):missing(missing){}
+    virtual FUNCTION_POINTER load(char const*fceName)const override{
+      loads++;
+      if(missing.count(fceName))return nullptr;
+      return NullFunctionLoader::load(fceName);
+    }
+    mutable size_t loads = 0;
+    set<string>    missing  ;
+};
+
+TEST_CASE("Eager loading loads every function"){
+  auto const loader = make_shared<CountingLoader>();
+  auto const table  = createTable(loader);
+  REQUIRE(loader->loads == GE_GL_NOF_OPENGL_FUNCTIONS);
+}
+
+TEST_CASE("Lazy loading loads functions during first call"){
+  auto const loader = make_shared<CountingLoader>();
+  auto const table  = createTable(loader,LAZY_LOADING_TABLE);
+  auto const probed = loader->loads;
+  REQUIRE(probed > 0);
+  //capabilities decorator probes core functions only, extensions are loaded on demand
+  REQUIRE(probed < GE_GL_NOF_OPENGL_FUNCTIONS/2);
+
+  GLuint buffer = 0;
+  table->glCreateBuffers(1,&buffer);
+  REQUIRE(buffer != 0);
+  table->glCreateBuffers(1,&buffer);
+  REQUIRE(loader->loads == probed);
+
+  table->glHint(GL_LINE_SMOOTH_HINT,GL_NICEST);
+  table->glHint(GL_LINE_SMOOTH_HINT,GL_NICEST);
+  REQUIRE(loader->loads == probed+1);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Lazy loading keeps DSA emulation and reports missing functions"){
+  auto const loader = make_shared<CountingLoader>(set<string>{"glCreateBuffers","glNamedBufferData","glNamedBufferDataEXT","glBlendColor"});
+  auto const table  = createTable(loader,LAZY_LOADING_TABLE);
+  GLuint buffer = 0;
+  table->glCreateBuffers(1,&buffer);
+  REQUIRE(buffer != 0);
+  float const data[2] = {1.f,2.f};
+  table->glNamedBufferData(buffer,sizeof(data),data,GL_STATIC_DRAW);
+  float read[2] = {};
+  table->glGetNamedBufferSubData(buffer,0,sizeof(read),read);
+  REQUIRE(read[1] == 2.f);
+  REQUIRE_THROWS_AS(table->glBlendColor(0.f,0.f,0.f,0.f),std::runtime_error);
+}
+
+TEST_CASE("Lazy loading emulates missing DSA functions wrapped by binding tracker"){
+  auto const loader = make_shared<CountingLoader>(set<string>{"glCreateTextures","glBindTextureUnit"});
+  auto const table  = createTable(loader,LAZY_LOADING_TABLE);
+  GLuint texture = 0;
+  table->glCreateTextures(GL_TEXTURE_2D,1,&texture);
+  REQUIRE(texture != 0);
+  REQUIRE_NOTHROW(table->glBindTextureUnit(2,texture));
+  GLint value = 0;
+  table->glGetIntegerv(GL_ACTIVE_TEXTURE,&value);
+  REQUIRE(value == GL_TEXTURE0);
+  table->glActiveTexture(GL_TEXTURE2);
+  table->glGetIntegerv(GL_TEXTURE_BINDING_2D,&value);
+  REQUIRE((GLuint)value == texture);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
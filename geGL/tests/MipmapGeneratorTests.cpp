@@ -0,0 +1,141 @@
+#include<catch.hpp>
+#include<geGL/MipmapGenerator.h>
+#include<cmath>
+#include<cstdlib>
+#include<cstring>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  vector<uint8_t>randomBytes(size_t size){
+    vector<uint8_t>result(size);
+    srand(7);
+    for(auto&b:result)b = (uint8_t)(rand()&0xff);
+    return result;
+  }
+
+  size_t maxDifference(vector<MipmapGenerator::Level>const&a,vector<MipmapGenerator::Level>const&b){
+    size_t result = 0;
+    for(size_t l=0;l<a.size();++l)
+      for(size_t i=0;i<a[l].data.size();++i)
+        result = max(result,(size_t)abs((int)a[l].data[i]-(int)b[l].data[i]));
+    return result;
+  }
+}
+
+TEST_CASE("MipmapGenerator builds full chain with box filter"){
+  MipmapGenerator generator(MipmapGenerator::BOX,false,1);
+  uint8_t const pixels[] = {
+    0  ,0,0,255,  100,0,0,255,  7,7,7,7,
+    200,0,0,255,  20 ,0,0,255,  7,7,7,7,
+    1  ,2,3,4  ,  1  ,2,3,4  ,  1,2,3,4,
+  };
+  auto const levels = generator.generate(pixels,3,3,GL_RGBA,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+  REQUIRE(MipmapGenerator::computeNofLevels(3,3) == 2);
+  REQUIRE(MipmapGenerator::computeNofLevels(5,16) == 5);
+  REQUIRE(levels.size() == 2);
+  REQUIRE(levels[0].data == vector<uint8_t>(pixels,pixels+sizeof(pixels)));
+  REQUIRE(levels[1].width == 1);
+  REQUIRE(levels[1].height == 1);
+  REQUIRE(levels[1].data == vector<uint8_t>({37,2,3,116}));
+
+  auto const partial = generator.generate(pixels,3,3,GL_RGBA,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE,1);
+  REQUIRE(partial.size() == 1);
+}
+
+TEST_CASE("MipmapGenerator swizzles and expands RGB to RGBA"){
+  MipmapGenerator generator;
+  uint8_t const bgr[] = {10,20,30, 40,50,60};
+  for(auto const implementation:{MipmapGenerator::SCALAR,MipmapGenerator::SIMD}){
+    generator.setImplementation(implementation);
+    auto const rgba = generator.convert(bgr,2,1,GL_BGR,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+    REQUIRE(rgba.data == vector<uint8_t>({30,20,10,255, 60,50,40,255}));
+    auto const bgra = generator.convert(rgba.data.data(),2,1,GL_RGBA,GL_UNSIGNED_BYTE,GL_BGRA,GL_UNSIGNED_BYTE);
+    REQUIRE(bgra.data == vector<uint8_t>({10,20,30,255, 40,50,60,255}));
+    auto const red = generator.convert(bgr,2,1,GL_BGR,GL_UNSIGNED_BYTE,GL_RED,GL_UNSIGNED_SHORT);
+    REQUIRE(red.data.size() == 4);
+    uint16_t r[2];
+    memcpy(r,red.data.data(),sizeof(r));
+    REQUIRE(r[0] == 30*257);
+    REQUIRE(r[1] == 60*257);
+  }
+  REQUIRE_THROWS(generator.convert(bgr,2,1,GL_RGB_INTEGER,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE));
+  REQUIRE_THROWS(generator.convert(bgr,2,1,GL_RGB,GL_INT,GL_RGBA,GL_UNSIGNED_BYTE));
+  REQUIRE_THROWS(generator.convert(nullptr,2,1,GL_RGB,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE));
+}
+
+TEST_CASE("MipmapGenerator averages sRGB in linear space"){
+  uint8_t const pixels[] = {0,0,0,0, 255,255,255,255};
+  MipmapGenerator linear(MipmapGenerator::BOX,false);
+  MipmapGenerator srgb  (MipmapGenerator::BOX,true );
+  REQUIRE(linear.generate(pixels,2,1,GL_RGBA,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE)[1].data == vector<uint8_t>({128,128,128,128}));
+  REQUIRE(srgb  .generate(pixels,2,1,GL_RGBA,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE)[1].data == vector<uint8_t>({188,188,188,128}));
+
+  vector<uint8_t>all(256);
+  for(size_t i=0;i<all.size();++i)all[i] = (uint8_t)i;
+  REQUIRE(srgb.convert(all.data(),256,1,GL_RED,GL_UNSIGNED_BYTE,GL_RED,GL_UNSIGNED_BYTE).data == all);
+}
+
+TEST_CASE("MipmapGenerator converts half and float channels"){
+  MipmapGenerator generator;
+  float const values[] = {0.f,.5f,1.f,-2.f,65504.f,1e-6f,.1f,3.f};
+  auto const half = generator.convert(values,2,1,GL_RGBA,GL_FLOAT,GL_RGBA,GL_HALF_FLOAT);
+  uint16_t h[8];
+  memcpy(h,half.data.data(),sizeof(h));
+  REQUIRE(h[0] == 0x0000);
+  REQUIRE(h[1] == 0x3800);
+  REQUIRE(h[2] == 0x3c00);
+  REQUIRE(h[3] == 0xc000);
+  REQUIRE(h[4] == 0x7bff);
+  REQUIRE(h[5] == 0x0011);
+  REQUIRE(h[6] == 0x2e66);
+
+  auto const back = generator.convert(half.data.data(),2,1,GL_RGBA,GL_HALF_FLOAT,GL_RGBA,GL_FLOAT);
+  float f[8];
+  memcpy(f,back.data.data(),sizeof(f));
+  for(size_t i=0;i<8;++i)
+    REQUIRE(fabs(f[i]-values[i]) <= fabs(values[i])*1e-3f+1e-7f);
+
+  auto const unorm = generator.convert(values,2,1,GL_RGBA,GL_FLOAT,GL_RGBA,GL_UNSIGNED_BYTE);
+  REQUIRE(unorm.data == vector<uint8_t>({0,128,255,0, 255,0,26,255}));
+}
+
+TEST_CASE("MipmapGenerator SIMD and threads match scalar reference"){
+  auto const pixels = randomBytes(67*45*4);
+  for(auto const filter:{MipmapGenerator::BOX,MipmapGenerator::KAISER}){
+    for(auto const srgb:{false,true}){
+      MipmapGenerator reference(filter,srgb,1);
+      reference.setImplementation(MipmapGenerator::SCALAR);
+      MipmapGenerator simd(filter,srgb,4);
+      for(auto const type:{GL_UNSIGNED_BYTE,GL_UNSIGNED_SHORT,GL_HALF_FLOAT,GL_FLOAT}){
+        auto const a = reference.generate(pixels.data(),67,45,GL_BGRA,GL_UNSIGNED_BYTE,GL_RGB,type);
+        auto const b = simd     .generate(pixels.data(),67,45,GL_BGRA,GL_UNSIGNED_BYTE,GL_RGB,type);
+        REQUIRE(a.size() == 7);
+        REQUIRE(b.size() == 7);
+        REQUIRE(a.back().data.size() == b.back().data.size());
+        REQUIRE(maxDifference(a,b) == 0);
+      }
+    }
+  }
+
+  auto const large = randomBytes(512*300*3);
+  MipmapGenerator single(MipmapGenerator::KAISER,false,1);
+  MipmapGenerator threaded(MipmapGenerator::KAISER,false,8);
+  auto const a = single  .generate(large.data(),512,300,GL_RGB,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+  auto const b = threaded.generate(large.data(),512,300,GL_RGB,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+  REQUIRE(maxDifference(a,b) == 0);
+}
+
+TEST_CASE("MipmapGenerator Kaiser filter preserves constant image"){
+  vector<uint16_t>pixels(13*9*2,40000);
+  MipmapGenerator generator(MipmapGenerator::KAISER);
+  auto const levels = generator.generate(pixels.data(),13,9,GL_RG,GL_UNSIGNED_SHORT,GL_RG,GL_UNSIGNED_SHORT);
+  REQUIRE(levels.size() == 4);
+  for(auto const&l:levels){
+    vector<uint16_t>values(l.data.size()/2);
+    memcpy(values.data(),l.data.data(),l.data.size());
+    for(auto const v:values)REQUIRE(abs((int)v-40000) <= 1);
+  }
+}
@@ -0,0 +1,142 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/NullFunctionLoader.h>
+#include<geGL/StaticCalls.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("Null backend buffers keep data in host memory"){
+  ge::gl::init(make_shared<NullFunctionLoader>());
+  float data[4] = {1.f,2.f,3.f,4.f};
+  auto b = make_shared<Buffer>(4*sizeof(float),data);
+  REQUIRE(b->getSize() == 4*sizeof(float));
+  data[0] = data[1] = data[2] = data[3] = 0.f;
+  b->getData(data);
+  REQUIRE(data[0] == 1.f);
+  REQUIRE(data[3] == 4.f);
+
+  data[0] = data[1] = 100.f;
+  b->setData(data,sizeof(float)*2,sizeof(float)*2);
+  b->getData(data);
+  REQUIRE(data[2] == 100.f);
+  REQUIRE(data[3] == 100.f);
+
+  auto c = make_shared<Buffer>(3*sizeof(float));
+  c->copy(*b);
+  float copied[3] = {};
+  c->getData(copied);
+  REQUIRE(copied[0] == 1.f);
+  REQUIRE(copied[2] == 100.f);
+
+  auto const ptr = (float*)b->map(GL_MAP_READ_BIT);
+  REQUIRE(ptr != nullptr);
+  REQUIRE(ptr[1] == 2.f);
+  b->unmap();
+
+  b->realloc(8*sizeof(float),Buffer::KEEP_DATA);
+  REQUIRE(b->getSize() == 8*sizeof(float));
+  b->getData(copied,sizeof(copied));
+  REQUIRE(copied[0] == 1.f);
+  REQUIRE(glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Null backend reports errors and object names"){
+  ge::gl::init(make_shared<NullFunctionLoader>());
+  GLuint names[2];
+  glCreateBuffers(2,names);
+  REQUIRE(names[0] != names[1]);
+  REQUIRE(glIsBuffer(names[0]) == GL_TRUE);
+  glDeleteBuffers(1,names);
+  REQUIRE(glIsBuffer(names[0]) == GL_FALSE);
+
+  glBindBuffer(GL_ARRAY_BUFFER,12345);
+  REQUIRE(glGetError() == GL_INVALID_OPERATION);
+  REQUIRE(glGetError() == GL_NO_ERROR);
+
+  GLint major = 0;
+  glGetIntegerv(GL_MAJOR_VERSION,&major);
+  REQUIRE(major == 4);
+
+  auto const sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+  REQUIRE(glClientWaitSync(sync,0,0) == GL_ALREADY_SIGNALED);
+  glDeleteSync(sync);
+
+  glDrawArrays(GL_TRIANGLES,0,3);
+  REQUIRE(glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Null backend textures remember their levels"){
+  ge::gl::init(make_shared<NullFunctionLoader>());
+  auto t = make_shared<Texture>(GL_TEXTURE_2D,GL_RGBA8,7,64,32);
+  REQUIRE(t->getWidth (0) == 64);
+  REQUIRE(t->getHeight(0) == 32);
+  REQUIRE(t->getWidth (3) == 8 );
+  REQUIRE(t->getHeight(6) == 1 );
+  REQUIRE(t->getInternalFormat(0) == GL_RGBA8);
+
+  auto d = make_shared<Texture>(GL_TEXTURE_2D,GL_DEPTH24_STENCIL8,1,16,16);
+  REQUIRE(d->getDepthSize(0) == 24);
+}
+
+TEST_CASE("Null backend vertex arrays"){
+  ge::gl::init(make_shared<NullFunctionLoader>());
+  auto b   = make_shared<Buffer>(sizeof(float)*12);
+  auto e   = make_shared<Buffer>(sizeof(uint32_t)*3);
+  auto vao = make_shared<VertexArray>();
+  vao->addAttrib(b,1,3,GL_FLOAT,sizeof(float)*4,sizeof(float),GL_FALSE,2);
+  vao->addElementBuffer(e);
+  REQUIRE(vao->isAttribEnabled(1) == GL_TRUE);
+  REQUIRE(vao->isAttribEnabled(0) == GL_FALSE);
+  REQUIRE(vao->getAttribBufferBinding(1) == b->getId());
+  REQUIRE(vao->getAttribSize(1) == 3);
+  REQUIRE(vao->getAttribStride(1) == sizeof(float)*4);
+  REQUIRE(vao->getAttribType(1) == GL_FLOAT);
+  REQUIRE(vao->getAttribDivisor(1) == 2);
+  REQUIRE(vao->getElementBuffer() == e->getId());
+}
+
+TEST_CASE("Null backend reflects programs from sources"){
+  ge::gl::init(make_shared<NullFunctionLoader>());
+  auto vs = make_shared<Shader>(GL_VERTEX_SHADER,R".(
+  #version 450
+  layout(location=2)in vec3 position;
+  in vec2 coord;
+  uniform mat4 mvp;
+  uniform float weights[4];
+  void main(){
+    gl_Position = mvp*vec4(position,weights[0]);
+  }
+  ).");
+  auto fs = make_shared<Shader>(GL_FRAGMENT_SHADER,R".(
+  #version 450
+  layout(location=0)out vec4 fColor;
+  uniform vec4 color = vec4(1),tint[2] = vec4[2](vec4(0),vec4(1));
+  void main(){
+    fColor = color;
+  }
+  ).");
+  auto prg = make_shared<Program>(vs,fs);
+  REQUIRE(prg->getAttribLocation("position") == 2);
+  REQUIRE(prg->getAttribLocation("coord"   ) >= 0);
+  REQUIRE(prg->getAttribLocation("coord"   ) != 2);
+  REQUIRE(prg->getUniformLocation("mvp"    ) >= 0);
+  REQUIRE(prg->getUniformLocation("color"  ) >= 0);
+  REQUIRE(prg->getUniformLocation("tint[1]") >= 0);
+  REQUIRE(prg->getUniformLocation("missing") == -1);
+  auto const w0 = prg->getUniformLocation("weights[0]");
+  REQUIRE(w0 >= 0);
+  REQUIRE(prg->getUniformLocation("weights[3]") == w0+3);
+
+  auto cs = make_shared<Shader>(GL_COMPUTE_SHADER,R".(
+  #version 450
+  layout(local_size_x=64,local_size_y=2)in;
+  void main(){}
+  ).");
+  auto compute = make_shared<Program>(cs);
+  GLint size[3];
+  compute->getComputeWorkGroupSize(size);
+  REQUIRE(size[0] == 64);
+  REQUIRE(size[1] == 2 );
+  REQUIRE(size[2] == 1 );
+}
@@ -0,0 +1,9 @@
+#include<TestContext.h>
+#include<geGL/geGL.h>
+#include<geGL/NullFunctionLoader.h>
+
+TestContext::TestContext(){
+  ge::gl::init(std::make_shared<ge::gl::NullFunctionLoader>());
+}
+
+TestContext::~TestContext(){}
@@ -0,0 +1,58 @@
+#include<catch.hpp>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("Profiling table counts calls"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  auto const profiling = getProfiling(table);
+  REQUIRE(profiling != nullptr);
+  REQUIRE(profiling->getProfile().empty());
+
+  GLuint buffers[3];
+  for(auto&b:buffers)table->glCreateBuffers(1,&b);
+  table->glGetError();
+
+  auto const profile = profiling->getProfile(1);
+  REQUIRE(profile.size() == 1);
+  REQUIRE(profile[0].name        == "glCreateBuffers");
+  REQUIRE(profile[0].calls       == 3);
+  REQUIRE(profile[0].nanoseconds == 0);
+  REQUIRE(profiling->getProfile().size() == 2);
+
+  profiling->resetProfile();
+  REQUIRE(profiling->getProfile().empty());
+}
+
+TEST_CASE("Profiling table reports last frame"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE|STATE_CACHE_TABLE);
+  auto const profiling = getProfiling(table);
+  REQUIRE(profiling != nullptr);
+
+  table->glEnable(GL_DEPTH_TEST);
+  table->glEnable(GL_DEPTH_TEST);
+  profiling->nextFrame();
+  auto frame = profiling->getProfile(0,ProfilingInterface::BY_CALLS,ProfilingInterface::LAST_FRAME);
+  REQUIRE(frame.size() == 1);
+  REQUIRE(frame[0].name  == "glEnable");
+  REQUIRE(frame[0].calls == 1);
+
+  profiling->setTiming(true);
+  for(int i=0;i<100;++i)table->glGetError();
+  profiling->nextFrame();
+  frame = profiling->getProfile(0,ProfilingInterface::BY_TIME,ProfilingInterface::LAST_FRAME);
+  REQUIRE(frame.size() == 1);
+  REQUIRE(frame[0].name  == "glGetError");
+  REQUIRE(frame[0].calls == 100);
+  REQUIRE(frame[0].nanoseconds > 0);
+  REQUIRE(profiling->getProfile(0,ProfilingInterface::BY_CALLS,ProfilingInterface::TOTAL).size() == 2);
+}
+
+TEST_CASE("Table without profiling flag has no profiling interface"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  REQUIRE(getProfiling(table) == nullptr);
+}
@@ -0,0 +1,133 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstdio>
+#include<fstream>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  string const directory = "programBinaryCacheTests";
+
+  ProgramBinaryCache::Binary binary(size_t size,uint8_t value){
+    return ProgramBinaryCache::Binary(size,value);
+  }
+
+  ProgramBinaryCache::Stages const stages = {
+    {GL_VERTEX_SHADER  ,{"#version 450\n","uniform mat4 mvp;\nin vec4 position;\nvoid main(){gl_Position = mvp*position;}\n"}},
+    {GL_FRAGMENT_SHADER,{"#version 450\n","uniform vec4 color;\nout vec4 fColor;\nvoid main(){fColor = color;}\n"}},
+  };
+}
+
+TEST_CASE("ProgramBinaryCache stores binaries and evicts least recently used ones"){
+  {
+    ProgramBinaryCache cache(directory);
+    cache.clear();
+    cache.store(1,7,binary(100,1));
+    auto const entrySize = cache.getSize();
+    REQUIRE(entrySize > 100);
+    cache.setMaxSize(3*entrySize);
+    cache.store(2,7,binary(100,2));
+    cache.store(3,7,binary(100,3));
+    GLenum format = 0;
+    ProgramBinaryCache::Binary data;
+    REQUIRE(cache.load(1,format,data));
+    REQUIRE(format == 7);
+    REQUIRE(data == binary(100,1));
+    cache.store(4,7,binary(100,4));
+    REQUIRE(cache.contains(1));
+    REQUIRE(!cache.contains(2));
+    REQUIRE(cache.getNofBinaries() == 3);
+    REQUIRE(cache.getSize() == 3*entrySize);
+    REQUIRE(!cache.load(2,format,data));
+
+    cache.store(5,7,binary(4*entrySize,5));
+    REQUIRE(!cache.contains(5));
+    auto const&stats = cache.getStatistics();
+    REQUIRE(stats.stores == 4);
+    REQUIRE(stats.evictions == 1);
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 1);
+  }
+  {
+    ProgramBinaryCache cache(directory);
+    REQUIRE(cache.getNofBinaries() == 3);
+    cache.setMaxSize(2*(cache.getSize()/3));
+    REQUIRE(!cache.contains(3));
+    REQUIRE(cache.contains(1));
+    REQUIRE(cache.contains(4));
+
+    ofstream(directory+"/0000000000000001.bin",ios::binary|ios::trunc) << "garbage";
+    GLenum format = 0;
+    ProgramBinaryCache::Binary data;
+    REQUIRE(!cache.load(1,format,data));
+    REQUIRE(!cache.contains(1));
+    REQUIRE(cache.getStatistics().rejected == 1);
+    REQUIRE(cache.load(4,format,data));
+    REQUIRE(data == binary(100,4));
+    cache.clear();
+    REQUIRE(cache.getNofBinaries() == 0);
+  }
+  REQUIRE(ProgramBinaryCache(directory).getNofBinaries() == 0);
+  remove(directory.c_str());
+}
+
+TEST_CASE("ProgramBinaryCache keys depend on sources, stages and driver"){
+  auto const key = ProgramBinaryCache::computeKey(stages,"driver");
+  auto swapped = stages;
+  swapped[0].first = GL_GEOMETRY_SHADER;
+  auto split = stages;
+  split[0].second = {"#version 450\nuniform mat4 mvp;\n","in vec4 position;\nvoid main(){gl_Position = mvp*position;}\n"};
+  REQUIRE(key == ProgramBinaryCache::computeKey(stages,"driver"));
+  REQUIRE(key != ProgramBinaryCache::computeKey(stages,"driver 2"));
+  REQUIRE(key != ProgramBinaryCache::computeKey(swapped,"driver"));
+  REQUIRE(key != ProgramBinaryCache::computeKey(split,"driver"));
+  REQUIRE(key != ProgramBinaryCache::computeKey({stages[0]},"driver"));
+}
+
+TEST_CASE("ProgramBinaryCache creates programs from binaries without compilation"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  GLint location = -1;
+  {
+    ProgramBinaryCache cache(directory);
+    cache.clear();
+    auto const program = cache.createProgram(table,stages);
+    REQUIRE(program->getLinkStatus());
+    REQUIRE(program->getNofShaders() == 2);
+    REQUIRE(cache.getStatistics().misses == 1);
+    REQUIRE(cache.getStatistics().stores == 1);
+    location = program->getUniformLocation("color");
+    REQUIRE(location >= 0);
+  }
+  ProgramBinaryCache cache(directory);
+  auto const program = cache.createProgram(table,stages);
+  REQUIRE(program->getLinkStatus());
+  REQUIRE(program->getNofShaders() == 0);
+  REQUIRE(cache.getStatistics().hits == 1);
+  REQUIRE(program->getUniformLocation("color") == location);
+  REQUIRE(program->getInfo()->uniforms.count("mvp") == 1);
+  REQUIRE(program->getAttribLocation("position") >= 0);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+
+  auto const key = ProgramBinaryCache::computeKey(stages,ProgramBinaryCache::getDriver(table));
+  GLenum format = 0;
+  ProgramBinaryCache::Binary data;
+  REQUIRE(cache.load(key,format,data));
+  cache.store(key,format+1,data);
+  auto const unknownFormat = cache.createProgram(table,stages);
+  REQUIRE(unknownFormat->getLinkStatus());
+  REQUIRE(unknownFormat->getNofShaders() == 2);
+  cache.store(key,format,binary(16,0));
+  auto const corrupted = cache.createProgram(table,stages);
+  REQUIRE(corrupted->getLinkStatus());
+  REQUIRE(corrupted->getNofShaders() == 2);
+  REQUIRE(corrupted->getUniformLocation("color") == location);
+  REQUIRE(cache.getStatistics().rejected == 2);
+  REQUIRE(cache.load(key,format,data));
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+  cache.clear();
+  remove(directory.c_str());
+}
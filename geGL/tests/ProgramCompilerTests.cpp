@@ -0,0 +1,135 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<chrono>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  using GetProgramiv = void(*)(GLuint,GLenum,GLint*);
+
+  /**
+   * @brief Null function loader whose compiler is busy until busy is cleared.
+   */
+  class BusyCompilerLoader: public NullFunctionLoader{
+    public:
+      static bool busy;
+      virtual FUNCTION_POINTER load(char const*fceName)const override{
+        if(string(fceName) == "glGetProgramiv"){
+          original = (GetProgramiv)NullFunctionLoader::load(fceName);
+          return (FUNCTION_POINTER)glGetProgramiv;
+        }
+        return NullFunctionLoader::load(fceName);
+      }
+    protected:
+      static GetProgramiv original;
+      static void glGetProgramiv(GLuint program,GLenum pname,GLint*params){
+        if(pname == GL_COMPLETION_STATUS_KHR && busy){
+          *params = GL_FALSE;
+          return;
+        }
+        original(program,pname,params);
+      }
+  };
+  bool BusyCompilerLoader::busy = true;
+  GetProgramiv BusyCompilerLoader::original = nullptr;
+
+  /**
+   * @brief Null function loader without GL_KHR_parallel_shader_compile.
+   */
+  class SerialCompilerLoader: public NullFunctionLoader{
+    public:
+      virtual FUNCTION_POINTER load(char const*fceName)const override{
+        if(string(fceName) == "glGetStringi")return (FUNCTION_POINTER)glGetStringi;
+        return NullFunctionLoader::load(fceName);
+      }
+    protected:
+      static GLubyte const* glGetStringi(GLenum,GLuint){
+        return (GLubyte const*)"GL_ARB_something_else";
+      }
+  };
+
+  ProgramCompiler::Stages stages(string const&uniform){
+    return {
+      {GL_VERTEX_SHADER  ,{"#version 450\n","in vec4 position;\nvoid main(){gl_Position = position;}\n"}},
+      {GL_FRAGMENT_SHADER,{"#version 450\n","uniform vec4 "+uniform+";\nout vec4 fColor;\nvoid main(){fColor = "+uniform+";}\n"}},
+    };
+  }
+
+  bool isReady(ProgramCompiler::Future const&future){
+    return future.wait_for(chrono::seconds(0)) == future_status::ready;
+  }
+}
+
+TEST_CASE("ProgramCompiler compiles programs and fills reflection lazily"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  ProgramCompiler compiler(table);
+  REQUIRE(compiler.isParallel());
+  vector<ProgramCompiler::Future>futures;
+  for(auto const&name:{"red","green","blue"})
+    futures.push_back(compiler.compile(stages(name)));
+  futures.push_back(compiler.compile({}));
+  REQUIRE(compiler.getNofPending() == 4);
+  REQUIRE(!isReady(futures[0]));
+
+  REQUIRE(compiler.pump() == 4);
+  REQUIRE(compiler.getNofPending() == 0);
+  auto const&stats = compiler.getStatistics();
+  REQUIRE(stats.submitted == 4);
+  REQUIRE(stats.completed == 4);
+  REQUIRE(stats.failed == 1);
+  REQUIRE(isReady(futures[3]));
+  REQUIRE(!futures[3].get()->getLinkStatus());
+
+  auto const green = futures[1].get();
+  REQUIRE(green->getLinkStatus());
+  REQUIRE(green->getNofShaders() == 2);
+  REQUIRE(green->getInfo()->uniforms.count("green") == 1);
+  REQUIRE(green->getInfo()->uniforms.count("red") == 0);
+  green->set4f("green",0.f,1.f,0.f,1.f);
+  green->use();
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("ProgramCompiler polls completion status without blocking"){
+  auto const table = createTable(make_shared<BusyCompilerLoader>());
+  ProgramCompiler compiler(table,4);
+  auto future = compiler.compile(stages("color"));
+  BusyCompilerLoader::busy = true;
+  REQUIRE(compiler.pump() == 0);
+  REQUIRE(compiler.pump() == 0);
+  REQUIRE(compiler.getStatistics().polls == 2);
+  REQUIRE(!isReady(future));
+
+  BusyCompilerLoader::busy = false;
+  REQUIRE(compiler.pump() == 1);
+  REQUIRE(isReady(future));
+  REQUIRE(future.get()->getUniformLocation("color") >= 0);
+
+  BusyCompilerLoader::busy = true;
+  auto unfinished = compiler.compile(stages("color"));
+  compiler.finish();
+  REQUIRE(isReady(unfinished));
+  REQUIRE(unfinished.get()->getLinkStatus());
+}
+
+TEST_CASE("ProgramCompiler completes programs in order without parallel compile extension"){
+  auto const table = createTable(make_shared<SerialCompilerLoader>());
+  auto compiler = make_shared<ProgramCompiler>(table);
+  REQUIRE(!compiler->isParallel());
+  auto a = compiler->compile(stages("a"));
+  auto b = compiler->compile(stages("b"));
+  REQUIRE(compiler->pump() == 2);
+  REQUIRE(compiler->getStatistics().polls == 0);
+  REQUIRE(a.get()->getLinkStatus());
+  REQUIRE(b.get()->getLinkStatus());
+
+  auto c = compiler->compile(stages("c"));
+  compiler = nullptr;
+  REQUIRE(isReady(c));
+  REQUIRE(c.get()->getInfo()->uniforms.count("c") == 1);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include<geGL/OpenGL.h>
+#include<geGL/FunctionLoaderInterface.h>
+#include<map>
+#include<string>
+
+/**
+ * @brief Function loader that returns stubs of a few binding, query and update functions.
+ * Stubs do nothing but count their calls, so function table decorators can be tested without GPU.
+ * All other functions are not loaded.
+ */
+class RecordingLoader: public ge::gl::FunctionLoaderInterface{
+  public:
+    static std::map<std::string,size_t>&calls(){
+      static std::map<std::string,size_t>c;
+      return c;
+    }
+    static size_t count(std::string const&name){
+      auto const it = calls().find(name);
+      if(it == calls().end())return 0;
+      return it->second;
+    }
+    static std::map<GLenum,GLuint>&boundBuffers(){
+      static std::map<GLenum,GLuint>b;
+      return b;
+    }
+    static void reset(){
+      calls().clear();
+      boundBuffers().clear();
+    }
+    virtual ge::gl::FUNCTION_POINTER load(char const*fceName)const override{
+      auto const&s = stubs();
+      auto const it = s.find(fceName);
+      if(it == s.end())return nullptr;
+      return it->second;
+    }
+  protected:
+    static void record(char const*name){calls()[name]++;}
+    static void glUseProgram     (GLuint           ){record("glUseProgram"     );}
+    static void glBindVertexArray(GLuint           ){record("glBindVertexArray");}
+    static void glBindBuffer     (GLenum target,GLuint buffer){record("glBindBuffer");boundBuffers()[target] = buffer;}
+    static void glBufferSubData  (GLenum,GLintptr,GLsizeiptr,void const*){record("glBufferSubData");}
+    static void glBindBufferBase (GLenum,GLuint,GLuint){record("glBindBufferBase");}
+    static void glBindBufferRange(GLenum,GLuint,GLuint,GLintptr,GLsizeiptr){record("glBindBufferRange");}
+    static void glDeleteBuffers  (GLsizei,GLuint const*){record("glDeleteBuffers");}
+    static void glActiveTexture  (GLenum           ){record("glActiveTexture"  );}
+    static void glBindTexture    (GLenum,GLuint    ){record("glBindTexture"    );}
+    static void glBindTextureUnit(GLuint,GLuint    ){record("glBindTextureUnit");}
+    static void glDeleteTextures (GLsizei,GLuint const*){record("glDeleteTextures");}
+    static void glGenTextures    (GLsizei n,GLuint*textures){
+      record("glGenTextures");
+      static GLuint counter = 0;
+      for(GLsizei i=0;i<n;++i)textures[i] = ++counter;
+    }
+    static void glTexParameteri  (GLenum,GLenum,GLint){record("glTexParameteri");}
+    static void glBindSampler    (GLuint,GLuint    ){record("glBindSampler"    );}
+    static void glEnable         (GLenum           ){record("glEnable"         );}
+    static void glDisable        (GLenum           ){record("glDisable"        );}
+    static void glEnablei        (GLenum,GLuint    ){record("glEnablei"        );}
+    static GLboolean glIsEnabled (GLenum           ){record("glIsEnabled"      );return GL_FALSE;}
+    static void glGetIntegerv    (GLenum pname,GLint*data){
+      record("glGetIntegerv");
+      *data = pname == GL_ACTIVE_TEXTURE ? GL_TEXTURE0 : 0;
+    }
+    static void glGetIntegeri_v  (GLenum,GLuint,GLint*data){record("glGetIntegeri_v");*data = 0;}
+    static std::map<std::string,ge::gl::FUNCTION_POINTER>const&stubs(){
+      static std::map<std::string,ge::gl::FUNCTION_POINTER>const s = {
+        {"glUseProgram"     ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glUseProgram     },
+        {"glBindVertexArray",(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindVertexArray},
+        {"glBindBuffer"     ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindBuffer     },
+        {"glBufferSubData"  ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBufferSubData  },
+        {"glBindBufferBase" ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindBufferBase },
+        {"glBindBufferRange",(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindBufferRange},
+        {"glDeleteBuffers"  ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glDeleteBuffers  },
+        {"glActiveTexture"  ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glActiveTexture  },
+        {"glBindTexture"    ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindTexture    },
+        {"glBindTextureUnit",(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindTextureUnit},
+        {"glDeleteTextures" ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glDeleteTextures },
+        {"glGenTextures"    ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glGenTextures    },
+        {"glTexParameteri"  ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glTexParameteri  },
+        {"glBindSampler"    ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glBindSampler    },
+        {"glEnable"         ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glEnable         },
+        {"glDisable"        ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glDisable        },
+        {"glEnablei"        ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glEnablei        },
+        {"glIsEnabled"      ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glIsEnabled      },
+        {"glGetIntegerv"    ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glGetIntegerv    },
+        {"glGetIntegeri_v"  ,(ge::gl::FUNCTION_POINTER)&RecordingLoader::glGetIntegeri_v  },
+      };
+      return s;
+    }
+};
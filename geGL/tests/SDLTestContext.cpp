@@ -0,0 +1,16 @@
+#include<TestContext.h>
+#include<SDLWin.h>
+#include<geGL/geGL.h>
+
+TestContext::TestContext(){
+  auto const win = new SDLWin();
+  win->beginFrame();
+  ge::gl::init();
+  impl = win;
+}
+
+TestContext::~TestContext(){
+  auto const win = (SDLWin*)impl;
+  win->endFrame();
+  delete win;
+}
@@ -0,0 +1,113 @@
+#include<catch.hpp>
+#include<RecordingLoader.h>
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("State cache drops redundant binds"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>(),STATE_CACHE_TABLE);
+
+  table->glUseProgram(1);
+  table->glUseProgram(1);
+  table->glUseProgram(2);
+  table->glUseProgram(1);
+  REQUIRE(RecordingLoader::count("glUseProgram") == 3);
+
+  table->glBindBuffer(GL_ARRAY_BUFFER        ,3);
+  table->glBindBuffer(GL_ARRAY_BUFFER        ,3);
+  table->glBindBuffer(GL_SHADER_STORAGE_BUFFER,3);
+  REQUIRE(RecordingLoader::count("glBindBuffer") == 2);
+
+  table->glEnable (GL_DEPTH_TEST);
+  table->glEnable (GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  table->glDisable(GL_DEPTH_TEST);
+  REQUIRE(RecordingLoader::count("glEnable" ) == 1);
+  REQUIRE(RecordingLoader::count("glDisable") == 1);
+  REQUIRE(table->glIsEnabled(GL_DEPTH_TEST) == GL_FALSE);
+  REQUIRE(RecordingLoader::count("glIsEnabled") == 0);
+
+  table->glBindSampler(0,4);
+  table->glBindSampler(1,4);
+  table->glBindSampler(0,4);
+  REQUIRE(RecordingLoader::count("glBindSampler") == 2);
+}
+
+TEST_CASE("State cache tracks implicit state changes"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>(),STATE_CACHE_TABLE);
+
+  table->glBindVertexArray(1);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,2);
+  table->glBindVertexArray(3);
+  table->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,2);
+  REQUIRE(RecordingLoader::count("glBindBuffer") == 2);
+
+  table->glBindBufferBase(GL_UNIFORM_BUFFER,0,5);
+  table->glBindBuffer    (GL_UNIFORM_BUFFER,5);
+  table->glBindBufferBase(GL_UNIFORM_BUFFER,0,5);
+  table->glBindBufferRange(GL_UNIFORM_BUFFER,0,5,0,16);
+  REQUIRE(RecordingLoader::count("glBindBufferBase" ) == 1);
+  REQUIRE(RecordingLoader::count("glBindBufferRange") == 1);
+  REQUIRE(RecordingLoader::count("glBindBuffer"     ) == 2);
+
+  GLuint const buffer = 5;
+  table->glDeleteBuffers(1,&buffer);
+  table->glBindBuffer(GL_UNIFORM_BUFFER,0);
+  REQUIRE(RecordingLoader::count("glBindBuffer") == 2);
+
+  table->glActiveTexture(GL_TEXTURE0);
+  table->glBindTexture(GL_TEXTURE_2D,7);
+  table->glBindTexture(GL_TEXTURE_2D,7);
+  table->glActiveTexture(GL_TEXTURE1);
+  table->glBindTexture(GL_TEXTURE_2D,7);
+  REQUIRE(RecordingLoader::count("glActiveTexture") == 2);
+  REQUIRE(RecordingLoader::count("glBindTexture"  ) == 2);
+
+  table->glBindTextureUnit(1,8);
+  table->glBindTextureUnit(1,8);
+  table->glBindTexture(GL_TEXTURE_2D,7);
+  table->glBindTextureUnit(1,8);
+  REQUIRE(RecordingLoader::count("glBindTextureUnit") == 2);
+  REQUIRE(RecordingLoader::count("glBindTexture"    ) == 3);
+
+  GLuint const texture = 7;
+  table->glActiveTexture(GL_TEXTURE0);
+  table->glDeleteTextures(1,&texture);
+  table->glBindTexture(GL_TEXTURE_2D,0);
+  REQUIRE(RecordingLoader::count("glBindTexture") == 3);
+
+  table->glEnable (GL_BLEND  );
+  table->glEnablei(GL_BLEND,1);
+  table->glEnable (GL_BLEND  );
+  REQUIRE(RecordingLoader::count("glEnable") == 2);
+}
+
+TEST_CASE("State cache invalidation"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>(),STATE_CACHE_TABLE);
+
+  table->glUseProgram(1);
+  table->glBindVertexArray(2);
+  table->glEnable(GL_CULL_FACE);
+  invalidateStateCache(table);
+  table->glUseProgram(1);
+  table->glBindVertexArray(2);
+  table->glEnable(GL_CULL_FACE);
+  REQUIRE(RecordingLoader::count("glUseProgram"     ) == 2);
+  REQUIRE(RecordingLoader::count("glBindVertexArray") == 2);
+  REQUIRE(RecordingLoader::count("glEnable"         ) == 2);
+}
+
+TEST_CASE("Default table does not cache state"){
+  RecordingLoader::reset();
+  auto const table = createTable(make_shared<RecordingLoader>());
+
+  table->glUseProgram(1);
+  table->glUseProgram(1);
+  invalidateStateCache(table);
+  REQUIRE(RecordingLoader::count("glUseProgram") == 2);
+}
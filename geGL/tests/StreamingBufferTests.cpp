@@ -0,0 +1,64 @@
+#include<catch.hpp>
+#include<BusyGPULoader.h>
+#include<TestContext.h>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstring>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("StreamingBuffer allocates aligned ranges of frame regions"){
+  TestContext context;
+  StreamingBuffer stream(256,3);
+  REQUIRE(stream.getBuffer()->getSize() == 256*3);
+  REQUIRE(stream.getBuffer()->isImmutable() == GL_TRUE);
+  REQUIRE_THROWS(stream.allocate(4));
+
+  for(size_t f=0;f<4;++f){
+    REQUIRE(stream.beginFrame());
+    REQUIRE(stream.getFrame() == f%3);
+    auto const a = stream.allocate(3);
+    auto const b = stream.allocate(sizeof(float)*2,16);
+    REQUIRE(a.offset == (GLintptr)(256*(f%3)));
+    REQUIRE(b.offset == a.offset+16);
+    REQUIRE(stream.getFrameRemaining() == 256-16-8);
+    float const data[2] = {(float)f,1.f};
+    std::memcpy(b.pointer,data,sizeof(data));
+    float read[2] = {};
+    stream.getBuffer()->getData(read,sizeof(read),b.offset);
+    REQUIRE(read[0] == (float)f);
+    REQUIRE(read[1] == 1.f);
+    REQUIRE_THROWS(stream.allocate(256));
+    stream.getBuffer()->bindRange(GL_UNIFORM_BUFFER,0,b.offset,b.size);
+    stream.endFrame();
+  }
+
+  auto const&s = stream.getStatistics();
+  REQUIRE(s.frames         == 4);
+  REQUIRE(s.waits          == 1);
+  REQUIRE(s.stalls         == 0);
+  REQUIRE(s.allocatedBytes == 4*(16+8));
+}
+
+TEST_CASE("StreamingBuffer reports stalls when CPU is ahead of GPU"){
+  BusyGPULoader::blockingWaits() = 0;
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  {
+    StreamingBuffer stream(table,64,2);
+    for(size_t f=0;f<5;++f){
+      REQUIRE(stream.beginFrame());
+      stream.allocate(64);
+      stream.endFrame();
+    }
+    auto const&s = stream.getStatistics();
+    REQUIRE(s.waits    == 3);
+    REQUIRE(s.stalls   == 3);
+    REQUIRE(s.timeouts == 0);
+    REQUIRE(BusyGPULoader::blockingWaits() == 3);
+    stream.resetStatistics();
+    REQUIRE(stream.getStatistics().waits == 0);
+  }
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
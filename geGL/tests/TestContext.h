@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * @brief OpenGL context of test case.
+ * It creates context, makes it current and initialises geGL.
+ * tests target uses SDL window (SDLTestContext.cpp),
+ * headlessTests target uses NullFunctionLoader (NullTestContext.cpp).
+ */
+class TestContext{
+  public:
+    TestContext();
+    ~TestContext();
+  private:
+    void*impl = nullptr;
+};
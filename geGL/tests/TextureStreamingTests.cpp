@@ -0,0 +1,123 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  vector<size_t>const levelSizes = {64,16,4,1};
+}
+
+TEST_CASE("TextureResidency keeps coarse levels and loads requested ones"){
+  TextureResidency residency(100);
+  auto const id = residency.add(levelSizes);
+  REQUIRE(residency.getResidentLevel(id) == 3);
+  REQUIRE(residency.getResidentBytes() == 1);
+  REQUIRE(residency.update().empty());
+
+  residency.request(id,2);
+  residency.request(id,0);
+  auto const changes = residency.update();
+  REQUIRE(changes.size() == 1);
+  REQUIRE(changes[0].from == 3);
+  REQUIRE(changes[0].to   == 0);
+  REQUIRE(residency.getResidentBytes() == 85);
+  REQUIRE(residency.getStatistics().loadedLevels == 3);
+
+  auto const coarse = residency.add(levelSizes,2);
+  REQUIRE(residency.getResidentLevel(coarse) == 2);
+  REQUIRE(residency.getResidentBytes() == 90);
+}
+
+TEST_CASE("TextureResidency loads coarse levels of all textures first"){
+  TextureResidency residency(1+1+4+4+16+16);
+  auto const a = residency.add(levelSizes);
+  auto const b = residency.add(levelSizes);
+  residency.request(a,0);
+  residency.request(b,0);
+  residency.update();
+  REQUIRE(residency.getResidentLevel(a) == 1);
+  REQUIRE(residency.getResidentLevel(b) == 1);
+  REQUIRE(residency.getResidentBytes() == 42);
+  REQUIRE(residency.getStatistics().deniedLevels == 2);
+}
+
+TEST_CASE("TextureResidency evicts least recently used levels"){
+  TextureResidency residency(86);
+  auto const a = residency.add(levelSizes);
+  auto const b = residency.add(levelSizes);
+  residency.request(a,0);
+  residency.update();
+  REQUIRE(residency.getResidentLevel(a) == 0);
+
+  residency.request(b,0);
+  auto const changes = residency.update();
+  REQUIRE(changes.size() == 2);
+  REQUIRE(changes[0].id == a);
+  REQUIRE(changes[0].to == 3);
+  REQUIRE(changes[1].id == b);
+  REQUIRE(changes[1].to == 0);
+  REQUIRE(residency.getResidentBytes() == 86);
+  REQUIRE(residency.getStatistics().evictedLevels == 3);
+
+  residency.setBudget(20);
+  residency.update();
+  REQUIRE(residency.getResidentLevel(b) == 2);
+  REQUIRE(residency.getResidentBytes() == 6);
+  REQUIRE(residency.getStatistics().peakResidentBytes == 86);
+}
+
+TEST_CASE("TextureResidency reuses ids and rejects invalid ones"){
+  TextureResidency residency(100);
+  auto const a = residency.add(levelSizes);
+  residency.add(levelSizes);
+  residency.remove(a);
+  REQUIRE(!residency.isValid(a));
+  REQUIRE(residency.getResidentBytes() == 1);
+  REQUIRE_THROWS(residency.request(a,0));
+  REQUIRE_THROWS(residency.remove(a));
+  REQUIRE(residency.add(levelSizes) == a);
+  REQUIRE(residency.getStatistics().nofTextures == 2);
+  REQUIRE_THROWS(residency.add({}));
+}
+
+TEST_CASE("TextureResidency computes level from screen-space size"){
+  REQUIRE(TextureResidency::computeLevel(1024,512 ,256 ,256 ,11) == 2 );
+  REQUIRE(TextureResidency::computeLevel(300 ,300 ,100 ,100 ,9 ) == 1 );
+  REQUIRE(TextureResidency::computeLevel(1024,1024,2000,2000,11) == 0 );
+  REQUIRE(TextureResidency::computeLevel(1024,1024,0   ,0   ,11) == 10);
+  REQUIRE(TextureResidency::computeLevel(1024,1024,1   ,1   ,5 ) == 4 );
+}
+
+TEST_CASE("TextureStreamer uploads levels and clamps sampling"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  vector<GLint>uploads;
+  auto const loader = [&uploads](Texture&,GLint level){uploads.push_back(level);};
+
+  TextureStreamer streamer(table,1<<20);
+  auto const id = streamer.create(GL_TEXTURE_2D,GL_RGBA8,64,64,loader);
+  auto const&texture = *streamer.getTexture(id);
+  REQUIRE(texture.getImmutableLevels() == 7);
+  REQUIRE(uploads == vector<GLint>({6}));
+  REQUIRE(texture.getBaseLevel() == 6);
+
+  streamer.request(id,16.f,16.f);
+  REQUIRE(streamer.update() == 4);
+  REQUIRE(uploads == vector<GLint>({6,5,4,3,2}));
+  REQUIRE(texture.getBaseLevel() == 2);
+
+  streamer.getResidency().setBudget(100);
+  REQUIRE(streamer.update() == 0);
+  REQUIRE(texture.getBaseLevel() == 4);
+  REQUIRE(streamer.getResidency().getResidentBytes() == 84);
+
+  TextureStreamer lodStreamer(table,1<<20,TextureStreamer::MIN_LOD);
+  auto const lodId = lodStreamer.create(GL_TEXTURE_2D,GL_RGBA8,16,16,loader,2);
+  REQUIRE(lodStreamer.getTexture(lodId)->getMinLod() == 3.f);
+  REQUIRE(lodStreamer.getTexture(lodId)->getBaseLevel() == 0);
+  REQUIRE_THROWS(lodStreamer.request(lodId+1,0));
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
@@ -0,0 +1,95 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+#include<string>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  size_t countQueries(FunctionTablePointer const&table){
+    size_t result = 0;
+    for(auto const&p:getProfiling(table)->getProfile())
+      if(p.name.compare(0,5,"glGet") == 0)result += p.calls;
+    return result;
+  }
+}
+
+TEST_CASE("Texture answers metadata getters from memory"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  Texture texture(table,GL_TEXTURE_2D_ARRAY,GL_RGBA8,4,64,32,6);
+  texture.texParameteri(GL_TEXTURE_MIN_FILTER,GL_LINEAR);
+  GLfloat border[4] = {1.f,.5f,.25f,0.f};
+  texture.texParameterfv(GL_TEXTURE_BORDER_COLOR,border);
+  getProfiling(table)->resetProfile();
+
+  REQUIRE(texture.getWidth (0) == 64);
+  REQUIRE(texture.getHeight(2) == 8 );
+  REQUIRE(texture.getDepth (3) == 6 );
+  REQUIRE(texture.getInternalFormat(1) == GL_RGBA8);
+  REQUIRE(texture.getSamples(0) == 0);
+  REQUIRE(texture.getCompressed(0) == GL_FALSE);
+  REQUIRE(texture.getMinFilter() == GL_LINEAR);
+  REQUIRE(texture.getMagFilter() == GL_LINEAR);
+  REQUIRE(texture.getWrapS() == GL_REPEAT);
+  REQUIRE(texture.getSwizzleA() == GL_ALPHA);
+  REQUIRE(texture.getMaxLevel() == 1000);
+  REQUIRE(texture.getMinLod() == -1000.f);
+  GLfloat color[4];
+  texture.getBorderColor(color);
+  REQUIRE(color[1] == .5f);
+  REQUIRE(texture.getImmutableFormat() == GL_TRUE);
+  REQUIRE(texture.getImmutableLevels() == 4);
+  REQUIRE(texture.getLevelSize(0) == 64*32*6*4);
+  REQUIRE(texture.getSize() == (64*32+32*16+16*8+8*4)*6*4);
+  REQUIRE(countQueries(table) == 0);
+
+  REQUIRE(texture.getWidth(7) == 0);
+  REQUIRE(countQueries(table) > 0);
+}
+
+TEST_CASE("Texture metadata matches driver"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  Texture::setDriverVerification(true);
+  Texture t1D  (table,GL_TEXTURE_1D      ,GL_R32F             ,3,16);
+  Texture t2D  (table,GL_TEXTURE_2D      ,GL_DEPTH24_STENCIL8 ,5,20,12);
+  Texture t3D  (table,GL_TEXTURE_3D      ,GL_RGBA16F          ,3,8,8,4);
+  Texture tCube(table,GL_TEXTURE_CUBE_MAP,GL_RGBA8            ,2,8,8);
+  Texture mutableTexture(table,GL_TEXTURE_2D,GL_RGBA8,0,16,4);
+  mutableTexture.generateMipmap();
+  t2D.texParameteri(GL_TEXTURE_COMPARE_MODE,GL_COMPARE_REF_TO_TEXTURE);
+  GLfloat lod = 2.f;
+  t2D.texParameterfv(GL_TEXTURE_MIN_LOD,&lod);
+  GLfloat const swizzle[4] = {GL_ONE,GL_ZERO,GL_RED,GL_GREEN};
+  t3D.texParameterfv(GL_TEXTURE_SWIZZLE_RGBA,(GLfloat*)swizzle);
+
+  for(auto const t:{&t1D,&t2D,&t3D,&tCube,&mutableTexture}){
+    REQUIRE_NOTHROW(t->getInfo());
+    for(GLint l=0;l<5;++l){
+      REQUIRE_NOTHROW(t->getWidth (l));
+      REQUIRE_NOTHROW(t->getHeight(l));
+      REQUIRE_NOTHROW(t->getDepth (l));
+      REQUIRE_NOTHROW(t->getInternalFormat(l));
+    }
+  }
+  REQUIRE(mutableTexture.getWidth(4) == 1);
+  REQUIRE(mutableTexture.getImmutableFormat() == GL_FALSE);
+
+  table->glTextureParameteri(t2D.getId(),GL_TEXTURE_MAG_FILTER,GL_NEAREST);
+  REQUIRE_THROWS(t2D.getMagFilter());
+  Texture::setDriverVerification(false);
+  REQUIRE(t2D.getMagFilter() == GL_LINEAR);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Texture size queries driver for levels behind cache"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  Texture texture(table,GL_TEXTURE_2D,GL_RGBA8,0,8,4);
+  REQUIRE(texture.getSize() == 8*4*4);
+  table->glTextureImage2DEXT(texture.getId(),GL_TEXTURE_2D,1,GL_RGBA8,4,2,0,GL_RGBA,GL_UNSIGNED_BYTE,nullptr);
+  table->glTextureImage2DEXT(texture.getId(),GL_TEXTURE_2D,2,GL_RGBA8,2,1,0,GL_RGBA,GL_UNSIGNED_BYTE,nullptr);
+  REQUIRE(texture.getSize() == (8*4+4*2+2*1)*4);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
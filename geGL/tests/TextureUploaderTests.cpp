@@ -0,0 +1,115 @@
+#include<catch.hpp>
+#include<BusyGPULoader.h>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+#include<atomic>
+#include<chrono>
+#include<cstring>
+#include<thread>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  TextureUploader::Decoder fill(uint8_t value){
+    return [value](void*pixels,size_t size){memset(pixels,value,size);};
+  }
+}
+
+TEST_CASE("TextureUploader issues uploads within per-frame budget"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const texture = make_shared<Texture>(table,GL_TEXTURE_2D,GL_RGBA8,5,16,16);
+  TextureUploader uploader(table,4096,0);
+  uploader.setBudget(300,chrono::microseconds(0));
+
+  vector<GLint>done;
+  for(GLint l=4;l>=0;--l)
+    uploader.upload(texture,l,GL_RGBA,GL_UNSIGNED_BYTE,fill(uint8_t(l)),[&done,l]{done.push_back(l);});
+  REQUIRE(uploader.getNofPending() == 5);
+
+  REQUIRE(uploader.pump() == 4);
+  REQUIRE(done == vector<GLint>({4,3,2,1}));
+  REQUIRE(uploader.getStatistics().budgetStops == 1);
+  REQUIRE(uploader.pump() == 1);
+  REQUIRE(done == vector<GLint>({4,3,2,1,0}));
+  REQUIRE(uploader.pump() == 0);
+  REQUIRE(uploader.getNofPending() == 0);
+
+  auto const&stats = uploader.getStatistics();
+  REQUIRE(stats.requests == 5);
+  REQUIRE(stats.uploads == 5);
+  REQUIRE(stats.bytesUploaded == 4+16+64+256+1024);
+  REQUIRE(stats.frames == 2);
+
+  GLint value = 0;
+  table->glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING,&value);
+  REQUIRE(value == 0);
+  table->glGetIntegerv(GL_UNPACK_ALIGNMENT,&value);
+  REQUIRE(value == 4);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("TextureUploader reuses staging slices after their fences"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  auto const a = make_shared<Texture>(table,GL_TEXTURE_2D,GL_RGBA8,1,16,16);
+  auto const b = make_shared<Texture>(table,GL_TEXTURE_2D,GL_RGBA8,1,16,16);
+  TextureUploader uploader(table,1536,0);
+  uploader.upload(a,0,GL_RGBA,GL_UNSIGNED_BYTE,fill(1));
+  uploader.upload(b,0,GL_RGBA,GL_UNSIGNED_BYTE,fill(2));
+
+  REQUIRE(uploader.pump() == 1);
+  REQUIRE(uploader.pump() == 0);
+  REQUIRE(uploader.getStatistics().stagingStalls == 2);
+  REQUIRE(uploader.getNofPending() == 1);
+
+  uploader.finish();
+  REQUIRE(uploader.getNofPending() == 0);
+  REQUIRE(uploader.getStatistics().uploads == 2);
+
+  REQUIRE_THROWS(uploader.upload(a,0,0,0,0,32,32,0,GL_RGBA,GL_UNSIGNED_BYTE,fill(0)));
+  REQUIRE_THROWS(uploader.upload(nullptr,0,GL_RGBA,GL_UNSIGNED_BYTE,fill(0)));
+}
+
+TEST_CASE("TextureUploader decodes on worker threads"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const array = make_shared<Texture>(table,GL_TEXTURE_2D_ARRAY,GL_RGBA8,1,8,8,16);
+  TextureUploader uploader(table,1024,2);
+
+  auto const mainThread = this_thread::get_id();
+  atomic<size_t>offThread{0};
+  size_t done = 0;
+  for(GLint layer=0;layer<16;++layer)
+    uploader.upload(array,0,0,0,layer,8,8,1,GL_RGBA,GL_UNSIGNED_BYTE,
+        [&offThread,mainThread](void*pixels,size_t size){
+          if(this_thread::get_id() != mainThread)offThread++;
+          memset(pixels,0xff,size);
+        },[&done]{done++;});
+
+  uploader.finish();
+  REQUIRE(done == 16);
+  REQUIRE(offThread == 16);
+  REQUIRE(uploader.getStatistics().bytesUploaded == 16*8*8*4);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("TextureUploader uploads cube maps face by face"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  auto const cube = make_shared<Texture>(table,GL_TEXTURE_CUBE_MAP,GL_RGBA8,1,8,8);
+  TextureUploader uploader(table,4096,0);
+  uploader.upload(cube,0,GL_RGBA,GL_UNSIGNED_BYTE,fill(3));
+  uploader.finish();
+  REQUIRE(uploader.getStatistics().uploads       == 1);
+  REQUIRE(uploader.getStatistics().bytesUploaded == 6*8*8*4);
+  size_t faces   = 0;
+  size_t volumes = 0;
+  for(auto const&p:getProfiling(table)->getProfile()){
+    if(p.name == "glTextureSubImage2DEXT")faces   = p.calls;
+    if(p.name == "glTextureSubImage3DEXT")volumes = p.calls;
+  }
+  REQUIRE(faces   == 6);
+  REQUIRE(volumes == 0);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
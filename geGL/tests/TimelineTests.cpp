@@ -0,0 +1,97 @@
+#include<catch.hpp>
+#include<BusyGPULoader.h>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstdint>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+TEST_CASE("Sync polls and waits on fence"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  Sync fence(table);
+  REQUIRE(fence.getSync() != nullptr);
+  REQUIRE(fence.getId() == 0);
+  REQUIRE(!fence.isSignaled());
+  fence.serverWait();
+  REQUIRE(fence.wait(1000));
+  REQUIRE(fence.isSignaled());
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Timeline retires frames without blocking"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  Timeline timeline(table);
+  REQUIRE(timeline.getCurrentFrame() == 1);
+  REQUIRE(timeline.isRetired(0));
+  REQUIRE(timeline.endFrame() == 1);
+  REQUIRE(timeline.endFrame() == 2);
+  REQUIRE(timeline.endFrame() == 3);
+  REQUIRE(timeline.getLastSubmittedFrame() == 3);
+  REQUIRE(timeline.getNofPendingFrames() == 3);
+
+  REQUIRE(timeline.poll() == 0);
+  REQUIRE(!timeline.isRetired(1));
+  REQUIRE(!timeline.isRetired(4));
+
+  BusyGPULoader::completed() = 2;
+  REQUIRE(timeline.isRetired(1));
+  REQUIRE(timeline.getLastRetiredFrame() == 1);
+  REQUIRE(timeline.poll() == 1);
+  REQUIRE(timeline.getLastRetiredFrame() == 2);
+  REQUIRE(!timeline.isRetired(3));
+  REQUIRE(timeline.getNofPendingFrames() == 1);
+
+  REQUIRE(timeline.wait(3));
+  REQUIRE(timeline.isRetired(3));
+  REQUIRE(timeline.getNofPendingFrames() == 0);
+  REQUIRE_THROWS(timeline.wait(4));
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("Timeline calls callbacks of retired frames in order"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  Timeline timeline(table);
+  vector<uint64_t>calls;
+  for(int i=0;i<4;++i){
+    auto const frame = timeline.getCurrentFrame();
+    timeline.onRetired(frame,[&calls,frame]{calls.push_back(frame);});
+    timeline.endFrame();
+  }
+  timeline.onRetired(2,[&calls]{calls.push_back(20);});
+  REQUIRE(timeline.getNofCallbacks() == 5);
+
+  timeline.poll();
+  REQUIRE(calls.empty());
+
+  BusyGPULoader::completed() = 2;
+  timeline.poll();
+  REQUIRE(calls == vector<uint64_t>({1,2,20}));
+
+  timeline.onRetired(1,[&calls]{calls.push_back(10);});
+  REQUIRE(calls.back() == 10);
+
+  timeline.finish();
+  REQUIRE(calls == vector<uint64_t>({1,2,20,10,3,4}));
+  REQUIRE(timeline.getNofCallbacks() == 0);
+}
+
+TEST_CASE("StreamingBuffer and AsyncReadback wait on simulated GPU latency"){
+  auto const table = createTable(make_shared<BusyGPULoader>());
+  StreamingBuffer stream(table,256,2);
+  for(int f=0;f<4;++f){
+    REQUIRE(stream.beginFrame());
+    stream.endFrame();
+  }
+  REQUIRE(stream.getStatistics().stalls == 2);
+
+  Buffer buffer(table,64);
+  AsyncReadback readback(table);
+  auto result = readback.read(buffer);
+  REQUIRE(readback.pump() == 0);
+  BusyGPULoader::completed() = UINTPTR_MAX;
+  REQUIRE(readback.pump() == 1);
+  REQUIRE(result.get().size() == 64);
+}
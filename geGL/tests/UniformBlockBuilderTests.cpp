@@ -0,0 +1,195 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstring>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  ProgramInfo::UniformBlockMemberProperties const&member(UniformBlockBuilder::Block const&block,string const&name){
+    return get<ProgramInfo::UNIFORM_BLOCK_MEMBERS>(block).at(name);
+  }
+  GLint offset(UniformBlockBuilder::Block const&block,string const&name){
+    return get<ProgramInfo::MEMBER_OFFSET>(member(block,name));
+  }
+  template<typename T>
+  T read(vector<uint8_t>const&data,size_t offset){
+    T result;
+    memcpy(&result,data.data()+offset,sizeof(T));
+    return result;
+  }
+
+  shared_ptr<Program>createProgram(FunctionTablePointer const&table){
+    auto const fs = make_shared<Shader>(table,GL_FRAGMENT_SHADER,Shader::Sources{
+        "#version 450\n",
+        "layout(std140,binding=3)uniform Material{\n"
+        "  vec4  color;\n"
+        "  float roughness;\n"
+        "  vec3  emission;\n"
+        "  mat4  model;\n"
+        "  float weights[2];\n"
+        "  layout(row_major) mat2 rot;\n"
+        "};\n"
+        "layout(std140,row_major)uniform Light{vec4 position;vec4 lights[2];mat2 rot;}light;\n"
+        "uniform vec4 tint;\n"
+        "out vec4 fColor;\n"
+        "void main(){fColor = color*tint+light.position;}\n"});
+    return make_shared<Program>(table,fs);
+  }
+}
+
+TEST_CASE("UniformBlockBuilder computes std140 layout"){
+  auto const block = UniformBlockBuilder::computeStd140Layout("Block",{
+      {"a",GL_FLOAT     },
+      {"b",GL_FLOAT_VEC2},
+      {"c",GL_FLOAT_VEC3},
+      {"d",GL_FLOAT     },
+      {"e",GL_FLOAT_MAT4},
+      {"f",GL_FLOAT     ,3},
+      {"g",GL_FLOAT_VEC3},
+      {"h",GL_FLOAT_MAT3},
+      {"i",GL_DOUBLE    },
+      {"j",GL_DOUBLE_VEC3},
+      {"k",GL_BOOL      },
+      {"l",GL_FLOAT_MAT2x3,0,true},
+      {"m",GL_FLOAT_MAT2x3},
+      {"n",GL_FLOAT_VEC4,2},
+      {"o",GL_FLOAT_VEC4,0,true},
+      },5);
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_NAME   >(block) == "Block");
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_BINDING>(block) == 5);
+  REQUIRE(offset(block,"a") == 0  );
+  REQUIRE(offset(block,"b") == 8  );
+  REQUIRE(offset(block,"c") == 16 );
+  REQUIRE(offset(block,"d") == 28 );
+  REQUIRE(offset(block,"e") == 32 );
+  REQUIRE(offset(block,"f") == 96 );
+  REQUIRE(offset(block,"g") == 144);
+  REQUIRE(offset(block,"h") == 160);
+  REQUIRE(offset(block,"i") == 208);
+  REQUIRE(offset(block,"j") == 224);
+  REQUIRE(offset(block,"k") == 248);
+  REQUIRE(offset(block,"l") == 256);
+  REQUIRE(offset(block,"m") == 304);
+  REQUIRE(offset(block,"n") == 336);
+  REQUIRE(offset(block,"o") == 368);
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_DATA_SIZE>(block) == 384);
+
+  REQUIRE(get<ProgramInfo::MEMBER_ARRAY_STRIDE >(member(block,"f")) == 16);
+  REQUIRE(get<ProgramInfo::MEMBER_SIZE         >(member(block,"f")) == 3 );
+  REQUIRE(get<ProgramInfo::MEMBER_ARRAY_STRIDE >(member(block,"a")) == 0 );
+  REQUIRE(get<ProgramInfo::MEMBER_SIZE         >(member(block,"a")) == 1 );
+  REQUIRE(get<ProgramInfo::MEMBER_MATRIX_STRIDE>(member(block,"e")) == 16);
+  REQUIRE(get<ProgramInfo::MEMBER_MATRIX_STRIDE>(member(block,"a")) == 0 );
+  REQUIRE(get<ProgramInfo::MEMBER_ROW_MAJOR    >(member(block,"l")) == 1 );
+  REQUIRE(get<ProgramInfo::MEMBER_ROW_MAJOR    >(member(block,"o")) == 0 );
+
+  auto const doubles = UniformBlockBuilder::computeStd140Layout("Doubles",{
+      {"a",GL_DOUBLE     ,2},
+      {"b",GL_DOUBLE_MAT3  },
+      {"c",GL_FLOAT        }});
+  REQUIRE(get<ProgramInfo::MEMBER_ARRAY_STRIDE >(member(doubles,"a")) == 16);
+  REQUIRE(get<ProgramInfo::MEMBER_MATRIX_STRIDE>(member(doubles,"b")) == 32);
+  REQUIRE(offset(doubles,"b") == 32 );
+  REQUIRE(offset(doubles,"c") == 128);
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_DATA_SIZE>(doubles) == 160);
+
+  REQUIRE_THROWS_AS(UniformBlockBuilder::computeStd140Layout("Bad",{{"s",GL_SAMPLER_2D}}),invalid_argument);
+}
+
+TEST_CASE("Program reflects uniform blocks"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const program = createProgram(table);
+  auto const&blocks = program->getInfo()->uniformBlocks;
+  REQUIRE(blocks.size() == 2);
+  auto const&material = blocks.at("Material");
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_BINDING  >(material) == 3  );
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_DATA_SIZE>(material) == 176);
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_MEMBERS  >(material).size() == 6);
+  REQUIRE(offset(material,"roughness") == 16 );
+  REQUIRE(offset(material,"emission" ) == 32 );
+  REQUIRE(offset(material,"model"    ) == 48 );
+  REQUIRE(offset(material,"weights"  ) == 112);
+  REQUIRE(offset(material,"rot"      ) == 144);
+  REQUIRE(get<ProgramInfo::MEMBER_TYPE        >(member(material,"model"  )) == GL_FLOAT_MAT4);
+  REQUIRE(get<ProgramInfo::MEMBER_SIZE        >(member(material,"weights")) == 2 );
+  REQUIRE(get<ProgramInfo::MEMBER_ARRAY_STRIDE>(member(material,"weights")) == 16);
+  REQUIRE(get<ProgramInfo::MEMBER_ROW_MAJOR   >(member(material,"rot"    )) == 1 );
+  auto const&light = blocks.at("Light");
+  REQUIRE(get<ProgramInfo::UNIFORM_BLOCK_DATA_SIZE>(light) == 80);
+  REQUIRE(offset(light,"Light.lights") == 16);
+  REQUIRE(offset(light,"Light.rot"   ) == 48);
+  REQUIRE(get<ProgramInfo::MEMBER_ROW_MAJOR>(member(light,"Light.position")) == 0);
+  REQUIRE(get<ProgramInfo::MEMBER_ROW_MAJOR>(member(light,"Light.rot"     )) == 1);
+  REQUIRE(program->getUniformLocation("tint") >= 0);
+  REQUIRE(get<ProgramInfo::LOCATION>(program->getInfo()->uniforms.at("color")) == -1);
+
+  Program loaded(table);
+  GLenum format;
+  auto const binary = program->getBinary(format);
+  REQUIRE(loaded.setBinary(format,binary.data(),(GLsizei)binary.size()));
+  REQUIRE(loaded.getInfo()->uniformBlocks == blocks);
+}
+
+TEST_CASE("UniformBlockBuilder writes members and uploads block once"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const program = createProgram(table);
+  UniformBlockBuilder material(*program,"Material");
+  REQUIRE(material.getSize() == 176);
+  REQUIRE(material.getBinding() == 3);
+  REQUIRE(material.has("weights[1]"));
+  REQUIRE(!material.has("tint"));
+
+  float const weights[2] = {2.f,3.f};
+  float const rot[4] = {1.f,2.f,3.f,4.f};
+  material
+    .set("roughness",.5f)
+    .set("color",1.f,0.f,0.f,1.f)
+    .setv("weights",weights,2)
+    .set("weights[1]",7.f)
+    .setv("rot",rot);
+  auto const&data = material.getData();
+  REQUIRE(read<float>(data,0  ) == 1.f);
+  REQUIRE(read<float>(data,12 ) == 1.f);
+  REQUIRE(read<float>(data,16 ) == .5f);
+  REQUIRE(read<float>(data,112) == 2.f);
+  REQUIRE(read<float>(data,128) == 7.f);
+  REQUIRE(read<float>(data,144) == 1.f);
+  REQUIRE(read<float>(data,148) == 3.f);
+  REQUIRE(read<float>(data,160) == 2.f);
+  REQUIRE(read<float>(data,164) == 4.f);
+
+  REQUIRE_THROWS_AS(material.set("color",1.f),invalid_argument);
+  REQUIRE_THROWS_AS(material.set("roughness",1),invalid_argument);
+  REQUIRE_THROWS_AS(material.set("weights[2]",1.f),invalid_argument);
+  REQUIRE_THROWS_AS(material.set("missing",1.f),invalid_argument);
+  REQUIRE(material.getStatistics().writes == 5);
+
+  material.upload();
+  material.upload();
+  REQUIRE(material.getStatistics().uploads == 1);
+  REQUIRE(material.getStatistics().binds   == 2);
+  GLint bound = 0;
+  table->glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING,3,&bound);
+  REQUIRE((GLuint)bound == material.getBuffer()->getId());
+  vector<uint8_t>uploaded(material.getSize());
+  material.getBuffer()->getData(uploaded.data(),(GLsizeiptr)uploaded.size());
+  REQUIRE(uploaded == data);
+
+  UniformBlockBuilder light(table,program->getInfo()->uniformBlocks.at("Light"));
+  light.setBinding(1);
+  light.set("position",1.f,2.f,3.f,1.f);
+  light.set("Light.lights[1]",4.f,4.f,4.f,4.f);
+  REQUIRE(read<float>(light.getData(),4 ) == 2.f);
+  REQUIRE(read<float>(light.getData(),32) == 4.f);
+  light.upload();
+  table->glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING,1,&bound);
+  REQUIRE((GLuint)bound == light.getBuffer()->getId());
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+
+  REQUIRE_THROWS_AS(UniformBlockBuilder(*program,"Missing"),invalid_argument);
+}
@@ -0,0 +1,192 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  /**
+   * @brief Null function loader that records glProgramUniform*v calls.
+   */
+  class UniformRecordingLoader: public NullFunctionLoader{
+    public:
+      struct Call{
+        string        name    ;
+        GLint         location;
+        GLsizei       count   ;
+        vector<float> values  ;
+      };
+      static vector<Call>calls;
+      virtual FUNCTION_POINTER load(char const*fceName)const override{
+        string const name = fceName;
+        if(name == "glProgramUniform4fv"      )return (FUNCTION_POINTER)glProgramUniform4fv;
+        if(name == "glProgramUniform1iv"      )return (FUNCTION_POINTER)glProgramUniform1iv;
+        if(name == "glProgramUniform2uiv"     )return (FUNCTION_POINTER)glProgramUniform2uiv;
+        if(name == "glProgramUniformMatrix4fv")return (FUNCTION_POINTER)glProgramUniformMatrix4fv;
+        return NullFunctionLoader::load(fceName);
+      }
+    protected:
+      template<typename T>
+      static void record(char const*name,GLint location,GLsizei count,size_t components,T const*v){
+        calls.push_back({name,location,count,vector<float>(v,v+count*components)});
+      }
+      static void glProgramUniform4fv(GLuint,GLint location,GLsizei count,GLfloat const*v){
+        record("glProgramUniform4fv",location,count,4,v);
+      }
+      static void glProgramUniform1iv(GLuint,GLint location,GLsizei count,GLint const*v){
+        record("glProgramUniform1iv",location,count,1,v);
+      }
+      static void glProgramUniform2uiv(GLuint,GLint location,GLsizei count,GLuint const*v){
+        record("glProgramUniform2uiv",location,count,2,v);
+      }
+      static void glProgramUniformMatrix4fv(GLuint,GLint location,GLsizei count,GLboolean,GLfloat const*v){
+        record("glProgramUniformMatrix4fv",location,count,16,v);
+      }
+  };
+  vector<UniformRecordingLoader::Call>UniformRecordingLoader::calls;
+
+  shared_ptr<Program>createProgram(FunctionTablePointer const&table){
+    auto const vs = make_shared<Shader>(table,GL_VERTEX_SHADER,Shader::Sources{
+        "#version 450\n",
+        "uniform mat4 mvp;\nin vec4 position;\nvoid main(){gl_Position = mvp*position;}\n"});
+    auto const fs = make_shared<Shader>(table,GL_FRAGMENT_SHADER,Shader::Sources{
+        "#version 450\n",
+        "uniform vec4 color;\nuniform vec4 lights[4];\nuniform sampler2D tex;\nuniform bool enabled;\nuniform uvec2 size;\n"
+        "out vec4 fColor;\nvoid main(){fColor = color+lights[0]+texture(tex,vec2(size));}\n"});
+    return make_shared<Program>(table,vs,fs);
+  }
+}
+
+TEST_CASE("Program::getUniform returns typed handles"){
+  auto const table = createTable(make_shared<UniformRecordingLoader>());
+  auto const program = createProgram(table);
+  UniformRecordingLoader::calls.clear();
+
+  auto const color   = program->getUniform<GL_FLOAT_VEC4>("color"  );
+  auto const lights  = program->getUniform<GL_FLOAT_VEC4>("lights" );
+  auto const tex     = program->getUniform<GL_INT       >("tex"    );
+  auto const enabled = program->getUniform<GL_INT       >("enabled");
+  auto const mvp     = program->getUniform<GL_FLOAT_MAT4>("mvp"    );
+  auto const missing = program->getUniform<GL_FLOAT     >("missing");
+  REQUIRE(color.isValid());
+  REQUIRE(color.getLocation() == program->getUniformLocation("color"));
+  REQUIRE(color.getSize() == 1);
+  REQUIRE(lights.getSize() == 4);
+  REQUIRE(tex.isValid());
+  REQUIRE(enabled.isValid());
+  REQUIRE(!missing.isValid());
+  REQUIRE_THROWS_AS(program->getUniform<GL_FLOAT_VEC3>("color"),invalid_argument);
+  REQUIRE_THROWS_AS(program->getUniform<GL_UNSIGNED_INT>("tex"),invalid_argument);
+
+  program->set(color,1.f,0.f,0.f,1.f);
+  program->set(tex,3);
+  program->set(missing,1.f);
+  float const matrix[16] = {1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1};
+  program->setv(mvp,matrix);
+  float const lightValues[16] = {};
+  program->setv(lights,lightValues,4);
+
+  auto const&calls = UniformRecordingLoader::calls;
+  REQUIRE(calls.size() == 4);
+  REQUIRE(calls[0].name == "glProgramUniform4fv");
+  REQUIRE(calls[0].location == color.getLocation());
+  REQUIRE(calls[0].values == vector<float>({1.f,0.f,0.f,1.f}));
+  REQUIRE(calls[1].name == "glProgramUniform1iv");
+  REQUIRE(calls[1].values == vector<float>({3.f}));
+  REQUIRE(calls[2].name == "glProgramUniformMatrix4fv");
+  REQUIRE(calls[2].values[15] == 1.f);
+  REQUIRE(calls[3].location == lights.getLocation());
+  REQUIRE(calls[3].count == 4);
+}
+
+TEST_CASE("Program name based setters use uniform handles"){
+  auto const table = createTable(make_shared<UniformRecordingLoader>());
+  auto const program = createProgram(table);
+  UniformRecordingLoader::calls.clear();
+
+  program->set4f("color",.5f,.5f,.5f,1.f);
+  program->set2ui("size",640u,480u);
+  program->set1i("enabled",1);
+  program->set4f("lights[2]",1.f,1.f,1.f,1.f);
+  auto const&calls = UniformRecordingLoader::calls;
+  REQUIRE(calls.size() == 4);
+  REQUIRE(calls[0].location == program->getUniformLocation("color"));
+  REQUIRE(calls[0].values == vector<float>({.5f,.5f,.5f,1.f}));
+  REQUIRE(calls[1].name == "glProgramUniform2uiv");
+  REQUIRE(calls[1].values == vector<float>({640.f,480.f}));
+  REQUIRE(calls[2].name == "glProgramUniform1iv");
+  REQUIRE(calls[3].location == program->getUniformLocation("lights[2]"));
+
+  REQUIRE_THROWS_AS(program->set1f("missing",1.f),invalid_argument);
+  Program::setNonexistingUniformWarning(false);
+  REQUIRE_NOTHROW(program->set1f("missing",1.f));
+  Program::setNonexistingUniformWarning(true);
+  REQUIRE(calls.size() == 4);
+}
+
+TEST_CASE("Program uniform shadowing skips redundant updates"){
+  auto const table = createTable(make_shared<UniformRecordingLoader>());
+  auto const program = createProgram(table);
+  auto const&calls = UniformRecordingLoader::calls;
+  UniformRecordingLoader::calls.clear();
+
+  program->set4f("color",1.f,1.f,1.f,1.f);
+  program->set4f("color",1.f,1.f,1.f,1.f);
+  REQUIRE(!program->isUniformShadowingEnabled());
+  REQUIRE(calls.size() == 2);
+
+  program->setUniformShadowing();
+  REQUIRE(program->isUniformShadowingEnabled());
+  auto const before = program->getUniformStatistics();
+  auto const color = program->getUniform<GL_FLOAT_VEC4>("color");
+  program->set(color,1.f,1.f,1.f,1.f);
+  program->set(color,1.f,1.f,1.f,1.f);
+  program->set4f("color",1.f,1.f,1.f,1.f);
+  program->set(color,0.f,1.f,1.f,1.f);
+  REQUIRE(calls.size() == 4);
+  REQUIRE(calls[3].values == vector<float>({0.f,1.f,1.f,1.f}));
+
+  float const matrix[16] = {1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1};
+  program->setMatrix4fv("mvp",matrix);
+  program->setMatrix4fv("mvp",matrix);
+  program->setMatrix4fv("mvp",matrix,1,GL_TRUE);
+  program->setMatrix4fv("mvp",matrix);
+  REQUIRE(calls.size() == 7);
+
+  SECTION("array elements share shadow with the whole array"){
+    float const zeros[16] = {};
+    float const ones [4 ] = {1,1,1,1};
+    program->set4fv("lights",zeros,4);
+    program->set4fv("lights",zeros,4);
+    REQUIRE(calls.size() == 8);
+    program->set4f("lights[2]",0.f,0.f,0.f,0.f);
+    REQUIRE(calls.size() == 8);
+    program->set4fv("lights[2]",ones);
+    REQUIRE(calls.size() == 9);
+    program->set4fv("lights",zeros,4);
+    REQUIRE(calls.size() == 10);
+    program->set4fv("lights",zeros,2);
+    REQUIRE(calls.size() == 10);
+  }
+
+  SECTION("statistics count issued and skipped updates"){
+    auto const stats = program->getUniformStatistics();
+    REQUIRE(stats.issued  - before.issued  == 5);
+    REQUIRE(stats.skipped - before.skipped == 3);
+  }
+
+  SECTION("shadows are rebuilt by link and forgotten when shadowing is disabled"){
+    program->link();
+    program->set(color,0.f,1.f,1.f,1.f);
+    REQUIRE(calls.size() == 8);
+    program->set(color,0.f,1.f,1.f,1.f);
+    REQUIRE(calls.size() == 8);
+    program->setUniformShadowing(false);
+    program->set(color,0.f,1.f,1.f,1.f);
+    REQUIRE(calls.size() == 9);
+  }
+}
@@ -0,0 +1,191 @@
+#include<catch.hpp>
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+#include<cstring>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+using namespace std;
+
+namespace{
+  size_t countCalls(FunctionTablePointer const&table,string const&name){
+    for(auto const&p:getProfiling(table)->getProfile())
+      if(p.name == name)return p.calls;
+    return 0;
+  }
+
+  using GetIntegerv           = void(*)(GLenum,GLint*);
+  using GetNamedBufferSubData  = void(*)(GLuint,GLintptr,GLsizeiptr,void*);
+
+  /**
+   * @brief Null function loader that records RGBA8 texels of 2D sub-image uploads.
+   * Null context does not store texels, so they are read from bound pixel unpack buffer.
+   */
+  class TexelRecordingLoader: public NullFunctionLoader{
+    public:
+      struct Upload{
+        GLint          xoffset;
+        GLint          yoffset;
+        vector<uint8_t>texels ;
+      };
+      static vector<Upload>uploads;
+      virtual FUNCTION_POINTER load(char const*fceName)const override{
+        if(string(fceName) == "glGetIntegerv")
+          getIntegerv = (GetIntegerv)NullFunctionLoader::load(fceName);
+        if(string(fceName) == "glGetNamedBufferSubData")
+          getNamedBufferSubData = (GetNamedBufferSubData)NullFunctionLoader::load(fceName);
+        if(string(fceName) == "glTextureSubImage2DEXT")
+          return (FUNCTION_POINTER)glTextureSubImage2DEXT;
+        return NullFunctionLoader::load(fceName);
+      }
+    protected:
+      static GetIntegerv           getIntegerv          ;
+      static GetNamedBufferSubData getNamedBufferSubData;
+      static void glTextureSubImage2DEXT(GLuint,GLenum,GLint,GLint xoffset,GLint yoffset,GLsizei width,GLsizei height,GLenum,GLenum,void const*pixels){
+        Upload upload;
+        upload.xoffset = xoffset;
+        upload.yoffset = yoffset;
+        upload.texels.resize((size_t)(width*height*4));
+        GLint unpackBuffer = 0;
+        getIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING,&unpackBuffer);
+        if(unpackBuffer)getNamedBufferSubData((GLuint)unpackBuffer,(GLintptr)pixels,(GLsizeiptr)upload.texels.size(),upload.texels.data());
+        else std::memcpy(upload.texels.data(),pixels,upload.texels.size());
+        uploads.push_back(upload);
+      }
+  };
+  vector<TexelRecordingLoader::Upload>TexelRecordingLoader::uploads;
+  GetIntegerv           TexelRecordingLoader::getIntegerv           = nullptr;
+  GetNamedBufferSubData TexelRecordingLoader::getNamedBufferSubData = nullptr;
+}
+
+TEST_CASE("UploadBatch merges adjacent writes into one copy"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  auto const a = make_shared<Buffer>(table,1000*sizeof(float));
+  auto const b = make_shared<Buffer>(table,16*sizeof(float));
+  {
+    UploadBatch batch(table,1024);
+    getProfiling(table)->resetProfile();
+    for(int i=0;i<200;++i){
+      float const value = (float)i;
+      batch.setData(a.get(),&value,sizeof(float),i*sizeof(float));
+    }
+    vector<float>const c(16,7.f);
+    batch.setData(b.get(),c);
+    REQUIRE(batch.getNofPendingWrites() == 2);
+    batch.flush();
+    REQUIRE(batch.getNofPendingWrites() == 0);
+
+    auto const&s = batch.getStatistics();
+    REQUIRE(s.writes       == 201);
+    REQUIRE(s.bytesStaged  == 216*sizeof(float));
+    REQUIRE(s.copiesIssued == 2);
+    REQUIRE(s.merges       == 199);
+    REQUIRE(s.flushes      == 1);
+    REQUIRE(countCalls(table,"glNamedBufferSubData"    ) == 0);
+    REQUIRE(countCalls(table,"glCopyNamedBufferSubData") == 2);
+  }
+
+  vector<float>data;
+  a->getData(data);
+  for(int i=0;i<200;++i)REQUIRE(data[i] == (float)i);
+  b->getData(data);
+  REQUIRE(data[15] == 7.f);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("UploadBatch flushes when staging buffer is full"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const a = make_shared<Buffer>(table,4096);
+  vector<uint8_t>data(100);
+  for(size_t i=0;i<data.size();++i)data[i] = (uint8_t)i;
+  {
+    UploadBatch batch(table,256);
+    batch.setData(a.get(),data,0);
+    batch.setData(a.get(),data,1000);
+    batch.setData(a.get(),data,2000);
+    REQUIRE(batch.getStatistics().flushes == 1);
+    vector<uint8_t>const big(300,42);
+    batch.setData(a.get(),big,3000);
+    REQUIRE(batch.getStatistics().flushes       == 2);
+    REQUIRE(batch.getStatistics().directUploads == 1);
+  }
+  vector<uint8_t>read;
+  a->getData(read);
+  REQUIRE(read[2000+99] == 99);
+  REQUIRE(read[3000]    == 42);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("UploadBatch uploads textures from pixel unpack buffer"){
+  TexelRecordingLoader::uploads.clear();
+  auto const table = createTable(make_shared<TexelRecordingLoader>(),PROFILING_TABLE);
+  Texture texture(table,GL_TEXTURE_2D,GL_RGBA8,1,8,8);
+  vector<uint8_t>pixels0(4*4*4);
+  vector<uint8_t>pixels1(4*4*4);
+  for(size_t i=0;i<pixels0.size();++i){
+    pixels0[i] = (uint8_t)i;
+    pixels1[i] = (uint8_t)(255-i);
+  }
+  UploadBatch batch(table,1024);
+  getProfiling(table)->resetProfile();
+  batch.setTextureData(&texture,pixels0.data(),GL_RGBA,GL_UNSIGNED_BYTE,0,0,0,0,4,4);
+  batch.setTextureData(&texture,pixels1.data(),GL_RGBA,GL_UNSIGNED_BYTE,0,4,4,0,4,4);
+  REQUIRE(countCalls(table,"glTextureSubImage2DEXT") == 0);
+  batch.flush();
+  REQUIRE(countCalls(table,"glTextureSubImage2DEXT") == 2);
+  auto const&uploads = TexelRecordingLoader::uploads;
+  REQUIRE(uploads.size() == 2);
+  REQUIRE(uploads[0].xoffset == 0);
+  REQUIRE(uploads[0].texels  == pixels0);
+  REQUIRE(uploads[1].xoffset == 4);
+  REQUIRE(uploads[1].yoffset == 4);
+  REQUIRE(uploads[1].texels  == pixels1);
+  auto const queries = countCalls(table,"glGetIntegerv");
+  batch.setTextureData(&texture,pixels0.data(),GL_RGBA,GL_UNSIGNED_BYTE,0,4,0,0,4,4);
+  batch.flush();
+  REQUIRE(countCalls(table,"glGetIntegerv") == queries);
+  REQUIRE(uploads.size() == 3);
+  REQUIRE(uploads[2].texels == pixels0);
+  REQUIRE(batch.getStatistics().textureUploads == 3);
+  REQUIRE(batch.getStatistics().bytesStaged    == 3*4*4*4);
+  GLint binding = -1;
+  table->glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING,&binding);
+  REQUIRE(binding == 0);
+}
+
+TEST_CASE("UploadBatch reuses staging regions after their fences"){
+  auto const table = createTable(make_shared<NullFunctionLoader>());
+  auto const a = make_shared<Buffer>(table,4*sizeof(uint32_t));
+  {
+    UploadBatch batch(table,64,3);
+    REQUIRE(batch.getNofRegions() == 3);
+    for(uint32_t i=0;i<4;++i){
+      batch.setData(a.get(),&i,sizeof(i),i*sizeof(i));
+      batch.flush();
+    }
+    auto const&s = batch.getStatistics();
+    REQUIRE(s.flushes == 4);
+    REQUIRE(s.waits   == 1);
+    REQUIRE(s.stalls  == 0);
+  }
+  vector<uint32_t>read;
+  a->getData(read);
+  for(uint32_t i=0;i<4;++i)REQUIRE(read[i] == i);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
+
+TEST_CASE("UploadBatch uploads cube map faces one by one"){
+  auto const table = createTable(make_shared<NullFunctionLoader>(),PROFILING_TABLE);
+  Texture cube(table,GL_TEXTURE_CUBE_MAP,GL_RGBA8,1,4,4);
+  vector<uint8_t>const pixels(6*4*4*4,7);
+  {
+    UploadBatch batch(table,1024);
+    batch.setTextureData(&cube,pixels.data(),GL_RGBA,GL_UNSIGNED_BYTE,0,0,0,0,4,4,6);
+  }
+  REQUIRE(countCalls(table,"glTextureSubImage2DEXT") == 6);
+  REQUIRE(countCalls(table,"glTextureSubImage3DEXT") == 0);
+  REQUIRE(table->glGetError() == GL_NO_ERROR);
+}
@@ -0,0 +1,59 @@
+#include<geGL/OpenGL.h>
+#include<geGL/FunctionLoaderInterface.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/OpenGLContext.h>
+#include<geGL/DirectContext.h>
+#include<chrono>
+#include<cstring>
+#include<iostream>
+#include<string>
+
+using namespace ge::gl;
+
+/**
+ * @brief Loader of stub functions that only count their calls
+ */
+class StubLoader: public FunctionLoaderInterface{
+  public:
+    static size_t&counter(){
+      static size_t c = 0;
+      return c;
+    }
+    static void stubDrawArrays(GLenum,GLint,GLsizei){counter()++;}
+    static void stubUniform1f (GLint,GLfloat       ){counter()++;}
+    virtual FUNCTION_POINTER load(char const*fceName)const override{
+      if(std::strcmp(fceName,"glDrawArrays") == 0)return (FUNCTION_POINTER)stubDrawArrays;
+      if(std::strcmp(fceName,"glUniform1f" ) == 0)return (FUNCTION_POINTER)stubUniform1f ;
+      return nullptr;
+    }
+};
+
+template<typename CONTEXT>
+double measure(CONTEXT const&gl,size_t nofCalls){
+  auto const start = std::chrono::steady_clock::now();
+  for(size_t i=0;i<nofCalls;++i){
+    gl.glUniform1f(0,(GLfloat)i);
+    gl.glDrawArrays(GL_TRIANGLES,0,3);
+  }
+  auto const duration = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()/(double)(2*nofCalls);
+}
+
+/**
+ * @brief Compares dispatch of Context (shared_ptr table, member function pointer, loader thunk)
+ * with DirectContext (raw function pointer snapshot) over stub loader.
+ *
+ * usage: glDispatchBenchmark [number of draw calls]
+ */
+int main(int argc,char*argv[]){
+  size_t const nofCalls = argc > 1 ? std::stoul(argv[1]) : 10000000;
+  auto const table = createTable(std::make_shared<StubLoader>());
+  Context       context(table);
+  DirectContext direct (table);
+
+  for(int i=0;i<2;++i){
+    std::cout << "Context      : " << measure(context,nofCalls) << " ns per call" << std::endl;
+    std::cout << "DirectContext: " << measure(direct ,nofCalls) << " ns per call" << std::endl;
+  }
+  return StubLoader::counter() == 8*nofCalls ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include<geGL/MipmapGenerator.h>
+#include<chrono>
+#include<cstdlib>
+#include<iostream>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+
+using Levels = std::vector<MipmapGenerator::Level>;
+
+double measure(MipmapGenerator const&generator,std::vector<uint8_t>const&image,GLsizei size,size_t nofRuns,Levels&levels){
+  auto const start = std::chrono::steady_clock::now();
+  for(size_t i=0;i<nofRuns;++i)
+    levels = generator.generate(image.data(),size,size,GL_BGR,GL_UNSIGNED_BYTE,GL_RGBA,GL_UNSIGNED_BYTE);
+  auto const duration = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(duration).count()/(1000.*nofRuns);
+}
+
+/**
+ * @brief Compares SIMD and multithreaded mipmap generation with scalar single thread reference.
+ * Source is BGR8 image, levels are RGBA8, results have to match reference.
+ *
+ * usage: glMipmapBenchmark [size of image] [number of runs]
+ */
+int main(int argc,char*argv[]){
+  GLsizei const size    = argc > 1 ? std::stoi (argv[1]) : 2048;
+  size_t  const nofRuns = argc > 2 ? std::stoul(argv[2]) : 5;
+  std::vector<uint8_t>image((size_t)size*size*3);
+  for(auto&b:image)b = (uint8_t)(std::rand()&0xff);
+
+  std::cout << "SIMD available: " << (MipmapGenerator::isSimdAvailable() ? "yes" : "no") << std::endl;
+  int result = 0;
+  for(auto const filter:{MipmapGenerator::BOX,MipmapGenerator::KAISER}){
+    for(auto const srgb:{false,true}){
+      std::cout << (filter == MipmapGenerator::BOX ? "box   " : "kaiser") << (srgb ? " sRGB  " : " linear") << std::endl;
+      MipmapGenerator reference(filter,srgb,1);
+      reference.setImplementation(MipmapGenerator::SCALAR);
+      Levels expected;
+      auto const base = measure(reference,image,size,nofRuns,expected);
+      std::cout << "  scalar 1 thread : " << base << " ms" << std::endl;
+      for(auto const threads:{size_t(1),size_t(0)}){
+        MipmapGenerator generator(filter,srgb,threads);
+        Levels levels;
+        auto const time = measure(generator,image,size,nofRuns,levels);
+        std::cout << "  SIMD " << generator.getNofThreads() << " thread(s): " << time << " ms (" << base/time << "x)" << std::endl;
+        for(size_t l=0;l<levels.size();++l)
+          if(levels[l].data != expected[l].data){
+            std::cout << "  level " << l << " differs from scalar reference" << std::endl;
+            result = 1;
+          }
+      }
+    }
+  }
+  return result;
+}
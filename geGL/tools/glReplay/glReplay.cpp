@@ -0,0 +1,57 @@
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/CaptureStream.h>
+#include<geGL/ProfilingInterface.h>
+#include<geGL/NullFunctionLoader.h>
+#include<fstream>
+#include<iostream>
+#include<string>
+
+using namespace ge::gl;
+
+/**
+ * @brief Replays capture written by CaptureTableDecorator on null backend
+ * and prints number of calls and time of every frame.
+ *
+ * usage: glReplay <capture file> [number of most called functions per frame]
+ */
+int main(int argc,char*argv[]){
+  if(argc < 2){
+    std::cerr << "usage: " << argv[0] << " <capture file> [top functions per frame]" << std::endl;
+    return 1;
+  }
+  std::ifstream stream(argv[1],std::ios::binary);
+  if(!stream){
+    std::cerr << "cannot open file: " << argv[1] << std::endl;
+    return 1;
+  }
+  size_t const nofTop = argc > 2 ? std::stoul(argv[2]) : 5;
+
+  auto const loader    = std::make_shared<NullFunctionLoader>();
+  auto const table     = createTable(loader,PROFILING_TABLE);
+  auto const profiling = getProfiling(table);
+  profiling->setTiming(true);
+
+  auto const onFrame = [&](size_t frame){
+    profiling->nextFrame();
+    std::cout << "frame " << frame << std::endl;
+    for(auto const&f:profiling->getProfile(nofTop,ProfilingInterface::BY_CALLS,ProfilingInterface::LAST_FRAME))
+      std::cout << "  " << f.name << " " << f.calls << " calls " << f.nanoseconds << " ns" << std::endl;
+  };
+
+  try{
+    auto const frames = replayCapture(*table,stream,onFrame);
+    uint64_t calls       = 0;
+    uint64_t nanoseconds = 0;
+    for(size_t i=0;i<frames.size();++i){
+      std::cout << "frame " << i << ": " << frames[i].calls << " calls, " << frames[i].nanoseconds/1000.0 << " us" << std::endl;
+      calls       += frames[i].calls;
+      nanoseconds += frames[i].nanoseconds;
+    }
+    std::cout << frames.size() << " frames, " << calls << " calls, " << nanoseconds/1000000.0 << " ms" << std::endl;
+  }catch(std::exception const&e){
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include<geGL/OpenGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<chrono>
+#include<iostream>
+#include<string>
+
+using namespace ge::gl;
+
+/**
+ * @brief Null function loader that counts loaded functions
+ */
+class CountingLoader: public NullFunctionLoader{
+  public:
+    virtual FUNCTION_POINTER load(char const*fceName)const override{
+      loads++;
+      return NullFunctionLoader::load(fceName);
+    }
+    mutable size_t loads = 0;
+};
+
+/**
+ * @brief Measures creation of function tables using eager and lazy loading.
+ * Each table is created, a few typical functions are called and the table is destroyed.
+ *
+ * usage: glStartupBenchmark [number of tables]
+ */
+int main(int argc,char*argv[]){
+  size_t const nofTables = argc > 1 ? std::stoul(argv[1]) : 100;
+  auto const loader = std::make_shared<CountingLoader>();
+
+  auto const measure = [&](char const*name,uint32_t flags){
+    loader->loads = 0;
+    auto const start = std::chrono::steady_clock::now();
+    for(size_t i=0;i<nofTables;++i){
+      auto const table = createTable(loader,flags);
+      GLuint buffer;
+      table->glCreateBuffers(1,&buffer);
+      table->glNamedBufferData(buffer,16,nullptr,GL_STATIC_DRAW);
+      table->glBindBufferBase(GL_SHADER_STORAGE_BUFFER,0,buffer);
+      table->glDeleteBuffers(1,&buffer);
+    }
+    auto const duration = std::chrono::steady_clock::now() - start;
+    auto const us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    std::cout << name << ": " << us/(double)nofTables << " us per table, " << loader->loads/nofTables << " loaded functions per table" << std::endl;
+  };
+
+  measure("eager",DEFAULT_TABLE     );
+  measure("lazy ",LAZY_LOADING_TABLE);
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include<geGL/geGL.h>
+#include<geGL/OpenGLFunctionTable.h>
+#include<geGL/NullFunctionLoader.h>
+#include<chrono>
+#include<iostream>
+#include<sstream>
+#include<string>
+#include<vector>
+
+using namespace ge::gl;
+
+/**
+ * @brief Null function loader whose glProgramUniform4fv only counts its calls
+ */
+class StubLoader: public NullFunctionLoader{
+  public:
+    static size_t&counter(){
+      static size_t c = 0;
+      return c;
+    }
+    static void stubProgramUniform4fv(GLuint,GLint,GLsizei,GLfloat const*){counter()++;}
+    virtual FUNCTION_POINTER load(char const*fceName)const override{
+      if(std::string(fceName) == "glProgramUniform4fv")return (FUNCTION_POINTER)stubProgramUniform4fv;
+      return NullFunctionLoader::load(fceName);
+    }
+};
+
+size_t const nofUniforms = 20;
+
+std::string uniformName(size_t i){
+  return "material" + std::to_string(i) + "Color";
+}
+
+std::shared_ptr<Program>createProgram(FunctionTablePointer const&table){
+  std::stringstream ss;
+  for(size_t i=0;i<nofUniforms;++i)
+    ss << "uniform vec4 " << uniformName(i) << ";\n";
+  ss << "out vec4 fColor;\nvoid main(){fColor = vec4(0);\n";
+  for(size_t i=0;i<nofUniforms;++i)
+    ss << "fColor += " << uniformName(i) << ";\n";
+  ss << "}\n";
+  auto const fs = std::make_shared<Shader>(table,GL_FRAGMENT_SHADER,Shader::Sources{"#version 450\n",ss.str()});
+  return std::make_shared<Program>(table,fs);
+}
+
+template<typename SET>
+double measure(size_t nofDraws,SET const&set){
+  auto const start = std::chrono::steady_clock::now();
+  for(size_t d=0;d<nofDraws;++d)
+    for(size_t i=0;i<nofUniforms;++i)
+      set(i,(float)d);
+  auto const duration = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()/(double)(nofDraws*nofUniforms);
+}
+
+/**
+ * @brief Compares name based Program::set4f (map lookup per call)
+ * with typed uniform handles (Program::getUniform once, Program::set per call) over stub loader.
+ *
+ * usage: glUniformBenchmark [number of draws]
+ */
+int main(int argc,char*argv[]){
+  size_t const nofDraws = argc > 1 ? std::stoul(argv[1]) : 100000;
+  auto const table   = createTable(std::make_shared<StubLoader>());
+  auto const program = createProgram(table);
+
+  std::vector<std::string>names;
+  std::vector<Uniform<GL_FLOAT_VEC4>>handles;
+  for(size_t i=0;i<nofUniforms;++i){
+    names  .push_back(uniformName(i));
+    handles.push_back(program->getUniform<GL_FLOAT_VEC4>(names.back()));
+  }
+
+  auto const byName = [&](size_t i,float v){program->set4f(names[i],v,v,v,1.f);};
+  auto const byHandle = [&](size_t i,float v){program->set(handles[i],v,v,v,1.f);};
+  for(int i=0;i<2;++i){
+    auto const nameTime   = measure(nofDraws,byName  );
+    auto const handleTime = measure(nofDraws,byHandle);
+    std::cout << "name   : " << nameTime   << " ns per set" << std::endl;
+    std::cout << "handle : " << handleTime << " ns per set" << std::endl;
+    std::cout << "speedup: " << nameTime/handleTime << "x" << std::endl;
+  }
+  return StubLoader::counter() == 4*nofDraws*nofUniforms ? 0 : 1;
+}